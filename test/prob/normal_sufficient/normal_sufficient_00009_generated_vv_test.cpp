@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/normal_sufficient/normal_sufficient_test.hpp>
+
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, double, empty> type_vv_900;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<double>, empty> type_vv_901;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_902;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, var, empty> type_vv_903;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<var>, empty> type_vv_904;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_905;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, double, empty> type_vv_906;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty> type_vv_907;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_908;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, var, empty> type_vv_909;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty> type_vv_910;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_911;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty> type_vv_912;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty> type_vv_913;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_914;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty> type_vv_915;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty> type_vv_916;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_917;
+typedef std::tuple<std::vector<double>, std::vector<var>, int, double, double, empty> type_vv_918;
+typedef std::tuple<std::vector<double>, std::vector<var>, int, double, std::vector<double>, empty> type_vv_919;
+typedef std::tuple<std::vector<double>, std::vector<var>, int, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_920;
+typedef std::tuple<std::vector<double>, std::vector<var>, int, double, var, empty> type_vv_921;
+typedef std::tuple<std::vector<double>, std::vector<var>, int, double, std::vector<var>, empty> type_vv_922;
+typedef std::tuple<std::vector<double>, std::vector<var>, int, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_923;
+typedef std::tuple<std::vector<double>, std::vector<var>, int, std::vector<double>, double, empty> type_vv_924;
+typedef std::tuple<std::vector<double>, std::vector<var>, int, std::vector<double>, std::vector<double>, empty> type_vv_925;
+typedef std::tuple<std::vector<double>, std::vector<var>, int, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_926;
+typedef std::tuple<std::vector<double>, std::vector<var>, int, std::vector<double>, var, empty> type_vv_927;
+typedef std::tuple<std::vector<double>, std::vector<var>, int, std::vector<double>, std::vector<var>, empty> type_vv_928;
+typedef std::tuple<std::vector<double>, std::vector<var>, int, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_929;
+typedef std::tuple<std::vector<double>, std::vector<var>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_vv_930;
+typedef std::tuple<std::vector<double>, std::vector<var>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_vv_931;
+typedef std::tuple<std::vector<double>, std::vector<var>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_932;
+typedef std::tuple<std::vector<double>, std::vector<var>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_vv_933;
+typedef std::tuple<std::vector<double>, std::vector<var>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_vv_934;
+typedef std::tuple<std::vector<double>, std::vector<var>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_935;
+typedef std::tuple<std::vector<double>, std::vector<var>, int, var, double, empty> type_vv_936;
+typedef std::tuple<std::vector<double>, std::vector<var>, int, var, std::vector<double>, empty> type_vv_937;
+typedef std::tuple<std::vector<double>, std::vector<var>, int, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_938;
+typedef std::tuple<std::vector<double>, std::vector<var>, int, var, var, empty> type_vv_939;
+typedef std::tuple<std::vector<double>, std::vector<var>, int, var, std::vector<var>, empty> type_vv_940;
+typedef std::tuple<std::vector<double>, std::vector<var>, int, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_941;
+typedef std::tuple<std::vector<double>, std::vector<var>, int, std::vector<var>, double, empty> type_vv_942;
+typedef std::tuple<std::vector<double>, std::vector<var>, int, std::vector<var>, std::vector<double>, empty> type_vv_943;
+typedef std::tuple<std::vector<double>, std::vector<var>, int, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_944;
+typedef std::tuple<std::vector<double>, std::vector<var>, int, std::vector<var>, var, empty> type_vv_945;
+typedef std::tuple<std::vector<double>, std::vector<var>, int, std::vector<var>, std::vector<var>, empty> type_vv_946;
+typedef std::tuple<std::vector<double>, std::vector<var>, int, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_947;
+typedef std::tuple<std::vector<double>, std::vector<var>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty> type_vv_948;
+typedef std::tuple<std::vector<double>, std::vector<var>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty> type_vv_949;
+typedef std::tuple<std::vector<double>, std::vector<var>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_950;
+typedef std::tuple<std::vector<double>, std::vector<var>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty> type_vv_951;
+typedef std::tuple<std::vector<double>, std::vector<var>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty> type_vv_952;
+typedef std::tuple<std::vector<double>, std::vector<var>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_953;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<int>, double, double, empty> type_vv_954;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<int>, double, std::vector<double>, empty> type_vv_955;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<int>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_956;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<int>, double, var, empty> type_vv_957;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<int>, double, std::vector<var>, empty> type_vv_958;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<int>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_959;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<int>, std::vector<double>, double, empty> type_vv_960;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<int>, std::vector<double>, std::vector<double>, empty> type_vv_961;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<int>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_962;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<int>, std::vector<double>, var, empty> type_vv_963;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<int>, std::vector<double>, std::vector<var>, empty> type_vv_964;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<int>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_965;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_vv_966;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_vv_967;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_968;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_vv_969;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_vv_970;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_971;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<int>, var, double, empty> type_vv_972;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<int>, var, std::vector<double>, empty> type_vv_973;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<int>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_974;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<int>, var, var, empty> type_vv_975;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<int>, var, std::vector<var>, empty> type_vv_976;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<int>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_977;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<int>, std::vector<var>, double, empty> type_vv_978;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<int>, std::vector<var>, std::vector<double>, empty> type_vv_979;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<int>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_980;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<int>, std::vector<var>, var, empty> type_vv_981;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<int>, std::vector<var>, std::vector<var>, empty> type_vv_982;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<int>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_983;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty> type_vv_984;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty> type_vv_985;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_986;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty> type_vv_987;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty> type_vv_988;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_989;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, double, empty> type_vv_990;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_vv_991;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_992;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, var, empty> type_vv_993;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<var>, empty> type_vv_994;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_995;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_vv_996;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_vv_997;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_998;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, var, empty> type_vv_999;
+
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_900> AgradDistributionNormalSufficient_vv_900;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_901> AgradDistributionNormalSufficient_vv_901;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_902> AgradDistributionNormalSufficient_vv_902;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_903> AgradDistributionNormalSufficient_vv_903;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_904> AgradDistributionNormalSufficient_vv_904;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_905> AgradDistributionNormalSufficient_vv_905;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_906> AgradDistributionNormalSufficient_vv_906;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_907> AgradDistributionNormalSufficient_vv_907;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_908> AgradDistributionNormalSufficient_vv_908;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_909> AgradDistributionNormalSufficient_vv_909;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_910> AgradDistributionNormalSufficient_vv_910;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_911> AgradDistributionNormalSufficient_vv_911;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_912> AgradDistributionNormalSufficient_vv_912;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_913> AgradDistributionNormalSufficient_vv_913;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_914> AgradDistributionNormalSufficient_vv_914;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_915> AgradDistributionNormalSufficient_vv_915;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_916> AgradDistributionNormalSufficient_vv_916;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_917> AgradDistributionNormalSufficient_vv_917;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_918> AgradDistributionNormalSufficient_vv_918;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_919> AgradDistributionNormalSufficient_vv_919;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_920> AgradDistributionNormalSufficient_vv_920;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_921> AgradDistributionNormalSufficient_vv_921;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_922> AgradDistributionNormalSufficient_vv_922;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_923> AgradDistributionNormalSufficient_vv_923;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_924> AgradDistributionNormalSufficient_vv_924;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_925> AgradDistributionNormalSufficient_vv_925;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_926> AgradDistributionNormalSufficient_vv_926;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_927> AgradDistributionNormalSufficient_vv_927;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_928> AgradDistributionNormalSufficient_vv_928;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_929> AgradDistributionNormalSufficient_vv_929;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_930> AgradDistributionNormalSufficient_vv_930;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_931> AgradDistributionNormalSufficient_vv_931;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_932> AgradDistributionNormalSufficient_vv_932;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_933> AgradDistributionNormalSufficient_vv_933;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_934> AgradDistributionNormalSufficient_vv_934;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_935> AgradDistributionNormalSufficient_vv_935;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_936> AgradDistributionNormalSufficient_vv_936;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_937> AgradDistributionNormalSufficient_vv_937;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_938> AgradDistributionNormalSufficient_vv_938;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_939> AgradDistributionNormalSufficient_vv_939;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_940> AgradDistributionNormalSufficient_vv_940;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_941> AgradDistributionNormalSufficient_vv_941;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_942> AgradDistributionNormalSufficient_vv_942;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_943> AgradDistributionNormalSufficient_vv_943;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_944> AgradDistributionNormalSufficient_vv_944;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_945> AgradDistributionNormalSufficient_vv_945;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_946> AgradDistributionNormalSufficient_vv_946;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_947> AgradDistributionNormalSufficient_vv_947;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_948> AgradDistributionNormalSufficient_vv_948;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_949> AgradDistributionNormalSufficient_vv_949;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_950> AgradDistributionNormalSufficient_vv_950;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_951> AgradDistributionNormalSufficient_vv_951;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_952> AgradDistributionNormalSufficient_vv_952;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_953> AgradDistributionNormalSufficient_vv_953;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_954> AgradDistributionNormalSufficient_vv_954;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_955> AgradDistributionNormalSufficient_vv_955;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_956> AgradDistributionNormalSufficient_vv_956;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_957> AgradDistributionNormalSufficient_vv_957;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_958> AgradDistributionNormalSufficient_vv_958;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_959> AgradDistributionNormalSufficient_vv_959;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_960> AgradDistributionNormalSufficient_vv_960;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_961> AgradDistributionNormalSufficient_vv_961;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_962> AgradDistributionNormalSufficient_vv_962;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_963> AgradDistributionNormalSufficient_vv_963;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_964> AgradDistributionNormalSufficient_vv_964;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_965> AgradDistributionNormalSufficient_vv_965;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_966> AgradDistributionNormalSufficient_vv_966;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_967> AgradDistributionNormalSufficient_vv_967;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_968> AgradDistributionNormalSufficient_vv_968;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_969> AgradDistributionNormalSufficient_vv_969;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_970> AgradDistributionNormalSufficient_vv_970;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_971> AgradDistributionNormalSufficient_vv_971;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_972> AgradDistributionNormalSufficient_vv_972;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_973> AgradDistributionNormalSufficient_vv_973;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_974> AgradDistributionNormalSufficient_vv_974;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_975> AgradDistributionNormalSufficient_vv_975;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_976> AgradDistributionNormalSufficient_vv_976;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_977> AgradDistributionNormalSufficient_vv_977;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_978> AgradDistributionNormalSufficient_vv_978;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_979> AgradDistributionNormalSufficient_vv_979;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_980> AgradDistributionNormalSufficient_vv_980;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_981> AgradDistributionNormalSufficient_vv_981;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_982> AgradDistributionNormalSufficient_vv_982;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_983> AgradDistributionNormalSufficient_vv_983;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_984> AgradDistributionNormalSufficient_vv_984;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_985> AgradDistributionNormalSufficient_vv_985;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_986> AgradDistributionNormalSufficient_vv_986;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_987> AgradDistributionNormalSufficient_vv_987;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_988> AgradDistributionNormalSufficient_vv_988;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_989> AgradDistributionNormalSufficient_vv_989;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_990> AgradDistributionNormalSufficient_vv_990;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_991> AgradDistributionNormalSufficient_vv_991;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_992> AgradDistributionNormalSufficient_vv_992;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_993> AgradDistributionNormalSufficient_vv_993;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_994> AgradDistributionNormalSufficient_vv_994;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_995> AgradDistributionNormalSufficient_vv_995;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_996> AgradDistributionNormalSufficient_vv_996;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_997> AgradDistributionNormalSufficient_vv_997;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_998> AgradDistributionNormalSufficient_vv_998;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_999> AgradDistributionNormalSufficient_vv_999;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_900, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_900);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_901, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_901);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_902, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_902);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_903, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_903);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_904, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_904);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_905, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_905);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_906, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_906);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_907, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_907);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_908, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_908);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_909, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_909);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_910, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_910);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_911, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_911);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_912, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_912);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_913, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_913);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_914, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_914);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_915, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_915);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_916, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_916);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_917, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_917);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_918, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_918);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_919, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_919);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_920, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_920);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_921, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_921);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_922, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_922);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_923, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_923);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_924, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_924);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_925, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_925);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_926, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_926);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_927, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_927);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_928, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_928);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_929, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_929);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_930, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_930);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_931, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_931);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_932, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_932);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_933, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_933);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_934, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_934);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_935, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_935);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_936, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_936);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_937, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_937);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_938, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_938);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_939, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_939);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_940, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_940);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_941, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_941);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_942, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_942);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_943, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_943);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_944, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_944);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_945, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_945);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_946, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_946);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_947, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_947);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_948, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_948);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_949, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_949);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_950, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_950);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_951, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_951);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_952, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_952);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_953, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_953);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_954, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_954);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_955, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_955);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_956, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_956);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_957, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_957);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_958, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_958);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_959, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_959);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_960, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_960);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_961, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_961);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_962, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_962);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_963, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_963);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_964, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_964);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_965, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_965);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_966, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_966);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_967, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_967);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_968, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_968);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_969, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_969);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_970, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_970);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_971, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_971);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_972, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_972);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_973, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_973);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_974, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_974);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_975, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_975);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_976, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_976);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_977, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_977);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_978, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_978);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_979, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_979);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_980, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_980);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_981, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_981);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_982, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_982);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_983, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_983);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_984, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_984);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_985, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_985);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_986, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_986);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_987, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_987);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_988, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_988);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_989, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_989);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_990, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_990);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_991, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_991);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_992, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_992);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_993, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_993);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_994, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_994);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_995, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_995);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_996, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_996);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_997, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_997);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_998, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_998);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_999, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_999);
+
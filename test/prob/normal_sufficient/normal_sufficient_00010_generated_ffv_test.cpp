@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/normal_sufficient/normal_sufficient_test.hpp>
+
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1000;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1001;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffv_1002;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_1003;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1004;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_1005;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1006;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1007;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty> type_ffv_1008;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_1009;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1010;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_1011;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_1012;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1013;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_1014;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_1015;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1016;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_1017;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1018;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1019;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_1020;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_1021;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1022;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_1023;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1024;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1025;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, int, double, double, empty> type_ffv_1026;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, int, double, std::vector<double>, empty> type_ffv_1027;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, int, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1028;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, int, double, fvar<fvar<var> >, empty> type_ffv_1029;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, int, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_1030;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, int, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1031;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, int, std::vector<double>, double, empty> type_ffv_1032;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, int, std::vector<double>, std::vector<double>, empty> type_ffv_1033;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, int, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1034;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, int, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_1035;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, int, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1036;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, int, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1037;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffv_1038;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_1039;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1040;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_1041;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1042;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1043;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, int, fvar<fvar<var> >, double, empty> type_ffv_1044;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, int, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_1045;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, int, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1046;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, int, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_1047;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, int, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_1048;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, int, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1049;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, int, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_1050;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, int, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_1051;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1052;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, int, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_1053;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, int, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1054;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1055;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_1056;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_1057;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1058;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_1059;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1060;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1061;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<int>, double, double, empty> type_ffv_1062;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<int>, double, std::vector<double>, empty> type_ffv_1063;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<int>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1064;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<int>, double, fvar<fvar<var> >, empty> type_ffv_1065;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<int>, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_1066;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<int>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1067;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, double, empty> type_ffv_1068;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, std::vector<double>, empty> type_ffv_1069;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1070;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_1071;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1072;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1073;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffv_1074;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_1075;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1076;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_1077;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1078;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1079;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<int>, fvar<fvar<var> >, double, empty> type_ffv_1080;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<int>, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_1081;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1082;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<int>, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_1083;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<int>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_1084;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1085;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<int>, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_1086;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_1087;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1088;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<int>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_1089;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1090;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1091;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_1092;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_1093;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1094;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_1095;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1096;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1097;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, double, empty> type_ffv_1098;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_ffv_1099;
+
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1000> AgradDistributionNormalSufficient_ffv_1000;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1001> AgradDistributionNormalSufficient_ffv_1001;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1002> AgradDistributionNormalSufficient_ffv_1002;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1003> AgradDistributionNormalSufficient_ffv_1003;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1004> AgradDistributionNormalSufficient_ffv_1004;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1005> AgradDistributionNormalSufficient_ffv_1005;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1006> AgradDistributionNormalSufficient_ffv_1006;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1007> AgradDistributionNormalSufficient_ffv_1007;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1008> AgradDistributionNormalSufficient_ffv_1008;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1009> AgradDistributionNormalSufficient_ffv_1009;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1010> AgradDistributionNormalSufficient_ffv_1010;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1011> AgradDistributionNormalSufficient_ffv_1011;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1012> AgradDistributionNormalSufficient_ffv_1012;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1013> AgradDistributionNormalSufficient_ffv_1013;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1014> AgradDistributionNormalSufficient_ffv_1014;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1015> AgradDistributionNormalSufficient_ffv_1015;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1016> AgradDistributionNormalSufficient_ffv_1016;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1017> AgradDistributionNormalSufficient_ffv_1017;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1018> AgradDistributionNormalSufficient_ffv_1018;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1019> AgradDistributionNormalSufficient_ffv_1019;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1020> AgradDistributionNormalSufficient_ffv_1020;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1021> AgradDistributionNormalSufficient_ffv_1021;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1022> AgradDistributionNormalSufficient_ffv_1022;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1023> AgradDistributionNormalSufficient_ffv_1023;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1024> AgradDistributionNormalSufficient_ffv_1024;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1025> AgradDistributionNormalSufficient_ffv_1025;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1026> AgradDistributionNormalSufficient_ffv_1026;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1027> AgradDistributionNormalSufficient_ffv_1027;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1028> AgradDistributionNormalSufficient_ffv_1028;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1029> AgradDistributionNormalSufficient_ffv_1029;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1030> AgradDistributionNormalSufficient_ffv_1030;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1031> AgradDistributionNormalSufficient_ffv_1031;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1032> AgradDistributionNormalSufficient_ffv_1032;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1033> AgradDistributionNormalSufficient_ffv_1033;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1034> AgradDistributionNormalSufficient_ffv_1034;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1035> AgradDistributionNormalSufficient_ffv_1035;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1036> AgradDistributionNormalSufficient_ffv_1036;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1037> AgradDistributionNormalSufficient_ffv_1037;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1038> AgradDistributionNormalSufficient_ffv_1038;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1039> AgradDistributionNormalSufficient_ffv_1039;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1040> AgradDistributionNormalSufficient_ffv_1040;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1041> AgradDistributionNormalSufficient_ffv_1041;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1042> AgradDistributionNormalSufficient_ffv_1042;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1043> AgradDistributionNormalSufficient_ffv_1043;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1044> AgradDistributionNormalSufficient_ffv_1044;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1045> AgradDistributionNormalSufficient_ffv_1045;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1046> AgradDistributionNormalSufficient_ffv_1046;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1047> AgradDistributionNormalSufficient_ffv_1047;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1048> AgradDistributionNormalSufficient_ffv_1048;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1049> AgradDistributionNormalSufficient_ffv_1049;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1050> AgradDistributionNormalSufficient_ffv_1050;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1051> AgradDistributionNormalSufficient_ffv_1051;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1052> AgradDistributionNormalSufficient_ffv_1052;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1053> AgradDistributionNormalSufficient_ffv_1053;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1054> AgradDistributionNormalSufficient_ffv_1054;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1055> AgradDistributionNormalSufficient_ffv_1055;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1056> AgradDistributionNormalSufficient_ffv_1056;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1057> AgradDistributionNormalSufficient_ffv_1057;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1058> AgradDistributionNormalSufficient_ffv_1058;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1059> AgradDistributionNormalSufficient_ffv_1059;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1060> AgradDistributionNormalSufficient_ffv_1060;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1061> AgradDistributionNormalSufficient_ffv_1061;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1062> AgradDistributionNormalSufficient_ffv_1062;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1063> AgradDistributionNormalSufficient_ffv_1063;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1064> AgradDistributionNormalSufficient_ffv_1064;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1065> AgradDistributionNormalSufficient_ffv_1065;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1066> AgradDistributionNormalSufficient_ffv_1066;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1067> AgradDistributionNormalSufficient_ffv_1067;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1068> AgradDistributionNormalSufficient_ffv_1068;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1069> AgradDistributionNormalSufficient_ffv_1069;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1070> AgradDistributionNormalSufficient_ffv_1070;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1071> AgradDistributionNormalSufficient_ffv_1071;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1072> AgradDistributionNormalSufficient_ffv_1072;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1073> AgradDistributionNormalSufficient_ffv_1073;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1074> AgradDistributionNormalSufficient_ffv_1074;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1075> AgradDistributionNormalSufficient_ffv_1075;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1076> AgradDistributionNormalSufficient_ffv_1076;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1077> AgradDistributionNormalSufficient_ffv_1077;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1078> AgradDistributionNormalSufficient_ffv_1078;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1079> AgradDistributionNormalSufficient_ffv_1079;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1080> AgradDistributionNormalSufficient_ffv_1080;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1081> AgradDistributionNormalSufficient_ffv_1081;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1082> AgradDistributionNormalSufficient_ffv_1082;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1083> AgradDistributionNormalSufficient_ffv_1083;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1084> AgradDistributionNormalSufficient_ffv_1084;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1085> AgradDistributionNormalSufficient_ffv_1085;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1086> AgradDistributionNormalSufficient_ffv_1086;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1087> AgradDistributionNormalSufficient_ffv_1087;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1088> AgradDistributionNormalSufficient_ffv_1088;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1089> AgradDistributionNormalSufficient_ffv_1089;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1090> AgradDistributionNormalSufficient_ffv_1090;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1091> AgradDistributionNormalSufficient_ffv_1091;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1092> AgradDistributionNormalSufficient_ffv_1092;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1093> AgradDistributionNormalSufficient_ffv_1093;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1094> AgradDistributionNormalSufficient_ffv_1094;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1095> AgradDistributionNormalSufficient_ffv_1095;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1096> AgradDistributionNormalSufficient_ffv_1096;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1097> AgradDistributionNormalSufficient_ffv_1097;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1098> AgradDistributionNormalSufficient_ffv_1098;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1099> AgradDistributionNormalSufficient_ffv_1099;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1000, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1000);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1001, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1001);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1002, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1002);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1003, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1003);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1004, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1004);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1005, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1005);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1006, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1006);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1007, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1007);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1008, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1008);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1009, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1009);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1010, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1010);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1011, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1011);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1012, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1012);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1013, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1013);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1014, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1014);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1015, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1015);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1016, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1016);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1017, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1017);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1018, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1018);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1019, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1019);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1020, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1020);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1021, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1021);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1022, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1022);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1023, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1023);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1024, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1024);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1025, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1025);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1026, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1026);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1027, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1027);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1028, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1028);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1029, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1029);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1030, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1030);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1031, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1031);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1032, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1032);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1033, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1033);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1034, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1034);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1035, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1035);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1036, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1036);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1037, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1037);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1038, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1038);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1039, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1039);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1040, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1040);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1041, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1041);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1042, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1042);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1043, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1043);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1044, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1044);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1045, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1045);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1046, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1046);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1047, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1047);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1048, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1048);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1049, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1049);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1050, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1050);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1051, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1051);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1052, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1052);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1053, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1053);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1054, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1054);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1055, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1055);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1056, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1056);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1057, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1057);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1058, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1058);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1059, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1059);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1060, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1060);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1061, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1061);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1062, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1062);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1063, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1063);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1064, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1064);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1065, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1065);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1066, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1066);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1067, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1067);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1068, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1068);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1069, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1069);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1070, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1070);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1071, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1071);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1072, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1072);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1073, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1073);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1074, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1074);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1075, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1075);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1076, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1076);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1077, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1077);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1078, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1078);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1079, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1079);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1080, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1080);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1081, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1081);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1082, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1082);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1083, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1083);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1084, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1084);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1085, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1085);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1086, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1086);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1087, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1087);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1088, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1088);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1089, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1089);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1090, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1090);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1091, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1091);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1092, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1092);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1093, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1093);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1094, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1094);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1095, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1095);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1096, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1096);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1097, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1097);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1098, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1098);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1099, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1099);
+
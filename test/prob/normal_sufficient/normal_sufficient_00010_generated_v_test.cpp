@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/normal_sufficient/normal_sufficient_test.hpp>
+
+typedef std::tuple<std::vector<double>, var, int, std::vector<var>, std::vector<var>, empty> type_v_1000;
+typedef std::tuple<std::vector<double>, var, int, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_1001;
+typedef std::tuple<std::vector<double>, var, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_1002;
+typedef std::tuple<std::vector<double>, var, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_1003;
+typedef std::tuple<std::vector<double>, var, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_1004;
+typedef std::tuple<std::vector<double>, var, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_1005;
+typedef std::tuple<std::vector<double>, var, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_1006;
+typedef std::tuple<std::vector<double>, var, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_1007;
+typedef std::tuple<std::vector<double>, var, std::vector<int>, double, double, empty> type_v_1008;
+typedef std::tuple<std::vector<double>, var, std::vector<int>, double, std::vector<double>, empty> type_v_1009;
+typedef std::tuple<std::vector<double>, var, std::vector<int>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_1010;
+typedef std::tuple<std::vector<double>, var, std::vector<int>, double, var, empty> type_v_1011;
+typedef std::tuple<std::vector<double>, var, std::vector<int>, double, std::vector<var>, empty> type_v_1012;
+typedef std::tuple<std::vector<double>, var, std::vector<int>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_1013;
+typedef std::tuple<std::vector<double>, var, std::vector<int>, std::vector<double>, double, empty> type_v_1014;
+typedef std::tuple<std::vector<double>, var, std::vector<int>, std::vector<double>, std::vector<double>, empty> type_v_1015;
+typedef std::tuple<std::vector<double>, var, std::vector<int>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_1016;
+typedef std::tuple<std::vector<double>, var, std::vector<int>, std::vector<double>, var, empty> type_v_1017;
+typedef std::tuple<std::vector<double>, var, std::vector<int>, std::vector<double>, std::vector<var>, empty> type_v_1018;
+typedef std::tuple<std::vector<double>, var, std::vector<int>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_1019;
+typedef std::tuple<std::vector<double>, var, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_1020;
+typedef std::tuple<std::vector<double>, var, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_1021;
+typedef std::tuple<std::vector<double>, var, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_1022;
+typedef std::tuple<std::vector<double>, var, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_1023;
+typedef std::tuple<std::vector<double>, var, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_1024;
+typedef std::tuple<std::vector<double>, var, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_1025;
+typedef std::tuple<std::vector<double>, var, std::vector<int>, var, double, empty> type_v_1026;
+typedef std::tuple<std::vector<double>, var, std::vector<int>, var, std::vector<double>, empty> type_v_1027;
+typedef std::tuple<std::vector<double>, var, std::vector<int>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_1028;
+typedef std::tuple<std::vector<double>, var, std::vector<int>, var, var, empty> type_v_1029;
+typedef std::tuple<std::vector<double>, var, std::vector<int>, var, std::vector<var>, empty> type_v_1030;
+typedef std::tuple<std::vector<double>, var, std::vector<int>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_1031;
+typedef std::tuple<std::vector<double>, var, std::vector<int>, std::vector<var>, double, empty> type_v_1032;
+typedef std::tuple<std::vector<double>, var, std::vector<int>, std::vector<var>, std::vector<double>, empty> type_v_1033;
+typedef std::tuple<std::vector<double>, var, std::vector<int>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_1034;
+typedef std::tuple<std::vector<double>, var, std::vector<int>, std::vector<var>, var, empty> type_v_1035;
+typedef std::tuple<std::vector<double>, var, std::vector<int>, std::vector<var>, std::vector<var>, empty> type_v_1036;
+typedef std::tuple<std::vector<double>, var, std::vector<int>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_1037;
+typedef std::tuple<std::vector<double>, var, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_1038;
+typedef std::tuple<std::vector<double>, var, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_1039;
+typedef std::tuple<std::vector<double>, var, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_1040;
+typedef std::tuple<std::vector<double>, var, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_1041;
+typedef std::tuple<std::vector<double>, var, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_1042;
+typedef std::tuple<std::vector<double>, var, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_1043;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, double, empty> type_v_1044;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_v_1045;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_1046;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, var, empty> type_v_1047;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<var>, empty> type_v_1048;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_1049;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_v_1050;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_v_1051;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_1052;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, var, empty> type_v_1053;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty> type_v_1054;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_1055;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_1056;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_1057;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_1058;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_1059;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_1060;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_1061;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, double, empty> type_v_1062;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<double>, empty> type_v_1063;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_1064;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, var, empty> type_v_1065;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<var>, empty> type_v_1066;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_1067;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, double, empty> type_v_1068;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty> type_v_1069;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_1070;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, var, empty> type_v_1071;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty> type_v_1072;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_1073;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_1074;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_1075;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_1076;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_1077;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_1078;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_1079;
+typedef std::tuple<std::vector<double>, std::vector<var>, int, double, double, empty> type_v_1080;
+typedef std::tuple<std::vector<double>, std::vector<var>, int, double, std::vector<double>, empty> type_v_1081;
+typedef std::tuple<std::vector<double>, std::vector<var>, int, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_1082;
+typedef std::tuple<std::vector<double>, std::vector<var>, int, double, var, empty> type_v_1083;
+typedef std::tuple<std::vector<double>, std::vector<var>, int, double, std::vector<var>, empty> type_v_1084;
+typedef std::tuple<std::vector<double>, std::vector<var>, int, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_1085;
+typedef std::tuple<std::vector<double>, std::vector<var>, int, std::vector<double>, double, empty> type_v_1086;
+typedef std::tuple<std::vector<double>, std::vector<var>, int, std::vector<double>, std::vector<double>, empty> type_v_1087;
+typedef std::tuple<std::vector<double>, std::vector<var>, int, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_1088;
+typedef std::tuple<std::vector<double>, std::vector<var>, int, std::vector<double>, var, empty> type_v_1089;
+typedef std::tuple<std::vector<double>, std::vector<var>, int, std::vector<double>, std::vector<var>, empty> type_v_1090;
+typedef std::tuple<std::vector<double>, std::vector<var>, int, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_1091;
+typedef std::tuple<std::vector<double>, std::vector<var>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_1092;
+typedef std::tuple<std::vector<double>, std::vector<var>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_1093;
+typedef std::tuple<std::vector<double>, std::vector<var>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_1094;
+typedef std::tuple<std::vector<double>, std::vector<var>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_1095;
+typedef std::tuple<std::vector<double>, std::vector<var>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_1096;
+typedef std::tuple<std::vector<double>, std::vector<var>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_1097;
+typedef std::tuple<std::vector<double>, std::vector<var>, int, var, double, empty> type_v_1098;
+typedef std::tuple<std::vector<double>, std::vector<var>, int, var, std::vector<double>, empty> type_v_1099;
+
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1000> AgradDistributionNormalSufficient_v_1000;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1001> AgradDistributionNormalSufficient_v_1001;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1002> AgradDistributionNormalSufficient_v_1002;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1003> AgradDistributionNormalSufficient_v_1003;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1004> AgradDistributionNormalSufficient_v_1004;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1005> AgradDistributionNormalSufficient_v_1005;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1006> AgradDistributionNormalSufficient_v_1006;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1007> AgradDistributionNormalSufficient_v_1007;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1008> AgradDistributionNormalSufficient_v_1008;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1009> AgradDistributionNormalSufficient_v_1009;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1010> AgradDistributionNormalSufficient_v_1010;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1011> AgradDistributionNormalSufficient_v_1011;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1012> AgradDistributionNormalSufficient_v_1012;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1013> AgradDistributionNormalSufficient_v_1013;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1014> AgradDistributionNormalSufficient_v_1014;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1015> AgradDistributionNormalSufficient_v_1015;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1016> AgradDistributionNormalSufficient_v_1016;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1017> AgradDistributionNormalSufficient_v_1017;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1018> AgradDistributionNormalSufficient_v_1018;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1019> AgradDistributionNormalSufficient_v_1019;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1020> AgradDistributionNormalSufficient_v_1020;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1021> AgradDistributionNormalSufficient_v_1021;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1022> AgradDistributionNormalSufficient_v_1022;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1023> AgradDistributionNormalSufficient_v_1023;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1024> AgradDistributionNormalSufficient_v_1024;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1025> AgradDistributionNormalSufficient_v_1025;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1026> AgradDistributionNormalSufficient_v_1026;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1027> AgradDistributionNormalSufficient_v_1027;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1028> AgradDistributionNormalSufficient_v_1028;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1029> AgradDistributionNormalSufficient_v_1029;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1030> AgradDistributionNormalSufficient_v_1030;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1031> AgradDistributionNormalSufficient_v_1031;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1032> AgradDistributionNormalSufficient_v_1032;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1033> AgradDistributionNormalSufficient_v_1033;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1034> AgradDistributionNormalSufficient_v_1034;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1035> AgradDistributionNormalSufficient_v_1035;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1036> AgradDistributionNormalSufficient_v_1036;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1037> AgradDistributionNormalSufficient_v_1037;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1038> AgradDistributionNormalSufficient_v_1038;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1039> AgradDistributionNormalSufficient_v_1039;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1040> AgradDistributionNormalSufficient_v_1040;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1041> AgradDistributionNormalSufficient_v_1041;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1042> AgradDistributionNormalSufficient_v_1042;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1043> AgradDistributionNormalSufficient_v_1043;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1044> AgradDistributionNormalSufficient_v_1044;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1045> AgradDistributionNormalSufficient_v_1045;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1046> AgradDistributionNormalSufficient_v_1046;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1047> AgradDistributionNormalSufficient_v_1047;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1048> AgradDistributionNormalSufficient_v_1048;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1049> AgradDistributionNormalSufficient_v_1049;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1050> AgradDistributionNormalSufficient_v_1050;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1051> AgradDistributionNormalSufficient_v_1051;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1052> AgradDistributionNormalSufficient_v_1052;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1053> AgradDistributionNormalSufficient_v_1053;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1054> AgradDistributionNormalSufficient_v_1054;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1055> AgradDistributionNormalSufficient_v_1055;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1056> AgradDistributionNormalSufficient_v_1056;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1057> AgradDistributionNormalSufficient_v_1057;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1058> AgradDistributionNormalSufficient_v_1058;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1059> AgradDistributionNormalSufficient_v_1059;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1060> AgradDistributionNormalSufficient_v_1060;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1061> AgradDistributionNormalSufficient_v_1061;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1062> AgradDistributionNormalSufficient_v_1062;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1063> AgradDistributionNormalSufficient_v_1063;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1064> AgradDistributionNormalSufficient_v_1064;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1065> AgradDistributionNormalSufficient_v_1065;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1066> AgradDistributionNormalSufficient_v_1066;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1067> AgradDistributionNormalSufficient_v_1067;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1068> AgradDistributionNormalSufficient_v_1068;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1069> AgradDistributionNormalSufficient_v_1069;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1070> AgradDistributionNormalSufficient_v_1070;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1071> AgradDistributionNormalSufficient_v_1071;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1072> AgradDistributionNormalSufficient_v_1072;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1073> AgradDistributionNormalSufficient_v_1073;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1074> AgradDistributionNormalSufficient_v_1074;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1075> AgradDistributionNormalSufficient_v_1075;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1076> AgradDistributionNormalSufficient_v_1076;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1077> AgradDistributionNormalSufficient_v_1077;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1078> AgradDistributionNormalSufficient_v_1078;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1079> AgradDistributionNormalSufficient_v_1079;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1080> AgradDistributionNormalSufficient_v_1080;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1081> AgradDistributionNormalSufficient_v_1081;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1082> AgradDistributionNormalSufficient_v_1082;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1083> AgradDistributionNormalSufficient_v_1083;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1084> AgradDistributionNormalSufficient_v_1084;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1085> AgradDistributionNormalSufficient_v_1085;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1086> AgradDistributionNormalSufficient_v_1086;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1087> AgradDistributionNormalSufficient_v_1087;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1088> AgradDistributionNormalSufficient_v_1088;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1089> AgradDistributionNormalSufficient_v_1089;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1090> AgradDistributionNormalSufficient_v_1090;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1091> AgradDistributionNormalSufficient_v_1091;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1092> AgradDistributionNormalSufficient_v_1092;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1093> AgradDistributionNormalSufficient_v_1093;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1094> AgradDistributionNormalSufficient_v_1094;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1095> AgradDistributionNormalSufficient_v_1095;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1096> AgradDistributionNormalSufficient_v_1096;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1097> AgradDistributionNormalSufficient_v_1097;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1098> AgradDistributionNormalSufficient_v_1098;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1099> AgradDistributionNormalSufficient_v_1099;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1000, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1000);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1001, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1001);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1002, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1002);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1003, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1003);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1004, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1004);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1005, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1005);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1006, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1006);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1007, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1007);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1008, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1008);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1009, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1009);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1010, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1010);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1011, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1011);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1012, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1012);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1013, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1013);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1014, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1014);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1015, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1015);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1016, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1016);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1017, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1017);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1018, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1018);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1019, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1019);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1020, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1020);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1021, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1021);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1022, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1022);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1023, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1023);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1024, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1024);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1025, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1025);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1026, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1026);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1027, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1027);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1028, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1028);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1029, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1029);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1030, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1030);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1031, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1031);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1032, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1032);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1033, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1033);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1034, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1034);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1035, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1035);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1036, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1036);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1037, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1037);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1038, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1038);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1039, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1039);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1040, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1040);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1041, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1041);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1042, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1042);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1043, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1043);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1044, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1044);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1045, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1045);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1046, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1046);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1047, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1047);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1048, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1048);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1049, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1049);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1050, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1050);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1051, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1051);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1052, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1052);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1053, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1053);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1054, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1054);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1055, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1055);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1056, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1056);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1057, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1057);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1058, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1058);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1059, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1059);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1060, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1060);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1061, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1061);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1062, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1062);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1063, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1063);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1064, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1064);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1065, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1065);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1066, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1066);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1067, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1067);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1068, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1068);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1069, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1069);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1070, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1070);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1071, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1071);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1072, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1072);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1073, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1073);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1074, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1074);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1075, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1075);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1076, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1076);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1077, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1077);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1078, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1078);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1079, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1079);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1080, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1080);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1081, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1081);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1082, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1082);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1083, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1083);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1084, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1084);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1085, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1085);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1086, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1086);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1087, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1087);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1088, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1088);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1089, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1089);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1090, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1090);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1091, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1091);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1092, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1092);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1093, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1093);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1094, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1094);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1095, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1095);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1096, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1096);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1097, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1097);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1098, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1098);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1099, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1099);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/normal_sufficient/normal_sufficient_test.hpp>
+
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_1100;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, var, empty> type_vv_1101;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<var>, empty> type_vv_1102;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_1103;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_vv_1104;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_vv_1105;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_1106;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, var, empty> type_vv_1107;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty> type_vv_1108;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_1109;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_vv_1110;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_vv_1111;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_1112;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_vv_1113;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_vv_1114;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_1115;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, double, empty> type_vv_1116;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<double>, empty> type_vv_1117;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_1118;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, var, empty> type_vv_1119;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<var>, empty> type_vv_1120;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_1121;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, double, empty> type_vv_1122;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty> type_vv_1123;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_1124;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, var, empty> type_vv_1125;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty> type_vv_1126;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_1127;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty> type_vv_1128;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty> type_vv_1129;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_1130;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty> type_vv_1131;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty> type_vv_1132;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_1133;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, int, double, var, empty> type_vv_1134;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, int, double, std::vector<var>, empty> type_vv_1135;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, int, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_1136;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, int, std::vector<double>, var, empty> type_vv_1137;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, int, std::vector<double>, std::vector<var>, empty> type_vv_1138;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, int, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_1139;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_vv_1140;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_vv_1141;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_1142;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, int, var, double, empty> type_vv_1143;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, int, var, std::vector<double>, empty> type_vv_1144;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, int, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_1145;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, int, var, var, empty> type_vv_1146;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, int, var, std::vector<var>, empty> type_vv_1147;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, int, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_1148;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, int, std::vector<var>, double, empty> type_vv_1149;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, int, std::vector<var>, std::vector<double>, empty> type_vv_1150;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, int, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_1151;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, int, std::vector<var>, var, empty> type_vv_1152;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, int, std::vector<var>, std::vector<var>, empty> type_vv_1153;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, int, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_1154;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty> type_vv_1155;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty> type_vv_1156;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_1157;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty> type_vv_1158;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty> type_vv_1159;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_1160;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<int>, double, var, empty> type_vv_1161;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<int>, double, std::vector<var>, empty> type_vv_1162;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<int>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_1163;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<int>, std::vector<double>, var, empty> type_vv_1164;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<int>, std::vector<double>, std::vector<var>, empty> type_vv_1165;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<int>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_1166;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_vv_1167;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_vv_1168;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_1169;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<int>, var, double, empty> type_vv_1170;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<int>, var, std::vector<double>, empty> type_vv_1171;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<int>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_1172;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<int>, var, var, empty> type_vv_1173;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<int>, var, std::vector<var>, empty> type_vv_1174;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<int>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_1175;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<int>, std::vector<var>, double, empty> type_vv_1176;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<int>, std::vector<var>, std::vector<double>, empty> type_vv_1177;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<int>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_1178;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<int>, std::vector<var>, var, empty> type_vv_1179;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<int>, std::vector<var>, std::vector<var>, empty> type_vv_1180;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<int>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_1181;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty> type_vv_1182;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty> type_vv_1183;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_1184;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty> type_vv_1185;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty> type_vv_1186;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_1187;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, var, empty> type_vv_1188;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<var>, empty> type_vv_1189;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_1190;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, var, empty> type_vv_1191;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty> type_vv_1192;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_1193;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_vv_1194;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_vv_1195;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_1196;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, double, empty> type_vv_1197;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<double>, empty> type_vv_1198;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_1199;
+
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1100> AgradDistributionNormalSufficient_vv_1100;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1101> AgradDistributionNormalSufficient_vv_1101;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1102> AgradDistributionNormalSufficient_vv_1102;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1103> AgradDistributionNormalSufficient_vv_1103;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1104> AgradDistributionNormalSufficient_vv_1104;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1105> AgradDistributionNormalSufficient_vv_1105;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1106> AgradDistributionNormalSufficient_vv_1106;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1107> AgradDistributionNormalSufficient_vv_1107;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1108> AgradDistributionNormalSufficient_vv_1108;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1109> AgradDistributionNormalSufficient_vv_1109;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1110> AgradDistributionNormalSufficient_vv_1110;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1111> AgradDistributionNormalSufficient_vv_1111;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1112> AgradDistributionNormalSufficient_vv_1112;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1113> AgradDistributionNormalSufficient_vv_1113;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1114> AgradDistributionNormalSufficient_vv_1114;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1115> AgradDistributionNormalSufficient_vv_1115;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1116> AgradDistributionNormalSufficient_vv_1116;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1117> AgradDistributionNormalSufficient_vv_1117;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1118> AgradDistributionNormalSufficient_vv_1118;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1119> AgradDistributionNormalSufficient_vv_1119;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1120> AgradDistributionNormalSufficient_vv_1120;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1121> AgradDistributionNormalSufficient_vv_1121;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1122> AgradDistributionNormalSufficient_vv_1122;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1123> AgradDistributionNormalSufficient_vv_1123;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1124> AgradDistributionNormalSufficient_vv_1124;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1125> AgradDistributionNormalSufficient_vv_1125;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1126> AgradDistributionNormalSufficient_vv_1126;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1127> AgradDistributionNormalSufficient_vv_1127;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1128> AgradDistributionNormalSufficient_vv_1128;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1129> AgradDistributionNormalSufficient_vv_1129;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1130> AgradDistributionNormalSufficient_vv_1130;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1131> AgradDistributionNormalSufficient_vv_1131;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1132> AgradDistributionNormalSufficient_vv_1132;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1133> AgradDistributionNormalSufficient_vv_1133;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1134> AgradDistributionNormalSufficient_vv_1134;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1135> AgradDistributionNormalSufficient_vv_1135;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1136> AgradDistributionNormalSufficient_vv_1136;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1137> AgradDistributionNormalSufficient_vv_1137;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1138> AgradDistributionNormalSufficient_vv_1138;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1139> AgradDistributionNormalSufficient_vv_1139;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1140> AgradDistributionNormalSufficient_vv_1140;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1141> AgradDistributionNormalSufficient_vv_1141;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1142> AgradDistributionNormalSufficient_vv_1142;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1143> AgradDistributionNormalSufficient_vv_1143;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1144> AgradDistributionNormalSufficient_vv_1144;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1145> AgradDistributionNormalSufficient_vv_1145;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1146> AgradDistributionNormalSufficient_vv_1146;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1147> AgradDistributionNormalSufficient_vv_1147;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1148> AgradDistributionNormalSufficient_vv_1148;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1149> AgradDistributionNormalSufficient_vv_1149;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1150> AgradDistributionNormalSufficient_vv_1150;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1151> AgradDistributionNormalSufficient_vv_1151;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1152> AgradDistributionNormalSufficient_vv_1152;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1153> AgradDistributionNormalSufficient_vv_1153;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1154> AgradDistributionNormalSufficient_vv_1154;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1155> AgradDistributionNormalSufficient_vv_1155;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1156> AgradDistributionNormalSufficient_vv_1156;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1157> AgradDistributionNormalSufficient_vv_1157;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1158> AgradDistributionNormalSufficient_vv_1158;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1159> AgradDistributionNormalSufficient_vv_1159;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1160> AgradDistributionNormalSufficient_vv_1160;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1161> AgradDistributionNormalSufficient_vv_1161;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1162> AgradDistributionNormalSufficient_vv_1162;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1163> AgradDistributionNormalSufficient_vv_1163;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1164> AgradDistributionNormalSufficient_vv_1164;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1165> AgradDistributionNormalSufficient_vv_1165;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1166> AgradDistributionNormalSufficient_vv_1166;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1167> AgradDistributionNormalSufficient_vv_1167;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1168> AgradDistributionNormalSufficient_vv_1168;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1169> AgradDistributionNormalSufficient_vv_1169;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1170> AgradDistributionNormalSufficient_vv_1170;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1171> AgradDistributionNormalSufficient_vv_1171;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1172> AgradDistributionNormalSufficient_vv_1172;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1173> AgradDistributionNormalSufficient_vv_1173;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1174> AgradDistributionNormalSufficient_vv_1174;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1175> AgradDistributionNormalSufficient_vv_1175;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1176> AgradDistributionNormalSufficient_vv_1176;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1177> AgradDistributionNormalSufficient_vv_1177;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1178> AgradDistributionNormalSufficient_vv_1178;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1179> AgradDistributionNormalSufficient_vv_1179;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1180> AgradDistributionNormalSufficient_vv_1180;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1181> AgradDistributionNormalSufficient_vv_1181;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1182> AgradDistributionNormalSufficient_vv_1182;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1183> AgradDistributionNormalSufficient_vv_1183;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1184> AgradDistributionNormalSufficient_vv_1184;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1185> AgradDistributionNormalSufficient_vv_1185;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1186> AgradDistributionNormalSufficient_vv_1186;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1187> AgradDistributionNormalSufficient_vv_1187;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1188> AgradDistributionNormalSufficient_vv_1188;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1189> AgradDistributionNormalSufficient_vv_1189;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1190> AgradDistributionNormalSufficient_vv_1190;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1191> AgradDistributionNormalSufficient_vv_1191;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1192> AgradDistributionNormalSufficient_vv_1192;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1193> AgradDistributionNormalSufficient_vv_1193;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1194> AgradDistributionNormalSufficient_vv_1194;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1195> AgradDistributionNormalSufficient_vv_1195;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1196> AgradDistributionNormalSufficient_vv_1196;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1197> AgradDistributionNormalSufficient_vv_1197;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1198> AgradDistributionNormalSufficient_vv_1198;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1199> AgradDistributionNormalSufficient_vv_1199;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1100, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1101, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1102, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1103, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1104, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1105, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1106, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1107, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1108, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1109, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1110, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1111, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1112, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1113, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1114, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1115, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1116, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1117, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1118, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1119, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1120, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1121, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1122, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1123, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1124, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1125, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1126, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1127, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1128, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1129, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1130, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1131, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1132, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1133, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1134, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1135, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1136, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1137, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1138, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1139, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1140, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1141, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1142, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1143, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1144, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1145, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1146, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1147, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1148, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1149, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1150, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1151, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1152, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1153, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1154, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1155, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1156, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1157, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1158, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1159, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1160, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1161, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1162, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1163, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1164, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1165, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1166, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1167, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1168, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1169, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1170, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1171, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1172, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1173, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1174, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1175, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1176, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1177, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1178, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1179, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1180, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1181, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1182, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1183, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1184, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1185, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1186, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1187, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1188, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1188);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1189, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1189);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1190, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1190);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1191, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1191);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1192, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1192);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1193, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1193);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1194, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1194);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1195, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1195);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1196, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1196);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1197, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1197);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1198, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1198);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1199, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1199);
+
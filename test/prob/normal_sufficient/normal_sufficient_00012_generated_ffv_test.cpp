@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/normal_sufficient/normal_sufficient_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_1200;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_1201;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1202;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_1203;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_1204;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1205;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_1206;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1207;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1208;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_1209;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_1210;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1211;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_1212;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1213;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1214;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, int, double, fvar<fvar<var> >, empty> type_ffv_1215;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, int, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_1216;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, int, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1217;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, int, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_1218;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, int, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1219;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, int, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1220;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_1221;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1222;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1223;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, int, fvar<fvar<var> >, double, empty> type_ffv_1224;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, int, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_1225;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, int, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1226;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, int, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_1227;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, int, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_1228;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, int, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1229;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, int, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_1230;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, int, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_1231;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1232;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, int, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_1233;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, int, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1234;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1235;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_1236;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_1237;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1238;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_1239;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1240;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1241;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<int>, double, fvar<fvar<var> >, empty> type_ffv_1242;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<int>, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_1243;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<int>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1244;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<int>, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_1245;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<int>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1246;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<int>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1247;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_1248;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1249;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1250;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<int>, fvar<fvar<var> >, double, empty> type_ffv_1251;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<int>, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_1252;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1253;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<int>, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_1254;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<int>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_1255;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1256;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<int>, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_1257;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_1258;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1259;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<int>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_1260;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1261;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1262;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_1263;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_1264;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1265;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_1266;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1267;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1268;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty> type_ffv_1269;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_1270;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1271;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_1272;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1273;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1274;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_1275;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1276;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1277;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty> type_ffv_1278;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_1279;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1280;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_1281;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_1282;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1283;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_1284;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_1285;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1286;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_1287;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1288;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1289;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_1290;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_1291;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1292;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_1293;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1294;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1295;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, double, fvar<fvar<var> >, empty> type_ffv_1296;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_1297;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1298;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_1299;
+
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1200> AgradDistributionNormalSufficient_ffv_1200;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1201> AgradDistributionNormalSufficient_ffv_1201;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1202> AgradDistributionNormalSufficient_ffv_1202;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1203> AgradDistributionNormalSufficient_ffv_1203;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1204> AgradDistributionNormalSufficient_ffv_1204;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1205> AgradDistributionNormalSufficient_ffv_1205;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1206> AgradDistributionNormalSufficient_ffv_1206;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1207> AgradDistributionNormalSufficient_ffv_1207;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1208> AgradDistributionNormalSufficient_ffv_1208;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1209> AgradDistributionNormalSufficient_ffv_1209;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1210> AgradDistributionNormalSufficient_ffv_1210;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1211> AgradDistributionNormalSufficient_ffv_1211;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1212> AgradDistributionNormalSufficient_ffv_1212;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1213> AgradDistributionNormalSufficient_ffv_1213;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1214> AgradDistributionNormalSufficient_ffv_1214;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1215> AgradDistributionNormalSufficient_ffv_1215;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1216> AgradDistributionNormalSufficient_ffv_1216;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1217> AgradDistributionNormalSufficient_ffv_1217;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1218> AgradDistributionNormalSufficient_ffv_1218;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1219> AgradDistributionNormalSufficient_ffv_1219;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1220> AgradDistributionNormalSufficient_ffv_1220;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1221> AgradDistributionNormalSufficient_ffv_1221;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1222> AgradDistributionNormalSufficient_ffv_1222;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1223> AgradDistributionNormalSufficient_ffv_1223;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1224> AgradDistributionNormalSufficient_ffv_1224;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1225> AgradDistributionNormalSufficient_ffv_1225;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1226> AgradDistributionNormalSufficient_ffv_1226;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1227> AgradDistributionNormalSufficient_ffv_1227;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1228> AgradDistributionNormalSufficient_ffv_1228;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1229> AgradDistributionNormalSufficient_ffv_1229;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1230> AgradDistributionNormalSufficient_ffv_1230;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1231> AgradDistributionNormalSufficient_ffv_1231;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1232> AgradDistributionNormalSufficient_ffv_1232;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1233> AgradDistributionNormalSufficient_ffv_1233;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1234> AgradDistributionNormalSufficient_ffv_1234;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1235> AgradDistributionNormalSufficient_ffv_1235;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1236> AgradDistributionNormalSufficient_ffv_1236;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1237> AgradDistributionNormalSufficient_ffv_1237;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1238> AgradDistributionNormalSufficient_ffv_1238;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1239> AgradDistributionNormalSufficient_ffv_1239;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1240> AgradDistributionNormalSufficient_ffv_1240;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1241> AgradDistributionNormalSufficient_ffv_1241;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1242> AgradDistributionNormalSufficient_ffv_1242;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1243> AgradDistributionNormalSufficient_ffv_1243;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1244> AgradDistributionNormalSufficient_ffv_1244;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1245> AgradDistributionNormalSufficient_ffv_1245;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1246> AgradDistributionNormalSufficient_ffv_1246;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1247> AgradDistributionNormalSufficient_ffv_1247;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1248> AgradDistributionNormalSufficient_ffv_1248;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1249> AgradDistributionNormalSufficient_ffv_1249;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1250> AgradDistributionNormalSufficient_ffv_1250;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1251> AgradDistributionNormalSufficient_ffv_1251;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1252> AgradDistributionNormalSufficient_ffv_1252;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1253> AgradDistributionNormalSufficient_ffv_1253;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1254> AgradDistributionNormalSufficient_ffv_1254;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1255> AgradDistributionNormalSufficient_ffv_1255;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1256> AgradDistributionNormalSufficient_ffv_1256;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1257> AgradDistributionNormalSufficient_ffv_1257;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1258> AgradDistributionNormalSufficient_ffv_1258;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1259> AgradDistributionNormalSufficient_ffv_1259;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1260> AgradDistributionNormalSufficient_ffv_1260;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1261> AgradDistributionNormalSufficient_ffv_1261;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1262> AgradDistributionNormalSufficient_ffv_1262;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1263> AgradDistributionNormalSufficient_ffv_1263;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1264> AgradDistributionNormalSufficient_ffv_1264;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1265> AgradDistributionNormalSufficient_ffv_1265;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1266> AgradDistributionNormalSufficient_ffv_1266;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1267> AgradDistributionNormalSufficient_ffv_1267;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1268> AgradDistributionNormalSufficient_ffv_1268;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1269> AgradDistributionNormalSufficient_ffv_1269;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1270> AgradDistributionNormalSufficient_ffv_1270;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1271> AgradDistributionNormalSufficient_ffv_1271;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1272> AgradDistributionNormalSufficient_ffv_1272;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1273> AgradDistributionNormalSufficient_ffv_1273;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1274> AgradDistributionNormalSufficient_ffv_1274;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1275> AgradDistributionNormalSufficient_ffv_1275;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1276> AgradDistributionNormalSufficient_ffv_1276;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1277> AgradDistributionNormalSufficient_ffv_1277;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1278> AgradDistributionNormalSufficient_ffv_1278;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1279> AgradDistributionNormalSufficient_ffv_1279;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1280> AgradDistributionNormalSufficient_ffv_1280;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1281> AgradDistributionNormalSufficient_ffv_1281;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1282> AgradDistributionNormalSufficient_ffv_1282;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1283> AgradDistributionNormalSufficient_ffv_1283;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1284> AgradDistributionNormalSufficient_ffv_1284;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1285> AgradDistributionNormalSufficient_ffv_1285;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1286> AgradDistributionNormalSufficient_ffv_1286;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1287> AgradDistributionNormalSufficient_ffv_1287;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1288> AgradDistributionNormalSufficient_ffv_1288;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1289> AgradDistributionNormalSufficient_ffv_1289;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1290> AgradDistributionNormalSufficient_ffv_1290;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1291> AgradDistributionNormalSufficient_ffv_1291;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1292> AgradDistributionNormalSufficient_ffv_1292;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1293> AgradDistributionNormalSufficient_ffv_1293;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1294> AgradDistributionNormalSufficient_ffv_1294;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1295> AgradDistributionNormalSufficient_ffv_1295;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1296> AgradDistributionNormalSufficient_ffv_1296;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1297> AgradDistributionNormalSufficient_ffv_1297;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1298> AgradDistributionNormalSufficient_ffv_1298;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1299> AgradDistributionNormalSufficient_ffv_1299;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1200, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1200);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1201, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1201);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1202, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1202);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1203, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1203);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1204, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1204);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1205, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1205);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1206, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1206);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1207, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1207);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1208, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1208);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1209, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1209);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1210, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1210);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1211, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1211);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1212, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1212);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1213, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1213);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1214, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1214);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1215, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1215);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1216, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1216);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1217, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1217);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1218, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1218);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1219, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1219);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1220, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1220);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1221, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1221);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1222, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1222);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1223, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1223);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1224, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1224);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1225, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1225);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1226, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1226);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1227, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1227);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1228, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1228);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1229, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1229);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1230, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1230);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1231, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1231);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1232, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1232);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1233, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1233);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1234, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1234);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1235, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1235);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1236, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1236);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1237, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1237);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1238, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1238);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1239, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1239);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1240, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1240);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1241, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1241);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1242, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1242);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1243, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1243);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1244, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1244);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1245, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1245);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1246, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1246);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1247, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1247);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1248, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1248);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1249, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1249);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1250, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1250);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1251, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1251);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1252, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1252);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1253, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1253);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1254, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1254);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1255, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1255);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1256, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1256);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1257, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1257);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1258, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1258);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1259, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1259);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1260, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1260);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1261, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1261);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1262, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1262);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1263, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1263);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1264, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1264);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1265, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1265);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1266, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1266);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1267, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1267);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1268, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1268);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1269, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1269);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1270, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1270);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1271, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1271);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1272, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1272);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1273, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1273);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1274, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1274);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1275, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1275);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1276, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1276);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1277, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1277);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1278, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1278);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1279, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1279);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1280, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1280);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1281, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1281);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1282, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1282);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1283, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1283);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1284, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1284);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1285, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1285);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1286, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1286);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1287, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1287);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1288, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1288);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1289, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1289);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1290, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1290);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1291, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1291);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1292, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1292);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1293, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1293);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1294, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1294);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1295, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1295);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1296, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1296);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1297, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1297);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1298, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1298);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1299, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1299);
+
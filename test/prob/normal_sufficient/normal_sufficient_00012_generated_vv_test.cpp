@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/normal_sufficient/normal_sufficient_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, var, empty> type_vv_1200;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<var>, empty> type_vv_1201;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_1202;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, double, empty> type_vv_1203;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty> type_vv_1204;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_1205;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, var, empty> type_vv_1206;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty> type_vv_1207;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_1208;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty> type_vv_1209;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty> type_vv_1210;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_1211;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty> type_vv_1212;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty> type_vv_1213;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_1214;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, int, double, var, empty> type_vv_1215;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, int, double, std::vector<var>, empty> type_vv_1216;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, int, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_1217;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, int, std::vector<double>, var, empty> type_vv_1218;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, int, std::vector<double>, std::vector<var>, empty> type_vv_1219;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, int, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_1220;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_vv_1221;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_vv_1222;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_1223;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, int, var, double, empty> type_vv_1224;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, int, var, std::vector<double>, empty> type_vv_1225;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, int, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_1226;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, int, var, var, empty> type_vv_1227;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, int, var, std::vector<var>, empty> type_vv_1228;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, int, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_1229;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, int, std::vector<var>, double, empty> type_vv_1230;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, int, std::vector<var>, std::vector<double>, empty> type_vv_1231;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, int, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_1232;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, int, std::vector<var>, var, empty> type_vv_1233;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, int, std::vector<var>, std::vector<var>, empty> type_vv_1234;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, int, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_1235;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty> type_vv_1236;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty> type_vv_1237;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_1238;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty> type_vv_1239;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty> type_vv_1240;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_1241;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<int>, double, var, empty> type_vv_1242;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<int>, double, std::vector<var>, empty> type_vv_1243;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<int>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_1244;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<int>, std::vector<double>, var, empty> type_vv_1245;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<int>, std::vector<double>, std::vector<var>, empty> type_vv_1246;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<int>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_1247;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_vv_1248;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_vv_1249;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_1250;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<int>, var, double, empty> type_vv_1251;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<int>, var, std::vector<double>, empty> type_vv_1252;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<int>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_1253;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<int>, var, var, empty> type_vv_1254;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<int>, var, std::vector<var>, empty> type_vv_1255;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<int>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_1256;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<int>, std::vector<var>, double, empty> type_vv_1257;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<int>, std::vector<var>, std::vector<double>, empty> type_vv_1258;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<int>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_1259;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<int>, std::vector<var>, var, empty> type_vv_1260;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<int>, std::vector<var>, std::vector<var>, empty> type_vv_1261;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<int>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_1262;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty> type_vv_1263;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty> type_vv_1264;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_1265;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty> type_vv_1266;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty> type_vv_1267;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_1268;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, var, empty> type_vv_1269;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<var>, empty> type_vv_1270;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_1271;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, var, empty> type_vv_1272;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty> type_vv_1273;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_1274;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_vv_1275;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_vv_1276;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_1277;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, double, empty> type_vv_1278;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<double>, empty> type_vv_1279;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_1280;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, var, empty> type_vv_1281;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<var>, empty> type_vv_1282;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_1283;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, double, empty> type_vv_1284;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty> type_vv_1285;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_1286;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, var, empty> type_vv_1287;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty> type_vv_1288;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_1289;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty> type_vv_1290;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty> type_vv_1291;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_1292;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty> type_vv_1293;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty> type_vv_1294;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_1295;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, double, var, empty> type_vv_1296;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, double, std::vector<var>, empty> type_vv_1297;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_1298;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<double>, var, empty> type_vv_1299;
+
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1200> AgradDistributionNormalSufficient_vv_1200;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1201> AgradDistributionNormalSufficient_vv_1201;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1202> AgradDistributionNormalSufficient_vv_1202;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1203> AgradDistributionNormalSufficient_vv_1203;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1204> AgradDistributionNormalSufficient_vv_1204;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1205> AgradDistributionNormalSufficient_vv_1205;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1206> AgradDistributionNormalSufficient_vv_1206;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1207> AgradDistributionNormalSufficient_vv_1207;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1208> AgradDistributionNormalSufficient_vv_1208;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1209> AgradDistributionNormalSufficient_vv_1209;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1210> AgradDistributionNormalSufficient_vv_1210;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1211> AgradDistributionNormalSufficient_vv_1211;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1212> AgradDistributionNormalSufficient_vv_1212;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1213> AgradDistributionNormalSufficient_vv_1213;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1214> AgradDistributionNormalSufficient_vv_1214;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1215> AgradDistributionNormalSufficient_vv_1215;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1216> AgradDistributionNormalSufficient_vv_1216;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1217> AgradDistributionNormalSufficient_vv_1217;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1218> AgradDistributionNormalSufficient_vv_1218;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1219> AgradDistributionNormalSufficient_vv_1219;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1220> AgradDistributionNormalSufficient_vv_1220;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1221> AgradDistributionNormalSufficient_vv_1221;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1222> AgradDistributionNormalSufficient_vv_1222;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1223> AgradDistributionNormalSufficient_vv_1223;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1224> AgradDistributionNormalSufficient_vv_1224;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1225> AgradDistributionNormalSufficient_vv_1225;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1226> AgradDistributionNormalSufficient_vv_1226;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1227> AgradDistributionNormalSufficient_vv_1227;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1228> AgradDistributionNormalSufficient_vv_1228;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1229> AgradDistributionNormalSufficient_vv_1229;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1230> AgradDistributionNormalSufficient_vv_1230;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1231> AgradDistributionNormalSufficient_vv_1231;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1232> AgradDistributionNormalSufficient_vv_1232;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1233> AgradDistributionNormalSufficient_vv_1233;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1234> AgradDistributionNormalSufficient_vv_1234;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1235> AgradDistributionNormalSufficient_vv_1235;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1236> AgradDistributionNormalSufficient_vv_1236;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1237> AgradDistributionNormalSufficient_vv_1237;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1238> AgradDistributionNormalSufficient_vv_1238;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1239> AgradDistributionNormalSufficient_vv_1239;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1240> AgradDistributionNormalSufficient_vv_1240;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1241> AgradDistributionNormalSufficient_vv_1241;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1242> AgradDistributionNormalSufficient_vv_1242;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1243> AgradDistributionNormalSufficient_vv_1243;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1244> AgradDistributionNormalSufficient_vv_1244;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1245> AgradDistributionNormalSufficient_vv_1245;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1246> AgradDistributionNormalSufficient_vv_1246;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1247> AgradDistributionNormalSufficient_vv_1247;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1248> AgradDistributionNormalSufficient_vv_1248;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1249> AgradDistributionNormalSufficient_vv_1249;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1250> AgradDistributionNormalSufficient_vv_1250;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1251> AgradDistributionNormalSufficient_vv_1251;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1252> AgradDistributionNormalSufficient_vv_1252;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1253> AgradDistributionNormalSufficient_vv_1253;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1254> AgradDistributionNormalSufficient_vv_1254;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1255> AgradDistributionNormalSufficient_vv_1255;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1256> AgradDistributionNormalSufficient_vv_1256;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1257> AgradDistributionNormalSufficient_vv_1257;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1258> AgradDistributionNormalSufficient_vv_1258;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1259> AgradDistributionNormalSufficient_vv_1259;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1260> AgradDistributionNormalSufficient_vv_1260;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1261> AgradDistributionNormalSufficient_vv_1261;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1262> AgradDistributionNormalSufficient_vv_1262;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1263> AgradDistributionNormalSufficient_vv_1263;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1264> AgradDistributionNormalSufficient_vv_1264;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1265> AgradDistributionNormalSufficient_vv_1265;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1266> AgradDistributionNormalSufficient_vv_1266;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1267> AgradDistributionNormalSufficient_vv_1267;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1268> AgradDistributionNormalSufficient_vv_1268;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1269> AgradDistributionNormalSufficient_vv_1269;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1270> AgradDistributionNormalSufficient_vv_1270;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1271> AgradDistributionNormalSufficient_vv_1271;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1272> AgradDistributionNormalSufficient_vv_1272;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1273> AgradDistributionNormalSufficient_vv_1273;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1274> AgradDistributionNormalSufficient_vv_1274;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1275> AgradDistributionNormalSufficient_vv_1275;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1276> AgradDistributionNormalSufficient_vv_1276;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1277> AgradDistributionNormalSufficient_vv_1277;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1278> AgradDistributionNormalSufficient_vv_1278;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1279> AgradDistributionNormalSufficient_vv_1279;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1280> AgradDistributionNormalSufficient_vv_1280;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1281> AgradDistributionNormalSufficient_vv_1281;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1282> AgradDistributionNormalSufficient_vv_1282;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1283> AgradDistributionNormalSufficient_vv_1283;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1284> AgradDistributionNormalSufficient_vv_1284;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1285> AgradDistributionNormalSufficient_vv_1285;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1286> AgradDistributionNormalSufficient_vv_1286;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1287> AgradDistributionNormalSufficient_vv_1287;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1288> AgradDistributionNormalSufficient_vv_1288;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1289> AgradDistributionNormalSufficient_vv_1289;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1290> AgradDistributionNormalSufficient_vv_1290;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1291> AgradDistributionNormalSufficient_vv_1291;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1292> AgradDistributionNormalSufficient_vv_1292;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1293> AgradDistributionNormalSufficient_vv_1293;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1294> AgradDistributionNormalSufficient_vv_1294;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1295> AgradDistributionNormalSufficient_vv_1295;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1296> AgradDistributionNormalSufficient_vv_1296;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1297> AgradDistributionNormalSufficient_vv_1297;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1298> AgradDistributionNormalSufficient_vv_1298;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1299> AgradDistributionNormalSufficient_vv_1299;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1200, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1200);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1201, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1201);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1202, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1202);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1203, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1203);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1204, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1204);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1205, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1205);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1206, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1206);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1207, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1207);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1208, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1208);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1209, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1209);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1210, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1210);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1211, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1211);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1212, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1212);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1213, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1213);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1214, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1214);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1215, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1215);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1216, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1216);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1217, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1217);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1218, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1218);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1219, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1219);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1220, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1220);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1221, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1221);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1222, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1222);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1223, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1223);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1224, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1224);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1225, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1225);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1226, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1226);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1227, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1227);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1228, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1228);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1229, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1229);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1230, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1230);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1231, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1231);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1232, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1232);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1233, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1233);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1234, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1234);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1235, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1235);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1236, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1236);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1237, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1237);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1238, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1238);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1239, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1239);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1240, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1240);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1241, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1241);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1242, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1242);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1243, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1243);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1244, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1244);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1245, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1245);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1246, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1246);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1247, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1247);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1248, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1248);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1249, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1249);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1250, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1250);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1251, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1251);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1252, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1252);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1253, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1253);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1254, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1254);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1255, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1255);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1256, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1256);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1257, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1257);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1258, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1258);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1259, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1259);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1260, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1260);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1261, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1261);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1262, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1262);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1263, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1263);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1264, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1264);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1265, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1265);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1266, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1266);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1267, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1267);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1268, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1268);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1269, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1269);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1270, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1270);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1271, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1271);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1272, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1272);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1273, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1273);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1274, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1274);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1275, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1275);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1276, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1276);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1277, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1277);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1278, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1278);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1279, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1279);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1280, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1280);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1281, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1281);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1282, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1282);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1283, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1283);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1284, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1284);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1285, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1285);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1286, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1286);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1287, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1287);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1288, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1288);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1289, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1289);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1290, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1290);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1291, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1291);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1292, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1292);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1293, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1293);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1294, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1294);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1295, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1295);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1296, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1296);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1297, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1297);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1298, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1298);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1299, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1299);
+
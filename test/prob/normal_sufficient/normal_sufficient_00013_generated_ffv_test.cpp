@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/normal_sufficient/normal_sufficient_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1300;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1301;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_1302;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1303;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1304;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, fvar<fvar<var> >, double, empty> type_ffv_1305;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_1306;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1307;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_1308;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_1309;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1310;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_1311;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_1312;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1313;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_1314;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1315;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1316;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_1317;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_1318;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1319;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_1320;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1321;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1322;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, double, fvar<fvar<var> >, empty> type_ffv_1323;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_1324;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1325;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_1326;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1327;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1328;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_1329;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1330;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1331;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, fvar<fvar<var> >, double, empty> type_ffv_1332;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_1333;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1334;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_1335;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_1336;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1337;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_1338;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_1339;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1340;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_1341;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1342;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1343;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_1344;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_1345;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1346;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_1347;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1348;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1349;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty> type_ffv_1350;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_1351;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1352;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_1353;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1354;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1355;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_1356;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1357;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1358;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty> type_ffv_1359;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_1360;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1361;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_1362;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_1363;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1364;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_1365;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_1366;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1367;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_1368;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1369;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1370;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_1371;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_1372;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1373;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_1374;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1375;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1376;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, int, double, double, empty> type_ffv_1377;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, int, double, std::vector<double>, empty> type_ffv_1378;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, int, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1379;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, int, double, fvar<fvar<var> >, empty> type_ffv_1380;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, int, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_1381;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, int, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1382;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, int, std::vector<double>, double, empty> type_ffv_1383;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, int, std::vector<double>, std::vector<double>, empty> type_ffv_1384;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, int, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1385;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, int, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_1386;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, int, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1387;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, int, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1388;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffv_1389;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_1390;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1391;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_1392;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1393;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1394;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, int, fvar<fvar<var> >, double, empty> type_ffv_1395;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, int, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_1396;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, int, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1397;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, int, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_1398;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, int, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_1399;
+
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1300> AgradDistributionNormalSufficient_ffv_1300;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1301> AgradDistributionNormalSufficient_ffv_1301;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1302> AgradDistributionNormalSufficient_ffv_1302;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1303> AgradDistributionNormalSufficient_ffv_1303;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1304> AgradDistributionNormalSufficient_ffv_1304;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1305> AgradDistributionNormalSufficient_ffv_1305;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1306> AgradDistributionNormalSufficient_ffv_1306;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1307> AgradDistributionNormalSufficient_ffv_1307;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1308> AgradDistributionNormalSufficient_ffv_1308;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1309> AgradDistributionNormalSufficient_ffv_1309;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1310> AgradDistributionNormalSufficient_ffv_1310;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1311> AgradDistributionNormalSufficient_ffv_1311;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1312> AgradDistributionNormalSufficient_ffv_1312;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1313> AgradDistributionNormalSufficient_ffv_1313;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1314> AgradDistributionNormalSufficient_ffv_1314;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1315> AgradDistributionNormalSufficient_ffv_1315;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1316> AgradDistributionNormalSufficient_ffv_1316;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1317> AgradDistributionNormalSufficient_ffv_1317;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1318> AgradDistributionNormalSufficient_ffv_1318;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1319> AgradDistributionNormalSufficient_ffv_1319;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1320> AgradDistributionNormalSufficient_ffv_1320;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1321> AgradDistributionNormalSufficient_ffv_1321;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1322> AgradDistributionNormalSufficient_ffv_1322;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1323> AgradDistributionNormalSufficient_ffv_1323;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1324> AgradDistributionNormalSufficient_ffv_1324;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1325> AgradDistributionNormalSufficient_ffv_1325;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1326> AgradDistributionNormalSufficient_ffv_1326;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1327> AgradDistributionNormalSufficient_ffv_1327;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1328> AgradDistributionNormalSufficient_ffv_1328;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1329> AgradDistributionNormalSufficient_ffv_1329;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1330> AgradDistributionNormalSufficient_ffv_1330;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1331> AgradDistributionNormalSufficient_ffv_1331;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1332> AgradDistributionNormalSufficient_ffv_1332;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1333> AgradDistributionNormalSufficient_ffv_1333;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1334> AgradDistributionNormalSufficient_ffv_1334;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1335> AgradDistributionNormalSufficient_ffv_1335;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1336> AgradDistributionNormalSufficient_ffv_1336;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1337> AgradDistributionNormalSufficient_ffv_1337;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1338> AgradDistributionNormalSufficient_ffv_1338;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1339> AgradDistributionNormalSufficient_ffv_1339;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1340> AgradDistributionNormalSufficient_ffv_1340;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1341> AgradDistributionNormalSufficient_ffv_1341;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1342> AgradDistributionNormalSufficient_ffv_1342;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1343> AgradDistributionNormalSufficient_ffv_1343;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1344> AgradDistributionNormalSufficient_ffv_1344;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1345> AgradDistributionNormalSufficient_ffv_1345;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1346> AgradDistributionNormalSufficient_ffv_1346;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1347> AgradDistributionNormalSufficient_ffv_1347;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1348> AgradDistributionNormalSufficient_ffv_1348;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1349> AgradDistributionNormalSufficient_ffv_1349;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1350> AgradDistributionNormalSufficient_ffv_1350;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1351> AgradDistributionNormalSufficient_ffv_1351;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1352> AgradDistributionNormalSufficient_ffv_1352;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1353> AgradDistributionNormalSufficient_ffv_1353;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1354> AgradDistributionNormalSufficient_ffv_1354;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1355> AgradDistributionNormalSufficient_ffv_1355;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1356> AgradDistributionNormalSufficient_ffv_1356;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1357> AgradDistributionNormalSufficient_ffv_1357;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1358> AgradDistributionNormalSufficient_ffv_1358;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1359> AgradDistributionNormalSufficient_ffv_1359;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1360> AgradDistributionNormalSufficient_ffv_1360;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1361> AgradDistributionNormalSufficient_ffv_1361;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1362> AgradDistributionNormalSufficient_ffv_1362;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1363> AgradDistributionNormalSufficient_ffv_1363;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1364> AgradDistributionNormalSufficient_ffv_1364;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1365> AgradDistributionNormalSufficient_ffv_1365;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1366> AgradDistributionNormalSufficient_ffv_1366;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1367> AgradDistributionNormalSufficient_ffv_1367;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1368> AgradDistributionNormalSufficient_ffv_1368;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1369> AgradDistributionNormalSufficient_ffv_1369;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1370> AgradDistributionNormalSufficient_ffv_1370;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1371> AgradDistributionNormalSufficient_ffv_1371;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1372> AgradDistributionNormalSufficient_ffv_1372;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1373> AgradDistributionNormalSufficient_ffv_1373;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1374> AgradDistributionNormalSufficient_ffv_1374;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1375> AgradDistributionNormalSufficient_ffv_1375;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1376> AgradDistributionNormalSufficient_ffv_1376;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1377> AgradDistributionNormalSufficient_ffv_1377;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1378> AgradDistributionNormalSufficient_ffv_1378;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1379> AgradDistributionNormalSufficient_ffv_1379;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1380> AgradDistributionNormalSufficient_ffv_1380;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1381> AgradDistributionNormalSufficient_ffv_1381;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1382> AgradDistributionNormalSufficient_ffv_1382;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1383> AgradDistributionNormalSufficient_ffv_1383;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1384> AgradDistributionNormalSufficient_ffv_1384;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1385> AgradDistributionNormalSufficient_ffv_1385;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1386> AgradDistributionNormalSufficient_ffv_1386;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1387> AgradDistributionNormalSufficient_ffv_1387;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1388> AgradDistributionNormalSufficient_ffv_1388;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1389> AgradDistributionNormalSufficient_ffv_1389;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1390> AgradDistributionNormalSufficient_ffv_1390;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1391> AgradDistributionNormalSufficient_ffv_1391;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1392> AgradDistributionNormalSufficient_ffv_1392;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1393> AgradDistributionNormalSufficient_ffv_1393;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1394> AgradDistributionNormalSufficient_ffv_1394;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1395> AgradDistributionNormalSufficient_ffv_1395;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1396> AgradDistributionNormalSufficient_ffv_1396;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1397> AgradDistributionNormalSufficient_ffv_1397;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1398> AgradDistributionNormalSufficient_ffv_1398;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1399> AgradDistributionNormalSufficient_ffv_1399;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1300, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1300);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1301, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1301);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1302, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1302);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1303, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1303);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1304, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1304);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1305, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1305);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1306, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1306);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1307, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1307);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1308, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1308);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1309, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1309);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1310, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1310);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1311, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1311);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1312, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1312);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1313, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1313);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1314, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1314);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1315, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1315);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1316, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1316);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1317, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1317);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1318, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1318);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1319, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1319);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1320, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1320);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1321, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1321);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1322, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1322);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1323, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1323);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1324, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1324);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1325, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1325);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1326, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1326);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1327, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1327);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1328, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1328);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1329, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1329);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1330, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1330);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1331, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1331);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1332, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1332);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1333, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1333);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1334, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1334);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1335, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1335);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1336, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1336);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1337, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1337);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1338, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1338);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1339, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1339);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1340, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1340);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1341, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1341);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1342, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1342);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1343, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1343);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1344, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1344);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1345, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1345);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1346, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1346);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1347, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1347);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1348, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1348);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1349, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1349);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1350, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1350);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1351, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1351);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1352, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1352);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1353, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1353);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1354, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1354);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1355, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1355);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1356, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1356);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1357, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1357);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1358, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1358);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1359, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1359);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1360, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1360);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1361, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1361);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1362, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1362);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1363, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1363);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1364, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1364);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1365, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1365);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1366, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1366);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1367, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1367);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1368, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1368);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1369, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1369);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1370, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1370);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1371, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1371);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1372, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1372);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1373, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1373);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1374, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1374);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1375, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1375);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1376, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1376);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1377, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1377);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1378, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1378);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1379, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1379);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1380, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1380);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1381, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1381);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1382, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1382);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1383, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1383);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1384, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1384);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1385, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1385);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1386, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1386);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1387, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1387);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1388, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1388);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1389, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1389);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1390, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1390);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1391, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1391);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1392, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1392);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1393, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1393);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1394, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1394);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1395, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1395);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1396, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1396);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1397, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1397);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1398, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1398);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1399, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1399);
+
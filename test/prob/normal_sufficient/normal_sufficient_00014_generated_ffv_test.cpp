@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/normal_sufficient/normal_sufficient_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, int, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1400;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, int, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_1401;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, int, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_1402;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1403;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, int, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_1404;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, int, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1405;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1406;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_1407;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_1408;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1409;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_1410;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1411;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1412;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<int>, double, double, empty> type_ffv_1413;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<int>, double, std::vector<double>, empty> type_ffv_1414;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<int>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1415;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<int>, double, fvar<fvar<var> >, empty> type_ffv_1416;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<int>, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_1417;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<int>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1418;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<int>, std::vector<double>, double, empty> type_ffv_1419;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<int>, std::vector<double>, std::vector<double>, empty> type_ffv_1420;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<int>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1421;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<int>, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_1422;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<int>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1423;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<int>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1424;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffv_1425;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_1426;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1427;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_1428;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1429;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1430;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<int>, fvar<fvar<var> >, double, empty> type_ffv_1431;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<int>, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_1432;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1433;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<int>, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_1434;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<int>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_1435;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1436;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<int>, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_1437;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_1438;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1439;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<int>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_1440;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1441;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1442;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_1443;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_1444;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1445;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_1446;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1447;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1448;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, double, empty> type_ffv_1449;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_ffv_1450;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1451;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty> type_ffv_1452;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_1453;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1454;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_ffv_1455;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_ffv_1456;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1457;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_1458;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1459;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1460;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffv_1461;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_1462;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1463;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_1464;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1465;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1466;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty> type_ffv_1467;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_1468;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1469;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_1470;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_1471;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1472;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_1473;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_1474;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1475;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_1476;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1477;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1478;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_1479;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_1480;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1481;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_1482;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1483;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1484;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, int, double, double, empty> type_ffv_1485;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, int, double, std::vector<double>, empty> type_ffv_1486;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, int, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1487;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, int, double, fvar<fvar<var> >, empty> type_ffv_1488;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, int, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_1489;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, int, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1490;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, int, std::vector<double>, double, empty> type_ffv_1491;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, int, std::vector<double>, std::vector<double>, empty> type_ffv_1492;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, int, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1493;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, int, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_1494;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, int, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1495;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, int, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1496;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffv_1497;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_1498;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1499;
+
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1400> AgradDistributionNormalSufficient_ffv_1400;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1401> AgradDistributionNormalSufficient_ffv_1401;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1402> AgradDistributionNormalSufficient_ffv_1402;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1403> AgradDistributionNormalSufficient_ffv_1403;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1404> AgradDistributionNormalSufficient_ffv_1404;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1405> AgradDistributionNormalSufficient_ffv_1405;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1406> AgradDistributionNormalSufficient_ffv_1406;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1407> AgradDistributionNormalSufficient_ffv_1407;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1408> AgradDistributionNormalSufficient_ffv_1408;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1409> AgradDistributionNormalSufficient_ffv_1409;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1410> AgradDistributionNormalSufficient_ffv_1410;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1411> AgradDistributionNormalSufficient_ffv_1411;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1412> AgradDistributionNormalSufficient_ffv_1412;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1413> AgradDistributionNormalSufficient_ffv_1413;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1414> AgradDistributionNormalSufficient_ffv_1414;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1415> AgradDistributionNormalSufficient_ffv_1415;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1416> AgradDistributionNormalSufficient_ffv_1416;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1417> AgradDistributionNormalSufficient_ffv_1417;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1418> AgradDistributionNormalSufficient_ffv_1418;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1419> AgradDistributionNormalSufficient_ffv_1419;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1420> AgradDistributionNormalSufficient_ffv_1420;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1421> AgradDistributionNormalSufficient_ffv_1421;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1422> AgradDistributionNormalSufficient_ffv_1422;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1423> AgradDistributionNormalSufficient_ffv_1423;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1424> AgradDistributionNormalSufficient_ffv_1424;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1425> AgradDistributionNormalSufficient_ffv_1425;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1426> AgradDistributionNormalSufficient_ffv_1426;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1427> AgradDistributionNormalSufficient_ffv_1427;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1428> AgradDistributionNormalSufficient_ffv_1428;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1429> AgradDistributionNormalSufficient_ffv_1429;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1430> AgradDistributionNormalSufficient_ffv_1430;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1431> AgradDistributionNormalSufficient_ffv_1431;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1432> AgradDistributionNormalSufficient_ffv_1432;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1433> AgradDistributionNormalSufficient_ffv_1433;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1434> AgradDistributionNormalSufficient_ffv_1434;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1435> AgradDistributionNormalSufficient_ffv_1435;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1436> AgradDistributionNormalSufficient_ffv_1436;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1437> AgradDistributionNormalSufficient_ffv_1437;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1438> AgradDistributionNormalSufficient_ffv_1438;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1439> AgradDistributionNormalSufficient_ffv_1439;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1440> AgradDistributionNormalSufficient_ffv_1440;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1441> AgradDistributionNormalSufficient_ffv_1441;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1442> AgradDistributionNormalSufficient_ffv_1442;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1443> AgradDistributionNormalSufficient_ffv_1443;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1444> AgradDistributionNormalSufficient_ffv_1444;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1445> AgradDistributionNormalSufficient_ffv_1445;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1446> AgradDistributionNormalSufficient_ffv_1446;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1447> AgradDistributionNormalSufficient_ffv_1447;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1448> AgradDistributionNormalSufficient_ffv_1448;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1449> AgradDistributionNormalSufficient_ffv_1449;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1450> AgradDistributionNormalSufficient_ffv_1450;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1451> AgradDistributionNormalSufficient_ffv_1451;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1452> AgradDistributionNormalSufficient_ffv_1452;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1453> AgradDistributionNormalSufficient_ffv_1453;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1454> AgradDistributionNormalSufficient_ffv_1454;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1455> AgradDistributionNormalSufficient_ffv_1455;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1456> AgradDistributionNormalSufficient_ffv_1456;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1457> AgradDistributionNormalSufficient_ffv_1457;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1458> AgradDistributionNormalSufficient_ffv_1458;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1459> AgradDistributionNormalSufficient_ffv_1459;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1460> AgradDistributionNormalSufficient_ffv_1460;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1461> AgradDistributionNormalSufficient_ffv_1461;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1462> AgradDistributionNormalSufficient_ffv_1462;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1463> AgradDistributionNormalSufficient_ffv_1463;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1464> AgradDistributionNormalSufficient_ffv_1464;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1465> AgradDistributionNormalSufficient_ffv_1465;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1466> AgradDistributionNormalSufficient_ffv_1466;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1467> AgradDistributionNormalSufficient_ffv_1467;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1468> AgradDistributionNormalSufficient_ffv_1468;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1469> AgradDistributionNormalSufficient_ffv_1469;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1470> AgradDistributionNormalSufficient_ffv_1470;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1471> AgradDistributionNormalSufficient_ffv_1471;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1472> AgradDistributionNormalSufficient_ffv_1472;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1473> AgradDistributionNormalSufficient_ffv_1473;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1474> AgradDistributionNormalSufficient_ffv_1474;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1475> AgradDistributionNormalSufficient_ffv_1475;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1476> AgradDistributionNormalSufficient_ffv_1476;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1477> AgradDistributionNormalSufficient_ffv_1477;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1478> AgradDistributionNormalSufficient_ffv_1478;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1479> AgradDistributionNormalSufficient_ffv_1479;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1480> AgradDistributionNormalSufficient_ffv_1480;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1481> AgradDistributionNormalSufficient_ffv_1481;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1482> AgradDistributionNormalSufficient_ffv_1482;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1483> AgradDistributionNormalSufficient_ffv_1483;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1484> AgradDistributionNormalSufficient_ffv_1484;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1485> AgradDistributionNormalSufficient_ffv_1485;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1486> AgradDistributionNormalSufficient_ffv_1486;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1487> AgradDistributionNormalSufficient_ffv_1487;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1488> AgradDistributionNormalSufficient_ffv_1488;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1489> AgradDistributionNormalSufficient_ffv_1489;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1490> AgradDistributionNormalSufficient_ffv_1490;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1491> AgradDistributionNormalSufficient_ffv_1491;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1492> AgradDistributionNormalSufficient_ffv_1492;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1493> AgradDistributionNormalSufficient_ffv_1493;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1494> AgradDistributionNormalSufficient_ffv_1494;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1495> AgradDistributionNormalSufficient_ffv_1495;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1496> AgradDistributionNormalSufficient_ffv_1496;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1497> AgradDistributionNormalSufficient_ffv_1497;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1498> AgradDistributionNormalSufficient_ffv_1498;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1499> AgradDistributionNormalSufficient_ffv_1499;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1400, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1400);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1401, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1401);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1402, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1402);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1403, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1403);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1404, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1404);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1405, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1405);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1406, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1406);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1407, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1407);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1408, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1408);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1409, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1409);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1410, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1410);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1411, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1411);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1412, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1412);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1413, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1413);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1414, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1414);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1415, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1415);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1416, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1416);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1417, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1417);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1418, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1418);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1419, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1419);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1420, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1420);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1421, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1421);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1422, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1422);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1423, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1423);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1424, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1424);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1425, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1425);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1426, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1426);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1427, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1427);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1428, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1428);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1429, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1429);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1430, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1430);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1431, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1431);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1432, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1432);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1433, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1433);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1434, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1434);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1435, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1435);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1436, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1436);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1437, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1437);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1438, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1438);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1439, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1439);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1440, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1440);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1441, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1441);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1442, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1442);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1443, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1443);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1444, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1444);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1445, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1445);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1446, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1446);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1447, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1447);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1448, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1448);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1449, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1449);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1450, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1450);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1451, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1451);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1452, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1452);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1453, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1453);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1454, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1454);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1455, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1455);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1456, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1456);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1457, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1457);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1458, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1458);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1459, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1459);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1460, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1460);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1461, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1461);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1462, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1462);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1463, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1463);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1464, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1464);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1465, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1465);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1466, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1466);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1467, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1467);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1468, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1468);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1469, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1469);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1470, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1470);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1471, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1471);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1472, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1472);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1473, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1473);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1474, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1474);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1475, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1475);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1476, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1476);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1477, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1477);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1478, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1478);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1479, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1479);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1480, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1480);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1481, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1481);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1482, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1482);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1483, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1483);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1484, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1484);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1485, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1485);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1486, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1486);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1487, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1487);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1488, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1488);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1489, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1489);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1490, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1490);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1491, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1491);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1492, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1492);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1493, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1493);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1494, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1494);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1495, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1495);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1496, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1496);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1497, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1497);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1498, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1498);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1499, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1499);
+
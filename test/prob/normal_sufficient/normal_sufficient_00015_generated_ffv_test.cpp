@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/normal_sufficient/normal_sufficient_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_1500;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1501;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1502;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, int, fvar<fvar<var> >, double, empty> type_ffv_1503;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, int, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_1504;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, int, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1505;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, int, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_1506;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, int, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_1507;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, int, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1508;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, int, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_1509;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, int, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_1510;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1511;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, int, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_1512;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, int, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1513;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1514;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_1515;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_1516;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1517;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_1518;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1519;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1520;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<int>, double, double, empty> type_ffv_1521;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<int>, double, std::vector<double>, empty> type_ffv_1522;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<int>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1523;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<int>, double, fvar<fvar<var> >, empty> type_ffv_1524;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<int>, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_1525;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<int>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1526;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<int>, std::vector<double>, double, empty> type_ffv_1527;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<int>, std::vector<double>, std::vector<double>, empty> type_ffv_1528;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<int>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1529;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<int>, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_1530;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<int>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1531;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<int>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1532;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffv_1533;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_1534;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1535;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_1536;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1537;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1538;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<int>, fvar<fvar<var> >, double, empty> type_ffv_1539;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<int>, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_1540;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1541;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<int>, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_1542;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<int>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_1543;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1544;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<int>, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_1545;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_1546;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1547;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<int>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_1548;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1549;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1550;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_1551;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_1552;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1553;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_1554;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1555;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1556;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, double, empty> type_ffv_1557;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_ffv_1558;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1559;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty> type_ffv_1560;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_1561;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1562;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_ffv_1563;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_ffv_1564;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1565;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_1566;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1567;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1568;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffv_1569;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_1570;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1571;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_1572;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1573;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1574;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty> type_ffv_1575;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_1576;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1577;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_1578;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_1579;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1580;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_1581;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_1582;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1583;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_1584;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1585;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1586;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_1587;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_1588;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1589;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_1590;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1591;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1592;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, int, double, double, empty> type_ffv_1593;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, int, double, std::vector<double>, empty> type_ffv_1594;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, int, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1595;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, int, double, fvar<fvar<var> >, empty> type_ffv_1596;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, int, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_1597;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, int, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1598;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, int, std::vector<double>, double, empty> type_ffv_1599;
+
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1500> AgradDistributionNormalSufficient_ffv_1500;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1501> AgradDistributionNormalSufficient_ffv_1501;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1502> AgradDistributionNormalSufficient_ffv_1502;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1503> AgradDistributionNormalSufficient_ffv_1503;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1504> AgradDistributionNormalSufficient_ffv_1504;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1505> AgradDistributionNormalSufficient_ffv_1505;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1506> AgradDistributionNormalSufficient_ffv_1506;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1507> AgradDistributionNormalSufficient_ffv_1507;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1508> AgradDistributionNormalSufficient_ffv_1508;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1509> AgradDistributionNormalSufficient_ffv_1509;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1510> AgradDistributionNormalSufficient_ffv_1510;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1511> AgradDistributionNormalSufficient_ffv_1511;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1512> AgradDistributionNormalSufficient_ffv_1512;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1513> AgradDistributionNormalSufficient_ffv_1513;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1514> AgradDistributionNormalSufficient_ffv_1514;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1515> AgradDistributionNormalSufficient_ffv_1515;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1516> AgradDistributionNormalSufficient_ffv_1516;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1517> AgradDistributionNormalSufficient_ffv_1517;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1518> AgradDistributionNormalSufficient_ffv_1518;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1519> AgradDistributionNormalSufficient_ffv_1519;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1520> AgradDistributionNormalSufficient_ffv_1520;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1521> AgradDistributionNormalSufficient_ffv_1521;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1522> AgradDistributionNormalSufficient_ffv_1522;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1523> AgradDistributionNormalSufficient_ffv_1523;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1524> AgradDistributionNormalSufficient_ffv_1524;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1525> AgradDistributionNormalSufficient_ffv_1525;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1526> AgradDistributionNormalSufficient_ffv_1526;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1527> AgradDistributionNormalSufficient_ffv_1527;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1528> AgradDistributionNormalSufficient_ffv_1528;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1529> AgradDistributionNormalSufficient_ffv_1529;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1530> AgradDistributionNormalSufficient_ffv_1530;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1531> AgradDistributionNormalSufficient_ffv_1531;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1532> AgradDistributionNormalSufficient_ffv_1532;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1533> AgradDistributionNormalSufficient_ffv_1533;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1534> AgradDistributionNormalSufficient_ffv_1534;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1535> AgradDistributionNormalSufficient_ffv_1535;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1536> AgradDistributionNormalSufficient_ffv_1536;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1537> AgradDistributionNormalSufficient_ffv_1537;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1538> AgradDistributionNormalSufficient_ffv_1538;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1539> AgradDistributionNormalSufficient_ffv_1539;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1540> AgradDistributionNormalSufficient_ffv_1540;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1541> AgradDistributionNormalSufficient_ffv_1541;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1542> AgradDistributionNormalSufficient_ffv_1542;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1543> AgradDistributionNormalSufficient_ffv_1543;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1544> AgradDistributionNormalSufficient_ffv_1544;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1545> AgradDistributionNormalSufficient_ffv_1545;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1546> AgradDistributionNormalSufficient_ffv_1546;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1547> AgradDistributionNormalSufficient_ffv_1547;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1548> AgradDistributionNormalSufficient_ffv_1548;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1549> AgradDistributionNormalSufficient_ffv_1549;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1550> AgradDistributionNormalSufficient_ffv_1550;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1551> AgradDistributionNormalSufficient_ffv_1551;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1552> AgradDistributionNormalSufficient_ffv_1552;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1553> AgradDistributionNormalSufficient_ffv_1553;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1554> AgradDistributionNormalSufficient_ffv_1554;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1555> AgradDistributionNormalSufficient_ffv_1555;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1556> AgradDistributionNormalSufficient_ffv_1556;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1557> AgradDistributionNormalSufficient_ffv_1557;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1558> AgradDistributionNormalSufficient_ffv_1558;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1559> AgradDistributionNormalSufficient_ffv_1559;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1560> AgradDistributionNormalSufficient_ffv_1560;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1561> AgradDistributionNormalSufficient_ffv_1561;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1562> AgradDistributionNormalSufficient_ffv_1562;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1563> AgradDistributionNormalSufficient_ffv_1563;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1564> AgradDistributionNormalSufficient_ffv_1564;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1565> AgradDistributionNormalSufficient_ffv_1565;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1566> AgradDistributionNormalSufficient_ffv_1566;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1567> AgradDistributionNormalSufficient_ffv_1567;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1568> AgradDistributionNormalSufficient_ffv_1568;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1569> AgradDistributionNormalSufficient_ffv_1569;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1570> AgradDistributionNormalSufficient_ffv_1570;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1571> AgradDistributionNormalSufficient_ffv_1571;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1572> AgradDistributionNormalSufficient_ffv_1572;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1573> AgradDistributionNormalSufficient_ffv_1573;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1574> AgradDistributionNormalSufficient_ffv_1574;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1575> AgradDistributionNormalSufficient_ffv_1575;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1576> AgradDistributionNormalSufficient_ffv_1576;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1577> AgradDistributionNormalSufficient_ffv_1577;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1578> AgradDistributionNormalSufficient_ffv_1578;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1579> AgradDistributionNormalSufficient_ffv_1579;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1580> AgradDistributionNormalSufficient_ffv_1580;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1581> AgradDistributionNormalSufficient_ffv_1581;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1582> AgradDistributionNormalSufficient_ffv_1582;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1583> AgradDistributionNormalSufficient_ffv_1583;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1584> AgradDistributionNormalSufficient_ffv_1584;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1585> AgradDistributionNormalSufficient_ffv_1585;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1586> AgradDistributionNormalSufficient_ffv_1586;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1587> AgradDistributionNormalSufficient_ffv_1587;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1588> AgradDistributionNormalSufficient_ffv_1588;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1589> AgradDistributionNormalSufficient_ffv_1589;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1590> AgradDistributionNormalSufficient_ffv_1590;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1591> AgradDistributionNormalSufficient_ffv_1591;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1592> AgradDistributionNormalSufficient_ffv_1592;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1593> AgradDistributionNormalSufficient_ffv_1593;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1594> AgradDistributionNormalSufficient_ffv_1594;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1595> AgradDistributionNormalSufficient_ffv_1595;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1596> AgradDistributionNormalSufficient_ffv_1596;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1597> AgradDistributionNormalSufficient_ffv_1597;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1598> AgradDistributionNormalSufficient_ffv_1598;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1599> AgradDistributionNormalSufficient_ffv_1599;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1500, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1500);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1501, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1501);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1502, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1502);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1503, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1503);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1504, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1504);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1505, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1505);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1506, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1506);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1507, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1507);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1508, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1508);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1509, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1509);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1510, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1510);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1511, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1511);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1512, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1512);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1513, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1513);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1514, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1514);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1515, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1515);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1516, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1516);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1517, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1517);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1518, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1518);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1519, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1519);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1520, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1520);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1521, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1521);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1522, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1522);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1523, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1523);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1524, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1524);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1525, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1525);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1526, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1526);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1527, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1527);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1528, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1528);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1529, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1529);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1530, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1530);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1531, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1531);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1532, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1532);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1533, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1533);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1534, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1534);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1535, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1535);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1536, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1536);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1537, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1537);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1538, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1538);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1539, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1539);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1540, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1540);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1541, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1541);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1542, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1542);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1543, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1543);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1544, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1544);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1545, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1545);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1546, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1546);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1547, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1547);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1548, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1548);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1549, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1549);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1550, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1550);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1551, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1551);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1552, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1552);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1553, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1553);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1554, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1554);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1555, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1555);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1556, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1556);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1557, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1557);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1558, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1558);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1559, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1559);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1560, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1560);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1561, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1561);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1562, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1562);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1563, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1563);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1564, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1564);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1565, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1565);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1566, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1566);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1567, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1567);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1568, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1568);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1569, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1569);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1570, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1570);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1571, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1571);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1572, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1572);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1573, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1573);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1574, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1574);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1575, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1575);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1576, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1576);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1577, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1577);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1578, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1578);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1579, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1579);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1580, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1580);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1581, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1581);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1582, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1582);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1583, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1583);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1584, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1584);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1585, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1585);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1586, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1586);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1587, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1587);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1588, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1588);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1589, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1589);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1590, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1590);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1591, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1591);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1592, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1592);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1593, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1593);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1594, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1594);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1595, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1595);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1596, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1596);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1597, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1597);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1598, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1598);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1599, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1599);
+
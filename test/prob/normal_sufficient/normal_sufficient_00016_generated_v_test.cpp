@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/normal_sufficient/normal_sufficient_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_1600;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_1601;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, double, empty> type_v_1602;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<double>, empty> type_v_1603;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_1604;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, var, empty> type_v_1605;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<var>, empty> type_v_1606;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_1607;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, double, empty> type_v_1608;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty> type_v_1609;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_1610;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, var, empty> type_v_1611;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty> type_v_1612;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_1613;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_1614;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_1615;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_1616;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_1617;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_1618;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_1619;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, int, double, double, empty> type_v_1620;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, int, double, std::vector<double>, empty> type_v_1621;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, int, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_1622;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, int, double, var, empty> type_v_1623;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, int, double, std::vector<var>, empty> type_v_1624;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, int, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_1625;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, int, std::vector<double>, double, empty> type_v_1626;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, int, std::vector<double>, std::vector<double>, empty> type_v_1627;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, int, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_1628;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, int, std::vector<double>, var, empty> type_v_1629;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, int, std::vector<double>, std::vector<var>, empty> type_v_1630;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, int, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_1631;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_1632;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_1633;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_1634;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_1635;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_1636;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_1637;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, int, var, double, empty> type_v_1638;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, int, var, std::vector<double>, empty> type_v_1639;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, int, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_1640;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, int, var, var, empty> type_v_1641;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, int, var, std::vector<var>, empty> type_v_1642;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, int, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_1643;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, int, std::vector<var>, double, empty> type_v_1644;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, int, std::vector<var>, std::vector<double>, empty> type_v_1645;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, int, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_1646;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, int, std::vector<var>, var, empty> type_v_1647;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, int, std::vector<var>, std::vector<var>, empty> type_v_1648;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, int, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_1649;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_1650;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_1651;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_1652;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_1653;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_1654;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_1655;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<int>, double, double, empty> type_v_1656;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<int>, double, std::vector<double>, empty> type_v_1657;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<int>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_1658;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<int>, double, var, empty> type_v_1659;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<int>, double, std::vector<var>, empty> type_v_1660;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<int>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_1661;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<int>, std::vector<double>, double, empty> type_v_1662;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<int>, std::vector<double>, std::vector<double>, empty> type_v_1663;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<int>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_1664;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<int>, std::vector<double>, var, empty> type_v_1665;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<int>, std::vector<double>, std::vector<var>, empty> type_v_1666;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<int>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_1667;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_1668;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_1669;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_1670;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_1671;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_1672;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_1673;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<int>, var, double, empty> type_v_1674;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<int>, var, std::vector<double>, empty> type_v_1675;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<int>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_1676;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<int>, var, var, empty> type_v_1677;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<int>, var, std::vector<var>, empty> type_v_1678;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<int>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_1679;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<int>, std::vector<var>, double, empty> type_v_1680;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<int>, std::vector<var>, std::vector<double>, empty> type_v_1681;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<int>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_1682;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<int>, std::vector<var>, var, empty> type_v_1683;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<int>, std::vector<var>, std::vector<var>, empty> type_v_1684;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<int>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_1685;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_1686;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_1687;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_1688;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_1689;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_1690;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_1691;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, double, empty> type_v_1692;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_v_1693;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_1694;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, var, empty> type_v_1695;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<var>, empty> type_v_1696;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_1697;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_v_1698;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_v_1699;
+
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1600> AgradDistributionNormalSufficient_v_1600;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1601> AgradDistributionNormalSufficient_v_1601;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1602> AgradDistributionNormalSufficient_v_1602;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1603> AgradDistributionNormalSufficient_v_1603;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1604> AgradDistributionNormalSufficient_v_1604;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1605> AgradDistributionNormalSufficient_v_1605;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1606> AgradDistributionNormalSufficient_v_1606;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1607> AgradDistributionNormalSufficient_v_1607;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1608> AgradDistributionNormalSufficient_v_1608;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1609> AgradDistributionNormalSufficient_v_1609;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1610> AgradDistributionNormalSufficient_v_1610;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1611> AgradDistributionNormalSufficient_v_1611;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1612> AgradDistributionNormalSufficient_v_1612;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1613> AgradDistributionNormalSufficient_v_1613;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1614> AgradDistributionNormalSufficient_v_1614;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1615> AgradDistributionNormalSufficient_v_1615;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1616> AgradDistributionNormalSufficient_v_1616;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1617> AgradDistributionNormalSufficient_v_1617;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1618> AgradDistributionNormalSufficient_v_1618;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1619> AgradDistributionNormalSufficient_v_1619;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1620> AgradDistributionNormalSufficient_v_1620;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1621> AgradDistributionNormalSufficient_v_1621;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1622> AgradDistributionNormalSufficient_v_1622;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1623> AgradDistributionNormalSufficient_v_1623;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1624> AgradDistributionNormalSufficient_v_1624;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1625> AgradDistributionNormalSufficient_v_1625;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1626> AgradDistributionNormalSufficient_v_1626;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1627> AgradDistributionNormalSufficient_v_1627;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1628> AgradDistributionNormalSufficient_v_1628;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1629> AgradDistributionNormalSufficient_v_1629;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1630> AgradDistributionNormalSufficient_v_1630;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1631> AgradDistributionNormalSufficient_v_1631;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1632> AgradDistributionNormalSufficient_v_1632;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1633> AgradDistributionNormalSufficient_v_1633;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1634> AgradDistributionNormalSufficient_v_1634;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1635> AgradDistributionNormalSufficient_v_1635;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1636> AgradDistributionNormalSufficient_v_1636;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1637> AgradDistributionNormalSufficient_v_1637;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1638> AgradDistributionNormalSufficient_v_1638;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1639> AgradDistributionNormalSufficient_v_1639;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1640> AgradDistributionNormalSufficient_v_1640;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1641> AgradDistributionNormalSufficient_v_1641;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1642> AgradDistributionNormalSufficient_v_1642;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1643> AgradDistributionNormalSufficient_v_1643;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1644> AgradDistributionNormalSufficient_v_1644;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1645> AgradDistributionNormalSufficient_v_1645;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1646> AgradDistributionNormalSufficient_v_1646;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1647> AgradDistributionNormalSufficient_v_1647;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1648> AgradDistributionNormalSufficient_v_1648;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1649> AgradDistributionNormalSufficient_v_1649;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1650> AgradDistributionNormalSufficient_v_1650;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1651> AgradDistributionNormalSufficient_v_1651;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1652> AgradDistributionNormalSufficient_v_1652;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1653> AgradDistributionNormalSufficient_v_1653;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1654> AgradDistributionNormalSufficient_v_1654;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1655> AgradDistributionNormalSufficient_v_1655;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1656> AgradDistributionNormalSufficient_v_1656;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1657> AgradDistributionNormalSufficient_v_1657;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1658> AgradDistributionNormalSufficient_v_1658;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1659> AgradDistributionNormalSufficient_v_1659;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1660> AgradDistributionNormalSufficient_v_1660;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1661> AgradDistributionNormalSufficient_v_1661;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1662> AgradDistributionNormalSufficient_v_1662;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1663> AgradDistributionNormalSufficient_v_1663;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1664> AgradDistributionNormalSufficient_v_1664;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1665> AgradDistributionNormalSufficient_v_1665;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1666> AgradDistributionNormalSufficient_v_1666;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1667> AgradDistributionNormalSufficient_v_1667;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1668> AgradDistributionNormalSufficient_v_1668;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1669> AgradDistributionNormalSufficient_v_1669;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1670> AgradDistributionNormalSufficient_v_1670;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1671> AgradDistributionNormalSufficient_v_1671;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1672> AgradDistributionNormalSufficient_v_1672;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1673> AgradDistributionNormalSufficient_v_1673;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1674> AgradDistributionNormalSufficient_v_1674;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1675> AgradDistributionNormalSufficient_v_1675;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1676> AgradDistributionNormalSufficient_v_1676;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1677> AgradDistributionNormalSufficient_v_1677;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1678> AgradDistributionNormalSufficient_v_1678;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1679> AgradDistributionNormalSufficient_v_1679;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1680> AgradDistributionNormalSufficient_v_1680;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1681> AgradDistributionNormalSufficient_v_1681;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1682> AgradDistributionNormalSufficient_v_1682;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1683> AgradDistributionNormalSufficient_v_1683;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1684> AgradDistributionNormalSufficient_v_1684;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1685> AgradDistributionNormalSufficient_v_1685;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1686> AgradDistributionNormalSufficient_v_1686;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1687> AgradDistributionNormalSufficient_v_1687;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1688> AgradDistributionNormalSufficient_v_1688;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1689> AgradDistributionNormalSufficient_v_1689;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1690> AgradDistributionNormalSufficient_v_1690;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1691> AgradDistributionNormalSufficient_v_1691;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1692> AgradDistributionNormalSufficient_v_1692;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1693> AgradDistributionNormalSufficient_v_1693;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1694> AgradDistributionNormalSufficient_v_1694;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1695> AgradDistributionNormalSufficient_v_1695;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1696> AgradDistributionNormalSufficient_v_1696;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1697> AgradDistributionNormalSufficient_v_1697;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1698> AgradDistributionNormalSufficient_v_1698;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_1699> AgradDistributionNormalSufficient_v_1699;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1600, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1600);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1601, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1601);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1602, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1602);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1603, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1603);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1604, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1604);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1605, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1605);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1606, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1606);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1607, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1607);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1608, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1608);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1609, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1609);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1610, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1610);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1611, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1611);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1612, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1612);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1613, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1613);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1614, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1614);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1615, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1615);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1616, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1616);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1617, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1617);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1618, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1618);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1619, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1619);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1620, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1620);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1621, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1621);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1622, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1622);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1623, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1623);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1624, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1624);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1625, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1625);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1626, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1626);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1627, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1627);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1628, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1628);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1629, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1629);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1630, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1630);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1631, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1631);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1632, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1632);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1633, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1633);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1634, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1634);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1635, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1635);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1636, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1636);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1637, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1637);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1638, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1638);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1639, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1639);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1640, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1640);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1641, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1641);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1642, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1642);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1643, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1643);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1644, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1644);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1645, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1645);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1646, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1646);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1647, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1647);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1648, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1648);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1649, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1649);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1650, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1650);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1651, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1651);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1652, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1652);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1653, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1653);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1654, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1654);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1655, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1655);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1656, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1656);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1657, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1657);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1658, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1658);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1659, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1659);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1660, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1660);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1661, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1661);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1662, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1662);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1663, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1663);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1664, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1664);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1665, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1665);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1666, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1666);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1667, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1667);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1668, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1668);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1669, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1669);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1670, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1670);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1671, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1671);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1672, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1672);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1673, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1673);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1674, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1674);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1675, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1675);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1676, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1676);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1677, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1677);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1678, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1678);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1679, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1679);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1680, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1680);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1681, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1681);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1682, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1682);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1683, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1683);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1684, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1684);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1685, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1685);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1686, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1686);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1687, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1687);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1688, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1688);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1689, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1689);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1690, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1690);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1691, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1691);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1692, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1692);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1693, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1693);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1694, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1694);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1695, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1695);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1696, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1696);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1697, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1697);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1698, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1698);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_1699, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_1699);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/normal_sufficient/normal_sufficient_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_1700;
+typedef std::tuple<var, double, int, double, double, empty> type_vv_1701;
+typedef std::tuple<var, double, int, double, std::vector<double>, empty> type_vv_1702;
+typedef std::tuple<var, double, int, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_1703;
+typedef std::tuple<var, double, int, double, var, empty> type_vv_1704;
+typedef std::tuple<var, double, int, double, std::vector<var>, empty> type_vv_1705;
+typedef std::tuple<var, double, int, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_1706;
+typedef std::tuple<var, double, int, std::vector<double>, double, empty> type_vv_1707;
+typedef std::tuple<var, double, int, std::vector<double>, std::vector<double>, empty> type_vv_1708;
+typedef std::tuple<var, double, int, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_1709;
+typedef std::tuple<var, double, int, std::vector<double>, var, empty> type_vv_1710;
+typedef std::tuple<var, double, int, std::vector<double>, std::vector<var>, empty> type_vv_1711;
+typedef std::tuple<var, double, int, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_1712;
+typedef std::tuple<var, double, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_vv_1713;
+typedef std::tuple<var, double, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_vv_1714;
+typedef std::tuple<var, double, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_1715;
+typedef std::tuple<var, double, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_vv_1716;
+typedef std::tuple<var, double, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_vv_1717;
+typedef std::tuple<var, double, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_1718;
+typedef std::tuple<var, double, int, var, double, empty> type_vv_1719;
+typedef std::tuple<var, double, int, var, std::vector<double>, empty> type_vv_1720;
+typedef std::tuple<var, double, int, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_1721;
+typedef std::tuple<var, double, int, var, var, empty> type_vv_1722;
+typedef std::tuple<var, double, int, var, std::vector<var>, empty> type_vv_1723;
+typedef std::tuple<var, double, int, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_1724;
+typedef std::tuple<var, double, int, std::vector<var>, double, empty> type_vv_1725;
+typedef std::tuple<var, double, int, std::vector<var>, std::vector<double>, empty> type_vv_1726;
+typedef std::tuple<var, double, int, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_1727;
+typedef std::tuple<var, double, int, std::vector<var>, var, empty> type_vv_1728;
+typedef std::tuple<var, double, int, std::vector<var>, std::vector<var>, empty> type_vv_1729;
+typedef std::tuple<var, double, int, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_1730;
+typedef std::tuple<var, double, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty> type_vv_1731;
+typedef std::tuple<var, double, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty> type_vv_1732;
+typedef std::tuple<var, double, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_1733;
+typedef std::tuple<var, double, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty> type_vv_1734;
+typedef std::tuple<var, double, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty> type_vv_1735;
+typedef std::tuple<var, double, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_1736;
+typedef std::tuple<var, double, std::vector<int>, double, double, empty> type_vv_1737;
+typedef std::tuple<var, double, std::vector<int>, double, std::vector<double>, empty> type_vv_1738;
+typedef std::tuple<var, double, std::vector<int>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_1739;
+typedef std::tuple<var, double, std::vector<int>, double, var, empty> type_vv_1740;
+typedef std::tuple<var, double, std::vector<int>, double, std::vector<var>, empty> type_vv_1741;
+typedef std::tuple<var, double, std::vector<int>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_1742;
+typedef std::tuple<var, double, std::vector<int>, std::vector<double>, double, empty> type_vv_1743;
+typedef std::tuple<var, double, std::vector<int>, std::vector<double>, std::vector<double>, empty> type_vv_1744;
+typedef std::tuple<var, double, std::vector<int>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_1745;
+typedef std::tuple<var, double, std::vector<int>, std::vector<double>, var, empty> type_vv_1746;
+typedef std::tuple<var, double, std::vector<int>, std::vector<double>, std::vector<var>, empty> type_vv_1747;
+typedef std::tuple<var, double, std::vector<int>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_1748;
+typedef std::tuple<var, double, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_vv_1749;
+typedef std::tuple<var, double, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_vv_1750;
+typedef std::tuple<var, double, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_1751;
+typedef std::tuple<var, double, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_vv_1752;
+typedef std::tuple<var, double, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_vv_1753;
+typedef std::tuple<var, double, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_1754;
+typedef std::tuple<var, double, std::vector<int>, var, double, empty> type_vv_1755;
+typedef std::tuple<var, double, std::vector<int>, var, std::vector<double>, empty> type_vv_1756;
+typedef std::tuple<var, double, std::vector<int>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_1757;
+typedef std::tuple<var, double, std::vector<int>, var, var, empty> type_vv_1758;
+typedef std::tuple<var, double, std::vector<int>, var, std::vector<var>, empty> type_vv_1759;
+typedef std::tuple<var, double, std::vector<int>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_1760;
+typedef std::tuple<var, double, std::vector<int>, std::vector<var>, double, empty> type_vv_1761;
+typedef std::tuple<var, double, std::vector<int>, std::vector<var>, std::vector<double>, empty> type_vv_1762;
+typedef std::tuple<var, double, std::vector<int>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_1763;
+typedef std::tuple<var, double, std::vector<int>, std::vector<var>, var, empty> type_vv_1764;
+typedef std::tuple<var, double, std::vector<int>, std::vector<var>, std::vector<var>, empty> type_vv_1765;
+typedef std::tuple<var, double, std::vector<int>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_1766;
+typedef std::tuple<var, double, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty> type_vv_1767;
+typedef std::tuple<var, double, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty> type_vv_1768;
+typedef std::tuple<var, double, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_1769;
+typedef std::tuple<var, double, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty> type_vv_1770;
+typedef std::tuple<var, double, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty> type_vv_1771;
+typedef std::tuple<var, double, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_1772;
+typedef std::tuple<var, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, double, empty> type_vv_1773;
+typedef std::tuple<var, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_vv_1774;
+typedef std::tuple<var, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_1775;
+typedef std::tuple<var, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, var, empty> type_vv_1776;
+typedef std::tuple<var, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<var>, empty> type_vv_1777;
+typedef std::tuple<var, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_1778;
+typedef std::tuple<var, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_vv_1779;
+typedef std::tuple<var, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_vv_1780;
+typedef std::tuple<var, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_1781;
+typedef std::tuple<var, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, var, empty> type_vv_1782;
+typedef std::tuple<var, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty> type_vv_1783;
+typedef std::tuple<var, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_1784;
+typedef std::tuple<var, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_vv_1785;
+typedef std::tuple<var, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_vv_1786;
+typedef std::tuple<var, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_1787;
+typedef std::tuple<var, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_vv_1788;
+typedef std::tuple<var, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_vv_1789;
+typedef std::tuple<var, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_1790;
+typedef std::tuple<var, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, double, empty> type_vv_1791;
+typedef std::tuple<var, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<double>, empty> type_vv_1792;
+typedef std::tuple<var, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_1793;
+typedef std::tuple<var, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, var, empty> type_vv_1794;
+typedef std::tuple<var, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<var>, empty> type_vv_1795;
+typedef std::tuple<var, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_1796;
+typedef std::tuple<var, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, double, empty> type_vv_1797;
+typedef std::tuple<var, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty> type_vv_1798;
+typedef std::tuple<var, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_1799;
+
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1700> AgradDistributionNormalSufficient_vv_1700;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1701> AgradDistributionNormalSufficient_vv_1701;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1702> AgradDistributionNormalSufficient_vv_1702;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1703> AgradDistributionNormalSufficient_vv_1703;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1704> AgradDistributionNormalSufficient_vv_1704;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1705> AgradDistributionNormalSufficient_vv_1705;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1706> AgradDistributionNormalSufficient_vv_1706;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1707> AgradDistributionNormalSufficient_vv_1707;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1708> AgradDistributionNormalSufficient_vv_1708;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1709> AgradDistributionNormalSufficient_vv_1709;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1710> AgradDistributionNormalSufficient_vv_1710;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1711> AgradDistributionNormalSufficient_vv_1711;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1712> AgradDistributionNormalSufficient_vv_1712;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1713> AgradDistributionNormalSufficient_vv_1713;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1714> AgradDistributionNormalSufficient_vv_1714;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1715> AgradDistributionNormalSufficient_vv_1715;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1716> AgradDistributionNormalSufficient_vv_1716;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1717> AgradDistributionNormalSufficient_vv_1717;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1718> AgradDistributionNormalSufficient_vv_1718;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1719> AgradDistributionNormalSufficient_vv_1719;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1720> AgradDistributionNormalSufficient_vv_1720;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1721> AgradDistributionNormalSufficient_vv_1721;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1722> AgradDistributionNormalSufficient_vv_1722;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1723> AgradDistributionNormalSufficient_vv_1723;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1724> AgradDistributionNormalSufficient_vv_1724;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1725> AgradDistributionNormalSufficient_vv_1725;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1726> AgradDistributionNormalSufficient_vv_1726;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1727> AgradDistributionNormalSufficient_vv_1727;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1728> AgradDistributionNormalSufficient_vv_1728;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1729> AgradDistributionNormalSufficient_vv_1729;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1730> AgradDistributionNormalSufficient_vv_1730;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1731> AgradDistributionNormalSufficient_vv_1731;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1732> AgradDistributionNormalSufficient_vv_1732;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1733> AgradDistributionNormalSufficient_vv_1733;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1734> AgradDistributionNormalSufficient_vv_1734;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1735> AgradDistributionNormalSufficient_vv_1735;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1736> AgradDistributionNormalSufficient_vv_1736;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1737> AgradDistributionNormalSufficient_vv_1737;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1738> AgradDistributionNormalSufficient_vv_1738;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1739> AgradDistributionNormalSufficient_vv_1739;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1740> AgradDistributionNormalSufficient_vv_1740;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1741> AgradDistributionNormalSufficient_vv_1741;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1742> AgradDistributionNormalSufficient_vv_1742;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1743> AgradDistributionNormalSufficient_vv_1743;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1744> AgradDistributionNormalSufficient_vv_1744;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1745> AgradDistributionNormalSufficient_vv_1745;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1746> AgradDistributionNormalSufficient_vv_1746;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1747> AgradDistributionNormalSufficient_vv_1747;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1748> AgradDistributionNormalSufficient_vv_1748;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1749> AgradDistributionNormalSufficient_vv_1749;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1750> AgradDistributionNormalSufficient_vv_1750;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1751> AgradDistributionNormalSufficient_vv_1751;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1752> AgradDistributionNormalSufficient_vv_1752;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1753> AgradDistributionNormalSufficient_vv_1753;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1754> AgradDistributionNormalSufficient_vv_1754;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1755> AgradDistributionNormalSufficient_vv_1755;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1756> AgradDistributionNormalSufficient_vv_1756;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1757> AgradDistributionNormalSufficient_vv_1757;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1758> AgradDistributionNormalSufficient_vv_1758;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1759> AgradDistributionNormalSufficient_vv_1759;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1760> AgradDistributionNormalSufficient_vv_1760;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1761> AgradDistributionNormalSufficient_vv_1761;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1762> AgradDistributionNormalSufficient_vv_1762;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1763> AgradDistributionNormalSufficient_vv_1763;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1764> AgradDistributionNormalSufficient_vv_1764;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1765> AgradDistributionNormalSufficient_vv_1765;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1766> AgradDistributionNormalSufficient_vv_1766;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1767> AgradDistributionNormalSufficient_vv_1767;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1768> AgradDistributionNormalSufficient_vv_1768;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1769> AgradDistributionNormalSufficient_vv_1769;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1770> AgradDistributionNormalSufficient_vv_1770;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1771> AgradDistributionNormalSufficient_vv_1771;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1772> AgradDistributionNormalSufficient_vv_1772;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1773> AgradDistributionNormalSufficient_vv_1773;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1774> AgradDistributionNormalSufficient_vv_1774;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1775> AgradDistributionNormalSufficient_vv_1775;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1776> AgradDistributionNormalSufficient_vv_1776;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1777> AgradDistributionNormalSufficient_vv_1777;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1778> AgradDistributionNormalSufficient_vv_1778;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1779> AgradDistributionNormalSufficient_vv_1779;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1780> AgradDistributionNormalSufficient_vv_1780;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1781> AgradDistributionNormalSufficient_vv_1781;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1782> AgradDistributionNormalSufficient_vv_1782;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1783> AgradDistributionNormalSufficient_vv_1783;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1784> AgradDistributionNormalSufficient_vv_1784;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1785> AgradDistributionNormalSufficient_vv_1785;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1786> AgradDistributionNormalSufficient_vv_1786;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1787> AgradDistributionNormalSufficient_vv_1787;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1788> AgradDistributionNormalSufficient_vv_1788;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1789> AgradDistributionNormalSufficient_vv_1789;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1790> AgradDistributionNormalSufficient_vv_1790;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1791> AgradDistributionNormalSufficient_vv_1791;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1792> AgradDistributionNormalSufficient_vv_1792;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1793> AgradDistributionNormalSufficient_vv_1793;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1794> AgradDistributionNormalSufficient_vv_1794;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1795> AgradDistributionNormalSufficient_vv_1795;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1796> AgradDistributionNormalSufficient_vv_1796;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1797> AgradDistributionNormalSufficient_vv_1797;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1798> AgradDistributionNormalSufficient_vv_1798;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1799> AgradDistributionNormalSufficient_vv_1799;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1700, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1700);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1701, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1701);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1702, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1702);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1703, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1703);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1704, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1704);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1705, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1705);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1706, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1706);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1707, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1707);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1708, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1708);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1709, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1709);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1710, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1710);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1711, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1711);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1712, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1712);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1713, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1713);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1714, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1714);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1715, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1715);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1716, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1716);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1717, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1717);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1718, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1718);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1719, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1719);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1720, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1720);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1721, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1721);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1722, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1722);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1723, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1723);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1724, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1724);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1725, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1725);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1726, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1726);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1727, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1727);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1728, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1728);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1729, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1729);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1730, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1730);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1731, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1731);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1732, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1732);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1733, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1733);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1734, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1734);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1735, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1735);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1736, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1736);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1737, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1737);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1738, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1738);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1739, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1739);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1740, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1740);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1741, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1741);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1742, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1742);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1743, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1743);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1744, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1744);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1745, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1745);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1746, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1746);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1747, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1747);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1748, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1748);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1749, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1749);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1750, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1750);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1751, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1751);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1752, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1752);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1753, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1753);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1754, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1754);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1755, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1755);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1756, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1756);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1757, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1757);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1758, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1758);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1759, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1759);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1760, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1760);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1761, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1761);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1762, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1762);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1763, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1763);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1764, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1764);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1765, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1765);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1766, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1766);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1767, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1767);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1768, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1768);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1769, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1769);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1770, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1770);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1771, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1771);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1772, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1772);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1773, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1773);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1774, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1774);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1775, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1775);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1776, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1776);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1777, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1777);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1778, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1778);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1779, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1779);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1780, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1780);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1781, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1781);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1782, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1782);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1783, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1783);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1784, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1784);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1785, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1785);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1786, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1786);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1787, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1787);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1788, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1788);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1789, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1789);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1790, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1790);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1791, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1791);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1792, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1792);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1793, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1793);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1794, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1794);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1795, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1795);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1796, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1796);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1797, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1797);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1798, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1798);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1799, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1799);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/normal_sufficient/normal_sufficient_test.hpp>
+
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_1800;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1801;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1802;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_1803;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_1804;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1805;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_1806;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1807;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1808;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, int, double, double, empty> type_ffv_1809;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, int, double, std::vector<double>, empty> type_ffv_1810;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, int, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1811;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, int, double, fvar<fvar<var> >, empty> type_ffv_1812;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, int, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_1813;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, int, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1814;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, int, std::vector<double>, double, empty> type_ffv_1815;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, int, std::vector<double>, std::vector<double>, empty> type_ffv_1816;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, int, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1817;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, int, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_1818;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, int, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1819;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, int, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1820;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffv_1821;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_1822;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1823;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_1824;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1825;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1826;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, int, fvar<fvar<var> >, double, empty> type_ffv_1827;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, int, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_1828;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, int, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1829;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, int, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_1830;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, int, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_1831;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, int, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1832;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, int, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_1833;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, int, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_1834;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1835;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, int, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_1836;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, int, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1837;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1838;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_1839;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_1840;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1841;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_1842;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1843;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1844;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<int>, double, double, empty> type_ffv_1845;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<int>, double, std::vector<double>, empty> type_ffv_1846;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<int>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1847;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<int>, double, fvar<fvar<var> >, empty> type_ffv_1848;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<int>, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_1849;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<int>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1850;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<int>, std::vector<double>, double, empty> type_ffv_1851;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<int>, std::vector<double>, std::vector<double>, empty> type_ffv_1852;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<int>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1853;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<int>, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_1854;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<int>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1855;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<int>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1856;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffv_1857;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_1858;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1859;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_1860;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1861;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1862;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<int>, fvar<fvar<var> >, double, empty> type_ffv_1863;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<int>, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_1864;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1865;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<int>, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_1866;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<int>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_1867;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1868;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<int>, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_1869;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_1870;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1871;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<int>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_1872;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1873;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1874;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_1875;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_1876;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1877;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_1878;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1879;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1880;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, double, empty> type_ffv_1881;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_ffv_1882;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1883;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty> type_ffv_1884;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_1885;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1886;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_ffv_1887;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_ffv_1888;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1889;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_1890;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1891;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1892;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffv_1893;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_1894;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1895;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_1896;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1897;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1898;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty> type_ffv_1899;
+
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1800> AgradDistributionNormalSufficient_ffv_1800;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1801> AgradDistributionNormalSufficient_ffv_1801;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1802> AgradDistributionNormalSufficient_ffv_1802;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1803> AgradDistributionNormalSufficient_ffv_1803;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1804> AgradDistributionNormalSufficient_ffv_1804;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1805> AgradDistributionNormalSufficient_ffv_1805;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1806> AgradDistributionNormalSufficient_ffv_1806;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1807> AgradDistributionNormalSufficient_ffv_1807;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1808> AgradDistributionNormalSufficient_ffv_1808;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1809> AgradDistributionNormalSufficient_ffv_1809;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1810> AgradDistributionNormalSufficient_ffv_1810;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1811> AgradDistributionNormalSufficient_ffv_1811;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1812> AgradDistributionNormalSufficient_ffv_1812;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1813> AgradDistributionNormalSufficient_ffv_1813;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1814> AgradDistributionNormalSufficient_ffv_1814;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1815> AgradDistributionNormalSufficient_ffv_1815;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1816> AgradDistributionNormalSufficient_ffv_1816;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1817> AgradDistributionNormalSufficient_ffv_1817;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1818> AgradDistributionNormalSufficient_ffv_1818;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1819> AgradDistributionNormalSufficient_ffv_1819;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1820> AgradDistributionNormalSufficient_ffv_1820;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1821> AgradDistributionNormalSufficient_ffv_1821;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1822> AgradDistributionNormalSufficient_ffv_1822;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1823> AgradDistributionNormalSufficient_ffv_1823;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1824> AgradDistributionNormalSufficient_ffv_1824;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1825> AgradDistributionNormalSufficient_ffv_1825;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1826> AgradDistributionNormalSufficient_ffv_1826;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1827> AgradDistributionNormalSufficient_ffv_1827;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1828> AgradDistributionNormalSufficient_ffv_1828;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1829> AgradDistributionNormalSufficient_ffv_1829;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1830> AgradDistributionNormalSufficient_ffv_1830;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1831> AgradDistributionNormalSufficient_ffv_1831;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1832> AgradDistributionNormalSufficient_ffv_1832;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1833> AgradDistributionNormalSufficient_ffv_1833;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1834> AgradDistributionNormalSufficient_ffv_1834;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1835> AgradDistributionNormalSufficient_ffv_1835;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1836> AgradDistributionNormalSufficient_ffv_1836;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1837> AgradDistributionNormalSufficient_ffv_1837;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1838> AgradDistributionNormalSufficient_ffv_1838;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1839> AgradDistributionNormalSufficient_ffv_1839;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1840> AgradDistributionNormalSufficient_ffv_1840;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1841> AgradDistributionNormalSufficient_ffv_1841;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1842> AgradDistributionNormalSufficient_ffv_1842;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1843> AgradDistributionNormalSufficient_ffv_1843;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1844> AgradDistributionNormalSufficient_ffv_1844;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1845> AgradDistributionNormalSufficient_ffv_1845;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1846> AgradDistributionNormalSufficient_ffv_1846;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1847> AgradDistributionNormalSufficient_ffv_1847;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1848> AgradDistributionNormalSufficient_ffv_1848;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1849> AgradDistributionNormalSufficient_ffv_1849;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1850> AgradDistributionNormalSufficient_ffv_1850;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1851> AgradDistributionNormalSufficient_ffv_1851;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1852> AgradDistributionNormalSufficient_ffv_1852;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1853> AgradDistributionNormalSufficient_ffv_1853;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1854> AgradDistributionNormalSufficient_ffv_1854;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1855> AgradDistributionNormalSufficient_ffv_1855;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1856> AgradDistributionNormalSufficient_ffv_1856;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1857> AgradDistributionNormalSufficient_ffv_1857;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1858> AgradDistributionNormalSufficient_ffv_1858;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1859> AgradDistributionNormalSufficient_ffv_1859;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1860> AgradDistributionNormalSufficient_ffv_1860;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1861> AgradDistributionNormalSufficient_ffv_1861;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1862> AgradDistributionNormalSufficient_ffv_1862;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1863> AgradDistributionNormalSufficient_ffv_1863;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1864> AgradDistributionNormalSufficient_ffv_1864;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1865> AgradDistributionNormalSufficient_ffv_1865;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1866> AgradDistributionNormalSufficient_ffv_1866;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1867> AgradDistributionNormalSufficient_ffv_1867;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1868> AgradDistributionNormalSufficient_ffv_1868;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1869> AgradDistributionNormalSufficient_ffv_1869;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1870> AgradDistributionNormalSufficient_ffv_1870;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1871> AgradDistributionNormalSufficient_ffv_1871;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1872> AgradDistributionNormalSufficient_ffv_1872;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1873> AgradDistributionNormalSufficient_ffv_1873;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1874> AgradDistributionNormalSufficient_ffv_1874;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1875> AgradDistributionNormalSufficient_ffv_1875;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1876> AgradDistributionNormalSufficient_ffv_1876;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1877> AgradDistributionNormalSufficient_ffv_1877;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1878> AgradDistributionNormalSufficient_ffv_1878;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1879> AgradDistributionNormalSufficient_ffv_1879;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1880> AgradDistributionNormalSufficient_ffv_1880;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1881> AgradDistributionNormalSufficient_ffv_1881;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1882> AgradDistributionNormalSufficient_ffv_1882;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1883> AgradDistributionNormalSufficient_ffv_1883;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1884> AgradDistributionNormalSufficient_ffv_1884;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1885> AgradDistributionNormalSufficient_ffv_1885;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1886> AgradDistributionNormalSufficient_ffv_1886;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1887> AgradDistributionNormalSufficient_ffv_1887;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1888> AgradDistributionNormalSufficient_ffv_1888;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1889> AgradDistributionNormalSufficient_ffv_1889;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1890> AgradDistributionNormalSufficient_ffv_1890;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1891> AgradDistributionNormalSufficient_ffv_1891;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1892> AgradDistributionNormalSufficient_ffv_1892;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1893> AgradDistributionNormalSufficient_ffv_1893;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1894> AgradDistributionNormalSufficient_ffv_1894;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1895> AgradDistributionNormalSufficient_ffv_1895;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1896> AgradDistributionNormalSufficient_ffv_1896;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1897> AgradDistributionNormalSufficient_ffv_1897;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1898> AgradDistributionNormalSufficient_ffv_1898;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1899> AgradDistributionNormalSufficient_ffv_1899;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1800, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1800);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1801, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1801);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1802, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1802);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1803, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1803);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1804, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1804);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1805, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1805);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1806, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1806);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1807, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1807);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1808, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1808);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1809, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1809);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1810, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1810);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1811, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1811);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1812, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1812);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1813, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1813);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1814, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1814);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1815, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1815);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1816, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1816);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1817, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1817);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1818, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1818);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1819, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1819);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1820, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1820);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1821, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1821);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1822, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1822);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1823, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1823);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1824, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1824);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1825, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1825);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1826, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1826);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1827, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1827);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1828, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1828);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1829, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1829);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1830, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1830);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1831, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1831);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1832, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1832);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1833, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1833);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1834, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1834);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1835, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1835);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1836, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1836);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1837, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1837);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1838, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1838);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1839, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1839);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1840, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1840);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1841, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1841);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1842, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1842);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1843, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1843);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1844, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1844);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1845, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1845);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1846, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1846);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1847, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1847);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1848, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1848);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1849, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1849);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1850, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1850);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1851, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1851);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1852, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1852);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1853, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1853);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1854, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1854);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1855, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1855);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1856, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1856);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1857, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1857);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1858, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1858);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1859, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1859);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1860, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1860);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1861, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1861);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1862, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1862);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1863, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1863);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1864, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1864);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1865, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1865);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1866, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1866);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1867, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1867);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1868, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1868);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1869, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1869);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1870, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1870);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1871, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1871);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1872, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1872);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1873, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1873);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1874, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1874);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1875, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1875);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1876, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1876);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1877, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1877);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1878, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1878);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1879, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1879);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1880, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1880);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1881, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1881);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1882, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1882);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1883, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1883);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1884, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1884);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1885, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1885);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1886, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1886);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1887, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1887);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1888, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1888);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1889, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1889);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1890, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1890);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1891, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1891);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1892, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1892);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1893, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1893);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1894, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1894);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1895, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1895);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1896, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1896);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1897, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1897);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1898, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1898);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1899, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1899);
+
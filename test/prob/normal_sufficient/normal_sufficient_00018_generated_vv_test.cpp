@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/normal_sufficient/normal_sufficient_test.hpp>
+
+typedef std::tuple<var, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, var, empty> type_vv_1800;
+typedef std::tuple<var, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty> type_vv_1801;
+typedef std::tuple<var, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_1802;
+typedef std::tuple<var, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty> type_vv_1803;
+typedef std::tuple<var, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty> type_vv_1804;
+typedef std::tuple<var, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_1805;
+typedef std::tuple<var, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty> type_vv_1806;
+typedef std::tuple<var, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty> type_vv_1807;
+typedef std::tuple<var, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_1808;
+typedef std::tuple<var, std::vector<double>, int, double, double, empty> type_vv_1809;
+typedef std::tuple<var, std::vector<double>, int, double, std::vector<double>, empty> type_vv_1810;
+typedef std::tuple<var, std::vector<double>, int, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_1811;
+typedef std::tuple<var, std::vector<double>, int, double, var, empty> type_vv_1812;
+typedef std::tuple<var, std::vector<double>, int, double, std::vector<var>, empty> type_vv_1813;
+typedef std::tuple<var, std::vector<double>, int, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_1814;
+typedef std::tuple<var, std::vector<double>, int, std::vector<double>, double, empty> type_vv_1815;
+typedef std::tuple<var, std::vector<double>, int, std::vector<double>, std::vector<double>, empty> type_vv_1816;
+typedef std::tuple<var, std::vector<double>, int, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_1817;
+typedef std::tuple<var, std::vector<double>, int, std::vector<double>, var, empty> type_vv_1818;
+typedef std::tuple<var, std::vector<double>, int, std::vector<double>, std::vector<var>, empty> type_vv_1819;
+typedef std::tuple<var, std::vector<double>, int, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_1820;
+typedef std::tuple<var, std::vector<double>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_vv_1821;
+typedef std::tuple<var, std::vector<double>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_vv_1822;
+typedef std::tuple<var, std::vector<double>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_1823;
+typedef std::tuple<var, std::vector<double>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_vv_1824;
+typedef std::tuple<var, std::vector<double>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_vv_1825;
+typedef std::tuple<var, std::vector<double>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_1826;
+typedef std::tuple<var, std::vector<double>, int, var, double, empty> type_vv_1827;
+typedef std::tuple<var, std::vector<double>, int, var, std::vector<double>, empty> type_vv_1828;
+typedef std::tuple<var, std::vector<double>, int, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_1829;
+typedef std::tuple<var, std::vector<double>, int, var, var, empty> type_vv_1830;
+typedef std::tuple<var, std::vector<double>, int, var, std::vector<var>, empty> type_vv_1831;
+typedef std::tuple<var, std::vector<double>, int, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_1832;
+typedef std::tuple<var, std::vector<double>, int, std::vector<var>, double, empty> type_vv_1833;
+typedef std::tuple<var, std::vector<double>, int, std::vector<var>, std::vector<double>, empty> type_vv_1834;
+typedef std::tuple<var, std::vector<double>, int, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_1835;
+typedef std::tuple<var, std::vector<double>, int, std::vector<var>, var, empty> type_vv_1836;
+typedef std::tuple<var, std::vector<double>, int, std::vector<var>, std::vector<var>, empty> type_vv_1837;
+typedef std::tuple<var, std::vector<double>, int, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_1838;
+typedef std::tuple<var, std::vector<double>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty> type_vv_1839;
+typedef std::tuple<var, std::vector<double>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty> type_vv_1840;
+typedef std::tuple<var, std::vector<double>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_1841;
+typedef std::tuple<var, std::vector<double>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty> type_vv_1842;
+typedef std::tuple<var, std::vector<double>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty> type_vv_1843;
+typedef std::tuple<var, std::vector<double>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_1844;
+typedef std::tuple<var, std::vector<double>, std::vector<int>, double, double, empty> type_vv_1845;
+typedef std::tuple<var, std::vector<double>, std::vector<int>, double, std::vector<double>, empty> type_vv_1846;
+typedef std::tuple<var, std::vector<double>, std::vector<int>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_1847;
+typedef std::tuple<var, std::vector<double>, std::vector<int>, double, var, empty> type_vv_1848;
+typedef std::tuple<var, std::vector<double>, std::vector<int>, double, std::vector<var>, empty> type_vv_1849;
+typedef std::tuple<var, std::vector<double>, std::vector<int>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_1850;
+typedef std::tuple<var, std::vector<double>, std::vector<int>, std::vector<double>, double, empty> type_vv_1851;
+typedef std::tuple<var, std::vector<double>, std::vector<int>, std::vector<double>, std::vector<double>, empty> type_vv_1852;
+typedef std::tuple<var, std::vector<double>, std::vector<int>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_1853;
+typedef std::tuple<var, std::vector<double>, std::vector<int>, std::vector<double>, var, empty> type_vv_1854;
+typedef std::tuple<var, std::vector<double>, std::vector<int>, std::vector<double>, std::vector<var>, empty> type_vv_1855;
+typedef std::tuple<var, std::vector<double>, std::vector<int>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_1856;
+typedef std::tuple<var, std::vector<double>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_vv_1857;
+typedef std::tuple<var, std::vector<double>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_vv_1858;
+typedef std::tuple<var, std::vector<double>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_1859;
+typedef std::tuple<var, std::vector<double>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_vv_1860;
+typedef std::tuple<var, std::vector<double>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_vv_1861;
+typedef std::tuple<var, std::vector<double>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_1862;
+typedef std::tuple<var, std::vector<double>, std::vector<int>, var, double, empty> type_vv_1863;
+typedef std::tuple<var, std::vector<double>, std::vector<int>, var, std::vector<double>, empty> type_vv_1864;
+typedef std::tuple<var, std::vector<double>, std::vector<int>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_1865;
+typedef std::tuple<var, std::vector<double>, std::vector<int>, var, var, empty> type_vv_1866;
+typedef std::tuple<var, std::vector<double>, std::vector<int>, var, std::vector<var>, empty> type_vv_1867;
+typedef std::tuple<var, std::vector<double>, std::vector<int>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_1868;
+typedef std::tuple<var, std::vector<double>, std::vector<int>, std::vector<var>, double, empty> type_vv_1869;
+typedef std::tuple<var, std::vector<double>, std::vector<int>, std::vector<var>, std::vector<double>, empty> type_vv_1870;
+typedef std::tuple<var, std::vector<double>, std::vector<int>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_1871;
+typedef std::tuple<var, std::vector<double>, std::vector<int>, std::vector<var>, var, empty> type_vv_1872;
+typedef std::tuple<var, std::vector<double>, std::vector<int>, std::vector<var>, std::vector<var>, empty> type_vv_1873;
+typedef std::tuple<var, std::vector<double>, std::vector<int>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_1874;
+typedef std::tuple<var, std::vector<double>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty> type_vv_1875;
+typedef std::tuple<var, std::vector<double>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty> type_vv_1876;
+typedef std::tuple<var, std::vector<double>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_1877;
+typedef std::tuple<var, std::vector<double>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty> type_vv_1878;
+typedef std::tuple<var, std::vector<double>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty> type_vv_1879;
+typedef std::tuple<var, std::vector<double>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_1880;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, double, empty> type_vv_1881;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_vv_1882;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_1883;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, var, empty> type_vv_1884;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<var>, empty> type_vv_1885;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_1886;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_vv_1887;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_vv_1888;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_1889;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, var, empty> type_vv_1890;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty> type_vv_1891;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_1892;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_vv_1893;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_vv_1894;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_1895;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_vv_1896;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_vv_1897;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_1898;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, double, empty> type_vv_1899;
+
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1800> AgradDistributionNormalSufficient_vv_1800;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1801> AgradDistributionNormalSufficient_vv_1801;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1802> AgradDistributionNormalSufficient_vv_1802;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1803> AgradDistributionNormalSufficient_vv_1803;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1804> AgradDistributionNormalSufficient_vv_1804;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1805> AgradDistributionNormalSufficient_vv_1805;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1806> AgradDistributionNormalSufficient_vv_1806;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1807> AgradDistributionNormalSufficient_vv_1807;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1808> AgradDistributionNormalSufficient_vv_1808;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1809> AgradDistributionNormalSufficient_vv_1809;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1810> AgradDistributionNormalSufficient_vv_1810;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1811> AgradDistributionNormalSufficient_vv_1811;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1812> AgradDistributionNormalSufficient_vv_1812;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1813> AgradDistributionNormalSufficient_vv_1813;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1814> AgradDistributionNormalSufficient_vv_1814;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1815> AgradDistributionNormalSufficient_vv_1815;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1816> AgradDistributionNormalSufficient_vv_1816;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1817> AgradDistributionNormalSufficient_vv_1817;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1818> AgradDistributionNormalSufficient_vv_1818;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1819> AgradDistributionNormalSufficient_vv_1819;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1820> AgradDistributionNormalSufficient_vv_1820;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1821> AgradDistributionNormalSufficient_vv_1821;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1822> AgradDistributionNormalSufficient_vv_1822;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1823> AgradDistributionNormalSufficient_vv_1823;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1824> AgradDistributionNormalSufficient_vv_1824;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1825> AgradDistributionNormalSufficient_vv_1825;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1826> AgradDistributionNormalSufficient_vv_1826;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1827> AgradDistributionNormalSufficient_vv_1827;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1828> AgradDistributionNormalSufficient_vv_1828;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1829> AgradDistributionNormalSufficient_vv_1829;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1830> AgradDistributionNormalSufficient_vv_1830;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1831> AgradDistributionNormalSufficient_vv_1831;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1832> AgradDistributionNormalSufficient_vv_1832;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1833> AgradDistributionNormalSufficient_vv_1833;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1834> AgradDistributionNormalSufficient_vv_1834;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1835> AgradDistributionNormalSufficient_vv_1835;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1836> AgradDistributionNormalSufficient_vv_1836;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1837> AgradDistributionNormalSufficient_vv_1837;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1838> AgradDistributionNormalSufficient_vv_1838;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1839> AgradDistributionNormalSufficient_vv_1839;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1840> AgradDistributionNormalSufficient_vv_1840;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1841> AgradDistributionNormalSufficient_vv_1841;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1842> AgradDistributionNormalSufficient_vv_1842;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1843> AgradDistributionNormalSufficient_vv_1843;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1844> AgradDistributionNormalSufficient_vv_1844;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1845> AgradDistributionNormalSufficient_vv_1845;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1846> AgradDistributionNormalSufficient_vv_1846;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1847> AgradDistributionNormalSufficient_vv_1847;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1848> AgradDistributionNormalSufficient_vv_1848;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1849> AgradDistributionNormalSufficient_vv_1849;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1850> AgradDistributionNormalSufficient_vv_1850;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1851> AgradDistributionNormalSufficient_vv_1851;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1852> AgradDistributionNormalSufficient_vv_1852;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1853> AgradDistributionNormalSufficient_vv_1853;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1854> AgradDistributionNormalSufficient_vv_1854;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1855> AgradDistributionNormalSufficient_vv_1855;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1856> AgradDistributionNormalSufficient_vv_1856;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1857> AgradDistributionNormalSufficient_vv_1857;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1858> AgradDistributionNormalSufficient_vv_1858;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1859> AgradDistributionNormalSufficient_vv_1859;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1860> AgradDistributionNormalSufficient_vv_1860;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1861> AgradDistributionNormalSufficient_vv_1861;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1862> AgradDistributionNormalSufficient_vv_1862;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1863> AgradDistributionNormalSufficient_vv_1863;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1864> AgradDistributionNormalSufficient_vv_1864;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1865> AgradDistributionNormalSufficient_vv_1865;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1866> AgradDistributionNormalSufficient_vv_1866;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1867> AgradDistributionNormalSufficient_vv_1867;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1868> AgradDistributionNormalSufficient_vv_1868;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1869> AgradDistributionNormalSufficient_vv_1869;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1870> AgradDistributionNormalSufficient_vv_1870;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1871> AgradDistributionNormalSufficient_vv_1871;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1872> AgradDistributionNormalSufficient_vv_1872;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1873> AgradDistributionNormalSufficient_vv_1873;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1874> AgradDistributionNormalSufficient_vv_1874;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1875> AgradDistributionNormalSufficient_vv_1875;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1876> AgradDistributionNormalSufficient_vv_1876;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1877> AgradDistributionNormalSufficient_vv_1877;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1878> AgradDistributionNormalSufficient_vv_1878;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1879> AgradDistributionNormalSufficient_vv_1879;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1880> AgradDistributionNormalSufficient_vv_1880;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1881> AgradDistributionNormalSufficient_vv_1881;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1882> AgradDistributionNormalSufficient_vv_1882;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1883> AgradDistributionNormalSufficient_vv_1883;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1884> AgradDistributionNormalSufficient_vv_1884;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1885> AgradDistributionNormalSufficient_vv_1885;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1886> AgradDistributionNormalSufficient_vv_1886;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1887> AgradDistributionNormalSufficient_vv_1887;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1888> AgradDistributionNormalSufficient_vv_1888;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1889> AgradDistributionNormalSufficient_vv_1889;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1890> AgradDistributionNormalSufficient_vv_1890;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1891> AgradDistributionNormalSufficient_vv_1891;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1892> AgradDistributionNormalSufficient_vv_1892;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1893> AgradDistributionNormalSufficient_vv_1893;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1894> AgradDistributionNormalSufficient_vv_1894;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1895> AgradDistributionNormalSufficient_vv_1895;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1896> AgradDistributionNormalSufficient_vv_1896;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1897> AgradDistributionNormalSufficient_vv_1897;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1898> AgradDistributionNormalSufficient_vv_1898;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1899> AgradDistributionNormalSufficient_vv_1899;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1800, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1800);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1801, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1801);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1802, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1802);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1803, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1803);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1804, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1804);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1805, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1805);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1806, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1806);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1807, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1807);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1808, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1808);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1809, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1809);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1810, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1810);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1811, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1811);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1812, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1812);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1813, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1813);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1814, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1814);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1815, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1815);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1816, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1816);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1817, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1817);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1818, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1818);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1819, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1819);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1820, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1820);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1821, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1821);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1822, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1822);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1823, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1823);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1824, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1824);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1825, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1825);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1826, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1826);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1827, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1827);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1828, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1828);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1829, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1829);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1830, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1830);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1831, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1831);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1832, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1832);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1833, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1833);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1834, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1834);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1835, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1835);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1836, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1836);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1837, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1837);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1838, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1838);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1839, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1839);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1840, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1840);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1841, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1841);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1842, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1842);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1843, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1843);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1844, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1844);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1845, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1845);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1846, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1846);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1847, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1847);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1848, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1848);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1849, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1849);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1850, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1850);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1851, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1851);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1852, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1852);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1853, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1853);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1854, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1854);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1855, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1855);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1856, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1856);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1857, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1857);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1858, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1858);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1859, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1859);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1860, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1860);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1861, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1861);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1862, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1862);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1863, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1863);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1864, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1864);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1865, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1865);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1866, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1866);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1867, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1867);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1868, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1868);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1869, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1869);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1870, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1870);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1871, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1871);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1872, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1872);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1873, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1873);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1874, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1874);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1875, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1875);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1876, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1876);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1877, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1877);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1878, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1878);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1879, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1879);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1880, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1880);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1881, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1881);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1882, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1882);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1883, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1883);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1884, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1884);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1885, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1885);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1886, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1886);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1887, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1887);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1888, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1888);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1889, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1889);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1890, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1890);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1891, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1891);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1892, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1892);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1893, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1893);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1894, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1894);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1895, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1895);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1896, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1896);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1897, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1897);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1898, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1898);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1899, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1899);
+
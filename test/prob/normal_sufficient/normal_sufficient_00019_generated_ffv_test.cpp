@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/normal_sufficient/normal_sufficient_test.hpp>
+
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_1900;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1901;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_1902;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_1903;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1904;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_1905;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_1906;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1907;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_1908;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1909;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1910;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_1911;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_1912;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1913;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_1914;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1915;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1916;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, double, double, empty> type_ffv_1917;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, double, std::vector<double>, empty> type_ffv_1918;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1919;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, double, fvar<fvar<var> >, empty> type_ffv_1920;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_1921;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1922;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<double>, double, empty> type_ffv_1923;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<double>, std::vector<double>, empty> type_ffv_1924;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1925;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_1926;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1927;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1928;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffv_1929;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_1930;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1931;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_1932;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1933;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1934;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, fvar<fvar<var> >, double, empty> type_ffv_1935;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_1936;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1937;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_1938;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_1939;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1940;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_1941;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_1942;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1943;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_1944;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1945;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1946;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_1947;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_1948;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1949;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_1950;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1951;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1952;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, double, double, empty> type_ffv_1953;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, double, std::vector<double>, empty> type_ffv_1954;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1955;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, double, fvar<fvar<var> >, empty> type_ffv_1956;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_1957;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1958;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, double, empty> type_ffv_1959;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, std::vector<double>, empty> type_ffv_1960;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1961;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_1962;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1963;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1964;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffv_1965;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_1966;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1967;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_1968;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1969;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1970;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, fvar<fvar<var> >, double, empty> type_ffv_1971;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_1972;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1973;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_1974;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_1975;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1976;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_1977;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_1978;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1979;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_1980;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1981;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1982;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_1983;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_1984;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1985;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_1986;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1987;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1988;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, double, empty> type_ffv_1989;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_ffv_1990;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1991;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty> type_ffv_1992;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_1993;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_1994;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_ffv_1995;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_ffv_1996;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_1997;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_1998;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_1999;
+
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1900> AgradDistributionNormalSufficient_ffv_1900;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1901> AgradDistributionNormalSufficient_ffv_1901;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1902> AgradDistributionNormalSufficient_ffv_1902;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1903> AgradDistributionNormalSufficient_ffv_1903;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1904> AgradDistributionNormalSufficient_ffv_1904;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1905> AgradDistributionNormalSufficient_ffv_1905;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1906> AgradDistributionNormalSufficient_ffv_1906;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1907> AgradDistributionNormalSufficient_ffv_1907;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1908> AgradDistributionNormalSufficient_ffv_1908;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1909> AgradDistributionNormalSufficient_ffv_1909;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1910> AgradDistributionNormalSufficient_ffv_1910;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1911> AgradDistributionNormalSufficient_ffv_1911;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1912> AgradDistributionNormalSufficient_ffv_1912;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1913> AgradDistributionNormalSufficient_ffv_1913;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1914> AgradDistributionNormalSufficient_ffv_1914;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1915> AgradDistributionNormalSufficient_ffv_1915;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1916> AgradDistributionNormalSufficient_ffv_1916;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1917> AgradDistributionNormalSufficient_ffv_1917;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1918> AgradDistributionNormalSufficient_ffv_1918;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1919> AgradDistributionNormalSufficient_ffv_1919;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1920> AgradDistributionNormalSufficient_ffv_1920;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1921> AgradDistributionNormalSufficient_ffv_1921;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1922> AgradDistributionNormalSufficient_ffv_1922;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1923> AgradDistributionNormalSufficient_ffv_1923;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1924> AgradDistributionNormalSufficient_ffv_1924;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1925> AgradDistributionNormalSufficient_ffv_1925;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1926> AgradDistributionNormalSufficient_ffv_1926;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1927> AgradDistributionNormalSufficient_ffv_1927;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1928> AgradDistributionNormalSufficient_ffv_1928;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1929> AgradDistributionNormalSufficient_ffv_1929;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1930> AgradDistributionNormalSufficient_ffv_1930;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1931> AgradDistributionNormalSufficient_ffv_1931;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1932> AgradDistributionNormalSufficient_ffv_1932;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1933> AgradDistributionNormalSufficient_ffv_1933;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1934> AgradDistributionNormalSufficient_ffv_1934;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1935> AgradDistributionNormalSufficient_ffv_1935;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1936> AgradDistributionNormalSufficient_ffv_1936;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1937> AgradDistributionNormalSufficient_ffv_1937;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1938> AgradDistributionNormalSufficient_ffv_1938;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1939> AgradDistributionNormalSufficient_ffv_1939;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1940> AgradDistributionNormalSufficient_ffv_1940;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1941> AgradDistributionNormalSufficient_ffv_1941;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1942> AgradDistributionNormalSufficient_ffv_1942;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1943> AgradDistributionNormalSufficient_ffv_1943;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1944> AgradDistributionNormalSufficient_ffv_1944;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1945> AgradDistributionNormalSufficient_ffv_1945;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1946> AgradDistributionNormalSufficient_ffv_1946;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1947> AgradDistributionNormalSufficient_ffv_1947;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1948> AgradDistributionNormalSufficient_ffv_1948;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1949> AgradDistributionNormalSufficient_ffv_1949;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1950> AgradDistributionNormalSufficient_ffv_1950;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1951> AgradDistributionNormalSufficient_ffv_1951;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1952> AgradDistributionNormalSufficient_ffv_1952;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1953> AgradDistributionNormalSufficient_ffv_1953;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1954> AgradDistributionNormalSufficient_ffv_1954;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1955> AgradDistributionNormalSufficient_ffv_1955;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1956> AgradDistributionNormalSufficient_ffv_1956;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1957> AgradDistributionNormalSufficient_ffv_1957;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1958> AgradDistributionNormalSufficient_ffv_1958;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1959> AgradDistributionNormalSufficient_ffv_1959;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1960> AgradDistributionNormalSufficient_ffv_1960;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1961> AgradDistributionNormalSufficient_ffv_1961;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1962> AgradDistributionNormalSufficient_ffv_1962;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1963> AgradDistributionNormalSufficient_ffv_1963;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1964> AgradDistributionNormalSufficient_ffv_1964;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1965> AgradDistributionNormalSufficient_ffv_1965;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1966> AgradDistributionNormalSufficient_ffv_1966;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1967> AgradDistributionNormalSufficient_ffv_1967;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1968> AgradDistributionNormalSufficient_ffv_1968;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1969> AgradDistributionNormalSufficient_ffv_1969;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1970> AgradDistributionNormalSufficient_ffv_1970;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1971> AgradDistributionNormalSufficient_ffv_1971;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1972> AgradDistributionNormalSufficient_ffv_1972;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1973> AgradDistributionNormalSufficient_ffv_1973;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1974> AgradDistributionNormalSufficient_ffv_1974;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1975> AgradDistributionNormalSufficient_ffv_1975;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1976> AgradDistributionNormalSufficient_ffv_1976;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1977> AgradDistributionNormalSufficient_ffv_1977;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1978> AgradDistributionNormalSufficient_ffv_1978;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1979> AgradDistributionNormalSufficient_ffv_1979;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1980> AgradDistributionNormalSufficient_ffv_1980;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1981> AgradDistributionNormalSufficient_ffv_1981;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1982> AgradDistributionNormalSufficient_ffv_1982;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1983> AgradDistributionNormalSufficient_ffv_1983;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1984> AgradDistributionNormalSufficient_ffv_1984;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1985> AgradDistributionNormalSufficient_ffv_1985;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1986> AgradDistributionNormalSufficient_ffv_1986;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1987> AgradDistributionNormalSufficient_ffv_1987;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1988> AgradDistributionNormalSufficient_ffv_1988;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1989> AgradDistributionNormalSufficient_ffv_1989;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1990> AgradDistributionNormalSufficient_ffv_1990;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1991> AgradDistributionNormalSufficient_ffv_1991;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1992> AgradDistributionNormalSufficient_ffv_1992;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1993> AgradDistributionNormalSufficient_ffv_1993;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1994> AgradDistributionNormalSufficient_ffv_1994;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1995> AgradDistributionNormalSufficient_ffv_1995;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1996> AgradDistributionNormalSufficient_ffv_1996;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1997> AgradDistributionNormalSufficient_ffv_1997;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1998> AgradDistributionNormalSufficient_ffv_1998;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_1999> AgradDistributionNormalSufficient_ffv_1999;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1900, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1900);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1901, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1901);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1902, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1902);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1903, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1903);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1904, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1904);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1905, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1905);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1906, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1906);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1907, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1907);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1908, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1908);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1909, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1909);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1910, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1910);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1911, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1911);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1912, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1912);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1913, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1913);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1914, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1914);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1915, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1915);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1916, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1916);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1917, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1917);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1918, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1918);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1919, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1919);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1920, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1920);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1921, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1921);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1922, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1922);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1923, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1923);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1924, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1924);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1925, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1925);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1926, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1926);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1927, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1927);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1928, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1928);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1929, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1929);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1930, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1930);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1931, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1931);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1932, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1932);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1933, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1933);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1934, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1934);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1935, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1935);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1936, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1936);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1937, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1937);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1938, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1938);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1939, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1939);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1940, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1940);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1941, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1941);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1942, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1942);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1943, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1943);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1944, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1944);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1945, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1945);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1946, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1946);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1947, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1947);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1948, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1948);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1949, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1949);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1950, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1950);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1951, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1951);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1952, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1952);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1953, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1953);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1954, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1954);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1955, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1955);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1956, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1956);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1957, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1957);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1958, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1958);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1959, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1959);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1960, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1960);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1961, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1961);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1962, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1962);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1963, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1963);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1964, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1964);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1965, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1965);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1966, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1966);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1967, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1967);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1968, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1968);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1969, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1969);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1970, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1970);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1971, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1971);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1972, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1972);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1973, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1973);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1974, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1974);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1975, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1975);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1976, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1976);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1977, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1977);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1978, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1978);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1979, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1979);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1980, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1980);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1981, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1981);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1982, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1982);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1983, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1983);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1984, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1984);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1985, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1985);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1986, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1986);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1987, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1987);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1988, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1988);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1989, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1989);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1990, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1990);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1991, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1991);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1992, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1992);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1993, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1993);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1994, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1994);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1995, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1995);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1996, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1996);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1997, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1997);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1998, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1998);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_1999, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_1999);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/normal_sufficient/normal_sufficient_test.hpp>
+
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<double>, empty> type_vv_1900;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_1901;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, var, empty> type_vv_1902;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<var>, empty> type_vv_1903;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_1904;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, double, empty> type_vv_1905;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty> type_vv_1906;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_1907;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, var, empty> type_vv_1908;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty> type_vv_1909;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_1910;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty> type_vv_1911;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty> type_vv_1912;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_1913;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty> type_vv_1914;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty> type_vv_1915;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_1916;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, double, double, empty> type_vv_1917;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, double, std::vector<double>, empty> type_vv_1918;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_1919;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, double, var, empty> type_vv_1920;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, double, std::vector<var>, empty> type_vv_1921;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_1922;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<double>, double, empty> type_vv_1923;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<double>, std::vector<double>, empty> type_vv_1924;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_1925;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<double>, var, empty> type_vv_1926;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<double>, std::vector<var>, empty> type_vv_1927;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_1928;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_vv_1929;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_vv_1930;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_1931;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_vv_1932;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_vv_1933;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_1934;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, var, double, empty> type_vv_1935;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, var, std::vector<double>, empty> type_vv_1936;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_1937;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, var, var, empty> type_vv_1938;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, var, std::vector<var>, empty> type_vv_1939;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_1940;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<var>, double, empty> type_vv_1941;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<var>, std::vector<double>, empty> type_vv_1942;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_1943;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<var>, var, empty> type_vv_1944;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<var>, std::vector<var>, empty> type_vv_1945;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_1946;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty> type_vv_1947;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty> type_vv_1948;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_1949;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty> type_vv_1950;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty> type_vv_1951;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_1952;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, double, double, empty> type_vv_1953;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, double, std::vector<double>, empty> type_vv_1954;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_1955;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, double, var, empty> type_vv_1956;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, double, std::vector<var>, empty> type_vv_1957;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_1958;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, double, empty> type_vv_1959;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, std::vector<double>, empty> type_vv_1960;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_1961;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, var, empty> type_vv_1962;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, std::vector<var>, empty> type_vv_1963;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_1964;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_vv_1965;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_vv_1966;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_1967;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_vv_1968;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_vv_1969;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_1970;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, var, double, empty> type_vv_1971;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, var, std::vector<double>, empty> type_vv_1972;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_1973;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, var, var, empty> type_vv_1974;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, var, std::vector<var>, empty> type_vv_1975;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_1976;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<var>, double, empty> type_vv_1977;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<var>, std::vector<double>, empty> type_vv_1978;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_1979;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<var>, var, empty> type_vv_1980;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<var>, std::vector<var>, empty> type_vv_1981;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_1982;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty> type_vv_1983;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty> type_vv_1984;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_1985;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty> type_vv_1986;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty> type_vv_1987;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_1988;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, double, empty> type_vv_1989;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_vv_1990;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_1991;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, var, empty> type_vv_1992;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<var>, empty> type_vv_1993;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_1994;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_vv_1995;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_vv_1996;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_1997;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, var, empty> type_vv_1998;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty> type_vv_1999;
+
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1900> AgradDistributionNormalSufficient_vv_1900;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1901> AgradDistributionNormalSufficient_vv_1901;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1902> AgradDistributionNormalSufficient_vv_1902;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1903> AgradDistributionNormalSufficient_vv_1903;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1904> AgradDistributionNormalSufficient_vv_1904;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1905> AgradDistributionNormalSufficient_vv_1905;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1906> AgradDistributionNormalSufficient_vv_1906;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1907> AgradDistributionNormalSufficient_vv_1907;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1908> AgradDistributionNormalSufficient_vv_1908;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1909> AgradDistributionNormalSufficient_vv_1909;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1910> AgradDistributionNormalSufficient_vv_1910;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1911> AgradDistributionNormalSufficient_vv_1911;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1912> AgradDistributionNormalSufficient_vv_1912;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1913> AgradDistributionNormalSufficient_vv_1913;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1914> AgradDistributionNormalSufficient_vv_1914;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1915> AgradDistributionNormalSufficient_vv_1915;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1916> AgradDistributionNormalSufficient_vv_1916;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1917> AgradDistributionNormalSufficient_vv_1917;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1918> AgradDistributionNormalSufficient_vv_1918;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1919> AgradDistributionNormalSufficient_vv_1919;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1920> AgradDistributionNormalSufficient_vv_1920;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1921> AgradDistributionNormalSufficient_vv_1921;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1922> AgradDistributionNormalSufficient_vv_1922;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1923> AgradDistributionNormalSufficient_vv_1923;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1924> AgradDistributionNormalSufficient_vv_1924;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1925> AgradDistributionNormalSufficient_vv_1925;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1926> AgradDistributionNormalSufficient_vv_1926;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1927> AgradDistributionNormalSufficient_vv_1927;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1928> AgradDistributionNormalSufficient_vv_1928;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1929> AgradDistributionNormalSufficient_vv_1929;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1930> AgradDistributionNormalSufficient_vv_1930;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1931> AgradDistributionNormalSufficient_vv_1931;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1932> AgradDistributionNormalSufficient_vv_1932;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1933> AgradDistributionNormalSufficient_vv_1933;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1934> AgradDistributionNormalSufficient_vv_1934;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1935> AgradDistributionNormalSufficient_vv_1935;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1936> AgradDistributionNormalSufficient_vv_1936;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1937> AgradDistributionNormalSufficient_vv_1937;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1938> AgradDistributionNormalSufficient_vv_1938;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1939> AgradDistributionNormalSufficient_vv_1939;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1940> AgradDistributionNormalSufficient_vv_1940;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1941> AgradDistributionNormalSufficient_vv_1941;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1942> AgradDistributionNormalSufficient_vv_1942;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1943> AgradDistributionNormalSufficient_vv_1943;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1944> AgradDistributionNormalSufficient_vv_1944;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1945> AgradDistributionNormalSufficient_vv_1945;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1946> AgradDistributionNormalSufficient_vv_1946;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1947> AgradDistributionNormalSufficient_vv_1947;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1948> AgradDistributionNormalSufficient_vv_1948;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1949> AgradDistributionNormalSufficient_vv_1949;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1950> AgradDistributionNormalSufficient_vv_1950;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1951> AgradDistributionNormalSufficient_vv_1951;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1952> AgradDistributionNormalSufficient_vv_1952;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1953> AgradDistributionNormalSufficient_vv_1953;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1954> AgradDistributionNormalSufficient_vv_1954;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1955> AgradDistributionNormalSufficient_vv_1955;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1956> AgradDistributionNormalSufficient_vv_1956;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1957> AgradDistributionNormalSufficient_vv_1957;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1958> AgradDistributionNormalSufficient_vv_1958;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1959> AgradDistributionNormalSufficient_vv_1959;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1960> AgradDistributionNormalSufficient_vv_1960;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1961> AgradDistributionNormalSufficient_vv_1961;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1962> AgradDistributionNormalSufficient_vv_1962;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1963> AgradDistributionNormalSufficient_vv_1963;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1964> AgradDistributionNormalSufficient_vv_1964;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1965> AgradDistributionNormalSufficient_vv_1965;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1966> AgradDistributionNormalSufficient_vv_1966;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1967> AgradDistributionNormalSufficient_vv_1967;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1968> AgradDistributionNormalSufficient_vv_1968;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1969> AgradDistributionNormalSufficient_vv_1969;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1970> AgradDistributionNormalSufficient_vv_1970;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1971> AgradDistributionNormalSufficient_vv_1971;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1972> AgradDistributionNormalSufficient_vv_1972;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1973> AgradDistributionNormalSufficient_vv_1973;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1974> AgradDistributionNormalSufficient_vv_1974;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1975> AgradDistributionNormalSufficient_vv_1975;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1976> AgradDistributionNormalSufficient_vv_1976;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1977> AgradDistributionNormalSufficient_vv_1977;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1978> AgradDistributionNormalSufficient_vv_1978;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1979> AgradDistributionNormalSufficient_vv_1979;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1980> AgradDistributionNormalSufficient_vv_1980;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1981> AgradDistributionNormalSufficient_vv_1981;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1982> AgradDistributionNormalSufficient_vv_1982;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1983> AgradDistributionNormalSufficient_vv_1983;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1984> AgradDistributionNormalSufficient_vv_1984;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1985> AgradDistributionNormalSufficient_vv_1985;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1986> AgradDistributionNormalSufficient_vv_1986;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1987> AgradDistributionNormalSufficient_vv_1987;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1988> AgradDistributionNormalSufficient_vv_1988;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1989> AgradDistributionNormalSufficient_vv_1989;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1990> AgradDistributionNormalSufficient_vv_1990;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1991> AgradDistributionNormalSufficient_vv_1991;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1992> AgradDistributionNormalSufficient_vv_1992;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1993> AgradDistributionNormalSufficient_vv_1993;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1994> AgradDistributionNormalSufficient_vv_1994;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1995> AgradDistributionNormalSufficient_vv_1995;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1996> AgradDistributionNormalSufficient_vv_1996;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1997> AgradDistributionNormalSufficient_vv_1997;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1998> AgradDistributionNormalSufficient_vv_1998;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_1999> AgradDistributionNormalSufficient_vv_1999;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1900, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1900);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1901, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1901);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1902, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1902);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1903, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1903);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1904, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1904);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1905, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1905);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1906, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1906);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1907, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1907);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1908, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1908);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1909, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1909);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1910, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1910);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1911, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1911);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1912, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1912);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1913, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1913);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1914, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1914);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1915, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1915);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1916, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1916);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1917, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1917);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1918, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1918);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1919, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1919);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1920, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1920);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1921, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1921);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1922, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1922);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1923, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1923);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1924, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1924);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1925, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1925);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1926, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1926);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1927, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1927);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1928, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1928);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1929, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1929);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1930, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1930);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1931, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1931);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1932, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1932);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1933, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1933);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1934, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1934);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1935, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1935);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1936, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1936);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1937, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1937);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1938, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1938);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1939, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1939);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1940, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1940);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1941, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1941);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1942, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1942);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1943, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1943);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1944, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1944);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1945, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1945);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1946, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1946);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1947, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1947);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1948, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1948);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1949, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1949);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1950, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1950);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1951, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1951);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1952, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1952);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1953, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1953);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1954, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1954);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1955, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1955);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1956, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1956);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1957, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1957);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1958, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1958);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1959, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1959);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1960, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1960);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1961, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1961);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1962, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1962);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1963, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1963);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1964, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1964);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1965, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1965);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1966, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1966);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1967, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1967);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1968, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1968);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1969, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1969);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1970, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1970);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1971, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1971);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1972, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1972);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1973, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1973);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1974, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1974);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1975, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1975);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1976, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1976);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1977, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1977);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1978, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1978);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1979, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1979);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1980, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1980);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1981, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1981);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1982, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1982);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1983, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1983);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1984, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1984);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1985, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1985);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1986, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1986);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1987, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1987);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1988, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1988);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1989, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1989);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1990, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1990);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1991, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1991);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1992, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1992);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1993, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1993);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1994, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1994);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1995, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1995);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1996, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1996);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1997, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1997);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1998, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1998);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_1999, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_1999);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/normal_sufficient/normal_sufficient_test.hpp>
+
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2000;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffv_2001;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_2002;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2003;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_2004;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_2005;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2006;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty> type_ffv_2007;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_2008;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2009;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_2010;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_2011;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2012;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_2013;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_2014;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2015;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_2016;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_2017;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2018;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_2019;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_2020;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2021;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_2022;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_2023;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2024;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, int, double, double, empty> type_ffv_2025;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, int, double, std::vector<double>, empty> type_ffv_2026;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, int, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2027;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, int, double, fvar<fvar<var> >, empty> type_ffv_2028;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, int, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_2029;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, int, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2030;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, int, std::vector<double>, double, empty> type_ffv_2031;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, int, std::vector<double>, std::vector<double>, empty> type_ffv_2032;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, int, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2033;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, int, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_2034;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, int, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_2035;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, int, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2036;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffv_2037;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_2038;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2039;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_2040;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_2041;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2042;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, int, fvar<fvar<var> >, double, empty> type_ffv_2043;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, int, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_2044;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, int, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2045;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, int, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_2046;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, int, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_2047;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, int, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2048;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, int, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_2049;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, int, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_2050;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2051;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, int, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_2052;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, int, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_2053;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2054;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_2055;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_2056;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2057;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_2058;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_2059;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2060;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<int>, double, double, empty> type_ffv_2061;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<int>, double, std::vector<double>, empty> type_ffv_2062;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<int>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2063;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<int>, double, fvar<fvar<var> >, empty> type_ffv_2064;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<int>, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_2065;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<int>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2066;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<int>, std::vector<double>, double, empty> type_ffv_2067;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<int>, std::vector<double>, std::vector<double>, empty> type_ffv_2068;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<int>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2069;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<int>, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_2070;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<int>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_2071;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<int>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2072;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffv_2073;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_2074;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2075;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_2076;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_2077;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2078;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<int>, fvar<fvar<var> >, double, empty> type_ffv_2079;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<int>, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_2080;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2081;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<int>, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_2082;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<int>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_2083;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2084;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<int>, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_2085;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_2086;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2087;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<int>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_2088;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_2089;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2090;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_2091;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_2092;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2093;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_2094;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_2095;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2096;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, double, empty> type_ffv_2097;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_ffv_2098;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2099;
+
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2000> AgradDistributionNormalSufficient_ffv_2000;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2001> AgradDistributionNormalSufficient_ffv_2001;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2002> AgradDistributionNormalSufficient_ffv_2002;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2003> AgradDistributionNormalSufficient_ffv_2003;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2004> AgradDistributionNormalSufficient_ffv_2004;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2005> AgradDistributionNormalSufficient_ffv_2005;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2006> AgradDistributionNormalSufficient_ffv_2006;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2007> AgradDistributionNormalSufficient_ffv_2007;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2008> AgradDistributionNormalSufficient_ffv_2008;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2009> AgradDistributionNormalSufficient_ffv_2009;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2010> AgradDistributionNormalSufficient_ffv_2010;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2011> AgradDistributionNormalSufficient_ffv_2011;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2012> AgradDistributionNormalSufficient_ffv_2012;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2013> AgradDistributionNormalSufficient_ffv_2013;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2014> AgradDistributionNormalSufficient_ffv_2014;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2015> AgradDistributionNormalSufficient_ffv_2015;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2016> AgradDistributionNormalSufficient_ffv_2016;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2017> AgradDistributionNormalSufficient_ffv_2017;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2018> AgradDistributionNormalSufficient_ffv_2018;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2019> AgradDistributionNormalSufficient_ffv_2019;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2020> AgradDistributionNormalSufficient_ffv_2020;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2021> AgradDistributionNormalSufficient_ffv_2021;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2022> AgradDistributionNormalSufficient_ffv_2022;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2023> AgradDistributionNormalSufficient_ffv_2023;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2024> AgradDistributionNormalSufficient_ffv_2024;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2025> AgradDistributionNormalSufficient_ffv_2025;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2026> AgradDistributionNormalSufficient_ffv_2026;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2027> AgradDistributionNormalSufficient_ffv_2027;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2028> AgradDistributionNormalSufficient_ffv_2028;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2029> AgradDistributionNormalSufficient_ffv_2029;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2030> AgradDistributionNormalSufficient_ffv_2030;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2031> AgradDistributionNormalSufficient_ffv_2031;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2032> AgradDistributionNormalSufficient_ffv_2032;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2033> AgradDistributionNormalSufficient_ffv_2033;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2034> AgradDistributionNormalSufficient_ffv_2034;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2035> AgradDistributionNormalSufficient_ffv_2035;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2036> AgradDistributionNormalSufficient_ffv_2036;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2037> AgradDistributionNormalSufficient_ffv_2037;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2038> AgradDistributionNormalSufficient_ffv_2038;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2039> AgradDistributionNormalSufficient_ffv_2039;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2040> AgradDistributionNormalSufficient_ffv_2040;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2041> AgradDistributionNormalSufficient_ffv_2041;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2042> AgradDistributionNormalSufficient_ffv_2042;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2043> AgradDistributionNormalSufficient_ffv_2043;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2044> AgradDistributionNormalSufficient_ffv_2044;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2045> AgradDistributionNormalSufficient_ffv_2045;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2046> AgradDistributionNormalSufficient_ffv_2046;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2047> AgradDistributionNormalSufficient_ffv_2047;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2048> AgradDistributionNormalSufficient_ffv_2048;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2049> AgradDistributionNormalSufficient_ffv_2049;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2050> AgradDistributionNormalSufficient_ffv_2050;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2051> AgradDistributionNormalSufficient_ffv_2051;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2052> AgradDistributionNormalSufficient_ffv_2052;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2053> AgradDistributionNormalSufficient_ffv_2053;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2054> AgradDistributionNormalSufficient_ffv_2054;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2055> AgradDistributionNormalSufficient_ffv_2055;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2056> AgradDistributionNormalSufficient_ffv_2056;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2057> AgradDistributionNormalSufficient_ffv_2057;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2058> AgradDistributionNormalSufficient_ffv_2058;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2059> AgradDistributionNormalSufficient_ffv_2059;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2060> AgradDistributionNormalSufficient_ffv_2060;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2061> AgradDistributionNormalSufficient_ffv_2061;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2062> AgradDistributionNormalSufficient_ffv_2062;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2063> AgradDistributionNormalSufficient_ffv_2063;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2064> AgradDistributionNormalSufficient_ffv_2064;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2065> AgradDistributionNormalSufficient_ffv_2065;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2066> AgradDistributionNormalSufficient_ffv_2066;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2067> AgradDistributionNormalSufficient_ffv_2067;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2068> AgradDistributionNormalSufficient_ffv_2068;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2069> AgradDistributionNormalSufficient_ffv_2069;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2070> AgradDistributionNormalSufficient_ffv_2070;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2071> AgradDistributionNormalSufficient_ffv_2071;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2072> AgradDistributionNormalSufficient_ffv_2072;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2073> AgradDistributionNormalSufficient_ffv_2073;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2074> AgradDistributionNormalSufficient_ffv_2074;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2075> AgradDistributionNormalSufficient_ffv_2075;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2076> AgradDistributionNormalSufficient_ffv_2076;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2077> AgradDistributionNormalSufficient_ffv_2077;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2078> AgradDistributionNormalSufficient_ffv_2078;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2079> AgradDistributionNormalSufficient_ffv_2079;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2080> AgradDistributionNormalSufficient_ffv_2080;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2081> AgradDistributionNormalSufficient_ffv_2081;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2082> AgradDistributionNormalSufficient_ffv_2082;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2083> AgradDistributionNormalSufficient_ffv_2083;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2084> AgradDistributionNormalSufficient_ffv_2084;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2085> AgradDistributionNormalSufficient_ffv_2085;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2086> AgradDistributionNormalSufficient_ffv_2086;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2087> AgradDistributionNormalSufficient_ffv_2087;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2088> AgradDistributionNormalSufficient_ffv_2088;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2089> AgradDistributionNormalSufficient_ffv_2089;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2090> AgradDistributionNormalSufficient_ffv_2090;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2091> AgradDistributionNormalSufficient_ffv_2091;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2092> AgradDistributionNormalSufficient_ffv_2092;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2093> AgradDistributionNormalSufficient_ffv_2093;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2094> AgradDistributionNormalSufficient_ffv_2094;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2095> AgradDistributionNormalSufficient_ffv_2095;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2096> AgradDistributionNormalSufficient_ffv_2096;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2097> AgradDistributionNormalSufficient_ffv_2097;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2098> AgradDistributionNormalSufficient_ffv_2098;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2099> AgradDistributionNormalSufficient_ffv_2099;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2000, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2000);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2001, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2001);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2002, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2002);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2003, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2003);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2004, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2004);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2005, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2005);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2006, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2006);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2007, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2007);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2008, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2008);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2009, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2009);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2010, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2010);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2011, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2011);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2012, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2012);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2013, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2013);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2014, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2014);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2015, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2015);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2016, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2016);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2017, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2017);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2018, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2018);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2019, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2019);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2020, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2020);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2021, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2021);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2022, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2022);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2023, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2023);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2024, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2024);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2025, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2025);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2026, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2026);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2027, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2027);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2028, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2028);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2029, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2029);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2030, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2030);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2031, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2031);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2032, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2032);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2033, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2033);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2034, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2034);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2035, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2035);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2036, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2036);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2037, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2037);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2038, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2038);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2039, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2039);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2040, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2040);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2041, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2041);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2042, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2042);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2043, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2043);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2044, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2044);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2045, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2045);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2046, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2046);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2047, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2047);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2048, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2048);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2049, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2049);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2050, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2050);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2051, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2051);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2052, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2052);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2053, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2053);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2054, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2054);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2055, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2055);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2056, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2056);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2057, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2057);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2058, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2058);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2059, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2059);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2060, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2060);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2061, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2061);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2062, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2062);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2063, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2063);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2064, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2064);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2065, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2065);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2066, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2066);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2067, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2067);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2068, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2068);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2069, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2069);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2070, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2070);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2071, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2071);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2072, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2072);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2073, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2073);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2074, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2074);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2075, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2075);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2076, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2076);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2077, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2077);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2078, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2078);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2079, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2079);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2080, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2080);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2081, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2081);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2082, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2082);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2083, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2083);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2084, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2084);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2085, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2085);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2086, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2086);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2087, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2087);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2088, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2088);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2089, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2089);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2090, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2090);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2091, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2091);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2092, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2092);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2093, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2093);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2094, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2094);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2095, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2095);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2096, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2096);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2097, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2097);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2098, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2098);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2099, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2099);
+
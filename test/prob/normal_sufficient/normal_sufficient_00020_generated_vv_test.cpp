@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/normal_sufficient/normal_sufficient_test.hpp>
+
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_2000;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_vv_2001;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_vv_2002;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_2003;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_vv_2004;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_vv_2005;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_2006;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, double, empty> type_vv_2007;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<double>, empty> type_vv_2008;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_2009;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, var, empty> type_vv_2010;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<var>, empty> type_vv_2011;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_2012;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, double, empty> type_vv_2013;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty> type_vv_2014;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_2015;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, var, empty> type_vv_2016;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty> type_vv_2017;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_2018;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty> type_vv_2019;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty> type_vv_2020;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_2021;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty> type_vv_2022;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty> type_vv_2023;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_2024;
+typedef std::tuple<var, var, int, double, double, empty> type_vv_2025;
+typedef std::tuple<var, var, int, double, std::vector<double>, empty> type_vv_2026;
+typedef std::tuple<var, var, int, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_2027;
+typedef std::tuple<var, var, int, double, var, empty> type_vv_2028;
+typedef std::tuple<var, var, int, double, std::vector<var>, empty> type_vv_2029;
+typedef std::tuple<var, var, int, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_2030;
+typedef std::tuple<var, var, int, std::vector<double>, double, empty> type_vv_2031;
+typedef std::tuple<var, var, int, std::vector<double>, std::vector<double>, empty> type_vv_2032;
+typedef std::tuple<var, var, int, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_2033;
+typedef std::tuple<var, var, int, std::vector<double>, var, empty> type_vv_2034;
+typedef std::tuple<var, var, int, std::vector<double>, std::vector<var>, empty> type_vv_2035;
+typedef std::tuple<var, var, int, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_2036;
+typedef std::tuple<var, var, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_vv_2037;
+typedef std::tuple<var, var, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_vv_2038;
+typedef std::tuple<var, var, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_2039;
+typedef std::tuple<var, var, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_vv_2040;
+typedef std::tuple<var, var, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_vv_2041;
+typedef std::tuple<var, var, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_2042;
+typedef std::tuple<var, var, int, var, double, empty> type_vv_2043;
+typedef std::tuple<var, var, int, var, std::vector<double>, empty> type_vv_2044;
+typedef std::tuple<var, var, int, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_2045;
+typedef std::tuple<var, var, int, var, var, empty> type_vv_2046;
+typedef std::tuple<var, var, int, var, std::vector<var>, empty> type_vv_2047;
+typedef std::tuple<var, var, int, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_2048;
+typedef std::tuple<var, var, int, std::vector<var>, double, empty> type_vv_2049;
+typedef std::tuple<var, var, int, std::vector<var>, std::vector<double>, empty> type_vv_2050;
+typedef std::tuple<var, var, int, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_2051;
+typedef std::tuple<var, var, int, std::vector<var>, var, empty> type_vv_2052;
+typedef std::tuple<var, var, int, std::vector<var>, std::vector<var>, empty> type_vv_2053;
+typedef std::tuple<var, var, int, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_2054;
+typedef std::tuple<var, var, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty> type_vv_2055;
+typedef std::tuple<var, var, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty> type_vv_2056;
+typedef std::tuple<var, var, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_2057;
+typedef std::tuple<var, var, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty> type_vv_2058;
+typedef std::tuple<var, var, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty> type_vv_2059;
+typedef std::tuple<var, var, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_2060;
+typedef std::tuple<var, var, std::vector<int>, double, double, empty> type_vv_2061;
+typedef std::tuple<var, var, std::vector<int>, double, std::vector<double>, empty> type_vv_2062;
+typedef std::tuple<var, var, std::vector<int>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_2063;
+typedef std::tuple<var, var, std::vector<int>, double, var, empty> type_vv_2064;
+typedef std::tuple<var, var, std::vector<int>, double, std::vector<var>, empty> type_vv_2065;
+typedef std::tuple<var, var, std::vector<int>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_2066;
+typedef std::tuple<var, var, std::vector<int>, std::vector<double>, double, empty> type_vv_2067;
+typedef std::tuple<var, var, std::vector<int>, std::vector<double>, std::vector<double>, empty> type_vv_2068;
+typedef std::tuple<var, var, std::vector<int>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_2069;
+typedef std::tuple<var, var, std::vector<int>, std::vector<double>, var, empty> type_vv_2070;
+typedef std::tuple<var, var, std::vector<int>, std::vector<double>, std::vector<var>, empty> type_vv_2071;
+typedef std::tuple<var, var, std::vector<int>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_2072;
+typedef std::tuple<var, var, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_vv_2073;
+typedef std::tuple<var, var, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_vv_2074;
+typedef std::tuple<var, var, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_2075;
+typedef std::tuple<var, var, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_vv_2076;
+typedef std::tuple<var, var, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_vv_2077;
+typedef std::tuple<var, var, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_2078;
+typedef std::tuple<var, var, std::vector<int>, var, double, empty> type_vv_2079;
+typedef std::tuple<var, var, std::vector<int>, var, std::vector<double>, empty> type_vv_2080;
+typedef std::tuple<var, var, std::vector<int>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_2081;
+typedef std::tuple<var, var, std::vector<int>, var, var, empty> type_vv_2082;
+typedef std::tuple<var, var, std::vector<int>, var, std::vector<var>, empty> type_vv_2083;
+typedef std::tuple<var, var, std::vector<int>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_2084;
+typedef std::tuple<var, var, std::vector<int>, std::vector<var>, double, empty> type_vv_2085;
+typedef std::tuple<var, var, std::vector<int>, std::vector<var>, std::vector<double>, empty> type_vv_2086;
+typedef std::tuple<var, var, std::vector<int>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_2087;
+typedef std::tuple<var, var, std::vector<int>, std::vector<var>, var, empty> type_vv_2088;
+typedef std::tuple<var, var, std::vector<int>, std::vector<var>, std::vector<var>, empty> type_vv_2089;
+typedef std::tuple<var, var, std::vector<int>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_2090;
+typedef std::tuple<var, var, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty> type_vv_2091;
+typedef std::tuple<var, var, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty> type_vv_2092;
+typedef std::tuple<var, var, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_2093;
+typedef std::tuple<var, var, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty> type_vv_2094;
+typedef std::tuple<var, var, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty> type_vv_2095;
+typedef std::tuple<var, var, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_2096;
+typedef std::tuple<var, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, double, empty> type_vv_2097;
+typedef std::tuple<var, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_vv_2098;
+typedef std::tuple<var, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_2099;
+
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2000> AgradDistributionNormalSufficient_vv_2000;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2001> AgradDistributionNormalSufficient_vv_2001;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2002> AgradDistributionNormalSufficient_vv_2002;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2003> AgradDistributionNormalSufficient_vv_2003;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2004> AgradDistributionNormalSufficient_vv_2004;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2005> AgradDistributionNormalSufficient_vv_2005;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2006> AgradDistributionNormalSufficient_vv_2006;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2007> AgradDistributionNormalSufficient_vv_2007;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2008> AgradDistributionNormalSufficient_vv_2008;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2009> AgradDistributionNormalSufficient_vv_2009;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2010> AgradDistributionNormalSufficient_vv_2010;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2011> AgradDistributionNormalSufficient_vv_2011;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2012> AgradDistributionNormalSufficient_vv_2012;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2013> AgradDistributionNormalSufficient_vv_2013;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2014> AgradDistributionNormalSufficient_vv_2014;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2015> AgradDistributionNormalSufficient_vv_2015;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2016> AgradDistributionNormalSufficient_vv_2016;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2017> AgradDistributionNormalSufficient_vv_2017;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2018> AgradDistributionNormalSufficient_vv_2018;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2019> AgradDistributionNormalSufficient_vv_2019;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2020> AgradDistributionNormalSufficient_vv_2020;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2021> AgradDistributionNormalSufficient_vv_2021;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2022> AgradDistributionNormalSufficient_vv_2022;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2023> AgradDistributionNormalSufficient_vv_2023;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2024> AgradDistributionNormalSufficient_vv_2024;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2025> AgradDistributionNormalSufficient_vv_2025;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2026> AgradDistributionNormalSufficient_vv_2026;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2027> AgradDistributionNormalSufficient_vv_2027;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2028> AgradDistributionNormalSufficient_vv_2028;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2029> AgradDistributionNormalSufficient_vv_2029;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2030> AgradDistributionNormalSufficient_vv_2030;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2031> AgradDistributionNormalSufficient_vv_2031;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2032> AgradDistributionNormalSufficient_vv_2032;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2033> AgradDistributionNormalSufficient_vv_2033;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2034> AgradDistributionNormalSufficient_vv_2034;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2035> AgradDistributionNormalSufficient_vv_2035;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2036> AgradDistributionNormalSufficient_vv_2036;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2037> AgradDistributionNormalSufficient_vv_2037;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2038> AgradDistributionNormalSufficient_vv_2038;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2039> AgradDistributionNormalSufficient_vv_2039;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2040> AgradDistributionNormalSufficient_vv_2040;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2041> AgradDistributionNormalSufficient_vv_2041;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2042> AgradDistributionNormalSufficient_vv_2042;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2043> AgradDistributionNormalSufficient_vv_2043;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2044> AgradDistributionNormalSufficient_vv_2044;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2045> AgradDistributionNormalSufficient_vv_2045;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2046> AgradDistributionNormalSufficient_vv_2046;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2047> AgradDistributionNormalSufficient_vv_2047;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2048> AgradDistributionNormalSufficient_vv_2048;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2049> AgradDistributionNormalSufficient_vv_2049;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2050> AgradDistributionNormalSufficient_vv_2050;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2051> AgradDistributionNormalSufficient_vv_2051;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2052> AgradDistributionNormalSufficient_vv_2052;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2053> AgradDistributionNormalSufficient_vv_2053;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2054> AgradDistributionNormalSufficient_vv_2054;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2055> AgradDistributionNormalSufficient_vv_2055;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2056> AgradDistributionNormalSufficient_vv_2056;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2057> AgradDistributionNormalSufficient_vv_2057;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2058> AgradDistributionNormalSufficient_vv_2058;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2059> AgradDistributionNormalSufficient_vv_2059;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2060> AgradDistributionNormalSufficient_vv_2060;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2061> AgradDistributionNormalSufficient_vv_2061;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2062> AgradDistributionNormalSufficient_vv_2062;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2063> AgradDistributionNormalSufficient_vv_2063;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2064> AgradDistributionNormalSufficient_vv_2064;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2065> AgradDistributionNormalSufficient_vv_2065;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2066> AgradDistributionNormalSufficient_vv_2066;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2067> AgradDistributionNormalSufficient_vv_2067;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2068> AgradDistributionNormalSufficient_vv_2068;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2069> AgradDistributionNormalSufficient_vv_2069;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2070> AgradDistributionNormalSufficient_vv_2070;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2071> AgradDistributionNormalSufficient_vv_2071;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2072> AgradDistributionNormalSufficient_vv_2072;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2073> AgradDistributionNormalSufficient_vv_2073;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2074> AgradDistributionNormalSufficient_vv_2074;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2075> AgradDistributionNormalSufficient_vv_2075;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2076> AgradDistributionNormalSufficient_vv_2076;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2077> AgradDistributionNormalSufficient_vv_2077;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2078> AgradDistributionNormalSufficient_vv_2078;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2079> AgradDistributionNormalSufficient_vv_2079;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2080> AgradDistributionNormalSufficient_vv_2080;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2081> AgradDistributionNormalSufficient_vv_2081;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2082> AgradDistributionNormalSufficient_vv_2082;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2083> AgradDistributionNormalSufficient_vv_2083;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2084> AgradDistributionNormalSufficient_vv_2084;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2085> AgradDistributionNormalSufficient_vv_2085;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2086> AgradDistributionNormalSufficient_vv_2086;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2087> AgradDistributionNormalSufficient_vv_2087;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2088> AgradDistributionNormalSufficient_vv_2088;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2089> AgradDistributionNormalSufficient_vv_2089;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2090> AgradDistributionNormalSufficient_vv_2090;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2091> AgradDistributionNormalSufficient_vv_2091;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2092> AgradDistributionNormalSufficient_vv_2092;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2093> AgradDistributionNormalSufficient_vv_2093;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2094> AgradDistributionNormalSufficient_vv_2094;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2095> AgradDistributionNormalSufficient_vv_2095;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2096> AgradDistributionNormalSufficient_vv_2096;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2097> AgradDistributionNormalSufficient_vv_2097;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2098> AgradDistributionNormalSufficient_vv_2098;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2099> AgradDistributionNormalSufficient_vv_2099;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2000, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2000);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2001, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2001);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2002, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2002);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2003, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2003);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2004, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2004);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2005, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2005);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2006, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2006);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2007, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2007);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2008, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2008);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2009, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2009);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2010, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2010);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2011, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2011);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2012, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2012);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2013, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2013);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2014, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2014);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2015, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2015);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2016, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2016);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2017, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2017);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2018, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2018);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2019, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2019);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2020, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2020);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2021, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2021);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2022, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2022);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2023, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2023);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2024, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2024);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2025, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2025);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2026, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2026);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2027, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2027);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2028, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2028);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2029, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2029);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2030, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2030);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2031, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2031);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2032, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2032);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2033, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2033);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2034, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2034);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2035, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2035);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2036, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2036);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2037, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2037);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2038, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2038);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2039, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2039);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2040, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2040);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2041, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2041);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2042, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2042);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2043, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2043);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2044, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2044);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2045, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2045);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2046, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2046);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2047, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2047);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2048, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2048);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2049, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2049);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2050, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2050);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2051, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2051);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2052, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2052);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2053, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2053);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2054, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2054);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2055, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2055);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2056, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2056);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2057, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2057);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2058, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2058);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2059, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2059);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2060, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2060);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2061, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2061);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2062, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2062);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2063, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2063);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2064, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2064);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2065, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2065);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2066, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2066);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2067, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2067);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2068, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2068);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2069, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2069);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2070, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2070);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2071, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2071);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2072, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2072);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2073, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2073);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2074, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2074);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2075, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2075);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2076, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2076);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2077, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2077);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2078, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2078);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2079, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2079);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2080, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2080);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2081, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2081);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2082, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2082);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2083, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2083);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2084, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2084);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2085, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2085);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2086, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2086);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2087, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2087);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2088, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2088);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2089, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2089);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2090, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2090);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2091, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2091);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2092, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2092);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2093, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2093);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2094, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2094);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2095, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2095);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2096, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2096);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2097, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2097);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2098, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2098);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2099, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2099);
+
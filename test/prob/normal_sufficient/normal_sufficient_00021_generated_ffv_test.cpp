@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/normal_sufficient/normal_sufficient_test.hpp>
+
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty> type_ffv_2100;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_2101;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2102;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_ffv_2103;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_ffv_2104;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2105;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_2106;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_2107;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2108;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffv_2109;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_2110;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2111;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_2112;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_2113;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2114;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty> type_ffv_2115;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_2116;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2117;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_2118;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_2119;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2120;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_2121;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_2122;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2123;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_2124;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_2125;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2126;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_2127;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_2128;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2129;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_2130;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_2131;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2132;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, int, double, double, empty> type_ffv_2133;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, int, double, std::vector<double>, empty> type_ffv_2134;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, int, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2135;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, int, double, fvar<fvar<var> >, empty> type_ffv_2136;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, int, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_2137;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, int, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2138;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, int, std::vector<double>, double, empty> type_ffv_2139;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, int, std::vector<double>, std::vector<double>, empty> type_ffv_2140;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, int, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2141;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, int, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_2142;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, int, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_2143;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, int, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2144;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffv_2145;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_2146;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2147;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_2148;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_2149;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2150;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, int, fvar<fvar<var> >, double, empty> type_ffv_2151;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, int, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_2152;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, int, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2153;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, int, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_2154;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, int, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_2155;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, int, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2156;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, int, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_2157;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, int, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_2158;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2159;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, int, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_2160;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, int, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_2161;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2162;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_2163;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_2164;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2165;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_2166;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_2167;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2168;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<int>, double, double, empty> type_ffv_2169;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<int>, double, std::vector<double>, empty> type_ffv_2170;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<int>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2171;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<int>, double, fvar<fvar<var> >, empty> type_ffv_2172;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<int>, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_2173;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<int>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2174;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<int>, std::vector<double>, double, empty> type_ffv_2175;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<int>, std::vector<double>, std::vector<double>, empty> type_ffv_2176;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<int>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2177;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<int>, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_2178;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<int>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_2179;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<int>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2180;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffv_2181;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_2182;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2183;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_2184;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_2185;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2186;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<int>, fvar<fvar<var> >, double, empty> type_ffv_2187;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<int>, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_2188;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2189;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<int>, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_2190;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<int>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_2191;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2192;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<int>, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_2193;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_2194;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2195;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<int>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_2196;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_2197;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2198;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_2199;
+
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2100> AgradDistributionNormalSufficient_ffv_2100;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2101> AgradDistributionNormalSufficient_ffv_2101;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2102> AgradDistributionNormalSufficient_ffv_2102;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2103> AgradDistributionNormalSufficient_ffv_2103;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2104> AgradDistributionNormalSufficient_ffv_2104;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2105> AgradDistributionNormalSufficient_ffv_2105;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2106> AgradDistributionNormalSufficient_ffv_2106;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2107> AgradDistributionNormalSufficient_ffv_2107;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2108> AgradDistributionNormalSufficient_ffv_2108;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2109> AgradDistributionNormalSufficient_ffv_2109;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2110> AgradDistributionNormalSufficient_ffv_2110;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2111> AgradDistributionNormalSufficient_ffv_2111;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2112> AgradDistributionNormalSufficient_ffv_2112;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2113> AgradDistributionNormalSufficient_ffv_2113;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2114> AgradDistributionNormalSufficient_ffv_2114;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2115> AgradDistributionNormalSufficient_ffv_2115;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2116> AgradDistributionNormalSufficient_ffv_2116;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2117> AgradDistributionNormalSufficient_ffv_2117;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2118> AgradDistributionNormalSufficient_ffv_2118;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2119> AgradDistributionNormalSufficient_ffv_2119;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2120> AgradDistributionNormalSufficient_ffv_2120;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2121> AgradDistributionNormalSufficient_ffv_2121;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2122> AgradDistributionNormalSufficient_ffv_2122;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2123> AgradDistributionNormalSufficient_ffv_2123;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2124> AgradDistributionNormalSufficient_ffv_2124;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2125> AgradDistributionNormalSufficient_ffv_2125;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2126> AgradDistributionNormalSufficient_ffv_2126;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2127> AgradDistributionNormalSufficient_ffv_2127;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2128> AgradDistributionNormalSufficient_ffv_2128;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2129> AgradDistributionNormalSufficient_ffv_2129;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2130> AgradDistributionNormalSufficient_ffv_2130;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2131> AgradDistributionNormalSufficient_ffv_2131;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2132> AgradDistributionNormalSufficient_ffv_2132;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2133> AgradDistributionNormalSufficient_ffv_2133;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2134> AgradDistributionNormalSufficient_ffv_2134;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2135> AgradDistributionNormalSufficient_ffv_2135;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2136> AgradDistributionNormalSufficient_ffv_2136;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2137> AgradDistributionNormalSufficient_ffv_2137;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2138> AgradDistributionNormalSufficient_ffv_2138;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2139> AgradDistributionNormalSufficient_ffv_2139;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2140> AgradDistributionNormalSufficient_ffv_2140;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2141> AgradDistributionNormalSufficient_ffv_2141;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2142> AgradDistributionNormalSufficient_ffv_2142;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2143> AgradDistributionNormalSufficient_ffv_2143;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2144> AgradDistributionNormalSufficient_ffv_2144;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2145> AgradDistributionNormalSufficient_ffv_2145;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2146> AgradDistributionNormalSufficient_ffv_2146;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2147> AgradDistributionNormalSufficient_ffv_2147;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2148> AgradDistributionNormalSufficient_ffv_2148;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2149> AgradDistributionNormalSufficient_ffv_2149;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2150> AgradDistributionNormalSufficient_ffv_2150;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2151> AgradDistributionNormalSufficient_ffv_2151;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2152> AgradDistributionNormalSufficient_ffv_2152;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2153> AgradDistributionNormalSufficient_ffv_2153;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2154> AgradDistributionNormalSufficient_ffv_2154;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2155> AgradDistributionNormalSufficient_ffv_2155;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2156> AgradDistributionNormalSufficient_ffv_2156;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2157> AgradDistributionNormalSufficient_ffv_2157;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2158> AgradDistributionNormalSufficient_ffv_2158;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2159> AgradDistributionNormalSufficient_ffv_2159;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2160> AgradDistributionNormalSufficient_ffv_2160;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2161> AgradDistributionNormalSufficient_ffv_2161;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2162> AgradDistributionNormalSufficient_ffv_2162;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2163> AgradDistributionNormalSufficient_ffv_2163;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2164> AgradDistributionNormalSufficient_ffv_2164;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2165> AgradDistributionNormalSufficient_ffv_2165;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2166> AgradDistributionNormalSufficient_ffv_2166;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2167> AgradDistributionNormalSufficient_ffv_2167;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2168> AgradDistributionNormalSufficient_ffv_2168;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2169> AgradDistributionNormalSufficient_ffv_2169;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2170> AgradDistributionNormalSufficient_ffv_2170;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2171> AgradDistributionNormalSufficient_ffv_2171;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2172> AgradDistributionNormalSufficient_ffv_2172;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2173> AgradDistributionNormalSufficient_ffv_2173;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2174> AgradDistributionNormalSufficient_ffv_2174;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2175> AgradDistributionNormalSufficient_ffv_2175;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2176> AgradDistributionNormalSufficient_ffv_2176;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2177> AgradDistributionNormalSufficient_ffv_2177;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2178> AgradDistributionNormalSufficient_ffv_2178;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2179> AgradDistributionNormalSufficient_ffv_2179;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2180> AgradDistributionNormalSufficient_ffv_2180;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2181> AgradDistributionNormalSufficient_ffv_2181;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2182> AgradDistributionNormalSufficient_ffv_2182;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2183> AgradDistributionNormalSufficient_ffv_2183;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2184> AgradDistributionNormalSufficient_ffv_2184;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2185> AgradDistributionNormalSufficient_ffv_2185;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2186> AgradDistributionNormalSufficient_ffv_2186;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2187> AgradDistributionNormalSufficient_ffv_2187;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2188> AgradDistributionNormalSufficient_ffv_2188;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2189> AgradDistributionNormalSufficient_ffv_2189;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2190> AgradDistributionNormalSufficient_ffv_2190;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2191> AgradDistributionNormalSufficient_ffv_2191;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2192> AgradDistributionNormalSufficient_ffv_2192;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2193> AgradDistributionNormalSufficient_ffv_2193;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2194> AgradDistributionNormalSufficient_ffv_2194;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2195> AgradDistributionNormalSufficient_ffv_2195;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2196> AgradDistributionNormalSufficient_ffv_2196;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2197> AgradDistributionNormalSufficient_ffv_2197;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2198> AgradDistributionNormalSufficient_ffv_2198;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2199> AgradDistributionNormalSufficient_ffv_2199;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2100, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2101, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2102, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2103, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2104, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2105, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2106, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2107, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2108, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2109, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2110, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2111, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2112, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2113, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2114, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2115, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2116, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2117, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2118, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2119, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2120, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2121, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2122, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2123, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2124, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2125, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2126, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2127, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2128, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2129, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2130, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2131, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2132, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2133, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2134, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2135, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2136, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2137, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2138, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2139, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2140, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2141, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2142, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2143, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2144, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2145, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2146, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2147, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2148, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2149, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2150, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2151, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2152, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2153, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2154, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2155, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2156, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2157, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2158, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2159, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2160, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2161, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2162, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2163, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2164, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2165, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2166, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2167, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2168, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2169, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2170, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2171, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2172, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2173, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2174, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2175, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2176, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2177, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2178, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2179, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2180, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2181, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2182, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2183, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2184, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2185, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2186, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2187, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2188, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2188);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2189, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2189);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2190, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2190);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2191, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2191);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2192, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2192);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2193, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2193);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2194, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2194);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2195, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2195);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2196, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2196);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2197, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2197);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2198, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2198);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2199, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2199);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/normal_sufficient/normal_sufficient_test.hpp>
+
+typedef std::tuple<var, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, var, empty> type_vv_2100;
+typedef std::tuple<var, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<var>, empty> type_vv_2101;
+typedef std::tuple<var, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_2102;
+typedef std::tuple<var, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_vv_2103;
+typedef std::tuple<var, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_vv_2104;
+typedef std::tuple<var, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_2105;
+typedef std::tuple<var, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, var, empty> type_vv_2106;
+typedef std::tuple<var, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty> type_vv_2107;
+typedef std::tuple<var, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_2108;
+typedef std::tuple<var, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_vv_2109;
+typedef std::tuple<var, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_vv_2110;
+typedef std::tuple<var, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_2111;
+typedef std::tuple<var, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_vv_2112;
+typedef std::tuple<var, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_vv_2113;
+typedef std::tuple<var, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_2114;
+typedef std::tuple<var, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, double, empty> type_vv_2115;
+typedef std::tuple<var, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<double>, empty> type_vv_2116;
+typedef std::tuple<var, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_2117;
+typedef std::tuple<var, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, var, empty> type_vv_2118;
+typedef std::tuple<var, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<var>, empty> type_vv_2119;
+typedef std::tuple<var, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_2120;
+typedef std::tuple<var, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, double, empty> type_vv_2121;
+typedef std::tuple<var, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty> type_vv_2122;
+typedef std::tuple<var, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_2123;
+typedef std::tuple<var, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, var, empty> type_vv_2124;
+typedef std::tuple<var, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty> type_vv_2125;
+typedef std::tuple<var, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_2126;
+typedef std::tuple<var, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty> type_vv_2127;
+typedef std::tuple<var, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty> type_vv_2128;
+typedef std::tuple<var, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_2129;
+typedef std::tuple<var, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty> type_vv_2130;
+typedef std::tuple<var, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty> type_vv_2131;
+typedef std::tuple<var, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_2132;
+typedef std::tuple<var, std::vector<var>, int, double, double, empty> type_vv_2133;
+typedef std::tuple<var, std::vector<var>, int, double, std::vector<double>, empty> type_vv_2134;
+typedef std::tuple<var, std::vector<var>, int, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_2135;
+typedef std::tuple<var, std::vector<var>, int, double, var, empty> type_vv_2136;
+typedef std::tuple<var, std::vector<var>, int, double, std::vector<var>, empty> type_vv_2137;
+typedef std::tuple<var, std::vector<var>, int, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_2138;
+typedef std::tuple<var, std::vector<var>, int, std::vector<double>, double, empty> type_vv_2139;
+typedef std::tuple<var, std::vector<var>, int, std::vector<double>, std::vector<double>, empty> type_vv_2140;
+typedef std::tuple<var, std::vector<var>, int, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_2141;
+typedef std::tuple<var, std::vector<var>, int, std::vector<double>, var, empty> type_vv_2142;
+typedef std::tuple<var, std::vector<var>, int, std::vector<double>, std::vector<var>, empty> type_vv_2143;
+typedef std::tuple<var, std::vector<var>, int, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_2144;
+typedef std::tuple<var, std::vector<var>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_vv_2145;
+typedef std::tuple<var, std::vector<var>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_vv_2146;
+typedef std::tuple<var, std::vector<var>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_2147;
+typedef std::tuple<var, std::vector<var>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_vv_2148;
+typedef std::tuple<var, std::vector<var>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_vv_2149;
+typedef std::tuple<var, std::vector<var>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_2150;
+typedef std::tuple<var, std::vector<var>, int, var, double, empty> type_vv_2151;
+typedef std::tuple<var, std::vector<var>, int, var, std::vector<double>, empty> type_vv_2152;
+typedef std::tuple<var, std::vector<var>, int, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_2153;
+typedef std::tuple<var, std::vector<var>, int, var, var, empty> type_vv_2154;
+typedef std::tuple<var, std::vector<var>, int, var, std::vector<var>, empty> type_vv_2155;
+typedef std::tuple<var, std::vector<var>, int, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_2156;
+typedef std::tuple<var, std::vector<var>, int, std::vector<var>, double, empty> type_vv_2157;
+typedef std::tuple<var, std::vector<var>, int, std::vector<var>, std::vector<double>, empty> type_vv_2158;
+typedef std::tuple<var, std::vector<var>, int, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_2159;
+typedef std::tuple<var, std::vector<var>, int, std::vector<var>, var, empty> type_vv_2160;
+typedef std::tuple<var, std::vector<var>, int, std::vector<var>, std::vector<var>, empty> type_vv_2161;
+typedef std::tuple<var, std::vector<var>, int, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_2162;
+typedef std::tuple<var, std::vector<var>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty> type_vv_2163;
+typedef std::tuple<var, std::vector<var>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty> type_vv_2164;
+typedef std::tuple<var, std::vector<var>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_2165;
+typedef std::tuple<var, std::vector<var>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty> type_vv_2166;
+typedef std::tuple<var, std::vector<var>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty> type_vv_2167;
+typedef std::tuple<var, std::vector<var>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_2168;
+typedef std::tuple<var, std::vector<var>, std::vector<int>, double, double, empty> type_vv_2169;
+typedef std::tuple<var, std::vector<var>, std::vector<int>, double, std::vector<double>, empty> type_vv_2170;
+typedef std::tuple<var, std::vector<var>, std::vector<int>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_2171;
+typedef std::tuple<var, std::vector<var>, std::vector<int>, double, var, empty> type_vv_2172;
+typedef std::tuple<var, std::vector<var>, std::vector<int>, double, std::vector<var>, empty> type_vv_2173;
+typedef std::tuple<var, std::vector<var>, std::vector<int>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_2174;
+typedef std::tuple<var, std::vector<var>, std::vector<int>, std::vector<double>, double, empty> type_vv_2175;
+typedef std::tuple<var, std::vector<var>, std::vector<int>, std::vector<double>, std::vector<double>, empty> type_vv_2176;
+typedef std::tuple<var, std::vector<var>, std::vector<int>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_2177;
+typedef std::tuple<var, std::vector<var>, std::vector<int>, std::vector<double>, var, empty> type_vv_2178;
+typedef std::tuple<var, std::vector<var>, std::vector<int>, std::vector<double>, std::vector<var>, empty> type_vv_2179;
+typedef std::tuple<var, std::vector<var>, std::vector<int>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_2180;
+typedef std::tuple<var, std::vector<var>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_vv_2181;
+typedef std::tuple<var, std::vector<var>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_vv_2182;
+typedef std::tuple<var, std::vector<var>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_2183;
+typedef std::tuple<var, std::vector<var>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_vv_2184;
+typedef std::tuple<var, std::vector<var>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_vv_2185;
+typedef std::tuple<var, std::vector<var>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_2186;
+typedef std::tuple<var, std::vector<var>, std::vector<int>, var, double, empty> type_vv_2187;
+typedef std::tuple<var, std::vector<var>, std::vector<int>, var, std::vector<double>, empty> type_vv_2188;
+typedef std::tuple<var, std::vector<var>, std::vector<int>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_2189;
+typedef std::tuple<var, std::vector<var>, std::vector<int>, var, var, empty> type_vv_2190;
+typedef std::tuple<var, std::vector<var>, std::vector<int>, var, std::vector<var>, empty> type_vv_2191;
+typedef std::tuple<var, std::vector<var>, std::vector<int>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_2192;
+typedef std::tuple<var, std::vector<var>, std::vector<int>, std::vector<var>, double, empty> type_vv_2193;
+typedef std::tuple<var, std::vector<var>, std::vector<int>, std::vector<var>, std::vector<double>, empty> type_vv_2194;
+typedef std::tuple<var, std::vector<var>, std::vector<int>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_2195;
+typedef std::tuple<var, std::vector<var>, std::vector<int>, std::vector<var>, var, empty> type_vv_2196;
+typedef std::tuple<var, std::vector<var>, std::vector<int>, std::vector<var>, std::vector<var>, empty> type_vv_2197;
+typedef std::tuple<var, std::vector<var>, std::vector<int>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_2198;
+typedef std::tuple<var, std::vector<var>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty> type_vv_2199;
+
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2100> AgradDistributionNormalSufficient_vv_2100;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2101> AgradDistributionNormalSufficient_vv_2101;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2102> AgradDistributionNormalSufficient_vv_2102;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2103> AgradDistributionNormalSufficient_vv_2103;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2104> AgradDistributionNormalSufficient_vv_2104;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2105> AgradDistributionNormalSufficient_vv_2105;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2106> AgradDistributionNormalSufficient_vv_2106;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2107> AgradDistributionNormalSufficient_vv_2107;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2108> AgradDistributionNormalSufficient_vv_2108;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2109> AgradDistributionNormalSufficient_vv_2109;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2110> AgradDistributionNormalSufficient_vv_2110;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2111> AgradDistributionNormalSufficient_vv_2111;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2112> AgradDistributionNormalSufficient_vv_2112;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2113> AgradDistributionNormalSufficient_vv_2113;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2114> AgradDistributionNormalSufficient_vv_2114;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2115> AgradDistributionNormalSufficient_vv_2115;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2116> AgradDistributionNormalSufficient_vv_2116;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2117> AgradDistributionNormalSufficient_vv_2117;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2118> AgradDistributionNormalSufficient_vv_2118;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2119> AgradDistributionNormalSufficient_vv_2119;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2120> AgradDistributionNormalSufficient_vv_2120;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2121> AgradDistributionNormalSufficient_vv_2121;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2122> AgradDistributionNormalSufficient_vv_2122;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2123> AgradDistributionNormalSufficient_vv_2123;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2124> AgradDistributionNormalSufficient_vv_2124;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2125> AgradDistributionNormalSufficient_vv_2125;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2126> AgradDistributionNormalSufficient_vv_2126;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2127> AgradDistributionNormalSufficient_vv_2127;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2128> AgradDistributionNormalSufficient_vv_2128;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2129> AgradDistributionNormalSufficient_vv_2129;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2130> AgradDistributionNormalSufficient_vv_2130;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2131> AgradDistributionNormalSufficient_vv_2131;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2132> AgradDistributionNormalSufficient_vv_2132;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2133> AgradDistributionNormalSufficient_vv_2133;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2134> AgradDistributionNormalSufficient_vv_2134;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2135> AgradDistributionNormalSufficient_vv_2135;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2136> AgradDistributionNormalSufficient_vv_2136;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2137> AgradDistributionNormalSufficient_vv_2137;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2138> AgradDistributionNormalSufficient_vv_2138;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2139> AgradDistributionNormalSufficient_vv_2139;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2140> AgradDistributionNormalSufficient_vv_2140;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2141> AgradDistributionNormalSufficient_vv_2141;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2142> AgradDistributionNormalSufficient_vv_2142;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2143> AgradDistributionNormalSufficient_vv_2143;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2144> AgradDistributionNormalSufficient_vv_2144;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2145> AgradDistributionNormalSufficient_vv_2145;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2146> AgradDistributionNormalSufficient_vv_2146;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2147> AgradDistributionNormalSufficient_vv_2147;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2148> AgradDistributionNormalSufficient_vv_2148;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2149> AgradDistributionNormalSufficient_vv_2149;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2150> AgradDistributionNormalSufficient_vv_2150;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2151> AgradDistributionNormalSufficient_vv_2151;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2152> AgradDistributionNormalSufficient_vv_2152;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2153> AgradDistributionNormalSufficient_vv_2153;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2154> AgradDistributionNormalSufficient_vv_2154;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2155> AgradDistributionNormalSufficient_vv_2155;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2156> AgradDistributionNormalSufficient_vv_2156;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2157> AgradDistributionNormalSufficient_vv_2157;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2158> AgradDistributionNormalSufficient_vv_2158;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2159> AgradDistributionNormalSufficient_vv_2159;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2160> AgradDistributionNormalSufficient_vv_2160;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2161> AgradDistributionNormalSufficient_vv_2161;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2162> AgradDistributionNormalSufficient_vv_2162;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2163> AgradDistributionNormalSufficient_vv_2163;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2164> AgradDistributionNormalSufficient_vv_2164;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2165> AgradDistributionNormalSufficient_vv_2165;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2166> AgradDistributionNormalSufficient_vv_2166;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2167> AgradDistributionNormalSufficient_vv_2167;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2168> AgradDistributionNormalSufficient_vv_2168;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2169> AgradDistributionNormalSufficient_vv_2169;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2170> AgradDistributionNormalSufficient_vv_2170;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2171> AgradDistributionNormalSufficient_vv_2171;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2172> AgradDistributionNormalSufficient_vv_2172;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2173> AgradDistributionNormalSufficient_vv_2173;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2174> AgradDistributionNormalSufficient_vv_2174;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2175> AgradDistributionNormalSufficient_vv_2175;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2176> AgradDistributionNormalSufficient_vv_2176;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2177> AgradDistributionNormalSufficient_vv_2177;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2178> AgradDistributionNormalSufficient_vv_2178;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2179> AgradDistributionNormalSufficient_vv_2179;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2180> AgradDistributionNormalSufficient_vv_2180;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2181> AgradDistributionNormalSufficient_vv_2181;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2182> AgradDistributionNormalSufficient_vv_2182;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2183> AgradDistributionNormalSufficient_vv_2183;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2184> AgradDistributionNormalSufficient_vv_2184;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2185> AgradDistributionNormalSufficient_vv_2185;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2186> AgradDistributionNormalSufficient_vv_2186;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2187> AgradDistributionNormalSufficient_vv_2187;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2188> AgradDistributionNormalSufficient_vv_2188;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2189> AgradDistributionNormalSufficient_vv_2189;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2190> AgradDistributionNormalSufficient_vv_2190;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2191> AgradDistributionNormalSufficient_vv_2191;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2192> AgradDistributionNormalSufficient_vv_2192;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2193> AgradDistributionNormalSufficient_vv_2193;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2194> AgradDistributionNormalSufficient_vv_2194;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2195> AgradDistributionNormalSufficient_vv_2195;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2196> AgradDistributionNormalSufficient_vv_2196;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2197> AgradDistributionNormalSufficient_vv_2197;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2198> AgradDistributionNormalSufficient_vv_2198;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2199> AgradDistributionNormalSufficient_vv_2199;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2100, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2101, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2102, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2103, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2104, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2105, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2106, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2107, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2108, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2109, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2110, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2111, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2112, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2113, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2114, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2115, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2116, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2117, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2118, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2119, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2120, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2121, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2122, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2123, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2124, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2125, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2126, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2127, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2128, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2129, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2130, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2131, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2132, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2133, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2134, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2135, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2136, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2137, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2138, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2139, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2140, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2141, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2142, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2143, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2144, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2145, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2146, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2147, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2148, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2149, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2150, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2151, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2152, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2153, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2154, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2155, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2156, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2157, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2158, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2159, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2160, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2161, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2162, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2163, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2164, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2165, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2166, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2167, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2168, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2169, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2170, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2171, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2172, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2173, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2174, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2175, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2176, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2177, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2178, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2179, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2180, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2181, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2182, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2183, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2184, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2185, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2186, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2187, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2188, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2188);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2189, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2189);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2190, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2190);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2191, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2191);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2192, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2192);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2193, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2193);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2194, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2194);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2195, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2195);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2196, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2196);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2197, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2197);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2198, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2198);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2199, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2199);
+
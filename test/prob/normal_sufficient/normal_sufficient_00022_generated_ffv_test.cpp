@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/normal_sufficient/normal_sufficient_test.hpp>
+
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_2200;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2201;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_2202;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_2203;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2204;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, double, empty> type_ffv_2205;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_ffv_2206;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2207;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty> type_ffv_2208;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_2209;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2210;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_ffv_2211;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_ffv_2212;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2213;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_2214;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_2215;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2216;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffv_2217;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_2218;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2219;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_2220;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_2221;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2222;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty> type_ffv_2223;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_2224;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2225;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_2226;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_2227;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2228;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_2229;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_2230;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2231;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_2232;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_2233;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2234;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_2235;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_2236;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2237;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_2238;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_2239;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2240;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, int, double, double, empty> type_ffv_2241;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, int, double, std::vector<double>, empty> type_ffv_2242;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, int, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2243;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, int, double, fvar<fvar<var> >, empty> type_ffv_2244;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, int, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_2245;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, int, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2246;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, int, std::vector<double>, double, empty> type_ffv_2247;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, int, std::vector<double>, std::vector<double>, empty> type_ffv_2248;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, int, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2249;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, int, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_2250;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, int, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_2251;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, int, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2252;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffv_2253;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_2254;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2255;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_2256;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_2257;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2258;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, int, fvar<fvar<var> >, double, empty> type_ffv_2259;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, int, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_2260;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, int, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2261;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, int, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_2262;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, int, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_2263;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, int, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2264;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, int, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_2265;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, int, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_2266;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2267;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, int, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_2268;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, int, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_2269;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2270;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_2271;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_2272;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2273;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_2274;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_2275;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2276;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<int>, double, double, empty> type_ffv_2277;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<int>, double, std::vector<double>, empty> type_ffv_2278;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<int>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2279;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<int>, double, fvar<fvar<var> >, empty> type_ffv_2280;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<int>, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_2281;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<int>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2282;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, double, empty> type_ffv_2283;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, std::vector<double>, empty> type_ffv_2284;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2285;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_2286;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_2287;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2288;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffv_2289;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_2290;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2291;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_2292;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_2293;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2294;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<int>, fvar<fvar<var> >, double, empty> type_ffv_2295;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<int>, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_2296;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2297;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<int>, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_2298;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<int>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_2299;
+
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2200> AgradDistributionNormalSufficient_ffv_2200;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2201> AgradDistributionNormalSufficient_ffv_2201;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2202> AgradDistributionNormalSufficient_ffv_2202;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2203> AgradDistributionNormalSufficient_ffv_2203;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2204> AgradDistributionNormalSufficient_ffv_2204;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2205> AgradDistributionNormalSufficient_ffv_2205;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2206> AgradDistributionNormalSufficient_ffv_2206;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2207> AgradDistributionNormalSufficient_ffv_2207;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2208> AgradDistributionNormalSufficient_ffv_2208;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2209> AgradDistributionNormalSufficient_ffv_2209;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2210> AgradDistributionNormalSufficient_ffv_2210;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2211> AgradDistributionNormalSufficient_ffv_2211;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2212> AgradDistributionNormalSufficient_ffv_2212;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2213> AgradDistributionNormalSufficient_ffv_2213;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2214> AgradDistributionNormalSufficient_ffv_2214;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2215> AgradDistributionNormalSufficient_ffv_2215;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2216> AgradDistributionNormalSufficient_ffv_2216;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2217> AgradDistributionNormalSufficient_ffv_2217;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2218> AgradDistributionNormalSufficient_ffv_2218;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2219> AgradDistributionNormalSufficient_ffv_2219;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2220> AgradDistributionNormalSufficient_ffv_2220;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2221> AgradDistributionNormalSufficient_ffv_2221;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2222> AgradDistributionNormalSufficient_ffv_2222;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2223> AgradDistributionNormalSufficient_ffv_2223;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2224> AgradDistributionNormalSufficient_ffv_2224;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2225> AgradDistributionNormalSufficient_ffv_2225;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2226> AgradDistributionNormalSufficient_ffv_2226;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2227> AgradDistributionNormalSufficient_ffv_2227;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2228> AgradDistributionNormalSufficient_ffv_2228;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2229> AgradDistributionNormalSufficient_ffv_2229;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2230> AgradDistributionNormalSufficient_ffv_2230;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2231> AgradDistributionNormalSufficient_ffv_2231;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2232> AgradDistributionNormalSufficient_ffv_2232;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2233> AgradDistributionNormalSufficient_ffv_2233;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2234> AgradDistributionNormalSufficient_ffv_2234;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2235> AgradDistributionNormalSufficient_ffv_2235;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2236> AgradDistributionNormalSufficient_ffv_2236;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2237> AgradDistributionNormalSufficient_ffv_2237;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2238> AgradDistributionNormalSufficient_ffv_2238;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2239> AgradDistributionNormalSufficient_ffv_2239;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2240> AgradDistributionNormalSufficient_ffv_2240;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2241> AgradDistributionNormalSufficient_ffv_2241;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2242> AgradDistributionNormalSufficient_ffv_2242;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2243> AgradDistributionNormalSufficient_ffv_2243;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2244> AgradDistributionNormalSufficient_ffv_2244;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2245> AgradDistributionNormalSufficient_ffv_2245;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2246> AgradDistributionNormalSufficient_ffv_2246;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2247> AgradDistributionNormalSufficient_ffv_2247;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2248> AgradDistributionNormalSufficient_ffv_2248;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2249> AgradDistributionNormalSufficient_ffv_2249;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2250> AgradDistributionNormalSufficient_ffv_2250;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2251> AgradDistributionNormalSufficient_ffv_2251;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2252> AgradDistributionNormalSufficient_ffv_2252;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2253> AgradDistributionNormalSufficient_ffv_2253;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2254> AgradDistributionNormalSufficient_ffv_2254;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2255> AgradDistributionNormalSufficient_ffv_2255;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2256> AgradDistributionNormalSufficient_ffv_2256;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2257> AgradDistributionNormalSufficient_ffv_2257;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2258> AgradDistributionNormalSufficient_ffv_2258;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2259> AgradDistributionNormalSufficient_ffv_2259;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2260> AgradDistributionNormalSufficient_ffv_2260;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2261> AgradDistributionNormalSufficient_ffv_2261;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2262> AgradDistributionNormalSufficient_ffv_2262;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2263> AgradDistributionNormalSufficient_ffv_2263;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2264> AgradDistributionNormalSufficient_ffv_2264;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2265> AgradDistributionNormalSufficient_ffv_2265;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2266> AgradDistributionNormalSufficient_ffv_2266;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2267> AgradDistributionNormalSufficient_ffv_2267;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2268> AgradDistributionNormalSufficient_ffv_2268;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2269> AgradDistributionNormalSufficient_ffv_2269;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2270> AgradDistributionNormalSufficient_ffv_2270;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2271> AgradDistributionNormalSufficient_ffv_2271;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2272> AgradDistributionNormalSufficient_ffv_2272;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2273> AgradDistributionNormalSufficient_ffv_2273;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2274> AgradDistributionNormalSufficient_ffv_2274;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2275> AgradDistributionNormalSufficient_ffv_2275;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2276> AgradDistributionNormalSufficient_ffv_2276;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2277> AgradDistributionNormalSufficient_ffv_2277;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2278> AgradDistributionNormalSufficient_ffv_2278;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2279> AgradDistributionNormalSufficient_ffv_2279;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2280> AgradDistributionNormalSufficient_ffv_2280;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2281> AgradDistributionNormalSufficient_ffv_2281;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2282> AgradDistributionNormalSufficient_ffv_2282;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2283> AgradDistributionNormalSufficient_ffv_2283;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2284> AgradDistributionNormalSufficient_ffv_2284;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2285> AgradDistributionNormalSufficient_ffv_2285;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2286> AgradDistributionNormalSufficient_ffv_2286;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2287> AgradDistributionNormalSufficient_ffv_2287;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2288> AgradDistributionNormalSufficient_ffv_2288;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2289> AgradDistributionNormalSufficient_ffv_2289;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2290> AgradDistributionNormalSufficient_ffv_2290;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2291> AgradDistributionNormalSufficient_ffv_2291;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2292> AgradDistributionNormalSufficient_ffv_2292;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2293> AgradDistributionNormalSufficient_ffv_2293;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2294> AgradDistributionNormalSufficient_ffv_2294;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2295> AgradDistributionNormalSufficient_ffv_2295;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2296> AgradDistributionNormalSufficient_ffv_2296;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2297> AgradDistributionNormalSufficient_ffv_2297;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2298> AgradDistributionNormalSufficient_ffv_2298;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2299> AgradDistributionNormalSufficient_ffv_2299;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2200, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2200);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2201, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2201);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2202, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2202);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2203, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2203);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2204, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2204);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2205, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2205);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2206, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2206);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2207, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2207);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2208, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2208);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2209, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2209);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2210, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2210);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2211, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2211);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2212, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2212);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2213, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2213);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2214, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2214);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2215, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2215);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2216, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2216);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2217, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2217);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2218, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2218);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2219, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2219);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2220, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2220);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2221, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2221);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2222, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2222);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2223, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2223);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2224, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2224);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2225, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2225);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2226, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2226);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2227, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2227);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2228, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2228);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2229, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2229);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2230, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2230);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2231, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2231);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2232, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2232);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2233, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2233);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2234, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2234);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2235, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2235);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2236, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2236);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2237, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2237);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2238, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2238);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2239, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2239);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2240, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2240);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2241, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2241);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2242, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2242);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2243, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2243);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2244, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2244);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2245, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2245);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2246, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2246);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2247, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2247);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2248, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2248);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2249, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2249);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2250, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2250);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2251, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2251);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2252, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2252);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2253, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2253);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2254, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2254);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2255, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2255);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2256, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2256);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2257, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2257);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2258, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2258);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2259, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2259);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2260, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2260);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2261, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2261);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2262, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2262);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2263, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2263);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2264, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2264);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2265, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2265);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2266, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2266);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2267, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2267);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2268, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2268);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2269, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2269);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2270, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2270);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2271, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2271);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2272, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2272);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2273, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2273);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2274, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2274);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2275, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2275);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2276, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2276);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2277, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2277);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2278, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2278);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2279, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2279);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2280, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2280);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2281, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2281);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2282, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2282);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2283, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2283);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2284, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2284);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2285, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2285);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2286, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2286);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2287, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2287);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2288, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2288);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2289, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2289);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2290, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2290);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2291, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2291);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2292, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2292);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2293, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2293);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2294, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2294);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2295, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2295);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2296, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2296);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2297, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2297);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2298, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2298);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2299, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2299);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/normal_sufficient/normal_sufficient_test.hpp>
+
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, double, std::vector<var>, empty> type_v_2200;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2201;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, double, empty> type_v_2202;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, std::vector<double>, empty> type_v_2203;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2204;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, var, empty> type_v_2205;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, std::vector<var>, empty> type_v_2206;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2207;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_2208;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_2209;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2210;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_2211;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_2212;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2213;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, var, double, empty> type_v_2214;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, var, std::vector<double>, empty> type_v_2215;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2216;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, var, var, empty> type_v_2217;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, var, std::vector<var>, empty> type_v_2218;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2219;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<var>, double, empty> type_v_2220;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<var>, std::vector<double>, empty> type_v_2221;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2222;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<var>, var, empty> type_v_2223;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<var>, std::vector<var>, empty> type_v_2224;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2225;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_2226;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_2227;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2228;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_2229;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_2230;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2231;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, double, empty> type_v_2232;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_v_2233;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2234;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, var, empty> type_v_2235;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<var>, empty> type_v_2236;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2237;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_v_2238;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_v_2239;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2240;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, var, empty> type_v_2241;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty> type_v_2242;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2243;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_2244;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_2245;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2246;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_2247;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_2248;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2249;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, double, empty> type_v_2250;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<double>, empty> type_v_2251;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2252;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, var, empty> type_v_2253;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<var>, empty> type_v_2254;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2255;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, double, empty> type_v_2256;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty> type_v_2257;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2258;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, var, empty> type_v_2259;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty> type_v_2260;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2261;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_2262;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_2263;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2264;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_2265;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_2266;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2267;
+typedef std::tuple<var, var, int, double, double, empty> type_v_2268;
+typedef std::tuple<var, var, int, double, std::vector<double>, empty> type_v_2269;
+typedef std::tuple<var, var, int, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2270;
+typedef std::tuple<var, var, int, double, var, empty> type_v_2271;
+typedef std::tuple<var, var, int, double, std::vector<var>, empty> type_v_2272;
+typedef std::tuple<var, var, int, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2273;
+typedef std::tuple<var, var, int, std::vector<double>, double, empty> type_v_2274;
+typedef std::tuple<var, var, int, std::vector<double>, std::vector<double>, empty> type_v_2275;
+typedef std::tuple<var, var, int, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2276;
+typedef std::tuple<var, var, int, std::vector<double>, var, empty> type_v_2277;
+typedef std::tuple<var, var, int, std::vector<double>, std::vector<var>, empty> type_v_2278;
+typedef std::tuple<var, var, int, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2279;
+typedef std::tuple<var, var, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_2280;
+typedef std::tuple<var, var, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_2281;
+typedef std::tuple<var, var, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2282;
+typedef std::tuple<var, var, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_2283;
+typedef std::tuple<var, var, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_2284;
+typedef std::tuple<var, var, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2285;
+typedef std::tuple<var, var, int, var, double, empty> type_v_2286;
+typedef std::tuple<var, var, int, var, std::vector<double>, empty> type_v_2287;
+typedef std::tuple<var, var, int, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2288;
+typedef std::tuple<var, var, int, var, var, empty> type_v_2289;
+typedef std::tuple<var, var, int, var, std::vector<var>, empty> type_v_2290;
+typedef std::tuple<var, var, int, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2291;
+typedef std::tuple<var, var, int, std::vector<var>, double, empty> type_v_2292;
+typedef std::tuple<var, var, int, std::vector<var>, std::vector<double>, empty> type_v_2293;
+typedef std::tuple<var, var, int, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2294;
+typedef std::tuple<var, var, int, std::vector<var>, var, empty> type_v_2295;
+typedef std::tuple<var, var, int, std::vector<var>, std::vector<var>, empty> type_v_2296;
+typedef std::tuple<var, var, int, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2297;
+typedef std::tuple<var, var, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_2298;
+typedef std::tuple<var, var, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_2299;
+
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2200> AgradDistributionNormalSufficient_v_2200;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2201> AgradDistributionNormalSufficient_v_2201;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2202> AgradDistributionNormalSufficient_v_2202;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2203> AgradDistributionNormalSufficient_v_2203;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2204> AgradDistributionNormalSufficient_v_2204;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2205> AgradDistributionNormalSufficient_v_2205;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2206> AgradDistributionNormalSufficient_v_2206;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2207> AgradDistributionNormalSufficient_v_2207;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2208> AgradDistributionNormalSufficient_v_2208;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2209> AgradDistributionNormalSufficient_v_2209;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2210> AgradDistributionNormalSufficient_v_2210;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2211> AgradDistributionNormalSufficient_v_2211;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2212> AgradDistributionNormalSufficient_v_2212;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2213> AgradDistributionNormalSufficient_v_2213;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2214> AgradDistributionNormalSufficient_v_2214;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2215> AgradDistributionNormalSufficient_v_2215;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2216> AgradDistributionNormalSufficient_v_2216;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2217> AgradDistributionNormalSufficient_v_2217;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2218> AgradDistributionNormalSufficient_v_2218;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2219> AgradDistributionNormalSufficient_v_2219;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2220> AgradDistributionNormalSufficient_v_2220;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2221> AgradDistributionNormalSufficient_v_2221;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2222> AgradDistributionNormalSufficient_v_2222;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2223> AgradDistributionNormalSufficient_v_2223;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2224> AgradDistributionNormalSufficient_v_2224;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2225> AgradDistributionNormalSufficient_v_2225;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2226> AgradDistributionNormalSufficient_v_2226;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2227> AgradDistributionNormalSufficient_v_2227;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2228> AgradDistributionNormalSufficient_v_2228;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2229> AgradDistributionNormalSufficient_v_2229;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2230> AgradDistributionNormalSufficient_v_2230;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2231> AgradDistributionNormalSufficient_v_2231;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2232> AgradDistributionNormalSufficient_v_2232;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2233> AgradDistributionNormalSufficient_v_2233;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2234> AgradDistributionNormalSufficient_v_2234;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2235> AgradDistributionNormalSufficient_v_2235;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2236> AgradDistributionNormalSufficient_v_2236;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2237> AgradDistributionNormalSufficient_v_2237;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2238> AgradDistributionNormalSufficient_v_2238;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2239> AgradDistributionNormalSufficient_v_2239;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2240> AgradDistributionNormalSufficient_v_2240;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2241> AgradDistributionNormalSufficient_v_2241;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2242> AgradDistributionNormalSufficient_v_2242;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2243> AgradDistributionNormalSufficient_v_2243;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2244> AgradDistributionNormalSufficient_v_2244;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2245> AgradDistributionNormalSufficient_v_2245;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2246> AgradDistributionNormalSufficient_v_2246;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2247> AgradDistributionNormalSufficient_v_2247;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2248> AgradDistributionNormalSufficient_v_2248;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2249> AgradDistributionNormalSufficient_v_2249;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2250> AgradDistributionNormalSufficient_v_2250;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2251> AgradDistributionNormalSufficient_v_2251;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2252> AgradDistributionNormalSufficient_v_2252;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2253> AgradDistributionNormalSufficient_v_2253;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2254> AgradDistributionNormalSufficient_v_2254;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2255> AgradDistributionNormalSufficient_v_2255;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2256> AgradDistributionNormalSufficient_v_2256;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2257> AgradDistributionNormalSufficient_v_2257;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2258> AgradDistributionNormalSufficient_v_2258;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2259> AgradDistributionNormalSufficient_v_2259;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2260> AgradDistributionNormalSufficient_v_2260;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2261> AgradDistributionNormalSufficient_v_2261;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2262> AgradDistributionNormalSufficient_v_2262;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2263> AgradDistributionNormalSufficient_v_2263;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2264> AgradDistributionNormalSufficient_v_2264;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2265> AgradDistributionNormalSufficient_v_2265;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2266> AgradDistributionNormalSufficient_v_2266;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2267> AgradDistributionNormalSufficient_v_2267;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2268> AgradDistributionNormalSufficient_v_2268;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2269> AgradDistributionNormalSufficient_v_2269;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2270> AgradDistributionNormalSufficient_v_2270;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2271> AgradDistributionNormalSufficient_v_2271;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2272> AgradDistributionNormalSufficient_v_2272;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2273> AgradDistributionNormalSufficient_v_2273;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2274> AgradDistributionNormalSufficient_v_2274;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2275> AgradDistributionNormalSufficient_v_2275;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2276> AgradDistributionNormalSufficient_v_2276;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2277> AgradDistributionNormalSufficient_v_2277;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2278> AgradDistributionNormalSufficient_v_2278;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2279> AgradDistributionNormalSufficient_v_2279;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2280> AgradDistributionNormalSufficient_v_2280;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2281> AgradDistributionNormalSufficient_v_2281;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2282> AgradDistributionNormalSufficient_v_2282;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2283> AgradDistributionNormalSufficient_v_2283;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2284> AgradDistributionNormalSufficient_v_2284;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2285> AgradDistributionNormalSufficient_v_2285;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2286> AgradDistributionNormalSufficient_v_2286;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2287> AgradDistributionNormalSufficient_v_2287;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2288> AgradDistributionNormalSufficient_v_2288;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2289> AgradDistributionNormalSufficient_v_2289;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2290> AgradDistributionNormalSufficient_v_2290;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2291> AgradDistributionNormalSufficient_v_2291;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2292> AgradDistributionNormalSufficient_v_2292;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2293> AgradDistributionNormalSufficient_v_2293;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2294> AgradDistributionNormalSufficient_v_2294;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2295> AgradDistributionNormalSufficient_v_2295;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2296> AgradDistributionNormalSufficient_v_2296;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2297> AgradDistributionNormalSufficient_v_2297;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2298> AgradDistributionNormalSufficient_v_2298;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2299> AgradDistributionNormalSufficient_v_2299;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2200, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2200);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2201, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2201);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2202, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2202);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2203, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2203);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2204, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2204);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2205, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2205);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2206, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2206);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2207, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2207);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2208, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2208);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2209, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2209);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2210, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2210);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2211, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2211);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2212, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2212);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2213, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2213);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2214, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2214);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2215, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2215);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2216, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2216);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2217, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2217);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2218, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2218);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2219, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2219);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2220, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2220);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2221, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2221);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2222, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2222);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2223, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2223);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2224, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2224);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2225, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2225);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2226, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2226);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2227, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2227);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2228, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2228);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2229, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2229);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2230, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2230);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2231, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2231);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2232, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2232);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2233, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2233);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2234, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2234);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2235, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2235);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2236, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2236);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2237, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2237);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2238, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2238);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2239, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2239);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2240, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2240);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2241, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2241);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2242, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2242);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2243, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2243);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2244, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2244);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2245, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2245);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2246, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2246);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2247, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2247);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2248, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2248);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2249, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2249);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2250, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2250);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2251, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2251);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2252, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2252);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2253, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2253);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2254, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2254);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2255, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2255);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2256, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2256);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2257, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2257);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2258, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2258);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2259, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2259);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2260, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2260);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2261, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2261);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2262, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2262);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2263, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2263);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2264, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2264);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2265, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2265);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2266, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2266);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2267, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2267);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2268, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2268);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2269, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2269);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2270, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2270);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2271, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2271);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2272, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2272);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2273, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2273);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2274, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2274);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2275, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2275);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2276, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2276);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2277, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2277);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2278, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2278);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2279, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2279);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2280, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2280);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2281, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2281);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2282, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2282);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2283, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2283);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2284, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2284);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2285, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2285);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2286, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2286);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2287, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2287);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2288, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2288);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2289, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2289);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2290, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2290);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2291, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2291);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2292, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2292);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2293, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2293);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2294, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2294);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2295, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2295);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2296, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2296);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2297, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2297);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2298, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2298);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2299, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2299);
+
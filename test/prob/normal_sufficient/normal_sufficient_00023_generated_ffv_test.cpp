@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/normal_sufficient/normal_sufficient_test.hpp>
+
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2300;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<int>, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_2301;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_2302;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2303;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<int>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_2304;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_2305;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2306;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_2307;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_2308;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2309;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_2310;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_2311;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2312;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, double, empty> type_ffv_2313;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_ffv_2314;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2315;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty> type_ffv_2316;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_2317;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2318;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_ffv_2319;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_ffv_2320;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2321;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_2322;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_2323;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2324;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffv_2325;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_2326;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2327;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_2328;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_2329;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2330;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty> type_ffv_2331;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_2332;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2333;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_2334;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_2335;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2336;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_2337;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_2338;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2339;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_2340;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_2341;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2342;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_2343;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_2344;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2345;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_2346;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_2347;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2348;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, int, double, double, empty> type_ffv_2349;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, int, double, std::vector<double>, empty> type_ffv_2350;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, int, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2351;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, int, double, fvar<fvar<var> >, empty> type_ffv_2352;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, int, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_2353;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, int, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2354;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, int, std::vector<double>, double, empty> type_ffv_2355;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, int, std::vector<double>, std::vector<double>, empty> type_ffv_2356;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, int, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2357;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, int, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_2358;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, int, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_2359;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, int, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2360;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffv_2361;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_2362;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2363;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_2364;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_2365;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2366;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, int, fvar<fvar<var> >, double, empty> type_ffv_2367;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, int, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_2368;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, int, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2369;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, int, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_2370;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, int, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_2371;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, int, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2372;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, int, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_2373;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, int, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_2374;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2375;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, int, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_2376;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, int, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_2377;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2378;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_2379;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_2380;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2381;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_2382;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_2383;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2384;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<int>, double, double, empty> type_ffv_2385;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<int>, double, std::vector<double>, empty> type_ffv_2386;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<int>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2387;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<int>, double, fvar<fvar<var> >, empty> type_ffv_2388;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<int>, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_2389;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<int>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2390;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<int>, std::vector<double>, double, empty> type_ffv_2391;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<int>, std::vector<double>, std::vector<double>, empty> type_ffv_2392;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<int>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2393;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<int>, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_2394;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<int>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_2395;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<int>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2396;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffv_2397;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_2398;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2399;
+
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2300> AgradDistributionNormalSufficient_ffv_2300;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2301> AgradDistributionNormalSufficient_ffv_2301;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2302> AgradDistributionNormalSufficient_ffv_2302;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2303> AgradDistributionNormalSufficient_ffv_2303;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2304> AgradDistributionNormalSufficient_ffv_2304;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2305> AgradDistributionNormalSufficient_ffv_2305;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2306> AgradDistributionNormalSufficient_ffv_2306;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2307> AgradDistributionNormalSufficient_ffv_2307;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2308> AgradDistributionNormalSufficient_ffv_2308;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2309> AgradDistributionNormalSufficient_ffv_2309;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2310> AgradDistributionNormalSufficient_ffv_2310;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2311> AgradDistributionNormalSufficient_ffv_2311;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2312> AgradDistributionNormalSufficient_ffv_2312;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2313> AgradDistributionNormalSufficient_ffv_2313;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2314> AgradDistributionNormalSufficient_ffv_2314;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2315> AgradDistributionNormalSufficient_ffv_2315;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2316> AgradDistributionNormalSufficient_ffv_2316;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2317> AgradDistributionNormalSufficient_ffv_2317;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2318> AgradDistributionNormalSufficient_ffv_2318;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2319> AgradDistributionNormalSufficient_ffv_2319;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2320> AgradDistributionNormalSufficient_ffv_2320;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2321> AgradDistributionNormalSufficient_ffv_2321;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2322> AgradDistributionNormalSufficient_ffv_2322;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2323> AgradDistributionNormalSufficient_ffv_2323;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2324> AgradDistributionNormalSufficient_ffv_2324;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2325> AgradDistributionNormalSufficient_ffv_2325;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2326> AgradDistributionNormalSufficient_ffv_2326;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2327> AgradDistributionNormalSufficient_ffv_2327;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2328> AgradDistributionNormalSufficient_ffv_2328;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2329> AgradDistributionNormalSufficient_ffv_2329;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2330> AgradDistributionNormalSufficient_ffv_2330;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2331> AgradDistributionNormalSufficient_ffv_2331;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2332> AgradDistributionNormalSufficient_ffv_2332;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2333> AgradDistributionNormalSufficient_ffv_2333;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2334> AgradDistributionNormalSufficient_ffv_2334;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2335> AgradDistributionNormalSufficient_ffv_2335;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2336> AgradDistributionNormalSufficient_ffv_2336;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2337> AgradDistributionNormalSufficient_ffv_2337;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2338> AgradDistributionNormalSufficient_ffv_2338;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2339> AgradDistributionNormalSufficient_ffv_2339;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2340> AgradDistributionNormalSufficient_ffv_2340;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2341> AgradDistributionNormalSufficient_ffv_2341;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2342> AgradDistributionNormalSufficient_ffv_2342;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2343> AgradDistributionNormalSufficient_ffv_2343;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2344> AgradDistributionNormalSufficient_ffv_2344;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2345> AgradDistributionNormalSufficient_ffv_2345;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2346> AgradDistributionNormalSufficient_ffv_2346;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2347> AgradDistributionNormalSufficient_ffv_2347;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2348> AgradDistributionNormalSufficient_ffv_2348;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2349> AgradDistributionNormalSufficient_ffv_2349;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2350> AgradDistributionNormalSufficient_ffv_2350;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2351> AgradDistributionNormalSufficient_ffv_2351;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2352> AgradDistributionNormalSufficient_ffv_2352;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2353> AgradDistributionNormalSufficient_ffv_2353;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2354> AgradDistributionNormalSufficient_ffv_2354;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2355> AgradDistributionNormalSufficient_ffv_2355;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2356> AgradDistributionNormalSufficient_ffv_2356;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2357> AgradDistributionNormalSufficient_ffv_2357;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2358> AgradDistributionNormalSufficient_ffv_2358;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2359> AgradDistributionNormalSufficient_ffv_2359;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2360> AgradDistributionNormalSufficient_ffv_2360;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2361> AgradDistributionNormalSufficient_ffv_2361;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2362> AgradDistributionNormalSufficient_ffv_2362;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2363> AgradDistributionNormalSufficient_ffv_2363;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2364> AgradDistributionNormalSufficient_ffv_2364;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2365> AgradDistributionNormalSufficient_ffv_2365;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2366> AgradDistributionNormalSufficient_ffv_2366;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2367> AgradDistributionNormalSufficient_ffv_2367;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2368> AgradDistributionNormalSufficient_ffv_2368;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2369> AgradDistributionNormalSufficient_ffv_2369;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2370> AgradDistributionNormalSufficient_ffv_2370;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2371> AgradDistributionNormalSufficient_ffv_2371;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2372> AgradDistributionNormalSufficient_ffv_2372;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2373> AgradDistributionNormalSufficient_ffv_2373;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2374> AgradDistributionNormalSufficient_ffv_2374;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2375> AgradDistributionNormalSufficient_ffv_2375;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2376> AgradDistributionNormalSufficient_ffv_2376;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2377> AgradDistributionNormalSufficient_ffv_2377;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2378> AgradDistributionNormalSufficient_ffv_2378;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2379> AgradDistributionNormalSufficient_ffv_2379;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2380> AgradDistributionNormalSufficient_ffv_2380;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2381> AgradDistributionNormalSufficient_ffv_2381;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2382> AgradDistributionNormalSufficient_ffv_2382;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2383> AgradDistributionNormalSufficient_ffv_2383;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2384> AgradDistributionNormalSufficient_ffv_2384;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2385> AgradDistributionNormalSufficient_ffv_2385;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2386> AgradDistributionNormalSufficient_ffv_2386;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2387> AgradDistributionNormalSufficient_ffv_2387;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2388> AgradDistributionNormalSufficient_ffv_2388;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2389> AgradDistributionNormalSufficient_ffv_2389;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2390> AgradDistributionNormalSufficient_ffv_2390;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2391> AgradDistributionNormalSufficient_ffv_2391;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2392> AgradDistributionNormalSufficient_ffv_2392;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2393> AgradDistributionNormalSufficient_ffv_2393;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2394> AgradDistributionNormalSufficient_ffv_2394;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2395> AgradDistributionNormalSufficient_ffv_2395;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2396> AgradDistributionNormalSufficient_ffv_2396;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2397> AgradDistributionNormalSufficient_ffv_2397;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2398> AgradDistributionNormalSufficient_ffv_2398;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2399> AgradDistributionNormalSufficient_ffv_2399;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2300, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2300);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2301, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2301);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2302, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2302);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2303, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2303);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2304, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2304);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2305, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2305);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2306, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2306);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2307, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2307);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2308, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2308);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2309, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2309);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2310, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2310);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2311, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2311);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2312, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2312);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2313, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2313);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2314, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2314);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2315, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2315);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2316, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2316);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2317, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2317);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2318, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2318);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2319, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2319);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2320, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2320);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2321, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2321);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2322, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2322);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2323, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2323);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2324, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2324);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2325, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2325);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2326, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2326);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2327, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2327);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2328, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2328);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2329, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2329);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2330, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2330);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2331, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2331);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2332, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2332);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2333, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2333);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2334, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2334);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2335, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2335);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2336, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2336);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2337, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2337);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2338, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2338);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2339, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2339);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2340, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2340);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2341, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2341);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2342, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2342);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2343, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2343);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2344, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2344);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2345, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2345);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2346, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2346);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2347, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2347);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2348, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2348);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2349, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2349);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2350, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2350);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2351, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2351);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2352, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2352);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2353, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2353);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2354, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2354);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2355, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2355);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2356, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2356);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2357, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2357);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2358, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2358);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2359, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2359);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2360, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2360);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2361, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2361);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2362, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2362);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2363, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2363);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2364, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2364);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2365, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2365);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2366, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2366);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2367, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2367);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2368, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2368);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2369, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2369);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2370, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2370);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2371, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2371);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2372, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2372);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2373, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2373);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2374, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2374);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2375, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2375);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2376, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2376);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2377, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2377);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2378, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2378);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2379, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2379);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2380, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2380);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2381, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2381);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2382, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2382);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2383, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2383);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2384, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2384);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2385, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2385);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2386, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2386);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2387, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2387);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2388, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2388);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2389, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2389);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2390, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2390);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2391, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2391);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2392, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2392);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2393, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2393);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2394, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2394);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2395, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2395);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2396, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2396);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2397, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2397);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2398, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2398);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2399, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2399);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/normal_sufficient/normal_sufficient_test.hpp>
+
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_2400;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_2401;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2402;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<int>, fvar<fvar<var> >, double, empty> type_ffv_2403;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<int>, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_2404;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2405;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<int>, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_2406;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<int>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_2407;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2408;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<int>, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_2409;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_2410;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2411;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<int>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_2412;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_2413;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2414;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_2415;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_2416;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2417;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_2418;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_2419;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2420;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, double, empty> type_ffv_2421;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_ffv_2422;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2423;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty> type_ffv_2424;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_2425;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2426;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_ffv_2427;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_ffv_2428;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2429;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_2430;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_2431;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2432;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffv_2433;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_2434;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2435;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_2436;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_2437;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2438;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty> type_ffv_2439;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_2440;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2441;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_2442;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_2443;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2444;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_2445;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_2446;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2447;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_2448;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_2449;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2450;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_2451;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_2452;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2453;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_2454;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_2455;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2456;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, int, double, double, empty> type_ffv_2457;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, int, double, std::vector<double>, empty> type_ffv_2458;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, int, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2459;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, int, double, fvar<fvar<var> >, empty> type_ffv_2460;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, int, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_2461;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, int, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2462;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, int, std::vector<double>, double, empty> type_ffv_2463;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, int, std::vector<double>, std::vector<double>, empty> type_ffv_2464;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, int, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2465;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, int, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_2466;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, int, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_2467;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, int, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2468;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffv_2469;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_2470;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2471;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_2472;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_2473;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2474;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, int, fvar<fvar<var> >, double, empty> type_ffv_2475;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, int, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_2476;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, int, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2477;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, int, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_2478;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, int, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_2479;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, int, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2480;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, int, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_2481;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, int, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_2482;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2483;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, int, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_2484;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, int, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_2485;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2486;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_2487;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_2488;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2489;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_2490;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_2491;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2492;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<int>, double, double, empty> type_ffv_2493;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<int>, double, std::vector<double>, empty> type_ffv_2494;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<int>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2495;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<int>, double, fvar<fvar<var> >, empty> type_ffv_2496;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<int>, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_2497;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<int>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2498;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<int>, std::vector<double>, double, empty> type_ffv_2499;
+
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2400> AgradDistributionNormalSufficient_ffv_2400;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2401> AgradDistributionNormalSufficient_ffv_2401;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2402> AgradDistributionNormalSufficient_ffv_2402;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2403> AgradDistributionNormalSufficient_ffv_2403;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2404> AgradDistributionNormalSufficient_ffv_2404;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2405> AgradDistributionNormalSufficient_ffv_2405;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2406> AgradDistributionNormalSufficient_ffv_2406;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2407> AgradDistributionNormalSufficient_ffv_2407;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2408> AgradDistributionNormalSufficient_ffv_2408;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2409> AgradDistributionNormalSufficient_ffv_2409;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2410> AgradDistributionNormalSufficient_ffv_2410;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2411> AgradDistributionNormalSufficient_ffv_2411;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2412> AgradDistributionNormalSufficient_ffv_2412;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2413> AgradDistributionNormalSufficient_ffv_2413;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2414> AgradDistributionNormalSufficient_ffv_2414;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2415> AgradDistributionNormalSufficient_ffv_2415;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2416> AgradDistributionNormalSufficient_ffv_2416;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2417> AgradDistributionNormalSufficient_ffv_2417;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2418> AgradDistributionNormalSufficient_ffv_2418;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2419> AgradDistributionNormalSufficient_ffv_2419;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2420> AgradDistributionNormalSufficient_ffv_2420;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2421> AgradDistributionNormalSufficient_ffv_2421;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2422> AgradDistributionNormalSufficient_ffv_2422;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2423> AgradDistributionNormalSufficient_ffv_2423;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2424> AgradDistributionNormalSufficient_ffv_2424;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2425> AgradDistributionNormalSufficient_ffv_2425;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2426> AgradDistributionNormalSufficient_ffv_2426;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2427> AgradDistributionNormalSufficient_ffv_2427;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2428> AgradDistributionNormalSufficient_ffv_2428;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2429> AgradDistributionNormalSufficient_ffv_2429;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2430> AgradDistributionNormalSufficient_ffv_2430;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2431> AgradDistributionNormalSufficient_ffv_2431;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2432> AgradDistributionNormalSufficient_ffv_2432;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2433> AgradDistributionNormalSufficient_ffv_2433;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2434> AgradDistributionNormalSufficient_ffv_2434;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2435> AgradDistributionNormalSufficient_ffv_2435;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2436> AgradDistributionNormalSufficient_ffv_2436;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2437> AgradDistributionNormalSufficient_ffv_2437;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2438> AgradDistributionNormalSufficient_ffv_2438;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2439> AgradDistributionNormalSufficient_ffv_2439;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2440> AgradDistributionNormalSufficient_ffv_2440;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2441> AgradDistributionNormalSufficient_ffv_2441;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2442> AgradDistributionNormalSufficient_ffv_2442;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2443> AgradDistributionNormalSufficient_ffv_2443;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2444> AgradDistributionNormalSufficient_ffv_2444;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2445> AgradDistributionNormalSufficient_ffv_2445;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2446> AgradDistributionNormalSufficient_ffv_2446;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2447> AgradDistributionNormalSufficient_ffv_2447;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2448> AgradDistributionNormalSufficient_ffv_2448;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2449> AgradDistributionNormalSufficient_ffv_2449;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2450> AgradDistributionNormalSufficient_ffv_2450;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2451> AgradDistributionNormalSufficient_ffv_2451;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2452> AgradDistributionNormalSufficient_ffv_2452;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2453> AgradDistributionNormalSufficient_ffv_2453;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2454> AgradDistributionNormalSufficient_ffv_2454;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2455> AgradDistributionNormalSufficient_ffv_2455;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2456> AgradDistributionNormalSufficient_ffv_2456;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2457> AgradDistributionNormalSufficient_ffv_2457;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2458> AgradDistributionNormalSufficient_ffv_2458;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2459> AgradDistributionNormalSufficient_ffv_2459;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2460> AgradDistributionNormalSufficient_ffv_2460;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2461> AgradDistributionNormalSufficient_ffv_2461;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2462> AgradDistributionNormalSufficient_ffv_2462;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2463> AgradDistributionNormalSufficient_ffv_2463;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2464> AgradDistributionNormalSufficient_ffv_2464;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2465> AgradDistributionNormalSufficient_ffv_2465;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2466> AgradDistributionNormalSufficient_ffv_2466;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2467> AgradDistributionNormalSufficient_ffv_2467;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2468> AgradDistributionNormalSufficient_ffv_2468;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2469> AgradDistributionNormalSufficient_ffv_2469;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2470> AgradDistributionNormalSufficient_ffv_2470;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2471> AgradDistributionNormalSufficient_ffv_2471;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2472> AgradDistributionNormalSufficient_ffv_2472;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2473> AgradDistributionNormalSufficient_ffv_2473;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2474> AgradDistributionNormalSufficient_ffv_2474;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2475> AgradDistributionNormalSufficient_ffv_2475;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2476> AgradDistributionNormalSufficient_ffv_2476;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2477> AgradDistributionNormalSufficient_ffv_2477;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2478> AgradDistributionNormalSufficient_ffv_2478;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2479> AgradDistributionNormalSufficient_ffv_2479;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2480> AgradDistributionNormalSufficient_ffv_2480;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2481> AgradDistributionNormalSufficient_ffv_2481;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2482> AgradDistributionNormalSufficient_ffv_2482;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2483> AgradDistributionNormalSufficient_ffv_2483;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2484> AgradDistributionNormalSufficient_ffv_2484;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2485> AgradDistributionNormalSufficient_ffv_2485;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2486> AgradDistributionNormalSufficient_ffv_2486;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2487> AgradDistributionNormalSufficient_ffv_2487;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2488> AgradDistributionNormalSufficient_ffv_2488;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2489> AgradDistributionNormalSufficient_ffv_2489;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2490> AgradDistributionNormalSufficient_ffv_2490;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2491> AgradDistributionNormalSufficient_ffv_2491;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2492> AgradDistributionNormalSufficient_ffv_2492;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2493> AgradDistributionNormalSufficient_ffv_2493;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2494> AgradDistributionNormalSufficient_ffv_2494;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2495> AgradDistributionNormalSufficient_ffv_2495;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2496> AgradDistributionNormalSufficient_ffv_2496;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2497> AgradDistributionNormalSufficient_ffv_2497;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2498> AgradDistributionNormalSufficient_ffv_2498;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2499> AgradDistributionNormalSufficient_ffv_2499;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2400, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2400);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2401, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2401);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2402, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2402);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2403, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2403);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2404, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2404);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2405, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2405);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2406, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2406);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2407, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2407);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2408, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2408);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2409, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2409);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2410, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2410);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2411, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2411);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2412, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2412);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2413, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2413);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2414, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2414);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2415, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2415);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2416, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2416);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2417, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2417);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2418, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2418);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2419, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2419);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2420, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2420);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2421, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2421);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2422, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2422);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2423, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2423);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2424, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2424);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2425, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2425);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2426, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2426);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2427, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2427);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2428, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2428);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2429, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2429);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2430, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2430);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2431, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2431);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2432, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2432);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2433, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2433);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2434, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2434);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2435, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2435);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2436, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2436);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2437, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2437);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2438, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2438);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2439, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2439);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2440, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2440);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2441, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2441);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2442, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2442);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2443, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2443);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2444, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2444);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2445, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2445);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2446, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2446);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2447, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2447);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2448, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2448);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2449, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2449);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2450, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2450);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2451, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2451);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2452, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2452);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2453, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2453);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2454, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2454);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2455, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2455);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2456, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2456);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2457, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2457);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2458, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2458);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2459, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2459);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2460, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2460);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2461, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2461);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2462, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2462);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2463, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2463);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2464, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2464);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2465, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2465);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2466, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2466);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2467, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2467);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2468, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2468);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2469, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2469);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2470, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2470);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2471, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2471);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2472, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2472);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2473, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2473);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2474, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2474);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2475, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2475);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2476, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2476);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2477, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2477);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2478, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2478);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2479, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2479);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2480, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2480);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2481, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2481);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2482, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2482);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2483, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2483);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2484, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2484);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2485, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2485);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2486, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2486);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2487, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2487);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2488, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2488);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2489, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2489);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2490, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2490);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2491, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2491);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2492, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2492);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2493, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2493);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2494, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2494);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2495, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2495);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2496, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2496);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2497, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2497);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2498, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2498);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2499, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2499);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/normal_sufficient/normal_sufficient_test.hpp>
+
+typedef std::tuple<var, std::vector<var>, int, std::vector<var>, double, empty> type_v_2400;
+typedef std::tuple<var, std::vector<var>, int, std::vector<var>, std::vector<double>, empty> type_v_2401;
+typedef std::tuple<var, std::vector<var>, int, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2402;
+typedef std::tuple<var, std::vector<var>, int, std::vector<var>, var, empty> type_v_2403;
+typedef std::tuple<var, std::vector<var>, int, std::vector<var>, std::vector<var>, empty> type_v_2404;
+typedef std::tuple<var, std::vector<var>, int, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2405;
+typedef std::tuple<var, std::vector<var>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_2406;
+typedef std::tuple<var, std::vector<var>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_2407;
+typedef std::tuple<var, std::vector<var>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2408;
+typedef std::tuple<var, std::vector<var>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_2409;
+typedef std::tuple<var, std::vector<var>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_2410;
+typedef std::tuple<var, std::vector<var>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2411;
+typedef std::tuple<var, std::vector<var>, std::vector<int>, double, double, empty> type_v_2412;
+typedef std::tuple<var, std::vector<var>, std::vector<int>, double, std::vector<double>, empty> type_v_2413;
+typedef std::tuple<var, std::vector<var>, std::vector<int>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2414;
+typedef std::tuple<var, std::vector<var>, std::vector<int>, double, var, empty> type_v_2415;
+typedef std::tuple<var, std::vector<var>, std::vector<int>, double, std::vector<var>, empty> type_v_2416;
+typedef std::tuple<var, std::vector<var>, std::vector<int>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2417;
+typedef std::tuple<var, std::vector<var>, std::vector<int>, std::vector<double>, double, empty> type_v_2418;
+typedef std::tuple<var, std::vector<var>, std::vector<int>, std::vector<double>, std::vector<double>, empty> type_v_2419;
+typedef std::tuple<var, std::vector<var>, std::vector<int>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2420;
+typedef std::tuple<var, std::vector<var>, std::vector<int>, std::vector<double>, var, empty> type_v_2421;
+typedef std::tuple<var, std::vector<var>, std::vector<int>, std::vector<double>, std::vector<var>, empty> type_v_2422;
+typedef std::tuple<var, std::vector<var>, std::vector<int>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2423;
+typedef std::tuple<var, std::vector<var>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_2424;
+typedef std::tuple<var, std::vector<var>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_2425;
+typedef std::tuple<var, std::vector<var>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2426;
+typedef std::tuple<var, std::vector<var>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_2427;
+typedef std::tuple<var, std::vector<var>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_2428;
+typedef std::tuple<var, std::vector<var>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2429;
+typedef std::tuple<var, std::vector<var>, std::vector<int>, var, double, empty> type_v_2430;
+typedef std::tuple<var, std::vector<var>, std::vector<int>, var, std::vector<double>, empty> type_v_2431;
+typedef std::tuple<var, std::vector<var>, std::vector<int>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2432;
+typedef std::tuple<var, std::vector<var>, std::vector<int>, var, var, empty> type_v_2433;
+typedef std::tuple<var, std::vector<var>, std::vector<int>, var, std::vector<var>, empty> type_v_2434;
+typedef std::tuple<var, std::vector<var>, std::vector<int>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2435;
+typedef std::tuple<var, std::vector<var>, std::vector<int>, std::vector<var>, double, empty> type_v_2436;
+typedef std::tuple<var, std::vector<var>, std::vector<int>, std::vector<var>, std::vector<double>, empty> type_v_2437;
+typedef std::tuple<var, std::vector<var>, std::vector<int>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2438;
+typedef std::tuple<var, std::vector<var>, std::vector<int>, std::vector<var>, var, empty> type_v_2439;
+typedef std::tuple<var, std::vector<var>, std::vector<int>, std::vector<var>, std::vector<var>, empty> type_v_2440;
+typedef std::tuple<var, std::vector<var>, std::vector<int>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2441;
+typedef std::tuple<var, std::vector<var>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_2442;
+typedef std::tuple<var, std::vector<var>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_2443;
+typedef std::tuple<var, std::vector<var>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2444;
+typedef std::tuple<var, std::vector<var>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_2445;
+typedef std::tuple<var, std::vector<var>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_2446;
+typedef std::tuple<var, std::vector<var>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2447;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, double, empty> type_v_2448;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_v_2449;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2450;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, var, empty> type_v_2451;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<var>, empty> type_v_2452;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2453;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_v_2454;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_v_2455;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2456;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, var, empty> type_v_2457;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty> type_v_2458;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2459;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_2460;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_2461;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2462;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_2463;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_2464;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2465;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, double, empty> type_v_2466;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<double>, empty> type_v_2467;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2468;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, var, empty> type_v_2469;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<var>, empty> type_v_2470;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2471;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, double, empty> type_v_2472;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty> type_v_2473;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2474;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, var, empty> type_v_2475;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty> type_v_2476;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2477;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_2478;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_2479;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2480;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_2481;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_2482;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2483;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, int, double, double, empty> type_v_2484;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, int, double, std::vector<double>, empty> type_v_2485;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, int, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2486;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, int, double, var, empty> type_v_2487;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, int, double, std::vector<var>, empty> type_v_2488;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, int, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2489;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, int, std::vector<double>, double, empty> type_v_2490;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, int, std::vector<double>, std::vector<double>, empty> type_v_2491;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, int, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2492;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, int, std::vector<double>, var, empty> type_v_2493;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, int, std::vector<double>, std::vector<var>, empty> type_v_2494;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, int, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2495;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_2496;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_2497;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2498;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_2499;
+
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2400> AgradDistributionNormalSufficient_v_2400;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2401> AgradDistributionNormalSufficient_v_2401;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2402> AgradDistributionNormalSufficient_v_2402;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2403> AgradDistributionNormalSufficient_v_2403;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2404> AgradDistributionNormalSufficient_v_2404;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2405> AgradDistributionNormalSufficient_v_2405;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2406> AgradDistributionNormalSufficient_v_2406;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2407> AgradDistributionNormalSufficient_v_2407;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2408> AgradDistributionNormalSufficient_v_2408;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2409> AgradDistributionNormalSufficient_v_2409;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2410> AgradDistributionNormalSufficient_v_2410;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2411> AgradDistributionNormalSufficient_v_2411;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2412> AgradDistributionNormalSufficient_v_2412;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2413> AgradDistributionNormalSufficient_v_2413;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2414> AgradDistributionNormalSufficient_v_2414;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2415> AgradDistributionNormalSufficient_v_2415;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2416> AgradDistributionNormalSufficient_v_2416;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2417> AgradDistributionNormalSufficient_v_2417;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2418> AgradDistributionNormalSufficient_v_2418;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2419> AgradDistributionNormalSufficient_v_2419;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2420> AgradDistributionNormalSufficient_v_2420;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2421> AgradDistributionNormalSufficient_v_2421;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2422> AgradDistributionNormalSufficient_v_2422;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2423> AgradDistributionNormalSufficient_v_2423;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2424> AgradDistributionNormalSufficient_v_2424;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2425> AgradDistributionNormalSufficient_v_2425;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2426> AgradDistributionNormalSufficient_v_2426;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2427> AgradDistributionNormalSufficient_v_2427;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2428> AgradDistributionNormalSufficient_v_2428;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2429> AgradDistributionNormalSufficient_v_2429;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2430> AgradDistributionNormalSufficient_v_2430;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2431> AgradDistributionNormalSufficient_v_2431;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2432> AgradDistributionNormalSufficient_v_2432;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2433> AgradDistributionNormalSufficient_v_2433;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2434> AgradDistributionNormalSufficient_v_2434;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2435> AgradDistributionNormalSufficient_v_2435;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2436> AgradDistributionNormalSufficient_v_2436;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2437> AgradDistributionNormalSufficient_v_2437;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2438> AgradDistributionNormalSufficient_v_2438;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2439> AgradDistributionNormalSufficient_v_2439;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2440> AgradDistributionNormalSufficient_v_2440;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2441> AgradDistributionNormalSufficient_v_2441;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2442> AgradDistributionNormalSufficient_v_2442;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2443> AgradDistributionNormalSufficient_v_2443;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2444> AgradDistributionNormalSufficient_v_2444;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2445> AgradDistributionNormalSufficient_v_2445;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2446> AgradDistributionNormalSufficient_v_2446;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2447> AgradDistributionNormalSufficient_v_2447;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2448> AgradDistributionNormalSufficient_v_2448;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2449> AgradDistributionNormalSufficient_v_2449;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2450> AgradDistributionNormalSufficient_v_2450;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2451> AgradDistributionNormalSufficient_v_2451;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2452> AgradDistributionNormalSufficient_v_2452;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2453> AgradDistributionNormalSufficient_v_2453;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2454> AgradDistributionNormalSufficient_v_2454;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2455> AgradDistributionNormalSufficient_v_2455;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2456> AgradDistributionNormalSufficient_v_2456;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2457> AgradDistributionNormalSufficient_v_2457;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2458> AgradDistributionNormalSufficient_v_2458;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2459> AgradDistributionNormalSufficient_v_2459;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2460> AgradDistributionNormalSufficient_v_2460;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2461> AgradDistributionNormalSufficient_v_2461;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2462> AgradDistributionNormalSufficient_v_2462;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2463> AgradDistributionNormalSufficient_v_2463;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2464> AgradDistributionNormalSufficient_v_2464;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2465> AgradDistributionNormalSufficient_v_2465;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2466> AgradDistributionNormalSufficient_v_2466;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2467> AgradDistributionNormalSufficient_v_2467;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2468> AgradDistributionNormalSufficient_v_2468;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2469> AgradDistributionNormalSufficient_v_2469;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2470> AgradDistributionNormalSufficient_v_2470;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2471> AgradDistributionNormalSufficient_v_2471;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2472> AgradDistributionNormalSufficient_v_2472;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2473> AgradDistributionNormalSufficient_v_2473;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2474> AgradDistributionNormalSufficient_v_2474;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2475> AgradDistributionNormalSufficient_v_2475;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2476> AgradDistributionNormalSufficient_v_2476;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2477> AgradDistributionNormalSufficient_v_2477;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2478> AgradDistributionNormalSufficient_v_2478;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2479> AgradDistributionNormalSufficient_v_2479;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2480> AgradDistributionNormalSufficient_v_2480;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2481> AgradDistributionNormalSufficient_v_2481;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2482> AgradDistributionNormalSufficient_v_2482;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2483> AgradDistributionNormalSufficient_v_2483;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2484> AgradDistributionNormalSufficient_v_2484;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2485> AgradDistributionNormalSufficient_v_2485;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2486> AgradDistributionNormalSufficient_v_2486;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2487> AgradDistributionNormalSufficient_v_2487;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2488> AgradDistributionNormalSufficient_v_2488;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2489> AgradDistributionNormalSufficient_v_2489;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2490> AgradDistributionNormalSufficient_v_2490;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2491> AgradDistributionNormalSufficient_v_2491;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2492> AgradDistributionNormalSufficient_v_2492;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2493> AgradDistributionNormalSufficient_v_2493;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2494> AgradDistributionNormalSufficient_v_2494;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2495> AgradDistributionNormalSufficient_v_2495;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2496> AgradDistributionNormalSufficient_v_2496;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2497> AgradDistributionNormalSufficient_v_2497;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2498> AgradDistributionNormalSufficient_v_2498;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2499> AgradDistributionNormalSufficient_v_2499;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2400, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2400);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2401, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2401);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2402, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2402);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2403, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2403);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2404, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2404);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2405, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2405);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2406, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2406);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2407, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2407);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2408, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2408);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2409, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2409);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2410, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2410);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2411, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2411);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2412, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2412);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2413, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2413);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2414, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2414);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2415, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2415);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2416, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2416);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2417, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2417);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2418, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2418);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2419, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2419);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2420, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2420);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2421, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2421);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2422, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2422);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2423, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2423);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2424, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2424);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2425, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2425);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2426, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2426);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2427, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2427);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2428, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2428);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2429, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2429);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2430, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2430);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2431, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2431);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2432, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2432);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2433, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2433);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2434, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2434);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2435, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2435);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2436, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2436);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2437, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2437);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2438, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2438);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2439, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2439);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2440, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2440);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2441, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2441);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2442, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2442);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2443, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2443);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2444, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2444);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2445, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2445);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2446, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2446);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2447, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2447);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2448, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2448);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2449, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2449);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2450, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2450);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2451, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2451);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2452, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2452);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2453, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2453);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2454, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2454);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2455, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2455);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2456, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2456);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2457, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2457);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2458, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2458);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2459, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2459);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2460, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2460);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2461, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2461);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2462, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2462);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2463, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2463);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2464, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2464);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2465, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2465);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2466, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2466);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2467, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2467);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2468, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2468);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2469, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2469);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2470, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2470);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2471, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2471);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2472, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2472);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2473, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2473);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2474, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2474);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2475, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2475);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2476, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2476);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2477, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2477);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2478, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2478);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2479, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2479);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2480, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2480);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2481, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2481);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2482, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2482);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2483, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2483);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2484, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2484);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2485, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2485);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2486, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2486);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2487, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2487);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2488, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2488);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2489, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2489);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2490, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2490);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2491, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2491);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2492, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2492);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2493, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2493);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2494, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2494);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2495, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2495);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2496, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2496);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2497, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2497);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2498, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2498);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2499, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2499);
+
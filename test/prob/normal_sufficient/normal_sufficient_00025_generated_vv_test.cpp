@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/normal_sufficient/normal_sufficient_test.hpp>
+
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<int>, std::vector<double>, std::vector<double>, empty> type_vv_2500;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<int>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_2501;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<int>, std::vector<double>, var, empty> type_vv_2502;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<int>, std::vector<double>, std::vector<var>, empty> type_vv_2503;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<int>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_2504;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_vv_2505;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_vv_2506;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_2507;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_vv_2508;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_vv_2509;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_2510;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<int>, var, double, empty> type_vv_2511;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<int>, var, std::vector<double>, empty> type_vv_2512;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<int>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_2513;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<int>, var, var, empty> type_vv_2514;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<int>, var, std::vector<var>, empty> type_vv_2515;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<int>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_2516;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<int>, std::vector<var>, double, empty> type_vv_2517;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<int>, std::vector<var>, std::vector<double>, empty> type_vv_2518;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<int>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_2519;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<int>, std::vector<var>, var, empty> type_vv_2520;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<int>, std::vector<var>, std::vector<var>, empty> type_vv_2521;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<int>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_2522;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty> type_vv_2523;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty> type_vv_2524;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_2525;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty> type_vv_2526;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty> type_vv_2527;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_2528;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, double, empty> type_vv_2529;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_vv_2530;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_2531;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, var, empty> type_vv_2532;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<var>, empty> type_vv_2533;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_2534;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_vv_2535;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_vv_2536;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_2537;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, var, empty> type_vv_2538;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty> type_vv_2539;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_2540;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_vv_2541;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_vv_2542;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_2543;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_vv_2544;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_vv_2545;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_2546;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, double, empty> type_vv_2547;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<double>, empty> type_vv_2548;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_2549;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, var, empty> type_vv_2550;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<var>, empty> type_vv_2551;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_2552;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, double, empty> type_vv_2553;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty> type_vv_2554;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_2555;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, var, empty> type_vv_2556;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty> type_vv_2557;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_2558;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty> type_vv_2559;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty> type_vv_2560;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_2561;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty> type_vv_2562;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty> type_vv_2563;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_2564;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, double, double, empty> type_vv_2565;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, double, std::vector<double>, empty> type_vv_2566;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_2567;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, double, var, empty> type_vv_2568;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, double, std::vector<var>, empty> type_vv_2569;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_2570;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<double>, double, empty> type_vv_2571;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<double>, std::vector<double>, empty> type_vv_2572;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_2573;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<double>, var, empty> type_vv_2574;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<double>, std::vector<var>, empty> type_vv_2575;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_2576;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_vv_2577;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_vv_2578;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_2579;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_vv_2580;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_vv_2581;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_2582;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, var, double, empty> type_vv_2583;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, var, std::vector<double>, empty> type_vv_2584;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_2585;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, var, var, empty> type_vv_2586;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, var, std::vector<var>, empty> type_vv_2587;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_2588;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<var>, double, empty> type_vv_2589;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<var>, std::vector<double>, empty> type_vv_2590;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_2591;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<var>, var, empty> type_vv_2592;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<var>, std::vector<var>, empty> type_vv_2593;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_2594;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty> type_vv_2595;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty> type_vv_2596;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_2597;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty> type_vv_2598;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty> type_vv_2599;
+
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2500> AgradDistributionNormalSufficient_vv_2500;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2501> AgradDistributionNormalSufficient_vv_2501;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2502> AgradDistributionNormalSufficient_vv_2502;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2503> AgradDistributionNormalSufficient_vv_2503;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2504> AgradDistributionNormalSufficient_vv_2504;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2505> AgradDistributionNormalSufficient_vv_2505;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2506> AgradDistributionNormalSufficient_vv_2506;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2507> AgradDistributionNormalSufficient_vv_2507;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2508> AgradDistributionNormalSufficient_vv_2508;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2509> AgradDistributionNormalSufficient_vv_2509;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2510> AgradDistributionNormalSufficient_vv_2510;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2511> AgradDistributionNormalSufficient_vv_2511;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2512> AgradDistributionNormalSufficient_vv_2512;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2513> AgradDistributionNormalSufficient_vv_2513;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2514> AgradDistributionNormalSufficient_vv_2514;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2515> AgradDistributionNormalSufficient_vv_2515;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2516> AgradDistributionNormalSufficient_vv_2516;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2517> AgradDistributionNormalSufficient_vv_2517;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2518> AgradDistributionNormalSufficient_vv_2518;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2519> AgradDistributionNormalSufficient_vv_2519;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2520> AgradDistributionNormalSufficient_vv_2520;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2521> AgradDistributionNormalSufficient_vv_2521;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2522> AgradDistributionNormalSufficient_vv_2522;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2523> AgradDistributionNormalSufficient_vv_2523;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2524> AgradDistributionNormalSufficient_vv_2524;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2525> AgradDistributionNormalSufficient_vv_2525;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2526> AgradDistributionNormalSufficient_vv_2526;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2527> AgradDistributionNormalSufficient_vv_2527;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2528> AgradDistributionNormalSufficient_vv_2528;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2529> AgradDistributionNormalSufficient_vv_2529;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2530> AgradDistributionNormalSufficient_vv_2530;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2531> AgradDistributionNormalSufficient_vv_2531;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2532> AgradDistributionNormalSufficient_vv_2532;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2533> AgradDistributionNormalSufficient_vv_2533;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2534> AgradDistributionNormalSufficient_vv_2534;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2535> AgradDistributionNormalSufficient_vv_2535;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2536> AgradDistributionNormalSufficient_vv_2536;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2537> AgradDistributionNormalSufficient_vv_2537;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2538> AgradDistributionNormalSufficient_vv_2538;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2539> AgradDistributionNormalSufficient_vv_2539;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2540> AgradDistributionNormalSufficient_vv_2540;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2541> AgradDistributionNormalSufficient_vv_2541;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2542> AgradDistributionNormalSufficient_vv_2542;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2543> AgradDistributionNormalSufficient_vv_2543;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2544> AgradDistributionNormalSufficient_vv_2544;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2545> AgradDistributionNormalSufficient_vv_2545;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2546> AgradDistributionNormalSufficient_vv_2546;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2547> AgradDistributionNormalSufficient_vv_2547;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2548> AgradDistributionNormalSufficient_vv_2548;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2549> AgradDistributionNormalSufficient_vv_2549;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2550> AgradDistributionNormalSufficient_vv_2550;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2551> AgradDistributionNormalSufficient_vv_2551;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2552> AgradDistributionNormalSufficient_vv_2552;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2553> AgradDistributionNormalSufficient_vv_2553;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2554> AgradDistributionNormalSufficient_vv_2554;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2555> AgradDistributionNormalSufficient_vv_2555;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2556> AgradDistributionNormalSufficient_vv_2556;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2557> AgradDistributionNormalSufficient_vv_2557;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2558> AgradDistributionNormalSufficient_vv_2558;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2559> AgradDistributionNormalSufficient_vv_2559;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2560> AgradDistributionNormalSufficient_vv_2560;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2561> AgradDistributionNormalSufficient_vv_2561;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2562> AgradDistributionNormalSufficient_vv_2562;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2563> AgradDistributionNormalSufficient_vv_2563;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2564> AgradDistributionNormalSufficient_vv_2564;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2565> AgradDistributionNormalSufficient_vv_2565;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2566> AgradDistributionNormalSufficient_vv_2566;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2567> AgradDistributionNormalSufficient_vv_2567;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2568> AgradDistributionNormalSufficient_vv_2568;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2569> AgradDistributionNormalSufficient_vv_2569;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2570> AgradDistributionNormalSufficient_vv_2570;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2571> AgradDistributionNormalSufficient_vv_2571;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2572> AgradDistributionNormalSufficient_vv_2572;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2573> AgradDistributionNormalSufficient_vv_2573;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2574> AgradDistributionNormalSufficient_vv_2574;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2575> AgradDistributionNormalSufficient_vv_2575;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2576> AgradDistributionNormalSufficient_vv_2576;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2577> AgradDistributionNormalSufficient_vv_2577;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2578> AgradDistributionNormalSufficient_vv_2578;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2579> AgradDistributionNormalSufficient_vv_2579;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2580> AgradDistributionNormalSufficient_vv_2580;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2581> AgradDistributionNormalSufficient_vv_2581;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2582> AgradDistributionNormalSufficient_vv_2582;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2583> AgradDistributionNormalSufficient_vv_2583;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2584> AgradDistributionNormalSufficient_vv_2584;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2585> AgradDistributionNormalSufficient_vv_2585;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2586> AgradDistributionNormalSufficient_vv_2586;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2587> AgradDistributionNormalSufficient_vv_2587;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2588> AgradDistributionNormalSufficient_vv_2588;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2589> AgradDistributionNormalSufficient_vv_2589;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2590> AgradDistributionNormalSufficient_vv_2590;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2591> AgradDistributionNormalSufficient_vv_2591;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2592> AgradDistributionNormalSufficient_vv_2592;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2593> AgradDistributionNormalSufficient_vv_2593;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2594> AgradDistributionNormalSufficient_vv_2594;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2595> AgradDistributionNormalSufficient_vv_2595;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2596> AgradDistributionNormalSufficient_vv_2596;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2597> AgradDistributionNormalSufficient_vv_2597;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2598> AgradDistributionNormalSufficient_vv_2598;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2599> AgradDistributionNormalSufficient_vv_2599;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2500, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2500);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2501, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2501);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2502, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2502);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2503, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2503);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2504, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2504);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2505, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2505);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2506, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2506);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2507, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2507);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2508, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2508);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2509, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2509);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2510, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2510);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2511, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2511);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2512, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2512);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2513, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2513);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2514, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2514);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2515, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2515);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2516, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2516);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2517, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2517);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2518, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2518);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2519, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2519);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2520, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2520);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2521, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2521);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2522, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2522);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2523, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2523);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2524, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2524);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2525, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2525);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2526, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2526);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2527, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2527);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2528, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2528);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2529, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2529);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2530, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2530);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2531, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2531);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2532, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2532);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2533, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2533);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2534, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2534);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2535, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2535);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2536, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2536);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2537, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2537);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2538, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2538);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2539, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2539);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2540, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2540);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2541, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2541);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2542, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2542);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2543, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2543);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2544, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2544);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2545, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2545);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2546, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2546);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2547, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2547);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2548, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2548);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2549, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2549);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2550, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2550);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2551, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2551);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2552, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2552);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2553, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2553);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2554, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2554);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2555, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2555);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2556, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2556);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2557, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2557);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2558, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2558);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2559, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2559);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2560, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2560);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2561, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2561);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2562, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2562);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2563, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2563);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2564, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2564);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2565, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2565);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2566, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2566);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2567, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2567);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2568, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2568);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2569, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2569);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2570, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2570);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2571, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2571);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2572, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2572);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2573, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2573);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2574, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2574);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2575, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2575);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2576, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2576);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2577, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2577);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2578, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2578);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2579, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2579);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2580, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2580);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2581, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2581);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2582, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2582);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2583, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2583);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2584, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2584);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2585, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2585);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2586, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2586);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2587, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2587);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2588, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2588);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2589, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2589);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2590, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2590);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2591, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2591);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2592, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2592);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2593, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2593);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2594, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2594);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2595, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2595);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2596, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2596);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2597, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2597);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2598, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2598);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2599, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2599);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/normal_sufficient/normal_sufficient_test.hpp>
+
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_2600;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, double, double, empty> type_vv_2601;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, double, std::vector<double>, empty> type_vv_2602;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_2603;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, double, var, empty> type_vv_2604;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, double, std::vector<var>, empty> type_vv_2605;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_2606;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, double, empty> type_vv_2607;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, std::vector<double>, empty> type_vv_2608;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_2609;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, var, empty> type_vv_2610;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, std::vector<var>, empty> type_vv_2611;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_2612;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_vv_2613;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_vv_2614;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_2615;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_vv_2616;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_vv_2617;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_2618;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, var, double, empty> type_vv_2619;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, var, std::vector<double>, empty> type_vv_2620;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_2621;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, var, var, empty> type_vv_2622;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, var, std::vector<var>, empty> type_vv_2623;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_2624;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<var>, double, empty> type_vv_2625;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<var>, std::vector<double>, empty> type_vv_2626;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_2627;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<var>, var, empty> type_vv_2628;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<var>, std::vector<var>, empty> type_vv_2629;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_2630;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty> type_vv_2631;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty> type_vv_2632;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_2633;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty> type_vv_2634;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty> type_vv_2635;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_2636;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, double, empty> type_vv_2637;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_vv_2638;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_2639;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, var, empty> type_vv_2640;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<var>, empty> type_vv_2641;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_2642;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_vv_2643;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_vv_2644;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_2645;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, var, empty> type_vv_2646;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty> type_vv_2647;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_2648;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_vv_2649;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_vv_2650;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_2651;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_vv_2652;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_vv_2653;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_2654;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, double, empty> type_vv_2655;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<double>, empty> type_vv_2656;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_2657;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, var, empty> type_vv_2658;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<var>, empty> type_vv_2659;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_2660;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, double, empty> type_vv_2661;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty> type_vv_2662;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_2663;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, var, empty> type_vv_2664;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty> type_vv_2665;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_2666;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty> type_vv_2667;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty> type_vv_2668;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_2669;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty> type_vv_2670;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty> type_vv_2671;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_2672;
+typedef std::tuple<std::vector<var>, var, int, double, double, empty> type_vv_2673;
+typedef std::tuple<std::vector<var>, var, int, double, std::vector<double>, empty> type_vv_2674;
+typedef std::tuple<std::vector<var>, var, int, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_2675;
+typedef std::tuple<std::vector<var>, var, int, double, var, empty> type_vv_2676;
+typedef std::tuple<std::vector<var>, var, int, double, std::vector<var>, empty> type_vv_2677;
+typedef std::tuple<std::vector<var>, var, int, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_2678;
+typedef std::tuple<std::vector<var>, var, int, std::vector<double>, double, empty> type_vv_2679;
+typedef std::tuple<std::vector<var>, var, int, std::vector<double>, std::vector<double>, empty> type_vv_2680;
+typedef std::tuple<std::vector<var>, var, int, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_2681;
+typedef std::tuple<std::vector<var>, var, int, std::vector<double>, var, empty> type_vv_2682;
+typedef std::tuple<std::vector<var>, var, int, std::vector<double>, std::vector<var>, empty> type_vv_2683;
+typedef std::tuple<std::vector<var>, var, int, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_2684;
+typedef std::tuple<std::vector<var>, var, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_vv_2685;
+typedef std::tuple<std::vector<var>, var, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_vv_2686;
+typedef std::tuple<std::vector<var>, var, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_2687;
+typedef std::tuple<std::vector<var>, var, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_vv_2688;
+typedef std::tuple<std::vector<var>, var, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_vv_2689;
+typedef std::tuple<std::vector<var>, var, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_2690;
+typedef std::tuple<std::vector<var>, var, int, var, double, empty> type_vv_2691;
+typedef std::tuple<std::vector<var>, var, int, var, std::vector<double>, empty> type_vv_2692;
+typedef std::tuple<std::vector<var>, var, int, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_2693;
+typedef std::tuple<std::vector<var>, var, int, var, var, empty> type_vv_2694;
+typedef std::tuple<std::vector<var>, var, int, var, std::vector<var>, empty> type_vv_2695;
+typedef std::tuple<std::vector<var>, var, int, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_2696;
+typedef std::tuple<std::vector<var>, var, int, std::vector<var>, double, empty> type_vv_2697;
+typedef std::tuple<std::vector<var>, var, int, std::vector<var>, std::vector<double>, empty> type_vv_2698;
+typedef std::tuple<std::vector<var>, var, int, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_2699;
+
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2600> AgradDistributionNormalSufficient_vv_2600;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2601> AgradDistributionNormalSufficient_vv_2601;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2602> AgradDistributionNormalSufficient_vv_2602;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2603> AgradDistributionNormalSufficient_vv_2603;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2604> AgradDistributionNormalSufficient_vv_2604;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2605> AgradDistributionNormalSufficient_vv_2605;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2606> AgradDistributionNormalSufficient_vv_2606;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2607> AgradDistributionNormalSufficient_vv_2607;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2608> AgradDistributionNormalSufficient_vv_2608;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2609> AgradDistributionNormalSufficient_vv_2609;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2610> AgradDistributionNormalSufficient_vv_2610;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2611> AgradDistributionNormalSufficient_vv_2611;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2612> AgradDistributionNormalSufficient_vv_2612;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2613> AgradDistributionNormalSufficient_vv_2613;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2614> AgradDistributionNormalSufficient_vv_2614;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2615> AgradDistributionNormalSufficient_vv_2615;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2616> AgradDistributionNormalSufficient_vv_2616;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2617> AgradDistributionNormalSufficient_vv_2617;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2618> AgradDistributionNormalSufficient_vv_2618;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2619> AgradDistributionNormalSufficient_vv_2619;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2620> AgradDistributionNormalSufficient_vv_2620;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2621> AgradDistributionNormalSufficient_vv_2621;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2622> AgradDistributionNormalSufficient_vv_2622;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2623> AgradDistributionNormalSufficient_vv_2623;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2624> AgradDistributionNormalSufficient_vv_2624;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2625> AgradDistributionNormalSufficient_vv_2625;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2626> AgradDistributionNormalSufficient_vv_2626;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2627> AgradDistributionNormalSufficient_vv_2627;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2628> AgradDistributionNormalSufficient_vv_2628;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2629> AgradDistributionNormalSufficient_vv_2629;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2630> AgradDistributionNormalSufficient_vv_2630;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2631> AgradDistributionNormalSufficient_vv_2631;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2632> AgradDistributionNormalSufficient_vv_2632;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2633> AgradDistributionNormalSufficient_vv_2633;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2634> AgradDistributionNormalSufficient_vv_2634;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2635> AgradDistributionNormalSufficient_vv_2635;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2636> AgradDistributionNormalSufficient_vv_2636;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2637> AgradDistributionNormalSufficient_vv_2637;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2638> AgradDistributionNormalSufficient_vv_2638;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2639> AgradDistributionNormalSufficient_vv_2639;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2640> AgradDistributionNormalSufficient_vv_2640;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2641> AgradDistributionNormalSufficient_vv_2641;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2642> AgradDistributionNormalSufficient_vv_2642;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2643> AgradDistributionNormalSufficient_vv_2643;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2644> AgradDistributionNormalSufficient_vv_2644;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2645> AgradDistributionNormalSufficient_vv_2645;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2646> AgradDistributionNormalSufficient_vv_2646;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2647> AgradDistributionNormalSufficient_vv_2647;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2648> AgradDistributionNormalSufficient_vv_2648;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2649> AgradDistributionNormalSufficient_vv_2649;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2650> AgradDistributionNormalSufficient_vv_2650;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2651> AgradDistributionNormalSufficient_vv_2651;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2652> AgradDistributionNormalSufficient_vv_2652;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2653> AgradDistributionNormalSufficient_vv_2653;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2654> AgradDistributionNormalSufficient_vv_2654;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2655> AgradDistributionNormalSufficient_vv_2655;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2656> AgradDistributionNormalSufficient_vv_2656;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2657> AgradDistributionNormalSufficient_vv_2657;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2658> AgradDistributionNormalSufficient_vv_2658;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2659> AgradDistributionNormalSufficient_vv_2659;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2660> AgradDistributionNormalSufficient_vv_2660;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2661> AgradDistributionNormalSufficient_vv_2661;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2662> AgradDistributionNormalSufficient_vv_2662;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2663> AgradDistributionNormalSufficient_vv_2663;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2664> AgradDistributionNormalSufficient_vv_2664;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2665> AgradDistributionNormalSufficient_vv_2665;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2666> AgradDistributionNormalSufficient_vv_2666;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2667> AgradDistributionNormalSufficient_vv_2667;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2668> AgradDistributionNormalSufficient_vv_2668;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2669> AgradDistributionNormalSufficient_vv_2669;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2670> AgradDistributionNormalSufficient_vv_2670;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2671> AgradDistributionNormalSufficient_vv_2671;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2672> AgradDistributionNormalSufficient_vv_2672;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2673> AgradDistributionNormalSufficient_vv_2673;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2674> AgradDistributionNormalSufficient_vv_2674;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2675> AgradDistributionNormalSufficient_vv_2675;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2676> AgradDistributionNormalSufficient_vv_2676;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2677> AgradDistributionNormalSufficient_vv_2677;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2678> AgradDistributionNormalSufficient_vv_2678;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2679> AgradDistributionNormalSufficient_vv_2679;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2680> AgradDistributionNormalSufficient_vv_2680;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2681> AgradDistributionNormalSufficient_vv_2681;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2682> AgradDistributionNormalSufficient_vv_2682;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2683> AgradDistributionNormalSufficient_vv_2683;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2684> AgradDistributionNormalSufficient_vv_2684;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2685> AgradDistributionNormalSufficient_vv_2685;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2686> AgradDistributionNormalSufficient_vv_2686;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2687> AgradDistributionNormalSufficient_vv_2687;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2688> AgradDistributionNormalSufficient_vv_2688;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2689> AgradDistributionNormalSufficient_vv_2689;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2690> AgradDistributionNormalSufficient_vv_2690;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2691> AgradDistributionNormalSufficient_vv_2691;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2692> AgradDistributionNormalSufficient_vv_2692;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2693> AgradDistributionNormalSufficient_vv_2693;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2694> AgradDistributionNormalSufficient_vv_2694;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2695> AgradDistributionNormalSufficient_vv_2695;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2696> AgradDistributionNormalSufficient_vv_2696;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2697> AgradDistributionNormalSufficient_vv_2697;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2698> AgradDistributionNormalSufficient_vv_2698;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_2699> AgradDistributionNormalSufficient_vv_2699;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2600, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2600);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2601, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2601);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2602, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2602);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2603, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2603);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2604, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2604);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2605, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2605);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2606, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2606);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2607, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2607);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2608, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2608);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2609, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2609);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2610, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2610);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2611, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2611);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2612, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2612);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2613, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2613);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2614, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2614);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2615, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2615);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2616, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2616);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2617, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2617);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2618, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2618);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2619, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2619);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2620, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2620);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2621, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2621);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2622, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2622);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2623, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2623);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2624, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2624);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2625, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2625);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2626, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2626);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2627, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2627);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2628, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2628);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2629, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2629);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2630, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2630);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2631, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2631);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2632, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2632);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2633, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2633);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2634, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2634);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2635, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2635);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2636, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2636);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2637, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2637);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2638, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2638);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2639, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2639);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2640, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2640);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2641, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2641);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2642, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2642);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2643, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2643);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2644, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2644);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2645, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2645);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2646, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2646);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2647, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2647);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2648, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2648);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2649, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2649);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2650, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2650);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2651, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2651);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2652, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2652);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2653, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2653);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2654, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2654);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2655, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2655);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2656, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2656);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2657, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2657);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2658, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2658);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2659, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2659);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2660, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2660);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2661, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2661);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2662, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2662);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2663, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2663);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2664, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2664);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2665, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2665);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2666, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2666);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2667, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2667);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2668, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2668);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2669, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2669);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2670, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2670);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2671, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2671);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2672, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2672);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2673, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2673);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2674, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2674);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2675, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2675);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2676, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2676);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2677, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2677);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2678, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2678);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2679, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2679);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2680, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2680);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2681, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2681);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2682, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2682);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2683, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2683);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2684, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2684);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2685, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2685);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2686, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2686);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2687, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2687);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2688, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2688);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2689, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2689);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2690, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2690);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2691, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2691);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2692, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2692);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2693, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2693);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2694, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2694);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2695, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2695);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2696, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2696);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2697, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2697);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2698, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2698);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_2699, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_2699);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/normal_sufficient/normal_sufficient_test.hpp>
+
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, int, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_2700;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, int, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_2701;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2702;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_2703;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_2704;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2705;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_2706;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_2707;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2708;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<int>, double, double, empty> type_ffv_2709;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<int>, double, std::vector<double>, empty> type_ffv_2710;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<int>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2711;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<int>, double, fvar<fvar<var> >, empty> type_ffv_2712;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<int>, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_2713;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<int>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2714;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<int>, std::vector<double>, double, empty> type_ffv_2715;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<int>, std::vector<double>, std::vector<double>, empty> type_ffv_2716;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<int>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2717;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<int>, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_2718;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<int>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_2719;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<int>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2720;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffv_2721;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_2722;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2723;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_2724;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_2725;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2726;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<int>, fvar<fvar<var> >, double, empty> type_ffv_2727;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<int>, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_2728;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2729;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<int>, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_2730;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<int>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_2731;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2732;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<int>, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_2733;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_2734;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2735;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<int>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_2736;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_2737;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2738;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_2739;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_2740;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2741;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_2742;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_2743;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2744;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, double, empty> type_ffv_2745;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_ffv_2746;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2747;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty> type_ffv_2748;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_2749;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2750;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_ffv_2751;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_ffv_2752;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2753;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_2754;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_2755;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2756;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffv_2757;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_2758;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2759;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_2760;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_2761;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2762;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty> type_ffv_2763;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_2764;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2765;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_2766;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_2767;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2768;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_2769;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_2770;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2771;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_2772;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_2773;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2774;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_2775;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_2776;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2777;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_2778;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_2779;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2780;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, int, double, double, empty> type_ffv_2781;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, int, double, std::vector<double>, empty> type_ffv_2782;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, int, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2783;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, int, double, fvar<fvar<var> >, empty> type_ffv_2784;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, int, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_2785;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, int, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2786;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, int, std::vector<double>, double, empty> type_ffv_2787;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, int, std::vector<double>, std::vector<double>, empty> type_ffv_2788;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, int, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2789;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, int, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_2790;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, int, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_2791;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, int, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2792;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffv_2793;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_2794;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2795;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_2796;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_2797;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2798;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, int, fvar<fvar<var> >, double, empty> type_ffv_2799;
+
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2700> AgradDistributionNormalSufficient_ffv_2700;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2701> AgradDistributionNormalSufficient_ffv_2701;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2702> AgradDistributionNormalSufficient_ffv_2702;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2703> AgradDistributionNormalSufficient_ffv_2703;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2704> AgradDistributionNormalSufficient_ffv_2704;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2705> AgradDistributionNormalSufficient_ffv_2705;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2706> AgradDistributionNormalSufficient_ffv_2706;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2707> AgradDistributionNormalSufficient_ffv_2707;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2708> AgradDistributionNormalSufficient_ffv_2708;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2709> AgradDistributionNormalSufficient_ffv_2709;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2710> AgradDistributionNormalSufficient_ffv_2710;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2711> AgradDistributionNormalSufficient_ffv_2711;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2712> AgradDistributionNormalSufficient_ffv_2712;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2713> AgradDistributionNormalSufficient_ffv_2713;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2714> AgradDistributionNormalSufficient_ffv_2714;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2715> AgradDistributionNormalSufficient_ffv_2715;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2716> AgradDistributionNormalSufficient_ffv_2716;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2717> AgradDistributionNormalSufficient_ffv_2717;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2718> AgradDistributionNormalSufficient_ffv_2718;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2719> AgradDistributionNormalSufficient_ffv_2719;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2720> AgradDistributionNormalSufficient_ffv_2720;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2721> AgradDistributionNormalSufficient_ffv_2721;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2722> AgradDistributionNormalSufficient_ffv_2722;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2723> AgradDistributionNormalSufficient_ffv_2723;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2724> AgradDistributionNormalSufficient_ffv_2724;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2725> AgradDistributionNormalSufficient_ffv_2725;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2726> AgradDistributionNormalSufficient_ffv_2726;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2727> AgradDistributionNormalSufficient_ffv_2727;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2728> AgradDistributionNormalSufficient_ffv_2728;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2729> AgradDistributionNormalSufficient_ffv_2729;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2730> AgradDistributionNormalSufficient_ffv_2730;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2731> AgradDistributionNormalSufficient_ffv_2731;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2732> AgradDistributionNormalSufficient_ffv_2732;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2733> AgradDistributionNormalSufficient_ffv_2733;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2734> AgradDistributionNormalSufficient_ffv_2734;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2735> AgradDistributionNormalSufficient_ffv_2735;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2736> AgradDistributionNormalSufficient_ffv_2736;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2737> AgradDistributionNormalSufficient_ffv_2737;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2738> AgradDistributionNormalSufficient_ffv_2738;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2739> AgradDistributionNormalSufficient_ffv_2739;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2740> AgradDistributionNormalSufficient_ffv_2740;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2741> AgradDistributionNormalSufficient_ffv_2741;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2742> AgradDistributionNormalSufficient_ffv_2742;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2743> AgradDistributionNormalSufficient_ffv_2743;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2744> AgradDistributionNormalSufficient_ffv_2744;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2745> AgradDistributionNormalSufficient_ffv_2745;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2746> AgradDistributionNormalSufficient_ffv_2746;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2747> AgradDistributionNormalSufficient_ffv_2747;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2748> AgradDistributionNormalSufficient_ffv_2748;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2749> AgradDistributionNormalSufficient_ffv_2749;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2750> AgradDistributionNormalSufficient_ffv_2750;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2751> AgradDistributionNormalSufficient_ffv_2751;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2752> AgradDistributionNormalSufficient_ffv_2752;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2753> AgradDistributionNormalSufficient_ffv_2753;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2754> AgradDistributionNormalSufficient_ffv_2754;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2755> AgradDistributionNormalSufficient_ffv_2755;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2756> AgradDistributionNormalSufficient_ffv_2756;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2757> AgradDistributionNormalSufficient_ffv_2757;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2758> AgradDistributionNormalSufficient_ffv_2758;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2759> AgradDistributionNormalSufficient_ffv_2759;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2760> AgradDistributionNormalSufficient_ffv_2760;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2761> AgradDistributionNormalSufficient_ffv_2761;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2762> AgradDistributionNormalSufficient_ffv_2762;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2763> AgradDistributionNormalSufficient_ffv_2763;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2764> AgradDistributionNormalSufficient_ffv_2764;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2765> AgradDistributionNormalSufficient_ffv_2765;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2766> AgradDistributionNormalSufficient_ffv_2766;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2767> AgradDistributionNormalSufficient_ffv_2767;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2768> AgradDistributionNormalSufficient_ffv_2768;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2769> AgradDistributionNormalSufficient_ffv_2769;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2770> AgradDistributionNormalSufficient_ffv_2770;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2771> AgradDistributionNormalSufficient_ffv_2771;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2772> AgradDistributionNormalSufficient_ffv_2772;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2773> AgradDistributionNormalSufficient_ffv_2773;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2774> AgradDistributionNormalSufficient_ffv_2774;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2775> AgradDistributionNormalSufficient_ffv_2775;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2776> AgradDistributionNormalSufficient_ffv_2776;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2777> AgradDistributionNormalSufficient_ffv_2777;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2778> AgradDistributionNormalSufficient_ffv_2778;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2779> AgradDistributionNormalSufficient_ffv_2779;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2780> AgradDistributionNormalSufficient_ffv_2780;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2781> AgradDistributionNormalSufficient_ffv_2781;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2782> AgradDistributionNormalSufficient_ffv_2782;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2783> AgradDistributionNormalSufficient_ffv_2783;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2784> AgradDistributionNormalSufficient_ffv_2784;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2785> AgradDistributionNormalSufficient_ffv_2785;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2786> AgradDistributionNormalSufficient_ffv_2786;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2787> AgradDistributionNormalSufficient_ffv_2787;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2788> AgradDistributionNormalSufficient_ffv_2788;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2789> AgradDistributionNormalSufficient_ffv_2789;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2790> AgradDistributionNormalSufficient_ffv_2790;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2791> AgradDistributionNormalSufficient_ffv_2791;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2792> AgradDistributionNormalSufficient_ffv_2792;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2793> AgradDistributionNormalSufficient_ffv_2793;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2794> AgradDistributionNormalSufficient_ffv_2794;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2795> AgradDistributionNormalSufficient_ffv_2795;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2796> AgradDistributionNormalSufficient_ffv_2796;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2797> AgradDistributionNormalSufficient_ffv_2797;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2798> AgradDistributionNormalSufficient_ffv_2798;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2799> AgradDistributionNormalSufficient_ffv_2799;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2700, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2700);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2701, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2701);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2702, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2702);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2703, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2703);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2704, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2704);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2705, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2705);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2706, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2706);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2707, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2707);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2708, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2708);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2709, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2709);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2710, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2710);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2711, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2711);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2712, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2712);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2713, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2713);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2714, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2714);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2715, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2715);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2716, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2716);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2717, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2717);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2718, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2718);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2719, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2719);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2720, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2720);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2721, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2721);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2722, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2722);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2723, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2723);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2724, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2724);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2725, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2725);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2726, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2726);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2727, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2727);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2728, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2728);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2729, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2729);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2730, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2730);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2731, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2731);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2732, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2732);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2733, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2733);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2734, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2734);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2735, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2735);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2736, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2736);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2737, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2737);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2738, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2738);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2739, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2739);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2740, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2740);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2741, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2741);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2742, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2742);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2743, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2743);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2744, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2744);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2745, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2745);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2746, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2746);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2747, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2747);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2748, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2748);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2749, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2749);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2750, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2750);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2751, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2751);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2752, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2752);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2753, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2753);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2754, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2754);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2755, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2755);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2756, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2756);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2757, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2757);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2758, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2758);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2759, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2759);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2760, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2760);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2761, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2761);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2762, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2762);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2763, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2763);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2764, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2764);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2765, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2765);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2766, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2766);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2767, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2767);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2768, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2768);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2769, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2769);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2770, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2770);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2771, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2771);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2772, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2772);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2773, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2773);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2774, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2774);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2775, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2775);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2776, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2776);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2777, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2777);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2778, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2778);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2779, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2779);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2780, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2780);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2781, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2781);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2782, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2782);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2783, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2783);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2784, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2784);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2785, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2785);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2786, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2786);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2787, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2787);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2788, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2788);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2789, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2789);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2790, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2790);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2791, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2791);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2792, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2792);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2793, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2793);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2794, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2794);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2795, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2795);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2796, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2796);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2797, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2797);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2798, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2798);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2799, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2799);
+
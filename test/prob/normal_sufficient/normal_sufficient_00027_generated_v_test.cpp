@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/normal_sufficient/normal_sufficient_test.hpp>
+
+typedef std::tuple<std::vector<var>, std::vector<double>, int, double, double, empty> type_v_2700;
+typedef std::tuple<std::vector<var>, std::vector<double>, int, double, std::vector<double>, empty> type_v_2701;
+typedef std::tuple<std::vector<var>, std::vector<double>, int, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2702;
+typedef std::tuple<std::vector<var>, std::vector<double>, int, double, var, empty> type_v_2703;
+typedef std::tuple<std::vector<var>, std::vector<double>, int, double, std::vector<var>, empty> type_v_2704;
+typedef std::tuple<std::vector<var>, std::vector<double>, int, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2705;
+typedef std::tuple<std::vector<var>, std::vector<double>, int, std::vector<double>, double, empty> type_v_2706;
+typedef std::tuple<std::vector<var>, std::vector<double>, int, std::vector<double>, std::vector<double>, empty> type_v_2707;
+typedef std::tuple<std::vector<var>, std::vector<double>, int, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2708;
+typedef std::tuple<std::vector<var>, std::vector<double>, int, std::vector<double>, var, empty> type_v_2709;
+typedef std::tuple<std::vector<var>, std::vector<double>, int, std::vector<double>, std::vector<var>, empty> type_v_2710;
+typedef std::tuple<std::vector<var>, std::vector<double>, int, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2711;
+typedef std::tuple<std::vector<var>, std::vector<double>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_2712;
+typedef std::tuple<std::vector<var>, std::vector<double>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_2713;
+typedef std::tuple<std::vector<var>, std::vector<double>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2714;
+typedef std::tuple<std::vector<var>, std::vector<double>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_2715;
+typedef std::tuple<std::vector<var>, std::vector<double>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_2716;
+typedef std::tuple<std::vector<var>, std::vector<double>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2717;
+typedef std::tuple<std::vector<var>, std::vector<double>, int, var, double, empty> type_v_2718;
+typedef std::tuple<std::vector<var>, std::vector<double>, int, var, std::vector<double>, empty> type_v_2719;
+typedef std::tuple<std::vector<var>, std::vector<double>, int, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2720;
+typedef std::tuple<std::vector<var>, std::vector<double>, int, var, var, empty> type_v_2721;
+typedef std::tuple<std::vector<var>, std::vector<double>, int, var, std::vector<var>, empty> type_v_2722;
+typedef std::tuple<std::vector<var>, std::vector<double>, int, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2723;
+typedef std::tuple<std::vector<var>, std::vector<double>, int, std::vector<var>, double, empty> type_v_2724;
+typedef std::tuple<std::vector<var>, std::vector<double>, int, std::vector<var>, std::vector<double>, empty> type_v_2725;
+typedef std::tuple<std::vector<var>, std::vector<double>, int, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2726;
+typedef std::tuple<std::vector<var>, std::vector<double>, int, std::vector<var>, var, empty> type_v_2727;
+typedef std::tuple<std::vector<var>, std::vector<double>, int, std::vector<var>, std::vector<var>, empty> type_v_2728;
+typedef std::tuple<std::vector<var>, std::vector<double>, int, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2729;
+typedef std::tuple<std::vector<var>, std::vector<double>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_2730;
+typedef std::tuple<std::vector<var>, std::vector<double>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_2731;
+typedef std::tuple<std::vector<var>, std::vector<double>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2732;
+typedef std::tuple<std::vector<var>, std::vector<double>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_2733;
+typedef std::tuple<std::vector<var>, std::vector<double>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_2734;
+typedef std::tuple<std::vector<var>, std::vector<double>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2735;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<int>, double, double, empty> type_v_2736;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<int>, double, std::vector<double>, empty> type_v_2737;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<int>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2738;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<int>, double, var, empty> type_v_2739;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<int>, double, std::vector<var>, empty> type_v_2740;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<int>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2741;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<int>, std::vector<double>, double, empty> type_v_2742;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<int>, std::vector<double>, std::vector<double>, empty> type_v_2743;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<int>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2744;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<int>, std::vector<double>, var, empty> type_v_2745;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<int>, std::vector<double>, std::vector<var>, empty> type_v_2746;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<int>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2747;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_2748;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_2749;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2750;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_2751;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_2752;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2753;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<int>, var, double, empty> type_v_2754;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<int>, var, std::vector<double>, empty> type_v_2755;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<int>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2756;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<int>, var, var, empty> type_v_2757;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<int>, var, std::vector<var>, empty> type_v_2758;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<int>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2759;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<int>, std::vector<var>, double, empty> type_v_2760;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<int>, std::vector<var>, std::vector<double>, empty> type_v_2761;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<int>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2762;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<int>, std::vector<var>, var, empty> type_v_2763;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<int>, std::vector<var>, std::vector<var>, empty> type_v_2764;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<int>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2765;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_2766;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_2767;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2768;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_2769;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_2770;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2771;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, double, empty> type_v_2772;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_v_2773;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2774;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, var, empty> type_v_2775;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<var>, empty> type_v_2776;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2777;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_v_2778;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_v_2779;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2780;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, var, empty> type_v_2781;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty> type_v_2782;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2783;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_2784;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_2785;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2786;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_2787;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_2788;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2789;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, double, empty> type_v_2790;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<double>, empty> type_v_2791;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2792;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, var, empty> type_v_2793;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<var>, empty> type_v_2794;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2795;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, double, empty> type_v_2796;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty> type_v_2797;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2798;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, var, empty> type_v_2799;
+
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2700> AgradDistributionNormalSufficient_v_2700;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2701> AgradDistributionNormalSufficient_v_2701;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2702> AgradDistributionNormalSufficient_v_2702;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2703> AgradDistributionNormalSufficient_v_2703;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2704> AgradDistributionNormalSufficient_v_2704;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2705> AgradDistributionNormalSufficient_v_2705;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2706> AgradDistributionNormalSufficient_v_2706;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2707> AgradDistributionNormalSufficient_v_2707;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2708> AgradDistributionNormalSufficient_v_2708;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2709> AgradDistributionNormalSufficient_v_2709;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2710> AgradDistributionNormalSufficient_v_2710;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2711> AgradDistributionNormalSufficient_v_2711;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2712> AgradDistributionNormalSufficient_v_2712;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2713> AgradDistributionNormalSufficient_v_2713;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2714> AgradDistributionNormalSufficient_v_2714;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2715> AgradDistributionNormalSufficient_v_2715;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2716> AgradDistributionNormalSufficient_v_2716;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2717> AgradDistributionNormalSufficient_v_2717;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2718> AgradDistributionNormalSufficient_v_2718;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2719> AgradDistributionNormalSufficient_v_2719;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2720> AgradDistributionNormalSufficient_v_2720;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2721> AgradDistributionNormalSufficient_v_2721;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2722> AgradDistributionNormalSufficient_v_2722;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2723> AgradDistributionNormalSufficient_v_2723;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2724> AgradDistributionNormalSufficient_v_2724;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2725> AgradDistributionNormalSufficient_v_2725;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2726> AgradDistributionNormalSufficient_v_2726;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2727> AgradDistributionNormalSufficient_v_2727;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2728> AgradDistributionNormalSufficient_v_2728;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2729> AgradDistributionNormalSufficient_v_2729;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2730> AgradDistributionNormalSufficient_v_2730;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2731> AgradDistributionNormalSufficient_v_2731;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2732> AgradDistributionNormalSufficient_v_2732;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2733> AgradDistributionNormalSufficient_v_2733;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2734> AgradDistributionNormalSufficient_v_2734;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2735> AgradDistributionNormalSufficient_v_2735;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2736> AgradDistributionNormalSufficient_v_2736;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2737> AgradDistributionNormalSufficient_v_2737;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2738> AgradDistributionNormalSufficient_v_2738;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2739> AgradDistributionNormalSufficient_v_2739;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2740> AgradDistributionNormalSufficient_v_2740;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2741> AgradDistributionNormalSufficient_v_2741;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2742> AgradDistributionNormalSufficient_v_2742;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2743> AgradDistributionNormalSufficient_v_2743;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2744> AgradDistributionNormalSufficient_v_2744;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2745> AgradDistributionNormalSufficient_v_2745;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2746> AgradDistributionNormalSufficient_v_2746;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2747> AgradDistributionNormalSufficient_v_2747;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2748> AgradDistributionNormalSufficient_v_2748;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2749> AgradDistributionNormalSufficient_v_2749;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2750> AgradDistributionNormalSufficient_v_2750;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2751> AgradDistributionNormalSufficient_v_2751;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2752> AgradDistributionNormalSufficient_v_2752;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2753> AgradDistributionNormalSufficient_v_2753;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2754> AgradDistributionNormalSufficient_v_2754;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2755> AgradDistributionNormalSufficient_v_2755;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2756> AgradDistributionNormalSufficient_v_2756;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2757> AgradDistributionNormalSufficient_v_2757;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2758> AgradDistributionNormalSufficient_v_2758;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2759> AgradDistributionNormalSufficient_v_2759;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2760> AgradDistributionNormalSufficient_v_2760;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2761> AgradDistributionNormalSufficient_v_2761;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2762> AgradDistributionNormalSufficient_v_2762;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2763> AgradDistributionNormalSufficient_v_2763;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2764> AgradDistributionNormalSufficient_v_2764;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2765> AgradDistributionNormalSufficient_v_2765;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2766> AgradDistributionNormalSufficient_v_2766;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2767> AgradDistributionNormalSufficient_v_2767;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2768> AgradDistributionNormalSufficient_v_2768;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2769> AgradDistributionNormalSufficient_v_2769;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2770> AgradDistributionNormalSufficient_v_2770;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2771> AgradDistributionNormalSufficient_v_2771;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2772> AgradDistributionNormalSufficient_v_2772;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2773> AgradDistributionNormalSufficient_v_2773;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2774> AgradDistributionNormalSufficient_v_2774;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2775> AgradDistributionNormalSufficient_v_2775;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2776> AgradDistributionNormalSufficient_v_2776;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2777> AgradDistributionNormalSufficient_v_2777;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2778> AgradDistributionNormalSufficient_v_2778;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2779> AgradDistributionNormalSufficient_v_2779;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2780> AgradDistributionNormalSufficient_v_2780;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2781> AgradDistributionNormalSufficient_v_2781;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2782> AgradDistributionNormalSufficient_v_2782;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2783> AgradDistributionNormalSufficient_v_2783;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2784> AgradDistributionNormalSufficient_v_2784;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2785> AgradDistributionNormalSufficient_v_2785;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2786> AgradDistributionNormalSufficient_v_2786;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2787> AgradDistributionNormalSufficient_v_2787;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2788> AgradDistributionNormalSufficient_v_2788;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2789> AgradDistributionNormalSufficient_v_2789;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2790> AgradDistributionNormalSufficient_v_2790;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2791> AgradDistributionNormalSufficient_v_2791;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2792> AgradDistributionNormalSufficient_v_2792;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2793> AgradDistributionNormalSufficient_v_2793;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2794> AgradDistributionNormalSufficient_v_2794;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2795> AgradDistributionNormalSufficient_v_2795;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2796> AgradDistributionNormalSufficient_v_2796;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2797> AgradDistributionNormalSufficient_v_2797;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2798> AgradDistributionNormalSufficient_v_2798;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2799> AgradDistributionNormalSufficient_v_2799;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2700, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2700);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2701, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2701);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2702, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2702);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2703, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2703);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2704, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2704);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2705, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2705);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2706, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2706);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2707, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2707);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2708, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2708);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2709, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2709);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2710, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2710);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2711, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2711);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2712, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2712);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2713, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2713);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2714, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2714);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2715, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2715);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2716, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2716);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2717, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2717);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2718, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2718);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2719, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2719);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2720, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2720);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2721, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2721);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2722, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2722);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2723, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2723);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2724, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2724);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2725, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2725);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2726, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2726);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2727, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2727);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2728, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2728);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2729, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2729);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2730, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2730);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2731, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2731);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2732, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2732);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2733, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2733);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2734, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2734);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2735, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2735);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2736, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2736);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2737, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2737);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2738, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2738);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2739, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2739);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2740, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2740);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2741, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2741);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2742, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2742);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2743, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2743);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2744, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2744);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2745, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2745);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2746, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2746);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2747, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2747);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2748, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2748);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2749, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2749);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2750, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2750);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2751, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2751);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2752, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2752);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2753, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2753);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2754, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2754);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2755, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2755);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2756, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2756);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2757, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2757);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2758, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2758);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2759, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2759);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2760, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2760);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2761, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2761);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2762, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2762);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2763, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2763);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2764, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2764);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2765, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2765);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2766, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2766);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2767, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2767);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2768, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2768);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2769, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2769);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2770, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2770);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2771, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2771);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2772, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2772);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2773, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2773);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2774, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2774);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2775, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2775);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2776, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2776);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2777, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2777);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2778, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2778);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2779, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2779);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2780, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2780);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2781, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2781);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2782, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2782);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2783, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2783);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2784, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2784);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2785, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2785);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2786, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2786);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2787, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2787);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2788, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2788);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2789, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2789);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2790, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2790);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2791, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2791);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2792, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2792);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2793, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2793);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2794, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2794);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2795, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2795);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2796, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2796);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2797, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2797);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2798, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2798);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2799, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2799);
+
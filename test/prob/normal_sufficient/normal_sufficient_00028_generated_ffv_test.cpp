@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/normal_sufficient/normal_sufficient_test.hpp>
+
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, int, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_2800;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, int, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2801;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, int, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_2802;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, int, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_2803;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, int, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2804;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, int, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_2805;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, int, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_2806;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2807;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, int, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_2808;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, int, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_2809;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2810;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_2811;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_2812;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2813;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_2814;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_2815;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2816;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<int>, double, double, empty> type_ffv_2817;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<int>, double, std::vector<double>, empty> type_ffv_2818;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<int>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2819;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<int>, double, fvar<fvar<var> >, empty> type_ffv_2820;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<int>, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_2821;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<int>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2822;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<int>, std::vector<double>, double, empty> type_ffv_2823;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<int>, std::vector<double>, std::vector<double>, empty> type_ffv_2824;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<int>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2825;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<int>, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_2826;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<int>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_2827;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<int>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2828;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffv_2829;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_2830;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2831;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_2832;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_2833;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2834;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<int>, fvar<fvar<var> >, double, empty> type_ffv_2835;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<int>, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_2836;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2837;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<int>, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_2838;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<int>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_2839;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2840;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<int>, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_2841;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_2842;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2843;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<int>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_2844;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_2845;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2846;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_2847;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_2848;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2849;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_2850;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_2851;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2852;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, double, empty> type_ffv_2853;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_ffv_2854;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2855;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty> type_ffv_2856;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_2857;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2858;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_ffv_2859;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_ffv_2860;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2861;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_2862;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_2863;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2864;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffv_2865;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_2866;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2867;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_2868;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_2869;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2870;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty> type_ffv_2871;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_2872;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2873;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_2874;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_2875;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2876;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_2877;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_2878;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2879;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_2880;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_2881;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2882;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_2883;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_2884;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2885;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_2886;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_2887;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2888;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, int, double, double, empty> type_ffv_2889;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, int, double, std::vector<double>, empty> type_ffv_2890;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, int, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2891;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, int, double, fvar<fvar<var> >, empty> type_ffv_2892;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, int, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_2893;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, int, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_2894;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, int, std::vector<double>, double, empty> type_ffv_2895;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, int, std::vector<double>, std::vector<double>, empty> type_ffv_2896;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, int, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_2897;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, int, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_2898;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, int, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_2899;
+
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2800> AgradDistributionNormalSufficient_ffv_2800;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2801> AgradDistributionNormalSufficient_ffv_2801;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2802> AgradDistributionNormalSufficient_ffv_2802;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2803> AgradDistributionNormalSufficient_ffv_2803;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2804> AgradDistributionNormalSufficient_ffv_2804;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2805> AgradDistributionNormalSufficient_ffv_2805;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2806> AgradDistributionNormalSufficient_ffv_2806;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2807> AgradDistributionNormalSufficient_ffv_2807;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2808> AgradDistributionNormalSufficient_ffv_2808;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2809> AgradDistributionNormalSufficient_ffv_2809;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2810> AgradDistributionNormalSufficient_ffv_2810;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2811> AgradDistributionNormalSufficient_ffv_2811;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2812> AgradDistributionNormalSufficient_ffv_2812;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2813> AgradDistributionNormalSufficient_ffv_2813;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2814> AgradDistributionNormalSufficient_ffv_2814;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2815> AgradDistributionNormalSufficient_ffv_2815;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2816> AgradDistributionNormalSufficient_ffv_2816;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2817> AgradDistributionNormalSufficient_ffv_2817;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2818> AgradDistributionNormalSufficient_ffv_2818;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2819> AgradDistributionNormalSufficient_ffv_2819;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2820> AgradDistributionNormalSufficient_ffv_2820;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2821> AgradDistributionNormalSufficient_ffv_2821;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2822> AgradDistributionNormalSufficient_ffv_2822;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2823> AgradDistributionNormalSufficient_ffv_2823;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2824> AgradDistributionNormalSufficient_ffv_2824;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2825> AgradDistributionNormalSufficient_ffv_2825;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2826> AgradDistributionNormalSufficient_ffv_2826;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2827> AgradDistributionNormalSufficient_ffv_2827;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2828> AgradDistributionNormalSufficient_ffv_2828;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2829> AgradDistributionNormalSufficient_ffv_2829;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2830> AgradDistributionNormalSufficient_ffv_2830;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2831> AgradDistributionNormalSufficient_ffv_2831;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2832> AgradDistributionNormalSufficient_ffv_2832;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2833> AgradDistributionNormalSufficient_ffv_2833;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2834> AgradDistributionNormalSufficient_ffv_2834;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2835> AgradDistributionNormalSufficient_ffv_2835;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2836> AgradDistributionNormalSufficient_ffv_2836;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2837> AgradDistributionNormalSufficient_ffv_2837;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2838> AgradDistributionNormalSufficient_ffv_2838;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2839> AgradDistributionNormalSufficient_ffv_2839;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2840> AgradDistributionNormalSufficient_ffv_2840;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2841> AgradDistributionNormalSufficient_ffv_2841;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2842> AgradDistributionNormalSufficient_ffv_2842;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2843> AgradDistributionNormalSufficient_ffv_2843;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2844> AgradDistributionNormalSufficient_ffv_2844;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2845> AgradDistributionNormalSufficient_ffv_2845;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2846> AgradDistributionNormalSufficient_ffv_2846;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2847> AgradDistributionNormalSufficient_ffv_2847;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2848> AgradDistributionNormalSufficient_ffv_2848;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2849> AgradDistributionNormalSufficient_ffv_2849;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2850> AgradDistributionNormalSufficient_ffv_2850;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2851> AgradDistributionNormalSufficient_ffv_2851;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2852> AgradDistributionNormalSufficient_ffv_2852;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2853> AgradDistributionNormalSufficient_ffv_2853;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2854> AgradDistributionNormalSufficient_ffv_2854;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2855> AgradDistributionNormalSufficient_ffv_2855;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2856> AgradDistributionNormalSufficient_ffv_2856;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2857> AgradDistributionNormalSufficient_ffv_2857;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2858> AgradDistributionNormalSufficient_ffv_2858;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2859> AgradDistributionNormalSufficient_ffv_2859;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2860> AgradDistributionNormalSufficient_ffv_2860;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2861> AgradDistributionNormalSufficient_ffv_2861;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2862> AgradDistributionNormalSufficient_ffv_2862;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2863> AgradDistributionNormalSufficient_ffv_2863;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2864> AgradDistributionNormalSufficient_ffv_2864;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2865> AgradDistributionNormalSufficient_ffv_2865;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2866> AgradDistributionNormalSufficient_ffv_2866;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2867> AgradDistributionNormalSufficient_ffv_2867;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2868> AgradDistributionNormalSufficient_ffv_2868;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2869> AgradDistributionNormalSufficient_ffv_2869;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2870> AgradDistributionNormalSufficient_ffv_2870;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2871> AgradDistributionNormalSufficient_ffv_2871;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2872> AgradDistributionNormalSufficient_ffv_2872;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2873> AgradDistributionNormalSufficient_ffv_2873;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2874> AgradDistributionNormalSufficient_ffv_2874;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2875> AgradDistributionNormalSufficient_ffv_2875;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2876> AgradDistributionNormalSufficient_ffv_2876;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2877> AgradDistributionNormalSufficient_ffv_2877;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2878> AgradDistributionNormalSufficient_ffv_2878;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2879> AgradDistributionNormalSufficient_ffv_2879;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2880> AgradDistributionNormalSufficient_ffv_2880;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2881> AgradDistributionNormalSufficient_ffv_2881;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2882> AgradDistributionNormalSufficient_ffv_2882;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2883> AgradDistributionNormalSufficient_ffv_2883;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2884> AgradDistributionNormalSufficient_ffv_2884;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2885> AgradDistributionNormalSufficient_ffv_2885;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2886> AgradDistributionNormalSufficient_ffv_2886;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2887> AgradDistributionNormalSufficient_ffv_2887;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2888> AgradDistributionNormalSufficient_ffv_2888;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2889> AgradDistributionNormalSufficient_ffv_2889;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2890> AgradDistributionNormalSufficient_ffv_2890;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2891> AgradDistributionNormalSufficient_ffv_2891;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2892> AgradDistributionNormalSufficient_ffv_2892;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2893> AgradDistributionNormalSufficient_ffv_2893;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2894> AgradDistributionNormalSufficient_ffv_2894;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2895> AgradDistributionNormalSufficient_ffv_2895;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2896> AgradDistributionNormalSufficient_ffv_2896;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2897> AgradDistributionNormalSufficient_ffv_2897;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2898> AgradDistributionNormalSufficient_ffv_2898;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_2899> AgradDistributionNormalSufficient_ffv_2899;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2800, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2800);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2801, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2801);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2802, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2802);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2803, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2803);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2804, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2804);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2805, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2805);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2806, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2806);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2807, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2807);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2808, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2808);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2809, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2809);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2810, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2810);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2811, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2811);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2812, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2812);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2813, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2813);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2814, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2814);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2815, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2815);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2816, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2816);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2817, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2817);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2818, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2818);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2819, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2819);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2820, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2820);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2821, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2821);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2822, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2822);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2823, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2823);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2824, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2824);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2825, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2825);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2826, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2826);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2827, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2827);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2828, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2828);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2829, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2829);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2830, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2830);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2831, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2831);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2832, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2832);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2833, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2833);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2834, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2834);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2835, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2835);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2836, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2836);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2837, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2837);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2838, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2838);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2839, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2839);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2840, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2840);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2841, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2841);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2842, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2842);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2843, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2843);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2844, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2844);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2845, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2845);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2846, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2846);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2847, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2847);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2848, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2848);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2849, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2849);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2850, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2850);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2851, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2851);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2852, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2852);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2853, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2853);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2854, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2854);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2855, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2855);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2856, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2856);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2857, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2857);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2858, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2858);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2859, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2859);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2860, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2860);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2861, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2861);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2862, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2862);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2863, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2863);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2864, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2864);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2865, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2865);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2866, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2866);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2867, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2867);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2868, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2868);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2869, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2869);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2870, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2870);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2871, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2871);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2872, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2872);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2873, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2873);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2874, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2874);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2875, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2875);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2876, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2876);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2877, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2877);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2878, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2878);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2879, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2879);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2880, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2880);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2881, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2881);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2882, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2882);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2883, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2883);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2884, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2884);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2885, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2885);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2886, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2886);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2887, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2887);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2888, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2888);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2889, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2889);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2890, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2890);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2891, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2891);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2892, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2892);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2893, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2893);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2894, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2894);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2895, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2895);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2896, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2896);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2897, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2897);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2898, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2898);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_2899, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_2899);
+
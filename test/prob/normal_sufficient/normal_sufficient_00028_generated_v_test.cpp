@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/normal_sufficient/normal_sufficient_test.hpp>
+
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty> type_v_2800;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2801;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_2802;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_2803;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2804;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_2805;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_2806;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2807;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, double, double, empty> type_v_2808;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, double, std::vector<double>, empty> type_v_2809;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2810;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, double, var, empty> type_v_2811;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, double, std::vector<var>, empty> type_v_2812;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2813;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<double>, double, empty> type_v_2814;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<double>, std::vector<double>, empty> type_v_2815;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2816;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<double>, var, empty> type_v_2817;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<double>, std::vector<var>, empty> type_v_2818;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2819;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_2820;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_2821;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2822;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_2823;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_2824;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2825;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, var, double, empty> type_v_2826;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, var, std::vector<double>, empty> type_v_2827;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2828;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, var, var, empty> type_v_2829;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, var, std::vector<var>, empty> type_v_2830;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2831;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<var>, double, empty> type_v_2832;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<var>, std::vector<double>, empty> type_v_2833;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2834;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<var>, var, empty> type_v_2835;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<var>, std::vector<var>, empty> type_v_2836;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2837;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_2838;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_2839;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2840;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_2841;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_2842;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2843;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, double, double, empty> type_v_2844;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, double, std::vector<double>, empty> type_v_2845;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2846;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, double, var, empty> type_v_2847;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, double, std::vector<var>, empty> type_v_2848;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2849;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, double, empty> type_v_2850;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, std::vector<double>, empty> type_v_2851;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2852;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, var, empty> type_v_2853;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, std::vector<var>, empty> type_v_2854;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2855;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_2856;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_2857;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2858;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_2859;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_2860;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2861;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, var, double, empty> type_v_2862;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, var, std::vector<double>, empty> type_v_2863;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2864;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, var, var, empty> type_v_2865;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, var, std::vector<var>, empty> type_v_2866;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2867;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<var>, double, empty> type_v_2868;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<var>, std::vector<double>, empty> type_v_2869;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2870;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<var>, var, empty> type_v_2871;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<var>, std::vector<var>, empty> type_v_2872;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2873;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_2874;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_2875;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2876;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_2877;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_2878;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2879;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, double, empty> type_v_2880;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_v_2881;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2882;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, var, empty> type_v_2883;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<var>, empty> type_v_2884;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2885;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_v_2886;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_v_2887;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2888;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, var, empty> type_v_2889;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty> type_v_2890;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2891;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_2892;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_2893;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2894;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_2895;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_2896;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2897;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, double, empty> type_v_2898;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<double>, empty> type_v_2899;
+
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2800> AgradDistributionNormalSufficient_v_2800;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2801> AgradDistributionNormalSufficient_v_2801;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2802> AgradDistributionNormalSufficient_v_2802;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2803> AgradDistributionNormalSufficient_v_2803;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2804> AgradDistributionNormalSufficient_v_2804;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2805> AgradDistributionNormalSufficient_v_2805;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2806> AgradDistributionNormalSufficient_v_2806;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2807> AgradDistributionNormalSufficient_v_2807;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2808> AgradDistributionNormalSufficient_v_2808;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2809> AgradDistributionNormalSufficient_v_2809;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2810> AgradDistributionNormalSufficient_v_2810;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2811> AgradDistributionNormalSufficient_v_2811;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2812> AgradDistributionNormalSufficient_v_2812;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2813> AgradDistributionNormalSufficient_v_2813;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2814> AgradDistributionNormalSufficient_v_2814;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2815> AgradDistributionNormalSufficient_v_2815;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2816> AgradDistributionNormalSufficient_v_2816;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2817> AgradDistributionNormalSufficient_v_2817;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2818> AgradDistributionNormalSufficient_v_2818;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2819> AgradDistributionNormalSufficient_v_2819;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2820> AgradDistributionNormalSufficient_v_2820;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2821> AgradDistributionNormalSufficient_v_2821;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2822> AgradDistributionNormalSufficient_v_2822;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2823> AgradDistributionNormalSufficient_v_2823;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2824> AgradDistributionNormalSufficient_v_2824;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2825> AgradDistributionNormalSufficient_v_2825;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2826> AgradDistributionNormalSufficient_v_2826;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2827> AgradDistributionNormalSufficient_v_2827;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2828> AgradDistributionNormalSufficient_v_2828;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2829> AgradDistributionNormalSufficient_v_2829;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2830> AgradDistributionNormalSufficient_v_2830;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2831> AgradDistributionNormalSufficient_v_2831;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2832> AgradDistributionNormalSufficient_v_2832;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2833> AgradDistributionNormalSufficient_v_2833;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2834> AgradDistributionNormalSufficient_v_2834;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2835> AgradDistributionNormalSufficient_v_2835;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2836> AgradDistributionNormalSufficient_v_2836;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2837> AgradDistributionNormalSufficient_v_2837;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2838> AgradDistributionNormalSufficient_v_2838;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2839> AgradDistributionNormalSufficient_v_2839;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2840> AgradDistributionNormalSufficient_v_2840;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2841> AgradDistributionNormalSufficient_v_2841;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2842> AgradDistributionNormalSufficient_v_2842;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2843> AgradDistributionNormalSufficient_v_2843;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2844> AgradDistributionNormalSufficient_v_2844;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2845> AgradDistributionNormalSufficient_v_2845;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2846> AgradDistributionNormalSufficient_v_2846;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2847> AgradDistributionNormalSufficient_v_2847;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2848> AgradDistributionNormalSufficient_v_2848;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2849> AgradDistributionNormalSufficient_v_2849;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2850> AgradDistributionNormalSufficient_v_2850;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2851> AgradDistributionNormalSufficient_v_2851;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2852> AgradDistributionNormalSufficient_v_2852;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2853> AgradDistributionNormalSufficient_v_2853;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2854> AgradDistributionNormalSufficient_v_2854;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2855> AgradDistributionNormalSufficient_v_2855;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2856> AgradDistributionNormalSufficient_v_2856;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2857> AgradDistributionNormalSufficient_v_2857;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2858> AgradDistributionNormalSufficient_v_2858;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2859> AgradDistributionNormalSufficient_v_2859;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2860> AgradDistributionNormalSufficient_v_2860;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2861> AgradDistributionNormalSufficient_v_2861;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2862> AgradDistributionNormalSufficient_v_2862;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2863> AgradDistributionNormalSufficient_v_2863;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2864> AgradDistributionNormalSufficient_v_2864;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2865> AgradDistributionNormalSufficient_v_2865;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2866> AgradDistributionNormalSufficient_v_2866;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2867> AgradDistributionNormalSufficient_v_2867;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2868> AgradDistributionNormalSufficient_v_2868;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2869> AgradDistributionNormalSufficient_v_2869;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2870> AgradDistributionNormalSufficient_v_2870;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2871> AgradDistributionNormalSufficient_v_2871;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2872> AgradDistributionNormalSufficient_v_2872;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2873> AgradDistributionNormalSufficient_v_2873;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2874> AgradDistributionNormalSufficient_v_2874;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2875> AgradDistributionNormalSufficient_v_2875;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2876> AgradDistributionNormalSufficient_v_2876;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2877> AgradDistributionNormalSufficient_v_2877;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2878> AgradDistributionNormalSufficient_v_2878;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2879> AgradDistributionNormalSufficient_v_2879;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2880> AgradDistributionNormalSufficient_v_2880;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2881> AgradDistributionNormalSufficient_v_2881;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2882> AgradDistributionNormalSufficient_v_2882;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2883> AgradDistributionNormalSufficient_v_2883;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2884> AgradDistributionNormalSufficient_v_2884;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2885> AgradDistributionNormalSufficient_v_2885;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2886> AgradDistributionNormalSufficient_v_2886;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2887> AgradDistributionNormalSufficient_v_2887;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2888> AgradDistributionNormalSufficient_v_2888;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2889> AgradDistributionNormalSufficient_v_2889;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2890> AgradDistributionNormalSufficient_v_2890;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2891> AgradDistributionNormalSufficient_v_2891;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2892> AgradDistributionNormalSufficient_v_2892;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2893> AgradDistributionNormalSufficient_v_2893;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2894> AgradDistributionNormalSufficient_v_2894;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2895> AgradDistributionNormalSufficient_v_2895;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2896> AgradDistributionNormalSufficient_v_2896;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2897> AgradDistributionNormalSufficient_v_2897;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2898> AgradDistributionNormalSufficient_v_2898;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2899> AgradDistributionNormalSufficient_v_2899;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2800, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2800);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2801, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2801);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2802, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2802);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2803, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2803);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2804, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2804);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2805, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2805);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2806, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2806);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2807, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2807);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2808, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2808);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2809, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2809);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2810, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2810);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2811, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2811);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2812, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2812);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2813, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2813);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2814, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2814);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2815, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2815);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2816, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2816);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2817, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2817);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2818, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2818);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2819, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2819);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2820, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2820);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2821, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2821);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2822, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2822);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2823, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2823);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2824, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2824);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2825, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2825);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2826, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2826);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2827, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2827);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2828, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2828);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2829, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2829);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2830, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2830);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2831, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2831);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2832, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2832);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2833, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2833);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2834, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2834);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2835, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2835);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2836, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2836);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2837, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2837);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2838, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2838);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2839, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2839);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2840, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2840);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2841, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2841);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2842, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2842);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2843, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2843);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2844, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2844);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2845, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2845);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2846, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2846);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2847, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2847);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2848, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2848);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2849, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2849);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2850, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2850);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2851, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2851);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2852, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2852);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2853, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2853);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2854, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2854);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2855, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2855);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2856, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2856);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2857, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2857);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2858, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2858);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2859, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2859);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2860, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2860);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2861, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2861);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2862, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2862);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2863, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2863);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2864, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2864);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2865, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2865);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2866, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2866);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2867, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2867);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2868, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2868);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2869, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2869);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2870, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2870);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2871, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2871);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2872, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2872);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2873, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2873);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2874, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2874);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2875, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2875);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2876, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2876);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2877, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2877);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2878, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2878);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2879, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2879);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2880, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2880);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2881, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2881);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2882, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2882);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2883, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2883);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2884, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2884);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2885, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2885);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2886, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2886);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2887, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2887);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2888, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2888);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2889, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2889);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2890, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2890);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2891, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2891);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2892, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2892);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2893, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2893);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2894, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2894);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2895, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2895);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2896, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2896);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2897, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2897);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2898, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2898);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2899, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2899);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/normal_sufficient/normal_sufficient_test.hpp>
+
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2900;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, var, empty> type_v_2901;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<var>, empty> type_v_2902;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2903;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, double, empty> type_v_2904;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty> type_v_2905;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2906;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, var, empty> type_v_2907;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty> type_v_2908;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2909;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_2910;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_2911;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2912;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_2913;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_2914;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2915;
+typedef std::tuple<std::vector<var>, var, int, double, double, empty> type_v_2916;
+typedef std::tuple<std::vector<var>, var, int, double, std::vector<double>, empty> type_v_2917;
+typedef std::tuple<std::vector<var>, var, int, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2918;
+typedef std::tuple<std::vector<var>, var, int, double, var, empty> type_v_2919;
+typedef std::tuple<std::vector<var>, var, int, double, std::vector<var>, empty> type_v_2920;
+typedef std::tuple<std::vector<var>, var, int, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2921;
+typedef std::tuple<std::vector<var>, var, int, std::vector<double>, double, empty> type_v_2922;
+typedef std::tuple<std::vector<var>, var, int, std::vector<double>, std::vector<double>, empty> type_v_2923;
+typedef std::tuple<std::vector<var>, var, int, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2924;
+typedef std::tuple<std::vector<var>, var, int, std::vector<double>, var, empty> type_v_2925;
+typedef std::tuple<std::vector<var>, var, int, std::vector<double>, std::vector<var>, empty> type_v_2926;
+typedef std::tuple<std::vector<var>, var, int, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2927;
+typedef std::tuple<std::vector<var>, var, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_2928;
+typedef std::tuple<std::vector<var>, var, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_2929;
+typedef std::tuple<std::vector<var>, var, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2930;
+typedef std::tuple<std::vector<var>, var, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_2931;
+typedef std::tuple<std::vector<var>, var, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_2932;
+typedef std::tuple<std::vector<var>, var, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2933;
+typedef std::tuple<std::vector<var>, var, int, var, double, empty> type_v_2934;
+typedef std::tuple<std::vector<var>, var, int, var, std::vector<double>, empty> type_v_2935;
+typedef std::tuple<std::vector<var>, var, int, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2936;
+typedef std::tuple<std::vector<var>, var, int, var, var, empty> type_v_2937;
+typedef std::tuple<std::vector<var>, var, int, var, std::vector<var>, empty> type_v_2938;
+typedef std::tuple<std::vector<var>, var, int, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2939;
+typedef std::tuple<std::vector<var>, var, int, std::vector<var>, double, empty> type_v_2940;
+typedef std::tuple<std::vector<var>, var, int, std::vector<var>, std::vector<double>, empty> type_v_2941;
+typedef std::tuple<std::vector<var>, var, int, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2942;
+typedef std::tuple<std::vector<var>, var, int, std::vector<var>, var, empty> type_v_2943;
+typedef std::tuple<std::vector<var>, var, int, std::vector<var>, std::vector<var>, empty> type_v_2944;
+typedef std::tuple<std::vector<var>, var, int, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2945;
+typedef std::tuple<std::vector<var>, var, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_2946;
+typedef std::tuple<std::vector<var>, var, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_2947;
+typedef std::tuple<std::vector<var>, var, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2948;
+typedef std::tuple<std::vector<var>, var, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_2949;
+typedef std::tuple<std::vector<var>, var, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_2950;
+typedef std::tuple<std::vector<var>, var, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2951;
+typedef std::tuple<std::vector<var>, var, std::vector<int>, double, double, empty> type_v_2952;
+typedef std::tuple<std::vector<var>, var, std::vector<int>, double, std::vector<double>, empty> type_v_2953;
+typedef std::tuple<std::vector<var>, var, std::vector<int>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2954;
+typedef std::tuple<std::vector<var>, var, std::vector<int>, double, var, empty> type_v_2955;
+typedef std::tuple<std::vector<var>, var, std::vector<int>, double, std::vector<var>, empty> type_v_2956;
+typedef std::tuple<std::vector<var>, var, std::vector<int>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2957;
+typedef std::tuple<std::vector<var>, var, std::vector<int>, std::vector<double>, double, empty> type_v_2958;
+typedef std::tuple<std::vector<var>, var, std::vector<int>, std::vector<double>, std::vector<double>, empty> type_v_2959;
+typedef std::tuple<std::vector<var>, var, std::vector<int>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2960;
+typedef std::tuple<std::vector<var>, var, std::vector<int>, std::vector<double>, var, empty> type_v_2961;
+typedef std::tuple<std::vector<var>, var, std::vector<int>, std::vector<double>, std::vector<var>, empty> type_v_2962;
+typedef std::tuple<std::vector<var>, var, std::vector<int>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2963;
+typedef std::tuple<std::vector<var>, var, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_2964;
+typedef std::tuple<std::vector<var>, var, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_2965;
+typedef std::tuple<std::vector<var>, var, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2966;
+typedef std::tuple<std::vector<var>, var, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_2967;
+typedef std::tuple<std::vector<var>, var, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_2968;
+typedef std::tuple<std::vector<var>, var, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2969;
+typedef std::tuple<std::vector<var>, var, std::vector<int>, var, double, empty> type_v_2970;
+typedef std::tuple<std::vector<var>, var, std::vector<int>, var, std::vector<double>, empty> type_v_2971;
+typedef std::tuple<std::vector<var>, var, std::vector<int>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2972;
+typedef std::tuple<std::vector<var>, var, std::vector<int>, var, var, empty> type_v_2973;
+typedef std::tuple<std::vector<var>, var, std::vector<int>, var, std::vector<var>, empty> type_v_2974;
+typedef std::tuple<std::vector<var>, var, std::vector<int>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2975;
+typedef std::tuple<std::vector<var>, var, std::vector<int>, std::vector<var>, double, empty> type_v_2976;
+typedef std::tuple<std::vector<var>, var, std::vector<int>, std::vector<var>, std::vector<double>, empty> type_v_2977;
+typedef std::tuple<std::vector<var>, var, std::vector<int>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2978;
+typedef std::tuple<std::vector<var>, var, std::vector<int>, std::vector<var>, var, empty> type_v_2979;
+typedef std::tuple<std::vector<var>, var, std::vector<int>, std::vector<var>, std::vector<var>, empty> type_v_2980;
+typedef std::tuple<std::vector<var>, var, std::vector<int>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2981;
+typedef std::tuple<std::vector<var>, var, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_2982;
+typedef std::tuple<std::vector<var>, var, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_2983;
+typedef std::tuple<std::vector<var>, var, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2984;
+typedef std::tuple<std::vector<var>, var, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_2985;
+typedef std::tuple<std::vector<var>, var, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_2986;
+typedef std::tuple<std::vector<var>, var, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2987;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, double, empty> type_v_2988;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_v_2989;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2990;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, var, empty> type_v_2991;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<var>, empty> type_v_2992;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2993;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_v_2994;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_v_2995;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_2996;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, var, empty> type_v_2997;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty> type_v_2998;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_2999;
+
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2900> AgradDistributionNormalSufficient_v_2900;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2901> AgradDistributionNormalSufficient_v_2901;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2902> AgradDistributionNormalSufficient_v_2902;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2903> AgradDistributionNormalSufficient_v_2903;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2904> AgradDistributionNormalSufficient_v_2904;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2905> AgradDistributionNormalSufficient_v_2905;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2906> AgradDistributionNormalSufficient_v_2906;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2907> AgradDistributionNormalSufficient_v_2907;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2908> AgradDistributionNormalSufficient_v_2908;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2909> AgradDistributionNormalSufficient_v_2909;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2910> AgradDistributionNormalSufficient_v_2910;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2911> AgradDistributionNormalSufficient_v_2911;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2912> AgradDistributionNormalSufficient_v_2912;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2913> AgradDistributionNormalSufficient_v_2913;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2914> AgradDistributionNormalSufficient_v_2914;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2915> AgradDistributionNormalSufficient_v_2915;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2916> AgradDistributionNormalSufficient_v_2916;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2917> AgradDistributionNormalSufficient_v_2917;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2918> AgradDistributionNormalSufficient_v_2918;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2919> AgradDistributionNormalSufficient_v_2919;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2920> AgradDistributionNormalSufficient_v_2920;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2921> AgradDistributionNormalSufficient_v_2921;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2922> AgradDistributionNormalSufficient_v_2922;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2923> AgradDistributionNormalSufficient_v_2923;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2924> AgradDistributionNormalSufficient_v_2924;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2925> AgradDistributionNormalSufficient_v_2925;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2926> AgradDistributionNormalSufficient_v_2926;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2927> AgradDistributionNormalSufficient_v_2927;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2928> AgradDistributionNormalSufficient_v_2928;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2929> AgradDistributionNormalSufficient_v_2929;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2930> AgradDistributionNormalSufficient_v_2930;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2931> AgradDistributionNormalSufficient_v_2931;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2932> AgradDistributionNormalSufficient_v_2932;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2933> AgradDistributionNormalSufficient_v_2933;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2934> AgradDistributionNormalSufficient_v_2934;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2935> AgradDistributionNormalSufficient_v_2935;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2936> AgradDistributionNormalSufficient_v_2936;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2937> AgradDistributionNormalSufficient_v_2937;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2938> AgradDistributionNormalSufficient_v_2938;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2939> AgradDistributionNormalSufficient_v_2939;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2940> AgradDistributionNormalSufficient_v_2940;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2941> AgradDistributionNormalSufficient_v_2941;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2942> AgradDistributionNormalSufficient_v_2942;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2943> AgradDistributionNormalSufficient_v_2943;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2944> AgradDistributionNormalSufficient_v_2944;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2945> AgradDistributionNormalSufficient_v_2945;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2946> AgradDistributionNormalSufficient_v_2946;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2947> AgradDistributionNormalSufficient_v_2947;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2948> AgradDistributionNormalSufficient_v_2948;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2949> AgradDistributionNormalSufficient_v_2949;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2950> AgradDistributionNormalSufficient_v_2950;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2951> AgradDistributionNormalSufficient_v_2951;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2952> AgradDistributionNormalSufficient_v_2952;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2953> AgradDistributionNormalSufficient_v_2953;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2954> AgradDistributionNormalSufficient_v_2954;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2955> AgradDistributionNormalSufficient_v_2955;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2956> AgradDistributionNormalSufficient_v_2956;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2957> AgradDistributionNormalSufficient_v_2957;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2958> AgradDistributionNormalSufficient_v_2958;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2959> AgradDistributionNormalSufficient_v_2959;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2960> AgradDistributionNormalSufficient_v_2960;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2961> AgradDistributionNormalSufficient_v_2961;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2962> AgradDistributionNormalSufficient_v_2962;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2963> AgradDistributionNormalSufficient_v_2963;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2964> AgradDistributionNormalSufficient_v_2964;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2965> AgradDistributionNormalSufficient_v_2965;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2966> AgradDistributionNormalSufficient_v_2966;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2967> AgradDistributionNormalSufficient_v_2967;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2968> AgradDistributionNormalSufficient_v_2968;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2969> AgradDistributionNormalSufficient_v_2969;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2970> AgradDistributionNormalSufficient_v_2970;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2971> AgradDistributionNormalSufficient_v_2971;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2972> AgradDistributionNormalSufficient_v_2972;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2973> AgradDistributionNormalSufficient_v_2973;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2974> AgradDistributionNormalSufficient_v_2974;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2975> AgradDistributionNormalSufficient_v_2975;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2976> AgradDistributionNormalSufficient_v_2976;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2977> AgradDistributionNormalSufficient_v_2977;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2978> AgradDistributionNormalSufficient_v_2978;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2979> AgradDistributionNormalSufficient_v_2979;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2980> AgradDistributionNormalSufficient_v_2980;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2981> AgradDistributionNormalSufficient_v_2981;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2982> AgradDistributionNormalSufficient_v_2982;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2983> AgradDistributionNormalSufficient_v_2983;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2984> AgradDistributionNormalSufficient_v_2984;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2985> AgradDistributionNormalSufficient_v_2985;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2986> AgradDistributionNormalSufficient_v_2986;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2987> AgradDistributionNormalSufficient_v_2987;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2988> AgradDistributionNormalSufficient_v_2988;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2989> AgradDistributionNormalSufficient_v_2989;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2990> AgradDistributionNormalSufficient_v_2990;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2991> AgradDistributionNormalSufficient_v_2991;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2992> AgradDistributionNormalSufficient_v_2992;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2993> AgradDistributionNormalSufficient_v_2993;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2994> AgradDistributionNormalSufficient_v_2994;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2995> AgradDistributionNormalSufficient_v_2995;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2996> AgradDistributionNormalSufficient_v_2996;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2997> AgradDistributionNormalSufficient_v_2997;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2998> AgradDistributionNormalSufficient_v_2998;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_2999> AgradDistributionNormalSufficient_v_2999;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2900, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2900);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2901, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2901);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2902, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2902);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2903, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2903);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2904, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2904);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2905, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2905);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2906, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2906);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2907, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2907);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2908, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2908);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2909, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2909);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2910, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2910);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2911, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2911);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2912, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2912);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2913, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2913);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2914, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2914);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2915, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2915);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2916, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2916);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2917, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2917);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2918, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2918);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2919, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2919);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2920, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2920);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2921, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2921);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2922, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2922);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2923, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2923);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2924, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2924);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2925, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2925);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2926, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2926);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2927, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2927);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2928, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2928);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2929, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2929);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2930, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2930);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2931, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2931);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2932, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2932);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2933, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2933);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2934, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2934);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2935, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2935);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2936, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2936);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2937, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2937);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2938, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2938);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2939, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2939);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2940, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2940);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2941, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2941);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2942, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2942);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2943, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2943);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2944, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2944);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2945, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2945);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2946, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2946);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2947, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2947);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2948, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2948);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2949, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2949);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2950, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2950);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2951, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2951);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2952, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2952);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2953, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2953);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2954, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2954);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2955, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2955);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2956, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2956);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2957, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2957);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2958, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2958);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2959, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2959);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2960, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2960);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2961, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2961);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2962, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2962);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2963, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2963);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2964, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2964);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2965, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2965);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2966, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2966);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2967, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2967);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2968, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2968);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2969, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2969);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2970, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2970);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2971, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2971);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2972, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2972);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2973, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2973);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2974, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2974);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2975, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2975);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2976, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2976);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2977, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2977);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2978, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2978);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2979, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2979);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2980, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2980);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2981, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2981);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2982, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2982);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2983, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2983);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2984, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2984);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2985, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2985);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2986, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2986);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2987, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2987);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2988, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2988);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2989, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2989);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2990, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2990);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2991, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2991);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2992, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2992);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2993, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2993);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2994, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2994);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2995, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2995);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2996, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2996);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2997, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2997);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2998, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2998);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_2999, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_2999);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/normal_sufficient/normal_sufficient_test.hpp>
+
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_3000;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_3001;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_3002;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_3003;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_3004;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_3005;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, double, empty> type_v_3006;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<double>, empty> type_v_3007;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_3008;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, var, empty> type_v_3009;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<var>, empty> type_v_3010;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_3011;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, double, empty> type_v_3012;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty> type_v_3013;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_3014;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, var, empty> type_v_3015;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty> type_v_3016;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_3017;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_3018;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_3019;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_3020;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_3021;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_3022;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_3023;
+typedef std::tuple<std::vector<var>, std::vector<var>, int, double, double, empty> type_v_3024;
+typedef std::tuple<std::vector<var>, std::vector<var>, int, double, std::vector<double>, empty> type_v_3025;
+typedef std::tuple<std::vector<var>, std::vector<var>, int, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_3026;
+typedef std::tuple<std::vector<var>, std::vector<var>, int, double, var, empty> type_v_3027;
+typedef std::tuple<std::vector<var>, std::vector<var>, int, double, std::vector<var>, empty> type_v_3028;
+typedef std::tuple<std::vector<var>, std::vector<var>, int, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_3029;
+typedef std::tuple<std::vector<var>, std::vector<var>, int, std::vector<double>, double, empty> type_v_3030;
+typedef std::tuple<std::vector<var>, std::vector<var>, int, std::vector<double>, std::vector<double>, empty> type_v_3031;
+typedef std::tuple<std::vector<var>, std::vector<var>, int, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_3032;
+typedef std::tuple<std::vector<var>, std::vector<var>, int, std::vector<double>, var, empty> type_v_3033;
+typedef std::tuple<std::vector<var>, std::vector<var>, int, std::vector<double>, std::vector<var>, empty> type_v_3034;
+typedef std::tuple<std::vector<var>, std::vector<var>, int, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_3035;
+typedef std::tuple<std::vector<var>, std::vector<var>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_3036;
+typedef std::tuple<std::vector<var>, std::vector<var>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_3037;
+typedef std::tuple<std::vector<var>, std::vector<var>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_3038;
+typedef std::tuple<std::vector<var>, std::vector<var>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_3039;
+typedef std::tuple<std::vector<var>, std::vector<var>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_3040;
+typedef std::tuple<std::vector<var>, std::vector<var>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_3041;
+typedef std::tuple<std::vector<var>, std::vector<var>, int, var, double, empty> type_v_3042;
+typedef std::tuple<std::vector<var>, std::vector<var>, int, var, std::vector<double>, empty> type_v_3043;
+typedef std::tuple<std::vector<var>, std::vector<var>, int, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_3044;
+typedef std::tuple<std::vector<var>, std::vector<var>, int, var, var, empty> type_v_3045;
+typedef std::tuple<std::vector<var>, std::vector<var>, int, var, std::vector<var>, empty> type_v_3046;
+typedef std::tuple<std::vector<var>, std::vector<var>, int, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_3047;
+typedef std::tuple<std::vector<var>, std::vector<var>, int, std::vector<var>, double, empty> type_v_3048;
+typedef std::tuple<std::vector<var>, std::vector<var>, int, std::vector<var>, std::vector<double>, empty> type_v_3049;
+typedef std::tuple<std::vector<var>, std::vector<var>, int, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_3050;
+typedef std::tuple<std::vector<var>, std::vector<var>, int, std::vector<var>, var, empty> type_v_3051;
+typedef std::tuple<std::vector<var>, std::vector<var>, int, std::vector<var>, std::vector<var>, empty> type_v_3052;
+typedef std::tuple<std::vector<var>, std::vector<var>, int, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_3053;
+typedef std::tuple<std::vector<var>, std::vector<var>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_3054;
+typedef std::tuple<std::vector<var>, std::vector<var>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_3055;
+typedef std::tuple<std::vector<var>, std::vector<var>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_3056;
+typedef std::tuple<std::vector<var>, std::vector<var>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_3057;
+typedef std::tuple<std::vector<var>, std::vector<var>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_3058;
+typedef std::tuple<std::vector<var>, std::vector<var>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_3059;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<int>, double, double, empty> type_v_3060;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<int>, double, std::vector<double>, empty> type_v_3061;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<int>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_3062;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<int>, double, var, empty> type_v_3063;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<int>, double, std::vector<var>, empty> type_v_3064;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<int>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_3065;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<int>, std::vector<double>, double, empty> type_v_3066;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<int>, std::vector<double>, std::vector<double>, empty> type_v_3067;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<int>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_3068;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<int>, std::vector<double>, var, empty> type_v_3069;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<int>, std::vector<double>, std::vector<var>, empty> type_v_3070;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<int>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_3071;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_3072;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_3073;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_3074;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_3075;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_3076;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_3077;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<int>, var, double, empty> type_v_3078;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<int>, var, std::vector<double>, empty> type_v_3079;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<int>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_3080;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<int>, var, var, empty> type_v_3081;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<int>, var, std::vector<var>, empty> type_v_3082;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<int>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_3083;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<int>, std::vector<var>, double, empty> type_v_3084;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<int>, std::vector<var>, std::vector<double>, empty> type_v_3085;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<int>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_3086;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<int>, std::vector<var>, var, empty> type_v_3087;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<int>, std::vector<var>, std::vector<var>, empty> type_v_3088;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<int>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_3089;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_3090;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_3091;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_3092;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_3093;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_3094;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_3095;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, double, empty> type_v_3096;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_v_3097;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_3098;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, var, empty> type_v_3099;
+
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3000> AgradDistributionNormalSufficient_v_3000;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3001> AgradDistributionNormalSufficient_v_3001;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3002> AgradDistributionNormalSufficient_v_3002;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3003> AgradDistributionNormalSufficient_v_3003;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3004> AgradDistributionNormalSufficient_v_3004;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3005> AgradDistributionNormalSufficient_v_3005;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3006> AgradDistributionNormalSufficient_v_3006;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3007> AgradDistributionNormalSufficient_v_3007;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3008> AgradDistributionNormalSufficient_v_3008;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3009> AgradDistributionNormalSufficient_v_3009;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3010> AgradDistributionNormalSufficient_v_3010;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3011> AgradDistributionNormalSufficient_v_3011;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3012> AgradDistributionNormalSufficient_v_3012;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3013> AgradDistributionNormalSufficient_v_3013;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3014> AgradDistributionNormalSufficient_v_3014;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3015> AgradDistributionNormalSufficient_v_3015;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3016> AgradDistributionNormalSufficient_v_3016;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3017> AgradDistributionNormalSufficient_v_3017;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3018> AgradDistributionNormalSufficient_v_3018;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3019> AgradDistributionNormalSufficient_v_3019;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3020> AgradDistributionNormalSufficient_v_3020;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3021> AgradDistributionNormalSufficient_v_3021;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3022> AgradDistributionNormalSufficient_v_3022;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3023> AgradDistributionNormalSufficient_v_3023;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3024> AgradDistributionNormalSufficient_v_3024;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3025> AgradDistributionNormalSufficient_v_3025;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3026> AgradDistributionNormalSufficient_v_3026;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3027> AgradDistributionNormalSufficient_v_3027;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3028> AgradDistributionNormalSufficient_v_3028;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3029> AgradDistributionNormalSufficient_v_3029;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3030> AgradDistributionNormalSufficient_v_3030;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3031> AgradDistributionNormalSufficient_v_3031;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3032> AgradDistributionNormalSufficient_v_3032;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3033> AgradDistributionNormalSufficient_v_3033;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3034> AgradDistributionNormalSufficient_v_3034;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3035> AgradDistributionNormalSufficient_v_3035;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3036> AgradDistributionNormalSufficient_v_3036;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3037> AgradDistributionNormalSufficient_v_3037;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3038> AgradDistributionNormalSufficient_v_3038;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3039> AgradDistributionNormalSufficient_v_3039;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3040> AgradDistributionNormalSufficient_v_3040;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3041> AgradDistributionNormalSufficient_v_3041;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3042> AgradDistributionNormalSufficient_v_3042;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3043> AgradDistributionNormalSufficient_v_3043;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3044> AgradDistributionNormalSufficient_v_3044;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3045> AgradDistributionNormalSufficient_v_3045;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3046> AgradDistributionNormalSufficient_v_3046;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3047> AgradDistributionNormalSufficient_v_3047;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3048> AgradDistributionNormalSufficient_v_3048;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3049> AgradDistributionNormalSufficient_v_3049;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3050> AgradDistributionNormalSufficient_v_3050;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3051> AgradDistributionNormalSufficient_v_3051;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3052> AgradDistributionNormalSufficient_v_3052;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3053> AgradDistributionNormalSufficient_v_3053;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3054> AgradDistributionNormalSufficient_v_3054;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3055> AgradDistributionNormalSufficient_v_3055;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3056> AgradDistributionNormalSufficient_v_3056;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3057> AgradDistributionNormalSufficient_v_3057;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3058> AgradDistributionNormalSufficient_v_3058;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3059> AgradDistributionNormalSufficient_v_3059;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3060> AgradDistributionNormalSufficient_v_3060;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3061> AgradDistributionNormalSufficient_v_3061;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3062> AgradDistributionNormalSufficient_v_3062;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3063> AgradDistributionNormalSufficient_v_3063;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3064> AgradDistributionNormalSufficient_v_3064;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3065> AgradDistributionNormalSufficient_v_3065;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3066> AgradDistributionNormalSufficient_v_3066;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3067> AgradDistributionNormalSufficient_v_3067;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3068> AgradDistributionNormalSufficient_v_3068;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3069> AgradDistributionNormalSufficient_v_3069;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3070> AgradDistributionNormalSufficient_v_3070;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3071> AgradDistributionNormalSufficient_v_3071;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3072> AgradDistributionNormalSufficient_v_3072;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3073> AgradDistributionNormalSufficient_v_3073;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3074> AgradDistributionNormalSufficient_v_3074;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3075> AgradDistributionNormalSufficient_v_3075;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3076> AgradDistributionNormalSufficient_v_3076;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3077> AgradDistributionNormalSufficient_v_3077;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3078> AgradDistributionNormalSufficient_v_3078;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3079> AgradDistributionNormalSufficient_v_3079;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3080> AgradDistributionNormalSufficient_v_3080;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3081> AgradDistributionNormalSufficient_v_3081;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3082> AgradDistributionNormalSufficient_v_3082;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3083> AgradDistributionNormalSufficient_v_3083;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3084> AgradDistributionNormalSufficient_v_3084;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3085> AgradDistributionNormalSufficient_v_3085;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3086> AgradDistributionNormalSufficient_v_3086;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3087> AgradDistributionNormalSufficient_v_3087;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3088> AgradDistributionNormalSufficient_v_3088;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3089> AgradDistributionNormalSufficient_v_3089;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3090> AgradDistributionNormalSufficient_v_3090;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3091> AgradDistributionNormalSufficient_v_3091;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3092> AgradDistributionNormalSufficient_v_3092;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3093> AgradDistributionNormalSufficient_v_3093;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3094> AgradDistributionNormalSufficient_v_3094;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3095> AgradDistributionNormalSufficient_v_3095;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3096> AgradDistributionNormalSufficient_v_3096;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3097> AgradDistributionNormalSufficient_v_3097;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3098> AgradDistributionNormalSufficient_v_3098;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3099> AgradDistributionNormalSufficient_v_3099;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3000, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3000);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3001, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3001);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3002, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3002);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3003, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3003);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3004, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3004);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3005, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3005);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3006, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3006);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3007, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3007);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3008, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3008);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3009, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3009);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3010, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3010);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3011, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3011);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3012, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3012);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3013, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3013);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3014, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3014);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3015, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3015);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3016, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3016);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3017, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3017);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3018, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3018);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3019, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3019);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3020, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3020);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3021, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3021);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3022, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3022);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3023, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3023);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3024, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3024);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3025, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3025);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3026, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3026);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3027, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3027);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3028, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3028);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3029, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3029);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3030, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3030);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3031, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3031);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3032, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3032);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3033, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3033);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3034, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3034);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3035, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3035);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3036, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3036);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3037, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3037);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3038, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3038);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3039, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3039);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3040, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3040);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3041, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3041);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3042, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3042);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3043, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3043);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3044, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3044);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3045, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3045);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3046, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3046);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3047, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3047);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3048, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3048);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3049, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3049);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3050, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3050);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3051, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3051);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3052, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3052);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3053, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3053);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3054, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3054);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3055, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3055);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3056, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3056);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3057, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3057);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3058, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3058);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3059, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3059);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3060, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3060);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3061, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3061);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3062, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3062);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3063, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3063);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3064, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3064);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3065, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3065);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3066, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3066);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3067, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3067);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3068, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3068);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3069, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3069);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3070, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3070);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3071, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3071);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3072, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3072);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3073, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3073);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3074, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3074);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3075, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3075);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3076, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3076);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3077, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3077);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3078, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3078);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3079, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3079);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3080, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3080);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3081, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3081);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3082, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3082);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3083, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3083);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3084, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3084);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3085, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3085);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3086, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3086);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3087, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3087);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3088, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3088);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3089, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3089);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3090, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3090);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3091, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3091);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3092, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3092);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3093, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3093);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3094, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3094);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3095, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3095);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3096, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3096);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3097, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3097);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3098, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3098);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3099, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3099);
+
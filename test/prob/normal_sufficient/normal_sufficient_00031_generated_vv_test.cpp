@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/normal_sufficient/normal_sufficient_test.hpp>
+
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty> type_vv_3100;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_3101;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty> type_vv_3102;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty> type_vv_3103;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_3104;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, int, double, double, empty> type_vv_3105;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, int, double, std::vector<double>, empty> type_vv_3106;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, int, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_3107;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, int, double, var, empty> type_vv_3108;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, int, double, std::vector<var>, empty> type_vv_3109;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, int, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_3110;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, int, std::vector<double>, double, empty> type_vv_3111;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, int, std::vector<double>, std::vector<double>, empty> type_vv_3112;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, int, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_3113;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, int, std::vector<double>, var, empty> type_vv_3114;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, int, std::vector<double>, std::vector<var>, empty> type_vv_3115;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, int, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_3116;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_vv_3117;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_vv_3118;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_3119;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_vv_3120;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_vv_3121;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_3122;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, int, var, double, empty> type_vv_3123;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, int, var, std::vector<double>, empty> type_vv_3124;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, int, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_3125;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, int, var, var, empty> type_vv_3126;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, int, var, std::vector<var>, empty> type_vv_3127;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, int, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_3128;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, int, std::vector<var>, double, empty> type_vv_3129;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, int, std::vector<var>, std::vector<double>, empty> type_vv_3130;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, int, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_3131;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, int, std::vector<var>, var, empty> type_vv_3132;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, int, std::vector<var>, std::vector<var>, empty> type_vv_3133;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, int, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_3134;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty> type_vv_3135;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty> type_vv_3136;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_3137;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty> type_vv_3138;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty> type_vv_3139;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_3140;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<int>, double, double, empty> type_vv_3141;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<int>, double, std::vector<double>, empty> type_vv_3142;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<int>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_3143;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<int>, double, var, empty> type_vv_3144;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<int>, double, std::vector<var>, empty> type_vv_3145;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<int>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_3146;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<int>, std::vector<double>, double, empty> type_vv_3147;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<int>, std::vector<double>, std::vector<double>, empty> type_vv_3148;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<int>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_3149;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<int>, std::vector<double>, var, empty> type_vv_3150;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<int>, std::vector<double>, std::vector<var>, empty> type_vv_3151;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<int>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_3152;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_vv_3153;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_vv_3154;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_3155;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_vv_3156;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_vv_3157;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_3158;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<int>, var, double, empty> type_vv_3159;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<int>, var, std::vector<double>, empty> type_vv_3160;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<int>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_3161;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<int>, var, var, empty> type_vv_3162;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<int>, var, std::vector<var>, empty> type_vv_3163;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<int>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_3164;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<int>, std::vector<var>, double, empty> type_vv_3165;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<int>, std::vector<var>, std::vector<double>, empty> type_vv_3166;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<int>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_3167;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<int>, std::vector<var>, var, empty> type_vv_3168;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<int>, std::vector<var>, std::vector<var>, empty> type_vv_3169;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<int>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_3170;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty> type_vv_3171;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty> type_vv_3172;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_3173;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty> type_vv_3174;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty> type_vv_3175;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_3176;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, double, empty> type_vv_3177;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_vv_3178;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_3179;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, var, empty> type_vv_3180;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<var>, empty> type_vv_3181;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_3182;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_vv_3183;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_vv_3184;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_3185;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, var, empty> type_vv_3186;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty> type_vv_3187;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_3188;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_vv_3189;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_vv_3190;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_3191;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_vv_3192;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_vv_3193;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_3194;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, double, empty> type_vv_3195;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<double>, empty> type_vv_3196;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_3197;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, var, empty> type_vv_3198;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<var>, empty> type_vv_3199;
+
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3100> AgradDistributionNormalSufficient_vv_3100;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3101> AgradDistributionNormalSufficient_vv_3101;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3102> AgradDistributionNormalSufficient_vv_3102;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3103> AgradDistributionNormalSufficient_vv_3103;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3104> AgradDistributionNormalSufficient_vv_3104;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3105> AgradDistributionNormalSufficient_vv_3105;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3106> AgradDistributionNormalSufficient_vv_3106;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3107> AgradDistributionNormalSufficient_vv_3107;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3108> AgradDistributionNormalSufficient_vv_3108;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3109> AgradDistributionNormalSufficient_vv_3109;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3110> AgradDistributionNormalSufficient_vv_3110;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3111> AgradDistributionNormalSufficient_vv_3111;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3112> AgradDistributionNormalSufficient_vv_3112;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3113> AgradDistributionNormalSufficient_vv_3113;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3114> AgradDistributionNormalSufficient_vv_3114;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3115> AgradDistributionNormalSufficient_vv_3115;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3116> AgradDistributionNormalSufficient_vv_3116;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3117> AgradDistributionNormalSufficient_vv_3117;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3118> AgradDistributionNormalSufficient_vv_3118;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3119> AgradDistributionNormalSufficient_vv_3119;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3120> AgradDistributionNormalSufficient_vv_3120;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3121> AgradDistributionNormalSufficient_vv_3121;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3122> AgradDistributionNormalSufficient_vv_3122;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3123> AgradDistributionNormalSufficient_vv_3123;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3124> AgradDistributionNormalSufficient_vv_3124;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3125> AgradDistributionNormalSufficient_vv_3125;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3126> AgradDistributionNormalSufficient_vv_3126;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3127> AgradDistributionNormalSufficient_vv_3127;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3128> AgradDistributionNormalSufficient_vv_3128;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3129> AgradDistributionNormalSufficient_vv_3129;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3130> AgradDistributionNormalSufficient_vv_3130;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3131> AgradDistributionNormalSufficient_vv_3131;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3132> AgradDistributionNormalSufficient_vv_3132;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3133> AgradDistributionNormalSufficient_vv_3133;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3134> AgradDistributionNormalSufficient_vv_3134;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3135> AgradDistributionNormalSufficient_vv_3135;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3136> AgradDistributionNormalSufficient_vv_3136;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3137> AgradDistributionNormalSufficient_vv_3137;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3138> AgradDistributionNormalSufficient_vv_3138;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3139> AgradDistributionNormalSufficient_vv_3139;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3140> AgradDistributionNormalSufficient_vv_3140;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3141> AgradDistributionNormalSufficient_vv_3141;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3142> AgradDistributionNormalSufficient_vv_3142;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3143> AgradDistributionNormalSufficient_vv_3143;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3144> AgradDistributionNormalSufficient_vv_3144;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3145> AgradDistributionNormalSufficient_vv_3145;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3146> AgradDistributionNormalSufficient_vv_3146;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3147> AgradDistributionNormalSufficient_vv_3147;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3148> AgradDistributionNormalSufficient_vv_3148;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3149> AgradDistributionNormalSufficient_vv_3149;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3150> AgradDistributionNormalSufficient_vv_3150;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3151> AgradDistributionNormalSufficient_vv_3151;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3152> AgradDistributionNormalSufficient_vv_3152;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3153> AgradDistributionNormalSufficient_vv_3153;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3154> AgradDistributionNormalSufficient_vv_3154;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3155> AgradDistributionNormalSufficient_vv_3155;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3156> AgradDistributionNormalSufficient_vv_3156;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3157> AgradDistributionNormalSufficient_vv_3157;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3158> AgradDistributionNormalSufficient_vv_3158;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3159> AgradDistributionNormalSufficient_vv_3159;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3160> AgradDistributionNormalSufficient_vv_3160;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3161> AgradDistributionNormalSufficient_vv_3161;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3162> AgradDistributionNormalSufficient_vv_3162;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3163> AgradDistributionNormalSufficient_vv_3163;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3164> AgradDistributionNormalSufficient_vv_3164;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3165> AgradDistributionNormalSufficient_vv_3165;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3166> AgradDistributionNormalSufficient_vv_3166;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3167> AgradDistributionNormalSufficient_vv_3167;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3168> AgradDistributionNormalSufficient_vv_3168;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3169> AgradDistributionNormalSufficient_vv_3169;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3170> AgradDistributionNormalSufficient_vv_3170;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3171> AgradDistributionNormalSufficient_vv_3171;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3172> AgradDistributionNormalSufficient_vv_3172;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3173> AgradDistributionNormalSufficient_vv_3173;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3174> AgradDistributionNormalSufficient_vv_3174;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3175> AgradDistributionNormalSufficient_vv_3175;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3176> AgradDistributionNormalSufficient_vv_3176;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3177> AgradDistributionNormalSufficient_vv_3177;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3178> AgradDistributionNormalSufficient_vv_3178;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3179> AgradDistributionNormalSufficient_vv_3179;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3180> AgradDistributionNormalSufficient_vv_3180;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3181> AgradDistributionNormalSufficient_vv_3181;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3182> AgradDistributionNormalSufficient_vv_3182;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3183> AgradDistributionNormalSufficient_vv_3183;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3184> AgradDistributionNormalSufficient_vv_3184;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3185> AgradDistributionNormalSufficient_vv_3185;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3186> AgradDistributionNormalSufficient_vv_3186;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3187> AgradDistributionNormalSufficient_vv_3187;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3188> AgradDistributionNormalSufficient_vv_3188;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3189> AgradDistributionNormalSufficient_vv_3189;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3190> AgradDistributionNormalSufficient_vv_3190;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3191> AgradDistributionNormalSufficient_vv_3191;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3192> AgradDistributionNormalSufficient_vv_3192;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3193> AgradDistributionNormalSufficient_vv_3193;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3194> AgradDistributionNormalSufficient_vv_3194;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3195> AgradDistributionNormalSufficient_vv_3195;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3196> AgradDistributionNormalSufficient_vv_3196;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3197> AgradDistributionNormalSufficient_vv_3197;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3198> AgradDistributionNormalSufficient_vv_3198;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3199> AgradDistributionNormalSufficient_vv_3199;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3100, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3101, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3102, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3103, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3104, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3105, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3106, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3107, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3108, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3109, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3110, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3111, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3112, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3113, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3114, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3115, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3116, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3117, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3118, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3119, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3120, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3121, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3122, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3123, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3124, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3125, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3126, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3127, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3128, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3129, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3130, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3131, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3132, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3133, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3134, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3135, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3136, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3137, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3138, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3139, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3140, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3141, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3142, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3143, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3144, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3145, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3146, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3147, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3148, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3149, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3150, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3151, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3152, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3153, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3154, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3155, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3156, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3157, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3158, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3159, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3160, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3161, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3162, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3163, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3164, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3165, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3166, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3167, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3168, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3169, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3170, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3171, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3172, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3173, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3174, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3175, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3176, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3177, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3178, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3179, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3180, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3181, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3182, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3183, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3184, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3185, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3186, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3187, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3188, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3188);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3189, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3189);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3190, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3190);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3191, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3191);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3192, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3192);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3193, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3193);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3194, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3194);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3195, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3195);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3196, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3196);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3197, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3197);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3198, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3198);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3199, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3199);
+
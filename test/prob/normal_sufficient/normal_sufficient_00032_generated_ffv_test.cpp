@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/normal_sufficient/normal_sufficient_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_3200;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_3201;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_3202;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_3203;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_3204;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_3205;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_3206;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_3207;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_3208;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_3209;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_3210;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_3211;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_3212;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, double, double, empty> type_ffv_3213;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, double, std::vector<double>, empty> type_ffv_3214;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_3215;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, double, fvar<fvar<var> >, empty> type_ffv_3216;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_3217;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_3218;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<double>, double, empty> type_ffv_3219;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<double>, std::vector<double>, empty> type_ffv_3220;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_3221;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_3222;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_3223;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_3224;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffv_3225;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_3226;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_3227;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_3228;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_3229;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_3230;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, fvar<fvar<var> >, double, empty> type_ffv_3231;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_3232;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_3233;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_3234;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_3235;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_3236;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_3237;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_3238;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_3239;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_3240;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_3241;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_3242;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_3243;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_3244;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_3245;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_3246;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_3247;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_3248;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, double, double, empty> type_ffv_3249;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, double, std::vector<double>, empty> type_ffv_3250;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_3251;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, double, fvar<fvar<var> >, empty> type_ffv_3252;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_3253;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_3254;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, double, empty> type_ffv_3255;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, std::vector<double>, empty> type_ffv_3256;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_3257;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_3258;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_3259;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_3260;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffv_3261;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_3262;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_3263;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_3264;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_3265;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_3266;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, fvar<fvar<var> >, double, empty> type_ffv_3267;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_3268;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_3269;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_3270;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_3271;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_3272;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_3273;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_3274;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_3275;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_3276;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_3277;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_3278;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_3279;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_3280;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_3281;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_3282;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_3283;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_3284;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, double, empty> type_ffv_3285;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_ffv_3286;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_3287;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty> type_ffv_3288;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_3289;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_3290;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_ffv_3291;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_ffv_3292;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_3293;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_3294;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_3295;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_3296;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffv_3297;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_3298;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_3299;
+
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3200> AgradDistributionNormalSufficient_ffv_3200;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3201> AgradDistributionNormalSufficient_ffv_3201;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3202> AgradDistributionNormalSufficient_ffv_3202;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3203> AgradDistributionNormalSufficient_ffv_3203;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3204> AgradDistributionNormalSufficient_ffv_3204;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3205> AgradDistributionNormalSufficient_ffv_3205;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3206> AgradDistributionNormalSufficient_ffv_3206;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3207> AgradDistributionNormalSufficient_ffv_3207;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3208> AgradDistributionNormalSufficient_ffv_3208;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3209> AgradDistributionNormalSufficient_ffv_3209;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3210> AgradDistributionNormalSufficient_ffv_3210;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3211> AgradDistributionNormalSufficient_ffv_3211;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3212> AgradDistributionNormalSufficient_ffv_3212;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3213> AgradDistributionNormalSufficient_ffv_3213;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3214> AgradDistributionNormalSufficient_ffv_3214;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3215> AgradDistributionNormalSufficient_ffv_3215;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3216> AgradDistributionNormalSufficient_ffv_3216;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3217> AgradDistributionNormalSufficient_ffv_3217;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3218> AgradDistributionNormalSufficient_ffv_3218;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3219> AgradDistributionNormalSufficient_ffv_3219;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3220> AgradDistributionNormalSufficient_ffv_3220;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3221> AgradDistributionNormalSufficient_ffv_3221;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3222> AgradDistributionNormalSufficient_ffv_3222;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3223> AgradDistributionNormalSufficient_ffv_3223;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3224> AgradDistributionNormalSufficient_ffv_3224;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3225> AgradDistributionNormalSufficient_ffv_3225;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3226> AgradDistributionNormalSufficient_ffv_3226;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3227> AgradDistributionNormalSufficient_ffv_3227;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3228> AgradDistributionNormalSufficient_ffv_3228;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3229> AgradDistributionNormalSufficient_ffv_3229;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3230> AgradDistributionNormalSufficient_ffv_3230;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3231> AgradDistributionNormalSufficient_ffv_3231;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3232> AgradDistributionNormalSufficient_ffv_3232;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3233> AgradDistributionNormalSufficient_ffv_3233;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3234> AgradDistributionNormalSufficient_ffv_3234;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3235> AgradDistributionNormalSufficient_ffv_3235;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3236> AgradDistributionNormalSufficient_ffv_3236;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3237> AgradDistributionNormalSufficient_ffv_3237;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3238> AgradDistributionNormalSufficient_ffv_3238;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3239> AgradDistributionNormalSufficient_ffv_3239;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3240> AgradDistributionNormalSufficient_ffv_3240;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3241> AgradDistributionNormalSufficient_ffv_3241;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3242> AgradDistributionNormalSufficient_ffv_3242;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3243> AgradDistributionNormalSufficient_ffv_3243;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3244> AgradDistributionNormalSufficient_ffv_3244;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3245> AgradDistributionNormalSufficient_ffv_3245;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3246> AgradDistributionNormalSufficient_ffv_3246;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3247> AgradDistributionNormalSufficient_ffv_3247;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3248> AgradDistributionNormalSufficient_ffv_3248;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3249> AgradDistributionNormalSufficient_ffv_3249;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3250> AgradDistributionNormalSufficient_ffv_3250;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3251> AgradDistributionNormalSufficient_ffv_3251;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3252> AgradDistributionNormalSufficient_ffv_3252;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3253> AgradDistributionNormalSufficient_ffv_3253;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3254> AgradDistributionNormalSufficient_ffv_3254;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3255> AgradDistributionNormalSufficient_ffv_3255;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3256> AgradDistributionNormalSufficient_ffv_3256;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3257> AgradDistributionNormalSufficient_ffv_3257;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3258> AgradDistributionNormalSufficient_ffv_3258;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3259> AgradDistributionNormalSufficient_ffv_3259;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3260> AgradDistributionNormalSufficient_ffv_3260;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3261> AgradDistributionNormalSufficient_ffv_3261;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3262> AgradDistributionNormalSufficient_ffv_3262;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3263> AgradDistributionNormalSufficient_ffv_3263;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3264> AgradDistributionNormalSufficient_ffv_3264;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3265> AgradDistributionNormalSufficient_ffv_3265;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3266> AgradDistributionNormalSufficient_ffv_3266;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3267> AgradDistributionNormalSufficient_ffv_3267;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3268> AgradDistributionNormalSufficient_ffv_3268;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3269> AgradDistributionNormalSufficient_ffv_3269;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3270> AgradDistributionNormalSufficient_ffv_3270;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3271> AgradDistributionNormalSufficient_ffv_3271;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3272> AgradDistributionNormalSufficient_ffv_3272;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3273> AgradDistributionNormalSufficient_ffv_3273;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3274> AgradDistributionNormalSufficient_ffv_3274;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3275> AgradDistributionNormalSufficient_ffv_3275;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3276> AgradDistributionNormalSufficient_ffv_3276;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3277> AgradDistributionNormalSufficient_ffv_3277;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3278> AgradDistributionNormalSufficient_ffv_3278;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3279> AgradDistributionNormalSufficient_ffv_3279;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3280> AgradDistributionNormalSufficient_ffv_3280;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3281> AgradDistributionNormalSufficient_ffv_3281;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3282> AgradDistributionNormalSufficient_ffv_3282;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3283> AgradDistributionNormalSufficient_ffv_3283;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3284> AgradDistributionNormalSufficient_ffv_3284;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3285> AgradDistributionNormalSufficient_ffv_3285;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3286> AgradDistributionNormalSufficient_ffv_3286;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3287> AgradDistributionNormalSufficient_ffv_3287;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3288> AgradDistributionNormalSufficient_ffv_3288;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3289> AgradDistributionNormalSufficient_ffv_3289;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3290> AgradDistributionNormalSufficient_ffv_3290;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3291> AgradDistributionNormalSufficient_ffv_3291;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3292> AgradDistributionNormalSufficient_ffv_3292;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3293> AgradDistributionNormalSufficient_ffv_3293;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3294> AgradDistributionNormalSufficient_ffv_3294;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3295> AgradDistributionNormalSufficient_ffv_3295;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3296> AgradDistributionNormalSufficient_ffv_3296;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3297> AgradDistributionNormalSufficient_ffv_3297;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3298> AgradDistributionNormalSufficient_ffv_3298;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3299> AgradDistributionNormalSufficient_ffv_3299;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3200, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3200);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3201, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3201);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3202, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3202);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3203, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3203);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3204, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3204);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3205, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3205);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3206, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3206);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3207, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3207);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3208, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3208);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3209, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3209);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3210, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3210);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3211, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3211);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3212, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3212);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3213, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3213);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3214, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3214);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3215, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3215);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3216, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3216);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3217, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3217);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3218, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3218);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3219, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3219);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3220, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3220);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3221, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3221);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3222, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3222);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3223, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3223);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3224, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3224);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3225, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3225);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3226, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3226);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3227, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3227);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3228, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3228);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3229, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3229);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3230, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3230);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3231, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3231);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3232, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3232);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3233, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3233);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3234, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3234);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3235, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3235);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3236, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3236);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3237, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3237);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3238, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3238);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3239, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3239);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3240, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3240);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3241, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3241);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3242, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3242);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3243, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3243);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3244, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3244);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3245, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3245);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3246, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3246);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3247, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3247);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3248, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3248);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3249, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3249);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3250, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3250);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3251, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3251);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3252, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3252);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3253, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3253);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3254, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3254);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3255, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3255);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3256, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3256);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3257, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3257);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3258, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3258);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3259, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3259);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3260, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3260);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3261, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3261);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3262, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3262);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3263, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3263);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3264, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3264);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3265, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3265);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3266, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3266);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3267, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3267);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3268, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3268);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3269, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3269);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3270, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3270);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3271, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3271);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3272, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3272);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3273, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3273);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3274, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3274);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3275, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3275);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3276, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3276);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3277, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3277);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3278, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3278);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3279, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3279);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3280, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3280);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3281, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3281);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3282, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3282);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3283, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3283);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3284, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3284);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3285, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3285);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3286, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3286);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3287, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3287);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3288, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3288);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3289, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3289);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3290, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3290);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3291, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3291);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3292, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3292);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3293, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3293);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3294, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3294);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3295, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3295);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3296, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3296);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3297, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3297);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3298, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3298);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3299, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3299);
+
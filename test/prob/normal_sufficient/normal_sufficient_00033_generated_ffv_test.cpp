@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/normal_sufficient/normal_sufficient_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_3300;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_3301;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_3302;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty> type_ffv_3303;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_3304;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_3305;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_3306;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_3307;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_3308;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_3309;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_3310;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_3311;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_3312;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_3313;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_3314;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_3315;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_3316;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_3317;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_3318;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_3319;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_3320;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, int, double, double, empty> type_ffv_3321;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, int, double, std::vector<double>, empty> type_ffv_3322;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, int, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_3323;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, int, double, fvar<fvar<var> >, empty> type_ffv_3324;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, int, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_3325;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, int, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_3326;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, int, std::vector<double>, double, empty> type_ffv_3327;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, int, std::vector<double>, std::vector<double>, empty> type_ffv_3328;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, int, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_3329;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, int, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_3330;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, int, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_3331;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, int, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_3332;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffv_3333;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_3334;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_3335;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_3336;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_3337;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_3338;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, int, fvar<fvar<var> >, double, empty> type_ffv_3339;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, int, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_3340;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, int, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_3341;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, int, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_3342;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, int, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_3343;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, int, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_3344;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, int, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_3345;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, int, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_3346;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_3347;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, int, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_3348;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, int, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_3349;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_3350;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_3351;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_3352;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_3353;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_3354;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_3355;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_3356;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<int>, double, double, empty> type_ffv_3357;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<int>, double, std::vector<double>, empty> type_ffv_3358;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<int>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_3359;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<int>, double, fvar<fvar<var> >, empty> type_ffv_3360;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<int>, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_3361;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<int>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_3362;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<int>, std::vector<double>, double, empty> type_ffv_3363;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<int>, std::vector<double>, std::vector<double>, empty> type_ffv_3364;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<int>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_3365;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<int>, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_3366;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<int>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_3367;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<int>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_3368;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffv_3369;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_3370;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_3371;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_3372;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_3373;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_3374;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<int>, fvar<fvar<var> >, double, empty> type_ffv_3375;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<int>, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_3376;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_3377;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<int>, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_3378;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<int>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_3379;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_3380;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<int>, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_3381;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_3382;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_3383;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<int>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_3384;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_3385;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_3386;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_3387;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_3388;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_3389;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_3390;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_3391;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_3392;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, double, empty> type_ffv_3393;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_ffv_3394;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_3395;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty> type_ffv_3396;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_3397;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_3398;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_ffv_3399;
+
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3300> AgradDistributionNormalSufficient_ffv_3300;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3301> AgradDistributionNormalSufficient_ffv_3301;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3302> AgradDistributionNormalSufficient_ffv_3302;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3303> AgradDistributionNormalSufficient_ffv_3303;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3304> AgradDistributionNormalSufficient_ffv_3304;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3305> AgradDistributionNormalSufficient_ffv_3305;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3306> AgradDistributionNormalSufficient_ffv_3306;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3307> AgradDistributionNormalSufficient_ffv_3307;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3308> AgradDistributionNormalSufficient_ffv_3308;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3309> AgradDistributionNormalSufficient_ffv_3309;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3310> AgradDistributionNormalSufficient_ffv_3310;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3311> AgradDistributionNormalSufficient_ffv_3311;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3312> AgradDistributionNormalSufficient_ffv_3312;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3313> AgradDistributionNormalSufficient_ffv_3313;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3314> AgradDistributionNormalSufficient_ffv_3314;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3315> AgradDistributionNormalSufficient_ffv_3315;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3316> AgradDistributionNormalSufficient_ffv_3316;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3317> AgradDistributionNormalSufficient_ffv_3317;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3318> AgradDistributionNormalSufficient_ffv_3318;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3319> AgradDistributionNormalSufficient_ffv_3319;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3320> AgradDistributionNormalSufficient_ffv_3320;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3321> AgradDistributionNormalSufficient_ffv_3321;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3322> AgradDistributionNormalSufficient_ffv_3322;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3323> AgradDistributionNormalSufficient_ffv_3323;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3324> AgradDistributionNormalSufficient_ffv_3324;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3325> AgradDistributionNormalSufficient_ffv_3325;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3326> AgradDistributionNormalSufficient_ffv_3326;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3327> AgradDistributionNormalSufficient_ffv_3327;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3328> AgradDistributionNormalSufficient_ffv_3328;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3329> AgradDistributionNormalSufficient_ffv_3329;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3330> AgradDistributionNormalSufficient_ffv_3330;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3331> AgradDistributionNormalSufficient_ffv_3331;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3332> AgradDistributionNormalSufficient_ffv_3332;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3333> AgradDistributionNormalSufficient_ffv_3333;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3334> AgradDistributionNormalSufficient_ffv_3334;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3335> AgradDistributionNormalSufficient_ffv_3335;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3336> AgradDistributionNormalSufficient_ffv_3336;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3337> AgradDistributionNormalSufficient_ffv_3337;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3338> AgradDistributionNormalSufficient_ffv_3338;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3339> AgradDistributionNormalSufficient_ffv_3339;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3340> AgradDistributionNormalSufficient_ffv_3340;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3341> AgradDistributionNormalSufficient_ffv_3341;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3342> AgradDistributionNormalSufficient_ffv_3342;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3343> AgradDistributionNormalSufficient_ffv_3343;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3344> AgradDistributionNormalSufficient_ffv_3344;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3345> AgradDistributionNormalSufficient_ffv_3345;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3346> AgradDistributionNormalSufficient_ffv_3346;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3347> AgradDistributionNormalSufficient_ffv_3347;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3348> AgradDistributionNormalSufficient_ffv_3348;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3349> AgradDistributionNormalSufficient_ffv_3349;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3350> AgradDistributionNormalSufficient_ffv_3350;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3351> AgradDistributionNormalSufficient_ffv_3351;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3352> AgradDistributionNormalSufficient_ffv_3352;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3353> AgradDistributionNormalSufficient_ffv_3353;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3354> AgradDistributionNormalSufficient_ffv_3354;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3355> AgradDistributionNormalSufficient_ffv_3355;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3356> AgradDistributionNormalSufficient_ffv_3356;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3357> AgradDistributionNormalSufficient_ffv_3357;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3358> AgradDistributionNormalSufficient_ffv_3358;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3359> AgradDistributionNormalSufficient_ffv_3359;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3360> AgradDistributionNormalSufficient_ffv_3360;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3361> AgradDistributionNormalSufficient_ffv_3361;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3362> AgradDistributionNormalSufficient_ffv_3362;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3363> AgradDistributionNormalSufficient_ffv_3363;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3364> AgradDistributionNormalSufficient_ffv_3364;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3365> AgradDistributionNormalSufficient_ffv_3365;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3366> AgradDistributionNormalSufficient_ffv_3366;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3367> AgradDistributionNormalSufficient_ffv_3367;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3368> AgradDistributionNormalSufficient_ffv_3368;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3369> AgradDistributionNormalSufficient_ffv_3369;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3370> AgradDistributionNormalSufficient_ffv_3370;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3371> AgradDistributionNormalSufficient_ffv_3371;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3372> AgradDistributionNormalSufficient_ffv_3372;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3373> AgradDistributionNormalSufficient_ffv_3373;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3374> AgradDistributionNormalSufficient_ffv_3374;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3375> AgradDistributionNormalSufficient_ffv_3375;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3376> AgradDistributionNormalSufficient_ffv_3376;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3377> AgradDistributionNormalSufficient_ffv_3377;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3378> AgradDistributionNormalSufficient_ffv_3378;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3379> AgradDistributionNormalSufficient_ffv_3379;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3380> AgradDistributionNormalSufficient_ffv_3380;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3381> AgradDistributionNormalSufficient_ffv_3381;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3382> AgradDistributionNormalSufficient_ffv_3382;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3383> AgradDistributionNormalSufficient_ffv_3383;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3384> AgradDistributionNormalSufficient_ffv_3384;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3385> AgradDistributionNormalSufficient_ffv_3385;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3386> AgradDistributionNormalSufficient_ffv_3386;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3387> AgradDistributionNormalSufficient_ffv_3387;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3388> AgradDistributionNormalSufficient_ffv_3388;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3389> AgradDistributionNormalSufficient_ffv_3389;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3390> AgradDistributionNormalSufficient_ffv_3390;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3391> AgradDistributionNormalSufficient_ffv_3391;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3392> AgradDistributionNormalSufficient_ffv_3392;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3393> AgradDistributionNormalSufficient_ffv_3393;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3394> AgradDistributionNormalSufficient_ffv_3394;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3395> AgradDistributionNormalSufficient_ffv_3395;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3396> AgradDistributionNormalSufficient_ffv_3396;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3397> AgradDistributionNormalSufficient_ffv_3397;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3398> AgradDistributionNormalSufficient_ffv_3398;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3399> AgradDistributionNormalSufficient_ffv_3399;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3300, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3300);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3301, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3301);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3302, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3302);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3303, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3303);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3304, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3304);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3305, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3305);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3306, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3306);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3307, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3307);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3308, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3308);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3309, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3309);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3310, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3310);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3311, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3311);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3312, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3312);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3313, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3313);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3314, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3314);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3315, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3315);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3316, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3316);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3317, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3317);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3318, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3318);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3319, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3319);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3320, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3320);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3321, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3321);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3322, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3322);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3323, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3323);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3324, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3324);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3325, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3325);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3326, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3326);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3327, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3327);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3328, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3328);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3329, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3329);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3330, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3330);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3331, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3331);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3332, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3332);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3333, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3333);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3334, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3334);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3335, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3335);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3336, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3336);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3337, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3337);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3338, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3338);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3339, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3339);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3340, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3340);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3341, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3341);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3342, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3342);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3343, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3343);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3344, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3344);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3345, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3345);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3346, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3346);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3347, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3347);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3348, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3348);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3349, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3349);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3350, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3350);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3351, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3351);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3352, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3352);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3353, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3353);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3354, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3354);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3355, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3355);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3356, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3356);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3357, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3357);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3358, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3358);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3359, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3359);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3360, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3360);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3361, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3361);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3362, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3362);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3363, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3363);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3364, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3364);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3365, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3365);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3366, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3366);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3367, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3367);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3368, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3368);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3369, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3369);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3370, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3370);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3371, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3371);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3372, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3372);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3373, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3373);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3374, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3374);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3375, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3375);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3376, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3376);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3377, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3377);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3378, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3378);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3379, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3379);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3380, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3380);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3381, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3381);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3382, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3382);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3383, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3383);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3384, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3384);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3385, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3385);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3386, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3386);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3387, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3387);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3388, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3388);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3389, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3389);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3390, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3390);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3391, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3391);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3392, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3392);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3393, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3393);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3394, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3394);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3395, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3395);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3396, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3396);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3397, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3397);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3398, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3398);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3399, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3399);
+
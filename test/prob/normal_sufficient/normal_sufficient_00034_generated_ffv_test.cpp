@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/normal_sufficient/normal_sufficient_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_ffv_3400;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_3401;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_3402;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_3403;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_3404;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffv_3405;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_3406;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_3407;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_3408;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_3409;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_3410;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty> type_ffv_3411;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_3412;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_3413;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_3414;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_3415;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_3416;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_3417;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_3418;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_3419;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_3420;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_3421;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_3422;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_3423;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_3424;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_3425;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_3426;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_3427;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_3428;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, int, double, double, empty> type_ffv_3429;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, int, double, std::vector<double>, empty> type_ffv_3430;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, int, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_3431;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, int, double, fvar<fvar<var> >, empty> type_ffv_3432;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, int, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_3433;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, int, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_3434;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, int, std::vector<double>, double, empty> type_ffv_3435;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, int, std::vector<double>, std::vector<double>, empty> type_ffv_3436;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, int, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_3437;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, int, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_3438;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, int, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_3439;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, int, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_3440;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffv_3441;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_3442;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_3443;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_3444;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_3445;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_3446;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, int, fvar<fvar<var> >, double, empty> type_ffv_3447;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, int, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_3448;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, int, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_3449;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, int, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_3450;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, int, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_3451;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, int, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_3452;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, int, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_3453;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, int, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_3454;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_3455;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, int, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_3456;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, int, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_3457;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, int, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_3458;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_3459;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_3460;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_3461;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_3462;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_3463;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_3464;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<int>, double, double, empty> type_ffv_3465;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<int>, double, std::vector<double>, empty> type_ffv_3466;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<int>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_3467;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<int>, double, fvar<fvar<var> >, empty> type_ffv_3468;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<int>, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_3469;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<int>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_3470;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<int>, std::vector<double>, double, empty> type_ffv_3471;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<int>, std::vector<double>, std::vector<double>, empty> type_ffv_3472;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<int>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_3473;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<int>, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_3474;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<int>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_3475;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<int>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_3476;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffv_3477;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_3478;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_3479;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_3480;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_3481;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_3482;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<int>, fvar<fvar<var> >, double, empty> type_ffv_3483;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<int>, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_3484;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_3485;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<int>, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_3486;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<int>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_3487;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<int>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_3488;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<int>, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_3489;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_3490;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_3491;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<int>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_3492;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_3493;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_3494;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_3495;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_3496;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_3497;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_3498;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_3499;
+
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3400> AgradDistributionNormalSufficient_ffv_3400;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3401> AgradDistributionNormalSufficient_ffv_3401;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3402> AgradDistributionNormalSufficient_ffv_3402;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3403> AgradDistributionNormalSufficient_ffv_3403;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3404> AgradDistributionNormalSufficient_ffv_3404;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3405> AgradDistributionNormalSufficient_ffv_3405;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3406> AgradDistributionNormalSufficient_ffv_3406;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3407> AgradDistributionNormalSufficient_ffv_3407;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3408> AgradDistributionNormalSufficient_ffv_3408;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3409> AgradDistributionNormalSufficient_ffv_3409;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3410> AgradDistributionNormalSufficient_ffv_3410;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3411> AgradDistributionNormalSufficient_ffv_3411;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3412> AgradDistributionNormalSufficient_ffv_3412;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3413> AgradDistributionNormalSufficient_ffv_3413;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3414> AgradDistributionNormalSufficient_ffv_3414;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3415> AgradDistributionNormalSufficient_ffv_3415;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3416> AgradDistributionNormalSufficient_ffv_3416;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3417> AgradDistributionNormalSufficient_ffv_3417;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3418> AgradDistributionNormalSufficient_ffv_3418;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3419> AgradDistributionNormalSufficient_ffv_3419;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3420> AgradDistributionNormalSufficient_ffv_3420;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3421> AgradDistributionNormalSufficient_ffv_3421;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3422> AgradDistributionNormalSufficient_ffv_3422;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3423> AgradDistributionNormalSufficient_ffv_3423;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3424> AgradDistributionNormalSufficient_ffv_3424;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3425> AgradDistributionNormalSufficient_ffv_3425;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3426> AgradDistributionNormalSufficient_ffv_3426;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3427> AgradDistributionNormalSufficient_ffv_3427;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3428> AgradDistributionNormalSufficient_ffv_3428;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3429> AgradDistributionNormalSufficient_ffv_3429;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3430> AgradDistributionNormalSufficient_ffv_3430;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3431> AgradDistributionNormalSufficient_ffv_3431;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3432> AgradDistributionNormalSufficient_ffv_3432;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3433> AgradDistributionNormalSufficient_ffv_3433;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3434> AgradDistributionNormalSufficient_ffv_3434;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3435> AgradDistributionNormalSufficient_ffv_3435;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3436> AgradDistributionNormalSufficient_ffv_3436;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3437> AgradDistributionNormalSufficient_ffv_3437;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3438> AgradDistributionNormalSufficient_ffv_3438;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3439> AgradDistributionNormalSufficient_ffv_3439;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3440> AgradDistributionNormalSufficient_ffv_3440;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3441> AgradDistributionNormalSufficient_ffv_3441;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3442> AgradDistributionNormalSufficient_ffv_3442;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3443> AgradDistributionNormalSufficient_ffv_3443;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3444> AgradDistributionNormalSufficient_ffv_3444;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3445> AgradDistributionNormalSufficient_ffv_3445;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3446> AgradDistributionNormalSufficient_ffv_3446;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3447> AgradDistributionNormalSufficient_ffv_3447;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3448> AgradDistributionNormalSufficient_ffv_3448;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3449> AgradDistributionNormalSufficient_ffv_3449;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3450> AgradDistributionNormalSufficient_ffv_3450;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3451> AgradDistributionNormalSufficient_ffv_3451;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3452> AgradDistributionNormalSufficient_ffv_3452;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3453> AgradDistributionNormalSufficient_ffv_3453;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3454> AgradDistributionNormalSufficient_ffv_3454;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3455> AgradDistributionNormalSufficient_ffv_3455;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3456> AgradDistributionNormalSufficient_ffv_3456;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3457> AgradDistributionNormalSufficient_ffv_3457;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3458> AgradDistributionNormalSufficient_ffv_3458;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3459> AgradDistributionNormalSufficient_ffv_3459;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3460> AgradDistributionNormalSufficient_ffv_3460;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3461> AgradDistributionNormalSufficient_ffv_3461;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3462> AgradDistributionNormalSufficient_ffv_3462;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3463> AgradDistributionNormalSufficient_ffv_3463;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3464> AgradDistributionNormalSufficient_ffv_3464;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3465> AgradDistributionNormalSufficient_ffv_3465;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3466> AgradDistributionNormalSufficient_ffv_3466;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3467> AgradDistributionNormalSufficient_ffv_3467;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3468> AgradDistributionNormalSufficient_ffv_3468;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3469> AgradDistributionNormalSufficient_ffv_3469;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3470> AgradDistributionNormalSufficient_ffv_3470;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3471> AgradDistributionNormalSufficient_ffv_3471;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3472> AgradDistributionNormalSufficient_ffv_3472;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3473> AgradDistributionNormalSufficient_ffv_3473;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3474> AgradDistributionNormalSufficient_ffv_3474;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3475> AgradDistributionNormalSufficient_ffv_3475;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3476> AgradDistributionNormalSufficient_ffv_3476;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3477> AgradDistributionNormalSufficient_ffv_3477;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3478> AgradDistributionNormalSufficient_ffv_3478;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3479> AgradDistributionNormalSufficient_ffv_3479;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3480> AgradDistributionNormalSufficient_ffv_3480;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3481> AgradDistributionNormalSufficient_ffv_3481;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3482> AgradDistributionNormalSufficient_ffv_3482;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3483> AgradDistributionNormalSufficient_ffv_3483;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3484> AgradDistributionNormalSufficient_ffv_3484;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3485> AgradDistributionNormalSufficient_ffv_3485;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3486> AgradDistributionNormalSufficient_ffv_3486;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3487> AgradDistributionNormalSufficient_ffv_3487;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3488> AgradDistributionNormalSufficient_ffv_3488;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3489> AgradDistributionNormalSufficient_ffv_3489;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3490> AgradDistributionNormalSufficient_ffv_3490;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3491> AgradDistributionNormalSufficient_ffv_3491;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3492> AgradDistributionNormalSufficient_ffv_3492;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3493> AgradDistributionNormalSufficient_ffv_3493;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3494> AgradDistributionNormalSufficient_ffv_3494;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3495> AgradDistributionNormalSufficient_ffv_3495;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3496> AgradDistributionNormalSufficient_ffv_3496;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3497> AgradDistributionNormalSufficient_ffv_3497;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3498> AgradDistributionNormalSufficient_ffv_3498;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3499> AgradDistributionNormalSufficient_ffv_3499;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3400, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3400);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3401, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3401);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3402, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3402);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3403, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3403);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3404, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3404);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3405, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3405);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3406, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3406);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3407, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3407);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3408, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3408);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3409, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3409);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3410, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3410);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3411, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3411);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3412, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3412);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3413, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3413);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3414, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3414);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3415, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3415);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3416, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3416);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3417, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3417);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3418, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3418);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3419, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3419);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3420, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3420);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3421, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3421);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3422, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3422);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3423, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3423);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3424, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3424);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3425, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3425);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3426, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3426);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3427, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3427);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3428, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3428);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3429, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3429);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3430, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3430);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3431, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3431);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3432, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3432);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3433, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3433);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3434, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3434);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3435, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3435);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3436, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3436);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3437, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3437);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3438, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3438);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3439, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3439);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3440, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3440);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3441, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3441);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3442, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3442);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3443, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3443);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3444, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3444);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3445, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3445);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3446, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3446);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3447, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3447);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3448, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3448);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3449, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3449);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3450, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3450);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3451, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3451);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3452, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3452);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3453, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3453);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3454, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3454);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3455, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3455);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3456, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3456);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3457, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3457);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3458, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3458);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3459, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3459);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3460, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3460);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3461, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3461);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3462, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3462);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3463, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3463);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3464, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3464);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3465, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3465);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3466, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3466);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3467, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3467);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3468, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3468);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3469, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3469);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3470, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3470);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3471, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3471);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3472, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3472);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3473, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3473);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3474, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3474);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3475, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3475);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3476, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3476);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3477, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3477);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3478, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3478);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3479, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3479);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3480, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3480);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3481, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3481);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3482, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3482);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3483, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3483);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3484, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3484);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3485, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3485);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3486, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3486);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3487, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3487);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3488, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3488);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3489, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3489);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3490, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3490);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3491, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3491);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3492, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3492);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3493, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3493);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3494, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3494);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3495, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3495);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3496, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3496);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3497, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3497);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3498, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3498);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3499, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3499);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/normal_sufficient/normal_sufficient_test.hpp>
+
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_vv_3400;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_3401;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, var, empty> type_vv_3402;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty> type_vv_3403;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_3404;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_vv_3405;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_vv_3406;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_3407;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_vv_3408;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_vv_3409;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_3410;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, double, empty> type_vv_3411;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<double>, empty> type_vv_3412;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_3413;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, var, empty> type_vv_3414;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<var>, empty> type_vv_3415;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_3416;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, double, empty> type_vv_3417;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty> type_vv_3418;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_3419;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, var, empty> type_vv_3420;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty> type_vv_3421;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_3422;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty> type_vv_3423;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty> type_vv_3424;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_3425;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty> type_vv_3426;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty> type_vv_3427;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_3428;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, int, double, double, empty> type_vv_3429;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, int, double, std::vector<double>, empty> type_vv_3430;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, int, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_3431;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, int, double, var, empty> type_vv_3432;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, int, double, std::vector<var>, empty> type_vv_3433;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, int, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_3434;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, int, std::vector<double>, double, empty> type_vv_3435;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, int, std::vector<double>, std::vector<double>, empty> type_vv_3436;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, int, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_3437;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, int, std::vector<double>, var, empty> type_vv_3438;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, int, std::vector<double>, std::vector<var>, empty> type_vv_3439;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, int, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_3440;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_vv_3441;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_vv_3442;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_3443;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_vv_3444;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_vv_3445;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_3446;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, int, var, double, empty> type_vv_3447;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, int, var, std::vector<double>, empty> type_vv_3448;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, int, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_3449;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, int, var, var, empty> type_vv_3450;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, int, var, std::vector<var>, empty> type_vv_3451;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, int, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_3452;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, int, std::vector<var>, double, empty> type_vv_3453;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, int, std::vector<var>, std::vector<double>, empty> type_vv_3454;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, int, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_3455;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, int, std::vector<var>, var, empty> type_vv_3456;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, int, std::vector<var>, std::vector<var>, empty> type_vv_3457;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, int, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_3458;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty> type_vv_3459;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty> type_vv_3460;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_3461;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty> type_vv_3462;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty> type_vv_3463;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_3464;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<int>, double, double, empty> type_vv_3465;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<int>, double, std::vector<double>, empty> type_vv_3466;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<int>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_3467;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<int>, double, var, empty> type_vv_3468;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<int>, double, std::vector<var>, empty> type_vv_3469;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<int>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_3470;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<int>, std::vector<double>, double, empty> type_vv_3471;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<int>, std::vector<double>, std::vector<double>, empty> type_vv_3472;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<int>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_3473;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<int>, std::vector<double>, var, empty> type_vv_3474;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<int>, std::vector<double>, std::vector<var>, empty> type_vv_3475;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<int>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_3476;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_vv_3477;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_vv_3478;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_3479;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_vv_3480;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_vv_3481;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_3482;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<int>, var, double, empty> type_vv_3483;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<int>, var, std::vector<double>, empty> type_vv_3484;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<int>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_3485;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<int>, var, var, empty> type_vv_3486;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<int>, var, std::vector<var>, empty> type_vv_3487;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<int>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_3488;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<int>, std::vector<var>, double, empty> type_vv_3489;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<int>, std::vector<var>, std::vector<double>, empty> type_vv_3490;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<int>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_3491;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<int>, std::vector<var>, var, empty> type_vv_3492;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<int>, std::vector<var>, std::vector<var>, empty> type_vv_3493;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<int>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_3494;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty> type_vv_3495;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty> type_vv_3496;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_3497;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty> type_vv_3498;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty> type_vv_3499;
+
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3400> AgradDistributionNormalSufficient_vv_3400;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3401> AgradDistributionNormalSufficient_vv_3401;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3402> AgradDistributionNormalSufficient_vv_3402;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3403> AgradDistributionNormalSufficient_vv_3403;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3404> AgradDistributionNormalSufficient_vv_3404;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3405> AgradDistributionNormalSufficient_vv_3405;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3406> AgradDistributionNormalSufficient_vv_3406;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3407> AgradDistributionNormalSufficient_vv_3407;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3408> AgradDistributionNormalSufficient_vv_3408;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3409> AgradDistributionNormalSufficient_vv_3409;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3410> AgradDistributionNormalSufficient_vv_3410;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3411> AgradDistributionNormalSufficient_vv_3411;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3412> AgradDistributionNormalSufficient_vv_3412;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3413> AgradDistributionNormalSufficient_vv_3413;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3414> AgradDistributionNormalSufficient_vv_3414;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3415> AgradDistributionNormalSufficient_vv_3415;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3416> AgradDistributionNormalSufficient_vv_3416;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3417> AgradDistributionNormalSufficient_vv_3417;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3418> AgradDistributionNormalSufficient_vv_3418;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3419> AgradDistributionNormalSufficient_vv_3419;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3420> AgradDistributionNormalSufficient_vv_3420;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3421> AgradDistributionNormalSufficient_vv_3421;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3422> AgradDistributionNormalSufficient_vv_3422;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3423> AgradDistributionNormalSufficient_vv_3423;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3424> AgradDistributionNormalSufficient_vv_3424;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3425> AgradDistributionNormalSufficient_vv_3425;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3426> AgradDistributionNormalSufficient_vv_3426;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3427> AgradDistributionNormalSufficient_vv_3427;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3428> AgradDistributionNormalSufficient_vv_3428;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3429> AgradDistributionNormalSufficient_vv_3429;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3430> AgradDistributionNormalSufficient_vv_3430;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3431> AgradDistributionNormalSufficient_vv_3431;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3432> AgradDistributionNormalSufficient_vv_3432;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3433> AgradDistributionNormalSufficient_vv_3433;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3434> AgradDistributionNormalSufficient_vv_3434;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3435> AgradDistributionNormalSufficient_vv_3435;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3436> AgradDistributionNormalSufficient_vv_3436;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3437> AgradDistributionNormalSufficient_vv_3437;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3438> AgradDistributionNormalSufficient_vv_3438;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3439> AgradDistributionNormalSufficient_vv_3439;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3440> AgradDistributionNormalSufficient_vv_3440;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3441> AgradDistributionNormalSufficient_vv_3441;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3442> AgradDistributionNormalSufficient_vv_3442;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3443> AgradDistributionNormalSufficient_vv_3443;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3444> AgradDistributionNormalSufficient_vv_3444;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3445> AgradDistributionNormalSufficient_vv_3445;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3446> AgradDistributionNormalSufficient_vv_3446;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3447> AgradDistributionNormalSufficient_vv_3447;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3448> AgradDistributionNormalSufficient_vv_3448;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3449> AgradDistributionNormalSufficient_vv_3449;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3450> AgradDistributionNormalSufficient_vv_3450;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3451> AgradDistributionNormalSufficient_vv_3451;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3452> AgradDistributionNormalSufficient_vv_3452;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3453> AgradDistributionNormalSufficient_vv_3453;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3454> AgradDistributionNormalSufficient_vv_3454;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3455> AgradDistributionNormalSufficient_vv_3455;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3456> AgradDistributionNormalSufficient_vv_3456;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3457> AgradDistributionNormalSufficient_vv_3457;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3458> AgradDistributionNormalSufficient_vv_3458;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3459> AgradDistributionNormalSufficient_vv_3459;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3460> AgradDistributionNormalSufficient_vv_3460;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3461> AgradDistributionNormalSufficient_vv_3461;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3462> AgradDistributionNormalSufficient_vv_3462;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3463> AgradDistributionNormalSufficient_vv_3463;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3464> AgradDistributionNormalSufficient_vv_3464;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3465> AgradDistributionNormalSufficient_vv_3465;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3466> AgradDistributionNormalSufficient_vv_3466;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3467> AgradDistributionNormalSufficient_vv_3467;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3468> AgradDistributionNormalSufficient_vv_3468;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3469> AgradDistributionNormalSufficient_vv_3469;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3470> AgradDistributionNormalSufficient_vv_3470;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3471> AgradDistributionNormalSufficient_vv_3471;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3472> AgradDistributionNormalSufficient_vv_3472;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3473> AgradDistributionNormalSufficient_vv_3473;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3474> AgradDistributionNormalSufficient_vv_3474;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3475> AgradDistributionNormalSufficient_vv_3475;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3476> AgradDistributionNormalSufficient_vv_3476;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3477> AgradDistributionNormalSufficient_vv_3477;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3478> AgradDistributionNormalSufficient_vv_3478;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3479> AgradDistributionNormalSufficient_vv_3479;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3480> AgradDistributionNormalSufficient_vv_3480;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3481> AgradDistributionNormalSufficient_vv_3481;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3482> AgradDistributionNormalSufficient_vv_3482;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3483> AgradDistributionNormalSufficient_vv_3483;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3484> AgradDistributionNormalSufficient_vv_3484;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3485> AgradDistributionNormalSufficient_vv_3485;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3486> AgradDistributionNormalSufficient_vv_3486;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3487> AgradDistributionNormalSufficient_vv_3487;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3488> AgradDistributionNormalSufficient_vv_3488;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3489> AgradDistributionNormalSufficient_vv_3489;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3490> AgradDistributionNormalSufficient_vv_3490;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3491> AgradDistributionNormalSufficient_vv_3491;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3492> AgradDistributionNormalSufficient_vv_3492;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3493> AgradDistributionNormalSufficient_vv_3493;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3494> AgradDistributionNormalSufficient_vv_3494;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3495> AgradDistributionNormalSufficient_vv_3495;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3496> AgradDistributionNormalSufficient_vv_3496;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3497> AgradDistributionNormalSufficient_vv_3497;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3498> AgradDistributionNormalSufficient_vv_3498;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3499> AgradDistributionNormalSufficient_vv_3499;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3400, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3400);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3401, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3401);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3402, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3402);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3403, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3403);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3404, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3404);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3405, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3405);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3406, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3406);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3407, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3407);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3408, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3408);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3409, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3409);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3410, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3410);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3411, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3411);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3412, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3412);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3413, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3413);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3414, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3414);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3415, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3415);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3416, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3416);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3417, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3417);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3418, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3418);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3419, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3419);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3420, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3420);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3421, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3421);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3422, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3422);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3423, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3423);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3424, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3424);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3425, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3425);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3426, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3426);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3427, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3427);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3428, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3428);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3429, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3429);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3430, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3430);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3431, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3431);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3432, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3432);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3433, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3433);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3434, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3434);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3435, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3435);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3436, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3436);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3437, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3437);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3438, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3438);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3439, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3439);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3440, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3440);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3441, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3441);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3442, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3442);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3443, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3443);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3444, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3444);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3445, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3445);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3446, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3446);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3447, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3447);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3448, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3448);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3449, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3449);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3450, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3450);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3451, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3451);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3452, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3452);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3453, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3453);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3454, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3454);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3455, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3455);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3456, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3456);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3457, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3457);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3458, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3458);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3459, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3459);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3460, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3460);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3461, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3461);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3462, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3462);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3463, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3463);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3464, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3464);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3465, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3465);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3466, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3466);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3467, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3467);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3468, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3468);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3469, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3469);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3470, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3470);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3471, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3471);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3472, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3472);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3473, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3473);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3474, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3474);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3475, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3475);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3476, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3476);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3477, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3477);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3478, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3478);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3479, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3479);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3480, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3480);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3481, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3481);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3482, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3482);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3483, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3483);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3484, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3484);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3485, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3485);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3486, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3486);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3487, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3487);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3488, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3488);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3489, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3489);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3490, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3490);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3491, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3491);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3492, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3492);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3493, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3493);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3494, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3494);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3495, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3495);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3496, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3496);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3497, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3497);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3498, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3498);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3499, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3499);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/normal_sufficient/normal_sufficient_test.hpp>
+
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_3500;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, double, empty> type_vv_3501;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_vv_3502;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_3503;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, var, empty> type_vv_3504;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<var>, empty> type_vv_3505;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_3506;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_vv_3507;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_vv_3508;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_3509;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, var, empty> type_vv_3510;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty> type_vv_3511;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_3512;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_vv_3513;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_vv_3514;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_3515;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_vv_3516;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_vv_3517;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_3518;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, double, empty> type_vv_3519;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<double>, empty> type_vv_3520;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_3521;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, var, empty> type_vv_3522;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<var>, empty> type_vv_3523;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_3524;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, double, empty> type_vv_3525;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty> type_vv_3526;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_3527;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, var, empty> type_vv_3528;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty> type_vv_3529;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_3530;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty> type_vv_3531;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty> type_vv_3532;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_3533;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty> type_vv_3534;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty> type_vv_3535;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_3536;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, int, double, double, empty> type_vv_3537;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, int, double, std::vector<double>, empty> type_vv_3538;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, int, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_3539;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, int, double, var, empty> type_vv_3540;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, int, double, std::vector<var>, empty> type_vv_3541;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, int, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_3542;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, int, std::vector<double>, double, empty> type_vv_3543;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, int, std::vector<double>, std::vector<double>, empty> type_vv_3544;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, int, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_3545;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, int, std::vector<double>, var, empty> type_vv_3546;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, int, std::vector<double>, std::vector<var>, empty> type_vv_3547;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, int, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_3548;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_vv_3549;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_vv_3550;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_3551;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_vv_3552;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_vv_3553;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_3554;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, int, var, double, empty> type_vv_3555;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, int, var, std::vector<double>, empty> type_vv_3556;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, int, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_3557;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, int, var, var, empty> type_vv_3558;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, int, var, std::vector<var>, empty> type_vv_3559;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, int, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_3560;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, int, std::vector<var>, double, empty> type_vv_3561;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, int, std::vector<var>, std::vector<double>, empty> type_vv_3562;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, int, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_3563;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, int, std::vector<var>, var, empty> type_vv_3564;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, int, std::vector<var>, std::vector<var>, empty> type_vv_3565;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, int, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_3566;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty> type_vv_3567;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty> type_vv_3568;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_3569;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty> type_vv_3570;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty> type_vv_3571;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_3572;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<int>, double, double, empty> type_vv_3573;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<int>, double, std::vector<double>, empty> type_vv_3574;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<int>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_3575;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<int>, double, var, empty> type_vv_3576;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<int>, double, std::vector<var>, empty> type_vv_3577;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<int>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_3578;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<int>, std::vector<double>, double, empty> type_vv_3579;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<int>, std::vector<double>, std::vector<double>, empty> type_vv_3580;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<int>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_3581;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<int>, std::vector<double>, var, empty> type_vv_3582;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<int>, std::vector<double>, std::vector<var>, empty> type_vv_3583;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<int>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_3584;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_vv_3585;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_vv_3586;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_3587;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_vv_3588;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_vv_3589;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_3590;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<int>, var, double, empty> type_vv_3591;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<int>, var, std::vector<double>, empty> type_vv_3592;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<int>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_3593;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<int>, var, var, empty> type_vv_3594;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<int>, var, std::vector<var>, empty> type_vv_3595;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<int>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty> type_vv_3596;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<int>, std::vector<var>, double, empty> type_vv_3597;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<int>, std::vector<var>, std::vector<double>, empty> type_vv_3598;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<int>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_vv_3599;
+
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3500> AgradDistributionNormalSufficient_vv_3500;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3501> AgradDistributionNormalSufficient_vv_3501;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3502> AgradDistributionNormalSufficient_vv_3502;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3503> AgradDistributionNormalSufficient_vv_3503;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3504> AgradDistributionNormalSufficient_vv_3504;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3505> AgradDistributionNormalSufficient_vv_3505;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3506> AgradDistributionNormalSufficient_vv_3506;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3507> AgradDistributionNormalSufficient_vv_3507;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3508> AgradDistributionNormalSufficient_vv_3508;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3509> AgradDistributionNormalSufficient_vv_3509;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3510> AgradDistributionNormalSufficient_vv_3510;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3511> AgradDistributionNormalSufficient_vv_3511;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3512> AgradDistributionNormalSufficient_vv_3512;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3513> AgradDistributionNormalSufficient_vv_3513;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3514> AgradDistributionNormalSufficient_vv_3514;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3515> AgradDistributionNormalSufficient_vv_3515;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3516> AgradDistributionNormalSufficient_vv_3516;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3517> AgradDistributionNormalSufficient_vv_3517;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3518> AgradDistributionNormalSufficient_vv_3518;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3519> AgradDistributionNormalSufficient_vv_3519;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3520> AgradDistributionNormalSufficient_vv_3520;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3521> AgradDistributionNormalSufficient_vv_3521;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3522> AgradDistributionNormalSufficient_vv_3522;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3523> AgradDistributionNormalSufficient_vv_3523;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3524> AgradDistributionNormalSufficient_vv_3524;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3525> AgradDistributionNormalSufficient_vv_3525;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3526> AgradDistributionNormalSufficient_vv_3526;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3527> AgradDistributionNormalSufficient_vv_3527;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3528> AgradDistributionNormalSufficient_vv_3528;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3529> AgradDistributionNormalSufficient_vv_3529;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3530> AgradDistributionNormalSufficient_vv_3530;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3531> AgradDistributionNormalSufficient_vv_3531;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3532> AgradDistributionNormalSufficient_vv_3532;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3533> AgradDistributionNormalSufficient_vv_3533;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3534> AgradDistributionNormalSufficient_vv_3534;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3535> AgradDistributionNormalSufficient_vv_3535;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3536> AgradDistributionNormalSufficient_vv_3536;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3537> AgradDistributionNormalSufficient_vv_3537;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3538> AgradDistributionNormalSufficient_vv_3538;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3539> AgradDistributionNormalSufficient_vv_3539;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3540> AgradDistributionNormalSufficient_vv_3540;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3541> AgradDistributionNormalSufficient_vv_3541;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3542> AgradDistributionNormalSufficient_vv_3542;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3543> AgradDistributionNormalSufficient_vv_3543;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3544> AgradDistributionNormalSufficient_vv_3544;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3545> AgradDistributionNormalSufficient_vv_3545;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3546> AgradDistributionNormalSufficient_vv_3546;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3547> AgradDistributionNormalSufficient_vv_3547;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3548> AgradDistributionNormalSufficient_vv_3548;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3549> AgradDistributionNormalSufficient_vv_3549;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3550> AgradDistributionNormalSufficient_vv_3550;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3551> AgradDistributionNormalSufficient_vv_3551;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3552> AgradDistributionNormalSufficient_vv_3552;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3553> AgradDistributionNormalSufficient_vv_3553;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3554> AgradDistributionNormalSufficient_vv_3554;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3555> AgradDistributionNormalSufficient_vv_3555;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3556> AgradDistributionNormalSufficient_vv_3556;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3557> AgradDistributionNormalSufficient_vv_3557;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3558> AgradDistributionNormalSufficient_vv_3558;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3559> AgradDistributionNormalSufficient_vv_3559;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3560> AgradDistributionNormalSufficient_vv_3560;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3561> AgradDistributionNormalSufficient_vv_3561;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3562> AgradDistributionNormalSufficient_vv_3562;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3563> AgradDistributionNormalSufficient_vv_3563;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3564> AgradDistributionNormalSufficient_vv_3564;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3565> AgradDistributionNormalSufficient_vv_3565;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3566> AgradDistributionNormalSufficient_vv_3566;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3567> AgradDistributionNormalSufficient_vv_3567;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3568> AgradDistributionNormalSufficient_vv_3568;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3569> AgradDistributionNormalSufficient_vv_3569;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3570> AgradDistributionNormalSufficient_vv_3570;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3571> AgradDistributionNormalSufficient_vv_3571;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3572> AgradDistributionNormalSufficient_vv_3572;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3573> AgradDistributionNormalSufficient_vv_3573;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3574> AgradDistributionNormalSufficient_vv_3574;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3575> AgradDistributionNormalSufficient_vv_3575;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3576> AgradDistributionNormalSufficient_vv_3576;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3577> AgradDistributionNormalSufficient_vv_3577;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3578> AgradDistributionNormalSufficient_vv_3578;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3579> AgradDistributionNormalSufficient_vv_3579;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3580> AgradDistributionNormalSufficient_vv_3580;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3581> AgradDistributionNormalSufficient_vv_3581;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3582> AgradDistributionNormalSufficient_vv_3582;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3583> AgradDistributionNormalSufficient_vv_3583;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3584> AgradDistributionNormalSufficient_vv_3584;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3585> AgradDistributionNormalSufficient_vv_3585;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3586> AgradDistributionNormalSufficient_vv_3586;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3587> AgradDistributionNormalSufficient_vv_3587;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3588> AgradDistributionNormalSufficient_vv_3588;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3589> AgradDistributionNormalSufficient_vv_3589;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3590> AgradDistributionNormalSufficient_vv_3590;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3591> AgradDistributionNormalSufficient_vv_3591;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3592> AgradDistributionNormalSufficient_vv_3592;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3593> AgradDistributionNormalSufficient_vv_3593;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3594> AgradDistributionNormalSufficient_vv_3594;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3595> AgradDistributionNormalSufficient_vv_3595;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3596> AgradDistributionNormalSufficient_vv_3596;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3597> AgradDistributionNormalSufficient_vv_3597;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3598> AgradDistributionNormalSufficient_vv_3598;
+typedef std::tuple<AgradDistributionNormalSufficient, type_vv_3599> AgradDistributionNormalSufficient_vv_3599;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3500, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3500);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3501, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3501);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3502, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3502);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3503, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3503);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3504, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3504);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3505, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3505);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3506, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3506);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3507, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3507);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3508, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3508);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3509, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3509);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3510, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3510);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3511, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3511);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3512, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3512);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3513, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3513);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3514, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3514);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3515, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3515);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3516, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3516);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3517, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3517);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3518, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3518);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3519, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3519);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3520, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3520);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3521, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3521);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3522, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3522);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3523, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3523);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3524, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3524);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3525, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3525);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3526, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3526);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3527, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3527);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3528, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3528);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3529, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3529);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3530, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3530);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3531, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3531);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3532, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3532);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3533, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3533);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3534, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3534);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3535, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3535);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3536, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3536);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3537, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3537);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3538, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3538);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3539, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3539);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3540, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3540);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3541, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3541);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3542, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3542);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3543, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3543);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3544, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3544);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3545, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3545);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3546, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3546);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3547, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3547);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3548, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3548);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3549, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3549);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3550, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3550);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3551, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3551);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3552, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3552);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3553, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3553);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3554, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3554);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3555, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3555);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3556, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3556);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3557, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3557);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3558, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3558);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3559, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3559);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3560, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3560);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3561, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3561);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3562, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3562);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3563, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3563);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3564, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3564);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3565, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3565);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3566, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3566);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3567, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3567);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3568, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3568);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3569, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3569);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3570, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3570);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3571, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3571);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3572, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3572);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3573, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3573);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3574, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3574);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3575, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3575);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3576, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3576);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3577, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3577);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3578, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3578);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3579, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3579);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3580, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3580);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3581, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3581);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3582, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3582);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3583, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3583);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3584, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3584);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3585, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3585);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3586, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3586);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3587, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3587);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3588, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3588);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3589, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3589);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3590, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3590);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3591, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3591);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3592, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3592);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3593, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3593);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3594, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3594);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3595, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3595);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3596, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3596);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3597, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3597);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3598, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3598);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_vv_3599, AgradDistributionTestFixture, AgradDistributionNormalSufficient_vv_3599);
+
@@ -0,0 +1,146 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/normal_sufficient/normal_sufficient_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<int>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_3600;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<int>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_3601;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<int>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_3602;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_3603;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_3604;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_3605;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_3606;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_3607;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_3608;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, double, empty> type_ffv_3609;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_ffv_3610;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_3611;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty> type_ffv_3612;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty> type_ffv_3613;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_3614;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_ffv_3615;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_ffv_3616;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_3617;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty> type_ffv_3618;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty> type_ffv_3619;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_3620;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_ffv_3621;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_3622;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_3623;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_3624;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_3625;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_3626;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty> type_ffv_3627;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty> type_ffv_3628;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_3629;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty> type_ffv_3630;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty> type_ffv_3631;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_3632;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty> type_ffv_3633;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty> type_ffv_3634;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_3635;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty> type_ffv_3636;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty> type_ffv_3637;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_3638;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty> type_ffv_3639;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty> type_ffv_3640;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_ffv_3641;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty> type_ffv_3642;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty> type_ffv_3643;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty> type_ffv_3644;
+
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3600> AgradDistributionNormalSufficient_ffv_3600;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3601> AgradDistributionNormalSufficient_ffv_3601;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3602> AgradDistributionNormalSufficient_ffv_3602;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3603> AgradDistributionNormalSufficient_ffv_3603;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3604> AgradDistributionNormalSufficient_ffv_3604;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3605> AgradDistributionNormalSufficient_ffv_3605;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3606> AgradDistributionNormalSufficient_ffv_3606;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3607> AgradDistributionNormalSufficient_ffv_3607;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3608> AgradDistributionNormalSufficient_ffv_3608;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3609> AgradDistributionNormalSufficient_ffv_3609;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3610> AgradDistributionNormalSufficient_ffv_3610;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3611> AgradDistributionNormalSufficient_ffv_3611;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3612> AgradDistributionNormalSufficient_ffv_3612;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3613> AgradDistributionNormalSufficient_ffv_3613;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3614> AgradDistributionNormalSufficient_ffv_3614;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3615> AgradDistributionNormalSufficient_ffv_3615;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3616> AgradDistributionNormalSufficient_ffv_3616;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3617> AgradDistributionNormalSufficient_ffv_3617;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3618> AgradDistributionNormalSufficient_ffv_3618;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3619> AgradDistributionNormalSufficient_ffv_3619;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3620> AgradDistributionNormalSufficient_ffv_3620;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3621> AgradDistributionNormalSufficient_ffv_3621;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3622> AgradDistributionNormalSufficient_ffv_3622;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3623> AgradDistributionNormalSufficient_ffv_3623;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3624> AgradDistributionNormalSufficient_ffv_3624;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3625> AgradDistributionNormalSufficient_ffv_3625;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3626> AgradDistributionNormalSufficient_ffv_3626;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3627> AgradDistributionNormalSufficient_ffv_3627;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3628> AgradDistributionNormalSufficient_ffv_3628;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3629> AgradDistributionNormalSufficient_ffv_3629;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3630> AgradDistributionNormalSufficient_ffv_3630;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3631> AgradDistributionNormalSufficient_ffv_3631;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3632> AgradDistributionNormalSufficient_ffv_3632;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3633> AgradDistributionNormalSufficient_ffv_3633;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3634> AgradDistributionNormalSufficient_ffv_3634;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3635> AgradDistributionNormalSufficient_ffv_3635;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3636> AgradDistributionNormalSufficient_ffv_3636;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3637> AgradDistributionNormalSufficient_ffv_3637;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3638> AgradDistributionNormalSufficient_ffv_3638;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3639> AgradDistributionNormalSufficient_ffv_3639;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3640> AgradDistributionNormalSufficient_ffv_3640;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3641> AgradDistributionNormalSufficient_ffv_3641;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3642> AgradDistributionNormalSufficient_ffv_3642;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3643> AgradDistributionNormalSufficient_ffv_3643;
+typedef std::tuple<AgradDistributionNormalSufficient, type_ffv_3644> AgradDistributionNormalSufficient_ffv_3644;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3600, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3600);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3601, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3601);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3602, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3602);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3603, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3603);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3604, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3604);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3605, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3605);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3606, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3606);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3607, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3607);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3608, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3608);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3609, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3609);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3610, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3610);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3611, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3611);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3612, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3612);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3613, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3613);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3614, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3614);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3615, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3615);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3616, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3616);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3617, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3617);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3618, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3618);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3619, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3619);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3620, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3620);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3621, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3621);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3622, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3622);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3623, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3623);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3624, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3624);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3625, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3625);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3626, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3626);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3627, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3627);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3628, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3628);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3629, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3629);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3630, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3630);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3631, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3631);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3632, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3632);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3633, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3633);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3634, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3634);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3635, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3635);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3636, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3636);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3637, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3637);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3638, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3638);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3639, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3639);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3640, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3640);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3641, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3641);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3642, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3642);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3643, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3643);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_ffv_3644, AgradDistributionTestFixture, AgradDistributionNormalSufficient_ffv_3644);
+
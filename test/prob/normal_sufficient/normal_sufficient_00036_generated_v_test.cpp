@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/normal_sufficient/normal_sufficient_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<int>, double, double, empty> type_v_3600;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<int>, double, std::vector<double>, empty> type_v_3601;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<int>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_3602;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<int>, double, var, empty> type_v_3603;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<int>, double, std::vector<var>, empty> type_v_3604;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<int>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_3605;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<int>, std::vector<double>, double, empty> type_v_3606;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<int>, std::vector<double>, std::vector<double>, empty> type_v_3607;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<int>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_3608;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<int>, std::vector<double>, var, empty> type_v_3609;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<int>, std::vector<double>, std::vector<var>, empty> type_v_3610;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<int>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_3611;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_3612;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_3613;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_3614;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_3615;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_3616;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_3617;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<int>, var, double, empty> type_v_3618;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<int>, var, std::vector<double>, empty> type_v_3619;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<int>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_3620;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<int>, var, var, empty> type_v_3621;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<int>, var, std::vector<var>, empty> type_v_3622;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<int>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_3623;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<int>, std::vector<var>, double, empty> type_v_3624;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<int>, std::vector<var>, std::vector<double>, empty> type_v_3625;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<int>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_3626;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<int>, std::vector<var>, var, empty> type_v_3627;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<int>, std::vector<var>, std::vector<var>, empty> type_v_3628;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<int>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_3629;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_3630;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_3631;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_3632;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_3633;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_3634;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_3635;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, double, empty> type_v_3636;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_v_3637;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_3638;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, var, empty> type_v_3639;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<var>, empty> type_v_3640;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_3641;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_v_3642;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_v_3643;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_3644;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, var, empty> type_v_3645;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty> type_v_3646;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_3647;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_3648;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_3649;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_3650;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_3651;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_3652;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_3653;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, double, empty> type_v_3654;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<double>, empty> type_v_3655;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_3656;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, var, empty> type_v_3657;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<var>, empty> type_v_3658;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_3659;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, double, empty> type_v_3660;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty> type_v_3661;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_3662;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, var, empty> type_v_3663;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty> type_v_3664;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_3665;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_3666;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_3667;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_3668;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_3669;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_3670;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_3671;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, int, double, double, empty> type_v_3672;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, int, double, std::vector<double>, empty> type_v_3673;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, int, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_3674;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, int, double, var, empty> type_v_3675;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, int, double, std::vector<var>, empty> type_v_3676;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, int, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_3677;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, int, std::vector<double>, double, empty> type_v_3678;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, int, std::vector<double>, std::vector<double>, empty> type_v_3679;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, int, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_3680;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, int, std::vector<double>, var, empty> type_v_3681;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, int, std::vector<double>, std::vector<var>, empty> type_v_3682;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, int, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_3683;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_3684;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_3685;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_3686;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_3687;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_3688;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_3689;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, int, var, double, empty> type_v_3690;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, int, var, std::vector<double>, empty> type_v_3691;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, int, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_3692;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, int, var, var, empty> type_v_3693;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, int, var, std::vector<var>, empty> type_v_3694;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, int, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_3695;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, int, std::vector<var>, double, empty> type_v_3696;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, int, std::vector<var>, std::vector<double>, empty> type_v_3697;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, int, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_3698;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, int, std::vector<var>, var, empty> type_v_3699;
+
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3600> AgradDistributionNormalSufficient_v_3600;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3601> AgradDistributionNormalSufficient_v_3601;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3602> AgradDistributionNormalSufficient_v_3602;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3603> AgradDistributionNormalSufficient_v_3603;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3604> AgradDistributionNormalSufficient_v_3604;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3605> AgradDistributionNormalSufficient_v_3605;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3606> AgradDistributionNormalSufficient_v_3606;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3607> AgradDistributionNormalSufficient_v_3607;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3608> AgradDistributionNormalSufficient_v_3608;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3609> AgradDistributionNormalSufficient_v_3609;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3610> AgradDistributionNormalSufficient_v_3610;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3611> AgradDistributionNormalSufficient_v_3611;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3612> AgradDistributionNormalSufficient_v_3612;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3613> AgradDistributionNormalSufficient_v_3613;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3614> AgradDistributionNormalSufficient_v_3614;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3615> AgradDistributionNormalSufficient_v_3615;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3616> AgradDistributionNormalSufficient_v_3616;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3617> AgradDistributionNormalSufficient_v_3617;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3618> AgradDistributionNormalSufficient_v_3618;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3619> AgradDistributionNormalSufficient_v_3619;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3620> AgradDistributionNormalSufficient_v_3620;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3621> AgradDistributionNormalSufficient_v_3621;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3622> AgradDistributionNormalSufficient_v_3622;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3623> AgradDistributionNormalSufficient_v_3623;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3624> AgradDistributionNormalSufficient_v_3624;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3625> AgradDistributionNormalSufficient_v_3625;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3626> AgradDistributionNormalSufficient_v_3626;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3627> AgradDistributionNormalSufficient_v_3627;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3628> AgradDistributionNormalSufficient_v_3628;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3629> AgradDistributionNormalSufficient_v_3629;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3630> AgradDistributionNormalSufficient_v_3630;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3631> AgradDistributionNormalSufficient_v_3631;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3632> AgradDistributionNormalSufficient_v_3632;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3633> AgradDistributionNormalSufficient_v_3633;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3634> AgradDistributionNormalSufficient_v_3634;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3635> AgradDistributionNormalSufficient_v_3635;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3636> AgradDistributionNormalSufficient_v_3636;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3637> AgradDistributionNormalSufficient_v_3637;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3638> AgradDistributionNormalSufficient_v_3638;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3639> AgradDistributionNormalSufficient_v_3639;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3640> AgradDistributionNormalSufficient_v_3640;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3641> AgradDistributionNormalSufficient_v_3641;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3642> AgradDistributionNormalSufficient_v_3642;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3643> AgradDistributionNormalSufficient_v_3643;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3644> AgradDistributionNormalSufficient_v_3644;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3645> AgradDistributionNormalSufficient_v_3645;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3646> AgradDistributionNormalSufficient_v_3646;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3647> AgradDistributionNormalSufficient_v_3647;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3648> AgradDistributionNormalSufficient_v_3648;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3649> AgradDistributionNormalSufficient_v_3649;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3650> AgradDistributionNormalSufficient_v_3650;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3651> AgradDistributionNormalSufficient_v_3651;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3652> AgradDistributionNormalSufficient_v_3652;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3653> AgradDistributionNormalSufficient_v_3653;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3654> AgradDistributionNormalSufficient_v_3654;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3655> AgradDistributionNormalSufficient_v_3655;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3656> AgradDistributionNormalSufficient_v_3656;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3657> AgradDistributionNormalSufficient_v_3657;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3658> AgradDistributionNormalSufficient_v_3658;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3659> AgradDistributionNormalSufficient_v_3659;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3660> AgradDistributionNormalSufficient_v_3660;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3661> AgradDistributionNormalSufficient_v_3661;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3662> AgradDistributionNormalSufficient_v_3662;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3663> AgradDistributionNormalSufficient_v_3663;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3664> AgradDistributionNormalSufficient_v_3664;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3665> AgradDistributionNormalSufficient_v_3665;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3666> AgradDistributionNormalSufficient_v_3666;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3667> AgradDistributionNormalSufficient_v_3667;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3668> AgradDistributionNormalSufficient_v_3668;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3669> AgradDistributionNormalSufficient_v_3669;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3670> AgradDistributionNormalSufficient_v_3670;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3671> AgradDistributionNormalSufficient_v_3671;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3672> AgradDistributionNormalSufficient_v_3672;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3673> AgradDistributionNormalSufficient_v_3673;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3674> AgradDistributionNormalSufficient_v_3674;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3675> AgradDistributionNormalSufficient_v_3675;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3676> AgradDistributionNormalSufficient_v_3676;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3677> AgradDistributionNormalSufficient_v_3677;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3678> AgradDistributionNormalSufficient_v_3678;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3679> AgradDistributionNormalSufficient_v_3679;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3680> AgradDistributionNormalSufficient_v_3680;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3681> AgradDistributionNormalSufficient_v_3681;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3682> AgradDistributionNormalSufficient_v_3682;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3683> AgradDistributionNormalSufficient_v_3683;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3684> AgradDistributionNormalSufficient_v_3684;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3685> AgradDistributionNormalSufficient_v_3685;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3686> AgradDistributionNormalSufficient_v_3686;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3687> AgradDistributionNormalSufficient_v_3687;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3688> AgradDistributionNormalSufficient_v_3688;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3689> AgradDistributionNormalSufficient_v_3689;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3690> AgradDistributionNormalSufficient_v_3690;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3691> AgradDistributionNormalSufficient_v_3691;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3692> AgradDistributionNormalSufficient_v_3692;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3693> AgradDistributionNormalSufficient_v_3693;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3694> AgradDistributionNormalSufficient_v_3694;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3695> AgradDistributionNormalSufficient_v_3695;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3696> AgradDistributionNormalSufficient_v_3696;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3697> AgradDistributionNormalSufficient_v_3697;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3698> AgradDistributionNormalSufficient_v_3698;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3699> AgradDistributionNormalSufficient_v_3699;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3600, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3600);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3601, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3601);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3602, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3602);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3603, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3603);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3604, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3604);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3605, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3605);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3606, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3606);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3607, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3607);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3608, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3608);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3609, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3609);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3610, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3610);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3611, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3611);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3612, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3612);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3613, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3613);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3614, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3614);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3615, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3615);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3616, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3616);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3617, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3617);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3618, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3618);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3619, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3619);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3620, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3620);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3621, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3621);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3622, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3622);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3623, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3623);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3624, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3624);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3625, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3625);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3626, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3626);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3627, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3627);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3628, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3628);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3629, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3629);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3630, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3630);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3631, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3631);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3632, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3632);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3633, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3633);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3634, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3634);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3635, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3635);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3636, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3636);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3637, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3637);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3638, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3638);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3639, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3639);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3640, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3640);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3641, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3641);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3642, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3642);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3643, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3643);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3644, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3644);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3645, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3645);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3646, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3646);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3647, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3647);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3648, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3648);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3649, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3649);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3650, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3650);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3651, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3651);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3652, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3652);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3653, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3653);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3654, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3654);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3655, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3655);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3656, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3656);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3657, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3657);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3658, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3658);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3659, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3659);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3660, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3660);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3661, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3661);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3662, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3662);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3663, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3663);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3664, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3664);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3665, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3665);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3666, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3666);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3667, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3667);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3668, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3668);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3669, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3669);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3670, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3670);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3671, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3671);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3672, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3672);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3673, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3673);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3674, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3674);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3675, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3675);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3676, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3676);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3677, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3677);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3678, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3678);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3679, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3679);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3680, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3680);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3681, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3681);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3682, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3682);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3683, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3683);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3684, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3684);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3685, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3685);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3686, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3686);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3687, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3687);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3688, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3688);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3689, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3689);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3690, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3690);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3691, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3691);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3692, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3692);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3693, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3693);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3694, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3694);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3695, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3695);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3696, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3696);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3697, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3697);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3698, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3698);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3699, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3699);
+
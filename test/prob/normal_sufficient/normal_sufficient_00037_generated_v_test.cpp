@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/normal_sufficient/normal_sufficient_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, int, std::vector<var>, std::vector<var>, empty> type_v_3700;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, int, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_3701;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_3702;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_3703;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_3704;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_3705;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_3706;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_3707;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<int>, double, double, empty> type_v_3708;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<int>, double, std::vector<double>, empty> type_v_3709;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<int>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_3710;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<int>, double, var, empty> type_v_3711;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<int>, double, std::vector<var>, empty> type_v_3712;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<int>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_3713;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<int>, std::vector<double>, double, empty> type_v_3714;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<int>, std::vector<double>, std::vector<double>, empty> type_v_3715;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<int>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_3716;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<int>, std::vector<double>, var, empty> type_v_3717;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<int>, std::vector<double>, std::vector<var>, empty> type_v_3718;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<int>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_3719;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_3720;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_3721;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_3722;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_3723;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_3724;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_3725;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<int>, var, double, empty> type_v_3726;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<int>, var, std::vector<double>, empty> type_v_3727;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<int>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_3728;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<int>, var, var, empty> type_v_3729;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<int>, var, std::vector<var>, empty> type_v_3730;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<int>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_3731;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<int>, std::vector<var>, double, empty> type_v_3732;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<int>, std::vector<var>, std::vector<double>, empty> type_v_3733;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<int>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_3734;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<int>, std::vector<var>, var, empty> type_v_3735;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<int>, std::vector<var>, std::vector<var>, empty> type_v_3736;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<int>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_3737;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_3738;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_3739;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_3740;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_3741;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_3742;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_3743;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, double, empty> type_v_3744;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_v_3745;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_3746;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, var, empty> type_v_3747;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<var>, empty> type_v_3748;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_3749;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_v_3750;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_v_3751;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_3752;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, var, empty> type_v_3753;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty> type_v_3754;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_3755;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_3756;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_3757;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_3758;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_3759;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_3760;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_3761;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, double, empty> type_v_3762;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<double>, empty> type_v_3763;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_3764;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, var, empty> type_v_3765;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<var>, empty> type_v_3766;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_3767;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, double, empty> type_v_3768;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty> type_v_3769;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_3770;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, var, empty> type_v_3771;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty> type_v_3772;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_3773;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_3774;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_3775;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_3776;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_3777;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_3778;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_3779;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, int, double, double, empty> type_v_3780;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, int, double, std::vector<double>, empty> type_v_3781;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, int, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_3782;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, int, double, var, empty> type_v_3783;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, int, double, std::vector<var>, empty> type_v_3784;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, int, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_3785;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, int, std::vector<double>, double, empty> type_v_3786;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, int, std::vector<double>, std::vector<double>, empty> type_v_3787;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, int, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_3788;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, int, std::vector<double>, var, empty> type_v_3789;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, int, std::vector<double>, std::vector<var>, empty> type_v_3790;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, int, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_3791;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_3792;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_3793;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_3794;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_3795;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_3796;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, int, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_3797;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, int, var, double, empty> type_v_3798;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, int, var, std::vector<double>, empty> type_v_3799;
+
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3700> AgradDistributionNormalSufficient_v_3700;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3701> AgradDistributionNormalSufficient_v_3701;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3702> AgradDistributionNormalSufficient_v_3702;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3703> AgradDistributionNormalSufficient_v_3703;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3704> AgradDistributionNormalSufficient_v_3704;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3705> AgradDistributionNormalSufficient_v_3705;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3706> AgradDistributionNormalSufficient_v_3706;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3707> AgradDistributionNormalSufficient_v_3707;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3708> AgradDistributionNormalSufficient_v_3708;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3709> AgradDistributionNormalSufficient_v_3709;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3710> AgradDistributionNormalSufficient_v_3710;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3711> AgradDistributionNormalSufficient_v_3711;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3712> AgradDistributionNormalSufficient_v_3712;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3713> AgradDistributionNormalSufficient_v_3713;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3714> AgradDistributionNormalSufficient_v_3714;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3715> AgradDistributionNormalSufficient_v_3715;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3716> AgradDistributionNormalSufficient_v_3716;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3717> AgradDistributionNormalSufficient_v_3717;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3718> AgradDistributionNormalSufficient_v_3718;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3719> AgradDistributionNormalSufficient_v_3719;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3720> AgradDistributionNormalSufficient_v_3720;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3721> AgradDistributionNormalSufficient_v_3721;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3722> AgradDistributionNormalSufficient_v_3722;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3723> AgradDistributionNormalSufficient_v_3723;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3724> AgradDistributionNormalSufficient_v_3724;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3725> AgradDistributionNormalSufficient_v_3725;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3726> AgradDistributionNormalSufficient_v_3726;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3727> AgradDistributionNormalSufficient_v_3727;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3728> AgradDistributionNormalSufficient_v_3728;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3729> AgradDistributionNormalSufficient_v_3729;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3730> AgradDistributionNormalSufficient_v_3730;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3731> AgradDistributionNormalSufficient_v_3731;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3732> AgradDistributionNormalSufficient_v_3732;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3733> AgradDistributionNormalSufficient_v_3733;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3734> AgradDistributionNormalSufficient_v_3734;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3735> AgradDistributionNormalSufficient_v_3735;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3736> AgradDistributionNormalSufficient_v_3736;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3737> AgradDistributionNormalSufficient_v_3737;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3738> AgradDistributionNormalSufficient_v_3738;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3739> AgradDistributionNormalSufficient_v_3739;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3740> AgradDistributionNormalSufficient_v_3740;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3741> AgradDistributionNormalSufficient_v_3741;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3742> AgradDistributionNormalSufficient_v_3742;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3743> AgradDistributionNormalSufficient_v_3743;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3744> AgradDistributionNormalSufficient_v_3744;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3745> AgradDistributionNormalSufficient_v_3745;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3746> AgradDistributionNormalSufficient_v_3746;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3747> AgradDistributionNormalSufficient_v_3747;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3748> AgradDistributionNormalSufficient_v_3748;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3749> AgradDistributionNormalSufficient_v_3749;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3750> AgradDistributionNormalSufficient_v_3750;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3751> AgradDistributionNormalSufficient_v_3751;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3752> AgradDistributionNormalSufficient_v_3752;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3753> AgradDistributionNormalSufficient_v_3753;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3754> AgradDistributionNormalSufficient_v_3754;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3755> AgradDistributionNormalSufficient_v_3755;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3756> AgradDistributionNormalSufficient_v_3756;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3757> AgradDistributionNormalSufficient_v_3757;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3758> AgradDistributionNormalSufficient_v_3758;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3759> AgradDistributionNormalSufficient_v_3759;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3760> AgradDistributionNormalSufficient_v_3760;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3761> AgradDistributionNormalSufficient_v_3761;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3762> AgradDistributionNormalSufficient_v_3762;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3763> AgradDistributionNormalSufficient_v_3763;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3764> AgradDistributionNormalSufficient_v_3764;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3765> AgradDistributionNormalSufficient_v_3765;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3766> AgradDistributionNormalSufficient_v_3766;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3767> AgradDistributionNormalSufficient_v_3767;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3768> AgradDistributionNormalSufficient_v_3768;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3769> AgradDistributionNormalSufficient_v_3769;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3770> AgradDistributionNormalSufficient_v_3770;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3771> AgradDistributionNormalSufficient_v_3771;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3772> AgradDistributionNormalSufficient_v_3772;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3773> AgradDistributionNormalSufficient_v_3773;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3774> AgradDistributionNormalSufficient_v_3774;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3775> AgradDistributionNormalSufficient_v_3775;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3776> AgradDistributionNormalSufficient_v_3776;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3777> AgradDistributionNormalSufficient_v_3777;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3778> AgradDistributionNormalSufficient_v_3778;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3779> AgradDistributionNormalSufficient_v_3779;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3780> AgradDistributionNormalSufficient_v_3780;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3781> AgradDistributionNormalSufficient_v_3781;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3782> AgradDistributionNormalSufficient_v_3782;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3783> AgradDistributionNormalSufficient_v_3783;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3784> AgradDistributionNormalSufficient_v_3784;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3785> AgradDistributionNormalSufficient_v_3785;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3786> AgradDistributionNormalSufficient_v_3786;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3787> AgradDistributionNormalSufficient_v_3787;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3788> AgradDistributionNormalSufficient_v_3788;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3789> AgradDistributionNormalSufficient_v_3789;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3790> AgradDistributionNormalSufficient_v_3790;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3791> AgradDistributionNormalSufficient_v_3791;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3792> AgradDistributionNormalSufficient_v_3792;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3793> AgradDistributionNormalSufficient_v_3793;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3794> AgradDistributionNormalSufficient_v_3794;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3795> AgradDistributionNormalSufficient_v_3795;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3796> AgradDistributionNormalSufficient_v_3796;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3797> AgradDistributionNormalSufficient_v_3797;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3798> AgradDistributionNormalSufficient_v_3798;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3799> AgradDistributionNormalSufficient_v_3799;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3700, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3700);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3701, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3701);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3702, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3702);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3703, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3703);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3704, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3704);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3705, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3705);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3706, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3706);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3707, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3707);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3708, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3708);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3709, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3709);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3710, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3710);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3711, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3711);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3712, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3712);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3713, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3713);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3714, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3714);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3715, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3715);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3716, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3716);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3717, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3717);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3718, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3718);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3719, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3719);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3720, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3720);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3721, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3721);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3722, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3722);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3723, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3723);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3724, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3724);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3725, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3725);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3726, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3726);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3727, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3727);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3728, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3728);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3729, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3729);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3730, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3730);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3731, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3731);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3732, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3732);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3733, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3733);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3734, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3734);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3735, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3735);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3736, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3736);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3737, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3737);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3738, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3738);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3739, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3739);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3740, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3740);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3741, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3741);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3742, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3742);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3743, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3743);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3744, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3744);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3745, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3745);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3746, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3746);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3747, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3747);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3748, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3748);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3749, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3749);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3750, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3750);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3751, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3751);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3752, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3752);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3753, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3753);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3754, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3754);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3755, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3755);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3756, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3756);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3757, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3757);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3758, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3758);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3759, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3759);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3760, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3760);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3761, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3761);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3762, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3762);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3763, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3763);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3764, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3764);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3765, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3765);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3766, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3766);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3767, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3767);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3768, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3768);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3769, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3769);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3770, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3770);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3771, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3771);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3772, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3772);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3773, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3773);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3774, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3774);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3775, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3775);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3776, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3776);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3777, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3777);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3778, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3778);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3779, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3779);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3780, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3780);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3781, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3781);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3782, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3782);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3783, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3783);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3784, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3784);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3785, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3785);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3786, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3786);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3787, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3787);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3788, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3788);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3789, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3789);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3790, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3790);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3791, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3791);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3792, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3792);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3793, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3793);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3794, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3794);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3795, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3795);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3796, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3796);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3797, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3797);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3798, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3798);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3799, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3799);
+
@@ -0,0 +1,275 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/normal_sufficient/normal_sufficient_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, int, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_3800;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, int, var, var, empty> type_v_3801;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, int, var, std::vector<var>, empty> type_v_3802;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, int, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_3803;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, int, std::vector<var>, double, empty> type_v_3804;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, int, std::vector<var>, std::vector<double>, empty> type_v_3805;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, int, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_3806;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, int, std::vector<var>, var, empty> type_v_3807;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, int, std::vector<var>, std::vector<var>, empty> type_v_3808;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, int, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_3809;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_3810;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_3811;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_3812;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_3813;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_3814;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, int, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_3815;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<int>, double, double, empty> type_v_3816;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<int>, double, std::vector<double>, empty> type_v_3817;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<int>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_3818;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<int>, double, var, empty> type_v_3819;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<int>, double, std::vector<var>, empty> type_v_3820;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<int>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_3821;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, double, empty> type_v_3822;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, std::vector<double>, empty> type_v_3823;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_3824;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, var, empty> type_v_3825;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, std::vector<var>, empty> type_v_3826;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<int>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_3827;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_3828;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_3829;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_3830;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_3831;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_3832;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_3833;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<int>, var, double, empty> type_v_3834;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<int>, var, std::vector<double>, empty> type_v_3835;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<int>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_3836;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<int>, var, var, empty> type_v_3837;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<int>, var, std::vector<var>, empty> type_v_3838;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<int>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_3839;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<int>, std::vector<var>, double, empty> type_v_3840;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<int>, std::vector<var>, std::vector<double>, empty> type_v_3841;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<int>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_3842;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<int>, std::vector<var>, var, empty> type_v_3843;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<int>, std::vector<var>, std::vector<var>, empty> type_v_3844;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<int>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_3845;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_3846;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_3847;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_3848;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_3849;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_3850;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_3851;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, double, empty> type_v_3852;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<double>, empty> type_v_3853;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_3854;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, var, empty> type_v_3855;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, std::vector<var>, empty> type_v_3856;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_3857;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, double, empty> type_v_3858;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty> type_v_3859;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_3860;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, var, empty> type_v_3861;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty> type_v_3862;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_3863;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty> type_v_3864;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_3865;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_3866;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty> type_v_3867;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_3868;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_3869;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, double, empty> type_v_3870;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<double>, empty> type_v_3871;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_3872;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, var, empty> type_v_3873;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, std::vector<var>, empty> type_v_3874;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_3875;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, double, empty> type_v_3876;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty> type_v_3877;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_3878;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, var, empty> type_v_3879;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty> type_v_3880;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_3881;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty> type_v_3882;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty> type_v_3883;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty> type_v_3884;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty> type_v_3885;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty> type_v_3886;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty> type_v_3887;
+
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3800> AgradDistributionNormalSufficient_v_3800;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3801> AgradDistributionNormalSufficient_v_3801;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3802> AgradDistributionNormalSufficient_v_3802;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3803> AgradDistributionNormalSufficient_v_3803;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3804> AgradDistributionNormalSufficient_v_3804;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3805> AgradDistributionNormalSufficient_v_3805;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3806> AgradDistributionNormalSufficient_v_3806;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3807> AgradDistributionNormalSufficient_v_3807;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3808> AgradDistributionNormalSufficient_v_3808;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3809> AgradDistributionNormalSufficient_v_3809;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3810> AgradDistributionNormalSufficient_v_3810;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3811> AgradDistributionNormalSufficient_v_3811;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3812> AgradDistributionNormalSufficient_v_3812;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3813> AgradDistributionNormalSufficient_v_3813;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3814> AgradDistributionNormalSufficient_v_3814;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3815> AgradDistributionNormalSufficient_v_3815;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3816> AgradDistributionNormalSufficient_v_3816;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3817> AgradDistributionNormalSufficient_v_3817;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3818> AgradDistributionNormalSufficient_v_3818;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3819> AgradDistributionNormalSufficient_v_3819;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3820> AgradDistributionNormalSufficient_v_3820;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3821> AgradDistributionNormalSufficient_v_3821;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3822> AgradDistributionNormalSufficient_v_3822;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3823> AgradDistributionNormalSufficient_v_3823;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3824> AgradDistributionNormalSufficient_v_3824;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3825> AgradDistributionNormalSufficient_v_3825;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3826> AgradDistributionNormalSufficient_v_3826;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3827> AgradDistributionNormalSufficient_v_3827;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3828> AgradDistributionNormalSufficient_v_3828;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3829> AgradDistributionNormalSufficient_v_3829;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3830> AgradDistributionNormalSufficient_v_3830;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3831> AgradDistributionNormalSufficient_v_3831;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3832> AgradDistributionNormalSufficient_v_3832;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3833> AgradDistributionNormalSufficient_v_3833;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3834> AgradDistributionNormalSufficient_v_3834;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3835> AgradDistributionNormalSufficient_v_3835;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3836> AgradDistributionNormalSufficient_v_3836;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3837> AgradDistributionNormalSufficient_v_3837;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3838> AgradDistributionNormalSufficient_v_3838;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3839> AgradDistributionNormalSufficient_v_3839;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3840> AgradDistributionNormalSufficient_v_3840;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3841> AgradDistributionNormalSufficient_v_3841;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3842> AgradDistributionNormalSufficient_v_3842;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3843> AgradDistributionNormalSufficient_v_3843;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3844> AgradDistributionNormalSufficient_v_3844;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3845> AgradDistributionNormalSufficient_v_3845;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3846> AgradDistributionNormalSufficient_v_3846;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3847> AgradDistributionNormalSufficient_v_3847;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3848> AgradDistributionNormalSufficient_v_3848;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3849> AgradDistributionNormalSufficient_v_3849;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3850> AgradDistributionNormalSufficient_v_3850;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3851> AgradDistributionNormalSufficient_v_3851;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3852> AgradDistributionNormalSufficient_v_3852;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3853> AgradDistributionNormalSufficient_v_3853;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3854> AgradDistributionNormalSufficient_v_3854;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3855> AgradDistributionNormalSufficient_v_3855;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3856> AgradDistributionNormalSufficient_v_3856;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3857> AgradDistributionNormalSufficient_v_3857;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3858> AgradDistributionNormalSufficient_v_3858;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3859> AgradDistributionNormalSufficient_v_3859;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3860> AgradDistributionNormalSufficient_v_3860;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3861> AgradDistributionNormalSufficient_v_3861;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3862> AgradDistributionNormalSufficient_v_3862;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3863> AgradDistributionNormalSufficient_v_3863;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3864> AgradDistributionNormalSufficient_v_3864;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3865> AgradDistributionNormalSufficient_v_3865;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3866> AgradDistributionNormalSufficient_v_3866;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3867> AgradDistributionNormalSufficient_v_3867;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3868> AgradDistributionNormalSufficient_v_3868;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3869> AgradDistributionNormalSufficient_v_3869;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3870> AgradDistributionNormalSufficient_v_3870;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3871> AgradDistributionNormalSufficient_v_3871;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3872> AgradDistributionNormalSufficient_v_3872;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3873> AgradDistributionNormalSufficient_v_3873;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3874> AgradDistributionNormalSufficient_v_3874;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3875> AgradDistributionNormalSufficient_v_3875;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3876> AgradDistributionNormalSufficient_v_3876;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3877> AgradDistributionNormalSufficient_v_3877;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3878> AgradDistributionNormalSufficient_v_3878;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3879> AgradDistributionNormalSufficient_v_3879;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3880> AgradDistributionNormalSufficient_v_3880;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3881> AgradDistributionNormalSufficient_v_3881;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3882> AgradDistributionNormalSufficient_v_3882;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3883> AgradDistributionNormalSufficient_v_3883;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3884> AgradDistributionNormalSufficient_v_3884;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3885> AgradDistributionNormalSufficient_v_3885;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3886> AgradDistributionNormalSufficient_v_3886;
+typedef std::tuple<AgradDistributionNormalSufficient, type_v_3887> AgradDistributionNormalSufficient_v_3887;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3800, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3800);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3801, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3801);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3802, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3802);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3803, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3803);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3804, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3804);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3805, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3805);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3806, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3806);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3807, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3807);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3808, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3808);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3809, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3809);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3810, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3810);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3811, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3811);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3812, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3812);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3813, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3813);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3814, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3814);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3815, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3815);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3816, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3816);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3817, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3817);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3818, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3818);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3819, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3819);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3820, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3820);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3821, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3821);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3822, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3822);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3823, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3823);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3824, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3824);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3825, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3825);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3826, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3826);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3827, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3827);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3828, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3828);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3829, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3829);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3830, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3830);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3831, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3831);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3832, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3832);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3833, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3833);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3834, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3834);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3835, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3835);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3836, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3836);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3837, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3837);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3838, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3838);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3839, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3839);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3840, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3840);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3841, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3841);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3842, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3842);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3843, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3843);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3844, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3844);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3845, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3845);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3846, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3846);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3847, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3847);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3848, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3848);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3849, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3849);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3850, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3850);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3851, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3851);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3852, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3852);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3853, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3853);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3854, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3854);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3855, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3855);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3856, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3856);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3857, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3857);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3858, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3858);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3859, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3859);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3860, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3860);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3861, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3861);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3862, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3862);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3863, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3863);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3864, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3864);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3865, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3865);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3866, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3866);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3867, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3867);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3868, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3868);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3869, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3869);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3870, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3870);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3871, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3871);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3872, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3872);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3873, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3873);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3874, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3874);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3875, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3875);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3876, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3876);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3877, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3877);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3878, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3878);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3879, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3879);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3880, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3880);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3881, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3881);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3882, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3882);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3883, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3883);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3884, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3884);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3885, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3885);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3886, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3886);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionNormalSufficient_v_3887, AgradDistributionTestFixture, AgradDistributionNormalSufficient_v_3887);
+
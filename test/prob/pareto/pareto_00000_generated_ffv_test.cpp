@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto/pareto_test.hpp>
+
+typedef std::tuple<double, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_0;
+typedef std::tuple<double, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_1;
+typedef std::tuple<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_2;
+typedef std::tuple<double, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_3;
+typedef std::tuple<double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_4;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_5;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_6;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_7;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_8;
+typedef std::tuple<double, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_9;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_10;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_11;
+typedef std::tuple<double, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_12;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_13;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_14;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_15;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_16;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_17;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_18;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_19;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_20;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_21;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_22;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_23;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_24;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_25;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_26;
+typedef std::tuple<std::vector<double>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_27;
+typedef std::tuple<std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_28;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_29;
+typedef std::tuple<std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_30;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_31;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_32;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_33;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_34;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_35;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_36;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_37;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_38;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_39;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_40;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_41;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_42;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_43;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_44;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_45;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_46;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_47;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_48;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_49;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_50;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_51;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_52;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_53;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_54;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_55;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_56;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_57;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_58;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_59;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_60;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_61;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_62;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_63;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_64;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_65;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_66;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_67;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_68;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_69;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_70;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_80;
+typedef std::tuple<fvar<fvar<var> >, double, double, empty, empty, empty> type_ffv_81;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<double>, empty, empty, empty> type_ffv_82;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_83;
+typedef std::tuple<fvar<fvar<var> >, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_84;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_85;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_86;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, double, empty, empty, empty> type_ffv_87;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_88;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_89;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_90;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_91;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_92;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_93;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_94;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_95;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_96;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_97;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_98;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_99;
+
+typedef std::tuple<AgradDistributionsPareto, type_ffv_0> AgradDistributionsPareto_ffv_0;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_1> AgradDistributionsPareto_ffv_1;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_2> AgradDistributionsPareto_ffv_2;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_3> AgradDistributionsPareto_ffv_3;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_4> AgradDistributionsPareto_ffv_4;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_5> AgradDistributionsPareto_ffv_5;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_6> AgradDistributionsPareto_ffv_6;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_7> AgradDistributionsPareto_ffv_7;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_8> AgradDistributionsPareto_ffv_8;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_9> AgradDistributionsPareto_ffv_9;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_10> AgradDistributionsPareto_ffv_10;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_11> AgradDistributionsPareto_ffv_11;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_12> AgradDistributionsPareto_ffv_12;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_13> AgradDistributionsPareto_ffv_13;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_14> AgradDistributionsPareto_ffv_14;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_15> AgradDistributionsPareto_ffv_15;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_16> AgradDistributionsPareto_ffv_16;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_17> AgradDistributionsPareto_ffv_17;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_18> AgradDistributionsPareto_ffv_18;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_19> AgradDistributionsPareto_ffv_19;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_20> AgradDistributionsPareto_ffv_20;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_21> AgradDistributionsPareto_ffv_21;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_22> AgradDistributionsPareto_ffv_22;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_23> AgradDistributionsPareto_ffv_23;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_24> AgradDistributionsPareto_ffv_24;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_25> AgradDistributionsPareto_ffv_25;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_26> AgradDistributionsPareto_ffv_26;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_27> AgradDistributionsPareto_ffv_27;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_28> AgradDistributionsPareto_ffv_28;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_29> AgradDistributionsPareto_ffv_29;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_30> AgradDistributionsPareto_ffv_30;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_31> AgradDistributionsPareto_ffv_31;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_32> AgradDistributionsPareto_ffv_32;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_33> AgradDistributionsPareto_ffv_33;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_34> AgradDistributionsPareto_ffv_34;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_35> AgradDistributionsPareto_ffv_35;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_36> AgradDistributionsPareto_ffv_36;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_37> AgradDistributionsPareto_ffv_37;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_38> AgradDistributionsPareto_ffv_38;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_39> AgradDistributionsPareto_ffv_39;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_40> AgradDistributionsPareto_ffv_40;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_41> AgradDistributionsPareto_ffv_41;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_42> AgradDistributionsPareto_ffv_42;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_43> AgradDistributionsPareto_ffv_43;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_44> AgradDistributionsPareto_ffv_44;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_45> AgradDistributionsPareto_ffv_45;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_46> AgradDistributionsPareto_ffv_46;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_47> AgradDistributionsPareto_ffv_47;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_48> AgradDistributionsPareto_ffv_48;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_49> AgradDistributionsPareto_ffv_49;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_50> AgradDistributionsPareto_ffv_50;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_51> AgradDistributionsPareto_ffv_51;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_52> AgradDistributionsPareto_ffv_52;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_53> AgradDistributionsPareto_ffv_53;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_54> AgradDistributionsPareto_ffv_54;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_55> AgradDistributionsPareto_ffv_55;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_56> AgradDistributionsPareto_ffv_56;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_57> AgradDistributionsPareto_ffv_57;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_58> AgradDistributionsPareto_ffv_58;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_59> AgradDistributionsPareto_ffv_59;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_60> AgradDistributionsPareto_ffv_60;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_61> AgradDistributionsPareto_ffv_61;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_62> AgradDistributionsPareto_ffv_62;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_63> AgradDistributionsPareto_ffv_63;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_64> AgradDistributionsPareto_ffv_64;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_65> AgradDistributionsPareto_ffv_65;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_66> AgradDistributionsPareto_ffv_66;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_67> AgradDistributionsPareto_ffv_67;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_68> AgradDistributionsPareto_ffv_68;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_69> AgradDistributionsPareto_ffv_69;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_70> AgradDistributionsPareto_ffv_70;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_71> AgradDistributionsPareto_ffv_71;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_72> AgradDistributionsPareto_ffv_72;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_73> AgradDistributionsPareto_ffv_73;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_74> AgradDistributionsPareto_ffv_74;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_75> AgradDistributionsPareto_ffv_75;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_76> AgradDistributionsPareto_ffv_76;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_77> AgradDistributionsPareto_ffv_77;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_78> AgradDistributionsPareto_ffv_78;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_79> AgradDistributionsPareto_ffv_79;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_80> AgradDistributionsPareto_ffv_80;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_81> AgradDistributionsPareto_ffv_81;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_82> AgradDistributionsPareto_ffv_82;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_83> AgradDistributionsPareto_ffv_83;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_84> AgradDistributionsPareto_ffv_84;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_85> AgradDistributionsPareto_ffv_85;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_86> AgradDistributionsPareto_ffv_86;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_87> AgradDistributionsPareto_ffv_87;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_88> AgradDistributionsPareto_ffv_88;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_89> AgradDistributionsPareto_ffv_89;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_90> AgradDistributionsPareto_ffv_90;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_91> AgradDistributionsPareto_ffv_91;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_92> AgradDistributionsPareto_ffv_92;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_93> AgradDistributionsPareto_ffv_93;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_94> AgradDistributionsPareto_ffv_94;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_95> AgradDistributionsPareto_ffv_95;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_96> AgradDistributionsPareto_ffv_96;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_97> AgradDistributionsPareto_ffv_97;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_98> AgradDistributionsPareto_ffv_98;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_99> AgradDistributionsPareto_ffv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_0, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_1, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_2, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_3, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_4, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_5, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_6, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_7, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_8, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_9, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_10, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_11, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_12, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_13, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_14, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_15, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_16, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_17, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_18, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_19, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_20, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_21, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_22, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_23, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_24, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_25, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_26, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_27, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_28, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_29, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_30, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_31, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_32, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_33, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_34, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_35, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_36, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_37, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_38, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_39, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_40, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_41, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_42, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_43, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_44, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_45, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_46, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_47, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_48, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_49, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_50, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_51, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_52, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_53, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_54, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_55, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_56, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_57, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_58, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_59, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_60, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_61, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_62, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_63, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_64, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_65, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_66, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_67, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_68, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_69, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_70, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_71, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_72, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_73, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_74, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_75, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_76, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_77, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_78, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_79, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_80, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_81, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_82, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_83, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_84, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_85, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_86, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_87, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_88, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_89, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_90, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_91, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_92, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_93, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_94, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_95, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_96, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_97, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_98, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_99, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_99);
+
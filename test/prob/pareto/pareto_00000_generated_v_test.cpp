@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto/pareto_test.hpp>
+
+typedef std::tuple<double, double, double, empty, empty, empty> type_v_0;
+typedef std::tuple<double, double, std::vector<double>, empty, empty, empty> type_v_1;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_2;
+typedef std::tuple<double, double, var, empty, empty, empty> type_v_3;
+typedef std::tuple<double, double, std::vector<var>, empty, empty, empty> type_v_4;
+typedef std::tuple<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_5;
+typedef std::tuple<double, std::vector<double>, double, empty, empty, empty> type_v_6;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_7;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_8;
+typedef std::tuple<double, std::vector<double>, var, empty, empty, empty> type_v_9;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_10;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_11;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_12;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_13;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_14;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_15;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_16;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_17;
+typedef std::tuple<double, var, double, empty, empty, empty> type_v_18;
+typedef std::tuple<double, var, std::vector<double>, empty, empty, empty> type_v_19;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_20;
+typedef std::tuple<double, var, var, empty, empty, empty> type_v_21;
+typedef std::tuple<double, var, std::vector<var>, empty, empty, empty> type_v_22;
+typedef std::tuple<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_23;
+typedef std::tuple<double, std::vector<var>, double, empty, empty, empty> type_v_24;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_25;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_26;
+typedef std::tuple<double, std::vector<var>, var, empty, empty, empty> type_v_27;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_28;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_29;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_30;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_31;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_32;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_33;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_34;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_35;
+typedef std::tuple<std::vector<double>, double, double, empty, empty, empty> type_v_36;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, empty, empty, empty> type_v_37;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_38;
+typedef std::tuple<std::vector<double>, double, var, empty, empty, empty> type_v_39;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, empty, empty, empty> type_v_40;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_41;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, empty, empty, empty> type_v_42;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_43;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_44;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, empty, empty, empty> type_v_45;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_46;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_47;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_48;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_49;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_50;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_51;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_52;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_53;
+typedef std::tuple<std::vector<double>, var, double, empty, empty, empty> type_v_54;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, empty, empty, empty> type_v_55;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_56;
+typedef std::tuple<std::vector<double>, var, var, empty, empty, empty> type_v_57;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, empty, empty, empty> type_v_58;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_59;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, empty, empty, empty> type_v_60;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_61;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_62;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, empty, empty, empty> type_v_63;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_64;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_65;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_66;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_67;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_68;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_69;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_70;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_v_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_v_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_v_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_v_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_v_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_80;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_v_81;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_82;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_83;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_84;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_85;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_86;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_87;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_88;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_89;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_v_90;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_v_91;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_92;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_v_93;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_v_94;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_95;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_v_96;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_97;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_98;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_v_99;
+
+typedef std::tuple<AgradDistributionsPareto, type_v_0> AgradDistributionsPareto_v_0;
+typedef std::tuple<AgradDistributionsPareto, type_v_1> AgradDistributionsPareto_v_1;
+typedef std::tuple<AgradDistributionsPareto, type_v_2> AgradDistributionsPareto_v_2;
+typedef std::tuple<AgradDistributionsPareto, type_v_3> AgradDistributionsPareto_v_3;
+typedef std::tuple<AgradDistributionsPareto, type_v_4> AgradDistributionsPareto_v_4;
+typedef std::tuple<AgradDistributionsPareto, type_v_5> AgradDistributionsPareto_v_5;
+typedef std::tuple<AgradDistributionsPareto, type_v_6> AgradDistributionsPareto_v_6;
+typedef std::tuple<AgradDistributionsPareto, type_v_7> AgradDistributionsPareto_v_7;
+typedef std::tuple<AgradDistributionsPareto, type_v_8> AgradDistributionsPareto_v_8;
+typedef std::tuple<AgradDistributionsPareto, type_v_9> AgradDistributionsPareto_v_9;
+typedef std::tuple<AgradDistributionsPareto, type_v_10> AgradDistributionsPareto_v_10;
+typedef std::tuple<AgradDistributionsPareto, type_v_11> AgradDistributionsPareto_v_11;
+typedef std::tuple<AgradDistributionsPareto, type_v_12> AgradDistributionsPareto_v_12;
+typedef std::tuple<AgradDistributionsPareto, type_v_13> AgradDistributionsPareto_v_13;
+typedef std::tuple<AgradDistributionsPareto, type_v_14> AgradDistributionsPareto_v_14;
+typedef std::tuple<AgradDistributionsPareto, type_v_15> AgradDistributionsPareto_v_15;
+typedef std::tuple<AgradDistributionsPareto, type_v_16> AgradDistributionsPareto_v_16;
+typedef std::tuple<AgradDistributionsPareto, type_v_17> AgradDistributionsPareto_v_17;
+typedef std::tuple<AgradDistributionsPareto, type_v_18> AgradDistributionsPareto_v_18;
+typedef std::tuple<AgradDistributionsPareto, type_v_19> AgradDistributionsPareto_v_19;
+typedef std::tuple<AgradDistributionsPareto, type_v_20> AgradDistributionsPareto_v_20;
+typedef std::tuple<AgradDistributionsPareto, type_v_21> AgradDistributionsPareto_v_21;
+typedef std::tuple<AgradDistributionsPareto, type_v_22> AgradDistributionsPareto_v_22;
+typedef std::tuple<AgradDistributionsPareto, type_v_23> AgradDistributionsPareto_v_23;
+typedef std::tuple<AgradDistributionsPareto, type_v_24> AgradDistributionsPareto_v_24;
+typedef std::tuple<AgradDistributionsPareto, type_v_25> AgradDistributionsPareto_v_25;
+typedef std::tuple<AgradDistributionsPareto, type_v_26> AgradDistributionsPareto_v_26;
+typedef std::tuple<AgradDistributionsPareto, type_v_27> AgradDistributionsPareto_v_27;
+typedef std::tuple<AgradDistributionsPareto, type_v_28> AgradDistributionsPareto_v_28;
+typedef std::tuple<AgradDistributionsPareto, type_v_29> AgradDistributionsPareto_v_29;
+typedef std::tuple<AgradDistributionsPareto, type_v_30> AgradDistributionsPareto_v_30;
+typedef std::tuple<AgradDistributionsPareto, type_v_31> AgradDistributionsPareto_v_31;
+typedef std::tuple<AgradDistributionsPareto, type_v_32> AgradDistributionsPareto_v_32;
+typedef std::tuple<AgradDistributionsPareto, type_v_33> AgradDistributionsPareto_v_33;
+typedef std::tuple<AgradDistributionsPareto, type_v_34> AgradDistributionsPareto_v_34;
+typedef std::tuple<AgradDistributionsPareto, type_v_35> AgradDistributionsPareto_v_35;
+typedef std::tuple<AgradDistributionsPareto, type_v_36> AgradDistributionsPareto_v_36;
+typedef std::tuple<AgradDistributionsPareto, type_v_37> AgradDistributionsPareto_v_37;
+typedef std::tuple<AgradDistributionsPareto, type_v_38> AgradDistributionsPareto_v_38;
+typedef std::tuple<AgradDistributionsPareto, type_v_39> AgradDistributionsPareto_v_39;
+typedef std::tuple<AgradDistributionsPareto, type_v_40> AgradDistributionsPareto_v_40;
+typedef std::tuple<AgradDistributionsPareto, type_v_41> AgradDistributionsPareto_v_41;
+typedef std::tuple<AgradDistributionsPareto, type_v_42> AgradDistributionsPareto_v_42;
+typedef std::tuple<AgradDistributionsPareto, type_v_43> AgradDistributionsPareto_v_43;
+typedef std::tuple<AgradDistributionsPareto, type_v_44> AgradDistributionsPareto_v_44;
+typedef std::tuple<AgradDistributionsPareto, type_v_45> AgradDistributionsPareto_v_45;
+typedef std::tuple<AgradDistributionsPareto, type_v_46> AgradDistributionsPareto_v_46;
+typedef std::tuple<AgradDistributionsPareto, type_v_47> AgradDistributionsPareto_v_47;
+typedef std::tuple<AgradDistributionsPareto, type_v_48> AgradDistributionsPareto_v_48;
+typedef std::tuple<AgradDistributionsPareto, type_v_49> AgradDistributionsPareto_v_49;
+typedef std::tuple<AgradDistributionsPareto, type_v_50> AgradDistributionsPareto_v_50;
+typedef std::tuple<AgradDistributionsPareto, type_v_51> AgradDistributionsPareto_v_51;
+typedef std::tuple<AgradDistributionsPareto, type_v_52> AgradDistributionsPareto_v_52;
+typedef std::tuple<AgradDistributionsPareto, type_v_53> AgradDistributionsPareto_v_53;
+typedef std::tuple<AgradDistributionsPareto, type_v_54> AgradDistributionsPareto_v_54;
+typedef std::tuple<AgradDistributionsPareto, type_v_55> AgradDistributionsPareto_v_55;
+typedef std::tuple<AgradDistributionsPareto, type_v_56> AgradDistributionsPareto_v_56;
+typedef std::tuple<AgradDistributionsPareto, type_v_57> AgradDistributionsPareto_v_57;
+typedef std::tuple<AgradDistributionsPareto, type_v_58> AgradDistributionsPareto_v_58;
+typedef std::tuple<AgradDistributionsPareto, type_v_59> AgradDistributionsPareto_v_59;
+typedef std::tuple<AgradDistributionsPareto, type_v_60> AgradDistributionsPareto_v_60;
+typedef std::tuple<AgradDistributionsPareto, type_v_61> AgradDistributionsPareto_v_61;
+typedef std::tuple<AgradDistributionsPareto, type_v_62> AgradDistributionsPareto_v_62;
+typedef std::tuple<AgradDistributionsPareto, type_v_63> AgradDistributionsPareto_v_63;
+typedef std::tuple<AgradDistributionsPareto, type_v_64> AgradDistributionsPareto_v_64;
+typedef std::tuple<AgradDistributionsPareto, type_v_65> AgradDistributionsPareto_v_65;
+typedef std::tuple<AgradDistributionsPareto, type_v_66> AgradDistributionsPareto_v_66;
+typedef std::tuple<AgradDistributionsPareto, type_v_67> AgradDistributionsPareto_v_67;
+typedef std::tuple<AgradDistributionsPareto, type_v_68> AgradDistributionsPareto_v_68;
+typedef std::tuple<AgradDistributionsPareto, type_v_69> AgradDistributionsPareto_v_69;
+typedef std::tuple<AgradDistributionsPareto, type_v_70> AgradDistributionsPareto_v_70;
+typedef std::tuple<AgradDistributionsPareto, type_v_71> AgradDistributionsPareto_v_71;
+typedef std::tuple<AgradDistributionsPareto, type_v_72> AgradDistributionsPareto_v_72;
+typedef std::tuple<AgradDistributionsPareto, type_v_73> AgradDistributionsPareto_v_73;
+typedef std::tuple<AgradDistributionsPareto, type_v_74> AgradDistributionsPareto_v_74;
+typedef std::tuple<AgradDistributionsPareto, type_v_75> AgradDistributionsPareto_v_75;
+typedef std::tuple<AgradDistributionsPareto, type_v_76> AgradDistributionsPareto_v_76;
+typedef std::tuple<AgradDistributionsPareto, type_v_77> AgradDistributionsPareto_v_77;
+typedef std::tuple<AgradDistributionsPareto, type_v_78> AgradDistributionsPareto_v_78;
+typedef std::tuple<AgradDistributionsPareto, type_v_79> AgradDistributionsPareto_v_79;
+typedef std::tuple<AgradDistributionsPareto, type_v_80> AgradDistributionsPareto_v_80;
+typedef std::tuple<AgradDistributionsPareto, type_v_81> AgradDistributionsPareto_v_81;
+typedef std::tuple<AgradDistributionsPareto, type_v_82> AgradDistributionsPareto_v_82;
+typedef std::tuple<AgradDistributionsPareto, type_v_83> AgradDistributionsPareto_v_83;
+typedef std::tuple<AgradDistributionsPareto, type_v_84> AgradDistributionsPareto_v_84;
+typedef std::tuple<AgradDistributionsPareto, type_v_85> AgradDistributionsPareto_v_85;
+typedef std::tuple<AgradDistributionsPareto, type_v_86> AgradDistributionsPareto_v_86;
+typedef std::tuple<AgradDistributionsPareto, type_v_87> AgradDistributionsPareto_v_87;
+typedef std::tuple<AgradDistributionsPareto, type_v_88> AgradDistributionsPareto_v_88;
+typedef std::tuple<AgradDistributionsPareto, type_v_89> AgradDistributionsPareto_v_89;
+typedef std::tuple<AgradDistributionsPareto, type_v_90> AgradDistributionsPareto_v_90;
+typedef std::tuple<AgradDistributionsPareto, type_v_91> AgradDistributionsPareto_v_91;
+typedef std::tuple<AgradDistributionsPareto, type_v_92> AgradDistributionsPareto_v_92;
+typedef std::tuple<AgradDistributionsPareto, type_v_93> AgradDistributionsPareto_v_93;
+typedef std::tuple<AgradDistributionsPareto, type_v_94> AgradDistributionsPareto_v_94;
+typedef std::tuple<AgradDistributionsPareto, type_v_95> AgradDistributionsPareto_v_95;
+typedef std::tuple<AgradDistributionsPareto, type_v_96> AgradDistributionsPareto_v_96;
+typedef std::tuple<AgradDistributionsPareto, type_v_97> AgradDistributionsPareto_v_97;
+typedef std::tuple<AgradDistributionsPareto, type_v_98> AgradDistributionsPareto_v_98;
+typedef std::tuple<AgradDistributionsPareto, type_v_99> AgradDistributionsPareto_v_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_0, AgradDistributionTestFixture, AgradDistributionsPareto_v_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_1, AgradDistributionTestFixture, AgradDistributionsPareto_v_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_2, AgradDistributionTestFixture, AgradDistributionsPareto_v_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_3, AgradDistributionTestFixture, AgradDistributionsPareto_v_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_4, AgradDistributionTestFixture, AgradDistributionsPareto_v_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_5, AgradDistributionTestFixture, AgradDistributionsPareto_v_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_6, AgradDistributionTestFixture, AgradDistributionsPareto_v_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_7, AgradDistributionTestFixture, AgradDistributionsPareto_v_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_8, AgradDistributionTestFixture, AgradDistributionsPareto_v_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_9, AgradDistributionTestFixture, AgradDistributionsPareto_v_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_10, AgradDistributionTestFixture, AgradDistributionsPareto_v_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_11, AgradDistributionTestFixture, AgradDistributionsPareto_v_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_12, AgradDistributionTestFixture, AgradDistributionsPareto_v_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_13, AgradDistributionTestFixture, AgradDistributionsPareto_v_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_14, AgradDistributionTestFixture, AgradDistributionsPareto_v_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_15, AgradDistributionTestFixture, AgradDistributionsPareto_v_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_16, AgradDistributionTestFixture, AgradDistributionsPareto_v_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_17, AgradDistributionTestFixture, AgradDistributionsPareto_v_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_18, AgradDistributionTestFixture, AgradDistributionsPareto_v_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_19, AgradDistributionTestFixture, AgradDistributionsPareto_v_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_20, AgradDistributionTestFixture, AgradDistributionsPareto_v_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_21, AgradDistributionTestFixture, AgradDistributionsPareto_v_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_22, AgradDistributionTestFixture, AgradDistributionsPareto_v_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_23, AgradDistributionTestFixture, AgradDistributionsPareto_v_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_24, AgradDistributionTestFixture, AgradDistributionsPareto_v_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_25, AgradDistributionTestFixture, AgradDistributionsPareto_v_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_26, AgradDistributionTestFixture, AgradDistributionsPareto_v_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_27, AgradDistributionTestFixture, AgradDistributionsPareto_v_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_28, AgradDistributionTestFixture, AgradDistributionsPareto_v_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_29, AgradDistributionTestFixture, AgradDistributionsPareto_v_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_30, AgradDistributionTestFixture, AgradDistributionsPareto_v_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_31, AgradDistributionTestFixture, AgradDistributionsPareto_v_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_32, AgradDistributionTestFixture, AgradDistributionsPareto_v_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_33, AgradDistributionTestFixture, AgradDistributionsPareto_v_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_34, AgradDistributionTestFixture, AgradDistributionsPareto_v_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_35, AgradDistributionTestFixture, AgradDistributionsPareto_v_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_36, AgradDistributionTestFixture, AgradDistributionsPareto_v_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_37, AgradDistributionTestFixture, AgradDistributionsPareto_v_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_38, AgradDistributionTestFixture, AgradDistributionsPareto_v_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_39, AgradDistributionTestFixture, AgradDistributionsPareto_v_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_40, AgradDistributionTestFixture, AgradDistributionsPareto_v_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_41, AgradDistributionTestFixture, AgradDistributionsPareto_v_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_42, AgradDistributionTestFixture, AgradDistributionsPareto_v_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_43, AgradDistributionTestFixture, AgradDistributionsPareto_v_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_44, AgradDistributionTestFixture, AgradDistributionsPareto_v_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_45, AgradDistributionTestFixture, AgradDistributionsPareto_v_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_46, AgradDistributionTestFixture, AgradDistributionsPareto_v_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_47, AgradDistributionTestFixture, AgradDistributionsPareto_v_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_48, AgradDistributionTestFixture, AgradDistributionsPareto_v_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_49, AgradDistributionTestFixture, AgradDistributionsPareto_v_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_50, AgradDistributionTestFixture, AgradDistributionsPareto_v_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_51, AgradDistributionTestFixture, AgradDistributionsPareto_v_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_52, AgradDistributionTestFixture, AgradDistributionsPareto_v_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_53, AgradDistributionTestFixture, AgradDistributionsPareto_v_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_54, AgradDistributionTestFixture, AgradDistributionsPareto_v_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_55, AgradDistributionTestFixture, AgradDistributionsPareto_v_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_56, AgradDistributionTestFixture, AgradDistributionsPareto_v_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_57, AgradDistributionTestFixture, AgradDistributionsPareto_v_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_58, AgradDistributionTestFixture, AgradDistributionsPareto_v_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_59, AgradDistributionTestFixture, AgradDistributionsPareto_v_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_60, AgradDistributionTestFixture, AgradDistributionsPareto_v_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_61, AgradDistributionTestFixture, AgradDistributionsPareto_v_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_62, AgradDistributionTestFixture, AgradDistributionsPareto_v_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_63, AgradDistributionTestFixture, AgradDistributionsPareto_v_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_64, AgradDistributionTestFixture, AgradDistributionsPareto_v_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_65, AgradDistributionTestFixture, AgradDistributionsPareto_v_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_66, AgradDistributionTestFixture, AgradDistributionsPareto_v_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_67, AgradDistributionTestFixture, AgradDistributionsPareto_v_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_68, AgradDistributionTestFixture, AgradDistributionsPareto_v_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_69, AgradDistributionTestFixture, AgradDistributionsPareto_v_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_70, AgradDistributionTestFixture, AgradDistributionsPareto_v_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_71, AgradDistributionTestFixture, AgradDistributionsPareto_v_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_72, AgradDistributionTestFixture, AgradDistributionsPareto_v_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_73, AgradDistributionTestFixture, AgradDistributionsPareto_v_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_74, AgradDistributionTestFixture, AgradDistributionsPareto_v_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_75, AgradDistributionTestFixture, AgradDistributionsPareto_v_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_76, AgradDistributionTestFixture, AgradDistributionsPareto_v_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_77, AgradDistributionTestFixture, AgradDistributionsPareto_v_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_78, AgradDistributionTestFixture, AgradDistributionsPareto_v_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_79, AgradDistributionTestFixture, AgradDistributionsPareto_v_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_80, AgradDistributionTestFixture, AgradDistributionsPareto_v_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_81, AgradDistributionTestFixture, AgradDistributionsPareto_v_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_82, AgradDistributionTestFixture, AgradDistributionsPareto_v_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_83, AgradDistributionTestFixture, AgradDistributionsPareto_v_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_84, AgradDistributionTestFixture, AgradDistributionsPareto_v_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_85, AgradDistributionTestFixture, AgradDistributionsPareto_v_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_86, AgradDistributionTestFixture, AgradDistributionsPareto_v_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_87, AgradDistributionTestFixture, AgradDistributionsPareto_v_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_88, AgradDistributionTestFixture, AgradDistributionsPareto_v_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_89, AgradDistributionTestFixture, AgradDistributionsPareto_v_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_90, AgradDistributionTestFixture, AgradDistributionsPareto_v_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_91, AgradDistributionTestFixture, AgradDistributionsPareto_v_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_92, AgradDistributionTestFixture, AgradDistributionsPareto_v_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_93, AgradDistributionTestFixture, AgradDistributionsPareto_v_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_94, AgradDistributionTestFixture, AgradDistributionsPareto_v_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_95, AgradDistributionTestFixture, AgradDistributionsPareto_v_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_96, AgradDistributionTestFixture, AgradDistributionsPareto_v_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_97, AgradDistributionTestFixture, AgradDistributionsPareto_v_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_98, AgradDistributionTestFixture, AgradDistributionsPareto_v_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_99, AgradDistributionTestFixture, AgradDistributionsPareto_v_99);
+
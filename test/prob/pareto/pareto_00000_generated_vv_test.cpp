@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto/pareto_test.hpp>
+
+typedef std::tuple<double, double, var, empty, empty, empty> type_vv_0;
+typedef std::tuple<double, double, std::vector<var>, empty, empty, empty> type_vv_1;
+typedef std::tuple<double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_2;
+typedef std::tuple<double, std::vector<double>, var, empty, empty, empty> type_vv_3;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_4;
+typedef std::tuple<double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_5;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_6;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_7;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_8;
+typedef std::tuple<double, var, double, empty, empty, empty> type_vv_9;
+typedef std::tuple<double, var, std::vector<double>, empty, empty, empty> type_vv_10;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_11;
+typedef std::tuple<double, var, var, empty, empty, empty> type_vv_12;
+typedef std::tuple<double, var, std::vector<var>, empty, empty, empty> type_vv_13;
+typedef std::tuple<double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_14;
+typedef std::tuple<double, std::vector<var>, double, empty, empty, empty> type_vv_15;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_16;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_17;
+typedef std::tuple<double, std::vector<var>, var, empty, empty, empty> type_vv_18;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_19;
+typedef std::tuple<double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_20;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_21;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_22;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_23;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_24;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_25;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_26;
+typedef std::tuple<std::vector<double>, double, var, empty, empty, empty> type_vv_27;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, empty, empty, empty> type_vv_28;
+typedef std::tuple<std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_29;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, empty, empty, empty> type_vv_30;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_31;
+typedef std::tuple<std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_32;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_33;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_34;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_35;
+typedef std::tuple<std::vector<double>, var, double, empty, empty, empty> type_vv_36;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, empty, empty, empty> type_vv_37;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_38;
+typedef std::tuple<std::vector<double>, var, var, empty, empty, empty> type_vv_39;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, empty, empty, empty> type_vv_40;
+typedef std::tuple<std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_41;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, empty, empty, empty> type_vv_42;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_43;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_44;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, empty, empty, empty> type_vv_45;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_46;
+typedef std::tuple<std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_47;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_48;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_49;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_50;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_51;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_52;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_53;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_vv_54;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_vv_55;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_56;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_vv_57;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_58;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_59;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_60;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_61;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_62;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_vv_63;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_vv_64;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_65;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_vv_66;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_vv_67;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_68;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_vv_69;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_70;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_vv_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_80;
+typedef std::tuple<var, double, double, empty, empty, empty> type_vv_81;
+typedef std::tuple<var, double, std::vector<double>, empty, empty, empty> type_vv_82;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_83;
+typedef std::tuple<var, double, var, empty, empty, empty> type_vv_84;
+typedef std::tuple<var, double, std::vector<var>, empty, empty, empty> type_vv_85;
+typedef std::tuple<var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_86;
+typedef std::tuple<var, std::vector<double>, double, empty, empty, empty> type_vv_87;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_88;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_89;
+typedef std::tuple<var, std::vector<double>, var, empty, empty, empty> type_vv_90;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_91;
+typedef std::tuple<var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_92;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_93;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_94;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_95;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_96;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_97;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_98;
+typedef std::tuple<var, var, double, empty, empty, empty> type_vv_99;
+
+typedef std::tuple<AgradDistributionsPareto, type_vv_0> AgradDistributionsPareto_vv_0;
+typedef std::tuple<AgradDistributionsPareto, type_vv_1> AgradDistributionsPareto_vv_1;
+typedef std::tuple<AgradDistributionsPareto, type_vv_2> AgradDistributionsPareto_vv_2;
+typedef std::tuple<AgradDistributionsPareto, type_vv_3> AgradDistributionsPareto_vv_3;
+typedef std::tuple<AgradDistributionsPareto, type_vv_4> AgradDistributionsPareto_vv_4;
+typedef std::tuple<AgradDistributionsPareto, type_vv_5> AgradDistributionsPareto_vv_5;
+typedef std::tuple<AgradDistributionsPareto, type_vv_6> AgradDistributionsPareto_vv_6;
+typedef std::tuple<AgradDistributionsPareto, type_vv_7> AgradDistributionsPareto_vv_7;
+typedef std::tuple<AgradDistributionsPareto, type_vv_8> AgradDistributionsPareto_vv_8;
+typedef std::tuple<AgradDistributionsPareto, type_vv_9> AgradDistributionsPareto_vv_9;
+typedef std::tuple<AgradDistributionsPareto, type_vv_10> AgradDistributionsPareto_vv_10;
+typedef std::tuple<AgradDistributionsPareto, type_vv_11> AgradDistributionsPareto_vv_11;
+typedef std::tuple<AgradDistributionsPareto, type_vv_12> AgradDistributionsPareto_vv_12;
+typedef std::tuple<AgradDistributionsPareto, type_vv_13> AgradDistributionsPareto_vv_13;
+typedef std::tuple<AgradDistributionsPareto, type_vv_14> AgradDistributionsPareto_vv_14;
+typedef std::tuple<AgradDistributionsPareto, type_vv_15> AgradDistributionsPareto_vv_15;
+typedef std::tuple<AgradDistributionsPareto, type_vv_16> AgradDistributionsPareto_vv_16;
+typedef std::tuple<AgradDistributionsPareto, type_vv_17> AgradDistributionsPareto_vv_17;
+typedef std::tuple<AgradDistributionsPareto, type_vv_18> AgradDistributionsPareto_vv_18;
+typedef std::tuple<AgradDistributionsPareto, type_vv_19> AgradDistributionsPareto_vv_19;
+typedef std::tuple<AgradDistributionsPareto, type_vv_20> AgradDistributionsPareto_vv_20;
+typedef std::tuple<AgradDistributionsPareto, type_vv_21> AgradDistributionsPareto_vv_21;
+typedef std::tuple<AgradDistributionsPareto, type_vv_22> AgradDistributionsPareto_vv_22;
+typedef std::tuple<AgradDistributionsPareto, type_vv_23> AgradDistributionsPareto_vv_23;
+typedef std::tuple<AgradDistributionsPareto, type_vv_24> AgradDistributionsPareto_vv_24;
+typedef std::tuple<AgradDistributionsPareto, type_vv_25> AgradDistributionsPareto_vv_25;
+typedef std::tuple<AgradDistributionsPareto, type_vv_26> AgradDistributionsPareto_vv_26;
+typedef std::tuple<AgradDistributionsPareto, type_vv_27> AgradDistributionsPareto_vv_27;
+typedef std::tuple<AgradDistributionsPareto, type_vv_28> AgradDistributionsPareto_vv_28;
+typedef std::tuple<AgradDistributionsPareto, type_vv_29> AgradDistributionsPareto_vv_29;
+typedef std::tuple<AgradDistributionsPareto, type_vv_30> AgradDistributionsPareto_vv_30;
+typedef std::tuple<AgradDistributionsPareto, type_vv_31> AgradDistributionsPareto_vv_31;
+typedef std::tuple<AgradDistributionsPareto, type_vv_32> AgradDistributionsPareto_vv_32;
+typedef std::tuple<AgradDistributionsPareto, type_vv_33> AgradDistributionsPareto_vv_33;
+typedef std::tuple<AgradDistributionsPareto, type_vv_34> AgradDistributionsPareto_vv_34;
+typedef std::tuple<AgradDistributionsPareto, type_vv_35> AgradDistributionsPareto_vv_35;
+typedef std::tuple<AgradDistributionsPareto, type_vv_36> AgradDistributionsPareto_vv_36;
+typedef std::tuple<AgradDistributionsPareto, type_vv_37> AgradDistributionsPareto_vv_37;
+typedef std::tuple<AgradDistributionsPareto, type_vv_38> AgradDistributionsPareto_vv_38;
+typedef std::tuple<AgradDistributionsPareto, type_vv_39> AgradDistributionsPareto_vv_39;
+typedef std::tuple<AgradDistributionsPareto, type_vv_40> AgradDistributionsPareto_vv_40;
+typedef std::tuple<AgradDistributionsPareto, type_vv_41> AgradDistributionsPareto_vv_41;
+typedef std::tuple<AgradDistributionsPareto, type_vv_42> AgradDistributionsPareto_vv_42;
+typedef std::tuple<AgradDistributionsPareto, type_vv_43> AgradDistributionsPareto_vv_43;
+typedef std::tuple<AgradDistributionsPareto, type_vv_44> AgradDistributionsPareto_vv_44;
+typedef std::tuple<AgradDistributionsPareto, type_vv_45> AgradDistributionsPareto_vv_45;
+typedef std::tuple<AgradDistributionsPareto, type_vv_46> AgradDistributionsPareto_vv_46;
+typedef std::tuple<AgradDistributionsPareto, type_vv_47> AgradDistributionsPareto_vv_47;
+typedef std::tuple<AgradDistributionsPareto, type_vv_48> AgradDistributionsPareto_vv_48;
+typedef std::tuple<AgradDistributionsPareto, type_vv_49> AgradDistributionsPareto_vv_49;
+typedef std::tuple<AgradDistributionsPareto, type_vv_50> AgradDistributionsPareto_vv_50;
+typedef std::tuple<AgradDistributionsPareto, type_vv_51> AgradDistributionsPareto_vv_51;
+typedef std::tuple<AgradDistributionsPareto, type_vv_52> AgradDistributionsPareto_vv_52;
+typedef std::tuple<AgradDistributionsPareto, type_vv_53> AgradDistributionsPareto_vv_53;
+typedef std::tuple<AgradDistributionsPareto, type_vv_54> AgradDistributionsPareto_vv_54;
+typedef std::tuple<AgradDistributionsPareto, type_vv_55> AgradDistributionsPareto_vv_55;
+typedef std::tuple<AgradDistributionsPareto, type_vv_56> AgradDistributionsPareto_vv_56;
+typedef std::tuple<AgradDistributionsPareto, type_vv_57> AgradDistributionsPareto_vv_57;
+typedef std::tuple<AgradDistributionsPareto, type_vv_58> AgradDistributionsPareto_vv_58;
+typedef std::tuple<AgradDistributionsPareto, type_vv_59> AgradDistributionsPareto_vv_59;
+typedef std::tuple<AgradDistributionsPareto, type_vv_60> AgradDistributionsPareto_vv_60;
+typedef std::tuple<AgradDistributionsPareto, type_vv_61> AgradDistributionsPareto_vv_61;
+typedef std::tuple<AgradDistributionsPareto, type_vv_62> AgradDistributionsPareto_vv_62;
+typedef std::tuple<AgradDistributionsPareto, type_vv_63> AgradDistributionsPareto_vv_63;
+typedef std::tuple<AgradDistributionsPareto, type_vv_64> AgradDistributionsPareto_vv_64;
+typedef std::tuple<AgradDistributionsPareto, type_vv_65> AgradDistributionsPareto_vv_65;
+typedef std::tuple<AgradDistributionsPareto, type_vv_66> AgradDistributionsPareto_vv_66;
+typedef std::tuple<AgradDistributionsPareto, type_vv_67> AgradDistributionsPareto_vv_67;
+typedef std::tuple<AgradDistributionsPareto, type_vv_68> AgradDistributionsPareto_vv_68;
+typedef std::tuple<AgradDistributionsPareto, type_vv_69> AgradDistributionsPareto_vv_69;
+typedef std::tuple<AgradDistributionsPareto, type_vv_70> AgradDistributionsPareto_vv_70;
+typedef std::tuple<AgradDistributionsPareto, type_vv_71> AgradDistributionsPareto_vv_71;
+typedef std::tuple<AgradDistributionsPareto, type_vv_72> AgradDistributionsPareto_vv_72;
+typedef std::tuple<AgradDistributionsPareto, type_vv_73> AgradDistributionsPareto_vv_73;
+typedef std::tuple<AgradDistributionsPareto, type_vv_74> AgradDistributionsPareto_vv_74;
+typedef std::tuple<AgradDistributionsPareto, type_vv_75> AgradDistributionsPareto_vv_75;
+typedef std::tuple<AgradDistributionsPareto, type_vv_76> AgradDistributionsPareto_vv_76;
+typedef std::tuple<AgradDistributionsPareto, type_vv_77> AgradDistributionsPareto_vv_77;
+typedef std::tuple<AgradDistributionsPareto, type_vv_78> AgradDistributionsPareto_vv_78;
+typedef std::tuple<AgradDistributionsPareto, type_vv_79> AgradDistributionsPareto_vv_79;
+typedef std::tuple<AgradDistributionsPareto, type_vv_80> AgradDistributionsPareto_vv_80;
+typedef std::tuple<AgradDistributionsPareto, type_vv_81> AgradDistributionsPareto_vv_81;
+typedef std::tuple<AgradDistributionsPareto, type_vv_82> AgradDistributionsPareto_vv_82;
+typedef std::tuple<AgradDistributionsPareto, type_vv_83> AgradDistributionsPareto_vv_83;
+typedef std::tuple<AgradDistributionsPareto, type_vv_84> AgradDistributionsPareto_vv_84;
+typedef std::tuple<AgradDistributionsPareto, type_vv_85> AgradDistributionsPareto_vv_85;
+typedef std::tuple<AgradDistributionsPareto, type_vv_86> AgradDistributionsPareto_vv_86;
+typedef std::tuple<AgradDistributionsPareto, type_vv_87> AgradDistributionsPareto_vv_87;
+typedef std::tuple<AgradDistributionsPareto, type_vv_88> AgradDistributionsPareto_vv_88;
+typedef std::tuple<AgradDistributionsPareto, type_vv_89> AgradDistributionsPareto_vv_89;
+typedef std::tuple<AgradDistributionsPareto, type_vv_90> AgradDistributionsPareto_vv_90;
+typedef std::tuple<AgradDistributionsPareto, type_vv_91> AgradDistributionsPareto_vv_91;
+typedef std::tuple<AgradDistributionsPareto, type_vv_92> AgradDistributionsPareto_vv_92;
+typedef std::tuple<AgradDistributionsPareto, type_vv_93> AgradDistributionsPareto_vv_93;
+typedef std::tuple<AgradDistributionsPareto, type_vv_94> AgradDistributionsPareto_vv_94;
+typedef std::tuple<AgradDistributionsPareto, type_vv_95> AgradDistributionsPareto_vv_95;
+typedef std::tuple<AgradDistributionsPareto, type_vv_96> AgradDistributionsPareto_vv_96;
+typedef std::tuple<AgradDistributionsPareto, type_vv_97> AgradDistributionsPareto_vv_97;
+typedef std::tuple<AgradDistributionsPareto, type_vv_98> AgradDistributionsPareto_vv_98;
+typedef std::tuple<AgradDistributionsPareto, type_vv_99> AgradDistributionsPareto_vv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_0, AgradDistributionTestFixture, AgradDistributionsPareto_vv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_1, AgradDistributionTestFixture, AgradDistributionsPareto_vv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_2, AgradDistributionTestFixture, AgradDistributionsPareto_vv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_3, AgradDistributionTestFixture, AgradDistributionsPareto_vv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_4, AgradDistributionTestFixture, AgradDistributionsPareto_vv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_5, AgradDistributionTestFixture, AgradDistributionsPareto_vv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_6, AgradDistributionTestFixture, AgradDistributionsPareto_vv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_7, AgradDistributionTestFixture, AgradDistributionsPareto_vv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_8, AgradDistributionTestFixture, AgradDistributionsPareto_vv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_9, AgradDistributionTestFixture, AgradDistributionsPareto_vv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_10, AgradDistributionTestFixture, AgradDistributionsPareto_vv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_11, AgradDistributionTestFixture, AgradDistributionsPareto_vv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_12, AgradDistributionTestFixture, AgradDistributionsPareto_vv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_13, AgradDistributionTestFixture, AgradDistributionsPareto_vv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_14, AgradDistributionTestFixture, AgradDistributionsPareto_vv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_15, AgradDistributionTestFixture, AgradDistributionsPareto_vv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_16, AgradDistributionTestFixture, AgradDistributionsPareto_vv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_17, AgradDistributionTestFixture, AgradDistributionsPareto_vv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_18, AgradDistributionTestFixture, AgradDistributionsPareto_vv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_19, AgradDistributionTestFixture, AgradDistributionsPareto_vv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_20, AgradDistributionTestFixture, AgradDistributionsPareto_vv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_21, AgradDistributionTestFixture, AgradDistributionsPareto_vv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_22, AgradDistributionTestFixture, AgradDistributionsPareto_vv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_23, AgradDistributionTestFixture, AgradDistributionsPareto_vv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_24, AgradDistributionTestFixture, AgradDistributionsPareto_vv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_25, AgradDistributionTestFixture, AgradDistributionsPareto_vv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_26, AgradDistributionTestFixture, AgradDistributionsPareto_vv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_27, AgradDistributionTestFixture, AgradDistributionsPareto_vv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_28, AgradDistributionTestFixture, AgradDistributionsPareto_vv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_29, AgradDistributionTestFixture, AgradDistributionsPareto_vv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_30, AgradDistributionTestFixture, AgradDistributionsPareto_vv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_31, AgradDistributionTestFixture, AgradDistributionsPareto_vv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_32, AgradDistributionTestFixture, AgradDistributionsPareto_vv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_33, AgradDistributionTestFixture, AgradDistributionsPareto_vv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_34, AgradDistributionTestFixture, AgradDistributionsPareto_vv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_35, AgradDistributionTestFixture, AgradDistributionsPareto_vv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_36, AgradDistributionTestFixture, AgradDistributionsPareto_vv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_37, AgradDistributionTestFixture, AgradDistributionsPareto_vv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_38, AgradDistributionTestFixture, AgradDistributionsPareto_vv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_39, AgradDistributionTestFixture, AgradDistributionsPareto_vv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_40, AgradDistributionTestFixture, AgradDistributionsPareto_vv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_41, AgradDistributionTestFixture, AgradDistributionsPareto_vv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_42, AgradDistributionTestFixture, AgradDistributionsPareto_vv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_43, AgradDistributionTestFixture, AgradDistributionsPareto_vv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_44, AgradDistributionTestFixture, AgradDistributionsPareto_vv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_45, AgradDistributionTestFixture, AgradDistributionsPareto_vv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_46, AgradDistributionTestFixture, AgradDistributionsPareto_vv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_47, AgradDistributionTestFixture, AgradDistributionsPareto_vv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_48, AgradDistributionTestFixture, AgradDistributionsPareto_vv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_49, AgradDistributionTestFixture, AgradDistributionsPareto_vv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_50, AgradDistributionTestFixture, AgradDistributionsPareto_vv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_51, AgradDistributionTestFixture, AgradDistributionsPareto_vv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_52, AgradDistributionTestFixture, AgradDistributionsPareto_vv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_53, AgradDistributionTestFixture, AgradDistributionsPareto_vv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_54, AgradDistributionTestFixture, AgradDistributionsPareto_vv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_55, AgradDistributionTestFixture, AgradDistributionsPareto_vv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_56, AgradDistributionTestFixture, AgradDistributionsPareto_vv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_57, AgradDistributionTestFixture, AgradDistributionsPareto_vv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_58, AgradDistributionTestFixture, AgradDistributionsPareto_vv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_59, AgradDistributionTestFixture, AgradDistributionsPareto_vv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_60, AgradDistributionTestFixture, AgradDistributionsPareto_vv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_61, AgradDistributionTestFixture, AgradDistributionsPareto_vv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_62, AgradDistributionTestFixture, AgradDistributionsPareto_vv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_63, AgradDistributionTestFixture, AgradDistributionsPareto_vv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_64, AgradDistributionTestFixture, AgradDistributionsPareto_vv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_65, AgradDistributionTestFixture, AgradDistributionsPareto_vv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_66, AgradDistributionTestFixture, AgradDistributionsPareto_vv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_67, AgradDistributionTestFixture, AgradDistributionsPareto_vv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_68, AgradDistributionTestFixture, AgradDistributionsPareto_vv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_69, AgradDistributionTestFixture, AgradDistributionsPareto_vv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_70, AgradDistributionTestFixture, AgradDistributionsPareto_vv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_71, AgradDistributionTestFixture, AgradDistributionsPareto_vv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_72, AgradDistributionTestFixture, AgradDistributionsPareto_vv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_73, AgradDistributionTestFixture, AgradDistributionsPareto_vv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_74, AgradDistributionTestFixture, AgradDistributionsPareto_vv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_75, AgradDistributionTestFixture, AgradDistributionsPareto_vv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_76, AgradDistributionTestFixture, AgradDistributionsPareto_vv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_77, AgradDistributionTestFixture, AgradDistributionsPareto_vv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_78, AgradDistributionTestFixture, AgradDistributionsPareto_vv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_79, AgradDistributionTestFixture, AgradDistributionsPareto_vv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_80, AgradDistributionTestFixture, AgradDistributionsPareto_vv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_81, AgradDistributionTestFixture, AgradDistributionsPareto_vv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_82, AgradDistributionTestFixture, AgradDistributionsPareto_vv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_83, AgradDistributionTestFixture, AgradDistributionsPareto_vv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_84, AgradDistributionTestFixture, AgradDistributionsPareto_vv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_85, AgradDistributionTestFixture, AgradDistributionsPareto_vv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_86, AgradDistributionTestFixture, AgradDistributionsPareto_vv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_87, AgradDistributionTestFixture, AgradDistributionsPareto_vv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_88, AgradDistributionTestFixture, AgradDistributionsPareto_vv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_89, AgradDistributionTestFixture, AgradDistributionsPareto_vv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_90, AgradDistributionTestFixture, AgradDistributionsPareto_vv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_91, AgradDistributionTestFixture, AgradDistributionsPareto_vv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_92, AgradDistributionTestFixture, AgradDistributionsPareto_vv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_93, AgradDistributionTestFixture, AgradDistributionsPareto_vv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_94, AgradDistributionTestFixture, AgradDistributionsPareto_vv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_95, AgradDistributionTestFixture, AgradDistributionsPareto_vv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_96, AgradDistributionTestFixture, AgradDistributionsPareto_vv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_97, AgradDistributionTestFixture, AgradDistributionsPareto_vv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_98, AgradDistributionTestFixture, AgradDistributionsPareto_vv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_99, AgradDistributionTestFixture, AgradDistributionsPareto_vv_99);
+
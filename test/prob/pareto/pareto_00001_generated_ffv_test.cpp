@@ -0,0 +1,278 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto/pareto_test.hpp>
+
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_100;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_101;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_102;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_103;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_104;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_105;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_106;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_107;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_108;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_109;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_110;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_111;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_112;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_113;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_114;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_115;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_116;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, double, empty, empty, empty> type_ffv_117;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty, empty, empty> type_ffv_118;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_119;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_120;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_121;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_122;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty, empty, empty> type_ffv_123;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_124;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_125;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_126;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_127;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_128;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_129;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_130;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_131;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_132;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_133;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_134;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_135;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_136;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_137;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_138;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_139;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_140;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_141;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_142;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_143;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_144;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_145;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_146;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_147;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_148;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_149;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_150;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_151;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_152;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_ffv_153;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_ffv_154;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_155;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_156;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_157;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_158;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_ffv_159;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_160;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_161;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_162;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_163;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_164;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_165;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_166;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_167;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_168;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_169;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_170;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_171;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_172;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_173;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_174;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_175;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_176;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_177;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_178;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_179;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_180;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_181;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_182;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_183;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_184;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_185;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_186;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_187;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_188;
+
+typedef std::tuple<AgradDistributionsPareto, type_ffv_100> AgradDistributionsPareto_ffv_100;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_101> AgradDistributionsPareto_ffv_101;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_102> AgradDistributionsPareto_ffv_102;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_103> AgradDistributionsPareto_ffv_103;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_104> AgradDistributionsPareto_ffv_104;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_105> AgradDistributionsPareto_ffv_105;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_106> AgradDistributionsPareto_ffv_106;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_107> AgradDistributionsPareto_ffv_107;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_108> AgradDistributionsPareto_ffv_108;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_109> AgradDistributionsPareto_ffv_109;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_110> AgradDistributionsPareto_ffv_110;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_111> AgradDistributionsPareto_ffv_111;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_112> AgradDistributionsPareto_ffv_112;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_113> AgradDistributionsPareto_ffv_113;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_114> AgradDistributionsPareto_ffv_114;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_115> AgradDistributionsPareto_ffv_115;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_116> AgradDistributionsPareto_ffv_116;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_117> AgradDistributionsPareto_ffv_117;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_118> AgradDistributionsPareto_ffv_118;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_119> AgradDistributionsPareto_ffv_119;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_120> AgradDistributionsPareto_ffv_120;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_121> AgradDistributionsPareto_ffv_121;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_122> AgradDistributionsPareto_ffv_122;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_123> AgradDistributionsPareto_ffv_123;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_124> AgradDistributionsPareto_ffv_124;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_125> AgradDistributionsPareto_ffv_125;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_126> AgradDistributionsPareto_ffv_126;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_127> AgradDistributionsPareto_ffv_127;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_128> AgradDistributionsPareto_ffv_128;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_129> AgradDistributionsPareto_ffv_129;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_130> AgradDistributionsPareto_ffv_130;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_131> AgradDistributionsPareto_ffv_131;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_132> AgradDistributionsPareto_ffv_132;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_133> AgradDistributionsPareto_ffv_133;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_134> AgradDistributionsPareto_ffv_134;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_135> AgradDistributionsPareto_ffv_135;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_136> AgradDistributionsPareto_ffv_136;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_137> AgradDistributionsPareto_ffv_137;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_138> AgradDistributionsPareto_ffv_138;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_139> AgradDistributionsPareto_ffv_139;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_140> AgradDistributionsPareto_ffv_140;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_141> AgradDistributionsPareto_ffv_141;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_142> AgradDistributionsPareto_ffv_142;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_143> AgradDistributionsPareto_ffv_143;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_144> AgradDistributionsPareto_ffv_144;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_145> AgradDistributionsPareto_ffv_145;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_146> AgradDistributionsPareto_ffv_146;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_147> AgradDistributionsPareto_ffv_147;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_148> AgradDistributionsPareto_ffv_148;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_149> AgradDistributionsPareto_ffv_149;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_150> AgradDistributionsPareto_ffv_150;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_151> AgradDistributionsPareto_ffv_151;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_152> AgradDistributionsPareto_ffv_152;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_153> AgradDistributionsPareto_ffv_153;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_154> AgradDistributionsPareto_ffv_154;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_155> AgradDistributionsPareto_ffv_155;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_156> AgradDistributionsPareto_ffv_156;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_157> AgradDistributionsPareto_ffv_157;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_158> AgradDistributionsPareto_ffv_158;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_159> AgradDistributionsPareto_ffv_159;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_160> AgradDistributionsPareto_ffv_160;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_161> AgradDistributionsPareto_ffv_161;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_162> AgradDistributionsPareto_ffv_162;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_163> AgradDistributionsPareto_ffv_163;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_164> AgradDistributionsPareto_ffv_164;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_165> AgradDistributionsPareto_ffv_165;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_166> AgradDistributionsPareto_ffv_166;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_167> AgradDistributionsPareto_ffv_167;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_168> AgradDistributionsPareto_ffv_168;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_169> AgradDistributionsPareto_ffv_169;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_170> AgradDistributionsPareto_ffv_170;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_171> AgradDistributionsPareto_ffv_171;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_172> AgradDistributionsPareto_ffv_172;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_173> AgradDistributionsPareto_ffv_173;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_174> AgradDistributionsPareto_ffv_174;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_175> AgradDistributionsPareto_ffv_175;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_176> AgradDistributionsPareto_ffv_176;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_177> AgradDistributionsPareto_ffv_177;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_178> AgradDistributionsPareto_ffv_178;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_179> AgradDistributionsPareto_ffv_179;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_180> AgradDistributionsPareto_ffv_180;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_181> AgradDistributionsPareto_ffv_181;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_182> AgradDistributionsPareto_ffv_182;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_183> AgradDistributionsPareto_ffv_183;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_184> AgradDistributionsPareto_ffv_184;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_185> AgradDistributionsPareto_ffv_185;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_186> AgradDistributionsPareto_ffv_186;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_187> AgradDistributionsPareto_ffv_187;
+typedef std::tuple<AgradDistributionsPareto, type_ffv_188> AgradDistributionsPareto_ffv_188;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_100, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_101, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_102, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_103, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_104, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_105, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_106, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_107, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_108, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_109, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_110, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_111, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_112, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_113, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_114, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_115, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_116, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_117, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_118, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_119, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_120, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_121, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_122, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_123, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_124, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_125, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_126, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_127, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_128, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_129, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_130, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_131, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_132, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_133, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_134, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_135, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_136, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_137, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_138, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_139, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_140, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_141, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_142, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_143, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_144, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_145, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_146, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_147, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_148, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_149, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_150, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_151, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_152, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_153, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_154, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_155, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_156, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_157, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_158, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_159, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_160, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_161, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_162, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_163, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_164, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_165, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_166, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_167, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_168, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_169, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_170, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_171, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_172, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_173, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_174, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_175, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_176, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_177, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_178, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_179, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_180, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_181, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_182, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_183, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_184, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_185, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_186, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_187, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_ffv_188, AgradDistributionTestFixture, AgradDistributionsPareto_ffv_188);
+
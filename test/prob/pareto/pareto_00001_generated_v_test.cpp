@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto/pareto_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_100;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_101;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_102;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_103;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_104;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_105;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_106;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_107;
+typedef std::tuple<var, double, double, empty, empty, empty> type_v_108;
+typedef std::tuple<var, double, std::vector<double>, empty, empty, empty> type_v_109;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_110;
+typedef std::tuple<var, double, var, empty, empty, empty> type_v_111;
+typedef std::tuple<var, double, std::vector<var>, empty, empty, empty> type_v_112;
+typedef std::tuple<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_113;
+typedef std::tuple<var, std::vector<double>, double, empty, empty, empty> type_v_114;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_115;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_116;
+typedef std::tuple<var, std::vector<double>, var, empty, empty, empty> type_v_117;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_118;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_119;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_120;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_121;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_122;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_123;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_124;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_125;
+typedef std::tuple<var, var, double, empty, empty, empty> type_v_126;
+typedef std::tuple<var, var, std::vector<double>, empty, empty, empty> type_v_127;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_128;
+typedef std::tuple<var, var, var, empty, empty, empty> type_v_129;
+typedef std::tuple<var, var, std::vector<var>, empty, empty, empty> type_v_130;
+typedef std::tuple<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_131;
+typedef std::tuple<var, std::vector<var>, double, empty, empty, empty> type_v_132;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_133;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_134;
+typedef std::tuple<var, std::vector<var>, var, empty, empty, empty> type_v_135;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_136;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_137;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_138;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_139;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_140;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_141;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_142;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_143;
+typedef std::tuple<std::vector<var>, double, double, empty, empty, empty> type_v_144;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, empty, empty, empty> type_v_145;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_146;
+typedef std::tuple<std::vector<var>, double, var, empty, empty, empty> type_v_147;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, empty, empty, empty> type_v_148;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_149;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, empty, empty, empty> type_v_150;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_151;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_152;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, empty, empty, empty> type_v_153;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_154;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_155;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_156;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_157;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_158;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_159;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_160;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_161;
+typedef std::tuple<std::vector<var>, var, double, empty, empty, empty> type_v_162;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, empty, empty, empty> type_v_163;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_164;
+typedef std::tuple<std::vector<var>, var, var, empty, empty, empty> type_v_165;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, empty, empty, empty> type_v_166;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_167;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, empty, empty, empty> type_v_168;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_169;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_170;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, empty, empty, empty> type_v_171;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_172;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_173;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_174;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_175;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_176;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_177;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_178;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_179;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_v_180;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_v_181;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_182;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_v_183;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_v_184;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_185;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_v_186;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_187;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_188;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_v_189;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_190;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_191;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_192;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_193;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_194;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_195;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_196;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_197;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_v_198;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_v_199;
+
+typedef std::tuple<AgradDistributionsPareto, type_v_100> AgradDistributionsPareto_v_100;
+typedef std::tuple<AgradDistributionsPareto, type_v_101> AgradDistributionsPareto_v_101;
+typedef std::tuple<AgradDistributionsPareto, type_v_102> AgradDistributionsPareto_v_102;
+typedef std::tuple<AgradDistributionsPareto, type_v_103> AgradDistributionsPareto_v_103;
+typedef std::tuple<AgradDistributionsPareto, type_v_104> AgradDistributionsPareto_v_104;
+typedef std::tuple<AgradDistributionsPareto, type_v_105> AgradDistributionsPareto_v_105;
+typedef std::tuple<AgradDistributionsPareto, type_v_106> AgradDistributionsPareto_v_106;
+typedef std::tuple<AgradDistributionsPareto, type_v_107> AgradDistributionsPareto_v_107;
+typedef std::tuple<AgradDistributionsPareto, type_v_108> AgradDistributionsPareto_v_108;
+typedef std::tuple<AgradDistributionsPareto, type_v_109> AgradDistributionsPareto_v_109;
+typedef std::tuple<AgradDistributionsPareto, type_v_110> AgradDistributionsPareto_v_110;
+typedef std::tuple<AgradDistributionsPareto, type_v_111> AgradDistributionsPareto_v_111;
+typedef std::tuple<AgradDistributionsPareto, type_v_112> AgradDistributionsPareto_v_112;
+typedef std::tuple<AgradDistributionsPareto, type_v_113> AgradDistributionsPareto_v_113;
+typedef std::tuple<AgradDistributionsPareto, type_v_114> AgradDistributionsPareto_v_114;
+typedef std::tuple<AgradDistributionsPareto, type_v_115> AgradDistributionsPareto_v_115;
+typedef std::tuple<AgradDistributionsPareto, type_v_116> AgradDistributionsPareto_v_116;
+typedef std::tuple<AgradDistributionsPareto, type_v_117> AgradDistributionsPareto_v_117;
+typedef std::tuple<AgradDistributionsPareto, type_v_118> AgradDistributionsPareto_v_118;
+typedef std::tuple<AgradDistributionsPareto, type_v_119> AgradDistributionsPareto_v_119;
+typedef std::tuple<AgradDistributionsPareto, type_v_120> AgradDistributionsPareto_v_120;
+typedef std::tuple<AgradDistributionsPareto, type_v_121> AgradDistributionsPareto_v_121;
+typedef std::tuple<AgradDistributionsPareto, type_v_122> AgradDistributionsPareto_v_122;
+typedef std::tuple<AgradDistributionsPareto, type_v_123> AgradDistributionsPareto_v_123;
+typedef std::tuple<AgradDistributionsPareto, type_v_124> AgradDistributionsPareto_v_124;
+typedef std::tuple<AgradDistributionsPareto, type_v_125> AgradDistributionsPareto_v_125;
+typedef std::tuple<AgradDistributionsPareto, type_v_126> AgradDistributionsPareto_v_126;
+typedef std::tuple<AgradDistributionsPareto, type_v_127> AgradDistributionsPareto_v_127;
+typedef std::tuple<AgradDistributionsPareto, type_v_128> AgradDistributionsPareto_v_128;
+typedef std::tuple<AgradDistributionsPareto, type_v_129> AgradDistributionsPareto_v_129;
+typedef std::tuple<AgradDistributionsPareto, type_v_130> AgradDistributionsPareto_v_130;
+typedef std::tuple<AgradDistributionsPareto, type_v_131> AgradDistributionsPareto_v_131;
+typedef std::tuple<AgradDistributionsPareto, type_v_132> AgradDistributionsPareto_v_132;
+typedef std::tuple<AgradDistributionsPareto, type_v_133> AgradDistributionsPareto_v_133;
+typedef std::tuple<AgradDistributionsPareto, type_v_134> AgradDistributionsPareto_v_134;
+typedef std::tuple<AgradDistributionsPareto, type_v_135> AgradDistributionsPareto_v_135;
+typedef std::tuple<AgradDistributionsPareto, type_v_136> AgradDistributionsPareto_v_136;
+typedef std::tuple<AgradDistributionsPareto, type_v_137> AgradDistributionsPareto_v_137;
+typedef std::tuple<AgradDistributionsPareto, type_v_138> AgradDistributionsPareto_v_138;
+typedef std::tuple<AgradDistributionsPareto, type_v_139> AgradDistributionsPareto_v_139;
+typedef std::tuple<AgradDistributionsPareto, type_v_140> AgradDistributionsPareto_v_140;
+typedef std::tuple<AgradDistributionsPareto, type_v_141> AgradDistributionsPareto_v_141;
+typedef std::tuple<AgradDistributionsPareto, type_v_142> AgradDistributionsPareto_v_142;
+typedef std::tuple<AgradDistributionsPareto, type_v_143> AgradDistributionsPareto_v_143;
+typedef std::tuple<AgradDistributionsPareto, type_v_144> AgradDistributionsPareto_v_144;
+typedef std::tuple<AgradDistributionsPareto, type_v_145> AgradDistributionsPareto_v_145;
+typedef std::tuple<AgradDistributionsPareto, type_v_146> AgradDistributionsPareto_v_146;
+typedef std::tuple<AgradDistributionsPareto, type_v_147> AgradDistributionsPareto_v_147;
+typedef std::tuple<AgradDistributionsPareto, type_v_148> AgradDistributionsPareto_v_148;
+typedef std::tuple<AgradDistributionsPareto, type_v_149> AgradDistributionsPareto_v_149;
+typedef std::tuple<AgradDistributionsPareto, type_v_150> AgradDistributionsPareto_v_150;
+typedef std::tuple<AgradDistributionsPareto, type_v_151> AgradDistributionsPareto_v_151;
+typedef std::tuple<AgradDistributionsPareto, type_v_152> AgradDistributionsPareto_v_152;
+typedef std::tuple<AgradDistributionsPareto, type_v_153> AgradDistributionsPareto_v_153;
+typedef std::tuple<AgradDistributionsPareto, type_v_154> AgradDistributionsPareto_v_154;
+typedef std::tuple<AgradDistributionsPareto, type_v_155> AgradDistributionsPareto_v_155;
+typedef std::tuple<AgradDistributionsPareto, type_v_156> AgradDistributionsPareto_v_156;
+typedef std::tuple<AgradDistributionsPareto, type_v_157> AgradDistributionsPareto_v_157;
+typedef std::tuple<AgradDistributionsPareto, type_v_158> AgradDistributionsPareto_v_158;
+typedef std::tuple<AgradDistributionsPareto, type_v_159> AgradDistributionsPareto_v_159;
+typedef std::tuple<AgradDistributionsPareto, type_v_160> AgradDistributionsPareto_v_160;
+typedef std::tuple<AgradDistributionsPareto, type_v_161> AgradDistributionsPareto_v_161;
+typedef std::tuple<AgradDistributionsPareto, type_v_162> AgradDistributionsPareto_v_162;
+typedef std::tuple<AgradDistributionsPareto, type_v_163> AgradDistributionsPareto_v_163;
+typedef std::tuple<AgradDistributionsPareto, type_v_164> AgradDistributionsPareto_v_164;
+typedef std::tuple<AgradDistributionsPareto, type_v_165> AgradDistributionsPareto_v_165;
+typedef std::tuple<AgradDistributionsPareto, type_v_166> AgradDistributionsPareto_v_166;
+typedef std::tuple<AgradDistributionsPareto, type_v_167> AgradDistributionsPareto_v_167;
+typedef std::tuple<AgradDistributionsPareto, type_v_168> AgradDistributionsPareto_v_168;
+typedef std::tuple<AgradDistributionsPareto, type_v_169> AgradDistributionsPareto_v_169;
+typedef std::tuple<AgradDistributionsPareto, type_v_170> AgradDistributionsPareto_v_170;
+typedef std::tuple<AgradDistributionsPareto, type_v_171> AgradDistributionsPareto_v_171;
+typedef std::tuple<AgradDistributionsPareto, type_v_172> AgradDistributionsPareto_v_172;
+typedef std::tuple<AgradDistributionsPareto, type_v_173> AgradDistributionsPareto_v_173;
+typedef std::tuple<AgradDistributionsPareto, type_v_174> AgradDistributionsPareto_v_174;
+typedef std::tuple<AgradDistributionsPareto, type_v_175> AgradDistributionsPareto_v_175;
+typedef std::tuple<AgradDistributionsPareto, type_v_176> AgradDistributionsPareto_v_176;
+typedef std::tuple<AgradDistributionsPareto, type_v_177> AgradDistributionsPareto_v_177;
+typedef std::tuple<AgradDistributionsPareto, type_v_178> AgradDistributionsPareto_v_178;
+typedef std::tuple<AgradDistributionsPareto, type_v_179> AgradDistributionsPareto_v_179;
+typedef std::tuple<AgradDistributionsPareto, type_v_180> AgradDistributionsPareto_v_180;
+typedef std::tuple<AgradDistributionsPareto, type_v_181> AgradDistributionsPareto_v_181;
+typedef std::tuple<AgradDistributionsPareto, type_v_182> AgradDistributionsPareto_v_182;
+typedef std::tuple<AgradDistributionsPareto, type_v_183> AgradDistributionsPareto_v_183;
+typedef std::tuple<AgradDistributionsPareto, type_v_184> AgradDistributionsPareto_v_184;
+typedef std::tuple<AgradDistributionsPareto, type_v_185> AgradDistributionsPareto_v_185;
+typedef std::tuple<AgradDistributionsPareto, type_v_186> AgradDistributionsPareto_v_186;
+typedef std::tuple<AgradDistributionsPareto, type_v_187> AgradDistributionsPareto_v_187;
+typedef std::tuple<AgradDistributionsPareto, type_v_188> AgradDistributionsPareto_v_188;
+typedef std::tuple<AgradDistributionsPareto, type_v_189> AgradDistributionsPareto_v_189;
+typedef std::tuple<AgradDistributionsPareto, type_v_190> AgradDistributionsPareto_v_190;
+typedef std::tuple<AgradDistributionsPareto, type_v_191> AgradDistributionsPareto_v_191;
+typedef std::tuple<AgradDistributionsPareto, type_v_192> AgradDistributionsPareto_v_192;
+typedef std::tuple<AgradDistributionsPareto, type_v_193> AgradDistributionsPareto_v_193;
+typedef std::tuple<AgradDistributionsPareto, type_v_194> AgradDistributionsPareto_v_194;
+typedef std::tuple<AgradDistributionsPareto, type_v_195> AgradDistributionsPareto_v_195;
+typedef std::tuple<AgradDistributionsPareto, type_v_196> AgradDistributionsPareto_v_196;
+typedef std::tuple<AgradDistributionsPareto, type_v_197> AgradDistributionsPareto_v_197;
+typedef std::tuple<AgradDistributionsPareto, type_v_198> AgradDistributionsPareto_v_198;
+typedef std::tuple<AgradDistributionsPareto, type_v_199> AgradDistributionsPareto_v_199;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_100, AgradDistributionTestFixture, AgradDistributionsPareto_v_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_101, AgradDistributionTestFixture, AgradDistributionsPareto_v_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_102, AgradDistributionTestFixture, AgradDistributionsPareto_v_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_103, AgradDistributionTestFixture, AgradDistributionsPareto_v_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_104, AgradDistributionTestFixture, AgradDistributionsPareto_v_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_105, AgradDistributionTestFixture, AgradDistributionsPareto_v_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_106, AgradDistributionTestFixture, AgradDistributionsPareto_v_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_107, AgradDistributionTestFixture, AgradDistributionsPareto_v_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_108, AgradDistributionTestFixture, AgradDistributionsPareto_v_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_109, AgradDistributionTestFixture, AgradDistributionsPareto_v_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_110, AgradDistributionTestFixture, AgradDistributionsPareto_v_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_111, AgradDistributionTestFixture, AgradDistributionsPareto_v_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_112, AgradDistributionTestFixture, AgradDistributionsPareto_v_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_113, AgradDistributionTestFixture, AgradDistributionsPareto_v_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_114, AgradDistributionTestFixture, AgradDistributionsPareto_v_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_115, AgradDistributionTestFixture, AgradDistributionsPareto_v_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_116, AgradDistributionTestFixture, AgradDistributionsPareto_v_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_117, AgradDistributionTestFixture, AgradDistributionsPareto_v_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_118, AgradDistributionTestFixture, AgradDistributionsPareto_v_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_119, AgradDistributionTestFixture, AgradDistributionsPareto_v_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_120, AgradDistributionTestFixture, AgradDistributionsPareto_v_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_121, AgradDistributionTestFixture, AgradDistributionsPareto_v_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_122, AgradDistributionTestFixture, AgradDistributionsPareto_v_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_123, AgradDistributionTestFixture, AgradDistributionsPareto_v_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_124, AgradDistributionTestFixture, AgradDistributionsPareto_v_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_125, AgradDistributionTestFixture, AgradDistributionsPareto_v_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_126, AgradDistributionTestFixture, AgradDistributionsPareto_v_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_127, AgradDistributionTestFixture, AgradDistributionsPareto_v_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_128, AgradDistributionTestFixture, AgradDistributionsPareto_v_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_129, AgradDistributionTestFixture, AgradDistributionsPareto_v_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_130, AgradDistributionTestFixture, AgradDistributionsPareto_v_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_131, AgradDistributionTestFixture, AgradDistributionsPareto_v_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_132, AgradDistributionTestFixture, AgradDistributionsPareto_v_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_133, AgradDistributionTestFixture, AgradDistributionsPareto_v_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_134, AgradDistributionTestFixture, AgradDistributionsPareto_v_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_135, AgradDistributionTestFixture, AgradDistributionsPareto_v_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_136, AgradDistributionTestFixture, AgradDistributionsPareto_v_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_137, AgradDistributionTestFixture, AgradDistributionsPareto_v_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_138, AgradDistributionTestFixture, AgradDistributionsPareto_v_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_139, AgradDistributionTestFixture, AgradDistributionsPareto_v_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_140, AgradDistributionTestFixture, AgradDistributionsPareto_v_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_141, AgradDistributionTestFixture, AgradDistributionsPareto_v_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_142, AgradDistributionTestFixture, AgradDistributionsPareto_v_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_143, AgradDistributionTestFixture, AgradDistributionsPareto_v_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_144, AgradDistributionTestFixture, AgradDistributionsPareto_v_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_145, AgradDistributionTestFixture, AgradDistributionsPareto_v_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_146, AgradDistributionTestFixture, AgradDistributionsPareto_v_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_147, AgradDistributionTestFixture, AgradDistributionsPareto_v_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_148, AgradDistributionTestFixture, AgradDistributionsPareto_v_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_149, AgradDistributionTestFixture, AgradDistributionsPareto_v_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_150, AgradDistributionTestFixture, AgradDistributionsPareto_v_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_151, AgradDistributionTestFixture, AgradDistributionsPareto_v_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_152, AgradDistributionTestFixture, AgradDistributionsPareto_v_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_153, AgradDistributionTestFixture, AgradDistributionsPareto_v_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_154, AgradDistributionTestFixture, AgradDistributionsPareto_v_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_155, AgradDistributionTestFixture, AgradDistributionsPareto_v_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_156, AgradDistributionTestFixture, AgradDistributionsPareto_v_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_157, AgradDistributionTestFixture, AgradDistributionsPareto_v_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_158, AgradDistributionTestFixture, AgradDistributionsPareto_v_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_159, AgradDistributionTestFixture, AgradDistributionsPareto_v_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_160, AgradDistributionTestFixture, AgradDistributionsPareto_v_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_161, AgradDistributionTestFixture, AgradDistributionsPareto_v_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_162, AgradDistributionTestFixture, AgradDistributionsPareto_v_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_163, AgradDistributionTestFixture, AgradDistributionsPareto_v_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_164, AgradDistributionTestFixture, AgradDistributionsPareto_v_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_165, AgradDistributionTestFixture, AgradDistributionsPareto_v_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_166, AgradDistributionTestFixture, AgradDistributionsPareto_v_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_167, AgradDistributionTestFixture, AgradDistributionsPareto_v_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_168, AgradDistributionTestFixture, AgradDistributionsPareto_v_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_169, AgradDistributionTestFixture, AgradDistributionsPareto_v_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_170, AgradDistributionTestFixture, AgradDistributionsPareto_v_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_171, AgradDistributionTestFixture, AgradDistributionsPareto_v_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_172, AgradDistributionTestFixture, AgradDistributionsPareto_v_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_173, AgradDistributionTestFixture, AgradDistributionsPareto_v_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_174, AgradDistributionTestFixture, AgradDistributionsPareto_v_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_175, AgradDistributionTestFixture, AgradDistributionsPareto_v_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_176, AgradDistributionTestFixture, AgradDistributionsPareto_v_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_177, AgradDistributionTestFixture, AgradDistributionsPareto_v_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_178, AgradDistributionTestFixture, AgradDistributionsPareto_v_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_179, AgradDistributionTestFixture, AgradDistributionsPareto_v_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_180, AgradDistributionTestFixture, AgradDistributionsPareto_v_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_181, AgradDistributionTestFixture, AgradDistributionsPareto_v_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_182, AgradDistributionTestFixture, AgradDistributionsPareto_v_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_183, AgradDistributionTestFixture, AgradDistributionsPareto_v_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_184, AgradDistributionTestFixture, AgradDistributionsPareto_v_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_185, AgradDistributionTestFixture, AgradDistributionsPareto_v_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_186, AgradDistributionTestFixture, AgradDistributionsPareto_v_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_187, AgradDistributionTestFixture, AgradDistributionsPareto_v_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_188, AgradDistributionTestFixture, AgradDistributionsPareto_v_188);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_189, AgradDistributionTestFixture, AgradDistributionsPareto_v_189);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_190, AgradDistributionTestFixture, AgradDistributionsPareto_v_190);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_191, AgradDistributionTestFixture, AgradDistributionsPareto_v_191);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_192, AgradDistributionTestFixture, AgradDistributionsPareto_v_192);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_193, AgradDistributionTestFixture, AgradDistributionsPareto_v_193);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_194, AgradDistributionTestFixture, AgradDistributionsPareto_v_194);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_195, AgradDistributionTestFixture, AgradDistributionsPareto_v_195);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_196, AgradDistributionTestFixture, AgradDistributionsPareto_v_196);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_197, AgradDistributionTestFixture, AgradDistributionsPareto_v_197);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_198, AgradDistributionTestFixture, AgradDistributionsPareto_v_198);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_199, AgradDistributionTestFixture, AgradDistributionsPareto_v_199);
+
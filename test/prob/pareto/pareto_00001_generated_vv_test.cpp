@@ -0,0 +1,278 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto/pareto_test.hpp>
+
+typedef std::tuple<var, var, std::vector<double>, empty, empty, empty> type_vv_100;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_101;
+typedef std::tuple<var, var, var, empty, empty, empty> type_vv_102;
+typedef std::tuple<var, var, std::vector<var>, empty, empty, empty> type_vv_103;
+typedef std::tuple<var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_104;
+typedef std::tuple<var, std::vector<var>, double, empty, empty, empty> type_vv_105;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_106;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_107;
+typedef std::tuple<var, std::vector<var>, var, empty, empty, empty> type_vv_108;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_109;
+typedef std::tuple<var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_110;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_111;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_112;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_113;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_114;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_115;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_116;
+typedef std::tuple<std::vector<var>, double, double, empty, empty, empty> type_vv_117;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, empty, empty, empty> type_vv_118;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_119;
+typedef std::tuple<std::vector<var>, double, var, empty, empty, empty> type_vv_120;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, empty, empty, empty> type_vv_121;
+typedef std::tuple<std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_122;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, empty, empty, empty> type_vv_123;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_124;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_125;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, empty, empty, empty> type_vv_126;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_127;
+typedef std::tuple<std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_128;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_129;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_130;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_131;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_132;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_133;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_134;
+typedef std::tuple<std::vector<var>, var, double, empty, empty, empty> type_vv_135;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, empty, empty, empty> type_vv_136;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_137;
+typedef std::tuple<std::vector<var>, var, var, empty, empty, empty> type_vv_138;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, empty, empty, empty> type_vv_139;
+typedef std::tuple<std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_140;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, empty, empty, empty> type_vv_141;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_142;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_143;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, empty, empty, empty> type_vv_144;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_145;
+typedef std::tuple<std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_146;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_147;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_148;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_149;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_150;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_151;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_152;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, empty, empty, empty> type_vv_153;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, empty, empty, empty> type_vv_154;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_155;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, empty, empty, empty> type_vv_156;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, empty, empty, empty> type_vv_157;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_158;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, empty, empty, empty> type_vv_159;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_160;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_161;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, empty, empty, empty> type_vv_162;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_163;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_164;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_165;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_166;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_167;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_168;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_169;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_170;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, empty, empty, empty> type_vv_171;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, empty, empty, empty> type_vv_172;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_173;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, empty, empty, empty> type_vv_174;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, empty, empty, empty> type_vv_175;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_176;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, empty, empty, empty> type_vv_177;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_178;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_179;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, empty, empty, empty> type_vv_180;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_181;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_182;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_183;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_184;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_185;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_186;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_187;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_188;
+
+typedef std::tuple<AgradDistributionsPareto, type_vv_100> AgradDistributionsPareto_vv_100;
+typedef std::tuple<AgradDistributionsPareto, type_vv_101> AgradDistributionsPareto_vv_101;
+typedef std::tuple<AgradDistributionsPareto, type_vv_102> AgradDistributionsPareto_vv_102;
+typedef std::tuple<AgradDistributionsPareto, type_vv_103> AgradDistributionsPareto_vv_103;
+typedef std::tuple<AgradDistributionsPareto, type_vv_104> AgradDistributionsPareto_vv_104;
+typedef std::tuple<AgradDistributionsPareto, type_vv_105> AgradDistributionsPareto_vv_105;
+typedef std::tuple<AgradDistributionsPareto, type_vv_106> AgradDistributionsPareto_vv_106;
+typedef std::tuple<AgradDistributionsPareto, type_vv_107> AgradDistributionsPareto_vv_107;
+typedef std::tuple<AgradDistributionsPareto, type_vv_108> AgradDistributionsPareto_vv_108;
+typedef std::tuple<AgradDistributionsPareto, type_vv_109> AgradDistributionsPareto_vv_109;
+typedef std::tuple<AgradDistributionsPareto, type_vv_110> AgradDistributionsPareto_vv_110;
+typedef std::tuple<AgradDistributionsPareto, type_vv_111> AgradDistributionsPareto_vv_111;
+typedef std::tuple<AgradDistributionsPareto, type_vv_112> AgradDistributionsPareto_vv_112;
+typedef std::tuple<AgradDistributionsPareto, type_vv_113> AgradDistributionsPareto_vv_113;
+typedef std::tuple<AgradDistributionsPareto, type_vv_114> AgradDistributionsPareto_vv_114;
+typedef std::tuple<AgradDistributionsPareto, type_vv_115> AgradDistributionsPareto_vv_115;
+typedef std::tuple<AgradDistributionsPareto, type_vv_116> AgradDistributionsPareto_vv_116;
+typedef std::tuple<AgradDistributionsPareto, type_vv_117> AgradDistributionsPareto_vv_117;
+typedef std::tuple<AgradDistributionsPareto, type_vv_118> AgradDistributionsPareto_vv_118;
+typedef std::tuple<AgradDistributionsPareto, type_vv_119> AgradDistributionsPareto_vv_119;
+typedef std::tuple<AgradDistributionsPareto, type_vv_120> AgradDistributionsPareto_vv_120;
+typedef std::tuple<AgradDistributionsPareto, type_vv_121> AgradDistributionsPareto_vv_121;
+typedef std::tuple<AgradDistributionsPareto, type_vv_122> AgradDistributionsPareto_vv_122;
+typedef std::tuple<AgradDistributionsPareto, type_vv_123> AgradDistributionsPareto_vv_123;
+typedef std::tuple<AgradDistributionsPareto, type_vv_124> AgradDistributionsPareto_vv_124;
+typedef std::tuple<AgradDistributionsPareto, type_vv_125> AgradDistributionsPareto_vv_125;
+typedef std::tuple<AgradDistributionsPareto, type_vv_126> AgradDistributionsPareto_vv_126;
+typedef std::tuple<AgradDistributionsPareto, type_vv_127> AgradDistributionsPareto_vv_127;
+typedef std::tuple<AgradDistributionsPareto, type_vv_128> AgradDistributionsPareto_vv_128;
+typedef std::tuple<AgradDistributionsPareto, type_vv_129> AgradDistributionsPareto_vv_129;
+typedef std::tuple<AgradDistributionsPareto, type_vv_130> AgradDistributionsPareto_vv_130;
+typedef std::tuple<AgradDistributionsPareto, type_vv_131> AgradDistributionsPareto_vv_131;
+typedef std::tuple<AgradDistributionsPareto, type_vv_132> AgradDistributionsPareto_vv_132;
+typedef std::tuple<AgradDistributionsPareto, type_vv_133> AgradDistributionsPareto_vv_133;
+typedef std::tuple<AgradDistributionsPareto, type_vv_134> AgradDistributionsPareto_vv_134;
+typedef std::tuple<AgradDistributionsPareto, type_vv_135> AgradDistributionsPareto_vv_135;
+typedef std::tuple<AgradDistributionsPareto, type_vv_136> AgradDistributionsPareto_vv_136;
+typedef std::tuple<AgradDistributionsPareto, type_vv_137> AgradDistributionsPareto_vv_137;
+typedef std::tuple<AgradDistributionsPareto, type_vv_138> AgradDistributionsPareto_vv_138;
+typedef std::tuple<AgradDistributionsPareto, type_vv_139> AgradDistributionsPareto_vv_139;
+typedef std::tuple<AgradDistributionsPareto, type_vv_140> AgradDistributionsPareto_vv_140;
+typedef std::tuple<AgradDistributionsPareto, type_vv_141> AgradDistributionsPareto_vv_141;
+typedef std::tuple<AgradDistributionsPareto, type_vv_142> AgradDistributionsPareto_vv_142;
+typedef std::tuple<AgradDistributionsPareto, type_vv_143> AgradDistributionsPareto_vv_143;
+typedef std::tuple<AgradDistributionsPareto, type_vv_144> AgradDistributionsPareto_vv_144;
+typedef std::tuple<AgradDistributionsPareto, type_vv_145> AgradDistributionsPareto_vv_145;
+typedef std::tuple<AgradDistributionsPareto, type_vv_146> AgradDistributionsPareto_vv_146;
+typedef std::tuple<AgradDistributionsPareto, type_vv_147> AgradDistributionsPareto_vv_147;
+typedef std::tuple<AgradDistributionsPareto, type_vv_148> AgradDistributionsPareto_vv_148;
+typedef std::tuple<AgradDistributionsPareto, type_vv_149> AgradDistributionsPareto_vv_149;
+typedef std::tuple<AgradDistributionsPareto, type_vv_150> AgradDistributionsPareto_vv_150;
+typedef std::tuple<AgradDistributionsPareto, type_vv_151> AgradDistributionsPareto_vv_151;
+typedef std::tuple<AgradDistributionsPareto, type_vv_152> AgradDistributionsPareto_vv_152;
+typedef std::tuple<AgradDistributionsPareto, type_vv_153> AgradDistributionsPareto_vv_153;
+typedef std::tuple<AgradDistributionsPareto, type_vv_154> AgradDistributionsPareto_vv_154;
+typedef std::tuple<AgradDistributionsPareto, type_vv_155> AgradDistributionsPareto_vv_155;
+typedef std::tuple<AgradDistributionsPareto, type_vv_156> AgradDistributionsPareto_vv_156;
+typedef std::tuple<AgradDistributionsPareto, type_vv_157> AgradDistributionsPareto_vv_157;
+typedef std::tuple<AgradDistributionsPareto, type_vv_158> AgradDistributionsPareto_vv_158;
+typedef std::tuple<AgradDistributionsPareto, type_vv_159> AgradDistributionsPareto_vv_159;
+typedef std::tuple<AgradDistributionsPareto, type_vv_160> AgradDistributionsPareto_vv_160;
+typedef std::tuple<AgradDistributionsPareto, type_vv_161> AgradDistributionsPareto_vv_161;
+typedef std::tuple<AgradDistributionsPareto, type_vv_162> AgradDistributionsPareto_vv_162;
+typedef std::tuple<AgradDistributionsPareto, type_vv_163> AgradDistributionsPareto_vv_163;
+typedef std::tuple<AgradDistributionsPareto, type_vv_164> AgradDistributionsPareto_vv_164;
+typedef std::tuple<AgradDistributionsPareto, type_vv_165> AgradDistributionsPareto_vv_165;
+typedef std::tuple<AgradDistributionsPareto, type_vv_166> AgradDistributionsPareto_vv_166;
+typedef std::tuple<AgradDistributionsPareto, type_vv_167> AgradDistributionsPareto_vv_167;
+typedef std::tuple<AgradDistributionsPareto, type_vv_168> AgradDistributionsPareto_vv_168;
+typedef std::tuple<AgradDistributionsPareto, type_vv_169> AgradDistributionsPareto_vv_169;
+typedef std::tuple<AgradDistributionsPareto, type_vv_170> AgradDistributionsPareto_vv_170;
+typedef std::tuple<AgradDistributionsPareto, type_vv_171> AgradDistributionsPareto_vv_171;
+typedef std::tuple<AgradDistributionsPareto, type_vv_172> AgradDistributionsPareto_vv_172;
+typedef std::tuple<AgradDistributionsPareto, type_vv_173> AgradDistributionsPareto_vv_173;
+typedef std::tuple<AgradDistributionsPareto, type_vv_174> AgradDistributionsPareto_vv_174;
+typedef std::tuple<AgradDistributionsPareto, type_vv_175> AgradDistributionsPareto_vv_175;
+typedef std::tuple<AgradDistributionsPareto, type_vv_176> AgradDistributionsPareto_vv_176;
+typedef std::tuple<AgradDistributionsPareto, type_vv_177> AgradDistributionsPareto_vv_177;
+typedef std::tuple<AgradDistributionsPareto, type_vv_178> AgradDistributionsPareto_vv_178;
+typedef std::tuple<AgradDistributionsPareto, type_vv_179> AgradDistributionsPareto_vv_179;
+typedef std::tuple<AgradDistributionsPareto, type_vv_180> AgradDistributionsPareto_vv_180;
+typedef std::tuple<AgradDistributionsPareto, type_vv_181> AgradDistributionsPareto_vv_181;
+typedef std::tuple<AgradDistributionsPareto, type_vv_182> AgradDistributionsPareto_vv_182;
+typedef std::tuple<AgradDistributionsPareto, type_vv_183> AgradDistributionsPareto_vv_183;
+typedef std::tuple<AgradDistributionsPareto, type_vv_184> AgradDistributionsPareto_vv_184;
+typedef std::tuple<AgradDistributionsPareto, type_vv_185> AgradDistributionsPareto_vv_185;
+typedef std::tuple<AgradDistributionsPareto, type_vv_186> AgradDistributionsPareto_vv_186;
+typedef std::tuple<AgradDistributionsPareto, type_vv_187> AgradDistributionsPareto_vv_187;
+typedef std::tuple<AgradDistributionsPareto, type_vv_188> AgradDistributionsPareto_vv_188;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_100, AgradDistributionTestFixture, AgradDistributionsPareto_vv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_101, AgradDistributionTestFixture, AgradDistributionsPareto_vv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_102, AgradDistributionTestFixture, AgradDistributionsPareto_vv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_103, AgradDistributionTestFixture, AgradDistributionsPareto_vv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_104, AgradDistributionTestFixture, AgradDistributionsPareto_vv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_105, AgradDistributionTestFixture, AgradDistributionsPareto_vv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_106, AgradDistributionTestFixture, AgradDistributionsPareto_vv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_107, AgradDistributionTestFixture, AgradDistributionsPareto_vv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_108, AgradDistributionTestFixture, AgradDistributionsPareto_vv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_109, AgradDistributionTestFixture, AgradDistributionsPareto_vv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_110, AgradDistributionTestFixture, AgradDistributionsPareto_vv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_111, AgradDistributionTestFixture, AgradDistributionsPareto_vv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_112, AgradDistributionTestFixture, AgradDistributionsPareto_vv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_113, AgradDistributionTestFixture, AgradDistributionsPareto_vv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_114, AgradDistributionTestFixture, AgradDistributionsPareto_vv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_115, AgradDistributionTestFixture, AgradDistributionsPareto_vv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_116, AgradDistributionTestFixture, AgradDistributionsPareto_vv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_117, AgradDistributionTestFixture, AgradDistributionsPareto_vv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_118, AgradDistributionTestFixture, AgradDistributionsPareto_vv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_119, AgradDistributionTestFixture, AgradDistributionsPareto_vv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_120, AgradDistributionTestFixture, AgradDistributionsPareto_vv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_121, AgradDistributionTestFixture, AgradDistributionsPareto_vv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_122, AgradDistributionTestFixture, AgradDistributionsPareto_vv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_123, AgradDistributionTestFixture, AgradDistributionsPareto_vv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_124, AgradDistributionTestFixture, AgradDistributionsPareto_vv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_125, AgradDistributionTestFixture, AgradDistributionsPareto_vv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_126, AgradDistributionTestFixture, AgradDistributionsPareto_vv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_127, AgradDistributionTestFixture, AgradDistributionsPareto_vv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_128, AgradDistributionTestFixture, AgradDistributionsPareto_vv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_129, AgradDistributionTestFixture, AgradDistributionsPareto_vv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_130, AgradDistributionTestFixture, AgradDistributionsPareto_vv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_131, AgradDistributionTestFixture, AgradDistributionsPareto_vv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_132, AgradDistributionTestFixture, AgradDistributionsPareto_vv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_133, AgradDistributionTestFixture, AgradDistributionsPareto_vv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_134, AgradDistributionTestFixture, AgradDistributionsPareto_vv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_135, AgradDistributionTestFixture, AgradDistributionsPareto_vv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_136, AgradDistributionTestFixture, AgradDistributionsPareto_vv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_137, AgradDistributionTestFixture, AgradDistributionsPareto_vv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_138, AgradDistributionTestFixture, AgradDistributionsPareto_vv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_139, AgradDistributionTestFixture, AgradDistributionsPareto_vv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_140, AgradDistributionTestFixture, AgradDistributionsPareto_vv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_141, AgradDistributionTestFixture, AgradDistributionsPareto_vv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_142, AgradDistributionTestFixture, AgradDistributionsPareto_vv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_143, AgradDistributionTestFixture, AgradDistributionsPareto_vv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_144, AgradDistributionTestFixture, AgradDistributionsPareto_vv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_145, AgradDistributionTestFixture, AgradDistributionsPareto_vv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_146, AgradDistributionTestFixture, AgradDistributionsPareto_vv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_147, AgradDistributionTestFixture, AgradDistributionsPareto_vv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_148, AgradDistributionTestFixture, AgradDistributionsPareto_vv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_149, AgradDistributionTestFixture, AgradDistributionsPareto_vv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_150, AgradDistributionTestFixture, AgradDistributionsPareto_vv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_151, AgradDistributionTestFixture, AgradDistributionsPareto_vv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_152, AgradDistributionTestFixture, AgradDistributionsPareto_vv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_153, AgradDistributionTestFixture, AgradDistributionsPareto_vv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_154, AgradDistributionTestFixture, AgradDistributionsPareto_vv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_155, AgradDistributionTestFixture, AgradDistributionsPareto_vv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_156, AgradDistributionTestFixture, AgradDistributionsPareto_vv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_157, AgradDistributionTestFixture, AgradDistributionsPareto_vv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_158, AgradDistributionTestFixture, AgradDistributionsPareto_vv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_159, AgradDistributionTestFixture, AgradDistributionsPareto_vv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_160, AgradDistributionTestFixture, AgradDistributionsPareto_vv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_161, AgradDistributionTestFixture, AgradDistributionsPareto_vv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_162, AgradDistributionTestFixture, AgradDistributionsPareto_vv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_163, AgradDistributionTestFixture, AgradDistributionsPareto_vv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_164, AgradDistributionTestFixture, AgradDistributionsPareto_vv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_165, AgradDistributionTestFixture, AgradDistributionsPareto_vv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_166, AgradDistributionTestFixture, AgradDistributionsPareto_vv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_167, AgradDistributionTestFixture, AgradDistributionsPareto_vv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_168, AgradDistributionTestFixture, AgradDistributionsPareto_vv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_169, AgradDistributionTestFixture, AgradDistributionsPareto_vv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_170, AgradDistributionTestFixture, AgradDistributionsPareto_vv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_171, AgradDistributionTestFixture, AgradDistributionsPareto_vv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_172, AgradDistributionTestFixture, AgradDistributionsPareto_vv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_173, AgradDistributionTestFixture, AgradDistributionsPareto_vv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_174, AgradDistributionTestFixture, AgradDistributionsPareto_vv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_175, AgradDistributionTestFixture, AgradDistributionsPareto_vv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_176, AgradDistributionTestFixture, AgradDistributionsPareto_vv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_177, AgradDistributionTestFixture, AgradDistributionsPareto_vv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_178, AgradDistributionTestFixture, AgradDistributionsPareto_vv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_179, AgradDistributionTestFixture, AgradDistributionsPareto_vv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_180, AgradDistributionTestFixture, AgradDistributionsPareto_vv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_181, AgradDistributionTestFixture, AgradDistributionsPareto_vv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_182, AgradDistributionTestFixture, AgradDistributionsPareto_vv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_183, AgradDistributionTestFixture, AgradDistributionsPareto_vv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_184, AgradDistributionTestFixture, AgradDistributionsPareto_vv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_185, AgradDistributionTestFixture, AgradDistributionsPareto_vv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_186, AgradDistributionTestFixture, AgradDistributionsPareto_vv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_187, AgradDistributionTestFixture, AgradDistributionsPareto_vv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_vv_188, AgradDistributionTestFixture, AgradDistributionsPareto_vv_188);
+
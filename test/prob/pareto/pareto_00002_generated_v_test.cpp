@@ -0,0 +1,59 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto/pareto_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_200;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_v_201;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_v_202;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_203;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_v_204;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_205;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_206;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_v_207;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_208;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_209;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_210;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_211;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_212;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_213;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_214;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_215;
+
+typedef std::tuple<AgradDistributionsPareto, type_v_200> AgradDistributionsPareto_v_200;
+typedef std::tuple<AgradDistributionsPareto, type_v_201> AgradDistributionsPareto_v_201;
+typedef std::tuple<AgradDistributionsPareto, type_v_202> AgradDistributionsPareto_v_202;
+typedef std::tuple<AgradDistributionsPareto, type_v_203> AgradDistributionsPareto_v_203;
+typedef std::tuple<AgradDistributionsPareto, type_v_204> AgradDistributionsPareto_v_204;
+typedef std::tuple<AgradDistributionsPareto, type_v_205> AgradDistributionsPareto_v_205;
+typedef std::tuple<AgradDistributionsPareto, type_v_206> AgradDistributionsPareto_v_206;
+typedef std::tuple<AgradDistributionsPareto, type_v_207> AgradDistributionsPareto_v_207;
+typedef std::tuple<AgradDistributionsPareto, type_v_208> AgradDistributionsPareto_v_208;
+typedef std::tuple<AgradDistributionsPareto, type_v_209> AgradDistributionsPareto_v_209;
+typedef std::tuple<AgradDistributionsPareto, type_v_210> AgradDistributionsPareto_v_210;
+typedef std::tuple<AgradDistributionsPareto, type_v_211> AgradDistributionsPareto_v_211;
+typedef std::tuple<AgradDistributionsPareto, type_v_212> AgradDistributionsPareto_v_212;
+typedef std::tuple<AgradDistributionsPareto, type_v_213> AgradDistributionsPareto_v_213;
+typedef std::tuple<AgradDistributionsPareto, type_v_214> AgradDistributionsPareto_v_214;
+typedef std::tuple<AgradDistributionsPareto, type_v_215> AgradDistributionsPareto_v_215;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_200, AgradDistributionTestFixture, AgradDistributionsPareto_v_200);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_201, AgradDistributionTestFixture, AgradDistributionsPareto_v_201);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_202, AgradDistributionTestFixture, AgradDistributionsPareto_v_202);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_203, AgradDistributionTestFixture, AgradDistributionsPareto_v_203);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_204, AgradDistributionTestFixture, AgradDistributionsPareto_v_204);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_205, AgradDistributionTestFixture, AgradDistributionsPareto_v_205);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_206, AgradDistributionTestFixture, AgradDistributionsPareto_v_206);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_207, AgradDistributionTestFixture, AgradDistributionsPareto_v_207);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_208, AgradDistributionTestFixture, AgradDistributionsPareto_v_208);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_209, AgradDistributionTestFixture, AgradDistributionsPareto_v_209);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_210, AgradDistributionTestFixture, AgradDistributionsPareto_v_210);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_211, AgradDistributionTestFixture, AgradDistributionsPareto_v_211);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_212, AgradDistributionTestFixture, AgradDistributionsPareto_v_212);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_213, AgradDistributionTestFixture, AgradDistributionsPareto_v_213);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_214, AgradDistributionTestFixture, AgradDistributionsPareto_v_214);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPareto_v_215, AgradDistributionTestFixture, AgradDistributionsPareto_v_215);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto/pareto_ccdf_log_test.hpp>
+
+typedef std::tuple<double, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_0;
+typedef std::tuple<double, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_1;
+typedef std::tuple<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_2;
+typedef std::tuple<double, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_3;
+typedef std::tuple<double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_4;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_5;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_6;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_7;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_8;
+typedef std::tuple<double, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_9;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_10;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_11;
+typedef std::tuple<double, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_12;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_13;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_14;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_15;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_16;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_17;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_18;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_19;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_20;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_21;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_22;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_23;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_24;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_25;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_26;
+typedef std::tuple<std::vector<double>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_27;
+typedef std::tuple<std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_28;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_29;
+typedef std::tuple<std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_30;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_31;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_32;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_33;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_34;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_35;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_36;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_37;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_38;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_39;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_40;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_41;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_42;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_43;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_44;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_45;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_46;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_47;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_48;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_49;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_50;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_51;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_52;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_53;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_54;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_55;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_56;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_57;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_58;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_59;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_60;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_61;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_62;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_63;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_64;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_65;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_66;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_67;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_68;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_69;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_70;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_80;
+typedef std::tuple<fvar<fvar<var> >, double, double, empty, empty, empty> type_ffv_81;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<double>, empty, empty, empty> type_ffv_82;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_83;
+typedef std::tuple<fvar<fvar<var> >, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_84;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_85;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_86;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, double, empty, empty, empty> type_ffv_87;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_88;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_89;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_90;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_91;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_92;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_93;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_94;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_95;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_96;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_97;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_98;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_99;
+
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_0> AgradCcdfLogPareto_ffv_0;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_1> AgradCcdfLogPareto_ffv_1;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_2> AgradCcdfLogPareto_ffv_2;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_3> AgradCcdfLogPareto_ffv_3;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_4> AgradCcdfLogPareto_ffv_4;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_5> AgradCcdfLogPareto_ffv_5;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_6> AgradCcdfLogPareto_ffv_6;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_7> AgradCcdfLogPareto_ffv_7;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_8> AgradCcdfLogPareto_ffv_8;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_9> AgradCcdfLogPareto_ffv_9;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_10> AgradCcdfLogPareto_ffv_10;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_11> AgradCcdfLogPareto_ffv_11;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_12> AgradCcdfLogPareto_ffv_12;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_13> AgradCcdfLogPareto_ffv_13;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_14> AgradCcdfLogPareto_ffv_14;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_15> AgradCcdfLogPareto_ffv_15;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_16> AgradCcdfLogPareto_ffv_16;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_17> AgradCcdfLogPareto_ffv_17;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_18> AgradCcdfLogPareto_ffv_18;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_19> AgradCcdfLogPareto_ffv_19;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_20> AgradCcdfLogPareto_ffv_20;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_21> AgradCcdfLogPareto_ffv_21;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_22> AgradCcdfLogPareto_ffv_22;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_23> AgradCcdfLogPareto_ffv_23;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_24> AgradCcdfLogPareto_ffv_24;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_25> AgradCcdfLogPareto_ffv_25;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_26> AgradCcdfLogPareto_ffv_26;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_27> AgradCcdfLogPareto_ffv_27;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_28> AgradCcdfLogPareto_ffv_28;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_29> AgradCcdfLogPareto_ffv_29;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_30> AgradCcdfLogPareto_ffv_30;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_31> AgradCcdfLogPareto_ffv_31;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_32> AgradCcdfLogPareto_ffv_32;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_33> AgradCcdfLogPareto_ffv_33;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_34> AgradCcdfLogPareto_ffv_34;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_35> AgradCcdfLogPareto_ffv_35;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_36> AgradCcdfLogPareto_ffv_36;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_37> AgradCcdfLogPareto_ffv_37;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_38> AgradCcdfLogPareto_ffv_38;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_39> AgradCcdfLogPareto_ffv_39;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_40> AgradCcdfLogPareto_ffv_40;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_41> AgradCcdfLogPareto_ffv_41;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_42> AgradCcdfLogPareto_ffv_42;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_43> AgradCcdfLogPareto_ffv_43;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_44> AgradCcdfLogPareto_ffv_44;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_45> AgradCcdfLogPareto_ffv_45;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_46> AgradCcdfLogPareto_ffv_46;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_47> AgradCcdfLogPareto_ffv_47;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_48> AgradCcdfLogPareto_ffv_48;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_49> AgradCcdfLogPareto_ffv_49;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_50> AgradCcdfLogPareto_ffv_50;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_51> AgradCcdfLogPareto_ffv_51;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_52> AgradCcdfLogPareto_ffv_52;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_53> AgradCcdfLogPareto_ffv_53;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_54> AgradCcdfLogPareto_ffv_54;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_55> AgradCcdfLogPareto_ffv_55;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_56> AgradCcdfLogPareto_ffv_56;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_57> AgradCcdfLogPareto_ffv_57;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_58> AgradCcdfLogPareto_ffv_58;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_59> AgradCcdfLogPareto_ffv_59;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_60> AgradCcdfLogPareto_ffv_60;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_61> AgradCcdfLogPareto_ffv_61;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_62> AgradCcdfLogPareto_ffv_62;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_63> AgradCcdfLogPareto_ffv_63;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_64> AgradCcdfLogPareto_ffv_64;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_65> AgradCcdfLogPareto_ffv_65;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_66> AgradCcdfLogPareto_ffv_66;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_67> AgradCcdfLogPareto_ffv_67;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_68> AgradCcdfLogPareto_ffv_68;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_69> AgradCcdfLogPareto_ffv_69;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_70> AgradCcdfLogPareto_ffv_70;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_71> AgradCcdfLogPareto_ffv_71;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_72> AgradCcdfLogPareto_ffv_72;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_73> AgradCcdfLogPareto_ffv_73;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_74> AgradCcdfLogPareto_ffv_74;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_75> AgradCcdfLogPareto_ffv_75;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_76> AgradCcdfLogPareto_ffv_76;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_77> AgradCcdfLogPareto_ffv_77;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_78> AgradCcdfLogPareto_ffv_78;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_79> AgradCcdfLogPareto_ffv_79;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_80> AgradCcdfLogPareto_ffv_80;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_81> AgradCcdfLogPareto_ffv_81;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_82> AgradCcdfLogPareto_ffv_82;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_83> AgradCcdfLogPareto_ffv_83;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_84> AgradCcdfLogPareto_ffv_84;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_85> AgradCcdfLogPareto_ffv_85;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_86> AgradCcdfLogPareto_ffv_86;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_87> AgradCcdfLogPareto_ffv_87;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_88> AgradCcdfLogPareto_ffv_88;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_89> AgradCcdfLogPareto_ffv_89;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_90> AgradCcdfLogPareto_ffv_90;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_91> AgradCcdfLogPareto_ffv_91;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_92> AgradCcdfLogPareto_ffv_92;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_93> AgradCcdfLogPareto_ffv_93;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_94> AgradCcdfLogPareto_ffv_94;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_95> AgradCcdfLogPareto_ffv_95;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_96> AgradCcdfLogPareto_ffv_96;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_97> AgradCcdfLogPareto_ffv_97;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_98> AgradCcdfLogPareto_ffv_98;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_99> AgradCcdfLogPareto_ffv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_0, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_1, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_2, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_3, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_4, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_5, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_6, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_7, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_8, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_9, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_10, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_11, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_12, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_13, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_14, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_15, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_16, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_17, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_18, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_19, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_20, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_21, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_22, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_23, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_24, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_25, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_26, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_27, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_28, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_29, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_30, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_31, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_32, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_33, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_34, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_35, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_36, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_37, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_38, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_39, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_40, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_41, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_42, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_43, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_44, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_45, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_46, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_47, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_48, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_49, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_50, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_51, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_52, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_53, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_54, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_55, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_56, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_57, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_58, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_59, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_60, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_61, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_62, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_63, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_64, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_65, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_66, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_67, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_68, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_69, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_70, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_71, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_72, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_73, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_74, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_75, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_76, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_77, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_78, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_79, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_80, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_81, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_82, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_83, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_84, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_85, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_86, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_87, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_88, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_89, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_90, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_91, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_92, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_93, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_94, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_95, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_96, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_97, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_98, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_99, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_99);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto/pareto_ccdf_log_test.hpp>
+
+typedef std::tuple<double, double, double, empty, empty, empty> type_v_0;
+typedef std::tuple<double, double, std::vector<double>, empty, empty, empty> type_v_1;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_2;
+typedef std::tuple<double, double, var, empty, empty, empty> type_v_3;
+typedef std::tuple<double, double, std::vector<var>, empty, empty, empty> type_v_4;
+typedef std::tuple<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_5;
+typedef std::tuple<double, std::vector<double>, double, empty, empty, empty> type_v_6;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_7;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_8;
+typedef std::tuple<double, std::vector<double>, var, empty, empty, empty> type_v_9;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_10;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_11;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_12;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_13;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_14;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_15;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_16;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_17;
+typedef std::tuple<double, var, double, empty, empty, empty> type_v_18;
+typedef std::tuple<double, var, std::vector<double>, empty, empty, empty> type_v_19;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_20;
+typedef std::tuple<double, var, var, empty, empty, empty> type_v_21;
+typedef std::tuple<double, var, std::vector<var>, empty, empty, empty> type_v_22;
+typedef std::tuple<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_23;
+typedef std::tuple<double, std::vector<var>, double, empty, empty, empty> type_v_24;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_25;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_26;
+typedef std::tuple<double, std::vector<var>, var, empty, empty, empty> type_v_27;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_28;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_29;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_30;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_31;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_32;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_33;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_34;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_35;
+typedef std::tuple<std::vector<double>, double, double, empty, empty, empty> type_v_36;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, empty, empty, empty> type_v_37;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_38;
+typedef std::tuple<std::vector<double>, double, var, empty, empty, empty> type_v_39;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, empty, empty, empty> type_v_40;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_41;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, empty, empty, empty> type_v_42;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_43;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_44;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, empty, empty, empty> type_v_45;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_46;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_47;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_48;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_49;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_50;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_51;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_52;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_53;
+typedef std::tuple<std::vector<double>, var, double, empty, empty, empty> type_v_54;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, empty, empty, empty> type_v_55;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_56;
+typedef std::tuple<std::vector<double>, var, var, empty, empty, empty> type_v_57;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, empty, empty, empty> type_v_58;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_59;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, empty, empty, empty> type_v_60;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_61;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_62;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, empty, empty, empty> type_v_63;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_64;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_65;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_66;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_67;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_68;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_69;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_70;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_v_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_v_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_v_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_v_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_v_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_80;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_v_81;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_82;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_83;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_84;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_85;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_86;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_87;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_88;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_89;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_v_90;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_v_91;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_92;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_v_93;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_v_94;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_95;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_v_96;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_97;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_98;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_v_99;
+
+typedef std::tuple<AgradCcdfLogPareto, type_v_0> AgradCcdfLogPareto_v_0;
+typedef std::tuple<AgradCcdfLogPareto, type_v_1> AgradCcdfLogPareto_v_1;
+typedef std::tuple<AgradCcdfLogPareto, type_v_2> AgradCcdfLogPareto_v_2;
+typedef std::tuple<AgradCcdfLogPareto, type_v_3> AgradCcdfLogPareto_v_3;
+typedef std::tuple<AgradCcdfLogPareto, type_v_4> AgradCcdfLogPareto_v_4;
+typedef std::tuple<AgradCcdfLogPareto, type_v_5> AgradCcdfLogPareto_v_5;
+typedef std::tuple<AgradCcdfLogPareto, type_v_6> AgradCcdfLogPareto_v_6;
+typedef std::tuple<AgradCcdfLogPareto, type_v_7> AgradCcdfLogPareto_v_7;
+typedef std::tuple<AgradCcdfLogPareto, type_v_8> AgradCcdfLogPareto_v_8;
+typedef std::tuple<AgradCcdfLogPareto, type_v_9> AgradCcdfLogPareto_v_9;
+typedef std::tuple<AgradCcdfLogPareto, type_v_10> AgradCcdfLogPareto_v_10;
+typedef std::tuple<AgradCcdfLogPareto, type_v_11> AgradCcdfLogPareto_v_11;
+typedef std::tuple<AgradCcdfLogPareto, type_v_12> AgradCcdfLogPareto_v_12;
+typedef std::tuple<AgradCcdfLogPareto, type_v_13> AgradCcdfLogPareto_v_13;
+typedef std::tuple<AgradCcdfLogPareto, type_v_14> AgradCcdfLogPareto_v_14;
+typedef std::tuple<AgradCcdfLogPareto, type_v_15> AgradCcdfLogPareto_v_15;
+typedef std::tuple<AgradCcdfLogPareto, type_v_16> AgradCcdfLogPareto_v_16;
+typedef std::tuple<AgradCcdfLogPareto, type_v_17> AgradCcdfLogPareto_v_17;
+typedef std::tuple<AgradCcdfLogPareto, type_v_18> AgradCcdfLogPareto_v_18;
+typedef std::tuple<AgradCcdfLogPareto, type_v_19> AgradCcdfLogPareto_v_19;
+typedef std::tuple<AgradCcdfLogPareto, type_v_20> AgradCcdfLogPareto_v_20;
+typedef std::tuple<AgradCcdfLogPareto, type_v_21> AgradCcdfLogPareto_v_21;
+typedef std::tuple<AgradCcdfLogPareto, type_v_22> AgradCcdfLogPareto_v_22;
+typedef std::tuple<AgradCcdfLogPareto, type_v_23> AgradCcdfLogPareto_v_23;
+typedef std::tuple<AgradCcdfLogPareto, type_v_24> AgradCcdfLogPareto_v_24;
+typedef std::tuple<AgradCcdfLogPareto, type_v_25> AgradCcdfLogPareto_v_25;
+typedef std::tuple<AgradCcdfLogPareto, type_v_26> AgradCcdfLogPareto_v_26;
+typedef std::tuple<AgradCcdfLogPareto, type_v_27> AgradCcdfLogPareto_v_27;
+typedef std::tuple<AgradCcdfLogPareto, type_v_28> AgradCcdfLogPareto_v_28;
+typedef std::tuple<AgradCcdfLogPareto, type_v_29> AgradCcdfLogPareto_v_29;
+typedef std::tuple<AgradCcdfLogPareto, type_v_30> AgradCcdfLogPareto_v_30;
+typedef std::tuple<AgradCcdfLogPareto, type_v_31> AgradCcdfLogPareto_v_31;
+typedef std::tuple<AgradCcdfLogPareto, type_v_32> AgradCcdfLogPareto_v_32;
+typedef std::tuple<AgradCcdfLogPareto, type_v_33> AgradCcdfLogPareto_v_33;
+typedef std::tuple<AgradCcdfLogPareto, type_v_34> AgradCcdfLogPareto_v_34;
+typedef std::tuple<AgradCcdfLogPareto, type_v_35> AgradCcdfLogPareto_v_35;
+typedef std::tuple<AgradCcdfLogPareto, type_v_36> AgradCcdfLogPareto_v_36;
+typedef std::tuple<AgradCcdfLogPareto, type_v_37> AgradCcdfLogPareto_v_37;
+typedef std::tuple<AgradCcdfLogPareto, type_v_38> AgradCcdfLogPareto_v_38;
+typedef std::tuple<AgradCcdfLogPareto, type_v_39> AgradCcdfLogPareto_v_39;
+typedef std::tuple<AgradCcdfLogPareto, type_v_40> AgradCcdfLogPareto_v_40;
+typedef std::tuple<AgradCcdfLogPareto, type_v_41> AgradCcdfLogPareto_v_41;
+typedef std::tuple<AgradCcdfLogPareto, type_v_42> AgradCcdfLogPareto_v_42;
+typedef std::tuple<AgradCcdfLogPareto, type_v_43> AgradCcdfLogPareto_v_43;
+typedef std::tuple<AgradCcdfLogPareto, type_v_44> AgradCcdfLogPareto_v_44;
+typedef std::tuple<AgradCcdfLogPareto, type_v_45> AgradCcdfLogPareto_v_45;
+typedef std::tuple<AgradCcdfLogPareto, type_v_46> AgradCcdfLogPareto_v_46;
+typedef std::tuple<AgradCcdfLogPareto, type_v_47> AgradCcdfLogPareto_v_47;
+typedef std::tuple<AgradCcdfLogPareto, type_v_48> AgradCcdfLogPareto_v_48;
+typedef std::tuple<AgradCcdfLogPareto, type_v_49> AgradCcdfLogPareto_v_49;
+typedef std::tuple<AgradCcdfLogPareto, type_v_50> AgradCcdfLogPareto_v_50;
+typedef std::tuple<AgradCcdfLogPareto, type_v_51> AgradCcdfLogPareto_v_51;
+typedef std::tuple<AgradCcdfLogPareto, type_v_52> AgradCcdfLogPareto_v_52;
+typedef std::tuple<AgradCcdfLogPareto, type_v_53> AgradCcdfLogPareto_v_53;
+typedef std::tuple<AgradCcdfLogPareto, type_v_54> AgradCcdfLogPareto_v_54;
+typedef std::tuple<AgradCcdfLogPareto, type_v_55> AgradCcdfLogPareto_v_55;
+typedef std::tuple<AgradCcdfLogPareto, type_v_56> AgradCcdfLogPareto_v_56;
+typedef std::tuple<AgradCcdfLogPareto, type_v_57> AgradCcdfLogPareto_v_57;
+typedef std::tuple<AgradCcdfLogPareto, type_v_58> AgradCcdfLogPareto_v_58;
+typedef std::tuple<AgradCcdfLogPareto, type_v_59> AgradCcdfLogPareto_v_59;
+typedef std::tuple<AgradCcdfLogPareto, type_v_60> AgradCcdfLogPareto_v_60;
+typedef std::tuple<AgradCcdfLogPareto, type_v_61> AgradCcdfLogPareto_v_61;
+typedef std::tuple<AgradCcdfLogPareto, type_v_62> AgradCcdfLogPareto_v_62;
+typedef std::tuple<AgradCcdfLogPareto, type_v_63> AgradCcdfLogPareto_v_63;
+typedef std::tuple<AgradCcdfLogPareto, type_v_64> AgradCcdfLogPareto_v_64;
+typedef std::tuple<AgradCcdfLogPareto, type_v_65> AgradCcdfLogPareto_v_65;
+typedef std::tuple<AgradCcdfLogPareto, type_v_66> AgradCcdfLogPareto_v_66;
+typedef std::tuple<AgradCcdfLogPareto, type_v_67> AgradCcdfLogPareto_v_67;
+typedef std::tuple<AgradCcdfLogPareto, type_v_68> AgradCcdfLogPareto_v_68;
+typedef std::tuple<AgradCcdfLogPareto, type_v_69> AgradCcdfLogPareto_v_69;
+typedef std::tuple<AgradCcdfLogPareto, type_v_70> AgradCcdfLogPareto_v_70;
+typedef std::tuple<AgradCcdfLogPareto, type_v_71> AgradCcdfLogPareto_v_71;
+typedef std::tuple<AgradCcdfLogPareto, type_v_72> AgradCcdfLogPareto_v_72;
+typedef std::tuple<AgradCcdfLogPareto, type_v_73> AgradCcdfLogPareto_v_73;
+typedef std::tuple<AgradCcdfLogPareto, type_v_74> AgradCcdfLogPareto_v_74;
+typedef std::tuple<AgradCcdfLogPareto, type_v_75> AgradCcdfLogPareto_v_75;
+typedef std::tuple<AgradCcdfLogPareto, type_v_76> AgradCcdfLogPareto_v_76;
+typedef std::tuple<AgradCcdfLogPareto, type_v_77> AgradCcdfLogPareto_v_77;
+typedef std::tuple<AgradCcdfLogPareto, type_v_78> AgradCcdfLogPareto_v_78;
+typedef std::tuple<AgradCcdfLogPareto, type_v_79> AgradCcdfLogPareto_v_79;
+typedef std::tuple<AgradCcdfLogPareto, type_v_80> AgradCcdfLogPareto_v_80;
+typedef std::tuple<AgradCcdfLogPareto, type_v_81> AgradCcdfLogPareto_v_81;
+typedef std::tuple<AgradCcdfLogPareto, type_v_82> AgradCcdfLogPareto_v_82;
+typedef std::tuple<AgradCcdfLogPareto, type_v_83> AgradCcdfLogPareto_v_83;
+typedef std::tuple<AgradCcdfLogPareto, type_v_84> AgradCcdfLogPareto_v_84;
+typedef std::tuple<AgradCcdfLogPareto, type_v_85> AgradCcdfLogPareto_v_85;
+typedef std::tuple<AgradCcdfLogPareto, type_v_86> AgradCcdfLogPareto_v_86;
+typedef std::tuple<AgradCcdfLogPareto, type_v_87> AgradCcdfLogPareto_v_87;
+typedef std::tuple<AgradCcdfLogPareto, type_v_88> AgradCcdfLogPareto_v_88;
+typedef std::tuple<AgradCcdfLogPareto, type_v_89> AgradCcdfLogPareto_v_89;
+typedef std::tuple<AgradCcdfLogPareto, type_v_90> AgradCcdfLogPareto_v_90;
+typedef std::tuple<AgradCcdfLogPareto, type_v_91> AgradCcdfLogPareto_v_91;
+typedef std::tuple<AgradCcdfLogPareto, type_v_92> AgradCcdfLogPareto_v_92;
+typedef std::tuple<AgradCcdfLogPareto, type_v_93> AgradCcdfLogPareto_v_93;
+typedef std::tuple<AgradCcdfLogPareto, type_v_94> AgradCcdfLogPareto_v_94;
+typedef std::tuple<AgradCcdfLogPareto, type_v_95> AgradCcdfLogPareto_v_95;
+typedef std::tuple<AgradCcdfLogPareto, type_v_96> AgradCcdfLogPareto_v_96;
+typedef std::tuple<AgradCcdfLogPareto, type_v_97> AgradCcdfLogPareto_v_97;
+typedef std::tuple<AgradCcdfLogPareto, type_v_98> AgradCcdfLogPareto_v_98;
+typedef std::tuple<AgradCcdfLogPareto, type_v_99> AgradCcdfLogPareto_v_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_0, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_1, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_2, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_3, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_4, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_5, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_6, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_7, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_8, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_9, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_10, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_11, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_12, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_13, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_14, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_15, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_16, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_17, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_18, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_19, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_20, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_21, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_22, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_23, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_24, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_25, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_26, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_27, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_28, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_29, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_30, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_31, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_32, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_33, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_34, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_35, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_36, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_37, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_38, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_39, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_40, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_41, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_42, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_43, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_44, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_45, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_46, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_47, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_48, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_49, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_50, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_51, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_52, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_53, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_54, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_55, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_56, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_57, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_58, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_59, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_60, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_61, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_62, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_63, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_64, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_65, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_66, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_67, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_68, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_69, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_70, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_71, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_72, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_73, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_74, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_75, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_76, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_77, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_78, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_79, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_80, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_81, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_82, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_83, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_84, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_85, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_86, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_87, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_88, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_89, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_90, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_91, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_92, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_93, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_94, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_95, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_96, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_97, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_98, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_99, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_99);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto/pareto_ccdf_log_test.hpp>
+
+typedef std::tuple<double, double, var, empty, empty, empty> type_vv_0;
+typedef std::tuple<double, double, std::vector<var>, empty, empty, empty> type_vv_1;
+typedef std::tuple<double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_2;
+typedef std::tuple<double, std::vector<double>, var, empty, empty, empty> type_vv_3;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_4;
+typedef std::tuple<double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_5;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_6;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_7;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_8;
+typedef std::tuple<double, var, double, empty, empty, empty> type_vv_9;
+typedef std::tuple<double, var, std::vector<double>, empty, empty, empty> type_vv_10;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_11;
+typedef std::tuple<double, var, var, empty, empty, empty> type_vv_12;
+typedef std::tuple<double, var, std::vector<var>, empty, empty, empty> type_vv_13;
+typedef std::tuple<double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_14;
+typedef std::tuple<double, std::vector<var>, double, empty, empty, empty> type_vv_15;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_16;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_17;
+typedef std::tuple<double, std::vector<var>, var, empty, empty, empty> type_vv_18;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_19;
+typedef std::tuple<double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_20;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_21;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_22;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_23;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_24;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_25;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_26;
+typedef std::tuple<std::vector<double>, double, var, empty, empty, empty> type_vv_27;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, empty, empty, empty> type_vv_28;
+typedef std::tuple<std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_29;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, empty, empty, empty> type_vv_30;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_31;
+typedef std::tuple<std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_32;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_33;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_34;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_35;
+typedef std::tuple<std::vector<double>, var, double, empty, empty, empty> type_vv_36;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, empty, empty, empty> type_vv_37;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_38;
+typedef std::tuple<std::vector<double>, var, var, empty, empty, empty> type_vv_39;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, empty, empty, empty> type_vv_40;
+typedef std::tuple<std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_41;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, empty, empty, empty> type_vv_42;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_43;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_44;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, empty, empty, empty> type_vv_45;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_46;
+typedef std::tuple<std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_47;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_48;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_49;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_50;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_51;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_52;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_53;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_vv_54;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_vv_55;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_56;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_vv_57;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_58;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_59;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_60;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_61;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_62;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_vv_63;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_vv_64;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_65;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_vv_66;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_vv_67;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_68;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_vv_69;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_70;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_vv_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_80;
+typedef std::tuple<var, double, double, empty, empty, empty> type_vv_81;
+typedef std::tuple<var, double, std::vector<double>, empty, empty, empty> type_vv_82;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_83;
+typedef std::tuple<var, double, var, empty, empty, empty> type_vv_84;
+typedef std::tuple<var, double, std::vector<var>, empty, empty, empty> type_vv_85;
+typedef std::tuple<var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_86;
+typedef std::tuple<var, std::vector<double>, double, empty, empty, empty> type_vv_87;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_88;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_89;
+typedef std::tuple<var, std::vector<double>, var, empty, empty, empty> type_vv_90;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_91;
+typedef std::tuple<var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_92;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_93;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_94;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_95;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_96;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_97;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_98;
+typedef std::tuple<var, var, double, empty, empty, empty> type_vv_99;
+
+typedef std::tuple<AgradCcdfLogPareto, type_vv_0> AgradCcdfLogPareto_vv_0;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_1> AgradCcdfLogPareto_vv_1;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_2> AgradCcdfLogPareto_vv_2;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_3> AgradCcdfLogPareto_vv_3;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_4> AgradCcdfLogPareto_vv_4;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_5> AgradCcdfLogPareto_vv_5;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_6> AgradCcdfLogPareto_vv_6;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_7> AgradCcdfLogPareto_vv_7;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_8> AgradCcdfLogPareto_vv_8;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_9> AgradCcdfLogPareto_vv_9;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_10> AgradCcdfLogPareto_vv_10;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_11> AgradCcdfLogPareto_vv_11;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_12> AgradCcdfLogPareto_vv_12;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_13> AgradCcdfLogPareto_vv_13;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_14> AgradCcdfLogPareto_vv_14;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_15> AgradCcdfLogPareto_vv_15;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_16> AgradCcdfLogPareto_vv_16;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_17> AgradCcdfLogPareto_vv_17;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_18> AgradCcdfLogPareto_vv_18;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_19> AgradCcdfLogPareto_vv_19;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_20> AgradCcdfLogPareto_vv_20;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_21> AgradCcdfLogPareto_vv_21;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_22> AgradCcdfLogPareto_vv_22;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_23> AgradCcdfLogPareto_vv_23;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_24> AgradCcdfLogPareto_vv_24;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_25> AgradCcdfLogPareto_vv_25;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_26> AgradCcdfLogPareto_vv_26;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_27> AgradCcdfLogPareto_vv_27;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_28> AgradCcdfLogPareto_vv_28;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_29> AgradCcdfLogPareto_vv_29;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_30> AgradCcdfLogPareto_vv_30;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_31> AgradCcdfLogPareto_vv_31;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_32> AgradCcdfLogPareto_vv_32;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_33> AgradCcdfLogPareto_vv_33;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_34> AgradCcdfLogPareto_vv_34;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_35> AgradCcdfLogPareto_vv_35;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_36> AgradCcdfLogPareto_vv_36;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_37> AgradCcdfLogPareto_vv_37;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_38> AgradCcdfLogPareto_vv_38;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_39> AgradCcdfLogPareto_vv_39;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_40> AgradCcdfLogPareto_vv_40;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_41> AgradCcdfLogPareto_vv_41;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_42> AgradCcdfLogPareto_vv_42;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_43> AgradCcdfLogPareto_vv_43;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_44> AgradCcdfLogPareto_vv_44;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_45> AgradCcdfLogPareto_vv_45;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_46> AgradCcdfLogPareto_vv_46;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_47> AgradCcdfLogPareto_vv_47;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_48> AgradCcdfLogPareto_vv_48;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_49> AgradCcdfLogPareto_vv_49;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_50> AgradCcdfLogPareto_vv_50;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_51> AgradCcdfLogPareto_vv_51;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_52> AgradCcdfLogPareto_vv_52;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_53> AgradCcdfLogPareto_vv_53;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_54> AgradCcdfLogPareto_vv_54;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_55> AgradCcdfLogPareto_vv_55;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_56> AgradCcdfLogPareto_vv_56;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_57> AgradCcdfLogPareto_vv_57;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_58> AgradCcdfLogPareto_vv_58;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_59> AgradCcdfLogPareto_vv_59;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_60> AgradCcdfLogPareto_vv_60;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_61> AgradCcdfLogPareto_vv_61;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_62> AgradCcdfLogPareto_vv_62;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_63> AgradCcdfLogPareto_vv_63;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_64> AgradCcdfLogPareto_vv_64;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_65> AgradCcdfLogPareto_vv_65;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_66> AgradCcdfLogPareto_vv_66;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_67> AgradCcdfLogPareto_vv_67;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_68> AgradCcdfLogPareto_vv_68;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_69> AgradCcdfLogPareto_vv_69;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_70> AgradCcdfLogPareto_vv_70;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_71> AgradCcdfLogPareto_vv_71;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_72> AgradCcdfLogPareto_vv_72;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_73> AgradCcdfLogPareto_vv_73;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_74> AgradCcdfLogPareto_vv_74;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_75> AgradCcdfLogPareto_vv_75;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_76> AgradCcdfLogPareto_vv_76;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_77> AgradCcdfLogPareto_vv_77;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_78> AgradCcdfLogPareto_vv_78;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_79> AgradCcdfLogPareto_vv_79;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_80> AgradCcdfLogPareto_vv_80;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_81> AgradCcdfLogPareto_vv_81;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_82> AgradCcdfLogPareto_vv_82;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_83> AgradCcdfLogPareto_vv_83;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_84> AgradCcdfLogPareto_vv_84;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_85> AgradCcdfLogPareto_vv_85;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_86> AgradCcdfLogPareto_vv_86;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_87> AgradCcdfLogPareto_vv_87;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_88> AgradCcdfLogPareto_vv_88;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_89> AgradCcdfLogPareto_vv_89;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_90> AgradCcdfLogPareto_vv_90;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_91> AgradCcdfLogPareto_vv_91;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_92> AgradCcdfLogPareto_vv_92;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_93> AgradCcdfLogPareto_vv_93;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_94> AgradCcdfLogPareto_vv_94;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_95> AgradCcdfLogPareto_vv_95;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_96> AgradCcdfLogPareto_vv_96;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_97> AgradCcdfLogPareto_vv_97;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_98> AgradCcdfLogPareto_vv_98;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_99> AgradCcdfLogPareto_vv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_0, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_1, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_2, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_3, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_4, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_5, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_6, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_7, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_8, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_9, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_10, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_11, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_12, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_13, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_14, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_15, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_16, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_17, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_18, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_19, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_20, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_21, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_22, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_23, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_24, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_25, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_26, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_27, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_28, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_29, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_30, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_31, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_32, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_33, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_34, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_35, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_36, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_37, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_38, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_39, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_40, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_41, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_42, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_43, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_44, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_45, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_46, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_47, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_48, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_49, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_50, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_51, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_52, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_53, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_54, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_55, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_56, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_57, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_58, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_59, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_60, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_61, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_62, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_63, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_64, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_65, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_66, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_67, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_68, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_69, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_70, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_71, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_72, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_73, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_74, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_75, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_76, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_77, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_78, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_79, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_80, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_81, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_82, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_83, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_84, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_85, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_86, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_87, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_88, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_89, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_90, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_91, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_92, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_93, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_94, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_95, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_96, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_97, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_98, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_99, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_99);
+
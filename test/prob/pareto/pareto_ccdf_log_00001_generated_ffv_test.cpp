@@ -0,0 +1,278 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto/pareto_ccdf_log_test.hpp>
+
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_100;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_101;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_102;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_103;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_104;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_105;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_106;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_107;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_108;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_109;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_110;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_111;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_112;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_113;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_114;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_115;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_116;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, double, empty, empty, empty> type_ffv_117;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty, empty, empty> type_ffv_118;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_119;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_120;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_121;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_122;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty, empty, empty> type_ffv_123;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_124;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_125;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_126;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_127;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_128;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_129;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_130;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_131;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_132;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_133;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_134;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_135;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_136;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_137;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_138;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_139;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_140;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_141;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_142;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_143;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_144;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_145;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_146;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_147;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_148;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_149;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_150;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_151;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_152;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_ffv_153;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_ffv_154;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_155;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_156;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_157;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_158;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_ffv_159;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_160;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_161;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_162;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_163;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_164;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_165;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_166;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_167;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_168;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_169;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_170;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_171;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_172;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_173;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_174;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_175;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_176;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_177;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_178;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_179;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_180;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_181;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_182;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_183;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_184;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_185;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_186;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_187;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_188;
+
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_100> AgradCcdfLogPareto_ffv_100;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_101> AgradCcdfLogPareto_ffv_101;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_102> AgradCcdfLogPareto_ffv_102;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_103> AgradCcdfLogPareto_ffv_103;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_104> AgradCcdfLogPareto_ffv_104;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_105> AgradCcdfLogPareto_ffv_105;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_106> AgradCcdfLogPareto_ffv_106;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_107> AgradCcdfLogPareto_ffv_107;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_108> AgradCcdfLogPareto_ffv_108;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_109> AgradCcdfLogPareto_ffv_109;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_110> AgradCcdfLogPareto_ffv_110;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_111> AgradCcdfLogPareto_ffv_111;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_112> AgradCcdfLogPareto_ffv_112;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_113> AgradCcdfLogPareto_ffv_113;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_114> AgradCcdfLogPareto_ffv_114;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_115> AgradCcdfLogPareto_ffv_115;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_116> AgradCcdfLogPareto_ffv_116;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_117> AgradCcdfLogPareto_ffv_117;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_118> AgradCcdfLogPareto_ffv_118;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_119> AgradCcdfLogPareto_ffv_119;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_120> AgradCcdfLogPareto_ffv_120;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_121> AgradCcdfLogPareto_ffv_121;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_122> AgradCcdfLogPareto_ffv_122;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_123> AgradCcdfLogPareto_ffv_123;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_124> AgradCcdfLogPareto_ffv_124;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_125> AgradCcdfLogPareto_ffv_125;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_126> AgradCcdfLogPareto_ffv_126;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_127> AgradCcdfLogPareto_ffv_127;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_128> AgradCcdfLogPareto_ffv_128;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_129> AgradCcdfLogPareto_ffv_129;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_130> AgradCcdfLogPareto_ffv_130;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_131> AgradCcdfLogPareto_ffv_131;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_132> AgradCcdfLogPareto_ffv_132;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_133> AgradCcdfLogPareto_ffv_133;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_134> AgradCcdfLogPareto_ffv_134;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_135> AgradCcdfLogPareto_ffv_135;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_136> AgradCcdfLogPareto_ffv_136;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_137> AgradCcdfLogPareto_ffv_137;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_138> AgradCcdfLogPareto_ffv_138;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_139> AgradCcdfLogPareto_ffv_139;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_140> AgradCcdfLogPareto_ffv_140;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_141> AgradCcdfLogPareto_ffv_141;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_142> AgradCcdfLogPareto_ffv_142;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_143> AgradCcdfLogPareto_ffv_143;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_144> AgradCcdfLogPareto_ffv_144;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_145> AgradCcdfLogPareto_ffv_145;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_146> AgradCcdfLogPareto_ffv_146;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_147> AgradCcdfLogPareto_ffv_147;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_148> AgradCcdfLogPareto_ffv_148;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_149> AgradCcdfLogPareto_ffv_149;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_150> AgradCcdfLogPareto_ffv_150;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_151> AgradCcdfLogPareto_ffv_151;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_152> AgradCcdfLogPareto_ffv_152;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_153> AgradCcdfLogPareto_ffv_153;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_154> AgradCcdfLogPareto_ffv_154;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_155> AgradCcdfLogPareto_ffv_155;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_156> AgradCcdfLogPareto_ffv_156;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_157> AgradCcdfLogPareto_ffv_157;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_158> AgradCcdfLogPareto_ffv_158;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_159> AgradCcdfLogPareto_ffv_159;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_160> AgradCcdfLogPareto_ffv_160;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_161> AgradCcdfLogPareto_ffv_161;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_162> AgradCcdfLogPareto_ffv_162;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_163> AgradCcdfLogPareto_ffv_163;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_164> AgradCcdfLogPareto_ffv_164;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_165> AgradCcdfLogPareto_ffv_165;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_166> AgradCcdfLogPareto_ffv_166;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_167> AgradCcdfLogPareto_ffv_167;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_168> AgradCcdfLogPareto_ffv_168;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_169> AgradCcdfLogPareto_ffv_169;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_170> AgradCcdfLogPareto_ffv_170;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_171> AgradCcdfLogPareto_ffv_171;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_172> AgradCcdfLogPareto_ffv_172;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_173> AgradCcdfLogPareto_ffv_173;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_174> AgradCcdfLogPareto_ffv_174;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_175> AgradCcdfLogPareto_ffv_175;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_176> AgradCcdfLogPareto_ffv_176;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_177> AgradCcdfLogPareto_ffv_177;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_178> AgradCcdfLogPareto_ffv_178;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_179> AgradCcdfLogPareto_ffv_179;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_180> AgradCcdfLogPareto_ffv_180;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_181> AgradCcdfLogPareto_ffv_181;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_182> AgradCcdfLogPareto_ffv_182;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_183> AgradCcdfLogPareto_ffv_183;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_184> AgradCcdfLogPareto_ffv_184;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_185> AgradCcdfLogPareto_ffv_185;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_186> AgradCcdfLogPareto_ffv_186;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_187> AgradCcdfLogPareto_ffv_187;
+typedef std::tuple<AgradCcdfLogPareto, type_ffv_188> AgradCcdfLogPareto_ffv_188;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_100, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_101, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_102, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_103, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_104, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_105, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_106, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_107, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_108, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_109, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_110, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_111, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_112, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_113, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_114, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_115, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_116, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_117, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_118, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_119, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_120, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_121, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_122, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_123, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_124, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_125, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_126, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_127, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_128, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_129, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_130, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_131, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_132, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_133, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_134, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_135, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_136, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_137, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_138, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_139, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_140, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_141, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_142, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_143, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_144, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_145, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_146, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_147, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_148, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_149, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_150, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_151, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_152, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_153, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_154, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_155, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_156, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_157, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_158, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_159, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_160, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_161, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_162, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_163, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_164, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_165, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_166, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_167, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_168, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_169, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_170, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_171, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_172, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_173, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_174, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_175, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_176, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_177, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_178, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_179, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_180, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_181, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_182, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_183, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_184, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_185, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_186, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_187, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_ffv_188, AgradCcdfLogTestFixture, AgradCcdfLogPareto_ffv_188);
+
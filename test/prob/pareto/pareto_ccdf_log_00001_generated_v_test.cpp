@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto/pareto_ccdf_log_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_100;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_101;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_102;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_103;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_104;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_105;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_106;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_107;
+typedef std::tuple<var, double, double, empty, empty, empty> type_v_108;
+typedef std::tuple<var, double, std::vector<double>, empty, empty, empty> type_v_109;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_110;
+typedef std::tuple<var, double, var, empty, empty, empty> type_v_111;
+typedef std::tuple<var, double, std::vector<var>, empty, empty, empty> type_v_112;
+typedef std::tuple<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_113;
+typedef std::tuple<var, std::vector<double>, double, empty, empty, empty> type_v_114;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_115;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_116;
+typedef std::tuple<var, std::vector<double>, var, empty, empty, empty> type_v_117;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_118;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_119;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_120;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_121;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_122;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_123;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_124;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_125;
+typedef std::tuple<var, var, double, empty, empty, empty> type_v_126;
+typedef std::tuple<var, var, std::vector<double>, empty, empty, empty> type_v_127;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_128;
+typedef std::tuple<var, var, var, empty, empty, empty> type_v_129;
+typedef std::tuple<var, var, std::vector<var>, empty, empty, empty> type_v_130;
+typedef std::tuple<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_131;
+typedef std::tuple<var, std::vector<var>, double, empty, empty, empty> type_v_132;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_133;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_134;
+typedef std::tuple<var, std::vector<var>, var, empty, empty, empty> type_v_135;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_136;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_137;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_138;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_139;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_140;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_141;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_142;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_143;
+typedef std::tuple<std::vector<var>, double, double, empty, empty, empty> type_v_144;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, empty, empty, empty> type_v_145;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_146;
+typedef std::tuple<std::vector<var>, double, var, empty, empty, empty> type_v_147;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, empty, empty, empty> type_v_148;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_149;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, empty, empty, empty> type_v_150;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_151;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_152;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, empty, empty, empty> type_v_153;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_154;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_155;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_156;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_157;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_158;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_159;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_160;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_161;
+typedef std::tuple<std::vector<var>, var, double, empty, empty, empty> type_v_162;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, empty, empty, empty> type_v_163;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_164;
+typedef std::tuple<std::vector<var>, var, var, empty, empty, empty> type_v_165;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, empty, empty, empty> type_v_166;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_167;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, empty, empty, empty> type_v_168;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_169;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_170;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, empty, empty, empty> type_v_171;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_172;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_173;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_174;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_175;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_176;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_177;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_178;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_179;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_v_180;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_v_181;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_182;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_v_183;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_v_184;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_185;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_v_186;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_187;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_188;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_v_189;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_190;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_191;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_192;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_193;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_194;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_195;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_196;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_197;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_v_198;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_v_199;
+
+typedef std::tuple<AgradCcdfLogPareto, type_v_100> AgradCcdfLogPareto_v_100;
+typedef std::tuple<AgradCcdfLogPareto, type_v_101> AgradCcdfLogPareto_v_101;
+typedef std::tuple<AgradCcdfLogPareto, type_v_102> AgradCcdfLogPareto_v_102;
+typedef std::tuple<AgradCcdfLogPareto, type_v_103> AgradCcdfLogPareto_v_103;
+typedef std::tuple<AgradCcdfLogPareto, type_v_104> AgradCcdfLogPareto_v_104;
+typedef std::tuple<AgradCcdfLogPareto, type_v_105> AgradCcdfLogPareto_v_105;
+typedef std::tuple<AgradCcdfLogPareto, type_v_106> AgradCcdfLogPareto_v_106;
+typedef std::tuple<AgradCcdfLogPareto, type_v_107> AgradCcdfLogPareto_v_107;
+typedef std::tuple<AgradCcdfLogPareto, type_v_108> AgradCcdfLogPareto_v_108;
+typedef std::tuple<AgradCcdfLogPareto, type_v_109> AgradCcdfLogPareto_v_109;
+typedef std::tuple<AgradCcdfLogPareto, type_v_110> AgradCcdfLogPareto_v_110;
+typedef std::tuple<AgradCcdfLogPareto, type_v_111> AgradCcdfLogPareto_v_111;
+typedef std::tuple<AgradCcdfLogPareto, type_v_112> AgradCcdfLogPareto_v_112;
+typedef std::tuple<AgradCcdfLogPareto, type_v_113> AgradCcdfLogPareto_v_113;
+typedef std::tuple<AgradCcdfLogPareto, type_v_114> AgradCcdfLogPareto_v_114;
+typedef std::tuple<AgradCcdfLogPareto, type_v_115> AgradCcdfLogPareto_v_115;
+typedef std::tuple<AgradCcdfLogPareto, type_v_116> AgradCcdfLogPareto_v_116;
+typedef std::tuple<AgradCcdfLogPareto, type_v_117> AgradCcdfLogPareto_v_117;
+typedef std::tuple<AgradCcdfLogPareto, type_v_118> AgradCcdfLogPareto_v_118;
+typedef std::tuple<AgradCcdfLogPareto, type_v_119> AgradCcdfLogPareto_v_119;
+typedef std::tuple<AgradCcdfLogPareto, type_v_120> AgradCcdfLogPareto_v_120;
+typedef std::tuple<AgradCcdfLogPareto, type_v_121> AgradCcdfLogPareto_v_121;
+typedef std::tuple<AgradCcdfLogPareto, type_v_122> AgradCcdfLogPareto_v_122;
+typedef std::tuple<AgradCcdfLogPareto, type_v_123> AgradCcdfLogPareto_v_123;
+typedef std::tuple<AgradCcdfLogPareto, type_v_124> AgradCcdfLogPareto_v_124;
+typedef std::tuple<AgradCcdfLogPareto, type_v_125> AgradCcdfLogPareto_v_125;
+typedef std::tuple<AgradCcdfLogPareto, type_v_126> AgradCcdfLogPareto_v_126;
+typedef std::tuple<AgradCcdfLogPareto, type_v_127> AgradCcdfLogPareto_v_127;
+typedef std::tuple<AgradCcdfLogPareto, type_v_128> AgradCcdfLogPareto_v_128;
+typedef std::tuple<AgradCcdfLogPareto, type_v_129> AgradCcdfLogPareto_v_129;
+typedef std::tuple<AgradCcdfLogPareto, type_v_130> AgradCcdfLogPareto_v_130;
+typedef std::tuple<AgradCcdfLogPareto, type_v_131> AgradCcdfLogPareto_v_131;
+typedef std::tuple<AgradCcdfLogPareto, type_v_132> AgradCcdfLogPareto_v_132;
+typedef std::tuple<AgradCcdfLogPareto, type_v_133> AgradCcdfLogPareto_v_133;
+typedef std::tuple<AgradCcdfLogPareto, type_v_134> AgradCcdfLogPareto_v_134;
+typedef std::tuple<AgradCcdfLogPareto, type_v_135> AgradCcdfLogPareto_v_135;
+typedef std::tuple<AgradCcdfLogPareto, type_v_136> AgradCcdfLogPareto_v_136;
+typedef std::tuple<AgradCcdfLogPareto, type_v_137> AgradCcdfLogPareto_v_137;
+typedef std::tuple<AgradCcdfLogPareto, type_v_138> AgradCcdfLogPareto_v_138;
+typedef std::tuple<AgradCcdfLogPareto, type_v_139> AgradCcdfLogPareto_v_139;
+typedef std::tuple<AgradCcdfLogPareto, type_v_140> AgradCcdfLogPareto_v_140;
+typedef std::tuple<AgradCcdfLogPareto, type_v_141> AgradCcdfLogPareto_v_141;
+typedef std::tuple<AgradCcdfLogPareto, type_v_142> AgradCcdfLogPareto_v_142;
+typedef std::tuple<AgradCcdfLogPareto, type_v_143> AgradCcdfLogPareto_v_143;
+typedef std::tuple<AgradCcdfLogPareto, type_v_144> AgradCcdfLogPareto_v_144;
+typedef std::tuple<AgradCcdfLogPareto, type_v_145> AgradCcdfLogPareto_v_145;
+typedef std::tuple<AgradCcdfLogPareto, type_v_146> AgradCcdfLogPareto_v_146;
+typedef std::tuple<AgradCcdfLogPareto, type_v_147> AgradCcdfLogPareto_v_147;
+typedef std::tuple<AgradCcdfLogPareto, type_v_148> AgradCcdfLogPareto_v_148;
+typedef std::tuple<AgradCcdfLogPareto, type_v_149> AgradCcdfLogPareto_v_149;
+typedef std::tuple<AgradCcdfLogPareto, type_v_150> AgradCcdfLogPareto_v_150;
+typedef std::tuple<AgradCcdfLogPareto, type_v_151> AgradCcdfLogPareto_v_151;
+typedef std::tuple<AgradCcdfLogPareto, type_v_152> AgradCcdfLogPareto_v_152;
+typedef std::tuple<AgradCcdfLogPareto, type_v_153> AgradCcdfLogPareto_v_153;
+typedef std::tuple<AgradCcdfLogPareto, type_v_154> AgradCcdfLogPareto_v_154;
+typedef std::tuple<AgradCcdfLogPareto, type_v_155> AgradCcdfLogPareto_v_155;
+typedef std::tuple<AgradCcdfLogPareto, type_v_156> AgradCcdfLogPareto_v_156;
+typedef std::tuple<AgradCcdfLogPareto, type_v_157> AgradCcdfLogPareto_v_157;
+typedef std::tuple<AgradCcdfLogPareto, type_v_158> AgradCcdfLogPareto_v_158;
+typedef std::tuple<AgradCcdfLogPareto, type_v_159> AgradCcdfLogPareto_v_159;
+typedef std::tuple<AgradCcdfLogPareto, type_v_160> AgradCcdfLogPareto_v_160;
+typedef std::tuple<AgradCcdfLogPareto, type_v_161> AgradCcdfLogPareto_v_161;
+typedef std::tuple<AgradCcdfLogPareto, type_v_162> AgradCcdfLogPareto_v_162;
+typedef std::tuple<AgradCcdfLogPareto, type_v_163> AgradCcdfLogPareto_v_163;
+typedef std::tuple<AgradCcdfLogPareto, type_v_164> AgradCcdfLogPareto_v_164;
+typedef std::tuple<AgradCcdfLogPareto, type_v_165> AgradCcdfLogPareto_v_165;
+typedef std::tuple<AgradCcdfLogPareto, type_v_166> AgradCcdfLogPareto_v_166;
+typedef std::tuple<AgradCcdfLogPareto, type_v_167> AgradCcdfLogPareto_v_167;
+typedef std::tuple<AgradCcdfLogPareto, type_v_168> AgradCcdfLogPareto_v_168;
+typedef std::tuple<AgradCcdfLogPareto, type_v_169> AgradCcdfLogPareto_v_169;
+typedef std::tuple<AgradCcdfLogPareto, type_v_170> AgradCcdfLogPareto_v_170;
+typedef std::tuple<AgradCcdfLogPareto, type_v_171> AgradCcdfLogPareto_v_171;
+typedef std::tuple<AgradCcdfLogPareto, type_v_172> AgradCcdfLogPareto_v_172;
+typedef std::tuple<AgradCcdfLogPareto, type_v_173> AgradCcdfLogPareto_v_173;
+typedef std::tuple<AgradCcdfLogPareto, type_v_174> AgradCcdfLogPareto_v_174;
+typedef std::tuple<AgradCcdfLogPareto, type_v_175> AgradCcdfLogPareto_v_175;
+typedef std::tuple<AgradCcdfLogPareto, type_v_176> AgradCcdfLogPareto_v_176;
+typedef std::tuple<AgradCcdfLogPareto, type_v_177> AgradCcdfLogPareto_v_177;
+typedef std::tuple<AgradCcdfLogPareto, type_v_178> AgradCcdfLogPareto_v_178;
+typedef std::tuple<AgradCcdfLogPareto, type_v_179> AgradCcdfLogPareto_v_179;
+typedef std::tuple<AgradCcdfLogPareto, type_v_180> AgradCcdfLogPareto_v_180;
+typedef std::tuple<AgradCcdfLogPareto, type_v_181> AgradCcdfLogPareto_v_181;
+typedef std::tuple<AgradCcdfLogPareto, type_v_182> AgradCcdfLogPareto_v_182;
+typedef std::tuple<AgradCcdfLogPareto, type_v_183> AgradCcdfLogPareto_v_183;
+typedef std::tuple<AgradCcdfLogPareto, type_v_184> AgradCcdfLogPareto_v_184;
+typedef std::tuple<AgradCcdfLogPareto, type_v_185> AgradCcdfLogPareto_v_185;
+typedef std::tuple<AgradCcdfLogPareto, type_v_186> AgradCcdfLogPareto_v_186;
+typedef std::tuple<AgradCcdfLogPareto, type_v_187> AgradCcdfLogPareto_v_187;
+typedef std::tuple<AgradCcdfLogPareto, type_v_188> AgradCcdfLogPareto_v_188;
+typedef std::tuple<AgradCcdfLogPareto, type_v_189> AgradCcdfLogPareto_v_189;
+typedef std::tuple<AgradCcdfLogPareto, type_v_190> AgradCcdfLogPareto_v_190;
+typedef std::tuple<AgradCcdfLogPareto, type_v_191> AgradCcdfLogPareto_v_191;
+typedef std::tuple<AgradCcdfLogPareto, type_v_192> AgradCcdfLogPareto_v_192;
+typedef std::tuple<AgradCcdfLogPareto, type_v_193> AgradCcdfLogPareto_v_193;
+typedef std::tuple<AgradCcdfLogPareto, type_v_194> AgradCcdfLogPareto_v_194;
+typedef std::tuple<AgradCcdfLogPareto, type_v_195> AgradCcdfLogPareto_v_195;
+typedef std::tuple<AgradCcdfLogPareto, type_v_196> AgradCcdfLogPareto_v_196;
+typedef std::tuple<AgradCcdfLogPareto, type_v_197> AgradCcdfLogPareto_v_197;
+typedef std::tuple<AgradCcdfLogPareto, type_v_198> AgradCcdfLogPareto_v_198;
+typedef std::tuple<AgradCcdfLogPareto, type_v_199> AgradCcdfLogPareto_v_199;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_100, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_101, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_102, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_103, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_104, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_105, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_106, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_107, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_108, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_109, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_110, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_111, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_112, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_113, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_114, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_115, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_116, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_117, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_118, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_119, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_120, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_121, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_122, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_123, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_124, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_125, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_126, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_127, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_128, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_129, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_130, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_131, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_132, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_133, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_134, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_135, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_136, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_137, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_138, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_139, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_140, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_141, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_142, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_143, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_144, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_145, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_146, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_147, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_148, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_149, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_150, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_151, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_152, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_153, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_154, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_155, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_156, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_157, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_158, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_159, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_160, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_161, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_162, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_163, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_164, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_165, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_166, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_167, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_168, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_169, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_170, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_171, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_172, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_173, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_174, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_175, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_176, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_177, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_178, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_179, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_180, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_181, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_182, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_183, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_184, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_185, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_186, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_187, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_188, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_188);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_189, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_189);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_190, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_190);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_191, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_191);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_192, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_192);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_193, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_193);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_194, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_194);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_195, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_195);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_196, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_196);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_197, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_197);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_198, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_198);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_199, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_199);
+
@@ -0,0 +1,278 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto/pareto_ccdf_log_test.hpp>
+
+typedef std::tuple<var, var, std::vector<double>, empty, empty, empty> type_vv_100;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_101;
+typedef std::tuple<var, var, var, empty, empty, empty> type_vv_102;
+typedef std::tuple<var, var, std::vector<var>, empty, empty, empty> type_vv_103;
+typedef std::tuple<var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_104;
+typedef std::tuple<var, std::vector<var>, double, empty, empty, empty> type_vv_105;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_106;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_107;
+typedef std::tuple<var, std::vector<var>, var, empty, empty, empty> type_vv_108;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_109;
+typedef std::tuple<var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_110;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_111;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_112;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_113;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_114;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_115;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_116;
+typedef std::tuple<std::vector<var>, double, double, empty, empty, empty> type_vv_117;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, empty, empty, empty> type_vv_118;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_119;
+typedef std::tuple<std::vector<var>, double, var, empty, empty, empty> type_vv_120;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, empty, empty, empty> type_vv_121;
+typedef std::tuple<std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_122;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, empty, empty, empty> type_vv_123;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_124;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_125;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, empty, empty, empty> type_vv_126;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_127;
+typedef std::tuple<std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_128;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_129;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_130;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_131;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_132;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_133;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_134;
+typedef std::tuple<std::vector<var>, var, double, empty, empty, empty> type_vv_135;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, empty, empty, empty> type_vv_136;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_137;
+typedef std::tuple<std::vector<var>, var, var, empty, empty, empty> type_vv_138;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, empty, empty, empty> type_vv_139;
+typedef std::tuple<std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_140;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, empty, empty, empty> type_vv_141;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_142;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_143;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, empty, empty, empty> type_vv_144;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_145;
+typedef std::tuple<std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_146;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_147;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_148;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_149;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_150;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_151;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_152;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, empty, empty, empty> type_vv_153;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, empty, empty, empty> type_vv_154;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_155;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, empty, empty, empty> type_vv_156;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, empty, empty, empty> type_vv_157;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_158;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, empty, empty, empty> type_vv_159;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_160;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_161;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, empty, empty, empty> type_vv_162;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_163;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_164;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_165;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_166;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_167;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_168;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_169;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_170;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, empty, empty, empty> type_vv_171;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, empty, empty, empty> type_vv_172;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_173;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, empty, empty, empty> type_vv_174;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, empty, empty, empty> type_vv_175;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_176;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, empty, empty, empty> type_vv_177;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_178;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_179;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, empty, empty, empty> type_vv_180;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_181;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_182;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_183;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_184;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_185;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_186;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_187;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_188;
+
+typedef std::tuple<AgradCcdfLogPareto, type_vv_100> AgradCcdfLogPareto_vv_100;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_101> AgradCcdfLogPareto_vv_101;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_102> AgradCcdfLogPareto_vv_102;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_103> AgradCcdfLogPareto_vv_103;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_104> AgradCcdfLogPareto_vv_104;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_105> AgradCcdfLogPareto_vv_105;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_106> AgradCcdfLogPareto_vv_106;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_107> AgradCcdfLogPareto_vv_107;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_108> AgradCcdfLogPareto_vv_108;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_109> AgradCcdfLogPareto_vv_109;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_110> AgradCcdfLogPareto_vv_110;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_111> AgradCcdfLogPareto_vv_111;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_112> AgradCcdfLogPareto_vv_112;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_113> AgradCcdfLogPareto_vv_113;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_114> AgradCcdfLogPareto_vv_114;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_115> AgradCcdfLogPareto_vv_115;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_116> AgradCcdfLogPareto_vv_116;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_117> AgradCcdfLogPareto_vv_117;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_118> AgradCcdfLogPareto_vv_118;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_119> AgradCcdfLogPareto_vv_119;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_120> AgradCcdfLogPareto_vv_120;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_121> AgradCcdfLogPareto_vv_121;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_122> AgradCcdfLogPareto_vv_122;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_123> AgradCcdfLogPareto_vv_123;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_124> AgradCcdfLogPareto_vv_124;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_125> AgradCcdfLogPareto_vv_125;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_126> AgradCcdfLogPareto_vv_126;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_127> AgradCcdfLogPareto_vv_127;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_128> AgradCcdfLogPareto_vv_128;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_129> AgradCcdfLogPareto_vv_129;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_130> AgradCcdfLogPareto_vv_130;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_131> AgradCcdfLogPareto_vv_131;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_132> AgradCcdfLogPareto_vv_132;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_133> AgradCcdfLogPareto_vv_133;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_134> AgradCcdfLogPareto_vv_134;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_135> AgradCcdfLogPareto_vv_135;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_136> AgradCcdfLogPareto_vv_136;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_137> AgradCcdfLogPareto_vv_137;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_138> AgradCcdfLogPareto_vv_138;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_139> AgradCcdfLogPareto_vv_139;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_140> AgradCcdfLogPareto_vv_140;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_141> AgradCcdfLogPareto_vv_141;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_142> AgradCcdfLogPareto_vv_142;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_143> AgradCcdfLogPareto_vv_143;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_144> AgradCcdfLogPareto_vv_144;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_145> AgradCcdfLogPareto_vv_145;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_146> AgradCcdfLogPareto_vv_146;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_147> AgradCcdfLogPareto_vv_147;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_148> AgradCcdfLogPareto_vv_148;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_149> AgradCcdfLogPareto_vv_149;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_150> AgradCcdfLogPareto_vv_150;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_151> AgradCcdfLogPareto_vv_151;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_152> AgradCcdfLogPareto_vv_152;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_153> AgradCcdfLogPareto_vv_153;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_154> AgradCcdfLogPareto_vv_154;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_155> AgradCcdfLogPareto_vv_155;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_156> AgradCcdfLogPareto_vv_156;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_157> AgradCcdfLogPareto_vv_157;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_158> AgradCcdfLogPareto_vv_158;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_159> AgradCcdfLogPareto_vv_159;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_160> AgradCcdfLogPareto_vv_160;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_161> AgradCcdfLogPareto_vv_161;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_162> AgradCcdfLogPareto_vv_162;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_163> AgradCcdfLogPareto_vv_163;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_164> AgradCcdfLogPareto_vv_164;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_165> AgradCcdfLogPareto_vv_165;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_166> AgradCcdfLogPareto_vv_166;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_167> AgradCcdfLogPareto_vv_167;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_168> AgradCcdfLogPareto_vv_168;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_169> AgradCcdfLogPareto_vv_169;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_170> AgradCcdfLogPareto_vv_170;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_171> AgradCcdfLogPareto_vv_171;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_172> AgradCcdfLogPareto_vv_172;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_173> AgradCcdfLogPareto_vv_173;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_174> AgradCcdfLogPareto_vv_174;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_175> AgradCcdfLogPareto_vv_175;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_176> AgradCcdfLogPareto_vv_176;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_177> AgradCcdfLogPareto_vv_177;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_178> AgradCcdfLogPareto_vv_178;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_179> AgradCcdfLogPareto_vv_179;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_180> AgradCcdfLogPareto_vv_180;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_181> AgradCcdfLogPareto_vv_181;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_182> AgradCcdfLogPareto_vv_182;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_183> AgradCcdfLogPareto_vv_183;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_184> AgradCcdfLogPareto_vv_184;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_185> AgradCcdfLogPareto_vv_185;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_186> AgradCcdfLogPareto_vv_186;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_187> AgradCcdfLogPareto_vv_187;
+typedef std::tuple<AgradCcdfLogPareto, type_vv_188> AgradCcdfLogPareto_vv_188;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_100, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_101, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_102, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_103, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_104, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_105, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_106, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_107, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_108, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_109, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_110, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_111, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_112, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_113, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_114, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_115, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_116, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_117, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_118, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_119, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_120, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_121, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_122, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_123, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_124, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_125, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_126, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_127, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_128, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_129, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_130, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_131, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_132, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_133, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_134, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_135, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_136, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_137, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_138, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_139, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_140, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_141, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_142, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_143, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_144, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_145, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_146, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_147, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_148, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_149, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_150, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_151, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_152, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_153, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_154, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_155, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_156, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_157, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_158, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_159, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_160, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_161, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_162, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_163, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_164, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_165, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_166, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_167, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_168, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_169, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_170, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_171, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_172, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_173, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_174, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_175, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_176, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_177, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_178, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_179, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_180, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_181, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_182, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_183, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_184, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_185, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_186, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_187, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_vv_188, AgradCcdfLogTestFixture, AgradCcdfLogPareto_vv_188);
+
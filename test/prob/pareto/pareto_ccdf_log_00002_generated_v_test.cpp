@@ -0,0 +1,59 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto/pareto_ccdf_log_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_200;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_v_201;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_v_202;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_203;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_v_204;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_205;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_206;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_v_207;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_208;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_209;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_210;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_211;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_212;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_213;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_214;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_215;
+
+typedef std::tuple<AgradCcdfLogPareto, type_v_200> AgradCcdfLogPareto_v_200;
+typedef std::tuple<AgradCcdfLogPareto, type_v_201> AgradCcdfLogPareto_v_201;
+typedef std::tuple<AgradCcdfLogPareto, type_v_202> AgradCcdfLogPareto_v_202;
+typedef std::tuple<AgradCcdfLogPareto, type_v_203> AgradCcdfLogPareto_v_203;
+typedef std::tuple<AgradCcdfLogPareto, type_v_204> AgradCcdfLogPareto_v_204;
+typedef std::tuple<AgradCcdfLogPareto, type_v_205> AgradCcdfLogPareto_v_205;
+typedef std::tuple<AgradCcdfLogPareto, type_v_206> AgradCcdfLogPareto_v_206;
+typedef std::tuple<AgradCcdfLogPareto, type_v_207> AgradCcdfLogPareto_v_207;
+typedef std::tuple<AgradCcdfLogPareto, type_v_208> AgradCcdfLogPareto_v_208;
+typedef std::tuple<AgradCcdfLogPareto, type_v_209> AgradCcdfLogPareto_v_209;
+typedef std::tuple<AgradCcdfLogPareto, type_v_210> AgradCcdfLogPareto_v_210;
+typedef std::tuple<AgradCcdfLogPareto, type_v_211> AgradCcdfLogPareto_v_211;
+typedef std::tuple<AgradCcdfLogPareto, type_v_212> AgradCcdfLogPareto_v_212;
+typedef std::tuple<AgradCcdfLogPareto, type_v_213> AgradCcdfLogPareto_v_213;
+typedef std::tuple<AgradCcdfLogPareto, type_v_214> AgradCcdfLogPareto_v_214;
+typedef std::tuple<AgradCcdfLogPareto, type_v_215> AgradCcdfLogPareto_v_215;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_200, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_200);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_201, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_201);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_202, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_202);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_203, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_203);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_204, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_204);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_205, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_205);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_206, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_206);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_207, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_207);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_208, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_208);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_209, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_209);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_210, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_210);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_211, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_211);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_212, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_212);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_213, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_213);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_214, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_214);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPareto_v_215, AgradCcdfLogTestFixture, AgradCcdfLogPareto_v_215);
+
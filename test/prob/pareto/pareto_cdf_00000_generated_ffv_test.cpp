@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto/pareto_cdf_test.hpp>
+
+typedef std::tuple<double, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_0;
+typedef std::tuple<double, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_1;
+typedef std::tuple<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_2;
+typedef std::tuple<double, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_3;
+typedef std::tuple<double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_4;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_5;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_6;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_7;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_8;
+typedef std::tuple<double, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_9;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_10;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_11;
+typedef std::tuple<double, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_12;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_13;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_14;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_15;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_16;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_17;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_18;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_19;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_20;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_21;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_22;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_23;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_24;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_25;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_26;
+typedef std::tuple<std::vector<double>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_27;
+typedef std::tuple<std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_28;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_29;
+typedef std::tuple<std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_30;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_31;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_32;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_33;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_34;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_35;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_36;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_37;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_38;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_39;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_40;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_41;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_42;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_43;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_44;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_45;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_46;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_47;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_48;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_49;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_50;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_51;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_52;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_53;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_54;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_55;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_56;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_57;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_58;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_59;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_60;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_61;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_62;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_63;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_64;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_65;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_66;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_67;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_68;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_69;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_70;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_80;
+typedef std::tuple<fvar<fvar<var> >, double, double, empty, empty, empty> type_ffv_81;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<double>, empty, empty, empty> type_ffv_82;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_83;
+typedef std::tuple<fvar<fvar<var> >, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_84;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_85;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_86;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, double, empty, empty, empty> type_ffv_87;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_88;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_89;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_90;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_91;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_92;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_93;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_94;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_95;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_96;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_97;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_98;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_99;
+
+typedef std::tuple<AgradCdfPareto, type_ffv_0> AgradCdfPareto_ffv_0;
+typedef std::tuple<AgradCdfPareto, type_ffv_1> AgradCdfPareto_ffv_1;
+typedef std::tuple<AgradCdfPareto, type_ffv_2> AgradCdfPareto_ffv_2;
+typedef std::tuple<AgradCdfPareto, type_ffv_3> AgradCdfPareto_ffv_3;
+typedef std::tuple<AgradCdfPareto, type_ffv_4> AgradCdfPareto_ffv_4;
+typedef std::tuple<AgradCdfPareto, type_ffv_5> AgradCdfPareto_ffv_5;
+typedef std::tuple<AgradCdfPareto, type_ffv_6> AgradCdfPareto_ffv_6;
+typedef std::tuple<AgradCdfPareto, type_ffv_7> AgradCdfPareto_ffv_7;
+typedef std::tuple<AgradCdfPareto, type_ffv_8> AgradCdfPareto_ffv_8;
+typedef std::tuple<AgradCdfPareto, type_ffv_9> AgradCdfPareto_ffv_9;
+typedef std::tuple<AgradCdfPareto, type_ffv_10> AgradCdfPareto_ffv_10;
+typedef std::tuple<AgradCdfPareto, type_ffv_11> AgradCdfPareto_ffv_11;
+typedef std::tuple<AgradCdfPareto, type_ffv_12> AgradCdfPareto_ffv_12;
+typedef std::tuple<AgradCdfPareto, type_ffv_13> AgradCdfPareto_ffv_13;
+typedef std::tuple<AgradCdfPareto, type_ffv_14> AgradCdfPareto_ffv_14;
+typedef std::tuple<AgradCdfPareto, type_ffv_15> AgradCdfPareto_ffv_15;
+typedef std::tuple<AgradCdfPareto, type_ffv_16> AgradCdfPareto_ffv_16;
+typedef std::tuple<AgradCdfPareto, type_ffv_17> AgradCdfPareto_ffv_17;
+typedef std::tuple<AgradCdfPareto, type_ffv_18> AgradCdfPareto_ffv_18;
+typedef std::tuple<AgradCdfPareto, type_ffv_19> AgradCdfPareto_ffv_19;
+typedef std::tuple<AgradCdfPareto, type_ffv_20> AgradCdfPareto_ffv_20;
+typedef std::tuple<AgradCdfPareto, type_ffv_21> AgradCdfPareto_ffv_21;
+typedef std::tuple<AgradCdfPareto, type_ffv_22> AgradCdfPareto_ffv_22;
+typedef std::tuple<AgradCdfPareto, type_ffv_23> AgradCdfPareto_ffv_23;
+typedef std::tuple<AgradCdfPareto, type_ffv_24> AgradCdfPareto_ffv_24;
+typedef std::tuple<AgradCdfPareto, type_ffv_25> AgradCdfPareto_ffv_25;
+typedef std::tuple<AgradCdfPareto, type_ffv_26> AgradCdfPareto_ffv_26;
+typedef std::tuple<AgradCdfPareto, type_ffv_27> AgradCdfPareto_ffv_27;
+typedef std::tuple<AgradCdfPareto, type_ffv_28> AgradCdfPareto_ffv_28;
+typedef std::tuple<AgradCdfPareto, type_ffv_29> AgradCdfPareto_ffv_29;
+typedef std::tuple<AgradCdfPareto, type_ffv_30> AgradCdfPareto_ffv_30;
+typedef std::tuple<AgradCdfPareto, type_ffv_31> AgradCdfPareto_ffv_31;
+typedef std::tuple<AgradCdfPareto, type_ffv_32> AgradCdfPareto_ffv_32;
+typedef std::tuple<AgradCdfPareto, type_ffv_33> AgradCdfPareto_ffv_33;
+typedef std::tuple<AgradCdfPareto, type_ffv_34> AgradCdfPareto_ffv_34;
+typedef std::tuple<AgradCdfPareto, type_ffv_35> AgradCdfPareto_ffv_35;
+typedef std::tuple<AgradCdfPareto, type_ffv_36> AgradCdfPareto_ffv_36;
+typedef std::tuple<AgradCdfPareto, type_ffv_37> AgradCdfPareto_ffv_37;
+typedef std::tuple<AgradCdfPareto, type_ffv_38> AgradCdfPareto_ffv_38;
+typedef std::tuple<AgradCdfPareto, type_ffv_39> AgradCdfPareto_ffv_39;
+typedef std::tuple<AgradCdfPareto, type_ffv_40> AgradCdfPareto_ffv_40;
+typedef std::tuple<AgradCdfPareto, type_ffv_41> AgradCdfPareto_ffv_41;
+typedef std::tuple<AgradCdfPareto, type_ffv_42> AgradCdfPareto_ffv_42;
+typedef std::tuple<AgradCdfPareto, type_ffv_43> AgradCdfPareto_ffv_43;
+typedef std::tuple<AgradCdfPareto, type_ffv_44> AgradCdfPareto_ffv_44;
+typedef std::tuple<AgradCdfPareto, type_ffv_45> AgradCdfPareto_ffv_45;
+typedef std::tuple<AgradCdfPareto, type_ffv_46> AgradCdfPareto_ffv_46;
+typedef std::tuple<AgradCdfPareto, type_ffv_47> AgradCdfPareto_ffv_47;
+typedef std::tuple<AgradCdfPareto, type_ffv_48> AgradCdfPareto_ffv_48;
+typedef std::tuple<AgradCdfPareto, type_ffv_49> AgradCdfPareto_ffv_49;
+typedef std::tuple<AgradCdfPareto, type_ffv_50> AgradCdfPareto_ffv_50;
+typedef std::tuple<AgradCdfPareto, type_ffv_51> AgradCdfPareto_ffv_51;
+typedef std::tuple<AgradCdfPareto, type_ffv_52> AgradCdfPareto_ffv_52;
+typedef std::tuple<AgradCdfPareto, type_ffv_53> AgradCdfPareto_ffv_53;
+typedef std::tuple<AgradCdfPareto, type_ffv_54> AgradCdfPareto_ffv_54;
+typedef std::tuple<AgradCdfPareto, type_ffv_55> AgradCdfPareto_ffv_55;
+typedef std::tuple<AgradCdfPareto, type_ffv_56> AgradCdfPareto_ffv_56;
+typedef std::tuple<AgradCdfPareto, type_ffv_57> AgradCdfPareto_ffv_57;
+typedef std::tuple<AgradCdfPareto, type_ffv_58> AgradCdfPareto_ffv_58;
+typedef std::tuple<AgradCdfPareto, type_ffv_59> AgradCdfPareto_ffv_59;
+typedef std::tuple<AgradCdfPareto, type_ffv_60> AgradCdfPareto_ffv_60;
+typedef std::tuple<AgradCdfPareto, type_ffv_61> AgradCdfPareto_ffv_61;
+typedef std::tuple<AgradCdfPareto, type_ffv_62> AgradCdfPareto_ffv_62;
+typedef std::tuple<AgradCdfPareto, type_ffv_63> AgradCdfPareto_ffv_63;
+typedef std::tuple<AgradCdfPareto, type_ffv_64> AgradCdfPareto_ffv_64;
+typedef std::tuple<AgradCdfPareto, type_ffv_65> AgradCdfPareto_ffv_65;
+typedef std::tuple<AgradCdfPareto, type_ffv_66> AgradCdfPareto_ffv_66;
+typedef std::tuple<AgradCdfPareto, type_ffv_67> AgradCdfPareto_ffv_67;
+typedef std::tuple<AgradCdfPareto, type_ffv_68> AgradCdfPareto_ffv_68;
+typedef std::tuple<AgradCdfPareto, type_ffv_69> AgradCdfPareto_ffv_69;
+typedef std::tuple<AgradCdfPareto, type_ffv_70> AgradCdfPareto_ffv_70;
+typedef std::tuple<AgradCdfPareto, type_ffv_71> AgradCdfPareto_ffv_71;
+typedef std::tuple<AgradCdfPareto, type_ffv_72> AgradCdfPareto_ffv_72;
+typedef std::tuple<AgradCdfPareto, type_ffv_73> AgradCdfPareto_ffv_73;
+typedef std::tuple<AgradCdfPareto, type_ffv_74> AgradCdfPareto_ffv_74;
+typedef std::tuple<AgradCdfPareto, type_ffv_75> AgradCdfPareto_ffv_75;
+typedef std::tuple<AgradCdfPareto, type_ffv_76> AgradCdfPareto_ffv_76;
+typedef std::tuple<AgradCdfPareto, type_ffv_77> AgradCdfPareto_ffv_77;
+typedef std::tuple<AgradCdfPareto, type_ffv_78> AgradCdfPareto_ffv_78;
+typedef std::tuple<AgradCdfPareto, type_ffv_79> AgradCdfPareto_ffv_79;
+typedef std::tuple<AgradCdfPareto, type_ffv_80> AgradCdfPareto_ffv_80;
+typedef std::tuple<AgradCdfPareto, type_ffv_81> AgradCdfPareto_ffv_81;
+typedef std::tuple<AgradCdfPareto, type_ffv_82> AgradCdfPareto_ffv_82;
+typedef std::tuple<AgradCdfPareto, type_ffv_83> AgradCdfPareto_ffv_83;
+typedef std::tuple<AgradCdfPareto, type_ffv_84> AgradCdfPareto_ffv_84;
+typedef std::tuple<AgradCdfPareto, type_ffv_85> AgradCdfPareto_ffv_85;
+typedef std::tuple<AgradCdfPareto, type_ffv_86> AgradCdfPareto_ffv_86;
+typedef std::tuple<AgradCdfPareto, type_ffv_87> AgradCdfPareto_ffv_87;
+typedef std::tuple<AgradCdfPareto, type_ffv_88> AgradCdfPareto_ffv_88;
+typedef std::tuple<AgradCdfPareto, type_ffv_89> AgradCdfPareto_ffv_89;
+typedef std::tuple<AgradCdfPareto, type_ffv_90> AgradCdfPareto_ffv_90;
+typedef std::tuple<AgradCdfPareto, type_ffv_91> AgradCdfPareto_ffv_91;
+typedef std::tuple<AgradCdfPareto, type_ffv_92> AgradCdfPareto_ffv_92;
+typedef std::tuple<AgradCdfPareto, type_ffv_93> AgradCdfPareto_ffv_93;
+typedef std::tuple<AgradCdfPareto, type_ffv_94> AgradCdfPareto_ffv_94;
+typedef std::tuple<AgradCdfPareto, type_ffv_95> AgradCdfPareto_ffv_95;
+typedef std::tuple<AgradCdfPareto, type_ffv_96> AgradCdfPareto_ffv_96;
+typedef std::tuple<AgradCdfPareto, type_ffv_97> AgradCdfPareto_ffv_97;
+typedef std::tuple<AgradCdfPareto, type_ffv_98> AgradCdfPareto_ffv_98;
+typedef std::tuple<AgradCdfPareto, type_ffv_99> AgradCdfPareto_ffv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_0, AgradCdfTestFixture, AgradCdfPareto_ffv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_1, AgradCdfTestFixture, AgradCdfPareto_ffv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_2, AgradCdfTestFixture, AgradCdfPareto_ffv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_3, AgradCdfTestFixture, AgradCdfPareto_ffv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_4, AgradCdfTestFixture, AgradCdfPareto_ffv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_5, AgradCdfTestFixture, AgradCdfPareto_ffv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_6, AgradCdfTestFixture, AgradCdfPareto_ffv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_7, AgradCdfTestFixture, AgradCdfPareto_ffv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_8, AgradCdfTestFixture, AgradCdfPareto_ffv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_9, AgradCdfTestFixture, AgradCdfPareto_ffv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_10, AgradCdfTestFixture, AgradCdfPareto_ffv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_11, AgradCdfTestFixture, AgradCdfPareto_ffv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_12, AgradCdfTestFixture, AgradCdfPareto_ffv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_13, AgradCdfTestFixture, AgradCdfPareto_ffv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_14, AgradCdfTestFixture, AgradCdfPareto_ffv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_15, AgradCdfTestFixture, AgradCdfPareto_ffv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_16, AgradCdfTestFixture, AgradCdfPareto_ffv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_17, AgradCdfTestFixture, AgradCdfPareto_ffv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_18, AgradCdfTestFixture, AgradCdfPareto_ffv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_19, AgradCdfTestFixture, AgradCdfPareto_ffv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_20, AgradCdfTestFixture, AgradCdfPareto_ffv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_21, AgradCdfTestFixture, AgradCdfPareto_ffv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_22, AgradCdfTestFixture, AgradCdfPareto_ffv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_23, AgradCdfTestFixture, AgradCdfPareto_ffv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_24, AgradCdfTestFixture, AgradCdfPareto_ffv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_25, AgradCdfTestFixture, AgradCdfPareto_ffv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_26, AgradCdfTestFixture, AgradCdfPareto_ffv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_27, AgradCdfTestFixture, AgradCdfPareto_ffv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_28, AgradCdfTestFixture, AgradCdfPareto_ffv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_29, AgradCdfTestFixture, AgradCdfPareto_ffv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_30, AgradCdfTestFixture, AgradCdfPareto_ffv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_31, AgradCdfTestFixture, AgradCdfPareto_ffv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_32, AgradCdfTestFixture, AgradCdfPareto_ffv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_33, AgradCdfTestFixture, AgradCdfPareto_ffv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_34, AgradCdfTestFixture, AgradCdfPareto_ffv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_35, AgradCdfTestFixture, AgradCdfPareto_ffv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_36, AgradCdfTestFixture, AgradCdfPareto_ffv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_37, AgradCdfTestFixture, AgradCdfPareto_ffv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_38, AgradCdfTestFixture, AgradCdfPareto_ffv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_39, AgradCdfTestFixture, AgradCdfPareto_ffv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_40, AgradCdfTestFixture, AgradCdfPareto_ffv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_41, AgradCdfTestFixture, AgradCdfPareto_ffv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_42, AgradCdfTestFixture, AgradCdfPareto_ffv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_43, AgradCdfTestFixture, AgradCdfPareto_ffv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_44, AgradCdfTestFixture, AgradCdfPareto_ffv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_45, AgradCdfTestFixture, AgradCdfPareto_ffv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_46, AgradCdfTestFixture, AgradCdfPareto_ffv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_47, AgradCdfTestFixture, AgradCdfPareto_ffv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_48, AgradCdfTestFixture, AgradCdfPareto_ffv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_49, AgradCdfTestFixture, AgradCdfPareto_ffv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_50, AgradCdfTestFixture, AgradCdfPareto_ffv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_51, AgradCdfTestFixture, AgradCdfPareto_ffv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_52, AgradCdfTestFixture, AgradCdfPareto_ffv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_53, AgradCdfTestFixture, AgradCdfPareto_ffv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_54, AgradCdfTestFixture, AgradCdfPareto_ffv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_55, AgradCdfTestFixture, AgradCdfPareto_ffv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_56, AgradCdfTestFixture, AgradCdfPareto_ffv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_57, AgradCdfTestFixture, AgradCdfPareto_ffv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_58, AgradCdfTestFixture, AgradCdfPareto_ffv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_59, AgradCdfTestFixture, AgradCdfPareto_ffv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_60, AgradCdfTestFixture, AgradCdfPareto_ffv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_61, AgradCdfTestFixture, AgradCdfPareto_ffv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_62, AgradCdfTestFixture, AgradCdfPareto_ffv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_63, AgradCdfTestFixture, AgradCdfPareto_ffv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_64, AgradCdfTestFixture, AgradCdfPareto_ffv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_65, AgradCdfTestFixture, AgradCdfPareto_ffv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_66, AgradCdfTestFixture, AgradCdfPareto_ffv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_67, AgradCdfTestFixture, AgradCdfPareto_ffv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_68, AgradCdfTestFixture, AgradCdfPareto_ffv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_69, AgradCdfTestFixture, AgradCdfPareto_ffv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_70, AgradCdfTestFixture, AgradCdfPareto_ffv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_71, AgradCdfTestFixture, AgradCdfPareto_ffv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_72, AgradCdfTestFixture, AgradCdfPareto_ffv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_73, AgradCdfTestFixture, AgradCdfPareto_ffv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_74, AgradCdfTestFixture, AgradCdfPareto_ffv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_75, AgradCdfTestFixture, AgradCdfPareto_ffv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_76, AgradCdfTestFixture, AgradCdfPareto_ffv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_77, AgradCdfTestFixture, AgradCdfPareto_ffv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_78, AgradCdfTestFixture, AgradCdfPareto_ffv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_79, AgradCdfTestFixture, AgradCdfPareto_ffv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_80, AgradCdfTestFixture, AgradCdfPareto_ffv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_81, AgradCdfTestFixture, AgradCdfPareto_ffv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_82, AgradCdfTestFixture, AgradCdfPareto_ffv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_83, AgradCdfTestFixture, AgradCdfPareto_ffv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_84, AgradCdfTestFixture, AgradCdfPareto_ffv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_85, AgradCdfTestFixture, AgradCdfPareto_ffv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_86, AgradCdfTestFixture, AgradCdfPareto_ffv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_87, AgradCdfTestFixture, AgradCdfPareto_ffv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_88, AgradCdfTestFixture, AgradCdfPareto_ffv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_89, AgradCdfTestFixture, AgradCdfPareto_ffv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_90, AgradCdfTestFixture, AgradCdfPareto_ffv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_91, AgradCdfTestFixture, AgradCdfPareto_ffv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_92, AgradCdfTestFixture, AgradCdfPareto_ffv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_93, AgradCdfTestFixture, AgradCdfPareto_ffv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_94, AgradCdfTestFixture, AgradCdfPareto_ffv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_95, AgradCdfTestFixture, AgradCdfPareto_ffv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_96, AgradCdfTestFixture, AgradCdfPareto_ffv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_97, AgradCdfTestFixture, AgradCdfPareto_ffv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_98, AgradCdfTestFixture, AgradCdfPareto_ffv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_99, AgradCdfTestFixture, AgradCdfPareto_ffv_99);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto/pareto_cdf_test.hpp>
+
+typedef std::tuple<double, double, double, empty, empty, empty> type_v_0;
+typedef std::tuple<double, double, std::vector<double>, empty, empty, empty> type_v_1;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_2;
+typedef std::tuple<double, double, var, empty, empty, empty> type_v_3;
+typedef std::tuple<double, double, std::vector<var>, empty, empty, empty> type_v_4;
+typedef std::tuple<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_5;
+typedef std::tuple<double, std::vector<double>, double, empty, empty, empty> type_v_6;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_7;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_8;
+typedef std::tuple<double, std::vector<double>, var, empty, empty, empty> type_v_9;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_10;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_11;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_12;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_13;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_14;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_15;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_16;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_17;
+typedef std::tuple<double, var, double, empty, empty, empty> type_v_18;
+typedef std::tuple<double, var, std::vector<double>, empty, empty, empty> type_v_19;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_20;
+typedef std::tuple<double, var, var, empty, empty, empty> type_v_21;
+typedef std::tuple<double, var, std::vector<var>, empty, empty, empty> type_v_22;
+typedef std::tuple<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_23;
+typedef std::tuple<double, std::vector<var>, double, empty, empty, empty> type_v_24;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_25;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_26;
+typedef std::tuple<double, std::vector<var>, var, empty, empty, empty> type_v_27;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_28;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_29;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_30;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_31;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_32;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_33;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_34;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_35;
+typedef std::tuple<std::vector<double>, double, double, empty, empty, empty> type_v_36;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, empty, empty, empty> type_v_37;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_38;
+typedef std::tuple<std::vector<double>, double, var, empty, empty, empty> type_v_39;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, empty, empty, empty> type_v_40;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_41;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, empty, empty, empty> type_v_42;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_43;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_44;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, empty, empty, empty> type_v_45;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_46;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_47;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_48;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_49;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_50;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_51;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_52;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_53;
+typedef std::tuple<std::vector<double>, var, double, empty, empty, empty> type_v_54;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, empty, empty, empty> type_v_55;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_56;
+typedef std::tuple<std::vector<double>, var, var, empty, empty, empty> type_v_57;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, empty, empty, empty> type_v_58;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_59;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, empty, empty, empty> type_v_60;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_61;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_62;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, empty, empty, empty> type_v_63;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_64;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_65;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_66;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_67;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_68;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_69;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_70;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_v_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_v_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_v_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_v_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_v_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_80;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_v_81;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_82;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_83;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_84;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_85;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_86;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_87;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_88;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_89;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_v_90;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_v_91;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_92;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_v_93;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_v_94;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_95;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_v_96;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_97;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_98;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_v_99;
+
+typedef std::tuple<AgradCdfPareto, type_v_0> AgradCdfPareto_v_0;
+typedef std::tuple<AgradCdfPareto, type_v_1> AgradCdfPareto_v_1;
+typedef std::tuple<AgradCdfPareto, type_v_2> AgradCdfPareto_v_2;
+typedef std::tuple<AgradCdfPareto, type_v_3> AgradCdfPareto_v_3;
+typedef std::tuple<AgradCdfPareto, type_v_4> AgradCdfPareto_v_4;
+typedef std::tuple<AgradCdfPareto, type_v_5> AgradCdfPareto_v_5;
+typedef std::tuple<AgradCdfPareto, type_v_6> AgradCdfPareto_v_6;
+typedef std::tuple<AgradCdfPareto, type_v_7> AgradCdfPareto_v_7;
+typedef std::tuple<AgradCdfPareto, type_v_8> AgradCdfPareto_v_8;
+typedef std::tuple<AgradCdfPareto, type_v_9> AgradCdfPareto_v_9;
+typedef std::tuple<AgradCdfPareto, type_v_10> AgradCdfPareto_v_10;
+typedef std::tuple<AgradCdfPareto, type_v_11> AgradCdfPareto_v_11;
+typedef std::tuple<AgradCdfPareto, type_v_12> AgradCdfPareto_v_12;
+typedef std::tuple<AgradCdfPareto, type_v_13> AgradCdfPareto_v_13;
+typedef std::tuple<AgradCdfPareto, type_v_14> AgradCdfPareto_v_14;
+typedef std::tuple<AgradCdfPareto, type_v_15> AgradCdfPareto_v_15;
+typedef std::tuple<AgradCdfPareto, type_v_16> AgradCdfPareto_v_16;
+typedef std::tuple<AgradCdfPareto, type_v_17> AgradCdfPareto_v_17;
+typedef std::tuple<AgradCdfPareto, type_v_18> AgradCdfPareto_v_18;
+typedef std::tuple<AgradCdfPareto, type_v_19> AgradCdfPareto_v_19;
+typedef std::tuple<AgradCdfPareto, type_v_20> AgradCdfPareto_v_20;
+typedef std::tuple<AgradCdfPareto, type_v_21> AgradCdfPareto_v_21;
+typedef std::tuple<AgradCdfPareto, type_v_22> AgradCdfPareto_v_22;
+typedef std::tuple<AgradCdfPareto, type_v_23> AgradCdfPareto_v_23;
+typedef std::tuple<AgradCdfPareto, type_v_24> AgradCdfPareto_v_24;
+typedef std::tuple<AgradCdfPareto, type_v_25> AgradCdfPareto_v_25;
+typedef std::tuple<AgradCdfPareto, type_v_26> AgradCdfPareto_v_26;
+typedef std::tuple<AgradCdfPareto, type_v_27> AgradCdfPareto_v_27;
+typedef std::tuple<AgradCdfPareto, type_v_28> AgradCdfPareto_v_28;
+typedef std::tuple<AgradCdfPareto, type_v_29> AgradCdfPareto_v_29;
+typedef std::tuple<AgradCdfPareto, type_v_30> AgradCdfPareto_v_30;
+typedef std::tuple<AgradCdfPareto, type_v_31> AgradCdfPareto_v_31;
+typedef std::tuple<AgradCdfPareto, type_v_32> AgradCdfPareto_v_32;
+typedef std::tuple<AgradCdfPareto, type_v_33> AgradCdfPareto_v_33;
+typedef std::tuple<AgradCdfPareto, type_v_34> AgradCdfPareto_v_34;
+typedef std::tuple<AgradCdfPareto, type_v_35> AgradCdfPareto_v_35;
+typedef std::tuple<AgradCdfPareto, type_v_36> AgradCdfPareto_v_36;
+typedef std::tuple<AgradCdfPareto, type_v_37> AgradCdfPareto_v_37;
+typedef std::tuple<AgradCdfPareto, type_v_38> AgradCdfPareto_v_38;
+typedef std::tuple<AgradCdfPareto, type_v_39> AgradCdfPareto_v_39;
+typedef std::tuple<AgradCdfPareto, type_v_40> AgradCdfPareto_v_40;
+typedef std::tuple<AgradCdfPareto, type_v_41> AgradCdfPareto_v_41;
+typedef std::tuple<AgradCdfPareto, type_v_42> AgradCdfPareto_v_42;
+typedef std::tuple<AgradCdfPareto, type_v_43> AgradCdfPareto_v_43;
+typedef std::tuple<AgradCdfPareto, type_v_44> AgradCdfPareto_v_44;
+typedef std::tuple<AgradCdfPareto, type_v_45> AgradCdfPareto_v_45;
+typedef std::tuple<AgradCdfPareto, type_v_46> AgradCdfPareto_v_46;
+typedef std::tuple<AgradCdfPareto, type_v_47> AgradCdfPareto_v_47;
+typedef std::tuple<AgradCdfPareto, type_v_48> AgradCdfPareto_v_48;
+typedef std::tuple<AgradCdfPareto, type_v_49> AgradCdfPareto_v_49;
+typedef std::tuple<AgradCdfPareto, type_v_50> AgradCdfPareto_v_50;
+typedef std::tuple<AgradCdfPareto, type_v_51> AgradCdfPareto_v_51;
+typedef std::tuple<AgradCdfPareto, type_v_52> AgradCdfPareto_v_52;
+typedef std::tuple<AgradCdfPareto, type_v_53> AgradCdfPareto_v_53;
+typedef std::tuple<AgradCdfPareto, type_v_54> AgradCdfPareto_v_54;
+typedef std::tuple<AgradCdfPareto, type_v_55> AgradCdfPareto_v_55;
+typedef std::tuple<AgradCdfPareto, type_v_56> AgradCdfPareto_v_56;
+typedef std::tuple<AgradCdfPareto, type_v_57> AgradCdfPareto_v_57;
+typedef std::tuple<AgradCdfPareto, type_v_58> AgradCdfPareto_v_58;
+typedef std::tuple<AgradCdfPareto, type_v_59> AgradCdfPareto_v_59;
+typedef std::tuple<AgradCdfPareto, type_v_60> AgradCdfPareto_v_60;
+typedef std::tuple<AgradCdfPareto, type_v_61> AgradCdfPareto_v_61;
+typedef std::tuple<AgradCdfPareto, type_v_62> AgradCdfPareto_v_62;
+typedef std::tuple<AgradCdfPareto, type_v_63> AgradCdfPareto_v_63;
+typedef std::tuple<AgradCdfPareto, type_v_64> AgradCdfPareto_v_64;
+typedef std::tuple<AgradCdfPareto, type_v_65> AgradCdfPareto_v_65;
+typedef std::tuple<AgradCdfPareto, type_v_66> AgradCdfPareto_v_66;
+typedef std::tuple<AgradCdfPareto, type_v_67> AgradCdfPareto_v_67;
+typedef std::tuple<AgradCdfPareto, type_v_68> AgradCdfPareto_v_68;
+typedef std::tuple<AgradCdfPareto, type_v_69> AgradCdfPareto_v_69;
+typedef std::tuple<AgradCdfPareto, type_v_70> AgradCdfPareto_v_70;
+typedef std::tuple<AgradCdfPareto, type_v_71> AgradCdfPareto_v_71;
+typedef std::tuple<AgradCdfPareto, type_v_72> AgradCdfPareto_v_72;
+typedef std::tuple<AgradCdfPareto, type_v_73> AgradCdfPareto_v_73;
+typedef std::tuple<AgradCdfPareto, type_v_74> AgradCdfPareto_v_74;
+typedef std::tuple<AgradCdfPareto, type_v_75> AgradCdfPareto_v_75;
+typedef std::tuple<AgradCdfPareto, type_v_76> AgradCdfPareto_v_76;
+typedef std::tuple<AgradCdfPareto, type_v_77> AgradCdfPareto_v_77;
+typedef std::tuple<AgradCdfPareto, type_v_78> AgradCdfPareto_v_78;
+typedef std::tuple<AgradCdfPareto, type_v_79> AgradCdfPareto_v_79;
+typedef std::tuple<AgradCdfPareto, type_v_80> AgradCdfPareto_v_80;
+typedef std::tuple<AgradCdfPareto, type_v_81> AgradCdfPareto_v_81;
+typedef std::tuple<AgradCdfPareto, type_v_82> AgradCdfPareto_v_82;
+typedef std::tuple<AgradCdfPareto, type_v_83> AgradCdfPareto_v_83;
+typedef std::tuple<AgradCdfPareto, type_v_84> AgradCdfPareto_v_84;
+typedef std::tuple<AgradCdfPareto, type_v_85> AgradCdfPareto_v_85;
+typedef std::tuple<AgradCdfPareto, type_v_86> AgradCdfPareto_v_86;
+typedef std::tuple<AgradCdfPareto, type_v_87> AgradCdfPareto_v_87;
+typedef std::tuple<AgradCdfPareto, type_v_88> AgradCdfPareto_v_88;
+typedef std::tuple<AgradCdfPareto, type_v_89> AgradCdfPareto_v_89;
+typedef std::tuple<AgradCdfPareto, type_v_90> AgradCdfPareto_v_90;
+typedef std::tuple<AgradCdfPareto, type_v_91> AgradCdfPareto_v_91;
+typedef std::tuple<AgradCdfPareto, type_v_92> AgradCdfPareto_v_92;
+typedef std::tuple<AgradCdfPareto, type_v_93> AgradCdfPareto_v_93;
+typedef std::tuple<AgradCdfPareto, type_v_94> AgradCdfPareto_v_94;
+typedef std::tuple<AgradCdfPareto, type_v_95> AgradCdfPareto_v_95;
+typedef std::tuple<AgradCdfPareto, type_v_96> AgradCdfPareto_v_96;
+typedef std::tuple<AgradCdfPareto, type_v_97> AgradCdfPareto_v_97;
+typedef std::tuple<AgradCdfPareto, type_v_98> AgradCdfPareto_v_98;
+typedef std::tuple<AgradCdfPareto, type_v_99> AgradCdfPareto_v_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_0, AgradCdfTestFixture, AgradCdfPareto_v_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_1, AgradCdfTestFixture, AgradCdfPareto_v_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_2, AgradCdfTestFixture, AgradCdfPareto_v_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_3, AgradCdfTestFixture, AgradCdfPareto_v_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_4, AgradCdfTestFixture, AgradCdfPareto_v_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_5, AgradCdfTestFixture, AgradCdfPareto_v_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_6, AgradCdfTestFixture, AgradCdfPareto_v_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_7, AgradCdfTestFixture, AgradCdfPareto_v_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_8, AgradCdfTestFixture, AgradCdfPareto_v_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_9, AgradCdfTestFixture, AgradCdfPareto_v_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_10, AgradCdfTestFixture, AgradCdfPareto_v_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_11, AgradCdfTestFixture, AgradCdfPareto_v_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_12, AgradCdfTestFixture, AgradCdfPareto_v_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_13, AgradCdfTestFixture, AgradCdfPareto_v_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_14, AgradCdfTestFixture, AgradCdfPareto_v_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_15, AgradCdfTestFixture, AgradCdfPareto_v_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_16, AgradCdfTestFixture, AgradCdfPareto_v_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_17, AgradCdfTestFixture, AgradCdfPareto_v_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_18, AgradCdfTestFixture, AgradCdfPareto_v_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_19, AgradCdfTestFixture, AgradCdfPareto_v_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_20, AgradCdfTestFixture, AgradCdfPareto_v_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_21, AgradCdfTestFixture, AgradCdfPareto_v_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_22, AgradCdfTestFixture, AgradCdfPareto_v_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_23, AgradCdfTestFixture, AgradCdfPareto_v_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_24, AgradCdfTestFixture, AgradCdfPareto_v_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_25, AgradCdfTestFixture, AgradCdfPareto_v_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_26, AgradCdfTestFixture, AgradCdfPareto_v_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_27, AgradCdfTestFixture, AgradCdfPareto_v_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_28, AgradCdfTestFixture, AgradCdfPareto_v_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_29, AgradCdfTestFixture, AgradCdfPareto_v_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_30, AgradCdfTestFixture, AgradCdfPareto_v_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_31, AgradCdfTestFixture, AgradCdfPareto_v_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_32, AgradCdfTestFixture, AgradCdfPareto_v_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_33, AgradCdfTestFixture, AgradCdfPareto_v_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_34, AgradCdfTestFixture, AgradCdfPareto_v_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_35, AgradCdfTestFixture, AgradCdfPareto_v_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_36, AgradCdfTestFixture, AgradCdfPareto_v_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_37, AgradCdfTestFixture, AgradCdfPareto_v_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_38, AgradCdfTestFixture, AgradCdfPareto_v_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_39, AgradCdfTestFixture, AgradCdfPareto_v_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_40, AgradCdfTestFixture, AgradCdfPareto_v_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_41, AgradCdfTestFixture, AgradCdfPareto_v_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_42, AgradCdfTestFixture, AgradCdfPareto_v_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_43, AgradCdfTestFixture, AgradCdfPareto_v_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_44, AgradCdfTestFixture, AgradCdfPareto_v_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_45, AgradCdfTestFixture, AgradCdfPareto_v_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_46, AgradCdfTestFixture, AgradCdfPareto_v_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_47, AgradCdfTestFixture, AgradCdfPareto_v_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_48, AgradCdfTestFixture, AgradCdfPareto_v_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_49, AgradCdfTestFixture, AgradCdfPareto_v_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_50, AgradCdfTestFixture, AgradCdfPareto_v_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_51, AgradCdfTestFixture, AgradCdfPareto_v_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_52, AgradCdfTestFixture, AgradCdfPareto_v_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_53, AgradCdfTestFixture, AgradCdfPareto_v_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_54, AgradCdfTestFixture, AgradCdfPareto_v_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_55, AgradCdfTestFixture, AgradCdfPareto_v_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_56, AgradCdfTestFixture, AgradCdfPareto_v_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_57, AgradCdfTestFixture, AgradCdfPareto_v_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_58, AgradCdfTestFixture, AgradCdfPareto_v_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_59, AgradCdfTestFixture, AgradCdfPareto_v_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_60, AgradCdfTestFixture, AgradCdfPareto_v_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_61, AgradCdfTestFixture, AgradCdfPareto_v_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_62, AgradCdfTestFixture, AgradCdfPareto_v_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_63, AgradCdfTestFixture, AgradCdfPareto_v_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_64, AgradCdfTestFixture, AgradCdfPareto_v_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_65, AgradCdfTestFixture, AgradCdfPareto_v_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_66, AgradCdfTestFixture, AgradCdfPareto_v_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_67, AgradCdfTestFixture, AgradCdfPareto_v_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_68, AgradCdfTestFixture, AgradCdfPareto_v_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_69, AgradCdfTestFixture, AgradCdfPareto_v_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_70, AgradCdfTestFixture, AgradCdfPareto_v_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_71, AgradCdfTestFixture, AgradCdfPareto_v_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_72, AgradCdfTestFixture, AgradCdfPareto_v_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_73, AgradCdfTestFixture, AgradCdfPareto_v_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_74, AgradCdfTestFixture, AgradCdfPareto_v_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_75, AgradCdfTestFixture, AgradCdfPareto_v_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_76, AgradCdfTestFixture, AgradCdfPareto_v_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_77, AgradCdfTestFixture, AgradCdfPareto_v_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_78, AgradCdfTestFixture, AgradCdfPareto_v_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_79, AgradCdfTestFixture, AgradCdfPareto_v_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_80, AgradCdfTestFixture, AgradCdfPareto_v_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_81, AgradCdfTestFixture, AgradCdfPareto_v_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_82, AgradCdfTestFixture, AgradCdfPareto_v_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_83, AgradCdfTestFixture, AgradCdfPareto_v_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_84, AgradCdfTestFixture, AgradCdfPareto_v_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_85, AgradCdfTestFixture, AgradCdfPareto_v_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_86, AgradCdfTestFixture, AgradCdfPareto_v_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_87, AgradCdfTestFixture, AgradCdfPareto_v_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_88, AgradCdfTestFixture, AgradCdfPareto_v_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_89, AgradCdfTestFixture, AgradCdfPareto_v_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_90, AgradCdfTestFixture, AgradCdfPareto_v_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_91, AgradCdfTestFixture, AgradCdfPareto_v_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_92, AgradCdfTestFixture, AgradCdfPareto_v_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_93, AgradCdfTestFixture, AgradCdfPareto_v_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_94, AgradCdfTestFixture, AgradCdfPareto_v_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_95, AgradCdfTestFixture, AgradCdfPareto_v_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_96, AgradCdfTestFixture, AgradCdfPareto_v_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_97, AgradCdfTestFixture, AgradCdfPareto_v_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_98, AgradCdfTestFixture, AgradCdfPareto_v_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_99, AgradCdfTestFixture, AgradCdfPareto_v_99);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto/pareto_cdf_test.hpp>
+
+typedef std::tuple<double, double, var, empty, empty, empty> type_vv_0;
+typedef std::tuple<double, double, std::vector<var>, empty, empty, empty> type_vv_1;
+typedef std::tuple<double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_2;
+typedef std::tuple<double, std::vector<double>, var, empty, empty, empty> type_vv_3;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_4;
+typedef std::tuple<double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_5;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_6;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_7;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_8;
+typedef std::tuple<double, var, double, empty, empty, empty> type_vv_9;
+typedef std::tuple<double, var, std::vector<double>, empty, empty, empty> type_vv_10;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_11;
+typedef std::tuple<double, var, var, empty, empty, empty> type_vv_12;
+typedef std::tuple<double, var, std::vector<var>, empty, empty, empty> type_vv_13;
+typedef std::tuple<double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_14;
+typedef std::tuple<double, std::vector<var>, double, empty, empty, empty> type_vv_15;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_16;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_17;
+typedef std::tuple<double, std::vector<var>, var, empty, empty, empty> type_vv_18;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_19;
+typedef std::tuple<double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_20;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_21;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_22;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_23;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_24;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_25;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_26;
+typedef std::tuple<std::vector<double>, double, var, empty, empty, empty> type_vv_27;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, empty, empty, empty> type_vv_28;
+typedef std::tuple<std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_29;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, empty, empty, empty> type_vv_30;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_31;
+typedef std::tuple<std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_32;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_33;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_34;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_35;
+typedef std::tuple<std::vector<double>, var, double, empty, empty, empty> type_vv_36;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, empty, empty, empty> type_vv_37;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_38;
+typedef std::tuple<std::vector<double>, var, var, empty, empty, empty> type_vv_39;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, empty, empty, empty> type_vv_40;
+typedef std::tuple<std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_41;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, empty, empty, empty> type_vv_42;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_43;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_44;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, empty, empty, empty> type_vv_45;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_46;
+typedef std::tuple<std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_47;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_48;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_49;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_50;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_51;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_52;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_53;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_vv_54;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_vv_55;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_56;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_vv_57;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_58;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_59;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_60;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_61;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_62;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_vv_63;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_vv_64;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_65;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_vv_66;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_vv_67;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_68;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_vv_69;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_70;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_vv_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_80;
+typedef std::tuple<var, double, double, empty, empty, empty> type_vv_81;
+typedef std::tuple<var, double, std::vector<double>, empty, empty, empty> type_vv_82;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_83;
+typedef std::tuple<var, double, var, empty, empty, empty> type_vv_84;
+typedef std::tuple<var, double, std::vector<var>, empty, empty, empty> type_vv_85;
+typedef std::tuple<var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_86;
+typedef std::tuple<var, std::vector<double>, double, empty, empty, empty> type_vv_87;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_88;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_89;
+typedef std::tuple<var, std::vector<double>, var, empty, empty, empty> type_vv_90;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_91;
+typedef std::tuple<var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_92;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_93;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_94;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_95;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_96;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_97;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_98;
+typedef std::tuple<var, var, double, empty, empty, empty> type_vv_99;
+
+typedef std::tuple<AgradCdfPareto, type_vv_0> AgradCdfPareto_vv_0;
+typedef std::tuple<AgradCdfPareto, type_vv_1> AgradCdfPareto_vv_1;
+typedef std::tuple<AgradCdfPareto, type_vv_2> AgradCdfPareto_vv_2;
+typedef std::tuple<AgradCdfPareto, type_vv_3> AgradCdfPareto_vv_3;
+typedef std::tuple<AgradCdfPareto, type_vv_4> AgradCdfPareto_vv_4;
+typedef std::tuple<AgradCdfPareto, type_vv_5> AgradCdfPareto_vv_5;
+typedef std::tuple<AgradCdfPareto, type_vv_6> AgradCdfPareto_vv_6;
+typedef std::tuple<AgradCdfPareto, type_vv_7> AgradCdfPareto_vv_7;
+typedef std::tuple<AgradCdfPareto, type_vv_8> AgradCdfPareto_vv_8;
+typedef std::tuple<AgradCdfPareto, type_vv_9> AgradCdfPareto_vv_9;
+typedef std::tuple<AgradCdfPareto, type_vv_10> AgradCdfPareto_vv_10;
+typedef std::tuple<AgradCdfPareto, type_vv_11> AgradCdfPareto_vv_11;
+typedef std::tuple<AgradCdfPareto, type_vv_12> AgradCdfPareto_vv_12;
+typedef std::tuple<AgradCdfPareto, type_vv_13> AgradCdfPareto_vv_13;
+typedef std::tuple<AgradCdfPareto, type_vv_14> AgradCdfPareto_vv_14;
+typedef std::tuple<AgradCdfPareto, type_vv_15> AgradCdfPareto_vv_15;
+typedef std::tuple<AgradCdfPareto, type_vv_16> AgradCdfPareto_vv_16;
+typedef std::tuple<AgradCdfPareto, type_vv_17> AgradCdfPareto_vv_17;
+typedef std::tuple<AgradCdfPareto, type_vv_18> AgradCdfPareto_vv_18;
+typedef std::tuple<AgradCdfPareto, type_vv_19> AgradCdfPareto_vv_19;
+typedef std::tuple<AgradCdfPareto, type_vv_20> AgradCdfPareto_vv_20;
+typedef std::tuple<AgradCdfPareto, type_vv_21> AgradCdfPareto_vv_21;
+typedef std::tuple<AgradCdfPareto, type_vv_22> AgradCdfPareto_vv_22;
+typedef std::tuple<AgradCdfPareto, type_vv_23> AgradCdfPareto_vv_23;
+typedef std::tuple<AgradCdfPareto, type_vv_24> AgradCdfPareto_vv_24;
+typedef std::tuple<AgradCdfPareto, type_vv_25> AgradCdfPareto_vv_25;
+typedef std::tuple<AgradCdfPareto, type_vv_26> AgradCdfPareto_vv_26;
+typedef std::tuple<AgradCdfPareto, type_vv_27> AgradCdfPareto_vv_27;
+typedef std::tuple<AgradCdfPareto, type_vv_28> AgradCdfPareto_vv_28;
+typedef std::tuple<AgradCdfPareto, type_vv_29> AgradCdfPareto_vv_29;
+typedef std::tuple<AgradCdfPareto, type_vv_30> AgradCdfPareto_vv_30;
+typedef std::tuple<AgradCdfPareto, type_vv_31> AgradCdfPareto_vv_31;
+typedef std::tuple<AgradCdfPareto, type_vv_32> AgradCdfPareto_vv_32;
+typedef std::tuple<AgradCdfPareto, type_vv_33> AgradCdfPareto_vv_33;
+typedef std::tuple<AgradCdfPareto, type_vv_34> AgradCdfPareto_vv_34;
+typedef std::tuple<AgradCdfPareto, type_vv_35> AgradCdfPareto_vv_35;
+typedef std::tuple<AgradCdfPareto, type_vv_36> AgradCdfPareto_vv_36;
+typedef std::tuple<AgradCdfPareto, type_vv_37> AgradCdfPareto_vv_37;
+typedef std::tuple<AgradCdfPareto, type_vv_38> AgradCdfPareto_vv_38;
+typedef std::tuple<AgradCdfPareto, type_vv_39> AgradCdfPareto_vv_39;
+typedef std::tuple<AgradCdfPareto, type_vv_40> AgradCdfPareto_vv_40;
+typedef std::tuple<AgradCdfPareto, type_vv_41> AgradCdfPareto_vv_41;
+typedef std::tuple<AgradCdfPareto, type_vv_42> AgradCdfPareto_vv_42;
+typedef std::tuple<AgradCdfPareto, type_vv_43> AgradCdfPareto_vv_43;
+typedef std::tuple<AgradCdfPareto, type_vv_44> AgradCdfPareto_vv_44;
+typedef std::tuple<AgradCdfPareto, type_vv_45> AgradCdfPareto_vv_45;
+typedef std::tuple<AgradCdfPareto, type_vv_46> AgradCdfPareto_vv_46;
+typedef std::tuple<AgradCdfPareto, type_vv_47> AgradCdfPareto_vv_47;
+typedef std::tuple<AgradCdfPareto, type_vv_48> AgradCdfPareto_vv_48;
+typedef std::tuple<AgradCdfPareto, type_vv_49> AgradCdfPareto_vv_49;
+typedef std::tuple<AgradCdfPareto, type_vv_50> AgradCdfPareto_vv_50;
+typedef std::tuple<AgradCdfPareto, type_vv_51> AgradCdfPareto_vv_51;
+typedef std::tuple<AgradCdfPareto, type_vv_52> AgradCdfPareto_vv_52;
+typedef std::tuple<AgradCdfPareto, type_vv_53> AgradCdfPareto_vv_53;
+typedef std::tuple<AgradCdfPareto, type_vv_54> AgradCdfPareto_vv_54;
+typedef std::tuple<AgradCdfPareto, type_vv_55> AgradCdfPareto_vv_55;
+typedef std::tuple<AgradCdfPareto, type_vv_56> AgradCdfPareto_vv_56;
+typedef std::tuple<AgradCdfPareto, type_vv_57> AgradCdfPareto_vv_57;
+typedef std::tuple<AgradCdfPareto, type_vv_58> AgradCdfPareto_vv_58;
+typedef std::tuple<AgradCdfPareto, type_vv_59> AgradCdfPareto_vv_59;
+typedef std::tuple<AgradCdfPareto, type_vv_60> AgradCdfPareto_vv_60;
+typedef std::tuple<AgradCdfPareto, type_vv_61> AgradCdfPareto_vv_61;
+typedef std::tuple<AgradCdfPareto, type_vv_62> AgradCdfPareto_vv_62;
+typedef std::tuple<AgradCdfPareto, type_vv_63> AgradCdfPareto_vv_63;
+typedef std::tuple<AgradCdfPareto, type_vv_64> AgradCdfPareto_vv_64;
+typedef std::tuple<AgradCdfPareto, type_vv_65> AgradCdfPareto_vv_65;
+typedef std::tuple<AgradCdfPareto, type_vv_66> AgradCdfPareto_vv_66;
+typedef std::tuple<AgradCdfPareto, type_vv_67> AgradCdfPareto_vv_67;
+typedef std::tuple<AgradCdfPareto, type_vv_68> AgradCdfPareto_vv_68;
+typedef std::tuple<AgradCdfPareto, type_vv_69> AgradCdfPareto_vv_69;
+typedef std::tuple<AgradCdfPareto, type_vv_70> AgradCdfPareto_vv_70;
+typedef std::tuple<AgradCdfPareto, type_vv_71> AgradCdfPareto_vv_71;
+typedef std::tuple<AgradCdfPareto, type_vv_72> AgradCdfPareto_vv_72;
+typedef std::tuple<AgradCdfPareto, type_vv_73> AgradCdfPareto_vv_73;
+typedef std::tuple<AgradCdfPareto, type_vv_74> AgradCdfPareto_vv_74;
+typedef std::tuple<AgradCdfPareto, type_vv_75> AgradCdfPareto_vv_75;
+typedef std::tuple<AgradCdfPareto, type_vv_76> AgradCdfPareto_vv_76;
+typedef std::tuple<AgradCdfPareto, type_vv_77> AgradCdfPareto_vv_77;
+typedef std::tuple<AgradCdfPareto, type_vv_78> AgradCdfPareto_vv_78;
+typedef std::tuple<AgradCdfPareto, type_vv_79> AgradCdfPareto_vv_79;
+typedef std::tuple<AgradCdfPareto, type_vv_80> AgradCdfPareto_vv_80;
+typedef std::tuple<AgradCdfPareto, type_vv_81> AgradCdfPareto_vv_81;
+typedef std::tuple<AgradCdfPareto, type_vv_82> AgradCdfPareto_vv_82;
+typedef std::tuple<AgradCdfPareto, type_vv_83> AgradCdfPareto_vv_83;
+typedef std::tuple<AgradCdfPareto, type_vv_84> AgradCdfPareto_vv_84;
+typedef std::tuple<AgradCdfPareto, type_vv_85> AgradCdfPareto_vv_85;
+typedef std::tuple<AgradCdfPareto, type_vv_86> AgradCdfPareto_vv_86;
+typedef std::tuple<AgradCdfPareto, type_vv_87> AgradCdfPareto_vv_87;
+typedef std::tuple<AgradCdfPareto, type_vv_88> AgradCdfPareto_vv_88;
+typedef std::tuple<AgradCdfPareto, type_vv_89> AgradCdfPareto_vv_89;
+typedef std::tuple<AgradCdfPareto, type_vv_90> AgradCdfPareto_vv_90;
+typedef std::tuple<AgradCdfPareto, type_vv_91> AgradCdfPareto_vv_91;
+typedef std::tuple<AgradCdfPareto, type_vv_92> AgradCdfPareto_vv_92;
+typedef std::tuple<AgradCdfPareto, type_vv_93> AgradCdfPareto_vv_93;
+typedef std::tuple<AgradCdfPareto, type_vv_94> AgradCdfPareto_vv_94;
+typedef std::tuple<AgradCdfPareto, type_vv_95> AgradCdfPareto_vv_95;
+typedef std::tuple<AgradCdfPareto, type_vv_96> AgradCdfPareto_vv_96;
+typedef std::tuple<AgradCdfPareto, type_vv_97> AgradCdfPareto_vv_97;
+typedef std::tuple<AgradCdfPareto, type_vv_98> AgradCdfPareto_vv_98;
+typedef std::tuple<AgradCdfPareto, type_vv_99> AgradCdfPareto_vv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_0, AgradCdfTestFixture, AgradCdfPareto_vv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_1, AgradCdfTestFixture, AgradCdfPareto_vv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_2, AgradCdfTestFixture, AgradCdfPareto_vv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_3, AgradCdfTestFixture, AgradCdfPareto_vv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_4, AgradCdfTestFixture, AgradCdfPareto_vv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_5, AgradCdfTestFixture, AgradCdfPareto_vv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_6, AgradCdfTestFixture, AgradCdfPareto_vv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_7, AgradCdfTestFixture, AgradCdfPareto_vv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_8, AgradCdfTestFixture, AgradCdfPareto_vv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_9, AgradCdfTestFixture, AgradCdfPareto_vv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_10, AgradCdfTestFixture, AgradCdfPareto_vv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_11, AgradCdfTestFixture, AgradCdfPareto_vv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_12, AgradCdfTestFixture, AgradCdfPareto_vv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_13, AgradCdfTestFixture, AgradCdfPareto_vv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_14, AgradCdfTestFixture, AgradCdfPareto_vv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_15, AgradCdfTestFixture, AgradCdfPareto_vv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_16, AgradCdfTestFixture, AgradCdfPareto_vv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_17, AgradCdfTestFixture, AgradCdfPareto_vv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_18, AgradCdfTestFixture, AgradCdfPareto_vv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_19, AgradCdfTestFixture, AgradCdfPareto_vv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_20, AgradCdfTestFixture, AgradCdfPareto_vv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_21, AgradCdfTestFixture, AgradCdfPareto_vv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_22, AgradCdfTestFixture, AgradCdfPareto_vv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_23, AgradCdfTestFixture, AgradCdfPareto_vv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_24, AgradCdfTestFixture, AgradCdfPareto_vv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_25, AgradCdfTestFixture, AgradCdfPareto_vv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_26, AgradCdfTestFixture, AgradCdfPareto_vv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_27, AgradCdfTestFixture, AgradCdfPareto_vv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_28, AgradCdfTestFixture, AgradCdfPareto_vv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_29, AgradCdfTestFixture, AgradCdfPareto_vv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_30, AgradCdfTestFixture, AgradCdfPareto_vv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_31, AgradCdfTestFixture, AgradCdfPareto_vv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_32, AgradCdfTestFixture, AgradCdfPareto_vv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_33, AgradCdfTestFixture, AgradCdfPareto_vv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_34, AgradCdfTestFixture, AgradCdfPareto_vv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_35, AgradCdfTestFixture, AgradCdfPareto_vv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_36, AgradCdfTestFixture, AgradCdfPareto_vv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_37, AgradCdfTestFixture, AgradCdfPareto_vv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_38, AgradCdfTestFixture, AgradCdfPareto_vv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_39, AgradCdfTestFixture, AgradCdfPareto_vv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_40, AgradCdfTestFixture, AgradCdfPareto_vv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_41, AgradCdfTestFixture, AgradCdfPareto_vv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_42, AgradCdfTestFixture, AgradCdfPareto_vv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_43, AgradCdfTestFixture, AgradCdfPareto_vv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_44, AgradCdfTestFixture, AgradCdfPareto_vv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_45, AgradCdfTestFixture, AgradCdfPareto_vv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_46, AgradCdfTestFixture, AgradCdfPareto_vv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_47, AgradCdfTestFixture, AgradCdfPareto_vv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_48, AgradCdfTestFixture, AgradCdfPareto_vv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_49, AgradCdfTestFixture, AgradCdfPareto_vv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_50, AgradCdfTestFixture, AgradCdfPareto_vv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_51, AgradCdfTestFixture, AgradCdfPareto_vv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_52, AgradCdfTestFixture, AgradCdfPareto_vv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_53, AgradCdfTestFixture, AgradCdfPareto_vv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_54, AgradCdfTestFixture, AgradCdfPareto_vv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_55, AgradCdfTestFixture, AgradCdfPareto_vv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_56, AgradCdfTestFixture, AgradCdfPareto_vv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_57, AgradCdfTestFixture, AgradCdfPareto_vv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_58, AgradCdfTestFixture, AgradCdfPareto_vv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_59, AgradCdfTestFixture, AgradCdfPareto_vv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_60, AgradCdfTestFixture, AgradCdfPareto_vv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_61, AgradCdfTestFixture, AgradCdfPareto_vv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_62, AgradCdfTestFixture, AgradCdfPareto_vv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_63, AgradCdfTestFixture, AgradCdfPareto_vv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_64, AgradCdfTestFixture, AgradCdfPareto_vv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_65, AgradCdfTestFixture, AgradCdfPareto_vv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_66, AgradCdfTestFixture, AgradCdfPareto_vv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_67, AgradCdfTestFixture, AgradCdfPareto_vv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_68, AgradCdfTestFixture, AgradCdfPareto_vv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_69, AgradCdfTestFixture, AgradCdfPareto_vv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_70, AgradCdfTestFixture, AgradCdfPareto_vv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_71, AgradCdfTestFixture, AgradCdfPareto_vv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_72, AgradCdfTestFixture, AgradCdfPareto_vv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_73, AgradCdfTestFixture, AgradCdfPareto_vv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_74, AgradCdfTestFixture, AgradCdfPareto_vv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_75, AgradCdfTestFixture, AgradCdfPareto_vv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_76, AgradCdfTestFixture, AgradCdfPareto_vv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_77, AgradCdfTestFixture, AgradCdfPareto_vv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_78, AgradCdfTestFixture, AgradCdfPareto_vv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_79, AgradCdfTestFixture, AgradCdfPareto_vv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_80, AgradCdfTestFixture, AgradCdfPareto_vv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_81, AgradCdfTestFixture, AgradCdfPareto_vv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_82, AgradCdfTestFixture, AgradCdfPareto_vv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_83, AgradCdfTestFixture, AgradCdfPareto_vv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_84, AgradCdfTestFixture, AgradCdfPareto_vv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_85, AgradCdfTestFixture, AgradCdfPareto_vv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_86, AgradCdfTestFixture, AgradCdfPareto_vv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_87, AgradCdfTestFixture, AgradCdfPareto_vv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_88, AgradCdfTestFixture, AgradCdfPareto_vv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_89, AgradCdfTestFixture, AgradCdfPareto_vv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_90, AgradCdfTestFixture, AgradCdfPareto_vv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_91, AgradCdfTestFixture, AgradCdfPareto_vv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_92, AgradCdfTestFixture, AgradCdfPareto_vv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_93, AgradCdfTestFixture, AgradCdfPareto_vv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_94, AgradCdfTestFixture, AgradCdfPareto_vv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_95, AgradCdfTestFixture, AgradCdfPareto_vv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_96, AgradCdfTestFixture, AgradCdfPareto_vv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_97, AgradCdfTestFixture, AgradCdfPareto_vv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_98, AgradCdfTestFixture, AgradCdfPareto_vv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_99, AgradCdfTestFixture, AgradCdfPareto_vv_99);
+
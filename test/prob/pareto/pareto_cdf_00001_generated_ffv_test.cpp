@@ -0,0 +1,278 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto/pareto_cdf_test.hpp>
+
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_100;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_101;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_102;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_103;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_104;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_105;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_106;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_107;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_108;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_109;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_110;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_111;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_112;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_113;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_114;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_115;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_116;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, double, empty, empty, empty> type_ffv_117;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty, empty, empty> type_ffv_118;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_119;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_120;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_121;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_122;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty, empty, empty> type_ffv_123;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_124;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_125;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_126;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_127;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_128;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_129;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_130;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_131;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_132;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_133;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_134;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_135;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_136;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_137;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_138;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_139;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_140;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_141;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_142;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_143;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_144;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_145;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_146;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_147;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_148;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_149;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_150;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_151;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_152;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_ffv_153;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_ffv_154;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_155;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_156;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_157;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_158;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_ffv_159;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_160;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_161;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_162;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_163;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_164;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_165;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_166;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_167;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_168;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_169;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_170;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_171;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_172;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_173;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_174;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_175;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_176;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_177;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_178;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_179;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_180;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_181;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_182;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_183;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_184;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_185;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_186;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_187;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_188;
+
+typedef std::tuple<AgradCdfPareto, type_ffv_100> AgradCdfPareto_ffv_100;
+typedef std::tuple<AgradCdfPareto, type_ffv_101> AgradCdfPareto_ffv_101;
+typedef std::tuple<AgradCdfPareto, type_ffv_102> AgradCdfPareto_ffv_102;
+typedef std::tuple<AgradCdfPareto, type_ffv_103> AgradCdfPareto_ffv_103;
+typedef std::tuple<AgradCdfPareto, type_ffv_104> AgradCdfPareto_ffv_104;
+typedef std::tuple<AgradCdfPareto, type_ffv_105> AgradCdfPareto_ffv_105;
+typedef std::tuple<AgradCdfPareto, type_ffv_106> AgradCdfPareto_ffv_106;
+typedef std::tuple<AgradCdfPareto, type_ffv_107> AgradCdfPareto_ffv_107;
+typedef std::tuple<AgradCdfPareto, type_ffv_108> AgradCdfPareto_ffv_108;
+typedef std::tuple<AgradCdfPareto, type_ffv_109> AgradCdfPareto_ffv_109;
+typedef std::tuple<AgradCdfPareto, type_ffv_110> AgradCdfPareto_ffv_110;
+typedef std::tuple<AgradCdfPareto, type_ffv_111> AgradCdfPareto_ffv_111;
+typedef std::tuple<AgradCdfPareto, type_ffv_112> AgradCdfPareto_ffv_112;
+typedef std::tuple<AgradCdfPareto, type_ffv_113> AgradCdfPareto_ffv_113;
+typedef std::tuple<AgradCdfPareto, type_ffv_114> AgradCdfPareto_ffv_114;
+typedef std::tuple<AgradCdfPareto, type_ffv_115> AgradCdfPareto_ffv_115;
+typedef std::tuple<AgradCdfPareto, type_ffv_116> AgradCdfPareto_ffv_116;
+typedef std::tuple<AgradCdfPareto, type_ffv_117> AgradCdfPareto_ffv_117;
+typedef std::tuple<AgradCdfPareto, type_ffv_118> AgradCdfPareto_ffv_118;
+typedef std::tuple<AgradCdfPareto, type_ffv_119> AgradCdfPareto_ffv_119;
+typedef std::tuple<AgradCdfPareto, type_ffv_120> AgradCdfPareto_ffv_120;
+typedef std::tuple<AgradCdfPareto, type_ffv_121> AgradCdfPareto_ffv_121;
+typedef std::tuple<AgradCdfPareto, type_ffv_122> AgradCdfPareto_ffv_122;
+typedef std::tuple<AgradCdfPareto, type_ffv_123> AgradCdfPareto_ffv_123;
+typedef std::tuple<AgradCdfPareto, type_ffv_124> AgradCdfPareto_ffv_124;
+typedef std::tuple<AgradCdfPareto, type_ffv_125> AgradCdfPareto_ffv_125;
+typedef std::tuple<AgradCdfPareto, type_ffv_126> AgradCdfPareto_ffv_126;
+typedef std::tuple<AgradCdfPareto, type_ffv_127> AgradCdfPareto_ffv_127;
+typedef std::tuple<AgradCdfPareto, type_ffv_128> AgradCdfPareto_ffv_128;
+typedef std::tuple<AgradCdfPareto, type_ffv_129> AgradCdfPareto_ffv_129;
+typedef std::tuple<AgradCdfPareto, type_ffv_130> AgradCdfPareto_ffv_130;
+typedef std::tuple<AgradCdfPareto, type_ffv_131> AgradCdfPareto_ffv_131;
+typedef std::tuple<AgradCdfPareto, type_ffv_132> AgradCdfPareto_ffv_132;
+typedef std::tuple<AgradCdfPareto, type_ffv_133> AgradCdfPareto_ffv_133;
+typedef std::tuple<AgradCdfPareto, type_ffv_134> AgradCdfPareto_ffv_134;
+typedef std::tuple<AgradCdfPareto, type_ffv_135> AgradCdfPareto_ffv_135;
+typedef std::tuple<AgradCdfPareto, type_ffv_136> AgradCdfPareto_ffv_136;
+typedef std::tuple<AgradCdfPareto, type_ffv_137> AgradCdfPareto_ffv_137;
+typedef std::tuple<AgradCdfPareto, type_ffv_138> AgradCdfPareto_ffv_138;
+typedef std::tuple<AgradCdfPareto, type_ffv_139> AgradCdfPareto_ffv_139;
+typedef std::tuple<AgradCdfPareto, type_ffv_140> AgradCdfPareto_ffv_140;
+typedef std::tuple<AgradCdfPareto, type_ffv_141> AgradCdfPareto_ffv_141;
+typedef std::tuple<AgradCdfPareto, type_ffv_142> AgradCdfPareto_ffv_142;
+typedef std::tuple<AgradCdfPareto, type_ffv_143> AgradCdfPareto_ffv_143;
+typedef std::tuple<AgradCdfPareto, type_ffv_144> AgradCdfPareto_ffv_144;
+typedef std::tuple<AgradCdfPareto, type_ffv_145> AgradCdfPareto_ffv_145;
+typedef std::tuple<AgradCdfPareto, type_ffv_146> AgradCdfPareto_ffv_146;
+typedef std::tuple<AgradCdfPareto, type_ffv_147> AgradCdfPareto_ffv_147;
+typedef std::tuple<AgradCdfPareto, type_ffv_148> AgradCdfPareto_ffv_148;
+typedef std::tuple<AgradCdfPareto, type_ffv_149> AgradCdfPareto_ffv_149;
+typedef std::tuple<AgradCdfPareto, type_ffv_150> AgradCdfPareto_ffv_150;
+typedef std::tuple<AgradCdfPareto, type_ffv_151> AgradCdfPareto_ffv_151;
+typedef std::tuple<AgradCdfPareto, type_ffv_152> AgradCdfPareto_ffv_152;
+typedef std::tuple<AgradCdfPareto, type_ffv_153> AgradCdfPareto_ffv_153;
+typedef std::tuple<AgradCdfPareto, type_ffv_154> AgradCdfPareto_ffv_154;
+typedef std::tuple<AgradCdfPareto, type_ffv_155> AgradCdfPareto_ffv_155;
+typedef std::tuple<AgradCdfPareto, type_ffv_156> AgradCdfPareto_ffv_156;
+typedef std::tuple<AgradCdfPareto, type_ffv_157> AgradCdfPareto_ffv_157;
+typedef std::tuple<AgradCdfPareto, type_ffv_158> AgradCdfPareto_ffv_158;
+typedef std::tuple<AgradCdfPareto, type_ffv_159> AgradCdfPareto_ffv_159;
+typedef std::tuple<AgradCdfPareto, type_ffv_160> AgradCdfPareto_ffv_160;
+typedef std::tuple<AgradCdfPareto, type_ffv_161> AgradCdfPareto_ffv_161;
+typedef std::tuple<AgradCdfPareto, type_ffv_162> AgradCdfPareto_ffv_162;
+typedef std::tuple<AgradCdfPareto, type_ffv_163> AgradCdfPareto_ffv_163;
+typedef std::tuple<AgradCdfPareto, type_ffv_164> AgradCdfPareto_ffv_164;
+typedef std::tuple<AgradCdfPareto, type_ffv_165> AgradCdfPareto_ffv_165;
+typedef std::tuple<AgradCdfPareto, type_ffv_166> AgradCdfPareto_ffv_166;
+typedef std::tuple<AgradCdfPareto, type_ffv_167> AgradCdfPareto_ffv_167;
+typedef std::tuple<AgradCdfPareto, type_ffv_168> AgradCdfPareto_ffv_168;
+typedef std::tuple<AgradCdfPareto, type_ffv_169> AgradCdfPareto_ffv_169;
+typedef std::tuple<AgradCdfPareto, type_ffv_170> AgradCdfPareto_ffv_170;
+typedef std::tuple<AgradCdfPareto, type_ffv_171> AgradCdfPareto_ffv_171;
+typedef std::tuple<AgradCdfPareto, type_ffv_172> AgradCdfPareto_ffv_172;
+typedef std::tuple<AgradCdfPareto, type_ffv_173> AgradCdfPareto_ffv_173;
+typedef std::tuple<AgradCdfPareto, type_ffv_174> AgradCdfPareto_ffv_174;
+typedef std::tuple<AgradCdfPareto, type_ffv_175> AgradCdfPareto_ffv_175;
+typedef std::tuple<AgradCdfPareto, type_ffv_176> AgradCdfPareto_ffv_176;
+typedef std::tuple<AgradCdfPareto, type_ffv_177> AgradCdfPareto_ffv_177;
+typedef std::tuple<AgradCdfPareto, type_ffv_178> AgradCdfPareto_ffv_178;
+typedef std::tuple<AgradCdfPareto, type_ffv_179> AgradCdfPareto_ffv_179;
+typedef std::tuple<AgradCdfPareto, type_ffv_180> AgradCdfPareto_ffv_180;
+typedef std::tuple<AgradCdfPareto, type_ffv_181> AgradCdfPareto_ffv_181;
+typedef std::tuple<AgradCdfPareto, type_ffv_182> AgradCdfPareto_ffv_182;
+typedef std::tuple<AgradCdfPareto, type_ffv_183> AgradCdfPareto_ffv_183;
+typedef std::tuple<AgradCdfPareto, type_ffv_184> AgradCdfPareto_ffv_184;
+typedef std::tuple<AgradCdfPareto, type_ffv_185> AgradCdfPareto_ffv_185;
+typedef std::tuple<AgradCdfPareto, type_ffv_186> AgradCdfPareto_ffv_186;
+typedef std::tuple<AgradCdfPareto, type_ffv_187> AgradCdfPareto_ffv_187;
+typedef std::tuple<AgradCdfPareto, type_ffv_188> AgradCdfPareto_ffv_188;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_100, AgradCdfTestFixture, AgradCdfPareto_ffv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_101, AgradCdfTestFixture, AgradCdfPareto_ffv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_102, AgradCdfTestFixture, AgradCdfPareto_ffv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_103, AgradCdfTestFixture, AgradCdfPareto_ffv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_104, AgradCdfTestFixture, AgradCdfPareto_ffv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_105, AgradCdfTestFixture, AgradCdfPareto_ffv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_106, AgradCdfTestFixture, AgradCdfPareto_ffv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_107, AgradCdfTestFixture, AgradCdfPareto_ffv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_108, AgradCdfTestFixture, AgradCdfPareto_ffv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_109, AgradCdfTestFixture, AgradCdfPareto_ffv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_110, AgradCdfTestFixture, AgradCdfPareto_ffv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_111, AgradCdfTestFixture, AgradCdfPareto_ffv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_112, AgradCdfTestFixture, AgradCdfPareto_ffv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_113, AgradCdfTestFixture, AgradCdfPareto_ffv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_114, AgradCdfTestFixture, AgradCdfPareto_ffv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_115, AgradCdfTestFixture, AgradCdfPareto_ffv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_116, AgradCdfTestFixture, AgradCdfPareto_ffv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_117, AgradCdfTestFixture, AgradCdfPareto_ffv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_118, AgradCdfTestFixture, AgradCdfPareto_ffv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_119, AgradCdfTestFixture, AgradCdfPareto_ffv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_120, AgradCdfTestFixture, AgradCdfPareto_ffv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_121, AgradCdfTestFixture, AgradCdfPareto_ffv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_122, AgradCdfTestFixture, AgradCdfPareto_ffv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_123, AgradCdfTestFixture, AgradCdfPareto_ffv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_124, AgradCdfTestFixture, AgradCdfPareto_ffv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_125, AgradCdfTestFixture, AgradCdfPareto_ffv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_126, AgradCdfTestFixture, AgradCdfPareto_ffv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_127, AgradCdfTestFixture, AgradCdfPareto_ffv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_128, AgradCdfTestFixture, AgradCdfPareto_ffv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_129, AgradCdfTestFixture, AgradCdfPareto_ffv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_130, AgradCdfTestFixture, AgradCdfPareto_ffv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_131, AgradCdfTestFixture, AgradCdfPareto_ffv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_132, AgradCdfTestFixture, AgradCdfPareto_ffv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_133, AgradCdfTestFixture, AgradCdfPareto_ffv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_134, AgradCdfTestFixture, AgradCdfPareto_ffv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_135, AgradCdfTestFixture, AgradCdfPareto_ffv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_136, AgradCdfTestFixture, AgradCdfPareto_ffv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_137, AgradCdfTestFixture, AgradCdfPareto_ffv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_138, AgradCdfTestFixture, AgradCdfPareto_ffv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_139, AgradCdfTestFixture, AgradCdfPareto_ffv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_140, AgradCdfTestFixture, AgradCdfPareto_ffv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_141, AgradCdfTestFixture, AgradCdfPareto_ffv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_142, AgradCdfTestFixture, AgradCdfPareto_ffv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_143, AgradCdfTestFixture, AgradCdfPareto_ffv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_144, AgradCdfTestFixture, AgradCdfPareto_ffv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_145, AgradCdfTestFixture, AgradCdfPareto_ffv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_146, AgradCdfTestFixture, AgradCdfPareto_ffv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_147, AgradCdfTestFixture, AgradCdfPareto_ffv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_148, AgradCdfTestFixture, AgradCdfPareto_ffv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_149, AgradCdfTestFixture, AgradCdfPareto_ffv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_150, AgradCdfTestFixture, AgradCdfPareto_ffv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_151, AgradCdfTestFixture, AgradCdfPareto_ffv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_152, AgradCdfTestFixture, AgradCdfPareto_ffv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_153, AgradCdfTestFixture, AgradCdfPareto_ffv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_154, AgradCdfTestFixture, AgradCdfPareto_ffv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_155, AgradCdfTestFixture, AgradCdfPareto_ffv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_156, AgradCdfTestFixture, AgradCdfPareto_ffv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_157, AgradCdfTestFixture, AgradCdfPareto_ffv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_158, AgradCdfTestFixture, AgradCdfPareto_ffv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_159, AgradCdfTestFixture, AgradCdfPareto_ffv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_160, AgradCdfTestFixture, AgradCdfPareto_ffv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_161, AgradCdfTestFixture, AgradCdfPareto_ffv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_162, AgradCdfTestFixture, AgradCdfPareto_ffv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_163, AgradCdfTestFixture, AgradCdfPareto_ffv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_164, AgradCdfTestFixture, AgradCdfPareto_ffv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_165, AgradCdfTestFixture, AgradCdfPareto_ffv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_166, AgradCdfTestFixture, AgradCdfPareto_ffv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_167, AgradCdfTestFixture, AgradCdfPareto_ffv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_168, AgradCdfTestFixture, AgradCdfPareto_ffv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_169, AgradCdfTestFixture, AgradCdfPareto_ffv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_170, AgradCdfTestFixture, AgradCdfPareto_ffv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_171, AgradCdfTestFixture, AgradCdfPareto_ffv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_172, AgradCdfTestFixture, AgradCdfPareto_ffv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_173, AgradCdfTestFixture, AgradCdfPareto_ffv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_174, AgradCdfTestFixture, AgradCdfPareto_ffv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_175, AgradCdfTestFixture, AgradCdfPareto_ffv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_176, AgradCdfTestFixture, AgradCdfPareto_ffv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_177, AgradCdfTestFixture, AgradCdfPareto_ffv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_178, AgradCdfTestFixture, AgradCdfPareto_ffv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_179, AgradCdfTestFixture, AgradCdfPareto_ffv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_180, AgradCdfTestFixture, AgradCdfPareto_ffv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_181, AgradCdfTestFixture, AgradCdfPareto_ffv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_182, AgradCdfTestFixture, AgradCdfPareto_ffv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_183, AgradCdfTestFixture, AgradCdfPareto_ffv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_184, AgradCdfTestFixture, AgradCdfPareto_ffv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_185, AgradCdfTestFixture, AgradCdfPareto_ffv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_186, AgradCdfTestFixture, AgradCdfPareto_ffv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_187, AgradCdfTestFixture, AgradCdfPareto_ffv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_ffv_188, AgradCdfTestFixture, AgradCdfPareto_ffv_188);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto/pareto_cdf_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_100;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_101;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_102;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_103;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_104;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_105;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_106;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_107;
+typedef std::tuple<var, double, double, empty, empty, empty> type_v_108;
+typedef std::tuple<var, double, std::vector<double>, empty, empty, empty> type_v_109;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_110;
+typedef std::tuple<var, double, var, empty, empty, empty> type_v_111;
+typedef std::tuple<var, double, std::vector<var>, empty, empty, empty> type_v_112;
+typedef std::tuple<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_113;
+typedef std::tuple<var, std::vector<double>, double, empty, empty, empty> type_v_114;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_115;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_116;
+typedef std::tuple<var, std::vector<double>, var, empty, empty, empty> type_v_117;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_118;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_119;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_120;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_121;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_122;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_123;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_124;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_125;
+typedef std::tuple<var, var, double, empty, empty, empty> type_v_126;
+typedef std::tuple<var, var, std::vector<double>, empty, empty, empty> type_v_127;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_128;
+typedef std::tuple<var, var, var, empty, empty, empty> type_v_129;
+typedef std::tuple<var, var, std::vector<var>, empty, empty, empty> type_v_130;
+typedef std::tuple<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_131;
+typedef std::tuple<var, std::vector<var>, double, empty, empty, empty> type_v_132;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_133;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_134;
+typedef std::tuple<var, std::vector<var>, var, empty, empty, empty> type_v_135;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_136;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_137;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_138;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_139;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_140;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_141;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_142;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_143;
+typedef std::tuple<std::vector<var>, double, double, empty, empty, empty> type_v_144;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, empty, empty, empty> type_v_145;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_146;
+typedef std::tuple<std::vector<var>, double, var, empty, empty, empty> type_v_147;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, empty, empty, empty> type_v_148;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_149;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, empty, empty, empty> type_v_150;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_151;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_152;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, empty, empty, empty> type_v_153;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_154;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_155;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_156;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_157;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_158;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_159;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_160;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_161;
+typedef std::tuple<std::vector<var>, var, double, empty, empty, empty> type_v_162;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, empty, empty, empty> type_v_163;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_164;
+typedef std::tuple<std::vector<var>, var, var, empty, empty, empty> type_v_165;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, empty, empty, empty> type_v_166;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_167;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, empty, empty, empty> type_v_168;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_169;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_170;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, empty, empty, empty> type_v_171;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_172;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_173;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_174;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_175;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_176;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_177;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_178;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_179;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_v_180;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_v_181;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_182;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_v_183;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_v_184;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_185;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_v_186;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_187;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_188;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_v_189;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_190;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_191;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_192;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_193;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_194;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_195;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_196;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_197;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_v_198;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_v_199;
+
+typedef std::tuple<AgradCdfPareto, type_v_100> AgradCdfPareto_v_100;
+typedef std::tuple<AgradCdfPareto, type_v_101> AgradCdfPareto_v_101;
+typedef std::tuple<AgradCdfPareto, type_v_102> AgradCdfPareto_v_102;
+typedef std::tuple<AgradCdfPareto, type_v_103> AgradCdfPareto_v_103;
+typedef std::tuple<AgradCdfPareto, type_v_104> AgradCdfPareto_v_104;
+typedef std::tuple<AgradCdfPareto, type_v_105> AgradCdfPareto_v_105;
+typedef std::tuple<AgradCdfPareto, type_v_106> AgradCdfPareto_v_106;
+typedef std::tuple<AgradCdfPareto, type_v_107> AgradCdfPareto_v_107;
+typedef std::tuple<AgradCdfPareto, type_v_108> AgradCdfPareto_v_108;
+typedef std::tuple<AgradCdfPareto, type_v_109> AgradCdfPareto_v_109;
+typedef std::tuple<AgradCdfPareto, type_v_110> AgradCdfPareto_v_110;
+typedef std::tuple<AgradCdfPareto, type_v_111> AgradCdfPareto_v_111;
+typedef std::tuple<AgradCdfPareto, type_v_112> AgradCdfPareto_v_112;
+typedef std::tuple<AgradCdfPareto, type_v_113> AgradCdfPareto_v_113;
+typedef std::tuple<AgradCdfPareto, type_v_114> AgradCdfPareto_v_114;
+typedef std::tuple<AgradCdfPareto, type_v_115> AgradCdfPareto_v_115;
+typedef std::tuple<AgradCdfPareto, type_v_116> AgradCdfPareto_v_116;
+typedef std::tuple<AgradCdfPareto, type_v_117> AgradCdfPareto_v_117;
+typedef std::tuple<AgradCdfPareto, type_v_118> AgradCdfPareto_v_118;
+typedef std::tuple<AgradCdfPareto, type_v_119> AgradCdfPareto_v_119;
+typedef std::tuple<AgradCdfPareto, type_v_120> AgradCdfPareto_v_120;
+typedef std::tuple<AgradCdfPareto, type_v_121> AgradCdfPareto_v_121;
+typedef std::tuple<AgradCdfPareto, type_v_122> AgradCdfPareto_v_122;
+typedef std::tuple<AgradCdfPareto, type_v_123> AgradCdfPareto_v_123;
+typedef std::tuple<AgradCdfPareto, type_v_124> AgradCdfPareto_v_124;
+typedef std::tuple<AgradCdfPareto, type_v_125> AgradCdfPareto_v_125;
+typedef std::tuple<AgradCdfPareto, type_v_126> AgradCdfPareto_v_126;
+typedef std::tuple<AgradCdfPareto, type_v_127> AgradCdfPareto_v_127;
+typedef std::tuple<AgradCdfPareto, type_v_128> AgradCdfPareto_v_128;
+typedef std::tuple<AgradCdfPareto, type_v_129> AgradCdfPareto_v_129;
+typedef std::tuple<AgradCdfPareto, type_v_130> AgradCdfPareto_v_130;
+typedef std::tuple<AgradCdfPareto, type_v_131> AgradCdfPareto_v_131;
+typedef std::tuple<AgradCdfPareto, type_v_132> AgradCdfPareto_v_132;
+typedef std::tuple<AgradCdfPareto, type_v_133> AgradCdfPareto_v_133;
+typedef std::tuple<AgradCdfPareto, type_v_134> AgradCdfPareto_v_134;
+typedef std::tuple<AgradCdfPareto, type_v_135> AgradCdfPareto_v_135;
+typedef std::tuple<AgradCdfPareto, type_v_136> AgradCdfPareto_v_136;
+typedef std::tuple<AgradCdfPareto, type_v_137> AgradCdfPareto_v_137;
+typedef std::tuple<AgradCdfPareto, type_v_138> AgradCdfPareto_v_138;
+typedef std::tuple<AgradCdfPareto, type_v_139> AgradCdfPareto_v_139;
+typedef std::tuple<AgradCdfPareto, type_v_140> AgradCdfPareto_v_140;
+typedef std::tuple<AgradCdfPareto, type_v_141> AgradCdfPareto_v_141;
+typedef std::tuple<AgradCdfPareto, type_v_142> AgradCdfPareto_v_142;
+typedef std::tuple<AgradCdfPareto, type_v_143> AgradCdfPareto_v_143;
+typedef std::tuple<AgradCdfPareto, type_v_144> AgradCdfPareto_v_144;
+typedef std::tuple<AgradCdfPareto, type_v_145> AgradCdfPareto_v_145;
+typedef std::tuple<AgradCdfPareto, type_v_146> AgradCdfPareto_v_146;
+typedef std::tuple<AgradCdfPareto, type_v_147> AgradCdfPareto_v_147;
+typedef std::tuple<AgradCdfPareto, type_v_148> AgradCdfPareto_v_148;
+typedef std::tuple<AgradCdfPareto, type_v_149> AgradCdfPareto_v_149;
+typedef std::tuple<AgradCdfPareto, type_v_150> AgradCdfPareto_v_150;
+typedef std::tuple<AgradCdfPareto, type_v_151> AgradCdfPareto_v_151;
+typedef std::tuple<AgradCdfPareto, type_v_152> AgradCdfPareto_v_152;
+typedef std::tuple<AgradCdfPareto, type_v_153> AgradCdfPareto_v_153;
+typedef std::tuple<AgradCdfPareto, type_v_154> AgradCdfPareto_v_154;
+typedef std::tuple<AgradCdfPareto, type_v_155> AgradCdfPareto_v_155;
+typedef std::tuple<AgradCdfPareto, type_v_156> AgradCdfPareto_v_156;
+typedef std::tuple<AgradCdfPareto, type_v_157> AgradCdfPareto_v_157;
+typedef std::tuple<AgradCdfPareto, type_v_158> AgradCdfPareto_v_158;
+typedef std::tuple<AgradCdfPareto, type_v_159> AgradCdfPareto_v_159;
+typedef std::tuple<AgradCdfPareto, type_v_160> AgradCdfPareto_v_160;
+typedef std::tuple<AgradCdfPareto, type_v_161> AgradCdfPareto_v_161;
+typedef std::tuple<AgradCdfPareto, type_v_162> AgradCdfPareto_v_162;
+typedef std::tuple<AgradCdfPareto, type_v_163> AgradCdfPareto_v_163;
+typedef std::tuple<AgradCdfPareto, type_v_164> AgradCdfPareto_v_164;
+typedef std::tuple<AgradCdfPareto, type_v_165> AgradCdfPareto_v_165;
+typedef std::tuple<AgradCdfPareto, type_v_166> AgradCdfPareto_v_166;
+typedef std::tuple<AgradCdfPareto, type_v_167> AgradCdfPareto_v_167;
+typedef std::tuple<AgradCdfPareto, type_v_168> AgradCdfPareto_v_168;
+typedef std::tuple<AgradCdfPareto, type_v_169> AgradCdfPareto_v_169;
+typedef std::tuple<AgradCdfPareto, type_v_170> AgradCdfPareto_v_170;
+typedef std::tuple<AgradCdfPareto, type_v_171> AgradCdfPareto_v_171;
+typedef std::tuple<AgradCdfPareto, type_v_172> AgradCdfPareto_v_172;
+typedef std::tuple<AgradCdfPareto, type_v_173> AgradCdfPareto_v_173;
+typedef std::tuple<AgradCdfPareto, type_v_174> AgradCdfPareto_v_174;
+typedef std::tuple<AgradCdfPareto, type_v_175> AgradCdfPareto_v_175;
+typedef std::tuple<AgradCdfPareto, type_v_176> AgradCdfPareto_v_176;
+typedef std::tuple<AgradCdfPareto, type_v_177> AgradCdfPareto_v_177;
+typedef std::tuple<AgradCdfPareto, type_v_178> AgradCdfPareto_v_178;
+typedef std::tuple<AgradCdfPareto, type_v_179> AgradCdfPareto_v_179;
+typedef std::tuple<AgradCdfPareto, type_v_180> AgradCdfPareto_v_180;
+typedef std::tuple<AgradCdfPareto, type_v_181> AgradCdfPareto_v_181;
+typedef std::tuple<AgradCdfPareto, type_v_182> AgradCdfPareto_v_182;
+typedef std::tuple<AgradCdfPareto, type_v_183> AgradCdfPareto_v_183;
+typedef std::tuple<AgradCdfPareto, type_v_184> AgradCdfPareto_v_184;
+typedef std::tuple<AgradCdfPareto, type_v_185> AgradCdfPareto_v_185;
+typedef std::tuple<AgradCdfPareto, type_v_186> AgradCdfPareto_v_186;
+typedef std::tuple<AgradCdfPareto, type_v_187> AgradCdfPareto_v_187;
+typedef std::tuple<AgradCdfPareto, type_v_188> AgradCdfPareto_v_188;
+typedef std::tuple<AgradCdfPareto, type_v_189> AgradCdfPareto_v_189;
+typedef std::tuple<AgradCdfPareto, type_v_190> AgradCdfPareto_v_190;
+typedef std::tuple<AgradCdfPareto, type_v_191> AgradCdfPareto_v_191;
+typedef std::tuple<AgradCdfPareto, type_v_192> AgradCdfPareto_v_192;
+typedef std::tuple<AgradCdfPareto, type_v_193> AgradCdfPareto_v_193;
+typedef std::tuple<AgradCdfPareto, type_v_194> AgradCdfPareto_v_194;
+typedef std::tuple<AgradCdfPareto, type_v_195> AgradCdfPareto_v_195;
+typedef std::tuple<AgradCdfPareto, type_v_196> AgradCdfPareto_v_196;
+typedef std::tuple<AgradCdfPareto, type_v_197> AgradCdfPareto_v_197;
+typedef std::tuple<AgradCdfPareto, type_v_198> AgradCdfPareto_v_198;
+typedef std::tuple<AgradCdfPareto, type_v_199> AgradCdfPareto_v_199;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_100, AgradCdfTestFixture, AgradCdfPareto_v_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_101, AgradCdfTestFixture, AgradCdfPareto_v_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_102, AgradCdfTestFixture, AgradCdfPareto_v_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_103, AgradCdfTestFixture, AgradCdfPareto_v_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_104, AgradCdfTestFixture, AgradCdfPareto_v_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_105, AgradCdfTestFixture, AgradCdfPareto_v_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_106, AgradCdfTestFixture, AgradCdfPareto_v_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_107, AgradCdfTestFixture, AgradCdfPareto_v_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_108, AgradCdfTestFixture, AgradCdfPareto_v_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_109, AgradCdfTestFixture, AgradCdfPareto_v_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_110, AgradCdfTestFixture, AgradCdfPareto_v_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_111, AgradCdfTestFixture, AgradCdfPareto_v_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_112, AgradCdfTestFixture, AgradCdfPareto_v_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_113, AgradCdfTestFixture, AgradCdfPareto_v_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_114, AgradCdfTestFixture, AgradCdfPareto_v_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_115, AgradCdfTestFixture, AgradCdfPareto_v_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_116, AgradCdfTestFixture, AgradCdfPareto_v_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_117, AgradCdfTestFixture, AgradCdfPareto_v_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_118, AgradCdfTestFixture, AgradCdfPareto_v_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_119, AgradCdfTestFixture, AgradCdfPareto_v_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_120, AgradCdfTestFixture, AgradCdfPareto_v_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_121, AgradCdfTestFixture, AgradCdfPareto_v_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_122, AgradCdfTestFixture, AgradCdfPareto_v_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_123, AgradCdfTestFixture, AgradCdfPareto_v_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_124, AgradCdfTestFixture, AgradCdfPareto_v_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_125, AgradCdfTestFixture, AgradCdfPareto_v_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_126, AgradCdfTestFixture, AgradCdfPareto_v_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_127, AgradCdfTestFixture, AgradCdfPareto_v_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_128, AgradCdfTestFixture, AgradCdfPareto_v_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_129, AgradCdfTestFixture, AgradCdfPareto_v_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_130, AgradCdfTestFixture, AgradCdfPareto_v_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_131, AgradCdfTestFixture, AgradCdfPareto_v_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_132, AgradCdfTestFixture, AgradCdfPareto_v_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_133, AgradCdfTestFixture, AgradCdfPareto_v_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_134, AgradCdfTestFixture, AgradCdfPareto_v_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_135, AgradCdfTestFixture, AgradCdfPareto_v_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_136, AgradCdfTestFixture, AgradCdfPareto_v_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_137, AgradCdfTestFixture, AgradCdfPareto_v_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_138, AgradCdfTestFixture, AgradCdfPareto_v_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_139, AgradCdfTestFixture, AgradCdfPareto_v_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_140, AgradCdfTestFixture, AgradCdfPareto_v_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_141, AgradCdfTestFixture, AgradCdfPareto_v_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_142, AgradCdfTestFixture, AgradCdfPareto_v_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_143, AgradCdfTestFixture, AgradCdfPareto_v_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_144, AgradCdfTestFixture, AgradCdfPareto_v_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_145, AgradCdfTestFixture, AgradCdfPareto_v_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_146, AgradCdfTestFixture, AgradCdfPareto_v_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_147, AgradCdfTestFixture, AgradCdfPareto_v_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_148, AgradCdfTestFixture, AgradCdfPareto_v_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_149, AgradCdfTestFixture, AgradCdfPareto_v_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_150, AgradCdfTestFixture, AgradCdfPareto_v_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_151, AgradCdfTestFixture, AgradCdfPareto_v_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_152, AgradCdfTestFixture, AgradCdfPareto_v_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_153, AgradCdfTestFixture, AgradCdfPareto_v_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_154, AgradCdfTestFixture, AgradCdfPareto_v_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_155, AgradCdfTestFixture, AgradCdfPareto_v_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_156, AgradCdfTestFixture, AgradCdfPareto_v_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_157, AgradCdfTestFixture, AgradCdfPareto_v_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_158, AgradCdfTestFixture, AgradCdfPareto_v_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_159, AgradCdfTestFixture, AgradCdfPareto_v_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_160, AgradCdfTestFixture, AgradCdfPareto_v_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_161, AgradCdfTestFixture, AgradCdfPareto_v_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_162, AgradCdfTestFixture, AgradCdfPareto_v_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_163, AgradCdfTestFixture, AgradCdfPareto_v_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_164, AgradCdfTestFixture, AgradCdfPareto_v_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_165, AgradCdfTestFixture, AgradCdfPareto_v_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_166, AgradCdfTestFixture, AgradCdfPareto_v_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_167, AgradCdfTestFixture, AgradCdfPareto_v_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_168, AgradCdfTestFixture, AgradCdfPareto_v_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_169, AgradCdfTestFixture, AgradCdfPareto_v_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_170, AgradCdfTestFixture, AgradCdfPareto_v_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_171, AgradCdfTestFixture, AgradCdfPareto_v_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_172, AgradCdfTestFixture, AgradCdfPareto_v_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_173, AgradCdfTestFixture, AgradCdfPareto_v_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_174, AgradCdfTestFixture, AgradCdfPareto_v_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_175, AgradCdfTestFixture, AgradCdfPareto_v_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_176, AgradCdfTestFixture, AgradCdfPareto_v_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_177, AgradCdfTestFixture, AgradCdfPareto_v_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_178, AgradCdfTestFixture, AgradCdfPareto_v_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_179, AgradCdfTestFixture, AgradCdfPareto_v_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_180, AgradCdfTestFixture, AgradCdfPareto_v_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_181, AgradCdfTestFixture, AgradCdfPareto_v_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_182, AgradCdfTestFixture, AgradCdfPareto_v_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_183, AgradCdfTestFixture, AgradCdfPareto_v_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_184, AgradCdfTestFixture, AgradCdfPareto_v_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_185, AgradCdfTestFixture, AgradCdfPareto_v_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_186, AgradCdfTestFixture, AgradCdfPareto_v_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_187, AgradCdfTestFixture, AgradCdfPareto_v_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_188, AgradCdfTestFixture, AgradCdfPareto_v_188);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_189, AgradCdfTestFixture, AgradCdfPareto_v_189);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_190, AgradCdfTestFixture, AgradCdfPareto_v_190);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_191, AgradCdfTestFixture, AgradCdfPareto_v_191);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_192, AgradCdfTestFixture, AgradCdfPareto_v_192);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_193, AgradCdfTestFixture, AgradCdfPareto_v_193);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_194, AgradCdfTestFixture, AgradCdfPareto_v_194);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_195, AgradCdfTestFixture, AgradCdfPareto_v_195);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_196, AgradCdfTestFixture, AgradCdfPareto_v_196);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_197, AgradCdfTestFixture, AgradCdfPareto_v_197);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_198, AgradCdfTestFixture, AgradCdfPareto_v_198);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_v_199, AgradCdfTestFixture, AgradCdfPareto_v_199);
+
@@ -0,0 +1,278 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto/pareto_cdf_test.hpp>
+
+typedef std::tuple<var, var, std::vector<double>, empty, empty, empty> type_vv_100;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_101;
+typedef std::tuple<var, var, var, empty, empty, empty> type_vv_102;
+typedef std::tuple<var, var, std::vector<var>, empty, empty, empty> type_vv_103;
+typedef std::tuple<var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_104;
+typedef std::tuple<var, std::vector<var>, double, empty, empty, empty> type_vv_105;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_106;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_107;
+typedef std::tuple<var, std::vector<var>, var, empty, empty, empty> type_vv_108;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_109;
+typedef std::tuple<var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_110;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_111;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_112;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_113;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_114;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_115;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_116;
+typedef std::tuple<std::vector<var>, double, double, empty, empty, empty> type_vv_117;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, empty, empty, empty> type_vv_118;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_119;
+typedef std::tuple<std::vector<var>, double, var, empty, empty, empty> type_vv_120;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, empty, empty, empty> type_vv_121;
+typedef std::tuple<std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_122;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, empty, empty, empty> type_vv_123;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_124;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_125;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, empty, empty, empty> type_vv_126;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_127;
+typedef std::tuple<std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_128;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_129;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_130;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_131;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_132;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_133;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_134;
+typedef std::tuple<std::vector<var>, var, double, empty, empty, empty> type_vv_135;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, empty, empty, empty> type_vv_136;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_137;
+typedef std::tuple<std::vector<var>, var, var, empty, empty, empty> type_vv_138;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, empty, empty, empty> type_vv_139;
+typedef std::tuple<std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_140;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, empty, empty, empty> type_vv_141;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_142;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_143;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, empty, empty, empty> type_vv_144;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_145;
+typedef std::tuple<std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_146;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_147;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_148;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_149;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_150;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_151;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_152;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, empty, empty, empty> type_vv_153;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, empty, empty, empty> type_vv_154;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_155;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, empty, empty, empty> type_vv_156;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, empty, empty, empty> type_vv_157;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_158;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, empty, empty, empty> type_vv_159;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_160;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_161;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, empty, empty, empty> type_vv_162;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_163;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_164;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_165;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_166;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_167;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_168;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_169;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_170;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, empty, empty, empty> type_vv_171;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, empty, empty, empty> type_vv_172;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_173;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, empty, empty, empty> type_vv_174;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, empty, empty, empty> type_vv_175;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_176;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, empty, empty, empty> type_vv_177;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_178;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_179;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, empty, empty, empty> type_vv_180;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_181;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_182;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_183;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_184;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_185;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_186;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_187;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_188;
+
+typedef std::tuple<AgradCdfPareto, type_vv_100> AgradCdfPareto_vv_100;
+typedef std::tuple<AgradCdfPareto, type_vv_101> AgradCdfPareto_vv_101;
+typedef std::tuple<AgradCdfPareto, type_vv_102> AgradCdfPareto_vv_102;
+typedef std::tuple<AgradCdfPareto, type_vv_103> AgradCdfPareto_vv_103;
+typedef std::tuple<AgradCdfPareto, type_vv_104> AgradCdfPareto_vv_104;
+typedef std::tuple<AgradCdfPareto, type_vv_105> AgradCdfPareto_vv_105;
+typedef std::tuple<AgradCdfPareto, type_vv_106> AgradCdfPareto_vv_106;
+typedef std::tuple<AgradCdfPareto, type_vv_107> AgradCdfPareto_vv_107;
+typedef std::tuple<AgradCdfPareto, type_vv_108> AgradCdfPareto_vv_108;
+typedef std::tuple<AgradCdfPareto, type_vv_109> AgradCdfPareto_vv_109;
+typedef std::tuple<AgradCdfPareto, type_vv_110> AgradCdfPareto_vv_110;
+typedef std::tuple<AgradCdfPareto, type_vv_111> AgradCdfPareto_vv_111;
+typedef std::tuple<AgradCdfPareto, type_vv_112> AgradCdfPareto_vv_112;
+typedef std::tuple<AgradCdfPareto, type_vv_113> AgradCdfPareto_vv_113;
+typedef std::tuple<AgradCdfPareto, type_vv_114> AgradCdfPareto_vv_114;
+typedef std::tuple<AgradCdfPareto, type_vv_115> AgradCdfPareto_vv_115;
+typedef std::tuple<AgradCdfPareto, type_vv_116> AgradCdfPareto_vv_116;
+typedef std::tuple<AgradCdfPareto, type_vv_117> AgradCdfPareto_vv_117;
+typedef std::tuple<AgradCdfPareto, type_vv_118> AgradCdfPareto_vv_118;
+typedef std::tuple<AgradCdfPareto, type_vv_119> AgradCdfPareto_vv_119;
+typedef std::tuple<AgradCdfPareto, type_vv_120> AgradCdfPareto_vv_120;
+typedef std::tuple<AgradCdfPareto, type_vv_121> AgradCdfPareto_vv_121;
+typedef std::tuple<AgradCdfPareto, type_vv_122> AgradCdfPareto_vv_122;
+typedef std::tuple<AgradCdfPareto, type_vv_123> AgradCdfPareto_vv_123;
+typedef std::tuple<AgradCdfPareto, type_vv_124> AgradCdfPareto_vv_124;
+typedef std::tuple<AgradCdfPareto, type_vv_125> AgradCdfPareto_vv_125;
+typedef std::tuple<AgradCdfPareto, type_vv_126> AgradCdfPareto_vv_126;
+typedef std::tuple<AgradCdfPareto, type_vv_127> AgradCdfPareto_vv_127;
+typedef std::tuple<AgradCdfPareto, type_vv_128> AgradCdfPareto_vv_128;
+typedef std::tuple<AgradCdfPareto, type_vv_129> AgradCdfPareto_vv_129;
+typedef std::tuple<AgradCdfPareto, type_vv_130> AgradCdfPareto_vv_130;
+typedef std::tuple<AgradCdfPareto, type_vv_131> AgradCdfPareto_vv_131;
+typedef std::tuple<AgradCdfPareto, type_vv_132> AgradCdfPareto_vv_132;
+typedef std::tuple<AgradCdfPareto, type_vv_133> AgradCdfPareto_vv_133;
+typedef std::tuple<AgradCdfPareto, type_vv_134> AgradCdfPareto_vv_134;
+typedef std::tuple<AgradCdfPareto, type_vv_135> AgradCdfPareto_vv_135;
+typedef std::tuple<AgradCdfPareto, type_vv_136> AgradCdfPareto_vv_136;
+typedef std::tuple<AgradCdfPareto, type_vv_137> AgradCdfPareto_vv_137;
+typedef std::tuple<AgradCdfPareto, type_vv_138> AgradCdfPareto_vv_138;
+typedef std::tuple<AgradCdfPareto, type_vv_139> AgradCdfPareto_vv_139;
+typedef std::tuple<AgradCdfPareto, type_vv_140> AgradCdfPareto_vv_140;
+typedef std::tuple<AgradCdfPareto, type_vv_141> AgradCdfPareto_vv_141;
+typedef std::tuple<AgradCdfPareto, type_vv_142> AgradCdfPareto_vv_142;
+typedef std::tuple<AgradCdfPareto, type_vv_143> AgradCdfPareto_vv_143;
+typedef std::tuple<AgradCdfPareto, type_vv_144> AgradCdfPareto_vv_144;
+typedef std::tuple<AgradCdfPareto, type_vv_145> AgradCdfPareto_vv_145;
+typedef std::tuple<AgradCdfPareto, type_vv_146> AgradCdfPareto_vv_146;
+typedef std::tuple<AgradCdfPareto, type_vv_147> AgradCdfPareto_vv_147;
+typedef std::tuple<AgradCdfPareto, type_vv_148> AgradCdfPareto_vv_148;
+typedef std::tuple<AgradCdfPareto, type_vv_149> AgradCdfPareto_vv_149;
+typedef std::tuple<AgradCdfPareto, type_vv_150> AgradCdfPareto_vv_150;
+typedef std::tuple<AgradCdfPareto, type_vv_151> AgradCdfPareto_vv_151;
+typedef std::tuple<AgradCdfPareto, type_vv_152> AgradCdfPareto_vv_152;
+typedef std::tuple<AgradCdfPareto, type_vv_153> AgradCdfPareto_vv_153;
+typedef std::tuple<AgradCdfPareto, type_vv_154> AgradCdfPareto_vv_154;
+typedef std::tuple<AgradCdfPareto, type_vv_155> AgradCdfPareto_vv_155;
+typedef std::tuple<AgradCdfPareto, type_vv_156> AgradCdfPareto_vv_156;
+typedef std::tuple<AgradCdfPareto, type_vv_157> AgradCdfPareto_vv_157;
+typedef std::tuple<AgradCdfPareto, type_vv_158> AgradCdfPareto_vv_158;
+typedef std::tuple<AgradCdfPareto, type_vv_159> AgradCdfPareto_vv_159;
+typedef std::tuple<AgradCdfPareto, type_vv_160> AgradCdfPareto_vv_160;
+typedef std::tuple<AgradCdfPareto, type_vv_161> AgradCdfPareto_vv_161;
+typedef std::tuple<AgradCdfPareto, type_vv_162> AgradCdfPareto_vv_162;
+typedef std::tuple<AgradCdfPareto, type_vv_163> AgradCdfPareto_vv_163;
+typedef std::tuple<AgradCdfPareto, type_vv_164> AgradCdfPareto_vv_164;
+typedef std::tuple<AgradCdfPareto, type_vv_165> AgradCdfPareto_vv_165;
+typedef std::tuple<AgradCdfPareto, type_vv_166> AgradCdfPareto_vv_166;
+typedef std::tuple<AgradCdfPareto, type_vv_167> AgradCdfPareto_vv_167;
+typedef std::tuple<AgradCdfPareto, type_vv_168> AgradCdfPareto_vv_168;
+typedef std::tuple<AgradCdfPareto, type_vv_169> AgradCdfPareto_vv_169;
+typedef std::tuple<AgradCdfPareto, type_vv_170> AgradCdfPareto_vv_170;
+typedef std::tuple<AgradCdfPareto, type_vv_171> AgradCdfPareto_vv_171;
+typedef std::tuple<AgradCdfPareto, type_vv_172> AgradCdfPareto_vv_172;
+typedef std::tuple<AgradCdfPareto, type_vv_173> AgradCdfPareto_vv_173;
+typedef std::tuple<AgradCdfPareto, type_vv_174> AgradCdfPareto_vv_174;
+typedef std::tuple<AgradCdfPareto, type_vv_175> AgradCdfPareto_vv_175;
+typedef std::tuple<AgradCdfPareto, type_vv_176> AgradCdfPareto_vv_176;
+typedef std::tuple<AgradCdfPareto, type_vv_177> AgradCdfPareto_vv_177;
+typedef std::tuple<AgradCdfPareto, type_vv_178> AgradCdfPareto_vv_178;
+typedef std::tuple<AgradCdfPareto, type_vv_179> AgradCdfPareto_vv_179;
+typedef std::tuple<AgradCdfPareto, type_vv_180> AgradCdfPareto_vv_180;
+typedef std::tuple<AgradCdfPareto, type_vv_181> AgradCdfPareto_vv_181;
+typedef std::tuple<AgradCdfPareto, type_vv_182> AgradCdfPareto_vv_182;
+typedef std::tuple<AgradCdfPareto, type_vv_183> AgradCdfPareto_vv_183;
+typedef std::tuple<AgradCdfPareto, type_vv_184> AgradCdfPareto_vv_184;
+typedef std::tuple<AgradCdfPareto, type_vv_185> AgradCdfPareto_vv_185;
+typedef std::tuple<AgradCdfPareto, type_vv_186> AgradCdfPareto_vv_186;
+typedef std::tuple<AgradCdfPareto, type_vv_187> AgradCdfPareto_vv_187;
+typedef std::tuple<AgradCdfPareto, type_vv_188> AgradCdfPareto_vv_188;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_100, AgradCdfTestFixture, AgradCdfPareto_vv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_101, AgradCdfTestFixture, AgradCdfPareto_vv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_102, AgradCdfTestFixture, AgradCdfPareto_vv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_103, AgradCdfTestFixture, AgradCdfPareto_vv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_104, AgradCdfTestFixture, AgradCdfPareto_vv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_105, AgradCdfTestFixture, AgradCdfPareto_vv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_106, AgradCdfTestFixture, AgradCdfPareto_vv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_107, AgradCdfTestFixture, AgradCdfPareto_vv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_108, AgradCdfTestFixture, AgradCdfPareto_vv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_109, AgradCdfTestFixture, AgradCdfPareto_vv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_110, AgradCdfTestFixture, AgradCdfPareto_vv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_111, AgradCdfTestFixture, AgradCdfPareto_vv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_112, AgradCdfTestFixture, AgradCdfPareto_vv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_113, AgradCdfTestFixture, AgradCdfPareto_vv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_114, AgradCdfTestFixture, AgradCdfPareto_vv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_115, AgradCdfTestFixture, AgradCdfPareto_vv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_116, AgradCdfTestFixture, AgradCdfPareto_vv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_117, AgradCdfTestFixture, AgradCdfPareto_vv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_118, AgradCdfTestFixture, AgradCdfPareto_vv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_119, AgradCdfTestFixture, AgradCdfPareto_vv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_120, AgradCdfTestFixture, AgradCdfPareto_vv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_121, AgradCdfTestFixture, AgradCdfPareto_vv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_122, AgradCdfTestFixture, AgradCdfPareto_vv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_123, AgradCdfTestFixture, AgradCdfPareto_vv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_124, AgradCdfTestFixture, AgradCdfPareto_vv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_125, AgradCdfTestFixture, AgradCdfPareto_vv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_126, AgradCdfTestFixture, AgradCdfPareto_vv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_127, AgradCdfTestFixture, AgradCdfPareto_vv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_128, AgradCdfTestFixture, AgradCdfPareto_vv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_129, AgradCdfTestFixture, AgradCdfPareto_vv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_130, AgradCdfTestFixture, AgradCdfPareto_vv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_131, AgradCdfTestFixture, AgradCdfPareto_vv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_132, AgradCdfTestFixture, AgradCdfPareto_vv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_133, AgradCdfTestFixture, AgradCdfPareto_vv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_134, AgradCdfTestFixture, AgradCdfPareto_vv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_135, AgradCdfTestFixture, AgradCdfPareto_vv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_136, AgradCdfTestFixture, AgradCdfPareto_vv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_137, AgradCdfTestFixture, AgradCdfPareto_vv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_138, AgradCdfTestFixture, AgradCdfPareto_vv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_139, AgradCdfTestFixture, AgradCdfPareto_vv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_140, AgradCdfTestFixture, AgradCdfPareto_vv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_141, AgradCdfTestFixture, AgradCdfPareto_vv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_142, AgradCdfTestFixture, AgradCdfPareto_vv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_143, AgradCdfTestFixture, AgradCdfPareto_vv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_144, AgradCdfTestFixture, AgradCdfPareto_vv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_145, AgradCdfTestFixture, AgradCdfPareto_vv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_146, AgradCdfTestFixture, AgradCdfPareto_vv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_147, AgradCdfTestFixture, AgradCdfPareto_vv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_148, AgradCdfTestFixture, AgradCdfPareto_vv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_149, AgradCdfTestFixture, AgradCdfPareto_vv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_150, AgradCdfTestFixture, AgradCdfPareto_vv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_151, AgradCdfTestFixture, AgradCdfPareto_vv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_152, AgradCdfTestFixture, AgradCdfPareto_vv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_153, AgradCdfTestFixture, AgradCdfPareto_vv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_154, AgradCdfTestFixture, AgradCdfPareto_vv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_155, AgradCdfTestFixture, AgradCdfPareto_vv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_156, AgradCdfTestFixture, AgradCdfPareto_vv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_157, AgradCdfTestFixture, AgradCdfPareto_vv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_158, AgradCdfTestFixture, AgradCdfPareto_vv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_159, AgradCdfTestFixture, AgradCdfPareto_vv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_160, AgradCdfTestFixture, AgradCdfPareto_vv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_161, AgradCdfTestFixture, AgradCdfPareto_vv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_162, AgradCdfTestFixture, AgradCdfPareto_vv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_163, AgradCdfTestFixture, AgradCdfPareto_vv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_164, AgradCdfTestFixture, AgradCdfPareto_vv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_165, AgradCdfTestFixture, AgradCdfPareto_vv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_166, AgradCdfTestFixture, AgradCdfPareto_vv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_167, AgradCdfTestFixture, AgradCdfPareto_vv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_168, AgradCdfTestFixture, AgradCdfPareto_vv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_169, AgradCdfTestFixture, AgradCdfPareto_vv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_170, AgradCdfTestFixture, AgradCdfPareto_vv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_171, AgradCdfTestFixture, AgradCdfPareto_vv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_172, AgradCdfTestFixture, AgradCdfPareto_vv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_173, AgradCdfTestFixture, AgradCdfPareto_vv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_174, AgradCdfTestFixture, AgradCdfPareto_vv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_175, AgradCdfTestFixture, AgradCdfPareto_vv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_176, AgradCdfTestFixture, AgradCdfPareto_vv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_177, AgradCdfTestFixture, AgradCdfPareto_vv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_178, AgradCdfTestFixture, AgradCdfPareto_vv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_179, AgradCdfTestFixture, AgradCdfPareto_vv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_180, AgradCdfTestFixture, AgradCdfPareto_vv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_181, AgradCdfTestFixture, AgradCdfPareto_vv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_182, AgradCdfTestFixture, AgradCdfPareto_vv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_183, AgradCdfTestFixture, AgradCdfPareto_vv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_184, AgradCdfTestFixture, AgradCdfPareto_vv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_185, AgradCdfTestFixture, AgradCdfPareto_vv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_186, AgradCdfTestFixture, AgradCdfPareto_vv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_187, AgradCdfTestFixture, AgradCdfPareto_vv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPareto_vv_188, AgradCdfTestFixture, AgradCdfPareto_vv_188);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto/pareto_cdf_log_test.hpp>
+
+typedef std::tuple<double, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_0;
+typedef std::tuple<double, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_1;
+typedef std::tuple<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_2;
+typedef std::tuple<double, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_3;
+typedef std::tuple<double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_4;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_5;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_6;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_7;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_8;
+typedef std::tuple<double, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_9;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_10;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_11;
+typedef std::tuple<double, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_12;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_13;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_14;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_15;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_16;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_17;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_18;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_19;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_20;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_21;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_22;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_23;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_24;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_25;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_26;
+typedef std::tuple<std::vector<double>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_27;
+typedef std::tuple<std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_28;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_29;
+typedef std::tuple<std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_30;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_31;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_32;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_33;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_34;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_35;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_36;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_37;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_38;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_39;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_40;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_41;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_42;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_43;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_44;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_45;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_46;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_47;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_48;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_49;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_50;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_51;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_52;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_53;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_54;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_55;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_56;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_57;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_58;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_59;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_60;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_61;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_62;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_63;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_64;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_65;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_66;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_67;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_68;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_69;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_70;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_80;
+typedef std::tuple<fvar<fvar<var> >, double, double, empty, empty, empty> type_ffv_81;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<double>, empty, empty, empty> type_ffv_82;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_83;
+typedef std::tuple<fvar<fvar<var> >, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_84;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_85;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_86;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, double, empty, empty, empty> type_ffv_87;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_88;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_89;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_90;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_91;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_92;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_93;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_94;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_95;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_96;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_97;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_98;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_99;
+
+typedef std::tuple<AgradCdfLogPareto, type_ffv_0> AgradCdfLogPareto_ffv_0;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_1> AgradCdfLogPareto_ffv_1;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_2> AgradCdfLogPareto_ffv_2;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_3> AgradCdfLogPareto_ffv_3;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_4> AgradCdfLogPareto_ffv_4;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_5> AgradCdfLogPareto_ffv_5;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_6> AgradCdfLogPareto_ffv_6;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_7> AgradCdfLogPareto_ffv_7;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_8> AgradCdfLogPareto_ffv_8;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_9> AgradCdfLogPareto_ffv_9;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_10> AgradCdfLogPareto_ffv_10;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_11> AgradCdfLogPareto_ffv_11;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_12> AgradCdfLogPareto_ffv_12;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_13> AgradCdfLogPareto_ffv_13;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_14> AgradCdfLogPareto_ffv_14;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_15> AgradCdfLogPareto_ffv_15;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_16> AgradCdfLogPareto_ffv_16;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_17> AgradCdfLogPareto_ffv_17;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_18> AgradCdfLogPareto_ffv_18;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_19> AgradCdfLogPareto_ffv_19;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_20> AgradCdfLogPareto_ffv_20;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_21> AgradCdfLogPareto_ffv_21;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_22> AgradCdfLogPareto_ffv_22;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_23> AgradCdfLogPareto_ffv_23;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_24> AgradCdfLogPareto_ffv_24;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_25> AgradCdfLogPareto_ffv_25;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_26> AgradCdfLogPareto_ffv_26;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_27> AgradCdfLogPareto_ffv_27;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_28> AgradCdfLogPareto_ffv_28;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_29> AgradCdfLogPareto_ffv_29;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_30> AgradCdfLogPareto_ffv_30;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_31> AgradCdfLogPareto_ffv_31;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_32> AgradCdfLogPareto_ffv_32;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_33> AgradCdfLogPareto_ffv_33;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_34> AgradCdfLogPareto_ffv_34;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_35> AgradCdfLogPareto_ffv_35;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_36> AgradCdfLogPareto_ffv_36;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_37> AgradCdfLogPareto_ffv_37;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_38> AgradCdfLogPareto_ffv_38;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_39> AgradCdfLogPareto_ffv_39;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_40> AgradCdfLogPareto_ffv_40;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_41> AgradCdfLogPareto_ffv_41;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_42> AgradCdfLogPareto_ffv_42;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_43> AgradCdfLogPareto_ffv_43;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_44> AgradCdfLogPareto_ffv_44;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_45> AgradCdfLogPareto_ffv_45;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_46> AgradCdfLogPareto_ffv_46;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_47> AgradCdfLogPareto_ffv_47;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_48> AgradCdfLogPareto_ffv_48;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_49> AgradCdfLogPareto_ffv_49;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_50> AgradCdfLogPareto_ffv_50;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_51> AgradCdfLogPareto_ffv_51;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_52> AgradCdfLogPareto_ffv_52;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_53> AgradCdfLogPareto_ffv_53;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_54> AgradCdfLogPareto_ffv_54;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_55> AgradCdfLogPareto_ffv_55;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_56> AgradCdfLogPareto_ffv_56;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_57> AgradCdfLogPareto_ffv_57;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_58> AgradCdfLogPareto_ffv_58;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_59> AgradCdfLogPareto_ffv_59;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_60> AgradCdfLogPareto_ffv_60;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_61> AgradCdfLogPareto_ffv_61;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_62> AgradCdfLogPareto_ffv_62;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_63> AgradCdfLogPareto_ffv_63;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_64> AgradCdfLogPareto_ffv_64;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_65> AgradCdfLogPareto_ffv_65;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_66> AgradCdfLogPareto_ffv_66;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_67> AgradCdfLogPareto_ffv_67;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_68> AgradCdfLogPareto_ffv_68;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_69> AgradCdfLogPareto_ffv_69;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_70> AgradCdfLogPareto_ffv_70;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_71> AgradCdfLogPareto_ffv_71;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_72> AgradCdfLogPareto_ffv_72;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_73> AgradCdfLogPareto_ffv_73;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_74> AgradCdfLogPareto_ffv_74;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_75> AgradCdfLogPareto_ffv_75;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_76> AgradCdfLogPareto_ffv_76;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_77> AgradCdfLogPareto_ffv_77;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_78> AgradCdfLogPareto_ffv_78;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_79> AgradCdfLogPareto_ffv_79;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_80> AgradCdfLogPareto_ffv_80;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_81> AgradCdfLogPareto_ffv_81;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_82> AgradCdfLogPareto_ffv_82;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_83> AgradCdfLogPareto_ffv_83;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_84> AgradCdfLogPareto_ffv_84;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_85> AgradCdfLogPareto_ffv_85;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_86> AgradCdfLogPareto_ffv_86;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_87> AgradCdfLogPareto_ffv_87;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_88> AgradCdfLogPareto_ffv_88;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_89> AgradCdfLogPareto_ffv_89;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_90> AgradCdfLogPareto_ffv_90;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_91> AgradCdfLogPareto_ffv_91;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_92> AgradCdfLogPareto_ffv_92;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_93> AgradCdfLogPareto_ffv_93;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_94> AgradCdfLogPareto_ffv_94;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_95> AgradCdfLogPareto_ffv_95;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_96> AgradCdfLogPareto_ffv_96;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_97> AgradCdfLogPareto_ffv_97;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_98> AgradCdfLogPareto_ffv_98;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_99> AgradCdfLogPareto_ffv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_0, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_1, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_2, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_3, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_4, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_5, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_6, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_7, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_8, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_9, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_10, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_11, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_12, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_13, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_14, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_15, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_16, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_17, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_18, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_19, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_20, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_21, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_22, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_23, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_24, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_25, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_26, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_27, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_28, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_29, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_30, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_31, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_32, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_33, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_34, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_35, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_36, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_37, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_38, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_39, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_40, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_41, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_42, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_43, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_44, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_45, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_46, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_47, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_48, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_49, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_50, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_51, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_52, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_53, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_54, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_55, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_56, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_57, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_58, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_59, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_60, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_61, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_62, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_63, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_64, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_65, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_66, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_67, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_68, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_69, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_70, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_71, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_72, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_73, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_74, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_75, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_76, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_77, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_78, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_79, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_80, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_81, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_82, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_83, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_84, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_85, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_86, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_87, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_88, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_89, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_90, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_91, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_92, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_93, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_94, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_95, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_96, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_97, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_98, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_99, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_99);
+
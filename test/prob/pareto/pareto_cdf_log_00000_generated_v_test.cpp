@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto/pareto_cdf_log_test.hpp>
+
+typedef std::tuple<double, double, double, empty, empty, empty> type_v_0;
+typedef std::tuple<double, double, std::vector<double>, empty, empty, empty> type_v_1;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_2;
+typedef std::tuple<double, double, var, empty, empty, empty> type_v_3;
+typedef std::tuple<double, double, std::vector<var>, empty, empty, empty> type_v_4;
+typedef std::tuple<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_5;
+typedef std::tuple<double, std::vector<double>, double, empty, empty, empty> type_v_6;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_7;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_8;
+typedef std::tuple<double, std::vector<double>, var, empty, empty, empty> type_v_9;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_10;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_11;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_12;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_13;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_14;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_15;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_16;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_17;
+typedef std::tuple<double, var, double, empty, empty, empty> type_v_18;
+typedef std::tuple<double, var, std::vector<double>, empty, empty, empty> type_v_19;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_20;
+typedef std::tuple<double, var, var, empty, empty, empty> type_v_21;
+typedef std::tuple<double, var, std::vector<var>, empty, empty, empty> type_v_22;
+typedef std::tuple<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_23;
+typedef std::tuple<double, std::vector<var>, double, empty, empty, empty> type_v_24;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_25;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_26;
+typedef std::tuple<double, std::vector<var>, var, empty, empty, empty> type_v_27;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_28;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_29;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_30;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_31;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_32;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_33;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_34;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_35;
+typedef std::tuple<std::vector<double>, double, double, empty, empty, empty> type_v_36;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, empty, empty, empty> type_v_37;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_38;
+typedef std::tuple<std::vector<double>, double, var, empty, empty, empty> type_v_39;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, empty, empty, empty> type_v_40;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_41;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, empty, empty, empty> type_v_42;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_43;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_44;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, empty, empty, empty> type_v_45;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_46;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_47;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_48;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_49;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_50;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_51;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_52;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_53;
+typedef std::tuple<std::vector<double>, var, double, empty, empty, empty> type_v_54;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, empty, empty, empty> type_v_55;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_56;
+typedef std::tuple<std::vector<double>, var, var, empty, empty, empty> type_v_57;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, empty, empty, empty> type_v_58;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_59;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, empty, empty, empty> type_v_60;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_61;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_62;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, empty, empty, empty> type_v_63;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_64;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_65;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_66;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_67;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_68;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_69;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_70;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_v_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_v_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_v_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_v_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_v_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_80;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_v_81;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_82;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_83;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_84;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_85;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_86;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_87;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_88;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_89;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_v_90;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_v_91;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_92;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_v_93;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_v_94;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_95;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_v_96;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_97;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_98;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_v_99;
+
+typedef std::tuple<AgradCdfLogPareto, type_v_0> AgradCdfLogPareto_v_0;
+typedef std::tuple<AgradCdfLogPareto, type_v_1> AgradCdfLogPareto_v_1;
+typedef std::tuple<AgradCdfLogPareto, type_v_2> AgradCdfLogPareto_v_2;
+typedef std::tuple<AgradCdfLogPareto, type_v_3> AgradCdfLogPareto_v_3;
+typedef std::tuple<AgradCdfLogPareto, type_v_4> AgradCdfLogPareto_v_4;
+typedef std::tuple<AgradCdfLogPareto, type_v_5> AgradCdfLogPareto_v_5;
+typedef std::tuple<AgradCdfLogPareto, type_v_6> AgradCdfLogPareto_v_6;
+typedef std::tuple<AgradCdfLogPareto, type_v_7> AgradCdfLogPareto_v_7;
+typedef std::tuple<AgradCdfLogPareto, type_v_8> AgradCdfLogPareto_v_8;
+typedef std::tuple<AgradCdfLogPareto, type_v_9> AgradCdfLogPareto_v_9;
+typedef std::tuple<AgradCdfLogPareto, type_v_10> AgradCdfLogPareto_v_10;
+typedef std::tuple<AgradCdfLogPareto, type_v_11> AgradCdfLogPareto_v_11;
+typedef std::tuple<AgradCdfLogPareto, type_v_12> AgradCdfLogPareto_v_12;
+typedef std::tuple<AgradCdfLogPareto, type_v_13> AgradCdfLogPareto_v_13;
+typedef std::tuple<AgradCdfLogPareto, type_v_14> AgradCdfLogPareto_v_14;
+typedef std::tuple<AgradCdfLogPareto, type_v_15> AgradCdfLogPareto_v_15;
+typedef std::tuple<AgradCdfLogPareto, type_v_16> AgradCdfLogPareto_v_16;
+typedef std::tuple<AgradCdfLogPareto, type_v_17> AgradCdfLogPareto_v_17;
+typedef std::tuple<AgradCdfLogPareto, type_v_18> AgradCdfLogPareto_v_18;
+typedef std::tuple<AgradCdfLogPareto, type_v_19> AgradCdfLogPareto_v_19;
+typedef std::tuple<AgradCdfLogPareto, type_v_20> AgradCdfLogPareto_v_20;
+typedef std::tuple<AgradCdfLogPareto, type_v_21> AgradCdfLogPareto_v_21;
+typedef std::tuple<AgradCdfLogPareto, type_v_22> AgradCdfLogPareto_v_22;
+typedef std::tuple<AgradCdfLogPareto, type_v_23> AgradCdfLogPareto_v_23;
+typedef std::tuple<AgradCdfLogPareto, type_v_24> AgradCdfLogPareto_v_24;
+typedef std::tuple<AgradCdfLogPareto, type_v_25> AgradCdfLogPareto_v_25;
+typedef std::tuple<AgradCdfLogPareto, type_v_26> AgradCdfLogPareto_v_26;
+typedef std::tuple<AgradCdfLogPareto, type_v_27> AgradCdfLogPareto_v_27;
+typedef std::tuple<AgradCdfLogPareto, type_v_28> AgradCdfLogPareto_v_28;
+typedef std::tuple<AgradCdfLogPareto, type_v_29> AgradCdfLogPareto_v_29;
+typedef std::tuple<AgradCdfLogPareto, type_v_30> AgradCdfLogPareto_v_30;
+typedef std::tuple<AgradCdfLogPareto, type_v_31> AgradCdfLogPareto_v_31;
+typedef std::tuple<AgradCdfLogPareto, type_v_32> AgradCdfLogPareto_v_32;
+typedef std::tuple<AgradCdfLogPareto, type_v_33> AgradCdfLogPareto_v_33;
+typedef std::tuple<AgradCdfLogPareto, type_v_34> AgradCdfLogPareto_v_34;
+typedef std::tuple<AgradCdfLogPareto, type_v_35> AgradCdfLogPareto_v_35;
+typedef std::tuple<AgradCdfLogPareto, type_v_36> AgradCdfLogPareto_v_36;
+typedef std::tuple<AgradCdfLogPareto, type_v_37> AgradCdfLogPareto_v_37;
+typedef std::tuple<AgradCdfLogPareto, type_v_38> AgradCdfLogPareto_v_38;
+typedef std::tuple<AgradCdfLogPareto, type_v_39> AgradCdfLogPareto_v_39;
+typedef std::tuple<AgradCdfLogPareto, type_v_40> AgradCdfLogPareto_v_40;
+typedef std::tuple<AgradCdfLogPareto, type_v_41> AgradCdfLogPareto_v_41;
+typedef std::tuple<AgradCdfLogPareto, type_v_42> AgradCdfLogPareto_v_42;
+typedef std::tuple<AgradCdfLogPareto, type_v_43> AgradCdfLogPareto_v_43;
+typedef std::tuple<AgradCdfLogPareto, type_v_44> AgradCdfLogPareto_v_44;
+typedef std::tuple<AgradCdfLogPareto, type_v_45> AgradCdfLogPareto_v_45;
+typedef std::tuple<AgradCdfLogPareto, type_v_46> AgradCdfLogPareto_v_46;
+typedef std::tuple<AgradCdfLogPareto, type_v_47> AgradCdfLogPareto_v_47;
+typedef std::tuple<AgradCdfLogPareto, type_v_48> AgradCdfLogPareto_v_48;
+typedef std::tuple<AgradCdfLogPareto, type_v_49> AgradCdfLogPareto_v_49;
+typedef std::tuple<AgradCdfLogPareto, type_v_50> AgradCdfLogPareto_v_50;
+typedef std::tuple<AgradCdfLogPareto, type_v_51> AgradCdfLogPareto_v_51;
+typedef std::tuple<AgradCdfLogPareto, type_v_52> AgradCdfLogPareto_v_52;
+typedef std::tuple<AgradCdfLogPareto, type_v_53> AgradCdfLogPareto_v_53;
+typedef std::tuple<AgradCdfLogPareto, type_v_54> AgradCdfLogPareto_v_54;
+typedef std::tuple<AgradCdfLogPareto, type_v_55> AgradCdfLogPareto_v_55;
+typedef std::tuple<AgradCdfLogPareto, type_v_56> AgradCdfLogPareto_v_56;
+typedef std::tuple<AgradCdfLogPareto, type_v_57> AgradCdfLogPareto_v_57;
+typedef std::tuple<AgradCdfLogPareto, type_v_58> AgradCdfLogPareto_v_58;
+typedef std::tuple<AgradCdfLogPareto, type_v_59> AgradCdfLogPareto_v_59;
+typedef std::tuple<AgradCdfLogPareto, type_v_60> AgradCdfLogPareto_v_60;
+typedef std::tuple<AgradCdfLogPareto, type_v_61> AgradCdfLogPareto_v_61;
+typedef std::tuple<AgradCdfLogPareto, type_v_62> AgradCdfLogPareto_v_62;
+typedef std::tuple<AgradCdfLogPareto, type_v_63> AgradCdfLogPareto_v_63;
+typedef std::tuple<AgradCdfLogPareto, type_v_64> AgradCdfLogPareto_v_64;
+typedef std::tuple<AgradCdfLogPareto, type_v_65> AgradCdfLogPareto_v_65;
+typedef std::tuple<AgradCdfLogPareto, type_v_66> AgradCdfLogPareto_v_66;
+typedef std::tuple<AgradCdfLogPareto, type_v_67> AgradCdfLogPareto_v_67;
+typedef std::tuple<AgradCdfLogPareto, type_v_68> AgradCdfLogPareto_v_68;
+typedef std::tuple<AgradCdfLogPareto, type_v_69> AgradCdfLogPareto_v_69;
+typedef std::tuple<AgradCdfLogPareto, type_v_70> AgradCdfLogPareto_v_70;
+typedef std::tuple<AgradCdfLogPareto, type_v_71> AgradCdfLogPareto_v_71;
+typedef std::tuple<AgradCdfLogPareto, type_v_72> AgradCdfLogPareto_v_72;
+typedef std::tuple<AgradCdfLogPareto, type_v_73> AgradCdfLogPareto_v_73;
+typedef std::tuple<AgradCdfLogPareto, type_v_74> AgradCdfLogPareto_v_74;
+typedef std::tuple<AgradCdfLogPareto, type_v_75> AgradCdfLogPareto_v_75;
+typedef std::tuple<AgradCdfLogPareto, type_v_76> AgradCdfLogPareto_v_76;
+typedef std::tuple<AgradCdfLogPareto, type_v_77> AgradCdfLogPareto_v_77;
+typedef std::tuple<AgradCdfLogPareto, type_v_78> AgradCdfLogPareto_v_78;
+typedef std::tuple<AgradCdfLogPareto, type_v_79> AgradCdfLogPareto_v_79;
+typedef std::tuple<AgradCdfLogPareto, type_v_80> AgradCdfLogPareto_v_80;
+typedef std::tuple<AgradCdfLogPareto, type_v_81> AgradCdfLogPareto_v_81;
+typedef std::tuple<AgradCdfLogPareto, type_v_82> AgradCdfLogPareto_v_82;
+typedef std::tuple<AgradCdfLogPareto, type_v_83> AgradCdfLogPareto_v_83;
+typedef std::tuple<AgradCdfLogPareto, type_v_84> AgradCdfLogPareto_v_84;
+typedef std::tuple<AgradCdfLogPareto, type_v_85> AgradCdfLogPareto_v_85;
+typedef std::tuple<AgradCdfLogPareto, type_v_86> AgradCdfLogPareto_v_86;
+typedef std::tuple<AgradCdfLogPareto, type_v_87> AgradCdfLogPareto_v_87;
+typedef std::tuple<AgradCdfLogPareto, type_v_88> AgradCdfLogPareto_v_88;
+typedef std::tuple<AgradCdfLogPareto, type_v_89> AgradCdfLogPareto_v_89;
+typedef std::tuple<AgradCdfLogPareto, type_v_90> AgradCdfLogPareto_v_90;
+typedef std::tuple<AgradCdfLogPareto, type_v_91> AgradCdfLogPareto_v_91;
+typedef std::tuple<AgradCdfLogPareto, type_v_92> AgradCdfLogPareto_v_92;
+typedef std::tuple<AgradCdfLogPareto, type_v_93> AgradCdfLogPareto_v_93;
+typedef std::tuple<AgradCdfLogPareto, type_v_94> AgradCdfLogPareto_v_94;
+typedef std::tuple<AgradCdfLogPareto, type_v_95> AgradCdfLogPareto_v_95;
+typedef std::tuple<AgradCdfLogPareto, type_v_96> AgradCdfLogPareto_v_96;
+typedef std::tuple<AgradCdfLogPareto, type_v_97> AgradCdfLogPareto_v_97;
+typedef std::tuple<AgradCdfLogPareto, type_v_98> AgradCdfLogPareto_v_98;
+typedef std::tuple<AgradCdfLogPareto, type_v_99> AgradCdfLogPareto_v_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_0, AgradCdfLogTestFixture, AgradCdfLogPareto_v_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_1, AgradCdfLogTestFixture, AgradCdfLogPareto_v_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_2, AgradCdfLogTestFixture, AgradCdfLogPareto_v_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_3, AgradCdfLogTestFixture, AgradCdfLogPareto_v_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_4, AgradCdfLogTestFixture, AgradCdfLogPareto_v_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_5, AgradCdfLogTestFixture, AgradCdfLogPareto_v_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_6, AgradCdfLogTestFixture, AgradCdfLogPareto_v_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_7, AgradCdfLogTestFixture, AgradCdfLogPareto_v_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_8, AgradCdfLogTestFixture, AgradCdfLogPareto_v_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_9, AgradCdfLogTestFixture, AgradCdfLogPareto_v_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_10, AgradCdfLogTestFixture, AgradCdfLogPareto_v_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_11, AgradCdfLogTestFixture, AgradCdfLogPareto_v_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_12, AgradCdfLogTestFixture, AgradCdfLogPareto_v_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_13, AgradCdfLogTestFixture, AgradCdfLogPareto_v_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_14, AgradCdfLogTestFixture, AgradCdfLogPareto_v_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_15, AgradCdfLogTestFixture, AgradCdfLogPareto_v_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_16, AgradCdfLogTestFixture, AgradCdfLogPareto_v_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_17, AgradCdfLogTestFixture, AgradCdfLogPareto_v_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_18, AgradCdfLogTestFixture, AgradCdfLogPareto_v_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_19, AgradCdfLogTestFixture, AgradCdfLogPareto_v_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_20, AgradCdfLogTestFixture, AgradCdfLogPareto_v_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_21, AgradCdfLogTestFixture, AgradCdfLogPareto_v_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_22, AgradCdfLogTestFixture, AgradCdfLogPareto_v_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_23, AgradCdfLogTestFixture, AgradCdfLogPareto_v_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_24, AgradCdfLogTestFixture, AgradCdfLogPareto_v_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_25, AgradCdfLogTestFixture, AgradCdfLogPareto_v_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_26, AgradCdfLogTestFixture, AgradCdfLogPareto_v_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_27, AgradCdfLogTestFixture, AgradCdfLogPareto_v_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_28, AgradCdfLogTestFixture, AgradCdfLogPareto_v_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_29, AgradCdfLogTestFixture, AgradCdfLogPareto_v_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_30, AgradCdfLogTestFixture, AgradCdfLogPareto_v_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_31, AgradCdfLogTestFixture, AgradCdfLogPareto_v_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_32, AgradCdfLogTestFixture, AgradCdfLogPareto_v_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_33, AgradCdfLogTestFixture, AgradCdfLogPareto_v_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_34, AgradCdfLogTestFixture, AgradCdfLogPareto_v_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_35, AgradCdfLogTestFixture, AgradCdfLogPareto_v_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_36, AgradCdfLogTestFixture, AgradCdfLogPareto_v_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_37, AgradCdfLogTestFixture, AgradCdfLogPareto_v_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_38, AgradCdfLogTestFixture, AgradCdfLogPareto_v_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_39, AgradCdfLogTestFixture, AgradCdfLogPareto_v_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_40, AgradCdfLogTestFixture, AgradCdfLogPareto_v_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_41, AgradCdfLogTestFixture, AgradCdfLogPareto_v_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_42, AgradCdfLogTestFixture, AgradCdfLogPareto_v_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_43, AgradCdfLogTestFixture, AgradCdfLogPareto_v_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_44, AgradCdfLogTestFixture, AgradCdfLogPareto_v_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_45, AgradCdfLogTestFixture, AgradCdfLogPareto_v_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_46, AgradCdfLogTestFixture, AgradCdfLogPareto_v_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_47, AgradCdfLogTestFixture, AgradCdfLogPareto_v_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_48, AgradCdfLogTestFixture, AgradCdfLogPareto_v_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_49, AgradCdfLogTestFixture, AgradCdfLogPareto_v_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_50, AgradCdfLogTestFixture, AgradCdfLogPareto_v_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_51, AgradCdfLogTestFixture, AgradCdfLogPareto_v_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_52, AgradCdfLogTestFixture, AgradCdfLogPareto_v_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_53, AgradCdfLogTestFixture, AgradCdfLogPareto_v_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_54, AgradCdfLogTestFixture, AgradCdfLogPareto_v_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_55, AgradCdfLogTestFixture, AgradCdfLogPareto_v_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_56, AgradCdfLogTestFixture, AgradCdfLogPareto_v_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_57, AgradCdfLogTestFixture, AgradCdfLogPareto_v_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_58, AgradCdfLogTestFixture, AgradCdfLogPareto_v_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_59, AgradCdfLogTestFixture, AgradCdfLogPareto_v_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_60, AgradCdfLogTestFixture, AgradCdfLogPareto_v_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_61, AgradCdfLogTestFixture, AgradCdfLogPareto_v_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_62, AgradCdfLogTestFixture, AgradCdfLogPareto_v_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_63, AgradCdfLogTestFixture, AgradCdfLogPareto_v_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_64, AgradCdfLogTestFixture, AgradCdfLogPareto_v_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_65, AgradCdfLogTestFixture, AgradCdfLogPareto_v_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_66, AgradCdfLogTestFixture, AgradCdfLogPareto_v_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_67, AgradCdfLogTestFixture, AgradCdfLogPareto_v_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_68, AgradCdfLogTestFixture, AgradCdfLogPareto_v_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_69, AgradCdfLogTestFixture, AgradCdfLogPareto_v_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_70, AgradCdfLogTestFixture, AgradCdfLogPareto_v_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_71, AgradCdfLogTestFixture, AgradCdfLogPareto_v_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_72, AgradCdfLogTestFixture, AgradCdfLogPareto_v_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_73, AgradCdfLogTestFixture, AgradCdfLogPareto_v_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_74, AgradCdfLogTestFixture, AgradCdfLogPareto_v_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_75, AgradCdfLogTestFixture, AgradCdfLogPareto_v_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_76, AgradCdfLogTestFixture, AgradCdfLogPareto_v_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_77, AgradCdfLogTestFixture, AgradCdfLogPareto_v_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_78, AgradCdfLogTestFixture, AgradCdfLogPareto_v_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_79, AgradCdfLogTestFixture, AgradCdfLogPareto_v_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_80, AgradCdfLogTestFixture, AgradCdfLogPareto_v_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_81, AgradCdfLogTestFixture, AgradCdfLogPareto_v_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_82, AgradCdfLogTestFixture, AgradCdfLogPareto_v_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_83, AgradCdfLogTestFixture, AgradCdfLogPareto_v_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_84, AgradCdfLogTestFixture, AgradCdfLogPareto_v_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_85, AgradCdfLogTestFixture, AgradCdfLogPareto_v_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_86, AgradCdfLogTestFixture, AgradCdfLogPareto_v_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_87, AgradCdfLogTestFixture, AgradCdfLogPareto_v_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_88, AgradCdfLogTestFixture, AgradCdfLogPareto_v_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_89, AgradCdfLogTestFixture, AgradCdfLogPareto_v_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_90, AgradCdfLogTestFixture, AgradCdfLogPareto_v_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_91, AgradCdfLogTestFixture, AgradCdfLogPareto_v_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_92, AgradCdfLogTestFixture, AgradCdfLogPareto_v_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_93, AgradCdfLogTestFixture, AgradCdfLogPareto_v_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_94, AgradCdfLogTestFixture, AgradCdfLogPareto_v_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_95, AgradCdfLogTestFixture, AgradCdfLogPareto_v_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_96, AgradCdfLogTestFixture, AgradCdfLogPareto_v_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_97, AgradCdfLogTestFixture, AgradCdfLogPareto_v_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_98, AgradCdfLogTestFixture, AgradCdfLogPareto_v_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_99, AgradCdfLogTestFixture, AgradCdfLogPareto_v_99);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto/pareto_cdf_log_test.hpp>
+
+typedef std::tuple<double, double, var, empty, empty, empty> type_vv_0;
+typedef std::tuple<double, double, std::vector<var>, empty, empty, empty> type_vv_1;
+typedef std::tuple<double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_2;
+typedef std::tuple<double, std::vector<double>, var, empty, empty, empty> type_vv_3;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_4;
+typedef std::tuple<double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_5;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_6;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_7;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_8;
+typedef std::tuple<double, var, double, empty, empty, empty> type_vv_9;
+typedef std::tuple<double, var, std::vector<double>, empty, empty, empty> type_vv_10;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_11;
+typedef std::tuple<double, var, var, empty, empty, empty> type_vv_12;
+typedef std::tuple<double, var, std::vector<var>, empty, empty, empty> type_vv_13;
+typedef std::tuple<double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_14;
+typedef std::tuple<double, std::vector<var>, double, empty, empty, empty> type_vv_15;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_16;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_17;
+typedef std::tuple<double, std::vector<var>, var, empty, empty, empty> type_vv_18;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_19;
+typedef std::tuple<double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_20;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_21;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_22;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_23;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_24;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_25;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_26;
+typedef std::tuple<std::vector<double>, double, var, empty, empty, empty> type_vv_27;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, empty, empty, empty> type_vv_28;
+typedef std::tuple<std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_29;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, empty, empty, empty> type_vv_30;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_31;
+typedef std::tuple<std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_32;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_33;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_34;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_35;
+typedef std::tuple<std::vector<double>, var, double, empty, empty, empty> type_vv_36;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, empty, empty, empty> type_vv_37;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_38;
+typedef std::tuple<std::vector<double>, var, var, empty, empty, empty> type_vv_39;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, empty, empty, empty> type_vv_40;
+typedef std::tuple<std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_41;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, empty, empty, empty> type_vv_42;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_43;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_44;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, empty, empty, empty> type_vv_45;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_46;
+typedef std::tuple<std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_47;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_48;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_49;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_50;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_51;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_52;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_53;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_vv_54;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_vv_55;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_56;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_vv_57;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_58;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_59;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_60;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_61;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_62;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_vv_63;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_vv_64;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_65;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_vv_66;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_vv_67;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_68;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_vv_69;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_70;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_vv_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_80;
+typedef std::tuple<var, double, double, empty, empty, empty> type_vv_81;
+typedef std::tuple<var, double, std::vector<double>, empty, empty, empty> type_vv_82;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_83;
+typedef std::tuple<var, double, var, empty, empty, empty> type_vv_84;
+typedef std::tuple<var, double, std::vector<var>, empty, empty, empty> type_vv_85;
+typedef std::tuple<var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_86;
+typedef std::tuple<var, std::vector<double>, double, empty, empty, empty> type_vv_87;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_88;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_89;
+typedef std::tuple<var, std::vector<double>, var, empty, empty, empty> type_vv_90;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_91;
+typedef std::tuple<var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_92;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_93;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_94;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_95;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_96;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_97;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_98;
+typedef std::tuple<var, var, double, empty, empty, empty> type_vv_99;
+
+typedef std::tuple<AgradCdfLogPareto, type_vv_0> AgradCdfLogPareto_vv_0;
+typedef std::tuple<AgradCdfLogPareto, type_vv_1> AgradCdfLogPareto_vv_1;
+typedef std::tuple<AgradCdfLogPareto, type_vv_2> AgradCdfLogPareto_vv_2;
+typedef std::tuple<AgradCdfLogPareto, type_vv_3> AgradCdfLogPareto_vv_3;
+typedef std::tuple<AgradCdfLogPareto, type_vv_4> AgradCdfLogPareto_vv_4;
+typedef std::tuple<AgradCdfLogPareto, type_vv_5> AgradCdfLogPareto_vv_5;
+typedef std::tuple<AgradCdfLogPareto, type_vv_6> AgradCdfLogPareto_vv_6;
+typedef std::tuple<AgradCdfLogPareto, type_vv_7> AgradCdfLogPareto_vv_7;
+typedef std::tuple<AgradCdfLogPareto, type_vv_8> AgradCdfLogPareto_vv_8;
+typedef std::tuple<AgradCdfLogPareto, type_vv_9> AgradCdfLogPareto_vv_9;
+typedef std::tuple<AgradCdfLogPareto, type_vv_10> AgradCdfLogPareto_vv_10;
+typedef std::tuple<AgradCdfLogPareto, type_vv_11> AgradCdfLogPareto_vv_11;
+typedef std::tuple<AgradCdfLogPareto, type_vv_12> AgradCdfLogPareto_vv_12;
+typedef std::tuple<AgradCdfLogPareto, type_vv_13> AgradCdfLogPareto_vv_13;
+typedef std::tuple<AgradCdfLogPareto, type_vv_14> AgradCdfLogPareto_vv_14;
+typedef std::tuple<AgradCdfLogPareto, type_vv_15> AgradCdfLogPareto_vv_15;
+typedef std::tuple<AgradCdfLogPareto, type_vv_16> AgradCdfLogPareto_vv_16;
+typedef std::tuple<AgradCdfLogPareto, type_vv_17> AgradCdfLogPareto_vv_17;
+typedef std::tuple<AgradCdfLogPareto, type_vv_18> AgradCdfLogPareto_vv_18;
+typedef std::tuple<AgradCdfLogPareto, type_vv_19> AgradCdfLogPareto_vv_19;
+typedef std::tuple<AgradCdfLogPareto, type_vv_20> AgradCdfLogPareto_vv_20;
+typedef std::tuple<AgradCdfLogPareto, type_vv_21> AgradCdfLogPareto_vv_21;
+typedef std::tuple<AgradCdfLogPareto, type_vv_22> AgradCdfLogPareto_vv_22;
+typedef std::tuple<AgradCdfLogPareto, type_vv_23> AgradCdfLogPareto_vv_23;
+typedef std::tuple<AgradCdfLogPareto, type_vv_24> AgradCdfLogPareto_vv_24;
+typedef std::tuple<AgradCdfLogPareto, type_vv_25> AgradCdfLogPareto_vv_25;
+typedef std::tuple<AgradCdfLogPareto, type_vv_26> AgradCdfLogPareto_vv_26;
+typedef std::tuple<AgradCdfLogPareto, type_vv_27> AgradCdfLogPareto_vv_27;
+typedef std::tuple<AgradCdfLogPareto, type_vv_28> AgradCdfLogPareto_vv_28;
+typedef std::tuple<AgradCdfLogPareto, type_vv_29> AgradCdfLogPareto_vv_29;
+typedef std::tuple<AgradCdfLogPareto, type_vv_30> AgradCdfLogPareto_vv_30;
+typedef std::tuple<AgradCdfLogPareto, type_vv_31> AgradCdfLogPareto_vv_31;
+typedef std::tuple<AgradCdfLogPareto, type_vv_32> AgradCdfLogPareto_vv_32;
+typedef std::tuple<AgradCdfLogPareto, type_vv_33> AgradCdfLogPareto_vv_33;
+typedef std::tuple<AgradCdfLogPareto, type_vv_34> AgradCdfLogPareto_vv_34;
+typedef std::tuple<AgradCdfLogPareto, type_vv_35> AgradCdfLogPareto_vv_35;
+typedef std::tuple<AgradCdfLogPareto, type_vv_36> AgradCdfLogPareto_vv_36;
+typedef std::tuple<AgradCdfLogPareto, type_vv_37> AgradCdfLogPareto_vv_37;
+typedef std::tuple<AgradCdfLogPareto, type_vv_38> AgradCdfLogPareto_vv_38;
+typedef std::tuple<AgradCdfLogPareto, type_vv_39> AgradCdfLogPareto_vv_39;
+typedef std::tuple<AgradCdfLogPareto, type_vv_40> AgradCdfLogPareto_vv_40;
+typedef std::tuple<AgradCdfLogPareto, type_vv_41> AgradCdfLogPareto_vv_41;
+typedef std::tuple<AgradCdfLogPareto, type_vv_42> AgradCdfLogPareto_vv_42;
+typedef std::tuple<AgradCdfLogPareto, type_vv_43> AgradCdfLogPareto_vv_43;
+typedef std::tuple<AgradCdfLogPareto, type_vv_44> AgradCdfLogPareto_vv_44;
+typedef std::tuple<AgradCdfLogPareto, type_vv_45> AgradCdfLogPareto_vv_45;
+typedef std::tuple<AgradCdfLogPareto, type_vv_46> AgradCdfLogPareto_vv_46;
+typedef std::tuple<AgradCdfLogPareto, type_vv_47> AgradCdfLogPareto_vv_47;
+typedef std::tuple<AgradCdfLogPareto, type_vv_48> AgradCdfLogPareto_vv_48;
+typedef std::tuple<AgradCdfLogPareto, type_vv_49> AgradCdfLogPareto_vv_49;
+typedef std::tuple<AgradCdfLogPareto, type_vv_50> AgradCdfLogPareto_vv_50;
+typedef std::tuple<AgradCdfLogPareto, type_vv_51> AgradCdfLogPareto_vv_51;
+typedef std::tuple<AgradCdfLogPareto, type_vv_52> AgradCdfLogPareto_vv_52;
+typedef std::tuple<AgradCdfLogPareto, type_vv_53> AgradCdfLogPareto_vv_53;
+typedef std::tuple<AgradCdfLogPareto, type_vv_54> AgradCdfLogPareto_vv_54;
+typedef std::tuple<AgradCdfLogPareto, type_vv_55> AgradCdfLogPareto_vv_55;
+typedef std::tuple<AgradCdfLogPareto, type_vv_56> AgradCdfLogPareto_vv_56;
+typedef std::tuple<AgradCdfLogPareto, type_vv_57> AgradCdfLogPareto_vv_57;
+typedef std::tuple<AgradCdfLogPareto, type_vv_58> AgradCdfLogPareto_vv_58;
+typedef std::tuple<AgradCdfLogPareto, type_vv_59> AgradCdfLogPareto_vv_59;
+typedef std::tuple<AgradCdfLogPareto, type_vv_60> AgradCdfLogPareto_vv_60;
+typedef std::tuple<AgradCdfLogPareto, type_vv_61> AgradCdfLogPareto_vv_61;
+typedef std::tuple<AgradCdfLogPareto, type_vv_62> AgradCdfLogPareto_vv_62;
+typedef std::tuple<AgradCdfLogPareto, type_vv_63> AgradCdfLogPareto_vv_63;
+typedef std::tuple<AgradCdfLogPareto, type_vv_64> AgradCdfLogPareto_vv_64;
+typedef std::tuple<AgradCdfLogPareto, type_vv_65> AgradCdfLogPareto_vv_65;
+typedef std::tuple<AgradCdfLogPareto, type_vv_66> AgradCdfLogPareto_vv_66;
+typedef std::tuple<AgradCdfLogPareto, type_vv_67> AgradCdfLogPareto_vv_67;
+typedef std::tuple<AgradCdfLogPareto, type_vv_68> AgradCdfLogPareto_vv_68;
+typedef std::tuple<AgradCdfLogPareto, type_vv_69> AgradCdfLogPareto_vv_69;
+typedef std::tuple<AgradCdfLogPareto, type_vv_70> AgradCdfLogPareto_vv_70;
+typedef std::tuple<AgradCdfLogPareto, type_vv_71> AgradCdfLogPareto_vv_71;
+typedef std::tuple<AgradCdfLogPareto, type_vv_72> AgradCdfLogPareto_vv_72;
+typedef std::tuple<AgradCdfLogPareto, type_vv_73> AgradCdfLogPareto_vv_73;
+typedef std::tuple<AgradCdfLogPareto, type_vv_74> AgradCdfLogPareto_vv_74;
+typedef std::tuple<AgradCdfLogPareto, type_vv_75> AgradCdfLogPareto_vv_75;
+typedef std::tuple<AgradCdfLogPareto, type_vv_76> AgradCdfLogPareto_vv_76;
+typedef std::tuple<AgradCdfLogPareto, type_vv_77> AgradCdfLogPareto_vv_77;
+typedef std::tuple<AgradCdfLogPareto, type_vv_78> AgradCdfLogPareto_vv_78;
+typedef std::tuple<AgradCdfLogPareto, type_vv_79> AgradCdfLogPareto_vv_79;
+typedef std::tuple<AgradCdfLogPareto, type_vv_80> AgradCdfLogPareto_vv_80;
+typedef std::tuple<AgradCdfLogPareto, type_vv_81> AgradCdfLogPareto_vv_81;
+typedef std::tuple<AgradCdfLogPareto, type_vv_82> AgradCdfLogPareto_vv_82;
+typedef std::tuple<AgradCdfLogPareto, type_vv_83> AgradCdfLogPareto_vv_83;
+typedef std::tuple<AgradCdfLogPareto, type_vv_84> AgradCdfLogPareto_vv_84;
+typedef std::tuple<AgradCdfLogPareto, type_vv_85> AgradCdfLogPareto_vv_85;
+typedef std::tuple<AgradCdfLogPareto, type_vv_86> AgradCdfLogPareto_vv_86;
+typedef std::tuple<AgradCdfLogPareto, type_vv_87> AgradCdfLogPareto_vv_87;
+typedef std::tuple<AgradCdfLogPareto, type_vv_88> AgradCdfLogPareto_vv_88;
+typedef std::tuple<AgradCdfLogPareto, type_vv_89> AgradCdfLogPareto_vv_89;
+typedef std::tuple<AgradCdfLogPareto, type_vv_90> AgradCdfLogPareto_vv_90;
+typedef std::tuple<AgradCdfLogPareto, type_vv_91> AgradCdfLogPareto_vv_91;
+typedef std::tuple<AgradCdfLogPareto, type_vv_92> AgradCdfLogPareto_vv_92;
+typedef std::tuple<AgradCdfLogPareto, type_vv_93> AgradCdfLogPareto_vv_93;
+typedef std::tuple<AgradCdfLogPareto, type_vv_94> AgradCdfLogPareto_vv_94;
+typedef std::tuple<AgradCdfLogPareto, type_vv_95> AgradCdfLogPareto_vv_95;
+typedef std::tuple<AgradCdfLogPareto, type_vv_96> AgradCdfLogPareto_vv_96;
+typedef std::tuple<AgradCdfLogPareto, type_vv_97> AgradCdfLogPareto_vv_97;
+typedef std::tuple<AgradCdfLogPareto, type_vv_98> AgradCdfLogPareto_vv_98;
+typedef std::tuple<AgradCdfLogPareto, type_vv_99> AgradCdfLogPareto_vv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_0, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_1, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_2, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_3, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_4, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_5, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_6, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_7, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_8, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_9, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_10, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_11, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_12, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_13, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_14, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_15, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_16, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_17, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_18, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_19, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_20, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_21, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_22, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_23, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_24, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_25, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_26, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_27, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_28, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_29, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_30, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_31, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_32, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_33, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_34, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_35, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_36, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_37, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_38, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_39, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_40, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_41, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_42, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_43, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_44, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_45, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_46, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_47, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_48, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_49, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_50, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_51, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_52, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_53, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_54, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_55, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_56, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_57, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_58, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_59, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_60, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_61, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_62, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_63, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_64, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_65, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_66, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_67, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_68, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_69, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_70, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_71, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_72, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_73, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_74, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_75, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_76, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_77, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_78, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_79, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_80, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_81, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_82, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_83, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_84, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_85, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_86, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_87, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_88, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_89, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_90, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_91, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_92, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_93, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_94, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_95, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_96, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_97, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_98, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_99, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_99);
+
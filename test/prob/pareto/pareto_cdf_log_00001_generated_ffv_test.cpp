@@ -0,0 +1,278 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto/pareto_cdf_log_test.hpp>
+
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_100;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_101;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_102;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_103;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_104;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_105;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_106;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_107;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_108;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_109;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_110;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_111;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_112;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_113;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_114;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_115;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_116;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, double, empty, empty, empty> type_ffv_117;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty, empty, empty> type_ffv_118;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_119;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_120;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_121;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_122;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty, empty, empty> type_ffv_123;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_124;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_125;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_126;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_127;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_128;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_129;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_130;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_131;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_132;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_133;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_134;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_135;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_136;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_137;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_138;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_139;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_140;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_141;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_142;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_143;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_144;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_145;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_146;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_147;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_148;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_149;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_150;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_151;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_152;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_ffv_153;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_ffv_154;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_155;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_156;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_157;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_158;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_ffv_159;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_160;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_161;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_162;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_163;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_164;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_165;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_166;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_167;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_168;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_169;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_170;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_171;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_172;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_173;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_174;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_175;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_176;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_177;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_178;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_179;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_180;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_181;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_182;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_183;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_184;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_185;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_186;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_187;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_188;
+
+typedef std::tuple<AgradCdfLogPareto, type_ffv_100> AgradCdfLogPareto_ffv_100;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_101> AgradCdfLogPareto_ffv_101;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_102> AgradCdfLogPareto_ffv_102;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_103> AgradCdfLogPareto_ffv_103;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_104> AgradCdfLogPareto_ffv_104;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_105> AgradCdfLogPareto_ffv_105;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_106> AgradCdfLogPareto_ffv_106;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_107> AgradCdfLogPareto_ffv_107;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_108> AgradCdfLogPareto_ffv_108;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_109> AgradCdfLogPareto_ffv_109;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_110> AgradCdfLogPareto_ffv_110;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_111> AgradCdfLogPareto_ffv_111;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_112> AgradCdfLogPareto_ffv_112;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_113> AgradCdfLogPareto_ffv_113;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_114> AgradCdfLogPareto_ffv_114;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_115> AgradCdfLogPareto_ffv_115;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_116> AgradCdfLogPareto_ffv_116;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_117> AgradCdfLogPareto_ffv_117;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_118> AgradCdfLogPareto_ffv_118;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_119> AgradCdfLogPareto_ffv_119;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_120> AgradCdfLogPareto_ffv_120;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_121> AgradCdfLogPareto_ffv_121;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_122> AgradCdfLogPareto_ffv_122;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_123> AgradCdfLogPareto_ffv_123;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_124> AgradCdfLogPareto_ffv_124;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_125> AgradCdfLogPareto_ffv_125;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_126> AgradCdfLogPareto_ffv_126;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_127> AgradCdfLogPareto_ffv_127;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_128> AgradCdfLogPareto_ffv_128;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_129> AgradCdfLogPareto_ffv_129;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_130> AgradCdfLogPareto_ffv_130;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_131> AgradCdfLogPareto_ffv_131;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_132> AgradCdfLogPareto_ffv_132;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_133> AgradCdfLogPareto_ffv_133;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_134> AgradCdfLogPareto_ffv_134;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_135> AgradCdfLogPareto_ffv_135;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_136> AgradCdfLogPareto_ffv_136;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_137> AgradCdfLogPareto_ffv_137;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_138> AgradCdfLogPareto_ffv_138;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_139> AgradCdfLogPareto_ffv_139;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_140> AgradCdfLogPareto_ffv_140;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_141> AgradCdfLogPareto_ffv_141;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_142> AgradCdfLogPareto_ffv_142;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_143> AgradCdfLogPareto_ffv_143;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_144> AgradCdfLogPareto_ffv_144;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_145> AgradCdfLogPareto_ffv_145;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_146> AgradCdfLogPareto_ffv_146;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_147> AgradCdfLogPareto_ffv_147;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_148> AgradCdfLogPareto_ffv_148;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_149> AgradCdfLogPareto_ffv_149;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_150> AgradCdfLogPareto_ffv_150;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_151> AgradCdfLogPareto_ffv_151;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_152> AgradCdfLogPareto_ffv_152;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_153> AgradCdfLogPareto_ffv_153;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_154> AgradCdfLogPareto_ffv_154;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_155> AgradCdfLogPareto_ffv_155;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_156> AgradCdfLogPareto_ffv_156;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_157> AgradCdfLogPareto_ffv_157;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_158> AgradCdfLogPareto_ffv_158;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_159> AgradCdfLogPareto_ffv_159;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_160> AgradCdfLogPareto_ffv_160;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_161> AgradCdfLogPareto_ffv_161;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_162> AgradCdfLogPareto_ffv_162;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_163> AgradCdfLogPareto_ffv_163;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_164> AgradCdfLogPareto_ffv_164;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_165> AgradCdfLogPareto_ffv_165;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_166> AgradCdfLogPareto_ffv_166;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_167> AgradCdfLogPareto_ffv_167;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_168> AgradCdfLogPareto_ffv_168;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_169> AgradCdfLogPareto_ffv_169;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_170> AgradCdfLogPareto_ffv_170;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_171> AgradCdfLogPareto_ffv_171;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_172> AgradCdfLogPareto_ffv_172;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_173> AgradCdfLogPareto_ffv_173;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_174> AgradCdfLogPareto_ffv_174;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_175> AgradCdfLogPareto_ffv_175;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_176> AgradCdfLogPareto_ffv_176;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_177> AgradCdfLogPareto_ffv_177;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_178> AgradCdfLogPareto_ffv_178;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_179> AgradCdfLogPareto_ffv_179;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_180> AgradCdfLogPareto_ffv_180;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_181> AgradCdfLogPareto_ffv_181;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_182> AgradCdfLogPareto_ffv_182;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_183> AgradCdfLogPareto_ffv_183;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_184> AgradCdfLogPareto_ffv_184;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_185> AgradCdfLogPareto_ffv_185;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_186> AgradCdfLogPareto_ffv_186;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_187> AgradCdfLogPareto_ffv_187;
+typedef std::tuple<AgradCdfLogPareto, type_ffv_188> AgradCdfLogPareto_ffv_188;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_100, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_101, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_102, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_103, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_104, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_105, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_106, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_107, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_108, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_109, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_110, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_111, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_112, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_113, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_114, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_115, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_116, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_117, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_118, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_119, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_120, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_121, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_122, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_123, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_124, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_125, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_126, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_127, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_128, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_129, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_130, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_131, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_132, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_133, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_134, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_135, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_136, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_137, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_138, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_139, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_140, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_141, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_142, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_143, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_144, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_145, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_146, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_147, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_148, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_149, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_150, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_151, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_152, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_153, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_154, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_155, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_156, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_157, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_158, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_159, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_160, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_161, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_162, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_163, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_164, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_165, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_166, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_167, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_168, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_169, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_170, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_171, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_172, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_173, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_174, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_175, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_176, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_177, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_178, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_179, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_180, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_181, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_182, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_183, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_184, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_185, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_186, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_187, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_ffv_188, AgradCdfLogTestFixture, AgradCdfLogPareto_ffv_188);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto/pareto_cdf_log_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_100;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_101;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_102;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_103;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_104;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_105;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_106;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_107;
+typedef std::tuple<var, double, double, empty, empty, empty> type_v_108;
+typedef std::tuple<var, double, std::vector<double>, empty, empty, empty> type_v_109;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_110;
+typedef std::tuple<var, double, var, empty, empty, empty> type_v_111;
+typedef std::tuple<var, double, std::vector<var>, empty, empty, empty> type_v_112;
+typedef std::tuple<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_113;
+typedef std::tuple<var, std::vector<double>, double, empty, empty, empty> type_v_114;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_115;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_116;
+typedef std::tuple<var, std::vector<double>, var, empty, empty, empty> type_v_117;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_118;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_119;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_120;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_121;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_122;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_123;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_124;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_125;
+typedef std::tuple<var, var, double, empty, empty, empty> type_v_126;
+typedef std::tuple<var, var, std::vector<double>, empty, empty, empty> type_v_127;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_128;
+typedef std::tuple<var, var, var, empty, empty, empty> type_v_129;
+typedef std::tuple<var, var, std::vector<var>, empty, empty, empty> type_v_130;
+typedef std::tuple<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_131;
+typedef std::tuple<var, std::vector<var>, double, empty, empty, empty> type_v_132;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_133;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_134;
+typedef std::tuple<var, std::vector<var>, var, empty, empty, empty> type_v_135;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_136;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_137;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_138;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_139;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_140;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_141;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_142;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_143;
+typedef std::tuple<std::vector<var>, double, double, empty, empty, empty> type_v_144;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, empty, empty, empty> type_v_145;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_146;
+typedef std::tuple<std::vector<var>, double, var, empty, empty, empty> type_v_147;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, empty, empty, empty> type_v_148;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_149;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, empty, empty, empty> type_v_150;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_151;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_152;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, empty, empty, empty> type_v_153;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_154;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_155;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_156;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_157;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_158;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_159;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_160;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_161;
+typedef std::tuple<std::vector<var>, var, double, empty, empty, empty> type_v_162;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, empty, empty, empty> type_v_163;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_164;
+typedef std::tuple<std::vector<var>, var, var, empty, empty, empty> type_v_165;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, empty, empty, empty> type_v_166;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_167;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, empty, empty, empty> type_v_168;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_169;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_170;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, empty, empty, empty> type_v_171;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_172;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_173;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_174;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_175;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_176;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_177;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_178;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_179;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_v_180;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_v_181;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_182;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_v_183;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_v_184;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_185;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_v_186;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_187;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_188;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_v_189;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_190;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_191;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_192;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_193;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_194;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_195;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_196;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_197;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_v_198;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_v_199;
+
+typedef std::tuple<AgradCdfLogPareto, type_v_100> AgradCdfLogPareto_v_100;
+typedef std::tuple<AgradCdfLogPareto, type_v_101> AgradCdfLogPareto_v_101;
+typedef std::tuple<AgradCdfLogPareto, type_v_102> AgradCdfLogPareto_v_102;
+typedef std::tuple<AgradCdfLogPareto, type_v_103> AgradCdfLogPareto_v_103;
+typedef std::tuple<AgradCdfLogPareto, type_v_104> AgradCdfLogPareto_v_104;
+typedef std::tuple<AgradCdfLogPareto, type_v_105> AgradCdfLogPareto_v_105;
+typedef std::tuple<AgradCdfLogPareto, type_v_106> AgradCdfLogPareto_v_106;
+typedef std::tuple<AgradCdfLogPareto, type_v_107> AgradCdfLogPareto_v_107;
+typedef std::tuple<AgradCdfLogPareto, type_v_108> AgradCdfLogPareto_v_108;
+typedef std::tuple<AgradCdfLogPareto, type_v_109> AgradCdfLogPareto_v_109;
+typedef std::tuple<AgradCdfLogPareto, type_v_110> AgradCdfLogPareto_v_110;
+typedef std::tuple<AgradCdfLogPareto, type_v_111> AgradCdfLogPareto_v_111;
+typedef std::tuple<AgradCdfLogPareto, type_v_112> AgradCdfLogPareto_v_112;
+typedef std::tuple<AgradCdfLogPareto, type_v_113> AgradCdfLogPareto_v_113;
+typedef std::tuple<AgradCdfLogPareto, type_v_114> AgradCdfLogPareto_v_114;
+typedef std::tuple<AgradCdfLogPareto, type_v_115> AgradCdfLogPareto_v_115;
+typedef std::tuple<AgradCdfLogPareto, type_v_116> AgradCdfLogPareto_v_116;
+typedef std::tuple<AgradCdfLogPareto, type_v_117> AgradCdfLogPareto_v_117;
+typedef std::tuple<AgradCdfLogPareto, type_v_118> AgradCdfLogPareto_v_118;
+typedef std::tuple<AgradCdfLogPareto, type_v_119> AgradCdfLogPareto_v_119;
+typedef std::tuple<AgradCdfLogPareto, type_v_120> AgradCdfLogPareto_v_120;
+typedef std::tuple<AgradCdfLogPareto, type_v_121> AgradCdfLogPareto_v_121;
+typedef std::tuple<AgradCdfLogPareto, type_v_122> AgradCdfLogPareto_v_122;
+typedef std::tuple<AgradCdfLogPareto, type_v_123> AgradCdfLogPareto_v_123;
+typedef std::tuple<AgradCdfLogPareto, type_v_124> AgradCdfLogPareto_v_124;
+typedef std::tuple<AgradCdfLogPareto, type_v_125> AgradCdfLogPareto_v_125;
+typedef std::tuple<AgradCdfLogPareto, type_v_126> AgradCdfLogPareto_v_126;
+typedef std::tuple<AgradCdfLogPareto, type_v_127> AgradCdfLogPareto_v_127;
+typedef std::tuple<AgradCdfLogPareto, type_v_128> AgradCdfLogPareto_v_128;
+typedef std::tuple<AgradCdfLogPareto, type_v_129> AgradCdfLogPareto_v_129;
+typedef std::tuple<AgradCdfLogPareto, type_v_130> AgradCdfLogPareto_v_130;
+typedef std::tuple<AgradCdfLogPareto, type_v_131> AgradCdfLogPareto_v_131;
+typedef std::tuple<AgradCdfLogPareto, type_v_132> AgradCdfLogPareto_v_132;
+typedef std::tuple<AgradCdfLogPareto, type_v_133> AgradCdfLogPareto_v_133;
+typedef std::tuple<AgradCdfLogPareto, type_v_134> AgradCdfLogPareto_v_134;
+typedef std::tuple<AgradCdfLogPareto, type_v_135> AgradCdfLogPareto_v_135;
+typedef std::tuple<AgradCdfLogPareto, type_v_136> AgradCdfLogPareto_v_136;
+typedef std::tuple<AgradCdfLogPareto, type_v_137> AgradCdfLogPareto_v_137;
+typedef std::tuple<AgradCdfLogPareto, type_v_138> AgradCdfLogPareto_v_138;
+typedef std::tuple<AgradCdfLogPareto, type_v_139> AgradCdfLogPareto_v_139;
+typedef std::tuple<AgradCdfLogPareto, type_v_140> AgradCdfLogPareto_v_140;
+typedef std::tuple<AgradCdfLogPareto, type_v_141> AgradCdfLogPareto_v_141;
+typedef std::tuple<AgradCdfLogPareto, type_v_142> AgradCdfLogPareto_v_142;
+typedef std::tuple<AgradCdfLogPareto, type_v_143> AgradCdfLogPareto_v_143;
+typedef std::tuple<AgradCdfLogPareto, type_v_144> AgradCdfLogPareto_v_144;
+typedef std::tuple<AgradCdfLogPareto, type_v_145> AgradCdfLogPareto_v_145;
+typedef std::tuple<AgradCdfLogPareto, type_v_146> AgradCdfLogPareto_v_146;
+typedef std::tuple<AgradCdfLogPareto, type_v_147> AgradCdfLogPareto_v_147;
+typedef std::tuple<AgradCdfLogPareto, type_v_148> AgradCdfLogPareto_v_148;
+typedef std::tuple<AgradCdfLogPareto, type_v_149> AgradCdfLogPareto_v_149;
+typedef std::tuple<AgradCdfLogPareto, type_v_150> AgradCdfLogPareto_v_150;
+typedef std::tuple<AgradCdfLogPareto, type_v_151> AgradCdfLogPareto_v_151;
+typedef std::tuple<AgradCdfLogPareto, type_v_152> AgradCdfLogPareto_v_152;
+typedef std::tuple<AgradCdfLogPareto, type_v_153> AgradCdfLogPareto_v_153;
+typedef std::tuple<AgradCdfLogPareto, type_v_154> AgradCdfLogPareto_v_154;
+typedef std::tuple<AgradCdfLogPareto, type_v_155> AgradCdfLogPareto_v_155;
+typedef std::tuple<AgradCdfLogPareto, type_v_156> AgradCdfLogPareto_v_156;
+typedef std::tuple<AgradCdfLogPareto, type_v_157> AgradCdfLogPareto_v_157;
+typedef std::tuple<AgradCdfLogPareto, type_v_158> AgradCdfLogPareto_v_158;
+typedef std::tuple<AgradCdfLogPareto, type_v_159> AgradCdfLogPareto_v_159;
+typedef std::tuple<AgradCdfLogPareto, type_v_160> AgradCdfLogPareto_v_160;
+typedef std::tuple<AgradCdfLogPareto, type_v_161> AgradCdfLogPareto_v_161;
+typedef std::tuple<AgradCdfLogPareto, type_v_162> AgradCdfLogPareto_v_162;
+typedef std::tuple<AgradCdfLogPareto, type_v_163> AgradCdfLogPareto_v_163;
+typedef std::tuple<AgradCdfLogPareto, type_v_164> AgradCdfLogPareto_v_164;
+typedef std::tuple<AgradCdfLogPareto, type_v_165> AgradCdfLogPareto_v_165;
+typedef std::tuple<AgradCdfLogPareto, type_v_166> AgradCdfLogPareto_v_166;
+typedef std::tuple<AgradCdfLogPareto, type_v_167> AgradCdfLogPareto_v_167;
+typedef std::tuple<AgradCdfLogPareto, type_v_168> AgradCdfLogPareto_v_168;
+typedef std::tuple<AgradCdfLogPareto, type_v_169> AgradCdfLogPareto_v_169;
+typedef std::tuple<AgradCdfLogPareto, type_v_170> AgradCdfLogPareto_v_170;
+typedef std::tuple<AgradCdfLogPareto, type_v_171> AgradCdfLogPareto_v_171;
+typedef std::tuple<AgradCdfLogPareto, type_v_172> AgradCdfLogPareto_v_172;
+typedef std::tuple<AgradCdfLogPareto, type_v_173> AgradCdfLogPareto_v_173;
+typedef std::tuple<AgradCdfLogPareto, type_v_174> AgradCdfLogPareto_v_174;
+typedef std::tuple<AgradCdfLogPareto, type_v_175> AgradCdfLogPareto_v_175;
+typedef std::tuple<AgradCdfLogPareto, type_v_176> AgradCdfLogPareto_v_176;
+typedef std::tuple<AgradCdfLogPareto, type_v_177> AgradCdfLogPareto_v_177;
+typedef std::tuple<AgradCdfLogPareto, type_v_178> AgradCdfLogPareto_v_178;
+typedef std::tuple<AgradCdfLogPareto, type_v_179> AgradCdfLogPareto_v_179;
+typedef std::tuple<AgradCdfLogPareto, type_v_180> AgradCdfLogPareto_v_180;
+typedef std::tuple<AgradCdfLogPareto, type_v_181> AgradCdfLogPareto_v_181;
+typedef std::tuple<AgradCdfLogPareto, type_v_182> AgradCdfLogPareto_v_182;
+typedef std::tuple<AgradCdfLogPareto, type_v_183> AgradCdfLogPareto_v_183;
+typedef std::tuple<AgradCdfLogPareto, type_v_184> AgradCdfLogPareto_v_184;
+typedef std::tuple<AgradCdfLogPareto, type_v_185> AgradCdfLogPareto_v_185;
+typedef std::tuple<AgradCdfLogPareto, type_v_186> AgradCdfLogPareto_v_186;
+typedef std::tuple<AgradCdfLogPareto, type_v_187> AgradCdfLogPareto_v_187;
+typedef std::tuple<AgradCdfLogPareto, type_v_188> AgradCdfLogPareto_v_188;
+typedef std::tuple<AgradCdfLogPareto, type_v_189> AgradCdfLogPareto_v_189;
+typedef std::tuple<AgradCdfLogPareto, type_v_190> AgradCdfLogPareto_v_190;
+typedef std::tuple<AgradCdfLogPareto, type_v_191> AgradCdfLogPareto_v_191;
+typedef std::tuple<AgradCdfLogPareto, type_v_192> AgradCdfLogPareto_v_192;
+typedef std::tuple<AgradCdfLogPareto, type_v_193> AgradCdfLogPareto_v_193;
+typedef std::tuple<AgradCdfLogPareto, type_v_194> AgradCdfLogPareto_v_194;
+typedef std::tuple<AgradCdfLogPareto, type_v_195> AgradCdfLogPareto_v_195;
+typedef std::tuple<AgradCdfLogPareto, type_v_196> AgradCdfLogPareto_v_196;
+typedef std::tuple<AgradCdfLogPareto, type_v_197> AgradCdfLogPareto_v_197;
+typedef std::tuple<AgradCdfLogPareto, type_v_198> AgradCdfLogPareto_v_198;
+typedef std::tuple<AgradCdfLogPareto, type_v_199> AgradCdfLogPareto_v_199;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_100, AgradCdfLogTestFixture, AgradCdfLogPareto_v_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_101, AgradCdfLogTestFixture, AgradCdfLogPareto_v_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_102, AgradCdfLogTestFixture, AgradCdfLogPareto_v_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_103, AgradCdfLogTestFixture, AgradCdfLogPareto_v_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_104, AgradCdfLogTestFixture, AgradCdfLogPareto_v_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_105, AgradCdfLogTestFixture, AgradCdfLogPareto_v_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_106, AgradCdfLogTestFixture, AgradCdfLogPareto_v_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_107, AgradCdfLogTestFixture, AgradCdfLogPareto_v_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_108, AgradCdfLogTestFixture, AgradCdfLogPareto_v_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_109, AgradCdfLogTestFixture, AgradCdfLogPareto_v_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_110, AgradCdfLogTestFixture, AgradCdfLogPareto_v_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_111, AgradCdfLogTestFixture, AgradCdfLogPareto_v_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_112, AgradCdfLogTestFixture, AgradCdfLogPareto_v_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_113, AgradCdfLogTestFixture, AgradCdfLogPareto_v_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_114, AgradCdfLogTestFixture, AgradCdfLogPareto_v_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_115, AgradCdfLogTestFixture, AgradCdfLogPareto_v_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_116, AgradCdfLogTestFixture, AgradCdfLogPareto_v_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_117, AgradCdfLogTestFixture, AgradCdfLogPareto_v_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_118, AgradCdfLogTestFixture, AgradCdfLogPareto_v_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_119, AgradCdfLogTestFixture, AgradCdfLogPareto_v_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_120, AgradCdfLogTestFixture, AgradCdfLogPareto_v_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_121, AgradCdfLogTestFixture, AgradCdfLogPareto_v_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_122, AgradCdfLogTestFixture, AgradCdfLogPareto_v_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_123, AgradCdfLogTestFixture, AgradCdfLogPareto_v_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_124, AgradCdfLogTestFixture, AgradCdfLogPareto_v_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_125, AgradCdfLogTestFixture, AgradCdfLogPareto_v_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_126, AgradCdfLogTestFixture, AgradCdfLogPareto_v_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_127, AgradCdfLogTestFixture, AgradCdfLogPareto_v_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_128, AgradCdfLogTestFixture, AgradCdfLogPareto_v_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_129, AgradCdfLogTestFixture, AgradCdfLogPareto_v_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_130, AgradCdfLogTestFixture, AgradCdfLogPareto_v_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_131, AgradCdfLogTestFixture, AgradCdfLogPareto_v_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_132, AgradCdfLogTestFixture, AgradCdfLogPareto_v_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_133, AgradCdfLogTestFixture, AgradCdfLogPareto_v_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_134, AgradCdfLogTestFixture, AgradCdfLogPareto_v_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_135, AgradCdfLogTestFixture, AgradCdfLogPareto_v_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_136, AgradCdfLogTestFixture, AgradCdfLogPareto_v_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_137, AgradCdfLogTestFixture, AgradCdfLogPareto_v_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_138, AgradCdfLogTestFixture, AgradCdfLogPareto_v_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_139, AgradCdfLogTestFixture, AgradCdfLogPareto_v_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_140, AgradCdfLogTestFixture, AgradCdfLogPareto_v_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_141, AgradCdfLogTestFixture, AgradCdfLogPareto_v_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_142, AgradCdfLogTestFixture, AgradCdfLogPareto_v_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_143, AgradCdfLogTestFixture, AgradCdfLogPareto_v_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_144, AgradCdfLogTestFixture, AgradCdfLogPareto_v_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_145, AgradCdfLogTestFixture, AgradCdfLogPareto_v_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_146, AgradCdfLogTestFixture, AgradCdfLogPareto_v_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_147, AgradCdfLogTestFixture, AgradCdfLogPareto_v_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_148, AgradCdfLogTestFixture, AgradCdfLogPareto_v_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_149, AgradCdfLogTestFixture, AgradCdfLogPareto_v_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_150, AgradCdfLogTestFixture, AgradCdfLogPareto_v_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_151, AgradCdfLogTestFixture, AgradCdfLogPareto_v_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_152, AgradCdfLogTestFixture, AgradCdfLogPareto_v_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_153, AgradCdfLogTestFixture, AgradCdfLogPareto_v_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_154, AgradCdfLogTestFixture, AgradCdfLogPareto_v_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_155, AgradCdfLogTestFixture, AgradCdfLogPareto_v_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_156, AgradCdfLogTestFixture, AgradCdfLogPareto_v_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_157, AgradCdfLogTestFixture, AgradCdfLogPareto_v_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_158, AgradCdfLogTestFixture, AgradCdfLogPareto_v_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_159, AgradCdfLogTestFixture, AgradCdfLogPareto_v_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_160, AgradCdfLogTestFixture, AgradCdfLogPareto_v_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_161, AgradCdfLogTestFixture, AgradCdfLogPareto_v_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_162, AgradCdfLogTestFixture, AgradCdfLogPareto_v_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_163, AgradCdfLogTestFixture, AgradCdfLogPareto_v_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_164, AgradCdfLogTestFixture, AgradCdfLogPareto_v_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_165, AgradCdfLogTestFixture, AgradCdfLogPareto_v_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_166, AgradCdfLogTestFixture, AgradCdfLogPareto_v_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_167, AgradCdfLogTestFixture, AgradCdfLogPareto_v_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_168, AgradCdfLogTestFixture, AgradCdfLogPareto_v_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_169, AgradCdfLogTestFixture, AgradCdfLogPareto_v_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_170, AgradCdfLogTestFixture, AgradCdfLogPareto_v_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_171, AgradCdfLogTestFixture, AgradCdfLogPareto_v_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_172, AgradCdfLogTestFixture, AgradCdfLogPareto_v_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_173, AgradCdfLogTestFixture, AgradCdfLogPareto_v_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_174, AgradCdfLogTestFixture, AgradCdfLogPareto_v_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_175, AgradCdfLogTestFixture, AgradCdfLogPareto_v_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_176, AgradCdfLogTestFixture, AgradCdfLogPareto_v_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_177, AgradCdfLogTestFixture, AgradCdfLogPareto_v_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_178, AgradCdfLogTestFixture, AgradCdfLogPareto_v_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_179, AgradCdfLogTestFixture, AgradCdfLogPareto_v_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_180, AgradCdfLogTestFixture, AgradCdfLogPareto_v_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_181, AgradCdfLogTestFixture, AgradCdfLogPareto_v_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_182, AgradCdfLogTestFixture, AgradCdfLogPareto_v_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_183, AgradCdfLogTestFixture, AgradCdfLogPareto_v_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_184, AgradCdfLogTestFixture, AgradCdfLogPareto_v_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_185, AgradCdfLogTestFixture, AgradCdfLogPareto_v_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_186, AgradCdfLogTestFixture, AgradCdfLogPareto_v_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_187, AgradCdfLogTestFixture, AgradCdfLogPareto_v_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_188, AgradCdfLogTestFixture, AgradCdfLogPareto_v_188);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_189, AgradCdfLogTestFixture, AgradCdfLogPareto_v_189);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_190, AgradCdfLogTestFixture, AgradCdfLogPareto_v_190);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_191, AgradCdfLogTestFixture, AgradCdfLogPareto_v_191);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_192, AgradCdfLogTestFixture, AgradCdfLogPareto_v_192);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_193, AgradCdfLogTestFixture, AgradCdfLogPareto_v_193);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_194, AgradCdfLogTestFixture, AgradCdfLogPareto_v_194);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_195, AgradCdfLogTestFixture, AgradCdfLogPareto_v_195);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_196, AgradCdfLogTestFixture, AgradCdfLogPareto_v_196);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_197, AgradCdfLogTestFixture, AgradCdfLogPareto_v_197);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_198, AgradCdfLogTestFixture, AgradCdfLogPareto_v_198);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_199, AgradCdfLogTestFixture, AgradCdfLogPareto_v_199);
+
@@ -0,0 +1,278 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto/pareto_cdf_log_test.hpp>
+
+typedef std::tuple<var, var, std::vector<double>, empty, empty, empty> type_vv_100;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_101;
+typedef std::tuple<var, var, var, empty, empty, empty> type_vv_102;
+typedef std::tuple<var, var, std::vector<var>, empty, empty, empty> type_vv_103;
+typedef std::tuple<var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_104;
+typedef std::tuple<var, std::vector<var>, double, empty, empty, empty> type_vv_105;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_106;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_107;
+typedef std::tuple<var, std::vector<var>, var, empty, empty, empty> type_vv_108;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_109;
+typedef std::tuple<var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_110;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_111;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_112;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_113;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_114;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_115;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_116;
+typedef std::tuple<std::vector<var>, double, double, empty, empty, empty> type_vv_117;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, empty, empty, empty> type_vv_118;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_119;
+typedef std::tuple<std::vector<var>, double, var, empty, empty, empty> type_vv_120;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, empty, empty, empty> type_vv_121;
+typedef std::tuple<std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_122;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, empty, empty, empty> type_vv_123;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_124;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_125;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, empty, empty, empty> type_vv_126;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_127;
+typedef std::tuple<std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_128;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_129;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_130;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_131;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_132;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_133;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_134;
+typedef std::tuple<std::vector<var>, var, double, empty, empty, empty> type_vv_135;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, empty, empty, empty> type_vv_136;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_137;
+typedef std::tuple<std::vector<var>, var, var, empty, empty, empty> type_vv_138;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, empty, empty, empty> type_vv_139;
+typedef std::tuple<std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_140;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, empty, empty, empty> type_vv_141;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_142;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_143;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, empty, empty, empty> type_vv_144;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_145;
+typedef std::tuple<std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_146;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_147;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_148;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_149;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_150;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_151;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_152;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, empty, empty, empty> type_vv_153;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, empty, empty, empty> type_vv_154;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_155;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, empty, empty, empty> type_vv_156;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, empty, empty, empty> type_vv_157;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_158;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, empty, empty, empty> type_vv_159;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_160;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_161;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, empty, empty, empty> type_vv_162;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_163;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_164;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_165;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_166;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_167;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_168;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_169;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_170;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, empty, empty, empty> type_vv_171;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, empty, empty, empty> type_vv_172;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_173;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, empty, empty, empty> type_vv_174;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, empty, empty, empty> type_vv_175;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_176;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, empty, empty, empty> type_vv_177;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_178;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_179;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, empty, empty, empty> type_vv_180;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_181;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_182;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_183;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_184;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_185;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_186;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_187;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_188;
+
+typedef std::tuple<AgradCdfLogPareto, type_vv_100> AgradCdfLogPareto_vv_100;
+typedef std::tuple<AgradCdfLogPareto, type_vv_101> AgradCdfLogPareto_vv_101;
+typedef std::tuple<AgradCdfLogPareto, type_vv_102> AgradCdfLogPareto_vv_102;
+typedef std::tuple<AgradCdfLogPareto, type_vv_103> AgradCdfLogPareto_vv_103;
+typedef std::tuple<AgradCdfLogPareto, type_vv_104> AgradCdfLogPareto_vv_104;
+typedef std::tuple<AgradCdfLogPareto, type_vv_105> AgradCdfLogPareto_vv_105;
+typedef std::tuple<AgradCdfLogPareto, type_vv_106> AgradCdfLogPareto_vv_106;
+typedef std::tuple<AgradCdfLogPareto, type_vv_107> AgradCdfLogPareto_vv_107;
+typedef std::tuple<AgradCdfLogPareto, type_vv_108> AgradCdfLogPareto_vv_108;
+typedef std::tuple<AgradCdfLogPareto, type_vv_109> AgradCdfLogPareto_vv_109;
+typedef std::tuple<AgradCdfLogPareto, type_vv_110> AgradCdfLogPareto_vv_110;
+typedef std::tuple<AgradCdfLogPareto, type_vv_111> AgradCdfLogPareto_vv_111;
+typedef std::tuple<AgradCdfLogPareto, type_vv_112> AgradCdfLogPareto_vv_112;
+typedef std::tuple<AgradCdfLogPareto, type_vv_113> AgradCdfLogPareto_vv_113;
+typedef std::tuple<AgradCdfLogPareto, type_vv_114> AgradCdfLogPareto_vv_114;
+typedef std::tuple<AgradCdfLogPareto, type_vv_115> AgradCdfLogPareto_vv_115;
+typedef std::tuple<AgradCdfLogPareto, type_vv_116> AgradCdfLogPareto_vv_116;
+typedef std::tuple<AgradCdfLogPareto, type_vv_117> AgradCdfLogPareto_vv_117;
+typedef std::tuple<AgradCdfLogPareto, type_vv_118> AgradCdfLogPareto_vv_118;
+typedef std::tuple<AgradCdfLogPareto, type_vv_119> AgradCdfLogPareto_vv_119;
+typedef std::tuple<AgradCdfLogPareto, type_vv_120> AgradCdfLogPareto_vv_120;
+typedef std::tuple<AgradCdfLogPareto, type_vv_121> AgradCdfLogPareto_vv_121;
+typedef std::tuple<AgradCdfLogPareto, type_vv_122> AgradCdfLogPareto_vv_122;
+typedef std::tuple<AgradCdfLogPareto, type_vv_123> AgradCdfLogPareto_vv_123;
+typedef std::tuple<AgradCdfLogPareto, type_vv_124> AgradCdfLogPareto_vv_124;
+typedef std::tuple<AgradCdfLogPareto, type_vv_125> AgradCdfLogPareto_vv_125;
+typedef std::tuple<AgradCdfLogPareto, type_vv_126> AgradCdfLogPareto_vv_126;
+typedef std::tuple<AgradCdfLogPareto, type_vv_127> AgradCdfLogPareto_vv_127;
+typedef std::tuple<AgradCdfLogPareto, type_vv_128> AgradCdfLogPareto_vv_128;
+typedef std::tuple<AgradCdfLogPareto, type_vv_129> AgradCdfLogPareto_vv_129;
+typedef std::tuple<AgradCdfLogPareto, type_vv_130> AgradCdfLogPareto_vv_130;
+typedef std::tuple<AgradCdfLogPareto, type_vv_131> AgradCdfLogPareto_vv_131;
+typedef std::tuple<AgradCdfLogPareto, type_vv_132> AgradCdfLogPareto_vv_132;
+typedef std::tuple<AgradCdfLogPareto, type_vv_133> AgradCdfLogPareto_vv_133;
+typedef std::tuple<AgradCdfLogPareto, type_vv_134> AgradCdfLogPareto_vv_134;
+typedef std::tuple<AgradCdfLogPareto, type_vv_135> AgradCdfLogPareto_vv_135;
+typedef std::tuple<AgradCdfLogPareto, type_vv_136> AgradCdfLogPareto_vv_136;
+typedef std::tuple<AgradCdfLogPareto, type_vv_137> AgradCdfLogPareto_vv_137;
+typedef std::tuple<AgradCdfLogPareto, type_vv_138> AgradCdfLogPareto_vv_138;
+typedef std::tuple<AgradCdfLogPareto, type_vv_139> AgradCdfLogPareto_vv_139;
+typedef std::tuple<AgradCdfLogPareto, type_vv_140> AgradCdfLogPareto_vv_140;
+typedef std::tuple<AgradCdfLogPareto, type_vv_141> AgradCdfLogPareto_vv_141;
+typedef std::tuple<AgradCdfLogPareto, type_vv_142> AgradCdfLogPareto_vv_142;
+typedef std::tuple<AgradCdfLogPareto, type_vv_143> AgradCdfLogPareto_vv_143;
+typedef std::tuple<AgradCdfLogPareto, type_vv_144> AgradCdfLogPareto_vv_144;
+typedef std::tuple<AgradCdfLogPareto, type_vv_145> AgradCdfLogPareto_vv_145;
+typedef std::tuple<AgradCdfLogPareto, type_vv_146> AgradCdfLogPareto_vv_146;
+typedef std::tuple<AgradCdfLogPareto, type_vv_147> AgradCdfLogPareto_vv_147;
+typedef std::tuple<AgradCdfLogPareto, type_vv_148> AgradCdfLogPareto_vv_148;
+typedef std::tuple<AgradCdfLogPareto, type_vv_149> AgradCdfLogPareto_vv_149;
+typedef std::tuple<AgradCdfLogPareto, type_vv_150> AgradCdfLogPareto_vv_150;
+typedef std::tuple<AgradCdfLogPareto, type_vv_151> AgradCdfLogPareto_vv_151;
+typedef std::tuple<AgradCdfLogPareto, type_vv_152> AgradCdfLogPareto_vv_152;
+typedef std::tuple<AgradCdfLogPareto, type_vv_153> AgradCdfLogPareto_vv_153;
+typedef std::tuple<AgradCdfLogPareto, type_vv_154> AgradCdfLogPareto_vv_154;
+typedef std::tuple<AgradCdfLogPareto, type_vv_155> AgradCdfLogPareto_vv_155;
+typedef std::tuple<AgradCdfLogPareto, type_vv_156> AgradCdfLogPareto_vv_156;
+typedef std::tuple<AgradCdfLogPareto, type_vv_157> AgradCdfLogPareto_vv_157;
+typedef std::tuple<AgradCdfLogPareto, type_vv_158> AgradCdfLogPareto_vv_158;
+typedef std::tuple<AgradCdfLogPareto, type_vv_159> AgradCdfLogPareto_vv_159;
+typedef std::tuple<AgradCdfLogPareto, type_vv_160> AgradCdfLogPareto_vv_160;
+typedef std::tuple<AgradCdfLogPareto, type_vv_161> AgradCdfLogPareto_vv_161;
+typedef std::tuple<AgradCdfLogPareto, type_vv_162> AgradCdfLogPareto_vv_162;
+typedef std::tuple<AgradCdfLogPareto, type_vv_163> AgradCdfLogPareto_vv_163;
+typedef std::tuple<AgradCdfLogPareto, type_vv_164> AgradCdfLogPareto_vv_164;
+typedef std::tuple<AgradCdfLogPareto, type_vv_165> AgradCdfLogPareto_vv_165;
+typedef std::tuple<AgradCdfLogPareto, type_vv_166> AgradCdfLogPareto_vv_166;
+typedef std::tuple<AgradCdfLogPareto, type_vv_167> AgradCdfLogPareto_vv_167;
+typedef std::tuple<AgradCdfLogPareto, type_vv_168> AgradCdfLogPareto_vv_168;
+typedef std::tuple<AgradCdfLogPareto, type_vv_169> AgradCdfLogPareto_vv_169;
+typedef std::tuple<AgradCdfLogPareto, type_vv_170> AgradCdfLogPareto_vv_170;
+typedef std::tuple<AgradCdfLogPareto, type_vv_171> AgradCdfLogPareto_vv_171;
+typedef std::tuple<AgradCdfLogPareto, type_vv_172> AgradCdfLogPareto_vv_172;
+typedef std::tuple<AgradCdfLogPareto, type_vv_173> AgradCdfLogPareto_vv_173;
+typedef std::tuple<AgradCdfLogPareto, type_vv_174> AgradCdfLogPareto_vv_174;
+typedef std::tuple<AgradCdfLogPareto, type_vv_175> AgradCdfLogPareto_vv_175;
+typedef std::tuple<AgradCdfLogPareto, type_vv_176> AgradCdfLogPareto_vv_176;
+typedef std::tuple<AgradCdfLogPareto, type_vv_177> AgradCdfLogPareto_vv_177;
+typedef std::tuple<AgradCdfLogPareto, type_vv_178> AgradCdfLogPareto_vv_178;
+typedef std::tuple<AgradCdfLogPareto, type_vv_179> AgradCdfLogPareto_vv_179;
+typedef std::tuple<AgradCdfLogPareto, type_vv_180> AgradCdfLogPareto_vv_180;
+typedef std::tuple<AgradCdfLogPareto, type_vv_181> AgradCdfLogPareto_vv_181;
+typedef std::tuple<AgradCdfLogPareto, type_vv_182> AgradCdfLogPareto_vv_182;
+typedef std::tuple<AgradCdfLogPareto, type_vv_183> AgradCdfLogPareto_vv_183;
+typedef std::tuple<AgradCdfLogPareto, type_vv_184> AgradCdfLogPareto_vv_184;
+typedef std::tuple<AgradCdfLogPareto, type_vv_185> AgradCdfLogPareto_vv_185;
+typedef std::tuple<AgradCdfLogPareto, type_vv_186> AgradCdfLogPareto_vv_186;
+typedef std::tuple<AgradCdfLogPareto, type_vv_187> AgradCdfLogPareto_vv_187;
+typedef std::tuple<AgradCdfLogPareto, type_vv_188> AgradCdfLogPareto_vv_188;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_100, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_101, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_102, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_103, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_104, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_105, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_106, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_107, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_108, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_109, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_110, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_111, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_112, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_113, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_114, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_115, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_116, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_117, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_118, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_119, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_120, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_121, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_122, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_123, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_124, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_125, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_126, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_127, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_128, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_129, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_130, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_131, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_132, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_133, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_134, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_135, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_136, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_137, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_138, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_139, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_140, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_141, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_142, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_143, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_144, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_145, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_146, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_147, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_148, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_149, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_150, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_151, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_152, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_153, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_154, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_155, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_156, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_157, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_158, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_159, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_160, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_161, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_162, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_163, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_164, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_165, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_166, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_167, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_168, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_169, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_170, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_171, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_172, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_173, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_174, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_175, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_176, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_177, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_178, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_179, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_180, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_181, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_182, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_183, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_184, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_185, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_186, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_187, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_vv_188, AgradCdfLogTestFixture, AgradCdfLogPareto_vv_188);
+
@@ -0,0 +1,59 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto/pareto_cdf_log_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_200;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_v_201;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_v_202;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_203;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_v_204;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_205;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_206;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_v_207;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_208;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_209;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_210;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_211;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_212;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_213;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_214;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_215;
+
+typedef std::tuple<AgradCdfLogPareto, type_v_200> AgradCdfLogPareto_v_200;
+typedef std::tuple<AgradCdfLogPareto, type_v_201> AgradCdfLogPareto_v_201;
+typedef std::tuple<AgradCdfLogPareto, type_v_202> AgradCdfLogPareto_v_202;
+typedef std::tuple<AgradCdfLogPareto, type_v_203> AgradCdfLogPareto_v_203;
+typedef std::tuple<AgradCdfLogPareto, type_v_204> AgradCdfLogPareto_v_204;
+typedef std::tuple<AgradCdfLogPareto, type_v_205> AgradCdfLogPareto_v_205;
+typedef std::tuple<AgradCdfLogPareto, type_v_206> AgradCdfLogPareto_v_206;
+typedef std::tuple<AgradCdfLogPareto, type_v_207> AgradCdfLogPareto_v_207;
+typedef std::tuple<AgradCdfLogPareto, type_v_208> AgradCdfLogPareto_v_208;
+typedef std::tuple<AgradCdfLogPareto, type_v_209> AgradCdfLogPareto_v_209;
+typedef std::tuple<AgradCdfLogPareto, type_v_210> AgradCdfLogPareto_v_210;
+typedef std::tuple<AgradCdfLogPareto, type_v_211> AgradCdfLogPareto_v_211;
+typedef std::tuple<AgradCdfLogPareto, type_v_212> AgradCdfLogPareto_v_212;
+typedef std::tuple<AgradCdfLogPareto, type_v_213> AgradCdfLogPareto_v_213;
+typedef std::tuple<AgradCdfLogPareto, type_v_214> AgradCdfLogPareto_v_214;
+typedef std::tuple<AgradCdfLogPareto, type_v_215> AgradCdfLogPareto_v_215;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_200, AgradCdfLogTestFixture, AgradCdfLogPareto_v_200);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_201, AgradCdfLogTestFixture, AgradCdfLogPareto_v_201);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_202, AgradCdfLogTestFixture, AgradCdfLogPareto_v_202);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_203, AgradCdfLogTestFixture, AgradCdfLogPareto_v_203);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_204, AgradCdfLogTestFixture, AgradCdfLogPareto_v_204);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_205, AgradCdfLogTestFixture, AgradCdfLogPareto_v_205);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_206, AgradCdfLogTestFixture, AgradCdfLogPareto_v_206);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_207, AgradCdfLogTestFixture, AgradCdfLogPareto_v_207);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_208, AgradCdfLogTestFixture, AgradCdfLogPareto_v_208);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_209, AgradCdfLogTestFixture, AgradCdfLogPareto_v_209);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_210, AgradCdfLogTestFixture, AgradCdfLogPareto_v_210);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_211, AgradCdfLogTestFixture, AgradCdfLogPareto_v_211);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_212, AgradCdfLogTestFixture, AgradCdfLogPareto_v_212);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_213, AgradCdfLogTestFixture, AgradCdfLogPareto_v_213);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_214, AgradCdfLogTestFixture, AgradCdfLogPareto_v_214);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPareto_v_215, AgradCdfLogTestFixture, AgradCdfLogPareto_v_215);
+
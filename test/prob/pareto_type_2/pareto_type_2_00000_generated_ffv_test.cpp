@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_test.hpp>
+
+typedef std::tuple<double, double, double, fvar<fvar<var> >, empty, empty> type_ffv_0;
+typedef std::tuple<double, double, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1;
+typedef std::tuple<double, double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_2;
+typedef std::tuple<double, double, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_3;
+typedef std::tuple<double, double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_4;
+typedef std::tuple<double, double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_5;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_6;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_7;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_8;
+typedef std::tuple<double, double, fvar<fvar<var> >, double, empty, empty> type_ffv_9;
+typedef std::tuple<double, double, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_10;
+typedef std::tuple<double, double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_11;
+typedef std::tuple<double, double, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_12;
+typedef std::tuple<double, double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_13;
+typedef std::tuple<double, double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_14;
+typedef std::tuple<double, double, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_15;
+typedef std::tuple<double, double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_16;
+typedef std::tuple<double, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_17;
+typedef std::tuple<double, double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_18;
+typedef std::tuple<double, double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_19;
+typedef std::tuple<double, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_20;
+typedef std::tuple<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_21;
+typedef std::tuple<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_22;
+typedef std::tuple<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_23;
+typedef std::tuple<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_24;
+typedef std::tuple<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_25;
+typedef std::tuple<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_26;
+typedef std::tuple<double, std::vector<double>, double, fvar<fvar<var> >, empty, empty> type_ffv_27;
+typedef std::tuple<double, std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_28;
+typedef std::tuple<double, std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_29;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_30;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_31;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_32;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_33;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_34;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_35;
+typedef std::tuple<double, std::vector<double>, fvar<fvar<var> >, double, empty, empty> type_ffv_36;
+typedef std::tuple<double, std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_37;
+typedef std::tuple<double, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_38;
+typedef std::tuple<double, std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_39;
+typedef std::tuple<double, std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_40;
+typedef std::tuple<double, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_41;
+typedef std::tuple<double, std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_42;
+typedef std::tuple<double, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_43;
+typedef std::tuple<double, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_44;
+typedef std::tuple<double, std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_45;
+typedef std::tuple<double, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_46;
+typedef std::tuple<double, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_47;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_48;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_49;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_50;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_51;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_52;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_53;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_54;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_55;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_56;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_57;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_58;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_59;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_60;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_61;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_62;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_63;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_64;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_65;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_66;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_67;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_68;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_69;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_70;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_71;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_72;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_73;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_74;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_75;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_76;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_77;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_78;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_79;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_80;
+typedef std::tuple<double, fvar<fvar<var> >, double, double, empty, empty> type_ffv_81;
+typedef std::tuple<double, fvar<fvar<var> >, double, std::vector<double>, empty, empty> type_ffv_82;
+typedef std::tuple<double, fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_83;
+typedef std::tuple<double, fvar<fvar<var> >, double, fvar<fvar<var> >, empty, empty> type_ffv_84;
+typedef std::tuple<double, fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_85;
+typedef std::tuple<double, fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_86;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<double>, double, empty, empty> type_ffv_87;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty, empty> type_ffv_88;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_89;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_90;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_91;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_92;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_93;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_94;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_95;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_96;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_97;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_98;
+typedef std::tuple<double, fvar<fvar<var> >, fvar<fvar<var> >, double, empty, empty> type_ffv_99;
+
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_0> AgradDistributionParetoType2_ffv_0;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1> AgradDistributionParetoType2_ffv_1;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_2> AgradDistributionParetoType2_ffv_2;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_3> AgradDistributionParetoType2_ffv_3;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_4> AgradDistributionParetoType2_ffv_4;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_5> AgradDistributionParetoType2_ffv_5;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_6> AgradDistributionParetoType2_ffv_6;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_7> AgradDistributionParetoType2_ffv_7;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_8> AgradDistributionParetoType2_ffv_8;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_9> AgradDistributionParetoType2_ffv_9;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_10> AgradDistributionParetoType2_ffv_10;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_11> AgradDistributionParetoType2_ffv_11;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_12> AgradDistributionParetoType2_ffv_12;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_13> AgradDistributionParetoType2_ffv_13;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_14> AgradDistributionParetoType2_ffv_14;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_15> AgradDistributionParetoType2_ffv_15;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_16> AgradDistributionParetoType2_ffv_16;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_17> AgradDistributionParetoType2_ffv_17;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_18> AgradDistributionParetoType2_ffv_18;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_19> AgradDistributionParetoType2_ffv_19;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_20> AgradDistributionParetoType2_ffv_20;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_21> AgradDistributionParetoType2_ffv_21;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_22> AgradDistributionParetoType2_ffv_22;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_23> AgradDistributionParetoType2_ffv_23;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_24> AgradDistributionParetoType2_ffv_24;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_25> AgradDistributionParetoType2_ffv_25;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_26> AgradDistributionParetoType2_ffv_26;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_27> AgradDistributionParetoType2_ffv_27;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_28> AgradDistributionParetoType2_ffv_28;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_29> AgradDistributionParetoType2_ffv_29;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_30> AgradDistributionParetoType2_ffv_30;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_31> AgradDistributionParetoType2_ffv_31;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_32> AgradDistributionParetoType2_ffv_32;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_33> AgradDistributionParetoType2_ffv_33;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_34> AgradDistributionParetoType2_ffv_34;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_35> AgradDistributionParetoType2_ffv_35;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_36> AgradDistributionParetoType2_ffv_36;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_37> AgradDistributionParetoType2_ffv_37;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_38> AgradDistributionParetoType2_ffv_38;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_39> AgradDistributionParetoType2_ffv_39;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_40> AgradDistributionParetoType2_ffv_40;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_41> AgradDistributionParetoType2_ffv_41;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_42> AgradDistributionParetoType2_ffv_42;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_43> AgradDistributionParetoType2_ffv_43;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_44> AgradDistributionParetoType2_ffv_44;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_45> AgradDistributionParetoType2_ffv_45;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_46> AgradDistributionParetoType2_ffv_46;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_47> AgradDistributionParetoType2_ffv_47;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_48> AgradDistributionParetoType2_ffv_48;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_49> AgradDistributionParetoType2_ffv_49;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_50> AgradDistributionParetoType2_ffv_50;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_51> AgradDistributionParetoType2_ffv_51;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_52> AgradDistributionParetoType2_ffv_52;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_53> AgradDistributionParetoType2_ffv_53;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_54> AgradDistributionParetoType2_ffv_54;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_55> AgradDistributionParetoType2_ffv_55;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_56> AgradDistributionParetoType2_ffv_56;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_57> AgradDistributionParetoType2_ffv_57;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_58> AgradDistributionParetoType2_ffv_58;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_59> AgradDistributionParetoType2_ffv_59;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_60> AgradDistributionParetoType2_ffv_60;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_61> AgradDistributionParetoType2_ffv_61;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_62> AgradDistributionParetoType2_ffv_62;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_63> AgradDistributionParetoType2_ffv_63;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_64> AgradDistributionParetoType2_ffv_64;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_65> AgradDistributionParetoType2_ffv_65;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_66> AgradDistributionParetoType2_ffv_66;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_67> AgradDistributionParetoType2_ffv_67;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_68> AgradDistributionParetoType2_ffv_68;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_69> AgradDistributionParetoType2_ffv_69;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_70> AgradDistributionParetoType2_ffv_70;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_71> AgradDistributionParetoType2_ffv_71;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_72> AgradDistributionParetoType2_ffv_72;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_73> AgradDistributionParetoType2_ffv_73;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_74> AgradDistributionParetoType2_ffv_74;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_75> AgradDistributionParetoType2_ffv_75;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_76> AgradDistributionParetoType2_ffv_76;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_77> AgradDistributionParetoType2_ffv_77;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_78> AgradDistributionParetoType2_ffv_78;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_79> AgradDistributionParetoType2_ffv_79;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_80> AgradDistributionParetoType2_ffv_80;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_81> AgradDistributionParetoType2_ffv_81;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_82> AgradDistributionParetoType2_ffv_82;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_83> AgradDistributionParetoType2_ffv_83;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_84> AgradDistributionParetoType2_ffv_84;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_85> AgradDistributionParetoType2_ffv_85;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_86> AgradDistributionParetoType2_ffv_86;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_87> AgradDistributionParetoType2_ffv_87;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_88> AgradDistributionParetoType2_ffv_88;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_89> AgradDistributionParetoType2_ffv_89;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_90> AgradDistributionParetoType2_ffv_90;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_91> AgradDistributionParetoType2_ffv_91;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_92> AgradDistributionParetoType2_ffv_92;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_93> AgradDistributionParetoType2_ffv_93;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_94> AgradDistributionParetoType2_ffv_94;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_95> AgradDistributionParetoType2_ffv_95;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_96> AgradDistributionParetoType2_ffv_96;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_97> AgradDistributionParetoType2_ffv_97;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_98> AgradDistributionParetoType2_ffv_98;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_99> AgradDistributionParetoType2_ffv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_0, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_2, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_3, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_4, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_5, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_6, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_7, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_8, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_9, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_10, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_11, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_12, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_13, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_14, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_15, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_16, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_17, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_18, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_19, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_20, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_21, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_22, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_23, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_24, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_25, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_26, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_27, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_28, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_29, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_30, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_31, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_32, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_33, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_34, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_35, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_36, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_37, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_38, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_39, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_40, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_41, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_42, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_43, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_44, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_45, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_46, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_47, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_48, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_49, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_50, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_51, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_52, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_53, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_54, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_55, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_56, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_57, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_58, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_59, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_60, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_61, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_62, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_63, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_64, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_65, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_66, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_67, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_68, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_69, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_70, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_71, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_72, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_73, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_74, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_75, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_76, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_77, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_78, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_79, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_80, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_81, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_82, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_83, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_84, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_85, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_86, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_87, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_88, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_89, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_90, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_91, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_92, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_93, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_94, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_95, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_96, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_97, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_98, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_99, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_99);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_test.hpp>
+
+typedef std::tuple<double, double, double, double, empty, empty> type_v_0;
+typedef std::tuple<double, double, double, std::vector<double>, empty, empty> type_v_1;
+typedef std::tuple<double, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_2;
+typedef std::tuple<double, double, double, var, empty, empty> type_v_3;
+typedef std::tuple<double, double, double, std::vector<var>, empty, empty> type_v_4;
+typedef std::tuple<double, double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_5;
+typedef std::tuple<double, double, std::vector<double>, double, empty, empty> type_v_6;
+typedef std::tuple<double, double, std::vector<double>, std::vector<double>, empty, empty> type_v_7;
+typedef std::tuple<double, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_8;
+typedef std::tuple<double, double, std::vector<double>, var, empty, empty> type_v_9;
+typedef std::tuple<double, double, std::vector<double>, std::vector<var>, empty, empty> type_v_10;
+typedef std::tuple<double, double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_11;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_12;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_13;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_14;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_15;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_16;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_17;
+typedef std::tuple<double, double, var, double, empty, empty> type_v_18;
+typedef std::tuple<double, double, var, std::vector<double>, empty, empty> type_v_19;
+typedef std::tuple<double, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_20;
+typedef std::tuple<double, double, var, var, empty, empty> type_v_21;
+typedef std::tuple<double, double, var, std::vector<var>, empty, empty> type_v_22;
+typedef std::tuple<double, double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_23;
+typedef std::tuple<double, double, std::vector<var>, double, empty, empty> type_v_24;
+typedef std::tuple<double, double, std::vector<var>, std::vector<double>, empty, empty> type_v_25;
+typedef std::tuple<double, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_26;
+typedef std::tuple<double, double, std::vector<var>, var, empty, empty> type_v_27;
+typedef std::tuple<double, double, std::vector<var>, std::vector<var>, empty, empty> type_v_28;
+typedef std::tuple<double, double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_29;
+typedef std::tuple<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_30;
+typedef std::tuple<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_31;
+typedef std::tuple<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_32;
+typedef std::tuple<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_33;
+typedef std::tuple<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_34;
+typedef std::tuple<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_35;
+typedef std::tuple<double, std::vector<double>, double, double, empty, empty> type_v_36;
+typedef std::tuple<double, std::vector<double>, double, std::vector<double>, empty, empty> type_v_37;
+typedef std::tuple<double, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_38;
+typedef std::tuple<double, std::vector<double>, double, var, empty, empty> type_v_39;
+typedef std::tuple<double, std::vector<double>, double, std::vector<var>, empty, empty> type_v_40;
+typedef std::tuple<double, std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_41;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, double, empty, empty> type_v_42;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, std::vector<double>, empty, empty> type_v_43;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_44;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, var, empty, empty> type_v_45;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_v_46;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_47;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_48;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_49;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_50;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_51;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_52;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_53;
+typedef std::tuple<double, std::vector<double>, var, double, empty, empty> type_v_54;
+typedef std::tuple<double, std::vector<double>, var, std::vector<double>, empty, empty> type_v_55;
+typedef std::tuple<double, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_56;
+typedef std::tuple<double, std::vector<double>, var, var, empty, empty> type_v_57;
+typedef std::tuple<double, std::vector<double>, var, std::vector<var>, empty, empty> type_v_58;
+typedef std::tuple<double, std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_59;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, double, empty, empty> type_v_60;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_v_61;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_62;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, var, empty, empty> type_v_63;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_v_64;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_65;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_66;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_67;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_68;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_69;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_70;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_71;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_72;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_73;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_74;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_75;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_76;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_77;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_78;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_79;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_80;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_81;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_82;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_83;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_84;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_85;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_86;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_87;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_88;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_89;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_90;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_91;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_92;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_93;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_94;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_95;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_96;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_97;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_98;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_99;
+
+typedef std::tuple<AgradDistributionParetoType2, type_v_0> AgradDistributionParetoType2_v_0;
+typedef std::tuple<AgradDistributionParetoType2, type_v_1> AgradDistributionParetoType2_v_1;
+typedef std::tuple<AgradDistributionParetoType2, type_v_2> AgradDistributionParetoType2_v_2;
+typedef std::tuple<AgradDistributionParetoType2, type_v_3> AgradDistributionParetoType2_v_3;
+typedef std::tuple<AgradDistributionParetoType2, type_v_4> AgradDistributionParetoType2_v_4;
+typedef std::tuple<AgradDistributionParetoType2, type_v_5> AgradDistributionParetoType2_v_5;
+typedef std::tuple<AgradDistributionParetoType2, type_v_6> AgradDistributionParetoType2_v_6;
+typedef std::tuple<AgradDistributionParetoType2, type_v_7> AgradDistributionParetoType2_v_7;
+typedef std::tuple<AgradDistributionParetoType2, type_v_8> AgradDistributionParetoType2_v_8;
+typedef std::tuple<AgradDistributionParetoType2, type_v_9> AgradDistributionParetoType2_v_9;
+typedef std::tuple<AgradDistributionParetoType2, type_v_10> AgradDistributionParetoType2_v_10;
+typedef std::tuple<AgradDistributionParetoType2, type_v_11> AgradDistributionParetoType2_v_11;
+typedef std::tuple<AgradDistributionParetoType2, type_v_12> AgradDistributionParetoType2_v_12;
+typedef std::tuple<AgradDistributionParetoType2, type_v_13> AgradDistributionParetoType2_v_13;
+typedef std::tuple<AgradDistributionParetoType2, type_v_14> AgradDistributionParetoType2_v_14;
+typedef std::tuple<AgradDistributionParetoType2, type_v_15> AgradDistributionParetoType2_v_15;
+typedef std::tuple<AgradDistributionParetoType2, type_v_16> AgradDistributionParetoType2_v_16;
+typedef std::tuple<AgradDistributionParetoType2, type_v_17> AgradDistributionParetoType2_v_17;
+typedef std::tuple<AgradDistributionParetoType2, type_v_18> AgradDistributionParetoType2_v_18;
+typedef std::tuple<AgradDistributionParetoType2, type_v_19> AgradDistributionParetoType2_v_19;
+typedef std::tuple<AgradDistributionParetoType2, type_v_20> AgradDistributionParetoType2_v_20;
+typedef std::tuple<AgradDistributionParetoType2, type_v_21> AgradDistributionParetoType2_v_21;
+typedef std::tuple<AgradDistributionParetoType2, type_v_22> AgradDistributionParetoType2_v_22;
+typedef std::tuple<AgradDistributionParetoType2, type_v_23> AgradDistributionParetoType2_v_23;
+typedef std::tuple<AgradDistributionParetoType2, type_v_24> AgradDistributionParetoType2_v_24;
+typedef std::tuple<AgradDistributionParetoType2, type_v_25> AgradDistributionParetoType2_v_25;
+typedef std::tuple<AgradDistributionParetoType2, type_v_26> AgradDistributionParetoType2_v_26;
+typedef std::tuple<AgradDistributionParetoType2, type_v_27> AgradDistributionParetoType2_v_27;
+typedef std::tuple<AgradDistributionParetoType2, type_v_28> AgradDistributionParetoType2_v_28;
+typedef std::tuple<AgradDistributionParetoType2, type_v_29> AgradDistributionParetoType2_v_29;
+typedef std::tuple<AgradDistributionParetoType2, type_v_30> AgradDistributionParetoType2_v_30;
+typedef std::tuple<AgradDistributionParetoType2, type_v_31> AgradDistributionParetoType2_v_31;
+typedef std::tuple<AgradDistributionParetoType2, type_v_32> AgradDistributionParetoType2_v_32;
+typedef std::tuple<AgradDistributionParetoType2, type_v_33> AgradDistributionParetoType2_v_33;
+typedef std::tuple<AgradDistributionParetoType2, type_v_34> AgradDistributionParetoType2_v_34;
+typedef std::tuple<AgradDistributionParetoType2, type_v_35> AgradDistributionParetoType2_v_35;
+typedef std::tuple<AgradDistributionParetoType2, type_v_36> AgradDistributionParetoType2_v_36;
+typedef std::tuple<AgradDistributionParetoType2, type_v_37> AgradDistributionParetoType2_v_37;
+typedef std::tuple<AgradDistributionParetoType2, type_v_38> AgradDistributionParetoType2_v_38;
+typedef std::tuple<AgradDistributionParetoType2, type_v_39> AgradDistributionParetoType2_v_39;
+typedef std::tuple<AgradDistributionParetoType2, type_v_40> AgradDistributionParetoType2_v_40;
+typedef std::tuple<AgradDistributionParetoType2, type_v_41> AgradDistributionParetoType2_v_41;
+typedef std::tuple<AgradDistributionParetoType2, type_v_42> AgradDistributionParetoType2_v_42;
+typedef std::tuple<AgradDistributionParetoType2, type_v_43> AgradDistributionParetoType2_v_43;
+typedef std::tuple<AgradDistributionParetoType2, type_v_44> AgradDistributionParetoType2_v_44;
+typedef std::tuple<AgradDistributionParetoType2, type_v_45> AgradDistributionParetoType2_v_45;
+typedef std::tuple<AgradDistributionParetoType2, type_v_46> AgradDistributionParetoType2_v_46;
+typedef std::tuple<AgradDistributionParetoType2, type_v_47> AgradDistributionParetoType2_v_47;
+typedef std::tuple<AgradDistributionParetoType2, type_v_48> AgradDistributionParetoType2_v_48;
+typedef std::tuple<AgradDistributionParetoType2, type_v_49> AgradDistributionParetoType2_v_49;
+typedef std::tuple<AgradDistributionParetoType2, type_v_50> AgradDistributionParetoType2_v_50;
+typedef std::tuple<AgradDistributionParetoType2, type_v_51> AgradDistributionParetoType2_v_51;
+typedef std::tuple<AgradDistributionParetoType2, type_v_52> AgradDistributionParetoType2_v_52;
+typedef std::tuple<AgradDistributionParetoType2, type_v_53> AgradDistributionParetoType2_v_53;
+typedef std::tuple<AgradDistributionParetoType2, type_v_54> AgradDistributionParetoType2_v_54;
+typedef std::tuple<AgradDistributionParetoType2, type_v_55> AgradDistributionParetoType2_v_55;
+typedef std::tuple<AgradDistributionParetoType2, type_v_56> AgradDistributionParetoType2_v_56;
+typedef std::tuple<AgradDistributionParetoType2, type_v_57> AgradDistributionParetoType2_v_57;
+typedef std::tuple<AgradDistributionParetoType2, type_v_58> AgradDistributionParetoType2_v_58;
+typedef std::tuple<AgradDistributionParetoType2, type_v_59> AgradDistributionParetoType2_v_59;
+typedef std::tuple<AgradDistributionParetoType2, type_v_60> AgradDistributionParetoType2_v_60;
+typedef std::tuple<AgradDistributionParetoType2, type_v_61> AgradDistributionParetoType2_v_61;
+typedef std::tuple<AgradDistributionParetoType2, type_v_62> AgradDistributionParetoType2_v_62;
+typedef std::tuple<AgradDistributionParetoType2, type_v_63> AgradDistributionParetoType2_v_63;
+typedef std::tuple<AgradDistributionParetoType2, type_v_64> AgradDistributionParetoType2_v_64;
+typedef std::tuple<AgradDistributionParetoType2, type_v_65> AgradDistributionParetoType2_v_65;
+typedef std::tuple<AgradDistributionParetoType2, type_v_66> AgradDistributionParetoType2_v_66;
+typedef std::tuple<AgradDistributionParetoType2, type_v_67> AgradDistributionParetoType2_v_67;
+typedef std::tuple<AgradDistributionParetoType2, type_v_68> AgradDistributionParetoType2_v_68;
+typedef std::tuple<AgradDistributionParetoType2, type_v_69> AgradDistributionParetoType2_v_69;
+typedef std::tuple<AgradDistributionParetoType2, type_v_70> AgradDistributionParetoType2_v_70;
+typedef std::tuple<AgradDistributionParetoType2, type_v_71> AgradDistributionParetoType2_v_71;
+typedef std::tuple<AgradDistributionParetoType2, type_v_72> AgradDistributionParetoType2_v_72;
+typedef std::tuple<AgradDistributionParetoType2, type_v_73> AgradDistributionParetoType2_v_73;
+typedef std::tuple<AgradDistributionParetoType2, type_v_74> AgradDistributionParetoType2_v_74;
+typedef std::tuple<AgradDistributionParetoType2, type_v_75> AgradDistributionParetoType2_v_75;
+typedef std::tuple<AgradDistributionParetoType2, type_v_76> AgradDistributionParetoType2_v_76;
+typedef std::tuple<AgradDistributionParetoType2, type_v_77> AgradDistributionParetoType2_v_77;
+typedef std::tuple<AgradDistributionParetoType2, type_v_78> AgradDistributionParetoType2_v_78;
+typedef std::tuple<AgradDistributionParetoType2, type_v_79> AgradDistributionParetoType2_v_79;
+typedef std::tuple<AgradDistributionParetoType2, type_v_80> AgradDistributionParetoType2_v_80;
+typedef std::tuple<AgradDistributionParetoType2, type_v_81> AgradDistributionParetoType2_v_81;
+typedef std::tuple<AgradDistributionParetoType2, type_v_82> AgradDistributionParetoType2_v_82;
+typedef std::tuple<AgradDistributionParetoType2, type_v_83> AgradDistributionParetoType2_v_83;
+typedef std::tuple<AgradDistributionParetoType2, type_v_84> AgradDistributionParetoType2_v_84;
+typedef std::tuple<AgradDistributionParetoType2, type_v_85> AgradDistributionParetoType2_v_85;
+typedef std::tuple<AgradDistributionParetoType2, type_v_86> AgradDistributionParetoType2_v_86;
+typedef std::tuple<AgradDistributionParetoType2, type_v_87> AgradDistributionParetoType2_v_87;
+typedef std::tuple<AgradDistributionParetoType2, type_v_88> AgradDistributionParetoType2_v_88;
+typedef std::tuple<AgradDistributionParetoType2, type_v_89> AgradDistributionParetoType2_v_89;
+typedef std::tuple<AgradDistributionParetoType2, type_v_90> AgradDistributionParetoType2_v_90;
+typedef std::tuple<AgradDistributionParetoType2, type_v_91> AgradDistributionParetoType2_v_91;
+typedef std::tuple<AgradDistributionParetoType2, type_v_92> AgradDistributionParetoType2_v_92;
+typedef std::tuple<AgradDistributionParetoType2, type_v_93> AgradDistributionParetoType2_v_93;
+typedef std::tuple<AgradDistributionParetoType2, type_v_94> AgradDistributionParetoType2_v_94;
+typedef std::tuple<AgradDistributionParetoType2, type_v_95> AgradDistributionParetoType2_v_95;
+typedef std::tuple<AgradDistributionParetoType2, type_v_96> AgradDistributionParetoType2_v_96;
+typedef std::tuple<AgradDistributionParetoType2, type_v_97> AgradDistributionParetoType2_v_97;
+typedef std::tuple<AgradDistributionParetoType2, type_v_98> AgradDistributionParetoType2_v_98;
+typedef std::tuple<AgradDistributionParetoType2, type_v_99> AgradDistributionParetoType2_v_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_0, AgradDistributionTestFixture, AgradDistributionParetoType2_v_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_1, AgradDistributionTestFixture, AgradDistributionParetoType2_v_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_2, AgradDistributionTestFixture, AgradDistributionParetoType2_v_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_3, AgradDistributionTestFixture, AgradDistributionParetoType2_v_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_4, AgradDistributionTestFixture, AgradDistributionParetoType2_v_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_5, AgradDistributionTestFixture, AgradDistributionParetoType2_v_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_6, AgradDistributionTestFixture, AgradDistributionParetoType2_v_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_7, AgradDistributionTestFixture, AgradDistributionParetoType2_v_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_8, AgradDistributionTestFixture, AgradDistributionParetoType2_v_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_9, AgradDistributionTestFixture, AgradDistributionParetoType2_v_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_10, AgradDistributionTestFixture, AgradDistributionParetoType2_v_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_11, AgradDistributionTestFixture, AgradDistributionParetoType2_v_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_12, AgradDistributionTestFixture, AgradDistributionParetoType2_v_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_13, AgradDistributionTestFixture, AgradDistributionParetoType2_v_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_14, AgradDistributionTestFixture, AgradDistributionParetoType2_v_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_15, AgradDistributionTestFixture, AgradDistributionParetoType2_v_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_16, AgradDistributionTestFixture, AgradDistributionParetoType2_v_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_17, AgradDistributionTestFixture, AgradDistributionParetoType2_v_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_18, AgradDistributionTestFixture, AgradDistributionParetoType2_v_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_19, AgradDistributionTestFixture, AgradDistributionParetoType2_v_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_20, AgradDistributionTestFixture, AgradDistributionParetoType2_v_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_21, AgradDistributionTestFixture, AgradDistributionParetoType2_v_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_22, AgradDistributionTestFixture, AgradDistributionParetoType2_v_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_23, AgradDistributionTestFixture, AgradDistributionParetoType2_v_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_24, AgradDistributionTestFixture, AgradDistributionParetoType2_v_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_25, AgradDistributionTestFixture, AgradDistributionParetoType2_v_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_26, AgradDistributionTestFixture, AgradDistributionParetoType2_v_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_27, AgradDistributionTestFixture, AgradDistributionParetoType2_v_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_28, AgradDistributionTestFixture, AgradDistributionParetoType2_v_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_29, AgradDistributionTestFixture, AgradDistributionParetoType2_v_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_30, AgradDistributionTestFixture, AgradDistributionParetoType2_v_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_31, AgradDistributionTestFixture, AgradDistributionParetoType2_v_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_32, AgradDistributionTestFixture, AgradDistributionParetoType2_v_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_33, AgradDistributionTestFixture, AgradDistributionParetoType2_v_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_34, AgradDistributionTestFixture, AgradDistributionParetoType2_v_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_35, AgradDistributionTestFixture, AgradDistributionParetoType2_v_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_36, AgradDistributionTestFixture, AgradDistributionParetoType2_v_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_37, AgradDistributionTestFixture, AgradDistributionParetoType2_v_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_38, AgradDistributionTestFixture, AgradDistributionParetoType2_v_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_39, AgradDistributionTestFixture, AgradDistributionParetoType2_v_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_40, AgradDistributionTestFixture, AgradDistributionParetoType2_v_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_41, AgradDistributionTestFixture, AgradDistributionParetoType2_v_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_42, AgradDistributionTestFixture, AgradDistributionParetoType2_v_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_43, AgradDistributionTestFixture, AgradDistributionParetoType2_v_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_44, AgradDistributionTestFixture, AgradDistributionParetoType2_v_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_45, AgradDistributionTestFixture, AgradDistributionParetoType2_v_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_46, AgradDistributionTestFixture, AgradDistributionParetoType2_v_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_47, AgradDistributionTestFixture, AgradDistributionParetoType2_v_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_48, AgradDistributionTestFixture, AgradDistributionParetoType2_v_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_49, AgradDistributionTestFixture, AgradDistributionParetoType2_v_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_50, AgradDistributionTestFixture, AgradDistributionParetoType2_v_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_51, AgradDistributionTestFixture, AgradDistributionParetoType2_v_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_52, AgradDistributionTestFixture, AgradDistributionParetoType2_v_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_53, AgradDistributionTestFixture, AgradDistributionParetoType2_v_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_54, AgradDistributionTestFixture, AgradDistributionParetoType2_v_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_55, AgradDistributionTestFixture, AgradDistributionParetoType2_v_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_56, AgradDistributionTestFixture, AgradDistributionParetoType2_v_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_57, AgradDistributionTestFixture, AgradDistributionParetoType2_v_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_58, AgradDistributionTestFixture, AgradDistributionParetoType2_v_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_59, AgradDistributionTestFixture, AgradDistributionParetoType2_v_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_60, AgradDistributionTestFixture, AgradDistributionParetoType2_v_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_61, AgradDistributionTestFixture, AgradDistributionParetoType2_v_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_62, AgradDistributionTestFixture, AgradDistributionParetoType2_v_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_63, AgradDistributionTestFixture, AgradDistributionParetoType2_v_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_64, AgradDistributionTestFixture, AgradDistributionParetoType2_v_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_65, AgradDistributionTestFixture, AgradDistributionParetoType2_v_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_66, AgradDistributionTestFixture, AgradDistributionParetoType2_v_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_67, AgradDistributionTestFixture, AgradDistributionParetoType2_v_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_68, AgradDistributionTestFixture, AgradDistributionParetoType2_v_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_69, AgradDistributionTestFixture, AgradDistributionParetoType2_v_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_70, AgradDistributionTestFixture, AgradDistributionParetoType2_v_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_71, AgradDistributionTestFixture, AgradDistributionParetoType2_v_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_72, AgradDistributionTestFixture, AgradDistributionParetoType2_v_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_73, AgradDistributionTestFixture, AgradDistributionParetoType2_v_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_74, AgradDistributionTestFixture, AgradDistributionParetoType2_v_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_75, AgradDistributionTestFixture, AgradDistributionParetoType2_v_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_76, AgradDistributionTestFixture, AgradDistributionParetoType2_v_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_77, AgradDistributionTestFixture, AgradDistributionParetoType2_v_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_78, AgradDistributionTestFixture, AgradDistributionParetoType2_v_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_79, AgradDistributionTestFixture, AgradDistributionParetoType2_v_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_80, AgradDistributionTestFixture, AgradDistributionParetoType2_v_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_81, AgradDistributionTestFixture, AgradDistributionParetoType2_v_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_82, AgradDistributionTestFixture, AgradDistributionParetoType2_v_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_83, AgradDistributionTestFixture, AgradDistributionParetoType2_v_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_84, AgradDistributionTestFixture, AgradDistributionParetoType2_v_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_85, AgradDistributionTestFixture, AgradDistributionParetoType2_v_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_86, AgradDistributionTestFixture, AgradDistributionParetoType2_v_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_87, AgradDistributionTestFixture, AgradDistributionParetoType2_v_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_88, AgradDistributionTestFixture, AgradDistributionParetoType2_v_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_89, AgradDistributionTestFixture, AgradDistributionParetoType2_v_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_90, AgradDistributionTestFixture, AgradDistributionParetoType2_v_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_91, AgradDistributionTestFixture, AgradDistributionParetoType2_v_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_92, AgradDistributionTestFixture, AgradDistributionParetoType2_v_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_93, AgradDistributionTestFixture, AgradDistributionParetoType2_v_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_94, AgradDistributionTestFixture, AgradDistributionParetoType2_v_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_95, AgradDistributionTestFixture, AgradDistributionParetoType2_v_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_96, AgradDistributionTestFixture, AgradDistributionParetoType2_v_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_97, AgradDistributionTestFixture, AgradDistributionParetoType2_v_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_98, AgradDistributionTestFixture, AgradDistributionParetoType2_v_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_99, AgradDistributionTestFixture, AgradDistributionParetoType2_v_99);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_test.hpp>
+
+typedef std::tuple<double, double, double, var, empty, empty> type_vv_0;
+typedef std::tuple<double, double, double, std::vector<var>, empty, empty> type_vv_1;
+typedef std::tuple<double, double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_2;
+typedef std::tuple<double, double, std::vector<double>, var, empty, empty> type_vv_3;
+typedef std::tuple<double, double, std::vector<double>, std::vector<var>, empty, empty> type_vv_4;
+typedef std::tuple<double, double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_5;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_6;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_7;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_8;
+typedef std::tuple<double, double, var, double, empty, empty> type_vv_9;
+typedef std::tuple<double, double, var, std::vector<double>, empty, empty> type_vv_10;
+typedef std::tuple<double, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_11;
+typedef std::tuple<double, double, var, var, empty, empty> type_vv_12;
+typedef std::tuple<double, double, var, std::vector<var>, empty, empty> type_vv_13;
+typedef std::tuple<double, double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_14;
+typedef std::tuple<double, double, std::vector<var>, double, empty, empty> type_vv_15;
+typedef std::tuple<double, double, std::vector<var>, std::vector<double>, empty, empty> type_vv_16;
+typedef std::tuple<double, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_17;
+typedef std::tuple<double, double, std::vector<var>, var, empty, empty> type_vv_18;
+typedef std::tuple<double, double, std::vector<var>, std::vector<var>, empty, empty> type_vv_19;
+typedef std::tuple<double, double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_20;
+typedef std::tuple<double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_21;
+typedef std::tuple<double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_22;
+typedef std::tuple<double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_23;
+typedef std::tuple<double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_24;
+typedef std::tuple<double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_25;
+typedef std::tuple<double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_26;
+typedef std::tuple<double, std::vector<double>, double, var, empty, empty> type_vv_27;
+typedef std::tuple<double, std::vector<double>, double, std::vector<var>, empty, empty> type_vv_28;
+typedef std::tuple<double, std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_29;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, var, empty, empty> type_vv_30;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_vv_31;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_32;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_33;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_34;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_35;
+typedef std::tuple<double, std::vector<double>, var, double, empty, empty> type_vv_36;
+typedef std::tuple<double, std::vector<double>, var, std::vector<double>, empty, empty> type_vv_37;
+typedef std::tuple<double, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_38;
+typedef std::tuple<double, std::vector<double>, var, var, empty, empty> type_vv_39;
+typedef std::tuple<double, std::vector<double>, var, std::vector<var>, empty, empty> type_vv_40;
+typedef std::tuple<double, std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_41;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, double, empty, empty> type_vv_42;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_vv_43;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_44;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, var, empty, empty> type_vv_45;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_vv_46;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_47;
+typedef std::tuple<double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_48;
+typedef std::tuple<double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_49;
+typedef std::tuple<double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_50;
+typedef std::tuple<double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_51;
+typedef std::tuple<double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_52;
+typedef std::tuple<double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_53;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_vv_54;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_vv_55;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_56;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_vv_57;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_vv_58;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_59;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_60;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_61;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_62;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_vv_63;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_vv_64;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_65;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_vv_66;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_vv_67;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_68;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_vv_69;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_vv_70;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_71;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_vv_72;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_vv_73;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_74;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_75;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_76;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_77;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_78;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_79;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_80;
+typedef std::tuple<double, var, double, double, empty, empty> type_vv_81;
+typedef std::tuple<double, var, double, std::vector<double>, empty, empty> type_vv_82;
+typedef std::tuple<double, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_83;
+typedef std::tuple<double, var, double, var, empty, empty> type_vv_84;
+typedef std::tuple<double, var, double, std::vector<var>, empty, empty> type_vv_85;
+typedef std::tuple<double, var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_86;
+typedef std::tuple<double, var, std::vector<double>, double, empty, empty> type_vv_87;
+typedef std::tuple<double, var, std::vector<double>, std::vector<double>, empty, empty> type_vv_88;
+typedef std::tuple<double, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_89;
+typedef std::tuple<double, var, std::vector<double>, var, empty, empty> type_vv_90;
+typedef std::tuple<double, var, std::vector<double>, std::vector<var>, empty, empty> type_vv_91;
+typedef std::tuple<double, var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_92;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_93;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_94;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_95;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_96;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_97;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_98;
+typedef std::tuple<double, var, var, double, empty, empty> type_vv_99;
+
+typedef std::tuple<AgradDistributionParetoType2, type_vv_0> AgradDistributionParetoType2_vv_0;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_1> AgradDistributionParetoType2_vv_1;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_2> AgradDistributionParetoType2_vv_2;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_3> AgradDistributionParetoType2_vv_3;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_4> AgradDistributionParetoType2_vv_4;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_5> AgradDistributionParetoType2_vv_5;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_6> AgradDistributionParetoType2_vv_6;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_7> AgradDistributionParetoType2_vv_7;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_8> AgradDistributionParetoType2_vv_8;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_9> AgradDistributionParetoType2_vv_9;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_10> AgradDistributionParetoType2_vv_10;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_11> AgradDistributionParetoType2_vv_11;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_12> AgradDistributionParetoType2_vv_12;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_13> AgradDistributionParetoType2_vv_13;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_14> AgradDistributionParetoType2_vv_14;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_15> AgradDistributionParetoType2_vv_15;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_16> AgradDistributionParetoType2_vv_16;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_17> AgradDistributionParetoType2_vv_17;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_18> AgradDistributionParetoType2_vv_18;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_19> AgradDistributionParetoType2_vv_19;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_20> AgradDistributionParetoType2_vv_20;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_21> AgradDistributionParetoType2_vv_21;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_22> AgradDistributionParetoType2_vv_22;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_23> AgradDistributionParetoType2_vv_23;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_24> AgradDistributionParetoType2_vv_24;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_25> AgradDistributionParetoType2_vv_25;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_26> AgradDistributionParetoType2_vv_26;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_27> AgradDistributionParetoType2_vv_27;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_28> AgradDistributionParetoType2_vv_28;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_29> AgradDistributionParetoType2_vv_29;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_30> AgradDistributionParetoType2_vv_30;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_31> AgradDistributionParetoType2_vv_31;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_32> AgradDistributionParetoType2_vv_32;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_33> AgradDistributionParetoType2_vv_33;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_34> AgradDistributionParetoType2_vv_34;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_35> AgradDistributionParetoType2_vv_35;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_36> AgradDistributionParetoType2_vv_36;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_37> AgradDistributionParetoType2_vv_37;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_38> AgradDistributionParetoType2_vv_38;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_39> AgradDistributionParetoType2_vv_39;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_40> AgradDistributionParetoType2_vv_40;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_41> AgradDistributionParetoType2_vv_41;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_42> AgradDistributionParetoType2_vv_42;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_43> AgradDistributionParetoType2_vv_43;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_44> AgradDistributionParetoType2_vv_44;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_45> AgradDistributionParetoType2_vv_45;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_46> AgradDistributionParetoType2_vv_46;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_47> AgradDistributionParetoType2_vv_47;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_48> AgradDistributionParetoType2_vv_48;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_49> AgradDistributionParetoType2_vv_49;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_50> AgradDistributionParetoType2_vv_50;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_51> AgradDistributionParetoType2_vv_51;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_52> AgradDistributionParetoType2_vv_52;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_53> AgradDistributionParetoType2_vv_53;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_54> AgradDistributionParetoType2_vv_54;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_55> AgradDistributionParetoType2_vv_55;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_56> AgradDistributionParetoType2_vv_56;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_57> AgradDistributionParetoType2_vv_57;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_58> AgradDistributionParetoType2_vv_58;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_59> AgradDistributionParetoType2_vv_59;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_60> AgradDistributionParetoType2_vv_60;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_61> AgradDistributionParetoType2_vv_61;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_62> AgradDistributionParetoType2_vv_62;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_63> AgradDistributionParetoType2_vv_63;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_64> AgradDistributionParetoType2_vv_64;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_65> AgradDistributionParetoType2_vv_65;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_66> AgradDistributionParetoType2_vv_66;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_67> AgradDistributionParetoType2_vv_67;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_68> AgradDistributionParetoType2_vv_68;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_69> AgradDistributionParetoType2_vv_69;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_70> AgradDistributionParetoType2_vv_70;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_71> AgradDistributionParetoType2_vv_71;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_72> AgradDistributionParetoType2_vv_72;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_73> AgradDistributionParetoType2_vv_73;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_74> AgradDistributionParetoType2_vv_74;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_75> AgradDistributionParetoType2_vv_75;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_76> AgradDistributionParetoType2_vv_76;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_77> AgradDistributionParetoType2_vv_77;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_78> AgradDistributionParetoType2_vv_78;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_79> AgradDistributionParetoType2_vv_79;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_80> AgradDistributionParetoType2_vv_80;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_81> AgradDistributionParetoType2_vv_81;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_82> AgradDistributionParetoType2_vv_82;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_83> AgradDistributionParetoType2_vv_83;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_84> AgradDistributionParetoType2_vv_84;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_85> AgradDistributionParetoType2_vv_85;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_86> AgradDistributionParetoType2_vv_86;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_87> AgradDistributionParetoType2_vv_87;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_88> AgradDistributionParetoType2_vv_88;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_89> AgradDistributionParetoType2_vv_89;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_90> AgradDistributionParetoType2_vv_90;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_91> AgradDistributionParetoType2_vv_91;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_92> AgradDistributionParetoType2_vv_92;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_93> AgradDistributionParetoType2_vv_93;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_94> AgradDistributionParetoType2_vv_94;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_95> AgradDistributionParetoType2_vv_95;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_96> AgradDistributionParetoType2_vv_96;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_97> AgradDistributionParetoType2_vv_97;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_98> AgradDistributionParetoType2_vv_98;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_99> AgradDistributionParetoType2_vv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_0, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_1, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_2, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_3, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_4, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_5, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_6, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_7, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_8, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_9, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_10, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_11, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_12, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_13, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_14, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_15, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_16, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_17, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_18, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_19, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_20, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_21, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_22, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_23, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_24, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_25, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_26, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_27, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_28, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_29, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_30, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_31, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_32, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_33, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_34, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_35, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_36, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_37, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_38, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_39, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_40, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_41, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_42, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_43, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_44, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_45, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_46, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_47, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_48, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_49, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_50, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_51, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_52, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_53, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_54, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_55, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_56, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_57, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_58, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_59, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_60, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_61, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_62, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_63, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_64, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_65, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_66, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_67, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_68, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_69, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_70, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_71, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_72, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_73, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_74, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_75, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_76, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_77, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_78, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_79, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_80, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_81, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_82, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_83, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_84, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_85, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_86, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_87, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_88, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_89, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_90, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_91, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_92, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_93, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_94, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_95, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_96, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_97, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_98, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_99, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_99);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_test.hpp>
+
+typedef std::tuple<double, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_100;
+typedef std::tuple<double, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_101;
+typedef std::tuple<double, fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_102;
+typedef std::tuple<double, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_103;
+typedef std::tuple<double, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_104;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_105;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_106;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_107;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_108;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_109;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_110;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_111;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_112;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_113;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_114;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_115;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_116;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, double, double, empty, empty> type_ffv_117;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty, empty> type_ffv_118;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_119;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty, empty> type_ffv_120;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_121;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_122;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty, empty> type_ffv_123;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_124;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_125;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_126;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_127;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_128;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_129;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_130;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_131;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_132;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_133;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_134;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty, empty> type_ffv_135;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_136;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_137;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_138;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_139;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_140;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_141;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_142;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_143;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_144;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_145;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_146;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_147;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_148;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_149;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_150;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_151;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_152;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty, empty> type_ffv_153;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_ffv_154;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_155;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_156;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_157;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_158;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_ffv_159;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_160;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_161;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_162;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_163;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_164;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_165;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_166;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_167;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_168;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_169;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_170;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_171;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_172;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_173;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_174;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_175;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_176;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_177;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_178;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_179;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_180;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_181;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_182;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_183;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_184;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_185;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_186;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_187;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_188;
+typedef std::tuple<std::vector<double>, double, double, fvar<fvar<var> >, empty, empty> type_ffv_189;
+typedef std::tuple<std::vector<double>, double, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_190;
+typedef std::tuple<std::vector<double>, double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_191;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_192;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_193;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_194;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_195;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_196;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_197;
+typedef std::tuple<std::vector<double>, double, fvar<fvar<var> >, double, empty, empty> type_ffv_198;
+typedef std::tuple<std::vector<double>, double, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_199;
+
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_100> AgradDistributionParetoType2_ffv_100;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_101> AgradDistributionParetoType2_ffv_101;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_102> AgradDistributionParetoType2_ffv_102;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_103> AgradDistributionParetoType2_ffv_103;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_104> AgradDistributionParetoType2_ffv_104;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_105> AgradDistributionParetoType2_ffv_105;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_106> AgradDistributionParetoType2_ffv_106;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_107> AgradDistributionParetoType2_ffv_107;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_108> AgradDistributionParetoType2_ffv_108;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_109> AgradDistributionParetoType2_ffv_109;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_110> AgradDistributionParetoType2_ffv_110;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_111> AgradDistributionParetoType2_ffv_111;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_112> AgradDistributionParetoType2_ffv_112;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_113> AgradDistributionParetoType2_ffv_113;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_114> AgradDistributionParetoType2_ffv_114;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_115> AgradDistributionParetoType2_ffv_115;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_116> AgradDistributionParetoType2_ffv_116;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_117> AgradDistributionParetoType2_ffv_117;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_118> AgradDistributionParetoType2_ffv_118;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_119> AgradDistributionParetoType2_ffv_119;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_120> AgradDistributionParetoType2_ffv_120;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_121> AgradDistributionParetoType2_ffv_121;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_122> AgradDistributionParetoType2_ffv_122;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_123> AgradDistributionParetoType2_ffv_123;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_124> AgradDistributionParetoType2_ffv_124;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_125> AgradDistributionParetoType2_ffv_125;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_126> AgradDistributionParetoType2_ffv_126;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_127> AgradDistributionParetoType2_ffv_127;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_128> AgradDistributionParetoType2_ffv_128;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_129> AgradDistributionParetoType2_ffv_129;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_130> AgradDistributionParetoType2_ffv_130;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_131> AgradDistributionParetoType2_ffv_131;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_132> AgradDistributionParetoType2_ffv_132;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_133> AgradDistributionParetoType2_ffv_133;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_134> AgradDistributionParetoType2_ffv_134;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_135> AgradDistributionParetoType2_ffv_135;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_136> AgradDistributionParetoType2_ffv_136;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_137> AgradDistributionParetoType2_ffv_137;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_138> AgradDistributionParetoType2_ffv_138;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_139> AgradDistributionParetoType2_ffv_139;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_140> AgradDistributionParetoType2_ffv_140;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_141> AgradDistributionParetoType2_ffv_141;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_142> AgradDistributionParetoType2_ffv_142;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_143> AgradDistributionParetoType2_ffv_143;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_144> AgradDistributionParetoType2_ffv_144;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_145> AgradDistributionParetoType2_ffv_145;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_146> AgradDistributionParetoType2_ffv_146;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_147> AgradDistributionParetoType2_ffv_147;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_148> AgradDistributionParetoType2_ffv_148;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_149> AgradDistributionParetoType2_ffv_149;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_150> AgradDistributionParetoType2_ffv_150;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_151> AgradDistributionParetoType2_ffv_151;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_152> AgradDistributionParetoType2_ffv_152;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_153> AgradDistributionParetoType2_ffv_153;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_154> AgradDistributionParetoType2_ffv_154;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_155> AgradDistributionParetoType2_ffv_155;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_156> AgradDistributionParetoType2_ffv_156;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_157> AgradDistributionParetoType2_ffv_157;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_158> AgradDistributionParetoType2_ffv_158;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_159> AgradDistributionParetoType2_ffv_159;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_160> AgradDistributionParetoType2_ffv_160;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_161> AgradDistributionParetoType2_ffv_161;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_162> AgradDistributionParetoType2_ffv_162;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_163> AgradDistributionParetoType2_ffv_163;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_164> AgradDistributionParetoType2_ffv_164;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_165> AgradDistributionParetoType2_ffv_165;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_166> AgradDistributionParetoType2_ffv_166;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_167> AgradDistributionParetoType2_ffv_167;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_168> AgradDistributionParetoType2_ffv_168;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_169> AgradDistributionParetoType2_ffv_169;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_170> AgradDistributionParetoType2_ffv_170;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_171> AgradDistributionParetoType2_ffv_171;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_172> AgradDistributionParetoType2_ffv_172;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_173> AgradDistributionParetoType2_ffv_173;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_174> AgradDistributionParetoType2_ffv_174;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_175> AgradDistributionParetoType2_ffv_175;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_176> AgradDistributionParetoType2_ffv_176;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_177> AgradDistributionParetoType2_ffv_177;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_178> AgradDistributionParetoType2_ffv_178;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_179> AgradDistributionParetoType2_ffv_179;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_180> AgradDistributionParetoType2_ffv_180;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_181> AgradDistributionParetoType2_ffv_181;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_182> AgradDistributionParetoType2_ffv_182;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_183> AgradDistributionParetoType2_ffv_183;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_184> AgradDistributionParetoType2_ffv_184;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_185> AgradDistributionParetoType2_ffv_185;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_186> AgradDistributionParetoType2_ffv_186;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_187> AgradDistributionParetoType2_ffv_187;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_188> AgradDistributionParetoType2_ffv_188;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_189> AgradDistributionParetoType2_ffv_189;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_190> AgradDistributionParetoType2_ffv_190;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_191> AgradDistributionParetoType2_ffv_191;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_192> AgradDistributionParetoType2_ffv_192;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_193> AgradDistributionParetoType2_ffv_193;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_194> AgradDistributionParetoType2_ffv_194;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_195> AgradDistributionParetoType2_ffv_195;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_196> AgradDistributionParetoType2_ffv_196;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_197> AgradDistributionParetoType2_ffv_197;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_198> AgradDistributionParetoType2_ffv_198;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_199> AgradDistributionParetoType2_ffv_199;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_100, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_101, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_102, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_103, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_104, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_105, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_106, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_107, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_108, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_109, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_110, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_111, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_112, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_113, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_114, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_115, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_116, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_117, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_118, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_119, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_120, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_121, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_122, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_123, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_124, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_125, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_126, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_127, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_128, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_129, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_130, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_131, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_132, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_133, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_134, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_135, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_136, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_137, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_138, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_139, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_140, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_141, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_142, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_143, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_144, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_145, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_146, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_147, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_148, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_149, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_150, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_151, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_152, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_153, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_154, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_155, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_156, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_157, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_158, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_159, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_160, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_161, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_162, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_163, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_164, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_165, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_166, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_167, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_168, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_169, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_170, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_171, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_172, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_173, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_174, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_175, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_176, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_177, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_178, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_179, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_180, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_181, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_182, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_183, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_184, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_185, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_186, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_187, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_188, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_188);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_189, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_189);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_190, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_190);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_191, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_191);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_192, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_192);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_193, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_193);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_194, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_194);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_195, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_195);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_196, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_196);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_197, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_197);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_198, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_198);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_199, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_199);
+
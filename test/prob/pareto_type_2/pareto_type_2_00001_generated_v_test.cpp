@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_test.hpp>
+
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_100;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_101;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_102;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_103;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_104;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_105;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_106;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_107;
+typedef std::tuple<double, var, double, double, empty, empty> type_v_108;
+typedef std::tuple<double, var, double, std::vector<double>, empty, empty> type_v_109;
+typedef std::tuple<double, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_110;
+typedef std::tuple<double, var, double, var, empty, empty> type_v_111;
+typedef std::tuple<double, var, double, std::vector<var>, empty, empty> type_v_112;
+typedef std::tuple<double, var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_113;
+typedef std::tuple<double, var, std::vector<double>, double, empty, empty> type_v_114;
+typedef std::tuple<double, var, std::vector<double>, std::vector<double>, empty, empty> type_v_115;
+typedef std::tuple<double, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_116;
+typedef std::tuple<double, var, std::vector<double>, var, empty, empty> type_v_117;
+typedef std::tuple<double, var, std::vector<double>, std::vector<var>, empty, empty> type_v_118;
+typedef std::tuple<double, var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_119;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_120;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_121;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_122;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_123;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_124;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_125;
+typedef std::tuple<double, var, var, double, empty, empty> type_v_126;
+typedef std::tuple<double, var, var, std::vector<double>, empty, empty> type_v_127;
+typedef std::tuple<double, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_128;
+typedef std::tuple<double, var, var, var, empty, empty> type_v_129;
+typedef std::tuple<double, var, var, std::vector<var>, empty, empty> type_v_130;
+typedef std::tuple<double, var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_131;
+typedef std::tuple<double, var, std::vector<var>, double, empty, empty> type_v_132;
+typedef std::tuple<double, var, std::vector<var>, std::vector<double>, empty, empty> type_v_133;
+typedef std::tuple<double, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_134;
+typedef std::tuple<double, var, std::vector<var>, var, empty, empty> type_v_135;
+typedef std::tuple<double, var, std::vector<var>, std::vector<var>, empty, empty> type_v_136;
+typedef std::tuple<double, var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_137;
+typedef std::tuple<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_138;
+typedef std::tuple<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_139;
+typedef std::tuple<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_140;
+typedef std::tuple<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_141;
+typedef std::tuple<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_142;
+typedef std::tuple<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_143;
+typedef std::tuple<double, std::vector<var>, double, double, empty, empty> type_v_144;
+typedef std::tuple<double, std::vector<var>, double, std::vector<double>, empty, empty> type_v_145;
+typedef std::tuple<double, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_146;
+typedef std::tuple<double, std::vector<var>, double, var, empty, empty> type_v_147;
+typedef std::tuple<double, std::vector<var>, double, std::vector<var>, empty, empty> type_v_148;
+typedef std::tuple<double, std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_149;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, double, empty, empty> type_v_150;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_v_151;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_152;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, var, empty, empty> type_v_153;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_v_154;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_155;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_156;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_157;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_158;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_159;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_160;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_161;
+typedef std::tuple<double, std::vector<var>, var, double, empty, empty> type_v_162;
+typedef std::tuple<double, std::vector<var>, var, std::vector<double>, empty, empty> type_v_163;
+typedef std::tuple<double, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_164;
+typedef std::tuple<double, std::vector<var>, var, var, empty, empty> type_v_165;
+typedef std::tuple<double, std::vector<var>, var, std::vector<var>, empty, empty> type_v_166;
+typedef std::tuple<double, std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_167;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, double, empty, empty> type_v_168;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_v_169;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_170;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, var, empty, empty> type_v_171;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_v_172;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_173;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_174;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_175;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_176;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_177;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_178;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_179;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_180;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_181;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_182;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_183;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_184;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_185;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_186;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_187;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_188;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_189;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_190;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_191;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_192;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_193;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_194;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_195;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_196;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_197;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_198;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_199;
+
+typedef std::tuple<AgradDistributionParetoType2, type_v_100> AgradDistributionParetoType2_v_100;
+typedef std::tuple<AgradDistributionParetoType2, type_v_101> AgradDistributionParetoType2_v_101;
+typedef std::tuple<AgradDistributionParetoType2, type_v_102> AgradDistributionParetoType2_v_102;
+typedef std::tuple<AgradDistributionParetoType2, type_v_103> AgradDistributionParetoType2_v_103;
+typedef std::tuple<AgradDistributionParetoType2, type_v_104> AgradDistributionParetoType2_v_104;
+typedef std::tuple<AgradDistributionParetoType2, type_v_105> AgradDistributionParetoType2_v_105;
+typedef std::tuple<AgradDistributionParetoType2, type_v_106> AgradDistributionParetoType2_v_106;
+typedef std::tuple<AgradDistributionParetoType2, type_v_107> AgradDistributionParetoType2_v_107;
+typedef std::tuple<AgradDistributionParetoType2, type_v_108> AgradDistributionParetoType2_v_108;
+typedef std::tuple<AgradDistributionParetoType2, type_v_109> AgradDistributionParetoType2_v_109;
+typedef std::tuple<AgradDistributionParetoType2, type_v_110> AgradDistributionParetoType2_v_110;
+typedef std::tuple<AgradDistributionParetoType2, type_v_111> AgradDistributionParetoType2_v_111;
+typedef std::tuple<AgradDistributionParetoType2, type_v_112> AgradDistributionParetoType2_v_112;
+typedef std::tuple<AgradDistributionParetoType2, type_v_113> AgradDistributionParetoType2_v_113;
+typedef std::tuple<AgradDistributionParetoType2, type_v_114> AgradDistributionParetoType2_v_114;
+typedef std::tuple<AgradDistributionParetoType2, type_v_115> AgradDistributionParetoType2_v_115;
+typedef std::tuple<AgradDistributionParetoType2, type_v_116> AgradDistributionParetoType2_v_116;
+typedef std::tuple<AgradDistributionParetoType2, type_v_117> AgradDistributionParetoType2_v_117;
+typedef std::tuple<AgradDistributionParetoType2, type_v_118> AgradDistributionParetoType2_v_118;
+typedef std::tuple<AgradDistributionParetoType2, type_v_119> AgradDistributionParetoType2_v_119;
+typedef std::tuple<AgradDistributionParetoType2, type_v_120> AgradDistributionParetoType2_v_120;
+typedef std::tuple<AgradDistributionParetoType2, type_v_121> AgradDistributionParetoType2_v_121;
+typedef std::tuple<AgradDistributionParetoType2, type_v_122> AgradDistributionParetoType2_v_122;
+typedef std::tuple<AgradDistributionParetoType2, type_v_123> AgradDistributionParetoType2_v_123;
+typedef std::tuple<AgradDistributionParetoType2, type_v_124> AgradDistributionParetoType2_v_124;
+typedef std::tuple<AgradDistributionParetoType2, type_v_125> AgradDistributionParetoType2_v_125;
+typedef std::tuple<AgradDistributionParetoType2, type_v_126> AgradDistributionParetoType2_v_126;
+typedef std::tuple<AgradDistributionParetoType2, type_v_127> AgradDistributionParetoType2_v_127;
+typedef std::tuple<AgradDistributionParetoType2, type_v_128> AgradDistributionParetoType2_v_128;
+typedef std::tuple<AgradDistributionParetoType2, type_v_129> AgradDistributionParetoType2_v_129;
+typedef std::tuple<AgradDistributionParetoType2, type_v_130> AgradDistributionParetoType2_v_130;
+typedef std::tuple<AgradDistributionParetoType2, type_v_131> AgradDistributionParetoType2_v_131;
+typedef std::tuple<AgradDistributionParetoType2, type_v_132> AgradDistributionParetoType2_v_132;
+typedef std::tuple<AgradDistributionParetoType2, type_v_133> AgradDistributionParetoType2_v_133;
+typedef std::tuple<AgradDistributionParetoType2, type_v_134> AgradDistributionParetoType2_v_134;
+typedef std::tuple<AgradDistributionParetoType2, type_v_135> AgradDistributionParetoType2_v_135;
+typedef std::tuple<AgradDistributionParetoType2, type_v_136> AgradDistributionParetoType2_v_136;
+typedef std::tuple<AgradDistributionParetoType2, type_v_137> AgradDistributionParetoType2_v_137;
+typedef std::tuple<AgradDistributionParetoType2, type_v_138> AgradDistributionParetoType2_v_138;
+typedef std::tuple<AgradDistributionParetoType2, type_v_139> AgradDistributionParetoType2_v_139;
+typedef std::tuple<AgradDistributionParetoType2, type_v_140> AgradDistributionParetoType2_v_140;
+typedef std::tuple<AgradDistributionParetoType2, type_v_141> AgradDistributionParetoType2_v_141;
+typedef std::tuple<AgradDistributionParetoType2, type_v_142> AgradDistributionParetoType2_v_142;
+typedef std::tuple<AgradDistributionParetoType2, type_v_143> AgradDistributionParetoType2_v_143;
+typedef std::tuple<AgradDistributionParetoType2, type_v_144> AgradDistributionParetoType2_v_144;
+typedef std::tuple<AgradDistributionParetoType2, type_v_145> AgradDistributionParetoType2_v_145;
+typedef std::tuple<AgradDistributionParetoType2, type_v_146> AgradDistributionParetoType2_v_146;
+typedef std::tuple<AgradDistributionParetoType2, type_v_147> AgradDistributionParetoType2_v_147;
+typedef std::tuple<AgradDistributionParetoType2, type_v_148> AgradDistributionParetoType2_v_148;
+typedef std::tuple<AgradDistributionParetoType2, type_v_149> AgradDistributionParetoType2_v_149;
+typedef std::tuple<AgradDistributionParetoType2, type_v_150> AgradDistributionParetoType2_v_150;
+typedef std::tuple<AgradDistributionParetoType2, type_v_151> AgradDistributionParetoType2_v_151;
+typedef std::tuple<AgradDistributionParetoType2, type_v_152> AgradDistributionParetoType2_v_152;
+typedef std::tuple<AgradDistributionParetoType2, type_v_153> AgradDistributionParetoType2_v_153;
+typedef std::tuple<AgradDistributionParetoType2, type_v_154> AgradDistributionParetoType2_v_154;
+typedef std::tuple<AgradDistributionParetoType2, type_v_155> AgradDistributionParetoType2_v_155;
+typedef std::tuple<AgradDistributionParetoType2, type_v_156> AgradDistributionParetoType2_v_156;
+typedef std::tuple<AgradDistributionParetoType2, type_v_157> AgradDistributionParetoType2_v_157;
+typedef std::tuple<AgradDistributionParetoType2, type_v_158> AgradDistributionParetoType2_v_158;
+typedef std::tuple<AgradDistributionParetoType2, type_v_159> AgradDistributionParetoType2_v_159;
+typedef std::tuple<AgradDistributionParetoType2, type_v_160> AgradDistributionParetoType2_v_160;
+typedef std::tuple<AgradDistributionParetoType2, type_v_161> AgradDistributionParetoType2_v_161;
+typedef std::tuple<AgradDistributionParetoType2, type_v_162> AgradDistributionParetoType2_v_162;
+typedef std::tuple<AgradDistributionParetoType2, type_v_163> AgradDistributionParetoType2_v_163;
+typedef std::tuple<AgradDistributionParetoType2, type_v_164> AgradDistributionParetoType2_v_164;
+typedef std::tuple<AgradDistributionParetoType2, type_v_165> AgradDistributionParetoType2_v_165;
+typedef std::tuple<AgradDistributionParetoType2, type_v_166> AgradDistributionParetoType2_v_166;
+typedef std::tuple<AgradDistributionParetoType2, type_v_167> AgradDistributionParetoType2_v_167;
+typedef std::tuple<AgradDistributionParetoType2, type_v_168> AgradDistributionParetoType2_v_168;
+typedef std::tuple<AgradDistributionParetoType2, type_v_169> AgradDistributionParetoType2_v_169;
+typedef std::tuple<AgradDistributionParetoType2, type_v_170> AgradDistributionParetoType2_v_170;
+typedef std::tuple<AgradDistributionParetoType2, type_v_171> AgradDistributionParetoType2_v_171;
+typedef std::tuple<AgradDistributionParetoType2, type_v_172> AgradDistributionParetoType2_v_172;
+typedef std::tuple<AgradDistributionParetoType2, type_v_173> AgradDistributionParetoType2_v_173;
+typedef std::tuple<AgradDistributionParetoType2, type_v_174> AgradDistributionParetoType2_v_174;
+typedef std::tuple<AgradDistributionParetoType2, type_v_175> AgradDistributionParetoType2_v_175;
+typedef std::tuple<AgradDistributionParetoType2, type_v_176> AgradDistributionParetoType2_v_176;
+typedef std::tuple<AgradDistributionParetoType2, type_v_177> AgradDistributionParetoType2_v_177;
+typedef std::tuple<AgradDistributionParetoType2, type_v_178> AgradDistributionParetoType2_v_178;
+typedef std::tuple<AgradDistributionParetoType2, type_v_179> AgradDistributionParetoType2_v_179;
+typedef std::tuple<AgradDistributionParetoType2, type_v_180> AgradDistributionParetoType2_v_180;
+typedef std::tuple<AgradDistributionParetoType2, type_v_181> AgradDistributionParetoType2_v_181;
+typedef std::tuple<AgradDistributionParetoType2, type_v_182> AgradDistributionParetoType2_v_182;
+typedef std::tuple<AgradDistributionParetoType2, type_v_183> AgradDistributionParetoType2_v_183;
+typedef std::tuple<AgradDistributionParetoType2, type_v_184> AgradDistributionParetoType2_v_184;
+typedef std::tuple<AgradDistributionParetoType2, type_v_185> AgradDistributionParetoType2_v_185;
+typedef std::tuple<AgradDistributionParetoType2, type_v_186> AgradDistributionParetoType2_v_186;
+typedef std::tuple<AgradDistributionParetoType2, type_v_187> AgradDistributionParetoType2_v_187;
+typedef std::tuple<AgradDistributionParetoType2, type_v_188> AgradDistributionParetoType2_v_188;
+typedef std::tuple<AgradDistributionParetoType2, type_v_189> AgradDistributionParetoType2_v_189;
+typedef std::tuple<AgradDistributionParetoType2, type_v_190> AgradDistributionParetoType2_v_190;
+typedef std::tuple<AgradDistributionParetoType2, type_v_191> AgradDistributionParetoType2_v_191;
+typedef std::tuple<AgradDistributionParetoType2, type_v_192> AgradDistributionParetoType2_v_192;
+typedef std::tuple<AgradDistributionParetoType2, type_v_193> AgradDistributionParetoType2_v_193;
+typedef std::tuple<AgradDistributionParetoType2, type_v_194> AgradDistributionParetoType2_v_194;
+typedef std::tuple<AgradDistributionParetoType2, type_v_195> AgradDistributionParetoType2_v_195;
+typedef std::tuple<AgradDistributionParetoType2, type_v_196> AgradDistributionParetoType2_v_196;
+typedef std::tuple<AgradDistributionParetoType2, type_v_197> AgradDistributionParetoType2_v_197;
+typedef std::tuple<AgradDistributionParetoType2, type_v_198> AgradDistributionParetoType2_v_198;
+typedef std::tuple<AgradDistributionParetoType2, type_v_199> AgradDistributionParetoType2_v_199;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_100, AgradDistributionTestFixture, AgradDistributionParetoType2_v_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_101, AgradDistributionTestFixture, AgradDistributionParetoType2_v_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_102, AgradDistributionTestFixture, AgradDistributionParetoType2_v_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_103, AgradDistributionTestFixture, AgradDistributionParetoType2_v_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_104, AgradDistributionTestFixture, AgradDistributionParetoType2_v_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_105, AgradDistributionTestFixture, AgradDistributionParetoType2_v_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_106, AgradDistributionTestFixture, AgradDistributionParetoType2_v_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_107, AgradDistributionTestFixture, AgradDistributionParetoType2_v_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_108, AgradDistributionTestFixture, AgradDistributionParetoType2_v_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_109, AgradDistributionTestFixture, AgradDistributionParetoType2_v_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_110, AgradDistributionTestFixture, AgradDistributionParetoType2_v_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_111, AgradDistributionTestFixture, AgradDistributionParetoType2_v_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_112, AgradDistributionTestFixture, AgradDistributionParetoType2_v_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_113, AgradDistributionTestFixture, AgradDistributionParetoType2_v_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_114, AgradDistributionTestFixture, AgradDistributionParetoType2_v_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_115, AgradDistributionTestFixture, AgradDistributionParetoType2_v_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_116, AgradDistributionTestFixture, AgradDistributionParetoType2_v_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_117, AgradDistributionTestFixture, AgradDistributionParetoType2_v_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_118, AgradDistributionTestFixture, AgradDistributionParetoType2_v_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_119, AgradDistributionTestFixture, AgradDistributionParetoType2_v_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_120, AgradDistributionTestFixture, AgradDistributionParetoType2_v_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_121, AgradDistributionTestFixture, AgradDistributionParetoType2_v_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_122, AgradDistributionTestFixture, AgradDistributionParetoType2_v_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_123, AgradDistributionTestFixture, AgradDistributionParetoType2_v_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_124, AgradDistributionTestFixture, AgradDistributionParetoType2_v_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_125, AgradDistributionTestFixture, AgradDistributionParetoType2_v_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_126, AgradDistributionTestFixture, AgradDistributionParetoType2_v_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_127, AgradDistributionTestFixture, AgradDistributionParetoType2_v_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_128, AgradDistributionTestFixture, AgradDistributionParetoType2_v_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_129, AgradDistributionTestFixture, AgradDistributionParetoType2_v_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_130, AgradDistributionTestFixture, AgradDistributionParetoType2_v_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_131, AgradDistributionTestFixture, AgradDistributionParetoType2_v_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_132, AgradDistributionTestFixture, AgradDistributionParetoType2_v_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_133, AgradDistributionTestFixture, AgradDistributionParetoType2_v_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_134, AgradDistributionTestFixture, AgradDistributionParetoType2_v_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_135, AgradDistributionTestFixture, AgradDistributionParetoType2_v_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_136, AgradDistributionTestFixture, AgradDistributionParetoType2_v_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_137, AgradDistributionTestFixture, AgradDistributionParetoType2_v_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_138, AgradDistributionTestFixture, AgradDistributionParetoType2_v_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_139, AgradDistributionTestFixture, AgradDistributionParetoType2_v_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_140, AgradDistributionTestFixture, AgradDistributionParetoType2_v_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_141, AgradDistributionTestFixture, AgradDistributionParetoType2_v_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_142, AgradDistributionTestFixture, AgradDistributionParetoType2_v_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_143, AgradDistributionTestFixture, AgradDistributionParetoType2_v_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_144, AgradDistributionTestFixture, AgradDistributionParetoType2_v_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_145, AgradDistributionTestFixture, AgradDistributionParetoType2_v_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_146, AgradDistributionTestFixture, AgradDistributionParetoType2_v_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_147, AgradDistributionTestFixture, AgradDistributionParetoType2_v_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_148, AgradDistributionTestFixture, AgradDistributionParetoType2_v_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_149, AgradDistributionTestFixture, AgradDistributionParetoType2_v_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_150, AgradDistributionTestFixture, AgradDistributionParetoType2_v_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_151, AgradDistributionTestFixture, AgradDistributionParetoType2_v_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_152, AgradDistributionTestFixture, AgradDistributionParetoType2_v_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_153, AgradDistributionTestFixture, AgradDistributionParetoType2_v_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_154, AgradDistributionTestFixture, AgradDistributionParetoType2_v_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_155, AgradDistributionTestFixture, AgradDistributionParetoType2_v_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_156, AgradDistributionTestFixture, AgradDistributionParetoType2_v_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_157, AgradDistributionTestFixture, AgradDistributionParetoType2_v_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_158, AgradDistributionTestFixture, AgradDistributionParetoType2_v_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_159, AgradDistributionTestFixture, AgradDistributionParetoType2_v_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_160, AgradDistributionTestFixture, AgradDistributionParetoType2_v_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_161, AgradDistributionTestFixture, AgradDistributionParetoType2_v_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_162, AgradDistributionTestFixture, AgradDistributionParetoType2_v_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_163, AgradDistributionTestFixture, AgradDistributionParetoType2_v_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_164, AgradDistributionTestFixture, AgradDistributionParetoType2_v_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_165, AgradDistributionTestFixture, AgradDistributionParetoType2_v_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_166, AgradDistributionTestFixture, AgradDistributionParetoType2_v_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_167, AgradDistributionTestFixture, AgradDistributionParetoType2_v_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_168, AgradDistributionTestFixture, AgradDistributionParetoType2_v_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_169, AgradDistributionTestFixture, AgradDistributionParetoType2_v_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_170, AgradDistributionTestFixture, AgradDistributionParetoType2_v_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_171, AgradDistributionTestFixture, AgradDistributionParetoType2_v_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_172, AgradDistributionTestFixture, AgradDistributionParetoType2_v_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_173, AgradDistributionTestFixture, AgradDistributionParetoType2_v_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_174, AgradDistributionTestFixture, AgradDistributionParetoType2_v_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_175, AgradDistributionTestFixture, AgradDistributionParetoType2_v_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_176, AgradDistributionTestFixture, AgradDistributionParetoType2_v_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_177, AgradDistributionTestFixture, AgradDistributionParetoType2_v_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_178, AgradDistributionTestFixture, AgradDistributionParetoType2_v_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_179, AgradDistributionTestFixture, AgradDistributionParetoType2_v_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_180, AgradDistributionTestFixture, AgradDistributionParetoType2_v_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_181, AgradDistributionTestFixture, AgradDistributionParetoType2_v_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_182, AgradDistributionTestFixture, AgradDistributionParetoType2_v_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_183, AgradDistributionTestFixture, AgradDistributionParetoType2_v_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_184, AgradDistributionTestFixture, AgradDistributionParetoType2_v_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_185, AgradDistributionTestFixture, AgradDistributionParetoType2_v_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_186, AgradDistributionTestFixture, AgradDistributionParetoType2_v_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_187, AgradDistributionTestFixture, AgradDistributionParetoType2_v_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_188, AgradDistributionTestFixture, AgradDistributionParetoType2_v_188);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_189, AgradDistributionTestFixture, AgradDistributionParetoType2_v_189);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_190, AgradDistributionTestFixture, AgradDistributionParetoType2_v_190);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_191, AgradDistributionTestFixture, AgradDistributionParetoType2_v_191);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_192, AgradDistributionTestFixture, AgradDistributionParetoType2_v_192);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_193, AgradDistributionTestFixture, AgradDistributionParetoType2_v_193);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_194, AgradDistributionTestFixture, AgradDistributionParetoType2_v_194);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_195, AgradDistributionTestFixture, AgradDistributionParetoType2_v_195);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_196, AgradDistributionTestFixture, AgradDistributionParetoType2_v_196);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_197, AgradDistributionTestFixture, AgradDistributionParetoType2_v_197);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_198, AgradDistributionTestFixture, AgradDistributionParetoType2_v_198);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_199, AgradDistributionTestFixture, AgradDistributionParetoType2_v_199);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_test.hpp>
+
+typedef std::tuple<double, var, var, std::vector<double>, empty, empty> type_vv_100;
+typedef std::tuple<double, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_101;
+typedef std::tuple<double, var, var, var, empty, empty> type_vv_102;
+typedef std::tuple<double, var, var, std::vector<var>, empty, empty> type_vv_103;
+typedef std::tuple<double, var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_104;
+typedef std::tuple<double, var, std::vector<var>, double, empty, empty> type_vv_105;
+typedef std::tuple<double, var, std::vector<var>, std::vector<double>, empty, empty> type_vv_106;
+typedef std::tuple<double, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_107;
+typedef std::tuple<double, var, std::vector<var>, var, empty, empty> type_vv_108;
+typedef std::tuple<double, var, std::vector<var>, std::vector<var>, empty, empty> type_vv_109;
+typedef std::tuple<double, var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_110;
+typedef std::tuple<double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_111;
+typedef std::tuple<double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_112;
+typedef std::tuple<double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_113;
+typedef std::tuple<double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_114;
+typedef std::tuple<double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_115;
+typedef std::tuple<double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_116;
+typedef std::tuple<double, std::vector<var>, double, double, empty, empty> type_vv_117;
+typedef std::tuple<double, std::vector<var>, double, std::vector<double>, empty, empty> type_vv_118;
+typedef std::tuple<double, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_119;
+typedef std::tuple<double, std::vector<var>, double, var, empty, empty> type_vv_120;
+typedef std::tuple<double, std::vector<var>, double, std::vector<var>, empty, empty> type_vv_121;
+typedef std::tuple<double, std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_122;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, double, empty, empty> type_vv_123;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_vv_124;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_125;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, var, empty, empty> type_vv_126;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_vv_127;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_128;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_129;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_130;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_131;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_132;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_133;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_134;
+typedef std::tuple<double, std::vector<var>, var, double, empty, empty> type_vv_135;
+typedef std::tuple<double, std::vector<var>, var, std::vector<double>, empty, empty> type_vv_136;
+typedef std::tuple<double, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_137;
+typedef std::tuple<double, std::vector<var>, var, var, empty, empty> type_vv_138;
+typedef std::tuple<double, std::vector<var>, var, std::vector<var>, empty, empty> type_vv_139;
+typedef std::tuple<double, std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_140;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, double, empty, empty> type_vv_141;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_vv_142;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_143;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, var, empty, empty> type_vv_144;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_vv_145;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_146;
+typedef std::tuple<double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_147;
+typedef std::tuple<double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_148;
+typedef std::tuple<double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_149;
+typedef std::tuple<double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_150;
+typedef std::tuple<double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_151;
+typedef std::tuple<double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_152;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, empty, empty> type_vv_153;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, empty, empty> type_vv_154;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_155;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, empty, empty> type_vv_156;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, empty, empty> type_vv_157;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_158;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, empty, empty> type_vv_159;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, empty, empty> type_vv_160;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_161;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, empty, empty> type_vv_162;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, empty, empty> type_vv_163;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_164;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_165;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_166;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_167;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_168;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_169;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_170;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, empty, empty> type_vv_171;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, empty, empty> type_vv_172;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_173;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, empty, empty> type_vv_174;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, empty, empty> type_vv_175;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_176;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, empty, empty> type_vv_177;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, empty, empty> type_vv_178;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_179;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, empty, empty> type_vv_180;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, empty, empty> type_vv_181;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_182;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_183;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_184;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_185;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_186;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_187;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_188;
+typedef std::tuple<std::vector<double>, double, double, var, empty, empty> type_vv_189;
+typedef std::tuple<std::vector<double>, double, double, std::vector<var>, empty, empty> type_vv_190;
+typedef std::tuple<std::vector<double>, double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_191;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, var, empty, empty> type_vv_192;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, std::vector<var>, empty, empty> type_vv_193;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_194;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_195;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_196;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_197;
+typedef std::tuple<std::vector<double>, double, var, double, empty, empty> type_vv_198;
+typedef std::tuple<std::vector<double>, double, var, std::vector<double>, empty, empty> type_vv_199;
+
+typedef std::tuple<AgradDistributionParetoType2, type_vv_100> AgradDistributionParetoType2_vv_100;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_101> AgradDistributionParetoType2_vv_101;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_102> AgradDistributionParetoType2_vv_102;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_103> AgradDistributionParetoType2_vv_103;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_104> AgradDistributionParetoType2_vv_104;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_105> AgradDistributionParetoType2_vv_105;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_106> AgradDistributionParetoType2_vv_106;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_107> AgradDistributionParetoType2_vv_107;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_108> AgradDistributionParetoType2_vv_108;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_109> AgradDistributionParetoType2_vv_109;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_110> AgradDistributionParetoType2_vv_110;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_111> AgradDistributionParetoType2_vv_111;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_112> AgradDistributionParetoType2_vv_112;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_113> AgradDistributionParetoType2_vv_113;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_114> AgradDistributionParetoType2_vv_114;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_115> AgradDistributionParetoType2_vv_115;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_116> AgradDistributionParetoType2_vv_116;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_117> AgradDistributionParetoType2_vv_117;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_118> AgradDistributionParetoType2_vv_118;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_119> AgradDistributionParetoType2_vv_119;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_120> AgradDistributionParetoType2_vv_120;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_121> AgradDistributionParetoType2_vv_121;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_122> AgradDistributionParetoType2_vv_122;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_123> AgradDistributionParetoType2_vv_123;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_124> AgradDistributionParetoType2_vv_124;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_125> AgradDistributionParetoType2_vv_125;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_126> AgradDistributionParetoType2_vv_126;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_127> AgradDistributionParetoType2_vv_127;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_128> AgradDistributionParetoType2_vv_128;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_129> AgradDistributionParetoType2_vv_129;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_130> AgradDistributionParetoType2_vv_130;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_131> AgradDistributionParetoType2_vv_131;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_132> AgradDistributionParetoType2_vv_132;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_133> AgradDistributionParetoType2_vv_133;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_134> AgradDistributionParetoType2_vv_134;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_135> AgradDistributionParetoType2_vv_135;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_136> AgradDistributionParetoType2_vv_136;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_137> AgradDistributionParetoType2_vv_137;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_138> AgradDistributionParetoType2_vv_138;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_139> AgradDistributionParetoType2_vv_139;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_140> AgradDistributionParetoType2_vv_140;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_141> AgradDistributionParetoType2_vv_141;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_142> AgradDistributionParetoType2_vv_142;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_143> AgradDistributionParetoType2_vv_143;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_144> AgradDistributionParetoType2_vv_144;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_145> AgradDistributionParetoType2_vv_145;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_146> AgradDistributionParetoType2_vv_146;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_147> AgradDistributionParetoType2_vv_147;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_148> AgradDistributionParetoType2_vv_148;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_149> AgradDistributionParetoType2_vv_149;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_150> AgradDistributionParetoType2_vv_150;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_151> AgradDistributionParetoType2_vv_151;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_152> AgradDistributionParetoType2_vv_152;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_153> AgradDistributionParetoType2_vv_153;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_154> AgradDistributionParetoType2_vv_154;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_155> AgradDistributionParetoType2_vv_155;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_156> AgradDistributionParetoType2_vv_156;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_157> AgradDistributionParetoType2_vv_157;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_158> AgradDistributionParetoType2_vv_158;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_159> AgradDistributionParetoType2_vv_159;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_160> AgradDistributionParetoType2_vv_160;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_161> AgradDistributionParetoType2_vv_161;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_162> AgradDistributionParetoType2_vv_162;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_163> AgradDistributionParetoType2_vv_163;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_164> AgradDistributionParetoType2_vv_164;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_165> AgradDistributionParetoType2_vv_165;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_166> AgradDistributionParetoType2_vv_166;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_167> AgradDistributionParetoType2_vv_167;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_168> AgradDistributionParetoType2_vv_168;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_169> AgradDistributionParetoType2_vv_169;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_170> AgradDistributionParetoType2_vv_170;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_171> AgradDistributionParetoType2_vv_171;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_172> AgradDistributionParetoType2_vv_172;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_173> AgradDistributionParetoType2_vv_173;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_174> AgradDistributionParetoType2_vv_174;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_175> AgradDistributionParetoType2_vv_175;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_176> AgradDistributionParetoType2_vv_176;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_177> AgradDistributionParetoType2_vv_177;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_178> AgradDistributionParetoType2_vv_178;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_179> AgradDistributionParetoType2_vv_179;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_180> AgradDistributionParetoType2_vv_180;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_181> AgradDistributionParetoType2_vv_181;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_182> AgradDistributionParetoType2_vv_182;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_183> AgradDistributionParetoType2_vv_183;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_184> AgradDistributionParetoType2_vv_184;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_185> AgradDistributionParetoType2_vv_185;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_186> AgradDistributionParetoType2_vv_186;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_187> AgradDistributionParetoType2_vv_187;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_188> AgradDistributionParetoType2_vv_188;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_189> AgradDistributionParetoType2_vv_189;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_190> AgradDistributionParetoType2_vv_190;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_191> AgradDistributionParetoType2_vv_191;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_192> AgradDistributionParetoType2_vv_192;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_193> AgradDistributionParetoType2_vv_193;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_194> AgradDistributionParetoType2_vv_194;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_195> AgradDistributionParetoType2_vv_195;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_196> AgradDistributionParetoType2_vv_196;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_197> AgradDistributionParetoType2_vv_197;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_198> AgradDistributionParetoType2_vv_198;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_199> AgradDistributionParetoType2_vv_199;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_100, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_101, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_102, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_103, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_104, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_105, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_106, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_107, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_108, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_109, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_110, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_111, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_112, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_113, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_114, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_115, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_116, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_117, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_118, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_119, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_120, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_121, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_122, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_123, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_124, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_125, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_126, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_127, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_128, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_129, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_130, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_131, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_132, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_133, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_134, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_135, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_136, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_137, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_138, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_139, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_140, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_141, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_142, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_143, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_144, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_145, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_146, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_147, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_148, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_149, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_150, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_151, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_152, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_153, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_154, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_155, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_156, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_157, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_158, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_159, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_160, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_161, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_162, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_163, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_164, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_165, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_166, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_167, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_168, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_169, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_170, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_171, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_172, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_173, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_174, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_175, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_176, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_177, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_178, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_179, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_180, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_181, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_182, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_183, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_184, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_185, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_186, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_187, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_188, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_188);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_189, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_189);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_190, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_190);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_191, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_191);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_192, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_192);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_193, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_193);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_194, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_194);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_195, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_195);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_196, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_196);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_197, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_197);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_198, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_198);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_199, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_199);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_test.hpp>
+
+typedef std::tuple<std::vector<double>, double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_200;
+typedef std::tuple<std::vector<double>, double, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_201;
+typedef std::tuple<std::vector<double>, double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_202;
+typedef std::tuple<std::vector<double>, double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_203;
+typedef std::tuple<std::vector<double>, double, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_204;
+typedef std::tuple<std::vector<double>, double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_205;
+typedef std::tuple<std::vector<double>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_206;
+typedef std::tuple<std::vector<double>, double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_207;
+typedef std::tuple<std::vector<double>, double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_208;
+typedef std::tuple<std::vector<double>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_209;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_210;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_211;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_212;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_213;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_214;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_215;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, fvar<fvar<var> >, empty, empty> type_ffv_216;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_217;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_218;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_219;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_220;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_221;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_222;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_223;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_224;
+typedef std::tuple<std::vector<double>, std::vector<double>, fvar<fvar<var> >, double, empty, empty> type_ffv_225;
+typedef std::tuple<std::vector<double>, std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_226;
+typedef std::tuple<std::vector<double>, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_227;
+typedef std::tuple<std::vector<double>, std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_228;
+typedef std::tuple<std::vector<double>, std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_229;
+typedef std::tuple<std::vector<double>, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_230;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_231;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_232;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_233;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_234;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_235;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_236;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_237;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_238;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_239;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_240;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_241;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_242;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_243;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_244;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_245;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_246;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_247;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_248;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_249;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_250;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_251;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_252;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_253;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_254;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_255;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_256;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_257;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_258;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_259;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_260;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_261;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_262;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_263;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_264;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_265;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_266;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_267;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_268;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_269;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, double, double, empty, empty> type_ffv_270;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, double, std::vector<double>, empty, empty> type_ffv_271;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_272;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, double, fvar<fvar<var> >, empty, empty> type_ffv_273;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_274;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_275;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<double>, double, empty, empty> type_ffv_276;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty, empty> type_ffv_277;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_278;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_279;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_280;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_281;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_282;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_283;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_284;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_285;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_286;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_287;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, double, empty, empty> type_ffv_288;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_289;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_290;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_291;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_292;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_293;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_294;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_295;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_296;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_297;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_298;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_299;
+
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_200> AgradDistributionParetoType2_ffv_200;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_201> AgradDistributionParetoType2_ffv_201;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_202> AgradDistributionParetoType2_ffv_202;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_203> AgradDistributionParetoType2_ffv_203;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_204> AgradDistributionParetoType2_ffv_204;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_205> AgradDistributionParetoType2_ffv_205;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_206> AgradDistributionParetoType2_ffv_206;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_207> AgradDistributionParetoType2_ffv_207;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_208> AgradDistributionParetoType2_ffv_208;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_209> AgradDistributionParetoType2_ffv_209;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_210> AgradDistributionParetoType2_ffv_210;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_211> AgradDistributionParetoType2_ffv_211;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_212> AgradDistributionParetoType2_ffv_212;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_213> AgradDistributionParetoType2_ffv_213;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_214> AgradDistributionParetoType2_ffv_214;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_215> AgradDistributionParetoType2_ffv_215;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_216> AgradDistributionParetoType2_ffv_216;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_217> AgradDistributionParetoType2_ffv_217;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_218> AgradDistributionParetoType2_ffv_218;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_219> AgradDistributionParetoType2_ffv_219;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_220> AgradDistributionParetoType2_ffv_220;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_221> AgradDistributionParetoType2_ffv_221;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_222> AgradDistributionParetoType2_ffv_222;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_223> AgradDistributionParetoType2_ffv_223;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_224> AgradDistributionParetoType2_ffv_224;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_225> AgradDistributionParetoType2_ffv_225;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_226> AgradDistributionParetoType2_ffv_226;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_227> AgradDistributionParetoType2_ffv_227;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_228> AgradDistributionParetoType2_ffv_228;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_229> AgradDistributionParetoType2_ffv_229;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_230> AgradDistributionParetoType2_ffv_230;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_231> AgradDistributionParetoType2_ffv_231;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_232> AgradDistributionParetoType2_ffv_232;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_233> AgradDistributionParetoType2_ffv_233;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_234> AgradDistributionParetoType2_ffv_234;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_235> AgradDistributionParetoType2_ffv_235;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_236> AgradDistributionParetoType2_ffv_236;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_237> AgradDistributionParetoType2_ffv_237;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_238> AgradDistributionParetoType2_ffv_238;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_239> AgradDistributionParetoType2_ffv_239;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_240> AgradDistributionParetoType2_ffv_240;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_241> AgradDistributionParetoType2_ffv_241;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_242> AgradDistributionParetoType2_ffv_242;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_243> AgradDistributionParetoType2_ffv_243;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_244> AgradDistributionParetoType2_ffv_244;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_245> AgradDistributionParetoType2_ffv_245;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_246> AgradDistributionParetoType2_ffv_246;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_247> AgradDistributionParetoType2_ffv_247;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_248> AgradDistributionParetoType2_ffv_248;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_249> AgradDistributionParetoType2_ffv_249;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_250> AgradDistributionParetoType2_ffv_250;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_251> AgradDistributionParetoType2_ffv_251;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_252> AgradDistributionParetoType2_ffv_252;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_253> AgradDistributionParetoType2_ffv_253;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_254> AgradDistributionParetoType2_ffv_254;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_255> AgradDistributionParetoType2_ffv_255;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_256> AgradDistributionParetoType2_ffv_256;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_257> AgradDistributionParetoType2_ffv_257;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_258> AgradDistributionParetoType2_ffv_258;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_259> AgradDistributionParetoType2_ffv_259;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_260> AgradDistributionParetoType2_ffv_260;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_261> AgradDistributionParetoType2_ffv_261;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_262> AgradDistributionParetoType2_ffv_262;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_263> AgradDistributionParetoType2_ffv_263;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_264> AgradDistributionParetoType2_ffv_264;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_265> AgradDistributionParetoType2_ffv_265;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_266> AgradDistributionParetoType2_ffv_266;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_267> AgradDistributionParetoType2_ffv_267;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_268> AgradDistributionParetoType2_ffv_268;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_269> AgradDistributionParetoType2_ffv_269;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_270> AgradDistributionParetoType2_ffv_270;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_271> AgradDistributionParetoType2_ffv_271;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_272> AgradDistributionParetoType2_ffv_272;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_273> AgradDistributionParetoType2_ffv_273;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_274> AgradDistributionParetoType2_ffv_274;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_275> AgradDistributionParetoType2_ffv_275;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_276> AgradDistributionParetoType2_ffv_276;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_277> AgradDistributionParetoType2_ffv_277;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_278> AgradDistributionParetoType2_ffv_278;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_279> AgradDistributionParetoType2_ffv_279;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_280> AgradDistributionParetoType2_ffv_280;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_281> AgradDistributionParetoType2_ffv_281;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_282> AgradDistributionParetoType2_ffv_282;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_283> AgradDistributionParetoType2_ffv_283;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_284> AgradDistributionParetoType2_ffv_284;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_285> AgradDistributionParetoType2_ffv_285;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_286> AgradDistributionParetoType2_ffv_286;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_287> AgradDistributionParetoType2_ffv_287;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_288> AgradDistributionParetoType2_ffv_288;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_289> AgradDistributionParetoType2_ffv_289;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_290> AgradDistributionParetoType2_ffv_290;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_291> AgradDistributionParetoType2_ffv_291;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_292> AgradDistributionParetoType2_ffv_292;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_293> AgradDistributionParetoType2_ffv_293;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_294> AgradDistributionParetoType2_ffv_294;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_295> AgradDistributionParetoType2_ffv_295;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_296> AgradDistributionParetoType2_ffv_296;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_297> AgradDistributionParetoType2_ffv_297;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_298> AgradDistributionParetoType2_ffv_298;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_299> AgradDistributionParetoType2_ffv_299;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_200, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_200);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_201, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_201);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_202, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_202);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_203, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_203);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_204, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_204);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_205, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_205);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_206, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_206);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_207, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_207);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_208, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_208);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_209, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_209);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_210, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_210);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_211, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_211);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_212, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_212);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_213, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_213);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_214, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_214);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_215, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_215);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_216, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_216);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_217, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_217);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_218, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_218);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_219, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_219);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_220, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_220);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_221, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_221);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_222, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_222);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_223, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_223);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_224, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_224);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_225, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_225);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_226, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_226);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_227, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_227);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_228, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_228);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_229, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_229);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_230, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_230);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_231, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_231);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_232, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_232);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_233, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_233);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_234, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_234);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_235, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_235);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_236, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_236);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_237, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_237);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_238, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_238);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_239, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_239);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_240, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_240);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_241, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_241);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_242, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_242);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_243, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_243);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_244, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_244);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_245, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_245);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_246, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_246);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_247, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_247);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_248, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_248);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_249, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_249);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_250, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_250);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_251, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_251);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_252, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_252);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_253, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_253);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_254, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_254);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_255, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_255);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_256, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_256);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_257, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_257);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_258, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_258);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_259, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_259);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_260, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_260);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_261, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_261);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_262, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_262);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_263, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_263);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_264, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_264);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_265, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_265);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_266, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_266);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_267, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_267);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_268, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_268);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_269, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_269);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_270, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_270);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_271, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_271);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_272, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_272);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_273, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_273);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_274, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_274);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_275, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_275);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_276, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_276);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_277, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_277);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_278, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_278);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_279, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_279);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_280, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_280);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_281, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_281);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_282, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_282);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_283, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_283);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_284, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_284);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_285, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_285);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_286, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_286);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_287, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_287);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_288, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_288);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_289, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_289);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_290, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_290);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_291, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_291);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_292, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_292);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_293, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_293);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_294, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_294);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_295, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_295);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_296, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_296);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_297, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_297);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_298, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_298);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_299, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_299);
+
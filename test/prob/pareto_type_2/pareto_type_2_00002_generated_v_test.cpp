@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_test.hpp>
+
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_200;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_201;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_202;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_203;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_204;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_205;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_206;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_207;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_208;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_209;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_210;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_211;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_212;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_213;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_214;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_215;
+typedef std::tuple<std::vector<double>, double, double, double, empty, empty> type_v_216;
+typedef std::tuple<std::vector<double>, double, double, std::vector<double>, empty, empty> type_v_217;
+typedef std::tuple<std::vector<double>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_218;
+typedef std::tuple<std::vector<double>, double, double, var, empty, empty> type_v_219;
+typedef std::tuple<std::vector<double>, double, double, std::vector<var>, empty, empty> type_v_220;
+typedef std::tuple<std::vector<double>, double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_221;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, double, empty, empty> type_v_222;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, std::vector<double>, empty, empty> type_v_223;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_224;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, var, empty, empty> type_v_225;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, std::vector<var>, empty, empty> type_v_226;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_227;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_228;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_229;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_230;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_231;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_232;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_233;
+typedef std::tuple<std::vector<double>, double, var, double, empty, empty> type_v_234;
+typedef std::tuple<std::vector<double>, double, var, std::vector<double>, empty, empty> type_v_235;
+typedef std::tuple<std::vector<double>, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_236;
+typedef std::tuple<std::vector<double>, double, var, var, empty, empty> type_v_237;
+typedef std::tuple<std::vector<double>, double, var, std::vector<var>, empty, empty> type_v_238;
+typedef std::tuple<std::vector<double>, double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_239;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, double, empty, empty> type_v_240;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, std::vector<double>, empty, empty> type_v_241;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_242;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, var, empty, empty> type_v_243;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, std::vector<var>, empty, empty> type_v_244;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_245;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_246;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_247;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_248;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_249;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_250;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_251;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, double, empty, empty> type_v_252;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, std::vector<double>, empty, empty> type_v_253;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_254;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, var, empty, empty> type_v_255;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, std::vector<var>, empty, empty> type_v_256;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_257;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, double, empty, empty> type_v_258;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, std::vector<double>, empty, empty> type_v_259;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_260;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, var, empty, empty> type_v_261;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_v_262;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_263;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_264;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_265;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_266;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_267;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_268;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_269;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, double, empty, empty> type_v_270;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, std::vector<double>, empty, empty> type_v_271;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_272;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, var, empty, empty> type_v_273;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, std::vector<var>, empty, empty> type_v_274;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_275;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, double, empty, empty> type_v_276;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_v_277;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_278;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, var, empty, empty> type_v_279;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_v_280;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_281;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_282;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_283;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_284;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_285;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_286;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_287;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_288;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_289;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_290;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_291;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_292;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_293;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_294;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_295;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_296;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_297;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_298;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_299;
+
+typedef std::tuple<AgradDistributionParetoType2, type_v_200> AgradDistributionParetoType2_v_200;
+typedef std::tuple<AgradDistributionParetoType2, type_v_201> AgradDistributionParetoType2_v_201;
+typedef std::tuple<AgradDistributionParetoType2, type_v_202> AgradDistributionParetoType2_v_202;
+typedef std::tuple<AgradDistributionParetoType2, type_v_203> AgradDistributionParetoType2_v_203;
+typedef std::tuple<AgradDistributionParetoType2, type_v_204> AgradDistributionParetoType2_v_204;
+typedef std::tuple<AgradDistributionParetoType2, type_v_205> AgradDistributionParetoType2_v_205;
+typedef std::tuple<AgradDistributionParetoType2, type_v_206> AgradDistributionParetoType2_v_206;
+typedef std::tuple<AgradDistributionParetoType2, type_v_207> AgradDistributionParetoType2_v_207;
+typedef std::tuple<AgradDistributionParetoType2, type_v_208> AgradDistributionParetoType2_v_208;
+typedef std::tuple<AgradDistributionParetoType2, type_v_209> AgradDistributionParetoType2_v_209;
+typedef std::tuple<AgradDistributionParetoType2, type_v_210> AgradDistributionParetoType2_v_210;
+typedef std::tuple<AgradDistributionParetoType2, type_v_211> AgradDistributionParetoType2_v_211;
+typedef std::tuple<AgradDistributionParetoType2, type_v_212> AgradDistributionParetoType2_v_212;
+typedef std::tuple<AgradDistributionParetoType2, type_v_213> AgradDistributionParetoType2_v_213;
+typedef std::tuple<AgradDistributionParetoType2, type_v_214> AgradDistributionParetoType2_v_214;
+typedef std::tuple<AgradDistributionParetoType2, type_v_215> AgradDistributionParetoType2_v_215;
+typedef std::tuple<AgradDistributionParetoType2, type_v_216> AgradDistributionParetoType2_v_216;
+typedef std::tuple<AgradDistributionParetoType2, type_v_217> AgradDistributionParetoType2_v_217;
+typedef std::tuple<AgradDistributionParetoType2, type_v_218> AgradDistributionParetoType2_v_218;
+typedef std::tuple<AgradDistributionParetoType2, type_v_219> AgradDistributionParetoType2_v_219;
+typedef std::tuple<AgradDistributionParetoType2, type_v_220> AgradDistributionParetoType2_v_220;
+typedef std::tuple<AgradDistributionParetoType2, type_v_221> AgradDistributionParetoType2_v_221;
+typedef std::tuple<AgradDistributionParetoType2, type_v_222> AgradDistributionParetoType2_v_222;
+typedef std::tuple<AgradDistributionParetoType2, type_v_223> AgradDistributionParetoType2_v_223;
+typedef std::tuple<AgradDistributionParetoType2, type_v_224> AgradDistributionParetoType2_v_224;
+typedef std::tuple<AgradDistributionParetoType2, type_v_225> AgradDistributionParetoType2_v_225;
+typedef std::tuple<AgradDistributionParetoType2, type_v_226> AgradDistributionParetoType2_v_226;
+typedef std::tuple<AgradDistributionParetoType2, type_v_227> AgradDistributionParetoType2_v_227;
+typedef std::tuple<AgradDistributionParetoType2, type_v_228> AgradDistributionParetoType2_v_228;
+typedef std::tuple<AgradDistributionParetoType2, type_v_229> AgradDistributionParetoType2_v_229;
+typedef std::tuple<AgradDistributionParetoType2, type_v_230> AgradDistributionParetoType2_v_230;
+typedef std::tuple<AgradDistributionParetoType2, type_v_231> AgradDistributionParetoType2_v_231;
+typedef std::tuple<AgradDistributionParetoType2, type_v_232> AgradDistributionParetoType2_v_232;
+typedef std::tuple<AgradDistributionParetoType2, type_v_233> AgradDistributionParetoType2_v_233;
+typedef std::tuple<AgradDistributionParetoType2, type_v_234> AgradDistributionParetoType2_v_234;
+typedef std::tuple<AgradDistributionParetoType2, type_v_235> AgradDistributionParetoType2_v_235;
+typedef std::tuple<AgradDistributionParetoType2, type_v_236> AgradDistributionParetoType2_v_236;
+typedef std::tuple<AgradDistributionParetoType2, type_v_237> AgradDistributionParetoType2_v_237;
+typedef std::tuple<AgradDistributionParetoType2, type_v_238> AgradDistributionParetoType2_v_238;
+typedef std::tuple<AgradDistributionParetoType2, type_v_239> AgradDistributionParetoType2_v_239;
+typedef std::tuple<AgradDistributionParetoType2, type_v_240> AgradDistributionParetoType2_v_240;
+typedef std::tuple<AgradDistributionParetoType2, type_v_241> AgradDistributionParetoType2_v_241;
+typedef std::tuple<AgradDistributionParetoType2, type_v_242> AgradDistributionParetoType2_v_242;
+typedef std::tuple<AgradDistributionParetoType2, type_v_243> AgradDistributionParetoType2_v_243;
+typedef std::tuple<AgradDistributionParetoType2, type_v_244> AgradDistributionParetoType2_v_244;
+typedef std::tuple<AgradDistributionParetoType2, type_v_245> AgradDistributionParetoType2_v_245;
+typedef std::tuple<AgradDistributionParetoType2, type_v_246> AgradDistributionParetoType2_v_246;
+typedef std::tuple<AgradDistributionParetoType2, type_v_247> AgradDistributionParetoType2_v_247;
+typedef std::tuple<AgradDistributionParetoType2, type_v_248> AgradDistributionParetoType2_v_248;
+typedef std::tuple<AgradDistributionParetoType2, type_v_249> AgradDistributionParetoType2_v_249;
+typedef std::tuple<AgradDistributionParetoType2, type_v_250> AgradDistributionParetoType2_v_250;
+typedef std::tuple<AgradDistributionParetoType2, type_v_251> AgradDistributionParetoType2_v_251;
+typedef std::tuple<AgradDistributionParetoType2, type_v_252> AgradDistributionParetoType2_v_252;
+typedef std::tuple<AgradDistributionParetoType2, type_v_253> AgradDistributionParetoType2_v_253;
+typedef std::tuple<AgradDistributionParetoType2, type_v_254> AgradDistributionParetoType2_v_254;
+typedef std::tuple<AgradDistributionParetoType2, type_v_255> AgradDistributionParetoType2_v_255;
+typedef std::tuple<AgradDistributionParetoType2, type_v_256> AgradDistributionParetoType2_v_256;
+typedef std::tuple<AgradDistributionParetoType2, type_v_257> AgradDistributionParetoType2_v_257;
+typedef std::tuple<AgradDistributionParetoType2, type_v_258> AgradDistributionParetoType2_v_258;
+typedef std::tuple<AgradDistributionParetoType2, type_v_259> AgradDistributionParetoType2_v_259;
+typedef std::tuple<AgradDistributionParetoType2, type_v_260> AgradDistributionParetoType2_v_260;
+typedef std::tuple<AgradDistributionParetoType2, type_v_261> AgradDistributionParetoType2_v_261;
+typedef std::tuple<AgradDistributionParetoType2, type_v_262> AgradDistributionParetoType2_v_262;
+typedef std::tuple<AgradDistributionParetoType2, type_v_263> AgradDistributionParetoType2_v_263;
+typedef std::tuple<AgradDistributionParetoType2, type_v_264> AgradDistributionParetoType2_v_264;
+typedef std::tuple<AgradDistributionParetoType2, type_v_265> AgradDistributionParetoType2_v_265;
+typedef std::tuple<AgradDistributionParetoType2, type_v_266> AgradDistributionParetoType2_v_266;
+typedef std::tuple<AgradDistributionParetoType2, type_v_267> AgradDistributionParetoType2_v_267;
+typedef std::tuple<AgradDistributionParetoType2, type_v_268> AgradDistributionParetoType2_v_268;
+typedef std::tuple<AgradDistributionParetoType2, type_v_269> AgradDistributionParetoType2_v_269;
+typedef std::tuple<AgradDistributionParetoType2, type_v_270> AgradDistributionParetoType2_v_270;
+typedef std::tuple<AgradDistributionParetoType2, type_v_271> AgradDistributionParetoType2_v_271;
+typedef std::tuple<AgradDistributionParetoType2, type_v_272> AgradDistributionParetoType2_v_272;
+typedef std::tuple<AgradDistributionParetoType2, type_v_273> AgradDistributionParetoType2_v_273;
+typedef std::tuple<AgradDistributionParetoType2, type_v_274> AgradDistributionParetoType2_v_274;
+typedef std::tuple<AgradDistributionParetoType2, type_v_275> AgradDistributionParetoType2_v_275;
+typedef std::tuple<AgradDistributionParetoType2, type_v_276> AgradDistributionParetoType2_v_276;
+typedef std::tuple<AgradDistributionParetoType2, type_v_277> AgradDistributionParetoType2_v_277;
+typedef std::tuple<AgradDistributionParetoType2, type_v_278> AgradDistributionParetoType2_v_278;
+typedef std::tuple<AgradDistributionParetoType2, type_v_279> AgradDistributionParetoType2_v_279;
+typedef std::tuple<AgradDistributionParetoType2, type_v_280> AgradDistributionParetoType2_v_280;
+typedef std::tuple<AgradDistributionParetoType2, type_v_281> AgradDistributionParetoType2_v_281;
+typedef std::tuple<AgradDistributionParetoType2, type_v_282> AgradDistributionParetoType2_v_282;
+typedef std::tuple<AgradDistributionParetoType2, type_v_283> AgradDistributionParetoType2_v_283;
+typedef std::tuple<AgradDistributionParetoType2, type_v_284> AgradDistributionParetoType2_v_284;
+typedef std::tuple<AgradDistributionParetoType2, type_v_285> AgradDistributionParetoType2_v_285;
+typedef std::tuple<AgradDistributionParetoType2, type_v_286> AgradDistributionParetoType2_v_286;
+typedef std::tuple<AgradDistributionParetoType2, type_v_287> AgradDistributionParetoType2_v_287;
+typedef std::tuple<AgradDistributionParetoType2, type_v_288> AgradDistributionParetoType2_v_288;
+typedef std::tuple<AgradDistributionParetoType2, type_v_289> AgradDistributionParetoType2_v_289;
+typedef std::tuple<AgradDistributionParetoType2, type_v_290> AgradDistributionParetoType2_v_290;
+typedef std::tuple<AgradDistributionParetoType2, type_v_291> AgradDistributionParetoType2_v_291;
+typedef std::tuple<AgradDistributionParetoType2, type_v_292> AgradDistributionParetoType2_v_292;
+typedef std::tuple<AgradDistributionParetoType2, type_v_293> AgradDistributionParetoType2_v_293;
+typedef std::tuple<AgradDistributionParetoType2, type_v_294> AgradDistributionParetoType2_v_294;
+typedef std::tuple<AgradDistributionParetoType2, type_v_295> AgradDistributionParetoType2_v_295;
+typedef std::tuple<AgradDistributionParetoType2, type_v_296> AgradDistributionParetoType2_v_296;
+typedef std::tuple<AgradDistributionParetoType2, type_v_297> AgradDistributionParetoType2_v_297;
+typedef std::tuple<AgradDistributionParetoType2, type_v_298> AgradDistributionParetoType2_v_298;
+typedef std::tuple<AgradDistributionParetoType2, type_v_299> AgradDistributionParetoType2_v_299;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_200, AgradDistributionTestFixture, AgradDistributionParetoType2_v_200);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_201, AgradDistributionTestFixture, AgradDistributionParetoType2_v_201);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_202, AgradDistributionTestFixture, AgradDistributionParetoType2_v_202);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_203, AgradDistributionTestFixture, AgradDistributionParetoType2_v_203);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_204, AgradDistributionTestFixture, AgradDistributionParetoType2_v_204);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_205, AgradDistributionTestFixture, AgradDistributionParetoType2_v_205);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_206, AgradDistributionTestFixture, AgradDistributionParetoType2_v_206);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_207, AgradDistributionTestFixture, AgradDistributionParetoType2_v_207);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_208, AgradDistributionTestFixture, AgradDistributionParetoType2_v_208);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_209, AgradDistributionTestFixture, AgradDistributionParetoType2_v_209);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_210, AgradDistributionTestFixture, AgradDistributionParetoType2_v_210);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_211, AgradDistributionTestFixture, AgradDistributionParetoType2_v_211);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_212, AgradDistributionTestFixture, AgradDistributionParetoType2_v_212);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_213, AgradDistributionTestFixture, AgradDistributionParetoType2_v_213);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_214, AgradDistributionTestFixture, AgradDistributionParetoType2_v_214);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_215, AgradDistributionTestFixture, AgradDistributionParetoType2_v_215);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_216, AgradDistributionTestFixture, AgradDistributionParetoType2_v_216);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_217, AgradDistributionTestFixture, AgradDistributionParetoType2_v_217);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_218, AgradDistributionTestFixture, AgradDistributionParetoType2_v_218);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_219, AgradDistributionTestFixture, AgradDistributionParetoType2_v_219);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_220, AgradDistributionTestFixture, AgradDistributionParetoType2_v_220);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_221, AgradDistributionTestFixture, AgradDistributionParetoType2_v_221);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_222, AgradDistributionTestFixture, AgradDistributionParetoType2_v_222);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_223, AgradDistributionTestFixture, AgradDistributionParetoType2_v_223);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_224, AgradDistributionTestFixture, AgradDistributionParetoType2_v_224);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_225, AgradDistributionTestFixture, AgradDistributionParetoType2_v_225);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_226, AgradDistributionTestFixture, AgradDistributionParetoType2_v_226);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_227, AgradDistributionTestFixture, AgradDistributionParetoType2_v_227);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_228, AgradDistributionTestFixture, AgradDistributionParetoType2_v_228);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_229, AgradDistributionTestFixture, AgradDistributionParetoType2_v_229);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_230, AgradDistributionTestFixture, AgradDistributionParetoType2_v_230);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_231, AgradDistributionTestFixture, AgradDistributionParetoType2_v_231);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_232, AgradDistributionTestFixture, AgradDistributionParetoType2_v_232);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_233, AgradDistributionTestFixture, AgradDistributionParetoType2_v_233);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_234, AgradDistributionTestFixture, AgradDistributionParetoType2_v_234);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_235, AgradDistributionTestFixture, AgradDistributionParetoType2_v_235);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_236, AgradDistributionTestFixture, AgradDistributionParetoType2_v_236);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_237, AgradDistributionTestFixture, AgradDistributionParetoType2_v_237);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_238, AgradDistributionTestFixture, AgradDistributionParetoType2_v_238);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_239, AgradDistributionTestFixture, AgradDistributionParetoType2_v_239);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_240, AgradDistributionTestFixture, AgradDistributionParetoType2_v_240);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_241, AgradDistributionTestFixture, AgradDistributionParetoType2_v_241);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_242, AgradDistributionTestFixture, AgradDistributionParetoType2_v_242);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_243, AgradDistributionTestFixture, AgradDistributionParetoType2_v_243);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_244, AgradDistributionTestFixture, AgradDistributionParetoType2_v_244);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_245, AgradDistributionTestFixture, AgradDistributionParetoType2_v_245);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_246, AgradDistributionTestFixture, AgradDistributionParetoType2_v_246);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_247, AgradDistributionTestFixture, AgradDistributionParetoType2_v_247);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_248, AgradDistributionTestFixture, AgradDistributionParetoType2_v_248);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_249, AgradDistributionTestFixture, AgradDistributionParetoType2_v_249);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_250, AgradDistributionTestFixture, AgradDistributionParetoType2_v_250);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_251, AgradDistributionTestFixture, AgradDistributionParetoType2_v_251);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_252, AgradDistributionTestFixture, AgradDistributionParetoType2_v_252);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_253, AgradDistributionTestFixture, AgradDistributionParetoType2_v_253);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_254, AgradDistributionTestFixture, AgradDistributionParetoType2_v_254);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_255, AgradDistributionTestFixture, AgradDistributionParetoType2_v_255);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_256, AgradDistributionTestFixture, AgradDistributionParetoType2_v_256);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_257, AgradDistributionTestFixture, AgradDistributionParetoType2_v_257);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_258, AgradDistributionTestFixture, AgradDistributionParetoType2_v_258);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_259, AgradDistributionTestFixture, AgradDistributionParetoType2_v_259);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_260, AgradDistributionTestFixture, AgradDistributionParetoType2_v_260);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_261, AgradDistributionTestFixture, AgradDistributionParetoType2_v_261);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_262, AgradDistributionTestFixture, AgradDistributionParetoType2_v_262);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_263, AgradDistributionTestFixture, AgradDistributionParetoType2_v_263);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_264, AgradDistributionTestFixture, AgradDistributionParetoType2_v_264);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_265, AgradDistributionTestFixture, AgradDistributionParetoType2_v_265);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_266, AgradDistributionTestFixture, AgradDistributionParetoType2_v_266);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_267, AgradDistributionTestFixture, AgradDistributionParetoType2_v_267);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_268, AgradDistributionTestFixture, AgradDistributionParetoType2_v_268);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_269, AgradDistributionTestFixture, AgradDistributionParetoType2_v_269);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_270, AgradDistributionTestFixture, AgradDistributionParetoType2_v_270);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_271, AgradDistributionTestFixture, AgradDistributionParetoType2_v_271);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_272, AgradDistributionTestFixture, AgradDistributionParetoType2_v_272);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_273, AgradDistributionTestFixture, AgradDistributionParetoType2_v_273);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_274, AgradDistributionTestFixture, AgradDistributionParetoType2_v_274);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_275, AgradDistributionTestFixture, AgradDistributionParetoType2_v_275);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_276, AgradDistributionTestFixture, AgradDistributionParetoType2_v_276);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_277, AgradDistributionTestFixture, AgradDistributionParetoType2_v_277);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_278, AgradDistributionTestFixture, AgradDistributionParetoType2_v_278);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_279, AgradDistributionTestFixture, AgradDistributionParetoType2_v_279);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_280, AgradDistributionTestFixture, AgradDistributionParetoType2_v_280);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_281, AgradDistributionTestFixture, AgradDistributionParetoType2_v_281);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_282, AgradDistributionTestFixture, AgradDistributionParetoType2_v_282);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_283, AgradDistributionTestFixture, AgradDistributionParetoType2_v_283);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_284, AgradDistributionTestFixture, AgradDistributionParetoType2_v_284);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_285, AgradDistributionTestFixture, AgradDistributionParetoType2_v_285);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_286, AgradDistributionTestFixture, AgradDistributionParetoType2_v_286);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_287, AgradDistributionTestFixture, AgradDistributionParetoType2_v_287);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_288, AgradDistributionTestFixture, AgradDistributionParetoType2_v_288);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_289, AgradDistributionTestFixture, AgradDistributionParetoType2_v_289);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_290, AgradDistributionTestFixture, AgradDistributionParetoType2_v_290);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_291, AgradDistributionTestFixture, AgradDistributionParetoType2_v_291);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_292, AgradDistributionTestFixture, AgradDistributionParetoType2_v_292);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_293, AgradDistributionTestFixture, AgradDistributionParetoType2_v_293);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_294, AgradDistributionTestFixture, AgradDistributionParetoType2_v_294);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_295, AgradDistributionTestFixture, AgradDistributionParetoType2_v_295);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_296, AgradDistributionTestFixture, AgradDistributionParetoType2_v_296);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_297, AgradDistributionTestFixture, AgradDistributionParetoType2_v_297);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_298, AgradDistributionTestFixture, AgradDistributionParetoType2_v_298);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_299, AgradDistributionTestFixture, AgradDistributionParetoType2_v_299);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_test.hpp>
+
+typedef std::tuple<std::vector<double>, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_200;
+typedef std::tuple<std::vector<double>, double, var, var, empty, empty> type_vv_201;
+typedef std::tuple<std::vector<double>, double, var, std::vector<var>, empty, empty> type_vv_202;
+typedef std::tuple<std::vector<double>, double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_203;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, double, empty, empty> type_vv_204;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, std::vector<double>, empty, empty> type_vv_205;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_206;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, var, empty, empty> type_vv_207;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, std::vector<var>, empty, empty> type_vv_208;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_209;
+typedef std::tuple<std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_210;
+typedef std::tuple<std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_211;
+typedef std::tuple<std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_212;
+typedef std::tuple<std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_213;
+typedef std::tuple<std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_214;
+typedef std::tuple<std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_215;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, var, empty, empty> type_vv_216;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, std::vector<var>, empty, empty> type_vv_217;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_218;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, var, empty, empty> type_vv_219;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_vv_220;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_221;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_222;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_223;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_224;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, double, empty, empty> type_vv_225;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, std::vector<double>, empty, empty> type_vv_226;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_227;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, var, empty, empty> type_vv_228;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, std::vector<var>, empty, empty> type_vv_229;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_230;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, double, empty, empty> type_vv_231;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_vv_232;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_233;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, var, empty, empty> type_vv_234;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_vv_235;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_236;
+typedef std::tuple<std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_237;
+typedef std::tuple<std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_238;
+typedef std::tuple<std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_239;
+typedef std::tuple<std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_240;
+typedef std::tuple<std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_241;
+typedef std::tuple<std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_242;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_vv_243;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_vv_244;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_245;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_vv_246;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_vv_247;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_248;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_249;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_250;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_251;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_vv_252;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_vv_253;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_254;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_vv_255;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_vv_256;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_257;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_vv_258;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_vv_259;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_260;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_vv_261;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_vv_262;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_263;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_264;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_265;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_266;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_267;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_268;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_269;
+typedef std::tuple<std::vector<double>, var, double, double, empty, empty> type_vv_270;
+typedef std::tuple<std::vector<double>, var, double, std::vector<double>, empty, empty> type_vv_271;
+typedef std::tuple<std::vector<double>, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_272;
+typedef std::tuple<std::vector<double>, var, double, var, empty, empty> type_vv_273;
+typedef std::tuple<std::vector<double>, var, double, std::vector<var>, empty, empty> type_vv_274;
+typedef std::tuple<std::vector<double>, var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_275;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, double, empty, empty> type_vv_276;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, std::vector<double>, empty, empty> type_vv_277;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_278;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, var, empty, empty> type_vv_279;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, std::vector<var>, empty, empty> type_vv_280;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_281;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_282;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_283;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_284;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_285;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_286;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_287;
+typedef std::tuple<std::vector<double>, var, var, double, empty, empty> type_vv_288;
+typedef std::tuple<std::vector<double>, var, var, std::vector<double>, empty, empty> type_vv_289;
+typedef std::tuple<std::vector<double>, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_290;
+typedef std::tuple<std::vector<double>, var, var, var, empty, empty> type_vv_291;
+typedef std::tuple<std::vector<double>, var, var, std::vector<var>, empty, empty> type_vv_292;
+typedef std::tuple<std::vector<double>, var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_293;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, double, empty, empty> type_vv_294;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, std::vector<double>, empty, empty> type_vv_295;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_296;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, var, empty, empty> type_vv_297;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, std::vector<var>, empty, empty> type_vv_298;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_299;
+
+typedef std::tuple<AgradDistributionParetoType2, type_vv_200> AgradDistributionParetoType2_vv_200;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_201> AgradDistributionParetoType2_vv_201;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_202> AgradDistributionParetoType2_vv_202;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_203> AgradDistributionParetoType2_vv_203;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_204> AgradDistributionParetoType2_vv_204;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_205> AgradDistributionParetoType2_vv_205;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_206> AgradDistributionParetoType2_vv_206;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_207> AgradDistributionParetoType2_vv_207;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_208> AgradDistributionParetoType2_vv_208;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_209> AgradDistributionParetoType2_vv_209;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_210> AgradDistributionParetoType2_vv_210;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_211> AgradDistributionParetoType2_vv_211;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_212> AgradDistributionParetoType2_vv_212;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_213> AgradDistributionParetoType2_vv_213;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_214> AgradDistributionParetoType2_vv_214;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_215> AgradDistributionParetoType2_vv_215;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_216> AgradDistributionParetoType2_vv_216;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_217> AgradDistributionParetoType2_vv_217;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_218> AgradDistributionParetoType2_vv_218;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_219> AgradDistributionParetoType2_vv_219;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_220> AgradDistributionParetoType2_vv_220;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_221> AgradDistributionParetoType2_vv_221;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_222> AgradDistributionParetoType2_vv_222;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_223> AgradDistributionParetoType2_vv_223;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_224> AgradDistributionParetoType2_vv_224;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_225> AgradDistributionParetoType2_vv_225;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_226> AgradDistributionParetoType2_vv_226;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_227> AgradDistributionParetoType2_vv_227;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_228> AgradDistributionParetoType2_vv_228;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_229> AgradDistributionParetoType2_vv_229;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_230> AgradDistributionParetoType2_vv_230;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_231> AgradDistributionParetoType2_vv_231;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_232> AgradDistributionParetoType2_vv_232;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_233> AgradDistributionParetoType2_vv_233;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_234> AgradDistributionParetoType2_vv_234;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_235> AgradDistributionParetoType2_vv_235;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_236> AgradDistributionParetoType2_vv_236;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_237> AgradDistributionParetoType2_vv_237;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_238> AgradDistributionParetoType2_vv_238;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_239> AgradDistributionParetoType2_vv_239;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_240> AgradDistributionParetoType2_vv_240;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_241> AgradDistributionParetoType2_vv_241;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_242> AgradDistributionParetoType2_vv_242;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_243> AgradDistributionParetoType2_vv_243;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_244> AgradDistributionParetoType2_vv_244;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_245> AgradDistributionParetoType2_vv_245;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_246> AgradDistributionParetoType2_vv_246;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_247> AgradDistributionParetoType2_vv_247;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_248> AgradDistributionParetoType2_vv_248;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_249> AgradDistributionParetoType2_vv_249;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_250> AgradDistributionParetoType2_vv_250;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_251> AgradDistributionParetoType2_vv_251;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_252> AgradDistributionParetoType2_vv_252;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_253> AgradDistributionParetoType2_vv_253;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_254> AgradDistributionParetoType2_vv_254;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_255> AgradDistributionParetoType2_vv_255;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_256> AgradDistributionParetoType2_vv_256;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_257> AgradDistributionParetoType2_vv_257;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_258> AgradDistributionParetoType2_vv_258;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_259> AgradDistributionParetoType2_vv_259;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_260> AgradDistributionParetoType2_vv_260;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_261> AgradDistributionParetoType2_vv_261;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_262> AgradDistributionParetoType2_vv_262;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_263> AgradDistributionParetoType2_vv_263;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_264> AgradDistributionParetoType2_vv_264;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_265> AgradDistributionParetoType2_vv_265;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_266> AgradDistributionParetoType2_vv_266;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_267> AgradDistributionParetoType2_vv_267;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_268> AgradDistributionParetoType2_vv_268;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_269> AgradDistributionParetoType2_vv_269;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_270> AgradDistributionParetoType2_vv_270;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_271> AgradDistributionParetoType2_vv_271;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_272> AgradDistributionParetoType2_vv_272;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_273> AgradDistributionParetoType2_vv_273;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_274> AgradDistributionParetoType2_vv_274;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_275> AgradDistributionParetoType2_vv_275;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_276> AgradDistributionParetoType2_vv_276;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_277> AgradDistributionParetoType2_vv_277;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_278> AgradDistributionParetoType2_vv_278;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_279> AgradDistributionParetoType2_vv_279;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_280> AgradDistributionParetoType2_vv_280;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_281> AgradDistributionParetoType2_vv_281;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_282> AgradDistributionParetoType2_vv_282;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_283> AgradDistributionParetoType2_vv_283;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_284> AgradDistributionParetoType2_vv_284;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_285> AgradDistributionParetoType2_vv_285;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_286> AgradDistributionParetoType2_vv_286;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_287> AgradDistributionParetoType2_vv_287;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_288> AgradDistributionParetoType2_vv_288;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_289> AgradDistributionParetoType2_vv_289;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_290> AgradDistributionParetoType2_vv_290;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_291> AgradDistributionParetoType2_vv_291;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_292> AgradDistributionParetoType2_vv_292;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_293> AgradDistributionParetoType2_vv_293;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_294> AgradDistributionParetoType2_vv_294;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_295> AgradDistributionParetoType2_vv_295;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_296> AgradDistributionParetoType2_vv_296;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_297> AgradDistributionParetoType2_vv_297;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_298> AgradDistributionParetoType2_vv_298;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_299> AgradDistributionParetoType2_vv_299;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_200, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_200);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_201, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_201);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_202, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_202);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_203, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_203);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_204, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_204);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_205, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_205);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_206, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_206);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_207, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_207);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_208, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_208);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_209, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_209);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_210, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_210);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_211, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_211);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_212, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_212);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_213, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_213);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_214, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_214);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_215, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_215);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_216, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_216);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_217, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_217);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_218, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_218);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_219, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_219);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_220, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_220);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_221, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_221);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_222, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_222);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_223, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_223);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_224, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_224);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_225, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_225);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_226, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_226);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_227, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_227);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_228, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_228);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_229, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_229);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_230, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_230);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_231, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_231);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_232, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_232);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_233, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_233);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_234, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_234);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_235, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_235);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_236, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_236);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_237, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_237);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_238, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_238);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_239, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_239);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_240, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_240);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_241, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_241);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_242, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_242);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_243, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_243);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_244, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_244);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_245, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_245);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_246, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_246);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_247, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_247);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_248, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_248);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_249, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_249);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_250, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_250);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_251, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_251);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_252, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_252);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_253, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_253);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_254, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_254);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_255, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_255);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_256, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_256);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_257, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_257);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_258, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_258);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_259, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_259);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_260, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_260);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_261, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_261);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_262, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_262);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_263, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_263);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_264, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_264);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_265, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_265);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_266, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_266);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_267, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_267);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_268, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_268);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_269, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_269);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_270, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_270);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_271, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_271);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_272, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_272);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_273, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_273);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_274, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_274);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_275, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_275);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_276, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_276);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_277, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_277);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_278, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_278);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_279, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_279);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_280, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_280);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_281, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_281);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_282, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_282);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_283, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_283);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_284, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_284);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_285, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_285);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_286, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_286);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_287, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_287);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_288, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_288);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_289, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_289);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_290, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_290);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_291, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_291);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_292, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_292);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_293, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_293);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_294, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_294);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_295, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_295);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_296, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_296);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_297, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_297);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_298, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_298);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_299, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_299);
+
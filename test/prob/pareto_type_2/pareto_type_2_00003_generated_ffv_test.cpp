@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_test.hpp>
+
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_300;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_301;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_302;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_303;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_304;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_305;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, double, double, empty, empty> type_ffv_306;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty, empty> type_ffv_307;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_308;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty, empty> type_ffv_309;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_310;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_311;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty, empty> type_ffv_312;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_313;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_314;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_315;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_316;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_317;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_318;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_319;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_320;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_321;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_322;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_323;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty, empty> type_ffv_324;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_325;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_326;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_327;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_328;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_329;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_330;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_331;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_332;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_333;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_334;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_335;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_336;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_337;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_338;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_339;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_340;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_341;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty, empty> type_ffv_342;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_ffv_343;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_344;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_345;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_346;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_347;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_ffv_348;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_349;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_350;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_351;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_352;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_353;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_354;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_355;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_356;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_357;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_358;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_359;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_360;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_361;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_362;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_363;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_364;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_365;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_366;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_367;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_368;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_369;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_370;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_371;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_372;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_373;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_374;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_375;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_376;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_377;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, fvar<fvar<var> >, empty, empty> type_ffv_378;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_379;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_380;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_381;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_382;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_383;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_384;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_385;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_386;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, double, empty, empty> type_ffv_387;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_388;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_389;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_390;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_391;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_392;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_393;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_394;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_395;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_396;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_397;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_398;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_399;
+
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_300> AgradDistributionParetoType2_ffv_300;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_301> AgradDistributionParetoType2_ffv_301;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_302> AgradDistributionParetoType2_ffv_302;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_303> AgradDistributionParetoType2_ffv_303;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_304> AgradDistributionParetoType2_ffv_304;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_305> AgradDistributionParetoType2_ffv_305;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_306> AgradDistributionParetoType2_ffv_306;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_307> AgradDistributionParetoType2_ffv_307;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_308> AgradDistributionParetoType2_ffv_308;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_309> AgradDistributionParetoType2_ffv_309;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_310> AgradDistributionParetoType2_ffv_310;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_311> AgradDistributionParetoType2_ffv_311;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_312> AgradDistributionParetoType2_ffv_312;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_313> AgradDistributionParetoType2_ffv_313;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_314> AgradDistributionParetoType2_ffv_314;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_315> AgradDistributionParetoType2_ffv_315;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_316> AgradDistributionParetoType2_ffv_316;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_317> AgradDistributionParetoType2_ffv_317;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_318> AgradDistributionParetoType2_ffv_318;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_319> AgradDistributionParetoType2_ffv_319;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_320> AgradDistributionParetoType2_ffv_320;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_321> AgradDistributionParetoType2_ffv_321;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_322> AgradDistributionParetoType2_ffv_322;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_323> AgradDistributionParetoType2_ffv_323;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_324> AgradDistributionParetoType2_ffv_324;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_325> AgradDistributionParetoType2_ffv_325;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_326> AgradDistributionParetoType2_ffv_326;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_327> AgradDistributionParetoType2_ffv_327;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_328> AgradDistributionParetoType2_ffv_328;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_329> AgradDistributionParetoType2_ffv_329;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_330> AgradDistributionParetoType2_ffv_330;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_331> AgradDistributionParetoType2_ffv_331;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_332> AgradDistributionParetoType2_ffv_332;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_333> AgradDistributionParetoType2_ffv_333;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_334> AgradDistributionParetoType2_ffv_334;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_335> AgradDistributionParetoType2_ffv_335;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_336> AgradDistributionParetoType2_ffv_336;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_337> AgradDistributionParetoType2_ffv_337;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_338> AgradDistributionParetoType2_ffv_338;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_339> AgradDistributionParetoType2_ffv_339;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_340> AgradDistributionParetoType2_ffv_340;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_341> AgradDistributionParetoType2_ffv_341;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_342> AgradDistributionParetoType2_ffv_342;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_343> AgradDistributionParetoType2_ffv_343;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_344> AgradDistributionParetoType2_ffv_344;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_345> AgradDistributionParetoType2_ffv_345;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_346> AgradDistributionParetoType2_ffv_346;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_347> AgradDistributionParetoType2_ffv_347;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_348> AgradDistributionParetoType2_ffv_348;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_349> AgradDistributionParetoType2_ffv_349;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_350> AgradDistributionParetoType2_ffv_350;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_351> AgradDistributionParetoType2_ffv_351;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_352> AgradDistributionParetoType2_ffv_352;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_353> AgradDistributionParetoType2_ffv_353;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_354> AgradDistributionParetoType2_ffv_354;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_355> AgradDistributionParetoType2_ffv_355;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_356> AgradDistributionParetoType2_ffv_356;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_357> AgradDistributionParetoType2_ffv_357;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_358> AgradDistributionParetoType2_ffv_358;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_359> AgradDistributionParetoType2_ffv_359;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_360> AgradDistributionParetoType2_ffv_360;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_361> AgradDistributionParetoType2_ffv_361;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_362> AgradDistributionParetoType2_ffv_362;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_363> AgradDistributionParetoType2_ffv_363;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_364> AgradDistributionParetoType2_ffv_364;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_365> AgradDistributionParetoType2_ffv_365;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_366> AgradDistributionParetoType2_ffv_366;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_367> AgradDistributionParetoType2_ffv_367;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_368> AgradDistributionParetoType2_ffv_368;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_369> AgradDistributionParetoType2_ffv_369;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_370> AgradDistributionParetoType2_ffv_370;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_371> AgradDistributionParetoType2_ffv_371;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_372> AgradDistributionParetoType2_ffv_372;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_373> AgradDistributionParetoType2_ffv_373;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_374> AgradDistributionParetoType2_ffv_374;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_375> AgradDistributionParetoType2_ffv_375;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_376> AgradDistributionParetoType2_ffv_376;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_377> AgradDistributionParetoType2_ffv_377;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_378> AgradDistributionParetoType2_ffv_378;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_379> AgradDistributionParetoType2_ffv_379;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_380> AgradDistributionParetoType2_ffv_380;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_381> AgradDistributionParetoType2_ffv_381;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_382> AgradDistributionParetoType2_ffv_382;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_383> AgradDistributionParetoType2_ffv_383;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_384> AgradDistributionParetoType2_ffv_384;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_385> AgradDistributionParetoType2_ffv_385;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_386> AgradDistributionParetoType2_ffv_386;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_387> AgradDistributionParetoType2_ffv_387;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_388> AgradDistributionParetoType2_ffv_388;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_389> AgradDistributionParetoType2_ffv_389;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_390> AgradDistributionParetoType2_ffv_390;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_391> AgradDistributionParetoType2_ffv_391;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_392> AgradDistributionParetoType2_ffv_392;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_393> AgradDistributionParetoType2_ffv_393;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_394> AgradDistributionParetoType2_ffv_394;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_395> AgradDistributionParetoType2_ffv_395;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_396> AgradDistributionParetoType2_ffv_396;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_397> AgradDistributionParetoType2_ffv_397;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_398> AgradDistributionParetoType2_ffv_398;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_399> AgradDistributionParetoType2_ffv_399;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_300, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_300);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_301, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_301);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_302, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_302);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_303, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_303);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_304, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_304);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_305, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_305);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_306, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_306);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_307, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_307);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_308, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_308);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_309, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_309);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_310, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_310);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_311, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_311);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_312, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_312);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_313, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_313);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_314, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_314);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_315, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_315);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_316, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_316);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_317, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_317);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_318, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_318);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_319, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_319);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_320, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_320);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_321, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_321);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_322, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_322);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_323, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_323);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_324, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_324);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_325, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_325);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_326, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_326);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_327, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_327);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_328, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_328);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_329, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_329);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_330, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_330);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_331, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_331);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_332, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_332);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_333, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_333);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_334, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_334);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_335, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_335);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_336, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_336);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_337, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_337);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_338, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_338);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_339, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_339);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_340, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_340);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_341, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_341);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_342, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_342);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_343, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_343);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_344, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_344);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_345, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_345);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_346, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_346);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_347, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_347);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_348, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_348);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_349, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_349);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_350, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_350);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_351, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_351);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_352, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_352);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_353, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_353);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_354, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_354);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_355, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_355);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_356, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_356);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_357, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_357);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_358, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_358);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_359, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_359);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_360, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_360);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_361, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_361);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_362, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_362);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_363, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_363);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_364, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_364);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_365, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_365);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_366, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_366);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_367, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_367);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_368, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_368);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_369, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_369);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_370, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_370);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_371, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_371);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_372, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_372);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_373, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_373);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_374, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_374);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_375, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_375);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_376, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_376);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_377, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_377);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_378, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_378);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_379, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_379);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_380, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_380);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_381, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_381);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_382, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_382);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_383, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_383);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_384, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_384);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_385, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_385);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_386, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_386);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_387, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_387);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_388, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_388);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_389, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_389);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_390, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_390);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_391, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_391);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_392, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_392);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_393, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_393);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_394, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_394);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_395, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_395);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_396, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_396);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_397, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_397);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_398, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_398);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_399, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_399);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_test.hpp>
+
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_300;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_301;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_302;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_303;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_304;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_305;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_306;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_307;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_308;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_309;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_310;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_311;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_312;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_313;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_314;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_315;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_316;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_317;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_318;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_319;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_320;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_321;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_322;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_323;
+typedef std::tuple<std::vector<double>, var, double, double, empty, empty> type_v_324;
+typedef std::tuple<std::vector<double>, var, double, std::vector<double>, empty, empty> type_v_325;
+typedef std::tuple<std::vector<double>, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_326;
+typedef std::tuple<std::vector<double>, var, double, var, empty, empty> type_v_327;
+typedef std::tuple<std::vector<double>, var, double, std::vector<var>, empty, empty> type_v_328;
+typedef std::tuple<std::vector<double>, var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_329;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, double, empty, empty> type_v_330;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, std::vector<double>, empty, empty> type_v_331;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_332;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, var, empty, empty> type_v_333;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, std::vector<var>, empty, empty> type_v_334;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_335;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_336;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_337;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_338;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_339;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_340;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_341;
+typedef std::tuple<std::vector<double>, var, var, double, empty, empty> type_v_342;
+typedef std::tuple<std::vector<double>, var, var, std::vector<double>, empty, empty> type_v_343;
+typedef std::tuple<std::vector<double>, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_344;
+typedef std::tuple<std::vector<double>, var, var, var, empty, empty> type_v_345;
+typedef std::tuple<std::vector<double>, var, var, std::vector<var>, empty, empty> type_v_346;
+typedef std::tuple<std::vector<double>, var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_347;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, double, empty, empty> type_v_348;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, std::vector<double>, empty, empty> type_v_349;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_350;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, var, empty, empty> type_v_351;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, std::vector<var>, empty, empty> type_v_352;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_353;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_354;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_355;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_356;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_357;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_358;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_359;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, double, empty, empty> type_v_360;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, std::vector<double>, empty, empty> type_v_361;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_362;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, var, empty, empty> type_v_363;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, std::vector<var>, empty, empty> type_v_364;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_365;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, double, empty, empty> type_v_366;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_v_367;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_368;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, var, empty, empty> type_v_369;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_v_370;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_371;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_372;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_373;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_374;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_375;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_376;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_377;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, double, empty, empty> type_v_378;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, std::vector<double>, empty, empty> type_v_379;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_380;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, var, empty, empty> type_v_381;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, std::vector<var>, empty, empty> type_v_382;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_383;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, double, empty, empty> type_v_384;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_v_385;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_386;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, var, empty, empty> type_v_387;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_v_388;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_389;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_390;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_391;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_392;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_393;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_394;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_395;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_396;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_397;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_398;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_399;
+
+typedef std::tuple<AgradDistributionParetoType2, type_v_300> AgradDistributionParetoType2_v_300;
+typedef std::tuple<AgradDistributionParetoType2, type_v_301> AgradDistributionParetoType2_v_301;
+typedef std::tuple<AgradDistributionParetoType2, type_v_302> AgradDistributionParetoType2_v_302;
+typedef std::tuple<AgradDistributionParetoType2, type_v_303> AgradDistributionParetoType2_v_303;
+typedef std::tuple<AgradDistributionParetoType2, type_v_304> AgradDistributionParetoType2_v_304;
+typedef std::tuple<AgradDistributionParetoType2, type_v_305> AgradDistributionParetoType2_v_305;
+typedef std::tuple<AgradDistributionParetoType2, type_v_306> AgradDistributionParetoType2_v_306;
+typedef std::tuple<AgradDistributionParetoType2, type_v_307> AgradDistributionParetoType2_v_307;
+typedef std::tuple<AgradDistributionParetoType2, type_v_308> AgradDistributionParetoType2_v_308;
+typedef std::tuple<AgradDistributionParetoType2, type_v_309> AgradDistributionParetoType2_v_309;
+typedef std::tuple<AgradDistributionParetoType2, type_v_310> AgradDistributionParetoType2_v_310;
+typedef std::tuple<AgradDistributionParetoType2, type_v_311> AgradDistributionParetoType2_v_311;
+typedef std::tuple<AgradDistributionParetoType2, type_v_312> AgradDistributionParetoType2_v_312;
+typedef std::tuple<AgradDistributionParetoType2, type_v_313> AgradDistributionParetoType2_v_313;
+typedef std::tuple<AgradDistributionParetoType2, type_v_314> AgradDistributionParetoType2_v_314;
+typedef std::tuple<AgradDistributionParetoType2, type_v_315> AgradDistributionParetoType2_v_315;
+typedef std::tuple<AgradDistributionParetoType2, type_v_316> AgradDistributionParetoType2_v_316;
+typedef std::tuple<AgradDistributionParetoType2, type_v_317> AgradDistributionParetoType2_v_317;
+typedef std::tuple<AgradDistributionParetoType2, type_v_318> AgradDistributionParetoType2_v_318;
+typedef std::tuple<AgradDistributionParetoType2, type_v_319> AgradDistributionParetoType2_v_319;
+typedef std::tuple<AgradDistributionParetoType2, type_v_320> AgradDistributionParetoType2_v_320;
+typedef std::tuple<AgradDistributionParetoType2, type_v_321> AgradDistributionParetoType2_v_321;
+typedef std::tuple<AgradDistributionParetoType2, type_v_322> AgradDistributionParetoType2_v_322;
+typedef std::tuple<AgradDistributionParetoType2, type_v_323> AgradDistributionParetoType2_v_323;
+typedef std::tuple<AgradDistributionParetoType2, type_v_324> AgradDistributionParetoType2_v_324;
+typedef std::tuple<AgradDistributionParetoType2, type_v_325> AgradDistributionParetoType2_v_325;
+typedef std::tuple<AgradDistributionParetoType2, type_v_326> AgradDistributionParetoType2_v_326;
+typedef std::tuple<AgradDistributionParetoType2, type_v_327> AgradDistributionParetoType2_v_327;
+typedef std::tuple<AgradDistributionParetoType2, type_v_328> AgradDistributionParetoType2_v_328;
+typedef std::tuple<AgradDistributionParetoType2, type_v_329> AgradDistributionParetoType2_v_329;
+typedef std::tuple<AgradDistributionParetoType2, type_v_330> AgradDistributionParetoType2_v_330;
+typedef std::tuple<AgradDistributionParetoType2, type_v_331> AgradDistributionParetoType2_v_331;
+typedef std::tuple<AgradDistributionParetoType2, type_v_332> AgradDistributionParetoType2_v_332;
+typedef std::tuple<AgradDistributionParetoType2, type_v_333> AgradDistributionParetoType2_v_333;
+typedef std::tuple<AgradDistributionParetoType2, type_v_334> AgradDistributionParetoType2_v_334;
+typedef std::tuple<AgradDistributionParetoType2, type_v_335> AgradDistributionParetoType2_v_335;
+typedef std::tuple<AgradDistributionParetoType2, type_v_336> AgradDistributionParetoType2_v_336;
+typedef std::tuple<AgradDistributionParetoType2, type_v_337> AgradDistributionParetoType2_v_337;
+typedef std::tuple<AgradDistributionParetoType2, type_v_338> AgradDistributionParetoType2_v_338;
+typedef std::tuple<AgradDistributionParetoType2, type_v_339> AgradDistributionParetoType2_v_339;
+typedef std::tuple<AgradDistributionParetoType2, type_v_340> AgradDistributionParetoType2_v_340;
+typedef std::tuple<AgradDistributionParetoType2, type_v_341> AgradDistributionParetoType2_v_341;
+typedef std::tuple<AgradDistributionParetoType2, type_v_342> AgradDistributionParetoType2_v_342;
+typedef std::tuple<AgradDistributionParetoType2, type_v_343> AgradDistributionParetoType2_v_343;
+typedef std::tuple<AgradDistributionParetoType2, type_v_344> AgradDistributionParetoType2_v_344;
+typedef std::tuple<AgradDistributionParetoType2, type_v_345> AgradDistributionParetoType2_v_345;
+typedef std::tuple<AgradDistributionParetoType2, type_v_346> AgradDistributionParetoType2_v_346;
+typedef std::tuple<AgradDistributionParetoType2, type_v_347> AgradDistributionParetoType2_v_347;
+typedef std::tuple<AgradDistributionParetoType2, type_v_348> AgradDistributionParetoType2_v_348;
+typedef std::tuple<AgradDistributionParetoType2, type_v_349> AgradDistributionParetoType2_v_349;
+typedef std::tuple<AgradDistributionParetoType2, type_v_350> AgradDistributionParetoType2_v_350;
+typedef std::tuple<AgradDistributionParetoType2, type_v_351> AgradDistributionParetoType2_v_351;
+typedef std::tuple<AgradDistributionParetoType2, type_v_352> AgradDistributionParetoType2_v_352;
+typedef std::tuple<AgradDistributionParetoType2, type_v_353> AgradDistributionParetoType2_v_353;
+typedef std::tuple<AgradDistributionParetoType2, type_v_354> AgradDistributionParetoType2_v_354;
+typedef std::tuple<AgradDistributionParetoType2, type_v_355> AgradDistributionParetoType2_v_355;
+typedef std::tuple<AgradDistributionParetoType2, type_v_356> AgradDistributionParetoType2_v_356;
+typedef std::tuple<AgradDistributionParetoType2, type_v_357> AgradDistributionParetoType2_v_357;
+typedef std::tuple<AgradDistributionParetoType2, type_v_358> AgradDistributionParetoType2_v_358;
+typedef std::tuple<AgradDistributionParetoType2, type_v_359> AgradDistributionParetoType2_v_359;
+typedef std::tuple<AgradDistributionParetoType2, type_v_360> AgradDistributionParetoType2_v_360;
+typedef std::tuple<AgradDistributionParetoType2, type_v_361> AgradDistributionParetoType2_v_361;
+typedef std::tuple<AgradDistributionParetoType2, type_v_362> AgradDistributionParetoType2_v_362;
+typedef std::tuple<AgradDistributionParetoType2, type_v_363> AgradDistributionParetoType2_v_363;
+typedef std::tuple<AgradDistributionParetoType2, type_v_364> AgradDistributionParetoType2_v_364;
+typedef std::tuple<AgradDistributionParetoType2, type_v_365> AgradDistributionParetoType2_v_365;
+typedef std::tuple<AgradDistributionParetoType2, type_v_366> AgradDistributionParetoType2_v_366;
+typedef std::tuple<AgradDistributionParetoType2, type_v_367> AgradDistributionParetoType2_v_367;
+typedef std::tuple<AgradDistributionParetoType2, type_v_368> AgradDistributionParetoType2_v_368;
+typedef std::tuple<AgradDistributionParetoType2, type_v_369> AgradDistributionParetoType2_v_369;
+typedef std::tuple<AgradDistributionParetoType2, type_v_370> AgradDistributionParetoType2_v_370;
+typedef std::tuple<AgradDistributionParetoType2, type_v_371> AgradDistributionParetoType2_v_371;
+typedef std::tuple<AgradDistributionParetoType2, type_v_372> AgradDistributionParetoType2_v_372;
+typedef std::tuple<AgradDistributionParetoType2, type_v_373> AgradDistributionParetoType2_v_373;
+typedef std::tuple<AgradDistributionParetoType2, type_v_374> AgradDistributionParetoType2_v_374;
+typedef std::tuple<AgradDistributionParetoType2, type_v_375> AgradDistributionParetoType2_v_375;
+typedef std::tuple<AgradDistributionParetoType2, type_v_376> AgradDistributionParetoType2_v_376;
+typedef std::tuple<AgradDistributionParetoType2, type_v_377> AgradDistributionParetoType2_v_377;
+typedef std::tuple<AgradDistributionParetoType2, type_v_378> AgradDistributionParetoType2_v_378;
+typedef std::tuple<AgradDistributionParetoType2, type_v_379> AgradDistributionParetoType2_v_379;
+typedef std::tuple<AgradDistributionParetoType2, type_v_380> AgradDistributionParetoType2_v_380;
+typedef std::tuple<AgradDistributionParetoType2, type_v_381> AgradDistributionParetoType2_v_381;
+typedef std::tuple<AgradDistributionParetoType2, type_v_382> AgradDistributionParetoType2_v_382;
+typedef std::tuple<AgradDistributionParetoType2, type_v_383> AgradDistributionParetoType2_v_383;
+typedef std::tuple<AgradDistributionParetoType2, type_v_384> AgradDistributionParetoType2_v_384;
+typedef std::tuple<AgradDistributionParetoType2, type_v_385> AgradDistributionParetoType2_v_385;
+typedef std::tuple<AgradDistributionParetoType2, type_v_386> AgradDistributionParetoType2_v_386;
+typedef std::tuple<AgradDistributionParetoType2, type_v_387> AgradDistributionParetoType2_v_387;
+typedef std::tuple<AgradDistributionParetoType2, type_v_388> AgradDistributionParetoType2_v_388;
+typedef std::tuple<AgradDistributionParetoType2, type_v_389> AgradDistributionParetoType2_v_389;
+typedef std::tuple<AgradDistributionParetoType2, type_v_390> AgradDistributionParetoType2_v_390;
+typedef std::tuple<AgradDistributionParetoType2, type_v_391> AgradDistributionParetoType2_v_391;
+typedef std::tuple<AgradDistributionParetoType2, type_v_392> AgradDistributionParetoType2_v_392;
+typedef std::tuple<AgradDistributionParetoType2, type_v_393> AgradDistributionParetoType2_v_393;
+typedef std::tuple<AgradDistributionParetoType2, type_v_394> AgradDistributionParetoType2_v_394;
+typedef std::tuple<AgradDistributionParetoType2, type_v_395> AgradDistributionParetoType2_v_395;
+typedef std::tuple<AgradDistributionParetoType2, type_v_396> AgradDistributionParetoType2_v_396;
+typedef std::tuple<AgradDistributionParetoType2, type_v_397> AgradDistributionParetoType2_v_397;
+typedef std::tuple<AgradDistributionParetoType2, type_v_398> AgradDistributionParetoType2_v_398;
+typedef std::tuple<AgradDistributionParetoType2, type_v_399> AgradDistributionParetoType2_v_399;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_300, AgradDistributionTestFixture, AgradDistributionParetoType2_v_300);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_301, AgradDistributionTestFixture, AgradDistributionParetoType2_v_301);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_302, AgradDistributionTestFixture, AgradDistributionParetoType2_v_302);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_303, AgradDistributionTestFixture, AgradDistributionParetoType2_v_303);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_304, AgradDistributionTestFixture, AgradDistributionParetoType2_v_304);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_305, AgradDistributionTestFixture, AgradDistributionParetoType2_v_305);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_306, AgradDistributionTestFixture, AgradDistributionParetoType2_v_306);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_307, AgradDistributionTestFixture, AgradDistributionParetoType2_v_307);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_308, AgradDistributionTestFixture, AgradDistributionParetoType2_v_308);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_309, AgradDistributionTestFixture, AgradDistributionParetoType2_v_309);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_310, AgradDistributionTestFixture, AgradDistributionParetoType2_v_310);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_311, AgradDistributionTestFixture, AgradDistributionParetoType2_v_311);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_312, AgradDistributionTestFixture, AgradDistributionParetoType2_v_312);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_313, AgradDistributionTestFixture, AgradDistributionParetoType2_v_313);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_314, AgradDistributionTestFixture, AgradDistributionParetoType2_v_314);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_315, AgradDistributionTestFixture, AgradDistributionParetoType2_v_315);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_316, AgradDistributionTestFixture, AgradDistributionParetoType2_v_316);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_317, AgradDistributionTestFixture, AgradDistributionParetoType2_v_317);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_318, AgradDistributionTestFixture, AgradDistributionParetoType2_v_318);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_319, AgradDistributionTestFixture, AgradDistributionParetoType2_v_319);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_320, AgradDistributionTestFixture, AgradDistributionParetoType2_v_320);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_321, AgradDistributionTestFixture, AgradDistributionParetoType2_v_321);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_322, AgradDistributionTestFixture, AgradDistributionParetoType2_v_322);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_323, AgradDistributionTestFixture, AgradDistributionParetoType2_v_323);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_324, AgradDistributionTestFixture, AgradDistributionParetoType2_v_324);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_325, AgradDistributionTestFixture, AgradDistributionParetoType2_v_325);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_326, AgradDistributionTestFixture, AgradDistributionParetoType2_v_326);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_327, AgradDistributionTestFixture, AgradDistributionParetoType2_v_327);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_328, AgradDistributionTestFixture, AgradDistributionParetoType2_v_328);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_329, AgradDistributionTestFixture, AgradDistributionParetoType2_v_329);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_330, AgradDistributionTestFixture, AgradDistributionParetoType2_v_330);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_331, AgradDistributionTestFixture, AgradDistributionParetoType2_v_331);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_332, AgradDistributionTestFixture, AgradDistributionParetoType2_v_332);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_333, AgradDistributionTestFixture, AgradDistributionParetoType2_v_333);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_334, AgradDistributionTestFixture, AgradDistributionParetoType2_v_334);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_335, AgradDistributionTestFixture, AgradDistributionParetoType2_v_335);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_336, AgradDistributionTestFixture, AgradDistributionParetoType2_v_336);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_337, AgradDistributionTestFixture, AgradDistributionParetoType2_v_337);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_338, AgradDistributionTestFixture, AgradDistributionParetoType2_v_338);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_339, AgradDistributionTestFixture, AgradDistributionParetoType2_v_339);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_340, AgradDistributionTestFixture, AgradDistributionParetoType2_v_340);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_341, AgradDistributionTestFixture, AgradDistributionParetoType2_v_341);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_342, AgradDistributionTestFixture, AgradDistributionParetoType2_v_342);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_343, AgradDistributionTestFixture, AgradDistributionParetoType2_v_343);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_344, AgradDistributionTestFixture, AgradDistributionParetoType2_v_344);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_345, AgradDistributionTestFixture, AgradDistributionParetoType2_v_345);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_346, AgradDistributionTestFixture, AgradDistributionParetoType2_v_346);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_347, AgradDistributionTestFixture, AgradDistributionParetoType2_v_347);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_348, AgradDistributionTestFixture, AgradDistributionParetoType2_v_348);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_349, AgradDistributionTestFixture, AgradDistributionParetoType2_v_349);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_350, AgradDistributionTestFixture, AgradDistributionParetoType2_v_350);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_351, AgradDistributionTestFixture, AgradDistributionParetoType2_v_351);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_352, AgradDistributionTestFixture, AgradDistributionParetoType2_v_352);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_353, AgradDistributionTestFixture, AgradDistributionParetoType2_v_353);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_354, AgradDistributionTestFixture, AgradDistributionParetoType2_v_354);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_355, AgradDistributionTestFixture, AgradDistributionParetoType2_v_355);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_356, AgradDistributionTestFixture, AgradDistributionParetoType2_v_356);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_357, AgradDistributionTestFixture, AgradDistributionParetoType2_v_357);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_358, AgradDistributionTestFixture, AgradDistributionParetoType2_v_358);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_359, AgradDistributionTestFixture, AgradDistributionParetoType2_v_359);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_360, AgradDistributionTestFixture, AgradDistributionParetoType2_v_360);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_361, AgradDistributionTestFixture, AgradDistributionParetoType2_v_361);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_362, AgradDistributionTestFixture, AgradDistributionParetoType2_v_362);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_363, AgradDistributionTestFixture, AgradDistributionParetoType2_v_363);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_364, AgradDistributionTestFixture, AgradDistributionParetoType2_v_364);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_365, AgradDistributionTestFixture, AgradDistributionParetoType2_v_365);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_366, AgradDistributionTestFixture, AgradDistributionParetoType2_v_366);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_367, AgradDistributionTestFixture, AgradDistributionParetoType2_v_367);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_368, AgradDistributionTestFixture, AgradDistributionParetoType2_v_368);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_369, AgradDistributionTestFixture, AgradDistributionParetoType2_v_369);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_370, AgradDistributionTestFixture, AgradDistributionParetoType2_v_370);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_371, AgradDistributionTestFixture, AgradDistributionParetoType2_v_371);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_372, AgradDistributionTestFixture, AgradDistributionParetoType2_v_372);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_373, AgradDistributionTestFixture, AgradDistributionParetoType2_v_373);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_374, AgradDistributionTestFixture, AgradDistributionParetoType2_v_374);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_375, AgradDistributionTestFixture, AgradDistributionParetoType2_v_375);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_376, AgradDistributionTestFixture, AgradDistributionParetoType2_v_376);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_377, AgradDistributionTestFixture, AgradDistributionParetoType2_v_377);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_378, AgradDistributionTestFixture, AgradDistributionParetoType2_v_378);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_379, AgradDistributionTestFixture, AgradDistributionParetoType2_v_379);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_380, AgradDistributionTestFixture, AgradDistributionParetoType2_v_380);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_381, AgradDistributionTestFixture, AgradDistributionParetoType2_v_381);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_382, AgradDistributionTestFixture, AgradDistributionParetoType2_v_382);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_383, AgradDistributionTestFixture, AgradDistributionParetoType2_v_383);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_384, AgradDistributionTestFixture, AgradDistributionParetoType2_v_384);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_385, AgradDistributionTestFixture, AgradDistributionParetoType2_v_385);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_386, AgradDistributionTestFixture, AgradDistributionParetoType2_v_386);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_387, AgradDistributionTestFixture, AgradDistributionParetoType2_v_387);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_388, AgradDistributionTestFixture, AgradDistributionParetoType2_v_388);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_389, AgradDistributionTestFixture, AgradDistributionParetoType2_v_389);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_390, AgradDistributionTestFixture, AgradDistributionParetoType2_v_390);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_391, AgradDistributionTestFixture, AgradDistributionParetoType2_v_391);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_392, AgradDistributionTestFixture, AgradDistributionParetoType2_v_392);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_393, AgradDistributionTestFixture, AgradDistributionParetoType2_v_393);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_394, AgradDistributionTestFixture, AgradDistributionParetoType2_v_394);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_395, AgradDistributionTestFixture, AgradDistributionParetoType2_v_395);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_396, AgradDistributionTestFixture, AgradDistributionParetoType2_v_396);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_397, AgradDistributionTestFixture, AgradDistributionParetoType2_v_397);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_398, AgradDistributionTestFixture, AgradDistributionParetoType2_v_398);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_399, AgradDistributionTestFixture, AgradDistributionParetoType2_v_399);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_test.hpp>
+
+typedef std::tuple<std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_300;
+typedef std::tuple<std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_301;
+typedef std::tuple<std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_302;
+typedef std::tuple<std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_303;
+typedef std::tuple<std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_304;
+typedef std::tuple<std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_305;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, double, empty, empty> type_vv_306;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, std::vector<double>, empty, empty> type_vv_307;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_308;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, var, empty, empty> type_vv_309;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, std::vector<var>, empty, empty> type_vv_310;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_311;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, double, empty, empty> type_vv_312;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_vv_313;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_314;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, var, empty, empty> type_vv_315;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_vv_316;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_317;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_318;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_319;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_320;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_321;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_322;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_323;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, double, empty, empty> type_vv_324;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, std::vector<double>, empty, empty> type_vv_325;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_326;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, var, empty, empty> type_vv_327;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, std::vector<var>, empty, empty> type_vv_328;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_329;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, double, empty, empty> type_vv_330;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_vv_331;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_332;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, var, empty, empty> type_vv_333;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_vv_334;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_335;
+typedef std::tuple<std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_336;
+typedef std::tuple<std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_337;
+typedef std::tuple<std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_338;
+typedef std::tuple<std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_339;
+typedef std::tuple<std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_340;
+typedef std::tuple<std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_341;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, empty, empty> type_vv_342;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, empty, empty> type_vv_343;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_344;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, empty, empty> type_vv_345;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, empty, empty> type_vv_346;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_347;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, empty, empty> type_vv_348;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, empty, empty> type_vv_349;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_350;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, empty, empty> type_vv_351;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, empty, empty> type_vv_352;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_353;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_354;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_355;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_356;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_357;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_358;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_359;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, empty, empty> type_vv_360;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, empty, empty> type_vv_361;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_362;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, empty, empty> type_vv_363;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, empty, empty> type_vv_364;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_365;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, empty, empty> type_vv_366;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, empty, empty> type_vv_367;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_368;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, empty, empty> type_vv_369;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, empty, empty> type_vv_370;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_371;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_372;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_373;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_374;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_375;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_376;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_377;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, var, empty, empty> type_vv_378;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, std::vector<var>, empty, empty> type_vv_379;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_380;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, var, empty, empty> type_vv_381;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, std::vector<var>, empty, empty> type_vv_382;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_383;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_384;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_385;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_386;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, double, empty, empty> type_vv_387;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, std::vector<double>, empty, empty> type_vv_388;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_389;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, var, empty, empty> type_vv_390;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, std::vector<var>, empty, empty> type_vv_391;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_392;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, double, empty, empty> type_vv_393;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, std::vector<double>, empty, empty> type_vv_394;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_395;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, var, empty, empty> type_vv_396;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, std::vector<var>, empty, empty> type_vv_397;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_398;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_399;
+
+typedef std::tuple<AgradDistributionParetoType2, type_vv_300> AgradDistributionParetoType2_vv_300;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_301> AgradDistributionParetoType2_vv_301;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_302> AgradDistributionParetoType2_vv_302;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_303> AgradDistributionParetoType2_vv_303;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_304> AgradDistributionParetoType2_vv_304;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_305> AgradDistributionParetoType2_vv_305;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_306> AgradDistributionParetoType2_vv_306;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_307> AgradDistributionParetoType2_vv_307;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_308> AgradDistributionParetoType2_vv_308;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_309> AgradDistributionParetoType2_vv_309;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_310> AgradDistributionParetoType2_vv_310;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_311> AgradDistributionParetoType2_vv_311;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_312> AgradDistributionParetoType2_vv_312;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_313> AgradDistributionParetoType2_vv_313;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_314> AgradDistributionParetoType2_vv_314;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_315> AgradDistributionParetoType2_vv_315;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_316> AgradDistributionParetoType2_vv_316;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_317> AgradDistributionParetoType2_vv_317;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_318> AgradDistributionParetoType2_vv_318;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_319> AgradDistributionParetoType2_vv_319;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_320> AgradDistributionParetoType2_vv_320;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_321> AgradDistributionParetoType2_vv_321;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_322> AgradDistributionParetoType2_vv_322;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_323> AgradDistributionParetoType2_vv_323;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_324> AgradDistributionParetoType2_vv_324;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_325> AgradDistributionParetoType2_vv_325;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_326> AgradDistributionParetoType2_vv_326;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_327> AgradDistributionParetoType2_vv_327;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_328> AgradDistributionParetoType2_vv_328;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_329> AgradDistributionParetoType2_vv_329;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_330> AgradDistributionParetoType2_vv_330;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_331> AgradDistributionParetoType2_vv_331;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_332> AgradDistributionParetoType2_vv_332;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_333> AgradDistributionParetoType2_vv_333;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_334> AgradDistributionParetoType2_vv_334;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_335> AgradDistributionParetoType2_vv_335;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_336> AgradDistributionParetoType2_vv_336;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_337> AgradDistributionParetoType2_vv_337;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_338> AgradDistributionParetoType2_vv_338;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_339> AgradDistributionParetoType2_vv_339;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_340> AgradDistributionParetoType2_vv_340;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_341> AgradDistributionParetoType2_vv_341;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_342> AgradDistributionParetoType2_vv_342;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_343> AgradDistributionParetoType2_vv_343;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_344> AgradDistributionParetoType2_vv_344;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_345> AgradDistributionParetoType2_vv_345;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_346> AgradDistributionParetoType2_vv_346;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_347> AgradDistributionParetoType2_vv_347;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_348> AgradDistributionParetoType2_vv_348;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_349> AgradDistributionParetoType2_vv_349;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_350> AgradDistributionParetoType2_vv_350;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_351> AgradDistributionParetoType2_vv_351;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_352> AgradDistributionParetoType2_vv_352;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_353> AgradDistributionParetoType2_vv_353;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_354> AgradDistributionParetoType2_vv_354;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_355> AgradDistributionParetoType2_vv_355;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_356> AgradDistributionParetoType2_vv_356;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_357> AgradDistributionParetoType2_vv_357;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_358> AgradDistributionParetoType2_vv_358;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_359> AgradDistributionParetoType2_vv_359;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_360> AgradDistributionParetoType2_vv_360;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_361> AgradDistributionParetoType2_vv_361;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_362> AgradDistributionParetoType2_vv_362;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_363> AgradDistributionParetoType2_vv_363;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_364> AgradDistributionParetoType2_vv_364;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_365> AgradDistributionParetoType2_vv_365;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_366> AgradDistributionParetoType2_vv_366;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_367> AgradDistributionParetoType2_vv_367;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_368> AgradDistributionParetoType2_vv_368;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_369> AgradDistributionParetoType2_vv_369;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_370> AgradDistributionParetoType2_vv_370;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_371> AgradDistributionParetoType2_vv_371;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_372> AgradDistributionParetoType2_vv_372;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_373> AgradDistributionParetoType2_vv_373;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_374> AgradDistributionParetoType2_vv_374;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_375> AgradDistributionParetoType2_vv_375;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_376> AgradDistributionParetoType2_vv_376;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_377> AgradDistributionParetoType2_vv_377;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_378> AgradDistributionParetoType2_vv_378;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_379> AgradDistributionParetoType2_vv_379;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_380> AgradDistributionParetoType2_vv_380;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_381> AgradDistributionParetoType2_vv_381;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_382> AgradDistributionParetoType2_vv_382;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_383> AgradDistributionParetoType2_vv_383;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_384> AgradDistributionParetoType2_vv_384;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_385> AgradDistributionParetoType2_vv_385;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_386> AgradDistributionParetoType2_vv_386;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_387> AgradDistributionParetoType2_vv_387;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_388> AgradDistributionParetoType2_vv_388;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_389> AgradDistributionParetoType2_vv_389;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_390> AgradDistributionParetoType2_vv_390;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_391> AgradDistributionParetoType2_vv_391;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_392> AgradDistributionParetoType2_vv_392;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_393> AgradDistributionParetoType2_vv_393;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_394> AgradDistributionParetoType2_vv_394;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_395> AgradDistributionParetoType2_vv_395;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_396> AgradDistributionParetoType2_vv_396;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_397> AgradDistributionParetoType2_vv_397;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_398> AgradDistributionParetoType2_vv_398;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_399> AgradDistributionParetoType2_vv_399;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_300, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_300);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_301, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_301);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_302, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_302);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_303, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_303);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_304, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_304);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_305, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_305);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_306, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_306);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_307, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_307);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_308, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_308);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_309, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_309);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_310, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_310);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_311, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_311);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_312, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_312);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_313, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_313);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_314, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_314);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_315, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_315);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_316, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_316);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_317, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_317);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_318, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_318);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_319, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_319);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_320, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_320);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_321, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_321);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_322, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_322);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_323, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_323);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_324, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_324);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_325, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_325);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_326, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_326);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_327, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_327);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_328, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_328);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_329, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_329);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_330, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_330);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_331, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_331);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_332, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_332);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_333, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_333);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_334, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_334);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_335, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_335);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_336, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_336);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_337, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_337);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_338, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_338);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_339, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_339);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_340, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_340);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_341, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_341);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_342, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_342);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_343, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_343);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_344, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_344);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_345, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_345);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_346, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_346);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_347, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_347);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_348, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_348);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_349, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_349);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_350, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_350);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_351, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_351);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_352, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_352);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_353, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_353);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_354, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_354);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_355, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_355);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_356, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_356);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_357, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_357);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_358, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_358);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_359, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_359);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_360, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_360);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_361, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_361);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_362, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_362);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_363, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_363);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_364, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_364);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_365, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_365);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_366, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_366);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_367, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_367);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_368, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_368);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_369, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_369);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_370, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_370);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_371, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_371);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_372, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_372);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_373, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_373);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_374, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_374);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_375, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_375);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_376, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_376);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_377, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_377);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_378, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_378);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_379, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_379);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_380, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_380);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_381, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_381);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_382, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_382);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_383, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_383);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_384, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_384);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_385, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_385);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_386, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_386);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_387, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_387);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_388, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_388);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_389, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_389);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_390, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_390);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_391, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_391);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_392, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_392);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_393, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_393);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_394, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_394);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_395, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_395);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_396, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_396);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_397, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_397);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_398, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_398);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_399, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_399);
+
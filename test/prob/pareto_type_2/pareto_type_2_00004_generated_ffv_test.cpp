@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_400;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_401;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_402;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_403;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_404;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, fvar<fvar<var> >, empty, empty> type_ffv_405;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_406;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_407;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_408;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_409;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_410;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_411;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_412;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_413;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, double, empty, empty> type_ffv_414;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_415;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_416;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_417;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_418;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_419;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_420;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_421;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_422;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_423;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_424;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_425;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_426;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_427;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_428;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_429;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_430;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_431;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_432;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_433;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_434;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_435;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_436;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_437;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_438;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_439;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_440;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_441;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_442;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_443;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_444;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_445;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_446;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_447;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_448;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_449;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_450;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_451;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_452;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_453;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_454;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_455;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_456;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_457;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_458;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, double, empty, empty> type_ffv_459;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, std::vector<double>, empty, empty> type_ffv_460;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_461;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, fvar<fvar<var> >, empty, empty> type_ffv_462;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_463;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_464;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, double, empty, empty> type_ffv_465;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty, empty> type_ffv_466;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_467;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_468;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_469;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_470;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_471;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_472;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_473;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_474;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_475;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_476;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, double, empty, empty> type_ffv_477;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_478;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_479;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_480;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_481;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_482;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_483;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_484;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_485;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_486;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_487;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_488;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_489;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_490;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_491;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_492;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_493;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_494;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, double, empty, empty> type_ffv_495;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty, empty> type_ffv_496;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_497;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty, empty> type_ffv_498;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_499;
+
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_400> AgradDistributionParetoType2_ffv_400;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_401> AgradDistributionParetoType2_ffv_401;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_402> AgradDistributionParetoType2_ffv_402;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_403> AgradDistributionParetoType2_ffv_403;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_404> AgradDistributionParetoType2_ffv_404;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_405> AgradDistributionParetoType2_ffv_405;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_406> AgradDistributionParetoType2_ffv_406;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_407> AgradDistributionParetoType2_ffv_407;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_408> AgradDistributionParetoType2_ffv_408;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_409> AgradDistributionParetoType2_ffv_409;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_410> AgradDistributionParetoType2_ffv_410;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_411> AgradDistributionParetoType2_ffv_411;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_412> AgradDistributionParetoType2_ffv_412;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_413> AgradDistributionParetoType2_ffv_413;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_414> AgradDistributionParetoType2_ffv_414;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_415> AgradDistributionParetoType2_ffv_415;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_416> AgradDistributionParetoType2_ffv_416;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_417> AgradDistributionParetoType2_ffv_417;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_418> AgradDistributionParetoType2_ffv_418;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_419> AgradDistributionParetoType2_ffv_419;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_420> AgradDistributionParetoType2_ffv_420;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_421> AgradDistributionParetoType2_ffv_421;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_422> AgradDistributionParetoType2_ffv_422;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_423> AgradDistributionParetoType2_ffv_423;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_424> AgradDistributionParetoType2_ffv_424;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_425> AgradDistributionParetoType2_ffv_425;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_426> AgradDistributionParetoType2_ffv_426;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_427> AgradDistributionParetoType2_ffv_427;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_428> AgradDistributionParetoType2_ffv_428;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_429> AgradDistributionParetoType2_ffv_429;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_430> AgradDistributionParetoType2_ffv_430;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_431> AgradDistributionParetoType2_ffv_431;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_432> AgradDistributionParetoType2_ffv_432;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_433> AgradDistributionParetoType2_ffv_433;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_434> AgradDistributionParetoType2_ffv_434;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_435> AgradDistributionParetoType2_ffv_435;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_436> AgradDistributionParetoType2_ffv_436;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_437> AgradDistributionParetoType2_ffv_437;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_438> AgradDistributionParetoType2_ffv_438;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_439> AgradDistributionParetoType2_ffv_439;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_440> AgradDistributionParetoType2_ffv_440;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_441> AgradDistributionParetoType2_ffv_441;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_442> AgradDistributionParetoType2_ffv_442;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_443> AgradDistributionParetoType2_ffv_443;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_444> AgradDistributionParetoType2_ffv_444;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_445> AgradDistributionParetoType2_ffv_445;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_446> AgradDistributionParetoType2_ffv_446;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_447> AgradDistributionParetoType2_ffv_447;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_448> AgradDistributionParetoType2_ffv_448;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_449> AgradDistributionParetoType2_ffv_449;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_450> AgradDistributionParetoType2_ffv_450;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_451> AgradDistributionParetoType2_ffv_451;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_452> AgradDistributionParetoType2_ffv_452;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_453> AgradDistributionParetoType2_ffv_453;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_454> AgradDistributionParetoType2_ffv_454;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_455> AgradDistributionParetoType2_ffv_455;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_456> AgradDistributionParetoType2_ffv_456;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_457> AgradDistributionParetoType2_ffv_457;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_458> AgradDistributionParetoType2_ffv_458;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_459> AgradDistributionParetoType2_ffv_459;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_460> AgradDistributionParetoType2_ffv_460;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_461> AgradDistributionParetoType2_ffv_461;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_462> AgradDistributionParetoType2_ffv_462;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_463> AgradDistributionParetoType2_ffv_463;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_464> AgradDistributionParetoType2_ffv_464;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_465> AgradDistributionParetoType2_ffv_465;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_466> AgradDistributionParetoType2_ffv_466;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_467> AgradDistributionParetoType2_ffv_467;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_468> AgradDistributionParetoType2_ffv_468;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_469> AgradDistributionParetoType2_ffv_469;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_470> AgradDistributionParetoType2_ffv_470;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_471> AgradDistributionParetoType2_ffv_471;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_472> AgradDistributionParetoType2_ffv_472;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_473> AgradDistributionParetoType2_ffv_473;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_474> AgradDistributionParetoType2_ffv_474;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_475> AgradDistributionParetoType2_ffv_475;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_476> AgradDistributionParetoType2_ffv_476;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_477> AgradDistributionParetoType2_ffv_477;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_478> AgradDistributionParetoType2_ffv_478;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_479> AgradDistributionParetoType2_ffv_479;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_480> AgradDistributionParetoType2_ffv_480;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_481> AgradDistributionParetoType2_ffv_481;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_482> AgradDistributionParetoType2_ffv_482;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_483> AgradDistributionParetoType2_ffv_483;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_484> AgradDistributionParetoType2_ffv_484;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_485> AgradDistributionParetoType2_ffv_485;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_486> AgradDistributionParetoType2_ffv_486;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_487> AgradDistributionParetoType2_ffv_487;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_488> AgradDistributionParetoType2_ffv_488;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_489> AgradDistributionParetoType2_ffv_489;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_490> AgradDistributionParetoType2_ffv_490;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_491> AgradDistributionParetoType2_ffv_491;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_492> AgradDistributionParetoType2_ffv_492;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_493> AgradDistributionParetoType2_ffv_493;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_494> AgradDistributionParetoType2_ffv_494;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_495> AgradDistributionParetoType2_ffv_495;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_496> AgradDistributionParetoType2_ffv_496;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_497> AgradDistributionParetoType2_ffv_497;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_498> AgradDistributionParetoType2_ffv_498;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_499> AgradDistributionParetoType2_ffv_499;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_400, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_400);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_401, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_401);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_402, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_402);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_403, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_403);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_404, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_404);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_405, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_405);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_406, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_406);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_407, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_407);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_408, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_408);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_409, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_409);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_410, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_410);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_411, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_411);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_412, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_412);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_413, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_413);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_414, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_414);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_415, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_415);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_416, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_416);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_417, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_417);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_418, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_418);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_419, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_419);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_420, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_420);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_421, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_421);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_422, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_422);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_423, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_423);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_424, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_424);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_425, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_425);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_426, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_426);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_427, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_427);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_428, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_428);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_429, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_429);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_430, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_430);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_431, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_431);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_432, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_432);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_433, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_433);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_434, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_434);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_435, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_435);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_436, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_436);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_437, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_437);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_438, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_438);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_439, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_439);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_440, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_440);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_441, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_441);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_442, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_442);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_443, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_443);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_444, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_444);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_445, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_445);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_446, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_446);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_447, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_447);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_448, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_448);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_449, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_449);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_450, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_450);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_451, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_451);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_452, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_452);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_453, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_453);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_454, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_454);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_455, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_455);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_456, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_456);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_457, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_457);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_458, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_458);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_459, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_459);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_460, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_460);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_461, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_461);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_462, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_462);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_463, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_463);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_464, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_464);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_465, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_465);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_466, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_466);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_467, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_467);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_468, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_468);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_469, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_469);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_470, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_470);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_471, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_471);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_472, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_472);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_473, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_473);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_474, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_474);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_475, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_475);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_476, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_476);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_477, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_477);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_478, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_478);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_479, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_479);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_480, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_480);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_481, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_481);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_482, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_482);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_483, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_483);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_484, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_484);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_485, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_485);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_486, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_486);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_487, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_487);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_488, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_488);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_489, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_489);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_490, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_490);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_491, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_491);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_492, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_492);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_493, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_493);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_494, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_494);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_495, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_495);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_496, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_496);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_497, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_497);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_498, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_498);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_499, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_499);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_test.hpp>
+
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_400;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_401;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_402;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_403;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_404;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_405;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_406;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_407;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_408;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_409;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_410;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_411;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_412;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_413;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_414;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_415;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_416;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_417;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_418;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_419;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_420;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_421;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_422;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_423;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_424;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_425;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_426;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_427;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_428;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_429;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_430;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_431;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, double, empty, empty> type_v_432;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, std::vector<double>, empty, empty> type_v_433;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_434;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, var, empty, empty> type_v_435;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, std::vector<var>, empty, empty> type_v_436;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_437;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, double, empty, empty> type_v_438;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, std::vector<double>, empty, empty> type_v_439;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_440;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, var, empty, empty> type_v_441;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, std::vector<var>, empty, empty> type_v_442;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_443;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_444;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_445;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_446;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_447;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_448;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_449;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, double, empty, empty> type_v_450;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, std::vector<double>, empty, empty> type_v_451;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_452;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, var, empty, empty> type_v_453;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, std::vector<var>, empty, empty> type_v_454;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_455;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, double, empty, empty> type_v_456;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, std::vector<double>, empty, empty> type_v_457;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_458;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, var, empty, empty> type_v_459;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, std::vector<var>, empty, empty> type_v_460;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_461;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_462;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_463;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_464;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_465;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_466;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_467;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, double, empty, empty> type_v_468;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, std::vector<double>, empty, empty> type_v_469;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_470;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, var, empty, empty> type_v_471;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, std::vector<var>, empty, empty> type_v_472;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_473;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, double, empty, empty> type_v_474;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, std::vector<double>, empty, empty> type_v_475;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_476;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, var, empty, empty> type_v_477;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_v_478;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_479;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_480;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_481;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_482;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_483;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_484;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_485;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, double, empty, empty> type_v_486;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, std::vector<double>, empty, empty> type_v_487;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_488;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, var, empty, empty> type_v_489;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, std::vector<var>, empty, empty> type_v_490;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_491;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, double, empty, empty> type_v_492;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_v_493;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_494;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, var, empty, empty> type_v_495;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_v_496;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_497;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_498;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_499;
+
+typedef std::tuple<AgradDistributionParetoType2, type_v_400> AgradDistributionParetoType2_v_400;
+typedef std::tuple<AgradDistributionParetoType2, type_v_401> AgradDistributionParetoType2_v_401;
+typedef std::tuple<AgradDistributionParetoType2, type_v_402> AgradDistributionParetoType2_v_402;
+typedef std::tuple<AgradDistributionParetoType2, type_v_403> AgradDistributionParetoType2_v_403;
+typedef std::tuple<AgradDistributionParetoType2, type_v_404> AgradDistributionParetoType2_v_404;
+typedef std::tuple<AgradDistributionParetoType2, type_v_405> AgradDistributionParetoType2_v_405;
+typedef std::tuple<AgradDistributionParetoType2, type_v_406> AgradDistributionParetoType2_v_406;
+typedef std::tuple<AgradDistributionParetoType2, type_v_407> AgradDistributionParetoType2_v_407;
+typedef std::tuple<AgradDistributionParetoType2, type_v_408> AgradDistributionParetoType2_v_408;
+typedef std::tuple<AgradDistributionParetoType2, type_v_409> AgradDistributionParetoType2_v_409;
+typedef std::tuple<AgradDistributionParetoType2, type_v_410> AgradDistributionParetoType2_v_410;
+typedef std::tuple<AgradDistributionParetoType2, type_v_411> AgradDistributionParetoType2_v_411;
+typedef std::tuple<AgradDistributionParetoType2, type_v_412> AgradDistributionParetoType2_v_412;
+typedef std::tuple<AgradDistributionParetoType2, type_v_413> AgradDistributionParetoType2_v_413;
+typedef std::tuple<AgradDistributionParetoType2, type_v_414> AgradDistributionParetoType2_v_414;
+typedef std::tuple<AgradDistributionParetoType2, type_v_415> AgradDistributionParetoType2_v_415;
+typedef std::tuple<AgradDistributionParetoType2, type_v_416> AgradDistributionParetoType2_v_416;
+typedef std::tuple<AgradDistributionParetoType2, type_v_417> AgradDistributionParetoType2_v_417;
+typedef std::tuple<AgradDistributionParetoType2, type_v_418> AgradDistributionParetoType2_v_418;
+typedef std::tuple<AgradDistributionParetoType2, type_v_419> AgradDistributionParetoType2_v_419;
+typedef std::tuple<AgradDistributionParetoType2, type_v_420> AgradDistributionParetoType2_v_420;
+typedef std::tuple<AgradDistributionParetoType2, type_v_421> AgradDistributionParetoType2_v_421;
+typedef std::tuple<AgradDistributionParetoType2, type_v_422> AgradDistributionParetoType2_v_422;
+typedef std::tuple<AgradDistributionParetoType2, type_v_423> AgradDistributionParetoType2_v_423;
+typedef std::tuple<AgradDistributionParetoType2, type_v_424> AgradDistributionParetoType2_v_424;
+typedef std::tuple<AgradDistributionParetoType2, type_v_425> AgradDistributionParetoType2_v_425;
+typedef std::tuple<AgradDistributionParetoType2, type_v_426> AgradDistributionParetoType2_v_426;
+typedef std::tuple<AgradDistributionParetoType2, type_v_427> AgradDistributionParetoType2_v_427;
+typedef std::tuple<AgradDistributionParetoType2, type_v_428> AgradDistributionParetoType2_v_428;
+typedef std::tuple<AgradDistributionParetoType2, type_v_429> AgradDistributionParetoType2_v_429;
+typedef std::tuple<AgradDistributionParetoType2, type_v_430> AgradDistributionParetoType2_v_430;
+typedef std::tuple<AgradDistributionParetoType2, type_v_431> AgradDistributionParetoType2_v_431;
+typedef std::tuple<AgradDistributionParetoType2, type_v_432> AgradDistributionParetoType2_v_432;
+typedef std::tuple<AgradDistributionParetoType2, type_v_433> AgradDistributionParetoType2_v_433;
+typedef std::tuple<AgradDistributionParetoType2, type_v_434> AgradDistributionParetoType2_v_434;
+typedef std::tuple<AgradDistributionParetoType2, type_v_435> AgradDistributionParetoType2_v_435;
+typedef std::tuple<AgradDistributionParetoType2, type_v_436> AgradDistributionParetoType2_v_436;
+typedef std::tuple<AgradDistributionParetoType2, type_v_437> AgradDistributionParetoType2_v_437;
+typedef std::tuple<AgradDistributionParetoType2, type_v_438> AgradDistributionParetoType2_v_438;
+typedef std::tuple<AgradDistributionParetoType2, type_v_439> AgradDistributionParetoType2_v_439;
+typedef std::tuple<AgradDistributionParetoType2, type_v_440> AgradDistributionParetoType2_v_440;
+typedef std::tuple<AgradDistributionParetoType2, type_v_441> AgradDistributionParetoType2_v_441;
+typedef std::tuple<AgradDistributionParetoType2, type_v_442> AgradDistributionParetoType2_v_442;
+typedef std::tuple<AgradDistributionParetoType2, type_v_443> AgradDistributionParetoType2_v_443;
+typedef std::tuple<AgradDistributionParetoType2, type_v_444> AgradDistributionParetoType2_v_444;
+typedef std::tuple<AgradDistributionParetoType2, type_v_445> AgradDistributionParetoType2_v_445;
+typedef std::tuple<AgradDistributionParetoType2, type_v_446> AgradDistributionParetoType2_v_446;
+typedef std::tuple<AgradDistributionParetoType2, type_v_447> AgradDistributionParetoType2_v_447;
+typedef std::tuple<AgradDistributionParetoType2, type_v_448> AgradDistributionParetoType2_v_448;
+typedef std::tuple<AgradDistributionParetoType2, type_v_449> AgradDistributionParetoType2_v_449;
+typedef std::tuple<AgradDistributionParetoType2, type_v_450> AgradDistributionParetoType2_v_450;
+typedef std::tuple<AgradDistributionParetoType2, type_v_451> AgradDistributionParetoType2_v_451;
+typedef std::tuple<AgradDistributionParetoType2, type_v_452> AgradDistributionParetoType2_v_452;
+typedef std::tuple<AgradDistributionParetoType2, type_v_453> AgradDistributionParetoType2_v_453;
+typedef std::tuple<AgradDistributionParetoType2, type_v_454> AgradDistributionParetoType2_v_454;
+typedef std::tuple<AgradDistributionParetoType2, type_v_455> AgradDistributionParetoType2_v_455;
+typedef std::tuple<AgradDistributionParetoType2, type_v_456> AgradDistributionParetoType2_v_456;
+typedef std::tuple<AgradDistributionParetoType2, type_v_457> AgradDistributionParetoType2_v_457;
+typedef std::tuple<AgradDistributionParetoType2, type_v_458> AgradDistributionParetoType2_v_458;
+typedef std::tuple<AgradDistributionParetoType2, type_v_459> AgradDistributionParetoType2_v_459;
+typedef std::tuple<AgradDistributionParetoType2, type_v_460> AgradDistributionParetoType2_v_460;
+typedef std::tuple<AgradDistributionParetoType2, type_v_461> AgradDistributionParetoType2_v_461;
+typedef std::tuple<AgradDistributionParetoType2, type_v_462> AgradDistributionParetoType2_v_462;
+typedef std::tuple<AgradDistributionParetoType2, type_v_463> AgradDistributionParetoType2_v_463;
+typedef std::tuple<AgradDistributionParetoType2, type_v_464> AgradDistributionParetoType2_v_464;
+typedef std::tuple<AgradDistributionParetoType2, type_v_465> AgradDistributionParetoType2_v_465;
+typedef std::tuple<AgradDistributionParetoType2, type_v_466> AgradDistributionParetoType2_v_466;
+typedef std::tuple<AgradDistributionParetoType2, type_v_467> AgradDistributionParetoType2_v_467;
+typedef std::tuple<AgradDistributionParetoType2, type_v_468> AgradDistributionParetoType2_v_468;
+typedef std::tuple<AgradDistributionParetoType2, type_v_469> AgradDistributionParetoType2_v_469;
+typedef std::tuple<AgradDistributionParetoType2, type_v_470> AgradDistributionParetoType2_v_470;
+typedef std::tuple<AgradDistributionParetoType2, type_v_471> AgradDistributionParetoType2_v_471;
+typedef std::tuple<AgradDistributionParetoType2, type_v_472> AgradDistributionParetoType2_v_472;
+typedef std::tuple<AgradDistributionParetoType2, type_v_473> AgradDistributionParetoType2_v_473;
+typedef std::tuple<AgradDistributionParetoType2, type_v_474> AgradDistributionParetoType2_v_474;
+typedef std::tuple<AgradDistributionParetoType2, type_v_475> AgradDistributionParetoType2_v_475;
+typedef std::tuple<AgradDistributionParetoType2, type_v_476> AgradDistributionParetoType2_v_476;
+typedef std::tuple<AgradDistributionParetoType2, type_v_477> AgradDistributionParetoType2_v_477;
+typedef std::tuple<AgradDistributionParetoType2, type_v_478> AgradDistributionParetoType2_v_478;
+typedef std::tuple<AgradDistributionParetoType2, type_v_479> AgradDistributionParetoType2_v_479;
+typedef std::tuple<AgradDistributionParetoType2, type_v_480> AgradDistributionParetoType2_v_480;
+typedef std::tuple<AgradDistributionParetoType2, type_v_481> AgradDistributionParetoType2_v_481;
+typedef std::tuple<AgradDistributionParetoType2, type_v_482> AgradDistributionParetoType2_v_482;
+typedef std::tuple<AgradDistributionParetoType2, type_v_483> AgradDistributionParetoType2_v_483;
+typedef std::tuple<AgradDistributionParetoType2, type_v_484> AgradDistributionParetoType2_v_484;
+typedef std::tuple<AgradDistributionParetoType2, type_v_485> AgradDistributionParetoType2_v_485;
+typedef std::tuple<AgradDistributionParetoType2, type_v_486> AgradDistributionParetoType2_v_486;
+typedef std::tuple<AgradDistributionParetoType2, type_v_487> AgradDistributionParetoType2_v_487;
+typedef std::tuple<AgradDistributionParetoType2, type_v_488> AgradDistributionParetoType2_v_488;
+typedef std::tuple<AgradDistributionParetoType2, type_v_489> AgradDistributionParetoType2_v_489;
+typedef std::tuple<AgradDistributionParetoType2, type_v_490> AgradDistributionParetoType2_v_490;
+typedef std::tuple<AgradDistributionParetoType2, type_v_491> AgradDistributionParetoType2_v_491;
+typedef std::tuple<AgradDistributionParetoType2, type_v_492> AgradDistributionParetoType2_v_492;
+typedef std::tuple<AgradDistributionParetoType2, type_v_493> AgradDistributionParetoType2_v_493;
+typedef std::tuple<AgradDistributionParetoType2, type_v_494> AgradDistributionParetoType2_v_494;
+typedef std::tuple<AgradDistributionParetoType2, type_v_495> AgradDistributionParetoType2_v_495;
+typedef std::tuple<AgradDistributionParetoType2, type_v_496> AgradDistributionParetoType2_v_496;
+typedef std::tuple<AgradDistributionParetoType2, type_v_497> AgradDistributionParetoType2_v_497;
+typedef std::tuple<AgradDistributionParetoType2, type_v_498> AgradDistributionParetoType2_v_498;
+typedef std::tuple<AgradDistributionParetoType2, type_v_499> AgradDistributionParetoType2_v_499;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_400, AgradDistributionTestFixture, AgradDistributionParetoType2_v_400);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_401, AgradDistributionTestFixture, AgradDistributionParetoType2_v_401);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_402, AgradDistributionTestFixture, AgradDistributionParetoType2_v_402);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_403, AgradDistributionTestFixture, AgradDistributionParetoType2_v_403);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_404, AgradDistributionTestFixture, AgradDistributionParetoType2_v_404);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_405, AgradDistributionTestFixture, AgradDistributionParetoType2_v_405);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_406, AgradDistributionTestFixture, AgradDistributionParetoType2_v_406);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_407, AgradDistributionTestFixture, AgradDistributionParetoType2_v_407);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_408, AgradDistributionTestFixture, AgradDistributionParetoType2_v_408);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_409, AgradDistributionTestFixture, AgradDistributionParetoType2_v_409);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_410, AgradDistributionTestFixture, AgradDistributionParetoType2_v_410);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_411, AgradDistributionTestFixture, AgradDistributionParetoType2_v_411);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_412, AgradDistributionTestFixture, AgradDistributionParetoType2_v_412);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_413, AgradDistributionTestFixture, AgradDistributionParetoType2_v_413);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_414, AgradDistributionTestFixture, AgradDistributionParetoType2_v_414);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_415, AgradDistributionTestFixture, AgradDistributionParetoType2_v_415);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_416, AgradDistributionTestFixture, AgradDistributionParetoType2_v_416);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_417, AgradDistributionTestFixture, AgradDistributionParetoType2_v_417);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_418, AgradDistributionTestFixture, AgradDistributionParetoType2_v_418);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_419, AgradDistributionTestFixture, AgradDistributionParetoType2_v_419);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_420, AgradDistributionTestFixture, AgradDistributionParetoType2_v_420);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_421, AgradDistributionTestFixture, AgradDistributionParetoType2_v_421);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_422, AgradDistributionTestFixture, AgradDistributionParetoType2_v_422);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_423, AgradDistributionTestFixture, AgradDistributionParetoType2_v_423);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_424, AgradDistributionTestFixture, AgradDistributionParetoType2_v_424);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_425, AgradDistributionTestFixture, AgradDistributionParetoType2_v_425);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_426, AgradDistributionTestFixture, AgradDistributionParetoType2_v_426);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_427, AgradDistributionTestFixture, AgradDistributionParetoType2_v_427);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_428, AgradDistributionTestFixture, AgradDistributionParetoType2_v_428);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_429, AgradDistributionTestFixture, AgradDistributionParetoType2_v_429);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_430, AgradDistributionTestFixture, AgradDistributionParetoType2_v_430);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_431, AgradDistributionTestFixture, AgradDistributionParetoType2_v_431);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_432, AgradDistributionTestFixture, AgradDistributionParetoType2_v_432);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_433, AgradDistributionTestFixture, AgradDistributionParetoType2_v_433);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_434, AgradDistributionTestFixture, AgradDistributionParetoType2_v_434);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_435, AgradDistributionTestFixture, AgradDistributionParetoType2_v_435);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_436, AgradDistributionTestFixture, AgradDistributionParetoType2_v_436);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_437, AgradDistributionTestFixture, AgradDistributionParetoType2_v_437);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_438, AgradDistributionTestFixture, AgradDistributionParetoType2_v_438);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_439, AgradDistributionTestFixture, AgradDistributionParetoType2_v_439);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_440, AgradDistributionTestFixture, AgradDistributionParetoType2_v_440);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_441, AgradDistributionTestFixture, AgradDistributionParetoType2_v_441);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_442, AgradDistributionTestFixture, AgradDistributionParetoType2_v_442);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_443, AgradDistributionTestFixture, AgradDistributionParetoType2_v_443);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_444, AgradDistributionTestFixture, AgradDistributionParetoType2_v_444);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_445, AgradDistributionTestFixture, AgradDistributionParetoType2_v_445);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_446, AgradDistributionTestFixture, AgradDistributionParetoType2_v_446);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_447, AgradDistributionTestFixture, AgradDistributionParetoType2_v_447);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_448, AgradDistributionTestFixture, AgradDistributionParetoType2_v_448);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_449, AgradDistributionTestFixture, AgradDistributionParetoType2_v_449);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_450, AgradDistributionTestFixture, AgradDistributionParetoType2_v_450);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_451, AgradDistributionTestFixture, AgradDistributionParetoType2_v_451);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_452, AgradDistributionTestFixture, AgradDistributionParetoType2_v_452);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_453, AgradDistributionTestFixture, AgradDistributionParetoType2_v_453);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_454, AgradDistributionTestFixture, AgradDistributionParetoType2_v_454);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_455, AgradDistributionTestFixture, AgradDistributionParetoType2_v_455);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_456, AgradDistributionTestFixture, AgradDistributionParetoType2_v_456);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_457, AgradDistributionTestFixture, AgradDistributionParetoType2_v_457);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_458, AgradDistributionTestFixture, AgradDistributionParetoType2_v_458);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_459, AgradDistributionTestFixture, AgradDistributionParetoType2_v_459);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_460, AgradDistributionTestFixture, AgradDistributionParetoType2_v_460);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_461, AgradDistributionTestFixture, AgradDistributionParetoType2_v_461);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_462, AgradDistributionTestFixture, AgradDistributionParetoType2_v_462);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_463, AgradDistributionTestFixture, AgradDistributionParetoType2_v_463);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_464, AgradDistributionTestFixture, AgradDistributionParetoType2_v_464);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_465, AgradDistributionTestFixture, AgradDistributionParetoType2_v_465);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_466, AgradDistributionTestFixture, AgradDistributionParetoType2_v_466);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_467, AgradDistributionTestFixture, AgradDistributionParetoType2_v_467);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_468, AgradDistributionTestFixture, AgradDistributionParetoType2_v_468);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_469, AgradDistributionTestFixture, AgradDistributionParetoType2_v_469);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_470, AgradDistributionTestFixture, AgradDistributionParetoType2_v_470);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_471, AgradDistributionTestFixture, AgradDistributionParetoType2_v_471);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_472, AgradDistributionTestFixture, AgradDistributionParetoType2_v_472);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_473, AgradDistributionTestFixture, AgradDistributionParetoType2_v_473);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_474, AgradDistributionTestFixture, AgradDistributionParetoType2_v_474);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_475, AgradDistributionTestFixture, AgradDistributionParetoType2_v_475);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_476, AgradDistributionTestFixture, AgradDistributionParetoType2_v_476);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_477, AgradDistributionTestFixture, AgradDistributionParetoType2_v_477);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_478, AgradDistributionTestFixture, AgradDistributionParetoType2_v_478);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_479, AgradDistributionTestFixture, AgradDistributionParetoType2_v_479);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_480, AgradDistributionTestFixture, AgradDistributionParetoType2_v_480);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_481, AgradDistributionTestFixture, AgradDistributionParetoType2_v_481);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_482, AgradDistributionTestFixture, AgradDistributionParetoType2_v_482);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_483, AgradDistributionTestFixture, AgradDistributionParetoType2_v_483);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_484, AgradDistributionTestFixture, AgradDistributionParetoType2_v_484);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_485, AgradDistributionTestFixture, AgradDistributionParetoType2_v_485);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_486, AgradDistributionTestFixture, AgradDistributionParetoType2_v_486);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_487, AgradDistributionTestFixture, AgradDistributionParetoType2_v_487);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_488, AgradDistributionTestFixture, AgradDistributionParetoType2_v_488);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_489, AgradDistributionTestFixture, AgradDistributionParetoType2_v_489);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_490, AgradDistributionTestFixture, AgradDistributionParetoType2_v_490);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_491, AgradDistributionTestFixture, AgradDistributionParetoType2_v_491);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_492, AgradDistributionTestFixture, AgradDistributionParetoType2_v_492);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_493, AgradDistributionTestFixture, AgradDistributionParetoType2_v_493);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_494, AgradDistributionTestFixture, AgradDistributionParetoType2_v_494);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_495, AgradDistributionTestFixture, AgradDistributionParetoType2_v_495);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_496, AgradDistributionTestFixture, AgradDistributionParetoType2_v_496);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_497, AgradDistributionTestFixture, AgradDistributionParetoType2_v_497);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_498, AgradDistributionTestFixture, AgradDistributionParetoType2_v_498);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_499, AgradDistributionTestFixture, AgradDistributionParetoType2_v_499);
+
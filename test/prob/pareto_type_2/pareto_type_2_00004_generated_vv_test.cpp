@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_400;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_401;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_402;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_403;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_404;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, var, empty, empty> type_vv_405;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, std::vector<var>, empty, empty> type_vv_406;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_407;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, var, empty, empty> type_vv_408;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_vv_409;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_410;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_411;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_412;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_413;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, double, empty, empty> type_vv_414;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, std::vector<double>, empty, empty> type_vv_415;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_416;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, var, empty, empty> type_vv_417;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, std::vector<var>, empty, empty> type_vv_418;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_419;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, double, empty, empty> type_vv_420;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_vv_421;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_422;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, var, empty, empty> type_vv_423;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_vv_424;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_425;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_426;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_427;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_428;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_429;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_430;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_431;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_vv_432;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_vv_433;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_434;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_vv_435;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_vv_436;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_437;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_438;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_439;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_440;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_vv_441;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_vv_442;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_443;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_vv_444;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_vv_445;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_446;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_vv_447;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_vv_448;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_449;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_vv_450;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_vv_451;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_452;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_453;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_454;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_455;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_456;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_457;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_458;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, double, empty, empty> type_vv_459;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, std::vector<double>, empty, empty> type_vv_460;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_461;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, var, empty, empty> type_vv_462;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, std::vector<var>, empty, empty> type_vv_463;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_464;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, double, empty, empty> type_vv_465;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, std::vector<double>, empty, empty> type_vv_466;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_467;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, var, empty, empty> type_vv_468;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, std::vector<var>, empty, empty> type_vv_469;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_470;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_471;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_472;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_473;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_474;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_475;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_476;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, double, empty, empty> type_vv_477;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, std::vector<double>, empty, empty> type_vv_478;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_479;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, var, empty, empty> type_vv_480;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, std::vector<var>, empty, empty> type_vv_481;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_482;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, double, empty, empty> type_vv_483;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, std::vector<double>, empty, empty> type_vv_484;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_485;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, var, empty, empty> type_vv_486;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, std::vector<var>, empty, empty> type_vv_487;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_488;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_489;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_490;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_491;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_492;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_493;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_494;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, double, empty, empty> type_vv_495;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, std::vector<double>, empty, empty> type_vv_496;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_497;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, var, empty, empty> type_vv_498;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, std::vector<var>, empty, empty> type_vv_499;
+
+typedef std::tuple<AgradDistributionParetoType2, type_vv_400> AgradDistributionParetoType2_vv_400;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_401> AgradDistributionParetoType2_vv_401;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_402> AgradDistributionParetoType2_vv_402;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_403> AgradDistributionParetoType2_vv_403;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_404> AgradDistributionParetoType2_vv_404;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_405> AgradDistributionParetoType2_vv_405;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_406> AgradDistributionParetoType2_vv_406;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_407> AgradDistributionParetoType2_vv_407;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_408> AgradDistributionParetoType2_vv_408;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_409> AgradDistributionParetoType2_vv_409;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_410> AgradDistributionParetoType2_vv_410;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_411> AgradDistributionParetoType2_vv_411;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_412> AgradDistributionParetoType2_vv_412;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_413> AgradDistributionParetoType2_vv_413;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_414> AgradDistributionParetoType2_vv_414;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_415> AgradDistributionParetoType2_vv_415;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_416> AgradDistributionParetoType2_vv_416;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_417> AgradDistributionParetoType2_vv_417;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_418> AgradDistributionParetoType2_vv_418;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_419> AgradDistributionParetoType2_vv_419;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_420> AgradDistributionParetoType2_vv_420;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_421> AgradDistributionParetoType2_vv_421;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_422> AgradDistributionParetoType2_vv_422;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_423> AgradDistributionParetoType2_vv_423;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_424> AgradDistributionParetoType2_vv_424;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_425> AgradDistributionParetoType2_vv_425;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_426> AgradDistributionParetoType2_vv_426;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_427> AgradDistributionParetoType2_vv_427;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_428> AgradDistributionParetoType2_vv_428;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_429> AgradDistributionParetoType2_vv_429;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_430> AgradDistributionParetoType2_vv_430;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_431> AgradDistributionParetoType2_vv_431;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_432> AgradDistributionParetoType2_vv_432;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_433> AgradDistributionParetoType2_vv_433;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_434> AgradDistributionParetoType2_vv_434;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_435> AgradDistributionParetoType2_vv_435;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_436> AgradDistributionParetoType2_vv_436;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_437> AgradDistributionParetoType2_vv_437;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_438> AgradDistributionParetoType2_vv_438;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_439> AgradDistributionParetoType2_vv_439;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_440> AgradDistributionParetoType2_vv_440;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_441> AgradDistributionParetoType2_vv_441;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_442> AgradDistributionParetoType2_vv_442;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_443> AgradDistributionParetoType2_vv_443;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_444> AgradDistributionParetoType2_vv_444;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_445> AgradDistributionParetoType2_vv_445;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_446> AgradDistributionParetoType2_vv_446;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_447> AgradDistributionParetoType2_vv_447;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_448> AgradDistributionParetoType2_vv_448;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_449> AgradDistributionParetoType2_vv_449;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_450> AgradDistributionParetoType2_vv_450;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_451> AgradDistributionParetoType2_vv_451;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_452> AgradDistributionParetoType2_vv_452;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_453> AgradDistributionParetoType2_vv_453;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_454> AgradDistributionParetoType2_vv_454;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_455> AgradDistributionParetoType2_vv_455;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_456> AgradDistributionParetoType2_vv_456;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_457> AgradDistributionParetoType2_vv_457;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_458> AgradDistributionParetoType2_vv_458;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_459> AgradDistributionParetoType2_vv_459;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_460> AgradDistributionParetoType2_vv_460;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_461> AgradDistributionParetoType2_vv_461;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_462> AgradDistributionParetoType2_vv_462;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_463> AgradDistributionParetoType2_vv_463;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_464> AgradDistributionParetoType2_vv_464;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_465> AgradDistributionParetoType2_vv_465;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_466> AgradDistributionParetoType2_vv_466;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_467> AgradDistributionParetoType2_vv_467;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_468> AgradDistributionParetoType2_vv_468;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_469> AgradDistributionParetoType2_vv_469;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_470> AgradDistributionParetoType2_vv_470;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_471> AgradDistributionParetoType2_vv_471;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_472> AgradDistributionParetoType2_vv_472;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_473> AgradDistributionParetoType2_vv_473;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_474> AgradDistributionParetoType2_vv_474;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_475> AgradDistributionParetoType2_vv_475;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_476> AgradDistributionParetoType2_vv_476;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_477> AgradDistributionParetoType2_vv_477;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_478> AgradDistributionParetoType2_vv_478;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_479> AgradDistributionParetoType2_vv_479;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_480> AgradDistributionParetoType2_vv_480;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_481> AgradDistributionParetoType2_vv_481;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_482> AgradDistributionParetoType2_vv_482;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_483> AgradDistributionParetoType2_vv_483;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_484> AgradDistributionParetoType2_vv_484;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_485> AgradDistributionParetoType2_vv_485;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_486> AgradDistributionParetoType2_vv_486;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_487> AgradDistributionParetoType2_vv_487;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_488> AgradDistributionParetoType2_vv_488;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_489> AgradDistributionParetoType2_vv_489;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_490> AgradDistributionParetoType2_vv_490;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_491> AgradDistributionParetoType2_vv_491;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_492> AgradDistributionParetoType2_vv_492;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_493> AgradDistributionParetoType2_vv_493;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_494> AgradDistributionParetoType2_vv_494;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_495> AgradDistributionParetoType2_vv_495;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_496> AgradDistributionParetoType2_vv_496;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_497> AgradDistributionParetoType2_vv_497;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_498> AgradDistributionParetoType2_vv_498;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_499> AgradDistributionParetoType2_vv_499;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_400, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_400);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_401, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_401);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_402, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_402);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_403, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_403);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_404, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_404);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_405, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_405);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_406, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_406);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_407, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_407);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_408, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_408);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_409, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_409);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_410, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_410);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_411, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_411);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_412, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_412);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_413, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_413);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_414, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_414);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_415, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_415);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_416, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_416);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_417, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_417);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_418, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_418);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_419, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_419);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_420, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_420);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_421, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_421);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_422, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_422);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_423, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_423);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_424, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_424);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_425, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_425);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_426, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_426);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_427, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_427);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_428, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_428);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_429, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_429);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_430, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_430);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_431, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_431);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_432, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_432);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_433, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_433);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_434, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_434);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_435, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_435);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_436, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_436);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_437, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_437);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_438, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_438);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_439, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_439);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_440, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_440);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_441, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_441);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_442, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_442);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_443, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_443);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_444, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_444);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_445, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_445);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_446, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_446);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_447, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_447);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_448, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_448);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_449, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_449);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_450, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_450);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_451, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_451);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_452, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_452);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_453, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_453);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_454, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_454);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_455, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_455);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_456, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_456);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_457, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_457);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_458, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_458);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_459, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_459);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_460, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_460);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_461, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_461);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_462, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_462);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_463, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_463);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_464, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_464);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_465, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_465);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_466, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_466);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_467, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_467);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_468, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_468);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_469, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_469);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_470, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_470);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_471, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_471);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_472, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_472);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_473, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_473);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_474, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_474);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_475, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_475);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_476, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_476);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_477, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_477);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_478, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_478);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_479, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_479);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_480, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_480);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_481, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_481);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_482, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_482);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_483, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_483);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_484, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_484);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_485, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_485);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_486, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_486);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_487, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_487);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_488, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_488);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_489, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_489);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_490, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_490);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_491, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_491);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_492, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_492);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_493, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_493);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_494, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_494);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_495, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_495);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_496, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_496);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_497, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_497);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_498, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_498);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_499, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_499);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_500;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty, empty> type_ffv_501;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_502;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_503;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_504;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_505;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_506;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_507;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_508;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_509;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_510;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_511;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_512;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty, empty> type_ffv_513;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_514;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_515;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_516;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_517;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_518;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_519;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_520;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_521;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_522;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_523;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_524;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_525;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_526;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_527;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_528;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_529;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_530;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty, empty> type_ffv_531;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_ffv_532;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_533;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_534;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_535;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_536;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_ffv_537;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_538;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_539;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_540;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_541;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_542;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_543;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_544;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_545;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_546;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_547;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_548;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_549;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_550;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_551;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_552;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_553;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_554;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_555;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_556;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_557;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_558;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_559;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_560;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_561;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_562;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_563;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_564;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_565;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_566;
+typedef std::tuple<fvar<fvar<var> >, double, double, double, empty, empty> type_ffv_567;
+typedef std::tuple<fvar<fvar<var> >, double, double, std::vector<double>, empty, empty> type_ffv_568;
+typedef std::tuple<fvar<fvar<var> >, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_569;
+typedef std::tuple<fvar<fvar<var> >, double, double, fvar<fvar<var> >, empty, empty> type_ffv_570;
+typedef std::tuple<fvar<fvar<var> >, double, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_571;
+typedef std::tuple<fvar<fvar<var> >, double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_572;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<double>, double, empty, empty> type_ffv_573;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<double>, std::vector<double>, empty, empty> type_ffv_574;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_575;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_576;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_577;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_578;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_579;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_580;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_581;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_582;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_583;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_584;
+typedef std::tuple<fvar<fvar<var> >, double, fvar<fvar<var> >, double, empty, empty> type_ffv_585;
+typedef std::tuple<fvar<fvar<var> >, double, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_586;
+typedef std::tuple<fvar<fvar<var> >, double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_587;
+typedef std::tuple<fvar<fvar<var> >, double, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_588;
+typedef std::tuple<fvar<fvar<var> >, double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_589;
+typedef std::tuple<fvar<fvar<var> >, double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_590;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_591;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_592;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_593;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_594;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_595;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_596;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_597;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_598;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_599;
+
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_500> AgradDistributionParetoType2_ffv_500;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_501> AgradDistributionParetoType2_ffv_501;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_502> AgradDistributionParetoType2_ffv_502;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_503> AgradDistributionParetoType2_ffv_503;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_504> AgradDistributionParetoType2_ffv_504;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_505> AgradDistributionParetoType2_ffv_505;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_506> AgradDistributionParetoType2_ffv_506;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_507> AgradDistributionParetoType2_ffv_507;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_508> AgradDistributionParetoType2_ffv_508;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_509> AgradDistributionParetoType2_ffv_509;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_510> AgradDistributionParetoType2_ffv_510;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_511> AgradDistributionParetoType2_ffv_511;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_512> AgradDistributionParetoType2_ffv_512;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_513> AgradDistributionParetoType2_ffv_513;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_514> AgradDistributionParetoType2_ffv_514;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_515> AgradDistributionParetoType2_ffv_515;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_516> AgradDistributionParetoType2_ffv_516;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_517> AgradDistributionParetoType2_ffv_517;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_518> AgradDistributionParetoType2_ffv_518;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_519> AgradDistributionParetoType2_ffv_519;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_520> AgradDistributionParetoType2_ffv_520;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_521> AgradDistributionParetoType2_ffv_521;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_522> AgradDistributionParetoType2_ffv_522;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_523> AgradDistributionParetoType2_ffv_523;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_524> AgradDistributionParetoType2_ffv_524;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_525> AgradDistributionParetoType2_ffv_525;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_526> AgradDistributionParetoType2_ffv_526;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_527> AgradDistributionParetoType2_ffv_527;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_528> AgradDistributionParetoType2_ffv_528;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_529> AgradDistributionParetoType2_ffv_529;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_530> AgradDistributionParetoType2_ffv_530;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_531> AgradDistributionParetoType2_ffv_531;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_532> AgradDistributionParetoType2_ffv_532;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_533> AgradDistributionParetoType2_ffv_533;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_534> AgradDistributionParetoType2_ffv_534;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_535> AgradDistributionParetoType2_ffv_535;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_536> AgradDistributionParetoType2_ffv_536;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_537> AgradDistributionParetoType2_ffv_537;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_538> AgradDistributionParetoType2_ffv_538;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_539> AgradDistributionParetoType2_ffv_539;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_540> AgradDistributionParetoType2_ffv_540;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_541> AgradDistributionParetoType2_ffv_541;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_542> AgradDistributionParetoType2_ffv_542;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_543> AgradDistributionParetoType2_ffv_543;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_544> AgradDistributionParetoType2_ffv_544;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_545> AgradDistributionParetoType2_ffv_545;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_546> AgradDistributionParetoType2_ffv_546;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_547> AgradDistributionParetoType2_ffv_547;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_548> AgradDistributionParetoType2_ffv_548;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_549> AgradDistributionParetoType2_ffv_549;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_550> AgradDistributionParetoType2_ffv_550;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_551> AgradDistributionParetoType2_ffv_551;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_552> AgradDistributionParetoType2_ffv_552;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_553> AgradDistributionParetoType2_ffv_553;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_554> AgradDistributionParetoType2_ffv_554;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_555> AgradDistributionParetoType2_ffv_555;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_556> AgradDistributionParetoType2_ffv_556;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_557> AgradDistributionParetoType2_ffv_557;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_558> AgradDistributionParetoType2_ffv_558;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_559> AgradDistributionParetoType2_ffv_559;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_560> AgradDistributionParetoType2_ffv_560;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_561> AgradDistributionParetoType2_ffv_561;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_562> AgradDistributionParetoType2_ffv_562;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_563> AgradDistributionParetoType2_ffv_563;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_564> AgradDistributionParetoType2_ffv_564;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_565> AgradDistributionParetoType2_ffv_565;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_566> AgradDistributionParetoType2_ffv_566;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_567> AgradDistributionParetoType2_ffv_567;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_568> AgradDistributionParetoType2_ffv_568;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_569> AgradDistributionParetoType2_ffv_569;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_570> AgradDistributionParetoType2_ffv_570;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_571> AgradDistributionParetoType2_ffv_571;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_572> AgradDistributionParetoType2_ffv_572;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_573> AgradDistributionParetoType2_ffv_573;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_574> AgradDistributionParetoType2_ffv_574;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_575> AgradDistributionParetoType2_ffv_575;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_576> AgradDistributionParetoType2_ffv_576;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_577> AgradDistributionParetoType2_ffv_577;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_578> AgradDistributionParetoType2_ffv_578;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_579> AgradDistributionParetoType2_ffv_579;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_580> AgradDistributionParetoType2_ffv_580;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_581> AgradDistributionParetoType2_ffv_581;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_582> AgradDistributionParetoType2_ffv_582;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_583> AgradDistributionParetoType2_ffv_583;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_584> AgradDistributionParetoType2_ffv_584;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_585> AgradDistributionParetoType2_ffv_585;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_586> AgradDistributionParetoType2_ffv_586;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_587> AgradDistributionParetoType2_ffv_587;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_588> AgradDistributionParetoType2_ffv_588;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_589> AgradDistributionParetoType2_ffv_589;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_590> AgradDistributionParetoType2_ffv_590;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_591> AgradDistributionParetoType2_ffv_591;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_592> AgradDistributionParetoType2_ffv_592;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_593> AgradDistributionParetoType2_ffv_593;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_594> AgradDistributionParetoType2_ffv_594;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_595> AgradDistributionParetoType2_ffv_595;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_596> AgradDistributionParetoType2_ffv_596;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_597> AgradDistributionParetoType2_ffv_597;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_598> AgradDistributionParetoType2_ffv_598;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_599> AgradDistributionParetoType2_ffv_599;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_500, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_500);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_501, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_501);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_502, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_502);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_503, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_503);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_504, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_504);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_505, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_505);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_506, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_506);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_507, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_507);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_508, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_508);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_509, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_509);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_510, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_510);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_511, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_511);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_512, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_512);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_513, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_513);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_514, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_514);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_515, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_515);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_516, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_516);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_517, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_517);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_518, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_518);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_519, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_519);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_520, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_520);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_521, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_521);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_522, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_522);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_523, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_523);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_524, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_524);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_525, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_525);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_526, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_526);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_527, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_527);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_528, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_528);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_529, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_529);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_530, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_530);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_531, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_531);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_532, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_532);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_533, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_533);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_534, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_534);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_535, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_535);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_536, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_536);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_537, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_537);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_538, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_538);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_539, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_539);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_540, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_540);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_541, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_541);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_542, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_542);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_543, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_543);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_544, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_544);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_545, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_545);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_546, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_546);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_547, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_547);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_548, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_548);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_549, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_549);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_550, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_550);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_551, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_551);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_552, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_552);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_553, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_553);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_554, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_554);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_555, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_555);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_556, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_556);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_557, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_557);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_558, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_558);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_559, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_559);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_560, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_560);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_561, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_561);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_562, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_562);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_563, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_563);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_564, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_564);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_565, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_565);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_566, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_566);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_567, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_567);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_568, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_568);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_569, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_569);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_570, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_570);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_571, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_571);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_572, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_572);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_573, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_573);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_574, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_574);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_575, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_575);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_576, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_576);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_577, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_577);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_578, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_578);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_579, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_579);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_580, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_580);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_581, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_581);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_582, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_582);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_583, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_583);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_584, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_584);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_585, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_585);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_586, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_586);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_587, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_587);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_588, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_588);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_589, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_589);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_590, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_590);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_591, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_591);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_592, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_592);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_593, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_593);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_594, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_594);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_595, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_595);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_596, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_596);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_597, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_597);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_598, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_598);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_599, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_599);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_500;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_501;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_502;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_503;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_504;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_505;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_506;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_507;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_508;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_509;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_510;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_511;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_512;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_513;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_514;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_515;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_516;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_517;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_518;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_519;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_520;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_521;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_522;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_523;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_524;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_525;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_526;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_527;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_528;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_529;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_530;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_531;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_532;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_533;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_534;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_535;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_536;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_537;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_538;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_539;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, double, empty, empty> type_v_540;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, std::vector<double>, empty, empty> type_v_541;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_542;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, var, empty, empty> type_v_543;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, std::vector<var>, empty, empty> type_v_544;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_545;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, double, empty, empty> type_v_546;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, std::vector<double>, empty, empty> type_v_547;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_548;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, var, empty, empty> type_v_549;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, std::vector<var>, empty, empty> type_v_550;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_551;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_552;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_553;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_554;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_555;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_556;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_557;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, double, empty, empty> type_v_558;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, std::vector<double>, empty, empty> type_v_559;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_560;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, var, empty, empty> type_v_561;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, std::vector<var>, empty, empty> type_v_562;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_563;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, double, empty, empty> type_v_564;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, std::vector<double>, empty, empty> type_v_565;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_566;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, var, empty, empty> type_v_567;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, std::vector<var>, empty, empty> type_v_568;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_569;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_570;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_571;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_572;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_573;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_574;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_575;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, double, empty, empty> type_v_576;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, std::vector<double>, empty, empty> type_v_577;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_578;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, var, empty, empty> type_v_579;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, std::vector<var>, empty, empty> type_v_580;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_581;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, double, empty, empty> type_v_582;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_v_583;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_584;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, var, empty, empty> type_v_585;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_v_586;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_587;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_588;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_589;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_590;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_591;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_592;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_593;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, double, empty, empty> type_v_594;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, std::vector<double>, empty, empty> type_v_595;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_596;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, var, empty, empty> type_v_597;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, std::vector<var>, empty, empty> type_v_598;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_599;
+
+typedef std::tuple<AgradDistributionParetoType2, type_v_500> AgradDistributionParetoType2_v_500;
+typedef std::tuple<AgradDistributionParetoType2, type_v_501> AgradDistributionParetoType2_v_501;
+typedef std::tuple<AgradDistributionParetoType2, type_v_502> AgradDistributionParetoType2_v_502;
+typedef std::tuple<AgradDistributionParetoType2, type_v_503> AgradDistributionParetoType2_v_503;
+typedef std::tuple<AgradDistributionParetoType2, type_v_504> AgradDistributionParetoType2_v_504;
+typedef std::tuple<AgradDistributionParetoType2, type_v_505> AgradDistributionParetoType2_v_505;
+typedef std::tuple<AgradDistributionParetoType2, type_v_506> AgradDistributionParetoType2_v_506;
+typedef std::tuple<AgradDistributionParetoType2, type_v_507> AgradDistributionParetoType2_v_507;
+typedef std::tuple<AgradDistributionParetoType2, type_v_508> AgradDistributionParetoType2_v_508;
+typedef std::tuple<AgradDistributionParetoType2, type_v_509> AgradDistributionParetoType2_v_509;
+typedef std::tuple<AgradDistributionParetoType2, type_v_510> AgradDistributionParetoType2_v_510;
+typedef std::tuple<AgradDistributionParetoType2, type_v_511> AgradDistributionParetoType2_v_511;
+typedef std::tuple<AgradDistributionParetoType2, type_v_512> AgradDistributionParetoType2_v_512;
+typedef std::tuple<AgradDistributionParetoType2, type_v_513> AgradDistributionParetoType2_v_513;
+typedef std::tuple<AgradDistributionParetoType2, type_v_514> AgradDistributionParetoType2_v_514;
+typedef std::tuple<AgradDistributionParetoType2, type_v_515> AgradDistributionParetoType2_v_515;
+typedef std::tuple<AgradDistributionParetoType2, type_v_516> AgradDistributionParetoType2_v_516;
+typedef std::tuple<AgradDistributionParetoType2, type_v_517> AgradDistributionParetoType2_v_517;
+typedef std::tuple<AgradDistributionParetoType2, type_v_518> AgradDistributionParetoType2_v_518;
+typedef std::tuple<AgradDistributionParetoType2, type_v_519> AgradDistributionParetoType2_v_519;
+typedef std::tuple<AgradDistributionParetoType2, type_v_520> AgradDistributionParetoType2_v_520;
+typedef std::tuple<AgradDistributionParetoType2, type_v_521> AgradDistributionParetoType2_v_521;
+typedef std::tuple<AgradDistributionParetoType2, type_v_522> AgradDistributionParetoType2_v_522;
+typedef std::tuple<AgradDistributionParetoType2, type_v_523> AgradDistributionParetoType2_v_523;
+typedef std::tuple<AgradDistributionParetoType2, type_v_524> AgradDistributionParetoType2_v_524;
+typedef std::tuple<AgradDistributionParetoType2, type_v_525> AgradDistributionParetoType2_v_525;
+typedef std::tuple<AgradDistributionParetoType2, type_v_526> AgradDistributionParetoType2_v_526;
+typedef std::tuple<AgradDistributionParetoType2, type_v_527> AgradDistributionParetoType2_v_527;
+typedef std::tuple<AgradDistributionParetoType2, type_v_528> AgradDistributionParetoType2_v_528;
+typedef std::tuple<AgradDistributionParetoType2, type_v_529> AgradDistributionParetoType2_v_529;
+typedef std::tuple<AgradDistributionParetoType2, type_v_530> AgradDistributionParetoType2_v_530;
+typedef std::tuple<AgradDistributionParetoType2, type_v_531> AgradDistributionParetoType2_v_531;
+typedef std::tuple<AgradDistributionParetoType2, type_v_532> AgradDistributionParetoType2_v_532;
+typedef std::tuple<AgradDistributionParetoType2, type_v_533> AgradDistributionParetoType2_v_533;
+typedef std::tuple<AgradDistributionParetoType2, type_v_534> AgradDistributionParetoType2_v_534;
+typedef std::tuple<AgradDistributionParetoType2, type_v_535> AgradDistributionParetoType2_v_535;
+typedef std::tuple<AgradDistributionParetoType2, type_v_536> AgradDistributionParetoType2_v_536;
+typedef std::tuple<AgradDistributionParetoType2, type_v_537> AgradDistributionParetoType2_v_537;
+typedef std::tuple<AgradDistributionParetoType2, type_v_538> AgradDistributionParetoType2_v_538;
+typedef std::tuple<AgradDistributionParetoType2, type_v_539> AgradDistributionParetoType2_v_539;
+typedef std::tuple<AgradDistributionParetoType2, type_v_540> AgradDistributionParetoType2_v_540;
+typedef std::tuple<AgradDistributionParetoType2, type_v_541> AgradDistributionParetoType2_v_541;
+typedef std::tuple<AgradDistributionParetoType2, type_v_542> AgradDistributionParetoType2_v_542;
+typedef std::tuple<AgradDistributionParetoType2, type_v_543> AgradDistributionParetoType2_v_543;
+typedef std::tuple<AgradDistributionParetoType2, type_v_544> AgradDistributionParetoType2_v_544;
+typedef std::tuple<AgradDistributionParetoType2, type_v_545> AgradDistributionParetoType2_v_545;
+typedef std::tuple<AgradDistributionParetoType2, type_v_546> AgradDistributionParetoType2_v_546;
+typedef std::tuple<AgradDistributionParetoType2, type_v_547> AgradDistributionParetoType2_v_547;
+typedef std::tuple<AgradDistributionParetoType2, type_v_548> AgradDistributionParetoType2_v_548;
+typedef std::tuple<AgradDistributionParetoType2, type_v_549> AgradDistributionParetoType2_v_549;
+typedef std::tuple<AgradDistributionParetoType2, type_v_550> AgradDistributionParetoType2_v_550;
+typedef std::tuple<AgradDistributionParetoType2, type_v_551> AgradDistributionParetoType2_v_551;
+typedef std::tuple<AgradDistributionParetoType2, type_v_552> AgradDistributionParetoType2_v_552;
+typedef std::tuple<AgradDistributionParetoType2, type_v_553> AgradDistributionParetoType2_v_553;
+typedef std::tuple<AgradDistributionParetoType2, type_v_554> AgradDistributionParetoType2_v_554;
+typedef std::tuple<AgradDistributionParetoType2, type_v_555> AgradDistributionParetoType2_v_555;
+typedef std::tuple<AgradDistributionParetoType2, type_v_556> AgradDistributionParetoType2_v_556;
+typedef std::tuple<AgradDistributionParetoType2, type_v_557> AgradDistributionParetoType2_v_557;
+typedef std::tuple<AgradDistributionParetoType2, type_v_558> AgradDistributionParetoType2_v_558;
+typedef std::tuple<AgradDistributionParetoType2, type_v_559> AgradDistributionParetoType2_v_559;
+typedef std::tuple<AgradDistributionParetoType2, type_v_560> AgradDistributionParetoType2_v_560;
+typedef std::tuple<AgradDistributionParetoType2, type_v_561> AgradDistributionParetoType2_v_561;
+typedef std::tuple<AgradDistributionParetoType2, type_v_562> AgradDistributionParetoType2_v_562;
+typedef std::tuple<AgradDistributionParetoType2, type_v_563> AgradDistributionParetoType2_v_563;
+typedef std::tuple<AgradDistributionParetoType2, type_v_564> AgradDistributionParetoType2_v_564;
+typedef std::tuple<AgradDistributionParetoType2, type_v_565> AgradDistributionParetoType2_v_565;
+typedef std::tuple<AgradDistributionParetoType2, type_v_566> AgradDistributionParetoType2_v_566;
+typedef std::tuple<AgradDistributionParetoType2, type_v_567> AgradDistributionParetoType2_v_567;
+typedef std::tuple<AgradDistributionParetoType2, type_v_568> AgradDistributionParetoType2_v_568;
+typedef std::tuple<AgradDistributionParetoType2, type_v_569> AgradDistributionParetoType2_v_569;
+typedef std::tuple<AgradDistributionParetoType2, type_v_570> AgradDistributionParetoType2_v_570;
+typedef std::tuple<AgradDistributionParetoType2, type_v_571> AgradDistributionParetoType2_v_571;
+typedef std::tuple<AgradDistributionParetoType2, type_v_572> AgradDistributionParetoType2_v_572;
+typedef std::tuple<AgradDistributionParetoType2, type_v_573> AgradDistributionParetoType2_v_573;
+typedef std::tuple<AgradDistributionParetoType2, type_v_574> AgradDistributionParetoType2_v_574;
+typedef std::tuple<AgradDistributionParetoType2, type_v_575> AgradDistributionParetoType2_v_575;
+typedef std::tuple<AgradDistributionParetoType2, type_v_576> AgradDistributionParetoType2_v_576;
+typedef std::tuple<AgradDistributionParetoType2, type_v_577> AgradDistributionParetoType2_v_577;
+typedef std::tuple<AgradDistributionParetoType2, type_v_578> AgradDistributionParetoType2_v_578;
+typedef std::tuple<AgradDistributionParetoType2, type_v_579> AgradDistributionParetoType2_v_579;
+typedef std::tuple<AgradDistributionParetoType2, type_v_580> AgradDistributionParetoType2_v_580;
+typedef std::tuple<AgradDistributionParetoType2, type_v_581> AgradDistributionParetoType2_v_581;
+typedef std::tuple<AgradDistributionParetoType2, type_v_582> AgradDistributionParetoType2_v_582;
+typedef std::tuple<AgradDistributionParetoType2, type_v_583> AgradDistributionParetoType2_v_583;
+typedef std::tuple<AgradDistributionParetoType2, type_v_584> AgradDistributionParetoType2_v_584;
+typedef std::tuple<AgradDistributionParetoType2, type_v_585> AgradDistributionParetoType2_v_585;
+typedef std::tuple<AgradDistributionParetoType2, type_v_586> AgradDistributionParetoType2_v_586;
+typedef std::tuple<AgradDistributionParetoType2, type_v_587> AgradDistributionParetoType2_v_587;
+typedef std::tuple<AgradDistributionParetoType2, type_v_588> AgradDistributionParetoType2_v_588;
+typedef std::tuple<AgradDistributionParetoType2, type_v_589> AgradDistributionParetoType2_v_589;
+typedef std::tuple<AgradDistributionParetoType2, type_v_590> AgradDistributionParetoType2_v_590;
+typedef std::tuple<AgradDistributionParetoType2, type_v_591> AgradDistributionParetoType2_v_591;
+typedef std::tuple<AgradDistributionParetoType2, type_v_592> AgradDistributionParetoType2_v_592;
+typedef std::tuple<AgradDistributionParetoType2, type_v_593> AgradDistributionParetoType2_v_593;
+typedef std::tuple<AgradDistributionParetoType2, type_v_594> AgradDistributionParetoType2_v_594;
+typedef std::tuple<AgradDistributionParetoType2, type_v_595> AgradDistributionParetoType2_v_595;
+typedef std::tuple<AgradDistributionParetoType2, type_v_596> AgradDistributionParetoType2_v_596;
+typedef std::tuple<AgradDistributionParetoType2, type_v_597> AgradDistributionParetoType2_v_597;
+typedef std::tuple<AgradDistributionParetoType2, type_v_598> AgradDistributionParetoType2_v_598;
+typedef std::tuple<AgradDistributionParetoType2, type_v_599> AgradDistributionParetoType2_v_599;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_500, AgradDistributionTestFixture, AgradDistributionParetoType2_v_500);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_501, AgradDistributionTestFixture, AgradDistributionParetoType2_v_501);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_502, AgradDistributionTestFixture, AgradDistributionParetoType2_v_502);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_503, AgradDistributionTestFixture, AgradDistributionParetoType2_v_503);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_504, AgradDistributionTestFixture, AgradDistributionParetoType2_v_504);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_505, AgradDistributionTestFixture, AgradDistributionParetoType2_v_505);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_506, AgradDistributionTestFixture, AgradDistributionParetoType2_v_506);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_507, AgradDistributionTestFixture, AgradDistributionParetoType2_v_507);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_508, AgradDistributionTestFixture, AgradDistributionParetoType2_v_508);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_509, AgradDistributionTestFixture, AgradDistributionParetoType2_v_509);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_510, AgradDistributionTestFixture, AgradDistributionParetoType2_v_510);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_511, AgradDistributionTestFixture, AgradDistributionParetoType2_v_511);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_512, AgradDistributionTestFixture, AgradDistributionParetoType2_v_512);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_513, AgradDistributionTestFixture, AgradDistributionParetoType2_v_513);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_514, AgradDistributionTestFixture, AgradDistributionParetoType2_v_514);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_515, AgradDistributionTestFixture, AgradDistributionParetoType2_v_515);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_516, AgradDistributionTestFixture, AgradDistributionParetoType2_v_516);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_517, AgradDistributionTestFixture, AgradDistributionParetoType2_v_517);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_518, AgradDistributionTestFixture, AgradDistributionParetoType2_v_518);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_519, AgradDistributionTestFixture, AgradDistributionParetoType2_v_519);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_520, AgradDistributionTestFixture, AgradDistributionParetoType2_v_520);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_521, AgradDistributionTestFixture, AgradDistributionParetoType2_v_521);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_522, AgradDistributionTestFixture, AgradDistributionParetoType2_v_522);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_523, AgradDistributionTestFixture, AgradDistributionParetoType2_v_523);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_524, AgradDistributionTestFixture, AgradDistributionParetoType2_v_524);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_525, AgradDistributionTestFixture, AgradDistributionParetoType2_v_525);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_526, AgradDistributionTestFixture, AgradDistributionParetoType2_v_526);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_527, AgradDistributionTestFixture, AgradDistributionParetoType2_v_527);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_528, AgradDistributionTestFixture, AgradDistributionParetoType2_v_528);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_529, AgradDistributionTestFixture, AgradDistributionParetoType2_v_529);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_530, AgradDistributionTestFixture, AgradDistributionParetoType2_v_530);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_531, AgradDistributionTestFixture, AgradDistributionParetoType2_v_531);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_532, AgradDistributionTestFixture, AgradDistributionParetoType2_v_532);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_533, AgradDistributionTestFixture, AgradDistributionParetoType2_v_533);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_534, AgradDistributionTestFixture, AgradDistributionParetoType2_v_534);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_535, AgradDistributionTestFixture, AgradDistributionParetoType2_v_535);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_536, AgradDistributionTestFixture, AgradDistributionParetoType2_v_536);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_537, AgradDistributionTestFixture, AgradDistributionParetoType2_v_537);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_538, AgradDistributionTestFixture, AgradDistributionParetoType2_v_538);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_539, AgradDistributionTestFixture, AgradDistributionParetoType2_v_539);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_540, AgradDistributionTestFixture, AgradDistributionParetoType2_v_540);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_541, AgradDistributionTestFixture, AgradDistributionParetoType2_v_541);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_542, AgradDistributionTestFixture, AgradDistributionParetoType2_v_542);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_543, AgradDistributionTestFixture, AgradDistributionParetoType2_v_543);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_544, AgradDistributionTestFixture, AgradDistributionParetoType2_v_544);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_545, AgradDistributionTestFixture, AgradDistributionParetoType2_v_545);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_546, AgradDistributionTestFixture, AgradDistributionParetoType2_v_546);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_547, AgradDistributionTestFixture, AgradDistributionParetoType2_v_547);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_548, AgradDistributionTestFixture, AgradDistributionParetoType2_v_548);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_549, AgradDistributionTestFixture, AgradDistributionParetoType2_v_549);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_550, AgradDistributionTestFixture, AgradDistributionParetoType2_v_550);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_551, AgradDistributionTestFixture, AgradDistributionParetoType2_v_551);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_552, AgradDistributionTestFixture, AgradDistributionParetoType2_v_552);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_553, AgradDistributionTestFixture, AgradDistributionParetoType2_v_553);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_554, AgradDistributionTestFixture, AgradDistributionParetoType2_v_554);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_555, AgradDistributionTestFixture, AgradDistributionParetoType2_v_555);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_556, AgradDistributionTestFixture, AgradDistributionParetoType2_v_556);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_557, AgradDistributionTestFixture, AgradDistributionParetoType2_v_557);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_558, AgradDistributionTestFixture, AgradDistributionParetoType2_v_558);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_559, AgradDistributionTestFixture, AgradDistributionParetoType2_v_559);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_560, AgradDistributionTestFixture, AgradDistributionParetoType2_v_560);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_561, AgradDistributionTestFixture, AgradDistributionParetoType2_v_561);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_562, AgradDistributionTestFixture, AgradDistributionParetoType2_v_562);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_563, AgradDistributionTestFixture, AgradDistributionParetoType2_v_563);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_564, AgradDistributionTestFixture, AgradDistributionParetoType2_v_564);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_565, AgradDistributionTestFixture, AgradDistributionParetoType2_v_565);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_566, AgradDistributionTestFixture, AgradDistributionParetoType2_v_566);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_567, AgradDistributionTestFixture, AgradDistributionParetoType2_v_567);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_568, AgradDistributionTestFixture, AgradDistributionParetoType2_v_568);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_569, AgradDistributionTestFixture, AgradDistributionParetoType2_v_569);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_570, AgradDistributionTestFixture, AgradDistributionParetoType2_v_570);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_571, AgradDistributionTestFixture, AgradDistributionParetoType2_v_571);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_572, AgradDistributionTestFixture, AgradDistributionParetoType2_v_572);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_573, AgradDistributionTestFixture, AgradDistributionParetoType2_v_573);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_574, AgradDistributionTestFixture, AgradDistributionParetoType2_v_574);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_575, AgradDistributionTestFixture, AgradDistributionParetoType2_v_575);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_576, AgradDistributionTestFixture, AgradDistributionParetoType2_v_576);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_577, AgradDistributionTestFixture, AgradDistributionParetoType2_v_577);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_578, AgradDistributionTestFixture, AgradDistributionParetoType2_v_578);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_579, AgradDistributionTestFixture, AgradDistributionParetoType2_v_579);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_580, AgradDistributionTestFixture, AgradDistributionParetoType2_v_580);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_581, AgradDistributionTestFixture, AgradDistributionParetoType2_v_581);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_582, AgradDistributionTestFixture, AgradDistributionParetoType2_v_582);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_583, AgradDistributionTestFixture, AgradDistributionParetoType2_v_583);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_584, AgradDistributionTestFixture, AgradDistributionParetoType2_v_584);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_585, AgradDistributionTestFixture, AgradDistributionParetoType2_v_585);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_586, AgradDistributionTestFixture, AgradDistributionParetoType2_v_586);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_587, AgradDistributionTestFixture, AgradDistributionParetoType2_v_587);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_588, AgradDistributionTestFixture, AgradDistributionParetoType2_v_588);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_589, AgradDistributionTestFixture, AgradDistributionParetoType2_v_589);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_590, AgradDistributionTestFixture, AgradDistributionParetoType2_v_590);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_591, AgradDistributionTestFixture, AgradDistributionParetoType2_v_591);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_592, AgradDistributionTestFixture, AgradDistributionParetoType2_v_592);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_593, AgradDistributionTestFixture, AgradDistributionParetoType2_v_593);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_594, AgradDistributionTestFixture, AgradDistributionParetoType2_v_594);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_595, AgradDistributionTestFixture, AgradDistributionParetoType2_v_595);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_596, AgradDistributionTestFixture, AgradDistributionParetoType2_v_596);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_597, AgradDistributionTestFixture, AgradDistributionParetoType2_v_597);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_598, AgradDistributionTestFixture, AgradDistributionParetoType2_v_598);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_599, AgradDistributionTestFixture, AgradDistributionParetoType2_v_599);
+
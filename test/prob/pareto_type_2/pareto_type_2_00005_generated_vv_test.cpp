@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_500;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, double, empty, empty> type_vv_501;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_vv_502;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_503;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, var, empty, empty> type_vv_504;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_vv_505;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_506;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_507;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_508;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_509;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_510;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_511;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_512;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, double, empty, empty> type_vv_513;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, std::vector<double>, empty, empty> type_vv_514;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_515;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, var, empty, empty> type_vv_516;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, std::vector<var>, empty, empty> type_vv_517;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_518;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, double, empty, empty> type_vv_519;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_vv_520;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_521;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, var, empty, empty> type_vv_522;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_vv_523;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_524;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_525;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_526;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_527;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_528;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_529;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_530;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, empty, empty> type_vv_531;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, empty, empty> type_vv_532;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_533;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, empty, empty> type_vv_534;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, empty, empty> type_vv_535;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_536;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, empty, empty> type_vv_537;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, empty, empty> type_vv_538;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_539;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, empty, empty> type_vv_540;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, empty, empty> type_vv_541;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_542;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_543;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_544;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_545;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_546;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_547;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_548;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, empty, empty> type_vv_549;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, empty, empty> type_vv_550;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_551;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, empty, empty> type_vv_552;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, empty, empty> type_vv_553;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_554;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, empty, empty> type_vv_555;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, empty, empty> type_vv_556;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_557;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, empty, empty> type_vv_558;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, empty, empty> type_vv_559;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_560;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_561;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_562;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_563;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_564;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_565;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_566;
+typedef std::tuple<var, double, double, double, empty, empty> type_vv_567;
+typedef std::tuple<var, double, double, std::vector<double>, empty, empty> type_vv_568;
+typedef std::tuple<var, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_569;
+typedef std::tuple<var, double, double, var, empty, empty> type_vv_570;
+typedef std::tuple<var, double, double, std::vector<var>, empty, empty> type_vv_571;
+typedef std::tuple<var, double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_572;
+typedef std::tuple<var, double, std::vector<double>, double, empty, empty> type_vv_573;
+typedef std::tuple<var, double, std::vector<double>, std::vector<double>, empty, empty> type_vv_574;
+typedef std::tuple<var, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_575;
+typedef std::tuple<var, double, std::vector<double>, var, empty, empty> type_vv_576;
+typedef std::tuple<var, double, std::vector<double>, std::vector<var>, empty, empty> type_vv_577;
+typedef std::tuple<var, double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_578;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_579;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_580;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_581;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_582;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_583;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_584;
+typedef std::tuple<var, double, var, double, empty, empty> type_vv_585;
+typedef std::tuple<var, double, var, std::vector<double>, empty, empty> type_vv_586;
+typedef std::tuple<var, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_587;
+typedef std::tuple<var, double, var, var, empty, empty> type_vv_588;
+typedef std::tuple<var, double, var, std::vector<var>, empty, empty> type_vv_589;
+typedef std::tuple<var, double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_590;
+typedef std::tuple<var, double, std::vector<var>, double, empty, empty> type_vv_591;
+typedef std::tuple<var, double, std::vector<var>, std::vector<double>, empty, empty> type_vv_592;
+typedef std::tuple<var, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_593;
+typedef std::tuple<var, double, std::vector<var>, var, empty, empty> type_vv_594;
+typedef std::tuple<var, double, std::vector<var>, std::vector<var>, empty, empty> type_vv_595;
+typedef std::tuple<var, double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_596;
+typedef std::tuple<var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_597;
+typedef std::tuple<var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_598;
+typedef std::tuple<var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_599;
+
+typedef std::tuple<AgradDistributionParetoType2, type_vv_500> AgradDistributionParetoType2_vv_500;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_501> AgradDistributionParetoType2_vv_501;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_502> AgradDistributionParetoType2_vv_502;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_503> AgradDistributionParetoType2_vv_503;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_504> AgradDistributionParetoType2_vv_504;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_505> AgradDistributionParetoType2_vv_505;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_506> AgradDistributionParetoType2_vv_506;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_507> AgradDistributionParetoType2_vv_507;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_508> AgradDistributionParetoType2_vv_508;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_509> AgradDistributionParetoType2_vv_509;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_510> AgradDistributionParetoType2_vv_510;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_511> AgradDistributionParetoType2_vv_511;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_512> AgradDistributionParetoType2_vv_512;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_513> AgradDistributionParetoType2_vv_513;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_514> AgradDistributionParetoType2_vv_514;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_515> AgradDistributionParetoType2_vv_515;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_516> AgradDistributionParetoType2_vv_516;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_517> AgradDistributionParetoType2_vv_517;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_518> AgradDistributionParetoType2_vv_518;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_519> AgradDistributionParetoType2_vv_519;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_520> AgradDistributionParetoType2_vv_520;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_521> AgradDistributionParetoType2_vv_521;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_522> AgradDistributionParetoType2_vv_522;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_523> AgradDistributionParetoType2_vv_523;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_524> AgradDistributionParetoType2_vv_524;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_525> AgradDistributionParetoType2_vv_525;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_526> AgradDistributionParetoType2_vv_526;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_527> AgradDistributionParetoType2_vv_527;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_528> AgradDistributionParetoType2_vv_528;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_529> AgradDistributionParetoType2_vv_529;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_530> AgradDistributionParetoType2_vv_530;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_531> AgradDistributionParetoType2_vv_531;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_532> AgradDistributionParetoType2_vv_532;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_533> AgradDistributionParetoType2_vv_533;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_534> AgradDistributionParetoType2_vv_534;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_535> AgradDistributionParetoType2_vv_535;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_536> AgradDistributionParetoType2_vv_536;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_537> AgradDistributionParetoType2_vv_537;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_538> AgradDistributionParetoType2_vv_538;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_539> AgradDistributionParetoType2_vv_539;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_540> AgradDistributionParetoType2_vv_540;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_541> AgradDistributionParetoType2_vv_541;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_542> AgradDistributionParetoType2_vv_542;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_543> AgradDistributionParetoType2_vv_543;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_544> AgradDistributionParetoType2_vv_544;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_545> AgradDistributionParetoType2_vv_545;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_546> AgradDistributionParetoType2_vv_546;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_547> AgradDistributionParetoType2_vv_547;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_548> AgradDistributionParetoType2_vv_548;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_549> AgradDistributionParetoType2_vv_549;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_550> AgradDistributionParetoType2_vv_550;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_551> AgradDistributionParetoType2_vv_551;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_552> AgradDistributionParetoType2_vv_552;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_553> AgradDistributionParetoType2_vv_553;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_554> AgradDistributionParetoType2_vv_554;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_555> AgradDistributionParetoType2_vv_555;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_556> AgradDistributionParetoType2_vv_556;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_557> AgradDistributionParetoType2_vv_557;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_558> AgradDistributionParetoType2_vv_558;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_559> AgradDistributionParetoType2_vv_559;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_560> AgradDistributionParetoType2_vv_560;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_561> AgradDistributionParetoType2_vv_561;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_562> AgradDistributionParetoType2_vv_562;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_563> AgradDistributionParetoType2_vv_563;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_564> AgradDistributionParetoType2_vv_564;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_565> AgradDistributionParetoType2_vv_565;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_566> AgradDistributionParetoType2_vv_566;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_567> AgradDistributionParetoType2_vv_567;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_568> AgradDistributionParetoType2_vv_568;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_569> AgradDistributionParetoType2_vv_569;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_570> AgradDistributionParetoType2_vv_570;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_571> AgradDistributionParetoType2_vv_571;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_572> AgradDistributionParetoType2_vv_572;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_573> AgradDistributionParetoType2_vv_573;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_574> AgradDistributionParetoType2_vv_574;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_575> AgradDistributionParetoType2_vv_575;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_576> AgradDistributionParetoType2_vv_576;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_577> AgradDistributionParetoType2_vv_577;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_578> AgradDistributionParetoType2_vv_578;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_579> AgradDistributionParetoType2_vv_579;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_580> AgradDistributionParetoType2_vv_580;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_581> AgradDistributionParetoType2_vv_581;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_582> AgradDistributionParetoType2_vv_582;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_583> AgradDistributionParetoType2_vv_583;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_584> AgradDistributionParetoType2_vv_584;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_585> AgradDistributionParetoType2_vv_585;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_586> AgradDistributionParetoType2_vv_586;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_587> AgradDistributionParetoType2_vv_587;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_588> AgradDistributionParetoType2_vv_588;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_589> AgradDistributionParetoType2_vv_589;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_590> AgradDistributionParetoType2_vv_590;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_591> AgradDistributionParetoType2_vv_591;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_592> AgradDistributionParetoType2_vv_592;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_593> AgradDistributionParetoType2_vv_593;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_594> AgradDistributionParetoType2_vv_594;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_595> AgradDistributionParetoType2_vv_595;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_596> AgradDistributionParetoType2_vv_596;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_597> AgradDistributionParetoType2_vv_597;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_598> AgradDistributionParetoType2_vv_598;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_599> AgradDistributionParetoType2_vv_599;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_500, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_500);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_501, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_501);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_502, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_502);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_503, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_503);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_504, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_504);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_505, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_505);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_506, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_506);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_507, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_507);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_508, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_508);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_509, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_509);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_510, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_510);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_511, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_511);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_512, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_512);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_513, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_513);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_514, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_514);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_515, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_515);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_516, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_516);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_517, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_517);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_518, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_518);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_519, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_519);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_520, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_520);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_521, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_521);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_522, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_522);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_523, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_523);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_524, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_524);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_525, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_525);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_526, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_526);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_527, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_527);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_528, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_528);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_529, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_529);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_530, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_530);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_531, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_531);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_532, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_532);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_533, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_533);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_534, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_534);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_535, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_535);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_536, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_536);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_537, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_537);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_538, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_538);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_539, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_539);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_540, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_540);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_541, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_541);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_542, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_542);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_543, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_543);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_544, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_544);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_545, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_545);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_546, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_546);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_547, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_547);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_548, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_548);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_549, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_549);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_550, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_550);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_551, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_551);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_552, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_552);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_553, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_553);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_554, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_554);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_555, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_555);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_556, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_556);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_557, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_557);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_558, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_558);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_559, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_559);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_560, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_560);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_561, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_561);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_562, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_562);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_563, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_563);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_564, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_564);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_565, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_565);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_566, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_566);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_567, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_567);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_568, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_568);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_569, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_569);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_570, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_570);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_571, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_571);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_572, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_572);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_573, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_573);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_574, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_574);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_575, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_575);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_576, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_576);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_577, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_577);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_578, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_578);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_579, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_579);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_580, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_580);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_581, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_581);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_582, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_582);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_583, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_583);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_584, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_584);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_585, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_585);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_586, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_586);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_587, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_587);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_588, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_588);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_589, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_589);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_590, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_590);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_591, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_591);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_592, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_592);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_593, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_593);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_594, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_594);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_595, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_595);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_596, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_596);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_597, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_597);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_598, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_598);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_599, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_599);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_test.hpp>
+
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_600;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_601;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_602;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, double, double, empty, empty> type_ffv_603;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, double, std::vector<double>, empty, empty> type_ffv_604;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_605;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, double, fvar<fvar<var> >, empty, empty> type_ffv_606;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_607;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_608;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<double>, double, empty, empty> type_ffv_609;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_610;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_611;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_612;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_613;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_614;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_615;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_616;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_617;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_618;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_619;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_620;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, double, empty, empty> type_ffv_621;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_622;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_623;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_624;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_625;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_626;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_627;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_628;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_629;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_630;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_631;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_632;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_633;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_634;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_635;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_636;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_637;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_638;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty> type_ffv_639;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_ffv_640;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_641;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_642;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_643;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_644;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_ffv_645;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_646;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_647;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_648;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_649;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_650;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_651;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_652;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_653;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_654;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_655;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_656;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_657;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_658;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_659;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_660;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_661;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_662;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_663;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_664;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_665;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_666;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_667;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_668;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_669;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_670;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_671;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_672;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_673;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_674;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, double, double, empty, empty> type_ffv_675;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, double, std::vector<double>, empty, empty> type_ffv_676;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_677;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, double, fvar<fvar<var> >, empty, empty> type_ffv_678;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_679;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_680;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, double, empty, empty> type_ffv_681;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty, empty> type_ffv_682;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_683;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_684;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_685;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_686;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_687;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_688;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_689;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_690;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_691;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_692;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, double, empty, empty> type_ffv_693;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_694;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_695;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_696;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_697;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_698;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_699;
+
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_600> AgradDistributionParetoType2_ffv_600;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_601> AgradDistributionParetoType2_ffv_601;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_602> AgradDistributionParetoType2_ffv_602;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_603> AgradDistributionParetoType2_ffv_603;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_604> AgradDistributionParetoType2_ffv_604;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_605> AgradDistributionParetoType2_ffv_605;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_606> AgradDistributionParetoType2_ffv_606;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_607> AgradDistributionParetoType2_ffv_607;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_608> AgradDistributionParetoType2_ffv_608;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_609> AgradDistributionParetoType2_ffv_609;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_610> AgradDistributionParetoType2_ffv_610;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_611> AgradDistributionParetoType2_ffv_611;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_612> AgradDistributionParetoType2_ffv_612;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_613> AgradDistributionParetoType2_ffv_613;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_614> AgradDistributionParetoType2_ffv_614;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_615> AgradDistributionParetoType2_ffv_615;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_616> AgradDistributionParetoType2_ffv_616;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_617> AgradDistributionParetoType2_ffv_617;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_618> AgradDistributionParetoType2_ffv_618;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_619> AgradDistributionParetoType2_ffv_619;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_620> AgradDistributionParetoType2_ffv_620;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_621> AgradDistributionParetoType2_ffv_621;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_622> AgradDistributionParetoType2_ffv_622;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_623> AgradDistributionParetoType2_ffv_623;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_624> AgradDistributionParetoType2_ffv_624;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_625> AgradDistributionParetoType2_ffv_625;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_626> AgradDistributionParetoType2_ffv_626;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_627> AgradDistributionParetoType2_ffv_627;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_628> AgradDistributionParetoType2_ffv_628;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_629> AgradDistributionParetoType2_ffv_629;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_630> AgradDistributionParetoType2_ffv_630;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_631> AgradDistributionParetoType2_ffv_631;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_632> AgradDistributionParetoType2_ffv_632;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_633> AgradDistributionParetoType2_ffv_633;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_634> AgradDistributionParetoType2_ffv_634;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_635> AgradDistributionParetoType2_ffv_635;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_636> AgradDistributionParetoType2_ffv_636;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_637> AgradDistributionParetoType2_ffv_637;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_638> AgradDistributionParetoType2_ffv_638;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_639> AgradDistributionParetoType2_ffv_639;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_640> AgradDistributionParetoType2_ffv_640;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_641> AgradDistributionParetoType2_ffv_641;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_642> AgradDistributionParetoType2_ffv_642;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_643> AgradDistributionParetoType2_ffv_643;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_644> AgradDistributionParetoType2_ffv_644;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_645> AgradDistributionParetoType2_ffv_645;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_646> AgradDistributionParetoType2_ffv_646;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_647> AgradDistributionParetoType2_ffv_647;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_648> AgradDistributionParetoType2_ffv_648;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_649> AgradDistributionParetoType2_ffv_649;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_650> AgradDistributionParetoType2_ffv_650;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_651> AgradDistributionParetoType2_ffv_651;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_652> AgradDistributionParetoType2_ffv_652;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_653> AgradDistributionParetoType2_ffv_653;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_654> AgradDistributionParetoType2_ffv_654;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_655> AgradDistributionParetoType2_ffv_655;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_656> AgradDistributionParetoType2_ffv_656;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_657> AgradDistributionParetoType2_ffv_657;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_658> AgradDistributionParetoType2_ffv_658;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_659> AgradDistributionParetoType2_ffv_659;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_660> AgradDistributionParetoType2_ffv_660;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_661> AgradDistributionParetoType2_ffv_661;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_662> AgradDistributionParetoType2_ffv_662;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_663> AgradDistributionParetoType2_ffv_663;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_664> AgradDistributionParetoType2_ffv_664;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_665> AgradDistributionParetoType2_ffv_665;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_666> AgradDistributionParetoType2_ffv_666;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_667> AgradDistributionParetoType2_ffv_667;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_668> AgradDistributionParetoType2_ffv_668;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_669> AgradDistributionParetoType2_ffv_669;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_670> AgradDistributionParetoType2_ffv_670;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_671> AgradDistributionParetoType2_ffv_671;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_672> AgradDistributionParetoType2_ffv_672;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_673> AgradDistributionParetoType2_ffv_673;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_674> AgradDistributionParetoType2_ffv_674;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_675> AgradDistributionParetoType2_ffv_675;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_676> AgradDistributionParetoType2_ffv_676;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_677> AgradDistributionParetoType2_ffv_677;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_678> AgradDistributionParetoType2_ffv_678;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_679> AgradDistributionParetoType2_ffv_679;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_680> AgradDistributionParetoType2_ffv_680;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_681> AgradDistributionParetoType2_ffv_681;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_682> AgradDistributionParetoType2_ffv_682;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_683> AgradDistributionParetoType2_ffv_683;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_684> AgradDistributionParetoType2_ffv_684;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_685> AgradDistributionParetoType2_ffv_685;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_686> AgradDistributionParetoType2_ffv_686;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_687> AgradDistributionParetoType2_ffv_687;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_688> AgradDistributionParetoType2_ffv_688;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_689> AgradDistributionParetoType2_ffv_689;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_690> AgradDistributionParetoType2_ffv_690;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_691> AgradDistributionParetoType2_ffv_691;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_692> AgradDistributionParetoType2_ffv_692;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_693> AgradDistributionParetoType2_ffv_693;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_694> AgradDistributionParetoType2_ffv_694;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_695> AgradDistributionParetoType2_ffv_695;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_696> AgradDistributionParetoType2_ffv_696;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_697> AgradDistributionParetoType2_ffv_697;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_698> AgradDistributionParetoType2_ffv_698;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_699> AgradDistributionParetoType2_ffv_699;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_600, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_600);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_601, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_601);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_602, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_602);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_603, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_603);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_604, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_604);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_605, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_605);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_606, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_606);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_607, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_607);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_608, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_608);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_609, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_609);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_610, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_610);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_611, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_611);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_612, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_612);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_613, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_613);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_614, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_614);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_615, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_615);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_616, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_616);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_617, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_617);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_618, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_618);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_619, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_619);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_620, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_620);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_621, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_621);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_622, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_622);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_623, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_623);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_624, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_624);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_625, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_625);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_626, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_626);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_627, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_627);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_628, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_628);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_629, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_629);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_630, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_630);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_631, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_631);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_632, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_632);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_633, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_633);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_634, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_634);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_635, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_635);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_636, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_636);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_637, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_637);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_638, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_638);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_639, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_639);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_640, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_640);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_641, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_641);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_642, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_642);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_643, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_643);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_644, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_644);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_645, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_645);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_646, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_646);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_647, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_647);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_648, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_648);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_649, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_649);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_650, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_650);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_651, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_651);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_652, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_652);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_653, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_653);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_654, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_654);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_655, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_655);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_656, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_656);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_657, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_657);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_658, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_658);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_659, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_659);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_660, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_660);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_661, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_661);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_662, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_662);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_663, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_663);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_664, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_664);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_665, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_665);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_666, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_666);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_667, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_667);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_668, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_668);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_669, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_669);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_670, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_670);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_671, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_671);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_672, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_672);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_673, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_673);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_674, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_674);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_675, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_675);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_676, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_676);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_677, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_677);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_678, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_678);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_679, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_679);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_680, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_680);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_681, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_681);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_682, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_682);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_683, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_683);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_684, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_684);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_685, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_685);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_686, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_686);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_687, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_687);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_688, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_688);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_689, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_689);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_690, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_690);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_691, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_691);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_692, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_692);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_693, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_693);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_694, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_694);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_695, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_695);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_696, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_696);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_697, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_697);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_698, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_698);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_699, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_699);
+
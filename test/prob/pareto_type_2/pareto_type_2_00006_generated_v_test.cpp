@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, double, empty, empty> type_v_600;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_v_601;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_602;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, var, empty, empty> type_v_603;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_v_604;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_605;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_606;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_607;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_608;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_609;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_610;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_611;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_612;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_613;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_614;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_615;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_616;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_617;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_618;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_619;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_620;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_621;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_622;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_623;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_624;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_625;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_626;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_627;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_628;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_629;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_630;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_631;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_632;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_633;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_634;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_635;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_636;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_637;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_638;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_639;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_640;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_641;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_642;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_643;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_644;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_645;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_646;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_647;
+typedef std::tuple<var, double, double, double, empty, empty> type_v_648;
+typedef std::tuple<var, double, double, std::vector<double>, empty, empty> type_v_649;
+typedef std::tuple<var, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_650;
+typedef std::tuple<var, double, double, var, empty, empty> type_v_651;
+typedef std::tuple<var, double, double, std::vector<var>, empty, empty> type_v_652;
+typedef std::tuple<var, double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_653;
+typedef std::tuple<var, double, std::vector<double>, double, empty, empty> type_v_654;
+typedef std::tuple<var, double, std::vector<double>, std::vector<double>, empty, empty> type_v_655;
+typedef std::tuple<var, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_656;
+typedef std::tuple<var, double, std::vector<double>, var, empty, empty> type_v_657;
+typedef std::tuple<var, double, std::vector<double>, std::vector<var>, empty, empty> type_v_658;
+typedef std::tuple<var, double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_659;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_660;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_661;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_662;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_663;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_664;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_665;
+typedef std::tuple<var, double, var, double, empty, empty> type_v_666;
+typedef std::tuple<var, double, var, std::vector<double>, empty, empty> type_v_667;
+typedef std::tuple<var, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_668;
+typedef std::tuple<var, double, var, var, empty, empty> type_v_669;
+typedef std::tuple<var, double, var, std::vector<var>, empty, empty> type_v_670;
+typedef std::tuple<var, double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_671;
+typedef std::tuple<var, double, std::vector<var>, double, empty, empty> type_v_672;
+typedef std::tuple<var, double, std::vector<var>, std::vector<double>, empty, empty> type_v_673;
+typedef std::tuple<var, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_674;
+typedef std::tuple<var, double, std::vector<var>, var, empty, empty> type_v_675;
+typedef std::tuple<var, double, std::vector<var>, std::vector<var>, empty, empty> type_v_676;
+typedef std::tuple<var, double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_677;
+typedef std::tuple<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_678;
+typedef std::tuple<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_679;
+typedef std::tuple<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_680;
+typedef std::tuple<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_681;
+typedef std::tuple<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_682;
+typedef std::tuple<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_683;
+typedef std::tuple<var, std::vector<double>, double, double, empty, empty> type_v_684;
+typedef std::tuple<var, std::vector<double>, double, std::vector<double>, empty, empty> type_v_685;
+typedef std::tuple<var, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_686;
+typedef std::tuple<var, std::vector<double>, double, var, empty, empty> type_v_687;
+typedef std::tuple<var, std::vector<double>, double, std::vector<var>, empty, empty> type_v_688;
+typedef std::tuple<var, std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_689;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, double, empty, empty> type_v_690;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, std::vector<double>, empty, empty> type_v_691;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_692;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, var, empty, empty> type_v_693;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_v_694;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_695;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_696;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_697;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_698;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_699;
+
+typedef std::tuple<AgradDistributionParetoType2, type_v_600> AgradDistributionParetoType2_v_600;
+typedef std::tuple<AgradDistributionParetoType2, type_v_601> AgradDistributionParetoType2_v_601;
+typedef std::tuple<AgradDistributionParetoType2, type_v_602> AgradDistributionParetoType2_v_602;
+typedef std::tuple<AgradDistributionParetoType2, type_v_603> AgradDistributionParetoType2_v_603;
+typedef std::tuple<AgradDistributionParetoType2, type_v_604> AgradDistributionParetoType2_v_604;
+typedef std::tuple<AgradDistributionParetoType2, type_v_605> AgradDistributionParetoType2_v_605;
+typedef std::tuple<AgradDistributionParetoType2, type_v_606> AgradDistributionParetoType2_v_606;
+typedef std::tuple<AgradDistributionParetoType2, type_v_607> AgradDistributionParetoType2_v_607;
+typedef std::tuple<AgradDistributionParetoType2, type_v_608> AgradDistributionParetoType2_v_608;
+typedef std::tuple<AgradDistributionParetoType2, type_v_609> AgradDistributionParetoType2_v_609;
+typedef std::tuple<AgradDistributionParetoType2, type_v_610> AgradDistributionParetoType2_v_610;
+typedef std::tuple<AgradDistributionParetoType2, type_v_611> AgradDistributionParetoType2_v_611;
+typedef std::tuple<AgradDistributionParetoType2, type_v_612> AgradDistributionParetoType2_v_612;
+typedef std::tuple<AgradDistributionParetoType2, type_v_613> AgradDistributionParetoType2_v_613;
+typedef std::tuple<AgradDistributionParetoType2, type_v_614> AgradDistributionParetoType2_v_614;
+typedef std::tuple<AgradDistributionParetoType2, type_v_615> AgradDistributionParetoType2_v_615;
+typedef std::tuple<AgradDistributionParetoType2, type_v_616> AgradDistributionParetoType2_v_616;
+typedef std::tuple<AgradDistributionParetoType2, type_v_617> AgradDistributionParetoType2_v_617;
+typedef std::tuple<AgradDistributionParetoType2, type_v_618> AgradDistributionParetoType2_v_618;
+typedef std::tuple<AgradDistributionParetoType2, type_v_619> AgradDistributionParetoType2_v_619;
+typedef std::tuple<AgradDistributionParetoType2, type_v_620> AgradDistributionParetoType2_v_620;
+typedef std::tuple<AgradDistributionParetoType2, type_v_621> AgradDistributionParetoType2_v_621;
+typedef std::tuple<AgradDistributionParetoType2, type_v_622> AgradDistributionParetoType2_v_622;
+typedef std::tuple<AgradDistributionParetoType2, type_v_623> AgradDistributionParetoType2_v_623;
+typedef std::tuple<AgradDistributionParetoType2, type_v_624> AgradDistributionParetoType2_v_624;
+typedef std::tuple<AgradDistributionParetoType2, type_v_625> AgradDistributionParetoType2_v_625;
+typedef std::tuple<AgradDistributionParetoType2, type_v_626> AgradDistributionParetoType2_v_626;
+typedef std::tuple<AgradDistributionParetoType2, type_v_627> AgradDistributionParetoType2_v_627;
+typedef std::tuple<AgradDistributionParetoType2, type_v_628> AgradDistributionParetoType2_v_628;
+typedef std::tuple<AgradDistributionParetoType2, type_v_629> AgradDistributionParetoType2_v_629;
+typedef std::tuple<AgradDistributionParetoType2, type_v_630> AgradDistributionParetoType2_v_630;
+typedef std::tuple<AgradDistributionParetoType2, type_v_631> AgradDistributionParetoType2_v_631;
+typedef std::tuple<AgradDistributionParetoType2, type_v_632> AgradDistributionParetoType2_v_632;
+typedef std::tuple<AgradDistributionParetoType2, type_v_633> AgradDistributionParetoType2_v_633;
+typedef std::tuple<AgradDistributionParetoType2, type_v_634> AgradDistributionParetoType2_v_634;
+typedef std::tuple<AgradDistributionParetoType2, type_v_635> AgradDistributionParetoType2_v_635;
+typedef std::tuple<AgradDistributionParetoType2, type_v_636> AgradDistributionParetoType2_v_636;
+typedef std::tuple<AgradDistributionParetoType2, type_v_637> AgradDistributionParetoType2_v_637;
+typedef std::tuple<AgradDistributionParetoType2, type_v_638> AgradDistributionParetoType2_v_638;
+typedef std::tuple<AgradDistributionParetoType2, type_v_639> AgradDistributionParetoType2_v_639;
+typedef std::tuple<AgradDistributionParetoType2, type_v_640> AgradDistributionParetoType2_v_640;
+typedef std::tuple<AgradDistributionParetoType2, type_v_641> AgradDistributionParetoType2_v_641;
+typedef std::tuple<AgradDistributionParetoType2, type_v_642> AgradDistributionParetoType2_v_642;
+typedef std::tuple<AgradDistributionParetoType2, type_v_643> AgradDistributionParetoType2_v_643;
+typedef std::tuple<AgradDistributionParetoType2, type_v_644> AgradDistributionParetoType2_v_644;
+typedef std::tuple<AgradDistributionParetoType2, type_v_645> AgradDistributionParetoType2_v_645;
+typedef std::tuple<AgradDistributionParetoType2, type_v_646> AgradDistributionParetoType2_v_646;
+typedef std::tuple<AgradDistributionParetoType2, type_v_647> AgradDistributionParetoType2_v_647;
+typedef std::tuple<AgradDistributionParetoType2, type_v_648> AgradDistributionParetoType2_v_648;
+typedef std::tuple<AgradDistributionParetoType2, type_v_649> AgradDistributionParetoType2_v_649;
+typedef std::tuple<AgradDistributionParetoType2, type_v_650> AgradDistributionParetoType2_v_650;
+typedef std::tuple<AgradDistributionParetoType2, type_v_651> AgradDistributionParetoType2_v_651;
+typedef std::tuple<AgradDistributionParetoType2, type_v_652> AgradDistributionParetoType2_v_652;
+typedef std::tuple<AgradDistributionParetoType2, type_v_653> AgradDistributionParetoType2_v_653;
+typedef std::tuple<AgradDistributionParetoType2, type_v_654> AgradDistributionParetoType2_v_654;
+typedef std::tuple<AgradDistributionParetoType2, type_v_655> AgradDistributionParetoType2_v_655;
+typedef std::tuple<AgradDistributionParetoType2, type_v_656> AgradDistributionParetoType2_v_656;
+typedef std::tuple<AgradDistributionParetoType2, type_v_657> AgradDistributionParetoType2_v_657;
+typedef std::tuple<AgradDistributionParetoType2, type_v_658> AgradDistributionParetoType2_v_658;
+typedef std::tuple<AgradDistributionParetoType2, type_v_659> AgradDistributionParetoType2_v_659;
+typedef std::tuple<AgradDistributionParetoType2, type_v_660> AgradDistributionParetoType2_v_660;
+typedef std::tuple<AgradDistributionParetoType2, type_v_661> AgradDistributionParetoType2_v_661;
+typedef std::tuple<AgradDistributionParetoType2, type_v_662> AgradDistributionParetoType2_v_662;
+typedef std::tuple<AgradDistributionParetoType2, type_v_663> AgradDistributionParetoType2_v_663;
+typedef std::tuple<AgradDistributionParetoType2, type_v_664> AgradDistributionParetoType2_v_664;
+typedef std::tuple<AgradDistributionParetoType2, type_v_665> AgradDistributionParetoType2_v_665;
+typedef std::tuple<AgradDistributionParetoType2, type_v_666> AgradDistributionParetoType2_v_666;
+typedef std::tuple<AgradDistributionParetoType2, type_v_667> AgradDistributionParetoType2_v_667;
+typedef std::tuple<AgradDistributionParetoType2, type_v_668> AgradDistributionParetoType2_v_668;
+typedef std::tuple<AgradDistributionParetoType2, type_v_669> AgradDistributionParetoType2_v_669;
+typedef std::tuple<AgradDistributionParetoType2, type_v_670> AgradDistributionParetoType2_v_670;
+typedef std::tuple<AgradDistributionParetoType2, type_v_671> AgradDistributionParetoType2_v_671;
+typedef std::tuple<AgradDistributionParetoType2, type_v_672> AgradDistributionParetoType2_v_672;
+typedef std::tuple<AgradDistributionParetoType2, type_v_673> AgradDistributionParetoType2_v_673;
+typedef std::tuple<AgradDistributionParetoType2, type_v_674> AgradDistributionParetoType2_v_674;
+typedef std::tuple<AgradDistributionParetoType2, type_v_675> AgradDistributionParetoType2_v_675;
+typedef std::tuple<AgradDistributionParetoType2, type_v_676> AgradDistributionParetoType2_v_676;
+typedef std::tuple<AgradDistributionParetoType2, type_v_677> AgradDistributionParetoType2_v_677;
+typedef std::tuple<AgradDistributionParetoType2, type_v_678> AgradDistributionParetoType2_v_678;
+typedef std::tuple<AgradDistributionParetoType2, type_v_679> AgradDistributionParetoType2_v_679;
+typedef std::tuple<AgradDistributionParetoType2, type_v_680> AgradDistributionParetoType2_v_680;
+typedef std::tuple<AgradDistributionParetoType2, type_v_681> AgradDistributionParetoType2_v_681;
+typedef std::tuple<AgradDistributionParetoType2, type_v_682> AgradDistributionParetoType2_v_682;
+typedef std::tuple<AgradDistributionParetoType2, type_v_683> AgradDistributionParetoType2_v_683;
+typedef std::tuple<AgradDistributionParetoType2, type_v_684> AgradDistributionParetoType2_v_684;
+typedef std::tuple<AgradDistributionParetoType2, type_v_685> AgradDistributionParetoType2_v_685;
+typedef std::tuple<AgradDistributionParetoType2, type_v_686> AgradDistributionParetoType2_v_686;
+typedef std::tuple<AgradDistributionParetoType2, type_v_687> AgradDistributionParetoType2_v_687;
+typedef std::tuple<AgradDistributionParetoType2, type_v_688> AgradDistributionParetoType2_v_688;
+typedef std::tuple<AgradDistributionParetoType2, type_v_689> AgradDistributionParetoType2_v_689;
+typedef std::tuple<AgradDistributionParetoType2, type_v_690> AgradDistributionParetoType2_v_690;
+typedef std::tuple<AgradDistributionParetoType2, type_v_691> AgradDistributionParetoType2_v_691;
+typedef std::tuple<AgradDistributionParetoType2, type_v_692> AgradDistributionParetoType2_v_692;
+typedef std::tuple<AgradDistributionParetoType2, type_v_693> AgradDistributionParetoType2_v_693;
+typedef std::tuple<AgradDistributionParetoType2, type_v_694> AgradDistributionParetoType2_v_694;
+typedef std::tuple<AgradDistributionParetoType2, type_v_695> AgradDistributionParetoType2_v_695;
+typedef std::tuple<AgradDistributionParetoType2, type_v_696> AgradDistributionParetoType2_v_696;
+typedef std::tuple<AgradDistributionParetoType2, type_v_697> AgradDistributionParetoType2_v_697;
+typedef std::tuple<AgradDistributionParetoType2, type_v_698> AgradDistributionParetoType2_v_698;
+typedef std::tuple<AgradDistributionParetoType2, type_v_699> AgradDistributionParetoType2_v_699;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_600, AgradDistributionTestFixture, AgradDistributionParetoType2_v_600);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_601, AgradDistributionTestFixture, AgradDistributionParetoType2_v_601);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_602, AgradDistributionTestFixture, AgradDistributionParetoType2_v_602);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_603, AgradDistributionTestFixture, AgradDistributionParetoType2_v_603);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_604, AgradDistributionTestFixture, AgradDistributionParetoType2_v_604);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_605, AgradDistributionTestFixture, AgradDistributionParetoType2_v_605);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_606, AgradDistributionTestFixture, AgradDistributionParetoType2_v_606);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_607, AgradDistributionTestFixture, AgradDistributionParetoType2_v_607);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_608, AgradDistributionTestFixture, AgradDistributionParetoType2_v_608);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_609, AgradDistributionTestFixture, AgradDistributionParetoType2_v_609);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_610, AgradDistributionTestFixture, AgradDistributionParetoType2_v_610);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_611, AgradDistributionTestFixture, AgradDistributionParetoType2_v_611);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_612, AgradDistributionTestFixture, AgradDistributionParetoType2_v_612);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_613, AgradDistributionTestFixture, AgradDistributionParetoType2_v_613);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_614, AgradDistributionTestFixture, AgradDistributionParetoType2_v_614);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_615, AgradDistributionTestFixture, AgradDistributionParetoType2_v_615);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_616, AgradDistributionTestFixture, AgradDistributionParetoType2_v_616);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_617, AgradDistributionTestFixture, AgradDistributionParetoType2_v_617);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_618, AgradDistributionTestFixture, AgradDistributionParetoType2_v_618);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_619, AgradDistributionTestFixture, AgradDistributionParetoType2_v_619);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_620, AgradDistributionTestFixture, AgradDistributionParetoType2_v_620);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_621, AgradDistributionTestFixture, AgradDistributionParetoType2_v_621);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_622, AgradDistributionTestFixture, AgradDistributionParetoType2_v_622);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_623, AgradDistributionTestFixture, AgradDistributionParetoType2_v_623);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_624, AgradDistributionTestFixture, AgradDistributionParetoType2_v_624);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_625, AgradDistributionTestFixture, AgradDistributionParetoType2_v_625);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_626, AgradDistributionTestFixture, AgradDistributionParetoType2_v_626);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_627, AgradDistributionTestFixture, AgradDistributionParetoType2_v_627);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_628, AgradDistributionTestFixture, AgradDistributionParetoType2_v_628);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_629, AgradDistributionTestFixture, AgradDistributionParetoType2_v_629);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_630, AgradDistributionTestFixture, AgradDistributionParetoType2_v_630);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_631, AgradDistributionTestFixture, AgradDistributionParetoType2_v_631);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_632, AgradDistributionTestFixture, AgradDistributionParetoType2_v_632);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_633, AgradDistributionTestFixture, AgradDistributionParetoType2_v_633);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_634, AgradDistributionTestFixture, AgradDistributionParetoType2_v_634);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_635, AgradDistributionTestFixture, AgradDistributionParetoType2_v_635);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_636, AgradDistributionTestFixture, AgradDistributionParetoType2_v_636);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_637, AgradDistributionTestFixture, AgradDistributionParetoType2_v_637);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_638, AgradDistributionTestFixture, AgradDistributionParetoType2_v_638);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_639, AgradDistributionTestFixture, AgradDistributionParetoType2_v_639);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_640, AgradDistributionTestFixture, AgradDistributionParetoType2_v_640);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_641, AgradDistributionTestFixture, AgradDistributionParetoType2_v_641);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_642, AgradDistributionTestFixture, AgradDistributionParetoType2_v_642);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_643, AgradDistributionTestFixture, AgradDistributionParetoType2_v_643);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_644, AgradDistributionTestFixture, AgradDistributionParetoType2_v_644);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_645, AgradDistributionTestFixture, AgradDistributionParetoType2_v_645);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_646, AgradDistributionTestFixture, AgradDistributionParetoType2_v_646);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_647, AgradDistributionTestFixture, AgradDistributionParetoType2_v_647);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_648, AgradDistributionTestFixture, AgradDistributionParetoType2_v_648);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_649, AgradDistributionTestFixture, AgradDistributionParetoType2_v_649);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_650, AgradDistributionTestFixture, AgradDistributionParetoType2_v_650);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_651, AgradDistributionTestFixture, AgradDistributionParetoType2_v_651);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_652, AgradDistributionTestFixture, AgradDistributionParetoType2_v_652);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_653, AgradDistributionTestFixture, AgradDistributionParetoType2_v_653);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_654, AgradDistributionTestFixture, AgradDistributionParetoType2_v_654);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_655, AgradDistributionTestFixture, AgradDistributionParetoType2_v_655);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_656, AgradDistributionTestFixture, AgradDistributionParetoType2_v_656);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_657, AgradDistributionTestFixture, AgradDistributionParetoType2_v_657);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_658, AgradDistributionTestFixture, AgradDistributionParetoType2_v_658);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_659, AgradDistributionTestFixture, AgradDistributionParetoType2_v_659);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_660, AgradDistributionTestFixture, AgradDistributionParetoType2_v_660);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_661, AgradDistributionTestFixture, AgradDistributionParetoType2_v_661);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_662, AgradDistributionTestFixture, AgradDistributionParetoType2_v_662);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_663, AgradDistributionTestFixture, AgradDistributionParetoType2_v_663);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_664, AgradDistributionTestFixture, AgradDistributionParetoType2_v_664);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_665, AgradDistributionTestFixture, AgradDistributionParetoType2_v_665);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_666, AgradDistributionTestFixture, AgradDistributionParetoType2_v_666);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_667, AgradDistributionTestFixture, AgradDistributionParetoType2_v_667);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_668, AgradDistributionTestFixture, AgradDistributionParetoType2_v_668);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_669, AgradDistributionTestFixture, AgradDistributionParetoType2_v_669);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_670, AgradDistributionTestFixture, AgradDistributionParetoType2_v_670);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_671, AgradDistributionTestFixture, AgradDistributionParetoType2_v_671);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_672, AgradDistributionTestFixture, AgradDistributionParetoType2_v_672);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_673, AgradDistributionTestFixture, AgradDistributionParetoType2_v_673);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_674, AgradDistributionTestFixture, AgradDistributionParetoType2_v_674);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_675, AgradDistributionTestFixture, AgradDistributionParetoType2_v_675);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_676, AgradDistributionTestFixture, AgradDistributionParetoType2_v_676);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_677, AgradDistributionTestFixture, AgradDistributionParetoType2_v_677);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_678, AgradDistributionTestFixture, AgradDistributionParetoType2_v_678);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_679, AgradDistributionTestFixture, AgradDistributionParetoType2_v_679);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_680, AgradDistributionTestFixture, AgradDistributionParetoType2_v_680);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_681, AgradDistributionTestFixture, AgradDistributionParetoType2_v_681);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_682, AgradDistributionTestFixture, AgradDistributionParetoType2_v_682);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_683, AgradDistributionTestFixture, AgradDistributionParetoType2_v_683);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_684, AgradDistributionTestFixture, AgradDistributionParetoType2_v_684);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_685, AgradDistributionTestFixture, AgradDistributionParetoType2_v_685);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_686, AgradDistributionTestFixture, AgradDistributionParetoType2_v_686);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_687, AgradDistributionTestFixture, AgradDistributionParetoType2_v_687);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_688, AgradDistributionTestFixture, AgradDistributionParetoType2_v_688);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_689, AgradDistributionTestFixture, AgradDistributionParetoType2_v_689);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_690, AgradDistributionTestFixture, AgradDistributionParetoType2_v_690);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_691, AgradDistributionTestFixture, AgradDistributionParetoType2_v_691);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_692, AgradDistributionTestFixture, AgradDistributionParetoType2_v_692);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_693, AgradDistributionTestFixture, AgradDistributionParetoType2_v_693);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_694, AgradDistributionTestFixture, AgradDistributionParetoType2_v_694);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_695, AgradDistributionTestFixture, AgradDistributionParetoType2_v_695);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_696, AgradDistributionTestFixture, AgradDistributionParetoType2_v_696);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_697, AgradDistributionTestFixture, AgradDistributionParetoType2_v_697);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_698, AgradDistributionTestFixture, AgradDistributionParetoType2_v_698);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_699, AgradDistributionTestFixture, AgradDistributionParetoType2_v_699);
+
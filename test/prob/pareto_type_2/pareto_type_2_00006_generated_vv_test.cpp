@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_test.hpp>
+
+typedef std::tuple<var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_600;
+typedef std::tuple<var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_601;
+typedef std::tuple<var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_602;
+typedef std::tuple<var, std::vector<double>, double, double, empty, empty> type_vv_603;
+typedef std::tuple<var, std::vector<double>, double, std::vector<double>, empty, empty> type_vv_604;
+typedef std::tuple<var, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_605;
+typedef std::tuple<var, std::vector<double>, double, var, empty, empty> type_vv_606;
+typedef std::tuple<var, std::vector<double>, double, std::vector<var>, empty, empty> type_vv_607;
+typedef std::tuple<var, std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_608;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, double, empty, empty> type_vv_609;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, std::vector<double>, empty, empty> type_vv_610;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_611;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, var, empty, empty> type_vv_612;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_vv_613;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_614;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_615;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_616;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_617;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_618;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_619;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_620;
+typedef std::tuple<var, std::vector<double>, var, double, empty, empty> type_vv_621;
+typedef std::tuple<var, std::vector<double>, var, std::vector<double>, empty, empty> type_vv_622;
+typedef std::tuple<var, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_623;
+typedef std::tuple<var, std::vector<double>, var, var, empty, empty> type_vv_624;
+typedef std::tuple<var, std::vector<double>, var, std::vector<var>, empty, empty> type_vv_625;
+typedef std::tuple<var, std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_626;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, double, empty, empty> type_vv_627;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_vv_628;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_629;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, var, empty, empty> type_vv_630;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_vv_631;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_632;
+typedef std::tuple<var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_633;
+typedef std::tuple<var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_634;
+typedef std::tuple<var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_635;
+typedef std::tuple<var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_636;
+typedef std::tuple<var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_637;
+typedef std::tuple<var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_638;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty> type_vv_639;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_vv_640;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_641;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_vv_642;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_vv_643;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_644;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_vv_645;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_vv_646;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_647;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_vv_648;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_vv_649;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_650;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_651;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_652;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_653;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_654;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_655;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_656;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_vv_657;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_vv_658;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_659;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_vv_660;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_vv_661;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_662;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_vv_663;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_vv_664;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_665;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_vv_666;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_vv_667;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_668;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_669;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_670;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_671;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_672;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_673;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_674;
+typedef std::tuple<var, var, double, double, empty, empty> type_vv_675;
+typedef std::tuple<var, var, double, std::vector<double>, empty, empty> type_vv_676;
+typedef std::tuple<var, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_677;
+typedef std::tuple<var, var, double, var, empty, empty> type_vv_678;
+typedef std::tuple<var, var, double, std::vector<var>, empty, empty> type_vv_679;
+typedef std::tuple<var, var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_680;
+typedef std::tuple<var, var, std::vector<double>, double, empty, empty> type_vv_681;
+typedef std::tuple<var, var, std::vector<double>, std::vector<double>, empty, empty> type_vv_682;
+typedef std::tuple<var, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_683;
+typedef std::tuple<var, var, std::vector<double>, var, empty, empty> type_vv_684;
+typedef std::tuple<var, var, std::vector<double>, std::vector<var>, empty, empty> type_vv_685;
+typedef std::tuple<var, var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_686;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_687;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_688;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_689;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_690;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_691;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_692;
+typedef std::tuple<var, var, var, double, empty, empty> type_vv_693;
+typedef std::tuple<var, var, var, std::vector<double>, empty, empty> type_vv_694;
+typedef std::tuple<var, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_695;
+typedef std::tuple<var, var, var, var, empty, empty> type_vv_696;
+typedef std::tuple<var, var, var, std::vector<var>, empty, empty> type_vv_697;
+typedef std::tuple<var, var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_698;
+typedef std::tuple<var, var, std::vector<var>, double, empty, empty> type_vv_699;
+
+typedef std::tuple<AgradDistributionParetoType2, type_vv_600> AgradDistributionParetoType2_vv_600;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_601> AgradDistributionParetoType2_vv_601;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_602> AgradDistributionParetoType2_vv_602;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_603> AgradDistributionParetoType2_vv_603;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_604> AgradDistributionParetoType2_vv_604;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_605> AgradDistributionParetoType2_vv_605;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_606> AgradDistributionParetoType2_vv_606;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_607> AgradDistributionParetoType2_vv_607;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_608> AgradDistributionParetoType2_vv_608;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_609> AgradDistributionParetoType2_vv_609;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_610> AgradDistributionParetoType2_vv_610;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_611> AgradDistributionParetoType2_vv_611;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_612> AgradDistributionParetoType2_vv_612;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_613> AgradDistributionParetoType2_vv_613;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_614> AgradDistributionParetoType2_vv_614;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_615> AgradDistributionParetoType2_vv_615;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_616> AgradDistributionParetoType2_vv_616;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_617> AgradDistributionParetoType2_vv_617;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_618> AgradDistributionParetoType2_vv_618;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_619> AgradDistributionParetoType2_vv_619;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_620> AgradDistributionParetoType2_vv_620;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_621> AgradDistributionParetoType2_vv_621;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_622> AgradDistributionParetoType2_vv_622;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_623> AgradDistributionParetoType2_vv_623;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_624> AgradDistributionParetoType2_vv_624;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_625> AgradDistributionParetoType2_vv_625;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_626> AgradDistributionParetoType2_vv_626;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_627> AgradDistributionParetoType2_vv_627;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_628> AgradDistributionParetoType2_vv_628;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_629> AgradDistributionParetoType2_vv_629;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_630> AgradDistributionParetoType2_vv_630;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_631> AgradDistributionParetoType2_vv_631;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_632> AgradDistributionParetoType2_vv_632;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_633> AgradDistributionParetoType2_vv_633;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_634> AgradDistributionParetoType2_vv_634;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_635> AgradDistributionParetoType2_vv_635;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_636> AgradDistributionParetoType2_vv_636;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_637> AgradDistributionParetoType2_vv_637;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_638> AgradDistributionParetoType2_vv_638;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_639> AgradDistributionParetoType2_vv_639;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_640> AgradDistributionParetoType2_vv_640;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_641> AgradDistributionParetoType2_vv_641;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_642> AgradDistributionParetoType2_vv_642;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_643> AgradDistributionParetoType2_vv_643;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_644> AgradDistributionParetoType2_vv_644;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_645> AgradDistributionParetoType2_vv_645;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_646> AgradDistributionParetoType2_vv_646;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_647> AgradDistributionParetoType2_vv_647;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_648> AgradDistributionParetoType2_vv_648;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_649> AgradDistributionParetoType2_vv_649;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_650> AgradDistributionParetoType2_vv_650;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_651> AgradDistributionParetoType2_vv_651;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_652> AgradDistributionParetoType2_vv_652;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_653> AgradDistributionParetoType2_vv_653;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_654> AgradDistributionParetoType2_vv_654;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_655> AgradDistributionParetoType2_vv_655;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_656> AgradDistributionParetoType2_vv_656;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_657> AgradDistributionParetoType2_vv_657;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_658> AgradDistributionParetoType2_vv_658;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_659> AgradDistributionParetoType2_vv_659;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_660> AgradDistributionParetoType2_vv_660;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_661> AgradDistributionParetoType2_vv_661;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_662> AgradDistributionParetoType2_vv_662;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_663> AgradDistributionParetoType2_vv_663;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_664> AgradDistributionParetoType2_vv_664;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_665> AgradDistributionParetoType2_vv_665;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_666> AgradDistributionParetoType2_vv_666;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_667> AgradDistributionParetoType2_vv_667;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_668> AgradDistributionParetoType2_vv_668;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_669> AgradDistributionParetoType2_vv_669;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_670> AgradDistributionParetoType2_vv_670;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_671> AgradDistributionParetoType2_vv_671;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_672> AgradDistributionParetoType2_vv_672;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_673> AgradDistributionParetoType2_vv_673;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_674> AgradDistributionParetoType2_vv_674;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_675> AgradDistributionParetoType2_vv_675;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_676> AgradDistributionParetoType2_vv_676;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_677> AgradDistributionParetoType2_vv_677;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_678> AgradDistributionParetoType2_vv_678;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_679> AgradDistributionParetoType2_vv_679;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_680> AgradDistributionParetoType2_vv_680;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_681> AgradDistributionParetoType2_vv_681;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_682> AgradDistributionParetoType2_vv_682;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_683> AgradDistributionParetoType2_vv_683;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_684> AgradDistributionParetoType2_vv_684;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_685> AgradDistributionParetoType2_vv_685;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_686> AgradDistributionParetoType2_vv_686;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_687> AgradDistributionParetoType2_vv_687;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_688> AgradDistributionParetoType2_vv_688;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_689> AgradDistributionParetoType2_vv_689;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_690> AgradDistributionParetoType2_vv_690;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_691> AgradDistributionParetoType2_vv_691;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_692> AgradDistributionParetoType2_vv_692;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_693> AgradDistributionParetoType2_vv_693;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_694> AgradDistributionParetoType2_vv_694;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_695> AgradDistributionParetoType2_vv_695;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_696> AgradDistributionParetoType2_vv_696;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_697> AgradDistributionParetoType2_vv_697;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_698> AgradDistributionParetoType2_vv_698;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_699> AgradDistributionParetoType2_vv_699;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_600, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_600);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_601, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_601);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_602, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_602);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_603, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_603);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_604, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_604);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_605, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_605);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_606, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_606);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_607, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_607);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_608, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_608);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_609, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_609);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_610, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_610);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_611, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_611);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_612, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_612);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_613, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_613);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_614, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_614);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_615, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_615);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_616, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_616);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_617, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_617);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_618, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_618);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_619, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_619);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_620, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_620);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_621, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_621);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_622, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_622);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_623, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_623);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_624, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_624);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_625, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_625);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_626, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_626);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_627, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_627);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_628, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_628);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_629, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_629);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_630, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_630);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_631, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_631);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_632, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_632);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_633, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_633);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_634, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_634);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_635, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_635);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_636, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_636);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_637, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_637);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_638, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_638);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_639, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_639);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_640, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_640);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_641, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_641);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_642, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_642);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_643, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_643);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_644, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_644);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_645, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_645);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_646, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_646);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_647, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_647);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_648, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_648);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_649, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_649);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_650, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_650);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_651, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_651);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_652, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_652);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_653, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_653);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_654, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_654);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_655, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_655);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_656, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_656);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_657, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_657);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_658, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_658);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_659, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_659);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_660, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_660);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_661, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_661);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_662, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_662);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_663, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_663);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_664, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_664);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_665, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_665);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_666, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_666);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_667, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_667);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_668, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_668);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_669, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_669);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_670, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_670);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_671, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_671);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_672, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_672);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_673, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_673);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_674, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_674);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_675, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_675);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_676, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_676);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_677, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_677);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_678, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_678);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_679, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_679);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_680, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_680);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_681, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_681);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_682, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_682);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_683, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_683);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_684, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_684);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_685, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_685);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_686, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_686);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_687, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_687);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_688, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_688);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_689, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_689);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_690, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_690);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_691, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_691);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_692, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_692);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_693, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_693);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_694, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_694);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_695, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_695);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_696, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_696);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_697, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_697);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_698, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_698);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_699, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_699);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_test.hpp>
+
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_700;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_701;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_702;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_703;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_704;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_705;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_706;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_707;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_708;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_709;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_710;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, double, empty, empty> type_ffv_711;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty, empty> type_ffv_712;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_713;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty, empty> type_ffv_714;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_715;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_716;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty, empty> type_ffv_717;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_718;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_719;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_720;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_721;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_722;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_723;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_724;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_725;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_726;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_727;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_728;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty, empty> type_ffv_729;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_730;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_731;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_732;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_733;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_734;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_735;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_736;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_737;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_738;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_739;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_740;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_741;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_742;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_743;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_744;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_745;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_746;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty, empty> type_ffv_747;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_ffv_748;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_749;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_750;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_751;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_752;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_ffv_753;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_754;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_755;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_756;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_757;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_758;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_759;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_760;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_761;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_762;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_763;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_764;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_765;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_766;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_767;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_768;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_769;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_770;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_771;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_772;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_773;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_774;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_775;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_776;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_777;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_778;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_779;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_780;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_781;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_782;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, double, double, empty, empty> type_ffv_783;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, double, std::vector<double>, empty, empty> type_ffv_784;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_785;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, double, fvar<fvar<var> >, empty, empty> type_ffv_786;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_787;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_788;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<double>, double, empty, empty> type_ffv_789;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<double>, std::vector<double>, empty, empty> type_ffv_790;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_791;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_792;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_793;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_794;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_795;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_796;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_797;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_798;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_799;
+
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_700> AgradDistributionParetoType2_ffv_700;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_701> AgradDistributionParetoType2_ffv_701;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_702> AgradDistributionParetoType2_ffv_702;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_703> AgradDistributionParetoType2_ffv_703;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_704> AgradDistributionParetoType2_ffv_704;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_705> AgradDistributionParetoType2_ffv_705;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_706> AgradDistributionParetoType2_ffv_706;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_707> AgradDistributionParetoType2_ffv_707;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_708> AgradDistributionParetoType2_ffv_708;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_709> AgradDistributionParetoType2_ffv_709;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_710> AgradDistributionParetoType2_ffv_710;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_711> AgradDistributionParetoType2_ffv_711;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_712> AgradDistributionParetoType2_ffv_712;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_713> AgradDistributionParetoType2_ffv_713;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_714> AgradDistributionParetoType2_ffv_714;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_715> AgradDistributionParetoType2_ffv_715;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_716> AgradDistributionParetoType2_ffv_716;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_717> AgradDistributionParetoType2_ffv_717;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_718> AgradDistributionParetoType2_ffv_718;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_719> AgradDistributionParetoType2_ffv_719;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_720> AgradDistributionParetoType2_ffv_720;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_721> AgradDistributionParetoType2_ffv_721;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_722> AgradDistributionParetoType2_ffv_722;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_723> AgradDistributionParetoType2_ffv_723;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_724> AgradDistributionParetoType2_ffv_724;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_725> AgradDistributionParetoType2_ffv_725;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_726> AgradDistributionParetoType2_ffv_726;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_727> AgradDistributionParetoType2_ffv_727;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_728> AgradDistributionParetoType2_ffv_728;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_729> AgradDistributionParetoType2_ffv_729;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_730> AgradDistributionParetoType2_ffv_730;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_731> AgradDistributionParetoType2_ffv_731;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_732> AgradDistributionParetoType2_ffv_732;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_733> AgradDistributionParetoType2_ffv_733;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_734> AgradDistributionParetoType2_ffv_734;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_735> AgradDistributionParetoType2_ffv_735;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_736> AgradDistributionParetoType2_ffv_736;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_737> AgradDistributionParetoType2_ffv_737;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_738> AgradDistributionParetoType2_ffv_738;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_739> AgradDistributionParetoType2_ffv_739;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_740> AgradDistributionParetoType2_ffv_740;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_741> AgradDistributionParetoType2_ffv_741;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_742> AgradDistributionParetoType2_ffv_742;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_743> AgradDistributionParetoType2_ffv_743;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_744> AgradDistributionParetoType2_ffv_744;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_745> AgradDistributionParetoType2_ffv_745;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_746> AgradDistributionParetoType2_ffv_746;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_747> AgradDistributionParetoType2_ffv_747;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_748> AgradDistributionParetoType2_ffv_748;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_749> AgradDistributionParetoType2_ffv_749;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_750> AgradDistributionParetoType2_ffv_750;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_751> AgradDistributionParetoType2_ffv_751;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_752> AgradDistributionParetoType2_ffv_752;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_753> AgradDistributionParetoType2_ffv_753;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_754> AgradDistributionParetoType2_ffv_754;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_755> AgradDistributionParetoType2_ffv_755;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_756> AgradDistributionParetoType2_ffv_756;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_757> AgradDistributionParetoType2_ffv_757;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_758> AgradDistributionParetoType2_ffv_758;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_759> AgradDistributionParetoType2_ffv_759;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_760> AgradDistributionParetoType2_ffv_760;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_761> AgradDistributionParetoType2_ffv_761;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_762> AgradDistributionParetoType2_ffv_762;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_763> AgradDistributionParetoType2_ffv_763;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_764> AgradDistributionParetoType2_ffv_764;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_765> AgradDistributionParetoType2_ffv_765;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_766> AgradDistributionParetoType2_ffv_766;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_767> AgradDistributionParetoType2_ffv_767;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_768> AgradDistributionParetoType2_ffv_768;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_769> AgradDistributionParetoType2_ffv_769;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_770> AgradDistributionParetoType2_ffv_770;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_771> AgradDistributionParetoType2_ffv_771;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_772> AgradDistributionParetoType2_ffv_772;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_773> AgradDistributionParetoType2_ffv_773;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_774> AgradDistributionParetoType2_ffv_774;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_775> AgradDistributionParetoType2_ffv_775;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_776> AgradDistributionParetoType2_ffv_776;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_777> AgradDistributionParetoType2_ffv_777;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_778> AgradDistributionParetoType2_ffv_778;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_779> AgradDistributionParetoType2_ffv_779;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_780> AgradDistributionParetoType2_ffv_780;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_781> AgradDistributionParetoType2_ffv_781;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_782> AgradDistributionParetoType2_ffv_782;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_783> AgradDistributionParetoType2_ffv_783;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_784> AgradDistributionParetoType2_ffv_784;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_785> AgradDistributionParetoType2_ffv_785;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_786> AgradDistributionParetoType2_ffv_786;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_787> AgradDistributionParetoType2_ffv_787;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_788> AgradDistributionParetoType2_ffv_788;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_789> AgradDistributionParetoType2_ffv_789;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_790> AgradDistributionParetoType2_ffv_790;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_791> AgradDistributionParetoType2_ffv_791;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_792> AgradDistributionParetoType2_ffv_792;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_793> AgradDistributionParetoType2_ffv_793;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_794> AgradDistributionParetoType2_ffv_794;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_795> AgradDistributionParetoType2_ffv_795;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_796> AgradDistributionParetoType2_ffv_796;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_797> AgradDistributionParetoType2_ffv_797;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_798> AgradDistributionParetoType2_ffv_798;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_799> AgradDistributionParetoType2_ffv_799;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_700, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_700);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_701, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_701);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_702, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_702);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_703, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_703);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_704, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_704);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_705, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_705);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_706, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_706);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_707, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_707);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_708, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_708);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_709, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_709);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_710, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_710);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_711, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_711);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_712, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_712);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_713, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_713);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_714, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_714);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_715, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_715);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_716, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_716);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_717, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_717);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_718, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_718);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_719, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_719);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_720, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_720);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_721, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_721);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_722, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_722);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_723, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_723);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_724, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_724);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_725, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_725);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_726, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_726);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_727, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_727);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_728, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_728);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_729, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_729);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_730, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_730);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_731, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_731);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_732, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_732);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_733, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_733);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_734, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_734);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_735, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_735);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_736, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_736);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_737, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_737);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_738, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_738);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_739, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_739);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_740, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_740);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_741, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_741);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_742, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_742);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_743, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_743);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_744, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_744);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_745, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_745);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_746, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_746);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_747, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_747);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_748, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_748);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_749, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_749);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_750, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_750);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_751, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_751);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_752, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_752);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_753, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_753);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_754, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_754);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_755, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_755);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_756, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_756);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_757, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_757);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_758, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_758);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_759, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_759);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_760, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_760);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_761, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_761);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_762, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_762);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_763, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_763);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_764, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_764);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_765, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_765);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_766, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_766);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_767, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_767);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_768, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_768);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_769, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_769);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_770, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_770);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_771, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_771);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_772, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_772);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_773, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_773);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_774, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_774);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_775, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_775);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_776, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_776);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_777, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_777);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_778, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_778);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_779, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_779);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_780, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_780);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_781, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_781);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_782, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_782);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_783, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_783);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_784, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_784);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_785, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_785);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_786, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_786);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_787, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_787);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_788, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_788);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_789, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_789);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_790, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_790);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_791, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_791);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_792, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_792);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_793, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_793);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_794, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_794);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_795, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_795);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_796, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_796);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_797, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_797);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_798, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_798);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_799, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_799);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_test.hpp>
+
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_700;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_701;
+typedef std::tuple<var, std::vector<double>, var, double, empty, empty> type_v_702;
+typedef std::tuple<var, std::vector<double>, var, std::vector<double>, empty, empty> type_v_703;
+typedef std::tuple<var, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_704;
+typedef std::tuple<var, std::vector<double>, var, var, empty, empty> type_v_705;
+typedef std::tuple<var, std::vector<double>, var, std::vector<var>, empty, empty> type_v_706;
+typedef std::tuple<var, std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_707;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, double, empty, empty> type_v_708;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_v_709;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_710;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, var, empty, empty> type_v_711;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_v_712;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_713;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_714;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_715;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_716;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_717;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_718;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_719;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_720;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_721;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_722;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_723;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_724;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_725;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_726;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_727;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_728;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_729;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_730;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_731;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_732;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_733;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_734;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_735;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_736;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_737;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_738;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_739;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_740;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_741;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_742;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_743;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_744;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_745;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_746;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_747;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_748;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_749;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_750;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_751;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_752;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_753;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_754;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_755;
+typedef std::tuple<var, var, double, double, empty, empty> type_v_756;
+typedef std::tuple<var, var, double, std::vector<double>, empty, empty> type_v_757;
+typedef std::tuple<var, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_758;
+typedef std::tuple<var, var, double, var, empty, empty> type_v_759;
+typedef std::tuple<var, var, double, std::vector<var>, empty, empty> type_v_760;
+typedef std::tuple<var, var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_761;
+typedef std::tuple<var, var, std::vector<double>, double, empty, empty> type_v_762;
+typedef std::tuple<var, var, std::vector<double>, std::vector<double>, empty, empty> type_v_763;
+typedef std::tuple<var, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_764;
+typedef std::tuple<var, var, std::vector<double>, var, empty, empty> type_v_765;
+typedef std::tuple<var, var, std::vector<double>, std::vector<var>, empty, empty> type_v_766;
+typedef std::tuple<var, var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_767;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_768;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_769;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_770;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_771;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_772;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_773;
+typedef std::tuple<var, var, var, double, empty, empty> type_v_774;
+typedef std::tuple<var, var, var, std::vector<double>, empty, empty> type_v_775;
+typedef std::tuple<var, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_776;
+typedef std::tuple<var, var, var, var, empty, empty> type_v_777;
+typedef std::tuple<var, var, var, std::vector<var>, empty, empty> type_v_778;
+typedef std::tuple<var, var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_779;
+typedef std::tuple<var, var, std::vector<var>, double, empty, empty> type_v_780;
+typedef std::tuple<var, var, std::vector<var>, std::vector<double>, empty, empty> type_v_781;
+typedef std::tuple<var, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_782;
+typedef std::tuple<var, var, std::vector<var>, var, empty, empty> type_v_783;
+typedef std::tuple<var, var, std::vector<var>, std::vector<var>, empty, empty> type_v_784;
+typedef std::tuple<var, var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_785;
+typedef std::tuple<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_786;
+typedef std::tuple<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_787;
+typedef std::tuple<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_788;
+typedef std::tuple<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_789;
+typedef std::tuple<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_790;
+typedef std::tuple<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_791;
+typedef std::tuple<var, std::vector<var>, double, double, empty, empty> type_v_792;
+typedef std::tuple<var, std::vector<var>, double, std::vector<double>, empty, empty> type_v_793;
+typedef std::tuple<var, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_794;
+typedef std::tuple<var, std::vector<var>, double, var, empty, empty> type_v_795;
+typedef std::tuple<var, std::vector<var>, double, std::vector<var>, empty, empty> type_v_796;
+typedef std::tuple<var, std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_797;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, double, empty, empty> type_v_798;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_v_799;
+
+typedef std::tuple<AgradDistributionParetoType2, type_v_700> AgradDistributionParetoType2_v_700;
+typedef std::tuple<AgradDistributionParetoType2, type_v_701> AgradDistributionParetoType2_v_701;
+typedef std::tuple<AgradDistributionParetoType2, type_v_702> AgradDistributionParetoType2_v_702;
+typedef std::tuple<AgradDistributionParetoType2, type_v_703> AgradDistributionParetoType2_v_703;
+typedef std::tuple<AgradDistributionParetoType2, type_v_704> AgradDistributionParetoType2_v_704;
+typedef std::tuple<AgradDistributionParetoType2, type_v_705> AgradDistributionParetoType2_v_705;
+typedef std::tuple<AgradDistributionParetoType2, type_v_706> AgradDistributionParetoType2_v_706;
+typedef std::tuple<AgradDistributionParetoType2, type_v_707> AgradDistributionParetoType2_v_707;
+typedef std::tuple<AgradDistributionParetoType2, type_v_708> AgradDistributionParetoType2_v_708;
+typedef std::tuple<AgradDistributionParetoType2, type_v_709> AgradDistributionParetoType2_v_709;
+typedef std::tuple<AgradDistributionParetoType2, type_v_710> AgradDistributionParetoType2_v_710;
+typedef std::tuple<AgradDistributionParetoType2, type_v_711> AgradDistributionParetoType2_v_711;
+typedef std::tuple<AgradDistributionParetoType2, type_v_712> AgradDistributionParetoType2_v_712;
+typedef std::tuple<AgradDistributionParetoType2, type_v_713> AgradDistributionParetoType2_v_713;
+typedef std::tuple<AgradDistributionParetoType2, type_v_714> AgradDistributionParetoType2_v_714;
+typedef std::tuple<AgradDistributionParetoType2, type_v_715> AgradDistributionParetoType2_v_715;
+typedef std::tuple<AgradDistributionParetoType2, type_v_716> AgradDistributionParetoType2_v_716;
+typedef std::tuple<AgradDistributionParetoType2, type_v_717> AgradDistributionParetoType2_v_717;
+typedef std::tuple<AgradDistributionParetoType2, type_v_718> AgradDistributionParetoType2_v_718;
+typedef std::tuple<AgradDistributionParetoType2, type_v_719> AgradDistributionParetoType2_v_719;
+typedef std::tuple<AgradDistributionParetoType2, type_v_720> AgradDistributionParetoType2_v_720;
+typedef std::tuple<AgradDistributionParetoType2, type_v_721> AgradDistributionParetoType2_v_721;
+typedef std::tuple<AgradDistributionParetoType2, type_v_722> AgradDistributionParetoType2_v_722;
+typedef std::tuple<AgradDistributionParetoType2, type_v_723> AgradDistributionParetoType2_v_723;
+typedef std::tuple<AgradDistributionParetoType2, type_v_724> AgradDistributionParetoType2_v_724;
+typedef std::tuple<AgradDistributionParetoType2, type_v_725> AgradDistributionParetoType2_v_725;
+typedef std::tuple<AgradDistributionParetoType2, type_v_726> AgradDistributionParetoType2_v_726;
+typedef std::tuple<AgradDistributionParetoType2, type_v_727> AgradDistributionParetoType2_v_727;
+typedef std::tuple<AgradDistributionParetoType2, type_v_728> AgradDistributionParetoType2_v_728;
+typedef std::tuple<AgradDistributionParetoType2, type_v_729> AgradDistributionParetoType2_v_729;
+typedef std::tuple<AgradDistributionParetoType2, type_v_730> AgradDistributionParetoType2_v_730;
+typedef std::tuple<AgradDistributionParetoType2, type_v_731> AgradDistributionParetoType2_v_731;
+typedef std::tuple<AgradDistributionParetoType2, type_v_732> AgradDistributionParetoType2_v_732;
+typedef std::tuple<AgradDistributionParetoType2, type_v_733> AgradDistributionParetoType2_v_733;
+typedef std::tuple<AgradDistributionParetoType2, type_v_734> AgradDistributionParetoType2_v_734;
+typedef std::tuple<AgradDistributionParetoType2, type_v_735> AgradDistributionParetoType2_v_735;
+typedef std::tuple<AgradDistributionParetoType2, type_v_736> AgradDistributionParetoType2_v_736;
+typedef std::tuple<AgradDistributionParetoType2, type_v_737> AgradDistributionParetoType2_v_737;
+typedef std::tuple<AgradDistributionParetoType2, type_v_738> AgradDistributionParetoType2_v_738;
+typedef std::tuple<AgradDistributionParetoType2, type_v_739> AgradDistributionParetoType2_v_739;
+typedef std::tuple<AgradDistributionParetoType2, type_v_740> AgradDistributionParetoType2_v_740;
+typedef std::tuple<AgradDistributionParetoType2, type_v_741> AgradDistributionParetoType2_v_741;
+typedef std::tuple<AgradDistributionParetoType2, type_v_742> AgradDistributionParetoType2_v_742;
+typedef std::tuple<AgradDistributionParetoType2, type_v_743> AgradDistributionParetoType2_v_743;
+typedef std::tuple<AgradDistributionParetoType2, type_v_744> AgradDistributionParetoType2_v_744;
+typedef std::tuple<AgradDistributionParetoType2, type_v_745> AgradDistributionParetoType2_v_745;
+typedef std::tuple<AgradDistributionParetoType2, type_v_746> AgradDistributionParetoType2_v_746;
+typedef std::tuple<AgradDistributionParetoType2, type_v_747> AgradDistributionParetoType2_v_747;
+typedef std::tuple<AgradDistributionParetoType2, type_v_748> AgradDistributionParetoType2_v_748;
+typedef std::tuple<AgradDistributionParetoType2, type_v_749> AgradDistributionParetoType2_v_749;
+typedef std::tuple<AgradDistributionParetoType2, type_v_750> AgradDistributionParetoType2_v_750;
+typedef std::tuple<AgradDistributionParetoType2, type_v_751> AgradDistributionParetoType2_v_751;
+typedef std::tuple<AgradDistributionParetoType2, type_v_752> AgradDistributionParetoType2_v_752;
+typedef std::tuple<AgradDistributionParetoType2, type_v_753> AgradDistributionParetoType2_v_753;
+typedef std::tuple<AgradDistributionParetoType2, type_v_754> AgradDistributionParetoType2_v_754;
+typedef std::tuple<AgradDistributionParetoType2, type_v_755> AgradDistributionParetoType2_v_755;
+typedef std::tuple<AgradDistributionParetoType2, type_v_756> AgradDistributionParetoType2_v_756;
+typedef std::tuple<AgradDistributionParetoType2, type_v_757> AgradDistributionParetoType2_v_757;
+typedef std::tuple<AgradDistributionParetoType2, type_v_758> AgradDistributionParetoType2_v_758;
+typedef std::tuple<AgradDistributionParetoType2, type_v_759> AgradDistributionParetoType2_v_759;
+typedef std::tuple<AgradDistributionParetoType2, type_v_760> AgradDistributionParetoType2_v_760;
+typedef std::tuple<AgradDistributionParetoType2, type_v_761> AgradDistributionParetoType2_v_761;
+typedef std::tuple<AgradDistributionParetoType2, type_v_762> AgradDistributionParetoType2_v_762;
+typedef std::tuple<AgradDistributionParetoType2, type_v_763> AgradDistributionParetoType2_v_763;
+typedef std::tuple<AgradDistributionParetoType2, type_v_764> AgradDistributionParetoType2_v_764;
+typedef std::tuple<AgradDistributionParetoType2, type_v_765> AgradDistributionParetoType2_v_765;
+typedef std::tuple<AgradDistributionParetoType2, type_v_766> AgradDistributionParetoType2_v_766;
+typedef std::tuple<AgradDistributionParetoType2, type_v_767> AgradDistributionParetoType2_v_767;
+typedef std::tuple<AgradDistributionParetoType2, type_v_768> AgradDistributionParetoType2_v_768;
+typedef std::tuple<AgradDistributionParetoType2, type_v_769> AgradDistributionParetoType2_v_769;
+typedef std::tuple<AgradDistributionParetoType2, type_v_770> AgradDistributionParetoType2_v_770;
+typedef std::tuple<AgradDistributionParetoType2, type_v_771> AgradDistributionParetoType2_v_771;
+typedef std::tuple<AgradDistributionParetoType2, type_v_772> AgradDistributionParetoType2_v_772;
+typedef std::tuple<AgradDistributionParetoType2, type_v_773> AgradDistributionParetoType2_v_773;
+typedef std::tuple<AgradDistributionParetoType2, type_v_774> AgradDistributionParetoType2_v_774;
+typedef std::tuple<AgradDistributionParetoType2, type_v_775> AgradDistributionParetoType2_v_775;
+typedef std::tuple<AgradDistributionParetoType2, type_v_776> AgradDistributionParetoType2_v_776;
+typedef std::tuple<AgradDistributionParetoType2, type_v_777> AgradDistributionParetoType2_v_777;
+typedef std::tuple<AgradDistributionParetoType2, type_v_778> AgradDistributionParetoType2_v_778;
+typedef std::tuple<AgradDistributionParetoType2, type_v_779> AgradDistributionParetoType2_v_779;
+typedef std::tuple<AgradDistributionParetoType2, type_v_780> AgradDistributionParetoType2_v_780;
+typedef std::tuple<AgradDistributionParetoType2, type_v_781> AgradDistributionParetoType2_v_781;
+typedef std::tuple<AgradDistributionParetoType2, type_v_782> AgradDistributionParetoType2_v_782;
+typedef std::tuple<AgradDistributionParetoType2, type_v_783> AgradDistributionParetoType2_v_783;
+typedef std::tuple<AgradDistributionParetoType2, type_v_784> AgradDistributionParetoType2_v_784;
+typedef std::tuple<AgradDistributionParetoType2, type_v_785> AgradDistributionParetoType2_v_785;
+typedef std::tuple<AgradDistributionParetoType2, type_v_786> AgradDistributionParetoType2_v_786;
+typedef std::tuple<AgradDistributionParetoType2, type_v_787> AgradDistributionParetoType2_v_787;
+typedef std::tuple<AgradDistributionParetoType2, type_v_788> AgradDistributionParetoType2_v_788;
+typedef std::tuple<AgradDistributionParetoType2, type_v_789> AgradDistributionParetoType2_v_789;
+typedef std::tuple<AgradDistributionParetoType2, type_v_790> AgradDistributionParetoType2_v_790;
+typedef std::tuple<AgradDistributionParetoType2, type_v_791> AgradDistributionParetoType2_v_791;
+typedef std::tuple<AgradDistributionParetoType2, type_v_792> AgradDistributionParetoType2_v_792;
+typedef std::tuple<AgradDistributionParetoType2, type_v_793> AgradDistributionParetoType2_v_793;
+typedef std::tuple<AgradDistributionParetoType2, type_v_794> AgradDistributionParetoType2_v_794;
+typedef std::tuple<AgradDistributionParetoType2, type_v_795> AgradDistributionParetoType2_v_795;
+typedef std::tuple<AgradDistributionParetoType2, type_v_796> AgradDistributionParetoType2_v_796;
+typedef std::tuple<AgradDistributionParetoType2, type_v_797> AgradDistributionParetoType2_v_797;
+typedef std::tuple<AgradDistributionParetoType2, type_v_798> AgradDistributionParetoType2_v_798;
+typedef std::tuple<AgradDistributionParetoType2, type_v_799> AgradDistributionParetoType2_v_799;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_700, AgradDistributionTestFixture, AgradDistributionParetoType2_v_700);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_701, AgradDistributionTestFixture, AgradDistributionParetoType2_v_701);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_702, AgradDistributionTestFixture, AgradDistributionParetoType2_v_702);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_703, AgradDistributionTestFixture, AgradDistributionParetoType2_v_703);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_704, AgradDistributionTestFixture, AgradDistributionParetoType2_v_704);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_705, AgradDistributionTestFixture, AgradDistributionParetoType2_v_705);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_706, AgradDistributionTestFixture, AgradDistributionParetoType2_v_706);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_707, AgradDistributionTestFixture, AgradDistributionParetoType2_v_707);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_708, AgradDistributionTestFixture, AgradDistributionParetoType2_v_708);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_709, AgradDistributionTestFixture, AgradDistributionParetoType2_v_709);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_710, AgradDistributionTestFixture, AgradDistributionParetoType2_v_710);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_711, AgradDistributionTestFixture, AgradDistributionParetoType2_v_711);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_712, AgradDistributionTestFixture, AgradDistributionParetoType2_v_712);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_713, AgradDistributionTestFixture, AgradDistributionParetoType2_v_713);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_714, AgradDistributionTestFixture, AgradDistributionParetoType2_v_714);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_715, AgradDistributionTestFixture, AgradDistributionParetoType2_v_715);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_716, AgradDistributionTestFixture, AgradDistributionParetoType2_v_716);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_717, AgradDistributionTestFixture, AgradDistributionParetoType2_v_717);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_718, AgradDistributionTestFixture, AgradDistributionParetoType2_v_718);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_719, AgradDistributionTestFixture, AgradDistributionParetoType2_v_719);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_720, AgradDistributionTestFixture, AgradDistributionParetoType2_v_720);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_721, AgradDistributionTestFixture, AgradDistributionParetoType2_v_721);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_722, AgradDistributionTestFixture, AgradDistributionParetoType2_v_722);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_723, AgradDistributionTestFixture, AgradDistributionParetoType2_v_723);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_724, AgradDistributionTestFixture, AgradDistributionParetoType2_v_724);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_725, AgradDistributionTestFixture, AgradDistributionParetoType2_v_725);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_726, AgradDistributionTestFixture, AgradDistributionParetoType2_v_726);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_727, AgradDistributionTestFixture, AgradDistributionParetoType2_v_727);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_728, AgradDistributionTestFixture, AgradDistributionParetoType2_v_728);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_729, AgradDistributionTestFixture, AgradDistributionParetoType2_v_729);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_730, AgradDistributionTestFixture, AgradDistributionParetoType2_v_730);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_731, AgradDistributionTestFixture, AgradDistributionParetoType2_v_731);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_732, AgradDistributionTestFixture, AgradDistributionParetoType2_v_732);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_733, AgradDistributionTestFixture, AgradDistributionParetoType2_v_733);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_734, AgradDistributionTestFixture, AgradDistributionParetoType2_v_734);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_735, AgradDistributionTestFixture, AgradDistributionParetoType2_v_735);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_736, AgradDistributionTestFixture, AgradDistributionParetoType2_v_736);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_737, AgradDistributionTestFixture, AgradDistributionParetoType2_v_737);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_738, AgradDistributionTestFixture, AgradDistributionParetoType2_v_738);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_739, AgradDistributionTestFixture, AgradDistributionParetoType2_v_739);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_740, AgradDistributionTestFixture, AgradDistributionParetoType2_v_740);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_741, AgradDistributionTestFixture, AgradDistributionParetoType2_v_741);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_742, AgradDistributionTestFixture, AgradDistributionParetoType2_v_742);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_743, AgradDistributionTestFixture, AgradDistributionParetoType2_v_743);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_744, AgradDistributionTestFixture, AgradDistributionParetoType2_v_744);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_745, AgradDistributionTestFixture, AgradDistributionParetoType2_v_745);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_746, AgradDistributionTestFixture, AgradDistributionParetoType2_v_746);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_747, AgradDistributionTestFixture, AgradDistributionParetoType2_v_747);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_748, AgradDistributionTestFixture, AgradDistributionParetoType2_v_748);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_749, AgradDistributionTestFixture, AgradDistributionParetoType2_v_749);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_750, AgradDistributionTestFixture, AgradDistributionParetoType2_v_750);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_751, AgradDistributionTestFixture, AgradDistributionParetoType2_v_751);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_752, AgradDistributionTestFixture, AgradDistributionParetoType2_v_752);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_753, AgradDistributionTestFixture, AgradDistributionParetoType2_v_753);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_754, AgradDistributionTestFixture, AgradDistributionParetoType2_v_754);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_755, AgradDistributionTestFixture, AgradDistributionParetoType2_v_755);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_756, AgradDistributionTestFixture, AgradDistributionParetoType2_v_756);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_757, AgradDistributionTestFixture, AgradDistributionParetoType2_v_757);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_758, AgradDistributionTestFixture, AgradDistributionParetoType2_v_758);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_759, AgradDistributionTestFixture, AgradDistributionParetoType2_v_759);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_760, AgradDistributionTestFixture, AgradDistributionParetoType2_v_760);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_761, AgradDistributionTestFixture, AgradDistributionParetoType2_v_761);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_762, AgradDistributionTestFixture, AgradDistributionParetoType2_v_762);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_763, AgradDistributionTestFixture, AgradDistributionParetoType2_v_763);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_764, AgradDistributionTestFixture, AgradDistributionParetoType2_v_764);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_765, AgradDistributionTestFixture, AgradDistributionParetoType2_v_765);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_766, AgradDistributionTestFixture, AgradDistributionParetoType2_v_766);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_767, AgradDistributionTestFixture, AgradDistributionParetoType2_v_767);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_768, AgradDistributionTestFixture, AgradDistributionParetoType2_v_768);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_769, AgradDistributionTestFixture, AgradDistributionParetoType2_v_769);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_770, AgradDistributionTestFixture, AgradDistributionParetoType2_v_770);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_771, AgradDistributionTestFixture, AgradDistributionParetoType2_v_771);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_772, AgradDistributionTestFixture, AgradDistributionParetoType2_v_772);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_773, AgradDistributionTestFixture, AgradDistributionParetoType2_v_773);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_774, AgradDistributionTestFixture, AgradDistributionParetoType2_v_774);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_775, AgradDistributionTestFixture, AgradDistributionParetoType2_v_775);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_776, AgradDistributionTestFixture, AgradDistributionParetoType2_v_776);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_777, AgradDistributionTestFixture, AgradDistributionParetoType2_v_777);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_778, AgradDistributionTestFixture, AgradDistributionParetoType2_v_778);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_779, AgradDistributionTestFixture, AgradDistributionParetoType2_v_779);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_780, AgradDistributionTestFixture, AgradDistributionParetoType2_v_780);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_781, AgradDistributionTestFixture, AgradDistributionParetoType2_v_781);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_782, AgradDistributionTestFixture, AgradDistributionParetoType2_v_782);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_783, AgradDistributionTestFixture, AgradDistributionParetoType2_v_783);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_784, AgradDistributionTestFixture, AgradDistributionParetoType2_v_784);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_785, AgradDistributionTestFixture, AgradDistributionParetoType2_v_785);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_786, AgradDistributionTestFixture, AgradDistributionParetoType2_v_786);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_787, AgradDistributionTestFixture, AgradDistributionParetoType2_v_787);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_788, AgradDistributionTestFixture, AgradDistributionParetoType2_v_788);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_789, AgradDistributionTestFixture, AgradDistributionParetoType2_v_789);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_790, AgradDistributionTestFixture, AgradDistributionParetoType2_v_790);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_791, AgradDistributionTestFixture, AgradDistributionParetoType2_v_791);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_792, AgradDistributionTestFixture, AgradDistributionParetoType2_v_792);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_793, AgradDistributionTestFixture, AgradDistributionParetoType2_v_793);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_794, AgradDistributionTestFixture, AgradDistributionParetoType2_v_794);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_795, AgradDistributionTestFixture, AgradDistributionParetoType2_v_795);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_796, AgradDistributionTestFixture, AgradDistributionParetoType2_v_796);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_797, AgradDistributionTestFixture, AgradDistributionParetoType2_v_797);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_798, AgradDistributionTestFixture, AgradDistributionParetoType2_v_798);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_799, AgradDistributionTestFixture, AgradDistributionParetoType2_v_799);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_test.hpp>
+
+typedef std::tuple<var, var, std::vector<var>, std::vector<double>, empty, empty> type_vv_700;
+typedef std::tuple<var, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_701;
+typedef std::tuple<var, var, std::vector<var>, var, empty, empty> type_vv_702;
+typedef std::tuple<var, var, std::vector<var>, std::vector<var>, empty, empty> type_vv_703;
+typedef std::tuple<var, var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_704;
+typedef std::tuple<var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_705;
+typedef std::tuple<var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_706;
+typedef std::tuple<var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_707;
+typedef std::tuple<var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_708;
+typedef std::tuple<var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_709;
+typedef std::tuple<var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_710;
+typedef std::tuple<var, std::vector<var>, double, double, empty, empty> type_vv_711;
+typedef std::tuple<var, std::vector<var>, double, std::vector<double>, empty, empty> type_vv_712;
+typedef std::tuple<var, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_713;
+typedef std::tuple<var, std::vector<var>, double, var, empty, empty> type_vv_714;
+typedef std::tuple<var, std::vector<var>, double, std::vector<var>, empty, empty> type_vv_715;
+typedef std::tuple<var, std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_716;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, double, empty, empty> type_vv_717;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_vv_718;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_719;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, var, empty, empty> type_vv_720;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_vv_721;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_722;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_723;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_724;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_725;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_726;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_727;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_728;
+typedef std::tuple<var, std::vector<var>, var, double, empty, empty> type_vv_729;
+typedef std::tuple<var, std::vector<var>, var, std::vector<double>, empty, empty> type_vv_730;
+typedef std::tuple<var, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_731;
+typedef std::tuple<var, std::vector<var>, var, var, empty, empty> type_vv_732;
+typedef std::tuple<var, std::vector<var>, var, std::vector<var>, empty, empty> type_vv_733;
+typedef std::tuple<var, std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_734;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, double, empty, empty> type_vv_735;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_vv_736;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_737;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, var, empty, empty> type_vv_738;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_vv_739;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_740;
+typedef std::tuple<var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_741;
+typedef std::tuple<var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_742;
+typedef std::tuple<var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_743;
+typedef std::tuple<var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_744;
+typedef std::tuple<var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_745;
+typedef std::tuple<var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_746;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, empty, empty> type_vv_747;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, empty, empty> type_vv_748;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_749;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, empty, empty> type_vv_750;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, empty, empty> type_vv_751;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_752;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, empty, empty> type_vv_753;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, empty, empty> type_vv_754;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_755;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, empty, empty> type_vv_756;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, empty, empty> type_vv_757;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_758;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_759;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_760;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_761;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_762;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_763;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_764;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, empty, empty> type_vv_765;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, empty, empty> type_vv_766;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_767;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, empty, empty> type_vv_768;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, empty, empty> type_vv_769;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_770;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, empty, empty> type_vv_771;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, empty, empty> type_vv_772;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_773;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, empty, empty> type_vv_774;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, empty, empty> type_vv_775;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_776;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_777;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_778;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_779;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_780;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_781;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_782;
+typedef std::tuple<std::vector<var>, double, double, double, empty, empty> type_vv_783;
+typedef std::tuple<std::vector<var>, double, double, std::vector<double>, empty, empty> type_vv_784;
+typedef std::tuple<std::vector<var>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_785;
+typedef std::tuple<std::vector<var>, double, double, var, empty, empty> type_vv_786;
+typedef std::tuple<std::vector<var>, double, double, std::vector<var>, empty, empty> type_vv_787;
+typedef std::tuple<std::vector<var>, double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_788;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, double, empty, empty> type_vv_789;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, std::vector<double>, empty, empty> type_vv_790;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_791;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, var, empty, empty> type_vv_792;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, std::vector<var>, empty, empty> type_vv_793;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_794;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_795;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_796;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_797;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_798;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_799;
+
+typedef std::tuple<AgradDistributionParetoType2, type_vv_700> AgradDistributionParetoType2_vv_700;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_701> AgradDistributionParetoType2_vv_701;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_702> AgradDistributionParetoType2_vv_702;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_703> AgradDistributionParetoType2_vv_703;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_704> AgradDistributionParetoType2_vv_704;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_705> AgradDistributionParetoType2_vv_705;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_706> AgradDistributionParetoType2_vv_706;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_707> AgradDistributionParetoType2_vv_707;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_708> AgradDistributionParetoType2_vv_708;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_709> AgradDistributionParetoType2_vv_709;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_710> AgradDistributionParetoType2_vv_710;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_711> AgradDistributionParetoType2_vv_711;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_712> AgradDistributionParetoType2_vv_712;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_713> AgradDistributionParetoType2_vv_713;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_714> AgradDistributionParetoType2_vv_714;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_715> AgradDistributionParetoType2_vv_715;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_716> AgradDistributionParetoType2_vv_716;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_717> AgradDistributionParetoType2_vv_717;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_718> AgradDistributionParetoType2_vv_718;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_719> AgradDistributionParetoType2_vv_719;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_720> AgradDistributionParetoType2_vv_720;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_721> AgradDistributionParetoType2_vv_721;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_722> AgradDistributionParetoType2_vv_722;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_723> AgradDistributionParetoType2_vv_723;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_724> AgradDistributionParetoType2_vv_724;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_725> AgradDistributionParetoType2_vv_725;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_726> AgradDistributionParetoType2_vv_726;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_727> AgradDistributionParetoType2_vv_727;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_728> AgradDistributionParetoType2_vv_728;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_729> AgradDistributionParetoType2_vv_729;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_730> AgradDistributionParetoType2_vv_730;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_731> AgradDistributionParetoType2_vv_731;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_732> AgradDistributionParetoType2_vv_732;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_733> AgradDistributionParetoType2_vv_733;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_734> AgradDistributionParetoType2_vv_734;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_735> AgradDistributionParetoType2_vv_735;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_736> AgradDistributionParetoType2_vv_736;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_737> AgradDistributionParetoType2_vv_737;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_738> AgradDistributionParetoType2_vv_738;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_739> AgradDistributionParetoType2_vv_739;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_740> AgradDistributionParetoType2_vv_740;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_741> AgradDistributionParetoType2_vv_741;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_742> AgradDistributionParetoType2_vv_742;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_743> AgradDistributionParetoType2_vv_743;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_744> AgradDistributionParetoType2_vv_744;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_745> AgradDistributionParetoType2_vv_745;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_746> AgradDistributionParetoType2_vv_746;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_747> AgradDistributionParetoType2_vv_747;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_748> AgradDistributionParetoType2_vv_748;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_749> AgradDistributionParetoType2_vv_749;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_750> AgradDistributionParetoType2_vv_750;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_751> AgradDistributionParetoType2_vv_751;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_752> AgradDistributionParetoType2_vv_752;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_753> AgradDistributionParetoType2_vv_753;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_754> AgradDistributionParetoType2_vv_754;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_755> AgradDistributionParetoType2_vv_755;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_756> AgradDistributionParetoType2_vv_756;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_757> AgradDistributionParetoType2_vv_757;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_758> AgradDistributionParetoType2_vv_758;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_759> AgradDistributionParetoType2_vv_759;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_760> AgradDistributionParetoType2_vv_760;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_761> AgradDistributionParetoType2_vv_761;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_762> AgradDistributionParetoType2_vv_762;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_763> AgradDistributionParetoType2_vv_763;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_764> AgradDistributionParetoType2_vv_764;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_765> AgradDistributionParetoType2_vv_765;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_766> AgradDistributionParetoType2_vv_766;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_767> AgradDistributionParetoType2_vv_767;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_768> AgradDistributionParetoType2_vv_768;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_769> AgradDistributionParetoType2_vv_769;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_770> AgradDistributionParetoType2_vv_770;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_771> AgradDistributionParetoType2_vv_771;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_772> AgradDistributionParetoType2_vv_772;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_773> AgradDistributionParetoType2_vv_773;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_774> AgradDistributionParetoType2_vv_774;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_775> AgradDistributionParetoType2_vv_775;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_776> AgradDistributionParetoType2_vv_776;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_777> AgradDistributionParetoType2_vv_777;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_778> AgradDistributionParetoType2_vv_778;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_779> AgradDistributionParetoType2_vv_779;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_780> AgradDistributionParetoType2_vv_780;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_781> AgradDistributionParetoType2_vv_781;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_782> AgradDistributionParetoType2_vv_782;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_783> AgradDistributionParetoType2_vv_783;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_784> AgradDistributionParetoType2_vv_784;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_785> AgradDistributionParetoType2_vv_785;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_786> AgradDistributionParetoType2_vv_786;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_787> AgradDistributionParetoType2_vv_787;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_788> AgradDistributionParetoType2_vv_788;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_789> AgradDistributionParetoType2_vv_789;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_790> AgradDistributionParetoType2_vv_790;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_791> AgradDistributionParetoType2_vv_791;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_792> AgradDistributionParetoType2_vv_792;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_793> AgradDistributionParetoType2_vv_793;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_794> AgradDistributionParetoType2_vv_794;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_795> AgradDistributionParetoType2_vv_795;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_796> AgradDistributionParetoType2_vv_796;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_797> AgradDistributionParetoType2_vv_797;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_798> AgradDistributionParetoType2_vv_798;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_799> AgradDistributionParetoType2_vv_799;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_700, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_700);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_701, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_701);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_702, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_702);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_703, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_703);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_704, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_704);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_705, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_705);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_706, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_706);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_707, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_707);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_708, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_708);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_709, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_709);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_710, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_710);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_711, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_711);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_712, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_712);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_713, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_713);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_714, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_714);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_715, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_715);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_716, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_716);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_717, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_717);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_718, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_718);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_719, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_719);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_720, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_720);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_721, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_721);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_722, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_722);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_723, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_723);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_724, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_724);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_725, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_725);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_726, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_726);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_727, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_727);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_728, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_728);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_729, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_729);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_730, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_730);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_731, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_731);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_732, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_732);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_733, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_733);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_734, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_734);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_735, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_735);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_736, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_736);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_737, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_737);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_738, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_738);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_739, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_739);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_740, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_740);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_741, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_741);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_742, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_742);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_743, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_743);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_744, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_744);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_745, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_745);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_746, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_746);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_747, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_747);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_748, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_748);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_749, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_749);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_750, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_750);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_751, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_751);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_752, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_752);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_753, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_753);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_754, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_754);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_755, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_755);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_756, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_756);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_757, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_757);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_758, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_758);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_759, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_759);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_760, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_760);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_761, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_761);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_762, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_762);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_763, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_763);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_764, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_764);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_765, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_765);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_766, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_766);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_767, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_767);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_768, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_768);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_769, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_769);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_770, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_770);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_771, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_771);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_772, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_772);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_773, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_773);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_774, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_774);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_775, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_775);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_776, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_776);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_777, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_777);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_778, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_778);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_779, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_779);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_780, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_780);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_781, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_781);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_782, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_782);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_783, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_783);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_784, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_784);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_785, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_785);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_786, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_786);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_787, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_787);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_788, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_788);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_789, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_789);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_790, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_790);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_791, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_791);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_792, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_792);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_793, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_793);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_794, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_794);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_795, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_795);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_796, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_796);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_797, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_797);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_798, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_798);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_799, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_799);
+
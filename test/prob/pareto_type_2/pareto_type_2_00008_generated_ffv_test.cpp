@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_test.hpp>
+
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_800;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, double, empty, empty> type_ffv_801;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_802;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_803;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_804;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_805;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_806;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_807;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_808;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_809;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_810;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_811;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_812;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_813;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_814;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_815;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_816;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_817;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_818;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, double, double, empty, empty> type_ffv_819;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, double, std::vector<double>, empty, empty> type_ffv_820;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_821;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, double, fvar<fvar<var> >, empty, empty> type_ffv_822;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_823;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_824;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, double, empty, empty> type_ffv_825;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_826;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_827;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_828;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_829;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_830;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_831;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_832;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_833;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_834;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_835;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_836;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, double, empty, empty> type_ffv_837;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_838;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_839;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_840;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_841;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_842;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_843;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_844;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_845;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_846;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_847;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_848;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_849;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_850;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_851;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_852;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_853;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_854;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty> type_ffv_855;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_ffv_856;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_857;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_858;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_859;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_860;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_ffv_861;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_862;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_863;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_864;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_865;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_866;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_867;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_868;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_869;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_870;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_871;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_872;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_873;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_874;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_875;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_876;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_877;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_878;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_879;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_880;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_881;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_882;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_883;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_884;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_885;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_886;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_887;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_888;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_889;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_890;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, double, empty, empty> type_ffv_891;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, std::vector<double>, empty, empty> type_ffv_892;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_893;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, fvar<fvar<var> >, empty, empty> type_ffv_894;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_895;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_896;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, double, empty, empty> type_ffv_897;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty, empty> type_ffv_898;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_899;
+
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_800> AgradDistributionParetoType2_ffv_800;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_801> AgradDistributionParetoType2_ffv_801;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_802> AgradDistributionParetoType2_ffv_802;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_803> AgradDistributionParetoType2_ffv_803;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_804> AgradDistributionParetoType2_ffv_804;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_805> AgradDistributionParetoType2_ffv_805;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_806> AgradDistributionParetoType2_ffv_806;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_807> AgradDistributionParetoType2_ffv_807;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_808> AgradDistributionParetoType2_ffv_808;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_809> AgradDistributionParetoType2_ffv_809;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_810> AgradDistributionParetoType2_ffv_810;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_811> AgradDistributionParetoType2_ffv_811;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_812> AgradDistributionParetoType2_ffv_812;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_813> AgradDistributionParetoType2_ffv_813;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_814> AgradDistributionParetoType2_ffv_814;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_815> AgradDistributionParetoType2_ffv_815;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_816> AgradDistributionParetoType2_ffv_816;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_817> AgradDistributionParetoType2_ffv_817;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_818> AgradDistributionParetoType2_ffv_818;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_819> AgradDistributionParetoType2_ffv_819;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_820> AgradDistributionParetoType2_ffv_820;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_821> AgradDistributionParetoType2_ffv_821;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_822> AgradDistributionParetoType2_ffv_822;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_823> AgradDistributionParetoType2_ffv_823;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_824> AgradDistributionParetoType2_ffv_824;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_825> AgradDistributionParetoType2_ffv_825;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_826> AgradDistributionParetoType2_ffv_826;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_827> AgradDistributionParetoType2_ffv_827;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_828> AgradDistributionParetoType2_ffv_828;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_829> AgradDistributionParetoType2_ffv_829;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_830> AgradDistributionParetoType2_ffv_830;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_831> AgradDistributionParetoType2_ffv_831;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_832> AgradDistributionParetoType2_ffv_832;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_833> AgradDistributionParetoType2_ffv_833;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_834> AgradDistributionParetoType2_ffv_834;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_835> AgradDistributionParetoType2_ffv_835;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_836> AgradDistributionParetoType2_ffv_836;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_837> AgradDistributionParetoType2_ffv_837;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_838> AgradDistributionParetoType2_ffv_838;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_839> AgradDistributionParetoType2_ffv_839;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_840> AgradDistributionParetoType2_ffv_840;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_841> AgradDistributionParetoType2_ffv_841;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_842> AgradDistributionParetoType2_ffv_842;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_843> AgradDistributionParetoType2_ffv_843;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_844> AgradDistributionParetoType2_ffv_844;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_845> AgradDistributionParetoType2_ffv_845;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_846> AgradDistributionParetoType2_ffv_846;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_847> AgradDistributionParetoType2_ffv_847;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_848> AgradDistributionParetoType2_ffv_848;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_849> AgradDistributionParetoType2_ffv_849;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_850> AgradDistributionParetoType2_ffv_850;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_851> AgradDistributionParetoType2_ffv_851;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_852> AgradDistributionParetoType2_ffv_852;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_853> AgradDistributionParetoType2_ffv_853;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_854> AgradDistributionParetoType2_ffv_854;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_855> AgradDistributionParetoType2_ffv_855;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_856> AgradDistributionParetoType2_ffv_856;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_857> AgradDistributionParetoType2_ffv_857;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_858> AgradDistributionParetoType2_ffv_858;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_859> AgradDistributionParetoType2_ffv_859;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_860> AgradDistributionParetoType2_ffv_860;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_861> AgradDistributionParetoType2_ffv_861;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_862> AgradDistributionParetoType2_ffv_862;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_863> AgradDistributionParetoType2_ffv_863;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_864> AgradDistributionParetoType2_ffv_864;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_865> AgradDistributionParetoType2_ffv_865;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_866> AgradDistributionParetoType2_ffv_866;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_867> AgradDistributionParetoType2_ffv_867;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_868> AgradDistributionParetoType2_ffv_868;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_869> AgradDistributionParetoType2_ffv_869;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_870> AgradDistributionParetoType2_ffv_870;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_871> AgradDistributionParetoType2_ffv_871;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_872> AgradDistributionParetoType2_ffv_872;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_873> AgradDistributionParetoType2_ffv_873;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_874> AgradDistributionParetoType2_ffv_874;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_875> AgradDistributionParetoType2_ffv_875;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_876> AgradDistributionParetoType2_ffv_876;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_877> AgradDistributionParetoType2_ffv_877;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_878> AgradDistributionParetoType2_ffv_878;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_879> AgradDistributionParetoType2_ffv_879;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_880> AgradDistributionParetoType2_ffv_880;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_881> AgradDistributionParetoType2_ffv_881;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_882> AgradDistributionParetoType2_ffv_882;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_883> AgradDistributionParetoType2_ffv_883;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_884> AgradDistributionParetoType2_ffv_884;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_885> AgradDistributionParetoType2_ffv_885;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_886> AgradDistributionParetoType2_ffv_886;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_887> AgradDistributionParetoType2_ffv_887;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_888> AgradDistributionParetoType2_ffv_888;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_889> AgradDistributionParetoType2_ffv_889;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_890> AgradDistributionParetoType2_ffv_890;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_891> AgradDistributionParetoType2_ffv_891;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_892> AgradDistributionParetoType2_ffv_892;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_893> AgradDistributionParetoType2_ffv_893;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_894> AgradDistributionParetoType2_ffv_894;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_895> AgradDistributionParetoType2_ffv_895;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_896> AgradDistributionParetoType2_ffv_896;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_897> AgradDistributionParetoType2_ffv_897;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_898> AgradDistributionParetoType2_ffv_898;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_899> AgradDistributionParetoType2_ffv_899;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_800, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_800);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_801, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_801);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_802, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_802);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_803, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_803);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_804, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_804);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_805, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_805);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_806, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_806);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_807, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_807);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_808, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_808);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_809, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_809);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_810, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_810);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_811, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_811);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_812, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_812);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_813, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_813);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_814, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_814);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_815, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_815);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_816, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_816);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_817, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_817);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_818, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_818);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_819, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_819);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_820, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_820);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_821, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_821);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_822, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_822);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_823, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_823);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_824, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_824);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_825, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_825);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_826, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_826);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_827, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_827);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_828, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_828);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_829, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_829);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_830, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_830);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_831, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_831);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_832, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_832);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_833, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_833);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_834, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_834);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_835, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_835);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_836, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_836);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_837, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_837);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_838, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_838);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_839, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_839);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_840, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_840);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_841, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_841);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_842, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_842);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_843, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_843);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_844, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_844);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_845, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_845);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_846, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_846);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_847, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_847);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_848, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_848);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_849, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_849);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_850, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_850);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_851, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_851);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_852, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_852);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_853, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_853);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_854, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_854);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_855, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_855);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_856, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_856);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_857, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_857);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_858, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_858);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_859, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_859);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_860, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_860);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_861, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_861);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_862, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_862);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_863, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_863);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_864, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_864);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_865, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_865);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_866, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_866);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_867, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_867);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_868, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_868);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_869, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_869);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_870, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_870);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_871, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_871);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_872, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_872);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_873, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_873);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_874, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_874);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_875, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_875);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_876, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_876);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_877, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_877);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_878, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_878);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_879, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_879);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_880, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_880);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_881, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_881);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_882, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_882);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_883, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_883);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_884, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_884);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_885, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_885);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_886, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_886);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_887, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_887);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_888, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_888);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_889, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_889);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_890, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_890);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_891, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_891);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_892, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_892);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_893, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_893);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_894, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_894);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_895, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_895);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_896, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_896);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_897, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_897);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_898, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_898);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_899, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_899);
+
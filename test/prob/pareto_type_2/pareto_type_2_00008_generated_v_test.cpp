@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_test.hpp>
+
+typedef std::tuple<var, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_800;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, var, empty, empty> type_v_801;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_v_802;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_803;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_804;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_805;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_806;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_807;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_808;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_809;
+typedef std::tuple<var, std::vector<var>, var, double, empty, empty> type_v_810;
+typedef std::tuple<var, std::vector<var>, var, std::vector<double>, empty, empty> type_v_811;
+typedef std::tuple<var, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_812;
+typedef std::tuple<var, std::vector<var>, var, var, empty, empty> type_v_813;
+typedef std::tuple<var, std::vector<var>, var, std::vector<var>, empty, empty> type_v_814;
+typedef std::tuple<var, std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_815;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, double, empty, empty> type_v_816;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_v_817;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_818;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, var, empty, empty> type_v_819;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_v_820;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_821;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_822;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_823;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_824;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_825;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_826;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_827;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_828;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_829;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_830;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_831;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_832;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_833;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_834;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_835;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_836;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_837;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_838;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_839;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_840;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_841;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_842;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_843;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_844;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_845;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_846;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_847;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_848;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_849;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_850;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_851;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_852;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_853;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_854;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_855;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_856;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_857;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_858;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_859;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_860;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_861;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_862;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_863;
+typedef std::tuple<std::vector<var>, double, double, double, empty, empty> type_v_864;
+typedef std::tuple<std::vector<var>, double, double, std::vector<double>, empty, empty> type_v_865;
+typedef std::tuple<std::vector<var>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_866;
+typedef std::tuple<std::vector<var>, double, double, var, empty, empty> type_v_867;
+typedef std::tuple<std::vector<var>, double, double, std::vector<var>, empty, empty> type_v_868;
+typedef std::tuple<std::vector<var>, double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_869;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, double, empty, empty> type_v_870;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, std::vector<double>, empty, empty> type_v_871;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_872;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, var, empty, empty> type_v_873;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, std::vector<var>, empty, empty> type_v_874;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_875;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_876;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_877;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_878;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_879;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_880;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_881;
+typedef std::tuple<std::vector<var>, double, var, double, empty, empty> type_v_882;
+typedef std::tuple<std::vector<var>, double, var, std::vector<double>, empty, empty> type_v_883;
+typedef std::tuple<std::vector<var>, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_884;
+typedef std::tuple<std::vector<var>, double, var, var, empty, empty> type_v_885;
+typedef std::tuple<std::vector<var>, double, var, std::vector<var>, empty, empty> type_v_886;
+typedef std::tuple<std::vector<var>, double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_887;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, double, empty, empty> type_v_888;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, std::vector<double>, empty, empty> type_v_889;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_890;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, var, empty, empty> type_v_891;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, std::vector<var>, empty, empty> type_v_892;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_893;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_894;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_895;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_896;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_897;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_898;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_899;
+
+typedef std::tuple<AgradDistributionParetoType2, type_v_800> AgradDistributionParetoType2_v_800;
+typedef std::tuple<AgradDistributionParetoType2, type_v_801> AgradDistributionParetoType2_v_801;
+typedef std::tuple<AgradDistributionParetoType2, type_v_802> AgradDistributionParetoType2_v_802;
+typedef std::tuple<AgradDistributionParetoType2, type_v_803> AgradDistributionParetoType2_v_803;
+typedef std::tuple<AgradDistributionParetoType2, type_v_804> AgradDistributionParetoType2_v_804;
+typedef std::tuple<AgradDistributionParetoType2, type_v_805> AgradDistributionParetoType2_v_805;
+typedef std::tuple<AgradDistributionParetoType2, type_v_806> AgradDistributionParetoType2_v_806;
+typedef std::tuple<AgradDistributionParetoType2, type_v_807> AgradDistributionParetoType2_v_807;
+typedef std::tuple<AgradDistributionParetoType2, type_v_808> AgradDistributionParetoType2_v_808;
+typedef std::tuple<AgradDistributionParetoType2, type_v_809> AgradDistributionParetoType2_v_809;
+typedef std::tuple<AgradDistributionParetoType2, type_v_810> AgradDistributionParetoType2_v_810;
+typedef std::tuple<AgradDistributionParetoType2, type_v_811> AgradDistributionParetoType2_v_811;
+typedef std::tuple<AgradDistributionParetoType2, type_v_812> AgradDistributionParetoType2_v_812;
+typedef std::tuple<AgradDistributionParetoType2, type_v_813> AgradDistributionParetoType2_v_813;
+typedef std::tuple<AgradDistributionParetoType2, type_v_814> AgradDistributionParetoType2_v_814;
+typedef std::tuple<AgradDistributionParetoType2, type_v_815> AgradDistributionParetoType2_v_815;
+typedef std::tuple<AgradDistributionParetoType2, type_v_816> AgradDistributionParetoType2_v_816;
+typedef std::tuple<AgradDistributionParetoType2, type_v_817> AgradDistributionParetoType2_v_817;
+typedef std::tuple<AgradDistributionParetoType2, type_v_818> AgradDistributionParetoType2_v_818;
+typedef std::tuple<AgradDistributionParetoType2, type_v_819> AgradDistributionParetoType2_v_819;
+typedef std::tuple<AgradDistributionParetoType2, type_v_820> AgradDistributionParetoType2_v_820;
+typedef std::tuple<AgradDistributionParetoType2, type_v_821> AgradDistributionParetoType2_v_821;
+typedef std::tuple<AgradDistributionParetoType2, type_v_822> AgradDistributionParetoType2_v_822;
+typedef std::tuple<AgradDistributionParetoType2, type_v_823> AgradDistributionParetoType2_v_823;
+typedef std::tuple<AgradDistributionParetoType2, type_v_824> AgradDistributionParetoType2_v_824;
+typedef std::tuple<AgradDistributionParetoType2, type_v_825> AgradDistributionParetoType2_v_825;
+typedef std::tuple<AgradDistributionParetoType2, type_v_826> AgradDistributionParetoType2_v_826;
+typedef std::tuple<AgradDistributionParetoType2, type_v_827> AgradDistributionParetoType2_v_827;
+typedef std::tuple<AgradDistributionParetoType2, type_v_828> AgradDistributionParetoType2_v_828;
+typedef std::tuple<AgradDistributionParetoType2, type_v_829> AgradDistributionParetoType2_v_829;
+typedef std::tuple<AgradDistributionParetoType2, type_v_830> AgradDistributionParetoType2_v_830;
+typedef std::tuple<AgradDistributionParetoType2, type_v_831> AgradDistributionParetoType2_v_831;
+typedef std::tuple<AgradDistributionParetoType2, type_v_832> AgradDistributionParetoType2_v_832;
+typedef std::tuple<AgradDistributionParetoType2, type_v_833> AgradDistributionParetoType2_v_833;
+typedef std::tuple<AgradDistributionParetoType2, type_v_834> AgradDistributionParetoType2_v_834;
+typedef std::tuple<AgradDistributionParetoType2, type_v_835> AgradDistributionParetoType2_v_835;
+typedef std::tuple<AgradDistributionParetoType2, type_v_836> AgradDistributionParetoType2_v_836;
+typedef std::tuple<AgradDistributionParetoType2, type_v_837> AgradDistributionParetoType2_v_837;
+typedef std::tuple<AgradDistributionParetoType2, type_v_838> AgradDistributionParetoType2_v_838;
+typedef std::tuple<AgradDistributionParetoType2, type_v_839> AgradDistributionParetoType2_v_839;
+typedef std::tuple<AgradDistributionParetoType2, type_v_840> AgradDistributionParetoType2_v_840;
+typedef std::tuple<AgradDistributionParetoType2, type_v_841> AgradDistributionParetoType2_v_841;
+typedef std::tuple<AgradDistributionParetoType2, type_v_842> AgradDistributionParetoType2_v_842;
+typedef std::tuple<AgradDistributionParetoType2, type_v_843> AgradDistributionParetoType2_v_843;
+typedef std::tuple<AgradDistributionParetoType2, type_v_844> AgradDistributionParetoType2_v_844;
+typedef std::tuple<AgradDistributionParetoType2, type_v_845> AgradDistributionParetoType2_v_845;
+typedef std::tuple<AgradDistributionParetoType2, type_v_846> AgradDistributionParetoType2_v_846;
+typedef std::tuple<AgradDistributionParetoType2, type_v_847> AgradDistributionParetoType2_v_847;
+typedef std::tuple<AgradDistributionParetoType2, type_v_848> AgradDistributionParetoType2_v_848;
+typedef std::tuple<AgradDistributionParetoType2, type_v_849> AgradDistributionParetoType2_v_849;
+typedef std::tuple<AgradDistributionParetoType2, type_v_850> AgradDistributionParetoType2_v_850;
+typedef std::tuple<AgradDistributionParetoType2, type_v_851> AgradDistributionParetoType2_v_851;
+typedef std::tuple<AgradDistributionParetoType2, type_v_852> AgradDistributionParetoType2_v_852;
+typedef std::tuple<AgradDistributionParetoType2, type_v_853> AgradDistributionParetoType2_v_853;
+typedef std::tuple<AgradDistributionParetoType2, type_v_854> AgradDistributionParetoType2_v_854;
+typedef std::tuple<AgradDistributionParetoType2, type_v_855> AgradDistributionParetoType2_v_855;
+typedef std::tuple<AgradDistributionParetoType2, type_v_856> AgradDistributionParetoType2_v_856;
+typedef std::tuple<AgradDistributionParetoType2, type_v_857> AgradDistributionParetoType2_v_857;
+typedef std::tuple<AgradDistributionParetoType2, type_v_858> AgradDistributionParetoType2_v_858;
+typedef std::tuple<AgradDistributionParetoType2, type_v_859> AgradDistributionParetoType2_v_859;
+typedef std::tuple<AgradDistributionParetoType2, type_v_860> AgradDistributionParetoType2_v_860;
+typedef std::tuple<AgradDistributionParetoType2, type_v_861> AgradDistributionParetoType2_v_861;
+typedef std::tuple<AgradDistributionParetoType2, type_v_862> AgradDistributionParetoType2_v_862;
+typedef std::tuple<AgradDistributionParetoType2, type_v_863> AgradDistributionParetoType2_v_863;
+typedef std::tuple<AgradDistributionParetoType2, type_v_864> AgradDistributionParetoType2_v_864;
+typedef std::tuple<AgradDistributionParetoType2, type_v_865> AgradDistributionParetoType2_v_865;
+typedef std::tuple<AgradDistributionParetoType2, type_v_866> AgradDistributionParetoType2_v_866;
+typedef std::tuple<AgradDistributionParetoType2, type_v_867> AgradDistributionParetoType2_v_867;
+typedef std::tuple<AgradDistributionParetoType2, type_v_868> AgradDistributionParetoType2_v_868;
+typedef std::tuple<AgradDistributionParetoType2, type_v_869> AgradDistributionParetoType2_v_869;
+typedef std::tuple<AgradDistributionParetoType2, type_v_870> AgradDistributionParetoType2_v_870;
+typedef std::tuple<AgradDistributionParetoType2, type_v_871> AgradDistributionParetoType2_v_871;
+typedef std::tuple<AgradDistributionParetoType2, type_v_872> AgradDistributionParetoType2_v_872;
+typedef std::tuple<AgradDistributionParetoType2, type_v_873> AgradDistributionParetoType2_v_873;
+typedef std::tuple<AgradDistributionParetoType2, type_v_874> AgradDistributionParetoType2_v_874;
+typedef std::tuple<AgradDistributionParetoType2, type_v_875> AgradDistributionParetoType2_v_875;
+typedef std::tuple<AgradDistributionParetoType2, type_v_876> AgradDistributionParetoType2_v_876;
+typedef std::tuple<AgradDistributionParetoType2, type_v_877> AgradDistributionParetoType2_v_877;
+typedef std::tuple<AgradDistributionParetoType2, type_v_878> AgradDistributionParetoType2_v_878;
+typedef std::tuple<AgradDistributionParetoType2, type_v_879> AgradDistributionParetoType2_v_879;
+typedef std::tuple<AgradDistributionParetoType2, type_v_880> AgradDistributionParetoType2_v_880;
+typedef std::tuple<AgradDistributionParetoType2, type_v_881> AgradDistributionParetoType2_v_881;
+typedef std::tuple<AgradDistributionParetoType2, type_v_882> AgradDistributionParetoType2_v_882;
+typedef std::tuple<AgradDistributionParetoType2, type_v_883> AgradDistributionParetoType2_v_883;
+typedef std::tuple<AgradDistributionParetoType2, type_v_884> AgradDistributionParetoType2_v_884;
+typedef std::tuple<AgradDistributionParetoType2, type_v_885> AgradDistributionParetoType2_v_885;
+typedef std::tuple<AgradDistributionParetoType2, type_v_886> AgradDistributionParetoType2_v_886;
+typedef std::tuple<AgradDistributionParetoType2, type_v_887> AgradDistributionParetoType2_v_887;
+typedef std::tuple<AgradDistributionParetoType2, type_v_888> AgradDistributionParetoType2_v_888;
+typedef std::tuple<AgradDistributionParetoType2, type_v_889> AgradDistributionParetoType2_v_889;
+typedef std::tuple<AgradDistributionParetoType2, type_v_890> AgradDistributionParetoType2_v_890;
+typedef std::tuple<AgradDistributionParetoType2, type_v_891> AgradDistributionParetoType2_v_891;
+typedef std::tuple<AgradDistributionParetoType2, type_v_892> AgradDistributionParetoType2_v_892;
+typedef std::tuple<AgradDistributionParetoType2, type_v_893> AgradDistributionParetoType2_v_893;
+typedef std::tuple<AgradDistributionParetoType2, type_v_894> AgradDistributionParetoType2_v_894;
+typedef std::tuple<AgradDistributionParetoType2, type_v_895> AgradDistributionParetoType2_v_895;
+typedef std::tuple<AgradDistributionParetoType2, type_v_896> AgradDistributionParetoType2_v_896;
+typedef std::tuple<AgradDistributionParetoType2, type_v_897> AgradDistributionParetoType2_v_897;
+typedef std::tuple<AgradDistributionParetoType2, type_v_898> AgradDistributionParetoType2_v_898;
+typedef std::tuple<AgradDistributionParetoType2, type_v_899> AgradDistributionParetoType2_v_899;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_800, AgradDistributionTestFixture, AgradDistributionParetoType2_v_800);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_801, AgradDistributionTestFixture, AgradDistributionParetoType2_v_801);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_802, AgradDistributionTestFixture, AgradDistributionParetoType2_v_802);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_803, AgradDistributionTestFixture, AgradDistributionParetoType2_v_803);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_804, AgradDistributionTestFixture, AgradDistributionParetoType2_v_804);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_805, AgradDistributionTestFixture, AgradDistributionParetoType2_v_805);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_806, AgradDistributionTestFixture, AgradDistributionParetoType2_v_806);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_807, AgradDistributionTestFixture, AgradDistributionParetoType2_v_807);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_808, AgradDistributionTestFixture, AgradDistributionParetoType2_v_808);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_809, AgradDistributionTestFixture, AgradDistributionParetoType2_v_809);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_810, AgradDistributionTestFixture, AgradDistributionParetoType2_v_810);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_811, AgradDistributionTestFixture, AgradDistributionParetoType2_v_811);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_812, AgradDistributionTestFixture, AgradDistributionParetoType2_v_812);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_813, AgradDistributionTestFixture, AgradDistributionParetoType2_v_813);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_814, AgradDistributionTestFixture, AgradDistributionParetoType2_v_814);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_815, AgradDistributionTestFixture, AgradDistributionParetoType2_v_815);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_816, AgradDistributionTestFixture, AgradDistributionParetoType2_v_816);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_817, AgradDistributionTestFixture, AgradDistributionParetoType2_v_817);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_818, AgradDistributionTestFixture, AgradDistributionParetoType2_v_818);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_819, AgradDistributionTestFixture, AgradDistributionParetoType2_v_819);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_820, AgradDistributionTestFixture, AgradDistributionParetoType2_v_820);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_821, AgradDistributionTestFixture, AgradDistributionParetoType2_v_821);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_822, AgradDistributionTestFixture, AgradDistributionParetoType2_v_822);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_823, AgradDistributionTestFixture, AgradDistributionParetoType2_v_823);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_824, AgradDistributionTestFixture, AgradDistributionParetoType2_v_824);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_825, AgradDistributionTestFixture, AgradDistributionParetoType2_v_825);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_826, AgradDistributionTestFixture, AgradDistributionParetoType2_v_826);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_827, AgradDistributionTestFixture, AgradDistributionParetoType2_v_827);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_828, AgradDistributionTestFixture, AgradDistributionParetoType2_v_828);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_829, AgradDistributionTestFixture, AgradDistributionParetoType2_v_829);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_830, AgradDistributionTestFixture, AgradDistributionParetoType2_v_830);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_831, AgradDistributionTestFixture, AgradDistributionParetoType2_v_831);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_832, AgradDistributionTestFixture, AgradDistributionParetoType2_v_832);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_833, AgradDistributionTestFixture, AgradDistributionParetoType2_v_833);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_834, AgradDistributionTestFixture, AgradDistributionParetoType2_v_834);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_835, AgradDistributionTestFixture, AgradDistributionParetoType2_v_835);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_836, AgradDistributionTestFixture, AgradDistributionParetoType2_v_836);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_837, AgradDistributionTestFixture, AgradDistributionParetoType2_v_837);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_838, AgradDistributionTestFixture, AgradDistributionParetoType2_v_838);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_839, AgradDistributionTestFixture, AgradDistributionParetoType2_v_839);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_840, AgradDistributionTestFixture, AgradDistributionParetoType2_v_840);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_841, AgradDistributionTestFixture, AgradDistributionParetoType2_v_841);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_842, AgradDistributionTestFixture, AgradDistributionParetoType2_v_842);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_843, AgradDistributionTestFixture, AgradDistributionParetoType2_v_843);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_844, AgradDistributionTestFixture, AgradDistributionParetoType2_v_844);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_845, AgradDistributionTestFixture, AgradDistributionParetoType2_v_845);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_846, AgradDistributionTestFixture, AgradDistributionParetoType2_v_846);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_847, AgradDistributionTestFixture, AgradDistributionParetoType2_v_847);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_848, AgradDistributionTestFixture, AgradDistributionParetoType2_v_848);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_849, AgradDistributionTestFixture, AgradDistributionParetoType2_v_849);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_850, AgradDistributionTestFixture, AgradDistributionParetoType2_v_850);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_851, AgradDistributionTestFixture, AgradDistributionParetoType2_v_851);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_852, AgradDistributionTestFixture, AgradDistributionParetoType2_v_852);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_853, AgradDistributionTestFixture, AgradDistributionParetoType2_v_853);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_854, AgradDistributionTestFixture, AgradDistributionParetoType2_v_854);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_855, AgradDistributionTestFixture, AgradDistributionParetoType2_v_855);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_856, AgradDistributionTestFixture, AgradDistributionParetoType2_v_856);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_857, AgradDistributionTestFixture, AgradDistributionParetoType2_v_857);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_858, AgradDistributionTestFixture, AgradDistributionParetoType2_v_858);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_859, AgradDistributionTestFixture, AgradDistributionParetoType2_v_859);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_860, AgradDistributionTestFixture, AgradDistributionParetoType2_v_860);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_861, AgradDistributionTestFixture, AgradDistributionParetoType2_v_861);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_862, AgradDistributionTestFixture, AgradDistributionParetoType2_v_862);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_863, AgradDistributionTestFixture, AgradDistributionParetoType2_v_863);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_864, AgradDistributionTestFixture, AgradDistributionParetoType2_v_864);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_865, AgradDistributionTestFixture, AgradDistributionParetoType2_v_865);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_866, AgradDistributionTestFixture, AgradDistributionParetoType2_v_866);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_867, AgradDistributionTestFixture, AgradDistributionParetoType2_v_867);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_868, AgradDistributionTestFixture, AgradDistributionParetoType2_v_868);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_869, AgradDistributionTestFixture, AgradDistributionParetoType2_v_869);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_870, AgradDistributionTestFixture, AgradDistributionParetoType2_v_870);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_871, AgradDistributionTestFixture, AgradDistributionParetoType2_v_871);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_872, AgradDistributionTestFixture, AgradDistributionParetoType2_v_872);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_873, AgradDistributionTestFixture, AgradDistributionParetoType2_v_873);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_874, AgradDistributionTestFixture, AgradDistributionParetoType2_v_874);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_875, AgradDistributionTestFixture, AgradDistributionParetoType2_v_875);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_876, AgradDistributionTestFixture, AgradDistributionParetoType2_v_876);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_877, AgradDistributionTestFixture, AgradDistributionParetoType2_v_877);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_878, AgradDistributionTestFixture, AgradDistributionParetoType2_v_878);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_879, AgradDistributionTestFixture, AgradDistributionParetoType2_v_879);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_880, AgradDistributionTestFixture, AgradDistributionParetoType2_v_880);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_881, AgradDistributionTestFixture, AgradDistributionParetoType2_v_881);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_882, AgradDistributionTestFixture, AgradDistributionParetoType2_v_882);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_883, AgradDistributionTestFixture, AgradDistributionParetoType2_v_883);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_884, AgradDistributionTestFixture, AgradDistributionParetoType2_v_884);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_885, AgradDistributionTestFixture, AgradDistributionParetoType2_v_885);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_886, AgradDistributionTestFixture, AgradDistributionParetoType2_v_886);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_887, AgradDistributionTestFixture, AgradDistributionParetoType2_v_887);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_888, AgradDistributionTestFixture, AgradDistributionParetoType2_v_888);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_889, AgradDistributionTestFixture, AgradDistributionParetoType2_v_889);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_890, AgradDistributionTestFixture, AgradDistributionParetoType2_v_890);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_891, AgradDistributionTestFixture, AgradDistributionParetoType2_v_891);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_892, AgradDistributionTestFixture, AgradDistributionParetoType2_v_892);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_893, AgradDistributionTestFixture, AgradDistributionParetoType2_v_893);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_894, AgradDistributionTestFixture, AgradDistributionParetoType2_v_894);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_895, AgradDistributionTestFixture, AgradDistributionParetoType2_v_895);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_896, AgradDistributionTestFixture, AgradDistributionParetoType2_v_896);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_897, AgradDistributionTestFixture, AgradDistributionParetoType2_v_897);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_898, AgradDistributionTestFixture, AgradDistributionParetoType2_v_898);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_899, AgradDistributionTestFixture, AgradDistributionParetoType2_v_899);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_test.hpp>
+
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_800;
+typedef std::tuple<std::vector<var>, double, var, double, empty, empty> type_vv_801;
+typedef std::tuple<std::vector<var>, double, var, std::vector<double>, empty, empty> type_vv_802;
+typedef std::tuple<std::vector<var>, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_803;
+typedef std::tuple<std::vector<var>, double, var, var, empty, empty> type_vv_804;
+typedef std::tuple<std::vector<var>, double, var, std::vector<var>, empty, empty> type_vv_805;
+typedef std::tuple<std::vector<var>, double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_806;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, double, empty, empty> type_vv_807;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, std::vector<double>, empty, empty> type_vv_808;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_809;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, var, empty, empty> type_vv_810;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, std::vector<var>, empty, empty> type_vv_811;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_812;
+typedef std::tuple<std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_813;
+typedef std::tuple<std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_814;
+typedef std::tuple<std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_815;
+typedef std::tuple<std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_816;
+typedef std::tuple<std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_817;
+typedef std::tuple<std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_818;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, double, empty, empty> type_vv_819;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, std::vector<double>, empty, empty> type_vv_820;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_821;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, var, empty, empty> type_vv_822;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, std::vector<var>, empty, empty> type_vv_823;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_824;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, double, empty, empty> type_vv_825;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, std::vector<double>, empty, empty> type_vv_826;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_827;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, var, empty, empty> type_vv_828;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_vv_829;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_830;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_831;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_832;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_833;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_834;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_835;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_836;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, double, empty, empty> type_vv_837;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, std::vector<double>, empty, empty> type_vv_838;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_839;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, var, empty, empty> type_vv_840;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, std::vector<var>, empty, empty> type_vv_841;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_842;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, double, empty, empty> type_vv_843;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_vv_844;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_845;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, var, empty, empty> type_vv_846;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_vv_847;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_848;
+typedef std::tuple<std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_849;
+typedef std::tuple<std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_850;
+typedef std::tuple<std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_851;
+typedef std::tuple<std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_852;
+typedef std::tuple<std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_853;
+typedef std::tuple<std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_854;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty> type_vv_855;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_vv_856;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_857;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_vv_858;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_vv_859;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_860;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_vv_861;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_vv_862;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_863;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_vv_864;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_vv_865;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_866;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_867;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_868;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_869;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_870;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_871;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_872;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_vv_873;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_vv_874;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_875;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_vv_876;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_vv_877;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_878;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_vv_879;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_vv_880;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_881;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_vv_882;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_vv_883;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_884;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_885;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_886;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_887;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_888;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_889;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_890;
+typedef std::tuple<std::vector<var>, var, double, double, empty, empty> type_vv_891;
+typedef std::tuple<std::vector<var>, var, double, std::vector<double>, empty, empty> type_vv_892;
+typedef std::tuple<std::vector<var>, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_893;
+typedef std::tuple<std::vector<var>, var, double, var, empty, empty> type_vv_894;
+typedef std::tuple<std::vector<var>, var, double, std::vector<var>, empty, empty> type_vv_895;
+typedef std::tuple<std::vector<var>, var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_896;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, double, empty, empty> type_vv_897;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, std::vector<double>, empty, empty> type_vv_898;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_899;
+
+typedef std::tuple<AgradDistributionParetoType2, type_vv_800> AgradDistributionParetoType2_vv_800;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_801> AgradDistributionParetoType2_vv_801;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_802> AgradDistributionParetoType2_vv_802;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_803> AgradDistributionParetoType2_vv_803;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_804> AgradDistributionParetoType2_vv_804;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_805> AgradDistributionParetoType2_vv_805;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_806> AgradDistributionParetoType2_vv_806;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_807> AgradDistributionParetoType2_vv_807;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_808> AgradDistributionParetoType2_vv_808;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_809> AgradDistributionParetoType2_vv_809;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_810> AgradDistributionParetoType2_vv_810;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_811> AgradDistributionParetoType2_vv_811;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_812> AgradDistributionParetoType2_vv_812;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_813> AgradDistributionParetoType2_vv_813;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_814> AgradDistributionParetoType2_vv_814;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_815> AgradDistributionParetoType2_vv_815;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_816> AgradDistributionParetoType2_vv_816;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_817> AgradDistributionParetoType2_vv_817;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_818> AgradDistributionParetoType2_vv_818;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_819> AgradDistributionParetoType2_vv_819;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_820> AgradDistributionParetoType2_vv_820;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_821> AgradDistributionParetoType2_vv_821;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_822> AgradDistributionParetoType2_vv_822;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_823> AgradDistributionParetoType2_vv_823;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_824> AgradDistributionParetoType2_vv_824;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_825> AgradDistributionParetoType2_vv_825;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_826> AgradDistributionParetoType2_vv_826;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_827> AgradDistributionParetoType2_vv_827;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_828> AgradDistributionParetoType2_vv_828;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_829> AgradDistributionParetoType2_vv_829;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_830> AgradDistributionParetoType2_vv_830;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_831> AgradDistributionParetoType2_vv_831;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_832> AgradDistributionParetoType2_vv_832;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_833> AgradDistributionParetoType2_vv_833;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_834> AgradDistributionParetoType2_vv_834;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_835> AgradDistributionParetoType2_vv_835;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_836> AgradDistributionParetoType2_vv_836;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_837> AgradDistributionParetoType2_vv_837;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_838> AgradDistributionParetoType2_vv_838;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_839> AgradDistributionParetoType2_vv_839;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_840> AgradDistributionParetoType2_vv_840;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_841> AgradDistributionParetoType2_vv_841;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_842> AgradDistributionParetoType2_vv_842;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_843> AgradDistributionParetoType2_vv_843;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_844> AgradDistributionParetoType2_vv_844;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_845> AgradDistributionParetoType2_vv_845;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_846> AgradDistributionParetoType2_vv_846;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_847> AgradDistributionParetoType2_vv_847;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_848> AgradDistributionParetoType2_vv_848;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_849> AgradDistributionParetoType2_vv_849;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_850> AgradDistributionParetoType2_vv_850;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_851> AgradDistributionParetoType2_vv_851;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_852> AgradDistributionParetoType2_vv_852;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_853> AgradDistributionParetoType2_vv_853;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_854> AgradDistributionParetoType2_vv_854;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_855> AgradDistributionParetoType2_vv_855;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_856> AgradDistributionParetoType2_vv_856;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_857> AgradDistributionParetoType2_vv_857;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_858> AgradDistributionParetoType2_vv_858;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_859> AgradDistributionParetoType2_vv_859;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_860> AgradDistributionParetoType2_vv_860;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_861> AgradDistributionParetoType2_vv_861;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_862> AgradDistributionParetoType2_vv_862;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_863> AgradDistributionParetoType2_vv_863;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_864> AgradDistributionParetoType2_vv_864;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_865> AgradDistributionParetoType2_vv_865;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_866> AgradDistributionParetoType2_vv_866;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_867> AgradDistributionParetoType2_vv_867;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_868> AgradDistributionParetoType2_vv_868;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_869> AgradDistributionParetoType2_vv_869;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_870> AgradDistributionParetoType2_vv_870;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_871> AgradDistributionParetoType2_vv_871;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_872> AgradDistributionParetoType2_vv_872;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_873> AgradDistributionParetoType2_vv_873;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_874> AgradDistributionParetoType2_vv_874;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_875> AgradDistributionParetoType2_vv_875;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_876> AgradDistributionParetoType2_vv_876;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_877> AgradDistributionParetoType2_vv_877;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_878> AgradDistributionParetoType2_vv_878;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_879> AgradDistributionParetoType2_vv_879;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_880> AgradDistributionParetoType2_vv_880;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_881> AgradDistributionParetoType2_vv_881;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_882> AgradDistributionParetoType2_vv_882;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_883> AgradDistributionParetoType2_vv_883;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_884> AgradDistributionParetoType2_vv_884;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_885> AgradDistributionParetoType2_vv_885;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_886> AgradDistributionParetoType2_vv_886;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_887> AgradDistributionParetoType2_vv_887;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_888> AgradDistributionParetoType2_vv_888;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_889> AgradDistributionParetoType2_vv_889;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_890> AgradDistributionParetoType2_vv_890;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_891> AgradDistributionParetoType2_vv_891;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_892> AgradDistributionParetoType2_vv_892;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_893> AgradDistributionParetoType2_vv_893;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_894> AgradDistributionParetoType2_vv_894;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_895> AgradDistributionParetoType2_vv_895;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_896> AgradDistributionParetoType2_vv_896;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_897> AgradDistributionParetoType2_vv_897;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_898> AgradDistributionParetoType2_vv_898;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_899> AgradDistributionParetoType2_vv_899;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_800, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_800);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_801, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_801);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_802, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_802);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_803, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_803);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_804, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_804);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_805, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_805);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_806, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_806);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_807, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_807);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_808, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_808);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_809, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_809);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_810, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_810);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_811, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_811);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_812, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_812);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_813, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_813);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_814, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_814);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_815, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_815);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_816, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_816);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_817, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_817);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_818, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_818);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_819, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_819);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_820, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_820);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_821, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_821);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_822, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_822);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_823, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_823);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_824, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_824);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_825, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_825);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_826, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_826);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_827, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_827);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_828, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_828);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_829, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_829);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_830, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_830);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_831, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_831);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_832, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_832);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_833, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_833);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_834, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_834);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_835, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_835);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_836, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_836);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_837, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_837);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_838, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_838);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_839, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_839);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_840, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_840);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_841, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_841);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_842, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_842);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_843, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_843);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_844, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_844);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_845, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_845);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_846, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_846);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_847, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_847);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_848, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_848);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_849, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_849);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_850, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_850);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_851, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_851);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_852, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_852);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_853, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_853);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_854, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_854);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_855, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_855);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_856, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_856);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_857, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_857);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_858, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_858);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_859, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_859);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_860, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_860);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_861, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_861);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_862, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_862);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_863, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_863);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_864, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_864);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_865, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_865);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_866, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_866);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_867, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_867);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_868, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_868);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_869, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_869);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_870, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_870);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_871, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_871);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_872, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_872);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_873, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_873);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_874, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_874);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_875, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_875);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_876, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_876);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_877, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_877);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_878, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_878);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_879, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_879);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_880, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_880);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_881, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_881);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_882, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_882);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_883, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_883);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_884, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_884);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_885, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_885);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_886, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_886);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_887, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_887);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_888, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_888);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_889, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_889);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_890, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_890);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_891, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_891);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_892, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_892);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_893, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_893);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_894, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_894);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_895, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_895);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_896, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_896);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_897, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_897);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_898, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_898);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_899, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_899);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_test.hpp>
+
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_900;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_901;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_902;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_903;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_904;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_905;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_906;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_907;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_908;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, double, empty, empty> type_ffv_909;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_910;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_911;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_912;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_913;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_914;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_915;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_916;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_917;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_918;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_919;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_920;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_921;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_922;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_923;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_924;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_925;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_926;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, double, empty, empty> type_ffv_927;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty, empty> type_ffv_928;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_929;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty, empty> type_ffv_930;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_931;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_932;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty, empty> type_ffv_933;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_934;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_935;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_936;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_937;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_938;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_939;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_940;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_941;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_942;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_943;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_944;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty, empty> type_ffv_945;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_946;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_947;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_948;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_949;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_950;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_951;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_952;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_953;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_954;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_955;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_956;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_957;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_958;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_959;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_960;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_961;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_962;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty, empty> type_ffv_963;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_ffv_964;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_965;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_966;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_967;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_968;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_ffv_969;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_970;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_971;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_972;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_973;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_974;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_975;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_976;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_977;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_978;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_979;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_980;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_981;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_982;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_983;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_984;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_985;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_986;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_987;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_988;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_989;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_990;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_991;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_992;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_993;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_994;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_995;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_996;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_997;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_998;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, double, empty, empty> type_ffv_999;
+
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_900> AgradDistributionParetoType2_ffv_900;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_901> AgradDistributionParetoType2_ffv_901;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_902> AgradDistributionParetoType2_ffv_902;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_903> AgradDistributionParetoType2_ffv_903;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_904> AgradDistributionParetoType2_ffv_904;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_905> AgradDistributionParetoType2_ffv_905;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_906> AgradDistributionParetoType2_ffv_906;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_907> AgradDistributionParetoType2_ffv_907;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_908> AgradDistributionParetoType2_ffv_908;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_909> AgradDistributionParetoType2_ffv_909;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_910> AgradDistributionParetoType2_ffv_910;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_911> AgradDistributionParetoType2_ffv_911;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_912> AgradDistributionParetoType2_ffv_912;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_913> AgradDistributionParetoType2_ffv_913;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_914> AgradDistributionParetoType2_ffv_914;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_915> AgradDistributionParetoType2_ffv_915;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_916> AgradDistributionParetoType2_ffv_916;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_917> AgradDistributionParetoType2_ffv_917;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_918> AgradDistributionParetoType2_ffv_918;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_919> AgradDistributionParetoType2_ffv_919;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_920> AgradDistributionParetoType2_ffv_920;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_921> AgradDistributionParetoType2_ffv_921;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_922> AgradDistributionParetoType2_ffv_922;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_923> AgradDistributionParetoType2_ffv_923;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_924> AgradDistributionParetoType2_ffv_924;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_925> AgradDistributionParetoType2_ffv_925;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_926> AgradDistributionParetoType2_ffv_926;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_927> AgradDistributionParetoType2_ffv_927;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_928> AgradDistributionParetoType2_ffv_928;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_929> AgradDistributionParetoType2_ffv_929;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_930> AgradDistributionParetoType2_ffv_930;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_931> AgradDistributionParetoType2_ffv_931;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_932> AgradDistributionParetoType2_ffv_932;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_933> AgradDistributionParetoType2_ffv_933;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_934> AgradDistributionParetoType2_ffv_934;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_935> AgradDistributionParetoType2_ffv_935;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_936> AgradDistributionParetoType2_ffv_936;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_937> AgradDistributionParetoType2_ffv_937;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_938> AgradDistributionParetoType2_ffv_938;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_939> AgradDistributionParetoType2_ffv_939;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_940> AgradDistributionParetoType2_ffv_940;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_941> AgradDistributionParetoType2_ffv_941;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_942> AgradDistributionParetoType2_ffv_942;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_943> AgradDistributionParetoType2_ffv_943;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_944> AgradDistributionParetoType2_ffv_944;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_945> AgradDistributionParetoType2_ffv_945;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_946> AgradDistributionParetoType2_ffv_946;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_947> AgradDistributionParetoType2_ffv_947;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_948> AgradDistributionParetoType2_ffv_948;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_949> AgradDistributionParetoType2_ffv_949;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_950> AgradDistributionParetoType2_ffv_950;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_951> AgradDistributionParetoType2_ffv_951;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_952> AgradDistributionParetoType2_ffv_952;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_953> AgradDistributionParetoType2_ffv_953;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_954> AgradDistributionParetoType2_ffv_954;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_955> AgradDistributionParetoType2_ffv_955;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_956> AgradDistributionParetoType2_ffv_956;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_957> AgradDistributionParetoType2_ffv_957;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_958> AgradDistributionParetoType2_ffv_958;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_959> AgradDistributionParetoType2_ffv_959;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_960> AgradDistributionParetoType2_ffv_960;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_961> AgradDistributionParetoType2_ffv_961;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_962> AgradDistributionParetoType2_ffv_962;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_963> AgradDistributionParetoType2_ffv_963;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_964> AgradDistributionParetoType2_ffv_964;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_965> AgradDistributionParetoType2_ffv_965;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_966> AgradDistributionParetoType2_ffv_966;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_967> AgradDistributionParetoType2_ffv_967;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_968> AgradDistributionParetoType2_ffv_968;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_969> AgradDistributionParetoType2_ffv_969;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_970> AgradDistributionParetoType2_ffv_970;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_971> AgradDistributionParetoType2_ffv_971;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_972> AgradDistributionParetoType2_ffv_972;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_973> AgradDistributionParetoType2_ffv_973;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_974> AgradDistributionParetoType2_ffv_974;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_975> AgradDistributionParetoType2_ffv_975;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_976> AgradDistributionParetoType2_ffv_976;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_977> AgradDistributionParetoType2_ffv_977;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_978> AgradDistributionParetoType2_ffv_978;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_979> AgradDistributionParetoType2_ffv_979;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_980> AgradDistributionParetoType2_ffv_980;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_981> AgradDistributionParetoType2_ffv_981;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_982> AgradDistributionParetoType2_ffv_982;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_983> AgradDistributionParetoType2_ffv_983;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_984> AgradDistributionParetoType2_ffv_984;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_985> AgradDistributionParetoType2_ffv_985;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_986> AgradDistributionParetoType2_ffv_986;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_987> AgradDistributionParetoType2_ffv_987;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_988> AgradDistributionParetoType2_ffv_988;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_989> AgradDistributionParetoType2_ffv_989;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_990> AgradDistributionParetoType2_ffv_990;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_991> AgradDistributionParetoType2_ffv_991;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_992> AgradDistributionParetoType2_ffv_992;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_993> AgradDistributionParetoType2_ffv_993;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_994> AgradDistributionParetoType2_ffv_994;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_995> AgradDistributionParetoType2_ffv_995;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_996> AgradDistributionParetoType2_ffv_996;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_997> AgradDistributionParetoType2_ffv_997;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_998> AgradDistributionParetoType2_ffv_998;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_999> AgradDistributionParetoType2_ffv_999;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_900, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_900);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_901, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_901);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_902, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_902);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_903, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_903);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_904, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_904);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_905, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_905);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_906, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_906);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_907, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_907);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_908, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_908);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_909, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_909);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_910, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_910);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_911, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_911);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_912, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_912);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_913, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_913);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_914, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_914);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_915, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_915);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_916, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_916);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_917, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_917);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_918, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_918);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_919, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_919);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_920, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_920);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_921, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_921);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_922, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_922);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_923, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_923);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_924, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_924);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_925, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_925);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_926, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_926);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_927, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_927);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_928, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_928);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_929, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_929);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_930, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_930);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_931, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_931);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_932, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_932);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_933, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_933);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_934, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_934);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_935, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_935);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_936, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_936);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_937, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_937);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_938, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_938);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_939, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_939);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_940, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_940);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_941, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_941);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_942, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_942);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_943, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_943);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_944, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_944);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_945, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_945);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_946, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_946);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_947, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_947);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_948, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_948);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_949, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_949);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_950, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_950);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_951, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_951);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_952, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_952);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_953, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_953);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_954, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_954);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_955, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_955);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_956, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_956);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_957, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_957);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_958, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_958);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_959, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_959);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_960, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_960);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_961, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_961);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_962, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_962);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_963, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_963);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_964, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_964);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_965, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_965);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_966, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_966);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_967, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_967);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_968, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_968);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_969, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_969);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_970, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_970);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_971, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_971);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_972, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_972);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_973, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_973);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_974, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_974);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_975, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_975);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_976, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_976);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_977, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_977);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_978, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_978);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_979, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_979);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_980, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_980);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_981, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_981);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_982, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_982);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_983, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_983);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_984, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_984);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_985, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_985);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_986, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_986);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_987, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_987);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_988, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_988);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_989, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_989);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_990, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_990);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_991, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_991);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_992, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_992);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_993, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_993);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_994, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_994);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_995, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_995);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_996, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_996);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_997, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_997);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_998, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_998);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_999, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_999);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_test.hpp>
+
+typedef std::tuple<std::vector<var>, std::vector<double>, double, double, empty, empty> type_v_900;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, std::vector<double>, empty, empty> type_v_901;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_902;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, var, empty, empty> type_v_903;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, std::vector<var>, empty, empty> type_v_904;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_905;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, double, empty, empty> type_v_906;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, std::vector<double>, empty, empty> type_v_907;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_908;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, var, empty, empty> type_v_909;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_v_910;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_911;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_912;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_913;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_914;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_915;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_916;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_917;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, double, empty, empty> type_v_918;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, std::vector<double>, empty, empty> type_v_919;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_920;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, var, empty, empty> type_v_921;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, std::vector<var>, empty, empty> type_v_922;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_923;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, double, empty, empty> type_v_924;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_v_925;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_926;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, var, empty, empty> type_v_927;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_v_928;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_929;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_930;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_931;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_932;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_933;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_934;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_935;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_936;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_937;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_938;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_939;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_940;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_941;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_942;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_943;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_944;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_945;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_946;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_947;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_948;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_949;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_950;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_951;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_952;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_953;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_954;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_955;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_956;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_957;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_958;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_959;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_960;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_961;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_962;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_963;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_964;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_965;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_966;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_967;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_968;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_969;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_970;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_971;
+typedef std::tuple<std::vector<var>, var, double, double, empty, empty> type_v_972;
+typedef std::tuple<std::vector<var>, var, double, std::vector<double>, empty, empty> type_v_973;
+typedef std::tuple<std::vector<var>, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_974;
+typedef std::tuple<std::vector<var>, var, double, var, empty, empty> type_v_975;
+typedef std::tuple<std::vector<var>, var, double, std::vector<var>, empty, empty> type_v_976;
+typedef std::tuple<std::vector<var>, var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_977;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, double, empty, empty> type_v_978;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, std::vector<double>, empty, empty> type_v_979;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_980;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, var, empty, empty> type_v_981;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, std::vector<var>, empty, empty> type_v_982;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_983;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_984;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_985;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_986;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_987;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_988;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_989;
+typedef std::tuple<std::vector<var>, var, var, double, empty, empty> type_v_990;
+typedef std::tuple<std::vector<var>, var, var, std::vector<double>, empty, empty> type_v_991;
+typedef std::tuple<std::vector<var>, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_992;
+typedef std::tuple<std::vector<var>, var, var, var, empty, empty> type_v_993;
+typedef std::tuple<std::vector<var>, var, var, std::vector<var>, empty, empty> type_v_994;
+typedef std::tuple<std::vector<var>, var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_995;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, double, empty, empty> type_v_996;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, std::vector<double>, empty, empty> type_v_997;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_998;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, var, empty, empty> type_v_999;
+
+typedef std::tuple<AgradDistributionParetoType2, type_v_900> AgradDistributionParetoType2_v_900;
+typedef std::tuple<AgradDistributionParetoType2, type_v_901> AgradDistributionParetoType2_v_901;
+typedef std::tuple<AgradDistributionParetoType2, type_v_902> AgradDistributionParetoType2_v_902;
+typedef std::tuple<AgradDistributionParetoType2, type_v_903> AgradDistributionParetoType2_v_903;
+typedef std::tuple<AgradDistributionParetoType2, type_v_904> AgradDistributionParetoType2_v_904;
+typedef std::tuple<AgradDistributionParetoType2, type_v_905> AgradDistributionParetoType2_v_905;
+typedef std::tuple<AgradDistributionParetoType2, type_v_906> AgradDistributionParetoType2_v_906;
+typedef std::tuple<AgradDistributionParetoType2, type_v_907> AgradDistributionParetoType2_v_907;
+typedef std::tuple<AgradDistributionParetoType2, type_v_908> AgradDistributionParetoType2_v_908;
+typedef std::tuple<AgradDistributionParetoType2, type_v_909> AgradDistributionParetoType2_v_909;
+typedef std::tuple<AgradDistributionParetoType2, type_v_910> AgradDistributionParetoType2_v_910;
+typedef std::tuple<AgradDistributionParetoType2, type_v_911> AgradDistributionParetoType2_v_911;
+typedef std::tuple<AgradDistributionParetoType2, type_v_912> AgradDistributionParetoType2_v_912;
+typedef std::tuple<AgradDistributionParetoType2, type_v_913> AgradDistributionParetoType2_v_913;
+typedef std::tuple<AgradDistributionParetoType2, type_v_914> AgradDistributionParetoType2_v_914;
+typedef std::tuple<AgradDistributionParetoType2, type_v_915> AgradDistributionParetoType2_v_915;
+typedef std::tuple<AgradDistributionParetoType2, type_v_916> AgradDistributionParetoType2_v_916;
+typedef std::tuple<AgradDistributionParetoType2, type_v_917> AgradDistributionParetoType2_v_917;
+typedef std::tuple<AgradDistributionParetoType2, type_v_918> AgradDistributionParetoType2_v_918;
+typedef std::tuple<AgradDistributionParetoType2, type_v_919> AgradDistributionParetoType2_v_919;
+typedef std::tuple<AgradDistributionParetoType2, type_v_920> AgradDistributionParetoType2_v_920;
+typedef std::tuple<AgradDistributionParetoType2, type_v_921> AgradDistributionParetoType2_v_921;
+typedef std::tuple<AgradDistributionParetoType2, type_v_922> AgradDistributionParetoType2_v_922;
+typedef std::tuple<AgradDistributionParetoType2, type_v_923> AgradDistributionParetoType2_v_923;
+typedef std::tuple<AgradDistributionParetoType2, type_v_924> AgradDistributionParetoType2_v_924;
+typedef std::tuple<AgradDistributionParetoType2, type_v_925> AgradDistributionParetoType2_v_925;
+typedef std::tuple<AgradDistributionParetoType2, type_v_926> AgradDistributionParetoType2_v_926;
+typedef std::tuple<AgradDistributionParetoType2, type_v_927> AgradDistributionParetoType2_v_927;
+typedef std::tuple<AgradDistributionParetoType2, type_v_928> AgradDistributionParetoType2_v_928;
+typedef std::tuple<AgradDistributionParetoType2, type_v_929> AgradDistributionParetoType2_v_929;
+typedef std::tuple<AgradDistributionParetoType2, type_v_930> AgradDistributionParetoType2_v_930;
+typedef std::tuple<AgradDistributionParetoType2, type_v_931> AgradDistributionParetoType2_v_931;
+typedef std::tuple<AgradDistributionParetoType2, type_v_932> AgradDistributionParetoType2_v_932;
+typedef std::tuple<AgradDistributionParetoType2, type_v_933> AgradDistributionParetoType2_v_933;
+typedef std::tuple<AgradDistributionParetoType2, type_v_934> AgradDistributionParetoType2_v_934;
+typedef std::tuple<AgradDistributionParetoType2, type_v_935> AgradDistributionParetoType2_v_935;
+typedef std::tuple<AgradDistributionParetoType2, type_v_936> AgradDistributionParetoType2_v_936;
+typedef std::tuple<AgradDistributionParetoType2, type_v_937> AgradDistributionParetoType2_v_937;
+typedef std::tuple<AgradDistributionParetoType2, type_v_938> AgradDistributionParetoType2_v_938;
+typedef std::tuple<AgradDistributionParetoType2, type_v_939> AgradDistributionParetoType2_v_939;
+typedef std::tuple<AgradDistributionParetoType2, type_v_940> AgradDistributionParetoType2_v_940;
+typedef std::tuple<AgradDistributionParetoType2, type_v_941> AgradDistributionParetoType2_v_941;
+typedef std::tuple<AgradDistributionParetoType2, type_v_942> AgradDistributionParetoType2_v_942;
+typedef std::tuple<AgradDistributionParetoType2, type_v_943> AgradDistributionParetoType2_v_943;
+typedef std::tuple<AgradDistributionParetoType2, type_v_944> AgradDistributionParetoType2_v_944;
+typedef std::tuple<AgradDistributionParetoType2, type_v_945> AgradDistributionParetoType2_v_945;
+typedef std::tuple<AgradDistributionParetoType2, type_v_946> AgradDistributionParetoType2_v_946;
+typedef std::tuple<AgradDistributionParetoType2, type_v_947> AgradDistributionParetoType2_v_947;
+typedef std::tuple<AgradDistributionParetoType2, type_v_948> AgradDistributionParetoType2_v_948;
+typedef std::tuple<AgradDistributionParetoType2, type_v_949> AgradDistributionParetoType2_v_949;
+typedef std::tuple<AgradDistributionParetoType2, type_v_950> AgradDistributionParetoType2_v_950;
+typedef std::tuple<AgradDistributionParetoType2, type_v_951> AgradDistributionParetoType2_v_951;
+typedef std::tuple<AgradDistributionParetoType2, type_v_952> AgradDistributionParetoType2_v_952;
+typedef std::tuple<AgradDistributionParetoType2, type_v_953> AgradDistributionParetoType2_v_953;
+typedef std::tuple<AgradDistributionParetoType2, type_v_954> AgradDistributionParetoType2_v_954;
+typedef std::tuple<AgradDistributionParetoType2, type_v_955> AgradDistributionParetoType2_v_955;
+typedef std::tuple<AgradDistributionParetoType2, type_v_956> AgradDistributionParetoType2_v_956;
+typedef std::tuple<AgradDistributionParetoType2, type_v_957> AgradDistributionParetoType2_v_957;
+typedef std::tuple<AgradDistributionParetoType2, type_v_958> AgradDistributionParetoType2_v_958;
+typedef std::tuple<AgradDistributionParetoType2, type_v_959> AgradDistributionParetoType2_v_959;
+typedef std::tuple<AgradDistributionParetoType2, type_v_960> AgradDistributionParetoType2_v_960;
+typedef std::tuple<AgradDistributionParetoType2, type_v_961> AgradDistributionParetoType2_v_961;
+typedef std::tuple<AgradDistributionParetoType2, type_v_962> AgradDistributionParetoType2_v_962;
+typedef std::tuple<AgradDistributionParetoType2, type_v_963> AgradDistributionParetoType2_v_963;
+typedef std::tuple<AgradDistributionParetoType2, type_v_964> AgradDistributionParetoType2_v_964;
+typedef std::tuple<AgradDistributionParetoType2, type_v_965> AgradDistributionParetoType2_v_965;
+typedef std::tuple<AgradDistributionParetoType2, type_v_966> AgradDistributionParetoType2_v_966;
+typedef std::tuple<AgradDistributionParetoType2, type_v_967> AgradDistributionParetoType2_v_967;
+typedef std::tuple<AgradDistributionParetoType2, type_v_968> AgradDistributionParetoType2_v_968;
+typedef std::tuple<AgradDistributionParetoType2, type_v_969> AgradDistributionParetoType2_v_969;
+typedef std::tuple<AgradDistributionParetoType2, type_v_970> AgradDistributionParetoType2_v_970;
+typedef std::tuple<AgradDistributionParetoType2, type_v_971> AgradDistributionParetoType2_v_971;
+typedef std::tuple<AgradDistributionParetoType2, type_v_972> AgradDistributionParetoType2_v_972;
+typedef std::tuple<AgradDistributionParetoType2, type_v_973> AgradDistributionParetoType2_v_973;
+typedef std::tuple<AgradDistributionParetoType2, type_v_974> AgradDistributionParetoType2_v_974;
+typedef std::tuple<AgradDistributionParetoType2, type_v_975> AgradDistributionParetoType2_v_975;
+typedef std::tuple<AgradDistributionParetoType2, type_v_976> AgradDistributionParetoType2_v_976;
+typedef std::tuple<AgradDistributionParetoType2, type_v_977> AgradDistributionParetoType2_v_977;
+typedef std::tuple<AgradDistributionParetoType2, type_v_978> AgradDistributionParetoType2_v_978;
+typedef std::tuple<AgradDistributionParetoType2, type_v_979> AgradDistributionParetoType2_v_979;
+typedef std::tuple<AgradDistributionParetoType2, type_v_980> AgradDistributionParetoType2_v_980;
+typedef std::tuple<AgradDistributionParetoType2, type_v_981> AgradDistributionParetoType2_v_981;
+typedef std::tuple<AgradDistributionParetoType2, type_v_982> AgradDistributionParetoType2_v_982;
+typedef std::tuple<AgradDistributionParetoType2, type_v_983> AgradDistributionParetoType2_v_983;
+typedef std::tuple<AgradDistributionParetoType2, type_v_984> AgradDistributionParetoType2_v_984;
+typedef std::tuple<AgradDistributionParetoType2, type_v_985> AgradDistributionParetoType2_v_985;
+typedef std::tuple<AgradDistributionParetoType2, type_v_986> AgradDistributionParetoType2_v_986;
+typedef std::tuple<AgradDistributionParetoType2, type_v_987> AgradDistributionParetoType2_v_987;
+typedef std::tuple<AgradDistributionParetoType2, type_v_988> AgradDistributionParetoType2_v_988;
+typedef std::tuple<AgradDistributionParetoType2, type_v_989> AgradDistributionParetoType2_v_989;
+typedef std::tuple<AgradDistributionParetoType2, type_v_990> AgradDistributionParetoType2_v_990;
+typedef std::tuple<AgradDistributionParetoType2, type_v_991> AgradDistributionParetoType2_v_991;
+typedef std::tuple<AgradDistributionParetoType2, type_v_992> AgradDistributionParetoType2_v_992;
+typedef std::tuple<AgradDistributionParetoType2, type_v_993> AgradDistributionParetoType2_v_993;
+typedef std::tuple<AgradDistributionParetoType2, type_v_994> AgradDistributionParetoType2_v_994;
+typedef std::tuple<AgradDistributionParetoType2, type_v_995> AgradDistributionParetoType2_v_995;
+typedef std::tuple<AgradDistributionParetoType2, type_v_996> AgradDistributionParetoType2_v_996;
+typedef std::tuple<AgradDistributionParetoType2, type_v_997> AgradDistributionParetoType2_v_997;
+typedef std::tuple<AgradDistributionParetoType2, type_v_998> AgradDistributionParetoType2_v_998;
+typedef std::tuple<AgradDistributionParetoType2, type_v_999> AgradDistributionParetoType2_v_999;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_900, AgradDistributionTestFixture, AgradDistributionParetoType2_v_900);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_901, AgradDistributionTestFixture, AgradDistributionParetoType2_v_901);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_902, AgradDistributionTestFixture, AgradDistributionParetoType2_v_902);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_903, AgradDistributionTestFixture, AgradDistributionParetoType2_v_903);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_904, AgradDistributionTestFixture, AgradDistributionParetoType2_v_904);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_905, AgradDistributionTestFixture, AgradDistributionParetoType2_v_905);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_906, AgradDistributionTestFixture, AgradDistributionParetoType2_v_906);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_907, AgradDistributionTestFixture, AgradDistributionParetoType2_v_907);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_908, AgradDistributionTestFixture, AgradDistributionParetoType2_v_908);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_909, AgradDistributionTestFixture, AgradDistributionParetoType2_v_909);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_910, AgradDistributionTestFixture, AgradDistributionParetoType2_v_910);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_911, AgradDistributionTestFixture, AgradDistributionParetoType2_v_911);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_912, AgradDistributionTestFixture, AgradDistributionParetoType2_v_912);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_913, AgradDistributionTestFixture, AgradDistributionParetoType2_v_913);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_914, AgradDistributionTestFixture, AgradDistributionParetoType2_v_914);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_915, AgradDistributionTestFixture, AgradDistributionParetoType2_v_915);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_916, AgradDistributionTestFixture, AgradDistributionParetoType2_v_916);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_917, AgradDistributionTestFixture, AgradDistributionParetoType2_v_917);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_918, AgradDistributionTestFixture, AgradDistributionParetoType2_v_918);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_919, AgradDistributionTestFixture, AgradDistributionParetoType2_v_919);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_920, AgradDistributionTestFixture, AgradDistributionParetoType2_v_920);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_921, AgradDistributionTestFixture, AgradDistributionParetoType2_v_921);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_922, AgradDistributionTestFixture, AgradDistributionParetoType2_v_922);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_923, AgradDistributionTestFixture, AgradDistributionParetoType2_v_923);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_924, AgradDistributionTestFixture, AgradDistributionParetoType2_v_924);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_925, AgradDistributionTestFixture, AgradDistributionParetoType2_v_925);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_926, AgradDistributionTestFixture, AgradDistributionParetoType2_v_926);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_927, AgradDistributionTestFixture, AgradDistributionParetoType2_v_927);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_928, AgradDistributionTestFixture, AgradDistributionParetoType2_v_928);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_929, AgradDistributionTestFixture, AgradDistributionParetoType2_v_929);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_930, AgradDistributionTestFixture, AgradDistributionParetoType2_v_930);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_931, AgradDistributionTestFixture, AgradDistributionParetoType2_v_931);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_932, AgradDistributionTestFixture, AgradDistributionParetoType2_v_932);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_933, AgradDistributionTestFixture, AgradDistributionParetoType2_v_933);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_934, AgradDistributionTestFixture, AgradDistributionParetoType2_v_934);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_935, AgradDistributionTestFixture, AgradDistributionParetoType2_v_935);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_936, AgradDistributionTestFixture, AgradDistributionParetoType2_v_936);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_937, AgradDistributionTestFixture, AgradDistributionParetoType2_v_937);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_938, AgradDistributionTestFixture, AgradDistributionParetoType2_v_938);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_939, AgradDistributionTestFixture, AgradDistributionParetoType2_v_939);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_940, AgradDistributionTestFixture, AgradDistributionParetoType2_v_940);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_941, AgradDistributionTestFixture, AgradDistributionParetoType2_v_941);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_942, AgradDistributionTestFixture, AgradDistributionParetoType2_v_942);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_943, AgradDistributionTestFixture, AgradDistributionParetoType2_v_943);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_944, AgradDistributionTestFixture, AgradDistributionParetoType2_v_944);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_945, AgradDistributionTestFixture, AgradDistributionParetoType2_v_945);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_946, AgradDistributionTestFixture, AgradDistributionParetoType2_v_946);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_947, AgradDistributionTestFixture, AgradDistributionParetoType2_v_947);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_948, AgradDistributionTestFixture, AgradDistributionParetoType2_v_948);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_949, AgradDistributionTestFixture, AgradDistributionParetoType2_v_949);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_950, AgradDistributionTestFixture, AgradDistributionParetoType2_v_950);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_951, AgradDistributionTestFixture, AgradDistributionParetoType2_v_951);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_952, AgradDistributionTestFixture, AgradDistributionParetoType2_v_952);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_953, AgradDistributionTestFixture, AgradDistributionParetoType2_v_953);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_954, AgradDistributionTestFixture, AgradDistributionParetoType2_v_954);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_955, AgradDistributionTestFixture, AgradDistributionParetoType2_v_955);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_956, AgradDistributionTestFixture, AgradDistributionParetoType2_v_956);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_957, AgradDistributionTestFixture, AgradDistributionParetoType2_v_957);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_958, AgradDistributionTestFixture, AgradDistributionParetoType2_v_958);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_959, AgradDistributionTestFixture, AgradDistributionParetoType2_v_959);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_960, AgradDistributionTestFixture, AgradDistributionParetoType2_v_960);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_961, AgradDistributionTestFixture, AgradDistributionParetoType2_v_961);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_962, AgradDistributionTestFixture, AgradDistributionParetoType2_v_962);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_963, AgradDistributionTestFixture, AgradDistributionParetoType2_v_963);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_964, AgradDistributionTestFixture, AgradDistributionParetoType2_v_964);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_965, AgradDistributionTestFixture, AgradDistributionParetoType2_v_965);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_966, AgradDistributionTestFixture, AgradDistributionParetoType2_v_966);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_967, AgradDistributionTestFixture, AgradDistributionParetoType2_v_967);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_968, AgradDistributionTestFixture, AgradDistributionParetoType2_v_968);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_969, AgradDistributionTestFixture, AgradDistributionParetoType2_v_969);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_970, AgradDistributionTestFixture, AgradDistributionParetoType2_v_970);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_971, AgradDistributionTestFixture, AgradDistributionParetoType2_v_971);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_972, AgradDistributionTestFixture, AgradDistributionParetoType2_v_972);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_973, AgradDistributionTestFixture, AgradDistributionParetoType2_v_973);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_974, AgradDistributionTestFixture, AgradDistributionParetoType2_v_974);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_975, AgradDistributionTestFixture, AgradDistributionParetoType2_v_975);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_976, AgradDistributionTestFixture, AgradDistributionParetoType2_v_976);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_977, AgradDistributionTestFixture, AgradDistributionParetoType2_v_977);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_978, AgradDistributionTestFixture, AgradDistributionParetoType2_v_978);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_979, AgradDistributionTestFixture, AgradDistributionParetoType2_v_979);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_980, AgradDistributionTestFixture, AgradDistributionParetoType2_v_980);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_981, AgradDistributionTestFixture, AgradDistributionParetoType2_v_981);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_982, AgradDistributionTestFixture, AgradDistributionParetoType2_v_982);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_983, AgradDistributionTestFixture, AgradDistributionParetoType2_v_983);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_984, AgradDistributionTestFixture, AgradDistributionParetoType2_v_984);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_985, AgradDistributionTestFixture, AgradDistributionParetoType2_v_985);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_986, AgradDistributionTestFixture, AgradDistributionParetoType2_v_986);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_987, AgradDistributionTestFixture, AgradDistributionParetoType2_v_987);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_988, AgradDistributionTestFixture, AgradDistributionParetoType2_v_988);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_989, AgradDistributionTestFixture, AgradDistributionParetoType2_v_989);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_990, AgradDistributionTestFixture, AgradDistributionParetoType2_v_990);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_991, AgradDistributionTestFixture, AgradDistributionParetoType2_v_991);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_992, AgradDistributionTestFixture, AgradDistributionParetoType2_v_992);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_993, AgradDistributionTestFixture, AgradDistributionParetoType2_v_993);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_994, AgradDistributionTestFixture, AgradDistributionParetoType2_v_994);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_995, AgradDistributionTestFixture, AgradDistributionParetoType2_v_995);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_996, AgradDistributionTestFixture, AgradDistributionParetoType2_v_996);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_997, AgradDistributionTestFixture, AgradDistributionParetoType2_v_997);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_998, AgradDistributionTestFixture, AgradDistributionParetoType2_v_998);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_v_999, AgradDistributionTestFixture, AgradDistributionParetoType2_v_999);
+
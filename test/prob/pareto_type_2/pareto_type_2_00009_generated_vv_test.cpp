@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_test.hpp>
+
+typedef std::tuple<std::vector<var>, var, std::vector<double>, var, empty, empty> type_vv_900;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, std::vector<var>, empty, empty> type_vv_901;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_902;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_903;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_904;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_905;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_906;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_907;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_908;
+typedef std::tuple<std::vector<var>, var, var, double, empty, empty> type_vv_909;
+typedef std::tuple<std::vector<var>, var, var, std::vector<double>, empty, empty> type_vv_910;
+typedef std::tuple<std::vector<var>, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_911;
+typedef std::tuple<std::vector<var>, var, var, var, empty, empty> type_vv_912;
+typedef std::tuple<std::vector<var>, var, var, std::vector<var>, empty, empty> type_vv_913;
+typedef std::tuple<std::vector<var>, var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_914;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, double, empty, empty> type_vv_915;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, std::vector<double>, empty, empty> type_vv_916;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_917;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, var, empty, empty> type_vv_918;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, std::vector<var>, empty, empty> type_vv_919;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_920;
+typedef std::tuple<std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_921;
+typedef std::tuple<std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_922;
+typedef std::tuple<std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_923;
+typedef std::tuple<std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_924;
+typedef std::tuple<std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_925;
+typedef std::tuple<std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_926;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, double, empty, empty> type_vv_927;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, std::vector<double>, empty, empty> type_vv_928;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_929;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, var, empty, empty> type_vv_930;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, std::vector<var>, empty, empty> type_vv_931;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_932;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, double, empty, empty> type_vv_933;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_vv_934;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_935;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, var, empty, empty> type_vv_936;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_vv_937;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_938;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_939;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_940;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_941;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_942;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_943;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_944;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, double, empty, empty> type_vv_945;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, std::vector<double>, empty, empty> type_vv_946;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_947;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, var, empty, empty> type_vv_948;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, std::vector<var>, empty, empty> type_vv_949;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_950;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, double, empty, empty> type_vv_951;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_vv_952;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_953;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, var, empty, empty> type_vv_954;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_vv_955;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_956;
+typedef std::tuple<std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_957;
+typedef std::tuple<std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_958;
+typedef std::tuple<std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_959;
+typedef std::tuple<std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_960;
+typedef std::tuple<std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_961;
+typedef std::tuple<std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_962;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, empty, empty> type_vv_963;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, empty, empty> type_vv_964;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_965;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, empty, empty> type_vv_966;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, empty, empty> type_vv_967;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_968;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, empty, empty> type_vv_969;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, empty, empty> type_vv_970;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_971;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, empty, empty> type_vv_972;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, empty, empty> type_vv_973;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_974;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_975;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_976;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_977;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_978;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_979;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_980;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, empty, empty> type_vv_981;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, empty, empty> type_vv_982;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_983;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, empty, empty> type_vv_984;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, empty, empty> type_vv_985;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_986;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, empty, empty> type_vv_987;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, empty, empty> type_vv_988;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_989;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, empty, empty> type_vv_990;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, empty, empty> type_vv_991;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_992;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_993;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_994;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_995;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_996;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_997;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_998;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, double, empty, empty> type_vv_999;
+
+typedef std::tuple<AgradDistributionParetoType2, type_vv_900> AgradDistributionParetoType2_vv_900;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_901> AgradDistributionParetoType2_vv_901;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_902> AgradDistributionParetoType2_vv_902;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_903> AgradDistributionParetoType2_vv_903;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_904> AgradDistributionParetoType2_vv_904;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_905> AgradDistributionParetoType2_vv_905;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_906> AgradDistributionParetoType2_vv_906;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_907> AgradDistributionParetoType2_vv_907;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_908> AgradDistributionParetoType2_vv_908;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_909> AgradDistributionParetoType2_vv_909;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_910> AgradDistributionParetoType2_vv_910;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_911> AgradDistributionParetoType2_vv_911;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_912> AgradDistributionParetoType2_vv_912;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_913> AgradDistributionParetoType2_vv_913;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_914> AgradDistributionParetoType2_vv_914;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_915> AgradDistributionParetoType2_vv_915;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_916> AgradDistributionParetoType2_vv_916;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_917> AgradDistributionParetoType2_vv_917;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_918> AgradDistributionParetoType2_vv_918;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_919> AgradDistributionParetoType2_vv_919;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_920> AgradDistributionParetoType2_vv_920;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_921> AgradDistributionParetoType2_vv_921;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_922> AgradDistributionParetoType2_vv_922;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_923> AgradDistributionParetoType2_vv_923;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_924> AgradDistributionParetoType2_vv_924;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_925> AgradDistributionParetoType2_vv_925;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_926> AgradDistributionParetoType2_vv_926;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_927> AgradDistributionParetoType2_vv_927;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_928> AgradDistributionParetoType2_vv_928;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_929> AgradDistributionParetoType2_vv_929;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_930> AgradDistributionParetoType2_vv_930;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_931> AgradDistributionParetoType2_vv_931;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_932> AgradDistributionParetoType2_vv_932;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_933> AgradDistributionParetoType2_vv_933;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_934> AgradDistributionParetoType2_vv_934;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_935> AgradDistributionParetoType2_vv_935;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_936> AgradDistributionParetoType2_vv_936;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_937> AgradDistributionParetoType2_vv_937;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_938> AgradDistributionParetoType2_vv_938;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_939> AgradDistributionParetoType2_vv_939;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_940> AgradDistributionParetoType2_vv_940;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_941> AgradDistributionParetoType2_vv_941;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_942> AgradDistributionParetoType2_vv_942;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_943> AgradDistributionParetoType2_vv_943;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_944> AgradDistributionParetoType2_vv_944;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_945> AgradDistributionParetoType2_vv_945;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_946> AgradDistributionParetoType2_vv_946;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_947> AgradDistributionParetoType2_vv_947;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_948> AgradDistributionParetoType2_vv_948;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_949> AgradDistributionParetoType2_vv_949;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_950> AgradDistributionParetoType2_vv_950;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_951> AgradDistributionParetoType2_vv_951;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_952> AgradDistributionParetoType2_vv_952;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_953> AgradDistributionParetoType2_vv_953;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_954> AgradDistributionParetoType2_vv_954;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_955> AgradDistributionParetoType2_vv_955;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_956> AgradDistributionParetoType2_vv_956;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_957> AgradDistributionParetoType2_vv_957;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_958> AgradDistributionParetoType2_vv_958;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_959> AgradDistributionParetoType2_vv_959;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_960> AgradDistributionParetoType2_vv_960;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_961> AgradDistributionParetoType2_vv_961;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_962> AgradDistributionParetoType2_vv_962;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_963> AgradDistributionParetoType2_vv_963;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_964> AgradDistributionParetoType2_vv_964;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_965> AgradDistributionParetoType2_vv_965;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_966> AgradDistributionParetoType2_vv_966;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_967> AgradDistributionParetoType2_vv_967;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_968> AgradDistributionParetoType2_vv_968;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_969> AgradDistributionParetoType2_vv_969;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_970> AgradDistributionParetoType2_vv_970;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_971> AgradDistributionParetoType2_vv_971;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_972> AgradDistributionParetoType2_vv_972;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_973> AgradDistributionParetoType2_vv_973;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_974> AgradDistributionParetoType2_vv_974;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_975> AgradDistributionParetoType2_vv_975;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_976> AgradDistributionParetoType2_vv_976;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_977> AgradDistributionParetoType2_vv_977;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_978> AgradDistributionParetoType2_vv_978;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_979> AgradDistributionParetoType2_vv_979;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_980> AgradDistributionParetoType2_vv_980;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_981> AgradDistributionParetoType2_vv_981;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_982> AgradDistributionParetoType2_vv_982;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_983> AgradDistributionParetoType2_vv_983;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_984> AgradDistributionParetoType2_vv_984;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_985> AgradDistributionParetoType2_vv_985;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_986> AgradDistributionParetoType2_vv_986;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_987> AgradDistributionParetoType2_vv_987;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_988> AgradDistributionParetoType2_vv_988;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_989> AgradDistributionParetoType2_vv_989;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_990> AgradDistributionParetoType2_vv_990;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_991> AgradDistributionParetoType2_vv_991;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_992> AgradDistributionParetoType2_vv_992;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_993> AgradDistributionParetoType2_vv_993;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_994> AgradDistributionParetoType2_vv_994;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_995> AgradDistributionParetoType2_vv_995;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_996> AgradDistributionParetoType2_vv_996;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_997> AgradDistributionParetoType2_vv_997;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_998> AgradDistributionParetoType2_vv_998;
+typedef std::tuple<AgradDistributionParetoType2, type_vv_999> AgradDistributionParetoType2_vv_999;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_900, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_900);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_901, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_901);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_902, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_902);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_903, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_903);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_904, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_904);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_905, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_905);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_906, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_906);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_907, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_907);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_908, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_908);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_909, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_909);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_910, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_910);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_911, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_911);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_912, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_912);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_913, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_913);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_914, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_914);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_915, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_915);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_916, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_916);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_917, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_917);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_918, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_918);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_919, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_919);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_920, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_920);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_921, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_921);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_922, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_922);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_923, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_923);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_924, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_924);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_925, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_925);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_926, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_926);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_927, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_927);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_928, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_928);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_929, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_929);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_930, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_930);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_931, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_931);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_932, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_932);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_933, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_933);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_934, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_934);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_935, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_935);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_936, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_936);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_937, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_937);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_938, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_938);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_939, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_939);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_940, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_940);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_941, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_941);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_942, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_942);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_943, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_943);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_944, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_944);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_945, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_945);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_946, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_946);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_947, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_947);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_948, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_948);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_949, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_949);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_950, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_950);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_951, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_951);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_952, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_952);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_953, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_953);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_954, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_954);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_955, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_955);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_956, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_956);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_957, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_957);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_958, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_958);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_959, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_959);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_960, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_960);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_961, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_961);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_962, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_962);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_963, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_963);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_964, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_964);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_965, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_965);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_966, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_966);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_967, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_967);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_968, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_968);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_969, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_969);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_970, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_970);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_971, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_971);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_972, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_972);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_973, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_973);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_974, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_974);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_975, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_975);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_976, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_976);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_977, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_977);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_978, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_978);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_979, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_979);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_980, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_980);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_981, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_981);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_982, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_982);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_983, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_983);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_984, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_984);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_985, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_985);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_986, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_986);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_987, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_987);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_988, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_988);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_989, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_989);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_990, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_990);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_991, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_991);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_992, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_992);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_993, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_993);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_994, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_994);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_995, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_995);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_996, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_996);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_997, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_997);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_998, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_998);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_vv_999, AgradDistributionTestFixture, AgradDistributionParetoType2_vv_999);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, std::vector<double>, empty, empty> type_ffv_1000;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1001;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, fvar<fvar<var> >, empty, empty> type_ffv_1002;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1003;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1004;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, double, empty, empty> type_ffv_1005;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, std::vector<double>, empty, empty> type_ffv_1006;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1007;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_1008;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1009;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1010;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_1011;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_1012;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1013;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_1014;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1015;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1016;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, double, empty, empty> type_ffv_1017;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_1018;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1019;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_1020;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1021;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1022;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_1023;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_1024;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1025;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_1026;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1027;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1028;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_1029;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_1030;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1031;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_1032;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1033;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1034;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, double, empty, empty> type_ffv_1035;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, std::vector<double>, empty, empty> type_ffv_1036;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1037;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, fvar<fvar<var> >, empty, empty> type_ffv_1038;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1039;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1040;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, double, empty, empty> type_ffv_1041;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_1042;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1043;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_1044;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1045;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1046;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_1047;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_1048;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1049;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_1050;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1051;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1052;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, double, empty, empty> type_ffv_1053;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_1054;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1055;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_1056;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1057;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1058;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_1059;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_1060;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1061;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_1062;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1063;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1064;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_1065;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_1066;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1067;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_1068;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1069;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1070;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty> type_ffv_1071;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_ffv_1072;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1073;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_1074;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1075;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1076;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_ffv_1077;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_1078;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1079;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_1080;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1081;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1082;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_1083;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_1084;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1085;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_1086;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1087;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1088;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_1089;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_1090;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1091;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_1092;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1093;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1094;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_1095;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_1096;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1097;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_1098;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1099;
+
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1000> AgradDistributionParetoType2_ffv_1000;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1001> AgradDistributionParetoType2_ffv_1001;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1002> AgradDistributionParetoType2_ffv_1002;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1003> AgradDistributionParetoType2_ffv_1003;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1004> AgradDistributionParetoType2_ffv_1004;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1005> AgradDistributionParetoType2_ffv_1005;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1006> AgradDistributionParetoType2_ffv_1006;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1007> AgradDistributionParetoType2_ffv_1007;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1008> AgradDistributionParetoType2_ffv_1008;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1009> AgradDistributionParetoType2_ffv_1009;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1010> AgradDistributionParetoType2_ffv_1010;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1011> AgradDistributionParetoType2_ffv_1011;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1012> AgradDistributionParetoType2_ffv_1012;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1013> AgradDistributionParetoType2_ffv_1013;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1014> AgradDistributionParetoType2_ffv_1014;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1015> AgradDistributionParetoType2_ffv_1015;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1016> AgradDistributionParetoType2_ffv_1016;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1017> AgradDistributionParetoType2_ffv_1017;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1018> AgradDistributionParetoType2_ffv_1018;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1019> AgradDistributionParetoType2_ffv_1019;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1020> AgradDistributionParetoType2_ffv_1020;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1021> AgradDistributionParetoType2_ffv_1021;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1022> AgradDistributionParetoType2_ffv_1022;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1023> AgradDistributionParetoType2_ffv_1023;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1024> AgradDistributionParetoType2_ffv_1024;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1025> AgradDistributionParetoType2_ffv_1025;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1026> AgradDistributionParetoType2_ffv_1026;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1027> AgradDistributionParetoType2_ffv_1027;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1028> AgradDistributionParetoType2_ffv_1028;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1029> AgradDistributionParetoType2_ffv_1029;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1030> AgradDistributionParetoType2_ffv_1030;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1031> AgradDistributionParetoType2_ffv_1031;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1032> AgradDistributionParetoType2_ffv_1032;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1033> AgradDistributionParetoType2_ffv_1033;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1034> AgradDistributionParetoType2_ffv_1034;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1035> AgradDistributionParetoType2_ffv_1035;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1036> AgradDistributionParetoType2_ffv_1036;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1037> AgradDistributionParetoType2_ffv_1037;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1038> AgradDistributionParetoType2_ffv_1038;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1039> AgradDistributionParetoType2_ffv_1039;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1040> AgradDistributionParetoType2_ffv_1040;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1041> AgradDistributionParetoType2_ffv_1041;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1042> AgradDistributionParetoType2_ffv_1042;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1043> AgradDistributionParetoType2_ffv_1043;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1044> AgradDistributionParetoType2_ffv_1044;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1045> AgradDistributionParetoType2_ffv_1045;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1046> AgradDistributionParetoType2_ffv_1046;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1047> AgradDistributionParetoType2_ffv_1047;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1048> AgradDistributionParetoType2_ffv_1048;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1049> AgradDistributionParetoType2_ffv_1049;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1050> AgradDistributionParetoType2_ffv_1050;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1051> AgradDistributionParetoType2_ffv_1051;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1052> AgradDistributionParetoType2_ffv_1052;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1053> AgradDistributionParetoType2_ffv_1053;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1054> AgradDistributionParetoType2_ffv_1054;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1055> AgradDistributionParetoType2_ffv_1055;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1056> AgradDistributionParetoType2_ffv_1056;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1057> AgradDistributionParetoType2_ffv_1057;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1058> AgradDistributionParetoType2_ffv_1058;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1059> AgradDistributionParetoType2_ffv_1059;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1060> AgradDistributionParetoType2_ffv_1060;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1061> AgradDistributionParetoType2_ffv_1061;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1062> AgradDistributionParetoType2_ffv_1062;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1063> AgradDistributionParetoType2_ffv_1063;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1064> AgradDistributionParetoType2_ffv_1064;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1065> AgradDistributionParetoType2_ffv_1065;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1066> AgradDistributionParetoType2_ffv_1066;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1067> AgradDistributionParetoType2_ffv_1067;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1068> AgradDistributionParetoType2_ffv_1068;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1069> AgradDistributionParetoType2_ffv_1069;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1070> AgradDistributionParetoType2_ffv_1070;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1071> AgradDistributionParetoType2_ffv_1071;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1072> AgradDistributionParetoType2_ffv_1072;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1073> AgradDistributionParetoType2_ffv_1073;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1074> AgradDistributionParetoType2_ffv_1074;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1075> AgradDistributionParetoType2_ffv_1075;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1076> AgradDistributionParetoType2_ffv_1076;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1077> AgradDistributionParetoType2_ffv_1077;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1078> AgradDistributionParetoType2_ffv_1078;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1079> AgradDistributionParetoType2_ffv_1079;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1080> AgradDistributionParetoType2_ffv_1080;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1081> AgradDistributionParetoType2_ffv_1081;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1082> AgradDistributionParetoType2_ffv_1082;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1083> AgradDistributionParetoType2_ffv_1083;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1084> AgradDistributionParetoType2_ffv_1084;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1085> AgradDistributionParetoType2_ffv_1085;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1086> AgradDistributionParetoType2_ffv_1086;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1087> AgradDistributionParetoType2_ffv_1087;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1088> AgradDistributionParetoType2_ffv_1088;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1089> AgradDistributionParetoType2_ffv_1089;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1090> AgradDistributionParetoType2_ffv_1090;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1091> AgradDistributionParetoType2_ffv_1091;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1092> AgradDistributionParetoType2_ffv_1092;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1093> AgradDistributionParetoType2_ffv_1093;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1094> AgradDistributionParetoType2_ffv_1094;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1095> AgradDistributionParetoType2_ffv_1095;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1096> AgradDistributionParetoType2_ffv_1096;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1097> AgradDistributionParetoType2_ffv_1097;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1098> AgradDistributionParetoType2_ffv_1098;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1099> AgradDistributionParetoType2_ffv_1099;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1000, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1000);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1001, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1001);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1002, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1002);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1003, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1003);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1004, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1004);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1005, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1005);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1006, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1006);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1007, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1007);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1008, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1008);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1009, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1009);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1010, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1010);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1011, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1011);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1012, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1012);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1013, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1013);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1014, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1014);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1015, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1015);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1016, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1016);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1017, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1017);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1018, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1018);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1019, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1019);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1020, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1020);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1021, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1021);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1022, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1022);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1023, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1023);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1024, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1024);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1025, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1025);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1026, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1026);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1027, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1027);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1028, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1028);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1029, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1029);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1030, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1030);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1031, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1031);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1032, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1032);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1033, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1033);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1034, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1034);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1035, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1035);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1036, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1036);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1037, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1037);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1038, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1038);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1039, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1039);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1040, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1040);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1041, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1041);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1042, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1042);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1043, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1043);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1044, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1044);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1045, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1045);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1046, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1046);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1047, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1047);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1048, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1048);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1049, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1049);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1050, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1050);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1051, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1051);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1052, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1052);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1053, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1053);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1054, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1054);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1055, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1055);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1056, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1056);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1057, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1057);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1058, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1058);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1059, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1059);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1060, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1060);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1061, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1061);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1062, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1062);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1063, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1063);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1064, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1064);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1065, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1065);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1066, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1066);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1067, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1067);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1068, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1068);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1069, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1069);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1070, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1070);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1071, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1071);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1072, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1072);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1073, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1073);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1074, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1074);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1075, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1075);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1076, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1076);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1077, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1077);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1078, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1078);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1079, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1079);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1080, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1080);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1081, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1081);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1082, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1082);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1083, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1083);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1084, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1084);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1085, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1085);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1086, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1086);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1087, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1087);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1088, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1088);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1089, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1089);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1090, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1090);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1091, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1091);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1092, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1092);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1093, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1093);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1094, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1094);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1095, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1095);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1096, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1096);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1097, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1097);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1098, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1098);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1099, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1099);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1100;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_1101;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_1102;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1103;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_1104;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1105;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1106;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, double, empty, empty> type_ffv_1107;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, std::vector<double>, empty, empty> type_ffv_1108;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1109;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, fvar<fvar<var> >, empty, empty> type_ffv_1110;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1111;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1112;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, double, empty, empty> type_ffv_1113;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty, empty> type_ffv_1114;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1115;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_1116;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1117;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1118;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_1119;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_1120;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1121;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_1122;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1123;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1124;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, double, empty, empty> type_ffv_1125;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_1126;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1127;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_1128;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1129;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1130;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_1131;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_1132;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1133;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_1134;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1135;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1136;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_1137;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_1138;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1139;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_1140;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1141;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1142;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, double, empty, empty> type_ffv_1143;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty, empty> type_ffv_1144;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1145;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty, empty> type_ffv_1146;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1147;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1148;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty, empty> type_ffv_1149;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_1150;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1151;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_1152;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1153;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1154;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_1155;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_1156;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1157;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_1158;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1159;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1160;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty, empty> type_ffv_1161;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_1162;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1163;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_1164;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1165;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1166;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_1167;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_1168;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1169;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_1170;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1171;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1172;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_1173;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_1174;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1175;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_1176;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1177;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1178;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty, empty> type_ffv_1179;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_ffv_1180;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1181;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_1182;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1183;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1184;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_ffv_1185;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_1186;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1187;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_1188;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1189;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1190;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_1191;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_1192;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1193;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_1194;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1195;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1196;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_1197;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_1198;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1199;
+
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1100> AgradDistributionParetoType2_ffv_1100;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1101> AgradDistributionParetoType2_ffv_1101;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1102> AgradDistributionParetoType2_ffv_1102;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1103> AgradDistributionParetoType2_ffv_1103;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1104> AgradDistributionParetoType2_ffv_1104;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1105> AgradDistributionParetoType2_ffv_1105;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1106> AgradDistributionParetoType2_ffv_1106;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1107> AgradDistributionParetoType2_ffv_1107;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1108> AgradDistributionParetoType2_ffv_1108;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1109> AgradDistributionParetoType2_ffv_1109;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1110> AgradDistributionParetoType2_ffv_1110;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1111> AgradDistributionParetoType2_ffv_1111;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1112> AgradDistributionParetoType2_ffv_1112;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1113> AgradDistributionParetoType2_ffv_1113;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1114> AgradDistributionParetoType2_ffv_1114;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1115> AgradDistributionParetoType2_ffv_1115;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1116> AgradDistributionParetoType2_ffv_1116;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1117> AgradDistributionParetoType2_ffv_1117;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1118> AgradDistributionParetoType2_ffv_1118;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1119> AgradDistributionParetoType2_ffv_1119;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1120> AgradDistributionParetoType2_ffv_1120;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1121> AgradDistributionParetoType2_ffv_1121;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1122> AgradDistributionParetoType2_ffv_1122;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1123> AgradDistributionParetoType2_ffv_1123;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1124> AgradDistributionParetoType2_ffv_1124;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1125> AgradDistributionParetoType2_ffv_1125;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1126> AgradDistributionParetoType2_ffv_1126;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1127> AgradDistributionParetoType2_ffv_1127;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1128> AgradDistributionParetoType2_ffv_1128;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1129> AgradDistributionParetoType2_ffv_1129;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1130> AgradDistributionParetoType2_ffv_1130;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1131> AgradDistributionParetoType2_ffv_1131;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1132> AgradDistributionParetoType2_ffv_1132;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1133> AgradDistributionParetoType2_ffv_1133;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1134> AgradDistributionParetoType2_ffv_1134;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1135> AgradDistributionParetoType2_ffv_1135;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1136> AgradDistributionParetoType2_ffv_1136;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1137> AgradDistributionParetoType2_ffv_1137;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1138> AgradDistributionParetoType2_ffv_1138;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1139> AgradDistributionParetoType2_ffv_1139;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1140> AgradDistributionParetoType2_ffv_1140;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1141> AgradDistributionParetoType2_ffv_1141;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1142> AgradDistributionParetoType2_ffv_1142;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1143> AgradDistributionParetoType2_ffv_1143;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1144> AgradDistributionParetoType2_ffv_1144;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1145> AgradDistributionParetoType2_ffv_1145;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1146> AgradDistributionParetoType2_ffv_1146;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1147> AgradDistributionParetoType2_ffv_1147;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1148> AgradDistributionParetoType2_ffv_1148;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1149> AgradDistributionParetoType2_ffv_1149;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1150> AgradDistributionParetoType2_ffv_1150;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1151> AgradDistributionParetoType2_ffv_1151;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1152> AgradDistributionParetoType2_ffv_1152;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1153> AgradDistributionParetoType2_ffv_1153;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1154> AgradDistributionParetoType2_ffv_1154;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1155> AgradDistributionParetoType2_ffv_1155;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1156> AgradDistributionParetoType2_ffv_1156;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1157> AgradDistributionParetoType2_ffv_1157;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1158> AgradDistributionParetoType2_ffv_1158;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1159> AgradDistributionParetoType2_ffv_1159;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1160> AgradDistributionParetoType2_ffv_1160;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1161> AgradDistributionParetoType2_ffv_1161;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1162> AgradDistributionParetoType2_ffv_1162;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1163> AgradDistributionParetoType2_ffv_1163;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1164> AgradDistributionParetoType2_ffv_1164;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1165> AgradDistributionParetoType2_ffv_1165;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1166> AgradDistributionParetoType2_ffv_1166;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1167> AgradDistributionParetoType2_ffv_1167;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1168> AgradDistributionParetoType2_ffv_1168;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1169> AgradDistributionParetoType2_ffv_1169;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1170> AgradDistributionParetoType2_ffv_1170;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1171> AgradDistributionParetoType2_ffv_1171;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1172> AgradDistributionParetoType2_ffv_1172;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1173> AgradDistributionParetoType2_ffv_1173;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1174> AgradDistributionParetoType2_ffv_1174;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1175> AgradDistributionParetoType2_ffv_1175;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1176> AgradDistributionParetoType2_ffv_1176;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1177> AgradDistributionParetoType2_ffv_1177;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1178> AgradDistributionParetoType2_ffv_1178;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1179> AgradDistributionParetoType2_ffv_1179;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1180> AgradDistributionParetoType2_ffv_1180;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1181> AgradDistributionParetoType2_ffv_1181;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1182> AgradDistributionParetoType2_ffv_1182;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1183> AgradDistributionParetoType2_ffv_1183;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1184> AgradDistributionParetoType2_ffv_1184;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1185> AgradDistributionParetoType2_ffv_1185;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1186> AgradDistributionParetoType2_ffv_1186;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1187> AgradDistributionParetoType2_ffv_1187;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1188> AgradDistributionParetoType2_ffv_1188;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1189> AgradDistributionParetoType2_ffv_1189;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1190> AgradDistributionParetoType2_ffv_1190;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1191> AgradDistributionParetoType2_ffv_1191;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1192> AgradDistributionParetoType2_ffv_1192;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1193> AgradDistributionParetoType2_ffv_1193;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1194> AgradDistributionParetoType2_ffv_1194;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1195> AgradDistributionParetoType2_ffv_1195;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1196> AgradDistributionParetoType2_ffv_1196;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1197> AgradDistributionParetoType2_ffv_1197;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1198> AgradDistributionParetoType2_ffv_1198;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1199> AgradDistributionParetoType2_ffv_1199;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1100, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1101, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1102, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1103, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1104, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1105, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1106, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1107, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1108, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1109, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1110, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1111, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1112, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1113, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1114, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1115, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1116, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1117, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1118, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1119, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1120, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1121, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1122, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1123, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1124, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1125, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1126, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1127, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1128, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1129, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1130, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1131, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1132, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1133, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1134, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1135, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1136, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1137, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1138, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1139, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1140, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1141, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1142, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1143, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1144, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1145, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1146, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1147, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1148, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1149, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1150, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1151, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1152, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1153, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1154, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1155, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1156, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1157, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1158, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1159, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1160, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1161, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1162, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1163, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1164, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1165, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1166, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1167, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1168, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1169, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1170, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1171, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1172, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1173, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1174, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1175, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1176, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1177, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1178, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1179, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1180, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1181, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1182, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1183, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1184, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1185, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1186, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1187, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1188, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1188);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1189, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1189);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1190, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1190);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1191, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1191);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1192, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1192);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1193, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1193);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1194, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1194);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1195, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1195);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1196, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1196);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1197, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1197);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1198, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1198);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1199, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1199);
+
@@ -0,0 +1,56 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_1200;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1201;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1202;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_1203;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_1204;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1205;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_1206;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1207;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1208;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_1209;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_1210;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1211;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_1212;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1213;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1214;
+
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1200> AgradDistributionParetoType2_ffv_1200;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1201> AgradDistributionParetoType2_ffv_1201;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1202> AgradDistributionParetoType2_ffv_1202;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1203> AgradDistributionParetoType2_ffv_1203;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1204> AgradDistributionParetoType2_ffv_1204;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1205> AgradDistributionParetoType2_ffv_1205;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1206> AgradDistributionParetoType2_ffv_1206;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1207> AgradDistributionParetoType2_ffv_1207;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1208> AgradDistributionParetoType2_ffv_1208;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1209> AgradDistributionParetoType2_ffv_1209;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1210> AgradDistributionParetoType2_ffv_1210;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1211> AgradDistributionParetoType2_ffv_1211;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1212> AgradDistributionParetoType2_ffv_1212;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1213> AgradDistributionParetoType2_ffv_1213;
+typedef std::tuple<AgradDistributionParetoType2, type_ffv_1214> AgradDistributionParetoType2_ffv_1214;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1200, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1200);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1201, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1201);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1202, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1202);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1203, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1203);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1204, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1204);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1205, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1205);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1206, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1206);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1207, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1207);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1208, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1208);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1209, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1209);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1210, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1210);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1211, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1211);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1212, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1212);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1213, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1213);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionParetoType2_ffv_1214, AgradDistributionTestFixture, AgradDistributionParetoType2_ffv_1214);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_ccdf_log_test.hpp>
+
+typedef std::tuple<double, double, double, fvar<fvar<var> >, empty, empty> type_ffv_0;
+typedef std::tuple<double, double, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1;
+typedef std::tuple<double, double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_2;
+typedef std::tuple<double, double, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_3;
+typedef std::tuple<double, double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_4;
+typedef std::tuple<double, double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_5;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_6;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_7;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_8;
+typedef std::tuple<double, double, fvar<fvar<var> >, double, empty, empty> type_ffv_9;
+typedef std::tuple<double, double, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_10;
+typedef std::tuple<double, double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_11;
+typedef std::tuple<double, double, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_12;
+typedef std::tuple<double, double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_13;
+typedef std::tuple<double, double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_14;
+typedef std::tuple<double, double, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_15;
+typedef std::tuple<double, double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_16;
+typedef std::tuple<double, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_17;
+typedef std::tuple<double, double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_18;
+typedef std::tuple<double, double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_19;
+typedef std::tuple<double, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_20;
+typedef std::tuple<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_21;
+typedef std::tuple<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_22;
+typedef std::tuple<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_23;
+typedef std::tuple<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_24;
+typedef std::tuple<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_25;
+typedef std::tuple<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_26;
+typedef std::tuple<double, std::vector<double>, double, fvar<fvar<var> >, empty, empty> type_ffv_27;
+typedef std::tuple<double, std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_28;
+typedef std::tuple<double, std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_29;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_30;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_31;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_32;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_33;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_34;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_35;
+typedef std::tuple<double, std::vector<double>, fvar<fvar<var> >, double, empty, empty> type_ffv_36;
+typedef std::tuple<double, std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_37;
+typedef std::tuple<double, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_38;
+typedef std::tuple<double, std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_39;
+typedef std::tuple<double, std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_40;
+typedef std::tuple<double, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_41;
+typedef std::tuple<double, std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_42;
+typedef std::tuple<double, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_43;
+typedef std::tuple<double, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_44;
+typedef std::tuple<double, std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_45;
+typedef std::tuple<double, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_46;
+typedef std::tuple<double, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_47;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_48;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_49;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_50;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_51;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_52;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_53;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_54;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_55;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_56;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_57;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_58;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_59;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_60;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_61;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_62;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_63;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_64;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_65;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_66;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_67;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_68;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_69;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_70;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_71;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_72;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_73;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_74;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_75;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_76;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_77;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_78;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_79;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_80;
+typedef std::tuple<double, fvar<fvar<var> >, double, double, empty, empty> type_ffv_81;
+typedef std::tuple<double, fvar<fvar<var> >, double, std::vector<double>, empty, empty> type_ffv_82;
+typedef std::tuple<double, fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_83;
+typedef std::tuple<double, fvar<fvar<var> >, double, fvar<fvar<var> >, empty, empty> type_ffv_84;
+typedef std::tuple<double, fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_85;
+typedef std::tuple<double, fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_86;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<double>, double, empty, empty> type_ffv_87;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty, empty> type_ffv_88;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_89;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_90;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_91;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_92;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_93;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_94;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_95;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_96;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_97;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_98;
+typedef std::tuple<double, fvar<fvar<var> >, fvar<fvar<var> >, double, empty, empty> type_ffv_99;
+
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_0> AgradCcdfLogParetoType2_ffv_0;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1> AgradCcdfLogParetoType2_ffv_1;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_2> AgradCcdfLogParetoType2_ffv_2;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_3> AgradCcdfLogParetoType2_ffv_3;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_4> AgradCcdfLogParetoType2_ffv_4;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_5> AgradCcdfLogParetoType2_ffv_5;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_6> AgradCcdfLogParetoType2_ffv_6;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_7> AgradCcdfLogParetoType2_ffv_7;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_8> AgradCcdfLogParetoType2_ffv_8;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_9> AgradCcdfLogParetoType2_ffv_9;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_10> AgradCcdfLogParetoType2_ffv_10;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_11> AgradCcdfLogParetoType2_ffv_11;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_12> AgradCcdfLogParetoType2_ffv_12;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_13> AgradCcdfLogParetoType2_ffv_13;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_14> AgradCcdfLogParetoType2_ffv_14;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_15> AgradCcdfLogParetoType2_ffv_15;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_16> AgradCcdfLogParetoType2_ffv_16;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_17> AgradCcdfLogParetoType2_ffv_17;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_18> AgradCcdfLogParetoType2_ffv_18;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_19> AgradCcdfLogParetoType2_ffv_19;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_20> AgradCcdfLogParetoType2_ffv_20;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_21> AgradCcdfLogParetoType2_ffv_21;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_22> AgradCcdfLogParetoType2_ffv_22;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_23> AgradCcdfLogParetoType2_ffv_23;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_24> AgradCcdfLogParetoType2_ffv_24;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_25> AgradCcdfLogParetoType2_ffv_25;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_26> AgradCcdfLogParetoType2_ffv_26;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_27> AgradCcdfLogParetoType2_ffv_27;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_28> AgradCcdfLogParetoType2_ffv_28;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_29> AgradCcdfLogParetoType2_ffv_29;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_30> AgradCcdfLogParetoType2_ffv_30;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_31> AgradCcdfLogParetoType2_ffv_31;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_32> AgradCcdfLogParetoType2_ffv_32;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_33> AgradCcdfLogParetoType2_ffv_33;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_34> AgradCcdfLogParetoType2_ffv_34;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_35> AgradCcdfLogParetoType2_ffv_35;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_36> AgradCcdfLogParetoType2_ffv_36;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_37> AgradCcdfLogParetoType2_ffv_37;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_38> AgradCcdfLogParetoType2_ffv_38;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_39> AgradCcdfLogParetoType2_ffv_39;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_40> AgradCcdfLogParetoType2_ffv_40;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_41> AgradCcdfLogParetoType2_ffv_41;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_42> AgradCcdfLogParetoType2_ffv_42;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_43> AgradCcdfLogParetoType2_ffv_43;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_44> AgradCcdfLogParetoType2_ffv_44;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_45> AgradCcdfLogParetoType2_ffv_45;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_46> AgradCcdfLogParetoType2_ffv_46;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_47> AgradCcdfLogParetoType2_ffv_47;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_48> AgradCcdfLogParetoType2_ffv_48;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_49> AgradCcdfLogParetoType2_ffv_49;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_50> AgradCcdfLogParetoType2_ffv_50;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_51> AgradCcdfLogParetoType2_ffv_51;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_52> AgradCcdfLogParetoType2_ffv_52;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_53> AgradCcdfLogParetoType2_ffv_53;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_54> AgradCcdfLogParetoType2_ffv_54;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_55> AgradCcdfLogParetoType2_ffv_55;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_56> AgradCcdfLogParetoType2_ffv_56;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_57> AgradCcdfLogParetoType2_ffv_57;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_58> AgradCcdfLogParetoType2_ffv_58;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_59> AgradCcdfLogParetoType2_ffv_59;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_60> AgradCcdfLogParetoType2_ffv_60;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_61> AgradCcdfLogParetoType2_ffv_61;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_62> AgradCcdfLogParetoType2_ffv_62;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_63> AgradCcdfLogParetoType2_ffv_63;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_64> AgradCcdfLogParetoType2_ffv_64;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_65> AgradCcdfLogParetoType2_ffv_65;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_66> AgradCcdfLogParetoType2_ffv_66;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_67> AgradCcdfLogParetoType2_ffv_67;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_68> AgradCcdfLogParetoType2_ffv_68;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_69> AgradCcdfLogParetoType2_ffv_69;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_70> AgradCcdfLogParetoType2_ffv_70;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_71> AgradCcdfLogParetoType2_ffv_71;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_72> AgradCcdfLogParetoType2_ffv_72;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_73> AgradCcdfLogParetoType2_ffv_73;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_74> AgradCcdfLogParetoType2_ffv_74;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_75> AgradCcdfLogParetoType2_ffv_75;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_76> AgradCcdfLogParetoType2_ffv_76;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_77> AgradCcdfLogParetoType2_ffv_77;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_78> AgradCcdfLogParetoType2_ffv_78;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_79> AgradCcdfLogParetoType2_ffv_79;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_80> AgradCcdfLogParetoType2_ffv_80;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_81> AgradCcdfLogParetoType2_ffv_81;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_82> AgradCcdfLogParetoType2_ffv_82;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_83> AgradCcdfLogParetoType2_ffv_83;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_84> AgradCcdfLogParetoType2_ffv_84;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_85> AgradCcdfLogParetoType2_ffv_85;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_86> AgradCcdfLogParetoType2_ffv_86;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_87> AgradCcdfLogParetoType2_ffv_87;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_88> AgradCcdfLogParetoType2_ffv_88;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_89> AgradCcdfLogParetoType2_ffv_89;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_90> AgradCcdfLogParetoType2_ffv_90;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_91> AgradCcdfLogParetoType2_ffv_91;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_92> AgradCcdfLogParetoType2_ffv_92;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_93> AgradCcdfLogParetoType2_ffv_93;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_94> AgradCcdfLogParetoType2_ffv_94;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_95> AgradCcdfLogParetoType2_ffv_95;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_96> AgradCcdfLogParetoType2_ffv_96;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_97> AgradCcdfLogParetoType2_ffv_97;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_98> AgradCcdfLogParetoType2_ffv_98;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_99> AgradCcdfLogParetoType2_ffv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_0, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_2, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_3, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_4, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_5, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_6, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_7, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_8, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_9, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_10, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_11, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_12, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_13, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_14, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_15, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_16, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_17, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_18, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_19, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_20, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_21, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_22, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_23, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_24, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_25, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_26, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_27, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_28, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_29, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_30, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_31, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_32, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_33, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_34, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_35, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_36, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_37, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_38, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_39, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_40, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_41, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_42, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_43, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_44, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_45, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_46, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_47, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_48, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_49, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_50, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_51, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_52, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_53, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_54, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_55, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_56, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_57, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_58, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_59, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_60, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_61, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_62, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_63, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_64, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_65, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_66, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_67, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_68, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_69, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_70, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_71, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_72, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_73, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_74, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_75, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_76, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_77, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_78, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_79, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_80, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_81, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_82, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_83, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_84, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_85, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_86, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_87, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_88, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_89, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_90, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_91, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_92, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_93, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_94, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_95, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_96, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_97, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_98, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_99, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_99);
+
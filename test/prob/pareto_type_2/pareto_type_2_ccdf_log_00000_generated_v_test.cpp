@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_ccdf_log_test.hpp>
+
+typedef std::tuple<double, double, double, double, empty, empty> type_v_0;
+typedef std::tuple<double, double, double, std::vector<double>, empty, empty> type_v_1;
+typedef std::tuple<double, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_2;
+typedef std::tuple<double, double, double, var, empty, empty> type_v_3;
+typedef std::tuple<double, double, double, std::vector<var>, empty, empty> type_v_4;
+typedef std::tuple<double, double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_5;
+typedef std::tuple<double, double, std::vector<double>, double, empty, empty> type_v_6;
+typedef std::tuple<double, double, std::vector<double>, std::vector<double>, empty, empty> type_v_7;
+typedef std::tuple<double, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_8;
+typedef std::tuple<double, double, std::vector<double>, var, empty, empty> type_v_9;
+typedef std::tuple<double, double, std::vector<double>, std::vector<var>, empty, empty> type_v_10;
+typedef std::tuple<double, double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_11;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_12;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_13;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_14;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_15;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_16;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_17;
+typedef std::tuple<double, double, var, double, empty, empty> type_v_18;
+typedef std::tuple<double, double, var, std::vector<double>, empty, empty> type_v_19;
+typedef std::tuple<double, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_20;
+typedef std::tuple<double, double, var, var, empty, empty> type_v_21;
+typedef std::tuple<double, double, var, std::vector<var>, empty, empty> type_v_22;
+typedef std::tuple<double, double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_23;
+typedef std::tuple<double, double, std::vector<var>, double, empty, empty> type_v_24;
+typedef std::tuple<double, double, std::vector<var>, std::vector<double>, empty, empty> type_v_25;
+typedef std::tuple<double, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_26;
+typedef std::tuple<double, double, std::vector<var>, var, empty, empty> type_v_27;
+typedef std::tuple<double, double, std::vector<var>, std::vector<var>, empty, empty> type_v_28;
+typedef std::tuple<double, double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_29;
+typedef std::tuple<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_30;
+typedef std::tuple<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_31;
+typedef std::tuple<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_32;
+typedef std::tuple<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_33;
+typedef std::tuple<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_34;
+typedef std::tuple<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_35;
+typedef std::tuple<double, std::vector<double>, double, double, empty, empty> type_v_36;
+typedef std::tuple<double, std::vector<double>, double, std::vector<double>, empty, empty> type_v_37;
+typedef std::tuple<double, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_38;
+typedef std::tuple<double, std::vector<double>, double, var, empty, empty> type_v_39;
+typedef std::tuple<double, std::vector<double>, double, std::vector<var>, empty, empty> type_v_40;
+typedef std::tuple<double, std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_41;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, double, empty, empty> type_v_42;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, std::vector<double>, empty, empty> type_v_43;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_44;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, var, empty, empty> type_v_45;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_v_46;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_47;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_48;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_49;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_50;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_51;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_52;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_53;
+typedef std::tuple<double, std::vector<double>, var, double, empty, empty> type_v_54;
+typedef std::tuple<double, std::vector<double>, var, std::vector<double>, empty, empty> type_v_55;
+typedef std::tuple<double, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_56;
+typedef std::tuple<double, std::vector<double>, var, var, empty, empty> type_v_57;
+typedef std::tuple<double, std::vector<double>, var, std::vector<var>, empty, empty> type_v_58;
+typedef std::tuple<double, std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_59;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, double, empty, empty> type_v_60;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_v_61;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_62;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, var, empty, empty> type_v_63;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_v_64;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_65;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_66;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_67;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_68;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_69;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_70;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_71;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_72;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_73;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_74;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_75;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_76;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_77;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_78;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_79;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_80;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_81;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_82;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_83;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_84;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_85;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_86;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_87;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_88;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_89;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_90;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_91;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_92;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_93;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_94;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_95;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_96;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_97;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_98;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_99;
+
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_0> AgradCcdfLogParetoType2_v_0;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_1> AgradCcdfLogParetoType2_v_1;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_2> AgradCcdfLogParetoType2_v_2;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_3> AgradCcdfLogParetoType2_v_3;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_4> AgradCcdfLogParetoType2_v_4;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_5> AgradCcdfLogParetoType2_v_5;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_6> AgradCcdfLogParetoType2_v_6;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_7> AgradCcdfLogParetoType2_v_7;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_8> AgradCcdfLogParetoType2_v_8;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_9> AgradCcdfLogParetoType2_v_9;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_10> AgradCcdfLogParetoType2_v_10;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_11> AgradCcdfLogParetoType2_v_11;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_12> AgradCcdfLogParetoType2_v_12;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_13> AgradCcdfLogParetoType2_v_13;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_14> AgradCcdfLogParetoType2_v_14;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_15> AgradCcdfLogParetoType2_v_15;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_16> AgradCcdfLogParetoType2_v_16;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_17> AgradCcdfLogParetoType2_v_17;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_18> AgradCcdfLogParetoType2_v_18;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_19> AgradCcdfLogParetoType2_v_19;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_20> AgradCcdfLogParetoType2_v_20;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_21> AgradCcdfLogParetoType2_v_21;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_22> AgradCcdfLogParetoType2_v_22;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_23> AgradCcdfLogParetoType2_v_23;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_24> AgradCcdfLogParetoType2_v_24;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_25> AgradCcdfLogParetoType2_v_25;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_26> AgradCcdfLogParetoType2_v_26;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_27> AgradCcdfLogParetoType2_v_27;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_28> AgradCcdfLogParetoType2_v_28;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_29> AgradCcdfLogParetoType2_v_29;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_30> AgradCcdfLogParetoType2_v_30;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_31> AgradCcdfLogParetoType2_v_31;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_32> AgradCcdfLogParetoType2_v_32;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_33> AgradCcdfLogParetoType2_v_33;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_34> AgradCcdfLogParetoType2_v_34;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_35> AgradCcdfLogParetoType2_v_35;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_36> AgradCcdfLogParetoType2_v_36;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_37> AgradCcdfLogParetoType2_v_37;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_38> AgradCcdfLogParetoType2_v_38;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_39> AgradCcdfLogParetoType2_v_39;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_40> AgradCcdfLogParetoType2_v_40;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_41> AgradCcdfLogParetoType2_v_41;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_42> AgradCcdfLogParetoType2_v_42;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_43> AgradCcdfLogParetoType2_v_43;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_44> AgradCcdfLogParetoType2_v_44;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_45> AgradCcdfLogParetoType2_v_45;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_46> AgradCcdfLogParetoType2_v_46;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_47> AgradCcdfLogParetoType2_v_47;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_48> AgradCcdfLogParetoType2_v_48;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_49> AgradCcdfLogParetoType2_v_49;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_50> AgradCcdfLogParetoType2_v_50;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_51> AgradCcdfLogParetoType2_v_51;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_52> AgradCcdfLogParetoType2_v_52;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_53> AgradCcdfLogParetoType2_v_53;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_54> AgradCcdfLogParetoType2_v_54;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_55> AgradCcdfLogParetoType2_v_55;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_56> AgradCcdfLogParetoType2_v_56;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_57> AgradCcdfLogParetoType2_v_57;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_58> AgradCcdfLogParetoType2_v_58;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_59> AgradCcdfLogParetoType2_v_59;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_60> AgradCcdfLogParetoType2_v_60;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_61> AgradCcdfLogParetoType2_v_61;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_62> AgradCcdfLogParetoType2_v_62;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_63> AgradCcdfLogParetoType2_v_63;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_64> AgradCcdfLogParetoType2_v_64;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_65> AgradCcdfLogParetoType2_v_65;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_66> AgradCcdfLogParetoType2_v_66;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_67> AgradCcdfLogParetoType2_v_67;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_68> AgradCcdfLogParetoType2_v_68;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_69> AgradCcdfLogParetoType2_v_69;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_70> AgradCcdfLogParetoType2_v_70;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_71> AgradCcdfLogParetoType2_v_71;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_72> AgradCcdfLogParetoType2_v_72;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_73> AgradCcdfLogParetoType2_v_73;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_74> AgradCcdfLogParetoType2_v_74;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_75> AgradCcdfLogParetoType2_v_75;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_76> AgradCcdfLogParetoType2_v_76;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_77> AgradCcdfLogParetoType2_v_77;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_78> AgradCcdfLogParetoType2_v_78;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_79> AgradCcdfLogParetoType2_v_79;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_80> AgradCcdfLogParetoType2_v_80;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_81> AgradCcdfLogParetoType2_v_81;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_82> AgradCcdfLogParetoType2_v_82;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_83> AgradCcdfLogParetoType2_v_83;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_84> AgradCcdfLogParetoType2_v_84;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_85> AgradCcdfLogParetoType2_v_85;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_86> AgradCcdfLogParetoType2_v_86;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_87> AgradCcdfLogParetoType2_v_87;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_88> AgradCcdfLogParetoType2_v_88;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_89> AgradCcdfLogParetoType2_v_89;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_90> AgradCcdfLogParetoType2_v_90;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_91> AgradCcdfLogParetoType2_v_91;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_92> AgradCcdfLogParetoType2_v_92;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_93> AgradCcdfLogParetoType2_v_93;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_94> AgradCcdfLogParetoType2_v_94;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_95> AgradCcdfLogParetoType2_v_95;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_96> AgradCcdfLogParetoType2_v_96;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_97> AgradCcdfLogParetoType2_v_97;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_98> AgradCcdfLogParetoType2_v_98;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_99> AgradCcdfLogParetoType2_v_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_0, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_1, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_2, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_3, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_4, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_5, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_6, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_7, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_8, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_9, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_10, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_11, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_12, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_13, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_14, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_15, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_16, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_17, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_18, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_19, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_20, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_21, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_22, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_23, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_24, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_25, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_26, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_27, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_28, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_29, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_30, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_31, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_32, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_33, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_34, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_35, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_36, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_37, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_38, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_39, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_40, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_41, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_42, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_43, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_44, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_45, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_46, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_47, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_48, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_49, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_50, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_51, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_52, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_53, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_54, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_55, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_56, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_57, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_58, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_59, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_60, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_61, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_62, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_63, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_64, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_65, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_66, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_67, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_68, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_69, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_70, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_71, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_72, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_73, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_74, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_75, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_76, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_77, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_78, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_79, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_80, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_81, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_82, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_83, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_84, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_85, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_86, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_87, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_88, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_89, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_90, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_91, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_92, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_93, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_94, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_95, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_96, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_97, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_98, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_99, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_99);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_ccdf_log_test.hpp>
+
+typedef std::tuple<double, double, double, var, empty, empty> type_vv_0;
+typedef std::tuple<double, double, double, std::vector<var>, empty, empty> type_vv_1;
+typedef std::tuple<double, double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_2;
+typedef std::tuple<double, double, std::vector<double>, var, empty, empty> type_vv_3;
+typedef std::tuple<double, double, std::vector<double>, std::vector<var>, empty, empty> type_vv_4;
+typedef std::tuple<double, double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_5;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_6;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_7;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_8;
+typedef std::tuple<double, double, var, double, empty, empty> type_vv_9;
+typedef std::tuple<double, double, var, std::vector<double>, empty, empty> type_vv_10;
+typedef std::tuple<double, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_11;
+typedef std::tuple<double, double, var, var, empty, empty> type_vv_12;
+typedef std::tuple<double, double, var, std::vector<var>, empty, empty> type_vv_13;
+typedef std::tuple<double, double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_14;
+typedef std::tuple<double, double, std::vector<var>, double, empty, empty> type_vv_15;
+typedef std::tuple<double, double, std::vector<var>, std::vector<double>, empty, empty> type_vv_16;
+typedef std::tuple<double, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_17;
+typedef std::tuple<double, double, std::vector<var>, var, empty, empty> type_vv_18;
+typedef std::tuple<double, double, std::vector<var>, std::vector<var>, empty, empty> type_vv_19;
+typedef std::tuple<double, double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_20;
+typedef std::tuple<double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_21;
+typedef std::tuple<double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_22;
+typedef std::tuple<double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_23;
+typedef std::tuple<double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_24;
+typedef std::tuple<double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_25;
+typedef std::tuple<double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_26;
+typedef std::tuple<double, std::vector<double>, double, var, empty, empty> type_vv_27;
+typedef std::tuple<double, std::vector<double>, double, std::vector<var>, empty, empty> type_vv_28;
+typedef std::tuple<double, std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_29;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, var, empty, empty> type_vv_30;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_vv_31;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_32;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_33;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_34;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_35;
+typedef std::tuple<double, std::vector<double>, var, double, empty, empty> type_vv_36;
+typedef std::tuple<double, std::vector<double>, var, std::vector<double>, empty, empty> type_vv_37;
+typedef std::tuple<double, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_38;
+typedef std::tuple<double, std::vector<double>, var, var, empty, empty> type_vv_39;
+typedef std::tuple<double, std::vector<double>, var, std::vector<var>, empty, empty> type_vv_40;
+typedef std::tuple<double, std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_41;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, double, empty, empty> type_vv_42;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_vv_43;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_44;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, var, empty, empty> type_vv_45;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_vv_46;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_47;
+typedef std::tuple<double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_48;
+typedef std::tuple<double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_49;
+typedef std::tuple<double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_50;
+typedef std::tuple<double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_51;
+typedef std::tuple<double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_52;
+typedef std::tuple<double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_53;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_vv_54;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_vv_55;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_56;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_vv_57;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_vv_58;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_59;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_60;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_61;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_62;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_vv_63;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_vv_64;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_65;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_vv_66;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_vv_67;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_68;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_vv_69;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_vv_70;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_71;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_vv_72;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_vv_73;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_74;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_75;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_76;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_77;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_78;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_79;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_80;
+typedef std::tuple<double, var, double, double, empty, empty> type_vv_81;
+typedef std::tuple<double, var, double, std::vector<double>, empty, empty> type_vv_82;
+typedef std::tuple<double, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_83;
+typedef std::tuple<double, var, double, var, empty, empty> type_vv_84;
+typedef std::tuple<double, var, double, std::vector<var>, empty, empty> type_vv_85;
+typedef std::tuple<double, var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_86;
+typedef std::tuple<double, var, std::vector<double>, double, empty, empty> type_vv_87;
+typedef std::tuple<double, var, std::vector<double>, std::vector<double>, empty, empty> type_vv_88;
+typedef std::tuple<double, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_89;
+typedef std::tuple<double, var, std::vector<double>, var, empty, empty> type_vv_90;
+typedef std::tuple<double, var, std::vector<double>, std::vector<var>, empty, empty> type_vv_91;
+typedef std::tuple<double, var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_92;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_93;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_94;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_95;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_96;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_97;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_98;
+typedef std::tuple<double, var, var, double, empty, empty> type_vv_99;
+
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_0> AgradCcdfLogParetoType2_vv_0;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_1> AgradCcdfLogParetoType2_vv_1;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_2> AgradCcdfLogParetoType2_vv_2;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_3> AgradCcdfLogParetoType2_vv_3;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_4> AgradCcdfLogParetoType2_vv_4;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_5> AgradCcdfLogParetoType2_vv_5;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_6> AgradCcdfLogParetoType2_vv_6;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_7> AgradCcdfLogParetoType2_vv_7;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_8> AgradCcdfLogParetoType2_vv_8;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_9> AgradCcdfLogParetoType2_vv_9;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_10> AgradCcdfLogParetoType2_vv_10;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_11> AgradCcdfLogParetoType2_vv_11;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_12> AgradCcdfLogParetoType2_vv_12;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_13> AgradCcdfLogParetoType2_vv_13;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_14> AgradCcdfLogParetoType2_vv_14;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_15> AgradCcdfLogParetoType2_vv_15;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_16> AgradCcdfLogParetoType2_vv_16;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_17> AgradCcdfLogParetoType2_vv_17;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_18> AgradCcdfLogParetoType2_vv_18;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_19> AgradCcdfLogParetoType2_vv_19;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_20> AgradCcdfLogParetoType2_vv_20;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_21> AgradCcdfLogParetoType2_vv_21;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_22> AgradCcdfLogParetoType2_vv_22;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_23> AgradCcdfLogParetoType2_vv_23;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_24> AgradCcdfLogParetoType2_vv_24;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_25> AgradCcdfLogParetoType2_vv_25;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_26> AgradCcdfLogParetoType2_vv_26;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_27> AgradCcdfLogParetoType2_vv_27;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_28> AgradCcdfLogParetoType2_vv_28;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_29> AgradCcdfLogParetoType2_vv_29;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_30> AgradCcdfLogParetoType2_vv_30;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_31> AgradCcdfLogParetoType2_vv_31;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_32> AgradCcdfLogParetoType2_vv_32;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_33> AgradCcdfLogParetoType2_vv_33;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_34> AgradCcdfLogParetoType2_vv_34;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_35> AgradCcdfLogParetoType2_vv_35;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_36> AgradCcdfLogParetoType2_vv_36;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_37> AgradCcdfLogParetoType2_vv_37;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_38> AgradCcdfLogParetoType2_vv_38;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_39> AgradCcdfLogParetoType2_vv_39;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_40> AgradCcdfLogParetoType2_vv_40;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_41> AgradCcdfLogParetoType2_vv_41;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_42> AgradCcdfLogParetoType2_vv_42;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_43> AgradCcdfLogParetoType2_vv_43;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_44> AgradCcdfLogParetoType2_vv_44;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_45> AgradCcdfLogParetoType2_vv_45;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_46> AgradCcdfLogParetoType2_vv_46;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_47> AgradCcdfLogParetoType2_vv_47;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_48> AgradCcdfLogParetoType2_vv_48;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_49> AgradCcdfLogParetoType2_vv_49;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_50> AgradCcdfLogParetoType2_vv_50;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_51> AgradCcdfLogParetoType2_vv_51;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_52> AgradCcdfLogParetoType2_vv_52;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_53> AgradCcdfLogParetoType2_vv_53;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_54> AgradCcdfLogParetoType2_vv_54;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_55> AgradCcdfLogParetoType2_vv_55;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_56> AgradCcdfLogParetoType2_vv_56;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_57> AgradCcdfLogParetoType2_vv_57;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_58> AgradCcdfLogParetoType2_vv_58;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_59> AgradCcdfLogParetoType2_vv_59;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_60> AgradCcdfLogParetoType2_vv_60;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_61> AgradCcdfLogParetoType2_vv_61;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_62> AgradCcdfLogParetoType2_vv_62;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_63> AgradCcdfLogParetoType2_vv_63;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_64> AgradCcdfLogParetoType2_vv_64;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_65> AgradCcdfLogParetoType2_vv_65;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_66> AgradCcdfLogParetoType2_vv_66;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_67> AgradCcdfLogParetoType2_vv_67;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_68> AgradCcdfLogParetoType2_vv_68;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_69> AgradCcdfLogParetoType2_vv_69;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_70> AgradCcdfLogParetoType2_vv_70;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_71> AgradCcdfLogParetoType2_vv_71;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_72> AgradCcdfLogParetoType2_vv_72;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_73> AgradCcdfLogParetoType2_vv_73;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_74> AgradCcdfLogParetoType2_vv_74;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_75> AgradCcdfLogParetoType2_vv_75;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_76> AgradCcdfLogParetoType2_vv_76;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_77> AgradCcdfLogParetoType2_vv_77;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_78> AgradCcdfLogParetoType2_vv_78;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_79> AgradCcdfLogParetoType2_vv_79;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_80> AgradCcdfLogParetoType2_vv_80;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_81> AgradCcdfLogParetoType2_vv_81;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_82> AgradCcdfLogParetoType2_vv_82;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_83> AgradCcdfLogParetoType2_vv_83;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_84> AgradCcdfLogParetoType2_vv_84;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_85> AgradCcdfLogParetoType2_vv_85;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_86> AgradCcdfLogParetoType2_vv_86;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_87> AgradCcdfLogParetoType2_vv_87;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_88> AgradCcdfLogParetoType2_vv_88;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_89> AgradCcdfLogParetoType2_vv_89;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_90> AgradCcdfLogParetoType2_vv_90;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_91> AgradCcdfLogParetoType2_vv_91;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_92> AgradCcdfLogParetoType2_vv_92;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_93> AgradCcdfLogParetoType2_vv_93;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_94> AgradCcdfLogParetoType2_vv_94;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_95> AgradCcdfLogParetoType2_vv_95;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_96> AgradCcdfLogParetoType2_vv_96;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_97> AgradCcdfLogParetoType2_vv_97;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_98> AgradCcdfLogParetoType2_vv_98;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_99> AgradCcdfLogParetoType2_vv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_0, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_1, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_2, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_3, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_4, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_5, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_6, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_7, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_8, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_9, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_10, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_11, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_12, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_13, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_14, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_15, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_16, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_17, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_18, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_19, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_20, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_21, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_22, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_23, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_24, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_25, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_26, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_27, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_28, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_29, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_30, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_31, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_32, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_33, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_34, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_35, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_36, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_37, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_38, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_39, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_40, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_41, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_42, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_43, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_44, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_45, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_46, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_47, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_48, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_49, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_50, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_51, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_52, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_53, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_54, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_55, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_56, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_57, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_58, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_59, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_60, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_61, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_62, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_63, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_64, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_65, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_66, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_67, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_68, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_69, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_70, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_71, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_72, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_73, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_74, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_75, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_76, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_77, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_78, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_79, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_80, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_81, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_82, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_83, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_84, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_85, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_86, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_87, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_88, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_89, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_90, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_91, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_92, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_93, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_94, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_95, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_96, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_97, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_98, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_99, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_99);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_ccdf_log_test.hpp>
+
+typedef std::tuple<double, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_100;
+typedef std::tuple<double, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_101;
+typedef std::tuple<double, fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_102;
+typedef std::tuple<double, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_103;
+typedef std::tuple<double, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_104;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_105;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_106;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_107;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_108;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_109;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_110;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_111;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_112;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_113;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_114;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_115;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_116;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, double, double, empty, empty> type_ffv_117;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty, empty> type_ffv_118;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_119;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty, empty> type_ffv_120;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_121;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_122;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty, empty> type_ffv_123;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_124;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_125;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_126;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_127;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_128;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_129;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_130;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_131;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_132;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_133;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_134;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty, empty> type_ffv_135;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_136;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_137;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_138;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_139;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_140;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_141;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_142;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_143;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_144;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_145;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_146;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_147;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_148;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_149;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_150;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_151;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_152;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty, empty> type_ffv_153;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_ffv_154;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_155;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_156;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_157;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_158;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_ffv_159;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_160;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_161;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_162;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_163;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_164;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_165;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_166;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_167;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_168;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_169;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_170;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_171;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_172;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_173;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_174;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_175;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_176;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_177;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_178;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_179;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_180;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_181;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_182;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_183;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_184;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_185;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_186;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_187;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_188;
+typedef std::tuple<std::vector<double>, double, double, fvar<fvar<var> >, empty, empty> type_ffv_189;
+typedef std::tuple<std::vector<double>, double, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_190;
+typedef std::tuple<std::vector<double>, double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_191;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_192;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_193;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_194;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_195;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_196;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_197;
+typedef std::tuple<std::vector<double>, double, fvar<fvar<var> >, double, empty, empty> type_ffv_198;
+typedef std::tuple<std::vector<double>, double, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_199;
+
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_100> AgradCcdfLogParetoType2_ffv_100;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_101> AgradCcdfLogParetoType2_ffv_101;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_102> AgradCcdfLogParetoType2_ffv_102;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_103> AgradCcdfLogParetoType2_ffv_103;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_104> AgradCcdfLogParetoType2_ffv_104;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_105> AgradCcdfLogParetoType2_ffv_105;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_106> AgradCcdfLogParetoType2_ffv_106;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_107> AgradCcdfLogParetoType2_ffv_107;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_108> AgradCcdfLogParetoType2_ffv_108;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_109> AgradCcdfLogParetoType2_ffv_109;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_110> AgradCcdfLogParetoType2_ffv_110;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_111> AgradCcdfLogParetoType2_ffv_111;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_112> AgradCcdfLogParetoType2_ffv_112;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_113> AgradCcdfLogParetoType2_ffv_113;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_114> AgradCcdfLogParetoType2_ffv_114;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_115> AgradCcdfLogParetoType2_ffv_115;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_116> AgradCcdfLogParetoType2_ffv_116;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_117> AgradCcdfLogParetoType2_ffv_117;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_118> AgradCcdfLogParetoType2_ffv_118;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_119> AgradCcdfLogParetoType2_ffv_119;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_120> AgradCcdfLogParetoType2_ffv_120;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_121> AgradCcdfLogParetoType2_ffv_121;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_122> AgradCcdfLogParetoType2_ffv_122;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_123> AgradCcdfLogParetoType2_ffv_123;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_124> AgradCcdfLogParetoType2_ffv_124;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_125> AgradCcdfLogParetoType2_ffv_125;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_126> AgradCcdfLogParetoType2_ffv_126;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_127> AgradCcdfLogParetoType2_ffv_127;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_128> AgradCcdfLogParetoType2_ffv_128;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_129> AgradCcdfLogParetoType2_ffv_129;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_130> AgradCcdfLogParetoType2_ffv_130;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_131> AgradCcdfLogParetoType2_ffv_131;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_132> AgradCcdfLogParetoType2_ffv_132;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_133> AgradCcdfLogParetoType2_ffv_133;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_134> AgradCcdfLogParetoType2_ffv_134;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_135> AgradCcdfLogParetoType2_ffv_135;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_136> AgradCcdfLogParetoType2_ffv_136;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_137> AgradCcdfLogParetoType2_ffv_137;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_138> AgradCcdfLogParetoType2_ffv_138;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_139> AgradCcdfLogParetoType2_ffv_139;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_140> AgradCcdfLogParetoType2_ffv_140;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_141> AgradCcdfLogParetoType2_ffv_141;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_142> AgradCcdfLogParetoType2_ffv_142;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_143> AgradCcdfLogParetoType2_ffv_143;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_144> AgradCcdfLogParetoType2_ffv_144;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_145> AgradCcdfLogParetoType2_ffv_145;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_146> AgradCcdfLogParetoType2_ffv_146;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_147> AgradCcdfLogParetoType2_ffv_147;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_148> AgradCcdfLogParetoType2_ffv_148;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_149> AgradCcdfLogParetoType2_ffv_149;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_150> AgradCcdfLogParetoType2_ffv_150;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_151> AgradCcdfLogParetoType2_ffv_151;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_152> AgradCcdfLogParetoType2_ffv_152;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_153> AgradCcdfLogParetoType2_ffv_153;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_154> AgradCcdfLogParetoType2_ffv_154;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_155> AgradCcdfLogParetoType2_ffv_155;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_156> AgradCcdfLogParetoType2_ffv_156;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_157> AgradCcdfLogParetoType2_ffv_157;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_158> AgradCcdfLogParetoType2_ffv_158;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_159> AgradCcdfLogParetoType2_ffv_159;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_160> AgradCcdfLogParetoType2_ffv_160;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_161> AgradCcdfLogParetoType2_ffv_161;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_162> AgradCcdfLogParetoType2_ffv_162;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_163> AgradCcdfLogParetoType2_ffv_163;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_164> AgradCcdfLogParetoType2_ffv_164;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_165> AgradCcdfLogParetoType2_ffv_165;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_166> AgradCcdfLogParetoType2_ffv_166;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_167> AgradCcdfLogParetoType2_ffv_167;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_168> AgradCcdfLogParetoType2_ffv_168;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_169> AgradCcdfLogParetoType2_ffv_169;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_170> AgradCcdfLogParetoType2_ffv_170;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_171> AgradCcdfLogParetoType2_ffv_171;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_172> AgradCcdfLogParetoType2_ffv_172;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_173> AgradCcdfLogParetoType2_ffv_173;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_174> AgradCcdfLogParetoType2_ffv_174;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_175> AgradCcdfLogParetoType2_ffv_175;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_176> AgradCcdfLogParetoType2_ffv_176;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_177> AgradCcdfLogParetoType2_ffv_177;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_178> AgradCcdfLogParetoType2_ffv_178;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_179> AgradCcdfLogParetoType2_ffv_179;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_180> AgradCcdfLogParetoType2_ffv_180;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_181> AgradCcdfLogParetoType2_ffv_181;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_182> AgradCcdfLogParetoType2_ffv_182;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_183> AgradCcdfLogParetoType2_ffv_183;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_184> AgradCcdfLogParetoType2_ffv_184;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_185> AgradCcdfLogParetoType2_ffv_185;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_186> AgradCcdfLogParetoType2_ffv_186;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_187> AgradCcdfLogParetoType2_ffv_187;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_188> AgradCcdfLogParetoType2_ffv_188;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_189> AgradCcdfLogParetoType2_ffv_189;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_190> AgradCcdfLogParetoType2_ffv_190;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_191> AgradCcdfLogParetoType2_ffv_191;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_192> AgradCcdfLogParetoType2_ffv_192;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_193> AgradCcdfLogParetoType2_ffv_193;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_194> AgradCcdfLogParetoType2_ffv_194;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_195> AgradCcdfLogParetoType2_ffv_195;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_196> AgradCcdfLogParetoType2_ffv_196;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_197> AgradCcdfLogParetoType2_ffv_197;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_198> AgradCcdfLogParetoType2_ffv_198;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_199> AgradCcdfLogParetoType2_ffv_199;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_100, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_101, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_102, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_103, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_104, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_105, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_106, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_107, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_108, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_109, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_110, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_111, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_112, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_113, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_114, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_115, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_116, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_117, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_118, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_119, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_120, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_121, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_122, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_123, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_124, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_125, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_126, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_127, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_128, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_129, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_130, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_131, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_132, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_133, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_134, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_135, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_136, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_137, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_138, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_139, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_140, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_141, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_142, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_143, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_144, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_145, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_146, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_147, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_148, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_149, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_150, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_151, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_152, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_153, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_154, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_155, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_156, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_157, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_158, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_159, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_160, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_161, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_162, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_163, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_164, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_165, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_166, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_167, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_168, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_169, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_170, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_171, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_172, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_173, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_174, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_175, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_176, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_177, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_178, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_179, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_180, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_181, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_182, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_183, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_184, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_185, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_186, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_187, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_188, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_188);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_189, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_189);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_190, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_190);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_191, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_191);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_192, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_192);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_193, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_193);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_194, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_194);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_195, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_195);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_196, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_196);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_197, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_197);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_198, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_198);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_199, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_199);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_ccdf_log_test.hpp>
+
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_100;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_101;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_102;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_103;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_104;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_105;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_106;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_107;
+typedef std::tuple<double, var, double, double, empty, empty> type_v_108;
+typedef std::tuple<double, var, double, std::vector<double>, empty, empty> type_v_109;
+typedef std::tuple<double, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_110;
+typedef std::tuple<double, var, double, var, empty, empty> type_v_111;
+typedef std::tuple<double, var, double, std::vector<var>, empty, empty> type_v_112;
+typedef std::tuple<double, var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_113;
+typedef std::tuple<double, var, std::vector<double>, double, empty, empty> type_v_114;
+typedef std::tuple<double, var, std::vector<double>, std::vector<double>, empty, empty> type_v_115;
+typedef std::tuple<double, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_116;
+typedef std::tuple<double, var, std::vector<double>, var, empty, empty> type_v_117;
+typedef std::tuple<double, var, std::vector<double>, std::vector<var>, empty, empty> type_v_118;
+typedef std::tuple<double, var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_119;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_120;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_121;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_122;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_123;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_124;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_125;
+typedef std::tuple<double, var, var, double, empty, empty> type_v_126;
+typedef std::tuple<double, var, var, std::vector<double>, empty, empty> type_v_127;
+typedef std::tuple<double, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_128;
+typedef std::tuple<double, var, var, var, empty, empty> type_v_129;
+typedef std::tuple<double, var, var, std::vector<var>, empty, empty> type_v_130;
+typedef std::tuple<double, var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_131;
+typedef std::tuple<double, var, std::vector<var>, double, empty, empty> type_v_132;
+typedef std::tuple<double, var, std::vector<var>, std::vector<double>, empty, empty> type_v_133;
+typedef std::tuple<double, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_134;
+typedef std::tuple<double, var, std::vector<var>, var, empty, empty> type_v_135;
+typedef std::tuple<double, var, std::vector<var>, std::vector<var>, empty, empty> type_v_136;
+typedef std::tuple<double, var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_137;
+typedef std::tuple<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_138;
+typedef std::tuple<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_139;
+typedef std::tuple<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_140;
+typedef std::tuple<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_141;
+typedef std::tuple<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_142;
+typedef std::tuple<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_143;
+typedef std::tuple<double, std::vector<var>, double, double, empty, empty> type_v_144;
+typedef std::tuple<double, std::vector<var>, double, std::vector<double>, empty, empty> type_v_145;
+typedef std::tuple<double, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_146;
+typedef std::tuple<double, std::vector<var>, double, var, empty, empty> type_v_147;
+typedef std::tuple<double, std::vector<var>, double, std::vector<var>, empty, empty> type_v_148;
+typedef std::tuple<double, std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_149;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, double, empty, empty> type_v_150;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_v_151;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_152;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, var, empty, empty> type_v_153;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_v_154;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_155;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_156;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_157;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_158;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_159;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_160;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_161;
+typedef std::tuple<double, std::vector<var>, var, double, empty, empty> type_v_162;
+typedef std::tuple<double, std::vector<var>, var, std::vector<double>, empty, empty> type_v_163;
+typedef std::tuple<double, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_164;
+typedef std::tuple<double, std::vector<var>, var, var, empty, empty> type_v_165;
+typedef std::tuple<double, std::vector<var>, var, std::vector<var>, empty, empty> type_v_166;
+typedef std::tuple<double, std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_167;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, double, empty, empty> type_v_168;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_v_169;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_170;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, var, empty, empty> type_v_171;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_v_172;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_173;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_174;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_175;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_176;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_177;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_178;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_179;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_180;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_181;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_182;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_183;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_184;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_185;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_186;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_187;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_188;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_189;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_190;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_191;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_192;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_193;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_194;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_195;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_196;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_197;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_198;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_199;
+
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_100> AgradCcdfLogParetoType2_v_100;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_101> AgradCcdfLogParetoType2_v_101;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_102> AgradCcdfLogParetoType2_v_102;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_103> AgradCcdfLogParetoType2_v_103;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_104> AgradCcdfLogParetoType2_v_104;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_105> AgradCcdfLogParetoType2_v_105;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_106> AgradCcdfLogParetoType2_v_106;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_107> AgradCcdfLogParetoType2_v_107;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_108> AgradCcdfLogParetoType2_v_108;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_109> AgradCcdfLogParetoType2_v_109;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_110> AgradCcdfLogParetoType2_v_110;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_111> AgradCcdfLogParetoType2_v_111;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_112> AgradCcdfLogParetoType2_v_112;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_113> AgradCcdfLogParetoType2_v_113;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_114> AgradCcdfLogParetoType2_v_114;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_115> AgradCcdfLogParetoType2_v_115;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_116> AgradCcdfLogParetoType2_v_116;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_117> AgradCcdfLogParetoType2_v_117;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_118> AgradCcdfLogParetoType2_v_118;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_119> AgradCcdfLogParetoType2_v_119;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_120> AgradCcdfLogParetoType2_v_120;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_121> AgradCcdfLogParetoType2_v_121;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_122> AgradCcdfLogParetoType2_v_122;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_123> AgradCcdfLogParetoType2_v_123;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_124> AgradCcdfLogParetoType2_v_124;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_125> AgradCcdfLogParetoType2_v_125;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_126> AgradCcdfLogParetoType2_v_126;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_127> AgradCcdfLogParetoType2_v_127;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_128> AgradCcdfLogParetoType2_v_128;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_129> AgradCcdfLogParetoType2_v_129;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_130> AgradCcdfLogParetoType2_v_130;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_131> AgradCcdfLogParetoType2_v_131;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_132> AgradCcdfLogParetoType2_v_132;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_133> AgradCcdfLogParetoType2_v_133;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_134> AgradCcdfLogParetoType2_v_134;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_135> AgradCcdfLogParetoType2_v_135;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_136> AgradCcdfLogParetoType2_v_136;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_137> AgradCcdfLogParetoType2_v_137;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_138> AgradCcdfLogParetoType2_v_138;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_139> AgradCcdfLogParetoType2_v_139;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_140> AgradCcdfLogParetoType2_v_140;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_141> AgradCcdfLogParetoType2_v_141;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_142> AgradCcdfLogParetoType2_v_142;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_143> AgradCcdfLogParetoType2_v_143;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_144> AgradCcdfLogParetoType2_v_144;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_145> AgradCcdfLogParetoType2_v_145;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_146> AgradCcdfLogParetoType2_v_146;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_147> AgradCcdfLogParetoType2_v_147;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_148> AgradCcdfLogParetoType2_v_148;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_149> AgradCcdfLogParetoType2_v_149;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_150> AgradCcdfLogParetoType2_v_150;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_151> AgradCcdfLogParetoType2_v_151;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_152> AgradCcdfLogParetoType2_v_152;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_153> AgradCcdfLogParetoType2_v_153;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_154> AgradCcdfLogParetoType2_v_154;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_155> AgradCcdfLogParetoType2_v_155;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_156> AgradCcdfLogParetoType2_v_156;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_157> AgradCcdfLogParetoType2_v_157;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_158> AgradCcdfLogParetoType2_v_158;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_159> AgradCcdfLogParetoType2_v_159;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_160> AgradCcdfLogParetoType2_v_160;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_161> AgradCcdfLogParetoType2_v_161;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_162> AgradCcdfLogParetoType2_v_162;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_163> AgradCcdfLogParetoType2_v_163;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_164> AgradCcdfLogParetoType2_v_164;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_165> AgradCcdfLogParetoType2_v_165;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_166> AgradCcdfLogParetoType2_v_166;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_167> AgradCcdfLogParetoType2_v_167;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_168> AgradCcdfLogParetoType2_v_168;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_169> AgradCcdfLogParetoType2_v_169;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_170> AgradCcdfLogParetoType2_v_170;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_171> AgradCcdfLogParetoType2_v_171;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_172> AgradCcdfLogParetoType2_v_172;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_173> AgradCcdfLogParetoType2_v_173;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_174> AgradCcdfLogParetoType2_v_174;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_175> AgradCcdfLogParetoType2_v_175;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_176> AgradCcdfLogParetoType2_v_176;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_177> AgradCcdfLogParetoType2_v_177;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_178> AgradCcdfLogParetoType2_v_178;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_179> AgradCcdfLogParetoType2_v_179;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_180> AgradCcdfLogParetoType2_v_180;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_181> AgradCcdfLogParetoType2_v_181;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_182> AgradCcdfLogParetoType2_v_182;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_183> AgradCcdfLogParetoType2_v_183;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_184> AgradCcdfLogParetoType2_v_184;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_185> AgradCcdfLogParetoType2_v_185;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_186> AgradCcdfLogParetoType2_v_186;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_187> AgradCcdfLogParetoType2_v_187;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_188> AgradCcdfLogParetoType2_v_188;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_189> AgradCcdfLogParetoType2_v_189;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_190> AgradCcdfLogParetoType2_v_190;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_191> AgradCcdfLogParetoType2_v_191;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_192> AgradCcdfLogParetoType2_v_192;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_193> AgradCcdfLogParetoType2_v_193;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_194> AgradCcdfLogParetoType2_v_194;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_195> AgradCcdfLogParetoType2_v_195;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_196> AgradCcdfLogParetoType2_v_196;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_197> AgradCcdfLogParetoType2_v_197;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_198> AgradCcdfLogParetoType2_v_198;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_199> AgradCcdfLogParetoType2_v_199;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_100, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_101, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_102, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_103, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_104, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_105, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_106, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_107, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_108, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_109, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_110, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_111, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_112, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_113, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_114, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_115, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_116, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_117, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_118, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_119, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_120, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_121, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_122, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_123, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_124, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_125, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_126, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_127, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_128, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_129, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_130, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_131, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_132, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_133, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_134, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_135, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_136, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_137, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_138, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_139, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_140, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_141, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_142, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_143, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_144, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_145, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_146, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_147, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_148, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_149, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_150, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_151, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_152, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_153, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_154, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_155, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_156, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_157, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_158, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_159, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_160, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_161, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_162, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_163, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_164, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_165, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_166, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_167, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_168, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_169, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_170, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_171, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_172, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_173, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_174, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_175, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_176, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_177, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_178, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_179, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_180, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_181, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_182, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_183, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_184, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_185, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_186, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_187, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_188, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_188);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_189, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_189);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_190, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_190);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_191, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_191);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_192, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_192);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_193, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_193);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_194, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_194);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_195, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_195);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_196, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_196);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_197, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_197);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_198, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_198);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_199, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_199);
+
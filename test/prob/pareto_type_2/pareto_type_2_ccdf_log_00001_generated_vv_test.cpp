@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_ccdf_log_test.hpp>
+
+typedef std::tuple<double, var, var, std::vector<double>, empty, empty> type_vv_100;
+typedef std::tuple<double, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_101;
+typedef std::tuple<double, var, var, var, empty, empty> type_vv_102;
+typedef std::tuple<double, var, var, std::vector<var>, empty, empty> type_vv_103;
+typedef std::tuple<double, var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_104;
+typedef std::tuple<double, var, std::vector<var>, double, empty, empty> type_vv_105;
+typedef std::tuple<double, var, std::vector<var>, std::vector<double>, empty, empty> type_vv_106;
+typedef std::tuple<double, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_107;
+typedef std::tuple<double, var, std::vector<var>, var, empty, empty> type_vv_108;
+typedef std::tuple<double, var, std::vector<var>, std::vector<var>, empty, empty> type_vv_109;
+typedef std::tuple<double, var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_110;
+typedef std::tuple<double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_111;
+typedef std::tuple<double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_112;
+typedef std::tuple<double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_113;
+typedef std::tuple<double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_114;
+typedef std::tuple<double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_115;
+typedef std::tuple<double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_116;
+typedef std::tuple<double, std::vector<var>, double, double, empty, empty> type_vv_117;
+typedef std::tuple<double, std::vector<var>, double, std::vector<double>, empty, empty> type_vv_118;
+typedef std::tuple<double, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_119;
+typedef std::tuple<double, std::vector<var>, double, var, empty, empty> type_vv_120;
+typedef std::tuple<double, std::vector<var>, double, std::vector<var>, empty, empty> type_vv_121;
+typedef std::tuple<double, std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_122;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, double, empty, empty> type_vv_123;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_vv_124;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_125;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, var, empty, empty> type_vv_126;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_vv_127;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_128;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_129;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_130;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_131;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_132;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_133;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_134;
+typedef std::tuple<double, std::vector<var>, var, double, empty, empty> type_vv_135;
+typedef std::tuple<double, std::vector<var>, var, std::vector<double>, empty, empty> type_vv_136;
+typedef std::tuple<double, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_137;
+typedef std::tuple<double, std::vector<var>, var, var, empty, empty> type_vv_138;
+typedef std::tuple<double, std::vector<var>, var, std::vector<var>, empty, empty> type_vv_139;
+typedef std::tuple<double, std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_140;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, double, empty, empty> type_vv_141;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_vv_142;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_143;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, var, empty, empty> type_vv_144;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_vv_145;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_146;
+typedef std::tuple<double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_147;
+typedef std::tuple<double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_148;
+typedef std::tuple<double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_149;
+typedef std::tuple<double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_150;
+typedef std::tuple<double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_151;
+typedef std::tuple<double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_152;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, empty, empty> type_vv_153;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, empty, empty> type_vv_154;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_155;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, empty, empty> type_vv_156;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, empty, empty> type_vv_157;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_158;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, empty, empty> type_vv_159;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, empty, empty> type_vv_160;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_161;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, empty, empty> type_vv_162;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, empty, empty> type_vv_163;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_164;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_165;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_166;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_167;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_168;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_169;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_170;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, empty, empty> type_vv_171;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, empty, empty> type_vv_172;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_173;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, empty, empty> type_vv_174;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, empty, empty> type_vv_175;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_176;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, empty, empty> type_vv_177;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, empty, empty> type_vv_178;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_179;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, empty, empty> type_vv_180;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, empty, empty> type_vv_181;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_182;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_183;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_184;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_185;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_186;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_187;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_188;
+typedef std::tuple<std::vector<double>, double, double, var, empty, empty> type_vv_189;
+typedef std::tuple<std::vector<double>, double, double, std::vector<var>, empty, empty> type_vv_190;
+typedef std::tuple<std::vector<double>, double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_191;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, var, empty, empty> type_vv_192;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, std::vector<var>, empty, empty> type_vv_193;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_194;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_195;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_196;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_197;
+typedef std::tuple<std::vector<double>, double, var, double, empty, empty> type_vv_198;
+typedef std::tuple<std::vector<double>, double, var, std::vector<double>, empty, empty> type_vv_199;
+
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_100> AgradCcdfLogParetoType2_vv_100;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_101> AgradCcdfLogParetoType2_vv_101;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_102> AgradCcdfLogParetoType2_vv_102;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_103> AgradCcdfLogParetoType2_vv_103;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_104> AgradCcdfLogParetoType2_vv_104;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_105> AgradCcdfLogParetoType2_vv_105;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_106> AgradCcdfLogParetoType2_vv_106;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_107> AgradCcdfLogParetoType2_vv_107;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_108> AgradCcdfLogParetoType2_vv_108;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_109> AgradCcdfLogParetoType2_vv_109;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_110> AgradCcdfLogParetoType2_vv_110;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_111> AgradCcdfLogParetoType2_vv_111;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_112> AgradCcdfLogParetoType2_vv_112;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_113> AgradCcdfLogParetoType2_vv_113;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_114> AgradCcdfLogParetoType2_vv_114;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_115> AgradCcdfLogParetoType2_vv_115;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_116> AgradCcdfLogParetoType2_vv_116;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_117> AgradCcdfLogParetoType2_vv_117;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_118> AgradCcdfLogParetoType2_vv_118;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_119> AgradCcdfLogParetoType2_vv_119;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_120> AgradCcdfLogParetoType2_vv_120;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_121> AgradCcdfLogParetoType2_vv_121;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_122> AgradCcdfLogParetoType2_vv_122;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_123> AgradCcdfLogParetoType2_vv_123;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_124> AgradCcdfLogParetoType2_vv_124;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_125> AgradCcdfLogParetoType2_vv_125;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_126> AgradCcdfLogParetoType2_vv_126;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_127> AgradCcdfLogParetoType2_vv_127;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_128> AgradCcdfLogParetoType2_vv_128;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_129> AgradCcdfLogParetoType2_vv_129;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_130> AgradCcdfLogParetoType2_vv_130;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_131> AgradCcdfLogParetoType2_vv_131;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_132> AgradCcdfLogParetoType2_vv_132;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_133> AgradCcdfLogParetoType2_vv_133;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_134> AgradCcdfLogParetoType2_vv_134;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_135> AgradCcdfLogParetoType2_vv_135;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_136> AgradCcdfLogParetoType2_vv_136;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_137> AgradCcdfLogParetoType2_vv_137;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_138> AgradCcdfLogParetoType2_vv_138;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_139> AgradCcdfLogParetoType2_vv_139;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_140> AgradCcdfLogParetoType2_vv_140;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_141> AgradCcdfLogParetoType2_vv_141;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_142> AgradCcdfLogParetoType2_vv_142;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_143> AgradCcdfLogParetoType2_vv_143;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_144> AgradCcdfLogParetoType2_vv_144;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_145> AgradCcdfLogParetoType2_vv_145;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_146> AgradCcdfLogParetoType2_vv_146;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_147> AgradCcdfLogParetoType2_vv_147;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_148> AgradCcdfLogParetoType2_vv_148;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_149> AgradCcdfLogParetoType2_vv_149;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_150> AgradCcdfLogParetoType2_vv_150;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_151> AgradCcdfLogParetoType2_vv_151;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_152> AgradCcdfLogParetoType2_vv_152;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_153> AgradCcdfLogParetoType2_vv_153;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_154> AgradCcdfLogParetoType2_vv_154;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_155> AgradCcdfLogParetoType2_vv_155;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_156> AgradCcdfLogParetoType2_vv_156;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_157> AgradCcdfLogParetoType2_vv_157;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_158> AgradCcdfLogParetoType2_vv_158;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_159> AgradCcdfLogParetoType2_vv_159;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_160> AgradCcdfLogParetoType2_vv_160;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_161> AgradCcdfLogParetoType2_vv_161;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_162> AgradCcdfLogParetoType2_vv_162;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_163> AgradCcdfLogParetoType2_vv_163;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_164> AgradCcdfLogParetoType2_vv_164;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_165> AgradCcdfLogParetoType2_vv_165;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_166> AgradCcdfLogParetoType2_vv_166;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_167> AgradCcdfLogParetoType2_vv_167;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_168> AgradCcdfLogParetoType2_vv_168;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_169> AgradCcdfLogParetoType2_vv_169;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_170> AgradCcdfLogParetoType2_vv_170;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_171> AgradCcdfLogParetoType2_vv_171;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_172> AgradCcdfLogParetoType2_vv_172;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_173> AgradCcdfLogParetoType2_vv_173;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_174> AgradCcdfLogParetoType2_vv_174;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_175> AgradCcdfLogParetoType2_vv_175;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_176> AgradCcdfLogParetoType2_vv_176;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_177> AgradCcdfLogParetoType2_vv_177;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_178> AgradCcdfLogParetoType2_vv_178;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_179> AgradCcdfLogParetoType2_vv_179;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_180> AgradCcdfLogParetoType2_vv_180;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_181> AgradCcdfLogParetoType2_vv_181;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_182> AgradCcdfLogParetoType2_vv_182;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_183> AgradCcdfLogParetoType2_vv_183;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_184> AgradCcdfLogParetoType2_vv_184;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_185> AgradCcdfLogParetoType2_vv_185;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_186> AgradCcdfLogParetoType2_vv_186;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_187> AgradCcdfLogParetoType2_vv_187;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_188> AgradCcdfLogParetoType2_vv_188;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_189> AgradCcdfLogParetoType2_vv_189;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_190> AgradCcdfLogParetoType2_vv_190;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_191> AgradCcdfLogParetoType2_vv_191;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_192> AgradCcdfLogParetoType2_vv_192;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_193> AgradCcdfLogParetoType2_vv_193;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_194> AgradCcdfLogParetoType2_vv_194;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_195> AgradCcdfLogParetoType2_vv_195;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_196> AgradCcdfLogParetoType2_vv_196;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_197> AgradCcdfLogParetoType2_vv_197;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_198> AgradCcdfLogParetoType2_vv_198;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_199> AgradCcdfLogParetoType2_vv_199;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_100, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_101, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_102, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_103, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_104, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_105, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_106, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_107, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_108, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_109, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_110, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_111, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_112, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_113, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_114, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_115, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_116, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_117, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_118, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_119, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_120, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_121, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_122, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_123, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_124, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_125, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_126, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_127, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_128, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_129, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_130, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_131, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_132, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_133, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_134, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_135, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_136, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_137, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_138, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_139, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_140, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_141, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_142, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_143, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_144, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_145, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_146, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_147, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_148, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_149, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_150, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_151, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_152, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_153, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_154, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_155, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_156, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_157, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_158, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_159, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_160, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_161, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_162, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_163, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_164, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_165, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_166, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_167, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_168, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_169, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_170, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_171, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_172, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_173, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_174, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_175, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_176, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_177, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_178, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_179, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_180, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_181, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_182, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_183, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_184, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_185, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_186, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_187, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_188, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_188);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_189, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_189);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_190, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_190);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_191, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_191);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_192, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_192);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_193, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_193);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_194, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_194);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_195, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_195);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_196, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_196);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_197, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_197);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_198, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_198);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_199, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_199);
+
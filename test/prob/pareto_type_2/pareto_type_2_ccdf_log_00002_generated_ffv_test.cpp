@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_ccdf_log_test.hpp>
+
+typedef std::tuple<std::vector<double>, double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_200;
+typedef std::tuple<std::vector<double>, double, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_201;
+typedef std::tuple<std::vector<double>, double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_202;
+typedef std::tuple<std::vector<double>, double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_203;
+typedef std::tuple<std::vector<double>, double, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_204;
+typedef std::tuple<std::vector<double>, double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_205;
+typedef std::tuple<std::vector<double>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_206;
+typedef std::tuple<std::vector<double>, double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_207;
+typedef std::tuple<std::vector<double>, double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_208;
+typedef std::tuple<std::vector<double>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_209;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_210;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_211;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_212;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_213;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_214;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_215;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, fvar<fvar<var> >, empty, empty> type_ffv_216;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_217;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_218;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_219;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_220;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_221;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_222;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_223;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_224;
+typedef std::tuple<std::vector<double>, std::vector<double>, fvar<fvar<var> >, double, empty, empty> type_ffv_225;
+typedef std::tuple<std::vector<double>, std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_226;
+typedef std::tuple<std::vector<double>, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_227;
+typedef std::tuple<std::vector<double>, std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_228;
+typedef std::tuple<std::vector<double>, std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_229;
+typedef std::tuple<std::vector<double>, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_230;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_231;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_232;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_233;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_234;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_235;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_236;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_237;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_238;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_239;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_240;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_241;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_242;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_243;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_244;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_245;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_246;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_247;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_248;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_249;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_250;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_251;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_252;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_253;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_254;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_255;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_256;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_257;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_258;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_259;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_260;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_261;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_262;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_263;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_264;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_265;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_266;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_267;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_268;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_269;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, double, double, empty, empty> type_ffv_270;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, double, std::vector<double>, empty, empty> type_ffv_271;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_272;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, double, fvar<fvar<var> >, empty, empty> type_ffv_273;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_274;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_275;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<double>, double, empty, empty> type_ffv_276;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty, empty> type_ffv_277;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_278;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_279;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_280;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_281;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_282;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_283;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_284;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_285;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_286;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_287;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, double, empty, empty> type_ffv_288;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_289;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_290;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_291;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_292;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_293;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_294;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_295;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_296;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_297;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_298;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_299;
+
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_200> AgradCcdfLogParetoType2_ffv_200;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_201> AgradCcdfLogParetoType2_ffv_201;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_202> AgradCcdfLogParetoType2_ffv_202;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_203> AgradCcdfLogParetoType2_ffv_203;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_204> AgradCcdfLogParetoType2_ffv_204;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_205> AgradCcdfLogParetoType2_ffv_205;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_206> AgradCcdfLogParetoType2_ffv_206;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_207> AgradCcdfLogParetoType2_ffv_207;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_208> AgradCcdfLogParetoType2_ffv_208;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_209> AgradCcdfLogParetoType2_ffv_209;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_210> AgradCcdfLogParetoType2_ffv_210;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_211> AgradCcdfLogParetoType2_ffv_211;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_212> AgradCcdfLogParetoType2_ffv_212;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_213> AgradCcdfLogParetoType2_ffv_213;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_214> AgradCcdfLogParetoType2_ffv_214;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_215> AgradCcdfLogParetoType2_ffv_215;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_216> AgradCcdfLogParetoType2_ffv_216;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_217> AgradCcdfLogParetoType2_ffv_217;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_218> AgradCcdfLogParetoType2_ffv_218;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_219> AgradCcdfLogParetoType2_ffv_219;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_220> AgradCcdfLogParetoType2_ffv_220;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_221> AgradCcdfLogParetoType2_ffv_221;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_222> AgradCcdfLogParetoType2_ffv_222;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_223> AgradCcdfLogParetoType2_ffv_223;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_224> AgradCcdfLogParetoType2_ffv_224;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_225> AgradCcdfLogParetoType2_ffv_225;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_226> AgradCcdfLogParetoType2_ffv_226;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_227> AgradCcdfLogParetoType2_ffv_227;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_228> AgradCcdfLogParetoType2_ffv_228;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_229> AgradCcdfLogParetoType2_ffv_229;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_230> AgradCcdfLogParetoType2_ffv_230;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_231> AgradCcdfLogParetoType2_ffv_231;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_232> AgradCcdfLogParetoType2_ffv_232;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_233> AgradCcdfLogParetoType2_ffv_233;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_234> AgradCcdfLogParetoType2_ffv_234;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_235> AgradCcdfLogParetoType2_ffv_235;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_236> AgradCcdfLogParetoType2_ffv_236;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_237> AgradCcdfLogParetoType2_ffv_237;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_238> AgradCcdfLogParetoType2_ffv_238;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_239> AgradCcdfLogParetoType2_ffv_239;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_240> AgradCcdfLogParetoType2_ffv_240;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_241> AgradCcdfLogParetoType2_ffv_241;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_242> AgradCcdfLogParetoType2_ffv_242;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_243> AgradCcdfLogParetoType2_ffv_243;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_244> AgradCcdfLogParetoType2_ffv_244;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_245> AgradCcdfLogParetoType2_ffv_245;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_246> AgradCcdfLogParetoType2_ffv_246;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_247> AgradCcdfLogParetoType2_ffv_247;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_248> AgradCcdfLogParetoType2_ffv_248;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_249> AgradCcdfLogParetoType2_ffv_249;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_250> AgradCcdfLogParetoType2_ffv_250;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_251> AgradCcdfLogParetoType2_ffv_251;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_252> AgradCcdfLogParetoType2_ffv_252;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_253> AgradCcdfLogParetoType2_ffv_253;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_254> AgradCcdfLogParetoType2_ffv_254;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_255> AgradCcdfLogParetoType2_ffv_255;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_256> AgradCcdfLogParetoType2_ffv_256;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_257> AgradCcdfLogParetoType2_ffv_257;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_258> AgradCcdfLogParetoType2_ffv_258;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_259> AgradCcdfLogParetoType2_ffv_259;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_260> AgradCcdfLogParetoType2_ffv_260;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_261> AgradCcdfLogParetoType2_ffv_261;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_262> AgradCcdfLogParetoType2_ffv_262;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_263> AgradCcdfLogParetoType2_ffv_263;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_264> AgradCcdfLogParetoType2_ffv_264;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_265> AgradCcdfLogParetoType2_ffv_265;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_266> AgradCcdfLogParetoType2_ffv_266;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_267> AgradCcdfLogParetoType2_ffv_267;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_268> AgradCcdfLogParetoType2_ffv_268;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_269> AgradCcdfLogParetoType2_ffv_269;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_270> AgradCcdfLogParetoType2_ffv_270;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_271> AgradCcdfLogParetoType2_ffv_271;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_272> AgradCcdfLogParetoType2_ffv_272;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_273> AgradCcdfLogParetoType2_ffv_273;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_274> AgradCcdfLogParetoType2_ffv_274;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_275> AgradCcdfLogParetoType2_ffv_275;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_276> AgradCcdfLogParetoType2_ffv_276;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_277> AgradCcdfLogParetoType2_ffv_277;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_278> AgradCcdfLogParetoType2_ffv_278;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_279> AgradCcdfLogParetoType2_ffv_279;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_280> AgradCcdfLogParetoType2_ffv_280;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_281> AgradCcdfLogParetoType2_ffv_281;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_282> AgradCcdfLogParetoType2_ffv_282;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_283> AgradCcdfLogParetoType2_ffv_283;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_284> AgradCcdfLogParetoType2_ffv_284;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_285> AgradCcdfLogParetoType2_ffv_285;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_286> AgradCcdfLogParetoType2_ffv_286;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_287> AgradCcdfLogParetoType2_ffv_287;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_288> AgradCcdfLogParetoType2_ffv_288;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_289> AgradCcdfLogParetoType2_ffv_289;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_290> AgradCcdfLogParetoType2_ffv_290;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_291> AgradCcdfLogParetoType2_ffv_291;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_292> AgradCcdfLogParetoType2_ffv_292;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_293> AgradCcdfLogParetoType2_ffv_293;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_294> AgradCcdfLogParetoType2_ffv_294;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_295> AgradCcdfLogParetoType2_ffv_295;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_296> AgradCcdfLogParetoType2_ffv_296;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_297> AgradCcdfLogParetoType2_ffv_297;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_298> AgradCcdfLogParetoType2_ffv_298;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_299> AgradCcdfLogParetoType2_ffv_299;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_200, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_200);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_201, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_201);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_202, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_202);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_203, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_203);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_204, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_204);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_205, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_205);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_206, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_206);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_207, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_207);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_208, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_208);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_209, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_209);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_210, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_210);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_211, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_211);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_212, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_212);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_213, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_213);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_214, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_214);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_215, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_215);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_216, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_216);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_217, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_217);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_218, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_218);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_219, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_219);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_220, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_220);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_221, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_221);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_222, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_222);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_223, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_223);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_224, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_224);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_225, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_225);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_226, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_226);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_227, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_227);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_228, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_228);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_229, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_229);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_230, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_230);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_231, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_231);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_232, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_232);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_233, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_233);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_234, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_234);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_235, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_235);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_236, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_236);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_237, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_237);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_238, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_238);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_239, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_239);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_240, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_240);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_241, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_241);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_242, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_242);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_243, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_243);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_244, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_244);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_245, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_245);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_246, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_246);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_247, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_247);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_248, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_248);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_249, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_249);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_250, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_250);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_251, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_251);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_252, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_252);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_253, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_253);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_254, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_254);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_255, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_255);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_256, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_256);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_257, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_257);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_258, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_258);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_259, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_259);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_260, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_260);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_261, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_261);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_262, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_262);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_263, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_263);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_264, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_264);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_265, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_265);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_266, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_266);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_267, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_267);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_268, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_268);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_269, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_269);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_270, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_270);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_271, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_271);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_272, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_272);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_273, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_273);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_274, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_274);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_275, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_275);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_276, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_276);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_277, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_277);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_278, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_278);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_279, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_279);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_280, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_280);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_281, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_281);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_282, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_282);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_283, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_283);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_284, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_284);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_285, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_285);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_286, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_286);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_287, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_287);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_288, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_288);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_289, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_289);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_290, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_290);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_291, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_291);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_292, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_292);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_293, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_293);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_294, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_294);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_295, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_295);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_296, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_296);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_297, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_297);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_298, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_298);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_299, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_299);
+
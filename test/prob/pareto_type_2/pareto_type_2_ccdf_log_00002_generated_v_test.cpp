@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_ccdf_log_test.hpp>
+
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_200;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_201;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_202;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_203;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_204;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_205;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_206;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_207;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_208;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_209;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_210;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_211;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_212;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_213;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_214;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_215;
+typedef std::tuple<std::vector<double>, double, double, double, empty, empty> type_v_216;
+typedef std::tuple<std::vector<double>, double, double, std::vector<double>, empty, empty> type_v_217;
+typedef std::tuple<std::vector<double>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_218;
+typedef std::tuple<std::vector<double>, double, double, var, empty, empty> type_v_219;
+typedef std::tuple<std::vector<double>, double, double, std::vector<var>, empty, empty> type_v_220;
+typedef std::tuple<std::vector<double>, double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_221;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, double, empty, empty> type_v_222;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, std::vector<double>, empty, empty> type_v_223;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_224;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, var, empty, empty> type_v_225;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, std::vector<var>, empty, empty> type_v_226;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_227;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_228;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_229;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_230;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_231;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_232;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_233;
+typedef std::tuple<std::vector<double>, double, var, double, empty, empty> type_v_234;
+typedef std::tuple<std::vector<double>, double, var, std::vector<double>, empty, empty> type_v_235;
+typedef std::tuple<std::vector<double>, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_236;
+typedef std::tuple<std::vector<double>, double, var, var, empty, empty> type_v_237;
+typedef std::tuple<std::vector<double>, double, var, std::vector<var>, empty, empty> type_v_238;
+typedef std::tuple<std::vector<double>, double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_239;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, double, empty, empty> type_v_240;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, std::vector<double>, empty, empty> type_v_241;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_242;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, var, empty, empty> type_v_243;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, std::vector<var>, empty, empty> type_v_244;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_245;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_246;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_247;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_248;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_249;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_250;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_251;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, double, empty, empty> type_v_252;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, std::vector<double>, empty, empty> type_v_253;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_254;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, var, empty, empty> type_v_255;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, std::vector<var>, empty, empty> type_v_256;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_257;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, double, empty, empty> type_v_258;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, std::vector<double>, empty, empty> type_v_259;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_260;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, var, empty, empty> type_v_261;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_v_262;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_263;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_264;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_265;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_266;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_267;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_268;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_269;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, double, empty, empty> type_v_270;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, std::vector<double>, empty, empty> type_v_271;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_272;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, var, empty, empty> type_v_273;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, std::vector<var>, empty, empty> type_v_274;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_275;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, double, empty, empty> type_v_276;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_v_277;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_278;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, var, empty, empty> type_v_279;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_v_280;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_281;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_282;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_283;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_284;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_285;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_286;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_287;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_288;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_289;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_290;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_291;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_292;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_293;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_294;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_295;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_296;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_297;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_298;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_299;
+
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_200> AgradCcdfLogParetoType2_v_200;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_201> AgradCcdfLogParetoType2_v_201;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_202> AgradCcdfLogParetoType2_v_202;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_203> AgradCcdfLogParetoType2_v_203;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_204> AgradCcdfLogParetoType2_v_204;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_205> AgradCcdfLogParetoType2_v_205;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_206> AgradCcdfLogParetoType2_v_206;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_207> AgradCcdfLogParetoType2_v_207;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_208> AgradCcdfLogParetoType2_v_208;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_209> AgradCcdfLogParetoType2_v_209;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_210> AgradCcdfLogParetoType2_v_210;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_211> AgradCcdfLogParetoType2_v_211;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_212> AgradCcdfLogParetoType2_v_212;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_213> AgradCcdfLogParetoType2_v_213;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_214> AgradCcdfLogParetoType2_v_214;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_215> AgradCcdfLogParetoType2_v_215;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_216> AgradCcdfLogParetoType2_v_216;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_217> AgradCcdfLogParetoType2_v_217;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_218> AgradCcdfLogParetoType2_v_218;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_219> AgradCcdfLogParetoType2_v_219;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_220> AgradCcdfLogParetoType2_v_220;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_221> AgradCcdfLogParetoType2_v_221;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_222> AgradCcdfLogParetoType2_v_222;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_223> AgradCcdfLogParetoType2_v_223;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_224> AgradCcdfLogParetoType2_v_224;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_225> AgradCcdfLogParetoType2_v_225;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_226> AgradCcdfLogParetoType2_v_226;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_227> AgradCcdfLogParetoType2_v_227;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_228> AgradCcdfLogParetoType2_v_228;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_229> AgradCcdfLogParetoType2_v_229;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_230> AgradCcdfLogParetoType2_v_230;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_231> AgradCcdfLogParetoType2_v_231;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_232> AgradCcdfLogParetoType2_v_232;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_233> AgradCcdfLogParetoType2_v_233;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_234> AgradCcdfLogParetoType2_v_234;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_235> AgradCcdfLogParetoType2_v_235;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_236> AgradCcdfLogParetoType2_v_236;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_237> AgradCcdfLogParetoType2_v_237;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_238> AgradCcdfLogParetoType2_v_238;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_239> AgradCcdfLogParetoType2_v_239;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_240> AgradCcdfLogParetoType2_v_240;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_241> AgradCcdfLogParetoType2_v_241;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_242> AgradCcdfLogParetoType2_v_242;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_243> AgradCcdfLogParetoType2_v_243;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_244> AgradCcdfLogParetoType2_v_244;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_245> AgradCcdfLogParetoType2_v_245;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_246> AgradCcdfLogParetoType2_v_246;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_247> AgradCcdfLogParetoType2_v_247;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_248> AgradCcdfLogParetoType2_v_248;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_249> AgradCcdfLogParetoType2_v_249;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_250> AgradCcdfLogParetoType2_v_250;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_251> AgradCcdfLogParetoType2_v_251;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_252> AgradCcdfLogParetoType2_v_252;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_253> AgradCcdfLogParetoType2_v_253;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_254> AgradCcdfLogParetoType2_v_254;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_255> AgradCcdfLogParetoType2_v_255;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_256> AgradCcdfLogParetoType2_v_256;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_257> AgradCcdfLogParetoType2_v_257;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_258> AgradCcdfLogParetoType2_v_258;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_259> AgradCcdfLogParetoType2_v_259;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_260> AgradCcdfLogParetoType2_v_260;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_261> AgradCcdfLogParetoType2_v_261;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_262> AgradCcdfLogParetoType2_v_262;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_263> AgradCcdfLogParetoType2_v_263;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_264> AgradCcdfLogParetoType2_v_264;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_265> AgradCcdfLogParetoType2_v_265;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_266> AgradCcdfLogParetoType2_v_266;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_267> AgradCcdfLogParetoType2_v_267;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_268> AgradCcdfLogParetoType2_v_268;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_269> AgradCcdfLogParetoType2_v_269;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_270> AgradCcdfLogParetoType2_v_270;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_271> AgradCcdfLogParetoType2_v_271;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_272> AgradCcdfLogParetoType2_v_272;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_273> AgradCcdfLogParetoType2_v_273;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_274> AgradCcdfLogParetoType2_v_274;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_275> AgradCcdfLogParetoType2_v_275;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_276> AgradCcdfLogParetoType2_v_276;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_277> AgradCcdfLogParetoType2_v_277;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_278> AgradCcdfLogParetoType2_v_278;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_279> AgradCcdfLogParetoType2_v_279;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_280> AgradCcdfLogParetoType2_v_280;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_281> AgradCcdfLogParetoType2_v_281;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_282> AgradCcdfLogParetoType2_v_282;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_283> AgradCcdfLogParetoType2_v_283;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_284> AgradCcdfLogParetoType2_v_284;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_285> AgradCcdfLogParetoType2_v_285;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_286> AgradCcdfLogParetoType2_v_286;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_287> AgradCcdfLogParetoType2_v_287;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_288> AgradCcdfLogParetoType2_v_288;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_289> AgradCcdfLogParetoType2_v_289;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_290> AgradCcdfLogParetoType2_v_290;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_291> AgradCcdfLogParetoType2_v_291;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_292> AgradCcdfLogParetoType2_v_292;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_293> AgradCcdfLogParetoType2_v_293;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_294> AgradCcdfLogParetoType2_v_294;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_295> AgradCcdfLogParetoType2_v_295;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_296> AgradCcdfLogParetoType2_v_296;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_297> AgradCcdfLogParetoType2_v_297;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_298> AgradCcdfLogParetoType2_v_298;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_299> AgradCcdfLogParetoType2_v_299;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_200, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_200);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_201, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_201);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_202, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_202);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_203, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_203);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_204, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_204);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_205, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_205);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_206, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_206);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_207, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_207);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_208, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_208);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_209, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_209);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_210, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_210);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_211, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_211);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_212, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_212);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_213, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_213);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_214, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_214);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_215, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_215);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_216, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_216);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_217, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_217);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_218, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_218);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_219, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_219);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_220, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_220);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_221, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_221);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_222, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_222);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_223, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_223);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_224, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_224);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_225, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_225);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_226, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_226);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_227, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_227);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_228, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_228);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_229, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_229);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_230, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_230);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_231, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_231);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_232, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_232);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_233, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_233);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_234, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_234);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_235, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_235);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_236, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_236);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_237, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_237);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_238, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_238);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_239, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_239);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_240, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_240);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_241, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_241);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_242, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_242);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_243, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_243);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_244, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_244);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_245, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_245);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_246, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_246);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_247, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_247);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_248, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_248);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_249, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_249);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_250, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_250);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_251, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_251);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_252, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_252);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_253, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_253);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_254, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_254);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_255, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_255);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_256, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_256);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_257, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_257);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_258, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_258);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_259, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_259);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_260, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_260);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_261, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_261);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_262, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_262);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_263, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_263);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_264, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_264);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_265, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_265);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_266, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_266);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_267, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_267);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_268, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_268);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_269, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_269);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_270, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_270);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_271, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_271);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_272, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_272);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_273, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_273);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_274, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_274);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_275, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_275);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_276, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_276);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_277, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_277);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_278, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_278);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_279, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_279);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_280, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_280);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_281, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_281);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_282, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_282);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_283, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_283);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_284, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_284);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_285, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_285);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_286, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_286);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_287, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_287);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_288, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_288);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_289, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_289);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_290, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_290);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_291, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_291);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_292, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_292);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_293, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_293);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_294, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_294);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_295, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_295);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_296, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_296);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_297, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_297);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_298, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_298);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_299, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_299);
+
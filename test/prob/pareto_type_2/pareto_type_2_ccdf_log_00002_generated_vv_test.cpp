@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_ccdf_log_test.hpp>
+
+typedef std::tuple<std::vector<double>, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_200;
+typedef std::tuple<std::vector<double>, double, var, var, empty, empty> type_vv_201;
+typedef std::tuple<std::vector<double>, double, var, std::vector<var>, empty, empty> type_vv_202;
+typedef std::tuple<std::vector<double>, double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_203;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, double, empty, empty> type_vv_204;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, std::vector<double>, empty, empty> type_vv_205;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_206;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, var, empty, empty> type_vv_207;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, std::vector<var>, empty, empty> type_vv_208;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_209;
+typedef std::tuple<std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_210;
+typedef std::tuple<std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_211;
+typedef std::tuple<std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_212;
+typedef std::tuple<std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_213;
+typedef std::tuple<std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_214;
+typedef std::tuple<std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_215;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, var, empty, empty> type_vv_216;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, std::vector<var>, empty, empty> type_vv_217;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_218;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, var, empty, empty> type_vv_219;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_vv_220;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_221;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_222;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_223;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_224;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, double, empty, empty> type_vv_225;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, std::vector<double>, empty, empty> type_vv_226;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_227;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, var, empty, empty> type_vv_228;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, std::vector<var>, empty, empty> type_vv_229;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_230;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, double, empty, empty> type_vv_231;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_vv_232;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_233;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, var, empty, empty> type_vv_234;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_vv_235;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_236;
+typedef std::tuple<std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_237;
+typedef std::tuple<std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_238;
+typedef std::tuple<std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_239;
+typedef std::tuple<std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_240;
+typedef std::tuple<std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_241;
+typedef std::tuple<std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_242;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_vv_243;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_vv_244;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_245;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_vv_246;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_vv_247;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_248;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_249;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_250;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_251;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_vv_252;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_vv_253;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_254;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_vv_255;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_vv_256;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_257;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_vv_258;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_vv_259;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_260;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_vv_261;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_vv_262;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_263;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_264;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_265;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_266;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_267;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_268;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_269;
+typedef std::tuple<std::vector<double>, var, double, double, empty, empty> type_vv_270;
+typedef std::tuple<std::vector<double>, var, double, std::vector<double>, empty, empty> type_vv_271;
+typedef std::tuple<std::vector<double>, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_272;
+typedef std::tuple<std::vector<double>, var, double, var, empty, empty> type_vv_273;
+typedef std::tuple<std::vector<double>, var, double, std::vector<var>, empty, empty> type_vv_274;
+typedef std::tuple<std::vector<double>, var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_275;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, double, empty, empty> type_vv_276;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, std::vector<double>, empty, empty> type_vv_277;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_278;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, var, empty, empty> type_vv_279;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, std::vector<var>, empty, empty> type_vv_280;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_281;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_282;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_283;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_284;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_285;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_286;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_287;
+typedef std::tuple<std::vector<double>, var, var, double, empty, empty> type_vv_288;
+typedef std::tuple<std::vector<double>, var, var, std::vector<double>, empty, empty> type_vv_289;
+typedef std::tuple<std::vector<double>, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_290;
+typedef std::tuple<std::vector<double>, var, var, var, empty, empty> type_vv_291;
+typedef std::tuple<std::vector<double>, var, var, std::vector<var>, empty, empty> type_vv_292;
+typedef std::tuple<std::vector<double>, var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_293;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, double, empty, empty> type_vv_294;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, std::vector<double>, empty, empty> type_vv_295;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_296;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, var, empty, empty> type_vv_297;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, std::vector<var>, empty, empty> type_vv_298;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_299;
+
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_200> AgradCcdfLogParetoType2_vv_200;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_201> AgradCcdfLogParetoType2_vv_201;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_202> AgradCcdfLogParetoType2_vv_202;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_203> AgradCcdfLogParetoType2_vv_203;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_204> AgradCcdfLogParetoType2_vv_204;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_205> AgradCcdfLogParetoType2_vv_205;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_206> AgradCcdfLogParetoType2_vv_206;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_207> AgradCcdfLogParetoType2_vv_207;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_208> AgradCcdfLogParetoType2_vv_208;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_209> AgradCcdfLogParetoType2_vv_209;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_210> AgradCcdfLogParetoType2_vv_210;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_211> AgradCcdfLogParetoType2_vv_211;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_212> AgradCcdfLogParetoType2_vv_212;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_213> AgradCcdfLogParetoType2_vv_213;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_214> AgradCcdfLogParetoType2_vv_214;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_215> AgradCcdfLogParetoType2_vv_215;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_216> AgradCcdfLogParetoType2_vv_216;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_217> AgradCcdfLogParetoType2_vv_217;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_218> AgradCcdfLogParetoType2_vv_218;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_219> AgradCcdfLogParetoType2_vv_219;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_220> AgradCcdfLogParetoType2_vv_220;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_221> AgradCcdfLogParetoType2_vv_221;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_222> AgradCcdfLogParetoType2_vv_222;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_223> AgradCcdfLogParetoType2_vv_223;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_224> AgradCcdfLogParetoType2_vv_224;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_225> AgradCcdfLogParetoType2_vv_225;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_226> AgradCcdfLogParetoType2_vv_226;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_227> AgradCcdfLogParetoType2_vv_227;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_228> AgradCcdfLogParetoType2_vv_228;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_229> AgradCcdfLogParetoType2_vv_229;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_230> AgradCcdfLogParetoType2_vv_230;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_231> AgradCcdfLogParetoType2_vv_231;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_232> AgradCcdfLogParetoType2_vv_232;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_233> AgradCcdfLogParetoType2_vv_233;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_234> AgradCcdfLogParetoType2_vv_234;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_235> AgradCcdfLogParetoType2_vv_235;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_236> AgradCcdfLogParetoType2_vv_236;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_237> AgradCcdfLogParetoType2_vv_237;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_238> AgradCcdfLogParetoType2_vv_238;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_239> AgradCcdfLogParetoType2_vv_239;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_240> AgradCcdfLogParetoType2_vv_240;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_241> AgradCcdfLogParetoType2_vv_241;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_242> AgradCcdfLogParetoType2_vv_242;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_243> AgradCcdfLogParetoType2_vv_243;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_244> AgradCcdfLogParetoType2_vv_244;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_245> AgradCcdfLogParetoType2_vv_245;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_246> AgradCcdfLogParetoType2_vv_246;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_247> AgradCcdfLogParetoType2_vv_247;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_248> AgradCcdfLogParetoType2_vv_248;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_249> AgradCcdfLogParetoType2_vv_249;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_250> AgradCcdfLogParetoType2_vv_250;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_251> AgradCcdfLogParetoType2_vv_251;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_252> AgradCcdfLogParetoType2_vv_252;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_253> AgradCcdfLogParetoType2_vv_253;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_254> AgradCcdfLogParetoType2_vv_254;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_255> AgradCcdfLogParetoType2_vv_255;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_256> AgradCcdfLogParetoType2_vv_256;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_257> AgradCcdfLogParetoType2_vv_257;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_258> AgradCcdfLogParetoType2_vv_258;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_259> AgradCcdfLogParetoType2_vv_259;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_260> AgradCcdfLogParetoType2_vv_260;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_261> AgradCcdfLogParetoType2_vv_261;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_262> AgradCcdfLogParetoType2_vv_262;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_263> AgradCcdfLogParetoType2_vv_263;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_264> AgradCcdfLogParetoType2_vv_264;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_265> AgradCcdfLogParetoType2_vv_265;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_266> AgradCcdfLogParetoType2_vv_266;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_267> AgradCcdfLogParetoType2_vv_267;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_268> AgradCcdfLogParetoType2_vv_268;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_269> AgradCcdfLogParetoType2_vv_269;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_270> AgradCcdfLogParetoType2_vv_270;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_271> AgradCcdfLogParetoType2_vv_271;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_272> AgradCcdfLogParetoType2_vv_272;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_273> AgradCcdfLogParetoType2_vv_273;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_274> AgradCcdfLogParetoType2_vv_274;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_275> AgradCcdfLogParetoType2_vv_275;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_276> AgradCcdfLogParetoType2_vv_276;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_277> AgradCcdfLogParetoType2_vv_277;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_278> AgradCcdfLogParetoType2_vv_278;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_279> AgradCcdfLogParetoType2_vv_279;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_280> AgradCcdfLogParetoType2_vv_280;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_281> AgradCcdfLogParetoType2_vv_281;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_282> AgradCcdfLogParetoType2_vv_282;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_283> AgradCcdfLogParetoType2_vv_283;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_284> AgradCcdfLogParetoType2_vv_284;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_285> AgradCcdfLogParetoType2_vv_285;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_286> AgradCcdfLogParetoType2_vv_286;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_287> AgradCcdfLogParetoType2_vv_287;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_288> AgradCcdfLogParetoType2_vv_288;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_289> AgradCcdfLogParetoType2_vv_289;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_290> AgradCcdfLogParetoType2_vv_290;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_291> AgradCcdfLogParetoType2_vv_291;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_292> AgradCcdfLogParetoType2_vv_292;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_293> AgradCcdfLogParetoType2_vv_293;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_294> AgradCcdfLogParetoType2_vv_294;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_295> AgradCcdfLogParetoType2_vv_295;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_296> AgradCcdfLogParetoType2_vv_296;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_297> AgradCcdfLogParetoType2_vv_297;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_298> AgradCcdfLogParetoType2_vv_298;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_299> AgradCcdfLogParetoType2_vv_299;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_200, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_200);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_201, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_201);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_202, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_202);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_203, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_203);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_204, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_204);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_205, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_205);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_206, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_206);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_207, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_207);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_208, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_208);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_209, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_209);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_210, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_210);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_211, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_211);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_212, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_212);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_213, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_213);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_214, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_214);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_215, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_215);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_216, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_216);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_217, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_217);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_218, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_218);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_219, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_219);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_220, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_220);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_221, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_221);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_222, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_222);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_223, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_223);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_224, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_224);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_225, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_225);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_226, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_226);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_227, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_227);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_228, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_228);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_229, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_229);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_230, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_230);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_231, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_231);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_232, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_232);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_233, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_233);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_234, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_234);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_235, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_235);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_236, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_236);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_237, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_237);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_238, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_238);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_239, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_239);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_240, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_240);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_241, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_241);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_242, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_242);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_243, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_243);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_244, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_244);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_245, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_245);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_246, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_246);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_247, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_247);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_248, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_248);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_249, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_249);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_250, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_250);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_251, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_251);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_252, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_252);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_253, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_253);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_254, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_254);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_255, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_255);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_256, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_256);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_257, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_257);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_258, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_258);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_259, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_259);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_260, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_260);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_261, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_261);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_262, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_262);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_263, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_263);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_264, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_264);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_265, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_265);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_266, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_266);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_267, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_267);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_268, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_268);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_269, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_269);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_270, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_270);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_271, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_271);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_272, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_272);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_273, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_273);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_274, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_274);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_275, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_275);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_276, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_276);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_277, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_277);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_278, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_278);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_279, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_279);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_280, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_280);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_281, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_281);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_282, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_282);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_283, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_283);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_284, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_284);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_285, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_285);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_286, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_286);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_287, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_287);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_288, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_288);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_289, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_289);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_290, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_290);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_291, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_291);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_292, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_292);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_293, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_293);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_294, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_294);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_295, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_295);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_296, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_296);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_297, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_297);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_298, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_298);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_299, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_299);
+
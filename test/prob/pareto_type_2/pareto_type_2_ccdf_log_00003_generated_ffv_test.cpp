@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_ccdf_log_test.hpp>
+
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_300;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_301;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_302;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_303;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_304;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_305;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, double, double, empty, empty> type_ffv_306;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty, empty> type_ffv_307;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_308;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty, empty> type_ffv_309;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_310;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_311;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty, empty> type_ffv_312;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_313;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_314;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_315;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_316;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_317;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_318;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_319;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_320;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_321;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_322;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_323;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty, empty> type_ffv_324;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_325;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_326;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_327;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_328;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_329;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_330;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_331;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_332;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_333;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_334;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_335;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_336;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_337;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_338;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_339;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_340;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_341;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty, empty> type_ffv_342;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_ffv_343;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_344;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_345;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_346;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_347;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_ffv_348;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_349;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_350;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_351;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_352;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_353;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_354;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_355;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_356;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_357;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_358;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_359;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_360;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_361;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_362;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_363;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_364;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_365;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_366;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_367;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_368;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_369;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_370;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_371;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_372;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_373;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_374;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_375;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_376;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_377;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, fvar<fvar<var> >, empty, empty> type_ffv_378;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_379;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_380;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_381;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_382;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_383;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_384;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_385;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_386;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, double, empty, empty> type_ffv_387;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_388;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_389;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_390;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_391;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_392;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_393;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_394;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_395;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_396;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_397;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_398;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_399;
+
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_300> AgradCcdfLogParetoType2_ffv_300;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_301> AgradCcdfLogParetoType2_ffv_301;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_302> AgradCcdfLogParetoType2_ffv_302;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_303> AgradCcdfLogParetoType2_ffv_303;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_304> AgradCcdfLogParetoType2_ffv_304;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_305> AgradCcdfLogParetoType2_ffv_305;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_306> AgradCcdfLogParetoType2_ffv_306;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_307> AgradCcdfLogParetoType2_ffv_307;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_308> AgradCcdfLogParetoType2_ffv_308;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_309> AgradCcdfLogParetoType2_ffv_309;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_310> AgradCcdfLogParetoType2_ffv_310;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_311> AgradCcdfLogParetoType2_ffv_311;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_312> AgradCcdfLogParetoType2_ffv_312;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_313> AgradCcdfLogParetoType2_ffv_313;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_314> AgradCcdfLogParetoType2_ffv_314;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_315> AgradCcdfLogParetoType2_ffv_315;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_316> AgradCcdfLogParetoType2_ffv_316;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_317> AgradCcdfLogParetoType2_ffv_317;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_318> AgradCcdfLogParetoType2_ffv_318;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_319> AgradCcdfLogParetoType2_ffv_319;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_320> AgradCcdfLogParetoType2_ffv_320;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_321> AgradCcdfLogParetoType2_ffv_321;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_322> AgradCcdfLogParetoType2_ffv_322;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_323> AgradCcdfLogParetoType2_ffv_323;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_324> AgradCcdfLogParetoType2_ffv_324;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_325> AgradCcdfLogParetoType2_ffv_325;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_326> AgradCcdfLogParetoType2_ffv_326;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_327> AgradCcdfLogParetoType2_ffv_327;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_328> AgradCcdfLogParetoType2_ffv_328;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_329> AgradCcdfLogParetoType2_ffv_329;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_330> AgradCcdfLogParetoType2_ffv_330;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_331> AgradCcdfLogParetoType2_ffv_331;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_332> AgradCcdfLogParetoType2_ffv_332;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_333> AgradCcdfLogParetoType2_ffv_333;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_334> AgradCcdfLogParetoType2_ffv_334;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_335> AgradCcdfLogParetoType2_ffv_335;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_336> AgradCcdfLogParetoType2_ffv_336;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_337> AgradCcdfLogParetoType2_ffv_337;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_338> AgradCcdfLogParetoType2_ffv_338;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_339> AgradCcdfLogParetoType2_ffv_339;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_340> AgradCcdfLogParetoType2_ffv_340;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_341> AgradCcdfLogParetoType2_ffv_341;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_342> AgradCcdfLogParetoType2_ffv_342;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_343> AgradCcdfLogParetoType2_ffv_343;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_344> AgradCcdfLogParetoType2_ffv_344;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_345> AgradCcdfLogParetoType2_ffv_345;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_346> AgradCcdfLogParetoType2_ffv_346;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_347> AgradCcdfLogParetoType2_ffv_347;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_348> AgradCcdfLogParetoType2_ffv_348;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_349> AgradCcdfLogParetoType2_ffv_349;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_350> AgradCcdfLogParetoType2_ffv_350;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_351> AgradCcdfLogParetoType2_ffv_351;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_352> AgradCcdfLogParetoType2_ffv_352;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_353> AgradCcdfLogParetoType2_ffv_353;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_354> AgradCcdfLogParetoType2_ffv_354;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_355> AgradCcdfLogParetoType2_ffv_355;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_356> AgradCcdfLogParetoType2_ffv_356;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_357> AgradCcdfLogParetoType2_ffv_357;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_358> AgradCcdfLogParetoType2_ffv_358;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_359> AgradCcdfLogParetoType2_ffv_359;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_360> AgradCcdfLogParetoType2_ffv_360;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_361> AgradCcdfLogParetoType2_ffv_361;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_362> AgradCcdfLogParetoType2_ffv_362;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_363> AgradCcdfLogParetoType2_ffv_363;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_364> AgradCcdfLogParetoType2_ffv_364;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_365> AgradCcdfLogParetoType2_ffv_365;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_366> AgradCcdfLogParetoType2_ffv_366;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_367> AgradCcdfLogParetoType2_ffv_367;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_368> AgradCcdfLogParetoType2_ffv_368;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_369> AgradCcdfLogParetoType2_ffv_369;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_370> AgradCcdfLogParetoType2_ffv_370;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_371> AgradCcdfLogParetoType2_ffv_371;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_372> AgradCcdfLogParetoType2_ffv_372;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_373> AgradCcdfLogParetoType2_ffv_373;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_374> AgradCcdfLogParetoType2_ffv_374;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_375> AgradCcdfLogParetoType2_ffv_375;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_376> AgradCcdfLogParetoType2_ffv_376;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_377> AgradCcdfLogParetoType2_ffv_377;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_378> AgradCcdfLogParetoType2_ffv_378;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_379> AgradCcdfLogParetoType2_ffv_379;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_380> AgradCcdfLogParetoType2_ffv_380;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_381> AgradCcdfLogParetoType2_ffv_381;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_382> AgradCcdfLogParetoType2_ffv_382;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_383> AgradCcdfLogParetoType2_ffv_383;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_384> AgradCcdfLogParetoType2_ffv_384;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_385> AgradCcdfLogParetoType2_ffv_385;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_386> AgradCcdfLogParetoType2_ffv_386;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_387> AgradCcdfLogParetoType2_ffv_387;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_388> AgradCcdfLogParetoType2_ffv_388;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_389> AgradCcdfLogParetoType2_ffv_389;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_390> AgradCcdfLogParetoType2_ffv_390;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_391> AgradCcdfLogParetoType2_ffv_391;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_392> AgradCcdfLogParetoType2_ffv_392;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_393> AgradCcdfLogParetoType2_ffv_393;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_394> AgradCcdfLogParetoType2_ffv_394;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_395> AgradCcdfLogParetoType2_ffv_395;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_396> AgradCcdfLogParetoType2_ffv_396;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_397> AgradCcdfLogParetoType2_ffv_397;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_398> AgradCcdfLogParetoType2_ffv_398;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_399> AgradCcdfLogParetoType2_ffv_399;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_300, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_300);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_301, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_301);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_302, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_302);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_303, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_303);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_304, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_304);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_305, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_305);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_306, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_306);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_307, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_307);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_308, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_308);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_309, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_309);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_310, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_310);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_311, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_311);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_312, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_312);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_313, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_313);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_314, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_314);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_315, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_315);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_316, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_316);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_317, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_317);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_318, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_318);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_319, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_319);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_320, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_320);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_321, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_321);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_322, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_322);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_323, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_323);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_324, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_324);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_325, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_325);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_326, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_326);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_327, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_327);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_328, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_328);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_329, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_329);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_330, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_330);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_331, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_331);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_332, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_332);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_333, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_333);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_334, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_334);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_335, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_335);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_336, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_336);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_337, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_337);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_338, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_338);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_339, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_339);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_340, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_340);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_341, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_341);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_342, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_342);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_343, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_343);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_344, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_344);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_345, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_345);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_346, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_346);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_347, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_347);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_348, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_348);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_349, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_349);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_350, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_350);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_351, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_351);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_352, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_352);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_353, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_353);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_354, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_354);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_355, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_355);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_356, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_356);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_357, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_357);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_358, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_358);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_359, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_359);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_360, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_360);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_361, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_361);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_362, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_362);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_363, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_363);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_364, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_364);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_365, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_365);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_366, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_366);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_367, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_367);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_368, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_368);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_369, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_369);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_370, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_370);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_371, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_371);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_372, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_372);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_373, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_373);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_374, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_374);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_375, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_375);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_376, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_376);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_377, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_377);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_378, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_378);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_379, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_379);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_380, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_380);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_381, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_381);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_382, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_382);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_383, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_383);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_384, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_384);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_385, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_385);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_386, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_386);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_387, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_387);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_388, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_388);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_389, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_389);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_390, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_390);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_391, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_391);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_392, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_392);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_393, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_393);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_394, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_394);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_395, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_395);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_396, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_396);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_397, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_397);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_398, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_398);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_399, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_399);
+
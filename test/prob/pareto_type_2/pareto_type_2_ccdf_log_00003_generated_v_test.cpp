@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_ccdf_log_test.hpp>
+
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_300;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_301;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_302;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_303;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_304;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_305;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_306;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_307;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_308;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_309;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_310;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_311;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_312;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_313;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_314;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_315;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_316;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_317;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_318;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_319;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_320;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_321;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_322;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_323;
+typedef std::tuple<std::vector<double>, var, double, double, empty, empty> type_v_324;
+typedef std::tuple<std::vector<double>, var, double, std::vector<double>, empty, empty> type_v_325;
+typedef std::tuple<std::vector<double>, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_326;
+typedef std::tuple<std::vector<double>, var, double, var, empty, empty> type_v_327;
+typedef std::tuple<std::vector<double>, var, double, std::vector<var>, empty, empty> type_v_328;
+typedef std::tuple<std::vector<double>, var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_329;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, double, empty, empty> type_v_330;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, std::vector<double>, empty, empty> type_v_331;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_332;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, var, empty, empty> type_v_333;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, std::vector<var>, empty, empty> type_v_334;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_335;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_336;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_337;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_338;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_339;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_340;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_341;
+typedef std::tuple<std::vector<double>, var, var, double, empty, empty> type_v_342;
+typedef std::tuple<std::vector<double>, var, var, std::vector<double>, empty, empty> type_v_343;
+typedef std::tuple<std::vector<double>, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_344;
+typedef std::tuple<std::vector<double>, var, var, var, empty, empty> type_v_345;
+typedef std::tuple<std::vector<double>, var, var, std::vector<var>, empty, empty> type_v_346;
+typedef std::tuple<std::vector<double>, var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_347;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, double, empty, empty> type_v_348;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, std::vector<double>, empty, empty> type_v_349;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_350;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, var, empty, empty> type_v_351;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, std::vector<var>, empty, empty> type_v_352;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_353;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_354;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_355;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_356;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_357;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_358;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_359;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, double, empty, empty> type_v_360;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, std::vector<double>, empty, empty> type_v_361;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_362;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, var, empty, empty> type_v_363;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, std::vector<var>, empty, empty> type_v_364;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_365;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, double, empty, empty> type_v_366;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_v_367;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_368;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, var, empty, empty> type_v_369;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_v_370;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_371;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_372;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_373;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_374;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_375;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_376;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_377;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, double, empty, empty> type_v_378;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, std::vector<double>, empty, empty> type_v_379;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_380;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, var, empty, empty> type_v_381;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, std::vector<var>, empty, empty> type_v_382;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_383;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, double, empty, empty> type_v_384;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_v_385;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_386;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, var, empty, empty> type_v_387;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_v_388;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_389;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_390;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_391;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_392;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_393;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_394;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_395;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_396;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_397;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_398;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_399;
+
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_300> AgradCcdfLogParetoType2_v_300;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_301> AgradCcdfLogParetoType2_v_301;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_302> AgradCcdfLogParetoType2_v_302;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_303> AgradCcdfLogParetoType2_v_303;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_304> AgradCcdfLogParetoType2_v_304;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_305> AgradCcdfLogParetoType2_v_305;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_306> AgradCcdfLogParetoType2_v_306;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_307> AgradCcdfLogParetoType2_v_307;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_308> AgradCcdfLogParetoType2_v_308;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_309> AgradCcdfLogParetoType2_v_309;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_310> AgradCcdfLogParetoType2_v_310;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_311> AgradCcdfLogParetoType2_v_311;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_312> AgradCcdfLogParetoType2_v_312;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_313> AgradCcdfLogParetoType2_v_313;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_314> AgradCcdfLogParetoType2_v_314;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_315> AgradCcdfLogParetoType2_v_315;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_316> AgradCcdfLogParetoType2_v_316;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_317> AgradCcdfLogParetoType2_v_317;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_318> AgradCcdfLogParetoType2_v_318;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_319> AgradCcdfLogParetoType2_v_319;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_320> AgradCcdfLogParetoType2_v_320;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_321> AgradCcdfLogParetoType2_v_321;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_322> AgradCcdfLogParetoType2_v_322;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_323> AgradCcdfLogParetoType2_v_323;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_324> AgradCcdfLogParetoType2_v_324;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_325> AgradCcdfLogParetoType2_v_325;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_326> AgradCcdfLogParetoType2_v_326;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_327> AgradCcdfLogParetoType2_v_327;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_328> AgradCcdfLogParetoType2_v_328;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_329> AgradCcdfLogParetoType2_v_329;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_330> AgradCcdfLogParetoType2_v_330;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_331> AgradCcdfLogParetoType2_v_331;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_332> AgradCcdfLogParetoType2_v_332;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_333> AgradCcdfLogParetoType2_v_333;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_334> AgradCcdfLogParetoType2_v_334;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_335> AgradCcdfLogParetoType2_v_335;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_336> AgradCcdfLogParetoType2_v_336;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_337> AgradCcdfLogParetoType2_v_337;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_338> AgradCcdfLogParetoType2_v_338;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_339> AgradCcdfLogParetoType2_v_339;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_340> AgradCcdfLogParetoType2_v_340;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_341> AgradCcdfLogParetoType2_v_341;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_342> AgradCcdfLogParetoType2_v_342;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_343> AgradCcdfLogParetoType2_v_343;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_344> AgradCcdfLogParetoType2_v_344;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_345> AgradCcdfLogParetoType2_v_345;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_346> AgradCcdfLogParetoType2_v_346;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_347> AgradCcdfLogParetoType2_v_347;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_348> AgradCcdfLogParetoType2_v_348;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_349> AgradCcdfLogParetoType2_v_349;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_350> AgradCcdfLogParetoType2_v_350;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_351> AgradCcdfLogParetoType2_v_351;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_352> AgradCcdfLogParetoType2_v_352;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_353> AgradCcdfLogParetoType2_v_353;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_354> AgradCcdfLogParetoType2_v_354;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_355> AgradCcdfLogParetoType2_v_355;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_356> AgradCcdfLogParetoType2_v_356;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_357> AgradCcdfLogParetoType2_v_357;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_358> AgradCcdfLogParetoType2_v_358;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_359> AgradCcdfLogParetoType2_v_359;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_360> AgradCcdfLogParetoType2_v_360;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_361> AgradCcdfLogParetoType2_v_361;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_362> AgradCcdfLogParetoType2_v_362;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_363> AgradCcdfLogParetoType2_v_363;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_364> AgradCcdfLogParetoType2_v_364;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_365> AgradCcdfLogParetoType2_v_365;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_366> AgradCcdfLogParetoType2_v_366;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_367> AgradCcdfLogParetoType2_v_367;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_368> AgradCcdfLogParetoType2_v_368;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_369> AgradCcdfLogParetoType2_v_369;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_370> AgradCcdfLogParetoType2_v_370;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_371> AgradCcdfLogParetoType2_v_371;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_372> AgradCcdfLogParetoType2_v_372;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_373> AgradCcdfLogParetoType2_v_373;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_374> AgradCcdfLogParetoType2_v_374;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_375> AgradCcdfLogParetoType2_v_375;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_376> AgradCcdfLogParetoType2_v_376;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_377> AgradCcdfLogParetoType2_v_377;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_378> AgradCcdfLogParetoType2_v_378;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_379> AgradCcdfLogParetoType2_v_379;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_380> AgradCcdfLogParetoType2_v_380;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_381> AgradCcdfLogParetoType2_v_381;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_382> AgradCcdfLogParetoType2_v_382;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_383> AgradCcdfLogParetoType2_v_383;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_384> AgradCcdfLogParetoType2_v_384;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_385> AgradCcdfLogParetoType2_v_385;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_386> AgradCcdfLogParetoType2_v_386;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_387> AgradCcdfLogParetoType2_v_387;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_388> AgradCcdfLogParetoType2_v_388;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_389> AgradCcdfLogParetoType2_v_389;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_390> AgradCcdfLogParetoType2_v_390;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_391> AgradCcdfLogParetoType2_v_391;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_392> AgradCcdfLogParetoType2_v_392;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_393> AgradCcdfLogParetoType2_v_393;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_394> AgradCcdfLogParetoType2_v_394;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_395> AgradCcdfLogParetoType2_v_395;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_396> AgradCcdfLogParetoType2_v_396;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_397> AgradCcdfLogParetoType2_v_397;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_398> AgradCcdfLogParetoType2_v_398;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_399> AgradCcdfLogParetoType2_v_399;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_300, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_300);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_301, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_301);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_302, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_302);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_303, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_303);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_304, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_304);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_305, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_305);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_306, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_306);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_307, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_307);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_308, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_308);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_309, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_309);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_310, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_310);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_311, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_311);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_312, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_312);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_313, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_313);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_314, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_314);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_315, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_315);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_316, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_316);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_317, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_317);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_318, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_318);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_319, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_319);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_320, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_320);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_321, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_321);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_322, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_322);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_323, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_323);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_324, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_324);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_325, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_325);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_326, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_326);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_327, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_327);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_328, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_328);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_329, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_329);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_330, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_330);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_331, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_331);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_332, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_332);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_333, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_333);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_334, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_334);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_335, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_335);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_336, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_336);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_337, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_337);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_338, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_338);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_339, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_339);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_340, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_340);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_341, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_341);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_342, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_342);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_343, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_343);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_344, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_344);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_345, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_345);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_346, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_346);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_347, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_347);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_348, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_348);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_349, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_349);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_350, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_350);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_351, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_351);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_352, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_352);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_353, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_353);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_354, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_354);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_355, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_355);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_356, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_356);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_357, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_357);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_358, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_358);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_359, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_359);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_360, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_360);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_361, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_361);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_362, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_362);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_363, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_363);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_364, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_364);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_365, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_365);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_366, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_366);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_367, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_367);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_368, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_368);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_369, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_369);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_370, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_370);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_371, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_371);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_372, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_372);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_373, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_373);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_374, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_374);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_375, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_375);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_376, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_376);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_377, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_377);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_378, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_378);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_379, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_379);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_380, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_380);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_381, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_381);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_382, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_382);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_383, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_383);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_384, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_384);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_385, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_385);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_386, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_386);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_387, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_387);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_388, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_388);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_389, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_389);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_390, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_390);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_391, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_391);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_392, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_392);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_393, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_393);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_394, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_394);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_395, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_395);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_396, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_396);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_397, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_397);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_398, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_398);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_399, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_399);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_ccdf_log_test.hpp>
+
+typedef std::tuple<std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_300;
+typedef std::tuple<std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_301;
+typedef std::tuple<std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_302;
+typedef std::tuple<std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_303;
+typedef std::tuple<std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_304;
+typedef std::tuple<std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_305;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, double, empty, empty> type_vv_306;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, std::vector<double>, empty, empty> type_vv_307;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_308;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, var, empty, empty> type_vv_309;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, std::vector<var>, empty, empty> type_vv_310;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_311;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, double, empty, empty> type_vv_312;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_vv_313;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_314;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, var, empty, empty> type_vv_315;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_vv_316;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_317;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_318;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_319;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_320;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_321;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_322;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_323;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, double, empty, empty> type_vv_324;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, std::vector<double>, empty, empty> type_vv_325;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_326;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, var, empty, empty> type_vv_327;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, std::vector<var>, empty, empty> type_vv_328;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_329;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, double, empty, empty> type_vv_330;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_vv_331;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_332;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, var, empty, empty> type_vv_333;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_vv_334;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_335;
+typedef std::tuple<std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_336;
+typedef std::tuple<std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_337;
+typedef std::tuple<std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_338;
+typedef std::tuple<std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_339;
+typedef std::tuple<std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_340;
+typedef std::tuple<std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_341;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, empty, empty> type_vv_342;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, empty, empty> type_vv_343;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_344;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, empty, empty> type_vv_345;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, empty, empty> type_vv_346;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_347;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, empty, empty> type_vv_348;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, empty, empty> type_vv_349;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_350;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, empty, empty> type_vv_351;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, empty, empty> type_vv_352;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_353;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_354;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_355;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_356;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_357;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_358;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_359;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, empty, empty> type_vv_360;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, empty, empty> type_vv_361;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_362;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, empty, empty> type_vv_363;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, empty, empty> type_vv_364;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_365;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, empty, empty> type_vv_366;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, empty, empty> type_vv_367;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_368;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, empty, empty> type_vv_369;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, empty, empty> type_vv_370;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_371;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_372;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_373;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_374;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_375;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_376;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_377;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, var, empty, empty> type_vv_378;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, std::vector<var>, empty, empty> type_vv_379;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_380;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, var, empty, empty> type_vv_381;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, std::vector<var>, empty, empty> type_vv_382;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_383;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_384;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_385;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_386;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, double, empty, empty> type_vv_387;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, std::vector<double>, empty, empty> type_vv_388;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_389;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, var, empty, empty> type_vv_390;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, std::vector<var>, empty, empty> type_vv_391;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_392;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, double, empty, empty> type_vv_393;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, std::vector<double>, empty, empty> type_vv_394;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_395;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, var, empty, empty> type_vv_396;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, std::vector<var>, empty, empty> type_vv_397;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_398;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_399;
+
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_300> AgradCcdfLogParetoType2_vv_300;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_301> AgradCcdfLogParetoType2_vv_301;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_302> AgradCcdfLogParetoType2_vv_302;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_303> AgradCcdfLogParetoType2_vv_303;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_304> AgradCcdfLogParetoType2_vv_304;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_305> AgradCcdfLogParetoType2_vv_305;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_306> AgradCcdfLogParetoType2_vv_306;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_307> AgradCcdfLogParetoType2_vv_307;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_308> AgradCcdfLogParetoType2_vv_308;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_309> AgradCcdfLogParetoType2_vv_309;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_310> AgradCcdfLogParetoType2_vv_310;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_311> AgradCcdfLogParetoType2_vv_311;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_312> AgradCcdfLogParetoType2_vv_312;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_313> AgradCcdfLogParetoType2_vv_313;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_314> AgradCcdfLogParetoType2_vv_314;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_315> AgradCcdfLogParetoType2_vv_315;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_316> AgradCcdfLogParetoType2_vv_316;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_317> AgradCcdfLogParetoType2_vv_317;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_318> AgradCcdfLogParetoType2_vv_318;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_319> AgradCcdfLogParetoType2_vv_319;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_320> AgradCcdfLogParetoType2_vv_320;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_321> AgradCcdfLogParetoType2_vv_321;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_322> AgradCcdfLogParetoType2_vv_322;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_323> AgradCcdfLogParetoType2_vv_323;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_324> AgradCcdfLogParetoType2_vv_324;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_325> AgradCcdfLogParetoType2_vv_325;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_326> AgradCcdfLogParetoType2_vv_326;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_327> AgradCcdfLogParetoType2_vv_327;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_328> AgradCcdfLogParetoType2_vv_328;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_329> AgradCcdfLogParetoType2_vv_329;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_330> AgradCcdfLogParetoType2_vv_330;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_331> AgradCcdfLogParetoType2_vv_331;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_332> AgradCcdfLogParetoType2_vv_332;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_333> AgradCcdfLogParetoType2_vv_333;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_334> AgradCcdfLogParetoType2_vv_334;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_335> AgradCcdfLogParetoType2_vv_335;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_336> AgradCcdfLogParetoType2_vv_336;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_337> AgradCcdfLogParetoType2_vv_337;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_338> AgradCcdfLogParetoType2_vv_338;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_339> AgradCcdfLogParetoType2_vv_339;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_340> AgradCcdfLogParetoType2_vv_340;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_341> AgradCcdfLogParetoType2_vv_341;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_342> AgradCcdfLogParetoType2_vv_342;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_343> AgradCcdfLogParetoType2_vv_343;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_344> AgradCcdfLogParetoType2_vv_344;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_345> AgradCcdfLogParetoType2_vv_345;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_346> AgradCcdfLogParetoType2_vv_346;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_347> AgradCcdfLogParetoType2_vv_347;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_348> AgradCcdfLogParetoType2_vv_348;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_349> AgradCcdfLogParetoType2_vv_349;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_350> AgradCcdfLogParetoType2_vv_350;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_351> AgradCcdfLogParetoType2_vv_351;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_352> AgradCcdfLogParetoType2_vv_352;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_353> AgradCcdfLogParetoType2_vv_353;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_354> AgradCcdfLogParetoType2_vv_354;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_355> AgradCcdfLogParetoType2_vv_355;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_356> AgradCcdfLogParetoType2_vv_356;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_357> AgradCcdfLogParetoType2_vv_357;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_358> AgradCcdfLogParetoType2_vv_358;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_359> AgradCcdfLogParetoType2_vv_359;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_360> AgradCcdfLogParetoType2_vv_360;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_361> AgradCcdfLogParetoType2_vv_361;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_362> AgradCcdfLogParetoType2_vv_362;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_363> AgradCcdfLogParetoType2_vv_363;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_364> AgradCcdfLogParetoType2_vv_364;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_365> AgradCcdfLogParetoType2_vv_365;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_366> AgradCcdfLogParetoType2_vv_366;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_367> AgradCcdfLogParetoType2_vv_367;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_368> AgradCcdfLogParetoType2_vv_368;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_369> AgradCcdfLogParetoType2_vv_369;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_370> AgradCcdfLogParetoType2_vv_370;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_371> AgradCcdfLogParetoType2_vv_371;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_372> AgradCcdfLogParetoType2_vv_372;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_373> AgradCcdfLogParetoType2_vv_373;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_374> AgradCcdfLogParetoType2_vv_374;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_375> AgradCcdfLogParetoType2_vv_375;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_376> AgradCcdfLogParetoType2_vv_376;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_377> AgradCcdfLogParetoType2_vv_377;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_378> AgradCcdfLogParetoType2_vv_378;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_379> AgradCcdfLogParetoType2_vv_379;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_380> AgradCcdfLogParetoType2_vv_380;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_381> AgradCcdfLogParetoType2_vv_381;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_382> AgradCcdfLogParetoType2_vv_382;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_383> AgradCcdfLogParetoType2_vv_383;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_384> AgradCcdfLogParetoType2_vv_384;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_385> AgradCcdfLogParetoType2_vv_385;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_386> AgradCcdfLogParetoType2_vv_386;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_387> AgradCcdfLogParetoType2_vv_387;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_388> AgradCcdfLogParetoType2_vv_388;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_389> AgradCcdfLogParetoType2_vv_389;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_390> AgradCcdfLogParetoType2_vv_390;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_391> AgradCcdfLogParetoType2_vv_391;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_392> AgradCcdfLogParetoType2_vv_392;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_393> AgradCcdfLogParetoType2_vv_393;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_394> AgradCcdfLogParetoType2_vv_394;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_395> AgradCcdfLogParetoType2_vv_395;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_396> AgradCcdfLogParetoType2_vv_396;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_397> AgradCcdfLogParetoType2_vv_397;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_398> AgradCcdfLogParetoType2_vv_398;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_399> AgradCcdfLogParetoType2_vv_399;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_300, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_300);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_301, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_301);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_302, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_302);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_303, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_303);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_304, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_304);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_305, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_305);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_306, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_306);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_307, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_307);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_308, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_308);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_309, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_309);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_310, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_310);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_311, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_311);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_312, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_312);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_313, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_313);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_314, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_314);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_315, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_315);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_316, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_316);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_317, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_317);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_318, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_318);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_319, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_319);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_320, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_320);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_321, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_321);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_322, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_322);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_323, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_323);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_324, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_324);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_325, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_325);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_326, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_326);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_327, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_327);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_328, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_328);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_329, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_329);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_330, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_330);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_331, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_331);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_332, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_332);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_333, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_333);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_334, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_334);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_335, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_335);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_336, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_336);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_337, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_337);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_338, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_338);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_339, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_339);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_340, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_340);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_341, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_341);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_342, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_342);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_343, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_343);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_344, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_344);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_345, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_345);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_346, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_346);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_347, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_347);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_348, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_348);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_349, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_349);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_350, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_350);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_351, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_351);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_352, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_352);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_353, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_353);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_354, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_354);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_355, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_355);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_356, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_356);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_357, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_357);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_358, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_358);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_359, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_359);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_360, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_360);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_361, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_361);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_362, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_362);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_363, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_363);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_364, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_364);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_365, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_365);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_366, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_366);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_367, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_367);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_368, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_368);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_369, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_369);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_370, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_370);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_371, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_371);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_372, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_372);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_373, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_373);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_374, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_374);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_375, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_375);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_376, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_376);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_377, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_377);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_378, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_378);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_379, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_379);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_380, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_380);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_381, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_381);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_382, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_382);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_383, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_383);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_384, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_384);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_385, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_385);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_386, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_386);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_387, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_387);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_388, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_388);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_389, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_389);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_390, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_390);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_391, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_391);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_392, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_392);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_393, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_393);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_394, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_394);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_395, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_395);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_396, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_396);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_397, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_397);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_398, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_398);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_399, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_399);
+
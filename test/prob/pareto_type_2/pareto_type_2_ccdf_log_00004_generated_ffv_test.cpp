@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_ccdf_log_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_400;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_401;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_402;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_403;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_404;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, fvar<fvar<var> >, empty, empty> type_ffv_405;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_406;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_407;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_408;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_409;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_410;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_411;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_412;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_413;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, double, empty, empty> type_ffv_414;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_415;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_416;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_417;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_418;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_419;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_420;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_421;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_422;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_423;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_424;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_425;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_426;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_427;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_428;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_429;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_430;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_431;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_432;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_433;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_434;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_435;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_436;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_437;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_438;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_439;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_440;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_441;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_442;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_443;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_444;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_445;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_446;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_447;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_448;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_449;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_450;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_451;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_452;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_453;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_454;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_455;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_456;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_457;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_458;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, double, empty, empty> type_ffv_459;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, std::vector<double>, empty, empty> type_ffv_460;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_461;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, fvar<fvar<var> >, empty, empty> type_ffv_462;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_463;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_464;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, double, empty, empty> type_ffv_465;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty, empty> type_ffv_466;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_467;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_468;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_469;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_470;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_471;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_472;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_473;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_474;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_475;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_476;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, double, empty, empty> type_ffv_477;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_478;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_479;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_480;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_481;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_482;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_483;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_484;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_485;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_486;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_487;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_488;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_489;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_490;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_491;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_492;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_493;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_494;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, double, empty, empty> type_ffv_495;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty, empty> type_ffv_496;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_497;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty, empty> type_ffv_498;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_499;
+
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_400> AgradCcdfLogParetoType2_ffv_400;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_401> AgradCcdfLogParetoType2_ffv_401;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_402> AgradCcdfLogParetoType2_ffv_402;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_403> AgradCcdfLogParetoType2_ffv_403;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_404> AgradCcdfLogParetoType2_ffv_404;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_405> AgradCcdfLogParetoType2_ffv_405;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_406> AgradCcdfLogParetoType2_ffv_406;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_407> AgradCcdfLogParetoType2_ffv_407;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_408> AgradCcdfLogParetoType2_ffv_408;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_409> AgradCcdfLogParetoType2_ffv_409;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_410> AgradCcdfLogParetoType2_ffv_410;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_411> AgradCcdfLogParetoType2_ffv_411;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_412> AgradCcdfLogParetoType2_ffv_412;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_413> AgradCcdfLogParetoType2_ffv_413;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_414> AgradCcdfLogParetoType2_ffv_414;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_415> AgradCcdfLogParetoType2_ffv_415;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_416> AgradCcdfLogParetoType2_ffv_416;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_417> AgradCcdfLogParetoType2_ffv_417;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_418> AgradCcdfLogParetoType2_ffv_418;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_419> AgradCcdfLogParetoType2_ffv_419;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_420> AgradCcdfLogParetoType2_ffv_420;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_421> AgradCcdfLogParetoType2_ffv_421;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_422> AgradCcdfLogParetoType2_ffv_422;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_423> AgradCcdfLogParetoType2_ffv_423;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_424> AgradCcdfLogParetoType2_ffv_424;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_425> AgradCcdfLogParetoType2_ffv_425;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_426> AgradCcdfLogParetoType2_ffv_426;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_427> AgradCcdfLogParetoType2_ffv_427;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_428> AgradCcdfLogParetoType2_ffv_428;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_429> AgradCcdfLogParetoType2_ffv_429;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_430> AgradCcdfLogParetoType2_ffv_430;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_431> AgradCcdfLogParetoType2_ffv_431;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_432> AgradCcdfLogParetoType2_ffv_432;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_433> AgradCcdfLogParetoType2_ffv_433;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_434> AgradCcdfLogParetoType2_ffv_434;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_435> AgradCcdfLogParetoType2_ffv_435;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_436> AgradCcdfLogParetoType2_ffv_436;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_437> AgradCcdfLogParetoType2_ffv_437;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_438> AgradCcdfLogParetoType2_ffv_438;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_439> AgradCcdfLogParetoType2_ffv_439;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_440> AgradCcdfLogParetoType2_ffv_440;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_441> AgradCcdfLogParetoType2_ffv_441;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_442> AgradCcdfLogParetoType2_ffv_442;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_443> AgradCcdfLogParetoType2_ffv_443;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_444> AgradCcdfLogParetoType2_ffv_444;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_445> AgradCcdfLogParetoType2_ffv_445;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_446> AgradCcdfLogParetoType2_ffv_446;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_447> AgradCcdfLogParetoType2_ffv_447;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_448> AgradCcdfLogParetoType2_ffv_448;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_449> AgradCcdfLogParetoType2_ffv_449;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_450> AgradCcdfLogParetoType2_ffv_450;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_451> AgradCcdfLogParetoType2_ffv_451;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_452> AgradCcdfLogParetoType2_ffv_452;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_453> AgradCcdfLogParetoType2_ffv_453;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_454> AgradCcdfLogParetoType2_ffv_454;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_455> AgradCcdfLogParetoType2_ffv_455;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_456> AgradCcdfLogParetoType2_ffv_456;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_457> AgradCcdfLogParetoType2_ffv_457;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_458> AgradCcdfLogParetoType2_ffv_458;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_459> AgradCcdfLogParetoType2_ffv_459;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_460> AgradCcdfLogParetoType2_ffv_460;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_461> AgradCcdfLogParetoType2_ffv_461;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_462> AgradCcdfLogParetoType2_ffv_462;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_463> AgradCcdfLogParetoType2_ffv_463;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_464> AgradCcdfLogParetoType2_ffv_464;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_465> AgradCcdfLogParetoType2_ffv_465;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_466> AgradCcdfLogParetoType2_ffv_466;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_467> AgradCcdfLogParetoType2_ffv_467;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_468> AgradCcdfLogParetoType2_ffv_468;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_469> AgradCcdfLogParetoType2_ffv_469;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_470> AgradCcdfLogParetoType2_ffv_470;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_471> AgradCcdfLogParetoType2_ffv_471;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_472> AgradCcdfLogParetoType2_ffv_472;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_473> AgradCcdfLogParetoType2_ffv_473;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_474> AgradCcdfLogParetoType2_ffv_474;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_475> AgradCcdfLogParetoType2_ffv_475;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_476> AgradCcdfLogParetoType2_ffv_476;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_477> AgradCcdfLogParetoType2_ffv_477;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_478> AgradCcdfLogParetoType2_ffv_478;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_479> AgradCcdfLogParetoType2_ffv_479;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_480> AgradCcdfLogParetoType2_ffv_480;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_481> AgradCcdfLogParetoType2_ffv_481;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_482> AgradCcdfLogParetoType2_ffv_482;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_483> AgradCcdfLogParetoType2_ffv_483;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_484> AgradCcdfLogParetoType2_ffv_484;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_485> AgradCcdfLogParetoType2_ffv_485;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_486> AgradCcdfLogParetoType2_ffv_486;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_487> AgradCcdfLogParetoType2_ffv_487;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_488> AgradCcdfLogParetoType2_ffv_488;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_489> AgradCcdfLogParetoType2_ffv_489;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_490> AgradCcdfLogParetoType2_ffv_490;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_491> AgradCcdfLogParetoType2_ffv_491;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_492> AgradCcdfLogParetoType2_ffv_492;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_493> AgradCcdfLogParetoType2_ffv_493;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_494> AgradCcdfLogParetoType2_ffv_494;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_495> AgradCcdfLogParetoType2_ffv_495;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_496> AgradCcdfLogParetoType2_ffv_496;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_497> AgradCcdfLogParetoType2_ffv_497;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_498> AgradCcdfLogParetoType2_ffv_498;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_499> AgradCcdfLogParetoType2_ffv_499;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_400, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_400);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_401, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_401);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_402, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_402);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_403, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_403);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_404, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_404);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_405, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_405);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_406, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_406);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_407, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_407);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_408, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_408);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_409, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_409);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_410, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_410);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_411, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_411);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_412, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_412);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_413, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_413);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_414, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_414);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_415, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_415);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_416, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_416);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_417, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_417);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_418, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_418);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_419, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_419);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_420, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_420);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_421, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_421);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_422, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_422);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_423, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_423);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_424, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_424);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_425, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_425);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_426, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_426);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_427, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_427);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_428, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_428);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_429, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_429);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_430, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_430);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_431, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_431);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_432, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_432);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_433, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_433);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_434, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_434);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_435, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_435);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_436, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_436);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_437, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_437);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_438, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_438);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_439, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_439);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_440, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_440);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_441, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_441);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_442, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_442);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_443, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_443);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_444, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_444);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_445, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_445);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_446, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_446);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_447, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_447);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_448, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_448);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_449, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_449);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_450, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_450);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_451, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_451);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_452, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_452);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_453, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_453);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_454, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_454);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_455, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_455);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_456, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_456);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_457, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_457);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_458, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_458);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_459, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_459);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_460, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_460);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_461, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_461);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_462, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_462);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_463, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_463);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_464, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_464);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_465, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_465);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_466, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_466);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_467, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_467);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_468, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_468);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_469, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_469);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_470, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_470);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_471, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_471);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_472, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_472);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_473, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_473);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_474, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_474);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_475, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_475);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_476, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_476);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_477, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_477);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_478, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_478);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_479, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_479);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_480, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_480);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_481, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_481);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_482, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_482);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_483, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_483);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_484, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_484);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_485, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_485);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_486, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_486);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_487, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_487);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_488, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_488);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_489, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_489);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_490, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_490);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_491, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_491);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_492, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_492);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_493, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_493);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_494, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_494);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_495, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_495);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_496, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_496);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_497, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_497);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_498, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_498);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_499, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_499);
+
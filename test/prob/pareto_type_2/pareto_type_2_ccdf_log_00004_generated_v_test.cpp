@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_ccdf_log_test.hpp>
+
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_400;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_401;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_402;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_403;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_404;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_405;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_406;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_407;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_408;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_409;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_410;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_411;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_412;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_413;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_414;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_415;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_416;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_417;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_418;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_419;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_420;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_421;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_422;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_423;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_424;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_425;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_426;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_427;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_428;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_429;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_430;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_431;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, double, empty, empty> type_v_432;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, std::vector<double>, empty, empty> type_v_433;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_434;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, var, empty, empty> type_v_435;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, std::vector<var>, empty, empty> type_v_436;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_437;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, double, empty, empty> type_v_438;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, std::vector<double>, empty, empty> type_v_439;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_440;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, var, empty, empty> type_v_441;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, std::vector<var>, empty, empty> type_v_442;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_443;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_444;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_445;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_446;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_447;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_448;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_449;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, double, empty, empty> type_v_450;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, std::vector<double>, empty, empty> type_v_451;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_452;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, var, empty, empty> type_v_453;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, std::vector<var>, empty, empty> type_v_454;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_455;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, double, empty, empty> type_v_456;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, std::vector<double>, empty, empty> type_v_457;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_458;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, var, empty, empty> type_v_459;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, std::vector<var>, empty, empty> type_v_460;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_461;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_462;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_463;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_464;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_465;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_466;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_467;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, double, empty, empty> type_v_468;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, std::vector<double>, empty, empty> type_v_469;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_470;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, var, empty, empty> type_v_471;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, std::vector<var>, empty, empty> type_v_472;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_473;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, double, empty, empty> type_v_474;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, std::vector<double>, empty, empty> type_v_475;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_476;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, var, empty, empty> type_v_477;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_v_478;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_479;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_480;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_481;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_482;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_483;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_484;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_485;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, double, empty, empty> type_v_486;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, std::vector<double>, empty, empty> type_v_487;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_488;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, var, empty, empty> type_v_489;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, std::vector<var>, empty, empty> type_v_490;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_491;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, double, empty, empty> type_v_492;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_v_493;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_494;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, var, empty, empty> type_v_495;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_v_496;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_497;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_498;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_499;
+
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_400> AgradCcdfLogParetoType2_v_400;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_401> AgradCcdfLogParetoType2_v_401;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_402> AgradCcdfLogParetoType2_v_402;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_403> AgradCcdfLogParetoType2_v_403;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_404> AgradCcdfLogParetoType2_v_404;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_405> AgradCcdfLogParetoType2_v_405;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_406> AgradCcdfLogParetoType2_v_406;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_407> AgradCcdfLogParetoType2_v_407;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_408> AgradCcdfLogParetoType2_v_408;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_409> AgradCcdfLogParetoType2_v_409;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_410> AgradCcdfLogParetoType2_v_410;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_411> AgradCcdfLogParetoType2_v_411;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_412> AgradCcdfLogParetoType2_v_412;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_413> AgradCcdfLogParetoType2_v_413;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_414> AgradCcdfLogParetoType2_v_414;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_415> AgradCcdfLogParetoType2_v_415;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_416> AgradCcdfLogParetoType2_v_416;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_417> AgradCcdfLogParetoType2_v_417;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_418> AgradCcdfLogParetoType2_v_418;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_419> AgradCcdfLogParetoType2_v_419;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_420> AgradCcdfLogParetoType2_v_420;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_421> AgradCcdfLogParetoType2_v_421;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_422> AgradCcdfLogParetoType2_v_422;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_423> AgradCcdfLogParetoType2_v_423;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_424> AgradCcdfLogParetoType2_v_424;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_425> AgradCcdfLogParetoType2_v_425;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_426> AgradCcdfLogParetoType2_v_426;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_427> AgradCcdfLogParetoType2_v_427;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_428> AgradCcdfLogParetoType2_v_428;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_429> AgradCcdfLogParetoType2_v_429;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_430> AgradCcdfLogParetoType2_v_430;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_431> AgradCcdfLogParetoType2_v_431;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_432> AgradCcdfLogParetoType2_v_432;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_433> AgradCcdfLogParetoType2_v_433;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_434> AgradCcdfLogParetoType2_v_434;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_435> AgradCcdfLogParetoType2_v_435;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_436> AgradCcdfLogParetoType2_v_436;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_437> AgradCcdfLogParetoType2_v_437;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_438> AgradCcdfLogParetoType2_v_438;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_439> AgradCcdfLogParetoType2_v_439;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_440> AgradCcdfLogParetoType2_v_440;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_441> AgradCcdfLogParetoType2_v_441;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_442> AgradCcdfLogParetoType2_v_442;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_443> AgradCcdfLogParetoType2_v_443;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_444> AgradCcdfLogParetoType2_v_444;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_445> AgradCcdfLogParetoType2_v_445;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_446> AgradCcdfLogParetoType2_v_446;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_447> AgradCcdfLogParetoType2_v_447;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_448> AgradCcdfLogParetoType2_v_448;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_449> AgradCcdfLogParetoType2_v_449;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_450> AgradCcdfLogParetoType2_v_450;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_451> AgradCcdfLogParetoType2_v_451;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_452> AgradCcdfLogParetoType2_v_452;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_453> AgradCcdfLogParetoType2_v_453;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_454> AgradCcdfLogParetoType2_v_454;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_455> AgradCcdfLogParetoType2_v_455;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_456> AgradCcdfLogParetoType2_v_456;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_457> AgradCcdfLogParetoType2_v_457;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_458> AgradCcdfLogParetoType2_v_458;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_459> AgradCcdfLogParetoType2_v_459;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_460> AgradCcdfLogParetoType2_v_460;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_461> AgradCcdfLogParetoType2_v_461;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_462> AgradCcdfLogParetoType2_v_462;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_463> AgradCcdfLogParetoType2_v_463;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_464> AgradCcdfLogParetoType2_v_464;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_465> AgradCcdfLogParetoType2_v_465;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_466> AgradCcdfLogParetoType2_v_466;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_467> AgradCcdfLogParetoType2_v_467;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_468> AgradCcdfLogParetoType2_v_468;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_469> AgradCcdfLogParetoType2_v_469;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_470> AgradCcdfLogParetoType2_v_470;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_471> AgradCcdfLogParetoType2_v_471;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_472> AgradCcdfLogParetoType2_v_472;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_473> AgradCcdfLogParetoType2_v_473;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_474> AgradCcdfLogParetoType2_v_474;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_475> AgradCcdfLogParetoType2_v_475;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_476> AgradCcdfLogParetoType2_v_476;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_477> AgradCcdfLogParetoType2_v_477;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_478> AgradCcdfLogParetoType2_v_478;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_479> AgradCcdfLogParetoType2_v_479;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_480> AgradCcdfLogParetoType2_v_480;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_481> AgradCcdfLogParetoType2_v_481;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_482> AgradCcdfLogParetoType2_v_482;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_483> AgradCcdfLogParetoType2_v_483;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_484> AgradCcdfLogParetoType2_v_484;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_485> AgradCcdfLogParetoType2_v_485;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_486> AgradCcdfLogParetoType2_v_486;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_487> AgradCcdfLogParetoType2_v_487;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_488> AgradCcdfLogParetoType2_v_488;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_489> AgradCcdfLogParetoType2_v_489;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_490> AgradCcdfLogParetoType2_v_490;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_491> AgradCcdfLogParetoType2_v_491;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_492> AgradCcdfLogParetoType2_v_492;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_493> AgradCcdfLogParetoType2_v_493;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_494> AgradCcdfLogParetoType2_v_494;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_495> AgradCcdfLogParetoType2_v_495;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_496> AgradCcdfLogParetoType2_v_496;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_497> AgradCcdfLogParetoType2_v_497;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_498> AgradCcdfLogParetoType2_v_498;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_499> AgradCcdfLogParetoType2_v_499;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_400, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_400);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_401, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_401);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_402, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_402);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_403, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_403);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_404, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_404);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_405, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_405);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_406, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_406);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_407, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_407);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_408, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_408);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_409, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_409);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_410, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_410);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_411, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_411);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_412, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_412);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_413, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_413);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_414, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_414);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_415, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_415);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_416, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_416);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_417, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_417);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_418, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_418);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_419, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_419);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_420, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_420);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_421, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_421);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_422, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_422);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_423, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_423);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_424, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_424);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_425, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_425);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_426, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_426);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_427, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_427);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_428, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_428);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_429, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_429);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_430, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_430);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_431, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_431);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_432, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_432);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_433, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_433);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_434, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_434);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_435, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_435);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_436, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_436);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_437, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_437);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_438, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_438);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_439, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_439);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_440, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_440);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_441, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_441);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_442, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_442);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_443, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_443);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_444, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_444);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_445, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_445);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_446, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_446);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_447, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_447);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_448, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_448);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_449, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_449);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_450, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_450);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_451, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_451);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_452, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_452);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_453, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_453);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_454, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_454);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_455, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_455);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_456, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_456);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_457, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_457);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_458, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_458);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_459, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_459);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_460, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_460);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_461, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_461);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_462, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_462);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_463, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_463);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_464, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_464);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_465, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_465);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_466, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_466);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_467, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_467);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_468, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_468);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_469, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_469);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_470, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_470);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_471, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_471);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_472, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_472);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_473, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_473);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_474, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_474);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_475, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_475);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_476, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_476);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_477, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_477);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_478, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_478);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_479, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_479);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_480, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_480);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_481, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_481);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_482, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_482);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_483, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_483);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_484, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_484);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_485, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_485);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_486, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_486);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_487, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_487);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_488, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_488);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_489, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_489);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_490, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_490);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_491, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_491);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_492, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_492);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_493, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_493);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_494, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_494);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_495, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_495);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_496, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_496);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_497, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_497);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_498, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_498);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_499, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_499);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_ccdf_log_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_400;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_401;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_402;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_403;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_404;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, var, empty, empty> type_vv_405;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, std::vector<var>, empty, empty> type_vv_406;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_407;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, var, empty, empty> type_vv_408;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_vv_409;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_410;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_411;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_412;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_413;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, double, empty, empty> type_vv_414;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, std::vector<double>, empty, empty> type_vv_415;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_416;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, var, empty, empty> type_vv_417;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, std::vector<var>, empty, empty> type_vv_418;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_419;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, double, empty, empty> type_vv_420;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_vv_421;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_422;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, var, empty, empty> type_vv_423;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_vv_424;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_425;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_426;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_427;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_428;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_429;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_430;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_431;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_vv_432;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_vv_433;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_434;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_vv_435;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_vv_436;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_437;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_438;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_439;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_440;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_vv_441;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_vv_442;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_443;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_vv_444;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_vv_445;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_446;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_vv_447;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_vv_448;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_449;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_vv_450;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_vv_451;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_452;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_453;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_454;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_455;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_456;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_457;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_458;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, double, empty, empty> type_vv_459;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, std::vector<double>, empty, empty> type_vv_460;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_461;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, var, empty, empty> type_vv_462;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, std::vector<var>, empty, empty> type_vv_463;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_464;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, double, empty, empty> type_vv_465;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, std::vector<double>, empty, empty> type_vv_466;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_467;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, var, empty, empty> type_vv_468;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, std::vector<var>, empty, empty> type_vv_469;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_470;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_471;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_472;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_473;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_474;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_475;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_476;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, double, empty, empty> type_vv_477;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, std::vector<double>, empty, empty> type_vv_478;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_479;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, var, empty, empty> type_vv_480;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, std::vector<var>, empty, empty> type_vv_481;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_482;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, double, empty, empty> type_vv_483;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, std::vector<double>, empty, empty> type_vv_484;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_485;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, var, empty, empty> type_vv_486;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, std::vector<var>, empty, empty> type_vv_487;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_488;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_489;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_490;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_491;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_492;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_493;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_494;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, double, empty, empty> type_vv_495;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, std::vector<double>, empty, empty> type_vv_496;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_497;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, var, empty, empty> type_vv_498;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, std::vector<var>, empty, empty> type_vv_499;
+
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_400> AgradCcdfLogParetoType2_vv_400;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_401> AgradCcdfLogParetoType2_vv_401;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_402> AgradCcdfLogParetoType2_vv_402;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_403> AgradCcdfLogParetoType2_vv_403;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_404> AgradCcdfLogParetoType2_vv_404;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_405> AgradCcdfLogParetoType2_vv_405;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_406> AgradCcdfLogParetoType2_vv_406;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_407> AgradCcdfLogParetoType2_vv_407;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_408> AgradCcdfLogParetoType2_vv_408;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_409> AgradCcdfLogParetoType2_vv_409;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_410> AgradCcdfLogParetoType2_vv_410;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_411> AgradCcdfLogParetoType2_vv_411;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_412> AgradCcdfLogParetoType2_vv_412;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_413> AgradCcdfLogParetoType2_vv_413;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_414> AgradCcdfLogParetoType2_vv_414;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_415> AgradCcdfLogParetoType2_vv_415;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_416> AgradCcdfLogParetoType2_vv_416;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_417> AgradCcdfLogParetoType2_vv_417;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_418> AgradCcdfLogParetoType2_vv_418;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_419> AgradCcdfLogParetoType2_vv_419;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_420> AgradCcdfLogParetoType2_vv_420;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_421> AgradCcdfLogParetoType2_vv_421;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_422> AgradCcdfLogParetoType2_vv_422;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_423> AgradCcdfLogParetoType2_vv_423;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_424> AgradCcdfLogParetoType2_vv_424;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_425> AgradCcdfLogParetoType2_vv_425;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_426> AgradCcdfLogParetoType2_vv_426;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_427> AgradCcdfLogParetoType2_vv_427;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_428> AgradCcdfLogParetoType2_vv_428;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_429> AgradCcdfLogParetoType2_vv_429;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_430> AgradCcdfLogParetoType2_vv_430;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_431> AgradCcdfLogParetoType2_vv_431;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_432> AgradCcdfLogParetoType2_vv_432;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_433> AgradCcdfLogParetoType2_vv_433;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_434> AgradCcdfLogParetoType2_vv_434;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_435> AgradCcdfLogParetoType2_vv_435;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_436> AgradCcdfLogParetoType2_vv_436;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_437> AgradCcdfLogParetoType2_vv_437;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_438> AgradCcdfLogParetoType2_vv_438;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_439> AgradCcdfLogParetoType2_vv_439;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_440> AgradCcdfLogParetoType2_vv_440;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_441> AgradCcdfLogParetoType2_vv_441;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_442> AgradCcdfLogParetoType2_vv_442;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_443> AgradCcdfLogParetoType2_vv_443;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_444> AgradCcdfLogParetoType2_vv_444;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_445> AgradCcdfLogParetoType2_vv_445;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_446> AgradCcdfLogParetoType2_vv_446;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_447> AgradCcdfLogParetoType2_vv_447;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_448> AgradCcdfLogParetoType2_vv_448;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_449> AgradCcdfLogParetoType2_vv_449;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_450> AgradCcdfLogParetoType2_vv_450;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_451> AgradCcdfLogParetoType2_vv_451;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_452> AgradCcdfLogParetoType2_vv_452;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_453> AgradCcdfLogParetoType2_vv_453;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_454> AgradCcdfLogParetoType2_vv_454;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_455> AgradCcdfLogParetoType2_vv_455;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_456> AgradCcdfLogParetoType2_vv_456;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_457> AgradCcdfLogParetoType2_vv_457;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_458> AgradCcdfLogParetoType2_vv_458;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_459> AgradCcdfLogParetoType2_vv_459;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_460> AgradCcdfLogParetoType2_vv_460;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_461> AgradCcdfLogParetoType2_vv_461;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_462> AgradCcdfLogParetoType2_vv_462;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_463> AgradCcdfLogParetoType2_vv_463;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_464> AgradCcdfLogParetoType2_vv_464;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_465> AgradCcdfLogParetoType2_vv_465;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_466> AgradCcdfLogParetoType2_vv_466;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_467> AgradCcdfLogParetoType2_vv_467;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_468> AgradCcdfLogParetoType2_vv_468;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_469> AgradCcdfLogParetoType2_vv_469;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_470> AgradCcdfLogParetoType2_vv_470;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_471> AgradCcdfLogParetoType2_vv_471;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_472> AgradCcdfLogParetoType2_vv_472;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_473> AgradCcdfLogParetoType2_vv_473;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_474> AgradCcdfLogParetoType2_vv_474;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_475> AgradCcdfLogParetoType2_vv_475;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_476> AgradCcdfLogParetoType2_vv_476;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_477> AgradCcdfLogParetoType2_vv_477;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_478> AgradCcdfLogParetoType2_vv_478;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_479> AgradCcdfLogParetoType2_vv_479;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_480> AgradCcdfLogParetoType2_vv_480;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_481> AgradCcdfLogParetoType2_vv_481;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_482> AgradCcdfLogParetoType2_vv_482;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_483> AgradCcdfLogParetoType2_vv_483;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_484> AgradCcdfLogParetoType2_vv_484;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_485> AgradCcdfLogParetoType2_vv_485;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_486> AgradCcdfLogParetoType2_vv_486;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_487> AgradCcdfLogParetoType2_vv_487;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_488> AgradCcdfLogParetoType2_vv_488;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_489> AgradCcdfLogParetoType2_vv_489;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_490> AgradCcdfLogParetoType2_vv_490;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_491> AgradCcdfLogParetoType2_vv_491;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_492> AgradCcdfLogParetoType2_vv_492;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_493> AgradCcdfLogParetoType2_vv_493;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_494> AgradCcdfLogParetoType2_vv_494;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_495> AgradCcdfLogParetoType2_vv_495;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_496> AgradCcdfLogParetoType2_vv_496;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_497> AgradCcdfLogParetoType2_vv_497;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_498> AgradCcdfLogParetoType2_vv_498;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_499> AgradCcdfLogParetoType2_vv_499;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_400, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_400);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_401, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_401);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_402, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_402);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_403, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_403);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_404, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_404);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_405, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_405);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_406, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_406);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_407, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_407);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_408, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_408);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_409, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_409);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_410, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_410);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_411, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_411);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_412, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_412);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_413, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_413);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_414, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_414);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_415, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_415);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_416, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_416);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_417, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_417);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_418, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_418);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_419, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_419);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_420, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_420);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_421, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_421);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_422, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_422);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_423, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_423);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_424, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_424);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_425, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_425);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_426, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_426);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_427, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_427);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_428, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_428);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_429, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_429);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_430, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_430);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_431, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_431);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_432, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_432);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_433, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_433);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_434, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_434);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_435, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_435);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_436, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_436);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_437, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_437);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_438, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_438);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_439, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_439);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_440, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_440);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_441, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_441);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_442, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_442);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_443, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_443);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_444, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_444);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_445, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_445);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_446, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_446);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_447, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_447);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_448, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_448);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_449, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_449);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_450, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_450);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_451, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_451);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_452, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_452);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_453, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_453);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_454, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_454);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_455, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_455);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_456, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_456);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_457, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_457);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_458, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_458);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_459, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_459);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_460, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_460);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_461, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_461);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_462, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_462);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_463, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_463);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_464, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_464);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_465, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_465);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_466, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_466);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_467, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_467);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_468, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_468);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_469, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_469);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_470, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_470);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_471, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_471);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_472, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_472);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_473, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_473);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_474, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_474);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_475, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_475);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_476, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_476);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_477, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_477);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_478, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_478);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_479, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_479);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_480, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_480);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_481, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_481);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_482, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_482);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_483, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_483);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_484, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_484);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_485, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_485);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_486, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_486);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_487, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_487);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_488, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_488);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_489, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_489);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_490, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_490);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_491, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_491);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_492, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_492);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_493, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_493);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_494, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_494);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_495, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_495);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_496, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_496);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_497, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_497);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_498, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_498);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_499, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_499);
+
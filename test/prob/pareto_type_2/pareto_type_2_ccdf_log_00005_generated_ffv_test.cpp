@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_ccdf_log_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_500;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty, empty> type_ffv_501;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_502;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_503;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_504;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_505;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_506;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_507;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_508;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_509;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_510;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_511;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_512;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty, empty> type_ffv_513;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_514;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_515;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_516;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_517;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_518;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_519;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_520;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_521;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_522;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_523;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_524;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_525;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_526;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_527;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_528;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_529;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_530;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty, empty> type_ffv_531;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_ffv_532;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_533;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_534;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_535;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_536;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_ffv_537;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_538;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_539;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_540;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_541;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_542;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_543;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_544;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_545;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_546;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_547;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_548;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_549;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_550;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_551;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_552;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_553;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_554;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_555;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_556;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_557;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_558;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_559;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_560;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_561;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_562;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_563;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_564;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_565;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_566;
+typedef std::tuple<fvar<fvar<var> >, double, double, double, empty, empty> type_ffv_567;
+typedef std::tuple<fvar<fvar<var> >, double, double, std::vector<double>, empty, empty> type_ffv_568;
+typedef std::tuple<fvar<fvar<var> >, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_569;
+typedef std::tuple<fvar<fvar<var> >, double, double, fvar<fvar<var> >, empty, empty> type_ffv_570;
+typedef std::tuple<fvar<fvar<var> >, double, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_571;
+typedef std::tuple<fvar<fvar<var> >, double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_572;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<double>, double, empty, empty> type_ffv_573;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<double>, std::vector<double>, empty, empty> type_ffv_574;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_575;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_576;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_577;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_578;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_579;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_580;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_581;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_582;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_583;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_584;
+typedef std::tuple<fvar<fvar<var> >, double, fvar<fvar<var> >, double, empty, empty> type_ffv_585;
+typedef std::tuple<fvar<fvar<var> >, double, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_586;
+typedef std::tuple<fvar<fvar<var> >, double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_587;
+typedef std::tuple<fvar<fvar<var> >, double, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_588;
+typedef std::tuple<fvar<fvar<var> >, double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_589;
+typedef std::tuple<fvar<fvar<var> >, double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_590;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_591;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_592;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_593;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_594;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_595;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_596;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_597;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_598;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_599;
+
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_500> AgradCcdfLogParetoType2_ffv_500;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_501> AgradCcdfLogParetoType2_ffv_501;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_502> AgradCcdfLogParetoType2_ffv_502;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_503> AgradCcdfLogParetoType2_ffv_503;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_504> AgradCcdfLogParetoType2_ffv_504;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_505> AgradCcdfLogParetoType2_ffv_505;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_506> AgradCcdfLogParetoType2_ffv_506;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_507> AgradCcdfLogParetoType2_ffv_507;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_508> AgradCcdfLogParetoType2_ffv_508;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_509> AgradCcdfLogParetoType2_ffv_509;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_510> AgradCcdfLogParetoType2_ffv_510;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_511> AgradCcdfLogParetoType2_ffv_511;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_512> AgradCcdfLogParetoType2_ffv_512;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_513> AgradCcdfLogParetoType2_ffv_513;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_514> AgradCcdfLogParetoType2_ffv_514;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_515> AgradCcdfLogParetoType2_ffv_515;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_516> AgradCcdfLogParetoType2_ffv_516;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_517> AgradCcdfLogParetoType2_ffv_517;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_518> AgradCcdfLogParetoType2_ffv_518;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_519> AgradCcdfLogParetoType2_ffv_519;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_520> AgradCcdfLogParetoType2_ffv_520;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_521> AgradCcdfLogParetoType2_ffv_521;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_522> AgradCcdfLogParetoType2_ffv_522;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_523> AgradCcdfLogParetoType2_ffv_523;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_524> AgradCcdfLogParetoType2_ffv_524;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_525> AgradCcdfLogParetoType2_ffv_525;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_526> AgradCcdfLogParetoType2_ffv_526;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_527> AgradCcdfLogParetoType2_ffv_527;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_528> AgradCcdfLogParetoType2_ffv_528;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_529> AgradCcdfLogParetoType2_ffv_529;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_530> AgradCcdfLogParetoType2_ffv_530;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_531> AgradCcdfLogParetoType2_ffv_531;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_532> AgradCcdfLogParetoType2_ffv_532;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_533> AgradCcdfLogParetoType2_ffv_533;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_534> AgradCcdfLogParetoType2_ffv_534;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_535> AgradCcdfLogParetoType2_ffv_535;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_536> AgradCcdfLogParetoType2_ffv_536;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_537> AgradCcdfLogParetoType2_ffv_537;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_538> AgradCcdfLogParetoType2_ffv_538;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_539> AgradCcdfLogParetoType2_ffv_539;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_540> AgradCcdfLogParetoType2_ffv_540;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_541> AgradCcdfLogParetoType2_ffv_541;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_542> AgradCcdfLogParetoType2_ffv_542;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_543> AgradCcdfLogParetoType2_ffv_543;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_544> AgradCcdfLogParetoType2_ffv_544;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_545> AgradCcdfLogParetoType2_ffv_545;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_546> AgradCcdfLogParetoType2_ffv_546;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_547> AgradCcdfLogParetoType2_ffv_547;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_548> AgradCcdfLogParetoType2_ffv_548;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_549> AgradCcdfLogParetoType2_ffv_549;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_550> AgradCcdfLogParetoType2_ffv_550;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_551> AgradCcdfLogParetoType2_ffv_551;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_552> AgradCcdfLogParetoType2_ffv_552;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_553> AgradCcdfLogParetoType2_ffv_553;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_554> AgradCcdfLogParetoType2_ffv_554;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_555> AgradCcdfLogParetoType2_ffv_555;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_556> AgradCcdfLogParetoType2_ffv_556;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_557> AgradCcdfLogParetoType2_ffv_557;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_558> AgradCcdfLogParetoType2_ffv_558;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_559> AgradCcdfLogParetoType2_ffv_559;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_560> AgradCcdfLogParetoType2_ffv_560;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_561> AgradCcdfLogParetoType2_ffv_561;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_562> AgradCcdfLogParetoType2_ffv_562;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_563> AgradCcdfLogParetoType2_ffv_563;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_564> AgradCcdfLogParetoType2_ffv_564;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_565> AgradCcdfLogParetoType2_ffv_565;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_566> AgradCcdfLogParetoType2_ffv_566;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_567> AgradCcdfLogParetoType2_ffv_567;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_568> AgradCcdfLogParetoType2_ffv_568;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_569> AgradCcdfLogParetoType2_ffv_569;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_570> AgradCcdfLogParetoType2_ffv_570;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_571> AgradCcdfLogParetoType2_ffv_571;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_572> AgradCcdfLogParetoType2_ffv_572;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_573> AgradCcdfLogParetoType2_ffv_573;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_574> AgradCcdfLogParetoType2_ffv_574;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_575> AgradCcdfLogParetoType2_ffv_575;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_576> AgradCcdfLogParetoType2_ffv_576;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_577> AgradCcdfLogParetoType2_ffv_577;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_578> AgradCcdfLogParetoType2_ffv_578;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_579> AgradCcdfLogParetoType2_ffv_579;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_580> AgradCcdfLogParetoType2_ffv_580;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_581> AgradCcdfLogParetoType2_ffv_581;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_582> AgradCcdfLogParetoType2_ffv_582;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_583> AgradCcdfLogParetoType2_ffv_583;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_584> AgradCcdfLogParetoType2_ffv_584;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_585> AgradCcdfLogParetoType2_ffv_585;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_586> AgradCcdfLogParetoType2_ffv_586;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_587> AgradCcdfLogParetoType2_ffv_587;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_588> AgradCcdfLogParetoType2_ffv_588;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_589> AgradCcdfLogParetoType2_ffv_589;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_590> AgradCcdfLogParetoType2_ffv_590;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_591> AgradCcdfLogParetoType2_ffv_591;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_592> AgradCcdfLogParetoType2_ffv_592;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_593> AgradCcdfLogParetoType2_ffv_593;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_594> AgradCcdfLogParetoType2_ffv_594;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_595> AgradCcdfLogParetoType2_ffv_595;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_596> AgradCcdfLogParetoType2_ffv_596;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_597> AgradCcdfLogParetoType2_ffv_597;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_598> AgradCcdfLogParetoType2_ffv_598;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_599> AgradCcdfLogParetoType2_ffv_599;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_500, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_500);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_501, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_501);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_502, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_502);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_503, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_503);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_504, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_504);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_505, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_505);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_506, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_506);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_507, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_507);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_508, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_508);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_509, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_509);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_510, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_510);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_511, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_511);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_512, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_512);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_513, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_513);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_514, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_514);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_515, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_515);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_516, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_516);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_517, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_517);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_518, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_518);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_519, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_519);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_520, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_520);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_521, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_521);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_522, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_522);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_523, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_523);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_524, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_524);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_525, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_525);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_526, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_526);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_527, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_527);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_528, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_528);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_529, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_529);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_530, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_530);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_531, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_531);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_532, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_532);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_533, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_533);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_534, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_534);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_535, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_535);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_536, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_536);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_537, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_537);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_538, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_538);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_539, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_539);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_540, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_540);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_541, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_541);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_542, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_542);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_543, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_543);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_544, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_544);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_545, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_545);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_546, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_546);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_547, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_547);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_548, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_548);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_549, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_549);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_550, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_550);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_551, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_551);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_552, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_552);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_553, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_553);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_554, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_554);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_555, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_555);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_556, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_556);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_557, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_557);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_558, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_558);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_559, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_559);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_560, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_560);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_561, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_561);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_562, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_562);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_563, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_563);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_564, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_564);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_565, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_565);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_566, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_566);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_567, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_567);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_568, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_568);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_569, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_569);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_570, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_570);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_571, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_571);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_572, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_572);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_573, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_573);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_574, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_574);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_575, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_575);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_576, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_576);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_577, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_577);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_578, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_578);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_579, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_579);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_580, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_580);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_581, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_581);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_582, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_582);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_583, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_583);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_584, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_584);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_585, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_585);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_586, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_586);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_587, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_587);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_588, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_588);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_589, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_589);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_590, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_590);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_591, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_591);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_592, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_592);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_593, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_593);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_594, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_594);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_595, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_595);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_596, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_596);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_597, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_597);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_598, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_598);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_599, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_599);
+
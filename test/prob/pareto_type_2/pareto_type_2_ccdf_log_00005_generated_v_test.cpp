@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_ccdf_log_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_500;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_501;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_502;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_503;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_504;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_505;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_506;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_507;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_508;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_509;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_510;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_511;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_512;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_513;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_514;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_515;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_516;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_517;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_518;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_519;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_520;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_521;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_522;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_523;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_524;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_525;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_526;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_527;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_528;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_529;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_530;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_531;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_532;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_533;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_534;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_535;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_536;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_537;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_538;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_539;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, double, empty, empty> type_v_540;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, std::vector<double>, empty, empty> type_v_541;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_542;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, var, empty, empty> type_v_543;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, std::vector<var>, empty, empty> type_v_544;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_545;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, double, empty, empty> type_v_546;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, std::vector<double>, empty, empty> type_v_547;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_548;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, var, empty, empty> type_v_549;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, std::vector<var>, empty, empty> type_v_550;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_551;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_552;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_553;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_554;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_555;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_556;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_557;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, double, empty, empty> type_v_558;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, std::vector<double>, empty, empty> type_v_559;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_560;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, var, empty, empty> type_v_561;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, std::vector<var>, empty, empty> type_v_562;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_563;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, double, empty, empty> type_v_564;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, std::vector<double>, empty, empty> type_v_565;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_566;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, var, empty, empty> type_v_567;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, std::vector<var>, empty, empty> type_v_568;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_569;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_570;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_571;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_572;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_573;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_574;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_575;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, double, empty, empty> type_v_576;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, std::vector<double>, empty, empty> type_v_577;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_578;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, var, empty, empty> type_v_579;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, std::vector<var>, empty, empty> type_v_580;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_581;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, double, empty, empty> type_v_582;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_v_583;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_584;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, var, empty, empty> type_v_585;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_v_586;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_587;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_588;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_589;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_590;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_591;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_592;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_593;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, double, empty, empty> type_v_594;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, std::vector<double>, empty, empty> type_v_595;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_596;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, var, empty, empty> type_v_597;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, std::vector<var>, empty, empty> type_v_598;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_599;
+
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_500> AgradCcdfLogParetoType2_v_500;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_501> AgradCcdfLogParetoType2_v_501;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_502> AgradCcdfLogParetoType2_v_502;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_503> AgradCcdfLogParetoType2_v_503;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_504> AgradCcdfLogParetoType2_v_504;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_505> AgradCcdfLogParetoType2_v_505;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_506> AgradCcdfLogParetoType2_v_506;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_507> AgradCcdfLogParetoType2_v_507;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_508> AgradCcdfLogParetoType2_v_508;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_509> AgradCcdfLogParetoType2_v_509;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_510> AgradCcdfLogParetoType2_v_510;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_511> AgradCcdfLogParetoType2_v_511;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_512> AgradCcdfLogParetoType2_v_512;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_513> AgradCcdfLogParetoType2_v_513;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_514> AgradCcdfLogParetoType2_v_514;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_515> AgradCcdfLogParetoType2_v_515;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_516> AgradCcdfLogParetoType2_v_516;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_517> AgradCcdfLogParetoType2_v_517;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_518> AgradCcdfLogParetoType2_v_518;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_519> AgradCcdfLogParetoType2_v_519;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_520> AgradCcdfLogParetoType2_v_520;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_521> AgradCcdfLogParetoType2_v_521;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_522> AgradCcdfLogParetoType2_v_522;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_523> AgradCcdfLogParetoType2_v_523;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_524> AgradCcdfLogParetoType2_v_524;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_525> AgradCcdfLogParetoType2_v_525;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_526> AgradCcdfLogParetoType2_v_526;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_527> AgradCcdfLogParetoType2_v_527;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_528> AgradCcdfLogParetoType2_v_528;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_529> AgradCcdfLogParetoType2_v_529;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_530> AgradCcdfLogParetoType2_v_530;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_531> AgradCcdfLogParetoType2_v_531;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_532> AgradCcdfLogParetoType2_v_532;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_533> AgradCcdfLogParetoType2_v_533;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_534> AgradCcdfLogParetoType2_v_534;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_535> AgradCcdfLogParetoType2_v_535;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_536> AgradCcdfLogParetoType2_v_536;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_537> AgradCcdfLogParetoType2_v_537;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_538> AgradCcdfLogParetoType2_v_538;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_539> AgradCcdfLogParetoType2_v_539;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_540> AgradCcdfLogParetoType2_v_540;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_541> AgradCcdfLogParetoType2_v_541;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_542> AgradCcdfLogParetoType2_v_542;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_543> AgradCcdfLogParetoType2_v_543;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_544> AgradCcdfLogParetoType2_v_544;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_545> AgradCcdfLogParetoType2_v_545;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_546> AgradCcdfLogParetoType2_v_546;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_547> AgradCcdfLogParetoType2_v_547;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_548> AgradCcdfLogParetoType2_v_548;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_549> AgradCcdfLogParetoType2_v_549;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_550> AgradCcdfLogParetoType2_v_550;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_551> AgradCcdfLogParetoType2_v_551;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_552> AgradCcdfLogParetoType2_v_552;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_553> AgradCcdfLogParetoType2_v_553;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_554> AgradCcdfLogParetoType2_v_554;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_555> AgradCcdfLogParetoType2_v_555;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_556> AgradCcdfLogParetoType2_v_556;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_557> AgradCcdfLogParetoType2_v_557;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_558> AgradCcdfLogParetoType2_v_558;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_559> AgradCcdfLogParetoType2_v_559;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_560> AgradCcdfLogParetoType2_v_560;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_561> AgradCcdfLogParetoType2_v_561;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_562> AgradCcdfLogParetoType2_v_562;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_563> AgradCcdfLogParetoType2_v_563;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_564> AgradCcdfLogParetoType2_v_564;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_565> AgradCcdfLogParetoType2_v_565;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_566> AgradCcdfLogParetoType2_v_566;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_567> AgradCcdfLogParetoType2_v_567;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_568> AgradCcdfLogParetoType2_v_568;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_569> AgradCcdfLogParetoType2_v_569;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_570> AgradCcdfLogParetoType2_v_570;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_571> AgradCcdfLogParetoType2_v_571;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_572> AgradCcdfLogParetoType2_v_572;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_573> AgradCcdfLogParetoType2_v_573;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_574> AgradCcdfLogParetoType2_v_574;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_575> AgradCcdfLogParetoType2_v_575;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_576> AgradCcdfLogParetoType2_v_576;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_577> AgradCcdfLogParetoType2_v_577;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_578> AgradCcdfLogParetoType2_v_578;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_579> AgradCcdfLogParetoType2_v_579;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_580> AgradCcdfLogParetoType2_v_580;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_581> AgradCcdfLogParetoType2_v_581;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_582> AgradCcdfLogParetoType2_v_582;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_583> AgradCcdfLogParetoType2_v_583;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_584> AgradCcdfLogParetoType2_v_584;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_585> AgradCcdfLogParetoType2_v_585;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_586> AgradCcdfLogParetoType2_v_586;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_587> AgradCcdfLogParetoType2_v_587;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_588> AgradCcdfLogParetoType2_v_588;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_589> AgradCcdfLogParetoType2_v_589;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_590> AgradCcdfLogParetoType2_v_590;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_591> AgradCcdfLogParetoType2_v_591;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_592> AgradCcdfLogParetoType2_v_592;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_593> AgradCcdfLogParetoType2_v_593;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_594> AgradCcdfLogParetoType2_v_594;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_595> AgradCcdfLogParetoType2_v_595;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_596> AgradCcdfLogParetoType2_v_596;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_597> AgradCcdfLogParetoType2_v_597;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_598> AgradCcdfLogParetoType2_v_598;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_599> AgradCcdfLogParetoType2_v_599;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_500, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_500);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_501, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_501);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_502, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_502);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_503, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_503);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_504, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_504);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_505, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_505);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_506, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_506);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_507, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_507);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_508, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_508);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_509, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_509);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_510, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_510);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_511, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_511);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_512, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_512);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_513, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_513);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_514, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_514);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_515, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_515);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_516, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_516);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_517, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_517);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_518, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_518);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_519, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_519);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_520, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_520);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_521, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_521);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_522, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_522);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_523, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_523);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_524, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_524);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_525, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_525);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_526, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_526);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_527, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_527);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_528, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_528);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_529, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_529);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_530, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_530);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_531, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_531);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_532, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_532);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_533, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_533);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_534, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_534);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_535, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_535);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_536, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_536);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_537, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_537);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_538, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_538);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_539, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_539);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_540, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_540);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_541, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_541);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_542, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_542);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_543, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_543);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_544, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_544);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_545, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_545);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_546, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_546);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_547, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_547);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_548, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_548);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_549, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_549);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_550, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_550);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_551, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_551);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_552, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_552);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_553, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_553);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_554, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_554);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_555, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_555);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_556, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_556);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_557, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_557);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_558, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_558);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_559, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_559);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_560, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_560);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_561, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_561);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_562, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_562);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_563, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_563);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_564, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_564);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_565, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_565);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_566, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_566);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_567, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_567);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_568, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_568);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_569, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_569);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_570, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_570);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_571, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_571);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_572, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_572);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_573, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_573);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_574, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_574);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_575, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_575);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_576, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_576);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_577, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_577);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_578, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_578);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_579, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_579);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_580, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_580);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_581, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_581);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_582, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_582);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_583, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_583);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_584, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_584);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_585, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_585);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_586, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_586);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_587, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_587);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_588, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_588);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_589, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_589);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_590, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_590);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_591, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_591);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_592, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_592);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_593, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_593);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_594, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_594);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_595, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_595);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_596, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_596);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_597, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_597);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_598, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_598);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_599, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_599);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_ccdf_log_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_500;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, double, empty, empty> type_vv_501;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_vv_502;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_503;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, var, empty, empty> type_vv_504;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_vv_505;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_506;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_507;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_508;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_509;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_510;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_511;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_512;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, double, empty, empty> type_vv_513;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, std::vector<double>, empty, empty> type_vv_514;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_515;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, var, empty, empty> type_vv_516;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, std::vector<var>, empty, empty> type_vv_517;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_518;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, double, empty, empty> type_vv_519;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_vv_520;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_521;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, var, empty, empty> type_vv_522;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_vv_523;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_524;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_525;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_526;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_527;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_528;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_529;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_530;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, empty, empty> type_vv_531;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, empty, empty> type_vv_532;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_533;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, empty, empty> type_vv_534;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, empty, empty> type_vv_535;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_536;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, empty, empty> type_vv_537;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, empty, empty> type_vv_538;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_539;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, empty, empty> type_vv_540;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, empty, empty> type_vv_541;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_542;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_543;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_544;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_545;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_546;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_547;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_548;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, empty, empty> type_vv_549;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, empty, empty> type_vv_550;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_551;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, empty, empty> type_vv_552;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, empty, empty> type_vv_553;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_554;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, empty, empty> type_vv_555;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, empty, empty> type_vv_556;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_557;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, empty, empty> type_vv_558;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, empty, empty> type_vv_559;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_560;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_561;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_562;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_563;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_564;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_565;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_566;
+typedef std::tuple<var, double, double, double, empty, empty> type_vv_567;
+typedef std::tuple<var, double, double, std::vector<double>, empty, empty> type_vv_568;
+typedef std::tuple<var, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_569;
+typedef std::tuple<var, double, double, var, empty, empty> type_vv_570;
+typedef std::tuple<var, double, double, std::vector<var>, empty, empty> type_vv_571;
+typedef std::tuple<var, double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_572;
+typedef std::tuple<var, double, std::vector<double>, double, empty, empty> type_vv_573;
+typedef std::tuple<var, double, std::vector<double>, std::vector<double>, empty, empty> type_vv_574;
+typedef std::tuple<var, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_575;
+typedef std::tuple<var, double, std::vector<double>, var, empty, empty> type_vv_576;
+typedef std::tuple<var, double, std::vector<double>, std::vector<var>, empty, empty> type_vv_577;
+typedef std::tuple<var, double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_578;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_579;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_580;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_581;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_582;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_583;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_584;
+typedef std::tuple<var, double, var, double, empty, empty> type_vv_585;
+typedef std::tuple<var, double, var, std::vector<double>, empty, empty> type_vv_586;
+typedef std::tuple<var, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_587;
+typedef std::tuple<var, double, var, var, empty, empty> type_vv_588;
+typedef std::tuple<var, double, var, std::vector<var>, empty, empty> type_vv_589;
+typedef std::tuple<var, double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_590;
+typedef std::tuple<var, double, std::vector<var>, double, empty, empty> type_vv_591;
+typedef std::tuple<var, double, std::vector<var>, std::vector<double>, empty, empty> type_vv_592;
+typedef std::tuple<var, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_593;
+typedef std::tuple<var, double, std::vector<var>, var, empty, empty> type_vv_594;
+typedef std::tuple<var, double, std::vector<var>, std::vector<var>, empty, empty> type_vv_595;
+typedef std::tuple<var, double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_596;
+typedef std::tuple<var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_597;
+typedef std::tuple<var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_598;
+typedef std::tuple<var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_599;
+
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_500> AgradCcdfLogParetoType2_vv_500;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_501> AgradCcdfLogParetoType2_vv_501;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_502> AgradCcdfLogParetoType2_vv_502;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_503> AgradCcdfLogParetoType2_vv_503;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_504> AgradCcdfLogParetoType2_vv_504;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_505> AgradCcdfLogParetoType2_vv_505;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_506> AgradCcdfLogParetoType2_vv_506;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_507> AgradCcdfLogParetoType2_vv_507;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_508> AgradCcdfLogParetoType2_vv_508;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_509> AgradCcdfLogParetoType2_vv_509;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_510> AgradCcdfLogParetoType2_vv_510;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_511> AgradCcdfLogParetoType2_vv_511;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_512> AgradCcdfLogParetoType2_vv_512;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_513> AgradCcdfLogParetoType2_vv_513;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_514> AgradCcdfLogParetoType2_vv_514;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_515> AgradCcdfLogParetoType2_vv_515;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_516> AgradCcdfLogParetoType2_vv_516;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_517> AgradCcdfLogParetoType2_vv_517;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_518> AgradCcdfLogParetoType2_vv_518;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_519> AgradCcdfLogParetoType2_vv_519;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_520> AgradCcdfLogParetoType2_vv_520;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_521> AgradCcdfLogParetoType2_vv_521;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_522> AgradCcdfLogParetoType2_vv_522;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_523> AgradCcdfLogParetoType2_vv_523;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_524> AgradCcdfLogParetoType2_vv_524;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_525> AgradCcdfLogParetoType2_vv_525;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_526> AgradCcdfLogParetoType2_vv_526;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_527> AgradCcdfLogParetoType2_vv_527;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_528> AgradCcdfLogParetoType2_vv_528;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_529> AgradCcdfLogParetoType2_vv_529;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_530> AgradCcdfLogParetoType2_vv_530;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_531> AgradCcdfLogParetoType2_vv_531;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_532> AgradCcdfLogParetoType2_vv_532;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_533> AgradCcdfLogParetoType2_vv_533;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_534> AgradCcdfLogParetoType2_vv_534;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_535> AgradCcdfLogParetoType2_vv_535;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_536> AgradCcdfLogParetoType2_vv_536;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_537> AgradCcdfLogParetoType2_vv_537;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_538> AgradCcdfLogParetoType2_vv_538;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_539> AgradCcdfLogParetoType2_vv_539;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_540> AgradCcdfLogParetoType2_vv_540;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_541> AgradCcdfLogParetoType2_vv_541;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_542> AgradCcdfLogParetoType2_vv_542;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_543> AgradCcdfLogParetoType2_vv_543;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_544> AgradCcdfLogParetoType2_vv_544;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_545> AgradCcdfLogParetoType2_vv_545;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_546> AgradCcdfLogParetoType2_vv_546;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_547> AgradCcdfLogParetoType2_vv_547;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_548> AgradCcdfLogParetoType2_vv_548;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_549> AgradCcdfLogParetoType2_vv_549;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_550> AgradCcdfLogParetoType2_vv_550;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_551> AgradCcdfLogParetoType2_vv_551;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_552> AgradCcdfLogParetoType2_vv_552;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_553> AgradCcdfLogParetoType2_vv_553;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_554> AgradCcdfLogParetoType2_vv_554;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_555> AgradCcdfLogParetoType2_vv_555;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_556> AgradCcdfLogParetoType2_vv_556;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_557> AgradCcdfLogParetoType2_vv_557;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_558> AgradCcdfLogParetoType2_vv_558;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_559> AgradCcdfLogParetoType2_vv_559;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_560> AgradCcdfLogParetoType2_vv_560;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_561> AgradCcdfLogParetoType2_vv_561;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_562> AgradCcdfLogParetoType2_vv_562;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_563> AgradCcdfLogParetoType2_vv_563;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_564> AgradCcdfLogParetoType2_vv_564;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_565> AgradCcdfLogParetoType2_vv_565;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_566> AgradCcdfLogParetoType2_vv_566;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_567> AgradCcdfLogParetoType2_vv_567;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_568> AgradCcdfLogParetoType2_vv_568;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_569> AgradCcdfLogParetoType2_vv_569;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_570> AgradCcdfLogParetoType2_vv_570;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_571> AgradCcdfLogParetoType2_vv_571;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_572> AgradCcdfLogParetoType2_vv_572;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_573> AgradCcdfLogParetoType2_vv_573;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_574> AgradCcdfLogParetoType2_vv_574;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_575> AgradCcdfLogParetoType2_vv_575;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_576> AgradCcdfLogParetoType2_vv_576;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_577> AgradCcdfLogParetoType2_vv_577;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_578> AgradCcdfLogParetoType2_vv_578;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_579> AgradCcdfLogParetoType2_vv_579;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_580> AgradCcdfLogParetoType2_vv_580;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_581> AgradCcdfLogParetoType2_vv_581;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_582> AgradCcdfLogParetoType2_vv_582;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_583> AgradCcdfLogParetoType2_vv_583;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_584> AgradCcdfLogParetoType2_vv_584;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_585> AgradCcdfLogParetoType2_vv_585;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_586> AgradCcdfLogParetoType2_vv_586;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_587> AgradCcdfLogParetoType2_vv_587;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_588> AgradCcdfLogParetoType2_vv_588;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_589> AgradCcdfLogParetoType2_vv_589;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_590> AgradCcdfLogParetoType2_vv_590;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_591> AgradCcdfLogParetoType2_vv_591;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_592> AgradCcdfLogParetoType2_vv_592;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_593> AgradCcdfLogParetoType2_vv_593;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_594> AgradCcdfLogParetoType2_vv_594;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_595> AgradCcdfLogParetoType2_vv_595;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_596> AgradCcdfLogParetoType2_vv_596;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_597> AgradCcdfLogParetoType2_vv_597;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_598> AgradCcdfLogParetoType2_vv_598;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_599> AgradCcdfLogParetoType2_vv_599;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_500, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_500);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_501, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_501);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_502, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_502);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_503, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_503);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_504, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_504);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_505, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_505);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_506, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_506);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_507, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_507);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_508, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_508);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_509, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_509);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_510, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_510);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_511, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_511);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_512, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_512);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_513, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_513);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_514, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_514);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_515, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_515);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_516, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_516);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_517, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_517);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_518, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_518);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_519, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_519);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_520, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_520);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_521, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_521);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_522, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_522);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_523, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_523);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_524, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_524);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_525, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_525);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_526, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_526);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_527, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_527);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_528, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_528);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_529, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_529);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_530, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_530);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_531, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_531);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_532, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_532);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_533, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_533);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_534, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_534);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_535, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_535);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_536, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_536);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_537, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_537);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_538, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_538);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_539, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_539);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_540, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_540);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_541, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_541);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_542, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_542);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_543, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_543);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_544, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_544);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_545, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_545);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_546, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_546);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_547, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_547);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_548, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_548);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_549, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_549);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_550, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_550);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_551, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_551);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_552, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_552);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_553, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_553);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_554, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_554);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_555, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_555);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_556, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_556);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_557, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_557);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_558, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_558);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_559, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_559);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_560, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_560);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_561, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_561);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_562, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_562);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_563, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_563);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_564, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_564);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_565, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_565);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_566, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_566);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_567, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_567);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_568, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_568);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_569, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_569);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_570, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_570);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_571, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_571);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_572, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_572);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_573, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_573);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_574, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_574);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_575, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_575);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_576, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_576);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_577, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_577);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_578, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_578);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_579, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_579);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_580, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_580);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_581, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_581);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_582, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_582);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_583, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_583);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_584, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_584);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_585, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_585);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_586, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_586);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_587, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_587);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_588, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_588);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_589, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_589);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_590, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_590);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_591, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_591);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_592, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_592);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_593, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_593);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_594, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_594);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_595, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_595);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_596, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_596);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_597, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_597);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_598, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_598);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_599, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_599);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_ccdf_log_test.hpp>
+
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_600;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_601;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_602;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, double, double, empty, empty> type_ffv_603;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, double, std::vector<double>, empty, empty> type_ffv_604;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_605;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, double, fvar<fvar<var> >, empty, empty> type_ffv_606;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_607;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_608;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<double>, double, empty, empty> type_ffv_609;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_610;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_611;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_612;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_613;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_614;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_615;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_616;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_617;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_618;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_619;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_620;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, double, empty, empty> type_ffv_621;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_622;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_623;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_624;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_625;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_626;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_627;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_628;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_629;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_630;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_631;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_632;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_633;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_634;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_635;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_636;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_637;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_638;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty> type_ffv_639;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_ffv_640;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_641;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_642;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_643;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_644;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_ffv_645;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_646;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_647;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_648;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_649;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_650;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_651;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_652;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_653;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_654;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_655;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_656;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_657;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_658;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_659;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_660;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_661;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_662;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_663;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_664;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_665;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_666;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_667;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_668;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_669;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_670;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_671;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_672;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_673;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_674;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, double, double, empty, empty> type_ffv_675;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, double, std::vector<double>, empty, empty> type_ffv_676;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_677;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, double, fvar<fvar<var> >, empty, empty> type_ffv_678;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_679;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_680;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, double, empty, empty> type_ffv_681;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty, empty> type_ffv_682;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_683;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_684;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_685;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_686;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_687;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_688;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_689;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_690;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_691;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_692;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, double, empty, empty> type_ffv_693;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_694;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_695;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_696;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_697;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_698;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_699;
+
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_600> AgradCcdfLogParetoType2_ffv_600;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_601> AgradCcdfLogParetoType2_ffv_601;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_602> AgradCcdfLogParetoType2_ffv_602;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_603> AgradCcdfLogParetoType2_ffv_603;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_604> AgradCcdfLogParetoType2_ffv_604;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_605> AgradCcdfLogParetoType2_ffv_605;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_606> AgradCcdfLogParetoType2_ffv_606;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_607> AgradCcdfLogParetoType2_ffv_607;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_608> AgradCcdfLogParetoType2_ffv_608;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_609> AgradCcdfLogParetoType2_ffv_609;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_610> AgradCcdfLogParetoType2_ffv_610;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_611> AgradCcdfLogParetoType2_ffv_611;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_612> AgradCcdfLogParetoType2_ffv_612;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_613> AgradCcdfLogParetoType2_ffv_613;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_614> AgradCcdfLogParetoType2_ffv_614;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_615> AgradCcdfLogParetoType2_ffv_615;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_616> AgradCcdfLogParetoType2_ffv_616;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_617> AgradCcdfLogParetoType2_ffv_617;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_618> AgradCcdfLogParetoType2_ffv_618;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_619> AgradCcdfLogParetoType2_ffv_619;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_620> AgradCcdfLogParetoType2_ffv_620;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_621> AgradCcdfLogParetoType2_ffv_621;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_622> AgradCcdfLogParetoType2_ffv_622;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_623> AgradCcdfLogParetoType2_ffv_623;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_624> AgradCcdfLogParetoType2_ffv_624;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_625> AgradCcdfLogParetoType2_ffv_625;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_626> AgradCcdfLogParetoType2_ffv_626;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_627> AgradCcdfLogParetoType2_ffv_627;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_628> AgradCcdfLogParetoType2_ffv_628;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_629> AgradCcdfLogParetoType2_ffv_629;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_630> AgradCcdfLogParetoType2_ffv_630;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_631> AgradCcdfLogParetoType2_ffv_631;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_632> AgradCcdfLogParetoType2_ffv_632;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_633> AgradCcdfLogParetoType2_ffv_633;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_634> AgradCcdfLogParetoType2_ffv_634;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_635> AgradCcdfLogParetoType2_ffv_635;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_636> AgradCcdfLogParetoType2_ffv_636;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_637> AgradCcdfLogParetoType2_ffv_637;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_638> AgradCcdfLogParetoType2_ffv_638;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_639> AgradCcdfLogParetoType2_ffv_639;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_640> AgradCcdfLogParetoType2_ffv_640;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_641> AgradCcdfLogParetoType2_ffv_641;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_642> AgradCcdfLogParetoType2_ffv_642;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_643> AgradCcdfLogParetoType2_ffv_643;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_644> AgradCcdfLogParetoType2_ffv_644;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_645> AgradCcdfLogParetoType2_ffv_645;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_646> AgradCcdfLogParetoType2_ffv_646;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_647> AgradCcdfLogParetoType2_ffv_647;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_648> AgradCcdfLogParetoType2_ffv_648;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_649> AgradCcdfLogParetoType2_ffv_649;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_650> AgradCcdfLogParetoType2_ffv_650;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_651> AgradCcdfLogParetoType2_ffv_651;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_652> AgradCcdfLogParetoType2_ffv_652;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_653> AgradCcdfLogParetoType2_ffv_653;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_654> AgradCcdfLogParetoType2_ffv_654;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_655> AgradCcdfLogParetoType2_ffv_655;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_656> AgradCcdfLogParetoType2_ffv_656;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_657> AgradCcdfLogParetoType2_ffv_657;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_658> AgradCcdfLogParetoType2_ffv_658;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_659> AgradCcdfLogParetoType2_ffv_659;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_660> AgradCcdfLogParetoType2_ffv_660;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_661> AgradCcdfLogParetoType2_ffv_661;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_662> AgradCcdfLogParetoType2_ffv_662;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_663> AgradCcdfLogParetoType2_ffv_663;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_664> AgradCcdfLogParetoType2_ffv_664;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_665> AgradCcdfLogParetoType2_ffv_665;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_666> AgradCcdfLogParetoType2_ffv_666;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_667> AgradCcdfLogParetoType2_ffv_667;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_668> AgradCcdfLogParetoType2_ffv_668;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_669> AgradCcdfLogParetoType2_ffv_669;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_670> AgradCcdfLogParetoType2_ffv_670;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_671> AgradCcdfLogParetoType2_ffv_671;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_672> AgradCcdfLogParetoType2_ffv_672;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_673> AgradCcdfLogParetoType2_ffv_673;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_674> AgradCcdfLogParetoType2_ffv_674;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_675> AgradCcdfLogParetoType2_ffv_675;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_676> AgradCcdfLogParetoType2_ffv_676;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_677> AgradCcdfLogParetoType2_ffv_677;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_678> AgradCcdfLogParetoType2_ffv_678;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_679> AgradCcdfLogParetoType2_ffv_679;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_680> AgradCcdfLogParetoType2_ffv_680;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_681> AgradCcdfLogParetoType2_ffv_681;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_682> AgradCcdfLogParetoType2_ffv_682;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_683> AgradCcdfLogParetoType2_ffv_683;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_684> AgradCcdfLogParetoType2_ffv_684;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_685> AgradCcdfLogParetoType2_ffv_685;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_686> AgradCcdfLogParetoType2_ffv_686;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_687> AgradCcdfLogParetoType2_ffv_687;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_688> AgradCcdfLogParetoType2_ffv_688;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_689> AgradCcdfLogParetoType2_ffv_689;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_690> AgradCcdfLogParetoType2_ffv_690;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_691> AgradCcdfLogParetoType2_ffv_691;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_692> AgradCcdfLogParetoType2_ffv_692;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_693> AgradCcdfLogParetoType2_ffv_693;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_694> AgradCcdfLogParetoType2_ffv_694;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_695> AgradCcdfLogParetoType2_ffv_695;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_696> AgradCcdfLogParetoType2_ffv_696;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_697> AgradCcdfLogParetoType2_ffv_697;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_698> AgradCcdfLogParetoType2_ffv_698;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_699> AgradCcdfLogParetoType2_ffv_699;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_600, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_600);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_601, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_601);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_602, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_602);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_603, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_603);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_604, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_604);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_605, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_605);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_606, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_606);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_607, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_607);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_608, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_608);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_609, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_609);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_610, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_610);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_611, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_611);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_612, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_612);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_613, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_613);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_614, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_614);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_615, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_615);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_616, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_616);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_617, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_617);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_618, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_618);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_619, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_619);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_620, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_620);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_621, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_621);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_622, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_622);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_623, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_623);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_624, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_624);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_625, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_625);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_626, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_626);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_627, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_627);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_628, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_628);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_629, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_629);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_630, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_630);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_631, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_631);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_632, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_632);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_633, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_633);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_634, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_634);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_635, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_635);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_636, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_636);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_637, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_637);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_638, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_638);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_639, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_639);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_640, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_640);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_641, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_641);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_642, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_642);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_643, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_643);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_644, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_644);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_645, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_645);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_646, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_646);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_647, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_647);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_648, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_648);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_649, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_649);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_650, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_650);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_651, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_651);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_652, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_652);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_653, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_653);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_654, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_654);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_655, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_655);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_656, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_656);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_657, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_657);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_658, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_658);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_659, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_659);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_660, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_660);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_661, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_661);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_662, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_662);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_663, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_663);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_664, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_664);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_665, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_665);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_666, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_666);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_667, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_667);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_668, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_668);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_669, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_669);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_670, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_670);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_671, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_671);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_672, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_672);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_673, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_673);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_674, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_674);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_675, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_675);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_676, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_676);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_677, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_677);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_678, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_678);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_679, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_679);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_680, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_680);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_681, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_681);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_682, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_682);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_683, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_683);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_684, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_684);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_685, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_685);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_686, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_686);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_687, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_687);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_688, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_688);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_689, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_689);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_690, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_690);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_691, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_691);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_692, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_692);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_693, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_693);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_694, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_694);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_695, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_695);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_696, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_696);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_697, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_697);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_698, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_698);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_699, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_699);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_ccdf_log_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, double, empty, empty> type_v_600;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_v_601;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_602;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, var, empty, empty> type_v_603;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_v_604;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_605;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_606;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_607;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_608;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_609;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_610;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_611;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_612;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_613;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_614;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_615;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_616;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_617;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_618;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_619;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_620;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_621;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_622;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_623;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_624;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_625;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_626;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_627;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_628;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_629;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_630;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_631;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_632;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_633;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_634;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_635;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_636;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_637;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_638;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_639;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_640;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_641;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_642;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_643;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_644;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_645;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_646;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_647;
+typedef std::tuple<var, double, double, double, empty, empty> type_v_648;
+typedef std::tuple<var, double, double, std::vector<double>, empty, empty> type_v_649;
+typedef std::tuple<var, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_650;
+typedef std::tuple<var, double, double, var, empty, empty> type_v_651;
+typedef std::tuple<var, double, double, std::vector<var>, empty, empty> type_v_652;
+typedef std::tuple<var, double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_653;
+typedef std::tuple<var, double, std::vector<double>, double, empty, empty> type_v_654;
+typedef std::tuple<var, double, std::vector<double>, std::vector<double>, empty, empty> type_v_655;
+typedef std::tuple<var, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_656;
+typedef std::tuple<var, double, std::vector<double>, var, empty, empty> type_v_657;
+typedef std::tuple<var, double, std::vector<double>, std::vector<var>, empty, empty> type_v_658;
+typedef std::tuple<var, double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_659;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_660;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_661;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_662;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_663;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_664;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_665;
+typedef std::tuple<var, double, var, double, empty, empty> type_v_666;
+typedef std::tuple<var, double, var, std::vector<double>, empty, empty> type_v_667;
+typedef std::tuple<var, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_668;
+typedef std::tuple<var, double, var, var, empty, empty> type_v_669;
+typedef std::tuple<var, double, var, std::vector<var>, empty, empty> type_v_670;
+typedef std::tuple<var, double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_671;
+typedef std::tuple<var, double, std::vector<var>, double, empty, empty> type_v_672;
+typedef std::tuple<var, double, std::vector<var>, std::vector<double>, empty, empty> type_v_673;
+typedef std::tuple<var, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_674;
+typedef std::tuple<var, double, std::vector<var>, var, empty, empty> type_v_675;
+typedef std::tuple<var, double, std::vector<var>, std::vector<var>, empty, empty> type_v_676;
+typedef std::tuple<var, double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_677;
+typedef std::tuple<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_678;
+typedef std::tuple<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_679;
+typedef std::tuple<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_680;
+typedef std::tuple<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_681;
+typedef std::tuple<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_682;
+typedef std::tuple<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_683;
+typedef std::tuple<var, std::vector<double>, double, double, empty, empty> type_v_684;
+typedef std::tuple<var, std::vector<double>, double, std::vector<double>, empty, empty> type_v_685;
+typedef std::tuple<var, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_686;
+typedef std::tuple<var, std::vector<double>, double, var, empty, empty> type_v_687;
+typedef std::tuple<var, std::vector<double>, double, std::vector<var>, empty, empty> type_v_688;
+typedef std::tuple<var, std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_689;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, double, empty, empty> type_v_690;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, std::vector<double>, empty, empty> type_v_691;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_692;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, var, empty, empty> type_v_693;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_v_694;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_695;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_696;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_697;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_698;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_699;
+
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_600> AgradCcdfLogParetoType2_v_600;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_601> AgradCcdfLogParetoType2_v_601;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_602> AgradCcdfLogParetoType2_v_602;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_603> AgradCcdfLogParetoType2_v_603;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_604> AgradCcdfLogParetoType2_v_604;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_605> AgradCcdfLogParetoType2_v_605;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_606> AgradCcdfLogParetoType2_v_606;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_607> AgradCcdfLogParetoType2_v_607;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_608> AgradCcdfLogParetoType2_v_608;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_609> AgradCcdfLogParetoType2_v_609;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_610> AgradCcdfLogParetoType2_v_610;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_611> AgradCcdfLogParetoType2_v_611;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_612> AgradCcdfLogParetoType2_v_612;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_613> AgradCcdfLogParetoType2_v_613;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_614> AgradCcdfLogParetoType2_v_614;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_615> AgradCcdfLogParetoType2_v_615;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_616> AgradCcdfLogParetoType2_v_616;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_617> AgradCcdfLogParetoType2_v_617;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_618> AgradCcdfLogParetoType2_v_618;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_619> AgradCcdfLogParetoType2_v_619;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_620> AgradCcdfLogParetoType2_v_620;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_621> AgradCcdfLogParetoType2_v_621;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_622> AgradCcdfLogParetoType2_v_622;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_623> AgradCcdfLogParetoType2_v_623;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_624> AgradCcdfLogParetoType2_v_624;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_625> AgradCcdfLogParetoType2_v_625;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_626> AgradCcdfLogParetoType2_v_626;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_627> AgradCcdfLogParetoType2_v_627;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_628> AgradCcdfLogParetoType2_v_628;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_629> AgradCcdfLogParetoType2_v_629;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_630> AgradCcdfLogParetoType2_v_630;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_631> AgradCcdfLogParetoType2_v_631;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_632> AgradCcdfLogParetoType2_v_632;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_633> AgradCcdfLogParetoType2_v_633;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_634> AgradCcdfLogParetoType2_v_634;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_635> AgradCcdfLogParetoType2_v_635;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_636> AgradCcdfLogParetoType2_v_636;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_637> AgradCcdfLogParetoType2_v_637;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_638> AgradCcdfLogParetoType2_v_638;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_639> AgradCcdfLogParetoType2_v_639;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_640> AgradCcdfLogParetoType2_v_640;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_641> AgradCcdfLogParetoType2_v_641;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_642> AgradCcdfLogParetoType2_v_642;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_643> AgradCcdfLogParetoType2_v_643;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_644> AgradCcdfLogParetoType2_v_644;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_645> AgradCcdfLogParetoType2_v_645;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_646> AgradCcdfLogParetoType2_v_646;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_647> AgradCcdfLogParetoType2_v_647;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_648> AgradCcdfLogParetoType2_v_648;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_649> AgradCcdfLogParetoType2_v_649;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_650> AgradCcdfLogParetoType2_v_650;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_651> AgradCcdfLogParetoType2_v_651;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_652> AgradCcdfLogParetoType2_v_652;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_653> AgradCcdfLogParetoType2_v_653;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_654> AgradCcdfLogParetoType2_v_654;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_655> AgradCcdfLogParetoType2_v_655;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_656> AgradCcdfLogParetoType2_v_656;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_657> AgradCcdfLogParetoType2_v_657;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_658> AgradCcdfLogParetoType2_v_658;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_659> AgradCcdfLogParetoType2_v_659;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_660> AgradCcdfLogParetoType2_v_660;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_661> AgradCcdfLogParetoType2_v_661;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_662> AgradCcdfLogParetoType2_v_662;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_663> AgradCcdfLogParetoType2_v_663;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_664> AgradCcdfLogParetoType2_v_664;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_665> AgradCcdfLogParetoType2_v_665;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_666> AgradCcdfLogParetoType2_v_666;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_667> AgradCcdfLogParetoType2_v_667;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_668> AgradCcdfLogParetoType2_v_668;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_669> AgradCcdfLogParetoType2_v_669;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_670> AgradCcdfLogParetoType2_v_670;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_671> AgradCcdfLogParetoType2_v_671;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_672> AgradCcdfLogParetoType2_v_672;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_673> AgradCcdfLogParetoType2_v_673;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_674> AgradCcdfLogParetoType2_v_674;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_675> AgradCcdfLogParetoType2_v_675;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_676> AgradCcdfLogParetoType2_v_676;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_677> AgradCcdfLogParetoType2_v_677;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_678> AgradCcdfLogParetoType2_v_678;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_679> AgradCcdfLogParetoType2_v_679;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_680> AgradCcdfLogParetoType2_v_680;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_681> AgradCcdfLogParetoType2_v_681;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_682> AgradCcdfLogParetoType2_v_682;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_683> AgradCcdfLogParetoType2_v_683;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_684> AgradCcdfLogParetoType2_v_684;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_685> AgradCcdfLogParetoType2_v_685;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_686> AgradCcdfLogParetoType2_v_686;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_687> AgradCcdfLogParetoType2_v_687;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_688> AgradCcdfLogParetoType2_v_688;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_689> AgradCcdfLogParetoType2_v_689;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_690> AgradCcdfLogParetoType2_v_690;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_691> AgradCcdfLogParetoType2_v_691;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_692> AgradCcdfLogParetoType2_v_692;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_693> AgradCcdfLogParetoType2_v_693;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_694> AgradCcdfLogParetoType2_v_694;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_695> AgradCcdfLogParetoType2_v_695;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_696> AgradCcdfLogParetoType2_v_696;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_697> AgradCcdfLogParetoType2_v_697;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_698> AgradCcdfLogParetoType2_v_698;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_699> AgradCcdfLogParetoType2_v_699;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_600, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_600);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_601, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_601);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_602, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_602);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_603, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_603);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_604, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_604);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_605, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_605);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_606, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_606);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_607, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_607);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_608, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_608);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_609, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_609);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_610, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_610);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_611, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_611);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_612, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_612);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_613, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_613);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_614, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_614);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_615, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_615);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_616, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_616);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_617, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_617);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_618, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_618);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_619, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_619);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_620, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_620);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_621, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_621);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_622, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_622);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_623, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_623);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_624, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_624);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_625, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_625);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_626, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_626);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_627, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_627);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_628, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_628);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_629, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_629);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_630, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_630);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_631, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_631);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_632, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_632);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_633, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_633);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_634, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_634);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_635, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_635);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_636, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_636);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_637, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_637);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_638, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_638);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_639, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_639);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_640, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_640);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_641, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_641);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_642, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_642);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_643, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_643);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_644, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_644);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_645, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_645);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_646, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_646);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_647, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_647);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_648, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_648);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_649, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_649);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_650, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_650);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_651, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_651);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_652, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_652);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_653, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_653);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_654, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_654);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_655, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_655);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_656, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_656);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_657, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_657);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_658, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_658);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_659, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_659);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_660, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_660);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_661, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_661);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_662, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_662);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_663, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_663);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_664, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_664);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_665, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_665);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_666, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_666);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_667, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_667);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_668, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_668);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_669, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_669);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_670, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_670);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_671, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_671);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_672, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_672);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_673, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_673);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_674, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_674);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_675, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_675);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_676, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_676);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_677, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_677);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_678, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_678);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_679, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_679);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_680, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_680);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_681, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_681);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_682, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_682);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_683, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_683);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_684, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_684);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_685, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_685);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_686, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_686);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_687, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_687);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_688, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_688);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_689, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_689);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_690, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_690);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_691, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_691);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_692, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_692);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_693, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_693);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_694, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_694);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_695, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_695);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_696, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_696);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_697, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_697);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_698, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_698);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_699, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_699);
+
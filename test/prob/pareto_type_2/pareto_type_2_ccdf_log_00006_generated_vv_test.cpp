@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_ccdf_log_test.hpp>
+
+typedef std::tuple<var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_600;
+typedef std::tuple<var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_601;
+typedef std::tuple<var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_602;
+typedef std::tuple<var, std::vector<double>, double, double, empty, empty> type_vv_603;
+typedef std::tuple<var, std::vector<double>, double, std::vector<double>, empty, empty> type_vv_604;
+typedef std::tuple<var, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_605;
+typedef std::tuple<var, std::vector<double>, double, var, empty, empty> type_vv_606;
+typedef std::tuple<var, std::vector<double>, double, std::vector<var>, empty, empty> type_vv_607;
+typedef std::tuple<var, std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_608;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, double, empty, empty> type_vv_609;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, std::vector<double>, empty, empty> type_vv_610;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_611;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, var, empty, empty> type_vv_612;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_vv_613;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_614;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_615;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_616;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_617;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_618;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_619;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_620;
+typedef std::tuple<var, std::vector<double>, var, double, empty, empty> type_vv_621;
+typedef std::tuple<var, std::vector<double>, var, std::vector<double>, empty, empty> type_vv_622;
+typedef std::tuple<var, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_623;
+typedef std::tuple<var, std::vector<double>, var, var, empty, empty> type_vv_624;
+typedef std::tuple<var, std::vector<double>, var, std::vector<var>, empty, empty> type_vv_625;
+typedef std::tuple<var, std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_626;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, double, empty, empty> type_vv_627;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_vv_628;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_629;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, var, empty, empty> type_vv_630;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_vv_631;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_632;
+typedef std::tuple<var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_633;
+typedef std::tuple<var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_634;
+typedef std::tuple<var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_635;
+typedef std::tuple<var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_636;
+typedef std::tuple<var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_637;
+typedef std::tuple<var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_638;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty> type_vv_639;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_vv_640;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_641;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_vv_642;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_vv_643;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_644;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_vv_645;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_vv_646;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_647;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_vv_648;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_vv_649;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_650;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_651;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_652;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_653;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_654;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_655;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_656;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_vv_657;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_vv_658;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_659;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_vv_660;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_vv_661;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_662;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_vv_663;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_vv_664;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_665;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_vv_666;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_vv_667;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_668;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_669;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_670;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_671;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_672;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_673;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_674;
+typedef std::tuple<var, var, double, double, empty, empty> type_vv_675;
+typedef std::tuple<var, var, double, std::vector<double>, empty, empty> type_vv_676;
+typedef std::tuple<var, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_677;
+typedef std::tuple<var, var, double, var, empty, empty> type_vv_678;
+typedef std::tuple<var, var, double, std::vector<var>, empty, empty> type_vv_679;
+typedef std::tuple<var, var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_680;
+typedef std::tuple<var, var, std::vector<double>, double, empty, empty> type_vv_681;
+typedef std::tuple<var, var, std::vector<double>, std::vector<double>, empty, empty> type_vv_682;
+typedef std::tuple<var, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_683;
+typedef std::tuple<var, var, std::vector<double>, var, empty, empty> type_vv_684;
+typedef std::tuple<var, var, std::vector<double>, std::vector<var>, empty, empty> type_vv_685;
+typedef std::tuple<var, var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_686;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_687;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_688;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_689;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_690;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_691;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_692;
+typedef std::tuple<var, var, var, double, empty, empty> type_vv_693;
+typedef std::tuple<var, var, var, std::vector<double>, empty, empty> type_vv_694;
+typedef std::tuple<var, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_695;
+typedef std::tuple<var, var, var, var, empty, empty> type_vv_696;
+typedef std::tuple<var, var, var, std::vector<var>, empty, empty> type_vv_697;
+typedef std::tuple<var, var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_698;
+typedef std::tuple<var, var, std::vector<var>, double, empty, empty> type_vv_699;
+
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_600> AgradCcdfLogParetoType2_vv_600;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_601> AgradCcdfLogParetoType2_vv_601;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_602> AgradCcdfLogParetoType2_vv_602;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_603> AgradCcdfLogParetoType2_vv_603;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_604> AgradCcdfLogParetoType2_vv_604;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_605> AgradCcdfLogParetoType2_vv_605;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_606> AgradCcdfLogParetoType2_vv_606;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_607> AgradCcdfLogParetoType2_vv_607;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_608> AgradCcdfLogParetoType2_vv_608;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_609> AgradCcdfLogParetoType2_vv_609;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_610> AgradCcdfLogParetoType2_vv_610;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_611> AgradCcdfLogParetoType2_vv_611;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_612> AgradCcdfLogParetoType2_vv_612;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_613> AgradCcdfLogParetoType2_vv_613;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_614> AgradCcdfLogParetoType2_vv_614;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_615> AgradCcdfLogParetoType2_vv_615;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_616> AgradCcdfLogParetoType2_vv_616;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_617> AgradCcdfLogParetoType2_vv_617;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_618> AgradCcdfLogParetoType2_vv_618;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_619> AgradCcdfLogParetoType2_vv_619;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_620> AgradCcdfLogParetoType2_vv_620;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_621> AgradCcdfLogParetoType2_vv_621;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_622> AgradCcdfLogParetoType2_vv_622;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_623> AgradCcdfLogParetoType2_vv_623;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_624> AgradCcdfLogParetoType2_vv_624;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_625> AgradCcdfLogParetoType2_vv_625;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_626> AgradCcdfLogParetoType2_vv_626;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_627> AgradCcdfLogParetoType2_vv_627;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_628> AgradCcdfLogParetoType2_vv_628;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_629> AgradCcdfLogParetoType2_vv_629;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_630> AgradCcdfLogParetoType2_vv_630;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_631> AgradCcdfLogParetoType2_vv_631;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_632> AgradCcdfLogParetoType2_vv_632;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_633> AgradCcdfLogParetoType2_vv_633;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_634> AgradCcdfLogParetoType2_vv_634;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_635> AgradCcdfLogParetoType2_vv_635;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_636> AgradCcdfLogParetoType2_vv_636;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_637> AgradCcdfLogParetoType2_vv_637;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_638> AgradCcdfLogParetoType2_vv_638;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_639> AgradCcdfLogParetoType2_vv_639;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_640> AgradCcdfLogParetoType2_vv_640;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_641> AgradCcdfLogParetoType2_vv_641;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_642> AgradCcdfLogParetoType2_vv_642;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_643> AgradCcdfLogParetoType2_vv_643;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_644> AgradCcdfLogParetoType2_vv_644;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_645> AgradCcdfLogParetoType2_vv_645;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_646> AgradCcdfLogParetoType2_vv_646;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_647> AgradCcdfLogParetoType2_vv_647;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_648> AgradCcdfLogParetoType2_vv_648;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_649> AgradCcdfLogParetoType2_vv_649;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_650> AgradCcdfLogParetoType2_vv_650;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_651> AgradCcdfLogParetoType2_vv_651;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_652> AgradCcdfLogParetoType2_vv_652;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_653> AgradCcdfLogParetoType2_vv_653;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_654> AgradCcdfLogParetoType2_vv_654;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_655> AgradCcdfLogParetoType2_vv_655;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_656> AgradCcdfLogParetoType2_vv_656;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_657> AgradCcdfLogParetoType2_vv_657;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_658> AgradCcdfLogParetoType2_vv_658;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_659> AgradCcdfLogParetoType2_vv_659;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_660> AgradCcdfLogParetoType2_vv_660;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_661> AgradCcdfLogParetoType2_vv_661;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_662> AgradCcdfLogParetoType2_vv_662;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_663> AgradCcdfLogParetoType2_vv_663;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_664> AgradCcdfLogParetoType2_vv_664;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_665> AgradCcdfLogParetoType2_vv_665;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_666> AgradCcdfLogParetoType2_vv_666;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_667> AgradCcdfLogParetoType2_vv_667;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_668> AgradCcdfLogParetoType2_vv_668;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_669> AgradCcdfLogParetoType2_vv_669;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_670> AgradCcdfLogParetoType2_vv_670;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_671> AgradCcdfLogParetoType2_vv_671;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_672> AgradCcdfLogParetoType2_vv_672;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_673> AgradCcdfLogParetoType2_vv_673;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_674> AgradCcdfLogParetoType2_vv_674;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_675> AgradCcdfLogParetoType2_vv_675;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_676> AgradCcdfLogParetoType2_vv_676;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_677> AgradCcdfLogParetoType2_vv_677;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_678> AgradCcdfLogParetoType2_vv_678;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_679> AgradCcdfLogParetoType2_vv_679;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_680> AgradCcdfLogParetoType2_vv_680;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_681> AgradCcdfLogParetoType2_vv_681;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_682> AgradCcdfLogParetoType2_vv_682;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_683> AgradCcdfLogParetoType2_vv_683;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_684> AgradCcdfLogParetoType2_vv_684;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_685> AgradCcdfLogParetoType2_vv_685;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_686> AgradCcdfLogParetoType2_vv_686;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_687> AgradCcdfLogParetoType2_vv_687;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_688> AgradCcdfLogParetoType2_vv_688;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_689> AgradCcdfLogParetoType2_vv_689;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_690> AgradCcdfLogParetoType2_vv_690;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_691> AgradCcdfLogParetoType2_vv_691;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_692> AgradCcdfLogParetoType2_vv_692;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_693> AgradCcdfLogParetoType2_vv_693;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_694> AgradCcdfLogParetoType2_vv_694;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_695> AgradCcdfLogParetoType2_vv_695;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_696> AgradCcdfLogParetoType2_vv_696;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_697> AgradCcdfLogParetoType2_vv_697;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_698> AgradCcdfLogParetoType2_vv_698;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_699> AgradCcdfLogParetoType2_vv_699;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_600, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_600);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_601, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_601);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_602, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_602);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_603, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_603);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_604, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_604);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_605, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_605);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_606, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_606);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_607, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_607);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_608, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_608);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_609, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_609);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_610, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_610);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_611, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_611);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_612, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_612);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_613, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_613);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_614, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_614);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_615, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_615);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_616, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_616);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_617, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_617);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_618, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_618);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_619, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_619);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_620, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_620);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_621, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_621);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_622, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_622);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_623, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_623);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_624, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_624);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_625, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_625);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_626, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_626);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_627, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_627);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_628, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_628);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_629, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_629);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_630, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_630);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_631, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_631);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_632, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_632);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_633, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_633);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_634, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_634);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_635, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_635);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_636, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_636);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_637, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_637);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_638, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_638);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_639, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_639);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_640, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_640);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_641, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_641);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_642, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_642);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_643, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_643);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_644, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_644);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_645, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_645);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_646, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_646);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_647, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_647);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_648, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_648);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_649, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_649);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_650, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_650);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_651, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_651);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_652, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_652);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_653, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_653);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_654, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_654);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_655, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_655);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_656, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_656);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_657, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_657);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_658, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_658);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_659, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_659);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_660, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_660);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_661, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_661);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_662, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_662);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_663, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_663);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_664, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_664);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_665, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_665);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_666, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_666);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_667, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_667);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_668, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_668);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_669, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_669);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_670, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_670);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_671, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_671);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_672, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_672);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_673, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_673);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_674, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_674);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_675, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_675);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_676, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_676);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_677, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_677);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_678, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_678);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_679, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_679);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_680, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_680);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_681, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_681);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_682, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_682);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_683, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_683);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_684, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_684);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_685, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_685);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_686, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_686);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_687, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_687);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_688, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_688);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_689, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_689);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_690, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_690);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_691, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_691);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_692, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_692);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_693, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_693);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_694, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_694);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_695, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_695);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_696, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_696);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_697, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_697);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_698, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_698);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_699, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_699);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_ccdf_log_test.hpp>
+
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_700;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_701;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_702;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_703;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_704;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_705;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_706;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_707;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_708;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_709;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_710;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, double, empty, empty> type_ffv_711;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty, empty> type_ffv_712;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_713;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty, empty> type_ffv_714;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_715;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_716;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty, empty> type_ffv_717;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_718;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_719;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_720;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_721;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_722;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_723;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_724;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_725;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_726;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_727;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_728;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty, empty> type_ffv_729;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_730;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_731;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_732;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_733;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_734;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_735;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_736;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_737;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_738;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_739;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_740;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_741;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_742;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_743;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_744;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_745;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_746;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty, empty> type_ffv_747;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_ffv_748;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_749;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_750;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_751;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_752;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_ffv_753;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_754;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_755;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_756;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_757;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_758;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_759;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_760;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_761;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_762;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_763;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_764;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_765;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_766;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_767;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_768;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_769;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_770;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_771;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_772;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_773;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_774;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_775;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_776;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_777;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_778;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_779;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_780;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_781;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_782;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, double, double, empty, empty> type_ffv_783;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, double, std::vector<double>, empty, empty> type_ffv_784;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_785;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, double, fvar<fvar<var> >, empty, empty> type_ffv_786;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_787;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_788;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<double>, double, empty, empty> type_ffv_789;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<double>, std::vector<double>, empty, empty> type_ffv_790;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_791;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_792;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_793;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_794;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_795;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_796;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_797;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_798;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_799;
+
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_700> AgradCcdfLogParetoType2_ffv_700;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_701> AgradCcdfLogParetoType2_ffv_701;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_702> AgradCcdfLogParetoType2_ffv_702;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_703> AgradCcdfLogParetoType2_ffv_703;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_704> AgradCcdfLogParetoType2_ffv_704;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_705> AgradCcdfLogParetoType2_ffv_705;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_706> AgradCcdfLogParetoType2_ffv_706;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_707> AgradCcdfLogParetoType2_ffv_707;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_708> AgradCcdfLogParetoType2_ffv_708;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_709> AgradCcdfLogParetoType2_ffv_709;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_710> AgradCcdfLogParetoType2_ffv_710;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_711> AgradCcdfLogParetoType2_ffv_711;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_712> AgradCcdfLogParetoType2_ffv_712;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_713> AgradCcdfLogParetoType2_ffv_713;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_714> AgradCcdfLogParetoType2_ffv_714;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_715> AgradCcdfLogParetoType2_ffv_715;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_716> AgradCcdfLogParetoType2_ffv_716;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_717> AgradCcdfLogParetoType2_ffv_717;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_718> AgradCcdfLogParetoType2_ffv_718;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_719> AgradCcdfLogParetoType2_ffv_719;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_720> AgradCcdfLogParetoType2_ffv_720;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_721> AgradCcdfLogParetoType2_ffv_721;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_722> AgradCcdfLogParetoType2_ffv_722;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_723> AgradCcdfLogParetoType2_ffv_723;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_724> AgradCcdfLogParetoType2_ffv_724;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_725> AgradCcdfLogParetoType2_ffv_725;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_726> AgradCcdfLogParetoType2_ffv_726;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_727> AgradCcdfLogParetoType2_ffv_727;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_728> AgradCcdfLogParetoType2_ffv_728;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_729> AgradCcdfLogParetoType2_ffv_729;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_730> AgradCcdfLogParetoType2_ffv_730;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_731> AgradCcdfLogParetoType2_ffv_731;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_732> AgradCcdfLogParetoType2_ffv_732;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_733> AgradCcdfLogParetoType2_ffv_733;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_734> AgradCcdfLogParetoType2_ffv_734;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_735> AgradCcdfLogParetoType2_ffv_735;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_736> AgradCcdfLogParetoType2_ffv_736;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_737> AgradCcdfLogParetoType2_ffv_737;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_738> AgradCcdfLogParetoType2_ffv_738;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_739> AgradCcdfLogParetoType2_ffv_739;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_740> AgradCcdfLogParetoType2_ffv_740;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_741> AgradCcdfLogParetoType2_ffv_741;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_742> AgradCcdfLogParetoType2_ffv_742;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_743> AgradCcdfLogParetoType2_ffv_743;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_744> AgradCcdfLogParetoType2_ffv_744;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_745> AgradCcdfLogParetoType2_ffv_745;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_746> AgradCcdfLogParetoType2_ffv_746;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_747> AgradCcdfLogParetoType2_ffv_747;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_748> AgradCcdfLogParetoType2_ffv_748;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_749> AgradCcdfLogParetoType2_ffv_749;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_750> AgradCcdfLogParetoType2_ffv_750;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_751> AgradCcdfLogParetoType2_ffv_751;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_752> AgradCcdfLogParetoType2_ffv_752;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_753> AgradCcdfLogParetoType2_ffv_753;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_754> AgradCcdfLogParetoType2_ffv_754;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_755> AgradCcdfLogParetoType2_ffv_755;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_756> AgradCcdfLogParetoType2_ffv_756;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_757> AgradCcdfLogParetoType2_ffv_757;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_758> AgradCcdfLogParetoType2_ffv_758;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_759> AgradCcdfLogParetoType2_ffv_759;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_760> AgradCcdfLogParetoType2_ffv_760;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_761> AgradCcdfLogParetoType2_ffv_761;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_762> AgradCcdfLogParetoType2_ffv_762;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_763> AgradCcdfLogParetoType2_ffv_763;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_764> AgradCcdfLogParetoType2_ffv_764;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_765> AgradCcdfLogParetoType2_ffv_765;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_766> AgradCcdfLogParetoType2_ffv_766;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_767> AgradCcdfLogParetoType2_ffv_767;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_768> AgradCcdfLogParetoType2_ffv_768;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_769> AgradCcdfLogParetoType2_ffv_769;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_770> AgradCcdfLogParetoType2_ffv_770;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_771> AgradCcdfLogParetoType2_ffv_771;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_772> AgradCcdfLogParetoType2_ffv_772;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_773> AgradCcdfLogParetoType2_ffv_773;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_774> AgradCcdfLogParetoType2_ffv_774;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_775> AgradCcdfLogParetoType2_ffv_775;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_776> AgradCcdfLogParetoType2_ffv_776;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_777> AgradCcdfLogParetoType2_ffv_777;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_778> AgradCcdfLogParetoType2_ffv_778;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_779> AgradCcdfLogParetoType2_ffv_779;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_780> AgradCcdfLogParetoType2_ffv_780;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_781> AgradCcdfLogParetoType2_ffv_781;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_782> AgradCcdfLogParetoType2_ffv_782;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_783> AgradCcdfLogParetoType2_ffv_783;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_784> AgradCcdfLogParetoType2_ffv_784;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_785> AgradCcdfLogParetoType2_ffv_785;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_786> AgradCcdfLogParetoType2_ffv_786;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_787> AgradCcdfLogParetoType2_ffv_787;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_788> AgradCcdfLogParetoType2_ffv_788;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_789> AgradCcdfLogParetoType2_ffv_789;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_790> AgradCcdfLogParetoType2_ffv_790;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_791> AgradCcdfLogParetoType2_ffv_791;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_792> AgradCcdfLogParetoType2_ffv_792;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_793> AgradCcdfLogParetoType2_ffv_793;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_794> AgradCcdfLogParetoType2_ffv_794;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_795> AgradCcdfLogParetoType2_ffv_795;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_796> AgradCcdfLogParetoType2_ffv_796;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_797> AgradCcdfLogParetoType2_ffv_797;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_798> AgradCcdfLogParetoType2_ffv_798;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_799> AgradCcdfLogParetoType2_ffv_799;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_700, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_700);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_701, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_701);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_702, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_702);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_703, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_703);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_704, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_704);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_705, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_705);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_706, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_706);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_707, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_707);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_708, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_708);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_709, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_709);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_710, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_710);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_711, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_711);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_712, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_712);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_713, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_713);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_714, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_714);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_715, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_715);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_716, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_716);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_717, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_717);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_718, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_718);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_719, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_719);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_720, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_720);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_721, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_721);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_722, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_722);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_723, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_723);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_724, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_724);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_725, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_725);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_726, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_726);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_727, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_727);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_728, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_728);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_729, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_729);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_730, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_730);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_731, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_731);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_732, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_732);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_733, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_733);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_734, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_734);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_735, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_735);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_736, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_736);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_737, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_737);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_738, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_738);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_739, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_739);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_740, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_740);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_741, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_741);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_742, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_742);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_743, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_743);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_744, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_744);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_745, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_745);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_746, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_746);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_747, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_747);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_748, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_748);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_749, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_749);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_750, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_750);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_751, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_751);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_752, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_752);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_753, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_753);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_754, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_754);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_755, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_755);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_756, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_756);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_757, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_757);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_758, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_758);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_759, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_759);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_760, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_760);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_761, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_761);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_762, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_762);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_763, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_763);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_764, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_764);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_765, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_765);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_766, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_766);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_767, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_767);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_768, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_768);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_769, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_769);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_770, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_770);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_771, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_771);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_772, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_772);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_773, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_773);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_774, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_774);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_775, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_775);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_776, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_776);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_777, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_777);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_778, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_778);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_779, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_779);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_780, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_780);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_781, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_781);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_782, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_782);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_783, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_783);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_784, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_784);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_785, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_785);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_786, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_786);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_787, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_787);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_788, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_788);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_789, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_789);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_790, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_790);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_791, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_791);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_792, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_792);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_793, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_793);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_794, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_794);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_795, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_795);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_796, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_796);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_797, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_797);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_798, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_798);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_799, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_799);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_ccdf_log_test.hpp>
+
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_700;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_701;
+typedef std::tuple<var, std::vector<double>, var, double, empty, empty> type_v_702;
+typedef std::tuple<var, std::vector<double>, var, std::vector<double>, empty, empty> type_v_703;
+typedef std::tuple<var, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_704;
+typedef std::tuple<var, std::vector<double>, var, var, empty, empty> type_v_705;
+typedef std::tuple<var, std::vector<double>, var, std::vector<var>, empty, empty> type_v_706;
+typedef std::tuple<var, std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_707;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, double, empty, empty> type_v_708;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_v_709;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_710;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, var, empty, empty> type_v_711;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_v_712;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_713;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_714;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_715;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_716;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_717;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_718;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_719;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_720;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_721;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_722;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_723;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_724;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_725;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_726;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_727;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_728;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_729;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_730;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_731;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_732;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_733;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_734;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_735;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_736;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_737;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_738;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_739;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_740;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_741;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_742;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_743;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_744;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_745;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_746;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_747;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_748;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_749;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_750;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_751;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_752;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_753;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_754;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_755;
+typedef std::tuple<var, var, double, double, empty, empty> type_v_756;
+typedef std::tuple<var, var, double, std::vector<double>, empty, empty> type_v_757;
+typedef std::tuple<var, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_758;
+typedef std::tuple<var, var, double, var, empty, empty> type_v_759;
+typedef std::tuple<var, var, double, std::vector<var>, empty, empty> type_v_760;
+typedef std::tuple<var, var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_761;
+typedef std::tuple<var, var, std::vector<double>, double, empty, empty> type_v_762;
+typedef std::tuple<var, var, std::vector<double>, std::vector<double>, empty, empty> type_v_763;
+typedef std::tuple<var, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_764;
+typedef std::tuple<var, var, std::vector<double>, var, empty, empty> type_v_765;
+typedef std::tuple<var, var, std::vector<double>, std::vector<var>, empty, empty> type_v_766;
+typedef std::tuple<var, var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_767;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_768;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_769;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_770;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_771;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_772;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_773;
+typedef std::tuple<var, var, var, double, empty, empty> type_v_774;
+typedef std::tuple<var, var, var, std::vector<double>, empty, empty> type_v_775;
+typedef std::tuple<var, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_776;
+typedef std::tuple<var, var, var, var, empty, empty> type_v_777;
+typedef std::tuple<var, var, var, std::vector<var>, empty, empty> type_v_778;
+typedef std::tuple<var, var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_779;
+typedef std::tuple<var, var, std::vector<var>, double, empty, empty> type_v_780;
+typedef std::tuple<var, var, std::vector<var>, std::vector<double>, empty, empty> type_v_781;
+typedef std::tuple<var, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_782;
+typedef std::tuple<var, var, std::vector<var>, var, empty, empty> type_v_783;
+typedef std::tuple<var, var, std::vector<var>, std::vector<var>, empty, empty> type_v_784;
+typedef std::tuple<var, var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_785;
+typedef std::tuple<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_786;
+typedef std::tuple<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_787;
+typedef std::tuple<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_788;
+typedef std::tuple<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_789;
+typedef std::tuple<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_790;
+typedef std::tuple<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_791;
+typedef std::tuple<var, std::vector<var>, double, double, empty, empty> type_v_792;
+typedef std::tuple<var, std::vector<var>, double, std::vector<double>, empty, empty> type_v_793;
+typedef std::tuple<var, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_794;
+typedef std::tuple<var, std::vector<var>, double, var, empty, empty> type_v_795;
+typedef std::tuple<var, std::vector<var>, double, std::vector<var>, empty, empty> type_v_796;
+typedef std::tuple<var, std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_797;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, double, empty, empty> type_v_798;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_v_799;
+
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_700> AgradCcdfLogParetoType2_v_700;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_701> AgradCcdfLogParetoType2_v_701;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_702> AgradCcdfLogParetoType2_v_702;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_703> AgradCcdfLogParetoType2_v_703;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_704> AgradCcdfLogParetoType2_v_704;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_705> AgradCcdfLogParetoType2_v_705;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_706> AgradCcdfLogParetoType2_v_706;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_707> AgradCcdfLogParetoType2_v_707;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_708> AgradCcdfLogParetoType2_v_708;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_709> AgradCcdfLogParetoType2_v_709;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_710> AgradCcdfLogParetoType2_v_710;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_711> AgradCcdfLogParetoType2_v_711;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_712> AgradCcdfLogParetoType2_v_712;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_713> AgradCcdfLogParetoType2_v_713;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_714> AgradCcdfLogParetoType2_v_714;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_715> AgradCcdfLogParetoType2_v_715;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_716> AgradCcdfLogParetoType2_v_716;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_717> AgradCcdfLogParetoType2_v_717;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_718> AgradCcdfLogParetoType2_v_718;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_719> AgradCcdfLogParetoType2_v_719;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_720> AgradCcdfLogParetoType2_v_720;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_721> AgradCcdfLogParetoType2_v_721;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_722> AgradCcdfLogParetoType2_v_722;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_723> AgradCcdfLogParetoType2_v_723;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_724> AgradCcdfLogParetoType2_v_724;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_725> AgradCcdfLogParetoType2_v_725;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_726> AgradCcdfLogParetoType2_v_726;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_727> AgradCcdfLogParetoType2_v_727;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_728> AgradCcdfLogParetoType2_v_728;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_729> AgradCcdfLogParetoType2_v_729;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_730> AgradCcdfLogParetoType2_v_730;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_731> AgradCcdfLogParetoType2_v_731;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_732> AgradCcdfLogParetoType2_v_732;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_733> AgradCcdfLogParetoType2_v_733;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_734> AgradCcdfLogParetoType2_v_734;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_735> AgradCcdfLogParetoType2_v_735;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_736> AgradCcdfLogParetoType2_v_736;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_737> AgradCcdfLogParetoType2_v_737;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_738> AgradCcdfLogParetoType2_v_738;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_739> AgradCcdfLogParetoType2_v_739;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_740> AgradCcdfLogParetoType2_v_740;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_741> AgradCcdfLogParetoType2_v_741;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_742> AgradCcdfLogParetoType2_v_742;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_743> AgradCcdfLogParetoType2_v_743;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_744> AgradCcdfLogParetoType2_v_744;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_745> AgradCcdfLogParetoType2_v_745;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_746> AgradCcdfLogParetoType2_v_746;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_747> AgradCcdfLogParetoType2_v_747;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_748> AgradCcdfLogParetoType2_v_748;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_749> AgradCcdfLogParetoType2_v_749;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_750> AgradCcdfLogParetoType2_v_750;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_751> AgradCcdfLogParetoType2_v_751;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_752> AgradCcdfLogParetoType2_v_752;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_753> AgradCcdfLogParetoType2_v_753;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_754> AgradCcdfLogParetoType2_v_754;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_755> AgradCcdfLogParetoType2_v_755;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_756> AgradCcdfLogParetoType2_v_756;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_757> AgradCcdfLogParetoType2_v_757;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_758> AgradCcdfLogParetoType2_v_758;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_759> AgradCcdfLogParetoType2_v_759;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_760> AgradCcdfLogParetoType2_v_760;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_761> AgradCcdfLogParetoType2_v_761;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_762> AgradCcdfLogParetoType2_v_762;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_763> AgradCcdfLogParetoType2_v_763;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_764> AgradCcdfLogParetoType2_v_764;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_765> AgradCcdfLogParetoType2_v_765;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_766> AgradCcdfLogParetoType2_v_766;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_767> AgradCcdfLogParetoType2_v_767;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_768> AgradCcdfLogParetoType2_v_768;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_769> AgradCcdfLogParetoType2_v_769;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_770> AgradCcdfLogParetoType2_v_770;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_771> AgradCcdfLogParetoType2_v_771;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_772> AgradCcdfLogParetoType2_v_772;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_773> AgradCcdfLogParetoType2_v_773;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_774> AgradCcdfLogParetoType2_v_774;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_775> AgradCcdfLogParetoType2_v_775;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_776> AgradCcdfLogParetoType2_v_776;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_777> AgradCcdfLogParetoType2_v_777;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_778> AgradCcdfLogParetoType2_v_778;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_779> AgradCcdfLogParetoType2_v_779;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_780> AgradCcdfLogParetoType2_v_780;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_781> AgradCcdfLogParetoType2_v_781;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_782> AgradCcdfLogParetoType2_v_782;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_783> AgradCcdfLogParetoType2_v_783;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_784> AgradCcdfLogParetoType2_v_784;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_785> AgradCcdfLogParetoType2_v_785;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_786> AgradCcdfLogParetoType2_v_786;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_787> AgradCcdfLogParetoType2_v_787;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_788> AgradCcdfLogParetoType2_v_788;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_789> AgradCcdfLogParetoType2_v_789;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_790> AgradCcdfLogParetoType2_v_790;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_791> AgradCcdfLogParetoType2_v_791;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_792> AgradCcdfLogParetoType2_v_792;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_793> AgradCcdfLogParetoType2_v_793;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_794> AgradCcdfLogParetoType2_v_794;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_795> AgradCcdfLogParetoType2_v_795;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_796> AgradCcdfLogParetoType2_v_796;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_797> AgradCcdfLogParetoType2_v_797;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_798> AgradCcdfLogParetoType2_v_798;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_799> AgradCcdfLogParetoType2_v_799;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_700, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_700);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_701, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_701);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_702, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_702);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_703, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_703);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_704, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_704);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_705, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_705);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_706, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_706);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_707, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_707);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_708, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_708);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_709, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_709);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_710, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_710);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_711, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_711);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_712, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_712);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_713, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_713);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_714, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_714);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_715, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_715);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_716, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_716);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_717, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_717);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_718, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_718);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_719, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_719);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_720, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_720);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_721, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_721);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_722, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_722);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_723, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_723);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_724, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_724);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_725, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_725);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_726, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_726);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_727, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_727);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_728, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_728);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_729, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_729);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_730, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_730);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_731, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_731);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_732, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_732);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_733, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_733);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_734, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_734);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_735, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_735);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_736, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_736);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_737, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_737);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_738, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_738);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_739, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_739);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_740, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_740);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_741, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_741);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_742, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_742);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_743, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_743);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_744, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_744);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_745, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_745);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_746, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_746);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_747, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_747);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_748, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_748);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_749, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_749);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_750, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_750);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_751, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_751);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_752, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_752);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_753, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_753);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_754, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_754);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_755, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_755);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_756, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_756);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_757, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_757);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_758, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_758);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_759, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_759);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_760, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_760);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_761, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_761);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_762, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_762);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_763, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_763);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_764, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_764);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_765, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_765);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_766, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_766);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_767, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_767);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_768, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_768);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_769, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_769);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_770, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_770);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_771, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_771);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_772, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_772);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_773, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_773);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_774, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_774);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_775, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_775);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_776, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_776);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_777, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_777);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_778, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_778);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_779, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_779);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_780, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_780);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_781, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_781);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_782, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_782);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_783, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_783);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_784, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_784);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_785, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_785);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_786, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_786);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_787, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_787);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_788, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_788);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_789, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_789);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_790, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_790);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_791, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_791);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_792, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_792);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_793, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_793);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_794, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_794);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_795, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_795);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_796, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_796);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_797, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_797);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_798, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_798);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_799, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_799);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_ccdf_log_test.hpp>
+
+typedef std::tuple<var, var, std::vector<var>, std::vector<double>, empty, empty> type_vv_700;
+typedef std::tuple<var, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_701;
+typedef std::tuple<var, var, std::vector<var>, var, empty, empty> type_vv_702;
+typedef std::tuple<var, var, std::vector<var>, std::vector<var>, empty, empty> type_vv_703;
+typedef std::tuple<var, var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_704;
+typedef std::tuple<var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_705;
+typedef std::tuple<var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_706;
+typedef std::tuple<var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_707;
+typedef std::tuple<var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_708;
+typedef std::tuple<var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_709;
+typedef std::tuple<var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_710;
+typedef std::tuple<var, std::vector<var>, double, double, empty, empty> type_vv_711;
+typedef std::tuple<var, std::vector<var>, double, std::vector<double>, empty, empty> type_vv_712;
+typedef std::tuple<var, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_713;
+typedef std::tuple<var, std::vector<var>, double, var, empty, empty> type_vv_714;
+typedef std::tuple<var, std::vector<var>, double, std::vector<var>, empty, empty> type_vv_715;
+typedef std::tuple<var, std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_716;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, double, empty, empty> type_vv_717;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_vv_718;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_719;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, var, empty, empty> type_vv_720;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_vv_721;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_722;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_723;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_724;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_725;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_726;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_727;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_728;
+typedef std::tuple<var, std::vector<var>, var, double, empty, empty> type_vv_729;
+typedef std::tuple<var, std::vector<var>, var, std::vector<double>, empty, empty> type_vv_730;
+typedef std::tuple<var, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_731;
+typedef std::tuple<var, std::vector<var>, var, var, empty, empty> type_vv_732;
+typedef std::tuple<var, std::vector<var>, var, std::vector<var>, empty, empty> type_vv_733;
+typedef std::tuple<var, std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_734;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, double, empty, empty> type_vv_735;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_vv_736;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_737;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, var, empty, empty> type_vv_738;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_vv_739;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_740;
+typedef std::tuple<var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_741;
+typedef std::tuple<var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_742;
+typedef std::tuple<var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_743;
+typedef std::tuple<var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_744;
+typedef std::tuple<var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_745;
+typedef std::tuple<var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_746;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, empty, empty> type_vv_747;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, empty, empty> type_vv_748;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_749;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, empty, empty> type_vv_750;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, empty, empty> type_vv_751;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_752;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, empty, empty> type_vv_753;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, empty, empty> type_vv_754;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_755;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, empty, empty> type_vv_756;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, empty, empty> type_vv_757;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_758;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_759;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_760;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_761;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_762;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_763;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_764;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, empty, empty> type_vv_765;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, empty, empty> type_vv_766;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_767;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, empty, empty> type_vv_768;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, empty, empty> type_vv_769;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_770;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, empty, empty> type_vv_771;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, empty, empty> type_vv_772;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_773;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, empty, empty> type_vv_774;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, empty, empty> type_vv_775;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_776;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_777;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_778;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_779;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_780;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_781;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_782;
+typedef std::tuple<std::vector<var>, double, double, double, empty, empty> type_vv_783;
+typedef std::tuple<std::vector<var>, double, double, std::vector<double>, empty, empty> type_vv_784;
+typedef std::tuple<std::vector<var>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_785;
+typedef std::tuple<std::vector<var>, double, double, var, empty, empty> type_vv_786;
+typedef std::tuple<std::vector<var>, double, double, std::vector<var>, empty, empty> type_vv_787;
+typedef std::tuple<std::vector<var>, double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_788;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, double, empty, empty> type_vv_789;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, std::vector<double>, empty, empty> type_vv_790;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_791;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, var, empty, empty> type_vv_792;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, std::vector<var>, empty, empty> type_vv_793;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_794;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_795;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_796;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_797;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_798;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_799;
+
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_700> AgradCcdfLogParetoType2_vv_700;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_701> AgradCcdfLogParetoType2_vv_701;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_702> AgradCcdfLogParetoType2_vv_702;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_703> AgradCcdfLogParetoType2_vv_703;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_704> AgradCcdfLogParetoType2_vv_704;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_705> AgradCcdfLogParetoType2_vv_705;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_706> AgradCcdfLogParetoType2_vv_706;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_707> AgradCcdfLogParetoType2_vv_707;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_708> AgradCcdfLogParetoType2_vv_708;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_709> AgradCcdfLogParetoType2_vv_709;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_710> AgradCcdfLogParetoType2_vv_710;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_711> AgradCcdfLogParetoType2_vv_711;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_712> AgradCcdfLogParetoType2_vv_712;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_713> AgradCcdfLogParetoType2_vv_713;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_714> AgradCcdfLogParetoType2_vv_714;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_715> AgradCcdfLogParetoType2_vv_715;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_716> AgradCcdfLogParetoType2_vv_716;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_717> AgradCcdfLogParetoType2_vv_717;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_718> AgradCcdfLogParetoType2_vv_718;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_719> AgradCcdfLogParetoType2_vv_719;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_720> AgradCcdfLogParetoType2_vv_720;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_721> AgradCcdfLogParetoType2_vv_721;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_722> AgradCcdfLogParetoType2_vv_722;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_723> AgradCcdfLogParetoType2_vv_723;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_724> AgradCcdfLogParetoType2_vv_724;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_725> AgradCcdfLogParetoType2_vv_725;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_726> AgradCcdfLogParetoType2_vv_726;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_727> AgradCcdfLogParetoType2_vv_727;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_728> AgradCcdfLogParetoType2_vv_728;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_729> AgradCcdfLogParetoType2_vv_729;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_730> AgradCcdfLogParetoType2_vv_730;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_731> AgradCcdfLogParetoType2_vv_731;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_732> AgradCcdfLogParetoType2_vv_732;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_733> AgradCcdfLogParetoType2_vv_733;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_734> AgradCcdfLogParetoType2_vv_734;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_735> AgradCcdfLogParetoType2_vv_735;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_736> AgradCcdfLogParetoType2_vv_736;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_737> AgradCcdfLogParetoType2_vv_737;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_738> AgradCcdfLogParetoType2_vv_738;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_739> AgradCcdfLogParetoType2_vv_739;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_740> AgradCcdfLogParetoType2_vv_740;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_741> AgradCcdfLogParetoType2_vv_741;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_742> AgradCcdfLogParetoType2_vv_742;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_743> AgradCcdfLogParetoType2_vv_743;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_744> AgradCcdfLogParetoType2_vv_744;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_745> AgradCcdfLogParetoType2_vv_745;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_746> AgradCcdfLogParetoType2_vv_746;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_747> AgradCcdfLogParetoType2_vv_747;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_748> AgradCcdfLogParetoType2_vv_748;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_749> AgradCcdfLogParetoType2_vv_749;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_750> AgradCcdfLogParetoType2_vv_750;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_751> AgradCcdfLogParetoType2_vv_751;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_752> AgradCcdfLogParetoType2_vv_752;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_753> AgradCcdfLogParetoType2_vv_753;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_754> AgradCcdfLogParetoType2_vv_754;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_755> AgradCcdfLogParetoType2_vv_755;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_756> AgradCcdfLogParetoType2_vv_756;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_757> AgradCcdfLogParetoType2_vv_757;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_758> AgradCcdfLogParetoType2_vv_758;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_759> AgradCcdfLogParetoType2_vv_759;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_760> AgradCcdfLogParetoType2_vv_760;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_761> AgradCcdfLogParetoType2_vv_761;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_762> AgradCcdfLogParetoType2_vv_762;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_763> AgradCcdfLogParetoType2_vv_763;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_764> AgradCcdfLogParetoType2_vv_764;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_765> AgradCcdfLogParetoType2_vv_765;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_766> AgradCcdfLogParetoType2_vv_766;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_767> AgradCcdfLogParetoType2_vv_767;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_768> AgradCcdfLogParetoType2_vv_768;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_769> AgradCcdfLogParetoType2_vv_769;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_770> AgradCcdfLogParetoType2_vv_770;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_771> AgradCcdfLogParetoType2_vv_771;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_772> AgradCcdfLogParetoType2_vv_772;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_773> AgradCcdfLogParetoType2_vv_773;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_774> AgradCcdfLogParetoType2_vv_774;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_775> AgradCcdfLogParetoType2_vv_775;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_776> AgradCcdfLogParetoType2_vv_776;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_777> AgradCcdfLogParetoType2_vv_777;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_778> AgradCcdfLogParetoType2_vv_778;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_779> AgradCcdfLogParetoType2_vv_779;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_780> AgradCcdfLogParetoType2_vv_780;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_781> AgradCcdfLogParetoType2_vv_781;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_782> AgradCcdfLogParetoType2_vv_782;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_783> AgradCcdfLogParetoType2_vv_783;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_784> AgradCcdfLogParetoType2_vv_784;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_785> AgradCcdfLogParetoType2_vv_785;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_786> AgradCcdfLogParetoType2_vv_786;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_787> AgradCcdfLogParetoType2_vv_787;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_788> AgradCcdfLogParetoType2_vv_788;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_789> AgradCcdfLogParetoType2_vv_789;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_790> AgradCcdfLogParetoType2_vv_790;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_791> AgradCcdfLogParetoType2_vv_791;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_792> AgradCcdfLogParetoType2_vv_792;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_793> AgradCcdfLogParetoType2_vv_793;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_794> AgradCcdfLogParetoType2_vv_794;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_795> AgradCcdfLogParetoType2_vv_795;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_796> AgradCcdfLogParetoType2_vv_796;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_797> AgradCcdfLogParetoType2_vv_797;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_798> AgradCcdfLogParetoType2_vv_798;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_799> AgradCcdfLogParetoType2_vv_799;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_700, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_700);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_701, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_701);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_702, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_702);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_703, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_703);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_704, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_704);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_705, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_705);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_706, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_706);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_707, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_707);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_708, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_708);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_709, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_709);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_710, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_710);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_711, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_711);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_712, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_712);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_713, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_713);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_714, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_714);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_715, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_715);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_716, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_716);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_717, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_717);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_718, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_718);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_719, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_719);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_720, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_720);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_721, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_721);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_722, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_722);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_723, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_723);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_724, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_724);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_725, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_725);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_726, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_726);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_727, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_727);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_728, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_728);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_729, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_729);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_730, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_730);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_731, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_731);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_732, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_732);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_733, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_733);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_734, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_734);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_735, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_735);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_736, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_736);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_737, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_737);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_738, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_738);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_739, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_739);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_740, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_740);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_741, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_741);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_742, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_742);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_743, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_743);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_744, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_744);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_745, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_745);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_746, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_746);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_747, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_747);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_748, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_748);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_749, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_749);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_750, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_750);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_751, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_751);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_752, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_752);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_753, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_753);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_754, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_754);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_755, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_755);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_756, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_756);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_757, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_757);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_758, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_758);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_759, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_759);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_760, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_760);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_761, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_761);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_762, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_762);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_763, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_763);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_764, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_764);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_765, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_765);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_766, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_766);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_767, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_767);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_768, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_768);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_769, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_769);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_770, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_770);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_771, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_771);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_772, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_772);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_773, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_773);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_774, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_774);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_775, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_775);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_776, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_776);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_777, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_777);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_778, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_778);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_779, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_779);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_780, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_780);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_781, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_781);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_782, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_782);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_783, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_783);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_784, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_784);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_785, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_785);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_786, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_786);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_787, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_787);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_788, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_788);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_789, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_789);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_790, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_790);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_791, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_791);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_792, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_792);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_793, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_793);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_794, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_794);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_795, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_795);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_796, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_796);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_797, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_797);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_798, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_798);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_799, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_799);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_ccdf_log_test.hpp>
+
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_800;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, double, empty, empty> type_ffv_801;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_802;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_803;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_804;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_805;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_806;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_807;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_808;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_809;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_810;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_811;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_812;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_813;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_814;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_815;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_816;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_817;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_818;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, double, double, empty, empty> type_ffv_819;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, double, std::vector<double>, empty, empty> type_ffv_820;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_821;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, double, fvar<fvar<var> >, empty, empty> type_ffv_822;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_823;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_824;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, double, empty, empty> type_ffv_825;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_826;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_827;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_828;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_829;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_830;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_831;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_832;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_833;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_834;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_835;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_836;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, double, empty, empty> type_ffv_837;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_838;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_839;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_840;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_841;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_842;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_843;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_844;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_845;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_846;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_847;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_848;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_849;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_850;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_851;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_852;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_853;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_854;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty> type_ffv_855;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_ffv_856;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_857;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_858;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_859;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_860;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_ffv_861;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_862;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_863;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_864;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_865;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_866;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_867;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_868;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_869;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_870;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_871;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_872;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_873;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_874;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_875;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_876;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_877;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_878;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_879;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_880;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_881;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_882;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_883;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_884;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_885;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_886;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_887;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_888;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_889;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_890;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, double, empty, empty> type_ffv_891;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, std::vector<double>, empty, empty> type_ffv_892;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_893;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, fvar<fvar<var> >, empty, empty> type_ffv_894;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_895;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_896;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, double, empty, empty> type_ffv_897;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty, empty> type_ffv_898;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_899;
+
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_800> AgradCcdfLogParetoType2_ffv_800;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_801> AgradCcdfLogParetoType2_ffv_801;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_802> AgradCcdfLogParetoType2_ffv_802;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_803> AgradCcdfLogParetoType2_ffv_803;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_804> AgradCcdfLogParetoType2_ffv_804;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_805> AgradCcdfLogParetoType2_ffv_805;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_806> AgradCcdfLogParetoType2_ffv_806;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_807> AgradCcdfLogParetoType2_ffv_807;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_808> AgradCcdfLogParetoType2_ffv_808;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_809> AgradCcdfLogParetoType2_ffv_809;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_810> AgradCcdfLogParetoType2_ffv_810;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_811> AgradCcdfLogParetoType2_ffv_811;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_812> AgradCcdfLogParetoType2_ffv_812;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_813> AgradCcdfLogParetoType2_ffv_813;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_814> AgradCcdfLogParetoType2_ffv_814;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_815> AgradCcdfLogParetoType2_ffv_815;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_816> AgradCcdfLogParetoType2_ffv_816;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_817> AgradCcdfLogParetoType2_ffv_817;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_818> AgradCcdfLogParetoType2_ffv_818;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_819> AgradCcdfLogParetoType2_ffv_819;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_820> AgradCcdfLogParetoType2_ffv_820;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_821> AgradCcdfLogParetoType2_ffv_821;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_822> AgradCcdfLogParetoType2_ffv_822;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_823> AgradCcdfLogParetoType2_ffv_823;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_824> AgradCcdfLogParetoType2_ffv_824;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_825> AgradCcdfLogParetoType2_ffv_825;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_826> AgradCcdfLogParetoType2_ffv_826;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_827> AgradCcdfLogParetoType2_ffv_827;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_828> AgradCcdfLogParetoType2_ffv_828;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_829> AgradCcdfLogParetoType2_ffv_829;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_830> AgradCcdfLogParetoType2_ffv_830;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_831> AgradCcdfLogParetoType2_ffv_831;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_832> AgradCcdfLogParetoType2_ffv_832;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_833> AgradCcdfLogParetoType2_ffv_833;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_834> AgradCcdfLogParetoType2_ffv_834;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_835> AgradCcdfLogParetoType2_ffv_835;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_836> AgradCcdfLogParetoType2_ffv_836;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_837> AgradCcdfLogParetoType2_ffv_837;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_838> AgradCcdfLogParetoType2_ffv_838;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_839> AgradCcdfLogParetoType2_ffv_839;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_840> AgradCcdfLogParetoType2_ffv_840;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_841> AgradCcdfLogParetoType2_ffv_841;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_842> AgradCcdfLogParetoType2_ffv_842;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_843> AgradCcdfLogParetoType2_ffv_843;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_844> AgradCcdfLogParetoType2_ffv_844;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_845> AgradCcdfLogParetoType2_ffv_845;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_846> AgradCcdfLogParetoType2_ffv_846;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_847> AgradCcdfLogParetoType2_ffv_847;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_848> AgradCcdfLogParetoType2_ffv_848;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_849> AgradCcdfLogParetoType2_ffv_849;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_850> AgradCcdfLogParetoType2_ffv_850;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_851> AgradCcdfLogParetoType2_ffv_851;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_852> AgradCcdfLogParetoType2_ffv_852;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_853> AgradCcdfLogParetoType2_ffv_853;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_854> AgradCcdfLogParetoType2_ffv_854;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_855> AgradCcdfLogParetoType2_ffv_855;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_856> AgradCcdfLogParetoType2_ffv_856;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_857> AgradCcdfLogParetoType2_ffv_857;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_858> AgradCcdfLogParetoType2_ffv_858;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_859> AgradCcdfLogParetoType2_ffv_859;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_860> AgradCcdfLogParetoType2_ffv_860;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_861> AgradCcdfLogParetoType2_ffv_861;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_862> AgradCcdfLogParetoType2_ffv_862;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_863> AgradCcdfLogParetoType2_ffv_863;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_864> AgradCcdfLogParetoType2_ffv_864;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_865> AgradCcdfLogParetoType2_ffv_865;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_866> AgradCcdfLogParetoType2_ffv_866;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_867> AgradCcdfLogParetoType2_ffv_867;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_868> AgradCcdfLogParetoType2_ffv_868;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_869> AgradCcdfLogParetoType2_ffv_869;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_870> AgradCcdfLogParetoType2_ffv_870;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_871> AgradCcdfLogParetoType2_ffv_871;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_872> AgradCcdfLogParetoType2_ffv_872;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_873> AgradCcdfLogParetoType2_ffv_873;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_874> AgradCcdfLogParetoType2_ffv_874;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_875> AgradCcdfLogParetoType2_ffv_875;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_876> AgradCcdfLogParetoType2_ffv_876;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_877> AgradCcdfLogParetoType2_ffv_877;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_878> AgradCcdfLogParetoType2_ffv_878;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_879> AgradCcdfLogParetoType2_ffv_879;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_880> AgradCcdfLogParetoType2_ffv_880;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_881> AgradCcdfLogParetoType2_ffv_881;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_882> AgradCcdfLogParetoType2_ffv_882;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_883> AgradCcdfLogParetoType2_ffv_883;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_884> AgradCcdfLogParetoType2_ffv_884;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_885> AgradCcdfLogParetoType2_ffv_885;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_886> AgradCcdfLogParetoType2_ffv_886;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_887> AgradCcdfLogParetoType2_ffv_887;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_888> AgradCcdfLogParetoType2_ffv_888;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_889> AgradCcdfLogParetoType2_ffv_889;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_890> AgradCcdfLogParetoType2_ffv_890;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_891> AgradCcdfLogParetoType2_ffv_891;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_892> AgradCcdfLogParetoType2_ffv_892;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_893> AgradCcdfLogParetoType2_ffv_893;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_894> AgradCcdfLogParetoType2_ffv_894;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_895> AgradCcdfLogParetoType2_ffv_895;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_896> AgradCcdfLogParetoType2_ffv_896;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_897> AgradCcdfLogParetoType2_ffv_897;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_898> AgradCcdfLogParetoType2_ffv_898;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_899> AgradCcdfLogParetoType2_ffv_899;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_800, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_800);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_801, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_801);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_802, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_802);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_803, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_803);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_804, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_804);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_805, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_805);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_806, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_806);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_807, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_807);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_808, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_808);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_809, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_809);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_810, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_810);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_811, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_811);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_812, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_812);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_813, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_813);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_814, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_814);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_815, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_815);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_816, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_816);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_817, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_817);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_818, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_818);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_819, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_819);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_820, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_820);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_821, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_821);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_822, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_822);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_823, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_823);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_824, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_824);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_825, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_825);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_826, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_826);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_827, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_827);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_828, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_828);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_829, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_829);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_830, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_830);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_831, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_831);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_832, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_832);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_833, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_833);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_834, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_834);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_835, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_835);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_836, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_836);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_837, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_837);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_838, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_838);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_839, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_839);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_840, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_840);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_841, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_841);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_842, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_842);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_843, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_843);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_844, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_844);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_845, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_845);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_846, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_846);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_847, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_847);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_848, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_848);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_849, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_849);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_850, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_850);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_851, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_851);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_852, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_852);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_853, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_853);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_854, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_854);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_855, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_855);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_856, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_856);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_857, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_857);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_858, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_858);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_859, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_859);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_860, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_860);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_861, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_861);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_862, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_862);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_863, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_863);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_864, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_864);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_865, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_865);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_866, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_866);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_867, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_867);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_868, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_868);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_869, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_869);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_870, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_870);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_871, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_871);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_872, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_872);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_873, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_873);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_874, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_874);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_875, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_875);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_876, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_876);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_877, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_877);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_878, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_878);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_879, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_879);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_880, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_880);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_881, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_881);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_882, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_882);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_883, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_883);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_884, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_884);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_885, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_885);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_886, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_886);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_887, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_887);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_888, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_888);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_889, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_889);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_890, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_890);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_891, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_891);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_892, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_892);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_893, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_893);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_894, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_894);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_895, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_895);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_896, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_896);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_897, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_897);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_898, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_898);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_899, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_899);
+
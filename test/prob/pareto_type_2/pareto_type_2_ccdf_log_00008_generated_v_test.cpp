@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_ccdf_log_test.hpp>
+
+typedef std::tuple<var, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_800;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, var, empty, empty> type_v_801;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_v_802;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_803;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_804;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_805;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_806;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_807;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_808;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_809;
+typedef std::tuple<var, std::vector<var>, var, double, empty, empty> type_v_810;
+typedef std::tuple<var, std::vector<var>, var, std::vector<double>, empty, empty> type_v_811;
+typedef std::tuple<var, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_812;
+typedef std::tuple<var, std::vector<var>, var, var, empty, empty> type_v_813;
+typedef std::tuple<var, std::vector<var>, var, std::vector<var>, empty, empty> type_v_814;
+typedef std::tuple<var, std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_815;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, double, empty, empty> type_v_816;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_v_817;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_818;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, var, empty, empty> type_v_819;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_v_820;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_821;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_822;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_823;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_824;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_825;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_826;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_827;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_828;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_829;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_830;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_831;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_832;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_833;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_834;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_835;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_836;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_837;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_838;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_839;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_840;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_841;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_842;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_843;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_844;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_845;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_846;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_847;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_848;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_849;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_850;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_851;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_852;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_853;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_854;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_855;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_856;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_857;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_858;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_859;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_860;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_861;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_862;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_863;
+typedef std::tuple<std::vector<var>, double, double, double, empty, empty> type_v_864;
+typedef std::tuple<std::vector<var>, double, double, std::vector<double>, empty, empty> type_v_865;
+typedef std::tuple<std::vector<var>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_866;
+typedef std::tuple<std::vector<var>, double, double, var, empty, empty> type_v_867;
+typedef std::tuple<std::vector<var>, double, double, std::vector<var>, empty, empty> type_v_868;
+typedef std::tuple<std::vector<var>, double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_869;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, double, empty, empty> type_v_870;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, std::vector<double>, empty, empty> type_v_871;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_872;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, var, empty, empty> type_v_873;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, std::vector<var>, empty, empty> type_v_874;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_875;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_876;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_877;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_878;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_879;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_880;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_881;
+typedef std::tuple<std::vector<var>, double, var, double, empty, empty> type_v_882;
+typedef std::tuple<std::vector<var>, double, var, std::vector<double>, empty, empty> type_v_883;
+typedef std::tuple<std::vector<var>, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_884;
+typedef std::tuple<std::vector<var>, double, var, var, empty, empty> type_v_885;
+typedef std::tuple<std::vector<var>, double, var, std::vector<var>, empty, empty> type_v_886;
+typedef std::tuple<std::vector<var>, double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_887;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, double, empty, empty> type_v_888;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, std::vector<double>, empty, empty> type_v_889;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_890;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, var, empty, empty> type_v_891;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, std::vector<var>, empty, empty> type_v_892;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_893;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_894;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_895;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_896;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_897;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_898;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_899;
+
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_800> AgradCcdfLogParetoType2_v_800;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_801> AgradCcdfLogParetoType2_v_801;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_802> AgradCcdfLogParetoType2_v_802;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_803> AgradCcdfLogParetoType2_v_803;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_804> AgradCcdfLogParetoType2_v_804;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_805> AgradCcdfLogParetoType2_v_805;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_806> AgradCcdfLogParetoType2_v_806;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_807> AgradCcdfLogParetoType2_v_807;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_808> AgradCcdfLogParetoType2_v_808;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_809> AgradCcdfLogParetoType2_v_809;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_810> AgradCcdfLogParetoType2_v_810;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_811> AgradCcdfLogParetoType2_v_811;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_812> AgradCcdfLogParetoType2_v_812;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_813> AgradCcdfLogParetoType2_v_813;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_814> AgradCcdfLogParetoType2_v_814;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_815> AgradCcdfLogParetoType2_v_815;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_816> AgradCcdfLogParetoType2_v_816;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_817> AgradCcdfLogParetoType2_v_817;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_818> AgradCcdfLogParetoType2_v_818;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_819> AgradCcdfLogParetoType2_v_819;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_820> AgradCcdfLogParetoType2_v_820;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_821> AgradCcdfLogParetoType2_v_821;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_822> AgradCcdfLogParetoType2_v_822;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_823> AgradCcdfLogParetoType2_v_823;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_824> AgradCcdfLogParetoType2_v_824;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_825> AgradCcdfLogParetoType2_v_825;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_826> AgradCcdfLogParetoType2_v_826;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_827> AgradCcdfLogParetoType2_v_827;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_828> AgradCcdfLogParetoType2_v_828;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_829> AgradCcdfLogParetoType2_v_829;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_830> AgradCcdfLogParetoType2_v_830;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_831> AgradCcdfLogParetoType2_v_831;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_832> AgradCcdfLogParetoType2_v_832;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_833> AgradCcdfLogParetoType2_v_833;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_834> AgradCcdfLogParetoType2_v_834;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_835> AgradCcdfLogParetoType2_v_835;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_836> AgradCcdfLogParetoType2_v_836;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_837> AgradCcdfLogParetoType2_v_837;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_838> AgradCcdfLogParetoType2_v_838;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_839> AgradCcdfLogParetoType2_v_839;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_840> AgradCcdfLogParetoType2_v_840;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_841> AgradCcdfLogParetoType2_v_841;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_842> AgradCcdfLogParetoType2_v_842;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_843> AgradCcdfLogParetoType2_v_843;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_844> AgradCcdfLogParetoType2_v_844;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_845> AgradCcdfLogParetoType2_v_845;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_846> AgradCcdfLogParetoType2_v_846;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_847> AgradCcdfLogParetoType2_v_847;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_848> AgradCcdfLogParetoType2_v_848;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_849> AgradCcdfLogParetoType2_v_849;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_850> AgradCcdfLogParetoType2_v_850;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_851> AgradCcdfLogParetoType2_v_851;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_852> AgradCcdfLogParetoType2_v_852;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_853> AgradCcdfLogParetoType2_v_853;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_854> AgradCcdfLogParetoType2_v_854;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_855> AgradCcdfLogParetoType2_v_855;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_856> AgradCcdfLogParetoType2_v_856;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_857> AgradCcdfLogParetoType2_v_857;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_858> AgradCcdfLogParetoType2_v_858;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_859> AgradCcdfLogParetoType2_v_859;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_860> AgradCcdfLogParetoType2_v_860;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_861> AgradCcdfLogParetoType2_v_861;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_862> AgradCcdfLogParetoType2_v_862;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_863> AgradCcdfLogParetoType2_v_863;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_864> AgradCcdfLogParetoType2_v_864;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_865> AgradCcdfLogParetoType2_v_865;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_866> AgradCcdfLogParetoType2_v_866;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_867> AgradCcdfLogParetoType2_v_867;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_868> AgradCcdfLogParetoType2_v_868;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_869> AgradCcdfLogParetoType2_v_869;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_870> AgradCcdfLogParetoType2_v_870;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_871> AgradCcdfLogParetoType2_v_871;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_872> AgradCcdfLogParetoType2_v_872;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_873> AgradCcdfLogParetoType2_v_873;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_874> AgradCcdfLogParetoType2_v_874;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_875> AgradCcdfLogParetoType2_v_875;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_876> AgradCcdfLogParetoType2_v_876;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_877> AgradCcdfLogParetoType2_v_877;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_878> AgradCcdfLogParetoType2_v_878;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_879> AgradCcdfLogParetoType2_v_879;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_880> AgradCcdfLogParetoType2_v_880;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_881> AgradCcdfLogParetoType2_v_881;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_882> AgradCcdfLogParetoType2_v_882;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_883> AgradCcdfLogParetoType2_v_883;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_884> AgradCcdfLogParetoType2_v_884;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_885> AgradCcdfLogParetoType2_v_885;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_886> AgradCcdfLogParetoType2_v_886;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_887> AgradCcdfLogParetoType2_v_887;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_888> AgradCcdfLogParetoType2_v_888;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_889> AgradCcdfLogParetoType2_v_889;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_890> AgradCcdfLogParetoType2_v_890;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_891> AgradCcdfLogParetoType2_v_891;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_892> AgradCcdfLogParetoType2_v_892;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_893> AgradCcdfLogParetoType2_v_893;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_894> AgradCcdfLogParetoType2_v_894;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_895> AgradCcdfLogParetoType2_v_895;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_896> AgradCcdfLogParetoType2_v_896;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_897> AgradCcdfLogParetoType2_v_897;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_898> AgradCcdfLogParetoType2_v_898;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_899> AgradCcdfLogParetoType2_v_899;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_800, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_800);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_801, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_801);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_802, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_802);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_803, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_803);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_804, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_804);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_805, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_805);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_806, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_806);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_807, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_807);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_808, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_808);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_809, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_809);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_810, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_810);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_811, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_811);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_812, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_812);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_813, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_813);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_814, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_814);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_815, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_815);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_816, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_816);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_817, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_817);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_818, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_818);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_819, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_819);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_820, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_820);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_821, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_821);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_822, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_822);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_823, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_823);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_824, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_824);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_825, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_825);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_826, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_826);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_827, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_827);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_828, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_828);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_829, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_829);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_830, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_830);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_831, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_831);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_832, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_832);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_833, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_833);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_834, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_834);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_835, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_835);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_836, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_836);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_837, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_837);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_838, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_838);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_839, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_839);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_840, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_840);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_841, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_841);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_842, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_842);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_843, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_843);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_844, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_844);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_845, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_845);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_846, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_846);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_847, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_847);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_848, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_848);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_849, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_849);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_850, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_850);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_851, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_851);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_852, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_852);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_853, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_853);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_854, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_854);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_855, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_855);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_856, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_856);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_857, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_857);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_858, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_858);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_859, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_859);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_860, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_860);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_861, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_861);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_862, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_862);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_863, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_863);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_864, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_864);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_865, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_865);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_866, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_866);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_867, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_867);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_868, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_868);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_869, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_869);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_870, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_870);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_871, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_871);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_872, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_872);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_873, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_873);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_874, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_874);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_875, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_875);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_876, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_876);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_877, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_877);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_878, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_878);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_879, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_879);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_880, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_880);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_881, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_881);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_882, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_882);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_883, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_883);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_884, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_884);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_885, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_885);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_886, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_886);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_887, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_887);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_888, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_888);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_889, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_889);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_890, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_890);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_891, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_891);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_892, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_892);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_893, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_893);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_894, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_894);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_895, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_895);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_896, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_896);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_897, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_897);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_898, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_898);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_899, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_899);
+
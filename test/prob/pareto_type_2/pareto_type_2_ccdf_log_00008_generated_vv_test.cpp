@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_ccdf_log_test.hpp>
+
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_800;
+typedef std::tuple<std::vector<var>, double, var, double, empty, empty> type_vv_801;
+typedef std::tuple<std::vector<var>, double, var, std::vector<double>, empty, empty> type_vv_802;
+typedef std::tuple<std::vector<var>, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_803;
+typedef std::tuple<std::vector<var>, double, var, var, empty, empty> type_vv_804;
+typedef std::tuple<std::vector<var>, double, var, std::vector<var>, empty, empty> type_vv_805;
+typedef std::tuple<std::vector<var>, double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_806;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, double, empty, empty> type_vv_807;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, std::vector<double>, empty, empty> type_vv_808;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_809;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, var, empty, empty> type_vv_810;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, std::vector<var>, empty, empty> type_vv_811;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_812;
+typedef std::tuple<std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_813;
+typedef std::tuple<std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_814;
+typedef std::tuple<std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_815;
+typedef std::tuple<std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_816;
+typedef std::tuple<std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_817;
+typedef std::tuple<std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_818;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, double, empty, empty> type_vv_819;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, std::vector<double>, empty, empty> type_vv_820;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_821;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, var, empty, empty> type_vv_822;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, std::vector<var>, empty, empty> type_vv_823;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_824;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, double, empty, empty> type_vv_825;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, std::vector<double>, empty, empty> type_vv_826;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_827;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, var, empty, empty> type_vv_828;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_vv_829;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_830;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_831;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_832;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_833;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_834;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_835;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_836;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, double, empty, empty> type_vv_837;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, std::vector<double>, empty, empty> type_vv_838;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_839;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, var, empty, empty> type_vv_840;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, std::vector<var>, empty, empty> type_vv_841;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_842;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, double, empty, empty> type_vv_843;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_vv_844;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_845;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, var, empty, empty> type_vv_846;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_vv_847;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_848;
+typedef std::tuple<std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_849;
+typedef std::tuple<std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_850;
+typedef std::tuple<std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_851;
+typedef std::tuple<std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_852;
+typedef std::tuple<std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_853;
+typedef std::tuple<std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_854;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty> type_vv_855;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_vv_856;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_857;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_vv_858;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_vv_859;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_860;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_vv_861;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_vv_862;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_863;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_vv_864;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_vv_865;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_866;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_867;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_868;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_869;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_870;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_871;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_872;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_vv_873;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_vv_874;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_875;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_vv_876;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_vv_877;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_878;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_vv_879;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_vv_880;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_881;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_vv_882;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_vv_883;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_884;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_885;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_886;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_887;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_888;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_889;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_890;
+typedef std::tuple<std::vector<var>, var, double, double, empty, empty> type_vv_891;
+typedef std::tuple<std::vector<var>, var, double, std::vector<double>, empty, empty> type_vv_892;
+typedef std::tuple<std::vector<var>, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_893;
+typedef std::tuple<std::vector<var>, var, double, var, empty, empty> type_vv_894;
+typedef std::tuple<std::vector<var>, var, double, std::vector<var>, empty, empty> type_vv_895;
+typedef std::tuple<std::vector<var>, var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_896;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, double, empty, empty> type_vv_897;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, std::vector<double>, empty, empty> type_vv_898;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_899;
+
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_800> AgradCcdfLogParetoType2_vv_800;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_801> AgradCcdfLogParetoType2_vv_801;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_802> AgradCcdfLogParetoType2_vv_802;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_803> AgradCcdfLogParetoType2_vv_803;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_804> AgradCcdfLogParetoType2_vv_804;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_805> AgradCcdfLogParetoType2_vv_805;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_806> AgradCcdfLogParetoType2_vv_806;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_807> AgradCcdfLogParetoType2_vv_807;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_808> AgradCcdfLogParetoType2_vv_808;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_809> AgradCcdfLogParetoType2_vv_809;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_810> AgradCcdfLogParetoType2_vv_810;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_811> AgradCcdfLogParetoType2_vv_811;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_812> AgradCcdfLogParetoType2_vv_812;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_813> AgradCcdfLogParetoType2_vv_813;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_814> AgradCcdfLogParetoType2_vv_814;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_815> AgradCcdfLogParetoType2_vv_815;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_816> AgradCcdfLogParetoType2_vv_816;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_817> AgradCcdfLogParetoType2_vv_817;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_818> AgradCcdfLogParetoType2_vv_818;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_819> AgradCcdfLogParetoType2_vv_819;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_820> AgradCcdfLogParetoType2_vv_820;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_821> AgradCcdfLogParetoType2_vv_821;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_822> AgradCcdfLogParetoType2_vv_822;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_823> AgradCcdfLogParetoType2_vv_823;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_824> AgradCcdfLogParetoType2_vv_824;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_825> AgradCcdfLogParetoType2_vv_825;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_826> AgradCcdfLogParetoType2_vv_826;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_827> AgradCcdfLogParetoType2_vv_827;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_828> AgradCcdfLogParetoType2_vv_828;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_829> AgradCcdfLogParetoType2_vv_829;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_830> AgradCcdfLogParetoType2_vv_830;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_831> AgradCcdfLogParetoType2_vv_831;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_832> AgradCcdfLogParetoType2_vv_832;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_833> AgradCcdfLogParetoType2_vv_833;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_834> AgradCcdfLogParetoType2_vv_834;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_835> AgradCcdfLogParetoType2_vv_835;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_836> AgradCcdfLogParetoType2_vv_836;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_837> AgradCcdfLogParetoType2_vv_837;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_838> AgradCcdfLogParetoType2_vv_838;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_839> AgradCcdfLogParetoType2_vv_839;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_840> AgradCcdfLogParetoType2_vv_840;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_841> AgradCcdfLogParetoType2_vv_841;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_842> AgradCcdfLogParetoType2_vv_842;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_843> AgradCcdfLogParetoType2_vv_843;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_844> AgradCcdfLogParetoType2_vv_844;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_845> AgradCcdfLogParetoType2_vv_845;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_846> AgradCcdfLogParetoType2_vv_846;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_847> AgradCcdfLogParetoType2_vv_847;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_848> AgradCcdfLogParetoType2_vv_848;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_849> AgradCcdfLogParetoType2_vv_849;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_850> AgradCcdfLogParetoType2_vv_850;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_851> AgradCcdfLogParetoType2_vv_851;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_852> AgradCcdfLogParetoType2_vv_852;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_853> AgradCcdfLogParetoType2_vv_853;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_854> AgradCcdfLogParetoType2_vv_854;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_855> AgradCcdfLogParetoType2_vv_855;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_856> AgradCcdfLogParetoType2_vv_856;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_857> AgradCcdfLogParetoType2_vv_857;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_858> AgradCcdfLogParetoType2_vv_858;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_859> AgradCcdfLogParetoType2_vv_859;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_860> AgradCcdfLogParetoType2_vv_860;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_861> AgradCcdfLogParetoType2_vv_861;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_862> AgradCcdfLogParetoType2_vv_862;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_863> AgradCcdfLogParetoType2_vv_863;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_864> AgradCcdfLogParetoType2_vv_864;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_865> AgradCcdfLogParetoType2_vv_865;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_866> AgradCcdfLogParetoType2_vv_866;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_867> AgradCcdfLogParetoType2_vv_867;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_868> AgradCcdfLogParetoType2_vv_868;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_869> AgradCcdfLogParetoType2_vv_869;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_870> AgradCcdfLogParetoType2_vv_870;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_871> AgradCcdfLogParetoType2_vv_871;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_872> AgradCcdfLogParetoType2_vv_872;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_873> AgradCcdfLogParetoType2_vv_873;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_874> AgradCcdfLogParetoType2_vv_874;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_875> AgradCcdfLogParetoType2_vv_875;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_876> AgradCcdfLogParetoType2_vv_876;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_877> AgradCcdfLogParetoType2_vv_877;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_878> AgradCcdfLogParetoType2_vv_878;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_879> AgradCcdfLogParetoType2_vv_879;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_880> AgradCcdfLogParetoType2_vv_880;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_881> AgradCcdfLogParetoType2_vv_881;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_882> AgradCcdfLogParetoType2_vv_882;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_883> AgradCcdfLogParetoType2_vv_883;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_884> AgradCcdfLogParetoType2_vv_884;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_885> AgradCcdfLogParetoType2_vv_885;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_886> AgradCcdfLogParetoType2_vv_886;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_887> AgradCcdfLogParetoType2_vv_887;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_888> AgradCcdfLogParetoType2_vv_888;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_889> AgradCcdfLogParetoType2_vv_889;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_890> AgradCcdfLogParetoType2_vv_890;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_891> AgradCcdfLogParetoType2_vv_891;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_892> AgradCcdfLogParetoType2_vv_892;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_893> AgradCcdfLogParetoType2_vv_893;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_894> AgradCcdfLogParetoType2_vv_894;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_895> AgradCcdfLogParetoType2_vv_895;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_896> AgradCcdfLogParetoType2_vv_896;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_897> AgradCcdfLogParetoType2_vv_897;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_898> AgradCcdfLogParetoType2_vv_898;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_899> AgradCcdfLogParetoType2_vv_899;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_800, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_800);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_801, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_801);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_802, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_802);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_803, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_803);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_804, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_804);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_805, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_805);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_806, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_806);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_807, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_807);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_808, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_808);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_809, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_809);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_810, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_810);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_811, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_811);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_812, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_812);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_813, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_813);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_814, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_814);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_815, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_815);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_816, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_816);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_817, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_817);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_818, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_818);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_819, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_819);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_820, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_820);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_821, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_821);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_822, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_822);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_823, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_823);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_824, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_824);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_825, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_825);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_826, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_826);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_827, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_827);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_828, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_828);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_829, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_829);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_830, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_830);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_831, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_831);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_832, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_832);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_833, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_833);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_834, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_834);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_835, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_835);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_836, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_836);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_837, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_837);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_838, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_838);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_839, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_839);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_840, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_840);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_841, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_841);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_842, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_842);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_843, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_843);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_844, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_844);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_845, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_845);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_846, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_846);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_847, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_847);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_848, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_848);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_849, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_849);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_850, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_850);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_851, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_851);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_852, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_852);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_853, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_853);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_854, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_854);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_855, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_855);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_856, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_856);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_857, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_857);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_858, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_858);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_859, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_859);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_860, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_860);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_861, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_861);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_862, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_862);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_863, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_863);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_864, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_864);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_865, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_865);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_866, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_866);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_867, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_867);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_868, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_868);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_869, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_869);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_870, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_870);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_871, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_871);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_872, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_872);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_873, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_873);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_874, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_874);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_875, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_875);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_876, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_876);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_877, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_877);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_878, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_878);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_879, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_879);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_880, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_880);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_881, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_881);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_882, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_882);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_883, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_883);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_884, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_884);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_885, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_885);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_886, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_886);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_887, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_887);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_888, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_888);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_889, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_889);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_890, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_890);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_891, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_891);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_892, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_892);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_893, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_893);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_894, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_894);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_895, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_895);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_896, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_896);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_897, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_897);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_898, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_898);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_899, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_899);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_ccdf_log_test.hpp>
+
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_900;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_901;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_902;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_903;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_904;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_905;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_906;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_907;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_908;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, double, empty, empty> type_ffv_909;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_910;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_911;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_912;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_913;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_914;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_915;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_916;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_917;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_918;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_919;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_920;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_921;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_922;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_923;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_924;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_925;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_926;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, double, empty, empty> type_ffv_927;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty, empty> type_ffv_928;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_929;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty, empty> type_ffv_930;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_931;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_932;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty, empty> type_ffv_933;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_934;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_935;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_936;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_937;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_938;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_939;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_940;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_941;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_942;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_943;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_944;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty, empty> type_ffv_945;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_946;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_947;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_948;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_949;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_950;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_951;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_952;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_953;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_954;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_955;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_956;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_957;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_958;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_959;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_960;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_961;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_962;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty, empty> type_ffv_963;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_ffv_964;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_965;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_966;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_967;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_968;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_ffv_969;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_970;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_971;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_972;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_973;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_974;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_975;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_976;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_977;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_978;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_979;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_980;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_981;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_982;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_983;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_984;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_985;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_986;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_987;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_988;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_989;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_990;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_991;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_992;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_993;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_994;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_995;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_996;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_997;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_998;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, double, empty, empty> type_ffv_999;
+
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_900> AgradCcdfLogParetoType2_ffv_900;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_901> AgradCcdfLogParetoType2_ffv_901;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_902> AgradCcdfLogParetoType2_ffv_902;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_903> AgradCcdfLogParetoType2_ffv_903;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_904> AgradCcdfLogParetoType2_ffv_904;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_905> AgradCcdfLogParetoType2_ffv_905;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_906> AgradCcdfLogParetoType2_ffv_906;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_907> AgradCcdfLogParetoType2_ffv_907;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_908> AgradCcdfLogParetoType2_ffv_908;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_909> AgradCcdfLogParetoType2_ffv_909;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_910> AgradCcdfLogParetoType2_ffv_910;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_911> AgradCcdfLogParetoType2_ffv_911;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_912> AgradCcdfLogParetoType2_ffv_912;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_913> AgradCcdfLogParetoType2_ffv_913;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_914> AgradCcdfLogParetoType2_ffv_914;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_915> AgradCcdfLogParetoType2_ffv_915;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_916> AgradCcdfLogParetoType2_ffv_916;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_917> AgradCcdfLogParetoType2_ffv_917;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_918> AgradCcdfLogParetoType2_ffv_918;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_919> AgradCcdfLogParetoType2_ffv_919;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_920> AgradCcdfLogParetoType2_ffv_920;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_921> AgradCcdfLogParetoType2_ffv_921;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_922> AgradCcdfLogParetoType2_ffv_922;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_923> AgradCcdfLogParetoType2_ffv_923;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_924> AgradCcdfLogParetoType2_ffv_924;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_925> AgradCcdfLogParetoType2_ffv_925;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_926> AgradCcdfLogParetoType2_ffv_926;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_927> AgradCcdfLogParetoType2_ffv_927;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_928> AgradCcdfLogParetoType2_ffv_928;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_929> AgradCcdfLogParetoType2_ffv_929;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_930> AgradCcdfLogParetoType2_ffv_930;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_931> AgradCcdfLogParetoType2_ffv_931;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_932> AgradCcdfLogParetoType2_ffv_932;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_933> AgradCcdfLogParetoType2_ffv_933;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_934> AgradCcdfLogParetoType2_ffv_934;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_935> AgradCcdfLogParetoType2_ffv_935;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_936> AgradCcdfLogParetoType2_ffv_936;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_937> AgradCcdfLogParetoType2_ffv_937;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_938> AgradCcdfLogParetoType2_ffv_938;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_939> AgradCcdfLogParetoType2_ffv_939;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_940> AgradCcdfLogParetoType2_ffv_940;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_941> AgradCcdfLogParetoType2_ffv_941;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_942> AgradCcdfLogParetoType2_ffv_942;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_943> AgradCcdfLogParetoType2_ffv_943;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_944> AgradCcdfLogParetoType2_ffv_944;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_945> AgradCcdfLogParetoType2_ffv_945;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_946> AgradCcdfLogParetoType2_ffv_946;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_947> AgradCcdfLogParetoType2_ffv_947;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_948> AgradCcdfLogParetoType2_ffv_948;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_949> AgradCcdfLogParetoType2_ffv_949;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_950> AgradCcdfLogParetoType2_ffv_950;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_951> AgradCcdfLogParetoType2_ffv_951;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_952> AgradCcdfLogParetoType2_ffv_952;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_953> AgradCcdfLogParetoType2_ffv_953;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_954> AgradCcdfLogParetoType2_ffv_954;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_955> AgradCcdfLogParetoType2_ffv_955;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_956> AgradCcdfLogParetoType2_ffv_956;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_957> AgradCcdfLogParetoType2_ffv_957;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_958> AgradCcdfLogParetoType2_ffv_958;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_959> AgradCcdfLogParetoType2_ffv_959;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_960> AgradCcdfLogParetoType2_ffv_960;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_961> AgradCcdfLogParetoType2_ffv_961;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_962> AgradCcdfLogParetoType2_ffv_962;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_963> AgradCcdfLogParetoType2_ffv_963;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_964> AgradCcdfLogParetoType2_ffv_964;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_965> AgradCcdfLogParetoType2_ffv_965;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_966> AgradCcdfLogParetoType2_ffv_966;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_967> AgradCcdfLogParetoType2_ffv_967;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_968> AgradCcdfLogParetoType2_ffv_968;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_969> AgradCcdfLogParetoType2_ffv_969;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_970> AgradCcdfLogParetoType2_ffv_970;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_971> AgradCcdfLogParetoType2_ffv_971;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_972> AgradCcdfLogParetoType2_ffv_972;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_973> AgradCcdfLogParetoType2_ffv_973;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_974> AgradCcdfLogParetoType2_ffv_974;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_975> AgradCcdfLogParetoType2_ffv_975;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_976> AgradCcdfLogParetoType2_ffv_976;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_977> AgradCcdfLogParetoType2_ffv_977;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_978> AgradCcdfLogParetoType2_ffv_978;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_979> AgradCcdfLogParetoType2_ffv_979;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_980> AgradCcdfLogParetoType2_ffv_980;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_981> AgradCcdfLogParetoType2_ffv_981;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_982> AgradCcdfLogParetoType2_ffv_982;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_983> AgradCcdfLogParetoType2_ffv_983;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_984> AgradCcdfLogParetoType2_ffv_984;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_985> AgradCcdfLogParetoType2_ffv_985;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_986> AgradCcdfLogParetoType2_ffv_986;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_987> AgradCcdfLogParetoType2_ffv_987;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_988> AgradCcdfLogParetoType2_ffv_988;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_989> AgradCcdfLogParetoType2_ffv_989;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_990> AgradCcdfLogParetoType2_ffv_990;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_991> AgradCcdfLogParetoType2_ffv_991;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_992> AgradCcdfLogParetoType2_ffv_992;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_993> AgradCcdfLogParetoType2_ffv_993;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_994> AgradCcdfLogParetoType2_ffv_994;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_995> AgradCcdfLogParetoType2_ffv_995;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_996> AgradCcdfLogParetoType2_ffv_996;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_997> AgradCcdfLogParetoType2_ffv_997;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_998> AgradCcdfLogParetoType2_ffv_998;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_999> AgradCcdfLogParetoType2_ffv_999;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_900, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_900);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_901, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_901);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_902, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_902);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_903, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_903);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_904, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_904);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_905, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_905);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_906, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_906);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_907, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_907);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_908, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_908);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_909, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_909);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_910, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_910);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_911, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_911);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_912, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_912);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_913, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_913);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_914, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_914);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_915, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_915);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_916, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_916);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_917, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_917);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_918, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_918);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_919, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_919);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_920, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_920);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_921, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_921);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_922, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_922);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_923, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_923);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_924, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_924);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_925, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_925);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_926, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_926);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_927, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_927);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_928, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_928);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_929, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_929);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_930, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_930);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_931, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_931);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_932, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_932);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_933, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_933);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_934, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_934);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_935, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_935);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_936, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_936);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_937, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_937);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_938, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_938);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_939, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_939);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_940, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_940);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_941, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_941);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_942, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_942);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_943, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_943);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_944, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_944);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_945, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_945);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_946, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_946);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_947, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_947);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_948, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_948);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_949, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_949);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_950, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_950);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_951, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_951);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_952, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_952);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_953, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_953);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_954, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_954);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_955, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_955);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_956, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_956);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_957, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_957);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_958, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_958);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_959, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_959);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_960, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_960);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_961, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_961);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_962, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_962);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_963, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_963);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_964, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_964);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_965, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_965);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_966, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_966);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_967, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_967);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_968, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_968);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_969, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_969);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_970, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_970);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_971, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_971);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_972, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_972);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_973, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_973);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_974, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_974);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_975, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_975);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_976, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_976);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_977, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_977);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_978, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_978);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_979, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_979);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_980, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_980);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_981, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_981);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_982, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_982);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_983, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_983);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_984, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_984);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_985, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_985);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_986, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_986);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_987, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_987);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_988, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_988);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_989, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_989);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_990, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_990);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_991, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_991);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_992, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_992);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_993, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_993);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_994, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_994);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_995, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_995);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_996, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_996);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_997, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_997);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_998, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_998);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_999, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_999);
+
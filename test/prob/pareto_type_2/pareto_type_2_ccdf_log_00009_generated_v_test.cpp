@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_ccdf_log_test.hpp>
+
+typedef std::tuple<std::vector<var>, std::vector<double>, double, double, empty, empty> type_v_900;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, std::vector<double>, empty, empty> type_v_901;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_902;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, var, empty, empty> type_v_903;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, std::vector<var>, empty, empty> type_v_904;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_905;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, double, empty, empty> type_v_906;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, std::vector<double>, empty, empty> type_v_907;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_908;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, var, empty, empty> type_v_909;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_v_910;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_911;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_912;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_913;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_914;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_915;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_916;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_917;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, double, empty, empty> type_v_918;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, std::vector<double>, empty, empty> type_v_919;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_920;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, var, empty, empty> type_v_921;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, std::vector<var>, empty, empty> type_v_922;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_923;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, double, empty, empty> type_v_924;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_v_925;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_926;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, var, empty, empty> type_v_927;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_v_928;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_929;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_930;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_931;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_932;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_933;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_934;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_935;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_936;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_937;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_938;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_939;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_940;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_941;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_942;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_943;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_944;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_945;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_946;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_947;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_948;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_949;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_950;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_951;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_952;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_953;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_954;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_955;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_956;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_957;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_958;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_959;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_960;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_961;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_962;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_963;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_964;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_965;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_966;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_967;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_968;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_969;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_970;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_971;
+typedef std::tuple<std::vector<var>, var, double, double, empty, empty> type_v_972;
+typedef std::tuple<std::vector<var>, var, double, std::vector<double>, empty, empty> type_v_973;
+typedef std::tuple<std::vector<var>, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_974;
+typedef std::tuple<std::vector<var>, var, double, var, empty, empty> type_v_975;
+typedef std::tuple<std::vector<var>, var, double, std::vector<var>, empty, empty> type_v_976;
+typedef std::tuple<std::vector<var>, var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_977;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, double, empty, empty> type_v_978;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, std::vector<double>, empty, empty> type_v_979;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_980;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, var, empty, empty> type_v_981;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, std::vector<var>, empty, empty> type_v_982;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_983;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_984;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_985;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_986;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_987;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_988;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_989;
+typedef std::tuple<std::vector<var>, var, var, double, empty, empty> type_v_990;
+typedef std::tuple<std::vector<var>, var, var, std::vector<double>, empty, empty> type_v_991;
+typedef std::tuple<std::vector<var>, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_992;
+typedef std::tuple<std::vector<var>, var, var, var, empty, empty> type_v_993;
+typedef std::tuple<std::vector<var>, var, var, std::vector<var>, empty, empty> type_v_994;
+typedef std::tuple<std::vector<var>, var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_995;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, double, empty, empty> type_v_996;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, std::vector<double>, empty, empty> type_v_997;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_998;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, var, empty, empty> type_v_999;
+
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_900> AgradCcdfLogParetoType2_v_900;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_901> AgradCcdfLogParetoType2_v_901;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_902> AgradCcdfLogParetoType2_v_902;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_903> AgradCcdfLogParetoType2_v_903;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_904> AgradCcdfLogParetoType2_v_904;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_905> AgradCcdfLogParetoType2_v_905;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_906> AgradCcdfLogParetoType2_v_906;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_907> AgradCcdfLogParetoType2_v_907;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_908> AgradCcdfLogParetoType2_v_908;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_909> AgradCcdfLogParetoType2_v_909;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_910> AgradCcdfLogParetoType2_v_910;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_911> AgradCcdfLogParetoType2_v_911;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_912> AgradCcdfLogParetoType2_v_912;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_913> AgradCcdfLogParetoType2_v_913;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_914> AgradCcdfLogParetoType2_v_914;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_915> AgradCcdfLogParetoType2_v_915;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_916> AgradCcdfLogParetoType2_v_916;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_917> AgradCcdfLogParetoType2_v_917;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_918> AgradCcdfLogParetoType2_v_918;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_919> AgradCcdfLogParetoType2_v_919;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_920> AgradCcdfLogParetoType2_v_920;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_921> AgradCcdfLogParetoType2_v_921;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_922> AgradCcdfLogParetoType2_v_922;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_923> AgradCcdfLogParetoType2_v_923;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_924> AgradCcdfLogParetoType2_v_924;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_925> AgradCcdfLogParetoType2_v_925;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_926> AgradCcdfLogParetoType2_v_926;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_927> AgradCcdfLogParetoType2_v_927;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_928> AgradCcdfLogParetoType2_v_928;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_929> AgradCcdfLogParetoType2_v_929;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_930> AgradCcdfLogParetoType2_v_930;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_931> AgradCcdfLogParetoType2_v_931;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_932> AgradCcdfLogParetoType2_v_932;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_933> AgradCcdfLogParetoType2_v_933;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_934> AgradCcdfLogParetoType2_v_934;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_935> AgradCcdfLogParetoType2_v_935;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_936> AgradCcdfLogParetoType2_v_936;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_937> AgradCcdfLogParetoType2_v_937;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_938> AgradCcdfLogParetoType2_v_938;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_939> AgradCcdfLogParetoType2_v_939;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_940> AgradCcdfLogParetoType2_v_940;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_941> AgradCcdfLogParetoType2_v_941;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_942> AgradCcdfLogParetoType2_v_942;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_943> AgradCcdfLogParetoType2_v_943;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_944> AgradCcdfLogParetoType2_v_944;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_945> AgradCcdfLogParetoType2_v_945;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_946> AgradCcdfLogParetoType2_v_946;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_947> AgradCcdfLogParetoType2_v_947;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_948> AgradCcdfLogParetoType2_v_948;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_949> AgradCcdfLogParetoType2_v_949;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_950> AgradCcdfLogParetoType2_v_950;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_951> AgradCcdfLogParetoType2_v_951;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_952> AgradCcdfLogParetoType2_v_952;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_953> AgradCcdfLogParetoType2_v_953;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_954> AgradCcdfLogParetoType2_v_954;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_955> AgradCcdfLogParetoType2_v_955;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_956> AgradCcdfLogParetoType2_v_956;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_957> AgradCcdfLogParetoType2_v_957;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_958> AgradCcdfLogParetoType2_v_958;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_959> AgradCcdfLogParetoType2_v_959;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_960> AgradCcdfLogParetoType2_v_960;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_961> AgradCcdfLogParetoType2_v_961;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_962> AgradCcdfLogParetoType2_v_962;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_963> AgradCcdfLogParetoType2_v_963;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_964> AgradCcdfLogParetoType2_v_964;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_965> AgradCcdfLogParetoType2_v_965;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_966> AgradCcdfLogParetoType2_v_966;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_967> AgradCcdfLogParetoType2_v_967;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_968> AgradCcdfLogParetoType2_v_968;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_969> AgradCcdfLogParetoType2_v_969;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_970> AgradCcdfLogParetoType2_v_970;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_971> AgradCcdfLogParetoType2_v_971;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_972> AgradCcdfLogParetoType2_v_972;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_973> AgradCcdfLogParetoType2_v_973;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_974> AgradCcdfLogParetoType2_v_974;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_975> AgradCcdfLogParetoType2_v_975;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_976> AgradCcdfLogParetoType2_v_976;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_977> AgradCcdfLogParetoType2_v_977;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_978> AgradCcdfLogParetoType2_v_978;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_979> AgradCcdfLogParetoType2_v_979;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_980> AgradCcdfLogParetoType2_v_980;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_981> AgradCcdfLogParetoType2_v_981;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_982> AgradCcdfLogParetoType2_v_982;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_983> AgradCcdfLogParetoType2_v_983;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_984> AgradCcdfLogParetoType2_v_984;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_985> AgradCcdfLogParetoType2_v_985;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_986> AgradCcdfLogParetoType2_v_986;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_987> AgradCcdfLogParetoType2_v_987;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_988> AgradCcdfLogParetoType2_v_988;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_989> AgradCcdfLogParetoType2_v_989;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_990> AgradCcdfLogParetoType2_v_990;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_991> AgradCcdfLogParetoType2_v_991;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_992> AgradCcdfLogParetoType2_v_992;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_993> AgradCcdfLogParetoType2_v_993;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_994> AgradCcdfLogParetoType2_v_994;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_995> AgradCcdfLogParetoType2_v_995;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_996> AgradCcdfLogParetoType2_v_996;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_997> AgradCcdfLogParetoType2_v_997;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_998> AgradCcdfLogParetoType2_v_998;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_999> AgradCcdfLogParetoType2_v_999;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_900, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_900);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_901, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_901);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_902, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_902);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_903, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_903);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_904, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_904);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_905, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_905);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_906, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_906);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_907, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_907);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_908, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_908);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_909, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_909);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_910, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_910);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_911, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_911);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_912, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_912);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_913, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_913);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_914, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_914);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_915, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_915);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_916, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_916);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_917, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_917);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_918, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_918);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_919, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_919);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_920, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_920);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_921, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_921);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_922, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_922);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_923, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_923);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_924, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_924);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_925, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_925);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_926, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_926);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_927, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_927);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_928, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_928);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_929, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_929);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_930, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_930);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_931, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_931);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_932, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_932);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_933, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_933);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_934, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_934);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_935, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_935);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_936, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_936);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_937, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_937);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_938, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_938);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_939, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_939);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_940, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_940);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_941, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_941);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_942, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_942);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_943, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_943);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_944, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_944);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_945, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_945);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_946, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_946);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_947, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_947);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_948, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_948);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_949, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_949);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_950, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_950);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_951, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_951);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_952, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_952);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_953, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_953);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_954, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_954);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_955, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_955);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_956, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_956);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_957, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_957);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_958, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_958);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_959, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_959);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_960, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_960);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_961, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_961);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_962, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_962);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_963, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_963);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_964, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_964);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_965, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_965);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_966, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_966);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_967, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_967);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_968, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_968);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_969, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_969);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_970, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_970);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_971, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_971);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_972, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_972);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_973, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_973);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_974, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_974);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_975, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_975);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_976, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_976);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_977, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_977);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_978, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_978);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_979, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_979);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_980, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_980);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_981, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_981);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_982, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_982);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_983, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_983);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_984, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_984);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_985, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_985);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_986, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_986);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_987, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_987);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_988, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_988);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_989, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_989);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_990, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_990);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_991, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_991);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_992, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_992);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_993, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_993);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_994, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_994);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_995, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_995);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_996, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_996);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_997, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_997);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_998, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_998);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_999, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_999);
+
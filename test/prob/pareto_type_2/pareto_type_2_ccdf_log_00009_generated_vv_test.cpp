@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_ccdf_log_test.hpp>
+
+typedef std::tuple<std::vector<var>, var, std::vector<double>, var, empty, empty> type_vv_900;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, std::vector<var>, empty, empty> type_vv_901;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_902;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_903;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_904;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_905;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_906;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_907;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_908;
+typedef std::tuple<std::vector<var>, var, var, double, empty, empty> type_vv_909;
+typedef std::tuple<std::vector<var>, var, var, std::vector<double>, empty, empty> type_vv_910;
+typedef std::tuple<std::vector<var>, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_911;
+typedef std::tuple<std::vector<var>, var, var, var, empty, empty> type_vv_912;
+typedef std::tuple<std::vector<var>, var, var, std::vector<var>, empty, empty> type_vv_913;
+typedef std::tuple<std::vector<var>, var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_914;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, double, empty, empty> type_vv_915;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, std::vector<double>, empty, empty> type_vv_916;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_917;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, var, empty, empty> type_vv_918;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, std::vector<var>, empty, empty> type_vv_919;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_920;
+typedef std::tuple<std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_921;
+typedef std::tuple<std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_922;
+typedef std::tuple<std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_923;
+typedef std::tuple<std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_924;
+typedef std::tuple<std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_925;
+typedef std::tuple<std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_926;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, double, empty, empty> type_vv_927;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, std::vector<double>, empty, empty> type_vv_928;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_929;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, var, empty, empty> type_vv_930;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, std::vector<var>, empty, empty> type_vv_931;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_932;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, double, empty, empty> type_vv_933;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_vv_934;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_935;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, var, empty, empty> type_vv_936;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_vv_937;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_938;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_939;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_940;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_941;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_942;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_943;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_944;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, double, empty, empty> type_vv_945;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, std::vector<double>, empty, empty> type_vv_946;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_947;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, var, empty, empty> type_vv_948;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, std::vector<var>, empty, empty> type_vv_949;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_950;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, double, empty, empty> type_vv_951;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_vv_952;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_953;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, var, empty, empty> type_vv_954;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_vv_955;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_956;
+typedef std::tuple<std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_957;
+typedef std::tuple<std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_958;
+typedef std::tuple<std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_959;
+typedef std::tuple<std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_960;
+typedef std::tuple<std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_961;
+typedef std::tuple<std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_962;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, empty, empty> type_vv_963;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, empty, empty> type_vv_964;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_965;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, empty, empty> type_vv_966;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, empty, empty> type_vv_967;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_968;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, empty, empty> type_vv_969;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, empty, empty> type_vv_970;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_971;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, empty, empty> type_vv_972;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, empty, empty> type_vv_973;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_974;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_975;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_976;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_977;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_978;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_979;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_980;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, empty, empty> type_vv_981;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, empty, empty> type_vv_982;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_983;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, empty, empty> type_vv_984;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, empty, empty> type_vv_985;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_986;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, empty, empty> type_vv_987;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, empty, empty> type_vv_988;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_989;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, empty, empty> type_vv_990;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, empty, empty> type_vv_991;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_992;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_993;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_994;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_995;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_996;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_997;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_998;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, double, empty, empty> type_vv_999;
+
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_900> AgradCcdfLogParetoType2_vv_900;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_901> AgradCcdfLogParetoType2_vv_901;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_902> AgradCcdfLogParetoType2_vv_902;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_903> AgradCcdfLogParetoType2_vv_903;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_904> AgradCcdfLogParetoType2_vv_904;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_905> AgradCcdfLogParetoType2_vv_905;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_906> AgradCcdfLogParetoType2_vv_906;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_907> AgradCcdfLogParetoType2_vv_907;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_908> AgradCcdfLogParetoType2_vv_908;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_909> AgradCcdfLogParetoType2_vv_909;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_910> AgradCcdfLogParetoType2_vv_910;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_911> AgradCcdfLogParetoType2_vv_911;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_912> AgradCcdfLogParetoType2_vv_912;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_913> AgradCcdfLogParetoType2_vv_913;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_914> AgradCcdfLogParetoType2_vv_914;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_915> AgradCcdfLogParetoType2_vv_915;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_916> AgradCcdfLogParetoType2_vv_916;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_917> AgradCcdfLogParetoType2_vv_917;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_918> AgradCcdfLogParetoType2_vv_918;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_919> AgradCcdfLogParetoType2_vv_919;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_920> AgradCcdfLogParetoType2_vv_920;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_921> AgradCcdfLogParetoType2_vv_921;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_922> AgradCcdfLogParetoType2_vv_922;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_923> AgradCcdfLogParetoType2_vv_923;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_924> AgradCcdfLogParetoType2_vv_924;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_925> AgradCcdfLogParetoType2_vv_925;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_926> AgradCcdfLogParetoType2_vv_926;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_927> AgradCcdfLogParetoType2_vv_927;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_928> AgradCcdfLogParetoType2_vv_928;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_929> AgradCcdfLogParetoType2_vv_929;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_930> AgradCcdfLogParetoType2_vv_930;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_931> AgradCcdfLogParetoType2_vv_931;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_932> AgradCcdfLogParetoType2_vv_932;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_933> AgradCcdfLogParetoType2_vv_933;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_934> AgradCcdfLogParetoType2_vv_934;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_935> AgradCcdfLogParetoType2_vv_935;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_936> AgradCcdfLogParetoType2_vv_936;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_937> AgradCcdfLogParetoType2_vv_937;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_938> AgradCcdfLogParetoType2_vv_938;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_939> AgradCcdfLogParetoType2_vv_939;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_940> AgradCcdfLogParetoType2_vv_940;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_941> AgradCcdfLogParetoType2_vv_941;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_942> AgradCcdfLogParetoType2_vv_942;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_943> AgradCcdfLogParetoType2_vv_943;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_944> AgradCcdfLogParetoType2_vv_944;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_945> AgradCcdfLogParetoType2_vv_945;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_946> AgradCcdfLogParetoType2_vv_946;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_947> AgradCcdfLogParetoType2_vv_947;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_948> AgradCcdfLogParetoType2_vv_948;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_949> AgradCcdfLogParetoType2_vv_949;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_950> AgradCcdfLogParetoType2_vv_950;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_951> AgradCcdfLogParetoType2_vv_951;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_952> AgradCcdfLogParetoType2_vv_952;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_953> AgradCcdfLogParetoType2_vv_953;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_954> AgradCcdfLogParetoType2_vv_954;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_955> AgradCcdfLogParetoType2_vv_955;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_956> AgradCcdfLogParetoType2_vv_956;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_957> AgradCcdfLogParetoType2_vv_957;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_958> AgradCcdfLogParetoType2_vv_958;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_959> AgradCcdfLogParetoType2_vv_959;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_960> AgradCcdfLogParetoType2_vv_960;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_961> AgradCcdfLogParetoType2_vv_961;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_962> AgradCcdfLogParetoType2_vv_962;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_963> AgradCcdfLogParetoType2_vv_963;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_964> AgradCcdfLogParetoType2_vv_964;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_965> AgradCcdfLogParetoType2_vv_965;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_966> AgradCcdfLogParetoType2_vv_966;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_967> AgradCcdfLogParetoType2_vv_967;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_968> AgradCcdfLogParetoType2_vv_968;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_969> AgradCcdfLogParetoType2_vv_969;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_970> AgradCcdfLogParetoType2_vv_970;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_971> AgradCcdfLogParetoType2_vv_971;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_972> AgradCcdfLogParetoType2_vv_972;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_973> AgradCcdfLogParetoType2_vv_973;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_974> AgradCcdfLogParetoType2_vv_974;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_975> AgradCcdfLogParetoType2_vv_975;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_976> AgradCcdfLogParetoType2_vv_976;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_977> AgradCcdfLogParetoType2_vv_977;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_978> AgradCcdfLogParetoType2_vv_978;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_979> AgradCcdfLogParetoType2_vv_979;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_980> AgradCcdfLogParetoType2_vv_980;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_981> AgradCcdfLogParetoType2_vv_981;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_982> AgradCcdfLogParetoType2_vv_982;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_983> AgradCcdfLogParetoType2_vv_983;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_984> AgradCcdfLogParetoType2_vv_984;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_985> AgradCcdfLogParetoType2_vv_985;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_986> AgradCcdfLogParetoType2_vv_986;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_987> AgradCcdfLogParetoType2_vv_987;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_988> AgradCcdfLogParetoType2_vv_988;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_989> AgradCcdfLogParetoType2_vv_989;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_990> AgradCcdfLogParetoType2_vv_990;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_991> AgradCcdfLogParetoType2_vv_991;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_992> AgradCcdfLogParetoType2_vv_992;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_993> AgradCcdfLogParetoType2_vv_993;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_994> AgradCcdfLogParetoType2_vv_994;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_995> AgradCcdfLogParetoType2_vv_995;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_996> AgradCcdfLogParetoType2_vv_996;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_997> AgradCcdfLogParetoType2_vv_997;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_998> AgradCcdfLogParetoType2_vv_998;
+typedef std::tuple<AgradCcdfLogParetoType2, type_vv_999> AgradCcdfLogParetoType2_vv_999;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_900, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_900);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_901, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_901);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_902, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_902);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_903, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_903);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_904, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_904);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_905, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_905);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_906, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_906);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_907, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_907);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_908, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_908);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_909, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_909);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_910, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_910);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_911, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_911);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_912, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_912);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_913, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_913);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_914, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_914);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_915, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_915);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_916, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_916);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_917, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_917);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_918, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_918);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_919, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_919);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_920, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_920);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_921, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_921);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_922, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_922);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_923, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_923);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_924, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_924);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_925, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_925);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_926, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_926);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_927, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_927);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_928, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_928);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_929, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_929);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_930, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_930);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_931, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_931);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_932, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_932);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_933, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_933);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_934, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_934);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_935, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_935);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_936, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_936);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_937, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_937);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_938, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_938);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_939, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_939);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_940, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_940);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_941, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_941);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_942, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_942);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_943, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_943);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_944, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_944);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_945, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_945);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_946, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_946);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_947, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_947);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_948, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_948);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_949, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_949);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_950, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_950);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_951, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_951);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_952, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_952);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_953, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_953);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_954, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_954);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_955, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_955);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_956, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_956);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_957, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_957);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_958, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_958);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_959, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_959);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_960, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_960);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_961, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_961);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_962, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_962);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_963, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_963);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_964, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_964);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_965, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_965);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_966, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_966);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_967, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_967);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_968, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_968);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_969, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_969);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_970, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_970);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_971, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_971);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_972, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_972);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_973, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_973);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_974, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_974);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_975, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_975);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_976, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_976);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_977, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_977);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_978, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_978);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_979, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_979);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_980, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_980);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_981, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_981);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_982, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_982);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_983, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_983);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_984, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_984);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_985, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_985);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_986, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_986);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_987, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_987);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_988, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_988);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_989, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_989);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_990, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_990);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_991, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_991);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_992, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_992);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_993, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_993);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_994, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_994);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_995, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_995);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_996, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_996);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_997, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_997);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_998, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_998);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_vv_999, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_vv_999);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_ccdf_log_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, std::vector<double>, empty, empty> type_ffv_1000;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1001;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, fvar<fvar<var> >, empty, empty> type_ffv_1002;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1003;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1004;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, double, empty, empty> type_ffv_1005;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, std::vector<double>, empty, empty> type_ffv_1006;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1007;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_1008;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1009;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1010;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_1011;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_1012;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1013;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_1014;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1015;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1016;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, double, empty, empty> type_ffv_1017;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_1018;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1019;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_1020;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1021;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1022;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_1023;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_1024;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1025;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_1026;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1027;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1028;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_1029;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_1030;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1031;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_1032;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1033;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1034;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, double, empty, empty> type_ffv_1035;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, std::vector<double>, empty, empty> type_ffv_1036;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1037;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, fvar<fvar<var> >, empty, empty> type_ffv_1038;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1039;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1040;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, double, empty, empty> type_ffv_1041;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_1042;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1043;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_1044;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1045;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1046;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_1047;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_1048;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1049;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_1050;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1051;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1052;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, double, empty, empty> type_ffv_1053;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_1054;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1055;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_1056;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1057;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1058;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_1059;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_1060;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1061;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_1062;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1063;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1064;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_1065;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_1066;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1067;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_1068;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1069;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1070;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty> type_ffv_1071;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_ffv_1072;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1073;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_1074;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1075;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1076;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_ffv_1077;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_1078;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1079;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_1080;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1081;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1082;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_1083;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_1084;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1085;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_1086;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1087;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1088;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_1089;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_1090;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1091;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_1092;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1093;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1094;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_1095;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_1096;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1097;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_1098;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1099;
+
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1000> AgradCcdfLogParetoType2_ffv_1000;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1001> AgradCcdfLogParetoType2_ffv_1001;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1002> AgradCcdfLogParetoType2_ffv_1002;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1003> AgradCcdfLogParetoType2_ffv_1003;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1004> AgradCcdfLogParetoType2_ffv_1004;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1005> AgradCcdfLogParetoType2_ffv_1005;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1006> AgradCcdfLogParetoType2_ffv_1006;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1007> AgradCcdfLogParetoType2_ffv_1007;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1008> AgradCcdfLogParetoType2_ffv_1008;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1009> AgradCcdfLogParetoType2_ffv_1009;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1010> AgradCcdfLogParetoType2_ffv_1010;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1011> AgradCcdfLogParetoType2_ffv_1011;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1012> AgradCcdfLogParetoType2_ffv_1012;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1013> AgradCcdfLogParetoType2_ffv_1013;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1014> AgradCcdfLogParetoType2_ffv_1014;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1015> AgradCcdfLogParetoType2_ffv_1015;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1016> AgradCcdfLogParetoType2_ffv_1016;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1017> AgradCcdfLogParetoType2_ffv_1017;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1018> AgradCcdfLogParetoType2_ffv_1018;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1019> AgradCcdfLogParetoType2_ffv_1019;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1020> AgradCcdfLogParetoType2_ffv_1020;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1021> AgradCcdfLogParetoType2_ffv_1021;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1022> AgradCcdfLogParetoType2_ffv_1022;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1023> AgradCcdfLogParetoType2_ffv_1023;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1024> AgradCcdfLogParetoType2_ffv_1024;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1025> AgradCcdfLogParetoType2_ffv_1025;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1026> AgradCcdfLogParetoType2_ffv_1026;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1027> AgradCcdfLogParetoType2_ffv_1027;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1028> AgradCcdfLogParetoType2_ffv_1028;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1029> AgradCcdfLogParetoType2_ffv_1029;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1030> AgradCcdfLogParetoType2_ffv_1030;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1031> AgradCcdfLogParetoType2_ffv_1031;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1032> AgradCcdfLogParetoType2_ffv_1032;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1033> AgradCcdfLogParetoType2_ffv_1033;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1034> AgradCcdfLogParetoType2_ffv_1034;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1035> AgradCcdfLogParetoType2_ffv_1035;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1036> AgradCcdfLogParetoType2_ffv_1036;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1037> AgradCcdfLogParetoType2_ffv_1037;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1038> AgradCcdfLogParetoType2_ffv_1038;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1039> AgradCcdfLogParetoType2_ffv_1039;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1040> AgradCcdfLogParetoType2_ffv_1040;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1041> AgradCcdfLogParetoType2_ffv_1041;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1042> AgradCcdfLogParetoType2_ffv_1042;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1043> AgradCcdfLogParetoType2_ffv_1043;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1044> AgradCcdfLogParetoType2_ffv_1044;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1045> AgradCcdfLogParetoType2_ffv_1045;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1046> AgradCcdfLogParetoType2_ffv_1046;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1047> AgradCcdfLogParetoType2_ffv_1047;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1048> AgradCcdfLogParetoType2_ffv_1048;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1049> AgradCcdfLogParetoType2_ffv_1049;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1050> AgradCcdfLogParetoType2_ffv_1050;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1051> AgradCcdfLogParetoType2_ffv_1051;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1052> AgradCcdfLogParetoType2_ffv_1052;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1053> AgradCcdfLogParetoType2_ffv_1053;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1054> AgradCcdfLogParetoType2_ffv_1054;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1055> AgradCcdfLogParetoType2_ffv_1055;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1056> AgradCcdfLogParetoType2_ffv_1056;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1057> AgradCcdfLogParetoType2_ffv_1057;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1058> AgradCcdfLogParetoType2_ffv_1058;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1059> AgradCcdfLogParetoType2_ffv_1059;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1060> AgradCcdfLogParetoType2_ffv_1060;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1061> AgradCcdfLogParetoType2_ffv_1061;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1062> AgradCcdfLogParetoType2_ffv_1062;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1063> AgradCcdfLogParetoType2_ffv_1063;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1064> AgradCcdfLogParetoType2_ffv_1064;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1065> AgradCcdfLogParetoType2_ffv_1065;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1066> AgradCcdfLogParetoType2_ffv_1066;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1067> AgradCcdfLogParetoType2_ffv_1067;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1068> AgradCcdfLogParetoType2_ffv_1068;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1069> AgradCcdfLogParetoType2_ffv_1069;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1070> AgradCcdfLogParetoType2_ffv_1070;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1071> AgradCcdfLogParetoType2_ffv_1071;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1072> AgradCcdfLogParetoType2_ffv_1072;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1073> AgradCcdfLogParetoType2_ffv_1073;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1074> AgradCcdfLogParetoType2_ffv_1074;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1075> AgradCcdfLogParetoType2_ffv_1075;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1076> AgradCcdfLogParetoType2_ffv_1076;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1077> AgradCcdfLogParetoType2_ffv_1077;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1078> AgradCcdfLogParetoType2_ffv_1078;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1079> AgradCcdfLogParetoType2_ffv_1079;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1080> AgradCcdfLogParetoType2_ffv_1080;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1081> AgradCcdfLogParetoType2_ffv_1081;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1082> AgradCcdfLogParetoType2_ffv_1082;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1083> AgradCcdfLogParetoType2_ffv_1083;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1084> AgradCcdfLogParetoType2_ffv_1084;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1085> AgradCcdfLogParetoType2_ffv_1085;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1086> AgradCcdfLogParetoType2_ffv_1086;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1087> AgradCcdfLogParetoType2_ffv_1087;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1088> AgradCcdfLogParetoType2_ffv_1088;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1089> AgradCcdfLogParetoType2_ffv_1089;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1090> AgradCcdfLogParetoType2_ffv_1090;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1091> AgradCcdfLogParetoType2_ffv_1091;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1092> AgradCcdfLogParetoType2_ffv_1092;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1093> AgradCcdfLogParetoType2_ffv_1093;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1094> AgradCcdfLogParetoType2_ffv_1094;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1095> AgradCcdfLogParetoType2_ffv_1095;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1096> AgradCcdfLogParetoType2_ffv_1096;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1097> AgradCcdfLogParetoType2_ffv_1097;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1098> AgradCcdfLogParetoType2_ffv_1098;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1099> AgradCcdfLogParetoType2_ffv_1099;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1000, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1000);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1001, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1001);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1002, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1002);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1003, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1003);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1004, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1004);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1005, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1005);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1006, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1006);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1007, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1007);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1008, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1008);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1009, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1009);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1010, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1010);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1011, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1011);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1012, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1012);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1013, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1013);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1014, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1014);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1015, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1015);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1016, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1016);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1017, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1017);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1018, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1018);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1019, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1019);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1020, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1020);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1021, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1021);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1022, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1022);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1023, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1023);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1024, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1024);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1025, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1025);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1026, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1026);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1027, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1027);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1028, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1028);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1029, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1029);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1030, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1030);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1031, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1031);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1032, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1032);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1033, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1033);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1034, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1034);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1035, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1035);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1036, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1036);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1037, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1037);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1038, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1038);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1039, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1039);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1040, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1040);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1041, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1041);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1042, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1042);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1043, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1043);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1044, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1044);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1045, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1045);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1046, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1046);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1047, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1047);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1048, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1048);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1049, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1049);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1050, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1050);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1051, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1051);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1052, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1052);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1053, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1053);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1054, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1054);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1055, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1055);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1056, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1056);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1057, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1057);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1058, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1058);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1059, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1059);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1060, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1060);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1061, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1061);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1062, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1062);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1063, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1063);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1064, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1064);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1065, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1065);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1066, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1066);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1067, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1067);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1068, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1068);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1069, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1069);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1070, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1070);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1071, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1071);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1072, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1072);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1073, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1073);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1074, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1074);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1075, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1075);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1076, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1076);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1077, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1077);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1078, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1078);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1079, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1079);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1080, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1080);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1081, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1081);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1082, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1082);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1083, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1083);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1084, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1084);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1085, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1085);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1086, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1086);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1087, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1087);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1088, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1088);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1089, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1089);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1090, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1090);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1091, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1091);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1092, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1092);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1093, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1093);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1094, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1094);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1095, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1095);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1096, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1096);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1097, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1097);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1098, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1098);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1099, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1099);
+
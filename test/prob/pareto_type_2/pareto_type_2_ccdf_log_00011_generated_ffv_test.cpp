@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_ccdf_log_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1100;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_1101;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_1102;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1103;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_1104;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1105;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1106;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, double, empty, empty> type_ffv_1107;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, std::vector<double>, empty, empty> type_ffv_1108;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1109;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, fvar<fvar<var> >, empty, empty> type_ffv_1110;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1111;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1112;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, double, empty, empty> type_ffv_1113;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty, empty> type_ffv_1114;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1115;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_1116;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1117;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1118;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_1119;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_1120;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1121;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_1122;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1123;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1124;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, double, empty, empty> type_ffv_1125;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_1126;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1127;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_1128;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1129;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1130;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_1131;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_1132;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1133;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_1134;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1135;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1136;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_1137;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_1138;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1139;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_1140;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1141;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1142;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, double, empty, empty> type_ffv_1143;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty, empty> type_ffv_1144;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1145;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty, empty> type_ffv_1146;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1147;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1148;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty, empty> type_ffv_1149;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_1150;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1151;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_1152;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1153;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1154;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_1155;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_1156;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1157;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_1158;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1159;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1160;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty, empty> type_ffv_1161;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_1162;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1163;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_1164;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1165;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1166;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_1167;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_1168;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1169;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_1170;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1171;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1172;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_1173;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_1174;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1175;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_1176;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1177;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1178;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty, empty> type_ffv_1179;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_ffv_1180;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1181;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_1182;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1183;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1184;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_ffv_1185;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_1186;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1187;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_1188;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1189;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1190;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_1191;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_1192;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1193;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_1194;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1195;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1196;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_1197;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_1198;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1199;
+
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1100> AgradCcdfLogParetoType2_ffv_1100;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1101> AgradCcdfLogParetoType2_ffv_1101;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1102> AgradCcdfLogParetoType2_ffv_1102;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1103> AgradCcdfLogParetoType2_ffv_1103;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1104> AgradCcdfLogParetoType2_ffv_1104;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1105> AgradCcdfLogParetoType2_ffv_1105;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1106> AgradCcdfLogParetoType2_ffv_1106;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1107> AgradCcdfLogParetoType2_ffv_1107;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1108> AgradCcdfLogParetoType2_ffv_1108;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1109> AgradCcdfLogParetoType2_ffv_1109;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1110> AgradCcdfLogParetoType2_ffv_1110;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1111> AgradCcdfLogParetoType2_ffv_1111;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1112> AgradCcdfLogParetoType2_ffv_1112;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1113> AgradCcdfLogParetoType2_ffv_1113;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1114> AgradCcdfLogParetoType2_ffv_1114;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1115> AgradCcdfLogParetoType2_ffv_1115;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1116> AgradCcdfLogParetoType2_ffv_1116;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1117> AgradCcdfLogParetoType2_ffv_1117;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1118> AgradCcdfLogParetoType2_ffv_1118;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1119> AgradCcdfLogParetoType2_ffv_1119;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1120> AgradCcdfLogParetoType2_ffv_1120;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1121> AgradCcdfLogParetoType2_ffv_1121;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1122> AgradCcdfLogParetoType2_ffv_1122;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1123> AgradCcdfLogParetoType2_ffv_1123;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1124> AgradCcdfLogParetoType2_ffv_1124;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1125> AgradCcdfLogParetoType2_ffv_1125;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1126> AgradCcdfLogParetoType2_ffv_1126;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1127> AgradCcdfLogParetoType2_ffv_1127;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1128> AgradCcdfLogParetoType2_ffv_1128;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1129> AgradCcdfLogParetoType2_ffv_1129;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1130> AgradCcdfLogParetoType2_ffv_1130;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1131> AgradCcdfLogParetoType2_ffv_1131;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1132> AgradCcdfLogParetoType2_ffv_1132;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1133> AgradCcdfLogParetoType2_ffv_1133;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1134> AgradCcdfLogParetoType2_ffv_1134;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1135> AgradCcdfLogParetoType2_ffv_1135;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1136> AgradCcdfLogParetoType2_ffv_1136;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1137> AgradCcdfLogParetoType2_ffv_1137;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1138> AgradCcdfLogParetoType2_ffv_1138;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1139> AgradCcdfLogParetoType2_ffv_1139;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1140> AgradCcdfLogParetoType2_ffv_1140;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1141> AgradCcdfLogParetoType2_ffv_1141;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1142> AgradCcdfLogParetoType2_ffv_1142;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1143> AgradCcdfLogParetoType2_ffv_1143;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1144> AgradCcdfLogParetoType2_ffv_1144;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1145> AgradCcdfLogParetoType2_ffv_1145;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1146> AgradCcdfLogParetoType2_ffv_1146;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1147> AgradCcdfLogParetoType2_ffv_1147;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1148> AgradCcdfLogParetoType2_ffv_1148;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1149> AgradCcdfLogParetoType2_ffv_1149;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1150> AgradCcdfLogParetoType2_ffv_1150;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1151> AgradCcdfLogParetoType2_ffv_1151;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1152> AgradCcdfLogParetoType2_ffv_1152;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1153> AgradCcdfLogParetoType2_ffv_1153;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1154> AgradCcdfLogParetoType2_ffv_1154;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1155> AgradCcdfLogParetoType2_ffv_1155;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1156> AgradCcdfLogParetoType2_ffv_1156;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1157> AgradCcdfLogParetoType2_ffv_1157;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1158> AgradCcdfLogParetoType2_ffv_1158;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1159> AgradCcdfLogParetoType2_ffv_1159;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1160> AgradCcdfLogParetoType2_ffv_1160;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1161> AgradCcdfLogParetoType2_ffv_1161;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1162> AgradCcdfLogParetoType2_ffv_1162;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1163> AgradCcdfLogParetoType2_ffv_1163;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1164> AgradCcdfLogParetoType2_ffv_1164;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1165> AgradCcdfLogParetoType2_ffv_1165;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1166> AgradCcdfLogParetoType2_ffv_1166;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1167> AgradCcdfLogParetoType2_ffv_1167;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1168> AgradCcdfLogParetoType2_ffv_1168;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1169> AgradCcdfLogParetoType2_ffv_1169;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1170> AgradCcdfLogParetoType2_ffv_1170;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1171> AgradCcdfLogParetoType2_ffv_1171;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1172> AgradCcdfLogParetoType2_ffv_1172;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1173> AgradCcdfLogParetoType2_ffv_1173;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1174> AgradCcdfLogParetoType2_ffv_1174;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1175> AgradCcdfLogParetoType2_ffv_1175;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1176> AgradCcdfLogParetoType2_ffv_1176;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1177> AgradCcdfLogParetoType2_ffv_1177;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1178> AgradCcdfLogParetoType2_ffv_1178;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1179> AgradCcdfLogParetoType2_ffv_1179;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1180> AgradCcdfLogParetoType2_ffv_1180;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1181> AgradCcdfLogParetoType2_ffv_1181;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1182> AgradCcdfLogParetoType2_ffv_1182;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1183> AgradCcdfLogParetoType2_ffv_1183;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1184> AgradCcdfLogParetoType2_ffv_1184;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1185> AgradCcdfLogParetoType2_ffv_1185;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1186> AgradCcdfLogParetoType2_ffv_1186;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1187> AgradCcdfLogParetoType2_ffv_1187;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1188> AgradCcdfLogParetoType2_ffv_1188;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1189> AgradCcdfLogParetoType2_ffv_1189;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1190> AgradCcdfLogParetoType2_ffv_1190;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1191> AgradCcdfLogParetoType2_ffv_1191;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1192> AgradCcdfLogParetoType2_ffv_1192;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1193> AgradCcdfLogParetoType2_ffv_1193;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1194> AgradCcdfLogParetoType2_ffv_1194;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1195> AgradCcdfLogParetoType2_ffv_1195;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1196> AgradCcdfLogParetoType2_ffv_1196;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1197> AgradCcdfLogParetoType2_ffv_1197;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1198> AgradCcdfLogParetoType2_ffv_1198;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1199> AgradCcdfLogParetoType2_ffv_1199;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1100, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1101, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1102, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1103, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1104, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1105, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1106, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1107, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1108, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1109, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1110, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1111, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1112, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1113, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1114, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1115, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1116, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1117, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1118, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1119, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1120, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1121, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1122, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1123, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1124, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1125, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1126, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1127, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1128, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1129, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1130, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1131, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1132, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1133, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1134, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1135, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1136, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1137, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1138, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1139, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1140, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1141, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1142, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1143, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1144, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1145, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1146, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1147, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1148, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1149, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1150, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1151, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1152, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1153, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1154, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1155, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1156, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1157, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1158, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1159, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1160, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1161, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1162, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1163, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1164, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1165, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1166, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1167, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1168, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1169, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1170, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1171, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1172, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1173, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1174, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1175, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1176, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1177, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1178, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1179, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1180, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1181, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1182, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1183, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1184, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1185, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1186, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1187, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1188, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1188);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1189, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1189);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1190, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1190);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1191, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1191);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1192, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1192);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1193, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1193);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1194, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1194);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1195, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1195);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1196, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1196);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1197, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1197);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1198, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1198);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1199, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1199);
+
@@ -0,0 +1,56 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_ccdf_log_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_1200;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1201;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1202;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_1203;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_1204;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1205;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_1206;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1207;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1208;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_1209;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_1210;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1211;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_1212;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1213;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1214;
+
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1200> AgradCcdfLogParetoType2_ffv_1200;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1201> AgradCcdfLogParetoType2_ffv_1201;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1202> AgradCcdfLogParetoType2_ffv_1202;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1203> AgradCcdfLogParetoType2_ffv_1203;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1204> AgradCcdfLogParetoType2_ffv_1204;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1205> AgradCcdfLogParetoType2_ffv_1205;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1206> AgradCcdfLogParetoType2_ffv_1206;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1207> AgradCcdfLogParetoType2_ffv_1207;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1208> AgradCcdfLogParetoType2_ffv_1208;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1209> AgradCcdfLogParetoType2_ffv_1209;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1210> AgradCcdfLogParetoType2_ffv_1210;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1211> AgradCcdfLogParetoType2_ffv_1211;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1212> AgradCcdfLogParetoType2_ffv_1212;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1213> AgradCcdfLogParetoType2_ffv_1213;
+typedef std::tuple<AgradCcdfLogParetoType2, type_ffv_1214> AgradCcdfLogParetoType2_ffv_1214;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1200, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1200);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1201, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1201);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1202, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1202);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1203, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1203);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1204, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1204);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1205, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1205);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1206, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1206);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1207, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1207);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1208, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1208);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1209, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1209);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1210, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1210);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1211, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1211);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1212, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1212);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1213, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1213);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_ffv_1214, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_ffv_1214);
+
@@ -0,0 +1,299 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_ccdf_log_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_1200;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_1201;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1202;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_1203;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_1204;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1205;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, double, empty, empty> type_v_1206;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, std::vector<double>, empty, empty> type_v_1207;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1208;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, var, empty, empty> type_v_1209;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, std::vector<var>, empty, empty> type_v_1210;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1211;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, double, empty, empty> type_v_1212;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, std::vector<double>, empty, empty> type_v_1213;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1214;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, var, empty, empty> type_v_1215;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, std::vector<var>, empty, empty> type_v_1216;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1217;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_1218;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_1219;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1220;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_1221;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_1222;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1223;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, double, empty, empty> type_v_1224;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, std::vector<double>, empty, empty> type_v_1225;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1226;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, var, empty, empty> type_v_1227;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, std::vector<var>, empty, empty> type_v_1228;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1229;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, double, empty, empty> type_v_1230;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_v_1231;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1232;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, var, empty, empty> type_v_1233;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_v_1234;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1235;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_1236;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_1237;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1238;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_1239;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_1240;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1241;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, double, empty, empty> type_v_1242;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, std::vector<double>, empty, empty> type_v_1243;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1244;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, var, empty, empty> type_v_1245;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, std::vector<var>, empty, empty> type_v_1246;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1247;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, double, empty, empty> type_v_1248;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_v_1249;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1250;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, var, empty, empty> type_v_1251;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_v_1252;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1253;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_1254;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_1255;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1256;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_1257;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_1258;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1259;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_1260;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_1261;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1262;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_1263;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_1264;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1265;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_1266;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_1267;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1268;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_1269;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_1270;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1271;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_1272;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_1273;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1274;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_1275;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_1276;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1277;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_1278;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_1279;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1280;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_1281;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_1282;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1283;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_1284;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_1285;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1286;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_1287;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_1288;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1289;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_1290;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_1291;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1292;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_1293;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_1294;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1295;
+
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_1200> AgradCcdfLogParetoType2_v_1200;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_1201> AgradCcdfLogParetoType2_v_1201;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_1202> AgradCcdfLogParetoType2_v_1202;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_1203> AgradCcdfLogParetoType2_v_1203;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_1204> AgradCcdfLogParetoType2_v_1204;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_1205> AgradCcdfLogParetoType2_v_1205;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_1206> AgradCcdfLogParetoType2_v_1206;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_1207> AgradCcdfLogParetoType2_v_1207;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_1208> AgradCcdfLogParetoType2_v_1208;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_1209> AgradCcdfLogParetoType2_v_1209;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_1210> AgradCcdfLogParetoType2_v_1210;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_1211> AgradCcdfLogParetoType2_v_1211;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_1212> AgradCcdfLogParetoType2_v_1212;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_1213> AgradCcdfLogParetoType2_v_1213;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_1214> AgradCcdfLogParetoType2_v_1214;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_1215> AgradCcdfLogParetoType2_v_1215;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_1216> AgradCcdfLogParetoType2_v_1216;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_1217> AgradCcdfLogParetoType2_v_1217;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_1218> AgradCcdfLogParetoType2_v_1218;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_1219> AgradCcdfLogParetoType2_v_1219;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_1220> AgradCcdfLogParetoType2_v_1220;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_1221> AgradCcdfLogParetoType2_v_1221;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_1222> AgradCcdfLogParetoType2_v_1222;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_1223> AgradCcdfLogParetoType2_v_1223;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_1224> AgradCcdfLogParetoType2_v_1224;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_1225> AgradCcdfLogParetoType2_v_1225;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_1226> AgradCcdfLogParetoType2_v_1226;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_1227> AgradCcdfLogParetoType2_v_1227;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_1228> AgradCcdfLogParetoType2_v_1228;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_1229> AgradCcdfLogParetoType2_v_1229;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_1230> AgradCcdfLogParetoType2_v_1230;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_1231> AgradCcdfLogParetoType2_v_1231;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_1232> AgradCcdfLogParetoType2_v_1232;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_1233> AgradCcdfLogParetoType2_v_1233;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_1234> AgradCcdfLogParetoType2_v_1234;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_1235> AgradCcdfLogParetoType2_v_1235;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_1236> AgradCcdfLogParetoType2_v_1236;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_1237> AgradCcdfLogParetoType2_v_1237;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_1238> AgradCcdfLogParetoType2_v_1238;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_1239> AgradCcdfLogParetoType2_v_1239;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_1240> AgradCcdfLogParetoType2_v_1240;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_1241> AgradCcdfLogParetoType2_v_1241;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_1242> AgradCcdfLogParetoType2_v_1242;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_1243> AgradCcdfLogParetoType2_v_1243;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_1244> AgradCcdfLogParetoType2_v_1244;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_1245> AgradCcdfLogParetoType2_v_1245;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_1246> AgradCcdfLogParetoType2_v_1246;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_1247> AgradCcdfLogParetoType2_v_1247;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_1248> AgradCcdfLogParetoType2_v_1248;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_1249> AgradCcdfLogParetoType2_v_1249;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_1250> AgradCcdfLogParetoType2_v_1250;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_1251> AgradCcdfLogParetoType2_v_1251;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_1252> AgradCcdfLogParetoType2_v_1252;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_1253> AgradCcdfLogParetoType2_v_1253;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_1254> AgradCcdfLogParetoType2_v_1254;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_1255> AgradCcdfLogParetoType2_v_1255;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_1256> AgradCcdfLogParetoType2_v_1256;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_1257> AgradCcdfLogParetoType2_v_1257;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_1258> AgradCcdfLogParetoType2_v_1258;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_1259> AgradCcdfLogParetoType2_v_1259;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_1260> AgradCcdfLogParetoType2_v_1260;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_1261> AgradCcdfLogParetoType2_v_1261;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_1262> AgradCcdfLogParetoType2_v_1262;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_1263> AgradCcdfLogParetoType2_v_1263;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_1264> AgradCcdfLogParetoType2_v_1264;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_1265> AgradCcdfLogParetoType2_v_1265;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_1266> AgradCcdfLogParetoType2_v_1266;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_1267> AgradCcdfLogParetoType2_v_1267;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_1268> AgradCcdfLogParetoType2_v_1268;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_1269> AgradCcdfLogParetoType2_v_1269;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_1270> AgradCcdfLogParetoType2_v_1270;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_1271> AgradCcdfLogParetoType2_v_1271;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_1272> AgradCcdfLogParetoType2_v_1272;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_1273> AgradCcdfLogParetoType2_v_1273;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_1274> AgradCcdfLogParetoType2_v_1274;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_1275> AgradCcdfLogParetoType2_v_1275;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_1276> AgradCcdfLogParetoType2_v_1276;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_1277> AgradCcdfLogParetoType2_v_1277;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_1278> AgradCcdfLogParetoType2_v_1278;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_1279> AgradCcdfLogParetoType2_v_1279;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_1280> AgradCcdfLogParetoType2_v_1280;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_1281> AgradCcdfLogParetoType2_v_1281;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_1282> AgradCcdfLogParetoType2_v_1282;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_1283> AgradCcdfLogParetoType2_v_1283;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_1284> AgradCcdfLogParetoType2_v_1284;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_1285> AgradCcdfLogParetoType2_v_1285;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_1286> AgradCcdfLogParetoType2_v_1286;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_1287> AgradCcdfLogParetoType2_v_1287;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_1288> AgradCcdfLogParetoType2_v_1288;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_1289> AgradCcdfLogParetoType2_v_1289;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_1290> AgradCcdfLogParetoType2_v_1290;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_1291> AgradCcdfLogParetoType2_v_1291;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_1292> AgradCcdfLogParetoType2_v_1292;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_1293> AgradCcdfLogParetoType2_v_1293;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_1294> AgradCcdfLogParetoType2_v_1294;
+typedef std::tuple<AgradCcdfLogParetoType2, type_v_1295> AgradCcdfLogParetoType2_v_1295;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_1200, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_1200);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_1201, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_1201);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_1202, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_1202);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_1203, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_1203);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_1204, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_1204);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_1205, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_1205);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_1206, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_1206);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_1207, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_1207);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_1208, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_1208);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_1209, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_1209);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_1210, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_1210);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_1211, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_1211);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_1212, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_1212);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_1213, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_1213);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_1214, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_1214);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_1215, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_1215);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_1216, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_1216);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_1217, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_1217);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_1218, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_1218);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_1219, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_1219);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_1220, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_1220);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_1221, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_1221);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_1222, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_1222);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_1223, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_1223);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_1224, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_1224);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_1225, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_1225);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_1226, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_1226);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_1227, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_1227);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_1228, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_1228);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_1229, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_1229);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_1230, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_1230);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_1231, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_1231);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_1232, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_1232);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_1233, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_1233);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_1234, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_1234);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_1235, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_1235);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_1236, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_1236);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_1237, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_1237);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_1238, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_1238);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_1239, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_1239);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_1240, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_1240);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_1241, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_1241);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_1242, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_1242);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_1243, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_1243);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_1244, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_1244);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_1245, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_1245);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_1246, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_1246);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_1247, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_1247);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_1248, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_1248);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_1249, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_1249);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_1250, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_1250);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_1251, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_1251);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_1252, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_1252);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_1253, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_1253);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_1254, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_1254);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_1255, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_1255);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_1256, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_1256);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_1257, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_1257);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_1258, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_1258);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_1259, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_1259);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_1260, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_1260);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_1261, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_1261);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_1262, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_1262);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_1263, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_1263);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_1264, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_1264);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_1265, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_1265);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_1266, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_1266);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_1267, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_1267);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_1268, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_1268);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_1269, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_1269);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_1270, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_1270);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_1271, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_1271);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_1272, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_1272);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_1273, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_1273);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_1274, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_1274);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_1275, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_1275);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_1276, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_1276);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_1277, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_1277);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_1278, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_1278);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_1279, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_1279);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_1280, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_1280);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_1281, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_1281);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_1282, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_1282);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_1283, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_1283);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_1284, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_1284);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_1285, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_1285);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_1286, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_1286);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_1287, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_1287);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_1288, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_1288);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_1289, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_1289);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_1290, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_1290);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_1291, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_1291);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_1292, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_1292);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_1293, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_1293);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_1294, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_1294);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogParetoType2_v_1295, AgradCcdfLogTestFixture, AgradCcdfLogParetoType2_v_1295);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_cdf_test.hpp>
+
+typedef std::tuple<double, double, double, fvar<fvar<var> >, empty, empty> type_ffv_0;
+typedef std::tuple<double, double, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1;
+typedef std::tuple<double, double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_2;
+typedef std::tuple<double, double, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_3;
+typedef std::tuple<double, double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_4;
+typedef std::tuple<double, double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_5;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_6;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_7;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_8;
+typedef std::tuple<double, double, fvar<fvar<var> >, double, empty, empty> type_ffv_9;
+typedef std::tuple<double, double, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_10;
+typedef std::tuple<double, double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_11;
+typedef std::tuple<double, double, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_12;
+typedef std::tuple<double, double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_13;
+typedef std::tuple<double, double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_14;
+typedef std::tuple<double, double, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_15;
+typedef std::tuple<double, double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_16;
+typedef std::tuple<double, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_17;
+typedef std::tuple<double, double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_18;
+typedef std::tuple<double, double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_19;
+typedef std::tuple<double, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_20;
+typedef std::tuple<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_21;
+typedef std::tuple<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_22;
+typedef std::tuple<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_23;
+typedef std::tuple<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_24;
+typedef std::tuple<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_25;
+typedef std::tuple<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_26;
+typedef std::tuple<double, std::vector<double>, double, fvar<fvar<var> >, empty, empty> type_ffv_27;
+typedef std::tuple<double, std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_28;
+typedef std::tuple<double, std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_29;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_30;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_31;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_32;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_33;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_34;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_35;
+typedef std::tuple<double, std::vector<double>, fvar<fvar<var> >, double, empty, empty> type_ffv_36;
+typedef std::tuple<double, std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_37;
+typedef std::tuple<double, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_38;
+typedef std::tuple<double, std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_39;
+typedef std::tuple<double, std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_40;
+typedef std::tuple<double, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_41;
+typedef std::tuple<double, std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_42;
+typedef std::tuple<double, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_43;
+typedef std::tuple<double, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_44;
+typedef std::tuple<double, std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_45;
+typedef std::tuple<double, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_46;
+typedef std::tuple<double, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_47;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_48;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_49;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_50;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_51;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_52;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_53;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_54;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_55;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_56;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_57;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_58;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_59;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_60;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_61;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_62;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_63;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_64;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_65;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_66;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_67;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_68;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_69;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_70;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_71;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_72;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_73;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_74;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_75;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_76;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_77;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_78;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_79;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_80;
+typedef std::tuple<double, fvar<fvar<var> >, double, double, empty, empty> type_ffv_81;
+typedef std::tuple<double, fvar<fvar<var> >, double, std::vector<double>, empty, empty> type_ffv_82;
+typedef std::tuple<double, fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_83;
+typedef std::tuple<double, fvar<fvar<var> >, double, fvar<fvar<var> >, empty, empty> type_ffv_84;
+typedef std::tuple<double, fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_85;
+typedef std::tuple<double, fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_86;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<double>, double, empty, empty> type_ffv_87;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty, empty> type_ffv_88;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_89;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_90;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_91;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_92;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_93;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_94;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_95;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_96;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_97;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_98;
+typedef std::tuple<double, fvar<fvar<var> >, fvar<fvar<var> >, double, empty, empty> type_ffv_99;
+
+typedef std::tuple<AgradCdfParetoType2, type_ffv_0> AgradCdfParetoType2_ffv_0;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1> AgradCdfParetoType2_ffv_1;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_2> AgradCdfParetoType2_ffv_2;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_3> AgradCdfParetoType2_ffv_3;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_4> AgradCdfParetoType2_ffv_4;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_5> AgradCdfParetoType2_ffv_5;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_6> AgradCdfParetoType2_ffv_6;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_7> AgradCdfParetoType2_ffv_7;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_8> AgradCdfParetoType2_ffv_8;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_9> AgradCdfParetoType2_ffv_9;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_10> AgradCdfParetoType2_ffv_10;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_11> AgradCdfParetoType2_ffv_11;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_12> AgradCdfParetoType2_ffv_12;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_13> AgradCdfParetoType2_ffv_13;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_14> AgradCdfParetoType2_ffv_14;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_15> AgradCdfParetoType2_ffv_15;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_16> AgradCdfParetoType2_ffv_16;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_17> AgradCdfParetoType2_ffv_17;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_18> AgradCdfParetoType2_ffv_18;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_19> AgradCdfParetoType2_ffv_19;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_20> AgradCdfParetoType2_ffv_20;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_21> AgradCdfParetoType2_ffv_21;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_22> AgradCdfParetoType2_ffv_22;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_23> AgradCdfParetoType2_ffv_23;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_24> AgradCdfParetoType2_ffv_24;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_25> AgradCdfParetoType2_ffv_25;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_26> AgradCdfParetoType2_ffv_26;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_27> AgradCdfParetoType2_ffv_27;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_28> AgradCdfParetoType2_ffv_28;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_29> AgradCdfParetoType2_ffv_29;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_30> AgradCdfParetoType2_ffv_30;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_31> AgradCdfParetoType2_ffv_31;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_32> AgradCdfParetoType2_ffv_32;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_33> AgradCdfParetoType2_ffv_33;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_34> AgradCdfParetoType2_ffv_34;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_35> AgradCdfParetoType2_ffv_35;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_36> AgradCdfParetoType2_ffv_36;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_37> AgradCdfParetoType2_ffv_37;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_38> AgradCdfParetoType2_ffv_38;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_39> AgradCdfParetoType2_ffv_39;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_40> AgradCdfParetoType2_ffv_40;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_41> AgradCdfParetoType2_ffv_41;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_42> AgradCdfParetoType2_ffv_42;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_43> AgradCdfParetoType2_ffv_43;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_44> AgradCdfParetoType2_ffv_44;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_45> AgradCdfParetoType2_ffv_45;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_46> AgradCdfParetoType2_ffv_46;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_47> AgradCdfParetoType2_ffv_47;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_48> AgradCdfParetoType2_ffv_48;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_49> AgradCdfParetoType2_ffv_49;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_50> AgradCdfParetoType2_ffv_50;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_51> AgradCdfParetoType2_ffv_51;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_52> AgradCdfParetoType2_ffv_52;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_53> AgradCdfParetoType2_ffv_53;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_54> AgradCdfParetoType2_ffv_54;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_55> AgradCdfParetoType2_ffv_55;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_56> AgradCdfParetoType2_ffv_56;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_57> AgradCdfParetoType2_ffv_57;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_58> AgradCdfParetoType2_ffv_58;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_59> AgradCdfParetoType2_ffv_59;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_60> AgradCdfParetoType2_ffv_60;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_61> AgradCdfParetoType2_ffv_61;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_62> AgradCdfParetoType2_ffv_62;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_63> AgradCdfParetoType2_ffv_63;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_64> AgradCdfParetoType2_ffv_64;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_65> AgradCdfParetoType2_ffv_65;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_66> AgradCdfParetoType2_ffv_66;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_67> AgradCdfParetoType2_ffv_67;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_68> AgradCdfParetoType2_ffv_68;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_69> AgradCdfParetoType2_ffv_69;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_70> AgradCdfParetoType2_ffv_70;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_71> AgradCdfParetoType2_ffv_71;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_72> AgradCdfParetoType2_ffv_72;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_73> AgradCdfParetoType2_ffv_73;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_74> AgradCdfParetoType2_ffv_74;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_75> AgradCdfParetoType2_ffv_75;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_76> AgradCdfParetoType2_ffv_76;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_77> AgradCdfParetoType2_ffv_77;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_78> AgradCdfParetoType2_ffv_78;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_79> AgradCdfParetoType2_ffv_79;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_80> AgradCdfParetoType2_ffv_80;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_81> AgradCdfParetoType2_ffv_81;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_82> AgradCdfParetoType2_ffv_82;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_83> AgradCdfParetoType2_ffv_83;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_84> AgradCdfParetoType2_ffv_84;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_85> AgradCdfParetoType2_ffv_85;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_86> AgradCdfParetoType2_ffv_86;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_87> AgradCdfParetoType2_ffv_87;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_88> AgradCdfParetoType2_ffv_88;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_89> AgradCdfParetoType2_ffv_89;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_90> AgradCdfParetoType2_ffv_90;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_91> AgradCdfParetoType2_ffv_91;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_92> AgradCdfParetoType2_ffv_92;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_93> AgradCdfParetoType2_ffv_93;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_94> AgradCdfParetoType2_ffv_94;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_95> AgradCdfParetoType2_ffv_95;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_96> AgradCdfParetoType2_ffv_96;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_97> AgradCdfParetoType2_ffv_97;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_98> AgradCdfParetoType2_ffv_98;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_99> AgradCdfParetoType2_ffv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_0, AgradCdfTestFixture, AgradCdfParetoType2_ffv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_2, AgradCdfTestFixture, AgradCdfParetoType2_ffv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_3, AgradCdfTestFixture, AgradCdfParetoType2_ffv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_4, AgradCdfTestFixture, AgradCdfParetoType2_ffv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_5, AgradCdfTestFixture, AgradCdfParetoType2_ffv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_6, AgradCdfTestFixture, AgradCdfParetoType2_ffv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_7, AgradCdfTestFixture, AgradCdfParetoType2_ffv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_8, AgradCdfTestFixture, AgradCdfParetoType2_ffv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_9, AgradCdfTestFixture, AgradCdfParetoType2_ffv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_10, AgradCdfTestFixture, AgradCdfParetoType2_ffv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_11, AgradCdfTestFixture, AgradCdfParetoType2_ffv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_12, AgradCdfTestFixture, AgradCdfParetoType2_ffv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_13, AgradCdfTestFixture, AgradCdfParetoType2_ffv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_14, AgradCdfTestFixture, AgradCdfParetoType2_ffv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_15, AgradCdfTestFixture, AgradCdfParetoType2_ffv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_16, AgradCdfTestFixture, AgradCdfParetoType2_ffv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_17, AgradCdfTestFixture, AgradCdfParetoType2_ffv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_18, AgradCdfTestFixture, AgradCdfParetoType2_ffv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_19, AgradCdfTestFixture, AgradCdfParetoType2_ffv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_20, AgradCdfTestFixture, AgradCdfParetoType2_ffv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_21, AgradCdfTestFixture, AgradCdfParetoType2_ffv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_22, AgradCdfTestFixture, AgradCdfParetoType2_ffv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_23, AgradCdfTestFixture, AgradCdfParetoType2_ffv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_24, AgradCdfTestFixture, AgradCdfParetoType2_ffv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_25, AgradCdfTestFixture, AgradCdfParetoType2_ffv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_26, AgradCdfTestFixture, AgradCdfParetoType2_ffv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_27, AgradCdfTestFixture, AgradCdfParetoType2_ffv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_28, AgradCdfTestFixture, AgradCdfParetoType2_ffv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_29, AgradCdfTestFixture, AgradCdfParetoType2_ffv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_30, AgradCdfTestFixture, AgradCdfParetoType2_ffv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_31, AgradCdfTestFixture, AgradCdfParetoType2_ffv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_32, AgradCdfTestFixture, AgradCdfParetoType2_ffv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_33, AgradCdfTestFixture, AgradCdfParetoType2_ffv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_34, AgradCdfTestFixture, AgradCdfParetoType2_ffv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_35, AgradCdfTestFixture, AgradCdfParetoType2_ffv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_36, AgradCdfTestFixture, AgradCdfParetoType2_ffv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_37, AgradCdfTestFixture, AgradCdfParetoType2_ffv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_38, AgradCdfTestFixture, AgradCdfParetoType2_ffv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_39, AgradCdfTestFixture, AgradCdfParetoType2_ffv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_40, AgradCdfTestFixture, AgradCdfParetoType2_ffv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_41, AgradCdfTestFixture, AgradCdfParetoType2_ffv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_42, AgradCdfTestFixture, AgradCdfParetoType2_ffv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_43, AgradCdfTestFixture, AgradCdfParetoType2_ffv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_44, AgradCdfTestFixture, AgradCdfParetoType2_ffv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_45, AgradCdfTestFixture, AgradCdfParetoType2_ffv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_46, AgradCdfTestFixture, AgradCdfParetoType2_ffv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_47, AgradCdfTestFixture, AgradCdfParetoType2_ffv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_48, AgradCdfTestFixture, AgradCdfParetoType2_ffv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_49, AgradCdfTestFixture, AgradCdfParetoType2_ffv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_50, AgradCdfTestFixture, AgradCdfParetoType2_ffv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_51, AgradCdfTestFixture, AgradCdfParetoType2_ffv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_52, AgradCdfTestFixture, AgradCdfParetoType2_ffv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_53, AgradCdfTestFixture, AgradCdfParetoType2_ffv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_54, AgradCdfTestFixture, AgradCdfParetoType2_ffv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_55, AgradCdfTestFixture, AgradCdfParetoType2_ffv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_56, AgradCdfTestFixture, AgradCdfParetoType2_ffv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_57, AgradCdfTestFixture, AgradCdfParetoType2_ffv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_58, AgradCdfTestFixture, AgradCdfParetoType2_ffv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_59, AgradCdfTestFixture, AgradCdfParetoType2_ffv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_60, AgradCdfTestFixture, AgradCdfParetoType2_ffv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_61, AgradCdfTestFixture, AgradCdfParetoType2_ffv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_62, AgradCdfTestFixture, AgradCdfParetoType2_ffv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_63, AgradCdfTestFixture, AgradCdfParetoType2_ffv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_64, AgradCdfTestFixture, AgradCdfParetoType2_ffv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_65, AgradCdfTestFixture, AgradCdfParetoType2_ffv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_66, AgradCdfTestFixture, AgradCdfParetoType2_ffv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_67, AgradCdfTestFixture, AgradCdfParetoType2_ffv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_68, AgradCdfTestFixture, AgradCdfParetoType2_ffv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_69, AgradCdfTestFixture, AgradCdfParetoType2_ffv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_70, AgradCdfTestFixture, AgradCdfParetoType2_ffv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_71, AgradCdfTestFixture, AgradCdfParetoType2_ffv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_72, AgradCdfTestFixture, AgradCdfParetoType2_ffv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_73, AgradCdfTestFixture, AgradCdfParetoType2_ffv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_74, AgradCdfTestFixture, AgradCdfParetoType2_ffv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_75, AgradCdfTestFixture, AgradCdfParetoType2_ffv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_76, AgradCdfTestFixture, AgradCdfParetoType2_ffv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_77, AgradCdfTestFixture, AgradCdfParetoType2_ffv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_78, AgradCdfTestFixture, AgradCdfParetoType2_ffv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_79, AgradCdfTestFixture, AgradCdfParetoType2_ffv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_80, AgradCdfTestFixture, AgradCdfParetoType2_ffv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_81, AgradCdfTestFixture, AgradCdfParetoType2_ffv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_82, AgradCdfTestFixture, AgradCdfParetoType2_ffv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_83, AgradCdfTestFixture, AgradCdfParetoType2_ffv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_84, AgradCdfTestFixture, AgradCdfParetoType2_ffv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_85, AgradCdfTestFixture, AgradCdfParetoType2_ffv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_86, AgradCdfTestFixture, AgradCdfParetoType2_ffv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_87, AgradCdfTestFixture, AgradCdfParetoType2_ffv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_88, AgradCdfTestFixture, AgradCdfParetoType2_ffv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_89, AgradCdfTestFixture, AgradCdfParetoType2_ffv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_90, AgradCdfTestFixture, AgradCdfParetoType2_ffv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_91, AgradCdfTestFixture, AgradCdfParetoType2_ffv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_92, AgradCdfTestFixture, AgradCdfParetoType2_ffv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_93, AgradCdfTestFixture, AgradCdfParetoType2_ffv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_94, AgradCdfTestFixture, AgradCdfParetoType2_ffv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_95, AgradCdfTestFixture, AgradCdfParetoType2_ffv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_96, AgradCdfTestFixture, AgradCdfParetoType2_ffv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_97, AgradCdfTestFixture, AgradCdfParetoType2_ffv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_98, AgradCdfTestFixture, AgradCdfParetoType2_ffv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_99, AgradCdfTestFixture, AgradCdfParetoType2_ffv_99);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_cdf_test.hpp>
+
+typedef std::tuple<double, double, double, double, empty, empty> type_v_0;
+typedef std::tuple<double, double, double, std::vector<double>, empty, empty> type_v_1;
+typedef std::tuple<double, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_2;
+typedef std::tuple<double, double, double, var, empty, empty> type_v_3;
+typedef std::tuple<double, double, double, std::vector<var>, empty, empty> type_v_4;
+typedef std::tuple<double, double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_5;
+typedef std::tuple<double, double, std::vector<double>, double, empty, empty> type_v_6;
+typedef std::tuple<double, double, std::vector<double>, std::vector<double>, empty, empty> type_v_7;
+typedef std::tuple<double, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_8;
+typedef std::tuple<double, double, std::vector<double>, var, empty, empty> type_v_9;
+typedef std::tuple<double, double, std::vector<double>, std::vector<var>, empty, empty> type_v_10;
+typedef std::tuple<double, double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_11;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_12;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_13;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_14;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_15;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_16;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_17;
+typedef std::tuple<double, double, var, double, empty, empty> type_v_18;
+typedef std::tuple<double, double, var, std::vector<double>, empty, empty> type_v_19;
+typedef std::tuple<double, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_20;
+typedef std::tuple<double, double, var, var, empty, empty> type_v_21;
+typedef std::tuple<double, double, var, std::vector<var>, empty, empty> type_v_22;
+typedef std::tuple<double, double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_23;
+typedef std::tuple<double, double, std::vector<var>, double, empty, empty> type_v_24;
+typedef std::tuple<double, double, std::vector<var>, std::vector<double>, empty, empty> type_v_25;
+typedef std::tuple<double, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_26;
+typedef std::tuple<double, double, std::vector<var>, var, empty, empty> type_v_27;
+typedef std::tuple<double, double, std::vector<var>, std::vector<var>, empty, empty> type_v_28;
+typedef std::tuple<double, double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_29;
+typedef std::tuple<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_30;
+typedef std::tuple<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_31;
+typedef std::tuple<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_32;
+typedef std::tuple<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_33;
+typedef std::tuple<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_34;
+typedef std::tuple<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_35;
+typedef std::tuple<double, std::vector<double>, double, double, empty, empty> type_v_36;
+typedef std::tuple<double, std::vector<double>, double, std::vector<double>, empty, empty> type_v_37;
+typedef std::tuple<double, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_38;
+typedef std::tuple<double, std::vector<double>, double, var, empty, empty> type_v_39;
+typedef std::tuple<double, std::vector<double>, double, std::vector<var>, empty, empty> type_v_40;
+typedef std::tuple<double, std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_41;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, double, empty, empty> type_v_42;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, std::vector<double>, empty, empty> type_v_43;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_44;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, var, empty, empty> type_v_45;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_v_46;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_47;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_48;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_49;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_50;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_51;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_52;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_53;
+typedef std::tuple<double, std::vector<double>, var, double, empty, empty> type_v_54;
+typedef std::tuple<double, std::vector<double>, var, std::vector<double>, empty, empty> type_v_55;
+typedef std::tuple<double, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_56;
+typedef std::tuple<double, std::vector<double>, var, var, empty, empty> type_v_57;
+typedef std::tuple<double, std::vector<double>, var, std::vector<var>, empty, empty> type_v_58;
+typedef std::tuple<double, std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_59;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, double, empty, empty> type_v_60;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_v_61;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_62;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, var, empty, empty> type_v_63;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_v_64;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_65;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_66;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_67;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_68;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_69;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_70;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_71;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_72;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_73;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_74;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_75;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_76;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_77;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_78;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_79;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_80;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_81;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_82;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_83;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_84;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_85;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_86;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_87;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_88;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_89;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_90;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_91;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_92;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_93;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_94;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_95;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_96;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_97;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_98;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_99;
+
+typedef std::tuple<AgradCdfParetoType2, type_v_0> AgradCdfParetoType2_v_0;
+typedef std::tuple<AgradCdfParetoType2, type_v_1> AgradCdfParetoType2_v_1;
+typedef std::tuple<AgradCdfParetoType2, type_v_2> AgradCdfParetoType2_v_2;
+typedef std::tuple<AgradCdfParetoType2, type_v_3> AgradCdfParetoType2_v_3;
+typedef std::tuple<AgradCdfParetoType2, type_v_4> AgradCdfParetoType2_v_4;
+typedef std::tuple<AgradCdfParetoType2, type_v_5> AgradCdfParetoType2_v_5;
+typedef std::tuple<AgradCdfParetoType2, type_v_6> AgradCdfParetoType2_v_6;
+typedef std::tuple<AgradCdfParetoType2, type_v_7> AgradCdfParetoType2_v_7;
+typedef std::tuple<AgradCdfParetoType2, type_v_8> AgradCdfParetoType2_v_8;
+typedef std::tuple<AgradCdfParetoType2, type_v_9> AgradCdfParetoType2_v_9;
+typedef std::tuple<AgradCdfParetoType2, type_v_10> AgradCdfParetoType2_v_10;
+typedef std::tuple<AgradCdfParetoType2, type_v_11> AgradCdfParetoType2_v_11;
+typedef std::tuple<AgradCdfParetoType2, type_v_12> AgradCdfParetoType2_v_12;
+typedef std::tuple<AgradCdfParetoType2, type_v_13> AgradCdfParetoType2_v_13;
+typedef std::tuple<AgradCdfParetoType2, type_v_14> AgradCdfParetoType2_v_14;
+typedef std::tuple<AgradCdfParetoType2, type_v_15> AgradCdfParetoType2_v_15;
+typedef std::tuple<AgradCdfParetoType2, type_v_16> AgradCdfParetoType2_v_16;
+typedef std::tuple<AgradCdfParetoType2, type_v_17> AgradCdfParetoType2_v_17;
+typedef std::tuple<AgradCdfParetoType2, type_v_18> AgradCdfParetoType2_v_18;
+typedef std::tuple<AgradCdfParetoType2, type_v_19> AgradCdfParetoType2_v_19;
+typedef std::tuple<AgradCdfParetoType2, type_v_20> AgradCdfParetoType2_v_20;
+typedef std::tuple<AgradCdfParetoType2, type_v_21> AgradCdfParetoType2_v_21;
+typedef std::tuple<AgradCdfParetoType2, type_v_22> AgradCdfParetoType2_v_22;
+typedef std::tuple<AgradCdfParetoType2, type_v_23> AgradCdfParetoType2_v_23;
+typedef std::tuple<AgradCdfParetoType2, type_v_24> AgradCdfParetoType2_v_24;
+typedef std::tuple<AgradCdfParetoType2, type_v_25> AgradCdfParetoType2_v_25;
+typedef std::tuple<AgradCdfParetoType2, type_v_26> AgradCdfParetoType2_v_26;
+typedef std::tuple<AgradCdfParetoType2, type_v_27> AgradCdfParetoType2_v_27;
+typedef std::tuple<AgradCdfParetoType2, type_v_28> AgradCdfParetoType2_v_28;
+typedef std::tuple<AgradCdfParetoType2, type_v_29> AgradCdfParetoType2_v_29;
+typedef std::tuple<AgradCdfParetoType2, type_v_30> AgradCdfParetoType2_v_30;
+typedef std::tuple<AgradCdfParetoType2, type_v_31> AgradCdfParetoType2_v_31;
+typedef std::tuple<AgradCdfParetoType2, type_v_32> AgradCdfParetoType2_v_32;
+typedef std::tuple<AgradCdfParetoType2, type_v_33> AgradCdfParetoType2_v_33;
+typedef std::tuple<AgradCdfParetoType2, type_v_34> AgradCdfParetoType2_v_34;
+typedef std::tuple<AgradCdfParetoType2, type_v_35> AgradCdfParetoType2_v_35;
+typedef std::tuple<AgradCdfParetoType2, type_v_36> AgradCdfParetoType2_v_36;
+typedef std::tuple<AgradCdfParetoType2, type_v_37> AgradCdfParetoType2_v_37;
+typedef std::tuple<AgradCdfParetoType2, type_v_38> AgradCdfParetoType2_v_38;
+typedef std::tuple<AgradCdfParetoType2, type_v_39> AgradCdfParetoType2_v_39;
+typedef std::tuple<AgradCdfParetoType2, type_v_40> AgradCdfParetoType2_v_40;
+typedef std::tuple<AgradCdfParetoType2, type_v_41> AgradCdfParetoType2_v_41;
+typedef std::tuple<AgradCdfParetoType2, type_v_42> AgradCdfParetoType2_v_42;
+typedef std::tuple<AgradCdfParetoType2, type_v_43> AgradCdfParetoType2_v_43;
+typedef std::tuple<AgradCdfParetoType2, type_v_44> AgradCdfParetoType2_v_44;
+typedef std::tuple<AgradCdfParetoType2, type_v_45> AgradCdfParetoType2_v_45;
+typedef std::tuple<AgradCdfParetoType2, type_v_46> AgradCdfParetoType2_v_46;
+typedef std::tuple<AgradCdfParetoType2, type_v_47> AgradCdfParetoType2_v_47;
+typedef std::tuple<AgradCdfParetoType2, type_v_48> AgradCdfParetoType2_v_48;
+typedef std::tuple<AgradCdfParetoType2, type_v_49> AgradCdfParetoType2_v_49;
+typedef std::tuple<AgradCdfParetoType2, type_v_50> AgradCdfParetoType2_v_50;
+typedef std::tuple<AgradCdfParetoType2, type_v_51> AgradCdfParetoType2_v_51;
+typedef std::tuple<AgradCdfParetoType2, type_v_52> AgradCdfParetoType2_v_52;
+typedef std::tuple<AgradCdfParetoType2, type_v_53> AgradCdfParetoType2_v_53;
+typedef std::tuple<AgradCdfParetoType2, type_v_54> AgradCdfParetoType2_v_54;
+typedef std::tuple<AgradCdfParetoType2, type_v_55> AgradCdfParetoType2_v_55;
+typedef std::tuple<AgradCdfParetoType2, type_v_56> AgradCdfParetoType2_v_56;
+typedef std::tuple<AgradCdfParetoType2, type_v_57> AgradCdfParetoType2_v_57;
+typedef std::tuple<AgradCdfParetoType2, type_v_58> AgradCdfParetoType2_v_58;
+typedef std::tuple<AgradCdfParetoType2, type_v_59> AgradCdfParetoType2_v_59;
+typedef std::tuple<AgradCdfParetoType2, type_v_60> AgradCdfParetoType2_v_60;
+typedef std::tuple<AgradCdfParetoType2, type_v_61> AgradCdfParetoType2_v_61;
+typedef std::tuple<AgradCdfParetoType2, type_v_62> AgradCdfParetoType2_v_62;
+typedef std::tuple<AgradCdfParetoType2, type_v_63> AgradCdfParetoType2_v_63;
+typedef std::tuple<AgradCdfParetoType2, type_v_64> AgradCdfParetoType2_v_64;
+typedef std::tuple<AgradCdfParetoType2, type_v_65> AgradCdfParetoType2_v_65;
+typedef std::tuple<AgradCdfParetoType2, type_v_66> AgradCdfParetoType2_v_66;
+typedef std::tuple<AgradCdfParetoType2, type_v_67> AgradCdfParetoType2_v_67;
+typedef std::tuple<AgradCdfParetoType2, type_v_68> AgradCdfParetoType2_v_68;
+typedef std::tuple<AgradCdfParetoType2, type_v_69> AgradCdfParetoType2_v_69;
+typedef std::tuple<AgradCdfParetoType2, type_v_70> AgradCdfParetoType2_v_70;
+typedef std::tuple<AgradCdfParetoType2, type_v_71> AgradCdfParetoType2_v_71;
+typedef std::tuple<AgradCdfParetoType2, type_v_72> AgradCdfParetoType2_v_72;
+typedef std::tuple<AgradCdfParetoType2, type_v_73> AgradCdfParetoType2_v_73;
+typedef std::tuple<AgradCdfParetoType2, type_v_74> AgradCdfParetoType2_v_74;
+typedef std::tuple<AgradCdfParetoType2, type_v_75> AgradCdfParetoType2_v_75;
+typedef std::tuple<AgradCdfParetoType2, type_v_76> AgradCdfParetoType2_v_76;
+typedef std::tuple<AgradCdfParetoType2, type_v_77> AgradCdfParetoType2_v_77;
+typedef std::tuple<AgradCdfParetoType2, type_v_78> AgradCdfParetoType2_v_78;
+typedef std::tuple<AgradCdfParetoType2, type_v_79> AgradCdfParetoType2_v_79;
+typedef std::tuple<AgradCdfParetoType2, type_v_80> AgradCdfParetoType2_v_80;
+typedef std::tuple<AgradCdfParetoType2, type_v_81> AgradCdfParetoType2_v_81;
+typedef std::tuple<AgradCdfParetoType2, type_v_82> AgradCdfParetoType2_v_82;
+typedef std::tuple<AgradCdfParetoType2, type_v_83> AgradCdfParetoType2_v_83;
+typedef std::tuple<AgradCdfParetoType2, type_v_84> AgradCdfParetoType2_v_84;
+typedef std::tuple<AgradCdfParetoType2, type_v_85> AgradCdfParetoType2_v_85;
+typedef std::tuple<AgradCdfParetoType2, type_v_86> AgradCdfParetoType2_v_86;
+typedef std::tuple<AgradCdfParetoType2, type_v_87> AgradCdfParetoType2_v_87;
+typedef std::tuple<AgradCdfParetoType2, type_v_88> AgradCdfParetoType2_v_88;
+typedef std::tuple<AgradCdfParetoType2, type_v_89> AgradCdfParetoType2_v_89;
+typedef std::tuple<AgradCdfParetoType2, type_v_90> AgradCdfParetoType2_v_90;
+typedef std::tuple<AgradCdfParetoType2, type_v_91> AgradCdfParetoType2_v_91;
+typedef std::tuple<AgradCdfParetoType2, type_v_92> AgradCdfParetoType2_v_92;
+typedef std::tuple<AgradCdfParetoType2, type_v_93> AgradCdfParetoType2_v_93;
+typedef std::tuple<AgradCdfParetoType2, type_v_94> AgradCdfParetoType2_v_94;
+typedef std::tuple<AgradCdfParetoType2, type_v_95> AgradCdfParetoType2_v_95;
+typedef std::tuple<AgradCdfParetoType2, type_v_96> AgradCdfParetoType2_v_96;
+typedef std::tuple<AgradCdfParetoType2, type_v_97> AgradCdfParetoType2_v_97;
+typedef std::tuple<AgradCdfParetoType2, type_v_98> AgradCdfParetoType2_v_98;
+typedef std::tuple<AgradCdfParetoType2, type_v_99> AgradCdfParetoType2_v_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_0, AgradCdfTestFixture, AgradCdfParetoType2_v_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_1, AgradCdfTestFixture, AgradCdfParetoType2_v_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_2, AgradCdfTestFixture, AgradCdfParetoType2_v_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_3, AgradCdfTestFixture, AgradCdfParetoType2_v_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_4, AgradCdfTestFixture, AgradCdfParetoType2_v_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_5, AgradCdfTestFixture, AgradCdfParetoType2_v_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_6, AgradCdfTestFixture, AgradCdfParetoType2_v_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_7, AgradCdfTestFixture, AgradCdfParetoType2_v_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_8, AgradCdfTestFixture, AgradCdfParetoType2_v_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_9, AgradCdfTestFixture, AgradCdfParetoType2_v_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_10, AgradCdfTestFixture, AgradCdfParetoType2_v_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_11, AgradCdfTestFixture, AgradCdfParetoType2_v_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_12, AgradCdfTestFixture, AgradCdfParetoType2_v_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_13, AgradCdfTestFixture, AgradCdfParetoType2_v_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_14, AgradCdfTestFixture, AgradCdfParetoType2_v_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_15, AgradCdfTestFixture, AgradCdfParetoType2_v_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_16, AgradCdfTestFixture, AgradCdfParetoType2_v_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_17, AgradCdfTestFixture, AgradCdfParetoType2_v_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_18, AgradCdfTestFixture, AgradCdfParetoType2_v_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_19, AgradCdfTestFixture, AgradCdfParetoType2_v_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_20, AgradCdfTestFixture, AgradCdfParetoType2_v_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_21, AgradCdfTestFixture, AgradCdfParetoType2_v_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_22, AgradCdfTestFixture, AgradCdfParetoType2_v_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_23, AgradCdfTestFixture, AgradCdfParetoType2_v_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_24, AgradCdfTestFixture, AgradCdfParetoType2_v_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_25, AgradCdfTestFixture, AgradCdfParetoType2_v_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_26, AgradCdfTestFixture, AgradCdfParetoType2_v_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_27, AgradCdfTestFixture, AgradCdfParetoType2_v_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_28, AgradCdfTestFixture, AgradCdfParetoType2_v_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_29, AgradCdfTestFixture, AgradCdfParetoType2_v_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_30, AgradCdfTestFixture, AgradCdfParetoType2_v_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_31, AgradCdfTestFixture, AgradCdfParetoType2_v_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_32, AgradCdfTestFixture, AgradCdfParetoType2_v_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_33, AgradCdfTestFixture, AgradCdfParetoType2_v_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_34, AgradCdfTestFixture, AgradCdfParetoType2_v_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_35, AgradCdfTestFixture, AgradCdfParetoType2_v_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_36, AgradCdfTestFixture, AgradCdfParetoType2_v_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_37, AgradCdfTestFixture, AgradCdfParetoType2_v_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_38, AgradCdfTestFixture, AgradCdfParetoType2_v_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_39, AgradCdfTestFixture, AgradCdfParetoType2_v_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_40, AgradCdfTestFixture, AgradCdfParetoType2_v_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_41, AgradCdfTestFixture, AgradCdfParetoType2_v_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_42, AgradCdfTestFixture, AgradCdfParetoType2_v_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_43, AgradCdfTestFixture, AgradCdfParetoType2_v_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_44, AgradCdfTestFixture, AgradCdfParetoType2_v_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_45, AgradCdfTestFixture, AgradCdfParetoType2_v_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_46, AgradCdfTestFixture, AgradCdfParetoType2_v_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_47, AgradCdfTestFixture, AgradCdfParetoType2_v_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_48, AgradCdfTestFixture, AgradCdfParetoType2_v_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_49, AgradCdfTestFixture, AgradCdfParetoType2_v_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_50, AgradCdfTestFixture, AgradCdfParetoType2_v_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_51, AgradCdfTestFixture, AgradCdfParetoType2_v_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_52, AgradCdfTestFixture, AgradCdfParetoType2_v_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_53, AgradCdfTestFixture, AgradCdfParetoType2_v_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_54, AgradCdfTestFixture, AgradCdfParetoType2_v_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_55, AgradCdfTestFixture, AgradCdfParetoType2_v_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_56, AgradCdfTestFixture, AgradCdfParetoType2_v_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_57, AgradCdfTestFixture, AgradCdfParetoType2_v_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_58, AgradCdfTestFixture, AgradCdfParetoType2_v_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_59, AgradCdfTestFixture, AgradCdfParetoType2_v_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_60, AgradCdfTestFixture, AgradCdfParetoType2_v_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_61, AgradCdfTestFixture, AgradCdfParetoType2_v_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_62, AgradCdfTestFixture, AgradCdfParetoType2_v_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_63, AgradCdfTestFixture, AgradCdfParetoType2_v_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_64, AgradCdfTestFixture, AgradCdfParetoType2_v_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_65, AgradCdfTestFixture, AgradCdfParetoType2_v_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_66, AgradCdfTestFixture, AgradCdfParetoType2_v_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_67, AgradCdfTestFixture, AgradCdfParetoType2_v_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_68, AgradCdfTestFixture, AgradCdfParetoType2_v_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_69, AgradCdfTestFixture, AgradCdfParetoType2_v_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_70, AgradCdfTestFixture, AgradCdfParetoType2_v_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_71, AgradCdfTestFixture, AgradCdfParetoType2_v_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_72, AgradCdfTestFixture, AgradCdfParetoType2_v_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_73, AgradCdfTestFixture, AgradCdfParetoType2_v_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_74, AgradCdfTestFixture, AgradCdfParetoType2_v_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_75, AgradCdfTestFixture, AgradCdfParetoType2_v_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_76, AgradCdfTestFixture, AgradCdfParetoType2_v_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_77, AgradCdfTestFixture, AgradCdfParetoType2_v_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_78, AgradCdfTestFixture, AgradCdfParetoType2_v_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_79, AgradCdfTestFixture, AgradCdfParetoType2_v_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_80, AgradCdfTestFixture, AgradCdfParetoType2_v_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_81, AgradCdfTestFixture, AgradCdfParetoType2_v_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_82, AgradCdfTestFixture, AgradCdfParetoType2_v_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_83, AgradCdfTestFixture, AgradCdfParetoType2_v_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_84, AgradCdfTestFixture, AgradCdfParetoType2_v_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_85, AgradCdfTestFixture, AgradCdfParetoType2_v_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_86, AgradCdfTestFixture, AgradCdfParetoType2_v_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_87, AgradCdfTestFixture, AgradCdfParetoType2_v_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_88, AgradCdfTestFixture, AgradCdfParetoType2_v_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_89, AgradCdfTestFixture, AgradCdfParetoType2_v_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_90, AgradCdfTestFixture, AgradCdfParetoType2_v_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_91, AgradCdfTestFixture, AgradCdfParetoType2_v_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_92, AgradCdfTestFixture, AgradCdfParetoType2_v_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_93, AgradCdfTestFixture, AgradCdfParetoType2_v_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_94, AgradCdfTestFixture, AgradCdfParetoType2_v_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_95, AgradCdfTestFixture, AgradCdfParetoType2_v_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_96, AgradCdfTestFixture, AgradCdfParetoType2_v_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_97, AgradCdfTestFixture, AgradCdfParetoType2_v_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_98, AgradCdfTestFixture, AgradCdfParetoType2_v_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_99, AgradCdfTestFixture, AgradCdfParetoType2_v_99);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_cdf_test.hpp>
+
+typedef std::tuple<double, double, double, var, empty, empty> type_vv_0;
+typedef std::tuple<double, double, double, std::vector<var>, empty, empty> type_vv_1;
+typedef std::tuple<double, double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_2;
+typedef std::tuple<double, double, std::vector<double>, var, empty, empty> type_vv_3;
+typedef std::tuple<double, double, std::vector<double>, std::vector<var>, empty, empty> type_vv_4;
+typedef std::tuple<double, double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_5;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_6;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_7;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_8;
+typedef std::tuple<double, double, var, double, empty, empty> type_vv_9;
+typedef std::tuple<double, double, var, std::vector<double>, empty, empty> type_vv_10;
+typedef std::tuple<double, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_11;
+typedef std::tuple<double, double, var, var, empty, empty> type_vv_12;
+typedef std::tuple<double, double, var, std::vector<var>, empty, empty> type_vv_13;
+typedef std::tuple<double, double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_14;
+typedef std::tuple<double, double, std::vector<var>, double, empty, empty> type_vv_15;
+typedef std::tuple<double, double, std::vector<var>, std::vector<double>, empty, empty> type_vv_16;
+typedef std::tuple<double, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_17;
+typedef std::tuple<double, double, std::vector<var>, var, empty, empty> type_vv_18;
+typedef std::tuple<double, double, std::vector<var>, std::vector<var>, empty, empty> type_vv_19;
+typedef std::tuple<double, double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_20;
+typedef std::tuple<double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_21;
+typedef std::tuple<double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_22;
+typedef std::tuple<double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_23;
+typedef std::tuple<double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_24;
+typedef std::tuple<double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_25;
+typedef std::tuple<double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_26;
+typedef std::tuple<double, std::vector<double>, double, var, empty, empty> type_vv_27;
+typedef std::tuple<double, std::vector<double>, double, std::vector<var>, empty, empty> type_vv_28;
+typedef std::tuple<double, std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_29;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, var, empty, empty> type_vv_30;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_vv_31;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_32;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_33;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_34;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_35;
+typedef std::tuple<double, std::vector<double>, var, double, empty, empty> type_vv_36;
+typedef std::tuple<double, std::vector<double>, var, std::vector<double>, empty, empty> type_vv_37;
+typedef std::tuple<double, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_38;
+typedef std::tuple<double, std::vector<double>, var, var, empty, empty> type_vv_39;
+typedef std::tuple<double, std::vector<double>, var, std::vector<var>, empty, empty> type_vv_40;
+typedef std::tuple<double, std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_41;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, double, empty, empty> type_vv_42;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_vv_43;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_44;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, var, empty, empty> type_vv_45;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_vv_46;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_47;
+typedef std::tuple<double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_48;
+typedef std::tuple<double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_49;
+typedef std::tuple<double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_50;
+typedef std::tuple<double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_51;
+typedef std::tuple<double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_52;
+typedef std::tuple<double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_53;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_vv_54;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_vv_55;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_56;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_vv_57;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_vv_58;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_59;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_60;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_61;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_62;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_vv_63;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_vv_64;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_65;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_vv_66;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_vv_67;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_68;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_vv_69;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_vv_70;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_71;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_vv_72;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_vv_73;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_74;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_75;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_76;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_77;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_78;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_79;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_80;
+typedef std::tuple<double, var, double, double, empty, empty> type_vv_81;
+typedef std::tuple<double, var, double, std::vector<double>, empty, empty> type_vv_82;
+typedef std::tuple<double, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_83;
+typedef std::tuple<double, var, double, var, empty, empty> type_vv_84;
+typedef std::tuple<double, var, double, std::vector<var>, empty, empty> type_vv_85;
+typedef std::tuple<double, var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_86;
+typedef std::tuple<double, var, std::vector<double>, double, empty, empty> type_vv_87;
+typedef std::tuple<double, var, std::vector<double>, std::vector<double>, empty, empty> type_vv_88;
+typedef std::tuple<double, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_89;
+typedef std::tuple<double, var, std::vector<double>, var, empty, empty> type_vv_90;
+typedef std::tuple<double, var, std::vector<double>, std::vector<var>, empty, empty> type_vv_91;
+typedef std::tuple<double, var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_92;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_93;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_94;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_95;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_96;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_97;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_98;
+typedef std::tuple<double, var, var, double, empty, empty> type_vv_99;
+
+typedef std::tuple<AgradCdfParetoType2, type_vv_0> AgradCdfParetoType2_vv_0;
+typedef std::tuple<AgradCdfParetoType2, type_vv_1> AgradCdfParetoType2_vv_1;
+typedef std::tuple<AgradCdfParetoType2, type_vv_2> AgradCdfParetoType2_vv_2;
+typedef std::tuple<AgradCdfParetoType2, type_vv_3> AgradCdfParetoType2_vv_3;
+typedef std::tuple<AgradCdfParetoType2, type_vv_4> AgradCdfParetoType2_vv_4;
+typedef std::tuple<AgradCdfParetoType2, type_vv_5> AgradCdfParetoType2_vv_5;
+typedef std::tuple<AgradCdfParetoType2, type_vv_6> AgradCdfParetoType2_vv_6;
+typedef std::tuple<AgradCdfParetoType2, type_vv_7> AgradCdfParetoType2_vv_7;
+typedef std::tuple<AgradCdfParetoType2, type_vv_8> AgradCdfParetoType2_vv_8;
+typedef std::tuple<AgradCdfParetoType2, type_vv_9> AgradCdfParetoType2_vv_9;
+typedef std::tuple<AgradCdfParetoType2, type_vv_10> AgradCdfParetoType2_vv_10;
+typedef std::tuple<AgradCdfParetoType2, type_vv_11> AgradCdfParetoType2_vv_11;
+typedef std::tuple<AgradCdfParetoType2, type_vv_12> AgradCdfParetoType2_vv_12;
+typedef std::tuple<AgradCdfParetoType2, type_vv_13> AgradCdfParetoType2_vv_13;
+typedef std::tuple<AgradCdfParetoType2, type_vv_14> AgradCdfParetoType2_vv_14;
+typedef std::tuple<AgradCdfParetoType2, type_vv_15> AgradCdfParetoType2_vv_15;
+typedef std::tuple<AgradCdfParetoType2, type_vv_16> AgradCdfParetoType2_vv_16;
+typedef std::tuple<AgradCdfParetoType2, type_vv_17> AgradCdfParetoType2_vv_17;
+typedef std::tuple<AgradCdfParetoType2, type_vv_18> AgradCdfParetoType2_vv_18;
+typedef std::tuple<AgradCdfParetoType2, type_vv_19> AgradCdfParetoType2_vv_19;
+typedef std::tuple<AgradCdfParetoType2, type_vv_20> AgradCdfParetoType2_vv_20;
+typedef std::tuple<AgradCdfParetoType2, type_vv_21> AgradCdfParetoType2_vv_21;
+typedef std::tuple<AgradCdfParetoType2, type_vv_22> AgradCdfParetoType2_vv_22;
+typedef std::tuple<AgradCdfParetoType2, type_vv_23> AgradCdfParetoType2_vv_23;
+typedef std::tuple<AgradCdfParetoType2, type_vv_24> AgradCdfParetoType2_vv_24;
+typedef std::tuple<AgradCdfParetoType2, type_vv_25> AgradCdfParetoType2_vv_25;
+typedef std::tuple<AgradCdfParetoType2, type_vv_26> AgradCdfParetoType2_vv_26;
+typedef std::tuple<AgradCdfParetoType2, type_vv_27> AgradCdfParetoType2_vv_27;
+typedef std::tuple<AgradCdfParetoType2, type_vv_28> AgradCdfParetoType2_vv_28;
+typedef std::tuple<AgradCdfParetoType2, type_vv_29> AgradCdfParetoType2_vv_29;
+typedef std::tuple<AgradCdfParetoType2, type_vv_30> AgradCdfParetoType2_vv_30;
+typedef std::tuple<AgradCdfParetoType2, type_vv_31> AgradCdfParetoType2_vv_31;
+typedef std::tuple<AgradCdfParetoType2, type_vv_32> AgradCdfParetoType2_vv_32;
+typedef std::tuple<AgradCdfParetoType2, type_vv_33> AgradCdfParetoType2_vv_33;
+typedef std::tuple<AgradCdfParetoType2, type_vv_34> AgradCdfParetoType2_vv_34;
+typedef std::tuple<AgradCdfParetoType2, type_vv_35> AgradCdfParetoType2_vv_35;
+typedef std::tuple<AgradCdfParetoType2, type_vv_36> AgradCdfParetoType2_vv_36;
+typedef std::tuple<AgradCdfParetoType2, type_vv_37> AgradCdfParetoType2_vv_37;
+typedef std::tuple<AgradCdfParetoType2, type_vv_38> AgradCdfParetoType2_vv_38;
+typedef std::tuple<AgradCdfParetoType2, type_vv_39> AgradCdfParetoType2_vv_39;
+typedef std::tuple<AgradCdfParetoType2, type_vv_40> AgradCdfParetoType2_vv_40;
+typedef std::tuple<AgradCdfParetoType2, type_vv_41> AgradCdfParetoType2_vv_41;
+typedef std::tuple<AgradCdfParetoType2, type_vv_42> AgradCdfParetoType2_vv_42;
+typedef std::tuple<AgradCdfParetoType2, type_vv_43> AgradCdfParetoType2_vv_43;
+typedef std::tuple<AgradCdfParetoType2, type_vv_44> AgradCdfParetoType2_vv_44;
+typedef std::tuple<AgradCdfParetoType2, type_vv_45> AgradCdfParetoType2_vv_45;
+typedef std::tuple<AgradCdfParetoType2, type_vv_46> AgradCdfParetoType2_vv_46;
+typedef std::tuple<AgradCdfParetoType2, type_vv_47> AgradCdfParetoType2_vv_47;
+typedef std::tuple<AgradCdfParetoType2, type_vv_48> AgradCdfParetoType2_vv_48;
+typedef std::tuple<AgradCdfParetoType2, type_vv_49> AgradCdfParetoType2_vv_49;
+typedef std::tuple<AgradCdfParetoType2, type_vv_50> AgradCdfParetoType2_vv_50;
+typedef std::tuple<AgradCdfParetoType2, type_vv_51> AgradCdfParetoType2_vv_51;
+typedef std::tuple<AgradCdfParetoType2, type_vv_52> AgradCdfParetoType2_vv_52;
+typedef std::tuple<AgradCdfParetoType2, type_vv_53> AgradCdfParetoType2_vv_53;
+typedef std::tuple<AgradCdfParetoType2, type_vv_54> AgradCdfParetoType2_vv_54;
+typedef std::tuple<AgradCdfParetoType2, type_vv_55> AgradCdfParetoType2_vv_55;
+typedef std::tuple<AgradCdfParetoType2, type_vv_56> AgradCdfParetoType2_vv_56;
+typedef std::tuple<AgradCdfParetoType2, type_vv_57> AgradCdfParetoType2_vv_57;
+typedef std::tuple<AgradCdfParetoType2, type_vv_58> AgradCdfParetoType2_vv_58;
+typedef std::tuple<AgradCdfParetoType2, type_vv_59> AgradCdfParetoType2_vv_59;
+typedef std::tuple<AgradCdfParetoType2, type_vv_60> AgradCdfParetoType2_vv_60;
+typedef std::tuple<AgradCdfParetoType2, type_vv_61> AgradCdfParetoType2_vv_61;
+typedef std::tuple<AgradCdfParetoType2, type_vv_62> AgradCdfParetoType2_vv_62;
+typedef std::tuple<AgradCdfParetoType2, type_vv_63> AgradCdfParetoType2_vv_63;
+typedef std::tuple<AgradCdfParetoType2, type_vv_64> AgradCdfParetoType2_vv_64;
+typedef std::tuple<AgradCdfParetoType2, type_vv_65> AgradCdfParetoType2_vv_65;
+typedef std::tuple<AgradCdfParetoType2, type_vv_66> AgradCdfParetoType2_vv_66;
+typedef std::tuple<AgradCdfParetoType2, type_vv_67> AgradCdfParetoType2_vv_67;
+typedef std::tuple<AgradCdfParetoType2, type_vv_68> AgradCdfParetoType2_vv_68;
+typedef std::tuple<AgradCdfParetoType2, type_vv_69> AgradCdfParetoType2_vv_69;
+typedef std::tuple<AgradCdfParetoType2, type_vv_70> AgradCdfParetoType2_vv_70;
+typedef std::tuple<AgradCdfParetoType2, type_vv_71> AgradCdfParetoType2_vv_71;
+typedef std::tuple<AgradCdfParetoType2, type_vv_72> AgradCdfParetoType2_vv_72;
+typedef std::tuple<AgradCdfParetoType2, type_vv_73> AgradCdfParetoType2_vv_73;
+typedef std::tuple<AgradCdfParetoType2, type_vv_74> AgradCdfParetoType2_vv_74;
+typedef std::tuple<AgradCdfParetoType2, type_vv_75> AgradCdfParetoType2_vv_75;
+typedef std::tuple<AgradCdfParetoType2, type_vv_76> AgradCdfParetoType2_vv_76;
+typedef std::tuple<AgradCdfParetoType2, type_vv_77> AgradCdfParetoType2_vv_77;
+typedef std::tuple<AgradCdfParetoType2, type_vv_78> AgradCdfParetoType2_vv_78;
+typedef std::tuple<AgradCdfParetoType2, type_vv_79> AgradCdfParetoType2_vv_79;
+typedef std::tuple<AgradCdfParetoType2, type_vv_80> AgradCdfParetoType2_vv_80;
+typedef std::tuple<AgradCdfParetoType2, type_vv_81> AgradCdfParetoType2_vv_81;
+typedef std::tuple<AgradCdfParetoType2, type_vv_82> AgradCdfParetoType2_vv_82;
+typedef std::tuple<AgradCdfParetoType2, type_vv_83> AgradCdfParetoType2_vv_83;
+typedef std::tuple<AgradCdfParetoType2, type_vv_84> AgradCdfParetoType2_vv_84;
+typedef std::tuple<AgradCdfParetoType2, type_vv_85> AgradCdfParetoType2_vv_85;
+typedef std::tuple<AgradCdfParetoType2, type_vv_86> AgradCdfParetoType2_vv_86;
+typedef std::tuple<AgradCdfParetoType2, type_vv_87> AgradCdfParetoType2_vv_87;
+typedef std::tuple<AgradCdfParetoType2, type_vv_88> AgradCdfParetoType2_vv_88;
+typedef std::tuple<AgradCdfParetoType2, type_vv_89> AgradCdfParetoType2_vv_89;
+typedef std::tuple<AgradCdfParetoType2, type_vv_90> AgradCdfParetoType2_vv_90;
+typedef std::tuple<AgradCdfParetoType2, type_vv_91> AgradCdfParetoType2_vv_91;
+typedef std::tuple<AgradCdfParetoType2, type_vv_92> AgradCdfParetoType2_vv_92;
+typedef std::tuple<AgradCdfParetoType2, type_vv_93> AgradCdfParetoType2_vv_93;
+typedef std::tuple<AgradCdfParetoType2, type_vv_94> AgradCdfParetoType2_vv_94;
+typedef std::tuple<AgradCdfParetoType2, type_vv_95> AgradCdfParetoType2_vv_95;
+typedef std::tuple<AgradCdfParetoType2, type_vv_96> AgradCdfParetoType2_vv_96;
+typedef std::tuple<AgradCdfParetoType2, type_vv_97> AgradCdfParetoType2_vv_97;
+typedef std::tuple<AgradCdfParetoType2, type_vv_98> AgradCdfParetoType2_vv_98;
+typedef std::tuple<AgradCdfParetoType2, type_vv_99> AgradCdfParetoType2_vv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_0, AgradCdfTestFixture, AgradCdfParetoType2_vv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_1, AgradCdfTestFixture, AgradCdfParetoType2_vv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_2, AgradCdfTestFixture, AgradCdfParetoType2_vv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_3, AgradCdfTestFixture, AgradCdfParetoType2_vv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_4, AgradCdfTestFixture, AgradCdfParetoType2_vv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_5, AgradCdfTestFixture, AgradCdfParetoType2_vv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_6, AgradCdfTestFixture, AgradCdfParetoType2_vv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_7, AgradCdfTestFixture, AgradCdfParetoType2_vv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_8, AgradCdfTestFixture, AgradCdfParetoType2_vv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_9, AgradCdfTestFixture, AgradCdfParetoType2_vv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_10, AgradCdfTestFixture, AgradCdfParetoType2_vv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_11, AgradCdfTestFixture, AgradCdfParetoType2_vv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_12, AgradCdfTestFixture, AgradCdfParetoType2_vv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_13, AgradCdfTestFixture, AgradCdfParetoType2_vv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_14, AgradCdfTestFixture, AgradCdfParetoType2_vv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_15, AgradCdfTestFixture, AgradCdfParetoType2_vv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_16, AgradCdfTestFixture, AgradCdfParetoType2_vv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_17, AgradCdfTestFixture, AgradCdfParetoType2_vv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_18, AgradCdfTestFixture, AgradCdfParetoType2_vv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_19, AgradCdfTestFixture, AgradCdfParetoType2_vv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_20, AgradCdfTestFixture, AgradCdfParetoType2_vv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_21, AgradCdfTestFixture, AgradCdfParetoType2_vv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_22, AgradCdfTestFixture, AgradCdfParetoType2_vv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_23, AgradCdfTestFixture, AgradCdfParetoType2_vv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_24, AgradCdfTestFixture, AgradCdfParetoType2_vv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_25, AgradCdfTestFixture, AgradCdfParetoType2_vv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_26, AgradCdfTestFixture, AgradCdfParetoType2_vv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_27, AgradCdfTestFixture, AgradCdfParetoType2_vv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_28, AgradCdfTestFixture, AgradCdfParetoType2_vv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_29, AgradCdfTestFixture, AgradCdfParetoType2_vv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_30, AgradCdfTestFixture, AgradCdfParetoType2_vv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_31, AgradCdfTestFixture, AgradCdfParetoType2_vv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_32, AgradCdfTestFixture, AgradCdfParetoType2_vv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_33, AgradCdfTestFixture, AgradCdfParetoType2_vv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_34, AgradCdfTestFixture, AgradCdfParetoType2_vv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_35, AgradCdfTestFixture, AgradCdfParetoType2_vv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_36, AgradCdfTestFixture, AgradCdfParetoType2_vv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_37, AgradCdfTestFixture, AgradCdfParetoType2_vv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_38, AgradCdfTestFixture, AgradCdfParetoType2_vv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_39, AgradCdfTestFixture, AgradCdfParetoType2_vv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_40, AgradCdfTestFixture, AgradCdfParetoType2_vv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_41, AgradCdfTestFixture, AgradCdfParetoType2_vv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_42, AgradCdfTestFixture, AgradCdfParetoType2_vv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_43, AgradCdfTestFixture, AgradCdfParetoType2_vv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_44, AgradCdfTestFixture, AgradCdfParetoType2_vv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_45, AgradCdfTestFixture, AgradCdfParetoType2_vv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_46, AgradCdfTestFixture, AgradCdfParetoType2_vv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_47, AgradCdfTestFixture, AgradCdfParetoType2_vv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_48, AgradCdfTestFixture, AgradCdfParetoType2_vv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_49, AgradCdfTestFixture, AgradCdfParetoType2_vv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_50, AgradCdfTestFixture, AgradCdfParetoType2_vv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_51, AgradCdfTestFixture, AgradCdfParetoType2_vv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_52, AgradCdfTestFixture, AgradCdfParetoType2_vv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_53, AgradCdfTestFixture, AgradCdfParetoType2_vv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_54, AgradCdfTestFixture, AgradCdfParetoType2_vv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_55, AgradCdfTestFixture, AgradCdfParetoType2_vv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_56, AgradCdfTestFixture, AgradCdfParetoType2_vv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_57, AgradCdfTestFixture, AgradCdfParetoType2_vv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_58, AgradCdfTestFixture, AgradCdfParetoType2_vv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_59, AgradCdfTestFixture, AgradCdfParetoType2_vv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_60, AgradCdfTestFixture, AgradCdfParetoType2_vv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_61, AgradCdfTestFixture, AgradCdfParetoType2_vv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_62, AgradCdfTestFixture, AgradCdfParetoType2_vv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_63, AgradCdfTestFixture, AgradCdfParetoType2_vv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_64, AgradCdfTestFixture, AgradCdfParetoType2_vv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_65, AgradCdfTestFixture, AgradCdfParetoType2_vv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_66, AgradCdfTestFixture, AgradCdfParetoType2_vv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_67, AgradCdfTestFixture, AgradCdfParetoType2_vv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_68, AgradCdfTestFixture, AgradCdfParetoType2_vv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_69, AgradCdfTestFixture, AgradCdfParetoType2_vv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_70, AgradCdfTestFixture, AgradCdfParetoType2_vv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_71, AgradCdfTestFixture, AgradCdfParetoType2_vv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_72, AgradCdfTestFixture, AgradCdfParetoType2_vv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_73, AgradCdfTestFixture, AgradCdfParetoType2_vv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_74, AgradCdfTestFixture, AgradCdfParetoType2_vv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_75, AgradCdfTestFixture, AgradCdfParetoType2_vv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_76, AgradCdfTestFixture, AgradCdfParetoType2_vv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_77, AgradCdfTestFixture, AgradCdfParetoType2_vv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_78, AgradCdfTestFixture, AgradCdfParetoType2_vv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_79, AgradCdfTestFixture, AgradCdfParetoType2_vv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_80, AgradCdfTestFixture, AgradCdfParetoType2_vv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_81, AgradCdfTestFixture, AgradCdfParetoType2_vv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_82, AgradCdfTestFixture, AgradCdfParetoType2_vv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_83, AgradCdfTestFixture, AgradCdfParetoType2_vv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_84, AgradCdfTestFixture, AgradCdfParetoType2_vv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_85, AgradCdfTestFixture, AgradCdfParetoType2_vv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_86, AgradCdfTestFixture, AgradCdfParetoType2_vv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_87, AgradCdfTestFixture, AgradCdfParetoType2_vv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_88, AgradCdfTestFixture, AgradCdfParetoType2_vv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_89, AgradCdfTestFixture, AgradCdfParetoType2_vv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_90, AgradCdfTestFixture, AgradCdfParetoType2_vv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_91, AgradCdfTestFixture, AgradCdfParetoType2_vv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_92, AgradCdfTestFixture, AgradCdfParetoType2_vv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_93, AgradCdfTestFixture, AgradCdfParetoType2_vv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_94, AgradCdfTestFixture, AgradCdfParetoType2_vv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_95, AgradCdfTestFixture, AgradCdfParetoType2_vv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_96, AgradCdfTestFixture, AgradCdfParetoType2_vv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_97, AgradCdfTestFixture, AgradCdfParetoType2_vv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_98, AgradCdfTestFixture, AgradCdfParetoType2_vv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_99, AgradCdfTestFixture, AgradCdfParetoType2_vv_99);
+
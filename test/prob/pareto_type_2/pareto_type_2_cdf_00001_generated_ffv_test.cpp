@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_cdf_test.hpp>
+
+typedef std::tuple<double, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_100;
+typedef std::tuple<double, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_101;
+typedef std::tuple<double, fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_102;
+typedef std::tuple<double, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_103;
+typedef std::tuple<double, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_104;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_105;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_106;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_107;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_108;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_109;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_110;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_111;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_112;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_113;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_114;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_115;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_116;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, double, double, empty, empty> type_ffv_117;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty, empty> type_ffv_118;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_119;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty, empty> type_ffv_120;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_121;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_122;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty, empty> type_ffv_123;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_124;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_125;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_126;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_127;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_128;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_129;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_130;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_131;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_132;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_133;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_134;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty, empty> type_ffv_135;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_136;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_137;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_138;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_139;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_140;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_141;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_142;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_143;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_144;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_145;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_146;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_147;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_148;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_149;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_150;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_151;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_152;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty, empty> type_ffv_153;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_ffv_154;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_155;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_156;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_157;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_158;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_ffv_159;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_160;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_161;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_162;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_163;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_164;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_165;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_166;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_167;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_168;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_169;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_170;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_171;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_172;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_173;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_174;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_175;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_176;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_177;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_178;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_179;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_180;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_181;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_182;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_183;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_184;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_185;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_186;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_187;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_188;
+typedef std::tuple<std::vector<double>, double, double, fvar<fvar<var> >, empty, empty> type_ffv_189;
+typedef std::tuple<std::vector<double>, double, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_190;
+typedef std::tuple<std::vector<double>, double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_191;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_192;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_193;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_194;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_195;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_196;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_197;
+typedef std::tuple<std::vector<double>, double, fvar<fvar<var> >, double, empty, empty> type_ffv_198;
+typedef std::tuple<std::vector<double>, double, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_199;
+
+typedef std::tuple<AgradCdfParetoType2, type_ffv_100> AgradCdfParetoType2_ffv_100;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_101> AgradCdfParetoType2_ffv_101;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_102> AgradCdfParetoType2_ffv_102;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_103> AgradCdfParetoType2_ffv_103;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_104> AgradCdfParetoType2_ffv_104;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_105> AgradCdfParetoType2_ffv_105;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_106> AgradCdfParetoType2_ffv_106;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_107> AgradCdfParetoType2_ffv_107;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_108> AgradCdfParetoType2_ffv_108;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_109> AgradCdfParetoType2_ffv_109;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_110> AgradCdfParetoType2_ffv_110;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_111> AgradCdfParetoType2_ffv_111;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_112> AgradCdfParetoType2_ffv_112;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_113> AgradCdfParetoType2_ffv_113;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_114> AgradCdfParetoType2_ffv_114;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_115> AgradCdfParetoType2_ffv_115;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_116> AgradCdfParetoType2_ffv_116;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_117> AgradCdfParetoType2_ffv_117;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_118> AgradCdfParetoType2_ffv_118;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_119> AgradCdfParetoType2_ffv_119;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_120> AgradCdfParetoType2_ffv_120;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_121> AgradCdfParetoType2_ffv_121;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_122> AgradCdfParetoType2_ffv_122;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_123> AgradCdfParetoType2_ffv_123;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_124> AgradCdfParetoType2_ffv_124;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_125> AgradCdfParetoType2_ffv_125;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_126> AgradCdfParetoType2_ffv_126;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_127> AgradCdfParetoType2_ffv_127;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_128> AgradCdfParetoType2_ffv_128;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_129> AgradCdfParetoType2_ffv_129;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_130> AgradCdfParetoType2_ffv_130;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_131> AgradCdfParetoType2_ffv_131;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_132> AgradCdfParetoType2_ffv_132;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_133> AgradCdfParetoType2_ffv_133;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_134> AgradCdfParetoType2_ffv_134;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_135> AgradCdfParetoType2_ffv_135;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_136> AgradCdfParetoType2_ffv_136;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_137> AgradCdfParetoType2_ffv_137;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_138> AgradCdfParetoType2_ffv_138;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_139> AgradCdfParetoType2_ffv_139;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_140> AgradCdfParetoType2_ffv_140;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_141> AgradCdfParetoType2_ffv_141;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_142> AgradCdfParetoType2_ffv_142;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_143> AgradCdfParetoType2_ffv_143;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_144> AgradCdfParetoType2_ffv_144;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_145> AgradCdfParetoType2_ffv_145;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_146> AgradCdfParetoType2_ffv_146;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_147> AgradCdfParetoType2_ffv_147;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_148> AgradCdfParetoType2_ffv_148;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_149> AgradCdfParetoType2_ffv_149;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_150> AgradCdfParetoType2_ffv_150;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_151> AgradCdfParetoType2_ffv_151;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_152> AgradCdfParetoType2_ffv_152;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_153> AgradCdfParetoType2_ffv_153;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_154> AgradCdfParetoType2_ffv_154;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_155> AgradCdfParetoType2_ffv_155;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_156> AgradCdfParetoType2_ffv_156;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_157> AgradCdfParetoType2_ffv_157;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_158> AgradCdfParetoType2_ffv_158;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_159> AgradCdfParetoType2_ffv_159;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_160> AgradCdfParetoType2_ffv_160;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_161> AgradCdfParetoType2_ffv_161;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_162> AgradCdfParetoType2_ffv_162;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_163> AgradCdfParetoType2_ffv_163;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_164> AgradCdfParetoType2_ffv_164;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_165> AgradCdfParetoType2_ffv_165;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_166> AgradCdfParetoType2_ffv_166;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_167> AgradCdfParetoType2_ffv_167;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_168> AgradCdfParetoType2_ffv_168;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_169> AgradCdfParetoType2_ffv_169;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_170> AgradCdfParetoType2_ffv_170;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_171> AgradCdfParetoType2_ffv_171;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_172> AgradCdfParetoType2_ffv_172;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_173> AgradCdfParetoType2_ffv_173;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_174> AgradCdfParetoType2_ffv_174;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_175> AgradCdfParetoType2_ffv_175;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_176> AgradCdfParetoType2_ffv_176;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_177> AgradCdfParetoType2_ffv_177;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_178> AgradCdfParetoType2_ffv_178;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_179> AgradCdfParetoType2_ffv_179;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_180> AgradCdfParetoType2_ffv_180;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_181> AgradCdfParetoType2_ffv_181;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_182> AgradCdfParetoType2_ffv_182;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_183> AgradCdfParetoType2_ffv_183;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_184> AgradCdfParetoType2_ffv_184;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_185> AgradCdfParetoType2_ffv_185;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_186> AgradCdfParetoType2_ffv_186;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_187> AgradCdfParetoType2_ffv_187;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_188> AgradCdfParetoType2_ffv_188;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_189> AgradCdfParetoType2_ffv_189;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_190> AgradCdfParetoType2_ffv_190;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_191> AgradCdfParetoType2_ffv_191;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_192> AgradCdfParetoType2_ffv_192;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_193> AgradCdfParetoType2_ffv_193;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_194> AgradCdfParetoType2_ffv_194;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_195> AgradCdfParetoType2_ffv_195;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_196> AgradCdfParetoType2_ffv_196;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_197> AgradCdfParetoType2_ffv_197;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_198> AgradCdfParetoType2_ffv_198;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_199> AgradCdfParetoType2_ffv_199;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_100, AgradCdfTestFixture, AgradCdfParetoType2_ffv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_101, AgradCdfTestFixture, AgradCdfParetoType2_ffv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_102, AgradCdfTestFixture, AgradCdfParetoType2_ffv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_103, AgradCdfTestFixture, AgradCdfParetoType2_ffv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_104, AgradCdfTestFixture, AgradCdfParetoType2_ffv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_105, AgradCdfTestFixture, AgradCdfParetoType2_ffv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_106, AgradCdfTestFixture, AgradCdfParetoType2_ffv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_107, AgradCdfTestFixture, AgradCdfParetoType2_ffv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_108, AgradCdfTestFixture, AgradCdfParetoType2_ffv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_109, AgradCdfTestFixture, AgradCdfParetoType2_ffv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_110, AgradCdfTestFixture, AgradCdfParetoType2_ffv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_111, AgradCdfTestFixture, AgradCdfParetoType2_ffv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_112, AgradCdfTestFixture, AgradCdfParetoType2_ffv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_113, AgradCdfTestFixture, AgradCdfParetoType2_ffv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_114, AgradCdfTestFixture, AgradCdfParetoType2_ffv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_115, AgradCdfTestFixture, AgradCdfParetoType2_ffv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_116, AgradCdfTestFixture, AgradCdfParetoType2_ffv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_117, AgradCdfTestFixture, AgradCdfParetoType2_ffv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_118, AgradCdfTestFixture, AgradCdfParetoType2_ffv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_119, AgradCdfTestFixture, AgradCdfParetoType2_ffv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_120, AgradCdfTestFixture, AgradCdfParetoType2_ffv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_121, AgradCdfTestFixture, AgradCdfParetoType2_ffv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_122, AgradCdfTestFixture, AgradCdfParetoType2_ffv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_123, AgradCdfTestFixture, AgradCdfParetoType2_ffv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_124, AgradCdfTestFixture, AgradCdfParetoType2_ffv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_125, AgradCdfTestFixture, AgradCdfParetoType2_ffv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_126, AgradCdfTestFixture, AgradCdfParetoType2_ffv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_127, AgradCdfTestFixture, AgradCdfParetoType2_ffv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_128, AgradCdfTestFixture, AgradCdfParetoType2_ffv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_129, AgradCdfTestFixture, AgradCdfParetoType2_ffv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_130, AgradCdfTestFixture, AgradCdfParetoType2_ffv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_131, AgradCdfTestFixture, AgradCdfParetoType2_ffv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_132, AgradCdfTestFixture, AgradCdfParetoType2_ffv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_133, AgradCdfTestFixture, AgradCdfParetoType2_ffv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_134, AgradCdfTestFixture, AgradCdfParetoType2_ffv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_135, AgradCdfTestFixture, AgradCdfParetoType2_ffv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_136, AgradCdfTestFixture, AgradCdfParetoType2_ffv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_137, AgradCdfTestFixture, AgradCdfParetoType2_ffv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_138, AgradCdfTestFixture, AgradCdfParetoType2_ffv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_139, AgradCdfTestFixture, AgradCdfParetoType2_ffv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_140, AgradCdfTestFixture, AgradCdfParetoType2_ffv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_141, AgradCdfTestFixture, AgradCdfParetoType2_ffv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_142, AgradCdfTestFixture, AgradCdfParetoType2_ffv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_143, AgradCdfTestFixture, AgradCdfParetoType2_ffv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_144, AgradCdfTestFixture, AgradCdfParetoType2_ffv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_145, AgradCdfTestFixture, AgradCdfParetoType2_ffv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_146, AgradCdfTestFixture, AgradCdfParetoType2_ffv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_147, AgradCdfTestFixture, AgradCdfParetoType2_ffv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_148, AgradCdfTestFixture, AgradCdfParetoType2_ffv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_149, AgradCdfTestFixture, AgradCdfParetoType2_ffv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_150, AgradCdfTestFixture, AgradCdfParetoType2_ffv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_151, AgradCdfTestFixture, AgradCdfParetoType2_ffv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_152, AgradCdfTestFixture, AgradCdfParetoType2_ffv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_153, AgradCdfTestFixture, AgradCdfParetoType2_ffv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_154, AgradCdfTestFixture, AgradCdfParetoType2_ffv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_155, AgradCdfTestFixture, AgradCdfParetoType2_ffv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_156, AgradCdfTestFixture, AgradCdfParetoType2_ffv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_157, AgradCdfTestFixture, AgradCdfParetoType2_ffv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_158, AgradCdfTestFixture, AgradCdfParetoType2_ffv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_159, AgradCdfTestFixture, AgradCdfParetoType2_ffv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_160, AgradCdfTestFixture, AgradCdfParetoType2_ffv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_161, AgradCdfTestFixture, AgradCdfParetoType2_ffv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_162, AgradCdfTestFixture, AgradCdfParetoType2_ffv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_163, AgradCdfTestFixture, AgradCdfParetoType2_ffv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_164, AgradCdfTestFixture, AgradCdfParetoType2_ffv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_165, AgradCdfTestFixture, AgradCdfParetoType2_ffv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_166, AgradCdfTestFixture, AgradCdfParetoType2_ffv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_167, AgradCdfTestFixture, AgradCdfParetoType2_ffv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_168, AgradCdfTestFixture, AgradCdfParetoType2_ffv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_169, AgradCdfTestFixture, AgradCdfParetoType2_ffv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_170, AgradCdfTestFixture, AgradCdfParetoType2_ffv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_171, AgradCdfTestFixture, AgradCdfParetoType2_ffv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_172, AgradCdfTestFixture, AgradCdfParetoType2_ffv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_173, AgradCdfTestFixture, AgradCdfParetoType2_ffv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_174, AgradCdfTestFixture, AgradCdfParetoType2_ffv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_175, AgradCdfTestFixture, AgradCdfParetoType2_ffv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_176, AgradCdfTestFixture, AgradCdfParetoType2_ffv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_177, AgradCdfTestFixture, AgradCdfParetoType2_ffv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_178, AgradCdfTestFixture, AgradCdfParetoType2_ffv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_179, AgradCdfTestFixture, AgradCdfParetoType2_ffv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_180, AgradCdfTestFixture, AgradCdfParetoType2_ffv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_181, AgradCdfTestFixture, AgradCdfParetoType2_ffv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_182, AgradCdfTestFixture, AgradCdfParetoType2_ffv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_183, AgradCdfTestFixture, AgradCdfParetoType2_ffv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_184, AgradCdfTestFixture, AgradCdfParetoType2_ffv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_185, AgradCdfTestFixture, AgradCdfParetoType2_ffv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_186, AgradCdfTestFixture, AgradCdfParetoType2_ffv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_187, AgradCdfTestFixture, AgradCdfParetoType2_ffv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_188, AgradCdfTestFixture, AgradCdfParetoType2_ffv_188);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_189, AgradCdfTestFixture, AgradCdfParetoType2_ffv_189);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_190, AgradCdfTestFixture, AgradCdfParetoType2_ffv_190);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_191, AgradCdfTestFixture, AgradCdfParetoType2_ffv_191);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_192, AgradCdfTestFixture, AgradCdfParetoType2_ffv_192);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_193, AgradCdfTestFixture, AgradCdfParetoType2_ffv_193);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_194, AgradCdfTestFixture, AgradCdfParetoType2_ffv_194);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_195, AgradCdfTestFixture, AgradCdfParetoType2_ffv_195);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_196, AgradCdfTestFixture, AgradCdfParetoType2_ffv_196);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_197, AgradCdfTestFixture, AgradCdfParetoType2_ffv_197);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_198, AgradCdfTestFixture, AgradCdfParetoType2_ffv_198);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_199, AgradCdfTestFixture, AgradCdfParetoType2_ffv_199);
+
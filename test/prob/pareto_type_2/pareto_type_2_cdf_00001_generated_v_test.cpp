@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_cdf_test.hpp>
+
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_100;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_101;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_102;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_103;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_104;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_105;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_106;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_107;
+typedef std::tuple<double, var, double, double, empty, empty> type_v_108;
+typedef std::tuple<double, var, double, std::vector<double>, empty, empty> type_v_109;
+typedef std::tuple<double, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_110;
+typedef std::tuple<double, var, double, var, empty, empty> type_v_111;
+typedef std::tuple<double, var, double, std::vector<var>, empty, empty> type_v_112;
+typedef std::tuple<double, var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_113;
+typedef std::tuple<double, var, std::vector<double>, double, empty, empty> type_v_114;
+typedef std::tuple<double, var, std::vector<double>, std::vector<double>, empty, empty> type_v_115;
+typedef std::tuple<double, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_116;
+typedef std::tuple<double, var, std::vector<double>, var, empty, empty> type_v_117;
+typedef std::tuple<double, var, std::vector<double>, std::vector<var>, empty, empty> type_v_118;
+typedef std::tuple<double, var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_119;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_120;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_121;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_122;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_123;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_124;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_125;
+typedef std::tuple<double, var, var, double, empty, empty> type_v_126;
+typedef std::tuple<double, var, var, std::vector<double>, empty, empty> type_v_127;
+typedef std::tuple<double, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_128;
+typedef std::tuple<double, var, var, var, empty, empty> type_v_129;
+typedef std::tuple<double, var, var, std::vector<var>, empty, empty> type_v_130;
+typedef std::tuple<double, var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_131;
+typedef std::tuple<double, var, std::vector<var>, double, empty, empty> type_v_132;
+typedef std::tuple<double, var, std::vector<var>, std::vector<double>, empty, empty> type_v_133;
+typedef std::tuple<double, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_134;
+typedef std::tuple<double, var, std::vector<var>, var, empty, empty> type_v_135;
+typedef std::tuple<double, var, std::vector<var>, std::vector<var>, empty, empty> type_v_136;
+typedef std::tuple<double, var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_137;
+typedef std::tuple<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_138;
+typedef std::tuple<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_139;
+typedef std::tuple<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_140;
+typedef std::tuple<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_141;
+typedef std::tuple<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_142;
+typedef std::tuple<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_143;
+typedef std::tuple<double, std::vector<var>, double, double, empty, empty> type_v_144;
+typedef std::tuple<double, std::vector<var>, double, std::vector<double>, empty, empty> type_v_145;
+typedef std::tuple<double, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_146;
+typedef std::tuple<double, std::vector<var>, double, var, empty, empty> type_v_147;
+typedef std::tuple<double, std::vector<var>, double, std::vector<var>, empty, empty> type_v_148;
+typedef std::tuple<double, std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_149;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, double, empty, empty> type_v_150;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_v_151;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_152;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, var, empty, empty> type_v_153;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_v_154;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_155;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_156;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_157;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_158;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_159;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_160;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_161;
+typedef std::tuple<double, std::vector<var>, var, double, empty, empty> type_v_162;
+typedef std::tuple<double, std::vector<var>, var, std::vector<double>, empty, empty> type_v_163;
+typedef std::tuple<double, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_164;
+typedef std::tuple<double, std::vector<var>, var, var, empty, empty> type_v_165;
+typedef std::tuple<double, std::vector<var>, var, std::vector<var>, empty, empty> type_v_166;
+typedef std::tuple<double, std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_167;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, double, empty, empty> type_v_168;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_v_169;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_170;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, var, empty, empty> type_v_171;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_v_172;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_173;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_174;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_175;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_176;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_177;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_178;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_179;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_180;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_181;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_182;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_183;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_184;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_185;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_186;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_187;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_188;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_189;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_190;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_191;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_192;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_193;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_194;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_195;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_196;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_197;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_198;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_199;
+
+typedef std::tuple<AgradCdfParetoType2, type_v_100> AgradCdfParetoType2_v_100;
+typedef std::tuple<AgradCdfParetoType2, type_v_101> AgradCdfParetoType2_v_101;
+typedef std::tuple<AgradCdfParetoType2, type_v_102> AgradCdfParetoType2_v_102;
+typedef std::tuple<AgradCdfParetoType2, type_v_103> AgradCdfParetoType2_v_103;
+typedef std::tuple<AgradCdfParetoType2, type_v_104> AgradCdfParetoType2_v_104;
+typedef std::tuple<AgradCdfParetoType2, type_v_105> AgradCdfParetoType2_v_105;
+typedef std::tuple<AgradCdfParetoType2, type_v_106> AgradCdfParetoType2_v_106;
+typedef std::tuple<AgradCdfParetoType2, type_v_107> AgradCdfParetoType2_v_107;
+typedef std::tuple<AgradCdfParetoType2, type_v_108> AgradCdfParetoType2_v_108;
+typedef std::tuple<AgradCdfParetoType2, type_v_109> AgradCdfParetoType2_v_109;
+typedef std::tuple<AgradCdfParetoType2, type_v_110> AgradCdfParetoType2_v_110;
+typedef std::tuple<AgradCdfParetoType2, type_v_111> AgradCdfParetoType2_v_111;
+typedef std::tuple<AgradCdfParetoType2, type_v_112> AgradCdfParetoType2_v_112;
+typedef std::tuple<AgradCdfParetoType2, type_v_113> AgradCdfParetoType2_v_113;
+typedef std::tuple<AgradCdfParetoType2, type_v_114> AgradCdfParetoType2_v_114;
+typedef std::tuple<AgradCdfParetoType2, type_v_115> AgradCdfParetoType2_v_115;
+typedef std::tuple<AgradCdfParetoType2, type_v_116> AgradCdfParetoType2_v_116;
+typedef std::tuple<AgradCdfParetoType2, type_v_117> AgradCdfParetoType2_v_117;
+typedef std::tuple<AgradCdfParetoType2, type_v_118> AgradCdfParetoType2_v_118;
+typedef std::tuple<AgradCdfParetoType2, type_v_119> AgradCdfParetoType2_v_119;
+typedef std::tuple<AgradCdfParetoType2, type_v_120> AgradCdfParetoType2_v_120;
+typedef std::tuple<AgradCdfParetoType2, type_v_121> AgradCdfParetoType2_v_121;
+typedef std::tuple<AgradCdfParetoType2, type_v_122> AgradCdfParetoType2_v_122;
+typedef std::tuple<AgradCdfParetoType2, type_v_123> AgradCdfParetoType2_v_123;
+typedef std::tuple<AgradCdfParetoType2, type_v_124> AgradCdfParetoType2_v_124;
+typedef std::tuple<AgradCdfParetoType2, type_v_125> AgradCdfParetoType2_v_125;
+typedef std::tuple<AgradCdfParetoType2, type_v_126> AgradCdfParetoType2_v_126;
+typedef std::tuple<AgradCdfParetoType2, type_v_127> AgradCdfParetoType2_v_127;
+typedef std::tuple<AgradCdfParetoType2, type_v_128> AgradCdfParetoType2_v_128;
+typedef std::tuple<AgradCdfParetoType2, type_v_129> AgradCdfParetoType2_v_129;
+typedef std::tuple<AgradCdfParetoType2, type_v_130> AgradCdfParetoType2_v_130;
+typedef std::tuple<AgradCdfParetoType2, type_v_131> AgradCdfParetoType2_v_131;
+typedef std::tuple<AgradCdfParetoType2, type_v_132> AgradCdfParetoType2_v_132;
+typedef std::tuple<AgradCdfParetoType2, type_v_133> AgradCdfParetoType2_v_133;
+typedef std::tuple<AgradCdfParetoType2, type_v_134> AgradCdfParetoType2_v_134;
+typedef std::tuple<AgradCdfParetoType2, type_v_135> AgradCdfParetoType2_v_135;
+typedef std::tuple<AgradCdfParetoType2, type_v_136> AgradCdfParetoType2_v_136;
+typedef std::tuple<AgradCdfParetoType2, type_v_137> AgradCdfParetoType2_v_137;
+typedef std::tuple<AgradCdfParetoType2, type_v_138> AgradCdfParetoType2_v_138;
+typedef std::tuple<AgradCdfParetoType2, type_v_139> AgradCdfParetoType2_v_139;
+typedef std::tuple<AgradCdfParetoType2, type_v_140> AgradCdfParetoType2_v_140;
+typedef std::tuple<AgradCdfParetoType2, type_v_141> AgradCdfParetoType2_v_141;
+typedef std::tuple<AgradCdfParetoType2, type_v_142> AgradCdfParetoType2_v_142;
+typedef std::tuple<AgradCdfParetoType2, type_v_143> AgradCdfParetoType2_v_143;
+typedef std::tuple<AgradCdfParetoType2, type_v_144> AgradCdfParetoType2_v_144;
+typedef std::tuple<AgradCdfParetoType2, type_v_145> AgradCdfParetoType2_v_145;
+typedef std::tuple<AgradCdfParetoType2, type_v_146> AgradCdfParetoType2_v_146;
+typedef std::tuple<AgradCdfParetoType2, type_v_147> AgradCdfParetoType2_v_147;
+typedef std::tuple<AgradCdfParetoType2, type_v_148> AgradCdfParetoType2_v_148;
+typedef std::tuple<AgradCdfParetoType2, type_v_149> AgradCdfParetoType2_v_149;
+typedef std::tuple<AgradCdfParetoType2, type_v_150> AgradCdfParetoType2_v_150;
+typedef std::tuple<AgradCdfParetoType2, type_v_151> AgradCdfParetoType2_v_151;
+typedef std::tuple<AgradCdfParetoType2, type_v_152> AgradCdfParetoType2_v_152;
+typedef std::tuple<AgradCdfParetoType2, type_v_153> AgradCdfParetoType2_v_153;
+typedef std::tuple<AgradCdfParetoType2, type_v_154> AgradCdfParetoType2_v_154;
+typedef std::tuple<AgradCdfParetoType2, type_v_155> AgradCdfParetoType2_v_155;
+typedef std::tuple<AgradCdfParetoType2, type_v_156> AgradCdfParetoType2_v_156;
+typedef std::tuple<AgradCdfParetoType2, type_v_157> AgradCdfParetoType2_v_157;
+typedef std::tuple<AgradCdfParetoType2, type_v_158> AgradCdfParetoType2_v_158;
+typedef std::tuple<AgradCdfParetoType2, type_v_159> AgradCdfParetoType2_v_159;
+typedef std::tuple<AgradCdfParetoType2, type_v_160> AgradCdfParetoType2_v_160;
+typedef std::tuple<AgradCdfParetoType2, type_v_161> AgradCdfParetoType2_v_161;
+typedef std::tuple<AgradCdfParetoType2, type_v_162> AgradCdfParetoType2_v_162;
+typedef std::tuple<AgradCdfParetoType2, type_v_163> AgradCdfParetoType2_v_163;
+typedef std::tuple<AgradCdfParetoType2, type_v_164> AgradCdfParetoType2_v_164;
+typedef std::tuple<AgradCdfParetoType2, type_v_165> AgradCdfParetoType2_v_165;
+typedef std::tuple<AgradCdfParetoType2, type_v_166> AgradCdfParetoType2_v_166;
+typedef std::tuple<AgradCdfParetoType2, type_v_167> AgradCdfParetoType2_v_167;
+typedef std::tuple<AgradCdfParetoType2, type_v_168> AgradCdfParetoType2_v_168;
+typedef std::tuple<AgradCdfParetoType2, type_v_169> AgradCdfParetoType2_v_169;
+typedef std::tuple<AgradCdfParetoType2, type_v_170> AgradCdfParetoType2_v_170;
+typedef std::tuple<AgradCdfParetoType2, type_v_171> AgradCdfParetoType2_v_171;
+typedef std::tuple<AgradCdfParetoType2, type_v_172> AgradCdfParetoType2_v_172;
+typedef std::tuple<AgradCdfParetoType2, type_v_173> AgradCdfParetoType2_v_173;
+typedef std::tuple<AgradCdfParetoType2, type_v_174> AgradCdfParetoType2_v_174;
+typedef std::tuple<AgradCdfParetoType2, type_v_175> AgradCdfParetoType2_v_175;
+typedef std::tuple<AgradCdfParetoType2, type_v_176> AgradCdfParetoType2_v_176;
+typedef std::tuple<AgradCdfParetoType2, type_v_177> AgradCdfParetoType2_v_177;
+typedef std::tuple<AgradCdfParetoType2, type_v_178> AgradCdfParetoType2_v_178;
+typedef std::tuple<AgradCdfParetoType2, type_v_179> AgradCdfParetoType2_v_179;
+typedef std::tuple<AgradCdfParetoType2, type_v_180> AgradCdfParetoType2_v_180;
+typedef std::tuple<AgradCdfParetoType2, type_v_181> AgradCdfParetoType2_v_181;
+typedef std::tuple<AgradCdfParetoType2, type_v_182> AgradCdfParetoType2_v_182;
+typedef std::tuple<AgradCdfParetoType2, type_v_183> AgradCdfParetoType2_v_183;
+typedef std::tuple<AgradCdfParetoType2, type_v_184> AgradCdfParetoType2_v_184;
+typedef std::tuple<AgradCdfParetoType2, type_v_185> AgradCdfParetoType2_v_185;
+typedef std::tuple<AgradCdfParetoType2, type_v_186> AgradCdfParetoType2_v_186;
+typedef std::tuple<AgradCdfParetoType2, type_v_187> AgradCdfParetoType2_v_187;
+typedef std::tuple<AgradCdfParetoType2, type_v_188> AgradCdfParetoType2_v_188;
+typedef std::tuple<AgradCdfParetoType2, type_v_189> AgradCdfParetoType2_v_189;
+typedef std::tuple<AgradCdfParetoType2, type_v_190> AgradCdfParetoType2_v_190;
+typedef std::tuple<AgradCdfParetoType2, type_v_191> AgradCdfParetoType2_v_191;
+typedef std::tuple<AgradCdfParetoType2, type_v_192> AgradCdfParetoType2_v_192;
+typedef std::tuple<AgradCdfParetoType2, type_v_193> AgradCdfParetoType2_v_193;
+typedef std::tuple<AgradCdfParetoType2, type_v_194> AgradCdfParetoType2_v_194;
+typedef std::tuple<AgradCdfParetoType2, type_v_195> AgradCdfParetoType2_v_195;
+typedef std::tuple<AgradCdfParetoType2, type_v_196> AgradCdfParetoType2_v_196;
+typedef std::tuple<AgradCdfParetoType2, type_v_197> AgradCdfParetoType2_v_197;
+typedef std::tuple<AgradCdfParetoType2, type_v_198> AgradCdfParetoType2_v_198;
+typedef std::tuple<AgradCdfParetoType2, type_v_199> AgradCdfParetoType2_v_199;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_100, AgradCdfTestFixture, AgradCdfParetoType2_v_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_101, AgradCdfTestFixture, AgradCdfParetoType2_v_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_102, AgradCdfTestFixture, AgradCdfParetoType2_v_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_103, AgradCdfTestFixture, AgradCdfParetoType2_v_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_104, AgradCdfTestFixture, AgradCdfParetoType2_v_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_105, AgradCdfTestFixture, AgradCdfParetoType2_v_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_106, AgradCdfTestFixture, AgradCdfParetoType2_v_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_107, AgradCdfTestFixture, AgradCdfParetoType2_v_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_108, AgradCdfTestFixture, AgradCdfParetoType2_v_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_109, AgradCdfTestFixture, AgradCdfParetoType2_v_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_110, AgradCdfTestFixture, AgradCdfParetoType2_v_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_111, AgradCdfTestFixture, AgradCdfParetoType2_v_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_112, AgradCdfTestFixture, AgradCdfParetoType2_v_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_113, AgradCdfTestFixture, AgradCdfParetoType2_v_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_114, AgradCdfTestFixture, AgradCdfParetoType2_v_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_115, AgradCdfTestFixture, AgradCdfParetoType2_v_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_116, AgradCdfTestFixture, AgradCdfParetoType2_v_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_117, AgradCdfTestFixture, AgradCdfParetoType2_v_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_118, AgradCdfTestFixture, AgradCdfParetoType2_v_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_119, AgradCdfTestFixture, AgradCdfParetoType2_v_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_120, AgradCdfTestFixture, AgradCdfParetoType2_v_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_121, AgradCdfTestFixture, AgradCdfParetoType2_v_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_122, AgradCdfTestFixture, AgradCdfParetoType2_v_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_123, AgradCdfTestFixture, AgradCdfParetoType2_v_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_124, AgradCdfTestFixture, AgradCdfParetoType2_v_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_125, AgradCdfTestFixture, AgradCdfParetoType2_v_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_126, AgradCdfTestFixture, AgradCdfParetoType2_v_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_127, AgradCdfTestFixture, AgradCdfParetoType2_v_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_128, AgradCdfTestFixture, AgradCdfParetoType2_v_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_129, AgradCdfTestFixture, AgradCdfParetoType2_v_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_130, AgradCdfTestFixture, AgradCdfParetoType2_v_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_131, AgradCdfTestFixture, AgradCdfParetoType2_v_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_132, AgradCdfTestFixture, AgradCdfParetoType2_v_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_133, AgradCdfTestFixture, AgradCdfParetoType2_v_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_134, AgradCdfTestFixture, AgradCdfParetoType2_v_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_135, AgradCdfTestFixture, AgradCdfParetoType2_v_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_136, AgradCdfTestFixture, AgradCdfParetoType2_v_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_137, AgradCdfTestFixture, AgradCdfParetoType2_v_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_138, AgradCdfTestFixture, AgradCdfParetoType2_v_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_139, AgradCdfTestFixture, AgradCdfParetoType2_v_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_140, AgradCdfTestFixture, AgradCdfParetoType2_v_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_141, AgradCdfTestFixture, AgradCdfParetoType2_v_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_142, AgradCdfTestFixture, AgradCdfParetoType2_v_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_143, AgradCdfTestFixture, AgradCdfParetoType2_v_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_144, AgradCdfTestFixture, AgradCdfParetoType2_v_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_145, AgradCdfTestFixture, AgradCdfParetoType2_v_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_146, AgradCdfTestFixture, AgradCdfParetoType2_v_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_147, AgradCdfTestFixture, AgradCdfParetoType2_v_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_148, AgradCdfTestFixture, AgradCdfParetoType2_v_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_149, AgradCdfTestFixture, AgradCdfParetoType2_v_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_150, AgradCdfTestFixture, AgradCdfParetoType2_v_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_151, AgradCdfTestFixture, AgradCdfParetoType2_v_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_152, AgradCdfTestFixture, AgradCdfParetoType2_v_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_153, AgradCdfTestFixture, AgradCdfParetoType2_v_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_154, AgradCdfTestFixture, AgradCdfParetoType2_v_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_155, AgradCdfTestFixture, AgradCdfParetoType2_v_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_156, AgradCdfTestFixture, AgradCdfParetoType2_v_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_157, AgradCdfTestFixture, AgradCdfParetoType2_v_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_158, AgradCdfTestFixture, AgradCdfParetoType2_v_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_159, AgradCdfTestFixture, AgradCdfParetoType2_v_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_160, AgradCdfTestFixture, AgradCdfParetoType2_v_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_161, AgradCdfTestFixture, AgradCdfParetoType2_v_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_162, AgradCdfTestFixture, AgradCdfParetoType2_v_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_163, AgradCdfTestFixture, AgradCdfParetoType2_v_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_164, AgradCdfTestFixture, AgradCdfParetoType2_v_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_165, AgradCdfTestFixture, AgradCdfParetoType2_v_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_166, AgradCdfTestFixture, AgradCdfParetoType2_v_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_167, AgradCdfTestFixture, AgradCdfParetoType2_v_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_168, AgradCdfTestFixture, AgradCdfParetoType2_v_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_169, AgradCdfTestFixture, AgradCdfParetoType2_v_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_170, AgradCdfTestFixture, AgradCdfParetoType2_v_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_171, AgradCdfTestFixture, AgradCdfParetoType2_v_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_172, AgradCdfTestFixture, AgradCdfParetoType2_v_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_173, AgradCdfTestFixture, AgradCdfParetoType2_v_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_174, AgradCdfTestFixture, AgradCdfParetoType2_v_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_175, AgradCdfTestFixture, AgradCdfParetoType2_v_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_176, AgradCdfTestFixture, AgradCdfParetoType2_v_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_177, AgradCdfTestFixture, AgradCdfParetoType2_v_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_178, AgradCdfTestFixture, AgradCdfParetoType2_v_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_179, AgradCdfTestFixture, AgradCdfParetoType2_v_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_180, AgradCdfTestFixture, AgradCdfParetoType2_v_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_181, AgradCdfTestFixture, AgradCdfParetoType2_v_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_182, AgradCdfTestFixture, AgradCdfParetoType2_v_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_183, AgradCdfTestFixture, AgradCdfParetoType2_v_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_184, AgradCdfTestFixture, AgradCdfParetoType2_v_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_185, AgradCdfTestFixture, AgradCdfParetoType2_v_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_186, AgradCdfTestFixture, AgradCdfParetoType2_v_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_187, AgradCdfTestFixture, AgradCdfParetoType2_v_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_188, AgradCdfTestFixture, AgradCdfParetoType2_v_188);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_189, AgradCdfTestFixture, AgradCdfParetoType2_v_189);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_190, AgradCdfTestFixture, AgradCdfParetoType2_v_190);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_191, AgradCdfTestFixture, AgradCdfParetoType2_v_191);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_192, AgradCdfTestFixture, AgradCdfParetoType2_v_192);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_193, AgradCdfTestFixture, AgradCdfParetoType2_v_193);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_194, AgradCdfTestFixture, AgradCdfParetoType2_v_194);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_195, AgradCdfTestFixture, AgradCdfParetoType2_v_195);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_196, AgradCdfTestFixture, AgradCdfParetoType2_v_196);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_197, AgradCdfTestFixture, AgradCdfParetoType2_v_197);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_198, AgradCdfTestFixture, AgradCdfParetoType2_v_198);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_199, AgradCdfTestFixture, AgradCdfParetoType2_v_199);
+
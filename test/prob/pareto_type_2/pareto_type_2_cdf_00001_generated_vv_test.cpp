@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_cdf_test.hpp>
+
+typedef std::tuple<double, var, var, std::vector<double>, empty, empty> type_vv_100;
+typedef std::tuple<double, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_101;
+typedef std::tuple<double, var, var, var, empty, empty> type_vv_102;
+typedef std::tuple<double, var, var, std::vector<var>, empty, empty> type_vv_103;
+typedef std::tuple<double, var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_104;
+typedef std::tuple<double, var, std::vector<var>, double, empty, empty> type_vv_105;
+typedef std::tuple<double, var, std::vector<var>, std::vector<double>, empty, empty> type_vv_106;
+typedef std::tuple<double, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_107;
+typedef std::tuple<double, var, std::vector<var>, var, empty, empty> type_vv_108;
+typedef std::tuple<double, var, std::vector<var>, std::vector<var>, empty, empty> type_vv_109;
+typedef std::tuple<double, var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_110;
+typedef std::tuple<double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_111;
+typedef std::tuple<double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_112;
+typedef std::tuple<double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_113;
+typedef std::tuple<double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_114;
+typedef std::tuple<double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_115;
+typedef std::tuple<double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_116;
+typedef std::tuple<double, std::vector<var>, double, double, empty, empty> type_vv_117;
+typedef std::tuple<double, std::vector<var>, double, std::vector<double>, empty, empty> type_vv_118;
+typedef std::tuple<double, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_119;
+typedef std::tuple<double, std::vector<var>, double, var, empty, empty> type_vv_120;
+typedef std::tuple<double, std::vector<var>, double, std::vector<var>, empty, empty> type_vv_121;
+typedef std::tuple<double, std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_122;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, double, empty, empty> type_vv_123;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_vv_124;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_125;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, var, empty, empty> type_vv_126;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_vv_127;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_128;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_129;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_130;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_131;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_132;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_133;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_134;
+typedef std::tuple<double, std::vector<var>, var, double, empty, empty> type_vv_135;
+typedef std::tuple<double, std::vector<var>, var, std::vector<double>, empty, empty> type_vv_136;
+typedef std::tuple<double, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_137;
+typedef std::tuple<double, std::vector<var>, var, var, empty, empty> type_vv_138;
+typedef std::tuple<double, std::vector<var>, var, std::vector<var>, empty, empty> type_vv_139;
+typedef std::tuple<double, std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_140;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, double, empty, empty> type_vv_141;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_vv_142;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_143;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, var, empty, empty> type_vv_144;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_vv_145;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_146;
+typedef std::tuple<double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_147;
+typedef std::tuple<double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_148;
+typedef std::tuple<double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_149;
+typedef std::tuple<double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_150;
+typedef std::tuple<double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_151;
+typedef std::tuple<double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_152;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, empty, empty> type_vv_153;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, empty, empty> type_vv_154;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_155;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, empty, empty> type_vv_156;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, empty, empty> type_vv_157;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_158;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, empty, empty> type_vv_159;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, empty, empty> type_vv_160;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_161;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, empty, empty> type_vv_162;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, empty, empty> type_vv_163;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_164;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_165;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_166;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_167;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_168;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_169;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_170;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, empty, empty> type_vv_171;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, empty, empty> type_vv_172;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_173;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, empty, empty> type_vv_174;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, empty, empty> type_vv_175;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_176;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, empty, empty> type_vv_177;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, empty, empty> type_vv_178;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_179;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, empty, empty> type_vv_180;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, empty, empty> type_vv_181;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_182;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_183;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_184;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_185;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_186;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_187;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_188;
+typedef std::tuple<std::vector<double>, double, double, var, empty, empty> type_vv_189;
+typedef std::tuple<std::vector<double>, double, double, std::vector<var>, empty, empty> type_vv_190;
+typedef std::tuple<std::vector<double>, double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_191;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, var, empty, empty> type_vv_192;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, std::vector<var>, empty, empty> type_vv_193;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_194;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_195;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_196;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_197;
+typedef std::tuple<std::vector<double>, double, var, double, empty, empty> type_vv_198;
+typedef std::tuple<std::vector<double>, double, var, std::vector<double>, empty, empty> type_vv_199;
+
+typedef std::tuple<AgradCdfParetoType2, type_vv_100> AgradCdfParetoType2_vv_100;
+typedef std::tuple<AgradCdfParetoType2, type_vv_101> AgradCdfParetoType2_vv_101;
+typedef std::tuple<AgradCdfParetoType2, type_vv_102> AgradCdfParetoType2_vv_102;
+typedef std::tuple<AgradCdfParetoType2, type_vv_103> AgradCdfParetoType2_vv_103;
+typedef std::tuple<AgradCdfParetoType2, type_vv_104> AgradCdfParetoType2_vv_104;
+typedef std::tuple<AgradCdfParetoType2, type_vv_105> AgradCdfParetoType2_vv_105;
+typedef std::tuple<AgradCdfParetoType2, type_vv_106> AgradCdfParetoType2_vv_106;
+typedef std::tuple<AgradCdfParetoType2, type_vv_107> AgradCdfParetoType2_vv_107;
+typedef std::tuple<AgradCdfParetoType2, type_vv_108> AgradCdfParetoType2_vv_108;
+typedef std::tuple<AgradCdfParetoType2, type_vv_109> AgradCdfParetoType2_vv_109;
+typedef std::tuple<AgradCdfParetoType2, type_vv_110> AgradCdfParetoType2_vv_110;
+typedef std::tuple<AgradCdfParetoType2, type_vv_111> AgradCdfParetoType2_vv_111;
+typedef std::tuple<AgradCdfParetoType2, type_vv_112> AgradCdfParetoType2_vv_112;
+typedef std::tuple<AgradCdfParetoType2, type_vv_113> AgradCdfParetoType2_vv_113;
+typedef std::tuple<AgradCdfParetoType2, type_vv_114> AgradCdfParetoType2_vv_114;
+typedef std::tuple<AgradCdfParetoType2, type_vv_115> AgradCdfParetoType2_vv_115;
+typedef std::tuple<AgradCdfParetoType2, type_vv_116> AgradCdfParetoType2_vv_116;
+typedef std::tuple<AgradCdfParetoType2, type_vv_117> AgradCdfParetoType2_vv_117;
+typedef std::tuple<AgradCdfParetoType2, type_vv_118> AgradCdfParetoType2_vv_118;
+typedef std::tuple<AgradCdfParetoType2, type_vv_119> AgradCdfParetoType2_vv_119;
+typedef std::tuple<AgradCdfParetoType2, type_vv_120> AgradCdfParetoType2_vv_120;
+typedef std::tuple<AgradCdfParetoType2, type_vv_121> AgradCdfParetoType2_vv_121;
+typedef std::tuple<AgradCdfParetoType2, type_vv_122> AgradCdfParetoType2_vv_122;
+typedef std::tuple<AgradCdfParetoType2, type_vv_123> AgradCdfParetoType2_vv_123;
+typedef std::tuple<AgradCdfParetoType2, type_vv_124> AgradCdfParetoType2_vv_124;
+typedef std::tuple<AgradCdfParetoType2, type_vv_125> AgradCdfParetoType2_vv_125;
+typedef std::tuple<AgradCdfParetoType2, type_vv_126> AgradCdfParetoType2_vv_126;
+typedef std::tuple<AgradCdfParetoType2, type_vv_127> AgradCdfParetoType2_vv_127;
+typedef std::tuple<AgradCdfParetoType2, type_vv_128> AgradCdfParetoType2_vv_128;
+typedef std::tuple<AgradCdfParetoType2, type_vv_129> AgradCdfParetoType2_vv_129;
+typedef std::tuple<AgradCdfParetoType2, type_vv_130> AgradCdfParetoType2_vv_130;
+typedef std::tuple<AgradCdfParetoType2, type_vv_131> AgradCdfParetoType2_vv_131;
+typedef std::tuple<AgradCdfParetoType2, type_vv_132> AgradCdfParetoType2_vv_132;
+typedef std::tuple<AgradCdfParetoType2, type_vv_133> AgradCdfParetoType2_vv_133;
+typedef std::tuple<AgradCdfParetoType2, type_vv_134> AgradCdfParetoType2_vv_134;
+typedef std::tuple<AgradCdfParetoType2, type_vv_135> AgradCdfParetoType2_vv_135;
+typedef std::tuple<AgradCdfParetoType2, type_vv_136> AgradCdfParetoType2_vv_136;
+typedef std::tuple<AgradCdfParetoType2, type_vv_137> AgradCdfParetoType2_vv_137;
+typedef std::tuple<AgradCdfParetoType2, type_vv_138> AgradCdfParetoType2_vv_138;
+typedef std::tuple<AgradCdfParetoType2, type_vv_139> AgradCdfParetoType2_vv_139;
+typedef std::tuple<AgradCdfParetoType2, type_vv_140> AgradCdfParetoType2_vv_140;
+typedef std::tuple<AgradCdfParetoType2, type_vv_141> AgradCdfParetoType2_vv_141;
+typedef std::tuple<AgradCdfParetoType2, type_vv_142> AgradCdfParetoType2_vv_142;
+typedef std::tuple<AgradCdfParetoType2, type_vv_143> AgradCdfParetoType2_vv_143;
+typedef std::tuple<AgradCdfParetoType2, type_vv_144> AgradCdfParetoType2_vv_144;
+typedef std::tuple<AgradCdfParetoType2, type_vv_145> AgradCdfParetoType2_vv_145;
+typedef std::tuple<AgradCdfParetoType2, type_vv_146> AgradCdfParetoType2_vv_146;
+typedef std::tuple<AgradCdfParetoType2, type_vv_147> AgradCdfParetoType2_vv_147;
+typedef std::tuple<AgradCdfParetoType2, type_vv_148> AgradCdfParetoType2_vv_148;
+typedef std::tuple<AgradCdfParetoType2, type_vv_149> AgradCdfParetoType2_vv_149;
+typedef std::tuple<AgradCdfParetoType2, type_vv_150> AgradCdfParetoType2_vv_150;
+typedef std::tuple<AgradCdfParetoType2, type_vv_151> AgradCdfParetoType2_vv_151;
+typedef std::tuple<AgradCdfParetoType2, type_vv_152> AgradCdfParetoType2_vv_152;
+typedef std::tuple<AgradCdfParetoType2, type_vv_153> AgradCdfParetoType2_vv_153;
+typedef std::tuple<AgradCdfParetoType2, type_vv_154> AgradCdfParetoType2_vv_154;
+typedef std::tuple<AgradCdfParetoType2, type_vv_155> AgradCdfParetoType2_vv_155;
+typedef std::tuple<AgradCdfParetoType2, type_vv_156> AgradCdfParetoType2_vv_156;
+typedef std::tuple<AgradCdfParetoType2, type_vv_157> AgradCdfParetoType2_vv_157;
+typedef std::tuple<AgradCdfParetoType2, type_vv_158> AgradCdfParetoType2_vv_158;
+typedef std::tuple<AgradCdfParetoType2, type_vv_159> AgradCdfParetoType2_vv_159;
+typedef std::tuple<AgradCdfParetoType2, type_vv_160> AgradCdfParetoType2_vv_160;
+typedef std::tuple<AgradCdfParetoType2, type_vv_161> AgradCdfParetoType2_vv_161;
+typedef std::tuple<AgradCdfParetoType2, type_vv_162> AgradCdfParetoType2_vv_162;
+typedef std::tuple<AgradCdfParetoType2, type_vv_163> AgradCdfParetoType2_vv_163;
+typedef std::tuple<AgradCdfParetoType2, type_vv_164> AgradCdfParetoType2_vv_164;
+typedef std::tuple<AgradCdfParetoType2, type_vv_165> AgradCdfParetoType2_vv_165;
+typedef std::tuple<AgradCdfParetoType2, type_vv_166> AgradCdfParetoType2_vv_166;
+typedef std::tuple<AgradCdfParetoType2, type_vv_167> AgradCdfParetoType2_vv_167;
+typedef std::tuple<AgradCdfParetoType2, type_vv_168> AgradCdfParetoType2_vv_168;
+typedef std::tuple<AgradCdfParetoType2, type_vv_169> AgradCdfParetoType2_vv_169;
+typedef std::tuple<AgradCdfParetoType2, type_vv_170> AgradCdfParetoType2_vv_170;
+typedef std::tuple<AgradCdfParetoType2, type_vv_171> AgradCdfParetoType2_vv_171;
+typedef std::tuple<AgradCdfParetoType2, type_vv_172> AgradCdfParetoType2_vv_172;
+typedef std::tuple<AgradCdfParetoType2, type_vv_173> AgradCdfParetoType2_vv_173;
+typedef std::tuple<AgradCdfParetoType2, type_vv_174> AgradCdfParetoType2_vv_174;
+typedef std::tuple<AgradCdfParetoType2, type_vv_175> AgradCdfParetoType2_vv_175;
+typedef std::tuple<AgradCdfParetoType2, type_vv_176> AgradCdfParetoType2_vv_176;
+typedef std::tuple<AgradCdfParetoType2, type_vv_177> AgradCdfParetoType2_vv_177;
+typedef std::tuple<AgradCdfParetoType2, type_vv_178> AgradCdfParetoType2_vv_178;
+typedef std::tuple<AgradCdfParetoType2, type_vv_179> AgradCdfParetoType2_vv_179;
+typedef std::tuple<AgradCdfParetoType2, type_vv_180> AgradCdfParetoType2_vv_180;
+typedef std::tuple<AgradCdfParetoType2, type_vv_181> AgradCdfParetoType2_vv_181;
+typedef std::tuple<AgradCdfParetoType2, type_vv_182> AgradCdfParetoType2_vv_182;
+typedef std::tuple<AgradCdfParetoType2, type_vv_183> AgradCdfParetoType2_vv_183;
+typedef std::tuple<AgradCdfParetoType2, type_vv_184> AgradCdfParetoType2_vv_184;
+typedef std::tuple<AgradCdfParetoType2, type_vv_185> AgradCdfParetoType2_vv_185;
+typedef std::tuple<AgradCdfParetoType2, type_vv_186> AgradCdfParetoType2_vv_186;
+typedef std::tuple<AgradCdfParetoType2, type_vv_187> AgradCdfParetoType2_vv_187;
+typedef std::tuple<AgradCdfParetoType2, type_vv_188> AgradCdfParetoType2_vv_188;
+typedef std::tuple<AgradCdfParetoType2, type_vv_189> AgradCdfParetoType2_vv_189;
+typedef std::tuple<AgradCdfParetoType2, type_vv_190> AgradCdfParetoType2_vv_190;
+typedef std::tuple<AgradCdfParetoType2, type_vv_191> AgradCdfParetoType2_vv_191;
+typedef std::tuple<AgradCdfParetoType2, type_vv_192> AgradCdfParetoType2_vv_192;
+typedef std::tuple<AgradCdfParetoType2, type_vv_193> AgradCdfParetoType2_vv_193;
+typedef std::tuple<AgradCdfParetoType2, type_vv_194> AgradCdfParetoType2_vv_194;
+typedef std::tuple<AgradCdfParetoType2, type_vv_195> AgradCdfParetoType2_vv_195;
+typedef std::tuple<AgradCdfParetoType2, type_vv_196> AgradCdfParetoType2_vv_196;
+typedef std::tuple<AgradCdfParetoType2, type_vv_197> AgradCdfParetoType2_vv_197;
+typedef std::tuple<AgradCdfParetoType2, type_vv_198> AgradCdfParetoType2_vv_198;
+typedef std::tuple<AgradCdfParetoType2, type_vv_199> AgradCdfParetoType2_vv_199;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_100, AgradCdfTestFixture, AgradCdfParetoType2_vv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_101, AgradCdfTestFixture, AgradCdfParetoType2_vv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_102, AgradCdfTestFixture, AgradCdfParetoType2_vv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_103, AgradCdfTestFixture, AgradCdfParetoType2_vv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_104, AgradCdfTestFixture, AgradCdfParetoType2_vv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_105, AgradCdfTestFixture, AgradCdfParetoType2_vv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_106, AgradCdfTestFixture, AgradCdfParetoType2_vv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_107, AgradCdfTestFixture, AgradCdfParetoType2_vv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_108, AgradCdfTestFixture, AgradCdfParetoType2_vv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_109, AgradCdfTestFixture, AgradCdfParetoType2_vv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_110, AgradCdfTestFixture, AgradCdfParetoType2_vv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_111, AgradCdfTestFixture, AgradCdfParetoType2_vv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_112, AgradCdfTestFixture, AgradCdfParetoType2_vv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_113, AgradCdfTestFixture, AgradCdfParetoType2_vv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_114, AgradCdfTestFixture, AgradCdfParetoType2_vv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_115, AgradCdfTestFixture, AgradCdfParetoType2_vv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_116, AgradCdfTestFixture, AgradCdfParetoType2_vv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_117, AgradCdfTestFixture, AgradCdfParetoType2_vv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_118, AgradCdfTestFixture, AgradCdfParetoType2_vv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_119, AgradCdfTestFixture, AgradCdfParetoType2_vv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_120, AgradCdfTestFixture, AgradCdfParetoType2_vv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_121, AgradCdfTestFixture, AgradCdfParetoType2_vv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_122, AgradCdfTestFixture, AgradCdfParetoType2_vv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_123, AgradCdfTestFixture, AgradCdfParetoType2_vv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_124, AgradCdfTestFixture, AgradCdfParetoType2_vv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_125, AgradCdfTestFixture, AgradCdfParetoType2_vv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_126, AgradCdfTestFixture, AgradCdfParetoType2_vv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_127, AgradCdfTestFixture, AgradCdfParetoType2_vv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_128, AgradCdfTestFixture, AgradCdfParetoType2_vv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_129, AgradCdfTestFixture, AgradCdfParetoType2_vv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_130, AgradCdfTestFixture, AgradCdfParetoType2_vv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_131, AgradCdfTestFixture, AgradCdfParetoType2_vv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_132, AgradCdfTestFixture, AgradCdfParetoType2_vv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_133, AgradCdfTestFixture, AgradCdfParetoType2_vv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_134, AgradCdfTestFixture, AgradCdfParetoType2_vv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_135, AgradCdfTestFixture, AgradCdfParetoType2_vv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_136, AgradCdfTestFixture, AgradCdfParetoType2_vv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_137, AgradCdfTestFixture, AgradCdfParetoType2_vv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_138, AgradCdfTestFixture, AgradCdfParetoType2_vv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_139, AgradCdfTestFixture, AgradCdfParetoType2_vv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_140, AgradCdfTestFixture, AgradCdfParetoType2_vv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_141, AgradCdfTestFixture, AgradCdfParetoType2_vv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_142, AgradCdfTestFixture, AgradCdfParetoType2_vv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_143, AgradCdfTestFixture, AgradCdfParetoType2_vv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_144, AgradCdfTestFixture, AgradCdfParetoType2_vv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_145, AgradCdfTestFixture, AgradCdfParetoType2_vv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_146, AgradCdfTestFixture, AgradCdfParetoType2_vv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_147, AgradCdfTestFixture, AgradCdfParetoType2_vv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_148, AgradCdfTestFixture, AgradCdfParetoType2_vv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_149, AgradCdfTestFixture, AgradCdfParetoType2_vv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_150, AgradCdfTestFixture, AgradCdfParetoType2_vv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_151, AgradCdfTestFixture, AgradCdfParetoType2_vv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_152, AgradCdfTestFixture, AgradCdfParetoType2_vv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_153, AgradCdfTestFixture, AgradCdfParetoType2_vv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_154, AgradCdfTestFixture, AgradCdfParetoType2_vv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_155, AgradCdfTestFixture, AgradCdfParetoType2_vv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_156, AgradCdfTestFixture, AgradCdfParetoType2_vv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_157, AgradCdfTestFixture, AgradCdfParetoType2_vv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_158, AgradCdfTestFixture, AgradCdfParetoType2_vv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_159, AgradCdfTestFixture, AgradCdfParetoType2_vv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_160, AgradCdfTestFixture, AgradCdfParetoType2_vv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_161, AgradCdfTestFixture, AgradCdfParetoType2_vv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_162, AgradCdfTestFixture, AgradCdfParetoType2_vv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_163, AgradCdfTestFixture, AgradCdfParetoType2_vv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_164, AgradCdfTestFixture, AgradCdfParetoType2_vv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_165, AgradCdfTestFixture, AgradCdfParetoType2_vv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_166, AgradCdfTestFixture, AgradCdfParetoType2_vv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_167, AgradCdfTestFixture, AgradCdfParetoType2_vv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_168, AgradCdfTestFixture, AgradCdfParetoType2_vv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_169, AgradCdfTestFixture, AgradCdfParetoType2_vv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_170, AgradCdfTestFixture, AgradCdfParetoType2_vv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_171, AgradCdfTestFixture, AgradCdfParetoType2_vv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_172, AgradCdfTestFixture, AgradCdfParetoType2_vv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_173, AgradCdfTestFixture, AgradCdfParetoType2_vv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_174, AgradCdfTestFixture, AgradCdfParetoType2_vv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_175, AgradCdfTestFixture, AgradCdfParetoType2_vv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_176, AgradCdfTestFixture, AgradCdfParetoType2_vv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_177, AgradCdfTestFixture, AgradCdfParetoType2_vv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_178, AgradCdfTestFixture, AgradCdfParetoType2_vv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_179, AgradCdfTestFixture, AgradCdfParetoType2_vv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_180, AgradCdfTestFixture, AgradCdfParetoType2_vv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_181, AgradCdfTestFixture, AgradCdfParetoType2_vv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_182, AgradCdfTestFixture, AgradCdfParetoType2_vv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_183, AgradCdfTestFixture, AgradCdfParetoType2_vv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_184, AgradCdfTestFixture, AgradCdfParetoType2_vv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_185, AgradCdfTestFixture, AgradCdfParetoType2_vv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_186, AgradCdfTestFixture, AgradCdfParetoType2_vv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_187, AgradCdfTestFixture, AgradCdfParetoType2_vv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_188, AgradCdfTestFixture, AgradCdfParetoType2_vv_188);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_189, AgradCdfTestFixture, AgradCdfParetoType2_vv_189);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_190, AgradCdfTestFixture, AgradCdfParetoType2_vv_190);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_191, AgradCdfTestFixture, AgradCdfParetoType2_vv_191);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_192, AgradCdfTestFixture, AgradCdfParetoType2_vv_192);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_193, AgradCdfTestFixture, AgradCdfParetoType2_vv_193);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_194, AgradCdfTestFixture, AgradCdfParetoType2_vv_194);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_195, AgradCdfTestFixture, AgradCdfParetoType2_vv_195);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_196, AgradCdfTestFixture, AgradCdfParetoType2_vv_196);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_197, AgradCdfTestFixture, AgradCdfParetoType2_vv_197);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_198, AgradCdfTestFixture, AgradCdfParetoType2_vv_198);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_199, AgradCdfTestFixture, AgradCdfParetoType2_vv_199);
+
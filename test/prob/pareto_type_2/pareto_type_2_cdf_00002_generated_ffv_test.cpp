@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_cdf_test.hpp>
+
+typedef std::tuple<std::vector<double>, double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_200;
+typedef std::tuple<std::vector<double>, double, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_201;
+typedef std::tuple<std::vector<double>, double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_202;
+typedef std::tuple<std::vector<double>, double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_203;
+typedef std::tuple<std::vector<double>, double, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_204;
+typedef std::tuple<std::vector<double>, double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_205;
+typedef std::tuple<std::vector<double>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_206;
+typedef std::tuple<std::vector<double>, double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_207;
+typedef std::tuple<std::vector<double>, double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_208;
+typedef std::tuple<std::vector<double>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_209;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_210;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_211;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_212;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_213;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_214;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_215;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, fvar<fvar<var> >, empty, empty> type_ffv_216;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_217;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_218;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_219;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_220;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_221;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_222;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_223;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_224;
+typedef std::tuple<std::vector<double>, std::vector<double>, fvar<fvar<var> >, double, empty, empty> type_ffv_225;
+typedef std::tuple<std::vector<double>, std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_226;
+typedef std::tuple<std::vector<double>, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_227;
+typedef std::tuple<std::vector<double>, std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_228;
+typedef std::tuple<std::vector<double>, std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_229;
+typedef std::tuple<std::vector<double>, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_230;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_231;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_232;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_233;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_234;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_235;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_236;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_237;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_238;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_239;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_240;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_241;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_242;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_243;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_244;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_245;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_246;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_247;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_248;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_249;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_250;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_251;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_252;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_253;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_254;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_255;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_256;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_257;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_258;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_259;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_260;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_261;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_262;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_263;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_264;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_265;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_266;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_267;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_268;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_269;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, double, double, empty, empty> type_ffv_270;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, double, std::vector<double>, empty, empty> type_ffv_271;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_272;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, double, fvar<fvar<var> >, empty, empty> type_ffv_273;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_274;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_275;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<double>, double, empty, empty> type_ffv_276;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty, empty> type_ffv_277;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_278;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_279;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_280;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_281;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_282;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_283;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_284;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_285;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_286;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_287;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, double, empty, empty> type_ffv_288;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_289;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_290;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_291;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_292;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_293;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_294;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_295;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_296;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_297;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_298;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_299;
+
+typedef std::tuple<AgradCdfParetoType2, type_ffv_200> AgradCdfParetoType2_ffv_200;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_201> AgradCdfParetoType2_ffv_201;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_202> AgradCdfParetoType2_ffv_202;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_203> AgradCdfParetoType2_ffv_203;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_204> AgradCdfParetoType2_ffv_204;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_205> AgradCdfParetoType2_ffv_205;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_206> AgradCdfParetoType2_ffv_206;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_207> AgradCdfParetoType2_ffv_207;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_208> AgradCdfParetoType2_ffv_208;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_209> AgradCdfParetoType2_ffv_209;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_210> AgradCdfParetoType2_ffv_210;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_211> AgradCdfParetoType2_ffv_211;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_212> AgradCdfParetoType2_ffv_212;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_213> AgradCdfParetoType2_ffv_213;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_214> AgradCdfParetoType2_ffv_214;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_215> AgradCdfParetoType2_ffv_215;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_216> AgradCdfParetoType2_ffv_216;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_217> AgradCdfParetoType2_ffv_217;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_218> AgradCdfParetoType2_ffv_218;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_219> AgradCdfParetoType2_ffv_219;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_220> AgradCdfParetoType2_ffv_220;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_221> AgradCdfParetoType2_ffv_221;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_222> AgradCdfParetoType2_ffv_222;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_223> AgradCdfParetoType2_ffv_223;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_224> AgradCdfParetoType2_ffv_224;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_225> AgradCdfParetoType2_ffv_225;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_226> AgradCdfParetoType2_ffv_226;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_227> AgradCdfParetoType2_ffv_227;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_228> AgradCdfParetoType2_ffv_228;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_229> AgradCdfParetoType2_ffv_229;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_230> AgradCdfParetoType2_ffv_230;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_231> AgradCdfParetoType2_ffv_231;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_232> AgradCdfParetoType2_ffv_232;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_233> AgradCdfParetoType2_ffv_233;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_234> AgradCdfParetoType2_ffv_234;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_235> AgradCdfParetoType2_ffv_235;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_236> AgradCdfParetoType2_ffv_236;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_237> AgradCdfParetoType2_ffv_237;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_238> AgradCdfParetoType2_ffv_238;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_239> AgradCdfParetoType2_ffv_239;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_240> AgradCdfParetoType2_ffv_240;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_241> AgradCdfParetoType2_ffv_241;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_242> AgradCdfParetoType2_ffv_242;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_243> AgradCdfParetoType2_ffv_243;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_244> AgradCdfParetoType2_ffv_244;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_245> AgradCdfParetoType2_ffv_245;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_246> AgradCdfParetoType2_ffv_246;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_247> AgradCdfParetoType2_ffv_247;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_248> AgradCdfParetoType2_ffv_248;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_249> AgradCdfParetoType2_ffv_249;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_250> AgradCdfParetoType2_ffv_250;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_251> AgradCdfParetoType2_ffv_251;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_252> AgradCdfParetoType2_ffv_252;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_253> AgradCdfParetoType2_ffv_253;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_254> AgradCdfParetoType2_ffv_254;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_255> AgradCdfParetoType2_ffv_255;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_256> AgradCdfParetoType2_ffv_256;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_257> AgradCdfParetoType2_ffv_257;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_258> AgradCdfParetoType2_ffv_258;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_259> AgradCdfParetoType2_ffv_259;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_260> AgradCdfParetoType2_ffv_260;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_261> AgradCdfParetoType2_ffv_261;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_262> AgradCdfParetoType2_ffv_262;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_263> AgradCdfParetoType2_ffv_263;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_264> AgradCdfParetoType2_ffv_264;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_265> AgradCdfParetoType2_ffv_265;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_266> AgradCdfParetoType2_ffv_266;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_267> AgradCdfParetoType2_ffv_267;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_268> AgradCdfParetoType2_ffv_268;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_269> AgradCdfParetoType2_ffv_269;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_270> AgradCdfParetoType2_ffv_270;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_271> AgradCdfParetoType2_ffv_271;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_272> AgradCdfParetoType2_ffv_272;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_273> AgradCdfParetoType2_ffv_273;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_274> AgradCdfParetoType2_ffv_274;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_275> AgradCdfParetoType2_ffv_275;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_276> AgradCdfParetoType2_ffv_276;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_277> AgradCdfParetoType2_ffv_277;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_278> AgradCdfParetoType2_ffv_278;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_279> AgradCdfParetoType2_ffv_279;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_280> AgradCdfParetoType2_ffv_280;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_281> AgradCdfParetoType2_ffv_281;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_282> AgradCdfParetoType2_ffv_282;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_283> AgradCdfParetoType2_ffv_283;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_284> AgradCdfParetoType2_ffv_284;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_285> AgradCdfParetoType2_ffv_285;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_286> AgradCdfParetoType2_ffv_286;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_287> AgradCdfParetoType2_ffv_287;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_288> AgradCdfParetoType2_ffv_288;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_289> AgradCdfParetoType2_ffv_289;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_290> AgradCdfParetoType2_ffv_290;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_291> AgradCdfParetoType2_ffv_291;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_292> AgradCdfParetoType2_ffv_292;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_293> AgradCdfParetoType2_ffv_293;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_294> AgradCdfParetoType2_ffv_294;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_295> AgradCdfParetoType2_ffv_295;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_296> AgradCdfParetoType2_ffv_296;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_297> AgradCdfParetoType2_ffv_297;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_298> AgradCdfParetoType2_ffv_298;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_299> AgradCdfParetoType2_ffv_299;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_200, AgradCdfTestFixture, AgradCdfParetoType2_ffv_200);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_201, AgradCdfTestFixture, AgradCdfParetoType2_ffv_201);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_202, AgradCdfTestFixture, AgradCdfParetoType2_ffv_202);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_203, AgradCdfTestFixture, AgradCdfParetoType2_ffv_203);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_204, AgradCdfTestFixture, AgradCdfParetoType2_ffv_204);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_205, AgradCdfTestFixture, AgradCdfParetoType2_ffv_205);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_206, AgradCdfTestFixture, AgradCdfParetoType2_ffv_206);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_207, AgradCdfTestFixture, AgradCdfParetoType2_ffv_207);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_208, AgradCdfTestFixture, AgradCdfParetoType2_ffv_208);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_209, AgradCdfTestFixture, AgradCdfParetoType2_ffv_209);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_210, AgradCdfTestFixture, AgradCdfParetoType2_ffv_210);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_211, AgradCdfTestFixture, AgradCdfParetoType2_ffv_211);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_212, AgradCdfTestFixture, AgradCdfParetoType2_ffv_212);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_213, AgradCdfTestFixture, AgradCdfParetoType2_ffv_213);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_214, AgradCdfTestFixture, AgradCdfParetoType2_ffv_214);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_215, AgradCdfTestFixture, AgradCdfParetoType2_ffv_215);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_216, AgradCdfTestFixture, AgradCdfParetoType2_ffv_216);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_217, AgradCdfTestFixture, AgradCdfParetoType2_ffv_217);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_218, AgradCdfTestFixture, AgradCdfParetoType2_ffv_218);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_219, AgradCdfTestFixture, AgradCdfParetoType2_ffv_219);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_220, AgradCdfTestFixture, AgradCdfParetoType2_ffv_220);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_221, AgradCdfTestFixture, AgradCdfParetoType2_ffv_221);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_222, AgradCdfTestFixture, AgradCdfParetoType2_ffv_222);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_223, AgradCdfTestFixture, AgradCdfParetoType2_ffv_223);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_224, AgradCdfTestFixture, AgradCdfParetoType2_ffv_224);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_225, AgradCdfTestFixture, AgradCdfParetoType2_ffv_225);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_226, AgradCdfTestFixture, AgradCdfParetoType2_ffv_226);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_227, AgradCdfTestFixture, AgradCdfParetoType2_ffv_227);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_228, AgradCdfTestFixture, AgradCdfParetoType2_ffv_228);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_229, AgradCdfTestFixture, AgradCdfParetoType2_ffv_229);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_230, AgradCdfTestFixture, AgradCdfParetoType2_ffv_230);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_231, AgradCdfTestFixture, AgradCdfParetoType2_ffv_231);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_232, AgradCdfTestFixture, AgradCdfParetoType2_ffv_232);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_233, AgradCdfTestFixture, AgradCdfParetoType2_ffv_233);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_234, AgradCdfTestFixture, AgradCdfParetoType2_ffv_234);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_235, AgradCdfTestFixture, AgradCdfParetoType2_ffv_235);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_236, AgradCdfTestFixture, AgradCdfParetoType2_ffv_236);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_237, AgradCdfTestFixture, AgradCdfParetoType2_ffv_237);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_238, AgradCdfTestFixture, AgradCdfParetoType2_ffv_238);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_239, AgradCdfTestFixture, AgradCdfParetoType2_ffv_239);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_240, AgradCdfTestFixture, AgradCdfParetoType2_ffv_240);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_241, AgradCdfTestFixture, AgradCdfParetoType2_ffv_241);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_242, AgradCdfTestFixture, AgradCdfParetoType2_ffv_242);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_243, AgradCdfTestFixture, AgradCdfParetoType2_ffv_243);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_244, AgradCdfTestFixture, AgradCdfParetoType2_ffv_244);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_245, AgradCdfTestFixture, AgradCdfParetoType2_ffv_245);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_246, AgradCdfTestFixture, AgradCdfParetoType2_ffv_246);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_247, AgradCdfTestFixture, AgradCdfParetoType2_ffv_247);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_248, AgradCdfTestFixture, AgradCdfParetoType2_ffv_248);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_249, AgradCdfTestFixture, AgradCdfParetoType2_ffv_249);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_250, AgradCdfTestFixture, AgradCdfParetoType2_ffv_250);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_251, AgradCdfTestFixture, AgradCdfParetoType2_ffv_251);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_252, AgradCdfTestFixture, AgradCdfParetoType2_ffv_252);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_253, AgradCdfTestFixture, AgradCdfParetoType2_ffv_253);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_254, AgradCdfTestFixture, AgradCdfParetoType2_ffv_254);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_255, AgradCdfTestFixture, AgradCdfParetoType2_ffv_255);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_256, AgradCdfTestFixture, AgradCdfParetoType2_ffv_256);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_257, AgradCdfTestFixture, AgradCdfParetoType2_ffv_257);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_258, AgradCdfTestFixture, AgradCdfParetoType2_ffv_258);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_259, AgradCdfTestFixture, AgradCdfParetoType2_ffv_259);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_260, AgradCdfTestFixture, AgradCdfParetoType2_ffv_260);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_261, AgradCdfTestFixture, AgradCdfParetoType2_ffv_261);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_262, AgradCdfTestFixture, AgradCdfParetoType2_ffv_262);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_263, AgradCdfTestFixture, AgradCdfParetoType2_ffv_263);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_264, AgradCdfTestFixture, AgradCdfParetoType2_ffv_264);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_265, AgradCdfTestFixture, AgradCdfParetoType2_ffv_265);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_266, AgradCdfTestFixture, AgradCdfParetoType2_ffv_266);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_267, AgradCdfTestFixture, AgradCdfParetoType2_ffv_267);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_268, AgradCdfTestFixture, AgradCdfParetoType2_ffv_268);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_269, AgradCdfTestFixture, AgradCdfParetoType2_ffv_269);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_270, AgradCdfTestFixture, AgradCdfParetoType2_ffv_270);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_271, AgradCdfTestFixture, AgradCdfParetoType2_ffv_271);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_272, AgradCdfTestFixture, AgradCdfParetoType2_ffv_272);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_273, AgradCdfTestFixture, AgradCdfParetoType2_ffv_273);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_274, AgradCdfTestFixture, AgradCdfParetoType2_ffv_274);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_275, AgradCdfTestFixture, AgradCdfParetoType2_ffv_275);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_276, AgradCdfTestFixture, AgradCdfParetoType2_ffv_276);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_277, AgradCdfTestFixture, AgradCdfParetoType2_ffv_277);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_278, AgradCdfTestFixture, AgradCdfParetoType2_ffv_278);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_279, AgradCdfTestFixture, AgradCdfParetoType2_ffv_279);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_280, AgradCdfTestFixture, AgradCdfParetoType2_ffv_280);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_281, AgradCdfTestFixture, AgradCdfParetoType2_ffv_281);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_282, AgradCdfTestFixture, AgradCdfParetoType2_ffv_282);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_283, AgradCdfTestFixture, AgradCdfParetoType2_ffv_283);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_284, AgradCdfTestFixture, AgradCdfParetoType2_ffv_284);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_285, AgradCdfTestFixture, AgradCdfParetoType2_ffv_285);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_286, AgradCdfTestFixture, AgradCdfParetoType2_ffv_286);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_287, AgradCdfTestFixture, AgradCdfParetoType2_ffv_287);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_288, AgradCdfTestFixture, AgradCdfParetoType2_ffv_288);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_289, AgradCdfTestFixture, AgradCdfParetoType2_ffv_289);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_290, AgradCdfTestFixture, AgradCdfParetoType2_ffv_290);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_291, AgradCdfTestFixture, AgradCdfParetoType2_ffv_291);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_292, AgradCdfTestFixture, AgradCdfParetoType2_ffv_292);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_293, AgradCdfTestFixture, AgradCdfParetoType2_ffv_293);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_294, AgradCdfTestFixture, AgradCdfParetoType2_ffv_294);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_295, AgradCdfTestFixture, AgradCdfParetoType2_ffv_295);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_296, AgradCdfTestFixture, AgradCdfParetoType2_ffv_296);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_297, AgradCdfTestFixture, AgradCdfParetoType2_ffv_297);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_298, AgradCdfTestFixture, AgradCdfParetoType2_ffv_298);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_299, AgradCdfTestFixture, AgradCdfParetoType2_ffv_299);
+
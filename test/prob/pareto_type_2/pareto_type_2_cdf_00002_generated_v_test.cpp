@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_cdf_test.hpp>
+
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_200;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_201;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_202;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_203;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_204;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_205;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_206;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_207;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_208;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_209;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_210;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_211;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_212;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_213;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_214;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_215;
+typedef std::tuple<std::vector<double>, double, double, double, empty, empty> type_v_216;
+typedef std::tuple<std::vector<double>, double, double, std::vector<double>, empty, empty> type_v_217;
+typedef std::tuple<std::vector<double>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_218;
+typedef std::tuple<std::vector<double>, double, double, var, empty, empty> type_v_219;
+typedef std::tuple<std::vector<double>, double, double, std::vector<var>, empty, empty> type_v_220;
+typedef std::tuple<std::vector<double>, double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_221;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, double, empty, empty> type_v_222;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, std::vector<double>, empty, empty> type_v_223;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_224;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, var, empty, empty> type_v_225;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, std::vector<var>, empty, empty> type_v_226;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_227;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_228;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_229;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_230;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_231;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_232;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_233;
+typedef std::tuple<std::vector<double>, double, var, double, empty, empty> type_v_234;
+typedef std::tuple<std::vector<double>, double, var, std::vector<double>, empty, empty> type_v_235;
+typedef std::tuple<std::vector<double>, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_236;
+typedef std::tuple<std::vector<double>, double, var, var, empty, empty> type_v_237;
+typedef std::tuple<std::vector<double>, double, var, std::vector<var>, empty, empty> type_v_238;
+typedef std::tuple<std::vector<double>, double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_239;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, double, empty, empty> type_v_240;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, std::vector<double>, empty, empty> type_v_241;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_242;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, var, empty, empty> type_v_243;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, std::vector<var>, empty, empty> type_v_244;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_245;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_246;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_247;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_248;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_249;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_250;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_251;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, double, empty, empty> type_v_252;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, std::vector<double>, empty, empty> type_v_253;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_254;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, var, empty, empty> type_v_255;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, std::vector<var>, empty, empty> type_v_256;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_257;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, double, empty, empty> type_v_258;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, std::vector<double>, empty, empty> type_v_259;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_260;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, var, empty, empty> type_v_261;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_v_262;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_263;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_264;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_265;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_266;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_267;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_268;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_269;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, double, empty, empty> type_v_270;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, std::vector<double>, empty, empty> type_v_271;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_272;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, var, empty, empty> type_v_273;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, std::vector<var>, empty, empty> type_v_274;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_275;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, double, empty, empty> type_v_276;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_v_277;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_278;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, var, empty, empty> type_v_279;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_v_280;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_281;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_282;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_283;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_284;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_285;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_286;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_287;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_288;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_289;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_290;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_291;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_292;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_293;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_294;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_295;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_296;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_297;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_298;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_299;
+
+typedef std::tuple<AgradCdfParetoType2, type_v_200> AgradCdfParetoType2_v_200;
+typedef std::tuple<AgradCdfParetoType2, type_v_201> AgradCdfParetoType2_v_201;
+typedef std::tuple<AgradCdfParetoType2, type_v_202> AgradCdfParetoType2_v_202;
+typedef std::tuple<AgradCdfParetoType2, type_v_203> AgradCdfParetoType2_v_203;
+typedef std::tuple<AgradCdfParetoType2, type_v_204> AgradCdfParetoType2_v_204;
+typedef std::tuple<AgradCdfParetoType2, type_v_205> AgradCdfParetoType2_v_205;
+typedef std::tuple<AgradCdfParetoType2, type_v_206> AgradCdfParetoType2_v_206;
+typedef std::tuple<AgradCdfParetoType2, type_v_207> AgradCdfParetoType2_v_207;
+typedef std::tuple<AgradCdfParetoType2, type_v_208> AgradCdfParetoType2_v_208;
+typedef std::tuple<AgradCdfParetoType2, type_v_209> AgradCdfParetoType2_v_209;
+typedef std::tuple<AgradCdfParetoType2, type_v_210> AgradCdfParetoType2_v_210;
+typedef std::tuple<AgradCdfParetoType2, type_v_211> AgradCdfParetoType2_v_211;
+typedef std::tuple<AgradCdfParetoType2, type_v_212> AgradCdfParetoType2_v_212;
+typedef std::tuple<AgradCdfParetoType2, type_v_213> AgradCdfParetoType2_v_213;
+typedef std::tuple<AgradCdfParetoType2, type_v_214> AgradCdfParetoType2_v_214;
+typedef std::tuple<AgradCdfParetoType2, type_v_215> AgradCdfParetoType2_v_215;
+typedef std::tuple<AgradCdfParetoType2, type_v_216> AgradCdfParetoType2_v_216;
+typedef std::tuple<AgradCdfParetoType2, type_v_217> AgradCdfParetoType2_v_217;
+typedef std::tuple<AgradCdfParetoType2, type_v_218> AgradCdfParetoType2_v_218;
+typedef std::tuple<AgradCdfParetoType2, type_v_219> AgradCdfParetoType2_v_219;
+typedef std::tuple<AgradCdfParetoType2, type_v_220> AgradCdfParetoType2_v_220;
+typedef std::tuple<AgradCdfParetoType2, type_v_221> AgradCdfParetoType2_v_221;
+typedef std::tuple<AgradCdfParetoType2, type_v_222> AgradCdfParetoType2_v_222;
+typedef std::tuple<AgradCdfParetoType2, type_v_223> AgradCdfParetoType2_v_223;
+typedef std::tuple<AgradCdfParetoType2, type_v_224> AgradCdfParetoType2_v_224;
+typedef std::tuple<AgradCdfParetoType2, type_v_225> AgradCdfParetoType2_v_225;
+typedef std::tuple<AgradCdfParetoType2, type_v_226> AgradCdfParetoType2_v_226;
+typedef std::tuple<AgradCdfParetoType2, type_v_227> AgradCdfParetoType2_v_227;
+typedef std::tuple<AgradCdfParetoType2, type_v_228> AgradCdfParetoType2_v_228;
+typedef std::tuple<AgradCdfParetoType2, type_v_229> AgradCdfParetoType2_v_229;
+typedef std::tuple<AgradCdfParetoType2, type_v_230> AgradCdfParetoType2_v_230;
+typedef std::tuple<AgradCdfParetoType2, type_v_231> AgradCdfParetoType2_v_231;
+typedef std::tuple<AgradCdfParetoType2, type_v_232> AgradCdfParetoType2_v_232;
+typedef std::tuple<AgradCdfParetoType2, type_v_233> AgradCdfParetoType2_v_233;
+typedef std::tuple<AgradCdfParetoType2, type_v_234> AgradCdfParetoType2_v_234;
+typedef std::tuple<AgradCdfParetoType2, type_v_235> AgradCdfParetoType2_v_235;
+typedef std::tuple<AgradCdfParetoType2, type_v_236> AgradCdfParetoType2_v_236;
+typedef std::tuple<AgradCdfParetoType2, type_v_237> AgradCdfParetoType2_v_237;
+typedef std::tuple<AgradCdfParetoType2, type_v_238> AgradCdfParetoType2_v_238;
+typedef std::tuple<AgradCdfParetoType2, type_v_239> AgradCdfParetoType2_v_239;
+typedef std::tuple<AgradCdfParetoType2, type_v_240> AgradCdfParetoType2_v_240;
+typedef std::tuple<AgradCdfParetoType2, type_v_241> AgradCdfParetoType2_v_241;
+typedef std::tuple<AgradCdfParetoType2, type_v_242> AgradCdfParetoType2_v_242;
+typedef std::tuple<AgradCdfParetoType2, type_v_243> AgradCdfParetoType2_v_243;
+typedef std::tuple<AgradCdfParetoType2, type_v_244> AgradCdfParetoType2_v_244;
+typedef std::tuple<AgradCdfParetoType2, type_v_245> AgradCdfParetoType2_v_245;
+typedef std::tuple<AgradCdfParetoType2, type_v_246> AgradCdfParetoType2_v_246;
+typedef std::tuple<AgradCdfParetoType2, type_v_247> AgradCdfParetoType2_v_247;
+typedef std::tuple<AgradCdfParetoType2, type_v_248> AgradCdfParetoType2_v_248;
+typedef std::tuple<AgradCdfParetoType2, type_v_249> AgradCdfParetoType2_v_249;
+typedef std::tuple<AgradCdfParetoType2, type_v_250> AgradCdfParetoType2_v_250;
+typedef std::tuple<AgradCdfParetoType2, type_v_251> AgradCdfParetoType2_v_251;
+typedef std::tuple<AgradCdfParetoType2, type_v_252> AgradCdfParetoType2_v_252;
+typedef std::tuple<AgradCdfParetoType2, type_v_253> AgradCdfParetoType2_v_253;
+typedef std::tuple<AgradCdfParetoType2, type_v_254> AgradCdfParetoType2_v_254;
+typedef std::tuple<AgradCdfParetoType2, type_v_255> AgradCdfParetoType2_v_255;
+typedef std::tuple<AgradCdfParetoType2, type_v_256> AgradCdfParetoType2_v_256;
+typedef std::tuple<AgradCdfParetoType2, type_v_257> AgradCdfParetoType2_v_257;
+typedef std::tuple<AgradCdfParetoType2, type_v_258> AgradCdfParetoType2_v_258;
+typedef std::tuple<AgradCdfParetoType2, type_v_259> AgradCdfParetoType2_v_259;
+typedef std::tuple<AgradCdfParetoType2, type_v_260> AgradCdfParetoType2_v_260;
+typedef std::tuple<AgradCdfParetoType2, type_v_261> AgradCdfParetoType2_v_261;
+typedef std::tuple<AgradCdfParetoType2, type_v_262> AgradCdfParetoType2_v_262;
+typedef std::tuple<AgradCdfParetoType2, type_v_263> AgradCdfParetoType2_v_263;
+typedef std::tuple<AgradCdfParetoType2, type_v_264> AgradCdfParetoType2_v_264;
+typedef std::tuple<AgradCdfParetoType2, type_v_265> AgradCdfParetoType2_v_265;
+typedef std::tuple<AgradCdfParetoType2, type_v_266> AgradCdfParetoType2_v_266;
+typedef std::tuple<AgradCdfParetoType2, type_v_267> AgradCdfParetoType2_v_267;
+typedef std::tuple<AgradCdfParetoType2, type_v_268> AgradCdfParetoType2_v_268;
+typedef std::tuple<AgradCdfParetoType2, type_v_269> AgradCdfParetoType2_v_269;
+typedef std::tuple<AgradCdfParetoType2, type_v_270> AgradCdfParetoType2_v_270;
+typedef std::tuple<AgradCdfParetoType2, type_v_271> AgradCdfParetoType2_v_271;
+typedef std::tuple<AgradCdfParetoType2, type_v_272> AgradCdfParetoType2_v_272;
+typedef std::tuple<AgradCdfParetoType2, type_v_273> AgradCdfParetoType2_v_273;
+typedef std::tuple<AgradCdfParetoType2, type_v_274> AgradCdfParetoType2_v_274;
+typedef std::tuple<AgradCdfParetoType2, type_v_275> AgradCdfParetoType2_v_275;
+typedef std::tuple<AgradCdfParetoType2, type_v_276> AgradCdfParetoType2_v_276;
+typedef std::tuple<AgradCdfParetoType2, type_v_277> AgradCdfParetoType2_v_277;
+typedef std::tuple<AgradCdfParetoType2, type_v_278> AgradCdfParetoType2_v_278;
+typedef std::tuple<AgradCdfParetoType2, type_v_279> AgradCdfParetoType2_v_279;
+typedef std::tuple<AgradCdfParetoType2, type_v_280> AgradCdfParetoType2_v_280;
+typedef std::tuple<AgradCdfParetoType2, type_v_281> AgradCdfParetoType2_v_281;
+typedef std::tuple<AgradCdfParetoType2, type_v_282> AgradCdfParetoType2_v_282;
+typedef std::tuple<AgradCdfParetoType2, type_v_283> AgradCdfParetoType2_v_283;
+typedef std::tuple<AgradCdfParetoType2, type_v_284> AgradCdfParetoType2_v_284;
+typedef std::tuple<AgradCdfParetoType2, type_v_285> AgradCdfParetoType2_v_285;
+typedef std::tuple<AgradCdfParetoType2, type_v_286> AgradCdfParetoType2_v_286;
+typedef std::tuple<AgradCdfParetoType2, type_v_287> AgradCdfParetoType2_v_287;
+typedef std::tuple<AgradCdfParetoType2, type_v_288> AgradCdfParetoType2_v_288;
+typedef std::tuple<AgradCdfParetoType2, type_v_289> AgradCdfParetoType2_v_289;
+typedef std::tuple<AgradCdfParetoType2, type_v_290> AgradCdfParetoType2_v_290;
+typedef std::tuple<AgradCdfParetoType2, type_v_291> AgradCdfParetoType2_v_291;
+typedef std::tuple<AgradCdfParetoType2, type_v_292> AgradCdfParetoType2_v_292;
+typedef std::tuple<AgradCdfParetoType2, type_v_293> AgradCdfParetoType2_v_293;
+typedef std::tuple<AgradCdfParetoType2, type_v_294> AgradCdfParetoType2_v_294;
+typedef std::tuple<AgradCdfParetoType2, type_v_295> AgradCdfParetoType2_v_295;
+typedef std::tuple<AgradCdfParetoType2, type_v_296> AgradCdfParetoType2_v_296;
+typedef std::tuple<AgradCdfParetoType2, type_v_297> AgradCdfParetoType2_v_297;
+typedef std::tuple<AgradCdfParetoType2, type_v_298> AgradCdfParetoType2_v_298;
+typedef std::tuple<AgradCdfParetoType2, type_v_299> AgradCdfParetoType2_v_299;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_200, AgradCdfTestFixture, AgradCdfParetoType2_v_200);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_201, AgradCdfTestFixture, AgradCdfParetoType2_v_201);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_202, AgradCdfTestFixture, AgradCdfParetoType2_v_202);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_203, AgradCdfTestFixture, AgradCdfParetoType2_v_203);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_204, AgradCdfTestFixture, AgradCdfParetoType2_v_204);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_205, AgradCdfTestFixture, AgradCdfParetoType2_v_205);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_206, AgradCdfTestFixture, AgradCdfParetoType2_v_206);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_207, AgradCdfTestFixture, AgradCdfParetoType2_v_207);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_208, AgradCdfTestFixture, AgradCdfParetoType2_v_208);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_209, AgradCdfTestFixture, AgradCdfParetoType2_v_209);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_210, AgradCdfTestFixture, AgradCdfParetoType2_v_210);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_211, AgradCdfTestFixture, AgradCdfParetoType2_v_211);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_212, AgradCdfTestFixture, AgradCdfParetoType2_v_212);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_213, AgradCdfTestFixture, AgradCdfParetoType2_v_213);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_214, AgradCdfTestFixture, AgradCdfParetoType2_v_214);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_215, AgradCdfTestFixture, AgradCdfParetoType2_v_215);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_216, AgradCdfTestFixture, AgradCdfParetoType2_v_216);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_217, AgradCdfTestFixture, AgradCdfParetoType2_v_217);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_218, AgradCdfTestFixture, AgradCdfParetoType2_v_218);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_219, AgradCdfTestFixture, AgradCdfParetoType2_v_219);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_220, AgradCdfTestFixture, AgradCdfParetoType2_v_220);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_221, AgradCdfTestFixture, AgradCdfParetoType2_v_221);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_222, AgradCdfTestFixture, AgradCdfParetoType2_v_222);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_223, AgradCdfTestFixture, AgradCdfParetoType2_v_223);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_224, AgradCdfTestFixture, AgradCdfParetoType2_v_224);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_225, AgradCdfTestFixture, AgradCdfParetoType2_v_225);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_226, AgradCdfTestFixture, AgradCdfParetoType2_v_226);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_227, AgradCdfTestFixture, AgradCdfParetoType2_v_227);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_228, AgradCdfTestFixture, AgradCdfParetoType2_v_228);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_229, AgradCdfTestFixture, AgradCdfParetoType2_v_229);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_230, AgradCdfTestFixture, AgradCdfParetoType2_v_230);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_231, AgradCdfTestFixture, AgradCdfParetoType2_v_231);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_232, AgradCdfTestFixture, AgradCdfParetoType2_v_232);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_233, AgradCdfTestFixture, AgradCdfParetoType2_v_233);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_234, AgradCdfTestFixture, AgradCdfParetoType2_v_234);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_235, AgradCdfTestFixture, AgradCdfParetoType2_v_235);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_236, AgradCdfTestFixture, AgradCdfParetoType2_v_236);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_237, AgradCdfTestFixture, AgradCdfParetoType2_v_237);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_238, AgradCdfTestFixture, AgradCdfParetoType2_v_238);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_239, AgradCdfTestFixture, AgradCdfParetoType2_v_239);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_240, AgradCdfTestFixture, AgradCdfParetoType2_v_240);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_241, AgradCdfTestFixture, AgradCdfParetoType2_v_241);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_242, AgradCdfTestFixture, AgradCdfParetoType2_v_242);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_243, AgradCdfTestFixture, AgradCdfParetoType2_v_243);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_244, AgradCdfTestFixture, AgradCdfParetoType2_v_244);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_245, AgradCdfTestFixture, AgradCdfParetoType2_v_245);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_246, AgradCdfTestFixture, AgradCdfParetoType2_v_246);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_247, AgradCdfTestFixture, AgradCdfParetoType2_v_247);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_248, AgradCdfTestFixture, AgradCdfParetoType2_v_248);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_249, AgradCdfTestFixture, AgradCdfParetoType2_v_249);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_250, AgradCdfTestFixture, AgradCdfParetoType2_v_250);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_251, AgradCdfTestFixture, AgradCdfParetoType2_v_251);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_252, AgradCdfTestFixture, AgradCdfParetoType2_v_252);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_253, AgradCdfTestFixture, AgradCdfParetoType2_v_253);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_254, AgradCdfTestFixture, AgradCdfParetoType2_v_254);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_255, AgradCdfTestFixture, AgradCdfParetoType2_v_255);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_256, AgradCdfTestFixture, AgradCdfParetoType2_v_256);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_257, AgradCdfTestFixture, AgradCdfParetoType2_v_257);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_258, AgradCdfTestFixture, AgradCdfParetoType2_v_258);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_259, AgradCdfTestFixture, AgradCdfParetoType2_v_259);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_260, AgradCdfTestFixture, AgradCdfParetoType2_v_260);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_261, AgradCdfTestFixture, AgradCdfParetoType2_v_261);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_262, AgradCdfTestFixture, AgradCdfParetoType2_v_262);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_263, AgradCdfTestFixture, AgradCdfParetoType2_v_263);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_264, AgradCdfTestFixture, AgradCdfParetoType2_v_264);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_265, AgradCdfTestFixture, AgradCdfParetoType2_v_265);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_266, AgradCdfTestFixture, AgradCdfParetoType2_v_266);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_267, AgradCdfTestFixture, AgradCdfParetoType2_v_267);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_268, AgradCdfTestFixture, AgradCdfParetoType2_v_268);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_269, AgradCdfTestFixture, AgradCdfParetoType2_v_269);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_270, AgradCdfTestFixture, AgradCdfParetoType2_v_270);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_271, AgradCdfTestFixture, AgradCdfParetoType2_v_271);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_272, AgradCdfTestFixture, AgradCdfParetoType2_v_272);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_273, AgradCdfTestFixture, AgradCdfParetoType2_v_273);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_274, AgradCdfTestFixture, AgradCdfParetoType2_v_274);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_275, AgradCdfTestFixture, AgradCdfParetoType2_v_275);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_276, AgradCdfTestFixture, AgradCdfParetoType2_v_276);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_277, AgradCdfTestFixture, AgradCdfParetoType2_v_277);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_278, AgradCdfTestFixture, AgradCdfParetoType2_v_278);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_279, AgradCdfTestFixture, AgradCdfParetoType2_v_279);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_280, AgradCdfTestFixture, AgradCdfParetoType2_v_280);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_281, AgradCdfTestFixture, AgradCdfParetoType2_v_281);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_282, AgradCdfTestFixture, AgradCdfParetoType2_v_282);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_283, AgradCdfTestFixture, AgradCdfParetoType2_v_283);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_284, AgradCdfTestFixture, AgradCdfParetoType2_v_284);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_285, AgradCdfTestFixture, AgradCdfParetoType2_v_285);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_286, AgradCdfTestFixture, AgradCdfParetoType2_v_286);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_287, AgradCdfTestFixture, AgradCdfParetoType2_v_287);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_288, AgradCdfTestFixture, AgradCdfParetoType2_v_288);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_289, AgradCdfTestFixture, AgradCdfParetoType2_v_289);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_290, AgradCdfTestFixture, AgradCdfParetoType2_v_290);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_291, AgradCdfTestFixture, AgradCdfParetoType2_v_291);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_292, AgradCdfTestFixture, AgradCdfParetoType2_v_292);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_293, AgradCdfTestFixture, AgradCdfParetoType2_v_293);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_294, AgradCdfTestFixture, AgradCdfParetoType2_v_294);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_295, AgradCdfTestFixture, AgradCdfParetoType2_v_295);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_296, AgradCdfTestFixture, AgradCdfParetoType2_v_296);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_297, AgradCdfTestFixture, AgradCdfParetoType2_v_297);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_298, AgradCdfTestFixture, AgradCdfParetoType2_v_298);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_299, AgradCdfTestFixture, AgradCdfParetoType2_v_299);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_cdf_test.hpp>
+
+typedef std::tuple<std::vector<double>, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_200;
+typedef std::tuple<std::vector<double>, double, var, var, empty, empty> type_vv_201;
+typedef std::tuple<std::vector<double>, double, var, std::vector<var>, empty, empty> type_vv_202;
+typedef std::tuple<std::vector<double>, double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_203;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, double, empty, empty> type_vv_204;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, std::vector<double>, empty, empty> type_vv_205;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_206;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, var, empty, empty> type_vv_207;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, std::vector<var>, empty, empty> type_vv_208;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_209;
+typedef std::tuple<std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_210;
+typedef std::tuple<std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_211;
+typedef std::tuple<std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_212;
+typedef std::tuple<std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_213;
+typedef std::tuple<std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_214;
+typedef std::tuple<std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_215;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, var, empty, empty> type_vv_216;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, std::vector<var>, empty, empty> type_vv_217;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_218;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, var, empty, empty> type_vv_219;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_vv_220;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_221;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_222;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_223;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_224;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, double, empty, empty> type_vv_225;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, std::vector<double>, empty, empty> type_vv_226;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_227;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, var, empty, empty> type_vv_228;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, std::vector<var>, empty, empty> type_vv_229;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_230;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, double, empty, empty> type_vv_231;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_vv_232;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_233;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, var, empty, empty> type_vv_234;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_vv_235;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_236;
+typedef std::tuple<std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_237;
+typedef std::tuple<std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_238;
+typedef std::tuple<std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_239;
+typedef std::tuple<std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_240;
+typedef std::tuple<std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_241;
+typedef std::tuple<std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_242;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_vv_243;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_vv_244;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_245;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_vv_246;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_vv_247;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_248;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_249;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_250;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_251;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_vv_252;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_vv_253;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_254;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_vv_255;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_vv_256;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_257;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_vv_258;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_vv_259;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_260;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_vv_261;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_vv_262;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_263;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_264;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_265;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_266;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_267;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_268;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_269;
+typedef std::tuple<std::vector<double>, var, double, double, empty, empty> type_vv_270;
+typedef std::tuple<std::vector<double>, var, double, std::vector<double>, empty, empty> type_vv_271;
+typedef std::tuple<std::vector<double>, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_272;
+typedef std::tuple<std::vector<double>, var, double, var, empty, empty> type_vv_273;
+typedef std::tuple<std::vector<double>, var, double, std::vector<var>, empty, empty> type_vv_274;
+typedef std::tuple<std::vector<double>, var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_275;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, double, empty, empty> type_vv_276;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, std::vector<double>, empty, empty> type_vv_277;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_278;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, var, empty, empty> type_vv_279;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, std::vector<var>, empty, empty> type_vv_280;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_281;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_282;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_283;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_284;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_285;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_286;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_287;
+typedef std::tuple<std::vector<double>, var, var, double, empty, empty> type_vv_288;
+typedef std::tuple<std::vector<double>, var, var, std::vector<double>, empty, empty> type_vv_289;
+typedef std::tuple<std::vector<double>, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_290;
+typedef std::tuple<std::vector<double>, var, var, var, empty, empty> type_vv_291;
+typedef std::tuple<std::vector<double>, var, var, std::vector<var>, empty, empty> type_vv_292;
+typedef std::tuple<std::vector<double>, var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_293;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, double, empty, empty> type_vv_294;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, std::vector<double>, empty, empty> type_vv_295;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_296;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, var, empty, empty> type_vv_297;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, std::vector<var>, empty, empty> type_vv_298;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_299;
+
+typedef std::tuple<AgradCdfParetoType2, type_vv_200> AgradCdfParetoType2_vv_200;
+typedef std::tuple<AgradCdfParetoType2, type_vv_201> AgradCdfParetoType2_vv_201;
+typedef std::tuple<AgradCdfParetoType2, type_vv_202> AgradCdfParetoType2_vv_202;
+typedef std::tuple<AgradCdfParetoType2, type_vv_203> AgradCdfParetoType2_vv_203;
+typedef std::tuple<AgradCdfParetoType2, type_vv_204> AgradCdfParetoType2_vv_204;
+typedef std::tuple<AgradCdfParetoType2, type_vv_205> AgradCdfParetoType2_vv_205;
+typedef std::tuple<AgradCdfParetoType2, type_vv_206> AgradCdfParetoType2_vv_206;
+typedef std::tuple<AgradCdfParetoType2, type_vv_207> AgradCdfParetoType2_vv_207;
+typedef std::tuple<AgradCdfParetoType2, type_vv_208> AgradCdfParetoType2_vv_208;
+typedef std::tuple<AgradCdfParetoType2, type_vv_209> AgradCdfParetoType2_vv_209;
+typedef std::tuple<AgradCdfParetoType2, type_vv_210> AgradCdfParetoType2_vv_210;
+typedef std::tuple<AgradCdfParetoType2, type_vv_211> AgradCdfParetoType2_vv_211;
+typedef std::tuple<AgradCdfParetoType2, type_vv_212> AgradCdfParetoType2_vv_212;
+typedef std::tuple<AgradCdfParetoType2, type_vv_213> AgradCdfParetoType2_vv_213;
+typedef std::tuple<AgradCdfParetoType2, type_vv_214> AgradCdfParetoType2_vv_214;
+typedef std::tuple<AgradCdfParetoType2, type_vv_215> AgradCdfParetoType2_vv_215;
+typedef std::tuple<AgradCdfParetoType2, type_vv_216> AgradCdfParetoType2_vv_216;
+typedef std::tuple<AgradCdfParetoType2, type_vv_217> AgradCdfParetoType2_vv_217;
+typedef std::tuple<AgradCdfParetoType2, type_vv_218> AgradCdfParetoType2_vv_218;
+typedef std::tuple<AgradCdfParetoType2, type_vv_219> AgradCdfParetoType2_vv_219;
+typedef std::tuple<AgradCdfParetoType2, type_vv_220> AgradCdfParetoType2_vv_220;
+typedef std::tuple<AgradCdfParetoType2, type_vv_221> AgradCdfParetoType2_vv_221;
+typedef std::tuple<AgradCdfParetoType2, type_vv_222> AgradCdfParetoType2_vv_222;
+typedef std::tuple<AgradCdfParetoType2, type_vv_223> AgradCdfParetoType2_vv_223;
+typedef std::tuple<AgradCdfParetoType2, type_vv_224> AgradCdfParetoType2_vv_224;
+typedef std::tuple<AgradCdfParetoType2, type_vv_225> AgradCdfParetoType2_vv_225;
+typedef std::tuple<AgradCdfParetoType2, type_vv_226> AgradCdfParetoType2_vv_226;
+typedef std::tuple<AgradCdfParetoType2, type_vv_227> AgradCdfParetoType2_vv_227;
+typedef std::tuple<AgradCdfParetoType2, type_vv_228> AgradCdfParetoType2_vv_228;
+typedef std::tuple<AgradCdfParetoType2, type_vv_229> AgradCdfParetoType2_vv_229;
+typedef std::tuple<AgradCdfParetoType2, type_vv_230> AgradCdfParetoType2_vv_230;
+typedef std::tuple<AgradCdfParetoType2, type_vv_231> AgradCdfParetoType2_vv_231;
+typedef std::tuple<AgradCdfParetoType2, type_vv_232> AgradCdfParetoType2_vv_232;
+typedef std::tuple<AgradCdfParetoType2, type_vv_233> AgradCdfParetoType2_vv_233;
+typedef std::tuple<AgradCdfParetoType2, type_vv_234> AgradCdfParetoType2_vv_234;
+typedef std::tuple<AgradCdfParetoType2, type_vv_235> AgradCdfParetoType2_vv_235;
+typedef std::tuple<AgradCdfParetoType2, type_vv_236> AgradCdfParetoType2_vv_236;
+typedef std::tuple<AgradCdfParetoType2, type_vv_237> AgradCdfParetoType2_vv_237;
+typedef std::tuple<AgradCdfParetoType2, type_vv_238> AgradCdfParetoType2_vv_238;
+typedef std::tuple<AgradCdfParetoType2, type_vv_239> AgradCdfParetoType2_vv_239;
+typedef std::tuple<AgradCdfParetoType2, type_vv_240> AgradCdfParetoType2_vv_240;
+typedef std::tuple<AgradCdfParetoType2, type_vv_241> AgradCdfParetoType2_vv_241;
+typedef std::tuple<AgradCdfParetoType2, type_vv_242> AgradCdfParetoType2_vv_242;
+typedef std::tuple<AgradCdfParetoType2, type_vv_243> AgradCdfParetoType2_vv_243;
+typedef std::tuple<AgradCdfParetoType2, type_vv_244> AgradCdfParetoType2_vv_244;
+typedef std::tuple<AgradCdfParetoType2, type_vv_245> AgradCdfParetoType2_vv_245;
+typedef std::tuple<AgradCdfParetoType2, type_vv_246> AgradCdfParetoType2_vv_246;
+typedef std::tuple<AgradCdfParetoType2, type_vv_247> AgradCdfParetoType2_vv_247;
+typedef std::tuple<AgradCdfParetoType2, type_vv_248> AgradCdfParetoType2_vv_248;
+typedef std::tuple<AgradCdfParetoType2, type_vv_249> AgradCdfParetoType2_vv_249;
+typedef std::tuple<AgradCdfParetoType2, type_vv_250> AgradCdfParetoType2_vv_250;
+typedef std::tuple<AgradCdfParetoType2, type_vv_251> AgradCdfParetoType2_vv_251;
+typedef std::tuple<AgradCdfParetoType2, type_vv_252> AgradCdfParetoType2_vv_252;
+typedef std::tuple<AgradCdfParetoType2, type_vv_253> AgradCdfParetoType2_vv_253;
+typedef std::tuple<AgradCdfParetoType2, type_vv_254> AgradCdfParetoType2_vv_254;
+typedef std::tuple<AgradCdfParetoType2, type_vv_255> AgradCdfParetoType2_vv_255;
+typedef std::tuple<AgradCdfParetoType2, type_vv_256> AgradCdfParetoType2_vv_256;
+typedef std::tuple<AgradCdfParetoType2, type_vv_257> AgradCdfParetoType2_vv_257;
+typedef std::tuple<AgradCdfParetoType2, type_vv_258> AgradCdfParetoType2_vv_258;
+typedef std::tuple<AgradCdfParetoType2, type_vv_259> AgradCdfParetoType2_vv_259;
+typedef std::tuple<AgradCdfParetoType2, type_vv_260> AgradCdfParetoType2_vv_260;
+typedef std::tuple<AgradCdfParetoType2, type_vv_261> AgradCdfParetoType2_vv_261;
+typedef std::tuple<AgradCdfParetoType2, type_vv_262> AgradCdfParetoType2_vv_262;
+typedef std::tuple<AgradCdfParetoType2, type_vv_263> AgradCdfParetoType2_vv_263;
+typedef std::tuple<AgradCdfParetoType2, type_vv_264> AgradCdfParetoType2_vv_264;
+typedef std::tuple<AgradCdfParetoType2, type_vv_265> AgradCdfParetoType2_vv_265;
+typedef std::tuple<AgradCdfParetoType2, type_vv_266> AgradCdfParetoType2_vv_266;
+typedef std::tuple<AgradCdfParetoType2, type_vv_267> AgradCdfParetoType2_vv_267;
+typedef std::tuple<AgradCdfParetoType2, type_vv_268> AgradCdfParetoType2_vv_268;
+typedef std::tuple<AgradCdfParetoType2, type_vv_269> AgradCdfParetoType2_vv_269;
+typedef std::tuple<AgradCdfParetoType2, type_vv_270> AgradCdfParetoType2_vv_270;
+typedef std::tuple<AgradCdfParetoType2, type_vv_271> AgradCdfParetoType2_vv_271;
+typedef std::tuple<AgradCdfParetoType2, type_vv_272> AgradCdfParetoType2_vv_272;
+typedef std::tuple<AgradCdfParetoType2, type_vv_273> AgradCdfParetoType2_vv_273;
+typedef std::tuple<AgradCdfParetoType2, type_vv_274> AgradCdfParetoType2_vv_274;
+typedef std::tuple<AgradCdfParetoType2, type_vv_275> AgradCdfParetoType2_vv_275;
+typedef std::tuple<AgradCdfParetoType2, type_vv_276> AgradCdfParetoType2_vv_276;
+typedef std::tuple<AgradCdfParetoType2, type_vv_277> AgradCdfParetoType2_vv_277;
+typedef std::tuple<AgradCdfParetoType2, type_vv_278> AgradCdfParetoType2_vv_278;
+typedef std::tuple<AgradCdfParetoType2, type_vv_279> AgradCdfParetoType2_vv_279;
+typedef std::tuple<AgradCdfParetoType2, type_vv_280> AgradCdfParetoType2_vv_280;
+typedef std::tuple<AgradCdfParetoType2, type_vv_281> AgradCdfParetoType2_vv_281;
+typedef std::tuple<AgradCdfParetoType2, type_vv_282> AgradCdfParetoType2_vv_282;
+typedef std::tuple<AgradCdfParetoType2, type_vv_283> AgradCdfParetoType2_vv_283;
+typedef std::tuple<AgradCdfParetoType2, type_vv_284> AgradCdfParetoType2_vv_284;
+typedef std::tuple<AgradCdfParetoType2, type_vv_285> AgradCdfParetoType2_vv_285;
+typedef std::tuple<AgradCdfParetoType2, type_vv_286> AgradCdfParetoType2_vv_286;
+typedef std::tuple<AgradCdfParetoType2, type_vv_287> AgradCdfParetoType2_vv_287;
+typedef std::tuple<AgradCdfParetoType2, type_vv_288> AgradCdfParetoType2_vv_288;
+typedef std::tuple<AgradCdfParetoType2, type_vv_289> AgradCdfParetoType2_vv_289;
+typedef std::tuple<AgradCdfParetoType2, type_vv_290> AgradCdfParetoType2_vv_290;
+typedef std::tuple<AgradCdfParetoType2, type_vv_291> AgradCdfParetoType2_vv_291;
+typedef std::tuple<AgradCdfParetoType2, type_vv_292> AgradCdfParetoType2_vv_292;
+typedef std::tuple<AgradCdfParetoType2, type_vv_293> AgradCdfParetoType2_vv_293;
+typedef std::tuple<AgradCdfParetoType2, type_vv_294> AgradCdfParetoType2_vv_294;
+typedef std::tuple<AgradCdfParetoType2, type_vv_295> AgradCdfParetoType2_vv_295;
+typedef std::tuple<AgradCdfParetoType2, type_vv_296> AgradCdfParetoType2_vv_296;
+typedef std::tuple<AgradCdfParetoType2, type_vv_297> AgradCdfParetoType2_vv_297;
+typedef std::tuple<AgradCdfParetoType2, type_vv_298> AgradCdfParetoType2_vv_298;
+typedef std::tuple<AgradCdfParetoType2, type_vv_299> AgradCdfParetoType2_vv_299;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_200, AgradCdfTestFixture, AgradCdfParetoType2_vv_200);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_201, AgradCdfTestFixture, AgradCdfParetoType2_vv_201);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_202, AgradCdfTestFixture, AgradCdfParetoType2_vv_202);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_203, AgradCdfTestFixture, AgradCdfParetoType2_vv_203);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_204, AgradCdfTestFixture, AgradCdfParetoType2_vv_204);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_205, AgradCdfTestFixture, AgradCdfParetoType2_vv_205);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_206, AgradCdfTestFixture, AgradCdfParetoType2_vv_206);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_207, AgradCdfTestFixture, AgradCdfParetoType2_vv_207);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_208, AgradCdfTestFixture, AgradCdfParetoType2_vv_208);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_209, AgradCdfTestFixture, AgradCdfParetoType2_vv_209);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_210, AgradCdfTestFixture, AgradCdfParetoType2_vv_210);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_211, AgradCdfTestFixture, AgradCdfParetoType2_vv_211);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_212, AgradCdfTestFixture, AgradCdfParetoType2_vv_212);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_213, AgradCdfTestFixture, AgradCdfParetoType2_vv_213);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_214, AgradCdfTestFixture, AgradCdfParetoType2_vv_214);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_215, AgradCdfTestFixture, AgradCdfParetoType2_vv_215);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_216, AgradCdfTestFixture, AgradCdfParetoType2_vv_216);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_217, AgradCdfTestFixture, AgradCdfParetoType2_vv_217);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_218, AgradCdfTestFixture, AgradCdfParetoType2_vv_218);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_219, AgradCdfTestFixture, AgradCdfParetoType2_vv_219);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_220, AgradCdfTestFixture, AgradCdfParetoType2_vv_220);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_221, AgradCdfTestFixture, AgradCdfParetoType2_vv_221);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_222, AgradCdfTestFixture, AgradCdfParetoType2_vv_222);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_223, AgradCdfTestFixture, AgradCdfParetoType2_vv_223);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_224, AgradCdfTestFixture, AgradCdfParetoType2_vv_224);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_225, AgradCdfTestFixture, AgradCdfParetoType2_vv_225);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_226, AgradCdfTestFixture, AgradCdfParetoType2_vv_226);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_227, AgradCdfTestFixture, AgradCdfParetoType2_vv_227);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_228, AgradCdfTestFixture, AgradCdfParetoType2_vv_228);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_229, AgradCdfTestFixture, AgradCdfParetoType2_vv_229);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_230, AgradCdfTestFixture, AgradCdfParetoType2_vv_230);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_231, AgradCdfTestFixture, AgradCdfParetoType2_vv_231);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_232, AgradCdfTestFixture, AgradCdfParetoType2_vv_232);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_233, AgradCdfTestFixture, AgradCdfParetoType2_vv_233);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_234, AgradCdfTestFixture, AgradCdfParetoType2_vv_234);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_235, AgradCdfTestFixture, AgradCdfParetoType2_vv_235);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_236, AgradCdfTestFixture, AgradCdfParetoType2_vv_236);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_237, AgradCdfTestFixture, AgradCdfParetoType2_vv_237);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_238, AgradCdfTestFixture, AgradCdfParetoType2_vv_238);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_239, AgradCdfTestFixture, AgradCdfParetoType2_vv_239);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_240, AgradCdfTestFixture, AgradCdfParetoType2_vv_240);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_241, AgradCdfTestFixture, AgradCdfParetoType2_vv_241);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_242, AgradCdfTestFixture, AgradCdfParetoType2_vv_242);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_243, AgradCdfTestFixture, AgradCdfParetoType2_vv_243);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_244, AgradCdfTestFixture, AgradCdfParetoType2_vv_244);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_245, AgradCdfTestFixture, AgradCdfParetoType2_vv_245);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_246, AgradCdfTestFixture, AgradCdfParetoType2_vv_246);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_247, AgradCdfTestFixture, AgradCdfParetoType2_vv_247);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_248, AgradCdfTestFixture, AgradCdfParetoType2_vv_248);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_249, AgradCdfTestFixture, AgradCdfParetoType2_vv_249);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_250, AgradCdfTestFixture, AgradCdfParetoType2_vv_250);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_251, AgradCdfTestFixture, AgradCdfParetoType2_vv_251);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_252, AgradCdfTestFixture, AgradCdfParetoType2_vv_252);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_253, AgradCdfTestFixture, AgradCdfParetoType2_vv_253);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_254, AgradCdfTestFixture, AgradCdfParetoType2_vv_254);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_255, AgradCdfTestFixture, AgradCdfParetoType2_vv_255);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_256, AgradCdfTestFixture, AgradCdfParetoType2_vv_256);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_257, AgradCdfTestFixture, AgradCdfParetoType2_vv_257);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_258, AgradCdfTestFixture, AgradCdfParetoType2_vv_258);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_259, AgradCdfTestFixture, AgradCdfParetoType2_vv_259);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_260, AgradCdfTestFixture, AgradCdfParetoType2_vv_260);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_261, AgradCdfTestFixture, AgradCdfParetoType2_vv_261);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_262, AgradCdfTestFixture, AgradCdfParetoType2_vv_262);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_263, AgradCdfTestFixture, AgradCdfParetoType2_vv_263);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_264, AgradCdfTestFixture, AgradCdfParetoType2_vv_264);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_265, AgradCdfTestFixture, AgradCdfParetoType2_vv_265);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_266, AgradCdfTestFixture, AgradCdfParetoType2_vv_266);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_267, AgradCdfTestFixture, AgradCdfParetoType2_vv_267);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_268, AgradCdfTestFixture, AgradCdfParetoType2_vv_268);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_269, AgradCdfTestFixture, AgradCdfParetoType2_vv_269);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_270, AgradCdfTestFixture, AgradCdfParetoType2_vv_270);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_271, AgradCdfTestFixture, AgradCdfParetoType2_vv_271);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_272, AgradCdfTestFixture, AgradCdfParetoType2_vv_272);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_273, AgradCdfTestFixture, AgradCdfParetoType2_vv_273);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_274, AgradCdfTestFixture, AgradCdfParetoType2_vv_274);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_275, AgradCdfTestFixture, AgradCdfParetoType2_vv_275);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_276, AgradCdfTestFixture, AgradCdfParetoType2_vv_276);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_277, AgradCdfTestFixture, AgradCdfParetoType2_vv_277);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_278, AgradCdfTestFixture, AgradCdfParetoType2_vv_278);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_279, AgradCdfTestFixture, AgradCdfParetoType2_vv_279);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_280, AgradCdfTestFixture, AgradCdfParetoType2_vv_280);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_281, AgradCdfTestFixture, AgradCdfParetoType2_vv_281);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_282, AgradCdfTestFixture, AgradCdfParetoType2_vv_282);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_283, AgradCdfTestFixture, AgradCdfParetoType2_vv_283);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_284, AgradCdfTestFixture, AgradCdfParetoType2_vv_284);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_285, AgradCdfTestFixture, AgradCdfParetoType2_vv_285);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_286, AgradCdfTestFixture, AgradCdfParetoType2_vv_286);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_287, AgradCdfTestFixture, AgradCdfParetoType2_vv_287);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_288, AgradCdfTestFixture, AgradCdfParetoType2_vv_288);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_289, AgradCdfTestFixture, AgradCdfParetoType2_vv_289);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_290, AgradCdfTestFixture, AgradCdfParetoType2_vv_290);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_291, AgradCdfTestFixture, AgradCdfParetoType2_vv_291);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_292, AgradCdfTestFixture, AgradCdfParetoType2_vv_292);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_293, AgradCdfTestFixture, AgradCdfParetoType2_vv_293);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_294, AgradCdfTestFixture, AgradCdfParetoType2_vv_294);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_295, AgradCdfTestFixture, AgradCdfParetoType2_vv_295);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_296, AgradCdfTestFixture, AgradCdfParetoType2_vv_296);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_297, AgradCdfTestFixture, AgradCdfParetoType2_vv_297);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_298, AgradCdfTestFixture, AgradCdfParetoType2_vv_298);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_299, AgradCdfTestFixture, AgradCdfParetoType2_vv_299);
+
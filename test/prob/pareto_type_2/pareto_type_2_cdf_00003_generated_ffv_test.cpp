@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_cdf_test.hpp>
+
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_300;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_301;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_302;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_303;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_304;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_305;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, double, double, empty, empty> type_ffv_306;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty, empty> type_ffv_307;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_308;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty, empty> type_ffv_309;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_310;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_311;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty, empty> type_ffv_312;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_313;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_314;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_315;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_316;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_317;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_318;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_319;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_320;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_321;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_322;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_323;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty, empty> type_ffv_324;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_325;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_326;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_327;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_328;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_329;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_330;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_331;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_332;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_333;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_334;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_335;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_336;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_337;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_338;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_339;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_340;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_341;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty, empty> type_ffv_342;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_ffv_343;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_344;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_345;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_346;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_347;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_ffv_348;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_349;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_350;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_351;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_352;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_353;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_354;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_355;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_356;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_357;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_358;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_359;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_360;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_361;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_362;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_363;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_364;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_365;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_366;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_367;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_368;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_369;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_370;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_371;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_372;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_373;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_374;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_375;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_376;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_377;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, fvar<fvar<var> >, empty, empty> type_ffv_378;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_379;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_380;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_381;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_382;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_383;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_384;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_385;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_386;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, double, empty, empty> type_ffv_387;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_388;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_389;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_390;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_391;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_392;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_393;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_394;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_395;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_396;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_397;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_398;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_399;
+
+typedef std::tuple<AgradCdfParetoType2, type_ffv_300> AgradCdfParetoType2_ffv_300;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_301> AgradCdfParetoType2_ffv_301;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_302> AgradCdfParetoType2_ffv_302;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_303> AgradCdfParetoType2_ffv_303;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_304> AgradCdfParetoType2_ffv_304;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_305> AgradCdfParetoType2_ffv_305;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_306> AgradCdfParetoType2_ffv_306;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_307> AgradCdfParetoType2_ffv_307;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_308> AgradCdfParetoType2_ffv_308;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_309> AgradCdfParetoType2_ffv_309;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_310> AgradCdfParetoType2_ffv_310;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_311> AgradCdfParetoType2_ffv_311;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_312> AgradCdfParetoType2_ffv_312;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_313> AgradCdfParetoType2_ffv_313;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_314> AgradCdfParetoType2_ffv_314;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_315> AgradCdfParetoType2_ffv_315;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_316> AgradCdfParetoType2_ffv_316;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_317> AgradCdfParetoType2_ffv_317;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_318> AgradCdfParetoType2_ffv_318;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_319> AgradCdfParetoType2_ffv_319;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_320> AgradCdfParetoType2_ffv_320;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_321> AgradCdfParetoType2_ffv_321;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_322> AgradCdfParetoType2_ffv_322;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_323> AgradCdfParetoType2_ffv_323;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_324> AgradCdfParetoType2_ffv_324;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_325> AgradCdfParetoType2_ffv_325;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_326> AgradCdfParetoType2_ffv_326;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_327> AgradCdfParetoType2_ffv_327;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_328> AgradCdfParetoType2_ffv_328;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_329> AgradCdfParetoType2_ffv_329;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_330> AgradCdfParetoType2_ffv_330;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_331> AgradCdfParetoType2_ffv_331;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_332> AgradCdfParetoType2_ffv_332;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_333> AgradCdfParetoType2_ffv_333;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_334> AgradCdfParetoType2_ffv_334;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_335> AgradCdfParetoType2_ffv_335;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_336> AgradCdfParetoType2_ffv_336;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_337> AgradCdfParetoType2_ffv_337;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_338> AgradCdfParetoType2_ffv_338;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_339> AgradCdfParetoType2_ffv_339;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_340> AgradCdfParetoType2_ffv_340;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_341> AgradCdfParetoType2_ffv_341;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_342> AgradCdfParetoType2_ffv_342;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_343> AgradCdfParetoType2_ffv_343;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_344> AgradCdfParetoType2_ffv_344;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_345> AgradCdfParetoType2_ffv_345;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_346> AgradCdfParetoType2_ffv_346;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_347> AgradCdfParetoType2_ffv_347;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_348> AgradCdfParetoType2_ffv_348;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_349> AgradCdfParetoType2_ffv_349;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_350> AgradCdfParetoType2_ffv_350;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_351> AgradCdfParetoType2_ffv_351;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_352> AgradCdfParetoType2_ffv_352;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_353> AgradCdfParetoType2_ffv_353;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_354> AgradCdfParetoType2_ffv_354;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_355> AgradCdfParetoType2_ffv_355;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_356> AgradCdfParetoType2_ffv_356;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_357> AgradCdfParetoType2_ffv_357;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_358> AgradCdfParetoType2_ffv_358;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_359> AgradCdfParetoType2_ffv_359;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_360> AgradCdfParetoType2_ffv_360;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_361> AgradCdfParetoType2_ffv_361;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_362> AgradCdfParetoType2_ffv_362;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_363> AgradCdfParetoType2_ffv_363;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_364> AgradCdfParetoType2_ffv_364;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_365> AgradCdfParetoType2_ffv_365;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_366> AgradCdfParetoType2_ffv_366;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_367> AgradCdfParetoType2_ffv_367;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_368> AgradCdfParetoType2_ffv_368;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_369> AgradCdfParetoType2_ffv_369;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_370> AgradCdfParetoType2_ffv_370;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_371> AgradCdfParetoType2_ffv_371;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_372> AgradCdfParetoType2_ffv_372;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_373> AgradCdfParetoType2_ffv_373;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_374> AgradCdfParetoType2_ffv_374;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_375> AgradCdfParetoType2_ffv_375;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_376> AgradCdfParetoType2_ffv_376;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_377> AgradCdfParetoType2_ffv_377;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_378> AgradCdfParetoType2_ffv_378;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_379> AgradCdfParetoType2_ffv_379;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_380> AgradCdfParetoType2_ffv_380;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_381> AgradCdfParetoType2_ffv_381;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_382> AgradCdfParetoType2_ffv_382;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_383> AgradCdfParetoType2_ffv_383;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_384> AgradCdfParetoType2_ffv_384;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_385> AgradCdfParetoType2_ffv_385;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_386> AgradCdfParetoType2_ffv_386;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_387> AgradCdfParetoType2_ffv_387;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_388> AgradCdfParetoType2_ffv_388;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_389> AgradCdfParetoType2_ffv_389;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_390> AgradCdfParetoType2_ffv_390;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_391> AgradCdfParetoType2_ffv_391;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_392> AgradCdfParetoType2_ffv_392;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_393> AgradCdfParetoType2_ffv_393;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_394> AgradCdfParetoType2_ffv_394;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_395> AgradCdfParetoType2_ffv_395;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_396> AgradCdfParetoType2_ffv_396;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_397> AgradCdfParetoType2_ffv_397;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_398> AgradCdfParetoType2_ffv_398;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_399> AgradCdfParetoType2_ffv_399;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_300, AgradCdfTestFixture, AgradCdfParetoType2_ffv_300);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_301, AgradCdfTestFixture, AgradCdfParetoType2_ffv_301);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_302, AgradCdfTestFixture, AgradCdfParetoType2_ffv_302);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_303, AgradCdfTestFixture, AgradCdfParetoType2_ffv_303);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_304, AgradCdfTestFixture, AgradCdfParetoType2_ffv_304);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_305, AgradCdfTestFixture, AgradCdfParetoType2_ffv_305);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_306, AgradCdfTestFixture, AgradCdfParetoType2_ffv_306);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_307, AgradCdfTestFixture, AgradCdfParetoType2_ffv_307);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_308, AgradCdfTestFixture, AgradCdfParetoType2_ffv_308);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_309, AgradCdfTestFixture, AgradCdfParetoType2_ffv_309);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_310, AgradCdfTestFixture, AgradCdfParetoType2_ffv_310);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_311, AgradCdfTestFixture, AgradCdfParetoType2_ffv_311);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_312, AgradCdfTestFixture, AgradCdfParetoType2_ffv_312);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_313, AgradCdfTestFixture, AgradCdfParetoType2_ffv_313);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_314, AgradCdfTestFixture, AgradCdfParetoType2_ffv_314);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_315, AgradCdfTestFixture, AgradCdfParetoType2_ffv_315);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_316, AgradCdfTestFixture, AgradCdfParetoType2_ffv_316);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_317, AgradCdfTestFixture, AgradCdfParetoType2_ffv_317);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_318, AgradCdfTestFixture, AgradCdfParetoType2_ffv_318);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_319, AgradCdfTestFixture, AgradCdfParetoType2_ffv_319);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_320, AgradCdfTestFixture, AgradCdfParetoType2_ffv_320);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_321, AgradCdfTestFixture, AgradCdfParetoType2_ffv_321);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_322, AgradCdfTestFixture, AgradCdfParetoType2_ffv_322);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_323, AgradCdfTestFixture, AgradCdfParetoType2_ffv_323);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_324, AgradCdfTestFixture, AgradCdfParetoType2_ffv_324);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_325, AgradCdfTestFixture, AgradCdfParetoType2_ffv_325);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_326, AgradCdfTestFixture, AgradCdfParetoType2_ffv_326);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_327, AgradCdfTestFixture, AgradCdfParetoType2_ffv_327);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_328, AgradCdfTestFixture, AgradCdfParetoType2_ffv_328);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_329, AgradCdfTestFixture, AgradCdfParetoType2_ffv_329);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_330, AgradCdfTestFixture, AgradCdfParetoType2_ffv_330);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_331, AgradCdfTestFixture, AgradCdfParetoType2_ffv_331);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_332, AgradCdfTestFixture, AgradCdfParetoType2_ffv_332);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_333, AgradCdfTestFixture, AgradCdfParetoType2_ffv_333);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_334, AgradCdfTestFixture, AgradCdfParetoType2_ffv_334);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_335, AgradCdfTestFixture, AgradCdfParetoType2_ffv_335);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_336, AgradCdfTestFixture, AgradCdfParetoType2_ffv_336);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_337, AgradCdfTestFixture, AgradCdfParetoType2_ffv_337);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_338, AgradCdfTestFixture, AgradCdfParetoType2_ffv_338);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_339, AgradCdfTestFixture, AgradCdfParetoType2_ffv_339);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_340, AgradCdfTestFixture, AgradCdfParetoType2_ffv_340);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_341, AgradCdfTestFixture, AgradCdfParetoType2_ffv_341);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_342, AgradCdfTestFixture, AgradCdfParetoType2_ffv_342);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_343, AgradCdfTestFixture, AgradCdfParetoType2_ffv_343);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_344, AgradCdfTestFixture, AgradCdfParetoType2_ffv_344);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_345, AgradCdfTestFixture, AgradCdfParetoType2_ffv_345);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_346, AgradCdfTestFixture, AgradCdfParetoType2_ffv_346);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_347, AgradCdfTestFixture, AgradCdfParetoType2_ffv_347);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_348, AgradCdfTestFixture, AgradCdfParetoType2_ffv_348);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_349, AgradCdfTestFixture, AgradCdfParetoType2_ffv_349);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_350, AgradCdfTestFixture, AgradCdfParetoType2_ffv_350);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_351, AgradCdfTestFixture, AgradCdfParetoType2_ffv_351);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_352, AgradCdfTestFixture, AgradCdfParetoType2_ffv_352);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_353, AgradCdfTestFixture, AgradCdfParetoType2_ffv_353);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_354, AgradCdfTestFixture, AgradCdfParetoType2_ffv_354);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_355, AgradCdfTestFixture, AgradCdfParetoType2_ffv_355);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_356, AgradCdfTestFixture, AgradCdfParetoType2_ffv_356);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_357, AgradCdfTestFixture, AgradCdfParetoType2_ffv_357);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_358, AgradCdfTestFixture, AgradCdfParetoType2_ffv_358);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_359, AgradCdfTestFixture, AgradCdfParetoType2_ffv_359);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_360, AgradCdfTestFixture, AgradCdfParetoType2_ffv_360);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_361, AgradCdfTestFixture, AgradCdfParetoType2_ffv_361);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_362, AgradCdfTestFixture, AgradCdfParetoType2_ffv_362);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_363, AgradCdfTestFixture, AgradCdfParetoType2_ffv_363);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_364, AgradCdfTestFixture, AgradCdfParetoType2_ffv_364);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_365, AgradCdfTestFixture, AgradCdfParetoType2_ffv_365);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_366, AgradCdfTestFixture, AgradCdfParetoType2_ffv_366);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_367, AgradCdfTestFixture, AgradCdfParetoType2_ffv_367);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_368, AgradCdfTestFixture, AgradCdfParetoType2_ffv_368);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_369, AgradCdfTestFixture, AgradCdfParetoType2_ffv_369);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_370, AgradCdfTestFixture, AgradCdfParetoType2_ffv_370);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_371, AgradCdfTestFixture, AgradCdfParetoType2_ffv_371);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_372, AgradCdfTestFixture, AgradCdfParetoType2_ffv_372);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_373, AgradCdfTestFixture, AgradCdfParetoType2_ffv_373);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_374, AgradCdfTestFixture, AgradCdfParetoType2_ffv_374);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_375, AgradCdfTestFixture, AgradCdfParetoType2_ffv_375);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_376, AgradCdfTestFixture, AgradCdfParetoType2_ffv_376);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_377, AgradCdfTestFixture, AgradCdfParetoType2_ffv_377);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_378, AgradCdfTestFixture, AgradCdfParetoType2_ffv_378);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_379, AgradCdfTestFixture, AgradCdfParetoType2_ffv_379);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_380, AgradCdfTestFixture, AgradCdfParetoType2_ffv_380);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_381, AgradCdfTestFixture, AgradCdfParetoType2_ffv_381);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_382, AgradCdfTestFixture, AgradCdfParetoType2_ffv_382);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_383, AgradCdfTestFixture, AgradCdfParetoType2_ffv_383);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_384, AgradCdfTestFixture, AgradCdfParetoType2_ffv_384);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_385, AgradCdfTestFixture, AgradCdfParetoType2_ffv_385);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_386, AgradCdfTestFixture, AgradCdfParetoType2_ffv_386);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_387, AgradCdfTestFixture, AgradCdfParetoType2_ffv_387);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_388, AgradCdfTestFixture, AgradCdfParetoType2_ffv_388);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_389, AgradCdfTestFixture, AgradCdfParetoType2_ffv_389);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_390, AgradCdfTestFixture, AgradCdfParetoType2_ffv_390);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_391, AgradCdfTestFixture, AgradCdfParetoType2_ffv_391);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_392, AgradCdfTestFixture, AgradCdfParetoType2_ffv_392);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_393, AgradCdfTestFixture, AgradCdfParetoType2_ffv_393);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_394, AgradCdfTestFixture, AgradCdfParetoType2_ffv_394);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_395, AgradCdfTestFixture, AgradCdfParetoType2_ffv_395);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_396, AgradCdfTestFixture, AgradCdfParetoType2_ffv_396);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_397, AgradCdfTestFixture, AgradCdfParetoType2_ffv_397);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_398, AgradCdfTestFixture, AgradCdfParetoType2_ffv_398);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_399, AgradCdfTestFixture, AgradCdfParetoType2_ffv_399);
+
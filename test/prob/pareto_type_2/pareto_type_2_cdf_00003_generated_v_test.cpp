@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_cdf_test.hpp>
+
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_300;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_301;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_302;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_303;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_304;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_305;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_306;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_307;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_308;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_309;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_310;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_311;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_312;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_313;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_314;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_315;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_316;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_317;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_318;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_319;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_320;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_321;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_322;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_323;
+typedef std::tuple<std::vector<double>, var, double, double, empty, empty> type_v_324;
+typedef std::tuple<std::vector<double>, var, double, std::vector<double>, empty, empty> type_v_325;
+typedef std::tuple<std::vector<double>, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_326;
+typedef std::tuple<std::vector<double>, var, double, var, empty, empty> type_v_327;
+typedef std::tuple<std::vector<double>, var, double, std::vector<var>, empty, empty> type_v_328;
+typedef std::tuple<std::vector<double>, var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_329;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, double, empty, empty> type_v_330;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, std::vector<double>, empty, empty> type_v_331;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_332;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, var, empty, empty> type_v_333;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, std::vector<var>, empty, empty> type_v_334;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_335;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_336;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_337;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_338;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_339;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_340;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_341;
+typedef std::tuple<std::vector<double>, var, var, double, empty, empty> type_v_342;
+typedef std::tuple<std::vector<double>, var, var, std::vector<double>, empty, empty> type_v_343;
+typedef std::tuple<std::vector<double>, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_344;
+typedef std::tuple<std::vector<double>, var, var, var, empty, empty> type_v_345;
+typedef std::tuple<std::vector<double>, var, var, std::vector<var>, empty, empty> type_v_346;
+typedef std::tuple<std::vector<double>, var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_347;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, double, empty, empty> type_v_348;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, std::vector<double>, empty, empty> type_v_349;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_350;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, var, empty, empty> type_v_351;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, std::vector<var>, empty, empty> type_v_352;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_353;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_354;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_355;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_356;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_357;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_358;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_359;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, double, empty, empty> type_v_360;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, std::vector<double>, empty, empty> type_v_361;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_362;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, var, empty, empty> type_v_363;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, std::vector<var>, empty, empty> type_v_364;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_365;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, double, empty, empty> type_v_366;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_v_367;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_368;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, var, empty, empty> type_v_369;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_v_370;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_371;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_372;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_373;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_374;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_375;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_376;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_377;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, double, empty, empty> type_v_378;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, std::vector<double>, empty, empty> type_v_379;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_380;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, var, empty, empty> type_v_381;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, std::vector<var>, empty, empty> type_v_382;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_383;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, double, empty, empty> type_v_384;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_v_385;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_386;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, var, empty, empty> type_v_387;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_v_388;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_389;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_390;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_391;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_392;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_393;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_394;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_395;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_396;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_397;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_398;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_399;
+
+typedef std::tuple<AgradCdfParetoType2, type_v_300> AgradCdfParetoType2_v_300;
+typedef std::tuple<AgradCdfParetoType2, type_v_301> AgradCdfParetoType2_v_301;
+typedef std::tuple<AgradCdfParetoType2, type_v_302> AgradCdfParetoType2_v_302;
+typedef std::tuple<AgradCdfParetoType2, type_v_303> AgradCdfParetoType2_v_303;
+typedef std::tuple<AgradCdfParetoType2, type_v_304> AgradCdfParetoType2_v_304;
+typedef std::tuple<AgradCdfParetoType2, type_v_305> AgradCdfParetoType2_v_305;
+typedef std::tuple<AgradCdfParetoType2, type_v_306> AgradCdfParetoType2_v_306;
+typedef std::tuple<AgradCdfParetoType2, type_v_307> AgradCdfParetoType2_v_307;
+typedef std::tuple<AgradCdfParetoType2, type_v_308> AgradCdfParetoType2_v_308;
+typedef std::tuple<AgradCdfParetoType2, type_v_309> AgradCdfParetoType2_v_309;
+typedef std::tuple<AgradCdfParetoType2, type_v_310> AgradCdfParetoType2_v_310;
+typedef std::tuple<AgradCdfParetoType2, type_v_311> AgradCdfParetoType2_v_311;
+typedef std::tuple<AgradCdfParetoType2, type_v_312> AgradCdfParetoType2_v_312;
+typedef std::tuple<AgradCdfParetoType2, type_v_313> AgradCdfParetoType2_v_313;
+typedef std::tuple<AgradCdfParetoType2, type_v_314> AgradCdfParetoType2_v_314;
+typedef std::tuple<AgradCdfParetoType2, type_v_315> AgradCdfParetoType2_v_315;
+typedef std::tuple<AgradCdfParetoType2, type_v_316> AgradCdfParetoType2_v_316;
+typedef std::tuple<AgradCdfParetoType2, type_v_317> AgradCdfParetoType2_v_317;
+typedef std::tuple<AgradCdfParetoType2, type_v_318> AgradCdfParetoType2_v_318;
+typedef std::tuple<AgradCdfParetoType2, type_v_319> AgradCdfParetoType2_v_319;
+typedef std::tuple<AgradCdfParetoType2, type_v_320> AgradCdfParetoType2_v_320;
+typedef std::tuple<AgradCdfParetoType2, type_v_321> AgradCdfParetoType2_v_321;
+typedef std::tuple<AgradCdfParetoType2, type_v_322> AgradCdfParetoType2_v_322;
+typedef std::tuple<AgradCdfParetoType2, type_v_323> AgradCdfParetoType2_v_323;
+typedef std::tuple<AgradCdfParetoType2, type_v_324> AgradCdfParetoType2_v_324;
+typedef std::tuple<AgradCdfParetoType2, type_v_325> AgradCdfParetoType2_v_325;
+typedef std::tuple<AgradCdfParetoType2, type_v_326> AgradCdfParetoType2_v_326;
+typedef std::tuple<AgradCdfParetoType2, type_v_327> AgradCdfParetoType2_v_327;
+typedef std::tuple<AgradCdfParetoType2, type_v_328> AgradCdfParetoType2_v_328;
+typedef std::tuple<AgradCdfParetoType2, type_v_329> AgradCdfParetoType2_v_329;
+typedef std::tuple<AgradCdfParetoType2, type_v_330> AgradCdfParetoType2_v_330;
+typedef std::tuple<AgradCdfParetoType2, type_v_331> AgradCdfParetoType2_v_331;
+typedef std::tuple<AgradCdfParetoType2, type_v_332> AgradCdfParetoType2_v_332;
+typedef std::tuple<AgradCdfParetoType2, type_v_333> AgradCdfParetoType2_v_333;
+typedef std::tuple<AgradCdfParetoType2, type_v_334> AgradCdfParetoType2_v_334;
+typedef std::tuple<AgradCdfParetoType2, type_v_335> AgradCdfParetoType2_v_335;
+typedef std::tuple<AgradCdfParetoType2, type_v_336> AgradCdfParetoType2_v_336;
+typedef std::tuple<AgradCdfParetoType2, type_v_337> AgradCdfParetoType2_v_337;
+typedef std::tuple<AgradCdfParetoType2, type_v_338> AgradCdfParetoType2_v_338;
+typedef std::tuple<AgradCdfParetoType2, type_v_339> AgradCdfParetoType2_v_339;
+typedef std::tuple<AgradCdfParetoType2, type_v_340> AgradCdfParetoType2_v_340;
+typedef std::tuple<AgradCdfParetoType2, type_v_341> AgradCdfParetoType2_v_341;
+typedef std::tuple<AgradCdfParetoType2, type_v_342> AgradCdfParetoType2_v_342;
+typedef std::tuple<AgradCdfParetoType2, type_v_343> AgradCdfParetoType2_v_343;
+typedef std::tuple<AgradCdfParetoType2, type_v_344> AgradCdfParetoType2_v_344;
+typedef std::tuple<AgradCdfParetoType2, type_v_345> AgradCdfParetoType2_v_345;
+typedef std::tuple<AgradCdfParetoType2, type_v_346> AgradCdfParetoType2_v_346;
+typedef std::tuple<AgradCdfParetoType2, type_v_347> AgradCdfParetoType2_v_347;
+typedef std::tuple<AgradCdfParetoType2, type_v_348> AgradCdfParetoType2_v_348;
+typedef std::tuple<AgradCdfParetoType2, type_v_349> AgradCdfParetoType2_v_349;
+typedef std::tuple<AgradCdfParetoType2, type_v_350> AgradCdfParetoType2_v_350;
+typedef std::tuple<AgradCdfParetoType2, type_v_351> AgradCdfParetoType2_v_351;
+typedef std::tuple<AgradCdfParetoType2, type_v_352> AgradCdfParetoType2_v_352;
+typedef std::tuple<AgradCdfParetoType2, type_v_353> AgradCdfParetoType2_v_353;
+typedef std::tuple<AgradCdfParetoType2, type_v_354> AgradCdfParetoType2_v_354;
+typedef std::tuple<AgradCdfParetoType2, type_v_355> AgradCdfParetoType2_v_355;
+typedef std::tuple<AgradCdfParetoType2, type_v_356> AgradCdfParetoType2_v_356;
+typedef std::tuple<AgradCdfParetoType2, type_v_357> AgradCdfParetoType2_v_357;
+typedef std::tuple<AgradCdfParetoType2, type_v_358> AgradCdfParetoType2_v_358;
+typedef std::tuple<AgradCdfParetoType2, type_v_359> AgradCdfParetoType2_v_359;
+typedef std::tuple<AgradCdfParetoType2, type_v_360> AgradCdfParetoType2_v_360;
+typedef std::tuple<AgradCdfParetoType2, type_v_361> AgradCdfParetoType2_v_361;
+typedef std::tuple<AgradCdfParetoType2, type_v_362> AgradCdfParetoType2_v_362;
+typedef std::tuple<AgradCdfParetoType2, type_v_363> AgradCdfParetoType2_v_363;
+typedef std::tuple<AgradCdfParetoType2, type_v_364> AgradCdfParetoType2_v_364;
+typedef std::tuple<AgradCdfParetoType2, type_v_365> AgradCdfParetoType2_v_365;
+typedef std::tuple<AgradCdfParetoType2, type_v_366> AgradCdfParetoType2_v_366;
+typedef std::tuple<AgradCdfParetoType2, type_v_367> AgradCdfParetoType2_v_367;
+typedef std::tuple<AgradCdfParetoType2, type_v_368> AgradCdfParetoType2_v_368;
+typedef std::tuple<AgradCdfParetoType2, type_v_369> AgradCdfParetoType2_v_369;
+typedef std::tuple<AgradCdfParetoType2, type_v_370> AgradCdfParetoType2_v_370;
+typedef std::tuple<AgradCdfParetoType2, type_v_371> AgradCdfParetoType2_v_371;
+typedef std::tuple<AgradCdfParetoType2, type_v_372> AgradCdfParetoType2_v_372;
+typedef std::tuple<AgradCdfParetoType2, type_v_373> AgradCdfParetoType2_v_373;
+typedef std::tuple<AgradCdfParetoType2, type_v_374> AgradCdfParetoType2_v_374;
+typedef std::tuple<AgradCdfParetoType2, type_v_375> AgradCdfParetoType2_v_375;
+typedef std::tuple<AgradCdfParetoType2, type_v_376> AgradCdfParetoType2_v_376;
+typedef std::tuple<AgradCdfParetoType2, type_v_377> AgradCdfParetoType2_v_377;
+typedef std::tuple<AgradCdfParetoType2, type_v_378> AgradCdfParetoType2_v_378;
+typedef std::tuple<AgradCdfParetoType2, type_v_379> AgradCdfParetoType2_v_379;
+typedef std::tuple<AgradCdfParetoType2, type_v_380> AgradCdfParetoType2_v_380;
+typedef std::tuple<AgradCdfParetoType2, type_v_381> AgradCdfParetoType2_v_381;
+typedef std::tuple<AgradCdfParetoType2, type_v_382> AgradCdfParetoType2_v_382;
+typedef std::tuple<AgradCdfParetoType2, type_v_383> AgradCdfParetoType2_v_383;
+typedef std::tuple<AgradCdfParetoType2, type_v_384> AgradCdfParetoType2_v_384;
+typedef std::tuple<AgradCdfParetoType2, type_v_385> AgradCdfParetoType2_v_385;
+typedef std::tuple<AgradCdfParetoType2, type_v_386> AgradCdfParetoType2_v_386;
+typedef std::tuple<AgradCdfParetoType2, type_v_387> AgradCdfParetoType2_v_387;
+typedef std::tuple<AgradCdfParetoType2, type_v_388> AgradCdfParetoType2_v_388;
+typedef std::tuple<AgradCdfParetoType2, type_v_389> AgradCdfParetoType2_v_389;
+typedef std::tuple<AgradCdfParetoType2, type_v_390> AgradCdfParetoType2_v_390;
+typedef std::tuple<AgradCdfParetoType2, type_v_391> AgradCdfParetoType2_v_391;
+typedef std::tuple<AgradCdfParetoType2, type_v_392> AgradCdfParetoType2_v_392;
+typedef std::tuple<AgradCdfParetoType2, type_v_393> AgradCdfParetoType2_v_393;
+typedef std::tuple<AgradCdfParetoType2, type_v_394> AgradCdfParetoType2_v_394;
+typedef std::tuple<AgradCdfParetoType2, type_v_395> AgradCdfParetoType2_v_395;
+typedef std::tuple<AgradCdfParetoType2, type_v_396> AgradCdfParetoType2_v_396;
+typedef std::tuple<AgradCdfParetoType2, type_v_397> AgradCdfParetoType2_v_397;
+typedef std::tuple<AgradCdfParetoType2, type_v_398> AgradCdfParetoType2_v_398;
+typedef std::tuple<AgradCdfParetoType2, type_v_399> AgradCdfParetoType2_v_399;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_300, AgradCdfTestFixture, AgradCdfParetoType2_v_300);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_301, AgradCdfTestFixture, AgradCdfParetoType2_v_301);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_302, AgradCdfTestFixture, AgradCdfParetoType2_v_302);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_303, AgradCdfTestFixture, AgradCdfParetoType2_v_303);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_304, AgradCdfTestFixture, AgradCdfParetoType2_v_304);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_305, AgradCdfTestFixture, AgradCdfParetoType2_v_305);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_306, AgradCdfTestFixture, AgradCdfParetoType2_v_306);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_307, AgradCdfTestFixture, AgradCdfParetoType2_v_307);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_308, AgradCdfTestFixture, AgradCdfParetoType2_v_308);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_309, AgradCdfTestFixture, AgradCdfParetoType2_v_309);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_310, AgradCdfTestFixture, AgradCdfParetoType2_v_310);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_311, AgradCdfTestFixture, AgradCdfParetoType2_v_311);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_312, AgradCdfTestFixture, AgradCdfParetoType2_v_312);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_313, AgradCdfTestFixture, AgradCdfParetoType2_v_313);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_314, AgradCdfTestFixture, AgradCdfParetoType2_v_314);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_315, AgradCdfTestFixture, AgradCdfParetoType2_v_315);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_316, AgradCdfTestFixture, AgradCdfParetoType2_v_316);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_317, AgradCdfTestFixture, AgradCdfParetoType2_v_317);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_318, AgradCdfTestFixture, AgradCdfParetoType2_v_318);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_319, AgradCdfTestFixture, AgradCdfParetoType2_v_319);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_320, AgradCdfTestFixture, AgradCdfParetoType2_v_320);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_321, AgradCdfTestFixture, AgradCdfParetoType2_v_321);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_322, AgradCdfTestFixture, AgradCdfParetoType2_v_322);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_323, AgradCdfTestFixture, AgradCdfParetoType2_v_323);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_324, AgradCdfTestFixture, AgradCdfParetoType2_v_324);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_325, AgradCdfTestFixture, AgradCdfParetoType2_v_325);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_326, AgradCdfTestFixture, AgradCdfParetoType2_v_326);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_327, AgradCdfTestFixture, AgradCdfParetoType2_v_327);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_328, AgradCdfTestFixture, AgradCdfParetoType2_v_328);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_329, AgradCdfTestFixture, AgradCdfParetoType2_v_329);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_330, AgradCdfTestFixture, AgradCdfParetoType2_v_330);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_331, AgradCdfTestFixture, AgradCdfParetoType2_v_331);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_332, AgradCdfTestFixture, AgradCdfParetoType2_v_332);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_333, AgradCdfTestFixture, AgradCdfParetoType2_v_333);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_334, AgradCdfTestFixture, AgradCdfParetoType2_v_334);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_335, AgradCdfTestFixture, AgradCdfParetoType2_v_335);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_336, AgradCdfTestFixture, AgradCdfParetoType2_v_336);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_337, AgradCdfTestFixture, AgradCdfParetoType2_v_337);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_338, AgradCdfTestFixture, AgradCdfParetoType2_v_338);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_339, AgradCdfTestFixture, AgradCdfParetoType2_v_339);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_340, AgradCdfTestFixture, AgradCdfParetoType2_v_340);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_341, AgradCdfTestFixture, AgradCdfParetoType2_v_341);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_342, AgradCdfTestFixture, AgradCdfParetoType2_v_342);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_343, AgradCdfTestFixture, AgradCdfParetoType2_v_343);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_344, AgradCdfTestFixture, AgradCdfParetoType2_v_344);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_345, AgradCdfTestFixture, AgradCdfParetoType2_v_345);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_346, AgradCdfTestFixture, AgradCdfParetoType2_v_346);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_347, AgradCdfTestFixture, AgradCdfParetoType2_v_347);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_348, AgradCdfTestFixture, AgradCdfParetoType2_v_348);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_349, AgradCdfTestFixture, AgradCdfParetoType2_v_349);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_350, AgradCdfTestFixture, AgradCdfParetoType2_v_350);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_351, AgradCdfTestFixture, AgradCdfParetoType2_v_351);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_352, AgradCdfTestFixture, AgradCdfParetoType2_v_352);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_353, AgradCdfTestFixture, AgradCdfParetoType2_v_353);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_354, AgradCdfTestFixture, AgradCdfParetoType2_v_354);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_355, AgradCdfTestFixture, AgradCdfParetoType2_v_355);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_356, AgradCdfTestFixture, AgradCdfParetoType2_v_356);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_357, AgradCdfTestFixture, AgradCdfParetoType2_v_357);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_358, AgradCdfTestFixture, AgradCdfParetoType2_v_358);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_359, AgradCdfTestFixture, AgradCdfParetoType2_v_359);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_360, AgradCdfTestFixture, AgradCdfParetoType2_v_360);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_361, AgradCdfTestFixture, AgradCdfParetoType2_v_361);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_362, AgradCdfTestFixture, AgradCdfParetoType2_v_362);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_363, AgradCdfTestFixture, AgradCdfParetoType2_v_363);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_364, AgradCdfTestFixture, AgradCdfParetoType2_v_364);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_365, AgradCdfTestFixture, AgradCdfParetoType2_v_365);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_366, AgradCdfTestFixture, AgradCdfParetoType2_v_366);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_367, AgradCdfTestFixture, AgradCdfParetoType2_v_367);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_368, AgradCdfTestFixture, AgradCdfParetoType2_v_368);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_369, AgradCdfTestFixture, AgradCdfParetoType2_v_369);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_370, AgradCdfTestFixture, AgradCdfParetoType2_v_370);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_371, AgradCdfTestFixture, AgradCdfParetoType2_v_371);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_372, AgradCdfTestFixture, AgradCdfParetoType2_v_372);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_373, AgradCdfTestFixture, AgradCdfParetoType2_v_373);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_374, AgradCdfTestFixture, AgradCdfParetoType2_v_374);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_375, AgradCdfTestFixture, AgradCdfParetoType2_v_375);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_376, AgradCdfTestFixture, AgradCdfParetoType2_v_376);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_377, AgradCdfTestFixture, AgradCdfParetoType2_v_377);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_378, AgradCdfTestFixture, AgradCdfParetoType2_v_378);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_379, AgradCdfTestFixture, AgradCdfParetoType2_v_379);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_380, AgradCdfTestFixture, AgradCdfParetoType2_v_380);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_381, AgradCdfTestFixture, AgradCdfParetoType2_v_381);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_382, AgradCdfTestFixture, AgradCdfParetoType2_v_382);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_383, AgradCdfTestFixture, AgradCdfParetoType2_v_383);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_384, AgradCdfTestFixture, AgradCdfParetoType2_v_384);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_385, AgradCdfTestFixture, AgradCdfParetoType2_v_385);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_386, AgradCdfTestFixture, AgradCdfParetoType2_v_386);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_387, AgradCdfTestFixture, AgradCdfParetoType2_v_387);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_388, AgradCdfTestFixture, AgradCdfParetoType2_v_388);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_389, AgradCdfTestFixture, AgradCdfParetoType2_v_389);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_390, AgradCdfTestFixture, AgradCdfParetoType2_v_390);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_391, AgradCdfTestFixture, AgradCdfParetoType2_v_391);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_392, AgradCdfTestFixture, AgradCdfParetoType2_v_392);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_393, AgradCdfTestFixture, AgradCdfParetoType2_v_393);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_394, AgradCdfTestFixture, AgradCdfParetoType2_v_394);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_395, AgradCdfTestFixture, AgradCdfParetoType2_v_395);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_396, AgradCdfTestFixture, AgradCdfParetoType2_v_396);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_397, AgradCdfTestFixture, AgradCdfParetoType2_v_397);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_398, AgradCdfTestFixture, AgradCdfParetoType2_v_398);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_399, AgradCdfTestFixture, AgradCdfParetoType2_v_399);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_cdf_test.hpp>
+
+typedef std::tuple<std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_300;
+typedef std::tuple<std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_301;
+typedef std::tuple<std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_302;
+typedef std::tuple<std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_303;
+typedef std::tuple<std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_304;
+typedef std::tuple<std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_305;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, double, empty, empty> type_vv_306;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, std::vector<double>, empty, empty> type_vv_307;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_308;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, var, empty, empty> type_vv_309;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, std::vector<var>, empty, empty> type_vv_310;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_311;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, double, empty, empty> type_vv_312;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_vv_313;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_314;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, var, empty, empty> type_vv_315;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_vv_316;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_317;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_318;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_319;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_320;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_321;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_322;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_323;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, double, empty, empty> type_vv_324;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, std::vector<double>, empty, empty> type_vv_325;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_326;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, var, empty, empty> type_vv_327;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, std::vector<var>, empty, empty> type_vv_328;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_329;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, double, empty, empty> type_vv_330;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_vv_331;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_332;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, var, empty, empty> type_vv_333;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_vv_334;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_335;
+typedef std::tuple<std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_336;
+typedef std::tuple<std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_337;
+typedef std::tuple<std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_338;
+typedef std::tuple<std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_339;
+typedef std::tuple<std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_340;
+typedef std::tuple<std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_341;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, empty, empty> type_vv_342;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, empty, empty> type_vv_343;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_344;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, empty, empty> type_vv_345;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, empty, empty> type_vv_346;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_347;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, empty, empty> type_vv_348;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, empty, empty> type_vv_349;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_350;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, empty, empty> type_vv_351;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, empty, empty> type_vv_352;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_353;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_354;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_355;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_356;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_357;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_358;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_359;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, empty, empty> type_vv_360;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, empty, empty> type_vv_361;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_362;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, empty, empty> type_vv_363;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, empty, empty> type_vv_364;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_365;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, empty, empty> type_vv_366;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, empty, empty> type_vv_367;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_368;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, empty, empty> type_vv_369;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, empty, empty> type_vv_370;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_371;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_372;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_373;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_374;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_375;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_376;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_377;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, var, empty, empty> type_vv_378;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, std::vector<var>, empty, empty> type_vv_379;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_380;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, var, empty, empty> type_vv_381;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, std::vector<var>, empty, empty> type_vv_382;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_383;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_384;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_385;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_386;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, double, empty, empty> type_vv_387;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, std::vector<double>, empty, empty> type_vv_388;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_389;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, var, empty, empty> type_vv_390;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, std::vector<var>, empty, empty> type_vv_391;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_392;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, double, empty, empty> type_vv_393;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, std::vector<double>, empty, empty> type_vv_394;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_395;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, var, empty, empty> type_vv_396;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, std::vector<var>, empty, empty> type_vv_397;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_398;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_399;
+
+typedef std::tuple<AgradCdfParetoType2, type_vv_300> AgradCdfParetoType2_vv_300;
+typedef std::tuple<AgradCdfParetoType2, type_vv_301> AgradCdfParetoType2_vv_301;
+typedef std::tuple<AgradCdfParetoType2, type_vv_302> AgradCdfParetoType2_vv_302;
+typedef std::tuple<AgradCdfParetoType2, type_vv_303> AgradCdfParetoType2_vv_303;
+typedef std::tuple<AgradCdfParetoType2, type_vv_304> AgradCdfParetoType2_vv_304;
+typedef std::tuple<AgradCdfParetoType2, type_vv_305> AgradCdfParetoType2_vv_305;
+typedef std::tuple<AgradCdfParetoType2, type_vv_306> AgradCdfParetoType2_vv_306;
+typedef std::tuple<AgradCdfParetoType2, type_vv_307> AgradCdfParetoType2_vv_307;
+typedef std::tuple<AgradCdfParetoType2, type_vv_308> AgradCdfParetoType2_vv_308;
+typedef std::tuple<AgradCdfParetoType2, type_vv_309> AgradCdfParetoType2_vv_309;
+typedef std::tuple<AgradCdfParetoType2, type_vv_310> AgradCdfParetoType2_vv_310;
+typedef std::tuple<AgradCdfParetoType2, type_vv_311> AgradCdfParetoType2_vv_311;
+typedef std::tuple<AgradCdfParetoType2, type_vv_312> AgradCdfParetoType2_vv_312;
+typedef std::tuple<AgradCdfParetoType2, type_vv_313> AgradCdfParetoType2_vv_313;
+typedef std::tuple<AgradCdfParetoType2, type_vv_314> AgradCdfParetoType2_vv_314;
+typedef std::tuple<AgradCdfParetoType2, type_vv_315> AgradCdfParetoType2_vv_315;
+typedef std::tuple<AgradCdfParetoType2, type_vv_316> AgradCdfParetoType2_vv_316;
+typedef std::tuple<AgradCdfParetoType2, type_vv_317> AgradCdfParetoType2_vv_317;
+typedef std::tuple<AgradCdfParetoType2, type_vv_318> AgradCdfParetoType2_vv_318;
+typedef std::tuple<AgradCdfParetoType2, type_vv_319> AgradCdfParetoType2_vv_319;
+typedef std::tuple<AgradCdfParetoType2, type_vv_320> AgradCdfParetoType2_vv_320;
+typedef std::tuple<AgradCdfParetoType2, type_vv_321> AgradCdfParetoType2_vv_321;
+typedef std::tuple<AgradCdfParetoType2, type_vv_322> AgradCdfParetoType2_vv_322;
+typedef std::tuple<AgradCdfParetoType2, type_vv_323> AgradCdfParetoType2_vv_323;
+typedef std::tuple<AgradCdfParetoType2, type_vv_324> AgradCdfParetoType2_vv_324;
+typedef std::tuple<AgradCdfParetoType2, type_vv_325> AgradCdfParetoType2_vv_325;
+typedef std::tuple<AgradCdfParetoType2, type_vv_326> AgradCdfParetoType2_vv_326;
+typedef std::tuple<AgradCdfParetoType2, type_vv_327> AgradCdfParetoType2_vv_327;
+typedef std::tuple<AgradCdfParetoType2, type_vv_328> AgradCdfParetoType2_vv_328;
+typedef std::tuple<AgradCdfParetoType2, type_vv_329> AgradCdfParetoType2_vv_329;
+typedef std::tuple<AgradCdfParetoType2, type_vv_330> AgradCdfParetoType2_vv_330;
+typedef std::tuple<AgradCdfParetoType2, type_vv_331> AgradCdfParetoType2_vv_331;
+typedef std::tuple<AgradCdfParetoType2, type_vv_332> AgradCdfParetoType2_vv_332;
+typedef std::tuple<AgradCdfParetoType2, type_vv_333> AgradCdfParetoType2_vv_333;
+typedef std::tuple<AgradCdfParetoType2, type_vv_334> AgradCdfParetoType2_vv_334;
+typedef std::tuple<AgradCdfParetoType2, type_vv_335> AgradCdfParetoType2_vv_335;
+typedef std::tuple<AgradCdfParetoType2, type_vv_336> AgradCdfParetoType2_vv_336;
+typedef std::tuple<AgradCdfParetoType2, type_vv_337> AgradCdfParetoType2_vv_337;
+typedef std::tuple<AgradCdfParetoType2, type_vv_338> AgradCdfParetoType2_vv_338;
+typedef std::tuple<AgradCdfParetoType2, type_vv_339> AgradCdfParetoType2_vv_339;
+typedef std::tuple<AgradCdfParetoType2, type_vv_340> AgradCdfParetoType2_vv_340;
+typedef std::tuple<AgradCdfParetoType2, type_vv_341> AgradCdfParetoType2_vv_341;
+typedef std::tuple<AgradCdfParetoType2, type_vv_342> AgradCdfParetoType2_vv_342;
+typedef std::tuple<AgradCdfParetoType2, type_vv_343> AgradCdfParetoType2_vv_343;
+typedef std::tuple<AgradCdfParetoType2, type_vv_344> AgradCdfParetoType2_vv_344;
+typedef std::tuple<AgradCdfParetoType2, type_vv_345> AgradCdfParetoType2_vv_345;
+typedef std::tuple<AgradCdfParetoType2, type_vv_346> AgradCdfParetoType2_vv_346;
+typedef std::tuple<AgradCdfParetoType2, type_vv_347> AgradCdfParetoType2_vv_347;
+typedef std::tuple<AgradCdfParetoType2, type_vv_348> AgradCdfParetoType2_vv_348;
+typedef std::tuple<AgradCdfParetoType2, type_vv_349> AgradCdfParetoType2_vv_349;
+typedef std::tuple<AgradCdfParetoType2, type_vv_350> AgradCdfParetoType2_vv_350;
+typedef std::tuple<AgradCdfParetoType2, type_vv_351> AgradCdfParetoType2_vv_351;
+typedef std::tuple<AgradCdfParetoType2, type_vv_352> AgradCdfParetoType2_vv_352;
+typedef std::tuple<AgradCdfParetoType2, type_vv_353> AgradCdfParetoType2_vv_353;
+typedef std::tuple<AgradCdfParetoType2, type_vv_354> AgradCdfParetoType2_vv_354;
+typedef std::tuple<AgradCdfParetoType2, type_vv_355> AgradCdfParetoType2_vv_355;
+typedef std::tuple<AgradCdfParetoType2, type_vv_356> AgradCdfParetoType2_vv_356;
+typedef std::tuple<AgradCdfParetoType2, type_vv_357> AgradCdfParetoType2_vv_357;
+typedef std::tuple<AgradCdfParetoType2, type_vv_358> AgradCdfParetoType2_vv_358;
+typedef std::tuple<AgradCdfParetoType2, type_vv_359> AgradCdfParetoType2_vv_359;
+typedef std::tuple<AgradCdfParetoType2, type_vv_360> AgradCdfParetoType2_vv_360;
+typedef std::tuple<AgradCdfParetoType2, type_vv_361> AgradCdfParetoType2_vv_361;
+typedef std::tuple<AgradCdfParetoType2, type_vv_362> AgradCdfParetoType2_vv_362;
+typedef std::tuple<AgradCdfParetoType2, type_vv_363> AgradCdfParetoType2_vv_363;
+typedef std::tuple<AgradCdfParetoType2, type_vv_364> AgradCdfParetoType2_vv_364;
+typedef std::tuple<AgradCdfParetoType2, type_vv_365> AgradCdfParetoType2_vv_365;
+typedef std::tuple<AgradCdfParetoType2, type_vv_366> AgradCdfParetoType2_vv_366;
+typedef std::tuple<AgradCdfParetoType2, type_vv_367> AgradCdfParetoType2_vv_367;
+typedef std::tuple<AgradCdfParetoType2, type_vv_368> AgradCdfParetoType2_vv_368;
+typedef std::tuple<AgradCdfParetoType2, type_vv_369> AgradCdfParetoType2_vv_369;
+typedef std::tuple<AgradCdfParetoType2, type_vv_370> AgradCdfParetoType2_vv_370;
+typedef std::tuple<AgradCdfParetoType2, type_vv_371> AgradCdfParetoType2_vv_371;
+typedef std::tuple<AgradCdfParetoType2, type_vv_372> AgradCdfParetoType2_vv_372;
+typedef std::tuple<AgradCdfParetoType2, type_vv_373> AgradCdfParetoType2_vv_373;
+typedef std::tuple<AgradCdfParetoType2, type_vv_374> AgradCdfParetoType2_vv_374;
+typedef std::tuple<AgradCdfParetoType2, type_vv_375> AgradCdfParetoType2_vv_375;
+typedef std::tuple<AgradCdfParetoType2, type_vv_376> AgradCdfParetoType2_vv_376;
+typedef std::tuple<AgradCdfParetoType2, type_vv_377> AgradCdfParetoType2_vv_377;
+typedef std::tuple<AgradCdfParetoType2, type_vv_378> AgradCdfParetoType2_vv_378;
+typedef std::tuple<AgradCdfParetoType2, type_vv_379> AgradCdfParetoType2_vv_379;
+typedef std::tuple<AgradCdfParetoType2, type_vv_380> AgradCdfParetoType2_vv_380;
+typedef std::tuple<AgradCdfParetoType2, type_vv_381> AgradCdfParetoType2_vv_381;
+typedef std::tuple<AgradCdfParetoType2, type_vv_382> AgradCdfParetoType2_vv_382;
+typedef std::tuple<AgradCdfParetoType2, type_vv_383> AgradCdfParetoType2_vv_383;
+typedef std::tuple<AgradCdfParetoType2, type_vv_384> AgradCdfParetoType2_vv_384;
+typedef std::tuple<AgradCdfParetoType2, type_vv_385> AgradCdfParetoType2_vv_385;
+typedef std::tuple<AgradCdfParetoType2, type_vv_386> AgradCdfParetoType2_vv_386;
+typedef std::tuple<AgradCdfParetoType2, type_vv_387> AgradCdfParetoType2_vv_387;
+typedef std::tuple<AgradCdfParetoType2, type_vv_388> AgradCdfParetoType2_vv_388;
+typedef std::tuple<AgradCdfParetoType2, type_vv_389> AgradCdfParetoType2_vv_389;
+typedef std::tuple<AgradCdfParetoType2, type_vv_390> AgradCdfParetoType2_vv_390;
+typedef std::tuple<AgradCdfParetoType2, type_vv_391> AgradCdfParetoType2_vv_391;
+typedef std::tuple<AgradCdfParetoType2, type_vv_392> AgradCdfParetoType2_vv_392;
+typedef std::tuple<AgradCdfParetoType2, type_vv_393> AgradCdfParetoType2_vv_393;
+typedef std::tuple<AgradCdfParetoType2, type_vv_394> AgradCdfParetoType2_vv_394;
+typedef std::tuple<AgradCdfParetoType2, type_vv_395> AgradCdfParetoType2_vv_395;
+typedef std::tuple<AgradCdfParetoType2, type_vv_396> AgradCdfParetoType2_vv_396;
+typedef std::tuple<AgradCdfParetoType2, type_vv_397> AgradCdfParetoType2_vv_397;
+typedef std::tuple<AgradCdfParetoType2, type_vv_398> AgradCdfParetoType2_vv_398;
+typedef std::tuple<AgradCdfParetoType2, type_vv_399> AgradCdfParetoType2_vv_399;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_300, AgradCdfTestFixture, AgradCdfParetoType2_vv_300);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_301, AgradCdfTestFixture, AgradCdfParetoType2_vv_301);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_302, AgradCdfTestFixture, AgradCdfParetoType2_vv_302);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_303, AgradCdfTestFixture, AgradCdfParetoType2_vv_303);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_304, AgradCdfTestFixture, AgradCdfParetoType2_vv_304);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_305, AgradCdfTestFixture, AgradCdfParetoType2_vv_305);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_306, AgradCdfTestFixture, AgradCdfParetoType2_vv_306);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_307, AgradCdfTestFixture, AgradCdfParetoType2_vv_307);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_308, AgradCdfTestFixture, AgradCdfParetoType2_vv_308);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_309, AgradCdfTestFixture, AgradCdfParetoType2_vv_309);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_310, AgradCdfTestFixture, AgradCdfParetoType2_vv_310);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_311, AgradCdfTestFixture, AgradCdfParetoType2_vv_311);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_312, AgradCdfTestFixture, AgradCdfParetoType2_vv_312);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_313, AgradCdfTestFixture, AgradCdfParetoType2_vv_313);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_314, AgradCdfTestFixture, AgradCdfParetoType2_vv_314);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_315, AgradCdfTestFixture, AgradCdfParetoType2_vv_315);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_316, AgradCdfTestFixture, AgradCdfParetoType2_vv_316);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_317, AgradCdfTestFixture, AgradCdfParetoType2_vv_317);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_318, AgradCdfTestFixture, AgradCdfParetoType2_vv_318);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_319, AgradCdfTestFixture, AgradCdfParetoType2_vv_319);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_320, AgradCdfTestFixture, AgradCdfParetoType2_vv_320);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_321, AgradCdfTestFixture, AgradCdfParetoType2_vv_321);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_322, AgradCdfTestFixture, AgradCdfParetoType2_vv_322);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_323, AgradCdfTestFixture, AgradCdfParetoType2_vv_323);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_324, AgradCdfTestFixture, AgradCdfParetoType2_vv_324);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_325, AgradCdfTestFixture, AgradCdfParetoType2_vv_325);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_326, AgradCdfTestFixture, AgradCdfParetoType2_vv_326);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_327, AgradCdfTestFixture, AgradCdfParetoType2_vv_327);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_328, AgradCdfTestFixture, AgradCdfParetoType2_vv_328);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_329, AgradCdfTestFixture, AgradCdfParetoType2_vv_329);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_330, AgradCdfTestFixture, AgradCdfParetoType2_vv_330);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_331, AgradCdfTestFixture, AgradCdfParetoType2_vv_331);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_332, AgradCdfTestFixture, AgradCdfParetoType2_vv_332);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_333, AgradCdfTestFixture, AgradCdfParetoType2_vv_333);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_334, AgradCdfTestFixture, AgradCdfParetoType2_vv_334);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_335, AgradCdfTestFixture, AgradCdfParetoType2_vv_335);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_336, AgradCdfTestFixture, AgradCdfParetoType2_vv_336);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_337, AgradCdfTestFixture, AgradCdfParetoType2_vv_337);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_338, AgradCdfTestFixture, AgradCdfParetoType2_vv_338);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_339, AgradCdfTestFixture, AgradCdfParetoType2_vv_339);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_340, AgradCdfTestFixture, AgradCdfParetoType2_vv_340);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_341, AgradCdfTestFixture, AgradCdfParetoType2_vv_341);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_342, AgradCdfTestFixture, AgradCdfParetoType2_vv_342);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_343, AgradCdfTestFixture, AgradCdfParetoType2_vv_343);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_344, AgradCdfTestFixture, AgradCdfParetoType2_vv_344);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_345, AgradCdfTestFixture, AgradCdfParetoType2_vv_345);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_346, AgradCdfTestFixture, AgradCdfParetoType2_vv_346);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_347, AgradCdfTestFixture, AgradCdfParetoType2_vv_347);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_348, AgradCdfTestFixture, AgradCdfParetoType2_vv_348);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_349, AgradCdfTestFixture, AgradCdfParetoType2_vv_349);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_350, AgradCdfTestFixture, AgradCdfParetoType2_vv_350);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_351, AgradCdfTestFixture, AgradCdfParetoType2_vv_351);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_352, AgradCdfTestFixture, AgradCdfParetoType2_vv_352);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_353, AgradCdfTestFixture, AgradCdfParetoType2_vv_353);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_354, AgradCdfTestFixture, AgradCdfParetoType2_vv_354);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_355, AgradCdfTestFixture, AgradCdfParetoType2_vv_355);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_356, AgradCdfTestFixture, AgradCdfParetoType2_vv_356);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_357, AgradCdfTestFixture, AgradCdfParetoType2_vv_357);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_358, AgradCdfTestFixture, AgradCdfParetoType2_vv_358);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_359, AgradCdfTestFixture, AgradCdfParetoType2_vv_359);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_360, AgradCdfTestFixture, AgradCdfParetoType2_vv_360);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_361, AgradCdfTestFixture, AgradCdfParetoType2_vv_361);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_362, AgradCdfTestFixture, AgradCdfParetoType2_vv_362);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_363, AgradCdfTestFixture, AgradCdfParetoType2_vv_363);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_364, AgradCdfTestFixture, AgradCdfParetoType2_vv_364);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_365, AgradCdfTestFixture, AgradCdfParetoType2_vv_365);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_366, AgradCdfTestFixture, AgradCdfParetoType2_vv_366);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_367, AgradCdfTestFixture, AgradCdfParetoType2_vv_367);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_368, AgradCdfTestFixture, AgradCdfParetoType2_vv_368);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_369, AgradCdfTestFixture, AgradCdfParetoType2_vv_369);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_370, AgradCdfTestFixture, AgradCdfParetoType2_vv_370);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_371, AgradCdfTestFixture, AgradCdfParetoType2_vv_371);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_372, AgradCdfTestFixture, AgradCdfParetoType2_vv_372);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_373, AgradCdfTestFixture, AgradCdfParetoType2_vv_373);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_374, AgradCdfTestFixture, AgradCdfParetoType2_vv_374);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_375, AgradCdfTestFixture, AgradCdfParetoType2_vv_375);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_376, AgradCdfTestFixture, AgradCdfParetoType2_vv_376);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_377, AgradCdfTestFixture, AgradCdfParetoType2_vv_377);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_378, AgradCdfTestFixture, AgradCdfParetoType2_vv_378);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_379, AgradCdfTestFixture, AgradCdfParetoType2_vv_379);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_380, AgradCdfTestFixture, AgradCdfParetoType2_vv_380);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_381, AgradCdfTestFixture, AgradCdfParetoType2_vv_381);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_382, AgradCdfTestFixture, AgradCdfParetoType2_vv_382);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_383, AgradCdfTestFixture, AgradCdfParetoType2_vv_383);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_384, AgradCdfTestFixture, AgradCdfParetoType2_vv_384);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_385, AgradCdfTestFixture, AgradCdfParetoType2_vv_385);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_386, AgradCdfTestFixture, AgradCdfParetoType2_vv_386);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_387, AgradCdfTestFixture, AgradCdfParetoType2_vv_387);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_388, AgradCdfTestFixture, AgradCdfParetoType2_vv_388);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_389, AgradCdfTestFixture, AgradCdfParetoType2_vv_389);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_390, AgradCdfTestFixture, AgradCdfParetoType2_vv_390);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_391, AgradCdfTestFixture, AgradCdfParetoType2_vv_391);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_392, AgradCdfTestFixture, AgradCdfParetoType2_vv_392);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_393, AgradCdfTestFixture, AgradCdfParetoType2_vv_393);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_394, AgradCdfTestFixture, AgradCdfParetoType2_vv_394);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_395, AgradCdfTestFixture, AgradCdfParetoType2_vv_395);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_396, AgradCdfTestFixture, AgradCdfParetoType2_vv_396);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_397, AgradCdfTestFixture, AgradCdfParetoType2_vv_397);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_398, AgradCdfTestFixture, AgradCdfParetoType2_vv_398);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_399, AgradCdfTestFixture, AgradCdfParetoType2_vv_399);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_cdf_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_400;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_401;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_402;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_403;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_404;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, fvar<fvar<var> >, empty, empty> type_ffv_405;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_406;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_407;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_408;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_409;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_410;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_411;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_412;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_413;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, double, empty, empty> type_ffv_414;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_415;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_416;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_417;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_418;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_419;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_420;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_421;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_422;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_423;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_424;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_425;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_426;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_427;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_428;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_429;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_430;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_431;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_432;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_433;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_434;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_435;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_436;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_437;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_438;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_439;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_440;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_441;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_442;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_443;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_444;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_445;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_446;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_447;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_448;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_449;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_450;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_451;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_452;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_453;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_454;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_455;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_456;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_457;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_458;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, double, empty, empty> type_ffv_459;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, std::vector<double>, empty, empty> type_ffv_460;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_461;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, fvar<fvar<var> >, empty, empty> type_ffv_462;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_463;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_464;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, double, empty, empty> type_ffv_465;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty, empty> type_ffv_466;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_467;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_468;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_469;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_470;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_471;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_472;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_473;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_474;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_475;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_476;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, double, empty, empty> type_ffv_477;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_478;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_479;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_480;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_481;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_482;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_483;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_484;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_485;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_486;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_487;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_488;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_489;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_490;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_491;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_492;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_493;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_494;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, double, empty, empty> type_ffv_495;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty, empty> type_ffv_496;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_497;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty, empty> type_ffv_498;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_499;
+
+typedef std::tuple<AgradCdfParetoType2, type_ffv_400> AgradCdfParetoType2_ffv_400;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_401> AgradCdfParetoType2_ffv_401;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_402> AgradCdfParetoType2_ffv_402;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_403> AgradCdfParetoType2_ffv_403;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_404> AgradCdfParetoType2_ffv_404;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_405> AgradCdfParetoType2_ffv_405;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_406> AgradCdfParetoType2_ffv_406;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_407> AgradCdfParetoType2_ffv_407;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_408> AgradCdfParetoType2_ffv_408;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_409> AgradCdfParetoType2_ffv_409;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_410> AgradCdfParetoType2_ffv_410;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_411> AgradCdfParetoType2_ffv_411;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_412> AgradCdfParetoType2_ffv_412;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_413> AgradCdfParetoType2_ffv_413;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_414> AgradCdfParetoType2_ffv_414;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_415> AgradCdfParetoType2_ffv_415;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_416> AgradCdfParetoType2_ffv_416;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_417> AgradCdfParetoType2_ffv_417;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_418> AgradCdfParetoType2_ffv_418;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_419> AgradCdfParetoType2_ffv_419;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_420> AgradCdfParetoType2_ffv_420;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_421> AgradCdfParetoType2_ffv_421;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_422> AgradCdfParetoType2_ffv_422;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_423> AgradCdfParetoType2_ffv_423;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_424> AgradCdfParetoType2_ffv_424;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_425> AgradCdfParetoType2_ffv_425;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_426> AgradCdfParetoType2_ffv_426;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_427> AgradCdfParetoType2_ffv_427;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_428> AgradCdfParetoType2_ffv_428;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_429> AgradCdfParetoType2_ffv_429;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_430> AgradCdfParetoType2_ffv_430;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_431> AgradCdfParetoType2_ffv_431;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_432> AgradCdfParetoType2_ffv_432;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_433> AgradCdfParetoType2_ffv_433;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_434> AgradCdfParetoType2_ffv_434;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_435> AgradCdfParetoType2_ffv_435;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_436> AgradCdfParetoType2_ffv_436;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_437> AgradCdfParetoType2_ffv_437;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_438> AgradCdfParetoType2_ffv_438;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_439> AgradCdfParetoType2_ffv_439;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_440> AgradCdfParetoType2_ffv_440;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_441> AgradCdfParetoType2_ffv_441;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_442> AgradCdfParetoType2_ffv_442;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_443> AgradCdfParetoType2_ffv_443;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_444> AgradCdfParetoType2_ffv_444;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_445> AgradCdfParetoType2_ffv_445;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_446> AgradCdfParetoType2_ffv_446;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_447> AgradCdfParetoType2_ffv_447;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_448> AgradCdfParetoType2_ffv_448;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_449> AgradCdfParetoType2_ffv_449;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_450> AgradCdfParetoType2_ffv_450;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_451> AgradCdfParetoType2_ffv_451;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_452> AgradCdfParetoType2_ffv_452;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_453> AgradCdfParetoType2_ffv_453;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_454> AgradCdfParetoType2_ffv_454;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_455> AgradCdfParetoType2_ffv_455;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_456> AgradCdfParetoType2_ffv_456;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_457> AgradCdfParetoType2_ffv_457;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_458> AgradCdfParetoType2_ffv_458;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_459> AgradCdfParetoType2_ffv_459;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_460> AgradCdfParetoType2_ffv_460;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_461> AgradCdfParetoType2_ffv_461;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_462> AgradCdfParetoType2_ffv_462;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_463> AgradCdfParetoType2_ffv_463;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_464> AgradCdfParetoType2_ffv_464;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_465> AgradCdfParetoType2_ffv_465;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_466> AgradCdfParetoType2_ffv_466;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_467> AgradCdfParetoType2_ffv_467;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_468> AgradCdfParetoType2_ffv_468;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_469> AgradCdfParetoType2_ffv_469;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_470> AgradCdfParetoType2_ffv_470;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_471> AgradCdfParetoType2_ffv_471;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_472> AgradCdfParetoType2_ffv_472;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_473> AgradCdfParetoType2_ffv_473;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_474> AgradCdfParetoType2_ffv_474;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_475> AgradCdfParetoType2_ffv_475;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_476> AgradCdfParetoType2_ffv_476;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_477> AgradCdfParetoType2_ffv_477;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_478> AgradCdfParetoType2_ffv_478;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_479> AgradCdfParetoType2_ffv_479;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_480> AgradCdfParetoType2_ffv_480;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_481> AgradCdfParetoType2_ffv_481;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_482> AgradCdfParetoType2_ffv_482;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_483> AgradCdfParetoType2_ffv_483;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_484> AgradCdfParetoType2_ffv_484;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_485> AgradCdfParetoType2_ffv_485;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_486> AgradCdfParetoType2_ffv_486;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_487> AgradCdfParetoType2_ffv_487;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_488> AgradCdfParetoType2_ffv_488;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_489> AgradCdfParetoType2_ffv_489;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_490> AgradCdfParetoType2_ffv_490;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_491> AgradCdfParetoType2_ffv_491;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_492> AgradCdfParetoType2_ffv_492;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_493> AgradCdfParetoType2_ffv_493;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_494> AgradCdfParetoType2_ffv_494;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_495> AgradCdfParetoType2_ffv_495;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_496> AgradCdfParetoType2_ffv_496;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_497> AgradCdfParetoType2_ffv_497;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_498> AgradCdfParetoType2_ffv_498;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_499> AgradCdfParetoType2_ffv_499;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_400, AgradCdfTestFixture, AgradCdfParetoType2_ffv_400);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_401, AgradCdfTestFixture, AgradCdfParetoType2_ffv_401);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_402, AgradCdfTestFixture, AgradCdfParetoType2_ffv_402);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_403, AgradCdfTestFixture, AgradCdfParetoType2_ffv_403);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_404, AgradCdfTestFixture, AgradCdfParetoType2_ffv_404);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_405, AgradCdfTestFixture, AgradCdfParetoType2_ffv_405);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_406, AgradCdfTestFixture, AgradCdfParetoType2_ffv_406);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_407, AgradCdfTestFixture, AgradCdfParetoType2_ffv_407);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_408, AgradCdfTestFixture, AgradCdfParetoType2_ffv_408);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_409, AgradCdfTestFixture, AgradCdfParetoType2_ffv_409);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_410, AgradCdfTestFixture, AgradCdfParetoType2_ffv_410);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_411, AgradCdfTestFixture, AgradCdfParetoType2_ffv_411);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_412, AgradCdfTestFixture, AgradCdfParetoType2_ffv_412);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_413, AgradCdfTestFixture, AgradCdfParetoType2_ffv_413);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_414, AgradCdfTestFixture, AgradCdfParetoType2_ffv_414);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_415, AgradCdfTestFixture, AgradCdfParetoType2_ffv_415);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_416, AgradCdfTestFixture, AgradCdfParetoType2_ffv_416);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_417, AgradCdfTestFixture, AgradCdfParetoType2_ffv_417);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_418, AgradCdfTestFixture, AgradCdfParetoType2_ffv_418);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_419, AgradCdfTestFixture, AgradCdfParetoType2_ffv_419);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_420, AgradCdfTestFixture, AgradCdfParetoType2_ffv_420);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_421, AgradCdfTestFixture, AgradCdfParetoType2_ffv_421);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_422, AgradCdfTestFixture, AgradCdfParetoType2_ffv_422);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_423, AgradCdfTestFixture, AgradCdfParetoType2_ffv_423);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_424, AgradCdfTestFixture, AgradCdfParetoType2_ffv_424);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_425, AgradCdfTestFixture, AgradCdfParetoType2_ffv_425);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_426, AgradCdfTestFixture, AgradCdfParetoType2_ffv_426);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_427, AgradCdfTestFixture, AgradCdfParetoType2_ffv_427);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_428, AgradCdfTestFixture, AgradCdfParetoType2_ffv_428);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_429, AgradCdfTestFixture, AgradCdfParetoType2_ffv_429);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_430, AgradCdfTestFixture, AgradCdfParetoType2_ffv_430);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_431, AgradCdfTestFixture, AgradCdfParetoType2_ffv_431);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_432, AgradCdfTestFixture, AgradCdfParetoType2_ffv_432);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_433, AgradCdfTestFixture, AgradCdfParetoType2_ffv_433);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_434, AgradCdfTestFixture, AgradCdfParetoType2_ffv_434);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_435, AgradCdfTestFixture, AgradCdfParetoType2_ffv_435);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_436, AgradCdfTestFixture, AgradCdfParetoType2_ffv_436);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_437, AgradCdfTestFixture, AgradCdfParetoType2_ffv_437);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_438, AgradCdfTestFixture, AgradCdfParetoType2_ffv_438);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_439, AgradCdfTestFixture, AgradCdfParetoType2_ffv_439);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_440, AgradCdfTestFixture, AgradCdfParetoType2_ffv_440);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_441, AgradCdfTestFixture, AgradCdfParetoType2_ffv_441);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_442, AgradCdfTestFixture, AgradCdfParetoType2_ffv_442);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_443, AgradCdfTestFixture, AgradCdfParetoType2_ffv_443);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_444, AgradCdfTestFixture, AgradCdfParetoType2_ffv_444);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_445, AgradCdfTestFixture, AgradCdfParetoType2_ffv_445);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_446, AgradCdfTestFixture, AgradCdfParetoType2_ffv_446);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_447, AgradCdfTestFixture, AgradCdfParetoType2_ffv_447);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_448, AgradCdfTestFixture, AgradCdfParetoType2_ffv_448);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_449, AgradCdfTestFixture, AgradCdfParetoType2_ffv_449);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_450, AgradCdfTestFixture, AgradCdfParetoType2_ffv_450);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_451, AgradCdfTestFixture, AgradCdfParetoType2_ffv_451);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_452, AgradCdfTestFixture, AgradCdfParetoType2_ffv_452);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_453, AgradCdfTestFixture, AgradCdfParetoType2_ffv_453);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_454, AgradCdfTestFixture, AgradCdfParetoType2_ffv_454);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_455, AgradCdfTestFixture, AgradCdfParetoType2_ffv_455);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_456, AgradCdfTestFixture, AgradCdfParetoType2_ffv_456);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_457, AgradCdfTestFixture, AgradCdfParetoType2_ffv_457);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_458, AgradCdfTestFixture, AgradCdfParetoType2_ffv_458);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_459, AgradCdfTestFixture, AgradCdfParetoType2_ffv_459);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_460, AgradCdfTestFixture, AgradCdfParetoType2_ffv_460);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_461, AgradCdfTestFixture, AgradCdfParetoType2_ffv_461);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_462, AgradCdfTestFixture, AgradCdfParetoType2_ffv_462);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_463, AgradCdfTestFixture, AgradCdfParetoType2_ffv_463);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_464, AgradCdfTestFixture, AgradCdfParetoType2_ffv_464);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_465, AgradCdfTestFixture, AgradCdfParetoType2_ffv_465);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_466, AgradCdfTestFixture, AgradCdfParetoType2_ffv_466);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_467, AgradCdfTestFixture, AgradCdfParetoType2_ffv_467);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_468, AgradCdfTestFixture, AgradCdfParetoType2_ffv_468);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_469, AgradCdfTestFixture, AgradCdfParetoType2_ffv_469);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_470, AgradCdfTestFixture, AgradCdfParetoType2_ffv_470);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_471, AgradCdfTestFixture, AgradCdfParetoType2_ffv_471);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_472, AgradCdfTestFixture, AgradCdfParetoType2_ffv_472);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_473, AgradCdfTestFixture, AgradCdfParetoType2_ffv_473);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_474, AgradCdfTestFixture, AgradCdfParetoType2_ffv_474);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_475, AgradCdfTestFixture, AgradCdfParetoType2_ffv_475);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_476, AgradCdfTestFixture, AgradCdfParetoType2_ffv_476);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_477, AgradCdfTestFixture, AgradCdfParetoType2_ffv_477);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_478, AgradCdfTestFixture, AgradCdfParetoType2_ffv_478);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_479, AgradCdfTestFixture, AgradCdfParetoType2_ffv_479);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_480, AgradCdfTestFixture, AgradCdfParetoType2_ffv_480);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_481, AgradCdfTestFixture, AgradCdfParetoType2_ffv_481);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_482, AgradCdfTestFixture, AgradCdfParetoType2_ffv_482);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_483, AgradCdfTestFixture, AgradCdfParetoType2_ffv_483);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_484, AgradCdfTestFixture, AgradCdfParetoType2_ffv_484);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_485, AgradCdfTestFixture, AgradCdfParetoType2_ffv_485);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_486, AgradCdfTestFixture, AgradCdfParetoType2_ffv_486);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_487, AgradCdfTestFixture, AgradCdfParetoType2_ffv_487);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_488, AgradCdfTestFixture, AgradCdfParetoType2_ffv_488);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_489, AgradCdfTestFixture, AgradCdfParetoType2_ffv_489);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_490, AgradCdfTestFixture, AgradCdfParetoType2_ffv_490);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_491, AgradCdfTestFixture, AgradCdfParetoType2_ffv_491);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_492, AgradCdfTestFixture, AgradCdfParetoType2_ffv_492);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_493, AgradCdfTestFixture, AgradCdfParetoType2_ffv_493);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_494, AgradCdfTestFixture, AgradCdfParetoType2_ffv_494);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_495, AgradCdfTestFixture, AgradCdfParetoType2_ffv_495);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_496, AgradCdfTestFixture, AgradCdfParetoType2_ffv_496);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_497, AgradCdfTestFixture, AgradCdfParetoType2_ffv_497);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_498, AgradCdfTestFixture, AgradCdfParetoType2_ffv_498);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_499, AgradCdfTestFixture, AgradCdfParetoType2_ffv_499);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_cdf_test.hpp>
+
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_400;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_401;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_402;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_403;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_404;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_405;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_406;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_407;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_408;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_409;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_410;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_411;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_412;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_413;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_414;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_415;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_416;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_417;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_418;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_419;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_420;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_421;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_422;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_423;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_424;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_425;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_426;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_427;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_428;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_429;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_430;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_431;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, double, empty, empty> type_v_432;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, std::vector<double>, empty, empty> type_v_433;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_434;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, var, empty, empty> type_v_435;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, std::vector<var>, empty, empty> type_v_436;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_437;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, double, empty, empty> type_v_438;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, std::vector<double>, empty, empty> type_v_439;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_440;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, var, empty, empty> type_v_441;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, std::vector<var>, empty, empty> type_v_442;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_443;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_444;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_445;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_446;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_447;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_448;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_449;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, double, empty, empty> type_v_450;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, std::vector<double>, empty, empty> type_v_451;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_452;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, var, empty, empty> type_v_453;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, std::vector<var>, empty, empty> type_v_454;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_455;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, double, empty, empty> type_v_456;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, std::vector<double>, empty, empty> type_v_457;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_458;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, var, empty, empty> type_v_459;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, std::vector<var>, empty, empty> type_v_460;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_461;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_462;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_463;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_464;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_465;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_466;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_467;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, double, empty, empty> type_v_468;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, std::vector<double>, empty, empty> type_v_469;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_470;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, var, empty, empty> type_v_471;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, std::vector<var>, empty, empty> type_v_472;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_473;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, double, empty, empty> type_v_474;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, std::vector<double>, empty, empty> type_v_475;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_476;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, var, empty, empty> type_v_477;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_v_478;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_479;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_480;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_481;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_482;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_483;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_484;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_485;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, double, empty, empty> type_v_486;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, std::vector<double>, empty, empty> type_v_487;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_488;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, var, empty, empty> type_v_489;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, std::vector<var>, empty, empty> type_v_490;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_491;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, double, empty, empty> type_v_492;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_v_493;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_494;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, var, empty, empty> type_v_495;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_v_496;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_497;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_498;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_499;
+
+typedef std::tuple<AgradCdfParetoType2, type_v_400> AgradCdfParetoType2_v_400;
+typedef std::tuple<AgradCdfParetoType2, type_v_401> AgradCdfParetoType2_v_401;
+typedef std::tuple<AgradCdfParetoType2, type_v_402> AgradCdfParetoType2_v_402;
+typedef std::tuple<AgradCdfParetoType2, type_v_403> AgradCdfParetoType2_v_403;
+typedef std::tuple<AgradCdfParetoType2, type_v_404> AgradCdfParetoType2_v_404;
+typedef std::tuple<AgradCdfParetoType2, type_v_405> AgradCdfParetoType2_v_405;
+typedef std::tuple<AgradCdfParetoType2, type_v_406> AgradCdfParetoType2_v_406;
+typedef std::tuple<AgradCdfParetoType2, type_v_407> AgradCdfParetoType2_v_407;
+typedef std::tuple<AgradCdfParetoType2, type_v_408> AgradCdfParetoType2_v_408;
+typedef std::tuple<AgradCdfParetoType2, type_v_409> AgradCdfParetoType2_v_409;
+typedef std::tuple<AgradCdfParetoType2, type_v_410> AgradCdfParetoType2_v_410;
+typedef std::tuple<AgradCdfParetoType2, type_v_411> AgradCdfParetoType2_v_411;
+typedef std::tuple<AgradCdfParetoType2, type_v_412> AgradCdfParetoType2_v_412;
+typedef std::tuple<AgradCdfParetoType2, type_v_413> AgradCdfParetoType2_v_413;
+typedef std::tuple<AgradCdfParetoType2, type_v_414> AgradCdfParetoType2_v_414;
+typedef std::tuple<AgradCdfParetoType2, type_v_415> AgradCdfParetoType2_v_415;
+typedef std::tuple<AgradCdfParetoType2, type_v_416> AgradCdfParetoType2_v_416;
+typedef std::tuple<AgradCdfParetoType2, type_v_417> AgradCdfParetoType2_v_417;
+typedef std::tuple<AgradCdfParetoType2, type_v_418> AgradCdfParetoType2_v_418;
+typedef std::tuple<AgradCdfParetoType2, type_v_419> AgradCdfParetoType2_v_419;
+typedef std::tuple<AgradCdfParetoType2, type_v_420> AgradCdfParetoType2_v_420;
+typedef std::tuple<AgradCdfParetoType2, type_v_421> AgradCdfParetoType2_v_421;
+typedef std::tuple<AgradCdfParetoType2, type_v_422> AgradCdfParetoType2_v_422;
+typedef std::tuple<AgradCdfParetoType2, type_v_423> AgradCdfParetoType2_v_423;
+typedef std::tuple<AgradCdfParetoType2, type_v_424> AgradCdfParetoType2_v_424;
+typedef std::tuple<AgradCdfParetoType2, type_v_425> AgradCdfParetoType2_v_425;
+typedef std::tuple<AgradCdfParetoType2, type_v_426> AgradCdfParetoType2_v_426;
+typedef std::tuple<AgradCdfParetoType2, type_v_427> AgradCdfParetoType2_v_427;
+typedef std::tuple<AgradCdfParetoType2, type_v_428> AgradCdfParetoType2_v_428;
+typedef std::tuple<AgradCdfParetoType2, type_v_429> AgradCdfParetoType2_v_429;
+typedef std::tuple<AgradCdfParetoType2, type_v_430> AgradCdfParetoType2_v_430;
+typedef std::tuple<AgradCdfParetoType2, type_v_431> AgradCdfParetoType2_v_431;
+typedef std::tuple<AgradCdfParetoType2, type_v_432> AgradCdfParetoType2_v_432;
+typedef std::tuple<AgradCdfParetoType2, type_v_433> AgradCdfParetoType2_v_433;
+typedef std::tuple<AgradCdfParetoType2, type_v_434> AgradCdfParetoType2_v_434;
+typedef std::tuple<AgradCdfParetoType2, type_v_435> AgradCdfParetoType2_v_435;
+typedef std::tuple<AgradCdfParetoType2, type_v_436> AgradCdfParetoType2_v_436;
+typedef std::tuple<AgradCdfParetoType2, type_v_437> AgradCdfParetoType2_v_437;
+typedef std::tuple<AgradCdfParetoType2, type_v_438> AgradCdfParetoType2_v_438;
+typedef std::tuple<AgradCdfParetoType2, type_v_439> AgradCdfParetoType2_v_439;
+typedef std::tuple<AgradCdfParetoType2, type_v_440> AgradCdfParetoType2_v_440;
+typedef std::tuple<AgradCdfParetoType2, type_v_441> AgradCdfParetoType2_v_441;
+typedef std::tuple<AgradCdfParetoType2, type_v_442> AgradCdfParetoType2_v_442;
+typedef std::tuple<AgradCdfParetoType2, type_v_443> AgradCdfParetoType2_v_443;
+typedef std::tuple<AgradCdfParetoType2, type_v_444> AgradCdfParetoType2_v_444;
+typedef std::tuple<AgradCdfParetoType2, type_v_445> AgradCdfParetoType2_v_445;
+typedef std::tuple<AgradCdfParetoType2, type_v_446> AgradCdfParetoType2_v_446;
+typedef std::tuple<AgradCdfParetoType2, type_v_447> AgradCdfParetoType2_v_447;
+typedef std::tuple<AgradCdfParetoType2, type_v_448> AgradCdfParetoType2_v_448;
+typedef std::tuple<AgradCdfParetoType2, type_v_449> AgradCdfParetoType2_v_449;
+typedef std::tuple<AgradCdfParetoType2, type_v_450> AgradCdfParetoType2_v_450;
+typedef std::tuple<AgradCdfParetoType2, type_v_451> AgradCdfParetoType2_v_451;
+typedef std::tuple<AgradCdfParetoType2, type_v_452> AgradCdfParetoType2_v_452;
+typedef std::tuple<AgradCdfParetoType2, type_v_453> AgradCdfParetoType2_v_453;
+typedef std::tuple<AgradCdfParetoType2, type_v_454> AgradCdfParetoType2_v_454;
+typedef std::tuple<AgradCdfParetoType2, type_v_455> AgradCdfParetoType2_v_455;
+typedef std::tuple<AgradCdfParetoType2, type_v_456> AgradCdfParetoType2_v_456;
+typedef std::tuple<AgradCdfParetoType2, type_v_457> AgradCdfParetoType2_v_457;
+typedef std::tuple<AgradCdfParetoType2, type_v_458> AgradCdfParetoType2_v_458;
+typedef std::tuple<AgradCdfParetoType2, type_v_459> AgradCdfParetoType2_v_459;
+typedef std::tuple<AgradCdfParetoType2, type_v_460> AgradCdfParetoType2_v_460;
+typedef std::tuple<AgradCdfParetoType2, type_v_461> AgradCdfParetoType2_v_461;
+typedef std::tuple<AgradCdfParetoType2, type_v_462> AgradCdfParetoType2_v_462;
+typedef std::tuple<AgradCdfParetoType2, type_v_463> AgradCdfParetoType2_v_463;
+typedef std::tuple<AgradCdfParetoType2, type_v_464> AgradCdfParetoType2_v_464;
+typedef std::tuple<AgradCdfParetoType2, type_v_465> AgradCdfParetoType2_v_465;
+typedef std::tuple<AgradCdfParetoType2, type_v_466> AgradCdfParetoType2_v_466;
+typedef std::tuple<AgradCdfParetoType2, type_v_467> AgradCdfParetoType2_v_467;
+typedef std::tuple<AgradCdfParetoType2, type_v_468> AgradCdfParetoType2_v_468;
+typedef std::tuple<AgradCdfParetoType2, type_v_469> AgradCdfParetoType2_v_469;
+typedef std::tuple<AgradCdfParetoType2, type_v_470> AgradCdfParetoType2_v_470;
+typedef std::tuple<AgradCdfParetoType2, type_v_471> AgradCdfParetoType2_v_471;
+typedef std::tuple<AgradCdfParetoType2, type_v_472> AgradCdfParetoType2_v_472;
+typedef std::tuple<AgradCdfParetoType2, type_v_473> AgradCdfParetoType2_v_473;
+typedef std::tuple<AgradCdfParetoType2, type_v_474> AgradCdfParetoType2_v_474;
+typedef std::tuple<AgradCdfParetoType2, type_v_475> AgradCdfParetoType2_v_475;
+typedef std::tuple<AgradCdfParetoType2, type_v_476> AgradCdfParetoType2_v_476;
+typedef std::tuple<AgradCdfParetoType2, type_v_477> AgradCdfParetoType2_v_477;
+typedef std::tuple<AgradCdfParetoType2, type_v_478> AgradCdfParetoType2_v_478;
+typedef std::tuple<AgradCdfParetoType2, type_v_479> AgradCdfParetoType2_v_479;
+typedef std::tuple<AgradCdfParetoType2, type_v_480> AgradCdfParetoType2_v_480;
+typedef std::tuple<AgradCdfParetoType2, type_v_481> AgradCdfParetoType2_v_481;
+typedef std::tuple<AgradCdfParetoType2, type_v_482> AgradCdfParetoType2_v_482;
+typedef std::tuple<AgradCdfParetoType2, type_v_483> AgradCdfParetoType2_v_483;
+typedef std::tuple<AgradCdfParetoType2, type_v_484> AgradCdfParetoType2_v_484;
+typedef std::tuple<AgradCdfParetoType2, type_v_485> AgradCdfParetoType2_v_485;
+typedef std::tuple<AgradCdfParetoType2, type_v_486> AgradCdfParetoType2_v_486;
+typedef std::tuple<AgradCdfParetoType2, type_v_487> AgradCdfParetoType2_v_487;
+typedef std::tuple<AgradCdfParetoType2, type_v_488> AgradCdfParetoType2_v_488;
+typedef std::tuple<AgradCdfParetoType2, type_v_489> AgradCdfParetoType2_v_489;
+typedef std::tuple<AgradCdfParetoType2, type_v_490> AgradCdfParetoType2_v_490;
+typedef std::tuple<AgradCdfParetoType2, type_v_491> AgradCdfParetoType2_v_491;
+typedef std::tuple<AgradCdfParetoType2, type_v_492> AgradCdfParetoType2_v_492;
+typedef std::tuple<AgradCdfParetoType2, type_v_493> AgradCdfParetoType2_v_493;
+typedef std::tuple<AgradCdfParetoType2, type_v_494> AgradCdfParetoType2_v_494;
+typedef std::tuple<AgradCdfParetoType2, type_v_495> AgradCdfParetoType2_v_495;
+typedef std::tuple<AgradCdfParetoType2, type_v_496> AgradCdfParetoType2_v_496;
+typedef std::tuple<AgradCdfParetoType2, type_v_497> AgradCdfParetoType2_v_497;
+typedef std::tuple<AgradCdfParetoType2, type_v_498> AgradCdfParetoType2_v_498;
+typedef std::tuple<AgradCdfParetoType2, type_v_499> AgradCdfParetoType2_v_499;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_400, AgradCdfTestFixture, AgradCdfParetoType2_v_400);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_401, AgradCdfTestFixture, AgradCdfParetoType2_v_401);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_402, AgradCdfTestFixture, AgradCdfParetoType2_v_402);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_403, AgradCdfTestFixture, AgradCdfParetoType2_v_403);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_404, AgradCdfTestFixture, AgradCdfParetoType2_v_404);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_405, AgradCdfTestFixture, AgradCdfParetoType2_v_405);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_406, AgradCdfTestFixture, AgradCdfParetoType2_v_406);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_407, AgradCdfTestFixture, AgradCdfParetoType2_v_407);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_408, AgradCdfTestFixture, AgradCdfParetoType2_v_408);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_409, AgradCdfTestFixture, AgradCdfParetoType2_v_409);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_410, AgradCdfTestFixture, AgradCdfParetoType2_v_410);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_411, AgradCdfTestFixture, AgradCdfParetoType2_v_411);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_412, AgradCdfTestFixture, AgradCdfParetoType2_v_412);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_413, AgradCdfTestFixture, AgradCdfParetoType2_v_413);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_414, AgradCdfTestFixture, AgradCdfParetoType2_v_414);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_415, AgradCdfTestFixture, AgradCdfParetoType2_v_415);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_416, AgradCdfTestFixture, AgradCdfParetoType2_v_416);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_417, AgradCdfTestFixture, AgradCdfParetoType2_v_417);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_418, AgradCdfTestFixture, AgradCdfParetoType2_v_418);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_419, AgradCdfTestFixture, AgradCdfParetoType2_v_419);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_420, AgradCdfTestFixture, AgradCdfParetoType2_v_420);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_421, AgradCdfTestFixture, AgradCdfParetoType2_v_421);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_422, AgradCdfTestFixture, AgradCdfParetoType2_v_422);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_423, AgradCdfTestFixture, AgradCdfParetoType2_v_423);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_424, AgradCdfTestFixture, AgradCdfParetoType2_v_424);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_425, AgradCdfTestFixture, AgradCdfParetoType2_v_425);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_426, AgradCdfTestFixture, AgradCdfParetoType2_v_426);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_427, AgradCdfTestFixture, AgradCdfParetoType2_v_427);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_428, AgradCdfTestFixture, AgradCdfParetoType2_v_428);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_429, AgradCdfTestFixture, AgradCdfParetoType2_v_429);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_430, AgradCdfTestFixture, AgradCdfParetoType2_v_430);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_431, AgradCdfTestFixture, AgradCdfParetoType2_v_431);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_432, AgradCdfTestFixture, AgradCdfParetoType2_v_432);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_433, AgradCdfTestFixture, AgradCdfParetoType2_v_433);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_434, AgradCdfTestFixture, AgradCdfParetoType2_v_434);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_435, AgradCdfTestFixture, AgradCdfParetoType2_v_435);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_436, AgradCdfTestFixture, AgradCdfParetoType2_v_436);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_437, AgradCdfTestFixture, AgradCdfParetoType2_v_437);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_438, AgradCdfTestFixture, AgradCdfParetoType2_v_438);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_439, AgradCdfTestFixture, AgradCdfParetoType2_v_439);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_440, AgradCdfTestFixture, AgradCdfParetoType2_v_440);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_441, AgradCdfTestFixture, AgradCdfParetoType2_v_441);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_442, AgradCdfTestFixture, AgradCdfParetoType2_v_442);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_443, AgradCdfTestFixture, AgradCdfParetoType2_v_443);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_444, AgradCdfTestFixture, AgradCdfParetoType2_v_444);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_445, AgradCdfTestFixture, AgradCdfParetoType2_v_445);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_446, AgradCdfTestFixture, AgradCdfParetoType2_v_446);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_447, AgradCdfTestFixture, AgradCdfParetoType2_v_447);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_448, AgradCdfTestFixture, AgradCdfParetoType2_v_448);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_449, AgradCdfTestFixture, AgradCdfParetoType2_v_449);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_450, AgradCdfTestFixture, AgradCdfParetoType2_v_450);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_451, AgradCdfTestFixture, AgradCdfParetoType2_v_451);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_452, AgradCdfTestFixture, AgradCdfParetoType2_v_452);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_453, AgradCdfTestFixture, AgradCdfParetoType2_v_453);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_454, AgradCdfTestFixture, AgradCdfParetoType2_v_454);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_455, AgradCdfTestFixture, AgradCdfParetoType2_v_455);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_456, AgradCdfTestFixture, AgradCdfParetoType2_v_456);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_457, AgradCdfTestFixture, AgradCdfParetoType2_v_457);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_458, AgradCdfTestFixture, AgradCdfParetoType2_v_458);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_459, AgradCdfTestFixture, AgradCdfParetoType2_v_459);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_460, AgradCdfTestFixture, AgradCdfParetoType2_v_460);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_461, AgradCdfTestFixture, AgradCdfParetoType2_v_461);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_462, AgradCdfTestFixture, AgradCdfParetoType2_v_462);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_463, AgradCdfTestFixture, AgradCdfParetoType2_v_463);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_464, AgradCdfTestFixture, AgradCdfParetoType2_v_464);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_465, AgradCdfTestFixture, AgradCdfParetoType2_v_465);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_466, AgradCdfTestFixture, AgradCdfParetoType2_v_466);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_467, AgradCdfTestFixture, AgradCdfParetoType2_v_467);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_468, AgradCdfTestFixture, AgradCdfParetoType2_v_468);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_469, AgradCdfTestFixture, AgradCdfParetoType2_v_469);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_470, AgradCdfTestFixture, AgradCdfParetoType2_v_470);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_471, AgradCdfTestFixture, AgradCdfParetoType2_v_471);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_472, AgradCdfTestFixture, AgradCdfParetoType2_v_472);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_473, AgradCdfTestFixture, AgradCdfParetoType2_v_473);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_474, AgradCdfTestFixture, AgradCdfParetoType2_v_474);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_475, AgradCdfTestFixture, AgradCdfParetoType2_v_475);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_476, AgradCdfTestFixture, AgradCdfParetoType2_v_476);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_477, AgradCdfTestFixture, AgradCdfParetoType2_v_477);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_478, AgradCdfTestFixture, AgradCdfParetoType2_v_478);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_479, AgradCdfTestFixture, AgradCdfParetoType2_v_479);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_480, AgradCdfTestFixture, AgradCdfParetoType2_v_480);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_481, AgradCdfTestFixture, AgradCdfParetoType2_v_481);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_482, AgradCdfTestFixture, AgradCdfParetoType2_v_482);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_483, AgradCdfTestFixture, AgradCdfParetoType2_v_483);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_484, AgradCdfTestFixture, AgradCdfParetoType2_v_484);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_485, AgradCdfTestFixture, AgradCdfParetoType2_v_485);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_486, AgradCdfTestFixture, AgradCdfParetoType2_v_486);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_487, AgradCdfTestFixture, AgradCdfParetoType2_v_487);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_488, AgradCdfTestFixture, AgradCdfParetoType2_v_488);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_489, AgradCdfTestFixture, AgradCdfParetoType2_v_489);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_490, AgradCdfTestFixture, AgradCdfParetoType2_v_490);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_491, AgradCdfTestFixture, AgradCdfParetoType2_v_491);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_492, AgradCdfTestFixture, AgradCdfParetoType2_v_492);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_493, AgradCdfTestFixture, AgradCdfParetoType2_v_493);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_494, AgradCdfTestFixture, AgradCdfParetoType2_v_494);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_495, AgradCdfTestFixture, AgradCdfParetoType2_v_495);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_496, AgradCdfTestFixture, AgradCdfParetoType2_v_496);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_497, AgradCdfTestFixture, AgradCdfParetoType2_v_497);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_498, AgradCdfTestFixture, AgradCdfParetoType2_v_498);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_499, AgradCdfTestFixture, AgradCdfParetoType2_v_499);
+
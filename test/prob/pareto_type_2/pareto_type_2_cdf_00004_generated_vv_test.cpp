@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_cdf_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_400;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_401;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_402;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_403;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_404;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, var, empty, empty> type_vv_405;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, std::vector<var>, empty, empty> type_vv_406;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_407;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, var, empty, empty> type_vv_408;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_vv_409;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_410;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_411;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_412;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_413;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, double, empty, empty> type_vv_414;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, std::vector<double>, empty, empty> type_vv_415;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_416;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, var, empty, empty> type_vv_417;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, std::vector<var>, empty, empty> type_vv_418;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_419;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, double, empty, empty> type_vv_420;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_vv_421;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_422;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, var, empty, empty> type_vv_423;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_vv_424;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_425;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_426;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_427;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_428;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_429;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_430;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_431;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_vv_432;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_vv_433;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_434;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_vv_435;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_vv_436;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_437;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_438;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_439;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_440;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_vv_441;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_vv_442;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_443;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_vv_444;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_vv_445;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_446;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_vv_447;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_vv_448;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_449;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_vv_450;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_vv_451;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_452;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_453;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_454;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_455;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_456;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_457;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_458;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, double, empty, empty> type_vv_459;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, std::vector<double>, empty, empty> type_vv_460;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_461;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, var, empty, empty> type_vv_462;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, std::vector<var>, empty, empty> type_vv_463;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_464;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, double, empty, empty> type_vv_465;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, std::vector<double>, empty, empty> type_vv_466;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_467;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, var, empty, empty> type_vv_468;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, std::vector<var>, empty, empty> type_vv_469;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_470;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_471;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_472;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_473;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_474;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_475;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_476;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, double, empty, empty> type_vv_477;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, std::vector<double>, empty, empty> type_vv_478;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_479;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, var, empty, empty> type_vv_480;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, std::vector<var>, empty, empty> type_vv_481;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_482;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, double, empty, empty> type_vv_483;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, std::vector<double>, empty, empty> type_vv_484;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_485;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, var, empty, empty> type_vv_486;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, std::vector<var>, empty, empty> type_vv_487;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_488;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_489;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_490;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_491;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_492;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_493;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_494;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, double, empty, empty> type_vv_495;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, std::vector<double>, empty, empty> type_vv_496;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_497;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, var, empty, empty> type_vv_498;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, std::vector<var>, empty, empty> type_vv_499;
+
+typedef std::tuple<AgradCdfParetoType2, type_vv_400> AgradCdfParetoType2_vv_400;
+typedef std::tuple<AgradCdfParetoType2, type_vv_401> AgradCdfParetoType2_vv_401;
+typedef std::tuple<AgradCdfParetoType2, type_vv_402> AgradCdfParetoType2_vv_402;
+typedef std::tuple<AgradCdfParetoType2, type_vv_403> AgradCdfParetoType2_vv_403;
+typedef std::tuple<AgradCdfParetoType2, type_vv_404> AgradCdfParetoType2_vv_404;
+typedef std::tuple<AgradCdfParetoType2, type_vv_405> AgradCdfParetoType2_vv_405;
+typedef std::tuple<AgradCdfParetoType2, type_vv_406> AgradCdfParetoType2_vv_406;
+typedef std::tuple<AgradCdfParetoType2, type_vv_407> AgradCdfParetoType2_vv_407;
+typedef std::tuple<AgradCdfParetoType2, type_vv_408> AgradCdfParetoType2_vv_408;
+typedef std::tuple<AgradCdfParetoType2, type_vv_409> AgradCdfParetoType2_vv_409;
+typedef std::tuple<AgradCdfParetoType2, type_vv_410> AgradCdfParetoType2_vv_410;
+typedef std::tuple<AgradCdfParetoType2, type_vv_411> AgradCdfParetoType2_vv_411;
+typedef std::tuple<AgradCdfParetoType2, type_vv_412> AgradCdfParetoType2_vv_412;
+typedef std::tuple<AgradCdfParetoType2, type_vv_413> AgradCdfParetoType2_vv_413;
+typedef std::tuple<AgradCdfParetoType2, type_vv_414> AgradCdfParetoType2_vv_414;
+typedef std::tuple<AgradCdfParetoType2, type_vv_415> AgradCdfParetoType2_vv_415;
+typedef std::tuple<AgradCdfParetoType2, type_vv_416> AgradCdfParetoType2_vv_416;
+typedef std::tuple<AgradCdfParetoType2, type_vv_417> AgradCdfParetoType2_vv_417;
+typedef std::tuple<AgradCdfParetoType2, type_vv_418> AgradCdfParetoType2_vv_418;
+typedef std::tuple<AgradCdfParetoType2, type_vv_419> AgradCdfParetoType2_vv_419;
+typedef std::tuple<AgradCdfParetoType2, type_vv_420> AgradCdfParetoType2_vv_420;
+typedef std::tuple<AgradCdfParetoType2, type_vv_421> AgradCdfParetoType2_vv_421;
+typedef std::tuple<AgradCdfParetoType2, type_vv_422> AgradCdfParetoType2_vv_422;
+typedef std::tuple<AgradCdfParetoType2, type_vv_423> AgradCdfParetoType2_vv_423;
+typedef std::tuple<AgradCdfParetoType2, type_vv_424> AgradCdfParetoType2_vv_424;
+typedef std::tuple<AgradCdfParetoType2, type_vv_425> AgradCdfParetoType2_vv_425;
+typedef std::tuple<AgradCdfParetoType2, type_vv_426> AgradCdfParetoType2_vv_426;
+typedef std::tuple<AgradCdfParetoType2, type_vv_427> AgradCdfParetoType2_vv_427;
+typedef std::tuple<AgradCdfParetoType2, type_vv_428> AgradCdfParetoType2_vv_428;
+typedef std::tuple<AgradCdfParetoType2, type_vv_429> AgradCdfParetoType2_vv_429;
+typedef std::tuple<AgradCdfParetoType2, type_vv_430> AgradCdfParetoType2_vv_430;
+typedef std::tuple<AgradCdfParetoType2, type_vv_431> AgradCdfParetoType2_vv_431;
+typedef std::tuple<AgradCdfParetoType2, type_vv_432> AgradCdfParetoType2_vv_432;
+typedef std::tuple<AgradCdfParetoType2, type_vv_433> AgradCdfParetoType2_vv_433;
+typedef std::tuple<AgradCdfParetoType2, type_vv_434> AgradCdfParetoType2_vv_434;
+typedef std::tuple<AgradCdfParetoType2, type_vv_435> AgradCdfParetoType2_vv_435;
+typedef std::tuple<AgradCdfParetoType2, type_vv_436> AgradCdfParetoType2_vv_436;
+typedef std::tuple<AgradCdfParetoType2, type_vv_437> AgradCdfParetoType2_vv_437;
+typedef std::tuple<AgradCdfParetoType2, type_vv_438> AgradCdfParetoType2_vv_438;
+typedef std::tuple<AgradCdfParetoType2, type_vv_439> AgradCdfParetoType2_vv_439;
+typedef std::tuple<AgradCdfParetoType2, type_vv_440> AgradCdfParetoType2_vv_440;
+typedef std::tuple<AgradCdfParetoType2, type_vv_441> AgradCdfParetoType2_vv_441;
+typedef std::tuple<AgradCdfParetoType2, type_vv_442> AgradCdfParetoType2_vv_442;
+typedef std::tuple<AgradCdfParetoType2, type_vv_443> AgradCdfParetoType2_vv_443;
+typedef std::tuple<AgradCdfParetoType2, type_vv_444> AgradCdfParetoType2_vv_444;
+typedef std::tuple<AgradCdfParetoType2, type_vv_445> AgradCdfParetoType2_vv_445;
+typedef std::tuple<AgradCdfParetoType2, type_vv_446> AgradCdfParetoType2_vv_446;
+typedef std::tuple<AgradCdfParetoType2, type_vv_447> AgradCdfParetoType2_vv_447;
+typedef std::tuple<AgradCdfParetoType2, type_vv_448> AgradCdfParetoType2_vv_448;
+typedef std::tuple<AgradCdfParetoType2, type_vv_449> AgradCdfParetoType2_vv_449;
+typedef std::tuple<AgradCdfParetoType2, type_vv_450> AgradCdfParetoType2_vv_450;
+typedef std::tuple<AgradCdfParetoType2, type_vv_451> AgradCdfParetoType2_vv_451;
+typedef std::tuple<AgradCdfParetoType2, type_vv_452> AgradCdfParetoType2_vv_452;
+typedef std::tuple<AgradCdfParetoType2, type_vv_453> AgradCdfParetoType2_vv_453;
+typedef std::tuple<AgradCdfParetoType2, type_vv_454> AgradCdfParetoType2_vv_454;
+typedef std::tuple<AgradCdfParetoType2, type_vv_455> AgradCdfParetoType2_vv_455;
+typedef std::tuple<AgradCdfParetoType2, type_vv_456> AgradCdfParetoType2_vv_456;
+typedef std::tuple<AgradCdfParetoType2, type_vv_457> AgradCdfParetoType2_vv_457;
+typedef std::tuple<AgradCdfParetoType2, type_vv_458> AgradCdfParetoType2_vv_458;
+typedef std::tuple<AgradCdfParetoType2, type_vv_459> AgradCdfParetoType2_vv_459;
+typedef std::tuple<AgradCdfParetoType2, type_vv_460> AgradCdfParetoType2_vv_460;
+typedef std::tuple<AgradCdfParetoType2, type_vv_461> AgradCdfParetoType2_vv_461;
+typedef std::tuple<AgradCdfParetoType2, type_vv_462> AgradCdfParetoType2_vv_462;
+typedef std::tuple<AgradCdfParetoType2, type_vv_463> AgradCdfParetoType2_vv_463;
+typedef std::tuple<AgradCdfParetoType2, type_vv_464> AgradCdfParetoType2_vv_464;
+typedef std::tuple<AgradCdfParetoType2, type_vv_465> AgradCdfParetoType2_vv_465;
+typedef std::tuple<AgradCdfParetoType2, type_vv_466> AgradCdfParetoType2_vv_466;
+typedef std::tuple<AgradCdfParetoType2, type_vv_467> AgradCdfParetoType2_vv_467;
+typedef std::tuple<AgradCdfParetoType2, type_vv_468> AgradCdfParetoType2_vv_468;
+typedef std::tuple<AgradCdfParetoType2, type_vv_469> AgradCdfParetoType2_vv_469;
+typedef std::tuple<AgradCdfParetoType2, type_vv_470> AgradCdfParetoType2_vv_470;
+typedef std::tuple<AgradCdfParetoType2, type_vv_471> AgradCdfParetoType2_vv_471;
+typedef std::tuple<AgradCdfParetoType2, type_vv_472> AgradCdfParetoType2_vv_472;
+typedef std::tuple<AgradCdfParetoType2, type_vv_473> AgradCdfParetoType2_vv_473;
+typedef std::tuple<AgradCdfParetoType2, type_vv_474> AgradCdfParetoType2_vv_474;
+typedef std::tuple<AgradCdfParetoType2, type_vv_475> AgradCdfParetoType2_vv_475;
+typedef std::tuple<AgradCdfParetoType2, type_vv_476> AgradCdfParetoType2_vv_476;
+typedef std::tuple<AgradCdfParetoType2, type_vv_477> AgradCdfParetoType2_vv_477;
+typedef std::tuple<AgradCdfParetoType2, type_vv_478> AgradCdfParetoType2_vv_478;
+typedef std::tuple<AgradCdfParetoType2, type_vv_479> AgradCdfParetoType2_vv_479;
+typedef std::tuple<AgradCdfParetoType2, type_vv_480> AgradCdfParetoType2_vv_480;
+typedef std::tuple<AgradCdfParetoType2, type_vv_481> AgradCdfParetoType2_vv_481;
+typedef std::tuple<AgradCdfParetoType2, type_vv_482> AgradCdfParetoType2_vv_482;
+typedef std::tuple<AgradCdfParetoType2, type_vv_483> AgradCdfParetoType2_vv_483;
+typedef std::tuple<AgradCdfParetoType2, type_vv_484> AgradCdfParetoType2_vv_484;
+typedef std::tuple<AgradCdfParetoType2, type_vv_485> AgradCdfParetoType2_vv_485;
+typedef std::tuple<AgradCdfParetoType2, type_vv_486> AgradCdfParetoType2_vv_486;
+typedef std::tuple<AgradCdfParetoType2, type_vv_487> AgradCdfParetoType2_vv_487;
+typedef std::tuple<AgradCdfParetoType2, type_vv_488> AgradCdfParetoType2_vv_488;
+typedef std::tuple<AgradCdfParetoType2, type_vv_489> AgradCdfParetoType2_vv_489;
+typedef std::tuple<AgradCdfParetoType2, type_vv_490> AgradCdfParetoType2_vv_490;
+typedef std::tuple<AgradCdfParetoType2, type_vv_491> AgradCdfParetoType2_vv_491;
+typedef std::tuple<AgradCdfParetoType2, type_vv_492> AgradCdfParetoType2_vv_492;
+typedef std::tuple<AgradCdfParetoType2, type_vv_493> AgradCdfParetoType2_vv_493;
+typedef std::tuple<AgradCdfParetoType2, type_vv_494> AgradCdfParetoType2_vv_494;
+typedef std::tuple<AgradCdfParetoType2, type_vv_495> AgradCdfParetoType2_vv_495;
+typedef std::tuple<AgradCdfParetoType2, type_vv_496> AgradCdfParetoType2_vv_496;
+typedef std::tuple<AgradCdfParetoType2, type_vv_497> AgradCdfParetoType2_vv_497;
+typedef std::tuple<AgradCdfParetoType2, type_vv_498> AgradCdfParetoType2_vv_498;
+typedef std::tuple<AgradCdfParetoType2, type_vv_499> AgradCdfParetoType2_vv_499;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_400, AgradCdfTestFixture, AgradCdfParetoType2_vv_400);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_401, AgradCdfTestFixture, AgradCdfParetoType2_vv_401);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_402, AgradCdfTestFixture, AgradCdfParetoType2_vv_402);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_403, AgradCdfTestFixture, AgradCdfParetoType2_vv_403);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_404, AgradCdfTestFixture, AgradCdfParetoType2_vv_404);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_405, AgradCdfTestFixture, AgradCdfParetoType2_vv_405);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_406, AgradCdfTestFixture, AgradCdfParetoType2_vv_406);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_407, AgradCdfTestFixture, AgradCdfParetoType2_vv_407);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_408, AgradCdfTestFixture, AgradCdfParetoType2_vv_408);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_409, AgradCdfTestFixture, AgradCdfParetoType2_vv_409);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_410, AgradCdfTestFixture, AgradCdfParetoType2_vv_410);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_411, AgradCdfTestFixture, AgradCdfParetoType2_vv_411);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_412, AgradCdfTestFixture, AgradCdfParetoType2_vv_412);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_413, AgradCdfTestFixture, AgradCdfParetoType2_vv_413);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_414, AgradCdfTestFixture, AgradCdfParetoType2_vv_414);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_415, AgradCdfTestFixture, AgradCdfParetoType2_vv_415);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_416, AgradCdfTestFixture, AgradCdfParetoType2_vv_416);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_417, AgradCdfTestFixture, AgradCdfParetoType2_vv_417);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_418, AgradCdfTestFixture, AgradCdfParetoType2_vv_418);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_419, AgradCdfTestFixture, AgradCdfParetoType2_vv_419);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_420, AgradCdfTestFixture, AgradCdfParetoType2_vv_420);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_421, AgradCdfTestFixture, AgradCdfParetoType2_vv_421);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_422, AgradCdfTestFixture, AgradCdfParetoType2_vv_422);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_423, AgradCdfTestFixture, AgradCdfParetoType2_vv_423);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_424, AgradCdfTestFixture, AgradCdfParetoType2_vv_424);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_425, AgradCdfTestFixture, AgradCdfParetoType2_vv_425);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_426, AgradCdfTestFixture, AgradCdfParetoType2_vv_426);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_427, AgradCdfTestFixture, AgradCdfParetoType2_vv_427);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_428, AgradCdfTestFixture, AgradCdfParetoType2_vv_428);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_429, AgradCdfTestFixture, AgradCdfParetoType2_vv_429);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_430, AgradCdfTestFixture, AgradCdfParetoType2_vv_430);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_431, AgradCdfTestFixture, AgradCdfParetoType2_vv_431);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_432, AgradCdfTestFixture, AgradCdfParetoType2_vv_432);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_433, AgradCdfTestFixture, AgradCdfParetoType2_vv_433);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_434, AgradCdfTestFixture, AgradCdfParetoType2_vv_434);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_435, AgradCdfTestFixture, AgradCdfParetoType2_vv_435);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_436, AgradCdfTestFixture, AgradCdfParetoType2_vv_436);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_437, AgradCdfTestFixture, AgradCdfParetoType2_vv_437);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_438, AgradCdfTestFixture, AgradCdfParetoType2_vv_438);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_439, AgradCdfTestFixture, AgradCdfParetoType2_vv_439);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_440, AgradCdfTestFixture, AgradCdfParetoType2_vv_440);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_441, AgradCdfTestFixture, AgradCdfParetoType2_vv_441);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_442, AgradCdfTestFixture, AgradCdfParetoType2_vv_442);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_443, AgradCdfTestFixture, AgradCdfParetoType2_vv_443);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_444, AgradCdfTestFixture, AgradCdfParetoType2_vv_444);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_445, AgradCdfTestFixture, AgradCdfParetoType2_vv_445);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_446, AgradCdfTestFixture, AgradCdfParetoType2_vv_446);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_447, AgradCdfTestFixture, AgradCdfParetoType2_vv_447);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_448, AgradCdfTestFixture, AgradCdfParetoType2_vv_448);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_449, AgradCdfTestFixture, AgradCdfParetoType2_vv_449);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_450, AgradCdfTestFixture, AgradCdfParetoType2_vv_450);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_451, AgradCdfTestFixture, AgradCdfParetoType2_vv_451);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_452, AgradCdfTestFixture, AgradCdfParetoType2_vv_452);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_453, AgradCdfTestFixture, AgradCdfParetoType2_vv_453);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_454, AgradCdfTestFixture, AgradCdfParetoType2_vv_454);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_455, AgradCdfTestFixture, AgradCdfParetoType2_vv_455);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_456, AgradCdfTestFixture, AgradCdfParetoType2_vv_456);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_457, AgradCdfTestFixture, AgradCdfParetoType2_vv_457);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_458, AgradCdfTestFixture, AgradCdfParetoType2_vv_458);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_459, AgradCdfTestFixture, AgradCdfParetoType2_vv_459);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_460, AgradCdfTestFixture, AgradCdfParetoType2_vv_460);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_461, AgradCdfTestFixture, AgradCdfParetoType2_vv_461);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_462, AgradCdfTestFixture, AgradCdfParetoType2_vv_462);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_463, AgradCdfTestFixture, AgradCdfParetoType2_vv_463);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_464, AgradCdfTestFixture, AgradCdfParetoType2_vv_464);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_465, AgradCdfTestFixture, AgradCdfParetoType2_vv_465);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_466, AgradCdfTestFixture, AgradCdfParetoType2_vv_466);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_467, AgradCdfTestFixture, AgradCdfParetoType2_vv_467);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_468, AgradCdfTestFixture, AgradCdfParetoType2_vv_468);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_469, AgradCdfTestFixture, AgradCdfParetoType2_vv_469);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_470, AgradCdfTestFixture, AgradCdfParetoType2_vv_470);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_471, AgradCdfTestFixture, AgradCdfParetoType2_vv_471);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_472, AgradCdfTestFixture, AgradCdfParetoType2_vv_472);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_473, AgradCdfTestFixture, AgradCdfParetoType2_vv_473);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_474, AgradCdfTestFixture, AgradCdfParetoType2_vv_474);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_475, AgradCdfTestFixture, AgradCdfParetoType2_vv_475);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_476, AgradCdfTestFixture, AgradCdfParetoType2_vv_476);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_477, AgradCdfTestFixture, AgradCdfParetoType2_vv_477);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_478, AgradCdfTestFixture, AgradCdfParetoType2_vv_478);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_479, AgradCdfTestFixture, AgradCdfParetoType2_vv_479);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_480, AgradCdfTestFixture, AgradCdfParetoType2_vv_480);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_481, AgradCdfTestFixture, AgradCdfParetoType2_vv_481);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_482, AgradCdfTestFixture, AgradCdfParetoType2_vv_482);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_483, AgradCdfTestFixture, AgradCdfParetoType2_vv_483);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_484, AgradCdfTestFixture, AgradCdfParetoType2_vv_484);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_485, AgradCdfTestFixture, AgradCdfParetoType2_vv_485);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_486, AgradCdfTestFixture, AgradCdfParetoType2_vv_486);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_487, AgradCdfTestFixture, AgradCdfParetoType2_vv_487);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_488, AgradCdfTestFixture, AgradCdfParetoType2_vv_488);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_489, AgradCdfTestFixture, AgradCdfParetoType2_vv_489);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_490, AgradCdfTestFixture, AgradCdfParetoType2_vv_490);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_491, AgradCdfTestFixture, AgradCdfParetoType2_vv_491);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_492, AgradCdfTestFixture, AgradCdfParetoType2_vv_492);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_493, AgradCdfTestFixture, AgradCdfParetoType2_vv_493);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_494, AgradCdfTestFixture, AgradCdfParetoType2_vv_494);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_495, AgradCdfTestFixture, AgradCdfParetoType2_vv_495);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_496, AgradCdfTestFixture, AgradCdfParetoType2_vv_496);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_497, AgradCdfTestFixture, AgradCdfParetoType2_vv_497);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_498, AgradCdfTestFixture, AgradCdfParetoType2_vv_498);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_499, AgradCdfTestFixture, AgradCdfParetoType2_vv_499);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_cdf_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_500;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty, empty> type_ffv_501;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_502;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_503;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_504;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_505;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_506;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_507;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_508;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_509;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_510;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_511;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_512;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty, empty> type_ffv_513;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_514;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_515;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_516;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_517;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_518;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_519;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_520;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_521;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_522;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_523;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_524;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_525;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_526;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_527;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_528;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_529;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_530;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty, empty> type_ffv_531;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_ffv_532;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_533;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_534;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_535;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_536;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_ffv_537;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_538;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_539;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_540;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_541;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_542;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_543;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_544;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_545;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_546;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_547;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_548;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_549;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_550;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_551;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_552;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_553;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_554;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_555;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_556;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_557;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_558;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_559;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_560;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_561;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_562;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_563;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_564;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_565;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_566;
+typedef std::tuple<fvar<fvar<var> >, double, double, double, empty, empty> type_ffv_567;
+typedef std::tuple<fvar<fvar<var> >, double, double, std::vector<double>, empty, empty> type_ffv_568;
+typedef std::tuple<fvar<fvar<var> >, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_569;
+typedef std::tuple<fvar<fvar<var> >, double, double, fvar<fvar<var> >, empty, empty> type_ffv_570;
+typedef std::tuple<fvar<fvar<var> >, double, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_571;
+typedef std::tuple<fvar<fvar<var> >, double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_572;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<double>, double, empty, empty> type_ffv_573;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<double>, std::vector<double>, empty, empty> type_ffv_574;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_575;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_576;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_577;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_578;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_579;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_580;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_581;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_582;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_583;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_584;
+typedef std::tuple<fvar<fvar<var> >, double, fvar<fvar<var> >, double, empty, empty> type_ffv_585;
+typedef std::tuple<fvar<fvar<var> >, double, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_586;
+typedef std::tuple<fvar<fvar<var> >, double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_587;
+typedef std::tuple<fvar<fvar<var> >, double, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_588;
+typedef std::tuple<fvar<fvar<var> >, double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_589;
+typedef std::tuple<fvar<fvar<var> >, double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_590;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_591;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_592;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_593;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_594;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_595;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_596;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_597;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_598;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_599;
+
+typedef std::tuple<AgradCdfParetoType2, type_ffv_500> AgradCdfParetoType2_ffv_500;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_501> AgradCdfParetoType2_ffv_501;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_502> AgradCdfParetoType2_ffv_502;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_503> AgradCdfParetoType2_ffv_503;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_504> AgradCdfParetoType2_ffv_504;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_505> AgradCdfParetoType2_ffv_505;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_506> AgradCdfParetoType2_ffv_506;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_507> AgradCdfParetoType2_ffv_507;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_508> AgradCdfParetoType2_ffv_508;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_509> AgradCdfParetoType2_ffv_509;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_510> AgradCdfParetoType2_ffv_510;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_511> AgradCdfParetoType2_ffv_511;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_512> AgradCdfParetoType2_ffv_512;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_513> AgradCdfParetoType2_ffv_513;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_514> AgradCdfParetoType2_ffv_514;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_515> AgradCdfParetoType2_ffv_515;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_516> AgradCdfParetoType2_ffv_516;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_517> AgradCdfParetoType2_ffv_517;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_518> AgradCdfParetoType2_ffv_518;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_519> AgradCdfParetoType2_ffv_519;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_520> AgradCdfParetoType2_ffv_520;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_521> AgradCdfParetoType2_ffv_521;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_522> AgradCdfParetoType2_ffv_522;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_523> AgradCdfParetoType2_ffv_523;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_524> AgradCdfParetoType2_ffv_524;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_525> AgradCdfParetoType2_ffv_525;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_526> AgradCdfParetoType2_ffv_526;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_527> AgradCdfParetoType2_ffv_527;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_528> AgradCdfParetoType2_ffv_528;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_529> AgradCdfParetoType2_ffv_529;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_530> AgradCdfParetoType2_ffv_530;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_531> AgradCdfParetoType2_ffv_531;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_532> AgradCdfParetoType2_ffv_532;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_533> AgradCdfParetoType2_ffv_533;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_534> AgradCdfParetoType2_ffv_534;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_535> AgradCdfParetoType2_ffv_535;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_536> AgradCdfParetoType2_ffv_536;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_537> AgradCdfParetoType2_ffv_537;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_538> AgradCdfParetoType2_ffv_538;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_539> AgradCdfParetoType2_ffv_539;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_540> AgradCdfParetoType2_ffv_540;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_541> AgradCdfParetoType2_ffv_541;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_542> AgradCdfParetoType2_ffv_542;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_543> AgradCdfParetoType2_ffv_543;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_544> AgradCdfParetoType2_ffv_544;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_545> AgradCdfParetoType2_ffv_545;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_546> AgradCdfParetoType2_ffv_546;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_547> AgradCdfParetoType2_ffv_547;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_548> AgradCdfParetoType2_ffv_548;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_549> AgradCdfParetoType2_ffv_549;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_550> AgradCdfParetoType2_ffv_550;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_551> AgradCdfParetoType2_ffv_551;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_552> AgradCdfParetoType2_ffv_552;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_553> AgradCdfParetoType2_ffv_553;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_554> AgradCdfParetoType2_ffv_554;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_555> AgradCdfParetoType2_ffv_555;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_556> AgradCdfParetoType2_ffv_556;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_557> AgradCdfParetoType2_ffv_557;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_558> AgradCdfParetoType2_ffv_558;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_559> AgradCdfParetoType2_ffv_559;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_560> AgradCdfParetoType2_ffv_560;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_561> AgradCdfParetoType2_ffv_561;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_562> AgradCdfParetoType2_ffv_562;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_563> AgradCdfParetoType2_ffv_563;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_564> AgradCdfParetoType2_ffv_564;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_565> AgradCdfParetoType2_ffv_565;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_566> AgradCdfParetoType2_ffv_566;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_567> AgradCdfParetoType2_ffv_567;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_568> AgradCdfParetoType2_ffv_568;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_569> AgradCdfParetoType2_ffv_569;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_570> AgradCdfParetoType2_ffv_570;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_571> AgradCdfParetoType2_ffv_571;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_572> AgradCdfParetoType2_ffv_572;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_573> AgradCdfParetoType2_ffv_573;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_574> AgradCdfParetoType2_ffv_574;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_575> AgradCdfParetoType2_ffv_575;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_576> AgradCdfParetoType2_ffv_576;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_577> AgradCdfParetoType2_ffv_577;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_578> AgradCdfParetoType2_ffv_578;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_579> AgradCdfParetoType2_ffv_579;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_580> AgradCdfParetoType2_ffv_580;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_581> AgradCdfParetoType2_ffv_581;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_582> AgradCdfParetoType2_ffv_582;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_583> AgradCdfParetoType2_ffv_583;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_584> AgradCdfParetoType2_ffv_584;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_585> AgradCdfParetoType2_ffv_585;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_586> AgradCdfParetoType2_ffv_586;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_587> AgradCdfParetoType2_ffv_587;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_588> AgradCdfParetoType2_ffv_588;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_589> AgradCdfParetoType2_ffv_589;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_590> AgradCdfParetoType2_ffv_590;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_591> AgradCdfParetoType2_ffv_591;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_592> AgradCdfParetoType2_ffv_592;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_593> AgradCdfParetoType2_ffv_593;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_594> AgradCdfParetoType2_ffv_594;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_595> AgradCdfParetoType2_ffv_595;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_596> AgradCdfParetoType2_ffv_596;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_597> AgradCdfParetoType2_ffv_597;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_598> AgradCdfParetoType2_ffv_598;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_599> AgradCdfParetoType2_ffv_599;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_500, AgradCdfTestFixture, AgradCdfParetoType2_ffv_500);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_501, AgradCdfTestFixture, AgradCdfParetoType2_ffv_501);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_502, AgradCdfTestFixture, AgradCdfParetoType2_ffv_502);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_503, AgradCdfTestFixture, AgradCdfParetoType2_ffv_503);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_504, AgradCdfTestFixture, AgradCdfParetoType2_ffv_504);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_505, AgradCdfTestFixture, AgradCdfParetoType2_ffv_505);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_506, AgradCdfTestFixture, AgradCdfParetoType2_ffv_506);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_507, AgradCdfTestFixture, AgradCdfParetoType2_ffv_507);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_508, AgradCdfTestFixture, AgradCdfParetoType2_ffv_508);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_509, AgradCdfTestFixture, AgradCdfParetoType2_ffv_509);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_510, AgradCdfTestFixture, AgradCdfParetoType2_ffv_510);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_511, AgradCdfTestFixture, AgradCdfParetoType2_ffv_511);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_512, AgradCdfTestFixture, AgradCdfParetoType2_ffv_512);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_513, AgradCdfTestFixture, AgradCdfParetoType2_ffv_513);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_514, AgradCdfTestFixture, AgradCdfParetoType2_ffv_514);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_515, AgradCdfTestFixture, AgradCdfParetoType2_ffv_515);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_516, AgradCdfTestFixture, AgradCdfParetoType2_ffv_516);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_517, AgradCdfTestFixture, AgradCdfParetoType2_ffv_517);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_518, AgradCdfTestFixture, AgradCdfParetoType2_ffv_518);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_519, AgradCdfTestFixture, AgradCdfParetoType2_ffv_519);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_520, AgradCdfTestFixture, AgradCdfParetoType2_ffv_520);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_521, AgradCdfTestFixture, AgradCdfParetoType2_ffv_521);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_522, AgradCdfTestFixture, AgradCdfParetoType2_ffv_522);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_523, AgradCdfTestFixture, AgradCdfParetoType2_ffv_523);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_524, AgradCdfTestFixture, AgradCdfParetoType2_ffv_524);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_525, AgradCdfTestFixture, AgradCdfParetoType2_ffv_525);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_526, AgradCdfTestFixture, AgradCdfParetoType2_ffv_526);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_527, AgradCdfTestFixture, AgradCdfParetoType2_ffv_527);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_528, AgradCdfTestFixture, AgradCdfParetoType2_ffv_528);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_529, AgradCdfTestFixture, AgradCdfParetoType2_ffv_529);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_530, AgradCdfTestFixture, AgradCdfParetoType2_ffv_530);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_531, AgradCdfTestFixture, AgradCdfParetoType2_ffv_531);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_532, AgradCdfTestFixture, AgradCdfParetoType2_ffv_532);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_533, AgradCdfTestFixture, AgradCdfParetoType2_ffv_533);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_534, AgradCdfTestFixture, AgradCdfParetoType2_ffv_534);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_535, AgradCdfTestFixture, AgradCdfParetoType2_ffv_535);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_536, AgradCdfTestFixture, AgradCdfParetoType2_ffv_536);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_537, AgradCdfTestFixture, AgradCdfParetoType2_ffv_537);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_538, AgradCdfTestFixture, AgradCdfParetoType2_ffv_538);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_539, AgradCdfTestFixture, AgradCdfParetoType2_ffv_539);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_540, AgradCdfTestFixture, AgradCdfParetoType2_ffv_540);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_541, AgradCdfTestFixture, AgradCdfParetoType2_ffv_541);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_542, AgradCdfTestFixture, AgradCdfParetoType2_ffv_542);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_543, AgradCdfTestFixture, AgradCdfParetoType2_ffv_543);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_544, AgradCdfTestFixture, AgradCdfParetoType2_ffv_544);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_545, AgradCdfTestFixture, AgradCdfParetoType2_ffv_545);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_546, AgradCdfTestFixture, AgradCdfParetoType2_ffv_546);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_547, AgradCdfTestFixture, AgradCdfParetoType2_ffv_547);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_548, AgradCdfTestFixture, AgradCdfParetoType2_ffv_548);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_549, AgradCdfTestFixture, AgradCdfParetoType2_ffv_549);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_550, AgradCdfTestFixture, AgradCdfParetoType2_ffv_550);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_551, AgradCdfTestFixture, AgradCdfParetoType2_ffv_551);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_552, AgradCdfTestFixture, AgradCdfParetoType2_ffv_552);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_553, AgradCdfTestFixture, AgradCdfParetoType2_ffv_553);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_554, AgradCdfTestFixture, AgradCdfParetoType2_ffv_554);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_555, AgradCdfTestFixture, AgradCdfParetoType2_ffv_555);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_556, AgradCdfTestFixture, AgradCdfParetoType2_ffv_556);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_557, AgradCdfTestFixture, AgradCdfParetoType2_ffv_557);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_558, AgradCdfTestFixture, AgradCdfParetoType2_ffv_558);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_559, AgradCdfTestFixture, AgradCdfParetoType2_ffv_559);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_560, AgradCdfTestFixture, AgradCdfParetoType2_ffv_560);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_561, AgradCdfTestFixture, AgradCdfParetoType2_ffv_561);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_562, AgradCdfTestFixture, AgradCdfParetoType2_ffv_562);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_563, AgradCdfTestFixture, AgradCdfParetoType2_ffv_563);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_564, AgradCdfTestFixture, AgradCdfParetoType2_ffv_564);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_565, AgradCdfTestFixture, AgradCdfParetoType2_ffv_565);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_566, AgradCdfTestFixture, AgradCdfParetoType2_ffv_566);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_567, AgradCdfTestFixture, AgradCdfParetoType2_ffv_567);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_568, AgradCdfTestFixture, AgradCdfParetoType2_ffv_568);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_569, AgradCdfTestFixture, AgradCdfParetoType2_ffv_569);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_570, AgradCdfTestFixture, AgradCdfParetoType2_ffv_570);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_571, AgradCdfTestFixture, AgradCdfParetoType2_ffv_571);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_572, AgradCdfTestFixture, AgradCdfParetoType2_ffv_572);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_573, AgradCdfTestFixture, AgradCdfParetoType2_ffv_573);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_574, AgradCdfTestFixture, AgradCdfParetoType2_ffv_574);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_575, AgradCdfTestFixture, AgradCdfParetoType2_ffv_575);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_576, AgradCdfTestFixture, AgradCdfParetoType2_ffv_576);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_577, AgradCdfTestFixture, AgradCdfParetoType2_ffv_577);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_578, AgradCdfTestFixture, AgradCdfParetoType2_ffv_578);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_579, AgradCdfTestFixture, AgradCdfParetoType2_ffv_579);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_580, AgradCdfTestFixture, AgradCdfParetoType2_ffv_580);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_581, AgradCdfTestFixture, AgradCdfParetoType2_ffv_581);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_582, AgradCdfTestFixture, AgradCdfParetoType2_ffv_582);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_583, AgradCdfTestFixture, AgradCdfParetoType2_ffv_583);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_584, AgradCdfTestFixture, AgradCdfParetoType2_ffv_584);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_585, AgradCdfTestFixture, AgradCdfParetoType2_ffv_585);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_586, AgradCdfTestFixture, AgradCdfParetoType2_ffv_586);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_587, AgradCdfTestFixture, AgradCdfParetoType2_ffv_587);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_588, AgradCdfTestFixture, AgradCdfParetoType2_ffv_588);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_589, AgradCdfTestFixture, AgradCdfParetoType2_ffv_589);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_590, AgradCdfTestFixture, AgradCdfParetoType2_ffv_590);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_591, AgradCdfTestFixture, AgradCdfParetoType2_ffv_591);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_592, AgradCdfTestFixture, AgradCdfParetoType2_ffv_592);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_593, AgradCdfTestFixture, AgradCdfParetoType2_ffv_593);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_594, AgradCdfTestFixture, AgradCdfParetoType2_ffv_594);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_595, AgradCdfTestFixture, AgradCdfParetoType2_ffv_595);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_596, AgradCdfTestFixture, AgradCdfParetoType2_ffv_596);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_597, AgradCdfTestFixture, AgradCdfParetoType2_ffv_597);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_598, AgradCdfTestFixture, AgradCdfParetoType2_ffv_598);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_599, AgradCdfTestFixture, AgradCdfParetoType2_ffv_599);
+
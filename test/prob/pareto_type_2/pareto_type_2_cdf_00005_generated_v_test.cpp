@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_cdf_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_500;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_501;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_502;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_503;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_504;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_505;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_506;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_507;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_508;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_509;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_510;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_511;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_512;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_513;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_514;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_515;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_516;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_517;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_518;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_519;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_520;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_521;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_522;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_523;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_524;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_525;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_526;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_527;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_528;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_529;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_530;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_531;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_532;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_533;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_534;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_535;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_536;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_537;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_538;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_539;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, double, empty, empty> type_v_540;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, std::vector<double>, empty, empty> type_v_541;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_542;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, var, empty, empty> type_v_543;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, std::vector<var>, empty, empty> type_v_544;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_545;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, double, empty, empty> type_v_546;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, std::vector<double>, empty, empty> type_v_547;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_548;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, var, empty, empty> type_v_549;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, std::vector<var>, empty, empty> type_v_550;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_551;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_552;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_553;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_554;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_555;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_556;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_557;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, double, empty, empty> type_v_558;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, std::vector<double>, empty, empty> type_v_559;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_560;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, var, empty, empty> type_v_561;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, std::vector<var>, empty, empty> type_v_562;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_563;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, double, empty, empty> type_v_564;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, std::vector<double>, empty, empty> type_v_565;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_566;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, var, empty, empty> type_v_567;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, std::vector<var>, empty, empty> type_v_568;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_569;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_570;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_571;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_572;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_573;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_574;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_575;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, double, empty, empty> type_v_576;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, std::vector<double>, empty, empty> type_v_577;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_578;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, var, empty, empty> type_v_579;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, std::vector<var>, empty, empty> type_v_580;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_581;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, double, empty, empty> type_v_582;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_v_583;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_584;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, var, empty, empty> type_v_585;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_v_586;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_587;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_588;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_589;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_590;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_591;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_592;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_593;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, double, empty, empty> type_v_594;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, std::vector<double>, empty, empty> type_v_595;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_596;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, var, empty, empty> type_v_597;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, std::vector<var>, empty, empty> type_v_598;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_599;
+
+typedef std::tuple<AgradCdfParetoType2, type_v_500> AgradCdfParetoType2_v_500;
+typedef std::tuple<AgradCdfParetoType2, type_v_501> AgradCdfParetoType2_v_501;
+typedef std::tuple<AgradCdfParetoType2, type_v_502> AgradCdfParetoType2_v_502;
+typedef std::tuple<AgradCdfParetoType2, type_v_503> AgradCdfParetoType2_v_503;
+typedef std::tuple<AgradCdfParetoType2, type_v_504> AgradCdfParetoType2_v_504;
+typedef std::tuple<AgradCdfParetoType2, type_v_505> AgradCdfParetoType2_v_505;
+typedef std::tuple<AgradCdfParetoType2, type_v_506> AgradCdfParetoType2_v_506;
+typedef std::tuple<AgradCdfParetoType2, type_v_507> AgradCdfParetoType2_v_507;
+typedef std::tuple<AgradCdfParetoType2, type_v_508> AgradCdfParetoType2_v_508;
+typedef std::tuple<AgradCdfParetoType2, type_v_509> AgradCdfParetoType2_v_509;
+typedef std::tuple<AgradCdfParetoType2, type_v_510> AgradCdfParetoType2_v_510;
+typedef std::tuple<AgradCdfParetoType2, type_v_511> AgradCdfParetoType2_v_511;
+typedef std::tuple<AgradCdfParetoType2, type_v_512> AgradCdfParetoType2_v_512;
+typedef std::tuple<AgradCdfParetoType2, type_v_513> AgradCdfParetoType2_v_513;
+typedef std::tuple<AgradCdfParetoType2, type_v_514> AgradCdfParetoType2_v_514;
+typedef std::tuple<AgradCdfParetoType2, type_v_515> AgradCdfParetoType2_v_515;
+typedef std::tuple<AgradCdfParetoType2, type_v_516> AgradCdfParetoType2_v_516;
+typedef std::tuple<AgradCdfParetoType2, type_v_517> AgradCdfParetoType2_v_517;
+typedef std::tuple<AgradCdfParetoType2, type_v_518> AgradCdfParetoType2_v_518;
+typedef std::tuple<AgradCdfParetoType2, type_v_519> AgradCdfParetoType2_v_519;
+typedef std::tuple<AgradCdfParetoType2, type_v_520> AgradCdfParetoType2_v_520;
+typedef std::tuple<AgradCdfParetoType2, type_v_521> AgradCdfParetoType2_v_521;
+typedef std::tuple<AgradCdfParetoType2, type_v_522> AgradCdfParetoType2_v_522;
+typedef std::tuple<AgradCdfParetoType2, type_v_523> AgradCdfParetoType2_v_523;
+typedef std::tuple<AgradCdfParetoType2, type_v_524> AgradCdfParetoType2_v_524;
+typedef std::tuple<AgradCdfParetoType2, type_v_525> AgradCdfParetoType2_v_525;
+typedef std::tuple<AgradCdfParetoType2, type_v_526> AgradCdfParetoType2_v_526;
+typedef std::tuple<AgradCdfParetoType2, type_v_527> AgradCdfParetoType2_v_527;
+typedef std::tuple<AgradCdfParetoType2, type_v_528> AgradCdfParetoType2_v_528;
+typedef std::tuple<AgradCdfParetoType2, type_v_529> AgradCdfParetoType2_v_529;
+typedef std::tuple<AgradCdfParetoType2, type_v_530> AgradCdfParetoType2_v_530;
+typedef std::tuple<AgradCdfParetoType2, type_v_531> AgradCdfParetoType2_v_531;
+typedef std::tuple<AgradCdfParetoType2, type_v_532> AgradCdfParetoType2_v_532;
+typedef std::tuple<AgradCdfParetoType2, type_v_533> AgradCdfParetoType2_v_533;
+typedef std::tuple<AgradCdfParetoType2, type_v_534> AgradCdfParetoType2_v_534;
+typedef std::tuple<AgradCdfParetoType2, type_v_535> AgradCdfParetoType2_v_535;
+typedef std::tuple<AgradCdfParetoType2, type_v_536> AgradCdfParetoType2_v_536;
+typedef std::tuple<AgradCdfParetoType2, type_v_537> AgradCdfParetoType2_v_537;
+typedef std::tuple<AgradCdfParetoType2, type_v_538> AgradCdfParetoType2_v_538;
+typedef std::tuple<AgradCdfParetoType2, type_v_539> AgradCdfParetoType2_v_539;
+typedef std::tuple<AgradCdfParetoType2, type_v_540> AgradCdfParetoType2_v_540;
+typedef std::tuple<AgradCdfParetoType2, type_v_541> AgradCdfParetoType2_v_541;
+typedef std::tuple<AgradCdfParetoType2, type_v_542> AgradCdfParetoType2_v_542;
+typedef std::tuple<AgradCdfParetoType2, type_v_543> AgradCdfParetoType2_v_543;
+typedef std::tuple<AgradCdfParetoType2, type_v_544> AgradCdfParetoType2_v_544;
+typedef std::tuple<AgradCdfParetoType2, type_v_545> AgradCdfParetoType2_v_545;
+typedef std::tuple<AgradCdfParetoType2, type_v_546> AgradCdfParetoType2_v_546;
+typedef std::tuple<AgradCdfParetoType2, type_v_547> AgradCdfParetoType2_v_547;
+typedef std::tuple<AgradCdfParetoType2, type_v_548> AgradCdfParetoType2_v_548;
+typedef std::tuple<AgradCdfParetoType2, type_v_549> AgradCdfParetoType2_v_549;
+typedef std::tuple<AgradCdfParetoType2, type_v_550> AgradCdfParetoType2_v_550;
+typedef std::tuple<AgradCdfParetoType2, type_v_551> AgradCdfParetoType2_v_551;
+typedef std::tuple<AgradCdfParetoType2, type_v_552> AgradCdfParetoType2_v_552;
+typedef std::tuple<AgradCdfParetoType2, type_v_553> AgradCdfParetoType2_v_553;
+typedef std::tuple<AgradCdfParetoType2, type_v_554> AgradCdfParetoType2_v_554;
+typedef std::tuple<AgradCdfParetoType2, type_v_555> AgradCdfParetoType2_v_555;
+typedef std::tuple<AgradCdfParetoType2, type_v_556> AgradCdfParetoType2_v_556;
+typedef std::tuple<AgradCdfParetoType2, type_v_557> AgradCdfParetoType2_v_557;
+typedef std::tuple<AgradCdfParetoType2, type_v_558> AgradCdfParetoType2_v_558;
+typedef std::tuple<AgradCdfParetoType2, type_v_559> AgradCdfParetoType2_v_559;
+typedef std::tuple<AgradCdfParetoType2, type_v_560> AgradCdfParetoType2_v_560;
+typedef std::tuple<AgradCdfParetoType2, type_v_561> AgradCdfParetoType2_v_561;
+typedef std::tuple<AgradCdfParetoType2, type_v_562> AgradCdfParetoType2_v_562;
+typedef std::tuple<AgradCdfParetoType2, type_v_563> AgradCdfParetoType2_v_563;
+typedef std::tuple<AgradCdfParetoType2, type_v_564> AgradCdfParetoType2_v_564;
+typedef std::tuple<AgradCdfParetoType2, type_v_565> AgradCdfParetoType2_v_565;
+typedef std::tuple<AgradCdfParetoType2, type_v_566> AgradCdfParetoType2_v_566;
+typedef std::tuple<AgradCdfParetoType2, type_v_567> AgradCdfParetoType2_v_567;
+typedef std::tuple<AgradCdfParetoType2, type_v_568> AgradCdfParetoType2_v_568;
+typedef std::tuple<AgradCdfParetoType2, type_v_569> AgradCdfParetoType2_v_569;
+typedef std::tuple<AgradCdfParetoType2, type_v_570> AgradCdfParetoType2_v_570;
+typedef std::tuple<AgradCdfParetoType2, type_v_571> AgradCdfParetoType2_v_571;
+typedef std::tuple<AgradCdfParetoType2, type_v_572> AgradCdfParetoType2_v_572;
+typedef std::tuple<AgradCdfParetoType2, type_v_573> AgradCdfParetoType2_v_573;
+typedef std::tuple<AgradCdfParetoType2, type_v_574> AgradCdfParetoType2_v_574;
+typedef std::tuple<AgradCdfParetoType2, type_v_575> AgradCdfParetoType2_v_575;
+typedef std::tuple<AgradCdfParetoType2, type_v_576> AgradCdfParetoType2_v_576;
+typedef std::tuple<AgradCdfParetoType2, type_v_577> AgradCdfParetoType2_v_577;
+typedef std::tuple<AgradCdfParetoType2, type_v_578> AgradCdfParetoType2_v_578;
+typedef std::tuple<AgradCdfParetoType2, type_v_579> AgradCdfParetoType2_v_579;
+typedef std::tuple<AgradCdfParetoType2, type_v_580> AgradCdfParetoType2_v_580;
+typedef std::tuple<AgradCdfParetoType2, type_v_581> AgradCdfParetoType2_v_581;
+typedef std::tuple<AgradCdfParetoType2, type_v_582> AgradCdfParetoType2_v_582;
+typedef std::tuple<AgradCdfParetoType2, type_v_583> AgradCdfParetoType2_v_583;
+typedef std::tuple<AgradCdfParetoType2, type_v_584> AgradCdfParetoType2_v_584;
+typedef std::tuple<AgradCdfParetoType2, type_v_585> AgradCdfParetoType2_v_585;
+typedef std::tuple<AgradCdfParetoType2, type_v_586> AgradCdfParetoType2_v_586;
+typedef std::tuple<AgradCdfParetoType2, type_v_587> AgradCdfParetoType2_v_587;
+typedef std::tuple<AgradCdfParetoType2, type_v_588> AgradCdfParetoType2_v_588;
+typedef std::tuple<AgradCdfParetoType2, type_v_589> AgradCdfParetoType2_v_589;
+typedef std::tuple<AgradCdfParetoType2, type_v_590> AgradCdfParetoType2_v_590;
+typedef std::tuple<AgradCdfParetoType2, type_v_591> AgradCdfParetoType2_v_591;
+typedef std::tuple<AgradCdfParetoType2, type_v_592> AgradCdfParetoType2_v_592;
+typedef std::tuple<AgradCdfParetoType2, type_v_593> AgradCdfParetoType2_v_593;
+typedef std::tuple<AgradCdfParetoType2, type_v_594> AgradCdfParetoType2_v_594;
+typedef std::tuple<AgradCdfParetoType2, type_v_595> AgradCdfParetoType2_v_595;
+typedef std::tuple<AgradCdfParetoType2, type_v_596> AgradCdfParetoType2_v_596;
+typedef std::tuple<AgradCdfParetoType2, type_v_597> AgradCdfParetoType2_v_597;
+typedef std::tuple<AgradCdfParetoType2, type_v_598> AgradCdfParetoType2_v_598;
+typedef std::tuple<AgradCdfParetoType2, type_v_599> AgradCdfParetoType2_v_599;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_500, AgradCdfTestFixture, AgradCdfParetoType2_v_500);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_501, AgradCdfTestFixture, AgradCdfParetoType2_v_501);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_502, AgradCdfTestFixture, AgradCdfParetoType2_v_502);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_503, AgradCdfTestFixture, AgradCdfParetoType2_v_503);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_504, AgradCdfTestFixture, AgradCdfParetoType2_v_504);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_505, AgradCdfTestFixture, AgradCdfParetoType2_v_505);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_506, AgradCdfTestFixture, AgradCdfParetoType2_v_506);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_507, AgradCdfTestFixture, AgradCdfParetoType2_v_507);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_508, AgradCdfTestFixture, AgradCdfParetoType2_v_508);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_509, AgradCdfTestFixture, AgradCdfParetoType2_v_509);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_510, AgradCdfTestFixture, AgradCdfParetoType2_v_510);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_511, AgradCdfTestFixture, AgradCdfParetoType2_v_511);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_512, AgradCdfTestFixture, AgradCdfParetoType2_v_512);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_513, AgradCdfTestFixture, AgradCdfParetoType2_v_513);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_514, AgradCdfTestFixture, AgradCdfParetoType2_v_514);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_515, AgradCdfTestFixture, AgradCdfParetoType2_v_515);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_516, AgradCdfTestFixture, AgradCdfParetoType2_v_516);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_517, AgradCdfTestFixture, AgradCdfParetoType2_v_517);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_518, AgradCdfTestFixture, AgradCdfParetoType2_v_518);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_519, AgradCdfTestFixture, AgradCdfParetoType2_v_519);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_520, AgradCdfTestFixture, AgradCdfParetoType2_v_520);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_521, AgradCdfTestFixture, AgradCdfParetoType2_v_521);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_522, AgradCdfTestFixture, AgradCdfParetoType2_v_522);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_523, AgradCdfTestFixture, AgradCdfParetoType2_v_523);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_524, AgradCdfTestFixture, AgradCdfParetoType2_v_524);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_525, AgradCdfTestFixture, AgradCdfParetoType2_v_525);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_526, AgradCdfTestFixture, AgradCdfParetoType2_v_526);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_527, AgradCdfTestFixture, AgradCdfParetoType2_v_527);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_528, AgradCdfTestFixture, AgradCdfParetoType2_v_528);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_529, AgradCdfTestFixture, AgradCdfParetoType2_v_529);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_530, AgradCdfTestFixture, AgradCdfParetoType2_v_530);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_531, AgradCdfTestFixture, AgradCdfParetoType2_v_531);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_532, AgradCdfTestFixture, AgradCdfParetoType2_v_532);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_533, AgradCdfTestFixture, AgradCdfParetoType2_v_533);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_534, AgradCdfTestFixture, AgradCdfParetoType2_v_534);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_535, AgradCdfTestFixture, AgradCdfParetoType2_v_535);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_536, AgradCdfTestFixture, AgradCdfParetoType2_v_536);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_537, AgradCdfTestFixture, AgradCdfParetoType2_v_537);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_538, AgradCdfTestFixture, AgradCdfParetoType2_v_538);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_539, AgradCdfTestFixture, AgradCdfParetoType2_v_539);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_540, AgradCdfTestFixture, AgradCdfParetoType2_v_540);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_541, AgradCdfTestFixture, AgradCdfParetoType2_v_541);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_542, AgradCdfTestFixture, AgradCdfParetoType2_v_542);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_543, AgradCdfTestFixture, AgradCdfParetoType2_v_543);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_544, AgradCdfTestFixture, AgradCdfParetoType2_v_544);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_545, AgradCdfTestFixture, AgradCdfParetoType2_v_545);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_546, AgradCdfTestFixture, AgradCdfParetoType2_v_546);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_547, AgradCdfTestFixture, AgradCdfParetoType2_v_547);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_548, AgradCdfTestFixture, AgradCdfParetoType2_v_548);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_549, AgradCdfTestFixture, AgradCdfParetoType2_v_549);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_550, AgradCdfTestFixture, AgradCdfParetoType2_v_550);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_551, AgradCdfTestFixture, AgradCdfParetoType2_v_551);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_552, AgradCdfTestFixture, AgradCdfParetoType2_v_552);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_553, AgradCdfTestFixture, AgradCdfParetoType2_v_553);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_554, AgradCdfTestFixture, AgradCdfParetoType2_v_554);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_555, AgradCdfTestFixture, AgradCdfParetoType2_v_555);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_556, AgradCdfTestFixture, AgradCdfParetoType2_v_556);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_557, AgradCdfTestFixture, AgradCdfParetoType2_v_557);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_558, AgradCdfTestFixture, AgradCdfParetoType2_v_558);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_559, AgradCdfTestFixture, AgradCdfParetoType2_v_559);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_560, AgradCdfTestFixture, AgradCdfParetoType2_v_560);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_561, AgradCdfTestFixture, AgradCdfParetoType2_v_561);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_562, AgradCdfTestFixture, AgradCdfParetoType2_v_562);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_563, AgradCdfTestFixture, AgradCdfParetoType2_v_563);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_564, AgradCdfTestFixture, AgradCdfParetoType2_v_564);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_565, AgradCdfTestFixture, AgradCdfParetoType2_v_565);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_566, AgradCdfTestFixture, AgradCdfParetoType2_v_566);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_567, AgradCdfTestFixture, AgradCdfParetoType2_v_567);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_568, AgradCdfTestFixture, AgradCdfParetoType2_v_568);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_569, AgradCdfTestFixture, AgradCdfParetoType2_v_569);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_570, AgradCdfTestFixture, AgradCdfParetoType2_v_570);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_571, AgradCdfTestFixture, AgradCdfParetoType2_v_571);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_572, AgradCdfTestFixture, AgradCdfParetoType2_v_572);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_573, AgradCdfTestFixture, AgradCdfParetoType2_v_573);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_574, AgradCdfTestFixture, AgradCdfParetoType2_v_574);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_575, AgradCdfTestFixture, AgradCdfParetoType2_v_575);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_576, AgradCdfTestFixture, AgradCdfParetoType2_v_576);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_577, AgradCdfTestFixture, AgradCdfParetoType2_v_577);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_578, AgradCdfTestFixture, AgradCdfParetoType2_v_578);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_579, AgradCdfTestFixture, AgradCdfParetoType2_v_579);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_580, AgradCdfTestFixture, AgradCdfParetoType2_v_580);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_581, AgradCdfTestFixture, AgradCdfParetoType2_v_581);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_582, AgradCdfTestFixture, AgradCdfParetoType2_v_582);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_583, AgradCdfTestFixture, AgradCdfParetoType2_v_583);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_584, AgradCdfTestFixture, AgradCdfParetoType2_v_584);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_585, AgradCdfTestFixture, AgradCdfParetoType2_v_585);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_586, AgradCdfTestFixture, AgradCdfParetoType2_v_586);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_587, AgradCdfTestFixture, AgradCdfParetoType2_v_587);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_588, AgradCdfTestFixture, AgradCdfParetoType2_v_588);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_589, AgradCdfTestFixture, AgradCdfParetoType2_v_589);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_590, AgradCdfTestFixture, AgradCdfParetoType2_v_590);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_591, AgradCdfTestFixture, AgradCdfParetoType2_v_591);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_592, AgradCdfTestFixture, AgradCdfParetoType2_v_592);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_593, AgradCdfTestFixture, AgradCdfParetoType2_v_593);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_594, AgradCdfTestFixture, AgradCdfParetoType2_v_594);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_595, AgradCdfTestFixture, AgradCdfParetoType2_v_595);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_596, AgradCdfTestFixture, AgradCdfParetoType2_v_596);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_597, AgradCdfTestFixture, AgradCdfParetoType2_v_597);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_598, AgradCdfTestFixture, AgradCdfParetoType2_v_598);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_599, AgradCdfTestFixture, AgradCdfParetoType2_v_599);
+
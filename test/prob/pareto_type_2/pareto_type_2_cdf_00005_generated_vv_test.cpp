@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_cdf_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_500;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, double, empty, empty> type_vv_501;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_vv_502;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_503;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, var, empty, empty> type_vv_504;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_vv_505;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_506;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_507;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_508;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_509;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_510;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_511;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_512;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, double, empty, empty> type_vv_513;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, std::vector<double>, empty, empty> type_vv_514;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_515;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, var, empty, empty> type_vv_516;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, std::vector<var>, empty, empty> type_vv_517;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_518;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, double, empty, empty> type_vv_519;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_vv_520;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_521;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, var, empty, empty> type_vv_522;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_vv_523;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_524;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_525;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_526;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_527;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_528;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_529;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_530;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, empty, empty> type_vv_531;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, empty, empty> type_vv_532;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_533;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, empty, empty> type_vv_534;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, empty, empty> type_vv_535;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_536;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, empty, empty> type_vv_537;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, empty, empty> type_vv_538;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_539;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, empty, empty> type_vv_540;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, empty, empty> type_vv_541;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_542;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_543;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_544;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_545;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_546;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_547;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_548;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, empty, empty> type_vv_549;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, empty, empty> type_vv_550;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_551;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, empty, empty> type_vv_552;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, empty, empty> type_vv_553;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_554;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, empty, empty> type_vv_555;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, empty, empty> type_vv_556;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_557;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, empty, empty> type_vv_558;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, empty, empty> type_vv_559;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_560;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_561;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_562;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_563;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_564;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_565;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_566;
+typedef std::tuple<var, double, double, double, empty, empty> type_vv_567;
+typedef std::tuple<var, double, double, std::vector<double>, empty, empty> type_vv_568;
+typedef std::tuple<var, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_569;
+typedef std::tuple<var, double, double, var, empty, empty> type_vv_570;
+typedef std::tuple<var, double, double, std::vector<var>, empty, empty> type_vv_571;
+typedef std::tuple<var, double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_572;
+typedef std::tuple<var, double, std::vector<double>, double, empty, empty> type_vv_573;
+typedef std::tuple<var, double, std::vector<double>, std::vector<double>, empty, empty> type_vv_574;
+typedef std::tuple<var, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_575;
+typedef std::tuple<var, double, std::vector<double>, var, empty, empty> type_vv_576;
+typedef std::tuple<var, double, std::vector<double>, std::vector<var>, empty, empty> type_vv_577;
+typedef std::tuple<var, double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_578;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_579;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_580;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_581;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_582;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_583;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_584;
+typedef std::tuple<var, double, var, double, empty, empty> type_vv_585;
+typedef std::tuple<var, double, var, std::vector<double>, empty, empty> type_vv_586;
+typedef std::tuple<var, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_587;
+typedef std::tuple<var, double, var, var, empty, empty> type_vv_588;
+typedef std::tuple<var, double, var, std::vector<var>, empty, empty> type_vv_589;
+typedef std::tuple<var, double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_590;
+typedef std::tuple<var, double, std::vector<var>, double, empty, empty> type_vv_591;
+typedef std::tuple<var, double, std::vector<var>, std::vector<double>, empty, empty> type_vv_592;
+typedef std::tuple<var, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_593;
+typedef std::tuple<var, double, std::vector<var>, var, empty, empty> type_vv_594;
+typedef std::tuple<var, double, std::vector<var>, std::vector<var>, empty, empty> type_vv_595;
+typedef std::tuple<var, double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_596;
+typedef std::tuple<var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_597;
+typedef std::tuple<var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_598;
+typedef std::tuple<var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_599;
+
+typedef std::tuple<AgradCdfParetoType2, type_vv_500> AgradCdfParetoType2_vv_500;
+typedef std::tuple<AgradCdfParetoType2, type_vv_501> AgradCdfParetoType2_vv_501;
+typedef std::tuple<AgradCdfParetoType2, type_vv_502> AgradCdfParetoType2_vv_502;
+typedef std::tuple<AgradCdfParetoType2, type_vv_503> AgradCdfParetoType2_vv_503;
+typedef std::tuple<AgradCdfParetoType2, type_vv_504> AgradCdfParetoType2_vv_504;
+typedef std::tuple<AgradCdfParetoType2, type_vv_505> AgradCdfParetoType2_vv_505;
+typedef std::tuple<AgradCdfParetoType2, type_vv_506> AgradCdfParetoType2_vv_506;
+typedef std::tuple<AgradCdfParetoType2, type_vv_507> AgradCdfParetoType2_vv_507;
+typedef std::tuple<AgradCdfParetoType2, type_vv_508> AgradCdfParetoType2_vv_508;
+typedef std::tuple<AgradCdfParetoType2, type_vv_509> AgradCdfParetoType2_vv_509;
+typedef std::tuple<AgradCdfParetoType2, type_vv_510> AgradCdfParetoType2_vv_510;
+typedef std::tuple<AgradCdfParetoType2, type_vv_511> AgradCdfParetoType2_vv_511;
+typedef std::tuple<AgradCdfParetoType2, type_vv_512> AgradCdfParetoType2_vv_512;
+typedef std::tuple<AgradCdfParetoType2, type_vv_513> AgradCdfParetoType2_vv_513;
+typedef std::tuple<AgradCdfParetoType2, type_vv_514> AgradCdfParetoType2_vv_514;
+typedef std::tuple<AgradCdfParetoType2, type_vv_515> AgradCdfParetoType2_vv_515;
+typedef std::tuple<AgradCdfParetoType2, type_vv_516> AgradCdfParetoType2_vv_516;
+typedef std::tuple<AgradCdfParetoType2, type_vv_517> AgradCdfParetoType2_vv_517;
+typedef std::tuple<AgradCdfParetoType2, type_vv_518> AgradCdfParetoType2_vv_518;
+typedef std::tuple<AgradCdfParetoType2, type_vv_519> AgradCdfParetoType2_vv_519;
+typedef std::tuple<AgradCdfParetoType2, type_vv_520> AgradCdfParetoType2_vv_520;
+typedef std::tuple<AgradCdfParetoType2, type_vv_521> AgradCdfParetoType2_vv_521;
+typedef std::tuple<AgradCdfParetoType2, type_vv_522> AgradCdfParetoType2_vv_522;
+typedef std::tuple<AgradCdfParetoType2, type_vv_523> AgradCdfParetoType2_vv_523;
+typedef std::tuple<AgradCdfParetoType2, type_vv_524> AgradCdfParetoType2_vv_524;
+typedef std::tuple<AgradCdfParetoType2, type_vv_525> AgradCdfParetoType2_vv_525;
+typedef std::tuple<AgradCdfParetoType2, type_vv_526> AgradCdfParetoType2_vv_526;
+typedef std::tuple<AgradCdfParetoType2, type_vv_527> AgradCdfParetoType2_vv_527;
+typedef std::tuple<AgradCdfParetoType2, type_vv_528> AgradCdfParetoType2_vv_528;
+typedef std::tuple<AgradCdfParetoType2, type_vv_529> AgradCdfParetoType2_vv_529;
+typedef std::tuple<AgradCdfParetoType2, type_vv_530> AgradCdfParetoType2_vv_530;
+typedef std::tuple<AgradCdfParetoType2, type_vv_531> AgradCdfParetoType2_vv_531;
+typedef std::tuple<AgradCdfParetoType2, type_vv_532> AgradCdfParetoType2_vv_532;
+typedef std::tuple<AgradCdfParetoType2, type_vv_533> AgradCdfParetoType2_vv_533;
+typedef std::tuple<AgradCdfParetoType2, type_vv_534> AgradCdfParetoType2_vv_534;
+typedef std::tuple<AgradCdfParetoType2, type_vv_535> AgradCdfParetoType2_vv_535;
+typedef std::tuple<AgradCdfParetoType2, type_vv_536> AgradCdfParetoType2_vv_536;
+typedef std::tuple<AgradCdfParetoType2, type_vv_537> AgradCdfParetoType2_vv_537;
+typedef std::tuple<AgradCdfParetoType2, type_vv_538> AgradCdfParetoType2_vv_538;
+typedef std::tuple<AgradCdfParetoType2, type_vv_539> AgradCdfParetoType2_vv_539;
+typedef std::tuple<AgradCdfParetoType2, type_vv_540> AgradCdfParetoType2_vv_540;
+typedef std::tuple<AgradCdfParetoType2, type_vv_541> AgradCdfParetoType2_vv_541;
+typedef std::tuple<AgradCdfParetoType2, type_vv_542> AgradCdfParetoType2_vv_542;
+typedef std::tuple<AgradCdfParetoType2, type_vv_543> AgradCdfParetoType2_vv_543;
+typedef std::tuple<AgradCdfParetoType2, type_vv_544> AgradCdfParetoType2_vv_544;
+typedef std::tuple<AgradCdfParetoType2, type_vv_545> AgradCdfParetoType2_vv_545;
+typedef std::tuple<AgradCdfParetoType2, type_vv_546> AgradCdfParetoType2_vv_546;
+typedef std::tuple<AgradCdfParetoType2, type_vv_547> AgradCdfParetoType2_vv_547;
+typedef std::tuple<AgradCdfParetoType2, type_vv_548> AgradCdfParetoType2_vv_548;
+typedef std::tuple<AgradCdfParetoType2, type_vv_549> AgradCdfParetoType2_vv_549;
+typedef std::tuple<AgradCdfParetoType2, type_vv_550> AgradCdfParetoType2_vv_550;
+typedef std::tuple<AgradCdfParetoType2, type_vv_551> AgradCdfParetoType2_vv_551;
+typedef std::tuple<AgradCdfParetoType2, type_vv_552> AgradCdfParetoType2_vv_552;
+typedef std::tuple<AgradCdfParetoType2, type_vv_553> AgradCdfParetoType2_vv_553;
+typedef std::tuple<AgradCdfParetoType2, type_vv_554> AgradCdfParetoType2_vv_554;
+typedef std::tuple<AgradCdfParetoType2, type_vv_555> AgradCdfParetoType2_vv_555;
+typedef std::tuple<AgradCdfParetoType2, type_vv_556> AgradCdfParetoType2_vv_556;
+typedef std::tuple<AgradCdfParetoType2, type_vv_557> AgradCdfParetoType2_vv_557;
+typedef std::tuple<AgradCdfParetoType2, type_vv_558> AgradCdfParetoType2_vv_558;
+typedef std::tuple<AgradCdfParetoType2, type_vv_559> AgradCdfParetoType2_vv_559;
+typedef std::tuple<AgradCdfParetoType2, type_vv_560> AgradCdfParetoType2_vv_560;
+typedef std::tuple<AgradCdfParetoType2, type_vv_561> AgradCdfParetoType2_vv_561;
+typedef std::tuple<AgradCdfParetoType2, type_vv_562> AgradCdfParetoType2_vv_562;
+typedef std::tuple<AgradCdfParetoType2, type_vv_563> AgradCdfParetoType2_vv_563;
+typedef std::tuple<AgradCdfParetoType2, type_vv_564> AgradCdfParetoType2_vv_564;
+typedef std::tuple<AgradCdfParetoType2, type_vv_565> AgradCdfParetoType2_vv_565;
+typedef std::tuple<AgradCdfParetoType2, type_vv_566> AgradCdfParetoType2_vv_566;
+typedef std::tuple<AgradCdfParetoType2, type_vv_567> AgradCdfParetoType2_vv_567;
+typedef std::tuple<AgradCdfParetoType2, type_vv_568> AgradCdfParetoType2_vv_568;
+typedef std::tuple<AgradCdfParetoType2, type_vv_569> AgradCdfParetoType2_vv_569;
+typedef std::tuple<AgradCdfParetoType2, type_vv_570> AgradCdfParetoType2_vv_570;
+typedef std::tuple<AgradCdfParetoType2, type_vv_571> AgradCdfParetoType2_vv_571;
+typedef std::tuple<AgradCdfParetoType2, type_vv_572> AgradCdfParetoType2_vv_572;
+typedef std::tuple<AgradCdfParetoType2, type_vv_573> AgradCdfParetoType2_vv_573;
+typedef std::tuple<AgradCdfParetoType2, type_vv_574> AgradCdfParetoType2_vv_574;
+typedef std::tuple<AgradCdfParetoType2, type_vv_575> AgradCdfParetoType2_vv_575;
+typedef std::tuple<AgradCdfParetoType2, type_vv_576> AgradCdfParetoType2_vv_576;
+typedef std::tuple<AgradCdfParetoType2, type_vv_577> AgradCdfParetoType2_vv_577;
+typedef std::tuple<AgradCdfParetoType2, type_vv_578> AgradCdfParetoType2_vv_578;
+typedef std::tuple<AgradCdfParetoType2, type_vv_579> AgradCdfParetoType2_vv_579;
+typedef std::tuple<AgradCdfParetoType2, type_vv_580> AgradCdfParetoType2_vv_580;
+typedef std::tuple<AgradCdfParetoType2, type_vv_581> AgradCdfParetoType2_vv_581;
+typedef std::tuple<AgradCdfParetoType2, type_vv_582> AgradCdfParetoType2_vv_582;
+typedef std::tuple<AgradCdfParetoType2, type_vv_583> AgradCdfParetoType2_vv_583;
+typedef std::tuple<AgradCdfParetoType2, type_vv_584> AgradCdfParetoType2_vv_584;
+typedef std::tuple<AgradCdfParetoType2, type_vv_585> AgradCdfParetoType2_vv_585;
+typedef std::tuple<AgradCdfParetoType2, type_vv_586> AgradCdfParetoType2_vv_586;
+typedef std::tuple<AgradCdfParetoType2, type_vv_587> AgradCdfParetoType2_vv_587;
+typedef std::tuple<AgradCdfParetoType2, type_vv_588> AgradCdfParetoType2_vv_588;
+typedef std::tuple<AgradCdfParetoType2, type_vv_589> AgradCdfParetoType2_vv_589;
+typedef std::tuple<AgradCdfParetoType2, type_vv_590> AgradCdfParetoType2_vv_590;
+typedef std::tuple<AgradCdfParetoType2, type_vv_591> AgradCdfParetoType2_vv_591;
+typedef std::tuple<AgradCdfParetoType2, type_vv_592> AgradCdfParetoType2_vv_592;
+typedef std::tuple<AgradCdfParetoType2, type_vv_593> AgradCdfParetoType2_vv_593;
+typedef std::tuple<AgradCdfParetoType2, type_vv_594> AgradCdfParetoType2_vv_594;
+typedef std::tuple<AgradCdfParetoType2, type_vv_595> AgradCdfParetoType2_vv_595;
+typedef std::tuple<AgradCdfParetoType2, type_vv_596> AgradCdfParetoType2_vv_596;
+typedef std::tuple<AgradCdfParetoType2, type_vv_597> AgradCdfParetoType2_vv_597;
+typedef std::tuple<AgradCdfParetoType2, type_vv_598> AgradCdfParetoType2_vv_598;
+typedef std::tuple<AgradCdfParetoType2, type_vv_599> AgradCdfParetoType2_vv_599;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_500, AgradCdfTestFixture, AgradCdfParetoType2_vv_500);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_501, AgradCdfTestFixture, AgradCdfParetoType2_vv_501);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_502, AgradCdfTestFixture, AgradCdfParetoType2_vv_502);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_503, AgradCdfTestFixture, AgradCdfParetoType2_vv_503);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_504, AgradCdfTestFixture, AgradCdfParetoType2_vv_504);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_505, AgradCdfTestFixture, AgradCdfParetoType2_vv_505);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_506, AgradCdfTestFixture, AgradCdfParetoType2_vv_506);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_507, AgradCdfTestFixture, AgradCdfParetoType2_vv_507);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_508, AgradCdfTestFixture, AgradCdfParetoType2_vv_508);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_509, AgradCdfTestFixture, AgradCdfParetoType2_vv_509);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_510, AgradCdfTestFixture, AgradCdfParetoType2_vv_510);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_511, AgradCdfTestFixture, AgradCdfParetoType2_vv_511);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_512, AgradCdfTestFixture, AgradCdfParetoType2_vv_512);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_513, AgradCdfTestFixture, AgradCdfParetoType2_vv_513);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_514, AgradCdfTestFixture, AgradCdfParetoType2_vv_514);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_515, AgradCdfTestFixture, AgradCdfParetoType2_vv_515);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_516, AgradCdfTestFixture, AgradCdfParetoType2_vv_516);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_517, AgradCdfTestFixture, AgradCdfParetoType2_vv_517);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_518, AgradCdfTestFixture, AgradCdfParetoType2_vv_518);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_519, AgradCdfTestFixture, AgradCdfParetoType2_vv_519);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_520, AgradCdfTestFixture, AgradCdfParetoType2_vv_520);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_521, AgradCdfTestFixture, AgradCdfParetoType2_vv_521);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_522, AgradCdfTestFixture, AgradCdfParetoType2_vv_522);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_523, AgradCdfTestFixture, AgradCdfParetoType2_vv_523);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_524, AgradCdfTestFixture, AgradCdfParetoType2_vv_524);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_525, AgradCdfTestFixture, AgradCdfParetoType2_vv_525);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_526, AgradCdfTestFixture, AgradCdfParetoType2_vv_526);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_527, AgradCdfTestFixture, AgradCdfParetoType2_vv_527);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_528, AgradCdfTestFixture, AgradCdfParetoType2_vv_528);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_529, AgradCdfTestFixture, AgradCdfParetoType2_vv_529);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_530, AgradCdfTestFixture, AgradCdfParetoType2_vv_530);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_531, AgradCdfTestFixture, AgradCdfParetoType2_vv_531);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_532, AgradCdfTestFixture, AgradCdfParetoType2_vv_532);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_533, AgradCdfTestFixture, AgradCdfParetoType2_vv_533);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_534, AgradCdfTestFixture, AgradCdfParetoType2_vv_534);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_535, AgradCdfTestFixture, AgradCdfParetoType2_vv_535);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_536, AgradCdfTestFixture, AgradCdfParetoType2_vv_536);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_537, AgradCdfTestFixture, AgradCdfParetoType2_vv_537);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_538, AgradCdfTestFixture, AgradCdfParetoType2_vv_538);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_539, AgradCdfTestFixture, AgradCdfParetoType2_vv_539);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_540, AgradCdfTestFixture, AgradCdfParetoType2_vv_540);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_541, AgradCdfTestFixture, AgradCdfParetoType2_vv_541);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_542, AgradCdfTestFixture, AgradCdfParetoType2_vv_542);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_543, AgradCdfTestFixture, AgradCdfParetoType2_vv_543);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_544, AgradCdfTestFixture, AgradCdfParetoType2_vv_544);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_545, AgradCdfTestFixture, AgradCdfParetoType2_vv_545);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_546, AgradCdfTestFixture, AgradCdfParetoType2_vv_546);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_547, AgradCdfTestFixture, AgradCdfParetoType2_vv_547);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_548, AgradCdfTestFixture, AgradCdfParetoType2_vv_548);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_549, AgradCdfTestFixture, AgradCdfParetoType2_vv_549);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_550, AgradCdfTestFixture, AgradCdfParetoType2_vv_550);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_551, AgradCdfTestFixture, AgradCdfParetoType2_vv_551);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_552, AgradCdfTestFixture, AgradCdfParetoType2_vv_552);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_553, AgradCdfTestFixture, AgradCdfParetoType2_vv_553);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_554, AgradCdfTestFixture, AgradCdfParetoType2_vv_554);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_555, AgradCdfTestFixture, AgradCdfParetoType2_vv_555);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_556, AgradCdfTestFixture, AgradCdfParetoType2_vv_556);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_557, AgradCdfTestFixture, AgradCdfParetoType2_vv_557);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_558, AgradCdfTestFixture, AgradCdfParetoType2_vv_558);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_559, AgradCdfTestFixture, AgradCdfParetoType2_vv_559);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_560, AgradCdfTestFixture, AgradCdfParetoType2_vv_560);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_561, AgradCdfTestFixture, AgradCdfParetoType2_vv_561);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_562, AgradCdfTestFixture, AgradCdfParetoType2_vv_562);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_563, AgradCdfTestFixture, AgradCdfParetoType2_vv_563);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_564, AgradCdfTestFixture, AgradCdfParetoType2_vv_564);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_565, AgradCdfTestFixture, AgradCdfParetoType2_vv_565);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_566, AgradCdfTestFixture, AgradCdfParetoType2_vv_566);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_567, AgradCdfTestFixture, AgradCdfParetoType2_vv_567);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_568, AgradCdfTestFixture, AgradCdfParetoType2_vv_568);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_569, AgradCdfTestFixture, AgradCdfParetoType2_vv_569);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_570, AgradCdfTestFixture, AgradCdfParetoType2_vv_570);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_571, AgradCdfTestFixture, AgradCdfParetoType2_vv_571);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_572, AgradCdfTestFixture, AgradCdfParetoType2_vv_572);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_573, AgradCdfTestFixture, AgradCdfParetoType2_vv_573);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_574, AgradCdfTestFixture, AgradCdfParetoType2_vv_574);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_575, AgradCdfTestFixture, AgradCdfParetoType2_vv_575);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_576, AgradCdfTestFixture, AgradCdfParetoType2_vv_576);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_577, AgradCdfTestFixture, AgradCdfParetoType2_vv_577);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_578, AgradCdfTestFixture, AgradCdfParetoType2_vv_578);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_579, AgradCdfTestFixture, AgradCdfParetoType2_vv_579);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_580, AgradCdfTestFixture, AgradCdfParetoType2_vv_580);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_581, AgradCdfTestFixture, AgradCdfParetoType2_vv_581);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_582, AgradCdfTestFixture, AgradCdfParetoType2_vv_582);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_583, AgradCdfTestFixture, AgradCdfParetoType2_vv_583);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_584, AgradCdfTestFixture, AgradCdfParetoType2_vv_584);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_585, AgradCdfTestFixture, AgradCdfParetoType2_vv_585);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_586, AgradCdfTestFixture, AgradCdfParetoType2_vv_586);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_587, AgradCdfTestFixture, AgradCdfParetoType2_vv_587);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_588, AgradCdfTestFixture, AgradCdfParetoType2_vv_588);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_589, AgradCdfTestFixture, AgradCdfParetoType2_vv_589);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_590, AgradCdfTestFixture, AgradCdfParetoType2_vv_590);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_591, AgradCdfTestFixture, AgradCdfParetoType2_vv_591);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_592, AgradCdfTestFixture, AgradCdfParetoType2_vv_592);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_593, AgradCdfTestFixture, AgradCdfParetoType2_vv_593);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_594, AgradCdfTestFixture, AgradCdfParetoType2_vv_594);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_595, AgradCdfTestFixture, AgradCdfParetoType2_vv_595);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_596, AgradCdfTestFixture, AgradCdfParetoType2_vv_596);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_597, AgradCdfTestFixture, AgradCdfParetoType2_vv_597);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_598, AgradCdfTestFixture, AgradCdfParetoType2_vv_598);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_599, AgradCdfTestFixture, AgradCdfParetoType2_vv_599);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_cdf_test.hpp>
+
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_600;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_601;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_602;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, double, double, empty, empty> type_ffv_603;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, double, std::vector<double>, empty, empty> type_ffv_604;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_605;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, double, fvar<fvar<var> >, empty, empty> type_ffv_606;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_607;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_608;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<double>, double, empty, empty> type_ffv_609;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_610;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_611;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_612;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_613;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_614;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_615;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_616;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_617;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_618;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_619;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_620;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, double, empty, empty> type_ffv_621;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_622;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_623;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_624;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_625;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_626;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_627;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_628;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_629;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_630;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_631;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_632;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_633;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_634;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_635;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_636;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_637;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_638;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty> type_ffv_639;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_ffv_640;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_641;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_642;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_643;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_644;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_ffv_645;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_646;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_647;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_648;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_649;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_650;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_651;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_652;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_653;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_654;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_655;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_656;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_657;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_658;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_659;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_660;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_661;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_662;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_663;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_664;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_665;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_666;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_667;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_668;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_669;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_670;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_671;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_672;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_673;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_674;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, double, double, empty, empty> type_ffv_675;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, double, std::vector<double>, empty, empty> type_ffv_676;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_677;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, double, fvar<fvar<var> >, empty, empty> type_ffv_678;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_679;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_680;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, double, empty, empty> type_ffv_681;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty, empty> type_ffv_682;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_683;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_684;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_685;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_686;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_687;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_688;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_689;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_690;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_691;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_692;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, double, empty, empty> type_ffv_693;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_694;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_695;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_696;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_697;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_698;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_699;
+
+typedef std::tuple<AgradCdfParetoType2, type_ffv_600> AgradCdfParetoType2_ffv_600;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_601> AgradCdfParetoType2_ffv_601;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_602> AgradCdfParetoType2_ffv_602;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_603> AgradCdfParetoType2_ffv_603;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_604> AgradCdfParetoType2_ffv_604;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_605> AgradCdfParetoType2_ffv_605;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_606> AgradCdfParetoType2_ffv_606;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_607> AgradCdfParetoType2_ffv_607;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_608> AgradCdfParetoType2_ffv_608;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_609> AgradCdfParetoType2_ffv_609;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_610> AgradCdfParetoType2_ffv_610;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_611> AgradCdfParetoType2_ffv_611;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_612> AgradCdfParetoType2_ffv_612;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_613> AgradCdfParetoType2_ffv_613;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_614> AgradCdfParetoType2_ffv_614;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_615> AgradCdfParetoType2_ffv_615;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_616> AgradCdfParetoType2_ffv_616;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_617> AgradCdfParetoType2_ffv_617;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_618> AgradCdfParetoType2_ffv_618;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_619> AgradCdfParetoType2_ffv_619;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_620> AgradCdfParetoType2_ffv_620;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_621> AgradCdfParetoType2_ffv_621;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_622> AgradCdfParetoType2_ffv_622;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_623> AgradCdfParetoType2_ffv_623;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_624> AgradCdfParetoType2_ffv_624;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_625> AgradCdfParetoType2_ffv_625;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_626> AgradCdfParetoType2_ffv_626;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_627> AgradCdfParetoType2_ffv_627;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_628> AgradCdfParetoType2_ffv_628;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_629> AgradCdfParetoType2_ffv_629;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_630> AgradCdfParetoType2_ffv_630;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_631> AgradCdfParetoType2_ffv_631;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_632> AgradCdfParetoType2_ffv_632;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_633> AgradCdfParetoType2_ffv_633;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_634> AgradCdfParetoType2_ffv_634;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_635> AgradCdfParetoType2_ffv_635;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_636> AgradCdfParetoType2_ffv_636;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_637> AgradCdfParetoType2_ffv_637;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_638> AgradCdfParetoType2_ffv_638;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_639> AgradCdfParetoType2_ffv_639;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_640> AgradCdfParetoType2_ffv_640;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_641> AgradCdfParetoType2_ffv_641;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_642> AgradCdfParetoType2_ffv_642;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_643> AgradCdfParetoType2_ffv_643;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_644> AgradCdfParetoType2_ffv_644;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_645> AgradCdfParetoType2_ffv_645;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_646> AgradCdfParetoType2_ffv_646;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_647> AgradCdfParetoType2_ffv_647;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_648> AgradCdfParetoType2_ffv_648;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_649> AgradCdfParetoType2_ffv_649;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_650> AgradCdfParetoType2_ffv_650;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_651> AgradCdfParetoType2_ffv_651;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_652> AgradCdfParetoType2_ffv_652;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_653> AgradCdfParetoType2_ffv_653;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_654> AgradCdfParetoType2_ffv_654;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_655> AgradCdfParetoType2_ffv_655;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_656> AgradCdfParetoType2_ffv_656;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_657> AgradCdfParetoType2_ffv_657;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_658> AgradCdfParetoType2_ffv_658;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_659> AgradCdfParetoType2_ffv_659;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_660> AgradCdfParetoType2_ffv_660;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_661> AgradCdfParetoType2_ffv_661;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_662> AgradCdfParetoType2_ffv_662;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_663> AgradCdfParetoType2_ffv_663;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_664> AgradCdfParetoType2_ffv_664;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_665> AgradCdfParetoType2_ffv_665;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_666> AgradCdfParetoType2_ffv_666;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_667> AgradCdfParetoType2_ffv_667;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_668> AgradCdfParetoType2_ffv_668;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_669> AgradCdfParetoType2_ffv_669;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_670> AgradCdfParetoType2_ffv_670;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_671> AgradCdfParetoType2_ffv_671;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_672> AgradCdfParetoType2_ffv_672;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_673> AgradCdfParetoType2_ffv_673;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_674> AgradCdfParetoType2_ffv_674;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_675> AgradCdfParetoType2_ffv_675;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_676> AgradCdfParetoType2_ffv_676;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_677> AgradCdfParetoType2_ffv_677;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_678> AgradCdfParetoType2_ffv_678;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_679> AgradCdfParetoType2_ffv_679;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_680> AgradCdfParetoType2_ffv_680;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_681> AgradCdfParetoType2_ffv_681;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_682> AgradCdfParetoType2_ffv_682;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_683> AgradCdfParetoType2_ffv_683;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_684> AgradCdfParetoType2_ffv_684;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_685> AgradCdfParetoType2_ffv_685;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_686> AgradCdfParetoType2_ffv_686;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_687> AgradCdfParetoType2_ffv_687;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_688> AgradCdfParetoType2_ffv_688;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_689> AgradCdfParetoType2_ffv_689;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_690> AgradCdfParetoType2_ffv_690;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_691> AgradCdfParetoType2_ffv_691;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_692> AgradCdfParetoType2_ffv_692;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_693> AgradCdfParetoType2_ffv_693;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_694> AgradCdfParetoType2_ffv_694;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_695> AgradCdfParetoType2_ffv_695;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_696> AgradCdfParetoType2_ffv_696;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_697> AgradCdfParetoType2_ffv_697;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_698> AgradCdfParetoType2_ffv_698;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_699> AgradCdfParetoType2_ffv_699;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_600, AgradCdfTestFixture, AgradCdfParetoType2_ffv_600);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_601, AgradCdfTestFixture, AgradCdfParetoType2_ffv_601);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_602, AgradCdfTestFixture, AgradCdfParetoType2_ffv_602);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_603, AgradCdfTestFixture, AgradCdfParetoType2_ffv_603);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_604, AgradCdfTestFixture, AgradCdfParetoType2_ffv_604);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_605, AgradCdfTestFixture, AgradCdfParetoType2_ffv_605);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_606, AgradCdfTestFixture, AgradCdfParetoType2_ffv_606);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_607, AgradCdfTestFixture, AgradCdfParetoType2_ffv_607);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_608, AgradCdfTestFixture, AgradCdfParetoType2_ffv_608);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_609, AgradCdfTestFixture, AgradCdfParetoType2_ffv_609);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_610, AgradCdfTestFixture, AgradCdfParetoType2_ffv_610);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_611, AgradCdfTestFixture, AgradCdfParetoType2_ffv_611);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_612, AgradCdfTestFixture, AgradCdfParetoType2_ffv_612);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_613, AgradCdfTestFixture, AgradCdfParetoType2_ffv_613);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_614, AgradCdfTestFixture, AgradCdfParetoType2_ffv_614);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_615, AgradCdfTestFixture, AgradCdfParetoType2_ffv_615);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_616, AgradCdfTestFixture, AgradCdfParetoType2_ffv_616);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_617, AgradCdfTestFixture, AgradCdfParetoType2_ffv_617);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_618, AgradCdfTestFixture, AgradCdfParetoType2_ffv_618);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_619, AgradCdfTestFixture, AgradCdfParetoType2_ffv_619);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_620, AgradCdfTestFixture, AgradCdfParetoType2_ffv_620);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_621, AgradCdfTestFixture, AgradCdfParetoType2_ffv_621);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_622, AgradCdfTestFixture, AgradCdfParetoType2_ffv_622);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_623, AgradCdfTestFixture, AgradCdfParetoType2_ffv_623);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_624, AgradCdfTestFixture, AgradCdfParetoType2_ffv_624);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_625, AgradCdfTestFixture, AgradCdfParetoType2_ffv_625);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_626, AgradCdfTestFixture, AgradCdfParetoType2_ffv_626);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_627, AgradCdfTestFixture, AgradCdfParetoType2_ffv_627);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_628, AgradCdfTestFixture, AgradCdfParetoType2_ffv_628);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_629, AgradCdfTestFixture, AgradCdfParetoType2_ffv_629);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_630, AgradCdfTestFixture, AgradCdfParetoType2_ffv_630);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_631, AgradCdfTestFixture, AgradCdfParetoType2_ffv_631);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_632, AgradCdfTestFixture, AgradCdfParetoType2_ffv_632);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_633, AgradCdfTestFixture, AgradCdfParetoType2_ffv_633);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_634, AgradCdfTestFixture, AgradCdfParetoType2_ffv_634);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_635, AgradCdfTestFixture, AgradCdfParetoType2_ffv_635);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_636, AgradCdfTestFixture, AgradCdfParetoType2_ffv_636);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_637, AgradCdfTestFixture, AgradCdfParetoType2_ffv_637);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_638, AgradCdfTestFixture, AgradCdfParetoType2_ffv_638);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_639, AgradCdfTestFixture, AgradCdfParetoType2_ffv_639);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_640, AgradCdfTestFixture, AgradCdfParetoType2_ffv_640);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_641, AgradCdfTestFixture, AgradCdfParetoType2_ffv_641);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_642, AgradCdfTestFixture, AgradCdfParetoType2_ffv_642);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_643, AgradCdfTestFixture, AgradCdfParetoType2_ffv_643);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_644, AgradCdfTestFixture, AgradCdfParetoType2_ffv_644);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_645, AgradCdfTestFixture, AgradCdfParetoType2_ffv_645);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_646, AgradCdfTestFixture, AgradCdfParetoType2_ffv_646);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_647, AgradCdfTestFixture, AgradCdfParetoType2_ffv_647);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_648, AgradCdfTestFixture, AgradCdfParetoType2_ffv_648);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_649, AgradCdfTestFixture, AgradCdfParetoType2_ffv_649);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_650, AgradCdfTestFixture, AgradCdfParetoType2_ffv_650);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_651, AgradCdfTestFixture, AgradCdfParetoType2_ffv_651);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_652, AgradCdfTestFixture, AgradCdfParetoType2_ffv_652);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_653, AgradCdfTestFixture, AgradCdfParetoType2_ffv_653);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_654, AgradCdfTestFixture, AgradCdfParetoType2_ffv_654);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_655, AgradCdfTestFixture, AgradCdfParetoType2_ffv_655);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_656, AgradCdfTestFixture, AgradCdfParetoType2_ffv_656);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_657, AgradCdfTestFixture, AgradCdfParetoType2_ffv_657);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_658, AgradCdfTestFixture, AgradCdfParetoType2_ffv_658);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_659, AgradCdfTestFixture, AgradCdfParetoType2_ffv_659);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_660, AgradCdfTestFixture, AgradCdfParetoType2_ffv_660);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_661, AgradCdfTestFixture, AgradCdfParetoType2_ffv_661);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_662, AgradCdfTestFixture, AgradCdfParetoType2_ffv_662);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_663, AgradCdfTestFixture, AgradCdfParetoType2_ffv_663);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_664, AgradCdfTestFixture, AgradCdfParetoType2_ffv_664);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_665, AgradCdfTestFixture, AgradCdfParetoType2_ffv_665);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_666, AgradCdfTestFixture, AgradCdfParetoType2_ffv_666);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_667, AgradCdfTestFixture, AgradCdfParetoType2_ffv_667);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_668, AgradCdfTestFixture, AgradCdfParetoType2_ffv_668);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_669, AgradCdfTestFixture, AgradCdfParetoType2_ffv_669);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_670, AgradCdfTestFixture, AgradCdfParetoType2_ffv_670);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_671, AgradCdfTestFixture, AgradCdfParetoType2_ffv_671);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_672, AgradCdfTestFixture, AgradCdfParetoType2_ffv_672);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_673, AgradCdfTestFixture, AgradCdfParetoType2_ffv_673);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_674, AgradCdfTestFixture, AgradCdfParetoType2_ffv_674);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_675, AgradCdfTestFixture, AgradCdfParetoType2_ffv_675);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_676, AgradCdfTestFixture, AgradCdfParetoType2_ffv_676);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_677, AgradCdfTestFixture, AgradCdfParetoType2_ffv_677);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_678, AgradCdfTestFixture, AgradCdfParetoType2_ffv_678);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_679, AgradCdfTestFixture, AgradCdfParetoType2_ffv_679);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_680, AgradCdfTestFixture, AgradCdfParetoType2_ffv_680);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_681, AgradCdfTestFixture, AgradCdfParetoType2_ffv_681);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_682, AgradCdfTestFixture, AgradCdfParetoType2_ffv_682);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_683, AgradCdfTestFixture, AgradCdfParetoType2_ffv_683);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_684, AgradCdfTestFixture, AgradCdfParetoType2_ffv_684);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_685, AgradCdfTestFixture, AgradCdfParetoType2_ffv_685);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_686, AgradCdfTestFixture, AgradCdfParetoType2_ffv_686);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_687, AgradCdfTestFixture, AgradCdfParetoType2_ffv_687);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_688, AgradCdfTestFixture, AgradCdfParetoType2_ffv_688);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_689, AgradCdfTestFixture, AgradCdfParetoType2_ffv_689);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_690, AgradCdfTestFixture, AgradCdfParetoType2_ffv_690);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_691, AgradCdfTestFixture, AgradCdfParetoType2_ffv_691);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_692, AgradCdfTestFixture, AgradCdfParetoType2_ffv_692);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_693, AgradCdfTestFixture, AgradCdfParetoType2_ffv_693);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_694, AgradCdfTestFixture, AgradCdfParetoType2_ffv_694);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_695, AgradCdfTestFixture, AgradCdfParetoType2_ffv_695);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_696, AgradCdfTestFixture, AgradCdfParetoType2_ffv_696);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_697, AgradCdfTestFixture, AgradCdfParetoType2_ffv_697);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_698, AgradCdfTestFixture, AgradCdfParetoType2_ffv_698);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_699, AgradCdfTestFixture, AgradCdfParetoType2_ffv_699);
+
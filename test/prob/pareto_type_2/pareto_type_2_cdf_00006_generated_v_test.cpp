@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_cdf_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, double, empty, empty> type_v_600;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_v_601;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_602;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, var, empty, empty> type_v_603;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_v_604;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_605;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_606;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_607;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_608;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_609;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_610;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_611;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_612;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_613;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_614;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_615;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_616;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_617;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_618;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_619;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_620;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_621;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_622;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_623;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_624;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_625;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_626;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_627;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_628;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_629;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_630;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_631;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_632;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_633;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_634;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_635;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_636;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_637;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_638;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_639;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_640;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_641;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_642;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_643;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_644;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_645;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_646;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_647;
+typedef std::tuple<var, double, double, double, empty, empty> type_v_648;
+typedef std::tuple<var, double, double, std::vector<double>, empty, empty> type_v_649;
+typedef std::tuple<var, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_650;
+typedef std::tuple<var, double, double, var, empty, empty> type_v_651;
+typedef std::tuple<var, double, double, std::vector<var>, empty, empty> type_v_652;
+typedef std::tuple<var, double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_653;
+typedef std::tuple<var, double, std::vector<double>, double, empty, empty> type_v_654;
+typedef std::tuple<var, double, std::vector<double>, std::vector<double>, empty, empty> type_v_655;
+typedef std::tuple<var, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_656;
+typedef std::tuple<var, double, std::vector<double>, var, empty, empty> type_v_657;
+typedef std::tuple<var, double, std::vector<double>, std::vector<var>, empty, empty> type_v_658;
+typedef std::tuple<var, double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_659;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_660;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_661;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_662;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_663;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_664;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_665;
+typedef std::tuple<var, double, var, double, empty, empty> type_v_666;
+typedef std::tuple<var, double, var, std::vector<double>, empty, empty> type_v_667;
+typedef std::tuple<var, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_668;
+typedef std::tuple<var, double, var, var, empty, empty> type_v_669;
+typedef std::tuple<var, double, var, std::vector<var>, empty, empty> type_v_670;
+typedef std::tuple<var, double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_671;
+typedef std::tuple<var, double, std::vector<var>, double, empty, empty> type_v_672;
+typedef std::tuple<var, double, std::vector<var>, std::vector<double>, empty, empty> type_v_673;
+typedef std::tuple<var, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_674;
+typedef std::tuple<var, double, std::vector<var>, var, empty, empty> type_v_675;
+typedef std::tuple<var, double, std::vector<var>, std::vector<var>, empty, empty> type_v_676;
+typedef std::tuple<var, double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_677;
+typedef std::tuple<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_678;
+typedef std::tuple<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_679;
+typedef std::tuple<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_680;
+typedef std::tuple<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_681;
+typedef std::tuple<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_682;
+typedef std::tuple<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_683;
+typedef std::tuple<var, std::vector<double>, double, double, empty, empty> type_v_684;
+typedef std::tuple<var, std::vector<double>, double, std::vector<double>, empty, empty> type_v_685;
+typedef std::tuple<var, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_686;
+typedef std::tuple<var, std::vector<double>, double, var, empty, empty> type_v_687;
+typedef std::tuple<var, std::vector<double>, double, std::vector<var>, empty, empty> type_v_688;
+typedef std::tuple<var, std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_689;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, double, empty, empty> type_v_690;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, std::vector<double>, empty, empty> type_v_691;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_692;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, var, empty, empty> type_v_693;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_v_694;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_695;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_696;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_697;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_698;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_699;
+
+typedef std::tuple<AgradCdfParetoType2, type_v_600> AgradCdfParetoType2_v_600;
+typedef std::tuple<AgradCdfParetoType2, type_v_601> AgradCdfParetoType2_v_601;
+typedef std::tuple<AgradCdfParetoType2, type_v_602> AgradCdfParetoType2_v_602;
+typedef std::tuple<AgradCdfParetoType2, type_v_603> AgradCdfParetoType2_v_603;
+typedef std::tuple<AgradCdfParetoType2, type_v_604> AgradCdfParetoType2_v_604;
+typedef std::tuple<AgradCdfParetoType2, type_v_605> AgradCdfParetoType2_v_605;
+typedef std::tuple<AgradCdfParetoType2, type_v_606> AgradCdfParetoType2_v_606;
+typedef std::tuple<AgradCdfParetoType2, type_v_607> AgradCdfParetoType2_v_607;
+typedef std::tuple<AgradCdfParetoType2, type_v_608> AgradCdfParetoType2_v_608;
+typedef std::tuple<AgradCdfParetoType2, type_v_609> AgradCdfParetoType2_v_609;
+typedef std::tuple<AgradCdfParetoType2, type_v_610> AgradCdfParetoType2_v_610;
+typedef std::tuple<AgradCdfParetoType2, type_v_611> AgradCdfParetoType2_v_611;
+typedef std::tuple<AgradCdfParetoType2, type_v_612> AgradCdfParetoType2_v_612;
+typedef std::tuple<AgradCdfParetoType2, type_v_613> AgradCdfParetoType2_v_613;
+typedef std::tuple<AgradCdfParetoType2, type_v_614> AgradCdfParetoType2_v_614;
+typedef std::tuple<AgradCdfParetoType2, type_v_615> AgradCdfParetoType2_v_615;
+typedef std::tuple<AgradCdfParetoType2, type_v_616> AgradCdfParetoType2_v_616;
+typedef std::tuple<AgradCdfParetoType2, type_v_617> AgradCdfParetoType2_v_617;
+typedef std::tuple<AgradCdfParetoType2, type_v_618> AgradCdfParetoType2_v_618;
+typedef std::tuple<AgradCdfParetoType2, type_v_619> AgradCdfParetoType2_v_619;
+typedef std::tuple<AgradCdfParetoType2, type_v_620> AgradCdfParetoType2_v_620;
+typedef std::tuple<AgradCdfParetoType2, type_v_621> AgradCdfParetoType2_v_621;
+typedef std::tuple<AgradCdfParetoType2, type_v_622> AgradCdfParetoType2_v_622;
+typedef std::tuple<AgradCdfParetoType2, type_v_623> AgradCdfParetoType2_v_623;
+typedef std::tuple<AgradCdfParetoType2, type_v_624> AgradCdfParetoType2_v_624;
+typedef std::tuple<AgradCdfParetoType2, type_v_625> AgradCdfParetoType2_v_625;
+typedef std::tuple<AgradCdfParetoType2, type_v_626> AgradCdfParetoType2_v_626;
+typedef std::tuple<AgradCdfParetoType2, type_v_627> AgradCdfParetoType2_v_627;
+typedef std::tuple<AgradCdfParetoType2, type_v_628> AgradCdfParetoType2_v_628;
+typedef std::tuple<AgradCdfParetoType2, type_v_629> AgradCdfParetoType2_v_629;
+typedef std::tuple<AgradCdfParetoType2, type_v_630> AgradCdfParetoType2_v_630;
+typedef std::tuple<AgradCdfParetoType2, type_v_631> AgradCdfParetoType2_v_631;
+typedef std::tuple<AgradCdfParetoType2, type_v_632> AgradCdfParetoType2_v_632;
+typedef std::tuple<AgradCdfParetoType2, type_v_633> AgradCdfParetoType2_v_633;
+typedef std::tuple<AgradCdfParetoType2, type_v_634> AgradCdfParetoType2_v_634;
+typedef std::tuple<AgradCdfParetoType2, type_v_635> AgradCdfParetoType2_v_635;
+typedef std::tuple<AgradCdfParetoType2, type_v_636> AgradCdfParetoType2_v_636;
+typedef std::tuple<AgradCdfParetoType2, type_v_637> AgradCdfParetoType2_v_637;
+typedef std::tuple<AgradCdfParetoType2, type_v_638> AgradCdfParetoType2_v_638;
+typedef std::tuple<AgradCdfParetoType2, type_v_639> AgradCdfParetoType2_v_639;
+typedef std::tuple<AgradCdfParetoType2, type_v_640> AgradCdfParetoType2_v_640;
+typedef std::tuple<AgradCdfParetoType2, type_v_641> AgradCdfParetoType2_v_641;
+typedef std::tuple<AgradCdfParetoType2, type_v_642> AgradCdfParetoType2_v_642;
+typedef std::tuple<AgradCdfParetoType2, type_v_643> AgradCdfParetoType2_v_643;
+typedef std::tuple<AgradCdfParetoType2, type_v_644> AgradCdfParetoType2_v_644;
+typedef std::tuple<AgradCdfParetoType2, type_v_645> AgradCdfParetoType2_v_645;
+typedef std::tuple<AgradCdfParetoType2, type_v_646> AgradCdfParetoType2_v_646;
+typedef std::tuple<AgradCdfParetoType2, type_v_647> AgradCdfParetoType2_v_647;
+typedef std::tuple<AgradCdfParetoType2, type_v_648> AgradCdfParetoType2_v_648;
+typedef std::tuple<AgradCdfParetoType2, type_v_649> AgradCdfParetoType2_v_649;
+typedef std::tuple<AgradCdfParetoType2, type_v_650> AgradCdfParetoType2_v_650;
+typedef std::tuple<AgradCdfParetoType2, type_v_651> AgradCdfParetoType2_v_651;
+typedef std::tuple<AgradCdfParetoType2, type_v_652> AgradCdfParetoType2_v_652;
+typedef std::tuple<AgradCdfParetoType2, type_v_653> AgradCdfParetoType2_v_653;
+typedef std::tuple<AgradCdfParetoType2, type_v_654> AgradCdfParetoType2_v_654;
+typedef std::tuple<AgradCdfParetoType2, type_v_655> AgradCdfParetoType2_v_655;
+typedef std::tuple<AgradCdfParetoType2, type_v_656> AgradCdfParetoType2_v_656;
+typedef std::tuple<AgradCdfParetoType2, type_v_657> AgradCdfParetoType2_v_657;
+typedef std::tuple<AgradCdfParetoType2, type_v_658> AgradCdfParetoType2_v_658;
+typedef std::tuple<AgradCdfParetoType2, type_v_659> AgradCdfParetoType2_v_659;
+typedef std::tuple<AgradCdfParetoType2, type_v_660> AgradCdfParetoType2_v_660;
+typedef std::tuple<AgradCdfParetoType2, type_v_661> AgradCdfParetoType2_v_661;
+typedef std::tuple<AgradCdfParetoType2, type_v_662> AgradCdfParetoType2_v_662;
+typedef std::tuple<AgradCdfParetoType2, type_v_663> AgradCdfParetoType2_v_663;
+typedef std::tuple<AgradCdfParetoType2, type_v_664> AgradCdfParetoType2_v_664;
+typedef std::tuple<AgradCdfParetoType2, type_v_665> AgradCdfParetoType2_v_665;
+typedef std::tuple<AgradCdfParetoType2, type_v_666> AgradCdfParetoType2_v_666;
+typedef std::tuple<AgradCdfParetoType2, type_v_667> AgradCdfParetoType2_v_667;
+typedef std::tuple<AgradCdfParetoType2, type_v_668> AgradCdfParetoType2_v_668;
+typedef std::tuple<AgradCdfParetoType2, type_v_669> AgradCdfParetoType2_v_669;
+typedef std::tuple<AgradCdfParetoType2, type_v_670> AgradCdfParetoType2_v_670;
+typedef std::tuple<AgradCdfParetoType2, type_v_671> AgradCdfParetoType2_v_671;
+typedef std::tuple<AgradCdfParetoType2, type_v_672> AgradCdfParetoType2_v_672;
+typedef std::tuple<AgradCdfParetoType2, type_v_673> AgradCdfParetoType2_v_673;
+typedef std::tuple<AgradCdfParetoType2, type_v_674> AgradCdfParetoType2_v_674;
+typedef std::tuple<AgradCdfParetoType2, type_v_675> AgradCdfParetoType2_v_675;
+typedef std::tuple<AgradCdfParetoType2, type_v_676> AgradCdfParetoType2_v_676;
+typedef std::tuple<AgradCdfParetoType2, type_v_677> AgradCdfParetoType2_v_677;
+typedef std::tuple<AgradCdfParetoType2, type_v_678> AgradCdfParetoType2_v_678;
+typedef std::tuple<AgradCdfParetoType2, type_v_679> AgradCdfParetoType2_v_679;
+typedef std::tuple<AgradCdfParetoType2, type_v_680> AgradCdfParetoType2_v_680;
+typedef std::tuple<AgradCdfParetoType2, type_v_681> AgradCdfParetoType2_v_681;
+typedef std::tuple<AgradCdfParetoType2, type_v_682> AgradCdfParetoType2_v_682;
+typedef std::tuple<AgradCdfParetoType2, type_v_683> AgradCdfParetoType2_v_683;
+typedef std::tuple<AgradCdfParetoType2, type_v_684> AgradCdfParetoType2_v_684;
+typedef std::tuple<AgradCdfParetoType2, type_v_685> AgradCdfParetoType2_v_685;
+typedef std::tuple<AgradCdfParetoType2, type_v_686> AgradCdfParetoType2_v_686;
+typedef std::tuple<AgradCdfParetoType2, type_v_687> AgradCdfParetoType2_v_687;
+typedef std::tuple<AgradCdfParetoType2, type_v_688> AgradCdfParetoType2_v_688;
+typedef std::tuple<AgradCdfParetoType2, type_v_689> AgradCdfParetoType2_v_689;
+typedef std::tuple<AgradCdfParetoType2, type_v_690> AgradCdfParetoType2_v_690;
+typedef std::tuple<AgradCdfParetoType2, type_v_691> AgradCdfParetoType2_v_691;
+typedef std::tuple<AgradCdfParetoType2, type_v_692> AgradCdfParetoType2_v_692;
+typedef std::tuple<AgradCdfParetoType2, type_v_693> AgradCdfParetoType2_v_693;
+typedef std::tuple<AgradCdfParetoType2, type_v_694> AgradCdfParetoType2_v_694;
+typedef std::tuple<AgradCdfParetoType2, type_v_695> AgradCdfParetoType2_v_695;
+typedef std::tuple<AgradCdfParetoType2, type_v_696> AgradCdfParetoType2_v_696;
+typedef std::tuple<AgradCdfParetoType2, type_v_697> AgradCdfParetoType2_v_697;
+typedef std::tuple<AgradCdfParetoType2, type_v_698> AgradCdfParetoType2_v_698;
+typedef std::tuple<AgradCdfParetoType2, type_v_699> AgradCdfParetoType2_v_699;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_600, AgradCdfTestFixture, AgradCdfParetoType2_v_600);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_601, AgradCdfTestFixture, AgradCdfParetoType2_v_601);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_602, AgradCdfTestFixture, AgradCdfParetoType2_v_602);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_603, AgradCdfTestFixture, AgradCdfParetoType2_v_603);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_604, AgradCdfTestFixture, AgradCdfParetoType2_v_604);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_605, AgradCdfTestFixture, AgradCdfParetoType2_v_605);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_606, AgradCdfTestFixture, AgradCdfParetoType2_v_606);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_607, AgradCdfTestFixture, AgradCdfParetoType2_v_607);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_608, AgradCdfTestFixture, AgradCdfParetoType2_v_608);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_609, AgradCdfTestFixture, AgradCdfParetoType2_v_609);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_610, AgradCdfTestFixture, AgradCdfParetoType2_v_610);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_611, AgradCdfTestFixture, AgradCdfParetoType2_v_611);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_612, AgradCdfTestFixture, AgradCdfParetoType2_v_612);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_613, AgradCdfTestFixture, AgradCdfParetoType2_v_613);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_614, AgradCdfTestFixture, AgradCdfParetoType2_v_614);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_615, AgradCdfTestFixture, AgradCdfParetoType2_v_615);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_616, AgradCdfTestFixture, AgradCdfParetoType2_v_616);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_617, AgradCdfTestFixture, AgradCdfParetoType2_v_617);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_618, AgradCdfTestFixture, AgradCdfParetoType2_v_618);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_619, AgradCdfTestFixture, AgradCdfParetoType2_v_619);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_620, AgradCdfTestFixture, AgradCdfParetoType2_v_620);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_621, AgradCdfTestFixture, AgradCdfParetoType2_v_621);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_622, AgradCdfTestFixture, AgradCdfParetoType2_v_622);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_623, AgradCdfTestFixture, AgradCdfParetoType2_v_623);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_624, AgradCdfTestFixture, AgradCdfParetoType2_v_624);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_625, AgradCdfTestFixture, AgradCdfParetoType2_v_625);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_626, AgradCdfTestFixture, AgradCdfParetoType2_v_626);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_627, AgradCdfTestFixture, AgradCdfParetoType2_v_627);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_628, AgradCdfTestFixture, AgradCdfParetoType2_v_628);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_629, AgradCdfTestFixture, AgradCdfParetoType2_v_629);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_630, AgradCdfTestFixture, AgradCdfParetoType2_v_630);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_631, AgradCdfTestFixture, AgradCdfParetoType2_v_631);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_632, AgradCdfTestFixture, AgradCdfParetoType2_v_632);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_633, AgradCdfTestFixture, AgradCdfParetoType2_v_633);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_634, AgradCdfTestFixture, AgradCdfParetoType2_v_634);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_635, AgradCdfTestFixture, AgradCdfParetoType2_v_635);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_636, AgradCdfTestFixture, AgradCdfParetoType2_v_636);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_637, AgradCdfTestFixture, AgradCdfParetoType2_v_637);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_638, AgradCdfTestFixture, AgradCdfParetoType2_v_638);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_639, AgradCdfTestFixture, AgradCdfParetoType2_v_639);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_640, AgradCdfTestFixture, AgradCdfParetoType2_v_640);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_641, AgradCdfTestFixture, AgradCdfParetoType2_v_641);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_642, AgradCdfTestFixture, AgradCdfParetoType2_v_642);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_643, AgradCdfTestFixture, AgradCdfParetoType2_v_643);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_644, AgradCdfTestFixture, AgradCdfParetoType2_v_644);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_645, AgradCdfTestFixture, AgradCdfParetoType2_v_645);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_646, AgradCdfTestFixture, AgradCdfParetoType2_v_646);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_647, AgradCdfTestFixture, AgradCdfParetoType2_v_647);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_648, AgradCdfTestFixture, AgradCdfParetoType2_v_648);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_649, AgradCdfTestFixture, AgradCdfParetoType2_v_649);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_650, AgradCdfTestFixture, AgradCdfParetoType2_v_650);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_651, AgradCdfTestFixture, AgradCdfParetoType2_v_651);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_652, AgradCdfTestFixture, AgradCdfParetoType2_v_652);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_653, AgradCdfTestFixture, AgradCdfParetoType2_v_653);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_654, AgradCdfTestFixture, AgradCdfParetoType2_v_654);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_655, AgradCdfTestFixture, AgradCdfParetoType2_v_655);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_656, AgradCdfTestFixture, AgradCdfParetoType2_v_656);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_657, AgradCdfTestFixture, AgradCdfParetoType2_v_657);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_658, AgradCdfTestFixture, AgradCdfParetoType2_v_658);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_659, AgradCdfTestFixture, AgradCdfParetoType2_v_659);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_660, AgradCdfTestFixture, AgradCdfParetoType2_v_660);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_661, AgradCdfTestFixture, AgradCdfParetoType2_v_661);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_662, AgradCdfTestFixture, AgradCdfParetoType2_v_662);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_663, AgradCdfTestFixture, AgradCdfParetoType2_v_663);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_664, AgradCdfTestFixture, AgradCdfParetoType2_v_664);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_665, AgradCdfTestFixture, AgradCdfParetoType2_v_665);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_666, AgradCdfTestFixture, AgradCdfParetoType2_v_666);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_667, AgradCdfTestFixture, AgradCdfParetoType2_v_667);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_668, AgradCdfTestFixture, AgradCdfParetoType2_v_668);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_669, AgradCdfTestFixture, AgradCdfParetoType2_v_669);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_670, AgradCdfTestFixture, AgradCdfParetoType2_v_670);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_671, AgradCdfTestFixture, AgradCdfParetoType2_v_671);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_672, AgradCdfTestFixture, AgradCdfParetoType2_v_672);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_673, AgradCdfTestFixture, AgradCdfParetoType2_v_673);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_674, AgradCdfTestFixture, AgradCdfParetoType2_v_674);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_675, AgradCdfTestFixture, AgradCdfParetoType2_v_675);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_676, AgradCdfTestFixture, AgradCdfParetoType2_v_676);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_677, AgradCdfTestFixture, AgradCdfParetoType2_v_677);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_678, AgradCdfTestFixture, AgradCdfParetoType2_v_678);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_679, AgradCdfTestFixture, AgradCdfParetoType2_v_679);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_680, AgradCdfTestFixture, AgradCdfParetoType2_v_680);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_681, AgradCdfTestFixture, AgradCdfParetoType2_v_681);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_682, AgradCdfTestFixture, AgradCdfParetoType2_v_682);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_683, AgradCdfTestFixture, AgradCdfParetoType2_v_683);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_684, AgradCdfTestFixture, AgradCdfParetoType2_v_684);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_685, AgradCdfTestFixture, AgradCdfParetoType2_v_685);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_686, AgradCdfTestFixture, AgradCdfParetoType2_v_686);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_687, AgradCdfTestFixture, AgradCdfParetoType2_v_687);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_688, AgradCdfTestFixture, AgradCdfParetoType2_v_688);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_689, AgradCdfTestFixture, AgradCdfParetoType2_v_689);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_690, AgradCdfTestFixture, AgradCdfParetoType2_v_690);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_691, AgradCdfTestFixture, AgradCdfParetoType2_v_691);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_692, AgradCdfTestFixture, AgradCdfParetoType2_v_692);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_693, AgradCdfTestFixture, AgradCdfParetoType2_v_693);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_694, AgradCdfTestFixture, AgradCdfParetoType2_v_694);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_695, AgradCdfTestFixture, AgradCdfParetoType2_v_695);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_696, AgradCdfTestFixture, AgradCdfParetoType2_v_696);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_697, AgradCdfTestFixture, AgradCdfParetoType2_v_697);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_698, AgradCdfTestFixture, AgradCdfParetoType2_v_698);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_699, AgradCdfTestFixture, AgradCdfParetoType2_v_699);
+
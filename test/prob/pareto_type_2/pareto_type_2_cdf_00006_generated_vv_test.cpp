@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_cdf_test.hpp>
+
+typedef std::tuple<var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_600;
+typedef std::tuple<var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_601;
+typedef std::tuple<var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_602;
+typedef std::tuple<var, std::vector<double>, double, double, empty, empty> type_vv_603;
+typedef std::tuple<var, std::vector<double>, double, std::vector<double>, empty, empty> type_vv_604;
+typedef std::tuple<var, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_605;
+typedef std::tuple<var, std::vector<double>, double, var, empty, empty> type_vv_606;
+typedef std::tuple<var, std::vector<double>, double, std::vector<var>, empty, empty> type_vv_607;
+typedef std::tuple<var, std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_608;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, double, empty, empty> type_vv_609;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, std::vector<double>, empty, empty> type_vv_610;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_611;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, var, empty, empty> type_vv_612;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_vv_613;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_614;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_615;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_616;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_617;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_618;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_619;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_620;
+typedef std::tuple<var, std::vector<double>, var, double, empty, empty> type_vv_621;
+typedef std::tuple<var, std::vector<double>, var, std::vector<double>, empty, empty> type_vv_622;
+typedef std::tuple<var, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_623;
+typedef std::tuple<var, std::vector<double>, var, var, empty, empty> type_vv_624;
+typedef std::tuple<var, std::vector<double>, var, std::vector<var>, empty, empty> type_vv_625;
+typedef std::tuple<var, std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_626;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, double, empty, empty> type_vv_627;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_vv_628;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_629;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, var, empty, empty> type_vv_630;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_vv_631;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_632;
+typedef std::tuple<var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_633;
+typedef std::tuple<var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_634;
+typedef std::tuple<var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_635;
+typedef std::tuple<var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_636;
+typedef std::tuple<var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_637;
+typedef std::tuple<var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_638;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty> type_vv_639;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_vv_640;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_641;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_vv_642;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_vv_643;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_644;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_vv_645;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_vv_646;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_647;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_vv_648;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_vv_649;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_650;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_651;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_652;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_653;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_654;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_655;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_656;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_vv_657;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_vv_658;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_659;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_vv_660;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_vv_661;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_662;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_vv_663;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_vv_664;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_665;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_vv_666;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_vv_667;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_668;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_669;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_670;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_671;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_672;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_673;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_674;
+typedef std::tuple<var, var, double, double, empty, empty> type_vv_675;
+typedef std::tuple<var, var, double, std::vector<double>, empty, empty> type_vv_676;
+typedef std::tuple<var, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_677;
+typedef std::tuple<var, var, double, var, empty, empty> type_vv_678;
+typedef std::tuple<var, var, double, std::vector<var>, empty, empty> type_vv_679;
+typedef std::tuple<var, var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_680;
+typedef std::tuple<var, var, std::vector<double>, double, empty, empty> type_vv_681;
+typedef std::tuple<var, var, std::vector<double>, std::vector<double>, empty, empty> type_vv_682;
+typedef std::tuple<var, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_683;
+typedef std::tuple<var, var, std::vector<double>, var, empty, empty> type_vv_684;
+typedef std::tuple<var, var, std::vector<double>, std::vector<var>, empty, empty> type_vv_685;
+typedef std::tuple<var, var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_686;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_687;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_688;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_689;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_690;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_691;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_692;
+typedef std::tuple<var, var, var, double, empty, empty> type_vv_693;
+typedef std::tuple<var, var, var, std::vector<double>, empty, empty> type_vv_694;
+typedef std::tuple<var, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_695;
+typedef std::tuple<var, var, var, var, empty, empty> type_vv_696;
+typedef std::tuple<var, var, var, std::vector<var>, empty, empty> type_vv_697;
+typedef std::tuple<var, var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_698;
+typedef std::tuple<var, var, std::vector<var>, double, empty, empty> type_vv_699;
+
+typedef std::tuple<AgradCdfParetoType2, type_vv_600> AgradCdfParetoType2_vv_600;
+typedef std::tuple<AgradCdfParetoType2, type_vv_601> AgradCdfParetoType2_vv_601;
+typedef std::tuple<AgradCdfParetoType2, type_vv_602> AgradCdfParetoType2_vv_602;
+typedef std::tuple<AgradCdfParetoType2, type_vv_603> AgradCdfParetoType2_vv_603;
+typedef std::tuple<AgradCdfParetoType2, type_vv_604> AgradCdfParetoType2_vv_604;
+typedef std::tuple<AgradCdfParetoType2, type_vv_605> AgradCdfParetoType2_vv_605;
+typedef std::tuple<AgradCdfParetoType2, type_vv_606> AgradCdfParetoType2_vv_606;
+typedef std::tuple<AgradCdfParetoType2, type_vv_607> AgradCdfParetoType2_vv_607;
+typedef std::tuple<AgradCdfParetoType2, type_vv_608> AgradCdfParetoType2_vv_608;
+typedef std::tuple<AgradCdfParetoType2, type_vv_609> AgradCdfParetoType2_vv_609;
+typedef std::tuple<AgradCdfParetoType2, type_vv_610> AgradCdfParetoType2_vv_610;
+typedef std::tuple<AgradCdfParetoType2, type_vv_611> AgradCdfParetoType2_vv_611;
+typedef std::tuple<AgradCdfParetoType2, type_vv_612> AgradCdfParetoType2_vv_612;
+typedef std::tuple<AgradCdfParetoType2, type_vv_613> AgradCdfParetoType2_vv_613;
+typedef std::tuple<AgradCdfParetoType2, type_vv_614> AgradCdfParetoType2_vv_614;
+typedef std::tuple<AgradCdfParetoType2, type_vv_615> AgradCdfParetoType2_vv_615;
+typedef std::tuple<AgradCdfParetoType2, type_vv_616> AgradCdfParetoType2_vv_616;
+typedef std::tuple<AgradCdfParetoType2, type_vv_617> AgradCdfParetoType2_vv_617;
+typedef std::tuple<AgradCdfParetoType2, type_vv_618> AgradCdfParetoType2_vv_618;
+typedef std::tuple<AgradCdfParetoType2, type_vv_619> AgradCdfParetoType2_vv_619;
+typedef std::tuple<AgradCdfParetoType2, type_vv_620> AgradCdfParetoType2_vv_620;
+typedef std::tuple<AgradCdfParetoType2, type_vv_621> AgradCdfParetoType2_vv_621;
+typedef std::tuple<AgradCdfParetoType2, type_vv_622> AgradCdfParetoType2_vv_622;
+typedef std::tuple<AgradCdfParetoType2, type_vv_623> AgradCdfParetoType2_vv_623;
+typedef std::tuple<AgradCdfParetoType2, type_vv_624> AgradCdfParetoType2_vv_624;
+typedef std::tuple<AgradCdfParetoType2, type_vv_625> AgradCdfParetoType2_vv_625;
+typedef std::tuple<AgradCdfParetoType2, type_vv_626> AgradCdfParetoType2_vv_626;
+typedef std::tuple<AgradCdfParetoType2, type_vv_627> AgradCdfParetoType2_vv_627;
+typedef std::tuple<AgradCdfParetoType2, type_vv_628> AgradCdfParetoType2_vv_628;
+typedef std::tuple<AgradCdfParetoType2, type_vv_629> AgradCdfParetoType2_vv_629;
+typedef std::tuple<AgradCdfParetoType2, type_vv_630> AgradCdfParetoType2_vv_630;
+typedef std::tuple<AgradCdfParetoType2, type_vv_631> AgradCdfParetoType2_vv_631;
+typedef std::tuple<AgradCdfParetoType2, type_vv_632> AgradCdfParetoType2_vv_632;
+typedef std::tuple<AgradCdfParetoType2, type_vv_633> AgradCdfParetoType2_vv_633;
+typedef std::tuple<AgradCdfParetoType2, type_vv_634> AgradCdfParetoType2_vv_634;
+typedef std::tuple<AgradCdfParetoType2, type_vv_635> AgradCdfParetoType2_vv_635;
+typedef std::tuple<AgradCdfParetoType2, type_vv_636> AgradCdfParetoType2_vv_636;
+typedef std::tuple<AgradCdfParetoType2, type_vv_637> AgradCdfParetoType2_vv_637;
+typedef std::tuple<AgradCdfParetoType2, type_vv_638> AgradCdfParetoType2_vv_638;
+typedef std::tuple<AgradCdfParetoType2, type_vv_639> AgradCdfParetoType2_vv_639;
+typedef std::tuple<AgradCdfParetoType2, type_vv_640> AgradCdfParetoType2_vv_640;
+typedef std::tuple<AgradCdfParetoType2, type_vv_641> AgradCdfParetoType2_vv_641;
+typedef std::tuple<AgradCdfParetoType2, type_vv_642> AgradCdfParetoType2_vv_642;
+typedef std::tuple<AgradCdfParetoType2, type_vv_643> AgradCdfParetoType2_vv_643;
+typedef std::tuple<AgradCdfParetoType2, type_vv_644> AgradCdfParetoType2_vv_644;
+typedef std::tuple<AgradCdfParetoType2, type_vv_645> AgradCdfParetoType2_vv_645;
+typedef std::tuple<AgradCdfParetoType2, type_vv_646> AgradCdfParetoType2_vv_646;
+typedef std::tuple<AgradCdfParetoType2, type_vv_647> AgradCdfParetoType2_vv_647;
+typedef std::tuple<AgradCdfParetoType2, type_vv_648> AgradCdfParetoType2_vv_648;
+typedef std::tuple<AgradCdfParetoType2, type_vv_649> AgradCdfParetoType2_vv_649;
+typedef std::tuple<AgradCdfParetoType2, type_vv_650> AgradCdfParetoType2_vv_650;
+typedef std::tuple<AgradCdfParetoType2, type_vv_651> AgradCdfParetoType2_vv_651;
+typedef std::tuple<AgradCdfParetoType2, type_vv_652> AgradCdfParetoType2_vv_652;
+typedef std::tuple<AgradCdfParetoType2, type_vv_653> AgradCdfParetoType2_vv_653;
+typedef std::tuple<AgradCdfParetoType2, type_vv_654> AgradCdfParetoType2_vv_654;
+typedef std::tuple<AgradCdfParetoType2, type_vv_655> AgradCdfParetoType2_vv_655;
+typedef std::tuple<AgradCdfParetoType2, type_vv_656> AgradCdfParetoType2_vv_656;
+typedef std::tuple<AgradCdfParetoType2, type_vv_657> AgradCdfParetoType2_vv_657;
+typedef std::tuple<AgradCdfParetoType2, type_vv_658> AgradCdfParetoType2_vv_658;
+typedef std::tuple<AgradCdfParetoType2, type_vv_659> AgradCdfParetoType2_vv_659;
+typedef std::tuple<AgradCdfParetoType2, type_vv_660> AgradCdfParetoType2_vv_660;
+typedef std::tuple<AgradCdfParetoType2, type_vv_661> AgradCdfParetoType2_vv_661;
+typedef std::tuple<AgradCdfParetoType2, type_vv_662> AgradCdfParetoType2_vv_662;
+typedef std::tuple<AgradCdfParetoType2, type_vv_663> AgradCdfParetoType2_vv_663;
+typedef std::tuple<AgradCdfParetoType2, type_vv_664> AgradCdfParetoType2_vv_664;
+typedef std::tuple<AgradCdfParetoType2, type_vv_665> AgradCdfParetoType2_vv_665;
+typedef std::tuple<AgradCdfParetoType2, type_vv_666> AgradCdfParetoType2_vv_666;
+typedef std::tuple<AgradCdfParetoType2, type_vv_667> AgradCdfParetoType2_vv_667;
+typedef std::tuple<AgradCdfParetoType2, type_vv_668> AgradCdfParetoType2_vv_668;
+typedef std::tuple<AgradCdfParetoType2, type_vv_669> AgradCdfParetoType2_vv_669;
+typedef std::tuple<AgradCdfParetoType2, type_vv_670> AgradCdfParetoType2_vv_670;
+typedef std::tuple<AgradCdfParetoType2, type_vv_671> AgradCdfParetoType2_vv_671;
+typedef std::tuple<AgradCdfParetoType2, type_vv_672> AgradCdfParetoType2_vv_672;
+typedef std::tuple<AgradCdfParetoType2, type_vv_673> AgradCdfParetoType2_vv_673;
+typedef std::tuple<AgradCdfParetoType2, type_vv_674> AgradCdfParetoType2_vv_674;
+typedef std::tuple<AgradCdfParetoType2, type_vv_675> AgradCdfParetoType2_vv_675;
+typedef std::tuple<AgradCdfParetoType2, type_vv_676> AgradCdfParetoType2_vv_676;
+typedef std::tuple<AgradCdfParetoType2, type_vv_677> AgradCdfParetoType2_vv_677;
+typedef std::tuple<AgradCdfParetoType2, type_vv_678> AgradCdfParetoType2_vv_678;
+typedef std::tuple<AgradCdfParetoType2, type_vv_679> AgradCdfParetoType2_vv_679;
+typedef std::tuple<AgradCdfParetoType2, type_vv_680> AgradCdfParetoType2_vv_680;
+typedef std::tuple<AgradCdfParetoType2, type_vv_681> AgradCdfParetoType2_vv_681;
+typedef std::tuple<AgradCdfParetoType2, type_vv_682> AgradCdfParetoType2_vv_682;
+typedef std::tuple<AgradCdfParetoType2, type_vv_683> AgradCdfParetoType2_vv_683;
+typedef std::tuple<AgradCdfParetoType2, type_vv_684> AgradCdfParetoType2_vv_684;
+typedef std::tuple<AgradCdfParetoType2, type_vv_685> AgradCdfParetoType2_vv_685;
+typedef std::tuple<AgradCdfParetoType2, type_vv_686> AgradCdfParetoType2_vv_686;
+typedef std::tuple<AgradCdfParetoType2, type_vv_687> AgradCdfParetoType2_vv_687;
+typedef std::tuple<AgradCdfParetoType2, type_vv_688> AgradCdfParetoType2_vv_688;
+typedef std::tuple<AgradCdfParetoType2, type_vv_689> AgradCdfParetoType2_vv_689;
+typedef std::tuple<AgradCdfParetoType2, type_vv_690> AgradCdfParetoType2_vv_690;
+typedef std::tuple<AgradCdfParetoType2, type_vv_691> AgradCdfParetoType2_vv_691;
+typedef std::tuple<AgradCdfParetoType2, type_vv_692> AgradCdfParetoType2_vv_692;
+typedef std::tuple<AgradCdfParetoType2, type_vv_693> AgradCdfParetoType2_vv_693;
+typedef std::tuple<AgradCdfParetoType2, type_vv_694> AgradCdfParetoType2_vv_694;
+typedef std::tuple<AgradCdfParetoType2, type_vv_695> AgradCdfParetoType2_vv_695;
+typedef std::tuple<AgradCdfParetoType2, type_vv_696> AgradCdfParetoType2_vv_696;
+typedef std::tuple<AgradCdfParetoType2, type_vv_697> AgradCdfParetoType2_vv_697;
+typedef std::tuple<AgradCdfParetoType2, type_vv_698> AgradCdfParetoType2_vv_698;
+typedef std::tuple<AgradCdfParetoType2, type_vv_699> AgradCdfParetoType2_vv_699;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_600, AgradCdfTestFixture, AgradCdfParetoType2_vv_600);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_601, AgradCdfTestFixture, AgradCdfParetoType2_vv_601);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_602, AgradCdfTestFixture, AgradCdfParetoType2_vv_602);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_603, AgradCdfTestFixture, AgradCdfParetoType2_vv_603);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_604, AgradCdfTestFixture, AgradCdfParetoType2_vv_604);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_605, AgradCdfTestFixture, AgradCdfParetoType2_vv_605);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_606, AgradCdfTestFixture, AgradCdfParetoType2_vv_606);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_607, AgradCdfTestFixture, AgradCdfParetoType2_vv_607);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_608, AgradCdfTestFixture, AgradCdfParetoType2_vv_608);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_609, AgradCdfTestFixture, AgradCdfParetoType2_vv_609);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_610, AgradCdfTestFixture, AgradCdfParetoType2_vv_610);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_611, AgradCdfTestFixture, AgradCdfParetoType2_vv_611);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_612, AgradCdfTestFixture, AgradCdfParetoType2_vv_612);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_613, AgradCdfTestFixture, AgradCdfParetoType2_vv_613);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_614, AgradCdfTestFixture, AgradCdfParetoType2_vv_614);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_615, AgradCdfTestFixture, AgradCdfParetoType2_vv_615);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_616, AgradCdfTestFixture, AgradCdfParetoType2_vv_616);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_617, AgradCdfTestFixture, AgradCdfParetoType2_vv_617);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_618, AgradCdfTestFixture, AgradCdfParetoType2_vv_618);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_619, AgradCdfTestFixture, AgradCdfParetoType2_vv_619);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_620, AgradCdfTestFixture, AgradCdfParetoType2_vv_620);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_621, AgradCdfTestFixture, AgradCdfParetoType2_vv_621);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_622, AgradCdfTestFixture, AgradCdfParetoType2_vv_622);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_623, AgradCdfTestFixture, AgradCdfParetoType2_vv_623);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_624, AgradCdfTestFixture, AgradCdfParetoType2_vv_624);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_625, AgradCdfTestFixture, AgradCdfParetoType2_vv_625);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_626, AgradCdfTestFixture, AgradCdfParetoType2_vv_626);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_627, AgradCdfTestFixture, AgradCdfParetoType2_vv_627);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_628, AgradCdfTestFixture, AgradCdfParetoType2_vv_628);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_629, AgradCdfTestFixture, AgradCdfParetoType2_vv_629);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_630, AgradCdfTestFixture, AgradCdfParetoType2_vv_630);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_631, AgradCdfTestFixture, AgradCdfParetoType2_vv_631);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_632, AgradCdfTestFixture, AgradCdfParetoType2_vv_632);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_633, AgradCdfTestFixture, AgradCdfParetoType2_vv_633);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_634, AgradCdfTestFixture, AgradCdfParetoType2_vv_634);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_635, AgradCdfTestFixture, AgradCdfParetoType2_vv_635);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_636, AgradCdfTestFixture, AgradCdfParetoType2_vv_636);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_637, AgradCdfTestFixture, AgradCdfParetoType2_vv_637);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_638, AgradCdfTestFixture, AgradCdfParetoType2_vv_638);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_639, AgradCdfTestFixture, AgradCdfParetoType2_vv_639);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_640, AgradCdfTestFixture, AgradCdfParetoType2_vv_640);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_641, AgradCdfTestFixture, AgradCdfParetoType2_vv_641);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_642, AgradCdfTestFixture, AgradCdfParetoType2_vv_642);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_643, AgradCdfTestFixture, AgradCdfParetoType2_vv_643);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_644, AgradCdfTestFixture, AgradCdfParetoType2_vv_644);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_645, AgradCdfTestFixture, AgradCdfParetoType2_vv_645);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_646, AgradCdfTestFixture, AgradCdfParetoType2_vv_646);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_647, AgradCdfTestFixture, AgradCdfParetoType2_vv_647);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_648, AgradCdfTestFixture, AgradCdfParetoType2_vv_648);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_649, AgradCdfTestFixture, AgradCdfParetoType2_vv_649);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_650, AgradCdfTestFixture, AgradCdfParetoType2_vv_650);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_651, AgradCdfTestFixture, AgradCdfParetoType2_vv_651);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_652, AgradCdfTestFixture, AgradCdfParetoType2_vv_652);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_653, AgradCdfTestFixture, AgradCdfParetoType2_vv_653);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_654, AgradCdfTestFixture, AgradCdfParetoType2_vv_654);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_655, AgradCdfTestFixture, AgradCdfParetoType2_vv_655);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_656, AgradCdfTestFixture, AgradCdfParetoType2_vv_656);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_657, AgradCdfTestFixture, AgradCdfParetoType2_vv_657);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_658, AgradCdfTestFixture, AgradCdfParetoType2_vv_658);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_659, AgradCdfTestFixture, AgradCdfParetoType2_vv_659);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_660, AgradCdfTestFixture, AgradCdfParetoType2_vv_660);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_661, AgradCdfTestFixture, AgradCdfParetoType2_vv_661);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_662, AgradCdfTestFixture, AgradCdfParetoType2_vv_662);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_663, AgradCdfTestFixture, AgradCdfParetoType2_vv_663);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_664, AgradCdfTestFixture, AgradCdfParetoType2_vv_664);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_665, AgradCdfTestFixture, AgradCdfParetoType2_vv_665);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_666, AgradCdfTestFixture, AgradCdfParetoType2_vv_666);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_667, AgradCdfTestFixture, AgradCdfParetoType2_vv_667);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_668, AgradCdfTestFixture, AgradCdfParetoType2_vv_668);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_669, AgradCdfTestFixture, AgradCdfParetoType2_vv_669);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_670, AgradCdfTestFixture, AgradCdfParetoType2_vv_670);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_671, AgradCdfTestFixture, AgradCdfParetoType2_vv_671);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_672, AgradCdfTestFixture, AgradCdfParetoType2_vv_672);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_673, AgradCdfTestFixture, AgradCdfParetoType2_vv_673);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_674, AgradCdfTestFixture, AgradCdfParetoType2_vv_674);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_675, AgradCdfTestFixture, AgradCdfParetoType2_vv_675);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_676, AgradCdfTestFixture, AgradCdfParetoType2_vv_676);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_677, AgradCdfTestFixture, AgradCdfParetoType2_vv_677);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_678, AgradCdfTestFixture, AgradCdfParetoType2_vv_678);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_679, AgradCdfTestFixture, AgradCdfParetoType2_vv_679);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_680, AgradCdfTestFixture, AgradCdfParetoType2_vv_680);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_681, AgradCdfTestFixture, AgradCdfParetoType2_vv_681);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_682, AgradCdfTestFixture, AgradCdfParetoType2_vv_682);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_683, AgradCdfTestFixture, AgradCdfParetoType2_vv_683);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_684, AgradCdfTestFixture, AgradCdfParetoType2_vv_684);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_685, AgradCdfTestFixture, AgradCdfParetoType2_vv_685);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_686, AgradCdfTestFixture, AgradCdfParetoType2_vv_686);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_687, AgradCdfTestFixture, AgradCdfParetoType2_vv_687);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_688, AgradCdfTestFixture, AgradCdfParetoType2_vv_688);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_689, AgradCdfTestFixture, AgradCdfParetoType2_vv_689);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_690, AgradCdfTestFixture, AgradCdfParetoType2_vv_690);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_691, AgradCdfTestFixture, AgradCdfParetoType2_vv_691);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_692, AgradCdfTestFixture, AgradCdfParetoType2_vv_692);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_693, AgradCdfTestFixture, AgradCdfParetoType2_vv_693);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_694, AgradCdfTestFixture, AgradCdfParetoType2_vv_694);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_695, AgradCdfTestFixture, AgradCdfParetoType2_vv_695);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_696, AgradCdfTestFixture, AgradCdfParetoType2_vv_696);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_697, AgradCdfTestFixture, AgradCdfParetoType2_vv_697);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_698, AgradCdfTestFixture, AgradCdfParetoType2_vv_698);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_699, AgradCdfTestFixture, AgradCdfParetoType2_vv_699);
+
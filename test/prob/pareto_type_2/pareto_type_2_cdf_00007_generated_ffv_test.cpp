@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_cdf_test.hpp>
+
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_700;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_701;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_702;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_703;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_704;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_705;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_706;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_707;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_708;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_709;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_710;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, double, empty, empty> type_ffv_711;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty, empty> type_ffv_712;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_713;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty, empty> type_ffv_714;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_715;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_716;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty, empty> type_ffv_717;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_718;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_719;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_720;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_721;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_722;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_723;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_724;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_725;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_726;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_727;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_728;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty, empty> type_ffv_729;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_730;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_731;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_732;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_733;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_734;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_735;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_736;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_737;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_738;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_739;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_740;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_741;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_742;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_743;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_744;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_745;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_746;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty, empty> type_ffv_747;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_ffv_748;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_749;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_750;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_751;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_752;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_ffv_753;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_754;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_755;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_756;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_757;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_758;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_759;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_760;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_761;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_762;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_763;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_764;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_765;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_766;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_767;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_768;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_769;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_770;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_771;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_772;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_773;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_774;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_775;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_776;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_777;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_778;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_779;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_780;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_781;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_782;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, double, double, empty, empty> type_ffv_783;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, double, std::vector<double>, empty, empty> type_ffv_784;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_785;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, double, fvar<fvar<var> >, empty, empty> type_ffv_786;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_787;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_788;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<double>, double, empty, empty> type_ffv_789;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<double>, std::vector<double>, empty, empty> type_ffv_790;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_791;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_792;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_793;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_794;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_795;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_796;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_797;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_798;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_799;
+
+typedef std::tuple<AgradCdfParetoType2, type_ffv_700> AgradCdfParetoType2_ffv_700;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_701> AgradCdfParetoType2_ffv_701;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_702> AgradCdfParetoType2_ffv_702;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_703> AgradCdfParetoType2_ffv_703;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_704> AgradCdfParetoType2_ffv_704;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_705> AgradCdfParetoType2_ffv_705;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_706> AgradCdfParetoType2_ffv_706;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_707> AgradCdfParetoType2_ffv_707;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_708> AgradCdfParetoType2_ffv_708;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_709> AgradCdfParetoType2_ffv_709;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_710> AgradCdfParetoType2_ffv_710;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_711> AgradCdfParetoType2_ffv_711;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_712> AgradCdfParetoType2_ffv_712;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_713> AgradCdfParetoType2_ffv_713;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_714> AgradCdfParetoType2_ffv_714;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_715> AgradCdfParetoType2_ffv_715;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_716> AgradCdfParetoType2_ffv_716;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_717> AgradCdfParetoType2_ffv_717;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_718> AgradCdfParetoType2_ffv_718;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_719> AgradCdfParetoType2_ffv_719;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_720> AgradCdfParetoType2_ffv_720;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_721> AgradCdfParetoType2_ffv_721;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_722> AgradCdfParetoType2_ffv_722;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_723> AgradCdfParetoType2_ffv_723;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_724> AgradCdfParetoType2_ffv_724;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_725> AgradCdfParetoType2_ffv_725;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_726> AgradCdfParetoType2_ffv_726;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_727> AgradCdfParetoType2_ffv_727;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_728> AgradCdfParetoType2_ffv_728;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_729> AgradCdfParetoType2_ffv_729;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_730> AgradCdfParetoType2_ffv_730;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_731> AgradCdfParetoType2_ffv_731;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_732> AgradCdfParetoType2_ffv_732;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_733> AgradCdfParetoType2_ffv_733;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_734> AgradCdfParetoType2_ffv_734;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_735> AgradCdfParetoType2_ffv_735;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_736> AgradCdfParetoType2_ffv_736;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_737> AgradCdfParetoType2_ffv_737;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_738> AgradCdfParetoType2_ffv_738;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_739> AgradCdfParetoType2_ffv_739;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_740> AgradCdfParetoType2_ffv_740;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_741> AgradCdfParetoType2_ffv_741;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_742> AgradCdfParetoType2_ffv_742;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_743> AgradCdfParetoType2_ffv_743;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_744> AgradCdfParetoType2_ffv_744;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_745> AgradCdfParetoType2_ffv_745;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_746> AgradCdfParetoType2_ffv_746;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_747> AgradCdfParetoType2_ffv_747;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_748> AgradCdfParetoType2_ffv_748;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_749> AgradCdfParetoType2_ffv_749;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_750> AgradCdfParetoType2_ffv_750;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_751> AgradCdfParetoType2_ffv_751;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_752> AgradCdfParetoType2_ffv_752;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_753> AgradCdfParetoType2_ffv_753;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_754> AgradCdfParetoType2_ffv_754;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_755> AgradCdfParetoType2_ffv_755;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_756> AgradCdfParetoType2_ffv_756;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_757> AgradCdfParetoType2_ffv_757;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_758> AgradCdfParetoType2_ffv_758;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_759> AgradCdfParetoType2_ffv_759;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_760> AgradCdfParetoType2_ffv_760;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_761> AgradCdfParetoType2_ffv_761;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_762> AgradCdfParetoType2_ffv_762;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_763> AgradCdfParetoType2_ffv_763;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_764> AgradCdfParetoType2_ffv_764;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_765> AgradCdfParetoType2_ffv_765;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_766> AgradCdfParetoType2_ffv_766;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_767> AgradCdfParetoType2_ffv_767;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_768> AgradCdfParetoType2_ffv_768;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_769> AgradCdfParetoType2_ffv_769;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_770> AgradCdfParetoType2_ffv_770;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_771> AgradCdfParetoType2_ffv_771;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_772> AgradCdfParetoType2_ffv_772;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_773> AgradCdfParetoType2_ffv_773;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_774> AgradCdfParetoType2_ffv_774;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_775> AgradCdfParetoType2_ffv_775;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_776> AgradCdfParetoType2_ffv_776;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_777> AgradCdfParetoType2_ffv_777;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_778> AgradCdfParetoType2_ffv_778;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_779> AgradCdfParetoType2_ffv_779;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_780> AgradCdfParetoType2_ffv_780;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_781> AgradCdfParetoType2_ffv_781;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_782> AgradCdfParetoType2_ffv_782;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_783> AgradCdfParetoType2_ffv_783;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_784> AgradCdfParetoType2_ffv_784;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_785> AgradCdfParetoType2_ffv_785;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_786> AgradCdfParetoType2_ffv_786;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_787> AgradCdfParetoType2_ffv_787;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_788> AgradCdfParetoType2_ffv_788;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_789> AgradCdfParetoType2_ffv_789;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_790> AgradCdfParetoType2_ffv_790;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_791> AgradCdfParetoType2_ffv_791;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_792> AgradCdfParetoType2_ffv_792;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_793> AgradCdfParetoType2_ffv_793;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_794> AgradCdfParetoType2_ffv_794;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_795> AgradCdfParetoType2_ffv_795;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_796> AgradCdfParetoType2_ffv_796;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_797> AgradCdfParetoType2_ffv_797;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_798> AgradCdfParetoType2_ffv_798;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_799> AgradCdfParetoType2_ffv_799;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_700, AgradCdfTestFixture, AgradCdfParetoType2_ffv_700);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_701, AgradCdfTestFixture, AgradCdfParetoType2_ffv_701);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_702, AgradCdfTestFixture, AgradCdfParetoType2_ffv_702);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_703, AgradCdfTestFixture, AgradCdfParetoType2_ffv_703);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_704, AgradCdfTestFixture, AgradCdfParetoType2_ffv_704);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_705, AgradCdfTestFixture, AgradCdfParetoType2_ffv_705);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_706, AgradCdfTestFixture, AgradCdfParetoType2_ffv_706);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_707, AgradCdfTestFixture, AgradCdfParetoType2_ffv_707);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_708, AgradCdfTestFixture, AgradCdfParetoType2_ffv_708);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_709, AgradCdfTestFixture, AgradCdfParetoType2_ffv_709);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_710, AgradCdfTestFixture, AgradCdfParetoType2_ffv_710);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_711, AgradCdfTestFixture, AgradCdfParetoType2_ffv_711);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_712, AgradCdfTestFixture, AgradCdfParetoType2_ffv_712);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_713, AgradCdfTestFixture, AgradCdfParetoType2_ffv_713);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_714, AgradCdfTestFixture, AgradCdfParetoType2_ffv_714);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_715, AgradCdfTestFixture, AgradCdfParetoType2_ffv_715);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_716, AgradCdfTestFixture, AgradCdfParetoType2_ffv_716);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_717, AgradCdfTestFixture, AgradCdfParetoType2_ffv_717);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_718, AgradCdfTestFixture, AgradCdfParetoType2_ffv_718);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_719, AgradCdfTestFixture, AgradCdfParetoType2_ffv_719);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_720, AgradCdfTestFixture, AgradCdfParetoType2_ffv_720);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_721, AgradCdfTestFixture, AgradCdfParetoType2_ffv_721);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_722, AgradCdfTestFixture, AgradCdfParetoType2_ffv_722);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_723, AgradCdfTestFixture, AgradCdfParetoType2_ffv_723);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_724, AgradCdfTestFixture, AgradCdfParetoType2_ffv_724);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_725, AgradCdfTestFixture, AgradCdfParetoType2_ffv_725);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_726, AgradCdfTestFixture, AgradCdfParetoType2_ffv_726);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_727, AgradCdfTestFixture, AgradCdfParetoType2_ffv_727);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_728, AgradCdfTestFixture, AgradCdfParetoType2_ffv_728);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_729, AgradCdfTestFixture, AgradCdfParetoType2_ffv_729);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_730, AgradCdfTestFixture, AgradCdfParetoType2_ffv_730);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_731, AgradCdfTestFixture, AgradCdfParetoType2_ffv_731);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_732, AgradCdfTestFixture, AgradCdfParetoType2_ffv_732);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_733, AgradCdfTestFixture, AgradCdfParetoType2_ffv_733);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_734, AgradCdfTestFixture, AgradCdfParetoType2_ffv_734);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_735, AgradCdfTestFixture, AgradCdfParetoType2_ffv_735);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_736, AgradCdfTestFixture, AgradCdfParetoType2_ffv_736);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_737, AgradCdfTestFixture, AgradCdfParetoType2_ffv_737);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_738, AgradCdfTestFixture, AgradCdfParetoType2_ffv_738);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_739, AgradCdfTestFixture, AgradCdfParetoType2_ffv_739);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_740, AgradCdfTestFixture, AgradCdfParetoType2_ffv_740);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_741, AgradCdfTestFixture, AgradCdfParetoType2_ffv_741);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_742, AgradCdfTestFixture, AgradCdfParetoType2_ffv_742);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_743, AgradCdfTestFixture, AgradCdfParetoType2_ffv_743);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_744, AgradCdfTestFixture, AgradCdfParetoType2_ffv_744);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_745, AgradCdfTestFixture, AgradCdfParetoType2_ffv_745);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_746, AgradCdfTestFixture, AgradCdfParetoType2_ffv_746);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_747, AgradCdfTestFixture, AgradCdfParetoType2_ffv_747);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_748, AgradCdfTestFixture, AgradCdfParetoType2_ffv_748);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_749, AgradCdfTestFixture, AgradCdfParetoType2_ffv_749);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_750, AgradCdfTestFixture, AgradCdfParetoType2_ffv_750);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_751, AgradCdfTestFixture, AgradCdfParetoType2_ffv_751);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_752, AgradCdfTestFixture, AgradCdfParetoType2_ffv_752);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_753, AgradCdfTestFixture, AgradCdfParetoType2_ffv_753);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_754, AgradCdfTestFixture, AgradCdfParetoType2_ffv_754);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_755, AgradCdfTestFixture, AgradCdfParetoType2_ffv_755);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_756, AgradCdfTestFixture, AgradCdfParetoType2_ffv_756);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_757, AgradCdfTestFixture, AgradCdfParetoType2_ffv_757);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_758, AgradCdfTestFixture, AgradCdfParetoType2_ffv_758);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_759, AgradCdfTestFixture, AgradCdfParetoType2_ffv_759);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_760, AgradCdfTestFixture, AgradCdfParetoType2_ffv_760);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_761, AgradCdfTestFixture, AgradCdfParetoType2_ffv_761);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_762, AgradCdfTestFixture, AgradCdfParetoType2_ffv_762);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_763, AgradCdfTestFixture, AgradCdfParetoType2_ffv_763);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_764, AgradCdfTestFixture, AgradCdfParetoType2_ffv_764);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_765, AgradCdfTestFixture, AgradCdfParetoType2_ffv_765);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_766, AgradCdfTestFixture, AgradCdfParetoType2_ffv_766);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_767, AgradCdfTestFixture, AgradCdfParetoType2_ffv_767);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_768, AgradCdfTestFixture, AgradCdfParetoType2_ffv_768);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_769, AgradCdfTestFixture, AgradCdfParetoType2_ffv_769);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_770, AgradCdfTestFixture, AgradCdfParetoType2_ffv_770);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_771, AgradCdfTestFixture, AgradCdfParetoType2_ffv_771);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_772, AgradCdfTestFixture, AgradCdfParetoType2_ffv_772);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_773, AgradCdfTestFixture, AgradCdfParetoType2_ffv_773);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_774, AgradCdfTestFixture, AgradCdfParetoType2_ffv_774);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_775, AgradCdfTestFixture, AgradCdfParetoType2_ffv_775);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_776, AgradCdfTestFixture, AgradCdfParetoType2_ffv_776);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_777, AgradCdfTestFixture, AgradCdfParetoType2_ffv_777);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_778, AgradCdfTestFixture, AgradCdfParetoType2_ffv_778);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_779, AgradCdfTestFixture, AgradCdfParetoType2_ffv_779);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_780, AgradCdfTestFixture, AgradCdfParetoType2_ffv_780);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_781, AgradCdfTestFixture, AgradCdfParetoType2_ffv_781);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_782, AgradCdfTestFixture, AgradCdfParetoType2_ffv_782);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_783, AgradCdfTestFixture, AgradCdfParetoType2_ffv_783);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_784, AgradCdfTestFixture, AgradCdfParetoType2_ffv_784);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_785, AgradCdfTestFixture, AgradCdfParetoType2_ffv_785);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_786, AgradCdfTestFixture, AgradCdfParetoType2_ffv_786);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_787, AgradCdfTestFixture, AgradCdfParetoType2_ffv_787);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_788, AgradCdfTestFixture, AgradCdfParetoType2_ffv_788);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_789, AgradCdfTestFixture, AgradCdfParetoType2_ffv_789);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_790, AgradCdfTestFixture, AgradCdfParetoType2_ffv_790);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_791, AgradCdfTestFixture, AgradCdfParetoType2_ffv_791);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_792, AgradCdfTestFixture, AgradCdfParetoType2_ffv_792);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_793, AgradCdfTestFixture, AgradCdfParetoType2_ffv_793);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_794, AgradCdfTestFixture, AgradCdfParetoType2_ffv_794);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_795, AgradCdfTestFixture, AgradCdfParetoType2_ffv_795);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_796, AgradCdfTestFixture, AgradCdfParetoType2_ffv_796);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_797, AgradCdfTestFixture, AgradCdfParetoType2_ffv_797);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_798, AgradCdfTestFixture, AgradCdfParetoType2_ffv_798);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_799, AgradCdfTestFixture, AgradCdfParetoType2_ffv_799);
+
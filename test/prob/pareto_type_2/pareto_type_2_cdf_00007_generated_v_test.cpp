@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_cdf_test.hpp>
+
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_700;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_701;
+typedef std::tuple<var, std::vector<double>, var, double, empty, empty> type_v_702;
+typedef std::tuple<var, std::vector<double>, var, std::vector<double>, empty, empty> type_v_703;
+typedef std::tuple<var, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_704;
+typedef std::tuple<var, std::vector<double>, var, var, empty, empty> type_v_705;
+typedef std::tuple<var, std::vector<double>, var, std::vector<var>, empty, empty> type_v_706;
+typedef std::tuple<var, std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_707;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, double, empty, empty> type_v_708;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_v_709;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_710;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, var, empty, empty> type_v_711;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_v_712;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_713;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_714;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_715;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_716;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_717;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_718;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_719;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_720;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_721;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_722;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_723;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_724;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_725;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_726;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_727;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_728;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_729;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_730;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_731;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_732;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_733;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_734;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_735;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_736;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_737;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_738;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_739;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_740;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_741;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_742;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_743;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_744;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_745;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_746;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_747;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_748;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_749;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_750;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_751;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_752;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_753;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_754;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_755;
+typedef std::tuple<var, var, double, double, empty, empty> type_v_756;
+typedef std::tuple<var, var, double, std::vector<double>, empty, empty> type_v_757;
+typedef std::tuple<var, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_758;
+typedef std::tuple<var, var, double, var, empty, empty> type_v_759;
+typedef std::tuple<var, var, double, std::vector<var>, empty, empty> type_v_760;
+typedef std::tuple<var, var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_761;
+typedef std::tuple<var, var, std::vector<double>, double, empty, empty> type_v_762;
+typedef std::tuple<var, var, std::vector<double>, std::vector<double>, empty, empty> type_v_763;
+typedef std::tuple<var, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_764;
+typedef std::tuple<var, var, std::vector<double>, var, empty, empty> type_v_765;
+typedef std::tuple<var, var, std::vector<double>, std::vector<var>, empty, empty> type_v_766;
+typedef std::tuple<var, var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_767;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_768;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_769;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_770;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_771;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_772;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_773;
+typedef std::tuple<var, var, var, double, empty, empty> type_v_774;
+typedef std::tuple<var, var, var, std::vector<double>, empty, empty> type_v_775;
+typedef std::tuple<var, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_776;
+typedef std::tuple<var, var, var, var, empty, empty> type_v_777;
+typedef std::tuple<var, var, var, std::vector<var>, empty, empty> type_v_778;
+typedef std::tuple<var, var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_779;
+typedef std::tuple<var, var, std::vector<var>, double, empty, empty> type_v_780;
+typedef std::tuple<var, var, std::vector<var>, std::vector<double>, empty, empty> type_v_781;
+typedef std::tuple<var, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_782;
+typedef std::tuple<var, var, std::vector<var>, var, empty, empty> type_v_783;
+typedef std::tuple<var, var, std::vector<var>, std::vector<var>, empty, empty> type_v_784;
+typedef std::tuple<var, var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_785;
+typedef std::tuple<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_786;
+typedef std::tuple<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_787;
+typedef std::tuple<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_788;
+typedef std::tuple<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_789;
+typedef std::tuple<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_790;
+typedef std::tuple<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_791;
+typedef std::tuple<var, std::vector<var>, double, double, empty, empty> type_v_792;
+typedef std::tuple<var, std::vector<var>, double, std::vector<double>, empty, empty> type_v_793;
+typedef std::tuple<var, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_794;
+typedef std::tuple<var, std::vector<var>, double, var, empty, empty> type_v_795;
+typedef std::tuple<var, std::vector<var>, double, std::vector<var>, empty, empty> type_v_796;
+typedef std::tuple<var, std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_797;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, double, empty, empty> type_v_798;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_v_799;
+
+typedef std::tuple<AgradCdfParetoType2, type_v_700> AgradCdfParetoType2_v_700;
+typedef std::tuple<AgradCdfParetoType2, type_v_701> AgradCdfParetoType2_v_701;
+typedef std::tuple<AgradCdfParetoType2, type_v_702> AgradCdfParetoType2_v_702;
+typedef std::tuple<AgradCdfParetoType2, type_v_703> AgradCdfParetoType2_v_703;
+typedef std::tuple<AgradCdfParetoType2, type_v_704> AgradCdfParetoType2_v_704;
+typedef std::tuple<AgradCdfParetoType2, type_v_705> AgradCdfParetoType2_v_705;
+typedef std::tuple<AgradCdfParetoType2, type_v_706> AgradCdfParetoType2_v_706;
+typedef std::tuple<AgradCdfParetoType2, type_v_707> AgradCdfParetoType2_v_707;
+typedef std::tuple<AgradCdfParetoType2, type_v_708> AgradCdfParetoType2_v_708;
+typedef std::tuple<AgradCdfParetoType2, type_v_709> AgradCdfParetoType2_v_709;
+typedef std::tuple<AgradCdfParetoType2, type_v_710> AgradCdfParetoType2_v_710;
+typedef std::tuple<AgradCdfParetoType2, type_v_711> AgradCdfParetoType2_v_711;
+typedef std::tuple<AgradCdfParetoType2, type_v_712> AgradCdfParetoType2_v_712;
+typedef std::tuple<AgradCdfParetoType2, type_v_713> AgradCdfParetoType2_v_713;
+typedef std::tuple<AgradCdfParetoType2, type_v_714> AgradCdfParetoType2_v_714;
+typedef std::tuple<AgradCdfParetoType2, type_v_715> AgradCdfParetoType2_v_715;
+typedef std::tuple<AgradCdfParetoType2, type_v_716> AgradCdfParetoType2_v_716;
+typedef std::tuple<AgradCdfParetoType2, type_v_717> AgradCdfParetoType2_v_717;
+typedef std::tuple<AgradCdfParetoType2, type_v_718> AgradCdfParetoType2_v_718;
+typedef std::tuple<AgradCdfParetoType2, type_v_719> AgradCdfParetoType2_v_719;
+typedef std::tuple<AgradCdfParetoType2, type_v_720> AgradCdfParetoType2_v_720;
+typedef std::tuple<AgradCdfParetoType2, type_v_721> AgradCdfParetoType2_v_721;
+typedef std::tuple<AgradCdfParetoType2, type_v_722> AgradCdfParetoType2_v_722;
+typedef std::tuple<AgradCdfParetoType2, type_v_723> AgradCdfParetoType2_v_723;
+typedef std::tuple<AgradCdfParetoType2, type_v_724> AgradCdfParetoType2_v_724;
+typedef std::tuple<AgradCdfParetoType2, type_v_725> AgradCdfParetoType2_v_725;
+typedef std::tuple<AgradCdfParetoType2, type_v_726> AgradCdfParetoType2_v_726;
+typedef std::tuple<AgradCdfParetoType2, type_v_727> AgradCdfParetoType2_v_727;
+typedef std::tuple<AgradCdfParetoType2, type_v_728> AgradCdfParetoType2_v_728;
+typedef std::tuple<AgradCdfParetoType2, type_v_729> AgradCdfParetoType2_v_729;
+typedef std::tuple<AgradCdfParetoType2, type_v_730> AgradCdfParetoType2_v_730;
+typedef std::tuple<AgradCdfParetoType2, type_v_731> AgradCdfParetoType2_v_731;
+typedef std::tuple<AgradCdfParetoType2, type_v_732> AgradCdfParetoType2_v_732;
+typedef std::tuple<AgradCdfParetoType2, type_v_733> AgradCdfParetoType2_v_733;
+typedef std::tuple<AgradCdfParetoType2, type_v_734> AgradCdfParetoType2_v_734;
+typedef std::tuple<AgradCdfParetoType2, type_v_735> AgradCdfParetoType2_v_735;
+typedef std::tuple<AgradCdfParetoType2, type_v_736> AgradCdfParetoType2_v_736;
+typedef std::tuple<AgradCdfParetoType2, type_v_737> AgradCdfParetoType2_v_737;
+typedef std::tuple<AgradCdfParetoType2, type_v_738> AgradCdfParetoType2_v_738;
+typedef std::tuple<AgradCdfParetoType2, type_v_739> AgradCdfParetoType2_v_739;
+typedef std::tuple<AgradCdfParetoType2, type_v_740> AgradCdfParetoType2_v_740;
+typedef std::tuple<AgradCdfParetoType2, type_v_741> AgradCdfParetoType2_v_741;
+typedef std::tuple<AgradCdfParetoType2, type_v_742> AgradCdfParetoType2_v_742;
+typedef std::tuple<AgradCdfParetoType2, type_v_743> AgradCdfParetoType2_v_743;
+typedef std::tuple<AgradCdfParetoType2, type_v_744> AgradCdfParetoType2_v_744;
+typedef std::tuple<AgradCdfParetoType2, type_v_745> AgradCdfParetoType2_v_745;
+typedef std::tuple<AgradCdfParetoType2, type_v_746> AgradCdfParetoType2_v_746;
+typedef std::tuple<AgradCdfParetoType2, type_v_747> AgradCdfParetoType2_v_747;
+typedef std::tuple<AgradCdfParetoType2, type_v_748> AgradCdfParetoType2_v_748;
+typedef std::tuple<AgradCdfParetoType2, type_v_749> AgradCdfParetoType2_v_749;
+typedef std::tuple<AgradCdfParetoType2, type_v_750> AgradCdfParetoType2_v_750;
+typedef std::tuple<AgradCdfParetoType2, type_v_751> AgradCdfParetoType2_v_751;
+typedef std::tuple<AgradCdfParetoType2, type_v_752> AgradCdfParetoType2_v_752;
+typedef std::tuple<AgradCdfParetoType2, type_v_753> AgradCdfParetoType2_v_753;
+typedef std::tuple<AgradCdfParetoType2, type_v_754> AgradCdfParetoType2_v_754;
+typedef std::tuple<AgradCdfParetoType2, type_v_755> AgradCdfParetoType2_v_755;
+typedef std::tuple<AgradCdfParetoType2, type_v_756> AgradCdfParetoType2_v_756;
+typedef std::tuple<AgradCdfParetoType2, type_v_757> AgradCdfParetoType2_v_757;
+typedef std::tuple<AgradCdfParetoType2, type_v_758> AgradCdfParetoType2_v_758;
+typedef std::tuple<AgradCdfParetoType2, type_v_759> AgradCdfParetoType2_v_759;
+typedef std::tuple<AgradCdfParetoType2, type_v_760> AgradCdfParetoType2_v_760;
+typedef std::tuple<AgradCdfParetoType2, type_v_761> AgradCdfParetoType2_v_761;
+typedef std::tuple<AgradCdfParetoType2, type_v_762> AgradCdfParetoType2_v_762;
+typedef std::tuple<AgradCdfParetoType2, type_v_763> AgradCdfParetoType2_v_763;
+typedef std::tuple<AgradCdfParetoType2, type_v_764> AgradCdfParetoType2_v_764;
+typedef std::tuple<AgradCdfParetoType2, type_v_765> AgradCdfParetoType2_v_765;
+typedef std::tuple<AgradCdfParetoType2, type_v_766> AgradCdfParetoType2_v_766;
+typedef std::tuple<AgradCdfParetoType2, type_v_767> AgradCdfParetoType2_v_767;
+typedef std::tuple<AgradCdfParetoType2, type_v_768> AgradCdfParetoType2_v_768;
+typedef std::tuple<AgradCdfParetoType2, type_v_769> AgradCdfParetoType2_v_769;
+typedef std::tuple<AgradCdfParetoType2, type_v_770> AgradCdfParetoType2_v_770;
+typedef std::tuple<AgradCdfParetoType2, type_v_771> AgradCdfParetoType2_v_771;
+typedef std::tuple<AgradCdfParetoType2, type_v_772> AgradCdfParetoType2_v_772;
+typedef std::tuple<AgradCdfParetoType2, type_v_773> AgradCdfParetoType2_v_773;
+typedef std::tuple<AgradCdfParetoType2, type_v_774> AgradCdfParetoType2_v_774;
+typedef std::tuple<AgradCdfParetoType2, type_v_775> AgradCdfParetoType2_v_775;
+typedef std::tuple<AgradCdfParetoType2, type_v_776> AgradCdfParetoType2_v_776;
+typedef std::tuple<AgradCdfParetoType2, type_v_777> AgradCdfParetoType2_v_777;
+typedef std::tuple<AgradCdfParetoType2, type_v_778> AgradCdfParetoType2_v_778;
+typedef std::tuple<AgradCdfParetoType2, type_v_779> AgradCdfParetoType2_v_779;
+typedef std::tuple<AgradCdfParetoType2, type_v_780> AgradCdfParetoType2_v_780;
+typedef std::tuple<AgradCdfParetoType2, type_v_781> AgradCdfParetoType2_v_781;
+typedef std::tuple<AgradCdfParetoType2, type_v_782> AgradCdfParetoType2_v_782;
+typedef std::tuple<AgradCdfParetoType2, type_v_783> AgradCdfParetoType2_v_783;
+typedef std::tuple<AgradCdfParetoType2, type_v_784> AgradCdfParetoType2_v_784;
+typedef std::tuple<AgradCdfParetoType2, type_v_785> AgradCdfParetoType2_v_785;
+typedef std::tuple<AgradCdfParetoType2, type_v_786> AgradCdfParetoType2_v_786;
+typedef std::tuple<AgradCdfParetoType2, type_v_787> AgradCdfParetoType2_v_787;
+typedef std::tuple<AgradCdfParetoType2, type_v_788> AgradCdfParetoType2_v_788;
+typedef std::tuple<AgradCdfParetoType2, type_v_789> AgradCdfParetoType2_v_789;
+typedef std::tuple<AgradCdfParetoType2, type_v_790> AgradCdfParetoType2_v_790;
+typedef std::tuple<AgradCdfParetoType2, type_v_791> AgradCdfParetoType2_v_791;
+typedef std::tuple<AgradCdfParetoType2, type_v_792> AgradCdfParetoType2_v_792;
+typedef std::tuple<AgradCdfParetoType2, type_v_793> AgradCdfParetoType2_v_793;
+typedef std::tuple<AgradCdfParetoType2, type_v_794> AgradCdfParetoType2_v_794;
+typedef std::tuple<AgradCdfParetoType2, type_v_795> AgradCdfParetoType2_v_795;
+typedef std::tuple<AgradCdfParetoType2, type_v_796> AgradCdfParetoType2_v_796;
+typedef std::tuple<AgradCdfParetoType2, type_v_797> AgradCdfParetoType2_v_797;
+typedef std::tuple<AgradCdfParetoType2, type_v_798> AgradCdfParetoType2_v_798;
+typedef std::tuple<AgradCdfParetoType2, type_v_799> AgradCdfParetoType2_v_799;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_700, AgradCdfTestFixture, AgradCdfParetoType2_v_700);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_701, AgradCdfTestFixture, AgradCdfParetoType2_v_701);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_702, AgradCdfTestFixture, AgradCdfParetoType2_v_702);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_703, AgradCdfTestFixture, AgradCdfParetoType2_v_703);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_704, AgradCdfTestFixture, AgradCdfParetoType2_v_704);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_705, AgradCdfTestFixture, AgradCdfParetoType2_v_705);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_706, AgradCdfTestFixture, AgradCdfParetoType2_v_706);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_707, AgradCdfTestFixture, AgradCdfParetoType2_v_707);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_708, AgradCdfTestFixture, AgradCdfParetoType2_v_708);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_709, AgradCdfTestFixture, AgradCdfParetoType2_v_709);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_710, AgradCdfTestFixture, AgradCdfParetoType2_v_710);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_711, AgradCdfTestFixture, AgradCdfParetoType2_v_711);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_712, AgradCdfTestFixture, AgradCdfParetoType2_v_712);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_713, AgradCdfTestFixture, AgradCdfParetoType2_v_713);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_714, AgradCdfTestFixture, AgradCdfParetoType2_v_714);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_715, AgradCdfTestFixture, AgradCdfParetoType2_v_715);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_716, AgradCdfTestFixture, AgradCdfParetoType2_v_716);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_717, AgradCdfTestFixture, AgradCdfParetoType2_v_717);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_718, AgradCdfTestFixture, AgradCdfParetoType2_v_718);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_719, AgradCdfTestFixture, AgradCdfParetoType2_v_719);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_720, AgradCdfTestFixture, AgradCdfParetoType2_v_720);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_721, AgradCdfTestFixture, AgradCdfParetoType2_v_721);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_722, AgradCdfTestFixture, AgradCdfParetoType2_v_722);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_723, AgradCdfTestFixture, AgradCdfParetoType2_v_723);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_724, AgradCdfTestFixture, AgradCdfParetoType2_v_724);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_725, AgradCdfTestFixture, AgradCdfParetoType2_v_725);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_726, AgradCdfTestFixture, AgradCdfParetoType2_v_726);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_727, AgradCdfTestFixture, AgradCdfParetoType2_v_727);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_728, AgradCdfTestFixture, AgradCdfParetoType2_v_728);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_729, AgradCdfTestFixture, AgradCdfParetoType2_v_729);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_730, AgradCdfTestFixture, AgradCdfParetoType2_v_730);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_731, AgradCdfTestFixture, AgradCdfParetoType2_v_731);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_732, AgradCdfTestFixture, AgradCdfParetoType2_v_732);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_733, AgradCdfTestFixture, AgradCdfParetoType2_v_733);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_734, AgradCdfTestFixture, AgradCdfParetoType2_v_734);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_735, AgradCdfTestFixture, AgradCdfParetoType2_v_735);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_736, AgradCdfTestFixture, AgradCdfParetoType2_v_736);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_737, AgradCdfTestFixture, AgradCdfParetoType2_v_737);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_738, AgradCdfTestFixture, AgradCdfParetoType2_v_738);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_739, AgradCdfTestFixture, AgradCdfParetoType2_v_739);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_740, AgradCdfTestFixture, AgradCdfParetoType2_v_740);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_741, AgradCdfTestFixture, AgradCdfParetoType2_v_741);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_742, AgradCdfTestFixture, AgradCdfParetoType2_v_742);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_743, AgradCdfTestFixture, AgradCdfParetoType2_v_743);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_744, AgradCdfTestFixture, AgradCdfParetoType2_v_744);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_745, AgradCdfTestFixture, AgradCdfParetoType2_v_745);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_746, AgradCdfTestFixture, AgradCdfParetoType2_v_746);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_747, AgradCdfTestFixture, AgradCdfParetoType2_v_747);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_748, AgradCdfTestFixture, AgradCdfParetoType2_v_748);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_749, AgradCdfTestFixture, AgradCdfParetoType2_v_749);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_750, AgradCdfTestFixture, AgradCdfParetoType2_v_750);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_751, AgradCdfTestFixture, AgradCdfParetoType2_v_751);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_752, AgradCdfTestFixture, AgradCdfParetoType2_v_752);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_753, AgradCdfTestFixture, AgradCdfParetoType2_v_753);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_754, AgradCdfTestFixture, AgradCdfParetoType2_v_754);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_755, AgradCdfTestFixture, AgradCdfParetoType2_v_755);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_756, AgradCdfTestFixture, AgradCdfParetoType2_v_756);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_757, AgradCdfTestFixture, AgradCdfParetoType2_v_757);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_758, AgradCdfTestFixture, AgradCdfParetoType2_v_758);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_759, AgradCdfTestFixture, AgradCdfParetoType2_v_759);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_760, AgradCdfTestFixture, AgradCdfParetoType2_v_760);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_761, AgradCdfTestFixture, AgradCdfParetoType2_v_761);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_762, AgradCdfTestFixture, AgradCdfParetoType2_v_762);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_763, AgradCdfTestFixture, AgradCdfParetoType2_v_763);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_764, AgradCdfTestFixture, AgradCdfParetoType2_v_764);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_765, AgradCdfTestFixture, AgradCdfParetoType2_v_765);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_766, AgradCdfTestFixture, AgradCdfParetoType2_v_766);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_767, AgradCdfTestFixture, AgradCdfParetoType2_v_767);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_768, AgradCdfTestFixture, AgradCdfParetoType2_v_768);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_769, AgradCdfTestFixture, AgradCdfParetoType2_v_769);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_770, AgradCdfTestFixture, AgradCdfParetoType2_v_770);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_771, AgradCdfTestFixture, AgradCdfParetoType2_v_771);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_772, AgradCdfTestFixture, AgradCdfParetoType2_v_772);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_773, AgradCdfTestFixture, AgradCdfParetoType2_v_773);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_774, AgradCdfTestFixture, AgradCdfParetoType2_v_774);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_775, AgradCdfTestFixture, AgradCdfParetoType2_v_775);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_776, AgradCdfTestFixture, AgradCdfParetoType2_v_776);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_777, AgradCdfTestFixture, AgradCdfParetoType2_v_777);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_778, AgradCdfTestFixture, AgradCdfParetoType2_v_778);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_779, AgradCdfTestFixture, AgradCdfParetoType2_v_779);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_780, AgradCdfTestFixture, AgradCdfParetoType2_v_780);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_781, AgradCdfTestFixture, AgradCdfParetoType2_v_781);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_782, AgradCdfTestFixture, AgradCdfParetoType2_v_782);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_783, AgradCdfTestFixture, AgradCdfParetoType2_v_783);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_784, AgradCdfTestFixture, AgradCdfParetoType2_v_784);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_785, AgradCdfTestFixture, AgradCdfParetoType2_v_785);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_786, AgradCdfTestFixture, AgradCdfParetoType2_v_786);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_787, AgradCdfTestFixture, AgradCdfParetoType2_v_787);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_788, AgradCdfTestFixture, AgradCdfParetoType2_v_788);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_789, AgradCdfTestFixture, AgradCdfParetoType2_v_789);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_790, AgradCdfTestFixture, AgradCdfParetoType2_v_790);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_791, AgradCdfTestFixture, AgradCdfParetoType2_v_791);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_792, AgradCdfTestFixture, AgradCdfParetoType2_v_792);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_793, AgradCdfTestFixture, AgradCdfParetoType2_v_793);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_794, AgradCdfTestFixture, AgradCdfParetoType2_v_794);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_795, AgradCdfTestFixture, AgradCdfParetoType2_v_795);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_796, AgradCdfTestFixture, AgradCdfParetoType2_v_796);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_797, AgradCdfTestFixture, AgradCdfParetoType2_v_797);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_798, AgradCdfTestFixture, AgradCdfParetoType2_v_798);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_799, AgradCdfTestFixture, AgradCdfParetoType2_v_799);
+
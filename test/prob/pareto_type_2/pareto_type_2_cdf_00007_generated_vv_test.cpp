@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_cdf_test.hpp>
+
+typedef std::tuple<var, var, std::vector<var>, std::vector<double>, empty, empty> type_vv_700;
+typedef std::tuple<var, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_701;
+typedef std::tuple<var, var, std::vector<var>, var, empty, empty> type_vv_702;
+typedef std::tuple<var, var, std::vector<var>, std::vector<var>, empty, empty> type_vv_703;
+typedef std::tuple<var, var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_704;
+typedef std::tuple<var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_705;
+typedef std::tuple<var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_706;
+typedef std::tuple<var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_707;
+typedef std::tuple<var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_708;
+typedef std::tuple<var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_709;
+typedef std::tuple<var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_710;
+typedef std::tuple<var, std::vector<var>, double, double, empty, empty> type_vv_711;
+typedef std::tuple<var, std::vector<var>, double, std::vector<double>, empty, empty> type_vv_712;
+typedef std::tuple<var, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_713;
+typedef std::tuple<var, std::vector<var>, double, var, empty, empty> type_vv_714;
+typedef std::tuple<var, std::vector<var>, double, std::vector<var>, empty, empty> type_vv_715;
+typedef std::tuple<var, std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_716;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, double, empty, empty> type_vv_717;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_vv_718;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_719;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, var, empty, empty> type_vv_720;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_vv_721;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_722;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_723;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_724;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_725;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_726;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_727;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_728;
+typedef std::tuple<var, std::vector<var>, var, double, empty, empty> type_vv_729;
+typedef std::tuple<var, std::vector<var>, var, std::vector<double>, empty, empty> type_vv_730;
+typedef std::tuple<var, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_731;
+typedef std::tuple<var, std::vector<var>, var, var, empty, empty> type_vv_732;
+typedef std::tuple<var, std::vector<var>, var, std::vector<var>, empty, empty> type_vv_733;
+typedef std::tuple<var, std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_734;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, double, empty, empty> type_vv_735;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_vv_736;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_737;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, var, empty, empty> type_vv_738;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_vv_739;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_740;
+typedef std::tuple<var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_741;
+typedef std::tuple<var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_742;
+typedef std::tuple<var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_743;
+typedef std::tuple<var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_744;
+typedef std::tuple<var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_745;
+typedef std::tuple<var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_746;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, empty, empty> type_vv_747;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, empty, empty> type_vv_748;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_749;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, empty, empty> type_vv_750;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, empty, empty> type_vv_751;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_752;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, empty, empty> type_vv_753;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, empty, empty> type_vv_754;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_755;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, empty, empty> type_vv_756;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, empty, empty> type_vv_757;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_758;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_759;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_760;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_761;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_762;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_763;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_764;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, empty, empty> type_vv_765;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, empty, empty> type_vv_766;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_767;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, empty, empty> type_vv_768;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, empty, empty> type_vv_769;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_770;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, empty, empty> type_vv_771;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, empty, empty> type_vv_772;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_773;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, empty, empty> type_vv_774;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, empty, empty> type_vv_775;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_776;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_777;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_778;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_779;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_780;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_781;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_782;
+typedef std::tuple<std::vector<var>, double, double, double, empty, empty> type_vv_783;
+typedef std::tuple<std::vector<var>, double, double, std::vector<double>, empty, empty> type_vv_784;
+typedef std::tuple<std::vector<var>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_785;
+typedef std::tuple<std::vector<var>, double, double, var, empty, empty> type_vv_786;
+typedef std::tuple<std::vector<var>, double, double, std::vector<var>, empty, empty> type_vv_787;
+typedef std::tuple<std::vector<var>, double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_788;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, double, empty, empty> type_vv_789;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, std::vector<double>, empty, empty> type_vv_790;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_791;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, var, empty, empty> type_vv_792;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, std::vector<var>, empty, empty> type_vv_793;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_794;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_795;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_796;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_797;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_798;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_799;
+
+typedef std::tuple<AgradCdfParetoType2, type_vv_700> AgradCdfParetoType2_vv_700;
+typedef std::tuple<AgradCdfParetoType2, type_vv_701> AgradCdfParetoType2_vv_701;
+typedef std::tuple<AgradCdfParetoType2, type_vv_702> AgradCdfParetoType2_vv_702;
+typedef std::tuple<AgradCdfParetoType2, type_vv_703> AgradCdfParetoType2_vv_703;
+typedef std::tuple<AgradCdfParetoType2, type_vv_704> AgradCdfParetoType2_vv_704;
+typedef std::tuple<AgradCdfParetoType2, type_vv_705> AgradCdfParetoType2_vv_705;
+typedef std::tuple<AgradCdfParetoType2, type_vv_706> AgradCdfParetoType2_vv_706;
+typedef std::tuple<AgradCdfParetoType2, type_vv_707> AgradCdfParetoType2_vv_707;
+typedef std::tuple<AgradCdfParetoType2, type_vv_708> AgradCdfParetoType2_vv_708;
+typedef std::tuple<AgradCdfParetoType2, type_vv_709> AgradCdfParetoType2_vv_709;
+typedef std::tuple<AgradCdfParetoType2, type_vv_710> AgradCdfParetoType2_vv_710;
+typedef std::tuple<AgradCdfParetoType2, type_vv_711> AgradCdfParetoType2_vv_711;
+typedef std::tuple<AgradCdfParetoType2, type_vv_712> AgradCdfParetoType2_vv_712;
+typedef std::tuple<AgradCdfParetoType2, type_vv_713> AgradCdfParetoType2_vv_713;
+typedef std::tuple<AgradCdfParetoType2, type_vv_714> AgradCdfParetoType2_vv_714;
+typedef std::tuple<AgradCdfParetoType2, type_vv_715> AgradCdfParetoType2_vv_715;
+typedef std::tuple<AgradCdfParetoType2, type_vv_716> AgradCdfParetoType2_vv_716;
+typedef std::tuple<AgradCdfParetoType2, type_vv_717> AgradCdfParetoType2_vv_717;
+typedef std::tuple<AgradCdfParetoType2, type_vv_718> AgradCdfParetoType2_vv_718;
+typedef std::tuple<AgradCdfParetoType2, type_vv_719> AgradCdfParetoType2_vv_719;
+typedef std::tuple<AgradCdfParetoType2, type_vv_720> AgradCdfParetoType2_vv_720;
+typedef std::tuple<AgradCdfParetoType2, type_vv_721> AgradCdfParetoType2_vv_721;
+typedef std::tuple<AgradCdfParetoType2, type_vv_722> AgradCdfParetoType2_vv_722;
+typedef std::tuple<AgradCdfParetoType2, type_vv_723> AgradCdfParetoType2_vv_723;
+typedef std::tuple<AgradCdfParetoType2, type_vv_724> AgradCdfParetoType2_vv_724;
+typedef std::tuple<AgradCdfParetoType2, type_vv_725> AgradCdfParetoType2_vv_725;
+typedef std::tuple<AgradCdfParetoType2, type_vv_726> AgradCdfParetoType2_vv_726;
+typedef std::tuple<AgradCdfParetoType2, type_vv_727> AgradCdfParetoType2_vv_727;
+typedef std::tuple<AgradCdfParetoType2, type_vv_728> AgradCdfParetoType2_vv_728;
+typedef std::tuple<AgradCdfParetoType2, type_vv_729> AgradCdfParetoType2_vv_729;
+typedef std::tuple<AgradCdfParetoType2, type_vv_730> AgradCdfParetoType2_vv_730;
+typedef std::tuple<AgradCdfParetoType2, type_vv_731> AgradCdfParetoType2_vv_731;
+typedef std::tuple<AgradCdfParetoType2, type_vv_732> AgradCdfParetoType2_vv_732;
+typedef std::tuple<AgradCdfParetoType2, type_vv_733> AgradCdfParetoType2_vv_733;
+typedef std::tuple<AgradCdfParetoType2, type_vv_734> AgradCdfParetoType2_vv_734;
+typedef std::tuple<AgradCdfParetoType2, type_vv_735> AgradCdfParetoType2_vv_735;
+typedef std::tuple<AgradCdfParetoType2, type_vv_736> AgradCdfParetoType2_vv_736;
+typedef std::tuple<AgradCdfParetoType2, type_vv_737> AgradCdfParetoType2_vv_737;
+typedef std::tuple<AgradCdfParetoType2, type_vv_738> AgradCdfParetoType2_vv_738;
+typedef std::tuple<AgradCdfParetoType2, type_vv_739> AgradCdfParetoType2_vv_739;
+typedef std::tuple<AgradCdfParetoType2, type_vv_740> AgradCdfParetoType2_vv_740;
+typedef std::tuple<AgradCdfParetoType2, type_vv_741> AgradCdfParetoType2_vv_741;
+typedef std::tuple<AgradCdfParetoType2, type_vv_742> AgradCdfParetoType2_vv_742;
+typedef std::tuple<AgradCdfParetoType2, type_vv_743> AgradCdfParetoType2_vv_743;
+typedef std::tuple<AgradCdfParetoType2, type_vv_744> AgradCdfParetoType2_vv_744;
+typedef std::tuple<AgradCdfParetoType2, type_vv_745> AgradCdfParetoType2_vv_745;
+typedef std::tuple<AgradCdfParetoType2, type_vv_746> AgradCdfParetoType2_vv_746;
+typedef std::tuple<AgradCdfParetoType2, type_vv_747> AgradCdfParetoType2_vv_747;
+typedef std::tuple<AgradCdfParetoType2, type_vv_748> AgradCdfParetoType2_vv_748;
+typedef std::tuple<AgradCdfParetoType2, type_vv_749> AgradCdfParetoType2_vv_749;
+typedef std::tuple<AgradCdfParetoType2, type_vv_750> AgradCdfParetoType2_vv_750;
+typedef std::tuple<AgradCdfParetoType2, type_vv_751> AgradCdfParetoType2_vv_751;
+typedef std::tuple<AgradCdfParetoType2, type_vv_752> AgradCdfParetoType2_vv_752;
+typedef std::tuple<AgradCdfParetoType2, type_vv_753> AgradCdfParetoType2_vv_753;
+typedef std::tuple<AgradCdfParetoType2, type_vv_754> AgradCdfParetoType2_vv_754;
+typedef std::tuple<AgradCdfParetoType2, type_vv_755> AgradCdfParetoType2_vv_755;
+typedef std::tuple<AgradCdfParetoType2, type_vv_756> AgradCdfParetoType2_vv_756;
+typedef std::tuple<AgradCdfParetoType2, type_vv_757> AgradCdfParetoType2_vv_757;
+typedef std::tuple<AgradCdfParetoType2, type_vv_758> AgradCdfParetoType2_vv_758;
+typedef std::tuple<AgradCdfParetoType2, type_vv_759> AgradCdfParetoType2_vv_759;
+typedef std::tuple<AgradCdfParetoType2, type_vv_760> AgradCdfParetoType2_vv_760;
+typedef std::tuple<AgradCdfParetoType2, type_vv_761> AgradCdfParetoType2_vv_761;
+typedef std::tuple<AgradCdfParetoType2, type_vv_762> AgradCdfParetoType2_vv_762;
+typedef std::tuple<AgradCdfParetoType2, type_vv_763> AgradCdfParetoType2_vv_763;
+typedef std::tuple<AgradCdfParetoType2, type_vv_764> AgradCdfParetoType2_vv_764;
+typedef std::tuple<AgradCdfParetoType2, type_vv_765> AgradCdfParetoType2_vv_765;
+typedef std::tuple<AgradCdfParetoType2, type_vv_766> AgradCdfParetoType2_vv_766;
+typedef std::tuple<AgradCdfParetoType2, type_vv_767> AgradCdfParetoType2_vv_767;
+typedef std::tuple<AgradCdfParetoType2, type_vv_768> AgradCdfParetoType2_vv_768;
+typedef std::tuple<AgradCdfParetoType2, type_vv_769> AgradCdfParetoType2_vv_769;
+typedef std::tuple<AgradCdfParetoType2, type_vv_770> AgradCdfParetoType2_vv_770;
+typedef std::tuple<AgradCdfParetoType2, type_vv_771> AgradCdfParetoType2_vv_771;
+typedef std::tuple<AgradCdfParetoType2, type_vv_772> AgradCdfParetoType2_vv_772;
+typedef std::tuple<AgradCdfParetoType2, type_vv_773> AgradCdfParetoType2_vv_773;
+typedef std::tuple<AgradCdfParetoType2, type_vv_774> AgradCdfParetoType2_vv_774;
+typedef std::tuple<AgradCdfParetoType2, type_vv_775> AgradCdfParetoType2_vv_775;
+typedef std::tuple<AgradCdfParetoType2, type_vv_776> AgradCdfParetoType2_vv_776;
+typedef std::tuple<AgradCdfParetoType2, type_vv_777> AgradCdfParetoType2_vv_777;
+typedef std::tuple<AgradCdfParetoType2, type_vv_778> AgradCdfParetoType2_vv_778;
+typedef std::tuple<AgradCdfParetoType2, type_vv_779> AgradCdfParetoType2_vv_779;
+typedef std::tuple<AgradCdfParetoType2, type_vv_780> AgradCdfParetoType2_vv_780;
+typedef std::tuple<AgradCdfParetoType2, type_vv_781> AgradCdfParetoType2_vv_781;
+typedef std::tuple<AgradCdfParetoType2, type_vv_782> AgradCdfParetoType2_vv_782;
+typedef std::tuple<AgradCdfParetoType2, type_vv_783> AgradCdfParetoType2_vv_783;
+typedef std::tuple<AgradCdfParetoType2, type_vv_784> AgradCdfParetoType2_vv_784;
+typedef std::tuple<AgradCdfParetoType2, type_vv_785> AgradCdfParetoType2_vv_785;
+typedef std::tuple<AgradCdfParetoType2, type_vv_786> AgradCdfParetoType2_vv_786;
+typedef std::tuple<AgradCdfParetoType2, type_vv_787> AgradCdfParetoType2_vv_787;
+typedef std::tuple<AgradCdfParetoType2, type_vv_788> AgradCdfParetoType2_vv_788;
+typedef std::tuple<AgradCdfParetoType2, type_vv_789> AgradCdfParetoType2_vv_789;
+typedef std::tuple<AgradCdfParetoType2, type_vv_790> AgradCdfParetoType2_vv_790;
+typedef std::tuple<AgradCdfParetoType2, type_vv_791> AgradCdfParetoType2_vv_791;
+typedef std::tuple<AgradCdfParetoType2, type_vv_792> AgradCdfParetoType2_vv_792;
+typedef std::tuple<AgradCdfParetoType2, type_vv_793> AgradCdfParetoType2_vv_793;
+typedef std::tuple<AgradCdfParetoType2, type_vv_794> AgradCdfParetoType2_vv_794;
+typedef std::tuple<AgradCdfParetoType2, type_vv_795> AgradCdfParetoType2_vv_795;
+typedef std::tuple<AgradCdfParetoType2, type_vv_796> AgradCdfParetoType2_vv_796;
+typedef std::tuple<AgradCdfParetoType2, type_vv_797> AgradCdfParetoType2_vv_797;
+typedef std::tuple<AgradCdfParetoType2, type_vv_798> AgradCdfParetoType2_vv_798;
+typedef std::tuple<AgradCdfParetoType2, type_vv_799> AgradCdfParetoType2_vv_799;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_700, AgradCdfTestFixture, AgradCdfParetoType2_vv_700);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_701, AgradCdfTestFixture, AgradCdfParetoType2_vv_701);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_702, AgradCdfTestFixture, AgradCdfParetoType2_vv_702);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_703, AgradCdfTestFixture, AgradCdfParetoType2_vv_703);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_704, AgradCdfTestFixture, AgradCdfParetoType2_vv_704);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_705, AgradCdfTestFixture, AgradCdfParetoType2_vv_705);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_706, AgradCdfTestFixture, AgradCdfParetoType2_vv_706);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_707, AgradCdfTestFixture, AgradCdfParetoType2_vv_707);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_708, AgradCdfTestFixture, AgradCdfParetoType2_vv_708);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_709, AgradCdfTestFixture, AgradCdfParetoType2_vv_709);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_710, AgradCdfTestFixture, AgradCdfParetoType2_vv_710);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_711, AgradCdfTestFixture, AgradCdfParetoType2_vv_711);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_712, AgradCdfTestFixture, AgradCdfParetoType2_vv_712);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_713, AgradCdfTestFixture, AgradCdfParetoType2_vv_713);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_714, AgradCdfTestFixture, AgradCdfParetoType2_vv_714);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_715, AgradCdfTestFixture, AgradCdfParetoType2_vv_715);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_716, AgradCdfTestFixture, AgradCdfParetoType2_vv_716);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_717, AgradCdfTestFixture, AgradCdfParetoType2_vv_717);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_718, AgradCdfTestFixture, AgradCdfParetoType2_vv_718);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_719, AgradCdfTestFixture, AgradCdfParetoType2_vv_719);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_720, AgradCdfTestFixture, AgradCdfParetoType2_vv_720);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_721, AgradCdfTestFixture, AgradCdfParetoType2_vv_721);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_722, AgradCdfTestFixture, AgradCdfParetoType2_vv_722);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_723, AgradCdfTestFixture, AgradCdfParetoType2_vv_723);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_724, AgradCdfTestFixture, AgradCdfParetoType2_vv_724);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_725, AgradCdfTestFixture, AgradCdfParetoType2_vv_725);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_726, AgradCdfTestFixture, AgradCdfParetoType2_vv_726);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_727, AgradCdfTestFixture, AgradCdfParetoType2_vv_727);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_728, AgradCdfTestFixture, AgradCdfParetoType2_vv_728);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_729, AgradCdfTestFixture, AgradCdfParetoType2_vv_729);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_730, AgradCdfTestFixture, AgradCdfParetoType2_vv_730);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_731, AgradCdfTestFixture, AgradCdfParetoType2_vv_731);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_732, AgradCdfTestFixture, AgradCdfParetoType2_vv_732);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_733, AgradCdfTestFixture, AgradCdfParetoType2_vv_733);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_734, AgradCdfTestFixture, AgradCdfParetoType2_vv_734);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_735, AgradCdfTestFixture, AgradCdfParetoType2_vv_735);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_736, AgradCdfTestFixture, AgradCdfParetoType2_vv_736);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_737, AgradCdfTestFixture, AgradCdfParetoType2_vv_737);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_738, AgradCdfTestFixture, AgradCdfParetoType2_vv_738);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_739, AgradCdfTestFixture, AgradCdfParetoType2_vv_739);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_740, AgradCdfTestFixture, AgradCdfParetoType2_vv_740);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_741, AgradCdfTestFixture, AgradCdfParetoType2_vv_741);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_742, AgradCdfTestFixture, AgradCdfParetoType2_vv_742);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_743, AgradCdfTestFixture, AgradCdfParetoType2_vv_743);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_744, AgradCdfTestFixture, AgradCdfParetoType2_vv_744);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_745, AgradCdfTestFixture, AgradCdfParetoType2_vv_745);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_746, AgradCdfTestFixture, AgradCdfParetoType2_vv_746);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_747, AgradCdfTestFixture, AgradCdfParetoType2_vv_747);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_748, AgradCdfTestFixture, AgradCdfParetoType2_vv_748);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_749, AgradCdfTestFixture, AgradCdfParetoType2_vv_749);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_750, AgradCdfTestFixture, AgradCdfParetoType2_vv_750);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_751, AgradCdfTestFixture, AgradCdfParetoType2_vv_751);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_752, AgradCdfTestFixture, AgradCdfParetoType2_vv_752);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_753, AgradCdfTestFixture, AgradCdfParetoType2_vv_753);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_754, AgradCdfTestFixture, AgradCdfParetoType2_vv_754);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_755, AgradCdfTestFixture, AgradCdfParetoType2_vv_755);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_756, AgradCdfTestFixture, AgradCdfParetoType2_vv_756);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_757, AgradCdfTestFixture, AgradCdfParetoType2_vv_757);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_758, AgradCdfTestFixture, AgradCdfParetoType2_vv_758);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_759, AgradCdfTestFixture, AgradCdfParetoType2_vv_759);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_760, AgradCdfTestFixture, AgradCdfParetoType2_vv_760);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_761, AgradCdfTestFixture, AgradCdfParetoType2_vv_761);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_762, AgradCdfTestFixture, AgradCdfParetoType2_vv_762);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_763, AgradCdfTestFixture, AgradCdfParetoType2_vv_763);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_764, AgradCdfTestFixture, AgradCdfParetoType2_vv_764);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_765, AgradCdfTestFixture, AgradCdfParetoType2_vv_765);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_766, AgradCdfTestFixture, AgradCdfParetoType2_vv_766);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_767, AgradCdfTestFixture, AgradCdfParetoType2_vv_767);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_768, AgradCdfTestFixture, AgradCdfParetoType2_vv_768);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_769, AgradCdfTestFixture, AgradCdfParetoType2_vv_769);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_770, AgradCdfTestFixture, AgradCdfParetoType2_vv_770);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_771, AgradCdfTestFixture, AgradCdfParetoType2_vv_771);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_772, AgradCdfTestFixture, AgradCdfParetoType2_vv_772);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_773, AgradCdfTestFixture, AgradCdfParetoType2_vv_773);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_774, AgradCdfTestFixture, AgradCdfParetoType2_vv_774);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_775, AgradCdfTestFixture, AgradCdfParetoType2_vv_775);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_776, AgradCdfTestFixture, AgradCdfParetoType2_vv_776);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_777, AgradCdfTestFixture, AgradCdfParetoType2_vv_777);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_778, AgradCdfTestFixture, AgradCdfParetoType2_vv_778);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_779, AgradCdfTestFixture, AgradCdfParetoType2_vv_779);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_780, AgradCdfTestFixture, AgradCdfParetoType2_vv_780);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_781, AgradCdfTestFixture, AgradCdfParetoType2_vv_781);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_782, AgradCdfTestFixture, AgradCdfParetoType2_vv_782);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_783, AgradCdfTestFixture, AgradCdfParetoType2_vv_783);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_784, AgradCdfTestFixture, AgradCdfParetoType2_vv_784);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_785, AgradCdfTestFixture, AgradCdfParetoType2_vv_785);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_786, AgradCdfTestFixture, AgradCdfParetoType2_vv_786);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_787, AgradCdfTestFixture, AgradCdfParetoType2_vv_787);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_788, AgradCdfTestFixture, AgradCdfParetoType2_vv_788);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_789, AgradCdfTestFixture, AgradCdfParetoType2_vv_789);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_790, AgradCdfTestFixture, AgradCdfParetoType2_vv_790);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_791, AgradCdfTestFixture, AgradCdfParetoType2_vv_791);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_792, AgradCdfTestFixture, AgradCdfParetoType2_vv_792);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_793, AgradCdfTestFixture, AgradCdfParetoType2_vv_793);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_794, AgradCdfTestFixture, AgradCdfParetoType2_vv_794);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_795, AgradCdfTestFixture, AgradCdfParetoType2_vv_795);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_796, AgradCdfTestFixture, AgradCdfParetoType2_vv_796);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_797, AgradCdfTestFixture, AgradCdfParetoType2_vv_797);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_798, AgradCdfTestFixture, AgradCdfParetoType2_vv_798);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_799, AgradCdfTestFixture, AgradCdfParetoType2_vv_799);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_cdf_test.hpp>
+
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_800;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, double, empty, empty> type_ffv_801;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_802;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_803;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_804;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_805;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_806;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_807;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_808;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_809;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_810;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_811;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_812;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_813;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_814;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_815;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_816;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_817;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_818;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, double, double, empty, empty> type_ffv_819;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, double, std::vector<double>, empty, empty> type_ffv_820;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_821;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, double, fvar<fvar<var> >, empty, empty> type_ffv_822;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_823;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_824;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, double, empty, empty> type_ffv_825;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_826;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_827;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_828;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_829;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_830;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_831;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_832;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_833;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_834;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_835;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_836;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, double, empty, empty> type_ffv_837;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_838;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_839;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_840;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_841;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_842;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_843;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_844;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_845;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_846;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_847;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_848;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_849;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_850;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_851;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_852;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_853;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_854;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty> type_ffv_855;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_ffv_856;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_857;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_858;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_859;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_860;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_ffv_861;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_862;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_863;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_864;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_865;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_866;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_867;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_868;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_869;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_870;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_871;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_872;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_873;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_874;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_875;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_876;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_877;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_878;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_879;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_880;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_881;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_882;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_883;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_884;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_885;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_886;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_887;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_888;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_889;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_890;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, double, empty, empty> type_ffv_891;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, std::vector<double>, empty, empty> type_ffv_892;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_893;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, fvar<fvar<var> >, empty, empty> type_ffv_894;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_895;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_896;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, double, empty, empty> type_ffv_897;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty, empty> type_ffv_898;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_899;
+
+typedef std::tuple<AgradCdfParetoType2, type_ffv_800> AgradCdfParetoType2_ffv_800;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_801> AgradCdfParetoType2_ffv_801;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_802> AgradCdfParetoType2_ffv_802;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_803> AgradCdfParetoType2_ffv_803;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_804> AgradCdfParetoType2_ffv_804;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_805> AgradCdfParetoType2_ffv_805;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_806> AgradCdfParetoType2_ffv_806;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_807> AgradCdfParetoType2_ffv_807;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_808> AgradCdfParetoType2_ffv_808;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_809> AgradCdfParetoType2_ffv_809;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_810> AgradCdfParetoType2_ffv_810;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_811> AgradCdfParetoType2_ffv_811;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_812> AgradCdfParetoType2_ffv_812;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_813> AgradCdfParetoType2_ffv_813;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_814> AgradCdfParetoType2_ffv_814;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_815> AgradCdfParetoType2_ffv_815;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_816> AgradCdfParetoType2_ffv_816;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_817> AgradCdfParetoType2_ffv_817;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_818> AgradCdfParetoType2_ffv_818;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_819> AgradCdfParetoType2_ffv_819;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_820> AgradCdfParetoType2_ffv_820;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_821> AgradCdfParetoType2_ffv_821;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_822> AgradCdfParetoType2_ffv_822;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_823> AgradCdfParetoType2_ffv_823;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_824> AgradCdfParetoType2_ffv_824;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_825> AgradCdfParetoType2_ffv_825;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_826> AgradCdfParetoType2_ffv_826;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_827> AgradCdfParetoType2_ffv_827;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_828> AgradCdfParetoType2_ffv_828;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_829> AgradCdfParetoType2_ffv_829;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_830> AgradCdfParetoType2_ffv_830;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_831> AgradCdfParetoType2_ffv_831;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_832> AgradCdfParetoType2_ffv_832;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_833> AgradCdfParetoType2_ffv_833;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_834> AgradCdfParetoType2_ffv_834;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_835> AgradCdfParetoType2_ffv_835;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_836> AgradCdfParetoType2_ffv_836;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_837> AgradCdfParetoType2_ffv_837;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_838> AgradCdfParetoType2_ffv_838;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_839> AgradCdfParetoType2_ffv_839;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_840> AgradCdfParetoType2_ffv_840;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_841> AgradCdfParetoType2_ffv_841;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_842> AgradCdfParetoType2_ffv_842;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_843> AgradCdfParetoType2_ffv_843;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_844> AgradCdfParetoType2_ffv_844;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_845> AgradCdfParetoType2_ffv_845;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_846> AgradCdfParetoType2_ffv_846;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_847> AgradCdfParetoType2_ffv_847;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_848> AgradCdfParetoType2_ffv_848;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_849> AgradCdfParetoType2_ffv_849;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_850> AgradCdfParetoType2_ffv_850;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_851> AgradCdfParetoType2_ffv_851;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_852> AgradCdfParetoType2_ffv_852;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_853> AgradCdfParetoType2_ffv_853;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_854> AgradCdfParetoType2_ffv_854;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_855> AgradCdfParetoType2_ffv_855;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_856> AgradCdfParetoType2_ffv_856;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_857> AgradCdfParetoType2_ffv_857;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_858> AgradCdfParetoType2_ffv_858;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_859> AgradCdfParetoType2_ffv_859;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_860> AgradCdfParetoType2_ffv_860;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_861> AgradCdfParetoType2_ffv_861;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_862> AgradCdfParetoType2_ffv_862;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_863> AgradCdfParetoType2_ffv_863;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_864> AgradCdfParetoType2_ffv_864;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_865> AgradCdfParetoType2_ffv_865;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_866> AgradCdfParetoType2_ffv_866;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_867> AgradCdfParetoType2_ffv_867;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_868> AgradCdfParetoType2_ffv_868;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_869> AgradCdfParetoType2_ffv_869;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_870> AgradCdfParetoType2_ffv_870;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_871> AgradCdfParetoType2_ffv_871;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_872> AgradCdfParetoType2_ffv_872;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_873> AgradCdfParetoType2_ffv_873;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_874> AgradCdfParetoType2_ffv_874;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_875> AgradCdfParetoType2_ffv_875;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_876> AgradCdfParetoType2_ffv_876;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_877> AgradCdfParetoType2_ffv_877;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_878> AgradCdfParetoType2_ffv_878;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_879> AgradCdfParetoType2_ffv_879;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_880> AgradCdfParetoType2_ffv_880;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_881> AgradCdfParetoType2_ffv_881;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_882> AgradCdfParetoType2_ffv_882;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_883> AgradCdfParetoType2_ffv_883;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_884> AgradCdfParetoType2_ffv_884;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_885> AgradCdfParetoType2_ffv_885;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_886> AgradCdfParetoType2_ffv_886;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_887> AgradCdfParetoType2_ffv_887;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_888> AgradCdfParetoType2_ffv_888;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_889> AgradCdfParetoType2_ffv_889;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_890> AgradCdfParetoType2_ffv_890;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_891> AgradCdfParetoType2_ffv_891;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_892> AgradCdfParetoType2_ffv_892;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_893> AgradCdfParetoType2_ffv_893;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_894> AgradCdfParetoType2_ffv_894;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_895> AgradCdfParetoType2_ffv_895;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_896> AgradCdfParetoType2_ffv_896;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_897> AgradCdfParetoType2_ffv_897;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_898> AgradCdfParetoType2_ffv_898;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_899> AgradCdfParetoType2_ffv_899;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_800, AgradCdfTestFixture, AgradCdfParetoType2_ffv_800);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_801, AgradCdfTestFixture, AgradCdfParetoType2_ffv_801);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_802, AgradCdfTestFixture, AgradCdfParetoType2_ffv_802);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_803, AgradCdfTestFixture, AgradCdfParetoType2_ffv_803);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_804, AgradCdfTestFixture, AgradCdfParetoType2_ffv_804);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_805, AgradCdfTestFixture, AgradCdfParetoType2_ffv_805);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_806, AgradCdfTestFixture, AgradCdfParetoType2_ffv_806);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_807, AgradCdfTestFixture, AgradCdfParetoType2_ffv_807);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_808, AgradCdfTestFixture, AgradCdfParetoType2_ffv_808);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_809, AgradCdfTestFixture, AgradCdfParetoType2_ffv_809);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_810, AgradCdfTestFixture, AgradCdfParetoType2_ffv_810);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_811, AgradCdfTestFixture, AgradCdfParetoType2_ffv_811);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_812, AgradCdfTestFixture, AgradCdfParetoType2_ffv_812);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_813, AgradCdfTestFixture, AgradCdfParetoType2_ffv_813);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_814, AgradCdfTestFixture, AgradCdfParetoType2_ffv_814);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_815, AgradCdfTestFixture, AgradCdfParetoType2_ffv_815);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_816, AgradCdfTestFixture, AgradCdfParetoType2_ffv_816);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_817, AgradCdfTestFixture, AgradCdfParetoType2_ffv_817);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_818, AgradCdfTestFixture, AgradCdfParetoType2_ffv_818);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_819, AgradCdfTestFixture, AgradCdfParetoType2_ffv_819);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_820, AgradCdfTestFixture, AgradCdfParetoType2_ffv_820);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_821, AgradCdfTestFixture, AgradCdfParetoType2_ffv_821);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_822, AgradCdfTestFixture, AgradCdfParetoType2_ffv_822);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_823, AgradCdfTestFixture, AgradCdfParetoType2_ffv_823);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_824, AgradCdfTestFixture, AgradCdfParetoType2_ffv_824);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_825, AgradCdfTestFixture, AgradCdfParetoType2_ffv_825);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_826, AgradCdfTestFixture, AgradCdfParetoType2_ffv_826);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_827, AgradCdfTestFixture, AgradCdfParetoType2_ffv_827);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_828, AgradCdfTestFixture, AgradCdfParetoType2_ffv_828);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_829, AgradCdfTestFixture, AgradCdfParetoType2_ffv_829);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_830, AgradCdfTestFixture, AgradCdfParetoType2_ffv_830);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_831, AgradCdfTestFixture, AgradCdfParetoType2_ffv_831);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_832, AgradCdfTestFixture, AgradCdfParetoType2_ffv_832);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_833, AgradCdfTestFixture, AgradCdfParetoType2_ffv_833);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_834, AgradCdfTestFixture, AgradCdfParetoType2_ffv_834);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_835, AgradCdfTestFixture, AgradCdfParetoType2_ffv_835);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_836, AgradCdfTestFixture, AgradCdfParetoType2_ffv_836);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_837, AgradCdfTestFixture, AgradCdfParetoType2_ffv_837);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_838, AgradCdfTestFixture, AgradCdfParetoType2_ffv_838);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_839, AgradCdfTestFixture, AgradCdfParetoType2_ffv_839);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_840, AgradCdfTestFixture, AgradCdfParetoType2_ffv_840);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_841, AgradCdfTestFixture, AgradCdfParetoType2_ffv_841);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_842, AgradCdfTestFixture, AgradCdfParetoType2_ffv_842);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_843, AgradCdfTestFixture, AgradCdfParetoType2_ffv_843);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_844, AgradCdfTestFixture, AgradCdfParetoType2_ffv_844);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_845, AgradCdfTestFixture, AgradCdfParetoType2_ffv_845);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_846, AgradCdfTestFixture, AgradCdfParetoType2_ffv_846);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_847, AgradCdfTestFixture, AgradCdfParetoType2_ffv_847);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_848, AgradCdfTestFixture, AgradCdfParetoType2_ffv_848);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_849, AgradCdfTestFixture, AgradCdfParetoType2_ffv_849);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_850, AgradCdfTestFixture, AgradCdfParetoType2_ffv_850);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_851, AgradCdfTestFixture, AgradCdfParetoType2_ffv_851);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_852, AgradCdfTestFixture, AgradCdfParetoType2_ffv_852);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_853, AgradCdfTestFixture, AgradCdfParetoType2_ffv_853);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_854, AgradCdfTestFixture, AgradCdfParetoType2_ffv_854);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_855, AgradCdfTestFixture, AgradCdfParetoType2_ffv_855);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_856, AgradCdfTestFixture, AgradCdfParetoType2_ffv_856);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_857, AgradCdfTestFixture, AgradCdfParetoType2_ffv_857);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_858, AgradCdfTestFixture, AgradCdfParetoType2_ffv_858);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_859, AgradCdfTestFixture, AgradCdfParetoType2_ffv_859);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_860, AgradCdfTestFixture, AgradCdfParetoType2_ffv_860);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_861, AgradCdfTestFixture, AgradCdfParetoType2_ffv_861);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_862, AgradCdfTestFixture, AgradCdfParetoType2_ffv_862);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_863, AgradCdfTestFixture, AgradCdfParetoType2_ffv_863);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_864, AgradCdfTestFixture, AgradCdfParetoType2_ffv_864);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_865, AgradCdfTestFixture, AgradCdfParetoType2_ffv_865);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_866, AgradCdfTestFixture, AgradCdfParetoType2_ffv_866);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_867, AgradCdfTestFixture, AgradCdfParetoType2_ffv_867);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_868, AgradCdfTestFixture, AgradCdfParetoType2_ffv_868);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_869, AgradCdfTestFixture, AgradCdfParetoType2_ffv_869);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_870, AgradCdfTestFixture, AgradCdfParetoType2_ffv_870);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_871, AgradCdfTestFixture, AgradCdfParetoType2_ffv_871);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_872, AgradCdfTestFixture, AgradCdfParetoType2_ffv_872);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_873, AgradCdfTestFixture, AgradCdfParetoType2_ffv_873);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_874, AgradCdfTestFixture, AgradCdfParetoType2_ffv_874);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_875, AgradCdfTestFixture, AgradCdfParetoType2_ffv_875);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_876, AgradCdfTestFixture, AgradCdfParetoType2_ffv_876);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_877, AgradCdfTestFixture, AgradCdfParetoType2_ffv_877);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_878, AgradCdfTestFixture, AgradCdfParetoType2_ffv_878);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_879, AgradCdfTestFixture, AgradCdfParetoType2_ffv_879);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_880, AgradCdfTestFixture, AgradCdfParetoType2_ffv_880);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_881, AgradCdfTestFixture, AgradCdfParetoType2_ffv_881);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_882, AgradCdfTestFixture, AgradCdfParetoType2_ffv_882);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_883, AgradCdfTestFixture, AgradCdfParetoType2_ffv_883);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_884, AgradCdfTestFixture, AgradCdfParetoType2_ffv_884);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_885, AgradCdfTestFixture, AgradCdfParetoType2_ffv_885);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_886, AgradCdfTestFixture, AgradCdfParetoType2_ffv_886);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_887, AgradCdfTestFixture, AgradCdfParetoType2_ffv_887);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_888, AgradCdfTestFixture, AgradCdfParetoType2_ffv_888);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_889, AgradCdfTestFixture, AgradCdfParetoType2_ffv_889);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_890, AgradCdfTestFixture, AgradCdfParetoType2_ffv_890);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_891, AgradCdfTestFixture, AgradCdfParetoType2_ffv_891);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_892, AgradCdfTestFixture, AgradCdfParetoType2_ffv_892);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_893, AgradCdfTestFixture, AgradCdfParetoType2_ffv_893);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_894, AgradCdfTestFixture, AgradCdfParetoType2_ffv_894);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_895, AgradCdfTestFixture, AgradCdfParetoType2_ffv_895);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_896, AgradCdfTestFixture, AgradCdfParetoType2_ffv_896);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_897, AgradCdfTestFixture, AgradCdfParetoType2_ffv_897);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_898, AgradCdfTestFixture, AgradCdfParetoType2_ffv_898);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_899, AgradCdfTestFixture, AgradCdfParetoType2_ffv_899);
+
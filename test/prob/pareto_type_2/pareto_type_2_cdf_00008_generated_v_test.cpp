@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_cdf_test.hpp>
+
+typedef std::tuple<var, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_800;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, var, empty, empty> type_v_801;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_v_802;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_803;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_804;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_805;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_806;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_807;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_808;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_809;
+typedef std::tuple<var, std::vector<var>, var, double, empty, empty> type_v_810;
+typedef std::tuple<var, std::vector<var>, var, std::vector<double>, empty, empty> type_v_811;
+typedef std::tuple<var, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_812;
+typedef std::tuple<var, std::vector<var>, var, var, empty, empty> type_v_813;
+typedef std::tuple<var, std::vector<var>, var, std::vector<var>, empty, empty> type_v_814;
+typedef std::tuple<var, std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_815;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, double, empty, empty> type_v_816;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_v_817;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_818;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, var, empty, empty> type_v_819;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_v_820;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_821;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_822;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_823;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_824;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_825;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_826;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_827;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_828;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_829;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_830;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_831;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_832;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_833;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_834;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_835;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_836;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_837;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_838;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_839;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_840;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_841;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_842;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_843;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_844;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_845;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_846;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_847;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_848;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_849;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_850;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_851;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_852;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_853;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_854;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_855;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_856;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_857;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_858;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_859;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_860;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_861;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_862;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_863;
+typedef std::tuple<std::vector<var>, double, double, double, empty, empty> type_v_864;
+typedef std::tuple<std::vector<var>, double, double, std::vector<double>, empty, empty> type_v_865;
+typedef std::tuple<std::vector<var>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_866;
+typedef std::tuple<std::vector<var>, double, double, var, empty, empty> type_v_867;
+typedef std::tuple<std::vector<var>, double, double, std::vector<var>, empty, empty> type_v_868;
+typedef std::tuple<std::vector<var>, double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_869;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, double, empty, empty> type_v_870;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, std::vector<double>, empty, empty> type_v_871;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_872;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, var, empty, empty> type_v_873;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, std::vector<var>, empty, empty> type_v_874;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_875;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_876;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_877;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_878;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_879;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_880;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_881;
+typedef std::tuple<std::vector<var>, double, var, double, empty, empty> type_v_882;
+typedef std::tuple<std::vector<var>, double, var, std::vector<double>, empty, empty> type_v_883;
+typedef std::tuple<std::vector<var>, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_884;
+typedef std::tuple<std::vector<var>, double, var, var, empty, empty> type_v_885;
+typedef std::tuple<std::vector<var>, double, var, std::vector<var>, empty, empty> type_v_886;
+typedef std::tuple<std::vector<var>, double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_887;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, double, empty, empty> type_v_888;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, std::vector<double>, empty, empty> type_v_889;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_890;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, var, empty, empty> type_v_891;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, std::vector<var>, empty, empty> type_v_892;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_893;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_894;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_895;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_896;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_897;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_898;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_899;
+
+typedef std::tuple<AgradCdfParetoType2, type_v_800> AgradCdfParetoType2_v_800;
+typedef std::tuple<AgradCdfParetoType2, type_v_801> AgradCdfParetoType2_v_801;
+typedef std::tuple<AgradCdfParetoType2, type_v_802> AgradCdfParetoType2_v_802;
+typedef std::tuple<AgradCdfParetoType2, type_v_803> AgradCdfParetoType2_v_803;
+typedef std::tuple<AgradCdfParetoType2, type_v_804> AgradCdfParetoType2_v_804;
+typedef std::tuple<AgradCdfParetoType2, type_v_805> AgradCdfParetoType2_v_805;
+typedef std::tuple<AgradCdfParetoType2, type_v_806> AgradCdfParetoType2_v_806;
+typedef std::tuple<AgradCdfParetoType2, type_v_807> AgradCdfParetoType2_v_807;
+typedef std::tuple<AgradCdfParetoType2, type_v_808> AgradCdfParetoType2_v_808;
+typedef std::tuple<AgradCdfParetoType2, type_v_809> AgradCdfParetoType2_v_809;
+typedef std::tuple<AgradCdfParetoType2, type_v_810> AgradCdfParetoType2_v_810;
+typedef std::tuple<AgradCdfParetoType2, type_v_811> AgradCdfParetoType2_v_811;
+typedef std::tuple<AgradCdfParetoType2, type_v_812> AgradCdfParetoType2_v_812;
+typedef std::tuple<AgradCdfParetoType2, type_v_813> AgradCdfParetoType2_v_813;
+typedef std::tuple<AgradCdfParetoType2, type_v_814> AgradCdfParetoType2_v_814;
+typedef std::tuple<AgradCdfParetoType2, type_v_815> AgradCdfParetoType2_v_815;
+typedef std::tuple<AgradCdfParetoType2, type_v_816> AgradCdfParetoType2_v_816;
+typedef std::tuple<AgradCdfParetoType2, type_v_817> AgradCdfParetoType2_v_817;
+typedef std::tuple<AgradCdfParetoType2, type_v_818> AgradCdfParetoType2_v_818;
+typedef std::tuple<AgradCdfParetoType2, type_v_819> AgradCdfParetoType2_v_819;
+typedef std::tuple<AgradCdfParetoType2, type_v_820> AgradCdfParetoType2_v_820;
+typedef std::tuple<AgradCdfParetoType2, type_v_821> AgradCdfParetoType2_v_821;
+typedef std::tuple<AgradCdfParetoType2, type_v_822> AgradCdfParetoType2_v_822;
+typedef std::tuple<AgradCdfParetoType2, type_v_823> AgradCdfParetoType2_v_823;
+typedef std::tuple<AgradCdfParetoType2, type_v_824> AgradCdfParetoType2_v_824;
+typedef std::tuple<AgradCdfParetoType2, type_v_825> AgradCdfParetoType2_v_825;
+typedef std::tuple<AgradCdfParetoType2, type_v_826> AgradCdfParetoType2_v_826;
+typedef std::tuple<AgradCdfParetoType2, type_v_827> AgradCdfParetoType2_v_827;
+typedef std::tuple<AgradCdfParetoType2, type_v_828> AgradCdfParetoType2_v_828;
+typedef std::tuple<AgradCdfParetoType2, type_v_829> AgradCdfParetoType2_v_829;
+typedef std::tuple<AgradCdfParetoType2, type_v_830> AgradCdfParetoType2_v_830;
+typedef std::tuple<AgradCdfParetoType2, type_v_831> AgradCdfParetoType2_v_831;
+typedef std::tuple<AgradCdfParetoType2, type_v_832> AgradCdfParetoType2_v_832;
+typedef std::tuple<AgradCdfParetoType2, type_v_833> AgradCdfParetoType2_v_833;
+typedef std::tuple<AgradCdfParetoType2, type_v_834> AgradCdfParetoType2_v_834;
+typedef std::tuple<AgradCdfParetoType2, type_v_835> AgradCdfParetoType2_v_835;
+typedef std::tuple<AgradCdfParetoType2, type_v_836> AgradCdfParetoType2_v_836;
+typedef std::tuple<AgradCdfParetoType2, type_v_837> AgradCdfParetoType2_v_837;
+typedef std::tuple<AgradCdfParetoType2, type_v_838> AgradCdfParetoType2_v_838;
+typedef std::tuple<AgradCdfParetoType2, type_v_839> AgradCdfParetoType2_v_839;
+typedef std::tuple<AgradCdfParetoType2, type_v_840> AgradCdfParetoType2_v_840;
+typedef std::tuple<AgradCdfParetoType2, type_v_841> AgradCdfParetoType2_v_841;
+typedef std::tuple<AgradCdfParetoType2, type_v_842> AgradCdfParetoType2_v_842;
+typedef std::tuple<AgradCdfParetoType2, type_v_843> AgradCdfParetoType2_v_843;
+typedef std::tuple<AgradCdfParetoType2, type_v_844> AgradCdfParetoType2_v_844;
+typedef std::tuple<AgradCdfParetoType2, type_v_845> AgradCdfParetoType2_v_845;
+typedef std::tuple<AgradCdfParetoType2, type_v_846> AgradCdfParetoType2_v_846;
+typedef std::tuple<AgradCdfParetoType2, type_v_847> AgradCdfParetoType2_v_847;
+typedef std::tuple<AgradCdfParetoType2, type_v_848> AgradCdfParetoType2_v_848;
+typedef std::tuple<AgradCdfParetoType2, type_v_849> AgradCdfParetoType2_v_849;
+typedef std::tuple<AgradCdfParetoType2, type_v_850> AgradCdfParetoType2_v_850;
+typedef std::tuple<AgradCdfParetoType2, type_v_851> AgradCdfParetoType2_v_851;
+typedef std::tuple<AgradCdfParetoType2, type_v_852> AgradCdfParetoType2_v_852;
+typedef std::tuple<AgradCdfParetoType2, type_v_853> AgradCdfParetoType2_v_853;
+typedef std::tuple<AgradCdfParetoType2, type_v_854> AgradCdfParetoType2_v_854;
+typedef std::tuple<AgradCdfParetoType2, type_v_855> AgradCdfParetoType2_v_855;
+typedef std::tuple<AgradCdfParetoType2, type_v_856> AgradCdfParetoType2_v_856;
+typedef std::tuple<AgradCdfParetoType2, type_v_857> AgradCdfParetoType2_v_857;
+typedef std::tuple<AgradCdfParetoType2, type_v_858> AgradCdfParetoType2_v_858;
+typedef std::tuple<AgradCdfParetoType2, type_v_859> AgradCdfParetoType2_v_859;
+typedef std::tuple<AgradCdfParetoType2, type_v_860> AgradCdfParetoType2_v_860;
+typedef std::tuple<AgradCdfParetoType2, type_v_861> AgradCdfParetoType2_v_861;
+typedef std::tuple<AgradCdfParetoType2, type_v_862> AgradCdfParetoType2_v_862;
+typedef std::tuple<AgradCdfParetoType2, type_v_863> AgradCdfParetoType2_v_863;
+typedef std::tuple<AgradCdfParetoType2, type_v_864> AgradCdfParetoType2_v_864;
+typedef std::tuple<AgradCdfParetoType2, type_v_865> AgradCdfParetoType2_v_865;
+typedef std::tuple<AgradCdfParetoType2, type_v_866> AgradCdfParetoType2_v_866;
+typedef std::tuple<AgradCdfParetoType2, type_v_867> AgradCdfParetoType2_v_867;
+typedef std::tuple<AgradCdfParetoType2, type_v_868> AgradCdfParetoType2_v_868;
+typedef std::tuple<AgradCdfParetoType2, type_v_869> AgradCdfParetoType2_v_869;
+typedef std::tuple<AgradCdfParetoType2, type_v_870> AgradCdfParetoType2_v_870;
+typedef std::tuple<AgradCdfParetoType2, type_v_871> AgradCdfParetoType2_v_871;
+typedef std::tuple<AgradCdfParetoType2, type_v_872> AgradCdfParetoType2_v_872;
+typedef std::tuple<AgradCdfParetoType2, type_v_873> AgradCdfParetoType2_v_873;
+typedef std::tuple<AgradCdfParetoType2, type_v_874> AgradCdfParetoType2_v_874;
+typedef std::tuple<AgradCdfParetoType2, type_v_875> AgradCdfParetoType2_v_875;
+typedef std::tuple<AgradCdfParetoType2, type_v_876> AgradCdfParetoType2_v_876;
+typedef std::tuple<AgradCdfParetoType2, type_v_877> AgradCdfParetoType2_v_877;
+typedef std::tuple<AgradCdfParetoType2, type_v_878> AgradCdfParetoType2_v_878;
+typedef std::tuple<AgradCdfParetoType2, type_v_879> AgradCdfParetoType2_v_879;
+typedef std::tuple<AgradCdfParetoType2, type_v_880> AgradCdfParetoType2_v_880;
+typedef std::tuple<AgradCdfParetoType2, type_v_881> AgradCdfParetoType2_v_881;
+typedef std::tuple<AgradCdfParetoType2, type_v_882> AgradCdfParetoType2_v_882;
+typedef std::tuple<AgradCdfParetoType2, type_v_883> AgradCdfParetoType2_v_883;
+typedef std::tuple<AgradCdfParetoType2, type_v_884> AgradCdfParetoType2_v_884;
+typedef std::tuple<AgradCdfParetoType2, type_v_885> AgradCdfParetoType2_v_885;
+typedef std::tuple<AgradCdfParetoType2, type_v_886> AgradCdfParetoType2_v_886;
+typedef std::tuple<AgradCdfParetoType2, type_v_887> AgradCdfParetoType2_v_887;
+typedef std::tuple<AgradCdfParetoType2, type_v_888> AgradCdfParetoType2_v_888;
+typedef std::tuple<AgradCdfParetoType2, type_v_889> AgradCdfParetoType2_v_889;
+typedef std::tuple<AgradCdfParetoType2, type_v_890> AgradCdfParetoType2_v_890;
+typedef std::tuple<AgradCdfParetoType2, type_v_891> AgradCdfParetoType2_v_891;
+typedef std::tuple<AgradCdfParetoType2, type_v_892> AgradCdfParetoType2_v_892;
+typedef std::tuple<AgradCdfParetoType2, type_v_893> AgradCdfParetoType2_v_893;
+typedef std::tuple<AgradCdfParetoType2, type_v_894> AgradCdfParetoType2_v_894;
+typedef std::tuple<AgradCdfParetoType2, type_v_895> AgradCdfParetoType2_v_895;
+typedef std::tuple<AgradCdfParetoType2, type_v_896> AgradCdfParetoType2_v_896;
+typedef std::tuple<AgradCdfParetoType2, type_v_897> AgradCdfParetoType2_v_897;
+typedef std::tuple<AgradCdfParetoType2, type_v_898> AgradCdfParetoType2_v_898;
+typedef std::tuple<AgradCdfParetoType2, type_v_899> AgradCdfParetoType2_v_899;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_800, AgradCdfTestFixture, AgradCdfParetoType2_v_800);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_801, AgradCdfTestFixture, AgradCdfParetoType2_v_801);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_802, AgradCdfTestFixture, AgradCdfParetoType2_v_802);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_803, AgradCdfTestFixture, AgradCdfParetoType2_v_803);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_804, AgradCdfTestFixture, AgradCdfParetoType2_v_804);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_805, AgradCdfTestFixture, AgradCdfParetoType2_v_805);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_806, AgradCdfTestFixture, AgradCdfParetoType2_v_806);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_807, AgradCdfTestFixture, AgradCdfParetoType2_v_807);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_808, AgradCdfTestFixture, AgradCdfParetoType2_v_808);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_809, AgradCdfTestFixture, AgradCdfParetoType2_v_809);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_810, AgradCdfTestFixture, AgradCdfParetoType2_v_810);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_811, AgradCdfTestFixture, AgradCdfParetoType2_v_811);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_812, AgradCdfTestFixture, AgradCdfParetoType2_v_812);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_813, AgradCdfTestFixture, AgradCdfParetoType2_v_813);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_814, AgradCdfTestFixture, AgradCdfParetoType2_v_814);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_815, AgradCdfTestFixture, AgradCdfParetoType2_v_815);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_816, AgradCdfTestFixture, AgradCdfParetoType2_v_816);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_817, AgradCdfTestFixture, AgradCdfParetoType2_v_817);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_818, AgradCdfTestFixture, AgradCdfParetoType2_v_818);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_819, AgradCdfTestFixture, AgradCdfParetoType2_v_819);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_820, AgradCdfTestFixture, AgradCdfParetoType2_v_820);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_821, AgradCdfTestFixture, AgradCdfParetoType2_v_821);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_822, AgradCdfTestFixture, AgradCdfParetoType2_v_822);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_823, AgradCdfTestFixture, AgradCdfParetoType2_v_823);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_824, AgradCdfTestFixture, AgradCdfParetoType2_v_824);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_825, AgradCdfTestFixture, AgradCdfParetoType2_v_825);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_826, AgradCdfTestFixture, AgradCdfParetoType2_v_826);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_827, AgradCdfTestFixture, AgradCdfParetoType2_v_827);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_828, AgradCdfTestFixture, AgradCdfParetoType2_v_828);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_829, AgradCdfTestFixture, AgradCdfParetoType2_v_829);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_830, AgradCdfTestFixture, AgradCdfParetoType2_v_830);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_831, AgradCdfTestFixture, AgradCdfParetoType2_v_831);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_832, AgradCdfTestFixture, AgradCdfParetoType2_v_832);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_833, AgradCdfTestFixture, AgradCdfParetoType2_v_833);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_834, AgradCdfTestFixture, AgradCdfParetoType2_v_834);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_835, AgradCdfTestFixture, AgradCdfParetoType2_v_835);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_836, AgradCdfTestFixture, AgradCdfParetoType2_v_836);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_837, AgradCdfTestFixture, AgradCdfParetoType2_v_837);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_838, AgradCdfTestFixture, AgradCdfParetoType2_v_838);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_839, AgradCdfTestFixture, AgradCdfParetoType2_v_839);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_840, AgradCdfTestFixture, AgradCdfParetoType2_v_840);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_841, AgradCdfTestFixture, AgradCdfParetoType2_v_841);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_842, AgradCdfTestFixture, AgradCdfParetoType2_v_842);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_843, AgradCdfTestFixture, AgradCdfParetoType2_v_843);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_844, AgradCdfTestFixture, AgradCdfParetoType2_v_844);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_845, AgradCdfTestFixture, AgradCdfParetoType2_v_845);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_846, AgradCdfTestFixture, AgradCdfParetoType2_v_846);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_847, AgradCdfTestFixture, AgradCdfParetoType2_v_847);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_848, AgradCdfTestFixture, AgradCdfParetoType2_v_848);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_849, AgradCdfTestFixture, AgradCdfParetoType2_v_849);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_850, AgradCdfTestFixture, AgradCdfParetoType2_v_850);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_851, AgradCdfTestFixture, AgradCdfParetoType2_v_851);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_852, AgradCdfTestFixture, AgradCdfParetoType2_v_852);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_853, AgradCdfTestFixture, AgradCdfParetoType2_v_853);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_854, AgradCdfTestFixture, AgradCdfParetoType2_v_854);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_855, AgradCdfTestFixture, AgradCdfParetoType2_v_855);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_856, AgradCdfTestFixture, AgradCdfParetoType2_v_856);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_857, AgradCdfTestFixture, AgradCdfParetoType2_v_857);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_858, AgradCdfTestFixture, AgradCdfParetoType2_v_858);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_859, AgradCdfTestFixture, AgradCdfParetoType2_v_859);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_860, AgradCdfTestFixture, AgradCdfParetoType2_v_860);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_861, AgradCdfTestFixture, AgradCdfParetoType2_v_861);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_862, AgradCdfTestFixture, AgradCdfParetoType2_v_862);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_863, AgradCdfTestFixture, AgradCdfParetoType2_v_863);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_864, AgradCdfTestFixture, AgradCdfParetoType2_v_864);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_865, AgradCdfTestFixture, AgradCdfParetoType2_v_865);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_866, AgradCdfTestFixture, AgradCdfParetoType2_v_866);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_867, AgradCdfTestFixture, AgradCdfParetoType2_v_867);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_868, AgradCdfTestFixture, AgradCdfParetoType2_v_868);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_869, AgradCdfTestFixture, AgradCdfParetoType2_v_869);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_870, AgradCdfTestFixture, AgradCdfParetoType2_v_870);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_871, AgradCdfTestFixture, AgradCdfParetoType2_v_871);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_872, AgradCdfTestFixture, AgradCdfParetoType2_v_872);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_873, AgradCdfTestFixture, AgradCdfParetoType2_v_873);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_874, AgradCdfTestFixture, AgradCdfParetoType2_v_874);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_875, AgradCdfTestFixture, AgradCdfParetoType2_v_875);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_876, AgradCdfTestFixture, AgradCdfParetoType2_v_876);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_877, AgradCdfTestFixture, AgradCdfParetoType2_v_877);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_878, AgradCdfTestFixture, AgradCdfParetoType2_v_878);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_879, AgradCdfTestFixture, AgradCdfParetoType2_v_879);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_880, AgradCdfTestFixture, AgradCdfParetoType2_v_880);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_881, AgradCdfTestFixture, AgradCdfParetoType2_v_881);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_882, AgradCdfTestFixture, AgradCdfParetoType2_v_882);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_883, AgradCdfTestFixture, AgradCdfParetoType2_v_883);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_884, AgradCdfTestFixture, AgradCdfParetoType2_v_884);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_885, AgradCdfTestFixture, AgradCdfParetoType2_v_885);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_886, AgradCdfTestFixture, AgradCdfParetoType2_v_886);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_887, AgradCdfTestFixture, AgradCdfParetoType2_v_887);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_888, AgradCdfTestFixture, AgradCdfParetoType2_v_888);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_889, AgradCdfTestFixture, AgradCdfParetoType2_v_889);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_890, AgradCdfTestFixture, AgradCdfParetoType2_v_890);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_891, AgradCdfTestFixture, AgradCdfParetoType2_v_891);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_892, AgradCdfTestFixture, AgradCdfParetoType2_v_892);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_893, AgradCdfTestFixture, AgradCdfParetoType2_v_893);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_894, AgradCdfTestFixture, AgradCdfParetoType2_v_894);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_895, AgradCdfTestFixture, AgradCdfParetoType2_v_895);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_896, AgradCdfTestFixture, AgradCdfParetoType2_v_896);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_897, AgradCdfTestFixture, AgradCdfParetoType2_v_897);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_898, AgradCdfTestFixture, AgradCdfParetoType2_v_898);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_899, AgradCdfTestFixture, AgradCdfParetoType2_v_899);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_cdf_test.hpp>
+
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_800;
+typedef std::tuple<std::vector<var>, double, var, double, empty, empty> type_vv_801;
+typedef std::tuple<std::vector<var>, double, var, std::vector<double>, empty, empty> type_vv_802;
+typedef std::tuple<std::vector<var>, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_803;
+typedef std::tuple<std::vector<var>, double, var, var, empty, empty> type_vv_804;
+typedef std::tuple<std::vector<var>, double, var, std::vector<var>, empty, empty> type_vv_805;
+typedef std::tuple<std::vector<var>, double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_806;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, double, empty, empty> type_vv_807;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, std::vector<double>, empty, empty> type_vv_808;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_809;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, var, empty, empty> type_vv_810;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, std::vector<var>, empty, empty> type_vv_811;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_812;
+typedef std::tuple<std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_813;
+typedef std::tuple<std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_814;
+typedef std::tuple<std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_815;
+typedef std::tuple<std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_816;
+typedef std::tuple<std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_817;
+typedef std::tuple<std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_818;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, double, empty, empty> type_vv_819;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, std::vector<double>, empty, empty> type_vv_820;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_821;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, var, empty, empty> type_vv_822;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, std::vector<var>, empty, empty> type_vv_823;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_824;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, double, empty, empty> type_vv_825;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, std::vector<double>, empty, empty> type_vv_826;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_827;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, var, empty, empty> type_vv_828;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_vv_829;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_830;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_831;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_832;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_833;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_834;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_835;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_836;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, double, empty, empty> type_vv_837;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, std::vector<double>, empty, empty> type_vv_838;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_839;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, var, empty, empty> type_vv_840;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, std::vector<var>, empty, empty> type_vv_841;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_842;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, double, empty, empty> type_vv_843;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_vv_844;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_845;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, var, empty, empty> type_vv_846;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_vv_847;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_848;
+typedef std::tuple<std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_849;
+typedef std::tuple<std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_850;
+typedef std::tuple<std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_851;
+typedef std::tuple<std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_852;
+typedef std::tuple<std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_853;
+typedef std::tuple<std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_854;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty> type_vv_855;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_vv_856;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_857;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_vv_858;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_vv_859;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_860;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_vv_861;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_vv_862;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_863;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_vv_864;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_vv_865;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_866;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_867;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_868;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_869;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_870;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_871;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_872;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_vv_873;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_vv_874;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_875;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_vv_876;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_vv_877;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_878;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_vv_879;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_vv_880;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_881;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_vv_882;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_vv_883;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_884;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_885;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_886;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_887;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_888;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_889;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_890;
+typedef std::tuple<std::vector<var>, var, double, double, empty, empty> type_vv_891;
+typedef std::tuple<std::vector<var>, var, double, std::vector<double>, empty, empty> type_vv_892;
+typedef std::tuple<std::vector<var>, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_893;
+typedef std::tuple<std::vector<var>, var, double, var, empty, empty> type_vv_894;
+typedef std::tuple<std::vector<var>, var, double, std::vector<var>, empty, empty> type_vv_895;
+typedef std::tuple<std::vector<var>, var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_896;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, double, empty, empty> type_vv_897;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, std::vector<double>, empty, empty> type_vv_898;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_899;
+
+typedef std::tuple<AgradCdfParetoType2, type_vv_800> AgradCdfParetoType2_vv_800;
+typedef std::tuple<AgradCdfParetoType2, type_vv_801> AgradCdfParetoType2_vv_801;
+typedef std::tuple<AgradCdfParetoType2, type_vv_802> AgradCdfParetoType2_vv_802;
+typedef std::tuple<AgradCdfParetoType2, type_vv_803> AgradCdfParetoType2_vv_803;
+typedef std::tuple<AgradCdfParetoType2, type_vv_804> AgradCdfParetoType2_vv_804;
+typedef std::tuple<AgradCdfParetoType2, type_vv_805> AgradCdfParetoType2_vv_805;
+typedef std::tuple<AgradCdfParetoType2, type_vv_806> AgradCdfParetoType2_vv_806;
+typedef std::tuple<AgradCdfParetoType2, type_vv_807> AgradCdfParetoType2_vv_807;
+typedef std::tuple<AgradCdfParetoType2, type_vv_808> AgradCdfParetoType2_vv_808;
+typedef std::tuple<AgradCdfParetoType2, type_vv_809> AgradCdfParetoType2_vv_809;
+typedef std::tuple<AgradCdfParetoType2, type_vv_810> AgradCdfParetoType2_vv_810;
+typedef std::tuple<AgradCdfParetoType2, type_vv_811> AgradCdfParetoType2_vv_811;
+typedef std::tuple<AgradCdfParetoType2, type_vv_812> AgradCdfParetoType2_vv_812;
+typedef std::tuple<AgradCdfParetoType2, type_vv_813> AgradCdfParetoType2_vv_813;
+typedef std::tuple<AgradCdfParetoType2, type_vv_814> AgradCdfParetoType2_vv_814;
+typedef std::tuple<AgradCdfParetoType2, type_vv_815> AgradCdfParetoType2_vv_815;
+typedef std::tuple<AgradCdfParetoType2, type_vv_816> AgradCdfParetoType2_vv_816;
+typedef std::tuple<AgradCdfParetoType2, type_vv_817> AgradCdfParetoType2_vv_817;
+typedef std::tuple<AgradCdfParetoType2, type_vv_818> AgradCdfParetoType2_vv_818;
+typedef std::tuple<AgradCdfParetoType2, type_vv_819> AgradCdfParetoType2_vv_819;
+typedef std::tuple<AgradCdfParetoType2, type_vv_820> AgradCdfParetoType2_vv_820;
+typedef std::tuple<AgradCdfParetoType2, type_vv_821> AgradCdfParetoType2_vv_821;
+typedef std::tuple<AgradCdfParetoType2, type_vv_822> AgradCdfParetoType2_vv_822;
+typedef std::tuple<AgradCdfParetoType2, type_vv_823> AgradCdfParetoType2_vv_823;
+typedef std::tuple<AgradCdfParetoType2, type_vv_824> AgradCdfParetoType2_vv_824;
+typedef std::tuple<AgradCdfParetoType2, type_vv_825> AgradCdfParetoType2_vv_825;
+typedef std::tuple<AgradCdfParetoType2, type_vv_826> AgradCdfParetoType2_vv_826;
+typedef std::tuple<AgradCdfParetoType2, type_vv_827> AgradCdfParetoType2_vv_827;
+typedef std::tuple<AgradCdfParetoType2, type_vv_828> AgradCdfParetoType2_vv_828;
+typedef std::tuple<AgradCdfParetoType2, type_vv_829> AgradCdfParetoType2_vv_829;
+typedef std::tuple<AgradCdfParetoType2, type_vv_830> AgradCdfParetoType2_vv_830;
+typedef std::tuple<AgradCdfParetoType2, type_vv_831> AgradCdfParetoType2_vv_831;
+typedef std::tuple<AgradCdfParetoType2, type_vv_832> AgradCdfParetoType2_vv_832;
+typedef std::tuple<AgradCdfParetoType2, type_vv_833> AgradCdfParetoType2_vv_833;
+typedef std::tuple<AgradCdfParetoType2, type_vv_834> AgradCdfParetoType2_vv_834;
+typedef std::tuple<AgradCdfParetoType2, type_vv_835> AgradCdfParetoType2_vv_835;
+typedef std::tuple<AgradCdfParetoType2, type_vv_836> AgradCdfParetoType2_vv_836;
+typedef std::tuple<AgradCdfParetoType2, type_vv_837> AgradCdfParetoType2_vv_837;
+typedef std::tuple<AgradCdfParetoType2, type_vv_838> AgradCdfParetoType2_vv_838;
+typedef std::tuple<AgradCdfParetoType2, type_vv_839> AgradCdfParetoType2_vv_839;
+typedef std::tuple<AgradCdfParetoType2, type_vv_840> AgradCdfParetoType2_vv_840;
+typedef std::tuple<AgradCdfParetoType2, type_vv_841> AgradCdfParetoType2_vv_841;
+typedef std::tuple<AgradCdfParetoType2, type_vv_842> AgradCdfParetoType2_vv_842;
+typedef std::tuple<AgradCdfParetoType2, type_vv_843> AgradCdfParetoType2_vv_843;
+typedef std::tuple<AgradCdfParetoType2, type_vv_844> AgradCdfParetoType2_vv_844;
+typedef std::tuple<AgradCdfParetoType2, type_vv_845> AgradCdfParetoType2_vv_845;
+typedef std::tuple<AgradCdfParetoType2, type_vv_846> AgradCdfParetoType2_vv_846;
+typedef std::tuple<AgradCdfParetoType2, type_vv_847> AgradCdfParetoType2_vv_847;
+typedef std::tuple<AgradCdfParetoType2, type_vv_848> AgradCdfParetoType2_vv_848;
+typedef std::tuple<AgradCdfParetoType2, type_vv_849> AgradCdfParetoType2_vv_849;
+typedef std::tuple<AgradCdfParetoType2, type_vv_850> AgradCdfParetoType2_vv_850;
+typedef std::tuple<AgradCdfParetoType2, type_vv_851> AgradCdfParetoType2_vv_851;
+typedef std::tuple<AgradCdfParetoType2, type_vv_852> AgradCdfParetoType2_vv_852;
+typedef std::tuple<AgradCdfParetoType2, type_vv_853> AgradCdfParetoType2_vv_853;
+typedef std::tuple<AgradCdfParetoType2, type_vv_854> AgradCdfParetoType2_vv_854;
+typedef std::tuple<AgradCdfParetoType2, type_vv_855> AgradCdfParetoType2_vv_855;
+typedef std::tuple<AgradCdfParetoType2, type_vv_856> AgradCdfParetoType2_vv_856;
+typedef std::tuple<AgradCdfParetoType2, type_vv_857> AgradCdfParetoType2_vv_857;
+typedef std::tuple<AgradCdfParetoType2, type_vv_858> AgradCdfParetoType2_vv_858;
+typedef std::tuple<AgradCdfParetoType2, type_vv_859> AgradCdfParetoType2_vv_859;
+typedef std::tuple<AgradCdfParetoType2, type_vv_860> AgradCdfParetoType2_vv_860;
+typedef std::tuple<AgradCdfParetoType2, type_vv_861> AgradCdfParetoType2_vv_861;
+typedef std::tuple<AgradCdfParetoType2, type_vv_862> AgradCdfParetoType2_vv_862;
+typedef std::tuple<AgradCdfParetoType2, type_vv_863> AgradCdfParetoType2_vv_863;
+typedef std::tuple<AgradCdfParetoType2, type_vv_864> AgradCdfParetoType2_vv_864;
+typedef std::tuple<AgradCdfParetoType2, type_vv_865> AgradCdfParetoType2_vv_865;
+typedef std::tuple<AgradCdfParetoType2, type_vv_866> AgradCdfParetoType2_vv_866;
+typedef std::tuple<AgradCdfParetoType2, type_vv_867> AgradCdfParetoType2_vv_867;
+typedef std::tuple<AgradCdfParetoType2, type_vv_868> AgradCdfParetoType2_vv_868;
+typedef std::tuple<AgradCdfParetoType2, type_vv_869> AgradCdfParetoType2_vv_869;
+typedef std::tuple<AgradCdfParetoType2, type_vv_870> AgradCdfParetoType2_vv_870;
+typedef std::tuple<AgradCdfParetoType2, type_vv_871> AgradCdfParetoType2_vv_871;
+typedef std::tuple<AgradCdfParetoType2, type_vv_872> AgradCdfParetoType2_vv_872;
+typedef std::tuple<AgradCdfParetoType2, type_vv_873> AgradCdfParetoType2_vv_873;
+typedef std::tuple<AgradCdfParetoType2, type_vv_874> AgradCdfParetoType2_vv_874;
+typedef std::tuple<AgradCdfParetoType2, type_vv_875> AgradCdfParetoType2_vv_875;
+typedef std::tuple<AgradCdfParetoType2, type_vv_876> AgradCdfParetoType2_vv_876;
+typedef std::tuple<AgradCdfParetoType2, type_vv_877> AgradCdfParetoType2_vv_877;
+typedef std::tuple<AgradCdfParetoType2, type_vv_878> AgradCdfParetoType2_vv_878;
+typedef std::tuple<AgradCdfParetoType2, type_vv_879> AgradCdfParetoType2_vv_879;
+typedef std::tuple<AgradCdfParetoType2, type_vv_880> AgradCdfParetoType2_vv_880;
+typedef std::tuple<AgradCdfParetoType2, type_vv_881> AgradCdfParetoType2_vv_881;
+typedef std::tuple<AgradCdfParetoType2, type_vv_882> AgradCdfParetoType2_vv_882;
+typedef std::tuple<AgradCdfParetoType2, type_vv_883> AgradCdfParetoType2_vv_883;
+typedef std::tuple<AgradCdfParetoType2, type_vv_884> AgradCdfParetoType2_vv_884;
+typedef std::tuple<AgradCdfParetoType2, type_vv_885> AgradCdfParetoType2_vv_885;
+typedef std::tuple<AgradCdfParetoType2, type_vv_886> AgradCdfParetoType2_vv_886;
+typedef std::tuple<AgradCdfParetoType2, type_vv_887> AgradCdfParetoType2_vv_887;
+typedef std::tuple<AgradCdfParetoType2, type_vv_888> AgradCdfParetoType2_vv_888;
+typedef std::tuple<AgradCdfParetoType2, type_vv_889> AgradCdfParetoType2_vv_889;
+typedef std::tuple<AgradCdfParetoType2, type_vv_890> AgradCdfParetoType2_vv_890;
+typedef std::tuple<AgradCdfParetoType2, type_vv_891> AgradCdfParetoType2_vv_891;
+typedef std::tuple<AgradCdfParetoType2, type_vv_892> AgradCdfParetoType2_vv_892;
+typedef std::tuple<AgradCdfParetoType2, type_vv_893> AgradCdfParetoType2_vv_893;
+typedef std::tuple<AgradCdfParetoType2, type_vv_894> AgradCdfParetoType2_vv_894;
+typedef std::tuple<AgradCdfParetoType2, type_vv_895> AgradCdfParetoType2_vv_895;
+typedef std::tuple<AgradCdfParetoType2, type_vv_896> AgradCdfParetoType2_vv_896;
+typedef std::tuple<AgradCdfParetoType2, type_vv_897> AgradCdfParetoType2_vv_897;
+typedef std::tuple<AgradCdfParetoType2, type_vv_898> AgradCdfParetoType2_vv_898;
+typedef std::tuple<AgradCdfParetoType2, type_vv_899> AgradCdfParetoType2_vv_899;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_800, AgradCdfTestFixture, AgradCdfParetoType2_vv_800);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_801, AgradCdfTestFixture, AgradCdfParetoType2_vv_801);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_802, AgradCdfTestFixture, AgradCdfParetoType2_vv_802);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_803, AgradCdfTestFixture, AgradCdfParetoType2_vv_803);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_804, AgradCdfTestFixture, AgradCdfParetoType2_vv_804);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_805, AgradCdfTestFixture, AgradCdfParetoType2_vv_805);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_806, AgradCdfTestFixture, AgradCdfParetoType2_vv_806);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_807, AgradCdfTestFixture, AgradCdfParetoType2_vv_807);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_808, AgradCdfTestFixture, AgradCdfParetoType2_vv_808);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_809, AgradCdfTestFixture, AgradCdfParetoType2_vv_809);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_810, AgradCdfTestFixture, AgradCdfParetoType2_vv_810);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_811, AgradCdfTestFixture, AgradCdfParetoType2_vv_811);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_812, AgradCdfTestFixture, AgradCdfParetoType2_vv_812);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_813, AgradCdfTestFixture, AgradCdfParetoType2_vv_813);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_814, AgradCdfTestFixture, AgradCdfParetoType2_vv_814);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_815, AgradCdfTestFixture, AgradCdfParetoType2_vv_815);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_816, AgradCdfTestFixture, AgradCdfParetoType2_vv_816);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_817, AgradCdfTestFixture, AgradCdfParetoType2_vv_817);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_818, AgradCdfTestFixture, AgradCdfParetoType2_vv_818);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_819, AgradCdfTestFixture, AgradCdfParetoType2_vv_819);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_820, AgradCdfTestFixture, AgradCdfParetoType2_vv_820);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_821, AgradCdfTestFixture, AgradCdfParetoType2_vv_821);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_822, AgradCdfTestFixture, AgradCdfParetoType2_vv_822);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_823, AgradCdfTestFixture, AgradCdfParetoType2_vv_823);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_824, AgradCdfTestFixture, AgradCdfParetoType2_vv_824);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_825, AgradCdfTestFixture, AgradCdfParetoType2_vv_825);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_826, AgradCdfTestFixture, AgradCdfParetoType2_vv_826);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_827, AgradCdfTestFixture, AgradCdfParetoType2_vv_827);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_828, AgradCdfTestFixture, AgradCdfParetoType2_vv_828);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_829, AgradCdfTestFixture, AgradCdfParetoType2_vv_829);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_830, AgradCdfTestFixture, AgradCdfParetoType2_vv_830);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_831, AgradCdfTestFixture, AgradCdfParetoType2_vv_831);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_832, AgradCdfTestFixture, AgradCdfParetoType2_vv_832);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_833, AgradCdfTestFixture, AgradCdfParetoType2_vv_833);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_834, AgradCdfTestFixture, AgradCdfParetoType2_vv_834);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_835, AgradCdfTestFixture, AgradCdfParetoType2_vv_835);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_836, AgradCdfTestFixture, AgradCdfParetoType2_vv_836);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_837, AgradCdfTestFixture, AgradCdfParetoType2_vv_837);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_838, AgradCdfTestFixture, AgradCdfParetoType2_vv_838);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_839, AgradCdfTestFixture, AgradCdfParetoType2_vv_839);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_840, AgradCdfTestFixture, AgradCdfParetoType2_vv_840);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_841, AgradCdfTestFixture, AgradCdfParetoType2_vv_841);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_842, AgradCdfTestFixture, AgradCdfParetoType2_vv_842);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_843, AgradCdfTestFixture, AgradCdfParetoType2_vv_843);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_844, AgradCdfTestFixture, AgradCdfParetoType2_vv_844);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_845, AgradCdfTestFixture, AgradCdfParetoType2_vv_845);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_846, AgradCdfTestFixture, AgradCdfParetoType2_vv_846);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_847, AgradCdfTestFixture, AgradCdfParetoType2_vv_847);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_848, AgradCdfTestFixture, AgradCdfParetoType2_vv_848);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_849, AgradCdfTestFixture, AgradCdfParetoType2_vv_849);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_850, AgradCdfTestFixture, AgradCdfParetoType2_vv_850);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_851, AgradCdfTestFixture, AgradCdfParetoType2_vv_851);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_852, AgradCdfTestFixture, AgradCdfParetoType2_vv_852);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_853, AgradCdfTestFixture, AgradCdfParetoType2_vv_853);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_854, AgradCdfTestFixture, AgradCdfParetoType2_vv_854);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_855, AgradCdfTestFixture, AgradCdfParetoType2_vv_855);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_856, AgradCdfTestFixture, AgradCdfParetoType2_vv_856);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_857, AgradCdfTestFixture, AgradCdfParetoType2_vv_857);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_858, AgradCdfTestFixture, AgradCdfParetoType2_vv_858);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_859, AgradCdfTestFixture, AgradCdfParetoType2_vv_859);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_860, AgradCdfTestFixture, AgradCdfParetoType2_vv_860);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_861, AgradCdfTestFixture, AgradCdfParetoType2_vv_861);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_862, AgradCdfTestFixture, AgradCdfParetoType2_vv_862);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_863, AgradCdfTestFixture, AgradCdfParetoType2_vv_863);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_864, AgradCdfTestFixture, AgradCdfParetoType2_vv_864);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_865, AgradCdfTestFixture, AgradCdfParetoType2_vv_865);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_866, AgradCdfTestFixture, AgradCdfParetoType2_vv_866);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_867, AgradCdfTestFixture, AgradCdfParetoType2_vv_867);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_868, AgradCdfTestFixture, AgradCdfParetoType2_vv_868);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_869, AgradCdfTestFixture, AgradCdfParetoType2_vv_869);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_870, AgradCdfTestFixture, AgradCdfParetoType2_vv_870);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_871, AgradCdfTestFixture, AgradCdfParetoType2_vv_871);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_872, AgradCdfTestFixture, AgradCdfParetoType2_vv_872);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_873, AgradCdfTestFixture, AgradCdfParetoType2_vv_873);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_874, AgradCdfTestFixture, AgradCdfParetoType2_vv_874);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_875, AgradCdfTestFixture, AgradCdfParetoType2_vv_875);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_876, AgradCdfTestFixture, AgradCdfParetoType2_vv_876);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_877, AgradCdfTestFixture, AgradCdfParetoType2_vv_877);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_878, AgradCdfTestFixture, AgradCdfParetoType2_vv_878);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_879, AgradCdfTestFixture, AgradCdfParetoType2_vv_879);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_880, AgradCdfTestFixture, AgradCdfParetoType2_vv_880);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_881, AgradCdfTestFixture, AgradCdfParetoType2_vv_881);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_882, AgradCdfTestFixture, AgradCdfParetoType2_vv_882);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_883, AgradCdfTestFixture, AgradCdfParetoType2_vv_883);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_884, AgradCdfTestFixture, AgradCdfParetoType2_vv_884);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_885, AgradCdfTestFixture, AgradCdfParetoType2_vv_885);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_886, AgradCdfTestFixture, AgradCdfParetoType2_vv_886);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_887, AgradCdfTestFixture, AgradCdfParetoType2_vv_887);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_888, AgradCdfTestFixture, AgradCdfParetoType2_vv_888);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_889, AgradCdfTestFixture, AgradCdfParetoType2_vv_889);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_890, AgradCdfTestFixture, AgradCdfParetoType2_vv_890);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_891, AgradCdfTestFixture, AgradCdfParetoType2_vv_891);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_892, AgradCdfTestFixture, AgradCdfParetoType2_vv_892);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_893, AgradCdfTestFixture, AgradCdfParetoType2_vv_893);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_894, AgradCdfTestFixture, AgradCdfParetoType2_vv_894);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_895, AgradCdfTestFixture, AgradCdfParetoType2_vv_895);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_896, AgradCdfTestFixture, AgradCdfParetoType2_vv_896);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_897, AgradCdfTestFixture, AgradCdfParetoType2_vv_897);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_898, AgradCdfTestFixture, AgradCdfParetoType2_vv_898);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_899, AgradCdfTestFixture, AgradCdfParetoType2_vv_899);
+
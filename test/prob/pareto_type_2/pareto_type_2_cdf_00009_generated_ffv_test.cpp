@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_cdf_test.hpp>
+
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_900;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_901;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_902;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_903;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_904;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_905;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_906;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_907;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_908;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, double, empty, empty> type_ffv_909;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_910;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_911;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_912;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_913;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_914;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_915;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_916;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_917;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_918;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_919;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_920;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_921;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_922;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_923;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_924;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_925;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_926;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, double, empty, empty> type_ffv_927;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty, empty> type_ffv_928;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_929;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty, empty> type_ffv_930;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_931;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_932;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty, empty> type_ffv_933;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_934;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_935;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_936;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_937;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_938;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_939;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_940;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_941;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_942;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_943;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_944;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty, empty> type_ffv_945;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_946;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_947;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_948;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_949;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_950;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_951;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_952;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_953;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_954;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_955;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_956;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_957;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_958;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_959;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_960;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_961;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_962;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty, empty> type_ffv_963;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_ffv_964;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_965;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_966;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_967;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_968;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_ffv_969;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_970;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_971;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_972;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_973;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_974;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_975;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_976;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_977;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_978;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_979;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_980;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_981;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_982;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_983;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_984;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_985;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_986;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_987;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_988;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_989;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_990;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_991;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_992;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_993;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_994;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_995;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_996;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_997;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_998;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, double, empty, empty> type_ffv_999;
+
+typedef std::tuple<AgradCdfParetoType2, type_ffv_900> AgradCdfParetoType2_ffv_900;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_901> AgradCdfParetoType2_ffv_901;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_902> AgradCdfParetoType2_ffv_902;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_903> AgradCdfParetoType2_ffv_903;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_904> AgradCdfParetoType2_ffv_904;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_905> AgradCdfParetoType2_ffv_905;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_906> AgradCdfParetoType2_ffv_906;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_907> AgradCdfParetoType2_ffv_907;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_908> AgradCdfParetoType2_ffv_908;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_909> AgradCdfParetoType2_ffv_909;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_910> AgradCdfParetoType2_ffv_910;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_911> AgradCdfParetoType2_ffv_911;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_912> AgradCdfParetoType2_ffv_912;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_913> AgradCdfParetoType2_ffv_913;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_914> AgradCdfParetoType2_ffv_914;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_915> AgradCdfParetoType2_ffv_915;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_916> AgradCdfParetoType2_ffv_916;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_917> AgradCdfParetoType2_ffv_917;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_918> AgradCdfParetoType2_ffv_918;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_919> AgradCdfParetoType2_ffv_919;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_920> AgradCdfParetoType2_ffv_920;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_921> AgradCdfParetoType2_ffv_921;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_922> AgradCdfParetoType2_ffv_922;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_923> AgradCdfParetoType2_ffv_923;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_924> AgradCdfParetoType2_ffv_924;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_925> AgradCdfParetoType2_ffv_925;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_926> AgradCdfParetoType2_ffv_926;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_927> AgradCdfParetoType2_ffv_927;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_928> AgradCdfParetoType2_ffv_928;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_929> AgradCdfParetoType2_ffv_929;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_930> AgradCdfParetoType2_ffv_930;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_931> AgradCdfParetoType2_ffv_931;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_932> AgradCdfParetoType2_ffv_932;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_933> AgradCdfParetoType2_ffv_933;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_934> AgradCdfParetoType2_ffv_934;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_935> AgradCdfParetoType2_ffv_935;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_936> AgradCdfParetoType2_ffv_936;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_937> AgradCdfParetoType2_ffv_937;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_938> AgradCdfParetoType2_ffv_938;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_939> AgradCdfParetoType2_ffv_939;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_940> AgradCdfParetoType2_ffv_940;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_941> AgradCdfParetoType2_ffv_941;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_942> AgradCdfParetoType2_ffv_942;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_943> AgradCdfParetoType2_ffv_943;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_944> AgradCdfParetoType2_ffv_944;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_945> AgradCdfParetoType2_ffv_945;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_946> AgradCdfParetoType2_ffv_946;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_947> AgradCdfParetoType2_ffv_947;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_948> AgradCdfParetoType2_ffv_948;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_949> AgradCdfParetoType2_ffv_949;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_950> AgradCdfParetoType2_ffv_950;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_951> AgradCdfParetoType2_ffv_951;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_952> AgradCdfParetoType2_ffv_952;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_953> AgradCdfParetoType2_ffv_953;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_954> AgradCdfParetoType2_ffv_954;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_955> AgradCdfParetoType2_ffv_955;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_956> AgradCdfParetoType2_ffv_956;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_957> AgradCdfParetoType2_ffv_957;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_958> AgradCdfParetoType2_ffv_958;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_959> AgradCdfParetoType2_ffv_959;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_960> AgradCdfParetoType2_ffv_960;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_961> AgradCdfParetoType2_ffv_961;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_962> AgradCdfParetoType2_ffv_962;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_963> AgradCdfParetoType2_ffv_963;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_964> AgradCdfParetoType2_ffv_964;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_965> AgradCdfParetoType2_ffv_965;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_966> AgradCdfParetoType2_ffv_966;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_967> AgradCdfParetoType2_ffv_967;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_968> AgradCdfParetoType2_ffv_968;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_969> AgradCdfParetoType2_ffv_969;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_970> AgradCdfParetoType2_ffv_970;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_971> AgradCdfParetoType2_ffv_971;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_972> AgradCdfParetoType2_ffv_972;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_973> AgradCdfParetoType2_ffv_973;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_974> AgradCdfParetoType2_ffv_974;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_975> AgradCdfParetoType2_ffv_975;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_976> AgradCdfParetoType2_ffv_976;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_977> AgradCdfParetoType2_ffv_977;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_978> AgradCdfParetoType2_ffv_978;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_979> AgradCdfParetoType2_ffv_979;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_980> AgradCdfParetoType2_ffv_980;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_981> AgradCdfParetoType2_ffv_981;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_982> AgradCdfParetoType2_ffv_982;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_983> AgradCdfParetoType2_ffv_983;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_984> AgradCdfParetoType2_ffv_984;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_985> AgradCdfParetoType2_ffv_985;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_986> AgradCdfParetoType2_ffv_986;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_987> AgradCdfParetoType2_ffv_987;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_988> AgradCdfParetoType2_ffv_988;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_989> AgradCdfParetoType2_ffv_989;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_990> AgradCdfParetoType2_ffv_990;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_991> AgradCdfParetoType2_ffv_991;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_992> AgradCdfParetoType2_ffv_992;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_993> AgradCdfParetoType2_ffv_993;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_994> AgradCdfParetoType2_ffv_994;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_995> AgradCdfParetoType2_ffv_995;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_996> AgradCdfParetoType2_ffv_996;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_997> AgradCdfParetoType2_ffv_997;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_998> AgradCdfParetoType2_ffv_998;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_999> AgradCdfParetoType2_ffv_999;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_900, AgradCdfTestFixture, AgradCdfParetoType2_ffv_900);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_901, AgradCdfTestFixture, AgradCdfParetoType2_ffv_901);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_902, AgradCdfTestFixture, AgradCdfParetoType2_ffv_902);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_903, AgradCdfTestFixture, AgradCdfParetoType2_ffv_903);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_904, AgradCdfTestFixture, AgradCdfParetoType2_ffv_904);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_905, AgradCdfTestFixture, AgradCdfParetoType2_ffv_905);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_906, AgradCdfTestFixture, AgradCdfParetoType2_ffv_906);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_907, AgradCdfTestFixture, AgradCdfParetoType2_ffv_907);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_908, AgradCdfTestFixture, AgradCdfParetoType2_ffv_908);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_909, AgradCdfTestFixture, AgradCdfParetoType2_ffv_909);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_910, AgradCdfTestFixture, AgradCdfParetoType2_ffv_910);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_911, AgradCdfTestFixture, AgradCdfParetoType2_ffv_911);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_912, AgradCdfTestFixture, AgradCdfParetoType2_ffv_912);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_913, AgradCdfTestFixture, AgradCdfParetoType2_ffv_913);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_914, AgradCdfTestFixture, AgradCdfParetoType2_ffv_914);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_915, AgradCdfTestFixture, AgradCdfParetoType2_ffv_915);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_916, AgradCdfTestFixture, AgradCdfParetoType2_ffv_916);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_917, AgradCdfTestFixture, AgradCdfParetoType2_ffv_917);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_918, AgradCdfTestFixture, AgradCdfParetoType2_ffv_918);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_919, AgradCdfTestFixture, AgradCdfParetoType2_ffv_919);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_920, AgradCdfTestFixture, AgradCdfParetoType2_ffv_920);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_921, AgradCdfTestFixture, AgradCdfParetoType2_ffv_921);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_922, AgradCdfTestFixture, AgradCdfParetoType2_ffv_922);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_923, AgradCdfTestFixture, AgradCdfParetoType2_ffv_923);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_924, AgradCdfTestFixture, AgradCdfParetoType2_ffv_924);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_925, AgradCdfTestFixture, AgradCdfParetoType2_ffv_925);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_926, AgradCdfTestFixture, AgradCdfParetoType2_ffv_926);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_927, AgradCdfTestFixture, AgradCdfParetoType2_ffv_927);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_928, AgradCdfTestFixture, AgradCdfParetoType2_ffv_928);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_929, AgradCdfTestFixture, AgradCdfParetoType2_ffv_929);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_930, AgradCdfTestFixture, AgradCdfParetoType2_ffv_930);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_931, AgradCdfTestFixture, AgradCdfParetoType2_ffv_931);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_932, AgradCdfTestFixture, AgradCdfParetoType2_ffv_932);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_933, AgradCdfTestFixture, AgradCdfParetoType2_ffv_933);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_934, AgradCdfTestFixture, AgradCdfParetoType2_ffv_934);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_935, AgradCdfTestFixture, AgradCdfParetoType2_ffv_935);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_936, AgradCdfTestFixture, AgradCdfParetoType2_ffv_936);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_937, AgradCdfTestFixture, AgradCdfParetoType2_ffv_937);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_938, AgradCdfTestFixture, AgradCdfParetoType2_ffv_938);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_939, AgradCdfTestFixture, AgradCdfParetoType2_ffv_939);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_940, AgradCdfTestFixture, AgradCdfParetoType2_ffv_940);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_941, AgradCdfTestFixture, AgradCdfParetoType2_ffv_941);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_942, AgradCdfTestFixture, AgradCdfParetoType2_ffv_942);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_943, AgradCdfTestFixture, AgradCdfParetoType2_ffv_943);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_944, AgradCdfTestFixture, AgradCdfParetoType2_ffv_944);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_945, AgradCdfTestFixture, AgradCdfParetoType2_ffv_945);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_946, AgradCdfTestFixture, AgradCdfParetoType2_ffv_946);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_947, AgradCdfTestFixture, AgradCdfParetoType2_ffv_947);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_948, AgradCdfTestFixture, AgradCdfParetoType2_ffv_948);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_949, AgradCdfTestFixture, AgradCdfParetoType2_ffv_949);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_950, AgradCdfTestFixture, AgradCdfParetoType2_ffv_950);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_951, AgradCdfTestFixture, AgradCdfParetoType2_ffv_951);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_952, AgradCdfTestFixture, AgradCdfParetoType2_ffv_952);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_953, AgradCdfTestFixture, AgradCdfParetoType2_ffv_953);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_954, AgradCdfTestFixture, AgradCdfParetoType2_ffv_954);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_955, AgradCdfTestFixture, AgradCdfParetoType2_ffv_955);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_956, AgradCdfTestFixture, AgradCdfParetoType2_ffv_956);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_957, AgradCdfTestFixture, AgradCdfParetoType2_ffv_957);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_958, AgradCdfTestFixture, AgradCdfParetoType2_ffv_958);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_959, AgradCdfTestFixture, AgradCdfParetoType2_ffv_959);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_960, AgradCdfTestFixture, AgradCdfParetoType2_ffv_960);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_961, AgradCdfTestFixture, AgradCdfParetoType2_ffv_961);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_962, AgradCdfTestFixture, AgradCdfParetoType2_ffv_962);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_963, AgradCdfTestFixture, AgradCdfParetoType2_ffv_963);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_964, AgradCdfTestFixture, AgradCdfParetoType2_ffv_964);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_965, AgradCdfTestFixture, AgradCdfParetoType2_ffv_965);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_966, AgradCdfTestFixture, AgradCdfParetoType2_ffv_966);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_967, AgradCdfTestFixture, AgradCdfParetoType2_ffv_967);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_968, AgradCdfTestFixture, AgradCdfParetoType2_ffv_968);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_969, AgradCdfTestFixture, AgradCdfParetoType2_ffv_969);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_970, AgradCdfTestFixture, AgradCdfParetoType2_ffv_970);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_971, AgradCdfTestFixture, AgradCdfParetoType2_ffv_971);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_972, AgradCdfTestFixture, AgradCdfParetoType2_ffv_972);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_973, AgradCdfTestFixture, AgradCdfParetoType2_ffv_973);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_974, AgradCdfTestFixture, AgradCdfParetoType2_ffv_974);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_975, AgradCdfTestFixture, AgradCdfParetoType2_ffv_975);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_976, AgradCdfTestFixture, AgradCdfParetoType2_ffv_976);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_977, AgradCdfTestFixture, AgradCdfParetoType2_ffv_977);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_978, AgradCdfTestFixture, AgradCdfParetoType2_ffv_978);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_979, AgradCdfTestFixture, AgradCdfParetoType2_ffv_979);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_980, AgradCdfTestFixture, AgradCdfParetoType2_ffv_980);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_981, AgradCdfTestFixture, AgradCdfParetoType2_ffv_981);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_982, AgradCdfTestFixture, AgradCdfParetoType2_ffv_982);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_983, AgradCdfTestFixture, AgradCdfParetoType2_ffv_983);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_984, AgradCdfTestFixture, AgradCdfParetoType2_ffv_984);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_985, AgradCdfTestFixture, AgradCdfParetoType2_ffv_985);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_986, AgradCdfTestFixture, AgradCdfParetoType2_ffv_986);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_987, AgradCdfTestFixture, AgradCdfParetoType2_ffv_987);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_988, AgradCdfTestFixture, AgradCdfParetoType2_ffv_988);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_989, AgradCdfTestFixture, AgradCdfParetoType2_ffv_989);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_990, AgradCdfTestFixture, AgradCdfParetoType2_ffv_990);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_991, AgradCdfTestFixture, AgradCdfParetoType2_ffv_991);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_992, AgradCdfTestFixture, AgradCdfParetoType2_ffv_992);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_993, AgradCdfTestFixture, AgradCdfParetoType2_ffv_993);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_994, AgradCdfTestFixture, AgradCdfParetoType2_ffv_994);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_995, AgradCdfTestFixture, AgradCdfParetoType2_ffv_995);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_996, AgradCdfTestFixture, AgradCdfParetoType2_ffv_996);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_997, AgradCdfTestFixture, AgradCdfParetoType2_ffv_997);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_998, AgradCdfTestFixture, AgradCdfParetoType2_ffv_998);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_999, AgradCdfTestFixture, AgradCdfParetoType2_ffv_999);
+
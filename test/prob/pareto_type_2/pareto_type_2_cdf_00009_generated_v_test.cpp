@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_cdf_test.hpp>
+
+typedef std::tuple<std::vector<var>, std::vector<double>, double, double, empty, empty> type_v_900;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, std::vector<double>, empty, empty> type_v_901;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_902;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, var, empty, empty> type_v_903;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, std::vector<var>, empty, empty> type_v_904;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_905;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, double, empty, empty> type_v_906;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, std::vector<double>, empty, empty> type_v_907;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_908;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, var, empty, empty> type_v_909;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_v_910;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_911;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_912;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_913;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_914;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_915;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_916;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_917;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, double, empty, empty> type_v_918;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, std::vector<double>, empty, empty> type_v_919;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_920;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, var, empty, empty> type_v_921;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, std::vector<var>, empty, empty> type_v_922;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_923;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, double, empty, empty> type_v_924;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_v_925;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_926;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, var, empty, empty> type_v_927;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_v_928;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_929;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_930;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_931;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_932;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_933;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_934;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_935;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_936;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_937;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_938;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_939;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_940;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_941;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_942;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_943;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_944;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_945;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_946;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_947;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_948;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_949;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_950;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_951;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_952;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_953;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_954;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_955;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_956;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_957;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_958;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_959;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_960;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_961;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_962;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_963;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_964;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_965;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_966;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_967;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_968;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_969;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_970;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_971;
+typedef std::tuple<std::vector<var>, var, double, double, empty, empty> type_v_972;
+typedef std::tuple<std::vector<var>, var, double, std::vector<double>, empty, empty> type_v_973;
+typedef std::tuple<std::vector<var>, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_974;
+typedef std::tuple<std::vector<var>, var, double, var, empty, empty> type_v_975;
+typedef std::tuple<std::vector<var>, var, double, std::vector<var>, empty, empty> type_v_976;
+typedef std::tuple<std::vector<var>, var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_977;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, double, empty, empty> type_v_978;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, std::vector<double>, empty, empty> type_v_979;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_980;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, var, empty, empty> type_v_981;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, std::vector<var>, empty, empty> type_v_982;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_983;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_984;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_985;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_986;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_987;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_988;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_989;
+typedef std::tuple<std::vector<var>, var, var, double, empty, empty> type_v_990;
+typedef std::tuple<std::vector<var>, var, var, std::vector<double>, empty, empty> type_v_991;
+typedef std::tuple<std::vector<var>, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_992;
+typedef std::tuple<std::vector<var>, var, var, var, empty, empty> type_v_993;
+typedef std::tuple<std::vector<var>, var, var, std::vector<var>, empty, empty> type_v_994;
+typedef std::tuple<std::vector<var>, var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_995;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, double, empty, empty> type_v_996;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, std::vector<double>, empty, empty> type_v_997;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_998;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, var, empty, empty> type_v_999;
+
+typedef std::tuple<AgradCdfParetoType2, type_v_900> AgradCdfParetoType2_v_900;
+typedef std::tuple<AgradCdfParetoType2, type_v_901> AgradCdfParetoType2_v_901;
+typedef std::tuple<AgradCdfParetoType2, type_v_902> AgradCdfParetoType2_v_902;
+typedef std::tuple<AgradCdfParetoType2, type_v_903> AgradCdfParetoType2_v_903;
+typedef std::tuple<AgradCdfParetoType2, type_v_904> AgradCdfParetoType2_v_904;
+typedef std::tuple<AgradCdfParetoType2, type_v_905> AgradCdfParetoType2_v_905;
+typedef std::tuple<AgradCdfParetoType2, type_v_906> AgradCdfParetoType2_v_906;
+typedef std::tuple<AgradCdfParetoType2, type_v_907> AgradCdfParetoType2_v_907;
+typedef std::tuple<AgradCdfParetoType2, type_v_908> AgradCdfParetoType2_v_908;
+typedef std::tuple<AgradCdfParetoType2, type_v_909> AgradCdfParetoType2_v_909;
+typedef std::tuple<AgradCdfParetoType2, type_v_910> AgradCdfParetoType2_v_910;
+typedef std::tuple<AgradCdfParetoType2, type_v_911> AgradCdfParetoType2_v_911;
+typedef std::tuple<AgradCdfParetoType2, type_v_912> AgradCdfParetoType2_v_912;
+typedef std::tuple<AgradCdfParetoType2, type_v_913> AgradCdfParetoType2_v_913;
+typedef std::tuple<AgradCdfParetoType2, type_v_914> AgradCdfParetoType2_v_914;
+typedef std::tuple<AgradCdfParetoType2, type_v_915> AgradCdfParetoType2_v_915;
+typedef std::tuple<AgradCdfParetoType2, type_v_916> AgradCdfParetoType2_v_916;
+typedef std::tuple<AgradCdfParetoType2, type_v_917> AgradCdfParetoType2_v_917;
+typedef std::tuple<AgradCdfParetoType2, type_v_918> AgradCdfParetoType2_v_918;
+typedef std::tuple<AgradCdfParetoType2, type_v_919> AgradCdfParetoType2_v_919;
+typedef std::tuple<AgradCdfParetoType2, type_v_920> AgradCdfParetoType2_v_920;
+typedef std::tuple<AgradCdfParetoType2, type_v_921> AgradCdfParetoType2_v_921;
+typedef std::tuple<AgradCdfParetoType2, type_v_922> AgradCdfParetoType2_v_922;
+typedef std::tuple<AgradCdfParetoType2, type_v_923> AgradCdfParetoType2_v_923;
+typedef std::tuple<AgradCdfParetoType2, type_v_924> AgradCdfParetoType2_v_924;
+typedef std::tuple<AgradCdfParetoType2, type_v_925> AgradCdfParetoType2_v_925;
+typedef std::tuple<AgradCdfParetoType2, type_v_926> AgradCdfParetoType2_v_926;
+typedef std::tuple<AgradCdfParetoType2, type_v_927> AgradCdfParetoType2_v_927;
+typedef std::tuple<AgradCdfParetoType2, type_v_928> AgradCdfParetoType2_v_928;
+typedef std::tuple<AgradCdfParetoType2, type_v_929> AgradCdfParetoType2_v_929;
+typedef std::tuple<AgradCdfParetoType2, type_v_930> AgradCdfParetoType2_v_930;
+typedef std::tuple<AgradCdfParetoType2, type_v_931> AgradCdfParetoType2_v_931;
+typedef std::tuple<AgradCdfParetoType2, type_v_932> AgradCdfParetoType2_v_932;
+typedef std::tuple<AgradCdfParetoType2, type_v_933> AgradCdfParetoType2_v_933;
+typedef std::tuple<AgradCdfParetoType2, type_v_934> AgradCdfParetoType2_v_934;
+typedef std::tuple<AgradCdfParetoType2, type_v_935> AgradCdfParetoType2_v_935;
+typedef std::tuple<AgradCdfParetoType2, type_v_936> AgradCdfParetoType2_v_936;
+typedef std::tuple<AgradCdfParetoType2, type_v_937> AgradCdfParetoType2_v_937;
+typedef std::tuple<AgradCdfParetoType2, type_v_938> AgradCdfParetoType2_v_938;
+typedef std::tuple<AgradCdfParetoType2, type_v_939> AgradCdfParetoType2_v_939;
+typedef std::tuple<AgradCdfParetoType2, type_v_940> AgradCdfParetoType2_v_940;
+typedef std::tuple<AgradCdfParetoType2, type_v_941> AgradCdfParetoType2_v_941;
+typedef std::tuple<AgradCdfParetoType2, type_v_942> AgradCdfParetoType2_v_942;
+typedef std::tuple<AgradCdfParetoType2, type_v_943> AgradCdfParetoType2_v_943;
+typedef std::tuple<AgradCdfParetoType2, type_v_944> AgradCdfParetoType2_v_944;
+typedef std::tuple<AgradCdfParetoType2, type_v_945> AgradCdfParetoType2_v_945;
+typedef std::tuple<AgradCdfParetoType2, type_v_946> AgradCdfParetoType2_v_946;
+typedef std::tuple<AgradCdfParetoType2, type_v_947> AgradCdfParetoType2_v_947;
+typedef std::tuple<AgradCdfParetoType2, type_v_948> AgradCdfParetoType2_v_948;
+typedef std::tuple<AgradCdfParetoType2, type_v_949> AgradCdfParetoType2_v_949;
+typedef std::tuple<AgradCdfParetoType2, type_v_950> AgradCdfParetoType2_v_950;
+typedef std::tuple<AgradCdfParetoType2, type_v_951> AgradCdfParetoType2_v_951;
+typedef std::tuple<AgradCdfParetoType2, type_v_952> AgradCdfParetoType2_v_952;
+typedef std::tuple<AgradCdfParetoType2, type_v_953> AgradCdfParetoType2_v_953;
+typedef std::tuple<AgradCdfParetoType2, type_v_954> AgradCdfParetoType2_v_954;
+typedef std::tuple<AgradCdfParetoType2, type_v_955> AgradCdfParetoType2_v_955;
+typedef std::tuple<AgradCdfParetoType2, type_v_956> AgradCdfParetoType2_v_956;
+typedef std::tuple<AgradCdfParetoType2, type_v_957> AgradCdfParetoType2_v_957;
+typedef std::tuple<AgradCdfParetoType2, type_v_958> AgradCdfParetoType2_v_958;
+typedef std::tuple<AgradCdfParetoType2, type_v_959> AgradCdfParetoType2_v_959;
+typedef std::tuple<AgradCdfParetoType2, type_v_960> AgradCdfParetoType2_v_960;
+typedef std::tuple<AgradCdfParetoType2, type_v_961> AgradCdfParetoType2_v_961;
+typedef std::tuple<AgradCdfParetoType2, type_v_962> AgradCdfParetoType2_v_962;
+typedef std::tuple<AgradCdfParetoType2, type_v_963> AgradCdfParetoType2_v_963;
+typedef std::tuple<AgradCdfParetoType2, type_v_964> AgradCdfParetoType2_v_964;
+typedef std::tuple<AgradCdfParetoType2, type_v_965> AgradCdfParetoType2_v_965;
+typedef std::tuple<AgradCdfParetoType2, type_v_966> AgradCdfParetoType2_v_966;
+typedef std::tuple<AgradCdfParetoType2, type_v_967> AgradCdfParetoType2_v_967;
+typedef std::tuple<AgradCdfParetoType2, type_v_968> AgradCdfParetoType2_v_968;
+typedef std::tuple<AgradCdfParetoType2, type_v_969> AgradCdfParetoType2_v_969;
+typedef std::tuple<AgradCdfParetoType2, type_v_970> AgradCdfParetoType2_v_970;
+typedef std::tuple<AgradCdfParetoType2, type_v_971> AgradCdfParetoType2_v_971;
+typedef std::tuple<AgradCdfParetoType2, type_v_972> AgradCdfParetoType2_v_972;
+typedef std::tuple<AgradCdfParetoType2, type_v_973> AgradCdfParetoType2_v_973;
+typedef std::tuple<AgradCdfParetoType2, type_v_974> AgradCdfParetoType2_v_974;
+typedef std::tuple<AgradCdfParetoType2, type_v_975> AgradCdfParetoType2_v_975;
+typedef std::tuple<AgradCdfParetoType2, type_v_976> AgradCdfParetoType2_v_976;
+typedef std::tuple<AgradCdfParetoType2, type_v_977> AgradCdfParetoType2_v_977;
+typedef std::tuple<AgradCdfParetoType2, type_v_978> AgradCdfParetoType2_v_978;
+typedef std::tuple<AgradCdfParetoType2, type_v_979> AgradCdfParetoType2_v_979;
+typedef std::tuple<AgradCdfParetoType2, type_v_980> AgradCdfParetoType2_v_980;
+typedef std::tuple<AgradCdfParetoType2, type_v_981> AgradCdfParetoType2_v_981;
+typedef std::tuple<AgradCdfParetoType2, type_v_982> AgradCdfParetoType2_v_982;
+typedef std::tuple<AgradCdfParetoType2, type_v_983> AgradCdfParetoType2_v_983;
+typedef std::tuple<AgradCdfParetoType2, type_v_984> AgradCdfParetoType2_v_984;
+typedef std::tuple<AgradCdfParetoType2, type_v_985> AgradCdfParetoType2_v_985;
+typedef std::tuple<AgradCdfParetoType2, type_v_986> AgradCdfParetoType2_v_986;
+typedef std::tuple<AgradCdfParetoType2, type_v_987> AgradCdfParetoType2_v_987;
+typedef std::tuple<AgradCdfParetoType2, type_v_988> AgradCdfParetoType2_v_988;
+typedef std::tuple<AgradCdfParetoType2, type_v_989> AgradCdfParetoType2_v_989;
+typedef std::tuple<AgradCdfParetoType2, type_v_990> AgradCdfParetoType2_v_990;
+typedef std::tuple<AgradCdfParetoType2, type_v_991> AgradCdfParetoType2_v_991;
+typedef std::tuple<AgradCdfParetoType2, type_v_992> AgradCdfParetoType2_v_992;
+typedef std::tuple<AgradCdfParetoType2, type_v_993> AgradCdfParetoType2_v_993;
+typedef std::tuple<AgradCdfParetoType2, type_v_994> AgradCdfParetoType2_v_994;
+typedef std::tuple<AgradCdfParetoType2, type_v_995> AgradCdfParetoType2_v_995;
+typedef std::tuple<AgradCdfParetoType2, type_v_996> AgradCdfParetoType2_v_996;
+typedef std::tuple<AgradCdfParetoType2, type_v_997> AgradCdfParetoType2_v_997;
+typedef std::tuple<AgradCdfParetoType2, type_v_998> AgradCdfParetoType2_v_998;
+typedef std::tuple<AgradCdfParetoType2, type_v_999> AgradCdfParetoType2_v_999;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_900, AgradCdfTestFixture, AgradCdfParetoType2_v_900);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_901, AgradCdfTestFixture, AgradCdfParetoType2_v_901);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_902, AgradCdfTestFixture, AgradCdfParetoType2_v_902);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_903, AgradCdfTestFixture, AgradCdfParetoType2_v_903);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_904, AgradCdfTestFixture, AgradCdfParetoType2_v_904);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_905, AgradCdfTestFixture, AgradCdfParetoType2_v_905);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_906, AgradCdfTestFixture, AgradCdfParetoType2_v_906);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_907, AgradCdfTestFixture, AgradCdfParetoType2_v_907);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_908, AgradCdfTestFixture, AgradCdfParetoType2_v_908);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_909, AgradCdfTestFixture, AgradCdfParetoType2_v_909);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_910, AgradCdfTestFixture, AgradCdfParetoType2_v_910);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_911, AgradCdfTestFixture, AgradCdfParetoType2_v_911);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_912, AgradCdfTestFixture, AgradCdfParetoType2_v_912);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_913, AgradCdfTestFixture, AgradCdfParetoType2_v_913);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_914, AgradCdfTestFixture, AgradCdfParetoType2_v_914);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_915, AgradCdfTestFixture, AgradCdfParetoType2_v_915);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_916, AgradCdfTestFixture, AgradCdfParetoType2_v_916);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_917, AgradCdfTestFixture, AgradCdfParetoType2_v_917);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_918, AgradCdfTestFixture, AgradCdfParetoType2_v_918);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_919, AgradCdfTestFixture, AgradCdfParetoType2_v_919);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_920, AgradCdfTestFixture, AgradCdfParetoType2_v_920);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_921, AgradCdfTestFixture, AgradCdfParetoType2_v_921);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_922, AgradCdfTestFixture, AgradCdfParetoType2_v_922);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_923, AgradCdfTestFixture, AgradCdfParetoType2_v_923);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_924, AgradCdfTestFixture, AgradCdfParetoType2_v_924);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_925, AgradCdfTestFixture, AgradCdfParetoType2_v_925);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_926, AgradCdfTestFixture, AgradCdfParetoType2_v_926);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_927, AgradCdfTestFixture, AgradCdfParetoType2_v_927);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_928, AgradCdfTestFixture, AgradCdfParetoType2_v_928);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_929, AgradCdfTestFixture, AgradCdfParetoType2_v_929);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_930, AgradCdfTestFixture, AgradCdfParetoType2_v_930);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_931, AgradCdfTestFixture, AgradCdfParetoType2_v_931);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_932, AgradCdfTestFixture, AgradCdfParetoType2_v_932);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_933, AgradCdfTestFixture, AgradCdfParetoType2_v_933);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_934, AgradCdfTestFixture, AgradCdfParetoType2_v_934);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_935, AgradCdfTestFixture, AgradCdfParetoType2_v_935);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_936, AgradCdfTestFixture, AgradCdfParetoType2_v_936);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_937, AgradCdfTestFixture, AgradCdfParetoType2_v_937);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_938, AgradCdfTestFixture, AgradCdfParetoType2_v_938);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_939, AgradCdfTestFixture, AgradCdfParetoType2_v_939);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_940, AgradCdfTestFixture, AgradCdfParetoType2_v_940);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_941, AgradCdfTestFixture, AgradCdfParetoType2_v_941);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_942, AgradCdfTestFixture, AgradCdfParetoType2_v_942);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_943, AgradCdfTestFixture, AgradCdfParetoType2_v_943);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_944, AgradCdfTestFixture, AgradCdfParetoType2_v_944);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_945, AgradCdfTestFixture, AgradCdfParetoType2_v_945);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_946, AgradCdfTestFixture, AgradCdfParetoType2_v_946);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_947, AgradCdfTestFixture, AgradCdfParetoType2_v_947);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_948, AgradCdfTestFixture, AgradCdfParetoType2_v_948);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_949, AgradCdfTestFixture, AgradCdfParetoType2_v_949);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_950, AgradCdfTestFixture, AgradCdfParetoType2_v_950);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_951, AgradCdfTestFixture, AgradCdfParetoType2_v_951);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_952, AgradCdfTestFixture, AgradCdfParetoType2_v_952);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_953, AgradCdfTestFixture, AgradCdfParetoType2_v_953);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_954, AgradCdfTestFixture, AgradCdfParetoType2_v_954);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_955, AgradCdfTestFixture, AgradCdfParetoType2_v_955);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_956, AgradCdfTestFixture, AgradCdfParetoType2_v_956);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_957, AgradCdfTestFixture, AgradCdfParetoType2_v_957);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_958, AgradCdfTestFixture, AgradCdfParetoType2_v_958);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_959, AgradCdfTestFixture, AgradCdfParetoType2_v_959);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_960, AgradCdfTestFixture, AgradCdfParetoType2_v_960);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_961, AgradCdfTestFixture, AgradCdfParetoType2_v_961);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_962, AgradCdfTestFixture, AgradCdfParetoType2_v_962);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_963, AgradCdfTestFixture, AgradCdfParetoType2_v_963);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_964, AgradCdfTestFixture, AgradCdfParetoType2_v_964);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_965, AgradCdfTestFixture, AgradCdfParetoType2_v_965);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_966, AgradCdfTestFixture, AgradCdfParetoType2_v_966);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_967, AgradCdfTestFixture, AgradCdfParetoType2_v_967);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_968, AgradCdfTestFixture, AgradCdfParetoType2_v_968);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_969, AgradCdfTestFixture, AgradCdfParetoType2_v_969);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_970, AgradCdfTestFixture, AgradCdfParetoType2_v_970);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_971, AgradCdfTestFixture, AgradCdfParetoType2_v_971);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_972, AgradCdfTestFixture, AgradCdfParetoType2_v_972);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_973, AgradCdfTestFixture, AgradCdfParetoType2_v_973);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_974, AgradCdfTestFixture, AgradCdfParetoType2_v_974);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_975, AgradCdfTestFixture, AgradCdfParetoType2_v_975);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_976, AgradCdfTestFixture, AgradCdfParetoType2_v_976);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_977, AgradCdfTestFixture, AgradCdfParetoType2_v_977);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_978, AgradCdfTestFixture, AgradCdfParetoType2_v_978);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_979, AgradCdfTestFixture, AgradCdfParetoType2_v_979);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_980, AgradCdfTestFixture, AgradCdfParetoType2_v_980);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_981, AgradCdfTestFixture, AgradCdfParetoType2_v_981);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_982, AgradCdfTestFixture, AgradCdfParetoType2_v_982);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_983, AgradCdfTestFixture, AgradCdfParetoType2_v_983);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_984, AgradCdfTestFixture, AgradCdfParetoType2_v_984);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_985, AgradCdfTestFixture, AgradCdfParetoType2_v_985);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_986, AgradCdfTestFixture, AgradCdfParetoType2_v_986);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_987, AgradCdfTestFixture, AgradCdfParetoType2_v_987);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_988, AgradCdfTestFixture, AgradCdfParetoType2_v_988);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_989, AgradCdfTestFixture, AgradCdfParetoType2_v_989);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_990, AgradCdfTestFixture, AgradCdfParetoType2_v_990);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_991, AgradCdfTestFixture, AgradCdfParetoType2_v_991);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_992, AgradCdfTestFixture, AgradCdfParetoType2_v_992);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_993, AgradCdfTestFixture, AgradCdfParetoType2_v_993);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_994, AgradCdfTestFixture, AgradCdfParetoType2_v_994);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_995, AgradCdfTestFixture, AgradCdfParetoType2_v_995);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_996, AgradCdfTestFixture, AgradCdfParetoType2_v_996);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_997, AgradCdfTestFixture, AgradCdfParetoType2_v_997);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_998, AgradCdfTestFixture, AgradCdfParetoType2_v_998);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_999, AgradCdfTestFixture, AgradCdfParetoType2_v_999);
+
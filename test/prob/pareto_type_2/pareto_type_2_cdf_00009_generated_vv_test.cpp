@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_cdf_test.hpp>
+
+typedef std::tuple<std::vector<var>, var, std::vector<double>, var, empty, empty> type_vv_900;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, std::vector<var>, empty, empty> type_vv_901;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_902;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_903;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_904;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_905;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_906;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_907;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_908;
+typedef std::tuple<std::vector<var>, var, var, double, empty, empty> type_vv_909;
+typedef std::tuple<std::vector<var>, var, var, std::vector<double>, empty, empty> type_vv_910;
+typedef std::tuple<std::vector<var>, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_911;
+typedef std::tuple<std::vector<var>, var, var, var, empty, empty> type_vv_912;
+typedef std::tuple<std::vector<var>, var, var, std::vector<var>, empty, empty> type_vv_913;
+typedef std::tuple<std::vector<var>, var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_914;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, double, empty, empty> type_vv_915;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, std::vector<double>, empty, empty> type_vv_916;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_917;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, var, empty, empty> type_vv_918;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, std::vector<var>, empty, empty> type_vv_919;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_920;
+typedef std::tuple<std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_921;
+typedef std::tuple<std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_922;
+typedef std::tuple<std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_923;
+typedef std::tuple<std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_924;
+typedef std::tuple<std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_925;
+typedef std::tuple<std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_926;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, double, empty, empty> type_vv_927;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, std::vector<double>, empty, empty> type_vv_928;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_929;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, var, empty, empty> type_vv_930;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, std::vector<var>, empty, empty> type_vv_931;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_932;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, double, empty, empty> type_vv_933;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_vv_934;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_935;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, var, empty, empty> type_vv_936;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_vv_937;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_938;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_939;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_940;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_941;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_942;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_943;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_944;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, double, empty, empty> type_vv_945;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, std::vector<double>, empty, empty> type_vv_946;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_947;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, var, empty, empty> type_vv_948;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, std::vector<var>, empty, empty> type_vv_949;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_950;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, double, empty, empty> type_vv_951;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_vv_952;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_953;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, var, empty, empty> type_vv_954;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_vv_955;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_956;
+typedef std::tuple<std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_957;
+typedef std::tuple<std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_958;
+typedef std::tuple<std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_959;
+typedef std::tuple<std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_960;
+typedef std::tuple<std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_961;
+typedef std::tuple<std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_962;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, empty, empty> type_vv_963;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, empty, empty> type_vv_964;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_965;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, empty, empty> type_vv_966;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, empty, empty> type_vv_967;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_968;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, empty, empty> type_vv_969;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, empty, empty> type_vv_970;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_971;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, empty, empty> type_vv_972;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, empty, empty> type_vv_973;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_974;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_975;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_976;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_977;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_978;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_979;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_980;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, empty, empty> type_vv_981;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, empty, empty> type_vv_982;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_983;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, empty, empty> type_vv_984;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, empty, empty> type_vv_985;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_986;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, empty, empty> type_vv_987;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, empty, empty> type_vv_988;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_989;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, empty, empty> type_vv_990;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, empty, empty> type_vv_991;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_992;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_993;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_994;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_995;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_996;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_997;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_998;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, double, empty, empty> type_vv_999;
+
+typedef std::tuple<AgradCdfParetoType2, type_vv_900> AgradCdfParetoType2_vv_900;
+typedef std::tuple<AgradCdfParetoType2, type_vv_901> AgradCdfParetoType2_vv_901;
+typedef std::tuple<AgradCdfParetoType2, type_vv_902> AgradCdfParetoType2_vv_902;
+typedef std::tuple<AgradCdfParetoType2, type_vv_903> AgradCdfParetoType2_vv_903;
+typedef std::tuple<AgradCdfParetoType2, type_vv_904> AgradCdfParetoType2_vv_904;
+typedef std::tuple<AgradCdfParetoType2, type_vv_905> AgradCdfParetoType2_vv_905;
+typedef std::tuple<AgradCdfParetoType2, type_vv_906> AgradCdfParetoType2_vv_906;
+typedef std::tuple<AgradCdfParetoType2, type_vv_907> AgradCdfParetoType2_vv_907;
+typedef std::tuple<AgradCdfParetoType2, type_vv_908> AgradCdfParetoType2_vv_908;
+typedef std::tuple<AgradCdfParetoType2, type_vv_909> AgradCdfParetoType2_vv_909;
+typedef std::tuple<AgradCdfParetoType2, type_vv_910> AgradCdfParetoType2_vv_910;
+typedef std::tuple<AgradCdfParetoType2, type_vv_911> AgradCdfParetoType2_vv_911;
+typedef std::tuple<AgradCdfParetoType2, type_vv_912> AgradCdfParetoType2_vv_912;
+typedef std::tuple<AgradCdfParetoType2, type_vv_913> AgradCdfParetoType2_vv_913;
+typedef std::tuple<AgradCdfParetoType2, type_vv_914> AgradCdfParetoType2_vv_914;
+typedef std::tuple<AgradCdfParetoType2, type_vv_915> AgradCdfParetoType2_vv_915;
+typedef std::tuple<AgradCdfParetoType2, type_vv_916> AgradCdfParetoType2_vv_916;
+typedef std::tuple<AgradCdfParetoType2, type_vv_917> AgradCdfParetoType2_vv_917;
+typedef std::tuple<AgradCdfParetoType2, type_vv_918> AgradCdfParetoType2_vv_918;
+typedef std::tuple<AgradCdfParetoType2, type_vv_919> AgradCdfParetoType2_vv_919;
+typedef std::tuple<AgradCdfParetoType2, type_vv_920> AgradCdfParetoType2_vv_920;
+typedef std::tuple<AgradCdfParetoType2, type_vv_921> AgradCdfParetoType2_vv_921;
+typedef std::tuple<AgradCdfParetoType2, type_vv_922> AgradCdfParetoType2_vv_922;
+typedef std::tuple<AgradCdfParetoType2, type_vv_923> AgradCdfParetoType2_vv_923;
+typedef std::tuple<AgradCdfParetoType2, type_vv_924> AgradCdfParetoType2_vv_924;
+typedef std::tuple<AgradCdfParetoType2, type_vv_925> AgradCdfParetoType2_vv_925;
+typedef std::tuple<AgradCdfParetoType2, type_vv_926> AgradCdfParetoType2_vv_926;
+typedef std::tuple<AgradCdfParetoType2, type_vv_927> AgradCdfParetoType2_vv_927;
+typedef std::tuple<AgradCdfParetoType2, type_vv_928> AgradCdfParetoType2_vv_928;
+typedef std::tuple<AgradCdfParetoType2, type_vv_929> AgradCdfParetoType2_vv_929;
+typedef std::tuple<AgradCdfParetoType2, type_vv_930> AgradCdfParetoType2_vv_930;
+typedef std::tuple<AgradCdfParetoType2, type_vv_931> AgradCdfParetoType2_vv_931;
+typedef std::tuple<AgradCdfParetoType2, type_vv_932> AgradCdfParetoType2_vv_932;
+typedef std::tuple<AgradCdfParetoType2, type_vv_933> AgradCdfParetoType2_vv_933;
+typedef std::tuple<AgradCdfParetoType2, type_vv_934> AgradCdfParetoType2_vv_934;
+typedef std::tuple<AgradCdfParetoType2, type_vv_935> AgradCdfParetoType2_vv_935;
+typedef std::tuple<AgradCdfParetoType2, type_vv_936> AgradCdfParetoType2_vv_936;
+typedef std::tuple<AgradCdfParetoType2, type_vv_937> AgradCdfParetoType2_vv_937;
+typedef std::tuple<AgradCdfParetoType2, type_vv_938> AgradCdfParetoType2_vv_938;
+typedef std::tuple<AgradCdfParetoType2, type_vv_939> AgradCdfParetoType2_vv_939;
+typedef std::tuple<AgradCdfParetoType2, type_vv_940> AgradCdfParetoType2_vv_940;
+typedef std::tuple<AgradCdfParetoType2, type_vv_941> AgradCdfParetoType2_vv_941;
+typedef std::tuple<AgradCdfParetoType2, type_vv_942> AgradCdfParetoType2_vv_942;
+typedef std::tuple<AgradCdfParetoType2, type_vv_943> AgradCdfParetoType2_vv_943;
+typedef std::tuple<AgradCdfParetoType2, type_vv_944> AgradCdfParetoType2_vv_944;
+typedef std::tuple<AgradCdfParetoType2, type_vv_945> AgradCdfParetoType2_vv_945;
+typedef std::tuple<AgradCdfParetoType2, type_vv_946> AgradCdfParetoType2_vv_946;
+typedef std::tuple<AgradCdfParetoType2, type_vv_947> AgradCdfParetoType2_vv_947;
+typedef std::tuple<AgradCdfParetoType2, type_vv_948> AgradCdfParetoType2_vv_948;
+typedef std::tuple<AgradCdfParetoType2, type_vv_949> AgradCdfParetoType2_vv_949;
+typedef std::tuple<AgradCdfParetoType2, type_vv_950> AgradCdfParetoType2_vv_950;
+typedef std::tuple<AgradCdfParetoType2, type_vv_951> AgradCdfParetoType2_vv_951;
+typedef std::tuple<AgradCdfParetoType2, type_vv_952> AgradCdfParetoType2_vv_952;
+typedef std::tuple<AgradCdfParetoType2, type_vv_953> AgradCdfParetoType2_vv_953;
+typedef std::tuple<AgradCdfParetoType2, type_vv_954> AgradCdfParetoType2_vv_954;
+typedef std::tuple<AgradCdfParetoType2, type_vv_955> AgradCdfParetoType2_vv_955;
+typedef std::tuple<AgradCdfParetoType2, type_vv_956> AgradCdfParetoType2_vv_956;
+typedef std::tuple<AgradCdfParetoType2, type_vv_957> AgradCdfParetoType2_vv_957;
+typedef std::tuple<AgradCdfParetoType2, type_vv_958> AgradCdfParetoType2_vv_958;
+typedef std::tuple<AgradCdfParetoType2, type_vv_959> AgradCdfParetoType2_vv_959;
+typedef std::tuple<AgradCdfParetoType2, type_vv_960> AgradCdfParetoType2_vv_960;
+typedef std::tuple<AgradCdfParetoType2, type_vv_961> AgradCdfParetoType2_vv_961;
+typedef std::tuple<AgradCdfParetoType2, type_vv_962> AgradCdfParetoType2_vv_962;
+typedef std::tuple<AgradCdfParetoType2, type_vv_963> AgradCdfParetoType2_vv_963;
+typedef std::tuple<AgradCdfParetoType2, type_vv_964> AgradCdfParetoType2_vv_964;
+typedef std::tuple<AgradCdfParetoType2, type_vv_965> AgradCdfParetoType2_vv_965;
+typedef std::tuple<AgradCdfParetoType2, type_vv_966> AgradCdfParetoType2_vv_966;
+typedef std::tuple<AgradCdfParetoType2, type_vv_967> AgradCdfParetoType2_vv_967;
+typedef std::tuple<AgradCdfParetoType2, type_vv_968> AgradCdfParetoType2_vv_968;
+typedef std::tuple<AgradCdfParetoType2, type_vv_969> AgradCdfParetoType2_vv_969;
+typedef std::tuple<AgradCdfParetoType2, type_vv_970> AgradCdfParetoType2_vv_970;
+typedef std::tuple<AgradCdfParetoType2, type_vv_971> AgradCdfParetoType2_vv_971;
+typedef std::tuple<AgradCdfParetoType2, type_vv_972> AgradCdfParetoType2_vv_972;
+typedef std::tuple<AgradCdfParetoType2, type_vv_973> AgradCdfParetoType2_vv_973;
+typedef std::tuple<AgradCdfParetoType2, type_vv_974> AgradCdfParetoType2_vv_974;
+typedef std::tuple<AgradCdfParetoType2, type_vv_975> AgradCdfParetoType2_vv_975;
+typedef std::tuple<AgradCdfParetoType2, type_vv_976> AgradCdfParetoType2_vv_976;
+typedef std::tuple<AgradCdfParetoType2, type_vv_977> AgradCdfParetoType2_vv_977;
+typedef std::tuple<AgradCdfParetoType2, type_vv_978> AgradCdfParetoType2_vv_978;
+typedef std::tuple<AgradCdfParetoType2, type_vv_979> AgradCdfParetoType2_vv_979;
+typedef std::tuple<AgradCdfParetoType2, type_vv_980> AgradCdfParetoType2_vv_980;
+typedef std::tuple<AgradCdfParetoType2, type_vv_981> AgradCdfParetoType2_vv_981;
+typedef std::tuple<AgradCdfParetoType2, type_vv_982> AgradCdfParetoType2_vv_982;
+typedef std::tuple<AgradCdfParetoType2, type_vv_983> AgradCdfParetoType2_vv_983;
+typedef std::tuple<AgradCdfParetoType2, type_vv_984> AgradCdfParetoType2_vv_984;
+typedef std::tuple<AgradCdfParetoType2, type_vv_985> AgradCdfParetoType2_vv_985;
+typedef std::tuple<AgradCdfParetoType2, type_vv_986> AgradCdfParetoType2_vv_986;
+typedef std::tuple<AgradCdfParetoType2, type_vv_987> AgradCdfParetoType2_vv_987;
+typedef std::tuple<AgradCdfParetoType2, type_vv_988> AgradCdfParetoType2_vv_988;
+typedef std::tuple<AgradCdfParetoType2, type_vv_989> AgradCdfParetoType2_vv_989;
+typedef std::tuple<AgradCdfParetoType2, type_vv_990> AgradCdfParetoType2_vv_990;
+typedef std::tuple<AgradCdfParetoType2, type_vv_991> AgradCdfParetoType2_vv_991;
+typedef std::tuple<AgradCdfParetoType2, type_vv_992> AgradCdfParetoType2_vv_992;
+typedef std::tuple<AgradCdfParetoType2, type_vv_993> AgradCdfParetoType2_vv_993;
+typedef std::tuple<AgradCdfParetoType2, type_vv_994> AgradCdfParetoType2_vv_994;
+typedef std::tuple<AgradCdfParetoType2, type_vv_995> AgradCdfParetoType2_vv_995;
+typedef std::tuple<AgradCdfParetoType2, type_vv_996> AgradCdfParetoType2_vv_996;
+typedef std::tuple<AgradCdfParetoType2, type_vv_997> AgradCdfParetoType2_vv_997;
+typedef std::tuple<AgradCdfParetoType2, type_vv_998> AgradCdfParetoType2_vv_998;
+typedef std::tuple<AgradCdfParetoType2, type_vv_999> AgradCdfParetoType2_vv_999;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_900, AgradCdfTestFixture, AgradCdfParetoType2_vv_900);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_901, AgradCdfTestFixture, AgradCdfParetoType2_vv_901);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_902, AgradCdfTestFixture, AgradCdfParetoType2_vv_902);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_903, AgradCdfTestFixture, AgradCdfParetoType2_vv_903);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_904, AgradCdfTestFixture, AgradCdfParetoType2_vv_904);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_905, AgradCdfTestFixture, AgradCdfParetoType2_vv_905);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_906, AgradCdfTestFixture, AgradCdfParetoType2_vv_906);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_907, AgradCdfTestFixture, AgradCdfParetoType2_vv_907);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_908, AgradCdfTestFixture, AgradCdfParetoType2_vv_908);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_909, AgradCdfTestFixture, AgradCdfParetoType2_vv_909);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_910, AgradCdfTestFixture, AgradCdfParetoType2_vv_910);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_911, AgradCdfTestFixture, AgradCdfParetoType2_vv_911);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_912, AgradCdfTestFixture, AgradCdfParetoType2_vv_912);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_913, AgradCdfTestFixture, AgradCdfParetoType2_vv_913);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_914, AgradCdfTestFixture, AgradCdfParetoType2_vv_914);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_915, AgradCdfTestFixture, AgradCdfParetoType2_vv_915);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_916, AgradCdfTestFixture, AgradCdfParetoType2_vv_916);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_917, AgradCdfTestFixture, AgradCdfParetoType2_vv_917);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_918, AgradCdfTestFixture, AgradCdfParetoType2_vv_918);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_919, AgradCdfTestFixture, AgradCdfParetoType2_vv_919);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_920, AgradCdfTestFixture, AgradCdfParetoType2_vv_920);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_921, AgradCdfTestFixture, AgradCdfParetoType2_vv_921);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_922, AgradCdfTestFixture, AgradCdfParetoType2_vv_922);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_923, AgradCdfTestFixture, AgradCdfParetoType2_vv_923);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_924, AgradCdfTestFixture, AgradCdfParetoType2_vv_924);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_925, AgradCdfTestFixture, AgradCdfParetoType2_vv_925);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_926, AgradCdfTestFixture, AgradCdfParetoType2_vv_926);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_927, AgradCdfTestFixture, AgradCdfParetoType2_vv_927);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_928, AgradCdfTestFixture, AgradCdfParetoType2_vv_928);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_929, AgradCdfTestFixture, AgradCdfParetoType2_vv_929);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_930, AgradCdfTestFixture, AgradCdfParetoType2_vv_930);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_931, AgradCdfTestFixture, AgradCdfParetoType2_vv_931);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_932, AgradCdfTestFixture, AgradCdfParetoType2_vv_932);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_933, AgradCdfTestFixture, AgradCdfParetoType2_vv_933);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_934, AgradCdfTestFixture, AgradCdfParetoType2_vv_934);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_935, AgradCdfTestFixture, AgradCdfParetoType2_vv_935);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_936, AgradCdfTestFixture, AgradCdfParetoType2_vv_936);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_937, AgradCdfTestFixture, AgradCdfParetoType2_vv_937);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_938, AgradCdfTestFixture, AgradCdfParetoType2_vv_938);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_939, AgradCdfTestFixture, AgradCdfParetoType2_vv_939);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_940, AgradCdfTestFixture, AgradCdfParetoType2_vv_940);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_941, AgradCdfTestFixture, AgradCdfParetoType2_vv_941);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_942, AgradCdfTestFixture, AgradCdfParetoType2_vv_942);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_943, AgradCdfTestFixture, AgradCdfParetoType2_vv_943);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_944, AgradCdfTestFixture, AgradCdfParetoType2_vv_944);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_945, AgradCdfTestFixture, AgradCdfParetoType2_vv_945);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_946, AgradCdfTestFixture, AgradCdfParetoType2_vv_946);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_947, AgradCdfTestFixture, AgradCdfParetoType2_vv_947);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_948, AgradCdfTestFixture, AgradCdfParetoType2_vv_948);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_949, AgradCdfTestFixture, AgradCdfParetoType2_vv_949);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_950, AgradCdfTestFixture, AgradCdfParetoType2_vv_950);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_951, AgradCdfTestFixture, AgradCdfParetoType2_vv_951);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_952, AgradCdfTestFixture, AgradCdfParetoType2_vv_952);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_953, AgradCdfTestFixture, AgradCdfParetoType2_vv_953);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_954, AgradCdfTestFixture, AgradCdfParetoType2_vv_954);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_955, AgradCdfTestFixture, AgradCdfParetoType2_vv_955);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_956, AgradCdfTestFixture, AgradCdfParetoType2_vv_956);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_957, AgradCdfTestFixture, AgradCdfParetoType2_vv_957);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_958, AgradCdfTestFixture, AgradCdfParetoType2_vv_958);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_959, AgradCdfTestFixture, AgradCdfParetoType2_vv_959);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_960, AgradCdfTestFixture, AgradCdfParetoType2_vv_960);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_961, AgradCdfTestFixture, AgradCdfParetoType2_vv_961);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_962, AgradCdfTestFixture, AgradCdfParetoType2_vv_962);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_963, AgradCdfTestFixture, AgradCdfParetoType2_vv_963);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_964, AgradCdfTestFixture, AgradCdfParetoType2_vv_964);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_965, AgradCdfTestFixture, AgradCdfParetoType2_vv_965);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_966, AgradCdfTestFixture, AgradCdfParetoType2_vv_966);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_967, AgradCdfTestFixture, AgradCdfParetoType2_vv_967);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_968, AgradCdfTestFixture, AgradCdfParetoType2_vv_968);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_969, AgradCdfTestFixture, AgradCdfParetoType2_vv_969);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_970, AgradCdfTestFixture, AgradCdfParetoType2_vv_970);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_971, AgradCdfTestFixture, AgradCdfParetoType2_vv_971);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_972, AgradCdfTestFixture, AgradCdfParetoType2_vv_972);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_973, AgradCdfTestFixture, AgradCdfParetoType2_vv_973);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_974, AgradCdfTestFixture, AgradCdfParetoType2_vv_974);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_975, AgradCdfTestFixture, AgradCdfParetoType2_vv_975);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_976, AgradCdfTestFixture, AgradCdfParetoType2_vv_976);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_977, AgradCdfTestFixture, AgradCdfParetoType2_vv_977);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_978, AgradCdfTestFixture, AgradCdfParetoType2_vv_978);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_979, AgradCdfTestFixture, AgradCdfParetoType2_vv_979);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_980, AgradCdfTestFixture, AgradCdfParetoType2_vv_980);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_981, AgradCdfTestFixture, AgradCdfParetoType2_vv_981);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_982, AgradCdfTestFixture, AgradCdfParetoType2_vv_982);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_983, AgradCdfTestFixture, AgradCdfParetoType2_vv_983);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_984, AgradCdfTestFixture, AgradCdfParetoType2_vv_984);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_985, AgradCdfTestFixture, AgradCdfParetoType2_vv_985);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_986, AgradCdfTestFixture, AgradCdfParetoType2_vv_986);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_987, AgradCdfTestFixture, AgradCdfParetoType2_vv_987);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_988, AgradCdfTestFixture, AgradCdfParetoType2_vv_988);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_989, AgradCdfTestFixture, AgradCdfParetoType2_vv_989);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_990, AgradCdfTestFixture, AgradCdfParetoType2_vv_990);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_991, AgradCdfTestFixture, AgradCdfParetoType2_vv_991);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_992, AgradCdfTestFixture, AgradCdfParetoType2_vv_992);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_993, AgradCdfTestFixture, AgradCdfParetoType2_vv_993);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_994, AgradCdfTestFixture, AgradCdfParetoType2_vv_994);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_995, AgradCdfTestFixture, AgradCdfParetoType2_vv_995);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_996, AgradCdfTestFixture, AgradCdfParetoType2_vv_996);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_997, AgradCdfTestFixture, AgradCdfParetoType2_vv_997);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_998, AgradCdfTestFixture, AgradCdfParetoType2_vv_998);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_vv_999, AgradCdfTestFixture, AgradCdfParetoType2_vv_999);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_cdf_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, std::vector<double>, empty, empty> type_ffv_1000;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1001;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, fvar<fvar<var> >, empty, empty> type_ffv_1002;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1003;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1004;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, double, empty, empty> type_ffv_1005;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, std::vector<double>, empty, empty> type_ffv_1006;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1007;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_1008;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1009;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1010;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_1011;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_1012;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1013;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_1014;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1015;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1016;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, double, empty, empty> type_ffv_1017;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_1018;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1019;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_1020;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1021;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1022;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_1023;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_1024;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1025;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_1026;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1027;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1028;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_1029;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_1030;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1031;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_1032;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1033;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1034;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, double, empty, empty> type_ffv_1035;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, std::vector<double>, empty, empty> type_ffv_1036;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1037;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, fvar<fvar<var> >, empty, empty> type_ffv_1038;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1039;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1040;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, double, empty, empty> type_ffv_1041;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_1042;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1043;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_1044;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1045;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1046;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_1047;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_1048;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1049;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_1050;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1051;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1052;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, double, empty, empty> type_ffv_1053;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_1054;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1055;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_1056;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1057;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1058;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_1059;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_1060;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1061;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_1062;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1063;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1064;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_1065;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_1066;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1067;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_1068;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1069;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1070;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty> type_ffv_1071;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_ffv_1072;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1073;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_1074;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1075;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1076;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_ffv_1077;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_1078;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1079;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_1080;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1081;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1082;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_1083;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_1084;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1085;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_1086;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1087;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1088;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_1089;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_1090;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1091;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_1092;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1093;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1094;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_1095;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_1096;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1097;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_1098;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1099;
+
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1000> AgradCdfParetoType2_ffv_1000;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1001> AgradCdfParetoType2_ffv_1001;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1002> AgradCdfParetoType2_ffv_1002;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1003> AgradCdfParetoType2_ffv_1003;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1004> AgradCdfParetoType2_ffv_1004;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1005> AgradCdfParetoType2_ffv_1005;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1006> AgradCdfParetoType2_ffv_1006;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1007> AgradCdfParetoType2_ffv_1007;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1008> AgradCdfParetoType2_ffv_1008;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1009> AgradCdfParetoType2_ffv_1009;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1010> AgradCdfParetoType2_ffv_1010;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1011> AgradCdfParetoType2_ffv_1011;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1012> AgradCdfParetoType2_ffv_1012;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1013> AgradCdfParetoType2_ffv_1013;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1014> AgradCdfParetoType2_ffv_1014;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1015> AgradCdfParetoType2_ffv_1015;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1016> AgradCdfParetoType2_ffv_1016;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1017> AgradCdfParetoType2_ffv_1017;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1018> AgradCdfParetoType2_ffv_1018;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1019> AgradCdfParetoType2_ffv_1019;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1020> AgradCdfParetoType2_ffv_1020;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1021> AgradCdfParetoType2_ffv_1021;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1022> AgradCdfParetoType2_ffv_1022;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1023> AgradCdfParetoType2_ffv_1023;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1024> AgradCdfParetoType2_ffv_1024;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1025> AgradCdfParetoType2_ffv_1025;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1026> AgradCdfParetoType2_ffv_1026;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1027> AgradCdfParetoType2_ffv_1027;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1028> AgradCdfParetoType2_ffv_1028;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1029> AgradCdfParetoType2_ffv_1029;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1030> AgradCdfParetoType2_ffv_1030;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1031> AgradCdfParetoType2_ffv_1031;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1032> AgradCdfParetoType2_ffv_1032;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1033> AgradCdfParetoType2_ffv_1033;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1034> AgradCdfParetoType2_ffv_1034;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1035> AgradCdfParetoType2_ffv_1035;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1036> AgradCdfParetoType2_ffv_1036;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1037> AgradCdfParetoType2_ffv_1037;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1038> AgradCdfParetoType2_ffv_1038;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1039> AgradCdfParetoType2_ffv_1039;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1040> AgradCdfParetoType2_ffv_1040;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1041> AgradCdfParetoType2_ffv_1041;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1042> AgradCdfParetoType2_ffv_1042;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1043> AgradCdfParetoType2_ffv_1043;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1044> AgradCdfParetoType2_ffv_1044;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1045> AgradCdfParetoType2_ffv_1045;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1046> AgradCdfParetoType2_ffv_1046;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1047> AgradCdfParetoType2_ffv_1047;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1048> AgradCdfParetoType2_ffv_1048;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1049> AgradCdfParetoType2_ffv_1049;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1050> AgradCdfParetoType2_ffv_1050;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1051> AgradCdfParetoType2_ffv_1051;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1052> AgradCdfParetoType2_ffv_1052;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1053> AgradCdfParetoType2_ffv_1053;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1054> AgradCdfParetoType2_ffv_1054;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1055> AgradCdfParetoType2_ffv_1055;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1056> AgradCdfParetoType2_ffv_1056;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1057> AgradCdfParetoType2_ffv_1057;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1058> AgradCdfParetoType2_ffv_1058;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1059> AgradCdfParetoType2_ffv_1059;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1060> AgradCdfParetoType2_ffv_1060;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1061> AgradCdfParetoType2_ffv_1061;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1062> AgradCdfParetoType2_ffv_1062;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1063> AgradCdfParetoType2_ffv_1063;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1064> AgradCdfParetoType2_ffv_1064;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1065> AgradCdfParetoType2_ffv_1065;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1066> AgradCdfParetoType2_ffv_1066;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1067> AgradCdfParetoType2_ffv_1067;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1068> AgradCdfParetoType2_ffv_1068;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1069> AgradCdfParetoType2_ffv_1069;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1070> AgradCdfParetoType2_ffv_1070;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1071> AgradCdfParetoType2_ffv_1071;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1072> AgradCdfParetoType2_ffv_1072;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1073> AgradCdfParetoType2_ffv_1073;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1074> AgradCdfParetoType2_ffv_1074;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1075> AgradCdfParetoType2_ffv_1075;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1076> AgradCdfParetoType2_ffv_1076;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1077> AgradCdfParetoType2_ffv_1077;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1078> AgradCdfParetoType2_ffv_1078;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1079> AgradCdfParetoType2_ffv_1079;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1080> AgradCdfParetoType2_ffv_1080;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1081> AgradCdfParetoType2_ffv_1081;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1082> AgradCdfParetoType2_ffv_1082;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1083> AgradCdfParetoType2_ffv_1083;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1084> AgradCdfParetoType2_ffv_1084;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1085> AgradCdfParetoType2_ffv_1085;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1086> AgradCdfParetoType2_ffv_1086;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1087> AgradCdfParetoType2_ffv_1087;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1088> AgradCdfParetoType2_ffv_1088;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1089> AgradCdfParetoType2_ffv_1089;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1090> AgradCdfParetoType2_ffv_1090;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1091> AgradCdfParetoType2_ffv_1091;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1092> AgradCdfParetoType2_ffv_1092;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1093> AgradCdfParetoType2_ffv_1093;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1094> AgradCdfParetoType2_ffv_1094;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1095> AgradCdfParetoType2_ffv_1095;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1096> AgradCdfParetoType2_ffv_1096;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1097> AgradCdfParetoType2_ffv_1097;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1098> AgradCdfParetoType2_ffv_1098;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1099> AgradCdfParetoType2_ffv_1099;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1000, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1000);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1001, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1001);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1002, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1002);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1003, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1003);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1004, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1004);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1005, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1005);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1006, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1006);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1007, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1007);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1008, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1008);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1009, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1009);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1010, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1010);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1011, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1011);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1012, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1012);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1013, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1013);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1014, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1014);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1015, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1015);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1016, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1016);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1017, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1017);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1018, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1018);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1019, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1019);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1020, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1020);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1021, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1021);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1022, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1022);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1023, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1023);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1024, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1024);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1025, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1025);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1026, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1026);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1027, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1027);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1028, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1028);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1029, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1029);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1030, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1030);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1031, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1031);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1032, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1032);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1033, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1033);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1034, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1034);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1035, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1035);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1036, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1036);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1037, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1037);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1038, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1038);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1039, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1039);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1040, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1040);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1041, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1041);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1042, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1042);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1043, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1043);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1044, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1044);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1045, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1045);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1046, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1046);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1047, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1047);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1048, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1048);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1049, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1049);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1050, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1050);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1051, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1051);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1052, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1052);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1053, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1053);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1054, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1054);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1055, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1055);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1056, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1056);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1057, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1057);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1058, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1058);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1059, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1059);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1060, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1060);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1061, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1061);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1062, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1062);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1063, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1063);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1064, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1064);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1065, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1065);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1066, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1066);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1067, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1067);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1068, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1068);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1069, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1069);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1070, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1070);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1071, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1071);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1072, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1072);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1073, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1073);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1074, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1074);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1075, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1075);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1076, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1076);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1077, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1077);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1078, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1078);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1079, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1079);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1080, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1080);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1081, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1081);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1082, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1082);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1083, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1083);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1084, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1084);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1085, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1085);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1086, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1086);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1087, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1087);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1088, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1088);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1089, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1089);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1090, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1090);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1091, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1091);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1092, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1092);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1093, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1093);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1094, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1094);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1095, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1095);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1096, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1096);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1097, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1097);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1098, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1098);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1099, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1099);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_cdf_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1100;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_1101;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_1102;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1103;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_1104;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1105;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1106;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, double, empty, empty> type_ffv_1107;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, std::vector<double>, empty, empty> type_ffv_1108;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1109;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, fvar<fvar<var> >, empty, empty> type_ffv_1110;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1111;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1112;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, double, empty, empty> type_ffv_1113;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty, empty> type_ffv_1114;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1115;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_1116;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1117;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1118;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_1119;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_1120;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1121;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_1122;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1123;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1124;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, double, empty, empty> type_ffv_1125;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_1126;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1127;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_1128;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1129;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1130;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_1131;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_1132;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1133;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_1134;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1135;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1136;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_1137;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_1138;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1139;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_1140;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1141;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1142;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, double, empty, empty> type_ffv_1143;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty, empty> type_ffv_1144;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1145;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty, empty> type_ffv_1146;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1147;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1148;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty, empty> type_ffv_1149;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_1150;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1151;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_1152;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1153;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1154;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_1155;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_1156;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1157;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_1158;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1159;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1160;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty, empty> type_ffv_1161;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_1162;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1163;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_1164;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1165;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1166;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_1167;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_1168;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1169;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_1170;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1171;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1172;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_1173;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_1174;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1175;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_1176;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1177;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1178;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty, empty> type_ffv_1179;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_ffv_1180;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1181;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_1182;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1183;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1184;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_ffv_1185;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_1186;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1187;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_1188;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1189;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1190;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_1191;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_1192;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1193;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_1194;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1195;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1196;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_1197;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_1198;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1199;
+
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1100> AgradCdfParetoType2_ffv_1100;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1101> AgradCdfParetoType2_ffv_1101;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1102> AgradCdfParetoType2_ffv_1102;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1103> AgradCdfParetoType2_ffv_1103;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1104> AgradCdfParetoType2_ffv_1104;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1105> AgradCdfParetoType2_ffv_1105;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1106> AgradCdfParetoType2_ffv_1106;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1107> AgradCdfParetoType2_ffv_1107;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1108> AgradCdfParetoType2_ffv_1108;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1109> AgradCdfParetoType2_ffv_1109;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1110> AgradCdfParetoType2_ffv_1110;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1111> AgradCdfParetoType2_ffv_1111;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1112> AgradCdfParetoType2_ffv_1112;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1113> AgradCdfParetoType2_ffv_1113;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1114> AgradCdfParetoType2_ffv_1114;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1115> AgradCdfParetoType2_ffv_1115;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1116> AgradCdfParetoType2_ffv_1116;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1117> AgradCdfParetoType2_ffv_1117;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1118> AgradCdfParetoType2_ffv_1118;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1119> AgradCdfParetoType2_ffv_1119;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1120> AgradCdfParetoType2_ffv_1120;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1121> AgradCdfParetoType2_ffv_1121;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1122> AgradCdfParetoType2_ffv_1122;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1123> AgradCdfParetoType2_ffv_1123;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1124> AgradCdfParetoType2_ffv_1124;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1125> AgradCdfParetoType2_ffv_1125;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1126> AgradCdfParetoType2_ffv_1126;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1127> AgradCdfParetoType2_ffv_1127;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1128> AgradCdfParetoType2_ffv_1128;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1129> AgradCdfParetoType2_ffv_1129;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1130> AgradCdfParetoType2_ffv_1130;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1131> AgradCdfParetoType2_ffv_1131;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1132> AgradCdfParetoType2_ffv_1132;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1133> AgradCdfParetoType2_ffv_1133;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1134> AgradCdfParetoType2_ffv_1134;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1135> AgradCdfParetoType2_ffv_1135;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1136> AgradCdfParetoType2_ffv_1136;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1137> AgradCdfParetoType2_ffv_1137;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1138> AgradCdfParetoType2_ffv_1138;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1139> AgradCdfParetoType2_ffv_1139;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1140> AgradCdfParetoType2_ffv_1140;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1141> AgradCdfParetoType2_ffv_1141;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1142> AgradCdfParetoType2_ffv_1142;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1143> AgradCdfParetoType2_ffv_1143;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1144> AgradCdfParetoType2_ffv_1144;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1145> AgradCdfParetoType2_ffv_1145;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1146> AgradCdfParetoType2_ffv_1146;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1147> AgradCdfParetoType2_ffv_1147;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1148> AgradCdfParetoType2_ffv_1148;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1149> AgradCdfParetoType2_ffv_1149;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1150> AgradCdfParetoType2_ffv_1150;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1151> AgradCdfParetoType2_ffv_1151;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1152> AgradCdfParetoType2_ffv_1152;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1153> AgradCdfParetoType2_ffv_1153;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1154> AgradCdfParetoType2_ffv_1154;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1155> AgradCdfParetoType2_ffv_1155;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1156> AgradCdfParetoType2_ffv_1156;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1157> AgradCdfParetoType2_ffv_1157;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1158> AgradCdfParetoType2_ffv_1158;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1159> AgradCdfParetoType2_ffv_1159;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1160> AgradCdfParetoType2_ffv_1160;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1161> AgradCdfParetoType2_ffv_1161;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1162> AgradCdfParetoType2_ffv_1162;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1163> AgradCdfParetoType2_ffv_1163;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1164> AgradCdfParetoType2_ffv_1164;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1165> AgradCdfParetoType2_ffv_1165;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1166> AgradCdfParetoType2_ffv_1166;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1167> AgradCdfParetoType2_ffv_1167;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1168> AgradCdfParetoType2_ffv_1168;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1169> AgradCdfParetoType2_ffv_1169;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1170> AgradCdfParetoType2_ffv_1170;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1171> AgradCdfParetoType2_ffv_1171;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1172> AgradCdfParetoType2_ffv_1172;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1173> AgradCdfParetoType2_ffv_1173;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1174> AgradCdfParetoType2_ffv_1174;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1175> AgradCdfParetoType2_ffv_1175;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1176> AgradCdfParetoType2_ffv_1176;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1177> AgradCdfParetoType2_ffv_1177;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1178> AgradCdfParetoType2_ffv_1178;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1179> AgradCdfParetoType2_ffv_1179;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1180> AgradCdfParetoType2_ffv_1180;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1181> AgradCdfParetoType2_ffv_1181;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1182> AgradCdfParetoType2_ffv_1182;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1183> AgradCdfParetoType2_ffv_1183;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1184> AgradCdfParetoType2_ffv_1184;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1185> AgradCdfParetoType2_ffv_1185;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1186> AgradCdfParetoType2_ffv_1186;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1187> AgradCdfParetoType2_ffv_1187;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1188> AgradCdfParetoType2_ffv_1188;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1189> AgradCdfParetoType2_ffv_1189;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1190> AgradCdfParetoType2_ffv_1190;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1191> AgradCdfParetoType2_ffv_1191;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1192> AgradCdfParetoType2_ffv_1192;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1193> AgradCdfParetoType2_ffv_1193;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1194> AgradCdfParetoType2_ffv_1194;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1195> AgradCdfParetoType2_ffv_1195;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1196> AgradCdfParetoType2_ffv_1196;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1197> AgradCdfParetoType2_ffv_1197;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1198> AgradCdfParetoType2_ffv_1198;
+typedef std::tuple<AgradCdfParetoType2, type_ffv_1199> AgradCdfParetoType2_ffv_1199;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1100, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1101, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1102, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1103, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1104, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1105, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1106, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1107, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1108, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1109, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1110, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1111, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1112, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1113, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1114, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1115, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1116, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1117, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1118, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1119, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1120, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1121, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1122, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1123, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1124, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1125, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1126, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1127, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1128, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1129, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1130, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1131, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1132, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1133, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1134, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1135, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1136, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1137, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1138, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1139, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1140, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1141, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1142, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1143, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1144, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1145, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1146, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1147, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1148, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1149, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1150, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1151, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1152, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1153, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1154, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1155, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1156, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1157, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1158, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1159, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1160, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1161, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1162, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1163, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1164, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1165, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1166, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1167, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1168, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1169, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1170, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1171, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1172, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1173, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1174, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1175, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1176, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1177, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1178, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1179, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1180, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1181, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1182, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1183, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1184, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1185, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1186, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1187, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1188, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1188);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1189, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1189);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1190, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1190);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1191, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1191);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1192, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1192);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1193, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1193);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1194, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1194);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1195, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1195);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1196, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1196);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1197, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1197);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1198, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1198);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_ffv_1199, AgradCdfTestFixture, AgradCdfParetoType2_ffv_1199);
+
@@ -0,0 +1,299 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_cdf_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_1200;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_1201;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1202;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_1203;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_1204;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1205;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, double, empty, empty> type_v_1206;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, std::vector<double>, empty, empty> type_v_1207;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1208;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, var, empty, empty> type_v_1209;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, std::vector<var>, empty, empty> type_v_1210;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1211;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, double, empty, empty> type_v_1212;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, std::vector<double>, empty, empty> type_v_1213;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1214;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, var, empty, empty> type_v_1215;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, std::vector<var>, empty, empty> type_v_1216;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1217;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_1218;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_1219;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1220;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_1221;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_1222;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1223;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, double, empty, empty> type_v_1224;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, std::vector<double>, empty, empty> type_v_1225;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1226;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, var, empty, empty> type_v_1227;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, std::vector<var>, empty, empty> type_v_1228;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1229;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, double, empty, empty> type_v_1230;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_v_1231;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1232;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, var, empty, empty> type_v_1233;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_v_1234;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1235;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_1236;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_1237;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1238;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_1239;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_1240;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1241;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, double, empty, empty> type_v_1242;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, std::vector<double>, empty, empty> type_v_1243;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1244;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, var, empty, empty> type_v_1245;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, std::vector<var>, empty, empty> type_v_1246;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1247;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, double, empty, empty> type_v_1248;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_v_1249;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1250;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, var, empty, empty> type_v_1251;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_v_1252;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1253;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_1254;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_1255;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1256;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_1257;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_1258;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1259;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_1260;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_1261;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1262;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_1263;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_1264;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1265;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_1266;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_1267;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1268;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_1269;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_1270;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1271;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_1272;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_1273;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1274;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_1275;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_1276;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1277;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_1278;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_1279;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1280;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_1281;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_1282;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1283;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_1284;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_1285;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1286;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_1287;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_1288;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1289;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_1290;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_1291;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1292;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_1293;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_1294;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1295;
+
+typedef std::tuple<AgradCdfParetoType2, type_v_1200> AgradCdfParetoType2_v_1200;
+typedef std::tuple<AgradCdfParetoType2, type_v_1201> AgradCdfParetoType2_v_1201;
+typedef std::tuple<AgradCdfParetoType2, type_v_1202> AgradCdfParetoType2_v_1202;
+typedef std::tuple<AgradCdfParetoType2, type_v_1203> AgradCdfParetoType2_v_1203;
+typedef std::tuple<AgradCdfParetoType2, type_v_1204> AgradCdfParetoType2_v_1204;
+typedef std::tuple<AgradCdfParetoType2, type_v_1205> AgradCdfParetoType2_v_1205;
+typedef std::tuple<AgradCdfParetoType2, type_v_1206> AgradCdfParetoType2_v_1206;
+typedef std::tuple<AgradCdfParetoType2, type_v_1207> AgradCdfParetoType2_v_1207;
+typedef std::tuple<AgradCdfParetoType2, type_v_1208> AgradCdfParetoType2_v_1208;
+typedef std::tuple<AgradCdfParetoType2, type_v_1209> AgradCdfParetoType2_v_1209;
+typedef std::tuple<AgradCdfParetoType2, type_v_1210> AgradCdfParetoType2_v_1210;
+typedef std::tuple<AgradCdfParetoType2, type_v_1211> AgradCdfParetoType2_v_1211;
+typedef std::tuple<AgradCdfParetoType2, type_v_1212> AgradCdfParetoType2_v_1212;
+typedef std::tuple<AgradCdfParetoType2, type_v_1213> AgradCdfParetoType2_v_1213;
+typedef std::tuple<AgradCdfParetoType2, type_v_1214> AgradCdfParetoType2_v_1214;
+typedef std::tuple<AgradCdfParetoType2, type_v_1215> AgradCdfParetoType2_v_1215;
+typedef std::tuple<AgradCdfParetoType2, type_v_1216> AgradCdfParetoType2_v_1216;
+typedef std::tuple<AgradCdfParetoType2, type_v_1217> AgradCdfParetoType2_v_1217;
+typedef std::tuple<AgradCdfParetoType2, type_v_1218> AgradCdfParetoType2_v_1218;
+typedef std::tuple<AgradCdfParetoType2, type_v_1219> AgradCdfParetoType2_v_1219;
+typedef std::tuple<AgradCdfParetoType2, type_v_1220> AgradCdfParetoType2_v_1220;
+typedef std::tuple<AgradCdfParetoType2, type_v_1221> AgradCdfParetoType2_v_1221;
+typedef std::tuple<AgradCdfParetoType2, type_v_1222> AgradCdfParetoType2_v_1222;
+typedef std::tuple<AgradCdfParetoType2, type_v_1223> AgradCdfParetoType2_v_1223;
+typedef std::tuple<AgradCdfParetoType2, type_v_1224> AgradCdfParetoType2_v_1224;
+typedef std::tuple<AgradCdfParetoType2, type_v_1225> AgradCdfParetoType2_v_1225;
+typedef std::tuple<AgradCdfParetoType2, type_v_1226> AgradCdfParetoType2_v_1226;
+typedef std::tuple<AgradCdfParetoType2, type_v_1227> AgradCdfParetoType2_v_1227;
+typedef std::tuple<AgradCdfParetoType2, type_v_1228> AgradCdfParetoType2_v_1228;
+typedef std::tuple<AgradCdfParetoType2, type_v_1229> AgradCdfParetoType2_v_1229;
+typedef std::tuple<AgradCdfParetoType2, type_v_1230> AgradCdfParetoType2_v_1230;
+typedef std::tuple<AgradCdfParetoType2, type_v_1231> AgradCdfParetoType2_v_1231;
+typedef std::tuple<AgradCdfParetoType2, type_v_1232> AgradCdfParetoType2_v_1232;
+typedef std::tuple<AgradCdfParetoType2, type_v_1233> AgradCdfParetoType2_v_1233;
+typedef std::tuple<AgradCdfParetoType2, type_v_1234> AgradCdfParetoType2_v_1234;
+typedef std::tuple<AgradCdfParetoType2, type_v_1235> AgradCdfParetoType2_v_1235;
+typedef std::tuple<AgradCdfParetoType2, type_v_1236> AgradCdfParetoType2_v_1236;
+typedef std::tuple<AgradCdfParetoType2, type_v_1237> AgradCdfParetoType2_v_1237;
+typedef std::tuple<AgradCdfParetoType2, type_v_1238> AgradCdfParetoType2_v_1238;
+typedef std::tuple<AgradCdfParetoType2, type_v_1239> AgradCdfParetoType2_v_1239;
+typedef std::tuple<AgradCdfParetoType2, type_v_1240> AgradCdfParetoType2_v_1240;
+typedef std::tuple<AgradCdfParetoType2, type_v_1241> AgradCdfParetoType2_v_1241;
+typedef std::tuple<AgradCdfParetoType2, type_v_1242> AgradCdfParetoType2_v_1242;
+typedef std::tuple<AgradCdfParetoType2, type_v_1243> AgradCdfParetoType2_v_1243;
+typedef std::tuple<AgradCdfParetoType2, type_v_1244> AgradCdfParetoType2_v_1244;
+typedef std::tuple<AgradCdfParetoType2, type_v_1245> AgradCdfParetoType2_v_1245;
+typedef std::tuple<AgradCdfParetoType2, type_v_1246> AgradCdfParetoType2_v_1246;
+typedef std::tuple<AgradCdfParetoType2, type_v_1247> AgradCdfParetoType2_v_1247;
+typedef std::tuple<AgradCdfParetoType2, type_v_1248> AgradCdfParetoType2_v_1248;
+typedef std::tuple<AgradCdfParetoType2, type_v_1249> AgradCdfParetoType2_v_1249;
+typedef std::tuple<AgradCdfParetoType2, type_v_1250> AgradCdfParetoType2_v_1250;
+typedef std::tuple<AgradCdfParetoType2, type_v_1251> AgradCdfParetoType2_v_1251;
+typedef std::tuple<AgradCdfParetoType2, type_v_1252> AgradCdfParetoType2_v_1252;
+typedef std::tuple<AgradCdfParetoType2, type_v_1253> AgradCdfParetoType2_v_1253;
+typedef std::tuple<AgradCdfParetoType2, type_v_1254> AgradCdfParetoType2_v_1254;
+typedef std::tuple<AgradCdfParetoType2, type_v_1255> AgradCdfParetoType2_v_1255;
+typedef std::tuple<AgradCdfParetoType2, type_v_1256> AgradCdfParetoType2_v_1256;
+typedef std::tuple<AgradCdfParetoType2, type_v_1257> AgradCdfParetoType2_v_1257;
+typedef std::tuple<AgradCdfParetoType2, type_v_1258> AgradCdfParetoType2_v_1258;
+typedef std::tuple<AgradCdfParetoType2, type_v_1259> AgradCdfParetoType2_v_1259;
+typedef std::tuple<AgradCdfParetoType2, type_v_1260> AgradCdfParetoType2_v_1260;
+typedef std::tuple<AgradCdfParetoType2, type_v_1261> AgradCdfParetoType2_v_1261;
+typedef std::tuple<AgradCdfParetoType2, type_v_1262> AgradCdfParetoType2_v_1262;
+typedef std::tuple<AgradCdfParetoType2, type_v_1263> AgradCdfParetoType2_v_1263;
+typedef std::tuple<AgradCdfParetoType2, type_v_1264> AgradCdfParetoType2_v_1264;
+typedef std::tuple<AgradCdfParetoType2, type_v_1265> AgradCdfParetoType2_v_1265;
+typedef std::tuple<AgradCdfParetoType2, type_v_1266> AgradCdfParetoType2_v_1266;
+typedef std::tuple<AgradCdfParetoType2, type_v_1267> AgradCdfParetoType2_v_1267;
+typedef std::tuple<AgradCdfParetoType2, type_v_1268> AgradCdfParetoType2_v_1268;
+typedef std::tuple<AgradCdfParetoType2, type_v_1269> AgradCdfParetoType2_v_1269;
+typedef std::tuple<AgradCdfParetoType2, type_v_1270> AgradCdfParetoType2_v_1270;
+typedef std::tuple<AgradCdfParetoType2, type_v_1271> AgradCdfParetoType2_v_1271;
+typedef std::tuple<AgradCdfParetoType2, type_v_1272> AgradCdfParetoType2_v_1272;
+typedef std::tuple<AgradCdfParetoType2, type_v_1273> AgradCdfParetoType2_v_1273;
+typedef std::tuple<AgradCdfParetoType2, type_v_1274> AgradCdfParetoType2_v_1274;
+typedef std::tuple<AgradCdfParetoType2, type_v_1275> AgradCdfParetoType2_v_1275;
+typedef std::tuple<AgradCdfParetoType2, type_v_1276> AgradCdfParetoType2_v_1276;
+typedef std::tuple<AgradCdfParetoType2, type_v_1277> AgradCdfParetoType2_v_1277;
+typedef std::tuple<AgradCdfParetoType2, type_v_1278> AgradCdfParetoType2_v_1278;
+typedef std::tuple<AgradCdfParetoType2, type_v_1279> AgradCdfParetoType2_v_1279;
+typedef std::tuple<AgradCdfParetoType2, type_v_1280> AgradCdfParetoType2_v_1280;
+typedef std::tuple<AgradCdfParetoType2, type_v_1281> AgradCdfParetoType2_v_1281;
+typedef std::tuple<AgradCdfParetoType2, type_v_1282> AgradCdfParetoType2_v_1282;
+typedef std::tuple<AgradCdfParetoType2, type_v_1283> AgradCdfParetoType2_v_1283;
+typedef std::tuple<AgradCdfParetoType2, type_v_1284> AgradCdfParetoType2_v_1284;
+typedef std::tuple<AgradCdfParetoType2, type_v_1285> AgradCdfParetoType2_v_1285;
+typedef std::tuple<AgradCdfParetoType2, type_v_1286> AgradCdfParetoType2_v_1286;
+typedef std::tuple<AgradCdfParetoType2, type_v_1287> AgradCdfParetoType2_v_1287;
+typedef std::tuple<AgradCdfParetoType2, type_v_1288> AgradCdfParetoType2_v_1288;
+typedef std::tuple<AgradCdfParetoType2, type_v_1289> AgradCdfParetoType2_v_1289;
+typedef std::tuple<AgradCdfParetoType2, type_v_1290> AgradCdfParetoType2_v_1290;
+typedef std::tuple<AgradCdfParetoType2, type_v_1291> AgradCdfParetoType2_v_1291;
+typedef std::tuple<AgradCdfParetoType2, type_v_1292> AgradCdfParetoType2_v_1292;
+typedef std::tuple<AgradCdfParetoType2, type_v_1293> AgradCdfParetoType2_v_1293;
+typedef std::tuple<AgradCdfParetoType2, type_v_1294> AgradCdfParetoType2_v_1294;
+typedef std::tuple<AgradCdfParetoType2, type_v_1295> AgradCdfParetoType2_v_1295;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_1200, AgradCdfTestFixture, AgradCdfParetoType2_v_1200);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_1201, AgradCdfTestFixture, AgradCdfParetoType2_v_1201);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_1202, AgradCdfTestFixture, AgradCdfParetoType2_v_1202);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_1203, AgradCdfTestFixture, AgradCdfParetoType2_v_1203);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_1204, AgradCdfTestFixture, AgradCdfParetoType2_v_1204);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_1205, AgradCdfTestFixture, AgradCdfParetoType2_v_1205);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_1206, AgradCdfTestFixture, AgradCdfParetoType2_v_1206);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_1207, AgradCdfTestFixture, AgradCdfParetoType2_v_1207);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_1208, AgradCdfTestFixture, AgradCdfParetoType2_v_1208);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_1209, AgradCdfTestFixture, AgradCdfParetoType2_v_1209);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_1210, AgradCdfTestFixture, AgradCdfParetoType2_v_1210);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_1211, AgradCdfTestFixture, AgradCdfParetoType2_v_1211);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_1212, AgradCdfTestFixture, AgradCdfParetoType2_v_1212);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_1213, AgradCdfTestFixture, AgradCdfParetoType2_v_1213);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_1214, AgradCdfTestFixture, AgradCdfParetoType2_v_1214);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_1215, AgradCdfTestFixture, AgradCdfParetoType2_v_1215);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_1216, AgradCdfTestFixture, AgradCdfParetoType2_v_1216);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_1217, AgradCdfTestFixture, AgradCdfParetoType2_v_1217);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_1218, AgradCdfTestFixture, AgradCdfParetoType2_v_1218);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_1219, AgradCdfTestFixture, AgradCdfParetoType2_v_1219);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_1220, AgradCdfTestFixture, AgradCdfParetoType2_v_1220);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_1221, AgradCdfTestFixture, AgradCdfParetoType2_v_1221);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_1222, AgradCdfTestFixture, AgradCdfParetoType2_v_1222);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_1223, AgradCdfTestFixture, AgradCdfParetoType2_v_1223);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_1224, AgradCdfTestFixture, AgradCdfParetoType2_v_1224);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_1225, AgradCdfTestFixture, AgradCdfParetoType2_v_1225);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_1226, AgradCdfTestFixture, AgradCdfParetoType2_v_1226);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_1227, AgradCdfTestFixture, AgradCdfParetoType2_v_1227);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_1228, AgradCdfTestFixture, AgradCdfParetoType2_v_1228);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_1229, AgradCdfTestFixture, AgradCdfParetoType2_v_1229);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_1230, AgradCdfTestFixture, AgradCdfParetoType2_v_1230);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_1231, AgradCdfTestFixture, AgradCdfParetoType2_v_1231);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_1232, AgradCdfTestFixture, AgradCdfParetoType2_v_1232);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_1233, AgradCdfTestFixture, AgradCdfParetoType2_v_1233);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_1234, AgradCdfTestFixture, AgradCdfParetoType2_v_1234);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_1235, AgradCdfTestFixture, AgradCdfParetoType2_v_1235);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_1236, AgradCdfTestFixture, AgradCdfParetoType2_v_1236);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_1237, AgradCdfTestFixture, AgradCdfParetoType2_v_1237);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_1238, AgradCdfTestFixture, AgradCdfParetoType2_v_1238);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_1239, AgradCdfTestFixture, AgradCdfParetoType2_v_1239);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_1240, AgradCdfTestFixture, AgradCdfParetoType2_v_1240);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_1241, AgradCdfTestFixture, AgradCdfParetoType2_v_1241);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_1242, AgradCdfTestFixture, AgradCdfParetoType2_v_1242);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_1243, AgradCdfTestFixture, AgradCdfParetoType2_v_1243);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_1244, AgradCdfTestFixture, AgradCdfParetoType2_v_1244);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_1245, AgradCdfTestFixture, AgradCdfParetoType2_v_1245);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_1246, AgradCdfTestFixture, AgradCdfParetoType2_v_1246);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_1247, AgradCdfTestFixture, AgradCdfParetoType2_v_1247);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_1248, AgradCdfTestFixture, AgradCdfParetoType2_v_1248);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_1249, AgradCdfTestFixture, AgradCdfParetoType2_v_1249);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_1250, AgradCdfTestFixture, AgradCdfParetoType2_v_1250);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_1251, AgradCdfTestFixture, AgradCdfParetoType2_v_1251);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_1252, AgradCdfTestFixture, AgradCdfParetoType2_v_1252);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_1253, AgradCdfTestFixture, AgradCdfParetoType2_v_1253);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_1254, AgradCdfTestFixture, AgradCdfParetoType2_v_1254);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_1255, AgradCdfTestFixture, AgradCdfParetoType2_v_1255);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_1256, AgradCdfTestFixture, AgradCdfParetoType2_v_1256);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_1257, AgradCdfTestFixture, AgradCdfParetoType2_v_1257);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_1258, AgradCdfTestFixture, AgradCdfParetoType2_v_1258);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_1259, AgradCdfTestFixture, AgradCdfParetoType2_v_1259);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_1260, AgradCdfTestFixture, AgradCdfParetoType2_v_1260);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_1261, AgradCdfTestFixture, AgradCdfParetoType2_v_1261);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_1262, AgradCdfTestFixture, AgradCdfParetoType2_v_1262);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_1263, AgradCdfTestFixture, AgradCdfParetoType2_v_1263);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_1264, AgradCdfTestFixture, AgradCdfParetoType2_v_1264);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_1265, AgradCdfTestFixture, AgradCdfParetoType2_v_1265);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_1266, AgradCdfTestFixture, AgradCdfParetoType2_v_1266);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_1267, AgradCdfTestFixture, AgradCdfParetoType2_v_1267);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_1268, AgradCdfTestFixture, AgradCdfParetoType2_v_1268);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_1269, AgradCdfTestFixture, AgradCdfParetoType2_v_1269);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_1270, AgradCdfTestFixture, AgradCdfParetoType2_v_1270);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_1271, AgradCdfTestFixture, AgradCdfParetoType2_v_1271);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_1272, AgradCdfTestFixture, AgradCdfParetoType2_v_1272);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_1273, AgradCdfTestFixture, AgradCdfParetoType2_v_1273);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_1274, AgradCdfTestFixture, AgradCdfParetoType2_v_1274);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_1275, AgradCdfTestFixture, AgradCdfParetoType2_v_1275);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_1276, AgradCdfTestFixture, AgradCdfParetoType2_v_1276);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_1277, AgradCdfTestFixture, AgradCdfParetoType2_v_1277);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_1278, AgradCdfTestFixture, AgradCdfParetoType2_v_1278);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_1279, AgradCdfTestFixture, AgradCdfParetoType2_v_1279);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_1280, AgradCdfTestFixture, AgradCdfParetoType2_v_1280);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_1281, AgradCdfTestFixture, AgradCdfParetoType2_v_1281);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_1282, AgradCdfTestFixture, AgradCdfParetoType2_v_1282);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_1283, AgradCdfTestFixture, AgradCdfParetoType2_v_1283);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_1284, AgradCdfTestFixture, AgradCdfParetoType2_v_1284);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_1285, AgradCdfTestFixture, AgradCdfParetoType2_v_1285);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_1286, AgradCdfTestFixture, AgradCdfParetoType2_v_1286);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_1287, AgradCdfTestFixture, AgradCdfParetoType2_v_1287);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_1288, AgradCdfTestFixture, AgradCdfParetoType2_v_1288);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_1289, AgradCdfTestFixture, AgradCdfParetoType2_v_1289);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_1290, AgradCdfTestFixture, AgradCdfParetoType2_v_1290);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_1291, AgradCdfTestFixture, AgradCdfParetoType2_v_1291);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_1292, AgradCdfTestFixture, AgradCdfParetoType2_v_1292);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_1293, AgradCdfTestFixture, AgradCdfParetoType2_v_1293);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_1294, AgradCdfTestFixture, AgradCdfParetoType2_v_1294);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfParetoType2_v_1295, AgradCdfTestFixture, AgradCdfParetoType2_v_1295);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_cdf_log_test.hpp>
+
+typedef std::tuple<double, double, double, fvar<fvar<var> >, empty, empty> type_ffv_0;
+typedef std::tuple<double, double, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1;
+typedef std::tuple<double, double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_2;
+typedef std::tuple<double, double, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_3;
+typedef std::tuple<double, double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_4;
+typedef std::tuple<double, double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_5;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_6;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_7;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_8;
+typedef std::tuple<double, double, fvar<fvar<var> >, double, empty, empty> type_ffv_9;
+typedef std::tuple<double, double, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_10;
+typedef std::tuple<double, double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_11;
+typedef std::tuple<double, double, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_12;
+typedef std::tuple<double, double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_13;
+typedef std::tuple<double, double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_14;
+typedef std::tuple<double, double, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_15;
+typedef std::tuple<double, double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_16;
+typedef std::tuple<double, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_17;
+typedef std::tuple<double, double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_18;
+typedef std::tuple<double, double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_19;
+typedef std::tuple<double, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_20;
+typedef std::tuple<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_21;
+typedef std::tuple<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_22;
+typedef std::tuple<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_23;
+typedef std::tuple<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_24;
+typedef std::tuple<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_25;
+typedef std::tuple<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_26;
+typedef std::tuple<double, std::vector<double>, double, fvar<fvar<var> >, empty, empty> type_ffv_27;
+typedef std::tuple<double, std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_28;
+typedef std::tuple<double, std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_29;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_30;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_31;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_32;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_33;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_34;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_35;
+typedef std::tuple<double, std::vector<double>, fvar<fvar<var> >, double, empty, empty> type_ffv_36;
+typedef std::tuple<double, std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_37;
+typedef std::tuple<double, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_38;
+typedef std::tuple<double, std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_39;
+typedef std::tuple<double, std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_40;
+typedef std::tuple<double, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_41;
+typedef std::tuple<double, std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_42;
+typedef std::tuple<double, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_43;
+typedef std::tuple<double, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_44;
+typedef std::tuple<double, std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_45;
+typedef std::tuple<double, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_46;
+typedef std::tuple<double, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_47;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_48;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_49;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_50;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_51;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_52;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_53;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_54;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_55;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_56;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_57;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_58;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_59;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_60;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_61;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_62;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_63;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_64;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_65;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_66;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_67;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_68;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_69;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_70;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_71;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_72;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_73;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_74;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_75;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_76;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_77;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_78;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_79;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_80;
+typedef std::tuple<double, fvar<fvar<var> >, double, double, empty, empty> type_ffv_81;
+typedef std::tuple<double, fvar<fvar<var> >, double, std::vector<double>, empty, empty> type_ffv_82;
+typedef std::tuple<double, fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_83;
+typedef std::tuple<double, fvar<fvar<var> >, double, fvar<fvar<var> >, empty, empty> type_ffv_84;
+typedef std::tuple<double, fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_85;
+typedef std::tuple<double, fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_86;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<double>, double, empty, empty> type_ffv_87;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty, empty> type_ffv_88;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_89;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_90;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_91;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_92;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_93;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_94;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_95;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_96;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_97;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_98;
+typedef std::tuple<double, fvar<fvar<var> >, fvar<fvar<var> >, double, empty, empty> type_ffv_99;
+
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_0> AgradCdfLogParetoType2_ffv_0;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_1> AgradCdfLogParetoType2_ffv_1;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_2> AgradCdfLogParetoType2_ffv_2;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_3> AgradCdfLogParetoType2_ffv_3;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_4> AgradCdfLogParetoType2_ffv_4;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_5> AgradCdfLogParetoType2_ffv_5;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_6> AgradCdfLogParetoType2_ffv_6;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_7> AgradCdfLogParetoType2_ffv_7;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_8> AgradCdfLogParetoType2_ffv_8;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_9> AgradCdfLogParetoType2_ffv_9;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_10> AgradCdfLogParetoType2_ffv_10;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_11> AgradCdfLogParetoType2_ffv_11;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_12> AgradCdfLogParetoType2_ffv_12;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_13> AgradCdfLogParetoType2_ffv_13;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_14> AgradCdfLogParetoType2_ffv_14;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_15> AgradCdfLogParetoType2_ffv_15;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_16> AgradCdfLogParetoType2_ffv_16;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_17> AgradCdfLogParetoType2_ffv_17;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_18> AgradCdfLogParetoType2_ffv_18;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_19> AgradCdfLogParetoType2_ffv_19;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_20> AgradCdfLogParetoType2_ffv_20;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_21> AgradCdfLogParetoType2_ffv_21;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_22> AgradCdfLogParetoType2_ffv_22;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_23> AgradCdfLogParetoType2_ffv_23;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_24> AgradCdfLogParetoType2_ffv_24;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_25> AgradCdfLogParetoType2_ffv_25;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_26> AgradCdfLogParetoType2_ffv_26;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_27> AgradCdfLogParetoType2_ffv_27;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_28> AgradCdfLogParetoType2_ffv_28;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_29> AgradCdfLogParetoType2_ffv_29;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_30> AgradCdfLogParetoType2_ffv_30;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_31> AgradCdfLogParetoType2_ffv_31;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_32> AgradCdfLogParetoType2_ffv_32;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_33> AgradCdfLogParetoType2_ffv_33;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_34> AgradCdfLogParetoType2_ffv_34;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_35> AgradCdfLogParetoType2_ffv_35;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_36> AgradCdfLogParetoType2_ffv_36;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_37> AgradCdfLogParetoType2_ffv_37;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_38> AgradCdfLogParetoType2_ffv_38;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_39> AgradCdfLogParetoType2_ffv_39;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_40> AgradCdfLogParetoType2_ffv_40;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_41> AgradCdfLogParetoType2_ffv_41;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_42> AgradCdfLogParetoType2_ffv_42;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_43> AgradCdfLogParetoType2_ffv_43;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_44> AgradCdfLogParetoType2_ffv_44;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_45> AgradCdfLogParetoType2_ffv_45;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_46> AgradCdfLogParetoType2_ffv_46;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_47> AgradCdfLogParetoType2_ffv_47;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_48> AgradCdfLogParetoType2_ffv_48;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_49> AgradCdfLogParetoType2_ffv_49;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_50> AgradCdfLogParetoType2_ffv_50;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_51> AgradCdfLogParetoType2_ffv_51;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_52> AgradCdfLogParetoType2_ffv_52;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_53> AgradCdfLogParetoType2_ffv_53;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_54> AgradCdfLogParetoType2_ffv_54;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_55> AgradCdfLogParetoType2_ffv_55;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_56> AgradCdfLogParetoType2_ffv_56;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_57> AgradCdfLogParetoType2_ffv_57;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_58> AgradCdfLogParetoType2_ffv_58;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_59> AgradCdfLogParetoType2_ffv_59;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_60> AgradCdfLogParetoType2_ffv_60;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_61> AgradCdfLogParetoType2_ffv_61;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_62> AgradCdfLogParetoType2_ffv_62;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_63> AgradCdfLogParetoType2_ffv_63;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_64> AgradCdfLogParetoType2_ffv_64;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_65> AgradCdfLogParetoType2_ffv_65;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_66> AgradCdfLogParetoType2_ffv_66;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_67> AgradCdfLogParetoType2_ffv_67;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_68> AgradCdfLogParetoType2_ffv_68;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_69> AgradCdfLogParetoType2_ffv_69;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_70> AgradCdfLogParetoType2_ffv_70;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_71> AgradCdfLogParetoType2_ffv_71;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_72> AgradCdfLogParetoType2_ffv_72;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_73> AgradCdfLogParetoType2_ffv_73;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_74> AgradCdfLogParetoType2_ffv_74;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_75> AgradCdfLogParetoType2_ffv_75;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_76> AgradCdfLogParetoType2_ffv_76;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_77> AgradCdfLogParetoType2_ffv_77;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_78> AgradCdfLogParetoType2_ffv_78;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_79> AgradCdfLogParetoType2_ffv_79;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_80> AgradCdfLogParetoType2_ffv_80;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_81> AgradCdfLogParetoType2_ffv_81;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_82> AgradCdfLogParetoType2_ffv_82;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_83> AgradCdfLogParetoType2_ffv_83;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_84> AgradCdfLogParetoType2_ffv_84;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_85> AgradCdfLogParetoType2_ffv_85;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_86> AgradCdfLogParetoType2_ffv_86;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_87> AgradCdfLogParetoType2_ffv_87;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_88> AgradCdfLogParetoType2_ffv_88;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_89> AgradCdfLogParetoType2_ffv_89;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_90> AgradCdfLogParetoType2_ffv_90;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_91> AgradCdfLogParetoType2_ffv_91;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_92> AgradCdfLogParetoType2_ffv_92;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_93> AgradCdfLogParetoType2_ffv_93;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_94> AgradCdfLogParetoType2_ffv_94;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_95> AgradCdfLogParetoType2_ffv_95;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_96> AgradCdfLogParetoType2_ffv_96;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_97> AgradCdfLogParetoType2_ffv_97;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_98> AgradCdfLogParetoType2_ffv_98;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_99> AgradCdfLogParetoType2_ffv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_0, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_1, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_2, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_3, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_4, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_5, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_6, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_7, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_8, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_9, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_10, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_11, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_12, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_13, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_14, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_15, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_16, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_17, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_18, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_19, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_20, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_21, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_22, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_23, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_24, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_25, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_26, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_27, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_28, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_29, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_30, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_31, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_32, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_33, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_34, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_35, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_36, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_37, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_38, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_39, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_40, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_41, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_42, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_43, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_44, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_45, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_46, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_47, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_48, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_49, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_50, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_51, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_52, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_53, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_54, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_55, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_56, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_57, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_58, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_59, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_60, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_61, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_62, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_63, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_64, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_65, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_66, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_67, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_68, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_69, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_70, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_71, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_72, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_73, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_74, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_75, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_76, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_77, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_78, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_79, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_80, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_81, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_82, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_83, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_84, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_85, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_86, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_87, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_88, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_89, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_90, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_91, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_92, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_93, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_94, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_95, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_96, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_97, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_98, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_99, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_99);
+
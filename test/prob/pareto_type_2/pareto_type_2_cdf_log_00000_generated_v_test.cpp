@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_cdf_log_test.hpp>
+
+typedef std::tuple<double, double, double, double, empty, empty> type_v_0;
+typedef std::tuple<double, double, double, std::vector<double>, empty, empty> type_v_1;
+typedef std::tuple<double, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_2;
+typedef std::tuple<double, double, double, var, empty, empty> type_v_3;
+typedef std::tuple<double, double, double, std::vector<var>, empty, empty> type_v_4;
+typedef std::tuple<double, double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_5;
+typedef std::tuple<double, double, std::vector<double>, double, empty, empty> type_v_6;
+typedef std::tuple<double, double, std::vector<double>, std::vector<double>, empty, empty> type_v_7;
+typedef std::tuple<double, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_8;
+typedef std::tuple<double, double, std::vector<double>, var, empty, empty> type_v_9;
+typedef std::tuple<double, double, std::vector<double>, std::vector<var>, empty, empty> type_v_10;
+typedef std::tuple<double, double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_11;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_12;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_13;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_14;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_15;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_16;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_17;
+typedef std::tuple<double, double, var, double, empty, empty> type_v_18;
+typedef std::tuple<double, double, var, std::vector<double>, empty, empty> type_v_19;
+typedef std::tuple<double, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_20;
+typedef std::tuple<double, double, var, var, empty, empty> type_v_21;
+typedef std::tuple<double, double, var, std::vector<var>, empty, empty> type_v_22;
+typedef std::tuple<double, double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_23;
+typedef std::tuple<double, double, std::vector<var>, double, empty, empty> type_v_24;
+typedef std::tuple<double, double, std::vector<var>, std::vector<double>, empty, empty> type_v_25;
+typedef std::tuple<double, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_26;
+typedef std::tuple<double, double, std::vector<var>, var, empty, empty> type_v_27;
+typedef std::tuple<double, double, std::vector<var>, std::vector<var>, empty, empty> type_v_28;
+typedef std::tuple<double, double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_29;
+typedef std::tuple<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_30;
+typedef std::tuple<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_31;
+typedef std::tuple<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_32;
+typedef std::tuple<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_33;
+typedef std::tuple<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_34;
+typedef std::tuple<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_35;
+typedef std::tuple<double, std::vector<double>, double, double, empty, empty> type_v_36;
+typedef std::tuple<double, std::vector<double>, double, std::vector<double>, empty, empty> type_v_37;
+typedef std::tuple<double, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_38;
+typedef std::tuple<double, std::vector<double>, double, var, empty, empty> type_v_39;
+typedef std::tuple<double, std::vector<double>, double, std::vector<var>, empty, empty> type_v_40;
+typedef std::tuple<double, std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_41;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, double, empty, empty> type_v_42;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, std::vector<double>, empty, empty> type_v_43;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_44;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, var, empty, empty> type_v_45;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_v_46;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_47;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_48;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_49;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_50;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_51;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_52;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_53;
+typedef std::tuple<double, std::vector<double>, var, double, empty, empty> type_v_54;
+typedef std::tuple<double, std::vector<double>, var, std::vector<double>, empty, empty> type_v_55;
+typedef std::tuple<double, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_56;
+typedef std::tuple<double, std::vector<double>, var, var, empty, empty> type_v_57;
+typedef std::tuple<double, std::vector<double>, var, std::vector<var>, empty, empty> type_v_58;
+typedef std::tuple<double, std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_59;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, double, empty, empty> type_v_60;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_v_61;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_62;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, var, empty, empty> type_v_63;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_v_64;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_65;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_66;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_67;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_68;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_69;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_70;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_71;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_72;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_73;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_74;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_75;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_76;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_77;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_78;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_79;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_80;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_81;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_82;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_83;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_84;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_85;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_86;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_87;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_88;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_89;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_90;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_91;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_92;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_93;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_94;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_95;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_96;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_97;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_98;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_99;
+
+typedef std::tuple<AgradCdfLogParetoType2, type_v_0> AgradCdfLogParetoType2_v_0;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_1> AgradCdfLogParetoType2_v_1;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_2> AgradCdfLogParetoType2_v_2;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_3> AgradCdfLogParetoType2_v_3;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_4> AgradCdfLogParetoType2_v_4;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_5> AgradCdfLogParetoType2_v_5;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_6> AgradCdfLogParetoType2_v_6;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_7> AgradCdfLogParetoType2_v_7;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_8> AgradCdfLogParetoType2_v_8;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_9> AgradCdfLogParetoType2_v_9;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_10> AgradCdfLogParetoType2_v_10;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_11> AgradCdfLogParetoType2_v_11;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_12> AgradCdfLogParetoType2_v_12;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_13> AgradCdfLogParetoType2_v_13;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_14> AgradCdfLogParetoType2_v_14;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_15> AgradCdfLogParetoType2_v_15;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_16> AgradCdfLogParetoType2_v_16;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_17> AgradCdfLogParetoType2_v_17;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_18> AgradCdfLogParetoType2_v_18;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_19> AgradCdfLogParetoType2_v_19;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_20> AgradCdfLogParetoType2_v_20;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_21> AgradCdfLogParetoType2_v_21;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_22> AgradCdfLogParetoType2_v_22;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_23> AgradCdfLogParetoType2_v_23;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_24> AgradCdfLogParetoType2_v_24;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_25> AgradCdfLogParetoType2_v_25;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_26> AgradCdfLogParetoType2_v_26;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_27> AgradCdfLogParetoType2_v_27;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_28> AgradCdfLogParetoType2_v_28;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_29> AgradCdfLogParetoType2_v_29;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_30> AgradCdfLogParetoType2_v_30;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_31> AgradCdfLogParetoType2_v_31;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_32> AgradCdfLogParetoType2_v_32;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_33> AgradCdfLogParetoType2_v_33;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_34> AgradCdfLogParetoType2_v_34;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_35> AgradCdfLogParetoType2_v_35;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_36> AgradCdfLogParetoType2_v_36;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_37> AgradCdfLogParetoType2_v_37;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_38> AgradCdfLogParetoType2_v_38;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_39> AgradCdfLogParetoType2_v_39;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_40> AgradCdfLogParetoType2_v_40;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_41> AgradCdfLogParetoType2_v_41;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_42> AgradCdfLogParetoType2_v_42;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_43> AgradCdfLogParetoType2_v_43;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_44> AgradCdfLogParetoType2_v_44;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_45> AgradCdfLogParetoType2_v_45;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_46> AgradCdfLogParetoType2_v_46;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_47> AgradCdfLogParetoType2_v_47;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_48> AgradCdfLogParetoType2_v_48;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_49> AgradCdfLogParetoType2_v_49;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_50> AgradCdfLogParetoType2_v_50;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_51> AgradCdfLogParetoType2_v_51;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_52> AgradCdfLogParetoType2_v_52;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_53> AgradCdfLogParetoType2_v_53;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_54> AgradCdfLogParetoType2_v_54;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_55> AgradCdfLogParetoType2_v_55;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_56> AgradCdfLogParetoType2_v_56;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_57> AgradCdfLogParetoType2_v_57;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_58> AgradCdfLogParetoType2_v_58;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_59> AgradCdfLogParetoType2_v_59;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_60> AgradCdfLogParetoType2_v_60;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_61> AgradCdfLogParetoType2_v_61;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_62> AgradCdfLogParetoType2_v_62;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_63> AgradCdfLogParetoType2_v_63;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_64> AgradCdfLogParetoType2_v_64;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_65> AgradCdfLogParetoType2_v_65;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_66> AgradCdfLogParetoType2_v_66;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_67> AgradCdfLogParetoType2_v_67;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_68> AgradCdfLogParetoType2_v_68;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_69> AgradCdfLogParetoType2_v_69;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_70> AgradCdfLogParetoType2_v_70;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_71> AgradCdfLogParetoType2_v_71;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_72> AgradCdfLogParetoType2_v_72;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_73> AgradCdfLogParetoType2_v_73;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_74> AgradCdfLogParetoType2_v_74;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_75> AgradCdfLogParetoType2_v_75;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_76> AgradCdfLogParetoType2_v_76;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_77> AgradCdfLogParetoType2_v_77;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_78> AgradCdfLogParetoType2_v_78;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_79> AgradCdfLogParetoType2_v_79;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_80> AgradCdfLogParetoType2_v_80;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_81> AgradCdfLogParetoType2_v_81;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_82> AgradCdfLogParetoType2_v_82;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_83> AgradCdfLogParetoType2_v_83;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_84> AgradCdfLogParetoType2_v_84;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_85> AgradCdfLogParetoType2_v_85;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_86> AgradCdfLogParetoType2_v_86;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_87> AgradCdfLogParetoType2_v_87;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_88> AgradCdfLogParetoType2_v_88;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_89> AgradCdfLogParetoType2_v_89;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_90> AgradCdfLogParetoType2_v_90;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_91> AgradCdfLogParetoType2_v_91;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_92> AgradCdfLogParetoType2_v_92;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_93> AgradCdfLogParetoType2_v_93;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_94> AgradCdfLogParetoType2_v_94;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_95> AgradCdfLogParetoType2_v_95;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_96> AgradCdfLogParetoType2_v_96;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_97> AgradCdfLogParetoType2_v_97;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_98> AgradCdfLogParetoType2_v_98;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_99> AgradCdfLogParetoType2_v_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_0, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_1, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_2, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_3, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_4, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_5, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_6, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_7, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_8, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_9, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_10, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_11, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_12, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_13, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_14, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_15, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_16, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_17, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_18, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_19, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_20, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_21, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_22, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_23, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_24, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_25, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_26, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_27, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_28, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_29, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_30, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_31, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_32, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_33, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_34, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_35, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_36, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_37, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_38, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_39, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_40, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_41, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_42, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_43, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_44, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_45, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_46, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_47, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_48, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_49, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_50, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_51, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_52, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_53, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_54, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_55, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_56, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_57, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_58, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_59, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_60, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_61, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_62, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_63, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_64, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_65, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_66, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_67, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_68, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_69, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_70, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_71, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_72, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_73, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_74, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_75, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_76, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_77, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_78, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_79, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_80, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_81, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_82, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_83, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_84, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_85, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_86, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_87, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_88, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_89, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_90, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_91, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_92, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_93, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_94, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_95, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_96, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_97, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_98, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_99, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_99);
+
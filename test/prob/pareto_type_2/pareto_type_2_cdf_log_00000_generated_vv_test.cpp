@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_cdf_log_test.hpp>
+
+typedef std::tuple<double, double, double, var, empty, empty> type_vv_0;
+typedef std::tuple<double, double, double, std::vector<var>, empty, empty> type_vv_1;
+typedef std::tuple<double, double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_2;
+typedef std::tuple<double, double, std::vector<double>, var, empty, empty> type_vv_3;
+typedef std::tuple<double, double, std::vector<double>, std::vector<var>, empty, empty> type_vv_4;
+typedef std::tuple<double, double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_5;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_6;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_7;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_8;
+typedef std::tuple<double, double, var, double, empty, empty> type_vv_9;
+typedef std::tuple<double, double, var, std::vector<double>, empty, empty> type_vv_10;
+typedef std::tuple<double, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_11;
+typedef std::tuple<double, double, var, var, empty, empty> type_vv_12;
+typedef std::tuple<double, double, var, std::vector<var>, empty, empty> type_vv_13;
+typedef std::tuple<double, double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_14;
+typedef std::tuple<double, double, std::vector<var>, double, empty, empty> type_vv_15;
+typedef std::tuple<double, double, std::vector<var>, std::vector<double>, empty, empty> type_vv_16;
+typedef std::tuple<double, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_17;
+typedef std::tuple<double, double, std::vector<var>, var, empty, empty> type_vv_18;
+typedef std::tuple<double, double, std::vector<var>, std::vector<var>, empty, empty> type_vv_19;
+typedef std::tuple<double, double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_20;
+typedef std::tuple<double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_21;
+typedef std::tuple<double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_22;
+typedef std::tuple<double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_23;
+typedef std::tuple<double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_24;
+typedef std::tuple<double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_25;
+typedef std::tuple<double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_26;
+typedef std::tuple<double, std::vector<double>, double, var, empty, empty> type_vv_27;
+typedef std::tuple<double, std::vector<double>, double, std::vector<var>, empty, empty> type_vv_28;
+typedef std::tuple<double, std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_29;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, var, empty, empty> type_vv_30;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_vv_31;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_32;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_33;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_34;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_35;
+typedef std::tuple<double, std::vector<double>, var, double, empty, empty> type_vv_36;
+typedef std::tuple<double, std::vector<double>, var, std::vector<double>, empty, empty> type_vv_37;
+typedef std::tuple<double, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_38;
+typedef std::tuple<double, std::vector<double>, var, var, empty, empty> type_vv_39;
+typedef std::tuple<double, std::vector<double>, var, std::vector<var>, empty, empty> type_vv_40;
+typedef std::tuple<double, std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_41;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, double, empty, empty> type_vv_42;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_vv_43;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_44;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, var, empty, empty> type_vv_45;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_vv_46;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_47;
+typedef std::tuple<double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_48;
+typedef std::tuple<double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_49;
+typedef std::tuple<double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_50;
+typedef std::tuple<double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_51;
+typedef std::tuple<double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_52;
+typedef std::tuple<double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_53;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_vv_54;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_vv_55;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_56;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_vv_57;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_vv_58;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_59;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_60;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_61;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_62;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_vv_63;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_vv_64;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_65;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_vv_66;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_vv_67;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_68;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_vv_69;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_vv_70;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_71;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_vv_72;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_vv_73;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_74;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_75;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_76;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_77;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_78;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_79;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_80;
+typedef std::tuple<double, var, double, double, empty, empty> type_vv_81;
+typedef std::tuple<double, var, double, std::vector<double>, empty, empty> type_vv_82;
+typedef std::tuple<double, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_83;
+typedef std::tuple<double, var, double, var, empty, empty> type_vv_84;
+typedef std::tuple<double, var, double, std::vector<var>, empty, empty> type_vv_85;
+typedef std::tuple<double, var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_86;
+typedef std::tuple<double, var, std::vector<double>, double, empty, empty> type_vv_87;
+typedef std::tuple<double, var, std::vector<double>, std::vector<double>, empty, empty> type_vv_88;
+typedef std::tuple<double, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_89;
+typedef std::tuple<double, var, std::vector<double>, var, empty, empty> type_vv_90;
+typedef std::tuple<double, var, std::vector<double>, std::vector<var>, empty, empty> type_vv_91;
+typedef std::tuple<double, var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_92;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_93;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_94;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_95;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_96;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_97;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_98;
+typedef std::tuple<double, var, var, double, empty, empty> type_vv_99;
+
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_0> AgradCdfLogParetoType2_vv_0;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_1> AgradCdfLogParetoType2_vv_1;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_2> AgradCdfLogParetoType2_vv_2;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_3> AgradCdfLogParetoType2_vv_3;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_4> AgradCdfLogParetoType2_vv_4;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_5> AgradCdfLogParetoType2_vv_5;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_6> AgradCdfLogParetoType2_vv_6;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_7> AgradCdfLogParetoType2_vv_7;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_8> AgradCdfLogParetoType2_vv_8;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_9> AgradCdfLogParetoType2_vv_9;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_10> AgradCdfLogParetoType2_vv_10;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_11> AgradCdfLogParetoType2_vv_11;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_12> AgradCdfLogParetoType2_vv_12;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_13> AgradCdfLogParetoType2_vv_13;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_14> AgradCdfLogParetoType2_vv_14;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_15> AgradCdfLogParetoType2_vv_15;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_16> AgradCdfLogParetoType2_vv_16;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_17> AgradCdfLogParetoType2_vv_17;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_18> AgradCdfLogParetoType2_vv_18;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_19> AgradCdfLogParetoType2_vv_19;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_20> AgradCdfLogParetoType2_vv_20;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_21> AgradCdfLogParetoType2_vv_21;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_22> AgradCdfLogParetoType2_vv_22;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_23> AgradCdfLogParetoType2_vv_23;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_24> AgradCdfLogParetoType2_vv_24;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_25> AgradCdfLogParetoType2_vv_25;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_26> AgradCdfLogParetoType2_vv_26;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_27> AgradCdfLogParetoType2_vv_27;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_28> AgradCdfLogParetoType2_vv_28;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_29> AgradCdfLogParetoType2_vv_29;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_30> AgradCdfLogParetoType2_vv_30;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_31> AgradCdfLogParetoType2_vv_31;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_32> AgradCdfLogParetoType2_vv_32;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_33> AgradCdfLogParetoType2_vv_33;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_34> AgradCdfLogParetoType2_vv_34;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_35> AgradCdfLogParetoType2_vv_35;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_36> AgradCdfLogParetoType2_vv_36;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_37> AgradCdfLogParetoType2_vv_37;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_38> AgradCdfLogParetoType2_vv_38;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_39> AgradCdfLogParetoType2_vv_39;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_40> AgradCdfLogParetoType2_vv_40;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_41> AgradCdfLogParetoType2_vv_41;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_42> AgradCdfLogParetoType2_vv_42;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_43> AgradCdfLogParetoType2_vv_43;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_44> AgradCdfLogParetoType2_vv_44;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_45> AgradCdfLogParetoType2_vv_45;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_46> AgradCdfLogParetoType2_vv_46;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_47> AgradCdfLogParetoType2_vv_47;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_48> AgradCdfLogParetoType2_vv_48;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_49> AgradCdfLogParetoType2_vv_49;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_50> AgradCdfLogParetoType2_vv_50;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_51> AgradCdfLogParetoType2_vv_51;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_52> AgradCdfLogParetoType2_vv_52;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_53> AgradCdfLogParetoType2_vv_53;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_54> AgradCdfLogParetoType2_vv_54;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_55> AgradCdfLogParetoType2_vv_55;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_56> AgradCdfLogParetoType2_vv_56;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_57> AgradCdfLogParetoType2_vv_57;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_58> AgradCdfLogParetoType2_vv_58;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_59> AgradCdfLogParetoType2_vv_59;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_60> AgradCdfLogParetoType2_vv_60;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_61> AgradCdfLogParetoType2_vv_61;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_62> AgradCdfLogParetoType2_vv_62;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_63> AgradCdfLogParetoType2_vv_63;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_64> AgradCdfLogParetoType2_vv_64;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_65> AgradCdfLogParetoType2_vv_65;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_66> AgradCdfLogParetoType2_vv_66;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_67> AgradCdfLogParetoType2_vv_67;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_68> AgradCdfLogParetoType2_vv_68;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_69> AgradCdfLogParetoType2_vv_69;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_70> AgradCdfLogParetoType2_vv_70;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_71> AgradCdfLogParetoType2_vv_71;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_72> AgradCdfLogParetoType2_vv_72;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_73> AgradCdfLogParetoType2_vv_73;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_74> AgradCdfLogParetoType2_vv_74;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_75> AgradCdfLogParetoType2_vv_75;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_76> AgradCdfLogParetoType2_vv_76;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_77> AgradCdfLogParetoType2_vv_77;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_78> AgradCdfLogParetoType2_vv_78;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_79> AgradCdfLogParetoType2_vv_79;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_80> AgradCdfLogParetoType2_vv_80;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_81> AgradCdfLogParetoType2_vv_81;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_82> AgradCdfLogParetoType2_vv_82;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_83> AgradCdfLogParetoType2_vv_83;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_84> AgradCdfLogParetoType2_vv_84;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_85> AgradCdfLogParetoType2_vv_85;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_86> AgradCdfLogParetoType2_vv_86;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_87> AgradCdfLogParetoType2_vv_87;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_88> AgradCdfLogParetoType2_vv_88;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_89> AgradCdfLogParetoType2_vv_89;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_90> AgradCdfLogParetoType2_vv_90;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_91> AgradCdfLogParetoType2_vv_91;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_92> AgradCdfLogParetoType2_vv_92;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_93> AgradCdfLogParetoType2_vv_93;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_94> AgradCdfLogParetoType2_vv_94;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_95> AgradCdfLogParetoType2_vv_95;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_96> AgradCdfLogParetoType2_vv_96;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_97> AgradCdfLogParetoType2_vv_97;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_98> AgradCdfLogParetoType2_vv_98;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_99> AgradCdfLogParetoType2_vv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_0, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_1, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_2, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_3, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_4, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_5, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_6, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_7, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_8, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_9, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_10, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_11, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_12, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_13, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_14, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_15, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_16, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_17, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_18, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_19, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_20, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_21, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_22, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_23, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_24, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_25, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_26, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_27, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_28, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_29, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_30, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_31, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_32, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_33, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_34, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_35, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_36, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_37, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_38, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_39, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_40, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_41, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_42, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_43, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_44, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_45, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_46, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_47, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_48, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_49, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_50, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_51, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_52, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_53, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_54, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_55, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_56, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_57, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_58, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_59, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_60, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_61, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_62, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_63, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_64, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_65, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_66, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_67, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_68, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_69, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_70, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_71, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_72, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_73, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_74, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_75, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_76, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_77, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_78, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_79, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_80, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_81, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_82, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_83, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_84, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_85, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_86, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_87, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_88, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_89, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_90, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_91, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_92, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_93, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_94, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_95, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_96, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_97, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_98, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_99, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_99);
+
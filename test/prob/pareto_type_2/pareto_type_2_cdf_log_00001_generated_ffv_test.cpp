@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_cdf_log_test.hpp>
+
+typedef std::tuple<double, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_100;
+typedef std::tuple<double, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_101;
+typedef std::tuple<double, fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_102;
+typedef std::tuple<double, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_103;
+typedef std::tuple<double, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_104;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_105;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_106;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_107;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_108;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_109;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_110;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_111;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_112;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_113;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_114;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_115;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_116;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, double, double, empty, empty> type_ffv_117;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty, empty> type_ffv_118;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_119;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty, empty> type_ffv_120;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_121;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_122;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty, empty> type_ffv_123;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_124;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_125;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_126;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_127;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_128;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_129;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_130;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_131;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_132;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_133;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_134;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty, empty> type_ffv_135;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_136;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_137;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_138;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_139;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_140;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_141;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_142;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_143;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_144;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_145;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_146;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_147;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_148;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_149;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_150;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_151;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_152;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty, empty> type_ffv_153;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_ffv_154;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_155;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_156;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_157;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_158;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_ffv_159;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_160;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_161;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_162;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_163;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_164;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_165;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_166;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_167;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_168;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_169;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_170;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_171;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_172;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_173;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_174;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_175;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_176;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_177;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_178;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_179;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_180;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_181;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_182;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_183;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_184;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_185;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_186;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_187;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_188;
+typedef std::tuple<std::vector<double>, double, double, fvar<fvar<var> >, empty, empty> type_ffv_189;
+typedef std::tuple<std::vector<double>, double, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_190;
+typedef std::tuple<std::vector<double>, double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_191;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_192;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_193;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_194;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_195;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_196;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_197;
+typedef std::tuple<std::vector<double>, double, fvar<fvar<var> >, double, empty, empty> type_ffv_198;
+typedef std::tuple<std::vector<double>, double, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_199;
+
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_100> AgradCdfLogParetoType2_ffv_100;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_101> AgradCdfLogParetoType2_ffv_101;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_102> AgradCdfLogParetoType2_ffv_102;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_103> AgradCdfLogParetoType2_ffv_103;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_104> AgradCdfLogParetoType2_ffv_104;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_105> AgradCdfLogParetoType2_ffv_105;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_106> AgradCdfLogParetoType2_ffv_106;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_107> AgradCdfLogParetoType2_ffv_107;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_108> AgradCdfLogParetoType2_ffv_108;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_109> AgradCdfLogParetoType2_ffv_109;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_110> AgradCdfLogParetoType2_ffv_110;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_111> AgradCdfLogParetoType2_ffv_111;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_112> AgradCdfLogParetoType2_ffv_112;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_113> AgradCdfLogParetoType2_ffv_113;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_114> AgradCdfLogParetoType2_ffv_114;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_115> AgradCdfLogParetoType2_ffv_115;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_116> AgradCdfLogParetoType2_ffv_116;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_117> AgradCdfLogParetoType2_ffv_117;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_118> AgradCdfLogParetoType2_ffv_118;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_119> AgradCdfLogParetoType2_ffv_119;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_120> AgradCdfLogParetoType2_ffv_120;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_121> AgradCdfLogParetoType2_ffv_121;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_122> AgradCdfLogParetoType2_ffv_122;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_123> AgradCdfLogParetoType2_ffv_123;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_124> AgradCdfLogParetoType2_ffv_124;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_125> AgradCdfLogParetoType2_ffv_125;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_126> AgradCdfLogParetoType2_ffv_126;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_127> AgradCdfLogParetoType2_ffv_127;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_128> AgradCdfLogParetoType2_ffv_128;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_129> AgradCdfLogParetoType2_ffv_129;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_130> AgradCdfLogParetoType2_ffv_130;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_131> AgradCdfLogParetoType2_ffv_131;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_132> AgradCdfLogParetoType2_ffv_132;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_133> AgradCdfLogParetoType2_ffv_133;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_134> AgradCdfLogParetoType2_ffv_134;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_135> AgradCdfLogParetoType2_ffv_135;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_136> AgradCdfLogParetoType2_ffv_136;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_137> AgradCdfLogParetoType2_ffv_137;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_138> AgradCdfLogParetoType2_ffv_138;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_139> AgradCdfLogParetoType2_ffv_139;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_140> AgradCdfLogParetoType2_ffv_140;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_141> AgradCdfLogParetoType2_ffv_141;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_142> AgradCdfLogParetoType2_ffv_142;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_143> AgradCdfLogParetoType2_ffv_143;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_144> AgradCdfLogParetoType2_ffv_144;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_145> AgradCdfLogParetoType2_ffv_145;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_146> AgradCdfLogParetoType2_ffv_146;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_147> AgradCdfLogParetoType2_ffv_147;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_148> AgradCdfLogParetoType2_ffv_148;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_149> AgradCdfLogParetoType2_ffv_149;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_150> AgradCdfLogParetoType2_ffv_150;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_151> AgradCdfLogParetoType2_ffv_151;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_152> AgradCdfLogParetoType2_ffv_152;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_153> AgradCdfLogParetoType2_ffv_153;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_154> AgradCdfLogParetoType2_ffv_154;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_155> AgradCdfLogParetoType2_ffv_155;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_156> AgradCdfLogParetoType2_ffv_156;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_157> AgradCdfLogParetoType2_ffv_157;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_158> AgradCdfLogParetoType2_ffv_158;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_159> AgradCdfLogParetoType2_ffv_159;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_160> AgradCdfLogParetoType2_ffv_160;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_161> AgradCdfLogParetoType2_ffv_161;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_162> AgradCdfLogParetoType2_ffv_162;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_163> AgradCdfLogParetoType2_ffv_163;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_164> AgradCdfLogParetoType2_ffv_164;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_165> AgradCdfLogParetoType2_ffv_165;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_166> AgradCdfLogParetoType2_ffv_166;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_167> AgradCdfLogParetoType2_ffv_167;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_168> AgradCdfLogParetoType2_ffv_168;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_169> AgradCdfLogParetoType2_ffv_169;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_170> AgradCdfLogParetoType2_ffv_170;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_171> AgradCdfLogParetoType2_ffv_171;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_172> AgradCdfLogParetoType2_ffv_172;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_173> AgradCdfLogParetoType2_ffv_173;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_174> AgradCdfLogParetoType2_ffv_174;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_175> AgradCdfLogParetoType2_ffv_175;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_176> AgradCdfLogParetoType2_ffv_176;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_177> AgradCdfLogParetoType2_ffv_177;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_178> AgradCdfLogParetoType2_ffv_178;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_179> AgradCdfLogParetoType2_ffv_179;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_180> AgradCdfLogParetoType2_ffv_180;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_181> AgradCdfLogParetoType2_ffv_181;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_182> AgradCdfLogParetoType2_ffv_182;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_183> AgradCdfLogParetoType2_ffv_183;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_184> AgradCdfLogParetoType2_ffv_184;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_185> AgradCdfLogParetoType2_ffv_185;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_186> AgradCdfLogParetoType2_ffv_186;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_187> AgradCdfLogParetoType2_ffv_187;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_188> AgradCdfLogParetoType2_ffv_188;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_189> AgradCdfLogParetoType2_ffv_189;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_190> AgradCdfLogParetoType2_ffv_190;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_191> AgradCdfLogParetoType2_ffv_191;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_192> AgradCdfLogParetoType2_ffv_192;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_193> AgradCdfLogParetoType2_ffv_193;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_194> AgradCdfLogParetoType2_ffv_194;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_195> AgradCdfLogParetoType2_ffv_195;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_196> AgradCdfLogParetoType2_ffv_196;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_197> AgradCdfLogParetoType2_ffv_197;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_198> AgradCdfLogParetoType2_ffv_198;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_199> AgradCdfLogParetoType2_ffv_199;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_100, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_101, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_102, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_103, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_104, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_105, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_106, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_107, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_108, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_109, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_110, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_111, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_112, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_113, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_114, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_115, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_116, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_117, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_118, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_119, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_120, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_121, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_122, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_123, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_124, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_125, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_126, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_127, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_128, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_129, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_130, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_131, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_132, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_133, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_134, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_135, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_136, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_137, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_138, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_139, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_140, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_141, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_142, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_143, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_144, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_145, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_146, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_147, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_148, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_149, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_150, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_151, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_152, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_153, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_154, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_155, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_156, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_157, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_158, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_159, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_160, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_161, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_162, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_163, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_164, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_165, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_166, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_167, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_168, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_169, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_170, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_171, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_172, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_173, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_174, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_175, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_176, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_177, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_178, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_179, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_180, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_181, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_182, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_183, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_184, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_185, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_186, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_187, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_188, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_188);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_189, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_189);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_190, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_190);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_191, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_191);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_192, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_192);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_193, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_193);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_194, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_194);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_195, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_195);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_196, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_196);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_197, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_197);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_198, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_198);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_199, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_199);
+
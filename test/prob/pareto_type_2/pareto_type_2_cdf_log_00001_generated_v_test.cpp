@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_cdf_log_test.hpp>
+
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_100;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_101;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_102;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_103;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_104;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_105;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_106;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_107;
+typedef std::tuple<double, var, double, double, empty, empty> type_v_108;
+typedef std::tuple<double, var, double, std::vector<double>, empty, empty> type_v_109;
+typedef std::tuple<double, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_110;
+typedef std::tuple<double, var, double, var, empty, empty> type_v_111;
+typedef std::tuple<double, var, double, std::vector<var>, empty, empty> type_v_112;
+typedef std::tuple<double, var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_113;
+typedef std::tuple<double, var, std::vector<double>, double, empty, empty> type_v_114;
+typedef std::tuple<double, var, std::vector<double>, std::vector<double>, empty, empty> type_v_115;
+typedef std::tuple<double, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_116;
+typedef std::tuple<double, var, std::vector<double>, var, empty, empty> type_v_117;
+typedef std::tuple<double, var, std::vector<double>, std::vector<var>, empty, empty> type_v_118;
+typedef std::tuple<double, var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_119;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_120;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_121;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_122;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_123;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_124;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_125;
+typedef std::tuple<double, var, var, double, empty, empty> type_v_126;
+typedef std::tuple<double, var, var, std::vector<double>, empty, empty> type_v_127;
+typedef std::tuple<double, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_128;
+typedef std::tuple<double, var, var, var, empty, empty> type_v_129;
+typedef std::tuple<double, var, var, std::vector<var>, empty, empty> type_v_130;
+typedef std::tuple<double, var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_131;
+typedef std::tuple<double, var, std::vector<var>, double, empty, empty> type_v_132;
+typedef std::tuple<double, var, std::vector<var>, std::vector<double>, empty, empty> type_v_133;
+typedef std::tuple<double, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_134;
+typedef std::tuple<double, var, std::vector<var>, var, empty, empty> type_v_135;
+typedef std::tuple<double, var, std::vector<var>, std::vector<var>, empty, empty> type_v_136;
+typedef std::tuple<double, var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_137;
+typedef std::tuple<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_138;
+typedef std::tuple<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_139;
+typedef std::tuple<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_140;
+typedef std::tuple<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_141;
+typedef std::tuple<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_142;
+typedef std::tuple<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_143;
+typedef std::tuple<double, std::vector<var>, double, double, empty, empty> type_v_144;
+typedef std::tuple<double, std::vector<var>, double, std::vector<double>, empty, empty> type_v_145;
+typedef std::tuple<double, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_146;
+typedef std::tuple<double, std::vector<var>, double, var, empty, empty> type_v_147;
+typedef std::tuple<double, std::vector<var>, double, std::vector<var>, empty, empty> type_v_148;
+typedef std::tuple<double, std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_149;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, double, empty, empty> type_v_150;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_v_151;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_152;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, var, empty, empty> type_v_153;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_v_154;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_155;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_156;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_157;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_158;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_159;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_160;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_161;
+typedef std::tuple<double, std::vector<var>, var, double, empty, empty> type_v_162;
+typedef std::tuple<double, std::vector<var>, var, std::vector<double>, empty, empty> type_v_163;
+typedef std::tuple<double, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_164;
+typedef std::tuple<double, std::vector<var>, var, var, empty, empty> type_v_165;
+typedef std::tuple<double, std::vector<var>, var, std::vector<var>, empty, empty> type_v_166;
+typedef std::tuple<double, std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_167;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, double, empty, empty> type_v_168;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_v_169;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_170;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, var, empty, empty> type_v_171;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_v_172;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_173;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_174;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_175;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_176;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_177;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_178;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_179;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_180;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_181;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_182;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_183;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_184;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_185;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_186;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_187;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_188;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_189;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_190;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_191;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_192;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_193;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_194;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_195;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_196;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_197;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_198;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_199;
+
+typedef std::tuple<AgradCdfLogParetoType2, type_v_100> AgradCdfLogParetoType2_v_100;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_101> AgradCdfLogParetoType2_v_101;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_102> AgradCdfLogParetoType2_v_102;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_103> AgradCdfLogParetoType2_v_103;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_104> AgradCdfLogParetoType2_v_104;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_105> AgradCdfLogParetoType2_v_105;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_106> AgradCdfLogParetoType2_v_106;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_107> AgradCdfLogParetoType2_v_107;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_108> AgradCdfLogParetoType2_v_108;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_109> AgradCdfLogParetoType2_v_109;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_110> AgradCdfLogParetoType2_v_110;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_111> AgradCdfLogParetoType2_v_111;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_112> AgradCdfLogParetoType2_v_112;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_113> AgradCdfLogParetoType2_v_113;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_114> AgradCdfLogParetoType2_v_114;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_115> AgradCdfLogParetoType2_v_115;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_116> AgradCdfLogParetoType2_v_116;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_117> AgradCdfLogParetoType2_v_117;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_118> AgradCdfLogParetoType2_v_118;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_119> AgradCdfLogParetoType2_v_119;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_120> AgradCdfLogParetoType2_v_120;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_121> AgradCdfLogParetoType2_v_121;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_122> AgradCdfLogParetoType2_v_122;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_123> AgradCdfLogParetoType2_v_123;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_124> AgradCdfLogParetoType2_v_124;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_125> AgradCdfLogParetoType2_v_125;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_126> AgradCdfLogParetoType2_v_126;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_127> AgradCdfLogParetoType2_v_127;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_128> AgradCdfLogParetoType2_v_128;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_129> AgradCdfLogParetoType2_v_129;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_130> AgradCdfLogParetoType2_v_130;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_131> AgradCdfLogParetoType2_v_131;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_132> AgradCdfLogParetoType2_v_132;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_133> AgradCdfLogParetoType2_v_133;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_134> AgradCdfLogParetoType2_v_134;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_135> AgradCdfLogParetoType2_v_135;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_136> AgradCdfLogParetoType2_v_136;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_137> AgradCdfLogParetoType2_v_137;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_138> AgradCdfLogParetoType2_v_138;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_139> AgradCdfLogParetoType2_v_139;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_140> AgradCdfLogParetoType2_v_140;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_141> AgradCdfLogParetoType2_v_141;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_142> AgradCdfLogParetoType2_v_142;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_143> AgradCdfLogParetoType2_v_143;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_144> AgradCdfLogParetoType2_v_144;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_145> AgradCdfLogParetoType2_v_145;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_146> AgradCdfLogParetoType2_v_146;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_147> AgradCdfLogParetoType2_v_147;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_148> AgradCdfLogParetoType2_v_148;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_149> AgradCdfLogParetoType2_v_149;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_150> AgradCdfLogParetoType2_v_150;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_151> AgradCdfLogParetoType2_v_151;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_152> AgradCdfLogParetoType2_v_152;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_153> AgradCdfLogParetoType2_v_153;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_154> AgradCdfLogParetoType2_v_154;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_155> AgradCdfLogParetoType2_v_155;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_156> AgradCdfLogParetoType2_v_156;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_157> AgradCdfLogParetoType2_v_157;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_158> AgradCdfLogParetoType2_v_158;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_159> AgradCdfLogParetoType2_v_159;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_160> AgradCdfLogParetoType2_v_160;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_161> AgradCdfLogParetoType2_v_161;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_162> AgradCdfLogParetoType2_v_162;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_163> AgradCdfLogParetoType2_v_163;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_164> AgradCdfLogParetoType2_v_164;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_165> AgradCdfLogParetoType2_v_165;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_166> AgradCdfLogParetoType2_v_166;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_167> AgradCdfLogParetoType2_v_167;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_168> AgradCdfLogParetoType2_v_168;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_169> AgradCdfLogParetoType2_v_169;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_170> AgradCdfLogParetoType2_v_170;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_171> AgradCdfLogParetoType2_v_171;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_172> AgradCdfLogParetoType2_v_172;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_173> AgradCdfLogParetoType2_v_173;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_174> AgradCdfLogParetoType2_v_174;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_175> AgradCdfLogParetoType2_v_175;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_176> AgradCdfLogParetoType2_v_176;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_177> AgradCdfLogParetoType2_v_177;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_178> AgradCdfLogParetoType2_v_178;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_179> AgradCdfLogParetoType2_v_179;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_180> AgradCdfLogParetoType2_v_180;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_181> AgradCdfLogParetoType2_v_181;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_182> AgradCdfLogParetoType2_v_182;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_183> AgradCdfLogParetoType2_v_183;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_184> AgradCdfLogParetoType2_v_184;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_185> AgradCdfLogParetoType2_v_185;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_186> AgradCdfLogParetoType2_v_186;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_187> AgradCdfLogParetoType2_v_187;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_188> AgradCdfLogParetoType2_v_188;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_189> AgradCdfLogParetoType2_v_189;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_190> AgradCdfLogParetoType2_v_190;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_191> AgradCdfLogParetoType2_v_191;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_192> AgradCdfLogParetoType2_v_192;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_193> AgradCdfLogParetoType2_v_193;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_194> AgradCdfLogParetoType2_v_194;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_195> AgradCdfLogParetoType2_v_195;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_196> AgradCdfLogParetoType2_v_196;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_197> AgradCdfLogParetoType2_v_197;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_198> AgradCdfLogParetoType2_v_198;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_199> AgradCdfLogParetoType2_v_199;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_100, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_101, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_102, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_103, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_104, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_105, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_106, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_107, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_108, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_109, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_110, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_111, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_112, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_113, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_114, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_115, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_116, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_117, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_118, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_119, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_120, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_121, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_122, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_123, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_124, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_125, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_126, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_127, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_128, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_129, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_130, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_131, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_132, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_133, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_134, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_135, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_136, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_137, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_138, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_139, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_140, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_141, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_142, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_143, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_144, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_145, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_146, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_147, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_148, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_149, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_150, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_151, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_152, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_153, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_154, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_155, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_156, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_157, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_158, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_159, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_160, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_161, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_162, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_163, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_164, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_165, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_166, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_167, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_168, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_169, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_170, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_171, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_172, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_173, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_174, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_175, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_176, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_177, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_178, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_179, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_180, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_181, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_182, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_183, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_184, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_185, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_186, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_187, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_188, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_188);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_189, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_189);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_190, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_190);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_191, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_191);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_192, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_192);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_193, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_193);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_194, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_194);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_195, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_195);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_196, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_196);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_197, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_197);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_198, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_198);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_199, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_199);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_cdf_log_test.hpp>
+
+typedef std::tuple<double, var, var, std::vector<double>, empty, empty> type_vv_100;
+typedef std::tuple<double, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_101;
+typedef std::tuple<double, var, var, var, empty, empty> type_vv_102;
+typedef std::tuple<double, var, var, std::vector<var>, empty, empty> type_vv_103;
+typedef std::tuple<double, var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_104;
+typedef std::tuple<double, var, std::vector<var>, double, empty, empty> type_vv_105;
+typedef std::tuple<double, var, std::vector<var>, std::vector<double>, empty, empty> type_vv_106;
+typedef std::tuple<double, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_107;
+typedef std::tuple<double, var, std::vector<var>, var, empty, empty> type_vv_108;
+typedef std::tuple<double, var, std::vector<var>, std::vector<var>, empty, empty> type_vv_109;
+typedef std::tuple<double, var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_110;
+typedef std::tuple<double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_111;
+typedef std::tuple<double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_112;
+typedef std::tuple<double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_113;
+typedef std::tuple<double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_114;
+typedef std::tuple<double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_115;
+typedef std::tuple<double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_116;
+typedef std::tuple<double, std::vector<var>, double, double, empty, empty> type_vv_117;
+typedef std::tuple<double, std::vector<var>, double, std::vector<double>, empty, empty> type_vv_118;
+typedef std::tuple<double, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_119;
+typedef std::tuple<double, std::vector<var>, double, var, empty, empty> type_vv_120;
+typedef std::tuple<double, std::vector<var>, double, std::vector<var>, empty, empty> type_vv_121;
+typedef std::tuple<double, std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_122;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, double, empty, empty> type_vv_123;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_vv_124;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_125;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, var, empty, empty> type_vv_126;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_vv_127;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_128;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_129;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_130;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_131;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_132;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_133;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_134;
+typedef std::tuple<double, std::vector<var>, var, double, empty, empty> type_vv_135;
+typedef std::tuple<double, std::vector<var>, var, std::vector<double>, empty, empty> type_vv_136;
+typedef std::tuple<double, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_137;
+typedef std::tuple<double, std::vector<var>, var, var, empty, empty> type_vv_138;
+typedef std::tuple<double, std::vector<var>, var, std::vector<var>, empty, empty> type_vv_139;
+typedef std::tuple<double, std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_140;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, double, empty, empty> type_vv_141;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_vv_142;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_143;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, var, empty, empty> type_vv_144;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_vv_145;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_146;
+typedef std::tuple<double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_147;
+typedef std::tuple<double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_148;
+typedef std::tuple<double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_149;
+typedef std::tuple<double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_150;
+typedef std::tuple<double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_151;
+typedef std::tuple<double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_152;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, empty, empty> type_vv_153;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, empty, empty> type_vv_154;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_155;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, empty, empty> type_vv_156;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, empty, empty> type_vv_157;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_158;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, empty, empty> type_vv_159;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, empty, empty> type_vv_160;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_161;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, empty, empty> type_vv_162;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, empty, empty> type_vv_163;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_164;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_165;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_166;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_167;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_168;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_169;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_170;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, empty, empty> type_vv_171;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, empty, empty> type_vv_172;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_173;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, empty, empty> type_vv_174;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, empty, empty> type_vv_175;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_176;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, empty, empty> type_vv_177;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, empty, empty> type_vv_178;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_179;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, empty, empty> type_vv_180;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, empty, empty> type_vv_181;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_182;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_183;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_184;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_185;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_186;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_187;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_188;
+typedef std::tuple<std::vector<double>, double, double, var, empty, empty> type_vv_189;
+typedef std::tuple<std::vector<double>, double, double, std::vector<var>, empty, empty> type_vv_190;
+typedef std::tuple<std::vector<double>, double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_191;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, var, empty, empty> type_vv_192;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, std::vector<var>, empty, empty> type_vv_193;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_194;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_195;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_196;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_197;
+typedef std::tuple<std::vector<double>, double, var, double, empty, empty> type_vv_198;
+typedef std::tuple<std::vector<double>, double, var, std::vector<double>, empty, empty> type_vv_199;
+
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_100> AgradCdfLogParetoType2_vv_100;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_101> AgradCdfLogParetoType2_vv_101;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_102> AgradCdfLogParetoType2_vv_102;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_103> AgradCdfLogParetoType2_vv_103;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_104> AgradCdfLogParetoType2_vv_104;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_105> AgradCdfLogParetoType2_vv_105;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_106> AgradCdfLogParetoType2_vv_106;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_107> AgradCdfLogParetoType2_vv_107;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_108> AgradCdfLogParetoType2_vv_108;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_109> AgradCdfLogParetoType2_vv_109;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_110> AgradCdfLogParetoType2_vv_110;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_111> AgradCdfLogParetoType2_vv_111;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_112> AgradCdfLogParetoType2_vv_112;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_113> AgradCdfLogParetoType2_vv_113;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_114> AgradCdfLogParetoType2_vv_114;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_115> AgradCdfLogParetoType2_vv_115;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_116> AgradCdfLogParetoType2_vv_116;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_117> AgradCdfLogParetoType2_vv_117;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_118> AgradCdfLogParetoType2_vv_118;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_119> AgradCdfLogParetoType2_vv_119;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_120> AgradCdfLogParetoType2_vv_120;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_121> AgradCdfLogParetoType2_vv_121;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_122> AgradCdfLogParetoType2_vv_122;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_123> AgradCdfLogParetoType2_vv_123;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_124> AgradCdfLogParetoType2_vv_124;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_125> AgradCdfLogParetoType2_vv_125;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_126> AgradCdfLogParetoType2_vv_126;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_127> AgradCdfLogParetoType2_vv_127;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_128> AgradCdfLogParetoType2_vv_128;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_129> AgradCdfLogParetoType2_vv_129;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_130> AgradCdfLogParetoType2_vv_130;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_131> AgradCdfLogParetoType2_vv_131;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_132> AgradCdfLogParetoType2_vv_132;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_133> AgradCdfLogParetoType2_vv_133;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_134> AgradCdfLogParetoType2_vv_134;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_135> AgradCdfLogParetoType2_vv_135;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_136> AgradCdfLogParetoType2_vv_136;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_137> AgradCdfLogParetoType2_vv_137;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_138> AgradCdfLogParetoType2_vv_138;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_139> AgradCdfLogParetoType2_vv_139;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_140> AgradCdfLogParetoType2_vv_140;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_141> AgradCdfLogParetoType2_vv_141;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_142> AgradCdfLogParetoType2_vv_142;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_143> AgradCdfLogParetoType2_vv_143;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_144> AgradCdfLogParetoType2_vv_144;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_145> AgradCdfLogParetoType2_vv_145;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_146> AgradCdfLogParetoType2_vv_146;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_147> AgradCdfLogParetoType2_vv_147;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_148> AgradCdfLogParetoType2_vv_148;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_149> AgradCdfLogParetoType2_vv_149;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_150> AgradCdfLogParetoType2_vv_150;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_151> AgradCdfLogParetoType2_vv_151;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_152> AgradCdfLogParetoType2_vv_152;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_153> AgradCdfLogParetoType2_vv_153;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_154> AgradCdfLogParetoType2_vv_154;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_155> AgradCdfLogParetoType2_vv_155;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_156> AgradCdfLogParetoType2_vv_156;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_157> AgradCdfLogParetoType2_vv_157;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_158> AgradCdfLogParetoType2_vv_158;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_159> AgradCdfLogParetoType2_vv_159;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_160> AgradCdfLogParetoType2_vv_160;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_161> AgradCdfLogParetoType2_vv_161;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_162> AgradCdfLogParetoType2_vv_162;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_163> AgradCdfLogParetoType2_vv_163;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_164> AgradCdfLogParetoType2_vv_164;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_165> AgradCdfLogParetoType2_vv_165;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_166> AgradCdfLogParetoType2_vv_166;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_167> AgradCdfLogParetoType2_vv_167;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_168> AgradCdfLogParetoType2_vv_168;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_169> AgradCdfLogParetoType2_vv_169;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_170> AgradCdfLogParetoType2_vv_170;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_171> AgradCdfLogParetoType2_vv_171;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_172> AgradCdfLogParetoType2_vv_172;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_173> AgradCdfLogParetoType2_vv_173;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_174> AgradCdfLogParetoType2_vv_174;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_175> AgradCdfLogParetoType2_vv_175;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_176> AgradCdfLogParetoType2_vv_176;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_177> AgradCdfLogParetoType2_vv_177;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_178> AgradCdfLogParetoType2_vv_178;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_179> AgradCdfLogParetoType2_vv_179;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_180> AgradCdfLogParetoType2_vv_180;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_181> AgradCdfLogParetoType2_vv_181;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_182> AgradCdfLogParetoType2_vv_182;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_183> AgradCdfLogParetoType2_vv_183;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_184> AgradCdfLogParetoType2_vv_184;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_185> AgradCdfLogParetoType2_vv_185;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_186> AgradCdfLogParetoType2_vv_186;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_187> AgradCdfLogParetoType2_vv_187;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_188> AgradCdfLogParetoType2_vv_188;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_189> AgradCdfLogParetoType2_vv_189;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_190> AgradCdfLogParetoType2_vv_190;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_191> AgradCdfLogParetoType2_vv_191;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_192> AgradCdfLogParetoType2_vv_192;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_193> AgradCdfLogParetoType2_vv_193;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_194> AgradCdfLogParetoType2_vv_194;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_195> AgradCdfLogParetoType2_vv_195;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_196> AgradCdfLogParetoType2_vv_196;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_197> AgradCdfLogParetoType2_vv_197;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_198> AgradCdfLogParetoType2_vv_198;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_199> AgradCdfLogParetoType2_vv_199;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_100, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_101, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_102, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_103, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_104, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_105, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_106, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_107, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_108, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_109, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_110, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_111, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_112, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_113, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_114, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_115, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_116, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_117, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_118, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_119, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_120, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_121, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_122, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_123, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_124, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_125, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_126, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_127, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_128, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_129, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_130, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_131, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_132, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_133, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_134, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_135, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_136, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_137, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_138, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_139, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_140, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_141, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_142, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_143, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_144, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_145, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_146, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_147, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_148, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_149, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_150, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_151, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_152, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_153, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_154, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_155, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_156, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_157, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_158, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_159, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_160, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_161, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_162, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_163, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_164, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_165, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_166, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_167, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_168, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_169, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_170, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_171, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_172, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_173, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_174, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_175, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_176, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_177, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_178, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_179, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_180, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_181, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_182, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_183, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_184, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_185, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_186, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_187, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_188, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_188);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_189, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_189);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_190, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_190);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_191, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_191);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_192, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_192);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_193, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_193);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_194, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_194);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_195, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_195);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_196, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_196);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_197, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_197);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_198, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_198);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_199, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_199);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_cdf_log_test.hpp>
+
+typedef std::tuple<std::vector<double>, double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_200;
+typedef std::tuple<std::vector<double>, double, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_201;
+typedef std::tuple<std::vector<double>, double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_202;
+typedef std::tuple<std::vector<double>, double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_203;
+typedef std::tuple<std::vector<double>, double, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_204;
+typedef std::tuple<std::vector<double>, double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_205;
+typedef std::tuple<std::vector<double>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_206;
+typedef std::tuple<std::vector<double>, double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_207;
+typedef std::tuple<std::vector<double>, double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_208;
+typedef std::tuple<std::vector<double>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_209;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_210;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_211;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_212;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_213;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_214;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_215;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, fvar<fvar<var> >, empty, empty> type_ffv_216;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_217;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_218;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_219;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_220;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_221;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_222;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_223;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_224;
+typedef std::tuple<std::vector<double>, std::vector<double>, fvar<fvar<var> >, double, empty, empty> type_ffv_225;
+typedef std::tuple<std::vector<double>, std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_226;
+typedef std::tuple<std::vector<double>, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_227;
+typedef std::tuple<std::vector<double>, std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_228;
+typedef std::tuple<std::vector<double>, std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_229;
+typedef std::tuple<std::vector<double>, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_230;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_231;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_232;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_233;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_234;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_235;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_236;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_237;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_238;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_239;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_240;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_241;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_242;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_243;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_244;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_245;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_246;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_247;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_248;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_249;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_250;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_251;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_252;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_253;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_254;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_255;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_256;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_257;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_258;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_259;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_260;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_261;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_262;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_263;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_264;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_265;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_266;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_267;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_268;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_269;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, double, double, empty, empty> type_ffv_270;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, double, std::vector<double>, empty, empty> type_ffv_271;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_272;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, double, fvar<fvar<var> >, empty, empty> type_ffv_273;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_274;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_275;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<double>, double, empty, empty> type_ffv_276;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty, empty> type_ffv_277;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_278;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_279;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_280;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_281;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_282;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_283;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_284;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_285;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_286;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_287;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, double, empty, empty> type_ffv_288;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_289;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_290;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_291;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_292;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_293;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_294;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_295;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_296;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_297;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_298;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_299;
+
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_200> AgradCdfLogParetoType2_ffv_200;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_201> AgradCdfLogParetoType2_ffv_201;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_202> AgradCdfLogParetoType2_ffv_202;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_203> AgradCdfLogParetoType2_ffv_203;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_204> AgradCdfLogParetoType2_ffv_204;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_205> AgradCdfLogParetoType2_ffv_205;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_206> AgradCdfLogParetoType2_ffv_206;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_207> AgradCdfLogParetoType2_ffv_207;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_208> AgradCdfLogParetoType2_ffv_208;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_209> AgradCdfLogParetoType2_ffv_209;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_210> AgradCdfLogParetoType2_ffv_210;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_211> AgradCdfLogParetoType2_ffv_211;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_212> AgradCdfLogParetoType2_ffv_212;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_213> AgradCdfLogParetoType2_ffv_213;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_214> AgradCdfLogParetoType2_ffv_214;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_215> AgradCdfLogParetoType2_ffv_215;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_216> AgradCdfLogParetoType2_ffv_216;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_217> AgradCdfLogParetoType2_ffv_217;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_218> AgradCdfLogParetoType2_ffv_218;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_219> AgradCdfLogParetoType2_ffv_219;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_220> AgradCdfLogParetoType2_ffv_220;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_221> AgradCdfLogParetoType2_ffv_221;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_222> AgradCdfLogParetoType2_ffv_222;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_223> AgradCdfLogParetoType2_ffv_223;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_224> AgradCdfLogParetoType2_ffv_224;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_225> AgradCdfLogParetoType2_ffv_225;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_226> AgradCdfLogParetoType2_ffv_226;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_227> AgradCdfLogParetoType2_ffv_227;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_228> AgradCdfLogParetoType2_ffv_228;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_229> AgradCdfLogParetoType2_ffv_229;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_230> AgradCdfLogParetoType2_ffv_230;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_231> AgradCdfLogParetoType2_ffv_231;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_232> AgradCdfLogParetoType2_ffv_232;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_233> AgradCdfLogParetoType2_ffv_233;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_234> AgradCdfLogParetoType2_ffv_234;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_235> AgradCdfLogParetoType2_ffv_235;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_236> AgradCdfLogParetoType2_ffv_236;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_237> AgradCdfLogParetoType2_ffv_237;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_238> AgradCdfLogParetoType2_ffv_238;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_239> AgradCdfLogParetoType2_ffv_239;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_240> AgradCdfLogParetoType2_ffv_240;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_241> AgradCdfLogParetoType2_ffv_241;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_242> AgradCdfLogParetoType2_ffv_242;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_243> AgradCdfLogParetoType2_ffv_243;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_244> AgradCdfLogParetoType2_ffv_244;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_245> AgradCdfLogParetoType2_ffv_245;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_246> AgradCdfLogParetoType2_ffv_246;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_247> AgradCdfLogParetoType2_ffv_247;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_248> AgradCdfLogParetoType2_ffv_248;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_249> AgradCdfLogParetoType2_ffv_249;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_250> AgradCdfLogParetoType2_ffv_250;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_251> AgradCdfLogParetoType2_ffv_251;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_252> AgradCdfLogParetoType2_ffv_252;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_253> AgradCdfLogParetoType2_ffv_253;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_254> AgradCdfLogParetoType2_ffv_254;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_255> AgradCdfLogParetoType2_ffv_255;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_256> AgradCdfLogParetoType2_ffv_256;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_257> AgradCdfLogParetoType2_ffv_257;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_258> AgradCdfLogParetoType2_ffv_258;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_259> AgradCdfLogParetoType2_ffv_259;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_260> AgradCdfLogParetoType2_ffv_260;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_261> AgradCdfLogParetoType2_ffv_261;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_262> AgradCdfLogParetoType2_ffv_262;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_263> AgradCdfLogParetoType2_ffv_263;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_264> AgradCdfLogParetoType2_ffv_264;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_265> AgradCdfLogParetoType2_ffv_265;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_266> AgradCdfLogParetoType2_ffv_266;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_267> AgradCdfLogParetoType2_ffv_267;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_268> AgradCdfLogParetoType2_ffv_268;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_269> AgradCdfLogParetoType2_ffv_269;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_270> AgradCdfLogParetoType2_ffv_270;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_271> AgradCdfLogParetoType2_ffv_271;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_272> AgradCdfLogParetoType2_ffv_272;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_273> AgradCdfLogParetoType2_ffv_273;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_274> AgradCdfLogParetoType2_ffv_274;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_275> AgradCdfLogParetoType2_ffv_275;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_276> AgradCdfLogParetoType2_ffv_276;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_277> AgradCdfLogParetoType2_ffv_277;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_278> AgradCdfLogParetoType2_ffv_278;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_279> AgradCdfLogParetoType2_ffv_279;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_280> AgradCdfLogParetoType2_ffv_280;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_281> AgradCdfLogParetoType2_ffv_281;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_282> AgradCdfLogParetoType2_ffv_282;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_283> AgradCdfLogParetoType2_ffv_283;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_284> AgradCdfLogParetoType2_ffv_284;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_285> AgradCdfLogParetoType2_ffv_285;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_286> AgradCdfLogParetoType2_ffv_286;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_287> AgradCdfLogParetoType2_ffv_287;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_288> AgradCdfLogParetoType2_ffv_288;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_289> AgradCdfLogParetoType2_ffv_289;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_290> AgradCdfLogParetoType2_ffv_290;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_291> AgradCdfLogParetoType2_ffv_291;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_292> AgradCdfLogParetoType2_ffv_292;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_293> AgradCdfLogParetoType2_ffv_293;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_294> AgradCdfLogParetoType2_ffv_294;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_295> AgradCdfLogParetoType2_ffv_295;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_296> AgradCdfLogParetoType2_ffv_296;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_297> AgradCdfLogParetoType2_ffv_297;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_298> AgradCdfLogParetoType2_ffv_298;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_299> AgradCdfLogParetoType2_ffv_299;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_200, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_200);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_201, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_201);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_202, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_202);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_203, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_203);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_204, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_204);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_205, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_205);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_206, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_206);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_207, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_207);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_208, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_208);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_209, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_209);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_210, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_210);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_211, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_211);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_212, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_212);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_213, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_213);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_214, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_214);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_215, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_215);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_216, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_216);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_217, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_217);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_218, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_218);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_219, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_219);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_220, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_220);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_221, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_221);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_222, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_222);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_223, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_223);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_224, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_224);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_225, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_225);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_226, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_226);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_227, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_227);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_228, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_228);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_229, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_229);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_230, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_230);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_231, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_231);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_232, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_232);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_233, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_233);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_234, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_234);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_235, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_235);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_236, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_236);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_237, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_237);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_238, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_238);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_239, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_239);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_240, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_240);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_241, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_241);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_242, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_242);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_243, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_243);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_244, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_244);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_245, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_245);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_246, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_246);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_247, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_247);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_248, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_248);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_249, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_249);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_250, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_250);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_251, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_251);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_252, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_252);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_253, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_253);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_254, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_254);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_255, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_255);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_256, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_256);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_257, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_257);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_258, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_258);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_259, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_259);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_260, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_260);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_261, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_261);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_262, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_262);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_263, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_263);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_264, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_264);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_265, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_265);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_266, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_266);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_267, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_267);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_268, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_268);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_269, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_269);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_270, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_270);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_271, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_271);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_272, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_272);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_273, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_273);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_274, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_274);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_275, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_275);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_276, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_276);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_277, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_277);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_278, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_278);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_279, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_279);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_280, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_280);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_281, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_281);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_282, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_282);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_283, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_283);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_284, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_284);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_285, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_285);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_286, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_286);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_287, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_287);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_288, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_288);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_289, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_289);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_290, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_290);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_291, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_291);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_292, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_292);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_293, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_293);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_294, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_294);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_295, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_295);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_296, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_296);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_297, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_297);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_298, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_298);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_299, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_299);
+
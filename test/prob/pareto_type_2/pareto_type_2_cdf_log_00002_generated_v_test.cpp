@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_cdf_log_test.hpp>
+
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_200;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_201;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_202;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_203;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_204;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_205;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_206;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_207;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_208;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_209;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_210;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_211;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_212;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_213;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_214;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_215;
+typedef std::tuple<std::vector<double>, double, double, double, empty, empty> type_v_216;
+typedef std::tuple<std::vector<double>, double, double, std::vector<double>, empty, empty> type_v_217;
+typedef std::tuple<std::vector<double>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_218;
+typedef std::tuple<std::vector<double>, double, double, var, empty, empty> type_v_219;
+typedef std::tuple<std::vector<double>, double, double, std::vector<var>, empty, empty> type_v_220;
+typedef std::tuple<std::vector<double>, double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_221;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, double, empty, empty> type_v_222;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, std::vector<double>, empty, empty> type_v_223;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_224;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, var, empty, empty> type_v_225;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, std::vector<var>, empty, empty> type_v_226;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_227;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_228;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_229;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_230;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_231;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_232;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_233;
+typedef std::tuple<std::vector<double>, double, var, double, empty, empty> type_v_234;
+typedef std::tuple<std::vector<double>, double, var, std::vector<double>, empty, empty> type_v_235;
+typedef std::tuple<std::vector<double>, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_236;
+typedef std::tuple<std::vector<double>, double, var, var, empty, empty> type_v_237;
+typedef std::tuple<std::vector<double>, double, var, std::vector<var>, empty, empty> type_v_238;
+typedef std::tuple<std::vector<double>, double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_239;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, double, empty, empty> type_v_240;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, std::vector<double>, empty, empty> type_v_241;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_242;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, var, empty, empty> type_v_243;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, std::vector<var>, empty, empty> type_v_244;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_245;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_246;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_247;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_248;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_249;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_250;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_251;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, double, empty, empty> type_v_252;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, std::vector<double>, empty, empty> type_v_253;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_254;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, var, empty, empty> type_v_255;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, std::vector<var>, empty, empty> type_v_256;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_257;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, double, empty, empty> type_v_258;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, std::vector<double>, empty, empty> type_v_259;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_260;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, var, empty, empty> type_v_261;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_v_262;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_263;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_264;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_265;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_266;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_267;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_268;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_269;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, double, empty, empty> type_v_270;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, std::vector<double>, empty, empty> type_v_271;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_272;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, var, empty, empty> type_v_273;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, std::vector<var>, empty, empty> type_v_274;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_275;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, double, empty, empty> type_v_276;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_v_277;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_278;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, var, empty, empty> type_v_279;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_v_280;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_281;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_282;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_283;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_284;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_285;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_286;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_287;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_288;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_289;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_290;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_291;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_292;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_293;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_294;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_295;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_296;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_297;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_298;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_299;
+
+typedef std::tuple<AgradCdfLogParetoType2, type_v_200> AgradCdfLogParetoType2_v_200;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_201> AgradCdfLogParetoType2_v_201;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_202> AgradCdfLogParetoType2_v_202;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_203> AgradCdfLogParetoType2_v_203;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_204> AgradCdfLogParetoType2_v_204;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_205> AgradCdfLogParetoType2_v_205;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_206> AgradCdfLogParetoType2_v_206;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_207> AgradCdfLogParetoType2_v_207;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_208> AgradCdfLogParetoType2_v_208;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_209> AgradCdfLogParetoType2_v_209;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_210> AgradCdfLogParetoType2_v_210;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_211> AgradCdfLogParetoType2_v_211;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_212> AgradCdfLogParetoType2_v_212;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_213> AgradCdfLogParetoType2_v_213;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_214> AgradCdfLogParetoType2_v_214;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_215> AgradCdfLogParetoType2_v_215;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_216> AgradCdfLogParetoType2_v_216;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_217> AgradCdfLogParetoType2_v_217;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_218> AgradCdfLogParetoType2_v_218;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_219> AgradCdfLogParetoType2_v_219;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_220> AgradCdfLogParetoType2_v_220;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_221> AgradCdfLogParetoType2_v_221;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_222> AgradCdfLogParetoType2_v_222;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_223> AgradCdfLogParetoType2_v_223;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_224> AgradCdfLogParetoType2_v_224;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_225> AgradCdfLogParetoType2_v_225;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_226> AgradCdfLogParetoType2_v_226;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_227> AgradCdfLogParetoType2_v_227;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_228> AgradCdfLogParetoType2_v_228;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_229> AgradCdfLogParetoType2_v_229;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_230> AgradCdfLogParetoType2_v_230;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_231> AgradCdfLogParetoType2_v_231;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_232> AgradCdfLogParetoType2_v_232;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_233> AgradCdfLogParetoType2_v_233;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_234> AgradCdfLogParetoType2_v_234;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_235> AgradCdfLogParetoType2_v_235;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_236> AgradCdfLogParetoType2_v_236;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_237> AgradCdfLogParetoType2_v_237;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_238> AgradCdfLogParetoType2_v_238;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_239> AgradCdfLogParetoType2_v_239;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_240> AgradCdfLogParetoType2_v_240;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_241> AgradCdfLogParetoType2_v_241;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_242> AgradCdfLogParetoType2_v_242;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_243> AgradCdfLogParetoType2_v_243;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_244> AgradCdfLogParetoType2_v_244;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_245> AgradCdfLogParetoType2_v_245;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_246> AgradCdfLogParetoType2_v_246;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_247> AgradCdfLogParetoType2_v_247;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_248> AgradCdfLogParetoType2_v_248;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_249> AgradCdfLogParetoType2_v_249;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_250> AgradCdfLogParetoType2_v_250;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_251> AgradCdfLogParetoType2_v_251;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_252> AgradCdfLogParetoType2_v_252;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_253> AgradCdfLogParetoType2_v_253;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_254> AgradCdfLogParetoType2_v_254;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_255> AgradCdfLogParetoType2_v_255;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_256> AgradCdfLogParetoType2_v_256;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_257> AgradCdfLogParetoType2_v_257;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_258> AgradCdfLogParetoType2_v_258;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_259> AgradCdfLogParetoType2_v_259;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_260> AgradCdfLogParetoType2_v_260;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_261> AgradCdfLogParetoType2_v_261;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_262> AgradCdfLogParetoType2_v_262;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_263> AgradCdfLogParetoType2_v_263;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_264> AgradCdfLogParetoType2_v_264;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_265> AgradCdfLogParetoType2_v_265;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_266> AgradCdfLogParetoType2_v_266;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_267> AgradCdfLogParetoType2_v_267;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_268> AgradCdfLogParetoType2_v_268;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_269> AgradCdfLogParetoType2_v_269;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_270> AgradCdfLogParetoType2_v_270;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_271> AgradCdfLogParetoType2_v_271;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_272> AgradCdfLogParetoType2_v_272;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_273> AgradCdfLogParetoType2_v_273;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_274> AgradCdfLogParetoType2_v_274;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_275> AgradCdfLogParetoType2_v_275;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_276> AgradCdfLogParetoType2_v_276;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_277> AgradCdfLogParetoType2_v_277;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_278> AgradCdfLogParetoType2_v_278;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_279> AgradCdfLogParetoType2_v_279;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_280> AgradCdfLogParetoType2_v_280;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_281> AgradCdfLogParetoType2_v_281;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_282> AgradCdfLogParetoType2_v_282;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_283> AgradCdfLogParetoType2_v_283;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_284> AgradCdfLogParetoType2_v_284;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_285> AgradCdfLogParetoType2_v_285;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_286> AgradCdfLogParetoType2_v_286;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_287> AgradCdfLogParetoType2_v_287;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_288> AgradCdfLogParetoType2_v_288;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_289> AgradCdfLogParetoType2_v_289;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_290> AgradCdfLogParetoType2_v_290;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_291> AgradCdfLogParetoType2_v_291;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_292> AgradCdfLogParetoType2_v_292;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_293> AgradCdfLogParetoType2_v_293;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_294> AgradCdfLogParetoType2_v_294;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_295> AgradCdfLogParetoType2_v_295;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_296> AgradCdfLogParetoType2_v_296;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_297> AgradCdfLogParetoType2_v_297;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_298> AgradCdfLogParetoType2_v_298;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_299> AgradCdfLogParetoType2_v_299;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_200, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_200);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_201, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_201);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_202, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_202);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_203, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_203);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_204, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_204);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_205, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_205);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_206, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_206);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_207, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_207);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_208, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_208);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_209, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_209);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_210, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_210);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_211, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_211);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_212, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_212);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_213, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_213);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_214, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_214);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_215, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_215);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_216, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_216);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_217, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_217);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_218, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_218);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_219, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_219);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_220, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_220);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_221, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_221);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_222, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_222);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_223, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_223);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_224, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_224);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_225, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_225);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_226, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_226);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_227, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_227);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_228, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_228);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_229, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_229);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_230, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_230);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_231, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_231);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_232, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_232);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_233, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_233);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_234, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_234);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_235, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_235);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_236, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_236);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_237, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_237);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_238, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_238);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_239, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_239);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_240, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_240);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_241, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_241);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_242, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_242);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_243, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_243);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_244, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_244);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_245, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_245);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_246, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_246);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_247, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_247);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_248, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_248);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_249, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_249);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_250, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_250);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_251, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_251);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_252, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_252);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_253, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_253);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_254, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_254);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_255, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_255);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_256, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_256);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_257, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_257);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_258, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_258);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_259, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_259);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_260, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_260);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_261, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_261);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_262, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_262);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_263, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_263);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_264, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_264);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_265, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_265);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_266, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_266);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_267, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_267);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_268, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_268);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_269, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_269);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_270, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_270);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_271, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_271);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_272, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_272);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_273, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_273);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_274, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_274);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_275, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_275);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_276, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_276);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_277, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_277);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_278, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_278);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_279, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_279);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_280, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_280);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_281, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_281);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_282, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_282);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_283, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_283);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_284, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_284);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_285, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_285);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_286, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_286);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_287, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_287);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_288, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_288);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_289, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_289);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_290, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_290);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_291, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_291);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_292, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_292);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_293, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_293);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_294, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_294);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_295, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_295);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_296, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_296);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_297, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_297);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_298, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_298);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_299, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_299);
+
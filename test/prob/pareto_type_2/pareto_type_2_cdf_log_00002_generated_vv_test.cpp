@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_cdf_log_test.hpp>
+
+typedef std::tuple<std::vector<double>, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_200;
+typedef std::tuple<std::vector<double>, double, var, var, empty, empty> type_vv_201;
+typedef std::tuple<std::vector<double>, double, var, std::vector<var>, empty, empty> type_vv_202;
+typedef std::tuple<std::vector<double>, double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_203;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, double, empty, empty> type_vv_204;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, std::vector<double>, empty, empty> type_vv_205;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_206;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, var, empty, empty> type_vv_207;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, std::vector<var>, empty, empty> type_vv_208;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_209;
+typedef std::tuple<std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_210;
+typedef std::tuple<std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_211;
+typedef std::tuple<std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_212;
+typedef std::tuple<std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_213;
+typedef std::tuple<std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_214;
+typedef std::tuple<std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_215;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, var, empty, empty> type_vv_216;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, std::vector<var>, empty, empty> type_vv_217;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_218;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, var, empty, empty> type_vv_219;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_vv_220;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_221;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_222;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_223;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_224;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, double, empty, empty> type_vv_225;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, std::vector<double>, empty, empty> type_vv_226;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_227;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, var, empty, empty> type_vv_228;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, std::vector<var>, empty, empty> type_vv_229;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_230;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, double, empty, empty> type_vv_231;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_vv_232;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_233;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, var, empty, empty> type_vv_234;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_vv_235;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_236;
+typedef std::tuple<std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_237;
+typedef std::tuple<std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_238;
+typedef std::tuple<std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_239;
+typedef std::tuple<std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_240;
+typedef std::tuple<std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_241;
+typedef std::tuple<std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_242;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_vv_243;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_vv_244;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_245;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_vv_246;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_vv_247;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_248;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_249;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_250;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_251;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_vv_252;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_vv_253;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_254;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_vv_255;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_vv_256;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_257;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_vv_258;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_vv_259;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_260;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_vv_261;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_vv_262;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_263;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_264;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_265;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_266;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_267;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_268;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_269;
+typedef std::tuple<std::vector<double>, var, double, double, empty, empty> type_vv_270;
+typedef std::tuple<std::vector<double>, var, double, std::vector<double>, empty, empty> type_vv_271;
+typedef std::tuple<std::vector<double>, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_272;
+typedef std::tuple<std::vector<double>, var, double, var, empty, empty> type_vv_273;
+typedef std::tuple<std::vector<double>, var, double, std::vector<var>, empty, empty> type_vv_274;
+typedef std::tuple<std::vector<double>, var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_275;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, double, empty, empty> type_vv_276;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, std::vector<double>, empty, empty> type_vv_277;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_278;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, var, empty, empty> type_vv_279;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, std::vector<var>, empty, empty> type_vv_280;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_281;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_282;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_283;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_284;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_285;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_286;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_287;
+typedef std::tuple<std::vector<double>, var, var, double, empty, empty> type_vv_288;
+typedef std::tuple<std::vector<double>, var, var, std::vector<double>, empty, empty> type_vv_289;
+typedef std::tuple<std::vector<double>, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_290;
+typedef std::tuple<std::vector<double>, var, var, var, empty, empty> type_vv_291;
+typedef std::tuple<std::vector<double>, var, var, std::vector<var>, empty, empty> type_vv_292;
+typedef std::tuple<std::vector<double>, var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_293;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, double, empty, empty> type_vv_294;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, std::vector<double>, empty, empty> type_vv_295;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_296;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, var, empty, empty> type_vv_297;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, std::vector<var>, empty, empty> type_vv_298;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_299;
+
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_200> AgradCdfLogParetoType2_vv_200;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_201> AgradCdfLogParetoType2_vv_201;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_202> AgradCdfLogParetoType2_vv_202;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_203> AgradCdfLogParetoType2_vv_203;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_204> AgradCdfLogParetoType2_vv_204;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_205> AgradCdfLogParetoType2_vv_205;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_206> AgradCdfLogParetoType2_vv_206;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_207> AgradCdfLogParetoType2_vv_207;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_208> AgradCdfLogParetoType2_vv_208;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_209> AgradCdfLogParetoType2_vv_209;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_210> AgradCdfLogParetoType2_vv_210;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_211> AgradCdfLogParetoType2_vv_211;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_212> AgradCdfLogParetoType2_vv_212;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_213> AgradCdfLogParetoType2_vv_213;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_214> AgradCdfLogParetoType2_vv_214;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_215> AgradCdfLogParetoType2_vv_215;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_216> AgradCdfLogParetoType2_vv_216;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_217> AgradCdfLogParetoType2_vv_217;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_218> AgradCdfLogParetoType2_vv_218;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_219> AgradCdfLogParetoType2_vv_219;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_220> AgradCdfLogParetoType2_vv_220;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_221> AgradCdfLogParetoType2_vv_221;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_222> AgradCdfLogParetoType2_vv_222;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_223> AgradCdfLogParetoType2_vv_223;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_224> AgradCdfLogParetoType2_vv_224;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_225> AgradCdfLogParetoType2_vv_225;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_226> AgradCdfLogParetoType2_vv_226;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_227> AgradCdfLogParetoType2_vv_227;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_228> AgradCdfLogParetoType2_vv_228;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_229> AgradCdfLogParetoType2_vv_229;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_230> AgradCdfLogParetoType2_vv_230;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_231> AgradCdfLogParetoType2_vv_231;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_232> AgradCdfLogParetoType2_vv_232;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_233> AgradCdfLogParetoType2_vv_233;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_234> AgradCdfLogParetoType2_vv_234;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_235> AgradCdfLogParetoType2_vv_235;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_236> AgradCdfLogParetoType2_vv_236;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_237> AgradCdfLogParetoType2_vv_237;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_238> AgradCdfLogParetoType2_vv_238;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_239> AgradCdfLogParetoType2_vv_239;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_240> AgradCdfLogParetoType2_vv_240;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_241> AgradCdfLogParetoType2_vv_241;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_242> AgradCdfLogParetoType2_vv_242;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_243> AgradCdfLogParetoType2_vv_243;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_244> AgradCdfLogParetoType2_vv_244;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_245> AgradCdfLogParetoType2_vv_245;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_246> AgradCdfLogParetoType2_vv_246;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_247> AgradCdfLogParetoType2_vv_247;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_248> AgradCdfLogParetoType2_vv_248;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_249> AgradCdfLogParetoType2_vv_249;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_250> AgradCdfLogParetoType2_vv_250;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_251> AgradCdfLogParetoType2_vv_251;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_252> AgradCdfLogParetoType2_vv_252;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_253> AgradCdfLogParetoType2_vv_253;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_254> AgradCdfLogParetoType2_vv_254;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_255> AgradCdfLogParetoType2_vv_255;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_256> AgradCdfLogParetoType2_vv_256;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_257> AgradCdfLogParetoType2_vv_257;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_258> AgradCdfLogParetoType2_vv_258;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_259> AgradCdfLogParetoType2_vv_259;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_260> AgradCdfLogParetoType2_vv_260;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_261> AgradCdfLogParetoType2_vv_261;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_262> AgradCdfLogParetoType2_vv_262;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_263> AgradCdfLogParetoType2_vv_263;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_264> AgradCdfLogParetoType2_vv_264;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_265> AgradCdfLogParetoType2_vv_265;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_266> AgradCdfLogParetoType2_vv_266;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_267> AgradCdfLogParetoType2_vv_267;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_268> AgradCdfLogParetoType2_vv_268;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_269> AgradCdfLogParetoType2_vv_269;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_270> AgradCdfLogParetoType2_vv_270;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_271> AgradCdfLogParetoType2_vv_271;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_272> AgradCdfLogParetoType2_vv_272;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_273> AgradCdfLogParetoType2_vv_273;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_274> AgradCdfLogParetoType2_vv_274;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_275> AgradCdfLogParetoType2_vv_275;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_276> AgradCdfLogParetoType2_vv_276;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_277> AgradCdfLogParetoType2_vv_277;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_278> AgradCdfLogParetoType2_vv_278;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_279> AgradCdfLogParetoType2_vv_279;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_280> AgradCdfLogParetoType2_vv_280;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_281> AgradCdfLogParetoType2_vv_281;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_282> AgradCdfLogParetoType2_vv_282;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_283> AgradCdfLogParetoType2_vv_283;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_284> AgradCdfLogParetoType2_vv_284;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_285> AgradCdfLogParetoType2_vv_285;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_286> AgradCdfLogParetoType2_vv_286;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_287> AgradCdfLogParetoType2_vv_287;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_288> AgradCdfLogParetoType2_vv_288;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_289> AgradCdfLogParetoType2_vv_289;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_290> AgradCdfLogParetoType2_vv_290;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_291> AgradCdfLogParetoType2_vv_291;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_292> AgradCdfLogParetoType2_vv_292;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_293> AgradCdfLogParetoType2_vv_293;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_294> AgradCdfLogParetoType2_vv_294;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_295> AgradCdfLogParetoType2_vv_295;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_296> AgradCdfLogParetoType2_vv_296;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_297> AgradCdfLogParetoType2_vv_297;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_298> AgradCdfLogParetoType2_vv_298;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_299> AgradCdfLogParetoType2_vv_299;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_200, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_200);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_201, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_201);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_202, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_202);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_203, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_203);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_204, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_204);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_205, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_205);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_206, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_206);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_207, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_207);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_208, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_208);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_209, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_209);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_210, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_210);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_211, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_211);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_212, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_212);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_213, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_213);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_214, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_214);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_215, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_215);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_216, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_216);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_217, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_217);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_218, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_218);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_219, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_219);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_220, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_220);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_221, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_221);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_222, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_222);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_223, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_223);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_224, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_224);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_225, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_225);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_226, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_226);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_227, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_227);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_228, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_228);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_229, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_229);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_230, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_230);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_231, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_231);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_232, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_232);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_233, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_233);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_234, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_234);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_235, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_235);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_236, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_236);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_237, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_237);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_238, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_238);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_239, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_239);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_240, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_240);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_241, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_241);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_242, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_242);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_243, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_243);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_244, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_244);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_245, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_245);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_246, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_246);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_247, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_247);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_248, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_248);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_249, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_249);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_250, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_250);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_251, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_251);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_252, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_252);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_253, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_253);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_254, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_254);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_255, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_255);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_256, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_256);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_257, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_257);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_258, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_258);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_259, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_259);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_260, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_260);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_261, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_261);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_262, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_262);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_263, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_263);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_264, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_264);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_265, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_265);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_266, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_266);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_267, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_267);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_268, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_268);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_269, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_269);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_270, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_270);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_271, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_271);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_272, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_272);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_273, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_273);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_274, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_274);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_275, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_275);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_276, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_276);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_277, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_277);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_278, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_278);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_279, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_279);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_280, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_280);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_281, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_281);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_282, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_282);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_283, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_283);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_284, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_284);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_285, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_285);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_286, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_286);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_287, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_287);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_288, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_288);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_289, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_289);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_290, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_290);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_291, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_291);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_292, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_292);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_293, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_293);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_294, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_294);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_295, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_295);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_296, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_296);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_297, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_297);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_298, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_298);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_299, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_299);
+
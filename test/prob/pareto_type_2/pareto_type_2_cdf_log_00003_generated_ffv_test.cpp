@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_cdf_log_test.hpp>
+
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_300;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_301;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_302;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_303;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_304;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_305;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, double, double, empty, empty> type_ffv_306;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty, empty> type_ffv_307;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_308;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty, empty> type_ffv_309;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_310;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_311;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty, empty> type_ffv_312;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_313;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_314;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_315;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_316;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_317;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_318;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_319;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_320;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_321;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_322;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_323;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty, empty> type_ffv_324;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_325;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_326;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_327;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_328;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_329;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_330;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_331;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_332;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_333;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_334;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_335;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_336;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_337;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_338;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_339;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_340;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_341;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty, empty> type_ffv_342;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_ffv_343;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_344;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_345;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_346;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_347;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_ffv_348;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_349;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_350;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_351;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_352;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_353;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_354;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_355;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_356;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_357;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_358;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_359;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_360;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_361;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_362;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_363;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_364;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_365;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_366;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_367;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_368;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_369;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_370;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_371;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_372;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_373;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_374;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_375;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_376;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_377;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, fvar<fvar<var> >, empty, empty> type_ffv_378;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_379;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_380;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_381;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_382;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_383;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_384;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_385;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_386;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, double, empty, empty> type_ffv_387;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_388;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_389;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_390;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_391;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_392;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_393;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_394;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_395;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_396;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_397;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_398;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_399;
+
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_300> AgradCdfLogParetoType2_ffv_300;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_301> AgradCdfLogParetoType2_ffv_301;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_302> AgradCdfLogParetoType2_ffv_302;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_303> AgradCdfLogParetoType2_ffv_303;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_304> AgradCdfLogParetoType2_ffv_304;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_305> AgradCdfLogParetoType2_ffv_305;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_306> AgradCdfLogParetoType2_ffv_306;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_307> AgradCdfLogParetoType2_ffv_307;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_308> AgradCdfLogParetoType2_ffv_308;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_309> AgradCdfLogParetoType2_ffv_309;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_310> AgradCdfLogParetoType2_ffv_310;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_311> AgradCdfLogParetoType2_ffv_311;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_312> AgradCdfLogParetoType2_ffv_312;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_313> AgradCdfLogParetoType2_ffv_313;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_314> AgradCdfLogParetoType2_ffv_314;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_315> AgradCdfLogParetoType2_ffv_315;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_316> AgradCdfLogParetoType2_ffv_316;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_317> AgradCdfLogParetoType2_ffv_317;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_318> AgradCdfLogParetoType2_ffv_318;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_319> AgradCdfLogParetoType2_ffv_319;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_320> AgradCdfLogParetoType2_ffv_320;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_321> AgradCdfLogParetoType2_ffv_321;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_322> AgradCdfLogParetoType2_ffv_322;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_323> AgradCdfLogParetoType2_ffv_323;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_324> AgradCdfLogParetoType2_ffv_324;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_325> AgradCdfLogParetoType2_ffv_325;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_326> AgradCdfLogParetoType2_ffv_326;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_327> AgradCdfLogParetoType2_ffv_327;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_328> AgradCdfLogParetoType2_ffv_328;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_329> AgradCdfLogParetoType2_ffv_329;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_330> AgradCdfLogParetoType2_ffv_330;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_331> AgradCdfLogParetoType2_ffv_331;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_332> AgradCdfLogParetoType2_ffv_332;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_333> AgradCdfLogParetoType2_ffv_333;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_334> AgradCdfLogParetoType2_ffv_334;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_335> AgradCdfLogParetoType2_ffv_335;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_336> AgradCdfLogParetoType2_ffv_336;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_337> AgradCdfLogParetoType2_ffv_337;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_338> AgradCdfLogParetoType2_ffv_338;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_339> AgradCdfLogParetoType2_ffv_339;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_340> AgradCdfLogParetoType2_ffv_340;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_341> AgradCdfLogParetoType2_ffv_341;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_342> AgradCdfLogParetoType2_ffv_342;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_343> AgradCdfLogParetoType2_ffv_343;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_344> AgradCdfLogParetoType2_ffv_344;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_345> AgradCdfLogParetoType2_ffv_345;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_346> AgradCdfLogParetoType2_ffv_346;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_347> AgradCdfLogParetoType2_ffv_347;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_348> AgradCdfLogParetoType2_ffv_348;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_349> AgradCdfLogParetoType2_ffv_349;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_350> AgradCdfLogParetoType2_ffv_350;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_351> AgradCdfLogParetoType2_ffv_351;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_352> AgradCdfLogParetoType2_ffv_352;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_353> AgradCdfLogParetoType2_ffv_353;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_354> AgradCdfLogParetoType2_ffv_354;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_355> AgradCdfLogParetoType2_ffv_355;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_356> AgradCdfLogParetoType2_ffv_356;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_357> AgradCdfLogParetoType2_ffv_357;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_358> AgradCdfLogParetoType2_ffv_358;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_359> AgradCdfLogParetoType2_ffv_359;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_360> AgradCdfLogParetoType2_ffv_360;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_361> AgradCdfLogParetoType2_ffv_361;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_362> AgradCdfLogParetoType2_ffv_362;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_363> AgradCdfLogParetoType2_ffv_363;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_364> AgradCdfLogParetoType2_ffv_364;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_365> AgradCdfLogParetoType2_ffv_365;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_366> AgradCdfLogParetoType2_ffv_366;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_367> AgradCdfLogParetoType2_ffv_367;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_368> AgradCdfLogParetoType2_ffv_368;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_369> AgradCdfLogParetoType2_ffv_369;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_370> AgradCdfLogParetoType2_ffv_370;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_371> AgradCdfLogParetoType2_ffv_371;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_372> AgradCdfLogParetoType2_ffv_372;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_373> AgradCdfLogParetoType2_ffv_373;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_374> AgradCdfLogParetoType2_ffv_374;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_375> AgradCdfLogParetoType2_ffv_375;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_376> AgradCdfLogParetoType2_ffv_376;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_377> AgradCdfLogParetoType2_ffv_377;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_378> AgradCdfLogParetoType2_ffv_378;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_379> AgradCdfLogParetoType2_ffv_379;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_380> AgradCdfLogParetoType2_ffv_380;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_381> AgradCdfLogParetoType2_ffv_381;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_382> AgradCdfLogParetoType2_ffv_382;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_383> AgradCdfLogParetoType2_ffv_383;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_384> AgradCdfLogParetoType2_ffv_384;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_385> AgradCdfLogParetoType2_ffv_385;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_386> AgradCdfLogParetoType2_ffv_386;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_387> AgradCdfLogParetoType2_ffv_387;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_388> AgradCdfLogParetoType2_ffv_388;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_389> AgradCdfLogParetoType2_ffv_389;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_390> AgradCdfLogParetoType2_ffv_390;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_391> AgradCdfLogParetoType2_ffv_391;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_392> AgradCdfLogParetoType2_ffv_392;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_393> AgradCdfLogParetoType2_ffv_393;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_394> AgradCdfLogParetoType2_ffv_394;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_395> AgradCdfLogParetoType2_ffv_395;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_396> AgradCdfLogParetoType2_ffv_396;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_397> AgradCdfLogParetoType2_ffv_397;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_398> AgradCdfLogParetoType2_ffv_398;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_399> AgradCdfLogParetoType2_ffv_399;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_300, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_300);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_301, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_301);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_302, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_302);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_303, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_303);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_304, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_304);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_305, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_305);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_306, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_306);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_307, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_307);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_308, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_308);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_309, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_309);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_310, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_310);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_311, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_311);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_312, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_312);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_313, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_313);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_314, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_314);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_315, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_315);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_316, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_316);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_317, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_317);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_318, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_318);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_319, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_319);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_320, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_320);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_321, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_321);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_322, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_322);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_323, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_323);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_324, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_324);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_325, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_325);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_326, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_326);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_327, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_327);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_328, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_328);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_329, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_329);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_330, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_330);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_331, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_331);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_332, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_332);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_333, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_333);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_334, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_334);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_335, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_335);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_336, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_336);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_337, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_337);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_338, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_338);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_339, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_339);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_340, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_340);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_341, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_341);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_342, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_342);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_343, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_343);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_344, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_344);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_345, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_345);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_346, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_346);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_347, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_347);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_348, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_348);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_349, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_349);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_350, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_350);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_351, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_351);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_352, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_352);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_353, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_353);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_354, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_354);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_355, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_355);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_356, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_356);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_357, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_357);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_358, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_358);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_359, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_359);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_360, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_360);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_361, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_361);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_362, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_362);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_363, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_363);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_364, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_364);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_365, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_365);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_366, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_366);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_367, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_367);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_368, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_368);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_369, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_369);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_370, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_370);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_371, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_371);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_372, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_372);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_373, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_373);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_374, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_374);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_375, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_375);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_376, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_376);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_377, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_377);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_378, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_378);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_379, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_379);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_380, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_380);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_381, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_381);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_382, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_382);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_383, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_383);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_384, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_384);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_385, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_385);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_386, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_386);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_387, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_387);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_388, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_388);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_389, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_389);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_390, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_390);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_391, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_391);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_392, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_392);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_393, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_393);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_394, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_394);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_395, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_395);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_396, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_396);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_397, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_397);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_398, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_398);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_399, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_399);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_cdf_log_test.hpp>
+
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_300;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_301;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_302;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_303;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_304;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_305;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_306;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_307;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_308;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_309;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_310;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_311;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_312;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_313;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_314;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_315;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_316;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_317;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_318;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_319;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_320;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_321;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_322;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_323;
+typedef std::tuple<std::vector<double>, var, double, double, empty, empty> type_v_324;
+typedef std::tuple<std::vector<double>, var, double, std::vector<double>, empty, empty> type_v_325;
+typedef std::tuple<std::vector<double>, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_326;
+typedef std::tuple<std::vector<double>, var, double, var, empty, empty> type_v_327;
+typedef std::tuple<std::vector<double>, var, double, std::vector<var>, empty, empty> type_v_328;
+typedef std::tuple<std::vector<double>, var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_329;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, double, empty, empty> type_v_330;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, std::vector<double>, empty, empty> type_v_331;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_332;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, var, empty, empty> type_v_333;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, std::vector<var>, empty, empty> type_v_334;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_335;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_336;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_337;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_338;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_339;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_340;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_341;
+typedef std::tuple<std::vector<double>, var, var, double, empty, empty> type_v_342;
+typedef std::tuple<std::vector<double>, var, var, std::vector<double>, empty, empty> type_v_343;
+typedef std::tuple<std::vector<double>, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_344;
+typedef std::tuple<std::vector<double>, var, var, var, empty, empty> type_v_345;
+typedef std::tuple<std::vector<double>, var, var, std::vector<var>, empty, empty> type_v_346;
+typedef std::tuple<std::vector<double>, var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_347;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, double, empty, empty> type_v_348;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, std::vector<double>, empty, empty> type_v_349;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_350;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, var, empty, empty> type_v_351;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, std::vector<var>, empty, empty> type_v_352;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_353;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_354;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_355;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_356;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_357;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_358;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_359;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, double, empty, empty> type_v_360;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, std::vector<double>, empty, empty> type_v_361;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_362;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, var, empty, empty> type_v_363;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, std::vector<var>, empty, empty> type_v_364;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_365;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, double, empty, empty> type_v_366;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_v_367;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_368;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, var, empty, empty> type_v_369;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_v_370;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_371;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_372;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_373;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_374;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_375;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_376;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_377;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, double, empty, empty> type_v_378;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, std::vector<double>, empty, empty> type_v_379;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_380;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, var, empty, empty> type_v_381;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, std::vector<var>, empty, empty> type_v_382;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_383;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, double, empty, empty> type_v_384;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_v_385;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_386;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, var, empty, empty> type_v_387;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_v_388;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_389;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_390;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_391;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_392;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_393;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_394;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_395;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_396;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_397;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_398;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_399;
+
+typedef std::tuple<AgradCdfLogParetoType2, type_v_300> AgradCdfLogParetoType2_v_300;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_301> AgradCdfLogParetoType2_v_301;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_302> AgradCdfLogParetoType2_v_302;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_303> AgradCdfLogParetoType2_v_303;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_304> AgradCdfLogParetoType2_v_304;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_305> AgradCdfLogParetoType2_v_305;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_306> AgradCdfLogParetoType2_v_306;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_307> AgradCdfLogParetoType2_v_307;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_308> AgradCdfLogParetoType2_v_308;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_309> AgradCdfLogParetoType2_v_309;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_310> AgradCdfLogParetoType2_v_310;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_311> AgradCdfLogParetoType2_v_311;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_312> AgradCdfLogParetoType2_v_312;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_313> AgradCdfLogParetoType2_v_313;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_314> AgradCdfLogParetoType2_v_314;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_315> AgradCdfLogParetoType2_v_315;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_316> AgradCdfLogParetoType2_v_316;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_317> AgradCdfLogParetoType2_v_317;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_318> AgradCdfLogParetoType2_v_318;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_319> AgradCdfLogParetoType2_v_319;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_320> AgradCdfLogParetoType2_v_320;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_321> AgradCdfLogParetoType2_v_321;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_322> AgradCdfLogParetoType2_v_322;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_323> AgradCdfLogParetoType2_v_323;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_324> AgradCdfLogParetoType2_v_324;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_325> AgradCdfLogParetoType2_v_325;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_326> AgradCdfLogParetoType2_v_326;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_327> AgradCdfLogParetoType2_v_327;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_328> AgradCdfLogParetoType2_v_328;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_329> AgradCdfLogParetoType2_v_329;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_330> AgradCdfLogParetoType2_v_330;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_331> AgradCdfLogParetoType2_v_331;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_332> AgradCdfLogParetoType2_v_332;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_333> AgradCdfLogParetoType2_v_333;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_334> AgradCdfLogParetoType2_v_334;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_335> AgradCdfLogParetoType2_v_335;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_336> AgradCdfLogParetoType2_v_336;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_337> AgradCdfLogParetoType2_v_337;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_338> AgradCdfLogParetoType2_v_338;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_339> AgradCdfLogParetoType2_v_339;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_340> AgradCdfLogParetoType2_v_340;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_341> AgradCdfLogParetoType2_v_341;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_342> AgradCdfLogParetoType2_v_342;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_343> AgradCdfLogParetoType2_v_343;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_344> AgradCdfLogParetoType2_v_344;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_345> AgradCdfLogParetoType2_v_345;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_346> AgradCdfLogParetoType2_v_346;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_347> AgradCdfLogParetoType2_v_347;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_348> AgradCdfLogParetoType2_v_348;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_349> AgradCdfLogParetoType2_v_349;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_350> AgradCdfLogParetoType2_v_350;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_351> AgradCdfLogParetoType2_v_351;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_352> AgradCdfLogParetoType2_v_352;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_353> AgradCdfLogParetoType2_v_353;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_354> AgradCdfLogParetoType2_v_354;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_355> AgradCdfLogParetoType2_v_355;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_356> AgradCdfLogParetoType2_v_356;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_357> AgradCdfLogParetoType2_v_357;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_358> AgradCdfLogParetoType2_v_358;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_359> AgradCdfLogParetoType2_v_359;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_360> AgradCdfLogParetoType2_v_360;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_361> AgradCdfLogParetoType2_v_361;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_362> AgradCdfLogParetoType2_v_362;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_363> AgradCdfLogParetoType2_v_363;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_364> AgradCdfLogParetoType2_v_364;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_365> AgradCdfLogParetoType2_v_365;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_366> AgradCdfLogParetoType2_v_366;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_367> AgradCdfLogParetoType2_v_367;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_368> AgradCdfLogParetoType2_v_368;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_369> AgradCdfLogParetoType2_v_369;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_370> AgradCdfLogParetoType2_v_370;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_371> AgradCdfLogParetoType2_v_371;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_372> AgradCdfLogParetoType2_v_372;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_373> AgradCdfLogParetoType2_v_373;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_374> AgradCdfLogParetoType2_v_374;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_375> AgradCdfLogParetoType2_v_375;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_376> AgradCdfLogParetoType2_v_376;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_377> AgradCdfLogParetoType2_v_377;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_378> AgradCdfLogParetoType2_v_378;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_379> AgradCdfLogParetoType2_v_379;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_380> AgradCdfLogParetoType2_v_380;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_381> AgradCdfLogParetoType2_v_381;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_382> AgradCdfLogParetoType2_v_382;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_383> AgradCdfLogParetoType2_v_383;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_384> AgradCdfLogParetoType2_v_384;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_385> AgradCdfLogParetoType2_v_385;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_386> AgradCdfLogParetoType2_v_386;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_387> AgradCdfLogParetoType2_v_387;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_388> AgradCdfLogParetoType2_v_388;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_389> AgradCdfLogParetoType2_v_389;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_390> AgradCdfLogParetoType2_v_390;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_391> AgradCdfLogParetoType2_v_391;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_392> AgradCdfLogParetoType2_v_392;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_393> AgradCdfLogParetoType2_v_393;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_394> AgradCdfLogParetoType2_v_394;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_395> AgradCdfLogParetoType2_v_395;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_396> AgradCdfLogParetoType2_v_396;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_397> AgradCdfLogParetoType2_v_397;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_398> AgradCdfLogParetoType2_v_398;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_399> AgradCdfLogParetoType2_v_399;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_300, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_300);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_301, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_301);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_302, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_302);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_303, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_303);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_304, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_304);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_305, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_305);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_306, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_306);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_307, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_307);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_308, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_308);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_309, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_309);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_310, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_310);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_311, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_311);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_312, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_312);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_313, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_313);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_314, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_314);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_315, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_315);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_316, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_316);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_317, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_317);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_318, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_318);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_319, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_319);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_320, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_320);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_321, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_321);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_322, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_322);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_323, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_323);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_324, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_324);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_325, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_325);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_326, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_326);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_327, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_327);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_328, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_328);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_329, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_329);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_330, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_330);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_331, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_331);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_332, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_332);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_333, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_333);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_334, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_334);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_335, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_335);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_336, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_336);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_337, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_337);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_338, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_338);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_339, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_339);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_340, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_340);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_341, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_341);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_342, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_342);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_343, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_343);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_344, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_344);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_345, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_345);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_346, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_346);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_347, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_347);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_348, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_348);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_349, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_349);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_350, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_350);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_351, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_351);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_352, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_352);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_353, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_353);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_354, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_354);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_355, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_355);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_356, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_356);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_357, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_357);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_358, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_358);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_359, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_359);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_360, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_360);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_361, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_361);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_362, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_362);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_363, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_363);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_364, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_364);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_365, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_365);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_366, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_366);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_367, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_367);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_368, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_368);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_369, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_369);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_370, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_370);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_371, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_371);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_372, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_372);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_373, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_373);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_374, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_374);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_375, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_375);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_376, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_376);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_377, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_377);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_378, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_378);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_379, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_379);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_380, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_380);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_381, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_381);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_382, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_382);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_383, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_383);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_384, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_384);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_385, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_385);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_386, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_386);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_387, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_387);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_388, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_388);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_389, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_389);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_390, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_390);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_391, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_391);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_392, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_392);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_393, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_393);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_394, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_394);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_395, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_395);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_396, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_396);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_397, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_397);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_398, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_398);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_399, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_399);
+
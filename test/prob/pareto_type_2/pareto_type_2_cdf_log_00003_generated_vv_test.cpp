@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_cdf_log_test.hpp>
+
+typedef std::tuple<std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_300;
+typedef std::tuple<std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_301;
+typedef std::tuple<std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_302;
+typedef std::tuple<std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_303;
+typedef std::tuple<std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_304;
+typedef std::tuple<std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_305;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, double, empty, empty> type_vv_306;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, std::vector<double>, empty, empty> type_vv_307;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_308;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, var, empty, empty> type_vv_309;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, std::vector<var>, empty, empty> type_vv_310;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_311;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, double, empty, empty> type_vv_312;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_vv_313;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_314;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, var, empty, empty> type_vv_315;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_vv_316;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_317;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_318;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_319;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_320;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_321;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_322;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_323;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, double, empty, empty> type_vv_324;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, std::vector<double>, empty, empty> type_vv_325;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_326;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, var, empty, empty> type_vv_327;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, std::vector<var>, empty, empty> type_vv_328;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_329;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, double, empty, empty> type_vv_330;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_vv_331;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_332;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, var, empty, empty> type_vv_333;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_vv_334;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_335;
+typedef std::tuple<std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_336;
+typedef std::tuple<std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_337;
+typedef std::tuple<std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_338;
+typedef std::tuple<std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_339;
+typedef std::tuple<std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_340;
+typedef std::tuple<std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_341;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, empty, empty> type_vv_342;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, empty, empty> type_vv_343;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_344;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, empty, empty> type_vv_345;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, empty, empty> type_vv_346;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_347;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, empty, empty> type_vv_348;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, empty, empty> type_vv_349;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_350;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, empty, empty> type_vv_351;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, empty, empty> type_vv_352;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_353;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_354;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_355;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_356;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_357;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_358;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_359;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, empty, empty> type_vv_360;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, empty, empty> type_vv_361;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_362;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, empty, empty> type_vv_363;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, empty, empty> type_vv_364;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_365;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, empty, empty> type_vv_366;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, empty, empty> type_vv_367;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_368;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, empty, empty> type_vv_369;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, empty, empty> type_vv_370;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_371;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_372;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_373;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_374;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_375;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_376;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_377;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, var, empty, empty> type_vv_378;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, std::vector<var>, empty, empty> type_vv_379;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_380;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, var, empty, empty> type_vv_381;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, std::vector<var>, empty, empty> type_vv_382;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_383;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_384;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_385;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_386;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, double, empty, empty> type_vv_387;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, std::vector<double>, empty, empty> type_vv_388;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_389;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, var, empty, empty> type_vv_390;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, std::vector<var>, empty, empty> type_vv_391;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_392;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, double, empty, empty> type_vv_393;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, std::vector<double>, empty, empty> type_vv_394;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_395;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, var, empty, empty> type_vv_396;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, std::vector<var>, empty, empty> type_vv_397;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_398;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_399;
+
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_300> AgradCdfLogParetoType2_vv_300;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_301> AgradCdfLogParetoType2_vv_301;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_302> AgradCdfLogParetoType2_vv_302;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_303> AgradCdfLogParetoType2_vv_303;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_304> AgradCdfLogParetoType2_vv_304;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_305> AgradCdfLogParetoType2_vv_305;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_306> AgradCdfLogParetoType2_vv_306;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_307> AgradCdfLogParetoType2_vv_307;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_308> AgradCdfLogParetoType2_vv_308;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_309> AgradCdfLogParetoType2_vv_309;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_310> AgradCdfLogParetoType2_vv_310;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_311> AgradCdfLogParetoType2_vv_311;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_312> AgradCdfLogParetoType2_vv_312;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_313> AgradCdfLogParetoType2_vv_313;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_314> AgradCdfLogParetoType2_vv_314;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_315> AgradCdfLogParetoType2_vv_315;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_316> AgradCdfLogParetoType2_vv_316;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_317> AgradCdfLogParetoType2_vv_317;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_318> AgradCdfLogParetoType2_vv_318;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_319> AgradCdfLogParetoType2_vv_319;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_320> AgradCdfLogParetoType2_vv_320;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_321> AgradCdfLogParetoType2_vv_321;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_322> AgradCdfLogParetoType2_vv_322;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_323> AgradCdfLogParetoType2_vv_323;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_324> AgradCdfLogParetoType2_vv_324;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_325> AgradCdfLogParetoType2_vv_325;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_326> AgradCdfLogParetoType2_vv_326;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_327> AgradCdfLogParetoType2_vv_327;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_328> AgradCdfLogParetoType2_vv_328;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_329> AgradCdfLogParetoType2_vv_329;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_330> AgradCdfLogParetoType2_vv_330;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_331> AgradCdfLogParetoType2_vv_331;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_332> AgradCdfLogParetoType2_vv_332;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_333> AgradCdfLogParetoType2_vv_333;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_334> AgradCdfLogParetoType2_vv_334;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_335> AgradCdfLogParetoType2_vv_335;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_336> AgradCdfLogParetoType2_vv_336;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_337> AgradCdfLogParetoType2_vv_337;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_338> AgradCdfLogParetoType2_vv_338;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_339> AgradCdfLogParetoType2_vv_339;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_340> AgradCdfLogParetoType2_vv_340;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_341> AgradCdfLogParetoType2_vv_341;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_342> AgradCdfLogParetoType2_vv_342;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_343> AgradCdfLogParetoType2_vv_343;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_344> AgradCdfLogParetoType2_vv_344;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_345> AgradCdfLogParetoType2_vv_345;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_346> AgradCdfLogParetoType2_vv_346;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_347> AgradCdfLogParetoType2_vv_347;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_348> AgradCdfLogParetoType2_vv_348;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_349> AgradCdfLogParetoType2_vv_349;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_350> AgradCdfLogParetoType2_vv_350;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_351> AgradCdfLogParetoType2_vv_351;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_352> AgradCdfLogParetoType2_vv_352;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_353> AgradCdfLogParetoType2_vv_353;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_354> AgradCdfLogParetoType2_vv_354;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_355> AgradCdfLogParetoType2_vv_355;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_356> AgradCdfLogParetoType2_vv_356;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_357> AgradCdfLogParetoType2_vv_357;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_358> AgradCdfLogParetoType2_vv_358;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_359> AgradCdfLogParetoType2_vv_359;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_360> AgradCdfLogParetoType2_vv_360;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_361> AgradCdfLogParetoType2_vv_361;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_362> AgradCdfLogParetoType2_vv_362;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_363> AgradCdfLogParetoType2_vv_363;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_364> AgradCdfLogParetoType2_vv_364;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_365> AgradCdfLogParetoType2_vv_365;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_366> AgradCdfLogParetoType2_vv_366;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_367> AgradCdfLogParetoType2_vv_367;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_368> AgradCdfLogParetoType2_vv_368;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_369> AgradCdfLogParetoType2_vv_369;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_370> AgradCdfLogParetoType2_vv_370;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_371> AgradCdfLogParetoType2_vv_371;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_372> AgradCdfLogParetoType2_vv_372;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_373> AgradCdfLogParetoType2_vv_373;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_374> AgradCdfLogParetoType2_vv_374;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_375> AgradCdfLogParetoType2_vv_375;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_376> AgradCdfLogParetoType2_vv_376;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_377> AgradCdfLogParetoType2_vv_377;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_378> AgradCdfLogParetoType2_vv_378;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_379> AgradCdfLogParetoType2_vv_379;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_380> AgradCdfLogParetoType2_vv_380;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_381> AgradCdfLogParetoType2_vv_381;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_382> AgradCdfLogParetoType2_vv_382;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_383> AgradCdfLogParetoType2_vv_383;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_384> AgradCdfLogParetoType2_vv_384;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_385> AgradCdfLogParetoType2_vv_385;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_386> AgradCdfLogParetoType2_vv_386;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_387> AgradCdfLogParetoType2_vv_387;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_388> AgradCdfLogParetoType2_vv_388;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_389> AgradCdfLogParetoType2_vv_389;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_390> AgradCdfLogParetoType2_vv_390;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_391> AgradCdfLogParetoType2_vv_391;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_392> AgradCdfLogParetoType2_vv_392;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_393> AgradCdfLogParetoType2_vv_393;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_394> AgradCdfLogParetoType2_vv_394;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_395> AgradCdfLogParetoType2_vv_395;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_396> AgradCdfLogParetoType2_vv_396;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_397> AgradCdfLogParetoType2_vv_397;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_398> AgradCdfLogParetoType2_vv_398;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_399> AgradCdfLogParetoType2_vv_399;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_300, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_300);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_301, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_301);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_302, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_302);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_303, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_303);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_304, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_304);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_305, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_305);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_306, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_306);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_307, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_307);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_308, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_308);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_309, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_309);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_310, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_310);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_311, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_311);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_312, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_312);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_313, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_313);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_314, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_314);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_315, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_315);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_316, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_316);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_317, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_317);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_318, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_318);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_319, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_319);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_320, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_320);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_321, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_321);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_322, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_322);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_323, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_323);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_324, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_324);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_325, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_325);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_326, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_326);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_327, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_327);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_328, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_328);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_329, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_329);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_330, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_330);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_331, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_331);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_332, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_332);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_333, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_333);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_334, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_334);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_335, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_335);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_336, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_336);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_337, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_337);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_338, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_338);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_339, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_339);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_340, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_340);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_341, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_341);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_342, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_342);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_343, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_343);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_344, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_344);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_345, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_345);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_346, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_346);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_347, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_347);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_348, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_348);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_349, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_349);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_350, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_350);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_351, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_351);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_352, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_352);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_353, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_353);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_354, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_354);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_355, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_355);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_356, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_356);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_357, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_357);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_358, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_358);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_359, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_359);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_360, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_360);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_361, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_361);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_362, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_362);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_363, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_363);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_364, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_364);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_365, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_365);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_366, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_366);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_367, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_367);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_368, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_368);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_369, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_369);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_370, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_370);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_371, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_371);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_372, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_372);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_373, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_373);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_374, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_374);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_375, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_375);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_376, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_376);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_377, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_377);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_378, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_378);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_379, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_379);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_380, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_380);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_381, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_381);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_382, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_382);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_383, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_383);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_384, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_384);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_385, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_385);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_386, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_386);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_387, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_387);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_388, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_388);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_389, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_389);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_390, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_390);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_391, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_391);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_392, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_392);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_393, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_393);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_394, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_394);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_395, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_395);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_396, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_396);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_397, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_397);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_398, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_398);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_399, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_399);
+
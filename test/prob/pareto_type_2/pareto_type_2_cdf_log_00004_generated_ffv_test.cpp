@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_cdf_log_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_400;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_401;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_402;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_403;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_404;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, fvar<fvar<var> >, empty, empty> type_ffv_405;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_406;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_407;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_408;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_409;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_410;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_411;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_412;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_413;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, double, empty, empty> type_ffv_414;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_415;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_416;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_417;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_418;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_419;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_420;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_421;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_422;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_423;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_424;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_425;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_426;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_427;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_428;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_429;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_430;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_431;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_432;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_433;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_434;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_435;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_436;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_437;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_438;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_439;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_440;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_441;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_442;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_443;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_444;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_445;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_446;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_447;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_448;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_449;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_450;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_451;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_452;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_453;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_454;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_455;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_456;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_457;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_458;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, double, empty, empty> type_ffv_459;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, std::vector<double>, empty, empty> type_ffv_460;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_461;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, fvar<fvar<var> >, empty, empty> type_ffv_462;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_463;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_464;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, double, empty, empty> type_ffv_465;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty, empty> type_ffv_466;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_467;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_468;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_469;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_470;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_471;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_472;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_473;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_474;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_475;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_476;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, double, empty, empty> type_ffv_477;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_478;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_479;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_480;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_481;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_482;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_483;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_484;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_485;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_486;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_487;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_488;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_489;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_490;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_491;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_492;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_493;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_494;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, double, empty, empty> type_ffv_495;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty, empty> type_ffv_496;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_497;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty, empty> type_ffv_498;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_499;
+
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_400> AgradCdfLogParetoType2_ffv_400;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_401> AgradCdfLogParetoType2_ffv_401;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_402> AgradCdfLogParetoType2_ffv_402;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_403> AgradCdfLogParetoType2_ffv_403;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_404> AgradCdfLogParetoType2_ffv_404;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_405> AgradCdfLogParetoType2_ffv_405;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_406> AgradCdfLogParetoType2_ffv_406;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_407> AgradCdfLogParetoType2_ffv_407;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_408> AgradCdfLogParetoType2_ffv_408;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_409> AgradCdfLogParetoType2_ffv_409;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_410> AgradCdfLogParetoType2_ffv_410;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_411> AgradCdfLogParetoType2_ffv_411;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_412> AgradCdfLogParetoType2_ffv_412;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_413> AgradCdfLogParetoType2_ffv_413;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_414> AgradCdfLogParetoType2_ffv_414;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_415> AgradCdfLogParetoType2_ffv_415;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_416> AgradCdfLogParetoType2_ffv_416;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_417> AgradCdfLogParetoType2_ffv_417;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_418> AgradCdfLogParetoType2_ffv_418;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_419> AgradCdfLogParetoType2_ffv_419;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_420> AgradCdfLogParetoType2_ffv_420;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_421> AgradCdfLogParetoType2_ffv_421;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_422> AgradCdfLogParetoType2_ffv_422;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_423> AgradCdfLogParetoType2_ffv_423;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_424> AgradCdfLogParetoType2_ffv_424;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_425> AgradCdfLogParetoType2_ffv_425;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_426> AgradCdfLogParetoType2_ffv_426;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_427> AgradCdfLogParetoType2_ffv_427;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_428> AgradCdfLogParetoType2_ffv_428;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_429> AgradCdfLogParetoType2_ffv_429;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_430> AgradCdfLogParetoType2_ffv_430;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_431> AgradCdfLogParetoType2_ffv_431;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_432> AgradCdfLogParetoType2_ffv_432;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_433> AgradCdfLogParetoType2_ffv_433;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_434> AgradCdfLogParetoType2_ffv_434;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_435> AgradCdfLogParetoType2_ffv_435;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_436> AgradCdfLogParetoType2_ffv_436;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_437> AgradCdfLogParetoType2_ffv_437;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_438> AgradCdfLogParetoType2_ffv_438;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_439> AgradCdfLogParetoType2_ffv_439;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_440> AgradCdfLogParetoType2_ffv_440;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_441> AgradCdfLogParetoType2_ffv_441;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_442> AgradCdfLogParetoType2_ffv_442;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_443> AgradCdfLogParetoType2_ffv_443;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_444> AgradCdfLogParetoType2_ffv_444;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_445> AgradCdfLogParetoType2_ffv_445;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_446> AgradCdfLogParetoType2_ffv_446;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_447> AgradCdfLogParetoType2_ffv_447;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_448> AgradCdfLogParetoType2_ffv_448;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_449> AgradCdfLogParetoType2_ffv_449;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_450> AgradCdfLogParetoType2_ffv_450;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_451> AgradCdfLogParetoType2_ffv_451;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_452> AgradCdfLogParetoType2_ffv_452;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_453> AgradCdfLogParetoType2_ffv_453;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_454> AgradCdfLogParetoType2_ffv_454;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_455> AgradCdfLogParetoType2_ffv_455;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_456> AgradCdfLogParetoType2_ffv_456;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_457> AgradCdfLogParetoType2_ffv_457;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_458> AgradCdfLogParetoType2_ffv_458;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_459> AgradCdfLogParetoType2_ffv_459;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_460> AgradCdfLogParetoType2_ffv_460;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_461> AgradCdfLogParetoType2_ffv_461;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_462> AgradCdfLogParetoType2_ffv_462;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_463> AgradCdfLogParetoType2_ffv_463;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_464> AgradCdfLogParetoType2_ffv_464;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_465> AgradCdfLogParetoType2_ffv_465;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_466> AgradCdfLogParetoType2_ffv_466;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_467> AgradCdfLogParetoType2_ffv_467;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_468> AgradCdfLogParetoType2_ffv_468;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_469> AgradCdfLogParetoType2_ffv_469;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_470> AgradCdfLogParetoType2_ffv_470;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_471> AgradCdfLogParetoType2_ffv_471;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_472> AgradCdfLogParetoType2_ffv_472;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_473> AgradCdfLogParetoType2_ffv_473;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_474> AgradCdfLogParetoType2_ffv_474;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_475> AgradCdfLogParetoType2_ffv_475;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_476> AgradCdfLogParetoType2_ffv_476;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_477> AgradCdfLogParetoType2_ffv_477;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_478> AgradCdfLogParetoType2_ffv_478;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_479> AgradCdfLogParetoType2_ffv_479;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_480> AgradCdfLogParetoType2_ffv_480;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_481> AgradCdfLogParetoType2_ffv_481;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_482> AgradCdfLogParetoType2_ffv_482;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_483> AgradCdfLogParetoType2_ffv_483;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_484> AgradCdfLogParetoType2_ffv_484;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_485> AgradCdfLogParetoType2_ffv_485;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_486> AgradCdfLogParetoType2_ffv_486;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_487> AgradCdfLogParetoType2_ffv_487;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_488> AgradCdfLogParetoType2_ffv_488;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_489> AgradCdfLogParetoType2_ffv_489;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_490> AgradCdfLogParetoType2_ffv_490;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_491> AgradCdfLogParetoType2_ffv_491;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_492> AgradCdfLogParetoType2_ffv_492;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_493> AgradCdfLogParetoType2_ffv_493;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_494> AgradCdfLogParetoType2_ffv_494;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_495> AgradCdfLogParetoType2_ffv_495;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_496> AgradCdfLogParetoType2_ffv_496;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_497> AgradCdfLogParetoType2_ffv_497;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_498> AgradCdfLogParetoType2_ffv_498;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_499> AgradCdfLogParetoType2_ffv_499;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_400, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_400);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_401, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_401);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_402, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_402);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_403, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_403);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_404, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_404);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_405, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_405);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_406, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_406);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_407, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_407);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_408, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_408);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_409, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_409);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_410, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_410);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_411, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_411);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_412, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_412);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_413, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_413);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_414, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_414);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_415, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_415);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_416, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_416);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_417, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_417);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_418, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_418);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_419, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_419);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_420, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_420);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_421, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_421);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_422, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_422);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_423, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_423);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_424, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_424);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_425, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_425);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_426, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_426);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_427, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_427);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_428, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_428);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_429, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_429);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_430, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_430);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_431, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_431);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_432, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_432);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_433, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_433);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_434, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_434);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_435, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_435);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_436, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_436);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_437, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_437);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_438, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_438);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_439, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_439);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_440, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_440);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_441, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_441);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_442, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_442);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_443, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_443);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_444, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_444);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_445, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_445);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_446, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_446);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_447, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_447);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_448, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_448);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_449, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_449);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_450, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_450);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_451, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_451);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_452, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_452);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_453, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_453);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_454, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_454);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_455, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_455);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_456, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_456);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_457, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_457);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_458, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_458);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_459, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_459);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_460, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_460);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_461, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_461);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_462, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_462);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_463, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_463);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_464, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_464);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_465, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_465);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_466, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_466);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_467, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_467);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_468, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_468);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_469, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_469);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_470, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_470);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_471, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_471);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_472, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_472);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_473, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_473);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_474, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_474);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_475, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_475);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_476, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_476);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_477, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_477);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_478, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_478);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_479, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_479);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_480, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_480);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_481, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_481);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_482, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_482);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_483, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_483);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_484, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_484);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_485, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_485);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_486, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_486);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_487, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_487);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_488, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_488);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_489, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_489);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_490, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_490);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_491, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_491);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_492, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_492);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_493, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_493);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_494, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_494);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_495, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_495);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_496, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_496);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_497, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_497);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_498, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_498);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_499, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_499);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_cdf_log_test.hpp>
+
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_400;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_401;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_402;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_403;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_404;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_405;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_406;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_407;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_408;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_409;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_410;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_411;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_412;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_413;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_414;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_415;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_416;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_417;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_418;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_419;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_420;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_421;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_422;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_423;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_424;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_425;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_426;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_427;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_428;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_429;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_430;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_431;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, double, empty, empty> type_v_432;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, std::vector<double>, empty, empty> type_v_433;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_434;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, var, empty, empty> type_v_435;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, std::vector<var>, empty, empty> type_v_436;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_437;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, double, empty, empty> type_v_438;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, std::vector<double>, empty, empty> type_v_439;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_440;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, var, empty, empty> type_v_441;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, std::vector<var>, empty, empty> type_v_442;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_443;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_444;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_445;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_446;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_447;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_448;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_449;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, double, empty, empty> type_v_450;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, std::vector<double>, empty, empty> type_v_451;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_452;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, var, empty, empty> type_v_453;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, std::vector<var>, empty, empty> type_v_454;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_455;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, double, empty, empty> type_v_456;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, std::vector<double>, empty, empty> type_v_457;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_458;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, var, empty, empty> type_v_459;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, std::vector<var>, empty, empty> type_v_460;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_461;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_462;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_463;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_464;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_465;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_466;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_467;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, double, empty, empty> type_v_468;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, std::vector<double>, empty, empty> type_v_469;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_470;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, var, empty, empty> type_v_471;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, std::vector<var>, empty, empty> type_v_472;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_473;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, double, empty, empty> type_v_474;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, std::vector<double>, empty, empty> type_v_475;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_476;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, var, empty, empty> type_v_477;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_v_478;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_479;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_480;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_481;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_482;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_483;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_484;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_485;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, double, empty, empty> type_v_486;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, std::vector<double>, empty, empty> type_v_487;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_488;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, var, empty, empty> type_v_489;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, std::vector<var>, empty, empty> type_v_490;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_491;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, double, empty, empty> type_v_492;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_v_493;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_494;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, var, empty, empty> type_v_495;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_v_496;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_497;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_498;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_499;
+
+typedef std::tuple<AgradCdfLogParetoType2, type_v_400> AgradCdfLogParetoType2_v_400;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_401> AgradCdfLogParetoType2_v_401;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_402> AgradCdfLogParetoType2_v_402;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_403> AgradCdfLogParetoType2_v_403;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_404> AgradCdfLogParetoType2_v_404;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_405> AgradCdfLogParetoType2_v_405;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_406> AgradCdfLogParetoType2_v_406;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_407> AgradCdfLogParetoType2_v_407;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_408> AgradCdfLogParetoType2_v_408;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_409> AgradCdfLogParetoType2_v_409;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_410> AgradCdfLogParetoType2_v_410;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_411> AgradCdfLogParetoType2_v_411;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_412> AgradCdfLogParetoType2_v_412;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_413> AgradCdfLogParetoType2_v_413;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_414> AgradCdfLogParetoType2_v_414;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_415> AgradCdfLogParetoType2_v_415;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_416> AgradCdfLogParetoType2_v_416;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_417> AgradCdfLogParetoType2_v_417;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_418> AgradCdfLogParetoType2_v_418;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_419> AgradCdfLogParetoType2_v_419;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_420> AgradCdfLogParetoType2_v_420;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_421> AgradCdfLogParetoType2_v_421;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_422> AgradCdfLogParetoType2_v_422;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_423> AgradCdfLogParetoType2_v_423;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_424> AgradCdfLogParetoType2_v_424;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_425> AgradCdfLogParetoType2_v_425;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_426> AgradCdfLogParetoType2_v_426;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_427> AgradCdfLogParetoType2_v_427;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_428> AgradCdfLogParetoType2_v_428;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_429> AgradCdfLogParetoType2_v_429;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_430> AgradCdfLogParetoType2_v_430;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_431> AgradCdfLogParetoType2_v_431;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_432> AgradCdfLogParetoType2_v_432;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_433> AgradCdfLogParetoType2_v_433;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_434> AgradCdfLogParetoType2_v_434;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_435> AgradCdfLogParetoType2_v_435;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_436> AgradCdfLogParetoType2_v_436;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_437> AgradCdfLogParetoType2_v_437;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_438> AgradCdfLogParetoType2_v_438;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_439> AgradCdfLogParetoType2_v_439;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_440> AgradCdfLogParetoType2_v_440;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_441> AgradCdfLogParetoType2_v_441;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_442> AgradCdfLogParetoType2_v_442;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_443> AgradCdfLogParetoType2_v_443;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_444> AgradCdfLogParetoType2_v_444;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_445> AgradCdfLogParetoType2_v_445;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_446> AgradCdfLogParetoType2_v_446;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_447> AgradCdfLogParetoType2_v_447;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_448> AgradCdfLogParetoType2_v_448;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_449> AgradCdfLogParetoType2_v_449;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_450> AgradCdfLogParetoType2_v_450;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_451> AgradCdfLogParetoType2_v_451;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_452> AgradCdfLogParetoType2_v_452;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_453> AgradCdfLogParetoType2_v_453;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_454> AgradCdfLogParetoType2_v_454;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_455> AgradCdfLogParetoType2_v_455;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_456> AgradCdfLogParetoType2_v_456;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_457> AgradCdfLogParetoType2_v_457;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_458> AgradCdfLogParetoType2_v_458;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_459> AgradCdfLogParetoType2_v_459;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_460> AgradCdfLogParetoType2_v_460;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_461> AgradCdfLogParetoType2_v_461;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_462> AgradCdfLogParetoType2_v_462;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_463> AgradCdfLogParetoType2_v_463;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_464> AgradCdfLogParetoType2_v_464;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_465> AgradCdfLogParetoType2_v_465;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_466> AgradCdfLogParetoType2_v_466;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_467> AgradCdfLogParetoType2_v_467;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_468> AgradCdfLogParetoType2_v_468;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_469> AgradCdfLogParetoType2_v_469;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_470> AgradCdfLogParetoType2_v_470;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_471> AgradCdfLogParetoType2_v_471;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_472> AgradCdfLogParetoType2_v_472;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_473> AgradCdfLogParetoType2_v_473;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_474> AgradCdfLogParetoType2_v_474;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_475> AgradCdfLogParetoType2_v_475;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_476> AgradCdfLogParetoType2_v_476;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_477> AgradCdfLogParetoType2_v_477;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_478> AgradCdfLogParetoType2_v_478;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_479> AgradCdfLogParetoType2_v_479;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_480> AgradCdfLogParetoType2_v_480;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_481> AgradCdfLogParetoType2_v_481;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_482> AgradCdfLogParetoType2_v_482;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_483> AgradCdfLogParetoType2_v_483;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_484> AgradCdfLogParetoType2_v_484;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_485> AgradCdfLogParetoType2_v_485;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_486> AgradCdfLogParetoType2_v_486;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_487> AgradCdfLogParetoType2_v_487;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_488> AgradCdfLogParetoType2_v_488;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_489> AgradCdfLogParetoType2_v_489;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_490> AgradCdfLogParetoType2_v_490;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_491> AgradCdfLogParetoType2_v_491;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_492> AgradCdfLogParetoType2_v_492;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_493> AgradCdfLogParetoType2_v_493;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_494> AgradCdfLogParetoType2_v_494;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_495> AgradCdfLogParetoType2_v_495;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_496> AgradCdfLogParetoType2_v_496;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_497> AgradCdfLogParetoType2_v_497;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_498> AgradCdfLogParetoType2_v_498;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_499> AgradCdfLogParetoType2_v_499;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_400, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_400);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_401, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_401);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_402, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_402);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_403, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_403);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_404, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_404);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_405, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_405);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_406, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_406);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_407, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_407);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_408, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_408);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_409, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_409);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_410, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_410);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_411, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_411);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_412, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_412);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_413, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_413);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_414, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_414);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_415, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_415);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_416, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_416);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_417, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_417);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_418, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_418);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_419, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_419);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_420, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_420);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_421, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_421);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_422, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_422);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_423, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_423);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_424, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_424);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_425, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_425);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_426, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_426);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_427, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_427);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_428, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_428);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_429, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_429);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_430, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_430);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_431, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_431);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_432, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_432);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_433, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_433);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_434, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_434);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_435, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_435);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_436, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_436);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_437, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_437);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_438, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_438);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_439, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_439);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_440, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_440);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_441, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_441);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_442, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_442);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_443, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_443);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_444, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_444);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_445, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_445);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_446, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_446);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_447, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_447);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_448, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_448);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_449, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_449);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_450, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_450);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_451, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_451);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_452, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_452);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_453, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_453);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_454, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_454);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_455, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_455);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_456, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_456);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_457, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_457);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_458, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_458);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_459, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_459);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_460, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_460);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_461, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_461);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_462, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_462);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_463, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_463);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_464, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_464);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_465, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_465);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_466, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_466);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_467, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_467);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_468, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_468);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_469, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_469);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_470, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_470);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_471, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_471);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_472, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_472);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_473, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_473);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_474, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_474);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_475, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_475);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_476, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_476);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_477, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_477);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_478, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_478);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_479, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_479);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_480, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_480);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_481, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_481);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_482, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_482);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_483, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_483);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_484, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_484);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_485, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_485);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_486, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_486);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_487, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_487);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_488, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_488);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_489, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_489);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_490, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_490);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_491, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_491);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_492, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_492);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_493, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_493);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_494, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_494);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_495, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_495);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_496, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_496);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_497, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_497);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_498, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_498);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_499, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_499);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_cdf_log_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_400;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_401;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_402;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_403;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_404;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, var, empty, empty> type_vv_405;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, std::vector<var>, empty, empty> type_vv_406;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_407;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, var, empty, empty> type_vv_408;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_vv_409;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_410;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_411;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_412;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_413;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, double, empty, empty> type_vv_414;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, std::vector<double>, empty, empty> type_vv_415;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_416;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, var, empty, empty> type_vv_417;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, std::vector<var>, empty, empty> type_vv_418;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_419;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, double, empty, empty> type_vv_420;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_vv_421;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_422;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, var, empty, empty> type_vv_423;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_vv_424;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_425;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_426;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_427;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_428;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_429;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_430;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_431;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_vv_432;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_vv_433;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_434;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_vv_435;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_vv_436;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_437;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_438;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_439;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_440;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_vv_441;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_vv_442;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_443;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_vv_444;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_vv_445;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_446;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_vv_447;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_vv_448;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_449;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_vv_450;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_vv_451;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_452;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_453;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_454;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_455;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_456;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_457;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_458;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, double, empty, empty> type_vv_459;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, std::vector<double>, empty, empty> type_vv_460;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_461;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, var, empty, empty> type_vv_462;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, std::vector<var>, empty, empty> type_vv_463;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_464;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, double, empty, empty> type_vv_465;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, std::vector<double>, empty, empty> type_vv_466;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_467;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, var, empty, empty> type_vv_468;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, std::vector<var>, empty, empty> type_vv_469;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_470;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_471;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_472;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_473;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_474;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_475;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_476;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, double, empty, empty> type_vv_477;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, std::vector<double>, empty, empty> type_vv_478;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_479;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, var, empty, empty> type_vv_480;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, std::vector<var>, empty, empty> type_vv_481;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_482;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, double, empty, empty> type_vv_483;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, std::vector<double>, empty, empty> type_vv_484;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_485;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, var, empty, empty> type_vv_486;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, std::vector<var>, empty, empty> type_vv_487;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_488;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_489;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_490;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_491;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_492;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_493;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_494;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, double, empty, empty> type_vv_495;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, std::vector<double>, empty, empty> type_vv_496;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_497;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, var, empty, empty> type_vv_498;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, std::vector<var>, empty, empty> type_vv_499;
+
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_400> AgradCdfLogParetoType2_vv_400;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_401> AgradCdfLogParetoType2_vv_401;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_402> AgradCdfLogParetoType2_vv_402;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_403> AgradCdfLogParetoType2_vv_403;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_404> AgradCdfLogParetoType2_vv_404;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_405> AgradCdfLogParetoType2_vv_405;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_406> AgradCdfLogParetoType2_vv_406;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_407> AgradCdfLogParetoType2_vv_407;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_408> AgradCdfLogParetoType2_vv_408;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_409> AgradCdfLogParetoType2_vv_409;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_410> AgradCdfLogParetoType2_vv_410;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_411> AgradCdfLogParetoType2_vv_411;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_412> AgradCdfLogParetoType2_vv_412;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_413> AgradCdfLogParetoType2_vv_413;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_414> AgradCdfLogParetoType2_vv_414;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_415> AgradCdfLogParetoType2_vv_415;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_416> AgradCdfLogParetoType2_vv_416;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_417> AgradCdfLogParetoType2_vv_417;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_418> AgradCdfLogParetoType2_vv_418;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_419> AgradCdfLogParetoType2_vv_419;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_420> AgradCdfLogParetoType2_vv_420;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_421> AgradCdfLogParetoType2_vv_421;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_422> AgradCdfLogParetoType2_vv_422;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_423> AgradCdfLogParetoType2_vv_423;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_424> AgradCdfLogParetoType2_vv_424;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_425> AgradCdfLogParetoType2_vv_425;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_426> AgradCdfLogParetoType2_vv_426;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_427> AgradCdfLogParetoType2_vv_427;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_428> AgradCdfLogParetoType2_vv_428;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_429> AgradCdfLogParetoType2_vv_429;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_430> AgradCdfLogParetoType2_vv_430;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_431> AgradCdfLogParetoType2_vv_431;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_432> AgradCdfLogParetoType2_vv_432;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_433> AgradCdfLogParetoType2_vv_433;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_434> AgradCdfLogParetoType2_vv_434;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_435> AgradCdfLogParetoType2_vv_435;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_436> AgradCdfLogParetoType2_vv_436;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_437> AgradCdfLogParetoType2_vv_437;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_438> AgradCdfLogParetoType2_vv_438;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_439> AgradCdfLogParetoType2_vv_439;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_440> AgradCdfLogParetoType2_vv_440;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_441> AgradCdfLogParetoType2_vv_441;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_442> AgradCdfLogParetoType2_vv_442;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_443> AgradCdfLogParetoType2_vv_443;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_444> AgradCdfLogParetoType2_vv_444;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_445> AgradCdfLogParetoType2_vv_445;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_446> AgradCdfLogParetoType2_vv_446;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_447> AgradCdfLogParetoType2_vv_447;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_448> AgradCdfLogParetoType2_vv_448;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_449> AgradCdfLogParetoType2_vv_449;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_450> AgradCdfLogParetoType2_vv_450;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_451> AgradCdfLogParetoType2_vv_451;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_452> AgradCdfLogParetoType2_vv_452;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_453> AgradCdfLogParetoType2_vv_453;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_454> AgradCdfLogParetoType2_vv_454;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_455> AgradCdfLogParetoType2_vv_455;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_456> AgradCdfLogParetoType2_vv_456;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_457> AgradCdfLogParetoType2_vv_457;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_458> AgradCdfLogParetoType2_vv_458;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_459> AgradCdfLogParetoType2_vv_459;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_460> AgradCdfLogParetoType2_vv_460;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_461> AgradCdfLogParetoType2_vv_461;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_462> AgradCdfLogParetoType2_vv_462;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_463> AgradCdfLogParetoType2_vv_463;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_464> AgradCdfLogParetoType2_vv_464;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_465> AgradCdfLogParetoType2_vv_465;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_466> AgradCdfLogParetoType2_vv_466;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_467> AgradCdfLogParetoType2_vv_467;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_468> AgradCdfLogParetoType2_vv_468;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_469> AgradCdfLogParetoType2_vv_469;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_470> AgradCdfLogParetoType2_vv_470;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_471> AgradCdfLogParetoType2_vv_471;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_472> AgradCdfLogParetoType2_vv_472;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_473> AgradCdfLogParetoType2_vv_473;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_474> AgradCdfLogParetoType2_vv_474;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_475> AgradCdfLogParetoType2_vv_475;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_476> AgradCdfLogParetoType2_vv_476;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_477> AgradCdfLogParetoType2_vv_477;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_478> AgradCdfLogParetoType2_vv_478;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_479> AgradCdfLogParetoType2_vv_479;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_480> AgradCdfLogParetoType2_vv_480;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_481> AgradCdfLogParetoType2_vv_481;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_482> AgradCdfLogParetoType2_vv_482;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_483> AgradCdfLogParetoType2_vv_483;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_484> AgradCdfLogParetoType2_vv_484;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_485> AgradCdfLogParetoType2_vv_485;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_486> AgradCdfLogParetoType2_vv_486;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_487> AgradCdfLogParetoType2_vv_487;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_488> AgradCdfLogParetoType2_vv_488;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_489> AgradCdfLogParetoType2_vv_489;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_490> AgradCdfLogParetoType2_vv_490;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_491> AgradCdfLogParetoType2_vv_491;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_492> AgradCdfLogParetoType2_vv_492;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_493> AgradCdfLogParetoType2_vv_493;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_494> AgradCdfLogParetoType2_vv_494;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_495> AgradCdfLogParetoType2_vv_495;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_496> AgradCdfLogParetoType2_vv_496;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_497> AgradCdfLogParetoType2_vv_497;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_498> AgradCdfLogParetoType2_vv_498;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_499> AgradCdfLogParetoType2_vv_499;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_400, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_400);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_401, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_401);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_402, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_402);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_403, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_403);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_404, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_404);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_405, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_405);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_406, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_406);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_407, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_407);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_408, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_408);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_409, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_409);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_410, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_410);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_411, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_411);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_412, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_412);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_413, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_413);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_414, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_414);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_415, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_415);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_416, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_416);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_417, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_417);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_418, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_418);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_419, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_419);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_420, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_420);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_421, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_421);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_422, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_422);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_423, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_423);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_424, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_424);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_425, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_425);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_426, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_426);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_427, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_427);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_428, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_428);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_429, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_429);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_430, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_430);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_431, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_431);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_432, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_432);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_433, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_433);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_434, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_434);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_435, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_435);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_436, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_436);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_437, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_437);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_438, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_438);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_439, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_439);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_440, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_440);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_441, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_441);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_442, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_442);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_443, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_443);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_444, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_444);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_445, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_445);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_446, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_446);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_447, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_447);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_448, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_448);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_449, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_449);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_450, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_450);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_451, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_451);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_452, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_452);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_453, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_453);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_454, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_454);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_455, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_455);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_456, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_456);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_457, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_457);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_458, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_458);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_459, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_459);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_460, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_460);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_461, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_461);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_462, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_462);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_463, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_463);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_464, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_464);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_465, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_465);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_466, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_466);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_467, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_467);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_468, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_468);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_469, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_469);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_470, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_470);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_471, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_471);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_472, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_472);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_473, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_473);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_474, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_474);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_475, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_475);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_476, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_476);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_477, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_477);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_478, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_478);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_479, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_479);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_480, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_480);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_481, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_481);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_482, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_482);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_483, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_483);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_484, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_484);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_485, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_485);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_486, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_486);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_487, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_487);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_488, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_488);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_489, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_489);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_490, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_490);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_491, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_491);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_492, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_492);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_493, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_493);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_494, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_494);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_495, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_495);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_496, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_496);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_497, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_497);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_498, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_498);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_499, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_499);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_cdf_log_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_500;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty, empty> type_ffv_501;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_502;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_503;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_504;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_505;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_506;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_507;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_508;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_509;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_510;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_511;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_512;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty, empty> type_ffv_513;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_514;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_515;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_516;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_517;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_518;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_519;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_520;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_521;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_522;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_523;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_524;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_525;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_526;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_527;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_528;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_529;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_530;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty, empty> type_ffv_531;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_ffv_532;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_533;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_534;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_535;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_536;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_ffv_537;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_538;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_539;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_540;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_541;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_542;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_543;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_544;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_545;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_546;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_547;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_548;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_549;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_550;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_551;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_552;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_553;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_554;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_555;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_556;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_557;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_558;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_559;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_560;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_561;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_562;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_563;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_564;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_565;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_566;
+typedef std::tuple<fvar<fvar<var> >, double, double, double, empty, empty> type_ffv_567;
+typedef std::tuple<fvar<fvar<var> >, double, double, std::vector<double>, empty, empty> type_ffv_568;
+typedef std::tuple<fvar<fvar<var> >, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_569;
+typedef std::tuple<fvar<fvar<var> >, double, double, fvar<fvar<var> >, empty, empty> type_ffv_570;
+typedef std::tuple<fvar<fvar<var> >, double, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_571;
+typedef std::tuple<fvar<fvar<var> >, double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_572;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<double>, double, empty, empty> type_ffv_573;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<double>, std::vector<double>, empty, empty> type_ffv_574;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_575;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_576;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_577;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_578;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_579;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_580;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_581;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_582;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_583;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_584;
+typedef std::tuple<fvar<fvar<var> >, double, fvar<fvar<var> >, double, empty, empty> type_ffv_585;
+typedef std::tuple<fvar<fvar<var> >, double, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_586;
+typedef std::tuple<fvar<fvar<var> >, double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_587;
+typedef std::tuple<fvar<fvar<var> >, double, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_588;
+typedef std::tuple<fvar<fvar<var> >, double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_589;
+typedef std::tuple<fvar<fvar<var> >, double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_590;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_591;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_592;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_593;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_594;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_595;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_596;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_597;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_598;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_599;
+
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_500> AgradCdfLogParetoType2_ffv_500;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_501> AgradCdfLogParetoType2_ffv_501;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_502> AgradCdfLogParetoType2_ffv_502;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_503> AgradCdfLogParetoType2_ffv_503;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_504> AgradCdfLogParetoType2_ffv_504;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_505> AgradCdfLogParetoType2_ffv_505;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_506> AgradCdfLogParetoType2_ffv_506;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_507> AgradCdfLogParetoType2_ffv_507;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_508> AgradCdfLogParetoType2_ffv_508;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_509> AgradCdfLogParetoType2_ffv_509;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_510> AgradCdfLogParetoType2_ffv_510;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_511> AgradCdfLogParetoType2_ffv_511;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_512> AgradCdfLogParetoType2_ffv_512;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_513> AgradCdfLogParetoType2_ffv_513;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_514> AgradCdfLogParetoType2_ffv_514;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_515> AgradCdfLogParetoType2_ffv_515;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_516> AgradCdfLogParetoType2_ffv_516;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_517> AgradCdfLogParetoType2_ffv_517;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_518> AgradCdfLogParetoType2_ffv_518;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_519> AgradCdfLogParetoType2_ffv_519;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_520> AgradCdfLogParetoType2_ffv_520;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_521> AgradCdfLogParetoType2_ffv_521;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_522> AgradCdfLogParetoType2_ffv_522;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_523> AgradCdfLogParetoType2_ffv_523;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_524> AgradCdfLogParetoType2_ffv_524;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_525> AgradCdfLogParetoType2_ffv_525;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_526> AgradCdfLogParetoType2_ffv_526;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_527> AgradCdfLogParetoType2_ffv_527;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_528> AgradCdfLogParetoType2_ffv_528;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_529> AgradCdfLogParetoType2_ffv_529;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_530> AgradCdfLogParetoType2_ffv_530;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_531> AgradCdfLogParetoType2_ffv_531;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_532> AgradCdfLogParetoType2_ffv_532;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_533> AgradCdfLogParetoType2_ffv_533;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_534> AgradCdfLogParetoType2_ffv_534;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_535> AgradCdfLogParetoType2_ffv_535;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_536> AgradCdfLogParetoType2_ffv_536;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_537> AgradCdfLogParetoType2_ffv_537;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_538> AgradCdfLogParetoType2_ffv_538;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_539> AgradCdfLogParetoType2_ffv_539;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_540> AgradCdfLogParetoType2_ffv_540;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_541> AgradCdfLogParetoType2_ffv_541;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_542> AgradCdfLogParetoType2_ffv_542;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_543> AgradCdfLogParetoType2_ffv_543;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_544> AgradCdfLogParetoType2_ffv_544;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_545> AgradCdfLogParetoType2_ffv_545;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_546> AgradCdfLogParetoType2_ffv_546;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_547> AgradCdfLogParetoType2_ffv_547;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_548> AgradCdfLogParetoType2_ffv_548;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_549> AgradCdfLogParetoType2_ffv_549;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_550> AgradCdfLogParetoType2_ffv_550;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_551> AgradCdfLogParetoType2_ffv_551;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_552> AgradCdfLogParetoType2_ffv_552;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_553> AgradCdfLogParetoType2_ffv_553;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_554> AgradCdfLogParetoType2_ffv_554;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_555> AgradCdfLogParetoType2_ffv_555;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_556> AgradCdfLogParetoType2_ffv_556;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_557> AgradCdfLogParetoType2_ffv_557;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_558> AgradCdfLogParetoType2_ffv_558;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_559> AgradCdfLogParetoType2_ffv_559;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_560> AgradCdfLogParetoType2_ffv_560;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_561> AgradCdfLogParetoType2_ffv_561;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_562> AgradCdfLogParetoType2_ffv_562;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_563> AgradCdfLogParetoType2_ffv_563;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_564> AgradCdfLogParetoType2_ffv_564;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_565> AgradCdfLogParetoType2_ffv_565;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_566> AgradCdfLogParetoType2_ffv_566;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_567> AgradCdfLogParetoType2_ffv_567;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_568> AgradCdfLogParetoType2_ffv_568;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_569> AgradCdfLogParetoType2_ffv_569;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_570> AgradCdfLogParetoType2_ffv_570;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_571> AgradCdfLogParetoType2_ffv_571;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_572> AgradCdfLogParetoType2_ffv_572;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_573> AgradCdfLogParetoType2_ffv_573;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_574> AgradCdfLogParetoType2_ffv_574;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_575> AgradCdfLogParetoType2_ffv_575;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_576> AgradCdfLogParetoType2_ffv_576;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_577> AgradCdfLogParetoType2_ffv_577;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_578> AgradCdfLogParetoType2_ffv_578;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_579> AgradCdfLogParetoType2_ffv_579;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_580> AgradCdfLogParetoType2_ffv_580;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_581> AgradCdfLogParetoType2_ffv_581;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_582> AgradCdfLogParetoType2_ffv_582;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_583> AgradCdfLogParetoType2_ffv_583;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_584> AgradCdfLogParetoType2_ffv_584;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_585> AgradCdfLogParetoType2_ffv_585;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_586> AgradCdfLogParetoType2_ffv_586;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_587> AgradCdfLogParetoType2_ffv_587;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_588> AgradCdfLogParetoType2_ffv_588;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_589> AgradCdfLogParetoType2_ffv_589;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_590> AgradCdfLogParetoType2_ffv_590;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_591> AgradCdfLogParetoType2_ffv_591;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_592> AgradCdfLogParetoType2_ffv_592;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_593> AgradCdfLogParetoType2_ffv_593;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_594> AgradCdfLogParetoType2_ffv_594;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_595> AgradCdfLogParetoType2_ffv_595;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_596> AgradCdfLogParetoType2_ffv_596;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_597> AgradCdfLogParetoType2_ffv_597;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_598> AgradCdfLogParetoType2_ffv_598;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_599> AgradCdfLogParetoType2_ffv_599;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_500, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_500);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_501, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_501);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_502, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_502);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_503, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_503);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_504, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_504);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_505, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_505);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_506, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_506);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_507, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_507);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_508, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_508);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_509, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_509);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_510, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_510);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_511, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_511);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_512, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_512);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_513, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_513);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_514, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_514);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_515, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_515);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_516, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_516);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_517, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_517);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_518, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_518);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_519, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_519);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_520, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_520);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_521, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_521);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_522, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_522);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_523, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_523);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_524, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_524);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_525, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_525);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_526, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_526);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_527, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_527);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_528, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_528);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_529, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_529);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_530, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_530);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_531, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_531);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_532, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_532);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_533, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_533);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_534, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_534);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_535, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_535);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_536, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_536);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_537, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_537);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_538, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_538);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_539, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_539);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_540, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_540);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_541, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_541);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_542, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_542);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_543, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_543);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_544, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_544);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_545, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_545);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_546, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_546);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_547, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_547);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_548, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_548);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_549, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_549);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_550, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_550);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_551, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_551);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_552, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_552);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_553, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_553);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_554, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_554);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_555, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_555);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_556, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_556);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_557, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_557);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_558, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_558);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_559, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_559);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_560, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_560);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_561, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_561);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_562, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_562);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_563, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_563);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_564, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_564);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_565, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_565);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_566, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_566);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_567, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_567);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_568, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_568);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_569, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_569);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_570, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_570);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_571, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_571);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_572, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_572);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_573, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_573);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_574, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_574);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_575, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_575);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_576, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_576);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_577, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_577);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_578, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_578);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_579, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_579);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_580, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_580);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_581, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_581);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_582, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_582);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_583, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_583);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_584, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_584);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_585, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_585);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_586, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_586);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_587, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_587);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_588, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_588);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_589, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_589);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_590, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_590);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_591, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_591);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_592, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_592);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_593, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_593);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_594, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_594);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_595, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_595);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_596, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_596);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_597, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_597);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_598, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_598);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_599, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_599);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_cdf_log_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_500;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_501;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_502;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_503;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_504;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_505;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_506;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_507;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_508;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_509;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_510;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_511;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_512;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_513;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_514;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_515;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_516;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_517;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_518;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_519;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_520;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_521;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_522;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_523;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_524;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_525;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_526;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_527;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_528;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_529;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_530;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_531;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_532;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_533;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_534;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_535;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_536;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_537;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_538;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_539;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, double, empty, empty> type_v_540;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, std::vector<double>, empty, empty> type_v_541;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_542;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, var, empty, empty> type_v_543;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, std::vector<var>, empty, empty> type_v_544;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_545;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, double, empty, empty> type_v_546;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, std::vector<double>, empty, empty> type_v_547;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_548;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, var, empty, empty> type_v_549;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, std::vector<var>, empty, empty> type_v_550;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_551;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_552;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_553;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_554;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_555;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_556;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_557;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, double, empty, empty> type_v_558;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, std::vector<double>, empty, empty> type_v_559;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_560;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, var, empty, empty> type_v_561;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, std::vector<var>, empty, empty> type_v_562;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_563;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, double, empty, empty> type_v_564;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, std::vector<double>, empty, empty> type_v_565;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_566;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, var, empty, empty> type_v_567;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, std::vector<var>, empty, empty> type_v_568;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_569;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_570;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_571;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_572;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_573;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_574;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_575;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, double, empty, empty> type_v_576;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, std::vector<double>, empty, empty> type_v_577;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_578;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, var, empty, empty> type_v_579;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, std::vector<var>, empty, empty> type_v_580;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_581;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, double, empty, empty> type_v_582;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_v_583;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_584;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, var, empty, empty> type_v_585;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_v_586;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_587;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_588;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_589;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_590;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_591;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_592;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_593;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, double, empty, empty> type_v_594;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, std::vector<double>, empty, empty> type_v_595;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_596;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, var, empty, empty> type_v_597;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, std::vector<var>, empty, empty> type_v_598;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_599;
+
+typedef std::tuple<AgradCdfLogParetoType2, type_v_500> AgradCdfLogParetoType2_v_500;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_501> AgradCdfLogParetoType2_v_501;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_502> AgradCdfLogParetoType2_v_502;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_503> AgradCdfLogParetoType2_v_503;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_504> AgradCdfLogParetoType2_v_504;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_505> AgradCdfLogParetoType2_v_505;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_506> AgradCdfLogParetoType2_v_506;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_507> AgradCdfLogParetoType2_v_507;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_508> AgradCdfLogParetoType2_v_508;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_509> AgradCdfLogParetoType2_v_509;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_510> AgradCdfLogParetoType2_v_510;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_511> AgradCdfLogParetoType2_v_511;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_512> AgradCdfLogParetoType2_v_512;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_513> AgradCdfLogParetoType2_v_513;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_514> AgradCdfLogParetoType2_v_514;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_515> AgradCdfLogParetoType2_v_515;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_516> AgradCdfLogParetoType2_v_516;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_517> AgradCdfLogParetoType2_v_517;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_518> AgradCdfLogParetoType2_v_518;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_519> AgradCdfLogParetoType2_v_519;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_520> AgradCdfLogParetoType2_v_520;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_521> AgradCdfLogParetoType2_v_521;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_522> AgradCdfLogParetoType2_v_522;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_523> AgradCdfLogParetoType2_v_523;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_524> AgradCdfLogParetoType2_v_524;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_525> AgradCdfLogParetoType2_v_525;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_526> AgradCdfLogParetoType2_v_526;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_527> AgradCdfLogParetoType2_v_527;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_528> AgradCdfLogParetoType2_v_528;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_529> AgradCdfLogParetoType2_v_529;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_530> AgradCdfLogParetoType2_v_530;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_531> AgradCdfLogParetoType2_v_531;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_532> AgradCdfLogParetoType2_v_532;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_533> AgradCdfLogParetoType2_v_533;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_534> AgradCdfLogParetoType2_v_534;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_535> AgradCdfLogParetoType2_v_535;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_536> AgradCdfLogParetoType2_v_536;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_537> AgradCdfLogParetoType2_v_537;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_538> AgradCdfLogParetoType2_v_538;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_539> AgradCdfLogParetoType2_v_539;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_540> AgradCdfLogParetoType2_v_540;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_541> AgradCdfLogParetoType2_v_541;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_542> AgradCdfLogParetoType2_v_542;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_543> AgradCdfLogParetoType2_v_543;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_544> AgradCdfLogParetoType2_v_544;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_545> AgradCdfLogParetoType2_v_545;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_546> AgradCdfLogParetoType2_v_546;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_547> AgradCdfLogParetoType2_v_547;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_548> AgradCdfLogParetoType2_v_548;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_549> AgradCdfLogParetoType2_v_549;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_550> AgradCdfLogParetoType2_v_550;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_551> AgradCdfLogParetoType2_v_551;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_552> AgradCdfLogParetoType2_v_552;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_553> AgradCdfLogParetoType2_v_553;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_554> AgradCdfLogParetoType2_v_554;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_555> AgradCdfLogParetoType2_v_555;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_556> AgradCdfLogParetoType2_v_556;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_557> AgradCdfLogParetoType2_v_557;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_558> AgradCdfLogParetoType2_v_558;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_559> AgradCdfLogParetoType2_v_559;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_560> AgradCdfLogParetoType2_v_560;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_561> AgradCdfLogParetoType2_v_561;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_562> AgradCdfLogParetoType2_v_562;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_563> AgradCdfLogParetoType2_v_563;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_564> AgradCdfLogParetoType2_v_564;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_565> AgradCdfLogParetoType2_v_565;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_566> AgradCdfLogParetoType2_v_566;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_567> AgradCdfLogParetoType2_v_567;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_568> AgradCdfLogParetoType2_v_568;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_569> AgradCdfLogParetoType2_v_569;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_570> AgradCdfLogParetoType2_v_570;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_571> AgradCdfLogParetoType2_v_571;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_572> AgradCdfLogParetoType2_v_572;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_573> AgradCdfLogParetoType2_v_573;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_574> AgradCdfLogParetoType2_v_574;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_575> AgradCdfLogParetoType2_v_575;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_576> AgradCdfLogParetoType2_v_576;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_577> AgradCdfLogParetoType2_v_577;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_578> AgradCdfLogParetoType2_v_578;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_579> AgradCdfLogParetoType2_v_579;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_580> AgradCdfLogParetoType2_v_580;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_581> AgradCdfLogParetoType2_v_581;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_582> AgradCdfLogParetoType2_v_582;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_583> AgradCdfLogParetoType2_v_583;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_584> AgradCdfLogParetoType2_v_584;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_585> AgradCdfLogParetoType2_v_585;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_586> AgradCdfLogParetoType2_v_586;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_587> AgradCdfLogParetoType2_v_587;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_588> AgradCdfLogParetoType2_v_588;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_589> AgradCdfLogParetoType2_v_589;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_590> AgradCdfLogParetoType2_v_590;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_591> AgradCdfLogParetoType2_v_591;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_592> AgradCdfLogParetoType2_v_592;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_593> AgradCdfLogParetoType2_v_593;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_594> AgradCdfLogParetoType2_v_594;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_595> AgradCdfLogParetoType2_v_595;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_596> AgradCdfLogParetoType2_v_596;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_597> AgradCdfLogParetoType2_v_597;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_598> AgradCdfLogParetoType2_v_598;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_599> AgradCdfLogParetoType2_v_599;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_500, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_500);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_501, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_501);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_502, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_502);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_503, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_503);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_504, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_504);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_505, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_505);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_506, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_506);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_507, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_507);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_508, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_508);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_509, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_509);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_510, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_510);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_511, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_511);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_512, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_512);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_513, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_513);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_514, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_514);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_515, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_515);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_516, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_516);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_517, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_517);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_518, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_518);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_519, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_519);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_520, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_520);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_521, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_521);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_522, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_522);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_523, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_523);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_524, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_524);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_525, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_525);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_526, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_526);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_527, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_527);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_528, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_528);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_529, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_529);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_530, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_530);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_531, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_531);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_532, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_532);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_533, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_533);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_534, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_534);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_535, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_535);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_536, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_536);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_537, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_537);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_538, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_538);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_539, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_539);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_540, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_540);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_541, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_541);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_542, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_542);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_543, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_543);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_544, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_544);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_545, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_545);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_546, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_546);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_547, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_547);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_548, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_548);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_549, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_549);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_550, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_550);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_551, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_551);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_552, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_552);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_553, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_553);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_554, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_554);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_555, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_555);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_556, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_556);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_557, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_557);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_558, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_558);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_559, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_559);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_560, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_560);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_561, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_561);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_562, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_562);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_563, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_563);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_564, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_564);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_565, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_565);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_566, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_566);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_567, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_567);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_568, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_568);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_569, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_569);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_570, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_570);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_571, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_571);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_572, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_572);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_573, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_573);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_574, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_574);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_575, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_575);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_576, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_576);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_577, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_577);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_578, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_578);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_579, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_579);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_580, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_580);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_581, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_581);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_582, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_582);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_583, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_583);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_584, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_584);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_585, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_585);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_586, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_586);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_587, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_587);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_588, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_588);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_589, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_589);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_590, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_590);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_591, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_591);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_592, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_592);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_593, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_593);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_594, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_594);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_595, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_595);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_596, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_596);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_597, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_597);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_598, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_598);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_599, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_599);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_cdf_log_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_500;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, double, empty, empty> type_vv_501;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_vv_502;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_503;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, var, empty, empty> type_vv_504;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_vv_505;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_506;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_507;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_508;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_509;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_510;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_511;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_512;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, double, empty, empty> type_vv_513;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, std::vector<double>, empty, empty> type_vv_514;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_515;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, var, empty, empty> type_vv_516;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, std::vector<var>, empty, empty> type_vv_517;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_518;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, double, empty, empty> type_vv_519;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_vv_520;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_521;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, var, empty, empty> type_vv_522;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_vv_523;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_524;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_525;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_526;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_527;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_528;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_529;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_530;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, empty, empty> type_vv_531;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, empty, empty> type_vv_532;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_533;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, empty, empty> type_vv_534;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, empty, empty> type_vv_535;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_536;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, empty, empty> type_vv_537;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, empty, empty> type_vv_538;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_539;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, empty, empty> type_vv_540;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, empty, empty> type_vv_541;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_542;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_543;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_544;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_545;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_546;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_547;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_548;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, empty, empty> type_vv_549;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, empty, empty> type_vv_550;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_551;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, empty, empty> type_vv_552;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, empty, empty> type_vv_553;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_554;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, empty, empty> type_vv_555;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, empty, empty> type_vv_556;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_557;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, empty, empty> type_vv_558;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, empty, empty> type_vv_559;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_560;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_561;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_562;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_563;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_564;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_565;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_566;
+typedef std::tuple<var, double, double, double, empty, empty> type_vv_567;
+typedef std::tuple<var, double, double, std::vector<double>, empty, empty> type_vv_568;
+typedef std::tuple<var, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_569;
+typedef std::tuple<var, double, double, var, empty, empty> type_vv_570;
+typedef std::tuple<var, double, double, std::vector<var>, empty, empty> type_vv_571;
+typedef std::tuple<var, double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_572;
+typedef std::tuple<var, double, std::vector<double>, double, empty, empty> type_vv_573;
+typedef std::tuple<var, double, std::vector<double>, std::vector<double>, empty, empty> type_vv_574;
+typedef std::tuple<var, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_575;
+typedef std::tuple<var, double, std::vector<double>, var, empty, empty> type_vv_576;
+typedef std::tuple<var, double, std::vector<double>, std::vector<var>, empty, empty> type_vv_577;
+typedef std::tuple<var, double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_578;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_579;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_580;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_581;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_582;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_583;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_584;
+typedef std::tuple<var, double, var, double, empty, empty> type_vv_585;
+typedef std::tuple<var, double, var, std::vector<double>, empty, empty> type_vv_586;
+typedef std::tuple<var, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_587;
+typedef std::tuple<var, double, var, var, empty, empty> type_vv_588;
+typedef std::tuple<var, double, var, std::vector<var>, empty, empty> type_vv_589;
+typedef std::tuple<var, double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_590;
+typedef std::tuple<var, double, std::vector<var>, double, empty, empty> type_vv_591;
+typedef std::tuple<var, double, std::vector<var>, std::vector<double>, empty, empty> type_vv_592;
+typedef std::tuple<var, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_593;
+typedef std::tuple<var, double, std::vector<var>, var, empty, empty> type_vv_594;
+typedef std::tuple<var, double, std::vector<var>, std::vector<var>, empty, empty> type_vv_595;
+typedef std::tuple<var, double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_596;
+typedef std::tuple<var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_597;
+typedef std::tuple<var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_598;
+typedef std::tuple<var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_599;
+
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_500> AgradCdfLogParetoType2_vv_500;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_501> AgradCdfLogParetoType2_vv_501;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_502> AgradCdfLogParetoType2_vv_502;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_503> AgradCdfLogParetoType2_vv_503;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_504> AgradCdfLogParetoType2_vv_504;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_505> AgradCdfLogParetoType2_vv_505;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_506> AgradCdfLogParetoType2_vv_506;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_507> AgradCdfLogParetoType2_vv_507;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_508> AgradCdfLogParetoType2_vv_508;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_509> AgradCdfLogParetoType2_vv_509;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_510> AgradCdfLogParetoType2_vv_510;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_511> AgradCdfLogParetoType2_vv_511;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_512> AgradCdfLogParetoType2_vv_512;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_513> AgradCdfLogParetoType2_vv_513;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_514> AgradCdfLogParetoType2_vv_514;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_515> AgradCdfLogParetoType2_vv_515;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_516> AgradCdfLogParetoType2_vv_516;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_517> AgradCdfLogParetoType2_vv_517;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_518> AgradCdfLogParetoType2_vv_518;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_519> AgradCdfLogParetoType2_vv_519;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_520> AgradCdfLogParetoType2_vv_520;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_521> AgradCdfLogParetoType2_vv_521;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_522> AgradCdfLogParetoType2_vv_522;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_523> AgradCdfLogParetoType2_vv_523;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_524> AgradCdfLogParetoType2_vv_524;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_525> AgradCdfLogParetoType2_vv_525;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_526> AgradCdfLogParetoType2_vv_526;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_527> AgradCdfLogParetoType2_vv_527;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_528> AgradCdfLogParetoType2_vv_528;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_529> AgradCdfLogParetoType2_vv_529;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_530> AgradCdfLogParetoType2_vv_530;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_531> AgradCdfLogParetoType2_vv_531;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_532> AgradCdfLogParetoType2_vv_532;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_533> AgradCdfLogParetoType2_vv_533;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_534> AgradCdfLogParetoType2_vv_534;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_535> AgradCdfLogParetoType2_vv_535;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_536> AgradCdfLogParetoType2_vv_536;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_537> AgradCdfLogParetoType2_vv_537;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_538> AgradCdfLogParetoType2_vv_538;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_539> AgradCdfLogParetoType2_vv_539;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_540> AgradCdfLogParetoType2_vv_540;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_541> AgradCdfLogParetoType2_vv_541;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_542> AgradCdfLogParetoType2_vv_542;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_543> AgradCdfLogParetoType2_vv_543;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_544> AgradCdfLogParetoType2_vv_544;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_545> AgradCdfLogParetoType2_vv_545;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_546> AgradCdfLogParetoType2_vv_546;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_547> AgradCdfLogParetoType2_vv_547;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_548> AgradCdfLogParetoType2_vv_548;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_549> AgradCdfLogParetoType2_vv_549;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_550> AgradCdfLogParetoType2_vv_550;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_551> AgradCdfLogParetoType2_vv_551;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_552> AgradCdfLogParetoType2_vv_552;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_553> AgradCdfLogParetoType2_vv_553;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_554> AgradCdfLogParetoType2_vv_554;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_555> AgradCdfLogParetoType2_vv_555;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_556> AgradCdfLogParetoType2_vv_556;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_557> AgradCdfLogParetoType2_vv_557;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_558> AgradCdfLogParetoType2_vv_558;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_559> AgradCdfLogParetoType2_vv_559;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_560> AgradCdfLogParetoType2_vv_560;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_561> AgradCdfLogParetoType2_vv_561;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_562> AgradCdfLogParetoType2_vv_562;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_563> AgradCdfLogParetoType2_vv_563;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_564> AgradCdfLogParetoType2_vv_564;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_565> AgradCdfLogParetoType2_vv_565;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_566> AgradCdfLogParetoType2_vv_566;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_567> AgradCdfLogParetoType2_vv_567;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_568> AgradCdfLogParetoType2_vv_568;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_569> AgradCdfLogParetoType2_vv_569;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_570> AgradCdfLogParetoType2_vv_570;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_571> AgradCdfLogParetoType2_vv_571;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_572> AgradCdfLogParetoType2_vv_572;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_573> AgradCdfLogParetoType2_vv_573;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_574> AgradCdfLogParetoType2_vv_574;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_575> AgradCdfLogParetoType2_vv_575;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_576> AgradCdfLogParetoType2_vv_576;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_577> AgradCdfLogParetoType2_vv_577;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_578> AgradCdfLogParetoType2_vv_578;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_579> AgradCdfLogParetoType2_vv_579;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_580> AgradCdfLogParetoType2_vv_580;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_581> AgradCdfLogParetoType2_vv_581;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_582> AgradCdfLogParetoType2_vv_582;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_583> AgradCdfLogParetoType2_vv_583;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_584> AgradCdfLogParetoType2_vv_584;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_585> AgradCdfLogParetoType2_vv_585;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_586> AgradCdfLogParetoType2_vv_586;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_587> AgradCdfLogParetoType2_vv_587;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_588> AgradCdfLogParetoType2_vv_588;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_589> AgradCdfLogParetoType2_vv_589;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_590> AgradCdfLogParetoType2_vv_590;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_591> AgradCdfLogParetoType2_vv_591;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_592> AgradCdfLogParetoType2_vv_592;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_593> AgradCdfLogParetoType2_vv_593;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_594> AgradCdfLogParetoType2_vv_594;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_595> AgradCdfLogParetoType2_vv_595;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_596> AgradCdfLogParetoType2_vv_596;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_597> AgradCdfLogParetoType2_vv_597;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_598> AgradCdfLogParetoType2_vv_598;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_599> AgradCdfLogParetoType2_vv_599;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_500, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_500);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_501, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_501);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_502, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_502);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_503, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_503);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_504, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_504);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_505, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_505);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_506, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_506);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_507, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_507);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_508, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_508);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_509, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_509);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_510, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_510);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_511, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_511);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_512, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_512);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_513, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_513);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_514, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_514);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_515, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_515);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_516, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_516);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_517, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_517);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_518, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_518);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_519, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_519);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_520, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_520);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_521, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_521);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_522, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_522);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_523, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_523);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_524, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_524);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_525, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_525);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_526, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_526);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_527, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_527);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_528, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_528);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_529, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_529);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_530, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_530);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_531, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_531);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_532, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_532);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_533, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_533);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_534, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_534);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_535, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_535);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_536, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_536);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_537, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_537);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_538, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_538);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_539, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_539);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_540, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_540);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_541, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_541);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_542, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_542);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_543, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_543);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_544, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_544);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_545, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_545);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_546, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_546);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_547, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_547);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_548, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_548);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_549, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_549);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_550, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_550);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_551, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_551);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_552, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_552);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_553, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_553);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_554, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_554);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_555, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_555);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_556, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_556);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_557, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_557);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_558, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_558);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_559, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_559);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_560, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_560);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_561, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_561);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_562, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_562);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_563, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_563);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_564, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_564);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_565, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_565);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_566, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_566);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_567, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_567);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_568, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_568);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_569, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_569);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_570, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_570);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_571, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_571);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_572, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_572);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_573, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_573);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_574, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_574);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_575, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_575);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_576, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_576);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_577, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_577);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_578, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_578);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_579, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_579);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_580, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_580);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_581, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_581);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_582, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_582);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_583, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_583);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_584, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_584);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_585, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_585);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_586, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_586);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_587, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_587);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_588, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_588);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_589, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_589);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_590, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_590);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_591, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_591);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_592, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_592);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_593, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_593);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_594, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_594);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_595, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_595);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_596, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_596);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_597, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_597);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_598, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_598);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_599, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_599);
+
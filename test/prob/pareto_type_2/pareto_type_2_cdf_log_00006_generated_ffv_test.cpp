@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_cdf_log_test.hpp>
+
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_600;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_601;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_602;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, double, double, empty, empty> type_ffv_603;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, double, std::vector<double>, empty, empty> type_ffv_604;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_605;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, double, fvar<fvar<var> >, empty, empty> type_ffv_606;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_607;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_608;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<double>, double, empty, empty> type_ffv_609;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_610;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_611;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_612;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_613;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_614;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_615;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_616;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_617;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_618;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_619;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_620;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, double, empty, empty> type_ffv_621;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_622;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_623;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_624;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_625;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_626;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_627;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_628;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_629;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_630;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_631;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_632;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_633;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_634;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_635;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_636;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_637;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_638;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty> type_ffv_639;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_ffv_640;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_641;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_642;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_643;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_644;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_ffv_645;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_646;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_647;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_648;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_649;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_650;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_651;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_652;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_653;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_654;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_655;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_656;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_657;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_658;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_659;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_660;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_661;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_662;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_663;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_664;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_665;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_666;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_667;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_668;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_669;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_670;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_671;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_672;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_673;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_674;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, double, double, empty, empty> type_ffv_675;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, double, std::vector<double>, empty, empty> type_ffv_676;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_677;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, double, fvar<fvar<var> >, empty, empty> type_ffv_678;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_679;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_680;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, double, empty, empty> type_ffv_681;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty, empty> type_ffv_682;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_683;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_684;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_685;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_686;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_687;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_688;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_689;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_690;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_691;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_692;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, double, empty, empty> type_ffv_693;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_694;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_695;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_696;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_697;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_698;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_699;
+
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_600> AgradCdfLogParetoType2_ffv_600;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_601> AgradCdfLogParetoType2_ffv_601;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_602> AgradCdfLogParetoType2_ffv_602;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_603> AgradCdfLogParetoType2_ffv_603;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_604> AgradCdfLogParetoType2_ffv_604;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_605> AgradCdfLogParetoType2_ffv_605;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_606> AgradCdfLogParetoType2_ffv_606;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_607> AgradCdfLogParetoType2_ffv_607;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_608> AgradCdfLogParetoType2_ffv_608;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_609> AgradCdfLogParetoType2_ffv_609;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_610> AgradCdfLogParetoType2_ffv_610;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_611> AgradCdfLogParetoType2_ffv_611;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_612> AgradCdfLogParetoType2_ffv_612;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_613> AgradCdfLogParetoType2_ffv_613;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_614> AgradCdfLogParetoType2_ffv_614;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_615> AgradCdfLogParetoType2_ffv_615;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_616> AgradCdfLogParetoType2_ffv_616;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_617> AgradCdfLogParetoType2_ffv_617;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_618> AgradCdfLogParetoType2_ffv_618;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_619> AgradCdfLogParetoType2_ffv_619;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_620> AgradCdfLogParetoType2_ffv_620;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_621> AgradCdfLogParetoType2_ffv_621;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_622> AgradCdfLogParetoType2_ffv_622;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_623> AgradCdfLogParetoType2_ffv_623;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_624> AgradCdfLogParetoType2_ffv_624;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_625> AgradCdfLogParetoType2_ffv_625;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_626> AgradCdfLogParetoType2_ffv_626;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_627> AgradCdfLogParetoType2_ffv_627;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_628> AgradCdfLogParetoType2_ffv_628;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_629> AgradCdfLogParetoType2_ffv_629;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_630> AgradCdfLogParetoType2_ffv_630;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_631> AgradCdfLogParetoType2_ffv_631;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_632> AgradCdfLogParetoType2_ffv_632;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_633> AgradCdfLogParetoType2_ffv_633;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_634> AgradCdfLogParetoType2_ffv_634;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_635> AgradCdfLogParetoType2_ffv_635;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_636> AgradCdfLogParetoType2_ffv_636;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_637> AgradCdfLogParetoType2_ffv_637;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_638> AgradCdfLogParetoType2_ffv_638;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_639> AgradCdfLogParetoType2_ffv_639;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_640> AgradCdfLogParetoType2_ffv_640;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_641> AgradCdfLogParetoType2_ffv_641;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_642> AgradCdfLogParetoType2_ffv_642;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_643> AgradCdfLogParetoType2_ffv_643;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_644> AgradCdfLogParetoType2_ffv_644;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_645> AgradCdfLogParetoType2_ffv_645;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_646> AgradCdfLogParetoType2_ffv_646;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_647> AgradCdfLogParetoType2_ffv_647;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_648> AgradCdfLogParetoType2_ffv_648;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_649> AgradCdfLogParetoType2_ffv_649;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_650> AgradCdfLogParetoType2_ffv_650;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_651> AgradCdfLogParetoType2_ffv_651;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_652> AgradCdfLogParetoType2_ffv_652;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_653> AgradCdfLogParetoType2_ffv_653;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_654> AgradCdfLogParetoType2_ffv_654;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_655> AgradCdfLogParetoType2_ffv_655;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_656> AgradCdfLogParetoType2_ffv_656;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_657> AgradCdfLogParetoType2_ffv_657;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_658> AgradCdfLogParetoType2_ffv_658;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_659> AgradCdfLogParetoType2_ffv_659;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_660> AgradCdfLogParetoType2_ffv_660;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_661> AgradCdfLogParetoType2_ffv_661;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_662> AgradCdfLogParetoType2_ffv_662;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_663> AgradCdfLogParetoType2_ffv_663;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_664> AgradCdfLogParetoType2_ffv_664;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_665> AgradCdfLogParetoType2_ffv_665;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_666> AgradCdfLogParetoType2_ffv_666;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_667> AgradCdfLogParetoType2_ffv_667;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_668> AgradCdfLogParetoType2_ffv_668;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_669> AgradCdfLogParetoType2_ffv_669;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_670> AgradCdfLogParetoType2_ffv_670;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_671> AgradCdfLogParetoType2_ffv_671;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_672> AgradCdfLogParetoType2_ffv_672;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_673> AgradCdfLogParetoType2_ffv_673;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_674> AgradCdfLogParetoType2_ffv_674;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_675> AgradCdfLogParetoType2_ffv_675;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_676> AgradCdfLogParetoType2_ffv_676;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_677> AgradCdfLogParetoType2_ffv_677;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_678> AgradCdfLogParetoType2_ffv_678;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_679> AgradCdfLogParetoType2_ffv_679;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_680> AgradCdfLogParetoType2_ffv_680;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_681> AgradCdfLogParetoType2_ffv_681;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_682> AgradCdfLogParetoType2_ffv_682;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_683> AgradCdfLogParetoType2_ffv_683;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_684> AgradCdfLogParetoType2_ffv_684;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_685> AgradCdfLogParetoType2_ffv_685;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_686> AgradCdfLogParetoType2_ffv_686;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_687> AgradCdfLogParetoType2_ffv_687;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_688> AgradCdfLogParetoType2_ffv_688;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_689> AgradCdfLogParetoType2_ffv_689;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_690> AgradCdfLogParetoType2_ffv_690;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_691> AgradCdfLogParetoType2_ffv_691;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_692> AgradCdfLogParetoType2_ffv_692;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_693> AgradCdfLogParetoType2_ffv_693;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_694> AgradCdfLogParetoType2_ffv_694;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_695> AgradCdfLogParetoType2_ffv_695;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_696> AgradCdfLogParetoType2_ffv_696;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_697> AgradCdfLogParetoType2_ffv_697;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_698> AgradCdfLogParetoType2_ffv_698;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_699> AgradCdfLogParetoType2_ffv_699;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_600, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_600);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_601, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_601);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_602, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_602);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_603, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_603);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_604, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_604);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_605, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_605);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_606, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_606);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_607, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_607);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_608, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_608);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_609, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_609);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_610, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_610);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_611, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_611);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_612, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_612);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_613, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_613);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_614, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_614);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_615, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_615);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_616, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_616);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_617, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_617);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_618, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_618);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_619, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_619);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_620, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_620);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_621, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_621);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_622, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_622);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_623, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_623);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_624, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_624);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_625, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_625);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_626, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_626);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_627, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_627);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_628, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_628);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_629, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_629);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_630, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_630);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_631, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_631);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_632, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_632);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_633, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_633);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_634, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_634);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_635, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_635);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_636, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_636);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_637, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_637);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_638, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_638);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_639, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_639);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_640, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_640);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_641, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_641);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_642, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_642);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_643, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_643);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_644, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_644);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_645, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_645);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_646, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_646);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_647, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_647);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_648, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_648);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_649, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_649);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_650, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_650);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_651, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_651);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_652, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_652);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_653, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_653);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_654, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_654);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_655, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_655);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_656, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_656);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_657, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_657);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_658, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_658);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_659, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_659);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_660, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_660);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_661, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_661);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_662, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_662);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_663, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_663);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_664, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_664);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_665, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_665);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_666, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_666);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_667, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_667);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_668, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_668);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_669, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_669);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_670, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_670);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_671, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_671);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_672, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_672);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_673, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_673);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_674, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_674);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_675, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_675);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_676, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_676);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_677, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_677);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_678, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_678);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_679, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_679);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_680, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_680);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_681, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_681);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_682, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_682);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_683, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_683);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_684, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_684);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_685, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_685);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_686, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_686);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_687, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_687);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_688, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_688);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_689, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_689);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_690, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_690);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_691, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_691);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_692, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_692);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_693, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_693);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_694, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_694);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_695, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_695);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_696, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_696);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_697, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_697);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_698, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_698);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_699, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_699);
+
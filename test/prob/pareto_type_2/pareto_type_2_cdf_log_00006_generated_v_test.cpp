@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_cdf_log_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, double, empty, empty> type_v_600;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_v_601;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_602;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, var, empty, empty> type_v_603;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_v_604;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_605;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_606;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_607;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_608;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_609;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_610;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_611;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_612;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_613;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_614;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_615;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_616;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_617;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_618;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_619;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_620;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_621;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_622;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_623;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_624;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_625;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_626;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_627;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_628;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_629;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_630;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_631;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_632;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_633;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_634;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_635;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_636;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_637;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_638;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_639;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_640;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_641;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_642;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_643;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_644;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_645;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_646;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_647;
+typedef std::tuple<var, double, double, double, empty, empty> type_v_648;
+typedef std::tuple<var, double, double, std::vector<double>, empty, empty> type_v_649;
+typedef std::tuple<var, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_650;
+typedef std::tuple<var, double, double, var, empty, empty> type_v_651;
+typedef std::tuple<var, double, double, std::vector<var>, empty, empty> type_v_652;
+typedef std::tuple<var, double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_653;
+typedef std::tuple<var, double, std::vector<double>, double, empty, empty> type_v_654;
+typedef std::tuple<var, double, std::vector<double>, std::vector<double>, empty, empty> type_v_655;
+typedef std::tuple<var, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_656;
+typedef std::tuple<var, double, std::vector<double>, var, empty, empty> type_v_657;
+typedef std::tuple<var, double, std::vector<double>, std::vector<var>, empty, empty> type_v_658;
+typedef std::tuple<var, double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_659;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_660;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_661;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_662;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_663;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_664;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_665;
+typedef std::tuple<var, double, var, double, empty, empty> type_v_666;
+typedef std::tuple<var, double, var, std::vector<double>, empty, empty> type_v_667;
+typedef std::tuple<var, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_668;
+typedef std::tuple<var, double, var, var, empty, empty> type_v_669;
+typedef std::tuple<var, double, var, std::vector<var>, empty, empty> type_v_670;
+typedef std::tuple<var, double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_671;
+typedef std::tuple<var, double, std::vector<var>, double, empty, empty> type_v_672;
+typedef std::tuple<var, double, std::vector<var>, std::vector<double>, empty, empty> type_v_673;
+typedef std::tuple<var, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_674;
+typedef std::tuple<var, double, std::vector<var>, var, empty, empty> type_v_675;
+typedef std::tuple<var, double, std::vector<var>, std::vector<var>, empty, empty> type_v_676;
+typedef std::tuple<var, double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_677;
+typedef std::tuple<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_678;
+typedef std::tuple<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_679;
+typedef std::tuple<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_680;
+typedef std::tuple<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_681;
+typedef std::tuple<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_682;
+typedef std::tuple<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_683;
+typedef std::tuple<var, std::vector<double>, double, double, empty, empty> type_v_684;
+typedef std::tuple<var, std::vector<double>, double, std::vector<double>, empty, empty> type_v_685;
+typedef std::tuple<var, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_686;
+typedef std::tuple<var, std::vector<double>, double, var, empty, empty> type_v_687;
+typedef std::tuple<var, std::vector<double>, double, std::vector<var>, empty, empty> type_v_688;
+typedef std::tuple<var, std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_689;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, double, empty, empty> type_v_690;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, std::vector<double>, empty, empty> type_v_691;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_692;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, var, empty, empty> type_v_693;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_v_694;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_695;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_696;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_697;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_698;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_699;
+
+typedef std::tuple<AgradCdfLogParetoType2, type_v_600> AgradCdfLogParetoType2_v_600;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_601> AgradCdfLogParetoType2_v_601;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_602> AgradCdfLogParetoType2_v_602;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_603> AgradCdfLogParetoType2_v_603;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_604> AgradCdfLogParetoType2_v_604;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_605> AgradCdfLogParetoType2_v_605;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_606> AgradCdfLogParetoType2_v_606;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_607> AgradCdfLogParetoType2_v_607;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_608> AgradCdfLogParetoType2_v_608;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_609> AgradCdfLogParetoType2_v_609;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_610> AgradCdfLogParetoType2_v_610;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_611> AgradCdfLogParetoType2_v_611;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_612> AgradCdfLogParetoType2_v_612;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_613> AgradCdfLogParetoType2_v_613;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_614> AgradCdfLogParetoType2_v_614;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_615> AgradCdfLogParetoType2_v_615;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_616> AgradCdfLogParetoType2_v_616;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_617> AgradCdfLogParetoType2_v_617;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_618> AgradCdfLogParetoType2_v_618;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_619> AgradCdfLogParetoType2_v_619;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_620> AgradCdfLogParetoType2_v_620;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_621> AgradCdfLogParetoType2_v_621;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_622> AgradCdfLogParetoType2_v_622;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_623> AgradCdfLogParetoType2_v_623;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_624> AgradCdfLogParetoType2_v_624;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_625> AgradCdfLogParetoType2_v_625;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_626> AgradCdfLogParetoType2_v_626;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_627> AgradCdfLogParetoType2_v_627;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_628> AgradCdfLogParetoType2_v_628;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_629> AgradCdfLogParetoType2_v_629;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_630> AgradCdfLogParetoType2_v_630;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_631> AgradCdfLogParetoType2_v_631;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_632> AgradCdfLogParetoType2_v_632;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_633> AgradCdfLogParetoType2_v_633;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_634> AgradCdfLogParetoType2_v_634;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_635> AgradCdfLogParetoType2_v_635;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_636> AgradCdfLogParetoType2_v_636;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_637> AgradCdfLogParetoType2_v_637;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_638> AgradCdfLogParetoType2_v_638;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_639> AgradCdfLogParetoType2_v_639;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_640> AgradCdfLogParetoType2_v_640;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_641> AgradCdfLogParetoType2_v_641;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_642> AgradCdfLogParetoType2_v_642;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_643> AgradCdfLogParetoType2_v_643;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_644> AgradCdfLogParetoType2_v_644;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_645> AgradCdfLogParetoType2_v_645;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_646> AgradCdfLogParetoType2_v_646;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_647> AgradCdfLogParetoType2_v_647;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_648> AgradCdfLogParetoType2_v_648;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_649> AgradCdfLogParetoType2_v_649;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_650> AgradCdfLogParetoType2_v_650;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_651> AgradCdfLogParetoType2_v_651;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_652> AgradCdfLogParetoType2_v_652;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_653> AgradCdfLogParetoType2_v_653;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_654> AgradCdfLogParetoType2_v_654;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_655> AgradCdfLogParetoType2_v_655;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_656> AgradCdfLogParetoType2_v_656;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_657> AgradCdfLogParetoType2_v_657;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_658> AgradCdfLogParetoType2_v_658;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_659> AgradCdfLogParetoType2_v_659;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_660> AgradCdfLogParetoType2_v_660;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_661> AgradCdfLogParetoType2_v_661;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_662> AgradCdfLogParetoType2_v_662;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_663> AgradCdfLogParetoType2_v_663;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_664> AgradCdfLogParetoType2_v_664;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_665> AgradCdfLogParetoType2_v_665;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_666> AgradCdfLogParetoType2_v_666;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_667> AgradCdfLogParetoType2_v_667;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_668> AgradCdfLogParetoType2_v_668;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_669> AgradCdfLogParetoType2_v_669;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_670> AgradCdfLogParetoType2_v_670;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_671> AgradCdfLogParetoType2_v_671;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_672> AgradCdfLogParetoType2_v_672;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_673> AgradCdfLogParetoType2_v_673;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_674> AgradCdfLogParetoType2_v_674;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_675> AgradCdfLogParetoType2_v_675;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_676> AgradCdfLogParetoType2_v_676;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_677> AgradCdfLogParetoType2_v_677;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_678> AgradCdfLogParetoType2_v_678;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_679> AgradCdfLogParetoType2_v_679;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_680> AgradCdfLogParetoType2_v_680;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_681> AgradCdfLogParetoType2_v_681;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_682> AgradCdfLogParetoType2_v_682;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_683> AgradCdfLogParetoType2_v_683;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_684> AgradCdfLogParetoType2_v_684;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_685> AgradCdfLogParetoType2_v_685;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_686> AgradCdfLogParetoType2_v_686;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_687> AgradCdfLogParetoType2_v_687;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_688> AgradCdfLogParetoType2_v_688;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_689> AgradCdfLogParetoType2_v_689;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_690> AgradCdfLogParetoType2_v_690;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_691> AgradCdfLogParetoType2_v_691;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_692> AgradCdfLogParetoType2_v_692;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_693> AgradCdfLogParetoType2_v_693;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_694> AgradCdfLogParetoType2_v_694;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_695> AgradCdfLogParetoType2_v_695;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_696> AgradCdfLogParetoType2_v_696;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_697> AgradCdfLogParetoType2_v_697;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_698> AgradCdfLogParetoType2_v_698;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_699> AgradCdfLogParetoType2_v_699;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_600, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_600);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_601, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_601);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_602, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_602);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_603, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_603);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_604, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_604);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_605, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_605);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_606, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_606);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_607, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_607);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_608, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_608);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_609, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_609);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_610, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_610);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_611, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_611);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_612, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_612);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_613, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_613);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_614, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_614);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_615, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_615);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_616, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_616);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_617, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_617);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_618, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_618);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_619, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_619);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_620, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_620);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_621, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_621);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_622, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_622);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_623, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_623);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_624, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_624);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_625, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_625);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_626, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_626);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_627, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_627);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_628, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_628);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_629, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_629);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_630, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_630);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_631, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_631);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_632, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_632);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_633, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_633);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_634, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_634);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_635, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_635);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_636, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_636);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_637, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_637);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_638, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_638);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_639, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_639);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_640, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_640);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_641, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_641);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_642, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_642);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_643, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_643);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_644, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_644);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_645, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_645);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_646, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_646);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_647, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_647);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_648, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_648);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_649, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_649);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_650, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_650);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_651, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_651);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_652, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_652);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_653, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_653);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_654, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_654);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_655, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_655);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_656, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_656);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_657, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_657);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_658, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_658);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_659, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_659);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_660, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_660);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_661, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_661);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_662, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_662);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_663, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_663);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_664, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_664);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_665, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_665);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_666, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_666);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_667, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_667);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_668, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_668);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_669, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_669);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_670, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_670);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_671, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_671);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_672, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_672);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_673, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_673);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_674, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_674);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_675, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_675);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_676, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_676);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_677, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_677);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_678, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_678);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_679, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_679);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_680, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_680);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_681, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_681);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_682, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_682);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_683, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_683);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_684, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_684);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_685, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_685);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_686, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_686);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_687, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_687);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_688, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_688);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_689, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_689);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_690, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_690);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_691, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_691);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_692, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_692);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_693, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_693);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_694, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_694);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_695, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_695);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_696, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_696);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_697, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_697);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_698, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_698);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_699, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_699);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_cdf_log_test.hpp>
+
+typedef std::tuple<var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_600;
+typedef std::tuple<var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_601;
+typedef std::tuple<var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_602;
+typedef std::tuple<var, std::vector<double>, double, double, empty, empty> type_vv_603;
+typedef std::tuple<var, std::vector<double>, double, std::vector<double>, empty, empty> type_vv_604;
+typedef std::tuple<var, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_605;
+typedef std::tuple<var, std::vector<double>, double, var, empty, empty> type_vv_606;
+typedef std::tuple<var, std::vector<double>, double, std::vector<var>, empty, empty> type_vv_607;
+typedef std::tuple<var, std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_608;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, double, empty, empty> type_vv_609;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, std::vector<double>, empty, empty> type_vv_610;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_611;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, var, empty, empty> type_vv_612;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_vv_613;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_614;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_615;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_616;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_617;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_618;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_619;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_620;
+typedef std::tuple<var, std::vector<double>, var, double, empty, empty> type_vv_621;
+typedef std::tuple<var, std::vector<double>, var, std::vector<double>, empty, empty> type_vv_622;
+typedef std::tuple<var, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_623;
+typedef std::tuple<var, std::vector<double>, var, var, empty, empty> type_vv_624;
+typedef std::tuple<var, std::vector<double>, var, std::vector<var>, empty, empty> type_vv_625;
+typedef std::tuple<var, std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_626;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, double, empty, empty> type_vv_627;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_vv_628;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_629;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, var, empty, empty> type_vv_630;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_vv_631;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_632;
+typedef std::tuple<var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_633;
+typedef std::tuple<var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_634;
+typedef std::tuple<var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_635;
+typedef std::tuple<var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_636;
+typedef std::tuple<var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_637;
+typedef std::tuple<var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_638;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty> type_vv_639;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_vv_640;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_641;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_vv_642;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_vv_643;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_644;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_vv_645;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_vv_646;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_647;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_vv_648;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_vv_649;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_650;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_651;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_652;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_653;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_654;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_655;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_656;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_vv_657;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_vv_658;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_659;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_vv_660;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_vv_661;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_662;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_vv_663;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_vv_664;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_665;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_vv_666;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_vv_667;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_668;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_669;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_670;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_671;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_672;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_673;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_674;
+typedef std::tuple<var, var, double, double, empty, empty> type_vv_675;
+typedef std::tuple<var, var, double, std::vector<double>, empty, empty> type_vv_676;
+typedef std::tuple<var, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_677;
+typedef std::tuple<var, var, double, var, empty, empty> type_vv_678;
+typedef std::tuple<var, var, double, std::vector<var>, empty, empty> type_vv_679;
+typedef std::tuple<var, var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_680;
+typedef std::tuple<var, var, std::vector<double>, double, empty, empty> type_vv_681;
+typedef std::tuple<var, var, std::vector<double>, std::vector<double>, empty, empty> type_vv_682;
+typedef std::tuple<var, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_683;
+typedef std::tuple<var, var, std::vector<double>, var, empty, empty> type_vv_684;
+typedef std::tuple<var, var, std::vector<double>, std::vector<var>, empty, empty> type_vv_685;
+typedef std::tuple<var, var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_686;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_687;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_688;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_689;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_690;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_691;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_692;
+typedef std::tuple<var, var, var, double, empty, empty> type_vv_693;
+typedef std::tuple<var, var, var, std::vector<double>, empty, empty> type_vv_694;
+typedef std::tuple<var, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_695;
+typedef std::tuple<var, var, var, var, empty, empty> type_vv_696;
+typedef std::tuple<var, var, var, std::vector<var>, empty, empty> type_vv_697;
+typedef std::tuple<var, var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_698;
+typedef std::tuple<var, var, std::vector<var>, double, empty, empty> type_vv_699;
+
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_600> AgradCdfLogParetoType2_vv_600;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_601> AgradCdfLogParetoType2_vv_601;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_602> AgradCdfLogParetoType2_vv_602;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_603> AgradCdfLogParetoType2_vv_603;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_604> AgradCdfLogParetoType2_vv_604;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_605> AgradCdfLogParetoType2_vv_605;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_606> AgradCdfLogParetoType2_vv_606;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_607> AgradCdfLogParetoType2_vv_607;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_608> AgradCdfLogParetoType2_vv_608;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_609> AgradCdfLogParetoType2_vv_609;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_610> AgradCdfLogParetoType2_vv_610;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_611> AgradCdfLogParetoType2_vv_611;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_612> AgradCdfLogParetoType2_vv_612;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_613> AgradCdfLogParetoType2_vv_613;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_614> AgradCdfLogParetoType2_vv_614;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_615> AgradCdfLogParetoType2_vv_615;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_616> AgradCdfLogParetoType2_vv_616;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_617> AgradCdfLogParetoType2_vv_617;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_618> AgradCdfLogParetoType2_vv_618;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_619> AgradCdfLogParetoType2_vv_619;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_620> AgradCdfLogParetoType2_vv_620;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_621> AgradCdfLogParetoType2_vv_621;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_622> AgradCdfLogParetoType2_vv_622;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_623> AgradCdfLogParetoType2_vv_623;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_624> AgradCdfLogParetoType2_vv_624;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_625> AgradCdfLogParetoType2_vv_625;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_626> AgradCdfLogParetoType2_vv_626;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_627> AgradCdfLogParetoType2_vv_627;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_628> AgradCdfLogParetoType2_vv_628;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_629> AgradCdfLogParetoType2_vv_629;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_630> AgradCdfLogParetoType2_vv_630;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_631> AgradCdfLogParetoType2_vv_631;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_632> AgradCdfLogParetoType2_vv_632;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_633> AgradCdfLogParetoType2_vv_633;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_634> AgradCdfLogParetoType2_vv_634;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_635> AgradCdfLogParetoType2_vv_635;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_636> AgradCdfLogParetoType2_vv_636;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_637> AgradCdfLogParetoType2_vv_637;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_638> AgradCdfLogParetoType2_vv_638;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_639> AgradCdfLogParetoType2_vv_639;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_640> AgradCdfLogParetoType2_vv_640;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_641> AgradCdfLogParetoType2_vv_641;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_642> AgradCdfLogParetoType2_vv_642;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_643> AgradCdfLogParetoType2_vv_643;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_644> AgradCdfLogParetoType2_vv_644;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_645> AgradCdfLogParetoType2_vv_645;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_646> AgradCdfLogParetoType2_vv_646;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_647> AgradCdfLogParetoType2_vv_647;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_648> AgradCdfLogParetoType2_vv_648;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_649> AgradCdfLogParetoType2_vv_649;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_650> AgradCdfLogParetoType2_vv_650;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_651> AgradCdfLogParetoType2_vv_651;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_652> AgradCdfLogParetoType2_vv_652;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_653> AgradCdfLogParetoType2_vv_653;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_654> AgradCdfLogParetoType2_vv_654;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_655> AgradCdfLogParetoType2_vv_655;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_656> AgradCdfLogParetoType2_vv_656;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_657> AgradCdfLogParetoType2_vv_657;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_658> AgradCdfLogParetoType2_vv_658;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_659> AgradCdfLogParetoType2_vv_659;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_660> AgradCdfLogParetoType2_vv_660;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_661> AgradCdfLogParetoType2_vv_661;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_662> AgradCdfLogParetoType2_vv_662;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_663> AgradCdfLogParetoType2_vv_663;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_664> AgradCdfLogParetoType2_vv_664;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_665> AgradCdfLogParetoType2_vv_665;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_666> AgradCdfLogParetoType2_vv_666;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_667> AgradCdfLogParetoType2_vv_667;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_668> AgradCdfLogParetoType2_vv_668;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_669> AgradCdfLogParetoType2_vv_669;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_670> AgradCdfLogParetoType2_vv_670;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_671> AgradCdfLogParetoType2_vv_671;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_672> AgradCdfLogParetoType2_vv_672;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_673> AgradCdfLogParetoType2_vv_673;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_674> AgradCdfLogParetoType2_vv_674;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_675> AgradCdfLogParetoType2_vv_675;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_676> AgradCdfLogParetoType2_vv_676;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_677> AgradCdfLogParetoType2_vv_677;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_678> AgradCdfLogParetoType2_vv_678;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_679> AgradCdfLogParetoType2_vv_679;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_680> AgradCdfLogParetoType2_vv_680;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_681> AgradCdfLogParetoType2_vv_681;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_682> AgradCdfLogParetoType2_vv_682;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_683> AgradCdfLogParetoType2_vv_683;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_684> AgradCdfLogParetoType2_vv_684;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_685> AgradCdfLogParetoType2_vv_685;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_686> AgradCdfLogParetoType2_vv_686;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_687> AgradCdfLogParetoType2_vv_687;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_688> AgradCdfLogParetoType2_vv_688;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_689> AgradCdfLogParetoType2_vv_689;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_690> AgradCdfLogParetoType2_vv_690;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_691> AgradCdfLogParetoType2_vv_691;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_692> AgradCdfLogParetoType2_vv_692;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_693> AgradCdfLogParetoType2_vv_693;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_694> AgradCdfLogParetoType2_vv_694;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_695> AgradCdfLogParetoType2_vv_695;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_696> AgradCdfLogParetoType2_vv_696;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_697> AgradCdfLogParetoType2_vv_697;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_698> AgradCdfLogParetoType2_vv_698;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_699> AgradCdfLogParetoType2_vv_699;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_600, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_600);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_601, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_601);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_602, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_602);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_603, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_603);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_604, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_604);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_605, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_605);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_606, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_606);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_607, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_607);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_608, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_608);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_609, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_609);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_610, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_610);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_611, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_611);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_612, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_612);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_613, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_613);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_614, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_614);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_615, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_615);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_616, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_616);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_617, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_617);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_618, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_618);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_619, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_619);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_620, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_620);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_621, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_621);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_622, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_622);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_623, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_623);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_624, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_624);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_625, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_625);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_626, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_626);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_627, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_627);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_628, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_628);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_629, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_629);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_630, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_630);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_631, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_631);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_632, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_632);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_633, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_633);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_634, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_634);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_635, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_635);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_636, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_636);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_637, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_637);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_638, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_638);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_639, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_639);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_640, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_640);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_641, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_641);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_642, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_642);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_643, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_643);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_644, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_644);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_645, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_645);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_646, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_646);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_647, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_647);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_648, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_648);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_649, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_649);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_650, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_650);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_651, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_651);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_652, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_652);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_653, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_653);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_654, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_654);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_655, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_655);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_656, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_656);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_657, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_657);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_658, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_658);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_659, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_659);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_660, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_660);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_661, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_661);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_662, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_662);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_663, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_663);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_664, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_664);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_665, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_665);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_666, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_666);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_667, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_667);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_668, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_668);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_669, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_669);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_670, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_670);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_671, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_671);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_672, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_672);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_673, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_673);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_674, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_674);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_675, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_675);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_676, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_676);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_677, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_677);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_678, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_678);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_679, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_679);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_680, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_680);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_681, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_681);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_682, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_682);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_683, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_683);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_684, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_684);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_685, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_685);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_686, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_686);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_687, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_687);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_688, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_688);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_689, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_689);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_690, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_690);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_691, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_691);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_692, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_692);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_693, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_693);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_694, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_694);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_695, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_695);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_696, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_696);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_697, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_697);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_698, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_698);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_699, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_699);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_cdf_log_test.hpp>
+
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_700;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_701;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_702;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_703;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_704;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_705;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_706;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_707;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_708;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_709;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_710;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, double, empty, empty> type_ffv_711;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty, empty> type_ffv_712;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_713;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty, empty> type_ffv_714;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_715;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_716;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty, empty> type_ffv_717;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_718;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_719;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_720;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_721;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_722;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_723;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_724;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_725;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_726;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_727;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_728;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty, empty> type_ffv_729;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_730;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_731;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_732;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_733;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_734;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_735;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_736;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_737;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_738;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_739;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_740;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_741;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_742;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_743;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_744;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_745;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_746;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty, empty> type_ffv_747;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_ffv_748;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_749;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_750;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_751;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_752;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_ffv_753;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_754;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_755;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_756;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_757;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_758;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_759;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_760;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_761;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_762;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_763;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_764;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_765;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_766;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_767;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_768;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_769;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_770;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_771;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_772;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_773;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_774;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_775;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_776;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_777;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_778;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_779;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_780;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_781;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_782;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, double, double, empty, empty> type_ffv_783;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, double, std::vector<double>, empty, empty> type_ffv_784;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_785;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, double, fvar<fvar<var> >, empty, empty> type_ffv_786;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_787;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_788;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<double>, double, empty, empty> type_ffv_789;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<double>, std::vector<double>, empty, empty> type_ffv_790;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_791;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_792;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_793;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_794;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_795;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_796;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_797;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_798;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_799;
+
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_700> AgradCdfLogParetoType2_ffv_700;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_701> AgradCdfLogParetoType2_ffv_701;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_702> AgradCdfLogParetoType2_ffv_702;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_703> AgradCdfLogParetoType2_ffv_703;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_704> AgradCdfLogParetoType2_ffv_704;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_705> AgradCdfLogParetoType2_ffv_705;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_706> AgradCdfLogParetoType2_ffv_706;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_707> AgradCdfLogParetoType2_ffv_707;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_708> AgradCdfLogParetoType2_ffv_708;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_709> AgradCdfLogParetoType2_ffv_709;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_710> AgradCdfLogParetoType2_ffv_710;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_711> AgradCdfLogParetoType2_ffv_711;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_712> AgradCdfLogParetoType2_ffv_712;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_713> AgradCdfLogParetoType2_ffv_713;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_714> AgradCdfLogParetoType2_ffv_714;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_715> AgradCdfLogParetoType2_ffv_715;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_716> AgradCdfLogParetoType2_ffv_716;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_717> AgradCdfLogParetoType2_ffv_717;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_718> AgradCdfLogParetoType2_ffv_718;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_719> AgradCdfLogParetoType2_ffv_719;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_720> AgradCdfLogParetoType2_ffv_720;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_721> AgradCdfLogParetoType2_ffv_721;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_722> AgradCdfLogParetoType2_ffv_722;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_723> AgradCdfLogParetoType2_ffv_723;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_724> AgradCdfLogParetoType2_ffv_724;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_725> AgradCdfLogParetoType2_ffv_725;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_726> AgradCdfLogParetoType2_ffv_726;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_727> AgradCdfLogParetoType2_ffv_727;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_728> AgradCdfLogParetoType2_ffv_728;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_729> AgradCdfLogParetoType2_ffv_729;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_730> AgradCdfLogParetoType2_ffv_730;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_731> AgradCdfLogParetoType2_ffv_731;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_732> AgradCdfLogParetoType2_ffv_732;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_733> AgradCdfLogParetoType2_ffv_733;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_734> AgradCdfLogParetoType2_ffv_734;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_735> AgradCdfLogParetoType2_ffv_735;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_736> AgradCdfLogParetoType2_ffv_736;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_737> AgradCdfLogParetoType2_ffv_737;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_738> AgradCdfLogParetoType2_ffv_738;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_739> AgradCdfLogParetoType2_ffv_739;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_740> AgradCdfLogParetoType2_ffv_740;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_741> AgradCdfLogParetoType2_ffv_741;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_742> AgradCdfLogParetoType2_ffv_742;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_743> AgradCdfLogParetoType2_ffv_743;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_744> AgradCdfLogParetoType2_ffv_744;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_745> AgradCdfLogParetoType2_ffv_745;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_746> AgradCdfLogParetoType2_ffv_746;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_747> AgradCdfLogParetoType2_ffv_747;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_748> AgradCdfLogParetoType2_ffv_748;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_749> AgradCdfLogParetoType2_ffv_749;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_750> AgradCdfLogParetoType2_ffv_750;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_751> AgradCdfLogParetoType2_ffv_751;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_752> AgradCdfLogParetoType2_ffv_752;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_753> AgradCdfLogParetoType2_ffv_753;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_754> AgradCdfLogParetoType2_ffv_754;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_755> AgradCdfLogParetoType2_ffv_755;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_756> AgradCdfLogParetoType2_ffv_756;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_757> AgradCdfLogParetoType2_ffv_757;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_758> AgradCdfLogParetoType2_ffv_758;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_759> AgradCdfLogParetoType2_ffv_759;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_760> AgradCdfLogParetoType2_ffv_760;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_761> AgradCdfLogParetoType2_ffv_761;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_762> AgradCdfLogParetoType2_ffv_762;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_763> AgradCdfLogParetoType2_ffv_763;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_764> AgradCdfLogParetoType2_ffv_764;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_765> AgradCdfLogParetoType2_ffv_765;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_766> AgradCdfLogParetoType2_ffv_766;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_767> AgradCdfLogParetoType2_ffv_767;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_768> AgradCdfLogParetoType2_ffv_768;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_769> AgradCdfLogParetoType2_ffv_769;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_770> AgradCdfLogParetoType2_ffv_770;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_771> AgradCdfLogParetoType2_ffv_771;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_772> AgradCdfLogParetoType2_ffv_772;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_773> AgradCdfLogParetoType2_ffv_773;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_774> AgradCdfLogParetoType2_ffv_774;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_775> AgradCdfLogParetoType2_ffv_775;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_776> AgradCdfLogParetoType2_ffv_776;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_777> AgradCdfLogParetoType2_ffv_777;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_778> AgradCdfLogParetoType2_ffv_778;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_779> AgradCdfLogParetoType2_ffv_779;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_780> AgradCdfLogParetoType2_ffv_780;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_781> AgradCdfLogParetoType2_ffv_781;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_782> AgradCdfLogParetoType2_ffv_782;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_783> AgradCdfLogParetoType2_ffv_783;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_784> AgradCdfLogParetoType2_ffv_784;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_785> AgradCdfLogParetoType2_ffv_785;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_786> AgradCdfLogParetoType2_ffv_786;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_787> AgradCdfLogParetoType2_ffv_787;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_788> AgradCdfLogParetoType2_ffv_788;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_789> AgradCdfLogParetoType2_ffv_789;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_790> AgradCdfLogParetoType2_ffv_790;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_791> AgradCdfLogParetoType2_ffv_791;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_792> AgradCdfLogParetoType2_ffv_792;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_793> AgradCdfLogParetoType2_ffv_793;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_794> AgradCdfLogParetoType2_ffv_794;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_795> AgradCdfLogParetoType2_ffv_795;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_796> AgradCdfLogParetoType2_ffv_796;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_797> AgradCdfLogParetoType2_ffv_797;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_798> AgradCdfLogParetoType2_ffv_798;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_799> AgradCdfLogParetoType2_ffv_799;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_700, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_700);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_701, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_701);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_702, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_702);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_703, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_703);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_704, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_704);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_705, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_705);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_706, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_706);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_707, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_707);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_708, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_708);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_709, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_709);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_710, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_710);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_711, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_711);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_712, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_712);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_713, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_713);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_714, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_714);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_715, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_715);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_716, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_716);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_717, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_717);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_718, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_718);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_719, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_719);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_720, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_720);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_721, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_721);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_722, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_722);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_723, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_723);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_724, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_724);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_725, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_725);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_726, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_726);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_727, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_727);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_728, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_728);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_729, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_729);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_730, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_730);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_731, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_731);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_732, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_732);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_733, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_733);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_734, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_734);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_735, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_735);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_736, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_736);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_737, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_737);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_738, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_738);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_739, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_739);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_740, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_740);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_741, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_741);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_742, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_742);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_743, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_743);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_744, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_744);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_745, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_745);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_746, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_746);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_747, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_747);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_748, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_748);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_749, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_749);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_750, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_750);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_751, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_751);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_752, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_752);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_753, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_753);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_754, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_754);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_755, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_755);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_756, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_756);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_757, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_757);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_758, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_758);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_759, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_759);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_760, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_760);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_761, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_761);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_762, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_762);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_763, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_763);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_764, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_764);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_765, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_765);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_766, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_766);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_767, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_767);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_768, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_768);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_769, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_769);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_770, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_770);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_771, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_771);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_772, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_772);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_773, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_773);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_774, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_774);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_775, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_775);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_776, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_776);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_777, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_777);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_778, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_778);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_779, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_779);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_780, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_780);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_781, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_781);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_782, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_782);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_783, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_783);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_784, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_784);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_785, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_785);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_786, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_786);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_787, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_787);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_788, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_788);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_789, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_789);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_790, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_790);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_791, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_791);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_792, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_792);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_793, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_793);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_794, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_794);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_795, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_795);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_796, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_796);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_797, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_797);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_798, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_798);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_799, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_799);
+
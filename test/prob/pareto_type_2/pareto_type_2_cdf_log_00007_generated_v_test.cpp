@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_cdf_log_test.hpp>
+
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_700;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_701;
+typedef std::tuple<var, std::vector<double>, var, double, empty, empty> type_v_702;
+typedef std::tuple<var, std::vector<double>, var, std::vector<double>, empty, empty> type_v_703;
+typedef std::tuple<var, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_704;
+typedef std::tuple<var, std::vector<double>, var, var, empty, empty> type_v_705;
+typedef std::tuple<var, std::vector<double>, var, std::vector<var>, empty, empty> type_v_706;
+typedef std::tuple<var, std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_707;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, double, empty, empty> type_v_708;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_v_709;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_710;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, var, empty, empty> type_v_711;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_v_712;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_713;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_714;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_715;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_716;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_717;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_718;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_719;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_720;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_721;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_722;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_723;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_724;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_725;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_726;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_727;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_728;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_729;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_730;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_731;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_732;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_733;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_734;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_735;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_736;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_737;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_738;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_739;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_740;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_741;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_742;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_743;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_744;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_745;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_746;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_747;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_748;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_749;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_750;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_751;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_752;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_753;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_754;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_755;
+typedef std::tuple<var, var, double, double, empty, empty> type_v_756;
+typedef std::tuple<var, var, double, std::vector<double>, empty, empty> type_v_757;
+typedef std::tuple<var, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_758;
+typedef std::tuple<var, var, double, var, empty, empty> type_v_759;
+typedef std::tuple<var, var, double, std::vector<var>, empty, empty> type_v_760;
+typedef std::tuple<var, var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_761;
+typedef std::tuple<var, var, std::vector<double>, double, empty, empty> type_v_762;
+typedef std::tuple<var, var, std::vector<double>, std::vector<double>, empty, empty> type_v_763;
+typedef std::tuple<var, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_764;
+typedef std::tuple<var, var, std::vector<double>, var, empty, empty> type_v_765;
+typedef std::tuple<var, var, std::vector<double>, std::vector<var>, empty, empty> type_v_766;
+typedef std::tuple<var, var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_767;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_768;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_769;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_770;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_771;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_772;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_773;
+typedef std::tuple<var, var, var, double, empty, empty> type_v_774;
+typedef std::tuple<var, var, var, std::vector<double>, empty, empty> type_v_775;
+typedef std::tuple<var, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_776;
+typedef std::tuple<var, var, var, var, empty, empty> type_v_777;
+typedef std::tuple<var, var, var, std::vector<var>, empty, empty> type_v_778;
+typedef std::tuple<var, var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_779;
+typedef std::tuple<var, var, std::vector<var>, double, empty, empty> type_v_780;
+typedef std::tuple<var, var, std::vector<var>, std::vector<double>, empty, empty> type_v_781;
+typedef std::tuple<var, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_782;
+typedef std::tuple<var, var, std::vector<var>, var, empty, empty> type_v_783;
+typedef std::tuple<var, var, std::vector<var>, std::vector<var>, empty, empty> type_v_784;
+typedef std::tuple<var, var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_785;
+typedef std::tuple<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_786;
+typedef std::tuple<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_787;
+typedef std::tuple<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_788;
+typedef std::tuple<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_789;
+typedef std::tuple<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_790;
+typedef std::tuple<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_791;
+typedef std::tuple<var, std::vector<var>, double, double, empty, empty> type_v_792;
+typedef std::tuple<var, std::vector<var>, double, std::vector<double>, empty, empty> type_v_793;
+typedef std::tuple<var, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_794;
+typedef std::tuple<var, std::vector<var>, double, var, empty, empty> type_v_795;
+typedef std::tuple<var, std::vector<var>, double, std::vector<var>, empty, empty> type_v_796;
+typedef std::tuple<var, std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_797;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, double, empty, empty> type_v_798;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_v_799;
+
+typedef std::tuple<AgradCdfLogParetoType2, type_v_700> AgradCdfLogParetoType2_v_700;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_701> AgradCdfLogParetoType2_v_701;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_702> AgradCdfLogParetoType2_v_702;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_703> AgradCdfLogParetoType2_v_703;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_704> AgradCdfLogParetoType2_v_704;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_705> AgradCdfLogParetoType2_v_705;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_706> AgradCdfLogParetoType2_v_706;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_707> AgradCdfLogParetoType2_v_707;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_708> AgradCdfLogParetoType2_v_708;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_709> AgradCdfLogParetoType2_v_709;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_710> AgradCdfLogParetoType2_v_710;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_711> AgradCdfLogParetoType2_v_711;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_712> AgradCdfLogParetoType2_v_712;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_713> AgradCdfLogParetoType2_v_713;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_714> AgradCdfLogParetoType2_v_714;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_715> AgradCdfLogParetoType2_v_715;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_716> AgradCdfLogParetoType2_v_716;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_717> AgradCdfLogParetoType2_v_717;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_718> AgradCdfLogParetoType2_v_718;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_719> AgradCdfLogParetoType2_v_719;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_720> AgradCdfLogParetoType2_v_720;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_721> AgradCdfLogParetoType2_v_721;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_722> AgradCdfLogParetoType2_v_722;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_723> AgradCdfLogParetoType2_v_723;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_724> AgradCdfLogParetoType2_v_724;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_725> AgradCdfLogParetoType2_v_725;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_726> AgradCdfLogParetoType2_v_726;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_727> AgradCdfLogParetoType2_v_727;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_728> AgradCdfLogParetoType2_v_728;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_729> AgradCdfLogParetoType2_v_729;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_730> AgradCdfLogParetoType2_v_730;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_731> AgradCdfLogParetoType2_v_731;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_732> AgradCdfLogParetoType2_v_732;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_733> AgradCdfLogParetoType2_v_733;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_734> AgradCdfLogParetoType2_v_734;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_735> AgradCdfLogParetoType2_v_735;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_736> AgradCdfLogParetoType2_v_736;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_737> AgradCdfLogParetoType2_v_737;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_738> AgradCdfLogParetoType2_v_738;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_739> AgradCdfLogParetoType2_v_739;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_740> AgradCdfLogParetoType2_v_740;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_741> AgradCdfLogParetoType2_v_741;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_742> AgradCdfLogParetoType2_v_742;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_743> AgradCdfLogParetoType2_v_743;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_744> AgradCdfLogParetoType2_v_744;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_745> AgradCdfLogParetoType2_v_745;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_746> AgradCdfLogParetoType2_v_746;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_747> AgradCdfLogParetoType2_v_747;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_748> AgradCdfLogParetoType2_v_748;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_749> AgradCdfLogParetoType2_v_749;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_750> AgradCdfLogParetoType2_v_750;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_751> AgradCdfLogParetoType2_v_751;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_752> AgradCdfLogParetoType2_v_752;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_753> AgradCdfLogParetoType2_v_753;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_754> AgradCdfLogParetoType2_v_754;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_755> AgradCdfLogParetoType2_v_755;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_756> AgradCdfLogParetoType2_v_756;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_757> AgradCdfLogParetoType2_v_757;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_758> AgradCdfLogParetoType2_v_758;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_759> AgradCdfLogParetoType2_v_759;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_760> AgradCdfLogParetoType2_v_760;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_761> AgradCdfLogParetoType2_v_761;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_762> AgradCdfLogParetoType2_v_762;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_763> AgradCdfLogParetoType2_v_763;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_764> AgradCdfLogParetoType2_v_764;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_765> AgradCdfLogParetoType2_v_765;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_766> AgradCdfLogParetoType2_v_766;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_767> AgradCdfLogParetoType2_v_767;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_768> AgradCdfLogParetoType2_v_768;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_769> AgradCdfLogParetoType2_v_769;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_770> AgradCdfLogParetoType2_v_770;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_771> AgradCdfLogParetoType2_v_771;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_772> AgradCdfLogParetoType2_v_772;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_773> AgradCdfLogParetoType2_v_773;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_774> AgradCdfLogParetoType2_v_774;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_775> AgradCdfLogParetoType2_v_775;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_776> AgradCdfLogParetoType2_v_776;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_777> AgradCdfLogParetoType2_v_777;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_778> AgradCdfLogParetoType2_v_778;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_779> AgradCdfLogParetoType2_v_779;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_780> AgradCdfLogParetoType2_v_780;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_781> AgradCdfLogParetoType2_v_781;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_782> AgradCdfLogParetoType2_v_782;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_783> AgradCdfLogParetoType2_v_783;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_784> AgradCdfLogParetoType2_v_784;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_785> AgradCdfLogParetoType2_v_785;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_786> AgradCdfLogParetoType2_v_786;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_787> AgradCdfLogParetoType2_v_787;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_788> AgradCdfLogParetoType2_v_788;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_789> AgradCdfLogParetoType2_v_789;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_790> AgradCdfLogParetoType2_v_790;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_791> AgradCdfLogParetoType2_v_791;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_792> AgradCdfLogParetoType2_v_792;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_793> AgradCdfLogParetoType2_v_793;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_794> AgradCdfLogParetoType2_v_794;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_795> AgradCdfLogParetoType2_v_795;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_796> AgradCdfLogParetoType2_v_796;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_797> AgradCdfLogParetoType2_v_797;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_798> AgradCdfLogParetoType2_v_798;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_799> AgradCdfLogParetoType2_v_799;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_700, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_700);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_701, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_701);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_702, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_702);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_703, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_703);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_704, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_704);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_705, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_705);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_706, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_706);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_707, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_707);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_708, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_708);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_709, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_709);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_710, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_710);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_711, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_711);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_712, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_712);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_713, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_713);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_714, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_714);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_715, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_715);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_716, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_716);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_717, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_717);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_718, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_718);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_719, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_719);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_720, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_720);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_721, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_721);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_722, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_722);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_723, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_723);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_724, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_724);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_725, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_725);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_726, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_726);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_727, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_727);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_728, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_728);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_729, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_729);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_730, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_730);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_731, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_731);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_732, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_732);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_733, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_733);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_734, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_734);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_735, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_735);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_736, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_736);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_737, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_737);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_738, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_738);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_739, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_739);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_740, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_740);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_741, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_741);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_742, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_742);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_743, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_743);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_744, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_744);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_745, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_745);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_746, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_746);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_747, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_747);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_748, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_748);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_749, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_749);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_750, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_750);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_751, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_751);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_752, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_752);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_753, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_753);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_754, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_754);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_755, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_755);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_756, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_756);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_757, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_757);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_758, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_758);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_759, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_759);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_760, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_760);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_761, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_761);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_762, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_762);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_763, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_763);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_764, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_764);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_765, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_765);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_766, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_766);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_767, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_767);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_768, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_768);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_769, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_769);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_770, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_770);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_771, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_771);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_772, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_772);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_773, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_773);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_774, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_774);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_775, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_775);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_776, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_776);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_777, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_777);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_778, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_778);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_779, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_779);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_780, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_780);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_781, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_781);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_782, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_782);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_783, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_783);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_784, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_784);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_785, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_785);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_786, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_786);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_787, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_787);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_788, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_788);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_789, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_789);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_790, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_790);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_791, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_791);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_792, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_792);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_793, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_793);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_794, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_794);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_795, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_795);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_796, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_796);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_797, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_797);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_798, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_798);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_799, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_799);
+
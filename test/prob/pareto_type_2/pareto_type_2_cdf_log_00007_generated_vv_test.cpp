@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_cdf_log_test.hpp>
+
+typedef std::tuple<var, var, std::vector<var>, std::vector<double>, empty, empty> type_vv_700;
+typedef std::tuple<var, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_701;
+typedef std::tuple<var, var, std::vector<var>, var, empty, empty> type_vv_702;
+typedef std::tuple<var, var, std::vector<var>, std::vector<var>, empty, empty> type_vv_703;
+typedef std::tuple<var, var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_704;
+typedef std::tuple<var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_705;
+typedef std::tuple<var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_706;
+typedef std::tuple<var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_707;
+typedef std::tuple<var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_708;
+typedef std::tuple<var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_709;
+typedef std::tuple<var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_710;
+typedef std::tuple<var, std::vector<var>, double, double, empty, empty> type_vv_711;
+typedef std::tuple<var, std::vector<var>, double, std::vector<double>, empty, empty> type_vv_712;
+typedef std::tuple<var, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_713;
+typedef std::tuple<var, std::vector<var>, double, var, empty, empty> type_vv_714;
+typedef std::tuple<var, std::vector<var>, double, std::vector<var>, empty, empty> type_vv_715;
+typedef std::tuple<var, std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_716;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, double, empty, empty> type_vv_717;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_vv_718;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_719;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, var, empty, empty> type_vv_720;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_vv_721;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_722;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_723;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_724;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_725;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_726;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_727;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_728;
+typedef std::tuple<var, std::vector<var>, var, double, empty, empty> type_vv_729;
+typedef std::tuple<var, std::vector<var>, var, std::vector<double>, empty, empty> type_vv_730;
+typedef std::tuple<var, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_731;
+typedef std::tuple<var, std::vector<var>, var, var, empty, empty> type_vv_732;
+typedef std::tuple<var, std::vector<var>, var, std::vector<var>, empty, empty> type_vv_733;
+typedef std::tuple<var, std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_734;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, double, empty, empty> type_vv_735;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_vv_736;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_737;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, var, empty, empty> type_vv_738;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_vv_739;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_740;
+typedef std::tuple<var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_741;
+typedef std::tuple<var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_742;
+typedef std::tuple<var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_743;
+typedef std::tuple<var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_744;
+typedef std::tuple<var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_745;
+typedef std::tuple<var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_746;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, empty, empty> type_vv_747;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, empty, empty> type_vv_748;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_749;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, empty, empty> type_vv_750;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, empty, empty> type_vv_751;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_752;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, empty, empty> type_vv_753;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, empty, empty> type_vv_754;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_755;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, empty, empty> type_vv_756;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, empty, empty> type_vv_757;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_758;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_759;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_760;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_761;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_762;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_763;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_764;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, empty, empty> type_vv_765;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, empty, empty> type_vv_766;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_767;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, empty, empty> type_vv_768;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, empty, empty> type_vv_769;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_770;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, empty, empty> type_vv_771;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, empty, empty> type_vv_772;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_773;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, empty, empty> type_vv_774;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, empty, empty> type_vv_775;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_776;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_777;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_778;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_779;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_780;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_781;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_782;
+typedef std::tuple<std::vector<var>, double, double, double, empty, empty> type_vv_783;
+typedef std::tuple<std::vector<var>, double, double, std::vector<double>, empty, empty> type_vv_784;
+typedef std::tuple<std::vector<var>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_785;
+typedef std::tuple<std::vector<var>, double, double, var, empty, empty> type_vv_786;
+typedef std::tuple<std::vector<var>, double, double, std::vector<var>, empty, empty> type_vv_787;
+typedef std::tuple<std::vector<var>, double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_788;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, double, empty, empty> type_vv_789;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, std::vector<double>, empty, empty> type_vv_790;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_791;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, var, empty, empty> type_vv_792;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, std::vector<var>, empty, empty> type_vv_793;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_794;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_795;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_796;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_797;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_798;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_799;
+
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_700> AgradCdfLogParetoType2_vv_700;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_701> AgradCdfLogParetoType2_vv_701;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_702> AgradCdfLogParetoType2_vv_702;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_703> AgradCdfLogParetoType2_vv_703;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_704> AgradCdfLogParetoType2_vv_704;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_705> AgradCdfLogParetoType2_vv_705;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_706> AgradCdfLogParetoType2_vv_706;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_707> AgradCdfLogParetoType2_vv_707;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_708> AgradCdfLogParetoType2_vv_708;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_709> AgradCdfLogParetoType2_vv_709;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_710> AgradCdfLogParetoType2_vv_710;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_711> AgradCdfLogParetoType2_vv_711;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_712> AgradCdfLogParetoType2_vv_712;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_713> AgradCdfLogParetoType2_vv_713;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_714> AgradCdfLogParetoType2_vv_714;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_715> AgradCdfLogParetoType2_vv_715;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_716> AgradCdfLogParetoType2_vv_716;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_717> AgradCdfLogParetoType2_vv_717;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_718> AgradCdfLogParetoType2_vv_718;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_719> AgradCdfLogParetoType2_vv_719;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_720> AgradCdfLogParetoType2_vv_720;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_721> AgradCdfLogParetoType2_vv_721;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_722> AgradCdfLogParetoType2_vv_722;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_723> AgradCdfLogParetoType2_vv_723;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_724> AgradCdfLogParetoType2_vv_724;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_725> AgradCdfLogParetoType2_vv_725;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_726> AgradCdfLogParetoType2_vv_726;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_727> AgradCdfLogParetoType2_vv_727;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_728> AgradCdfLogParetoType2_vv_728;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_729> AgradCdfLogParetoType2_vv_729;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_730> AgradCdfLogParetoType2_vv_730;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_731> AgradCdfLogParetoType2_vv_731;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_732> AgradCdfLogParetoType2_vv_732;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_733> AgradCdfLogParetoType2_vv_733;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_734> AgradCdfLogParetoType2_vv_734;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_735> AgradCdfLogParetoType2_vv_735;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_736> AgradCdfLogParetoType2_vv_736;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_737> AgradCdfLogParetoType2_vv_737;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_738> AgradCdfLogParetoType2_vv_738;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_739> AgradCdfLogParetoType2_vv_739;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_740> AgradCdfLogParetoType2_vv_740;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_741> AgradCdfLogParetoType2_vv_741;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_742> AgradCdfLogParetoType2_vv_742;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_743> AgradCdfLogParetoType2_vv_743;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_744> AgradCdfLogParetoType2_vv_744;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_745> AgradCdfLogParetoType2_vv_745;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_746> AgradCdfLogParetoType2_vv_746;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_747> AgradCdfLogParetoType2_vv_747;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_748> AgradCdfLogParetoType2_vv_748;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_749> AgradCdfLogParetoType2_vv_749;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_750> AgradCdfLogParetoType2_vv_750;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_751> AgradCdfLogParetoType2_vv_751;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_752> AgradCdfLogParetoType2_vv_752;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_753> AgradCdfLogParetoType2_vv_753;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_754> AgradCdfLogParetoType2_vv_754;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_755> AgradCdfLogParetoType2_vv_755;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_756> AgradCdfLogParetoType2_vv_756;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_757> AgradCdfLogParetoType2_vv_757;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_758> AgradCdfLogParetoType2_vv_758;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_759> AgradCdfLogParetoType2_vv_759;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_760> AgradCdfLogParetoType2_vv_760;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_761> AgradCdfLogParetoType2_vv_761;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_762> AgradCdfLogParetoType2_vv_762;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_763> AgradCdfLogParetoType2_vv_763;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_764> AgradCdfLogParetoType2_vv_764;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_765> AgradCdfLogParetoType2_vv_765;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_766> AgradCdfLogParetoType2_vv_766;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_767> AgradCdfLogParetoType2_vv_767;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_768> AgradCdfLogParetoType2_vv_768;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_769> AgradCdfLogParetoType2_vv_769;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_770> AgradCdfLogParetoType2_vv_770;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_771> AgradCdfLogParetoType2_vv_771;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_772> AgradCdfLogParetoType2_vv_772;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_773> AgradCdfLogParetoType2_vv_773;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_774> AgradCdfLogParetoType2_vv_774;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_775> AgradCdfLogParetoType2_vv_775;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_776> AgradCdfLogParetoType2_vv_776;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_777> AgradCdfLogParetoType2_vv_777;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_778> AgradCdfLogParetoType2_vv_778;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_779> AgradCdfLogParetoType2_vv_779;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_780> AgradCdfLogParetoType2_vv_780;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_781> AgradCdfLogParetoType2_vv_781;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_782> AgradCdfLogParetoType2_vv_782;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_783> AgradCdfLogParetoType2_vv_783;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_784> AgradCdfLogParetoType2_vv_784;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_785> AgradCdfLogParetoType2_vv_785;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_786> AgradCdfLogParetoType2_vv_786;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_787> AgradCdfLogParetoType2_vv_787;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_788> AgradCdfLogParetoType2_vv_788;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_789> AgradCdfLogParetoType2_vv_789;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_790> AgradCdfLogParetoType2_vv_790;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_791> AgradCdfLogParetoType2_vv_791;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_792> AgradCdfLogParetoType2_vv_792;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_793> AgradCdfLogParetoType2_vv_793;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_794> AgradCdfLogParetoType2_vv_794;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_795> AgradCdfLogParetoType2_vv_795;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_796> AgradCdfLogParetoType2_vv_796;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_797> AgradCdfLogParetoType2_vv_797;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_798> AgradCdfLogParetoType2_vv_798;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_799> AgradCdfLogParetoType2_vv_799;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_700, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_700);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_701, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_701);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_702, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_702);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_703, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_703);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_704, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_704);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_705, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_705);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_706, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_706);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_707, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_707);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_708, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_708);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_709, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_709);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_710, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_710);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_711, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_711);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_712, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_712);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_713, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_713);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_714, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_714);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_715, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_715);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_716, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_716);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_717, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_717);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_718, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_718);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_719, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_719);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_720, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_720);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_721, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_721);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_722, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_722);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_723, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_723);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_724, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_724);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_725, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_725);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_726, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_726);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_727, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_727);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_728, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_728);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_729, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_729);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_730, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_730);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_731, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_731);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_732, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_732);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_733, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_733);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_734, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_734);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_735, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_735);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_736, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_736);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_737, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_737);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_738, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_738);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_739, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_739);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_740, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_740);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_741, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_741);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_742, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_742);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_743, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_743);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_744, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_744);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_745, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_745);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_746, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_746);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_747, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_747);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_748, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_748);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_749, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_749);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_750, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_750);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_751, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_751);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_752, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_752);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_753, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_753);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_754, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_754);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_755, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_755);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_756, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_756);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_757, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_757);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_758, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_758);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_759, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_759);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_760, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_760);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_761, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_761);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_762, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_762);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_763, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_763);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_764, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_764);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_765, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_765);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_766, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_766);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_767, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_767);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_768, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_768);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_769, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_769);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_770, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_770);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_771, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_771);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_772, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_772);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_773, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_773);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_774, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_774);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_775, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_775);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_776, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_776);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_777, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_777);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_778, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_778);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_779, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_779);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_780, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_780);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_781, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_781);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_782, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_782);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_783, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_783);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_784, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_784);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_785, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_785);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_786, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_786);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_787, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_787);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_788, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_788);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_789, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_789);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_790, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_790);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_791, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_791);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_792, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_792);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_793, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_793);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_794, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_794);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_795, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_795);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_796, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_796);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_797, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_797);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_798, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_798);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_799, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_799);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_cdf_log_test.hpp>
+
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_800;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, double, empty, empty> type_ffv_801;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_802;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_803;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_804;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_805;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_806;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_807;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_808;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_809;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_810;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_811;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_812;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_813;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_814;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_815;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_816;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_817;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_818;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, double, double, empty, empty> type_ffv_819;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, double, std::vector<double>, empty, empty> type_ffv_820;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_821;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, double, fvar<fvar<var> >, empty, empty> type_ffv_822;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_823;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_824;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, double, empty, empty> type_ffv_825;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_826;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_827;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_828;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_829;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_830;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_831;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_832;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_833;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_834;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_835;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_836;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, double, empty, empty> type_ffv_837;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_838;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_839;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_840;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_841;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_842;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_843;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_844;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_845;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_846;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_847;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_848;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_849;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_850;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_851;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_852;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_853;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_854;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty> type_ffv_855;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_ffv_856;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_857;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_858;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_859;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_860;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_ffv_861;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_862;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_863;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_864;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_865;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_866;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_867;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_868;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_869;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_870;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_871;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_872;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_873;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_874;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_875;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_876;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_877;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_878;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_879;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_880;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_881;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_882;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_883;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_884;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_885;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_886;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_887;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_888;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_889;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_890;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, double, empty, empty> type_ffv_891;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, std::vector<double>, empty, empty> type_ffv_892;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_893;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, fvar<fvar<var> >, empty, empty> type_ffv_894;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_895;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_896;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, double, empty, empty> type_ffv_897;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty, empty> type_ffv_898;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_899;
+
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_800> AgradCdfLogParetoType2_ffv_800;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_801> AgradCdfLogParetoType2_ffv_801;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_802> AgradCdfLogParetoType2_ffv_802;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_803> AgradCdfLogParetoType2_ffv_803;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_804> AgradCdfLogParetoType2_ffv_804;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_805> AgradCdfLogParetoType2_ffv_805;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_806> AgradCdfLogParetoType2_ffv_806;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_807> AgradCdfLogParetoType2_ffv_807;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_808> AgradCdfLogParetoType2_ffv_808;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_809> AgradCdfLogParetoType2_ffv_809;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_810> AgradCdfLogParetoType2_ffv_810;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_811> AgradCdfLogParetoType2_ffv_811;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_812> AgradCdfLogParetoType2_ffv_812;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_813> AgradCdfLogParetoType2_ffv_813;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_814> AgradCdfLogParetoType2_ffv_814;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_815> AgradCdfLogParetoType2_ffv_815;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_816> AgradCdfLogParetoType2_ffv_816;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_817> AgradCdfLogParetoType2_ffv_817;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_818> AgradCdfLogParetoType2_ffv_818;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_819> AgradCdfLogParetoType2_ffv_819;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_820> AgradCdfLogParetoType2_ffv_820;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_821> AgradCdfLogParetoType2_ffv_821;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_822> AgradCdfLogParetoType2_ffv_822;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_823> AgradCdfLogParetoType2_ffv_823;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_824> AgradCdfLogParetoType2_ffv_824;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_825> AgradCdfLogParetoType2_ffv_825;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_826> AgradCdfLogParetoType2_ffv_826;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_827> AgradCdfLogParetoType2_ffv_827;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_828> AgradCdfLogParetoType2_ffv_828;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_829> AgradCdfLogParetoType2_ffv_829;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_830> AgradCdfLogParetoType2_ffv_830;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_831> AgradCdfLogParetoType2_ffv_831;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_832> AgradCdfLogParetoType2_ffv_832;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_833> AgradCdfLogParetoType2_ffv_833;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_834> AgradCdfLogParetoType2_ffv_834;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_835> AgradCdfLogParetoType2_ffv_835;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_836> AgradCdfLogParetoType2_ffv_836;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_837> AgradCdfLogParetoType2_ffv_837;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_838> AgradCdfLogParetoType2_ffv_838;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_839> AgradCdfLogParetoType2_ffv_839;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_840> AgradCdfLogParetoType2_ffv_840;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_841> AgradCdfLogParetoType2_ffv_841;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_842> AgradCdfLogParetoType2_ffv_842;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_843> AgradCdfLogParetoType2_ffv_843;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_844> AgradCdfLogParetoType2_ffv_844;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_845> AgradCdfLogParetoType2_ffv_845;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_846> AgradCdfLogParetoType2_ffv_846;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_847> AgradCdfLogParetoType2_ffv_847;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_848> AgradCdfLogParetoType2_ffv_848;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_849> AgradCdfLogParetoType2_ffv_849;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_850> AgradCdfLogParetoType2_ffv_850;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_851> AgradCdfLogParetoType2_ffv_851;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_852> AgradCdfLogParetoType2_ffv_852;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_853> AgradCdfLogParetoType2_ffv_853;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_854> AgradCdfLogParetoType2_ffv_854;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_855> AgradCdfLogParetoType2_ffv_855;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_856> AgradCdfLogParetoType2_ffv_856;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_857> AgradCdfLogParetoType2_ffv_857;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_858> AgradCdfLogParetoType2_ffv_858;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_859> AgradCdfLogParetoType2_ffv_859;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_860> AgradCdfLogParetoType2_ffv_860;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_861> AgradCdfLogParetoType2_ffv_861;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_862> AgradCdfLogParetoType2_ffv_862;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_863> AgradCdfLogParetoType2_ffv_863;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_864> AgradCdfLogParetoType2_ffv_864;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_865> AgradCdfLogParetoType2_ffv_865;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_866> AgradCdfLogParetoType2_ffv_866;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_867> AgradCdfLogParetoType2_ffv_867;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_868> AgradCdfLogParetoType2_ffv_868;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_869> AgradCdfLogParetoType2_ffv_869;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_870> AgradCdfLogParetoType2_ffv_870;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_871> AgradCdfLogParetoType2_ffv_871;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_872> AgradCdfLogParetoType2_ffv_872;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_873> AgradCdfLogParetoType2_ffv_873;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_874> AgradCdfLogParetoType2_ffv_874;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_875> AgradCdfLogParetoType2_ffv_875;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_876> AgradCdfLogParetoType2_ffv_876;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_877> AgradCdfLogParetoType2_ffv_877;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_878> AgradCdfLogParetoType2_ffv_878;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_879> AgradCdfLogParetoType2_ffv_879;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_880> AgradCdfLogParetoType2_ffv_880;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_881> AgradCdfLogParetoType2_ffv_881;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_882> AgradCdfLogParetoType2_ffv_882;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_883> AgradCdfLogParetoType2_ffv_883;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_884> AgradCdfLogParetoType2_ffv_884;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_885> AgradCdfLogParetoType2_ffv_885;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_886> AgradCdfLogParetoType2_ffv_886;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_887> AgradCdfLogParetoType2_ffv_887;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_888> AgradCdfLogParetoType2_ffv_888;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_889> AgradCdfLogParetoType2_ffv_889;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_890> AgradCdfLogParetoType2_ffv_890;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_891> AgradCdfLogParetoType2_ffv_891;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_892> AgradCdfLogParetoType2_ffv_892;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_893> AgradCdfLogParetoType2_ffv_893;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_894> AgradCdfLogParetoType2_ffv_894;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_895> AgradCdfLogParetoType2_ffv_895;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_896> AgradCdfLogParetoType2_ffv_896;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_897> AgradCdfLogParetoType2_ffv_897;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_898> AgradCdfLogParetoType2_ffv_898;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_899> AgradCdfLogParetoType2_ffv_899;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_800, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_800);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_801, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_801);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_802, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_802);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_803, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_803);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_804, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_804);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_805, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_805);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_806, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_806);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_807, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_807);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_808, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_808);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_809, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_809);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_810, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_810);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_811, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_811);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_812, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_812);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_813, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_813);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_814, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_814);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_815, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_815);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_816, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_816);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_817, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_817);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_818, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_818);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_819, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_819);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_820, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_820);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_821, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_821);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_822, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_822);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_823, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_823);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_824, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_824);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_825, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_825);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_826, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_826);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_827, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_827);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_828, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_828);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_829, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_829);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_830, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_830);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_831, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_831);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_832, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_832);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_833, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_833);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_834, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_834);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_835, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_835);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_836, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_836);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_837, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_837);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_838, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_838);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_839, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_839);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_840, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_840);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_841, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_841);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_842, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_842);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_843, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_843);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_844, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_844);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_845, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_845);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_846, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_846);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_847, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_847);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_848, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_848);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_849, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_849);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_850, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_850);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_851, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_851);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_852, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_852);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_853, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_853);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_854, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_854);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_855, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_855);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_856, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_856);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_857, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_857);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_858, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_858);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_859, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_859);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_860, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_860);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_861, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_861);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_862, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_862);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_863, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_863);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_864, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_864);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_865, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_865);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_866, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_866);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_867, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_867);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_868, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_868);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_869, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_869);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_870, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_870);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_871, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_871);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_872, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_872);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_873, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_873);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_874, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_874);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_875, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_875);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_876, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_876);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_877, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_877);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_878, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_878);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_879, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_879);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_880, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_880);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_881, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_881);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_882, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_882);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_883, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_883);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_884, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_884);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_885, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_885);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_886, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_886);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_887, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_887);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_888, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_888);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_889, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_889);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_890, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_890);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_891, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_891);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_892, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_892);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_893, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_893);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_894, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_894);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_895, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_895);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_896, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_896);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_897, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_897);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_898, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_898);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_899, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_899);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_cdf_log_test.hpp>
+
+typedef std::tuple<var, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_800;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, var, empty, empty> type_v_801;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_v_802;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_803;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_804;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_805;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_806;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_807;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_808;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_809;
+typedef std::tuple<var, std::vector<var>, var, double, empty, empty> type_v_810;
+typedef std::tuple<var, std::vector<var>, var, std::vector<double>, empty, empty> type_v_811;
+typedef std::tuple<var, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_812;
+typedef std::tuple<var, std::vector<var>, var, var, empty, empty> type_v_813;
+typedef std::tuple<var, std::vector<var>, var, std::vector<var>, empty, empty> type_v_814;
+typedef std::tuple<var, std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_815;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, double, empty, empty> type_v_816;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_v_817;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_818;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, var, empty, empty> type_v_819;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_v_820;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_821;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_822;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_823;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_824;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_825;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_826;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_827;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_828;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_829;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_830;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_831;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_832;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_833;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_834;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_835;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_836;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_837;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_838;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_839;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_840;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_841;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_842;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_843;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_844;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_845;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_846;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_847;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_848;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_849;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_850;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_851;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_852;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_853;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_854;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_855;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_856;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_857;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_858;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_859;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_860;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_861;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_862;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_863;
+typedef std::tuple<std::vector<var>, double, double, double, empty, empty> type_v_864;
+typedef std::tuple<std::vector<var>, double, double, std::vector<double>, empty, empty> type_v_865;
+typedef std::tuple<std::vector<var>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_866;
+typedef std::tuple<std::vector<var>, double, double, var, empty, empty> type_v_867;
+typedef std::tuple<std::vector<var>, double, double, std::vector<var>, empty, empty> type_v_868;
+typedef std::tuple<std::vector<var>, double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_869;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, double, empty, empty> type_v_870;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, std::vector<double>, empty, empty> type_v_871;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_872;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, var, empty, empty> type_v_873;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, std::vector<var>, empty, empty> type_v_874;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_875;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_876;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_877;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_878;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_879;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_880;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_881;
+typedef std::tuple<std::vector<var>, double, var, double, empty, empty> type_v_882;
+typedef std::tuple<std::vector<var>, double, var, std::vector<double>, empty, empty> type_v_883;
+typedef std::tuple<std::vector<var>, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_884;
+typedef std::tuple<std::vector<var>, double, var, var, empty, empty> type_v_885;
+typedef std::tuple<std::vector<var>, double, var, std::vector<var>, empty, empty> type_v_886;
+typedef std::tuple<std::vector<var>, double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_887;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, double, empty, empty> type_v_888;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, std::vector<double>, empty, empty> type_v_889;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_890;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, var, empty, empty> type_v_891;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, std::vector<var>, empty, empty> type_v_892;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_893;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_894;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_895;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_896;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_897;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_898;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_899;
+
+typedef std::tuple<AgradCdfLogParetoType2, type_v_800> AgradCdfLogParetoType2_v_800;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_801> AgradCdfLogParetoType2_v_801;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_802> AgradCdfLogParetoType2_v_802;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_803> AgradCdfLogParetoType2_v_803;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_804> AgradCdfLogParetoType2_v_804;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_805> AgradCdfLogParetoType2_v_805;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_806> AgradCdfLogParetoType2_v_806;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_807> AgradCdfLogParetoType2_v_807;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_808> AgradCdfLogParetoType2_v_808;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_809> AgradCdfLogParetoType2_v_809;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_810> AgradCdfLogParetoType2_v_810;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_811> AgradCdfLogParetoType2_v_811;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_812> AgradCdfLogParetoType2_v_812;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_813> AgradCdfLogParetoType2_v_813;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_814> AgradCdfLogParetoType2_v_814;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_815> AgradCdfLogParetoType2_v_815;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_816> AgradCdfLogParetoType2_v_816;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_817> AgradCdfLogParetoType2_v_817;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_818> AgradCdfLogParetoType2_v_818;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_819> AgradCdfLogParetoType2_v_819;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_820> AgradCdfLogParetoType2_v_820;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_821> AgradCdfLogParetoType2_v_821;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_822> AgradCdfLogParetoType2_v_822;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_823> AgradCdfLogParetoType2_v_823;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_824> AgradCdfLogParetoType2_v_824;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_825> AgradCdfLogParetoType2_v_825;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_826> AgradCdfLogParetoType2_v_826;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_827> AgradCdfLogParetoType2_v_827;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_828> AgradCdfLogParetoType2_v_828;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_829> AgradCdfLogParetoType2_v_829;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_830> AgradCdfLogParetoType2_v_830;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_831> AgradCdfLogParetoType2_v_831;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_832> AgradCdfLogParetoType2_v_832;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_833> AgradCdfLogParetoType2_v_833;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_834> AgradCdfLogParetoType2_v_834;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_835> AgradCdfLogParetoType2_v_835;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_836> AgradCdfLogParetoType2_v_836;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_837> AgradCdfLogParetoType2_v_837;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_838> AgradCdfLogParetoType2_v_838;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_839> AgradCdfLogParetoType2_v_839;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_840> AgradCdfLogParetoType2_v_840;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_841> AgradCdfLogParetoType2_v_841;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_842> AgradCdfLogParetoType2_v_842;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_843> AgradCdfLogParetoType2_v_843;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_844> AgradCdfLogParetoType2_v_844;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_845> AgradCdfLogParetoType2_v_845;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_846> AgradCdfLogParetoType2_v_846;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_847> AgradCdfLogParetoType2_v_847;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_848> AgradCdfLogParetoType2_v_848;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_849> AgradCdfLogParetoType2_v_849;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_850> AgradCdfLogParetoType2_v_850;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_851> AgradCdfLogParetoType2_v_851;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_852> AgradCdfLogParetoType2_v_852;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_853> AgradCdfLogParetoType2_v_853;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_854> AgradCdfLogParetoType2_v_854;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_855> AgradCdfLogParetoType2_v_855;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_856> AgradCdfLogParetoType2_v_856;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_857> AgradCdfLogParetoType2_v_857;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_858> AgradCdfLogParetoType2_v_858;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_859> AgradCdfLogParetoType2_v_859;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_860> AgradCdfLogParetoType2_v_860;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_861> AgradCdfLogParetoType2_v_861;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_862> AgradCdfLogParetoType2_v_862;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_863> AgradCdfLogParetoType2_v_863;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_864> AgradCdfLogParetoType2_v_864;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_865> AgradCdfLogParetoType2_v_865;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_866> AgradCdfLogParetoType2_v_866;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_867> AgradCdfLogParetoType2_v_867;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_868> AgradCdfLogParetoType2_v_868;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_869> AgradCdfLogParetoType2_v_869;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_870> AgradCdfLogParetoType2_v_870;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_871> AgradCdfLogParetoType2_v_871;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_872> AgradCdfLogParetoType2_v_872;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_873> AgradCdfLogParetoType2_v_873;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_874> AgradCdfLogParetoType2_v_874;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_875> AgradCdfLogParetoType2_v_875;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_876> AgradCdfLogParetoType2_v_876;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_877> AgradCdfLogParetoType2_v_877;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_878> AgradCdfLogParetoType2_v_878;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_879> AgradCdfLogParetoType2_v_879;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_880> AgradCdfLogParetoType2_v_880;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_881> AgradCdfLogParetoType2_v_881;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_882> AgradCdfLogParetoType2_v_882;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_883> AgradCdfLogParetoType2_v_883;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_884> AgradCdfLogParetoType2_v_884;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_885> AgradCdfLogParetoType2_v_885;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_886> AgradCdfLogParetoType2_v_886;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_887> AgradCdfLogParetoType2_v_887;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_888> AgradCdfLogParetoType2_v_888;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_889> AgradCdfLogParetoType2_v_889;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_890> AgradCdfLogParetoType2_v_890;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_891> AgradCdfLogParetoType2_v_891;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_892> AgradCdfLogParetoType2_v_892;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_893> AgradCdfLogParetoType2_v_893;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_894> AgradCdfLogParetoType2_v_894;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_895> AgradCdfLogParetoType2_v_895;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_896> AgradCdfLogParetoType2_v_896;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_897> AgradCdfLogParetoType2_v_897;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_898> AgradCdfLogParetoType2_v_898;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_899> AgradCdfLogParetoType2_v_899;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_800, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_800);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_801, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_801);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_802, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_802);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_803, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_803);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_804, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_804);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_805, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_805);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_806, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_806);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_807, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_807);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_808, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_808);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_809, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_809);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_810, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_810);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_811, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_811);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_812, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_812);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_813, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_813);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_814, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_814);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_815, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_815);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_816, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_816);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_817, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_817);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_818, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_818);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_819, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_819);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_820, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_820);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_821, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_821);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_822, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_822);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_823, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_823);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_824, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_824);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_825, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_825);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_826, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_826);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_827, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_827);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_828, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_828);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_829, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_829);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_830, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_830);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_831, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_831);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_832, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_832);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_833, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_833);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_834, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_834);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_835, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_835);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_836, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_836);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_837, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_837);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_838, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_838);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_839, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_839);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_840, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_840);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_841, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_841);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_842, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_842);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_843, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_843);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_844, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_844);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_845, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_845);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_846, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_846);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_847, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_847);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_848, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_848);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_849, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_849);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_850, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_850);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_851, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_851);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_852, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_852);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_853, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_853);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_854, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_854);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_855, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_855);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_856, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_856);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_857, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_857);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_858, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_858);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_859, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_859);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_860, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_860);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_861, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_861);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_862, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_862);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_863, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_863);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_864, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_864);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_865, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_865);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_866, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_866);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_867, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_867);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_868, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_868);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_869, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_869);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_870, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_870);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_871, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_871);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_872, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_872);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_873, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_873);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_874, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_874);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_875, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_875);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_876, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_876);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_877, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_877);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_878, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_878);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_879, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_879);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_880, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_880);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_881, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_881);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_882, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_882);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_883, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_883);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_884, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_884);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_885, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_885);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_886, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_886);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_887, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_887);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_888, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_888);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_889, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_889);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_890, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_890);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_891, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_891);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_892, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_892);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_893, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_893);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_894, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_894);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_895, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_895);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_896, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_896);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_897, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_897);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_898, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_898);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_899, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_899);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_cdf_log_test.hpp>
+
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_800;
+typedef std::tuple<std::vector<var>, double, var, double, empty, empty> type_vv_801;
+typedef std::tuple<std::vector<var>, double, var, std::vector<double>, empty, empty> type_vv_802;
+typedef std::tuple<std::vector<var>, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_803;
+typedef std::tuple<std::vector<var>, double, var, var, empty, empty> type_vv_804;
+typedef std::tuple<std::vector<var>, double, var, std::vector<var>, empty, empty> type_vv_805;
+typedef std::tuple<std::vector<var>, double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_806;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, double, empty, empty> type_vv_807;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, std::vector<double>, empty, empty> type_vv_808;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_809;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, var, empty, empty> type_vv_810;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, std::vector<var>, empty, empty> type_vv_811;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_812;
+typedef std::tuple<std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_813;
+typedef std::tuple<std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_814;
+typedef std::tuple<std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_815;
+typedef std::tuple<std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_816;
+typedef std::tuple<std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_817;
+typedef std::tuple<std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_818;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, double, empty, empty> type_vv_819;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, std::vector<double>, empty, empty> type_vv_820;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_821;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, var, empty, empty> type_vv_822;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, std::vector<var>, empty, empty> type_vv_823;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_824;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, double, empty, empty> type_vv_825;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, std::vector<double>, empty, empty> type_vv_826;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_827;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, var, empty, empty> type_vv_828;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_vv_829;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_830;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_831;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_832;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_833;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_834;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_835;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_836;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, double, empty, empty> type_vv_837;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, std::vector<double>, empty, empty> type_vv_838;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_839;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, var, empty, empty> type_vv_840;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, std::vector<var>, empty, empty> type_vv_841;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_842;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, double, empty, empty> type_vv_843;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_vv_844;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_845;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, var, empty, empty> type_vv_846;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_vv_847;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_848;
+typedef std::tuple<std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_849;
+typedef std::tuple<std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_850;
+typedef std::tuple<std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_851;
+typedef std::tuple<std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_852;
+typedef std::tuple<std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_853;
+typedef std::tuple<std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_854;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty> type_vv_855;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_vv_856;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_857;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_vv_858;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_vv_859;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_860;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_vv_861;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_vv_862;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_863;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_vv_864;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_vv_865;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_866;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_867;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_868;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_869;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_870;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_871;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_872;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_vv_873;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_vv_874;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_875;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_vv_876;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_vv_877;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_878;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_vv_879;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_vv_880;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_881;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_vv_882;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_vv_883;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_884;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_885;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_886;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_887;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_888;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_889;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_890;
+typedef std::tuple<std::vector<var>, var, double, double, empty, empty> type_vv_891;
+typedef std::tuple<std::vector<var>, var, double, std::vector<double>, empty, empty> type_vv_892;
+typedef std::tuple<std::vector<var>, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_893;
+typedef std::tuple<std::vector<var>, var, double, var, empty, empty> type_vv_894;
+typedef std::tuple<std::vector<var>, var, double, std::vector<var>, empty, empty> type_vv_895;
+typedef std::tuple<std::vector<var>, var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_896;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, double, empty, empty> type_vv_897;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, std::vector<double>, empty, empty> type_vv_898;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_899;
+
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_800> AgradCdfLogParetoType2_vv_800;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_801> AgradCdfLogParetoType2_vv_801;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_802> AgradCdfLogParetoType2_vv_802;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_803> AgradCdfLogParetoType2_vv_803;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_804> AgradCdfLogParetoType2_vv_804;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_805> AgradCdfLogParetoType2_vv_805;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_806> AgradCdfLogParetoType2_vv_806;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_807> AgradCdfLogParetoType2_vv_807;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_808> AgradCdfLogParetoType2_vv_808;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_809> AgradCdfLogParetoType2_vv_809;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_810> AgradCdfLogParetoType2_vv_810;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_811> AgradCdfLogParetoType2_vv_811;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_812> AgradCdfLogParetoType2_vv_812;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_813> AgradCdfLogParetoType2_vv_813;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_814> AgradCdfLogParetoType2_vv_814;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_815> AgradCdfLogParetoType2_vv_815;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_816> AgradCdfLogParetoType2_vv_816;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_817> AgradCdfLogParetoType2_vv_817;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_818> AgradCdfLogParetoType2_vv_818;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_819> AgradCdfLogParetoType2_vv_819;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_820> AgradCdfLogParetoType2_vv_820;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_821> AgradCdfLogParetoType2_vv_821;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_822> AgradCdfLogParetoType2_vv_822;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_823> AgradCdfLogParetoType2_vv_823;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_824> AgradCdfLogParetoType2_vv_824;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_825> AgradCdfLogParetoType2_vv_825;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_826> AgradCdfLogParetoType2_vv_826;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_827> AgradCdfLogParetoType2_vv_827;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_828> AgradCdfLogParetoType2_vv_828;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_829> AgradCdfLogParetoType2_vv_829;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_830> AgradCdfLogParetoType2_vv_830;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_831> AgradCdfLogParetoType2_vv_831;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_832> AgradCdfLogParetoType2_vv_832;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_833> AgradCdfLogParetoType2_vv_833;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_834> AgradCdfLogParetoType2_vv_834;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_835> AgradCdfLogParetoType2_vv_835;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_836> AgradCdfLogParetoType2_vv_836;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_837> AgradCdfLogParetoType2_vv_837;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_838> AgradCdfLogParetoType2_vv_838;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_839> AgradCdfLogParetoType2_vv_839;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_840> AgradCdfLogParetoType2_vv_840;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_841> AgradCdfLogParetoType2_vv_841;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_842> AgradCdfLogParetoType2_vv_842;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_843> AgradCdfLogParetoType2_vv_843;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_844> AgradCdfLogParetoType2_vv_844;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_845> AgradCdfLogParetoType2_vv_845;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_846> AgradCdfLogParetoType2_vv_846;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_847> AgradCdfLogParetoType2_vv_847;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_848> AgradCdfLogParetoType2_vv_848;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_849> AgradCdfLogParetoType2_vv_849;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_850> AgradCdfLogParetoType2_vv_850;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_851> AgradCdfLogParetoType2_vv_851;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_852> AgradCdfLogParetoType2_vv_852;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_853> AgradCdfLogParetoType2_vv_853;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_854> AgradCdfLogParetoType2_vv_854;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_855> AgradCdfLogParetoType2_vv_855;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_856> AgradCdfLogParetoType2_vv_856;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_857> AgradCdfLogParetoType2_vv_857;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_858> AgradCdfLogParetoType2_vv_858;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_859> AgradCdfLogParetoType2_vv_859;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_860> AgradCdfLogParetoType2_vv_860;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_861> AgradCdfLogParetoType2_vv_861;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_862> AgradCdfLogParetoType2_vv_862;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_863> AgradCdfLogParetoType2_vv_863;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_864> AgradCdfLogParetoType2_vv_864;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_865> AgradCdfLogParetoType2_vv_865;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_866> AgradCdfLogParetoType2_vv_866;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_867> AgradCdfLogParetoType2_vv_867;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_868> AgradCdfLogParetoType2_vv_868;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_869> AgradCdfLogParetoType2_vv_869;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_870> AgradCdfLogParetoType2_vv_870;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_871> AgradCdfLogParetoType2_vv_871;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_872> AgradCdfLogParetoType2_vv_872;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_873> AgradCdfLogParetoType2_vv_873;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_874> AgradCdfLogParetoType2_vv_874;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_875> AgradCdfLogParetoType2_vv_875;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_876> AgradCdfLogParetoType2_vv_876;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_877> AgradCdfLogParetoType2_vv_877;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_878> AgradCdfLogParetoType2_vv_878;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_879> AgradCdfLogParetoType2_vv_879;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_880> AgradCdfLogParetoType2_vv_880;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_881> AgradCdfLogParetoType2_vv_881;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_882> AgradCdfLogParetoType2_vv_882;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_883> AgradCdfLogParetoType2_vv_883;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_884> AgradCdfLogParetoType2_vv_884;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_885> AgradCdfLogParetoType2_vv_885;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_886> AgradCdfLogParetoType2_vv_886;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_887> AgradCdfLogParetoType2_vv_887;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_888> AgradCdfLogParetoType2_vv_888;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_889> AgradCdfLogParetoType2_vv_889;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_890> AgradCdfLogParetoType2_vv_890;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_891> AgradCdfLogParetoType2_vv_891;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_892> AgradCdfLogParetoType2_vv_892;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_893> AgradCdfLogParetoType2_vv_893;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_894> AgradCdfLogParetoType2_vv_894;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_895> AgradCdfLogParetoType2_vv_895;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_896> AgradCdfLogParetoType2_vv_896;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_897> AgradCdfLogParetoType2_vv_897;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_898> AgradCdfLogParetoType2_vv_898;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_899> AgradCdfLogParetoType2_vv_899;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_800, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_800);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_801, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_801);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_802, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_802);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_803, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_803);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_804, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_804);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_805, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_805);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_806, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_806);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_807, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_807);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_808, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_808);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_809, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_809);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_810, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_810);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_811, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_811);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_812, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_812);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_813, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_813);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_814, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_814);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_815, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_815);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_816, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_816);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_817, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_817);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_818, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_818);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_819, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_819);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_820, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_820);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_821, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_821);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_822, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_822);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_823, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_823);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_824, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_824);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_825, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_825);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_826, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_826);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_827, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_827);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_828, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_828);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_829, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_829);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_830, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_830);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_831, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_831);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_832, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_832);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_833, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_833);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_834, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_834);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_835, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_835);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_836, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_836);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_837, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_837);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_838, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_838);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_839, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_839);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_840, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_840);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_841, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_841);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_842, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_842);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_843, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_843);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_844, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_844);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_845, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_845);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_846, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_846);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_847, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_847);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_848, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_848);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_849, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_849);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_850, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_850);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_851, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_851);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_852, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_852);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_853, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_853);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_854, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_854);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_855, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_855);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_856, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_856);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_857, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_857);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_858, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_858);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_859, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_859);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_860, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_860);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_861, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_861);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_862, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_862);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_863, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_863);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_864, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_864);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_865, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_865);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_866, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_866);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_867, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_867);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_868, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_868);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_869, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_869);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_870, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_870);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_871, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_871);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_872, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_872);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_873, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_873);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_874, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_874);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_875, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_875);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_876, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_876);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_877, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_877);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_878, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_878);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_879, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_879);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_880, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_880);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_881, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_881);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_882, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_882);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_883, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_883);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_884, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_884);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_885, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_885);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_886, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_886);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_887, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_887);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_888, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_888);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_889, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_889);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_890, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_890);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_891, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_891);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_892, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_892);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_893, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_893);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_894, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_894);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_895, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_895);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_896, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_896);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_897, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_897);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_898, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_898);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_899, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_899);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_cdf_log_test.hpp>
+
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_900;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_901;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_902;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_903;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_904;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_905;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_906;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_907;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_908;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, double, empty, empty> type_ffv_909;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_910;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_911;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_912;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_913;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_914;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_915;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_916;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_917;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_918;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_919;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_920;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_921;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_922;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_923;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_924;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_925;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_926;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, double, empty, empty> type_ffv_927;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty, empty> type_ffv_928;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_929;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty, empty> type_ffv_930;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_931;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_932;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty, empty> type_ffv_933;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_934;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_935;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_936;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_937;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_938;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_939;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_940;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_941;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_942;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_943;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_944;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty, empty> type_ffv_945;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_946;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_947;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_948;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_949;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_950;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_951;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_952;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_953;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_954;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_955;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_956;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_957;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_958;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_959;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_960;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_961;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_962;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty, empty> type_ffv_963;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_ffv_964;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_965;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_966;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_967;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_968;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_ffv_969;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_970;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_971;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_972;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_973;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_974;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_975;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_976;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_977;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_978;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_979;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_980;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_981;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_982;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_983;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_984;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_985;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_986;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_987;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_988;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_989;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_990;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_991;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_992;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_993;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_994;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_995;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_996;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_997;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_998;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, double, empty, empty> type_ffv_999;
+
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_900> AgradCdfLogParetoType2_ffv_900;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_901> AgradCdfLogParetoType2_ffv_901;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_902> AgradCdfLogParetoType2_ffv_902;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_903> AgradCdfLogParetoType2_ffv_903;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_904> AgradCdfLogParetoType2_ffv_904;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_905> AgradCdfLogParetoType2_ffv_905;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_906> AgradCdfLogParetoType2_ffv_906;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_907> AgradCdfLogParetoType2_ffv_907;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_908> AgradCdfLogParetoType2_ffv_908;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_909> AgradCdfLogParetoType2_ffv_909;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_910> AgradCdfLogParetoType2_ffv_910;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_911> AgradCdfLogParetoType2_ffv_911;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_912> AgradCdfLogParetoType2_ffv_912;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_913> AgradCdfLogParetoType2_ffv_913;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_914> AgradCdfLogParetoType2_ffv_914;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_915> AgradCdfLogParetoType2_ffv_915;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_916> AgradCdfLogParetoType2_ffv_916;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_917> AgradCdfLogParetoType2_ffv_917;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_918> AgradCdfLogParetoType2_ffv_918;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_919> AgradCdfLogParetoType2_ffv_919;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_920> AgradCdfLogParetoType2_ffv_920;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_921> AgradCdfLogParetoType2_ffv_921;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_922> AgradCdfLogParetoType2_ffv_922;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_923> AgradCdfLogParetoType2_ffv_923;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_924> AgradCdfLogParetoType2_ffv_924;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_925> AgradCdfLogParetoType2_ffv_925;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_926> AgradCdfLogParetoType2_ffv_926;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_927> AgradCdfLogParetoType2_ffv_927;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_928> AgradCdfLogParetoType2_ffv_928;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_929> AgradCdfLogParetoType2_ffv_929;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_930> AgradCdfLogParetoType2_ffv_930;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_931> AgradCdfLogParetoType2_ffv_931;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_932> AgradCdfLogParetoType2_ffv_932;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_933> AgradCdfLogParetoType2_ffv_933;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_934> AgradCdfLogParetoType2_ffv_934;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_935> AgradCdfLogParetoType2_ffv_935;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_936> AgradCdfLogParetoType2_ffv_936;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_937> AgradCdfLogParetoType2_ffv_937;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_938> AgradCdfLogParetoType2_ffv_938;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_939> AgradCdfLogParetoType2_ffv_939;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_940> AgradCdfLogParetoType2_ffv_940;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_941> AgradCdfLogParetoType2_ffv_941;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_942> AgradCdfLogParetoType2_ffv_942;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_943> AgradCdfLogParetoType2_ffv_943;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_944> AgradCdfLogParetoType2_ffv_944;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_945> AgradCdfLogParetoType2_ffv_945;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_946> AgradCdfLogParetoType2_ffv_946;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_947> AgradCdfLogParetoType2_ffv_947;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_948> AgradCdfLogParetoType2_ffv_948;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_949> AgradCdfLogParetoType2_ffv_949;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_950> AgradCdfLogParetoType2_ffv_950;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_951> AgradCdfLogParetoType2_ffv_951;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_952> AgradCdfLogParetoType2_ffv_952;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_953> AgradCdfLogParetoType2_ffv_953;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_954> AgradCdfLogParetoType2_ffv_954;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_955> AgradCdfLogParetoType2_ffv_955;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_956> AgradCdfLogParetoType2_ffv_956;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_957> AgradCdfLogParetoType2_ffv_957;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_958> AgradCdfLogParetoType2_ffv_958;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_959> AgradCdfLogParetoType2_ffv_959;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_960> AgradCdfLogParetoType2_ffv_960;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_961> AgradCdfLogParetoType2_ffv_961;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_962> AgradCdfLogParetoType2_ffv_962;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_963> AgradCdfLogParetoType2_ffv_963;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_964> AgradCdfLogParetoType2_ffv_964;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_965> AgradCdfLogParetoType2_ffv_965;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_966> AgradCdfLogParetoType2_ffv_966;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_967> AgradCdfLogParetoType2_ffv_967;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_968> AgradCdfLogParetoType2_ffv_968;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_969> AgradCdfLogParetoType2_ffv_969;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_970> AgradCdfLogParetoType2_ffv_970;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_971> AgradCdfLogParetoType2_ffv_971;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_972> AgradCdfLogParetoType2_ffv_972;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_973> AgradCdfLogParetoType2_ffv_973;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_974> AgradCdfLogParetoType2_ffv_974;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_975> AgradCdfLogParetoType2_ffv_975;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_976> AgradCdfLogParetoType2_ffv_976;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_977> AgradCdfLogParetoType2_ffv_977;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_978> AgradCdfLogParetoType2_ffv_978;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_979> AgradCdfLogParetoType2_ffv_979;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_980> AgradCdfLogParetoType2_ffv_980;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_981> AgradCdfLogParetoType2_ffv_981;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_982> AgradCdfLogParetoType2_ffv_982;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_983> AgradCdfLogParetoType2_ffv_983;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_984> AgradCdfLogParetoType2_ffv_984;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_985> AgradCdfLogParetoType2_ffv_985;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_986> AgradCdfLogParetoType2_ffv_986;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_987> AgradCdfLogParetoType2_ffv_987;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_988> AgradCdfLogParetoType2_ffv_988;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_989> AgradCdfLogParetoType2_ffv_989;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_990> AgradCdfLogParetoType2_ffv_990;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_991> AgradCdfLogParetoType2_ffv_991;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_992> AgradCdfLogParetoType2_ffv_992;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_993> AgradCdfLogParetoType2_ffv_993;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_994> AgradCdfLogParetoType2_ffv_994;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_995> AgradCdfLogParetoType2_ffv_995;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_996> AgradCdfLogParetoType2_ffv_996;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_997> AgradCdfLogParetoType2_ffv_997;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_998> AgradCdfLogParetoType2_ffv_998;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_999> AgradCdfLogParetoType2_ffv_999;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_900, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_900);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_901, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_901);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_902, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_902);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_903, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_903);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_904, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_904);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_905, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_905);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_906, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_906);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_907, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_907);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_908, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_908);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_909, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_909);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_910, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_910);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_911, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_911);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_912, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_912);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_913, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_913);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_914, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_914);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_915, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_915);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_916, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_916);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_917, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_917);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_918, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_918);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_919, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_919);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_920, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_920);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_921, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_921);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_922, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_922);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_923, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_923);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_924, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_924);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_925, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_925);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_926, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_926);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_927, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_927);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_928, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_928);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_929, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_929);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_930, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_930);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_931, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_931);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_932, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_932);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_933, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_933);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_934, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_934);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_935, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_935);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_936, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_936);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_937, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_937);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_938, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_938);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_939, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_939);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_940, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_940);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_941, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_941);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_942, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_942);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_943, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_943);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_944, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_944);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_945, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_945);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_946, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_946);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_947, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_947);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_948, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_948);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_949, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_949);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_950, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_950);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_951, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_951);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_952, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_952);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_953, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_953);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_954, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_954);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_955, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_955);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_956, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_956);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_957, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_957);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_958, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_958);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_959, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_959);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_960, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_960);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_961, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_961);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_962, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_962);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_963, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_963);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_964, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_964);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_965, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_965);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_966, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_966);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_967, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_967);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_968, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_968);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_969, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_969);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_970, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_970);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_971, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_971);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_972, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_972);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_973, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_973);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_974, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_974);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_975, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_975);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_976, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_976);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_977, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_977);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_978, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_978);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_979, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_979);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_980, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_980);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_981, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_981);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_982, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_982);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_983, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_983);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_984, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_984);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_985, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_985);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_986, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_986);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_987, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_987);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_988, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_988);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_989, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_989);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_990, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_990);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_991, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_991);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_992, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_992);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_993, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_993);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_994, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_994);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_995, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_995);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_996, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_996);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_997, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_997);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_998, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_998);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_999, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_999);
+
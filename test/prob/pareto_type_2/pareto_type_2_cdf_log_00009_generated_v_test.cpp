@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_cdf_log_test.hpp>
+
+typedef std::tuple<std::vector<var>, std::vector<double>, double, double, empty, empty> type_v_900;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, std::vector<double>, empty, empty> type_v_901;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_902;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, var, empty, empty> type_v_903;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, std::vector<var>, empty, empty> type_v_904;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_905;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, double, empty, empty> type_v_906;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, std::vector<double>, empty, empty> type_v_907;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_908;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, var, empty, empty> type_v_909;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_v_910;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_911;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_912;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_913;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_914;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_915;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_916;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_917;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, double, empty, empty> type_v_918;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, std::vector<double>, empty, empty> type_v_919;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_920;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, var, empty, empty> type_v_921;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, std::vector<var>, empty, empty> type_v_922;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_923;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, double, empty, empty> type_v_924;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_v_925;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_926;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, var, empty, empty> type_v_927;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_v_928;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_929;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_930;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_931;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_932;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_933;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_934;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_935;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_936;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_937;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_938;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_939;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_940;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_941;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_942;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_943;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_944;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_945;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_946;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_947;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_948;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_949;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_950;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_951;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_952;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_953;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_954;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_955;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_956;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_957;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_958;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_959;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_960;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_961;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_962;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_963;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_964;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_965;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_966;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_967;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_968;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_969;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_970;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_971;
+typedef std::tuple<std::vector<var>, var, double, double, empty, empty> type_v_972;
+typedef std::tuple<std::vector<var>, var, double, std::vector<double>, empty, empty> type_v_973;
+typedef std::tuple<std::vector<var>, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_974;
+typedef std::tuple<std::vector<var>, var, double, var, empty, empty> type_v_975;
+typedef std::tuple<std::vector<var>, var, double, std::vector<var>, empty, empty> type_v_976;
+typedef std::tuple<std::vector<var>, var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_977;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, double, empty, empty> type_v_978;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, std::vector<double>, empty, empty> type_v_979;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_980;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, var, empty, empty> type_v_981;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, std::vector<var>, empty, empty> type_v_982;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_983;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_984;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_985;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_986;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_987;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_988;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_989;
+typedef std::tuple<std::vector<var>, var, var, double, empty, empty> type_v_990;
+typedef std::tuple<std::vector<var>, var, var, std::vector<double>, empty, empty> type_v_991;
+typedef std::tuple<std::vector<var>, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_992;
+typedef std::tuple<std::vector<var>, var, var, var, empty, empty> type_v_993;
+typedef std::tuple<std::vector<var>, var, var, std::vector<var>, empty, empty> type_v_994;
+typedef std::tuple<std::vector<var>, var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_995;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, double, empty, empty> type_v_996;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, std::vector<double>, empty, empty> type_v_997;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_998;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, var, empty, empty> type_v_999;
+
+typedef std::tuple<AgradCdfLogParetoType2, type_v_900> AgradCdfLogParetoType2_v_900;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_901> AgradCdfLogParetoType2_v_901;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_902> AgradCdfLogParetoType2_v_902;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_903> AgradCdfLogParetoType2_v_903;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_904> AgradCdfLogParetoType2_v_904;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_905> AgradCdfLogParetoType2_v_905;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_906> AgradCdfLogParetoType2_v_906;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_907> AgradCdfLogParetoType2_v_907;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_908> AgradCdfLogParetoType2_v_908;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_909> AgradCdfLogParetoType2_v_909;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_910> AgradCdfLogParetoType2_v_910;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_911> AgradCdfLogParetoType2_v_911;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_912> AgradCdfLogParetoType2_v_912;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_913> AgradCdfLogParetoType2_v_913;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_914> AgradCdfLogParetoType2_v_914;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_915> AgradCdfLogParetoType2_v_915;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_916> AgradCdfLogParetoType2_v_916;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_917> AgradCdfLogParetoType2_v_917;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_918> AgradCdfLogParetoType2_v_918;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_919> AgradCdfLogParetoType2_v_919;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_920> AgradCdfLogParetoType2_v_920;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_921> AgradCdfLogParetoType2_v_921;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_922> AgradCdfLogParetoType2_v_922;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_923> AgradCdfLogParetoType2_v_923;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_924> AgradCdfLogParetoType2_v_924;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_925> AgradCdfLogParetoType2_v_925;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_926> AgradCdfLogParetoType2_v_926;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_927> AgradCdfLogParetoType2_v_927;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_928> AgradCdfLogParetoType2_v_928;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_929> AgradCdfLogParetoType2_v_929;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_930> AgradCdfLogParetoType2_v_930;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_931> AgradCdfLogParetoType2_v_931;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_932> AgradCdfLogParetoType2_v_932;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_933> AgradCdfLogParetoType2_v_933;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_934> AgradCdfLogParetoType2_v_934;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_935> AgradCdfLogParetoType2_v_935;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_936> AgradCdfLogParetoType2_v_936;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_937> AgradCdfLogParetoType2_v_937;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_938> AgradCdfLogParetoType2_v_938;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_939> AgradCdfLogParetoType2_v_939;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_940> AgradCdfLogParetoType2_v_940;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_941> AgradCdfLogParetoType2_v_941;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_942> AgradCdfLogParetoType2_v_942;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_943> AgradCdfLogParetoType2_v_943;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_944> AgradCdfLogParetoType2_v_944;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_945> AgradCdfLogParetoType2_v_945;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_946> AgradCdfLogParetoType2_v_946;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_947> AgradCdfLogParetoType2_v_947;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_948> AgradCdfLogParetoType2_v_948;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_949> AgradCdfLogParetoType2_v_949;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_950> AgradCdfLogParetoType2_v_950;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_951> AgradCdfLogParetoType2_v_951;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_952> AgradCdfLogParetoType2_v_952;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_953> AgradCdfLogParetoType2_v_953;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_954> AgradCdfLogParetoType2_v_954;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_955> AgradCdfLogParetoType2_v_955;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_956> AgradCdfLogParetoType2_v_956;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_957> AgradCdfLogParetoType2_v_957;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_958> AgradCdfLogParetoType2_v_958;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_959> AgradCdfLogParetoType2_v_959;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_960> AgradCdfLogParetoType2_v_960;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_961> AgradCdfLogParetoType2_v_961;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_962> AgradCdfLogParetoType2_v_962;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_963> AgradCdfLogParetoType2_v_963;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_964> AgradCdfLogParetoType2_v_964;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_965> AgradCdfLogParetoType2_v_965;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_966> AgradCdfLogParetoType2_v_966;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_967> AgradCdfLogParetoType2_v_967;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_968> AgradCdfLogParetoType2_v_968;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_969> AgradCdfLogParetoType2_v_969;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_970> AgradCdfLogParetoType2_v_970;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_971> AgradCdfLogParetoType2_v_971;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_972> AgradCdfLogParetoType2_v_972;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_973> AgradCdfLogParetoType2_v_973;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_974> AgradCdfLogParetoType2_v_974;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_975> AgradCdfLogParetoType2_v_975;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_976> AgradCdfLogParetoType2_v_976;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_977> AgradCdfLogParetoType2_v_977;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_978> AgradCdfLogParetoType2_v_978;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_979> AgradCdfLogParetoType2_v_979;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_980> AgradCdfLogParetoType2_v_980;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_981> AgradCdfLogParetoType2_v_981;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_982> AgradCdfLogParetoType2_v_982;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_983> AgradCdfLogParetoType2_v_983;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_984> AgradCdfLogParetoType2_v_984;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_985> AgradCdfLogParetoType2_v_985;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_986> AgradCdfLogParetoType2_v_986;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_987> AgradCdfLogParetoType2_v_987;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_988> AgradCdfLogParetoType2_v_988;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_989> AgradCdfLogParetoType2_v_989;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_990> AgradCdfLogParetoType2_v_990;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_991> AgradCdfLogParetoType2_v_991;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_992> AgradCdfLogParetoType2_v_992;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_993> AgradCdfLogParetoType2_v_993;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_994> AgradCdfLogParetoType2_v_994;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_995> AgradCdfLogParetoType2_v_995;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_996> AgradCdfLogParetoType2_v_996;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_997> AgradCdfLogParetoType2_v_997;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_998> AgradCdfLogParetoType2_v_998;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_999> AgradCdfLogParetoType2_v_999;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_900, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_900);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_901, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_901);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_902, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_902);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_903, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_903);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_904, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_904);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_905, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_905);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_906, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_906);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_907, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_907);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_908, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_908);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_909, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_909);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_910, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_910);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_911, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_911);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_912, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_912);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_913, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_913);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_914, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_914);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_915, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_915);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_916, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_916);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_917, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_917);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_918, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_918);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_919, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_919);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_920, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_920);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_921, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_921);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_922, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_922);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_923, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_923);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_924, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_924);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_925, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_925);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_926, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_926);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_927, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_927);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_928, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_928);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_929, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_929);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_930, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_930);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_931, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_931);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_932, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_932);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_933, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_933);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_934, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_934);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_935, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_935);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_936, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_936);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_937, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_937);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_938, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_938);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_939, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_939);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_940, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_940);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_941, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_941);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_942, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_942);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_943, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_943);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_944, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_944);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_945, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_945);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_946, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_946);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_947, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_947);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_948, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_948);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_949, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_949);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_950, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_950);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_951, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_951);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_952, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_952);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_953, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_953);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_954, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_954);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_955, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_955);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_956, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_956);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_957, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_957);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_958, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_958);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_959, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_959);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_960, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_960);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_961, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_961);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_962, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_962);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_963, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_963);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_964, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_964);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_965, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_965);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_966, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_966);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_967, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_967);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_968, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_968);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_969, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_969);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_970, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_970);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_971, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_971);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_972, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_972);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_973, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_973);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_974, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_974);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_975, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_975);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_976, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_976);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_977, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_977);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_978, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_978);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_979, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_979);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_980, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_980);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_981, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_981);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_982, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_982);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_983, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_983);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_984, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_984);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_985, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_985);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_986, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_986);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_987, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_987);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_988, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_988);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_989, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_989);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_990, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_990);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_991, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_991);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_992, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_992);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_993, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_993);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_994, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_994);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_995, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_995);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_996, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_996);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_997, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_997);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_998, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_998);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_999, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_999);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_cdf_log_test.hpp>
+
+typedef std::tuple<std::vector<var>, var, std::vector<double>, var, empty, empty> type_vv_900;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, std::vector<var>, empty, empty> type_vv_901;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_902;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_903;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_904;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_905;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_906;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_907;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_908;
+typedef std::tuple<std::vector<var>, var, var, double, empty, empty> type_vv_909;
+typedef std::tuple<std::vector<var>, var, var, std::vector<double>, empty, empty> type_vv_910;
+typedef std::tuple<std::vector<var>, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_911;
+typedef std::tuple<std::vector<var>, var, var, var, empty, empty> type_vv_912;
+typedef std::tuple<std::vector<var>, var, var, std::vector<var>, empty, empty> type_vv_913;
+typedef std::tuple<std::vector<var>, var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_914;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, double, empty, empty> type_vv_915;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, std::vector<double>, empty, empty> type_vv_916;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_917;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, var, empty, empty> type_vv_918;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, std::vector<var>, empty, empty> type_vv_919;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_920;
+typedef std::tuple<std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_921;
+typedef std::tuple<std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_922;
+typedef std::tuple<std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_923;
+typedef std::tuple<std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_924;
+typedef std::tuple<std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_925;
+typedef std::tuple<std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_926;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, double, empty, empty> type_vv_927;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, std::vector<double>, empty, empty> type_vv_928;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_929;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, var, empty, empty> type_vv_930;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, std::vector<var>, empty, empty> type_vv_931;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_932;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, double, empty, empty> type_vv_933;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_vv_934;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_935;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, var, empty, empty> type_vv_936;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_vv_937;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_938;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_939;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_940;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_941;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_942;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_943;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_944;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, double, empty, empty> type_vv_945;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, std::vector<double>, empty, empty> type_vv_946;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_947;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, var, empty, empty> type_vv_948;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, std::vector<var>, empty, empty> type_vv_949;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_950;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, double, empty, empty> type_vv_951;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_vv_952;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_953;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, var, empty, empty> type_vv_954;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_vv_955;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_956;
+typedef std::tuple<std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_957;
+typedef std::tuple<std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_958;
+typedef std::tuple<std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_959;
+typedef std::tuple<std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_960;
+typedef std::tuple<std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_961;
+typedef std::tuple<std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_962;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, empty, empty> type_vv_963;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, empty, empty> type_vv_964;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_965;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, empty, empty> type_vv_966;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, empty, empty> type_vv_967;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_968;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, empty, empty> type_vv_969;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, empty, empty> type_vv_970;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_971;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, empty, empty> type_vv_972;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, empty, empty> type_vv_973;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_974;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_975;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_976;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_977;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_978;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_979;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_980;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, empty, empty> type_vv_981;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, empty, empty> type_vv_982;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_983;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, empty, empty> type_vv_984;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, empty, empty> type_vv_985;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_986;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, empty, empty> type_vv_987;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, empty, empty> type_vv_988;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_989;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, empty, empty> type_vv_990;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, empty, empty> type_vv_991;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_992;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_993;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_994;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_995;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_996;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_997;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_998;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, double, empty, empty> type_vv_999;
+
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_900> AgradCdfLogParetoType2_vv_900;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_901> AgradCdfLogParetoType2_vv_901;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_902> AgradCdfLogParetoType2_vv_902;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_903> AgradCdfLogParetoType2_vv_903;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_904> AgradCdfLogParetoType2_vv_904;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_905> AgradCdfLogParetoType2_vv_905;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_906> AgradCdfLogParetoType2_vv_906;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_907> AgradCdfLogParetoType2_vv_907;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_908> AgradCdfLogParetoType2_vv_908;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_909> AgradCdfLogParetoType2_vv_909;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_910> AgradCdfLogParetoType2_vv_910;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_911> AgradCdfLogParetoType2_vv_911;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_912> AgradCdfLogParetoType2_vv_912;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_913> AgradCdfLogParetoType2_vv_913;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_914> AgradCdfLogParetoType2_vv_914;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_915> AgradCdfLogParetoType2_vv_915;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_916> AgradCdfLogParetoType2_vv_916;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_917> AgradCdfLogParetoType2_vv_917;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_918> AgradCdfLogParetoType2_vv_918;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_919> AgradCdfLogParetoType2_vv_919;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_920> AgradCdfLogParetoType2_vv_920;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_921> AgradCdfLogParetoType2_vv_921;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_922> AgradCdfLogParetoType2_vv_922;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_923> AgradCdfLogParetoType2_vv_923;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_924> AgradCdfLogParetoType2_vv_924;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_925> AgradCdfLogParetoType2_vv_925;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_926> AgradCdfLogParetoType2_vv_926;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_927> AgradCdfLogParetoType2_vv_927;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_928> AgradCdfLogParetoType2_vv_928;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_929> AgradCdfLogParetoType2_vv_929;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_930> AgradCdfLogParetoType2_vv_930;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_931> AgradCdfLogParetoType2_vv_931;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_932> AgradCdfLogParetoType2_vv_932;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_933> AgradCdfLogParetoType2_vv_933;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_934> AgradCdfLogParetoType2_vv_934;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_935> AgradCdfLogParetoType2_vv_935;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_936> AgradCdfLogParetoType2_vv_936;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_937> AgradCdfLogParetoType2_vv_937;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_938> AgradCdfLogParetoType2_vv_938;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_939> AgradCdfLogParetoType2_vv_939;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_940> AgradCdfLogParetoType2_vv_940;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_941> AgradCdfLogParetoType2_vv_941;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_942> AgradCdfLogParetoType2_vv_942;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_943> AgradCdfLogParetoType2_vv_943;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_944> AgradCdfLogParetoType2_vv_944;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_945> AgradCdfLogParetoType2_vv_945;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_946> AgradCdfLogParetoType2_vv_946;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_947> AgradCdfLogParetoType2_vv_947;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_948> AgradCdfLogParetoType2_vv_948;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_949> AgradCdfLogParetoType2_vv_949;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_950> AgradCdfLogParetoType2_vv_950;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_951> AgradCdfLogParetoType2_vv_951;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_952> AgradCdfLogParetoType2_vv_952;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_953> AgradCdfLogParetoType2_vv_953;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_954> AgradCdfLogParetoType2_vv_954;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_955> AgradCdfLogParetoType2_vv_955;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_956> AgradCdfLogParetoType2_vv_956;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_957> AgradCdfLogParetoType2_vv_957;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_958> AgradCdfLogParetoType2_vv_958;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_959> AgradCdfLogParetoType2_vv_959;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_960> AgradCdfLogParetoType2_vv_960;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_961> AgradCdfLogParetoType2_vv_961;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_962> AgradCdfLogParetoType2_vv_962;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_963> AgradCdfLogParetoType2_vv_963;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_964> AgradCdfLogParetoType2_vv_964;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_965> AgradCdfLogParetoType2_vv_965;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_966> AgradCdfLogParetoType2_vv_966;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_967> AgradCdfLogParetoType2_vv_967;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_968> AgradCdfLogParetoType2_vv_968;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_969> AgradCdfLogParetoType2_vv_969;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_970> AgradCdfLogParetoType2_vv_970;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_971> AgradCdfLogParetoType2_vv_971;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_972> AgradCdfLogParetoType2_vv_972;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_973> AgradCdfLogParetoType2_vv_973;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_974> AgradCdfLogParetoType2_vv_974;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_975> AgradCdfLogParetoType2_vv_975;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_976> AgradCdfLogParetoType2_vv_976;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_977> AgradCdfLogParetoType2_vv_977;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_978> AgradCdfLogParetoType2_vv_978;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_979> AgradCdfLogParetoType2_vv_979;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_980> AgradCdfLogParetoType2_vv_980;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_981> AgradCdfLogParetoType2_vv_981;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_982> AgradCdfLogParetoType2_vv_982;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_983> AgradCdfLogParetoType2_vv_983;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_984> AgradCdfLogParetoType2_vv_984;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_985> AgradCdfLogParetoType2_vv_985;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_986> AgradCdfLogParetoType2_vv_986;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_987> AgradCdfLogParetoType2_vv_987;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_988> AgradCdfLogParetoType2_vv_988;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_989> AgradCdfLogParetoType2_vv_989;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_990> AgradCdfLogParetoType2_vv_990;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_991> AgradCdfLogParetoType2_vv_991;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_992> AgradCdfLogParetoType2_vv_992;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_993> AgradCdfLogParetoType2_vv_993;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_994> AgradCdfLogParetoType2_vv_994;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_995> AgradCdfLogParetoType2_vv_995;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_996> AgradCdfLogParetoType2_vv_996;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_997> AgradCdfLogParetoType2_vv_997;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_998> AgradCdfLogParetoType2_vv_998;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_999> AgradCdfLogParetoType2_vv_999;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_900, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_900);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_901, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_901);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_902, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_902);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_903, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_903);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_904, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_904);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_905, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_905);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_906, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_906);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_907, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_907);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_908, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_908);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_909, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_909);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_910, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_910);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_911, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_911);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_912, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_912);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_913, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_913);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_914, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_914);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_915, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_915);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_916, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_916);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_917, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_917);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_918, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_918);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_919, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_919);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_920, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_920);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_921, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_921);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_922, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_922);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_923, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_923);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_924, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_924);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_925, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_925);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_926, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_926);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_927, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_927);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_928, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_928);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_929, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_929);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_930, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_930);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_931, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_931);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_932, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_932);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_933, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_933);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_934, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_934);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_935, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_935);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_936, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_936);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_937, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_937);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_938, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_938);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_939, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_939);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_940, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_940);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_941, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_941);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_942, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_942);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_943, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_943);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_944, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_944);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_945, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_945);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_946, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_946);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_947, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_947);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_948, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_948);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_949, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_949);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_950, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_950);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_951, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_951);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_952, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_952);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_953, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_953);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_954, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_954);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_955, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_955);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_956, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_956);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_957, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_957);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_958, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_958);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_959, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_959);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_960, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_960);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_961, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_961);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_962, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_962);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_963, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_963);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_964, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_964);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_965, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_965);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_966, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_966);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_967, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_967);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_968, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_968);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_969, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_969);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_970, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_970);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_971, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_971);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_972, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_972);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_973, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_973);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_974, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_974);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_975, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_975);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_976, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_976);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_977, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_977);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_978, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_978);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_979, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_979);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_980, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_980);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_981, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_981);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_982, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_982);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_983, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_983);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_984, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_984);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_985, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_985);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_986, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_986);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_987, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_987);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_988, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_988);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_989, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_989);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_990, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_990);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_991, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_991);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_992, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_992);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_993, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_993);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_994, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_994);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_995, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_995);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_996, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_996);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_997, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_997);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_998, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_998);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_999, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_999);
+
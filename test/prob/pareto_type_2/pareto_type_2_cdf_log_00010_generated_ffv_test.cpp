@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_cdf_log_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, std::vector<double>, empty, empty> type_ffv_1000;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1001;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, fvar<fvar<var> >, empty, empty> type_ffv_1002;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1003;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1004;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, double, empty, empty> type_ffv_1005;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, std::vector<double>, empty, empty> type_ffv_1006;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1007;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_1008;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1009;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1010;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_1011;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_1012;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1013;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_1014;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1015;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1016;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, double, empty, empty> type_ffv_1017;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_1018;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1019;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_1020;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1021;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1022;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_1023;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_1024;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1025;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_1026;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1027;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1028;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_1029;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_1030;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1031;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_1032;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1033;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1034;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, double, empty, empty> type_ffv_1035;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, std::vector<double>, empty, empty> type_ffv_1036;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1037;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, fvar<fvar<var> >, empty, empty> type_ffv_1038;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1039;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1040;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, double, empty, empty> type_ffv_1041;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_1042;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1043;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_1044;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1045;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1046;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_1047;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_1048;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1049;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_1050;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1051;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1052;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, double, empty, empty> type_ffv_1053;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_1054;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1055;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_1056;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1057;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1058;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_1059;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_1060;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1061;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_1062;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1063;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1064;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_1065;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_1066;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1067;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_1068;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1069;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1070;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty> type_ffv_1071;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_ffv_1072;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1073;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_1074;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1075;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1076;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_ffv_1077;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_1078;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1079;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_1080;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1081;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1082;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_1083;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_1084;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1085;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_1086;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1087;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1088;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_1089;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_1090;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1091;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_1092;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1093;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1094;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_1095;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_1096;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1097;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_1098;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1099;
+
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_1000> AgradCdfLogParetoType2_ffv_1000;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_1001> AgradCdfLogParetoType2_ffv_1001;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_1002> AgradCdfLogParetoType2_ffv_1002;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_1003> AgradCdfLogParetoType2_ffv_1003;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_1004> AgradCdfLogParetoType2_ffv_1004;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_1005> AgradCdfLogParetoType2_ffv_1005;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_1006> AgradCdfLogParetoType2_ffv_1006;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_1007> AgradCdfLogParetoType2_ffv_1007;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_1008> AgradCdfLogParetoType2_ffv_1008;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_1009> AgradCdfLogParetoType2_ffv_1009;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_1010> AgradCdfLogParetoType2_ffv_1010;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_1011> AgradCdfLogParetoType2_ffv_1011;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_1012> AgradCdfLogParetoType2_ffv_1012;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_1013> AgradCdfLogParetoType2_ffv_1013;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_1014> AgradCdfLogParetoType2_ffv_1014;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_1015> AgradCdfLogParetoType2_ffv_1015;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_1016> AgradCdfLogParetoType2_ffv_1016;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_1017> AgradCdfLogParetoType2_ffv_1017;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_1018> AgradCdfLogParetoType2_ffv_1018;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_1019> AgradCdfLogParetoType2_ffv_1019;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_1020> AgradCdfLogParetoType2_ffv_1020;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_1021> AgradCdfLogParetoType2_ffv_1021;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_1022> AgradCdfLogParetoType2_ffv_1022;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_1023> AgradCdfLogParetoType2_ffv_1023;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_1024> AgradCdfLogParetoType2_ffv_1024;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_1025> AgradCdfLogParetoType2_ffv_1025;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_1026> AgradCdfLogParetoType2_ffv_1026;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_1027> AgradCdfLogParetoType2_ffv_1027;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_1028> AgradCdfLogParetoType2_ffv_1028;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_1029> AgradCdfLogParetoType2_ffv_1029;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_1030> AgradCdfLogParetoType2_ffv_1030;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_1031> AgradCdfLogParetoType2_ffv_1031;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_1032> AgradCdfLogParetoType2_ffv_1032;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_1033> AgradCdfLogParetoType2_ffv_1033;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_1034> AgradCdfLogParetoType2_ffv_1034;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_1035> AgradCdfLogParetoType2_ffv_1035;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_1036> AgradCdfLogParetoType2_ffv_1036;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_1037> AgradCdfLogParetoType2_ffv_1037;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_1038> AgradCdfLogParetoType2_ffv_1038;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_1039> AgradCdfLogParetoType2_ffv_1039;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_1040> AgradCdfLogParetoType2_ffv_1040;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_1041> AgradCdfLogParetoType2_ffv_1041;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_1042> AgradCdfLogParetoType2_ffv_1042;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_1043> AgradCdfLogParetoType2_ffv_1043;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_1044> AgradCdfLogParetoType2_ffv_1044;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_1045> AgradCdfLogParetoType2_ffv_1045;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_1046> AgradCdfLogParetoType2_ffv_1046;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_1047> AgradCdfLogParetoType2_ffv_1047;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_1048> AgradCdfLogParetoType2_ffv_1048;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_1049> AgradCdfLogParetoType2_ffv_1049;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_1050> AgradCdfLogParetoType2_ffv_1050;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_1051> AgradCdfLogParetoType2_ffv_1051;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_1052> AgradCdfLogParetoType2_ffv_1052;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_1053> AgradCdfLogParetoType2_ffv_1053;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_1054> AgradCdfLogParetoType2_ffv_1054;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_1055> AgradCdfLogParetoType2_ffv_1055;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_1056> AgradCdfLogParetoType2_ffv_1056;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_1057> AgradCdfLogParetoType2_ffv_1057;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_1058> AgradCdfLogParetoType2_ffv_1058;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_1059> AgradCdfLogParetoType2_ffv_1059;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_1060> AgradCdfLogParetoType2_ffv_1060;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_1061> AgradCdfLogParetoType2_ffv_1061;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_1062> AgradCdfLogParetoType2_ffv_1062;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_1063> AgradCdfLogParetoType2_ffv_1063;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_1064> AgradCdfLogParetoType2_ffv_1064;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_1065> AgradCdfLogParetoType2_ffv_1065;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_1066> AgradCdfLogParetoType2_ffv_1066;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_1067> AgradCdfLogParetoType2_ffv_1067;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_1068> AgradCdfLogParetoType2_ffv_1068;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_1069> AgradCdfLogParetoType2_ffv_1069;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_1070> AgradCdfLogParetoType2_ffv_1070;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_1071> AgradCdfLogParetoType2_ffv_1071;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_1072> AgradCdfLogParetoType2_ffv_1072;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_1073> AgradCdfLogParetoType2_ffv_1073;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_1074> AgradCdfLogParetoType2_ffv_1074;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_1075> AgradCdfLogParetoType2_ffv_1075;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_1076> AgradCdfLogParetoType2_ffv_1076;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_1077> AgradCdfLogParetoType2_ffv_1077;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_1078> AgradCdfLogParetoType2_ffv_1078;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_1079> AgradCdfLogParetoType2_ffv_1079;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_1080> AgradCdfLogParetoType2_ffv_1080;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_1081> AgradCdfLogParetoType2_ffv_1081;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_1082> AgradCdfLogParetoType2_ffv_1082;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_1083> AgradCdfLogParetoType2_ffv_1083;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_1084> AgradCdfLogParetoType2_ffv_1084;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_1085> AgradCdfLogParetoType2_ffv_1085;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_1086> AgradCdfLogParetoType2_ffv_1086;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_1087> AgradCdfLogParetoType2_ffv_1087;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_1088> AgradCdfLogParetoType2_ffv_1088;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_1089> AgradCdfLogParetoType2_ffv_1089;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_1090> AgradCdfLogParetoType2_ffv_1090;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_1091> AgradCdfLogParetoType2_ffv_1091;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_1092> AgradCdfLogParetoType2_ffv_1092;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_1093> AgradCdfLogParetoType2_ffv_1093;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_1094> AgradCdfLogParetoType2_ffv_1094;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_1095> AgradCdfLogParetoType2_ffv_1095;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_1096> AgradCdfLogParetoType2_ffv_1096;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_1097> AgradCdfLogParetoType2_ffv_1097;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_1098> AgradCdfLogParetoType2_ffv_1098;
+typedef std::tuple<AgradCdfLogParetoType2, type_ffv_1099> AgradCdfLogParetoType2_ffv_1099;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_1000, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_1000);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_1001, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_1001);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_1002, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_1002);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_1003, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_1003);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_1004, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_1004);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_1005, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_1005);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_1006, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_1006);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_1007, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_1007);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_1008, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_1008);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_1009, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_1009);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_1010, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_1010);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_1011, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_1011);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_1012, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_1012);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_1013, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_1013);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_1014, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_1014);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_1015, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_1015);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_1016, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_1016);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_1017, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_1017);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_1018, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_1018);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_1019, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_1019);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_1020, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_1020);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_1021, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_1021);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_1022, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_1022);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_1023, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_1023);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_1024, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_1024);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_1025, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_1025);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_1026, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_1026);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_1027, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_1027);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_1028, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_1028);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_1029, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_1029);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_1030, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_1030);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_1031, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_1031);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_1032, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_1032);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_1033, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_1033);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_1034, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_1034);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_1035, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_1035);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_1036, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_1036);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_1037, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_1037);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_1038, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_1038);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_1039, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_1039);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_1040, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_1040);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_1041, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_1041);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_1042, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_1042);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_1043, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_1043);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_1044, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_1044);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_1045, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_1045);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_1046, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_1046);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_1047, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_1047);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_1048, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_1048);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_1049, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_1049);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_1050, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_1050);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_1051, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_1051);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_1052, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_1052);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_1053, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_1053);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_1054, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_1054);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_1055, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_1055);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_1056, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_1056);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_1057, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_1057);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_1058, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_1058);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_1059, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_1059);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_1060, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_1060);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_1061, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_1061);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_1062, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_1062);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_1063, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_1063);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_1064, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_1064);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_1065, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_1065);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_1066, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_1066);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_1067, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_1067);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_1068, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_1068);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_1069, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_1069);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_1070, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_1070);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_1071, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_1071);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_1072, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_1072);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_1073, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_1073);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_1074, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_1074);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_1075, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_1075);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_1076, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_1076);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_1077, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_1077);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_1078, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_1078);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_1079, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_1079);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_1080, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_1080);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_1081, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_1081);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_1082, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_1082);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_1083, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_1083);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_1084, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_1084);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_1085, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_1085);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_1086, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_1086);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_1087, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_1087);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_1088, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_1088);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_1089, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_1089);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_1090, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_1090);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_1091, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_1091);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_1092, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_1092);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_1093, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_1093);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_1094, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_1094);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_1095, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_1095);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_1096, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_1096);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_1097, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_1097);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_1098, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_1098);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_ffv_1099, AgradCdfLogTestFixture, AgradCdfLogParetoType2_ffv_1099);
+
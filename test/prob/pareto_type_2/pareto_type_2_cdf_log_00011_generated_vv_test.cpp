@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_cdf_log_test.hpp>
+
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_1100;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_1101;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_1102;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_1103;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_1104;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_1105;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_1106;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, double, empty, empty> type_vv_1107;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, std::vector<double>, empty, empty> type_vv_1108;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_1109;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, var, empty, empty> type_vv_1110;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, std::vector<var>, empty, empty> type_vv_1111;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_1112;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, double, empty, empty> type_vv_1113;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, std::vector<double>, empty, empty> type_vv_1114;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_1115;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, var, empty, empty> type_vv_1116;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, std::vector<var>, empty, empty> type_vv_1117;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_1118;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_1119;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_1120;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_1121;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_1122;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_1123;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_1124;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, double, empty, empty> type_vv_1125;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, std::vector<double>, empty, empty> type_vv_1126;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_1127;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, var, empty, empty> type_vv_1128;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, std::vector<var>, empty, empty> type_vv_1129;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_1130;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, double, empty, empty> type_vv_1131;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, std::vector<double>, empty, empty> type_vv_1132;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_1133;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, var, empty, empty> type_vv_1134;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, std::vector<var>, empty, empty> type_vv_1135;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_1136;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_1137;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_1138;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_1139;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_1140;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_1141;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_1142;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, double, empty, empty> type_vv_1143;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, std::vector<double>, empty, empty> type_vv_1144;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_1145;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, var, empty, empty> type_vv_1146;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, std::vector<var>, empty, empty> type_vv_1147;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_1148;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, double, empty, empty> type_vv_1149;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_vv_1150;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_1151;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, var, empty, empty> type_vv_1152;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_vv_1153;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_1154;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_1155;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_1156;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_1157;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_1158;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_1159;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_1160;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, double, empty, empty> type_vv_1161;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, std::vector<double>, empty, empty> type_vv_1162;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_1163;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, var, empty, empty> type_vv_1164;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, std::vector<var>, empty, empty> type_vv_1165;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_1166;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, double, empty, empty> type_vv_1167;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_vv_1168;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_1169;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, var, empty, empty> type_vv_1170;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_vv_1171;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_1172;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_1173;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_1174;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_1175;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_1176;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_1177;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_1178;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, empty, empty> type_vv_1179;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, empty, empty> type_vv_1180;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_1181;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, empty, empty> type_vv_1182;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, empty, empty> type_vv_1183;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_1184;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, empty, empty> type_vv_1185;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, empty, empty> type_vv_1186;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_1187;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, empty, empty> type_vv_1188;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, empty, empty> type_vv_1189;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_1190;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_1191;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_1192;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_1193;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_1194;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_1195;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_1196;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, empty, empty> type_vv_1197;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, empty, empty> type_vv_1198;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_1199;
+
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_1100> AgradCdfLogParetoType2_vv_1100;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_1101> AgradCdfLogParetoType2_vv_1101;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_1102> AgradCdfLogParetoType2_vv_1102;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_1103> AgradCdfLogParetoType2_vv_1103;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_1104> AgradCdfLogParetoType2_vv_1104;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_1105> AgradCdfLogParetoType2_vv_1105;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_1106> AgradCdfLogParetoType2_vv_1106;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_1107> AgradCdfLogParetoType2_vv_1107;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_1108> AgradCdfLogParetoType2_vv_1108;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_1109> AgradCdfLogParetoType2_vv_1109;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_1110> AgradCdfLogParetoType2_vv_1110;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_1111> AgradCdfLogParetoType2_vv_1111;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_1112> AgradCdfLogParetoType2_vv_1112;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_1113> AgradCdfLogParetoType2_vv_1113;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_1114> AgradCdfLogParetoType2_vv_1114;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_1115> AgradCdfLogParetoType2_vv_1115;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_1116> AgradCdfLogParetoType2_vv_1116;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_1117> AgradCdfLogParetoType2_vv_1117;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_1118> AgradCdfLogParetoType2_vv_1118;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_1119> AgradCdfLogParetoType2_vv_1119;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_1120> AgradCdfLogParetoType2_vv_1120;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_1121> AgradCdfLogParetoType2_vv_1121;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_1122> AgradCdfLogParetoType2_vv_1122;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_1123> AgradCdfLogParetoType2_vv_1123;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_1124> AgradCdfLogParetoType2_vv_1124;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_1125> AgradCdfLogParetoType2_vv_1125;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_1126> AgradCdfLogParetoType2_vv_1126;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_1127> AgradCdfLogParetoType2_vv_1127;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_1128> AgradCdfLogParetoType2_vv_1128;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_1129> AgradCdfLogParetoType2_vv_1129;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_1130> AgradCdfLogParetoType2_vv_1130;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_1131> AgradCdfLogParetoType2_vv_1131;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_1132> AgradCdfLogParetoType2_vv_1132;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_1133> AgradCdfLogParetoType2_vv_1133;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_1134> AgradCdfLogParetoType2_vv_1134;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_1135> AgradCdfLogParetoType2_vv_1135;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_1136> AgradCdfLogParetoType2_vv_1136;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_1137> AgradCdfLogParetoType2_vv_1137;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_1138> AgradCdfLogParetoType2_vv_1138;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_1139> AgradCdfLogParetoType2_vv_1139;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_1140> AgradCdfLogParetoType2_vv_1140;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_1141> AgradCdfLogParetoType2_vv_1141;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_1142> AgradCdfLogParetoType2_vv_1142;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_1143> AgradCdfLogParetoType2_vv_1143;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_1144> AgradCdfLogParetoType2_vv_1144;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_1145> AgradCdfLogParetoType2_vv_1145;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_1146> AgradCdfLogParetoType2_vv_1146;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_1147> AgradCdfLogParetoType2_vv_1147;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_1148> AgradCdfLogParetoType2_vv_1148;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_1149> AgradCdfLogParetoType2_vv_1149;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_1150> AgradCdfLogParetoType2_vv_1150;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_1151> AgradCdfLogParetoType2_vv_1151;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_1152> AgradCdfLogParetoType2_vv_1152;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_1153> AgradCdfLogParetoType2_vv_1153;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_1154> AgradCdfLogParetoType2_vv_1154;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_1155> AgradCdfLogParetoType2_vv_1155;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_1156> AgradCdfLogParetoType2_vv_1156;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_1157> AgradCdfLogParetoType2_vv_1157;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_1158> AgradCdfLogParetoType2_vv_1158;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_1159> AgradCdfLogParetoType2_vv_1159;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_1160> AgradCdfLogParetoType2_vv_1160;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_1161> AgradCdfLogParetoType2_vv_1161;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_1162> AgradCdfLogParetoType2_vv_1162;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_1163> AgradCdfLogParetoType2_vv_1163;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_1164> AgradCdfLogParetoType2_vv_1164;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_1165> AgradCdfLogParetoType2_vv_1165;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_1166> AgradCdfLogParetoType2_vv_1166;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_1167> AgradCdfLogParetoType2_vv_1167;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_1168> AgradCdfLogParetoType2_vv_1168;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_1169> AgradCdfLogParetoType2_vv_1169;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_1170> AgradCdfLogParetoType2_vv_1170;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_1171> AgradCdfLogParetoType2_vv_1171;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_1172> AgradCdfLogParetoType2_vv_1172;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_1173> AgradCdfLogParetoType2_vv_1173;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_1174> AgradCdfLogParetoType2_vv_1174;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_1175> AgradCdfLogParetoType2_vv_1175;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_1176> AgradCdfLogParetoType2_vv_1176;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_1177> AgradCdfLogParetoType2_vv_1177;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_1178> AgradCdfLogParetoType2_vv_1178;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_1179> AgradCdfLogParetoType2_vv_1179;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_1180> AgradCdfLogParetoType2_vv_1180;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_1181> AgradCdfLogParetoType2_vv_1181;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_1182> AgradCdfLogParetoType2_vv_1182;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_1183> AgradCdfLogParetoType2_vv_1183;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_1184> AgradCdfLogParetoType2_vv_1184;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_1185> AgradCdfLogParetoType2_vv_1185;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_1186> AgradCdfLogParetoType2_vv_1186;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_1187> AgradCdfLogParetoType2_vv_1187;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_1188> AgradCdfLogParetoType2_vv_1188;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_1189> AgradCdfLogParetoType2_vv_1189;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_1190> AgradCdfLogParetoType2_vv_1190;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_1191> AgradCdfLogParetoType2_vv_1191;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_1192> AgradCdfLogParetoType2_vv_1192;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_1193> AgradCdfLogParetoType2_vv_1193;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_1194> AgradCdfLogParetoType2_vv_1194;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_1195> AgradCdfLogParetoType2_vv_1195;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_1196> AgradCdfLogParetoType2_vv_1196;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_1197> AgradCdfLogParetoType2_vv_1197;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_1198> AgradCdfLogParetoType2_vv_1198;
+typedef std::tuple<AgradCdfLogParetoType2, type_vv_1199> AgradCdfLogParetoType2_vv_1199;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_1100, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_1100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_1101, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_1101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_1102, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_1102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_1103, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_1103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_1104, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_1104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_1105, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_1105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_1106, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_1106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_1107, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_1107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_1108, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_1108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_1109, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_1109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_1110, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_1110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_1111, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_1111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_1112, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_1112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_1113, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_1113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_1114, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_1114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_1115, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_1115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_1116, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_1116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_1117, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_1117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_1118, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_1118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_1119, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_1119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_1120, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_1120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_1121, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_1121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_1122, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_1122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_1123, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_1123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_1124, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_1124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_1125, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_1125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_1126, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_1126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_1127, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_1127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_1128, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_1128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_1129, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_1129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_1130, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_1130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_1131, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_1131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_1132, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_1132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_1133, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_1133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_1134, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_1134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_1135, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_1135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_1136, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_1136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_1137, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_1137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_1138, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_1138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_1139, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_1139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_1140, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_1140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_1141, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_1141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_1142, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_1142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_1143, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_1143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_1144, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_1144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_1145, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_1145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_1146, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_1146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_1147, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_1147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_1148, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_1148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_1149, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_1149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_1150, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_1150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_1151, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_1151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_1152, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_1152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_1153, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_1153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_1154, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_1154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_1155, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_1155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_1156, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_1156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_1157, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_1157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_1158, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_1158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_1159, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_1159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_1160, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_1160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_1161, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_1161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_1162, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_1162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_1163, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_1163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_1164, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_1164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_1165, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_1165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_1166, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_1166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_1167, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_1167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_1168, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_1168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_1169, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_1169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_1170, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_1170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_1171, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_1171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_1172, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_1172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_1173, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_1173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_1174, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_1174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_1175, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_1175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_1176, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_1176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_1177, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_1177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_1178, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_1178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_1179, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_1179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_1180, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_1180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_1181, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_1181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_1182, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_1182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_1183, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_1183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_1184, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_1184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_1185, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_1185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_1186, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_1186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_1187, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_1187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_1188, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_1188);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_1189, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_1189);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_1190, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_1190);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_1191, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_1191);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_1192, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_1192);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_1193, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_1193);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_1194, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_1194);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_1195, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_1195);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_1196, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_1196);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_1197, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_1197);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_1198, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_1198);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_vv_1199, AgradCdfLogTestFixture, AgradCdfLogParetoType2_vv_1199);
+
@@ -0,0 +1,299 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/pareto_type_2/pareto_type_2_cdf_log_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_1200;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_1201;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1202;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_1203;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_1204;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1205;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, double, empty, empty> type_v_1206;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, std::vector<double>, empty, empty> type_v_1207;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1208;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, var, empty, empty> type_v_1209;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, std::vector<var>, empty, empty> type_v_1210;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1211;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, double, empty, empty> type_v_1212;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, std::vector<double>, empty, empty> type_v_1213;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1214;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, var, empty, empty> type_v_1215;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, std::vector<var>, empty, empty> type_v_1216;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1217;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_1218;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_1219;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1220;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_1221;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_1222;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1223;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, double, empty, empty> type_v_1224;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, std::vector<double>, empty, empty> type_v_1225;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1226;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, var, empty, empty> type_v_1227;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, std::vector<var>, empty, empty> type_v_1228;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1229;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, double, empty, empty> type_v_1230;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_v_1231;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1232;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, var, empty, empty> type_v_1233;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_v_1234;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1235;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_1236;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_1237;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1238;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_1239;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_1240;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1241;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, double, empty, empty> type_v_1242;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, std::vector<double>, empty, empty> type_v_1243;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1244;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, var, empty, empty> type_v_1245;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, std::vector<var>, empty, empty> type_v_1246;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1247;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, double, empty, empty> type_v_1248;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_v_1249;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1250;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, var, empty, empty> type_v_1251;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_v_1252;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1253;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_1254;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_1255;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1256;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_1257;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_1258;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1259;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_1260;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_1261;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1262;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_1263;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_1264;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1265;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_1266;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_1267;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1268;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_1269;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_1270;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1271;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_1272;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_1273;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1274;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_1275;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_1276;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1277;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_1278;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_1279;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1280;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_1281;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_1282;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1283;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_1284;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_1285;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1286;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_1287;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_1288;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1289;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_1290;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_1291;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1292;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_1293;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_1294;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1295;
+
+typedef std::tuple<AgradCdfLogParetoType2, type_v_1200> AgradCdfLogParetoType2_v_1200;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_1201> AgradCdfLogParetoType2_v_1201;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_1202> AgradCdfLogParetoType2_v_1202;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_1203> AgradCdfLogParetoType2_v_1203;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_1204> AgradCdfLogParetoType2_v_1204;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_1205> AgradCdfLogParetoType2_v_1205;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_1206> AgradCdfLogParetoType2_v_1206;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_1207> AgradCdfLogParetoType2_v_1207;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_1208> AgradCdfLogParetoType2_v_1208;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_1209> AgradCdfLogParetoType2_v_1209;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_1210> AgradCdfLogParetoType2_v_1210;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_1211> AgradCdfLogParetoType2_v_1211;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_1212> AgradCdfLogParetoType2_v_1212;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_1213> AgradCdfLogParetoType2_v_1213;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_1214> AgradCdfLogParetoType2_v_1214;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_1215> AgradCdfLogParetoType2_v_1215;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_1216> AgradCdfLogParetoType2_v_1216;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_1217> AgradCdfLogParetoType2_v_1217;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_1218> AgradCdfLogParetoType2_v_1218;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_1219> AgradCdfLogParetoType2_v_1219;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_1220> AgradCdfLogParetoType2_v_1220;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_1221> AgradCdfLogParetoType2_v_1221;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_1222> AgradCdfLogParetoType2_v_1222;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_1223> AgradCdfLogParetoType2_v_1223;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_1224> AgradCdfLogParetoType2_v_1224;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_1225> AgradCdfLogParetoType2_v_1225;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_1226> AgradCdfLogParetoType2_v_1226;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_1227> AgradCdfLogParetoType2_v_1227;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_1228> AgradCdfLogParetoType2_v_1228;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_1229> AgradCdfLogParetoType2_v_1229;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_1230> AgradCdfLogParetoType2_v_1230;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_1231> AgradCdfLogParetoType2_v_1231;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_1232> AgradCdfLogParetoType2_v_1232;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_1233> AgradCdfLogParetoType2_v_1233;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_1234> AgradCdfLogParetoType2_v_1234;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_1235> AgradCdfLogParetoType2_v_1235;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_1236> AgradCdfLogParetoType2_v_1236;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_1237> AgradCdfLogParetoType2_v_1237;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_1238> AgradCdfLogParetoType2_v_1238;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_1239> AgradCdfLogParetoType2_v_1239;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_1240> AgradCdfLogParetoType2_v_1240;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_1241> AgradCdfLogParetoType2_v_1241;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_1242> AgradCdfLogParetoType2_v_1242;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_1243> AgradCdfLogParetoType2_v_1243;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_1244> AgradCdfLogParetoType2_v_1244;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_1245> AgradCdfLogParetoType2_v_1245;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_1246> AgradCdfLogParetoType2_v_1246;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_1247> AgradCdfLogParetoType2_v_1247;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_1248> AgradCdfLogParetoType2_v_1248;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_1249> AgradCdfLogParetoType2_v_1249;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_1250> AgradCdfLogParetoType2_v_1250;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_1251> AgradCdfLogParetoType2_v_1251;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_1252> AgradCdfLogParetoType2_v_1252;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_1253> AgradCdfLogParetoType2_v_1253;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_1254> AgradCdfLogParetoType2_v_1254;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_1255> AgradCdfLogParetoType2_v_1255;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_1256> AgradCdfLogParetoType2_v_1256;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_1257> AgradCdfLogParetoType2_v_1257;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_1258> AgradCdfLogParetoType2_v_1258;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_1259> AgradCdfLogParetoType2_v_1259;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_1260> AgradCdfLogParetoType2_v_1260;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_1261> AgradCdfLogParetoType2_v_1261;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_1262> AgradCdfLogParetoType2_v_1262;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_1263> AgradCdfLogParetoType2_v_1263;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_1264> AgradCdfLogParetoType2_v_1264;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_1265> AgradCdfLogParetoType2_v_1265;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_1266> AgradCdfLogParetoType2_v_1266;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_1267> AgradCdfLogParetoType2_v_1267;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_1268> AgradCdfLogParetoType2_v_1268;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_1269> AgradCdfLogParetoType2_v_1269;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_1270> AgradCdfLogParetoType2_v_1270;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_1271> AgradCdfLogParetoType2_v_1271;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_1272> AgradCdfLogParetoType2_v_1272;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_1273> AgradCdfLogParetoType2_v_1273;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_1274> AgradCdfLogParetoType2_v_1274;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_1275> AgradCdfLogParetoType2_v_1275;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_1276> AgradCdfLogParetoType2_v_1276;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_1277> AgradCdfLogParetoType2_v_1277;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_1278> AgradCdfLogParetoType2_v_1278;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_1279> AgradCdfLogParetoType2_v_1279;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_1280> AgradCdfLogParetoType2_v_1280;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_1281> AgradCdfLogParetoType2_v_1281;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_1282> AgradCdfLogParetoType2_v_1282;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_1283> AgradCdfLogParetoType2_v_1283;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_1284> AgradCdfLogParetoType2_v_1284;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_1285> AgradCdfLogParetoType2_v_1285;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_1286> AgradCdfLogParetoType2_v_1286;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_1287> AgradCdfLogParetoType2_v_1287;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_1288> AgradCdfLogParetoType2_v_1288;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_1289> AgradCdfLogParetoType2_v_1289;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_1290> AgradCdfLogParetoType2_v_1290;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_1291> AgradCdfLogParetoType2_v_1291;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_1292> AgradCdfLogParetoType2_v_1292;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_1293> AgradCdfLogParetoType2_v_1293;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_1294> AgradCdfLogParetoType2_v_1294;
+typedef std::tuple<AgradCdfLogParetoType2, type_v_1295> AgradCdfLogParetoType2_v_1295;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_1200, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_1200);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_1201, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_1201);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_1202, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_1202);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_1203, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_1203);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_1204, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_1204);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_1205, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_1205);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_1206, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_1206);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_1207, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_1207);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_1208, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_1208);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_1209, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_1209);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_1210, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_1210);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_1211, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_1211);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_1212, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_1212);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_1213, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_1213);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_1214, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_1214);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_1215, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_1215);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_1216, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_1216);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_1217, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_1217);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_1218, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_1218);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_1219, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_1219);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_1220, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_1220);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_1221, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_1221);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_1222, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_1222);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_1223, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_1223);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_1224, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_1224);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_1225, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_1225);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_1226, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_1226);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_1227, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_1227);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_1228, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_1228);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_1229, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_1229);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_1230, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_1230);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_1231, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_1231);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_1232, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_1232);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_1233, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_1233);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_1234, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_1234);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_1235, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_1235);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_1236, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_1236);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_1237, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_1237);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_1238, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_1238);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_1239, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_1239);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_1240, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_1240);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_1241, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_1241);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_1242, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_1242);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_1243, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_1243);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_1244, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_1244);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_1245, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_1245);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_1246, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_1246);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_1247, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_1247);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_1248, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_1248);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_1249, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_1249);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_1250, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_1250);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_1251, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_1251);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_1252, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_1252);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_1253, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_1253);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_1254, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_1254);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_1255, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_1255);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_1256, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_1256);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_1257, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_1257);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_1258, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_1258);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_1259, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_1259);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_1260, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_1260);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_1261, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_1261);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_1262, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_1262);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_1263, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_1263);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_1264, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_1264);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_1265, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_1265);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_1266, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_1266);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_1267, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_1267);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_1268, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_1268);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_1269, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_1269);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_1270, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_1270);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_1271, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_1271);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_1272, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_1272);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_1273, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_1273);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_1274, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_1274);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_1275, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_1275);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_1276, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_1276);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_1277, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_1277);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_1278, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_1278);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_1279, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_1279);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_1280, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_1280);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_1281, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_1281);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_1282, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_1282);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_1283, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_1283);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_1284, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_1284);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_1285, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_1285);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_1286, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_1286);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_1287, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_1287);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_1288, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_1288);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_1289, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_1289);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_1290, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_1290);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_1291, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_1291);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_1292, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_1292);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_1293, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_1293);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_1294, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_1294);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogParetoType2_v_1295, AgradCdfLogTestFixture, AgradCdfLogParetoType2_v_1295);
+
@@ -0,0 +1,38 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/poisson/poisson_test.hpp>
+
+typedef std::tuple<int, fvar<fvar<var> >, empty, empty, empty, empty> type_ffv_0;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, empty, empty, empty, empty> type_ffv_1;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_ffv_2;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, empty, empty, empty, empty> type_ffv_3;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, empty, empty, empty, empty> type_ffv_4;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_ffv_5;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty, empty> type_ffv_6;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty, empty> type_ffv_7;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_ffv_8;
+
+typedef std::tuple<AgradDistributionsPoisson, type_ffv_0> AgradDistributionsPoisson_ffv_0;
+typedef std::tuple<AgradDistributionsPoisson, type_ffv_1> AgradDistributionsPoisson_ffv_1;
+typedef std::tuple<AgradDistributionsPoisson, type_ffv_2> AgradDistributionsPoisson_ffv_2;
+typedef std::tuple<AgradDistributionsPoisson, type_ffv_3> AgradDistributionsPoisson_ffv_3;
+typedef std::tuple<AgradDistributionsPoisson, type_ffv_4> AgradDistributionsPoisson_ffv_4;
+typedef std::tuple<AgradDistributionsPoisson, type_ffv_5> AgradDistributionsPoisson_ffv_5;
+typedef std::tuple<AgradDistributionsPoisson, type_ffv_6> AgradDistributionsPoisson_ffv_6;
+typedef std::tuple<AgradDistributionsPoisson, type_ffv_7> AgradDistributionsPoisson_ffv_7;
+typedef std::tuple<AgradDistributionsPoisson, type_ffv_8> AgradDistributionsPoisson_ffv_8;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPoisson_ffv_0, AgradDistributionTestFixture, AgradDistributionsPoisson_ffv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPoisson_ffv_1, AgradDistributionTestFixture, AgradDistributionsPoisson_ffv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPoisson_ffv_2, AgradDistributionTestFixture, AgradDistributionsPoisson_ffv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPoisson_ffv_3, AgradDistributionTestFixture, AgradDistributionsPoisson_ffv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPoisson_ffv_4, AgradDistributionTestFixture, AgradDistributionsPoisson_ffv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPoisson_ffv_5, AgradDistributionTestFixture, AgradDistributionsPoisson_ffv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPoisson_ffv_6, AgradDistributionTestFixture, AgradDistributionsPoisson_ffv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPoisson_ffv_7, AgradDistributionTestFixture, AgradDistributionsPoisson_ffv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPoisson_ffv_8, AgradDistributionTestFixture, AgradDistributionsPoisson_ffv_8);
+
@@ -0,0 +1,38 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/poisson/poisson_test.hpp>
+
+typedef std::tuple<int, var, empty, empty, empty, empty> type_vv_0;
+typedef std::tuple<int, std::vector<var>, empty, empty, empty, empty> type_vv_1;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty, empty> type_vv_2;
+typedef std::tuple<std::vector<int>, var, empty, empty, empty, empty> type_vv_3;
+typedef std::tuple<std::vector<int>, std::vector<var>, empty, empty, empty, empty> type_vv_4;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty, empty> type_vv_5;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, empty, empty, empty, empty> type_vv_6;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty, empty> type_vv_7;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty, empty> type_vv_8;
+
+typedef std::tuple<AgradDistributionsPoisson, type_vv_0> AgradDistributionsPoisson_vv_0;
+typedef std::tuple<AgradDistributionsPoisson, type_vv_1> AgradDistributionsPoisson_vv_1;
+typedef std::tuple<AgradDistributionsPoisson, type_vv_2> AgradDistributionsPoisson_vv_2;
+typedef std::tuple<AgradDistributionsPoisson, type_vv_3> AgradDistributionsPoisson_vv_3;
+typedef std::tuple<AgradDistributionsPoisson, type_vv_4> AgradDistributionsPoisson_vv_4;
+typedef std::tuple<AgradDistributionsPoisson, type_vv_5> AgradDistributionsPoisson_vv_5;
+typedef std::tuple<AgradDistributionsPoisson, type_vv_6> AgradDistributionsPoisson_vv_6;
+typedef std::tuple<AgradDistributionsPoisson, type_vv_7> AgradDistributionsPoisson_vv_7;
+typedef std::tuple<AgradDistributionsPoisson, type_vv_8> AgradDistributionsPoisson_vv_8;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPoisson_vv_0, AgradDistributionTestFixture, AgradDistributionsPoisson_vv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPoisson_vv_1, AgradDistributionTestFixture, AgradDistributionsPoisson_vv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPoisson_vv_2, AgradDistributionTestFixture, AgradDistributionsPoisson_vv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPoisson_vv_3, AgradDistributionTestFixture, AgradDistributionsPoisson_vv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPoisson_vv_4, AgradDistributionTestFixture, AgradDistributionsPoisson_vv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPoisson_vv_5, AgradDistributionTestFixture, AgradDistributionsPoisson_vv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPoisson_vv_6, AgradDistributionTestFixture, AgradDistributionsPoisson_vv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPoisson_vv_7, AgradDistributionTestFixture, AgradDistributionsPoisson_vv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsPoisson_vv_8, AgradDistributionTestFixture, AgradDistributionsPoisson_vv_8);
+
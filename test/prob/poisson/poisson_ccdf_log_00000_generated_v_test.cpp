@@ -0,0 +1,65 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/poisson/poisson_ccdf_log_test.hpp>
+
+typedef std::tuple<int, double, empty, empty, empty, empty> type_v_0;
+typedef std::tuple<int, std::vector<double>, empty, empty, empty, empty> type_v_1;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_2;
+typedef std::tuple<int, var, empty, empty, empty, empty> type_v_3;
+typedef std::tuple<int, std::vector<var>, empty, empty, empty, empty> type_v_4;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_5;
+typedef std::tuple<std::vector<int>, double, empty, empty, empty, empty> type_v_6;
+typedef std::tuple<std::vector<int>, std::vector<double>, empty, empty, empty, empty> type_v_7;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_8;
+typedef std::tuple<std::vector<int>, var, empty, empty, empty, empty> type_v_9;
+typedef std::tuple<std::vector<int>, std::vector<var>, empty, empty, empty, empty> type_v_10;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_11;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, empty, empty, empty, empty> type_v_12;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty, empty> type_v_13;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_14;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, empty, empty, empty, empty> type_v_15;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty, empty> type_v_16;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_17;
+
+typedef std::tuple<AgradCcdfLogPoisson, type_v_0> AgradCcdfLogPoisson_v_0;
+typedef std::tuple<AgradCcdfLogPoisson, type_v_1> AgradCcdfLogPoisson_v_1;
+typedef std::tuple<AgradCcdfLogPoisson, type_v_2> AgradCcdfLogPoisson_v_2;
+typedef std::tuple<AgradCcdfLogPoisson, type_v_3> AgradCcdfLogPoisson_v_3;
+typedef std::tuple<AgradCcdfLogPoisson, type_v_4> AgradCcdfLogPoisson_v_4;
+typedef std::tuple<AgradCcdfLogPoisson, type_v_5> AgradCcdfLogPoisson_v_5;
+typedef std::tuple<AgradCcdfLogPoisson, type_v_6> AgradCcdfLogPoisson_v_6;
+typedef std::tuple<AgradCcdfLogPoisson, type_v_7> AgradCcdfLogPoisson_v_7;
+typedef std::tuple<AgradCcdfLogPoisson, type_v_8> AgradCcdfLogPoisson_v_8;
+typedef std::tuple<AgradCcdfLogPoisson, type_v_9> AgradCcdfLogPoisson_v_9;
+typedef std::tuple<AgradCcdfLogPoisson, type_v_10> AgradCcdfLogPoisson_v_10;
+typedef std::tuple<AgradCcdfLogPoisson, type_v_11> AgradCcdfLogPoisson_v_11;
+typedef std::tuple<AgradCcdfLogPoisson, type_v_12> AgradCcdfLogPoisson_v_12;
+typedef std::tuple<AgradCcdfLogPoisson, type_v_13> AgradCcdfLogPoisson_v_13;
+typedef std::tuple<AgradCcdfLogPoisson, type_v_14> AgradCcdfLogPoisson_v_14;
+typedef std::tuple<AgradCcdfLogPoisson, type_v_15> AgradCcdfLogPoisson_v_15;
+typedef std::tuple<AgradCcdfLogPoisson, type_v_16> AgradCcdfLogPoisson_v_16;
+typedef std::tuple<AgradCcdfLogPoisson, type_v_17> AgradCcdfLogPoisson_v_17;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPoisson_v_0, AgradCcdfLogTestFixture, AgradCcdfLogPoisson_v_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPoisson_v_1, AgradCcdfLogTestFixture, AgradCcdfLogPoisson_v_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPoisson_v_2, AgradCcdfLogTestFixture, AgradCcdfLogPoisson_v_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPoisson_v_3, AgradCcdfLogTestFixture, AgradCcdfLogPoisson_v_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPoisson_v_4, AgradCcdfLogTestFixture, AgradCcdfLogPoisson_v_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPoisson_v_5, AgradCcdfLogTestFixture, AgradCcdfLogPoisson_v_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPoisson_v_6, AgradCcdfLogTestFixture, AgradCcdfLogPoisson_v_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPoisson_v_7, AgradCcdfLogTestFixture, AgradCcdfLogPoisson_v_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPoisson_v_8, AgradCcdfLogTestFixture, AgradCcdfLogPoisson_v_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPoisson_v_9, AgradCcdfLogTestFixture, AgradCcdfLogPoisson_v_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPoisson_v_10, AgradCcdfLogTestFixture, AgradCcdfLogPoisson_v_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPoisson_v_11, AgradCcdfLogTestFixture, AgradCcdfLogPoisson_v_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPoisson_v_12, AgradCcdfLogTestFixture, AgradCcdfLogPoisson_v_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPoisson_v_13, AgradCcdfLogTestFixture, AgradCcdfLogPoisson_v_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPoisson_v_14, AgradCcdfLogTestFixture, AgradCcdfLogPoisson_v_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPoisson_v_15, AgradCcdfLogTestFixture, AgradCcdfLogPoisson_v_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPoisson_v_16, AgradCcdfLogTestFixture, AgradCcdfLogPoisson_v_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPoisson_v_17, AgradCcdfLogTestFixture, AgradCcdfLogPoisson_v_17);
+
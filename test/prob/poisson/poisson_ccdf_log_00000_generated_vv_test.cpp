@@ -0,0 +1,38 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/poisson/poisson_ccdf_log_test.hpp>
+
+typedef std::tuple<int, var, empty, empty, empty, empty> type_vv_0;
+typedef std::tuple<int, std::vector<var>, empty, empty, empty, empty> type_vv_1;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty, empty> type_vv_2;
+typedef std::tuple<std::vector<int>, var, empty, empty, empty, empty> type_vv_3;
+typedef std::tuple<std::vector<int>, std::vector<var>, empty, empty, empty, empty> type_vv_4;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty, empty> type_vv_5;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, empty, empty, empty, empty> type_vv_6;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty, empty> type_vv_7;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty, empty> type_vv_8;
+
+typedef std::tuple<AgradCcdfLogPoisson, type_vv_0> AgradCcdfLogPoisson_vv_0;
+typedef std::tuple<AgradCcdfLogPoisson, type_vv_1> AgradCcdfLogPoisson_vv_1;
+typedef std::tuple<AgradCcdfLogPoisson, type_vv_2> AgradCcdfLogPoisson_vv_2;
+typedef std::tuple<AgradCcdfLogPoisson, type_vv_3> AgradCcdfLogPoisson_vv_3;
+typedef std::tuple<AgradCcdfLogPoisson, type_vv_4> AgradCcdfLogPoisson_vv_4;
+typedef std::tuple<AgradCcdfLogPoisson, type_vv_5> AgradCcdfLogPoisson_vv_5;
+typedef std::tuple<AgradCcdfLogPoisson, type_vv_6> AgradCcdfLogPoisson_vv_6;
+typedef std::tuple<AgradCcdfLogPoisson, type_vv_7> AgradCcdfLogPoisson_vv_7;
+typedef std::tuple<AgradCcdfLogPoisson, type_vv_8> AgradCcdfLogPoisson_vv_8;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPoisson_vv_0, AgradCcdfLogTestFixture, AgradCcdfLogPoisson_vv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPoisson_vv_1, AgradCcdfLogTestFixture, AgradCcdfLogPoisson_vv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPoisson_vv_2, AgradCcdfLogTestFixture, AgradCcdfLogPoisson_vv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPoisson_vv_3, AgradCcdfLogTestFixture, AgradCcdfLogPoisson_vv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPoisson_vv_4, AgradCcdfLogTestFixture, AgradCcdfLogPoisson_vv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPoisson_vv_5, AgradCcdfLogTestFixture, AgradCcdfLogPoisson_vv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPoisson_vv_6, AgradCcdfLogTestFixture, AgradCcdfLogPoisson_vv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPoisson_vv_7, AgradCcdfLogTestFixture, AgradCcdfLogPoisson_vv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogPoisson_vv_8, AgradCcdfLogTestFixture, AgradCcdfLogPoisson_vv_8);
+
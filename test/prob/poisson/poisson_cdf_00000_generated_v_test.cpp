@@ -0,0 +1,65 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/poisson/poisson_cdf_test.hpp>
+
+typedef std::tuple<int, double, empty, empty, empty, empty> type_v_0;
+typedef std::tuple<int, std::vector<double>, empty, empty, empty, empty> type_v_1;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_2;
+typedef std::tuple<int, var, empty, empty, empty, empty> type_v_3;
+typedef std::tuple<int, std::vector<var>, empty, empty, empty, empty> type_v_4;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_5;
+typedef std::tuple<std::vector<int>, double, empty, empty, empty, empty> type_v_6;
+typedef std::tuple<std::vector<int>, std::vector<double>, empty, empty, empty, empty> type_v_7;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_8;
+typedef std::tuple<std::vector<int>, var, empty, empty, empty, empty> type_v_9;
+typedef std::tuple<std::vector<int>, std::vector<var>, empty, empty, empty, empty> type_v_10;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_11;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, empty, empty, empty, empty> type_v_12;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty, empty> type_v_13;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_14;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, empty, empty, empty, empty> type_v_15;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty, empty> type_v_16;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_17;
+
+typedef std::tuple<AgradCdfPoisson, type_v_0> AgradCdfPoisson_v_0;
+typedef std::tuple<AgradCdfPoisson, type_v_1> AgradCdfPoisson_v_1;
+typedef std::tuple<AgradCdfPoisson, type_v_2> AgradCdfPoisson_v_2;
+typedef std::tuple<AgradCdfPoisson, type_v_3> AgradCdfPoisson_v_3;
+typedef std::tuple<AgradCdfPoisson, type_v_4> AgradCdfPoisson_v_4;
+typedef std::tuple<AgradCdfPoisson, type_v_5> AgradCdfPoisson_v_5;
+typedef std::tuple<AgradCdfPoisson, type_v_6> AgradCdfPoisson_v_6;
+typedef std::tuple<AgradCdfPoisson, type_v_7> AgradCdfPoisson_v_7;
+typedef std::tuple<AgradCdfPoisson, type_v_8> AgradCdfPoisson_v_8;
+typedef std::tuple<AgradCdfPoisson, type_v_9> AgradCdfPoisson_v_9;
+typedef std::tuple<AgradCdfPoisson, type_v_10> AgradCdfPoisson_v_10;
+typedef std::tuple<AgradCdfPoisson, type_v_11> AgradCdfPoisson_v_11;
+typedef std::tuple<AgradCdfPoisson, type_v_12> AgradCdfPoisson_v_12;
+typedef std::tuple<AgradCdfPoisson, type_v_13> AgradCdfPoisson_v_13;
+typedef std::tuple<AgradCdfPoisson, type_v_14> AgradCdfPoisson_v_14;
+typedef std::tuple<AgradCdfPoisson, type_v_15> AgradCdfPoisson_v_15;
+typedef std::tuple<AgradCdfPoisson, type_v_16> AgradCdfPoisson_v_16;
+typedef std::tuple<AgradCdfPoisson, type_v_17> AgradCdfPoisson_v_17;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPoisson_v_0, AgradCdfTestFixture, AgradCdfPoisson_v_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPoisson_v_1, AgradCdfTestFixture, AgradCdfPoisson_v_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPoisson_v_2, AgradCdfTestFixture, AgradCdfPoisson_v_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPoisson_v_3, AgradCdfTestFixture, AgradCdfPoisson_v_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPoisson_v_4, AgradCdfTestFixture, AgradCdfPoisson_v_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPoisson_v_5, AgradCdfTestFixture, AgradCdfPoisson_v_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPoisson_v_6, AgradCdfTestFixture, AgradCdfPoisson_v_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPoisson_v_7, AgradCdfTestFixture, AgradCdfPoisson_v_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPoisson_v_8, AgradCdfTestFixture, AgradCdfPoisson_v_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPoisson_v_9, AgradCdfTestFixture, AgradCdfPoisson_v_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPoisson_v_10, AgradCdfTestFixture, AgradCdfPoisson_v_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPoisson_v_11, AgradCdfTestFixture, AgradCdfPoisson_v_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPoisson_v_12, AgradCdfTestFixture, AgradCdfPoisson_v_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPoisson_v_13, AgradCdfTestFixture, AgradCdfPoisson_v_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPoisson_v_14, AgradCdfTestFixture, AgradCdfPoisson_v_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPoisson_v_15, AgradCdfTestFixture, AgradCdfPoisson_v_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPoisson_v_16, AgradCdfTestFixture, AgradCdfPoisson_v_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfPoisson_v_17, AgradCdfTestFixture, AgradCdfPoisson_v_17);
+
@@ -0,0 +1,38 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/poisson/poisson_cdf_log_test.hpp>
+
+typedef std::tuple<int, fvar<fvar<var> >, empty, empty, empty, empty> type_ffv_0;
+typedef std::tuple<int, std::vector<fvar<fvar<var> >>, empty, empty, empty, empty> type_ffv_1;
+typedef std::tuple<int, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_ffv_2;
+typedef std::tuple<std::vector<int>, fvar<fvar<var> >, empty, empty, empty, empty> type_ffv_3;
+typedef std::tuple<std::vector<int>, std::vector<fvar<fvar<var> >>, empty, empty, empty, empty> type_ffv_4;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_ffv_5;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty, empty> type_ffv_6;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty, empty> type_ffv_7;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_ffv_8;
+
+typedef std::tuple<AgradCdfLogPoisson, type_ffv_0> AgradCdfLogPoisson_ffv_0;
+typedef std::tuple<AgradCdfLogPoisson, type_ffv_1> AgradCdfLogPoisson_ffv_1;
+typedef std::tuple<AgradCdfLogPoisson, type_ffv_2> AgradCdfLogPoisson_ffv_2;
+typedef std::tuple<AgradCdfLogPoisson, type_ffv_3> AgradCdfLogPoisson_ffv_3;
+typedef std::tuple<AgradCdfLogPoisson, type_ffv_4> AgradCdfLogPoisson_ffv_4;
+typedef std::tuple<AgradCdfLogPoisson, type_ffv_5> AgradCdfLogPoisson_ffv_5;
+typedef std::tuple<AgradCdfLogPoisson, type_ffv_6> AgradCdfLogPoisson_ffv_6;
+typedef std::tuple<AgradCdfLogPoisson, type_ffv_7> AgradCdfLogPoisson_ffv_7;
+typedef std::tuple<AgradCdfLogPoisson, type_ffv_8> AgradCdfLogPoisson_ffv_8;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPoisson_ffv_0, AgradCdfLogTestFixture, AgradCdfLogPoisson_ffv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPoisson_ffv_1, AgradCdfLogTestFixture, AgradCdfLogPoisson_ffv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPoisson_ffv_2, AgradCdfLogTestFixture, AgradCdfLogPoisson_ffv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPoisson_ffv_3, AgradCdfLogTestFixture, AgradCdfLogPoisson_ffv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPoisson_ffv_4, AgradCdfLogTestFixture, AgradCdfLogPoisson_ffv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPoisson_ffv_5, AgradCdfLogTestFixture, AgradCdfLogPoisson_ffv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPoisson_ffv_6, AgradCdfLogTestFixture, AgradCdfLogPoisson_ffv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPoisson_ffv_7, AgradCdfLogTestFixture, AgradCdfLogPoisson_ffv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPoisson_ffv_8, AgradCdfLogTestFixture, AgradCdfLogPoisson_ffv_8);
+
@@ -0,0 +1,65 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/poisson/poisson_cdf_log_test.hpp>
+
+typedef std::tuple<int, double, empty, empty, empty, empty> type_v_0;
+typedef std::tuple<int, std::vector<double>, empty, empty, empty, empty> type_v_1;
+typedef std::tuple<int, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_2;
+typedef std::tuple<int, var, empty, empty, empty, empty> type_v_3;
+typedef std::tuple<int, std::vector<var>, empty, empty, empty, empty> type_v_4;
+typedef std::tuple<int, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_5;
+typedef std::tuple<std::vector<int>, double, empty, empty, empty, empty> type_v_6;
+typedef std::tuple<std::vector<int>, std::vector<double>, empty, empty, empty, empty> type_v_7;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_8;
+typedef std::tuple<std::vector<int>, var, empty, empty, empty, empty> type_v_9;
+typedef std::tuple<std::vector<int>, std::vector<var>, empty, empty, empty, empty> type_v_10;
+typedef std::tuple<std::vector<int>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_11;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, double, empty, empty, empty, empty> type_v_12;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty, empty> type_v_13;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_14;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, empty, empty, empty, empty> type_v_15;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty, empty> type_v_16;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_17;
+
+typedef std::tuple<AgradCdfLogPoisson, type_v_0> AgradCdfLogPoisson_v_0;
+typedef std::tuple<AgradCdfLogPoisson, type_v_1> AgradCdfLogPoisson_v_1;
+typedef std::tuple<AgradCdfLogPoisson, type_v_2> AgradCdfLogPoisson_v_2;
+typedef std::tuple<AgradCdfLogPoisson, type_v_3> AgradCdfLogPoisson_v_3;
+typedef std::tuple<AgradCdfLogPoisson, type_v_4> AgradCdfLogPoisson_v_4;
+typedef std::tuple<AgradCdfLogPoisson, type_v_5> AgradCdfLogPoisson_v_5;
+typedef std::tuple<AgradCdfLogPoisson, type_v_6> AgradCdfLogPoisson_v_6;
+typedef std::tuple<AgradCdfLogPoisson, type_v_7> AgradCdfLogPoisson_v_7;
+typedef std::tuple<AgradCdfLogPoisson, type_v_8> AgradCdfLogPoisson_v_8;
+typedef std::tuple<AgradCdfLogPoisson, type_v_9> AgradCdfLogPoisson_v_9;
+typedef std::tuple<AgradCdfLogPoisson, type_v_10> AgradCdfLogPoisson_v_10;
+typedef std::tuple<AgradCdfLogPoisson, type_v_11> AgradCdfLogPoisson_v_11;
+typedef std::tuple<AgradCdfLogPoisson, type_v_12> AgradCdfLogPoisson_v_12;
+typedef std::tuple<AgradCdfLogPoisson, type_v_13> AgradCdfLogPoisson_v_13;
+typedef std::tuple<AgradCdfLogPoisson, type_v_14> AgradCdfLogPoisson_v_14;
+typedef std::tuple<AgradCdfLogPoisson, type_v_15> AgradCdfLogPoisson_v_15;
+typedef std::tuple<AgradCdfLogPoisson, type_v_16> AgradCdfLogPoisson_v_16;
+typedef std::tuple<AgradCdfLogPoisson, type_v_17> AgradCdfLogPoisson_v_17;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPoisson_v_0, AgradCdfLogTestFixture, AgradCdfLogPoisson_v_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPoisson_v_1, AgradCdfLogTestFixture, AgradCdfLogPoisson_v_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPoisson_v_2, AgradCdfLogTestFixture, AgradCdfLogPoisson_v_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPoisson_v_3, AgradCdfLogTestFixture, AgradCdfLogPoisson_v_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPoisson_v_4, AgradCdfLogTestFixture, AgradCdfLogPoisson_v_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPoisson_v_5, AgradCdfLogTestFixture, AgradCdfLogPoisson_v_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPoisson_v_6, AgradCdfLogTestFixture, AgradCdfLogPoisson_v_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPoisson_v_7, AgradCdfLogTestFixture, AgradCdfLogPoisson_v_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPoisson_v_8, AgradCdfLogTestFixture, AgradCdfLogPoisson_v_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPoisson_v_9, AgradCdfLogTestFixture, AgradCdfLogPoisson_v_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPoisson_v_10, AgradCdfLogTestFixture, AgradCdfLogPoisson_v_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPoisson_v_11, AgradCdfLogTestFixture, AgradCdfLogPoisson_v_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPoisson_v_12, AgradCdfLogTestFixture, AgradCdfLogPoisson_v_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPoisson_v_13, AgradCdfLogTestFixture, AgradCdfLogPoisson_v_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPoisson_v_14, AgradCdfLogTestFixture, AgradCdfLogPoisson_v_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPoisson_v_15, AgradCdfLogTestFixture, AgradCdfLogPoisson_v_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPoisson_v_16, AgradCdfLogTestFixture, AgradCdfLogPoisson_v_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPoisson_v_17, AgradCdfLogTestFixture, AgradCdfLogPoisson_v_17);
+
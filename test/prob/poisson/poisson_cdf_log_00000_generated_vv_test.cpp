@@ -0,0 +1,38 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/poisson/poisson_cdf_log_test.hpp>
+
+typedef std::tuple<int, var, empty, empty, empty, empty> type_vv_0;
+typedef std::tuple<int, std::vector<var>, empty, empty, empty, empty> type_vv_1;
+typedef std::tuple<int, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty, empty> type_vv_2;
+typedef std::tuple<std::vector<int>, var, empty, empty, empty, empty> type_vv_3;
+typedef std::tuple<std::vector<int>, std::vector<var>, empty, empty, empty, empty> type_vv_4;
+typedef std::tuple<std::vector<int>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty, empty> type_vv_5;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, var, empty, empty, empty, empty> type_vv_6;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty, empty> type_vv_7;
+typedef std::tuple<Eigen::Matrix<int, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty, empty> type_vv_8;
+
+typedef std::tuple<AgradCdfLogPoisson, type_vv_0> AgradCdfLogPoisson_vv_0;
+typedef std::tuple<AgradCdfLogPoisson, type_vv_1> AgradCdfLogPoisson_vv_1;
+typedef std::tuple<AgradCdfLogPoisson, type_vv_2> AgradCdfLogPoisson_vv_2;
+typedef std::tuple<AgradCdfLogPoisson, type_vv_3> AgradCdfLogPoisson_vv_3;
+typedef std::tuple<AgradCdfLogPoisson, type_vv_4> AgradCdfLogPoisson_vv_4;
+typedef std::tuple<AgradCdfLogPoisson, type_vv_5> AgradCdfLogPoisson_vv_5;
+typedef std::tuple<AgradCdfLogPoisson, type_vv_6> AgradCdfLogPoisson_vv_6;
+typedef std::tuple<AgradCdfLogPoisson, type_vv_7> AgradCdfLogPoisson_vv_7;
+typedef std::tuple<AgradCdfLogPoisson, type_vv_8> AgradCdfLogPoisson_vv_8;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPoisson_vv_0, AgradCdfLogTestFixture, AgradCdfLogPoisson_vv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPoisson_vv_1, AgradCdfLogTestFixture, AgradCdfLogPoisson_vv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPoisson_vv_2, AgradCdfLogTestFixture, AgradCdfLogPoisson_vv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPoisson_vv_3, AgradCdfLogTestFixture, AgradCdfLogPoisson_vv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPoisson_vv_4, AgradCdfLogTestFixture, AgradCdfLogPoisson_vv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPoisson_vv_5, AgradCdfLogTestFixture, AgradCdfLogPoisson_vv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPoisson_vv_6, AgradCdfLogTestFixture, AgradCdfLogPoisson_vv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPoisson_vv_7, AgradCdfLogTestFixture, AgradCdfLogPoisson_vv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogPoisson_vv_8, AgradCdfLogTestFixture, AgradCdfLogPoisson_vv_8);
+
@@ -0,0 +1,119 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/rayleigh/rayleigh_test.hpp>
+
+typedef std::tuple<double, double, empty, empty, empty, empty> type_v_0;
+typedef std::tuple<double, std::vector<double>, empty, empty, empty, empty> type_v_1;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_2;
+typedef std::tuple<double, var, empty, empty, empty, empty> type_v_3;
+typedef std::tuple<double, std::vector<var>, empty, empty, empty, empty> type_v_4;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_5;
+typedef std::tuple<std::vector<double>, double, empty, empty, empty, empty> type_v_6;
+typedef std::tuple<std::vector<double>, std::vector<double>, empty, empty, empty, empty> type_v_7;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_8;
+typedef std::tuple<std::vector<double>, var, empty, empty, empty, empty> type_v_9;
+typedef std::tuple<std::vector<double>, std::vector<var>, empty, empty, empty, empty> type_v_10;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_11;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty, empty> type_v_12;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty, empty> type_v_13;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_14;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty, empty> type_v_15;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty, empty> type_v_16;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_17;
+typedef std::tuple<var, double, empty, empty, empty, empty> type_v_18;
+typedef std::tuple<var, std::vector<double>, empty, empty, empty, empty> type_v_19;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_20;
+typedef std::tuple<var, var, empty, empty, empty, empty> type_v_21;
+typedef std::tuple<var, std::vector<var>, empty, empty, empty, empty> type_v_22;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_23;
+typedef std::tuple<std::vector<var>, double, empty, empty, empty, empty> type_v_24;
+typedef std::tuple<std::vector<var>, std::vector<double>, empty, empty, empty, empty> type_v_25;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_26;
+typedef std::tuple<std::vector<var>, var, empty, empty, empty, empty> type_v_27;
+typedef std::tuple<std::vector<var>, std::vector<var>, empty, empty, empty, empty> type_v_28;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_29;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty, empty> type_v_30;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty, empty> type_v_31;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_32;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty, empty> type_v_33;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty, empty> type_v_34;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_35;
+
+typedef std::tuple<AgradDistributionRayleigh, type_v_0> AgradDistributionRayleigh_v_0;
+typedef std::tuple<AgradDistributionRayleigh, type_v_1> AgradDistributionRayleigh_v_1;
+typedef std::tuple<AgradDistributionRayleigh, type_v_2> AgradDistributionRayleigh_v_2;
+typedef std::tuple<AgradDistributionRayleigh, type_v_3> AgradDistributionRayleigh_v_3;
+typedef std::tuple<AgradDistributionRayleigh, type_v_4> AgradDistributionRayleigh_v_4;
+typedef std::tuple<AgradDistributionRayleigh, type_v_5> AgradDistributionRayleigh_v_5;
+typedef std::tuple<AgradDistributionRayleigh, type_v_6> AgradDistributionRayleigh_v_6;
+typedef std::tuple<AgradDistributionRayleigh, type_v_7> AgradDistributionRayleigh_v_7;
+typedef std::tuple<AgradDistributionRayleigh, type_v_8> AgradDistributionRayleigh_v_8;
+typedef std::tuple<AgradDistributionRayleigh, type_v_9> AgradDistributionRayleigh_v_9;
+typedef std::tuple<AgradDistributionRayleigh, type_v_10> AgradDistributionRayleigh_v_10;
+typedef std::tuple<AgradDistributionRayleigh, type_v_11> AgradDistributionRayleigh_v_11;
+typedef std::tuple<AgradDistributionRayleigh, type_v_12> AgradDistributionRayleigh_v_12;
+typedef std::tuple<AgradDistributionRayleigh, type_v_13> AgradDistributionRayleigh_v_13;
+typedef std::tuple<AgradDistributionRayleigh, type_v_14> AgradDistributionRayleigh_v_14;
+typedef std::tuple<AgradDistributionRayleigh, type_v_15> AgradDistributionRayleigh_v_15;
+typedef std::tuple<AgradDistributionRayleigh, type_v_16> AgradDistributionRayleigh_v_16;
+typedef std::tuple<AgradDistributionRayleigh, type_v_17> AgradDistributionRayleigh_v_17;
+typedef std::tuple<AgradDistributionRayleigh, type_v_18> AgradDistributionRayleigh_v_18;
+typedef std::tuple<AgradDistributionRayleigh, type_v_19> AgradDistributionRayleigh_v_19;
+typedef std::tuple<AgradDistributionRayleigh, type_v_20> AgradDistributionRayleigh_v_20;
+typedef std::tuple<AgradDistributionRayleigh, type_v_21> AgradDistributionRayleigh_v_21;
+typedef std::tuple<AgradDistributionRayleigh, type_v_22> AgradDistributionRayleigh_v_22;
+typedef std::tuple<AgradDistributionRayleigh, type_v_23> AgradDistributionRayleigh_v_23;
+typedef std::tuple<AgradDistributionRayleigh, type_v_24> AgradDistributionRayleigh_v_24;
+typedef std::tuple<AgradDistributionRayleigh, type_v_25> AgradDistributionRayleigh_v_25;
+typedef std::tuple<AgradDistributionRayleigh, type_v_26> AgradDistributionRayleigh_v_26;
+typedef std::tuple<AgradDistributionRayleigh, type_v_27> AgradDistributionRayleigh_v_27;
+typedef std::tuple<AgradDistributionRayleigh, type_v_28> AgradDistributionRayleigh_v_28;
+typedef std::tuple<AgradDistributionRayleigh, type_v_29> AgradDistributionRayleigh_v_29;
+typedef std::tuple<AgradDistributionRayleigh, type_v_30> AgradDistributionRayleigh_v_30;
+typedef std::tuple<AgradDistributionRayleigh, type_v_31> AgradDistributionRayleigh_v_31;
+typedef std::tuple<AgradDistributionRayleigh, type_v_32> AgradDistributionRayleigh_v_32;
+typedef std::tuple<AgradDistributionRayleigh, type_v_33> AgradDistributionRayleigh_v_33;
+typedef std::tuple<AgradDistributionRayleigh, type_v_34> AgradDistributionRayleigh_v_34;
+typedef std::tuple<AgradDistributionRayleigh, type_v_35> AgradDistributionRayleigh_v_35;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionRayleigh_v_0, AgradDistributionTestFixture, AgradDistributionRayleigh_v_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionRayleigh_v_1, AgradDistributionTestFixture, AgradDistributionRayleigh_v_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionRayleigh_v_2, AgradDistributionTestFixture, AgradDistributionRayleigh_v_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionRayleigh_v_3, AgradDistributionTestFixture, AgradDistributionRayleigh_v_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionRayleigh_v_4, AgradDistributionTestFixture, AgradDistributionRayleigh_v_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionRayleigh_v_5, AgradDistributionTestFixture, AgradDistributionRayleigh_v_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionRayleigh_v_6, AgradDistributionTestFixture, AgradDistributionRayleigh_v_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionRayleigh_v_7, AgradDistributionTestFixture, AgradDistributionRayleigh_v_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionRayleigh_v_8, AgradDistributionTestFixture, AgradDistributionRayleigh_v_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionRayleigh_v_9, AgradDistributionTestFixture, AgradDistributionRayleigh_v_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionRayleigh_v_10, AgradDistributionTestFixture, AgradDistributionRayleigh_v_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionRayleigh_v_11, AgradDistributionTestFixture, AgradDistributionRayleigh_v_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionRayleigh_v_12, AgradDistributionTestFixture, AgradDistributionRayleigh_v_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionRayleigh_v_13, AgradDistributionTestFixture, AgradDistributionRayleigh_v_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionRayleigh_v_14, AgradDistributionTestFixture, AgradDistributionRayleigh_v_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionRayleigh_v_15, AgradDistributionTestFixture, AgradDistributionRayleigh_v_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionRayleigh_v_16, AgradDistributionTestFixture, AgradDistributionRayleigh_v_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionRayleigh_v_17, AgradDistributionTestFixture, AgradDistributionRayleigh_v_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionRayleigh_v_18, AgradDistributionTestFixture, AgradDistributionRayleigh_v_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionRayleigh_v_19, AgradDistributionTestFixture, AgradDistributionRayleigh_v_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionRayleigh_v_20, AgradDistributionTestFixture, AgradDistributionRayleigh_v_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionRayleigh_v_21, AgradDistributionTestFixture, AgradDistributionRayleigh_v_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionRayleigh_v_22, AgradDistributionTestFixture, AgradDistributionRayleigh_v_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionRayleigh_v_23, AgradDistributionTestFixture, AgradDistributionRayleigh_v_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionRayleigh_v_24, AgradDistributionTestFixture, AgradDistributionRayleigh_v_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionRayleigh_v_25, AgradDistributionTestFixture, AgradDistributionRayleigh_v_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionRayleigh_v_26, AgradDistributionTestFixture, AgradDistributionRayleigh_v_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionRayleigh_v_27, AgradDistributionTestFixture, AgradDistributionRayleigh_v_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionRayleigh_v_28, AgradDistributionTestFixture, AgradDistributionRayleigh_v_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionRayleigh_v_29, AgradDistributionTestFixture, AgradDistributionRayleigh_v_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionRayleigh_v_30, AgradDistributionTestFixture, AgradDistributionRayleigh_v_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionRayleigh_v_31, AgradDistributionTestFixture, AgradDistributionRayleigh_v_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionRayleigh_v_32, AgradDistributionTestFixture, AgradDistributionRayleigh_v_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionRayleigh_v_33, AgradDistributionTestFixture, AgradDistributionRayleigh_v_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionRayleigh_v_34, AgradDistributionTestFixture, AgradDistributionRayleigh_v_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionRayleigh_v_35, AgradDistributionTestFixture, AgradDistributionRayleigh_v_35);
+
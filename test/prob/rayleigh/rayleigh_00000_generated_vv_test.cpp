@@ -0,0 +1,92 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/rayleigh/rayleigh_test.hpp>
+
+typedef std::tuple<double, var, empty, empty, empty, empty> type_vv_0;
+typedef std::tuple<double, std::vector<var>, empty, empty, empty, empty> type_vv_1;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty, empty> type_vv_2;
+typedef std::tuple<std::vector<double>, var, empty, empty, empty, empty> type_vv_3;
+typedef std::tuple<std::vector<double>, std::vector<var>, empty, empty, empty, empty> type_vv_4;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty, empty> type_vv_5;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty, empty> type_vv_6;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty, empty> type_vv_7;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty, empty> type_vv_8;
+typedef std::tuple<var, double, empty, empty, empty, empty> type_vv_9;
+typedef std::tuple<var, std::vector<double>, empty, empty, empty, empty> type_vv_10;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_vv_11;
+typedef std::tuple<var, var, empty, empty, empty, empty> type_vv_12;
+typedef std::tuple<var, std::vector<var>, empty, empty, empty, empty> type_vv_13;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty, empty> type_vv_14;
+typedef std::tuple<std::vector<var>, double, empty, empty, empty, empty> type_vv_15;
+typedef std::tuple<std::vector<var>, std::vector<double>, empty, empty, empty, empty> type_vv_16;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_vv_17;
+typedef std::tuple<std::vector<var>, var, empty, empty, empty, empty> type_vv_18;
+typedef std::tuple<std::vector<var>, std::vector<var>, empty, empty, empty, empty> type_vv_19;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty, empty> type_vv_20;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty, empty> type_vv_21;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty, empty> type_vv_22;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_vv_23;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty, empty> type_vv_24;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty, empty> type_vv_25;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty, empty> type_vv_26;
+
+typedef std::tuple<AgradDistributionRayleigh, type_vv_0> AgradDistributionRayleigh_vv_0;
+typedef std::tuple<AgradDistributionRayleigh, type_vv_1> AgradDistributionRayleigh_vv_1;
+typedef std::tuple<AgradDistributionRayleigh, type_vv_2> AgradDistributionRayleigh_vv_2;
+typedef std::tuple<AgradDistributionRayleigh, type_vv_3> AgradDistributionRayleigh_vv_3;
+typedef std::tuple<AgradDistributionRayleigh, type_vv_4> AgradDistributionRayleigh_vv_4;
+typedef std::tuple<AgradDistributionRayleigh, type_vv_5> AgradDistributionRayleigh_vv_5;
+typedef std::tuple<AgradDistributionRayleigh, type_vv_6> AgradDistributionRayleigh_vv_6;
+typedef std::tuple<AgradDistributionRayleigh, type_vv_7> AgradDistributionRayleigh_vv_7;
+typedef std::tuple<AgradDistributionRayleigh, type_vv_8> AgradDistributionRayleigh_vv_8;
+typedef std::tuple<AgradDistributionRayleigh, type_vv_9> AgradDistributionRayleigh_vv_9;
+typedef std::tuple<AgradDistributionRayleigh, type_vv_10> AgradDistributionRayleigh_vv_10;
+typedef std::tuple<AgradDistributionRayleigh, type_vv_11> AgradDistributionRayleigh_vv_11;
+typedef std::tuple<AgradDistributionRayleigh, type_vv_12> AgradDistributionRayleigh_vv_12;
+typedef std::tuple<AgradDistributionRayleigh, type_vv_13> AgradDistributionRayleigh_vv_13;
+typedef std::tuple<AgradDistributionRayleigh, type_vv_14> AgradDistributionRayleigh_vv_14;
+typedef std::tuple<AgradDistributionRayleigh, type_vv_15> AgradDistributionRayleigh_vv_15;
+typedef std::tuple<AgradDistributionRayleigh, type_vv_16> AgradDistributionRayleigh_vv_16;
+typedef std::tuple<AgradDistributionRayleigh, type_vv_17> AgradDistributionRayleigh_vv_17;
+typedef std::tuple<AgradDistributionRayleigh, type_vv_18> AgradDistributionRayleigh_vv_18;
+typedef std::tuple<AgradDistributionRayleigh, type_vv_19> AgradDistributionRayleigh_vv_19;
+typedef std::tuple<AgradDistributionRayleigh, type_vv_20> AgradDistributionRayleigh_vv_20;
+typedef std::tuple<AgradDistributionRayleigh, type_vv_21> AgradDistributionRayleigh_vv_21;
+typedef std::tuple<AgradDistributionRayleigh, type_vv_22> AgradDistributionRayleigh_vv_22;
+typedef std::tuple<AgradDistributionRayleigh, type_vv_23> AgradDistributionRayleigh_vv_23;
+typedef std::tuple<AgradDistributionRayleigh, type_vv_24> AgradDistributionRayleigh_vv_24;
+typedef std::tuple<AgradDistributionRayleigh, type_vv_25> AgradDistributionRayleigh_vv_25;
+typedef std::tuple<AgradDistributionRayleigh, type_vv_26> AgradDistributionRayleigh_vv_26;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionRayleigh_vv_0, AgradDistributionTestFixture, AgradDistributionRayleigh_vv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionRayleigh_vv_1, AgradDistributionTestFixture, AgradDistributionRayleigh_vv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionRayleigh_vv_2, AgradDistributionTestFixture, AgradDistributionRayleigh_vv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionRayleigh_vv_3, AgradDistributionTestFixture, AgradDistributionRayleigh_vv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionRayleigh_vv_4, AgradDistributionTestFixture, AgradDistributionRayleigh_vv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionRayleigh_vv_5, AgradDistributionTestFixture, AgradDistributionRayleigh_vv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionRayleigh_vv_6, AgradDistributionTestFixture, AgradDistributionRayleigh_vv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionRayleigh_vv_7, AgradDistributionTestFixture, AgradDistributionRayleigh_vv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionRayleigh_vv_8, AgradDistributionTestFixture, AgradDistributionRayleigh_vv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionRayleigh_vv_9, AgradDistributionTestFixture, AgradDistributionRayleigh_vv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionRayleigh_vv_10, AgradDistributionTestFixture, AgradDistributionRayleigh_vv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionRayleigh_vv_11, AgradDistributionTestFixture, AgradDistributionRayleigh_vv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionRayleigh_vv_12, AgradDistributionTestFixture, AgradDistributionRayleigh_vv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionRayleigh_vv_13, AgradDistributionTestFixture, AgradDistributionRayleigh_vv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionRayleigh_vv_14, AgradDistributionTestFixture, AgradDistributionRayleigh_vv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionRayleigh_vv_15, AgradDistributionTestFixture, AgradDistributionRayleigh_vv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionRayleigh_vv_16, AgradDistributionTestFixture, AgradDistributionRayleigh_vv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionRayleigh_vv_17, AgradDistributionTestFixture, AgradDistributionRayleigh_vv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionRayleigh_vv_18, AgradDistributionTestFixture, AgradDistributionRayleigh_vv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionRayleigh_vv_19, AgradDistributionTestFixture, AgradDistributionRayleigh_vv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionRayleigh_vv_20, AgradDistributionTestFixture, AgradDistributionRayleigh_vv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionRayleigh_vv_21, AgradDistributionTestFixture, AgradDistributionRayleigh_vv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionRayleigh_vv_22, AgradDistributionTestFixture, AgradDistributionRayleigh_vv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionRayleigh_vv_23, AgradDistributionTestFixture, AgradDistributionRayleigh_vv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionRayleigh_vv_24, AgradDistributionTestFixture, AgradDistributionRayleigh_vv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionRayleigh_vv_25, AgradDistributionTestFixture, AgradDistributionRayleigh_vv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionRayleigh_vv_26, AgradDistributionTestFixture, AgradDistributionRayleigh_vv_26);
+
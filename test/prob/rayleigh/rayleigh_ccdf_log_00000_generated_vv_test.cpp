@@ -0,0 +1,92 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/rayleigh/rayleigh_ccdf_log_test.hpp>
+
+typedef std::tuple<double, var, empty, empty, empty, empty> type_vv_0;
+typedef std::tuple<double, std::vector<var>, empty, empty, empty, empty> type_vv_1;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty, empty> type_vv_2;
+typedef std::tuple<std::vector<double>, var, empty, empty, empty, empty> type_vv_3;
+typedef std::tuple<std::vector<double>, std::vector<var>, empty, empty, empty, empty> type_vv_4;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty, empty> type_vv_5;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty, empty> type_vv_6;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty, empty> type_vv_7;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty, empty> type_vv_8;
+typedef std::tuple<var, double, empty, empty, empty, empty> type_vv_9;
+typedef std::tuple<var, std::vector<double>, empty, empty, empty, empty> type_vv_10;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_vv_11;
+typedef std::tuple<var, var, empty, empty, empty, empty> type_vv_12;
+typedef std::tuple<var, std::vector<var>, empty, empty, empty, empty> type_vv_13;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty, empty> type_vv_14;
+typedef std::tuple<std::vector<var>, double, empty, empty, empty, empty> type_vv_15;
+typedef std::tuple<std::vector<var>, std::vector<double>, empty, empty, empty, empty> type_vv_16;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_vv_17;
+typedef std::tuple<std::vector<var>, var, empty, empty, empty, empty> type_vv_18;
+typedef std::tuple<std::vector<var>, std::vector<var>, empty, empty, empty, empty> type_vv_19;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty, empty> type_vv_20;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty, empty> type_vv_21;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty, empty> type_vv_22;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_vv_23;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty, empty> type_vv_24;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty, empty> type_vv_25;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty, empty> type_vv_26;
+
+typedef std::tuple<AgradCcdfLogRayleigh, type_vv_0> AgradCcdfLogRayleigh_vv_0;
+typedef std::tuple<AgradCcdfLogRayleigh, type_vv_1> AgradCcdfLogRayleigh_vv_1;
+typedef std::tuple<AgradCcdfLogRayleigh, type_vv_2> AgradCcdfLogRayleigh_vv_2;
+typedef std::tuple<AgradCcdfLogRayleigh, type_vv_3> AgradCcdfLogRayleigh_vv_3;
+typedef std::tuple<AgradCcdfLogRayleigh, type_vv_4> AgradCcdfLogRayleigh_vv_4;
+typedef std::tuple<AgradCcdfLogRayleigh, type_vv_5> AgradCcdfLogRayleigh_vv_5;
+typedef std::tuple<AgradCcdfLogRayleigh, type_vv_6> AgradCcdfLogRayleigh_vv_6;
+typedef std::tuple<AgradCcdfLogRayleigh, type_vv_7> AgradCcdfLogRayleigh_vv_7;
+typedef std::tuple<AgradCcdfLogRayleigh, type_vv_8> AgradCcdfLogRayleigh_vv_8;
+typedef std::tuple<AgradCcdfLogRayleigh, type_vv_9> AgradCcdfLogRayleigh_vv_9;
+typedef std::tuple<AgradCcdfLogRayleigh, type_vv_10> AgradCcdfLogRayleigh_vv_10;
+typedef std::tuple<AgradCcdfLogRayleigh, type_vv_11> AgradCcdfLogRayleigh_vv_11;
+typedef std::tuple<AgradCcdfLogRayleigh, type_vv_12> AgradCcdfLogRayleigh_vv_12;
+typedef std::tuple<AgradCcdfLogRayleigh, type_vv_13> AgradCcdfLogRayleigh_vv_13;
+typedef std::tuple<AgradCcdfLogRayleigh, type_vv_14> AgradCcdfLogRayleigh_vv_14;
+typedef std::tuple<AgradCcdfLogRayleigh, type_vv_15> AgradCcdfLogRayleigh_vv_15;
+typedef std::tuple<AgradCcdfLogRayleigh, type_vv_16> AgradCcdfLogRayleigh_vv_16;
+typedef std::tuple<AgradCcdfLogRayleigh, type_vv_17> AgradCcdfLogRayleigh_vv_17;
+typedef std::tuple<AgradCcdfLogRayleigh, type_vv_18> AgradCcdfLogRayleigh_vv_18;
+typedef std::tuple<AgradCcdfLogRayleigh, type_vv_19> AgradCcdfLogRayleigh_vv_19;
+typedef std::tuple<AgradCcdfLogRayleigh, type_vv_20> AgradCcdfLogRayleigh_vv_20;
+typedef std::tuple<AgradCcdfLogRayleigh, type_vv_21> AgradCcdfLogRayleigh_vv_21;
+typedef std::tuple<AgradCcdfLogRayleigh, type_vv_22> AgradCcdfLogRayleigh_vv_22;
+typedef std::tuple<AgradCcdfLogRayleigh, type_vv_23> AgradCcdfLogRayleigh_vv_23;
+typedef std::tuple<AgradCcdfLogRayleigh, type_vv_24> AgradCcdfLogRayleigh_vv_24;
+typedef std::tuple<AgradCcdfLogRayleigh, type_vv_25> AgradCcdfLogRayleigh_vv_25;
+typedef std::tuple<AgradCcdfLogRayleigh, type_vv_26> AgradCcdfLogRayleigh_vv_26;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogRayleigh_vv_0, AgradCcdfLogTestFixture, AgradCcdfLogRayleigh_vv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogRayleigh_vv_1, AgradCcdfLogTestFixture, AgradCcdfLogRayleigh_vv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogRayleigh_vv_2, AgradCcdfLogTestFixture, AgradCcdfLogRayleigh_vv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogRayleigh_vv_3, AgradCcdfLogTestFixture, AgradCcdfLogRayleigh_vv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogRayleigh_vv_4, AgradCcdfLogTestFixture, AgradCcdfLogRayleigh_vv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogRayleigh_vv_5, AgradCcdfLogTestFixture, AgradCcdfLogRayleigh_vv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogRayleigh_vv_6, AgradCcdfLogTestFixture, AgradCcdfLogRayleigh_vv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogRayleigh_vv_7, AgradCcdfLogTestFixture, AgradCcdfLogRayleigh_vv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogRayleigh_vv_8, AgradCcdfLogTestFixture, AgradCcdfLogRayleigh_vv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogRayleigh_vv_9, AgradCcdfLogTestFixture, AgradCcdfLogRayleigh_vv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogRayleigh_vv_10, AgradCcdfLogTestFixture, AgradCcdfLogRayleigh_vv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogRayleigh_vv_11, AgradCcdfLogTestFixture, AgradCcdfLogRayleigh_vv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogRayleigh_vv_12, AgradCcdfLogTestFixture, AgradCcdfLogRayleigh_vv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogRayleigh_vv_13, AgradCcdfLogTestFixture, AgradCcdfLogRayleigh_vv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogRayleigh_vv_14, AgradCcdfLogTestFixture, AgradCcdfLogRayleigh_vv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogRayleigh_vv_15, AgradCcdfLogTestFixture, AgradCcdfLogRayleigh_vv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogRayleigh_vv_16, AgradCcdfLogTestFixture, AgradCcdfLogRayleigh_vv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogRayleigh_vv_17, AgradCcdfLogTestFixture, AgradCcdfLogRayleigh_vv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogRayleigh_vv_18, AgradCcdfLogTestFixture, AgradCcdfLogRayleigh_vv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogRayleigh_vv_19, AgradCcdfLogTestFixture, AgradCcdfLogRayleigh_vv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogRayleigh_vv_20, AgradCcdfLogTestFixture, AgradCcdfLogRayleigh_vv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogRayleigh_vv_21, AgradCcdfLogTestFixture, AgradCcdfLogRayleigh_vv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogRayleigh_vv_22, AgradCcdfLogTestFixture, AgradCcdfLogRayleigh_vv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogRayleigh_vv_23, AgradCcdfLogTestFixture, AgradCcdfLogRayleigh_vv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogRayleigh_vv_24, AgradCcdfLogTestFixture, AgradCcdfLogRayleigh_vv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogRayleigh_vv_25, AgradCcdfLogTestFixture, AgradCcdfLogRayleigh_vv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogRayleigh_vv_26, AgradCcdfLogTestFixture, AgradCcdfLogRayleigh_vv_26);
+
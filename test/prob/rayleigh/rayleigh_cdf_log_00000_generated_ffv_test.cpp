@@ -0,0 +1,92 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/rayleigh/rayleigh_cdf_log_test.hpp>
+
+typedef std::tuple<double, fvar<fvar<var> >, empty, empty, empty, empty> type_ffv_0;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, empty, empty, empty, empty> type_ffv_1;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_ffv_2;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, empty, empty, empty, empty> type_ffv_3;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty, empty> type_ffv_4;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_ffv_5;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty, empty> type_ffv_6;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty, empty> type_ffv_7;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_ffv_8;
+typedef std::tuple<fvar<fvar<var> >, double, empty, empty, empty, empty> type_ffv_9;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, empty, empty, empty, empty> type_ffv_10;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_ffv_11;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty, empty> type_ffv_12;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty, empty> type_ffv_13;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_ffv_14;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, empty, empty, empty, empty> type_ffv_15;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty, empty> type_ffv_16;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_ffv_17;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty, empty> type_ffv_18;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty, empty> type_ffv_19;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_ffv_20;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty, empty> type_ffv_21;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty, empty> type_ffv_22;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_ffv_23;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty, empty> type_ffv_24;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty, empty> type_ffv_25;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_ffv_26;
+
+typedef std::tuple<AgradCdfLogRayleigh, type_ffv_0> AgradCdfLogRayleigh_ffv_0;
+typedef std::tuple<AgradCdfLogRayleigh, type_ffv_1> AgradCdfLogRayleigh_ffv_1;
+typedef std::tuple<AgradCdfLogRayleigh, type_ffv_2> AgradCdfLogRayleigh_ffv_2;
+typedef std::tuple<AgradCdfLogRayleigh, type_ffv_3> AgradCdfLogRayleigh_ffv_3;
+typedef std::tuple<AgradCdfLogRayleigh, type_ffv_4> AgradCdfLogRayleigh_ffv_4;
+typedef std::tuple<AgradCdfLogRayleigh, type_ffv_5> AgradCdfLogRayleigh_ffv_5;
+typedef std::tuple<AgradCdfLogRayleigh, type_ffv_6> AgradCdfLogRayleigh_ffv_6;
+typedef std::tuple<AgradCdfLogRayleigh, type_ffv_7> AgradCdfLogRayleigh_ffv_7;
+typedef std::tuple<AgradCdfLogRayleigh, type_ffv_8> AgradCdfLogRayleigh_ffv_8;
+typedef std::tuple<AgradCdfLogRayleigh, type_ffv_9> AgradCdfLogRayleigh_ffv_9;
+typedef std::tuple<AgradCdfLogRayleigh, type_ffv_10> AgradCdfLogRayleigh_ffv_10;
+typedef std::tuple<AgradCdfLogRayleigh, type_ffv_11> AgradCdfLogRayleigh_ffv_11;
+typedef std::tuple<AgradCdfLogRayleigh, type_ffv_12> AgradCdfLogRayleigh_ffv_12;
+typedef std::tuple<AgradCdfLogRayleigh, type_ffv_13> AgradCdfLogRayleigh_ffv_13;
+typedef std::tuple<AgradCdfLogRayleigh, type_ffv_14> AgradCdfLogRayleigh_ffv_14;
+typedef std::tuple<AgradCdfLogRayleigh, type_ffv_15> AgradCdfLogRayleigh_ffv_15;
+typedef std::tuple<AgradCdfLogRayleigh, type_ffv_16> AgradCdfLogRayleigh_ffv_16;
+typedef std::tuple<AgradCdfLogRayleigh, type_ffv_17> AgradCdfLogRayleigh_ffv_17;
+typedef std::tuple<AgradCdfLogRayleigh, type_ffv_18> AgradCdfLogRayleigh_ffv_18;
+typedef std::tuple<AgradCdfLogRayleigh, type_ffv_19> AgradCdfLogRayleigh_ffv_19;
+typedef std::tuple<AgradCdfLogRayleigh, type_ffv_20> AgradCdfLogRayleigh_ffv_20;
+typedef std::tuple<AgradCdfLogRayleigh, type_ffv_21> AgradCdfLogRayleigh_ffv_21;
+typedef std::tuple<AgradCdfLogRayleigh, type_ffv_22> AgradCdfLogRayleigh_ffv_22;
+typedef std::tuple<AgradCdfLogRayleigh, type_ffv_23> AgradCdfLogRayleigh_ffv_23;
+typedef std::tuple<AgradCdfLogRayleigh, type_ffv_24> AgradCdfLogRayleigh_ffv_24;
+typedef std::tuple<AgradCdfLogRayleigh, type_ffv_25> AgradCdfLogRayleigh_ffv_25;
+typedef std::tuple<AgradCdfLogRayleigh, type_ffv_26> AgradCdfLogRayleigh_ffv_26;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogRayleigh_ffv_0, AgradCdfLogTestFixture, AgradCdfLogRayleigh_ffv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogRayleigh_ffv_1, AgradCdfLogTestFixture, AgradCdfLogRayleigh_ffv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogRayleigh_ffv_2, AgradCdfLogTestFixture, AgradCdfLogRayleigh_ffv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogRayleigh_ffv_3, AgradCdfLogTestFixture, AgradCdfLogRayleigh_ffv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogRayleigh_ffv_4, AgradCdfLogTestFixture, AgradCdfLogRayleigh_ffv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogRayleigh_ffv_5, AgradCdfLogTestFixture, AgradCdfLogRayleigh_ffv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogRayleigh_ffv_6, AgradCdfLogTestFixture, AgradCdfLogRayleigh_ffv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogRayleigh_ffv_7, AgradCdfLogTestFixture, AgradCdfLogRayleigh_ffv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogRayleigh_ffv_8, AgradCdfLogTestFixture, AgradCdfLogRayleigh_ffv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogRayleigh_ffv_9, AgradCdfLogTestFixture, AgradCdfLogRayleigh_ffv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogRayleigh_ffv_10, AgradCdfLogTestFixture, AgradCdfLogRayleigh_ffv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogRayleigh_ffv_11, AgradCdfLogTestFixture, AgradCdfLogRayleigh_ffv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogRayleigh_ffv_12, AgradCdfLogTestFixture, AgradCdfLogRayleigh_ffv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogRayleigh_ffv_13, AgradCdfLogTestFixture, AgradCdfLogRayleigh_ffv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogRayleigh_ffv_14, AgradCdfLogTestFixture, AgradCdfLogRayleigh_ffv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogRayleigh_ffv_15, AgradCdfLogTestFixture, AgradCdfLogRayleigh_ffv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogRayleigh_ffv_16, AgradCdfLogTestFixture, AgradCdfLogRayleigh_ffv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogRayleigh_ffv_17, AgradCdfLogTestFixture, AgradCdfLogRayleigh_ffv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogRayleigh_ffv_18, AgradCdfLogTestFixture, AgradCdfLogRayleigh_ffv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogRayleigh_ffv_19, AgradCdfLogTestFixture, AgradCdfLogRayleigh_ffv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogRayleigh_ffv_20, AgradCdfLogTestFixture, AgradCdfLogRayleigh_ffv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogRayleigh_ffv_21, AgradCdfLogTestFixture, AgradCdfLogRayleigh_ffv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogRayleigh_ffv_22, AgradCdfLogTestFixture, AgradCdfLogRayleigh_ffv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogRayleigh_ffv_23, AgradCdfLogTestFixture, AgradCdfLogRayleigh_ffv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogRayleigh_ffv_24, AgradCdfLogTestFixture, AgradCdfLogRayleigh_ffv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogRayleigh_ffv_25, AgradCdfLogTestFixture, AgradCdfLogRayleigh_ffv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogRayleigh_ffv_26, AgradCdfLogTestFixture, AgradCdfLogRayleigh_ffv_26);
+
@@ -0,0 +1,119 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/rayleigh/rayleigh_cdf_log_test.hpp>
+
+typedef std::tuple<double, double, empty, empty, empty, empty> type_v_0;
+typedef std::tuple<double, std::vector<double>, empty, empty, empty, empty> type_v_1;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_2;
+typedef std::tuple<double, var, empty, empty, empty, empty> type_v_3;
+typedef std::tuple<double, std::vector<var>, empty, empty, empty, empty> type_v_4;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_5;
+typedef std::tuple<std::vector<double>, double, empty, empty, empty, empty> type_v_6;
+typedef std::tuple<std::vector<double>, std::vector<double>, empty, empty, empty, empty> type_v_7;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_8;
+typedef std::tuple<std::vector<double>, var, empty, empty, empty, empty> type_v_9;
+typedef std::tuple<std::vector<double>, std::vector<var>, empty, empty, empty, empty> type_v_10;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_11;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty, empty> type_v_12;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty, empty> type_v_13;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_14;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty, empty> type_v_15;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty, empty> type_v_16;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_17;
+typedef std::tuple<var, double, empty, empty, empty, empty> type_v_18;
+typedef std::tuple<var, std::vector<double>, empty, empty, empty, empty> type_v_19;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_20;
+typedef std::tuple<var, var, empty, empty, empty, empty> type_v_21;
+typedef std::tuple<var, std::vector<var>, empty, empty, empty, empty> type_v_22;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_23;
+typedef std::tuple<std::vector<var>, double, empty, empty, empty, empty> type_v_24;
+typedef std::tuple<std::vector<var>, std::vector<double>, empty, empty, empty, empty> type_v_25;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_26;
+typedef std::tuple<std::vector<var>, var, empty, empty, empty, empty> type_v_27;
+typedef std::tuple<std::vector<var>, std::vector<var>, empty, empty, empty, empty> type_v_28;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_29;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty, empty> type_v_30;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty, empty> type_v_31;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_32;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty, empty> type_v_33;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty, empty> type_v_34;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_v_35;
+
+typedef std::tuple<AgradCdfLogRayleigh, type_v_0> AgradCdfLogRayleigh_v_0;
+typedef std::tuple<AgradCdfLogRayleigh, type_v_1> AgradCdfLogRayleigh_v_1;
+typedef std::tuple<AgradCdfLogRayleigh, type_v_2> AgradCdfLogRayleigh_v_2;
+typedef std::tuple<AgradCdfLogRayleigh, type_v_3> AgradCdfLogRayleigh_v_3;
+typedef std::tuple<AgradCdfLogRayleigh, type_v_4> AgradCdfLogRayleigh_v_4;
+typedef std::tuple<AgradCdfLogRayleigh, type_v_5> AgradCdfLogRayleigh_v_5;
+typedef std::tuple<AgradCdfLogRayleigh, type_v_6> AgradCdfLogRayleigh_v_6;
+typedef std::tuple<AgradCdfLogRayleigh, type_v_7> AgradCdfLogRayleigh_v_7;
+typedef std::tuple<AgradCdfLogRayleigh, type_v_8> AgradCdfLogRayleigh_v_8;
+typedef std::tuple<AgradCdfLogRayleigh, type_v_9> AgradCdfLogRayleigh_v_9;
+typedef std::tuple<AgradCdfLogRayleigh, type_v_10> AgradCdfLogRayleigh_v_10;
+typedef std::tuple<AgradCdfLogRayleigh, type_v_11> AgradCdfLogRayleigh_v_11;
+typedef std::tuple<AgradCdfLogRayleigh, type_v_12> AgradCdfLogRayleigh_v_12;
+typedef std::tuple<AgradCdfLogRayleigh, type_v_13> AgradCdfLogRayleigh_v_13;
+typedef std::tuple<AgradCdfLogRayleigh, type_v_14> AgradCdfLogRayleigh_v_14;
+typedef std::tuple<AgradCdfLogRayleigh, type_v_15> AgradCdfLogRayleigh_v_15;
+typedef std::tuple<AgradCdfLogRayleigh, type_v_16> AgradCdfLogRayleigh_v_16;
+typedef std::tuple<AgradCdfLogRayleigh, type_v_17> AgradCdfLogRayleigh_v_17;
+typedef std::tuple<AgradCdfLogRayleigh, type_v_18> AgradCdfLogRayleigh_v_18;
+typedef std::tuple<AgradCdfLogRayleigh, type_v_19> AgradCdfLogRayleigh_v_19;
+typedef std::tuple<AgradCdfLogRayleigh, type_v_20> AgradCdfLogRayleigh_v_20;
+typedef std::tuple<AgradCdfLogRayleigh, type_v_21> AgradCdfLogRayleigh_v_21;
+typedef std::tuple<AgradCdfLogRayleigh, type_v_22> AgradCdfLogRayleigh_v_22;
+typedef std::tuple<AgradCdfLogRayleigh, type_v_23> AgradCdfLogRayleigh_v_23;
+typedef std::tuple<AgradCdfLogRayleigh, type_v_24> AgradCdfLogRayleigh_v_24;
+typedef std::tuple<AgradCdfLogRayleigh, type_v_25> AgradCdfLogRayleigh_v_25;
+typedef std::tuple<AgradCdfLogRayleigh, type_v_26> AgradCdfLogRayleigh_v_26;
+typedef std::tuple<AgradCdfLogRayleigh, type_v_27> AgradCdfLogRayleigh_v_27;
+typedef std::tuple<AgradCdfLogRayleigh, type_v_28> AgradCdfLogRayleigh_v_28;
+typedef std::tuple<AgradCdfLogRayleigh, type_v_29> AgradCdfLogRayleigh_v_29;
+typedef std::tuple<AgradCdfLogRayleigh, type_v_30> AgradCdfLogRayleigh_v_30;
+typedef std::tuple<AgradCdfLogRayleigh, type_v_31> AgradCdfLogRayleigh_v_31;
+typedef std::tuple<AgradCdfLogRayleigh, type_v_32> AgradCdfLogRayleigh_v_32;
+typedef std::tuple<AgradCdfLogRayleigh, type_v_33> AgradCdfLogRayleigh_v_33;
+typedef std::tuple<AgradCdfLogRayleigh, type_v_34> AgradCdfLogRayleigh_v_34;
+typedef std::tuple<AgradCdfLogRayleigh, type_v_35> AgradCdfLogRayleigh_v_35;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogRayleigh_v_0, AgradCdfLogTestFixture, AgradCdfLogRayleigh_v_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogRayleigh_v_1, AgradCdfLogTestFixture, AgradCdfLogRayleigh_v_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogRayleigh_v_2, AgradCdfLogTestFixture, AgradCdfLogRayleigh_v_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogRayleigh_v_3, AgradCdfLogTestFixture, AgradCdfLogRayleigh_v_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogRayleigh_v_4, AgradCdfLogTestFixture, AgradCdfLogRayleigh_v_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogRayleigh_v_5, AgradCdfLogTestFixture, AgradCdfLogRayleigh_v_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogRayleigh_v_6, AgradCdfLogTestFixture, AgradCdfLogRayleigh_v_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogRayleigh_v_7, AgradCdfLogTestFixture, AgradCdfLogRayleigh_v_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogRayleigh_v_8, AgradCdfLogTestFixture, AgradCdfLogRayleigh_v_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogRayleigh_v_9, AgradCdfLogTestFixture, AgradCdfLogRayleigh_v_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogRayleigh_v_10, AgradCdfLogTestFixture, AgradCdfLogRayleigh_v_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogRayleigh_v_11, AgradCdfLogTestFixture, AgradCdfLogRayleigh_v_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogRayleigh_v_12, AgradCdfLogTestFixture, AgradCdfLogRayleigh_v_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogRayleigh_v_13, AgradCdfLogTestFixture, AgradCdfLogRayleigh_v_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogRayleigh_v_14, AgradCdfLogTestFixture, AgradCdfLogRayleigh_v_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogRayleigh_v_15, AgradCdfLogTestFixture, AgradCdfLogRayleigh_v_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogRayleigh_v_16, AgradCdfLogTestFixture, AgradCdfLogRayleigh_v_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogRayleigh_v_17, AgradCdfLogTestFixture, AgradCdfLogRayleigh_v_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogRayleigh_v_18, AgradCdfLogTestFixture, AgradCdfLogRayleigh_v_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogRayleigh_v_19, AgradCdfLogTestFixture, AgradCdfLogRayleigh_v_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogRayleigh_v_20, AgradCdfLogTestFixture, AgradCdfLogRayleigh_v_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogRayleigh_v_21, AgradCdfLogTestFixture, AgradCdfLogRayleigh_v_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogRayleigh_v_22, AgradCdfLogTestFixture, AgradCdfLogRayleigh_v_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogRayleigh_v_23, AgradCdfLogTestFixture, AgradCdfLogRayleigh_v_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogRayleigh_v_24, AgradCdfLogTestFixture, AgradCdfLogRayleigh_v_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogRayleigh_v_25, AgradCdfLogTestFixture, AgradCdfLogRayleigh_v_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogRayleigh_v_26, AgradCdfLogTestFixture, AgradCdfLogRayleigh_v_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogRayleigh_v_27, AgradCdfLogTestFixture, AgradCdfLogRayleigh_v_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogRayleigh_v_28, AgradCdfLogTestFixture, AgradCdfLogRayleigh_v_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogRayleigh_v_29, AgradCdfLogTestFixture, AgradCdfLogRayleigh_v_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogRayleigh_v_30, AgradCdfLogTestFixture, AgradCdfLogRayleigh_v_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogRayleigh_v_31, AgradCdfLogTestFixture, AgradCdfLogRayleigh_v_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogRayleigh_v_32, AgradCdfLogTestFixture, AgradCdfLogRayleigh_v_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogRayleigh_v_33, AgradCdfLogTestFixture, AgradCdfLogRayleigh_v_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogRayleigh_v_34, AgradCdfLogTestFixture, AgradCdfLogRayleigh_v_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogRayleigh_v_35, AgradCdfLogTestFixture, AgradCdfLogRayleigh_v_35);
+
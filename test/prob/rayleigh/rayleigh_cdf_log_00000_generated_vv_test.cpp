@@ -0,0 +1,92 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/rayleigh/rayleigh_cdf_log_test.hpp>
+
+typedef std::tuple<double, var, empty, empty, empty, empty> type_vv_0;
+typedef std::tuple<double, std::vector<var>, empty, empty, empty, empty> type_vv_1;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty, empty> type_vv_2;
+typedef std::tuple<std::vector<double>, var, empty, empty, empty, empty> type_vv_3;
+typedef std::tuple<std::vector<double>, std::vector<var>, empty, empty, empty, empty> type_vv_4;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty, empty> type_vv_5;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty, empty> type_vv_6;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty, empty> type_vv_7;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty, empty> type_vv_8;
+typedef std::tuple<var, double, empty, empty, empty, empty> type_vv_9;
+typedef std::tuple<var, std::vector<double>, empty, empty, empty, empty> type_vv_10;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_vv_11;
+typedef std::tuple<var, var, empty, empty, empty, empty> type_vv_12;
+typedef std::tuple<var, std::vector<var>, empty, empty, empty, empty> type_vv_13;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty, empty> type_vv_14;
+typedef std::tuple<std::vector<var>, double, empty, empty, empty, empty> type_vv_15;
+typedef std::tuple<std::vector<var>, std::vector<double>, empty, empty, empty, empty> type_vv_16;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_vv_17;
+typedef std::tuple<std::vector<var>, var, empty, empty, empty, empty> type_vv_18;
+typedef std::tuple<std::vector<var>, std::vector<var>, empty, empty, empty, empty> type_vv_19;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty, empty> type_vv_20;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty, empty> type_vv_21;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty, empty> type_vv_22;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty, empty> type_vv_23;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty, empty> type_vv_24;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty, empty> type_vv_25;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty, empty> type_vv_26;
+
+typedef std::tuple<AgradCdfLogRayleigh, type_vv_0> AgradCdfLogRayleigh_vv_0;
+typedef std::tuple<AgradCdfLogRayleigh, type_vv_1> AgradCdfLogRayleigh_vv_1;
+typedef std::tuple<AgradCdfLogRayleigh, type_vv_2> AgradCdfLogRayleigh_vv_2;
+typedef std::tuple<AgradCdfLogRayleigh, type_vv_3> AgradCdfLogRayleigh_vv_3;
+typedef std::tuple<AgradCdfLogRayleigh, type_vv_4> AgradCdfLogRayleigh_vv_4;
+typedef std::tuple<AgradCdfLogRayleigh, type_vv_5> AgradCdfLogRayleigh_vv_5;
+typedef std::tuple<AgradCdfLogRayleigh, type_vv_6> AgradCdfLogRayleigh_vv_6;
+typedef std::tuple<AgradCdfLogRayleigh, type_vv_7> AgradCdfLogRayleigh_vv_7;
+typedef std::tuple<AgradCdfLogRayleigh, type_vv_8> AgradCdfLogRayleigh_vv_8;
+typedef std::tuple<AgradCdfLogRayleigh, type_vv_9> AgradCdfLogRayleigh_vv_9;
+typedef std::tuple<AgradCdfLogRayleigh, type_vv_10> AgradCdfLogRayleigh_vv_10;
+typedef std::tuple<AgradCdfLogRayleigh, type_vv_11> AgradCdfLogRayleigh_vv_11;
+typedef std::tuple<AgradCdfLogRayleigh, type_vv_12> AgradCdfLogRayleigh_vv_12;
+typedef std::tuple<AgradCdfLogRayleigh, type_vv_13> AgradCdfLogRayleigh_vv_13;
+typedef std::tuple<AgradCdfLogRayleigh, type_vv_14> AgradCdfLogRayleigh_vv_14;
+typedef std::tuple<AgradCdfLogRayleigh, type_vv_15> AgradCdfLogRayleigh_vv_15;
+typedef std::tuple<AgradCdfLogRayleigh, type_vv_16> AgradCdfLogRayleigh_vv_16;
+typedef std::tuple<AgradCdfLogRayleigh, type_vv_17> AgradCdfLogRayleigh_vv_17;
+typedef std::tuple<AgradCdfLogRayleigh, type_vv_18> AgradCdfLogRayleigh_vv_18;
+typedef std::tuple<AgradCdfLogRayleigh, type_vv_19> AgradCdfLogRayleigh_vv_19;
+typedef std::tuple<AgradCdfLogRayleigh, type_vv_20> AgradCdfLogRayleigh_vv_20;
+typedef std::tuple<AgradCdfLogRayleigh, type_vv_21> AgradCdfLogRayleigh_vv_21;
+typedef std::tuple<AgradCdfLogRayleigh, type_vv_22> AgradCdfLogRayleigh_vv_22;
+typedef std::tuple<AgradCdfLogRayleigh, type_vv_23> AgradCdfLogRayleigh_vv_23;
+typedef std::tuple<AgradCdfLogRayleigh, type_vv_24> AgradCdfLogRayleigh_vv_24;
+typedef std::tuple<AgradCdfLogRayleigh, type_vv_25> AgradCdfLogRayleigh_vv_25;
+typedef std::tuple<AgradCdfLogRayleigh, type_vv_26> AgradCdfLogRayleigh_vv_26;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogRayleigh_vv_0, AgradCdfLogTestFixture, AgradCdfLogRayleigh_vv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogRayleigh_vv_1, AgradCdfLogTestFixture, AgradCdfLogRayleigh_vv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogRayleigh_vv_2, AgradCdfLogTestFixture, AgradCdfLogRayleigh_vv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogRayleigh_vv_3, AgradCdfLogTestFixture, AgradCdfLogRayleigh_vv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogRayleigh_vv_4, AgradCdfLogTestFixture, AgradCdfLogRayleigh_vv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogRayleigh_vv_5, AgradCdfLogTestFixture, AgradCdfLogRayleigh_vv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogRayleigh_vv_6, AgradCdfLogTestFixture, AgradCdfLogRayleigh_vv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogRayleigh_vv_7, AgradCdfLogTestFixture, AgradCdfLogRayleigh_vv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogRayleigh_vv_8, AgradCdfLogTestFixture, AgradCdfLogRayleigh_vv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogRayleigh_vv_9, AgradCdfLogTestFixture, AgradCdfLogRayleigh_vv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogRayleigh_vv_10, AgradCdfLogTestFixture, AgradCdfLogRayleigh_vv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogRayleigh_vv_11, AgradCdfLogTestFixture, AgradCdfLogRayleigh_vv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogRayleigh_vv_12, AgradCdfLogTestFixture, AgradCdfLogRayleigh_vv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogRayleigh_vv_13, AgradCdfLogTestFixture, AgradCdfLogRayleigh_vv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogRayleigh_vv_14, AgradCdfLogTestFixture, AgradCdfLogRayleigh_vv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogRayleigh_vv_15, AgradCdfLogTestFixture, AgradCdfLogRayleigh_vv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogRayleigh_vv_16, AgradCdfLogTestFixture, AgradCdfLogRayleigh_vv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogRayleigh_vv_17, AgradCdfLogTestFixture, AgradCdfLogRayleigh_vv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogRayleigh_vv_18, AgradCdfLogTestFixture, AgradCdfLogRayleigh_vv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogRayleigh_vv_19, AgradCdfLogTestFixture, AgradCdfLogRayleigh_vv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogRayleigh_vv_20, AgradCdfLogTestFixture, AgradCdfLogRayleigh_vv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogRayleigh_vv_21, AgradCdfLogTestFixture, AgradCdfLogRayleigh_vv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogRayleigh_vv_22, AgradCdfLogTestFixture, AgradCdfLogRayleigh_vv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogRayleigh_vv_23, AgradCdfLogTestFixture, AgradCdfLogRayleigh_vv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogRayleigh_vv_24, AgradCdfLogTestFixture, AgradCdfLogRayleigh_vv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogRayleigh_vv_25, AgradCdfLogTestFixture, AgradCdfLogRayleigh_vv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogRayleigh_vv_26, AgradCdfLogTestFixture, AgradCdfLogRayleigh_vv_26);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/scaled_inv_chi_square/scaled_inv_chi_square_test.hpp>
+
+typedef std::tuple<double, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_0;
+typedef std::tuple<double, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_1;
+typedef std::tuple<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_2;
+typedef std::tuple<double, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_3;
+typedef std::tuple<double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_4;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_5;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_6;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_7;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_8;
+typedef std::tuple<double, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_9;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_10;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_11;
+typedef std::tuple<double, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_12;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_13;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_14;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_15;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_16;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_17;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_18;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_19;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_20;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_21;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_22;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_23;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_24;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_25;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_26;
+typedef std::tuple<std::vector<double>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_27;
+typedef std::tuple<std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_28;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_29;
+typedef std::tuple<std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_30;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_31;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_32;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_33;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_34;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_35;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_36;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_37;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_38;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_39;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_40;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_41;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_42;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_43;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_44;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_45;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_46;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_47;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_48;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_49;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_50;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_51;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_52;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_53;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_54;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_55;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_56;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_57;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_58;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_59;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_60;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_61;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_62;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_63;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_64;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_65;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_66;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_67;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_68;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_69;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_70;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_80;
+typedef std::tuple<fvar<fvar<var> >, double, double, empty, empty, empty> type_ffv_81;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<double>, empty, empty, empty> type_ffv_82;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_83;
+typedef std::tuple<fvar<fvar<var> >, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_84;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_85;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_86;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, double, empty, empty, empty> type_ffv_87;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_88;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_89;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_90;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_91;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_92;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_93;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_94;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_95;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_96;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_97;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_98;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_99;
+
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_0> AgradDistributionsScaledInvChiSquare_ffv_0;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_1> AgradDistributionsScaledInvChiSquare_ffv_1;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_2> AgradDistributionsScaledInvChiSquare_ffv_2;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_3> AgradDistributionsScaledInvChiSquare_ffv_3;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_4> AgradDistributionsScaledInvChiSquare_ffv_4;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_5> AgradDistributionsScaledInvChiSquare_ffv_5;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_6> AgradDistributionsScaledInvChiSquare_ffv_6;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_7> AgradDistributionsScaledInvChiSquare_ffv_7;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_8> AgradDistributionsScaledInvChiSquare_ffv_8;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_9> AgradDistributionsScaledInvChiSquare_ffv_9;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_10> AgradDistributionsScaledInvChiSquare_ffv_10;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_11> AgradDistributionsScaledInvChiSquare_ffv_11;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_12> AgradDistributionsScaledInvChiSquare_ffv_12;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_13> AgradDistributionsScaledInvChiSquare_ffv_13;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_14> AgradDistributionsScaledInvChiSquare_ffv_14;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_15> AgradDistributionsScaledInvChiSquare_ffv_15;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_16> AgradDistributionsScaledInvChiSquare_ffv_16;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_17> AgradDistributionsScaledInvChiSquare_ffv_17;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_18> AgradDistributionsScaledInvChiSquare_ffv_18;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_19> AgradDistributionsScaledInvChiSquare_ffv_19;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_20> AgradDistributionsScaledInvChiSquare_ffv_20;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_21> AgradDistributionsScaledInvChiSquare_ffv_21;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_22> AgradDistributionsScaledInvChiSquare_ffv_22;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_23> AgradDistributionsScaledInvChiSquare_ffv_23;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_24> AgradDistributionsScaledInvChiSquare_ffv_24;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_25> AgradDistributionsScaledInvChiSquare_ffv_25;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_26> AgradDistributionsScaledInvChiSquare_ffv_26;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_27> AgradDistributionsScaledInvChiSquare_ffv_27;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_28> AgradDistributionsScaledInvChiSquare_ffv_28;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_29> AgradDistributionsScaledInvChiSquare_ffv_29;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_30> AgradDistributionsScaledInvChiSquare_ffv_30;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_31> AgradDistributionsScaledInvChiSquare_ffv_31;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_32> AgradDistributionsScaledInvChiSquare_ffv_32;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_33> AgradDistributionsScaledInvChiSquare_ffv_33;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_34> AgradDistributionsScaledInvChiSquare_ffv_34;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_35> AgradDistributionsScaledInvChiSquare_ffv_35;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_36> AgradDistributionsScaledInvChiSquare_ffv_36;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_37> AgradDistributionsScaledInvChiSquare_ffv_37;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_38> AgradDistributionsScaledInvChiSquare_ffv_38;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_39> AgradDistributionsScaledInvChiSquare_ffv_39;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_40> AgradDistributionsScaledInvChiSquare_ffv_40;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_41> AgradDistributionsScaledInvChiSquare_ffv_41;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_42> AgradDistributionsScaledInvChiSquare_ffv_42;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_43> AgradDistributionsScaledInvChiSquare_ffv_43;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_44> AgradDistributionsScaledInvChiSquare_ffv_44;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_45> AgradDistributionsScaledInvChiSquare_ffv_45;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_46> AgradDistributionsScaledInvChiSquare_ffv_46;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_47> AgradDistributionsScaledInvChiSquare_ffv_47;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_48> AgradDistributionsScaledInvChiSquare_ffv_48;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_49> AgradDistributionsScaledInvChiSquare_ffv_49;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_50> AgradDistributionsScaledInvChiSquare_ffv_50;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_51> AgradDistributionsScaledInvChiSquare_ffv_51;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_52> AgradDistributionsScaledInvChiSquare_ffv_52;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_53> AgradDistributionsScaledInvChiSquare_ffv_53;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_54> AgradDistributionsScaledInvChiSquare_ffv_54;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_55> AgradDistributionsScaledInvChiSquare_ffv_55;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_56> AgradDistributionsScaledInvChiSquare_ffv_56;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_57> AgradDistributionsScaledInvChiSquare_ffv_57;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_58> AgradDistributionsScaledInvChiSquare_ffv_58;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_59> AgradDistributionsScaledInvChiSquare_ffv_59;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_60> AgradDistributionsScaledInvChiSquare_ffv_60;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_61> AgradDistributionsScaledInvChiSquare_ffv_61;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_62> AgradDistributionsScaledInvChiSquare_ffv_62;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_63> AgradDistributionsScaledInvChiSquare_ffv_63;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_64> AgradDistributionsScaledInvChiSquare_ffv_64;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_65> AgradDistributionsScaledInvChiSquare_ffv_65;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_66> AgradDistributionsScaledInvChiSquare_ffv_66;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_67> AgradDistributionsScaledInvChiSquare_ffv_67;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_68> AgradDistributionsScaledInvChiSquare_ffv_68;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_69> AgradDistributionsScaledInvChiSquare_ffv_69;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_70> AgradDistributionsScaledInvChiSquare_ffv_70;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_71> AgradDistributionsScaledInvChiSquare_ffv_71;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_72> AgradDistributionsScaledInvChiSquare_ffv_72;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_73> AgradDistributionsScaledInvChiSquare_ffv_73;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_74> AgradDistributionsScaledInvChiSquare_ffv_74;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_75> AgradDistributionsScaledInvChiSquare_ffv_75;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_76> AgradDistributionsScaledInvChiSquare_ffv_76;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_77> AgradDistributionsScaledInvChiSquare_ffv_77;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_78> AgradDistributionsScaledInvChiSquare_ffv_78;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_79> AgradDistributionsScaledInvChiSquare_ffv_79;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_80> AgradDistributionsScaledInvChiSquare_ffv_80;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_81> AgradDistributionsScaledInvChiSquare_ffv_81;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_82> AgradDistributionsScaledInvChiSquare_ffv_82;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_83> AgradDistributionsScaledInvChiSquare_ffv_83;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_84> AgradDistributionsScaledInvChiSquare_ffv_84;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_85> AgradDistributionsScaledInvChiSquare_ffv_85;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_86> AgradDistributionsScaledInvChiSquare_ffv_86;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_87> AgradDistributionsScaledInvChiSquare_ffv_87;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_88> AgradDistributionsScaledInvChiSquare_ffv_88;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_89> AgradDistributionsScaledInvChiSquare_ffv_89;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_90> AgradDistributionsScaledInvChiSquare_ffv_90;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_91> AgradDistributionsScaledInvChiSquare_ffv_91;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_92> AgradDistributionsScaledInvChiSquare_ffv_92;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_93> AgradDistributionsScaledInvChiSquare_ffv_93;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_94> AgradDistributionsScaledInvChiSquare_ffv_94;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_95> AgradDistributionsScaledInvChiSquare_ffv_95;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_96> AgradDistributionsScaledInvChiSquare_ffv_96;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_97> AgradDistributionsScaledInvChiSquare_ffv_97;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_98> AgradDistributionsScaledInvChiSquare_ffv_98;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_99> AgradDistributionsScaledInvChiSquare_ffv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_0, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_1, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_2, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_3, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_4, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_5, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_6, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_7, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_8, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_9, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_10, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_11, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_12, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_13, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_14, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_15, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_16, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_17, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_18, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_19, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_20, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_21, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_22, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_23, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_24, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_25, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_26, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_27, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_28, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_29, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_30, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_31, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_32, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_33, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_34, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_35, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_36, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_37, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_38, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_39, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_40, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_41, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_42, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_43, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_44, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_45, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_46, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_47, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_48, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_49, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_50, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_51, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_52, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_53, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_54, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_55, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_56, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_57, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_58, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_59, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_60, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_61, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_62, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_63, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_64, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_65, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_66, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_67, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_68, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_69, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_70, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_71, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_72, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_73, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_74, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_75, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_76, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_77, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_78, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_79, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_80, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_81, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_82, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_83, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_84, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_85, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_86, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_87, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_88, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_89, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_90, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_91, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_92, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_93, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_94, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_95, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_96, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_97, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_98, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_99, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_99);
+
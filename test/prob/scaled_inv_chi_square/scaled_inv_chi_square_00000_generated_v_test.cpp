@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/scaled_inv_chi_square/scaled_inv_chi_square_test.hpp>
+
+typedef std::tuple<double, double, double, empty, empty, empty> type_v_0;
+typedef std::tuple<double, double, std::vector<double>, empty, empty, empty> type_v_1;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_2;
+typedef std::tuple<double, double, var, empty, empty, empty> type_v_3;
+typedef std::tuple<double, double, std::vector<var>, empty, empty, empty> type_v_4;
+typedef std::tuple<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_5;
+typedef std::tuple<double, std::vector<double>, double, empty, empty, empty> type_v_6;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_7;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_8;
+typedef std::tuple<double, std::vector<double>, var, empty, empty, empty> type_v_9;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_10;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_11;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_12;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_13;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_14;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_15;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_16;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_17;
+typedef std::tuple<double, var, double, empty, empty, empty> type_v_18;
+typedef std::tuple<double, var, std::vector<double>, empty, empty, empty> type_v_19;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_20;
+typedef std::tuple<double, var, var, empty, empty, empty> type_v_21;
+typedef std::tuple<double, var, std::vector<var>, empty, empty, empty> type_v_22;
+typedef std::tuple<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_23;
+typedef std::tuple<double, std::vector<var>, double, empty, empty, empty> type_v_24;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_25;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_26;
+typedef std::tuple<double, std::vector<var>, var, empty, empty, empty> type_v_27;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_28;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_29;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_30;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_31;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_32;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_33;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_34;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_35;
+typedef std::tuple<std::vector<double>, double, double, empty, empty, empty> type_v_36;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, empty, empty, empty> type_v_37;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_38;
+typedef std::tuple<std::vector<double>, double, var, empty, empty, empty> type_v_39;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, empty, empty, empty> type_v_40;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_41;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, empty, empty, empty> type_v_42;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_43;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_44;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, empty, empty, empty> type_v_45;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_46;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_47;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_48;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_49;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_50;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_51;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_52;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_53;
+typedef std::tuple<std::vector<double>, var, double, empty, empty, empty> type_v_54;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, empty, empty, empty> type_v_55;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_56;
+typedef std::tuple<std::vector<double>, var, var, empty, empty, empty> type_v_57;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, empty, empty, empty> type_v_58;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_59;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, empty, empty, empty> type_v_60;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_61;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_62;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, empty, empty, empty> type_v_63;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_64;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_65;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_66;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_67;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_68;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_69;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_70;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_v_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_v_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_v_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_v_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_v_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_80;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_v_81;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_82;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_83;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_84;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_85;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_86;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_87;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_88;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_89;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_v_90;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_v_91;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_92;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_v_93;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_v_94;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_95;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_v_96;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_97;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_98;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_v_99;
+
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_0> AgradDistributionsScaledInvChiSquare_v_0;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_1> AgradDistributionsScaledInvChiSquare_v_1;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_2> AgradDistributionsScaledInvChiSquare_v_2;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_3> AgradDistributionsScaledInvChiSquare_v_3;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_4> AgradDistributionsScaledInvChiSquare_v_4;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_5> AgradDistributionsScaledInvChiSquare_v_5;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_6> AgradDistributionsScaledInvChiSquare_v_6;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_7> AgradDistributionsScaledInvChiSquare_v_7;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_8> AgradDistributionsScaledInvChiSquare_v_8;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_9> AgradDistributionsScaledInvChiSquare_v_9;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_10> AgradDistributionsScaledInvChiSquare_v_10;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_11> AgradDistributionsScaledInvChiSquare_v_11;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_12> AgradDistributionsScaledInvChiSquare_v_12;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_13> AgradDistributionsScaledInvChiSquare_v_13;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_14> AgradDistributionsScaledInvChiSquare_v_14;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_15> AgradDistributionsScaledInvChiSquare_v_15;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_16> AgradDistributionsScaledInvChiSquare_v_16;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_17> AgradDistributionsScaledInvChiSquare_v_17;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_18> AgradDistributionsScaledInvChiSquare_v_18;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_19> AgradDistributionsScaledInvChiSquare_v_19;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_20> AgradDistributionsScaledInvChiSquare_v_20;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_21> AgradDistributionsScaledInvChiSquare_v_21;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_22> AgradDistributionsScaledInvChiSquare_v_22;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_23> AgradDistributionsScaledInvChiSquare_v_23;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_24> AgradDistributionsScaledInvChiSquare_v_24;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_25> AgradDistributionsScaledInvChiSquare_v_25;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_26> AgradDistributionsScaledInvChiSquare_v_26;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_27> AgradDistributionsScaledInvChiSquare_v_27;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_28> AgradDistributionsScaledInvChiSquare_v_28;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_29> AgradDistributionsScaledInvChiSquare_v_29;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_30> AgradDistributionsScaledInvChiSquare_v_30;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_31> AgradDistributionsScaledInvChiSquare_v_31;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_32> AgradDistributionsScaledInvChiSquare_v_32;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_33> AgradDistributionsScaledInvChiSquare_v_33;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_34> AgradDistributionsScaledInvChiSquare_v_34;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_35> AgradDistributionsScaledInvChiSquare_v_35;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_36> AgradDistributionsScaledInvChiSquare_v_36;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_37> AgradDistributionsScaledInvChiSquare_v_37;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_38> AgradDistributionsScaledInvChiSquare_v_38;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_39> AgradDistributionsScaledInvChiSquare_v_39;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_40> AgradDistributionsScaledInvChiSquare_v_40;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_41> AgradDistributionsScaledInvChiSquare_v_41;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_42> AgradDistributionsScaledInvChiSquare_v_42;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_43> AgradDistributionsScaledInvChiSquare_v_43;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_44> AgradDistributionsScaledInvChiSquare_v_44;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_45> AgradDistributionsScaledInvChiSquare_v_45;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_46> AgradDistributionsScaledInvChiSquare_v_46;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_47> AgradDistributionsScaledInvChiSquare_v_47;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_48> AgradDistributionsScaledInvChiSquare_v_48;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_49> AgradDistributionsScaledInvChiSquare_v_49;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_50> AgradDistributionsScaledInvChiSquare_v_50;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_51> AgradDistributionsScaledInvChiSquare_v_51;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_52> AgradDistributionsScaledInvChiSquare_v_52;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_53> AgradDistributionsScaledInvChiSquare_v_53;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_54> AgradDistributionsScaledInvChiSquare_v_54;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_55> AgradDistributionsScaledInvChiSquare_v_55;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_56> AgradDistributionsScaledInvChiSquare_v_56;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_57> AgradDistributionsScaledInvChiSquare_v_57;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_58> AgradDistributionsScaledInvChiSquare_v_58;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_59> AgradDistributionsScaledInvChiSquare_v_59;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_60> AgradDistributionsScaledInvChiSquare_v_60;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_61> AgradDistributionsScaledInvChiSquare_v_61;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_62> AgradDistributionsScaledInvChiSquare_v_62;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_63> AgradDistributionsScaledInvChiSquare_v_63;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_64> AgradDistributionsScaledInvChiSquare_v_64;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_65> AgradDistributionsScaledInvChiSquare_v_65;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_66> AgradDistributionsScaledInvChiSquare_v_66;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_67> AgradDistributionsScaledInvChiSquare_v_67;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_68> AgradDistributionsScaledInvChiSquare_v_68;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_69> AgradDistributionsScaledInvChiSquare_v_69;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_70> AgradDistributionsScaledInvChiSquare_v_70;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_71> AgradDistributionsScaledInvChiSquare_v_71;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_72> AgradDistributionsScaledInvChiSquare_v_72;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_73> AgradDistributionsScaledInvChiSquare_v_73;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_74> AgradDistributionsScaledInvChiSquare_v_74;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_75> AgradDistributionsScaledInvChiSquare_v_75;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_76> AgradDistributionsScaledInvChiSquare_v_76;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_77> AgradDistributionsScaledInvChiSquare_v_77;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_78> AgradDistributionsScaledInvChiSquare_v_78;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_79> AgradDistributionsScaledInvChiSquare_v_79;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_80> AgradDistributionsScaledInvChiSquare_v_80;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_81> AgradDistributionsScaledInvChiSquare_v_81;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_82> AgradDistributionsScaledInvChiSquare_v_82;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_83> AgradDistributionsScaledInvChiSquare_v_83;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_84> AgradDistributionsScaledInvChiSquare_v_84;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_85> AgradDistributionsScaledInvChiSquare_v_85;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_86> AgradDistributionsScaledInvChiSquare_v_86;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_87> AgradDistributionsScaledInvChiSquare_v_87;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_88> AgradDistributionsScaledInvChiSquare_v_88;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_89> AgradDistributionsScaledInvChiSquare_v_89;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_90> AgradDistributionsScaledInvChiSquare_v_90;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_91> AgradDistributionsScaledInvChiSquare_v_91;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_92> AgradDistributionsScaledInvChiSquare_v_92;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_93> AgradDistributionsScaledInvChiSquare_v_93;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_94> AgradDistributionsScaledInvChiSquare_v_94;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_95> AgradDistributionsScaledInvChiSquare_v_95;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_96> AgradDistributionsScaledInvChiSquare_v_96;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_97> AgradDistributionsScaledInvChiSquare_v_97;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_98> AgradDistributionsScaledInvChiSquare_v_98;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_99> AgradDistributionsScaledInvChiSquare_v_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_0, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_1, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_2, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_3, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_4, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_5, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_6, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_7, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_8, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_9, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_10, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_11, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_12, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_13, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_14, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_15, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_16, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_17, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_18, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_19, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_20, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_21, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_22, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_23, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_24, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_25, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_26, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_27, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_28, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_29, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_30, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_31, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_32, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_33, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_34, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_35, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_36, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_37, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_38, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_39, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_40, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_41, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_42, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_43, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_44, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_45, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_46, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_47, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_48, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_49, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_50, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_51, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_52, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_53, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_54, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_55, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_56, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_57, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_58, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_59, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_60, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_61, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_62, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_63, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_64, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_65, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_66, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_67, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_68, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_69, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_70, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_71, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_72, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_73, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_74, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_75, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_76, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_77, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_78, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_79, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_80, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_81, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_82, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_83, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_84, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_85, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_86, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_87, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_88, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_89, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_90, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_91, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_92, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_93, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_94, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_95, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_96, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_97, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_98, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_99, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_99);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/scaled_inv_chi_square/scaled_inv_chi_square_test.hpp>
+
+typedef std::tuple<double, double, var, empty, empty, empty> type_vv_0;
+typedef std::tuple<double, double, std::vector<var>, empty, empty, empty> type_vv_1;
+typedef std::tuple<double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_2;
+typedef std::tuple<double, std::vector<double>, var, empty, empty, empty> type_vv_3;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_4;
+typedef std::tuple<double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_5;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_6;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_7;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_8;
+typedef std::tuple<double, var, double, empty, empty, empty> type_vv_9;
+typedef std::tuple<double, var, std::vector<double>, empty, empty, empty> type_vv_10;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_11;
+typedef std::tuple<double, var, var, empty, empty, empty> type_vv_12;
+typedef std::tuple<double, var, std::vector<var>, empty, empty, empty> type_vv_13;
+typedef std::tuple<double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_14;
+typedef std::tuple<double, std::vector<var>, double, empty, empty, empty> type_vv_15;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_16;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_17;
+typedef std::tuple<double, std::vector<var>, var, empty, empty, empty> type_vv_18;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_19;
+typedef std::tuple<double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_20;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_21;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_22;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_23;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_24;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_25;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_26;
+typedef std::tuple<std::vector<double>, double, var, empty, empty, empty> type_vv_27;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, empty, empty, empty> type_vv_28;
+typedef std::tuple<std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_29;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, empty, empty, empty> type_vv_30;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_31;
+typedef std::tuple<std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_32;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_33;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_34;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_35;
+typedef std::tuple<std::vector<double>, var, double, empty, empty, empty> type_vv_36;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, empty, empty, empty> type_vv_37;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_38;
+typedef std::tuple<std::vector<double>, var, var, empty, empty, empty> type_vv_39;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, empty, empty, empty> type_vv_40;
+typedef std::tuple<std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_41;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, empty, empty, empty> type_vv_42;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_43;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_44;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, empty, empty, empty> type_vv_45;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_46;
+typedef std::tuple<std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_47;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_48;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_49;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_50;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_51;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_52;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_53;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_vv_54;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_vv_55;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_56;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_vv_57;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_58;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_59;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_60;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_61;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_62;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_vv_63;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_vv_64;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_65;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_vv_66;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_vv_67;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_68;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_vv_69;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_70;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_vv_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_80;
+typedef std::tuple<var, double, double, empty, empty, empty> type_vv_81;
+typedef std::tuple<var, double, std::vector<double>, empty, empty, empty> type_vv_82;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_83;
+typedef std::tuple<var, double, var, empty, empty, empty> type_vv_84;
+typedef std::tuple<var, double, std::vector<var>, empty, empty, empty> type_vv_85;
+typedef std::tuple<var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_86;
+typedef std::tuple<var, std::vector<double>, double, empty, empty, empty> type_vv_87;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_88;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_89;
+typedef std::tuple<var, std::vector<double>, var, empty, empty, empty> type_vv_90;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_91;
+typedef std::tuple<var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_92;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_93;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_94;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_95;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_96;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_97;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_98;
+typedef std::tuple<var, var, double, empty, empty, empty> type_vv_99;
+
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_0> AgradDistributionsScaledInvChiSquare_vv_0;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_1> AgradDistributionsScaledInvChiSquare_vv_1;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_2> AgradDistributionsScaledInvChiSquare_vv_2;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_3> AgradDistributionsScaledInvChiSquare_vv_3;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_4> AgradDistributionsScaledInvChiSquare_vv_4;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_5> AgradDistributionsScaledInvChiSquare_vv_5;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_6> AgradDistributionsScaledInvChiSquare_vv_6;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_7> AgradDistributionsScaledInvChiSquare_vv_7;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_8> AgradDistributionsScaledInvChiSquare_vv_8;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_9> AgradDistributionsScaledInvChiSquare_vv_9;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_10> AgradDistributionsScaledInvChiSquare_vv_10;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_11> AgradDistributionsScaledInvChiSquare_vv_11;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_12> AgradDistributionsScaledInvChiSquare_vv_12;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_13> AgradDistributionsScaledInvChiSquare_vv_13;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_14> AgradDistributionsScaledInvChiSquare_vv_14;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_15> AgradDistributionsScaledInvChiSquare_vv_15;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_16> AgradDistributionsScaledInvChiSquare_vv_16;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_17> AgradDistributionsScaledInvChiSquare_vv_17;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_18> AgradDistributionsScaledInvChiSquare_vv_18;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_19> AgradDistributionsScaledInvChiSquare_vv_19;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_20> AgradDistributionsScaledInvChiSquare_vv_20;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_21> AgradDistributionsScaledInvChiSquare_vv_21;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_22> AgradDistributionsScaledInvChiSquare_vv_22;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_23> AgradDistributionsScaledInvChiSquare_vv_23;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_24> AgradDistributionsScaledInvChiSquare_vv_24;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_25> AgradDistributionsScaledInvChiSquare_vv_25;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_26> AgradDistributionsScaledInvChiSquare_vv_26;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_27> AgradDistributionsScaledInvChiSquare_vv_27;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_28> AgradDistributionsScaledInvChiSquare_vv_28;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_29> AgradDistributionsScaledInvChiSquare_vv_29;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_30> AgradDistributionsScaledInvChiSquare_vv_30;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_31> AgradDistributionsScaledInvChiSquare_vv_31;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_32> AgradDistributionsScaledInvChiSquare_vv_32;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_33> AgradDistributionsScaledInvChiSquare_vv_33;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_34> AgradDistributionsScaledInvChiSquare_vv_34;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_35> AgradDistributionsScaledInvChiSquare_vv_35;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_36> AgradDistributionsScaledInvChiSquare_vv_36;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_37> AgradDistributionsScaledInvChiSquare_vv_37;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_38> AgradDistributionsScaledInvChiSquare_vv_38;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_39> AgradDistributionsScaledInvChiSquare_vv_39;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_40> AgradDistributionsScaledInvChiSquare_vv_40;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_41> AgradDistributionsScaledInvChiSquare_vv_41;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_42> AgradDistributionsScaledInvChiSquare_vv_42;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_43> AgradDistributionsScaledInvChiSquare_vv_43;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_44> AgradDistributionsScaledInvChiSquare_vv_44;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_45> AgradDistributionsScaledInvChiSquare_vv_45;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_46> AgradDistributionsScaledInvChiSquare_vv_46;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_47> AgradDistributionsScaledInvChiSquare_vv_47;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_48> AgradDistributionsScaledInvChiSquare_vv_48;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_49> AgradDistributionsScaledInvChiSquare_vv_49;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_50> AgradDistributionsScaledInvChiSquare_vv_50;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_51> AgradDistributionsScaledInvChiSquare_vv_51;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_52> AgradDistributionsScaledInvChiSquare_vv_52;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_53> AgradDistributionsScaledInvChiSquare_vv_53;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_54> AgradDistributionsScaledInvChiSquare_vv_54;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_55> AgradDistributionsScaledInvChiSquare_vv_55;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_56> AgradDistributionsScaledInvChiSquare_vv_56;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_57> AgradDistributionsScaledInvChiSquare_vv_57;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_58> AgradDistributionsScaledInvChiSquare_vv_58;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_59> AgradDistributionsScaledInvChiSquare_vv_59;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_60> AgradDistributionsScaledInvChiSquare_vv_60;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_61> AgradDistributionsScaledInvChiSquare_vv_61;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_62> AgradDistributionsScaledInvChiSquare_vv_62;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_63> AgradDistributionsScaledInvChiSquare_vv_63;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_64> AgradDistributionsScaledInvChiSquare_vv_64;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_65> AgradDistributionsScaledInvChiSquare_vv_65;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_66> AgradDistributionsScaledInvChiSquare_vv_66;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_67> AgradDistributionsScaledInvChiSquare_vv_67;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_68> AgradDistributionsScaledInvChiSquare_vv_68;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_69> AgradDistributionsScaledInvChiSquare_vv_69;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_70> AgradDistributionsScaledInvChiSquare_vv_70;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_71> AgradDistributionsScaledInvChiSquare_vv_71;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_72> AgradDistributionsScaledInvChiSquare_vv_72;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_73> AgradDistributionsScaledInvChiSquare_vv_73;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_74> AgradDistributionsScaledInvChiSquare_vv_74;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_75> AgradDistributionsScaledInvChiSquare_vv_75;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_76> AgradDistributionsScaledInvChiSquare_vv_76;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_77> AgradDistributionsScaledInvChiSquare_vv_77;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_78> AgradDistributionsScaledInvChiSquare_vv_78;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_79> AgradDistributionsScaledInvChiSquare_vv_79;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_80> AgradDistributionsScaledInvChiSquare_vv_80;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_81> AgradDistributionsScaledInvChiSquare_vv_81;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_82> AgradDistributionsScaledInvChiSquare_vv_82;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_83> AgradDistributionsScaledInvChiSquare_vv_83;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_84> AgradDistributionsScaledInvChiSquare_vv_84;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_85> AgradDistributionsScaledInvChiSquare_vv_85;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_86> AgradDistributionsScaledInvChiSquare_vv_86;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_87> AgradDistributionsScaledInvChiSquare_vv_87;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_88> AgradDistributionsScaledInvChiSquare_vv_88;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_89> AgradDistributionsScaledInvChiSquare_vv_89;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_90> AgradDistributionsScaledInvChiSquare_vv_90;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_91> AgradDistributionsScaledInvChiSquare_vv_91;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_92> AgradDistributionsScaledInvChiSquare_vv_92;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_93> AgradDistributionsScaledInvChiSquare_vv_93;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_94> AgradDistributionsScaledInvChiSquare_vv_94;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_95> AgradDistributionsScaledInvChiSquare_vv_95;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_96> AgradDistributionsScaledInvChiSquare_vv_96;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_97> AgradDistributionsScaledInvChiSquare_vv_97;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_98> AgradDistributionsScaledInvChiSquare_vv_98;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_99> AgradDistributionsScaledInvChiSquare_vv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_0, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_1, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_2, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_3, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_4, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_5, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_6, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_7, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_8, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_9, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_10, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_11, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_12, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_13, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_14, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_15, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_16, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_17, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_18, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_19, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_20, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_21, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_22, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_23, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_24, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_25, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_26, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_27, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_28, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_29, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_30, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_31, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_32, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_33, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_34, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_35, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_36, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_37, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_38, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_39, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_40, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_41, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_42, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_43, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_44, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_45, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_46, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_47, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_48, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_49, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_50, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_51, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_52, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_53, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_54, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_55, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_56, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_57, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_58, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_59, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_60, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_61, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_62, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_63, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_64, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_65, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_66, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_67, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_68, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_69, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_70, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_71, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_72, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_73, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_74, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_75, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_76, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_77, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_78, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_79, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_80, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_81, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_82, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_83, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_84, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_85, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_86, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_87, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_88, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_89, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_90, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_91, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_92, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_93, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_94, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_95, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_96, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_97, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_98, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_99, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_99);
+
@@ -0,0 +1,278 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/scaled_inv_chi_square/scaled_inv_chi_square_test.hpp>
+
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_100;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_101;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_102;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_103;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_104;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_105;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_106;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_107;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_108;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_109;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_110;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_111;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_112;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_113;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_114;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_115;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_116;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, double, empty, empty, empty> type_ffv_117;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty, empty, empty> type_ffv_118;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_119;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_120;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_121;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_122;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty, empty, empty> type_ffv_123;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_124;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_125;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_126;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_127;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_128;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_129;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_130;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_131;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_132;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_133;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_134;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_135;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_136;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_137;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_138;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_139;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_140;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_141;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_142;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_143;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_144;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_145;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_146;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_147;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_148;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_149;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_150;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_151;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_152;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_ffv_153;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_ffv_154;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_155;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_156;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_157;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_158;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_ffv_159;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_160;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_161;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_162;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_163;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_164;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_165;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_166;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_167;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_168;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_169;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_170;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_171;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_172;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_173;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_174;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_175;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_176;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_177;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_178;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_179;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_180;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_181;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_182;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_183;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_184;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_185;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_186;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_187;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_188;
+
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_100> AgradDistributionsScaledInvChiSquare_ffv_100;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_101> AgradDistributionsScaledInvChiSquare_ffv_101;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_102> AgradDistributionsScaledInvChiSquare_ffv_102;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_103> AgradDistributionsScaledInvChiSquare_ffv_103;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_104> AgradDistributionsScaledInvChiSquare_ffv_104;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_105> AgradDistributionsScaledInvChiSquare_ffv_105;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_106> AgradDistributionsScaledInvChiSquare_ffv_106;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_107> AgradDistributionsScaledInvChiSquare_ffv_107;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_108> AgradDistributionsScaledInvChiSquare_ffv_108;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_109> AgradDistributionsScaledInvChiSquare_ffv_109;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_110> AgradDistributionsScaledInvChiSquare_ffv_110;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_111> AgradDistributionsScaledInvChiSquare_ffv_111;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_112> AgradDistributionsScaledInvChiSquare_ffv_112;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_113> AgradDistributionsScaledInvChiSquare_ffv_113;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_114> AgradDistributionsScaledInvChiSquare_ffv_114;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_115> AgradDistributionsScaledInvChiSquare_ffv_115;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_116> AgradDistributionsScaledInvChiSquare_ffv_116;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_117> AgradDistributionsScaledInvChiSquare_ffv_117;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_118> AgradDistributionsScaledInvChiSquare_ffv_118;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_119> AgradDistributionsScaledInvChiSquare_ffv_119;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_120> AgradDistributionsScaledInvChiSquare_ffv_120;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_121> AgradDistributionsScaledInvChiSquare_ffv_121;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_122> AgradDistributionsScaledInvChiSquare_ffv_122;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_123> AgradDistributionsScaledInvChiSquare_ffv_123;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_124> AgradDistributionsScaledInvChiSquare_ffv_124;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_125> AgradDistributionsScaledInvChiSquare_ffv_125;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_126> AgradDistributionsScaledInvChiSquare_ffv_126;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_127> AgradDistributionsScaledInvChiSquare_ffv_127;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_128> AgradDistributionsScaledInvChiSquare_ffv_128;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_129> AgradDistributionsScaledInvChiSquare_ffv_129;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_130> AgradDistributionsScaledInvChiSquare_ffv_130;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_131> AgradDistributionsScaledInvChiSquare_ffv_131;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_132> AgradDistributionsScaledInvChiSquare_ffv_132;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_133> AgradDistributionsScaledInvChiSquare_ffv_133;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_134> AgradDistributionsScaledInvChiSquare_ffv_134;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_135> AgradDistributionsScaledInvChiSquare_ffv_135;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_136> AgradDistributionsScaledInvChiSquare_ffv_136;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_137> AgradDistributionsScaledInvChiSquare_ffv_137;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_138> AgradDistributionsScaledInvChiSquare_ffv_138;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_139> AgradDistributionsScaledInvChiSquare_ffv_139;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_140> AgradDistributionsScaledInvChiSquare_ffv_140;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_141> AgradDistributionsScaledInvChiSquare_ffv_141;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_142> AgradDistributionsScaledInvChiSquare_ffv_142;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_143> AgradDistributionsScaledInvChiSquare_ffv_143;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_144> AgradDistributionsScaledInvChiSquare_ffv_144;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_145> AgradDistributionsScaledInvChiSquare_ffv_145;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_146> AgradDistributionsScaledInvChiSquare_ffv_146;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_147> AgradDistributionsScaledInvChiSquare_ffv_147;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_148> AgradDistributionsScaledInvChiSquare_ffv_148;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_149> AgradDistributionsScaledInvChiSquare_ffv_149;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_150> AgradDistributionsScaledInvChiSquare_ffv_150;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_151> AgradDistributionsScaledInvChiSquare_ffv_151;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_152> AgradDistributionsScaledInvChiSquare_ffv_152;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_153> AgradDistributionsScaledInvChiSquare_ffv_153;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_154> AgradDistributionsScaledInvChiSquare_ffv_154;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_155> AgradDistributionsScaledInvChiSquare_ffv_155;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_156> AgradDistributionsScaledInvChiSquare_ffv_156;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_157> AgradDistributionsScaledInvChiSquare_ffv_157;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_158> AgradDistributionsScaledInvChiSquare_ffv_158;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_159> AgradDistributionsScaledInvChiSquare_ffv_159;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_160> AgradDistributionsScaledInvChiSquare_ffv_160;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_161> AgradDistributionsScaledInvChiSquare_ffv_161;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_162> AgradDistributionsScaledInvChiSquare_ffv_162;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_163> AgradDistributionsScaledInvChiSquare_ffv_163;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_164> AgradDistributionsScaledInvChiSquare_ffv_164;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_165> AgradDistributionsScaledInvChiSquare_ffv_165;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_166> AgradDistributionsScaledInvChiSquare_ffv_166;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_167> AgradDistributionsScaledInvChiSquare_ffv_167;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_168> AgradDistributionsScaledInvChiSquare_ffv_168;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_169> AgradDistributionsScaledInvChiSquare_ffv_169;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_170> AgradDistributionsScaledInvChiSquare_ffv_170;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_171> AgradDistributionsScaledInvChiSquare_ffv_171;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_172> AgradDistributionsScaledInvChiSquare_ffv_172;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_173> AgradDistributionsScaledInvChiSquare_ffv_173;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_174> AgradDistributionsScaledInvChiSquare_ffv_174;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_175> AgradDistributionsScaledInvChiSquare_ffv_175;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_176> AgradDistributionsScaledInvChiSquare_ffv_176;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_177> AgradDistributionsScaledInvChiSquare_ffv_177;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_178> AgradDistributionsScaledInvChiSquare_ffv_178;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_179> AgradDistributionsScaledInvChiSquare_ffv_179;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_180> AgradDistributionsScaledInvChiSquare_ffv_180;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_181> AgradDistributionsScaledInvChiSquare_ffv_181;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_182> AgradDistributionsScaledInvChiSquare_ffv_182;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_183> AgradDistributionsScaledInvChiSquare_ffv_183;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_184> AgradDistributionsScaledInvChiSquare_ffv_184;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_185> AgradDistributionsScaledInvChiSquare_ffv_185;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_186> AgradDistributionsScaledInvChiSquare_ffv_186;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_187> AgradDistributionsScaledInvChiSquare_ffv_187;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_ffv_188> AgradDistributionsScaledInvChiSquare_ffv_188;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_100, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_101, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_102, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_103, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_104, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_105, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_106, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_107, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_108, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_109, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_110, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_111, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_112, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_113, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_114, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_115, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_116, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_117, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_118, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_119, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_120, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_121, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_122, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_123, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_124, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_125, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_126, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_127, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_128, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_129, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_130, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_131, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_132, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_133, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_134, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_135, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_136, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_137, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_138, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_139, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_140, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_141, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_142, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_143, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_144, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_145, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_146, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_147, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_148, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_149, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_150, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_151, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_152, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_153, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_154, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_155, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_156, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_157, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_158, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_159, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_160, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_161, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_162, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_163, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_164, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_165, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_166, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_167, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_168, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_169, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_170, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_171, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_172, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_173, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_174, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_175, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_176, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_177, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_178, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_179, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_180, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_181, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_182, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_183, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_184, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_185, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_186, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_187, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_ffv_188, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_ffv_188);
+
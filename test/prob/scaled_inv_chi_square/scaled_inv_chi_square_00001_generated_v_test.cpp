@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/scaled_inv_chi_square/scaled_inv_chi_square_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_100;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_101;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_102;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_103;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_104;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_105;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_106;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_107;
+typedef std::tuple<var, double, double, empty, empty, empty> type_v_108;
+typedef std::tuple<var, double, std::vector<double>, empty, empty, empty> type_v_109;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_110;
+typedef std::tuple<var, double, var, empty, empty, empty> type_v_111;
+typedef std::tuple<var, double, std::vector<var>, empty, empty, empty> type_v_112;
+typedef std::tuple<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_113;
+typedef std::tuple<var, std::vector<double>, double, empty, empty, empty> type_v_114;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_115;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_116;
+typedef std::tuple<var, std::vector<double>, var, empty, empty, empty> type_v_117;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_118;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_119;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_120;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_121;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_122;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_123;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_124;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_125;
+typedef std::tuple<var, var, double, empty, empty, empty> type_v_126;
+typedef std::tuple<var, var, std::vector<double>, empty, empty, empty> type_v_127;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_128;
+typedef std::tuple<var, var, var, empty, empty, empty> type_v_129;
+typedef std::tuple<var, var, std::vector<var>, empty, empty, empty> type_v_130;
+typedef std::tuple<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_131;
+typedef std::tuple<var, std::vector<var>, double, empty, empty, empty> type_v_132;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_133;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_134;
+typedef std::tuple<var, std::vector<var>, var, empty, empty, empty> type_v_135;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_136;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_137;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_138;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_139;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_140;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_141;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_142;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_143;
+typedef std::tuple<std::vector<var>, double, double, empty, empty, empty> type_v_144;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, empty, empty, empty> type_v_145;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_146;
+typedef std::tuple<std::vector<var>, double, var, empty, empty, empty> type_v_147;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, empty, empty, empty> type_v_148;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_149;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, empty, empty, empty> type_v_150;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_151;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_152;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, empty, empty, empty> type_v_153;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_154;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_155;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_156;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_157;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_158;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_159;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_160;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_161;
+typedef std::tuple<std::vector<var>, var, double, empty, empty, empty> type_v_162;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, empty, empty, empty> type_v_163;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_164;
+typedef std::tuple<std::vector<var>, var, var, empty, empty, empty> type_v_165;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, empty, empty, empty> type_v_166;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_167;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, empty, empty, empty> type_v_168;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_169;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_170;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, empty, empty, empty> type_v_171;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_172;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_173;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_174;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_175;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_176;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_177;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_178;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_179;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_v_180;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_v_181;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_182;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_v_183;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_v_184;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_185;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_v_186;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_187;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_188;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_v_189;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_190;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_191;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_192;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_193;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_194;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_195;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_196;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_197;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_v_198;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_v_199;
+
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_100> AgradDistributionsScaledInvChiSquare_v_100;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_101> AgradDistributionsScaledInvChiSquare_v_101;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_102> AgradDistributionsScaledInvChiSquare_v_102;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_103> AgradDistributionsScaledInvChiSquare_v_103;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_104> AgradDistributionsScaledInvChiSquare_v_104;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_105> AgradDistributionsScaledInvChiSquare_v_105;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_106> AgradDistributionsScaledInvChiSquare_v_106;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_107> AgradDistributionsScaledInvChiSquare_v_107;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_108> AgradDistributionsScaledInvChiSquare_v_108;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_109> AgradDistributionsScaledInvChiSquare_v_109;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_110> AgradDistributionsScaledInvChiSquare_v_110;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_111> AgradDistributionsScaledInvChiSquare_v_111;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_112> AgradDistributionsScaledInvChiSquare_v_112;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_113> AgradDistributionsScaledInvChiSquare_v_113;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_114> AgradDistributionsScaledInvChiSquare_v_114;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_115> AgradDistributionsScaledInvChiSquare_v_115;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_116> AgradDistributionsScaledInvChiSquare_v_116;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_117> AgradDistributionsScaledInvChiSquare_v_117;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_118> AgradDistributionsScaledInvChiSquare_v_118;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_119> AgradDistributionsScaledInvChiSquare_v_119;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_120> AgradDistributionsScaledInvChiSquare_v_120;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_121> AgradDistributionsScaledInvChiSquare_v_121;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_122> AgradDistributionsScaledInvChiSquare_v_122;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_123> AgradDistributionsScaledInvChiSquare_v_123;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_124> AgradDistributionsScaledInvChiSquare_v_124;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_125> AgradDistributionsScaledInvChiSquare_v_125;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_126> AgradDistributionsScaledInvChiSquare_v_126;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_127> AgradDistributionsScaledInvChiSquare_v_127;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_128> AgradDistributionsScaledInvChiSquare_v_128;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_129> AgradDistributionsScaledInvChiSquare_v_129;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_130> AgradDistributionsScaledInvChiSquare_v_130;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_131> AgradDistributionsScaledInvChiSquare_v_131;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_132> AgradDistributionsScaledInvChiSquare_v_132;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_133> AgradDistributionsScaledInvChiSquare_v_133;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_134> AgradDistributionsScaledInvChiSquare_v_134;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_135> AgradDistributionsScaledInvChiSquare_v_135;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_136> AgradDistributionsScaledInvChiSquare_v_136;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_137> AgradDistributionsScaledInvChiSquare_v_137;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_138> AgradDistributionsScaledInvChiSquare_v_138;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_139> AgradDistributionsScaledInvChiSquare_v_139;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_140> AgradDistributionsScaledInvChiSquare_v_140;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_141> AgradDistributionsScaledInvChiSquare_v_141;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_142> AgradDistributionsScaledInvChiSquare_v_142;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_143> AgradDistributionsScaledInvChiSquare_v_143;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_144> AgradDistributionsScaledInvChiSquare_v_144;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_145> AgradDistributionsScaledInvChiSquare_v_145;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_146> AgradDistributionsScaledInvChiSquare_v_146;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_147> AgradDistributionsScaledInvChiSquare_v_147;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_148> AgradDistributionsScaledInvChiSquare_v_148;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_149> AgradDistributionsScaledInvChiSquare_v_149;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_150> AgradDistributionsScaledInvChiSquare_v_150;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_151> AgradDistributionsScaledInvChiSquare_v_151;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_152> AgradDistributionsScaledInvChiSquare_v_152;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_153> AgradDistributionsScaledInvChiSquare_v_153;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_154> AgradDistributionsScaledInvChiSquare_v_154;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_155> AgradDistributionsScaledInvChiSquare_v_155;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_156> AgradDistributionsScaledInvChiSquare_v_156;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_157> AgradDistributionsScaledInvChiSquare_v_157;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_158> AgradDistributionsScaledInvChiSquare_v_158;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_159> AgradDistributionsScaledInvChiSquare_v_159;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_160> AgradDistributionsScaledInvChiSquare_v_160;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_161> AgradDistributionsScaledInvChiSquare_v_161;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_162> AgradDistributionsScaledInvChiSquare_v_162;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_163> AgradDistributionsScaledInvChiSquare_v_163;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_164> AgradDistributionsScaledInvChiSquare_v_164;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_165> AgradDistributionsScaledInvChiSquare_v_165;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_166> AgradDistributionsScaledInvChiSquare_v_166;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_167> AgradDistributionsScaledInvChiSquare_v_167;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_168> AgradDistributionsScaledInvChiSquare_v_168;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_169> AgradDistributionsScaledInvChiSquare_v_169;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_170> AgradDistributionsScaledInvChiSquare_v_170;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_171> AgradDistributionsScaledInvChiSquare_v_171;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_172> AgradDistributionsScaledInvChiSquare_v_172;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_173> AgradDistributionsScaledInvChiSquare_v_173;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_174> AgradDistributionsScaledInvChiSquare_v_174;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_175> AgradDistributionsScaledInvChiSquare_v_175;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_176> AgradDistributionsScaledInvChiSquare_v_176;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_177> AgradDistributionsScaledInvChiSquare_v_177;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_178> AgradDistributionsScaledInvChiSquare_v_178;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_179> AgradDistributionsScaledInvChiSquare_v_179;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_180> AgradDistributionsScaledInvChiSquare_v_180;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_181> AgradDistributionsScaledInvChiSquare_v_181;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_182> AgradDistributionsScaledInvChiSquare_v_182;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_183> AgradDistributionsScaledInvChiSquare_v_183;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_184> AgradDistributionsScaledInvChiSquare_v_184;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_185> AgradDistributionsScaledInvChiSquare_v_185;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_186> AgradDistributionsScaledInvChiSquare_v_186;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_187> AgradDistributionsScaledInvChiSquare_v_187;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_188> AgradDistributionsScaledInvChiSquare_v_188;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_189> AgradDistributionsScaledInvChiSquare_v_189;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_190> AgradDistributionsScaledInvChiSquare_v_190;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_191> AgradDistributionsScaledInvChiSquare_v_191;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_192> AgradDistributionsScaledInvChiSquare_v_192;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_193> AgradDistributionsScaledInvChiSquare_v_193;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_194> AgradDistributionsScaledInvChiSquare_v_194;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_195> AgradDistributionsScaledInvChiSquare_v_195;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_196> AgradDistributionsScaledInvChiSquare_v_196;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_197> AgradDistributionsScaledInvChiSquare_v_197;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_198> AgradDistributionsScaledInvChiSquare_v_198;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_v_199> AgradDistributionsScaledInvChiSquare_v_199;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_100, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_101, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_102, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_103, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_104, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_105, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_106, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_107, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_108, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_109, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_110, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_111, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_112, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_113, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_114, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_115, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_116, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_117, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_118, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_119, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_120, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_121, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_122, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_123, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_124, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_125, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_126, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_127, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_128, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_129, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_130, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_131, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_132, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_133, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_134, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_135, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_136, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_137, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_138, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_139, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_140, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_141, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_142, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_143, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_144, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_145, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_146, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_147, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_148, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_149, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_150, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_151, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_152, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_153, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_154, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_155, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_156, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_157, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_158, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_159, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_160, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_161, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_162, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_163, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_164, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_165, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_166, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_167, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_168, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_169, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_170, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_171, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_172, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_173, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_174, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_175, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_176, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_177, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_178, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_179, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_180, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_181, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_182, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_183, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_184, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_185, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_186, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_187, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_188, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_188);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_189, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_189);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_190, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_190);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_191, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_191);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_192, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_192);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_193, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_193);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_194, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_194);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_195, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_195);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_196, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_196);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_197, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_197);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_198, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_198);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_v_199, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_v_199);
+
@@ -0,0 +1,278 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/scaled_inv_chi_square/scaled_inv_chi_square_test.hpp>
+
+typedef std::tuple<var, var, std::vector<double>, empty, empty, empty> type_vv_100;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_101;
+typedef std::tuple<var, var, var, empty, empty, empty> type_vv_102;
+typedef std::tuple<var, var, std::vector<var>, empty, empty, empty> type_vv_103;
+typedef std::tuple<var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_104;
+typedef std::tuple<var, std::vector<var>, double, empty, empty, empty> type_vv_105;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_106;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_107;
+typedef std::tuple<var, std::vector<var>, var, empty, empty, empty> type_vv_108;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_109;
+typedef std::tuple<var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_110;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_111;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_112;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_113;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_114;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_115;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_116;
+typedef std::tuple<std::vector<var>, double, double, empty, empty, empty> type_vv_117;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, empty, empty, empty> type_vv_118;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_119;
+typedef std::tuple<std::vector<var>, double, var, empty, empty, empty> type_vv_120;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, empty, empty, empty> type_vv_121;
+typedef std::tuple<std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_122;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, empty, empty, empty> type_vv_123;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_124;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_125;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, empty, empty, empty> type_vv_126;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_127;
+typedef std::tuple<std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_128;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_129;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_130;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_131;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_132;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_133;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_134;
+typedef std::tuple<std::vector<var>, var, double, empty, empty, empty> type_vv_135;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, empty, empty, empty> type_vv_136;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_137;
+typedef std::tuple<std::vector<var>, var, var, empty, empty, empty> type_vv_138;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, empty, empty, empty> type_vv_139;
+typedef std::tuple<std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_140;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, empty, empty, empty> type_vv_141;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_142;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_143;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, empty, empty, empty> type_vv_144;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_145;
+typedef std::tuple<std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_146;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_147;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_148;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_149;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_150;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_151;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_152;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, empty, empty, empty> type_vv_153;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, empty, empty, empty> type_vv_154;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_155;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, empty, empty, empty> type_vv_156;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, empty, empty, empty> type_vv_157;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_158;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, empty, empty, empty> type_vv_159;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_160;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_161;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, empty, empty, empty> type_vv_162;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_163;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_164;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_165;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_166;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_167;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_168;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_169;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_170;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, empty, empty, empty> type_vv_171;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, empty, empty, empty> type_vv_172;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_173;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, empty, empty, empty> type_vv_174;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, empty, empty, empty> type_vv_175;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_176;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, empty, empty, empty> type_vv_177;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_178;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_179;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, empty, empty, empty> type_vv_180;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_181;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_182;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_183;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_184;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_185;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_186;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_187;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_188;
+
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_100> AgradDistributionsScaledInvChiSquare_vv_100;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_101> AgradDistributionsScaledInvChiSquare_vv_101;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_102> AgradDistributionsScaledInvChiSquare_vv_102;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_103> AgradDistributionsScaledInvChiSquare_vv_103;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_104> AgradDistributionsScaledInvChiSquare_vv_104;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_105> AgradDistributionsScaledInvChiSquare_vv_105;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_106> AgradDistributionsScaledInvChiSquare_vv_106;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_107> AgradDistributionsScaledInvChiSquare_vv_107;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_108> AgradDistributionsScaledInvChiSquare_vv_108;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_109> AgradDistributionsScaledInvChiSquare_vv_109;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_110> AgradDistributionsScaledInvChiSquare_vv_110;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_111> AgradDistributionsScaledInvChiSquare_vv_111;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_112> AgradDistributionsScaledInvChiSquare_vv_112;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_113> AgradDistributionsScaledInvChiSquare_vv_113;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_114> AgradDistributionsScaledInvChiSquare_vv_114;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_115> AgradDistributionsScaledInvChiSquare_vv_115;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_116> AgradDistributionsScaledInvChiSquare_vv_116;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_117> AgradDistributionsScaledInvChiSquare_vv_117;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_118> AgradDistributionsScaledInvChiSquare_vv_118;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_119> AgradDistributionsScaledInvChiSquare_vv_119;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_120> AgradDistributionsScaledInvChiSquare_vv_120;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_121> AgradDistributionsScaledInvChiSquare_vv_121;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_122> AgradDistributionsScaledInvChiSquare_vv_122;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_123> AgradDistributionsScaledInvChiSquare_vv_123;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_124> AgradDistributionsScaledInvChiSquare_vv_124;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_125> AgradDistributionsScaledInvChiSquare_vv_125;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_126> AgradDistributionsScaledInvChiSquare_vv_126;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_127> AgradDistributionsScaledInvChiSquare_vv_127;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_128> AgradDistributionsScaledInvChiSquare_vv_128;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_129> AgradDistributionsScaledInvChiSquare_vv_129;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_130> AgradDistributionsScaledInvChiSquare_vv_130;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_131> AgradDistributionsScaledInvChiSquare_vv_131;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_132> AgradDistributionsScaledInvChiSquare_vv_132;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_133> AgradDistributionsScaledInvChiSquare_vv_133;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_134> AgradDistributionsScaledInvChiSquare_vv_134;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_135> AgradDistributionsScaledInvChiSquare_vv_135;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_136> AgradDistributionsScaledInvChiSquare_vv_136;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_137> AgradDistributionsScaledInvChiSquare_vv_137;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_138> AgradDistributionsScaledInvChiSquare_vv_138;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_139> AgradDistributionsScaledInvChiSquare_vv_139;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_140> AgradDistributionsScaledInvChiSquare_vv_140;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_141> AgradDistributionsScaledInvChiSquare_vv_141;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_142> AgradDistributionsScaledInvChiSquare_vv_142;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_143> AgradDistributionsScaledInvChiSquare_vv_143;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_144> AgradDistributionsScaledInvChiSquare_vv_144;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_145> AgradDistributionsScaledInvChiSquare_vv_145;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_146> AgradDistributionsScaledInvChiSquare_vv_146;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_147> AgradDistributionsScaledInvChiSquare_vv_147;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_148> AgradDistributionsScaledInvChiSquare_vv_148;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_149> AgradDistributionsScaledInvChiSquare_vv_149;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_150> AgradDistributionsScaledInvChiSquare_vv_150;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_151> AgradDistributionsScaledInvChiSquare_vv_151;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_152> AgradDistributionsScaledInvChiSquare_vv_152;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_153> AgradDistributionsScaledInvChiSquare_vv_153;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_154> AgradDistributionsScaledInvChiSquare_vv_154;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_155> AgradDistributionsScaledInvChiSquare_vv_155;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_156> AgradDistributionsScaledInvChiSquare_vv_156;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_157> AgradDistributionsScaledInvChiSquare_vv_157;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_158> AgradDistributionsScaledInvChiSquare_vv_158;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_159> AgradDistributionsScaledInvChiSquare_vv_159;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_160> AgradDistributionsScaledInvChiSquare_vv_160;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_161> AgradDistributionsScaledInvChiSquare_vv_161;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_162> AgradDistributionsScaledInvChiSquare_vv_162;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_163> AgradDistributionsScaledInvChiSquare_vv_163;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_164> AgradDistributionsScaledInvChiSquare_vv_164;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_165> AgradDistributionsScaledInvChiSquare_vv_165;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_166> AgradDistributionsScaledInvChiSquare_vv_166;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_167> AgradDistributionsScaledInvChiSquare_vv_167;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_168> AgradDistributionsScaledInvChiSquare_vv_168;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_169> AgradDistributionsScaledInvChiSquare_vv_169;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_170> AgradDistributionsScaledInvChiSquare_vv_170;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_171> AgradDistributionsScaledInvChiSquare_vv_171;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_172> AgradDistributionsScaledInvChiSquare_vv_172;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_173> AgradDistributionsScaledInvChiSquare_vv_173;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_174> AgradDistributionsScaledInvChiSquare_vv_174;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_175> AgradDistributionsScaledInvChiSquare_vv_175;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_176> AgradDistributionsScaledInvChiSquare_vv_176;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_177> AgradDistributionsScaledInvChiSquare_vv_177;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_178> AgradDistributionsScaledInvChiSquare_vv_178;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_179> AgradDistributionsScaledInvChiSquare_vv_179;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_180> AgradDistributionsScaledInvChiSquare_vv_180;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_181> AgradDistributionsScaledInvChiSquare_vv_181;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_182> AgradDistributionsScaledInvChiSquare_vv_182;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_183> AgradDistributionsScaledInvChiSquare_vv_183;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_184> AgradDistributionsScaledInvChiSquare_vv_184;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_185> AgradDistributionsScaledInvChiSquare_vv_185;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_186> AgradDistributionsScaledInvChiSquare_vv_186;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_187> AgradDistributionsScaledInvChiSquare_vv_187;
+typedef std::tuple<AgradDistributionsScaledInvChiSquare, type_vv_188> AgradDistributionsScaledInvChiSquare_vv_188;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_100, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_101, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_102, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_103, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_104, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_105, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_106, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_107, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_108, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_109, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_110, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_111, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_112, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_113, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_114, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_115, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_116, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_117, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_118, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_119, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_120, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_121, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_122, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_123, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_124, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_125, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_126, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_127, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_128, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_129, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_130, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_131, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_132, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_133, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_134, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_135, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_136, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_137, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_138, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_139, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_140, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_141, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_142, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_143, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_144, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_145, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_146, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_147, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_148, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_149, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_150, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_151, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_152, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_153, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_154, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_155, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_156, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_157, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_158, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_159, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_160, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_161, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_162, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_163, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_164, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_165, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_166, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_167, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_168, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_169, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_170, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_171, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_172, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_173, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_174, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_175, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_176, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_177, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_178, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_179, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_180, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_181, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_182, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_183, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_184, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_185, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_186, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_187, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionsScaledInvChiSquare_vv_188, AgradDistributionTestFixture, AgradDistributionsScaledInvChiSquare_vv_188);
+
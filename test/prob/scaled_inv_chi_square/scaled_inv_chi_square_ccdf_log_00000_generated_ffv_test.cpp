@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/scaled_inv_chi_square/scaled_inv_chi_square_ccdf_log_test.hpp>
+
+typedef std::tuple<double, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_0;
+typedef std::tuple<double, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_1;
+typedef std::tuple<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_2;
+typedef std::tuple<double, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_3;
+typedef std::tuple<double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_4;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_5;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_6;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_7;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_8;
+typedef std::tuple<double, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_9;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_10;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_11;
+typedef std::tuple<double, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_12;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_13;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_14;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_15;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_16;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_17;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_18;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_19;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_20;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_21;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_22;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_23;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_24;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_25;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_26;
+typedef std::tuple<std::vector<double>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_27;
+typedef std::tuple<std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_28;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_29;
+typedef std::tuple<std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_30;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_31;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_32;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_33;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_34;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_35;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_36;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_37;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_38;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_39;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_40;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_41;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_42;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_43;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_44;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_45;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_46;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_47;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_48;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_49;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_50;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_51;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_52;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_53;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_54;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_55;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_56;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_57;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_58;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_59;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_60;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_61;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_62;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_63;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_64;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_65;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_66;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_67;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_68;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_69;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_70;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_80;
+typedef std::tuple<fvar<fvar<var> >, double, double, empty, empty, empty> type_ffv_81;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<double>, empty, empty, empty> type_ffv_82;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_83;
+typedef std::tuple<fvar<fvar<var> >, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_84;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_85;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_86;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, double, empty, empty, empty> type_ffv_87;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_88;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_89;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_90;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_91;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_92;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_93;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_94;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_95;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_96;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_97;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_98;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_99;
+
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_0> AgradCcdfLogScaledInvChiSquare_ffv_0;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_1> AgradCcdfLogScaledInvChiSquare_ffv_1;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_2> AgradCcdfLogScaledInvChiSquare_ffv_2;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_3> AgradCcdfLogScaledInvChiSquare_ffv_3;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_4> AgradCcdfLogScaledInvChiSquare_ffv_4;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_5> AgradCcdfLogScaledInvChiSquare_ffv_5;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_6> AgradCcdfLogScaledInvChiSquare_ffv_6;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_7> AgradCcdfLogScaledInvChiSquare_ffv_7;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_8> AgradCcdfLogScaledInvChiSquare_ffv_8;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_9> AgradCcdfLogScaledInvChiSquare_ffv_9;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_10> AgradCcdfLogScaledInvChiSquare_ffv_10;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_11> AgradCcdfLogScaledInvChiSquare_ffv_11;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_12> AgradCcdfLogScaledInvChiSquare_ffv_12;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_13> AgradCcdfLogScaledInvChiSquare_ffv_13;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_14> AgradCcdfLogScaledInvChiSquare_ffv_14;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_15> AgradCcdfLogScaledInvChiSquare_ffv_15;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_16> AgradCcdfLogScaledInvChiSquare_ffv_16;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_17> AgradCcdfLogScaledInvChiSquare_ffv_17;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_18> AgradCcdfLogScaledInvChiSquare_ffv_18;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_19> AgradCcdfLogScaledInvChiSquare_ffv_19;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_20> AgradCcdfLogScaledInvChiSquare_ffv_20;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_21> AgradCcdfLogScaledInvChiSquare_ffv_21;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_22> AgradCcdfLogScaledInvChiSquare_ffv_22;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_23> AgradCcdfLogScaledInvChiSquare_ffv_23;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_24> AgradCcdfLogScaledInvChiSquare_ffv_24;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_25> AgradCcdfLogScaledInvChiSquare_ffv_25;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_26> AgradCcdfLogScaledInvChiSquare_ffv_26;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_27> AgradCcdfLogScaledInvChiSquare_ffv_27;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_28> AgradCcdfLogScaledInvChiSquare_ffv_28;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_29> AgradCcdfLogScaledInvChiSquare_ffv_29;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_30> AgradCcdfLogScaledInvChiSquare_ffv_30;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_31> AgradCcdfLogScaledInvChiSquare_ffv_31;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_32> AgradCcdfLogScaledInvChiSquare_ffv_32;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_33> AgradCcdfLogScaledInvChiSquare_ffv_33;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_34> AgradCcdfLogScaledInvChiSquare_ffv_34;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_35> AgradCcdfLogScaledInvChiSquare_ffv_35;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_36> AgradCcdfLogScaledInvChiSquare_ffv_36;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_37> AgradCcdfLogScaledInvChiSquare_ffv_37;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_38> AgradCcdfLogScaledInvChiSquare_ffv_38;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_39> AgradCcdfLogScaledInvChiSquare_ffv_39;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_40> AgradCcdfLogScaledInvChiSquare_ffv_40;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_41> AgradCcdfLogScaledInvChiSquare_ffv_41;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_42> AgradCcdfLogScaledInvChiSquare_ffv_42;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_43> AgradCcdfLogScaledInvChiSquare_ffv_43;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_44> AgradCcdfLogScaledInvChiSquare_ffv_44;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_45> AgradCcdfLogScaledInvChiSquare_ffv_45;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_46> AgradCcdfLogScaledInvChiSquare_ffv_46;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_47> AgradCcdfLogScaledInvChiSquare_ffv_47;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_48> AgradCcdfLogScaledInvChiSquare_ffv_48;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_49> AgradCcdfLogScaledInvChiSquare_ffv_49;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_50> AgradCcdfLogScaledInvChiSquare_ffv_50;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_51> AgradCcdfLogScaledInvChiSquare_ffv_51;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_52> AgradCcdfLogScaledInvChiSquare_ffv_52;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_53> AgradCcdfLogScaledInvChiSquare_ffv_53;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_54> AgradCcdfLogScaledInvChiSquare_ffv_54;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_55> AgradCcdfLogScaledInvChiSquare_ffv_55;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_56> AgradCcdfLogScaledInvChiSquare_ffv_56;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_57> AgradCcdfLogScaledInvChiSquare_ffv_57;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_58> AgradCcdfLogScaledInvChiSquare_ffv_58;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_59> AgradCcdfLogScaledInvChiSquare_ffv_59;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_60> AgradCcdfLogScaledInvChiSquare_ffv_60;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_61> AgradCcdfLogScaledInvChiSquare_ffv_61;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_62> AgradCcdfLogScaledInvChiSquare_ffv_62;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_63> AgradCcdfLogScaledInvChiSquare_ffv_63;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_64> AgradCcdfLogScaledInvChiSquare_ffv_64;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_65> AgradCcdfLogScaledInvChiSquare_ffv_65;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_66> AgradCcdfLogScaledInvChiSquare_ffv_66;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_67> AgradCcdfLogScaledInvChiSquare_ffv_67;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_68> AgradCcdfLogScaledInvChiSquare_ffv_68;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_69> AgradCcdfLogScaledInvChiSquare_ffv_69;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_70> AgradCcdfLogScaledInvChiSquare_ffv_70;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_71> AgradCcdfLogScaledInvChiSquare_ffv_71;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_72> AgradCcdfLogScaledInvChiSquare_ffv_72;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_73> AgradCcdfLogScaledInvChiSquare_ffv_73;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_74> AgradCcdfLogScaledInvChiSquare_ffv_74;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_75> AgradCcdfLogScaledInvChiSquare_ffv_75;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_76> AgradCcdfLogScaledInvChiSquare_ffv_76;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_77> AgradCcdfLogScaledInvChiSquare_ffv_77;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_78> AgradCcdfLogScaledInvChiSquare_ffv_78;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_79> AgradCcdfLogScaledInvChiSquare_ffv_79;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_80> AgradCcdfLogScaledInvChiSquare_ffv_80;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_81> AgradCcdfLogScaledInvChiSquare_ffv_81;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_82> AgradCcdfLogScaledInvChiSquare_ffv_82;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_83> AgradCcdfLogScaledInvChiSquare_ffv_83;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_84> AgradCcdfLogScaledInvChiSquare_ffv_84;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_85> AgradCcdfLogScaledInvChiSquare_ffv_85;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_86> AgradCcdfLogScaledInvChiSquare_ffv_86;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_87> AgradCcdfLogScaledInvChiSquare_ffv_87;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_88> AgradCcdfLogScaledInvChiSquare_ffv_88;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_89> AgradCcdfLogScaledInvChiSquare_ffv_89;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_90> AgradCcdfLogScaledInvChiSquare_ffv_90;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_91> AgradCcdfLogScaledInvChiSquare_ffv_91;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_92> AgradCcdfLogScaledInvChiSquare_ffv_92;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_93> AgradCcdfLogScaledInvChiSquare_ffv_93;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_94> AgradCcdfLogScaledInvChiSquare_ffv_94;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_95> AgradCcdfLogScaledInvChiSquare_ffv_95;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_96> AgradCcdfLogScaledInvChiSquare_ffv_96;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_97> AgradCcdfLogScaledInvChiSquare_ffv_97;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_98> AgradCcdfLogScaledInvChiSquare_ffv_98;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_99> AgradCcdfLogScaledInvChiSquare_ffv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_0, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_1, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_2, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_3, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_4, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_5, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_6, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_7, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_8, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_9, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_10, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_11, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_12, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_13, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_14, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_15, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_16, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_17, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_18, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_19, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_20, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_21, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_22, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_23, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_24, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_25, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_26, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_27, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_28, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_29, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_30, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_31, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_32, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_33, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_34, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_35, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_36, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_37, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_38, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_39, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_40, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_41, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_42, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_43, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_44, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_45, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_46, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_47, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_48, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_49, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_50, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_51, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_52, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_53, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_54, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_55, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_56, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_57, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_58, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_59, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_60, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_61, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_62, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_63, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_64, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_65, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_66, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_67, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_68, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_69, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_70, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_71, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_72, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_73, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_74, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_75, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_76, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_77, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_78, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_79, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_80, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_81, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_82, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_83, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_84, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_85, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_86, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_87, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_88, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_89, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_90, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_91, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_92, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_93, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_94, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_95, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_96, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_97, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_98, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_99, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_99);
+
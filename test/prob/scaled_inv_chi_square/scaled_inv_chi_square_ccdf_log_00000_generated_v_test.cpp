@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/scaled_inv_chi_square/scaled_inv_chi_square_ccdf_log_test.hpp>
+
+typedef std::tuple<double, double, double, empty, empty, empty> type_v_0;
+typedef std::tuple<double, double, std::vector<double>, empty, empty, empty> type_v_1;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_2;
+typedef std::tuple<double, double, var, empty, empty, empty> type_v_3;
+typedef std::tuple<double, double, std::vector<var>, empty, empty, empty> type_v_4;
+typedef std::tuple<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_5;
+typedef std::tuple<double, std::vector<double>, double, empty, empty, empty> type_v_6;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_7;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_8;
+typedef std::tuple<double, std::vector<double>, var, empty, empty, empty> type_v_9;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_10;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_11;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_12;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_13;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_14;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_15;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_16;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_17;
+typedef std::tuple<double, var, double, empty, empty, empty> type_v_18;
+typedef std::tuple<double, var, std::vector<double>, empty, empty, empty> type_v_19;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_20;
+typedef std::tuple<double, var, var, empty, empty, empty> type_v_21;
+typedef std::tuple<double, var, std::vector<var>, empty, empty, empty> type_v_22;
+typedef std::tuple<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_23;
+typedef std::tuple<double, std::vector<var>, double, empty, empty, empty> type_v_24;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_25;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_26;
+typedef std::tuple<double, std::vector<var>, var, empty, empty, empty> type_v_27;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_28;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_29;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_30;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_31;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_32;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_33;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_34;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_35;
+typedef std::tuple<std::vector<double>, double, double, empty, empty, empty> type_v_36;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, empty, empty, empty> type_v_37;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_38;
+typedef std::tuple<std::vector<double>, double, var, empty, empty, empty> type_v_39;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, empty, empty, empty> type_v_40;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_41;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, empty, empty, empty> type_v_42;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_43;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_44;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, empty, empty, empty> type_v_45;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_46;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_47;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_48;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_49;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_50;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_51;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_52;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_53;
+typedef std::tuple<std::vector<double>, var, double, empty, empty, empty> type_v_54;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, empty, empty, empty> type_v_55;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_56;
+typedef std::tuple<std::vector<double>, var, var, empty, empty, empty> type_v_57;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, empty, empty, empty> type_v_58;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_59;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, empty, empty, empty> type_v_60;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_61;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_62;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, empty, empty, empty> type_v_63;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_64;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_65;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_66;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_67;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_68;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_69;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_70;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_v_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_v_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_v_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_v_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_v_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_80;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_v_81;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_82;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_83;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_84;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_85;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_86;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_87;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_88;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_89;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_v_90;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_v_91;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_92;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_v_93;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_v_94;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_95;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_v_96;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_97;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_98;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_v_99;
+
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_0> AgradCcdfLogScaledInvChiSquare_v_0;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_1> AgradCcdfLogScaledInvChiSquare_v_1;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_2> AgradCcdfLogScaledInvChiSquare_v_2;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_3> AgradCcdfLogScaledInvChiSquare_v_3;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_4> AgradCcdfLogScaledInvChiSquare_v_4;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_5> AgradCcdfLogScaledInvChiSquare_v_5;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_6> AgradCcdfLogScaledInvChiSquare_v_6;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_7> AgradCcdfLogScaledInvChiSquare_v_7;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_8> AgradCcdfLogScaledInvChiSquare_v_8;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_9> AgradCcdfLogScaledInvChiSquare_v_9;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_10> AgradCcdfLogScaledInvChiSquare_v_10;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_11> AgradCcdfLogScaledInvChiSquare_v_11;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_12> AgradCcdfLogScaledInvChiSquare_v_12;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_13> AgradCcdfLogScaledInvChiSquare_v_13;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_14> AgradCcdfLogScaledInvChiSquare_v_14;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_15> AgradCcdfLogScaledInvChiSquare_v_15;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_16> AgradCcdfLogScaledInvChiSquare_v_16;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_17> AgradCcdfLogScaledInvChiSquare_v_17;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_18> AgradCcdfLogScaledInvChiSquare_v_18;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_19> AgradCcdfLogScaledInvChiSquare_v_19;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_20> AgradCcdfLogScaledInvChiSquare_v_20;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_21> AgradCcdfLogScaledInvChiSquare_v_21;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_22> AgradCcdfLogScaledInvChiSquare_v_22;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_23> AgradCcdfLogScaledInvChiSquare_v_23;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_24> AgradCcdfLogScaledInvChiSquare_v_24;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_25> AgradCcdfLogScaledInvChiSquare_v_25;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_26> AgradCcdfLogScaledInvChiSquare_v_26;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_27> AgradCcdfLogScaledInvChiSquare_v_27;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_28> AgradCcdfLogScaledInvChiSquare_v_28;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_29> AgradCcdfLogScaledInvChiSquare_v_29;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_30> AgradCcdfLogScaledInvChiSquare_v_30;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_31> AgradCcdfLogScaledInvChiSquare_v_31;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_32> AgradCcdfLogScaledInvChiSquare_v_32;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_33> AgradCcdfLogScaledInvChiSquare_v_33;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_34> AgradCcdfLogScaledInvChiSquare_v_34;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_35> AgradCcdfLogScaledInvChiSquare_v_35;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_36> AgradCcdfLogScaledInvChiSquare_v_36;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_37> AgradCcdfLogScaledInvChiSquare_v_37;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_38> AgradCcdfLogScaledInvChiSquare_v_38;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_39> AgradCcdfLogScaledInvChiSquare_v_39;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_40> AgradCcdfLogScaledInvChiSquare_v_40;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_41> AgradCcdfLogScaledInvChiSquare_v_41;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_42> AgradCcdfLogScaledInvChiSquare_v_42;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_43> AgradCcdfLogScaledInvChiSquare_v_43;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_44> AgradCcdfLogScaledInvChiSquare_v_44;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_45> AgradCcdfLogScaledInvChiSquare_v_45;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_46> AgradCcdfLogScaledInvChiSquare_v_46;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_47> AgradCcdfLogScaledInvChiSquare_v_47;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_48> AgradCcdfLogScaledInvChiSquare_v_48;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_49> AgradCcdfLogScaledInvChiSquare_v_49;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_50> AgradCcdfLogScaledInvChiSquare_v_50;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_51> AgradCcdfLogScaledInvChiSquare_v_51;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_52> AgradCcdfLogScaledInvChiSquare_v_52;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_53> AgradCcdfLogScaledInvChiSquare_v_53;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_54> AgradCcdfLogScaledInvChiSquare_v_54;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_55> AgradCcdfLogScaledInvChiSquare_v_55;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_56> AgradCcdfLogScaledInvChiSquare_v_56;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_57> AgradCcdfLogScaledInvChiSquare_v_57;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_58> AgradCcdfLogScaledInvChiSquare_v_58;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_59> AgradCcdfLogScaledInvChiSquare_v_59;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_60> AgradCcdfLogScaledInvChiSquare_v_60;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_61> AgradCcdfLogScaledInvChiSquare_v_61;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_62> AgradCcdfLogScaledInvChiSquare_v_62;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_63> AgradCcdfLogScaledInvChiSquare_v_63;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_64> AgradCcdfLogScaledInvChiSquare_v_64;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_65> AgradCcdfLogScaledInvChiSquare_v_65;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_66> AgradCcdfLogScaledInvChiSquare_v_66;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_67> AgradCcdfLogScaledInvChiSquare_v_67;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_68> AgradCcdfLogScaledInvChiSquare_v_68;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_69> AgradCcdfLogScaledInvChiSquare_v_69;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_70> AgradCcdfLogScaledInvChiSquare_v_70;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_71> AgradCcdfLogScaledInvChiSquare_v_71;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_72> AgradCcdfLogScaledInvChiSquare_v_72;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_73> AgradCcdfLogScaledInvChiSquare_v_73;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_74> AgradCcdfLogScaledInvChiSquare_v_74;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_75> AgradCcdfLogScaledInvChiSquare_v_75;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_76> AgradCcdfLogScaledInvChiSquare_v_76;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_77> AgradCcdfLogScaledInvChiSquare_v_77;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_78> AgradCcdfLogScaledInvChiSquare_v_78;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_79> AgradCcdfLogScaledInvChiSquare_v_79;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_80> AgradCcdfLogScaledInvChiSquare_v_80;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_81> AgradCcdfLogScaledInvChiSquare_v_81;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_82> AgradCcdfLogScaledInvChiSquare_v_82;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_83> AgradCcdfLogScaledInvChiSquare_v_83;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_84> AgradCcdfLogScaledInvChiSquare_v_84;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_85> AgradCcdfLogScaledInvChiSquare_v_85;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_86> AgradCcdfLogScaledInvChiSquare_v_86;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_87> AgradCcdfLogScaledInvChiSquare_v_87;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_88> AgradCcdfLogScaledInvChiSquare_v_88;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_89> AgradCcdfLogScaledInvChiSquare_v_89;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_90> AgradCcdfLogScaledInvChiSquare_v_90;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_91> AgradCcdfLogScaledInvChiSquare_v_91;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_92> AgradCcdfLogScaledInvChiSquare_v_92;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_93> AgradCcdfLogScaledInvChiSquare_v_93;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_94> AgradCcdfLogScaledInvChiSquare_v_94;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_95> AgradCcdfLogScaledInvChiSquare_v_95;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_96> AgradCcdfLogScaledInvChiSquare_v_96;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_97> AgradCcdfLogScaledInvChiSquare_v_97;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_98> AgradCcdfLogScaledInvChiSquare_v_98;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_99> AgradCcdfLogScaledInvChiSquare_v_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_0, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_1, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_2, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_3, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_4, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_5, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_6, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_7, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_8, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_9, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_10, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_11, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_12, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_13, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_14, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_15, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_16, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_17, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_18, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_19, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_20, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_21, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_22, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_23, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_24, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_25, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_26, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_27, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_28, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_29, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_30, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_31, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_32, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_33, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_34, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_35, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_36, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_37, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_38, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_39, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_40, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_41, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_42, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_43, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_44, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_45, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_46, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_47, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_48, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_49, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_50, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_51, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_52, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_53, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_54, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_55, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_56, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_57, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_58, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_59, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_60, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_61, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_62, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_63, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_64, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_65, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_66, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_67, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_68, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_69, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_70, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_71, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_72, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_73, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_74, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_75, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_76, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_77, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_78, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_79, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_80, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_81, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_82, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_83, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_84, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_85, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_86, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_87, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_88, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_89, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_90, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_91, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_92, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_93, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_94, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_95, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_96, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_97, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_98, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_99, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_99);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/scaled_inv_chi_square/scaled_inv_chi_square_ccdf_log_test.hpp>
+
+typedef std::tuple<double, double, var, empty, empty, empty> type_vv_0;
+typedef std::tuple<double, double, std::vector<var>, empty, empty, empty> type_vv_1;
+typedef std::tuple<double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_2;
+typedef std::tuple<double, std::vector<double>, var, empty, empty, empty> type_vv_3;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_4;
+typedef std::tuple<double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_5;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_6;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_7;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_8;
+typedef std::tuple<double, var, double, empty, empty, empty> type_vv_9;
+typedef std::tuple<double, var, std::vector<double>, empty, empty, empty> type_vv_10;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_11;
+typedef std::tuple<double, var, var, empty, empty, empty> type_vv_12;
+typedef std::tuple<double, var, std::vector<var>, empty, empty, empty> type_vv_13;
+typedef std::tuple<double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_14;
+typedef std::tuple<double, std::vector<var>, double, empty, empty, empty> type_vv_15;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_16;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_17;
+typedef std::tuple<double, std::vector<var>, var, empty, empty, empty> type_vv_18;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_19;
+typedef std::tuple<double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_20;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_21;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_22;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_23;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_24;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_25;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_26;
+typedef std::tuple<std::vector<double>, double, var, empty, empty, empty> type_vv_27;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, empty, empty, empty> type_vv_28;
+typedef std::tuple<std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_29;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, empty, empty, empty> type_vv_30;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_31;
+typedef std::tuple<std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_32;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_33;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_34;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_35;
+typedef std::tuple<std::vector<double>, var, double, empty, empty, empty> type_vv_36;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, empty, empty, empty> type_vv_37;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_38;
+typedef std::tuple<std::vector<double>, var, var, empty, empty, empty> type_vv_39;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, empty, empty, empty> type_vv_40;
+typedef std::tuple<std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_41;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, empty, empty, empty> type_vv_42;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_43;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_44;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, empty, empty, empty> type_vv_45;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_46;
+typedef std::tuple<std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_47;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_48;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_49;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_50;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_51;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_52;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_53;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_vv_54;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_vv_55;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_56;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_vv_57;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_58;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_59;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_60;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_61;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_62;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_vv_63;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_vv_64;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_65;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_vv_66;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_vv_67;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_68;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_vv_69;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_70;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_vv_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_80;
+typedef std::tuple<var, double, double, empty, empty, empty> type_vv_81;
+typedef std::tuple<var, double, std::vector<double>, empty, empty, empty> type_vv_82;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_83;
+typedef std::tuple<var, double, var, empty, empty, empty> type_vv_84;
+typedef std::tuple<var, double, std::vector<var>, empty, empty, empty> type_vv_85;
+typedef std::tuple<var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_86;
+typedef std::tuple<var, std::vector<double>, double, empty, empty, empty> type_vv_87;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_88;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_89;
+typedef std::tuple<var, std::vector<double>, var, empty, empty, empty> type_vv_90;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_91;
+typedef std::tuple<var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_92;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_93;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_94;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_95;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_96;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_97;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_98;
+typedef std::tuple<var, var, double, empty, empty, empty> type_vv_99;
+
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_0> AgradCcdfLogScaledInvChiSquare_vv_0;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_1> AgradCcdfLogScaledInvChiSquare_vv_1;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_2> AgradCcdfLogScaledInvChiSquare_vv_2;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_3> AgradCcdfLogScaledInvChiSquare_vv_3;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_4> AgradCcdfLogScaledInvChiSquare_vv_4;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_5> AgradCcdfLogScaledInvChiSquare_vv_5;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_6> AgradCcdfLogScaledInvChiSquare_vv_6;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_7> AgradCcdfLogScaledInvChiSquare_vv_7;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_8> AgradCcdfLogScaledInvChiSquare_vv_8;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_9> AgradCcdfLogScaledInvChiSquare_vv_9;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_10> AgradCcdfLogScaledInvChiSquare_vv_10;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_11> AgradCcdfLogScaledInvChiSquare_vv_11;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_12> AgradCcdfLogScaledInvChiSquare_vv_12;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_13> AgradCcdfLogScaledInvChiSquare_vv_13;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_14> AgradCcdfLogScaledInvChiSquare_vv_14;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_15> AgradCcdfLogScaledInvChiSquare_vv_15;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_16> AgradCcdfLogScaledInvChiSquare_vv_16;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_17> AgradCcdfLogScaledInvChiSquare_vv_17;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_18> AgradCcdfLogScaledInvChiSquare_vv_18;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_19> AgradCcdfLogScaledInvChiSquare_vv_19;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_20> AgradCcdfLogScaledInvChiSquare_vv_20;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_21> AgradCcdfLogScaledInvChiSquare_vv_21;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_22> AgradCcdfLogScaledInvChiSquare_vv_22;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_23> AgradCcdfLogScaledInvChiSquare_vv_23;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_24> AgradCcdfLogScaledInvChiSquare_vv_24;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_25> AgradCcdfLogScaledInvChiSquare_vv_25;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_26> AgradCcdfLogScaledInvChiSquare_vv_26;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_27> AgradCcdfLogScaledInvChiSquare_vv_27;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_28> AgradCcdfLogScaledInvChiSquare_vv_28;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_29> AgradCcdfLogScaledInvChiSquare_vv_29;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_30> AgradCcdfLogScaledInvChiSquare_vv_30;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_31> AgradCcdfLogScaledInvChiSquare_vv_31;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_32> AgradCcdfLogScaledInvChiSquare_vv_32;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_33> AgradCcdfLogScaledInvChiSquare_vv_33;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_34> AgradCcdfLogScaledInvChiSquare_vv_34;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_35> AgradCcdfLogScaledInvChiSquare_vv_35;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_36> AgradCcdfLogScaledInvChiSquare_vv_36;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_37> AgradCcdfLogScaledInvChiSquare_vv_37;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_38> AgradCcdfLogScaledInvChiSquare_vv_38;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_39> AgradCcdfLogScaledInvChiSquare_vv_39;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_40> AgradCcdfLogScaledInvChiSquare_vv_40;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_41> AgradCcdfLogScaledInvChiSquare_vv_41;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_42> AgradCcdfLogScaledInvChiSquare_vv_42;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_43> AgradCcdfLogScaledInvChiSquare_vv_43;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_44> AgradCcdfLogScaledInvChiSquare_vv_44;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_45> AgradCcdfLogScaledInvChiSquare_vv_45;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_46> AgradCcdfLogScaledInvChiSquare_vv_46;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_47> AgradCcdfLogScaledInvChiSquare_vv_47;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_48> AgradCcdfLogScaledInvChiSquare_vv_48;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_49> AgradCcdfLogScaledInvChiSquare_vv_49;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_50> AgradCcdfLogScaledInvChiSquare_vv_50;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_51> AgradCcdfLogScaledInvChiSquare_vv_51;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_52> AgradCcdfLogScaledInvChiSquare_vv_52;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_53> AgradCcdfLogScaledInvChiSquare_vv_53;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_54> AgradCcdfLogScaledInvChiSquare_vv_54;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_55> AgradCcdfLogScaledInvChiSquare_vv_55;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_56> AgradCcdfLogScaledInvChiSquare_vv_56;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_57> AgradCcdfLogScaledInvChiSquare_vv_57;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_58> AgradCcdfLogScaledInvChiSquare_vv_58;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_59> AgradCcdfLogScaledInvChiSquare_vv_59;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_60> AgradCcdfLogScaledInvChiSquare_vv_60;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_61> AgradCcdfLogScaledInvChiSquare_vv_61;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_62> AgradCcdfLogScaledInvChiSquare_vv_62;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_63> AgradCcdfLogScaledInvChiSquare_vv_63;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_64> AgradCcdfLogScaledInvChiSquare_vv_64;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_65> AgradCcdfLogScaledInvChiSquare_vv_65;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_66> AgradCcdfLogScaledInvChiSquare_vv_66;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_67> AgradCcdfLogScaledInvChiSquare_vv_67;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_68> AgradCcdfLogScaledInvChiSquare_vv_68;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_69> AgradCcdfLogScaledInvChiSquare_vv_69;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_70> AgradCcdfLogScaledInvChiSquare_vv_70;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_71> AgradCcdfLogScaledInvChiSquare_vv_71;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_72> AgradCcdfLogScaledInvChiSquare_vv_72;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_73> AgradCcdfLogScaledInvChiSquare_vv_73;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_74> AgradCcdfLogScaledInvChiSquare_vv_74;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_75> AgradCcdfLogScaledInvChiSquare_vv_75;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_76> AgradCcdfLogScaledInvChiSquare_vv_76;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_77> AgradCcdfLogScaledInvChiSquare_vv_77;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_78> AgradCcdfLogScaledInvChiSquare_vv_78;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_79> AgradCcdfLogScaledInvChiSquare_vv_79;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_80> AgradCcdfLogScaledInvChiSquare_vv_80;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_81> AgradCcdfLogScaledInvChiSquare_vv_81;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_82> AgradCcdfLogScaledInvChiSquare_vv_82;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_83> AgradCcdfLogScaledInvChiSquare_vv_83;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_84> AgradCcdfLogScaledInvChiSquare_vv_84;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_85> AgradCcdfLogScaledInvChiSquare_vv_85;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_86> AgradCcdfLogScaledInvChiSquare_vv_86;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_87> AgradCcdfLogScaledInvChiSquare_vv_87;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_88> AgradCcdfLogScaledInvChiSquare_vv_88;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_89> AgradCcdfLogScaledInvChiSquare_vv_89;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_90> AgradCcdfLogScaledInvChiSquare_vv_90;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_91> AgradCcdfLogScaledInvChiSquare_vv_91;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_92> AgradCcdfLogScaledInvChiSquare_vv_92;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_93> AgradCcdfLogScaledInvChiSquare_vv_93;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_94> AgradCcdfLogScaledInvChiSquare_vv_94;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_95> AgradCcdfLogScaledInvChiSquare_vv_95;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_96> AgradCcdfLogScaledInvChiSquare_vv_96;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_97> AgradCcdfLogScaledInvChiSquare_vv_97;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_98> AgradCcdfLogScaledInvChiSquare_vv_98;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_99> AgradCcdfLogScaledInvChiSquare_vv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_0, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_1, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_2, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_3, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_4, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_5, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_6, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_7, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_8, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_9, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_10, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_11, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_12, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_13, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_14, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_15, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_16, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_17, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_18, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_19, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_20, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_21, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_22, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_23, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_24, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_25, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_26, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_27, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_28, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_29, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_30, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_31, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_32, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_33, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_34, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_35, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_36, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_37, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_38, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_39, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_40, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_41, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_42, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_43, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_44, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_45, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_46, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_47, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_48, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_49, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_50, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_51, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_52, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_53, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_54, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_55, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_56, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_57, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_58, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_59, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_60, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_61, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_62, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_63, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_64, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_65, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_66, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_67, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_68, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_69, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_70, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_71, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_72, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_73, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_74, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_75, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_76, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_77, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_78, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_79, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_80, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_81, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_82, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_83, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_84, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_85, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_86, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_87, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_88, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_89, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_90, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_91, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_92, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_93, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_94, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_95, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_96, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_97, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_98, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_99, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_99);
+
@@ -0,0 +1,278 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/scaled_inv_chi_square/scaled_inv_chi_square_ccdf_log_test.hpp>
+
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_100;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_101;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_102;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_103;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_104;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_105;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_106;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_107;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_108;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_109;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_110;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_111;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_112;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_113;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_114;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_115;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_116;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, double, empty, empty, empty> type_ffv_117;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty, empty, empty> type_ffv_118;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_119;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_120;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_121;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_122;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty, empty, empty> type_ffv_123;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_124;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_125;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_126;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_127;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_128;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_129;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_130;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_131;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_132;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_133;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_134;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_135;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_136;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_137;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_138;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_139;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_140;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_141;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_142;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_143;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_144;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_145;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_146;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_147;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_148;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_149;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_150;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_151;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_152;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_ffv_153;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_ffv_154;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_155;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_156;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_157;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_158;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_ffv_159;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_160;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_161;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_162;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_163;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_164;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_165;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_166;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_167;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_168;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_169;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_170;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_171;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_172;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_173;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_174;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_175;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_176;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_177;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_178;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_179;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_180;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_181;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_182;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_183;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_184;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_185;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_186;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_187;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_188;
+
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_100> AgradCcdfLogScaledInvChiSquare_ffv_100;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_101> AgradCcdfLogScaledInvChiSquare_ffv_101;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_102> AgradCcdfLogScaledInvChiSquare_ffv_102;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_103> AgradCcdfLogScaledInvChiSquare_ffv_103;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_104> AgradCcdfLogScaledInvChiSquare_ffv_104;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_105> AgradCcdfLogScaledInvChiSquare_ffv_105;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_106> AgradCcdfLogScaledInvChiSquare_ffv_106;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_107> AgradCcdfLogScaledInvChiSquare_ffv_107;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_108> AgradCcdfLogScaledInvChiSquare_ffv_108;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_109> AgradCcdfLogScaledInvChiSquare_ffv_109;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_110> AgradCcdfLogScaledInvChiSquare_ffv_110;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_111> AgradCcdfLogScaledInvChiSquare_ffv_111;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_112> AgradCcdfLogScaledInvChiSquare_ffv_112;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_113> AgradCcdfLogScaledInvChiSquare_ffv_113;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_114> AgradCcdfLogScaledInvChiSquare_ffv_114;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_115> AgradCcdfLogScaledInvChiSquare_ffv_115;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_116> AgradCcdfLogScaledInvChiSquare_ffv_116;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_117> AgradCcdfLogScaledInvChiSquare_ffv_117;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_118> AgradCcdfLogScaledInvChiSquare_ffv_118;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_119> AgradCcdfLogScaledInvChiSquare_ffv_119;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_120> AgradCcdfLogScaledInvChiSquare_ffv_120;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_121> AgradCcdfLogScaledInvChiSquare_ffv_121;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_122> AgradCcdfLogScaledInvChiSquare_ffv_122;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_123> AgradCcdfLogScaledInvChiSquare_ffv_123;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_124> AgradCcdfLogScaledInvChiSquare_ffv_124;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_125> AgradCcdfLogScaledInvChiSquare_ffv_125;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_126> AgradCcdfLogScaledInvChiSquare_ffv_126;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_127> AgradCcdfLogScaledInvChiSquare_ffv_127;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_128> AgradCcdfLogScaledInvChiSquare_ffv_128;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_129> AgradCcdfLogScaledInvChiSquare_ffv_129;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_130> AgradCcdfLogScaledInvChiSquare_ffv_130;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_131> AgradCcdfLogScaledInvChiSquare_ffv_131;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_132> AgradCcdfLogScaledInvChiSquare_ffv_132;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_133> AgradCcdfLogScaledInvChiSquare_ffv_133;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_134> AgradCcdfLogScaledInvChiSquare_ffv_134;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_135> AgradCcdfLogScaledInvChiSquare_ffv_135;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_136> AgradCcdfLogScaledInvChiSquare_ffv_136;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_137> AgradCcdfLogScaledInvChiSquare_ffv_137;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_138> AgradCcdfLogScaledInvChiSquare_ffv_138;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_139> AgradCcdfLogScaledInvChiSquare_ffv_139;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_140> AgradCcdfLogScaledInvChiSquare_ffv_140;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_141> AgradCcdfLogScaledInvChiSquare_ffv_141;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_142> AgradCcdfLogScaledInvChiSquare_ffv_142;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_143> AgradCcdfLogScaledInvChiSquare_ffv_143;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_144> AgradCcdfLogScaledInvChiSquare_ffv_144;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_145> AgradCcdfLogScaledInvChiSquare_ffv_145;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_146> AgradCcdfLogScaledInvChiSquare_ffv_146;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_147> AgradCcdfLogScaledInvChiSquare_ffv_147;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_148> AgradCcdfLogScaledInvChiSquare_ffv_148;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_149> AgradCcdfLogScaledInvChiSquare_ffv_149;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_150> AgradCcdfLogScaledInvChiSquare_ffv_150;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_151> AgradCcdfLogScaledInvChiSquare_ffv_151;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_152> AgradCcdfLogScaledInvChiSquare_ffv_152;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_153> AgradCcdfLogScaledInvChiSquare_ffv_153;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_154> AgradCcdfLogScaledInvChiSquare_ffv_154;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_155> AgradCcdfLogScaledInvChiSquare_ffv_155;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_156> AgradCcdfLogScaledInvChiSquare_ffv_156;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_157> AgradCcdfLogScaledInvChiSquare_ffv_157;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_158> AgradCcdfLogScaledInvChiSquare_ffv_158;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_159> AgradCcdfLogScaledInvChiSquare_ffv_159;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_160> AgradCcdfLogScaledInvChiSquare_ffv_160;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_161> AgradCcdfLogScaledInvChiSquare_ffv_161;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_162> AgradCcdfLogScaledInvChiSquare_ffv_162;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_163> AgradCcdfLogScaledInvChiSquare_ffv_163;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_164> AgradCcdfLogScaledInvChiSquare_ffv_164;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_165> AgradCcdfLogScaledInvChiSquare_ffv_165;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_166> AgradCcdfLogScaledInvChiSquare_ffv_166;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_167> AgradCcdfLogScaledInvChiSquare_ffv_167;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_168> AgradCcdfLogScaledInvChiSquare_ffv_168;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_169> AgradCcdfLogScaledInvChiSquare_ffv_169;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_170> AgradCcdfLogScaledInvChiSquare_ffv_170;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_171> AgradCcdfLogScaledInvChiSquare_ffv_171;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_172> AgradCcdfLogScaledInvChiSquare_ffv_172;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_173> AgradCcdfLogScaledInvChiSquare_ffv_173;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_174> AgradCcdfLogScaledInvChiSquare_ffv_174;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_175> AgradCcdfLogScaledInvChiSquare_ffv_175;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_176> AgradCcdfLogScaledInvChiSquare_ffv_176;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_177> AgradCcdfLogScaledInvChiSquare_ffv_177;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_178> AgradCcdfLogScaledInvChiSquare_ffv_178;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_179> AgradCcdfLogScaledInvChiSquare_ffv_179;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_180> AgradCcdfLogScaledInvChiSquare_ffv_180;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_181> AgradCcdfLogScaledInvChiSquare_ffv_181;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_182> AgradCcdfLogScaledInvChiSquare_ffv_182;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_183> AgradCcdfLogScaledInvChiSquare_ffv_183;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_184> AgradCcdfLogScaledInvChiSquare_ffv_184;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_185> AgradCcdfLogScaledInvChiSquare_ffv_185;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_186> AgradCcdfLogScaledInvChiSquare_ffv_186;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_187> AgradCcdfLogScaledInvChiSquare_ffv_187;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_ffv_188> AgradCcdfLogScaledInvChiSquare_ffv_188;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_100, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_101, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_102, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_103, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_104, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_105, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_106, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_107, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_108, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_109, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_110, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_111, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_112, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_113, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_114, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_115, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_116, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_117, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_118, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_119, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_120, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_121, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_122, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_123, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_124, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_125, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_126, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_127, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_128, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_129, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_130, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_131, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_132, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_133, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_134, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_135, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_136, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_137, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_138, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_139, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_140, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_141, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_142, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_143, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_144, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_145, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_146, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_147, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_148, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_149, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_150, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_151, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_152, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_153, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_154, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_155, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_156, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_157, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_158, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_159, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_160, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_161, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_162, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_163, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_164, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_165, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_166, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_167, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_168, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_169, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_170, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_171, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_172, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_173, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_174, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_175, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_176, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_177, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_178, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_179, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_180, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_181, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_182, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_183, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_184, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_185, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_186, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_187, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_ffv_188, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_ffv_188);
+
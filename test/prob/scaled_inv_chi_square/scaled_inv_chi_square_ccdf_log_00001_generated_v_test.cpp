@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/scaled_inv_chi_square/scaled_inv_chi_square_ccdf_log_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_100;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_101;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_102;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_103;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_104;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_105;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_106;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_107;
+typedef std::tuple<var, double, double, empty, empty, empty> type_v_108;
+typedef std::tuple<var, double, std::vector<double>, empty, empty, empty> type_v_109;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_110;
+typedef std::tuple<var, double, var, empty, empty, empty> type_v_111;
+typedef std::tuple<var, double, std::vector<var>, empty, empty, empty> type_v_112;
+typedef std::tuple<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_113;
+typedef std::tuple<var, std::vector<double>, double, empty, empty, empty> type_v_114;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_115;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_116;
+typedef std::tuple<var, std::vector<double>, var, empty, empty, empty> type_v_117;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_118;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_119;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_120;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_121;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_122;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_123;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_124;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_125;
+typedef std::tuple<var, var, double, empty, empty, empty> type_v_126;
+typedef std::tuple<var, var, std::vector<double>, empty, empty, empty> type_v_127;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_128;
+typedef std::tuple<var, var, var, empty, empty, empty> type_v_129;
+typedef std::tuple<var, var, std::vector<var>, empty, empty, empty> type_v_130;
+typedef std::tuple<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_131;
+typedef std::tuple<var, std::vector<var>, double, empty, empty, empty> type_v_132;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_133;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_134;
+typedef std::tuple<var, std::vector<var>, var, empty, empty, empty> type_v_135;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_136;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_137;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_138;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_139;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_140;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_141;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_142;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_143;
+typedef std::tuple<std::vector<var>, double, double, empty, empty, empty> type_v_144;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, empty, empty, empty> type_v_145;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_146;
+typedef std::tuple<std::vector<var>, double, var, empty, empty, empty> type_v_147;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, empty, empty, empty> type_v_148;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_149;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, empty, empty, empty> type_v_150;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_151;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_152;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, empty, empty, empty> type_v_153;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_154;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_155;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_156;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_157;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_158;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_159;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_160;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_161;
+typedef std::tuple<std::vector<var>, var, double, empty, empty, empty> type_v_162;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, empty, empty, empty> type_v_163;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_164;
+typedef std::tuple<std::vector<var>, var, var, empty, empty, empty> type_v_165;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, empty, empty, empty> type_v_166;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_167;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, empty, empty, empty> type_v_168;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_169;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_170;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, empty, empty, empty> type_v_171;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_172;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_173;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_174;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_175;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_176;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_177;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_178;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_179;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_v_180;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_v_181;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_182;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_v_183;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_v_184;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_185;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_v_186;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_187;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_188;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_v_189;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_190;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_191;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_192;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_193;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_194;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_195;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_196;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_197;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_v_198;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_v_199;
+
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_100> AgradCcdfLogScaledInvChiSquare_v_100;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_101> AgradCcdfLogScaledInvChiSquare_v_101;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_102> AgradCcdfLogScaledInvChiSquare_v_102;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_103> AgradCcdfLogScaledInvChiSquare_v_103;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_104> AgradCcdfLogScaledInvChiSquare_v_104;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_105> AgradCcdfLogScaledInvChiSquare_v_105;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_106> AgradCcdfLogScaledInvChiSquare_v_106;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_107> AgradCcdfLogScaledInvChiSquare_v_107;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_108> AgradCcdfLogScaledInvChiSquare_v_108;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_109> AgradCcdfLogScaledInvChiSquare_v_109;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_110> AgradCcdfLogScaledInvChiSquare_v_110;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_111> AgradCcdfLogScaledInvChiSquare_v_111;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_112> AgradCcdfLogScaledInvChiSquare_v_112;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_113> AgradCcdfLogScaledInvChiSquare_v_113;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_114> AgradCcdfLogScaledInvChiSquare_v_114;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_115> AgradCcdfLogScaledInvChiSquare_v_115;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_116> AgradCcdfLogScaledInvChiSquare_v_116;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_117> AgradCcdfLogScaledInvChiSquare_v_117;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_118> AgradCcdfLogScaledInvChiSquare_v_118;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_119> AgradCcdfLogScaledInvChiSquare_v_119;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_120> AgradCcdfLogScaledInvChiSquare_v_120;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_121> AgradCcdfLogScaledInvChiSquare_v_121;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_122> AgradCcdfLogScaledInvChiSquare_v_122;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_123> AgradCcdfLogScaledInvChiSquare_v_123;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_124> AgradCcdfLogScaledInvChiSquare_v_124;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_125> AgradCcdfLogScaledInvChiSquare_v_125;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_126> AgradCcdfLogScaledInvChiSquare_v_126;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_127> AgradCcdfLogScaledInvChiSquare_v_127;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_128> AgradCcdfLogScaledInvChiSquare_v_128;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_129> AgradCcdfLogScaledInvChiSquare_v_129;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_130> AgradCcdfLogScaledInvChiSquare_v_130;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_131> AgradCcdfLogScaledInvChiSquare_v_131;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_132> AgradCcdfLogScaledInvChiSquare_v_132;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_133> AgradCcdfLogScaledInvChiSquare_v_133;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_134> AgradCcdfLogScaledInvChiSquare_v_134;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_135> AgradCcdfLogScaledInvChiSquare_v_135;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_136> AgradCcdfLogScaledInvChiSquare_v_136;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_137> AgradCcdfLogScaledInvChiSquare_v_137;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_138> AgradCcdfLogScaledInvChiSquare_v_138;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_139> AgradCcdfLogScaledInvChiSquare_v_139;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_140> AgradCcdfLogScaledInvChiSquare_v_140;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_141> AgradCcdfLogScaledInvChiSquare_v_141;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_142> AgradCcdfLogScaledInvChiSquare_v_142;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_143> AgradCcdfLogScaledInvChiSquare_v_143;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_144> AgradCcdfLogScaledInvChiSquare_v_144;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_145> AgradCcdfLogScaledInvChiSquare_v_145;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_146> AgradCcdfLogScaledInvChiSquare_v_146;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_147> AgradCcdfLogScaledInvChiSquare_v_147;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_148> AgradCcdfLogScaledInvChiSquare_v_148;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_149> AgradCcdfLogScaledInvChiSquare_v_149;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_150> AgradCcdfLogScaledInvChiSquare_v_150;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_151> AgradCcdfLogScaledInvChiSquare_v_151;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_152> AgradCcdfLogScaledInvChiSquare_v_152;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_153> AgradCcdfLogScaledInvChiSquare_v_153;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_154> AgradCcdfLogScaledInvChiSquare_v_154;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_155> AgradCcdfLogScaledInvChiSquare_v_155;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_156> AgradCcdfLogScaledInvChiSquare_v_156;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_157> AgradCcdfLogScaledInvChiSquare_v_157;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_158> AgradCcdfLogScaledInvChiSquare_v_158;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_159> AgradCcdfLogScaledInvChiSquare_v_159;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_160> AgradCcdfLogScaledInvChiSquare_v_160;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_161> AgradCcdfLogScaledInvChiSquare_v_161;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_162> AgradCcdfLogScaledInvChiSquare_v_162;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_163> AgradCcdfLogScaledInvChiSquare_v_163;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_164> AgradCcdfLogScaledInvChiSquare_v_164;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_165> AgradCcdfLogScaledInvChiSquare_v_165;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_166> AgradCcdfLogScaledInvChiSquare_v_166;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_167> AgradCcdfLogScaledInvChiSquare_v_167;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_168> AgradCcdfLogScaledInvChiSquare_v_168;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_169> AgradCcdfLogScaledInvChiSquare_v_169;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_170> AgradCcdfLogScaledInvChiSquare_v_170;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_171> AgradCcdfLogScaledInvChiSquare_v_171;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_172> AgradCcdfLogScaledInvChiSquare_v_172;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_173> AgradCcdfLogScaledInvChiSquare_v_173;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_174> AgradCcdfLogScaledInvChiSquare_v_174;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_175> AgradCcdfLogScaledInvChiSquare_v_175;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_176> AgradCcdfLogScaledInvChiSquare_v_176;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_177> AgradCcdfLogScaledInvChiSquare_v_177;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_178> AgradCcdfLogScaledInvChiSquare_v_178;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_179> AgradCcdfLogScaledInvChiSquare_v_179;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_180> AgradCcdfLogScaledInvChiSquare_v_180;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_181> AgradCcdfLogScaledInvChiSquare_v_181;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_182> AgradCcdfLogScaledInvChiSquare_v_182;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_183> AgradCcdfLogScaledInvChiSquare_v_183;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_184> AgradCcdfLogScaledInvChiSquare_v_184;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_185> AgradCcdfLogScaledInvChiSquare_v_185;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_186> AgradCcdfLogScaledInvChiSquare_v_186;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_187> AgradCcdfLogScaledInvChiSquare_v_187;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_188> AgradCcdfLogScaledInvChiSquare_v_188;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_189> AgradCcdfLogScaledInvChiSquare_v_189;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_190> AgradCcdfLogScaledInvChiSquare_v_190;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_191> AgradCcdfLogScaledInvChiSquare_v_191;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_192> AgradCcdfLogScaledInvChiSquare_v_192;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_193> AgradCcdfLogScaledInvChiSquare_v_193;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_194> AgradCcdfLogScaledInvChiSquare_v_194;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_195> AgradCcdfLogScaledInvChiSquare_v_195;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_196> AgradCcdfLogScaledInvChiSquare_v_196;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_197> AgradCcdfLogScaledInvChiSquare_v_197;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_198> AgradCcdfLogScaledInvChiSquare_v_198;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_199> AgradCcdfLogScaledInvChiSquare_v_199;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_100, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_101, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_102, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_103, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_104, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_105, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_106, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_107, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_108, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_109, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_110, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_111, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_112, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_113, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_114, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_115, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_116, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_117, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_118, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_119, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_120, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_121, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_122, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_123, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_124, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_125, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_126, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_127, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_128, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_129, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_130, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_131, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_132, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_133, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_134, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_135, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_136, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_137, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_138, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_139, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_140, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_141, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_142, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_143, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_144, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_145, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_146, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_147, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_148, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_149, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_150, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_151, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_152, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_153, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_154, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_155, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_156, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_157, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_158, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_159, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_160, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_161, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_162, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_163, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_164, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_165, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_166, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_167, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_168, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_169, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_170, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_171, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_172, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_173, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_174, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_175, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_176, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_177, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_178, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_179, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_180, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_181, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_182, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_183, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_184, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_185, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_186, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_187, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_188, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_188);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_189, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_189);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_190, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_190);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_191, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_191);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_192, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_192);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_193, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_193);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_194, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_194);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_195, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_195);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_196, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_196);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_197, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_197);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_198, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_198);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_199, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_199);
+
@@ -0,0 +1,278 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/scaled_inv_chi_square/scaled_inv_chi_square_ccdf_log_test.hpp>
+
+typedef std::tuple<var, var, std::vector<double>, empty, empty, empty> type_vv_100;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_101;
+typedef std::tuple<var, var, var, empty, empty, empty> type_vv_102;
+typedef std::tuple<var, var, std::vector<var>, empty, empty, empty> type_vv_103;
+typedef std::tuple<var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_104;
+typedef std::tuple<var, std::vector<var>, double, empty, empty, empty> type_vv_105;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_106;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_107;
+typedef std::tuple<var, std::vector<var>, var, empty, empty, empty> type_vv_108;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_109;
+typedef std::tuple<var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_110;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_111;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_112;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_113;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_114;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_115;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_116;
+typedef std::tuple<std::vector<var>, double, double, empty, empty, empty> type_vv_117;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, empty, empty, empty> type_vv_118;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_119;
+typedef std::tuple<std::vector<var>, double, var, empty, empty, empty> type_vv_120;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, empty, empty, empty> type_vv_121;
+typedef std::tuple<std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_122;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, empty, empty, empty> type_vv_123;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_124;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_125;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, empty, empty, empty> type_vv_126;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_127;
+typedef std::tuple<std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_128;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_129;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_130;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_131;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_132;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_133;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_134;
+typedef std::tuple<std::vector<var>, var, double, empty, empty, empty> type_vv_135;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, empty, empty, empty> type_vv_136;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_137;
+typedef std::tuple<std::vector<var>, var, var, empty, empty, empty> type_vv_138;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, empty, empty, empty> type_vv_139;
+typedef std::tuple<std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_140;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, empty, empty, empty> type_vv_141;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_142;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_143;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, empty, empty, empty> type_vv_144;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_145;
+typedef std::tuple<std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_146;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_147;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_148;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_149;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_150;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_151;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_152;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, empty, empty, empty> type_vv_153;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, empty, empty, empty> type_vv_154;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_155;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, empty, empty, empty> type_vv_156;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, empty, empty, empty> type_vv_157;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_158;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, empty, empty, empty> type_vv_159;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_160;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_161;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, empty, empty, empty> type_vv_162;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_163;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_164;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_165;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_166;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_167;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_168;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_169;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_170;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, empty, empty, empty> type_vv_171;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, empty, empty, empty> type_vv_172;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_173;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, empty, empty, empty> type_vv_174;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, empty, empty, empty> type_vv_175;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_176;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, empty, empty, empty> type_vv_177;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_178;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_179;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, empty, empty, empty> type_vv_180;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_181;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_182;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_183;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_184;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_185;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_186;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_187;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_188;
+
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_100> AgradCcdfLogScaledInvChiSquare_vv_100;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_101> AgradCcdfLogScaledInvChiSquare_vv_101;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_102> AgradCcdfLogScaledInvChiSquare_vv_102;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_103> AgradCcdfLogScaledInvChiSquare_vv_103;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_104> AgradCcdfLogScaledInvChiSquare_vv_104;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_105> AgradCcdfLogScaledInvChiSquare_vv_105;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_106> AgradCcdfLogScaledInvChiSquare_vv_106;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_107> AgradCcdfLogScaledInvChiSquare_vv_107;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_108> AgradCcdfLogScaledInvChiSquare_vv_108;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_109> AgradCcdfLogScaledInvChiSquare_vv_109;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_110> AgradCcdfLogScaledInvChiSquare_vv_110;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_111> AgradCcdfLogScaledInvChiSquare_vv_111;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_112> AgradCcdfLogScaledInvChiSquare_vv_112;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_113> AgradCcdfLogScaledInvChiSquare_vv_113;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_114> AgradCcdfLogScaledInvChiSquare_vv_114;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_115> AgradCcdfLogScaledInvChiSquare_vv_115;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_116> AgradCcdfLogScaledInvChiSquare_vv_116;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_117> AgradCcdfLogScaledInvChiSquare_vv_117;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_118> AgradCcdfLogScaledInvChiSquare_vv_118;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_119> AgradCcdfLogScaledInvChiSquare_vv_119;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_120> AgradCcdfLogScaledInvChiSquare_vv_120;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_121> AgradCcdfLogScaledInvChiSquare_vv_121;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_122> AgradCcdfLogScaledInvChiSquare_vv_122;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_123> AgradCcdfLogScaledInvChiSquare_vv_123;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_124> AgradCcdfLogScaledInvChiSquare_vv_124;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_125> AgradCcdfLogScaledInvChiSquare_vv_125;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_126> AgradCcdfLogScaledInvChiSquare_vv_126;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_127> AgradCcdfLogScaledInvChiSquare_vv_127;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_128> AgradCcdfLogScaledInvChiSquare_vv_128;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_129> AgradCcdfLogScaledInvChiSquare_vv_129;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_130> AgradCcdfLogScaledInvChiSquare_vv_130;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_131> AgradCcdfLogScaledInvChiSquare_vv_131;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_132> AgradCcdfLogScaledInvChiSquare_vv_132;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_133> AgradCcdfLogScaledInvChiSquare_vv_133;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_134> AgradCcdfLogScaledInvChiSquare_vv_134;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_135> AgradCcdfLogScaledInvChiSquare_vv_135;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_136> AgradCcdfLogScaledInvChiSquare_vv_136;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_137> AgradCcdfLogScaledInvChiSquare_vv_137;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_138> AgradCcdfLogScaledInvChiSquare_vv_138;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_139> AgradCcdfLogScaledInvChiSquare_vv_139;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_140> AgradCcdfLogScaledInvChiSquare_vv_140;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_141> AgradCcdfLogScaledInvChiSquare_vv_141;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_142> AgradCcdfLogScaledInvChiSquare_vv_142;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_143> AgradCcdfLogScaledInvChiSquare_vv_143;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_144> AgradCcdfLogScaledInvChiSquare_vv_144;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_145> AgradCcdfLogScaledInvChiSquare_vv_145;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_146> AgradCcdfLogScaledInvChiSquare_vv_146;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_147> AgradCcdfLogScaledInvChiSquare_vv_147;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_148> AgradCcdfLogScaledInvChiSquare_vv_148;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_149> AgradCcdfLogScaledInvChiSquare_vv_149;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_150> AgradCcdfLogScaledInvChiSquare_vv_150;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_151> AgradCcdfLogScaledInvChiSquare_vv_151;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_152> AgradCcdfLogScaledInvChiSquare_vv_152;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_153> AgradCcdfLogScaledInvChiSquare_vv_153;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_154> AgradCcdfLogScaledInvChiSquare_vv_154;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_155> AgradCcdfLogScaledInvChiSquare_vv_155;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_156> AgradCcdfLogScaledInvChiSquare_vv_156;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_157> AgradCcdfLogScaledInvChiSquare_vv_157;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_158> AgradCcdfLogScaledInvChiSquare_vv_158;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_159> AgradCcdfLogScaledInvChiSquare_vv_159;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_160> AgradCcdfLogScaledInvChiSquare_vv_160;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_161> AgradCcdfLogScaledInvChiSquare_vv_161;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_162> AgradCcdfLogScaledInvChiSquare_vv_162;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_163> AgradCcdfLogScaledInvChiSquare_vv_163;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_164> AgradCcdfLogScaledInvChiSquare_vv_164;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_165> AgradCcdfLogScaledInvChiSquare_vv_165;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_166> AgradCcdfLogScaledInvChiSquare_vv_166;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_167> AgradCcdfLogScaledInvChiSquare_vv_167;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_168> AgradCcdfLogScaledInvChiSquare_vv_168;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_169> AgradCcdfLogScaledInvChiSquare_vv_169;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_170> AgradCcdfLogScaledInvChiSquare_vv_170;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_171> AgradCcdfLogScaledInvChiSquare_vv_171;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_172> AgradCcdfLogScaledInvChiSquare_vv_172;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_173> AgradCcdfLogScaledInvChiSquare_vv_173;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_174> AgradCcdfLogScaledInvChiSquare_vv_174;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_175> AgradCcdfLogScaledInvChiSquare_vv_175;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_176> AgradCcdfLogScaledInvChiSquare_vv_176;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_177> AgradCcdfLogScaledInvChiSquare_vv_177;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_178> AgradCcdfLogScaledInvChiSquare_vv_178;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_179> AgradCcdfLogScaledInvChiSquare_vv_179;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_180> AgradCcdfLogScaledInvChiSquare_vv_180;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_181> AgradCcdfLogScaledInvChiSquare_vv_181;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_182> AgradCcdfLogScaledInvChiSquare_vv_182;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_183> AgradCcdfLogScaledInvChiSquare_vv_183;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_184> AgradCcdfLogScaledInvChiSquare_vv_184;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_185> AgradCcdfLogScaledInvChiSquare_vv_185;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_186> AgradCcdfLogScaledInvChiSquare_vv_186;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_187> AgradCcdfLogScaledInvChiSquare_vv_187;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_vv_188> AgradCcdfLogScaledInvChiSquare_vv_188;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_100, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_101, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_102, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_103, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_104, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_105, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_106, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_107, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_108, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_109, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_110, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_111, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_112, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_113, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_114, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_115, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_116, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_117, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_118, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_119, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_120, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_121, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_122, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_123, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_124, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_125, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_126, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_127, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_128, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_129, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_130, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_131, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_132, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_133, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_134, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_135, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_136, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_137, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_138, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_139, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_140, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_141, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_142, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_143, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_144, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_145, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_146, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_147, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_148, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_149, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_150, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_151, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_152, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_153, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_154, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_155, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_156, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_157, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_158, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_159, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_160, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_161, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_162, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_163, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_164, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_165, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_166, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_167, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_168, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_169, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_170, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_171, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_172, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_173, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_174, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_175, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_176, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_177, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_178, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_179, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_180, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_181, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_182, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_183, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_184, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_185, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_186, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_187, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_vv_188, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_vv_188);
+
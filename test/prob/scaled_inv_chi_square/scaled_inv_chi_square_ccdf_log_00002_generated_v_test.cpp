@@ -0,0 +1,59 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/scaled_inv_chi_square/scaled_inv_chi_square_ccdf_log_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_200;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_v_201;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_v_202;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_203;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_v_204;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_205;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_206;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_v_207;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_208;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_209;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_210;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_211;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_212;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_213;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_214;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_215;
+
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_200> AgradCcdfLogScaledInvChiSquare_v_200;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_201> AgradCcdfLogScaledInvChiSquare_v_201;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_202> AgradCcdfLogScaledInvChiSquare_v_202;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_203> AgradCcdfLogScaledInvChiSquare_v_203;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_204> AgradCcdfLogScaledInvChiSquare_v_204;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_205> AgradCcdfLogScaledInvChiSquare_v_205;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_206> AgradCcdfLogScaledInvChiSquare_v_206;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_207> AgradCcdfLogScaledInvChiSquare_v_207;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_208> AgradCcdfLogScaledInvChiSquare_v_208;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_209> AgradCcdfLogScaledInvChiSquare_v_209;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_210> AgradCcdfLogScaledInvChiSquare_v_210;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_211> AgradCcdfLogScaledInvChiSquare_v_211;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_212> AgradCcdfLogScaledInvChiSquare_v_212;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_213> AgradCcdfLogScaledInvChiSquare_v_213;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_214> AgradCcdfLogScaledInvChiSquare_v_214;
+typedef std::tuple<AgradCcdfLogScaledInvChiSquare, type_v_215> AgradCcdfLogScaledInvChiSquare_v_215;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_200, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_200);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_201, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_201);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_202, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_202);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_203, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_203);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_204, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_204);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_205, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_205);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_206, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_206);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_207, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_207);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_208, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_208);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_209, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_209);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_210, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_210);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_211, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_211);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_212, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_212);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_213, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_213);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_214, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_214);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogScaledInvChiSquare_v_215, AgradCcdfLogTestFixture, AgradCcdfLogScaledInvChiSquare_v_215);
+
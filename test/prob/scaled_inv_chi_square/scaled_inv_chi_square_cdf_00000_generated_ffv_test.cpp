@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/scaled_inv_chi_square/scaled_inv_chi_square_cdf_test.hpp>
+
+typedef std::tuple<double, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_0;
+typedef std::tuple<double, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_1;
+typedef std::tuple<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_2;
+typedef std::tuple<double, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_3;
+typedef std::tuple<double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_4;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_5;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_6;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_7;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_8;
+typedef std::tuple<double, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_9;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_10;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_11;
+typedef std::tuple<double, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_12;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_13;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_14;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_15;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_16;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_17;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_18;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_19;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_20;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_21;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_22;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_23;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_24;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_25;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_26;
+typedef std::tuple<std::vector<double>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_27;
+typedef std::tuple<std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_28;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_29;
+typedef std::tuple<std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_30;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_31;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_32;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_33;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_34;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_35;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_36;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_37;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_38;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_39;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_40;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_41;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_42;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_43;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_44;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_45;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_46;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_47;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_48;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_49;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_50;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_51;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_52;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_53;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_54;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_55;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_56;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_57;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_58;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_59;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_60;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_61;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_62;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_63;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_64;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_65;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_66;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_67;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_68;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_69;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_70;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_80;
+typedef std::tuple<fvar<fvar<var> >, double, double, empty, empty, empty> type_ffv_81;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<double>, empty, empty, empty> type_ffv_82;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_83;
+typedef std::tuple<fvar<fvar<var> >, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_84;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_85;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_86;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, double, empty, empty, empty> type_ffv_87;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_88;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_89;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_90;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_91;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_92;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_93;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_94;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_95;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_96;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_97;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_98;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_99;
+
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_0> AgradCdfScaledInvChiSquare_ffv_0;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_1> AgradCdfScaledInvChiSquare_ffv_1;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_2> AgradCdfScaledInvChiSquare_ffv_2;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_3> AgradCdfScaledInvChiSquare_ffv_3;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_4> AgradCdfScaledInvChiSquare_ffv_4;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_5> AgradCdfScaledInvChiSquare_ffv_5;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_6> AgradCdfScaledInvChiSquare_ffv_6;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_7> AgradCdfScaledInvChiSquare_ffv_7;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_8> AgradCdfScaledInvChiSquare_ffv_8;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_9> AgradCdfScaledInvChiSquare_ffv_9;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_10> AgradCdfScaledInvChiSquare_ffv_10;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_11> AgradCdfScaledInvChiSquare_ffv_11;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_12> AgradCdfScaledInvChiSquare_ffv_12;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_13> AgradCdfScaledInvChiSquare_ffv_13;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_14> AgradCdfScaledInvChiSquare_ffv_14;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_15> AgradCdfScaledInvChiSquare_ffv_15;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_16> AgradCdfScaledInvChiSquare_ffv_16;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_17> AgradCdfScaledInvChiSquare_ffv_17;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_18> AgradCdfScaledInvChiSquare_ffv_18;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_19> AgradCdfScaledInvChiSquare_ffv_19;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_20> AgradCdfScaledInvChiSquare_ffv_20;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_21> AgradCdfScaledInvChiSquare_ffv_21;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_22> AgradCdfScaledInvChiSquare_ffv_22;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_23> AgradCdfScaledInvChiSquare_ffv_23;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_24> AgradCdfScaledInvChiSquare_ffv_24;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_25> AgradCdfScaledInvChiSquare_ffv_25;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_26> AgradCdfScaledInvChiSquare_ffv_26;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_27> AgradCdfScaledInvChiSquare_ffv_27;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_28> AgradCdfScaledInvChiSquare_ffv_28;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_29> AgradCdfScaledInvChiSquare_ffv_29;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_30> AgradCdfScaledInvChiSquare_ffv_30;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_31> AgradCdfScaledInvChiSquare_ffv_31;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_32> AgradCdfScaledInvChiSquare_ffv_32;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_33> AgradCdfScaledInvChiSquare_ffv_33;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_34> AgradCdfScaledInvChiSquare_ffv_34;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_35> AgradCdfScaledInvChiSquare_ffv_35;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_36> AgradCdfScaledInvChiSquare_ffv_36;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_37> AgradCdfScaledInvChiSquare_ffv_37;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_38> AgradCdfScaledInvChiSquare_ffv_38;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_39> AgradCdfScaledInvChiSquare_ffv_39;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_40> AgradCdfScaledInvChiSquare_ffv_40;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_41> AgradCdfScaledInvChiSquare_ffv_41;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_42> AgradCdfScaledInvChiSquare_ffv_42;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_43> AgradCdfScaledInvChiSquare_ffv_43;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_44> AgradCdfScaledInvChiSquare_ffv_44;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_45> AgradCdfScaledInvChiSquare_ffv_45;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_46> AgradCdfScaledInvChiSquare_ffv_46;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_47> AgradCdfScaledInvChiSquare_ffv_47;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_48> AgradCdfScaledInvChiSquare_ffv_48;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_49> AgradCdfScaledInvChiSquare_ffv_49;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_50> AgradCdfScaledInvChiSquare_ffv_50;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_51> AgradCdfScaledInvChiSquare_ffv_51;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_52> AgradCdfScaledInvChiSquare_ffv_52;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_53> AgradCdfScaledInvChiSquare_ffv_53;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_54> AgradCdfScaledInvChiSquare_ffv_54;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_55> AgradCdfScaledInvChiSquare_ffv_55;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_56> AgradCdfScaledInvChiSquare_ffv_56;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_57> AgradCdfScaledInvChiSquare_ffv_57;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_58> AgradCdfScaledInvChiSquare_ffv_58;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_59> AgradCdfScaledInvChiSquare_ffv_59;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_60> AgradCdfScaledInvChiSquare_ffv_60;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_61> AgradCdfScaledInvChiSquare_ffv_61;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_62> AgradCdfScaledInvChiSquare_ffv_62;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_63> AgradCdfScaledInvChiSquare_ffv_63;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_64> AgradCdfScaledInvChiSquare_ffv_64;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_65> AgradCdfScaledInvChiSquare_ffv_65;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_66> AgradCdfScaledInvChiSquare_ffv_66;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_67> AgradCdfScaledInvChiSquare_ffv_67;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_68> AgradCdfScaledInvChiSquare_ffv_68;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_69> AgradCdfScaledInvChiSquare_ffv_69;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_70> AgradCdfScaledInvChiSquare_ffv_70;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_71> AgradCdfScaledInvChiSquare_ffv_71;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_72> AgradCdfScaledInvChiSquare_ffv_72;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_73> AgradCdfScaledInvChiSquare_ffv_73;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_74> AgradCdfScaledInvChiSquare_ffv_74;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_75> AgradCdfScaledInvChiSquare_ffv_75;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_76> AgradCdfScaledInvChiSquare_ffv_76;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_77> AgradCdfScaledInvChiSquare_ffv_77;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_78> AgradCdfScaledInvChiSquare_ffv_78;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_79> AgradCdfScaledInvChiSquare_ffv_79;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_80> AgradCdfScaledInvChiSquare_ffv_80;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_81> AgradCdfScaledInvChiSquare_ffv_81;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_82> AgradCdfScaledInvChiSquare_ffv_82;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_83> AgradCdfScaledInvChiSquare_ffv_83;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_84> AgradCdfScaledInvChiSquare_ffv_84;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_85> AgradCdfScaledInvChiSquare_ffv_85;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_86> AgradCdfScaledInvChiSquare_ffv_86;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_87> AgradCdfScaledInvChiSquare_ffv_87;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_88> AgradCdfScaledInvChiSquare_ffv_88;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_89> AgradCdfScaledInvChiSquare_ffv_89;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_90> AgradCdfScaledInvChiSquare_ffv_90;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_91> AgradCdfScaledInvChiSquare_ffv_91;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_92> AgradCdfScaledInvChiSquare_ffv_92;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_93> AgradCdfScaledInvChiSquare_ffv_93;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_94> AgradCdfScaledInvChiSquare_ffv_94;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_95> AgradCdfScaledInvChiSquare_ffv_95;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_96> AgradCdfScaledInvChiSquare_ffv_96;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_97> AgradCdfScaledInvChiSquare_ffv_97;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_98> AgradCdfScaledInvChiSquare_ffv_98;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_99> AgradCdfScaledInvChiSquare_ffv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_0, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_1, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_2, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_3, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_4, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_5, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_6, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_7, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_8, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_9, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_10, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_11, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_12, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_13, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_14, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_15, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_16, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_17, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_18, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_19, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_20, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_21, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_22, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_23, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_24, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_25, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_26, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_27, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_28, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_29, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_30, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_31, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_32, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_33, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_34, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_35, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_36, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_37, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_38, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_39, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_40, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_41, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_42, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_43, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_44, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_45, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_46, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_47, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_48, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_49, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_50, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_51, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_52, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_53, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_54, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_55, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_56, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_57, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_58, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_59, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_60, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_61, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_62, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_63, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_64, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_65, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_66, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_67, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_68, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_69, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_70, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_71, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_72, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_73, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_74, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_75, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_76, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_77, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_78, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_79, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_80, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_81, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_82, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_83, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_84, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_85, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_86, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_87, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_88, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_89, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_90, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_91, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_92, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_93, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_94, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_95, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_96, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_97, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_98, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_99, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_99);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/scaled_inv_chi_square/scaled_inv_chi_square_cdf_test.hpp>
+
+typedef std::tuple<double, double, double, empty, empty, empty> type_v_0;
+typedef std::tuple<double, double, std::vector<double>, empty, empty, empty> type_v_1;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_2;
+typedef std::tuple<double, double, var, empty, empty, empty> type_v_3;
+typedef std::tuple<double, double, std::vector<var>, empty, empty, empty> type_v_4;
+typedef std::tuple<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_5;
+typedef std::tuple<double, std::vector<double>, double, empty, empty, empty> type_v_6;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_7;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_8;
+typedef std::tuple<double, std::vector<double>, var, empty, empty, empty> type_v_9;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_10;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_11;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_12;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_13;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_14;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_15;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_16;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_17;
+typedef std::tuple<double, var, double, empty, empty, empty> type_v_18;
+typedef std::tuple<double, var, std::vector<double>, empty, empty, empty> type_v_19;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_20;
+typedef std::tuple<double, var, var, empty, empty, empty> type_v_21;
+typedef std::tuple<double, var, std::vector<var>, empty, empty, empty> type_v_22;
+typedef std::tuple<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_23;
+typedef std::tuple<double, std::vector<var>, double, empty, empty, empty> type_v_24;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_25;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_26;
+typedef std::tuple<double, std::vector<var>, var, empty, empty, empty> type_v_27;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_28;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_29;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_30;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_31;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_32;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_33;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_34;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_35;
+typedef std::tuple<std::vector<double>, double, double, empty, empty, empty> type_v_36;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, empty, empty, empty> type_v_37;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_38;
+typedef std::tuple<std::vector<double>, double, var, empty, empty, empty> type_v_39;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, empty, empty, empty> type_v_40;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_41;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, empty, empty, empty> type_v_42;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_43;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_44;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, empty, empty, empty> type_v_45;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_46;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_47;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_48;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_49;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_50;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_51;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_52;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_53;
+typedef std::tuple<std::vector<double>, var, double, empty, empty, empty> type_v_54;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, empty, empty, empty> type_v_55;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_56;
+typedef std::tuple<std::vector<double>, var, var, empty, empty, empty> type_v_57;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, empty, empty, empty> type_v_58;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_59;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, empty, empty, empty> type_v_60;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_61;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_62;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, empty, empty, empty> type_v_63;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_64;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_65;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_66;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_67;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_68;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_69;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_70;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_v_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_v_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_v_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_v_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_v_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_80;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_v_81;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_82;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_83;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_84;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_85;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_86;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_87;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_88;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_89;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_v_90;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_v_91;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_92;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_v_93;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_v_94;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_95;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_v_96;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_97;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_98;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_v_99;
+
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_0> AgradCdfScaledInvChiSquare_v_0;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_1> AgradCdfScaledInvChiSquare_v_1;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_2> AgradCdfScaledInvChiSquare_v_2;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_3> AgradCdfScaledInvChiSquare_v_3;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_4> AgradCdfScaledInvChiSquare_v_4;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_5> AgradCdfScaledInvChiSquare_v_5;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_6> AgradCdfScaledInvChiSquare_v_6;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_7> AgradCdfScaledInvChiSquare_v_7;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_8> AgradCdfScaledInvChiSquare_v_8;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_9> AgradCdfScaledInvChiSquare_v_9;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_10> AgradCdfScaledInvChiSquare_v_10;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_11> AgradCdfScaledInvChiSquare_v_11;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_12> AgradCdfScaledInvChiSquare_v_12;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_13> AgradCdfScaledInvChiSquare_v_13;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_14> AgradCdfScaledInvChiSquare_v_14;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_15> AgradCdfScaledInvChiSquare_v_15;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_16> AgradCdfScaledInvChiSquare_v_16;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_17> AgradCdfScaledInvChiSquare_v_17;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_18> AgradCdfScaledInvChiSquare_v_18;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_19> AgradCdfScaledInvChiSquare_v_19;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_20> AgradCdfScaledInvChiSquare_v_20;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_21> AgradCdfScaledInvChiSquare_v_21;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_22> AgradCdfScaledInvChiSquare_v_22;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_23> AgradCdfScaledInvChiSquare_v_23;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_24> AgradCdfScaledInvChiSquare_v_24;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_25> AgradCdfScaledInvChiSquare_v_25;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_26> AgradCdfScaledInvChiSquare_v_26;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_27> AgradCdfScaledInvChiSquare_v_27;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_28> AgradCdfScaledInvChiSquare_v_28;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_29> AgradCdfScaledInvChiSquare_v_29;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_30> AgradCdfScaledInvChiSquare_v_30;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_31> AgradCdfScaledInvChiSquare_v_31;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_32> AgradCdfScaledInvChiSquare_v_32;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_33> AgradCdfScaledInvChiSquare_v_33;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_34> AgradCdfScaledInvChiSquare_v_34;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_35> AgradCdfScaledInvChiSquare_v_35;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_36> AgradCdfScaledInvChiSquare_v_36;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_37> AgradCdfScaledInvChiSquare_v_37;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_38> AgradCdfScaledInvChiSquare_v_38;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_39> AgradCdfScaledInvChiSquare_v_39;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_40> AgradCdfScaledInvChiSquare_v_40;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_41> AgradCdfScaledInvChiSquare_v_41;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_42> AgradCdfScaledInvChiSquare_v_42;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_43> AgradCdfScaledInvChiSquare_v_43;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_44> AgradCdfScaledInvChiSquare_v_44;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_45> AgradCdfScaledInvChiSquare_v_45;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_46> AgradCdfScaledInvChiSquare_v_46;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_47> AgradCdfScaledInvChiSquare_v_47;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_48> AgradCdfScaledInvChiSquare_v_48;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_49> AgradCdfScaledInvChiSquare_v_49;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_50> AgradCdfScaledInvChiSquare_v_50;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_51> AgradCdfScaledInvChiSquare_v_51;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_52> AgradCdfScaledInvChiSquare_v_52;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_53> AgradCdfScaledInvChiSquare_v_53;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_54> AgradCdfScaledInvChiSquare_v_54;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_55> AgradCdfScaledInvChiSquare_v_55;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_56> AgradCdfScaledInvChiSquare_v_56;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_57> AgradCdfScaledInvChiSquare_v_57;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_58> AgradCdfScaledInvChiSquare_v_58;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_59> AgradCdfScaledInvChiSquare_v_59;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_60> AgradCdfScaledInvChiSquare_v_60;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_61> AgradCdfScaledInvChiSquare_v_61;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_62> AgradCdfScaledInvChiSquare_v_62;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_63> AgradCdfScaledInvChiSquare_v_63;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_64> AgradCdfScaledInvChiSquare_v_64;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_65> AgradCdfScaledInvChiSquare_v_65;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_66> AgradCdfScaledInvChiSquare_v_66;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_67> AgradCdfScaledInvChiSquare_v_67;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_68> AgradCdfScaledInvChiSquare_v_68;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_69> AgradCdfScaledInvChiSquare_v_69;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_70> AgradCdfScaledInvChiSquare_v_70;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_71> AgradCdfScaledInvChiSquare_v_71;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_72> AgradCdfScaledInvChiSquare_v_72;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_73> AgradCdfScaledInvChiSquare_v_73;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_74> AgradCdfScaledInvChiSquare_v_74;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_75> AgradCdfScaledInvChiSquare_v_75;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_76> AgradCdfScaledInvChiSquare_v_76;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_77> AgradCdfScaledInvChiSquare_v_77;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_78> AgradCdfScaledInvChiSquare_v_78;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_79> AgradCdfScaledInvChiSquare_v_79;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_80> AgradCdfScaledInvChiSquare_v_80;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_81> AgradCdfScaledInvChiSquare_v_81;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_82> AgradCdfScaledInvChiSquare_v_82;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_83> AgradCdfScaledInvChiSquare_v_83;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_84> AgradCdfScaledInvChiSquare_v_84;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_85> AgradCdfScaledInvChiSquare_v_85;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_86> AgradCdfScaledInvChiSquare_v_86;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_87> AgradCdfScaledInvChiSquare_v_87;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_88> AgradCdfScaledInvChiSquare_v_88;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_89> AgradCdfScaledInvChiSquare_v_89;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_90> AgradCdfScaledInvChiSquare_v_90;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_91> AgradCdfScaledInvChiSquare_v_91;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_92> AgradCdfScaledInvChiSquare_v_92;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_93> AgradCdfScaledInvChiSquare_v_93;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_94> AgradCdfScaledInvChiSquare_v_94;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_95> AgradCdfScaledInvChiSquare_v_95;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_96> AgradCdfScaledInvChiSquare_v_96;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_97> AgradCdfScaledInvChiSquare_v_97;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_98> AgradCdfScaledInvChiSquare_v_98;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_99> AgradCdfScaledInvChiSquare_v_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_0, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_1, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_2, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_3, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_4, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_5, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_6, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_7, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_8, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_9, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_10, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_11, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_12, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_13, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_14, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_15, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_16, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_17, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_18, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_19, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_20, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_21, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_22, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_23, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_24, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_25, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_26, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_27, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_28, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_29, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_30, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_31, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_32, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_33, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_34, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_35, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_36, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_37, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_38, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_39, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_40, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_41, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_42, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_43, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_44, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_45, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_46, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_47, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_48, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_49, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_50, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_51, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_52, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_53, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_54, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_55, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_56, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_57, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_58, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_59, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_60, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_61, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_62, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_63, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_64, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_65, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_66, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_67, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_68, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_69, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_70, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_71, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_72, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_73, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_74, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_75, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_76, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_77, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_78, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_79, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_80, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_81, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_82, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_83, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_84, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_85, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_86, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_87, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_88, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_89, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_90, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_91, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_92, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_93, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_94, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_95, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_96, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_97, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_98, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_99, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_99);
+
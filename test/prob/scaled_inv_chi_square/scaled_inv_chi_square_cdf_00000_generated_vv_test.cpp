@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/scaled_inv_chi_square/scaled_inv_chi_square_cdf_test.hpp>
+
+typedef std::tuple<double, double, var, empty, empty, empty> type_vv_0;
+typedef std::tuple<double, double, std::vector<var>, empty, empty, empty> type_vv_1;
+typedef std::tuple<double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_2;
+typedef std::tuple<double, std::vector<double>, var, empty, empty, empty> type_vv_3;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_4;
+typedef std::tuple<double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_5;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_6;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_7;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_8;
+typedef std::tuple<double, var, double, empty, empty, empty> type_vv_9;
+typedef std::tuple<double, var, std::vector<double>, empty, empty, empty> type_vv_10;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_11;
+typedef std::tuple<double, var, var, empty, empty, empty> type_vv_12;
+typedef std::tuple<double, var, std::vector<var>, empty, empty, empty> type_vv_13;
+typedef std::tuple<double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_14;
+typedef std::tuple<double, std::vector<var>, double, empty, empty, empty> type_vv_15;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_16;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_17;
+typedef std::tuple<double, std::vector<var>, var, empty, empty, empty> type_vv_18;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_19;
+typedef std::tuple<double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_20;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_21;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_22;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_23;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_24;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_25;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_26;
+typedef std::tuple<std::vector<double>, double, var, empty, empty, empty> type_vv_27;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, empty, empty, empty> type_vv_28;
+typedef std::tuple<std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_29;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, empty, empty, empty> type_vv_30;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_31;
+typedef std::tuple<std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_32;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_33;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_34;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_35;
+typedef std::tuple<std::vector<double>, var, double, empty, empty, empty> type_vv_36;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, empty, empty, empty> type_vv_37;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_38;
+typedef std::tuple<std::vector<double>, var, var, empty, empty, empty> type_vv_39;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, empty, empty, empty> type_vv_40;
+typedef std::tuple<std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_41;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, empty, empty, empty> type_vv_42;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_43;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_44;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, empty, empty, empty> type_vv_45;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_46;
+typedef std::tuple<std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_47;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_48;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_49;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_50;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_51;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_52;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_53;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_vv_54;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_vv_55;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_56;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_vv_57;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_58;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_59;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_60;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_61;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_62;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_vv_63;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_vv_64;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_65;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_vv_66;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_vv_67;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_68;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_vv_69;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_70;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_vv_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_80;
+typedef std::tuple<var, double, double, empty, empty, empty> type_vv_81;
+typedef std::tuple<var, double, std::vector<double>, empty, empty, empty> type_vv_82;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_83;
+typedef std::tuple<var, double, var, empty, empty, empty> type_vv_84;
+typedef std::tuple<var, double, std::vector<var>, empty, empty, empty> type_vv_85;
+typedef std::tuple<var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_86;
+typedef std::tuple<var, std::vector<double>, double, empty, empty, empty> type_vv_87;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_88;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_89;
+typedef std::tuple<var, std::vector<double>, var, empty, empty, empty> type_vv_90;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_91;
+typedef std::tuple<var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_92;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_93;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_94;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_95;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_96;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_97;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_98;
+typedef std::tuple<var, var, double, empty, empty, empty> type_vv_99;
+
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_0> AgradCdfScaledInvChiSquare_vv_0;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_1> AgradCdfScaledInvChiSquare_vv_1;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_2> AgradCdfScaledInvChiSquare_vv_2;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_3> AgradCdfScaledInvChiSquare_vv_3;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_4> AgradCdfScaledInvChiSquare_vv_4;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_5> AgradCdfScaledInvChiSquare_vv_5;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_6> AgradCdfScaledInvChiSquare_vv_6;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_7> AgradCdfScaledInvChiSquare_vv_7;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_8> AgradCdfScaledInvChiSquare_vv_8;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_9> AgradCdfScaledInvChiSquare_vv_9;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_10> AgradCdfScaledInvChiSquare_vv_10;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_11> AgradCdfScaledInvChiSquare_vv_11;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_12> AgradCdfScaledInvChiSquare_vv_12;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_13> AgradCdfScaledInvChiSquare_vv_13;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_14> AgradCdfScaledInvChiSquare_vv_14;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_15> AgradCdfScaledInvChiSquare_vv_15;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_16> AgradCdfScaledInvChiSquare_vv_16;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_17> AgradCdfScaledInvChiSquare_vv_17;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_18> AgradCdfScaledInvChiSquare_vv_18;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_19> AgradCdfScaledInvChiSquare_vv_19;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_20> AgradCdfScaledInvChiSquare_vv_20;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_21> AgradCdfScaledInvChiSquare_vv_21;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_22> AgradCdfScaledInvChiSquare_vv_22;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_23> AgradCdfScaledInvChiSquare_vv_23;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_24> AgradCdfScaledInvChiSquare_vv_24;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_25> AgradCdfScaledInvChiSquare_vv_25;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_26> AgradCdfScaledInvChiSquare_vv_26;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_27> AgradCdfScaledInvChiSquare_vv_27;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_28> AgradCdfScaledInvChiSquare_vv_28;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_29> AgradCdfScaledInvChiSquare_vv_29;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_30> AgradCdfScaledInvChiSquare_vv_30;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_31> AgradCdfScaledInvChiSquare_vv_31;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_32> AgradCdfScaledInvChiSquare_vv_32;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_33> AgradCdfScaledInvChiSquare_vv_33;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_34> AgradCdfScaledInvChiSquare_vv_34;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_35> AgradCdfScaledInvChiSquare_vv_35;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_36> AgradCdfScaledInvChiSquare_vv_36;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_37> AgradCdfScaledInvChiSquare_vv_37;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_38> AgradCdfScaledInvChiSquare_vv_38;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_39> AgradCdfScaledInvChiSquare_vv_39;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_40> AgradCdfScaledInvChiSquare_vv_40;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_41> AgradCdfScaledInvChiSquare_vv_41;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_42> AgradCdfScaledInvChiSquare_vv_42;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_43> AgradCdfScaledInvChiSquare_vv_43;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_44> AgradCdfScaledInvChiSquare_vv_44;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_45> AgradCdfScaledInvChiSquare_vv_45;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_46> AgradCdfScaledInvChiSquare_vv_46;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_47> AgradCdfScaledInvChiSquare_vv_47;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_48> AgradCdfScaledInvChiSquare_vv_48;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_49> AgradCdfScaledInvChiSquare_vv_49;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_50> AgradCdfScaledInvChiSquare_vv_50;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_51> AgradCdfScaledInvChiSquare_vv_51;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_52> AgradCdfScaledInvChiSquare_vv_52;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_53> AgradCdfScaledInvChiSquare_vv_53;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_54> AgradCdfScaledInvChiSquare_vv_54;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_55> AgradCdfScaledInvChiSquare_vv_55;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_56> AgradCdfScaledInvChiSquare_vv_56;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_57> AgradCdfScaledInvChiSquare_vv_57;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_58> AgradCdfScaledInvChiSquare_vv_58;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_59> AgradCdfScaledInvChiSquare_vv_59;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_60> AgradCdfScaledInvChiSquare_vv_60;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_61> AgradCdfScaledInvChiSquare_vv_61;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_62> AgradCdfScaledInvChiSquare_vv_62;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_63> AgradCdfScaledInvChiSquare_vv_63;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_64> AgradCdfScaledInvChiSquare_vv_64;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_65> AgradCdfScaledInvChiSquare_vv_65;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_66> AgradCdfScaledInvChiSquare_vv_66;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_67> AgradCdfScaledInvChiSquare_vv_67;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_68> AgradCdfScaledInvChiSquare_vv_68;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_69> AgradCdfScaledInvChiSquare_vv_69;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_70> AgradCdfScaledInvChiSquare_vv_70;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_71> AgradCdfScaledInvChiSquare_vv_71;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_72> AgradCdfScaledInvChiSquare_vv_72;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_73> AgradCdfScaledInvChiSquare_vv_73;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_74> AgradCdfScaledInvChiSquare_vv_74;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_75> AgradCdfScaledInvChiSquare_vv_75;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_76> AgradCdfScaledInvChiSquare_vv_76;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_77> AgradCdfScaledInvChiSquare_vv_77;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_78> AgradCdfScaledInvChiSquare_vv_78;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_79> AgradCdfScaledInvChiSquare_vv_79;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_80> AgradCdfScaledInvChiSquare_vv_80;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_81> AgradCdfScaledInvChiSquare_vv_81;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_82> AgradCdfScaledInvChiSquare_vv_82;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_83> AgradCdfScaledInvChiSquare_vv_83;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_84> AgradCdfScaledInvChiSquare_vv_84;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_85> AgradCdfScaledInvChiSquare_vv_85;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_86> AgradCdfScaledInvChiSquare_vv_86;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_87> AgradCdfScaledInvChiSquare_vv_87;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_88> AgradCdfScaledInvChiSquare_vv_88;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_89> AgradCdfScaledInvChiSquare_vv_89;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_90> AgradCdfScaledInvChiSquare_vv_90;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_91> AgradCdfScaledInvChiSquare_vv_91;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_92> AgradCdfScaledInvChiSquare_vv_92;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_93> AgradCdfScaledInvChiSquare_vv_93;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_94> AgradCdfScaledInvChiSquare_vv_94;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_95> AgradCdfScaledInvChiSquare_vv_95;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_96> AgradCdfScaledInvChiSquare_vv_96;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_97> AgradCdfScaledInvChiSquare_vv_97;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_98> AgradCdfScaledInvChiSquare_vv_98;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_99> AgradCdfScaledInvChiSquare_vv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_0, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_1, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_2, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_3, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_4, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_5, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_6, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_7, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_8, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_9, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_10, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_11, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_12, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_13, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_14, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_15, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_16, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_17, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_18, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_19, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_20, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_21, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_22, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_23, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_24, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_25, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_26, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_27, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_28, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_29, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_30, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_31, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_32, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_33, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_34, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_35, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_36, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_37, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_38, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_39, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_40, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_41, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_42, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_43, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_44, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_45, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_46, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_47, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_48, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_49, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_50, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_51, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_52, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_53, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_54, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_55, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_56, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_57, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_58, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_59, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_60, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_61, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_62, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_63, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_64, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_65, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_66, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_67, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_68, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_69, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_70, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_71, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_72, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_73, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_74, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_75, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_76, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_77, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_78, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_79, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_80, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_81, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_82, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_83, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_84, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_85, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_86, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_87, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_88, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_89, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_90, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_91, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_92, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_93, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_94, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_95, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_96, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_97, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_98, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_99, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_99);
+
@@ -0,0 +1,278 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/scaled_inv_chi_square/scaled_inv_chi_square_cdf_test.hpp>
+
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_100;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_101;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_102;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_103;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_104;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_105;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_106;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_107;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_108;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_109;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_110;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_111;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_112;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_113;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_114;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_115;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_116;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, double, empty, empty, empty> type_ffv_117;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty, empty, empty> type_ffv_118;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_119;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_120;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_121;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_122;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty, empty, empty> type_ffv_123;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_124;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_125;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_126;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_127;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_128;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_129;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_130;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_131;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_132;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_133;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_134;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_135;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_136;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_137;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_138;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_139;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_140;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_141;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_142;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_143;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_144;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_145;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_146;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_147;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_148;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_149;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_150;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_151;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_152;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_ffv_153;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_ffv_154;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_155;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_156;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_157;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_158;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_ffv_159;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_160;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_161;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_162;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_163;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_164;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_165;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_166;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_167;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_168;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_169;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_170;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_171;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_172;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_173;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_174;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_175;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_176;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_177;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_178;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_179;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_180;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_181;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_182;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_183;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_184;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_185;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_186;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_187;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_188;
+
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_100> AgradCdfScaledInvChiSquare_ffv_100;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_101> AgradCdfScaledInvChiSquare_ffv_101;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_102> AgradCdfScaledInvChiSquare_ffv_102;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_103> AgradCdfScaledInvChiSquare_ffv_103;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_104> AgradCdfScaledInvChiSquare_ffv_104;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_105> AgradCdfScaledInvChiSquare_ffv_105;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_106> AgradCdfScaledInvChiSquare_ffv_106;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_107> AgradCdfScaledInvChiSquare_ffv_107;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_108> AgradCdfScaledInvChiSquare_ffv_108;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_109> AgradCdfScaledInvChiSquare_ffv_109;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_110> AgradCdfScaledInvChiSquare_ffv_110;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_111> AgradCdfScaledInvChiSquare_ffv_111;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_112> AgradCdfScaledInvChiSquare_ffv_112;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_113> AgradCdfScaledInvChiSquare_ffv_113;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_114> AgradCdfScaledInvChiSquare_ffv_114;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_115> AgradCdfScaledInvChiSquare_ffv_115;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_116> AgradCdfScaledInvChiSquare_ffv_116;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_117> AgradCdfScaledInvChiSquare_ffv_117;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_118> AgradCdfScaledInvChiSquare_ffv_118;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_119> AgradCdfScaledInvChiSquare_ffv_119;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_120> AgradCdfScaledInvChiSquare_ffv_120;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_121> AgradCdfScaledInvChiSquare_ffv_121;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_122> AgradCdfScaledInvChiSquare_ffv_122;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_123> AgradCdfScaledInvChiSquare_ffv_123;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_124> AgradCdfScaledInvChiSquare_ffv_124;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_125> AgradCdfScaledInvChiSquare_ffv_125;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_126> AgradCdfScaledInvChiSquare_ffv_126;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_127> AgradCdfScaledInvChiSquare_ffv_127;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_128> AgradCdfScaledInvChiSquare_ffv_128;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_129> AgradCdfScaledInvChiSquare_ffv_129;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_130> AgradCdfScaledInvChiSquare_ffv_130;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_131> AgradCdfScaledInvChiSquare_ffv_131;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_132> AgradCdfScaledInvChiSquare_ffv_132;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_133> AgradCdfScaledInvChiSquare_ffv_133;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_134> AgradCdfScaledInvChiSquare_ffv_134;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_135> AgradCdfScaledInvChiSquare_ffv_135;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_136> AgradCdfScaledInvChiSquare_ffv_136;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_137> AgradCdfScaledInvChiSquare_ffv_137;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_138> AgradCdfScaledInvChiSquare_ffv_138;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_139> AgradCdfScaledInvChiSquare_ffv_139;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_140> AgradCdfScaledInvChiSquare_ffv_140;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_141> AgradCdfScaledInvChiSquare_ffv_141;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_142> AgradCdfScaledInvChiSquare_ffv_142;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_143> AgradCdfScaledInvChiSquare_ffv_143;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_144> AgradCdfScaledInvChiSquare_ffv_144;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_145> AgradCdfScaledInvChiSquare_ffv_145;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_146> AgradCdfScaledInvChiSquare_ffv_146;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_147> AgradCdfScaledInvChiSquare_ffv_147;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_148> AgradCdfScaledInvChiSquare_ffv_148;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_149> AgradCdfScaledInvChiSquare_ffv_149;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_150> AgradCdfScaledInvChiSquare_ffv_150;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_151> AgradCdfScaledInvChiSquare_ffv_151;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_152> AgradCdfScaledInvChiSquare_ffv_152;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_153> AgradCdfScaledInvChiSquare_ffv_153;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_154> AgradCdfScaledInvChiSquare_ffv_154;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_155> AgradCdfScaledInvChiSquare_ffv_155;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_156> AgradCdfScaledInvChiSquare_ffv_156;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_157> AgradCdfScaledInvChiSquare_ffv_157;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_158> AgradCdfScaledInvChiSquare_ffv_158;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_159> AgradCdfScaledInvChiSquare_ffv_159;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_160> AgradCdfScaledInvChiSquare_ffv_160;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_161> AgradCdfScaledInvChiSquare_ffv_161;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_162> AgradCdfScaledInvChiSquare_ffv_162;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_163> AgradCdfScaledInvChiSquare_ffv_163;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_164> AgradCdfScaledInvChiSquare_ffv_164;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_165> AgradCdfScaledInvChiSquare_ffv_165;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_166> AgradCdfScaledInvChiSquare_ffv_166;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_167> AgradCdfScaledInvChiSquare_ffv_167;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_168> AgradCdfScaledInvChiSquare_ffv_168;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_169> AgradCdfScaledInvChiSquare_ffv_169;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_170> AgradCdfScaledInvChiSquare_ffv_170;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_171> AgradCdfScaledInvChiSquare_ffv_171;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_172> AgradCdfScaledInvChiSquare_ffv_172;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_173> AgradCdfScaledInvChiSquare_ffv_173;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_174> AgradCdfScaledInvChiSquare_ffv_174;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_175> AgradCdfScaledInvChiSquare_ffv_175;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_176> AgradCdfScaledInvChiSquare_ffv_176;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_177> AgradCdfScaledInvChiSquare_ffv_177;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_178> AgradCdfScaledInvChiSquare_ffv_178;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_179> AgradCdfScaledInvChiSquare_ffv_179;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_180> AgradCdfScaledInvChiSquare_ffv_180;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_181> AgradCdfScaledInvChiSquare_ffv_181;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_182> AgradCdfScaledInvChiSquare_ffv_182;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_183> AgradCdfScaledInvChiSquare_ffv_183;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_184> AgradCdfScaledInvChiSquare_ffv_184;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_185> AgradCdfScaledInvChiSquare_ffv_185;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_186> AgradCdfScaledInvChiSquare_ffv_186;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_187> AgradCdfScaledInvChiSquare_ffv_187;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_ffv_188> AgradCdfScaledInvChiSquare_ffv_188;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_100, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_101, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_102, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_103, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_104, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_105, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_106, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_107, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_108, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_109, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_110, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_111, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_112, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_113, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_114, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_115, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_116, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_117, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_118, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_119, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_120, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_121, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_122, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_123, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_124, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_125, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_126, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_127, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_128, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_129, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_130, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_131, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_132, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_133, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_134, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_135, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_136, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_137, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_138, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_139, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_140, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_141, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_142, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_143, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_144, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_145, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_146, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_147, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_148, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_149, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_150, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_151, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_152, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_153, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_154, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_155, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_156, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_157, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_158, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_159, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_160, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_161, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_162, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_163, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_164, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_165, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_166, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_167, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_168, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_169, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_170, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_171, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_172, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_173, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_174, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_175, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_176, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_177, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_178, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_179, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_180, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_181, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_182, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_183, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_184, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_185, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_186, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_187, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_ffv_188, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_ffv_188);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/scaled_inv_chi_square/scaled_inv_chi_square_cdf_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_100;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_101;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_102;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_103;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_104;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_105;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_106;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_107;
+typedef std::tuple<var, double, double, empty, empty, empty> type_v_108;
+typedef std::tuple<var, double, std::vector<double>, empty, empty, empty> type_v_109;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_110;
+typedef std::tuple<var, double, var, empty, empty, empty> type_v_111;
+typedef std::tuple<var, double, std::vector<var>, empty, empty, empty> type_v_112;
+typedef std::tuple<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_113;
+typedef std::tuple<var, std::vector<double>, double, empty, empty, empty> type_v_114;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_115;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_116;
+typedef std::tuple<var, std::vector<double>, var, empty, empty, empty> type_v_117;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_118;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_119;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_120;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_121;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_122;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_123;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_124;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_125;
+typedef std::tuple<var, var, double, empty, empty, empty> type_v_126;
+typedef std::tuple<var, var, std::vector<double>, empty, empty, empty> type_v_127;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_128;
+typedef std::tuple<var, var, var, empty, empty, empty> type_v_129;
+typedef std::tuple<var, var, std::vector<var>, empty, empty, empty> type_v_130;
+typedef std::tuple<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_131;
+typedef std::tuple<var, std::vector<var>, double, empty, empty, empty> type_v_132;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_133;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_134;
+typedef std::tuple<var, std::vector<var>, var, empty, empty, empty> type_v_135;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_136;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_137;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_138;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_139;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_140;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_141;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_142;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_143;
+typedef std::tuple<std::vector<var>, double, double, empty, empty, empty> type_v_144;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, empty, empty, empty> type_v_145;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_146;
+typedef std::tuple<std::vector<var>, double, var, empty, empty, empty> type_v_147;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, empty, empty, empty> type_v_148;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_149;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, empty, empty, empty> type_v_150;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_151;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_152;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, empty, empty, empty> type_v_153;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_154;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_155;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_156;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_157;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_158;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_159;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_160;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_161;
+typedef std::tuple<std::vector<var>, var, double, empty, empty, empty> type_v_162;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, empty, empty, empty> type_v_163;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_164;
+typedef std::tuple<std::vector<var>, var, var, empty, empty, empty> type_v_165;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, empty, empty, empty> type_v_166;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_167;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, empty, empty, empty> type_v_168;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_169;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_170;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, empty, empty, empty> type_v_171;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_172;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_173;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_174;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_175;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_176;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_177;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_178;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_179;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_v_180;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_v_181;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_182;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_v_183;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_v_184;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_185;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_v_186;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_187;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_188;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_v_189;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_190;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_191;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_192;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_193;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_194;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_195;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_196;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_197;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_v_198;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_v_199;
+
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_100> AgradCdfScaledInvChiSquare_v_100;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_101> AgradCdfScaledInvChiSquare_v_101;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_102> AgradCdfScaledInvChiSquare_v_102;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_103> AgradCdfScaledInvChiSquare_v_103;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_104> AgradCdfScaledInvChiSquare_v_104;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_105> AgradCdfScaledInvChiSquare_v_105;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_106> AgradCdfScaledInvChiSquare_v_106;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_107> AgradCdfScaledInvChiSquare_v_107;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_108> AgradCdfScaledInvChiSquare_v_108;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_109> AgradCdfScaledInvChiSquare_v_109;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_110> AgradCdfScaledInvChiSquare_v_110;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_111> AgradCdfScaledInvChiSquare_v_111;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_112> AgradCdfScaledInvChiSquare_v_112;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_113> AgradCdfScaledInvChiSquare_v_113;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_114> AgradCdfScaledInvChiSquare_v_114;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_115> AgradCdfScaledInvChiSquare_v_115;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_116> AgradCdfScaledInvChiSquare_v_116;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_117> AgradCdfScaledInvChiSquare_v_117;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_118> AgradCdfScaledInvChiSquare_v_118;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_119> AgradCdfScaledInvChiSquare_v_119;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_120> AgradCdfScaledInvChiSquare_v_120;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_121> AgradCdfScaledInvChiSquare_v_121;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_122> AgradCdfScaledInvChiSquare_v_122;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_123> AgradCdfScaledInvChiSquare_v_123;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_124> AgradCdfScaledInvChiSquare_v_124;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_125> AgradCdfScaledInvChiSquare_v_125;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_126> AgradCdfScaledInvChiSquare_v_126;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_127> AgradCdfScaledInvChiSquare_v_127;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_128> AgradCdfScaledInvChiSquare_v_128;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_129> AgradCdfScaledInvChiSquare_v_129;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_130> AgradCdfScaledInvChiSquare_v_130;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_131> AgradCdfScaledInvChiSquare_v_131;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_132> AgradCdfScaledInvChiSquare_v_132;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_133> AgradCdfScaledInvChiSquare_v_133;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_134> AgradCdfScaledInvChiSquare_v_134;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_135> AgradCdfScaledInvChiSquare_v_135;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_136> AgradCdfScaledInvChiSquare_v_136;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_137> AgradCdfScaledInvChiSquare_v_137;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_138> AgradCdfScaledInvChiSquare_v_138;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_139> AgradCdfScaledInvChiSquare_v_139;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_140> AgradCdfScaledInvChiSquare_v_140;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_141> AgradCdfScaledInvChiSquare_v_141;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_142> AgradCdfScaledInvChiSquare_v_142;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_143> AgradCdfScaledInvChiSquare_v_143;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_144> AgradCdfScaledInvChiSquare_v_144;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_145> AgradCdfScaledInvChiSquare_v_145;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_146> AgradCdfScaledInvChiSquare_v_146;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_147> AgradCdfScaledInvChiSquare_v_147;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_148> AgradCdfScaledInvChiSquare_v_148;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_149> AgradCdfScaledInvChiSquare_v_149;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_150> AgradCdfScaledInvChiSquare_v_150;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_151> AgradCdfScaledInvChiSquare_v_151;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_152> AgradCdfScaledInvChiSquare_v_152;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_153> AgradCdfScaledInvChiSquare_v_153;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_154> AgradCdfScaledInvChiSquare_v_154;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_155> AgradCdfScaledInvChiSquare_v_155;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_156> AgradCdfScaledInvChiSquare_v_156;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_157> AgradCdfScaledInvChiSquare_v_157;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_158> AgradCdfScaledInvChiSquare_v_158;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_159> AgradCdfScaledInvChiSquare_v_159;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_160> AgradCdfScaledInvChiSquare_v_160;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_161> AgradCdfScaledInvChiSquare_v_161;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_162> AgradCdfScaledInvChiSquare_v_162;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_163> AgradCdfScaledInvChiSquare_v_163;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_164> AgradCdfScaledInvChiSquare_v_164;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_165> AgradCdfScaledInvChiSquare_v_165;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_166> AgradCdfScaledInvChiSquare_v_166;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_167> AgradCdfScaledInvChiSquare_v_167;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_168> AgradCdfScaledInvChiSquare_v_168;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_169> AgradCdfScaledInvChiSquare_v_169;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_170> AgradCdfScaledInvChiSquare_v_170;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_171> AgradCdfScaledInvChiSquare_v_171;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_172> AgradCdfScaledInvChiSquare_v_172;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_173> AgradCdfScaledInvChiSquare_v_173;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_174> AgradCdfScaledInvChiSquare_v_174;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_175> AgradCdfScaledInvChiSquare_v_175;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_176> AgradCdfScaledInvChiSquare_v_176;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_177> AgradCdfScaledInvChiSquare_v_177;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_178> AgradCdfScaledInvChiSquare_v_178;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_179> AgradCdfScaledInvChiSquare_v_179;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_180> AgradCdfScaledInvChiSquare_v_180;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_181> AgradCdfScaledInvChiSquare_v_181;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_182> AgradCdfScaledInvChiSquare_v_182;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_183> AgradCdfScaledInvChiSquare_v_183;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_184> AgradCdfScaledInvChiSquare_v_184;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_185> AgradCdfScaledInvChiSquare_v_185;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_186> AgradCdfScaledInvChiSquare_v_186;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_187> AgradCdfScaledInvChiSquare_v_187;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_188> AgradCdfScaledInvChiSquare_v_188;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_189> AgradCdfScaledInvChiSquare_v_189;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_190> AgradCdfScaledInvChiSquare_v_190;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_191> AgradCdfScaledInvChiSquare_v_191;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_192> AgradCdfScaledInvChiSquare_v_192;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_193> AgradCdfScaledInvChiSquare_v_193;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_194> AgradCdfScaledInvChiSquare_v_194;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_195> AgradCdfScaledInvChiSquare_v_195;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_196> AgradCdfScaledInvChiSquare_v_196;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_197> AgradCdfScaledInvChiSquare_v_197;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_198> AgradCdfScaledInvChiSquare_v_198;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_v_199> AgradCdfScaledInvChiSquare_v_199;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_100, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_101, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_102, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_103, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_104, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_105, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_106, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_107, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_108, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_109, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_110, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_111, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_112, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_113, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_114, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_115, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_116, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_117, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_118, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_119, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_120, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_121, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_122, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_123, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_124, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_125, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_126, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_127, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_128, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_129, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_130, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_131, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_132, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_133, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_134, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_135, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_136, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_137, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_138, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_139, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_140, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_141, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_142, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_143, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_144, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_145, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_146, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_147, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_148, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_149, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_150, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_151, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_152, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_153, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_154, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_155, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_156, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_157, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_158, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_159, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_160, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_161, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_162, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_163, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_164, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_165, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_166, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_167, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_168, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_169, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_170, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_171, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_172, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_173, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_174, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_175, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_176, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_177, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_178, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_179, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_180, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_181, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_182, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_183, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_184, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_185, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_186, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_187, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_188, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_188);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_189, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_189);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_190, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_190);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_191, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_191);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_192, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_192);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_193, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_193);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_194, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_194);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_195, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_195);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_196, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_196);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_197, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_197);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_198, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_198);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_v_199, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_v_199);
+
@@ -0,0 +1,278 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/scaled_inv_chi_square/scaled_inv_chi_square_cdf_test.hpp>
+
+typedef std::tuple<var, var, std::vector<double>, empty, empty, empty> type_vv_100;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_101;
+typedef std::tuple<var, var, var, empty, empty, empty> type_vv_102;
+typedef std::tuple<var, var, std::vector<var>, empty, empty, empty> type_vv_103;
+typedef std::tuple<var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_104;
+typedef std::tuple<var, std::vector<var>, double, empty, empty, empty> type_vv_105;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_106;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_107;
+typedef std::tuple<var, std::vector<var>, var, empty, empty, empty> type_vv_108;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_109;
+typedef std::tuple<var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_110;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_111;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_112;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_113;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_114;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_115;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_116;
+typedef std::tuple<std::vector<var>, double, double, empty, empty, empty> type_vv_117;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, empty, empty, empty> type_vv_118;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_119;
+typedef std::tuple<std::vector<var>, double, var, empty, empty, empty> type_vv_120;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, empty, empty, empty> type_vv_121;
+typedef std::tuple<std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_122;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, empty, empty, empty> type_vv_123;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_124;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_125;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, empty, empty, empty> type_vv_126;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_127;
+typedef std::tuple<std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_128;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_129;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_130;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_131;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_132;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_133;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_134;
+typedef std::tuple<std::vector<var>, var, double, empty, empty, empty> type_vv_135;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, empty, empty, empty> type_vv_136;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_137;
+typedef std::tuple<std::vector<var>, var, var, empty, empty, empty> type_vv_138;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, empty, empty, empty> type_vv_139;
+typedef std::tuple<std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_140;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, empty, empty, empty> type_vv_141;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_142;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_143;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, empty, empty, empty> type_vv_144;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_145;
+typedef std::tuple<std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_146;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_147;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_148;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_149;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_150;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_151;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_152;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, empty, empty, empty> type_vv_153;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, empty, empty, empty> type_vv_154;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_155;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, empty, empty, empty> type_vv_156;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, empty, empty, empty> type_vv_157;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_158;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, empty, empty, empty> type_vv_159;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_160;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_161;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, empty, empty, empty> type_vv_162;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_163;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_164;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_165;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_166;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_167;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_168;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_169;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_170;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, empty, empty, empty> type_vv_171;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, empty, empty, empty> type_vv_172;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_173;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, empty, empty, empty> type_vv_174;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, empty, empty, empty> type_vv_175;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_176;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, empty, empty, empty> type_vv_177;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_178;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_179;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, empty, empty, empty> type_vv_180;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_181;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_182;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_183;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_184;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_185;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_186;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_187;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_188;
+
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_100> AgradCdfScaledInvChiSquare_vv_100;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_101> AgradCdfScaledInvChiSquare_vv_101;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_102> AgradCdfScaledInvChiSquare_vv_102;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_103> AgradCdfScaledInvChiSquare_vv_103;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_104> AgradCdfScaledInvChiSquare_vv_104;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_105> AgradCdfScaledInvChiSquare_vv_105;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_106> AgradCdfScaledInvChiSquare_vv_106;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_107> AgradCdfScaledInvChiSquare_vv_107;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_108> AgradCdfScaledInvChiSquare_vv_108;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_109> AgradCdfScaledInvChiSquare_vv_109;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_110> AgradCdfScaledInvChiSquare_vv_110;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_111> AgradCdfScaledInvChiSquare_vv_111;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_112> AgradCdfScaledInvChiSquare_vv_112;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_113> AgradCdfScaledInvChiSquare_vv_113;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_114> AgradCdfScaledInvChiSquare_vv_114;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_115> AgradCdfScaledInvChiSquare_vv_115;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_116> AgradCdfScaledInvChiSquare_vv_116;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_117> AgradCdfScaledInvChiSquare_vv_117;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_118> AgradCdfScaledInvChiSquare_vv_118;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_119> AgradCdfScaledInvChiSquare_vv_119;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_120> AgradCdfScaledInvChiSquare_vv_120;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_121> AgradCdfScaledInvChiSquare_vv_121;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_122> AgradCdfScaledInvChiSquare_vv_122;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_123> AgradCdfScaledInvChiSquare_vv_123;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_124> AgradCdfScaledInvChiSquare_vv_124;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_125> AgradCdfScaledInvChiSquare_vv_125;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_126> AgradCdfScaledInvChiSquare_vv_126;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_127> AgradCdfScaledInvChiSquare_vv_127;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_128> AgradCdfScaledInvChiSquare_vv_128;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_129> AgradCdfScaledInvChiSquare_vv_129;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_130> AgradCdfScaledInvChiSquare_vv_130;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_131> AgradCdfScaledInvChiSquare_vv_131;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_132> AgradCdfScaledInvChiSquare_vv_132;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_133> AgradCdfScaledInvChiSquare_vv_133;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_134> AgradCdfScaledInvChiSquare_vv_134;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_135> AgradCdfScaledInvChiSquare_vv_135;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_136> AgradCdfScaledInvChiSquare_vv_136;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_137> AgradCdfScaledInvChiSquare_vv_137;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_138> AgradCdfScaledInvChiSquare_vv_138;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_139> AgradCdfScaledInvChiSquare_vv_139;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_140> AgradCdfScaledInvChiSquare_vv_140;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_141> AgradCdfScaledInvChiSquare_vv_141;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_142> AgradCdfScaledInvChiSquare_vv_142;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_143> AgradCdfScaledInvChiSquare_vv_143;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_144> AgradCdfScaledInvChiSquare_vv_144;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_145> AgradCdfScaledInvChiSquare_vv_145;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_146> AgradCdfScaledInvChiSquare_vv_146;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_147> AgradCdfScaledInvChiSquare_vv_147;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_148> AgradCdfScaledInvChiSquare_vv_148;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_149> AgradCdfScaledInvChiSquare_vv_149;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_150> AgradCdfScaledInvChiSquare_vv_150;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_151> AgradCdfScaledInvChiSquare_vv_151;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_152> AgradCdfScaledInvChiSquare_vv_152;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_153> AgradCdfScaledInvChiSquare_vv_153;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_154> AgradCdfScaledInvChiSquare_vv_154;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_155> AgradCdfScaledInvChiSquare_vv_155;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_156> AgradCdfScaledInvChiSquare_vv_156;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_157> AgradCdfScaledInvChiSquare_vv_157;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_158> AgradCdfScaledInvChiSquare_vv_158;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_159> AgradCdfScaledInvChiSquare_vv_159;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_160> AgradCdfScaledInvChiSquare_vv_160;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_161> AgradCdfScaledInvChiSquare_vv_161;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_162> AgradCdfScaledInvChiSquare_vv_162;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_163> AgradCdfScaledInvChiSquare_vv_163;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_164> AgradCdfScaledInvChiSquare_vv_164;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_165> AgradCdfScaledInvChiSquare_vv_165;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_166> AgradCdfScaledInvChiSquare_vv_166;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_167> AgradCdfScaledInvChiSquare_vv_167;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_168> AgradCdfScaledInvChiSquare_vv_168;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_169> AgradCdfScaledInvChiSquare_vv_169;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_170> AgradCdfScaledInvChiSquare_vv_170;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_171> AgradCdfScaledInvChiSquare_vv_171;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_172> AgradCdfScaledInvChiSquare_vv_172;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_173> AgradCdfScaledInvChiSquare_vv_173;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_174> AgradCdfScaledInvChiSquare_vv_174;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_175> AgradCdfScaledInvChiSquare_vv_175;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_176> AgradCdfScaledInvChiSquare_vv_176;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_177> AgradCdfScaledInvChiSquare_vv_177;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_178> AgradCdfScaledInvChiSquare_vv_178;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_179> AgradCdfScaledInvChiSquare_vv_179;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_180> AgradCdfScaledInvChiSquare_vv_180;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_181> AgradCdfScaledInvChiSquare_vv_181;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_182> AgradCdfScaledInvChiSquare_vv_182;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_183> AgradCdfScaledInvChiSquare_vv_183;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_184> AgradCdfScaledInvChiSquare_vv_184;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_185> AgradCdfScaledInvChiSquare_vv_185;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_186> AgradCdfScaledInvChiSquare_vv_186;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_187> AgradCdfScaledInvChiSquare_vv_187;
+typedef std::tuple<AgradCdfScaledInvChiSquare, type_vv_188> AgradCdfScaledInvChiSquare_vv_188;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_100, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_101, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_102, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_103, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_104, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_105, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_106, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_107, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_108, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_109, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_110, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_111, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_112, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_113, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_114, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_115, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_116, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_117, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_118, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_119, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_120, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_121, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_122, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_123, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_124, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_125, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_126, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_127, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_128, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_129, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_130, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_131, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_132, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_133, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_134, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_135, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_136, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_137, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_138, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_139, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_140, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_141, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_142, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_143, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_144, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_145, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_146, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_147, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_148, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_149, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_150, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_151, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_152, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_153, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_154, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_155, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_156, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_157, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_158, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_159, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_160, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_161, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_162, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_163, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_164, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_165, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_166, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_167, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_168, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_169, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_170, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_171, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_172, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_173, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_174, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_175, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_176, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_177, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_178, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_179, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_180, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_181, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_182, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_183, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_184, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_185, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_186, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_187, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfScaledInvChiSquare_vv_188, AgradCdfTestFixture, AgradCdfScaledInvChiSquare_vv_188);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/scaled_inv_chi_square/scaled_inv_chi_square_cdf_log_test.hpp>
+
+typedef std::tuple<double, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_0;
+typedef std::tuple<double, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_1;
+typedef std::tuple<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_2;
+typedef std::tuple<double, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_3;
+typedef std::tuple<double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_4;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_5;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_6;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_7;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_8;
+typedef std::tuple<double, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_9;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_10;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_11;
+typedef std::tuple<double, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_12;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_13;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_14;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_15;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_16;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_17;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_18;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_19;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_20;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_21;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_22;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_23;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_24;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_25;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_26;
+typedef std::tuple<std::vector<double>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_27;
+typedef std::tuple<std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_28;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_29;
+typedef std::tuple<std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_30;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_31;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_32;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_33;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_34;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_35;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_36;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_37;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_38;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_39;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_40;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_41;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_42;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_43;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_44;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_45;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_46;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_47;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_48;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_49;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_50;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_51;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_52;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_53;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_54;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_55;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_56;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_57;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_58;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_59;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_60;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_61;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_62;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_63;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_64;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_65;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_66;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_67;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_68;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_69;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_70;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_80;
+typedef std::tuple<fvar<fvar<var> >, double, double, empty, empty, empty> type_ffv_81;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<double>, empty, empty, empty> type_ffv_82;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_83;
+typedef std::tuple<fvar<fvar<var> >, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_84;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_85;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_86;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, double, empty, empty, empty> type_ffv_87;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_88;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_89;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_90;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_91;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_92;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_93;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_94;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_95;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_96;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_97;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_98;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_99;
+
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_0> AgradCdfLogScaledInvChiSquare_ffv_0;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_1> AgradCdfLogScaledInvChiSquare_ffv_1;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_2> AgradCdfLogScaledInvChiSquare_ffv_2;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_3> AgradCdfLogScaledInvChiSquare_ffv_3;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_4> AgradCdfLogScaledInvChiSquare_ffv_4;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_5> AgradCdfLogScaledInvChiSquare_ffv_5;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_6> AgradCdfLogScaledInvChiSquare_ffv_6;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_7> AgradCdfLogScaledInvChiSquare_ffv_7;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_8> AgradCdfLogScaledInvChiSquare_ffv_8;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_9> AgradCdfLogScaledInvChiSquare_ffv_9;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_10> AgradCdfLogScaledInvChiSquare_ffv_10;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_11> AgradCdfLogScaledInvChiSquare_ffv_11;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_12> AgradCdfLogScaledInvChiSquare_ffv_12;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_13> AgradCdfLogScaledInvChiSquare_ffv_13;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_14> AgradCdfLogScaledInvChiSquare_ffv_14;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_15> AgradCdfLogScaledInvChiSquare_ffv_15;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_16> AgradCdfLogScaledInvChiSquare_ffv_16;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_17> AgradCdfLogScaledInvChiSquare_ffv_17;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_18> AgradCdfLogScaledInvChiSquare_ffv_18;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_19> AgradCdfLogScaledInvChiSquare_ffv_19;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_20> AgradCdfLogScaledInvChiSquare_ffv_20;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_21> AgradCdfLogScaledInvChiSquare_ffv_21;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_22> AgradCdfLogScaledInvChiSquare_ffv_22;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_23> AgradCdfLogScaledInvChiSquare_ffv_23;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_24> AgradCdfLogScaledInvChiSquare_ffv_24;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_25> AgradCdfLogScaledInvChiSquare_ffv_25;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_26> AgradCdfLogScaledInvChiSquare_ffv_26;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_27> AgradCdfLogScaledInvChiSquare_ffv_27;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_28> AgradCdfLogScaledInvChiSquare_ffv_28;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_29> AgradCdfLogScaledInvChiSquare_ffv_29;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_30> AgradCdfLogScaledInvChiSquare_ffv_30;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_31> AgradCdfLogScaledInvChiSquare_ffv_31;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_32> AgradCdfLogScaledInvChiSquare_ffv_32;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_33> AgradCdfLogScaledInvChiSquare_ffv_33;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_34> AgradCdfLogScaledInvChiSquare_ffv_34;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_35> AgradCdfLogScaledInvChiSquare_ffv_35;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_36> AgradCdfLogScaledInvChiSquare_ffv_36;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_37> AgradCdfLogScaledInvChiSquare_ffv_37;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_38> AgradCdfLogScaledInvChiSquare_ffv_38;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_39> AgradCdfLogScaledInvChiSquare_ffv_39;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_40> AgradCdfLogScaledInvChiSquare_ffv_40;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_41> AgradCdfLogScaledInvChiSquare_ffv_41;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_42> AgradCdfLogScaledInvChiSquare_ffv_42;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_43> AgradCdfLogScaledInvChiSquare_ffv_43;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_44> AgradCdfLogScaledInvChiSquare_ffv_44;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_45> AgradCdfLogScaledInvChiSquare_ffv_45;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_46> AgradCdfLogScaledInvChiSquare_ffv_46;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_47> AgradCdfLogScaledInvChiSquare_ffv_47;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_48> AgradCdfLogScaledInvChiSquare_ffv_48;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_49> AgradCdfLogScaledInvChiSquare_ffv_49;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_50> AgradCdfLogScaledInvChiSquare_ffv_50;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_51> AgradCdfLogScaledInvChiSquare_ffv_51;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_52> AgradCdfLogScaledInvChiSquare_ffv_52;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_53> AgradCdfLogScaledInvChiSquare_ffv_53;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_54> AgradCdfLogScaledInvChiSquare_ffv_54;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_55> AgradCdfLogScaledInvChiSquare_ffv_55;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_56> AgradCdfLogScaledInvChiSquare_ffv_56;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_57> AgradCdfLogScaledInvChiSquare_ffv_57;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_58> AgradCdfLogScaledInvChiSquare_ffv_58;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_59> AgradCdfLogScaledInvChiSquare_ffv_59;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_60> AgradCdfLogScaledInvChiSquare_ffv_60;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_61> AgradCdfLogScaledInvChiSquare_ffv_61;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_62> AgradCdfLogScaledInvChiSquare_ffv_62;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_63> AgradCdfLogScaledInvChiSquare_ffv_63;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_64> AgradCdfLogScaledInvChiSquare_ffv_64;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_65> AgradCdfLogScaledInvChiSquare_ffv_65;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_66> AgradCdfLogScaledInvChiSquare_ffv_66;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_67> AgradCdfLogScaledInvChiSquare_ffv_67;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_68> AgradCdfLogScaledInvChiSquare_ffv_68;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_69> AgradCdfLogScaledInvChiSquare_ffv_69;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_70> AgradCdfLogScaledInvChiSquare_ffv_70;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_71> AgradCdfLogScaledInvChiSquare_ffv_71;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_72> AgradCdfLogScaledInvChiSquare_ffv_72;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_73> AgradCdfLogScaledInvChiSquare_ffv_73;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_74> AgradCdfLogScaledInvChiSquare_ffv_74;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_75> AgradCdfLogScaledInvChiSquare_ffv_75;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_76> AgradCdfLogScaledInvChiSquare_ffv_76;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_77> AgradCdfLogScaledInvChiSquare_ffv_77;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_78> AgradCdfLogScaledInvChiSquare_ffv_78;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_79> AgradCdfLogScaledInvChiSquare_ffv_79;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_80> AgradCdfLogScaledInvChiSquare_ffv_80;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_81> AgradCdfLogScaledInvChiSquare_ffv_81;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_82> AgradCdfLogScaledInvChiSquare_ffv_82;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_83> AgradCdfLogScaledInvChiSquare_ffv_83;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_84> AgradCdfLogScaledInvChiSquare_ffv_84;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_85> AgradCdfLogScaledInvChiSquare_ffv_85;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_86> AgradCdfLogScaledInvChiSquare_ffv_86;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_87> AgradCdfLogScaledInvChiSquare_ffv_87;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_88> AgradCdfLogScaledInvChiSquare_ffv_88;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_89> AgradCdfLogScaledInvChiSquare_ffv_89;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_90> AgradCdfLogScaledInvChiSquare_ffv_90;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_91> AgradCdfLogScaledInvChiSquare_ffv_91;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_92> AgradCdfLogScaledInvChiSquare_ffv_92;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_93> AgradCdfLogScaledInvChiSquare_ffv_93;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_94> AgradCdfLogScaledInvChiSquare_ffv_94;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_95> AgradCdfLogScaledInvChiSquare_ffv_95;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_96> AgradCdfLogScaledInvChiSquare_ffv_96;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_97> AgradCdfLogScaledInvChiSquare_ffv_97;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_98> AgradCdfLogScaledInvChiSquare_ffv_98;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_99> AgradCdfLogScaledInvChiSquare_ffv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_0, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_1, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_2, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_3, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_4, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_5, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_6, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_7, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_8, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_9, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_10, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_11, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_12, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_13, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_14, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_15, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_16, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_17, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_18, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_19, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_20, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_21, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_22, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_23, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_24, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_25, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_26, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_27, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_28, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_29, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_30, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_31, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_32, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_33, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_34, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_35, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_36, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_37, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_38, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_39, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_40, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_41, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_42, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_43, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_44, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_45, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_46, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_47, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_48, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_49, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_50, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_51, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_52, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_53, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_54, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_55, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_56, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_57, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_58, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_59, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_60, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_61, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_62, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_63, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_64, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_65, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_66, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_67, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_68, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_69, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_70, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_71, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_72, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_73, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_74, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_75, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_76, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_77, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_78, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_79, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_80, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_81, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_82, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_83, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_84, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_85, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_86, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_87, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_88, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_89, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_90, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_91, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_92, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_93, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_94, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_95, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_96, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_97, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_98, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_99, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_99);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/scaled_inv_chi_square/scaled_inv_chi_square_cdf_log_test.hpp>
+
+typedef std::tuple<double, double, double, empty, empty, empty> type_v_0;
+typedef std::tuple<double, double, std::vector<double>, empty, empty, empty> type_v_1;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_2;
+typedef std::tuple<double, double, var, empty, empty, empty> type_v_3;
+typedef std::tuple<double, double, std::vector<var>, empty, empty, empty> type_v_4;
+typedef std::tuple<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_5;
+typedef std::tuple<double, std::vector<double>, double, empty, empty, empty> type_v_6;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_7;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_8;
+typedef std::tuple<double, std::vector<double>, var, empty, empty, empty> type_v_9;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_10;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_11;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_12;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_13;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_14;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_15;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_16;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_17;
+typedef std::tuple<double, var, double, empty, empty, empty> type_v_18;
+typedef std::tuple<double, var, std::vector<double>, empty, empty, empty> type_v_19;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_20;
+typedef std::tuple<double, var, var, empty, empty, empty> type_v_21;
+typedef std::tuple<double, var, std::vector<var>, empty, empty, empty> type_v_22;
+typedef std::tuple<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_23;
+typedef std::tuple<double, std::vector<var>, double, empty, empty, empty> type_v_24;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_25;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_26;
+typedef std::tuple<double, std::vector<var>, var, empty, empty, empty> type_v_27;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_28;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_29;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_30;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_31;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_32;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_33;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_34;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_35;
+typedef std::tuple<std::vector<double>, double, double, empty, empty, empty> type_v_36;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, empty, empty, empty> type_v_37;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_38;
+typedef std::tuple<std::vector<double>, double, var, empty, empty, empty> type_v_39;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, empty, empty, empty> type_v_40;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_41;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, empty, empty, empty> type_v_42;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_43;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_44;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, empty, empty, empty> type_v_45;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_46;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_47;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_48;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_49;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_50;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_51;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_52;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_53;
+typedef std::tuple<std::vector<double>, var, double, empty, empty, empty> type_v_54;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, empty, empty, empty> type_v_55;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_56;
+typedef std::tuple<std::vector<double>, var, var, empty, empty, empty> type_v_57;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, empty, empty, empty> type_v_58;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_59;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, empty, empty, empty> type_v_60;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_61;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_62;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, empty, empty, empty> type_v_63;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_64;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_65;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_66;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_67;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_68;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_69;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_70;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_v_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_v_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_v_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_v_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_v_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_80;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_v_81;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_82;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_83;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_84;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_85;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_86;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_87;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_88;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_89;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_v_90;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_v_91;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_92;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_v_93;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_v_94;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_95;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_v_96;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_97;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_98;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_v_99;
+
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_0> AgradCdfLogScaledInvChiSquare_v_0;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_1> AgradCdfLogScaledInvChiSquare_v_1;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_2> AgradCdfLogScaledInvChiSquare_v_2;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_3> AgradCdfLogScaledInvChiSquare_v_3;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_4> AgradCdfLogScaledInvChiSquare_v_4;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_5> AgradCdfLogScaledInvChiSquare_v_5;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_6> AgradCdfLogScaledInvChiSquare_v_6;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_7> AgradCdfLogScaledInvChiSquare_v_7;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_8> AgradCdfLogScaledInvChiSquare_v_8;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_9> AgradCdfLogScaledInvChiSquare_v_9;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_10> AgradCdfLogScaledInvChiSquare_v_10;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_11> AgradCdfLogScaledInvChiSquare_v_11;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_12> AgradCdfLogScaledInvChiSquare_v_12;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_13> AgradCdfLogScaledInvChiSquare_v_13;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_14> AgradCdfLogScaledInvChiSquare_v_14;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_15> AgradCdfLogScaledInvChiSquare_v_15;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_16> AgradCdfLogScaledInvChiSquare_v_16;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_17> AgradCdfLogScaledInvChiSquare_v_17;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_18> AgradCdfLogScaledInvChiSquare_v_18;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_19> AgradCdfLogScaledInvChiSquare_v_19;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_20> AgradCdfLogScaledInvChiSquare_v_20;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_21> AgradCdfLogScaledInvChiSquare_v_21;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_22> AgradCdfLogScaledInvChiSquare_v_22;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_23> AgradCdfLogScaledInvChiSquare_v_23;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_24> AgradCdfLogScaledInvChiSquare_v_24;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_25> AgradCdfLogScaledInvChiSquare_v_25;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_26> AgradCdfLogScaledInvChiSquare_v_26;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_27> AgradCdfLogScaledInvChiSquare_v_27;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_28> AgradCdfLogScaledInvChiSquare_v_28;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_29> AgradCdfLogScaledInvChiSquare_v_29;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_30> AgradCdfLogScaledInvChiSquare_v_30;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_31> AgradCdfLogScaledInvChiSquare_v_31;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_32> AgradCdfLogScaledInvChiSquare_v_32;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_33> AgradCdfLogScaledInvChiSquare_v_33;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_34> AgradCdfLogScaledInvChiSquare_v_34;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_35> AgradCdfLogScaledInvChiSquare_v_35;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_36> AgradCdfLogScaledInvChiSquare_v_36;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_37> AgradCdfLogScaledInvChiSquare_v_37;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_38> AgradCdfLogScaledInvChiSquare_v_38;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_39> AgradCdfLogScaledInvChiSquare_v_39;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_40> AgradCdfLogScaledInvChiSquare_v_40;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_41> AgradCdfLogScaledInvChiSquare_v_41;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_42> AgradCdfLogScaledInvChiSquare_v_42;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_43> AgradCdfLogScaledInvChiSquare_v_43;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_44> AgradCdfLogScaledInvChiSquare_v_44;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_45> AgradCdfLogScaledInvChiSquare_v_45;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_46> AgradCdfLogScaledInvChiSquare_v_46;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_47> AgradCdfLogScaledInvChiSquare_v_47;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_48> AgradCdfLogScaledInvChiSquare_v_48;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_49> AgradCdfLogScaledInvChiSquare_v_49;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_50> AgradCdfLogScaledInvChiSquare_v_50;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_51> AgradCdfLogScaledInvChiSquare_v_51;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_52> AgradCdfLogScaledInvChiSquare_v_52;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_53> AgradCdfLogScaledInvChiSquare_v_53;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_54> AgradCdfLogScaledInvChiSquare_v_54;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_55> AgradCdfLogScaledInvChiSquare_v_55;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_56> AgradCdfLogScaledInvChiSquare_v_56;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_57> AgradCdfLogScaledInvChiSquare_v_57;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_58> AgradCdfLogScaledInvChiSquare_v_58;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_59> AgradCdfLogScaledInvChiSquare_v_59;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_60> AgradCdfLogScaledInvChiSquare_v_60;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_61> AgradCdfLogScaledInvChiSquare_v_61;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_62> AgradCdfLogScaledInvChiSquare_v_62;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_63> AgradCdfLogScaledInvChiSquare_v_63;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_64> AgradCdfLogScaledInvChiSquare_v_64;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_65> AgradCdfLogScaledInvChiSquare_v_65;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_66> AgradCdfLogScaledInvChiSquare_v_66;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_67> AgradCdfLogScaledInvChiSquare_v_67;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_68> AgradCdfLogScaledInvChiSquare_v_68;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_69> AgradCdfLogScaledInvChiSquare_v_69;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_70> AgradCdfLogScaledInvChiSquare_v_70;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_71> AgradCdfLogScaledInvChiSquare_v_71;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_72> AgradCdfLogScaledInvChiSquare_v_72;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_73> AgradCdfLogScaledInvChiSquare_v_73;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_74> AgradCdfLogScaledInvChiSquare_v_74;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_75> AgradCdfLogScaledInvChiSquare_v_75;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_76> AgradCdfLogScaledInvChiSquare_v_76;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_77> AgradCdfLogScaledInvChiSquare_v_77;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_78> AgradCdfLogScaledInvChiSquare_v_78;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_79> AgradCdfLogScaledInvChiSquare_v_79;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_80> AgradCdfLogScaledInvChiSquare_v_80;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_81> AgradCdfLogScaledInvChiSquare_v_81;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_82> AgradCdfLogScaledInvChiSquare_v_82;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_83> AgradCdfLogScaledInvChiSquare_v_83;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_84> AgradCdfLogScaledInvChiSquare_v_84;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_85> AgradCdfLogScaledInvChiSquare_v_85;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_86> AgradCdfLogScaledInvChiSquare_v_86;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_87> AgradCdfLogScaledInvChiSquare_v_87;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_88> AgradCdfLogScaledInvChiSquare_v_88;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_89> AgradCdfLogScaledInvChiSquare_v_89;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_90> AgradCdfLogScaledInvChiSquare_v_90;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_91> AgradCdfLogScaledInvChiSquare_v_91;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_92> AgradCdfLogScaledInvChiSquare_v_92;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_93> AgradCdfLogScaledInvChiSquare_v_93;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_94> AgradCdfLogScaledInvChiSquare_v_94;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_95> AgradCdfLogScaledInvChiSquare_v_95;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_96> AgradCdfLogScaledInvChiSquare_v_96;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_97> AgradCdfLogScaledInvChiSquare_v_97;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_98> AgradCdfLogScaledInvChiSquare_v_98;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_99> AgradCdfLogScaledInvChiSquare_v_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_0, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_1, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_2, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_3, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_4, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_5, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_6, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_7, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_8, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_9, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_10, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_11, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_12, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_13, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_14, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_15, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_16, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_17, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_18, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_19, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_20, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_21, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_22, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_23, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_24, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_25, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_26, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_27, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_28, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_29, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_30, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_31, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_32, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_33, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_34, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_35, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_36, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_37, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_38, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_39, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_40, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_41, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_42, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_43, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_44, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_45, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_46, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_47, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_48, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_49, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_50, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_51, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_52, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_53, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_54, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_55, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_56, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_57, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_58, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_59, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_60, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_61, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_62, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_63, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_64, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_65, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_66, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_67, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_68, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_69, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_70, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_71, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_72, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_73, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_74, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_75, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_76, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_77, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_78, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_79, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_80, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_81, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_82, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_83, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_84, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_85, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_86, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_87, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_88, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_89, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_90, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_91, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_92, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_93, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_94, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_95, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_96, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_97, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_98, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_99, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_99);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/scaled_inv_chi_square/scaled_inv_chi_square_cdf_log_test.hpp>
+
+typedef std::tuple<double, double, var, empty, empty, empty> type_vv_0;
+typedef std::tuple<double, double, std::vector<var>, empty, empty, empty> type_vv_1;
+typedef std::tuple<double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_2;
+typedef std::tuple<double, std::vector<double>, var, empty, empty, empty> type_vv_3;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_4;
+typedef std::tuple<double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_5;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_6;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_7;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_8;
+typedef std::tuple<double, var, double, empty, empty, empty> type_vv_9;
+typedef std::tuple<double, var, std::vector<double>, empty, empty, empty> type_vv_10;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_11;
+typedef std::tuple<double, var, var, empty, empty, empty> type_vv_12;
+typedef std::tuple<double, var, std::vector<var>, empty, empty, empty> type_vv_13;
+typedef std::tuple<double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_14;
+typedef std::tuple<double, std::vector<var>, double, empty, empty, empty> type_vv_15;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_16;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_17;
+typedef std::tuple<double, std::vector<var>, var, empty, empty, empty> type_vv_18;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_19;
+typedef std::tuple<double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_20;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_21;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_22;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_23;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_24;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_25;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_26;
+typedef std::tuple<std::vector<double>, double, var, empty, empty, empty> type_vv_27;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, empty, empty, empty> type_vv_28;
+typedef std::tuple<std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_29;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, empty, empty, empty> type_vv_30;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_31;
+typedef std::tuple<std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_32;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_33;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_34;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_35;
+typedef std::tuple<std::vector<double>, var, double, empty, empty, empty> type_vv_36;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, empty, empty, empty> type_vv_37;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_38;
+typedef std::tuple<std::vector<double>, var, var, empty, empty, empty> type_vv_39;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, empty, empty, empty> type_vv_40;
+typedef std::tuple<std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_41;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, empty, empty, empty> type_vv_42;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_43;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_44;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, empty, empty, empty> type_vv_45;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_46;
+typedef std::tuple<std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_47;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_48;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_49;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_50;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_51;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_52;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_53;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_vv_54;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_vv_55;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_56;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_vv_57;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_58;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_59;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_60;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_61;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_62;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_vv_63;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_vv_64;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_65;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty, empty> type_vv_66;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty, empty> type_vv_67;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_68;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty, empty> type_vv_69;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_70;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_71;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty, empty> type_vv_72;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_73;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_74;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_75;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_76;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_77;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_78;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_79;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_80;
+typedef std::tuple<var, double, double, empty, empty, empty> type_vv_81;
+typedef std::tuple<var, double, std::vector<double>, empty, empty, empty> type_vv_82;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_83;
+typedef std::tuple<var, double, var, empty, empty, empty> type_vv_84;
+typedef std::tuple<var, double, std::vector<var>, empty, empty, empty> type_vv_85;
+typedef std::tuple<var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_86;
+typedef std::tuple<var, std::vector<double>, double, empty, empty, empty> type_vv_87;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_88;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_89;
+typedef std::tuple<var, std::vector<double>, var, empty, empty, empty> type_vv_90;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_91;
+typedef std::tuple<var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_92;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_93;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_94;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_95;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_96;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_97;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_98;
+typedef std::tuple<var, var, double, empty, empty, empty> type_vv_99;
+
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_0> AgradCdfLogScaledInvChiSquare_vv_0;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_1> AgradCdfLogScaledInvChiSquare_vv_1;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_2> AgradCdfLogScaledInvChiSquare_vv_2;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_3> AgradCdfLogScaledInvChiSquare_vv_3;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_4> AgradCdfLogScaledInvChiSquare_vv_4;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_5> AgradCdfLogScaledInvChiSquare_vv_5;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_6> AgradCdfLogScaledInvChiSquare_vv_6;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_7> AgradCdfLogScaledInvChiSquare_vv_7;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_8> AgradCdfLogScaledInvChiSquare_vv_8;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_9> AgradCdfLogScaledInvChiSquare_vv_9;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_10> AgradCdfLogScaledInvChiSquare_vv_10;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_11> AgradCdfLogScaledInvChiSquare_vv_11;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_12> AgradCdfLogScaledInvChiSquare_vv_12;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_13> AgradCdfLogScaledInvChiSquare_vv_13;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_14> AgradCdfLogScaledInvChiSquare_vv_14;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_15> AgradCdfLogScaledInvChiSquare_vv_15;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_16> AgradCdfLogScaledInvChiSquare_vv_16;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_17> AgradCdfLogScaledInvChiSquare_vv_17;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_18> AgradCdfLogScaledInvChiSquare_vv_18;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_19> AgradCdfLogScaledInvChiSquare_vv_19;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_20> AgradCdfLogScaledInvChiSquare_vv_20;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_21> AgradCdfLogScaledInvChiSquare_vv_21;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_22> AgradCdfLogScaledInvChiSquare_vv_22;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_23> AgradCdfLogScaledInvChiSquare_vv_23;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_24> AgradCdfLogScaledInvChiSquare_vv_24;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_25> AgradCdfLogScaledInvChiSquare_vv_25;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_26> AgradCdfLogScaledInvChiSquare_vv_26;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_27> AgradCdfLogScaledInvChiSquare_vv_27;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_28> AgradCdfLogScaledInvChiSquare_vv_28;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_29> AgradCdfLogScaledInvChiSquare_vv_29;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_30> AgradCdfLogScaledInvChiSquare_vv_30;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_31> AgradCdfLogScaledInvChiSquare_vv_31;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_32> AgradCdfLogScaledInvChiSquare_vv_32;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_33> AgradCdfLogScaledInvChiSquare_vv_33;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_34> AgradCdfLogScaledInvChiSquare_vv_34;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_35> AgradCdfLogScaledInvChiSquare_vv_35;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_36> AgradCdfLogScaledInvChiSquare_vv_36;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_37> AgradCdfLogScaledInvChiSquare_vv_37;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_38> AgradCdfLogScaledInvChiSquare_vv_38;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_39> AgradCdfLogScaledInvChiSquare_vv_39;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_40> AgradCdfLogScaledInvChiSquare_vv_40;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_41> AgradCdfLogScaledInvChiSquare_vv_41;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_42> AgradCdfLogScaledInvChiSquare_vv_42;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_43> AgradCdfLogScaledInvChiSquare_vv_43;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_44> AgradCdfLogScaledInvChiSquare_vv_44;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_45> AgradCdfLogScaledInvChiSquare_vv_45;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_46> AgradCdfLogScaledInvChiSquare_vv_46;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_47> AgradCdfLogScaledInvChiSquare_vv_47;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_48> AgradCdfLogScaledInvChiSquare_vv_48;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_49> AgradCdfLogScaledInvChiSquare_vv_49;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_50> AgradCdfLogScaledInvChiSquare_vv_50;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_51> AgradCdfLogScaledInvChiSquare_vv_51;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_52> AgradCdfLogScaledInvChiSquare_vv_52;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_53> AgradCdfLogScaledInvChiSquare_vv_53;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_54> AgradCdfLogScaledInvChiSquare_vv_54;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_55> AgradCdfLogScaledInvChiSquare_vv_55;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_56> AgradCdfLogScaledInvChiSquare_vv_56;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_57> AgradCdfLogScaledInvChiSquare_vv_57;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_58> AgradCdfLogScaledInvChiSquare_vv_58;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_59> AgradCdfLogScaledInvChiSquare_vv_59;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_60> AgradCdfLogScaledInvChiSquare_vv_60;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_61> AgradCdfLogScaledInvChiSquare_vv_61;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_62> AgradCdfLogScaledInvChiSquare_vv_62;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_63> AgradCdfLogScaledInvChiSquare_vv_63;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_64> AgradCdfLogScaledInvChiSquare_vv_64;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_65> AgradCdfLogScaledInvChiSquare_vv_65;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_66> AgradCdfLogScaledInvChiSquare_vv_66;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_67> AgradCdfLogScaledInvChiSquare_vv_67;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_68> AgradCdfLogScaledInvChiSquare_vv_68;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_69> AgradCdfLogScaledInvChiSquare_vv_69;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_70> AgradCdfLogScaledInvChiSquare_vv_70;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_71> AgradCdfLogScaledInvChiSquare_vv_71;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_72> AgradCdfLogScaledInvChiSquare_vv_72;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_73> AgradCdfLogScaledInvChiSquare_vv_73;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_74> AgradCdfLogScaledInvChiSquare_vv_74;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_75> AgradCdfLogScaledInvChiSquare_vv_75;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_76> AgradCdfLogScaledInvChiSquare_vv_76;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_77> AgradCdfLogScaledInvChiSquare_vv_77;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_78> AgradCdfLogScaledInvChiSquare_vv_78;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_79> AgradCdfLogScaledInvChiSquare_vv_79;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_80> AgradCdfLogScaledInvChiSquare_vv_80;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_81> AgradCdfLogScaledInvChiSquare_vv_81;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_82> AgradCdfLogScaledInvChiSquare_vv_82;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_83> AgradCdfLogScaledInvChiSquare_vv_83;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_84> AgradCdfLogScaledInvChiSquare_vv_84;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_85> AgradCdfLogScaledInvChiSquare_vv_85;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_86> AgradCdfLogScaledInvChiSquare_vv_86;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_87> AgradCdfLogScaledInvChiSquare_vv_87;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_88> AgradCdfLogScaledInvChiSquare_vv_88;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_89> AgradCdfLogScaledInvChiSquare_vv_89;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_90> AgradCdfLogScaledInvChiSquare_vv_90;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_91> AgradCdfLogScaledInvChiSquare_vv_91;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_92> AgradCdfLogScaledInvChiSquare_vv_92;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_93> AgradCdfLogScaledInvChiSquare_vv_93;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_94> AgradCdfLogScaledInvChiSquare_vv_94;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_95> AgradCdfLogScaledInvChiSquare_vv_95;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_96> AgradCdfLogScaledInvChiSquare_vv_96;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_97> AgradCdfLogScaledInvChiSquare_vv_97;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_98> AgradCdfLogScaledInvChiSquare_vv_98;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_99> AgradCdfLogScaledInvChiSquare_vv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_0, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_1, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_2, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_3, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_4, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_5, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_6, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_7, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_8, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_9, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_10, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_11, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_12, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_13, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_14, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_15, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_16, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_17, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_18, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_19, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_20, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_21, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_22, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_23, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_24, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_25, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_26, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_27, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_28, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_29, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_30, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_31, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_32, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_33, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_34, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_35, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_36, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_37, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_38, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_39, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_40, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_41, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_42, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_43, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_44, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_45, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_46, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_47, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_48, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_49, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_50, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_51, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_52, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_53, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_54, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_55, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_56, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_57, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_58, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_59, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_60, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_61, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_62, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_63, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_64, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_65, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_66, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_67, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_68, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_69, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_70, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_71, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_72, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_73, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_74, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_75, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_76, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_77, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_78, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_79, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_80, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_81, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_82, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_83, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_84, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_85, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_86, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_87, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_88, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_89, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_90, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_91, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_92, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_93, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_94, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_95, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_96, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_97, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_98, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_99, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_99);
+
@@ -0,0 +1,278 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/scaled_inv_chi_square/scaled_inv_chi_square_cdf_log_test.hpp>
+
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_100;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_101;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_102;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_103;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_104;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_105;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_106;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_107;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_108;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_109;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_110;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_111;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_112;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_113;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_114;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_115;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_116;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, double, empty, empty, empty> type_ffv_117;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty, empty, empty> type_ffv_118;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_119;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_120;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_121;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_122;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty, empty, empty> type_ffv_123;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_124;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_125;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_126;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_127;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_128;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_129;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_130;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_131;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_132;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_133;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_134;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_135;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_136;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_137;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_138;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_139;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_140;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_141;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_142;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_143;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_144;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_145;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_146;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_147;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_148;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_149;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_150;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_151;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_152;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_ffv_153;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_ffv_154;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_155;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty, empty> type_ffv_156;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_157;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_158;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_ffv_159;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_ffv_160;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_161;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty, empty> type_ffv_162;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_163;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_164;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_165;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_166;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_167;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_168;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_169;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_170;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty, empty> type_ffv_171;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty, empty> type_ffv_172;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_173;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty, empty> type_ffv_174;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_175;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_176;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty, empty> type_ffv_177;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty, empty> type_ffv_178;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_179;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty, empty> type_ffv_180;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_181;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_182;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty, empty> type_ffv_183;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_ffv_184;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_185;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty, empty> type_ffv_186;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty, empty> type_ffv_187;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty, empty> type_ffv_188;
+
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_100> AgradCdfLogScaledInvChiSquare_ffv_100;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_101> AgradCdfLogScaledInvChiSquare_ffv_101;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_102> AgradCdfLogScaledInvChiSquare_ffv_102;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_103> AgradCdfLogScaledInvChiSquare_ffv_103;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_104> AgradCdfLogScaledInvChiSquare_ffv_104;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_105> AgradCdfLogScaledInvChiSquare_ffv_105;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_106> AgradCdfLogScaledInvChiSquare_ffv_106;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_107> AgradCdfLogScaledInvChiSquare_ffv_107;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_108> AgradCdfLogScaledInvChiSquare_ffv_108;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_109> AgradCdfLogScaledInvChiSquare_ffv_109;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_110> AgradCdfLogScaledInvChiSquare_ffv_110;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_111> AgradCdfLogScaledInvChiSquare_ffv_111;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_112> AgradCdfLogScaledInvChiSquare_ffv_112;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_113> AgradCdfLogScaledInvChiSquare_ffv_113;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_114> AgradCdfLogScaledInvChiSquare_ffv_114;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_115> AgradCdfLogScaledInvChiSquare_ffv_115;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_116> AgradCdfLogScaledInvChiSquare_ffv_116;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_117> AgradCdfLogScaledInvChiSquare_ffv_117;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_118> AgradCdfLogScaledInvChiSquare_ffv_118;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_119> AgradCdfLogScaledInvChiSquare_ffv_119;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_120> AgradCdfLogScaledInvChiSquare_ffv_120;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_121> AgradCdfLogScaledInvChiSquare_ffv_121;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_122> AgradCdfLogScaledInvChiSquare_ffv_122;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_123> AgradCdfLogScaledInvChiSquare_ffv_123;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_124> AgradCdfLogScaledInvChiSquare_ffv_124;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_125> AgradCdfLogScaledInvChiSquare_ffv_125;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_126> AgradCdfLogScaledInvChiSquare_ffv_126;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_127> AgradCdfLogScaledInvChiSquare_ffv_127;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_128> AgradCdfLogScaledInvChiSquare_ffv_128;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_129> AgradCdfLogScaledInvChiSquare_ffv_129;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_130> AgradCdfLogScaledInvChiSquare_ffv_130;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_131> AgradCdfLogScaledInvChiSquare_ffv_131;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_132> AgradCdfLogScaledInvChiSquare_ffv_132;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_133> AgradCdfLogScaledInvChiSquare_ffv_133;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_134> AgradCdfLogScaledInvChiSquare_ffv_134;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_135> AgradCdfLogScaledInvChiSquare_ffv_135;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_136> AgradCdfLogScaledInvChiSquare_ffv_136;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_137> AgradCdfLogScaledInvChiSquare_ffv_137;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_138> AgradCdfLogScaledInvChiSquare_ffv_138;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_139> AgradCdfLogScaledInvChiSquare_ffv_139;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_140> AgradCdfLogScaledInvChiSquare_ffv_140;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_141> AgradCdfLogScaledInvChiSquare_ffv_141;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_142> AgradCdfLogScaledInvChiSquare_ffv_142;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_143> AgradCdfLogScaledInvChiSquare_ffv_143;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_144> AgradCdfLogScaledInvChiSquare_ffv_144;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_145> AgradCdfLogScaledInvChiSquare_ffv_145;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_146> AgradCdfLogScaledInvChiSquare_ffv_146;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_147> AgradCdfLogScaledInvChiSquare_ffv_147;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_148> AgradCdfLogScaledInvChiSquare_ffv_148;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_149> AgradCdfLogScaledInvChiSquare_ffv_149;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_150> AgradCdfLogScaledInvChiSquare_ffv_150;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_151> AgradCdfLogScaledInvChiSquare_ffv_151;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_152> AgradCdfLogScaledInvChiSquare_ffv_152;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_153> AgradCdfLogScaledInvChiSquare_ffv_153;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_154> AgradCdfLogScaledInvChiSquare_ffv_154;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_155> AgradCdfLogScaledInvChiSquare_ffv_155;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_156> AgradCdfLogScaledInvChiSquare_ffv_156;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_157> AgradCdfLogScaledInvChiSquare_ffv_157;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_158> AgradCdfLogScaledInvChiSquare_ffv_158;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_159> AgradCdfLogScaledInvChiSquare_ffv_159;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_160> AgradCdfLogScaledInvChiSquare_ffv_160;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_161> AgradCdfLogScaledInvChiSquare_ffv_161;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_162> AgradCdfLogScaledInvChiSquare_ffv_162;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_163> AgradCdfLogScaledInvChiSquare_ffv_163;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_164> AgradCdfLogScaledInvChiSquare_ffv_164;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_165> AgradCdfLogScaledInvChiSquare_ffv_165;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_166> AgradCdfLogScaledInvChiSquare_ffv_166;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_167> AgradCdfLogScaledInvChiSquare_ffv_167;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_168> AgradCdfLogScaledInvChiSquare_ffv_168;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_169> AgradCdfLogScaledInvChiSquare_ffv_169;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_170> AgradCdfLogScaledInvChiSquare_ffv_170;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_171> AgradCdfLogScaledInvChiSquare_ffv_171;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_172> AgradCdfLogScaledInvChiSquare_ffv_172;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_173> AgradCdfLogScaledInvChiSquare_ffv_173;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_174> AgradCdfLogScaledInvChiSquare_ffv_174;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_175> AgradCdfLogScaledInvChiSquare_ffv_175;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_176> AgradCdfLogScaledInvChiSquare_ffv_176;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_177> AgradCdfLogScaledInvChiSquare_ffv_177;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_178> AgradCdfLogScaledInvChiSquare_ffv_178;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_179> AgradCdfLogScaledInvChiSquare_ffv_179;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_180> AgradCdfLogScaledInvChiSquare_ffv_180;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_181> AgradCdfLogScaledInvChiSquare_ffv_181;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_182> AgradCdfLogScaledInvChiSquare_ffv_182;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_183> AgradCdfLogScaledInvChiSquare_ffv_183;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_184> AgradCdfLogScaledInvChiSquare_ffv_184;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_185> AgradCdfLogScaledInvChiSquare_ffv_185;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_186> AgradCdfLogScaledInvChiSquare_ffv_186;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_187> AgradCdfLogScaledInvChiSquare_ffv_187;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_ffv_188> AgradCdfLogScaledInvChiSquare_ffv_188;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_100, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_101, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_102, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_103, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_104, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_105, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_106, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_107, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_108, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_109, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_110, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_111, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_112, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_113, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_114, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_115, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_116, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_117, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_118, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_119, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_120, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_121, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_122, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_123, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_124, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_125, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_126, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_127, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_128, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_129, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_130, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_131, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_132, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_133, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_134, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_135, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_136, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_137, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_138, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_139, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_140, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_141, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_142, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_143, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_144, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_145, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_146, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_147, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_148, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_149, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_150, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_151, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_152, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_153, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_154, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_155, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_156, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_157, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_158, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_159, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_160, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_161, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_162, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_163, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_164, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_165, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_166, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_167, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_168, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_169, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_170, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_171, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_172, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_173, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_174, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_175, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_176, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_177, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_178, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_179, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_180, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_181, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_182, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_183, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_184, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_185, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_186, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_187, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_ffv_188, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_ffv_188);
+
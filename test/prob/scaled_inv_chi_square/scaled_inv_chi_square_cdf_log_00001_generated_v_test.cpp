@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/scaled_inv_chi_square/scaled_inv_chi_square_cdf_log_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_100;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_101;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_102;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_103;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_104;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_105;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_106;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_107;
+typedef std::tuple<var, double, double, empty, empty, empty> type_v_108;
+typedef std::tuple<var, double, std::vector<double>, empty, empty, empty> type_v_109;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_110;
+typedef std::tuple<var, double, var, empty, empty, empty> type_v_111;
+typedef std::tuple<var, double, std::vector<var>, empty, empty, empty> type_v_112;
+typedef std::tuple<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_113;
+typedef std::tuple<var, std::vector<double>, double, empty, empty, empty> type_v_114;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_115;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_116;
+typedef std::tuple<var, std::vector<double>, var, empty, empty, empty> type_v_117;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_118;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_119;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_120;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_121;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_122;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_123;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_124;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_125;
+typedef std::tuple<var, var, double, empty, empty, empty> type_v_126;
+typedef std::tuple<var, var, std::vector<double>, empty, empty, empty> type_v_127;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_128;
+typedef std::tuple<var, var, var, empty, empty, empty> type_v_129;
+typedef std::tuple<var, var, std::vector<var>, empty, empty, empty> type_v_130;
+typedef std::tuple<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_131;
+typedef std::tuple<var, std::vector<var>, double, empty, empty, empty> type_v_132;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_133;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_134;
+typedef std::tuple<var, std::vector<var>, var, empty, empty, empty> type_v_135;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_136;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_137;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_138;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_139;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_140;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_141;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_142;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_143;
+typedef std::tuple<std::vector<var>, double, double, empty, empty, empty> type_v_144;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, empty, empty, empty> type_v_145;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_146;
+typedef std::tuple<std::vector<var>, double, var, empty, empty, empty> type_v_147;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, empty, empty, empty> type_v_148;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_149;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, empty, empty, empty> type_v_150;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_151;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_152;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, empty, empty, empty> type_v_153;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_154;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_155;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_156;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_157;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_158;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_159;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_160;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_161;
+typedef std::tuple<std::vector<var>, var, double, empty, empty, empty> type_v_162;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, empty, empty, empty> type_v_163;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_164;
+typedef std::tuple<std::vector<var>, var, var, empty, empty, empty> type_v_165;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, empty, empty, empty> type_v_166;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_167;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, empty, empty, empty> type_v_168;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, empty, empty, empty> type_v_169;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_170;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, empty, empty, empty> type_v_171;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, empty, empty, empty> type_v_172;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_173;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_174;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_175;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_176;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_177;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_178;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_179;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty, empty, empty> type_v_180;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty, empty> type_v_181;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_182;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty, empty, empty> type_v_183;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty, empty> type_v_184;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_185;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty, empty> type_v_186;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty, empty> type_v_187;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_188;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty, empty> type_v_189;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty, empty> type_v_190;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_191;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_v_192;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_v_193;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_v_194;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_v_195;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_v_196;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty, empty> type_v_197;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty, empty, empty> type_v_198;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty, empty> type_v_199;
+
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_100> AgradCdfLogScaledInvChiSquare_v_100;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_101> AgradCdfLogScaledInvChiSquare_v_101;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_102> AgradCdfLogScaledInvChiSquare_v_102;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_103> AgradCdfLogScaledInvChiSquare_v_103;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_104> AgradCdfLogScaledInvChiSquare_v_104;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_105> AgradCdfLogScaledInvChiSquare_v_105;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_106> AgradCdfLogScaledInvChiSquare_v_106;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_107> AgradCdfLogScaledInvChiSquare_v_107;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_108> AgradCdfLogScaledInvChiSquare_v_108;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_109> AgradCdfLogScaledInvChiSquare_v_109;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_110> AgradCdfLogScaledInvChiSquare_v_110;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_111> AgradCdfLogScaledInvChiSquare_v_111;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_112> AgradCdfLogScaledInvChiSquare_v_112;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_113> AgradCdfLogScaledInvChiSquare_v_113;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_114> AgradCdfLogScaledInvChiSquare_v_114;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_115> AgradCdfLogScaledInvChiSquare_v_115;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_116> AgradCdfLogScaledInvChiSquare_v_116;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_117> AgradCdfLogScaledInvChiSquare_v_117;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_118> AgradCdfLogScaledInvChiSquare_v_118;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_119> AgradCdfLogScaledInvChiSquare_v_119;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_120> AgradCdfLogScaledInvChiSquare_v_120;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_121> AgradCdfLogScaledInvChiSquare_v_121;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_122> AgradCdfLogScaledInvChiSquare_v_122;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_123> AgradCdfLogScaledInvChiSquare_v_123;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_124> AgradCdfLogScaledInvChiSquare_v_124;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_125> AgradCdfLogScaledInvChiSquare_v_125;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_126> AgradCdfLogScaledInvChiSquare_v_126;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_127> AgradCdfLogScaledInvChiSquare_v_127;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_128> AgradCdfLogScaledInvChiSquare_v_128;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_129> AgradCdfLogScaledInvChiSquare_v_129;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_130> AgradCdfLogScaledInvChiSquare_v_130;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_131> AgradCdfLogScaledInvChiSquare_v_131;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_132> AgradCdfLogScaledInvChiSquare_v_132;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_133> AgradCdfLogScaledInvChiSquare_v_133;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_134> AgradCdfLogScaledInvChiSquare_v_134;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_135> AgradCdfLogScaledInvChiSquare_v_135;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_136> AgradCdfLogScaledInvChiSquare_v_136;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_137> AgradCdfLogScaledInvChiSquare_v_137;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_138> AgradCdfLogScaledInvChiSquare_v_138;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_139> AgradCdfLogScaledInvChiSquare_v_139;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_140> AgradCdfLogScaledInvChiSquare_v_140;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_141> AgradCdfLogScaledInvChiSquare_v_141;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_142> AgradCdfLogScaledInvChiSquare_v_142;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_143> AgradCdfLogScaledInvChiSquare_v_143;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_144> AgradCdfLogScaledInvChiSquare_v_144;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_145> AgradCdfLogScaledInvChiSquare_v_145;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_146> AgradCdfLogScaledInvChiSquare_v_146;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_147> AgradCdfLogScaledInvChiSquare_v_147;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_148> AgradCdfLogScaledInvChiSquare_v_148;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_149> AgradCdfLogScaledInvChiSquare_v_149;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_150> AgradCdfLogScaledInvChiSquare_v_150;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_151> AgradCdfLogScaledInvChiSquare_v_151;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_152> AgradCdfLogScaledInvChiSquare_v_152;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_153> AgradCdfLogScaledInvChiSquare_v_153;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_154> AgradCdfLogScaledInvChiSquare_v_154;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_155> AgradCdfLogScaledInvChiSquare_v_155;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_156> AgradCdfLogScaledInvChiSquare_v_156;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_157> AgradCdfLogScaledInvChiSquare_v_157;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_158> AgradCdfLogScaledInvChiSquare_v_158;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_159> AgradCdfLogScaledInvChiSquare_v_159;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_160> AgradCdfLogScaledInvChiSquare_v_160;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_161> AgradCdfLogScaledInvChiSquare_v_161;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_162> AgradCdfLogScaledInvChiSquare_v_162;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_163> AgradCdfLogScaledInvChiSquare_v_163;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_164> AgradCdfLogScaledInvChiSquare_v_164;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_165> AgradCdfLogScaledInvChiSquare_v_165;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_166> AgradCdfLogScaledInvChiSquare_v_166;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_167> AgradCdfLogScaledInvChiSquare_v_167;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_168> AgradCdfLogScaledInvChiSquare_v_168;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_169> AgradCdfLogScaledInvChiSquare_v_169;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_170> AgradCdfLogScaledInvChiSquare_v_170;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_171> AgradCdfLogScaledInvChiSquare_v_171;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_172> AgradCdfLogScaledInvChiSquare_v_172;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_173> AgradCdfLogScaledInvChiSquare_v_173;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_174> AgradCdfLogScaledInvChiSquare_v_174;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_175> AgradCdfLogScaledInvChiSquare_v_175;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_176> AgradCdfLogScaledInvChiSquare_v_176;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_177> AgradCdfLogScaledInvChiSquare_v_177;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_178> AgradCdfLogScaledInvChiSquare_v_178;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_179> AgradCdfLogScaledInvChiSquare_v_179;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_180> AgradCdfLogScaledInvChiSquare_v_180;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_181> AgradCdfLogScaledInvChiSquare_v_181;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_182> AgradCdfLogScaledInvChiSquare_v_182;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_183> AgradCdfLogScaledInvChiSquare_v_183;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_184> AgradCdfLogScaledInvChiSquare_v_184;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_185> AgradCdfLogScaledInvChiSquare_v_185;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_186> AgradCdfLogScaledInvChiSquare_v_186;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_187> AgradCdfLogScaledInvChiSquare_v_187;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_188> AgradCdfLogScaledInvChiSquare_v_188;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_189> AgradCdfLogScaledInvChiSquare_v_189;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_190> AgradCdfLogScaledInvChiSquare_v_190;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_191> AgradCdfLogScaledInvChiSquare_v_191;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_192> AgradCdfLogScaledInvChiSquare_v_192;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_193> AgradCdfLogScaledInvChiSquare_v_193;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_194> AgradCdfLogScaledInvChiSquare_v_194;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_195> AgradCdfLogScaledInvChiSquare_v_195;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_196> AgradCdfLogScaledInvChiSquare_v_196;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_197> AgradCdfLogScaledInvChiSquare_v_197;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_198> AgradCdfLogScaledInvChiSquare_v_198;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_v_199> AgradCdfLogScaledInvChiSquare_v_199;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_100, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_101, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_102, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_103, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_104, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_105, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_106, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_107, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_108, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_109, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_110, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_111, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_112, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_113, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_114, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_115, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_116, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_117, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_118, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_119, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_120, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_121, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_122, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_123, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_124, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_125, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_126, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_127, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_128, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_129, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_130, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_131, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_132, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_133, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_134, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_135, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_136, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_137, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_138, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_139, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_140, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_141, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_142, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_143, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_144, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_145, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_146, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_147, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_148, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_149, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_150, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_151, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_152, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_153, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_154, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_155, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_156, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_157, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_158, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_159, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_160, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_161, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_162, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_163, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_164, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_165, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_166, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_167, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_168, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_169, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_170, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_171, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_172, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_173, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_174, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_175, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_176, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_177, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_178, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_179, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_180, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_181, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_182, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_183, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_184, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_185, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_186, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_187, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_188, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_188);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_189, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_189);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_190, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_190);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_191, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_191);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_192, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_192);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_193, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_193);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_194, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_194);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_195, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_195);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_196, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_196);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_197, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_197);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_198, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_198);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_v_199, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_v_199);
+
@@ -0,0 +1,278 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/scaled_inv_chi_square/scaled_inv_chi_square_cdf_log_test.hpp>
+
+typedef std::tuple<var, var, std::vector<double>, empty, empty, empty> type_vv_100;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_101;
+typedef std::tuple<var, var, var, empty, empty, empty> type_vv_102;
+typedef std::tuple<var, var, std::vector<var>, empty, empty, empty> type_vv_103;
+typedef std::tuple<var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_104;
+typedef std::tuple<var, std::vector<var>, double, empty, empty, empty> type_vv_105;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_106;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_107;
+typedef std::tuple<var, std::vector<var>, var, empty, empty, empty> type_vv_108;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_109;
+typedef std::tuple<var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_110;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_111;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_112;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_113;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_114;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_115;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_116;
+typedef std::tuple<std::vector<var>, double, double, empty, empty, empty> type_vv_117;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, empty, empty, empty> type_vv_118;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_119;
+typedef std::tuple<std::vector<var>, double, var, empty, empty, empty> type_vv_120;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, empty, empty, empty> type_vv_121;
+typedef std::tuple<std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_122;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, empty, empty, empty> type_vv_123;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_124;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_125;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, empty, empty, empty> type_vv_126;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_127;
+typedef std::tuple<std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_128;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_129;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_130;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_131;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_132;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_133;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_134;
+typedef std::tuple<std::vector<var>, var, double, empty, empty, empty> type_vv_135;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, empty, empty, empty> type_vv_136;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_137;
+typedef std::tuple<std::vector<var>, var, var, empty, empty, empty> type_vv_138;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, empty, empty, empty> type_vv_139;
+typedef std::tuple<std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_140;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, empty, empty, empty> type_vv_141;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_142;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_143;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, empty, empty, empty> type_vv_144;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_145;
+typedef std::tuple<std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_146;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_147;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_148;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_149;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_150;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_151;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_152;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, empty, empty, empty> type_vv_153;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, empty, empty, empty> type_vv_154;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_155;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, empty, empty, empty> type_vv_156;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, empty, empty, empty> type_vv_157;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_158;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, empty, empty, empty> type_vv_159;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, empty, empty, empty> type_vv_160;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_161;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, empty, empty, empty> type_vv_162;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, empty, empty, empty> type_vv_163;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_164;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty, empty> type_vv_165;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty, empty> type_vv_166;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_167;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty, empty> type_vv_168;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty, empty> type_vv_169;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_170;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, empty, empty, empty> type_vv_171;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, empty, empty, empty> type_vv_172;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_173;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, empty, empty, empty> type_vv_174;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, empty, empty, empty> type_vv_175;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_176;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, empty, empty, empty> type_vv_177;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, empty, empty, empty> type_vv_178;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_179;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, empty, empty, empty> type_vv_180;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, empty, empty, empty> type_vv_181;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_182;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty, empty> type_vv_183;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty, empty> type_vv_184;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty, empty> type_vv_185;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty, empty> type_vv_186;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty, empty> type_vv_187;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty, empty> type_vv_188;
+
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_100> AgradCdfLogScaledInvChiSquare_vv_100;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_101> AgradCdfLogScaledInvChiSquare_vv_101;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_102> AgradCdfLogScaledInvChiSquare_vv_102;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_103> AgradCdfLogScaledInvChiSquare_vv_103;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_104> AgradCdfLogScaledInvChiSquare_vv_104;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_105> AgradCdfLogScaledInvChiSquare_vv_105;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_106> AgradCdfLogScaledInvChiSquare_vv_106;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_107> AgradCdfLogScaledInvChiSquare_vv_107;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_108> AgradCdfLogScaledInvChiSquare_vv_108;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_109> AgradCdfLogScaledInvChiSquare_vv_109;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_110> AgradCdfLogScaledInvChiSquare_vv_110;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_111> AgradCdfLogScaledInvChiSquare_vv_111;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_112> AgradCdfLogScaledInvChiSquare_vv_112;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_113> AgradCdfLogScaledInvChiSquare_vv_113;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_114> AgradCdfLogScaledInvChiSquare_vv_114;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_115> AgradCdfLogScaledInvChiSquare_vv_115;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_116> AgradCdfLogScaledInvChiSquare_vv_116;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_117> AgradCdfLogScaledInvChiSquare_vv_117;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_118> AgradCdfLogScaledInvChiSquare_vv_118;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_119> AgradCdfLogScaledInvChiSquare_vv_119;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_120> AgradCdfLogScaledInvChiSquare_vv_120;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_121> AgradCdfLogScaledInvChiSquare_vv_121;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_122> AgradCdfLogScaledInvChiSquare_vv_122;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_123> AgradCdfLogScaledInvChiSquare_vv_123;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_124> AgradCdfLogScaledInvChiSquare_vv_124;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_125> AgradCdfLogScaledInvChiSquare_vv_125;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_126> AgradCdfLogScaledInvChiSquare_vv_126;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_127> AgradCdfLogScaledInvChiSquare_vv_127;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_128> AgradCdfLogScaledInvChiSquare_vv_128;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_129> AgradCdfLogScaledInvChiSquare_vv_129;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_130> AgradCdfLogScaledInvChiSquare_vv_130;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_131> AgradCdfLogScaledInvChiSquare_vv_131;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_132> AgradCdfLogScaledInvChiSquare_vv_132;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_133> AgradCdfLogScaledInvChiSquare_vv_133;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_134> AgradCdfLogScaledInvChiSquare_vv_134;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_135> AgradCdfLogScaledInvChiSquare_vv_135;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_136> AgradCdfLogScaledInvChiSquare_vv_136;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_137> AgradCdfLogScaledInvChiSquare_vv_137;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_138> AgradCdfLogScaledInvChiSquare_vv_138;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_139> AgradCdfLogScaledInvChiSquare_vv_139;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_140> AgradCdfLogScaledInvChiSquare_vv_140;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_141> AgradCdfLogScaledInvChiSquare_vv_141;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_142> AgradCdfLogScaledInvChiSquare_vv_142;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_143> AgradCdfLogScaledInvChiSquare_vv_143;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_144> AgradCdfLogScaledInvChiSquare_vv_144;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_145> AgradCdfLogScaledInvChiSquare_vv_145;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_146> AgradCdfLogScaledInvChiSquare_vv_146;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_147> AgradCdfLogScaledInvChiSquare_vv_147;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_148> AgradCdfLogScaledInvChiSquare_vv_148;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_149> AgradCdfLogScaledInvChiSquare_vv_149;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_150> AgradCdfLogScaledInvChiSquare_vv_150;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_151> AgradCdfLogScaledInvChiSquare_vv_151;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_152> AgradCdfLogScaledInvChiSquare_vv_152;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_153> AgradCdfLogScaledInvChiSquare_vv_153;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_154> AgradCdfLogScaledInvChiSquare_vv_154;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_155> AgradCdfLogScaledInvChiSquare_vv_155;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_156> AgradCdfLogScaledInvChiSquare_vv_156;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_157> AgradCdfLogScaledInvChiSquare_vv_157;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_158> AgradCdfLogScaledInvChiSquare_vv_158;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_159> AgradCdfLogScaledInvChiSquare_vv_159;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_160> AgradCdfLogScaledInvChiSquare_vv_160;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_161> AgradCdfLogScaledInvChiSquare_vv_161;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_162> AgradCdfLogScaledInvChiSquare_vv_162;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_163> AgradCdfLogScaledInvChiSquare_vv_163;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_164> AgradCdfLogScaledInvChiSquare_vv_164;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_165> AgradCdfLogScaledInvChiSquare_vv_165;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_166> AgradCdfLogScaledInvChiSquare_vv_166;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_167> AgradCdfLogScaledInvChiSquare_vv_167;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_168> AgradCdfLogScaledInvChiSquare_vv_168;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_169> AgradCdfLogScaledInvChiSquare_vv_169;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_170> AgradCdfLogScaledInvChiSquare_vv_170;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_171> AgradCdfLogScaledInvChiSquare_vv_171;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_172> AgradCdfLogScaledInvChiSquare_vv_172;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_173> AgradCdfLogScaledInvChiSquare_vv_173;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_174> AgradCdfLogScaledInvChiSquare_vv_174;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_175> AgradCdfLogScaledInvChiSquare_vv_175;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_176> AgradCdfLogScaledInvChiSquare_vv_176;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_177> AgradCdfLogScaledInvChiSquare_vv_177;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_178> AgradCdfLogScaledInvChiSquare_vv_178;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_179> AgradCdfLogScaledInvChiSquare_vv_179;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_180> AgradCdfLogScaledInvChiSquare_vv_180;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_181> AgradCdfLogScaledInvChiSquare_vv_181;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_182> AgradCdfLogScaledInvChiSquare_vv_182;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_183> AgradCdfLogScaledInvChiSquare_vv_183;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_184> AgradCdfLogScaledInvChiSquare_vv_184;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_185> AgradCdfLogScaledInvChiSquare_vv_185;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_186> AgradCdfLogScaledInvChiSquare_vv_186;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_187> AgradCdfLogScaledInvChiSquare_vv_187;
+typedef std::tuple<AgradCdfLogScaledInvChiSquare, type_vv_188> AgradCdfLogScaledInvChiSquare_vv_188;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_100, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_101, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_102, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_103, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_104, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_105, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_106, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_107, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_108, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_109, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_110, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_111, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_112, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_113, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_114, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_115, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_116, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_117, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_118, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_119, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_120, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_121, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_122, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_123, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_124, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_125, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_126, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_127, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_128, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_129, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_130, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_131, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_132, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_133, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_134, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_135, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_136, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_137, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_138, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_139, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_140, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_141, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_142, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_143, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_144, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_145, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_146, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_147, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_148, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_149, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_150, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_151, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_152, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_153, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_154, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_155, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_156, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_157, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_158, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_159, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_160, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_161, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_162, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_163, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_164, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_165, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_166, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_167, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_168, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_169, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_170, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_171, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_172, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_173, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_174, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_175, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_176, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_177, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_178, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_179, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_180, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_181, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_182, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_183, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_184, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_185, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_186, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_187, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfLogScaledInvChiSquare_vv_188, AgradCdfLogTestFixture, AgradCdfLogScaledInvChiSquare_vv_188);
+
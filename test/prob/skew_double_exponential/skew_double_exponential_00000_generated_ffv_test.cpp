@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/skew_double_exponential/skew_double_exponential_test.hpp>
+
+typedef std::tuple<double, double, double, fvar<fvar<var> >, empty, empty> type_ffv_0;
+typedef std::tuple<double, double, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1;
+typedef std::tuple<double, double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_2;
+typedef std::tuple<double, double, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_3;
+typedef std::tuple<double, double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_4;
+typedef std::tuple<double, double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_5;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_6;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_7;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_8;
+typedef std::tuple<double, double, fvar<fvar<var> >, double, empty, empty> type_ffv_9;
+typedef std::tuple<double, double, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_10;
+typedef std::tuple<double, double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_11;
+typedef std::tuple<double, double, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_12;
+typedef std::tuple<double, double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_13;
+typedef std::tuple<double, double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_14;
+typedef std::tuple<double, double, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_15;
+typedef std::tuple<double, double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_16;
+typedef std::tuple<double, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_17;
+typedef std::tuple<double, double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_18;
+typedef std::tuple<double, double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_19;
+typedef std::tuple<double, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_20;
+typedef std::tuple<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_21;
+typedef std::tuple<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_22;
+typedef std::tuple<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_23;
+typedef std::tuple<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_24;
+typedef std::tuple<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_25;
+typedef std::tuple<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_26;
+typedef std::tuple<double, std::vector<double>, double, fvar<fvar<var> >, empty, empty> type_ffv_27;
+typedef std::tuple<double, std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_28;
+typedef std::tuple<double, std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_29;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_30;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_31;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_32;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_33;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_34;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_35;
+typedef std::tuple<double, std::vector<double>, fvar<fvar<var> >, double, empty, empty> type_ffv_36;
+typedef std::tuple<double, std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_37;
+typedef std::tuple<double, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_38;
+typedef std::tuple<double, std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_39;
+typedef std::tuple<double, std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_40;
+typedef std::tuple<double, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_41;
+typedef std::tuple<double, std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_42;
+typedef std::tuple<double, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_43;
+typedef std::tuple<double, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_44;
+typedef std::tuple<double, std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_45;
+typedef std::tuple<double, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_46;
+typedef std::tuple<double, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_47;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_48;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_49;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_50;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_51;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_52;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_53;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_54;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_55;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_56;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_57;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_58;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_59;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_60;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_61;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_62;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_63;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_64;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_65;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_66;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_67;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_68;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_69;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_70;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_71;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_72;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_73;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_74;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_75;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_76;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_77;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_78;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_79;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_80;
+typedef std::tuple<double, fvar<fvar<var> >, double, double, empty, empty> type_ffv_81;
+typedef std::tuple<double, fvar<fvar<var> >, double, std::vector<double>, empty, empty> type_ffv_82;
+typedef std::tuple<double, fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_83;
+typedef std::tuple<double, fvar<fvar<var> >, double, fvar<fvar<var> >, empty, empty> type_ffv_84;
+typedef std::tuple<double, fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_85;
+typedef std::tuple<double, fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_86;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<double>, double, empty, empty> type_ffv_87;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty, empty> type_ffv_88;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_89;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_90;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_91;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_92;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_93;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_94;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_95;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_96;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_97;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_98;
+typedef std::tuple<double, fvar<fvar<var> >, fvar<fvar<var> >, double, empty, empty> type_ffv_99;
+
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_0> AgradDistributionSkewDoubleExponential_ffv_0;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_1> AgradDistributionSkewDoubleExponential_ffv_1;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_2> AgradDistributionSkewDoubleExponential_ffv_2;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_3> AgradDistributionSkewDoubleExponential_ffv_3;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_4> AgradDistributionSkewDoubleExponential_ffv_4;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_5> AgradDistributionSkewDoubleExponential_ffv_5;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_6> AgradDistributionSkewDoubleExponential_ffv_6;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_7> AgradDistributionSkewDoubleExponential_ffv_7;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_8> AgradDistributionSkewDoubleExponential_ffv_8;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_9> AgradDistributionSkewDoubleExponential_ffv_9;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_10> AgradDistributionSkewDoubleExponential_ffv_10;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_11> AgradDistributionSkewDoubleExponential_ffv_11;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_12> AgradDistributionSkewDoubleExponential_ffv_12;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_13> AgradDistributionSkewDoubleExponential_ffv_13;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_14> AgradDistributionSkewDoubleExponential_ffv_14;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_15> AgradDistributionSkewDoubleExponential_ffv_15;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_16> AgradDistributionSkewDoubleExponential_ffv_16;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_17> AgradDistributionSkewDoubleExponential_ffv_17;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_18> AgradDistributionSkewDoubleExponential_ffv_18;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_19> AgradDistributionSkewDoubleExponential_ffv_19;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_20> AgradDistributionSkewDoubleExponential_ffv_20;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_21> AgradDistributionSkewDoubleExponential_ffv_21;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_22> AgradDistributionSkewDoubleExponential_ffv_22;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_23> AgradDistributionSkewDoubleExponential_ffv_23;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_24> AgradDistributionSkewDoubleExponential_ffv_24;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_25> AgradDistributionSkewDoubleExponential_ffv_25;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_26> AgradDistributionSkewDoubleExponential_ffv_26;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_27> AgradDistributionSkewDoubleExponential_ffv_27;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_28> AgradDistributionSkewDoubleExponential_ffv_28;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_29> AgradDistributionSkewDoubleExponential_ffv_29;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_30> AgradDistributionSkewDoubleExponential_ffv_30;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_31> AgradDistributionSkewDoubleExponential_ffv_31;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_32> AgradDistributionSkewDoubleExponential_ffv_32;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_33> AgradDistributionSkewDoubleExponential_ffv_33;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_34> AgradDistributionSkewDoubleExponential_ffv_34;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_35> AgradDistributionSkewDoubleExponential_ffv_35;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_36> AgradDistributionSkewDoubleExponential_ffv_36;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_37> AgradDistributionSkewDoubleExponential_ffv_37;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_38> AgradDistributionSkewDoubleExponential_ffv_38;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_39> AgradDistributionSkewDoubleExponential_ffv_39;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_40> AgradDistributionSkewDoubleExponential_ffv_40;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_41> AgradDistributionSkewDoubleExponential_ffv_41;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_42> AgradDistributionSkewDoubleExponential_ffv_42;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_43> AgradDistributionSkewDoubleExponential_ffv_43;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_44> AgradDistributionSkewDoubleExponential_ffv_44;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_45> AgradDistributionSkewDoubleExponential_ffv_45;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_46> AgradDistributionSkewDoubleExponential_ffv_46;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_47> AgradDistributionSkewDoubleExponential_ffv_47;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_48> AgradDistributionSkewDoubleExponential_ffv_48;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_49> AgradDistributionSkewDoubleExponential_ffv_49;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_50> AgradDistributionSkewDoubleExponential_ffv_50;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_51> AgradDistributionSkewDoubleExponential_ffv_51;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_52> AgradDistributionSkewDoubleExponential_ffv_52;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_53> AgradDistributionSkewDoubleExponential_ffv_53;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_54> AgradDistributionSkewDoubleExponential_ffv_54;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_55> AgradDistributionSkewDoubleExponential_ffv_55;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_56> AgradDistributionSkewDoubleExponential_ffv_56;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_57> AgradDistributionSkewDoubleExponential_ffv_57;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_58> AgradDistributionSkewDoubleExponential_ffv_58;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_59> AgradDistributionSkewDoubleExponential_ffv_59;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_60> AgradDistributionSkewDoubleExponential_ffv_60;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_61> AgradDistributionSkewDoubleExponential_ffv_61;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_62> AgradDistributionSkewDoubleExponential_ffv_62;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_63> AgradDistributionSkewDoubleExponential_ffv_63;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_64> AgradDistributionSkewDoubleExponential_ffv_64;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_65> AgradDistributionSkewDoubleExponential_ffv_65;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_66> AgradDistributionSkewDoubleExponential_ffv_66;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_67> AgradDistributionSkewDoubleExponential_ffv_67;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_68> AgradDistributionSkewDoubleExponential_ffv_68;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_69> AgradDistributionSkewDoubleExponential_ffv_69;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_70> AgradDistributionSkewDoubleExponential_ffv_70;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_71> AgradDistributionSkewDoubleExponential_ffv_71;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_72> AgradDistributionSkewDoubleExponential_ffv_72;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_73> AgradDistributionSkewDoubleExponential_ffv_73;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_74> AgradDistributionSkewDoubleExponential_ffv_74;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_75> AgradDistributionSkewDoubleExponential_ffv_75;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_76> AgradDistributionSkewDoubleExponential_ffv_76;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_77> AgradDistributionSkewDoubleExponential_ffv_77;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_78> AgradDistributionSkewDoubleExponential_ffv_78;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_79> AgradDistributionSkewDoubleExponential_ffv_79;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_80> AgradDistributionSkewDoubleExponential_ffv_80;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_81> AgradDistributionSkewDoubleExponential_ffv_81;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_82> AgradDistributionSkewDoubleExponential_ffv_82;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_83> AgradDistributionSkewDoubleExponential_ffv_83;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_84> AgradDistributionSkewDoubleExponential_ffv_84;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_85> AgradDistributionSkewDoubleExponential_ffv_85;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_86> AgradDistributionSkewDoubleExponential_ffv_86;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_87> AgradDistributionSkewDoubleExponential_ffv_87;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_88> AgradDistributionSkewDoubleExponential_ffv_88;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_89> AgradDistributionSkewDoubleExponential_ffv_89;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_90> AgradDistributionSkewDoubleExponential_ffv_90;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_91> AgradDistributionSkewDoubleExponential_ffv_91;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_92> AgradDistributionSkewDoubleExponential_ffv_92;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_93> AgradDistributionSkewDoubleExponential_ffv_93;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_94> AgradDistributionSkewDoubleExponential_ffv_94;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_95> AgradDistributionSkewDoubleExponential_ffv_95;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_96> AgradDistributionSkewDoubleExponential_ffv_96;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_97> AgradDistributionSkewDoubleExponential_ffv_97;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_98> AgradDistributionSkewDoubleExponential_ffv_98;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_99> AgradDistributionSkewDoubleExponential_ffv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_0, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_1, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_2, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_3, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_4, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_5, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_6, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_7, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_8, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_9, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_10, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_11, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_12, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_13, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_14, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_15, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_16, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_17, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_18, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_19, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_20, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_21, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_22, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_23, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_24, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_25, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_26, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_27, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_28, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_29, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_30, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_31, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_32, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_33, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_34, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_35, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_36, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_37, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_38, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_39, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_40, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_41, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_42, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_43, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_44, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_45, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_46, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_47, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_48, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_49, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_50, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_51, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_52, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_53, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_54, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_55, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_56, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_57, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_58, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_59, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_60, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_61, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_62, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_63, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_64, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_65, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_66, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_67, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_68, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_69, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_70, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_71, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_72, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_73, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_74, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_75, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_76, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_77, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_78, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_79, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_80, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_81, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_82, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_83, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_84, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_85, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_86, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_87, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_88, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_89, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_90, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_91, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_92, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_93, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_94, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_95, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_96, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_97, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_98, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_99, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_99);
+
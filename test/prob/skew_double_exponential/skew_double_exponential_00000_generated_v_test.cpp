@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/skew_double_exponential/skew_double_exponential_test.hpp>
+
+typedef std::tuple<double, double, double, double, empty, empty> type_v_0;
+typedef std::tuple<double, double, double, std::vector<double>, empty, empty> type_v_1;
+typedef std::tuple<double, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_2;
+typedef std::tuple<double, double, double, var, empty, empty> type_v_3;
+typedef std::tuple<double, double, double, std::vector<var>, empty, empty> type_v_4;
+typedef std::tuple<double, double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_5;
+typedef std::tuple<double, double, std::vector<double>, double, empty, empty> type_v_6;
+typedef std::tuple<double, double, std::vector<double>, std::vector<double>, empty, empty> type_v_7;
+typedef std::tuple<double, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_8;
+typedef std::tuple<double, double, std::vector<double>, var, empty, empty> type_v_9;
+typedef std::tuple<double, double, std::vector<double>, std::vector<var>, empty, empty> type_v_10;
+typedef std::tuple<double, double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_11;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_12;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_13;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_14;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_15;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_16;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_17;
+typedef std::tuple<double, double, var, double, empty, empty> type_v_18;
+typedef std::tuple<double, double, var, std::vector<double>, empty, empty> type_v_19;
+typedef std::tuple<double, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_20;
+typedef std::tuple<double, double, var, var, empty, empty> type_v_21;
+typedef std::tuple<double, double, var, std::vector<var>, empty, empty> type_v_22;
+typedef std::tuple<double, double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_23;
+typedef std::tuple<double, double, std::vector<var>, double, empty, empty> type_v_24;
+typedef std::tuple<double, double, std::vector<var>, std::vector<double>, empty, empty> type_v_25;
+typedef std::tuple<double, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_26;
+typedef std::tuple<double, double, std::vector<var>, var, empty, empty> type_v_27;
+typedef std::tuple<double, double, std::vector<var>, std::vector<var>, empty, empty> type_v_28;
+typedef std::tuple<double, double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_29;
+typedef std::tuple<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_30;
+typedef std::tuple<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_31;
+typedef std::tuple<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_32;
+typedef std::tuple<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_33;
+typedef std::tuple<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_34;
+typedef std::tuple<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_35;
+typedef std::tuple<double, std::vector<double>, double, double, empty, empty> type_v_36;
+typedef std::tuple<double, std::vector<double>, double, std::vector<double>, empty, empty> type_v_37;
+typedef std::tuple<double, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_38;
+typedef std::tuple<double, std::vector<double>, double, var, empty, empty> type_v_39;
+typedef std::tuple<double, std::vector<double>, double, std::vector<var>, empty, empty> type_v_40;
+typedef std::tuple<double, std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_41;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, double, empty, empty> type_v_42;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, std::vector<double>, empty, empty> type_v_43;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_44;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, var, empty, empty> type_v_45;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_v_46;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_47;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_48;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_49;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_50;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_51;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_52;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_53;
+typedef std::tuple<double, std::vector<double>, var, double, empty, empty> type_v_54;
+typedef std::tuple<double, std::vector<double>, var, std::vector<double>, empty, empty> type_v_55;
+typedef std::tuple<double, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_56;
+typedef std::tuple<double, std::vector<double>, var, var, empty, empty> type_v_57;
+typedef std::tuple<double, std::vector<double>, var, std::vector<var>, empty, empty> type_v_58;
+typedef std::tuple<double, std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_59;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, double, empty, empty> type_v_60;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_v_61;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_62;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, var, empty, empty> type_v_63;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_v_64;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_65;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_66;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_67;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_68;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_69;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_70;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_71;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_72;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_73;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_74;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_75;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_76;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_77;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_78;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_79;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_80;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_81;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_82;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_83;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_84;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_85;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_86;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_87;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_88;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_89;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_90;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_91;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_92;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_93;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_94;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_95;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_96;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_97;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_98;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_99;
+
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_0> AgradDistributionSkewDoubleExponential_v_0;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1> AgradDistributionSkewDoubleExponential_v_1;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_2> AgradDistributionSkewDoubleExponential_v_2;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_3> AgradDistributionSkewDoubleExponential_v_3;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_4> AgradDistributionSkewDoubleExponential_v_4;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_5> AgradDistributionSkewDoubleExponential_v_5;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_6> AgradDistributionSkewDoubleExponential_v_6;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_7> AgradDistributionSkewDoubleExponential_v_7;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_8> AgradDistributionSkewDoubleExponential_v_8;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_9> AgradDistributionSkewDoubleExponential_v_9;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_10> AgradDistributionSkewDoubleExponential_v_10;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_11> AgradDistributionSkewDoubleExponential_v_11;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_12> AgradDistributionSkewDoubleExponential_v_12;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_13> AgradDistributionSkewDoubleExponential_v_13;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_14> AgradDistributionSkewDoubleExponential_v_14;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_15> AgradDistributionSkewDoubleExponential_v_15;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_16> AgradDistributionSkewDoubleExponential_v_16;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_17> AgradDistributionSkewDoubleExponential_v_17;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_18> AgradDistributionSkewDoubleExponential_v_18;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_19> AgradDistributionSkewDoubleExponential_v_19;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_20> AgradDistributionSkewDoubleExponential_v_20;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_21> AgradDistributionSkewDoubleExponential_v_21;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_22> AgradDistributionSkewDoubleExponential_v_22;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_23> AgradDistributionSkewDoubleExponential_v_23;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_24> AgradDistributionSkewDoubleExponential_v_24;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_25> AgradDistributionSkewDoubleExponential_v_25;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_26> AgradDistributionSkewDoubleExponential_v_26;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_27> AgradDistributionSkewDoubleExponential_v_27;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_28> AgradDistributionSkewDoubleExponential_v_28;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_29> AgradDistributionSkewDoubleExponential_v_29;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_30> AgradDistributionSkewDoubleExponential_v_30;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_31> AgradDistributionSkewDoubleExponential_v_31;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_32> AgradDistributionSkewDoubleExponential_v_32;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_33> AgradDistributionSkewDoubleExponential_v_33;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_34> AgradDistributionSkewDoubleExponential_v_34;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_35> AgradDistributionSkewDoubleExponential_v_35;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_36> AgradDistributionSkewDoubleExponential_v_36;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_37> AgradDistributionSkewDoubleExponential_v_37;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_38> AgradDistributionSkewDoubleExponential_v_38;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_39> AgradDistributionSkewDoubleExponential_v_39;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_40> AgradDistributionSkewDoubleExponential_v_40;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_41> AgradDistributionSkewDoubleExponential_v_41;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_42> AgradDistributionSkewDoubleExponential_v_42;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_43> AgradDistributionSkewDoubleExponential_v_43;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_44> AgradDistributionSkewDoubleExponential_v_44;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_45> AgradDistributionSkewDoubleExponential_v_45;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_46> AgradDistributionSkewDoubleExponential_v_46;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_47> AgradDistributionSkewDoubleExponential_v_47;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_48> AgradDistributionSkewDoubleExponential_v_48;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_49> AgradDistributionSkewDoubleExponential_v_49;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_50> AgradDistributionSkewDoubleExponential_v_50;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_51> AgradDistributionSkewDoubleExponential_v_51;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_52> AgradDistributionSkewDoubleExponential_v_52;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_53> AgradDistributionSkewDoubleExponential_v_53;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_54> AgradDistributionSkewDoubleExponential_v_54;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_55> AgradDistributionSkewDoubleExponential_v_55;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_56> AgradDistributionSkewDoubleExponential_v_56;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_57> AgradDistributionSkewDoubleExponential_v_57;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_58> AgradDistributionSkewDoubleExponential_v_58;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_59> AgradDistributionSkewDoubleExponential_v_59;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_60> AgradDistributionSkewDoubleExponential_v_60;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_61> AgradDistributionSkewDoubleExponential_v_61;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_62> AgradDistributionSkewDoubleExponential_v_62;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_63> AgradDistributionSkewDoubleExponential_v_63;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_64> AgradDistributionSkewDoubleExponential_v_64;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_65> AgradDistributionSkewDoubleExponential_v_65;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_66> AgradDistributionSkewDoubleExponential_v_66;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_67> AgradDistributionSkewDoubleExponential_v_67;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_68> AgradDistributionSkewDoubleExponential_v_68;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_69> AgradDistributionSkewDoubleExponential_v_69;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_70> AgradDistributionSkewDoubleExponential_v_70;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_71> AgradDistributionSkewDoubleExponential_v_71;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_72> AgradDistributionSkewDoubleExponential_v_72;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_73> AgradDistributionSkewDoubleExponential_v_73;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_74> AgradDistributionSkewDoubleExponential_v_74;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_75> AgradDistributionSkewDoubleExponential_v_75;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_76> AgradDistributionSkewDoubleExponential_v_76;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_77> AgradDistributionSkewDoubleExponential_v_77;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_78> AgradDistributionSkewDoubleExponential_v_78;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_79> AgradDistributionSkewDoubleExponential_v_79;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_80> AgradDistributionSkewDoubleExponential_v_80;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_81> AgradDistributionSkewDoubleExponential_v_81;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_82> AgradDistributionSkewDoubleExponential_v_82;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_83> AgradDistributionSkewDoubleExponential_v_83;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_84> AgradDistributionSkewDoubleExponential_v_84;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_85> AgradDistributionSkewDoubleExponential_v_85;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_86> AgradDistributionSkewDoubleExponential_v_86;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_87> AgradDistributionSkewDoubleExponential_v_87;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_88> AgradDistributionSkewDoubleExponential_v_88;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_89> AgradDistributionSkewDoubleExponential_v_89;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_90> AgradDistributionSkewDoubleExponential_v_90;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_91> AgradDistributionSkewDoubleExponential_v_91;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_92> AgradDistributionSkewDoubleExponential_v_92;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_93> AgradDistributionSkewDoubleExponential_v_93;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_94> AgradDistributionSkewDoubleExponential_v_94;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_95> AgradDistributionSkewDoubleExponential_v_95;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_96> AgradDistributionSkewDoubleExponential_v_96;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_97> AgradDistributionSkewDoubleExponential_v_97;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_98> AgradDistributionSkewDoubleExponential_v_98;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_99> AgradDistributionSkewDoubleExponential_v_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_0, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_2, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_3, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_4, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_5, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_6, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_7, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_8, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_9, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_10, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_11, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_12, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_13, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_14, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_15, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_16, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_17, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_18, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_19, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_20, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_21, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_22, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_23, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_24, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_25, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_26, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_27, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_28, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_29, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_30, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_31, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_32, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_33, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_34, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_35, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_36, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_37, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_38, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_39, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_40, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_41, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_42, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_43, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_44, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_45, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_46, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_47, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_48, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_49, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_50, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_51, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_52, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_53, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_54, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_55, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_56, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_57, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_58, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_59, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_60, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_61, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_62, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_63, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_64, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_65, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_66, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_67, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_68, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_69, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_70, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_71, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_72, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_73, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_74, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_75, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_76, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_77, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_78, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_79, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_80, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_81, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_82, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_83, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_84, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_85, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_86, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_87, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_88, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_89, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_90, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_91, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_92, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_93, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_94, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_95, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_96, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_97, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_98, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_99, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_99);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/skew_double_exponential/skew_double_exponential_test.hpp>
+
+typedef std::tuple<double, double, double, var, empty, empty> type_vv_0;
+typedef std::tuple<double, double, double, std::vector<var>, empty, empty> type_vv_1;
+typedef std::tuple<double, double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_2;
+typedef std::tuple<double, double, std::vector<double>, var, empty, empty> type_vv_3;
+typedef std::tuple<double, double, std::vector<double>, std::vector<var>, empty, empty> type_vv_4;
+typedef std::tuple<double, double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_5;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_6;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_7;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_8;
+typedef std::tuple<double, double, var, double, empty, empty> type_vv_9;
+typedef std::tuple<double, double, var, std::vector<double>, empty, empty> type_vv_10;
+typedef std::tuple<double, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_11;
+typedef std::tuple<double, double, var, var, empty, empty> type_vv_12;
+typedef std::tuple<double, double, var, std::vector<var>, empty, empty> type_vv_13;
+typedef std::tuple<double, double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_14;
+typedef std::tuple<double, double, std::vector<var>, double, empty, empty> type_vv_15;
+typedef std::tuple<double, double, std::vector<var>, std::vector<double>, empty, empty> type_vv_16;
+typedef std::tuple<double, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_17;
+typedef std::tuple<double, double, std::vector<var>, var, empty, empty> type_vv_18;
+typedef std::tuple<double, double, std::vector<var>, std::vector<var>, empty, empty> type_vv_19;
+typedef std::tuple<double, double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_20;
+typedef std::tuple<double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_21;
+typedef std::tuple<double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_22;
+typedef std::tuple<double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_23;
+typedef std::tuple<double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_24;
+typedef std::tuple<double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_25;
+typedef std::tuple<double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_26;
+typedef std::tuple<double, std::vector<double>, double, var, empty, empty> type_vv_27;
+typedef std::tuple<double, std::vector<double>, double, std::vector<var>, empty, empty> type_vv_28;
+typedef std::tuple<double, std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_29;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, var, empty, empty> type_vv_30;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_vv_31;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_32;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_33;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_34;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_35;
+typedef std::tuple<double, std::vector<double>, var, double, empty, empty> type_vv_36;
+typedef std::tuple<double, std::vector<double>, var, std::vector<double>, empty, empty> type_vv_37;
+typedef std::tuple<double, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_38;
+typedef std::tuple<double, std::vector<double>, var, var, empty, empty> type_vv_39;
+typedef std::tuple<double, std::vector<double>, var, std::vector<var>, empty, empty> type_vv_40;
+typedef std::tuple<double, std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_41;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, double, empty, empty> type_vv_42;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_vv_43;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_44;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, var, empty, empty> type_vv_45;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_vv_46;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_47;
+typedef std::tuple<double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_48;
+typedef std::tuple<double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_49;
+typedef std::tuple<double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_50;
+typedef std::tuple<double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_51;
+typedef std::tuple<double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_52;
+typedef std::tuple<double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_53;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_vv_54;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_vv_55;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_56;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_vv_57;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_vv_58;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_59;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_60;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_61;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_62;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_vv_63;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_vv_64;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_65;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_vv_66;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_vv_67;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_68;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_vv_69;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_vv_70;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_71;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_vv_72;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_vv_73;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_74;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_75;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_76;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_77;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_78;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_79;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_80;
+typedef std::tuple<double, var, double, double, empty, empty> type_vv_81;
+typedef std::tuple<double, var, double, std::vector<double>, empty, empty> type_vv_82;
+typedef std::tuple<double, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_83;
+typedef std::tuple<double, var, double, var, empty, empty> type_vv_84;
+typedef std::tuple<double, var, double, std::vector<var>, empty, empty> type_vv_85;
+typedef std::tuple<double, var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_86;
+typedef std::tuple<double, var, std::vector<double>, double, empty, empty> type_vv_87;
+typedef std::tuple<double, var, std::vector<double>, std::vector<double>, empty, empty> type_vv_88;
+typedef std::tuple<double, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_89;
+typedef std::tuple<double, var, std::vector<double>, var, empty, empty> type_vv_90;
+typedef std::tuple<double, var, std::vector<double>, std::vector<var>, empty, empty> type_vv_91;
+typedef std::tuple<double, var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_92;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_93;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_94;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_95;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_96;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_97;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_98;
+typedef std::tuple<double, var, var, double, empty, empty> type_vv_99;
+
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_0> AgradDistributionSkewDoubleExponential_vv_0;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_1> AgradDistributionSkewDoubleExponential_vv_1;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_2> AgradDistributionSkewDoubleExponential_vv_2;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_3> AgradDistributionSkewDoubleExponential_vv_3;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_4> AgradDistributionSkewDoubleExponential_vv_4;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_5> AgradDistributionSkewDoubleExponential_vv_5;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_6> AgradDistributionSkewDoubleExponential_vv_6;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_7> AgradDistributionSkewDoubleExponential_vv_7;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_8> AgradDistributionSkewDoubleExponential_vv_8;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_9> AgradDistributionSkewDoubleExponential_vv_9;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_10> AgradDistributionSkewDoubleExponential_vv_10;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_11> AgradDistributionSkewDoubleExponential_vv_11;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_12> AgradDistributionSkewDoubleExponential_vv_12;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_13> AgradDistributionSkewDoubleExponential_vv_13;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_14> AgradDistributionSkewDoubleExponential_vv_14;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_15> AgradDistributionSkewDoubleExponential_vv_15;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_16> AgradDistributionSkewDoubleExponential_vv_16;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_17> AgradDistributionSkewDoubleExponential_vv_17;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_18> AgradDistributionSkewDoubleExponential_vv_18;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_19> AgradDistributionSkewDoubleExponential_vv_19;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_20> AgradDistributionSkewDoubleExponential_vv_20;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_21> AgradDistributionSkewDoubleExponential_vv_21;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_22> AgradDistributionSkewDoubleExponential_vv_22;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_23> AgradDistributionSkewDoubleExponential_vv_23;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_24> AgradDistributionSkewDoubleExponential_vv_24;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_25> AgradDistributionSkewDoubleExponential_vv_25;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_26> AgradDistributionSkewDoubleExponential_vv_26;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_27> AgradDistributionSkewDoubleExponential_vv_27;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_28> AgradDistributionSkewDoubleExponential_vv_28;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_29> AgradDistributionSkewDoubleExponential_vv_29;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_30> AgradDistributionSkewDoubleExponential_vv_30;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_31> AgradDistributionSkewDoubleExponential_vv_31;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_32> AgradDistributionSkewDoubleExponential_vv_32;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_33> AgradDistributionSkewDoubleExponential_vv_33;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_34> AgradDistributionSkewDoubleExponential_vv_34;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_35> AgradDistributionSkewDoubleExponential_vv_35;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_36> AgradDistributionSkewDoubleExponential_vv_36;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_37> AgradDistributionSkewDoubleExponential_vv_37;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_38> AgradDistributionSkewDoubleExponential_vv_38;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_39> AgradDistributionSkewDoubleExponential_vv_39;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_40> AgradDistributionSkewDoubleExponential_vv_40;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_41> AgradDistributionSkewDoubleExponential_vv_41;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_42> AgradDistributionSkewDoubleExponential_vv_42;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_43> AgradDistributionSkewDoubleExponential_vv_43;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_44> AgradDistributionSkewDoubleExponential_vv_44;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_45> AgradDistributionSkewDoubleExponential_vv_45;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_46> AgradDistributionSkewDoubleExponential_vv_46;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_47> AgradDistributionSkewDoubleExponential_vv_47;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_48> AgradDistributionSkewDoubleExponential_vv_48;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_49> AgradDistributionSkewDoubleExponential_vv_49;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_50> AgradDistributionSkewDoubleExponential_vv_50;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_51> AgradDistributionSkewDoubleExponential_vv_51;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_52> AgradDistributionSkewDoubleExponential_vv_52;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_53> AgradDistributionSkewDoubleExponential_vv_53;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_54> AgradDistributionSkewDoubleExponential_vv_54;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_55> AgradDistributionSkewDoubleExponential_vv_55;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_56> AgradDistributionSkewDoubleExponential_vv_56;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_57> AgradDistributionSkewDoubleExponential_vv_57;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_58> AgradDistributionSkewDoubleExponential_vv_58;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_59> AgradDistributionSkewDoubleExponential_vv_59;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_60> AgradDistributionSkewDoubleExponential_vv_60;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_61> AgradDistributionSkewDoubleExponential_vv_61;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_62> AgradDistributionSkewDoubleExponential_vv_62;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_63> AgradDistributionSkewDoubleExponential_vv_63;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_64> AgradDistributionSkewDoubleExponential_vv_64;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_65> AgradDistributionSkewDoubleExponential_vv_65;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_66> AgradDistributionSkewDoubleExponential_vv_66;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_67> AgradDistributionSkewDoubleExponential_vv_67;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_68> AgradDistributionSkewDoubleExponential_vv_68;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_69> AgradDistributionSkewDoubleExponential_vv_69;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_70> AgradDistributionSkewDoubleExponential_vv_70;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_71> AgradDistributionSkewDoubleExponential_vv_71;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_72> AgradDistributionSkewDoubleExponential_vv_72;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_73> AgradDistributionSkewDoubleExponential_vv_73;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_74> AgradDistributionSkewDoubleExponential_vv_74;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_75> AgradDistributionSkewDoubleExponential_vv_75;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_76> AgradDistributionSkewDoubleExponential_vv_76;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_77> AgradDistributionSkewDoubleExponential_vv_77;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_78> AgradDistributionSkewDoubleExponential_vv_78;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_79> AgradDistributionSkewDoubleExponential_vv_79;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_80> AgradDistributionSkewDoubleExponential_vv_80;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_81> AgradDistributionSkewDoubleExponential_vv_81;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_82> AgradDistributionSkewDoubleExponential_vv_82;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_83> AgradDistributionSkewDoubleExponential_vv_83;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_84> AgradDistributionSkewDoubleExponential_vv_84;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_85> AgradDistributionSkewDoubleExponential_vv_85;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_86> AgradDistributionSkewDoubleExponential_vv_86;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_87> AgradDistributionSkewDoubleExponential_vv_87;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_88> AgradDistributionSkewDoubleExponential_vv_88;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_89> AgradDistributionSkewDoubleExponential_vv_89;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_90> AgradDistributionSkewDoubleExponential_vv_90;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_91> AgradDistributionSkewDoubleExponential_vv_91;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_92> AgradDistributionSkewDoubleExponential_vv_92;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_93> AgradDistributionSkewDoubleExponential_vv_93;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_94> AgradDistributionSkewDoubleExponential_vv_94;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_95> AgradDistributionSkewDoubleExponential_vv_95;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_96> AgradDistributionSkewDoubleExponential_vv_96;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_97> AgradDistributionSkewDoubleExponential_vv_97;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_98> AgradDistributionSkewDoubleExponential_vv_98;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_99> AgradDistributionSkewDoubleExponential_vv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_0, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_1, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_2, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_3, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_4, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_5, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_6, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_7, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_8, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_9, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_10, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_11, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_12, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_13, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_14, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_15, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_16, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_17, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_18, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_19, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_20, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_21, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_22, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_23, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_24, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_25, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_26, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_27, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_28, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_29, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_30, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_31, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_32, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_33, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_34, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_35, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_36, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_37, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_38, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_39, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_40, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_41, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_42, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_43, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_44, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_45, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_46, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_47, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_48, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_49, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_50, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_51, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_52, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_53, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_54, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_55, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_56, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_57, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_58, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_59, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_60, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_61, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_62, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_63, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_64, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_65, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_66, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_67, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_68, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_69, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_70, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_71, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_72, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_73, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_74, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_75, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_76, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_77, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_78, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_79, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_80, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_81, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_82, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_83, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_84, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_85, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_86, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_87, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_88, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_89, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_90, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_91, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_92, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_93, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_94, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_95, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_96, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_97, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_98, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_99, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_99);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/skew_double_exponential/skew_double_exponential_test.hpp>
+
+typedef std::tuple<double, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_100;
+typedef std::tuple<double, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_101;
+typedef std::tuple<double, fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_102;
+typedef std::tuple<double, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_103;
+typedef std::tuple<double, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_104;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_105;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_106;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_107;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_108;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_109;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_110;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_111;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_112;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_113;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_114;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_115;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_116;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, double, double, empty, empty> type_ffv_117;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty, empty> type_ffv_118;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_119;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty, empty> type_ffv_120;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_121;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_122;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty, empty> type_ffv_123;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_124;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_125;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_126;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_127;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_128;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_129;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_130;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_131;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_132;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_133;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_134;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty, empty> type_ffv_135;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_136;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_137;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_138;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_139;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_140;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_141;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_142;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_143;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_144;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_145;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_146;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_147;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_148;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_149;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_150;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_151;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_152;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty, empty> type_ffv_153;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_ffv_154;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_155;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_156;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_157;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_158;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_ffv_159;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_160;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_161;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_162;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_163;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_164;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_165;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_166;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_167;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_168;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_169;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_170;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_171;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_172;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_173;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_174;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_175;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_176;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_177;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_178;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_179;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_180;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_181;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_182;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_183;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_184;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_185;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_186;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_187;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_188;
+typedef std::tuple<std::vector<double>, double, double, fvar<fvar<var> >, empty, empty> type_ffv_189;
+typedef std::tuple<std::vector<double>, double, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_190;
+typedef std::tuple<std::vector<double>, double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_191;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_192;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_193;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_194;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_195;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_196;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_197;
+typedef std::tuple<std::vector<double>, double, fvar<fvar<var> >, double, empty, empty> type_ffv_198;
+typedef std::tuple<std::vector<double>, double, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_199;
+
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_100> AgradDistributionSkewDoubleExponential_ffv_100;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_101> AgradDistributionSkewDoubleExponential_ffv_101;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_102> AgradDistributionSkewDoubleExponential_ffv_102;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_103> AgradDistributionSkewDoubleExponential_ffv_103;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_104> AgradDistributionSkewDoubleExponential_ffv_104;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_105> AgradDistributionSkewDoubleExponential_ffv_105;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_106> AgradDistributionSkewDoubleExponential_ffv_106;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_107> AgradDistributionSkewDoubleExponential_ffv_107;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_108> AgradDistributionSkewDoubleExponential_ffv_108;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_109> AgradDistributionSkewDoubleExponential_ffv_109;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_110> AgradDistributionSkewDoubleExponential_ffv_110;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_111> AgradDistributionSkewDoubleExponential_ffv_111;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_112> AgradDistributionSkewDoubleExponential_ffv_112;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_113> AgradDistributionSkewDoubleExponential_ffv_113;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_114> AgradDistributionSkewDoubleExponential_ffv_114;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_115> AgradDistributionSkewDoubleExponential_ffv_115;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_116> AgradDistributionSkewDoubleExponential_ffv_116;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_117> AgradDistributionSkewDoubleExponential_ffv_117;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_118> AgradDistributionSkewDoubleExponential_ffv_118;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_119> AgradDistributionSkewDoubleExponential_ffv_119;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_120> AgradDistributionSkewDoubleExponential_ffv_120;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_121> AgradDistributionSkewDoubleExponential_ffv_121;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_122> AgradDistributionSkewDoubleExponential_ffv_122;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_123> AgradDistributionSkewDoubleExponential_ffv_123;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_124> AgradDistributionSkewDoubleExponential_ffv_124;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_125> AgradDistributionSkewDoubleExponential_ffv_125;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_126> AgradDistributionSkewDoubleExponential_ffv_126;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_127> AgradDistributionSkewDoubleExponential_ffv_127;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_128> AgradDistributionSkewDoubleExponential_ffv_128;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_129> AgradDistributionSkewDoubleExponential_ffv_129;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_130> AgradDistributionSkewDoubleExponential_ffv_130;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_131> AgradDistributionSkewDoubleExponential_ffv_131;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_132> AgradDistributionSkewDoubleExponential_ffv_132;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_133> AgradDistributionSkewDoubleExponential_ffv_133;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_134> AgradDistributionSkewDoubleExponential_ffv_134;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_135> AgradDistributionSkewDoubleExponential_ffv_135;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_136> AgradDistributionSkewDoubleExponential_ffv_136;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_137> AgradDistributionSkewDoubleExponential_ffv_137;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_138> AgradDistributionSkewDoubleExponential_ffv_138;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_139> AgradDistributionSkewDoubleExponential_ffv_139;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_140> AgradDistributionSkewDoubleExponential_ffv_140;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_141> AgradDistributionSkewDoubleExponential_ffv_141;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_142> AgradDistributionSkewDoubleExponential_ffv_142;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_143> AgradDistributionSkewDoubleExponential_ffv_143;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_144> AgradDistributionSkewDoubleExponential_ffv_144;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_145> AgradDistributionSkewDoubleExponential_ffv_145;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_146> AgradDistributionSkewDoubleExponential_ffv_146;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_147> AgradDistributionSkewDoubleExponential_ffv_147;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_148> AgradDistributionSkewDoubleExponential_ffv_148;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_149> AgradDistributionSkewDoubleExponential_ffv_149;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_150> AgradDistributionSkewDoubleExponential_ffv_150;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_151> AgradDistributionSkewDoubleExponential_ffv_151;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_152> AgradDistributionSkewDoubleExponential_ffv_152;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_153> AgradDistributionSkewDoubleExponential_ffv_153;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_154> AgradDistributionSkewDoubleExponential_ffv_154;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_155> AgradDistributionSkewDoubleExponential_ffv_155;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_156> AgradDistributionSkewDoubleExponential_ffv_156;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_157> AgradDistributionSkewDoubleExponential_ffv_157;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_158> AgradDistributionSkewDoubleExponential_ffv_158;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_159> AgradDistributionSkewDoubleExponential_ffv_159;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_160> AgradDistributionSkewDoubleExponential_ffv_160;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_161> AgradDistributionSkewDoubleExponential_ffv_161;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_162> AgradDistributionSkewDoubleExponential_ffv_162;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_163> AgradDistributionSkewDoubleExponential_ffv_163;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_164> AgradDistributionSkewDoubleExponential_ffv_164;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_165> AgradDistributionSkewDoubleExponential_ffv_165;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_166> AgradDistributionSkewDoubleExponential_ffv_166;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_167> AgradDistributionSkewDoubleExponential_ffv_167;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_168> AgradDistributionSkewDoubleExponential_ffv_168;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_169> AgradDistributionSkewDoubleExponential_ffv_169;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_170> AgradDistributionSkewDoubleExponential_ffv_170;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_171> AgradDistributionSkewDoubleExponential_ffv_171;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_172> AgradDistributionSkewDoubleExponential_ffv_172;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_173> AgradDistributionSkewDoubleExponential_ffv_173;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_174> AgradDistributionSkewDoubleExponential_ffv_174;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_175> AgradDistributionSkewDoubleExponential_ffv_175;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_176> AgradDistributionSkewDoubleExponential_ffv_176;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_177> AgradDistributionSkewDoubleExponential_ffv_177;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_178> AgradDistributionSkewDoubleExponential_ffv_178;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_179> AgradDistributionSkewDoubleExponential_ffv_179;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_180> AgradDistributionSkewDoubleExponential_ffv_180;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_181> AgradDistributionSkewDoubleExponential_ffv_181;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_182> AgradDistributionSkewDoubleExponential_ffv_182;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_183> AgradDistributionSkewDoubleExponential_ffv_183;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_184> AgradDistributionSkewDoubleExponential_ffv_184;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_185> AgradDistributionSkewDoubleExponential_ffv_185;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_186> AgradDistributionSkewDoubleExponential_ffv_186;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_187> AgradDistributionSkewDoubleExponential_ffv_187;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_188> AgradDistributionSkewDoubleExponential_ffv_188;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_189> AgradDistributionSkewDoubleExponential_ffv_189;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_190> AgradDistributionSkewDoubleExponential_ffv_190;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_191> AgradDistributionSkewDoubleExponential_ffv_191;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_192> AgradDistributionSkewDoubleExponential_ffv_192;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_193> AgradDistributionSkewDoubleExponential_ffv_193;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_194> AgradDistributionSkewDoubleExponential_ffv_194;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_195> AgradDistributionSkewDoubleExponential_ffv_195;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_196> AgradDistributionSkewDoubleExponential_ffv_196;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_197> AgradDistributionSkewDoubleExponential_ffv_197;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_198> AgradDistributionSkewDoubleExponential_ffv_198;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_199> AgradDistributionSkewDoubleExponential_ffv_199;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_100, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_101, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_102, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_103, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_104, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_105, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_106, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_107, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_108, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_109, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_110, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_111, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_112, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_113, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_114, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_115, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_116, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_117, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_118, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_119, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_120, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_121, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_122, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_123, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_124, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_125, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_126, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_127, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_128, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_129, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_130, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_131, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_132, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_133, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_134, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_135, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_136, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_137, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_138, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_139, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_140, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_141, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_142, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_143, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_144, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_145, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_146, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_147, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_148, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_149, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_150, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_151, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_152, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_153, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_154, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_155, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_156, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_157, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_158, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_159, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_160, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_161, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_162, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_163, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_164, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_165, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_166, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_167, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_168, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_169, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_170, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_171, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_172, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_173, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_174, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_175, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_176, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_177, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_178, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_179, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_180, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_181, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_182, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_183, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_184, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_185, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_186, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_187, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_188, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_188);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_189, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_189);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_190, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_190);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_191, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_191);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_192, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_192);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_193, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_193);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_194, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_194);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_195, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_195);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_196, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_196);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_197, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_197);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_198, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_198);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_199, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_199);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/skew_double_exponential/skew_double_exponential_test.hpp>
+
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_100;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_101;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_102;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_103;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_104;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_105;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_106;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_107;
+typedef std::tuple<double, var, double, double, empty, empty> type_v_108;
+typedef std::tuple<double, var, double, std::vector<double>, empty, empty> type_v_109;
+typedef std::tuple<double, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_110;
+typedef std::tuple<double, var, double, var, empty, empty> type_v_111;
+typedef std::tuple<double, var, double, std::vector<var>, empty, empty> type_v_112;
+typedef std::tuple<double, var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_113;
+typedef std::tuple<double, var, std::vector<double>, double, empty, empty> type_v_114;
+typedef std::tuple<double, var, std::vector<double>, std::vector<double>, empty, empty> type_v_115;
+typedef std::tuple<double, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_116;
+typedef std::tuple<double, var, std::vector<double>, var, empty, empty> type_v_117;
+typedef std::tuple<double, var, std::vector<double>, std::vector<var>, empty, empty> type_v_118;
+typedef std::tuple<double, var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_119;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_120;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_121;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_122;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_123;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_124;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_125;
+typedef std::tuple<double, var, var, double, empty, empty> type_v_126;
+typedef std::tuple<double, var, var, std::vector<double>, empty, empty> type_v_127;
+typedef std::tuple<double, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_128;
+typedef std::tuple<double, var, var, var, empty, empty> type_v_129;
+typedef std::tuple<double, var, var, std::vector<var>, empty, empty> type_v_130;
+typedef std::tuple<double, var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_131;
+typedef std::tuple<double, var, std::vector<var>, double, empty, empty> type_v_132;
+typedef std::tuple<double, var, std::vector<var>, std::vector<double>, empty, empty> type_v_133;
+typedef std::tuple<double, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_134;
+typedef std::tuple<double, var, std::vector<var>, var, empty, empty> type_v_135;
+typedef std::tuple<double, var, std::vector<var>, std::vector<var>, empty, empty> type_v_136;
+typedef std::tuple<double, var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_137;
+typedef std::tuple<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_138;
+typedef std::tuple<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_139;
+typedef std::tuple<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_140;
+typedef std::tuple<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_141;
+typedef std::tuple<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_142;
+typedef std::tuple<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_143;
+typedef std::tuple<double, std::vector<var>, double, double, empty, empty> type_v_144;
+typedef std::tuple<double, std::vector<var>, double, std::vector<double>, empty, empty> type_v_145;
+typedef std::tuple<double, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_146;
+typedef std::tuple<double, std::vector<var>, double, var, empty, empty> type_v_147;
+typedef std::tuple<double, std::vector<var>, double, std::vector<var>, empty, empty> type_v_148;
+typedef std::tuple<double, std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_149;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, double, empty, empty> type_v_150;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_v_151;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_152;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, var, empty, empty> type_v_153;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_v_154;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_155;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_156;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_157;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_158;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_159;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_160;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_161;
+typedef std::tuple<double, std::vector<var>, var, double, empty, empty> type_v_162;
+typedef std::tuple<double, std::vector<var>, var, std::vector<double>, empty, empty> type_v_163;
+typedef std::tuple<double, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_164;
+typedef std::tuple<double, std::vector<var>, var, var, empty, empty> type_v_165;
+typedef std::tuple<double, std::vector<var>, var, std::vector<var>, empty, empty> type_v_166;
+typedef std::tuple<double, std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_167;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, double, empty, empty> type_v_168;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_v_169;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_170;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, var, empty, empty> type_v_171;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_v_172;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_173;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_174;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_175;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_176;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_177;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_178;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_179;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_180;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_181;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_182;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_183;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_184;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_185;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_186;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_187;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_188;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_189;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_190;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_191;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_192;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_193;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_194;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_195;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_196;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_197;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_198;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_199;
+
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_100> AgradDistributionSkewDoubleExponential_v_100;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_101> AgradDistributionSkewDoubleExponential_v_101;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_102> AgradDistributionSkewDoubleExponential_v_102;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_103> AgradDistributionSkewDoubleExponential_v_103;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_104> AgradDistributionSkewDoubleExponential_v_104;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_105> AgradDistributionSkewDoubleExponential_v_105;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_106> AgradDistributionSkewDoubleExponential_v_106;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_107> AgradDistributionSkewDoubleExponential_v_107;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_108> AgradDistributionSkewDoubleExponential_v_108;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_109> AgradDistributionSkewDoubleExponential_v_109;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_110> AgradDistributionSkewDoubleExponential_v_110;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_111> AgradDistributionSkewDoubleExponential_v_111;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_112> AgradDistributionSkewDoubleExponential_v_112;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_113> AgradDistributionSkewDoubleExponential_v_113;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_114> AgradDistributionSkewDoubleExponential_v_114;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_115> AgradDistributionSkewDoubleExponential_v_115;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_116> AgradDistributionSkewDoubleExponential_v_116;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_117> AgradDistributionSkewDoubleExponential_v_117;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_118> AgradDistributionSkewDoubleExponential_v_118;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_119> AgradDistributionSkewDoubleExponential_v_119;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_120> AgradDistributionSkewDoubleExponential_v_120;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_121> AgradDistributionSkewDoubleExponential_v_121;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_122> AgradDistributionSkewDoubleExponential_v_122;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_123> AgradDistributionSkewDoubleExponential_v_123;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_124> AgradDistributionSkewDoubleExponential_v_124;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_125> AgradDistributionSkewDoubleExponential_v_125;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_126> AgradDistributionSkewDoubleExponential_v_126;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_127> AgradDistributionSkewDoubleExponential_v_127;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_128> AgradDistributionSkewDoubleExponential_v_128;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_129> AgradDistributionSkewDoubleExponential_v_129;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_130> AgradDistributionSkewDoubleExponential_v_130;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_131> AgradDistributionSkewDoubleExponential_v_131;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_132> AgradDistributionSkewDoubleExponential_v_132;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_133> AgradDistributionSkewDoubleExponential_v_133;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_134> AgradDistributionSkewDoubleExponential_v_134;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_135> AgradDistributionSkewDoubleExponential_v_135;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_136> AgradDistributionSkewDoubleExponential_v_136;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_137> AgradDistributionSkewDoubleExponential_v_137;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_138> AgradDistributionSkewDoubleExponential_v_138;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_139> AgradDistributionSkewDoubleExponential_v_139;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_140> AgradDistributionSkewDoubleExponential_v_140;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_141> AgradDistributionSkewDoubleExponential_v_141;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_142> AgradDistributionSkewDoubleExponential_v_142;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_143> AgradDistributionSkewDoubleExponential_v_143;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_144> AgradDistributionSkewDoubleExponential_v_144;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_145> AgradDistributionSkewDoubleExponential_v_145;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_146> AgradDistributionSkewDoubleExponential_v_146;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_147> AgradDistributionSkewDoubleExponential_v_147;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_148> AgradDistributionSkewDoubleExponential_v_148;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_149> AgradDistributionSkewDoubleExponential_v_149;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_150> AgradDistributionSkewDoubleExponential_v_150;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_151> AgradDistributionSkewDoubleExponential_v_151;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_152> AgradDistributionSkewDoubleExponential_v_152;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_153> AgradDistributionSkewDoubleExponential_v_153;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_154> AgradDistributionSkewDoubleExponential_v_154;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_155> AgradDistributionSkewDoubleExponential_v_155;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_156> AgradDistributionSkewDoubleExponential_v_156;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_157> AgradDistributionSkewDoubleExponential_v_157;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_158> AgradDistributionSkewDoubleExponential_v_158;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_159> AgradDistributionSkewDoubleExponential_v_159;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_160> AgradDistributionSkewDoubleExponential_v_160;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_161> AgradDistributionSkewDoubleExponential_v_161;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_162> AgradDistributionSkewDoubleExponential_v_162;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_163> AgradDistributionSkewDoubleExponential_v_163;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_164> AgradDistributionSkewDoubleExponential_v_164;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_165> AgradDistributionSkewDoubleExponential_v_165;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_166> AgradDistributionSkewDoubleExponential_v_166;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_167> AgradDistributionSkewDoubleExponential_v_167;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_168> AgradDistributionSkewDoubleExponential_v_168;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_169> AgradDistributionSkewDoubleExponential_v_169;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_170> AgradDistributionSkewDoubleExponential_v_170;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_171> AgradDistributionSkewDoubleExponential_v_171;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_172> AgradDistributionSkewDoubleExponential_v_172;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_173> AgradDistributionSkewDoubleExponential_v_173;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_174> AgradDistributionSkewDoubleExponential_v_174;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_175> AgradDistributionSkewDoubleExponential_v_175;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_176> AgradDistributionSkewDoubleExponential_v_176;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_177> AgradDistributionSkewDoubleExponential_v_177;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_178> AgradDistributionSkewDoubleExponential_v_178;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_179> AgradDistributionSkewDoubleExponential_v_179;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_180> AgradDistributionSkewDoubleExponential_v_180;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_181> AgradDistributionSkewDoubleExponential_v_181;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_182> AgradDistributionSkewDoubleExponential_v_182;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_183> AgradDistributionSkewDoubleExponential_v_183;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_184> AgradDistributionSkewDoubleExponential_v_184;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_185> AgradDistributionSkewDoubleExponential_v_185;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_186> AgradDistributionSkewDoubleExponential_v_186;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_187> AgradDistributionSkewDoubleExponential_v_187;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_188> AgradDistributionSkewDoubleExponential_v_188;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_189> AgradDistributionSkewDoubleExponential_v_189;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_190> AgradDistributionSkewDoubleExponential_v_190;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_191> AgradDistributionSkewDoubleExponential_v_191;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_192> AgradDistributionSkewDoubleExponential_v_192;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_193> AgradDistributionSkewDoubleExponential_v_193;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_194> AgradDistributionSkewDoubleExponential_v_194;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_195> AgradDistributionSkewDoubleExponential_v_195;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_196> AgradDistributionSkewDoubleExponential_v_196;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_197> AgradDistributionSkewDoubleExponential_v_197;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_198> AgradDistributionSkewDoubleExponential_v_198;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_199> AgradDistributionSkewDoubleExponential_v_199;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_100, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_101, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_102, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_103, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_104, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_105, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_106, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_107, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_108, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_109, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_110, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_111, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_112, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_113, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_114, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_115, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_116, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_117, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_118, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_119, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_120, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_121, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_122, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_123, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_124, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_125, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_126, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_127, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_128, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_129, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_130, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_131, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_132, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_133, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_134, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_135, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_136, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_137, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_138, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_139, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_140, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_141, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_142, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_143, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_144, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_145, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_146, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_147, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_148, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_149, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_150, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_151, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_152, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_153, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_154, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_155, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_156, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_157, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_158, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_159, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_160, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_161, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_162, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_163, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_164, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_165, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_166, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_167, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_168, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_169, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_170, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_171, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_172, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_173, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_174, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_175, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_176, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_177, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_178, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_179, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_180, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_181, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_182, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_183, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_184, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_185, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_186, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_187, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_188, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_188);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_189, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_189);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_190, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_190);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_191, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_191);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_192, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_192);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_193, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_193);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_194, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_194);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_195, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_195);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_196, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_196);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_197, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_197);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_198, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_198);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_199, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_199);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/skew_double_exponential/skew_double_exponential_test.hpp>
+
+typedef std::tuple<double, var, var, std::vector<double>, empty, empty> type_vv_100;
+typedef std::tuple<double, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_101;
+typedef std::tuple<double, var, var, var, empty, empty> type_vv_102;
+typedef std::tuple<double, var, var, std::vector<var>, empty, empty> type_vv_103;
+typedef std::tuple<double, var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_104;
+typedef std::tuple<double, var, std::vector<var>, double, empty, empty> type_vv_105;
+typedef std::tuple<double, var, std::vector<var>, std::vector<double>, empty, empty> type_vv_106;
+typedef std::tuple<double, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_107;
+typedef std::tuple<double, var, std::vector<var>, var, empty, empty> type_vv_108;
+typedef std::tuple<double, var, std::vector<var>, std::vector<var>, empty, empty> type_vv_109;
+typedef std::tuple<double, var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_110;
+typedef std::tuple<double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_111;
+typedef std::tuple<double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_112;
+typedef std::tuple<double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_113;
+typedef std::tuple<double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_114;
+typedef std::tuple<double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_115;
+typedef std::tuple<double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_116;
+typedef std::tuple<double, std::vector<var>, double, double, empty, empty> type_vv_117;
+typedef std::tuple<double, std::vector<var>, double, std::vector<double>, empty, empty> type_vv_118;
+typedef std::tuple<double, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_119;
+typedef std::tuple<double, std::vector<var>, double, var, empty, empty> type_vv_120;
+typedef std::tuple<double, std::vector<var>, double, std::vector<var>, empty, empty> type_vv_121;
+typedef std::tuple<double, std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_122;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, double, empty, empty> type_vv_123;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_vv_124;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_125;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, var, empty, empty> type_vv_126;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_vv_127;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_128;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_129;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_130;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_131;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_132;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_133;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_134;
+typedef std::tuple<double, std::vector<var>, var, double, empty, empty> type_vv_135;
+typedef std::tuple<double, std::vector<var>, var, std::vector<double>, empty, empty> type_vv_136;
+typedef std::tuple<double, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_137;
+typedef std::tuple<double, std::vector<var>, var, var, empty, empty> type_vv_138;
+typedef std::tuple<double, std::vector<var>, var, std::vector<var>, empty, empty> type_vv_139;
+typedef std::tuple<double, std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_140;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, double, empty, empty> type_vv_141;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_vv_142;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_143;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, var, empty, empty> type_vv_144;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_vv_145;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_146;
+typedef std::tuple<double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_147;
+typedef std::tuple<double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_148;
+typedef std::tuple<double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_149;
+typedef std::tuple<double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_150;
+typedef std::tuple<double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_151;
+typedef std::tuple<double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_152;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, empty, empty> type_vv_153;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, empty, empty> type_vv_154;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_155;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, empty, empty> type_vv_156;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, empty, empty> type_vv_157;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_158;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, empty, empty> type_vv_159;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, empty, empty> type_vv_160;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_161;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, empty, empty> type_vv_162;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, empty, empty> type_vv_163;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_164;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_165;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_166;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_167;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_168;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_169;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_170;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, empty, empty> type_vv_171;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, empty, empty> type_vv_172;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_173;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, empty, empty> type_vv_174;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, empty, empty> type_vv_175;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_176;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, empty, empty> type_vv_177;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, empty, empty> type_vv_178;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_179;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, empty, empty> type_vv_180;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, empty, empty> type_vv_181;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_182;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_183;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_184;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_185;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_186;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_187;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_188;
+typedef std::tuple<std::vector<double>, double, double, var, empty, empty> type_vv_189;
+typedef std::tuple<std::vector<double>, double, double, std::vector<var>, empty, empty> type_vv_190;
+typedef std::tuple<std::vector<double>, double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_191;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, var, empty, empty> type_vv_192;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, std::vector<var>, empty, empty> type_vv_193;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_194;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_195;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_196;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_197;
+typedef std::tuple<std::vector<double>, double, var, double, empty, empty> type_vv_198;
+typedef std::tuple<std::vector<double>, double, var, std::vector<double>, empty, empty> type_vv_199;
+
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_100> AgradDistributionSkewDoubleExponential_vv_100;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_101> AgradDistributionSkewDoubleExponential_vv_101;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_102> AgradDistributionSkewDoubleExponential_vv_102;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_103> AgradDistributionSkewDoubleExponential_vv_103;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_104> AgradDistributionSkewDoubleExponential_vv_104;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_105> AgradDistributionSkewDoubleExponential_vv_105;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_106> AgradDistributionSkewDoubleExponential_vv_106;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_107> AgradDistributionSkewDoubleExponential_vv_107;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_108> AgradDistributionSkewDoubleExponential_vv_108;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_109> AgradDistributionSkewDoubleExponential_vv_109;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_110> AgradDistributionSkewDoubleExponential_vv_110;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_111> AgradDistributionSkewDoubleExponential_vv_111;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_112> AgradDistributionSkewDoubleExponential_vv_112;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_113> AgradDistributionSkewDoubleExponential_vv_113;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_114> AgradDistributionSkewDoubleExponential_vv_114;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_115> AgradDistributionSkewDoubleExponential_vv_115;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_116> AgradDistributionSkewDoubleExponential_vv_116;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_117> AgradDistributionSkewDoubleExponential_vv_117;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_118> AgradDistributionSkewDoubleExponential_vv_118;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_119> AgradDistributionSkewDoubleExponential_vv_119;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_120> AgradDistributionSkewDoubleExponential_vv_120;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_121> AgradDistributionSkewDoubleExponential_vv_121;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_122> AgradDistributionSkewDoubleExponential_vv_122;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_123> AgradDistributionSkewDoubleExponential_vv_123;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_124> AgradDistributionSkewDoubleExponential_vv_124;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_125> AgradDistributionSkewDoubleExponential_vv_125;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_126> AgradDistributionSkewDoubleExponential_vv_126;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_127> AgradDistributionSkewDoubleExponential_vv_127;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_128> AgradDistributionSkewDoubleExponential_vv_128;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_129> AgradDistributionSkewDoubleExponential_vv_129;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_130> AgradDistributionSkewDoubleExponential_vv_130;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_131> AgradDistributionSkewDoubleExponential_vv_131;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_132> AgradDistributionSkewDoubleExponential_vv_132;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_133> AgradDistributionSkewDoubleExponential_vv_133;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_134> AgradDistributionSkewDoubleExponential_vv_134;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_135> AgradDistributionSkewDoubleExponential_vv_135;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_136> AgradDistributionSkewDoubleExponential_vv_136;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_137> AgradDistributionSkewDoubleExponential_vv_137;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_138> AgradDistributionSkewDoubleExponential_vv_138;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_139> AgradDistributionSkewDoubleExponential_vv_139;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_140> AgradDistributionSkewDoubleExponential_vv_140;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_141> AgradDistributionSkewDoubleExponential_vv_141;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_142> AgradDistributionSkewDoubleExponential_vv_142;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_143> AgradDistributionSkewDoubleExponential_vv_143;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_144> AgradDistributionSkewDoubleExponential_vv_144;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_145> AgradDistributionSkewDoubleExponential_vv_145;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_146> AgradDistributionSkewDoubleExponential_vv_146;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_147> AgradDistributionSkewDoubleExponential_vv_147;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_148> AgradDistributionSkewDoubleExponential_vv_148;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_149> AgradDistributionSkewDoubleExponential_vv_149;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_150> AgradDistributionSkewDoubleExponential_vv_150;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_151> AgradDistributionSkewDoubleExponential_vv_151;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_152> AgradDistributionSkewDoubleExponential_vv_152;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_153> AgradDistributionSkewDoubleExponential_vv_153;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_154> AgradDistributionSkewDoubleExponential_vv_154;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_155> AgradDistributionSkewDoubleExponential_vv_155;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_156> AgradDistributionSkewDoubleExponential_vv_156;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_157> AgradDistributionSkewDoubleExponential_vv_157;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_158> AgradDistributionSkewDoubleExponential_vv_158;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_159> AgradDistributionSkewDoubleExponential_vv_159;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_160> AgradDistributionSkewDoubleExponential_vv_160;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_161> AgradDistributionSkewDoubleExponential_vv_161;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_162> AgradDistributionSkewDoubleExponential_vv_162;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_163> AgradDistributionSkewDoubleExponential_vv_163;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_164> AgradDistributionSkewDoubleExponential_vv_164;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_165> AgradDistributionSkewDoubleExponential_vv_165;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_166> AgradDistributionSkewDoubleExponential_vv_166;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_167> AgradDistributionSkewDoubleExponential_vv_167;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_168> AgradDistributionSkewDoubleExponential_vv_168;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_169> AgradDistributionSkewDoubleExponential_vv_169;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_170> AgradDistributionSkewDoubleExponential_vv_170;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_171> AgradDistributionSkewDoubleExponential_vv_171;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_172> AgradDistributionSkewDoubleExponential_vv_172;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_173> AgradDistributionSkewDoubleExponential_vv_173;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_174> AgradDistributionSkewDoubleExponential_vv_174;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_175> AgradDistributionSkewDoubleExponential_vv_175;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_176> AgradDistributionSkewDoubleExponential_vv_176;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_177> AgradDistributionSkewDoubleExponential_vv_177;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_178> AgradDistributionSkewDoubleExponential_vv_178;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_179> AgradDistributionSkewDoubleExponential_vv_179;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_180> AgradDistributionSkewDoubleExponential_vv_180;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_181> AgradDistributionSkewDoubleExponential_vv_181;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_182> AgradDistributionSkewDoubleExponential_vv_182;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_183> AgradDistributionSkewDoubleExponential_vv_183;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_184> AgradDistributionSkewDoubleExponential_vv_184;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_185> AgradDistributionSkewDoubleExponential_vv_185;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_186> AgradDistributionSkewDoubleExponential_vv_186;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_187> AgradDistributionSkewDoubleExponential_vv_187;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_188> AgradDistributionSkewDoubleExponential_vv_188;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_189> AgradDistributionSkewDoubleExponential_vv_189;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_190> AgradDistributionSkewDoubleExponential_vv_190;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_191> AgradDistributionSkewDoubleExponential_vv_191;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_192> AgradDistributionSkewDoubleExponential_vv_192;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_193> AgradDistributionSkewDoubleExponential_vv_193;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_194> AgradDistributionSkewDoubleExponential_vv_194;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_195> AgradDistributionSkewDoubleExponential_vv_195;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_196> AgradDistributionSkewDoubleExponential_vv_196;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_197> AgradDistributionSkewDoubleExponential_vv_197;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_198> AgradDistributionSkewDoubleExponential_vv_198;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_199> AgradDistributionSkewDoubleExponential_vv_199;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_100, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_101, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_102, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_103, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_104, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_105, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_106, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_107, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_108, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_109, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_110, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_111, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_112, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_113, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_114, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_115, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_116, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_117, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_118, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_119, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_120, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_121, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_122, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_123, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_124, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_125, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_126, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_127, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_128, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_129, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_130, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_131, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_132, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_133, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_134, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_135, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_136, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_137, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_138, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_139, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_140, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_141, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_142, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_143, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_144, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_145, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_146, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_147, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_148, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_149, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_150, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_151, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_152, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_153, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_154, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_155, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_156, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_157, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_158, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_159, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_160, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_161, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_162, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_163, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_164, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_165, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_166, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_167, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_168, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_169, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_170, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_171, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_172, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_173, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_174, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_175, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_176, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_177, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_178, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_179, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_180, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_181, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_182, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_183, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_184, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_185, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_186, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_187, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_188, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_188);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_189, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_189);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_190, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_190);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_191, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_191);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_192, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_192);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_193, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_193);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_194, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_194);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_195, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_195);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_196, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_196);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_197, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_197);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_198, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_198);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_199, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_199);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/skew_double_exponential/skew_double_exponential_test.hpp>
+
+typedef std::tuple<std::vector<double>, double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_200;
+typedef std::tuple<std::vector<double>, double, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_201;
+typedef std::tuple<std::vector<double>, double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_202;
+typedef std::tuple<std::vector<double>, double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_203;
+typedef std::tuple<std::vector<double>, double, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_204;
+typedef std::tuple<std::vector<double>, double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_205;
+typedef std::tuple<std::vector<double>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_206;
+typedef std::tuple<std::vector<double>, double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_207;
+typedef std::tuple<std::vector<double>, double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_208;
+typedef std::tuple<std::vector<double>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_209;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_210;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_211;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_212;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_213;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_214;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_215;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, fvar<fvar<var> >, empty, empty> type_ffv_216;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_217;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_218;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_219;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_220;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_221;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_222;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_223;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_224;
+typedef std::tuple<std::vector<double>, std::vector<double>, fvar<fvar<var> >, double, empty, empty> type_ffv_225;
+typedef std::tuple<std::vector<double>, std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_226;
+typedef std::tuple<std::vector<double>, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_227;
+typedef std::tuple<std::vector<double>, std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_228;
+typedef std::tuple<std::vector<double>, std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_229;
+typedef std::tuple<std::vector<double>, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_230;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_231;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_232;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_233;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_234;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_235;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_236;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_237;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_238;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_239;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_240;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_241;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_242;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_243;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_244;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_245;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_246;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_247;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_248;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_249;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_250;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_251;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_252;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_253;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_254;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_255;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_256;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_257;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_258;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_259;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_260;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_261;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_262;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_263;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_264;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_265;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_266;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_267;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_268;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_269;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, double, double, empty, empty> type_ffv_270;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, double, std::vector<double>, empty, empty> type_ffv_271;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_272;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, double, fvar<fvar<var> >, empty, empty> type_ffv_273;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_274;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_275;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<double>, double, empty, empty> type_ffv_276;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty, empty> type_ffv_277;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_278;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_279;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_280;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_281;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_282;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_283;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_284;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_285;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_286;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_287;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, double, empty, empty> type_ffv_288;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_289;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_290;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_291;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_292;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_293;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_294;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_295;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_296;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_297;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_298;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_299;
+
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_200> AgradDistributionSkewDoubleExponential_ffv_200;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_201> AgradDistributionSkewDoubleExponential_ffv_201;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_202> AgradDistributionSkewDoubleExponential_ffv_202;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_203> AgradDistributionSkewDoubleExponential_ffv_203;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_204> AgradDistributionSkewDoubleExponential_ffv_204;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_205> AgradDistributionSkewDoubleExponential_ffv_205;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_206> AgradDistributionSkewDoubleExponential_ffv_206;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_207> AgradDistributionSkewDoubleExponential_ffv_207;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_208> AgradDistributionSkewDoubleExponential_ffv_208;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_209> AgradDistributionSkewDoubleExponential_ffv_209;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_210> AgradDistributionSkewDoubleExponential_ffv_210;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_211> AgradDistributionSkewDoubleExponential_ffv_211;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_212> AgradDistributionSkewDoubleExponential_ffv_212;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_213> AgradDistributionSkewDoubleExponential_ffv_213;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_214> AgradDistributionSkewDoubleExponential_ffv_214;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_215> AgradDistributionSkewDoubleExponential_ffv_215;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_216> AgradDistributionSkewDoubleExponential_ffv_216;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_217> AgradDistributionSkewDoubleExponential_ffv_217;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_218> AgradDistributionSkewDoubleExponential_ffv_218;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_219> AgradDistributionSkewDoubleExponential_ffv_219;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_220> AgradDistributionSkewDoubleExponential_ffv_220;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_221> AgradDistributionSkewDoubleExponential_ffv_221;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_222> AgradDistributionSkewDoubleExponential_ffv_222;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_223> AgradDistributionSkewDoubleExponential_ffv_223;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_224> AgradDistributionSkewDoubleExponential_ffv_224;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_225> AgradDistributionSkewDoubleExponential_ffv_225;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_226> AgradDistributionSkewDoubleExponential_ffv_226;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_227> AgradDistributionSkewDoubleExponential_ffv_227;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_228> AgradDistributionSkewDoubleExponential_ffv_228;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_229> AgradDistributionSkewDoubleExponential_ffv_229;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_230> AgradDistributionSkewDoubleExponential_ffv_230;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_231> AgradDistributionSkewDoubleExponential_ffv_231;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_232> AgradDistributionSkewDoubleExponential_ffv_232;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_233> AgradDistributionSkewDoubleExponential_ffv_233;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_234> AgradDistributionSkewDoubleExponential_ffv_234;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_235> AgradDistributionSkewDoubleExponential_ffv_235;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_236> AgradDistributionSkewDoubleExponential_ffv_236;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_237> AgradDistributionSkewDoubleExponential_ffv_237;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_238> AgradDistributionSkewDoubleExponential_ffv_238;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_239> AgradDistributionSkewDoubleExponential_ffv_239;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_240> AgradDistributionSkewDoubleExponential_ffv_240;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_241> AgradDistributionSkewDoubleExponential_ffv_241;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_242> AgradDistributionSkewDoubleExponential_ffv_242;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_243> AgradDistributionSkewDoubleExponential_ffv_243;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_244> AgradDistributionSkewDoubleExponential_ffv_244;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_245> AgradDistributionSkewDoubleExponential_ffv_245;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_246> AgradDistributionSkewDoubleExponential_ffv_246;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_247> AgradDistributionSkewDoubleExponential_ffv_247;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_248> AgradDistributionSkewDoubleExponential_ffv_248;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_249> AgradDistributionSkewDoubleExponential_ffv_249;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_250> AgradDistributionSkewDoubleExponential_ffv_250;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_251> AgradDistributionSkewDoubleExponential_ffv_251;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_252> AgradDistributionSkewDoubleExponential_ffv_252;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_253> AgradDistributionSkewDoubleExponential_ffv_253;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_254> AgradDistributionSkewDoubleExponential_ffv_254;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_255> AgradDistributionSkewDoubleExponential_ffv_255;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_256> AgradDistributionSkewDoubleExponential_ffv_256;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_257> AgradDistributionSkewDoubleExponential_ffv_257;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_258> AgradDistributionSkewDoubleExponential_ffv_258;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_259> AgradDistributionSkewDoubleExponential_ffv_259;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_260> AgradDistributionSkewDoubleExponential_ffv_260;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_261> AgradDistributionSkewDoubleExponential_ffv_261;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_262> AgradDistributionSkewDoubleExponential_ffv_262;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_263> AgradDistributionSkewDoubleExponential_ffv_263;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_264> AgradDistributionSkewDoubleExponential_ffv_264;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_265> AgradDistributionSkewDoubleExponential_ffv_265;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_266> AgradDistributionSkewDoubleExponential_ffv_266;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_267> AgradDistributionSkewDoubleExponential_ffv_267;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_268> AgradDistributionSkewDoubleExponential_ffv_268;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_269> AgradDistributionSkewDoubleExponential_ffv_269;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_270> AgradDistributionSkewDoubleExponential_ffv_270;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_271> AgradDistributionSkewDoubleExponential_ffv_271;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_272> AgradDistributionSkewDoubleExponential_ffv_272;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_273> AgradDistributionSkewDoubleExponential_ffv_273;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_274> AgradDistributionSkewDoubleExponential_ffv_274;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_275> AgradDistributionSkewDoubleExponential_ffv_275;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_276> AgradDistributionSkewDoubleExponential_ffv_276;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_277> AgradDistributionSkewDoubleExponential_ffv_277;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_278> AgradDistributionSkewDoubleExponential_ffv_278;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_279> AgradDistributionSkewDoubleExponential_ffv_279;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_280> AgradDistributionSkewDoubleExponential_ffv_280;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_281> AgradDistributionSkewDoubleExponential_ffv_281;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_282> AgradDistributionSkewDoubleExponential_ffv_282;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_283> AgradDistributionSkewDoubleExponential_ffv_283;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_284> AgradDistributionSkewDoubleExponential_ffv_284;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_285> AgradDistributionSkewDoubleExponential_ffv_285;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_286> AgradDistributionSkewDoubleExponential_ffv_286;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_287> AgradDistributionSkewDoubleExponential_ffv_287;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_288> AgradDistributionSkewDoubleExponential_ffv_288;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_289> AgradDistributionSkewDoubleExponential_ffv_289;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_290> AgradDistributionSkewDoubleExponential_ffv_290;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_291> AgradDistributionSkewDoubleExponential_ffv_291;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_292> AgradDistributionSkewDoubleExponential_ffv_292;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_293> AgradDistributionSkewDoubleExponential_ffv_293;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_294> AgradDistributionSkewDoubleExponential_ffv_294;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_295> AgradDistributionSkewDoubleExponential_ffv_295;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_296> AgradDistributionSkewDoubleExponential_ffv_296;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_297> AgradDistributionSkewDoubleExponential_ffv_297;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_298> AgradDistributionSkewDoubleExponential_ffv_298;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_299> AgradDistributionSkewDoubleExponential_ffv_299;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_200, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_200);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_201, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_201);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_202, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_202);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_203, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_203);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_204, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_204);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_205, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_205);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_206, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_206);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_207, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_207);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_208, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_208);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_209, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_209);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_210, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_210);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_211, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_211);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_212, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_212);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_213, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_213);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_214, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_214);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_215, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_215);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_216, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_216);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_217, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_217);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_218, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_218);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_219, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_219);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_220, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_220);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_221, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_221);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_222, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_222);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_223, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_223);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_224, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_224);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_225, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_225);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_226, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_226);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_227, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_227);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_228, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_228);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_229, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_229);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_230, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_230);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_231, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_231);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_232, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_232);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_233, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_233);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_234, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_234);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_235, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_235);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_236, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_236);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_237, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_237);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_238, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_238);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_239, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_239);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_240, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_240);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_241, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_241);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_242, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_242);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_243, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_243);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_244, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_244);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_245, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_245);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_246, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_246);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_247, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_247);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_248, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_248);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_249, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_249);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_250, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_250);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_251, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_251);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_252, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_252);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_253, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_253);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_254, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_254);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_255, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_255);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_256, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_256);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_257, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_257);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_258, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_258);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_259, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_259);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_260, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_260);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_261, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_261);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_262, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_262);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_263, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_263);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_264, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_264);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_265, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_265);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_266, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_266);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_267, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_267);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_268, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_268);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_269, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_269);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_270, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_270);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_271, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_271);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_272, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_272);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_273, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_273);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_274, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_274);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_275, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_275);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_276, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_276);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_277, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_277);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_278, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_278);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_279, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_279);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_280, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_280);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_281, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_281);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_282, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_282);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_283, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_283);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_284, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_284);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_285, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_285);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_286, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_286);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_287, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_287);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_288, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_288);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_289, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_289);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_290, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_290);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_291, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_291);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_292, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_292);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_293, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_293);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_294, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_294);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_295, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_295);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_296, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_296);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_297, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_297);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_298, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_298);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_299, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_299);
+
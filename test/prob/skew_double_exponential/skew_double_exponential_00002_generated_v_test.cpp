@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/skew_double_exponential/skew_double_exponential_test.hpp>
+
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_200;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_201;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_202;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_203;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_204;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_205;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_206;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_207;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_208;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_209;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_210;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_211;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_212;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_213;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_214;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_215;
+typedef std::tuple<std::vector<double>, double, double, double, empty, empty> type_v_216;
+typedef std::tuple<std::vector<double>, double, double, std::vector<double>, empty, empty> type_v_217;
+typedef std::tuple<std::vector<double>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_218;
+typedef std::tuple<std::vector<double>, double, double, var, empty, empty> type_v_219;
+typedef std::tuple<std::vector<double>, double, double, std::vector<var>, empty, empty> type_v_220;
+typedef std::tuple<std::vector<double>, double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_221;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, double, empty, empty> type_v_222;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, std::vector<double>, empty, empty> type_v_223;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_224;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, var, empty, empty> type_v_225;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, std::vector<var>, empty, empty> type_v_226;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_227;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_228;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_229;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_230;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_231;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_232;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_233;
+typedef std::tuple<std::vector<double>, double, var, double, empty, empty> type_v_234;
+typedef std::tuple<std::vector<double>, double, var, std::vector<double>, empty, empty> type_v_235;
+typedef std::tuple<std::vector<double>, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_236;
+typedef std::tuple<std::vector<double>, double, var, var, empty, empty> type_v_237;
+typedef std::tuple<std::vector<double>, double, var, std::vector<var>, empty, empty> type_v_238;
+typedef std::tuple<std::vector<double>, double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_239;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, double, empty, empty> type_v_240;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, std::vector<double>, empty, empty> type_v_241;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_242;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, var, empty, empty> type_v_243;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, std::vector<var>, empty, empty> type_v_244;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_245;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_246;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_247;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_248;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_249;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_250;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_251;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, double, empty, empty> type_v_252;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, std::vector<double>, empty, empty> type_v_253;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_254;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, var, empty, empty> type_v_255;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, std::vector<var>, empty, empty> type_v_256;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_257;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, double, empty, empty> type_v_258;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, std::vector<double>, empty, empty> type_v_259;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_260;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, var, empty, empty> type_v_261;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_v_262;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_263;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_264;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_265;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_266;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_267;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_268;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_269;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, double, empty, empty> type_v_270;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, std::vector<double>, empty, empty> type_v_271;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_272;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, var, empty, empty> type_v_273;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, std::vector<var>, empty, empty> type_v_274;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_275;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, double, empty, empty> type_v_276;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_v_277;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_278;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, var, empty, empty> type_v_279;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_v_280;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_281;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_282;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_283;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_284;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_285;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_286;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_287;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_288;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_289;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_290;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_291;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_292;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_293;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_294;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_295;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_296;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_297;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_298;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_299;
+
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_200> AgradDistributionSkewDoubleExponential_v_200;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_201> AgradDistributionSkewDoubleExponential_v_201;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_202> AgradDistributionSkewDoubleExponential_v_202;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_203> AgradDistributionSkewDoubleExponential_v_203;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_204> AgradDistributionSkewDoubleExponential_v_204;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_205> AgradDistributionSkewDoubleExponential_v_205;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_206> AgradDistributionSkewDoubleExponential_v_206;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_207> AgradDistributionSkewDoubleExponential_v_207;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_208> AgradDistributionSkewDoubleExponential_v_208;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_209> AgradDistributionSkewDoubleExponential_v_209;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_210> AgradDistributionSkewDoubleExponential_v_210;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_211> AgradDistributionSkewDoubleExponential_v_211;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_212> AgradDistributionSkewDoubleExponential_v_212;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_213> AgradDistributionSkewDoubleExponential_v_213;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_214> AgradDistributionSkewDoubleExponential_v_214;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_215> AgradDistributionSkewDoubleExponential_v_215;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_216> AgradDistributionSkewDoubleExponential_v_216;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_217> AgradDistributionSkewDoubleExponential_v_217;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_218> AgradDistributionSkewDoubleExponential_v_218;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_219> AgradDistributionSkewDoubleExponential_v_219;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_220> AgradDistributionSkewDoubleExponential_v_220;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_221> AgradDistributionSkewDoubleExponential_v_221;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_222> AgradDistributionSkewDoubleExponential_v_222;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_223> AgradDistributionSkewDoubleExponential_v_223;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_224> AgradDistributionSkewDoubleExponential_v_224;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_225> AgradDistributionSkewDoubleExponential_v_225;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_226> AgradDistributionSkewDoubleExponential_v_226;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_227> AgradDistributionSkewDoubleExponential_v_227;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_228> AgradDistributionSkewDoubleExponential_v_228;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_229> AgradDistributionSkewDoubleExponential_v_229;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_230> AgradDistributionSkewDoubleExponential_v_230;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_231> AgradDistributionSkewDoubleExponential_v_231;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_232> AgradDistributionSkewDoubleExponential_v_232;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_233> AgradDistributionSkewDoubleExponential_v_233;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_234> AgradDistributionSkewDoubleExponential_v_234;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_235> AgradDistributionSkewDoubleExponential_v_235;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_236> AgradDistributionSkewDoubleExponential_v_236;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_237> AgradDistributionSkewDoubleExponential_v_237;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_238> AgradDistributionSkewDoubleExponential_v_238;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_239> AgradDistributionSkewDoubleExponential_v_239;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_240> AgradDistributionSkewDoubleExponential_v_240;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_241> AgradDistributionSkewDoubleExponential_v_241;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_242> AgradDistributionSkewDoubleExponential_v_242;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_243> AgradDistributionSkewDoubleExponential_v_243;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_244> AgradDistributionSkewDoubleExponential_v_244;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_245> AgradDistributionSkewDoubleExponential_v_245;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_246> AgradDistributionSkewDoubleExponential_v_246;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_247> AgradDistributionSkewDoubleExponential_v_247;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_248> AgradDistributionSkewDoubleExponential_v_248;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_249> AgradDistributionSkewDoubleExponential_v_249;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_250> AgradDistributionSkewDoubleExponential_v_250;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_251> AgradDistributionSkewDoubleExponential_v_251;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_252> AgradDistributionSkewDoubleExponential_v_252;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_253> AgradDistributionSkewDoubleExponential_v_253;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_254> AgradDistributionSkewDoubleExponential_v_254;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_255> AgradDistributionSkewDoubleExponential_v_255;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_256> AgradDistributionSkewDoubleExponential_v_256;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_257> AgradDistributionSkewDoubleExponential_v_257;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_258> AgradDistributionSkewDoubleExponential_v_258;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_259> AgradDistributionSkewDoubleExponential_v_259;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_260> AgradDistributionSkewDoubleExponential_v_260;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_261> AgradDistributionSkewDoubleExponential_v_261;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_262> AgradDistributionSkewDoubleExponential_v_262;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_263> AgradDistributionSkewDoubleExponential_v_263;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_264> AgradDistributionSkewDoubleExponential_v_264;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_265> AgradDistributionSkewDoubleExponential_v_265;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_266> AgradDistributionSkewDoubleExponential_v_266;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_267> AgradDistributionSkewDoubleExponential_v_267;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_268> AgradDistributionSkewDoubleExponential_v_268;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_269> AgradDistributionSkewDoubleExponential_v_269;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_270> AgradDistributionSkewDoubleExponential_v_270;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_271> AgradDistributionSkewDoubleExponential_v_271;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_272> AgradDistributionSkewDoubleExponential_v_272;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_273> AgradDistributionSkewDoubleExponential_v_273;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_274> AgradDistributionSkewDoubleExponential_v_274;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_275> AgradDistributionSkewDoubleExponential_v_275;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_276> AgradDistributionSkewDoubleExponential_v_276;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_277> AgradDistributionSkewDoubleExponential_v_277;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_278> AgradDistributionSkewDoubleExponential_v_278;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_279> AgradDistributionSkewDoubleExponential_v_279;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_280> AgradDistributionSkewDoubleExponential_v_280;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_281> AgradDistributionSkewDoubleExponential_v_281;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_282> AgradDistributionSkewDoubleExponential_v_282;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_283> AgradDistributionSkewDoubleExponential_v_283;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_284> AgradDistributionSkewDoubleExponential_v_284;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_285> AgradDistributionSkewDoubleExponential_v_285;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_286> AgradDistributionSkewDoubleExponential_v_286;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_287> AgradDistributionSkewDoubleExponential_v_287;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_288> AgradDistributionSkewDoubleExponential_v_288;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_289> AgradDistributionSkewDoubleExponential_v_289;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_290> AgradDistributionSkewDoubleExponential_v_290;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_291> AgradDistributionSkewDoubleExponential_v_291;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_292> AgradDistributionSkewDoubleExponential_v_292;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_293> AgradDistributionSkewDoubleExponential_v_293;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_294> AgradDistributionSkewDoubleExponential_v_294;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_295> AgradDistributionSkewDoubleExponential_v_295;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_296> AgradDistributionSkewDoubleExponential_v_296;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_297> AgradDistributionSkewDoubleExponential_v_297;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_298> AgradDistributionSkewDoubleExponential_v_298;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_299> AgradDistributionSkewDoubleExponential_v_299;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_200, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_200);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_201, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_201);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_202, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_202);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_203, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_203);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_204, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_204);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_205, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_205);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_206, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_206);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_207, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_207);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_208, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_208);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_209, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_209);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_210, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_210);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_211, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_211);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_212, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_212);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_213, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_213);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_214, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_214);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_215, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_215);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_216, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_216);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_217, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_217);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_218, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_218);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_219, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_219);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_220, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_220);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_221, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_221);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_222, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_222);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_223, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_223);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_224, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_224);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_225, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_225);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_226, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_226);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_227, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_227);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_228, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_228);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_229, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_229);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_230, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_230);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_231, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_231);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_232, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_232);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_233, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_233);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_234, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_234);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_235, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_235);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_236, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_236);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_237, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_237);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_238, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_238);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_239, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_239);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_240, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_240);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_241, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_241);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_242, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_242);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_243, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_243);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_244, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_244);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_245, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_245);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_246, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_246);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_247, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_247);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_248, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_248);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_249, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_249);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_250, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_250);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_251, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_251);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_252, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_252);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_253, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_253);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_254, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_254);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_255, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_255);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_256, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_256);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_257, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_257);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_258, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_258);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_259, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_259);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_260, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_260);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_261, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_261);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_262, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_262);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_263, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_263);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_264, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_264);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_265, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_265);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_266, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_266);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_267, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_267);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_268, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_268);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_269, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_269);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_270, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_270);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_271, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_271);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_272, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_272);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_273, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_273);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_274, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_274);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_275, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_275);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_276, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_276);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_277, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_277);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_278, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_278);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_279, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_279);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_280, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_280);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_281, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_281);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_282, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_282);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_283, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_283);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_284, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_284);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_285, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_285);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_286, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_286);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_287, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_287);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_288, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_288);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_289, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_289);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_290, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_290);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_291, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_291);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_292, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_292);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_293, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_293);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_294, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_294);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_295, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_295);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_296, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_296);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_297, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_297);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_298, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_298);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_299, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_299);
+
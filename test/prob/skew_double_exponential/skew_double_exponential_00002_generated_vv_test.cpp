@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/skew_double_exponential/skew_double_exponential_test.hpp>
+
+typedef std::tuple<std::vector<double>, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_200;
+typedef std::tuple<std::vector<double>, double, var, var, empty, empty> type_vv_201;
+typedef std::tuple<std::vector<double>, double, var, std::vector<var>, empty, empty> type_vv_202;
+typedef std::tuple<std::vector<double>, double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_203;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, double, empty, empty> type_vv_204;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, std::vector<double>, empty, empty> type_vv_205;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_206;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, var, empty, empty> type_vv_207;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, std::vector<var>, empty, empty> type_vv_208;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_209;
+typedef std::tuple<std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_210;
+typedef std::tuple<std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_211;
+typedef std::tuple<std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_212;
+typedef std::tuple<std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_213;
+typedef std::tuple<std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_214;
+typedef std::tuple<std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_215;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, var, empty, empty> type_vv_216;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, std::vector<var>, empty, empty> type_vv_217;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_218;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, var, empty, empty> type_vv_219;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_vv_220;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_221;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_222;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_223;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_224;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, double, empty, empty> type_vv_225;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, std::vector<double>, empty, empty> type_vv_226;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_227;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, var, empty, empty> type_vv_228;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, std::vector<var>, empty, empty> type_vv_229;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_230;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, double, empty, empty> type_vv_231;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_vv_232;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_233;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, var, empty, empty> type_vv_234;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_vv_235;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_236;
+typedef std::tuple<std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_237;
+typedef std::tuple<std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_238;
+typedef std::tuple<std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_239;
+typedef std::tuple<std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_240;
+typedef std::tuple<std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_241;
+typedef std::tuple<std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_242;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_vv_243;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_vv_244;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_245;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_vv_246;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_vv_247;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_248;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_249;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_250;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_251;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_vv_252;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_vv_253;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_254;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_vv_255;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_vv_256;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_257;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_vv_258;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_vv_259;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_260;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_vv_261;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_vv_262;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_263;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_264;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_265;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_266;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_267;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_268;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_269;
+typedef std::tuple<std::vector<double>, var, double, double, empty, empty> type_vv_270;
+typedef std::tuple<std::vector<double>, var, double, std::vector<double>, empty, empty> type_vv_271;
+typedef std::tuple<std::vector<double>, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_272;
+typedef std::tuple<std::vector<double>, var, double, var, empty, empty> type_vv_273;
+typedef std::tuple<std::vector<double>, var, double, std::vector<var>, empty, empty> type_vv_274;
+typedef std::tuple<std::vector<double>, var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_275;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, double, empty, empty> type_vv_276;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, std::vector<double>, empty, empty> type_vv_277;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_278;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, var, empty, empty> type_vv_279;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, std::vector<var>, empty, empty> type_vv_280;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_281;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_282;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_283;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_284;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_285;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_286;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_287;
+typedef std::tuple<std::vector<double>, var, var, double, empty, empty> type_vv_288;
+typedef std::tuple<std::vector<double>, var, var, std::vector<double>, empty, empty> type_vv_289;
+typedef std::tuple<std::vector<double>, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_290;
+typedef std::tuple<std::vector<double>, var, var, var, empty, empty> type_vv_291;
+typedef std::tuple<std::vector<double>, var, var, std::vector<var>, empty, empty> type_vv_292;
+typedef std::tuple<std::vector<double>, var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_293;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, double, empty, empty> type_vv_294;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, std::vector<double>, empty, empty> type_vv_295;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_296;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, var, empty, empty> type_vv_297;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, std::vector<var>, empty, empty> type_vv_298;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_299;
+
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_200> AgradDistributionSkewDoubleExponential_vv_200;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_201> AgradDistributionSkewDoubleExponential_vv_201;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_202> AgradDistributionSkewDoubleExponential_vv_202;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_203> AgradDistributionSkewDoubleExponential_vv_203;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_204> AgradDistributionSkewDoubleExponential_vv_204;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_205> AgradDistributionSkewDoubleExponential_vv_205;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_206> AgradDistributionSkewDoubleExponential_vv_206;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_207> AgradDistributionSkewDoubleExponential_vv_207;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_208> AgradDistributionSkewDoubleExponential_vv_208;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_209> AgradDistributionSkewDoubleExponential_vv_209;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_210> AgradDistributionSkewDoubleExponential_vv_210;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_211> AgradDistributionSkewDoubleExponential_vv_211;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_212> AgradDistributionSkewDoubleExponential_vv_212;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_213> AgradDistributionSkewDoubleExponential_vv_213;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_214> AgradDistributionSkewDoubleExponential_vv_214;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_215> AgradDistributionSkewDoubleExponential_vv_215;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_216> AgradDistributionSkewDoubleExponential_vv_216;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_217> AgradDistributionSkewDoubleExponential_vv_217;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_218> AgradDistributionSkewDoubleExponential_vv_218;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_219> AgradDistributionSkewDoubleExponential_vv_219;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_220> AgradDistributionSkewDoubleExponential_vv_220;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_221> AgradDistributionSkewDoubleExponential_vv_221;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_222> AgradDistributionSkewDoubleExponential_vv_222;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_223> AgradDistributionSkewDoubleExponential_vv_223;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_224> AgradDistributionSkewDoubleExponential_vv_224;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_225> AgradDistributionSkewDoubleExponential_vv_225;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_226> AgradDistributionSkewDoubleExponential_vv_226;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_227> AgradDistributionSkewDoubleExponential_vv_227;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_228> AgradDistributionSkewDoubleExponential_vv_228;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_229> AgradDistributionSkewDoubleExponential_vv_229;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_230> AgradDistributionSkewDoubleExponential_vv_230;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_231> AgradDistributionSkewDoubleExponential_vv_231;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_232> AgradDistributionSkewDoubleExponential_vv_232;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_233> AgradDistributionSkewDoubleExponential_vv_233;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_234> AgradDistributionSkewDoubleExponential_vv_234;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_235> AgradDistributionSkewDoubleExponential_vv_235;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_236> AgradDistributionSkewDoubleExponential_vv_236;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_237> AgradDistributionSkewDoubleExponential_vv_237;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_238> AgradDistributionSkewDoubleExponential_vv_238;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_239> AgradDistributionSkewDoubleExponential_vv_239;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_240> AgradDistributionSkewDoubleExponential_vv_240;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_241> AgradDistributionSkewDoubleExponential_vv_241;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_242> AgradDistributionSkewDoubleExponential_vv_242;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_243> AgradDistributionSkewDoubleExponential_vv_243;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_244> AgradDistributionSkewDoubleExponential_vv_244;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_245> AgradDistributionSkewDoubleExponential_vv_245;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_246> AgradDistributionSkewDoubleExponential_vv_246;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_247> AgradDistributionSkewDoubleExponential_vv_247;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_248> AgradDistributionSkewDoubleExponential_vv_248;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_249> AgradDistributionSkewDoubleExponential_vv_249;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_250> AgradDistributionSkewDoubleExponential_vv_250;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_251> AgradDistributionSkewDoubleExponential_vv_251;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_252> AgradDistributionSkewDoubleExponential_vv_252;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_253> AgradDistributionSkewDoubleExponential_vv_253;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_254> AgradDistributionSkewDoubleExponential_vv_254;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_255> AgradDistributionSkewDoubleExponential_vv_255;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_256> AgradDistributionSkewDoubleExponential_vv_256;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_257> AgradDistributionSkewDoubleExponential_vv_257;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_258> AgradDistributionSkewDoubleExponential_vv_258;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_259> AgradDistributionSkewDoubleExponential_vv_259;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_260> AgradDistributionSkewDoubleExponential_vv_260;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_261> AgradDistributionSkewDoubleExponential_vv_261;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_262> AgradDistributionSkewDoubleExponential_vv_262;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_263> AgradDistributionSkewDoubleExponential_vv_263;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_264> AgradDistributionSkewDoubleExponential_vv_264;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_265> AgradDistributionSkewDoubleExponential_vv_265;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_266> AgradDistributionSkewDoubleExponential_vv_266;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_267> AgradDistributionSkewDoubleExponential_vv_267;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_268> AgradDistributionSkewDoubleExponential_vv_268;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_269> AgradDistributionSkewDoubleExponential_vv_269;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_270> AgradDistributionSkewDoubleExponential_vv_270;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_271> AgradDistributionSkewDoubleExponential_vv_271;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_272> AgradDistributionSkewDoubleExponential_vv_272;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_273> AgradDistributionSkewDoubleExponential_vv_273;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_274> AgradDistributionSkewDoubleExponential_vv_274;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_275> AgradDistributionSkewDoubleExponential_vv_275;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_276> AgradDistributionSkewDoubleExponential_vv_276;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_277> AgradDistributionSkewDoubleExponential_vv_277;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_278> AgradDistributionSkewDoubleExponential_vv_278;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_279> AgradDistributionSkewDoubleExponential_vv_279;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_280> AgradDistributionSkewDoubleExponential_vv_280;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_281> AgradDistributionSkewDoubleExponential_vv_281;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_282> AgradDistributionSkewDoubleExponential_vv_282;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_283> AgradDistributionSkewDoubleExponential_vv_283;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_284> AgradDistributionSkewDoubleExponential_vv_284;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_285> AgradDistributionSkewDoubleExponential_vv_285;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_286> AgradDistributionSkewDoubleExponential_vv_286;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_287> AgradDistributionSkewDoubleExponential_vv_287;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_288> AgradDistributionSkewDoubleExponential_vv_288;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_289> AgradDistributionSkewDoubleExponential_vv_289;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_290> AgradDistributionSkewDoubleExponential_vv_290;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_291> AgradDistributionSkewDoubleExponential_vv_291;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_292> AgradDistributionSkewDoubleExponential_vv_292;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_293> AgradDistributionSkewDoubleExponential_vv_293;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_294> AgradDistributionSkewDoubleExponential_vv_294;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_295> AgradDistributionSkewDoubleExponential_vv_295;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_296> AgradDistributionSkewDoubleExponential_vv_296;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_297> AgradDistributionSkewDoubleExponential_vv_297;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_298> AgradDistributionSkewDoubleExponential_vv_298;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_299> AgradDistributionSkewDoubleExponential_vv_299;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_200, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_200);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_201, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_201);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_202, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_202);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_203, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_203);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_204, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_204);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_205, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_205);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_206, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_206);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_207, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_207);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_208, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_208);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_209, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_209);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_210, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_210);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_211, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_211);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_212, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_212);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_213, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_213);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_214, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_214);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_215, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_215);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_216, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_216);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_217, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_217);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_218, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_218);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_219, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_219);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_220, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_220);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_221, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_221);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_222, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_222);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_223, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_223);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_224, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_224);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_225, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_225);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_226, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_226);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_227, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_227);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_228, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_228);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_229, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_229);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_230, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_230);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_231, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_231);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_232, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_232);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_233, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_233);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_234, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_234);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_235, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_235);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_236, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_236);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_237, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_237);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_238, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_238);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_239, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_239);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_240, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_240);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_241, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_241);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_242, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_242);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_243, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_243);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_244, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_244);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_245, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_245);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_246, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_246);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_247, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_247);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_248, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_248);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_249, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_249);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_250, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_250);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_251, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_251);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_252, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_252);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_253, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_253);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_254, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_254);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_255, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_255);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_256, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_256);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_257, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_257);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_258, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_258);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_259, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_259);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_260, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_260);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_261, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_261);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_262, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_262);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_263, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_263);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_264, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_264);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_265, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_265);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_266, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_266);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_267, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_267);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_268, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_268);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_269, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_269);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_270, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_270);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_271, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_271);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_272, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_272);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_273, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_273);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_274, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_274);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_275, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_275);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_276, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_276);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_277, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_277);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_278, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_278);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_279, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_279);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_280, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_280);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_281, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_281);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_282, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_282);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_283, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_283);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_284, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_284);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_285, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_285);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_286, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_286);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_287, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_287);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_288, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_288);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_289, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_289);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_290, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_290);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_291, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_291);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_292, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_292);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_293, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_293);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_294, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_294);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_295, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_295);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_296, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_296);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_297, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_297);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_298, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_298);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_299, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_299);
+
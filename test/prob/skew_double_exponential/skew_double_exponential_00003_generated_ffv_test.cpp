@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/skew_double_exponential/skew_double_exponential_test.hpp>
+
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_300;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_301;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_302;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_303;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_304;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_305;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, double, double, empty, empty> type_ffv_306;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty, empty> type_ffv_307;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_308;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty, empty> type_ffv_309;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_310;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_311;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty, empty> type_ffv_312;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_313;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_314;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_315;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_316;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_317;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_318;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_319;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_320;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_321;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_322;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_323;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty, empty> type_ffv_324;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_325;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_326;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_327;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_328;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_329;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_330;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_331;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_332;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_333;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_334;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_335;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_336;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_337;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_338;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_339;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_340;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_341;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty, empty> type_ffv_342;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_ffv_343;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_344;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_345;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_346;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_347;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_ffv_348;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_349;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_350;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_351;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_352;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_353;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_354;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_355;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_356;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_357;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_358;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_359;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_360;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_361;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_362;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_363;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_364;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_365;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_366;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_367;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_368;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_369;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_370;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_371;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_372;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_373;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_374;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_375;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_376;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_377;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, fvar<fvar<var> >, empty, empty> type_ffv_378;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_379;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_380;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_381;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_382;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_383;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_384;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_385;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_386;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, double, empty, empty> type_ffv_387;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_388;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_389;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_390;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_391;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_392;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_393;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_394;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_395;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_396;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_397;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_398;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_399;
+
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_300> AgradDistributionSkewDoubleExponential_ffv_300;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_301> AgradDistributionSkewDoubleExponential_ffv_301;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_302> AgradDistributionSkewDoubleExponential_ffv_302;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_303> AgradDistributionSkewDoubleExponential_ffv_303;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_304> AgradDistributionSkewDoubleExponential_ffv_304;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_305> AgradDistributionSkewDoubleExponential_ffv_305;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_306> AgradDistributionSkewDoubleExponential_ffv_306;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_307> AgradDistributionSkewDoubleExponential_ffv_307;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_308> AgradDistributionSkewDoubleExponential_ffv_308;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_309> AgradDistributionSkewDoubleExponential_ffv_309;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_310> AgradDistributionSkewDoubleExponential_ffv_310;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_311> AgradDistributionSkewDoubleExponential_ffv_311;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_312> AgradDistributionSkewDoubleExponential_ffv_312;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_313> AgradDistributionSkewDoubleExponential_ffv_313;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_314> AgradDistributionSkewDoubleExponential_ffv_314;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_315> AgradDistributionSkewDoubleExponential_ffv_315;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_316> AgradDistributionSkewDoubleExponential_ffv_316;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_317> AgradDistributionSkewDoubleExponential_ffv_317;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_318> AgradDistributionSkewDoubleExponential_ffv_318;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_319> AgradDistributionSkewDoubleExponential_ffv_319;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_320> AgradDistributionSkewDoubleExponential_ffv_320;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_321> AgradDistributionSkewDoubleExponential_ffv_321;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_322> AgradDistributionSkewDoubleExponential_ffv_322;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_323> AgradDistributionSkewDoubleExponential_ffv_323;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_324> AgradDistributionSkewDoubleExponential_ffv_324;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_325> AgradDistributionSkewDoubleExponential_ffv_325;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_326> AgradDistributionSkewDoubleExponential_ffv_326;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_327> AgradDistributionSkewDoubleExponential_ffv_327;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_328> AgradDistributionSkewDoubleExponential_ffv_328;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_329> AgradDistributionSkewDoubleExponential_ffv_329;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_330> AgradDistributionSkewDoubleExponential_ffv_330;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_331> AgradDistributionSkewDoubleExponential_ffv_331;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_332> AgradDistributionSkewDoubleExponential_ffv_332;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_333> AgradDistributionSkewDoubleExponential_ffv_333;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_334> AgradDistributionSkewDoubleExponential_ffv_334;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_335> AgradDistributionSkewDoubleExponential_ffv_335;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_336> AgradDistributionSkewDoubleExponential_ffv_336;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_337> AgradDistributionSkewDoubleExponential_ffv_337;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_338> AgradDistributionSkewDoubleExponential_ffv_338;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_339> AgradDistributionSkewDoubleExponential_ffv_339;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_340> AgradDistributionSkewDoubleExponential_ffv_340;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_341> AgradDistributionSkewDoubleExponential_ffv_341;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_342> AgradDistributionSkewDoubleExponential_ffv_342;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_343> AgradDistributionSkewDoubleExponential_ffv_343;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_344> AgradDistributionSkewDoubleExponential_ffv_344;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_345> AgradDistributionSkewDoubleExponential_ffv_345;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_346> AgradDistributionSkewDoubleExponential_ffv_346;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_347> AgradDistributionSkewDoubleExponential_ffv_347;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_348> AgradDistributionSkewDoubleExponential_ffv_348;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_349> AgradDistributionSkewDoubleExponential_ffv_349;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_350> AgradDistributionSkewDoubleExponential_ffv_350;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_351> AgradDistributionSkewDoubleExponential_ffv_351;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_352> AgradDistributionSkewDoubleExponential_ffv_352;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_353> AgradDistributionSkewDoubleExponential_ffv_353;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_354> AgradDistributionSkewDoubleExponential_ffv_354;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_355> AgradDistributionSkewDoubleExponential_ffv_355;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_356> AgradDistributionSkewDoubleExponential_ffv_356;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_357> AgradDistributionSkewDoubleExponential_ffv_357;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_358> AgradDistributionSkewDoubleExponential_ffv_358;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_359> AgradDistributionSkewDoubleExponential_ffv_359;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_360> AgradDistributionSkewDoubleExponential_ffv_360;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_361> AgradDistributionSkewDoubleExponential_ffv_361;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_362> AgradDistributionSkewDoubleExponential_ffv_362;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_363> AgradDistributionSkewDoubleExponential_ffv_363;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_364> AgradDistributionSkewDoubleExponential_ffv_364;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_365> AgradDistributionSkewDoubleExponential_ffv_365;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_366> AgradDistributionSkewDoubleExponential_ffv_366;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_367> AgradDistributionSkewDoubleExponential_ffv_367;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_368> AgradDistributionSkewDoubleExponential_ffv_368;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_369> AgradDistributionSkewDoubleExponential_ffv_369;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_370> AgradDistributionSkewDoubleExponential_ffv_370;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_371> AgradDistributionSkewDoubleExponential_ffv_371;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_372> AgradDistributionSkewDoubleExponential_ffv_372;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_373> AgradDistributionSkewDoubleExponential_ffv_373;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_374> AgradDistributionSkewDoubleExponential_ffv_374;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_375> AgradDistributionSkewDoubleExponential_ffv_375;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_376> AgradDistributionSkewDoubleExponential_ffv_376;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_377> AgradDistributionSkewDoubleExponential_ffv_377;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_378> AgradDistributionSkewDoubleExponential_ffv_378;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_379> AgradDistributionSkewDoubleExponential_ffv_379;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_380> AgradDistributionSkewDoubleExponential_ffv_380;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_381> AgradDistributionSkewDoubleExponential_ffv_381;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_382> AgradDistributionSkewDoubleExponential_ffv_382;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_383> AgradDistributionSkewDoubleExponential_ffv_383;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_384> AgradDistributionSkewDoubleExponential_ffv_384;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_385> AgradDistributionSkewDoubleExponential_ffv_385;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_386> AgradDistributionSkewDoubleExponential_ffv_386;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_387> AgradDistributionSkewDoubleExponential_ffv_387;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_388> AgradDistributionSkewDoubleExponential_ffv_388;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_389> AgradDistributionSkewDoubleExponential_ffv_389;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_390> AgradDistributionSkewDoubleExponential_ffv_390;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_391> AgradDistributionSkewDoubleExponential_ffv_391;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_392> AgradDistributionSkewDoubleExponential_ffv_392;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_393> AgradDistributionSkewDoubleExponential_ffv_393;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_394> AgradDistributionSkewDoubleExponential_ffv_394;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_395> AgradDistributionSkewDoubleExponential_ffv_395;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_396> AgradDistributionSkewDoubleExponential_ffv_396;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_397> AgradDistributionSkewDoubleExponential_ffv_397;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_398> AgradDistributionSkewDoubleExponential_ffv_398;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_399> AgradDistributionSkewDoubleExponential_ffv_399;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_300, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_300);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_301, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_301);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_302, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_302);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_303, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_303);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_304, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_304);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_305, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_305);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_306, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_306);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_307, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_307);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_308, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_308);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_309, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_309);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_310, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_310);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_311, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_311);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_312, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_312);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_313, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_313);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_314, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_314);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_315, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_315);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_316, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_316);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_317, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_317);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_318, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_318);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_319, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_319);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_320, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_320);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_321, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_321);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_322, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_322);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_323, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_323);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_324, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_324);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_325, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_325);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_326, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_326);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_327, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_327);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_328, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_328);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_329, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_329);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_330, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_330);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_331, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_331);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_332, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_332);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_333, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_333);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_334, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_334);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_335, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_335);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_336, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_336);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_337, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_337);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_338, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_338);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_339, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_339);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_340, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_340);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_341, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_341);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_342, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_342);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_343, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_343);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_344, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_344);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_345, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_345);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_346, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_346);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_347, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_347);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_348, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_348);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_349, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_349);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_350, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_350);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_351, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_351);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_352, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_352);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_353, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_353);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_354, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_354);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_355, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_355);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_356, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_356);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_357, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_357);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_358, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_358);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_359, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_359);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_360, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_360);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_361, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_361);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_362, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_362);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_363, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_363);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_364, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_364);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_365, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_365);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_366, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_366);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_367, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_367);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_368, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_368);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_369, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_369);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_370, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_370);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_371, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_371);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_372, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_372);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_373, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_373);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_374, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_374);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_375, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_375);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_376, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_376);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_377, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_377);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_378, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_378);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_379, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_379);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_380, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_380);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_381, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_381);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_382, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_382);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_383, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_383);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_384, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_384);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_385, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_385);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_386, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_386);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_387, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_387);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_388, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_388);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_389, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_389);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_390, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_390);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_391, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_391);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_392, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_392);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_393, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_393);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_394, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_394);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_395, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_395);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_396, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_396);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_397, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_397);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_398, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_398);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_399, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_399);
+
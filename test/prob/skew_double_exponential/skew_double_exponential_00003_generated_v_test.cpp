@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/skew_double_exponential/skew_double_exponential_test.hpp>
+
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_300;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_301;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_302;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_303;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_304;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_305;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_306;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_307;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_308;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_309;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_310;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_311;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_312;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_313;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_314;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_315;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_316;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_317;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_318;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_319;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_320;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_321;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_322;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_323;
+typedef std::tuple<std::vector<double>, var, double, double, empty, empty> type_v_324;
+typedef std::tuple<std::vector<double>, var, double, std::vector<double>, empty, empty> type_v_325;
+typedef std::tuple<std::vector<double>, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_326;
+typedef std::tuple<std::vector<double>, var, double, var, empty, empty> type_v_327;
+typedef std::tuple<std::vector<double>, var, double, std::vector<var>, empty, empty> type_v_328;
+typedef std::tuple<std::vector<double>, var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_329;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, double, empty, empty> type_v_330;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, std::vector<double>, empty, empty> type_v_331;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_332;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, var, empty, empty> type_v_333;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, std::vector<var>, empty, empty> type_v_334;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_335;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_336;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_337;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_338;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_339;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_340;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_341;
+typedef std::tuple<std::vector<double>, var, var, double, empty, empty> type_v_342;
+typedef std::tuple<std::vector<double>, var, var, std::vector<double>, empty, empty> type_v_343;
+typedef std::tuple<std::vector<double>, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_344;
+typedef std::tuple<std::vector<double>, var, var, var, empty, empty> type_v_345;
+typedef std::tuple<std::vector<double>, var, var, std::vector<var>, empty, empty> type_v_346;
+typedef std::tuple<std::vector<double>, var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_347;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, double, empty, empty> type_v_348;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, std::vector<double>, empty, empty> type_v_349;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_350;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, var, empty, empty> type_v_351;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, std::vector<var>, empty, empty> type_v_352;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_353;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_354;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_355;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_356;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_357;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_358;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_359;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, double, empty, empty> type_v_360;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, std::vector<double>, empty, empty> type_v_361;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_362;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, var, empty, empty> type_v_363;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, std::vector<var>, empty, empty> type_v_364;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_365;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, double, empty, empty> type_v_366;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_v_367;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_368;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, var, empty, empty> type_v_369;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_v_370;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_371;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_372;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_373;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_374;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_375;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_376;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_377;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, double, empty, empty> type_v_378;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, std::vector<double>, empty, empty> type_v_379;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_380;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, var, empty, empty> type_v_381;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, std::vector<var>, empty, empty> type_v_382;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_383;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, double, empty, empty> type_v_384;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_v_385;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_386;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, var, empty, empty> type_v_387;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_v_388;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_389;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_390;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_391;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_392;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_393;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_394;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_395;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_396;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_397;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_398;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_399;
+
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_300> AgradDistributionSkewDoubleExponential_v_300;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_301> AgradDistributionSkewDoubleExponential_v_301;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_302> AgradDistributionSkewDoubleExponential_v_302;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_303> AgradDistributionSkewDoubleExponential_v_303;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_304> AgradDistributionSkewDoubleExponential_v_304;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_305> AgradDistributionSkewDoubleExponential_v_305;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_306> AgradDistributionSkewDoubleExponential_v_306;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_307> AgradDistributionSkewDoubleExponential_v_307;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_308> AgradDistributionSkewDoubleExponential_v_308;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_309> AgradDistributionSkewDoubleExponential_v_309;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_310> AgradDistributionSkewDoubleExponential_v_310;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_311> AgradDistributionSkewDoubleExponential_v_311;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_312> AgradDistributionSkewDoubleExponential_v_312;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_313> AgradDistributionSkewDoubleExponential_v_313;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_314> AgradDistributionSkewDoubleExponential_v_314;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_315> AgradDistributionSkewDoubleExponential_v_315;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_316> AgradDistributionSkewDoubleExponential_v_316;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_317> AgradDistributionSkewDoubleExponential_v_317;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_318> AgradDistributionSkewDoubleExponential_v_318;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_319> AgradDistributionSkewDoubleExponential_v_319;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_320> AgradDistributionSkewDoubleExponential_v_320;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_321> AgradDistributionSkewDoubleExponential_v_321;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_322> AgradDistributionSkewDoubleExponential_v_322;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_323> AgradDistributionSkewDoubleExponential_v_323;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_324> AgradDistributionSkewDoubleExponential_v_324;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_325> AgradDistributionSkewDoubleExponential_v_325;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_326> AgradDistributionSkewDoubleExponential_v_326;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_327> AgradDistributionSkewDoubleExponential_v_327;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_328> AgradDistributionSkewDoubleExponential_v_328;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_329> AgradDistributionSkewDoubleExponential_v_329;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_330> AgradDistributionSkewDoubleExponential_v_330;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_331> AgradDistributionSkewDoubleExponential_v_331;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_332> AgradDistributionSkewDoubleExponential_v_332;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_333> AgradDistributionSkewDoubleExponential_v_333;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_334> AgradDistributionSkewDoubleExponential_v_334;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_335> AgradDistributionSkewDoubleExponential_v_335;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_336> AgradDistributionSkewDoubleExponential_v_336;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_337> AgradDistributionSkewDoubleExponential_v_337;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_338> AgradDistributionSkewDoubleExponential_v_338;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_339> AgradDistributionSkewDoubleExponential_v_339;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_340> AgradDistributionSkewDoubleExponential_v_340;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_341> AgradDistributionSkewDoubleExponential_v_341;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_342> AgradDistributionSkewDoubleExponential_v_342;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_343> AgradDistributionSkewDoubleExponential_v_343;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_344> AgradDistributionSkewDoubleExponential_v_344;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_345> AgradDistributionSkewDoubleExponential_v_345;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_346> AgradDistributionSkewDoubleExponential_v_346;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_347> AgradDistributionSkewDoubleExponential_v_347;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_348> AgradDistributionSkewDoubleExponential_v_348;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_349> AgradDistributionSkewDoubleExponential_v_349;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_350> AgradDistributionSkewDoubleExponential_v_350;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_351> AgradDistributionSkewDoubleExponential_v_351;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_352> AgradDistributionSkewDoubleExponential_v_352;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_353> AgradDistributionSkewDoubleExponential_v_353;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_354> AgradDistributionSkewDoubleExponential_v_354;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_355> AgradDistributionSkewDoubleExponential_v_355;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_356> AgradDistributionSkewDoubleExponential_v_356;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_357> AgradDistributionSkewDoubleExponential_v_357;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_358> AgradDistributionSkewDoubleExponential_v_358;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_359> AgradDistributionSkewDoubleExponential_v_359;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_360> AgradDistributionSkewDoubleExponential_v_360;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_361> AgradDistributionSkewDoubleExponential_v_361;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_362> AgradDistributionSkewDoubleExponential_v_362;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_363> AgradDistributionSkewDoubleExponential_v_363;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_364> AgradDistributionSkewDoubleExponential_v_364;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_365> AgradDistributionSkewDoubleExponential_v_365;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_366> AgradDistributionSkewDoubleExponential_v_366;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_367> AgradDistributionSkewDoubleExponential_v_367;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_368> AgradDistributionSkewDoubleExponential_v_368;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_369> AgradDistributionSkewDoubleExponential_v_369;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_370> AgradDistributionSkewDoubleExponential_v_370;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_371> AgradDistributionSkewDoubleExponential_v_371;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_372> AgradDistributionSkewDoubleExponential_v_372;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_373> AgradDistributionSkewDoubleExponential_v_373;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_374> AgradDistributionSkewDoubleExponential_v_374;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_375> AgradDistributionSkewDoubleExponential_v_375;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_376> AgradDistributionSkewDoubleExponential_v_376;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_377> AgradDistributionSkewDoubleExponential_v_377;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_378> AgradDistributionSkewDoubleExponential_v_378;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_379> AgradDistributionSkewDoubleExponential_v_379;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_380> AgradDistributionSkewDoubleExponential_v_380;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_381> AgradDistributionSkewDoubleExponential_v_381;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_382> AgradDistributionSkewDoubleExponential_v_382;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_383> AgradDistributionSkewDoubleExponential_v_383;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_384> AgradDistributionSkewDoubleExponential_v_384;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_385> AgradDistributionSkewDoubleExponential_v_385;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_386> AgradDistributionSkewDoubleExponential_v_386;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_387> AgradDistributionSkewDoubleExponential_v_387;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_388> AgradDistributionSkewDoubleExponential_v_388;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_389> AgradDistributionSkewDoubleExponential_v_389;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_390> AgradDistributionSkewDoubleExponential_v_390;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_391> AgradDistributionSkewDoubleExponential_v_391;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_392> AgradDistributionSkewDoubleExponential_v_392;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_393> AgradDistributionSkewDoubleExponential_v_393;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_394> AgradDistributionSkewDoubleExponential_v_394;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_395> AgradDistributionSkewDoubleExponential_v_395;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_396> AgradDistributionSkewDoubleExponential_v_396;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_397> AgradDistributionSkewDoubleExponential_v_397;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_398> AgradDistributionSkewDoubleExponential_v_398;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_399> AgradDistributionSkewDoubleExponential_v_399;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_300, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_300);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_301, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_301);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_302, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_302);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_303, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_303);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_304, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_304);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_305, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_305);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_306, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_306);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_307, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_307);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_308, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_308);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_309, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_309);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_310, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_310);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_311, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_311);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_312, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_312);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_313, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_313);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_314, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_314);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_315, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_315);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_316, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_316);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_317, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_317);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_318, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_318);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_319, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_319);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_320, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_320);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_321, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_321);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_322, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_322);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_323, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_323);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_324, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_324);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_325, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_325);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_326, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_326);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_327, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_327);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_328, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_328);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_329, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_329);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_330, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_330);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_331, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_331);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_332, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_332);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_333, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_333);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_334, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_334);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_335, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_335);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_336, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_336);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_337, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_337);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_338, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_338);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_339, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_339);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_340, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_340);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_341, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_341);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_342, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_342);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_343, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_343);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_344, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_344);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_345, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_345);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_346, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_346);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_347, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_347);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_348, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_348);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_349, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_349);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_350, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_350);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_351, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_351);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_352, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_352);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_353, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_353);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_354, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_354);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_355, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_355);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_356, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_356);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_357, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_357);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_358, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_358);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_359, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_359);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_360, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_360);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_361, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_361);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_362, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_362);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_363, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_363);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_364, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_364);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_365, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_365);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_366, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_366);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_367, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_367);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_368, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_368);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_369, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_369);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_370, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_370);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_371, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_371);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_372, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_372);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_373, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_373);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_374, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_374);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_375, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_375);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_376, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_376);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_377, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_377);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_378, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_378);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_379, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_379);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_380, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_380);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_381, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_381);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_382, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_382);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_383, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_383);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_384, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_384);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_385, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_385);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_386, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_386);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_387, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_387);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_388, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_388);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_389, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_389);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_390, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_390);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_391, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_391);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_392, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_392);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_393, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_393);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_394, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_394);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_395, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_395);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_396, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_396);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_397, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_397);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_398, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_398);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_399, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_399);
+
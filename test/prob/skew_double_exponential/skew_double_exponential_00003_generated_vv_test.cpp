@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/skew_double_exponential/skew_double_exponential_test.hpp>
+
+typedef std::tuple<std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_300;
+typedef std::tuple<std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_301;
+typedef std::tuple<std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_302;
+typedef std::tuple<std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_303;
+typedef std::tuple<std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_304;
+typedef std::tuple<std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_305;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, double, empty, empty> type_vv_306;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, std::vector<double>, empty, empty> type_vv_307;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_308;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, var, empty, empty> type_vv_309;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, std::vector<var>, empty, empty> type_vv_310;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_311;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, double, empty, empty> type_vv_312;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_vv_313;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_314;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, var, empty, empty> type_vv_315;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_vv_316;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_317;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_318;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_319;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_320;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_321;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_322;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_323;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, double, empty, empty> type_vv_324;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, std::vector<double>, empty, empty> type_vv_325;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_326;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, var, empty, empty> type_vv_327;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, std::vector<var>, empty, empty> type_vv_328;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_329;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, double, empty, empty> type_vv_330;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_vv_331;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_332;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, var, empty, empty> type_vv_333;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_vv_334;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_335;
+typedef std::tuple<std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_336;
+typedef std::tuple<std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_337;
+typedef std::tuple<std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_338;
+typedef std::tuple<std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_339;
+typedef std::tuple<std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_340;
+typedef std::tuple<std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_341;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, empty, empty> type_vv_342;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, empty, empty> type_vv_343;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_344;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, empty, empty> type_vv_345;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, empty, empty> type_vv_346;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_347;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, empty, empty> type_vv_348;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, empty, empty> type_vv_349;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_350;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, empty, empty> type_vv_351;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, empty, empty> type_vv_352;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_353;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_354;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_355;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_356;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_357;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_358;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_359;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, empty, empty> type_vv_360;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, empty, empty> type_vv_361;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_362;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, empty, empty> type_vv_363;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, empty, empty> type_vv_364;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_365;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, empty, empty> type_vv_366;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, empty, empty> type_vv_367;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_368;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, empty, empty> type_vv_369;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, empty, empty> type_vv_370;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_371;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_372;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_373;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_374;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_375;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_376;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_377;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, var, empty, empty> type_vv_378;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, std::vector<var>, empty, empty> type_vv_379;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_380;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, var, empty, empty> type_vv_381;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, std::vector<var>, empty, empty> type_vv_382;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_383;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_384;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_385;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_386;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, double, empty, empty> type_vv_387;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, std::vector<double>, empty, empty> type_vv_388;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_389;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, var, empty, empty> type_vv_390;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, std::vector<var>, empty, empty> type_vv_391;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_392;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, double, empty, empty> type_vv_393;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, std::vector<double>, empty, empty> type_vv_394;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_395;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, var, empty, empty> type_vv_396;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, std::vector<var>, empty, empty> type_vv_397;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_398;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_399;
+
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_300> AgradDistributionSkewDoubleExponential_vv_300;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_301> AgradDistributionSkewDoubleExponential_vv_301;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_302> AgradDistributionSkewDoubleExponential_vv_302;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_303> AgradDistributionSkewDoubleExponential_vv_303;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_304> AgradDistributionSkewDoubleExponential_vv_304;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_305> AgradDistributionSkewDoubleExponential_vv_305;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_306> AgradDistributionSkewDoubleExponential_vv_306;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_307> AgradDistributionSkewDoubleExponential_vv_307;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_308> AgradDistributionSkewDoubleExponential_vv_308;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_309> AgradDistributionSkewDoubleExponential_vv_309;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_310> AgradDistributionSkewDoubleExponential_vv_310;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_311> AgradDistributionSkewDoubleExponential_vv_311;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_312> AgradDistributionSkewDoubleExponential_vv_312;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_313> AgradDistributionSkewDoubleExponential_vv_313;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_314> AgradDistributionSkewDoubleExponential_vv_314;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_315> AgradDistributionSkewDoubleExponential_vv_315;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_316> AgradDistributionSkewDoubleExponential_vv_316;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_317> AgradDistributionSkewDoubleExponential_vv_317;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_318> AgradDistributionSkewDoubleExponential_vv_318;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_319> AgradDistributionSkewDoubleExponential_vv_319;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_320> AgradDistributionSkewDoubleExponential_vv_320;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_321> AgradDistributionSkewDoubleExponential_vv_321;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_322> AgradDistributionSkewDoubleExponential_vv_322;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_323> AgradDistributionSkewDoubleExponential_vv_323;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_324> AgradDistributionSkewDoubleExponential_vv_324;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_325> AgradDistributionSkewDoubleExponential_vv_325;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_326> AgradDistributionSkewDoubleExponential_vv_326;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_327> AgradDistributionSkewDoubleExponential_vv_327;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_328> AgradDistributionSkewDoubleExponential_vv_328;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_329> AgradDistributionSkewDoubleExponential_vv_329;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_330> AgradDistributionSkewDoubleExponential_vv_330;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_331> AgradDistributionSkewDoubleExponential_vv_331;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_332> AgradDistributionSkewDoubleExponential_vv_332;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_333> AgradDistributionSkewDoubleExponential_vv_333;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_334> AgradDistributionSkewDoubleExponential_vv_334;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_335> AgradDistributionSkewDoubleExponential_vv_335;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_336> AgradDistributionSkewDoubleExponential_vv_336;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_337> AgradDistributionSkewDoubleExponential_vv_337;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_338> AgradDistributionSkewDoubleExponential_vv_338;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_339> AgradDistributionSkewDoubleExponential_vv_339;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_340> AgradDistributionSkewDoubleExponential_vv_340;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_341> AgradDistributionSkewDoubleExponential_vv_341;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_342> AgradDistributionSkewDoubleExponential_vv_342;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_343> AgradDistributionSkewDoubleExponential_vv_343;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_344> AgradDistributionSkewDoubleExponential_vv_344;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_345> AgradDistributionSkewDoubleExponential_vv_345;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_346> AgradDistributionSkewDoubleExponential_vv_346;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_347> AgradDistributionSkewDoubleExponential_vv_347;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_348> AgradDistributionSkewDoubleExponential_vv_348;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_349> AgradDistributionSkewDoubleExponential_vv_349;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_350> AgradDistributionSkewDoubleExponential_vv_350;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_351> AgradDistributionSkewDoubleExponential_vv_351;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_352> AgradDistributionSkewDoubleExponential_vv_352;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_353> AgradDistributionSkewDoubleExponential_vv_353;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_354> AgradDistributionSkewDoubleExponential_vv_354;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_355> AgradDistributionSkewDoubleExponential_vv_355;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_356> AgradDistributionSkewDoubleExponential_vv_356;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_357> AgradDistributionSkewDoubleExponential_vv_357;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_358> AgradDistributionSkewDoubleExponential_vv_358;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_359> AgradDistributionSkewDoubleExponential_vv_359;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_360> AgradDistributionSkewDoubleExponential_vv_360;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_361> AgradDistributionSkewDoubleExponential_vv_361;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_362> AgradDistributionSkewDoubleExponential_vv_362;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_363> AgradDistributionSkewDoubleExponential_vv_363;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_364> AgradDistributionSkewDoubleExponential_vv_364;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_365> AgradDistributionSkewDoubleExponential_vv_365;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_366> AgradDistributionSkewDoubleExponential_vv_366;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_367> AgradDistributionSkewDoubleExponential_vv_367;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_368> AgradDistributionSkewDoubleExponential_vv_368;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_369> AgradDistributionSkewDoubleExponential_vv_369;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_370> AgradDistributionSkewDoubleExponential_vv_370;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_371> AgradDistributionSkewDoubleExponential_vv_371;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_372> AgradDistributionSkewDoubleExponential_vv_372;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_373> AgradDistributionSkewDoubleExponential_vv_373;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_374> AgradDistributionSkewDoubleExponential_vv_374;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_375> AgradDistributionSkewDoubleExponential_vv_375;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_376> AgradDistributionSkewDoubleExponential_vv_376;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_377> AgradDistributionSkewDoubleExponential_vv_377;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_378> AgradDistributionSkewDoubleExponential_vv_378;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_379> AgradDistributionSkewDoubleExponential_vv_379;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_380> AgradDistributionSkewDoubleExponential_vv_380;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_381> AgradDistributionSkewDoubleExponential_vv_381;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_382> AgradDistributionSkewDoubleExponential_vv_382;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_383> AgradDistributionSkewDoubleExponential_vv_383;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_384> AgradDistributionSkewDoubleExponential_vv_384;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_385> AgradDistributionSkewDoubleExponential_vv_385;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_386> AgradDistributionSkewDoubleExponential_vv_386;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_387> AgradDistributionSkewDoubleExponential_vv_387;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_388> AgradDistributionSkewDoubleExponential_vv_388;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_389> AgradDistributionSkewDoubleExponential_vv_389;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_390> AgradDistributionSkewDoubleExponential_vv_390;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_391> AgradDistributionSkewDoubleExponential_vv_391;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_392> AgradDistributionSkewDoubleExponential_vv_392;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_393> AgradDistributionSkewDoubleExponential_vv_393;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_394> AgradDistributionSkewDoubleExponential_vv_394;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_395> AgradDistributionSkewDoubleExponential_vv_395;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_396> AgradDistributionSkewDoubleExponential_vv_396;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_397> AgradDistributionSkewDoubleExponential_vv_397;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_398> AgradDistributionSkewDoubleExponential_vv_398;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_399> AgradDistributionSkewDoubleExponential_vv_399;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_300, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_300);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_301, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_301);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_302, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_302);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_303, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_303);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_304, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_304);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_305, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_305);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_306, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_306);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_307, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_307);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_308, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_308);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_309, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_309);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_310, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_310);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_311, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_311);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_312, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_312);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_313, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_313);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_314, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_314);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_315, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_315);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_316, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_316);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_317, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_317);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_318, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_318);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_319, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_319);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_320, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_320);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_321, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_321);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_322, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_322);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_323, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_323);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_324, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_324);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_325, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_325);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_326, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_326);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_327, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_327);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_328, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_328);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_329, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_329);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_330, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_330);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_331, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_331);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_332, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_332);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_333, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_333);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_334, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_334);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_335, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_335);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_336, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_336);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_337, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_337);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_338, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_338);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_339, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_339);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_340, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_340);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_341, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_341);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_342, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_342);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_343, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_343);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_344, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_344);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_345, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_345);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_346, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_346);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_347, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_347);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_348, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_348);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_349, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_349);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_350, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_350);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_351, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_351);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_352, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_352);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_353, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_353);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_354, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_354);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_355, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_355);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_356, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_356);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_357, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_357);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_358, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_358);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_359, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_359);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_360, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_360);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_361, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_361);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_362, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_362);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_363, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_363);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_364, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_364);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_365, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_365);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_366, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_366);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_367, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_367);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_368, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_368);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_369, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_369);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_370, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_370);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_371, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_371);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_372, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_372);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_373, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_373);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_374, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_374);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_375, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_375);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_376, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_376);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_377, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_377);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_378, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_378);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_379, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_379);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_380, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_380);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_381, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_381);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_382, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_382);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_383, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_383);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_384, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_384);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_385, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_385);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_386, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_386);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_387, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_387);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_388, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_388);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_389, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_389);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_390, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_390);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_391, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_391);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_392, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_392);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_393, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_393);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_394, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_394);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_395, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_395);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_396, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_396);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_397, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_397);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_398, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_398);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_399, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_399);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/skew_double_exponential/skew_double_exponential_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_400;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_401;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_402;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_403;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_404;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, fvar<fvar<var> >, empty, empty> type_ffv_405;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_406;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_407;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_408;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_409;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_410;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_411;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_412;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_413;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, double, empty, empty> type_ffv_414;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_415;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_416;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_417;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_418;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_419;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_420;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_421;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_422;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_423;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_424;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_425;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_426;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_427;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_428;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_429;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_430;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_431;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_432;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_433;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_434;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_435;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_436;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_437;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_438;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_439;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_440;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_441;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_442;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_443;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_444;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_445;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_446;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_447;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_448;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_449;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_450;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_451;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_452;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_453;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_454;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_455;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_456;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_457;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_458;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, double, empty, empty> type_ffv_459;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, std::vector<double>, empty, empty> type_ffv_460;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_461;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, fvar<fvar<var> >, empty, empty> type_ffv_462;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_463;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_464;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, double, empty, empty> type_ffv_465;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty, empty> type_ffv_466;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_467;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_468;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_469;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_470;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_471;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_472;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_473;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_474;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_475;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_476;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, double, empty, empty> type_ffv_477;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_478;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_479;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_480;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_481;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_482;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_483;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_484;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_485;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_486;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_487;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_488;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_489;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_490;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_491;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_492;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_493;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_494;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, double, empty, empty> type_ffv_495;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty, empty> type_ffv_496;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_497;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty, empty> type_ffv_498;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_499;
+
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_400> AgradDistributionSkewDoubleExponential_ffv_400;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_401> AgradDistributionSkewDoubleExponential_ffv_401;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_402> AgradDistributionSkewDoubleExponential_ffv_402;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_403> AgradDistributionSkewDoubleExponential_ffv_403;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_404> AgradDistributionSkewDoubleExponential_ffv_404;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_405> AgradDistributionSkewDoubleExponential_ffv_405;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_406> AgradDistributionSkewDoubleExponential_ffv_406;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_407> AgradDistributionSkewDoubleExponential_ffv_407;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_408> AgradDistributionSkewDoubleExponential_ffv_408;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_409> AgradDistributionSkewDoubleExponential_ffv_409;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_410> AgradDistributionSkewDoubleExponential_ffv_410;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_411> AgradDistributionSkewDoubleExponential_ffv_411;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_412> AgradDistributionSkewDoubleExponential_ffv_412;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_413> AgradDistributionSkewDoubleExponential_ffv_413;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_414> AgradDistributionSkewDoubleExponential_ffv_414;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_415> AgradDistributionSkewDoubleExponential_ffv_415;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_416> AgradDistributionSkewDoubleExponential_ffv_416;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_417> AgradDistributionSkewDoubleExponential_ffv_417;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_418> AgradDistributionSkewDoubleExponential_ffv_418;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_419> AgradDistributionSkewDoubleExponential_ffv_419;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_420> AgradDistributionSkewDoubleExponential_ffv_420;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_421> AgradDistributionSkewDoubleExponential_ffv_421;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_422> AgradDistributionSkewDoubleExponential_ffv_422;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_423> AgradDistributionSkewDoubleExponential_ffv_423;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_424> AgradDistributionSkewDoubleExponential_ffv_424;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_425> AgradDistributionSkewDoubleExponential_ffv_425;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_426> AgradDistributionSkewDoubleExponential_ffv_426;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_427> AgradDistributionSkewDoubleExponential_ffv_427;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_428> AgradDistributionSkewDoubleExponential_ffv_428;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_429> AgradDistributionSkewDoubleExponential_ffv_429;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_430> AgradDistributionSkewDoubleExponential_ffv_430;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_431> AgradDistributionSkewDoubleExponential_ffv_431;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_432> AgradDistributionSkewDoubleExponential_ffv_432;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_433> AgradDistributionSkewDoubleExponential_ffv_433;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_434> AgradDistributionSkewDoubleExponential_ffv_434;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_435> AgradDistributionSkewDoubleExponential_ffv_435;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_436> AgradDistributionSkewDoubleExponential_ffv_436;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_437> AgradDistributionSkewDoubleExponential_ffv_437;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_438> AgradDistributionSkewDoubleExponential_ffv_438;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_439> AgradDistributionSkewDoubleExponential_ffv_439;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_440> AgradDistributionSkewDoubleExponential_ffv_440;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_441> AgradDistributionSkewDoubleExponential_ffv_441;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_442> AgradDistributionSkewDoubleExponential_ffv_442;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_443> AgradDistributionSkewDoubleExponential_ffv_443;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_444> AgradDistributionSkewDoubleExponential_ffv_444;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_445> AgradDistributionSkewDoubleExponential_ffv_445;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_446> AgradDistributionSkewDoubleExponential_ffv_446;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_447> AgradDistributionSkewDoubleExponential_ffv_447;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_448> AgradDistributionSkewDoubleExponential_ffv_448;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_449> AgradDistributionSkewDoubleExponential_ffv_449;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_450> AgradDistributionSkewDoubleExponential_ffv_450;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_451> AgradDistributionSkewDoubleExponential_ffv_451;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_452> AgradDistributionSkewDoubleExponential_ffv_452;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_453> AgradDistributionSkewDoubleExponential_ffv_453;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_454> AgradDistributionSkewDoubleExponential_ffv_454;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_455> AgradDistributionSkewDoubleExponential_ffv_455;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_456> AgradDistributionSkewDoubleExponential_ffv_456;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_457> AgradDistributionSkewDoubleExponential_ffv_457;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_458> AgradDistributionSkewDoubleExponential_ffv_458;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_459> AgradDistributionSkewDoubleExponential_ffv_459;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_460> AgradDistributionSkewDoubleExponential_ffv_460;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_461> AgradDistributionSkewDoubleExponential_ffv_461;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_462> AgradDistributionSkewDoubleExponential_ffv_462;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_463> AgradDistributionSkewDoubleExponential_ffv_463;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_464> AgradDistributionSkewDoubleExponential_ffv_464;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_465> AgradDistributionSkewDoubleExponential_ffv_465;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_466> AgradDistributionSkewDoubleExponential_ffv_466;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_467> AgradDistributionSkewDoubleExponential_ffv_467;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_468> AgradDistributionSkewDoubleExponential_ffv_468;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_469> AgradDistributionSkewDoubleExponential_ffv_469;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_470> AgradDistributionSkewDoubleExponential_ffv_470;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_471> AgradDistributionSkewDoubleExponential_ffv_471;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_472> AgradDistributionSkewDoubleExponential_ffv_472;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_473> AgradDistributionSkewDoubleExponential_ffv_473;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_474> AgradDistributionSkewDoubleExponential_ffv_474;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_475> AgradDistributionSkewDoubleExponential_ffv_475;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_476> AgradDistributionSkewDoubleExponential_ffv_476;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_477> AgradDistributionSkewDoubleExponential_ffv_477;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_478> AgradDistributionSkewDoubleExponential_ffv_478;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_479> AgradDistributionSkewDoubleExponential_ffv_479;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_480> AgradDistributionSkewDoubleExponential_ffv_480;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_481> AgradDistributionSkewDoubleExponential_ffv_481;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_482> AgradDistributionSkewDoubleExponential_ffv_482;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_483> AgradDistributionSkewDoubleExponential_ffv_483;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_484> AgradDistributionSkewDoubleExponential_ffv_484;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_485> AgradDistributionSkewDoubleExponential_ffv_485;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_486> AgradDistributionSkewDoubleExponential_ffv_486;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_487> AgradDistributionSkewDoubleExponential_ffv_487;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_488> AgradDistributionSkewDoubleExponential_ffv_488;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_489> AgradDistributionSkewDoubleExponential_ffv_489;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_490> AgradDistributionSkewDoubleExponential_ffv_490;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_491> AgradDistributionSkewDoubleExponential_ffv_491;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_492> AgradDistributionSkewDoubleExponential_ffv_492;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_493> AgradDistributionSkewDoubleExponential_ffv_493;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_494> AgradDistributionSkewDoubleExponential_ffv_494;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_495> AgradDistributionSkewDoubleExponential_ffv_495;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_496> AgradDistributionSkewDoubleExponential_ffv_496;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_497> AgradDistributionSkewDoubleExponential_ffv_497;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_498> AgradDistributionSkewDoubleExponential_ffv_498;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_499> AgradDistributionSkewDoubleExponential_ffv_499;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_400, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_400);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_401, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_401);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_402, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_402);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_403, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_403);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_404, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_404);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_405, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_405);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_406, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_406);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_407, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_407);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_408, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_408);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_409, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_409);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_410, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_410);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_411, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_411);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_412, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_412);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_413, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_413);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_414, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_414);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_415, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_415);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_416, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_416);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_417, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_417);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_418, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_418);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_419, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_419);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_420, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_420);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_421, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_421);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_422, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_422);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_423, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_423);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_424, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_424);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_425, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_425);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_426, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_426);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_427, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_427);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_428, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_428);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_429, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_429);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_430, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_430);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_431, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_431);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_432, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_432);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_433, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_433);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_434, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_434);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_435, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_435);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_436, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_436);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_437, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_437);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_438, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_438);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_439, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_439);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_440, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_440);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_441, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_441);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_442, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_442);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_443, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_443);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_444, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_444);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_445, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_445);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_446, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_446);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_447, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_447);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_448, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_448);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_449, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_449);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_450, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_450);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_451, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_451);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_452, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_452);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_453, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_453);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_454, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_454);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_455, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_455);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_456, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_456);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_457, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_457);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_458, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_458);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_459, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_459);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_460, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_460);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_461, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_461);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_462, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_462);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_463, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_463);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_464, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_464);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_465, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_465);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_466, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_466);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_467, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_467);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_468, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_468);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_469, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_469);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_470, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_470);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_471, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_471);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_472, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_472);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_473, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_473);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_474, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_474);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_475, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_475);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_476, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_476);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_477, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_477);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_478, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_478);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_479, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_479);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_480, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_480);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_481, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_481);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_482, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_482);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_483, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_483);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_484, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_484);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_485, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_485);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_486, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_486);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_487, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_487);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_488, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_488);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_489, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_489);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_490, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_490);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_491, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_491);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_492, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_492);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_493, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_493);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_494, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_494);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_495, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_495);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_496, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_496);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_497, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_497);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_498, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_498);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_499, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_499);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/skew_double_exponential/skew_double_exponential_test.hpp>
+
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_400;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_401;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_402;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_403;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_404;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_405;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_406;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_407;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_408;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_409;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_410;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_411;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_412;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_413;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_414;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_415;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_416;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_417;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_418;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_419;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_420;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_421;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_422;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_423;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_424;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_425;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_426;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_427;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_428;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_429;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_430;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_431;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, double, empty, empty> type_v_432;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, std::vector<double>, empty, empty> type_v_433;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_434;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, var, empty, empty> type_v_435;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, std::vector<var>, empty, empty> type_v_436;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_437;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, double, empty, empty> type_v_438;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, std::vector<double>, empty, empty> type_v_439;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_440;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, var, empty, empty> type_v_441;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, std::vector<var>, empty, empty> type_v_442;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_443;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_444;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_445;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_446;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_447;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_448;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_449;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, double, empty, empty> type_v_450;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, std::vector<double>, empty, empty> type_v_451;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_452;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, var, empty, empty> type_v_453;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, std::vector<var>, empty, empty> type_v_454;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_455;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, double, empty, empty> type_v_456;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, std::vector<double>, empty, empty> type_v_457;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_458;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, var, empty, empty> type_v_459;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, std::vector<var>, empty, empty> type_v_460;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_461;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_462;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_463;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_464;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_465;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_466;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_467;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, double, empty, empty> type_v_468;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, std::vector<double>, empty, empty> type_v_469;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_470;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, var, empty, empty> type_v_471;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, std::vector<var>, empty, empty> type_v_472;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_473;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, double, empty, empty> type_v_474;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, std::vector<double>, empty, empty> type_v_475;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_476;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, var, empty, empty> type_v_477;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_v_478;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_479;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_480;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_481;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_482;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_483;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_484;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_485;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, double, empty, empty> type_v_486;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, std::vector<double>, empty, empty> type_v_487;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_488;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, var, empty, empty> type_v_489;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, std::vector<var>, empty, empty> type_v_490;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_491;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, double, empty, empty> type_v_492;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_v_493;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_494;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, var, empty, empty> type_v_495;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_v_496;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_497;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_498;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_499;
+
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_400> AgradDistributionSkewDoubleExponential_v_400;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_401> AgradDistributionSkewDoubleExponential_v_401;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_402> AgradDistributionSkewDoubleExponential_v_402;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_403> AgradDistributionSkewDoubleExponential_v_403;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_404> AgradDistributionSkewDoubleExponential_v_404;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_405> AgradDistributionSkewDoubleExponential_v_405;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_406> AgradDistributionSkewDoubleExponential_v_406;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_407> AgradDistributionSkewDoubleExponential_v_407;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_408> AgradDistributionSkewDoubleExponential_v_408;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_409> AgradDistributionSkewDoubleExponential_v_409;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_410> AgradDistributionSkewDoubleExponential_v_410;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_411> AgradDistributionSkewDoubleExponential_v_411;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_412> AgradDistributionSkewDoubleExponential_v_412;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_413> AgradDistributionSkewDoubleExponential_v_413;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_414> AgradDistributionSkewDoubleExponential_v_414;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_415> AgradDistributionSkewDoubleExponential_v_415;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_416> AgradDistributionSkewDoubleExponential_v_416;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_417> AgradDistributionSkewDoubleExponential_v_417;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_418> AgradDistributionSkewDoubleExponential_v_418;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_419> AgradDistributionSkewDoubleExponential_v_419;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_420> AgradDistributionSkewDoubleExponential_v_420;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_421> AgradDistributionSkewDoubleExponential_v_421;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_422> AgradDistributionSkewDoubleExponential_v_422;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_423> AgradDistributionSkewDoubleExponential_v_423;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_424> AgradDistributionSkewDoubleExponential_v_424;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_425> AgradDistributionSkewDoubleExponential_v_425;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_426> AgradDistributionSkewDoubleExponential_v_426;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_427> AgradDistributionSkewDoubleExponential_v_427;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_428> AgradDistributionSkewDoubleExponential_v_428;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_429> AgradDistributionSkewDoubleExponential_v_429;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_430> AgradDistributionSkewDoubleExponential_v_430;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_431> AgradDistributionSkewDoubleExponential_v_431;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_432> AgradDistributionSkewDoubleExponential_v_432;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_433> AgradDistributionSkewDoubleExponential_v_433;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_434> AgradDistributionSkewDoubleExponential_v_434;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_435> AgradDistributionSkewDoubleExponential_v_435;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_436> AgradDistributionSkewDoubleExponential_v_436;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_437> AgradDistributionSkewDoubleExponential_v_437;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_438> AgradDistributionSkewDoubleExponential_v_438;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_439> AgradDistributionSkewDoubleExponential_v_439;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_440> AgradDistributionSkewDoubleExponential_v_440;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_441> AgradDistributionSkewDoubleExponential_v_441;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_442> AgradDistributionSkewDoubleExponential_v_442;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_443> AgradDistributionSkewDoubleExponential_v_443;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_444> AgradDistributionSkewDoubleExponential_v_444;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_445> AgradDistributionSkewDoubleExponential_v_445;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_446> AgradDistributionSkewDoubleExponential_v_446;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_447> AgradDistributionSkewDoubleExponential_v_447;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_448> AgradDistributionSkewDoubleExponential_v_448;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_449> AgradDistributionSkewDoubleExponential_v_449;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_450> AgradDistributionSkewDoubleExponential_v_450;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_451> AgradDistributionSkewDoubleExponential_v_451;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_452> AgradDistributionSkewDoubleExponential_v_452;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_453> AgradDistributionSkewDoubleExponential_v_453;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_454> AgradDistributionSkewDoubleExponential_v_454;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_455> AgradDistributionSkewDoubleExponential_v_455;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_456> AgradDistributionSkewDoubleExponential_v_456;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_457> AgradDistributionSkewDoubleExponential_v_457;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_458> AgradDistributionSkewDoubleExponential_v_458;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_459> AgradDistributionSkewDoubleExponential_v_459;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_460> AgradDistributionSkewDoubleExponential_v_460;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_461> AgradDistributionSkewDoubleExponential_v_461;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_462> AgradDistributionSkewDoubleExponential_v_462;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_463> AgradDistributionSkewDoubleExponential_v_463;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_464> AgradDistributionSkewDoubleExponential_v_464;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_465> AgradDistributionSkewDoubleExponential_v_465;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_466> AgradDistributionSkewDoubleExponential_v_466;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_467> AgradDistributionSkewDoubleExponential_v_467;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_468> AgradDistributionSkewDoubleExponential_v_468;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_469> AgradDistributionSkewDoubleExponential_v_469;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_470> AgradDistributionSkewDoubleExponential_v_470;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_471> AgradDistributionSkewDoubleExponential_v_471;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_472> AgradDistributionSkewDoubleExponential_v_472;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_473> AgradDistributionSkewDoubleExponential_v_473;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_474> AgradDistributionSkewDoubleExponential_v_474;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_475> AgradDistributionSkewDoubleExponential_v_475;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_476> AgradDistributionSkewDoubleExponential_v_476;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_477> AgradDistributionSkewDoubleExponential_v_477;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_478> AgradDistributionSkewDoubleExponential_v_478;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_479> AgradDistributionSkewDoubleExponential_v_479;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_480> AgradDistributionSkewDoubleExponential_v_480;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_481> AgradDistributionSkewDoubleExponential_v_481;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_482> AgradDistributionSkewDoubleExponential_v_482;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_483> AgradDistributionSkewDoubleExponential_v_483;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_484> AgradDistributionSkewDoubleExponential_v_484;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_485> AgradDistributionSkewDoubleExponential_v_485;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_486> AgradDistributionSkewDoubleExponential_v_486;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_487> AgradDistributionSkewDoubleExponential_v_487;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_488> AgradDistributionSkewDoubleExponential_v_488;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_489> AgradDistributionSkewDoubleExponential_v_489;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_490> AgradDistributionSkewDoubleExponential_v_490;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_491> AgradDistributionSkewDoubleExponential_v_491;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_492> AgradDistributionSkewDoubleExponential_v_492;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_493> AgradDistributionSkewDoubleExponential_v_493;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_494> AgradDistributionSkewDoubleExponential_v_494;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_495> AgradDistributionSkewDoubleExponential_v_495;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_496> AgradDistributionSkewDoubleExponential_v_496;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_497> AgradDistributionSkewDoubleExponential_v_497;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_498> AgradDistributionSkewDoubleExponential_v_498;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_499> AgradDistributionSkewDoubleExponential_v_499;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_400, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_400);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_401, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_401);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_402, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_402);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_403, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_403);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_404, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_404);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_405, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_405);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_406, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_406);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_407, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_407);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_408, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_408);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_409, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_409);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_410, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_410);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_411, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_411);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_412, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_412);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_413, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_413);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_414, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_414);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_415, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_415);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_416, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_416);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_417, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_417);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_418, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_418);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_419, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_419);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_420, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_420);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_421, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_421);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_422, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_422);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_423, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_423);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_424, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_424);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_425, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_425);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_426, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_426);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_427, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_427);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_428, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_428);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_429, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_429);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_430, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_430);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_431, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_431);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_432, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_432);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_433, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_433);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_434, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_434);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_435, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_435);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_436, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_436);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_437, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_437);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_438, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_438);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_439, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_439);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_440, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_440);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_441, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_441);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_442, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_442);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_443, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_443);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_444, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_444);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_445, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_445);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_446, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_446);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_447, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_447);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_448, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_448);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_449, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_449);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_450, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_450);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_451, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_451);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_452, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_452);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_453, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_453);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_454, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_454);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_455, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_455);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_456, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_456);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_457, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_457);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_458, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_458);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_459, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_459);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_460, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_460);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_461, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_461);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_462, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_462);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_463, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_463);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_464, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_464);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_465, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_465);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_466, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_466);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_467, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_467);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_468, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_468);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_469, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_469);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_470, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_470);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_471, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_471);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_472, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_472);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_473, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_473);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_474, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_474);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_475, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_475);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_476, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_476);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_477, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_477);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_478, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_478);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_479, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_479);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_480, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_480);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_481, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_481);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_482, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_482);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_483, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_483);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_484, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_484);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_485, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_485);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_486, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_486);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_487, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_487);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_488, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_488);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_489, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_489);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_490, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_490);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_491, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_491);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_492, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_492);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_493, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_493);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_494, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_494);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_495, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_495);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_496, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_496);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_497, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_497);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_498, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_498);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_499, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_499);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/skew_double_exponential/skew_double_exponential_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_400;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_401;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_402;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_403;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_404;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, var, empty, empty> type_vv_405;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, std::vector<var>, empty, empty> type_vv_406;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_407;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, var, empty, empty> type_vv_408;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_vv_409;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_410;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_411;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_412;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_413;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, double, empty, empty> type_vv_414;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, std::vector<double>, empty, empty> type_vv_415;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_416;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, var, empty, empty> type_vv_417;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, std::vector<var>, empty, empty> type_vv_418;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_419;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, double, empty, empty> type_vv_420;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_vv_421;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_422;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, var, empty, empty> type_vv_423;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_vv_424;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_425;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_426;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_427;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_428;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_429;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_430;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_431;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_vv_432;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_vv_433;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_434;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_vv_435;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_vv_436;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_437;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_438;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_439;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_440;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_vv_441;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_vv_442;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_443;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_vv_444;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_vv_445;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_446;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_vv_447;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_vv_448;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_449;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_vv_450;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_vv_451;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_452;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_453;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_454;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_455;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_456;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_457;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_458;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, double, empty, empty> type_vv_459;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, std::vector<double>, empty, empty> type_vv_460;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_461;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, var, empty, empty> type_vv_462;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, std::vector<var>, empty, empty> type_vv_463;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_464;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, double, empty, empty> type_vv_465;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, std::vector<double>, empty, empty> type_vv_466;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_467;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, var, empty, empty> type_vv_468;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, std::vector<var>, empty, empty> type_vv_469;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_470;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_471;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_472;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_473;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_474;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_475;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_476;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, double, empty, empty> type_vv_477;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, std::vector<double>, empty, empty> type_vv_478;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_479;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, var, empty, empty> type_vv_480;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, std::vector<var>, empty, empty> type_vv_481;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_482;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, double, empty, empty> type_vv_483;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, std::vector<double>, empty, empty> type_vv_484;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_485;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, var, empty, empty> type_vv_486;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, std::vector<var>, empty, empty> type_vv_487;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_488;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_489;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_490;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_491;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_492;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_493;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_494;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, double, empty, empty> type_vv_495;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, std::vector<double>, empty, empty> type_vv_496;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_497;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, var, empty, empty> type_vv_498;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, std::vector<var>, empty, empty> type_vv_499;
+
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_400> AgradDistributionSkewDoubleExponential_vv_400;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_401> AgradDistributionSkewDoubleExponential_vv_401;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_402> AgradDistributionSkewDoubleExponential_vv_402;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_403> AgradDistributionSkewDoubleExponential_vv_403;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_404> AgradDistributionSkewDoubleExponential_vv_404;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_405> AgradDistributionSkewDoubleExponential_vv_405;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_406> AgradDistributionSkewDoubleExponential_vv_406;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_407> AgradDistributionSkewDoubleExponential_vv_407;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_408> AgradDistributionSkewDoubleExponential_vv_408;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_409> AgradDistributionSkewDoubleExponential_vv_409;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_410> AgradDistributionSkewDoubleExponential_vv_410;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_411> AgradDistributionSkewDoubleExponential_vv_411;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_412> AgradDistributionSkewDoubleExponential_vv_412;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_413> AgradDistributionSkewDoubleExponential_vv_413;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_414> AgradDistributionSkewDoubleExponential_vv_414;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_415> AgradDistributionSkewDoubleExponential_vv_415;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_416> AgradDistributionSkewDoubleExponential_vv_416;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_417> AgradDistributionSkewDoubleExponential_vv_417;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_418> AgradDistributionSkewDoubleExponential_vv_418;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_419> AgradDistributionSkewDoubleExponential_vv_419;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_420> AgradDistributionSkewDoubleExponential_vv_420;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_421> AgradDistributionSkewDoubleExponential_vv_421;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_422> AgradDistributionSkewDoubleExponential_vv_422;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_423> AgradDistributionSkewDoubleExponential_vv_423;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_424> AgradDistributionSkewDoubleExponential_vv_424;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_425> AgradDistributionSkewDoubleExponential_vv_425;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_426> AgradDistributionSkewDoubleExponential_vv_426;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_427> AgradDistributionSkewDoubleExponential_vv_427;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_428> AgradDistributionSkewDoubleExponential_vv_428;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_429> AgradDistributionSkewDoubleExponential_vv_429;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_430> AgradDistributionSkewDoubleExponential_vv_430;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_431> AgradDistributionSkewDoubleExponential_vv_431;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_432> AgradDistributionSkewDoubleExponential_vv_432;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_433> AgradDistributionSkewDoubleExponential_vv_433;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_434> AgradDistributionSkewDoubleExponential_vv_434;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_435> AgradDistributionSkewDoubleExponential_vv_435;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_436> AgradDistributionSkewDoubleExponential_vv_436;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_437> AgradDistributionSkewDoubleExponential_vv_437;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_438> AgradDistributionSkewDoubleExponential_vv_438;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_439> AgradDistributionSkewDoubleExponential_vv_439;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_440> AgradDistributionSkewDoubleExponential_vv_440;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_441> AgradDistributionSkewDoubleExponential_vv_441;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_442> AgradDistributionSkewDoubleExponential_vv_442;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_443> AgradDistributionSkewDoubleExponential_vv_443;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_444> AgradDistributionSkewDoubleExponential_vv_444;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_445> AgradDistributionSkewDoubleExponential_vv_445;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_446> AgradDistributionSkewDoubleExponential_vv_446;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_447> AgradDistributionSkewDoubleExponential_vv_447;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_448> AgradDistributionSkewDoubleExponential_vv_448;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_449> AgradDistributionSkewDoubleExponential_vv_449;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_450> AgradDistributionSkewDoubleExponential_vv_450;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_451> AgradDistributionSkewDoubleExponential_vv_451;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_452> AgradDistributionSkewDoubleExponential_vv_452;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_453> AgradDistributionSkewDoubleExponential_vv_453;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_454> AgradDistributionSkewDoubleExponential_vv_454;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_455> AgradDistributionSkewDoubleExponential_vv_455;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_456> AgradDistributionSkewDoubleExponential_vv_456;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_457> AgradDistributionSkewDoubleExponential_vv_457;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_458> AgradDistributionSkewDoubleExponential_vv_458;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_459> AgradDistributionSkewDoubleExponential_vv_459;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_460> AgradDistributionSkewDoubleExponential_vv_460;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_461> AgradDistributionSkewDoubleExponential_vv_461;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_462> AgradDistributionSkewDoubleExponential_vv_462;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_463> AgradDistributionSkewDoubleExponential_vv_463;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_464> AgradDistributionSkewDoubleExponential_vv_464;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_465> AgradDistributionSkewDoubleExponential_vv_465;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_466> AgradDistributionSkewDoubleExponential_vv_466;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_467> AgradDistributionSkewDoubleExponential_vv_467;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_468> AgradDistributionSkewDoubleExponential_vv_468;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_469> AgradDistributionSkewDoubleExponential_vv_469;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_470> AgradDistributionSkewDoubleExponential_vv_470;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_471> AgradDistributionSkewDoubleExponential_vv_471;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_472> AgradDistributionSkewDoubleExponential_vv_472;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_473> AgradDistributionSkewDoubleExponential_vv_473;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_474> AgradDistributionSkewDoubleExponential_vv_474;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_475> AgradDistributionSkewDoubleExponential_vv_475;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_476> AgradDistributionSkewDoubleExponential_vv_476;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_477> AgradDistributionSkewDoubleExponential_vv_477;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_478> AgradDistributionSkewDoubleExponential_vv_478;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_479> AgradDistributionSkewDoubleExponential_vv_479;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_480> AgradDistributionSkewDoubleExponential_vv_480;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_481> AgradDistributionSkewDoubleExponential_vv_481;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_482> AgradDistributionSkewDoubleExponential_vv_482;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_483> AgradDistributionSkewDoubleExponential_vv_483;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_484> AgradDistributionSkewDoubleExponential_vv_484;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_485> AgradDistributionSkewDoubleExponential_vv_485;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_486> AgradDistributionSkewDoubleExponential_vv_486;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_487> AgradDistributionSkewDoubleExponential_vv_487;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_488> AgradDistributionSkewDoubleExponential_vv_488;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_489> AgradDistributionSkewDoubleExponential_vv_489;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_490> AgradDistributionSkewDoubleExponential_vv_490;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_491> AgradDistributionSkewDoubleExponential_vv_491;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_492> AgradDistributionSkewDoubleExponential_vv_492;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_493> AgradDistributionSkewDoubleExponential_vv_493;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_494> AgradDistributionSkewDoubleExponential_vv_494;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_495> AgradDistributionSkewDoubleExponential_vv_495;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_496> AgradDistributionSkewDoubleExponential_vv_496;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_497> AgradDistributionSkewDoubleExponential_vv_497;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_498> AgradDistributionSkewDoubleExponential_vv_498;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_499> AgradDistributionSkewDoubleExponential_vv_499;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_400, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_400);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_401, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_401);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_402, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_402);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_403, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_403);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_404, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_404);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_405, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_405);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_406, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_406);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_407, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_407);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_408, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_408);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_409, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_409);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_410, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_410);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_411, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_411);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_412, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_412);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_413, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_413);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_414, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_414);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_415, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_415);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_416, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_416);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_417, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_417);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_418, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_418);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_419, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_419);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_420, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_420);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_421, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_421);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_422, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_422);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_423, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_423);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_424, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_424);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_425, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_425);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_426, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_426);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_427, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_427);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_428, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_428);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_429, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_429);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_430, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_430);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_431, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_431);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_432, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_432);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_433, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_433);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_434, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_434);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_435, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_435);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_436, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_436);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_437, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_437);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_438, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_438);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_439, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_439);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_440, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_440);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_441, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_441);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_442, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_442);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_443, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_443);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_444, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_444);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_445, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_445);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_446, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_446);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_447, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_447);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_448, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_448);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_449, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_449);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_450, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_450);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_451, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_451);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_452, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_452);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_453, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_453);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_454, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_454);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_455, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_455);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_456, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_456);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_457, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_457);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_458, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_458);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_459, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_459);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_460, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_460);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_461, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_461);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_462, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_462);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_463, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_463);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_464, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_464);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_465, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_465);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_466, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_466);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_467, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_467);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_468, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_468);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_469, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_469);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_470, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_470);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_471, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_471);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_472, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_472);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_473, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_473);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_474, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_474);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_475, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_475);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_476, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_476);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_477, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_477);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_478, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_478);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_479, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_479);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_480, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_480);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_481, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_481);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_482, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_482);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_483, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_483);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_484, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_484);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_485, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_485);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_486, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_486);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_487, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_487);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_488, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_488);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_489, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_489);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_490, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_490);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_491, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_491);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_492, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_492);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_493, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_493);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_494, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_494);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_495, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_495);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_496, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_496);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_497, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_497);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_498, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_498);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_499, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_499);
+
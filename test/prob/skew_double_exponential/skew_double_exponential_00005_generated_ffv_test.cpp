@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/skew_double_exponential/skew_double_exponential_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_500;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty, empty> type_ffv_501;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_502;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_503;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_504;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_505;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_506;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_507;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_508;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_509;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_510;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_511;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_512;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty, empty> type_ffv_513;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_514;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_515;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_516;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_517;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_518;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_519;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_520;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_521;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_522;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_523;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_524;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_525;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_526;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_527;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_528;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_529;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_530;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty, empty> type_ffv_531;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_ffv_532;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_533;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_534;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_535;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_536;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_ffv_537;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_538;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_539;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_540;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_541;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_542;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_543;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_544;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_545;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_546;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_547;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_548;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_549;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_550;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_551;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_552;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_553;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_554;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_555;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_556;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_557;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_558;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_559;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_560;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_561;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_562;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_563;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_564;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_565;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_566;
+typedef std::tuple<fvar<fvar<var> >, double, double, double, empty, empty> type_ffv_567;
+typedef std::tuple<fvar<fvar<var> >, double, double, std::vector<double>, empty, empty> type_ffv_568;
+typedef std::tuple<fvar<fvar<var> >, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_569;
+typedef std::tuple<fvar<fvar<var> >, double, double, fvar<fvar<var> >, empty, empty> type_ffv_570;
+typedef std::tuple<fvar<fvar<var> >, double, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_571;
+typedef std::tuple<fvar<fvar<var> >, double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_572;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<double>, double, empty, empty> type_ffv_573;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<double>, std::vector<double>, empty, empty> type_ffv_574;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_575;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_576;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_577;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_578;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_579;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_580;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_581;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_582;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_583;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_584;
+typedef std::tuple<fvar<fvar<var> >, double, fvar<fvar<var> >, double, empty, empty> type_ffv_585;
+typedef std::tuple<fvar<fvar<var> >, double, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_586;
+typedef std::tuple<fvar<fvar<var> >, double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_587;
+typedef std::tuple<fvar<fvar<var> >, double, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_588;
+typedef std::tuple<fvar<fvar<var> >, double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_589;
+typedef std::tuple<fvar<fvar<var> >, double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_590;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_591;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_592;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_593;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_594;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_595;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_596;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_597;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_598;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_599;
+
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_500> AgradDistributionSkewDoubleExponential_ffv_500;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_501> AgradDistributionSkewDoubleExponential_ffv_501;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_502> AgradDistributionSkewDoubleExponential_ffv_502;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_503> AgradDistributionSkewDoubleExponential_ffv_503;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_504> AgradDistributionSkewDoubleExponential_ffv_504;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_505> AgradDistributionSkewDoubleExponential_ffv_505;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_506> AgradDistributionSkewDoubleExponential_ffv_506;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_507> AgradDistributionSkewDoubleExponential_ffv_507;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_508> AgradDistributionSkewDoubleExponential_ffv_508;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_509> AgradDistributionSkewDoubleExponential_ffv_509;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_510> AgradDistributionSkewDoubleExponential_ffv_510;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_511> AgradDistributionSkewDoubleExponential_ffv_511;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_512> AgradDistributionSkewDoubleExponential_ffv_512;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_513> AgradDistributionSkewDoubleExponential_ffv_513;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_514> AgradDistributionSkewDoubleExponential_ffv_514;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_515> AgradDistributionSkewDoubleExponential_ffv_515;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_516> AgradDistributionSkewDoubleExponential_ffv_516;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_517> AgradDistributionSkewDoubleExponential_ffv_517;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_518> AgradDistributionSkewDoubleExponential_ffv_518;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_519> AgradDistributionSkewDoubleExponential_ffv_519;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_520> AgradDistributionSkewDoubleExponential_ffv_520;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_521> AgradDistributionSkewDoubleExponential_ffv_521;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_522> AgradDistributionSkewDoubleExponential_ffv_522;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_523> AgradDistributionSkewDoubleExponential_ffv_523;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_524> AgradDistributionSkewDoubleExponential_ffv_524;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_525> AgradDistributionSkewDoubleExponential_ffv_525;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_526> AgradDistributionSkewDoubleExponential_ffv_526;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_527> AgradDistributionSkewDoubleExponential_ffv_527;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_528> AgradDistributionSkewDoubleExponential_ffv_528;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_529> AgradDistributionSkewDoubleExponential_ffv_529;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_530> AgradDistributionSkewDoubleExponential_ffv_530;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_531> AgradDistributionSkewDoubleExponential_ffv_531;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_532> AgradDistributionSkewDoubleExponential_ffv_532;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_533> AgradDistributionSkewDoubleExponential_ffv_533;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_534> AgradDistributionSkewDoubleExponential_ffv_534;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_535> AgradDistributionSkewDoubleExponential_ffv_535;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_536> AgradDistributionSkewDoubleExponential_ffv_536;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_537> AgradDistributionSkewDoubleExponential_ffv_537;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_538> AgradDistributionSkewDoubleExponential_ffv_538;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_539> AgradDistributionSkewDoubleExponential_ffv_539;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_540> AgradDistributionSkewDoubleExponential_ffv_540;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_541> AgradDistributionSkewDoubleExponential_ffv_541;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_542> AgradDistributionSkewDoubleExponential_ffv_542;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_543> AgradDistributionSkewDoubleExponential_ffv_543;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_544> AgradDistributionSkewDoubleExponential_ffv_544;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_545> AgradDistributionSkewDoubleExponential_ffv_545;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_546> AgradDistributionSkewDoubleExponential_ffv_546;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_547> AgradDistributionSkewDoubleExponential_ffv_547;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_548> AgradDistributionSkewDoubleExponential_ffv_548;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_549> AgradDistributionSkewDoubleExponential_ffv_549;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_550> AgradDistributionSkewDoubleExponential_ffv_550;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_551> AgradDistributionSkewDoubleExponential_ffv_551;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_552> AgradDistributionSkewDoubleExponential_ffv_552;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_553> AgradDistributionSkewDoubleExponential_ffv_553;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_554> AgradDistributionSkewDoubleExponential_ffv_554;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_555> AgradDistributionSkewDoubleExponential_ffv_555;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_556> AgradDistributionSkewDoubleExponential_ffv_556;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_557> AgradDistributionSkewDoubleExponential_ffv_557;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_558> AgradDistributionSkewDoubleExponential_ffv_558;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_559> AgradDistributionSkewDoubleExponential_ffv_559;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_560> AgradDistributionSkewDoubleExponential_ffv_560;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_561> AgradDistributionSkewDoubleExponential_ffv_561;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_562> AgradDistributionSkewDoubleExponential_ffv_562;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_563> AgradDistributionSkewDoubleExponential_ffv_563;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_564> AgradDistributionSkewDoubleExponential_ffv_564;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_565> AgradDistributionSkewDoubleExponential_ffv_565;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_566> AgradDistributionSkewDoubleExponential_ffv_566;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_567> AgradDistributionSkewDoubleExponential_ffv_567;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_568> AgradDistributionSkewDoubleExponential_ffv_568;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_569> AgradDistributionSkewDoubleExponential_ffv_569;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_570> AgradDistributionSkewDoubleExponential_ffv_570;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_571> AgradDistributionSkewDoubleExponential_ffv_571;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_572> AgradDistributionSkewDoubleExponential_ffv_572;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_573> AgradDistributionSkewDoubleExponential_ffv_573;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_574> AgradDistributionSkewDoubleExponential_ffv_574;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_575> AgradDistributionSkewDoubleExponential_ffv_575;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_576> AgradDistributionSkewDoubleExponential_ffv_576;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_577> AgradDistributionSkewDoubleExponential_ffv_577;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_578> AgradDistributionSkewDoubleExponential_ffv_578;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_579> AgradDistributionSkewDoubleExponential_ffv_579;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_580> AgradDistributionSkewDoubleExponential_ffv_580;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_581> AgradDistributionSkewDoubleExponential_ffv_581;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_582> AgradDistributionSkewDoubleExponential_ffv_582;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_583> AgradDistributionSkewDoubleExponential_ffv_583;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_584> AgradDistributionSkewDoubleExponential_ffv_584;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_585> AgradDistributionSkewDoubleExponential_ffv_585;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_586> AgradDistributionSkewDoubleExponential_ffv_586;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_587> AgradDistributionSkewDoubleExponential_ffv_587;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_588> AgradDistributionSkewDoubleExponential_ffv_588;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_589> AgradDistributionSkewDoubleExponential_ffv_589;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_590> AgradDistributionSkewDoubleExponential_ffv_590;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_591> AgradDistributionSkewDoubleExponential_ffv_591;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_592> AgradDistributionSkewDoubleExponential_ffv_592;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_593> AgradDistributionSkewDoubleExponential_ffv_593;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_594> AgradDistributionSkewDoubleExponential_ffv_594;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_595> AgradDistributionSkewDoubleExponential_ffv_595;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_596> AgradDistributionSkewDoubleExponential_ffv_596;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_597> AgradDistributionSkewDoubleExponential_ffv_597;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_598> AgradDistributionSkewDoubleExponential_ffv_598;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_599> AgradDistributionSkewDoubleExponential_ffv_599;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_500, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_500);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_501, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_501);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_502, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_502);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_503, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_503);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_504, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_504);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_505, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_505);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_506, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_506);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_507, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_507);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_508, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_508);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_509, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_509);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_510, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_510);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_511, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_511);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_512, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_512);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_513, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_513);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_514, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_514);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_515, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_515);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_516, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_516);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_517, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_517);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_518, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_518);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_519, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_519);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_520, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_520);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_521, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_521);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_522, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_522);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_523, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_523);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_524, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_524);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_525, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_525);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_526, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_526);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_527, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_527);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_528, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_528);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_529, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_529);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_530, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_530);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_531, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_531);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_532, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_532);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_533, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_533);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_534, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_534);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_535, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_535);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_536, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_536);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_537, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_537);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_538, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_538);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_539, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_539);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_540, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_540);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_541, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_541);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_542, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_542);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_543, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_543);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_544, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_544);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_545, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_545);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_546, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_546);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_547, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_547);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_548, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_548);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_549, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_549);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_550, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_550);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_551, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_551);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_552, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_552);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_553, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_553);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_554, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_554);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_555, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_555);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_556, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_556);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_557, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_557);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_558, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_558);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_559, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_559);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_560, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_560);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_561, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_561);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_562, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_562);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_563, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_563);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_564, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_564);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_565, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_565);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_566, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_566);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_567, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_567);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_568, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_568);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_569, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_569);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_570, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_570);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_571, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_571);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_572, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_572);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_573, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_573);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_574, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_574);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_575, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_575);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_576, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_576);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_577, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_577);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_578, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_578);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_579, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_579);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_580, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_580);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_581, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_581);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_582, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_582);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_583, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_583);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_584, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_584);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_585, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_585);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_586, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_586);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_587, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_587);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_588, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_588);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_589, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_589);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_590, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_590);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_591, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_591);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_592, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_592);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_593, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_593);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_594, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_594);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_595, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_595);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_596, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_596);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_597, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_597);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_598, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_598);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_599, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_599);
+
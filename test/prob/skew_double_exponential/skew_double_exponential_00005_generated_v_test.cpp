@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/skew_double_exponential/skew_double_exponential_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_500;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_501;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_502;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_503;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_504;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_505;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_506;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_507;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_508;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_509;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_510;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_511;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_512;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_513;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_514;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_515;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_516;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_517;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_518;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_519;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_520;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_521;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_522;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_523;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_524;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_525;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_526;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_527;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_528;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_529;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_530;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_531;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_532;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_533;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_534;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_535;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_536;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_537;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_538;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_539;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, double, empty, empty> type_v_540;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, std::vector<double>, empty, empty> type_v_541;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_542;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, var, empty, empty> type_v_543;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, std::vector<var>, empty, empty> type_v_544;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_545;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, double, empty, empty> type_v_546;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, std::vector<double>, empty, empty> type_v_547;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_548;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, var, empty, empty> type_v_549;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, std::vector<var>, empty, empty> type_v_550;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_551;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_552;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_553;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_554;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_555;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_556;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_557;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, double, empty, empty> type_v_558;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, std::vector<double>, empty, empty> type_v_559;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_560;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, var, empty, empty> type_v_561;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, std::vector<var>, empty, empty> type_v_562;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_563;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, double, empty, empty> type_v_564;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, std::vector<double>, empty, empty> type_v_565;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_566;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, var, empty, empty> type_v_567;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, std::vector<var>, empty, empty> type_v_568;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_569;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_570;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_571;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_572;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_573;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_574;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_575;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, double, empty, empty> type_v_576;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, std::vector<double>, empty, empty> type_v_577;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_578;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, var, empty, empty> type_v_579;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, std::vector<var>, empty, empty> type_v_580;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_581;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, double, empty, empty> type_v_582;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_v_583;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_584;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, var, empty, empty> type_v_585;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_v_586;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_587;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_588;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_589;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_590;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_591;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_592;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_593;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, double, empty, empty> type_v_594;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, std::vector<double>, empty, empty> type_v_595;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_596;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, var, empty, empty> type_v_597;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, std::vector<var>, empty, empty> type_v_598;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_599;
+
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_500> AgradDistributionSkewDoubleExponential_v_500;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_501> AgradDistributionSkewDoubleExponential_v_501;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_502> AgradDistributionSkewDoubleExponential_v_502;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_503> AgradDistributionSkewDoubleExponential_v_503;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_504> AgradDistributionSkewDoubleExponential_v_504;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_505> AgradDistributionSkewDoubleExponential_v_505;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_506> AgradDistributionSkewDoubleExponential_v_506;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_507> AgradDistributionSkewDoubleExponential_v_507;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_508> AgradDistributionSkewDoubleExponential_v_508;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_509> AgradDistributionSkewDoubleExponential_v_509;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_510> AgradDistributionSkewDoubleExponential_v_510;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_511> AgradDistributionSkewDoubleExponential_v_511;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_512> AgradDistributionSkewDoubleExponential_v_512;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_513> AgradDistributionSkewDoubleExponential_v_513;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_514> AgradDistributionSkewDoubleExponential_v_514;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_515> AgradDistributionSkewDoubleExponential_v_515;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_516> AgradDistributionSkewDoubleExponential_v_516;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_517> AgradDistributionSkewDoubleExponential_v_517;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_518> AgradDistributionSkewDoubleExponential_v_518;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_519> AgradDistributionSkewDoubleExponential_v_519;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_520> AgradDistributionSkewDoubleExponential_v_520;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_521> AgradDistributionSkewDoubleExponential_v_521;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_522> AgradDistributionSkewDoubleExponential_v_522;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_523> AgradDistributionSkewDoubleExponential_v_523;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_524> AgradDistributionSkewDoubleExponential_v_524;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_525> AgradDistributionSkewDoubleExponential_v_525;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_526> AgradDistributionSkewDoubleExponential_v_526;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_527> AgradDistributionSkewDoubleExponential_v_527;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_528> AgradDistributionSkewDoubleExponential_v_528;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_529> AgradDistributionSkewDoubleExponential_v_529;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_530> AgradDistributionSkewDoubleExponential_v_530;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_531> AgradDistributionSkewDoubleExponential_v_531;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_532> AgradDistributionSkewDoubleExponential_v_532;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_533> AgradDistributionSkewDoubleExponential_v_533;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_534> AgradDistributionSkewDoubleExponential_v_534;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_535> AgradDistributionSkewDoubleExponential_v_535;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_536> AgradDistributionSkewDoubleExponential_v_536;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_537> AgradDistributionSkewDoubleExponential_v_537;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_538> AgradDistributionSkewDoubleExponential_v_538;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_539> AgradDistributionSkewDoubleExponential_v_539;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_540> AgradDistributionSkewDoubleExponential_v_540;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_541> AgradDistributionSkewDoubleExponential_v_541;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_542> AgradDistributionSkewDoubleExponential_v_542;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_543> AgradDistributionSkewDoubleExponential_v_543;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_544> AgradDistributionSkewDoubleExponential_v_544;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_545> AgradDistributionSkewDoubleExponential_v_545;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_546> AgradDistributionSkewDoubleExponential_v_546;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_547> AgradDistributionSkewDoubleExponential_v_547;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_548> AgradDistributionSkewDoubleExponential_v_548;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_549> AgradDistributionSkewDoubleExponential_v_549;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_550> AgradDistributionSkewDoubleExponential_v_550;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_551> AgradDistributionSkewDoubleExponential_v_551;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_552> AgradDistributionSkewDoubleExponential_v_552;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_553> AgradDistributionSkewDoubleExponential_v_553;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_554> AgradDistributionSkewDoubleExponential_v_554;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_555> AgradDistributionSkewDoubleExponential_v_555;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_556> AgradDistributionSkewDoubleExponential_v_556;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_557> AgradDistributionSkewDoubleExponential_v_557;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_558> AgradDistributionSkewDoubleExponential_v_558;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_559> AgradDistributionSkewDoubleExponential_v_559;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_560> AgradDistributionSkewDoubleExponential_v_560;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_561> AgradDistributionSkewDoubleExponential_v_561;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_562> AgradDistributionSkewDoubleExponential_v_562;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_563> AgradDistributionSkewDoubleExponential_v_563;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_564> AgradDistributionSkewDoubleExponential_v_564;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_565> AgradDistributionSkewDoubleExponential_v_565;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_566> AgradDistributionSkewDoubleExponential_v_566;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_567> AgradDistributionSkewDoubleExponential_v_567;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_568> AgradDistributionSkewDoubleExponential_v_568;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_569> AgradDistributionSkewDoubleExponential_v_569;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_570> AgradDistributionSkewDoubleExponential_v_570;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_571> AgradDistributionSkewDoubleExponential_v_571;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_572> AgradDistributionSkewDoubleExponential_v_572;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_573> AgradDistributionSkewDoubleExponential_v_573;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_574> AgradDistributionSkewDoubleExponential_v_574;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_575> AgradDistributionSkewDoubleExponential_v_575;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_576> AgradDistributionSkewDoubleExponential_v_576;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_577> AgradDistributionSkewDoubleExponential_v_577;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_578> AgradDistributionSkewDoubleExponential_v_578;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_579> AgradDistributionSkewDoubleExponential_v_579;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_580> AgradDistributionSkewDoubleExponential_v_580;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_581> AgradDistributionSkewDoubleExponential_v_581;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_582> AgradDistributionSkewDoubleExponential_v_582;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_583> AgradDistributionSkewDoubleExponential_v_583;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_584> AgradDistributionSkewDoubleExponential_v_584;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_585> AgradDistributionSkewDoubleExponential_v_585;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_586> AgradDistributionSkewDoubleExponential_v_586;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_587> AgradDistributionSkewDoubleExponential_v_587;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_588> AgradDistributionSkewDoubleExponential_v_588;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_589> AgradDistributionSkewDoubleExponential_v_589;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_590> AgradDistributionSkewDoubleExponential_v_590;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_591> AgradDistributionSkewDoubleExponential_v_591;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_592> AgradDistributionSkewDoubleExponential_v_592;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_593> AgradDistributionSkewDoubleExponential_v_593;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_594> AgradDistributionSkewDoubleExponential_v_594;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_595> AgradDistributionSkewDoubleExponential_v_595;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_596> AgradDistributionSkewDoubleExponential_v_596;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_597> AgradDistributionSkewDoubleExponential_v_597;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_598> AgradDistributionSkewDoubleExponential_v_598;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_599> AgradDistributionSkewDoubleExponential_v_599;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_500, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_500);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_501, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_501);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_502, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_502);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_503, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_503);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_504, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_504);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_505, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_505);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_506, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_506);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_507, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_507);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_508, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_508);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_509, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_509);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_510, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_510);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_511, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_511);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_512, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_512);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_513, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_513);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_514, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_514);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_515, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_515);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_516, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_516);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_517, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_517);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_518, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_518);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_519, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_519);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_520, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_520);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_521, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_521);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_522, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_522);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_523, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_523);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_524, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_524);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_525, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_525);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_526, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_526);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_527, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_527);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_528, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_528);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_529, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_529);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_530, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_530);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_531, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_531);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_532, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_532);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_533, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_533);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_534, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_534);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_535, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_535);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_536, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_536);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_537, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_537);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_538, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_538);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_539, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_539);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_540, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_540);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_541, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_541);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_542, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_542);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_543, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_543);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_544, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_544);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_545, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_545);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_546, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_546);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_547, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_547);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_548, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_548);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_549, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_549);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_550, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_550);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_551, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_551);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_552, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_552);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_553, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_553);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_554, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_554);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_555, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_555);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_556, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_556);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_557, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_557);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_558, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_558);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_559, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_559);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_560, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_560);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_561, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_561);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_562, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_562);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_563, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_563);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_564, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_564);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_565, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_565);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_566, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_566);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_567, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_567);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_568, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_568);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_569, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_569);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_570, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_570);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_571, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_571);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_572, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_572);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_573, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_573);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_574, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_574);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_575, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_575);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_576, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_576);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_577, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_577);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_578, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_578);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_579, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_579);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_580, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_580);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_581, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_581);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_582, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_582);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_583, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_583);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_584, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_584);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_585, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_585);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_586, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_586);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_587, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_587);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_588, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_588);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_589, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_589);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_590, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_590);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_591, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_591);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_592, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_592);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_593, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_593);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_594, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_594);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_595, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_595);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_596, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_596);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_597, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_597);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_598, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_598);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_599, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_599);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/skew_double_exponential/skew_double_exponential_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_500;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, double, empty, empty> type_vv_501;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_vv_502;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_503;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, var, empty, empty> type_vv_504;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_vv_505;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_506;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_507;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_508;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_509;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_510;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_511;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_512;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, double, empty, empty> type_vv_513;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, std::vector<double>, empty, empty> type_vv_514;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_515;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, var, empty, empty> type_vv_516;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, std::vector<var>, empty, empty> type_vv_517;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_518;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, double, empty, empty> type_vv_519;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_vv_520;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_521;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, var, empty, empty> type_vv_522;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_vv_523;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_524;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_525;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_526;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_527;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_528;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_529;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_530;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, empty, empty> type_vv_531;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, empty, empty> type_vv_532;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_533;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, empty, empty> type_vv_534;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, empty, empty> type_vv_535;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_536;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, empty, empty> type_vv_537;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, empty, empty> type_vv_538;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_539;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, empty, empty> type_vv_540;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, empty, empty> type_vv_541;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_542;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_543;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_544;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_545;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_546;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_547;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_548;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, empty, empty> type_vv_549;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, empty, empty> type_vv_550;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_551;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, empty, empty> type_vv_552;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, empty, empty> type_vv_553;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_554;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, empty, empty> type_vv_555;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, empty, empty> type_vv_556;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_557;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, empty, empty> type_vv_558;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, empty, empty> type_vv_559;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_560;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_561;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_562;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_563;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_564;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_565;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_566;
+typedef std::tuple<var, double, double, double, empty, empty> type_vv_567;
+typedef std::tuple<var, double, double, std::vector<double>, empty, empty> type_vv_568;
+typedef std::tuple<var, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_569;
+typedef std::tuple<var, double, double, var, empty, empty> type_vv_570;
+typedef std::tuple<var, double, double, std::vector<var>, empty, empty> type_vv_571;
+typedef std::tuple<var, double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_572;
+typedef std::tuple<var, double, std::vector<double>, double, empty, empty> type_vv_573;
+typedef std::tuple<var, double, std::vector<double>, std::vector<double>, empty, empty> type_vv_574;
+typedef std::tuple<var, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_575;
+typedef std::tuple<var, double, std::vector<double>, var, empty, empty> type_vv_576;
+typedef std::tuple<var, double, std::vector<double>, std::vector<var>, empty, empty> type_vv_577;
+typedef std::tuple<var, double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_578;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_579;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_580;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_581;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_582;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_583;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_584;
+typedef std::tuple<var, double, var, double, empty, empty> type_vv_585;
+typedef std::tuple<var, double, var, std::vector<double>, empty, empty> type_vv_586;
+typedef std::tuple<var, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_587;
+typedef std::tuple<var, double, var, var, empty, empty> type_vv_588;
+typedef std::tuple<var, double, var, std::vector<var>, empty, empty> type_vv_589;
+typedef std::tuple<var, double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_590;
+typedef std::tuple<var, double, std::vector<var>, double, empty, empty> type_vv_591;
+typedef std::tuple<var, double, std::vector<var>, std::vector<double>, empty, empty> type_vv_592;
+typedef std::tuple<var, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_593;
+typedef std::tuple<var, double, std::vector<var>, var, empty, empty> type_vv_594;
+typedef std::tuple<var, double, std::vector<var>, std::vector<var>, empty, empty> type_vv_595;
+typedef std::tuple<var, double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_596;
+typedef std::tuple<var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_597;
+typedef std::tuple<var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_598;
+typedef std::tuple<var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_599;
+
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_500> AgradDistributionSkewDoubleExponential_vv_500;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_501> AgradDistributionSkewDoubleExponential_vv_501;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_502> AgradDistributionSkewDoubleExponential_vv_502;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_503> AgradDistributionSkewDoubleExponential_vv_503;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_504> AgradDistributionSkewDoubleExponential_vv_504;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_505> AgradDistributionSkewDoubleExponential_vv_505;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_506> AgradDistributionSkewDoubleExponential_vv_506;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_507> AgradDistributionSkewDoubleExponential_vv_507;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_508> AgradDistributionSkewDoubleExponential_vv_508;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_509> AgradDistributionSkewDoubleExponential_vv_509;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_510> AgradDistributionSkewDoubleExponential_vv_510;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_511> AgradDistributionSkewDoubleExponential_vv_511;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_512> AgradDistributionSkewDoubleExponential_vv_512;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_513> AgradDistributionSkewDoubleExponential_vv_513;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_514> AgradDistributionSkewDoubleExponential_vv_514;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_515> AgradDistributionSkewDoubleExponential_vv_515;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_516> AgradDistributionSkewDoubleExponential_vv_516;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_517> AgradDistributionSkewDoubleExponential_vv_517;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_518> AgradDistributionSkewDoubleExponential_vv_518;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_519> AgradDistributionSkewDoubleExponential_vv_519;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_520> AgradDistributionSkewDoubleExponential_vv_520;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_521> AgradDistributionSkewDoubleExponential_vv_521;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_522> AgradDistributionSkewDoubleExponential_vv_522;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_523> AgradDistributionSkewDoubleExponential_vv_523;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_524> AgradDistributionSkewDoubleExponential_vv_524;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_525> AgradDistributionSkewDoubleExponential_vv_525;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_526> AgradDistributionSkewDoubleExponential_vv_526;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_527> AgradDistributionSkewDoubleExponential_vv_527;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_528> AgradDistributionSkewDoubleExponential_vv_528;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_529> AgradDistributionSkewDoubleExponential_vv_529;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_530> AgradDistributionSkewDoubleExponential_vv_530;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_531> AgradDistributionSkewDoubleExponential_vv_531;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_532> AgradDistributionSkewDoubleExponential_vv_532;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_533> AgradDistributionSkewDoubleExponential_vv_533;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_534> AgradDistributionSkewDoubleExponential_vv_534;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_535> AgradDistributionSkewDoubleExponential_vv_535;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_536> AgradDistributionSkewDoubleExponential_vv_536;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_537> AgradDistributionSkewDoubleExponential_vv_537;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_538> AgradDistributionSkewDoubleExponential_vv_538;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_539> AgradDistributionSkewDoubleExponential_vv_539;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_540> AgradDistributionSkewDoubleExponential_vv_540;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_541> AgradDistributionSkewDoubleExponential_vv_541;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_542> AgradDistributionSkewDoubleExponential_vv_542;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_543> AgradDistributionSkewDoubleExponential_vv_543;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_544> AgradDistributionSkewDoubleExponential_vv_544;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_545> AgradDistributionSkewDoubleExponential_vv_545;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_546> AgradDistributionSkewDoubleExponential_vv_546;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_547> AgradDistributionSkewDoubleExponential_vv_547;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_548> AgradDistributionSkewDoubleExponential_vv_548;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_549> AgradDistributionSkewDoubleExponential_vv_549;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_550> AgradDistributionSkewDoubleExponential_vv_550;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_551> AgradDistributionSkewDoubleExponential_vv_551;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_552> AgradDistributionSkewDoubleExponential_vv_552;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_553> AgradDistributionSkewDoubleExponential_vv_553;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_554> AgradDistributionSkewDoubleExponential_vv_554;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_555> AgradDistributionSkewDoubleExponential_vv_555;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_556> AgradDistributionSkewDoubleExponential_vv_556;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_557> AgradDistributionSkewDoubleExponential_vv_557;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_558> AgradDistributionSkewDoubleExponential_vv_558;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_559> AgradDistributionSkewDoubleExponential_vv_559;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_560> AgradDistributionSkewDoubleExponential_vv_560;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_561> AgradDistributionSkewDoubleExponential_vv_561;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_562> AgradDistributionSkewDoubleExponential_vv_562;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_563> AgradDistributionSkewDoubleExponential_vv_563;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_564> AgradDistributionSkewDoubleExponential_vv_564;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_565> AgradDistributionSkewDoubleExponential_vv_565;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_566> AgradDistributionSkewDoubleExponential_vv_566;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_567> AgradDistributionSkewDoubleExponential_vv_567;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_568> AgradDistributionSkewDoubleExponential_vv_568;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_569> AgradDistributionSkewDoubleExponential_vv_569;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_570> AgradDistributionSkewDoubleExponential_vv_570;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_571> AgradDistributionSkewDoubleExponential_vv_571;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_572> AgradDistributionSkewDoubleExponential_vv_572;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_573> AgradDistributionSkewDoubleExponential_vv_573;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_574> AgradDistributionSkewDoubleExponential_vv_574;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_575> AgradDistributionSkewDoubleExponential_vv_575;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_576> AgradDistributionSkewDoubleExponential_vv_576;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_577> AgradDistributionSkewDoubleExponential_vv_577;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_578> AgradDistributionSkewDoubleExponential_vv_578;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_579> AgradDistributionSkewDoubleExponential_vv_579;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_580> AgradDistributionSkewDoubleExponential_vv_580;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_581> AgradDistributionSkewDoubleExponential_vv_581;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_582> AgradDistributionSkewDoubleExponential_vv_582;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_583> AgradDistributionSkewDoubleExponential_vv_583;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_584> AgradDistributionSkewDoubleExponential_vv_584;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_585> AgradDistributionSkewDoubleExponential_vv_585;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_586> AgradDistributionSkewDoubleExponential_vv_586;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_587> AgradDistributionSkewDoubleExponential_vv_587;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_588> AgradDistributionSkewDoubleExponential_vv_588;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_589> AgradDistributionSkewDoubleExponential_vv_589;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_590> AgradDistributionSkewDoubleExponential_vv_590;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_591> AgradDistributionSkewDoubleExponential_vv_591;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_592> AgradDistributionSkewDoubleExponential_vv_592;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_593> AgradDistributionSkewDoubleExponential_vv_593;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_594> AgradDistributionSkewDoubleExponential_vv_594;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_595> AgradDistributionSkewDoubleExponential_vv_595;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_596> AgradDistributionSkewDoubleExponential_vv_596;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_597> AgradDistributionSkewDoubleExponential_vv_597;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_598> AgradDistributionSkewDoubleExponential_vv_598;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_599> AgradDistributionSkewDoubleExponential_vv_599;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_500, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_500);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_501, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_501);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_502, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_502);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_503, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_503);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_504, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_504);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_505, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_505);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_506, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_506);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_507, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_507);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_508, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_508);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_509, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_509);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_510, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_510);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_511, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_511);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_512, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_512);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_513, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_513);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_514, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_514);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_515, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_515);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_516, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_516);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_517, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_517);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_518, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_518);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_519, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_519);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_520, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_520);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_521, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_521);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_522, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_522);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_523, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_523);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_524, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_524);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_525, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_525);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_526, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_526);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_527, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_527);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_528, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_528);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_529, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_529);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_530, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_530);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_531, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_531);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_532, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_532);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_533, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_533);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_534, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_534);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_535, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_535);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_536, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_536);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_537, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_537);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_538, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_538);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_539, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_539);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_540, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_540);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_541, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_541);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_542, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_542);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_543, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_543);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_544, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_544);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_545, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_545);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_546, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_546);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_547, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_547);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_548, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_548);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_549, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_549);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_550, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_550);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_551, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_551);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_552, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_552);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_553, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_553);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_554, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_554);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_555, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_555);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_556, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_556);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_557, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_557);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_558, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_558);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_559, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_559);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_560, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_560);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_561, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_561);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_562, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_562);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_563, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_563);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_564, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_564);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_565, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_565);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_566, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_566);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_567, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_567);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_568, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_568);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_569, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_569);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_570, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_570);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_571, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_571);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_572, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_572);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_573, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_573);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_574, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_574);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_575, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_575);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_576, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_576);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_577, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_577);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_578, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_578);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_579, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_579);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_580, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_580);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_581, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_581);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_582, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_582);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_583, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_583);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_584, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_584);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_585, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_585);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_586, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_586);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_587, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_587);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_588, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_588);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_589, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_589);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_590, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_590);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_591, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_591);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_592, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_592);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_593, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_593);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_594, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_594);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_595, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_595);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_596, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_596);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_597, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_597);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_598, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_598);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_599, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_599);
+
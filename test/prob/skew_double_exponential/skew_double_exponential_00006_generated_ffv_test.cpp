@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/skew_double_exponential/skew_double_exponential_test.hpp>
+
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_600;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_601;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_602;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, double, double, empty, empty> type_ffv_603;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, double, std::vector<double>, empty, empty> type_ffv_604;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_605;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, double, fvar<fvar<var> >, empty, empty> type_ffv_606;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_607;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_608;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<double>, double, empty, empty> type_ffv_609;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_610;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_611;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_612;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_613;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_614;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_615;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_616;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_617;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_618;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_619;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_620;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, double, empty, empty> type_ffv_621;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_622;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_623;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_624;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_625;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_626;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_627;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_628;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_629;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_630;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_631;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_632;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_633;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_634;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_635;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_636;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_637;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_638;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty> type_ffv_639;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_ffv_640;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_641;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_642;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_643;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_644;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_ffv_645;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_646;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_647;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_648;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_649;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_650;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_651;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_652;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_653;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_654;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_655;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_656;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_657;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_658;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_659;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_660;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_661;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_662;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_663;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_664;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_665;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_666;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_667;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_668;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_669;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_670;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_671;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_672;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_673;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_674;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, double, double, empty, empty> type_ffv_675;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, double, std::vector<double>, empty, empty> type_ffv_676;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_677;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, double, fvar<fvar<var> >, empty, empty> type_ffv_678;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_679;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_680;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, double, empty, empty> type_ffv_681;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty, empty> type_ffv_682;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_683;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_684;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_685;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_686;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_687;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_688;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_689;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_690;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_691;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_692;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, double, empty, empty> type_ffv_693;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_694;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_695;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_696;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_697;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_698;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_699;
+
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_600> AgradDistributionSkewDoubleExponential_ffv_600;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_601> AgradDistributionSkewDoubleExponential_ffv_601;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_602> AgradDistributionSkewDoubleExponential_ffv_602;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_603> AgradDistributionSkewDoubleExponential_ffv_603;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_604> AgradDistributionSkewDoubleExponential_ffv_604;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_605> AgradDistributionSkewDoubleExponential_ffv_605;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_606> AgradDistributionSkewDoubleExponential_ffv_606;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_607> AgradDistributionSkewDoubleExponential_ffv_607;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_608> AgradDistributionSkewDoubleExponential_ffv_608;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_609> AgradDistributionSkewDoubleExponential_ffv_609;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_610> AgradDistributionSkewDoubleExponential_ffv_610;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_611> AgradDistributionSkewDoubleExponential_ffv_611;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_612> AgradDistributionSkewDoubleExponential_ffv_612;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_613> AgradDistributionSkewDoubleExponential_ffv_613;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_614> AgradDistributionSkewDoubleExponential_ffv_614;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_615> AgradDistributionSkewDoubleExponential_ffv_615;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_616> AgradDistributionSkewDoubleExponential_ffv_616;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_617> AgradDistributionSkewDoubleExponential_ffv_617;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_618> AgradDistributionSkewDoubleExponential_ffv_618;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_619> AgradDistributionSkewDoubleExponential_ffv_619;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_620> AgradDistributionSkewDoubleExponential_ffv_620;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_621> AgradDistributionSkewDoubleExponential_ffv_621;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_622> AgradDistributionSkewDoubleExponential_ffv_622;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_623> AgradDistributionSkewDoubleExponential_ffv_623;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_624> AgradDistributionSkewDoubleExponential_ffv_624;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_625> AgradDistributionSkewDoubleExponential_ffv_625;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_626> AgradDistributionSkewDoubleExponential_ffv_626;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_627> AgradDistributionSkewDoubleExponential_ffv_627;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_628> AgradDistributionSkewDoubleExponential_ffv_628;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_629> AgradDistributionSkewDoubleExponential_ffv_629;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_630> AgradDistributionSkewDoubleExponential_ffv_630;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_631> AgradDistributionSkewDoubleExponential_ffv_631;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_632> AgradDistributionSkewDoubleExponential_ffv_632;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_633> AgradDistributionSkewDoubleExponential_ffv_633;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_634> AgradDistributionSkewDoubleExponential_ffv_634;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_635> AgradDistributionSkewDoubleExponential_ffv_635;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_636> AgradDistributionSkewDoubleExponential_ffv_636;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_637> AgradDistributionSkewDoubleExponential_ffv_637;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_638> AgradDistributionSkewDoubleExponential_ffv_638;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_639> AgradDistributionSkewDoubleExponential_ffv_639;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_640> AgradDistributionSkewDoubleExponential_ffv_640;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_641> AgradDistributionSkewDoubleExponential_ffv_641;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_642> AgradDistributionSkewDoubleExponential_ffv_642;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_643> AgradDistributionSkewDoubleExponential_ffv_643;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_644> AgradDistributionSkewDoubleExponential_ffv_644;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_645> AgradDistributionSkewDoubleExponential_ffv_645;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_646> AgradDistributionSkewDoubleExponential_ffv_646;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_647> AgradDistributionSkewDoubleExponential_ffv_647;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_648> AgradDistributionSkewDoubleExponential_ffv_648;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_649> AgradDistributionSkewDoubleExponential_ffv_649;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_650> AgradDistributionSkewDoubleExponential_ffv_650;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_651> AgradDistributionSkewDoubleExponential_ffv_651;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_652> AgradDistributionSkewDoubleExponential_ffv_652;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_653> AgradDistributionSkewDoubleExponential_ffv_653;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_654> AgradDistributionSkewDoubleExponential_ffv_654;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_655> AgradDistributionSkewDoubleExponential_ffv_655;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_656> AgradDistributionSkewDoubleExponential_ffv_656;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_657> AgradDistributionSkewDoubleExponential_ffv_657;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_658> AgradDistributionSkewDoubleExponential_ffv_658;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_659> AgradDistributionSkewDoubleExponential_ffv_659;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_660> AgradDistributionSkewDoubleExponential_ffv_660;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_661> AgradDistributionSkewDoubleExponential_ffv_661;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_662> AgradDistributionSkewDoubleExponential_ffv_662;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_663> AgradDistributionSkewDoubleExponential_ffv_663;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_664> AgradDistributionSkewDoubleExponential_ffv_664;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_665> AgradDistributionSkewDoubleExponential_ffv_665;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_666> AgradDistributionSkewDoubleExponential_ffv_666;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_667> AgradDistributionSkewDoubleExponential_ffv_667;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_668> AgradDistributionSkewDoubleExponential_ffv_668;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_669> AgradDistributionSkewDoubleExponential_ffv_669;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_670> AgradDistributionSkewDoubleExponential_ffv_670;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_671> AgradDistributionSkewDoubleExponential_ffv_671;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_672> AgradDistributionSkewDoubleExponential_ffv_672;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_673> AgradDistributionSkewDoubleExponential_ffv_673;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_674> AgradDistributionSkewDoubleExponential_ffv_674;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_675> AgradDistributionSkewDoubleExponential_ffv_675;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_676> AgradDistributionSkewDoubleExponential_ffv_676;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_677> AgradDistributionSkewDoubleExponential_ffv_677;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_678> AgradDistributionSkewDoubleExponential_ffv_678;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_679> AgradDistributionSkewDoubleExponential_ffv_679;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_680> AgradDistributionSkewDoubleExponential_ffv_680;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_681> AgradDistributionSkewDoubleExponential_ffv_681;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_682> AgradDistributionSkewDoubleExponential_ffv_682;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_683> AgradDistributionSkewDoubleExponential_ffv_683;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_684> AgradDistributionSkewDoubleExponential_ffv_684;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_685> AgradDistributionSkewDoubleExponential_ffv_685;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_686> AgradDistributionSkewDoubleExponential_ffv_686;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_687> AgradDistributionSkewDoubleExponential_ffv_687;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_688> AgradDistributionSkewDoubleExponential_ffv_688;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_689> AgradDistributionSkewDoubleExponential_ffv_689;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_690> AgradDistributionSkewDoubleExponential_ffv_690;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_691> AgradDistributionSkewDoubleExponential_ffv_691;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_692> AgradDistributionSkewDoubleExponential_ffv_692;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_693> AgradDistributionSkewDoubleExponential_ffv_693;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_694> AgradDistributionSkewDoubleExponential_ffv_694;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_695> AgradDistributionSkewDoubleExponential_ffv_695;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_696> AgradDistributionSkewDoubleExponential_ffv_696;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_697> AgradDistributionSkewDoubleExponential_ffv_697;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_698> AgradDistributionSkewDoubleExponential_ffv_698;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_699> AgradDistributionSkewDoubleExponential_ffv_699;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_600, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_600);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_601, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_601);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_602, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_602);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_603, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_603);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_604, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_604);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_605, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_605);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_606, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_606);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_607, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_607);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_608, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_608);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_609, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_609);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_610, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_610);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_611, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_611);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_612, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_612);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_613, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_613);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_614, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_614);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_615, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_615);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_616, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_616);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_617, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_617);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_618, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_618);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_619, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_619);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_620, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_620);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_621, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_621);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_622, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_622);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_623, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_623);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_624, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_624);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_625, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_625);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_626, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_626);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_627, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_627);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_628, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_628);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_629, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_629);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_630, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_630);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_631, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_631);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_632, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_632);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_633, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_633);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_634, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_634);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_635, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_635);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_636, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_636);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_637, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_637);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_638, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_638);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_639, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_639);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_640, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_640);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_641, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_641);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_642, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_642);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_643, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_643);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_644, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_644);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_645, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_645);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_646, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_646);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_647, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_647);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_648, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_648);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_649, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_649);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_650, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_650);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_651, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_651);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_652, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_652);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_653, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_653);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_654, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_654);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_655, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_655);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_656, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_656);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_657, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_657);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_658, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_658);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_659, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_659);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_660, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_660);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_661, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_661);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_662, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_662);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_663, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_663);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_664, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_664);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_665, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_665);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_666, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_666);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_667, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_667);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_668, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_668);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_669, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_669);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_670, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_670);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_671, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_671);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_672, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_672);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_673, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_673);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_674, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_674);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_675, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_675);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_676, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_676);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_677, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_677);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_678, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_678);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_679, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_679);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_680, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_680);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_681, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_681);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_682, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_682);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_683, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_683);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_684, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_684);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_685, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_685);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_686, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_686);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_687, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_687);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_688, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_688);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_689, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_689);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_690, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_690);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_691, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_691);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_692, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_692);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_693, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_693);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_694, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_694);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_695, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_695);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_696, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_696);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_697, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_697);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_698, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_698);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_699, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_699);
+
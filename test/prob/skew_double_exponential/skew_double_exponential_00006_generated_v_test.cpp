@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/skew_double_exponential/skew_double_exponential_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, double, empty, empty> type_v_600;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_v_601;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_602;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, var, empty, empty> type_v_603;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_v_604;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_605;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_606;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_607;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_608;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_609;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_610;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_611;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_612;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_613;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_614;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_615;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_616;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_617;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_618;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_619;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_620;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_621;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_622;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_623;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_624;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_625;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_626;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_627;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_628;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_629;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_630;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_631;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_632;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_633;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_634;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_635;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_636;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_637;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_638;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_639;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_640;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_641;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_642;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_643;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_644;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_645;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_646;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_647;
+typedef std::tuple<var, double, double, double, empty, empty> type_v_648;
+typedef std::tuple<var, double, double, std::vector<double>, empty, empty> type_v_649;
+typedef std::tuple<var, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_650;
+typedef std::tuple<var, double, double, var, empty, empty> type_v_651;
+typedef std::tuple<var, double, double, std::vector<var>, empty, empty> type_v_652;
+typedef std::tuple<var, double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_653;
+typedef std::tuple<var, double, std::vector<double>, double, empty, empty> type_v_654;
+typedef std::tuple<var, double, std::vector<double>, std::vector<double>, empty, empty> type_v_655;
+typedef std::tuple<var, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_656;
+typedef std::tuple<var, double, std::vector<double>, var, empty, empty> type_v_657;
+typedef std::tuple<var, double, std::vector<double>, std::vector<var>, empty, empty> type_v_658;
+typedef std::tuple<var, double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_659;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_660;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_661;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_662;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_663;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_664;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_665;
+typedef std::tuple<var, double, var, double, empty, empty> type_v_666;
+typedef std::tuple<var, double, var, std::vector<double>, empty, empty> type_v_667;
+typedef std::tuple<var, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_668;
+typedef std::tuple<var, double, var, var, empty, empty> type_v_669;
+typedef std::tuple<var, double, var, std::vector<var>, empty, empty> type_v_670;
+typedef std::tuple<var, double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_671;
+typedef std::tuple<var, double, std::vector<var>, double, empty, empty> type_v_672;
+typedef std::tuple<var, double, std::vector<var>, std::vector<double>, empty, empty> type_v_673;
+typedef std::tuple<var, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_674;
+typedef std::tuple<var, double, std::vector<var>, var, empty, empty> type_v_675;
+typedef std::tuple<var, double, std::vector<var>, std::vector<var>, empty, empty> type_v_676;
+typedef std::tuple<var, double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_677;
+typedef std::tuple<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_678;
+typedef std::tuple<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_679;
+typedef std::tuple<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_680;
+typedef std::tuple<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_681;
+typedef std::tuple<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_682;
+typedef std::tuple<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_683;
+typedef std::tuple<var, std::vector<double>, double, double, empty, empty> type_v_684;
+typedef std::tuple<var, std::vector<double>, double, std::vector<double>, empty, empty> type_v_685;
+typedef std::tuple<var, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_686;
+typedef std::tuple<var, std::vector<double>, double, var, empty, empty> type_v_687;
+typedef std::tuple<var, std::vector<double>, double, std::vector<var>, empty, empty> type_v_688;
+typedef std::tuple<var, std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_689;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, double, empty, empty> type_v_690;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, std::vector<double>, empty, empty> type_v_691;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_692;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, var, empty, empty> type_v_693;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_v_694;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_695;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_696;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_697;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_698;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_699;
+
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_600> AgradDistributionSkewDoubleExponential_v_600;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_601> AgradDistributionSkewDoubleExponential_v_601;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_602> AgradDistributionSkewDoubleExponential_v_602;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_603> AgradDistributionSkewDoubleExponential_v_603;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_604> AgradDistributionSkewDoubleExponential_v_604;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_605> AgradDistributionSkewDoubleExponential_v_605;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_606> AgradDistributionSkewDoubleExponential_v_606;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_607> AgradDistributionSkewDoubleExponential_v_607;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_608> AgradDistributionSkewDoubleExponential_v_608;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_609> AgradDistributionSkewDoubleExponential_v_609;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_610> AgradDistributionSkewDoubleExponential_v_610;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_611> AgradDistributionSkewDoubleExponential_v_611;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_612> AgradDistributionSkewDoubleExponential_v_612;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_613> AgradDistributionSkewDoubleExponential_v_613;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_614> AgradDistributionSkewDoubleExponential_v_614;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_615> AgradDistributionSkewDoubleExponential_v_615;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_616> AgradDistributionSkewDoubleExponential_v_616;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_617> AgradDistributionSkewDoubleExponential_v_617;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_618> AgradDistributionSkewDoubleExponential_v_618;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_619> AgradDistributionSkewDoubleExponential_v_619;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_620> AgradDistributionSkewDoubleExponential_v_620;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_621> AgradDistributionSkewDoubleExponential_v_621;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_622> AgradDistributionSkewDoubleExponential_v_622;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_623> AgradDistributionSkewDoubleExponential_v_623;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_624> AgradDistributionSkewDoubleExponential_v_624;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_625> AgradDistributionSkewDoubleExponential_v_625;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_626> AgradDistributionSkewDoubleExponential_v_626;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_627> AgradDistributionSkewDoubleExponential_v_627;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_628> AgradDistributionSkewDoubleExponential_v_628;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_629> AgradDistributionSkewDoubleExponential_v_629;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_630> AgradDistributionSkewDoubleExponential_v_630;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_631> AgradDistributionSkewDoubleExponential_v_631;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_632> AgradDistributionSkewDoubleExponential_v_632;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_633> AgradDistributionSkewDoubleExponential_v_633;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_634> AgradDistributionSkewDoubleExponential_v_634;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_635> AgradDistributionSkewDoubleExponential_v_635;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_636> AgradDistributionSkewDoubleExponential_v_636;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_637> AgradDistributionSkewDoubleExponential_v_637;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_638> AgradDistributionSkewDoubleExponential_v_638;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_639> AgradDistributionSkewDoubleExponential_v_639;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_640> AgradDistributionSkewDoubleExponential_v_640;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_641> AgradDistributionSkewDoubleExponential_v_641;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_642> AgradDistributionSkewDoubleExponential_v_642;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_643> AgradDistributionSkewDoubleExponential_v_643;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_644> AgradDistributionSkewDoubleExponential_v_644;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_645> AgradDistributionSkewDoubleExponential_v_645;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_646> AgradDistributionSkewDoubleExponential_v_646;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_647> AgradDistributionSkewDoubleExponential_v_647;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_648> AgradDistributionSkewDoubleExponential_v_648;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_649> AgradDistributionSkewDoubleExponential_v_649;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_650> AgradDistributionSkewDoubleExponential_v_650;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_651> AgradDistributionSkewDoubleExponential_v_651;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_652> AgradDistributionSkewDoubleExponential_v_652;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_653> AgradDistributionSkewDoubleExponential_v_653;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_654> AgradDistributionSkewDoubleExponential_v_654;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_655> AgradDistributionSkewDoubleExponential_v_655;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_656> AgradDistributionSkewDoubleExponential_v_656;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_657> AgradDistributionSkewDoubleExponential_v_657;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_658> AgradDistributionSkewDoubleExponential_v_658;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_659> AgradDistributionSkewDoubleExponential_v_659;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_660> AgradDistributionSkewDoubleExponential_v_660;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_661> AgradDistributionSkewDoubleExponential_v_661;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_662> AgradDistributionSkewDoubleExponential_v_662;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_663> AgradDistributionSkewDoubleExponential_v_663;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_664> AgradDistributionSkewDoubleExponential_v_664;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_665> AgradDistributionSkewDoubleExponential_v_665;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_666> AgradDistributionSkewDoubleExponential_v_666;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_667> AgradDistributionSkewDoubleExponential_v_667;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_668> AgradDistributionSkewDoubleExponential_v_668;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_669> AgradDistributionSkewDoubleExponential_v_669;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_670> AgradDistributionSkewDoubleExponential_v_670;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_671> AgradDistributionSkewDoubleExponential_v_671;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_672> AgradDistributionSkewDoubleExponential_v_672;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_673> AgradDistributionSkewDoubleExponential_v_673;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_674> AgradDistributionSkewDoubleExponential_v_674;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_675> AgradDistributionSkewDoubleExponential_v_675;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_676> AgradDistributionSkewDoubleExponential_v_676;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_677> AgradDistributionSkewDoubleExponential_v_677;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_678> AgradDistributionSkewDoubleExponential_v_678;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_679> AgradDistributionSkewDoubleExponential_v_679;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_680> AgradDistributionSkewDoubleExponential_v_680;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_681> AgradDistributionSkewDoubleExponential_v_681;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_682> AgradDistributionSkewDoubleExponential_v_682;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_683> AgradDistributionSkewDoubleExponential_v_683;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_684> AgradDistributionSkewDoubleExponential_v_684;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_685> AgradDistributionSkewDoubleExponential_v_685;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_686> AgradDistributionSkewDoubleExponential_v_686;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_687> AgradDistributionSkewDoubleExponential_v_687;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_688> AgradDistributionSkewDoubleExponential_v_688;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_689> AgradDistributionSkewDoubleExponential_v_689;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_690> AgradDistributionSkewDoubleExponential_v_690;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_691> AgradDistributionSkewDoubleExponential_v_691;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_692> AgradDistributionSkewDoubleExponential_v_692;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_693> AgradDistributionSkewDoubleExponential_v_693;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_694> AgradDistributionSkewDoubleExponential_v_694;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_695> AgradDistributionSkewDoubleExponential_v_695;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_696> AgradDistributionSkewDoubleExponential_v_696;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_697> AgradDistributionSkewDoubleExponential_v_697;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_698> AgradDistributionSkewDoubleExponential_v_698;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_699> AgradDistributionSkewDoubleExponential_v_699;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_600, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_600);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_601, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_601);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_602, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_602);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_603, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_603);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_604, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_604);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_605, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_605);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_606, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_606);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_607, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_607);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_608, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_608);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_609, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_609);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_610, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_610);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_611, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_611);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_612, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_612);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_613, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_613);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_614, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_614);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_615, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_615);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_616, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_616);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_617, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_617);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_618, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_618);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_619, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_619);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_620, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_620);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_621, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_621);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_622, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_622);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_623, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_623);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_624, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_624);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_625, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_625);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_626, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_626);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_627, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_627);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_628, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_628);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_629, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_629);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_630, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_630);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_631, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_631);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_632, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_632);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_633, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_633);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_634, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_634);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_635, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_635);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_636, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_636);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_637, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_637);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_638, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_638);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_639, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_639);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_640, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_640);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_641, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_641);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_642, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_642);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_643, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_643);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_644, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_644);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_645, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_645);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_646, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_646);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_647, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_647);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_648, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_648);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_649, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_649);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_650, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_650);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_651, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_651);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_652, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_652);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_653, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_653);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_654, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_654);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_655, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_655);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_656, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_656);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_657, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_657);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_658, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_658);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_659, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_659);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_660, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_660);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_661, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_661);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_662, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_662);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_663, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_663);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_664, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_664);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_665, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_665);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_666, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_666);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_667, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_667);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_668, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_668);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_669, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_669);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_670, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_670);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_671, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_671);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_672, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_672);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_673, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_673);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_674, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_674);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_675, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_675);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_676, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_676);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_677, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_677);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_678, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_678);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_679, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_679);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_680, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_680);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_681, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_681);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_682, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_682);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_683, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_683);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_684, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_684);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_685, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_685);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_686, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_686);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_687, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_687);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_688, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_688);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_689, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_689);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_690, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_690);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_691, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_691);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_692, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_692);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_693, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_693);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_694, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_694);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_695, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_695);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_696, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_696);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_697, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_697);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_698, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_698);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_699, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_699);
+
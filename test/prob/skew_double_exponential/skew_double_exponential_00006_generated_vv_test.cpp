@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/skew_double_exponential/skew_double_exponential_test.hpp>
+
+typedef std::tuple<var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_600;
+typedef std::tuple<var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_601;
+typedef std::tuple<var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_602;
+typedef std::tuple<var, std::vector<double>, double, double, empty, empty> type_vv_603;
+typedef std::tuple<var, std::vector<double>, double, std::vector<double>, empty, empty> type_vv_604;
+typedef std::tuple<var, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_605;
+typedef std::tuple<var, std::vector<double>, double, var, empty, empty> type_vv_606;
+typedef std::tuple<var, std::vector<double>, double, std::vector<var>, empty, empty> type_vv_607;
+typedef std::tuple<var, std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_608;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, double, empty, empty> type_vv_609;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, std::vector<double>, empty, empty> type_vv_610;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_611;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, var, empty, empty> type_vv_612;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_vv_613;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_614;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_615;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_616;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_617;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_618;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_619;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_620;
+typedef std::tuple<var, std::vector<double>, var, double, empty, empty> type_vv_621;
+typedef std::tuple<var, std::vector<double>, var, std::vector<double>, empty, empty> type_vv_622;
+typedef std::tuple<var, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_623;
+typedef std::tuple<var, std::vector<double>, var, var, empty, empty> type_vv_624;
+typedef std::tuple<var, std::vector<double>, var, std::vector<var>, empty, empty> type_vv_625;
+typedef std::tuple<var, std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_626;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, double, empty, empty> type_vv_627;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_vv_628;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_629;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, var, empty, empty> type_vv_630;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_vv_631;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_632;
+typedef std::tuple<var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_633;
+typedef std::tuple<var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_634;
+typedef std::tuple<var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_635;
+typedef std::tuple<var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_636;
+typedef std::tuple<var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_637;
+typedef std::tuple<var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_638;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty> type_vv_639;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_vv_640;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_641;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_vv_642;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_vv_643;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_644;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_vv_645;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_vv_646;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_647;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_vv_648;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_vv_649;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_650;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_651;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_652;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_653;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_654;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_655;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_656;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_vv_657;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_vv_658;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_659;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_vv_660;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_vv_661;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_662;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_vv_663;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_vv_664;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_665;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_vv_666;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_vv_667;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_668;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_669;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_670;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_671;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_672;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_673;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_674;
+typedef std::tuple<var, var, double, double, empty, empty> type_vv_675;
+typedef std::tuple<var, var, double, std::vector<double>, empty, empty> type_vv_676;
+typedef std::tuple<var, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_677;
+typedef std::tuple<var, var, double, var, empty, empty> type_vv_678;
+typedef std::tuple<var, var, double, std::vector<var>, empty, empty> type_vv_679;
+typedef std::tuple<var, var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_680;
+typedef std::tuple<var, var, std::vector<double>, double, empty, empty> type_vv_681;
+typedef std::tuple<var, var, std::vector<double>, std::vector<double>, empty, empty> type_vv_682;
+typedef std::tuple<var, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_683;
+typedef std::tuple<var, var, std::vector<double>, var, empty, empty> type_vv_684;
+typedef std::tuple<var, var, std::vector<double>, std::vector<var>, empty, empty> type_vv_685;
+typedef std::tuple<var, var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_686;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_687;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_688;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_689;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_690;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_691;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_692;
+typedef std::tuple<var, var, var, double, empty, empty> type_vv_693;
+typedef std::tuple<var, var, var, std::vector<double>, empty, empty> type_vv_694;
+typedef std::tuple<var, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_695;
+typedef std::tuple<var, var, var, var, empty, empty> type_vv_696;
+typedef std::tuple<var, var, var, std::vector<var>, empty, empty> type_vv_697;
+typedef std::tuple<var, var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_698;
+typedef std::tuple<var, var, std::vector<var>, double, empty, empty> type_vv_699;
+
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_600> AgradDistributionSkewDoubleExponential_vv_600;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_601> AgradDistributionSkewDoubleExponential_vv_601;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_602> AgradDistributionSkewDoubleExponential_vv_602;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_603> AgradDistributionSkewDoubleExponential_vv_603;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_604> AgradDistributionSkewDoubleExponential_vv_604;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_605> AgradDistributionSkewDoubleExponential_vv_605;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_606> AgradDistributionSkewDoubleExponential_vv_606;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_607> AgradDistributionSkewDoubleExponential_vv_607;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_608> AgradDistributionSkewDoubleExponential_vv_608;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_609> AgradDistributionSkewDoubleExponential_vv_609;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_610> AgradDistributionSkewDoubleExponential_vv_610;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_611> AgradDistributionSkewDoubleExponential_vv_611;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_612> AgradDistributionSkewDoubleExponential_vv_612;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_613> AgradDistributionSkewDoubleExponential_vv_613;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_614> AgradDistributionSkewDoubleExponential_vv_614;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_615> AgradDistributionSkewDoubleExponential_vv_615;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_616> AgradDistributionSkewDoubleExponential_vv_616;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_617> AgradDistributionSkewDoubleExponential_vv_617;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_618> AgradDistributionSkewDoubleExponential_vv_618;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_619> AgradDistributionSkewDoubleExponential_vv_619;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_620> AgradDistributionSkewDoubleExponential_vv_620;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_621> AgradDistributionSkewDoubleExponential_vv_621;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_622> AgradDistributionSkewDoubleExponential_vv_622;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_623> AgradDistributionSkewDoubleExponential_vv_623;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_624> AgradDistributionSkewDoubleExponential_vv_624;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_625> AgradDistributionSkewDoubleExponential_vv_625;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_626> AgradDistributionSkewDoubleExponential_vv_626;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_627> AgradDistributionSkewDoubleExponential_vv_627;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_628> AgradDistributionSkewDoubleExponential_vv_628;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_629> AgradDistributionSkewDoubleExponential_vv_629;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_630> AgradDistributionSkewDoubleExponential_vv_630;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_631> AgradDistributionSkewDoubleExponential_vv_631;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_632> AgradDistributionSkewDoubleExponential_vv_632;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_633> AgradDistributionSkewDoubleExponential_vv_633;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_634> AgradDistributionSkewDoubleExponential_vv_634;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_635> AgradDistributionSkewDoubleExponential_vv_635;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_636> AgradDistributionSkewDoubleExponential_vv_636;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_637> AgradDistributionSkewDoubleExponential_vv_637;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_638> AgradDistributionSkewDoubleExponential_vv_638;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_639> AgradDistributionSkewDoubleExponential_vv_639;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_640> AgradDistributionSkewDoubleExponential_vv_640;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_641> AgradDistributionSkewDoubleExponential_vv_641;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_642> AgradDistributionSkewDoubleExponential_vv_642;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_643> AgradDistributionSkewDoubleExponential_vv_643;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_644> AgradDistributionSkewDoubleExponential_vv_644;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_645> AgradDistributionSkewDoubleExponential_vv_645;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_646> AgradDistributionSkewDoubleExponential_vv_646;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_647> AgradDistributionSkewDoubleExponential_vv_647;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_648> AgradDistributionSkewDoubleExponential_vv_648;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_649> AgradDistributionSkewDoubleExponential_vv_649;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_650> AgradDistributionSkewDoubleExponential_vv_650;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_651> AgradDistributionSkewDoubleExponential_vv_651;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_652> AgradDistributionSkewDoubleExponential_vv_652;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_653> AgradDistributionSkewDoubleExponential_vv_653;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_654> AgradDistributionSkewDoubleExponential_vv_654;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_655> AgradDistributionSkewDoubleExponential_vv_655;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_656> AgradDistributionSkewDoubleExponential_vv_656;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_657> AgradDistributionSkewDoubleExponential_vv_657;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_658> AgradDistributionSkewDoubleExponential_vv_658;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_659> AgradDistributionSkewDoubleExponential_vv_659;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_660> AgradDistributionSkewDoubleExponential_vv_660;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_661> AgradDistributionSkewDoubleExponential_vv_661;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_662> AgradDistributionSkewDoubleExponential_vv_662;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_663> AgradDistributionSkewDoubleExponential_vv_663;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_664> AgradDistributionSkewDoubleExponential_vv_664;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_665> AgradDistributionSkewDoubleExponential_vv_665;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_666> AgradDistributionSkewDoubleExponential_vv_666;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_667> AgradDistributionSkewDoubleExponential_vv_667;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_668> AgradDistributionSkewDoubleExponential_vv_668;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_669> AgradDistributionSkewDoubleExponential_vv_669;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_670> AgradDistributionSkewDoubleExponential_vv_670;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_671> AgradDistributionSkewDoubleExponential_vv_671;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_672> AgradDistributionSkewDoubleExponential_vv_672;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_673> AgradDistributionSkewDoubleExponential_vv_673;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_674> AgradDistributionSkewDoubleExponential_vv_674;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_675> AgradDistributionSkewDoubleExponential_vv_675;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_676> AgradDistributionSkewDoubleExponential_vv_676;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_677> AgradDistributionSkewDoubleExponential_vv_677;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_678> AgradDistributionSkewDoubleExponential_vv_678;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_679> AgradDistributionSkewDoubleExponential_vv_679;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_680> AgradDistributionSkewDoubleExponential_vv_680;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_681> AgradDistributionSkewDoubleExponential_vv_681;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_682> AgradDistributionSkewDoubleExponential_vv_682;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_683> AgradDistributionSkewDoubleExponential_vv_683;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_684> AgradDistributionSkewDoubleExponential_vv_684;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_685> AgradDistributionSkewDoubleExponential_vv_685;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_686> AgradDistributionSkewDoubleExponential_vv_686;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_687> AgradDistributionSkewDoubleExponential_vv_687;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_688> AgradDistributionSkewDoubleExponential_vv_688;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_689> AgradDistributionSkewDoubleExponential_vv_689;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_690> AgradDistributionSkewDoubleExponential_vv_690;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_691> AgradDistributionSkewDoubleExponential_vv_691;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_692> AgradDistributionSkewDoubleExponential_vv_692;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_693> AgradDistributionSkewDoubleExponential_vv_693;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_694> AgradDistributionSkewDoubleExponential_vv_694;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_695> AgradDistributionSkewDoubleExponential_vv_695;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_696> AgradDistributionSkewDoubleExponential_vv_696;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_697> AgradDistributionSkewDoubleExponential_vv_697;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_698> AgradDistributionSkewDoubleExponential_vv_698;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_699> AgradDistributionSkewDoubleExponential_vv_699;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_600, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_600);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_601, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_601);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_602, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_602);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_603, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_603);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_604, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_604);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_605, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_605);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_606, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_606);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_607, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_607);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_608, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_608);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_609, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_609);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_610, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_610);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_611, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_611);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_612, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_612);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_613, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_613);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_614, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_614);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_615, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_615);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_616, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_616);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_617, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_617);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_618, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_618);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_619, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_619);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_620, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_620);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_621, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_621);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_622, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_622);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_623, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_623);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_624, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_624);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_625, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_625);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_626, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_626);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_627, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_627);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_628, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_628);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_629, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_629);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_630, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_630);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_631, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_631);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_632, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_632);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_633, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_633);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_634, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_634);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_635, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_635);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_636, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_636);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_637, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_637);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_638, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_638);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_639, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_639);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_640, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_640);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_641, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_641);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_642, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_642);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_643, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_643);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_644, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_644);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_645, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_645);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_646, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_646);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_647, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_647);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_648, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_648);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_649, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_649);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_650, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_650);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_651, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_651);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_652, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_652);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_653, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_653);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_654, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_654);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_655, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_655);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_656, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_656);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_657, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_657);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_658, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_658);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_659, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_659);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_660, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_660);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_661, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_661);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_662, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_662);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_663, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_663);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_664, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_664);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_665, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_665);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_666, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_666);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_667, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_667);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_668, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_668);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_669, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_669);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_670, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_670);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_671, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_671);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_672, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_672);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_673, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_673);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_674, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_674);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_675, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_675);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_676, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_676);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_677, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_677);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_678, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_678);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_679, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_679);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_680, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_680);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_681, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_681);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_682, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_682);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_683, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_683);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_684, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_684);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_685, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_685);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_686, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_686);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_687, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_687);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_688, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_688);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_689, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_689);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_690, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_690);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_691, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_691);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_692, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_692);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_693, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_693);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_694, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_694);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_695, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_695);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_696, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_696);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_697, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_697);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_698, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_698);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_699, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_699);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/skew_double_exponential/skew_double_exponential_test.hpp>
+
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_700;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_701;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_702;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_703;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_704;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_705;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_706;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_707;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_708;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_709;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_710;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, double, empty, empty> type_ffv_711;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty, empty> type_ffv_712;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_713;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty, empty> type_ffv_714;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_715;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_716;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty, empty> type_ffv_717;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_718;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_719;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_720;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_721;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_722;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_723;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_724;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_725;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_726;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_727;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_728;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty, empty> type_ffv_729;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_730;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_731;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_732;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_733;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_734;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_735;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_736;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_737;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_738;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_739;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_740;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_741;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_742;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_743;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_744;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_745;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_746;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty, empty> type_ffv_747;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_ffv_748;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_749;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_750;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_751;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_752;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_ffv_753;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_754;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_755;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_756;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_757;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_758;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_759;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_760;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_761;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_762;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_763;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_764;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_765;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_766;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_767;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_768;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_769;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_770;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_771;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_772;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_773;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_774;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_775;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_776;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_777;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_778;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_779;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_780;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_781;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_782;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, double, double, empty, empty> type_ffv_783;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, double, std::vector<double>, empty, empty> type_ffv_784;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_785;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, double, fvar<fvar<var> >, empty, empty> type_ffv_786;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_787;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_788;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<double>, double, empty, empty> type_ffv_789;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<double>, std::vector<double>, empty, empty> type_ffv_790;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_791;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_792;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_793;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_794;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_795;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_796;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_797;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_798;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_799;
+
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_700> AgradDistributionSkewDoubleExponential_ffv_700;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_701> AgradDistributionSkewDoubleExponential_ffv_701;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_702> AgradDistributionSkewDoubleExponential_ffv_702;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_703> AgradDistributionSkewDoubleExponential_ffv_703;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_704> AgradDistributionSkewDoubleExponential_ffv_704;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_705> AgradDistributionSkewDoubleExponential_ffv_705;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_706> AgradDistributionSkewDoubleExponential_ffv_706;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_707> AgradDistributionSkewDoubleExponential_ffv_707;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_708> AgradDistributionSkewDoubleExponential_ffv_708;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_709> AgradDistributionSkewDoubleExponential_ffv_709;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_710> AgradDistributionSkewDoubleExponential_ffv_710;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_711> AgradDistributionSkewDoubleExponential_ffv_711;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_712> AgradDistributionSkewDoubleExponential_ffv_712;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_713> AgradDistributionSkewDoubleExponential_ffv_713;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_714> AgradDistributionSkewDoubleExponential_ffv_714;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_715> AgradDistributionSkewDoubleExponential_ffv_715;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_716> AgradDistributionSkewDoubleExponential_ffv_716;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_717> AgradDistributionSkewDoubleExponential_ffv_717;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_718> AgradDistributionSkewDoubleExponential_ffv_718;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_719> AgradDistributionSkewDoubleExponential_ffv_719;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_720> AgradDistributionSkewDoubleExponential_ffv_720;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_721> AgradDistributionSkewDoubleExponential_ffv_721;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_722> AgradDistributionSkewDoubleExponential_ffv_722;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_723> AgradDistributionSkewDoubleExponential_ffv_723;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_724> AgradDistributionSkewDoubleExponential_ffv_724;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_725> AgradDistributionSkewDoubleExponential_ffv_725;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_726> AgradDistributionSkewDoubleExponential_ffv_726;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_727> AgradDistributionSkewDoubleExponential_ffv_727;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_728> AgradDistributionSkewDoubleExponential_ffv_728;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_729> AgradDistributionSkewDoubleExponential_ffv_729;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_730> AgradDistributionSkewDoubleExponential_ffv_730;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_731> AgradDistributionSkewDoubleExponential_ffv_731;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_732> AgradDistributionSkewDoubleExponential_ffv_732;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_733> AgradDistributionSkewDoubleExponential_ffv_733;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_734> AgradDistributionSkewDoubleExponential_ffv_734;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_735> AgradDistributionSkewDoubleExponential_ffv_735;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_736> AgradDistributionSkewDoubleExponential_ffv_736;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_737> AgradDistributionSkewDoubleExponential_ffv_737;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_738> AgradDistributionSkewDoubleExponential_ffv_738;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_739> AgradDistributionSkewDoubleExponential_ffv_739;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_740> AgradDistributionSkewDoubleExponential_ffv_740;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_741> AgradDistributionSkewDoubleExponential_ffv_741;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_742> AgradDistributionSkewDoubleExponential_ffv_742;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_743> AgradDistributionSkewDoubleExponential_ffv_743;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_744> AgradDistributionSkewDoubleExponential_ffv_744;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_745> AgradDistributionSkewDoubleExponential_ffv_745;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_746> AgradDistributionSkewDoubleExponential_ffv_746;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_747> AgradDistributionSkewDoubleExponential_ffv_747;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_748> AgradDistributionSkewDoubleExponential_ffv_748;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_749> AgradDistributionSkewDoubleExponential_ffv_749;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_750> AgradDistributionSkewDoubleExponential_ffv_750;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_751> AgradDistributionSkewDoubleExponential_ffv_751;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_752> AgradDistributionSkewDoubleExponential_ffv_752;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_753> AgradDistributionSkewDoubleExponential_ffv_753;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_754> AgradDistributionSkewDoubleExponential_ffv_754;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_755> AgradDistributionSkewDoubleExponential_ffv_755;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_756> AgradDistributionSkewDoubleExponential_ffv_756;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_757> AgradDistributionSkewDoubleExponential_ffv_757;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_758> AgradDistributionSkewDoubleExponential_ffv_758;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_759> AgradDistributionSkewDoubleExponential_ffv_759;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_760> AgradDistributionSkewDoubleExponential_ffv_760;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_761> AgradDistributionSkewDoubleExponential_ffv_761;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_762> AgradDistributionSkewDoubleExponential_ffv_762;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_763> AgradDistributionSkewDoubleExponential_ffv_763;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_764> AgradDistributionSkewDoubleExponential_ffv_764;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_765> AgradDistributionSkewDoubleExponential_ffv_765;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_766> AgradDistributionSkewDoubleExponential_ffv_766;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_767> AgradDistributionSkewDoubleExponential_ffv_767;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_768> AgradDistributionSkewDoubleExponential_ffv_768;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_769> AgradDistributionSkewDoubleExponential_ffv_769;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_770> AgradDistributionSkewDoubleExponential_ffv_770;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_771> AgradDistributionSkewDoubleExponential_ffv_771;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_772> AgradDistributionSkewDoubleExponential_ffv_772;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_773> AgradDistributionSkewDoubleExponential_ffv_773;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_774> AgradDistributionSkewDoubleExponential_ffv_774;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_775> AgradDistributionSkewDoubleExponential_ffv_775;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_776> AgradDistributionSkewDoubleExponential_ffv_776;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_777> AgradDistributionSkewDoubleExponential_ffv_777;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_778> AgradDistributionSkewDoubleExponential_ffv_778;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_779> AgradDistributionSkewDoubleExponential_ffv_779;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_780> AgradDistributionSkewDoubleExponential_ffv_780;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_781> AgradDistributionSkewDoubleExponential_ffv_781;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_782> AgradDistributionSkewDoubleExponential_ffv_782;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_783> AgradDistributionSkewDoubleExponential_ffv_783;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_784> AgradDistributionSkewDoubleExponential_ffv_784;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_785> AgradDistributionSkewDoubleExponential_ffv_785;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_786> AgradDistributionSkewDoubleExponential_ffv_786;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_787> AgradDistributionSkewDoubleExponential_ffv_787;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_788> AgradDistributionSkewDoubleExponential_ffv_788;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_789> AgradDistributionSkewDoubleExponential_ffv_789;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_790> AgradDistributionSkewDoubleExponential_ffv_790;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_791> AgradDistributionSkewDoubleExponential_ffv_791;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_792> AgradDistributionSkewDoubleExponential_ffv_792;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_793> AgradDistributionSkewDoubleExponential_ffv_793;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_794> AgradDistributionSkewDoubleExponential_ffv_794;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_795> AgradDistributionSkewDoubleExponential_ffv_795;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_796> AgradDistributionSkewDoubleExponential_ffv_796;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_797> AgradDistributionSkewDoubleExponential_ffv_797;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_798> AgradDistributionSkewDoubleExponential_ffv_798;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_799> AgradDistributionSkewDoubleExponential_ffv_799;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_700, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_700);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_701, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_701);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_702, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_702);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_703, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_703);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_704, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_704);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_705, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_705);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_706, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_706);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_707, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_707);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_708, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_708);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_709, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_709);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_710, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_710);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_711, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_711);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_712, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_712);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_713, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_713);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_714, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_714);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_715, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_715);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_716, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_716);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_717, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_717);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_718, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_718);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_719, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_719);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_720, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_720);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_721, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_721);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_722, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_722);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_723, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_723);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_724, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_724);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_725, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_725);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_726, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_726);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_727, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_727);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_728, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_728);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_729, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_729);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_730, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_730);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_731, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_731);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_732, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_732);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_733, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_733);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_734, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_734);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_735, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_735);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_736, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_736);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_737, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_737);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_738, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_738);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_739, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_739);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_740, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_740);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_741, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_741);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_742, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_742);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_743, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_743);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_744, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_744);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_745, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_745);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_746, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_746);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_747, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_747);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_748, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_748);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_749, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_749);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_750, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_750);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_751, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_751);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_752, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_752);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_753, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_753);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_754, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_754);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_755, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_755);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_756, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_756);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_757, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_757);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_758, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_758);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_759, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_759);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_760, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_760);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_761, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_761);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_762, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_762);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_763, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_763);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_764, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_764);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_765, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_765);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_766, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_766);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_767, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_767);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_768, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_768);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_769, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_769);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_770, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_770);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_771, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_771);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_772, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_772);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_773, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_773);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_774, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_774);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_775, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_775);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_776, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_776);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_777, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_777);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_778, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_778);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_779, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_779);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_780, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_780);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_781, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_781);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_782, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_782);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_783, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_783);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_784, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_784);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_785, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_785);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_786, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_786);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_787, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_787);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_788, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_788);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_789, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_789);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_790, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_790);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_791, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_791);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_792, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_792);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_793, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_793);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_794, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_794);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_795, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_795);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_796, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_796);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_797, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_797);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_798, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_798);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_799, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_799);
+
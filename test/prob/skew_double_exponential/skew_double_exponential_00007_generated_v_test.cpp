@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/skew_double_exponential/skew_double_exponential_test.hpp>
+
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_700;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_701;
+typedef std::tuple<var, std::vector<double>, var, double, empty, empty> type_v_702;
+typedef std::tuple<var, std::vector<double>, var, std::vector<double>, empty, empty> type_v_703;
+typedef std::tuple<var, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_704;
+typedef std::tuple<var, std::vector<double>, var, var, empty, empty> type_v_705;
+typedef std::tuple<var, std::vector<double>, var, std::vector<var>, empty, empty> type_v_706;
+typedef std::tuple<var, std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_707;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, double, empty, empty> type_v_708;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_v_709;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_710;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, var, empty, empty> type_v_711;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_v_712;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_713;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_714;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_715;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_716;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_717;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_718;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_719;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_720;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_721;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_722;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_723;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_724;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_725;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_726;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_727;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_728;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_729;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_730;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_731;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_732;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_733;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_734;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_735;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_736;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_737;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_738;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_739;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_740;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_741;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_742;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_743;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_744;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_745;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_746;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_747;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_748;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_749;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_750;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_751;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_752;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_753;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_754;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_755;
+typedef std::tuple<var, var, double, double, empty, empty> type_v_756;
+typedef std::tuple<var, var, double, std::vector<double>, empty, empty> type_v_757;
+typedef std::tuple<var, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_758;
+typedef std::tuple<var, var, double, var, empty, empty> type_v_759;
+typedef std::tuple<var, var, double, std::vector<var>, empty, empty> type_v_760;
+typedef std::tuple<var, var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_761;
+typedef std::tuple<var, var, std::vector<double>, double, empty, empty> type_v_762;
+typedef std::tuple<var, var, std::vector<double>, std::vector<double>, empty, empty> type_v_763;
+typedef std::tuple<var, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_764;
+typedef std::tuple<var, var, std::vector<double>, var, empty, empty> type_v_765;
+typedef std::tuple<var, var, std::vector<double>, std::vector<var>, empty, empty> type_v_766;
+typedef std::tuple<var, var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_767;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_768;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_769;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_770;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_771;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_772;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_773;
+typedef std::tuple<var, var, var, double, empty, empty> type_v_774;
+typedef std::tuple<var, var, var, std::vector<double>, empty, empty> type_v_775;
+typedef std::tuple<var, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_776;
+typedef std::tuple<var, var, var, var, empty, empty> type_v_777;
+typedef std::tuple<var, var, var, std::vector<var>, empty, empty> type_v_778;
+typedef std::tuple<var, var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_779;
+typedef std::tuple<var, var, std::vector<var>, double, empty, empty> type_v_780;
+typedef std::tuple<var, var, std::vector<var>, std::vector<double>, empty, empty> type_v_781;
+typedef std::tuple<var, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_782;
+typedef std::tuple<var, var, std::vector<var>, var, empty, empty> type_v_783;
+typedef std::tuple<var, var, std::vector<var>, std::vector<var>, empty, empty> type_v_784;
+typedef std::tuple<var, var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_785;
+typedef std::tuple<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_786;
+typedef std::tuple<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_787;
+typedef std::tuple<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_788;
+typedef std::tuple<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_789;
+typedef std::tuple<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_790;
+typedef std::tuple<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_791;
+typedef std::tuple<var, std::vector<var>, double, double, empty, empty> type_v_792;
+typedef std::tuple<var, std::vector<var>, double, std::vector<double>, empty, empty> type_v_793;
+typedef std::tuple<var, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_794;
+typedef std::tuple<var, std::vector<var>, double, var, empty, empty> type_v_795;
+typedef std::tuple<var, std::vector<var>, double, std::vector<var>, empty, empty> type_v_796;
+typedef std::tuple<var, std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_797;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, double, empty, empty> type_v_798;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_v_799;
+
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_700> AgradDistributionSkewDoubleExponential_v_700;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_701> AgradDistributionSkewDoubleExponential_v_701;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_702> AgradDistributionSkewDoubleExponential_v_702;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_703> AgradDistributionSkewDoubleExponential_v_703;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_704> AgradDistributionSkewDoubleExponential_v_704;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_705> AgradDistributionSkewDoubleExponential_v_705;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_706> AgradDistributionSkewDoubleExponential_v_706;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_707> AgradDistributionSkewDoubleExponential_v_707;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_708> AgradDistributionSkewDoubleExponential_v_708;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_709> AgradDistributionSkewDoubleExponential_v_709;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_710> AgradDistributionSkewDoubleExponential_v_710;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_711> AgradDistributionSkewDoubleExponential_v_711;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_712> AgradDistributionSkewDoubleExponential_v_712;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_713> AgradDistributionSkewDoubleExponential_v_713;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_714> AgradDistributionSkewDoubleExponential_v_714;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_715> AgradDistributionSkewDoubleExponential_v_715;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_716> AgradDistributionSkewDoubleExponential_v_716;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_717> AgradDistributionSkewDoubleExponential_v_717;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_718> AgradDistributionSkewDoubleExponential_v_718;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_719> AgradDistributionSkewDoubleExponential_v_719;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_720> AgradDistributionSkewDoubleExponential_v_720;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_721> AgradDistributionSkewDoubleExponential_v_721;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_722> AgradDistributionSkewDoubleExponential_v_722;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_723> AgradDistributionSkewDoubleExponential_v_723;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_724> AgradDistributionSkewDoubleExponential_v_724;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_725> AgradDistributionSkewDoubleExponential_v_725;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_726> AgradDistributionSkewDoubleExponential_v_726;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_727> AgradDistributionSkewDoubleExponential_v_727;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_728> AgradDistributionSkewDoubleExponential_v_728;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_729> AgradDistributionSkewDoubleExponential_v_729;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_730> AgradDistributionSkewDoubleExponential_v_730;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_731> AgradDistributionSkewDoubleExponential_v_731;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_732> AgradDistributionSkewDoubleExponential_v_732;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_733> AgradDistributionSkewDoubleExponential_v_733;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_734> AgradDistributionSkewDoubleExponential_v_734;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_735> AgradDistributionSkewDoubleExponential_v_735;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_736> AgradDistributionSkewDoubleExponential_v_736;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_737> AgradDistributionSkewDoubleExponential_v_737;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_738> AgradDistributionSkewDoubleExponential_v_738;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_739> AgradDistributionSkewDoubleExponential_v_739;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_740> AgradDistributionSkewDoubleExponential_v_740;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_741> AgradDistributionSkewDoubleExponential_v_741;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_742> AgradDistributionSkewDoubleExponential_v_742;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_743> AgradDistributionSkewDoubleExponential_v_743;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_744> AgradDistributionSkewDoubleExponential_v_744;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_745> AgradDistributionSkewDoubleExponential_v_745;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_746> AgradDistributionSkewDoubleExponential_v_746;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_747> AgradDistributionSkewDoubleExponential_v_747;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_748> AgradDistributionSkewDoubleExponential_v_748;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_749> AgradDistributionSkewDoubleExponential_v_749;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_750> AgradDistributionSkewDoubleExponential_v_750;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_751> AgradDistributionSkewDoubleExponential_v_751;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_752> AgradDistributionSkewDoubleExponential_v_752;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_753> AgradDistributionSkewDoubleExponential_v_753;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_754> AgradDistributionSkewDoubleExponential_v_754;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_755> AgradDistributionSkewDoubleExponential_v_755;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_756> AgradDistributionSkewDoubleExponential_v_756;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_757> AgradDistributionSkewDoubleExponential_v_757;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_758> AgradDistributionSkewDoubleExponential_v_758;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_759> AgradDistributionSkewDoubleExponential_v_759;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_760> AgradDistributionSkewDoubleExponential_v_760;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_761> AgradDistributionSkewDoubleExponential_v_761;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_762> AgradDistributionSkewDoubleExponential_v_762;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_763> AgradDistributionSkewDoubleExponential_v_763;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_764> AgradDistributionSkewDoubleExponential_v_764;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_765> AgradDistributionSkewDoubleExponential_v_765;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_766> AgradDistributionSkewDoubleExponential_v_766;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_767> AgradDistributionSkewDoubleExponential_v_767;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_768> AgradDistributionSkewDoubleExponential_v_768;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_769> AgradDistributionSkewDoubleExponential_v_769;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_770> AgradDistributionSkewDoubleExponential_v_770;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_771> AgradDistributionSkewDoubleExponential_v_771;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_772> AgradDistributionSkewDoubleExponential_v_772;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_773> AgradDistributionSkewDoubleExponential_v_773;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_774> AgradDistributionSkewDoubleExponential_v_774;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_775> AgradDistributionSkewDoubleExponential_v_775;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_776> AgradDistributionSkewDoubleExponential_v_776;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_777> AgradDistributionSkewDoubleExponential_v_777;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_778> AgradDistributionSkewDoubleExponential_v_778;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_779> AgradDistributionSkewDoubleExponential_v_779;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_780> AgradDistributionSkewDoubleExponential_v_780;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_781> AgradDistributionSkewDoubleExponential_v_781;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_782> AgradDistributionSkewDoubleExponential_v_782;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_783> AgradDistributionSkewDoubleExponential_v_783;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_784> AgradDistributionSkewDoubleExponential_v_784;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_785> AgradDistributionSkewDoubleExponential_v_785;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_786> AgradDistributionSkewDoubleExponential_v_786;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_787> AgradDistributionSkewDoubleExponential_v_787;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_788> AgradDistributionSkewDoubleExponential_v_788;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_789> AgradDistributionSkewDoubleExponential_v_789;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_790> AgradDistributionSkewDoubleExponential_v_790;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_791> AgradDistributionSkewDoubleExponential_v_791;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_792> AgradDistributionSkewDoubleExponential_v_792;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_793> AgradDistributionSkewDoubleExponential_v_793;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_794> AgradDistributionSkewDoubleExponential_v_794;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_795> AgradDistributionSkewDoubleExponential_v_795;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_796> AgradDistributionSkewDoubleExponential_v_796;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_797> AgradDistributionSkewDoubleExponential_v_797;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_798> AgradDistributionSkewDoubleExponential_v_798;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_799> AgradDistributionSkewDoubleExponential_v_799;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_700, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_700);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_701, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_701);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_702, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_702);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_703, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_703);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_704, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_704);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_705, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_705);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_706, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_706);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_707, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_707);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_708, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_708);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_709, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_709);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_710, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_710);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_711, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_711);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_712, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_712);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_713, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_713);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_714, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_714);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_715, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_715);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_716, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_716);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_717, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_717);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_718, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_718);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_719, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_719);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_720, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_720);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_721, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_721);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_722, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_722);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_723, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_723);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_724, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_724);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_725, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_725);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_726, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_726);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_727, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_727);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_728, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_728);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_729, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_729);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_730, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_730);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_731, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_731);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_732, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_732);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_733, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_733);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_734, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_734);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_735, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_735);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_736, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_736);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_737, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_737);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_738, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_738);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_739, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_739);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_740, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_740);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_741, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_741);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_742, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_742);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_743, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_743);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_744, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_744);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_745, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_745);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_746, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_746);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_747, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_747);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_748, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_748);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_749, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_749);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_750, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_750);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_751, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_751);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_752, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_752);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_753, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_753);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_754, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_754);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_755, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_755);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_756, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_756);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_757, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_757);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_758, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_758);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_759, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_759);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_760, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_760);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_761, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_761);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_762, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_762);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_763, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_763);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_764, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_764);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_765, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_765);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_766, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_766);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_767, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_767);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_768, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_768);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_769, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_769);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_770, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_770);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_771, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_771);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_772, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_772);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_773, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_773);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_774, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_774);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_775, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_775);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_776, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_776);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_777, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_777);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_778, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_778);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_779, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_779);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_780, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_780);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_781, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_781);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_782, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_782);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_783, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_783);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_784, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_784);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_785, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_785);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_786, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_786);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_787, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_787);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_788, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_788);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_789, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_789);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_790, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_790);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_791, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_791);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_792, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_792);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_793, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_793);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_794, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_794);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_795, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_795);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_796, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_796);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_797, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_797);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_798, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_798);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_799, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_799);
+
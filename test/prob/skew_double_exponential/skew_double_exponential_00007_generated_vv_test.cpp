@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/skew_double_exponential/skew_double_exponential_test.hpp>
+
+typedef std::tuple<var, var, std::vector<var>, std::vector<double>, empty, empty> type_vv_700;
+typedef std::tuple<var, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_701;
+typedef std::tuple<var, var, std::vector<var>, var, empty, empty> type_vv_702;
+typedef std::tuple<var, var, std::vector<var>, std::vector<var>, empty, empty> type_vv_703;
+typedef std::tuple<var, var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_704;
+typedef std::tuple<var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_705;
+typedef std::tuple<var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_706;
+typedef std::tuple<var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_707;
+typedef std::tuple<var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_708;
+typedef std::tuple<var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_709;
+typedef std::tuple<var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_710;
+typedef std::tuple<var, std::vector<var>, double, double, empty, empty> type_vv_711;
+typedef std::tuple<var, std::vector<var>, double, std::vector<double>, empty, empty> type_vv_712;
+typedef std::tuple<var, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_713;
+typedef std::tuple<var, std::vector<var>, double, var, empty, empty> type_vv_714;
+typedef std::tuple<var, std::vector<var>, double, std::vector<var>, empty, empty> type_vv_715;
+typedef std::tuple<var, std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_716;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, double, empty, empty> type_vv_717;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_vv_718;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_719;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, var, empty, empty> type_vv_720;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_vv_721;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_722;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_723;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_724;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_725;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_726;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_727;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_728;
+typedef std::tuple<var, std::vector<var>, var, double, empty, empty> type_vv_729;
+typedef std::tuple<var, std::vector<var>, var, std::vector<double>, empty, empty> type_vv_730;
+typedef std::tuple<var, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_731;
+typedef std::tuple<var, std::vector<var>, var, var, empty, empty> type_vv_732;
+typedef std::tuple<var, std::vector<var>, var, std::vector<var>, empty, empty> type_vv_733;
+typedef std::tuple<var, std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_734;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, double, empty, empty> type_vv_735;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_vv_736;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_737;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, var, empty, empty> type_vv_738;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_vv_739;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_740;
+typedef std::tuple<var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_741;
+typedef std::tuple<var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_742;
+typedef std::tuple<var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_743;
+typedef std::tuple<var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_744;
+typedef std::tuple<var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_745;
+typedef std::tuple<var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_746;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, empty, empty> type_vv_747;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, empty, empty> type_vv_748;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_749;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, empty, empty> type_vv_750;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, empty, empty> type_vv_751;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_752;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, empty, empty> type_vv_753;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, empty, empty> type_vv_754;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_755;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, empty, empty> type_vv_756;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, empty, empty> type_vv_757;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_758;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_759;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_760;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_761;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_762;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_763;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_764;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, empty, empty> type_vv_765;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, empty, empty> type_vv_766;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_767;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, empty, empty> type_vv_768;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, empty, empty> type_vv_769;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_770;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, empty, empty> type_vv_771;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, empty, empty> type_vv_772;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_773;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, empty, empty> type_vv_774;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, empty, empty> type_vv_775;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_776;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_777;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_778;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_779;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_780;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_781;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_782;
+typedef std::tuple<std::vector<var>, double, double, double, empty, empty> type_vv_783;
+typedef std::tuple<std::vector<var>, double, double, std::vector<double>, empty, empty> type_vv_784;
+typedef std::tuple<std::vector<var>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_785;
+typedef std::tuple<std::vector<var>, double, double, var, empty, empty> type_vv_786;
+typedef std::tuple<std::vector<var>, double, double, std::vector<var>, empty, empty> type_vv_787;
+typedef std::tuple<std::vector<var>, double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_788;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, double, empty, empty> type_vv_789;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, std::vector<double>, empty, empty> type_vv_790;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_791;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, var, empty, empty> type_vv_792;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, std::vector<var>, empty, empty> type_vv_793;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_794;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_795;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_796;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_797;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_798;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_799;
+
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_700> AgradDistributionSkewDoubleExponential_vv_700;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_701> AgradDistributionSkewDoubleExponential_vv_701;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_702> AgradDistributionSkewDoubleExponential_vv_702;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_703> AgradDistributionSkewDoubleExponential_vv_703;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_704> AgradDistributionSkewDoubleExponential_vv_704;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_705> AgradDistributionSkewDoubleExponential_vv_705;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_706> AgradDistributionSkewDoubleExponential_vv_706;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_707> AgradDistributionSkewDoubleExponential_vv_707;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_708> AgradDistributionSkewDoubleExponential_vv_708;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_709> AgradDistributionSkewDoubleExponential_vv_709;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_710> AgradDistributionSkewDoubleExponential_vv_710;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_711> AgradDistributionSkewDoubleExponential_vv_711;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_712> AgradDistributionSkewDoubleExponential_vv_712;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_713> AgradDistributionSkewDoubleExponential_vv_713;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_714> AgradDistributionSkewDoubleExponential_vv_714;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_715> AgradDistributionSkewDoubleExponential_vv_715;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_716> AgradDistributionSkewDoubleExponential_vv_716;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_717> AgradDistributionSkewDoubleExponential_vv_717;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_718> AgradDistributionSkewDoubleExponential_vv_718;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_719> AgradDistributionSkewDoubleExponential_vv_719;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_720> AgradDistributionSkewDoubleExponential_vv_720;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_721> AgradDistributionSkewDoubleExponential_vv_721;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_722> AgradDistributionSkewDoubleExponential_vv_722;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_723> AgradDistributionSkewDoubleExponential_vv_723;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_724> AgradDistributionSkewDoubleExponential_vv_724;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_725> AgradDistributionSkewDoubleExponential_vv_725;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_726> AgradDistributionSkewDoubleExponential_vv_726;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_727> AgradDistributionSkewDoubleExponential_vv_727;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_728> AgradDistributionSkewDoubleExponential_vv_728;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_729> AgradDistributionSkewDoubleExponential_vv_729;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_730> AgradDistributionSkewDoubleExponential_vv_730;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_731> AgradDistributionSkewDoubleExponential_vv_731;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_732> AgradDistributionSkewDoubleExponential_vv_732;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_733> AgradDistributionSkewDoubleExponential_vv_733;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_734> AgradDistributionSkewDoubleExponential_vv_734;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_735> AgradDistributionSkewDoubleExponential_vv_735;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_736> AgradDistributionSkewDoubleExponential_vv_736;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_737> AgradDistributionSkewDoubleExponential_vv_737;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_738> AgradDistributionSkewDoubleExponential_vv_738;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_739> AgradDistributionSkewDoubleExponential_vv_739;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_740> AgradDistributionSkewDoubleExponential_vv_740;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_741> AgradDistributionSkewDoubleExponential_vv_741;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_742> AgradDistributionSkewDoubleExponential_vv_742;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_743> AgradDistributionSkewDoubleExponential_vv_743;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_744> AgradDistributionSkewDoubleExponential_vv_744;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_745> AgradDistributionSkewDoubleExponential_vv_745;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_746> AgradDistributionSkewDoubleExponential_vv_746;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_747> AgradDistributionSkewDoubleExponential_vv_747;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_748> AgradDistributionSkewDoubleExponential_vv_748;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_749> AgradDistributionSkewDoubleExponential_vv_749;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_750> AgradDistributionSkewDoubleExponential_vv_750;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_751> AgradDistributionSkewDoubleExponential_vv_751;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_752> AgradDistributionSkewDoubleExponential_vv_752;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_753> AgradDistributionSkewDoubleExponential_vv_753;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_754> AgradDistributionSkewDoubleExponential_vv_754;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_755> AgradDistributionSkewDoubleExponential_vv_755;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_756> AgradDistributionSkewDoubleExponential_vv_756;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_757> AgradDistributionSkewDoubleExponential_vv_757;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_758> AgradDistributionSkewDoubleExponential_vv_758;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_759> AgradDistributionSkewDoubleExponential_vv_759;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_760> AgradDistributionSkewDoubleExponential_vv_760;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_761> AgradDistributionSkewDoubleExponential_vv_761;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_762> AgradDistributionSkewDoubleExponential_vv_762;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_763> AgradDistributionSkewDoubleExponential_vv_763;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_764> AgradDistributionSkewDoubleExponential_vv_764;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_765> AgradDistributionSkewDoubleExponential_vv_765;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_766> AgradDistributionSkewDoubleExponential_vv_766;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_767> AgradDistributionSkewDoubleExponential_vv_767;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_768> AgradDistributionSkewDoubleExponential_vv_768;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_769> AgradDistributionSkewDoubleExponential_vv_769;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_770> AgradDistributionSkewDoubleExponential_vv_770;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_771> AgradDistributionSkewDoubleExponential_vv_771;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_772> AgradDistributionSkewDoubleExponential_vv_772;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_773> AgradDistributionSkewDoubleExponential_vv_773;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_774> AgradDistributionSkewDoubleExponential_vv_774;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_775> AgradDistributionSkewDoubleExponential_vv_775;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_776> AgradDistributionSkewDoubleExponential_vv_776;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_777> AgradDistributionSkewDoubleExponential_vv_777;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_778> AgradDistributionSkewDoubleExponential_vv_778;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_779> AgradDistributionSkewDoubleExponential_vv_779;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_780> AgradDistributionSkewDoubleExponential_vv_780;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_781> AgradDistributionSkewDoubleExponential_vv_781;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_782> AgradDistributionSkewDoubleExponential_vv_782;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_783> AgradDistributionSkewDoubleExponential_vv_783;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_784> AgradDistributionSkewDoubleExponential_vv_784;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_785> AgradDistributionSkewDoubleExponential_vv_785;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_786> AgradDistributionSkewDoubleExponential_vv_786;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_787> AgradDistributionSkewDoubleExponential_vv_787;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_788> AgradDistributionSkewDoubleExponential_vv_788;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_789> AgradDistributionSkewDoubleExponential_vv_789;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_790> AgradDistributionSkewDoubleExponential_vv_790;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_791> AgradDistributionSkewDoubleExponential_vv_791;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_792> AgradDistributionSkewDoubleExponential_vv_792;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_793> AgradDistributionSkewDoubleExponential_vv_793;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_794> AgradDistributionSkewDoubleExponential_vv_794;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_795> AgradDistributionSkewDoubleExponential_vv_795;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_796> AgradDistributionSkewDoubleExponential_vv_796;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_797> AgradDistributionSkewDoubleExponential_vv_797;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_798> AgradDistributionSkewDoubleExponential_vv_798;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_799> AgradDistributionSkewDoubleExponential_vv_799;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_700, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_700);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_701, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_701);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_702, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_702);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_703, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_703);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_704, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_704);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_705, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_705);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_706, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_706);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_707, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_707);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_708, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_708);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_709, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_709);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_710, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_710);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_711, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_711);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_712, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_712);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_713, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_713);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_714, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_714);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_715, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_715);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_716, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_716);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_717, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_717);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_718, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_718);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_719, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_719);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_720, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_720);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_721, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_721);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_722, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_722);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_723, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_723);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_724, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_724);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_725, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_725);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_726, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_726);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_727, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_727);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_728, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_728);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_729, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_729);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_730, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_730);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_731, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_731);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_732, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_732);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_733, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_733);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_734, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_734);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_735, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_735);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_736, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_736);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_737, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_737);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_738, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_738);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_739, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_739);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_740, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_740);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_741, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_741);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_742, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_742);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_743, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_743);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_744, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_744);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_745, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_745);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_746, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_746);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_747, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_747);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_748, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_748);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_749, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_749);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_750, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_750);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_751, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_751);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_752, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_752);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_753, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_753);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_754, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_754);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_755, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_755);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_756, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_756);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_757, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_757);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_758, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_758);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_759, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_759);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_760, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_760);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_761, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_761);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_762, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_762);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_763, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_763);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_764, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_764);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_765, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_765);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_766, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_766);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_767, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_767);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_768, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_768);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_769, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_769);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_770, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_770);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_771, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_771);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_772, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_772);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_773, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_773);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_774, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_774);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_775, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_775);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_776, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_776);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_777, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_777);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_778, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_778);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_779, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_779);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_780, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_780);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_781, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_781);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_782, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_782);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_783, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_783);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_784, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_784);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_785, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_785);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_786, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_786);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_787, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_787);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_788, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_788);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_789, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_789);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_790, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_790);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_791, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_791);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_792, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_792);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_793, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_793);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_794, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_794);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_795, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_795);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_796, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_796);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_797, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_797);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_798, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_798);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_799, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_799);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/skew_double_exponential/skew_double_exponential_test.hpp>
+
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_800;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, double, empty, empty> type_ffv_801;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_802;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_803;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_804;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_805;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_806;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_807;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_808;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_809;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_810;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_811;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_812;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_813;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_814;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_815;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_816;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_817;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_818;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, double, double, empty, empty> type_ffv_819;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, double, std::vector<double>, empty, empty> type_ffv_820;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_821;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, double, fvar<fvar<var> >, empty, empty> type_ffv_822;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_823;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_824;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, double, empty, empty> type_ffv_825;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_826;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_827;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_828;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_829;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_830;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_831;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_832;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_833;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_834;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_835;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_836;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, double, empty, empty> type_ffv_837;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_838;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_839;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_840;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_841;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_842;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_843;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_844;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_845;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_846;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_847;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_848;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_849;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_850;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_851;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_852;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_853;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_854;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty> type_ffv_855;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_ffv_856;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_857;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_858;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_859;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_860;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_ffv_861;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_862;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_863;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_864;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_865;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_866;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_867;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_868;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_869;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_870;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_871;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_872;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_873;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_874;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_875;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_876;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_877;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_878;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_879;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_880;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_881;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_882;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_883;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_884;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_885;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_886;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_887;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_888;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_889;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_890;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, double, empty, empty> type_ffv_891;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, std::vector<double>, empty, empty> type_ffv_892;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_893;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, fvar<fvar<var> >, empty, empty> type_ffv_894;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_895;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_896;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, double, empty, empty> type_ffv_897;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty, empty> type_ffv_898;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_899;
+
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_800> AgradDistributionSkewDoubleExponential_ffv_800;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_801> AgradDistributionSkewDoubleExponential_ffv_801;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_802> AgradDistributionSkewDoubleExponential_ffv_802;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_803> AgradDistributionSkewDoubleExponential_ffv_803;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_804> AgradDistributionSkewDoubleExponential_ffv_804;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_805> AgradDistributionSkewDoubleExponential_ffv_805;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_806> AgradDistributionSkewDoubleExponential_ffv_806;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_807> AgradDistributionSkewDoubleExponential_ffv_807;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_808> AgradDistributionSkewDoubleExponential_ffv_808;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_809> AgradDistributionSkewDoubleExponential_ffv_809;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_810> AgradDistributionSkewDoubleExponential_ffv_810;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_811> AgradDistributionSkewDoubleExponential_ffv_811;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_812> AgradDistributionSkewDoubleExponential_ffv_812;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_813> AgradDistributionSkewDoubleExponential_ffv_813;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_814> AgradDistributionSkewDoubleExponential_ffv_814;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_815> AgradDistributionSkewDoubleExponential_ffv_815;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_816> AgradDistributionSkewDoubleExponential_ffv_816;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_817> AgradDistributionSkewDoubleExponential_ffv_817;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_818> AgradDistributionSkewDoubleExponential_ffv_818;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_819> AgradDistributionSkewDoubleExponential_ffv_819;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_820> AgradDistributionSkewDoubleExponential_ffv_820;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_821> AgradDistributionSkewDoubleExponential_ffv_821;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_822> AgradDistributionSkewDoubleExponential_ffv_822;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_823> AgradDistributionSkewDoubleExponential_ffv_823;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_824> AgradDistributionSkewDoubleExponential_ffv_824;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_825> AgradDistributionSkewDoubleExponential_ffv_825;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_826> AgradDistributionSkewDoubleExponential_ffv_826;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_827> AgradDistributionSkewDoubleExponential_ffv_827;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_828> AgradDistributionSkewDoubleExponential_ffv_828;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_829> AgradDistributionSkewDoubleExponential_ffv_829;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_830> AgradDistributionSkewDoubleExponential_ffv_830;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_831> AgradDistributionSkewDoubleExponential_ffv_831;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_832> AgradDistributionSkewDoubleExponential_ffv_832;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_833> AgradDistributionSkewDoubleExponential_ffv_833;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_834> AgradDistributionSkewDoubleExponential_ffv_834;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_835> AgradDistributionSkewDoubleExponential_ffv_835;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_836> AgradDistributionSkewDoubleExponential_ffv_836;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_837> AgradDistributionSkewDoubleExponential_ffv_837;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_838> AgradDistributionSkewDoubleExponential_ffv_838;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_839> AgradDistributionSkewDoubleExponential_ffv_839;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_840> AgradDistributionSkewDoubleExponential_ffv_840;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_841> AgradDistributionSkewDoubleExponential_ffv_841;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_842> AgradDistributionSkewDoubleExponential_ffv_842;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_843> AgradDistributionSkewDoubleExponential_ffv_843;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_844> AgradDistributionSkewDoubleExponential_ffv_844;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_845> AgradDistributionSkewDoubleExponential_ffv_845;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_846> AgradDistributionSkewDoubleExponential_ffv_846;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_847> AgradDistributionSkewDoubleExponential_ffv_847;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_848> AgradDistributionSkewDoubleExponential_ffv_848;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_849> AgradDistributionSkewDoubleExponential_ffv_849;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_850> AgradDistributionSkewDoubleExponential_ffv_850;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_851> AgradDistributionSkewDoubleExponential_ffv_851;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_852> AgradDistributionSkewDoubleExponential_ffv_852;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_853> AgradDistributionSkewDoubleExponential_ffv_853;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_854> AgradDistributionSkewDoubleExponential_ffv_854;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_855> AgradDistributionSkewDoubleExponential_ffv_855;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_856> AgradDistributionSkewDoubleExponential_ffv_856;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_857> AgradDistributionSkewDoubleExponential_ffv_857;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_858> AgradDistributionSkewDoubleExponential_ffv_858;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_859> AgradDistributionSkewDoubleExponential_ffv_859;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_860> AgradDistributionSkewDoubleExponential_ffv_860;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_861> AgradDistributionSkewDoubleExponential_ffv_861;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_862> AgradDistributionSkewDoubleExponential_ffv_862;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_863> AgradDistributionSkewDoubleExponential_ffv_863;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_864> AgradDistributionSkewDoubleExponential_ffv_864;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_865> AgradDistributionSkewDoubleExponential_ffv_865;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_866> AgradDistributionSkewDoubleExponential_ffv_866;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_867> AgradDistributionSkewDoubleExponential_ffv_867;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_868> AgradDistributionSkewDoubleExponential_ffv_868;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_869> AgradDistributionSkewDoubleExponential_ffv_869;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_870> AgradDistributionSkewDoubleExponential_ffv_870;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_871> AgradDistributionSkewDoubleExponential_ffv_871;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_872> AgradDistributionSkewDoubleExponential_ffv_872;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_873> AgradDistributionSkewDoubleExponential_ffv_873;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_874> AgradDistributionSkewDoubleExponential_ffv_874;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_875> AgradDistributionSkewDoubleExponential_ffv_875;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_876> AgradDistributionSkewDoubleExponential_ffv_876;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_877> AgradDistributionSkewDoubleExponential_ffv_877;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_878> AgradDistributionSkewDoubleExponential_ffv_878;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_879> AgradDistributionSkewDoubleExponential_ffv_879;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_880> AgradDistributionSkewDoubleExponential_ffv_880;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_881> AgradDistributionSkewDoubleExponential_ffv_881;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_882> AgradDistributionSkewDoubleExponential_ffv_882;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_883> AgradDistributionSkewDoubleExponential_ffv_883;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_884> AgradDistributionSkewDoubleExponential_ffv_884;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_885> AgradDistributionSkewDoubleExponential_ffv_885;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_886> AgradDistributionSkewDoubleExponential_ffv_886;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_887> AgradDistributionSkewDoubleExponential_ffv_887;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_888> AgradDistributionSkewDoubleExponential_ffv_888;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_889> AgradDistributionSkewDoubleExponential_ffv_889;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_890> AgradDistributionSkewDoubleExponential_ffv_890;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_891> AgradDistributionSkewDoubleExponential_ffv_891;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_892> AgradDistributionSkewDoubleExponential_ffv_892;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_893> AgradDistributionSkewDoubleExponential_ffv_893;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_894> AgradDistributionSkewDoubleExponential_ffv_894;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_895> AgradDistributionSkewDoubleExponential_ffv_895;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_896> AgradDistributionSkewDoubleExponential_ffv_896;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_897> AgradDistributionSkewDoubleExponential_ffv_897;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_898> AgradDistributionSkewDoubleExponential_ffv_898;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_899> AgradDistributionSkewDoubleExponential_ffv_899;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_800, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_800);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_801, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_801);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_802, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_802);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_803, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_803);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_804, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_804);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_805, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_805);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_806, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_806);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_807, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_807);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_808, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_808);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_809, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_809);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_810, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_810);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_811, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_811);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_812, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_812);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_813, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_813);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_814, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_814);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_815, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_815);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_816, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_816);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_817, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_817);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_818, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_818);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_819, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_819);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_820, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_820);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_821, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_821);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_822, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_822);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_823, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_823);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_824, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_824);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_825, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_825);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_826, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_826);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_827, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_827);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_828, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_828);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_829, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_829);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_830, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_830);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_831, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_831);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_832, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_832);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_833, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_833);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_834, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_834);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_835, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_835);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_836, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_836);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_837, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_837);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_838, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_838);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_839, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_839);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_840, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_840);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_841, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_841);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_842, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_842);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_843, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_843);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_844, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_844);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_845, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_845);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_846, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_846);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_847, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_847);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_848, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_848);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_849, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_849);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_850, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_850);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_851, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_851);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_852, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_852);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_853, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_853);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_854, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_854);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_855, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_855);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_856, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_856);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_857, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_857);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_858, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_858);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_859, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_859);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_860, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_860);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_861, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_861);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_862, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_862);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_863, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_863);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_864, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_864);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_865, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_865);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_866, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_866);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_867, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_867);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_868, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_868);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_869, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_869);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_870, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_870);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_871, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_871);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_872, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_872);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_873, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_873);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_874, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_874);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_875, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_875);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_876, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_876);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_877, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_877);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_878, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_878);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_879, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_879);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_880, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_880);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_881, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_881);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_882, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_882);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_883, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_883);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_884, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_884);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_885, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_885);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_886, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_886);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_887, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_887);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_888, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_888);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_889, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_889);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_890, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_890);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_891, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_891);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_892, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_892);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_893, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_893);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_894, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_894);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_895, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_895);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_896, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_896);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_897, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_897);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_898, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_898);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_899, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_899);
+
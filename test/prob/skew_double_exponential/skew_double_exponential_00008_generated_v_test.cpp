@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/skew_double_exponential/skew_double_exponential_test.hpp>
+
+typedef std::tuple<var, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_800;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, var, empty, empty> type_v_801;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_v_802;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_803;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_804;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_805;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_806;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_807;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_808;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_809;
+typedef std::tuple<var, std::vector<var>, var, double, empty, empty> type_v_810;
+typedef std::tuple<var, std::vector<var>, var, std::vector<double>, empty, empty> type_v_811;
+typedef std::tuple<var, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_812;
+typedef std::tuple<var, std::vector<var>, var, var, empty, empty> type_v_813;
+typedef std::tuple<var, std::vector<var>, var, std::vector<var>, empty, empty> type_v_814;
+typedef std::tuple<var, std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_815;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, double, empty, empty> type_v_816;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_v_817;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_818;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, var, empty, empty> type_v_819;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_v_820;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_821;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_822;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_823;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_824;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_825;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_826;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_827;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_828;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_829;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_830;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_831;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_832;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_833;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_834;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_835;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_836;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_837;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_838;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_839;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_840;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_841;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_842;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_843;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_844;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_845;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_846;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_847;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_848;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_849;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_850;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_851;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_852;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_853;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_854;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_855;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_856;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_857;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_858;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_859;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_860;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_861;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_862;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_863;
+typedef std::tuple<std::vector<var>, double, double, double, empty, empty> type_v_864;
+typedef std::tuple<std::vector<var>, double, double, std::vector<double>, empty, empty> type_v_865;
+typedef std::tuple<std::vector<var>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_866;
+typedef std::tuple<std::vector<var>, double, double, var, empty, empty> type_v_867;
+typedef std::tuple<std::vector<var>, double, double, std::vector<var>, empty, empty> type_v_868;
+typedef std::tuple<std::vector<var>, double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_869;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, double, empty, empty> type_v_870;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, std::vector<double>, empty, empty> type_v_871;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_872;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, var, empty, empty> type_v_873;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, std::vector<var>, empty, empty> type_v_874;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_875;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_876;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_877;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_878;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_879;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_880;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_881;
+typedef std::tuple<std::vector<var>, double, var, double, empty, empty> type_v_882;
+typedef std::tuple<std::vector<var>, double, var, std::vector<double>, empty, empty> type_v_883;
+typedef std::tuple<std::vector<var>, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_884;
+typedef std::tuple<std::vector<var>, double, var, var, empty, empty> type_v_885;
+typedef std::tuple<std::vector<var>, double, var, std::vector<var>, empty, empty> type_v_886;
+typedef std::tuple<std::vector<var>, double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_887;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, double, empty, empty> type_v_888;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, std::vector<double>, empty, empty> type_v_889;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_890;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, var, empty, empty> type_v_891;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, std::vector<var>, empty, empty> type_v_892;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_893;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_894;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_895;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_896;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_897;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_898;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_899;
+
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_800> AgradDistributionSkewDoubleExponential_v_800;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_801> AgradDistributionSkewDoubleExponential_v_801;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_802> AgradDistributionSkewDoubleExponential_v_802;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_803> AgradDistributionSkewDoubleExponential_v_803;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_804> AgradDistributionSkewDoubleExponential_v_804;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_805> AgradDistributionSkewDoubleExponential_v_805;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_806> AgradDistributionSkewDoubleExponential_v_806;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_807> AgradDistributionSkewDoubleExponential_v_807;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_808> AgradDistributionSkewDoubleExponential_v_808;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_809> AgradDistributionSkewDoubleExponential_v_809;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_810> AgradDistributionSkewDoubleExponential_v_810;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_811> AgradDistributionSkewDoubleExponential_v_811;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_812> AgradDistributionSkewDoubleExponential_v_812;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_813> AgradDistributionSkewDoubleExponential_v_813;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_814> AgradDistributionSkewDoubleExponential_v_814;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_815> AgradDistributionSkewDoubleExponential_v_815;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_816> AgradDistributionSkewDoubleExponential_v_816;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_817> AgradDistributionSkewDoubleExponential_v_817;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_818> AgradDistributionSkewDoubleExponential_v_818;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_819> AgradDistributionSkewDoubleExponential_v_819;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_820> AgradDistributionSkewDoubleExponential_v_820;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_821> AgradDistributionSkewDoubleExponential_v_821;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_822> AgradDistributionSkewDoubleExponential_v_822;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_823> AgradDistributionSkewDoubleExponential_v_823;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_824> AgradDistributionSkewDoubleExponential_v_824;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_825> AgradDistributionSkewDoubleExponential_v_825;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_826> AgradDistributionSkewDoubleExponential_v_826;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_827> AgradDistributionSkewDoubleExponential_v_827;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_828> AgradDistributionSkewDoubleExponential_v_828;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_829> AgradDistributionSkewDoubleExponential_v_829;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_830> AgradDistributionSkewDoubleExponential_v_830;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_831> AgradDistributionSkewDoubleExponential_v_831;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_832> AgradDistributionSkewDoubleExponential_v_832;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_833> AgradDistributionSkewDoubleExponential_v_833;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_834> AgradDistributionSkewDoubleExponential_v_834;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_835> AgradDistributionSkewDoubleExponential_v_835;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_836> AgradDistributionSkewDoubleExponential_v_836;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_837> AgradDistributionSkewDoubleExponential_v_837;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_838> AgradDistributionSkewDoubleExponential_v_838;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_839> AgradDistributionSkewDoubleExponential_v_839;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_840> AgradDistributionSkewDoubleExponential_v_840;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_841> AgradDistributionSkewDoubleExponential_v_841;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_842> AgradDistributionSkewDoubleExponential_v_842;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_843> AgradDistributionSkewDoubleExponential_v_843;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_844> AgradDistributionSkewDoubleExponential_v_844;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_845> AgradDistributionSkewDoubleExponential_v_845;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_846> AgradDistributionSkewDoubleExponential_v_846;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_847> AgradDistributionSkewDoubleExponential_v_847;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_848> AgradDistributionSkewDoubleExponential_v_848;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_849> AgradDistributionSkewDoubleExponential_v_849;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_850> AgradDistributionSkewDoubleExponential_v_850;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_851> AgradDistributionSkewDoubleExponential_v_851;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_852> AgradDistributionSkewDoubleExponential_v_852;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_853> AgradDistributionSkewDoubleExponential_v_853;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_854> AgradDistributionSkewDoubleExponential_v_854;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_855> AgradDistributionSkewDoubleExponential_v_855;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_856> AgradDistributionSkewDoubleExponential_v_856;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_857> AgradDistributionSkewDoubleExponential_v_857;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_858> AgradDistributionSkewDoubleExponential_v_858;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_859> AgradDistributionSkewDoubleExponential_v_859;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_860> AgradDistributionSkewDoubleExponential_v_860;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_861> AgradDistributionSkewDoubleExponential_v_861;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_862> AgradDistributionSkewDoubleExponential_v_862;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_863> AgradDistributionSkewDoubleExponential_v_863;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_864> AgradDistributionSkewDoubleExponential_v_864;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_865> AgradDistributionSkewDoubleExponential_v_865;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_866> AgradDistributionSkewDoubleExponential_v_866;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_867> AgradDistributionSkewDoubleExponential_v_867;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_868> AgradDistributionSkewDoubleExponential_v_868;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_869> AgradDistributionSkewDoubleExponential_v_869;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_870> AgradDistributionSkewDoubleExponential_v_870;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_871> AgradDistributionSkewDoubleExponential_v_871;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_872> AgradDistributionSkewDoubleExponential_v_872;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_873> AgradDistributionSkewDoubleExponential_v_873;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_874> AgradDistributionSkewDoubleExponential_v_874;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_875> AgradDistributionSkewDoubleExponential_v_875;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_876> AgradDistributionSkewDoubleExponential_v_876;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_877> AgradDistributionSkewDoubleExponential_v_877;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_878> AgradDistributionSkewDoubleExponential_v_878;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_879> AgradDistributionSkewDoubleExponential_v_879;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_880> AgradDistributionSkewDoubleExponential_v_880;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_881> AgradDistributionSkewDoubleExponential_v_881;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_882> AgradDistributionSkewDoubleExponential_v_882;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_883> AgradDistributionSkewDoubleExponential_v_883;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_884> AgradDistributionSkewDoubleExponential_v_884;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_885> AgradDistributionSkewDoubleExponential_v_885;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_886> AgradDistributionSkewDoubleExponential_v_886;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_887> AgradDistributionSkewDoubleExponential_v_887;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_888> AgradDistributionSkewDoubleExponential_v_888;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_889> AgradDistributionSkewDoubleExponential_v_889;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_890> AgradDistributionSkewDoubleExponential_v_890;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_891> AgradDistributionSkewDoubleExponential_v_891;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_892> AgradDistributionSkewDoubleExponential_v_892;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_893> AgradDistributionSkewDoubleExponential_v_893;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_894> AgradDistributionSkewDoubleExponential_v_894;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_895> AgradDistributionSkewDoubleExponential_v_895;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_896> AgradDistributionSkewDoubleExponential_v_896;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_897> AgradDistributionSkewDoubleExponential_v_897;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_898> AgradDistributionSkewDoubleExponential_v_898;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_899> AgradDistributionSkewDoubleExponential_v_899;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_800, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_800);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_801, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_801);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_802, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_802);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_803, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_803);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_804, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_804);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_805, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_805);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_806, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_806);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_807, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_807);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_808, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_808);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_809, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_809);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_810, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_810);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_811, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_811);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_812, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_812);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_813, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_813);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_814, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_814);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_815, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_815);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_816, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_816);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_817, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_817);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_818, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_818);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_819, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_819);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_820, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_820);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_821, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_821);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_822, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_822);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_823, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_823);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_824, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_824);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_825, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_825);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_826, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_826);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_827, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_827);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_828, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_828);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_829, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_829);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_830, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_830);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_831, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_831);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_832, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_832);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_833, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_833);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_834, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_834);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_835, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_835);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_836, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_836);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_837, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_837);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_838, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_838);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_839, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_839);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_840, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_840);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_841, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_841);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_842, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_842);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_843, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_843);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_844, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_844);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_845, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_845);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_846, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_846);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_847, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_847);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_848, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_848);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_849, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_849);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_850, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_850);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_851, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_851);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_852, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_852);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_853, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_853);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_854, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_854);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_855, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_855);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_856, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_856);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_857, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_857);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_858, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_858);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_859, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_859);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_860, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_860);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_861, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_861);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_862, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_862);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_863, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_863);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_864, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_864);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_865, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_865);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_866, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_866);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_867, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_867);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_868, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_868);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_869, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_869);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_870, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_870);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_871, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_871);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_872, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_872);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_873, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_873);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_874, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_874);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_875, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_875);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_876, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_876);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_877, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_877);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_878, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_878);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_879, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_879);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_880, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_880);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_881, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_881);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_882, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_882);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_883, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_883);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_884, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_884);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_885, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_885);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_886, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_886);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_887, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_887);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_888, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_888);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_889, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_889);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_890, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_890);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_891, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_891);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_892, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_892);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_893, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_893);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_894, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_894);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_895, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_895);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_896, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_896);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_897, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_897);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_898, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_898);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_899, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_899);
+
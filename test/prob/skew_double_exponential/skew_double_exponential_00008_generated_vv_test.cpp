@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/skew_double_exponential/skew_double_exponential_test.hpp>
+
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_800;
+typedef std::tuple<std::vector<var>, double, var, double, empty, empty> type_vv_801;
+typedef std::tuple<std::vector<var>, double, var, std::vector<double>, empty, empty> type_vv_802;
+typedef std::tuple<std::vector<var>, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_803;
+typedef std::tuple<std::vector<var>, double, var, var, empty, empty> type_vv_804;
+typedef std::tuple<std::vector<var>, double, var, std::vector<var>, empty, empty> type_vv_805;
+typedef std::tuple<std::vector<var>, double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_806;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, double, empty, empty> type_vv_807;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, std::vector<double>, empty, empty> type_vv_808;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_809;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, var, empty, empty> type_vv_810;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, std::vector<var>, empty, empty> type_vv_811;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_812;
+typedef std::tuple<std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_813;
+typedef std::tuple<std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_814;
+typedef std::tuple<std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_815;
+typedef std::tuple<std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_816;
+typedef std::tuple<std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_817;
+typedef std::tuple<std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_818;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, double, empty, empty> type_vv_819;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, std::vector<double>, empty, empty> type_vv_820;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_821;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, var, empty, empty> type_vv_822;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, std::vector<var>, empty, empty> type_vv_823;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_824;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, double, empty, empty> type_vv_825;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, std::vector<double>, empty, empty> type_vv_826;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_827;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, var, empty, empty> type_vv_828;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_vv_829;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_830;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_831;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_832;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_833;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_834;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_835;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_836;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, double, empty, empty> type_vv_837;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, std::vector<double>, empty, empty> type_vv_838;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_839;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, var, empty, empty> type_vv_840;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, std::vector<var>, empty, empty> type_vv_841;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_842;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, double, empty, empty> type_vv_843;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_vv_844;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_845;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, var, empty, empty> type_vv_846;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_vv_847;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_848;
+typedef std::tuple<std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_849;
+typedef std::tuple<std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_850;
+typedef std::tuple<std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_851;
+typedef std::tuple<std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_852;
+typedef std::tuple<std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_853;
+typedef std::tuple<std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_854;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty> type_vv_855;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_vv_856;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_857;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_vv_858;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_vv_859;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_860;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_vv_861;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_vv_862;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_863;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_vv_864;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_vv_865;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_866;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_867;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_868;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_869;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_870;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_871;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_872;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_vv_873;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_vv_874;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_875;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_vv_876;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_vv_877;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_878;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_vv_879;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_vv_880;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_881;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_vv_882;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_vv_883;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_884;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_885;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_886;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_887;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_888;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_889;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_890;
+typedef std::tuple<std::vector<var>, var, double, double, empty, empty> type_vv_891;
+typedef std::tuple<std::vector<var>, var, double, std::vector<double>, empty, empty> type_vv_892;
+typedef std::tuple<std::vector<var>, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_893;
+typedef std::tuple<std::vector<var>, var, double, var, empty, empty> type_vv_894;
+typedef std::tuple<std::vector<var>, var, double, std::vector<var>, empty, empty> type_vv_895;
+typedef std::tuple<std::vector<var>, var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_896;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, double, empty, empty> type_vv_897;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, std::vector<double>, empty, empty> type_vv_898;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_899;
+
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_800> AgradDistributionSkewDoubleExponential_vv_800;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_801> AgradDistributionSkewDoubleExponential_vv_801;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_802> AgradDistributionSkewDoubleExponential_vv_802;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_803> AgradDistributionSkewDoubleExponential_vv_803;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_804> AgradDistributionSkewDoubleExponential_vv_804;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_805> AgradDistributionSkewDoubleExponential_vv_805;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_806> AgradDistributionSkewDoubleExponential_vv_806;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_807> AgradDistributionSkewDoubleExponential_vv_807;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_808> AgradDistributionSkewDoubleExponential_vv_808;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_809> AgradDistributionSkewDoubleExponential_vv_809;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_810> AgradDistributionSkewDoubleExponential_vv_810;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_811> AgradDistributionSkewDoubleExponential_vv_811;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_812> AgradDistributionSkewDoubleExponential_vv_812;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_813> AgradDistributionSkewDoubleExponential_vv_813;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_814> AgradDistributionSkewDoubleExponential_vv_814;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_815> AgradDistributionSkewDoubleExponential_vv_815;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_816> AgradDistributionSkewDoubleExponential_vv_816;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_817> AgradDistributionSkewDoubleExponential_vv_817;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_818> AgradDistributionSkewDoubleExponential_vv_818;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_819> AgradDistributionSkewDoubleExponential_vv_819;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_820> AgradDistributionSkewDoubleExponential_vv_820;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_821> AgradDistributionSkewDoubleExponential_vv_821;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_822> AgradDistributionSkewDoubleExponential_vv_822;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_823> AgradDistributionSkewDoubleExponential_vv_823;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_824> AgradDistributionSkewDoubleExponential_vv_824;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_825> AgradDistributionSkewDoubleExponential_vv_825;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_826> AgradDistributionSkewDoubleExponential_vv_826;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_827> AgradDistributionSkewDoubleExponential_vv_827;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_828> AgradDistributionSkewDoubleExponential_vv_828;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_829> AgradDistributionSkewDoubleExponential_vv_829;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_830> AgradDistributionSkewDoubleExponential_vv_830;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_831> AgradDistributionSkewDoubleExponential_vv_831;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_832> AgradDistributionSkewDoubleExponential_vv_832;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_833> AgradDistributionSkewDoubleExponential_vv_833;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_834> AgradDistributionSkewDoubleExponential_vv_834;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_835> AgradDistributionSkewDoubleExponential_vv_835;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_836> AgradDistributionSkewDoubleExponential_vv_836;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_837> AgradDistributionSkewDoubleExponential_vv_837;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_838> AgradDistributionSkewDoubleExponential_vv_838;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_839> AgradDistributionSkewDoubleExponential_vv_839;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_840> AgradDistributionSkewDoubleExponential_vv_840;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_841> AgradDistributionSkewDoubleExponential_vv_841;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_842> AgradDistributionSkewDoubleExponential_vv_842;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_843> AgradDistributionSkewDoubleExponential_vv_843;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_844> AgradDistributionSkewDoubleExponential_vv_844;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_845> AgradDistributionSkewDoubleExponential_vv_845;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_846> AgradDistributionSkewDoubleExponential_vv_846;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_847> AgradDistributionSkewDoubleExponential_vv_847;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_848> AgradDistributionSkewDoubleExponential_vv_848;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_849> AgradDistributionSkewDoubleExponential_vv_849;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_850> AgradDistributionSkewDoubleExponential_vv_850;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_851> AgradDistributionSkewDoubleExponential_vv_851;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_852> AgradDistributionSkewDoubleExponential_vv_852;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_853> AgradDistributionSkewDoubleExponential_vv_853;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_854> AgradDistributionSkewDoubleExponential_vv_854;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_855> AgradDistributionSkewDoubleExponential_vv_855;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_856> AgradDistributionSkewDoubleExponential_vv_856;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_857> AgradDistributionSkewDoubleExponential_vv_857;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_858> AgradDistributionSkewDoubleExponential_vv_858;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_859> AgradDistributionSkewDoubleExponential_vv_859;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_860> AgradDistributionSkewDoubleExponential_vv_860;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_861> AgradDistributionSkewDoubleExponential_vv_861;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_862> AgradDistributionSkewDoubleExponential_vv_862;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_863> AgradDistributionSkewDoubleExponential_vv_863;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_864> AgradDistributionSkewDoubleExponential_vv_864;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_865> AgradDistributionSkewDoubleExponential_vv_865;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_866> AgradDistributionSkewDoubleExponential_vv_866;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_867> AgradDistributionSkewDoubleExponential_vv_867;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_868> AgradDistributionSkewDoubleExponential_vv_868;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_869> AgradDistributionSkewDoubleExponential_vv_869;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_870> AgradDistributionSkewDoubleExponential_vv_870;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_871> AgradDistributionSkewDoubleExponential_vv_871;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_872> AgradDistributionSkewDoubleExponential_vv_872;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_873> AgradDistributionSkewDoubleExponential_vv_873;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_874> AgradDistributionSkewDoubleExponential_vv_874;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_875> AgradDistributionSkewDoubleExponential_vv_875;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_876> AgradDistributionSkewDoubleExponential_vv_876;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_877> AgradDistributionSkewDoubleExponential_vv_877;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_878> AgradDistributionSkewDoubleExponential_vv_878;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_879> AgradDistributionSkewDoubleExponential_vv_879;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_880> AgradDistributionSkewDoubleExponential_vv_880;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_881> AgradDistributionSkewDoubleExponential_vv_881;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_882> AgradDistributionSkewDoubleExponential_vv_882;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_883> AgradDistributionSkewDoubleExponential_vv_883;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_884> AgradDistributionSkewDoubleExponential_vv_884;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_885> AgradDistributionSkewDoubleExponential_vv_885;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_886> AgradDistributionSkewDoubleExponential_vv_886;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_887> AgradDistributionSkewDoubleExponential_vv_887;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_888> AgradDistributionSkewDoubleExponential_vv_888;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_889> AgradDistributionSkewDoubleExponential_vv_889;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_890> AgradDistributionSkewDoubleExponential_vv_890;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_891> AgradDistributionSkewDoubleExponential_vv_891;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_892> AgradDistributionSkewDoubleExponential_vv_892;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_893> AgradDistributionSkewDoubleExponential_vv_893;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_894> AgradDistributionSkewDoubleExponential_vv_894;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_895> AgradDistributionSkewDoubleExponential_vv_895;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_896> AgradDistributionSkewDoubleExponential_vv_896;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_897> AgradDistributionSkewDoubleExponential_vv_897;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_898> AgradDistributionSkewDoubleExponential_vv_898;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_899> AgradDistributionSkewDoubleExponential_vv_899;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_800, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_800);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_801, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_801);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_802, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_802);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_803, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_803);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_804, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_804);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_805, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_805);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_806, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_806);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_807, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_807);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_808, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_808);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_809, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_809);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_810, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_810);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_811, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_811);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_812, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_812);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_813, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_813);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_814, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_814);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_815, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_815);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_816, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_816);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_817, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_817);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_818, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_818);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_819, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_819);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_820, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_820);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_821, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_821);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_822, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_822);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_823, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_823);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_824, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_824);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_825, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_825);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_826, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_826);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_827, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_827);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_828, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_828);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_829, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_829);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_830, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_830);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_831, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_831);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_832, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_832);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_833, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_833);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_834, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_834);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_835, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_835);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_836, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_836);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_837, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_837);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_838, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_838);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_839, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_839);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_840, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_840);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_841, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_841);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_842, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_842);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_843, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_843);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_844, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_844);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_845, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_845);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_846, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_846);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_847, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_847);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_848, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_848);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_849, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_849);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_850, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_850);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_851, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_851);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_852, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_852);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_853, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_853);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_854, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_854);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_855, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_855);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_856, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_856);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_857, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_857);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_858, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_858);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_859, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_859);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_860, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_860);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_861, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_861);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_862, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_862);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_863, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_863);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_864, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_864);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_865, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_865);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_866, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_866);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_867, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_867);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_868, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_868);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_869, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_869);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_870, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_870);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_871, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_871);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_872, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_872);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_873, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_873);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_874, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_874);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_875, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_875);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_876, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_876);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_877, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_877);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_878, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_878);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_879, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_879);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_880, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_880);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_881, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_881);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_882, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_882);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_883, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_883);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_884, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_884);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_885, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_885);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_886, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_886);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_887, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_887);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_888, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_888);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_889, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_889);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_890, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_890);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_891, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_891);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_892, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_892);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_893, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_893);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_894, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_894);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_895, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_895);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_896, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_896);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_897, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_897);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_898, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_898);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_899, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_899);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/skew_double_exponential/skew_double_exponential_test.hpp>
+
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_900;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_901;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_902;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_903;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_904;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_905;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_906;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_907;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_908;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, double, empty, empty> type_ffv_909;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_910;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_911;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_912;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_913;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_914;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_915;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_916;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_917;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_918;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_919;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_920;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_921;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_922;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_923;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_924;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_925;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_926;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, double, empty, empty> type_ffv_927;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty, empty> type_ffv_928;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_929;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty, empty> type_ffv_930;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_931;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_932;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty, empty> type_ffv_933;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_934;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_935;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_936;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_937;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_938;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_939;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_940;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_941;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_942;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_943;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_944;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty, empty> type_ffv_945;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_946;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_947;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_948;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_949;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_950;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_951;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_952;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_953;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_954;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_955;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_956;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_957;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_958;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_959;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_960;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_961;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_962;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty, empty> type_ffv_963;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_ffv_964;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_965;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_966;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_967;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_968;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_ffv_969;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_970;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_971;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_972;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_973;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_974;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_975;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_976;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_977;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_978;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_979;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_980;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_981;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_982;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_983;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_984;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_985;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_986;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_987;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_988;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_989;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_990;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_991;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_992;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_993;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_994;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_995;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_996;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_997;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_998;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, double, empty, empty> type_ffv_999;
+
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_900> AgradDistributionSkewDoubleExponential_ffv_900;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_901> AgradDistributionSkewDoubleExponential_ffv_901;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_902> AgradDistributionSkewDoubleExponential_ffv_902;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_903> AgradDistributionSkewDoubleExponential_ffv_903;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_904> AgradDistributionSkewDoubleExponential_ffv_904;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_905> AgradDistributionSkewDoubleExponential_ffv_905;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_906> AgradDistributionSkewDoubleExponential_ffv_906;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_907> AgradDistributionSkewDoubleExponential_ffv_907;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_908> AgradDistributionSkewDoubleExponential_ffv_908;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_909> AgradDistributionSkewDoubleExponential_ffv_909;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_910> AgradDistributionSkewDoubleExponential_ffv_910;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_911> AgradDistributionSkewDoubleExponential_ffv_911;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_912> AgradDistributionSkewDoubleExponential_ffv_912;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_913> AgradDistributionSkewDoubleExponential_ffv_913;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_914> AgradDistributionSkewDoubleExponential_ffv_914;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_915> AgradDistributionSkewDoubleExponential_ffv_915;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_916> AgradDistributionSkewDoubleExponential_ffv_916;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_917> AgradDistributionSkewDoubleExponential_ffv_917;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_918> AgradDistributionSkewDoubleExponential_ffv_918;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_919> AgradDistributionSkewDoubleExponential_ffv_919;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_920> AgradDistributionSkewDoubleExponential_ffv_920;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_921> AgradDistributionSkewDoubleExponential_ffv_921;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_922> AgradDistributionSkewDoubleExponential_ffv_922;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_923> AgradDistributionSkewDoubleExponential_ffv_923;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_924> AgradDistributionSkewDoubleExponential_ffv_924;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_925> AgradDistributionSkewDoubleExponential_ffv_925;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_926> AgradDistributionSkewDoubleExponential_ffv_926;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_927> AgradDistributionSkewDoubleExponential_ffv_927;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_928> AgradDistributionSkewDoubleExponential_ffv_928;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_929> AgradDistributionSkewDoubleExponential_ffv_929;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_930> AgradDistributionSkewDoubleExponential_ffv_930;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_931> AgradDistributionSkewDoubleExponential_ffv_931;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_932> AgradDistributionSkewDoubleExponential_ffv_932;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_933> AgradDistributionSkewDoubleExponential_ffv_933;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_934> AgradDistributionSkewDoubleExponential_ffv_934;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_935> AgradDistributionSkewDoubleExponential_ffv_935;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_936> AgradDistributionSkewDoubleExponential_ffv_936;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_937> AgradDistributionSkewDoubleExponential_ffv_937;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_938> AgradDistributionSkewDoubleExponential_ffv_938;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_939> AgradDistributionSkewDoubleExponential_ffv_939;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_940> AgradDistributionSkewDoubleExponential_ffv_940;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_941> AgradDistributionSkewDoubleExponential_ffv_941;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_942> AgradDistributionSkewDoubleExponential_ffv_942;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_943> AgradDistributionSkewDoubleExponential_ffv_943;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_944> AgradDistributionSkewDoubleExponential_ffv_944;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_945> AgradDistributionSkewDoubleExponential_ffv_945;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_946> AgradDistributionSkewDoubleExponential_ffv_946;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_947> AgradDistributionSkewDoubleExponential_ffv_947;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_948> AgradDistributionSkewDoubleExponential_ffv_948;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_949> AgradDistributionSkewDoubleExponential_ffv_949;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_950> AgradDistributionSkewDoubleExponential_ffv_950;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_951> AgradDistributionSkewDoubleExponential_ffv_951;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_952> AgradDistributionSkewDoubleExponential_ffv_952;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_953> AgradDistributionSkewDoubleExponential_ffv_953;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_954> AgradDistributionSkewDoubleExponential_ffv_954;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_955> AgradDistributionSkewDoubleExponential_ffv_955;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_956> AgradDistributionSkewDoubleExponential_ffv_956;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_957> AgradDistributionSkewDoubleExponential_ffv_957;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_958> AgradDistributionSkewDoubleExponential_ffv_958;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_959> AgradDistributionSkewDoubleExponential_ffv_959;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_960> AgradDistributionSkewDoubleExponential_ffv_960;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_961> AgradDistributionSkewDoubleExponential_ffv_961;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_962> AgradDistributionSkewDoubleExponential_ffv_962;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_963> AgradDistributionSkewDoubleExponential_ffv_963;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_964> AgradDistributionSkewDoubleExponential_ffv_964;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_965> AgradDistributionSkewDoubleExponential_ffv_965;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_966> AgradDistributionSkewDoubleExponential_ffv_966;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_967> AgradDistributionSkewDoubleExponential_ffv_967;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_968> AgradDistributionSkewDoubleExponential_ffv_968;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_969> AgradDistributionSkewDoubleExponential_ffv_969;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_970> AgradDistributionSkewDoubleExponential_ffv_970;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_971> AgradDistributionSkewDoubleExponential_ffv_971;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_972> AgradDistributionSkewDoubleExponential_ffv_972;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_973> AgradDistributionSkewDoubleExponential_ffv_973;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_974> AgradDistributionSkewDoubleExponential_ffv_974;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_975> AgradDistributionSkewDoubleExponential_ffv_975;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_976> AgradDistributionSkewDoubleExponential_ffv_976;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_977> AgradDistributionSkewDoubleExponential_ffv_977;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_978> AgradDistributionSkewDoubleExponential_ffv_978;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_979> AgradDistributionSkewDoubleExponential_ffv_979;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_980> AgradDistributionSkewDoubleExponential_ffv_980;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_981> AgradDistributionSkewDoubleExponential_ffv_981;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_982> AgradDistributionSkewDoubleExponential_ffv_982;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_983> AgradDistributionSkewDoubleExponential_ffv_983;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_984> AgradDistributionSkewDoubleExponential_ffv_984;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_985> AgradDistributionSkewDoubleExponential_ffv_985;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_986> AgradDistributionSkewDoubleExponential_ffv_986;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_987> AgradDistributionSkewDoubleExponential_ffv_987;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_988> AgradDistributionSkewDoubleExponential_ffv_988;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_989> AgradDistributionSkewDoubleExponential_ffv_989;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_990> AgradDistributionSkewDoubleExponential_ffv_990;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_991> AgradDistributionSkewDoubleExponential_ffv_991;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_992> AgradDistributionSkewDoubleExponential_ffv_992;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_993> AgradDistributionSkewDoubleExponential_ffv_993;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_994> AgradDistributionSkewDoubleExponential_ffv_994;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_995> AgradDistributionSkewDoubleExponential_ffv_995;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_996> AgradDistributionSkewDoubleExponential_ffv_996;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_997> AgradDistributionSkewDoubleExponential_ffv_997;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_998> AgradDistributionSkewDoubleExponential_ffv_998;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_999> AgradDistributionSkewDoubleExponential_ffv_999;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_900, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_900);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_901, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_901);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_902, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_902);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_903, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_903);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_904, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_904);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_905, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_905);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_906, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_906);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_907, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_907);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_908, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_908);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_909, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_909);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_910, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_910);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_911, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_911);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_912, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_912);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_913, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_913);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_914, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_914);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_915, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_915);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_916, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_916);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_917, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_917);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_918, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_918);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_919, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_919);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_920, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_920);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_921, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_921);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_922, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_922);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_923, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_923);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_924, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_924);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_925, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_925);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_926, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_926);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_927, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_927);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_928, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_928);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_929, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_929);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_930, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_930);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_931, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_931);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_932, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_932);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_933, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_933);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_934, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_934);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_935, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_935);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_936, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_936);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_937, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_937);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_938, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_938);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_939, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_939);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_940, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_940);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_941, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_941);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_942, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_942);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_943, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_943);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_944, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_944);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_945, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_945);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_946, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_946);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_947, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_947);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_948, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_948);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_949, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_949);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_950, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_950);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_951, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_951);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_952, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_952);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_953, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_953);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_954, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_954);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_955, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_955);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_956, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_956);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_957, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_957);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_958, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_958);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_959, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_959);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_960, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_960);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_961, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_961);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_962, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_962);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_963, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_963);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_964, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_964);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_965, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_965);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_966, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_966);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_967, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_967);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_968, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_968);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_969, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_969);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_970, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_970);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_971, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_971);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_972, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_972);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_973, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_973);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_974, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_974);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_975, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_975);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_976, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_976);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_977, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_977);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_978, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_978);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_979, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_979);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_980, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_980);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_981, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_981);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_982, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_982);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_983, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_983);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_984, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_984);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_985, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_985);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_986, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_986);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_987, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_987);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_988, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_988);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_989, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_989);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_990, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_990);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_991, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_991);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_992, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_992);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_993, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_993);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_994, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_994);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_995, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_995);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_996, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_996);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_997, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_997);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_998, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_998);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_999, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_999);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/skew_double_exponential/skew_double_exponential_test.hpp>
+
+typedef std::tuple<std::vector<var>, std::vector<double>, double, double, empty, empty> type_v_900;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, std::vector<double>, empty, empty> type_v_901;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_902;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, var, empty, empty> type_v_903;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, std::vector<var>, empty, empty> type_v_904;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_905;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, double, empty, empty> type_v_906;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, std::vector<double>, empty, empty> type_v_907;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_908;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, var, empty, empty> type_v_909;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_v_910;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_911;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_912;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_913;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_914;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_915;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_916;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_917;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, double, empty, empty> type_v_918;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, std::vector<double>, empty, empty> type_v_919;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_920;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, var, empty, empty> type_v_921;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, std::vector<var>, empty, empty> type_v_922;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_923;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, double, empty, empty> type_v_924;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_v_925;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_926;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, var, empty, empty> type_v_927;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_v_928;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_929;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_930;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_931;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_932;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_933;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_934;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_935;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_936;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_937;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_938;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_939;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_940;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_941;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_942;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_943;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_944;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_945;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_946;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_947;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_948;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_949;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_950;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_951;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_952;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_953;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_954;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_955;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_956;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_957;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_958;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_959;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_960;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_961;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_962;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_963;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_964;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_965;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_966;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_967;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_968;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_969;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_970;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_971;
+typedef std::tuple<std::vector<var>, var, double, double, empty, empty> type_v_972;
+typedef std::tuple<std::vector<var>, var, double, std::vector<double>, empty, empty> type_v_973;
+typedef std::tuple<std::vector<var>, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_974;
+typedef std::tuple<std::vector<var>, var, double, var, empty, empty> type_v_975;
+typedef std::tuple<std::vector<var>, var, double, std::vector<var>, empty, empty> type_v_976;
+typedef std::tuple<std::vector<var>, var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_977;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, double, empty, empty> type_v_978;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, std::vector<double>, empty, empty> type_v_979;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_980;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, var, empty, empty> type_v_981;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, std::vector<var>, empty, empty> type_v_982;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_983;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_984;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_985;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_986;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_987;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_988;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_989;
+typedef std::tuple<std::vector<var>, var, var, double, empty, empty> type_v_990;
+typedef std::tuple<std::vector<var>, var, var, std::vector<double>, empty, empty> type_v_991;
+typedef std::tuple<std::vector<var>, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_992;
+typedef std::tuple<std::vector<var>, var, var, var, empty, empty> type_v_993;
+typedef std::tuple<std::vector<var>, var, var, std::vector<var>, empty, empty> type_v_994;
+typedef std::tuple<std::vector<var>, var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_995;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, double, empty, empty> type_v_996;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, std::vector<double>, empty, empty> type_v_997;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_998;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, var, empty, empty> type_v_999;
+
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_900> AgradDistributionSkewDoubleExponential_v_900;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_901> AgradDistributionSkewDoubleExponential_v_901;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_902> AgradDistributionSkewDoubleExponential_v_902;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_903> AgradDistributionSkewDoubleExponential_v_903;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_904> AgradDistributionSkewDoubleExponential_v_904;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_905> AgradDistributionSkewDoubleExponential_v_905;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_906> AgradDistributionSkewDoubleExponential_v_906;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_907> AgradDistributionSkewDoubleExponential_v_907;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_908> AgradDistributionSkewDoubleExponential_v_908;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_909> AgradDistributionSkewDoubleExponential_v_909;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_910> AgradDistributionSkewDoubleExponential_v_910;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_911> AgradDistributionSkewDoubleExponential_v_911;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_912> AgradDistributionSkewDoubleExponential_v_912;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_913> AgradDistributionSkewDoubleExponential_v_913;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_914> AgradDistributionSkewDoubleExponential_v_914;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_915> AgradDistributionSkewDoubleExponential_v_915;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_916> AgradDistributionSkewDoubleExponential_v_916;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_917> AgradDistributionSkewDoubleExponential_v_917;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_918> AgradDistributionSkewDoubleExponential_v_918;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_919> AgradDistributionSkewDoubleExponential_v_919;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_920> AgradDistributionSkewDoubleExponential_v_920;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_921> AgradDistributionSkewDoubleExponential_v_921;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_922> AgradDistributionSkewDoubleExponential_v_922;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_923> AgradDistributionSkewDoubleExponential_v_923;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_924> AgradDistributionSkewDoubleExponential_v_924;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_925> AgradDistributionSkewDoubleExponential_v_925;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_926> AgradDistributionSkewDoubleExponential_v_926;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_927> AgradDistributionSkewDoubleExponential_v_927;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_928> AgradDistributionSkewDoubleExponential_v_928;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_929> AgradDistributionSkewDoubleExponential_v_929;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_930> AgradDistributionSkewDoubleExponential_v_930;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_931> AgradDistributionSkewDoubleExponential_v_931;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_932> AgradDistributionSkewDoubleExponential_v_932;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_933> AgradDistributionSkewDoubleExponential_v_933;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_934> AgradDistributionSkewDoubleExponential_v_934;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_935> AgradDistributionSkewDoubleExponential_v_935;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_936> AgradDistributionSkewDoubleExponential_v_936;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_937> AgradDistributionSkewDoubleExponential_v_937;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_938> AgradDistributionSkewDoubleExponential_v_938;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_939> AgradDistributionSkewDoubleExponential_v_939;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_940> AgradDistributionSkewDoubleExponential_v_940;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_941> AgradDistributionSkewDoubleExponential_v_941;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_942> AgradDistributionSkewDoubleExponential_v_942;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_943> AgradDistributionSkewDoubleExponential_v_943;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_944> AgradDistributionSkewDoubleExponential_v_944;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_945> AgradDistributionSkewDoubleExponential_v_945;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_946> AgradDistributionSkewDoubleExponential_v_946;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_947> AgradDistributionSkewDoubleExponential_v_947;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_948> AgradDistributionSkewDoubleExponential_v_948;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_949> AgradDistributionSkewDoubleExponential_v_949;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_950> AgradDistributionSkewDoubleExponential_v_950;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_951> AgradDistributionSkewDoubleExponential_v_951;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_952> AgradDistributionSkewDoubleExponential_v_952;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_953> AgradDistributionSkewDoubleExponential_v_953;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_954> AgradDistributionSkewDoubleExponential_v_954;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_955> AgradDistributionSkewDoubleExponential_v_955;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_956> AgradDistributionSkewDoubleExponential_v_956;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_957> AgradDistributionSkewDoubleExponential_v_957;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_958> AgradDistributionSkewDoubleExponential_v_958;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_959> AgradDistributionSkewDoubleExponential_v_959;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_960> AgradDistributionSkewDoubleExponential_v_960;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_961> AgradDistributionSkewDoubleExponential_v_961;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_962> AgradDistributionSkewDoubleExponential_v_962;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_963> AgradDistributionSkewDoubleExponential_v_963;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_964> AgradDistributionSkewDoubleExponential_v_964;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_965> AgradDistributionSkewDoubleExponential_v_965;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_966> AgradDistributionSkewDoubleExponential_v_966;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_967> AgradDistributionSkewDoubleExponential_v_967;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_968> AgradDistributionSkewDoubleExponential_v_968;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_969> AgradDistributionSkewDoubleExponential_v_969;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_970> AgradDistributionSkewDoubleExponential_v_970;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_971> AgradDistributionSkewDoubleExponential_v_971;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_972> AgradDistributionSkewDoubleExponential_v_972;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_973> AgradDistributionSkewDoubleExponential_v_973;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_974> AgradDistributionSkewDoubleExponential_v_974;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_975> AgradDistributionSkewDoubleExponential_v_975;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_976> AgradDistributionSkewDoubleExponential_v_976;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_977> AgradDistributionSkewDoubleExponential_v_977;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_978> AgradDistributionSkewDoubleExponential_v_978;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_979> AgradDistributionSkewDoubleExponential_v_979;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_980> AgradDistributionSkewDoubleExponential_v_980;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_981> AgradDistributionSkewDoubleExponential_v_981;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_982> AgradDistributionSkewDoubleExponential_v_982;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_983> AgradDistributionSkewDoubleExponential_v_983;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_984> AgradDistributionSkewDoubleExponential_v_984;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_985> AgradDistributionSkewDoubleExponential_v_985;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_986> AgradDistributionSkewDoubleExponential_v_986;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_987> AgradDistributionSkewDoubleExponential_v_987;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_988> AgradDistributionSkewDoubleExponential_v_988;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_989> AgradDistributionSkewDoubleExponential_v_989;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_990> AgradDistributionSkewDoubleExponential_v_990;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_991> AgradDistributionSkewDoubleExponential_v_991;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_992> AgradDistributionSkewDoubleExponential_v_992;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_993> AgradDistributionSkewDoubleExponential_v_993;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_994> AgradDistributionSkewDoubleExponential_v_994;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_995> AgradDistributionSkewDoubleExponential_v_995;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_996> AgradDistributionSkewDoubleExponential_v_996;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_997> AgradDistributionSkewDoubleExponential_v_997;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_998> AgradDistributionSkewDoubleExponential_v_998;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_999> AgradDistributionSkewDoubleExponential_v_999;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_900, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_900);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_901, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_901);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_902, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_902);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_903, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_903);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_904, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_904);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_905, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_905);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_906, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_906);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_907, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_907);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_908, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_908);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_909, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_909);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_910, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_910);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_911, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_911);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_912, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_912);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_913, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_913);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_914, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_914);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_915, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_915);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_916, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_916);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_917, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_917);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_918, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_918);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_919, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_919);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_920, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_920);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_921, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_921);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_922, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_922);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_923, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_923);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_924, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_924);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_925, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_925);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_926, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_926);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_927, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_927);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_928, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_928);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_929, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_929);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_930, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_930);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_931, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_931);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_932, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_932);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_933, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_933);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_934, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_934);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_935, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_935);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_936, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_936);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_937, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_937);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_938, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_938);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_939, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_939);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_940, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_940);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_941, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_941);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_942, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_942);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_943, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_943);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_944, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_944);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_945, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_945);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_946, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_946);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_947, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_947);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_948, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_948);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_949, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_949);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_950, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_950);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_951, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_951);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_952, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_952);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_953, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_953);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_954, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_954);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_955, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_955);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_956, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_956);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_957, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_957);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_958, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_958);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_959, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_959);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_960, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_960);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_961, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_961);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_962, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_962);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_963, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_963);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_964, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_964);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_965, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_965);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_966, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_966);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_967, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_967);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_968, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_968);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_969, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_969);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_970, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_970);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_971, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_971);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_972, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_972);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_973, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_973);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_974, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_974);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_975, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_975);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_976, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_976);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_977, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_977);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_978, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_978);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_979, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_979);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_980, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_980);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_981, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_981);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_982, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_982);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_983, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_983);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_984, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_984);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_985, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_985);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_986, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_986);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_987, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_987);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_988, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_988);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_989, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_989);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_990, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_990);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_991, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_991);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_992, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_992);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_993, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_993);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_994, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_994);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_995, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_995);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_996, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_996);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_997, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_997);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_998, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_998);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_999, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_999);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/skew_double_exponential/skew_double_exponential_test.hpp>
+
+typedef std::tuple<std::vector<var>, var, std::vector<double>, var, empty, empty> type_vv_900;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, std::vector<var>, empty, empty> type_vv_901;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_902;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_903;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_904;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_905;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_906;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_907;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_908;
+typedef std::tuple<std::vector<var>, var, var, double, empty, empty> type_vv_909;
+typedef std::tuple<std::vector<var>, var, var, std::vector<double>, empty, empty> type_vv_910;
+typedef std::tuple<std::vector<var>, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_911;
+typedef std::tuple<std::vector<var>, var, var, var, empty, empty> type_vv_912;
+typedef std::tuple<std::vector<var>, var, var, std::vector<var>, empty, empty> type_vv_913;
+typedef std::tuple<std::vector<var>, var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_914;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, double, empty, empty> type_vv_915;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, std::vector<double>, empty, empty> type_vv_916;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_917;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, var, empty, empty> type_vv_918;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, std::vector<var>, empty, empty> type_vv_919;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_920;
+typedef std::tuple<std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_921;
+typedef std::tuple<std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_922;
+typedef std::tuple<std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_923;
+typedef std::tuple<std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_924;
+typedef std::tuple<std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_925;
+typedef std::tuple<std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_926;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, double, empty, empty> type_vv_927;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, std::vector<double>, empty, empty> type_vv_928;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_929;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, var, empty, empty> type_vv_930;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, std::vector<var>, empty, empty> type_vv_931;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_932;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, double, empty, empty> type_vv_933;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_vv_934;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_935;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, var, empty, empty> type_vv_936;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_vv_937;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_938;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_939;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_940;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_941;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_942;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_943;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_944;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, double, empty, empty> type_vv_945;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, std::vector<double>, empty, empty> type_vv_946;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_947;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, var, empty, empty> type_vv_948;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, std::vector<var>, empty, empty> type_vv_949;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_950;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, double, empty, empty> type_vv_951;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_vv_952;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_953;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, var, empty, empty> type_vv_954;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_vv_955;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_956;
+typedef std::tuple<std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_957;
+typedef std::tuple<std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_958;
+typedef std::tuple<std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_959;
+typedef std::tuple<std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_960;
+typedef std::tuple<std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_961;
+typedef std::tuple<std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_962;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, empty, empty> type_vv_963;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, empty, empty> type_vv_964;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_965;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, empty, empty> type_vv_966;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, empty, empty> type_vv_967;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_968;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, empty, empty> type_vv_969;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, empty, empty> type_vv_970;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_971;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, empty, empty> type_vv_972;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, empty, empty> type_vv_973;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_974;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_975;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_976;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_977;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_978;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_979;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_980;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, empty, empty> type_vv_981;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, empty, empty> type_vv_982;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_983;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, empty, empty> type_vv_984;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, empty, empty> type_vv_985;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_986;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, empty, empty> type_vv_987;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, empty, empty> type_vv_988;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_989;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, empty, empty> type_vv_990;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, empty, empty> type_vv_991;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_992;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_993;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_994;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_995;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_996;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_997;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_998;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, double, empty, empty> type_vv_999;
+
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_900> AgradDistributionSkewDoubleExponential_vv_900;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_901> AgradDistributionSkewDoubleExponential_vv_901;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_902> AgradDistributionSkewDoubleExponential_vv_902;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_903> AgradDistributionSkewDoubleExponential_vv_903;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_904> AgradDistributionSkewDoubleExponential_vv_904;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_905> AgradDistributionSkewDoubleExponential_vv_905;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_906> AgradDistributionSkewDoubleExponential_vv_906;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_907> AgradDistributionSkewDoubleExponential_vv_907;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_908> AgradDistributionSkewDoubleExponential_vv_908;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_909> AgradDistributionSkewDoubleExponential_vv_909;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_910> AgradDistributionSkewDoubleExponential_vv_910;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_911> AgradDistributionSkewDoubleExponential_vv_911;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_912> AgradDistributionSkewDoubleExponential_vv_912;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_913> AgradDistributionSkewDoubleExponential_vv_913;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_914> AgradDistributionSkewDoubleExponential_vv_914;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_915> AgradDistributionSkewDoubleExponential_vv_915;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_916> AgradDistributionSkewDoubleExponential_vv_916;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_917> AgradDistributionSkewDoubleExponential_vv_917;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_918> AgradDistributionSkewDoubleExponential_vv_918;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_919> AgradDistributionSkewDoubleExponential_vv_919;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_920> AgradDistributionSkewDoubleExponential_vv_920;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_921> AgradDistributionSkewDoubleExponential_vv_921;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_922> AgradDistributionSkewDoubleExponential_vv_922;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_923> AgradDistributionSkewDoubleExponential_vv_923;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_924> AgradDistributionSkewDoubleExponential_vv_924;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_925> AgradDistributionSkewDoubleExponential_vv_925;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_926> AgradDistributionSkewDoubleExponential_vv_926;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_927> AgradDistributionSkewDoubleExponential_vv_927;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_928> AgradDistributionSkewDoubleExponential_vv_928;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_929> AgradDistributionSkewDoubleExponential_vv_929;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_930> AgradDistributionSkewDoubleExponential_vv_930;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_931> AgradDistributionSkewDoubleExponential_vv_931;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_932> AgradDistributionSkewDoubleExponential_vv_932;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_933> AgradDistributionSkewDoubleExponential_vv_933;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_934> AgradDistributionSkewDoubleExponential_vv_934;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_935> AgradDistributionSkewDoubleExponential_vv_935;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_936> AgradDistributionSkewDoubleExponential_vv_936;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_937> AgradDistributionSkewDoubleExponential_vv_937;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_938> AgradDistributionSkewDoubleExponential_vv_938;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_939> AgradDistributionSkewDoubleExponential_vv_939;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_940> AgradDistributionSkewDoubleExponential_vv_940;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_941> AgradDistributionSkewDoubleExponential_vv_941;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_942> AgradDistributionSkewDoubleExponential_vv_942;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_943> AgradDistributionSkewDoubleExponential_vv_943;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_944> AgradDistributionSkewDoubleExponential_vv_944;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_945> AgradDistributionSkewDoubleExponential_vv_945;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_946> AgradDistributionSkewDoubleExponential_vv_946;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_947> AgradDistributionSkewDoubleExponential_vv_947;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_948> AgradDistributionSkewDoubleExponential_vv_948;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_949> AgradDistributionSkewDoubleExponential_vv_949;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_950> AgradDistributionSkewDoubleExponential_vv_950;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_951> AgradDistributionSkewDoubleExponential_vv_951;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_952> AgradDistributionSkewDoubleExponential_vv_952;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_953> AgradDistributionSkewDoubleExponential_vv_953;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_954> AgradDistributionSkewDoubleExponential_vv_954;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_955> AgradDistributionSkewDoubleExponential_vv_955;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_956> AgradDistributionSkewDoubleExponential_vv_956;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_957> AgradDistributionSkewDoubleExponential_vv_957;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_958> AgradDistributionSkewDoubleExponential_vv_958;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_959> AgradDistributionSkewDoubleExponential_vv_959;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_960> AgradDistributionSkewDoubleExponential_vv_960;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_961> AgradDistributionSkewDoubleExponential_vv_961;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_962> AgradDistributionSkewDoubleExponential_vv_962;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_963> AgradDistributionSkewDoubleExponential_vv_963;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_964> AgradDistributionSkewDoubleExponential_vv_964;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_965> AgradDistributionSkewDoubleExponential_vv_965;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_966> AgradDistributionSkewDoubleExponential_vv_966;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_967> AgradDistributionSkewDoubleExponential_vv_967;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_968> AgradDistributionSkewDoubleExponential_vv_968;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_969> AgradDistributionSkewDoubleExponential_vv_969;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_970> AgradDistributionSkewDoubleExponential_vv_970;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_971> AgradDistributionSkewDoubleExponential_vv_971;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_972> AgradDistributionSkewDoubleExponential_vv_972;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_973> AgradDistributionSkewDoubleExponential_vv_973;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_974> AgradDistributionSkewDoubleExponential_vv_974;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_975> AgradDistributionSkewDoubleExponential_vv_975;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_976> AgradDistributionSkewDoubleExponential_vv_976;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_977> AgradDistributionSkewDoubleExponential_vv_977;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_978> AgradDistributionSkewDoubleExponential_vv_978;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_979> AgradDistributionSkewDoubleExponential_vv_979;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_980> AgradDistributionSkewDoubleExponential_vv_980;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_981> AgradDistributionSkewDoubleExponential_vv_981;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_982> AgradDistributionSkewDoubleExponential_vv_982;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_983> AgradDistributionSkewDoubleExponential_vv_983;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_984> AgradDistributionSkewDoubleExponential_vv_984;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_985> AgradDistributionSkewDoubleExponential_vv_985;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_986> AgradDistributionSkewDoubleExponential_vv_986;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_987> AgradDistributionSkewDoubleExponential_vv_987;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_988> AgradDistributionSkewDoubleExponential_vv_988;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_989> AgradDistributionSkewDoubleExponential_vv_989;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_990> AgradDistributionSkewDoubleExponential_vv_990;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_991> AgradDistributionSkewDoubleExponential_vv_991;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_992> AgradDistributionSkewDoubleExponential_vv_992;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_993> AgradDistributionSkewDoubleExponential_vv_993;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_994> AgradDistributionSkewDoubleExponential_vv_994;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_995> AgradDistributionSkewDoubleExponential_vv_995;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_996> AgradDistributionSkewDoubleExponential_vv_996;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_997> AgradDistributionSkewDoubleExponential_vv_997;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_998> AgradDistributionSkewDoubleExponential_vv_998;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_vv_999> AgradDistributionSkewDoubleExponential_vv_999;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_900, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_900);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_901, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_901);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_902, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_902);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_903, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_903);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_904, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_904);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_905, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_905);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_906, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_906);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_907, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_907);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_908, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_908);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_909, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_909);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_910, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_910);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_911, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_911);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_912, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_912);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_913, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_913);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_914, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_914);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_915, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_915);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_916, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_916);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_917, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_917);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_918, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_918);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_919, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_919);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_920, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_920);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_921, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_921);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_922, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_922);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_923, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_923);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_924, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_924);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_925, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_925);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_926, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_926);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_927, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_927);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_928, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_928);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_929, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_929);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_930, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_930);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_931, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_931);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_932, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_932);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_933, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_933);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_934, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_934);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_935, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_935);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_936, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_936);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_937, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_937);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_938, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_938);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_939, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_939);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_940, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_940);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_941, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_941);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_942, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_942);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_943, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_943);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_944, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_944);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_945, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_945);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_946, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_946);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_947, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_947);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_948, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_948);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_949, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_949);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_950, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_950);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_951, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_951);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_952, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_952);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_953, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_953);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_954, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_954);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_955, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_955);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_956, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_956);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_957, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_957);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_958, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_958);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_959, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_959);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_960, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_960);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_961, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_961);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_962, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_962);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_963, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_963);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_964, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_964);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_965, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_965);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_966, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_966);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_967, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_967);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_968, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_968);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_969, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_969);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_970, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_970);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_971, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_971);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_972, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_972);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_973, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_973);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_974, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_974);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_975, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_975);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_976, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_976);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_977, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_977);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_978, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_978);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_979, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_979);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_980, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_980);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_981, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_981);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_982, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_982);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_983, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_983);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_984, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_984);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_985, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_985);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_986, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_986);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_987, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_987);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_988, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_988);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_989, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_989);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_990, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_990);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_991, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_991);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_992, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_992);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_993, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_993);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_994, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_994);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_995, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_995);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_996, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_996);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_997, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_997);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_998, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_998);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_vv_999, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_vv_999);
+
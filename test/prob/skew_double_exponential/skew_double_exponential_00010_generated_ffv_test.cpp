@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/skew_double_exponential/skew_double_exponential_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, std::vector<double>, empty, empty> type_ffv_1000;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1001;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, fvar<fvar<var> >, empty, empty> type_ffv_1002;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1003;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1004;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, double, empty, empty> type_ffv_1005;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, std::vector<double>, empty, empty> type_ffv_1006;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1007;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_1008;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1009;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1010;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_1011;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_1012;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1013;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_1014;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1015;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1016;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, double, empty, empty> type_ffv_1017;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_1018;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1019;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_1020;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1021;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1022;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_1023;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_1024;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1025;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_1026;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1027;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1028;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_1029;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_1030;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1031;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_1032;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1033;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1034;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, double, empty, empty> type_ffv_1035;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, std::vector<double>, empty, empty> type_ffv_1036;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1037;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, fvar<fvar<var> >, empty, empty> type_ffv_1038;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1039;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1040;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, double, empty, empty> type_ffv_1041;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_1042;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1043;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_1044;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1045;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1046;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_1047;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_1048;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1049;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_1050;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1051;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1052;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, double, empty, empty> type_ffv_1053;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_1054;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1055;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_1056;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1057;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1058;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_1059;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_1060;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1061;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_1062;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1063;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1064;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_1065;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_1066;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1067;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_1068;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1069;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1070;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty> type_ffv_1071;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_ffv_1072;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1073;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_1074;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1075;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1076;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_ffv_1077;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_1078;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1079;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_1080;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1081;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1082;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_1083;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_1084;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1085;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_1086;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1087;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1088;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_1089;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_1090;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1091;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_1092;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1093;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_1094;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_1095;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_1096;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_1097;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_1098;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1099;
+
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_1000> AgradDistributionSkewDoubleExponential_ffv_1000;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_1001> AgradDistributionSkewDoubleExponential_ffv_1001;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_1002> AgradDistributionSkewDoubleExponential_ffv_1002;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_1003> AgradDistributionSkewDoubleExponential_ffv_1003;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_1004> AgradDistributionSkewDoubleExponential_ffv_1004;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_1005> AgradDistributionSkewDoubleExponential_ffv_1005;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_1006> AgradDistributionSkewDoubleExponential_ffv_1006;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_1007> AgradDistributionSkewDoubleExponential_ffv_1007;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_1008> AgradDistributionSkewDoubleExponential_ffv_1008;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_1009> AgradDistributionSkewDoubleExponential_ffv_1009;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_1010> AgradDistributionSkewDoubleExponential_ffv_1010;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_1011> AgradDistributionSkewDoubleExponential_ffv_1011;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_1012> AgradDistributionSkewDoubleExponential_ffv_1012;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_1013> AgradDistributionSkewDoubleExponential_ffv_1013;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_1014> AgradDistributionSkewDoubleExponential_ffv_1014;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_1015> AgradDistributionSkewDoubleExponential_ffv_1015;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_1016> AgradDistributionSkewDoubleExponential_ffv_1016;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_1017> AgradDistributionSkewDoubleExponential_ffv_1017;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_1018> AgradDistributionSkewDoubleExponential_ffv_1018;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_1019> AgradDistributionSkewDoubleExponential_ffv_1019;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_1020> AgradDistributionSkewDoubleExponential_ffv_1020;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_1021> AgradDistributionSkewDoubleExponential_ffv_1021;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_1022> AgradDistributionSkewDoubleExponential_ffv_1022;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_1023> AgradDistributionSkewDoubleExponential_ffv_1023;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_1024> AgradDistributionSkewDoubleExponential_ffv_1024;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_1025> AgradDistributionSkewDoubleExponential_ffv_1025;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_1026> AgradDistributionSkewDoubleExponential_ffv_1026;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_1027> AgradDistributionSkewDoubleExponential_ffv_1027;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_1028> AgradDistributionSkewDoubleExponential_ffv_1028;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_1029> AgradDistributionSkewDoubleExponential_ffv_1029;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_1030> AgradDistributionSkewDoubleExponential_ffv_1030;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_1031> AgradDistributionSkewDoubleExponential_ffv_1031;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_1032> AgradDistributionSkewDoubleExponential_ffv_1032;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_1033> AgradDistributionSkewDoubleExponential_ffv_1033;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_1034> AgradDistributionSkewDoubleExponential_ffv_1034;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_1035> AgradDistributionSkewDoubleExponential_ffv_1035;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_1036> AgradDistributionSkewDoubleExponential_ffv_1036;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_1037> AgradDistributionSkewDoubleExponential_ffv_1037;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_1038> AgradDistributionSkewDoubleExponential_ffv_1038;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_1039> AgradDistributionSkewDoubleExponential_ffv_1039;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_1040> AgradDistributionSkewDoubleExponential_ffv_1040;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_1041> AgradDistributionSkewDoubleExponential_ffv_1041;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_1042> AgradDistributionSkewDoubleExponential_ffv_1042;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_1043> AgradDistributionSkewDoubleExponential_ffv_1043;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_1044> AgradDistributionSkewDoubleExponential_ffv_1044;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_1045> AgradDistributionSkewDoubleExponential_ffv_1045;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_1046> AgradDistributionSkewDoubleExponential_ffv_1046;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_1047> AgradDistributionSkewDoubleExponential_ffv_1047;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_1048> AgradDistributionSkewDoubleExponential_ffv_1048;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_1049> AgradDistributionSkewDoubleExponential_ffv_1049;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_1050> AgradDistributionSkewDoubleExponential_ffv_1050;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_1051> AgradDistributionSkewDoubleExponential_ffv_1051;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_1052> AgradDistributionSkewDoubleExponential_ffv_1052;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_1053> AgradDistributionSkewDoubleExponential_ffv_1053;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_1054> AgradDistributionSkewDoubleExponential_ffv_1054;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_1055> AgradDistributionSkewDoubleExponential_ffv_1055;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_1056> AgradDistributionSkewDoubleExponential_ffv_1056;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_1057> AgradDistributionSkewDoubleExponential_ffv_1057;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_1058> AgradDistributionSkewDoubleExponential_ffv_1058;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_1059> AgradDistributionSkewDoubleExponential_ffv_1059;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_1060> AgradDistributionSkewDoubleExponential_ffv_1060;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_1061> AgradDistributionSkewDoubleExponential_ffv_1061;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_1062> AgradDistributionSkewDoubleExponential_ffv_1062;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_1063> AgradDistributionSkewDoubleExponential_ffv_1063;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_1064> AgradDistributionSkewDoubleExponential_ffv_1064;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_1065> AgradDistributionSkewDoubleExponential_ffv_1065;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_1066> AgradDistributionSkewDoubleExponential_ffv_1066;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_1067> AgradDistributionSkewDoubleExponential_ffv_1067;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_1068> AgradDistributionSkewDoubleExponential_ffv_1068;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_1069> AgradDistributionSkewDoubleExponential_ffv_1069;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_1070> AgradDistributionSkewDoubleExponential_ffv_1070;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_1071> AgradDistributionSkewDoubleExponential_ffv_1071;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_1072> AgradDistributionSkewDoubleExponential_ffv_1072;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_1073> AgradDistributionSkewDoubleExponential_ffv_1073;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_1074> AgradDistributionSkewDoubleExponential_ffv_1074;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_1075> AgradDistributionSkewDoubleExponential_ffv_1075;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_1076> AgradDistributionSkewDoubleExponential_ffv_1076;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_1077> AgradDistributionSkewDoubleExponential_ffv_1077;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_1078> AgradDistributionSkewDoubleExponential_ffv_1078;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_1079> AgradDistributionSkewDoubleExponential_ffv_1079;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_1080> AgradDistributionSkewDoubleExponential_ffv_1080;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_1081> AgradDistributionSkewDoubleExponential_ffv_1081;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_1082> AgradDistributionSkewDoubleExponential_ffv_1082;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_1083> AgradDistributionSkewDoubleExponential_ffv_1083;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_1084> AgradDistributionSkewDoubleExponential_ffv_1084;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_1085> AgradDistributionSkewDoubleExponential_ffv_1085;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_1086> AgradDistributionSkewDoubleExponential_ffv_1086;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_1087> AgradDistributionSkewDoubleExponential_ffv_1087;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_1088> AgradDistributionSkewDoubleExponential_ffv_1088;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_1089> AgradDistributionSkewDoubleExponential_ffv_1089;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_1090> AgradDistributionSkewDoubleExponential_ffv_1090;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_1091> AgradDistributionSkewDoubleExponential_ffv_1091;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_1092> AgradDistributionSkewDoubleExponential_ffv_1092;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_1093> AgradDistributionSkewDoubleExponential_ffv_1093;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_1094> AgradDistributionSkewDoubleExponential_ffv_1094;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_1095> AgradDistributionSkewDoubleExponential_ffv_1095;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_1096> AgradDistributionSkewDoubleExponential_ffv_1096;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_1097> AgradDistributionSkewDoubleExponential_ffv_1097;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_1098> AgradDistributionSkewDoubleExponential_ffv_1098;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_ffv_1099> AgradDistributionSkewDoubleExponential_ffv_1099;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_1000, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_1000);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_1001, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_1001);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_1002, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_1002);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_1003, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_1003);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_1004, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_1004);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_1005, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_1005);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_1006, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_1006);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_1007, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_1007);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_1008, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_1008);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_1009, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_1009);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_1010, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_1010);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_1011, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_1011);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_1012, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_1012);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_1013, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_1013);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_1014, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_1014);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_1015, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_1015);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_1016, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_1016);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_1017, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_1017);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_1018, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_1018);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_1019, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_1019);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_1020, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_1020);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_1021, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_1021);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_1022, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_1022);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_1023, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_1023);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_1024, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_1024);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_1025, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_1025);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_1026, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_1026);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_1027, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_1027);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_1028, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_1028);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_1029, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_1029);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_1030, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_1030);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_1031, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_1031);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_1032, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_1032);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_1033, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_1033);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_1034, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_1034);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_1035, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_1035);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_1036, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_1036);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_1037, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_1037);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_1038, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_1038);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_1039, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_1039);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_1040, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_1040);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_1041, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_1041);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_1042, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_1042);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_1043, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_1043);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_1044, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_1044);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_1045, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_1045);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_1046, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_1046);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_1047, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_1047);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_1048, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_1048);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_1049, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_1049);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_1050, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_1050);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_1051, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_1051);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_1052, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_1052);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_1053, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_1053);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_1054, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_1054);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_1055, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_1055);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_1056, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_1056);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_1057, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_1057);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_1058, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_1058);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_1059, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_1059);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_1060, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_1060);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_1061, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_1061);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_1062, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_1062);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_1063, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_1063);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_1064, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_1064);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_1065, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_1065);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_1066, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_1066);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_1067, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_1067);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_1068, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_1068);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_1069, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_1069);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_1070, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_1070);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_1071, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_1071);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_1072, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_1072);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_1073, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_1073);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_1074, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_1074);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_1075, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_1075);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_1076, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_1076);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_1077, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_1077);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_1078, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_1078);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_1079, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_1079);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_1080, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_1080);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_1081, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_1081);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_1082, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_1082);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_1083, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_1083);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_1084, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_1084);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_1085, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_1085);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_1086, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_1086);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_1087, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_1087);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_1088, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_1088);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_1089, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_1089);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_1090, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_1090);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_1091, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_1091);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_1092, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_1092);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_1093, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_1093);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_1094, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_1094);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_1095, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_1095);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_1096, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_1096);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_1097, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_1097);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_1098, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_1098);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_ffv_1099, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_ffv_1099);
+
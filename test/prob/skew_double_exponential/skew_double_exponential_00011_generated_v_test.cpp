@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/skew_double_exponential/skew_double_exponential_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1100;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, var, empty, empty> type_v_1101;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, std::vector<var>, empty, empty> type_v_1102;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1103;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, double, empty, empty> type_v_1104;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, std::vector<double>, empty, empty> type_v_1105;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1106;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, var, empty, empty> type_v_1107;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, std::vector<var>, empty, empty> type_v_1108;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1109;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_1110;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_1111;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1112;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_1113;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_1114;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1115;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, double, empty, empty> type_v_1116;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, std::vector<double>, empty, empty> type_v_1117;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1118;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, var, empty, empty> type_v_1119;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, std::vector<var>, empty, empty> type_v_1120;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1121;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, double, empty, empty> type_v_1122;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, std::vector<double>, empty, empty> type_v_1123;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1124;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, var, empty, empty> type_v_1125;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_v_1126;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1127;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_1128;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_1129;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1130;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_1131;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_1132;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1133;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, double, empty, empty> type_v_1134;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, std::vector<double>, empty, empty> type_v_1135;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1136;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, var, empty, empty> type_v_1137;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, std::vector<var>, empty, empty> type_v_1138;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1139;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, double, empty, empty> type_v_1140;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_v_1141;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1142;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, var, empty, empty> type_v_1143;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_v_1144;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1145;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_1146;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_1147;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1148;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_1149;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_1150;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1151;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_1152;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_1153;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1154;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_1155;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_1156;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1157;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_1158;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_1159;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1160;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_1161;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_1162;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1163;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_1164;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_1165;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1166;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_1167;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_1168;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1169;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_1170;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_1171;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1172;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_1173;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_1174;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1175;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_1176;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_1177;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1178;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_1179;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_1180;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1181;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_1182;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_1183;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1184;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_1185;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_1186;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1187;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, double, empty, empty> type_v_1188;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, std::vector<double>, empty, empty> type_v_1189;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1190;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, var, empty, empty> type_v_1191;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, std::vector<var>, empty, empty> type_v_1192;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1193;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, double, empty, empty> type_v_1194;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, std::vector<double>, empty, empty> type_v_1195;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1196;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, var, empty, empty> type_v_1197;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, std::vector<var>, empty, empty> type_v_1198;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1199;
+
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1100> AgradDistributionSkewDoubleExponential_v_1100;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1101> AgradDistributionSkewDoubleExponential_v_1101;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1102> AgradDistributionSkewDoubleExponential_v_1102;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1103> AgradDistributionSkewDoubleExponential_v_1103;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1104> AgradDistributionSkewDoubleExponential_v_1104;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1105> AgradDistributionSkewDoubleExponential_v_1105;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1106> AgradDistributionSkewDoubleExponential_v_1106;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1107> AgradDistributionSkewDoubleExponential_v_1107;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1108> AgradDistributionSkewDoubleExponential_v_1108;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1109> AgradDistributionSkewDoubleExponential_v_1109;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1110> AgradDistributionSkewDoubleExponential_v_1110;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1111> AgradDistributionSkewDoubleExponential_v_1111;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1112> AgradDistributionSkewDoubleExponential_v_1112;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1113> AgradDistributionSkewDoubleExponential_v_1113;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1114> AgradDistributionSkewDoubleExponential_v_1114;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1115> AgradDistributionSkewDoubleExponential_v_1115;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1116> AgradDistributionSkewDoubleExponential_v_1116;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1117> AgradDistributionSkewDoubleExponential_v_1117;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1118> AgradDistributionSkewDoubleExponential_v_1118;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1119> AgradDistributionSkewDoubleExponential_v_1119;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1120> AgradDistributionSkewDoubleExponential_v_1120;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1121> AgradDistributionSkewDoubleExponential_v_1121;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1122> AgradDistributionSkewDoubleExponential_v_1122;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1123> AgradDistributionSkewDoubleExponential_v_1123;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1124> AgradDistributionSkewDoubleExponential_v_1124;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1125> AgradDistributionSkewDoubleExponential_v_1125;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1126> AgradDistributionSkewDoubleExponential_v_1126;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1127> AgradDistributionSkewDoubleExponential_v_1127;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1128> AgradDistributionSkewDoubleExponential_v_1128;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1129> AgradDistributionSkewDoubleExponential_v_1129;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1130> AgradDistributionSkewDoubleExponential_v_1130;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1131> AgradDistributionSkewDoubleExponential_v_1131;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1132> AgradDistributionSkewDoubleExponential_v_1132;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1133> AgradDistributionSkewDoubleExponential_v_1133;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1134> AgradDistributionSkewDoubleExponential_v_1134;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1135> AgradDistributionSkewDoubleExponential_v_1135;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1136> AgradDistributionSkewDoubleExponential_v_1136;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1137> AgradDistributionSkewDoubleExponential_v_1137;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1138> AgradDistributionSkewDoubleExponential_v_1138;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1139> AgradDistributionSkewDoubleExponential_v_1139;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1140> AgradDistributionSkewDoubleExponential_v_1140;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1141> AgradDistributionSkewDoubleExponential_v_1141;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1142> AgradDistributionSkewDoubleExponential_v_1142;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1143> AgradDistributionSkewDoubleExponential_v_1143;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1144> AgradDistributionSkewDoubleExponential_v_1144;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1145> AgradDistributionSkewDoubleExponential_v_1145;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1146> AgradDistributionSkewDoubleExponential_v_1146;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1147> AgradDistributionSkewDoubleExponential_v_1147;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1148> AgradDistributionSkewDoubleExponential_v_1148;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1149> AgradDistributionSkewDoubleExponential_v_1149;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1150> AgradDistributionSkewDoubleExponential_v_1150;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1151> AgradDistributionSkewDoubleExponential_v_1151;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1152> AgradDistributionSkewDoubleExponential_v_1152;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1153> AgradDistributionSkewDoubleExponential_v_1153;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1154> AgradDistributionSkewDoubleExponential_v_1154;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1155> AgradDistributionSkewDoubleExponential_v_1155;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1156> AgradDistributionSkewDoubleExponential_v_1156;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1157> AgradDistributionSkewDoubleExponential_v_1157;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1158> AgradDistributionSkewDoubleExponential_v_1158;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1159> AgradDistributionSkewDoubleExponential_v_1159;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1160> AgradDistributionSkewDoubleExponential_v_1160;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1161> AgradDistributionSkewDoubleExponential_v_1161;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1162> AgradDistributionSkewDoubleExponential_v_1162;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1163> AgradDistributionSkewDoubleExponential_v_1163;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1164> AgradDistributionSkewDoubleExponential_v_1164;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1165> AgradDistributionSkewDoubleExponential_v_1165;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1166> AgradDistributionSkewDoubleExponential_v_1166;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1167> AgradDistributionSkewDoubleExponential_v_1167;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1168> AgradDistributionSkewDoubleExponential_v_1168;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1169> AgradDistributionSkewDoubleExponential_v_1169;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1170> AgradDistributionSkewDoubleExponential_v_1170;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1171> AgradDistributionSkewDoubleExponential_v_1171;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1172> AgradDistributionSkewDoubleExponential_v_1172;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1173> AgradDistributionSkewDoubleExponential_v_1173;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1174> AgradDistributionSkewDoubleExponential_v_1174;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1175> AgradDistributionSkewDoubleExponential_v_1175;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1176> AgradDistributionSkewDoubleExponential_v_1176;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1177> AgradDistributionSkewDoubleExponential_v_1177;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1178> AgradDistributionSkewDoubleExponential_v_1178;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1179> AgradDistributionSkewDoubleExponential_v_1179;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1180> AgradDistributionSkewDoubleExponential_v_1180;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1181> AgradDistributionSkewDoubleExponential_v_1181;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1182> AgradDistributionSkewDoubleExponential_v_1182;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1183> AgradDistributionSkewDoubleExponential_v_1183;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1184> AgradDistributionSkewDoubleExponential_v_1184;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1185> AgradDistributionSkewDoubleExponential_v_1185;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1186> AgradDistributionSkewDoubleExponential_v_1186;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1187> AgradDistributionSkewDoubleExponential_v_1187;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1188> AgradDistributionSkewDoubleExponential_v_1188;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1189> AgradDistributionSkewDoubleExponential_v_1189;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1190> AgradDistributionSkewDoubleExponential_v_1190;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1191> AgradDistributionSkewDoubleExponential_v_1191;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1192> AgradDistributionSkewDoubleExponential_v_1192;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1193> AgradDistributionSkewDoubleExponential_v_1193;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1194> AgradDistributionSkewDoubleExponential_v_1194;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1195> AgradDistributionSkewDoubleExponential_v_1195;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1196> AgradDistributionSkewDoubleExponential_v_1196;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1197> AgradDistributionSkewDoubleExponential_v_1197;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1198> AgradDistributionSkewDoubleExponential_v_1198;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1199> AgradDistributionSkewDoubleExponential_v_1199;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1100, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1101, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1102, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1103, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1104, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1105, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1106, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1107, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1108, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1109, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1110, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1111, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1112, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1113, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1114, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1115, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1116, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1117, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1118, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1119, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1120, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1121, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1122, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1123, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1124, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1125, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1126, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1127, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1128, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1129, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1130, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1131, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1132, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1133, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1134, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1135, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1136, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1137, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1138, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1139, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1140, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1141, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1142, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1143, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1144, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1145, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1146, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1147, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1148, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1149, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1150, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1151, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1152, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1153, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1154, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1155, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1156, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1157, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1158, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1159, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1160, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1161, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1162, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1163, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1164, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1165, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1166, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1167, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1168, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1169, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1170, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1171, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1172, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1173, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1174, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1175, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1176, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1177, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1178, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1179, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1180, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1181, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1182, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1183, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1184, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1185, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1186, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1187, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1188, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1188);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1189, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1189);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1190, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1190);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1191, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1191);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1192, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1192);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1193, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1193);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1194, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1194);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1195, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1195);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1196, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1196);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1197, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1197);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1198, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1198);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1199, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1199);
+
@@ -0,0 +1,299 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/skew_double_exponential/skew_double_exponential_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_1200;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_1201;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1202;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_1203;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_1204;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1205;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, double, empty, empty> type_v_1206;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, std::vector<double>, empty, empty> type_v_1207;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1208;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, var, empty, empty> type_v_1209;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, std::vector<var>, empty, empty> type_v_1210;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1211;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, double, empty, empty> type_v_1212;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, std::vector<double>, empty, empty> type_v_1213;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1214;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, var, empty, empty> type_v_1215;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, std::vector<var>, empty, empty> type_v_1216;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1217;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_1218;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_1219;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1220;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_1221;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_1222;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1223;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, double, empty, empty> type_v_1224;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, std::vector<double>, empty, empty> type_v_1225;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1226;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, var, empty, empty> type_v_1227;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, std::vector<var>, empty, empty> type_v_1228;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1229;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, double, empty, empty> type_v_1230;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_v_1231;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1232;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, var, empty, empty> type_v_1233;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_v_1234;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1235;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_1236;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_1237;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1238;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_1239;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_1240;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1241;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, double, empty, empty> type_v_1242;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, std::vector<double>, empty, empty> type_v_1243;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1244;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, var, empty, empty> type_v_1245;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, std::vector<var>, empty, empty> type_v_1246;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1247;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, double, empty, empty> type_v_1248;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_v_1249;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1250;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, var, empty, empty> type_v_1251;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_v_1252;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1253;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_1254;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_1255;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1256;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_1257;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_1258;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1259;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_1260;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_1261;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1262;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_1263;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_1264;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1265;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_1266;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_1267;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1268;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_1269;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_1270;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1271;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_1272;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_1273;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1274;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_1275;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_1276;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1277;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_1278;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_1279;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1280;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_1281;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_1282;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1283;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_1284;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_1285;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1286;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_1287;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_1288;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1289;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_1290;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_1291;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1292;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_1293;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_1294;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1295;
+
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1200> AgradDistributionSkewDoubleExponential_v_1200;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1201> AgradDistributionSkewDoubleExponential_v_1201;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1202> AgradDistributionSkewDoubleExponential_v_1202;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1203> AgradDistributionSkewDoubleExponential_v_1203;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1204> AgradDistributionSkewDoubleExponential_v_1204;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1205> AgradDistributionSkewDoubleExponential_v_1205;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1206> AgradDistributionSkewDoubleExponential_v_1206;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1207> AgradDistributionSkewDoubleExponential_v_1207;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1208> AgradDistributionSkewDoubleExponential_v_1208;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1209> AgradDistributionSkewDoubleExponential_v_1209;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1210> AgradDistributionSkewDoubleExponential_v_1210;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1211> AgradDistributionSkewDoubleExponential_v_1211;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1212> AgradDistributionSkewDoubleExponential_v_1212;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1213> AgradDistributionSkewDoubleExponential_v_1213;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1214> AgradDistributionSkewDoubleExponential_v_1214;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1215> AgradDistributionSkewDoubleExponential_v_1215;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1216> AgradDistributionSkewDoubleExponential_v_1216;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1217> AgradDistributionSkewDoubleExponential_v_1217;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1218> AgradDistributionSkewDoubleExponential_v_1218;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1219> AgradDistributionSkewDoubleExponential_v_1219;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1220> AgradDistributionSkewDoubleExponential_v_1220;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1221> AgradDistributionSkewDoubleExponential_v_1221;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1222> AgradDistributionSkewDoubleExponential_v_1222;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1223> AgradDistributionSkewDoubleExponential_v_1223;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1224> AgradDistributionSkewDoubleExponential_v_1224;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1225> AgradDistributionSkewDoubleExponential_v_1225;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1226> AgradDistributionSkewDoubleExponential_v_1226;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1227> AgradDistributionSkewDoubleExponential_v_1227;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1228> AgradDistributionSkewDoubleExponential_v_1228;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1229> AgradDistributionSkewDoubleExponential_v_1229;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1230> AgradDistributionSkewDoubleExponential_v_1230;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1231> AgradDistributionSkewDoubleExponential_v_1231;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1232> AgradDistributionSkewDoubleExponential_v_1232;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1233> AgradDistributionSkewDoubleExponential_v_1233;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1234> AgradDistributionSkewDoubleExponential_v_1234;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1235> AgradDistributionSkewDoubleExponential_v_1235;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1236> AgradDistributionSkewDoubleExponential_v_1236;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1237> AgradDistributionSkewDoubleExponential_v_1237;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1238> AgradDistributionSkewDoubleExponential_v_1238;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1239> AgradDistributionSkewDoubleExponential_v_1239;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1240> AgradDistributionSkewDoubleExponential_v_1240;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1241> AgradDistributionSkewDoubleExponential_v_1241;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1242> AgradDistributionSkewDoubleExponential_v_1242;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1243> AgradDistributionSkewDoubleExponential_v_1243;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1244> AgradDistributionSkewDoubleExponential_v_1244;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1245> AgradDistributionSkewDoubleExponential_v_1245;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1246> AgradDistributionSkewDoubleExponential_v_1246;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1247> AgradDistributionSkewDoubleExponential_v_1247;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1248> AgradDistributionSkewDoubleExponential_v_1248;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1249> AgradDistributionSkewDoubleExponential_v_1249;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1250> AgradDistributionSkewDoubleExponential_v_1250;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1251> AgradDistributionSkewDoubleExponential_v_1251;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1252> AgradDistributionSkewDoubleExponential_v_1252;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1253> AgradDistributionSkewDoubleExponential_v_1253;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1254> AgradDistributionSkewDoubleExponential_v_1254;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1255> AgradDistributionSkewDoubleExponential_v_1255;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1256> AgradDistributionSkewDoubleExponential_v_1256;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1257> AgradDistributionSkewDoubleExponential_v_1257;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1258> AgradDistributionSkewDoubleExponential_v_1258;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1259> AgradDistributionSkewDoubleExponential_v_1259;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1260> AgradDistributionSkewDoubleExponential_v_1260;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1261> AgradDistributionSkewDoubleExponential_v_1261;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1262> AgradDistributionSkewDoubleExponential_v_1262;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1263> AgradDistributionSkewDoubleExponential_v_1263;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1264> AgradDistributionSkewDoubleExponential_v_1264;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1265> AgradDistributionSkewDoubleExponential_v_1265;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1266> AgradDistributionSkewDoubleExponential_v_1266;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1267> AgradDistributionSkewDoubleExponential_v_1267;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1268> AgradDistributionSkewDoubleExponential_v_1268;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1269> AgradDistributionSkewDoubleExponential_v_1269;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1270> AgradDistributionSkewDoubleExponential_v_1270;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1271> AgradDistributionSkewDoubleExponential_v_1271;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1272> AgradDistributionSkewDoubleExponential_v_1272;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1273> AgradDistributionSkewDoubleExponential_v_1273;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1274> AgradDistributionSkewDoubleExponential_v_1274;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1275> AgradDistributionSkewDoubleExponential_v_1275;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1276> AgradDistributionSkewDoubleExponential_v_1276;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1277> AgradDistributionSkewDoubleExponential_v_1277;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1278> AgradDistributionSkewDoubleExponential_v_1278;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1279> AgradDistributionSkewDoubleExponential_v_1279;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1280> AgradDistributionSkewDoubleExponential_v_1280;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1281> AgradDistributionSkewDoubleExponential_v_1281;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1282> AgradDistributionSkewDoubleExponential_v_1282;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1283> AgradDistributionSkewDoubleExponential_v_1283;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1284> AgradDistributionSkewDoubleExponential_v_1284;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1285> AgradDistributionSkewDoubleExponential_v_1285;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1286> AgradDistributionSkewDoubleExponential_v_1286;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1287> AgradDistributionSkewDoubleExponential_v_1287;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1288> AgradDistributionSkewDoubleExponential_v_1288;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1289> AgradDistributionSkewDoubleExponential_v_1289;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1290> AgradDistributionSkewDoubleExponential_v_1290;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1291> AgradDistributionSkewDoubleExponential_v_1291;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1292> AgradDistributionSkewDoubleExponential_v_1292;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1293> AgradDistributionSkewDoubleExponential_v_1293;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1294> AgradDistributionSkewDoubleExponential_v_1294;
+typedef std::tuple<AgradDistributionSkewDoubleExponential, type_v_1295> AgradDistributionSkewDoubleExponential_v_1295;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1200, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1200);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1201, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1201);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1202, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1202);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1203, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1203);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1204, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1204);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1205, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1205);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1206, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1206);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1207, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1207);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1208, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1208);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1209, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1209);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1210, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1210);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1211, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1211);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1212, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1212);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1213, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1213);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1214, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1214);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1215, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1215);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1216, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1216);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1217, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1217);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1218, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1218);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1219, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1219);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1220, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1220);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1221, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1221);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1222, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1222);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1223, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1223);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1224, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1224);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1225, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1225);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1226, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1226);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1227, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1227);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1228, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1228);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1229, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1229);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1230, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1230);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1231, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1231);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1232, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1232);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1233, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1233);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1234, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1234);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1235, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1235);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1236, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1236);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1237, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1237);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1238, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1238);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1239, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1239);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1240, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1240);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1241, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1241);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1242, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1242);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1243, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1243);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1244, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1244);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1245, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1245);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1246, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1246);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1247, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1247);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1248, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1248);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1249, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1249);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1250, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1250);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1251, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1251);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1252, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1252);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1253, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1253);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1254, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1254);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1255, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1255);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1256, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1256);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1257, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1257);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1258, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1258);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1259, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1259);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1260, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1260);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1261, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1261);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1262, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1262);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1263, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1263);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1264, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1264);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1265, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1265);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1266, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1266);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1267, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1267);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1268, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1268);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1269, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1269);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1270, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1270);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1271, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1271);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1272, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1272);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1273, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1273);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1274, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1274);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1275, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1275);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1276, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1276);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1277, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1277);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1278, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1278);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1279, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1279);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1280, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1280);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1281, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1281);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1282, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1282);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1283, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1283);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1284, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1284);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1285, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1285);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1286, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1286);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1287, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1287);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1288, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1288);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1289, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1289);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1290, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1290);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1291, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1291);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1292, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1292);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1293, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1293);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1294, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1294);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradDistributionSkewDoubleExponential_v_1295, AgradDistributionTestFixture, AgradDistributionSkewDoubleExponential_v_1295);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/skew_double_exponential/skew_double_exponential_ccdf_log_test.hpp>
+
+typedef std::tuple<double, double, double, fvar<fvar<var> >, empty, empty> type_ffv_0;
+typedef std::tuple<double, double, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1;
+typedef std::tuple<double, double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_2;
+typedef std::tuple<double, double, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_3;
+typedef std::tuple<double, double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_4;
+typedef std::tuple<double, double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_5;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_6;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_7;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_8;
+typedef std::tuple<double, double, fvar<fvar<var> >, double, empty, empty> type_ffv_9;
+typedef std::tuple<double, double, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_10;
+typedef std::tuple<double, double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_11;
+typedef std::tuple<double, double, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_12;
+typedef std::tuple<double, double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_13;
+typedef std::tuple<double, double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_14;
+typedef std::tuple<double, double, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_15;
+typedef std::tuple<double, double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_16;
+typedef std::tuple<double, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_17;
+typedef std::tuple<double, double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_18;
+typedef std::tuple<double, double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_19;
+typedef std::tuple<double, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_20;
+typedef std::tuple<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_21;
+typedef std::tuple<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_22;
+typedef std::tuple<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_23;
+typedef std::tuple<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_24;
+typedef std::tuple<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_25;
+typedef std::tuple<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_26;
+typedef std::tuple<double, std::vector<double>, double, fvar<fvar<var> >, empty, empty> type_ffv_27;
+typedef std::tuple<double, std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_28;
+typedef std::tuple<double, std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_29;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_30;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_31;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_32;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_33;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_34;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_35;
+typedef std::tuple<double, std::vector<double>, fvar<fvar<var> >, double, empty, empty> type_ffv_36;
+typedef std::tuple<double, std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_37;
+typedef std::tuple<double, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_38;
+typedef std::tuple<double, std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_39;
+typedef std::tuple<double, std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_40;
+typedef std::tuple<double, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_41;
+typedef std::tuple<double, std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_42;
+typedef std::tuple<double, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_43;
+typedef std::tuple<double, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_44;
+typedef std::tuple<double, std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_45;
+typedef std::tuple<double, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_46;
+typedef std::tuple<double, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_47;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_48;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_49;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_50;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_51;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_52;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_53;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_54;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_55;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_56;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_57;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_58;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_59;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_60;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_61;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_62;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_63;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_64;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_65;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_66;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_67;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_68;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_69;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_70;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_71;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_72;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_73;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_74;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_75;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_76;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_77;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_78;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_79;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_80;
+typedef std::tuple<double, fvar<fvar<var> >, double, double, empty, empty> type_ffv_81;
+typedef std::tuple<double, fvar<fvar<var> >, double, std::vector<double>, empty, empty> type_ffv_82;
+typedef std::tuple<double, fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_83;
+typedef std::tuple<double, fvar<fvar<var> >, double, fvar<fvar<var> >, empty, empty> type_ffv_84;
+typedef std::tuple<double, fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_85;
+typedef std::tuple<double, fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_86;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<double>, double, empty, empty> type_ffv_87;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty, empty> type_ffv_88;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_89;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_90;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_91;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_92;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_93;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_94;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_95;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_96;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_97;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_98;
+typedef std::tuple<double, fvar<fvar<var> >, fvar<fvar<var> >, double, empty, empty> type_ffv_99;
+
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_0> AgradCcdfLogSkewDoubleExponential_ffv_0;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_1> AgradCcdfLogSkewDoubleExponential_ffv_1;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_2> AgradCcdfLogSkewDoubleExponential_ffv_2;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_3> AgradCcdfLogSkewDoubleExponential_ffv_3;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_4> AgradCcdfLogSkewDoubleExponential_ffv_4;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_5> AgradCcdfLogSkewDoubleExponential_ffv_5;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_6> AgradCcdfLogSkewDoubleExponential_ffv_6;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_7> AgradCcdfLogSkewDoubleExponential_ffv_7;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_8> AgradCcdfLogSkewDoubleExponential_ffv_8;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_9> AgradCcdfLogSkewDoubleExponential_ffv_9;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_10> AgradCcdfLogSkewDoubleExponential_ffv_10;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_11> AgradCcdfLogSkewDoubleExponential_ffv_11;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_12> AgradCcdfLogSkewDoubleExponential_ffv_12;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_13> AgradCcdfLogSkewDoubleExponential_ffv_13;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_14> AgradCcdfLogSkewDoubleExponential_ffv_14;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_15> AgradCcdfLogSkewDoubleExponential_ffv_15;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_16> AgradCcdfLogSkewDoubleExponential_ffv_16;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_17> AgradCcdfLogSkewDoubleExponential_ffv_17;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_18> AgradCcdfLogSkewDoubleExponential_ffv_18;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_19> AgradCcdfLogSkewDoubleExponential_ffv_19;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_20> AgradCcdfLogSkewDoubleExponential_ffv_20;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_21> AgradCcdfLogSkewDoubleExponential_ffv_21;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_22> AgradCcdfLogSkewDoubleExponential_ffv_22;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_23> AgradCcdfLogSkewDoubleExponential_ffv_23;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_24> AgradCcdfLogSkewDoubleExponential_ffv_24;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_25> AgradCcdfLogSkewDoubleExponential_ffv_25;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_26> AgradCcdfLogSkewDoubleExponential_ffv_26;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_27> AgradCcdfLogSkewDoubleExponential_ffv_27;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_28> AgradCcdfLogSkewDoubleExponential_ffv_28;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_29> AgradCcdfLogSkewDoubleExponential_ffv_29;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_30> AgradCcdfLogSkewDoubleExponential_ffv_30;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_31> AgradCcdfLogSkewDoubleExponential_ffv_31;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_32> AgradCcdfLogSkewDoubleExponential_ffv_32;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_33> AgradCcdfLogSkewDoubleExponential_ffv_33;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_34> AgradCcdfLogSkewDoubleExponential_ffv_34;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_35> AgradCcdfLogSkewDoubleExponential_ffv_35;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_36> AgradCcdfLogSkewDoubleExponential_ffv_36;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_37> AgradCcdfLogSkewDoubleExponential_ffv_37;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_38> AgradCcdfLogSkewDoubleExponential_ffv_38;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_39> AgradCcdfLogSkewDoubleExponential_ffv_39;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_40> AgradCcdfLogSkewDoubleExponential_ffv_40;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_41> AgradCcdfLogSkewDoubleExponential_ffv_41;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_42> AgradCcdfLogSkewDoubleExponential_ffv_42;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_43> AgradCcdfLogSkewDoubleExponential_ffv_43;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_44> AgradCcdfLogSkewDoubleExponential_ffv_44;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_45> AgradCcdfLogSkewDoubleExponential_ffv_45;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_46> AgradCcdfLogSkewDoubleExponential_ffv_46;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_47> AgradCcdfLogSkewDoubleExponential_ffv_47;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_48> AgradCcdfLogSkewDoubleExponential_ffv_48;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_49> AgradCcdfLogSkewDoubleExponential_ffv_49;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_50> AgradCcdfLogSkewDoubleExponential_ffv_50;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_51> AgradCcdfLogSkewDoubleExponential_ffv_51;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_52> AgradCcdfLogSkewDoubleExponential_ffv_52;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_53> AgradCcdfLogSkewDoubleExponential_ffv_53;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_54> AgradCcdfLogSkewDoubleExponential_ffv_54;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_55> AgradCcdfLogSkewDoubleExponential_ffv_55;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_56> AgradCcdfLogSkewDoubleExponential_ffv_56;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_57> AgradCcdfLogSkewDoubleExponential_ffv_57;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_58> AgradCcdfLogSkewDoubleExponential_ffv_58;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_59> AgradCcdfLogSkewDoubleExponential_ffv_59;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_60> AgradCcdfLogSkewDoubleExponential_ffv_60;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_61> AgradCcdfLogSkewDoubleExponential_ffv_61;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_62> AgradCcdfLogSkewDoubleExponential_ffv_62;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_63> AgradCcdfLogSkewDoubleExponential_ffv_63;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_64> AgradCcdfLogSkewDoubleExponential_ffv_64;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_65> AgradCcdfLogSkewDoubleExponential_ffv_65;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_66> AgradCcdfLogSkewDoubleExponential_ffv_66;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_67> AgradCcdfLogSkewDoubleExponential_ffv_67;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_68> AgradCcdfLogSkewDoubleExponential_ffv_68;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_69> AgradCcdfLogSkewDoubleExponential_ffv_69;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_70> AgradCcdfLogSkewDoubleExponential_ffv_70;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_71> AgradCcdfLogSkewDoubleExponential_ffv_71;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_72> AgradCcdfLogSkewDoubleExponential_ffv_72;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_73> AgradCcdfLogSkewDoubleExponential_ffv_73;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_74> AgradCcdfLogSkewDoubleExponential_ffv_74;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_75> AgradCcdfLogSkewDoubleExponential_ffv_75;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_76> AgradCcdfLogSkewDoubleExponential_ffv_76;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_77> AgradCcdfLogSkewDoubleExponential_ffv_77;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_78> AgradCcdfLogSkewDoubleExponential_ffv_78;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_79> AgradCcdfLogSkewDoubleExponential_ffv_79;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_80> AgradCcdfLogSkewDoubleExponential_ffv_80;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_81> AgradCcdfLogSkewDoubleExponential_ffv_81;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_82> AgradCcdfLogSkewDoubleExponential_ffv_82;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_83> AgradCcdfLogSkewDoubleExponential_ffv_83;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_84> AgradCcdfLogSkewDoubleExponential_ffv_84;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_85> AgradCcdfLogSkewDoubleExponential_ffv_85;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_86> AgradCcdfLogSkewDoubleExponential_ffv_86;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_87> AgradCcdfLogSkewDoubleExponential_ffv_87;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_88> AgradCcdfLogSkewDoubleExponential_ffv_88;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_89> AgradCcdfLogSkewDoubleExponential_ffv_89;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_90> AgradCcdfLogSkewDoubleExponential_ffv_90;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_91> AgradCcdfLogSkewDoubleExponential_ffv_91;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_92> AgradCcdfLogSkewDoubleExponential_ffv_92;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_93> AgradCcdfLogSkewDoubleExponential_ffv_93;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_94> AgradCcdfLogSkewDoubleExponential_ffv_94;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_95> AgradCcdfLogSkewDoubleExponential_ffv_95;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_96> AgradCcdfLogSkewDoubleExponential_ffv_96;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_97> AgradCcdfLogSkewDoubleExponential_ffv_97;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_98> AgradCcdfLogSkewDoubleExponential_ffv_98;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_99> AgradCcdfLogSkewDoubleExponential_ffv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_0, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_1, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_2, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_3, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_4, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_5, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_6, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_7, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_8, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_9, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_10, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_11, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_12, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_13, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_14, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_15, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_16, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_17, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_18, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_19, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_20, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_21, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_22, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_23, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_24, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_25, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_26, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_27, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_28, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_29, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_30, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_31, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_32, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_33, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_34, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_35, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_36, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_37, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_38, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_39, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_40, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_41, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_42, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_43, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_44, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_45, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_46, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_47, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_48, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_49, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_50, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_51, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_52, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_53, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_54, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_55, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_56, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_57, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_58, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_59, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_60, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_61, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_62, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_63, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_64, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_65, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_66, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_67, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_68, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_69, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_70, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_71, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_72, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_73, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_74, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_75, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_76, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_77, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_78, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_79, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_80, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_81, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_82, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_83, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_84, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_85, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_86, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_87, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_88, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_89, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_90, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_91, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_92, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_93, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_94, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_95, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_96, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_97, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_98, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_99, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_99);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/skew_double_exponential/skew_double_exponential_ccdf_log_test.hpp>
+
+typedef std::tuple<double, double, double, double, empty, empty> type_v_0;
+typedef std::tuple<double, double, double, std::vector<double>, empty, empty> type_v_1;
+typedef std::tuple<double, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_2;
+typedef std::tuple<double, double, double, var, empty, empty> type_v_3;
+typedef std::tuple<double, double, double, std::vector<var>, empty, empty> type_v_4;
+typedef std::tuple<double, double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_5;
+typedef std::tuple<double, double, std::vector<double>, double, empty, empty> type_v_6;
+typedef std::tuple<double, double, std::vector<double>, std::vector<double>, empty, empty> type_v_7;
+typedef std::tuple<double, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_8;
+typedef std::tuple<double, double, std::vector<double>, var, empty, empty> type_v_9;
+typedef std::tuple<double, double, std::vector<double>, std::vector<var>, empty, empty> type_v_10;
+typedef std::tuple<double, double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_11;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_12;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_13;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_14;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_15;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_16;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_17;
+typedef std::tuple<double, double, var, double, empty, empty> type_v_18;
+typedef std::tuple<double, double, var, std::vector<double>, empty, empty> type_v_19;
+typedef std::tuple<double, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_20;
+typedef std::tuple<double, double, var, var, empty, empty> type_v_21;
+typedef std::tuple<double, double, var, std::vector<var>, empty, empty> type_v_22;
+typedef std::tuple<double, double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_23;
+typedef std::tuple<double, double, std::vector<var>, double, empty, empty> type_v_24;
+typedef std::tuple<double, double, std::vector<var>, std::vector<double>, empty, empty> type_v_25;
+typedef std::tuple<double, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_26;
+typedef std::tuple<double, double, std::vector<var>, var, empty, empty> type_v_27;
+typedef std::tuple<double, double, std::vector<var>, std::vector<var>, empty, empty> type_v_28;
+typedef std::tuple<double, double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_29;
+typedef std::tuple<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_30;
+typedef std::tuple<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_31;
+typedef std::tuple<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_32;
+typedef std::tuple<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_33;
+typedef std::tuple<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_34;
+typedef std::tuple<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_35;
+typedef std::tuple<double, std::vector<double>, double, double, empty, empty> type_v_36;
+typedef std::tuple<double, std::vector<double>, double, std::vector<double>, empty, empty> type_v_37;
+typedef std::tuple<double, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_38;
+typedef std::tuple<double, std::vector<double>, double, var, empty, empty> type_v_39;
+typedef std::tuple<double, std::vector<double>, double, std::vector<var>, empty, empty> type_v_40;
+typedef std::tuple<double, std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_41;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, double, empty, empty> type_v_42;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, std::vector<double>, empty, empty> type_v_43;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_44;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, var, empty, empty> type_v_45;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_v_46;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_47;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_48;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_49;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_50;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_51;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_52;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_53;
+typedef std::tuple<double, std::vector<double>, var, double, empty, empty> type_v_54;
+typedef std::tuple<double, std::vector<double>, var, std::vector<double>, empty, empty> type_v_55;
+typedef std::tuple<double, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_56;
+typedef std::tuple<double, std::vector<double>, var, var, empty, empty> type_v_57;
+typedef std::tuple<double, std::vector<double>, var, std::vector<var>, empty, empty> type_v_58;
+typedef std::tuple<double, std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_59;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, double, empty, empty> type_v_60;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_v_61;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_62;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, var, empty, empty> type_v_63;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_v_64;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_65;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_66;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_67;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_68;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_69;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_70;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_71;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_72;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_73;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_74;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_75;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_76;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_77;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_78;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_79;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_80;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_81;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_82;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_83;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_84;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_85;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_86;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_87;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_88;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_89;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_90;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_91;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_92;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_93;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_94;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_95;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_96;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_97;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_98;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_99;
+
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_0> AgradCcdfLogSkewDoubleExponential_v_0;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_1> AgradCcdfLogSkewDoubleExponential_v_1;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_2> AgradCcdfLogSkewDoubleExponential_v_2;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_3> AgradCcdfLogSkewDoubleExponential_v_3;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_4> AgradCcdfLogSkewDoubleExponential_v_4;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_5> AgradCcdfLogSkewDoubleExponential_v_5;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_6> AgradCcdfLogSkewDoubleExponential_v_6;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_7> AgradCcdfLogSkewDoubleExponential_v_7;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_8> AgradCcdfLogSkewDoubleExponential_v_8;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_9> AgradCcdfLogSkewDoubleExponential_v_9;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_10> AgradCcdfLogSkewDoubleExponential_v_10;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_11> AgradCcdfLogSkewDoubleExponential_v_11;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_12> AgradCcdfLogSkewDoubleExponential_v_12;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_13> AgradCcdfLogSkewDoubleExponential_v_13;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_14> AgradCcdfLogSkewDoubleExponential_v_14;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_15> AgradCcdfLogSkewDoubleExponential_v_15;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_16> AgradCcdfLogSkewDoubleExponential_v_16;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_17> AgradCcdfLogSkewDoubleExponential_v_17;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_18> AgradCcdfLogSkewDoubleExponential_v_18;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_19> AgradCcdfLogSkewDoubleExponential_v_19;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_20> AgradCcdfLogSkewDoubleExponential_v_20;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_21> AgradCcdfLogSkewDoubleExponential_v_21;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_22> AgradCcdfLogSkewDoubleExponential_v_22;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_23> AgradCcdfLogSkewDoubleExponential_v_23;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_24> AgradCcdfLogSkewDoubleExponential_v_24;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_25> AgradCcdfLogSkewDoubleExponential_v_25;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_26> AgradCcdfLogSkewDoubleExponential_v_26;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_27> AgradCcdfLogSkewDoubleExponential_v_27;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_28> AgradCcdfLogSkewDoubleExponential_v_28;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_29> AgradCcdfLogSkewDoubleExponential_v_29;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_30> AgradCcdfLogSkewDoubleExponential_v_30;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_31> AgradCcdfLogSkewDoubleExponential_v_31;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_32> AgradCcdfLogSkewDoubleExponential_v_32;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_33> AgradCcdfLogSkewDoubleExponential_v_33;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_34> AgradCcdfLogSkewDoubleExponential_v_34;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_35> AgradCcdfLogSkewDoubleExponential_v_35;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_36> AgradCcdfLogSkewDoubleExponential_v_36;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_37> AgradCcdfLogSkewDoubleExponential_v_37;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_38> AgradCcdfLogSkewDoubleExponential_v_38;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_39> AgradCcdfLogSkewDoubleExponential_v_39;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_40> AgradCcdfLogSkewDoubleExponential_v_40;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_41> AgradCcdfLogSkewDoubleExponential_v_41;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_42> AgradCcdfLogSkewDoubleExponential_v_42;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_43> AgradCcdfLogSkewDoubleExponential_v_43;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_44> AgradCcdfLogSkewDoubleExponential_v_44;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_45> AgradCcdfLogSkewDoubleExponential_v_45;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_46> AgradCcdfLogSkewDoubleExponential_v_46;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_47> AgradCcdfLogSkewDoubleExponential_v_47;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_48> AgradCcdfLogSkewDoubleExponential_v_48;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_49> AgradCcdfLogSkewDoubleExponential_v_49;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_50> AgradCcdfLogSkewDoubleExponential_v_50;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_51> AgradCcdfLogSkewDoubleExponential_v_51;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_52> AgradCcdfLogSkewDoubleExponential_v_52;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_53> AgradCcdfLogSkewDoubleExponential_v_53;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_54> AgradCcdfLogSkewDoubleExponential_v_54;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_55> AgradCcdfLogSkewDoubleExponential_v_55;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_56> AgradCcdfLogSkewDoubleExponential_v_56;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_57> AgradCcdfLogSkewDoubleExponential_v_57;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_58> AgradCcdfLogSkewDoubleExponential_v_58;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_59> AgradCcdfLogSkewDoubleExponential_v_59;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_60> AgradCcdfLogSkewDoubleExponential_v_60;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_61> AgradCcdfLogSkewDoubleExponential_v_61;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_62> AgradCcdfLogSkewDoubleExponential_v_62;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_63> AgradCcdfLogSkewDoubleExponential_v_63;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_64> AgradCcdfLogSkewDoubleExponential_v_64;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_65> AgradCcdfLogSkewDoubleExponential_v_65;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_66> AgradCcdfLogSkewDoubleExponential_v_66;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_67> AgradCcdfLogSkewDoubleExponential_v_67;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_68> AgradCcdfLogSkewDoubleExponential_v_68;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_69> AgradCcdfLogSkewDoubleExponential_v_69;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_70> AgradCcdfLogSkewDoubleExponential_v_70;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_71> AgradCcdfLogSkewDoubleExponential_v_71;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_72> AgradCcdfLogSkewDoubleExponential_v_72;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_73> AgradCcdfLogSkewDoubleExponential_v_73;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_74> AgradCcdfLogSkewDoubleExponential_v_74;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_75> AgradCcdfLogSkewDoubleExponential_v_75;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_76> AgradCcdfLogSkewDoubleExponential_v_76;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_77> AgradCcdfLogSkewDoubleExponential_v_77;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_78> AgradCcdfLogSkewDoubleExponential_v_78;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_79> AgradCcdfLogSkewDoubleExponential_v_79;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_80> AgradCcdfLogSkewDoubleExponential_v_80;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_81> AgradCcdfLogSkewDoubleExponential_v_81;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_82> AgradCcdfLogSkewDoubleExponential_v_82;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_83> AgradCcdfLogSkewDoubleExponential_v_83;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_84> AgradCcdfLogSkewDoubleExponential_v_84;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_85> AgradCcdfLogSkewDoubleExponential_v_85;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_86> AgradCcdfLogSkewDoubleExponential_v_86;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_87> AgradCcdfLogSkewDoubleExponential_v_87;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_88> AgradCcdfLogSkewDoubleExponential_v_88;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_89> AgradCcdfLogSkewDoubleExponential_v_89;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_90> AgradCcdfLogSkewDoubleExponential_v_90;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_91> AgradCcdfLogSkewDoubleExponential_v_91;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_92> AgradCcdfLogSkewDoubleExponential_v_92;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_93> AgradCcdfLogSkewDoubleExponential_v_93;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_94> AgradCcdfLogSkewDoubleExponential_v_94;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_95> AgradCcdfLogSkewDoubleExponential_v_95;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_96> AgradCcdfLogSkewDoubleExponential_v_96;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_97> AgradCcdfLogSkewDoubleExponential_v_97;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_98> AgradCcdfLogSkewDoubleExponential_v_98;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_99> AgradCcdfLogSkewDoubleExponential_v_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_0, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_1, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_2, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_3, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_4, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_5, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_6, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_7, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_8, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_9, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_10, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_11, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_12, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_13, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_14, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_15, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_16, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_17, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_18, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_19, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_20, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_21, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_22, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_23, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_24, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_25, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_26, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_27, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_28, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_29, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_30, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_31, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_32, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_33, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_34, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_35, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_36, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_37, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_38, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_39, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_40, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_41, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_42, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_43, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_44, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_45, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_46, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_47, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_48, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_49, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_50, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_51, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_52, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_53, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_54, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_55, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_56, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_57, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_58, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_59, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_60, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_61, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_62, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_63, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_64, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_65, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_66, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_67, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_68, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_69, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_70, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_71, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_72, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_73, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_74, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_75, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_76, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_77, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_78, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_79, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_80, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_81, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_82, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_83, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_84, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_85, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_86, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_87, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_88, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_89, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_90, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_91, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_92, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_93, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_94, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_95, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_96, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_97, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_98, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_99, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_99);
+
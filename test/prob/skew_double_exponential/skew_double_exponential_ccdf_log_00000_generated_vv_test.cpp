@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/skew_double_exponential/skew_double_exponential_ccdf_log_test.hpp>
+
+typedef std::tuple<double, double, double, var, empty, empty> type_vv_0;
+typedef std::tuple<double, double, double, std::vector<var>, empty, empty> type_vv_1;
+typedef std::tuple<double, double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_2;
+typedef std::tuple<double, double, std::vector<double>, var, empty, empty> type_vv_3;
+typedef std::tuple<double, double, std::vector<double>, std::vector<var>, empty, empty> type_vv_4;
+typedef std::tuple<double, double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_5;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_6;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_7;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_8;
+typedef std::tuple<double, double, var, double, empty, empty> type_vv_9;
+typedef std::tuple<double, double, var, std::vector<double>, empty, empty> type_vv_10;
+typedef std::tuple<double, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_11;
+typedef std::tuple<double, double, var, var, empty, empty> type_vv_12;
+typedef std::tuple<double, double, var, std::vector<var>, empty, empty> type_vv_13;
+typedef std::tuple<double, double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_14;
+typedef std::tuple<double, double, std::vector<var>, double, empty, empty> type_vv_15;
+typedef std::tuple<double, double, std::vector<var>, std::vector<double>, empty, empty> type_vv_16;
+typedef std::tuple<double, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_17;
+typedef std::tuple<double, double, std::vector<var>, var, empty, empty> type_vv_18;
+typedef std::tuple<double, double, std::vector<var>, std::vector<var>, empty, empty> type_vv_19;
+typedef std::tuple<double, double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_20;
+typedef std::tuple<double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_21;
+typedef std::tuple<double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_22;
+typedef std::tuple<double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_23;
+typedef std::tuple<double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_24;
+typedef std::tuple<double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_25;
+typedef std::tuple<double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_26;
+typedef std::tuple<double, std::vector<double>, double, var, empty, empty> type_vv_27;
+typedef std::tuple<double, std::vector<double>, double, std::vector<var>, empty, empty> type_vv_28;
+typedef std::tuple<double, std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_29;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, var, empty, empty> type_vv_30;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_vv_31;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_32;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_33;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_34;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_35;
+typedef std::tuple<double, std::vector<double>, var, double, empty, empty> type_vv_36;
+typedef std::tuple<double, std::vector<double>, var, std::vector<double>, empty, empty> type_vv_37;
+typedef std::tuple<double, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_38;
+typedef std::tuple<double, std::vector<double>, var, var, empty, empty> type_vv_39;
+typedef std::tuple<double, std::vector<double>, var, std::vector<var>, empty, empty> type_vv_40;
+typedef std::tuple<double, std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_41;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, double, empty, empty> type_vv_42;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_vv_43;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_44;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, var, empty, empty> type_vv_45;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_vv_46;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_47;
+typedef std::tuple<double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_48;
+typedef std::tuple<double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_49;
+typedef std::tuple<double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_50;
+typedef std::tuple<double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_51;
+typedef std::tuple<double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_52;
+typedef std::tuple<double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_53;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_vv_54;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_vv_55;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_56;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_vv_57;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_vv_58;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_59;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_60;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_61;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_62;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_vv_63;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_vv_64;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_65;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_vv_66;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_vv_67;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_68;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_vv_69;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_vv_70;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_71;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_vv_72;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_vv_73;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_74;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_75;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_76;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_77;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_78;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_79;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_80;
+typedef std::tuple<double, var, double, double, empty, empty> type_vv_81;
+typedef std::tuple<double, var, double, std::vector<double>, empty, empty> type_vv_82;
+typedef std::tuple<double, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_83;
+typedef std::tuple<double, var, double, var, empty, empty> type_vv_84;
+typedef std::tuple<double, var, double, std::vector<var>, empty, empty> type_vv_85;
+typedef std::tuple<double, var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_86;
+typedef std::tuple<double, var, std::vector<double>, double, empty, empty> type_vv_87;
+typedef std::tuple<double, var, std::vector<double>, std::vector<double>, empty, empty> type_vv_88;
+typedef std::tuple<double, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_89;
+typedef std::tuple<double, var, std::vector<double>, var, empty, empty> type_vv_90;
+typedef std::tuple<double, var, std::vector<double>, std::vector<var>, empty, empty> type_vv_91;
+typedef std::tuple<double, var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_92;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_93;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_94;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_95;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_96;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_97;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_98;
+typedef std::tuple<double, var, var, double, empty, empty> type_vv_99;
+
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_0> AgradCcdfLogSkewDoubleExponential_vv_0;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1> AgradCcdfLogSkewDoubleExponential_vv_1;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_2> AgradCcdfLogSkewDoubleExponential_vv_2;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_3> AgradCcdfLogSkewDoubleExponential_vv_3;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_4> AgradCcdfLogSkewDoubleExponential_vv_4;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_5> AgradCcdfLogSkewDoubleExponential_vv_5;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_6> AgradCcdfLogSkewDoubleExponential_vv_6;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_7> AgradCcdfLogSkewDoubleExponential_vv_7;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_8> AgradCcdfLogSkewDoubleExponential_vv_8;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_9> AgradCcdfLogSkewDoubleExponential_vv_9;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_10> AgradCcdfLogSkewDoubleExponential_vv_10;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_11> AgradCcdfLogSkewDoubleExponential_vv_11;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_12> AgradCcdfLogSkewDoubleExponential_vv_12;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_13> AgradCcdfLogSkewDoubleExponential_vv_13;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_14> AgradCcdfLogSkewDoubleExponential_vv_14;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_15> AgradCcdfLogSkewDoubleExponential_vv_15;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_16> AgradCcdfLogSkewDoubleExponential_vv_16;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_17> AgradCcdfLogSkewDoubleExponential_vv_17;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_18> AgradCcdfLogSkewDoubleExponential_vv_18;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_19> AgradCcdfLogSkewDoubleExponential_vv_19;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_20> AgradCcdfLogSkewDoubleExponential_vv_20;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_21> AgradCcdfLogSkewDoubleExponential_vv_21;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_22> AgradCcdfLogSkewDoubleExponential_vv_22;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_23> AgradCcdfLogSkewDoubleExponential_vv_23;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_24> AgradCcdfLogSkewDoubleExponential_vv_24;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_25> AgradCcdfLogSkewDoubleExponential_vv_25;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_26> AgradCcdfLogSkewDoubleExponential_vv_26;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_27> AgradCcdfLogSkewDoubleExponential_vv_27;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_28> AgradCcdfLogSkewDoubleExponential_vv_28;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_29> AgradCcdfLogSkewDoubleExponential_vv_29;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_30> AgradCcdfLogSkewDoubleExponential_vv_30;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_31> AgradCcdfLogSkewDoubleExponential_vv_31;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_32> AgradCcdfLogSkewDoubleExponential_vv_32;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_33> AgradCcdfLogSkewDoubleExponential_vv_33;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_34> AgradCcdfLogSkewDoubleExponential_vv_34;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_35> AgradCcdfLogSkewDoubleExponential_vv_35;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_36> AgradCcdfLogSkewDoubleExponential_vv_36;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_37> AgradCcdfLogSkewDoubleExponential_vv_37;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_38> AgradCcdfLogSkewDoubleExponential_vv_38;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_39> AgradCcdfLogSkewDoubleExponential_vv_39;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_40> AgradCcdfLogSkewDoubleExponential_vv_40;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_41> AgradCcdfLogSkewDoubleExponential_vv_41;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_42> AgradCcdfLogSkewDoubleExponential_vv_42;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_43> AgradCcdfLogSkewDoubleExponential_vv_43;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_44> AgradCcdfLogSkewDoubleExponential_vv_44;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_45> AgradCcdfLogSkewDoubleExponential_vv_45;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_46> AgradCcdfLogSkewDoubleExponential_vv_46;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_47> AgradCcdfLogSkewDoubleExponential_vv_47;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_48> AgradCcdfLogSkewDoubleExponential_vv_48;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_49> AgradCcdfLogSkewDoubleExponential_vv_49;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_50> AgradCcdfLogSkewDoubleExponential_vv_50;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_51> AgradCcdfLogSkewDoubleExponential_vv_51;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_52> AgradCcdfLogSkewDoubleExponential_vv_52;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_53> AgradCcdfLogSkewDoubleExponential_vv_53;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_54> AgradCcdfLogSkewDoubleExponential_vv_54;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_55> AgradCcdfLogSkewDoubleExponential_vv_55;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_56> AgradCcdfLogSkewDoubleExponential_vv_56;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_57> AgradCcdfLogSkewDoubleExponential_vv_57;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_58> AgradCcdfLogSkewDoubleExponential_vv_58;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_59> AgradCcdfLogSkewDoubleExponential_vv_59;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_60> AgradCcdfLogSkewDoubleExponential_vv_60;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_61> AgradCcdfLogSkewDoubleExponential_vv_61;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_62> AgradCcdfLogSkewDoubleExponential_vv_62;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_63> AgradCcdfLogSkewDoubleExponential_vv_63;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_64> AgradCcdfLogSkewDoubleExponential_vv_64;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_65> AgradCcdfLogSkewDoubleExponential_vv_65;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_66> AgradCcdfLogSkewDoubleExponential_vv_66;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_67> AgradCcdfLogSkewDoubleExponential_vv_67;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_68> AgradCcdfLogSkewDoubleExponential_vv_68;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_69> AgradCcdfLogSkewDoubleExponential_vv_69;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_70> AgradCcdfLogSkewDoubleExponential_vv_70;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_71> AgradCcdfLogSkewDoubleExponential_vv_71;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_72> AgradCcdfLogSkewDoubleExponential_vv_72;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_73> AgradCcdfLogSkewDoubleExponential_vv_73;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_74> AgradCcdfLogSkewDoubleExponential_vv_74;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_75> AgradCcdfLogSkewDoubleExponential_vv_75;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_76> AgradCcdfLogSkewDoubleExponential_vv_76;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_77> AgradCcdfLogSkewDoubleExponential_vv_77;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_78> AgradCcdfLogSkewDoubleExponential_vv_78;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_79> AgradCcdfLogSkewDoubleExponential_vv_79;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_80> AgradCcdfLogSkewDoubleExponential_vv_80;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_81> AgradCcdfLogSkewDoubleExponential_vv_81;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_82> AgradCcdfLogSkewDoubleExponential_vv_82;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_83> AgradCcdfLogSkewDoubleExponential_vv_83;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_84> AgradCcdfLogSkewDoubleExponential_vv_84;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_85> AgradCcdfLogSkewDoubleExponential_vv_85;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_86> AgradCcdfLogSkewDoubleExponential_vv_86;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_87> AgradCcdfLogSkewDoubleExponential_vv_87;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_88> AgradCcdfLogSkewDoubleExponential_vv_88;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_89> AgradCcdfLogSkewDoubleExponential_vv_89;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_90> AgradCcdfLogSkewDoubleExponential_vv_90;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_91> AgradCcdfLogSkewDoubleExponential_vv_91;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_92> AgradCcdfLogSkewDoubleExponential_vv_92;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_93> AgradCcdfLogSkewDoubleExponential_vv_93;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_94> AgradCcdfLogSkewDoubleExponential_vv_94;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_95> AgradCcdfLogSkewDoubleExponential_vv_95;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_96> AgradCcdfLogSkewDoubleExponential_vv_96;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_97> AgradCcdfLogSkewDoubleExponential_vv_97;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_98> AgradCcdfLogSkewDoubleExponential_vv_98;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_99> AgradCcdfLogSkewDoubleExponential_vv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_0, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_2, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_3, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_4, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_5, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_6, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_7, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_8, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_9, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_10, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_11, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_12, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_13, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_14, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_15, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_16, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_17, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_18, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_19, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_20, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_21, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_22, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_23, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_24, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_25, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_26, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_27, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_28, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_29, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_30, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_31, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_32, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_33, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_34, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_35, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_36, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_37, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_38, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_39, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_40, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_41, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_42, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_43, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_44, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_45, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_46, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_47, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_48, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_49, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_50, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_51, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_52, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_53, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_54, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_55, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_56, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_57, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_58, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_59, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_60, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_61, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_62, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_63, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_64, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_65, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_66, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_67, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_68, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_69, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_70, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_71, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_72, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_73, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_74, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_75, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_76, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_77, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_78, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_79, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_80, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_81, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_82, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_83, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_84, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_85, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_86, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_87, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_88, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_89, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_90, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_91, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_92, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_93, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_94, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_95, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_96, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_97, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_98, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_99, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_99);
+
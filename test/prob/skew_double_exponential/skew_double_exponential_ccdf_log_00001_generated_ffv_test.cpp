@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/skew_double_exponential/skew_double_exponential_ccdf_log_test.hpp>
+
+typedef std::tuple<double, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_100;
+typedef std::tuple<double, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_101;
+typedef std::tuple<double, fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_102;
+typedef std::tuple<double, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_103;
+typedef std::tuple<double, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_104;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_105;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_106;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_107;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_108;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_109;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_110;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_111;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_112;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_113;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_114;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_115;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_116;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, double, double, empty, empty> type_ffv_117;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty, empty> type_ffv_118;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_119;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty, empty> type_ffv_120;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_121;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_122;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty, empty> type_ffv_123;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_124;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_125;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_126;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_127;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_128;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_129;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_130;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_131;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_132;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_133;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_134;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty, empty> type_ffv_135;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_136;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_137;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_138;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_139;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_140;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_141;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_142;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_143;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_144;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_145;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_146;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_147;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_148;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_149;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_150;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_151;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_152;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty, empty> type_ffv_153;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_ffv_154;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_155;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_156;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_157;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_158;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_ffv_159;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_160;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_161;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_162;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_163;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_164;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_165;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_166;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_167;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_168;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_169;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_170;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_171;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_172;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_173;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_174;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_175;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_176;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_177;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_178;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_179;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_180;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_181;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_182;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_183;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_184;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_185;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_186;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_187;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_188;
+typedef std::tuple<std::vector<double>, double, double, fvar<fvar<var> >, empty, empty> type_ffv_189;
+typedef std::tuple<std::vector<double>, double, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_190;
+typedef std::tuple<std::vector<double>, double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_191;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_192;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_193;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_194;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_195;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_196;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_197;
+typedef std::tuple<std::vector<double>, double, fvar<fvar<var> >, double, empty, empty> type_ffv_198;
+typedef std::tuple<std::vector<double>, double, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_199;
+
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_100> AgradCcdfLogSkewDoubleExponential_ffv_100;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_101> AgradCcdfLogSkewDoubleExponential_ffv_101;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_102> AgradCcdfLogSkewDoubleExponential_ffv_102;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_103> AgradCcdfLogSkewDoubleExponential_ffv_103;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_104> AgradCcdfLogSkewDoubleExponential_ffv_104;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_105> AgradCcdfLogSkewDoubleExponential_ffv_105;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_106> AgradCcdfLogSkewDoubleExponential_ffv_106;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_107> AgradCcdfLogSkewDoubleExponential_ffv_107;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_108> AgradCcdfLogSkewDoubleExponential_ffv_108;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_109> AgradCcdfLogSkewDoubleExponential_ffv_109;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_110> AgradCcdfLogSkewDoubleExponential_ffv_110;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_111> AgradCcdfLogSkewDoubleExponential_ffv_111;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_112> AgradCcdfLogSkewDoubleExponential_ffv_112;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_113> AgradCcdfLogSkewDoubleExponential_ffv_113;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_114> AgradCcdfLogSkewDoubleExponential_ffv_114;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_115> AgradCcdfLogSkewDoubleExponential_ffv_115;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_116> AgradCcdfLogSkewDoubleExponential_ffv_116;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_117> AgradCcdfLogSkewDoubleExponential_ffv_117;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_118> AgradCcdfLogSkewDoubleExponential_ffv_118;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_119> AgradCcdfLogSkewDoubleExponential_ffv_119;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_120> AgradCcdfLogSkewDoubleExponential_ffv_120;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_121> AgradCcdfLogSkewDoubleExponential_ffv_121;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_122> AgradCcdfLogSkewDoubleExponential_ffv_122;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_123> AgradCcdfLogSkewDoubleExponential_ffv_123;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_124> AgradCcdfLogSkewDoubleExponential_ffv_124;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_125> AgradCcdfLogSkewDoubleExponential_ffv_125;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_126> AgradCcdfLogSkewDoubleExponential_ffv_126;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_127> AgradCcdfLogSkewDoubleExponential_ffv_127;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_128> AgradCcdfLogSkewDoubleExponential_ffv_128;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_129> AgradCcdfLogSkewDoubleExponential_ffv_129;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_130> AgradCcdfLogSkewDoubleExponential_ffv_130;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_131> AgradCcdfLogSkewDoubleExponential_ffv_131;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_132> AgradCcdfLogSkewDoubleExponential_ffv_132;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_133> AgradCcdfLogSkewDoubleExponential_ffv_133;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_134> AgradCcdfLogSkewDoubleExponential_ffv_134;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_135> AgradCcdfLogSkewDoubleExponential_ffv_135;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_136> AgradCcdfLogSkewDoubleExponential_ffv_136;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_137> AgradCcdfLogSkewDoubleExponential_ffv_137;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_138> AgradCcdfLogSkewDoubleExponential_ffv_138;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_139> AgradCcdfLogSkewDoubleExponential_ffv_139;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_140> AgradCcdfLogSkewDoubleExponential_ffv_140;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_141> AgradCcdfLogSkewDoubleExponential_ffv_141;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_142> AgradCcdfLogSkewDoubleExponential_ffv_142;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_143> AgradCcdfLogSkewDoubleExponential_ffv_143;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_144> AgradCcdfLogSkewDoubleExponential_ffv_144;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_145> AgradCcdfLogSkewDoubleExponential_ffv_145;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_146> AgradCcdfLogSkewDoubleExponential_ffv_146;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_147> AgradCcdfLogSkewDoubleExponential_ffv_147;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_148> AgradCcdfLogSkewDoubleExponential_ffv_148;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_149> AgradCcdfLogSkewDoubleExponential_ffv_149;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_150> AgradCcdfLogSkewDoubleExponential_ffv_150;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_151> AgradCcdfLogSkewDoubleExponential_ffv_151;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_152> AgradCcdfLogSkewDoubleExponential_ffv_152;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_153> AgradCcdfLogSkewDoubleExponential_ffv_153;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_154> AgradCcdfLogSkewDoubleExponential_ffv_154;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_155> AgradCcdfLogSkewDoubleExponential_ffv_155;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_156> AgradCcdfLogSkewDoubleExponential_ffv_156;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_157> AgradCcdfLogSkewDoubleExponential_ffv_157;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_158> AgradCcdfLogSkewDoubleExponential_ffv_158;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_159> AgradCcdfLogSkewDoubleExponential_ffv_159;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_160> AgradCcdfLogSkewDoubleExponential_ffv_160;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_161> AgradCcdfLogSkewDoubleExponential_ffv_161;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_162> AgradCcdfLogSkewDoubleExponential_ffv_162;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_163> AgradCcdfLogSkewDoubleExponential_ffv_163;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_164> AgradCcdfLogSkewDoubleExponential_ffv_164;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_165> AgradCcdfLogSkewDoubleExponential_ffv_165;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_166> AgradCcdfLogSkewDoubleExponential_ffv_166;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_167> AgradCcdfLogSkewDoubleExponential_ffv_167;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_168> AgradCcdfLogSkewDoubleExponential_ffv_168;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_169> AgradCcdfLogSkewDoubleExponential_ffv_169;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_170> AgradCcdfLogSkewDoubleExponential_ffv_170;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_171> AgradCcdfLogSkewDoubleExponential_ffv_171;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_172> AgradCcdfLogSkewDoubleExponential_ffv_172;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_173> AgradCcdfLogSkewDoubleExponential_ffv_173;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_174> AgradCcdfLogSkewDoubleExponential_ffv_174;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_175> AgradCcdfLogSkewDoubleExponential_ffv_175;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_176> AgradCcdfLogSkewDoubleExponential_ffv_176;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_177> AgradCcdfLogSkewDoubleExponential_ffv_177;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_178> AgradCcdfLogSkewDoubleExponential_ffv_178;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_179> AgradCcdfLogSkewDoubleExponential_ffv_179;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_180> AgradCcdfLogSkewDoubleExponential_ffv_180;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_181> AgradCcdfLogSkewDoubleExponential_ffv_181;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_182> AgradCcdfLogSkewDoubleExponential_ffv_182;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_183> AgradCcdfLogSkewDoubleExponential_ffv_183;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_184> AgradCcdfLogSkewDoubleExponential_ffv_184;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_185> AgradCcdfLogSkewDoubleExponential_ffv_185;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_186> AgradCcdfLogSkewDoubleExponential_ffv_186;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_187> AgradCcdfLogSkewDoubleExponential_ffv_187;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_188> AgradCcdfLogSkewDoubleExponential_ffv_188;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_189> AgradCcdfLogSkewDoubleExponential_ffv_189;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_190> AgradCcdfLogSkewDoubleExponential_ffv_190;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_191> AgradCcdfLogSkewDoubleExponential_ffv_191;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_192> AgradCcdfLogSkewDoubleExponential_ffv_192;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_193> AgradCcdfLogSkewDoubleExponential_ffv_193;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_194> AgradCcdfLogSkewDoubleExponential_ffv_194;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_195> AgradCcdfLogSkewDoubleExponential_ffv_195;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_196> AgradCcdfLogSkewDoubleExponential_ffv_196;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_197> AgradCcdfLogSkewDoubleExponential_ffv_197;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_198> AgradCcdfLogSkewDoubleExponential_ffv_198;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_199> AgradCcdfLogSkewDoubleExponential_ffv_199;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_100, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_101, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_102, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_103, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_104, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_105, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_106, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_107, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_108, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_109, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_110, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_111, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_112, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_113, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_114, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_115, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_116, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_117, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_118, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_119, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_120, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_121, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_122, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_123, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_124, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_125, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_126, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_127, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_128, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_129, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_130, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_131, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_132, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_133, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_134, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_135, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_136, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_137, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_138, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_139, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_140, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_141, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_142, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_143, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_144, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_145, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_146, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_147, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_148, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_149, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_150, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_151, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_152, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_153, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_154, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_155, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_156, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_157, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_158, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_159, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_160, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_161, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_162, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_163, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_164, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_165, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_166, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_167, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_168, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_169, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_170, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_171, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_172, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_173, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_174, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_175, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_176, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_177, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_178, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_179, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_180, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_181, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_182, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_183, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_184, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_185, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_186, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_187, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_188, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_188);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_189, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_189);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_190, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_190);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_191, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_191);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_192, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_192);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_193, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_193);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_194, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_194);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_195, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_195);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_196, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_196);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_197, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_197);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_198, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_198);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_199, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_199);
+
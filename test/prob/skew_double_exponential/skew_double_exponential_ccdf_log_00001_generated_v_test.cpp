@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/skew_double_exponential/skew_double_exponential_ccdf_log_test.hpp>
+
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_100;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_101;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_102;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_103;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_104;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_105;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_106;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_107;
+typedef std::tuple<double, var, double, double, empty, empty> type_v_108;
+typedef std::tuple<double, var, double, std::vector<double>, empty, empty> type_v_109;
+typedef std::tuple<double, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_110;
+typedef std::tuple<double, var, double, var, empty, empty> type_v_111;
+typedef std::tuple<double, var, double, std::vector<var>, empty, empty> type_v_112;
+typedef std::tuple<double, var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_113;
+typedef std::tuple<double, var, std::vector<double>, double, empty, empty> type_v_114;
+typedef std::tuple<double, var, std::vector<double>, std::vector<double>, empty, empty> type_v_115;
+typedef std::tuple<double, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_116;
+typedef std::tuple<double, var, std::vector<double>, var, empty, empty> type_v_117;
+typedef std::tuple<double, var, std::vector<double>, std::vector<var>, empty, empty> type_v_118;
+typedef std::tuple<double, var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_119;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_120;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_121;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_122;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_123;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_124;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_125;
+typedef std::tuple<double, var, var, double, empty, empty> type_v_126;
+typedef std::tuple<double, var, var, std::vector<double>, empty, empty> type_v_127;
+typedef std::tuple<double, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_128;
+typedef std::tuple<double, var, var, var, empty, empty> type_v_129;
+typedef std::tuple<double, var, var, std::vector<var>, empty, empty> type_v_130;
+typedef std::tuple<double, var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_131;
+typedef std::tuple<double, var, std::vector<var>, double, empty, empty> type_v_132;
+typedef std::tuple<double, var, std::vector<var>, std::vector<double>, empty, empty> type_v_133;
+typedef std::tuple<double, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_134;
+typedef std::tuple<double, var, std::vector<var>, var, empty, empty> type_v_135;
+typedef std::tuple<double, var, std::vector<var>, std::vector<var>, empty, empty> type_v_136;
+typedef std::tuple<double, var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_137;
+typedef std::tuple<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_138;
+typedef std::tuple<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_139;
+typedef std::tuple<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_140;
+typedef std::tuple<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_141;
+typedef std::tuple<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_142;
+typedef std::tuple<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_143;
+typedef std::tuple<double, std::vector<var>, double, double, empty, empty> type_v_144;
+typedef std::tuple<double, std::vector<var>, double, std::vector<double>, empty, empty> type_v_145;
+typedef std::tuple<double, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_146;
+typedef std::tuple<double, std::vector<var>, double, var, empty, empty> type_v_147;
+typedef std::tuple<double, std::vector<var>, double, std::vector<var>, empty, empty> type_v_148;
+typedef std::tuple<double, std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_149;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, double, empty, empty> type_v_150;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_v_151;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_152;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, var, empty, empty> type_v_153;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_v_154;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_155;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_156;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_157;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_158;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_159;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_160;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_161;
+typedef std::tuple<double, std::vector<var>, var, double, empty, empty> type_v_162;
+typedef std::tuple<double, std::vector<var>, var, std::vector<double>, empty, empty> type_v_163;
+typedef std::tuple<double, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_164;
+typedef std::tuple<double, std::vector<var>, var, var, empty, empty> type_v_165;
+typedef std::tuple<double, std::vector<var>, var, std::vector<var>, empty, empty> type_v_166;
+typedef std::tuple<double, std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_167;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, double, empty, empty> type_v_168;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_v_169;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_170;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, var, empty, empty> type_v_171;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_v_172;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_173;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_174;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_175;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_176;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_177;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_178;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_179;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_180;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_181;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_182;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_183;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_184;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_185;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_186;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_187;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_188;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_189;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_190;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_191;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_192;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_193;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_194;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_195;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_196;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_197;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_198;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_199;
+
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_100> AgradCcdfLogSkewDoubleExponential_v_100;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_101> AgradCcdfLogSkewDoubleExponential_v_101;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_102> AgradCcdfLogSkewDoubleExponential_v_102;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_103> AgradCcdfLogSkewDoubleExponential_v_103;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_104> AgradCcdfLogSkewDoubleExponential_v_104;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_105> AgradCcdfLogSkewDoubleExponential_v_105;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_106> AgradCcdfLogSkewDoubleExponential_v_106;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_107> AgradCcdfLogSkewDoubleExponential_v_107;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_108> AgradCcdfLogSkewDoubleExponential_v_108;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_109> AgradCcdfLogSkewDoubleExponential_v_109;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_110> AgradCcdfLogSkewDoubleExponential_v_110;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_111> AgradCcdfLogSkewDoubleExponential_v_111;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_112> AgradCcdfLogSkewDoubleExponential_v_112;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_113> AgradCcdfLogSkewDoubleExponential_v_113;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_114> AgradCcdfLogSkewDoubleExponential_v_114;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_115> AgradCcdfLogSkewDoubleExponential_v_115;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_116> AgradCcdfLogSkewDoubleExponential_v_116;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_117> AgradCcdfLogSkewDoubleExponential_v_117;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_118> AgradCcdfLogSkewDoubleExponential_v_118;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_119> AgradCcdfLogSkewDoubleExponential_v_119;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_120> AgradCcdfLogSkewDoubleExponential_v_120;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_121> AgradCcdfLogSkewDoubleExponential_v_121;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_122> AgradCcdfLogSkewDoubleExponential_v_122;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_123> AgradCcdfLogSkewDoubleExponential_v_123;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_124> AgradCcdfLogSkewDoubleExponential_v_124;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_125> AgradCcdfLogSkewDoubleExponential_v_125;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_126> AgradCcdfLogSkewDoubleExponential_v_126;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_127> AgradCcdfLogSkewDoubleExponential_v_127;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_128> AgradCcdfLogSkewDoubleExponential_v_128;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_129> AgradCcdfLogSkewDoubleExponential_v_129;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_130> AgradCcdfLogSkewDoubleExponential_v_130;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_131> AgradCcdfLogSkewDoubleExponential_v_131;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_132> AgradCcdfLogSkewDoubleExponential_v_132;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_133> AgradCcdfLogSkewDoubleExponential_v_133;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_134> AgradCcdfLogSkewDoubleExponential_v_134;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_135> AgradCcdfLogSkewDoubleExponential_v_135;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_136> AgradCcdfLogSkewDoubleExponential_v_136;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_137> AgradCcdfLogSkewDoubleExponential_v_137;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_138> AgradCcdfLogSkewDoubleExponential_v_138;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_139> AgradCcdfLogSkewDoubleExponential_v_139;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_140> AgradCcdfLogSkewDoubleExponential_v_140;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_141> AgradCcdfLogSkewDoubleExponential_v_141;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_142> AgradCcdfLogSkewDoubleExponential_v_142;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_143> AgradCcdfLogSkewDoubleExponential_v_143;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_144> AgradCcdfLogSkewDoubleExponential_v_144;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_145> AgradCcdfLogSkewDoubleExponential_v_145;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_146> AgradCcdfLogSkewDoubleExponential_v_146;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_147> AgradCcdfLogSkewDoubleExponential_v_147;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_148> AgradCcdfLogSkewDoubleExponential_v_148;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_149> AgradCcdfLogSkewDoubleExponential_v_149;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_150> AgradCcdfLogSkewDoubleExponential_v_150;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_151> AgradCcdfLogSkewDoubleExponential_v_151;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_152> AgradCcdfLogSkewDoubleExponential_v_152;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_153> AgradCcdfLogSkewDoubleExponential_v_153;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_154> AgradCcdfLogSkewDoubleExponential_v_154;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_155> AgradCcdfLogSkewDoubleExponential_v_155;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_156> AgradCcdfLogSkewDoubleExponential_v_156;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_157> AgradCcdfLogSkewDoubleExponential_v_157;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_158> AgradCcdfLogSkewDoubleExponential_v_158;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_159> AgradCcdfLogSkewDoubleExponential_v_159;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_160> AgradCcdfLogSkewDoubleExponential_v_160;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_161> AgradCcdfLogSkewDoubleExponential_v_161;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_162> AgradCcdfLogSkewDoubleExponential_v_162;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_163> AgradCcdfLogSkewDoubleExponential_v_163;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_164> AgradCcdfLogSkewDoubleExponential_v_164;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_165> AgradCcdfLogSkewDoubleExponential_v_165;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_166> AgradCcdfLogSkewDoubleExponential_v_166;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_167> AgradCcdfLogSkewDoubleExponential_v_167;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_168> AgradCcdfLogSkewDoubleExponential_v_168;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_169> AgradCcdfLogSkewDoubleExponential_v_169;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_170> AgradCcdfLogSkewDoubleExponential_v_170;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_171> AgradCcdfLogSkewDoubleExponential_v_171;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_172> AgradCcdfLogSkewDoubleExponential_v_172;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_173> AgradCcdfLogSkewDoubleExponential_v_173;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_174> AgradCcdfLogSkewDoubleExponential_v_174;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_175> AgradCcdfLogSkewDoubleExponential_v_175;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_176> AgradCcdfLogSkewDoubleExponential_v_176;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_177> AgradCcdfLogSkewDoubleExponential_v_177;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_178> AgradCcdfLogSkewDoubleExponential_v_178;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_179> AgradCcdfLogSkewDoubleExponential_v_179;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_180> AgradCcdfLogSkewDoubleExponential_v_180;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_181> AgradCcdfLogSkewDoubleExponential_v_181;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_182> AgradCcdfLogSkewDoubleExponential_v_182;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_183> AgradCcdfLogSkewDoubleExponential_v_183;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_184> AgradCcdfLogSkewDoubleExponential_v_184;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_185> AgradCcdfLogSkewDoubleExponential_v_185;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_186> AgradCcdfLogSkewDoubleExponential_v_186;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_187> AgradCcdfLogSkewDoubleExponential_v_187;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_188> AgradCcdfLogSkewDoubleExponential_v_188;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_189> AgradCcdfLogSkewDoubleExponential_v_189;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_190> AgradCcdfLogSkewDoubleExponential_v_190;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_191> AgradCcdfLogSkewDoubleExponential_v_191;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_192> AgradCcdfLogSkewDoubleExponential_v_192;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_193> AgradCcdfLogSkewDoubleExponential_v_193;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_194> AgradCcdfLogSkewDoubleExponential_v_194;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_195> AgradCcdfLogSkewDoubleExponential_v_195;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_196> AgradCcdfLogSkewDoubleExponential_v_196;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_197> AgradCcdfLogSkewDoubleExponential_v_197;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_198> AgradCcdfLogSkewDoubleExponential_v_198;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_199> AgradCcdfLogSkewDoubleExponential_v_199;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_100, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_101, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_102, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_103, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_104, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_105, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_106, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_107, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_108, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_109, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_110, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_111, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_112, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_113, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_114, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_115, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_116, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_117, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_118, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_119, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_120, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_121, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_122, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_123, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_124, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_125, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_126, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_127, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_128, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_129, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_130, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_131, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_132, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_133, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_134, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_135, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_136, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_137, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_138, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_139, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_140, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_141, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_142, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_143, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_144, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_145, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_146, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_147, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_148, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_149, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_150, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_151, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_152, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_153, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_154, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_155, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_156, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_157, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_158, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_159, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_160, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_161, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_162, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_163, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_164, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_165, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_166, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_167, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_168, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_169, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_170, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_171, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_172, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_173, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_174, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_175, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_176, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_177, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_178, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_179, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_180, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_181, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_182, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_183, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_184, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_185, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_186, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_187, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_188, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_188);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_189, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_189);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_190, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_190);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_191, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_191);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_192, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_192);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_193, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_193);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_194, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_194);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_195, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_195);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_196, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_196);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_197, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_197);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_198, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_198);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_199, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_199);
+
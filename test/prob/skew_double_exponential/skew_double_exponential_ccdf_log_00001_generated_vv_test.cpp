@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/skew_double_exponential/skew_double_exponential_ccdf_log_test.hpp>
+
+typedef std::tuple<double, var, var, std::vector<double>, empty, empty> type_vv_100;
+typedef std::tuple<double, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_101;
+typedef std::tuple<double, var, var, var, empty, empty> type_vv_102;
+typedef std::tuple<double, var, var, std::vector<var>, empty, empty> type_vv_103;
+typedef std::tuple<double, var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_104;
+typedef std::tuple<double, var, std::vector<var>, double, empty, empty> type_vv_105;
+typedef std::tuple<double, var, std::vector<var>, std::vector<double>, empty, empty> type_vv_106;
+typedef std::tuple<double, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_107;
+typedef std::tuple<double, var, std::vector<var>, var, empty, empty> type_vv_108;
+typedef std::tuple<double, var, std::vector<var>, std::vector<var>, empty, empty> type_vv_109;
+typedef std::tuple<double, var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_110;
+typedef std::tuple<double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_111;
+typedef std::tuple<double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_112;
+typedef std::tuple<double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_113;
+typedef std::tuple<double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_114;
+typedef std::tuple<double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_115;
+typedef std::tuple<double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_116;
+typedef std::tuple<double, std::vector<var>, double, double, empty, empty> type_vv_117;
+typedef std::tuple<double, std::vector<var>, double, std::vector<double>, empty, empty> type_vv_118;
+typedef std::tuple<double, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_119;
+typedef std::tuple<double, std::vector<var>, double, var, empty, empty> type_vv_120;
+typedef std::tuple<double, std::vector<var>, double, std::vector<var>, empty, empty> type_vv_121;
+typedef std::tuple<double, std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_122;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, double, empty, empty> type_vv_123;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_vv_124;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_125;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, var, empty, empty> type_vv_126;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_vv_127;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_128;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_129;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_130;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_131;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_132;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_133;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_134;
+typedef std::tuple<double, std::vector<var>, var, double, empty, empty> type_vv_135;
+typedef std::tuple<double, std::vector<var>, var, std::vector<double>, empty, empty> type_vv_136;
+typedef std::tuple<double, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_137;
+typedef std::tuple<double, std::vector<var>, var, var, empty, empty> type_vv_138;
+typedef std::tuple<double, std::vector<var>, var, std::vector<var>, empty, empty> type_vv_139;
+typedef std::tuple<double, std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_140;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, double, empty, empty> type_vv_141;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_vv_142;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_143;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, var, empty, empty> type_vv_144;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_vv_145;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_146;
+typedef std::tuple<double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_147;
+typedef std::tuple<double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_148;
+typedef std::tuple<double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_149;
+typedef std::tuple<double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_150;
+typedef std::tuple<double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_151;
+typedef std::tuple<double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_152;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, empty, empty> type_vv_153;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, empty, empty> type_vv_154;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_155;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, empty, empty> type_vv_156;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, empty, empty> type_vv_157;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_158;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, empty, empty> type_vv_159;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, empty, empty> type_vv_160;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_161;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, empty, empty> type_vv_162;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, empty, empty> type_vv_163;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_164;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_165;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_166;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_167;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_168;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_169;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_170;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, empty, empty> type_vv_171;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, empty, empty> type_vv_172;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_173;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, empty, empty> type_vv_174;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, empty, empty> type_vv_175;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_176;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, empty, empty> type_vv_177;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, empty, empty> type_vv_178;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_179;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, empty, empty> type_vv_180;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, empty, empty> type_vv_181;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_182;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_183;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_184;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_185;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_186;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_187;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_188;
+typedef std::tuple<std::vector<double>, double, double, var, empty, empty> type_vv_189;
+typedef std::tuple<std::vector<double>, double, double, std::vector<var>, empty, empty> type_vv_190;
+typedef std::tuple<std::vector<double>, double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_191;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, var, empty, empty> type_vv_192;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, std::vector<var>, empty, empty> type_vv_193;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_194;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_195;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_196;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_197;
+typedef std::tuple<std::vector<double>, double, var, double, empty, empty> type_vv_198;
+typedef std::tuple<std::vector<double>, double, var, std::vector<double>, empty, empty> type_vv_199;
+
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_100> AgradCcdfLogSkewDoubleExponential_vv_100;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_101> AgradCcdfLogSkewDoubleExponential_vv_101;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_102> AgradCcdfLogSkewDoubleExponential_vv_102;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_103> AgradCcdfLogSkewDoubleExponential_vv_103;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_104> AgradCcdfLogSkewDoubleExponential_vv_104;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_105> AgradCcdfLogSkewDoubleExponential_vv_105;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_106> AgradCcdfLogSkewDoubleExponential_vv_106;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_107> AgradCcdfLogSkewDoubleExponential_vv_107;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_108> AgradCcdfLogSkewDoubleExponential_vv_108;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_109> AgradCcdfLogSkewDoubleExponential_vv_109;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_110> AgradCcdfLogSkewDoubleExponential_vv_110;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_111> AgradCcdfLogSkewDoubleExponential_vv_111;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_112> AgradCcdfLogSkewDoubleExponential_vv_112;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_113> AgradCcdfLogSkewDoubleExponential_vv_113;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_114> AgradCcdfLogSkewDoubleExponential_vv_114;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_115> AgradCcdfLogSkewDoubleExponential_vv_115;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_116> AgradCcdfLogSkewDoubleExponential_vv_116;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_117> AgradCcdfLogSkewDoubleExponential_vv_117;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_118> AgradCcdfLogSkewDoubleExponential_vv_118;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_119> AgradCcdfLogSkewDoubleExponential_vv_119;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_120> AgradCcdfLogSkewDoubleExponential_vv_120;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_121> AgradCcdfLogSkewDoubleExponential_vv_121;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_122> AgradCcdfLogSkewDoubleExponential_vv_122;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_123> AgradCcdfLogSkewDoubleExponential_vv_123;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_124> AgradCcdfLogSkewDoubleExponential_vv_124;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_125> AgradCcdfLogSkewDoubleExponential_vv_125;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_126> AgradCcdfLogSkewDoubleExponential_vv_126;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_127> AgradCcdfLogSkewDoubleExponential_vv_127;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_128> AgradCcdfLogSkewDoubleExponential_vv_128;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_129> AgradCcdfLogSkewDoubleExponential_vv_129;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_130> AgradCcdfLogSkewDoubleExponential_vv_130;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_131> AgradCcdfLogSkewDoubleExponential_vv_131;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_132> AgradCcdfLogSkewDoubleExponential_vv_132;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_133> AgradCcdfLogSkewDoubleExponential_vv_133;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_134> AgradCcdfLogSkewDoubleExponential_vv_134;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_135> AgradCcdfLogSkewDoubleExponential_vv_135;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_136> AgradCcdfLogSkewDoubleExponential_vv_136;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_137> AgradCcdfLogSkewDoubleExponential_vv_137;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_138> AgradCcdfLogSkewDoubleExponential_vv_138;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_139> AgradCcdfLogSkewDoubleExponential_vv_139;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_140> AgradCcdfLogSkewDoubleExponential_vv_140;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_141> AgradCcdfLogSkewDoubleExponential_vv_141;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_142> AgradCcdfLogSkewDoubleExponential_vv_142;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_143> AgradCcdfLogSkewDoubleExponential_vv_143;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_144> AgradCcdfLogSkewDoubleExponential_vv_144;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_145> AgradCcdfLogSkewDoubleExponential_vv_145;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_146> AgradCcdfLogSkewDoubleExponential_vv_146;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_147> AgradCcdfLogSkewDoubleExponential_vv_147;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_148> AgradCcdfLogSkewDoubleExponential_vv_148;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_149> AgradCcdfLogSkewDoubleExponential_vv_149;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_150> AgradCcdfLogSkewDoubleExponential_vv_150;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_151> AgradCcdfLogSkewDoubleExponential_vv_151;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_152> AgradCcdfLogSkewDoubleExponential_vv_152;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_153> AgradCcdfLogSkewDoubleExponential_vv_153;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_154> AgradCcdfLogSkewDoubleExponential_vv_154;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_155> AgradCcdfLogSkewDoubleExponential_vv_155;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_156> AgradCcdfLogSkewDoubleExponential_vv_156;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_157> AgradCcdfLogSkewDoubleExponential_vv_157;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_158> AgradCcdfLogSkewDoubleExponential_vv_158;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_159> AgradCcdfLogSkewDoubleExponential_vv_159;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_160> AgradCcdfLogSkewDoubleExponential_vv_160;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_161> AgradCcdfLogSkewDoubleExponential_vv_161;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_162> AgradCcdfLogSkewDoubleExponential_vv_162;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_163> AgradCcdfLogSkewDoubleExponential_vv_163;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_164> AgradCcdfLogSkewDoubleExponential_vv_164;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_165> AgradCcdfLogSkewDoubleExponential_vv_165;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_166> AgradCcdfLogSkewDoubleExponential_vv_166;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_167> AgradCcdfLogSkewDoubleExponential_vv_167;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_168> AgradCcdfLogSkewDoubleExponential_vv_168;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_169> AgradCcdfLogSkewDoubleExponential_vv_169;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_170> AgradCcdfLogSkewDoubleExponential_vv_170;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_171> AgradCcdfLogSkewDoubleExponential_vv_171;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_172> AgradCcdfLogSkewDoubleExponential_vv_172;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_173> AgradCcdfLogSkewDoubleExponential_vv_173;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_174> AgradCcdfLogSkewDoubleExponential_vv_174;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_175> AgradCcdfLogSkewDoubleExponential_vv_175;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_176> AgradCcdfLogSkewDoubleExponential_vv_176;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_177> AgradCcdfLogSkewDoubleExponential_vv_177;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_178> AgradCcdfLogSkewDoubleExponential_vv_178;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_179> AgradCcdfLogSkewDoubleExponential_vv_179;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_180> AgradCcdfLogSkewDoubleExponential_vv_180;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_181> AgradCcdfLogSkewDoubleExponential_vv_181;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_182> AgradCcdfLogSkewDoubleExponential_vv_182;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_183> AgradCcdfLogSkewDoubleExponential_vv_183;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_184> AgradCcdfLogSkewDoubleExponential_vv_184;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_185> AgradCcdfLogSkewDoubleExponential_vv_185;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_186> AgradCcdfLogSkewDoubleExponential_vv_186;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_187> AgradCcdfLogSkewDoubleExponential_vv_187;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_188> AgradCcdfLogSkewDoubleExponential_vv_188;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_189> AgradCcdfLogSkewDoubleExponential_vv_189;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_190> AgradCcdfLogSkewDoubleExponential_vv_190;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_191> AgradCcdfLogSkewDoubleExponential_vv_191;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_192> AgradCcdfLogSkewDoubleExponential_vv_192;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_193> AgradCcdfLogSkewDoubleExponential_vv_193;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_194> AgradCcdfLogSkewDoubleExponential_vv_194;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_195> AgradCcdfLogSkewDoubleExponential_vv_195;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_196> AgradCcdfLogSkewDoubleExponential_vv_196;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_197> AgradCcdfLogSkewDoubleExponential_vv_197;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_198> AgradCcdfLogSkewDoubleExponential_vv_198;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_199> AgradCcdfLogSkewDoubleExponential_vv_199;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_100, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_101, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_102, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_103, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_104, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_105, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_106, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_107, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_108, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_109, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_110, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_111, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_112, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_113, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_114, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_115, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_116, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_117, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_118, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_119, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_120, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_121, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_122, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_123, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_124, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_125, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_126, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_127, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_128, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_129, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_130, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_131, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_132, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_133, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_134, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_135, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_136, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_137, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_138, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_139, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_140, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_141, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_142, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_143, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_144, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_145, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_146, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_147, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_148, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_149, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_150, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_151, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_152, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_153, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_154, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_155, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_156, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_157, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_158, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_159, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_160, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_161, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_162, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_163, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_164, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_165, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_166, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_167, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_168, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_169, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_170, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_171, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_172, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_173, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_174, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_175, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_176, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_177, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_178, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_179, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_180, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_181, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_182, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_183, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_184, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_185, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_186, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_187, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_188, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_188);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_189, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_189);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_190, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_190);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_191, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_191);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_192, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_192);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_193, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_193);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_194, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_194);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_195, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_195);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_196, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_196);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_197, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_197);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_198, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_198);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_199, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_199);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/skew_double_exponential/skew_double_exponential_ccdf_log_test.hpp>
+
+typedef std::tuple<std::vector<double>, double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_200;
+typedef std::tuple<std::vector<double>, double, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_201;
+typedef std::tuple<std::vector<double>, double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_202;
+typedef std::tuple<std::vector<double>, double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_203;
+typedef std::tuple<std::vector<double>, double, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_204;
+typedef std::tuple<std::vector<double>, double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_205;
+typedef std::tuple<std::vector<double>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_206;
+typedef std::tuple<std::vector<double>, double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_207;
+typedef std::tuple<std::vector<double>, double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_208;
+typedef std::tuple<std::vector<double>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_209;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_210;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_211;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_212;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_213;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_214;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_215;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, fvar<fvar<var> >, empty, empty> type_ffv_216;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_217;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_218;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_219;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_220;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_221;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_222;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_223;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_224;
+typedef std::tuple<std::vector<double>, std::vector<double>, fvar<fvar<var> >, double, empty, empty> type_ffv_225;
+typedef std::tuple<std::vector<double>, std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_226;
+typedef std::tuple<std::vector<double>, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_227;
+typedef std::tuple<std::vector<double>, std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_228;
+typedef std::tuple<std::vector<double>, std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_229;
+typedef std::tuple<std::vector<double>, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_230;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_231;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_232;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_233;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_234;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_235;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_236;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_237;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_238;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_239;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_240;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_241;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_242;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_243;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_244;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_245;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_246;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_247;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_248;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_249;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_250;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_251;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_252;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_253;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_254;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_255;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_256;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_257;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_258;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_259;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_260;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_261;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_262;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_263;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_264;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_265;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_266;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_267;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_268;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_269;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, double, double, empty, empty> type_ffv_270;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, double, std::vector<double>, empty, empty> type_ffv_271;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_272;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, double, fvar<fvar<var> >, empty, empty> type_ffv_273;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_274;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_275;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<double>, double, empty, empty> type_ffv_276;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty, empty> type_ffv_277;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_278;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_279;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_280;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_281;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_282;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_283;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_284;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_285;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_286;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_287;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, double, empty, empty> type_ffv_288;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_289;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_290;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_291;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_292;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_293;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_294;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_295;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_296;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_297;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_298;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_299;
+
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_200> AgradCcdfLogSkewDoubleExponential_ffv_200;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_201> AgradCcdfLogSkewDoubleExponential_ffv_201;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_202> AgradCcdfLogSkewDoubleExponential_ffv_202;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_203> AgradCcdfLogSkewDoubleExponential_ffv_203;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_204> AgradCcdfLogSkewDoubleExponential_ffv_204;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_205> AgradCcdfLogSkewDoubleExponential_ffv_205;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_206> AgradCcdfLogSkewDoubleExponential_ffv_206;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_207> AgradCcdfLogSkewDoubleExponential_ffv_207;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_208> AgradCcdfLogSkewDoubleExponential_ffv_208;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_209> AgradCcdfLogSkewDoubleExponential_ffv_209;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_210> AgradCcdfLogSkewDoubleExponential_ffv_210;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_211> AgradCcdfLogSkewDoubleExponential_ffv_211;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_212> AgradCcdfLogSkewDoubleExponential_ffv_212;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_213> AgradCcdfLogSkewDoubleExponential_ffv_213;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_214> AgradCcdfLogSkewDoubleExponential_ffv_214;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_215> AgradCcdfLogSkewDoubleExponential_ffv_215;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_216> AgradCcdfLogSkewDoubleExponential_ffv_216;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_217> AgradCcdfLogSkewDoubleExponential_ffv_217;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_218> AgradCcdfLogSkewDoubleExponential_ffv_218;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_219> AgradCcdfLogSkewDoubleExponential_ffv_219;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_220> AgradCcdfLogSkewDoubleExponential_ffv_220;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_221> AgradCcdfLogSkewDoubleExponential_ffv_221;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_222> AgradCcdfLogSkewDoubleExponential_ffv_222;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_223> AgradCcdfLogSkewDoubleExponential_ffv_223;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_224> AgradCcdfLogSkewDoubleExponential_ffv_224;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_225> AgradCcdfLogSkewDoubleExponential_ffv_225;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_226> AgradCcdfLogSkewDoubleExponential_ffv_226;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_227> AgradCcdfLogSkewDoubleExponential_ffv_227;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_228> AgradCcdfLogSkewDoubleExponential_ffv_228;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_229> AgradCcdfLogSkewDoubleExponential_ffv_229;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_230> AgradCcdfLogSkewDoubleExponential_ffv_230;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_231> AgradCcdfLogSkewDoubleExponential_ffv_231;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_232> AgradCcdfLogSkewDoubleExponential_ffv_232;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_233> AgradCcdfLogSkewDoubleExponential_ffv_233;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_234> AgradCcdfLogSkewDoubleExponential_ffv_234;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_235> AgradCcdfLogSkewDoubleExponential_ffv_235;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_236> AgradCcdfLogSkewDoubleExponential_ffv_236;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_237> AgradCcdfLogSkewDoubleExponential_ffv_237;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_238> AgradCcdfLogSkewDoubleExponential_ffv_238;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_239> AgradCcdfLogSkewDoubleExponential_ffv_239;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_240> AgradCcdfLogSkewDoubleExponential_ffv_240;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_241> AgradCcdfLogSkewDoubleExponential_ffv_241;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_242> AgradCcdfLogSkewDoubleExponential_ffv_242;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_243> AgradCcdfLogSkewDoubleExponential_ffv_243;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_244> AgradCcdfLogSkewDoubleExponential_ffv_244;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_245> AgradCcdfLogSkewDoubleExponential_ffv_245;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_246> AgradCcdfLogSkewDoubleExponential_ffv_246;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_247> AgradCcdfLogSkewDoubleExponential_ffv_247;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_248> AgradCcdfLogSkewDoubleExponential_ffv_248;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_249> AgradCcdfLogSkewDoubleExponential_ffv_249;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_250> AgradCcdfLogSkewDoubleExponential_ffv_250;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_251> AgradCcdfLogSkewDoubleExponential_ffv_251;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_252> AgradCcdfLogSkewDoubleExponential_ffv_252;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_253> AgradCcdfLogSkewDoubleExponential_ffv_253;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_254> AgradCcdfLogSkewDoubleExponential_ffv_254;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_255> AgradCcdfLogSkewDoubleExponential_ffv_255;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_256> AgradCcdfLogSkewDoubleExponential_ffv_256;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_257> AgradCcdfLogSkewDoubleExponential_ffv_257;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_258> AgradCcdfLogSkewDoubleExponential_ffv_258;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_259> AgradCcdfLogSkewDoubleExponential_ffv_259;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_260> AgradCcdfLogSkewDoubleExponential_ffv_260;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_261> AgradCcdfLogSkewDoubleExponential_ffv_261;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_262> AgradCcdfLogSkewDoubleExponential_ffv_262;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_263> AgradCcdfLogSkewDoubleExponential_ffv_263;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_264> AgradCcdfLogSkewDoubleExponential_ffv_264;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_265> AgradCcdfLogSkewDoubleExponential_ffv_265;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_266> AgradCcdfLogSkewDoubleExponential_ffv_266;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_267> AgradCcdfLogSkewDoubleExponential_ffv_267;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_268> AgradCcdfLogSkewDoubleExponential_ffv_268;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_269> AgradCcdfLogSkewDoubleExponential_ffv_269;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_270> AgradCcdfLogSkewDoubleExponential_ffv_270;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_271> AgradCcdfLogSkewDoubleExponential_ffv_271;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_272> AgradCcdfLogSkewDoubleExponential_ffv_272;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_273> AgradCcdfLogSkewDoubleExponential_ffv_273;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_274> AgradCcdfLogSkewDoubleExponential_ffv_274;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_275> AgradCcdfLogSkewDoubleExponential_ffv_275;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_276> AgradCcdfLogSkewDoubleExponential_ffv_276;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_277> AgradCcdfLogSkewDoubleExponential_ffv_277;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_278> AgradCcdfLogSkewDoubleExponential_ffv_278;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_279> AgradCcdfLogSkewDoubleExponential_ffv_279;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_280> AgradCcdfLogSkewDoubleExponential_ffv_280;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_281> AgradCcdfLogSkewDoubleExponential_ffv_281;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_282> AgradCcdfLogSkewDoubleExponential_ffv_282;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_283> AgradCcdfLogSkewDoubleExponential_ffv_283;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_284> AgradCcdfLogSkewDoubleExponential_ffv_284;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_285> AgradCcdfLogSkewDoubleExponential_ffv_285;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_286> AgradCcdfLogSkewDoubleExponential_ffv_286;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_287> AgradCcdfLogSkewDoubleExponential_ffv_287;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_288> AgradCcdfLogSkewDoubleExponential_ffv_288;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_289> AgradCcdfLogSkewDoubleExponential_ffv_289;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_290> AgradCcdfLogSkewDoubleExponential_ffv_290;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_291> AgradCcdfLogSkewDoubleExponential_ffv_291;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_292> AgradCcdfLogSkewDoubleExponential_ffv_292;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_293> AgradCcdfLogSkewDoubleExponential_ffv_293;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_294> AgradCcdfLogSkewDoubleExponential_ffv_294;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_295> AgradCcdfLogSkewDoubleExponential_ffv_295;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_296> AgradCcdfLogSkewDoubleExponential_ffv_296;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_297> AgradCcdfLogSkewDoubleExponential_ffv_297;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_298> AgradCcdfLogSkewDoubleExponential_ffv_298;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_299> AgradCcdfLogSkewDoubleExponential_ffv_299;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_200, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_200);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_201, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_201);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_202, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_202);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_203, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_203);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_204, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_204);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_205, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_205);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_206, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_206);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_207, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_207);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_208, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_208);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_209, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_209);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_210, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_210);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_211, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_211);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_212, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_212);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_213, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_213);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_214, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_214);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_215, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_215);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_216, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_216);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_217, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_217);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_218, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_218);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_219, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_219);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_220, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_220);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_221, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_221);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_222, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_222);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_223, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_223);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_224, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_224);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_225, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_225);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_226, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_226);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_227, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_227);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_228, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_228);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_229, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_229);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_230, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_230);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_231, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_231);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_232, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_232);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_233, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_233);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_234, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_234);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_235, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_235);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_236, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_236);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_237, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_237);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_238, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_238);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_239, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_239);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_240, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_240);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_241, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_241);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_242, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_242);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_243, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_243);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_244, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_244);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_245, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_245);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_246, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_246);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_247, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_247);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_248, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_248);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_249, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_249);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_250, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_250);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_251, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_251);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_252, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_252);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_253, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_253);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_254, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_254);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_255, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_255);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_256, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_256);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_257, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_257);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_258, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_258);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_259, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_259);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_260, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_260);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_261, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_261);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_262, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_262);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_263, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_263);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_264, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_264);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_265, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_265);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_266, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_266);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_267, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_267);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_268, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_268);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_269, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_269);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_270, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_270);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_271, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_271);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_272, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_272);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_273, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_273);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_274, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_274);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_275, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_275);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_276, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_276);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_277, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_277);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_278, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_278);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_279, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_279);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_280, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_280);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_281, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_281);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_282, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_282);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_283, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_283);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_284, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_284);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_285, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_285);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_286, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_286);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_287, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_287);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_288, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_288);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_289, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_289);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_290, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_290);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_291, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_291);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_292, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_292);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_293, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_293);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_294, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_294);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_295, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_295);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_296, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_296);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_297, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_297);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_298, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_298);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_299, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_299);
+
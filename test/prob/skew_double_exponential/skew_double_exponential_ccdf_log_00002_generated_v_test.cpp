@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/skew_double_exponential/skew_double_exponential_ccdf_log_test.hpp>
+
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_200;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_201;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_202;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_203;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_204;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_205;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_206;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_207;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_208;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_209;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_210;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_211;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_212;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_213;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_214;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_215;
+typedef std::tuple<std::vector<double>, double, double, double, empty, empty> type_v_216;
+typedef std::tuple<std::vector<double>, double, double, std::vector<double>, empty, empty> type_v_217;
+typedef std::tuple<std::vector<double>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_218;
+typedef std::tuple<std::vector<double>, double, double, var, empty, empty> type_v_219;
+typedef std::tuple<std::vector<double>, double, double, std::vector<var>, empty, empty> type_v_220;
+typedef std::tuple<std::vector<double>, double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_221;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, double, empty, empty> type_v_222;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, std::vector<double>, empty, empty> type_v_223;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_224;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, var, empty, empty> type_v_225;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, std::vector<var>, empty, empty> type_v_226;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_227;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_228;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_229;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_230;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_231;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_232;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_233;
+typedef std::tuple<std::vector<double>, double, var, double, empty, empty> type_v_234;
+typedef std::tuple<std::vector<double>, double, var, std::vector<double>, empty, empty> type_v_235;
+typedef std::tuple<std::vector<double>, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_236;
+typedef std::tuple<std::vector<double>, double, var, var, empty, empty> type_v_237;
+typedef std::tuple<std::vector<double>, double, var, std::vector<var>, empty, empty> type_v_238;
+typedef std::tuple<std::vector<double>, double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_239;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, double, empty, empty> type_v_240;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, std::vector<double>, empty, empty> type_v_241;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_242;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, var, empty, empty> type_v_243;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, std::vector<var>, empty, empty> type_v_244;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_245;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_246;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_247;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_248;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_249;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_250;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_251;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, double, empty, empty> type_v_252;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, std::vector<double>, empty, empty> type_v_253;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_254;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, var, empty, empty> type_v_255;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, std::vector<var>, empty, empty> type_v_256;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_257;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, double, empty, empty> type_v_258;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, std::vector<double>, empty, empty> type_v_259;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_260;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, var, empty, empty> type_v_261;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_v_262;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_263;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_264;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_265;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_266;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_267;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_268;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_269;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, double, empty, empty> type_v_270;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, std::vector<double>, empty, empty> type_v_271;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_272;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, var, empty, empty> type_v_273;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, std::vector<var>, empty, empty> type_v_274;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_275;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, double, empty, empty> type_v_276;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_v_277;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_278;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, var, empty, empty> type_v_279;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_v_280;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_281;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_282;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_283;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_284;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_285;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_286;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_287;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_288;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_289;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_290;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_291;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_292;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_293;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_294;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_295;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_296;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_297;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_298;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_299;
+
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_200> AgradCcdfLogSkewDoubleExponential_v_200;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_201> AgradCcdfLogSkewDoubleExponential_v_201;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_202> AgradCcdfLogSkewDoubleExponential_v_202;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_203> AgradCcdfLogSkewDoubleExponential_v_203;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_204> AgradCcdfLogSkewDoubleExponential_v_204;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_205> AgradCcdfLogSkewDoubleExponential_v_205;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_206> AgradCcdfLogSkewDoubleExponential_v_206;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_207> AgradCcdfLogSkewDoubleExponential_v_207;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_208> AgradCcdfLogSkewDoubleExponential_v_208;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_209> AgradCcdfLogSkewDoubleExponential_v_209;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_210> AgradCcdfLogSkewDoubleExponential_v_210;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_211> AgradCcdfLogSkewDoubleExponential_v_211;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_212> AgradCcdfLogSkewDoubleExponential_v_212;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_213> AgradCcdfLogSkewDoubleExponential_v_213;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_214> AgradCcdfLogSkewDoubleExponential_v_214;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_215> AgradCcdfLogSkewDoubleExponential_v_215;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_216> AgradCcdfLogSkewDoubleExponential_v_216;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_217> AgradCcdfLogSkewDoubleExponential_v_217;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_218> AgradCcdfLogSkewDoubleExponential_v_218;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_219> AgradCcdfLogSkewDoubleExponential_v_219;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_220> AgradCcdfLogSkewDoubleExponential_v_220;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_221> AgradCcdfLogSkewDoubleExponential_v_221;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_222> AgradCcdfLogSkewDoubleExponential_v_222;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_223> AgradCcdfLogSkewDoubleExponential_v_223;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_224> AgradCcdfLogSkewDoubleExponential_v_224;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_225> AgradCcdfLogSkewDoubleExponential_v_225;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_226> AgradCcdfLogSkewDoubleExponential_v_226;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_227> AgradCcdfLogSkewDoubleExponential_v_227;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_228> AgradCcdfLogSkewDoubleExponential_v_228;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_229> AgradCcdfLogSkewDoubleExponential_v_229;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_230> AgradCcdfLogSkewDoubleExponential_v_230;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_231> AgradCcdfLogSkewDoubleExponential_v_231;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_232> AgradCcdfLogSkewDoubleExponential_v_232;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_233> AgradCcdfLogSkewDoubleExponential_v_233;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_234> AgradCcdfLogSkewDoubleExponential_v_234;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_235> AgradCcdfLogSkewDoubleExponential_v_235;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_236> AgradCcdfLogSkewDoubleExponential_v_236;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_237> AgradCcdfLogSkewDoubleExponential_v_237;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_238> AgradCcdfLogSkewDoubleExponential_v_238;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_239> AgradCcdfLogSkewDoubleExponential_v_239;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_240> AgradCcdfLogSkewDoubleExponential_v_240;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_241> AgradCcdfLogSkewDoubleExponential_v_241;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_242> AgradCcdfLogSkewDoubleExponential_v_242;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_243> AgradCcdfLogSkewDoubleExponential_v_243;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_244> AgradCcdfLogSkewDoubleExponential_v_244;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_245> AgradCcdfLogSkewDoubleExponential_v_245;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_246> AgradCcdfLogSkewDoubleExponential_v_246;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_247> AgradCcdfLogSkewDoubleExponential_v_247;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_248> AgradCcdfLogSkewDoubleExponential_v_248;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_249> AgradCcdfLogSkewDoubleExponential_v_249;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_250> AgradCcdfLogSkewDoubleExponential_v_250;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_251> AgradCcdfLogSkewDoubleExponential_v_251;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_252> AgradCcdfLogSkewDoubleExponential_v_252;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_253> AgradCcdfLogSkewDoubleExponential_v_253;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_254> AgradCcdfLogSkewDoubleExponential_v_254;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_255> AgradCcdfLogSkewDoubleExponential_v_255;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_256> AgradCcdfLogSkewDoubleExponential_v_256;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_257> AgradCcdfLogSkewDoubleExponential_v_257;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_258> AgradCcdfLogSkewDoubleExponential_v_258;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_259> AgradCcdfLogSkewDoubleExponential_v_259;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_260> AgradCcdfLogSkewDoubleExponential_v_260;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_261> AgradCcdfLogSkewDoubleExponential_v_261;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_262> AgradCcdfLogSkewDoubleExponential_v_262;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_263> AgradCcdfLogSkewDoubleExponential_v_263;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_264> AgradCcdfLogSkewDoubleExponential_v_264;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_265> AgradCcdfLogSkewDoubleExponential_v_265;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_266> AgradCcdfLogSkewDoubleExponential_v_266;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_267> AgradCcdfLogSkewDoubleExponential_v_267;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_268> AgradCcdfLogSkewDoubleExponential_v_268;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_269> AgradCcdfLogSkewDoubleExponential_v_269;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_270> AgradCcdfLogSkewDoubleExponential_v_270;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_271> AgradCcdfLogSkewDoubleExponential_v_271;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_272> AgradCcdfLogSkewDoubleExponential_v_272;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_273> AgradCcdfLogSkewDoubleExponential_v_273;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_274> AgradCcdfLogSkewDoubleExponential_v_274;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_275> AgradCcdfLogSkewDoubleExponential_v_275;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_276> AgradCcdfLogSkewDoubleExponential_v_276;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_277> AgradCcdfLogSkewDoubleExponential_v_277;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_278> AgradCcdfLogSkewDoubleExponential_v_278;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_279> AgradCcdfLogSkewDoubleExponential_v_279;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_280> AgradCcdfLogSkewDoubleExponential_v_280;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_281> AgradCcdfLogSkewDoubleExponential_v_281;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_282> AgradCcdfLogSkewDoubleExponential_v_282;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_283> AgradCcdfLogSkewDoubleExponential_v_283;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_284> AgradCcdfLogSkewDoubleExponential_v_284;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_285> AgradCcdfLogSkewDoubleExponential_v_285;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_286> AgradCcdfLogSkewDoubleExponential_v_286;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_287> AgradCcdfLogSkewDoubleExponential_v_287;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_288> AgradCcdfLogSkewDoubleExponential_v_288;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_289> AgradCcdfLogSkewDoubleExponential_v_289;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_290> AgradCcdfLogSkewDoubleExponential_v_290;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_291> AgradCcdfLogSkewDoubleExponential_v_291;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_292> AgradCcdfLogSkewDoubleExponential_v_292;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_293> AgradCcdfLogSkewDoubleExponential_v_293;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_294> AgradCcdfLogSkewDoubleExponential_v_294;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_295> AgradCcdfLogSkewDoubleExponential_v_295;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_296> AgradCcdfLogSkewDoubleExponential_v_296;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_297> AgradCcdfLogSkewDoubleExponential_v_297;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_298> AgradCcdfLogSkewDoubleExponential_v_298;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_299> AgradCcdfLogSkewDoubleExponential_v_299;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_200, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_200);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_201, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_201);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_202, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_202);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_203, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_203);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_204, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_204);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_205, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_205);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_206, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_206);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_207, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_207);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_208, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_208);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_209, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_209);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_210, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_210);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_211, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_211);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_212, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_212);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_213, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_213);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_214, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_214);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_215, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_215);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_216, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_216);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_217, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_217);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_218, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_218);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_219, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_219);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_220, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_220);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_221, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_221);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_222, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_222);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_223, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_223);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_224, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_224);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_225, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_225);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_226, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_226);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_227, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_227);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_228, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_228);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_229, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_229);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_230, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_230);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_231, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_231);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_232, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_232);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_233, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_233);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_234, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_234);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_235, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_235);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_236, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_236);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_237, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_237);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_238, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_238);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_239, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_239);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_240, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_240);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_241, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_241);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_242, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_242);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_243, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_243);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_244, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_244);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_245, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_245);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_246, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_246);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_247, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_247);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_248, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_248);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_249, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_249);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_250, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_250);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_251, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_251);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_252, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_252);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_253, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_253);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_254, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_254);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_255, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_255);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_256, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_256);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_257, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_257);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_258, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_258);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_259, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_259);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_260, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_260);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_261, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_261);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_262, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_262);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_263, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_263);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_264, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_264);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_265, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_265);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_266, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_266);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_267, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_267);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_268, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_268);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_269, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_269);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_270, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_270);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_271, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_271);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_272, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_272);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_273, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_273);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_274, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_274);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_275, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_275);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_276, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_276);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_277, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_277);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_278, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_278);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_279, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_279);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_280, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_280);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_281, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_281);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_282, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_282);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_283, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_283);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_284, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_284);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_285, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_285);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_286, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_286);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_287, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_287);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_288, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_288);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_289, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_289);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_290, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_290);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_291, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_291);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_292, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_292);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_293, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_293);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_294, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_294);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_295, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_295);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_296, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_296);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_297, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_297);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_298, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_298);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_299, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_299);
+
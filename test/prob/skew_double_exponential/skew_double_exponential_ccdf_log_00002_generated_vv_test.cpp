@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/skew_double_exponential/skew_double_exponential_ccdf_log_test.hpp>
+
+typedef std::tuple<std::vector<double>, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_200;
+typedef std::tuple<std::vector<double>, double, var, var, empty, empty> type_vv_201;
+typedef std::tuple<std::vector<double>, double, var, std::vector<var>, empty, empty> type_vv_202;
+typedef std::tuple<std::vector<double>, double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_203;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, double, empty, empty> type_vv_204;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, std::vector<double>, empty, empty> type_vv_205;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_206;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, var, empty, empty> type_vv_207;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, std::vector<var>, empty, empty> type_vv_208;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_209;
+typedef std::tuple<std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_210;
+typedef std::tuple<std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_211;
+typedef std::tuple<std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_212;
+typedef std::tuple<std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_213;
+typedef std::tuple<std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_214;
+typedef std::tuple<std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_215;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, var, empty, empty> type_vv_216;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, std::vector<var>, empty, empty> type_vv_217;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_218;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, var, empty, empty> type_vv_219;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_vv_220;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_221;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_222;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_223;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_224;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, double, empty, empty> type_vv_225;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, std::vector<double>, empty, empty> type_vv_226;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_227;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, var, empty, empty> type_vv_228;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, std::vector<var>, empty, empty> type_vv_229;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_230;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, double, empty, empty> type_vv_231;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_vv_232;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_233;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, var, empty, empty> type_vv_234;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_vv_235;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_236;
+typedef std::tuple<std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_237;
+typedef std::tuple<std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_238;
+typedef std::tuple<std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_239;
+typedef std::tuple<std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_240;
+typedef std::tuple<std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_241;
+typedef std::tuple<std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_242;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_vv_243;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_vv_244;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_245;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_vv_246;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_vv_247;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_248;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_249;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_250;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_251;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_vv_252;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_vv_253;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_254;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_vv_255;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_vv_256;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_257;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_vv_258;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_vv_259;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_260;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_vv_261;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_vv_262;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_263;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_264;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_265;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_266;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_267;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_268;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_269;
+typedef std::tuple<std::vector<double>, var, double, double, empty, empty> type_vv_270;
+typedef std::tuple<std::vector<double>, var, double, std::vector<double>, empty, empty> type_vv_271;
+typedef std::tuple<std::vector<double>, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_272;
+typedef std::tuple<std::vector<double>, var, double, var, empty, empty> type_vv_273;
+typedef std::tuple<std::vector<double>, var, double, std::vector<var>, empty, empty> type_vv_274;
+typedef std::tuple<std::vector<double>, var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_275;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, double, empty, empty> type_vv_276;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, std::vector<double>, empty, empty> type_vv_277;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_278;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, var, empty, empty> type_vv_279;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, std::vector<var>, empty, empty> type_vv_280;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_281;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_282;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_283;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_284;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_285;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_286;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_287;
+typedef std::tuple<std::vector<double>, var, var, double, empty, empty> type_vv_288;
+typedef std::tuple<std::vector<double>, var, var, std::vector<double>, empty, empty> type_vv_289;
+typedef std::tuple<std::vector<double>, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_290;
+typedef std::tuple<std::vector<double>, var, var, var, empty, empty> type_vv_291;
+typedef std::tuple<std::vector<double>, var, var, std::vector<var>, empty, empty> type_vv_292;
+typedef std::tuple<std::vector<double>, var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_293;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, double, empty, empty> type_vv_294;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, std::vector<double>, empty, empty> type_vv_295;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_296;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, var, empty, empty> type_vv_297;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, std::vector<var>, empty, empty> type_vv_298;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_299;
+
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_200> AgradCcdfLogSkewDoubleExponential_vv_200;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_201> AgradCcdfLogSkewDoubleExponential_vv_201;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_202> AgradCcdfLogSkewDoubleExponential_vv_202;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_203> AgradCcdfLogSkewDoubleExponential_vv_203;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_204> AgradCcdfLogSkewDoubleExponential_vv_204;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_205> AgradCcdfLogSkewDoubleExponential_vv_205;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_206> AgradCcdfLogSkewDoubleExponential_vv_206;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_207> AgradCcdfLogSkewDoubleExponential_vv_207;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_208> AgradCcdfLogSkewDoubleExponential_vv_208;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_209> AgradCcdfLogSkewDoubleExponential_vv_209;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_210> AgradCcdfLogSkewDoubleExponential_vv_210;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_211> AgradCcdfLogSkewDoubleExponential_vv_211;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_212> AgradCcdfLogSkewDoubleExponential_vv_212;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_213> AgradCcdfLogSkewDoubleExponential_vv_213;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_214> AgradCcdfLogSkewDoubleExponential_vv_214;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_215> AgradCcdfLogSkewDoubleExponential_vv_215;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_216> AgradCcdfLogSkewDoubleExponential_vv_216;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_217> AgradCcdfLogSkewDoubleExponential_vv_217;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_218> AgradCcdfLogSkewDoubleExponential_vv_218;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_219> AgradCcdfLogSkewDoubleExponential_vv_219;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_220> AgradCcdfLogSkewDoubleExponential_vv_220;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_221> AgradCcdfLogSkewDoubleExponential_vv_221;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_222> AgradCcdfLogSkewDoubleExponential_vv_222;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_223> AgradCcdfLogSkewDoubleExponential_vv_223;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_224> AgradCcdfLogSkewDoubleExponential_vv_224;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_225> AgradCcdfLogSkewDoubleExponential_vv_225;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_226> AgradCcdfLogSkewDoubleExponential_vv_226;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_227> AgradCcdfLogSkewDoubleExponential_vv_227;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_228> AgradCcdfLogSkewDoubleExponential_vv_228;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_229> AgradCcdfLogSkewDoubleExponential_vv_229;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_230> AgradCcdfLogSkewDoubleExponential_vv_230;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_231> AgradCcdfLogSkewDoubleExponential_vv_231;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_232> AgradCcdfLogSkewDoubleExponential_vv_232;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_233> AgradCcdfLogSkewDoubleExponential_vv_233;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_234> AgradCcdfLogSkewDoubleExponential_vv_234;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_235> AgradCcdfLogSkewDoubleExponential_vv_235;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_236> AgradCcdfLogSkewDoubleExponential_vv_236;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_237> AgradCcdfLogSkewDoubleExponential_vv_237;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_238> AgradCcdfLogSkewDoubleExponential_vv_238;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_239> AgradCcdfLogSkewDoubleExponential_vv_239;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_240> AgradCcdfLogSkewDoubleExponential_vv_240;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_241> AgradCcdfLogSkewDoubleExponential_vv_241;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_242> AgradCcdfLogSkewDoubleExponential_vv_242;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_243> AgradCcdfLogSkewDoubleExponential_vv_243;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_244> AgradCcdfLogSkewDoubleExponential_vv_244;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_245> AgradCcdfLogSkewDoubleExponential_vv_245;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_246> AgradCcdfLogSkewDoubleExponential_vv_246;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_247> AgradCcdfLogSkewDoubleExponential_vv_247;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_248> AgradCcdfLogSkewDoubleExponential_vv_248;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_249> AgradCcdfLogSkewDoubleExponential_vv_249;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_250> AgradCcdfLogSkewDoubleExponential_vv_250;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_251> AgradCcdfLogSkewDoubleExponential_vv_251;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_252> AgradCcdfLogSkewDoubleExponential_vv_252;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_253> AgradCcdfLogSkewDoubleExponential_vv_253;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_254> AgradCcdfLogSkewDoubleExponential_vv_254;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_255> AgradCcdfLogSkewDoubleExponential_vv_255;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_256> AgradCcdfLogSkewDoubleExponential_vv_256;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_257> AgradCcdfLogSkewDoubleExponential_vv_257;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_258> AgradCcdfLogSkewDoubleExponential_vv_258;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_259> AgradCcdfLogSkewDoubleExponential_vv_259;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_260> AgradCcdfLogSkewDoubleExponential_vv_260;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_261> AgradCcdfLogSkewDoubleExponential_vv_261;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_262> AgradCcdfLogSkewDoubleExponential_vv_262;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_263> AgradCcdfLogSkewDoubleExponential_vv_263;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_264> AgradCcdfLogSkewDoubleExponential_vv_264;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_265> AgradCcdfLogSkewDoubleExponential_vv_265;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_266> AgradCcdfLogSkewDoubleExponential_vv_266;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_267> AgradCcdfLogSkewDoubleExponential_vv_267;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_268> AgradCcdfLogSkewDoubleExponential_vv_268;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_269> AgradCcdfLogSkewDoubleExponential_vv_269;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_270> AgradCcdfLogSkewDoubleExponential_vv_270;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_271> AgradCcdfLogSkewDoubleExponential_vv_271;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_272> AgradCcdfLogSkewDoubleExponential_vv_272;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_273> AgradCcdfLogSkewDoubleExponential_vv_273;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_274> AgradCcdfLogSkewDoubleExponential_vv_274;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_275> AgradCcdfLogSkewDoubleExponential_vv_275;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_276> AgradCcdfLogSkewDoubleExponential_vv_276;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_277> AgradCcdfLogSkewDoubleExponential_vv_277;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_278> AgradCcdfLogSkewDoubleExponential_vv_278;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_279> AgradCcdfLogSkewDoubleExponential_vv_279;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_280> AgradCcdfLogSkewDoubleExponential_vv_280;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_281> AgradCcdfLogSkewDoubleExponential_vv_281;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_282> AgradCcdfLogSkewDoubleExponential_vv_282;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_283> AgradCcdfLogSkewDoubleExponential_vv_283;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_284> AgradCcdfLogSkewDoubleExponential_vv_284;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_285> AgradCcdfLogSkewDoubleExponential_vv_285;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_286> AgradCcdfLogSkewDoubleExponential_vv_286;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_287> AgradCcdfLogSkewDoubleExponential_vv_287;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_288> AgradCcdfLogSkewDoubleExponential_vv_288;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_289> AgradCcdfLogSkewDoubleExponential_vv_289;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_290> AgradCcdfLogSkewDoubleExponential_vv_290;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_291> AgradCcdfLogSkewDoubleExponential_vv_291;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_292> AgradCcdfLogSkewDoubleExponential_vv_292;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_293> AgradCcdfLogSkewDoubleExponential_vv_293;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_294> AgradCcdfLogSkewDoubleExponential_vv_294;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_295> AgradCcdfLogSkewDoubleExponential_vv_295;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_296> AgradCcdfLogSkewDoubleExponential_vv_296;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_297> AgradCcdfLogSkewDoubleExponential_vv_297;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_298> AgradCcdfLogSkewDoubleExponential_vv_298;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_299> AgradCcdfLogSkewDoubleExponential_vv_299;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_200, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_200);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_201, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_201);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_202, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_202);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_203, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_203);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_204, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_204);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_205, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_205);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_206, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_206);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_207, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_207);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_208, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_208);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_209, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_209);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_210, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_210);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_211, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_211);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_212, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_212);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_213, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_213);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_214, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_214);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_215, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_215);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_216, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_216);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_217, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_217);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_218, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_218);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_219, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_219);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_220, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_220);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_221, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_221);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_222, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_222);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_223, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_223);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_224, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_224);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_225, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_225);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_226, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_226);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_227, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_227);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_228, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_228);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_229, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_229);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_230, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_230);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_231, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_231);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_232, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_232);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_233, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_233);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_234, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_234);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_235, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_235);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_236, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_236);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_237, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_237);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_238, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_238);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_239, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_239);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_240, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_240);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_241, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_241);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_242, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_242);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_243, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_243);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_244, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_244);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_245, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_245);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_246, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_246);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_247, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_247);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_248, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_248);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_249, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_249);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_250, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_250);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_251, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_251);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_252, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_252);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_253, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_253);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_254, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_254);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_255, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_255);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_256, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_256);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_257, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_257);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_258, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_258);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_259, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_259);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_260, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_260);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_261, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_261);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_262, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_262);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_263, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_263);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_264, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_264);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_265, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_265);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_266, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_266);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_267, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_267);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_268, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_268);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_269, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_269);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_270, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_270);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_271, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_271);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_272, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_272);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_273, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_273);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_274, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_274);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_275, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_275);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_276, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_276);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_277, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_277);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_278, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_278);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_279, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_279);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_280, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_280);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_281, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_281);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_282, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_282);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_283, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_283);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_284, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_284);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_285, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_285);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_286, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_286);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_287, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_287);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_288, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_288);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_289, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_289);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_290, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_290);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_291, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_291);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_292, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_292);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_293, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_293);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_294, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_294);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_295, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_295);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_296, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_296);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_297, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_297);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_298, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_298);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_299, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_299);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/skew_double_exponential/skew_double_exponential_ccdf_log_test.hpp>
+
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_300;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_301;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_302;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_303;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_304;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_305;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, double, double, empty, empty> type_ffv_306;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty, empty> type_ffv_307;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_308;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty, empty> type_ffv_309;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_310;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_311;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty, empty> type_ffv_312;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_313;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_314;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_315;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_316;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_317;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_318;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_319;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_320;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_321;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_322;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_323;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty, empty> type_ffv_324;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_325;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_326;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_327;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_328;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_329;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_330;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_331;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_332;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_333;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_334;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_335;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_336;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_337;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_338;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_339;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_340;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_341;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty, empty> type_ffv_342;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_ffv_343;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_344;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_345;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_346;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_347;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_ffv_348;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_349;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_350;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_351;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_352;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_353;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_354;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_355;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_356;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_357;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_358;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_359;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_360;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_361;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_362;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_363;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_364;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_365;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_366;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_367;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_368;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_369;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_370;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_371;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_372;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_373;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_374;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_375;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_376;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_377;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, fvar<fvar<var> >, empty, empty> type_ffv_378;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_379;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_380;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_381;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_382;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_383;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_384;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_385;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_386;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, double, empty, empty> type_ffv_387;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_388;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_389;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_390;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_391;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_392;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_393;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_394;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_395;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_396;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_397;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_398;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_399;
+
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_300> AgradCcdfLogSkewDoubleExponential_ffv_300;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_301> AgradCcdfLogSkewDoubleExponential_ffv_301;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_302> AgradCcdfLogSkewDoubleExponential_ffv_302;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_303> AgradCcdfLogSkewDoubleExponential_ffv_303;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_304> AgradCcdfLogSkewDoubleExponential_ffv_304;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_305> AgradCcdfLogSkewDoubleExponential_ffv_305;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_306> AgradCcdfLogSkewDoubleExponential_ffv_306;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_307> AgradCcdfLogSkewDoubleExponential_ffv_307;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_308> AgradCcdfLogSkewDoubleExponential_ffv_308;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_309> AgradCcdfLogSkewDoubleExponential_ffv_309;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_310> AgradCcdfLogSkewDoubleExponential_ffv_310;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_311> AgradCcdfLogSkewDoubleExponential_ffv_311;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_312> AgradCcdfLogSkewDoubleExponential_ffv_312;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_313> AgradCcdfLogSkewDoubleExponential_ffv_313;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_314> AgradCcdfLogSkewDoubleExponential_ffv_314;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_315> AgradCcdfLogSkewDoubleExponential_ffv_315;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_316> AgradCcdfLogSkewDoubleExponential_ffv_316;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_317> AgradCcdfLogSkewDoubleExponential_ffv_317;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_318> AgradCcdfLogSkewDoubleExponential_ffv_318;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_319> AgradCcdfLogSkewDoubleExponential_ffv_319;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_320> AgradCcdfLogSkewDoubleExponential_ffv_320;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_321> AgradCcdfLogSkewDoubleExponential_ffv_321;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_322> AgradCcdfLogSkewDoubleExponential_ffv_322;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_323> AgradCcdfLogSkewDoubleExponential_ffv_323;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_324> AgradCcdfLogSkewDoubleExponential_ffv_324;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_325> AgradCcdfLogSkewDoubleExponential_ffv_325;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_326> AgradCcdfLogSkewDoubleExponential_ffv_326;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_327> AgradCcdfLogSkewDoubleExponential_ffv_327;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_328> AgradCcdfLogSkewDoubleExponential_ffv_328;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_329> AgradCcdfLogSkewDoubleExponential_ffv_329;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_330> AgradCcdfLogSkewDoubleExponential_ffv_330;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_331> AgradCcdfLogSkewDoubleExponential_ffv_331;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_332> AgradCcdfLogSkewDoubleExponential_ffv_332;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_333> AgradCcdfLogSkewDoubleExponential_ffv_333;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_334> AgradCcdfLogSkewDoubleExponential_ffv_334;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_335> AgradCcdfLogSkewDoubleExponential_ffv_335;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_336> AgradCcdfLogSkewDoubleExponential_ffv_336;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_337> AgradCcdfLogSkewDoubleExponential_ffv_337;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_338> AgradCcdfLogSkewDoubleExponential_ffv_338;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_339> AgradCcdfLogSkewDoubleExponential_ffv_339;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_340> AgradCcdfLogSkewDoubleExponential_ffv_340;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_341> AgradCcdfLogSkewDoubleExponential_ffv_341;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_342> AgradCcdfLogSkewDoubleExponential_ffv_342;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_343> AgradCcdfLogSkewDoubleExponential_ffv_343;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_344> AgradCcdfLogSkewDoubleExponential_ffv_344;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_345> AgradCcdfLogSkewDoubleExponential_ffv_345;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_346> AgradCcdfLogSkewDoubleExponential_ffv_346;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_347> AgradCcdfLogSkewDoubleExponential_ffv_347;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_348> AgradCcdfLogSkewDoubleExponential_ffv_348;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_349> AgradCcdfLogSkewDoubleExponential_ffv_349;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_350> AgradCcdfLogSkewDoubleExponential_ffv_350;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_351> AgradCcdfLogSkewDoubleExponential_ffv_351;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_352> AgradCcdfLogSkewDoubleExponential_ffv_352;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_353> AgradCcdfLogSkewDoubleExponential_ffv_353;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_354> AgradCcdfLogSkewDoubleExponential_ffv_354;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_355> AgradCcdfLogSkewDoubleExponential_ffv_355;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_356> AgradCcdfLogSkewDoubleExponential_ffv_356;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_357> AgradCcdfLogSkewDoubleExponential_ffv_357;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_358> AgradCcdfLogSkewDoubleExponential_ffv_358;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_359> AgradCcdfLogSkewDoubleExponential_ffv_359;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_360> AgradCcdfLogSkewDoubleExponential_ffv_360;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_361> AgradCcdfLogSkewDoubleExponential_ffv_361;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_362> AgradCcdfLogSkewDoubleExponential_ffv_362;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_363> AgradCcdfLogSkewDoubleExponential_ffv_363;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_364> AgradCcdfLogSkewDoubleExponential_ffv_364;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_365> AgradCcdfLogSkewDoubleExponential_ffv_365;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_366> AgradCcdfLogSkewDoubleExponential_ffv_366;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_367> AgradCcdfLogSkewDoubleExponential_ffv_367;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_368> AgradCcdfLogSkewDoubleExponential_ffv_368;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_369> AgradCcdfLogSkewDoubleExponential_ffv_369;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_370> AgradCcdfLogSkewDoubleExponential_ffv_370;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_371> AgradCcdfLogSkewDoubleExponential_ffv_371;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_372> AgradCcdfLogSkewDoubleExponential_ffv_372;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_373> AgradCcdfLogSkewDoubleExponential_ffv_373;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_374> AgradCcdfLogSkewDoubleExponential_ffv_374;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_375> AgradCcdfLogSkewDoubleExponential_ffv_375;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_376> AgradCcdfLogSkewDoubleExponential_ffv_376;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_377> AgradCcdfLogSkewDoubleExponential_ffv_377;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_378> AgradCcdfLogSkewDoubleExponential_ffv_378;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_379> AgradCcdfLogSkewDoubleExponential_ffv_379;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_380> AgradCcdfLogSkewDoubleExponential_ffv_380;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_381> AgradCcdfLogSkewDoubleExponential_ffv_381;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_382> AgradCcdfLogSkewDoubleExponential_ffv_382;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_383> AgradCcdfLogSkewDoubleExponential_ffv_383;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_384> AgradCcdfLogSkewDoubleExponential_ffv_384;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_385> AgradCcdfLogSkewDoubleExponential_ffv_385;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_386> AgradCcdfLogSkewDoubleExponential_ffv_386;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_387> AgradCcdfLogSkewDoubleExponential_ffv_387;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_388> AgradCcdfLogSkewDoubleExponential_ffv_388;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_389> AgradCcdfLogSkewDoubleExponential_ffv_389;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_390> AgradCcdfLogSkewDoubleExponential_ffv_390;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_391> AgradCcdfLogSkewDoubleExponential_ffv_391;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_392> AgradCcdfLogSkewDoubleExponential_ffv_392;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_393> AgradCcdfLogSkewDoubleExponential_ffv_393;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_394> AgradCcdfLogSkewDoubleExponential_ffv_394;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_395> AgradCcdfLogSkewDoubleExponential_ffv_395;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_396> AgradCcdfLogSkewDoubleExponential_ffv_396;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_397> AgradCcdfLogSkewDoubleExponential_ffv_397;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_398> AgradCcdfLogSkewDoubleExponential_ffv_398;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_399> AgradCcdfLogSkewDoubleExponential_ffv_399;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_300, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_300);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_301, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_301);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_302, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_302);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_303, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_303);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_304, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_304);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_305, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_305);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_306, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_306);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_307, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_307);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_308, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_308);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_309, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_309);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_310, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_310);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_311, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_311);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_312, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_312);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_313, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_313);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_314, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_314);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_315, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_315);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_316, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_316);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_317, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_317);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_318, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_318);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_319, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_319);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_320, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_320);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_321, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_321);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_322, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_322);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_323, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_323);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_324, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_324);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_325, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_325);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_326, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_326);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_327, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_327);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_328, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_328);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_329, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_329);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_330, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_330);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_331, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_331);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_332, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_332);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_333, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_333);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_334, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_334);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_335, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_335);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_336, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_336);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_337, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_337);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_338, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_338);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_339, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_339);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_340, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_340);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_341, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_341);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_342, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_342);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_343, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_343);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_344, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_344);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_345, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_345);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_346, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_346);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_347, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_347);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_348, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_348);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_349, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_349);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_350, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_350);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_351, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_351);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_352, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_352);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_353, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_353);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_354, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_354);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_355, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_355);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_356, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_356);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_357, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_357);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_358, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_358);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_359, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_359);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_360, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_360);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_361, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_361);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_362, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_362);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_363, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_363);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_364, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_364);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_365, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_365);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_366, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_366);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_367, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_367);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_368, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_368);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_369, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_369);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_370, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_370);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_371, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_371);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_372, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_372);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_373, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_373);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_374, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_374);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_375, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_375);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_376, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_376);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_377, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_377);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_378, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_378);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_379, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_379);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_380, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_380);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_381, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_381);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_382, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_382);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_383, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_383);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_384, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_384);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_385, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_385);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_386, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_386);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_387, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_387);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_388, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_388);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_389, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_389);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_390, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_390);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_391, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_391);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_392, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_392);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_393, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_393);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_394, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_394);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_395, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_395);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_396, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_396);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_397, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_397);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_398, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_398);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_399, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_399);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/skew_double_exponential/skew_double_exponential_ccdf_log_test.hpp>
+
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_300;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_301;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_302;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_303;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_304;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_305;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_306;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_307;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_308;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_309;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_310;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_311;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_312;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_313;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_314;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_315;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_316;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_317;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_318;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_319;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_320;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_321;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_322;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_323;
+typedef std::tuple<std::vector<double>, var, double, double, empty, empty> type_v_324;
+typedef std::tuple<std::vector<double>, var, double, std::vector<double>, empty, empty> type_v_325;
+typedef std::tuple<std::vector<double>, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_326;
+typedef std::tuple<std::vector<double>, var, double, var, empty, empty> type_v_327;
+typedef std::tuple<std::vector<double>, var, double, std::vector<var>, empty, empty> type_v_328;
+typedef std::tuple<std::vector<double>, var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_329;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, double, empty, empty> type_v_330;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, std::vector<double>, empty, empty> type_v_331;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_332;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, var, empty, empty> type_v_333;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, std::vector<var>, empty, empty> type_v_334;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_335;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_336;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_337;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_338;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_339;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_340;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_341;
+typedef std::tuple<std::vector<double>, var, var, double, empty, empty> type_v_342;
+typedef std::tuple<std::vector<double>, var, var, std::vector<double>, empty, empty> type_v_343;
+typedef std::tuple<std::vector<double>, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_344;
+typedef std::tuple<std::vector<double>, var, var, var, empty, empty> type_v_345;
+typedef std::tuple<std::vector<double>, var, var, std::vector<var>, empty, empty> type_v_346;
+typedef std::tuple<std::vector<double>, var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_347;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, double, empty, empty> type_v_348;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, std::vector<double>, empty, empty> type_v_349;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_350;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, var, empty, empty> type_v_351;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, std::vector<var>, empty, empty> type_v_352;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_353;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_354;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_355;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_356;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_357;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_358;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_359;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, double, empty, empty> type_v_360;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, std::vector<double>, empty, empty> type_v_361;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_362;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, var, empty, empty> type_v_363;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, std::vector<var>, empty, empty> type_v_364;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_365;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, double, empty, empty> type_v_366;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_v_367;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_368;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, var, empty, empty> type_v_369;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_v_370;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_371;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_372;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_373;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_374;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_375;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_376;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_377;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, double, empty, empty> type_v_378;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, std::vector<double>, empty, empty> type_v_379;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_380;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, var, empty, empty> type_v_381;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, std::vector<var>, empty, empty> type_v_382;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_383;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, double, empty, empty> type_v_384;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_v_385;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_386;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, var, empty, empty> type_v_387;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_v_388;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_389;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_390;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_391;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_392;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_393;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_394;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_395;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_396;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_397;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_398;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_399;
+
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_300> AgradCcdfLogSkewDoubleExponential_v_300;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_301> AgradCcdfLogSkewDoubleExponential_v_301;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_302> AgradCcdfLogSkewDoubleExponential_v_302;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_303> AgradCcdfLogSkewDoubleExponential_v_303;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_304> AgradCcdfLogSkewDoubleExponential_v_304;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_305> AgradCcdfLogSkewDoubleExponential_v_305;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_306> AgradCcdfLogSkewDoubleExponential_v_306;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_307> AgradCcdfLogSkewDoubleExponential_v_307;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_308> AgradCcdfLogSkewDoubleExponential_v_308;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_309> AgradCcdfLogSkewDoubleExponential_v_309;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_310> AgradCcdfLogSkewDoubleExponential_v_310;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_311> AgradCcdfLogSkewDoubleExponential_v_311;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_312> AgradCcdfLogSkewDoubleExponential_v_312;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_313> AgradCcdfLogSkewDoubleExponential_v_313;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_314> AgradCcdfLogSkewDoubleExponential_v_314;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_315> AgradCcdfLogSkewDoubleExponential_v_315;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_316> AgradCcdfLogSkewDoubleExponential_v_316;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_317> AgradCcdfLogSkewDoubleExponential_v_317;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_318> AgradCcdfLogSkewDoubleExponential_v_318;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_319> AgradCcdfLogSkewDoubleExponential_v_319;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_320> AgradCcdfLogSkewDoubleExponential_v_320;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_321> AgradCcdfLogSkewDoubleExponential_v_321;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_322> AgradCcdfLogSkewDoubleExponential_v_322;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_323> AgradCcdfLogSkewDoubleExponential_v_323;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_324> AgradCcdfLogSkewDoubleExponential_v_324;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_325> AgradCcdfLogSkewDoubleExponential_v_325;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_326> AgradCcdfLogSkewDoubleExponential_v_326;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_327> AgradCcdfLogSkewDoubleExponential_v_327;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_328> AgradCcdfLogSkewDoubleExponential_v_328;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_329> AgradCcdfLogSkewDoubleExponential_v_329;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_330> AgradCcdfLogSkewDoubleExponential_v_330;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_331> AgradCcdfLogSkewDoubleExponential_v_331;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_332> AgradCcdfLogSkewDoubleExponential_v_332;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_333> AgradCcdfLogSkewDoubleExponential_v_333;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_334> AgradCcdfLogSkewDoubleExponential_v_334;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_335> AgradCcdfLogSkewDoubleExponential_v_335;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_336> AgradCcdfLogSkewDoubleExponential_v_336;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_337> AgradCcdfLogSkewDoubleExponential_v_337;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_338> AgradCcdfLogSkewDoubleExponential_v_338;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_339> AgradCcdfLogSkewDoubleExponential_v_339;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_340> AgradCcdfLogSkewDoubleExponential_v_340;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_341> AgradCcdfLogSkewDoubleExponential_v_341;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_342> AgradCcdfLogSkewDoubleExponential_v_342;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_343> AgradCcdfLogSkewDoubleExponential_v_343;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_344> AgradCcdfLogSkewDoubleExponential_v_344;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_345> AgradCcdfLogSkewDoubleExponential_v_345;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_346> AgradCcdfLogSkewDoubleExponential_v_346;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_347> AgradCcdfLogSkewDoubleExponential_v_347;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_348> AgradCcdfLogSkewDoubleExponential_v_348;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_349> AgradCcdfLogSkewDoubleExponential_v_349;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_350> AgradCcdfLogSkewDoubleExponential_v_350;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_351> AgradCcdfLogSkewDoubleExponential_v_351;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_352> AgradCcdfLogSkewDoubleExponential_v_352;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_353> AgradCcdfLogSkewDoubleExponential_v_353;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_354> AgradCcdfLogSkewDoubleExponential_v_354;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_355> AgradCcdfLogSkewDoubleExponential_v_355;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_356> AgradCcdfLogSkewDoubleExponential_v_356;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_357> AgradCcdfLogSkewDoubleExponential_v_357;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_358> AgradCcdfLogSkewDoubleExponential_v_358;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_359> AgradCcdfLogSkewDoubleExponential_v_359;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_360> AgradCcdfLogSkewDoubleExponential_v_360;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_361> AgradCcdfLogSkewDoubleExponential_v_361;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_362> AgradCcdfLogSkewDoubleExponential_v_362;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_363> AgradCcdfLogSkewDoubleExponential_v_363;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_364> AgradCcdfLogSkewDoubleExponential_v_364;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_365> AgradCcdfLogSkewDoubleExponential_v_365;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_366> AgradCcdfLogSkewDoubleExponential_v_366;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_367> AgradCcdfLogSkewDoubleExponential_v_367;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_368> AgradCcdfLogSkewDoubleExponential_v_368;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_369> AgradCcdfLogSkewDoubleExponential_v_369;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_370> AgradCcdfLogSkewDoubleExponential_v_370;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_371> AgradCcdfLogSkewDoubleExponential_v_371;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_372> AgradCcdfLogSkewDoubleExponential_v_372;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_373> AgradCcdfLogSkewDoubleExponential_v_373;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_374> AgradCcdfLogSkewDoubleExponential_v_374;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_375> AgradCcdfLogSkewDoubleExponential_v_375;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_376> AgradCcdfLogSkewDoubleExponential_v_376;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_377> AgradCcdfLogSkewDoubleExponential_v_377;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_378> AgradCcdfLogSkewDoubleExponential_v_378;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_379> AgradCcdfLogSkewDoubleExponential_v_379;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_380> AgradCcdfLogSkewDoubleExponential_v_380;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_381> AgradCcdfLogSkewDoubleExponential_v_381;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_382> AgradCcdfLogSkewDoubleExponential_v_382;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_383> AgradCcdfLogSkewDoubleExponential_v_383;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_384> AgradCcdfLogSkewDoubleExponential_v_384;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_385> AgradCcdfLogSkewDoubleExponential_v_385;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_386> AgradCcdfLogSkewDoubleExponential_v_386;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_387> AgradCcdfLogSkewDoubleExponential_v_387;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_388> AgradCcdfLogSkewDoubleExponential_v_388;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_389> AgradCcdfLogSkewDoubleExponential_v_389;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_390> AgradCcdfLogSkewDoubleExponential_v_390;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_391> AgradCcdfLogSkewDoubleExponential_v_391;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_392> AgradCcdfLogSkewDoubleExponential_v_392;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_393> AgradCcdfLogSkewDoubleExponential_v_393;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_394> AgradCcdfLogSkewDoubleExponential_v_394;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_395> AgradCcdfLogSkewDoubleExponential_v_395;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_396> AgradCcdfLogSkewDoubleExponential_v_396;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_397> AgradCcdfLogSkewDoubleExponential_v_397;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_398> AgradCcdfLogSkewDoubleExponential_v_398;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_399> AgradCcdfLogSkewDoubleExponential_v_399;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_300, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_300);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_301, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_301);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_302, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_302);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_303, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_303);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_304, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_304);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_305, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_305);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_306, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_306);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_307, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_307);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_308, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_308);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_309, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_309);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_310, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_310);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_311, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_311);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_312, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_312);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_313, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_313);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_314, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_314);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_315, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_315);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_316, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_316);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_317, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_317);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_318, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_318);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_319, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_319);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_320, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_320);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_321, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_321);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_322, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_322);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_323, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_323);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_324, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_324);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_325, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_325);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_326, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_326);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_327, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_327);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_328, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_328);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_329, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_329);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_330, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_330);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_331, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_331);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_332, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_332);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_333, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_333);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_334, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_334);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_335, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_335);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_336, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_336);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_337, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_337);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_338, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_338);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_339, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_339);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_340, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_340);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_341, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_341);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_342, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_342);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_343, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_343);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_344, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_344);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_345, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_345);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_346, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_346);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_347, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_347);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_348, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_348);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_349, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_349);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_350, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_350);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_351, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_351);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_352, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_352);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_353, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_353);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_354, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_354);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_355, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_355);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_356, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_356);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_357, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_357);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_358, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_358);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_359, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_359);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_360, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_360);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_361, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_361);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_362, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_362);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_363, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_363);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_364, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_364);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_365, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_365);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_366, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_366);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_367, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_367);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_368, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_368);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_369, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_369);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_370, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_370);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_371, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_371);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_372, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_372);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_373, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_373);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_374, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_374);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_375, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_375);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_376, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_376);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_377, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_377);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_378, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_378);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_379, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_379);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_380, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_380);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_381, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_381);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_382, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_382);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_383, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_383);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_384, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_384);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_385, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_385);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_386, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_386);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_387, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_387);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_388, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_388);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_389, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_389);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_390, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_390);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_391, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_391);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_392, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_392);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_393, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_393);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_394, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_394);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_395, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_395);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_396, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_396);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_397, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_397);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_398, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_398);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_399, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_399);
+
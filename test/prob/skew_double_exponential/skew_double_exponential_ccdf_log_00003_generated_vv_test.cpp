@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/skew_double_exponential/skew_double_exponential_ccdf_log_test.hpp>
+
+typedef std::tuple<std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_300;
+typedef std::tuple<std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_301;
+typedef std::tuple<std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_302;
+typedef std::tuple<std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_303;
+typedef std::tuple<std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_304;
+typedef std::tuple<std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_305;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, double, empty, empty> type_vv_306;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, std::vector<double>, empty, empty> type_vv_307;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_308;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, var, empty, empty> type_vv_309;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, std::vector<var>, empty, empty> type_vv_310;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_311;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, double, empty, empty> type_vv_312;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_vv_313;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_314;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, var, empty, empty> type_vv_315;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_vv_316;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_317;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_318;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_319;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_320;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_321;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_322;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_323;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, double, empty, empty> type_vv_324;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, std::vector<double>, empty, empty> type_vv_325;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_326;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, var, empty, empty> type_vv_327;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, std::vector<var>, empty, empty> type_vv_328;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_329;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, double, empty, empty> type_vv_330;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_vv_331;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_332;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, var, empty, empty> type_vv_333;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_vv_334;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_335;
+typedef std::tuple<std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_336;
+typedef std::tuple<std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_337;
+typedef std::tuple<std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_338;
+typedef std::tuple<std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_339;
+typedef std::tuple<std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_340;
+typedef std::tuple<std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_341;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, empty, empty> type_vv_342;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, empty, empty> type_vv_343;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_344;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, empty, empty> type_vv_345;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, empty, empty> type_vv_346;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_347;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, empty, empty> type_vv_348;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, empty, empty> type_vv_349;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_350;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, empty, empty> type_vv_351;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, empty, empty> type_vv_352;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_353;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_354;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_355;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_356;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_357;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_358;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_359;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, empty, empty> type_vv_360;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, empty, empty> type_vv_361;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_362;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, empty, empty> type_vv_363;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, empty, empty> type_vv_364;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_365;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, empty, empty> type_vv_366;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, empty, empty> type_vv_367;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_368;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, empty, empty> type_vv_369;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, empty, empty> type_vv_370;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_371;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_372;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_373;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_374;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_375;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_376;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_377;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, var, empty, empty> type_vv_378;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, std::vector<var>, empty, empty> type_vv_379;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_380;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, var, empty, empty> type_vv_381;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, std::vector<var>, empty, empty> type_vv_382;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_383;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_384;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_385;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_386;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, double, empty, empty> type_vv_387;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, std::vector<double>, empty, empty> type_vv_388;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_389;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, var, empty, empty> type_vv_390;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, std::vector<var>, empty, empty> type_vv_391;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_392;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, double, empty, empty> type_vv_393;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, std::vector<double>, empty, empty> type_vv_394;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_395;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, var, empty, empty> type_vv_396;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, std::vector<var>, empty, empty> type_vv_397;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_398;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_399;
+
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_300> AgradCcdfLogSkewDoubleExponential_vv_300;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_301> AgradCcdfLogSkewDoubleExponential_vv_301;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_302> AgradCcdfLogSkewDoubleExponential_vv_302;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_303> AgradCcdfLogSkewDoubleExponential_vv_303;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_304> AgradCcdfLogSkewDoubleExponential_vv_304;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_305> AgradCcdfLogSkewDoubleExponential_vv_305;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_306> AgradCcdfLogSkewDoubleExponential_vv_306;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_307> AgradCcdfLogSkewDoubleExponential_vv_307;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_308> AgradCcdfLogSkewDoubleExponential_vv_308;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_309> AgradCcdfLogSkewDoubleExponential_vv_309;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_310> AgradCcdfLogSkewDoubleExponential_vv_310;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_311> AgradCcdfLogSkewDoubleExponential_vv_311;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_312> AgradCcdfLogSkewDoubleExponential_vv_312;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_313> AgradCcdfLogSkewDoubleExponential_vv_313;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_314> AgradCcdfLogSkewDoubleExponential_vv_314;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_315> AgradCcdfLogSkewDoubleExponential_vv_315;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_316> AgradCcdfLogSkewDoubleExponential_vv_316;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_317> AgradCcdfLogSkewDoubleExponential_vv_317;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_318> AgradCcdfLogSkewDoubleExponential_vv_318;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_319> AgradCcdfLogSkewDoubleExponential_vv_319;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_320> AgradCcdfLogSkewDoubleExponential_vv_320;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_321> AgradCcdfLogSkewDoubleExponential_vv_321;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_322> AgradCcdfLogSkewDoubleExponential_vv_322;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_323> AgradCcdfLogSkewDoubleExponential_vv_323;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_324> AgradCcdfLogSkewDoubleExponential_vv_324;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_325> AgradCcdfLogSkewDoubleExponential_vv_325;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_326> AgradCcdfLogSkewDoubleExponential_vv_326;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_327> AgradCcdfLogSkewDoubleExponential_vv_327;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_328> AgradCcdfLogSkewDoubleExponential_vv_328;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_329> AgradCcdfLogSkewDoubleExponential_vv_329;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_330> AgradCcdfLogSkewDoubleExponential_vv_330;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_331> AgradCcdfLogSkewDoubleExponential_vv_331;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_332> AgradCcdfLogSkewDoubleExponential_vv_332;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_333> AgradCcdfLogSkewDoubleExponential_vv_333;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_334> AgradCcdfLogSkewDoubleExponential_vv_334;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_335> AgradCcdfLogSkewDoubleExponential_vv_335;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_336> AgradCcdfLogSkewDoubleExponential_vv_336;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_337> AgradCcdfLogSkewDoubleExponential_vv_337;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_338> AgradCcdfLogSkewDoubleExponential_vv_338;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_339> AgradCcdfLogSkewDoubleExponential_vv_339;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_340> AgradCcdfLogSkewDoubleExponential_vv_340;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_341> AgradCcdfLogSkewDoubleExponential_vv_341;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_342> AgradCcdfLogSkewDoubleExponential_vv_342;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_343> AgradCcdfLogSkewDoubleExponential_vv_343;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_344> AgradCcdfLogSkewDoubleExponential_vv_344;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_345> AgradCcdfLogSkewDoubleExponential_vv_345;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_346> AgradCcdfLogSkewDoubleExponential_vv_346;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_347> AgradCcdfLogSkewDoubleExponential_vv_347;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_348> AgradCcdfLogSkewDoubleExponential_vv_348;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_349> AgradCcdfLogSkewDoubleExponential_vv_349;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_350> AgradCcdfLogSkewDoubleExponential_vv_350;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_351> AgradCcdfLogSkewDoubleExponential_vv_351;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_352> AgradCcdfLogSkewDoubleExponential_vv_352;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_353> AgradCcdfLogSkewDoubleExponential_vv_353;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_354> AgradCcdfLogSkewDoubleExponential_vv_354;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_355> AgradCcdfLogSkewDoubleExponential_vv_355;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_356> AgradCcdfLogSkewDoubleExponential_vv_356;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_357> AgradCcdfLogSkewDoubleExponential_vv_357;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_358> AgradCcdfLogSkewDoubleExponential_vv_358;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_359> AgradCcdfLogSkewDoubleExponential_vv_359;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_360> AgradCcdfLogSkewDoubleExponential_vv_360;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_361> AgradCcdfLogSkewDoubleExponential_vv_361;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_362> AgradCcdfLogSkewDoubleExponential_vv_362;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_363> AgradCcdfLogSkewDoubleExponential_vv_363;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_364> AgradCcdfLogSkewDoubleExponential_vv_364;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_365> AgradCcdfLogSkewDoubleExponential_vv_365;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_366> AgradCcdfLogSkewDoubleExponential_vv_366;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_367> AgradCcdfLogSkewDoubleExponential_vv_367;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_368> AgradCcdfLogSkewDoubleExponential_vv_368;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_369> AgradCcdfLogSkewDoubleExponential_vv_369;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_370> AgradCcdfLogSkewDoubleExponential_vv_370;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_371> AgradCcdfLogSkewDoubleExponential_vv_371;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_372> AgradCcdfLogSkewDoubleExponential_vv_372;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_373> AgradCcdfLogSkewDoubleExponential_vv_373;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_374> AgradCcdfLogSkewDoubleExponential_vv_374;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_375> AgradCcdfLogSkewDoubleExponential_vv_375;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_376> AgradCcdfLogSkewDoubleExponential_vv_376;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_377> AgradCcdfLogSkewDoubleExponential_vv_377;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_378> AgradCcdfLogSkewDoubleExponential_vv_378;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_379> AgradCcdfLogSkewDoubleExponential_vv_379;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_380> AgradCcdfLogSkewDoubleExponential_vv_380;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_381> AgradCcdfLogSkewDoubleExponential_vv_381;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_382> AgradCcdfLogSkewDoubleExponential_vv_382;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_383> AgradCcdfLogSkewDoubleExponential_vv_383;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_384> AgradCcdfLogSkewDoubleExponential_vv_384;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_385> AgradCcdfLogSkewDoubleExponential_vv_385;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_386> AgradCcdfLogSkewDoubleExponential_vv_386;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_387> AgradCcdfLogSkewDoubleExponential_vv_387;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_388> AgradCcdfLogSkewDoubleExponential_vv_388;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_389> AgradCcdfLogSkewDoubleExponential_vv_389;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_390> AgradCcdfLogSkewDoubleExponential_vv_390;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_391> AgradCcdfLogSkewDoubleExponential_vv_391;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_392> AgradCcdfLogSkewDoubleExponential_vv_392;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_393> AgradCcdfLogSkewDoubleExponential_vv_393;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_394> AgradCcdfLogSkewDoubleExponential_vv_394;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_395> AgradCcdfLogSkewDoubleExponential_vv_395;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_396> AgradCcdfLogSkewDoubleExponential_vv_396;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_397> AgradCcdfLogSkewDoubleExponential_vv_397;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_398> AgradCcdfLogSkewDoubleExponential_vv_398;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_399> AgradCcdfLogSkewDoubleExponential_vv_399;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_300, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_300);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_301, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_301);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_302, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_302);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_303, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_303);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_304, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_304);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_305, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_305);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_306, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_306);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_307, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_307);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_308, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_308);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_309, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_309);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_310, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_310);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_311, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_311);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_312, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_312);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_313, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_313);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_314, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_314);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_315, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_315);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_316, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_316);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_317, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_317);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_318, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_318);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_319, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_319);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_320, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_320);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_321, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_321);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_322, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_322);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_323, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_323);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_324, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_324);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_325, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_325);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_326, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_326);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_327, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_327);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_328, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_328);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_329, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_329);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_330, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_330);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_331, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_331);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_332, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_332);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_333, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_333);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_334, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_334);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_335, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_335);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_336, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_336);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_337, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_337);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_338, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_338);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_339, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_339);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_340, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_340);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_341, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_341);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_342, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_342);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_343, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_343);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_344, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_344);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_345, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_345);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_346, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_346);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_347, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_347);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_348, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_348);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_349, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_349);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_350, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_350);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_351, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_351);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_352, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_352);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_353, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_353);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_354, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_354);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_355, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_355);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_356, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_356);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_357, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_357);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_358, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_358);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_359, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_359);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_360, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_360);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_361, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_361);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_362, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_362);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_363, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_363);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_364, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_364);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_365, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_365);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_366, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_366);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_367, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_367);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_368, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_368);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_369, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_369);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_370, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_370);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_371, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_371);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_372, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_372);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_373, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_373);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_374, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_374);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_375, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_375);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_376, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_376);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_377, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_377);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_378, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_378);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_379, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_379);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_380, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_380);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_381, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_381);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_382, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_382);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_383, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_383);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_384, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_384);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_385, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_385);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_386, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_386);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_387, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_387);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_388, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_388);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_389, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_389);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_390, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_390);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_391, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_391);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_392, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_392);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_393, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_393);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_394, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_394);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_395, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_395);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_396, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_396);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_397, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_397);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_398, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_398);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_399, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_399);
+
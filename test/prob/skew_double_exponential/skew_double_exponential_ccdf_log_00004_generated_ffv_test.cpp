@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/skew_double_exponential/skew_double_exponential_ccdf_log_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_400;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_401;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_402;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_403;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_404;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, fvar<fvar<var> >, empty, empty> type_ffv_405;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_406;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_407;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_408;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_409;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_410;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_411;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_412;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_413;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, double, empty, empty> type_ffv_414;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_415;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_416;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_417;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_418;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_419;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_420;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_421;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_422;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_423;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_424;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_425;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_426;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_427;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_428;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_429;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_430;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_431;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_432;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_433;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_434;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_435;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_436;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_437;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_438;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_439;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_440;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_441;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_442;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_443;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_444;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_445;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_446;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_447;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_448;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_449;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_450;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_451;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_452;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_453;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_454;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_455;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_456;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_457;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_458;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, double, empty, empty> type_ffv_459;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, std::vector<double>, empty, empty> type_ffv_460;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_461;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, fvar<fvar<var> >, empty, empty> type_ffv_462;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_463;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_464;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, double, empty, empty> type_ffv_465;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty, empty> type_ffv_466;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_467;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_468;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_469;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_470;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_471;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_472;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_473;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_474;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_475;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_476;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, double, empty, empty> type_ffv_477;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_478;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_479;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_480;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_481;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_482;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_483;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_484;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_485;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_486;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_487;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_488;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_489;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_490;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_491;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_492;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_493;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_494;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, double, empty, empty> type_ffv_495;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty, empty> type_ffv_496;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_497;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty, empty> type_ffv_498;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_499;
+
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_400> AgradCcdfLogSkewDoubleExponential_ffv_400;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_401> AgradCcdfLogSkewDoubleExponential_ffv_401;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_402> AgradCcdfLogSkewDoubleExponential_ffv_402;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_403> AgradCcdfLogSkewDoubleExponential_ffv_403;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_404> AgradCcdfLogSkewDoubleExponential_ffv_404;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_405> AgradCcdfLogSkewDoubleExponential_ffv_405;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_406> AgradCcdfLogSkewDoubleExponential_ffv_406;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_407> AgradCcdfLogSkewDoubleExponential_ffv_407;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_408> AgradCcdfLogSkewDoubleExponential_ffv_408;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_409> AgradCcdfLogSkewDoubleExponential_ffv_409;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_410> AgradCcdfLogSkewDoubleExponential_ffv_410;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_411> AgradCcdfLogSkewDoubleExponential_ffv_411;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_412> AgradCcdfLogSkewDoubleExponential_ffv_412;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_413> AgradCcdfLogSkewDoubleExponential_ffv_413;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_414> AgradCcdfLogSkewDoubleExponential_ffv_414;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_415> AgradCcdfLogSkewDoubleExponential_ffv_415;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_416> AgradCcdfLogSkewDoubleExponential_ffv_416;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_417> AgradCcdfLogSkewDoubleExponential_ffv_417;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_418> AgradCcdfLogSkewDoubleExponential_ffv_418;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_419> AgradCcdfLogSkewDoubleExponential_ffv_419;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_420> AgradCcdfLogSkewDoubleExponential_ffv_420;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_421> AgradCcdfLogSkewDoubleExponential_ffv_421;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_422> AgradCcdfLogSkewDoubleExponential_ffv_422;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_423> AgradCcdfLogSkewDoubleExponential_ffv_423;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_424> AgradCcdfLogSkewDoubleExponential_ffv_424;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_425> AgradCcdfLogSkewDoubleExponential_ffv_425;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_426> AgradCcdfLogSkewDoubleExponential_ffv_426;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_427> AgradCcdfLogSkewDoubleExponential_ffv_427;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_428> AgradCcdfLogSkewDoubleExponential_ffv_428;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_429> AgradCcdfLogSkewDoubleExponential_ffv_429;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_430> AgradCcdfLogSkewDoubleExponential_ffv_430;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_431> AgradCcdfLogSkewDoubleExponential_ffv_431;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_432> AgradCcdfLogSkewDoubleExponential_ffv_432;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_433> AgradCcdfLogSkewDoubleExponential_ffv_433;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_434> AgradCcdfLogSkewDoubleExponential_ffv_434;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_435> AgradCcdfLogSkewDoubleExponential_ffv_435;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_436> AgradCcdfLogSkewDoubleExponential_ffv_436;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_437> AgradCcdfLogSkewDoubleExponential_ffv_437;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_438> AgradCcdfLogSkewDoubleExponential_ffv_438;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_439> AgradCcdfLogSkewDoubleExponential_ffv_439;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_440> AgradCcdfLogSkewDoubleExponential_ffv_440;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_441> AgradCcdfLogSkewDoubleExponential_ffv_441;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_442> AgradCcdfLogSkewDoubleExponential_ffv_442;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_443> AgradCcdfLogSkewDoubleExponential_ffv_443;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_444> AgradCcdfLogSkewDoubleExponential_ffv_444;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_445> AgradCcdfLogSkewDoubleExponential_ffv_445;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_446> AgradCcdfLogSkewDoubleExponential_ffv_446;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_447> AgradCcdfLogSkewDoubleExponential_ffv_447;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_448> AgradCcdfLogSkewDoubleExponential_ffv_448;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_449> AgradCcdfLogSkewDoubleExponential_ffv_449;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_450> AgradCcdfLogSkewDoubleExponential_ffv_450;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_451> AgradCcdfLogSkewDoubleExponential_ffv_451;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_452> AgradCcdfLogSkewDoubleExponential_ffv_452;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_453> AgradCcdfLogSkewDoubleExponential_ffv_453;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_454> AgradCcdfLogSkewDoubleExponential_ffv_454;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_455> AgradCcdfLogSkewDoubleExponential_ffv_455;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_456> AgradCcdfLogSkewDoubleExponential_ffv_456;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_457> AgradCcdfLogSkewDoubleExponential_ffv_457;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_458> AgradCcdfLogSkewDoubleExponential_ffv_458;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_459> AgradCcdfLogSkewDoubleExponential_ffv_459;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_460> AgradCcdfLogSkewDoubleExponential_ffv_460;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_461> AgradCcdfLogSkewDoubleExponential_ffv_461;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_462> AgradCcdfLogSkewDoubleExponential_ffv_462;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_463> AgradCcdfLogSkewDoubleExponential_ffv_463;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_464> AgradCcdfLogSkewDoubleExponential_ffv_464;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_465> AgradCcdfLogSkewDoubleExponential_ffv_465;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_466> AgradCcdfLogSkewDoubleExponential_ffv_466;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_467> AgradCcdfLogSkewDoubleExponential_ffv_467;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_468> AgradCcdfLogSkewDoubleExponential_ffv_468;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_469> AgradCcdfLogSkewDoubleExponential_ffv_469;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_470> AgradCcdfLogSkewDoubleExponential_ffv_470;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_471> AgradCcdfLogSkewDoubleExponential_ffv_471;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_472> AgradCcdfLogSkewDoubleExponential_ffv_472;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_473> AgradCcdfLogSkewDoubleExponential_ffv_473;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_474> AgradCcdfLogSkewDoubleExponential_ffv_474;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_475> AgradCcdfLogSkewDoubleExponential_ffv_475;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_476> AgradCcdfLogSkewDoubleExponential_ffv_476;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_477> AgradCcdfLogSkewDoubleExponential_ffv_477;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_478> AgradCcdfLogSkewDoubleExponential_ffv_478;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_479> AgradCcdfLogSkewDoubleExponential_ffv_479;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_480> AgradCcdfLogSkewDoubleExponential_ffv_480;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_481> AgradCcdfLogSkewDoubleExponential_ffv_481;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_482> AgradCcdfLogSkewDoubleExponential_ffv_482;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_483> AgradCcdfLogSkewDoubleExponential_ffv_483;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_484> AgradCcdfLogSkewDoubleExponential_ffv_484;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_485> AgradCcdfLogSkewDoubleExponential_ffv_485;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_486> AgradCcdfLogSkewDoubleExponential_ffv_486;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_487> AgradCcdfLogSkewDoubleExponential_ffv_487;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_488> AgradCcdfLogSkewDoubleExponential_ffv_488;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_489> AgradCcdfLogSkewDoubleExponential_ffv_489;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_490> AgradCcdfLogSkewDoubleExponential_ffv_490;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_491> AgradCcdfLogSkewDoubleExponential_ffv_491;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_492> AgradCcdfLogSkewDoubleExponential_ffv_492;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_493> AgradCcdfLogSkewDoubleExponential_ffv_493;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_494> AgradCcdfLogSkewDoubleExponential_ffv_494;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_495> AgradCcdfLogSkewDoubleExponential_ffv_495;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_496> AgradCcdfLogSkewDoubleExponential_ffv_496;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_497> AgradCcdfLogSkewDoubleExponential_ffv_497;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_498> AgradCcdfLogSkewDoubleExponential_ffv_498;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_499> AgradCcdfLogSkewDoubleExponential_ffv_499;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_400, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_400);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_401, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_401);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_402, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_402);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_403, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_403);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_404, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_404);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_405, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_405);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_406, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_406);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_407, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_407);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_408, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_408);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_409, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_409);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_410, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_410);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_411, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_411);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_412, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_412);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_413, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_413);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_414, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_414);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_415, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_415);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_416, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_416);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_417, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_417);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_418, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_418);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_419, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_419);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_420, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_420);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_421, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_421);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_422, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_422);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_423, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_423);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_424, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_424);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_425, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_425);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_426, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_426);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_427, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_427);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_428, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_428);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_429, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_429);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_430, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_430);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_431, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_431);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_432, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_432);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_433, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_433);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_434, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_434);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_435, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_435);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_436, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_436);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_437, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_437);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_438, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_438);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_439, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_439);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_440, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_440);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_441, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_441);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_442, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_442);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_443, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_443);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_444, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_444);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_445, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_445);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_446, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_446);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_447, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_447);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_448, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_448);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_449, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_449);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_450, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_450);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_451, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_451);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_452, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_452);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_453, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_453);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_454, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_454);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_455, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_455);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_456, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_456);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_457, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_457);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_458, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_458);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_459, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_459);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_460, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_460);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_461, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_461);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_462, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_462);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_463, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_463);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_464, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_464);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_465, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_465);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_466, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_466);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_467, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_467);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_468, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_468);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_469, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_469);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_470, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_470);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_471, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_471);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_472, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_472);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_473, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_473);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_474, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_474);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_475, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_475);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_476, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_476);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_477, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_477);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_478, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_478);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_479, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_479);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_480, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_480);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_481, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_481);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_482, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_482);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_483, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_483);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_484, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_484);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_485, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_485);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_486, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_486);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_487, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_487);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_488, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_488);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_489, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_489);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_490, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_490);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_491, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_491);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_492, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_492);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_493, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_493);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_494, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_494);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_495, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_495);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_496, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_496);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_497, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_497);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_498, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_498);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_499, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_499);
+
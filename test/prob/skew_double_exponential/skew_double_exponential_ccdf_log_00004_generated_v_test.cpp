@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/skew_double_exponential/skew_double_exponential_ccdf_log_test.hpp>
+
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_400;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_401;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_402;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_403;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_404;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_405;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_406;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_407;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_408;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_409;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_410;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_411;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_412;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_413;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_414;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_415;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_416;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_417;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_418;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_419;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_420;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_421;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_422;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_423;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_424;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_425;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_426;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_427;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_428;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_429;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_430;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_431;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, double, empty, empty> type_v_432;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, std::vector<double>, empty, empty> type_v_433;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_434;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, var, empty, empty> type_v_435;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, std::vector<var>, empty, empty> type_v_436;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_437;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, double, empty, empty> type_v_438;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, std::vector<double>, empty, empty> type_v_439;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_440;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, var, empty, empty> type_v_441;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, std::vector<var>, empty, empty> type_v_442;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_443;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_444;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_445;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_446;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_447;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_448;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_449;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, double, empty, empty> type_v_450;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, std::vector<double>, empty, empty> type_v_451;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_452;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, var, empty, empty> type_v_453;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, std::vector<var>, empty, empty> type_v_454;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_455;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, double, empty, empty> type_v_456;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, std::vector<double>, empty, empty> type_v_457;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_458;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, var, empty, empty> type_v_459;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, std::vector<var>, empty, empty> type_v_460;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_461;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_462;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_463;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_464;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_465;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_466;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_467;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, double, empty, empty> type_v_468;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, std::vector<double>, empty, empty> type_v_469;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_470;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, var, empty, empty> type_v_471;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, std::vector<var>, empty, empty> type_v_472;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_473;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, double, empty, empty> type_v_474;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, std::vector<double>, empty, empty> type_v_475;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_476;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, var, empty, empty> type_v_477;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_v_478;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_479;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_480;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_481;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_482;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_483;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_484;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_485;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, double, empty, empty> type_v_486;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, std::vector<double>, empty, empty> type_v_487;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_488;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, var, empty, empty> type_v_489;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, std::vector<var>, empty, empty> type_v_490;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_491;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, double, empty, empty> type_v_492;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_v_493;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_494;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, var, empty, empty> type_v_495;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_v_496;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_497;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_498;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_499;
+
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_400> AgradCcdfLogSkewDoubleExponential_v_400;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_401> AgradCcdfLogSkewDoubleExponential_v_401;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_402> AgradCcdfLogSkewDoubleExponential_v_402;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_403> AgradCcdfLogSkewDoubleExponential_v_403;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_404> AgradCcdfLogSkewDoubleExponential_v_404;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_405> AgradCcdfLogSkewDoubleExponential_v_405;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_406> AgradCcdfLogSkewDoubleExponential_v_406;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_407> AgradCcdfLogSkewDoubleExponential_v_407;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_408> AgradCcdfLogSkewDoubleExponential_v_408;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_409> AgradCcdfLogSkewDoubleExponential_v_409;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_410> AgradCcdfLogSkewDoubleExponential_v_410;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_411> AgradCcdfLogSkewDoubleExponential_v_411;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_412> AgradCcdfLogSkewDoubleExponential_v_412;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_413> AgradCcdfLogSkewDoubleExponential_v_413;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_414> AgradCcdfLogSkewDoubleExponential_v_414;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_415> AgradCcdfLogSkewDoubleExponential_v_415;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_416> AgradCcdfLogSkewDoubleExponential_v_416;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_417> AgradCcdfLogSkewDoubleExponential_v_417;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_418> AgradCcdfLogSkewDoubleExponential_v_418;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_419> AgradCcdfLogSkewDoubleExponential_v_419;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_420> AgradCcdfLogSkewDoubleExponential_v_420;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_421> AgradCcdfLogSkewDoubleExponential_v_421;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_422> AgradCcdfLogSkewDoubleExponential_v_422;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_423> AgradCcdfLogSkewDoubleExponential_v_423;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_424> AgradCcdfLogSkewDoubleExponential_v_424;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_425> AgradCcdfLogSkewDoubleExponential_v_425;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_426> AgradCcdfLogSkewDoubleExponential_v_426;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_427> AgradCcdfLogSkewDoubleExponential_v_427;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_428> AgradCcdfLogSkewDoubleExponential_v_428;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_429> AgradCcdfLogSkewDoubleExponential_v_429;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_430> AgradCcdfLogSkewDoubleExponential_v_430;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_431> AgradCcdfLogSkewDoubleExponential_v_431;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_432> AgradCcdfLogSkewDoubleExponential_v_432;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_433> AgradCcdfLogSkewDoubleExponential_v_433;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_434> AgradCcdfLogSkewDoubleExponential_v_434;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_435> AgradCcdfLogSkewDoubleExponential_v_435;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_436> AgradCcdfLogSkewDoubleExponential_v_436;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_437> AgradCcdfLogSkewDoubleExponential_v_437;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_438> AgradCcdfLogSkewDoubleExponential_v_438;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_439> AgradCcdfLogSkewDoubleExponential_v_439;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_440> AgradCcdfLogSkewDoubleExponential_v_440;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_441> AgradCcdfLogSkewDoubleExponential_v_441;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_442> AgradCcdfLogSkewDoubleExponential_v_442;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_443> AgradCcdfLogSkewDoubleExponential_v_443;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_444> AgradCcdfLogSkewDoubleExponential_v_444;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_445> AgradCcdfLogSkewDoubleExponential_v_445;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_446> AgradCcdfLogSkewDoubleExponential_v_446;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_447> AgradCcdfLogSkewDoubleExponential_v_447;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_448> AgradCcdfLogSkewDoubleExponential_v_448;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_449> AgradCcdfLogSkewDoubleExponential_v_449;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_450> AgradCcdfLogSkewDoubleExponential_v_450;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_451> AgradCcdfLogSkewDoubleExponential_v_451;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_452> AgradCcdfLogSkewDoubleExponential_v_452;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_453> AgradCcdfLogSkewDoubleExponential_v_453;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_454> AgradCcdfLogSkewDoubleExponential_v_454;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_455> AgradCcdfLogSkewDoubleExponential_v_455;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_456> AgradCcdfLogSkewDoubleExponential_v_456;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_457> AgradCcdfLogSkewDoubleExponential_v_457;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_458> AgradCcdfLogSkewDoubleExponential_v_458;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_459> AgradCcdfLogSkewDoubleExponential_v_459;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_460> AgradCcdfLogSkewDoubleExponential_v_460;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_461> AgradCcdfLogSkewDoubleExponential_v_461;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_462> AgradCcdfLogSkewDoubleExponential_v_462;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_463> AgradCcdfLogSkewDoubleExponential_v_463;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_464> AgradCcdfLogSkewDoubleExponential_v_464;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_465> AgradCcdfLogSkewDoubleExponential_v_465;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_466> AgradCcdfLogSkewDoubleExponential_v_466;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_467> AgradCcdfLogSkewDoubleExponential_v_467;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_468> AgradCcdfLogSkewDoubleExponential_v_468;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_469> AgradCcdfLogSkewDoubleExponential_v_469;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_470> AgradCcdfLogSkewDoubleExponential_v_470;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_471> AgradCcdfLogSkewDoubleExponential_v_471;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_472> AgradCcdfLogSkewDoubleExponential_v_472;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_473> AgradCcdfLogSkewDoubleExponential_v_473;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_474> AgradCcdfLogSkewDoubleExponential_v_474;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_475> AgradCcdfLogSkewDoubleExponential_v_475;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_476> AgradCcdfLogSkewDoubleExponential_v_476;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_477> AgradCcdfLogSkewDoubleExponential_v_477;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_478> AgradCcdfLogSkewDoubleExponential_v_478;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_479> AgradCcdfLogSkewDoubleExponential_v_479;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_480> AgradCcdfLogSkewDoubleExponential_v_480;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_481> AgradCcdfLogSkewDoubleExponential_v_481;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_482> AgradCcdfLogSkewDoubleExponential_v_482;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_483> AgradCcdfLogSkewDoubleExponential_v_483;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_484> AgradCcdfLogSkewDoubleExponential_v_484;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_485> AgradCcdfLogSkewDoubleExponential_v_485;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_486> AgradCcdfLogSkewDoubleExponential_v_486;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_487> AgradCcdfLogSkewDoubleExponential_v_487;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_488> AgradCcdfLogSkewDoubleExponential_v_488;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_489> AgradCcdfLogSkewDoubleExponential_v_489;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_490> AgradCcdfLogSkewDoubleExponential_v_490;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_491> AgradCcdfLogSkewDoubleExponential_v_491;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_492> AgradCcdfLogSkewDoubleExponential_v_492;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_493> AgradCcdfLogSkewDoubleExponential_v_493;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_494> AgradCcdfLogSkewDoubleExponential_v_494;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_495> AgradCcdfLogSkewDoubleExponential_v_495;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_496> AgradCcdfLogSkewDoubleExponential_v_496;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_497> AgradCcdfLogSkewDoubleExponential_v_497;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_498> AgradCcdfLogSkewDoubleExponential_v_498;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_499> AgradCcdfLogSkewDoubleExponential_v_499;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_400, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_400);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_401, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_401);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_402, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_402);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_403, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_403);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_404, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_404);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_405, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_405);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_406, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_406);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_407, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_407);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_408, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_408);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_409, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_409);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_410, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_410);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_411, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_411);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_412, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_412);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_413, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_413);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_414, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_414);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_415, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_415);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_416, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_416);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_417, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_417);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_418, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_418);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_419, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_419);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_420, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_420);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_421, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_421);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_422, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_422);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_423, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_423);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_424, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_424);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_425, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_425);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_426, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_426);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_427, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_427);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_428, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_428);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_429, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_429);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_430, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_430);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_431, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_431);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_432, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_432);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_433, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_433);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_434, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_434);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_435, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_435);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_436, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_436);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_437, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_437);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_438, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_438);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_439, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_439);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_440, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_440);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_441, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_441);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_442, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_442);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_443, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_443);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_444, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_444);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_445, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_445);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_446, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_446);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_447, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_447);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_448, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_448);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_449, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_449);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_450, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_450);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_451, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_451);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_452, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_452);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_453, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_453);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_454, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_454);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_455, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_455);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_456, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_456);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_457, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_457);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_458, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_458);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_459, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_459);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_460, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_460);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_461, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_461);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_462, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_462);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_463, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_463);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_464, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_464);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_465, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_465);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_466, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_466);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_467, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_467);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_468, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_468);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_469, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_469);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_470, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_470);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_471, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_471);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_472, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_472);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_473, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_473);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_474, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_474);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_475, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_475);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_476, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_476);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_477, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_477);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_478, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_478);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_479, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_479);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_480, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_480);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_481, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_481);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_482, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_482);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_483, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_483);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_484, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_484);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_485, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_485);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_486, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_486);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_487, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_487);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_488, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_488);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_489, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_489);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_490, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_490);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_491, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_491);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_492, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_492);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_493, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_493);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_494, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_494);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_495, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_495);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_496, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_496);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_497, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_497);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_498, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_498);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_499, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_499);
+
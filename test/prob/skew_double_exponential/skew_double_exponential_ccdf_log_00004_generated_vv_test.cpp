@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/skew_double_exponential/skew_double_exponential_ccdf_log_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_400;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_401;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_402;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_403;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_404;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, var, empty, empty> type_vv_405;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, std::vector<var>, empty, empty> type_vv_406;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_407;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, var, empty, empty> type_vv_408;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_vv_409;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_410;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_411;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_412;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_413;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, double, empty, empty> type_vv_414;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, std::vector<double>, empty, empty> type_vv_415;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_416;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, var, empty, empty> type_vv_417;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, std::vector<var>, empty, empty> type_vv_418;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_419;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, double, empty, empty> type_vv_420;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_vv_421;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_422;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, var, empty, empty> type_vv_423;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_vv_424;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_425;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_426;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_427;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_428;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_429;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_430;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_431;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_vv_432;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_vv_433;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_434;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_vv_435;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_vv_436;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_437;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_438;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_439;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_440;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_vv_441;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_vv_442;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_443;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_vv_444;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_vv_445;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_446;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_vv_447;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_vv_448;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_449;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_vv_450;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_vv_451;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_452;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_453;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_454;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_455;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_456;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_457;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_458;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, double, empty, empty> type_vv_459;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, std::vector<double>, empty, empty> type_vv_460;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_461;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, var, empty, empty> type_vv_462;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, std::vector<var>, empty, empty> type_vv_463;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_464;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, double, empty, empty> type_vv_465;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, std::vector<double>, empty, empty> type_vv_466;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_467;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, var, empty, empty> type_vv_468;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, std::vector<var>, empty, empty> type_vv_469;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_470;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_471;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_472;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_473;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_474;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_475;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_476;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, double, empty, empty> type_vv_477;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, std::vector<double>, empty, empty> type_vv_478;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_479;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, var, empty, empty> type_vv_480;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, std::vector<var>, empty, empty> type_vv_481;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_482;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, double, empty, empty> type_vv_483;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, std::vector<double>, empty, empty> type_vv_484;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_485;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, var, empty, empty> type_vv_486;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, std::vector<var>, empty, empty> type_vv_487;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_488;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_489;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_490;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_491;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_492;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_493;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_494;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, double, empty, empty> type_vv_495;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, std::vector<double>, empty, empty> type_vv_496;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_497;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, var, empty, empty> type_vv_498;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, std::vector<var>, empty, empty> type_vv_499;
+
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_400> AgradCcdfLogSkewDoubleExponential_vv_400;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_401> AgradCcdfLogSkewDoubleExponential_vv_401;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_402> AgradCcdfLogSkewDoubleExponential_vv_402;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_403> AgradCcdfLogSkewDoubleExponential_vv_403;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_404> AgradCcdfLogSkewDoubleExponential_vv_404;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_405> AgradCcdfLogSkewDoubleExponential_vv_405;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_406> AgradCcdfLogSkewDoubleExponential_vv_406;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_407> AgradCcdfLogSkewDoubleExponential_vv_407;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_408> AgradCcdfLogSkewDoubleExponential_vv_408;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_409> AgradCcdfLogSkewDoubleExponential_vv_409;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_410> AgradCcdfLogSkewDoubleExponential_vv_410;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_411> AgradCcdfLogSkewDoubleExponential_vv_411;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_412> AgradCcdfLogSkewDoubleExponential_vv_412;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_413> AgradCcdfLogSkewDoubleExponential_vv_413;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_414> AgradCcdfLogSkewDoubleExponential_vv_414;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_415> AgradCcdfLogSkewDoubleExponential_vv_415;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_416> AgradCcdfLogSkewDoubleExponential_vv_416;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_417> AgradCcdfLogSkewDoubleExponential_vv_417;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_418> AgradCcdfLogSkewDoubleExponential_vv_418;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_419> AgradCcdfLogSkewDoubleExponential_vv_419;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_420> AgradCcdfLogSkewDoubleExponential_vv_420;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_421> AgradCcdfLogSkewDoubleExponential_vv_421;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_422> AgradCcdfLogSkewDoubleExponential_vv_422;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_423> AgradCcdfLogSkewDoubleExponential_vv_423;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_424> AgradCcdfLogSkewDoubleExponential_vv_424;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_425> AgradCcdfLogSkewDoubleExponential_vv_425;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_426> AgradCcdfLogSkewDoubleExponential_vv_426;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_427> AgradCcdfLogSkewDoubleExponential_vv_427;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_428> AgradCcdfLogSkewDoubleExponential_vv_428;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_429> AgradCcdfLogSkewDoubleExponential_vv_429;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_430> AgradCcdfLogSkewDoubleExponential_vv_430;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_431> AgradCcdfLogSkewDoubleExponential_vv_431;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_432> AgradCcdfLogSkewDoubleExponential_vv_432;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_433> AgradCcdfLogSkewDoubleExponential_vv_433;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_434> AgradCcdfLogSkewDoubleExponential_vv_434;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_435> AgradCcdfLogSkewDoubleExponential_vv_435;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_436> AgradCcdfLogSkewDoubleExponential_vv_436;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_437> AgradCcdfLogSkewDoubleExponential_vv_437;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_438> AgradCcdfLogSkewDoubleExponential_vv_438;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_439> AgradCcdfLogSkewDoubleExponential_vv_439;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_440> AgradCcdfLogSkewDoubleExponential_vv_440;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_441> AgradCcdfLogSkewDoubleExponential_vv_441;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_442> AgradCcdfLogSkewDoubleExponential_vv_442;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_443> AgradCcdfLogSkewDoubleExponential_vv_443;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_444> AgradCcdfLogSkewDoubleExponential_vv_444;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_445> AgradCcdfLogSkewDoubleExponential_vv_445;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_446> AgradCcdfLogSkewDoubleExponential_vv_446;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_447> AgradCcdfLogSkewDoubleExponential_vv_447;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_448> AgradCcdfLogSkewDoubleExponential_vv_448;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_449> AgradCcdfLogSkewDoubleExponential_vv_449;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_450> AgradCcdfLogSkewDoubleExponential_vv_450;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_451> AgradCcdfLogSkewDoubleExponential_vv_451;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_452> AgradCcdfLogSkewDoubleExponential_vv_452;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_453> AgradCcdfLogSkewDoubleExponential_vv_453;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_454> AgradCcdfLogSkewDoubleExponential_vv_454;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_455> AgradCcdfLogSkewDoubleExponential_vv_455;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_456> AgradCcdfLogSkewDoubleExponential_vv_456;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_457> AgradCcdfLogSkewDoubleExponential_vv_457;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_458> AgradCcdfLogSkewDoubleExponential_vv_458;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_459> AgradCcdfLogSkewDoubleExponential_vv_459;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_460> AgradCcdfLogSkewDoubleExponential_vv_460;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_461> AgradCcdfLogSkewDoubleExponential_vv_461;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_462> AgradCcdfLogSkewDoubleExponential_vv_462;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_463> AgradCcdfLogSkewDoubleExponential_vv_463;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_464> AgradCcdfLogSkewDoubleExponential_vv_464;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_465> AgradCcdfLogSkewDoubleExponential_vv_465;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_466> AgradCcdfLogSkewDoubleExponential_vv_466;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_467> AgradCcdfLogSkewDoubleExponential_vv_467;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_468> AgradCcdfLogSkewDoubleExponential_vv_468;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_469> AgradCcdfLogSkewDoubleExponential_vv_469;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_470> AgradCcdfLogSkewDoubleExponential_vv_470;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_471> AgradCcdfLogSkewDoubleExponential_vv_471;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_472> AgradCcdfLogSkewDoubleExponential_vv_472;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_473> AgradCcdfLogSkewDoubleExponential_vv_473;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_474> AgradCcdfLogSkewDoubleExponential_vv_474;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_475> AgradCcdfLogSkewDoubleExponential_vv_475;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_476> AgradCcdfLogSkewDoubleExponential_vv_476;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_477> AgradCcdfLogSkewDoubleExponential_vv_477;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_478> AgradCcdfLogSkewDoubleExponential_vv_478;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_479> AgradCcdfLogSkewDoubleExponential_vv_479;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_480> AgradCcdfLogSkewDoubleExponential_vv_480;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_481> AgradCcdfLogSkewDoubleExponential_vv_481;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_482> AgradCcdfLogSkewDoubleExponential_vv_482;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_483> AgradCcdfLogSkewDoubleExponential_vv_483;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_484> AgradCcdfLogSkewDoubleExponential_vv_484;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_485> AgradCcdfLogSkewDoubleExponential_vv_485;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_486> AgradCcdfLogSkewDoubleExponential_vv_486;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_487> AgradCcdfLogSkewDoubleExponential_vv_487;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_488> AgradCcdfLogSkewDoubleExponential_vv_488;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_489> AgradCcdfLogSkewDoubleExponential_vv_489;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_490> AgradCcdfLogSkewDoubleExponential_vv_490;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_491> AgradCcdfLogSkewDoubleExponential_vv_491;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_492> AgradCcdfLogSkewDoubleExponential_vv_492;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_493> AgradCcdfLogSkewDoubleExponential_vv_493;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_494> AgradCcdfLogSkewDoubleExponential_vv_494;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_495> AgradCcdfLogSkewDoubleExponential_vv_495;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_496> AgradCcdfLogSkewDoubleExponential_vv_496;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_497> AgradCcdfLogSkewDoubleExponential_vv_497;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_498> AgradCcdfLogSkewDoubleExponential_vv_498;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_499> AgradCcdfLogSkewDoubleExponential_vv_499;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_400, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_400);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_401, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_401);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_402, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_402);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_403, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_403);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_404, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_404);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_405, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_405);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_406, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_406);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_407, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_407);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_408, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_408);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_409, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_409);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_410, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_410);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_411, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_411);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_412, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_412);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_413, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_413);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_414, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_414);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_415, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_415);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_416, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_416);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_417, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_417);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_418, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_418);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_419, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_419);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_420, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_420);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_421, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_421);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_422, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_422);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_423, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_423);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_424, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_424);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_425, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_425);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_426, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_426);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_427, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_427);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_428, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_428);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_429, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_429);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_430, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_430);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_431, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_431);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_432, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_432);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_433, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_433);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_434, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_434);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_435, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_435);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_436, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_436);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_437, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_437);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_438, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_438);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_439, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_439);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_440, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_440);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_441, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_441);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_442, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_442);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_443, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_443);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_444, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_444);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_445, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_445);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_446, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_446);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_447, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_447);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_448, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_448);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_449, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_449);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_450, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_450);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_451, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_451);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_452, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_452);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_453, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_453);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_454, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_454);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_455, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_455);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_456, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_456);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_457, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_457);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_458, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_458);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_459, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_459);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_460, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_460);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_461, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_461);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_462, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_462);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_463, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_463);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_464, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_464);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_465, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_465);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_466, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_466);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_467, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_467);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_468, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_468);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_469, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_469);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_470, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_470);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_471, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_471);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_472, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_472);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_473, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_473);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_474, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_474);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_475, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_475);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_476, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_476);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_477, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_477);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_478, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_478);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_479, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_479);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_480, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_480);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_481, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_481);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_482, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_482);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_483, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_483);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_484, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_484);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_485, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_485);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_486, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_486);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_487, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_487);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_488, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_488);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_489, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_489);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_490, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_490);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_491, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_491);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_492, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_492);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_493, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_493);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_494, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_494);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_495, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_495);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_496, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_496);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_497, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_497);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_498, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_498);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_499, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_499);
+
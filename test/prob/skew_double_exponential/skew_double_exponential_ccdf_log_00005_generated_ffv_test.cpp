@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/skew_double_exponential/skew_double_exponential_ccdf_log_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_500;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty, empty> type_ffv_501;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_502;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_503;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_504;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_505;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_506;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_507;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_508;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_509;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_510;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_511;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_512;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty, empty> type_ffv_513;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_514;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_515;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_516;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_517;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_518;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_519;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_520;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_521;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_522;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_523;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_524;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_525;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_526;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_527;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_528;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_529;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_530;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty, empty> type_ffv_531;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_ffv_532;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_533;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_534;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_535;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_536;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_ffv_537;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_538;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_539;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_540;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_541;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_542;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_543;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_544;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_545;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_546;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_547;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_548;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_549;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_550;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_551;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_552;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_553;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_554;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_555;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_556;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_557;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_558;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_559;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_560;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_561;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_562;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_563;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_564;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_565;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_566;
+typedef std::tuple<fvar<fvar<var> >, double, double, double, empty, empty> type_ffv_567;
+typedef std::tuple<fvar<fvar<var> >, double, double, std::vector<double>, empty, empty> type_ffv_568;
+typedef std::tuple<fvar<fvar<var> >, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_569;
+typedef std::tuple<fvar<fvar<var> >, double, double, fvar<fvar<var> >, empty, empty> type_ffv_570;
+typedef std::tuple<fvar<fvar<var> >, double, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_571;
+typedef std::tuple<fvar<fvar<var> >, double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_572;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<double>, double, empty, empty> type_ffv_573;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<double>, std::vector<double>, empty, empty> type_ffv_574;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_575;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_576;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_577;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_578;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_579;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_580;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_581;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_582;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_583;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_584;
+typedef std::tuple<fvar<fvar<var> >, double, fvar<fvar<var> >, double, empty, empty> type_ffv_585;
+typedef std::tuple<fvar<fvar<var> >, double, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_586;
+typedef std::tuple<fvar<fvar<var> >, double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_587;
+typedef std::tuple<fvar<fvar<var> >, double, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_588;
+typedef std::tuple<fvar<fvar<var> >, double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_589;
+typedef std::tuple<fvar<fvar<var> >, double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_590;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_591;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_592;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_593;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_594;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_595;
+typedef std::tuple<fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_596;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_597;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_598;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_599;
+
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_500> AgradCcdfLogSkewDoubleExponential_ffv_500;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_501> AgradCcdfLogSkewDoubleExponential_ffv_501;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_502> AgradCcdfLogSkewDoubleExponential_ffv_502;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_503> AgradCcdfLogSkewDoubleExponential_ffv_503;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_504> AgradCcdfLogSkewDoubleExponential_ffv_504;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_505> AgradCcdfLogSkewDoubleExponential_ffv_505;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_506> AgradCcdfLogSkewDoubleExponential_ffv_506;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_507> AgradCcdfLogSkewDoubleExponential_ffv_507;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_508> AgradCcdfLogSkewDoubleExponential_ffv_508;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_509> AgradCcdfLogSkewDoubleExponential_ffv_509;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_510> AgradCcdfLogSkewDoubleExponential_ffv_510;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_511> AgradCcdfLogSkewDoubleExponential_ffv_511;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_512> AgradCcdfLogSkewDoubleExponential_ffv_512;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_513> AgradCcdfLogSkewDoubleExponential_ffv_513;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_514> AgradCcdfLogSkewDoubleExponential_ffv_514;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_515> AgradCcdfLogSkewDoubleExponential_ffv_515;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_516> AgradCcdfLogSkewDoubleExponential_ffv_516;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_517> AgradCcdfLogSkewDoubleExponential_ffv_517;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_518> AgradCcdfLogSkewDoubleExponential_ffv_518;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_519> AgradCcdfLogSkewDoubleExponential_ffv_519;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_520> AgradCcdfLogSkewDoubleExponential_ffv_520;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_521> AgradCcdfLogSkewDoubleExponential_ffv_521;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_522> AgradCcdfLogSkewDoubleExponential_ffv_522;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_523> AgradCcdfLogSkewDoubleExponential_ffv_523;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_524> AgradCcdfLogSkewDoubleExponential_ffv_524;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_525> AgradCcdfLogSkewDoubleExponential_ffv_525;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_526> AgradCcdfLogSkewDoubleExponential_ffv_526;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_527> AgradCcdfLogSkewDoubleExponential_ffv_527;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_528> AgradCcdfLogSkewDoubleExponential_ffv_528;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_529> AgradCcdfLogSkewDoubleExponential_ffv_529;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_530> AgradCcdfLogSkewDoubleExponential_ffv_530;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_531> AgradCcdfLogSkewDoubleExponential_ffv_531;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_532> AgradCcdfLogSkewDoubleExponential_ffv_532;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_533> AgradCcdfLogSkewDoubleExponential_ffv_533;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_534> AgradCcdfLogSkewDoubleExponential_ffv_534;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_535> AgradCcdfLogSkewDoubleExponential_ffv_535;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_536> AgradCcdfLogSkewDoubleExponential_ffv_536;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_537> AgradCcdfLogSkewDoubleExponential_ffv_537;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_538> AgradCcdfLogSkewDoubleExponential_ffv_538;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_539> AgradCcdfLogSkewDoubleExponential_ffv_539;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_540> AgradCcdfLogSkewDoubleExponential_ffv_540;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_541> AgradCcdfLogSkewDoubleExponential_ffv_541;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_542> AgradCcdfLogSkewDoubleExponential_ffv_542;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_543> AgradCcdfLogSkewDoubleExponential_ffv_543;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_544> AgradCcdfLogSkewDoubleExponential_ffv_544;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_545> AgradCcdfLogSkewDoubleExponential_ffv_545;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_546> AgradCcdfLogSkewDoubleExponential_ffv_546;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_547> AgradCcdfLogSkewDoubleExponential_ffv_547;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_548> AgradCcdfLogSkewDoubleExponential_ffv_548;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_549> AgradCcdfLogSkewDoubleExponential_ffv_549;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_550> AgradCcdfLogSkewDoubleExponential_ffv_550;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_551> AgradCcdfLogSkewDoubleExponential_ffv_551;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_552> AgradCcdfLogSkewDoubleExponential_ffv_552;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_553> AgradCcdfLogSkewDoubleExponential_ffv_553;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_554> AgradCcdfLogSkewDoubleExponential_ffv_554;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_555> AgradCcdfLogSkewDoubleExponential_ffv_555;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_556> AgradCcdfLogSkewDoubleExponential_ffv_556;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_557> AgradCcdfLogSkewDoubleExponential_ffv_557;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_558> AgradCcdfLogSkewDoubleExponential_ffv_558;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_559> AgradCcdfLogSkewDoubleExponential_ffv_559;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_560> AgradCcdfLogSkewDoubleExponential_ffv_560;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_561> AgradCcdfLogSkewDoubleExponential_ffv_561;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_562> AgradCcdfLogSkewDoubleExponential_ffv_562;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_563> AgradCcdfLogSkewDoubleExponential_ffv_563;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_564> AgradCcdfLogSkewDoubleExponential_ffv_564;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_565> AgradCcdfLogSkewDoubleExponential_ffv_565;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_566> AgradCcdfLogSkewDoubleExponential_ffv_566;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_567> AgradCcdfLogSkewDoubleExponential_ffv_567;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_568> AgradCcdfLogSkewDoubleExponential_ffv_568;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_569> AgradCcdfLogSkewDoubleExponential_ffv_569;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_570> AgradCcdfLogSkewDoubleExponential_ffv_570;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_571> AgradCcdfLogSkewDoubleExponential_ffv_571;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_572> AgradCcdfLogSkewDoubleExponential_ffv_572;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_573> AgradCcdfLogSkewDoubleExponential_ffv_573;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_574> AgradCcdfLogSkewDoubleExponential_ffv_574;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_575> AgradCcdfLogSkewDoubleExponential_ffv_575;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_576> AgradCcdfLogSkewDoubleExponential_ffv_576;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_577> AgradCcdfLogSkewDoubleExponential_ffv_577;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_578> AgradCcdfLogSkewDoubleExponential_ffv_578;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_579> AgradCcdfLogSkewDoubleExponential_ffv_579;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_580> AgradCcdfLogSkewDoubleExponential_ffv_580;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_581> AgradCcdfLogSkewDoubleExponential_ffv_581;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_582> AgradCcdfLogSkewDoubleExponential_ffv_582;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_583> AgradCcdfLogSkewDoubleExponential_ffv_583;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_584> AgradCcdfLogSkewDoubleExponential_ffv_584;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_585> AgradCcdfLogSkewDoubleExponential_ffv_585;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_586> AgradCcdfLogSkewDoubleExponential_ffv_586;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_587> AgradCcdfLogSkewDoubleExponential_ffv_587;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_588> AgradCcdfLogSkewDoubleExponential_ffv_588;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_589> AgradCcdfLogSkewDoubleExponential_ffv_589;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_590> AgradCcdfLogSkewDoubleExponential_ffv_590;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_591> AgradCcdfLogSkewDoubleExponential_ffv_591;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_592> AgradCcdfLogSkewDoubleExponential_ffv_592;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_593> AgradCcdfLogSkewDoubleExponential_ffv_593;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_594> AgradCcdfLogSkewDoubleExponential_ffv_594;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_595> AgradCcdfLogSkewDoubleExponential_ffv_595;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_596> AgradCcdfLogSkewDoubleExponential_ffv_596;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_597> AgradCcdfLogSkewDoubleExponential_ffv_597;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_598> AgradCcdfLogSkewDoubleExponential_ffv_598;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_599> AgradCcdfLogSkewDoubleExponential_ffv_599;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_500, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_500);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_501, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_501);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_502, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_502);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_503, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_503);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_504, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_504);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_505, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_505);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_506, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_506);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_507, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_507);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_508, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_508);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_509, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_509);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_510, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_510);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_511, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_511);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_512, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_512);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_513, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_513);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_514, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_514);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_515, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_515);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_516, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_516);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_517, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_517);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_518, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_518);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_519, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_519);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_520, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_520);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_521, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_521);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_522, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_522);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_523, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_523);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_524, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_524);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_525, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_525);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_526, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_526);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_527, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_527);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_528, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_528);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_529, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_529);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_530, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_530);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_531, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_531);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_532, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_532);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_533, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_533);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_534, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_534);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_535, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_535);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_536, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_536);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_537, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_537);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_538, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_538);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_539, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_539);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_540, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_540);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_541, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_541);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_542, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_542);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_543, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_543);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_544, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_544);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_545, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_545);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_546, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_546);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_547, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_547);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_548, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_548);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_549, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_549);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_550, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_550);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_551, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_551);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_552, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_552);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_553, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_553);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_554, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_554);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_555, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_555);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_556, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_556);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_557, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_557);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_558, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_558);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_559, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_559);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_560, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_560);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_561, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_561);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_562, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_562);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_563, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_563);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_564, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_564);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_565, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_565);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_566, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_566);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_567, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_567);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_568, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_568);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_569, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_569);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_570, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_570);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_571, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_571);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_572, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_572);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_573, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_573);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_574, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_574);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_575, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_575);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_576, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_576);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_577, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_577);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_578, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_578);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_579, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_579);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_580, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_580);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_581, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_581);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_582, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_582);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_583, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_583);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_584, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_584);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_585, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_585);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_586, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_586);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_587, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_587);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_588, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_588);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_589, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_589);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_590, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_590);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_591, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_591);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_592, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_592);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_593, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_593);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_594, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_594);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_595, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_595);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_596, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_596);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_597, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_597);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_598, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_598);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_599, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_599);
+
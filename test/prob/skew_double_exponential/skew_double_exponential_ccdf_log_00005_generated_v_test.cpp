@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/skew_double_exponential/skew_double_exponential_ccdf_log_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_500;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_501;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_502;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_503;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_504;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_505;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_506;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_507;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_508;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_509;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_510;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_511;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_512;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_513;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_514;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_515;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_516;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_517;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_518;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_519;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_520;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_521;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_522;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_523;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_524;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_525;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_526;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_527;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_528;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_529;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_530;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_531;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_532;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_533;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_534;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_535;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_536;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_537;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_538;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_539;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, double, empty, empty> type_v_540;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, std::vector<double>, empty, empty> type_v_541;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_542;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, var, empty, empty> type_v_543;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, std::vector<var>, empty, empty> type_v_544;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_545;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, double, empty, empty> type_v_546;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, std::vector<double>, empty, empty> type_v_547;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_548;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, var, empty, empty> type_v_549;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, std::vector<var>, empty, empty> type_v_550;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_551;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_552;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_553;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_554;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_555;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_556;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_557;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, double, empty, empty> type_v_558;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, std::vector<double>, empty, empty> type_v_559;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_560;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, var, empty, empty> type_v_561;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, std::vector<var>, empty, empty> type_v_562;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_563;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, double, empty, empty> type_v_564;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, std::vector<double>, empty, empty> type_v_565;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_566;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, var, empty, empty> type_v_567;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, std::vector<var>, empty, empty> type_v_568;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_569;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_570;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_571;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_572;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_573;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_574;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_575;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, double, empty, empty> type_v_576;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, std::vector<double>, empty, empty> type_v_577;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_578;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, var, empty, empty> type_v_579;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, std::vector<var>, empty, empty> type_v_580;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_581;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, double, empty, empty> type_v_582;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_v_583;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_584;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, var, empty, empty> type_v_585;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_v_586;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_587;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_588;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_589;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_590;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_591;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_592;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_593;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, double, empty, empty> type_v_594;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, std::vector<double>, empty, empty> type_v_595;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_596;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, var, empty, empty> type_v_597;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, std::vector<var>, empty, empty> type_v_598;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_599;
+
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_500> AgradCcdfLogSkewDoubleExponential_v_500;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_501> AgradCcdfLogSkewDoubleExponential_v_501;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_502> AgradCcdfLogSkewDoubleExponential_v_502;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_503> AgradCcdfLogSkewDoubleExponential_v_503;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_504> AgradCcdfLogSkewDoubleExponential_v_504;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_505> AgradCcdfLogSkewDoubleExponential_v_505;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_506> AgradCcdfLogSkewDoubleExponential_v_506;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_507> AgradCcdfLogSkewDoubleExponential_v_507;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_508> AgradCcdfLogSkewDoubleExponential_v_508;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_509> AgradCcdfLogSkewDoubleExponential_v_509;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_510> AgradCcdfLogSkewDoubleExponential_v_510;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_511> AgradCcdfLogSkewDoubleExponential_v_511;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_512> AgradCcdfLogSkewDoubleExponential_v_512;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_513> AgradCcdfLogSkewDoubleExponential_v_513;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_514> AgradCcdfLogSkewDoubleExponential_v_514;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_515> AgradCcdfLogSkewDoubleExponential_v_515;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_516> AgradCcdfLogSkewDoubleExponential_v_516;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_517> AgradCcdfLogSkewDoubleExponential_v_517;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_518> AgradCcdfLogSkewDoubleExponential_v_518;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_519> AgradCcdfLogSkewDoubleExponential_v_519;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_520> AgradCcdfLogSkewDoubleExponential_v_520;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_521> AgradCcdfLogSkewDoubleExponential_v_521;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_522> AgradCcdfLogSkewDoubleExponential_v_522;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_523> AgradCcdfLogSkewDoubleExponential_v_523;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_524> AgradCcdfLogSkewDoubleExponential_v_524;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_525> AgradCcdfLogSkewDoubleExponential_v_525;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_526> AgradCcdfLogSkewDoubleExponential_v_526;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_527> AgradCcdfLogSkewDoubleExponential_v_527;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_528> AgradCcdfLogSkewDoubleExponential_v_528;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_529> AgradCcdfLogSkewDoubleExponential_v_529;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_530> AgradCcdfLogSkewDoubleExponential_v_530;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_531> AgradCcdfLogSkewDoubleExponential_v_531;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_532> AgradCcdfLogSkewDoubleExponential_v_532;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_533> AgradCcdfLogSkewDoubleExponential_v_533;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_534> AgradCcdfLogSkewDoubleExponential_v_534;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_535> AgradCcdfLogSkewDoubleExponential_v_535;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_536> AgradCcdfLogSkewDoubleExponential_v_536;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_537> AgradCcdfLogSkewDoubleExponential_v_537;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_538> AgradCcdfLogSkewDoubleExponential_v_538;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_539> AgradCcdfLogSkewDoubleExponential_v_539;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_540> AgradCcdfLogSkewDoubleExponential_v_540;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_541> AgradCcdfLogSkewDoubleExponential_v_541;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_542> AgradCcdfLogSkewDoubleExponential_v_542;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_543> AgradCcdfLogSkewDoubleExponential_v_543;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_544> AgradCcdfLogSkewDoubleExponential_v_544;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_545> AgradCcdfLogSkewDoubleExponential_v_545;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_546> AgradCcdfLogSkewDoubleExponential_v_546;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_547> AgradCcdfLogSkewDoubleExponential_v_547;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_548> AgradCcdfLogSkewDoubleExponential_v_548;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_549> AgradCcdfLogSkewDoubleExponential_v_549;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_550> AgradCcdfLogSkewDoubleExponential_v_550;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_551> AgradCcdfLogSkewDoubleExponential_v_551;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_552> AgradCcdfLogSkewDoubleExponential_v_552;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_553> AgradCcdfLogSkewDoubleExponential_v_553;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_554> AgradCcdfLogSkewDoubleExponential_v_554;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_555> AgradCcdfLogSkewDoubleExponential_v_555;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_556> AgradCcdfLogSkewDoubleExponential_v_556;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_557> AgradCcdfLogSkewDoubleExponential_v_557;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_558> AgradCcdfLogSkewDoubleExponential_v_558;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_559> AgradCcdfLogSkewDoubleExponential_v_559;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_560> AgradCcdfLogSkewDoubleExponential_v_560;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_561> AgradCcdfLogSkewDoubleExponential_v_561;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_562> AgradCcdfLogSkewDoubleExponential_v_562;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_563> AgradCcdfLogSkewDoubleExponential_v_563;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_564> AgradCcdfLogSkewDoubleExponential_v_564;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_565> AgradCcdfLogSkewDoubleExponential_v_565;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_566> AgradCcdfLogSkewDoubleExponential_v_566;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_567> AgradCcdfLogSkewDoubleExponential_v_567;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_568> AgradCcdfLogSkewDoubleExponential_v_568;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_569> AgradCcdfLogSkewDoubleExponential_v_569;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_570> AgradCcdfLogSkewDoubleExponential_v_570;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_571> AgradCcdfLogSkewDoubleExponential_v_571;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_572> AgradCcdfLogSkewDoubleExponential_v_572;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_573> AgradCcdfLogSkewDoubleExponential_v_573;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_574> AgradCcdfLogSkewDoubleExponential_v_574;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_575> AgradCcdfLogSkewDoubleExponential_v_575;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_576> AgradCcdfLogSkewDoubleExponential_v_576;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_577> AgradCcdfLogSkewDoubleExponential_v_577;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_578> AgradCcdfLogSkewDoubleExponential_v_578;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_579> AgradCcdfLogSkewDoubleExponential_v_579;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_580> AgradCcdfLogSkewDoubleExponential_v_580;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_581> AgradCcdfLogSkewDoubleExponential_v_581;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_582> AgradCcdfLogSkewDoubleExponential_v_582;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_583> AgradCcdfLogSkewDoubleExponential_v_583;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_584> AgradCcdfLogSkewDoubleExponential_v_584;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_585> AgradCcdfLogSkewDoubleExponential_v_585;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_586> AgradCcdfLogSkewDoubleExponential_v_586;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_587> AgradCcdfLogSkewDoubleExponential_v_587;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_588> AgradCcdfLogSkewDoubleExponential_v_588;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_589> AgradCcdfLogSkewDoubleExponential_v_589;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_590> AgradCcdfLogSkewDoubleExponential_v_590;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_591> AgradCcdfLogSkewDoubleExponential_v_591;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_592> AgradCcdfLogSkewDoubleExponential_v_592;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_593> AgradCcdfLogSkewDoubleExponential_v_593;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_594> AgradCcdfLogSkewDoubleExponential_v_594;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_595> AgradCcdfLogSkewDoubleExponential_v_595;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_596> AgradCcdfLogSkewDoubleExponential_v_596;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_597> AgradCcdfLogSkewDoubleExponential_v_597;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_598> AgradCcdfLogSkewDoubleExponential_v_598;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_599> AgradCcdfLogSkewDoubleExponential_v_599;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_500, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_500);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_501, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_501);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_502, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_502);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_503, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_503);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_504, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_504);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_505, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_505);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_506, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_506);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_507, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_507);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_508, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_508);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_509, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_509);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_510, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_510);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_511, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_511);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_512, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_512);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_513, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_513);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_514, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_514);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_515, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_515);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_516, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_516);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_517, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_517);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_518, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_518);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_519, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_519);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_520, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_520);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_521, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_521);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_522, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_522);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_523, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_523);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_524, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_524);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_525, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_525);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_526, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_526);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_527, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_527);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_528, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_528);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_529, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_529);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_530, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_530);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_531, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_531);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_532, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_532);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_533, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_533);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_534, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_534);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_535, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_535);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_536, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_536);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_537, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_537);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_538, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_538);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_539, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_539);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_540, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_540);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_541, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_541);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_542, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_542);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_543, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_543);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_544, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_544);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_545, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_545);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_546, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_546);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_547, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_547);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_548, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_548);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_549, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_549);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_550, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_550);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_551, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_551);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_552, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_552);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_553, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_553);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_554, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_554);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_555, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_555);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_556, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_556);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_557, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_557);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_558, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_558);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_559, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_559);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_560, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_560);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_561, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_561);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_562, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_562);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_563, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_563);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_564, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_564);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_565, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_565);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_566, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_566);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_567, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_567);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_568, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_568);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_569, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_569);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_570, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_570);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_571, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_571);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_572, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_572);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_573, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_573);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_574, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_574);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_575, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_575);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_576, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_576);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_577, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_577);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_578, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_578);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_579, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_579);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_580, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_580);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_581, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_581);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_582, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_582);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_583, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_583);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_584, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_584);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_585, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_585);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_586, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_586);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_587, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_587);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_588, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_588);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_589, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_589);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_590, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_590);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_591, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_591);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_592, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_592);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_593, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_593);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_594, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_594);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_595, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_595);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_596, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_596);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_597, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_597);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_598, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_598);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_599, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_599);
+
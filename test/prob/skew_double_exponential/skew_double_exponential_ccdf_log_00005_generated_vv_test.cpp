@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/skew_double_exponential/skew_double_exponential_ccdf_log_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_500;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, double, empty, empty> type_vv_501;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_vv_502;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_503;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, var, empty, empty> type_vv_504;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_vv_505;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_506;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_507;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_508;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_509;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_510;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_511;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_512;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, double, empty, empty> type_vv_513;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, std::vector<double>, empty, empty> type_vv_514;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_515;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, var, empty, empty> type_vv_516;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, std::vector<var>, empty, empty> type_vv_517;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_518;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, double, empty, empty> type_vv_519;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_vv_520;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_521;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, var, empty, empty> type_vv_522;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_vv_523;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_524;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_525;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_526;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_527;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_528;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_529;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_530;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, empty, empty> type_vv_531;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, empty, empty> type_vv_532;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_533;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, empty, empty> type_vv_534;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, empty, empty> type_vv_535;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_536;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, empty, empty> type_vv_537;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, empty, empty> type_vv_538;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_539;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, empty, empty> type_vv_540;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, empty, empty> type_vv_541;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_542;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_543;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_544;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_545;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_546;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_547;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_548;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, empty, empty> type_vv_549;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, empty, empty> type_vv_550;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_551;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, empty, empty> type_vv_552;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, empty, empty> type_vv_553;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_554;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, empty, empty> type_vv_555;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, empty, empty> type_vv_556;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_557;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, empty, empty> type_vv_558;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, empty, empty> type_vv_559;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_560;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_561;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_562;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_563;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_564;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_565;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_566;
+typedef std::tuple<var, double, double, double, empty, empty> type_vv_567;
+typedef std::tuple<var, double, double, std::vector<double>, empty, empty> type_vv_568;
+typedef std::tuple<var, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_569;
+typedef std::tuple<var, double, double, var, empty, empty> type_vv_570;
+typedef std::tuple<var, double, double, std::vector<var>, empty, empty> type_vv_571;
+typedef std::tuple<var, double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_572;
+typedef std::tuple<var, double, std::vector<double>, double, empty, empty> type_vv_573;
+typedef std::tuple<var, double, std::vector<double>, std::vector<double>, empty, empty> type_vv_574;
+typedef std::tuple<var, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_575;
+typedef std::tuple<var, double, std::vector<double>, var, empty, empty> type_vv_576;
+typedef std::tuple<var, double, std::vector<double>, std::vector<var>, empty, empty> type_vv_577;
+typedef std::tuple<var, double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_578;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_579;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_580;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_581;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_582;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_583;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_584;
+typedef std::tuple<var, double, var, double, empty, empty> type_vv_585;
+typedef std::tuple<var, double, var, std::vector<double>, empty, empty> type_vv_586;
+typedef std::tuple<var, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_587;
+typedef std::tuple<var, double, var, var, empty, empty> type_vv_588;
+typedef std::tuple<var, double, var, std::vector<var>, empty, empty> type_vv_589;
+typedef std::tuple<var, double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_590;
+typedef std::tuple<var, double, std::vector<var>, double, empty, empty> type_vv_591;
+typedef std::tuple<var, double, std::vector<var>, std::vector<double>, empty, empty> type_vv_592;
+typedef std::tuple<var, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_593;
+typedef std::tuple<var, double, std::vector<var>, var, empty, empty> type_vv_594;
+typedef std::tuple<var, double, std::vector<var>, std::vector<var>, empty, empty> type_vv_595;
+typedef std::tuple<var, double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_596;
+typedef std::tuple<var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_597;
+typedef std::tuple<var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_598;
+typedef std::tuple<var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_599;
+
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_500> AgradCcdfLogSkewDoubleExponential_vv_500;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_501> AgradCcdfLogSkewDoubleExponential_vv_501;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_502> AgradCcdfLogSkewDoubleExponential_vv_502;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_503> AgradCcdfLogSkewDoubleExponential_vv_503;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_504> AgradCcdfLogSkewDoubleExponential_vv_504;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_505> AgradCcdfLogSkewDoubleExponential_vv_505;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_506> AgradCcdfLogSkewDoubleExponential_vv_506;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_507> AgradCcdfLogSkewDoubleExponential_vv_507;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_508> AgradCcdfLogSkewDoubleExponential_vv_508;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_509> AgradCcdfLogSkewDoubleExponential_vv_509;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_510> AgradCcdfLogSkewDoubleExponential_vv_510;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_511> AgradCcdfLogSkewDoubleExponential_vv_511;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_512> AgradCcdfLogSkewDoubleExponential_vv_512;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_513> AgradCcdfLogSkewDoubleExponential_vv_513;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_514> AgradCcdfLogSkewDoubleExponential_vv_514;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_515> AgradCcdfLogSkewDoubleExponential_vv_515;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_516> AgradCcdfLogSkewDoubleExponential_vv_516;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_517> AgradCcdfLogSkewDoubleExponential_vv_517;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_518> AgradCcdfLogSkewDoubleExponential_vv_518;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_519> AgradCcdfLogSkewDoubleExponential_vv_519;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_520> AgradCcdfLogSkewDoubleExponential_vv_520;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_521> AgradCcdfLogSkewDoubleExponential_vv_521;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_522> AgradCcdfLogSkewDoubleExponential_vv_522;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_523> AgradCcdfLogSkewDoubleExponential_vv_523;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_524> AgradCcdfLogSkewDoubleExponential_vv_524;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_525> AgradCcdfLogSkewDoubleExponential_vv_525;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_526> AgradCcdfLogSkewDoubleExponential_vv_526;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_527> AgradCcdfLogSkewDoubleExponential_vv_527;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_528> AgradCcdfLogSkewDoubleExponential_vv_528;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_529> AgradCcdfLogSkewDoubleExponential_vv_529;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_530> AgradCcdfLogSkewDoubleExponential_vv_530;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_531> AgradCcdfLogSkewDoubleExponential_vv_531;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_532> AgradCcdfLogSkewDoubleExponential_vv_532;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_533> AgradCcdfLogSkewDoubleExponential_vv_533;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_534> AgradCcdfLogSkewDoubleExponential_vv_534;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_535> AgradCcdfLogSkewDoubleExponential_vv_535;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_536> AgradCcdfLogSkewDoubleExponential_vv_536;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_537> AgradCcdfLogSkewDoubleExponential_vv_537;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_538> AgradCcdfLogSkewDoubleExponential_vv_538;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_539> AgradCcdfLogSkewDoubleExponential_vv_539;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_540> AgradCcdfLogSkewDoubleExponential_vv_540;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_541> AgradCcdfLogSkewDoubleExponential_vv_541;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_542> AgradCcdfLogSkewDoubleExponential_vv_542;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_543> AgradCcdfLogSkewDoubleExponential_vv_543;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_544> AgradCcdfLogSkewDoubleExponential_vv_544;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_545> AgradCcdfLogSkewDoubleExponential_vv_545;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_546> AgradCcdfLogSkewDoubleExponential_vv_546;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_547> AgradCcdfLogSkewDoubleExponential_vv_547;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_548> AgradCcdfLogSkewDoubleExponential_vv_548;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_549> AgradCcdfLogSkewDoubleExponential_vv_549;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_550> AgradCcdfLogSkewDoubleExponential_vv_550;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_551> AgradCcdfLogSkewDoubleExponential_vv_551;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_552> AgradCcdfLogSkewDoubleExponential_vv_552;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_553> AgradCcdfLogSkewDoubleExponential_vv_553;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_554> AgradCcdfLogSkewDoubleExponential_vv_554;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_555> AgradCcdfLogSkewDoubleExponential_vv_555;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_556> AgradCcdfLogSkewDoubleExponential_vv_556;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_557> AgradCcdfLogSkewDoubleExponential_vv_557;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_558> AgradCcdfLogSkewDoubleExponential_vv_558;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_559> AgradCcdfLogSkewDoubleExponential_vv_559;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_560> AgradCcdfLogSkewDoubleExponential_vv_560;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_561> AgradCcdfLogSkewDoubleExponential_vv_561;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_562> AgradCcdfLogSkewDoubleExponential_vv_562;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_563> AgradCcdfLogSkewDoubleExponential_vv_563;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_564> AgradCcdfLogSkewDoubleExponential_vv_564;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_565> AgradCcdfLogSkewDoubleExponential_vv_565;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_566> AgradCcdfLogSkewDoubleExponential_vv_566;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_567> AgradCcdfLogSkewDoubleExponential_vv_567;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_568> AgradCcdfLogSkewDoubleExponential_vv_568;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_569> AgradCcdfLogSkewDoubleExponential_vv_569;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_570> AgradCcdfLogSkewDoubleExponential_vv_570;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_571> AgradCcdfLogSkewDoubleExponential_vv_571;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_572> AgradCcdfLogSkewDoubleExponential_vv_572;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_573> AgradCcdfLogSkewDoubleExponential_vv_573;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_574> AgradCcdfLogSkewDoubleExponential_vv_574;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_575> AgradCcdfLogSkewDoubleExponential_vv_575;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_576> AgradCcdfLogSkewDoubleExponential_vv_576;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_577> AgradCcdfLogSkewDoubleExponential_vv_577;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_578> AgradCcdfLogSkewDoubleExponential_vv_578;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_579> AgradCcdfLogSkewDoubleExponential_vv_579;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_580> AgradCcdfLogSkewDoubleExponential_vv_580;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_581> AgradCcdfLogSkewDoubleExponential_vv_581;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_582> AgradCcdfLogSkewDoubleExponential_vv_582;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_583> AgradCcdfLogSkewDoubleExponential_vv_583;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_584> AgradCcdfLogSkewDoubleExponential_vv_584;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_585> AgradCcdfLogSkewDoubleExponential_vv_585;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_586> AgradCcdfLogSkewDoubleExponential_vv_586;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_587> AgradCcdfLogSkewDoubleExponential_vv_587;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_588> AgradCcdfLogSkewDoubleExponential_vv_588;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_589> AgradCcdfLogSkewDoubleExponential_vv_589;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_590> AgradCcdfLogSkewDoubleExponential_vv_590;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_591> AgradCcdfLogSkewDoubleExponential_vv_591;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_592> AgradCcdfLogSkewDoubleExponential_vv_592;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_593> AgradCcdfLogSkewDoubleExponential_vv_593;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_594> AgradCcdfLogSkewDoubleExponential_vv_594;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_595> AgradCcdfLogSkewDoubleExponential_vv_595;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_596> AgradCcdfLogSkewDoubleExponential_vv_596;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_597> AgradCcdfLogSkewDoubleExponential_vv_597;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_598> AgradCcdfLogSkewDoubleExponential_vv_598;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_599> AgradCcdfLogSkewDoubleExponential_vv_599;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_500, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_500);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_501, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_501);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_502, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_502);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_503, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_503);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_504, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_504);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_505, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_505);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_506, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_506);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_507, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_507);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_508, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_508);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_509, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_509);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_510, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_510);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_511, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_511);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_512, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_512);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_513, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_513);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_514, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_514);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_515, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_515);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_516, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_516);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_517, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_517);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_518, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_518);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_519, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_519);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_520, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_520);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_521, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_521);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_522, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_522);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_523, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_523);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_524, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_524);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_525, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_525);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_526, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_526);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_527, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_527);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_528, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_528);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_529, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_529);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_530, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_530);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_531, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_531);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_532, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_532);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_533, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_533);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_534, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_534);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_535, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_535);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_536, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_536);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_537, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_537);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_538, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_538);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_539, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_539);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_540, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_540);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_541, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_541);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_542, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_542);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_543, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_543);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_544, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_544);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_545, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_545);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_546, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_546);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_547, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_547);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_548, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_548);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_549, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_549);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_550, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_550);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_551, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_551);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_552, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_552);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_553, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_553);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_554, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_554);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_555, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_555);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_556, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_556);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_557, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_557);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_558, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_558);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_559, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_559);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_560, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_560);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_561, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_561);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_562, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_562);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_563, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_563);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_564, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_564);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_565, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_565);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_566, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_566);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_567, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_567);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_568, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_568);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_569, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_569);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_570, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_570);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_571, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_571);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_572, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_572);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_573, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_573);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_574, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_574);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_575, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_575);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_576, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_576);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_577, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_577);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_578, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_578);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_579, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_579);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_580, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_580);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_581, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_581);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_582, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_582);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_583, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_583);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_584, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_584);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_585, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_585);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_586, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_586);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_587, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_587);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_588, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_588);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_589, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_589);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_590, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_590);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_591, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_591);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_592, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_592);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_593, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_593);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_594, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_594);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_595, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_595);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_596, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_596);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_597, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_597);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_598, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_598);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_599, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_599);
+
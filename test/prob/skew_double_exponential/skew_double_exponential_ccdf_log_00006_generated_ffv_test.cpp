@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/skew_double_exponential/skew_double_exponential_ccdf_log_test.hpp>
+
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_600;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_601;
+typedef std::tuple<fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_602;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, double, double, empty, empty> type_ffv_603;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, double, std::vector<double>, empty, empty> type_ffv_604;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_605;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, double, fvar<fvar<var> >, empty, empty> type_ffv_606;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_607;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_608;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<double>, double, empty, empty> type_ffv_609;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_610;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_611;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_612;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_613;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_614;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_615;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_616;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_617;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_618;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_619;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_620;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, double, empty, empty> type_ffv_621;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_622;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_623;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_624;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_625;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_626;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_627;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_628;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_629;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_630;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_631;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_632;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_633;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_634;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_635;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_636;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_637;
+typedef std::tuple<fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_638;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty> type_ffv_639;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_ffv_640;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_641;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_642;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_643;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_644;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_ffv_645;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_646;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_647;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_648;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_649;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_650;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_651;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_652;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_653;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_654;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_655;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_656;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_657;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_658;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_659;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_660;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_661;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_662;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_663;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_664;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_665;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_666;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_667;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_668;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_669;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_670;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_671;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_672;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_673;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_674;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, double, double, empty, empty> type_ffv_675;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, double, std::vector<double>, empty, empty> type_ffv_676;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_677;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, double, fvar<fvar<var> >, empty, empty> type_ffv_678;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_679;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_680;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, double, empty, empty> type_ffv_681;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty, empty> type_ffv_682;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_683;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_684;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_685;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_686;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_687;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_688;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_689;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_690;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_691;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_692;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, double, empty, empty> type_ffv_693;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_694;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_695;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_696;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_697;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_698;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_699;
+
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_600> AgradCcdfLogSkewDoubleExponential_ffv_600;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_601> AgradCcdfLogSkewDoubleExponential_ffv_601;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_602> AgradCcdfLogSkewDoubleExponential_ffv_602;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_603> AgradCcdfLogSkewDoubleExponential_ffv_603;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_604> AgradCcdfLogSkewDoubleExponential_ffv_604;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_605> AgradCcdfLogSkewDoubleExponential_ffv_605;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_606> AgradCcdfLogSkewDoubleExponential_ffv_606;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_607> AgradCcdfLogSkewDoubleExponential_ffv_607;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_608> AgradCcdfLogSkewDoubleExponential_ffv_608;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_609> AgradCcdfLogSkewDoubleExponential_ffv_609;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_610> AgradCcdfLogSkewDoubleExponential_ffv_610;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_611> AgradCcdfLogSkewDoubleExponential_ffv_611;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_612> AgradCcdfLogSkewDoubleExponential_ffv_612;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_613> AgradCcdfLogSkewDoubleExponential_ffv_613;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_614> AgradCcdfLogSkewDoubleExponential_ffv_614;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_615> AgradCcdfLogSkewDoubleExponential_ffv_615;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_616> AgradCcdfLogSkewDoubleExponential_ffv_616;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_617> AgradCcdfLogSkewDoubleExponential_ffv_617;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_618> AgradCcdfLogSkewDoubleExponential_ffv_618;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_619> AgradCcdfLogSkewDoubleExponential_ffv_619;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_620> AgradCcdfLogSkewDoubleExponential_ffv_620;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_621> AgradCcdfLogSkewDoubleExponential_ffv_621;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_622> AgradCcdfLogSkewDoubleExponential_ffv_622;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_623> AgradCcdfLogSkewDoubleExponential_ffv_623;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_624> AgradCcdfLogSkewDoubleExponential_ffv_624;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_625> AgradCcdfLogSkewDoubleExponential_ffv_625;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_626> AgradCcdfLogSkewDoubleExponential_ffv_626;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_627> AgradCcdfLogSkewDoubleExponential_ffv_627;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_628> AgradCcdfLogSkewDoubleExponential_ffv_628;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_629> AgradCcdfLogSkewDoubleExponential_ffv_629;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_630> AgradCcdfLogSkewDoubleExponential_ffv_630;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_631> AgradCcdfLogSkewDoubleExponential_ffv_631;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_632> AgradCcdfLogSkewDoubleExponential_ffv_632;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_633> AgradCcdfLogSkewDoubleExponential_ffv_633;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_634> AgradCcdfLogSkewDoubleExponential_ffv_634;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_635> AgradCcdfLogSkewDoubleExponential_ffv_635;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_636> AgradCcdfLogSkewDoubleExponential_ffv_636;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_637> AgradCcdfLogSkewDoubleExponential_ffv_637;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_638> AgradCcdfLogSkewDoubleExponential_ffv_638;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_639> AgradCcdfLogSkewDoubleExponential_ffv_639;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_640> AgradCcdfLogSkewDoubleExponential_ffv_640;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_641> AgradCcdfLogSkewDoubleExponential_ffv_641;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_642> AgradCcdfLogSkewDoubleExponential_ffv_642;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_643> AgradCcdfLogSkewDoubleExponential_ffv_643;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_644> AgradCcdfLogSkewDoubleExponential_ffv_644;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_645> AgradCcdfLogSkewDoubleExponential_ffv_645;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_646> AgradCcdfLogSkewDoubleExponential_ffv_646;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_647> AgradCcdfLogSkewDoubleExponential_ffv_647;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_648> AgradCcdfLogSkewDoubleExponential_ffv_648;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_649> AgradCcdfLogSkewDoubleExponential_ffv_649;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_650> AgradCcdfLogSkewDoubleExponential_ffv_650;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_651> AgradCcdfLogSkewDoubleExponential_ffv_651;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_652> AgradCcdfLogSkewDoubleExponential_ffv_652;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_653> AgradCcdfLogSkewDoubleExponential_ffv_653;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_654> AgradCcdfLogSkewDoubleExponential_ffv_654;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_655> AgradCcdfLogSkewDoubleExponential_ffv_655;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_656> AgradCcdfLogSkewDoubleExponential_ffv_656;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_657> AgradCcdfLogSkewDoubleExponential_ffv_657;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_658> AgradCcdfLogSkewDoubleExponential_ffv_658;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_659> AgradCcdfLogSkewDoubleExponential_ffv_659;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_660> AgradCcdfLogSkewDoubleExponential_ffv_660;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_661> AgradCcdfLogSkewDoubleExponential_ffv_661;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_662> AgradCcdfLogSkewDoubleExponential_ffv_662;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_663> AgradCcdfLogSkewDoubleExponential_ffv_663;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_664> AgradCcdfLogSkewDoubleExponential_ffv_664;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_665> AgradCcdfLogSkewDoubleExponential_ffv_665;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_666> AgradCcdfLogSkewDoubleExponential_ffv_666;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_667> AgradCcdfLogSkewDoubleExponential_ffv_667;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_668> AgradCcdfLogSkewDoubleExponential_ffv_668;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_669> AgradCcdfLogSkewDoubleExponential_ffv_669;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_670> AgradCcdfLogSkewDoubleExponential_ffv_670;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_671> AgradCcdfLogSkewDoubleExponential_ffv_671;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_672> AgradCcdfLogSkewDoubleExponential_ffv_672;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_673> AgradCcdfLogSkewDoubleExponential_ffv_673;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_674> AgradCcdfLogSkewDoubleExponential_ffv_674;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_675> AgradCcdfLogSkewDoubleExponential_ffv_675;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_676> AgradCcdfLogSkewDoubleExponential_ffv_676;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_677> AgradCcdfLogSkewDoubleExponential_ffv_677;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_678> AgradCcdfLogSkewDoubleExponential_ffv_678;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_679> AgradCcdfLogSkewDoubleExponential_ffv_679;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_680> AgradCcdfLogSkewDoubleExponential_ffv_680;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_681> AgradCcdfLogSkewDoubleExponential_ffv_681;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_682> AgradCcdfLogSkewDoubleExponential_ffv_682;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_683> AgradCcdfLogSkewDoubleExponential_ffv_683;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_684> AgradCcdfLogSkewDoubleExponential_ffv_684;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_685> AgradCcdfLogSkewDoubleExponential_ffv_685;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_686> AgradCcdfLogSkewDoubleExponential_ffv_686;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_687> AgradCcdfLogSkewDoubleExponential_ffv_687;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_688> AgradCcdfLogSkewDoubleExponential_ffv_688;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_689> AgradCcdfLogSkewDoubleExponential_ffv_689;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_690> AgradCcdfLogSkewDoubleExponential_ffv_690;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_691> AgradCcdfLogSkewDoubleExponential_ffv_691;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_692> AgradCcdfLogSkewDoubleExponential_ffv_692;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_693> AgradCcdfLogSkewDoubleExponential_ffv_693;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_694> AgradCcdfLogSkewDoubleExponential_ffv_694;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_695> AgradCcdfLogSkewDoubleExponential_ffv_695;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_696> AgradCcdfLogSkewDoubleExponential_ffv_696;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_697> AgradCcdfLogSkewDoubleExponential_ffv_697;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_698> AgradCcdfLogSkewDoubleExponential_ffv_698;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_699> AgradCcdfLogSkewDoubleExponential_ffv_699;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_600, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_600);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_601, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_601);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_602, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_602);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_603, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_603);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_604, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_604);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_605, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_605);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_606, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_606);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_607, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_607);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_608, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_608);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_609, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_609);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_610, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_610);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_611, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_611);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_612, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_612);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_613, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_613);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_614, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_614);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_615, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_615);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_616, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_616);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_617, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_617);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_618, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_618);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_619, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_619);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_620, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_620);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_621, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_621);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_622, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_622);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_623, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_623);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_624, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_624);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_625, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_625);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_626, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_626);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_627, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_627);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_628, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_628);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_629, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_629);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_630, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_630);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_631, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_631);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_632, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_632);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_633, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_633);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_634, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_634);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_635, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_635);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_636, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_636);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_637, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_637);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_638, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_638);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_639, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_639);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_640, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_640);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_641, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_641);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_642, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_642);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_643, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_643);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_644, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_644);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_645, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_645);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_646, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_646);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_647, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_647);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_648, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_648);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_649, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_649);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_650, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_650);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_651, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_651);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_652, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_652);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_653, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_653);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_654, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_654);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_655, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_655);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_656, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_656);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_657, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_657);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_658, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_658);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_659, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_659);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_660, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_660);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_661, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_661);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_662, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_662);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_663, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_663);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_664, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_664);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_665, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_665);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_666, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_666);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_667, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_667);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_668, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_668);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_669, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_669);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_670, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_670);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_671, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_671);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_672, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_672);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_673, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_673);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_674, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_674);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_675, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_675);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_676, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_676);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_677, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_677);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_678, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_678);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_679, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_679);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_680, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_680);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_681, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_681);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_682, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_682);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_683, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_683);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_684, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_684);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_685, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_685);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_686, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_686);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_687, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_687);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_688, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_688);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_689, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_689);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_690, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_690);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_691, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_691);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_692, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_692);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_693, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_693);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_694, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_694);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_695, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_695);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_696, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_696);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_697, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_697);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_698, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_698);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_699, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_699);
+
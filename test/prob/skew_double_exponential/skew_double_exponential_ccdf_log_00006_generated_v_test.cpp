@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/skew_double_exponential/skew_double_exponential_ccdf_log_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, double, empty, empty> type_v_600;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_v_601;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_602;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, var, empty, empty> type_v_603;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_v_604;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_605;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_606;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_607;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_608;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_609;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_610;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_611;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_612;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_613;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_614;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_615;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_616;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_617;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_618;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_619;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_620;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_621;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_622;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_623;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_624;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_625;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_626;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_627;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_628;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_629;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_630;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_631;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_632;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_633;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_634;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_635;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_636;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_637;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_638;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_639;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_640;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_641;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_642;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_643;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_644;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_645;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_646;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_647;
+typedef std::tuple<var, double, double, double, empty, empty> type_v_648;
+typedef std::tuple<var, double, double, std::vector<double>, empty, empty> type_v_649;
+typedef std::tuple<var, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_650;
+typedef std::tuple<var, double, double, var, empty, empty> type_v_651;
+typedef std::tuple<var, double, double, std::vector<var>, empty, empty> type_v_652;
+typedef std::tuple<var, double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_653;
+typedef std::tuple<var, double, std::vector<double>, double, empty, empty> type_v_654;
+typedef std::tuple<var, double, std::vector<double>, std::vector<double>, empty, empty> type_v_655;
+typedef std::tuple<var, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_656;
+typedef std::tuple<var, double, std::vector<double>, var, empty, empty> type_v_657;
+typedef std::tuple<var, double, std::vector<double>, std::vector<var>, empty, empty> type_v_658;
+typedef std::tuple<var, double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_659;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_660;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_661;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_662;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_663;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_664;
+typedef std::tuple<var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_665;
+typedef std::tuple<var, double, var, double, empty, empty> type_v_666;
+typedef std::tuple<var, double, var, std::vector<double>, empty, empty> type_v_667;
+typedef std::tuple<var, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_668;
+typedef std::tuple<var, double, var, var, empty, empty> type_v_669;
+typedef std::tuple<var, double, var, std::vector<var>, empty, empty> type_v_670;
+typedef std::tuple<var, double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_671;
+typedef std::tuple<var, double, std::vector<var>, double, empty, empty> type_v_672;
+typedef std::tuple<var, double, std::vector<var>, std::vector<double>, empty, empty> type_v_673;
+typedef std::tuple<var, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_674;
+typedef std::tuple<var, double, std::vector<var>, var, empty, empty> type_v_675;
+typedef std::tuple<var, double, std::vector<var>, std::vector<var>, empty, empty> type_v_676;
+typedef std::tuple<var, double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_677;
+typedef std::tuple<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_678;
+typedef std::tuple<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_679;
+typedef std::tuple<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_680;
+typedef std::tuple<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_681;
+typedef std::tuple<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_682;
+typedef std::tuple<var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_683;
+typedef std::tuple<var, std::vector<double>, double, double, empty, empty> type_v_684;
+typedef std::tuple<var, std::vector<double>, double, std::vector<double>, empty, empty> type_v_685;
+typedef std::tuple<var, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_686;
+typedef std::tuple<var, std::vector<double>, double, var, empty, empty> type_v_687;
+typedef std::tuple<var, std::vector<double>, double, std::vector<var>, empty, empty> type_v_688;
+typedef std::tuple<var, std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_689;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, double, empty, empty> type_v_690;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, std::vector<double>, empty, empty> type_v_691;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_692;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, var, empty, empty> type_v_693;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_v_694;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_695;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_696;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_697;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_698;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_699;
+
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_600> AgradCcdfLogSkewDoubleExponential_v_600;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_601> AgradCcdfLogSkewDoubleExponential_v_601;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_602> AgradCcdfLogSkewDoubleExponential_v_602;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_603> AgradCcdfLogSkewDoubleExponential_v_603;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_604> AgradCcdfLogSkewDoubleExponential_v_604;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_605> AgradCcdfLogSkewDoubleExponential_v_605;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_606> AgradCcdfLogSkewDoubleExponential_v_606;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_607> AgradCcdfLogSkewDoubleExponential_v_607;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_608> AgradCcdfLogSkewDoubleExponential_v_608;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_609> AgradCcdfLogSkewDoubleExponential_v_609;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_610> AgradCcdfLogSkewDoubleExponential_v_610;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_611> AgradCcdfLogSkewDoubleExponential_v_611;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_612> AgradCcdfLogSkewDoubleExponential_v_612;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_613> AgradCcdfLogSkewDoubleExponential_v_613;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_614> AgradCcdfLogSkewDoubleExponential_v_614;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_615> AgradCcdfLogSkewDoubleExponential_v_615;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_616> AgradCcdfLogSkewDoubleExponential_v_616;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_617> AgradCcdfLogSkewDoubleExponential_v_617;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_618> AgradCcdfLogSkewDoubleExponential_v_618;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_619> AgradCcdfLogSkewDoubleExponential_v_619;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_620> AgradCcdfLogSkewDoubleExponential_v_620;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_621> AgradCcdfLogSkewDoubleExponential_v_621;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_622> AgradCcdfLogSkewDoubleExponential_v_622;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_623> AgradCcdfLogSkewDoubleExponential_v_623;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_624> AgradCcdfLogSkewDoubleExponential_v_624;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_625> AgradCcdfLogSkewDoubleExponential_v_625;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_626> AgradCcdfLogSkewDoubleExponential_v_626;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_627> AgradCcdfLogSkewDoubleExponential_v_627;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_628> AgradCcdfLogSkewDoubleExponential_v_628;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_629> AgradCcdfLogSkewDoubleExponential_v_629;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_630> AgradCcdfLogSkewDoubleExponential_v_630;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_631> AgradCcdfLogSkewDoubleExponential_v_631;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_632> AgradCcdfLogSkewDoubleExponential_v_632;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_633> AgradCcdfLogSkewDoubleExponential_v_633;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_634> AgradCcdfLogSkewDoubleExponential_v_634;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_635> AgradCcdfLogSkewDoubleExponential_v_635;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_636> AgradCcdfLogSkewDoubleExponential_v_636;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_637> AgradCcdfLogSkewDoubleExponential_v_637;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_638> AgradCcdfLogSkewDoubleExponential_v_638;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_639> AgradCcdfLogSkewDoubleExponential_v_639;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_640> AgradCcdfLogSkewDoubleExponential_v_640;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_641> AgradCcdfLogSkewDoubleExponential_v_641;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_642> AgradCcdfLogSkewDoubleExponential_v_642;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_643> AgradCcdfLogSkewDoubleExponential_v_643;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_644> AgradCcdfLogSkewDoubleExponential_v_644;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_645> AgradCcdfLogSkewDoubleExponential_v_645;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_646> AgradCcdfLogSkewDoubleExponential_v_646;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_647> AgradCcdfLogSkewDoubleExponential_v_647;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_648> AgradCcdfLogSkewDoubleExponential_v_648;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_649> AgradCcdfLogSkewDoubleExponential_v_649;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_650> AgradCcdfLogSkewDoubleExponential_v_650;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_651> AgradCcdfLogSkewDoubleExponential_v_651;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_652> AgradCcdfLogSkewDoubleExponential_v_652;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_653> AgradCcdfLogSkewDoubleExponential_v_653;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_654> AgradCcdfLogSkewDoubleExponential_v_654;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_655> AgradCcdfLogSkewDoubleExponential_v_655;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_656> AgradCcdfLogSkewDoubleExponential_v_656;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_657> AgradCcdfLogSkewDoubleExponential_v_657;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_658> AgradCcdfLogSkewDoubleExponential_v_658;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_659> AgradCcdfLogSkewDoubleExponential_v_659;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_660> AgradCcdfLogSkewDoubleExponential_v_660;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_661> AgradCcdfLogSkewDoubleExponential_v_661;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_662> AgradCcdfLogSkewDoubleExponential_v_662;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_663> AgradCcdfLogSkewDoubleExponential_v_663;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_664> AgradCcdfLogSkewDoubleExponential_v_664;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_665> AgradCcdfLogSkewDoubleExponential_v_665;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_666> AgradCcdfLogSkewDoubleExponential_v_666;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_667> AgradCcdfLogSkewDoubleExponential_v_667;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_668> AgradCcdfLogSkewDoubleExponential_v_668;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_669> AgradCcdfLogSkewDoubleExponential_v_669;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_670> AgradCcdfLogSkewDoubleExponential_v_670;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_671> AgradCcdfLogSkewDoubleExponential_v_671;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_672> AgradCcdfLogSkewDoubleExponential_v_672;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_673> AgradCcdfLogSkewDoubleExponential_v_673;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_674> AgradCcdfLogSkewDoubleExponential_v_674;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_675> AgradCcdfLogSkewDoubleExponential_v_675;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_676> AgradCcdfLogSkewDoubleExponential_v_676;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_677> AgradCcdfLogSkewDoubleExponential_v_677;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_678> AgradCcdfLogSkewDoubleExponential_v_678;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_679> AgradCcdfLogSkewDoubleExponential_v_679;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_680> AgradCcdfLogSkewDoubleExponential_v_680;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_681> AgradCcdfLogSkewDoubleExponential_v_681;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_682> AgradCcdfLogSkewDoubleExponential_v_682;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_683> AgradCcdfLogSkewDoubleExponential_v_683;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_684> AgradCcdfLogSkewDoubleExponential_v_684;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_685> AgradCcdfLogSkewDoubleExponential_v_685;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_686> AgradCcdfLogSkewDoubleExponential_v_686;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_687> AgradCcdfLogSkewDoubleExponential_v_687;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_688> AgradCcdfLogSkewDoubleExponential_v_688;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_689> AgradCcdfLogSkewDoubleExponential_v_689;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_690> AgradCcdfLogSkewDoubleExponential_v_690;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_691> AgradCcdfLogSkewDoubleExponential_v_691;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_692> AgradCcdfLogSkewDoubleExponential_v_692;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_693> AgradCcdfLogSkewDoubleExponential_v_693;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_694> AgradCcdfLogSkewDoubleExponential_v_694;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_695> AgradCcdfLogSkewDoubleExponential_v_695;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_696> AgradCcdfLogSkewDoubleExponential_v_696;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_697> AgradCcdfLogSkewDoubleExponential_v_697;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_698> AgradCcdfLogSkewDoubleExponential_v_698;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_699> AgradCcdfLogSkewDoubleExponential_v_699;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_600, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_600);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_601, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_601);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_602, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_602);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_603, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_603);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_604, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_604);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_605, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_605);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_606, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_606);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_607, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_607);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_608, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_608);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_609, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_609);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_610, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_610);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_611, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_611);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_612, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_612);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_613, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_613);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_614, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_614);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_615, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_615);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_616, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_616);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_617, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_617);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_618, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_618);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_619, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_619);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_620, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_620);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_621, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_621);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_622, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_622);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_623, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_623);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_624, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_624);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_625, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_625);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_626, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_626);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_627, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_627);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_628, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_628);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_629, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_629);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_630, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_630);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_631, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_631);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_632, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_632);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_633, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_633);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_634, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_634);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_635, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_635);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_636, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_636);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_637, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_637);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_638, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_638);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_639, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_639);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_640, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_640);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_641, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_641);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_642, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_642);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_643, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_643);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_644, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_644);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_645, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_645);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_646, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_646);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_647, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_647);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_648, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_648);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_649, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_649);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_650, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_650);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_651, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_651);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_652, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_652);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_653, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_653);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_654, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_654);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_655, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_655);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_656, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_656);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_657, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_657);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_658, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_658);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_659, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_659);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_660, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_660);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_661, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_661);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_662, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_662);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_663, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_663);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_664, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_664);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_665, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_665);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_666, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_666);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_667, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_667);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_668, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_668);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_669, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_669);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_670, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_670);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_671, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_671);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_672, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_672);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_673, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_673);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_674, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_674);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_675, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_675);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_676, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_676);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_677, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_677);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_678, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_678);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_679, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_679);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_680, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_680);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_681, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_681);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_682, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_682);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_683, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_683);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_684, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_684);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_685, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_685);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_686, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_686);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_687, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_687);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_688, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_688);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_689, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_689);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_690, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_690);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_691, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_691);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_692, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_692);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_693, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_693);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_694, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_694);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_695, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_695);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_696, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_696);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_697, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_697);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_698, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_698);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_699, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_699);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/skew_double_exponential/skew_double_exponential_ccdf_log_test.hpp>
+
+typedef std::tuple<var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_600;
+typedef std::tuple<var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_601;
+typedef std::tuple<var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_602;
+typedef std::tuple<var, std::vector<double>, double, double, empty, empty> type_vv_603;
+typedef std::tuple<var, std::vector<double>, double, std::vector<double>, empty, empty> type_vv_604;
+typedef std::tuple<var, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_605;
+typedef std::tuple<var, std::vector<double>, double, var, empty, empty> type_vv_606;
+typedef std::tuple<var, std::vector<double>, double, std::vector<var>, empty, empty> type_vv_607;
+typedef std::tuple<var, std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_608;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, double, empty, empty> type_vv_609;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, std::vector<double>, empty, empty> type_vv_610;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_611;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, var, empty, empty> type_vv_612;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_vv_613;
+typedef std::tuple<var, std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_614;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_615;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_616;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_617;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_618;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_619;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_620;
+typedef std::tuple<var, std::vector<double>, var, double, empty, empty> type_vv_621;
+typedef std::tuple<var, std::vector<double>, var, std::vector<double>, empty, empty> type_vv_622;
+typedef std::tuple<var, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_623;
+typedef std::tuple<var, std::vector<double>, var, var, empty, empty> type_vv_624;
+typedef std::tuple<var, std::vector<double>, var, std::vector<var>, empty, empty> type_vv_625;
+typedef std::tuple<var, std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_626;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, double, empty, empty> type_vv_627;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_vv_628;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_629;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, var, empty, empty> type_vv_630;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_vv_631;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_632;
+typedef std::tuple<var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_633;
+typedef std::tuple<var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_634;
+typedef std::tuple<var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_635;
+typedef std::tuple<var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_636;
+typedef std::tuple<var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_637;
+typedef std::tuple<var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_638;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty> type_vv_639;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_vv_640;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_641;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_vv_642;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_vv_643;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_644;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_vv_645;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_vv_646;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_647;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_vv_648;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_vv_649;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_650;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_651;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_652;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_653;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_654;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_655;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_656;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_vv_657;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_vv_658;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_659;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_vv_660;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_vv_661;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_662;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_vv_663;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_vv_664;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_665;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_vv_666;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_vv_667;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_668;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_669;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_670;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_671;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_672;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_673;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_674;
+typedef std::tuple<var, var, double, double, empty, empty> type_vv_675;
+typedef std::tuple<var, var, double, std::vector<double>, empty, empty> type_vv_676;
+typedef std::tuple<var, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_677;
+typedef std::tuple<var, var, double, var, empty, empty> type_vv_678;
+typedef std::tuple<var, var, double, std::vector<var>, empty, empty> type_vv_679;
+typedef std::tuple<var, var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_680;
+typedef std::tuple<var, var, std::vector<double>, double, empty, empty> type_vv_681;
+typedef std::tuple<var, var, std::vector<double>, std::vector<double>, empty, empty> type_vv_682;
+typedef std::tuple<var, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_683;
+typedef std::tuple<var, var, std::vector<double>, var, empty, empty> type_vv_684;
+typedef std::tuple<var, var, std::vector<double>, std::vector<var>, empty, empty> type_vv_685;
+typedef std::tuple<var, var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_686;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_687;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_688;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_689;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_690;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_691;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_692;
+typedef std::tuple<var, var, var, double, empty, empty> type_vv_693;
+typedef std::tuple<var, var, var, std::vector<double>, empty, empty> type_vv_694;
+typedef std::tuple<var, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_695;
+typedef std::tuple<var, var, var, var, empty, empty> type_vv_696;
+typedef std::tuple<var, var, var, std::vector<var>, empty, empty> type_vv_697;
+typedef std::tuple<var, var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_698;
+typedef std::tuple<var, var, std::vector<var>, double, empty, empty> type_vv_699;
+
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_600> AgradCcdfLogSkewDoubleExponential_vv_600;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_601> AgradCcdfLogSkewDoubleExponential_vv_601;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_602> AgradCcdfLogSkewDoubleExponential_vv_602;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_603> AgradCcdfLogSkewDoubleExponential_vv_603;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_604> AgradCcdfLogSkewDoubleExponential_vv_604;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_605> AgradCcdfLogSkewDoubleExponential_vv_605;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_606> AgradCcdfLogSkewDoubleExponential_vv_606;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_607> AgradCcdfLogSkewDoubleExponential_vv_607;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_608> AgradCcdfLogSkewDoubleExponential_vv_608;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_609> AgradCcdfLogSkewDoubleExponential_vv_609;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_610> AgradCcdfLogSkewDoubleExponential_vv_610;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_611> AgradCcdfLogSkewDoubleExponential_vv_611;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_612> AgradCcdfLogSkewDoubleExponential_vv_612;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_613> AgradCcdfLogSkewDoubleExponential_vv_613;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_614> AgradCcdfLogSkewDoubleExponential_vv_614;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_615> AgradCcdfLogSkewDoubleExponential_vv_615;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_616> AgradCcdfLogSkewDoubleExponential_vv_616;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_617> AgradCcdfLogSkewDoubleExponential_vv_617;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_618> AgradCcdfLogSkewDoubleExponential_vv_618;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_619> AgradCcdfLogSkewDoubleExponential_vv_619;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_620> AgradCcdfLogSkewDoubleExponential_vv_620;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_621> AgradCcdfLogSkewDoubleExponential_vv_621;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_622> AgradCcdfLogSkewDoubleExponential_vv_622;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_623> AgradCcdfLogSkewDoubleExponential_vv_623;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_624> AgradCcdfLogSkewDoubleExponential_vv_624;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_625> AgradCcdfLogSkewDoubleExponential_vv_625;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_626> AgradCcdfLogSkewDoubleExponential_vv_626;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_627> AgradCcdfLogSkewDoubleExponential_vv_627;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_628> AgradCcdfLogSkewDoubleExponential_vv_628;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_629> AgradCcdfLogSkewDoubleExponential_vv_629;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_630> AgradCcdfLogSkewDoubleExponential_vv_630;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_631> AgradCcdfLogSkewDoubleExponential_vv_631;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_632> AgradCcdfLogSkewDoubleExponential_vv_632;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_633> AgradCcdfLogSkewDoubleExponential_vv_633;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_634> AgradCcdfLogSkewDoubleExponential_vv_634;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_635> AgradCcdfLogSkewDoubleExponential_vv_635;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_636> AgradCcdfLogSkewDoubleExponential_vv_636;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_637> AgradCcdfLogSkewDoubleExponential_vv_637;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_638> AgradCcdfLogSkewDoubleExponential_vv_638;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_639> AgradCcdfLogSkewDoubleExponential_vv_639;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_640> AgradCcdfLogSkewDoubleExponential_vv_640;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_641> AgradCcdfLogSkewDoubleExponential_vv_641;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_642> AgradCcdfLogSkewDoubleExponential_vv_642;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_643> AgradCcdfLogSkewDoubleExponential_vv_643;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_644> AgradCcdfLogSkewDoubleExponential_vv_644;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_645> AgradCcdfLogSkewDoubleExponential_vv_645;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_646> AgradCcdfLogSkewDoubleExponential_vv_646;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_647> AgradCcdfLogSkewDoubleExponential_vv_647;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_648> AgradCcdfLogSkewDoubleExponential_vv_648;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_649> AgradCcdfLogSkewDoubleExponential_vv_649;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_650> AgradCcdfLogSkewDoubleExponential_vv_650;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_651> AgradCcdfLogSkewDoubleExponential_vv_651;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_652> AgradCcdfLogSkewDoubleExponential_vv_652;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_653> AgradCcdfLogSkewDoubleExponential_vv_653;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_654> AgradCcdfLogSkewDoubleExponential_vv_654;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_655> AgradCcdfLogSkewDoubleExponential_vv_655;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_656> AgradCcdfLogSkewDoubleExponential_vv_656;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_657> AgradCcdfLogSkewDoubleExponential_vv_657;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_658> AgradCcdfLogSkewDoubleExponential_vv_658;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_659> AgradCcdfLogSkewDoubleExponential_vv_659;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_660> AgradCcdfLogSkewDoubleExponential_vv_660;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_661> AgradCcdfLogSkewDoubleExponential_vv_661;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_662> AgradCcdfLogSkewDoubleExponential_vv_662;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_663> AgradCcdfLogSkewDoubleExponential_vv_663;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_664> AgradCcdfLogSkewDoubleExponential_vv_664;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_665> AgradCcdfLogSkewDoubleExponential_vv_665;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_666> AgradCcdfLogSkewDoubleExponential_vv_666;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_667> AgradCcdfLogSkewDoubleExponential_vv_667;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_668> AgradCcdfLogSkewDoubleExponential_vv_668;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_669> AgradCcdfLogSkewDoubleExponential_vv_669;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_670> AgradCcdfLogSkewDoubleExponential_vv_670;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_671> AgradCcdfLogSkewDoubleExponential_vv_671;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_672> AgradCcdfLogSkewDoubleExponential_vv_672;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_673> AgradCcdfLogSkewDoubleExponential_vv_673;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_674> AgradCcdfLogSkewDoubleExponential_vv_674;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_675> AgradCcdfLogSkewDoubleExponential_vv_675;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_676> AgradCcdfLogSkewDoubleExponential_vv_676;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_677> AgradCcdfLogSkewDoubleExponential_vv_677;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_678> AgradCcdfLogSkewDoubleExponential_vv_678;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_679> AgradCcdfLogSkewDoubleExponential_vv_679;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_680> AgradCcdfLogSkewDoubleExponential_vv_680;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_681> AgradCcdfLogSkewDoubleExponential_vv_681;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_682> AgradCcdfLogSkewDoubleExponential_vv_682;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_683> AgradCcdfLogSkewDoubleExponential_vv_683;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_684> AgradCcdfLogSkewDoubleExponential_vv_684;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_685> AgradCcdfLogSkewDoubleExponential_vv_685;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_686> AgradCcdfLogSkewDoubleExponential_vv_686;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_687> AgradCcdfLogSkewDoubleExponential_vv_687;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_688> AgradCcdfLogSkewDoubleExponential_vv_688;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_689> AgradCcdfLogSkewDoubleExponential_vv_689;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_690> AgradCcdfLogSkewDoubleExponential_vv_690;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_691> AgradCcdfLogSkewDoubleExponential_vv_691;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_692> AgradCcdfLogSkewDoubleExponential_vv_692;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_693> AgradCcdfLogSkewDoubleExponential_vv_693;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_694> AgradCcdfLogSkewDoubleExponential_vv_694;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_695> AgradCcdfLogSkewDoubleExponential_vv_695;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_696> AgradCcdfLogSkewDoubleExponential_vv_696;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_697> AgradCcdfLogSkewDoubleExponential_vv_697;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_698> AgradCcdfLogSkewDoubleExponential_vv_698;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_699> AgradCcdfLogSkewDoubleExponential_vv_699;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_600, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_600);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_601, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_601);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_602, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_602);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_603, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_603);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_604, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_604);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_605, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_605);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_606, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_606);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_607, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_607);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_608, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_608);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_609, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_609);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_610, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_610);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_611, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_611);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_612, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_612);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_613, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_613);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_614, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_614);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_615, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_615);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_616, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_616);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_617, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_617);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_618, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_618);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_619, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_619);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_620, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_620);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_621, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_621);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_622, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_622);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_623, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_623);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_624, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_624);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_625, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_625);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_626, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_626);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_627, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_627);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_628, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_628);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_629, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_629);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_630, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_630);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_631, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_631);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_632, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_632);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_633, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_633);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_634, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_634);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_635, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_635);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_636, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_636);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_637, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_637);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_638, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_638);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_639, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_639);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_640, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_640);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_641, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_641);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_642, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_642);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_643, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_643);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_644, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_644);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_645, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_645);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_646, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_646);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_647, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_647);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_648, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_648);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_649, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_649);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_650, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_650);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_651, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_651);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_652, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_652);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_653, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_653);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_654, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_654);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_655, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_655);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_656, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_656);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_657, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_657);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_658, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_658);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_659, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_659);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_660, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_660);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_661, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_661);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_662, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_662);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_663, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_663);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_664, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_664);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_665, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_665);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_666, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_666);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_667, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_667);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_668, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_668);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_669, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_669);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_670, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_670);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_671, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_671);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_672, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_672);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_673, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_673);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_674, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_674);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_675, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_675);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_676, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_676);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_677, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_677);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_678, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_678);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_679, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_679);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_680, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_680);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_681, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_681);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_682, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_682);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_683, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_683);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_684, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_684);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_685, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_685);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_686, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_686);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_687, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_687);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_688, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_688);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_689, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_689);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_690, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_690);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_691, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_691);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_692, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_692);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_693, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_693);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_694, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_694);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_695, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_695);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_696, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_696);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_697, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_697);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_698, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_698);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_699, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_699);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/skew_double_exponential/skew_double_exponential_ccdf_log_test.hpp>
+
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_700;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_701;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_702;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_703;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_704;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_705;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_706;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_707;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_708;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_709;
+typedef std::tuple<fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_710;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, double, empty, empty> type_ffv_711;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty, empty> type_ffv_712;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_713;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty, empty> type_ffv_714;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_715;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_716;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty, empty> type_ffv_717;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_718;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_719;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_720;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_721;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_722;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_723;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_724;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_725;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_726;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_727;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_728;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty, empty> type_ffv_729;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_730;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_731;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_732;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_733;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_734;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_735;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_736;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_737;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_738;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_739;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_740;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_741;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_742;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_743;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_744;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_745;
+typedef std::tuple<fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_746;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty, empty> type_ffv_747;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_ffv_748;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_749;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_750;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_751;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_752;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_ffv_753;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_754;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_755;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_756;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_757;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_758;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_759;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_760;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_761;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_762;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_763;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_764;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_765;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_766;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_767;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_768;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_769;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_770;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_771;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_772;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_773;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_774;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_775;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_776;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_777;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_778;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_779;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_780;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_781;
+typedef std::tuple<fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_782;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, double, double, empty, empty> type_ffv_783;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, double, std::vector<double>, empty, empty> type_ffv_784;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_785;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, double, fvar<fvar<var> >, empty, empty> type_ffv_786;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_787;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_788;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<double>, double, empty, empty> type_ffv_789;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<double>, std::vector<double>, empty, empty> type_ffv_790;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_791;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_792;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_793;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_794;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_795;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_796;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_797;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_798;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_799;
+
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_700> AgradCcdfLogSkewDoubleExponential_ffv_700;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_701> AgradCcdfLogSkewDoubleExponential_ffv_701;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_702> AgradCcdfLogSkewDoubleExponential_ffv_702;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_703> AgradCcdfLogSkewDoubleExponential_ffv_703;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_704> AgradCcdfLogSkewDoubleExponential_ffv_704;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_705> AgradCcdfLogSkewDoubleExponential_ffv_705;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_706> AgradCcdfLogSkewDoubleExponential_ffv_706;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_707> AgradCcdfLogSkewDoubleExponential_ffv_707;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_708> AgradCcdfLogSkewDoubleExponential_ffv_708;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_709> AgradCcdfLogSkewDoubleExponential_ffv_709;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_710> AgradCcdfLogSkewDoubleExponential_ffv_710;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_711> AgradCcdfLogSkewDoubleExponential_ffv_711;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_712> AgradCcdfLogSkewDoubleExponential_ffv_712;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_713> AgradCcdfLogSkewDoubleExponential_ffv_713;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_714> AgradCcdfLogSkewDoubleExponential_ffv_714;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_715> AgradCcdfLogSkewDoubleExponential_ffv_715;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_716> AgradCcdfLogSkewDoubleExponential_ffv_716;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_717> AgradCcdfLogSkewDoubleExponential_ffv_717;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_718> AgradCcdfLogSkewDoubleExponential_ffv_718;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_719> AgradCcdfLogSkewDoubleExponential_ffv_719;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_720> AgradCcdfLogSkewDoubleExponential_ffv_720;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_721> AgradCcdfLogSkewDoubleExponential_ffv_721;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_722> AgradCcdfLogSkewDoubleExponential_ffv_722;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_723> AgradCcdfLogSkewDoubleExponential_ffv_723;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_724> AgradCcdfLogSkewDoubleExponential_ffv_724;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_725> AgradCcdfLogSkewDoubleExponential_ffv_725;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_726> AgradCcdfLogSkewDoubleExponential_ffv_726;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_727> AgradCcdfLogSkewDoubleExponential_ffv_727;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_728> AgradCcdfLogSkewDoubleExponential_ffv_728;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_729> AgradCcdfLogSkewDoubleExponential_ffv_729;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_730> AgradCcdfLogSkewDoubleExponential_ffv_730;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_731> AgradCcdfLogSkewDoubleExponential_ffv_731;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_732> AgradCcdfLogSkewDoubleExponential_ffv_732;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_733> AgradCcdfLogSkewDoubleExponential_ffv_733;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_734> AgradCcdfLogSkewDoubleExponential_ffv_734;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_735> AgradCcdfLogSkewDoubleExponential_ffv_735;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_736> AgradCcdfLogSkewDoubleExponential_ffv_736;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_737> AgradCcdfLogSkewDoubleExponential_ffv_737;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_738> AgradCcdfLogSkewDoubleExponential_ffv_738;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_739> AgradCcdfLogSkewDoubleExponential_ffv_739;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_740> AgradCcdfLogSkewDoubleExponential_ffv_740;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_741> AgradCcdfLogSkewDoubleExponential_ffv_741;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_742> AgradCcdfLogSkewDoubleExponential_ffv_742;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_743> AgradCcdfLogSkewDoubleExponential_ffv_743;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_744> AgradCcdfLogSkewDoubleExponential_ffv_744;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_745> AgradCcdfLogSkewDoubleExponential_ffv_745;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_746> AgradCcdfLogSkewDoubleExponential_ffv_746;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_747> AgradCcdfLogSkewDoubleExponential_ffv_747;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_748> AgradCcdfLogSkewDoubleExponential_ffv_748;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_749> AgradCcdfLogSkewDoubleExponential_ffv_749;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_750> AgradCcdfLogSkewDoubleExponential_ffv_750;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_751> AgradCcdfLogSkewDoubleExponential_ffv_751;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_752> AgradCcdfLogSkewDoubleExponential_ffv_752;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_753> AgradCcdfLogSkewDoubleExponential_ffv_753;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_754> AgradCcdfLogSkewDoubleExponential_ffv_754;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_755> AgradCcdfLogSkewDoubleExponential_ffv_755;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_756> AgradCcdfLogSkewDoubleExponential_ffv_756;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_757> AgradCcdfLogSkewDoubleExponential_ffv_757;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_758> AgradCcdfLogSkewDoubleExponential_ffv_758;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_759> AgradCcdfLogSkewDoubleExponential_ffv_759;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_760> AgradCcdfLogSkewDoubleExponential_ffv_760;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_761> AgradCcdfLogSkewDoubleExponential_ffv_761;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_762> AgradCcdfLogSkewDoubleExponential_ffv_762;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_763> AgradCcdfLogSkewDoubleExponential_ffv_763;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_764> AgradCcdfLogSkewDoubleExponential_ffv_764;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_765> AgradCcdfLogSkewDoubleExponential_ffv_765;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_766> AgradCcdfLogSkewDoubleExponential_ffv_766;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_767> AgradCcdfLogSkewDoubleExponential_ffv_767;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_768> AgradCcdfLogSkewDoubleExponential_ffv_768;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_769> AgradCcdfLogSkewDoubleExponential_ffv_769;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_770> AgradCcdfLogSkewDoubleExponential_ffv_770;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_771> AgradCcdfLogSkewDoubleExponential_ffv_771;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_772> AgradCcdfLogSkewDoubleExponential_ffv_772;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_773> AgradCcdfLogSkewDoubleExponential_ffv_773;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_774> AgradCcdfLogSkewDoubleExponential_ffv_774;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_775> AgradCcdfLogSkewDoubleExponential_ffv_775;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_776> AgradCcdfLogSkewDoubleExponential_ffv_776;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_777> AgradCcdfLogSkewDoubleExponential_ffv_777;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_778> AgradCcdfLogSkewDoubleExponential_ffv_778;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_779> AgradCcdfLogSkewDoubleExponential_ffv_779;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_780> AgradCcdfLogSkewDoubleExponential_ffv_780;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_781> AgradCcdfLogSkewDoubleExponential_ffv_781;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_782> AgradCcdfLogSkewDoubleExponential_ffv_782;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_783> AgradCcdfLogSkewDoubleExponential_ffv_783;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_784> AgradCcdfLogSkewDoubleExponential_ffv_784;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_785> AgradCcdfLogSkewDoubleExponential_ffv_785;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_786> AgradCcdfLogSkewDoubleExponential_ffv_786;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_787> AgradCcdfLogSkewDoubleExponential_ffv_787;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_788> AgradCcdfLogSkewDoubleExponential_ffv_788;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_789> AgradCcdfLogSkewDoubleExponential_ffv_789;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_790> AgradCcdfLogSkewDoubleExponential_ffv_790;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_791> AgradCcdfLogSkewDoubleExponential_ffv_791;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_792> AgradCcdfLogSkewDoubleExponential_ffv_792;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_793> AgradCcdfLogSkewDoubleExponential_ffv_793;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_794> AgradCcdfLogSkewDoubleExponential_ffv_794;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_795> AgradCcdfLogSkewDoubleExponential_ffv_795;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_796> AgradCcdfLogSkewDoubleExponential_ffv_796;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_797> AgradCcdfLogSkewDoubleExponential_ffv_797;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_798> AgradCcdfLogSkewDoubleExponential_ffv_798;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_799> AgradCcdfLogSkewDoubleExponential_ffv_799;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_700, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_700);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_701, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_701);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_702, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_702);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_703, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_703);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_704, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_704);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_705, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_705);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_706, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_706);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_707, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_707);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_708, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_708);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_709, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_709);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_710, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_710);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_711, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_711);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_712, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_712);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_713, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_713);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_714, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_714);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_715, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_715);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_716, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_716);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_717, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_717);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_718, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_718);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_719, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_719);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_720, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_720);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_721, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_721);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_722, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_722);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_723, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_723);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_724, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_724);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_725, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_725);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_726, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_726);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_727, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_727);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_728, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_728);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_729, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_729);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_730, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_730);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_731, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_731);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_732, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_732);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_733, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_733);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_734, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_734);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_735, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_735);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_736, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_736);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_737, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_737);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_738, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_738);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_739, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_739);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_740, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_740);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_741, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_741);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_742, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_742);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_743, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_743);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_744, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_744);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_745, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_745);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_746, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_746);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_747, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_747);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_748, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_748);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_749, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_749);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_750, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_750);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_751, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_751);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_752, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_752);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_753, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_753);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_754, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_754);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_755, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_755);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_756, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_756);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_757, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_757);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_758, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_758);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_759, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_759);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_760, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_760);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_761, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_761);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_762, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_762);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_763, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_763);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_764, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_764);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_765, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_765);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_766, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_766);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_767, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_767);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_768, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_768);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_769, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_769);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_770, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_770);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_771, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_771);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_772, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_772);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_773, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_773);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_774, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_774);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_775, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_775);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_776, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_776);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_777, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_777);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_778, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_778);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_779, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_779);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_780, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_780);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_781, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_781);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_782, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_782);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_783, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_783);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_784, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_784);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_785, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_785);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_786, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_786);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_787, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_787);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_788, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_788);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_789, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_789);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_790, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_790);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_791, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_791);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_792, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_792);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_793, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_793);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_794, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_794);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_795, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_795);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_796, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_796);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_797, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_797);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_798, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_798);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_799, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_799);
+
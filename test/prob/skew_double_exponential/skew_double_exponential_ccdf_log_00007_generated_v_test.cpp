@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/skew_double_exponential/skew_double_exponential_ccdf_log_test.hpp>
+
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_700;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_701;
+typedef std::tuple<var, std::vector<double>, var, double, empty, empty> type_v_702;
+typedef std::tuple<var, std::vector<double>, var, std::vector<double>, empty, empty> type_v_703;
+typedef std::tuple<var, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_704;
+typedef std::tuple<var, std::vector<double>, var, var, empty, empty> type_v_705;
+typedef std::tuple<var, std::vector<double>, var, std::vector<var>, empty, empty> type_v_706;
+typedef std::tuple<var, std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_707;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, double, empty, empty> type_v_708;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_v_709;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_710;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, var, empty, empty> type_v_711;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_v_712;
+typedef std::tuple<var, std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_713;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_714;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_715;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_716;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_717;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_718;
+typedef std::tuple<var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_719;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_720;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_721;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_722;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_723;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_724;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_725;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_726;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_727;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_728;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_729;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_730;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_731;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_732;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_733;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_734;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_735;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_736;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_737;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_738;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_739;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_740;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_741;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_742;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_743;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_744;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_745;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_746;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_747;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_748;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_749;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_750;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_751;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_752;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_753;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_754;
+typedef std::tuple<var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_755;
+typedef std::tuple<var, var, double, double, empty, empty> type_v_756;
+typedef std::tuple<var, var, double, std::vector<double>, empty, empty> type_v_757;
+typedef std::tuple<var, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_758;
+typedef std::tuple<var, var, double, var, empty, empty> type_v_759;
+typedef std::tuple<var, var, double, std::vector<var>, empty, empty> type_v_760;
+typedef std::tuple<var, var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_761;
+typedef std::tuple<var, var, std::vector<double>, double, empty, empty> type_v_762;
+typedef std::tuple<var, var, std::vector<double>, std::vector<double>, empty, empty> type_v_763;
+typedef std::tuple<var, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_764;
+typedef std::tuple<var, var, std::vector<double>, var, empty, empty> type_v_765;
+typedef std::tuple<var, var, std::vector<double>, std::vector<var>, empty, empty> type_v_766;
+typedef std::tuple<var, var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_767;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_768;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_769;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_770;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_771;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_772;
+typedef std::tuple<var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_773;
+typedef std::tuple<var, var, var, double, empty, empty> type_v_774;
+typedef std::tuple<var, var, var, std::vector<double>, empty, empty> type_v_775;
+typedef std::tuple<var, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_776;
+typedef std::tuple<var, var, var, var, empty, empty> type_v_777;
+typedef std::tuple<var, var, var, std::vector<var>, empty, empty> type_v_778;
+typedef std::tuple<var, var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_779;
+typedef std::tuple<var, var, std::vector<var>, double, empty, empty> type_v_780;
+typedef std::tuple<var, var, std::vector<var>, std::vector<double>, empty, empty> type_v_781;
+typedef std::tuple<var, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_782;
+typedef std::tuple<var, var, std::vector<var>, var, empty, empty> type_v_783;
+typedef std::tuple<var, var, std::vector<var>, std::vector<var>, empty, empty> type_v_784;
+typedef std::tuple<var, var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_785;
+typedef std::tuple<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_786;
+typedef std::tuple<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_787;
+typedef std::tuple<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_788;
+typedef std::tuple<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_789;
+typedef std::tuple<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_790;
+typedef std::tuple<var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_791;
+typedef std::tuple<var, std::vector<var>, double, double, empty, empty> type_v_792;
+typedef std::tuple<var, std::vector<var>, double, std::vector<double>, empty, empty> type_v_793;
+typedef std::tuple<var, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_794;
+typedef std::tuple<var, std::vector<var>, double, var, empty, empty> type_v_795;
+typedef std::tuple<var, std::vector<var>, double, std::vector<var>, empty, empty> type_v_796;
+typedef std::tuple<var, std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_797;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, double, empty, empty> type_v_798;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_v_799;
+
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_700> AgradCcdfLogSkewDoubleExponential_v_700;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_701> AgradCcdfLogSkewDoubleExponential_v_701;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_702> AgradCcdfLogSkewDoubleExponential_v_702;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_703> AgradCcdfLogSkewDoubleExponential_v_703;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_704> AgradCcdfLogSkewDoubleExponential_v_704;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_705> AgradCcdfLogSkewDoubleExponential_v_705;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_706> AgradCcdfLogSkewDoubleExponential_v_706;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_707> AgradCcdfLogSkewDoubleExponential_v_707;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_708> AgradCcdfLogSkewDoubleExponential_v_708;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_709> AgradCcdfLogSkewDoubleExponential_v_709;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_710> AgradCcdfLogSkewDoubleExponential_v_710;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_711> AgradCcdfLogSkewDoubleExponential_v_711;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_712> AgradCcdfLogSkewDoubleExponential_v_712;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_713> AgradCcdfLogSkewDoubleExponential_v_713;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_714> AgradCcdfLogSkewDoubleExponential_v_714;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_715> AgradCcdfLogSkewDoubleExponential_v_715;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_716> AgradCcdfLogSkewDoubleExponential_v_716;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_717> AgradCcdfLogSkewDoubleExponential_v_717;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_718> AgradCcdfLogSkewDoubleExponential_v_718;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_719> AgradCcdfLogSkewDoubleExponential_v_719;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_720> AgradCcdfLogSkewDoubleExponential_v_720;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_721> AgradCcdfLogSkewDoubleExponential_v_721;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_722> AgradCcdfLogSkewDoubleExponential_v_722;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_723> AgradCcdfLogSkewDoubleExponential_v_723;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_724> AgradCcdfLogSkewDoubleExponential_v_724;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_725> AgradCcdfLogSkewDoubleExponential_v_725;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_726> AgradCcdfLogSkewDoubleExponential_v_726;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_727> AgradCcdfLogSkewDoubleExponential_v_727;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_728> AgradCcdfLogSkewDoubleExponential_v_728;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_729> AgradCcdfLogSkewDoubleExponential_v_729;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_730> AgradCcdfLogSkewDoubleExponential_v_730;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_731> AgradCcdfLogSkewDoubleExponential_v_731;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_732> AgradCcdfLogSkewDoubleExponential_v_732;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_733> AgradCcdfLogSkewDoubleExponential_v_733;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_734> AgradCcdfLogSkewDoubleExponential_v_734;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_735> AgradCcdfLogSkewDoubleExponential_v_735;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_736> AgradCcdfLogSkewDoubleExponential_v_736;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_737> AgradCcdfLogSkewDoubleExponential_v_737;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_738> AgradCcdfLogSkewDoubleExponential_v_738;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_739> AgradCcdfLogSkewDoubleExponential_v_739;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_740> AgradCcdfLogSkewDoubleExponential_v_740;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_741> AgradCcdfLogSkewDoubleExponential_v_741;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_742> AgradCcdfLogSkewDoubleExponential_v_742;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_743> AgradCcdfLogSkewDoubleExponential_v_743;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_744> AgradCcdfLogSkewDoubleExponential_v_744;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_745> AgradCcdfLogSkewDoubleExponential_v_745;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_746> AgradCcdfLogSkewDoubleExponential_v_746;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_747> AgradCcdfLogSkewDoubleExponential_v_747;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_748> AgradCcdfLogSkewDoubleExponential_v_748;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_749> AgradCcdfLogSkewDoubleExponential_v_749;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_750> AgradCcdfLogSkewDoubleExponential_v_750;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_751> AgradCcdfLogSkewDoubleExponential_v_751;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_752> AgradCcdfLogSkewDoubleExponential_v_752;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_753> AgradCcdfLogSkewDoubleExponential_v_753;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_754> AgradCcdfLogSkewDoubleExponential_v_754;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_755> AgradCcdfLogSkewDoubleExponential_v_755;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_756> AgradCcdfLogSkewDoubleExponential_v_756;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_757> AgradCcdfLogSkewDoubleExponential_v_757;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_758> AgradCcdfLogSkewDoubleExponential_v_758;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_759> AgradCcdfLogSkewDoubleExponential_v_759;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_760> AgradCcdfLogSkewDoubleExponential_v_760;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_761> AgradCcdfLogSkewDoubleExponential_v_761;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_762> AgradCcdfLogSkewDoubleExponential_v_762;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_763> AgradCcdfLogSkewDoubleExponential_v_763;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_764> AgradCcdfLogSkewDoubleExponential_v_764;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_765> AgradCcdfLogSkewDoubleExponential_v_765;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_766> AgradCcdfLogSkewDoubleExponential_v_766;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_767> AgradCcdfLogSkewDoubleExponential_v_767;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_768> AgradCcdfLogSkewDoubleExponential_v_768;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_769> AgradCcdfLogSkewDoubleExponential_v_769;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_770> AgradCcdfLogSkewDoubleExponential_v_770;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_771> AgradCcdfLogSkewDoubleExponential_v_771;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_772> AgradCcdfLogSkewDoubleExponential_v_772;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_773> AgradCcdfLogSkewDoubleExponential_v_773;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_774> AgradCcdfLogSkewDoubleExponential_v_774;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_775> AgradCcdfLogSkewDoubleExponential_v_775;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_776> AgradCcdfLogSkewDoubleExponential_v_776;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_777> AgradCcdfLogSkewDoubleExponential_v_777;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_778> AgradCcdfLogSkewDoubleExponential_v_778;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_779> AgradCcdfLogSkewDoubleExponential_v_779;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_780> AgradCcdfLogSkewDoubleExponential_v_780;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_781> AgradCcdfLogSkewDoubleExponential_v_781;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_782> AgradCcdfLogSkewDoubleExponential_v_782;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_783> AgradCcdfLogSkewDoubleExponential_v_783;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_784> AgradCcdfLogSkewDoubleExponential_v_784;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_785> AgradCcdfLogSkewDoubleExponential_v_785;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_786> AgradCcdfLogSkewDoubleExponential_v_786;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_787> AgradCcdfLogSkewDoubleExponential_v_787;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_788> AgradCcdfLogSkewDoubleExponential_v_788;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_789> AgradCcdfLogSkewDoubleExponential_v_789;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_790> AgradCcdfLogSkewDoubleExponential_v_790;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_791> AgradCcdfLogSkewDoubleExponential_v_791;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_792> AgradCcdfLogSkewDoubleExponential_v_792;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_793> AgradCcdfLogSkewDoubleExponential_v_793;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_794> AgradCcdfLogSkewDoubleExponential_v_794;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_795> AgradCcdfLogSkewDoubleExponential_v_795;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_796> AgradCcdfLogSkewDoubleExponential_v_796;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_797> AgradCcdfLogSkewDoubleExponential_v_797;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_798> AgradCcdfLogSkewDoubleExponential_v_798;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_799> AgradCcdfLogSkewDoubleExponential_v_799;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_700, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_700);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_701, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_701);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_702, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_702);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_703, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_703);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_704, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_704);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_705, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_705);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_706, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_706);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_707, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_707);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_708, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_708);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_709, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_709);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_710, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_710);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_711, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_711);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_712, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_712);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_713, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_713);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_714, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_714);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_715, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_715);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_716, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_716);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_717, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_717);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_718, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_718);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_719, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_719);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_720, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_720);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_721, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_721);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_722, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_722);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_723, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_723);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_724, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_724);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_725, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_725);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_726, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_726);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_727, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_727);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_728, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_728);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_729, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_729);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_730, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_730);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_731, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_731);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_732, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_732);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_733, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_733);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_734, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_734);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_735, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_735);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_736, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_736);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_737, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_737);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_738, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_738);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_739, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_739);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_740, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_740);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_741, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_741);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_742, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_742);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_743, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_743);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_744, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_744);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_745, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_745);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_746, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_746);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_747, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_747);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_748, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_748);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_749, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_749);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_750, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_750);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_751, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_751);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_752, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_752);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_753, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_753);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_754, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_754);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_755, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_755);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_756, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_756);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_757, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_757);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_758, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_758);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_759, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_759);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_760, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_760);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_761, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_761);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_762, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_762);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_763, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_763);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_764, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_764);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_765, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_765);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_766, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_766);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_767, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_767);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_768, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_768);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_769, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_769);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_770, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_770);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_771, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_771);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_772, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_772);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_773, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_773);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_774, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_774);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_775, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_775);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_776, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_776);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_777, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_777);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_778, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_778);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_779, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_779);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_780, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_780);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_781, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_781);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_782, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_782);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_783, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_783);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_784, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_784);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_785, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_785);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_786, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_786);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_787, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_787);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_788, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_788);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_789, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_789);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_790, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_790);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_791, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_791);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_792, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_792);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_793, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_793);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_794, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_794);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_795, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_795);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_796, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_796);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_797, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_797);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_798, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_798);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_799, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_799);
+
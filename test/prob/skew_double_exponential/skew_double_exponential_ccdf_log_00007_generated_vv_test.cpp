@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/skew_double_exponential/skew_double_exponential_ccdf_log_test.hpp>
+
+typedef std::tuple<var, var, std::vector<var>, std::vector<double>, empty, empty> type_vv_700;
+typedef std::tuple<var, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_701;
+typedef std::tuple<var, var, std::vector<var>, var, empty, empty> type_vv_702;
+typedef std::tuple<var, var, std::vector<var>, std::vector<var>, empty, empty> type_vv_703;
+typedef std::tuple<var, var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_704;
+typedef std::tuple<var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_705;
+typedef std::tuple<var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_706;
+typedef std::tuple<var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_707;
+typedef std::tuple<var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_708;
+typedef std::tuple<var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_709;
+typedef std::tuple<var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_710;
+typedef std::tuple<var, std::vector<var>, double, double, empty, empty> type_vv_711;
+typedef std::tuple<var, std::vector<var>, double, std::vector<double>, empty, empty> type_vv_712;
+typedef std::tuple<var, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_713;
+typedef std::tuple<var, std::vector<var>, double, var, empty, empty> type_vv_714;
+typedef std::tuple<var, std::vector<var>, double, std::vector<var>, empty, empty> type_vv_715;
+typedef std::tuple<var, std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_716;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, double, empty, empty> type_vv_717;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_vv_718;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_719;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, var, empty, empty> type_vv_720;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_vv_721;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_722;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_723;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_724;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_725;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_726;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_727;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_728;
+typedef std::tuple<var, std::vector<var>, var, double, empty, empty> type_vv_729;
+typedef std::tuple<var, std::vector<var>, var, std::vector<double>, empty, empty> type_vv_730;
+typedef std::tuple<var, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_731;
+typedef std::tuple<var, std::vector<var>, var, var, empty, empty> type_vv_732;
+typedef std::tuple<var, std::vector<var>, var, std::vector<var>, empty, empty> type_vv_733;
+typedef std::tuple<var, std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_734;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, double, empty, empty> type_vv_735;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_vv_736;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_737;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, var, empty, empty> type_vv_738;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_vv_739;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_740;
+typedef std::tuple<var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_741;
+typedef std::tuple<var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_742;
+typedef std::tuple<var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_743;
+typedef std::tuple<var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_744;
+typedef std::tuple<var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_745;
+typedef std::tuple<var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_746;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, empty, empty> type_vv_747;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, empty, empty> type_vv_748;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_749;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, empty, empty> type_vv_750;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, empty, empty> type_vv_751;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_752;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, empty, empty> type_vv_753;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, empty, empty> type_vv_754;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_755;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, empty, empty> type_vv_756;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, empty, empty> type_vv_757;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_758;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_759;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_760;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_761;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_762;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_763;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_764;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, empty, empty> type_vv_765;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, empty, empty> type_vv_766;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_767;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, empty, empty> type_vv_768;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, empty, empty> type_vv_769;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_770;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, empty, empty> type_vv_771;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, empty, empty> type_vv_772;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_773;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, empty, empty> type_vv_774;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, empty, empty> type_vv_775;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_776;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_777;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_778;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_779;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_780;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_781;
+typedef std::tuple<var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_782;
+typedef std::tuple<std::vector<var>, double, double, double, empty, empty> type_vv_783;
+typedef std::tuple<std::vector<var>, double, double, std::vector<double>, empty, empty> type_vv_784;
+typedef std::tuple<std::vector<var>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_785;
+typedef std::tuple<std::vector<var>, double, double, var, empty, empty> type_vv_786;
+typedef std::tuple<std::vector<var>, double, double, std::vector<var>, empty, empty> type_vv_787;
+typedef std::tuple<std::vector<var>, double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_788;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, double, empty, empty> type_vv_789;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, std::vector<double>, empty, empty> type_vv_790;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_791;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, var, empty, empty> type_vv_792;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, std::vector<var>, empty, empty> type_vv_793;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_794;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_795;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_796;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_797;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_798;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_799;
+
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_700> AgradCcdfLogSkewDoubleExponential_vv_700;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_701> AgradCcdfLogSkewDoubleExponential_vv_701;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_702> AgradCcdfLogSkewDoubleExponential_vv_702;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_703> AgradCcdfLogSkewDoubleExponential_vv_703;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_704> AgradCcdfLogSkewDoubleExponential_vv_704;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_705> AgradCcdfLogSkewDoubleExponential_vv_705;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_706> AgradCcdfLogSkewDoubleExponential_vv_706;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_707> AgradCcdfLogSkewDoubleExponential_vv_707;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_708> AgradCcdfLogSkewDoubleExponential_vv_708;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_709> AgradCcdfLogSkewDoubleExponential_vv_709;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_710> AgradCcdfLogSkewDoubleExponential_vv_710;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_711> AgradCcdfLogSkewDoubleExponential_vv_711;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_712> AgradCcdfLogSkewDoubleExponential_vv_712;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_713> AgradCcdfLogSkewDoubleExponential_vv_713;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_714> AgradCcdfLogSkewDoubleExponential_vv_714;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_715> AgradCcdfLogSkewDoubleExponential_vv_715;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_716> AgradCcdfLogSkewDoubleExponential_vv_716;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_717> AgradCcdfLogSkewDoubleExponential_vv_717;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_718> AgradCcdfLogSkewDoubleExponential_vv_718;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_719> AgradCcdfLogSkewDoubleExponential_vv_719;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_720> AgradCcdfLogSkewDoubleExponential_vv_720;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_721> AgradCcdfLogSkewDoubleExponential_vv_721;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_722> AgradCcdfLogSkewDoubleExponential_vv_722;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_723> AgradCcdfLogSkewDoubleExponential_vv_723;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_724> AgradCcdfLogSkewDoubleExponential_vv_724;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_725> AgradCcdfLogSkewDoubleExponential_vv_725;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_726> AgradCcdfLogSkewDoubleExponential_vv_726;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_727> AgradCcdfLogSkewDoubleExponential_vv_727;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_728> AgradCcdfLogSkewDoubleExponential_vv_728;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_729> AgradCcdfLogSkewDoubleExponential_vv_729;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_730> AgradCcdfLogSkewDoubleExponential_vv_730;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_731> AgradCcdfLogSkewDoubleExponential_vv_731;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_732> AgradCcdfLogSkewDoubleExponential_vv_732;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_733> AgradCcdfLogSkewDoubleExponential_vv_733;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_734> AgradCcdfLogSkewDoubleExponential_vv_734;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_735> AgradCcdfLogSkewDoubleExponential_vv_735;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_736> AgradCcdfLogSkewDoubleExponential_vv_736;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_737> AgradCcdfLogSkewDoubleExponential_vv_737;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_738> AgradCcdfLogSkewDoubleExponential_vv_738;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_739> AgradCcdfLogSkewDoubleExponential_vv_739;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_740> AgradCcdfLogSkewDoubleExponential_vv_740;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_741> AgradCcdfLogSkewDoubleExponential_vv_741;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_742> AgradCcdfLogSkewDoubleExponential_vv_742;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_743> AgradCcdfLogSkewDoubleExponential_vv_743;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_744> AgradCcdfLogSkewDoubleExponential_vv_744;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_745> AgradCcdfLogSkewDoubleExponential_vv_745;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_746> AgradCcdfLogSkewDoubleExponential_vv_746;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_747> AgradCcdfLogSkewDoubleExponential_vv_747;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_748> AgradCcdfLogSkewDoubleExponential_vv_748;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_749> AgradCcdfLogSkewDoubleExponential_vv_749;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_750> AgradCcdfLogSkewDoubleExponential_vv_750;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_751> AgradCcdfLogSkewDoubleExponential_vv_751;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_752> AgradCcdfLogSkewDoubleExponential_vv_752;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_753> AgradCcdfLogSkewDoubleExponential_vv_753;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_754> AgradCcdfLogSkewDoubleExponential_vv_754;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_755> AgradCcdfLogSkewDoubleExponential_vv_755;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_756> AgradCcdfLogSkewDoubleExponential_vv_756;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_757> AgradCcdfLogSkewDoubleExponential_vv_757;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_758> AgradCcdfLogSkewDoubleExponential_vv_758;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_759> AgradCcdfLogSkewDoubleExponential_vv_759;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_760> AgradCcdfLogSkewDoubleExponential_vv_760;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_761> AgradCcdfLogSkewDoubleExponential_vv_761;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_762> AgradCcdfLogSkewDoubleExponential_vv_762;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_763> AgradCcdfLogSkewDoubleExponential_vv_763;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_764> AgradCcdfLogSkewDoubleExponential_vv_764;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_765> AgradCcdfLogSkewDoubleExponential_vv_765;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_766> AgradCcdfLogSkewDoubleExponential_vv_766;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_767> AgradCcdfLogSkewDoubleExponential_vv_767;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_768> AgradCcdfLogSkewDoubleExponential_vv_768;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_769> AgradCcdfLogSkewDoubleExponential_vv_769;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_770> AgradCcdfLogSkewDoubleExponential_vv_770;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_771> AgradCcdfLogSkewDoubleExponential_vv_771;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_772> AgradCcdfLogSkewDoubleExponential_vv_772;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_773> AgradCcdfLogSkewDoubleExponential_vv_773;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_774> AgradCcdfLogSkewDoubleExponential_vv_774;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_775> AgradCcdfLogSkewDoubleExponential_vv_775;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_776> AgradCcdfLogSkewDoubleExponential_vv_776;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_777> AgradCcdfLogSkewDoubleExponential_vv_777;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_778> AgradCcdfLogSkewDoubleExponential_vv_778;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_779> AgradCcdfLogSkewDoubleExponential_vv_779;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_780> AgradCcdfLogSkewDoubleExponential_vv_780;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_781> AgradCcdfLogSkewDoubleExponential_vv_781;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_782> AgradCcdfLogSkewDoubleExponential_vv_782;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_783> AgradCcdfLogSkewDoubleExponential_vv_783;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_784> AgradCcdfLogSkewDoubleExponential_vv_784;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_785> AgradCcdfLogSkewDoubleExponential_vv_785;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_786> AgradCcdfLogSkewDoubleExponential_vv_786;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_787> AgradCcdfLogSkewDoubleExponential_vv_787;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_788> AgradCcdfLogSkewDoubleExponential_vv_788;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_789> AgradCcdfLogSkewDoubleExponential_vv_789;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_790> AgradCcdfLogSkewDoubleExponential_vv_790;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_791> AgradCcdfLogSkewDoubleExponential_vv_791;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_792> AgradCcdfLogSkewDoubleExponential_vv_792;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_793> AgradCcdfLogSkewDoubleExponential_vv_793;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_794> AgradCcdfLogSkewDoubleExponential_vv_794;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_795> AgradCcdfLogSkewDoubleExponential_vv_795;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_796> AgradCcdfLogSkewDoubleExponential_vv_796;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_797> AgradCcdfLogSkewDoubleExponential_vv_797;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_798> AgradCcdfLogSkewDoubleExponential_vv_798;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_799> AgradCcdfLogSkewDoubleExponential_vv_799;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_700, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_700);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_701, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_701);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_702, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_702);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_703, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_703);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_704, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_704);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_705, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_705);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_706, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_706);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_707, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_707);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_708, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_708);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_709, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_709);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_710, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_710);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_711, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_711);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_712, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_712);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_713, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_713);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_714, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_714);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_715, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_715);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_716, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_716);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_717, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_717);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_718, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_718);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_719, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_719);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_720, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_720);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_721, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_721);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_722, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_722);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_723, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_723);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_724, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_724);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_725, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_725);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_726, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_726);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_727, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_727);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_728, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_728);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_729, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_729);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_730, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_730);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_731, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_731);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_732, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_732);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_733, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_733);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_734, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_734);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_735, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_735);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_736, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_736);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_737, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_737);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_738, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_738);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_739, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_739);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_740, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_740);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_741, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_741);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_742, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_742);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_743, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_743);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_744, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_744);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_745, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_745);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_746, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_746);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_747, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_747);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_748, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_748);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_749, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_749);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_750, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_750);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_751, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_751);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_752, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_752);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_753, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_753);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_754, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_754);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_755, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_755);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_756, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_756);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_757, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_757);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_758, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_758);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_759, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_759);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_760, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_760);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_761, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_761);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_762, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_762);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_763, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_763);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_764, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_764);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_765, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_765);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_766, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_766);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_767, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_767);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_768, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_768);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_769, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_769);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_770, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_770);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_771, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_771);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_772, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_772);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_773, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_773);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_774, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_774);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_775, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_775);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_776, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_776);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_777, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_777);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_778, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_778);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_779, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_779);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_780, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_780);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_781, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_781);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_782, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_782);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_783, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_783);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_784, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_784);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_785, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_785);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_786, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_786);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_787, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_787);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_788, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_788);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_789, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_789);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_790, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_790);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_791, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_791);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_792, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_792);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_793, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_793);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_794, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_794);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_795, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_795);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_796, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_796);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_797, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_797);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_798, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_798);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_799, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_799);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/skew_double_exponential/skew_double_exponential_ccdf_log_test.hpp>
+
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_800;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, double, empty, empty> type_ffv_801;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_802;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_803;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_804;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_805;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_806;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_807;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_808;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_809;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_810;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_811;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_812;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_813;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_814;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_815;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_816;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_817;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_818;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, double, double, empty, empty> type_ffv_819;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, double, std::vector<double>, empty, empty> type_ffv_820;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_821;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, double, fvar<fvar<var> >, empty, empty> type_ffv_822;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_823;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_824;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, double, empty, empty> type_ffv_825;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_826;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_827;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_828;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_829;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_830;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_831;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_832;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_833;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_834;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_835;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_836;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, double, empty, empty> type_ffv_837;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_838;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_839;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_840;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_841;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_842;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_843;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_844;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_845;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_846;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_847;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_848;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_849;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_850;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_851;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_852;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_853;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_854;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty> type_ffv_855;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_ffv_856;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_857;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_858;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_859;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_860;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_ffv_861;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_862;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_863;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_864;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_865;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_866;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_867;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_868;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_869;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_870;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_871;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_872;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_873;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_874;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_875;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_876;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_877;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_878;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_879;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_880;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_881;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_882;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_883;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_884;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_885;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_886;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_887;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_888;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_889;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_890;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, double, empty, empty> type_ffv_891;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, std::vector<double>, empty, empty> type_ffv_892;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_893;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, fvar<fvar<var> >, empty, empty> type_ffv_894;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_895;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_896;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, double, empty, empty> type_ffv_897;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty, empty> type_ffv_898;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_899;
+
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_800> AgradCcdfLogSkewDoubleExponential_ffv_800;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_801> AgradCcdfLogSkewDoubleExponential_ffv_801;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_802> AgradCcdfLogSkewDoubleExponential_ffv_802;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_803> AgradCcdfLogSkewDoubleExponential_ffv_803;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_804> AgradCcdfLogSkewDoubleExponential_ffv_804;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_805> AgradCcdfLogSkewDoubleExponential_ffv_805;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_806> AgradCcdfLogSkewDoubleExponential_ffv_806;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_807> AgradCcdfLogSkewDoubleExponential_ffv_807;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_808> AgradCcdfLogSkewDoubleExponential_ffv_808;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_809> AgradCcdfLogSkewDoubleExponential_ffv_809;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_810> AgradCcdfLogSkewDoubleExponential_ffv_810;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_811> AgradCcdfLogSkewDoubleExponential_ffv_811;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_812> AgradCcdfLogSkewDoubleExponential_ffv_812;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_813> AgradCcdfLogSkewDoubleExponential_ffv_813;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_814> AgradCcdfLogSkewDoubleExponential_ffv_814;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_815> AgradCcdfLogSkewDoubleExponential_ffv_815;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_816> AgradCcdfLogSkewDoubleExponential_ffv_816;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_817> AgradCcdfLogSkewDoubleExponential_ffv_817;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_818> AgradCcdfLogSkewDoubleExponential_ffv_818;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_819> AgradCcdfLogSkewDoubleExponential_ffv_819;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_820> AgradCcdfLogSkewDoubleExponential_ffv_820;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_821> AgradCcdfLogSkewDoubleExponential_ffv_821;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_822> AgradCcdfLogSkewDoubleExponential_ffv_822;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_823> AgradCcdfLogSkewDoubleExponential_ffv_823;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_824> AgradCcdfLogSkewDoubleExponential_ffv_824;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_825> AgradCcdfLogSkewDoubleExponential_ffv_825;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_826> AgradCcdfLogSkewDoubleExponential_ffv_826;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_827> AgradCcdfLogSkewDoubleExponential_ffv_827;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_828> AgradCcdfLogSkewDoubleExponential_ffv_828;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_829> AgradCcdfLogSkewDoubleExponential_ffv_829;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_830> AgradCcdfLogSkewDoubleExponential_ffv_830;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_831> AgradCcdfLogSkewDoubleExponential_ffv_831;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_832> AgradCcdfLogSkewDoubleExponential_ffv_832;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_833> AgradCcdfLogSkewDoubleExponential_ffv_833;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_834> AgradCcdfLogSkewDoubleExponential_ffv_834;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_835> AgradCcdfLogSkewDoubleExponential_ffv_835;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_836> AgradCcdfLogSkewDoubleExponential_ffv_836;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_837> AgradCcdfLogSkewDoubleExponential_ffv_837;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_838> AgradCcdfLogSkewDoubleExponential_ffv_838;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_839> AgradCcdfLogSkewDoubleExponential_ffv_839;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_840> AgradCcdfLogSkewDoubleExponential_ffv_840;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_841> AgradCcdfLogSkewDoubleExponential_ffv_841;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_842> AgradCcdfLogSkewDoubleExponential_ffv_842;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_843> AgradCcdfLogSkewDoubleExponential_ffv_843;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_844> AgradCcdfLogSkewDoubleExponential_ffv_844;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_845> AgradCcdfLogSkewDoubleExponential_ffv_845;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_846> AgradCcdfLogSkewDoubleExponential_ffv_846;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_847> AgradCcdfLogSkewDoubleExponential_ffv_847;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_848> AgradCcdfLogSkewDoubleExponential_ffv_848;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_849> AgradCcdfLogSkewDoubleExponential_ffv_849;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_850> AgradCcdfLogSkewDoubleExponential_ffv_850;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_851> AgradCcdfLogSkewDoubleExponential_ffv_851;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_852> AgradCcdfLogSkewDoubleExponential_ffv_852;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_853> AgradCcdfLogSkewDoubleExponential_ffv_853;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_854> AgradCcdfLogSkewDoubleExponential_ffv_854;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_855> AgradCcdfLogSkewDoubleExponential_ffv_855;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_856> AgradCcdfLogSkewDoubleExponential_ffv_856;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_857> AgradCcdfLogSkewDoubleExponential_ffv_857;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_858> AgradCcdfLogSkewDoubleExponential_ffv_858;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_859> AgradCcdfLogSkewDoubleExponential_ffv_859;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_860> AgradCcdfLogSkewDoubleExponential_ffv_860;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_861> AgradCcdfLogSkewDoubleExponential_ffv_861;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_862> AgradCcdfLogSkewDoubleExponential_ffv_862;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_863> AgradCcdfLogSkewDoubleExponential_ffv_863;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_864> AgradCcdfLogSkewDoubleExponential_ffv_864;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_865> AgradCcdfLogSkewDoubleExponential_ffv_865;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_866> AgradCcdfLogSkewDoubleExponential_ffv_866;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_867> AgradCcdfLogSkewDoubleExponential_ffv_867;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_868> AgradCcdfLogSkewDoubleExponential_ffv_868;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_869> AgradCcdfLogSkewDoubleExponential_ffv_869;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_870> AgradCcdfLogSkewDoubleExponential_ffv_870;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_871> AgradCcdfLogSkewDoubleExponential_ffv_871;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_872> AgradCcdfLogSkewDoubleExponential_ffv_872;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_873> AgradCcdfLogSkewDoubleExponential_ffv_873;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_874> AgradCcdfLogSkewDoubleExponential_ffv_874;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_875> AgradCcdfLogSkewDoubleExponential_ffv_875;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_876> AgradCcdfLogSkewDoubleExponential_ffv_876;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_877> AgradCcdfLogSkewDoubleExponential_ffv_877;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_878> AgradCcdfLogSkewDoubleExponential_ffv_878;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_879> AgradCcdfLogSkewDoubleExponential_ffv_879;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_880> AgradCcdfLogSkewDoubleExponential_ffv_880;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_881> AgradCcdfLogSkewDoubleExponential_ffv_881;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_882> AgradCcdfLogSkewDoubleExponential_ffv_882;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_883> AgradCcdfLogSkewDoubleExponential_ffv_883;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_884> AgradCcdfLogSkewDoubleExponential_ffv_884;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_885> AgradCcdfLogSkewDoubleExponential_ffv_885;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_886> AgradCcdfLogSkewDoubleExponential_ffv_886;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_887> AgradCcdfLogSkewDoubleExponential_ffv_887;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_888> AgradCcdfLogSkewDoubleExponential_ffv_888;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_889> AgradCcdfLogSkewDoubleExponential_ffv_889;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_890> AgradCcdfLogSkewDoubleExponential_ffv_890;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_891> AgradCcdfLogSkewDoubleExponential_ffv_891;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_892> AgradCcdfLogSkewDoubleExponential_ffv_892;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_893> AgradCcdfLogSkewDoubleExponential_ffv_893;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_894> AgradCcdfLogSkewDoubleExponential_ffv_894;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_895> AgradCcdfLogSkewDoubleExponential_ffv_895;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_896> AgradCcdfLogSkewDoubleExponential_ffv_896;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_897> AgradCcdfLogSkewDoubleExponential_ffv_897;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_898> AgradCcdfLogSkewDoubleExponential_ffv_898;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_899> AgradCcdfLogSkewDoubleExponential_ffv_899;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_800, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_800);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_801, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_801);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_802, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_802);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_803, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_803);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_804, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_804);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_805, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_805);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_806, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_806);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_807, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_807);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_808, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_808);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_809, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_809);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_810, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_810);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_811, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_811);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_812, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_812);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_813, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_813);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_814, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_814);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_815, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_815);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_816, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_816);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_817, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_817);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_818, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_818);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_819, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_819);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_820, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_820);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_821, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_821);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_822, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_822);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_823, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_823);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_824, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_824);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_825, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_825);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_826, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_826);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_827, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_827);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_828, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_828);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_829, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_829);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_830, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_830);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_831, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_831);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_832, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_832);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_833, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_833);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_834, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_834);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_835, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_835);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_836, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_836);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_837, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_837);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_838, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_838);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_839, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_839);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_840, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_840);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_841, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_841);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_842, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_842);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_843, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_843);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_844, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_844);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_845, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_845);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_846, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_846);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_847, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_847);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_848, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_848);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_849, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_849);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_850, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_850);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_851, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_851);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_852, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_852);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_853, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_853);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_854, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_854);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_855, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_855);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_856, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_856);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_857, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_857);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_858, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_858);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_859, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_859);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_860, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_860);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_861, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_861);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_862, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_862);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_863, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_863);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_864, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_864);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_865, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_865);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_866, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_866);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_867, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_867);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_868, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_868);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_869, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_869);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_870, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_870);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_871, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_871);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_872, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_872);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_873, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_873);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_874, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_874);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_875, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_875);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_876, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_876);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_877, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_877);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_878, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_878);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_879, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_879);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_880, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_880);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_881, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_881);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_882, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_882);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_883, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_883);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_884, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_884);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_885, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_885);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_886, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_886);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_887, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_887);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_888, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_888);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_889, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_889);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_890, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_890);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_891, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_891);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_892, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_892);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_893, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_893);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_894, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_894);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_895, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_895);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_896, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_896);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_897, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_897);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_898, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_898);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_899, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_899);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/skew_double_exponential/skew_double_exponential_ccdf_log_test.hpp>
+
+typedef std::tuple<var, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_800;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, var, empty, empty> type_v_801;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_v_802;
+typedef std::tuple<var, std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_803;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_804;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_805;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_806;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_807;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_808;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_809;
+typedef std::tuple<var, std::vector<var>, var, double, empty, empty> type_v_810;
+typedef std::tuple<var, std::vector<var>, var, std::vector<double>, empty, empty> type_v_811;
+typedef std::tuple<var, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_812;
+typedef std::tuple<var, std::vector<var>, var, var, empty, empty> type_v_813;
+typedef std::tuple<var, std::vector<var>, var, std::vector<var>, empty, empty> type_v_814;
+typedef std::tuple<var, std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_815;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, double, empty, empty> type_v_816;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_v_817;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_818;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, var, empty, empty> type_v_819;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_v_820;
+typedef std::tuple<var, std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_821;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_822;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_823;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_824;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_825;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_826;
+typedef std::tuple<var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_827;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_828;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_829;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_830;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_831;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_832;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_833;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_834;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_835;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_836;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_837;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_838;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_839;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_840;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_841;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_842;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_843;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_844;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_845;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_846;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_847;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_848;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_849;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_850;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_851;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_852;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_853;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_854;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_855;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_856;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_857;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_858;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_859;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_860;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_861;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_862;
+typedef std::tuple<var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_863;
+typedef std::tuple<std::vector<var>, double, double, double, empty, empty> type_v_864;
+typedef std::tuple<std::vector<var>, double, double, std::vector<double>, empty, empty> type_v_865;
+typedef std::tuple<std::vector<var>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_866;
+typedef std::tuple<std::vector<var>, double, double, var, empty, empty> type_v_867;
+typedef std::tuple<std::vector<var>, double, double, std::vector<var>, empty, empty> type_v_868;
+typedef std::tuple<std::vector<var>, double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_869;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, double, empty, empty> type_v_870;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, std::vector<double>, empty, empty> type_v_871;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_872;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, var, empty, empty> type_v_873;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, std::vector<var>, empty, empty> type_v_874;
+typedef std::tuple<std::vector<var>, double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_875;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_876;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_877;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_878;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_879;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_880;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_881;
+typedef std::tuple<std::vector<var>, double, var, double, empty, empty> type_v_882;
+typedef std::tuple<std::vector<var>, double, var, std::vector<double>, empty, empty> type_v_883;
+typedef std::tuple<std::vector<var>, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_884;
+typedef std::tuple<std::vector<var>, double, var, var, empty, empty> type_v_885;
+typedef std::tuple<std::vector<var>, double, var, std::vector<var>, empty, empty> type_v_886;
+typedef std::tuple<std::vector<var>, double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_887;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, double, empty, empty> type_v_888;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, std::vector<double>, empty, empty> type_v_889;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_890;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, var, empty, empty> type_v_891;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, std::vector<var>, empty, empty> type_v_892;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_893;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_894;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_895;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_896;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_897;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_898;
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_899;
+
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_800> AgradCcdfLogSkewDoubleExponential_v_800;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_801> AgradCcdfLogSkewDoubleExponential_v_801;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_802> AgradCcdfLogSkewDoubleExponential_v_802;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_803> AgradCcdfLogSkewDoubleExponential_v_803;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_804> AgradCcdfLogSkewDoubleExponential_v_804;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_805> AgradCcdfLogSkewDoubleExponential_v_805;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_806> AgradCcdfLogSkewDoubleExponential_v_806;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_807> AgradCcdfLogSkewDoubleExponential_v_807;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_808> AgradCcdfLogSkewDoubleExponential_v_808;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_809> AgradCcdfLogSkewDoubleExponential_v_809;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_810> AgradCcdfLogSkewDoubleExponential_v_810;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_811> AgradCcdfLogSkewDoubleExponential_v_811;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_812> AgradCcdfLogSkewDoubleExponential_v_812;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_813> AgradCcdfLogSkewDoubleExponential_v_813;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_814> AgradCcdfLogSkewDoubleExponential_v_814;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_815> AgradCcdfLogSkewDoubleExponential_v_815;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_816> AgradCcdfLogSkewDoubleExponential_v_816;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_817> AgradCcdfLogSkewDoubleExponential_v_817;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_818> AgradCcdfLogSkewDoubleExponential_v_818;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_819> AgradCcdfLogSkewDoubleExponential_v_819;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_820> AgradCcdfLogSkewDoubleExponential_v_820;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_821> AgradCcdfLogSkewDoubleExponential_v_821;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_822> AgradCcdfLogSkewDoubleExponential_v_822;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_823> AgradCcdfLogSkewDoubleExponential_v_823;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_824> AgradCcdfLogSkewDoubleExponential_v_824;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_825> AgradCcdfLogSkewDoubleExponential_v_825;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_826> AgradCcdfLogSkewDoubleExponential_v_826;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_827> AgradCcdfLogSkewDoubleExponential_v_827;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_828> AgradCcdfLogSkewDoubleExponential_v_828;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_829> AgradCcdfLogSkewDoubleExponential_v_829;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_830> AgradCcdfLogSkewDoubleExponential_v_830;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_831> AgradCcdfLogSkewDoubleExponential_v_831;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_832> AgradCcdfLogSkewDoubleExponential_v_832;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_833> AgradCcdfLogSkewDoubleExponential_v_833;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_834> AgradCcdfLogSkewDoubleExponential_v_834;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_835> AgradCcdfLogSkewDoubleExponential_v_835;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_836> AgradCcdfLogSkewDoubleExponential_v_836;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_837> AgradCcdfLogSkewDoubleExponential_v_837;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_838> AgradCcdfLogSkewDoubleExponential_v_838;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_839> AgradCcdfLogSkewDoubleExponential_v_839;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_840> AgradCcdfLogSkewDoubleExponential_v_840;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_841> AgradCcdfLogSkewDoubleExponential_v_841;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_842> AgradCcdfLogSkewDoubleExponential_v_842;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_843> AgradCcdfLogSkewDoubleExponential_v_843;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_844> AgradCcdfLogSkewDoubleExponential_v_844;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_845> AgradCcdfLogSkewDoubleExponential_v_845;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_846> AgradCcdfLogSkewDoubleExponential_v_846;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_847> AgradCcdfLogSkewDoubleExponential_v_847;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_848> AgradCcdfLogSkewDoubleExponential_v_848;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_849> AgradCcdfLogSkewDoubleExponential_v_849;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_850> AgradCcdfLogSkewDoubleExponential_v_850;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_851> AgradCcdfLogSkewDoubleExponential_v_851;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_852> AgradCcdfLogSkewDoubleExponential_v_852;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_853> AgradCcdfLogSkewDoubleExponential_v_853;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_854> AgradCcdfLogSkewDoubleExponential_v_854;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_855> AgradCcdfLogSkewDoubleExponential_v_855;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_856> AgradCcdfLogSkewDoubleExponential_v_856;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_857> AgradCcdfLogSkewDoubleExponential_v_857;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_858> AgradCcdfLogSkewDoubleExponential_v_858;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_859> AgradCcdfLogSkewDoubleExponential_v_859;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_860> AgradCcdfLogSkewDoubleExponential_v_860;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_861> AgradCcdfLogSkewDoubleExponential_v_861;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_862> AgradCcdfLogSkewDoubleExponential_v_862;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_863> AgradCcdfLogSkewDoubleExponential_v_863;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_864> AgradCcdfLogSkewDoubleExponential_v_864;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_865> AgradCcdfLogSkewDoubleExponential_v_865;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_866> AgradCcdfLogSkewDoubleExponential_v_866;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_867> AgradCcdfLogSkewDoubleExponential_v_867;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_868> AgradCcdfLogSkewDoubleExponential_v_868;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_869> AgradCcdfLogSkewDoubleExponential_v_869;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_870> AgradCcdfLogSkewDoubleExponential_v_870;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_871> AgradCcdfLogSkewDoubleExponential_v_871;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_872> AgradCcdfLogSkewDoubleExponential_v_872;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_873> AgradCcdfLogSkewDoubleExponential_v_873;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_874> AgradCcdfLogSkewDoubleExponential_v_874;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_875> AgradCcdfLogSkewDoubleExponential_v_875;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_876> AgradCcdfLogSkewDoubleExponential_v_876;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_877> AgradCcdfLogSkewDoubleExponential_v_877;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_878> AgradCcdfLogSkewDoubleExponential_v_878;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_879> AgradCcdfLogSkewDoubleExponential_v_879;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_880> AgradCcdfLogSkewDoubleExponential_v_880;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_881> AgradCcdfLogSkewDoubleExponential_v_881;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_882> AgradCcdfLogSkewDoubleExponential_v_882;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_883> AgradCcdfLogSkewDoubleExponential_v_883;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_884> AgradCcdfLogSkewDoubleExponential_v_884;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_885> AgradCcdfLogSkewDoubleExponential_v_885;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_886> AgradCcdfLogSkewDoubleExponential_v_886;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_887> AgradCcdfLogSkewDoubleExponential_v_887;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_888> AgradCcdfLogSkewDoubleExponential_v_888;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_889> AgradCcdfLogSkewDoubleExponential_v_889;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_890> AgradCcdfLogSkewDoubleExponential_v_890;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_891> AgradCcdfLogSkewDoubleExponential_v_891;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_892> AgradCcdfLogSkewDoubleExponential_v_892;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_893> AgradCcdfLogSkewDoubleExponential_v_893;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_894> AgradCcdfLogSkewDoubleExponential_v_894;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_895> AgradCcdfLogSkewDoubleExponential_v_895;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_896> AgradCcdfLogSkewDoubleExponential_v_896;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_897> AgradCcdfLogSkewDoubleExponential_v_897;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_898> AgradCcdfLogSkewDoubleExponential_v_898;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_899> AgradCcdfLogSkewDoubleExponential_v_899;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_800, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_800);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_801, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_801);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_802, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_802);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_803, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_803);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_804, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_804);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_805, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_805);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_806, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_806);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_807, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_807);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_808, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_808);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_809, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_809);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_810, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_810);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_811, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_811);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_812, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_812);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_813, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_813);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_814, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_814);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_815, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_815);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_816, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_816);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_817, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_817);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_818, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_818);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_819, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_819);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_820, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_820);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_821, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_821);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_822, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_822);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_823, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_823);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_824, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_824);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_825, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_825);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_826, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_826);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_827, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_827);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_828, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_828);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_829, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_829);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_830, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_830);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_831, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_831);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_832, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_832);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_833, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_833);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_834, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_834);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_835, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_835);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_836, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_836);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_837, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_837);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_838, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_838);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_839, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_839);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_840, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_840);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_841, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_841);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_842, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_842);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_843, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_843);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_844, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_844);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_845, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_845);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_846, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_846);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_847, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_847);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_848, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_848);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_849, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_849);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_850, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_850);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_851, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_851);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_852, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_852);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_853, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_853);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_854, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_854);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_855, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_855);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_856, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_856);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_857, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_857);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_858, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_858);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_859, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_859);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_860, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_860);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_861, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_861);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_862, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_862);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_863, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_863);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_864, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_864);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_865, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_865);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_866, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_866);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_867, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_867);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_868, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_868);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_869, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_869);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_870, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_870);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_871, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_871);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_872, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_872);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_873, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_873);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_874, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_874);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_875, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_875);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_876, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_876);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_877, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_877);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_878, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_878);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_879, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_879);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_880, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_880);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_881, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_881);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_882, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_882);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_883, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_883);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_884, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_884);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_885, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_885);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_886, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_886);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_887, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_887);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_888, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_888);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_889, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_889);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_890, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_890);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_891, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_891);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_892, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_892);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_893, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_893);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_894, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_894);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_895, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_895);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_896, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_896);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_897, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_897);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_898, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_898);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_899, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_899);
+
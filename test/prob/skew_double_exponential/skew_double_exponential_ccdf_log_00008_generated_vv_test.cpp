@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/skew_double_exponential/skew_double_exponential_ccdf_log_test.hpp>
+
+typedef std::tuple<std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_800;
+typedef std::tuple<std::vector<var>, double, var, double, empty, empty> type_vv_801;
+typedef std::tuple<std::vector<var>, double, var, std::vector<double>, empty, empty> type_vv_802;
+typedef std::tuple<std::vector<var>, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_803;
+typedef std::tuple<std::vector<var>, double, var, var, empty, empty> type_vv_804;
+typedef std::tuple<std::vector<var>, double, var, std::vector<var>, empty, empty> type_vv_805;
+typedef std::tuple<std::vector<var>, double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_806;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, double, empty, empty> type_vv_807;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, std::vector<double>, empty, empty> type_vv_808;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_809;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, var, empty, empty> type_vv_810;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, std::vector<var>, empty, empty> type_vv_811;
+typedef std::tuple<std::vector<var>, double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_812;
+typedef std::tuple<std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_813;
+typedef std::tuple<std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_814;
+typedef std::tuple<std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_815;
+typedef std::tuple<std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_816;
+typedef std::tuple<std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_817;
+typedef std::tuple<std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_818;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, double, empty, empty> type_vv_819;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, std::vector<double>, empty, empty> type_vv_820;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_821;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, var, empty, empty> type_vv_822;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, std::vector<var>, empty, empty> type_vv_823;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_824;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, double, empty, empty> type_vv_825;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, std::vector<double>, empty, empty> type_vv_826;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_827;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, var, empty, empty> type_vv_828;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_vv_829;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_830;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_831;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_832;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_833;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_834;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_835;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_836;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, double, empty, empty> type_vv_837;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, std::vector<double>, empty, empty> type_vv_838;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_839;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, var, empty, empty> type_vv_840;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, std::vector<var>, empty, empty> type_vv_841;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_842;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, double, empty, empty> type_vv_843;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_vv_844;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_845;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, var, empty, empty> type_vv_846;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_vv_847;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_848;
+typedef std::tuple<std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_849;
+typedef std::tuple<std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_850;
+typedef std::tuple<std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_851;
+typedef std::tuple<std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_852;
+typedef std::tuple<std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_853;
+typedef std::tuple<std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_854;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty> type_vv_855;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_vv_856;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_857;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_vv_858;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_vv_859;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_860;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_vv_861;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_vv_862;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_863;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_vv_864;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_vv_865;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_866;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_867;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_868;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_869;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_870;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_871;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_872;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_vv_873;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_vv_874;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_875;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_vv_876;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_vv_877;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_878;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_vv_879;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_vv_880;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_881;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_vv_882;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_vv_883;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_884;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_885;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_886;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_887;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_888;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_889;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_890;
+typedef std::tuple<std::vector<var>, var, double, double, empty, empty> type_vv_891;
+typedef std::tuple<std::vector<var>, var, double, std::vector<double>, empty, empty> type_vv_892;
+typedef std::tuple<std::vector<var>, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_893;
+typedef std::tuple<std::vector<var>, var, double, var, empty, empty> type_vv_894;
+typedef std::tuple<std::vector<var>, var, double, std::vector<var>, empty, empty> type_vv_895;
+typedef std::tuple<std::vector<var>, var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_896;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, double, empty, empty> type_vv_897;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, std::vector<double>, empty, empty> type_vv_898;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_899;
+
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_800> AgradCcdfLogSkewDoubleExponential_vv_800;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_801> AgradCcdfLogSkewDoubleExponential_vv_801;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_802> AgradCcdfLogSkewDoubleExponential_vv_802;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_803> AgradCcdfLogSkewDoubleExponential_vv_803;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_804> AgradCcdfLogSkewDoubleExponential_vv_804;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_805> AgradCcdfLogSkewDoubleExponential_vv_805;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_806> AgradCcdfLogSkewDoubleExponential_vv_806;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_807> AgradCcdfLogSkewDoubleExponential_vv_807;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_808> AgradCcdfLogSkewDoubleExponential_vv_808;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_809> AgradCcdfLogSkewDoubleExponential_vv_809;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_810> AgradCcdfLogSkewDoubleExponential_vv_810;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_811> AgradCcdfLogSkewDoubleExponential_vv_811;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_812> AgradCcdfLogSkewDoubleExponential_vv_812;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_813> AgradCcdfLogSkewDoubleExponential_vv_813;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_814> AgradCcdfLogSkewDoubleExponential_vv_814;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_815> AgradCcdfLogSkewDoubleExponential_vv_815;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_816> AgradCcdfLogSkewDoubleExponential_vv_816;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_817> AgradCcdfLogSkewDoubleExponential_vv_817;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_818> AgradCcdfLogSkewDoubleExponential_vv_818;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_819> AgradCcdfLogSkewDoubleExponential_vv_819;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_820> AgradCcdfLogSkewDoubleExponential_vv_820;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_821> AgradCcdfLogSkewDoubleExponential_vv_821;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_822> AgradCcdfLogSkewDoubleExponential_vv_822;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_823> AgradCcdfLogSkewDoubleExponential_vv_823;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_824> AgradCcdfLogSkewDoubleExponential_vv_824;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_825> AgradCcdfLogSkewDoubleExponential_vv_825;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_826> AgradCcdfLogSkewDoubleExponential_vv_826;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_827> AgradCcdfLogSkewDoubleExponential_vv_827;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_828> AgradCcdfLogSkewDoubleExponential_vv_828;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_829> AgradCcdfLogSkewDoubleExponential_vv_829;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_830> AgradCcdfLogSkewDoubleExponential_vv_830;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_831> AgradCcdfLogSkewDoubleExponential_vv_831;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_832> AgradCcdfLogSkewDoubleExponential_vv_832;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_833> AgradCcdfLogSkewDoubleExponential_vv_833;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_834> AgradCcdfLogSkewDoubleExponential_vv_834;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_835> AgradCcdfLogSkewDoubleExponential_vv_835;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_836> AgradCcdfLogSkewDoubleExponential_vv_836;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_837> AgradCcdfLogSkewDoubleExponential_vv_837;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_838> AgradCcdfLogSkewDoubleExponential_vv_838;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_839> AgradCcdfLogSkewDoubleExponential_vv_839;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_840> AgradCcdfLogSkewDoubleExponential_vv_840;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_841> AgradCcdfLogSkewDoubleExponential_vv_841;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_842> AgradCcdfLogSkewDoubleExponential_vv_842;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_843> AgradCcdfLogSkewDoubleExponential_vv_843;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_844> AgradCcdfLogSkewDoubleExponential_vv_844;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_845> AgradCcdfLogSkewDoubleExponential_vv_845;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_846> AgradCcdfLogSkewDoubleExponential_vv_846;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_847> AgradCcdfLogSkewDoubleExponential_vv_847;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_848> AgradCcdfLogSkewDoubleExponential_vv_848;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_849> AgradCcdfLogSkewDoubleExponential_vv_849;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_850> AgradCcdfLogSkewDoubleExponential_vv_850;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_851> AgradCcdfLogSkewDoubleExponential_vv_851;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_852> AgradCcdfLogSkewDoubleExponential_vv_852;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_853> AgradCcdfLogSkewDoubleExponential_vv_853;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_854> AgradCcdfLogSkewDoubleExponential_vv_854;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_855> AgradCcdfLogSkewDoubleExponential_vv_855;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_856> AgradCcdfLogSkewDoubleExponential_vv_856;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_857> AgradCcdfLogSkewDoubleExponential_vv_857;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_858> AgradCcdfLogSkewDoubleExponential_vv_858;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_859> AgradCcdfLogSkewDoubleExponential_vv_859;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_860> AgradCcdfLogSkewDoubleExponential_vv_860;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_861> AgradCcdfLogSkewDoubleExponential_vv_861;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_862> AgradCcdfLogSkewDoubleExponential_vv_862;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_863> AgradCcdfLogSkewDoubleExponential_vv_863;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_864> AgradCcdfLogSkewDoubleExponential_vv_864;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_865> AgradCcdfLogSkewDoubleExponential_vv_865;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_866> AgradCcdfLogSkewDoubleExponential_vv_866;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_867> AgradCcdfLogSkewDoubleExponential_vv_867;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_868> AgradCcdfLogSkewDoubleExponential_vv_868;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_869> AgradCcdfLogSkewDoubleExponential_vv_869;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_870> AgradCcdfLogSkewDoubleExponential_vv_870;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_871> AgradCcdfLogSkewDoubleExponential_vv_871;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_872> AgradCcdfLogSkewDoubleExponential_vv_872;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_873> AgradCcdfLogSkewDoubleExponential_vv_873;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_874> AgradCcdfLogSkewDoubleExponential_vv_874;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_875> AgradCcdfLogSkewDoubleExponential_vv_875;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_876> AgradCcdfLogSkewDoubleExponential_vv_876;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_877> AgradCcdfLogSkewDoubleExponential_vv_877;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_878> AgradCcdfLogSkewDoubleExponential_vv_878;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_879> AgradCcdfLogSkewDoubleExponential_vv_879;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_880> AgradCcdfLogSkewDoubleExponential_vv_880;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_881> AgradCcdfLogSkewDoubleExponential_vv_881;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_882> AgradCcdfLogSkewDoubleExponential_vv_882;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_883> AgradCcdfLogSkewDoubleExponential_vv_883;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_884> AgradCcdfLogSkewDoubleExponential_vv_884;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_885> AgradCcdfLogSkewDoubleExponential_vv_885;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_886> AgradCcdfLogSkewDoubleExponential_vv_886;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_887> AgradCcdfLogSkewDoubleExponential_vv_887;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_888> AgradCcdfLogSkewDoubleExponential_vv_888;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_889> AgradCcdfLogSkewDoubleExponential_vv_889;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_890> AgradCcdfLogSkewDoubleExponential_vv_890;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_891> AgradCcdfLogSkewDoubleExponential_vv_891;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_892> AgradCcdfLogSkewDoubleExponential_vv_892;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_893> AgradCcdfLogSkewDoubleExponential_vv_893;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_894> AgradCcdfLogSkewDoubleExponential_vv_894;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_895> AgradCcdfLogSkewDoubleExponential_vv_895;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_896> AgradCcdfLogSkewDoubleExponential_vv_896;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_897> AgradCcdfLogSkewDoubleExponential_vv_897;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_898> AgradCcdfLogSkewDoubleExponential_vv_898;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_899> AgradCcdfLogSkewDoubleExponential_vv_899;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_800, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_800);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_801, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_801);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_802, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_802);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_803, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_803);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_804, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_804);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_805, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_805);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_806, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_806);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_807, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_807);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_808, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_808);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_809, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_809);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_810, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_810);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_811, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_811);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_812, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_812);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_813, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_813);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_814, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_814);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_815, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_815);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_816, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_816);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_817, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_817);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_818, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_818);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_819, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_819);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_820, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_820);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_821, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_821);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_822, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_822);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_823, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_823);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_824, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_824);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_825, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_825);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_826, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_826);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_827, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_827);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_828, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_828);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_829, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_829);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_830, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_830);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_831, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_831);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_832, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_832);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_833, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_833);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_834, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_834);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_835, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_835);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_836, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_836);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_837, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_837);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_838, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_838);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_839, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_839);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_840, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_840);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_841, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_841);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_842, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_842);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_843, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_843);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_844, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_844);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_845, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_845);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_846, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_846);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_847, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_847);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_848, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_848);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_849, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_849);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_850, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_850);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_851, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_851);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_852, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_852);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_853, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_853);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_854, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_854);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_855, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_855);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_856, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_856);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_857, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_857);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_858, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_858);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_859, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_859);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_860, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_860);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_861, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_861);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_862, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_862);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_863, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_863);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_864, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_864);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_865, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_865);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_866, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_866);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_867, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_867);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_868, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_868);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_869, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_869);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_870, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_870);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_871, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_871);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_872, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_872);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_873, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_873);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_874, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_874);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_875, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_875);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_876, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_876);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_877, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_877);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_878, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_878);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_879, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_879);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_880, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_880);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_881, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_881);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_882, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_882);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_883, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_883);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_884, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_884);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_885, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_885);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_886, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_886);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_887, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_887);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_888, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_888);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_889, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_889);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_890, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_890);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_891, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_891);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_892, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_892);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_893, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_893);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_894, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_894);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_895, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_895);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_896, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_896);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_897, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_897);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_898, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_898);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_899, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_899);
+
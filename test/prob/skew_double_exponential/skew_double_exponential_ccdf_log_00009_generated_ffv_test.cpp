@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/skew_double_exponential/skew_double_exponential_ccdf_log_test.hpp>
+
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_900;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_901;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_902;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_903;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_904;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_905;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_906;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_907;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_908;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, double, empty, empty> type_ffv_909;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_910;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_911;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_912;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_913;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_914;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_915;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_916;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_917;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_918;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_919;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_920;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_921;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_922;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_923;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_924;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_925;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_926;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, double, empty, empty> type_ffv_927;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty, empty> type_ffv_928;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_929;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty, empty> type_ffv_930;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_931;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_932;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty, empty> type_ffv_933;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_934;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_935;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_936;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_937;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_938;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_939;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_940;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_941;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_942;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_943;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_944;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty, empty> type_ffv_945;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_946;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_947;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_948;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_949;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_950;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_951;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_952;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_953;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_954;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_955;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_956;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_957;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_958;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_959;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_960;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_961;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_962;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty, empty> type_ffv_963;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_ffv_964;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_965;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_966;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_967;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_968;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_ffv_969;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_970;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_971;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_972;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_973;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_974;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_975;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_976;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_977;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_978;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_979;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_980;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_981;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_982;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_983;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_984;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_985;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_986;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_987;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_988;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_989;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_990;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_991;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_992;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_993;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_994;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_995;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_996;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_997;
+typedef std::tuple<std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_998;
+typedef std::tuple<Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, double, empty, empty> type_ffv_999;
+
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_900> AgradCcdfLogSkewDoubleExponential_ffv_900;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_901> AgradCcdfLogSkewDoubleExponential_ffv_901;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_902> AgradCcdfLogSkewDoubleExponential_ffv_902;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_903> AgradCcdfLogSkewDoubleExponential_ffv_903;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_904> AgradCcdfLogSkewDoubleExponential_ffv_904;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_905> AgradCcdfLogSkewDoubleExponential_ffv_905;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_906> AgradCcdfLogSkewDoubleExponential_ffv_906;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_907> AgradCcdfLogSkewDoubleExponential_ffv_907;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_908> AgradCcdfLogSkewDoubleExponential_ffv_908;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_909> AgradCcdfLogSkewDoubleExponential_ffv_909;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_910> AgradCcdfLogSkewDoubleExponential_ffv_910;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_911> AgradCcdfLogSkewDoubleExponential_ffv_911;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_912> AgradCcdfLogSkewDoubleExponential_ffv_912;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_913> AgradCcdfLogSkewDoubleExponential_ffv_913;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_914> AgradCcdfLogSkewDoubleExponential_ffv_914;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_915> AgradCcdfLogSkewDoubleExponential_ffv_915;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_916> AgradCcdfLogSkewDoubleExponential_ffv_916;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_917> AgradCcdfLogSkewDoubleExponential_ffv_917;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_918> AgradCcdfLogSkewDoubleExponential_ffv_918;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_919> AgradCcdfLogSkewDoubleExponential_ffv_919;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_920> AgradCcdfLogSkewDoubleExponential_ffv_920;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_921> AgradCcdfLogSkewDoubleExponential_ffv_921;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_922> AgradCcdfLogSkewDoubleExponential_ffv_922;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_923> AgradCcdfLogSkewDoubleExponential_ffv_923;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_924> AgradCcdfLogSkewDoubleExponential_ffv_924;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_925> AgradCcdfLogSkewDoubleExponential_ffv_925;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_926> AgradCcdfLogSkewDoubleExponential_ffv_926;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_927> AgradCcdfLogSkewDoubleExponential_ffv_927;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_928> AgradCcdfLogSkewDoubleExponential_ffv_928;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_929> AgradCcdfLogSkewDoubleExponential_ffv_929;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_930> AgradCcdfLogSkewDoubleExponential_ffv_930;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_931> AgradCcdfLogSkewDoubleExponential_ffv_931;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_932> AgradCcdfLogSkewDoubleExponential_ffv_932;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_933> AgradCcdfLogSkewDoubleExponential_ffv_933;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_934> AgradCcdfLogSkewDoubleExponential_ffv_934;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_935> AgradCcdfLogSkewDoubleExponential_ffv_935;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_936> AgradCcdfLogSkewDoubleExponential_ffv_936;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_937> AgradCcdfLogSkewDoubleExponential_ffv_937;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_938> AgradCcdfLogSkewDoubleExponential_ffv_938;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_939> AgradCcdfLogSkewDoubleExponential_ffv_939;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_940> AgradCcdfLogSkewDoubleExponential_ffv_940;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_941> AgradCcdfLogSkewDoubleExponential_ffv_941;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_942> AgradCcdfLogSkewDoubleExponential_ffv_942;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_943> AgradCcdfLogSkewDoubleExponential_ffv_943;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_944> AgradCcdfLogSkewDoubleExponential_ffv_944;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_945> AgradCcdfLogSkewDoubleExponential_ffv_945;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_946> AgradCcdfLogSkewDoubleExponential_ffv_946;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_947> AgradCcdfLogSkewDoubleExponential_ffv_947;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_948> AgradCcdfLogSkewDoubleExponential_ffv_948;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_949> AgradCcdfLogSkewDoubleExponential_ffv_949;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_950> AgradCcdfLogSkewDoubleExponential_ffv_950;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_951> AgradCcdfLogSkewDoubleExponential_ffv_951;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_952> AgradCcdfLogSkewDoubleExponential_ffv_952;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_953> AgradCcdfLogSkewDoubleExponential_ffv_953;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_954> AgradCcdfLogSkewDoubleExponential_ffv_954;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_955> AgradCcdfLogSkewDoubleExponential_ffv_955;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_956> AgradCcdfLogSkewDoubleExponential_ffv_956;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_957> AgradCcdfLogSkewDoubleExponential_ffv_957;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_958> AgradCcdfLogSkewDoubleExponential_ffv_958;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_959> AgradCcdfLogSkewDoubleExponential_ffv_959;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_960> AgradCcdfLogSkewDoubleExponential_ffv_960;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_961> AgradCcdfLogSkewDoubleExponential_ffv_961;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_962> AgradCcdfLogSkewDoubleExponential_ffv_962;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_963> AgradCcdfLogSkewDoubleExponential_ffv_963;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_964> AgradCcdfLogSkewDoubleExponential_ffv_964;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_965> AgradCcdfLogSkewDoubleExponential_ffv_965;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_966> AgradCcdfLogSkewDoubleExponential_ffv_966;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_967> AgradCcdfLogSkewDoubleExponential_ffv_967;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_968> AgradCcdfLogSkewDoubleExponential_ffv_968;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_969> AgradCcdfLogSkewDoubleExponential_ffv_969;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_970> AgradCcdfLogSkewDoubleExponential_ffv_970;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_971> AgradCcdfLogSkewDoubleExponential_ffv_971;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_972> AgradCcdfLogSkewDoubleExponential_ffv_972;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_973> AgradCcdfLogSkewDoubleExponential_ffv_973;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_974> AgradCcdfLogSkewDoubleExponential_ffv_974;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_975> AgradCcdfLogSkewDoubleExponential_ffv_975;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_976> AgradCcdfLogSkewDoubleExponential_ffv_976;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_977> AgradCcdfLogSkewDoubleExponential_ffv_977;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_978> AgradCcdfLogSkewDoubleExponential_ffv_978;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_979> AgradCcdfLogSkewDoubleExponential_ffv_979;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_980> AgradCcdfLogSkewDoubleExponential_ffv_980;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_981> AgradCcdfLogSkewDoubleExponential_ffv_981;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_982> AgradCcdfLogSkewDoubleExponential_ffv_982;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_983> AgradCcdfLogSkewDoubleExponential_ffv_983;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_984> AgradCcdfLogSkewDoubleExponential_ffv_984;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_985> AgradCcdfLogSkewDoubleExponential_ffv_985;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_986> AgradCcdfLogSkewDoubleExponential_ffv_986;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_987> AgradCcdfLogSkewDoubleExponential_ffv_987;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_988> AgradCcdfLogSkewDoubleExponential_ffv_988;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_989> AgradCcdfLogSkewDoubleExponential_ffv_989;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_990> AgradCcdfLogSkewDoubleExponential_ffv_990;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_991> AgradCcdfLogSkewDoubleExponential_ffv_991;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_992> AgradCcdfLogSkewDoubleExponential_ffv_992;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_993> AgradCcdfLogSkewDoubleExponential_ffv_993;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_994> AgradCcdfLogSkewDoubleExponential_ffv_994;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_995> AgradCcdfLogSkewDoubleExponential_ffv_995;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_996> AgradCcdfLogSkewDoubleExponential_ffv_996;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_997> AgradCcdfLogSkewDoubleExponential_ffv_997;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_998> AgradCcdfLogSkewDoubleExponential_ffv_998;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_ffv_999> AgradCcdfLogSkewDoubleExponential_ffv_999;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_900, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_900);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_901, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_901);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_902, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_902);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_903, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_903);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_904, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_904);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_905, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_905);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_906, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_906);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_907, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_907);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_908, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_908);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_909, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_909);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_910, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_910);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_911, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_911);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_912, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_912);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_913, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_913);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_914, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_914);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_915, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_915);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_916, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_916);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_917, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_917);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_918, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_918);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_919, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_919);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_920, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_920);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_921, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_921);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_922, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_922);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_923, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_923);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_924, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_924);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_925, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_925);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_926, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_926);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_927, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_927);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_928, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_928);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_929, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_929);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_930, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_930);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_931, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_931);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_932, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_932);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_933, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_933);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_934, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_934);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_935, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_935);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_936, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_936);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_937, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_937);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_938, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_938);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_939, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_939);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_940, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_940);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_941, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_941);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_942, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_942);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_943, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_943);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_944, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_944);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_945, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_945);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_946, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_946);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_947, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_947);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_948, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_948);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_949, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_949);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_950, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_950);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_951, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_951);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_952, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_952);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_953, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_953);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_954, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_954);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_955, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_955);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_956, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_956);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_957, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_957);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_958, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_958);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_959, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_959);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_960, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_960);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_961, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_961);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_962, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_962);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_963, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_963);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_964, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_964);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_965, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_965);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_966, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_966);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_967, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_967);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_968, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_968);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_969, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_969);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_970, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_970);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_971, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_971);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_972, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_972);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_973, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_973);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_974, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_974);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_975, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_975);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_976, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_976);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_977, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_977);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_978, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_978);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_979, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_979);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_980, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_980);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_981, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_981);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_982, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_982);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_983, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_983);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_984, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_984);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_985, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_985);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_986, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_986);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_987, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_987);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_988, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_988);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_989, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_989);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_990, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_990);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_991, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_991);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_992, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_992);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_993, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_993);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_994, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_994);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_995, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_995);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_996, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_996);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_997, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_997);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_998, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_998);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_ffv_999, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_ffv_999);
+
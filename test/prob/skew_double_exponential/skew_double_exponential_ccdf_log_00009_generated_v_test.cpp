@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/skew_double_exponential/skew_double_exponential_ccdf_log_test.hpp>
+
+typedef std::tuple<std::vector<var>, std::vector<double>, double, double, empty, empty> type_v_900;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, std::vector<double>, empty, empty> type_v_901;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_902;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, var, empty, empty> type_v_903;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, std::vector<var>, empty, empty> type_v_904;
+typedef std::tuple<std::vector<var>, std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_905;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, double, empty, empty> type_v_906;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, std::vector<double>, empty, empty> type_v_907;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_908;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, var, empty, empty> type_v_909;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_v_910;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_911;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_912;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_913;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_914;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_915;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_916;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_917;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, double, empty, empty> type_v_918;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, std::vector<double>, empty, empty> type_v_919;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_920;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, var, empty, empty> type_v_921;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, std::vector<var>, empty, empty> type_v_922;
+typedef std::tuple<std::vector<var>, std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_923;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, double, empty, empty> type_v_924;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_v_925;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_926;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, var, empty, empty> type_v_927;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_v_928;
+typedef std::tuple<std::vector<var>, std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_929;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_930;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_931;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_932;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_933;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_934;
+typedef std::tuple<std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_935;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_936;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_937;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_938;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_939;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_940;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_941;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_942;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_943;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_944;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_945;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_946;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_947;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_948;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_949;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_950;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_951;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_952;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_953;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_954;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_955;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_956;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_957;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_958;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_959;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_960;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_961;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_962;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_963;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_964;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_965;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_966;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_967;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_968;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_969;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_970;
+typedef std::tuple<std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_971;
+typedef std::tuple<std::vector<var>, var, double, double, empty, empty> type_v_972;
+typedef std::tuple<std::vector<var>, var, double, std::vector<double>, empty, empty> type_v_973;
+typedef std::tuple<std::vector<var>, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_974;
+typedef std::tuple<std::vector<var>, var, double, var, empty, empty> type_v_975;
+typedef std::tuple<std::vector<var>, var, double, std::vector<var>, empty, empty> type_v_976;
+typedef std::tuple<std::vector<var>, var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_977;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, double, empty, empty> type_v_978;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, std::vector<double>, empty, empty> type_v_979;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_980;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, var, empty, empty> type_v_981;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, std::vector<var>, empty, empty> type_v_982;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_983;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_984;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_985;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_986;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_987;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_988;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_989;
+typedef std::tuple<std::vector<var>, var, var, double, empty, empty> type_v_990;
+typedef std::tuple<std::vector<var>, var, var, std::vector<double>, empty, empty> type_v_991;
+typedef std::tuple<std::vector<var>, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_992;
+typedef std::tuple<std::vector<var>, var, var, var, empty, empty> type_v_993;
+typedef std::tuple<std::vector<var>, var, var, std::vector<var>, empty, empty> type_v_994;
+typedef std::tuple<std::vector<var>, var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_995;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, double, empty, empty> type_v_996;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, std::vector<double>, empty, empty> type_v_997;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_998;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, var, empty, empty> type_v_999;
+
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_900> AgradCcdfLogSkewDoubleExponential_v_900;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_901> AgradCcdfLogSkewDoubleExponential_v_901;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_902> AgradCcdfLogSkewDoubleExponential_v_902;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_903> AgradCcdfLogSkewDoubleExponential_v_903;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_904> AgradCcdfLogSkewDoubleExponential_v_904;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_905> AgradCcdfLogSkewDoubleExponential_v_905;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_906> AgradCcdfLogSkewDoubleExponential_v_906;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_907> AgradCcdfLogSkewDoubleExponential_v_907;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_908> AgradCcdfLogSkewDoubleExponential_v_908;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_909> AgradCcdfLogSkewDoubleExponential_v_909;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_910> AgradCcdfLogSkewDoubleExponential_v_910;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_911> AgradCcdfLogSkewDoubleExponential_v_911;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_912> AgradCcdfLogSkewDoubleExponential_v_912;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_913> AgradCcdfLogSkewDoubleExponential_v_913;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_914> AgradCcdfLogSkewDoubleExponential_v_914;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_915> AgradCcdfLogSkewDoubleExponential_v_915;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_916> AgradCcdfLogSkewDoubleExponential_v_916;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_917> AgradCcdfLogSkewDoubleExponential_v_917;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_918> AgradCcdfLogSkewDoubleExponential_v_918;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_919> AgradCcdfLogSkewDoubleExponential_v_919;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_920> AgradCcdfLogSkewDoubleExponential_v_920;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_921> AgradCcdfLogSkewDoubleExponential_v_921;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_922> AgradCcdfLogSkewDoubleExponential_v_922;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_923> AgradCcdfLogSkewDoubleExponential_v_923;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_924> AgradCcdfLogSkewDoubleExponential_v_924;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_925> AgradCcdfLogSkewDoubleExponential_v_925;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_926> AgradCcdfLogSkewDoubleExponential_v_926;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_927> AgradCcdfLogSkewDoubleExponential_v_927;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_928> AgradCcdfLogSkewDoubleExponential_v_928;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_929> AgradCcdfLogSkewDoubleExponential_v_929;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_930> AgradCcdfLogSkewDoubleExponential_v_930;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_931> AgradCcdfLogSkewDoubleExponential_v_931;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_932> AgradCcdfLogSkewDoubleExponential_v_932;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_933> AgradCcdfLogSkewDoubleExponential_v_933;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_934> AgradCcdfLogSkewDoubleExponential_v_934;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_935> AgradCcdfLogSkewDoubleExponential_v_935;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_936> AgradCcdfLogSkewDoubleExponential_v_936;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_937> AgradCcdfLogSkewDoubleExponential_v_937;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_938> AgradCcdfLogSkewDoubleExponential_v_938;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_939> AgradCcdfLogSkewDoubleExponential_v_939;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_940> AgradCcdfLogSkewDoubleExponential_v_940;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_941> AgradCcdfLogSkewDoubleExponential_v_941;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_942> AgradCcdfLogSkewDoubleExponential_v_942;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_943> AgradCcdfLogSkewDoubleExponential_v_943;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_944> AgradCcdfLogSkewDoubleExponential_v_944;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_945> AgradCcdfLogSkewDoubleExponential_v_945;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_946> AgradCcdfLogSkewDoubleExponential_v_946;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_947> AgradCcdfLogSkewDoubleExponential_v_947;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_948> AgradCcdfLogSkewDoubleExponential_v_948;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_949> AgradCcdfLogSkewDoubleExponential_v_949;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_950> AgradCcdfLogSkewDoubleExponential_v_950;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_951> AgradCcdfLogSkewDoubleExponential_v_951;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_952> AgradCcdfLogSkewDoubleExponential_v_952;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_953> AgradCcdfLogSkewDoubleExponential_v_953;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_954> AgradCcdfLogSkewDoubleExponential_v_954;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_955> AgradCcdfLogSkewDoubleExponential_v_955;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_956> AgradCcdfLogSkewDoubleExponential_v_956;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_957> AgradCcdfLogSkewDoubleExponential_v_957;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_958> AgradCcdfLogSkewDoubleExponential_v_958;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_959> AgradCcdfLogSkewDoubleExponential_v_959;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_960> AgradCcdfLogSkewDoubleExponential_v_960;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_961> AgradCcdfLogSkewDoubleExponential_v_961;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_962> AgradCcdfLogSkewDoubleExponential_v_962;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_963> AgradCcdfLogSkewDoubleExponential_v_963;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_964> AgradCcdfLogSkewDoubleExponential_v_964;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_965> AgradCcdfLogSkewDoubleExponential_v_965;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_966> AgradCcdfLogSkewDoubleExponential_v_966;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_967> AgradCcdfLogSkewDoubleExponential_v_967;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_968> AgradCcdfLogSkewDoubleExponential_v_968;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_969> AgradCcdfLogSkewDoubleExponential_v_969;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_970> AgradCcdfLogSkewDoubleExponential_v_970;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_971> AgradCcdfLogSkewDoubleExponential_v_971;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_972> AgradCcdfLogSkewDoubleExponential_v_972;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_973> AgradCcdfLogSkewDoubleExponential_v_973;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_974> AgradCcdfLogSkewDoubleExponential_v_974;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_975> AgradCcdfLogSkewDoubleExponential_v_975;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_976> AgradCcdfLogSkewDoubleExponential_v_976;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_977> AgradCcdfLogSkewDoubleExponential_v_977;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_978> AgradCcdfLogSkewDoubleExponential_v_978;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_979> AgradCcdfLogSkewDoubleExponential_v_979;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_980> AgradCcdfLogSkewDoubleExponential_v_980;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_981> AgradCcdfLogSkewDoubleExponential_v_981;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_982> AgradCcdfLogSkewDoubleExponential_v_982;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_983> AgradCcdfLogSkewDoubleExponential_v_983;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_984> AgradCcdfLogSkewDoubleExponential_v_984;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_985> AgradCcdfLogSkewDoubleExponential_v_985;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_986> AgradCcdfLogSkewDoubleExponential_v_986;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_987> AgradCcdfLogSkewDoubleExponential_v_987;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_988> AgradCcdfLogSkewDoubleExponential_v_988;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_989> AgradCcdfLogSkewDoubleExponential_v_989;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_990> AgradCcdfLogSkewDoubleExponential_v_990;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_991> AgradCcdfLogSkewDoubleExponential_v_991;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_992> AgradCcdfLogSkewDoubleExponential_v_992;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_993> AgradCcdfLogSkewDoubleExponential_v_993;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_994> AgradCcdfLogSkewDoubleExponential_v_994;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_995> AgradCcdfLogSkewDoubleExponential_v_995;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_996> AgradCcdfLogSkewDoubleExponential_v_996;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_997> AgradCcdfLogSkewDoubleExponential_v_997;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_998> AgradCcdfLogSkewDoubleExponential_v_998;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_999> AgradCcdfLogSkewDoubleExponential_v_999;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_900, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_900);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_901, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_901);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_902, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_902);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_903, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_903);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_904, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_904);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_905, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_905);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_906, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_906);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_907, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_907);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_908, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_908);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_909, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_909);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_910, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_910);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_911, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_911);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_912, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_912);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_913, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_913);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_914, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_914);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_915, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_915);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_916, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_916);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_917, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_917);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_918, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_918);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_919, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_919);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_920, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_920);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_921, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_921);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_922, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_922);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_923, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_923);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_924, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_924);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_925, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_925);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_926, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_926);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_927, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_927);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_928, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_928);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_929, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_929);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_930, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_930);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_931, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_931);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_932, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_932);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_933, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_933);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_934, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_934);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_935, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_935);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_936, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_936);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_937, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_937);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_938, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_938);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_939, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_939);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_940, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_940);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_941, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_941);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_942, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_942);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_943, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_943);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_944, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_944);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_945, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_945);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_946, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_946);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_947, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_947);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_948, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_948);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_949, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_949);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_950, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_950);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_951, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_951);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_952, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_952);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_953, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_953);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_954, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_954);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_955, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_955);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_956, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_956);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_957, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_957);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_958, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_958);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_959, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_959);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_960, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_960);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_961, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_961);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_962, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_962);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_963, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_963);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_964, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_964);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_965, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_965);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_966, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_966);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_967, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_967);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_968, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_968);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_969, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_969);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_970, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_970);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_971, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_971);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_972, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_972);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_973, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_973);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_974, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_974);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_975, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_975);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_976, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_976);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_977, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_977);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_978, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_978);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_979, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_979);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_980, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_980);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_981, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_981);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_982, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_982);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_983, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_983);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_984, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_984);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_985, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_985);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_986, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_986);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_987, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_987);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_988, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_988);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_989, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_989);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_990, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_990);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_991, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_991);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_992, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_992);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_993, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_993);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_994, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_994);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_995, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_995);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_996, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_996);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_997, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_997);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_998, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_998);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_999, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_999);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/skew_double_exponential/skew_double_exponential_ccdf_log_test.hpp>
+
+typedef std::tuple<std::vector<var>, var, std::vector<double>, var, empty, empty> type_vv_900;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, std::vector<var>, empty, empty> type_vv_901;
+typedef std::tuple<std::vector<var>, var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_902;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_903;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_904;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_905;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_906;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_907;
+typedef std::tuple<std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_908;
+typedef std::tuple<std::vector<var>, var, var, double, empty, empty> type_vv_909;
+typedef std::tuple<std::vector<var>, var, var, std::vector<double>, empty, empty> type_vv_910;
+typedef std::tuple<std::vector<var>, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_911;
+typedef std::tuple<std::vector<var>, var, var, var, empty, empty> type_vv_912;
+typedef std::tuple<std::vector<var>, var, var, std::vector<var>, empty, empty> type_vv_913;
+typedef std::tuple<std::vector<var>, var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_914;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, double, empty, empty> type_vv_915;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, std::vector<double>, empty, empty> type_vv_916;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_917;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, var, empty, empty> type_vv_918;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, std::vector<var>, empty, empty> type_vv_919;
+typedef std::tuple<std::vector<var>, var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_920;
+typedef std::tuple<std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_921;
+typedef std::tuple<std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_922;
+typedef std::tuple<std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_923;
+typedef std::tuple<std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_924;
+typedef std::tuple<std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_925;
+typedef std::tuple<std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_926;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, double, empty, empty> type_vv_927;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, std::vector<double>, empty, empty> type_vv_928;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_929;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, var, empty, empty> type_vv_930;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, std::vector<var>, empty, empty> type_vv_931;
+typedef std::tuple<std::vector<var>, std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_932;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, double, empty, empty> type_vv_933;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_vv_934;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_935;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, var, empty, empty> type_vv_936;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_vv_937;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_938;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_939;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_940;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_941;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_942;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_943;
+typedef std::tuple<std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_944;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, double, empty, empty> type_vv_945;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, std::vector<double>, empty, empty> type_vv_946;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_947;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, var, empty, empty> type_vv_948;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, std::vector<var>, empty, empty> type_vv_949;
+typedef std::tuple<std::vector<var>, std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_950;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, double, empty, empty> type_vv_951;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_vv_952;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_953;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, var, empty, empty> type_vv_954;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_vv_955;
+typedef std::tuple<std::vector<var>, std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_956;
+typedef std::tuple<std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_957;
+typedef std::tuple<std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_958;
+typedef std::tuple<std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_959;
+typedef std::tuple<std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_960;
+typedef std::tuple<std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_961;
+typedef std::tuple<std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_962;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, empty, empty> type_vv_963;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, empty, empty> type_vv_964;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_965;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, empty, empty> type_vv_966;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, empty, empty> type_vv_967;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_968;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, empty, empty> type_vv_969;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, empty, empty> type_vv_970;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_971;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, empty, empty> type_vv_972;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, empty, empty> type_vv_973;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_974;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_975;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_976;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_977;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_978;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_979;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_980;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, empty, empty> type_vv_981;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, empty, empty> type_vv_982;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_983;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, empty, empty> type_vv_984;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, empty, empty> type_vv_985;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_986;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, empty, empty> type_vv_987;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, empty, empty> type_vv_988;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_989;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, empty, empty> type_vv_990;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, empty, empty> type_vv_991;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_992;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_993;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_994;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_995;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_996;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_997;
+typedef std::tuple<std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_998;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, double, empty, empty> type_vv_999;
+
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_900> AgradCcdfLogSkewDoubleExponential_vv_900;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_901> AgradCcdfLogSkewDoubleExponential_vv_901;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_902> AgradCcdfLogSkewDoubleExponential_vv_902;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_903> AgradCcdfLogSkewDoubleExponential_vv_903;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_904> AgradCcdfLogSkewDoubleExponential_vv_904;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_905> AgradCcdfLogSkewDoubleExponential_vv_905;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_906> AgradCcdfLogSkewDoubleExponential_vv_906;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_907> AgradCcdfLogSkewDoubleExponential_vv_907;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_908> AgradCcdfLogSkewDoubleExponential_vv_908;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_909> AgradCcdfLogSkewDoubleExponential_vv_909;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_910> AgradCcdfLogSkewDoubleExponential_vv_910;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_911> AgradCcdfLogSkewDoubleExponential_vv_911;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_912> AgradCcdfLogSkewDoubleExponential_vv_912;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_913> AgradCcdfLogSkewDoubleExponential_vv_913;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_914> AgradCcdfLogSkewDoubleExponential_vv_914;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_915> AgradCcdfLogSkewDoubleExponential_vv_915;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_916> AgradCcdfLogSkewDoubleExponential_vv_916;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_917> AgradCcdfLogSkewDoubleExponential_vv_917;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_918> AgradCcdfLogSkewDoubleExponential_vv_918;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_919> AgradCcdfLogSkewDoubleExponential_vv_919;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_920> AgradCcdfLogSkewDoubleExponential_vv_920;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_921> AgradCcdfLogSkewDoubleExponential_vv_921;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_922> AgradCcdfLogSkewDoubleExponential_vv_922;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_923> AgradCcdfLogSkewDoubleExponential_vv_923;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_924> AgradCcdfLogSkewDoubleExponential_vv_924;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_925> AgradCcdfLogSkewDoubleExponential_vv_925;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_926> AgradCcdfLogSkewDoubleExponential_vv_926;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_927> AgradCcdfLogSkewDoubleExponential_vv_927;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_928> AgradCcdfLogSkewDoubleExponential_vv_928;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_929> AgradCcdfLogSkewDoubleExponential_vv_929;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_930> AgradCcdfLogSkewDoubleExponential_vv_930;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_931> AgradCcdfLogSkewDoubleExponential_vv_931;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_932> AgradCcdfLogSkewDoubleExponential_vv_932;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_933> AgradCcdfLogSkewDoubleExponential_vv_933;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_934> AgradCcdfLogSkewDoubleExponential_vv_934;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_935> AgradCcdfLogSkewDoubleExponential_vv_935;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_936> AgradCcdfLogSkewDoubleExponential_vv_936;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_937> AgradCcdfLogSkewDoubleExponential_vv_937;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_938> AgradCcdfLogSkewDoubleExponential_vv_938;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_939> AgradCcdfLogSkewDoubleExponential_vv_939;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_940> AgradCcdfLogSkewDoubleExponential_vv_940;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_941> AgradCcdfLogSkewDoubleExponential_vv_941;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_942> AgradCcdfLogSkewDoubleExponential_vv_942;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_943> AgradCcdfLogSkewDoubleExponential_vv_943;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_944> AgradCcdfLogSkewDoubleExponential_vv_944;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_945> AgradCcdfLogSkewDoubleExponential_vv_945;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_946> AgradCcdfLogSkewDoubleExponential_vv_946;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_947> AgradCcdfLogSkewDoubleExponential_vv_947;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_948> AgradCcdfLogSkewDoubleExponential_vv_948;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_949> AgradCcdfLogSkewDoubleExponential_vv_949;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_950> AgradCcdfLogSkewDoubleExponential_vv_950;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_951> AgradCcdfLogSkewDoubleExponential_vv_951;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_952> AgradCcdfLogSkewDoubleExponential_vv_952;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_953> AgradCcdfLogSkewDoubleExponential_vv_953;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_954> AgradCcdfLogSkewDoubleExponential_vv_954;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_955> AgradCcdfLogSkewDoubleExponential_vv_955;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_956> AgradCcdfLogSkewDoubleExponential_vv_956;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_957> AgradCcdfLogSkewDoubleExponential_vv_957;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_958> AgradCcdfLogSkewDoubleExponential_vv_958;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_959> AgradCcdfLogSkewDoubleExponential_vv_959;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_960> AgradCcdfLogSkewDoubleExponential_vv_960;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_961> AgradCcdfLogSkewDoubleExponential_vv_961;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_962> AgradCcdfLogSkewDoubleExponential_vv_962;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_963> AgradCcdfLogSkewDoubleExponential_vv_963;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_964> AgradCcdfLogSkewDoubleExponential_vv_964;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_965> AgradCcdfLogSkewDoubleExponential_vv_965;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_966> AgradCcdfLogSkewDoubleExponential_vv_966;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_967> AgradCcdfLogSkewDoubleExponential_vv_967;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_968> AgradCcdfLogSkewDoubleExponential_vv_968;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_969> AgradCcdfLogSkewDoubleExponential_vv_969;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_970> AgradCcdfLogSkewDoubleExponential_vv_970;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_971> AgradCcdfLogSkewDoubleExponential_vv_971;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_972> AgradCcdfLogSkewDoubleExponential_vv_972;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_973> AgradCcdfLogSkewDoubleExponential_vv_973;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_974> AgradCcdfLogSkewDoubleExponential_vv_974;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_975> AgradCcdfLogSkewDoubleExponential_vv_975;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_976> AgradCcdfLogSkewDoubleExponential_vv_976;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_977> AgradCcdfLogSkewDoubleExponential_vv_977;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_978> AgradCcdfLogSkewDoubleExponential_vv_978;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_979> AgradCcdfLogSkewDoubleExponential_vv_979;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_980> AgradCcdfLogSkewDoubleExponential_vv_980;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_981> AgradCcdfLogSkewDoubleExponential_vv_981;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_982> AgradCcdfLogSkewDoubleExponential_vv_982;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_983> AgradCcdfLogSkewDoubleExponential_vv_983;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_984> AgradCcdfLogSkewDoubleExponential_vv_984;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_985> AgradCcdfLogSkewDoubleExponential_vv_985;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_986> AgradCcdfLogSkewDoubleExponential_vv_986;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_987> AgradCcdfLogSkewDoubleExponential_vv_987;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_988> AgradCcdfLogSkewDoubleExponential_vv_988;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_989> AgradCcdfLogSkewDoubleExponential_vv_989;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_990> AgradCcdfLogSkewDoubleExponential_vv_990;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_991> AgradCcdfLogSkewDoubleExponential_vv_991;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_992> AgradCcdfLogSkewDoubleExponential_vv_992;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_993> AgradCcdfLogSkewDoubleExponential_vv_993;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_994> AgradCcdfLogSkewDoubleExponential_vv_994;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_995> AgradCcdfLogSkewDoubleExponential_vv_995;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_996> AgradCcdfLogSkewDoubleExponential_vv_996;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_997> AgradCcdfLogSkewDoubleExponential_vv_997;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_998> AgradCcdfLogSkewDoubleExponential_vv_998;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_999> AgradCcdfLogSkewDoubleExponential_vv_999;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_900, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_900);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_901, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_901);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_902, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_902);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_903, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_903);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_904, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_904);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_905, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_905);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_906, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_906);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_907, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_907);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_908, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_908);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_909, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_909);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_910, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_910);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_911, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_911);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_912, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_912);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_913, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_913);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_914, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_914);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_915, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_915);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_916, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_916);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_917, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_917);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_918, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_918);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_919, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_919);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_920, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_920);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_921, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_921);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_922, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_922);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_923, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_923);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_924, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_924);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_925, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_925);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_926, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_926);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_927, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_927);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_928, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_928);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_929, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_929);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_930, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_930);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_931, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_931);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_932, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_932);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_933, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_933);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_934, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_934);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_935, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_935);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_936, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_936);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_937, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_937);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_938, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_938);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_939, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_939);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_940, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_940);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_941, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_941);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_942, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_942);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_943, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_943);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_944, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_944);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_945, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_945);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_946, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_946);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_947, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_947);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_948, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_948);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_949, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_949);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_950, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_950);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_951, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_951);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_952, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_952);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_953, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_953);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_954, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_954);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_955, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_955);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_956, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_956);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_957, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_957);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_958, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_958);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_959, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_959);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_960, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_960);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_961, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_961);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_962, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_962);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_963, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_963);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_964, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_964);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_965, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_965);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_966, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_966);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_967, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_967);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_968, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_968);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_969, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_969);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_970, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_970);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_971, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_971);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_972, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_972);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_973, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_973);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_974, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_974);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_975, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_975);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_976, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_976);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_977, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_977);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_978, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_978);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_979, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_979);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_980, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_980);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_981, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_981);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_982, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_982);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_983, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_983);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_984, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_984);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_985, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_985);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_986, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_986);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_987, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_987);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_988, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_988);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_989, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_989);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_990, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_990);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_991, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_991);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_992, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_992);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_993, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_993);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_994, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_994);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_995, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_995);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_996, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_996);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_997, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_997);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_998, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_998);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_999, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_999);
+
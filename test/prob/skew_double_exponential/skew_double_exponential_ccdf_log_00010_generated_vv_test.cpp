@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/skew_double_exponential/skew_double_exponential_ccdf_log_test.hpp>
+
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, std::vector<double>, empty, empty> type_vv_1000;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_1001;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, var, empty, empty> type_vv_1002;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, std::vector<var>, empty, empty> type_vv_1003;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_1004;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, double, empty, empty> type_vv_1005;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, std::vector<double>, empty, empty> type_vv_1006;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_1007;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, var, empty, empty> type_vv_1008;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, std::vector<var>, empty, empty> type_vv_1009;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_1010;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_1011;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_1012;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_1013;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_1014;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_1015;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_1016;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, double, empty, empty> type_vv_1017;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, std::vector<double>, empty, empty> type_vv_1018;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_1019;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, var, empty, empty> type_vv_1020;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, std::vector<var>, empty, empty> type_vv_1021;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_1022;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, double, empty, empty> type_vv_1023;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, std::vector<double>, empty, empty> type_vv_1024;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_1025;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, var, empty, empty> type_vv_1026;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, std::vector<var>, empty, empty> type_vv_1027;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_1028;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_1029;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_1030;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_1031;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_1032;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_1033;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_1034;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, double, empty, empty> type_vv_1035;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, std::vector<double>, empty, empty> type_vv_1036;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_1037;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, var, empty, empty> type_vv_1038;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, std::vector<var>, empty, empty> type_vv_1039;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_1040;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, double, empty, empty> type_vv_1041;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, std::vector<double>, empty, empty> type_vv_1042;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_1043;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, var, empty, empty> type_vv_1044;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_vv_1045;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_1046;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_1047;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_1048;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_1049;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_1050;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_1051;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_1052;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, double, empty, empty> type_vv_1053;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, std::vector<double>, empty, empty> type_vv_1054;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_1055;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, var, empty, empty> type_vv_1056;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, std::vector<var>, empty, empty> type_vv_1057;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_1058;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, double, empty, empty> type_vv_1059;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_vv_1060;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_1061;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, var, empty, empty> type_vv_1062;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_vv_1063;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_1064;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_1065;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_1066;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_1067;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_1068;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_1069;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_1070;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty> type_vv_1071;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_vv_1072;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_1073;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_vv_1074;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_vv_1075;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_1076;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_vv_1077;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_vv_1078;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_1079;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_vv_1080;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_vv_1081;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_1082;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_1083;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_1084;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_1085;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_1086;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_1087;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_1088;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_vv_1089;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_vv_1090;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_1091;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_vv_1092;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_vv_1093;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_1094;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_vv_1095;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_vv_1096;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_1097;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_vv_1098;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_vv_1099;
+
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1000> AgradCcdfLogSkewDoubleExponential_vv_1000;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1001> AgradCcdfLogSkewDoubleExponential_vv_1001;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1002> AgradCcdfLogSkewDoubleExponential_vv_1002;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1003> AgradCcdfLogSkewDoubleExponential_vv_1003;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1004> AgradCcdfLogSkewDoubleExponential_vv_1004;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1005> AgradCcdfLogSkewDoubleExponential_vv_1005;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1006> AgradCcdfLogSkewDoubleExponential_vv_1006;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1007> AgradCcdfLogSkewDoubleExponential_vv_1007;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1008> AgradCcdfLogSkewDoubleExponential_vv_1008;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1009> AgradCcdfLogSkewDoubleExponential_vv_1009;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1010> AgradCcdfLogSkewDoubleExponential_vv_1010;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1011> AgradCcdfLogSkewDoubleExponential_vv_1011;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1012> AgradCcdfLogSkewDoubleExponential_vv_1012;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1013> AgradCcdfLogSkewDoubleExponential_vv_1013;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1014> AgradCcdfLogSkewDoubleExponential_vv_1014;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1015> AgradCcdfLogSkewDoubleExponential_vv_1015;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1016> AgradCcdfLogSkewDoubleExponential_vv_1016;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1017> AgradCcdfLogSkewDoubleExponential_vv_1017;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1018> AgradCcdfLogSkewDoubleExponential_vv_1018;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1019> AgradCcdfLogSkewDoubleExponential_vv_1019;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1020> AgradCcdfLogSkewDoubleExponential_vv_1020;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1021> AgradCcdfLogSkewDoubleExponential_vv_1021;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1022> AgradCcdfLogSkewDoubleExponential_vv_1022;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1023> AgradCcdfLogSkewDoubleExponential_vv_1023;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1024> AgradCcdfLogSkewDoubleExponential_vv_1024;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1025> AgradCcdfLogSkewDoubleExponential_vv_1025;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1026> AgradCcdfLogSkewDoubleExponential_vv_1026;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1027> AgradCcdfLogSkewDoubleExponential_vv_1027;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1028> AgradCcdfLogSkewDoubleExponential_vv_1028;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1029> AgradCcdfLogSkewDoubleExponential_vv_1029;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1030> AgradCcdfLogSkewDoubleExponential_vv_1030;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1031> AgradCcdfLogSkewDoubleExponential_vv_1031;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1032> AgradCcdfLogSkewDoubleExponential_vv_1032;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1033> AgradCcdfLogSkewDoubleExponential_vv_1033;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1034> AgradCcdfLogSkewDoubleExponential_vv_1034;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1035> AgradCcdfLogSkewDoubleExponential_vv_1035;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1036> AgradCcdfLogSkewDoubleExponential_vv_1036;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1037> AgradCcdfLogSkewDoubleExponential_vv_1037;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1038> AgradCcdfLogSkewDoubleExponential_vv_1038;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1039> AgradCcdfLogSkewDoubleExponential_vv_1039;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1040> AgradCcdfLogSkewDoubleExponential_vv_1040;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1041> AgradCcdfLogSkewDoubleExponential_vv_1041;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1042> AgradCcdfLogSkewDoubleExponential_vv_1042;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1043> AgradCcdfLogSkewDoubleExponential_vv_1043;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1044> AgradCcdfLogSkewDoubleExponential_vv_1044;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1045> AgradCcdfLogSkewDoubleExponential_vv_1045;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1046> AgradCcdfLogSkewDoubleExponential_vv_1046;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1047> AgradCcdfLogSkewDoubleExponential_vv_1047;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1048> AgradCcdfLogSkewDoubleExponential_vv_1048;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1049> AgradCcdfLogSkewDoubleExponential_vv_1049;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1050> AgradCcdfLogSkewDoubleExponential_vv_1050;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1051> AgradCcdfLogSkewDoubleExponential_vv_1051;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1052> AgradCcdfLogSkewDoubleExponential_vv_1052;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1053> AgradCcdfLogSkewDoubleExponential_vv_1053;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1054> AgradCcdfLogSkewDoubleExponential_vv_1054;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1055> AgradCcdfLogSkewDoubleExponential_vv_1055;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1056> AgradCcdfLogSkewDoubleExponential_vv_1056;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1057> AgradCcdfLogSkewDoubleExponential_vv_1057;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1058> AgradCcdfLogSkewDoubleExponential_vv_1058;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1059> AgradCcdfLogSkewDoubleExponential_vv_1059;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1060> AgradCcdfLogSkewDoubleExponential_vv_1060;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1061> AgradCcdfLogSkewDoubleExponential_vv_1061;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1062> AgradCcdfLogSkewDoubleExponential_vv_1062;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1063> AgradCcdfLogSkewDoubleExponential_vv_1063;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1064> AgradCcdfLogSkewDoubleExponential_vv_1064;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1065> AgradCcdfLogSkewDoubleExponential_vv_1065;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1066> AgradCcdfLogSkewDoubleExponential_vv_1066;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1067> AgradCcdfLogSkewDoubleExponential_vv_1067;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1068> AgradCcdfLogSkewDoubleExponential_vv_1068;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1069> AgradCcdfLogSkewDoubleExponential_vv_1069;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1070> AgradCcdfLogSkewDoubleExponential_vv_1070;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1071> AgradCcdfLogSkewDoubleExponential_vv_1071;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1072> AgradCcdfLogSkewDoubleExponential_vv_1072;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1073> AgradCcdfLogSkewDoubleExponential_vv_1073;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1074> AgradCcdfLogSkewDoubleExponential_vv_1074;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1075> AgradCcdfLogSkewDoubleExponential_vv_1075;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1076> AgradCcdfLogSkewDoubleExponential_vv_1076;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1077> AgradCcdfLogSkewDoubleExponential_vv_1077;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1078> AgradCcdfLogSkewDoubleExponential_vv_1078;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1079> AgradCcdfLogSkewDoubleExponential_vv_1079;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1080> AgradCcdfLogSkewDoubleExponential_vv_1080;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1081> AgradCcdfLogSkewDoubleExponential_vv_1081;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1082> AgradCcdfLogSkewDoubleExponential_vv_1082;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1083> AgradCcdfLogSkewDoubleExponential_vv_1083;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1084> AgradCcdfLogSkewDoubleExponential_vv_1084;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1085> AgradCcdfLogSkewDoubleExponential_vv_1085;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1086> AgradCcdfLogSkewDoubleExponential_vv_1086;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1087> AgradCcdfLogSkewDoubleExponential_vv_1087;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1088> AgradCcdfLogSkewDoubleExponential_vv_1088;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1089> AgradCcdfLogSkewDoubleExponential_vv_1089;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1090> AgradCcdfLogSkewDoubleExponential_vv_1090;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1091> AgradCcdfLogSkewDoubleExponential_vv_1091;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1092> AgradCcdfLogSkewDoubleExponential_vv_1092;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1093> AgradCcdfLogSkewDoubleExponential_vv_1093;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1094> AgradCcdfLogSkewDoubleExponential_vv_1094;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1095> AgradCcdfLogSkewDoubleExponential_vv_1095;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1096> AgradCcdfLogSkewDoubleExponential_vv_1096;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1097> AgradCcdfLogSkewDoubleExponential_vv_1097;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1098> AgradCcdfLogSkewDoubleExponential_vv_1098;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1099> AgradCcdfLogSkewDoubleExponential_vv_1099;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1000, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1000);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1001, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1001);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1002, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1002);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1003, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1003);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1004, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1004);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1005, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1005);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1006, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1006);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1007, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1007);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1008, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1008);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1009, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1009);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1010, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1010);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1011, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1011);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1012, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1012);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1013, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1013);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1014, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1014);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1015, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1015);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1016, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1016);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1017, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1017);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1018, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1018);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1019, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1019);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1020, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1020);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1021, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1021);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1022, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1022);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1023, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1023);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1024, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1024);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1025, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1025);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1026, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1026);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1027, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1027);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1028, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1028);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1029, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1029);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1030, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1030);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1031, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1031);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1032, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1032);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1033, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1033);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1034, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1034);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1035, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1035);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1036, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1036);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1037, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1037);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1038, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1038);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1039, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1039);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1040, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1040);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1041, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1041);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1042, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1042);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1043, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1043);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1044, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1044);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1045, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1045);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1046, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1046);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1047, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1047);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1048, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1048);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1049, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1049);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1050, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1050);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1051, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1051);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1052, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1052);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1053, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1053);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1054, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1054);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1055, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1055);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1056, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1056);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1057, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1057);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1058, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1058);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1059, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1059);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1060, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1060);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1061, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1061);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1062, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1062);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1063, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1063);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1064, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1064);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1065, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1065);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1066, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1066);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1067, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1067);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1068, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1068);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1069, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1069);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1070, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1070);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1071, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1071);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1072, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1072);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1073, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1073);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1074, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1074);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1075, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1075);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1076, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1076);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1077, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1077);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1078, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1078);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1079, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1079);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1080, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1080);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1081, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1081);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1082, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1082);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1083, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1083);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1084, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1084);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1085, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1085);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1086, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1086);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1087, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1087);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1088, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1088);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1089, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1089);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1090, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1090);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1091, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1091);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1092, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1092);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1093, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1093);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1094, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1094);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1095, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1095);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1096, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1096);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1097, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1097);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1098, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1098);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1099, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1099);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/skew_double_exponential/skew_double_exponential_ccdf_log_test.hpp>
+
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_1100;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_1101;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_1102;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_1103;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_1104;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_1105;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_1106;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, double, empty, empty> type_vv_1107;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, std::vector<double>, empty, empty> type_vv_1108;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_1109;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, var, empty, empty> type_vv_1110;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, std::vector<var>, empty, empty> type_vv_1111;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_1112;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, double, empty, empty> type_vv_1113;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, std::vector<double>, empty, empty> type_vv_1114;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_1115;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, var, empty, empty> type_vv_1116;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, std::vector<var>, empty, empty> type_vv_1117;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_1118;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_1119;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_1120;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_1121;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_1122;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_1123;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_1124;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, double, empty, empty> type_vv_1125;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, std::vector<double>, empty, empty> type_vv_1126;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_1127;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, var, empty, empty> type_vv_1128;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, std::vector<var>, empty, empty> type_vv_1129;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_1130;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, double, empty, empty> type_vv_1131;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, std::vector<double>, empty, empty> type_vv_1132;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_1133;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, var, empty, empty> type_vv_1134;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, std::vector<var>, empty, empty> type_vv_1135;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_1136;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_1137;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_1138;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_1139;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_1140;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_1141;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_1142;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, double, empty, empty> type_vv_1143;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, std::vector<double>, empty, empty> type_vv_1144;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_1145;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, var, empty, empty> type_vv_1146;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, std::vector<var>, empty, empty> type_vv_1147;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_1148;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, double, empty, empty> type_vv_1149;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_vv_1150;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_1151;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, var, empty, empty> type_vv_1152;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_vv_1153;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_1154;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_1155;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_1156;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_1157;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_1158;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_1159;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_1160;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, double, empty, empty> type_vv_1161;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, std::vector<double>, empty, empty> type_vv_1162;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_1163;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, var, empty, empty> type_vv_1164;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, std::vector<var>, empty, empty> type_vv_1165;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_1166;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, double, empty, empty> type_vv_1167;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_vv_1168;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_1169;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, var, empty, empty> type_vv_1170;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_vv_1171;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_1172;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_1173;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_1174;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_1175;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_1176;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_1177;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_1178;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, empty, empty> type_vv_1179;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, empty, empty> type_vv_1180;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_1181;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, empty, empty> type_vv_1182;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, empty, empty> type_vv_1183;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_1184;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, empty, empty> type_vv_1185;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, empty, empty> type_vv_1186;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_1187;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, empty, empty> type_vv_1188;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, empty, empty> type_vv_1189;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_1190;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_1191;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_1192;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_1193;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_1194;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_1195;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_1196;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, empty, empty> type_vv_1197;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, empty, empty> type_vv_1198;
+typedef std::tuple<stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_1199;
+
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1100> AgradCcdfLogSkewDoubleExponential_vv_1100;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1101> AgradCcdfLogSkewDoubleExponential_vv_1101;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1102> AgradCcdfLogSkewDoubleExponential_vv_1102;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1103> AgradCcdfLogSkewDoubleExponential_vv_1103;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1104> AgradCcdfLogSkewDoubleExponential_vv_1104;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1105> AgradCcdfLogSkewDoubleExponential_vv_1105;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1106> AgradCcdfLogSkewDoubleExponential_vv_1106;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1107> AgradCcdfLogSkewDoubleExponential_vv_1107;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1108> AgradCcdfLogSkewDoubleExponential_vv_1108;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1109> AgradCcdfLogSkewDoubleExponential_vv_1109;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1110> AgradCcdfLogSkewDoubleExponential_vv_1110;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1111> AgradCcdfLogSkewDoubleExponential_vv_1111;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1112> AgradCcdfLogSkewDoubleExponential_vv_1112;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1113> AgradCcdfLogSkewDoubleExponential_vv_1113;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1114> AgradCcdfLogSkewDoubleExponential_vv_1114;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1115> AgradCcdfLogSkewDoubleExponential_vv_1115;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1116> AgradCcdfLogSkewDoubleExponential_vv_1116;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1117> AgradCcdfLogSkewDoubleExponential_vv_1117;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1118> AgradCcdfLogSkewDoubleExponential_vv_1118;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1119> AgradCcdfLogSkewDoubleExponential_vv_1119;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1120> AgradCcdfLogSkewDoubleExponential_vv_1120;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1121> AgradCcdfLogSkewDoubleExponential_vv_1121;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1122> AgradCcdfLogSkewDoubleExponential_vv_1122;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1123> AgradCcdfLogSkewDoubleExponential_vv_1123;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1124> AgradCcdfLogSkewDoubleExponential_vv_1124;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1125> AgradCcdfLogSkewDoubleExponential_vv_1125;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1126> AgradCcdfLogSkewDoubleExponential_vv_1126;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1127> AgradCcdfLogSkewDoubleExponential_vv_1127;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1128> AgradCcdfLogSkewDoubleExponential_vv_1128;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1129> AgradCcdfLogSkewDoubleExponential_vv_1129;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1130> AgradCcdfLogSkewDoubleExponential_vv_1130;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1131> AgradCcdfLogSkewDoubleExponential_vv_1131;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1132> AgradCcdfLogSkewDoubleExponential_vv_1132;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1133> AgradCcdfLogSkewDoubleExponential_vv_1133;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1134> AgradCcdfLogSkewDoubleExponential_vv_1134;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1135> AgradCcdfLogSkewDoubleExponential_vv_1135;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1136> AgradCcdfLogSkewDoubleExponential_vv_1136;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1137> AgradCcdfLogSkewDoubleExponential_vv_1137;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1138> AgradCcdfLogSkewDoubleExponential_vv_1138;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1139> AgradCcdfLogSkewDoubleExponential_vv_1139;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1140> AgradCcdfLogSkewDoubleExponential_vv_1140;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1141> AgradCcdfLogSkewDoubleExponential_vv_1141;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1142> AgradCcdfLogSkewDoubleExponential_vv_1142;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1143> AgradCcdfLogSkewDoubleExponential_vv_1143;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1144> AgradCcdfLogSkewDoubleExponential_vv_1144;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1145> AgradCcdfLogSkewDoubleExponential_vv_1145;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1146> AgradCcdfLogSkewDoubleExponential_vv_1146;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1147> AgradCcdfLogSkewDoubleExponential_vv_1147;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1148> AgradCcdfLogSkewDoubleExponential_vv_1148;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1149> AgradCcdfLogSkewDoubleExponential_vv_1149;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1150> AgradCcdfLogSkewDoubleExponential_vv_1150;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1151> AgradCcdfLogSkewDoubleExponential_vv_1151;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1152> AgradCcdfLogSkewDoubleExponential_vv_1152;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1153> AgradCcdfLogSkewDoubleExponential_vv_1153;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1154> AgradCcdfLogSkewDoubleExponential_vv_1154;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1155> AgradCcdfLogSkewDoubleExponential_vv_1155;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1156> AgradCcdfLogSkewDoubleExponential_vv_1156;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1157> AgradCcdfLogSkewDoubleExponential_vv_1157;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1158> AgradCcdfLogSkewDoubleExponential_vv_1158;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1159> AgradCcdfLogSkewDoubleExponential_vv_1159;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1160> AgradCcdfLogSkewDoubleExponential_vv_1160;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1161> AgradCcdfLogSkewDoubleExponential_vv_1161;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1162> AgradCcdfLogSkewDoubleExponential_vv_1162;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1163> AgradCcdfLogSkewDoubleExponential_vv_1163;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1164> AgradCcdfLogSkewDoubleExponential_vv_1164;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1165> AgradCcdfLogSkewDoubleExponential_vv_1165;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1166> AgradCcdfLogSkewDoubleExponential_vv_1166;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1167> AgradCcdfLogSkewDoubleExponential_vv_1167;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1168> AgradCcdfLogSkewDoubleExponential_vv_1168;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1169> AgradCcdfLogSkewDoubleExponential_vv_1169;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1170> AgradCcdfLogSkewDoubleExponential_vv_1170;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1171> AgradCcdfLogSkewDoubleExponential_vv_1171;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1172> AgradCcdfLogSkewDoubleExponential_vv_1172;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1173> AgradCcdfLogSkewDoubleExponential_vv_1173;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1174> AgradCcdfLogSkewDoubleExponential_vv_1174;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1175> AgradCcdfLogSkewDoubleExponential_vv_1175;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1176> AgradCcdfLogSkewDoubleExponential_vv_1176;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1177> AgradCcdfLogSkewDoubleExponential_vv_1177;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1178> AgradCcdfLogSkewDoubleExponential_vv_1178;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1179> AgradCcdfLogSkewDoubleExponential_vv_1179;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1180> AgradCcdfLogSkewDoubleExponential_vv_1180;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1181> AgradCcdfLogSkewDoubleExponential_vv_1181;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1182> AgradCcdfLogSkewDoubleExponential_vv_1182;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1183> AgradCcdfLogSkewDoubleExponential_vv_1183;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1184> AgradCcdfLogSkewDoubleExponential_vv_1184;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1185> AgradCcdfLogSkewDoubleExponential_vv_1185;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1186> AgradCcdfLogSkewDoubleExponential_vv_1186;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1187> AgradCcdfLogSkewDoubleExponential_vv_1187;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1188> AgradCcdfLogSkewDoubleExponential_vv_1188;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1189> AgradCcdfLogSkewDoubleExponential_vv_1189;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1190> AgradCcdfLogSkewDoubleExponential_vv_1190;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1191> AgradCcdfLogSkewDoubleExponential_vv_1191;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1192> AgradCcdfLogSkewDoubleExponential_vv_1192;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1193> AgradCcdfLogSkewDoubleExponential_vv_1193;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1194> AgradCcdfLogSkewDoubleExponential_vv_1194;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1195> AgradCcdfLogSkewDoubleExponential_vv_1195;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1196> AgradCcdfLogSkewDoubleExponential_vv_1196;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1197> AgradCcdfLogSkewDoubleExponential_vv_1197;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1198> AgradCcdfLogSkewDoubleExponential_vv_1198;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_vv_1199> AgradCcdfLogSkewDoubleExponential_vv_1199;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1100, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1101, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1102, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1103, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1104, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1105, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1106, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1107, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1108, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1109, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1110, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1111, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1112, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1113, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1114, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1115, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1116, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1117, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1118, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1119, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1120, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1121, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1122, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1123, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1124, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1125, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1126, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1127, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1128, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1129, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1130, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1131, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1132, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1133, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1134, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1135, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1136, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1137, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1138, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1139, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1140, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1141, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1142, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1143, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1144, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1145, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1146, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1147, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1148, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1149, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1150, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1151, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1152, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1153, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1154, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1155, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1156, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1157, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1158, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1159, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1160, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1161, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1162, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1163, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1164, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1165, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1166, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1167, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1168, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1169, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1170, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1171, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1172, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1173, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1174, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1175, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1176, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1177, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1178, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1179, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1180, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1181, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1182, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1183, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1184, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1185, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1186, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1187, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1188, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1188);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1189, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1189);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1190, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1190);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1191, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1191);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1192, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1192);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1193, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1193);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1194, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1194);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1195, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1195);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1196, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1196);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1197, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1197);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1198, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1198);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_vv_1199, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_vv_1199);
+
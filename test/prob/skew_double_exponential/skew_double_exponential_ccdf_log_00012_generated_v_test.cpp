@@ -0,0 +1,299 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/skew_double_exponential/skew_double_exponential_ccdf_log_test.hpp>
+
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_1200;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_1201;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1202;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_1203;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_1204;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1205;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, double, empty, empty> type_v_1206;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, std::vector<double>, empty, empty> type_v_1207;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1208;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, var, empty, empty> type_v_1209;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, std::vector<var>, empty, empty> type_v_1210;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1211;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, double, empty, empty> type_v_1212;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, std::vector<double>, empty, empty> type_v_1213;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1214;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, var, empty, empty> type_v_1215;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, std::vector<var>, empty, empty> type_v_1216;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1217;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_1218;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_1219;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1220;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_1221;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_1222;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1223;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, double, empty, empty> type_v_1224;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, std::vector<double>, empty, empty> type_v_1225;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1226;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, var, empty, empty> type_v_1227;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, std::vector<var>, empty, empty> type_v_1228;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1229;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, double, empty, empty> type_v_1230;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_v_1231;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1232;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, var, empty, empty> type_v_1233;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_v_1234;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1235;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_1236;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_1237;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1238;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_1239;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_1240;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1241;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, double, empty, empty> type_v_1242;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, std::vector<double>, empty, empty> type_v_1243;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1244;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, var, empty, empty> type_v_1245;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, std::vector<var>, empty, empty> type_v_1246;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1247;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, double, empty, empty> type_v_1248;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_v_1249;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1250;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, var, empty, empty> type_v_1251;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_v_1252;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1253;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_1254;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_1255;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1256;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_1257;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_1258;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1259;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_1260;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_1261;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1262;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_1263;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_1264;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1265;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_1266;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_1267;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1268;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_1269;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_1270;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1271;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_1272;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_1273;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1274;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_1275;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_1276;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1277;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_1278;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_1279;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1280;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_1281;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_1282;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1283;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_1284;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_1285;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1286;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_1287;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_1288;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1289;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_1290;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_1291;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_1292;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_1293;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_1294;
+typedef std::tuple<Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_1295;
+
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_1200> AgradCcdfLogSkewDoubleExponential_v_1200;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_1201> AgradCcdfLogSkewDoubleExponential_v_1201;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_1202> AgradCcdfLogSkewDoubleExponential_v_1202;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_1203> AgradCcdfLogSkewDoubleExponential_v_1203;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_1204> AgradCcdfLogSkewDoubleExponential_v_1204;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_1205> AgradCcdfLogSkewDoubleExponential_v_1205;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_1206> AgradCcdfLogSkewDoubleExponential_v_1206;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_1207> AgradCcdfLogSkewDoubleExponential_v_1207;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_1208> AgradCcdfLogSkewDoubleExponential_v_1208;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_1209> AgradCcdfLogSkewDoubleExponential_v_1209;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_1210> AgradCcdfLogSkewDoubleExponential_v_1210;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_1211> AgradCcdfLogSkewDoubleExponential_v_1211;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_1212> AgradCcdfLogSkewDoubleExponential_v_1212;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_1213> AgradCcdfLogSkewDoubleExponential_v_1213;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_1214> AgradCcdfLogSkewDoubleExponential_v_1214;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_1215> AgradCcdfLogSkewDoubleExponential_v_1215;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_1216> AgradCcdfLogSkewDoubleExponential_v_1216;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_1217> AgradCcdfLogSkewDoubleExponential_v_1217;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_1218> AgradCcdfLogSkewDoubleExponential_v_1218;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_1219> AgradCcdfLogSkewDoubleExponential_v_1219;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_1220> AgradCcdfLogSkewDoubleExponential_v_1220;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_1221> AgradCcdfLogSkewDoubleExponential_v_1221;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_1222> AgradCcdfLogSkewDoubleExponential_v_1222;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_1223> AgradCcdfLogSkewDoubleExponential_v_1223;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_1224> AgradCcdfLogSkewDoubleExponential_v_1224;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_1225> AgradCcdfLogSkewDoubleExponential_v_1225;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_1226> AgradCcdfLogSkewDoubleExponential_v_1226;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_1227> AgradCcdfLogSkewDoubleExponential_v_1227;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_1228> AgradCcdfLogSkewDoubleExponential_v_1228;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_1229> AgradCcdfLogSkewDoubleExponential_v_1229;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_1230> AgradCcdfLogSkewDoubleExponential_v_1230;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_1231> AgradCcdfLogSkewDoubleExponential_v_1231;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_1232> AgradCcdfLogSkewDoubleExponential_v_1232;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_1233> AgradCcdfLogSkewDoubleExponential_v_1233;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_1234> AgradCcdfLogSkewDoubleExponential_v_1234;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_1235> AgradCcdfLogSkewDoubleExponential_v_1235;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_1236> AgradCcdfLogSkewDoubleExponential_v_1236;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_1237> AgradCcdfLogSkewDoubleExponential_v_1237;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_1238> AgradCcdfLogSkewDoubleExponential_v_1238;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_1239> AgradCcdfLogSkewDoubleExponential_v_1239;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_1240> AgradCcdfLogSkewDoubleExponential_v_1240;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_1241> AgradCcdfLogSkewDoubleExponential_v_1241;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_1242> AgradCcdfLogSkewDoubleExponential_v_1242;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_1243> AgradCcdfLogSkewDoubleExponential_v_1243;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_1244> AgradCcdfLogSkewDoubleExponential_v_1244;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_1245> AgradCcdfLogSkewDoubleExponential_v_1245;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_1246> AgradCcdfLogSkewDoubleExponential_v_1246;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_1247> AgradCcdfLogSkewDoubleExponential_v_1247;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_1248> AgradCcdfLogSkewDoubleExponential_v_1248;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_1249> AgradCcdfLogSkewDoubleExponential_v_1249;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_1250> AgradCcdfLogSkewDoubleExponential_v_1250;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_1251> AgradCcdfLogSkewDoubleExponential_v_1251;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_1252> AgradCcdfLogSkewDoubleExponential_v_1252;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_1253> AgradCcdfLogSkewDoubleExponential_v_1253;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_1254> AgradCcdfLogSkewDoubleExponential_v_1254;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_1255> AgradCcdfLogSkewDoubleExponential_v_1255;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_1256> AgradCcdfLogSkewDoubleExponential_v_1256;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_1257> AgradCcdfLogSkewDoubleExponential_v_1257;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_1258> AgradCcdfLogSkewDoubleExponential_v_1258;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_1259> AgradCcdfLogSkewDoubleExponential_v_1259;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_1260> AgradCcdfLogSkewDoubleExponential_v_1260;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_1261> AgradCcdfLogSkewDoubleExponential_v_1261;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_1262> AgradCcdfLogSkewDoubleExponential_v_1262;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_1263> AgradCcdfLogSkewDoubleExponential_v_1263;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_1264> AgradCcdfLogSkewDoubleExponential_v_1264;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_1265> AgradCcdfLogSkewDoubleExponential_v_1265;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_1266> AgradCcdfLogSkewDoubleExponential_v_1266;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_1267> AgradCcdfLogSkewDoubleExponential_v_1267;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_1268> AgradCcdfLogSkewDoubleExponential_v_1268;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_1269> AgradCcdfLogSkewDoubleExponential_v_1269;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_1270> AgradCcdfLogSkewDoubleExponential_v_1270;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_1271> AgradCcdfLogSkewDoubleExponential_v_1271;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_1272> AgradCcdfLogSkewDoubleExponential_v_1272;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_1273> AgradCcdfLogSkewDoubleExponential_v_1273;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_1274> AgradCcdfLogSkewDoubleExponential_v_1274;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_1275> AgradCcdfLogSkewDoubleExponential_v_1275;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_1276> AgradCcdfLogSkewDoubleExponential_v_1276;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_1277> AgradCcdfLogSkewDoubleExponential_v_1277;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_1278> AgradCcdfLogSkewDoubleExponential_v_1278;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_1279> AgradCcdfLogSkewDoubleExponential_v_1279;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_1280> AgradCcdfLogSkewDoubleExponential_v_1280;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_1281> AgradCcdfLogSkewDoubleExponential_v_1281;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_1282> AgradCcdfLogSkewDoubleExponential_v_1282;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_1283> AgradCcdfLogSkewDoubleExponential_v_1283;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_1284> AgradCcdfLogSkewDoubleExponential_v_1284;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_1285> AgradCcdfLogSkewDoubleExponential_v_1285;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_1286> AgradCcdfLogSkewDoubleExponential_v_1286;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_1287> AgradCcdfLogSkewDoubleExponential_v_1287;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_1288> AgradCcdfLogSkewDoubleExponential_v_1288;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_1289> AgradCcdfLogSkewDoubleExponential_v_1289;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_1290> AgradCcdfLogSkewDoubleExponential_v_1290;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_1291> AgradCcdfLogSkewDoubleExponential_v_1291;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_1292> AgradCcdfLogSkewDoubleExponential_v_1292;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_1293> AgradCcdfLogSkewDoubleExponential_v_1293;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_1294> AgradCcdfLogSkewDoubleExponential_v_1294;
+typedef std::tuple<AgradCcdfLogSkewDoubleExponential, type_v_1295> AgradCcdfLogSkewDoubleExponential_v_1295;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_1200, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_1200);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_1201, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_1201);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_1202, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_1202);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_1203, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_1203);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_1204, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_1204);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_1205, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_1205);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_1206, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_1206);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_1207, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_1207);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_1208, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_1208);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_1209, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_1209);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_1210, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_1210);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_1211, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_1211);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_1212, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_1212);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_1213, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_1213);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_1214, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_1214);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_1215, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_1215);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_1216, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_1216);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_1217, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_1217);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_1218, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_1218);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_1219, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_1219);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_1220, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_1220);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_1221, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_1221);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_1222, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_1222);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_1223, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_1223);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_1224, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_1224);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_1225, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_1225);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_1226, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_1226);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_1227, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_1227);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_1228, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_1228);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_1229, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_1229);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_1230, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_1230);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_1231, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_1231);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_1232, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_1232);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_1233, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_1233);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_1234, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_1234);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_1235, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_1235);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_1236, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_1236);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_1237, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_1237);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_1238, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_1238);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_1239, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_1239);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_1240, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_1240);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_1241, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_1241);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_1242, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_1242);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_1243, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_1243);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_1244, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_1244);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_1245, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_1245);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_1246, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_1246);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_1247, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_1247);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_1248, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_1248);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_1249, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_1249);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_1250, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_1250);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_1251, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_1251);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_1252, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_1252);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_1253, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_1253);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_1254, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_1254);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_1255, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_1255);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_1256, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_1256);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_1257, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_1257);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_1258, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_1258);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_1259, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_1259);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_1260, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_1260);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_1261, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_1261);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_1262, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_1262);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_1263, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_1263);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_1264, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_1264);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_1265, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_1265);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_1266, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_1266);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_1267, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_1267);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_1268, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_1268);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_1269, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_1269);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_1270, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_1270);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_1271, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_1271);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_1272, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_1272);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_1273, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_1273);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_1274, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_1274);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_1275, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_1275);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_1276, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_1276);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_1277, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_1277);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_1278, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_1278);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_1279, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_1279);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_1280, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_1280);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_1281, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_1281);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_1282, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_1282);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_1283, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_1283);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_1284, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_1284);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_1285, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_1285);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_1286, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_1286);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_1287, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_1287);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_1288, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_1288);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_1289, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_1289);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_1290, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_1290);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_1291, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_1291);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_1292, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_1292);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_1293, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_1293);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_1294, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_1294);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCcdfLogSkewDoubleExponential_v_1295, AgradCcdfLogTestFixture, AgradCcdfLogSkewDoubleExponential_v_1295);
+
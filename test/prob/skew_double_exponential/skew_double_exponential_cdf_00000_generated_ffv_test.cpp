@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/skew_double_exponential/skew_double_exponential_cdf_test.hpp>
+
+typedef std::tuple<double, double, double, fvar<fvar<var> >, empty, empty> type_ffv_0;
+typedef std::tuple<double, double, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_1;
+typedef std::tuple<double, double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_2;
+typedef std::tuple<double, double, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_3;
+typedef std::tuple<double, double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_4;
+typedef std::tuple<double, double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_5;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_6;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_7;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_8;
+typedef std::tuple<double, double, fvar<fvar<var> >, double, empty, empty> type_ffv_9;
+typedef std::tuple<double, double, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_10;
+typedef std::tuple<double, double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_11;
+typedef std::tuple<double, double, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_12;
+typedef std::tuple<double, double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_13;
+typedef std::tuple<double, double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_14;
+typedef std::tuple<double, double, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_15;
+typedef std::tuple<double, double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_16;
+typedef std::tuple<double, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_17;
+typedef std::tuple<double, double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_18;
+typedef std::tuple<double, double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_19;
+typedef std::tuple<double, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_20;
+typedef std::tuple<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_21;
+typedef std::tuple<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_22;
+typedef std::tuple<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_23;
+typedef std::tuple<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_24;
+typedef std::tuple<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_25;
+typedef std::tuple<double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_26;
+typedef std::tuple<double, std::vector<double>, double, fvar<fvar<var> >, empty, empty> type_ffv_27;
+typedef std::tuple<double, std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_28;
+typedef std::tuple<double, std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_29;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_30;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_31;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_32;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_33;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_34;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_35;
+typedef std::tuple<double, std::vector<double>, fvar<fvar<var> >, double, empty, empty> type_ffv_36;
+typedef std::tuple<double, std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_37;
+typedef std::tuple<double, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_38;
+typedef std::tuple<double, std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_39;
+typedef std::tuple<double, std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_40;
+typedef std::tuple<double, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_41;
+typedef std::tuple<double, std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_42;
+typedef std::tuple<double, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_43;
+typedef std::tuple<double, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_44;
+typedef std::tuple<double, std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_45;
+typedef std::tuple<double, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_46;
+typedef std::tuple<double, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_47;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_48;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_49;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_50;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_51;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_52;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_53;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_54;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_55;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_56;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_57;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_58;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_59;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_60;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_61;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_62;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_63;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_64;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_65;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_66;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_67;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_68;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_69;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_70;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_71;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_72;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_73;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_74;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_75;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_76;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_77;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_78;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_79;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_80;
+typedef std::tuple<double, fvar<fvar<var> >, double, double, empty, empty> type_ffv_81;
+typedef std::tuple<double, fvar<fvar<var> >, double, std::vector<double>, empty, empty> type_ffv_82;
+typedef std::tuple<double, fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_83;
+typedef std::tuple<double, fvar<fvar<var> >, double, fvar<fvar<var> >, empty, empty> type_ffv_84;
+typedef std::tuple<double, fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_85;
+typedef std::tuple<double, fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_86;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<double>, double, empty, empty> type_ffv_87;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty, empty> type_ffv_88;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_89;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_90;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_91;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_92;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_93;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_94;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_95;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_96;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_97;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_98;
+typedef std::tuple<double, fvar<fvar<var> >, fvar<fvar<var> >, double, empty, empty> type_ffv_99;
+
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_0> AgradCdfSkewDoubleExponential_ffv_0;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_1> AgradCdfSkewDoubleExponential_ffv_1;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_2> AgradCdfSkewDoubleExponential_ffv_2;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_3> AgradCdfSkewDoubleExponential_ffv_3;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_4> AgradCdfSkewDoubleExponential_ffv_4;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_5> AgradCdfSkewDoubleExponential_ffv_5;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_6> AgradCdfSkewDoubleExponential_ffv_6;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_7> AgradCdfSkewDoubleExponential_ffv_7;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_8> AgradCdfSkewDoubleExponential_ffv_8;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_9> AgradCdfSkewDoubleExponential_ffv_9;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_10> AgradCdfSkewDoubleExponential_ffv_10;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_11> AgradCdfSkewDoubleExponential_ffv_11;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_12> AgradCdfSkewDoubleExponential_ffv_12;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_13> AgradCdfSkewDoubleExponential_ffv_13;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_14> AgradCdfSkewDoubleExponential_ffv_14;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_15> AgradCdfSkewDoubleExponential_ffv_15;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_16> AgradCdfSkewDoubleExponential_ffv_16;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_17> AgradCdfSkewDoubleExponential_ffv_17;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_18> AgradCdfSkewDoubleExponential_ffv_18;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_19> AgradCdfSkewDoubleExponential_ffv_19;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_20> AgradCdfSkewDoubleExponential_ffv_20;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_21> AgradCdfSkewDoubleExponential_ffv_21;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_22> AgradCdfSkewDoubleExponential_ffv_22;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_23> AgradCdfSkewDoubleExponential_ffv_23;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_24> AgradCdfSkewDoubleExponential_ffv_24;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_25> AgradCdfSkewDoubleExponential_ffv_25;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_26> AgradCdfSkewDoubleExponential_ffv_26;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_27> AgradCdfSkewDoubleExponential_ffv_27;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_28> AgradCdfSkewDoubleExponential_ffv_28;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_29> AgradCdfSkewDoubleExponential_ffv_29;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_30> AgradCdfSkewDoubleExponential_ffv_30;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_31> AgradCdfSkewDoubleExponential_ffv_31;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_32> AgradCdfSkewDoubleExponential_ffv_32;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_33> AgradCdfSkewDoubleExponential_ffv_33;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_34> AgradCdfSkewDoubleExponential_ffv_34;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_35> AgradCdfSkewDoubleExponential_ffv_35;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_36> AgradCdfSkewDoubleExponential_ffv_36;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_37> AgradCdfSkewDoubleExponential_ffv_37;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_38> AgradCdfSkewDoubleExponential_ffv_38;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_39> AgradCdfSkewDoubleExponential_ffv_39;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_40> AgradCdfSkewDoubleExponential_ffv_40;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_41> AgradCdfSkewDoubleExponential_ffv_41;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_42> AgradCdfSkewDoubleExponential_ffv_42;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_43> AgradCdfSkewDoubleExponential_ffv_43;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_44> AgradCdfSkewDoubleExponential_ffv_44;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_45> AgradCdfSkewDoubleExponential_ffv_45;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_46> AgradCdfSkewDoubleExponential_ffv_46;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_47> AgradCdfSkewDoubleExponential_ffv_47;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_48> AgradCdfSkewDoubleExponential_ffv_48;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_49> AgradCdfSkewDoubleExponential_ffv_49;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_50> AgradCdfSkewDoubleExponential_ffv_50;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_51> AgradCdfSkewDoubleExponential_ffv_51;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_52> AgradCdfSkewDoubleExponential_ffv_52;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_53> AgradCdfSkewDoubleExponential_ffv_53;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_54> AgradCdfSkewDoubleExponential_ffv_54;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_55> AgradCdfSkewDoubleExponential_ffv_55;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_56> AgradCdfSkewDoubleExponential_ffv_56;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_57> AgradCdfSkewDoubleExponential_ffv_57;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_58> AgradCdfSkewDoubleExponential_ffv_58;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_59> AgradCdfSkewDoubleExponential_ffv_59;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_60> AgradCdfSkewDoubleExponential_ffv_60;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_61> AgradCdfSkewDoubleExponential_ffv_61;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_62> AgradCdfSkewDoubleExponential_ffv_62;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_63> AgradCdfSkewDoubleExponential_ffv_63;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_64> AgradCdfSkewDoubleExponential_ffv_64;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_65> AgradCdfSkewDoubleExponential_ffv_65;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_66> AgradCdfSkewDoubleExponential_ffv_66;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_67> AgradCdfSkewDoubleExponential_ffv_67;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_68> AgradCdfSkewDoubleExponential_ffv_68;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_69> AgradCdfSkewDoubleExponential_ffv_69;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_70> AgradCdfSkewDoubleExponential_ffv_70;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_71> AgradCdfSkewDoubleExponential_ffv_71;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_72> AgradCdfSkewDoubleExponential_ffv_72;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_73> AgradCdfSkewDoubleExponential_ffv_73;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_74> AgradCdfSkewDoubleExponential_ffv_74;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_75> AgradCdfSkewDoubleExponential_ffv_75;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_76> AgradCdfSkewDoubleExponential_ffv_76;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_77> AgradCdfSkewDoubleExponential_ffv_77;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_78> AgradCdfSkewDoubleExponential_ffv_78;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_79> AgradCdfSkewDoubleExponential_ffv_79;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_80> AgradCdfSkewDoubleExponential_ffv_80;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_81> AgradCdfSkewDoubleExponential_ffv_81;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_82> AgradCdfSkewDoubleExponential_ffv_82;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_83> AgradCdfSkewDoubleExponential_ffv_83;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_84> AgradCdfSkewDoubleExponential_ffv_84;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_85> AgradCdfSkewDoubleExponential_ffv_85;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_86> AgradCdfSkewDoubleExponential_ffv_86;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_87> AgradCdfSkewDoubleExponential_ffv_87;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_88> AgradCdfSkewDoubleExponential_ffv_88;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_89> AgradCdfSkewDoubleExponential_ffv_89;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_90> AgradCdfSkewDoubleExponential_ffv_90;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_91> AgradCdfSkewDoubleExponential_ffv_91;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_92> AgradCdfSkewDoubleExponential_ffv_92;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_93> AgradCdfSkewDoubleExponential_ffv_93;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_94> AgradCdfSkewDoubleExponential_ffv_94;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_95> AgradCdfSkewDoubleExponential_ffv_95;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_96> AgradCdfSkewDoubleExponential_ffv_96;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_97> AgradCdfSkewDoubleExponential_ffv_97;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_98> AgradCdfSkewDoubleExponential_ffv_98;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_99> AgradCdfSkewDoubleExponential_ffv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_0, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_1, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_2, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_3, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_4, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_5, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_6, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_7, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_8, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_9, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_10, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_11, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_12, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_13, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_14, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_15, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_16, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_17, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_18, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_19, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_20, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_21, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_22, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_23, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_24, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_25, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_26, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_27, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_28, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_29, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_30, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_31, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_32, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_33, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_34, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_35, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_36, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_37, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_38, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_39, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_40, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_41, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_42, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_43, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_44, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_45, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_46, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_47, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_48, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_49, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_50, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_51, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_52, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_53, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_54, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_55, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_56, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_57, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_58, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_59, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_60, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_61, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_62, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_63, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_64, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_65, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_66, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_67, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_68, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_69, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_70, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_71, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_72, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_73, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_74, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_75, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_76, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_77, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_78, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_79, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_80, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_81, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_82, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_83, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_84, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_85, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_86, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_87, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_88, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_89, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_90, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_91, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_92, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_93, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_94, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_95, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_96, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_97, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_98, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_99, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_99);
+
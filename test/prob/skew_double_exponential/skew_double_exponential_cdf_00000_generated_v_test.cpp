@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/skew_double_exponential/skew_double_exponential_cdf_test.hpp>
+
+typedef std::tuple<double, double, double, double, empty, empty> type_v_0;
+typedef std::tuple<double, double, double, std::vector<double>, empty, empty> type_v_1;
+typedef std::tuple<double, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_2;
+typedef std::tuple<double, double, double, var, empty, empty> type_v_3;
+typedef std::tuple<double, double, double, std::vector<var>, empty, empty> type_v_4;
+typedef std::tuple<double, double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_5;
+typedef std::tuple<double, double, std::vector<double>, double, empty, empty> type_v_6;
+typedef std::tuple<double, double, std::vector<double>, std::vector<double>, empty, empty> type_v_7;
+typedef std::tuple<double, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_8;
+typedef std::tuple<double, double, std::vector<double>, var, empty, empty> type_v_9;
+typedef std::tuple<double, double, std::vector<double>, std::vector<var>, empty, empty> type_v_10;
+typedef std::tuple<double, double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_11;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_12;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_13;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_14;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_15;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_16;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_17;
+typedef std::tuple<double, double, var, double, empty, empty> type_v_18;
+typedef std::tuple<double, double, var, std::vector<double>, empty, empty> type_v_19;
+typedef std::tuple<double, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_20;
+typedef std::tuple<double, double, var, var, empty, empty> type_v_21;
+typedef std::tuple<double, double, var, std::vector<var>, empty, empty> type_v_22;
+typedef std::tuple<double, double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_23;
+typedef std::tuple<double, double, std::vector<var>, double, empty, empty> type_v_24;
+typedef std::tuple<double, double, std::vector<var>, std::vector<double>, empty, empty> type_v_25;
+typedef std::tuple<double, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_26;
+typedef std::tuple<double, double, std::vector<var>, var, empty, empty> type_v_27;
+typedef std::tuple<double, double, std::vector<var>, std::vector<var>, empty, empty> type_v_28;
+typedef std::tuple<double, double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_29;
+typedef std::tuple<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_30;
+typedef std::tuple<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_31;
+typedef std::tuple<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_32;
+typedef std::tuple<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_33;
+typedef std::tuple<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_34;
+typedef std::tuple<double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_35;
+typedef std::tuple<double, std::vector<double>, double, double, empty, empty> type_v_36;
+typedef std::tuple<double, std::vector<double>, double, std::vector<double>, empty, empty> type_v_37;
+typedef std::tuple<double, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_38;
+typedef std::tuple<double, std::vector<double>, double, var, empty, empty> type_v_39;
+typedef std::tuple<double, std::vector<double>, double, std::vector<var>, empty, empty> type_v_40;
+typedef std::tuple<double, std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_41;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, double, empty, empty> type_v_42;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, std::vector<double>, empty, empty> type_v_43;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_44;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, var, empty, empty> type_v_45;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_v_46;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_47;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_48;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_49;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_50;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_51;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_52;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_53;
+typedef std::tuple<double, std::vector<double>, var, double, empty, empty> type_v_54;
+typedef std::tuple<double, std::vector<double>, var, std::vector<double>, empty, empty> type_v_55;
+typedef std::tuple<double, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_56;
+typedef std::tuple<double, std::vector<double>, var, var, empty, empty> type_v_57;
+typedef std::tuple<double, std::vector<double>, var, std::vector<var>, empty, empty> type_v_58;
+typedef std::tuple<double, std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_59;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, double, empty, empty> type_v_60;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_v_61;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_62;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, var, empty, empty> type_v_63;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_v_64;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_65;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_66;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_67;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_68;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_69;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_70;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_71;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_72;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_73;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_74;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_75;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_76;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_77;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_78;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_79;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_80;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_81;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_82;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_83;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_84;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_85;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_86;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_87;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_88;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_89;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_90;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_91;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_92;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_93;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_94;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_95;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_96;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_97;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_98;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_99;
+
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_0> AgradCdfSkewDoubleExponential_v_0;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_1> AgradCdfSkewDoubleExponential_v_1;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_2> AgradCdfSkewDoubleExponential_v_2;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_3> AgradCdfSkewDoubleExponential_v_3;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_4> AgradCdfSkewDoubleExponential_v_4;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_5> AgradCdfSkewDoubleExponential_v_5;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_6> AgradCdfSkewDoubleExponential_v_6;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_7> AgradCdfSkewDoubleExponential_v_7;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_8> AgradCdfSkewDoubleExponential_v_8;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_9> AgradCdfSkewDoubleExponential_v_9;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_10> AgradCdfSkewDoubleExponential_v_10;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_11> AgradCdfSkewDoubleExponential_v_11;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_12> AgradCdfSkewDoubleExponential_v_12;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_13> AgradCdfSkewDoubleExponential_v_13;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_14> AgradCdfSkewDoubleExponential_v_14;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_15> AgradCdfSkewDoubleExponential_v_15;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_16> AgradCdfSkewDoubleExponential_v_16;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_17> AgradCdfSkewDoubleExponential_v_17;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_18> AgradCdfSkewDoubleExponential_v_18;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_19> AgradCdfSkewDoubleExponential_v_19;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_20> AgradCdfSkewDoubleExponential_v_20;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_21> AgradCdfSkewDoubleExponential_v_21;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_22> AgradCdfSkewDoubleExponential_v_22;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_23> AgradCdfSkewDoubleExponential_v_23;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_24> AgradCdfSkewDoubleExponential_v_24;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_25> AgradCdfSkewDoubleExponential_v_25;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_26> AgradCdfSkewDoubleExponential_v_26;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_27> AgradCdfSkewDoubleExponential_v_27;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_28> AgradCdfSkewDoubleExponential_v_28;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_29> AgradCdfSkewDoubleExponential_v_29;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_30> AgradCdfSkewDoubleExponential_v_30;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_31> AgradCdfSkewDoubleExponential_v_31;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_32> AgradCdfSkewDoubleExponential_v_32;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_33> AgradCdfSkewDoubleExponential_v_33;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_34> AgradCdfSkewDoubleExponential_v_34;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_35> AgradCdfSkewDoubleExponential_v_35;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_36> AgradCdfSkewDoubleExponential_v_36;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_37> AgradCdfSkewDoubleExponential_v_37;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_38> AgradCdfSkewDoubleExponential_v_38;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_39> AgradCdfSkewDoubleExponential_v_39;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_40> AgradCdfSkewDoubleExponential_v_40;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_41> AgradCdfSkewDoubleExponential_v_41;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_42> AgradCdfSkewDoubleExponential_v_42;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_43> AgradCdfSkewDoubleExponential_v_43;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_44> AgradCdfSkewDoubleExponential_v_44;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_45> AgradCdfSkewDoubleExponential_v_45;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_46> AgradCdfSkewDoubleExponential_v_46;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_47> AgradCdfSkewDoubleExponential_v_47;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_48> AgradCdfSkewDoubleExponential_v_48;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_49> AgradCdfSkewDoubleExponential_v_49;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_50> AgradCdfSkewDoubleExponential_v_50;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_51> AgradCdfSkewDoubleExponential_v_51;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_52> AgradCdfSkewDoubleExponential_v_52;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_53> AgradCdfSkewDoubleExponential_v_53;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_54> AgradCdfSkewDoubleExponential_v_54;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_55> AgradCdfSkewDoubleExponential_v_55;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_56> AgradCdfSkewDoubleExponential_v_56;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_57> AgradCdfSkewDoubleExponential_v_57;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_58> AgradCdfSkewDoubleExponential_v_58;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_59> AgradCdfSkewDoubleExponential_v_59;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_60> AgradCdfSkewDoubleExponential_v_60;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_61> AgradCdfSkewDoubleExponential_v_61;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_62> AgradCdfSkewDoubleExponential_v_62;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_63> AgradCdfSkewDoubleExponential_v_63;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_64> AgradCdfSkewDoubleExponential_v_64;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_65> AgradCdfSkewDoubleExponential_v_65;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_66> AgradCdfSkewDoubleExponential_v_66;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_67> AgradCdfSkewDoubleExponential_v_67;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_68> AgradCdfSkewDoubleExponential_v_68;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_69> AgradCdfSkewDoubleExponential_v_69;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_70> AgradCdfSkewDoubleExponential_v_70;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_71> AgradCdfSkewDoubleExponential_v_71;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_72> AgradCdfSkewDoubleExponential_v_72;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_73> AgradCdfSkewDoubleExponential_v_73;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_74> AgradCdfSkewDoubleExponential_v_74;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_75> AgradCdfSkewDoubleExponential_v_75;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_76> AgradCdfSkewDoubleExponential_v_76;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_77> AgradCdfSkewDoubleExponential_v_77;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_78> AgradCdfSkewDoubleExponential_v_78;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_79> AgradCdfSkewDoubleExponential_v_79;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_80> AgradCdfSkewDoubleExponential_v_80;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_81> AgradCdfSkewDoubleExponential_v_81;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_82> AgradCdfSkewDoubleExponential_v_82;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_83> AgradCdfSkewDoubleExponential_v_83;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_84> AgradCdfSkewDoubleExponential_v_84;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_85> AgradCdfSkewDoubleExponential_v_85;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_86> AgradCdfSkewDoubleExponential_v_86;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_87> AgradCdfSkewDoubleExponential_v_87;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_88> AgradCdfSkewDoubleExponential_v_88;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_89> AgradCdfSkewDoubleExponential_v_89;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_90> AgradCdfSkewDoubleExponential_v_90;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_91> AgradCdfSkewDoubleExponential_v_91;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_92> AgradCdfSkewDoubleExponential_v_92;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_93> AgradCdfSkewDoubleExponential_v_93;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_94> AgradCdfSkewDoubleExponential_v_94;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_95> AgradCdfSkewDoubleExponential_v_95;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_96> AgradCdfSkewDoubleExponential_v_96;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_97> AgradCdfSkewDoubleExponential_v_97;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_98> AgradCdfSkewDoubleExponential_v_98;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_99> AgradCdfSkewDoubleExponential_v_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_0, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_1, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_2, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_3, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_4, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_5, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_6, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_7, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_8, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_9, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_10, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_11, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_12, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_13, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_14, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_15, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_16, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_17, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_18, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_19, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_20, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_21, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_22, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_23, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_24, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_25, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_26, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_27, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_28, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_29, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_30, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_31, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_32, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_33, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_34, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_35, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_36, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_37, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_38, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_39, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_40, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_41, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_42, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_43, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_44, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_45, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_46, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_47, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_48, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_49, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_50, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_51, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_52, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_53, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_54, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_55, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_56, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_57, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_58, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_59, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_60, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_61, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_62, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_63, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_64, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_65, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_66, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_67, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_68, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_69, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_70, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_71, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_72, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_73, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_74, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_75, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_76, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_77, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_78, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_79, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_80, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_81, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_82, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_83, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_84, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_85, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_86, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_87, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_88, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_89, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_90, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_91, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_92, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_93, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_94, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_95, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_96, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_97, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_98, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_99, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_99);
+
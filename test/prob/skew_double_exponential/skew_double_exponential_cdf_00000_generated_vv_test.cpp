@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/skew_double_exponential/skew_double_exponential_cdf_test.hpp>
+
+typedef std::tuple<double, double, double, var, empty, empty> type_vv_0;
+typedef std::tuple<double, double, double, std::vector<var>, empty, empty> type_vv_1;
+typedef std::tuple<double, double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_2;
+typedef std::tuple<double, double, std::vector<double>, var, empty, empty> type_vv_3;
+typedef std::tuple<double, double, std::vector<double>, std::vector<var>, empty, empty> type_vv_4;
+typedef std::tuple<double, double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_5;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_6;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_7;
+typedef std::tuple<double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_8;
+typedef std::tuple<double, double, var, double, empty, empty> type_vv_9;
+typedef std::tuple<double, double, var, std::vector<double>, empty, empty> type_vv_10;
+typedef std::tuple<double, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_11;
+typedef std::tuple<double, double, var, var, empty, empty> type_vv_12;
+typedef std::tuple<double, double, var, std::vector<var>, empty, empty> type_vv_13;
+typedef std::tuple<double, double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_14;
+typedef std::tuple<double, double, std::vector<var>, double, empty, empty> type_vv_15;
+typedef std::tuple<double, double, std::vector<var>, std::vector<double>, empty, empty> type_vv_16;
+typedef std::tuple<double, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_17;
+typedef std::tuple<double, double, std::vector<var>, var, empty, empty> type_vv_18;
+typedef std::tuple<double, double, std::vector<var>, std::vector<var>, empty, empty> type_vv_19;
+typedef std::tuple<double, double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_20;
+typedef std::tuple<double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_21;
+typedef std::tuple<double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_22;
+typedef std::tuple<double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_23;
+typedef std::tuple<double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_24;
+typedef std::tuple<double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_25;
+typedef std::tuple<double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_26;
+typedef std::tuple<double, std::vector<double>, double, var, empty, empty> type_vv_27;
+typedef std::tuple<double, std::vector<double>, double, std::vector<var>, empty, empty> type_vv_28;
+typedef std::tuple<double, std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_29;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, var, empty, empty> type_vv_30;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_vv_31;
+typedef std::tuple<double, std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_32;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_33;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_34;
+typedef std::tuple<double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_35;
+typedef std::tuple<double, std::vector<double>, var, double, empty, empty> type_vv_36;
+typedef std::tuple<double, std::vector<double>, var, std::vector<double>, empty, empty> type_vv_37;
+typedef std::tuple<double, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_38;
+typedef std::tuple<double, std::vector<double>, var, var, empty, empty> type_vv_39;
+typedef std::tuple<double, std::vector<double>, var, std::vector<var>, empty, empty> type_vv_40;
+typedef std::tuple<double, std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_41;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, double, empty, empty> type_vv_42;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_vv_43;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_44;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, var, empty, empty> type_vv_45;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_vv_46;
+typedef std::tuple<double, std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_47;
+typedef std::tuple<double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_48;
+typedef std::tuple<double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_49;
+typedef std::tuple<double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_50;
+typedef std::tuple<double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_51;
+typedef std::tuple<double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_52;
+typedef std::tuple<double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_53;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_vv_54;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_vv_55;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_56;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_vv_57;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_vv_58;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_59;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_60;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_61;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_62;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_vv_63;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_vv_64;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_65;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_vv_66;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_vv_67;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_68;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_vv_69;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_vv_70;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_71;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_vv_72;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_vv_73;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_74;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_75;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_76;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_77;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_78;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_79;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_80;
+typedef std::tuple<double, var, double, double, empty, empty> type_vv_81;
+typedef std::tuple<double, var, double, std::vector<double>, empty, empty> type_vv_82;
+typedef std::tuple<double, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_83;
+typedef std::tuple<double, var, double, var, empty, empty> type_vv_84;
+typedef std::tuple<double, var, double, std::vector<var>, empty, empty> type_vv_85;
+typedef std::tuple<double, var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_86;
+typedef std::tuple<double, var, std::vector<double>, double, empty, empty> type_vv_87;
+typedef std::tuple<double, var, std::vector<double>, std::vector<double>, empty, empty> type_vv_88;
+typedef std::tuple<double, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_89;
+typedef std::tuple<double, var, std::vector<double>, var, empty, empty> type_vv_90;
+typedef std::tuple<double, var, std::vector<double>, std::vector<var>, empty, empty> type_vv_91;
+typedef std::tuple<double, var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_92;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_93;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_94;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_95;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_96;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_97;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_98;
+typedef std::tuple<double, var, var, double, empty, empty> type_vv_99;
+
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_0> AgradCdfSkewDoubleExponential_vv_0;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_1> AgradCdfSkewDoubleExponential_vv_1;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_2> AgradCdfSkewDoubleExponential_vv_2;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_3> AgradCdfSkewDoubleExponential_vv_3;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_4> AgradCdfSkewDoubleExponential_vv_4;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_5> AgradCdfSkewDoubleExponential_vv_5;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_6> AgradCdfSkewDoubleExponential_vv_6;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_7> AgradCdfSkewDoubleExponential_vv_7;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_8> AgradCdfSkewDoubleExponential_vv_8;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_9> AgradCdfSkewDoubleExponential_vv_9;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_10> AgradCdfSkewDoubleExponential_vv_10;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_11> AgradCdfSkewDoubleExponential_vv_11;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_12> AgradCdfSkewDoubleExponential_vv_12;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_13> AgradCdfSkewDoubleExponential_vv_13;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_14> AgradCdfSkewDoubleExponential_vv_14;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_15> AgradCdfSkewDoubleExponential_vv_15;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_16> AgradCdfSkewDoubleExponential_vv_16;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_17> AgradCdfSkewDoubleExponential_vv_17;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_18> AgradCdfSkewDoubleExponential_vv_18;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_19> AgradCdfSkewDoubleExponential_vv_19;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_20> AgradCdfSkewDoubleExponential_vv_20;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_21> AgradCdfSkewDoubleExponential_vv_21;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_22> AgradCdfSkewDoubleExponential_vv_22;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_23> AgradCdfSkewDoubleExponential_vv_23;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_24> AgradCdfSkewDoubleExponential_vv_24;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_25> AgradCdfSkewDoubleExponential_vv_25;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_26> AgradCdfSkewDoubleExponential_vv_26;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_27> AgradCdfSkewDoubleExponential_vv_27;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_28> AgradCdfSkewDoubleExponential_vv_28;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_29> AgradCdfSkewDoubleExponential_vv_29;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_30> AgradCdfSkewDoubleExponential_vv_30;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_31> AgradCdfSkewDoubleExponential_vv_31;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_32> AgradCdfSkewDoubleExponential_vv_32;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_33> AgradCdfSkewDoubleExponential_vv_33;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_34> AgradCdfSkewDoubleExponential_vv_34;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_35> AgradCdfSkewDoubleExponential_vv_35;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_36> AgradCdfSkewDoubleExponential_vv_36;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_37> AgradCdfSkewDoubleExponential_vv_37;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_38> AgradCdfSkewDoubleExponential_vv_38;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_39> AgradCdfSkewDoubleExponential_vv_39;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_40> AgradCdfSkewDoubleExponential_vv_40;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_41> AgradCdfSkewDoubleExponential_vv_41;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_42> AgradCdfSkewDoubleExponential_vv_42;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_43> AgradCdfSkewDoubleExponential_vv_43;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_44> AgradCdfSkewDoubleExponential_vv_44;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_45> AgradCdfSkewDoubleExponential_vv_45;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_46> AgradCdfSkewDoubleExponential_vv_46;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_47> AgradCdfSkewDoubleExponential_vv_47;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_48> AgradCdfSkewDoubleExponential_vv_48;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_49> AgradCdfSkewDoubleExponential_vv_49;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_50> AgradCdfSkewDoubleExponential_vv_50;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_51> AgradCdfSkewDoubleExponential_vv_51;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_52> AgradCdfSkewDoubleExponential_vv_52;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_53> AgradCdfSkewDoubleExponential_vv_53;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_54> AgradCdfSkewDoubleExponential_vv_54;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_55> AgradCdfSkewDoubleExponential_vv_55;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_56> AgradCdfSkewDoubleExponential_vv_56;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_57> AgradCdfSkewDoubleExponential_vv_57;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_58> AgradCdfSkewDoubleExponential_vv_58;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_59> AgradCdfSkewDoubleExponential_vv_59;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_60> AgradCdfSkewDoubleExponential_vv_60;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_61> AgradCdfSkewDoubleExponential_vv_61;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_62> AgradCdfSkewDoubleExponential_vv_62;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_63> AgradCdfSkewDoubleExponential_vv_63;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_64> AgradCdfSkewDoubleExponential_vv_64;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_65> AgradCdfSkewDoubleExponential_vv_65;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_66> AgradCdfSkewDoubleExponential_vv_66;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_67> AgradCdfSkewDoubleExponential_vv_67;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_68> AgradCdfSkewDoubleExponential_vv_68;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_69> AgradCdfSkewDoubleExponential_vv_69;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_70> AgradCdfSkewDoubleExponential_vv_70;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_71> AgradCdfSkewDoubleExponential_vv_71;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_72> AgradCdfSkewDoubleExponential_vv_72;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_73> AgradCdfSkewDoubleExponential_vv_73;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_74> AgradCdfSkewDoubleExponential_vv_74;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_75> AgradCdfSkewDoubleExponential_vv_75;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_76> AgradCdfSkewDoubleExponential_vv_76;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_77> AgradCdfSkewDoubleExponential_vv_77;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_78> AgradCdfSkewDoubleExponential_vv_78;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_79> AgradCdfSkewDoubleExponential_vv_79;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_80> AgradCdfSkewDoubleExponential_vv_80;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_81> AgradCdfSkewDoubleExponential_vv_81;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_82> AgradCdfSkewDoubleExponential_vv_82;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_83> AgradCdfSkewDoubleExponential_vv_83;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_84> AgradCdfSkewDoubleExponential_vv_84;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_85> AgradCdfSkewDoubleExponential_vv_85;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_86> AgradCdfSkewDoubleExponential_vv_86;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_87> AgradCdfSkewDoubleExponential_vv_87;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_88> AgradCdfSkewDoubleExponential_vv_88;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_89> AgradCdfSkewDoubleExponential_vv_89;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_90> AgradCdfSkewDoubleExponential_vv_90;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_91> AgradCdfSkewDoubleExponential_vv_91;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_92> AgradCdfSkewDoubleExponential_vv_92;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_93> AgradCdfSkewDoubleExponential_vv_93;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_94> AgradCdfSkewDoubleExponential_vv_94;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_95> AgradCdfSkewDoubleExponential_vv_95;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_96> AgradCdfSkewDoubleExponential_vv_96;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_97> AgradCdfSkewDoubleExponential_vv_97;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_98> AgradCdfSkewDoubleExponential_vv_98;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_99> AgradCdfSkewDoubleExponential_vv_99;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_0, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_0);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_1, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_1);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_2, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_2);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_3, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_3);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_4, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_4);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_5, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_5);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_6, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_6);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_7, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_7);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_8, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_8);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_9, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_9);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_10, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_10);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_11, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_11);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_12, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_12);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_13, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_13);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_14, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_14);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_15, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_15);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_16, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_16);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_17, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_17);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_18, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_18);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_19, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_19);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_20, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_20);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_21, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_21);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_22, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_22);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_23, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_23);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_24, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_24);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_25, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_25);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_26, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_26);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_27, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_27);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_28, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_28);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_29, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_29);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_30, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_30);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_31, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_31);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_32, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_32);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_33, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_33);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_34, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_34);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_35, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_35);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_36, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_36);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_37, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_37);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_38, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_38);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_39, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_39);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_40, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_40);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_41, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_41);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_42, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_42);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_43, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_43);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_44, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_44);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_45, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_45);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_46, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_46);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_47, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_47);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_48, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_48);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_49, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_49);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_50, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_50);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_51, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_51);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_52, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_52);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_53, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_53);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_54, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_54);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_55, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_55);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_56, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_56);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_57, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_57);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_58, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_58);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_59, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_59);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_60, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_60);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_61, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_61);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_62, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_62);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_63, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_63);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_64, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_64);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_65, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_65);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_66, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_66);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_67, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_67);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_68, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_68);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_69, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_69);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_70, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_70);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_71, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_71);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_72, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_72);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_73, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_73);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_74, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_74);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_75, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_75);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_76, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_76);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_77, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_77);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_78, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_78);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_79, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_79);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_80, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_80);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_81, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_81);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_82, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_82);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_83, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_83);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_84, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_84);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_85, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_85);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_86, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_86);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_87, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_87);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_88, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_88);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_89, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_89);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_90, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_90);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_91, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_91);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_92, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_92);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_93, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_93);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_94, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_94);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_95, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_95);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_96, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_96);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_97, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_97);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_98, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_98);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_99, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_99);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/skew_double_exponential/skew_double_exponential_cdf_test.hpp>
+
+typedef std::tuple<double, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_100;
+typedef std::tuple<double, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_101;
+typedef std::tuple<double, fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_102;
+typedef std::tuple<double, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_103;
+typedef std::tuple<double, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_104;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_105;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_106;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_107;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_108;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_109;
+typedef std::tuple<double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_110;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_111;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_112;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_113;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_114;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_115;
+typedef std::tuple<double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_116;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, double, double, empty, empty> type_ffv_117;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty, empty> type_ffv_118;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_119;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty, empty> type_ffv_120;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_121;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_122;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty, empty> type_ffv_123;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_124;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_125;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_126;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_127;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_128;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_129;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_130;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_131;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_132;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_133;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_134;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty, empty> type_ffv_135;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_136;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_137;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_138;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_139;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_140;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_141;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_142;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_143;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_144;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_145;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_146;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_147;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_148;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_149;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_150;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_151;
+typedef std::tuple<double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_152;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty, empty> type_ffv_153;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_ffv_154;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_155;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_156;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_157;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_158;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_ffv_159;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_160;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_161;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_162;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_163;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_164;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_165;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_166;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_167;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_168;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_169;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_170;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_171;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_172;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_173;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_174;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_175;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_176;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_177;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_178;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_179;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_180;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_181;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_182;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_183;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_184;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_185;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_186;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_187;
+typedef std::tuple<double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_188;
+typedef std::tuple<std::vector<double>, double, double, fvar<fvar<var> >, empty, empty> type_ffv_189;
+typedef std::tuple<std::vector<double>, double, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_190;
+typedef std::tuple<std::vector<double>, double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_191;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_192;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_193;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_194;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_195;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_196;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_197;
+typedef std::tuple<std::vector<double>, double, fvar<fvar<var> >, double, empty, empty> type_ffv_198;
+typedef std::tuple<std::vector<double>, double, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_199;
+
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_100> AgradCdfSkewDoubleExponential_ffv_100;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_101> AgradCdfSkewDoubleExponential_ffv_101;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_102> AgradCdfSkewDoubleExponential_ffv_102;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_103> AgradCdfSkewDoubleExponential_ffv_103;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_104> AgradCdfSkewDoubleExponential_ffv_104;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_105> AgradCdfSkewDoubleExponential_ffv_105;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_106> AgradCdfSkewDoubleExponential_ffv_106;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_107> AgradCdfSkewDoubleExponential_ffv_107;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_108> AgradCdfSkewDoubleExponential_ffv_108;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_109> AgradCdfSkewDoubleExponential_ffv_109;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_110> AgradCdfSkewDoubleExponential_ffv_110;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_111> AgradCdfSkewDoubleExponential_ffv_111;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_112> AgradCdfSkewDoubleExponential_ffv_112;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_113> AgradCdfSkewDoubleExponential_ffv_113;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_114> AgradCdfSkewDoubleExponential_ffv_114;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_115> AgradCdfSkewDoubleExponential_ffv_115;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_116> AgradCdfSkewDoubleExponential_ffv_116;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_117> AgradCdfSkewDoubleExponential_ffv_117;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_118> AgradCdfSkewDoubleExponential_ffv_118;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_119> AgradCdfSkewDoubleExponential_ffv_119;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_120> AgradCdfSkewDoubleExponential_ffv_120;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_121> AgradCdfSkewDoubleExponential_ffv_121;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_122> AgradCdfSkewDoubleExponential_ffv_122;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_123> AgradCdfSkewDoubleExponential_ffv_123;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_124> AgradCdfSkewDoubleExponential_ffv_124;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_125> AgradCdfSkewDoubleExponential_ffv_125;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_126> AgradCdfSkewDoubleExponential_ffv_126;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_127> AgradCdfSkewDoubleExponential_ffv_127;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_128> AgradCdfSkewDoubleExponential_ffv_128;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_129> AgradCdfSkewDoubleExponential_ffv_129;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_130> AgradCdfSkewDoubleExponential_ffv_130;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_131> AgradCdfSkewDoubleExponential_ffv_131;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_132> AgradCdfSkewDoubleExponential_ffv_132;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_133> AgradCdfSkewDoubleExponential_ffv_133;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_134> AgradCdfSkewDoubleExponential_ffv_134;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_135> AgradCdfSkewDoubleExponential_ffv_135;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_136> AgradCdfSkewDoubleExponential_ffv_136;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_137> AgradCdfSkewDoubleExponential_ffv_137;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_138> AgradCdfSkewDoubleExponential_ffv_138;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_139> AgradCdfSkewDoubleExponential_ffv_139;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_140> AgradCdfSkewDoubleExponential_ffv_140;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_141> AgradCdfSkewDoubleExponential_ffv_141;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_142> AgradCdfSkewDoubleExponential_ffv_142;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_143> AgradCdfSkewDoubleExponential_ffv_143;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_144> AgradCdfSkewDoubleExponential_ffv_144;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_145> AgradCdfSkewDoubleExponential_ffv_145;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_146> AgradCdfSkewDoubleExponential_ffv_146;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_147> AgradCdfSkewDoubleExponential_ffv_147;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_148> AgradCdfSkewDoubleExponential_ffv_148;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_149> AgradCdfSkewDoubleExponential_ffv_149;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_150> AgradCdfSkewDoubleExponential_ffv_150;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_151> AgradCdfSkewDoubleExponential_ffv_151;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_152> AgradCdfSkewDoubleExponential_ffv_152;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_153> AgradCdfSkewDoubleExponential_ffv_153;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_154> AgradCdfSkewDoubleExponential_ffv_154;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_155> AgradCdfSkewDoubleExponential_ffv_155;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_156> AgradCdfSkewDoubleExponential_ffv_156;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_157> AgradCdfSkewDoubleExponential_ffv_157;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_158> AgradCdfSkewDoubleExponential_ffv_158;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_159> AgradCdfSkewDoubleExponential_ffv_159;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_160> AgradCdfSkewDoubleExponential_ffv_160;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_161> AgradCdfSkewDoubleExponential_ffv_161;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_162> AgradCdfSkewDoubleExponential_ffv_162;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_163> AgradCdfSkewDoubleExponential_ffv_163;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_164> AgradCdfSkewDoubleExponential_ffv_164;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_165> AgradCdfSkewDoubleExponential_ffv_165;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_166> AgradCdfSkewDoubleExponential_ffv_166;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_167> AgradCdfSkewDoubleExponential_ffv_167;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_168> AgradCdfSkewDoubleExponential_ffv_168;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_169> AgradCdfSkewDoubleExponential_ffv_169;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_170> AgradCdfSkewDoubleExponential_ffv_170;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_171> AgradCdfSkewDoubleExponential_ffv_171;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_172> AgradCdfSkewDoubleExponential_ffv_172;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_173> AgradCdfSkewDoubleExponential_ffv_173;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_174> AgradCdfSkewDoubleExponential_ffv_174;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_175> AgradCdfSkewDoubleExponential_ffv_175;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_176> AgradCdfSkewDoubleExponential_ffv_176;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_177> AgradCdfSkewDoubleExponential_ffv_177;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_178> AgradCdfSkewDoubleExponential_ffv_178;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_179> AgradCdfSkewDoubleExponential_ffv_179;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_180> AgradCdfSkewDoubleExponential_ffv_180;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_181> AgradCdfSkewDoubleExponential_ffv_181;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_182> AgradCdfSkewDoubleExponential_ffv_182;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_183> AgradCdfSkewDoubleExponential_ffv_183;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_184> AgradCdfSkewDoubleExponential_ffv_184;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_185> AgradCdfSkewDoubleExponential_ffv_185;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_186> AgradCdfSkewDoubleExponential_ffv_186;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_187> AgradCdfSkewDoubleExponential_ffv_187;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_188> AgradCdfSkewDoubleExponential_ffv_188;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_189> AgradCdfSkewDoubleExponential_ffv_189;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_190> AgradCdfSkewDoubleExponential_ffv_190;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_191> AgradCdfSkewDoubleExponential_ffv_191;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_192> AgradCdfSkewDoubleExponential_ffv_192;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_193> AgradCdfSkewDoubleExponential_ffv_193;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_194> AgradCdfSkewDoubleExponential_ffv_194;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_195> AgradCdfSkewDoubleExponential_ffv_195;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_196> AgradCdfSkewDoubleExponential_ffv_196;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_197> AgradCdfSkewDoubleExponential_ffv_197;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_198> AgradCdfSkewDoubleExponential_ffv_198;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_199> AgradCdfSkewDoubleExponential_ffv_199;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_100, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_101, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_102, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_103, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_104, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_105, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_106, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_107, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_108, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_109, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_110, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_111, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_112, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_113, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_114, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_115, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_116, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_117, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_118, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_119, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_120, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_121, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_122, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_123, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_124, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_125, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_126, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_127, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_128, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_129, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_130, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_131, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_132, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_133, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_134, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_135, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_136, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_137, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_138, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_139, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_140, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_141, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_142, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_143, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_144, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_145, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_146, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_147, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_148, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_149, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_150, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_151, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_152, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_153, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_154, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_155, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_156, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_157, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_158, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_159, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_160, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_161, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_162, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_163, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_164, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_165, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_166, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_167, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_168, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_169, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_170, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_171, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_172, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_173, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_174, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_175, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_176, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_177, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_178, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_179, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_180, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_181, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_182, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_183, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_184, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_185, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_186, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_187, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_188, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_188);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_189, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_189);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_190, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_190);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_191, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_191);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_192, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_192);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_193, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_193);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_194, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_194);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_195, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_195);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_196, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_196);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_197, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_197);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_198, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_198);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_199, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_199);
+
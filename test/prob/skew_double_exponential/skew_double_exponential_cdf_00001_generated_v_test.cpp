@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/skew_double_exponential/skew_double_exponential_cdf_test.hpp>
+
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_100;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_101;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_102;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_103;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_104;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_105;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_106;
+typedef std::tuple<double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_107;
+typedef std::tuple<double, var, double, double, empty, empty> type_v_108;
+typedef std::tuple<double, var, double, std::vector<double>, empty, empty> type_v_109;
+typedef std::tuple<double, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_110;
+typedef std::tuple<double, var, double, var, empty, empty> type_v_111;
+typedef std::tuple<double, var, double, std::vector<var>, empty, empty> type_v_112;
+typedef std::tuple<double, var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_113;
+typedef std::tuple<double, var, std::vector<double>, double, empty, empty> type_v_114;
+typedef std::tuple<double, var, std::vector<double>, std::vector<double>, empty, empty> type_v_115;
+typedef std::tuple<double, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_116;
+typedef std::tuple<double, var, std::vector<double>, var, empty, empty> type_v_117;
+typedef std::tuple<double, var, std::vector<double>, std::vector<var>, empty, empty> type_v_118;
+typedef std::tuple<double, var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_119;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_120;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_121;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_122;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_123;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_124;
+typedef std::tuple<double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_125;
+typedef std::tuple<double, var, var, double, empty, empty> type_v_126;
+typedef std::tuple<double, var, var, std::vector<double>, empty, empty> type_v_127;
+typedef std::tuple<double, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_128;
+typedef std::tuple<double, var, var, var, empty, empty> type_v_129;
+typedef std::tuple<double, var, var, std::vector<var>, empty, empty> type_v_130;
+typedef std::tuple<double, var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_131;
+typedef std::tuple<double, var, std::vector<var>, double, empty, empty> type_v_132;
+typedef std::tuple<double, var, std::vector<var>, std::vector<double>, empty, empty> type_v_133;
+typedef std::tuple<double, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_134;
+typedef std::tuple<double, var, std::vector<var>, var, empty, empty> type_v_135;
+typedef std::tuple<double, var, std::vector<var>, std::vector<var>, empty, empty> type_v_136;
+typedef std::tuple<double, var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_137;
+typedef std::tuple<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_138;
+typedef std::tuple<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_139;
+typedef std::tuple<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_140;
+typedef std::tuple<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_141;
+typedef std::tuple<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_142;
+typedef std::tuple<double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_143;
+typedef std::tuple<double, std::vector<var>, double, double, empty, empty> type_v_144;
+typedef std::tuple<double, std::vector<var>, double, std::vector<double>, empty, empty> type_v_145;
+typedef std::tuple<double, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_146;
+typedef std::tuple<double, std::vector<var>, double, var, empty, empty> type_v_147;
+typedef std::tuple<double, std::vector<var>, double, std::vector<var>, empty, empty> type_v_148;
+typedef std::tuple<double, std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_149;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, double, empty, empty> type_v_150;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_v_151;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_152;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, var, empty, empty> type_v_153;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_v_154;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_155;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_156;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_157;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_158;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_159;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_160;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_161;
+typedef std::tuple<double, std::vector<var>, var, double, empty, empty> type_v_162;
+typedef std::tuple<double, std::vector<var>, var, std::vector<double>, empty, empty> type_v_163;
+typedef std::tuple<double, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_164;
+typedef std::tuple<double, std::vector<var>, var, var, empty, empty> type_v_165;
+typedef std::tuple<double, std::vector<var>, var, std::vector<var>, empty, empty> type_v_166;
+typedef std::tuple<double, std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_167;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, double, empty, empty> type_v_168;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_v_169;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_170;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, var, empty, empty> type_v_171;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_v_172;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_173;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_174;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_175;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_176;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_177;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_178;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_179;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_180;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_181;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_182;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_183;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_184;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_185;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_186;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_187;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_188;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_189;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_190;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_191;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_192;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_193;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_194;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_195;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_196;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_197;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_198;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_199;
+
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_100> AgradCdfSkewDoubleExponential_v_100;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_101> AgradCdfSkewDoubleExponential_v_101;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_102> AgradCdfSkewDoubleExponential_v_102;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_103> AgradCdfSkewDoubleExponential_v_103;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_104> AgradCdfSkewDoubleExponential_v_104;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_105> AgradCdfSkewDoubleExponential_v_105;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_106> AgradCdfSkewDoubleExponential_v_106;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_107> AgradCdfSkewDoubleExponential_v_107;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_108> AgradCdfSkewDoubleExponential_v_108;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_109> AgradCdfSkewDoubleExponential_v_109;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_110> AgradCdfSkewDoubleExponential_v_110;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_111> AgradCdfSkewDoubleExponential_v_111;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_112> AgradCdfSkewDoubleExponential_v_112;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_113> AgradCdfSkewDoubleExponential_v_113;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_114> AgradCdfSkewDoubleExponential_v_114;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_115> AgradCdfSkewDoubleExponential_v_115;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_116> AgradCdfSkewDoubleExponential_v_116;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_117> AgradCdfSkewDoubleExponential_v_117;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_118> AgradCdfSkewDoubleExponential_v_118;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_119> AgradCdfSkewDoubleExponential_v_119;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_120> AgradCdfSkewDoubleExponential_v_120;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_121> AgradCdfSkewDoubleExponential_v_121;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_122> AgradCdfSkewDoubleExponential_v_122;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_123> AgradCdfSkewDoubleExponential_v_123;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_124> AgradCdfSkewDoubleExponential_v_124;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_125> AgradCdfSkewDoubleExponential_v_125;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_126> AgradCdfSkewDoubleExponential_v_126;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_127> AgradCdfSkewDoubleExponential_v_127;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_128> AgradCdfSkewDoubleExponential_v_128;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_129> AgradCdfSkewDoubleExponential_v_129;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_130> AgradCdfSkewDoubleExponential_v_130;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_131> AgradCdfSkewDoubleExponential_v_131;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_132> AgradCdfSkewDoubleExponential_v_132;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_133> AgradCdfSkewDoubleExponential_v_133;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_134> AgradCdfSkewDoubleExponential_v_134;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_135> AgradCdfSkewDoubleExponential_v_135;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_136> AgradCdfSkewDoubleExponential_v_136;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_137> AgradCdfSkewDoubleExponential_v_137;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_138> AgradCdfSkewDoubleExponential_v_138;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_139> AgradCdfSkewDoubleExponential_v_139;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_140> AgradCdfSkewDoubleExponential_v_140;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_141> AgradCdfSkewDoubleExponential_v_141;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_142> AgradCdfSkewDoubleExponential_v_142;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_143> AgradCdfSkewDoubleExponential_v_143;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_144> AgradCdfSkewDoubleExponential_v_144;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_145> AgradCdfSkewDoubleExponential_v_145;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_146> AgradCdfSkewDoubleExponential_v_146;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_147> AgradCdfSkewDoubleExponential_v_147;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_148> AgradCdfSkewDoubleExponential_v_148;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_149> AgradCdfSkewDoubleExponential_v_149;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_150> AgradCdfSkewDoubleExponential_v_150;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_151> AgradCdfSkewDoubleExponential_v_151;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_152> AgradCdfSkewDoubleExponential_v_152;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_153> AgradCdfSkewDoubleExponential_v_153;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_154> AgradCdfSkewDoubleExponential_v_154;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_155> AgradCdfSkewDoubleExponential_v_155;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_156> AgradCdfSkewDoubleExponential_v_156;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_157> AgradCdfSkewDoubleExponential_v_157;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_158> AgradCdfSkewDoubleExponential_v_158;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_159> AgradCdfSkewDoubleExponential_v_159;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_160> AgradCdfSkewDoubleExponential_v_160;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_161> AgradCdfSkewDoubleExponential_v_161;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_162> AgradCdfSkewDoubleExponential_v_162;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_163> AgradCdfSkewDoubleExponential_v_163;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_164> AgradCdfSkewDoubleExponential_v_164;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_165> AgradCdfSkewDoubleExponential_v_165;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_166> AgradCdfSkewDoubleExponential_v_166;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_167> AgradCdfSkewDoubleExponential_v_167;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_168> AgradCdfSkewDoubleExponential_v_168;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_169> AgradCdfSkewDoubleExponential_v_169;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_170> AgradCdfSkewDoubleExponential_v_170;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_171> AgradCdfSkewDoubleExponential_v_171;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_172> AgradCdfSkewDoubleExponential_v_172;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_173> AgradCdfSkewDoubleExponential_v_173;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_174> AgradCdfSkewDoubleExponential_v_174;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_175> AgradCdfSkewDoubleExponential_v_175;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_176> AgradCdfSkewDoubleExponential_v_176;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_177> AgradCdfSkewDoubleExponential_v_177;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_178> AgradCdfSkewDoubleExponential_v_178;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_179> AgradCdfSkewDoubleExponential_v_179;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_180> AgradCdfSkewDoubleExponential_v_180;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_181> AgradCdfSkewDoubleExponential_v_181;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_182> AgradCdfSkewDoubleExponential_v_182;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_183> AgradCdfSkewDoubleExponential_v_183;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_184> AgradCdfSkewDoubleExponential_v_184;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_185> AgradCdfSkewDoubleExponential_v_185;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_186> AgradCdfSkewDoubleExponential_v_186;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_187> AgradCdfSkewDoubleExponential_v_187;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_188> AgradCdfSkewDoubleExponential_v_188;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_189> AgradCdfSkewDoubleExponential_v_189;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_190> AgradCdfSkewDoubleExponential_v_190;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_191> AgradCdfSkewDoubleExponential_v_191;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_192> AgradCdfSkewDoubleExponential_v_192;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_193> AgradCdfSkewDoubleExponential_v_193;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_194> AgradCdfSkewDoubleExponential_v_194;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_195> AgradCdfSkewDoubleExponential_v_195;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_196> AgradCdfSkewDoubleExponential_v_196;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_197> AgradCdfSkewDoubleExponential_v_197;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_198> AgradCdfSkewDoubleExponential_v_198;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_199> AgradCdfSkewDoubleExponential_v_199;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_100, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_101, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_102, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_103, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_104, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_105, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_106, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_107, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_108, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_109, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_110, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_111, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_112, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_113, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_114, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_115, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_116, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_117, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_118, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_119, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_120, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_121, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_122, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_123, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_124, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_125, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_126, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_127, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_128, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_129, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_130, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_131, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_132, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_133, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_134, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_135, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_136, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_137, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_138, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_139, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_140, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_141, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_142, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_143, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_144, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_145, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_146, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_147, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_148, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_149, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_150, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_151, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_152, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_153, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_154, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_155, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_156, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_157, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_158, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_159, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_160, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_161, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_162, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_163, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_164, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_165, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_166, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_167, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_168, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_169, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_170, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_171, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_172, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_173, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_174, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_175, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_176, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_177, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_178, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_179, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_180, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_181, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_182, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_183, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_184, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_185, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_186, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_187, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_188, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_188);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_189, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_189);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_190, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_190);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_191, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_191);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_192, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_192);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_193, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_193);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_194, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_194);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_195, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_195);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_196, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_196);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_197, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_197);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_198, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_198);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_199, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_199);
+
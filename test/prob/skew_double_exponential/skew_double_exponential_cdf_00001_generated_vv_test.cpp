@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/skew_double_exponential/skew_double_exponential_cdf_test.hpp>
+
+typedef std::tuple<double, var, var, std::vector<double>, empty, empty> type_vv_100;
+typedef std::tuple<double, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_101;
+typedef std::tuple<double, var, var, var, empty, empty> type_vv_102;
+typedef std::tuple<double, var, var, std::vector<var>, empty, empty> type_vv_103;
+typedef std::tuple<double, var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_104;
+typedef std::tuple<double, var, std::vector<var>, double, empty, empty> type_vv_105;
+typedef std::tuple<double, var, std::vector<var>, std::vector<double>, empty, empty> type_vv_106;
+typedef std::tuple<double, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_107;
+typedef std::tuple<double, var, std::vector<var>, var, empty, empty> type_vv_108;
+typedef std::tuple<double, var, std::vector<var>, std::vector<var>, empty, empty> type_vv_109;
+typedef std::tuple<double, var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_110;
+typedef std::tuple<double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_111;
+typedef std::tuple<double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_112;
+typedef std::tuple<double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_113;
+typedef std::tuple<double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_114;
+typedef std::tuple<double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_115;
+typedef std::tuple<double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_116;
+typedef std::tuple<double, std::vector<var>, double, double, empty, empty> type_vv_117;
+typedef std::tuple<double, std::vector<var>, double, std::vector<double>, empty, empty> type_vv_118;
+typedef std::tuple<double, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_119;
+typedef std::tuple<double, std::vector<var>, double, var, empty, empty> type_vv_120;
+typedef std::tuple<double, std::vector<var>, double, std::vector<var>, empty, empty> type_vv_121;
+typedef std::tuple<double, std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_122;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, double, empty, empty> type_vv_123;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_vv_124;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_125;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, var, empty, empty> type_vv_126;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_vv_127;
+typedef std::tuple<double, std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_128;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_129;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_130;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_131;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_132;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_133;
+typedef std::tuple<double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_134;
+typedef std::tuple<double, std::vector<var>, var, double, empty, empty> type_vv_135;
+typedef std::tuple<double, std::vector<var>, var, std::vector<double>, empty, empty> type_vv_136;
+typedef std::tuple<double, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_137;
+typedef std::tuple<double, std::vector<var>, var, var, empty, empty> type_vv_138;
+typedef std::tuple<double, std::vector<var>, var, std::vector<var>, empty, empty> type_vv_139;
+typedef std::tuple<double, std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_140;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, double, empty, empty> type_vv_141;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_vv_142;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_143;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, var, empty, empty> type_vv_144;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_vv_145;
+typedef std::tuple<double, std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_146;
+typedef std::tuple<double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_147;
+typedef std::tuple<double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_148;
+typedef std::tuple<double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_149;
+typedef std::tuple<double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_150;
+typedef std::tuple<double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_151;
+typedef std::tuple<double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_152;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, empty, empty> type_vv_153;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, empty, empty> type_vv_154;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_155;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, empty, empty> type_vv_156;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, empty, empty> type_vv_157;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_158;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, empty, empty> type_vv_159;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, empty, empty> type_vv_160;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_161;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, empty, empty> type_vv_162;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, empty, empty> type_vv_163;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_164;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_165;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_166;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_167;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_168;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_169;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_170;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, empty, empty> type_vv_171;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, empty, empty> type_vv_172;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_173;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, empty, empty> type_vv_174;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, empty, empty> type_vv_175;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_176;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, empty, empty> type_vv_177;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, empty, empty> type_vv_178;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_179;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, empty, empty> type_vv_180;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, empty, empty> type_vv_181;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_182;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_183;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_184;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_185;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_186;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_187;
+typedef std::tuple<double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_188;
+typedef std::tuple<std::vector<double>, double, double, var, empty, empty> type_vv_189;
+typedef std::tuple<std::vector<double>, double, double, std::vector<var>, empty, empty> type_vv_190;
+typedef std::tuple<std::vector<double>, double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_191;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, var, empty, empty> type_vv_192;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, std::vector<var>, empty, empty> type_vv_193;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_194;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_195;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_196;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_197;
+typedef std::tuple<std::vector<double>, double, var, double, empty, empty> type_vv_198;
+typedef std::tuple<std::vector<double>, double, var, std::vector<double>, empty, empty> type_vv_199;
+
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_100> AgradCdfSkewDoubleExponential_vv_100;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_101> AgradCdfSkewDoubleExponential_vv_101;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_102> AgradCdfSkewDoubleExponential_vv_102;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_103> AgradCdfSkewDoubleExponential_vv_103;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_104> AgradCdfSkewDoubleExponential_vv_104;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_105> AgradCdfSkewDoubleExponential_vv_105;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_106> AgradCdfSkewDoubleExponential_vv_106;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_107> AgradCdfSkewDoubleExponential_vv_107;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_108> AgradCdfSkewDoubleExponential_vv_108;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_109> AgradCdfSkewDoubleExponential_vv_109;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_110> AgradCdfSkewDoubleExponential_vv_110;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_111> AgradCdfSkewDoubleExponential_vv_111;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_112> AgradCdfSkewDoubleExponential_vv_112;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_113> AgradCdfSkewDoubleExponential_vv_113;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_114> AgradCdfSkewDoubleExponential_vv_114;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_115> AgradCdfSkewDoubleExponential_vv_115;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_116> AgradCdfSkewDoubleExponential_vv_116;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_117> AgradCdfSkewDoubleExponential_vv_117;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_118> AgradCdfSkewDoubleExponential_vv_118;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_119> AgradCdfSkewDoubleExponential_vv_119;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_120> AgradCdfSkewDoubleExponential_vv_120;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_121> AgradCdfSkewDoubleExponential_vv_121;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_122> AgradCdfSkewDoubleExponential_vv_122;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_123> AgradCdfSkewDoubleExponential_vv_123;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_124> AgradCdfSkewDoubleExponential_vv_124;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_125> AgradCdfSkewDoubleExponential_vv_125;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_126> AgradCdfSkewDoubleExponential_vv_126;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_127> AgradCdfSkewDoubleExponential_vv_127;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_128> AgradCdfSkewDoubleExponential_vv_128;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_129> AgradCdfSkewDoubleExponential_vv_129;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_130> AgradCdfSkewDoubleExponential_vv_130;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_131> AgradCdfSkewDoubleExponential_vv_131;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_132> AgradCdfSkewDoubleExponential_vv_132;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_133> AgradCdfSkewDoubleExponential_vv_133;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_134> AgradCdfSkewDoubleExponential_vv_134;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_135> AgradCdfSkewDoubleExponential_vv_135;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_136> AgradCdfSkewDoubleExponential_vv_136;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_137> AgradCdfSkewDoubleExponential_vv_137;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_138> AgradCdfSkewDoubleExponential_vv_138;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_139> AgradCdfSkewDoubleExponential_vv_139;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_140> AgradCdfSkewDoubleExponential_vv_140;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_141> AgradCdfSkewDoubleExponential_vv_141;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_142> AgradCdfSkewDoubleExponential_vv_142;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_143> AgradCdfSkewDoubleExponential_vv_143;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_144> AgradCdfSkewDoubleExponential_vv_144;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_145> AgradCdfSkewDoubleExponential_vv_145;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_146> AgradCdfSkewDoubleExponential_vv_146;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_147> AgradCdfSkewDoubleExponential_vv_147;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_148> AgradCdfSkewDoubleExponential_vv_148;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_149> AgradCdfSkewDoubleExponential_vv_149;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_150> AgradCdfSkewDoubleExponential_vv_150;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_151> AgradCdfSkewDoubleExponential_vv_151;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_152> AgradCdfSkewDoubleExponential_vv_152;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_153> AgradCdfSkewDoubleExponential_vv_153;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_154> AgradCdfSkewDoubleExponential_vv_154;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_155> AgradCdfSkewDoubleExponential_vv_155;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_156> AgradCdfSkewDoubleExponential_vv_156;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_157> AgradCdfSkewDoubleExponential_vv_157;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_158> AgradCdfSkewDoubleExponential_vv_158;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_159> AgradCdfSkewDoubleExponential_vv_159;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_160> AgradCdfSkewDoubleExponential_vv_160;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_161> AgradCdfSkewDoubleExponential_vv_161;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_162> AgradCdfSkewDoubleExponential_vv_162;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_163> AgradCdfSkewDoubleExponential_vv_163;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_164> AgradCdfSkewDoubleExponential_vv_164;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_165> AgradCdfSkewDoubleExponential_vv_165;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_166> AgradCdfSkewDoubleExponential_vv_166;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_167> AgradCdfSkewDoubleExponential_vv_167;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_168> AgradCdfSkewDoubleExponential_vv_168;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_169> AgradCdfSkewDoubleExponential_vv_169;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_170> AgradCdfSkewDoubleExponential_vv_170;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_171> AgradCdfSkewDoubleExponential_vv_171;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_172> AgradCdfSkewDoubleExponential_vv_172;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_173> AgradCdfSkewDoubleExponential_vv_173;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_174> AgradCdfSkewDoubleExponential_vv_174;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_175> AgradCdfSkewDoubleExponential_vv_175;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_176> AgradCdfSkewDoubleExponential_vv_176;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_177> AgradCdfSkewDoubleExponential_vv_177;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_178> AgradCdfSkewDoubleExponential_vv_178;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_179> AgradCdfSkewDoubleExponential_vv_179;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_180> AgradCdfSkewDoubleExponential_vv_180;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_181> AgradCdfSkewDoubleExponential_vv_181;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_182> AgradCdfSkewDoubleExponential_vv_182;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_183> AgradCdfSkewDoubleExponential_vv_183;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_184> AgradCdfSkewDoubleExponential_vv_184;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_185> AgradCdfSkewDoubleExponential_vv_185;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_186> AgradCdfSkewDoubleExponential_vv_186;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_187> AgradCdfSkewDoubleExponential_vv_187;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_188> AgradCdfSkewDoubleExponential_vv_188;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_189> AgradCdfSkewDoubleExponential_vv_189;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_190> AgradCdfSkewDoubleExponential_vv_190;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_191> AgradCdfSkewDoubleExponential_vv_191;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_192> AgradCdfSkewDoubleExponential_vv_192;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_193> AgradCdfSkewDoubleExponential_vv_193;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_194> AgradCdfSkewDoubleExponential_vv_194;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_195> AgradCdfSkewDoubleExponential_vv_195;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_196> AgradCdfSkewDoubleExponential_vv_196;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_197> AgradCdfSkewDoubleExponential_vv_197;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_198> AgradCdfSkewDoubleExponential_vv_198;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_199> AgradCdfSkewDoubleExponential_vv_199;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_100, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_100);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_101, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_101);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_102, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_102);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_103, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_103);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_104, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_104);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_105, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_105);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_106, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_106);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_107, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_107);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_108, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_108);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_109, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_109);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_110, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_110);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_111, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_111);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_112, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_112);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_113, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_113);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_114, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_114);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_115, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_115);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_116, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_116);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_117, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_117);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_118, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_118);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_119, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_119);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_120, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_120);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_121, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_121);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_122, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_122);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_123, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_123);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_124, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_124);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_125, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_125);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_126, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_126);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_127, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_127);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_128, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_128);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_129, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_129);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_130, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_130);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_131, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_131);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_132, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_132);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_133, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_133);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_134, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_134);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_135, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_135);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_136, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_136);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_137, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_137);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_138, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_138);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_139, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_139);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_140, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_140);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_141, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_141);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_142, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_142);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_143, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_143);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_144, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_144);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_145, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_145);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_146, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_146);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_147, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_147);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_148, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_148);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_149, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_149);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_150, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_150);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_151, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_151);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_152, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_152);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_153, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_153);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_154, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_154);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_155, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_155);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_156, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_156);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_157, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_157);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_158, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_158);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_159, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_159);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_160, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_160);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_161, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_161);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_162, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_162);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_163, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_163);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_164, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_164);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_165, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_165);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_166, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_166);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_167, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_167);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_168, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_168);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_169, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_169);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_170, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_170);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_171, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_171);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_172, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_172);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_173, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_173);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_174, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_174);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_175, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_175);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_176, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_176);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_177, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_177);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_178, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_178);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_179, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_179);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_180, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_180);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_181, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_181);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_182, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_182);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_183, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_183);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_184, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_184);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_185, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_185);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_186, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_186);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_187, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_187);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_188, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_188);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_189, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_189);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_190, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_190);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_191, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_191);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_192, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_192);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_193, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_193);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_194, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_194);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_195, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_195);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_196, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_196);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_197, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_197);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_198, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_198);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_199, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_199);
+
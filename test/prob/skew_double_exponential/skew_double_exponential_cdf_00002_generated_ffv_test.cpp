@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/skew_double_exponential/skew_double_exponential_cdf_test.hpp>
+
+typedef std::tuple<std::vector<double>, double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_200;
+typedef std::tuple<std::vector<double>, double, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_201;
+typedef std::tuple<std::vector<double>, double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_202;
+typedef std::tuple<std::vector<double>, double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_203;
+typedef std::tuple<std::vector<double>, double, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_204;
+typedef std::tuple<std::vector<double>, double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_205;
+typedef std::tuple<std::vector<double>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_206;
+typedef std::tuple<std::vector<double>, double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_207;
+typedef std::tuple<std::vector<double>, double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_208;
+typedef std::tuple<std::vector<double>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_209;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_210;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_211;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_212;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_213;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_214;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_215;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, fvar<fvar<var> >, empty, empty> type_ffv_216;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_217;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_218;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_219;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_220;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_221;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_222;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_223;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_224;
+typedef std::tuple<std::vector<double>, std::vector<double>, fvar<fvar<var> >, double, empty, empty> type_ffv_225;
+typedef std::tuple<std::vector<double>, std::vector<double>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_226;
+typedef std::tuple<std::vector<double>, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_227;
+typedef std::tuple<std::vector<double>, std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_228;
+typedef std::tuple<std::vector<double>, std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_229;
+typedef std::tuple<std::vector<double>, std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_230;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_231;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_232;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_233;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_234;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_235;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_236;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_237;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_238;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_239;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_240;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_241;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_242;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_243;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_244;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_245;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_246;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_247;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_248;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_249;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_250;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_251;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_252;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_253;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_254;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_255;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_256;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_257;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_258;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_259;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_260;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_261;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_262;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_263;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_264;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_265;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_266;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_267;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_268;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_269;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, double, double, empty, empty> type_ffv_270;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, double, std::vector<double>, empty, empty> type_ffv_271;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_272;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, double, fvar<fvar<var> >, empty, empty> type_ffv_273;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_274;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_275;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<double>, double, empty, empty> type_ffv_276;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<double>, std::vector<double>, empty, empty> type_ffv_277;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_278;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_279;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_280;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_281;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_282;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_283;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_284;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_285;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_286;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_287;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, double, empty, empty> type_ffv_288;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_289;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_290;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_291;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_292;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_293;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_294;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_295;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_296;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_297;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_298;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_299;
+
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_200> AgradCdfSkewDoubleExponential_ffv_200;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_201> AgradCdfSkewDoubleExponential_ffv_201;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_202> AgradCdfSkewDoubleExponential_ffv_202;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_203> AgradCdfSkewDoubleExponential_ffv_203;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_204> AgradCdfSkewDoubleExponential_ffv_204;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_205> AgradCdfSkewDoubleExponential_ffv_205;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_206> AgradCdfSkewDoubleExponential_ffv_206;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_207> AgradCdfSkewDoubleExponential_ffv_207;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_208> AgradCdfSkewDoubleExponential_ffv_208;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_209> AgradCdfSkewDoubleExponential_ffv_209;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_210> AgradCdfSkewDoubleExponential_ffv_210;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_211> AgradCdfSkewDoubleExponential_ffv_211;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_212> AgradCdfSkewDoubleExponential_ffv_212;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_213> AgradCdfSkewDoubleExponential_ffv_213;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_214> AgradCdfSkewDoubleExponential_ffv_214;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_215> AgradCdfSkewDoubleExponential_ffv_215;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_216> AgradCdfSkewDoubleExponential_ffv_216;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_217> AgradCdfSkewDoubleExponential_ffv_217;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_218> AgradCdfSkewDoubleExponential_ffv_218;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_219> AgradCdfSkewDoubleExponential_ffv_219;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_220> AgradCdfSkewDoubleExponential_ffv_220;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_221> AgradCdfSkewDoubleExponential_ffv_221;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_222> AgradCdfSkewDoubleExponential_ffv_222;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_223> AgradCdfSkewDoubleExponential_ffv_223;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_224> AgradCdfSkewDoubleExponential_ffv_224;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_225> AgradCdfSkewDoubleExponential_ffv_225;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_226> AgradCdfSkewDoubleExponential_ffv_226;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_227> AgradCdfSkewDoubleExponential_ffv_227;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_228> AgradCdfSkewDoubleExponential_ffv_228;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_229> AgradCdfSkewDoubleExponential_ffv_229;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_230> AgradCdfSkewDoubleExponential_ffv_230;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_231> AgradCdfSkewDoubleExponential_ffv_231;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_232> AgradCdfSkewDoubleExponential_ffv_232;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_233> AgradCdfSkewDoubleExponential_ffv_233;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_234> AgradCdfSkewDoubleExponential_ffv_234;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_235> AgradCdfSkewDoubleExponential_ffv_235;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_236> AgradCdfSkewDoubleExponential_ffv_236;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_237> AgradCdfSkewDoubleExponential_ffv_237;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_238> AgradCdfSkewDoubleExponential_ffv_238;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_239> AgradCdfSkewDoubleExponential_ffv_239;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_240> AgradCdfSkewDoubleExponential_ffv_240;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_241> AgradCdfSkewDoubleExponential_ffv_241;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_242> AgradCdfSkewDoubleExponential_ffv_242;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_243> AgradCdfSkewDoubleExponential_ffv_243;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_244> AgradCdfSkewDoubleExponential_ffv_244;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_245> AgradCdfSkewDoubleExponential_ffv_245;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_246> AgradCdfSkewDoubleExponential_ffv_246;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_247> AgradCdfSkewDoubleExponential_ffv_247;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_248> AgradCdfSkewDoubleExponential_ffv_248;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_249> AgradCdfSkewDoubleExponential_ffv_249;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_250> AgradCdfSkewDoubleExponential_ffv_250;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_251> AgradCdfSkewDoubleExponential_ffv_251;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_252> AgradCdfSkewDoubleExponential_ffv_252;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_253> AgradCdfSkewDoubleExponential_ffv_253;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_254> AgradCdfSkewDoubleExponential_ffv_254;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_255> AgradCdfSkewDoubleExponential_ffv_255;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_256> AgradCdfSkewDoubleExponential_ffv_256;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_257> AgradCdfSkewDoubleExponential_ffv_257;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_258> AgradCdfSkewDoubleExponential_ffv_258;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_259> AgradCdfSkewDoubleExponential_ffv_259;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_260> AgradCdfSkewDoubleExponential_ffv_260;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_261> AgradCdfSkewDoubleExponential_ffv_261;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_262> AgradCdfSkewDoubleExponential_ffv_262;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_263> AgradCdfSkewDoubleExponential_ffv_263;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_264> AgradCdfSkewDoubleExponential_ffv_264;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_265> AgradCdfSkewDoubleExponential_ffv_265;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_266> AgradCdfSkewDoubleExponential_ffv_266;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_267> AgradCdfSkewDoubleExponential_ffv_267;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_268> AgradCdfSkewDoubleExponential_ffv_268;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_269> AgradCdfSkewDoubleExponential_ffv_269;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_270> AgradCdfSkewDoubleExponential_ffv_270;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_271> AgradCdfSkewDoubleExponential_ffv_271;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_272> AgradCdfSkewDoubleExponential_ffv_272;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_273> AgradCdfSkewDoubleExponential_ffv_273;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_274> AgradCdfSkewDoubleExponential_ffv_274;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_275> AgradCdfSkewDoubleExponential_ffv_275;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_276> AgradCdfSkewDoubleExponential_ffv_276;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_277> AgradCdfSkewDoubleExponential_ffv_277;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_278> AgradCdfSkewDoubleExponential_ffv_278;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_279> AgradCdfSkewDoubleExponential_ffv_279;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_280> AgradCdfSkewDoubleExponential_ffv_280;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_281> AgradCdfSkewDoubleExponential_ffv_281;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_282> AgradCdfSkewDoubleExponential_ffv_282;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_283> AgradCdfSkewDoubleExponential_ffv_283;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_284> AgradCdfSkewDoubleExponential_ffv_284;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_285> AgradCdfSkewDoubleExponential_ffv_285;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_286> AgradCdfSkewDoubleExponential_ffv_286;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_287> AgradCdfSkewDoubleExponential_ffv_287;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_288> AgradCdfSkewDoubleExponential_ffv_288;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_289> AgradCdfSkewDoubleExponential_ffv_289;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_290> AgradCdfSkewDoubleExponential_ffv_290;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_291> AgradCdfSkewDoubleExponential_ffv_291;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_292> AgradCdfSkewDoubleExponential_ffv_292;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_293> AgradCdfSkewDoubleExponential_ffv_293;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_294> AgradCdfSkewDoubleExponential_ffv_294;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_295> AgradCdfSkewDoubleExponential_ffv_295;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_296> AgradCdfSkewDoubleExponential_ffv_296;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_297> AgradCdfSkewDoubleExponential_ffv_297;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_298> AgradCdfSkewDoubleExponential_ffv_298;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_299> AgradCdfSkewDoubleExponential_ffv_299;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_200, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_200);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_201, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_201);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_202, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_202);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_203, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_203);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_204, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_204);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_205, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_205);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_206, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_206);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_207, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_207);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_208, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_208);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_209, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_209);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_210, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_210);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_211, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_211);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_212, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_212);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_213, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_213);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_214, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_214);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_215, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_215);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_216, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_216);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_217, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_217);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_218, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_218);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_219, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_219);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_220, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_220);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_221, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_221);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_222, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_222);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_223, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_223);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_224, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_224);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_225, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_225);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_226, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_226);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_227, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_227);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_228, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_228);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_229, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_229);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_230, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_230);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_231, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_231);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_232, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_232);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_233, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_233);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_234, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_234);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_235, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_235);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_236, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_236);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_237, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_237);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_238, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_238);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_239, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_239);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_240, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_240);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_241, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_241);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_242, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_242);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_243, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_243);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_244, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_244);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_245, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_245);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_246, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_246);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_247, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_247);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_248, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_248);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_249, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_249);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_250, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_250);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_251, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_251);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_252, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_252);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_253, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_253);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_254, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_254);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_255, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_255);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_256, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_256);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_257, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_257);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_258, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_258);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_259, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_259);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_260, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_260);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_261, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_261);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_262, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_262);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_263, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_263);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_264, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_264);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_265, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_265);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_266, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_266);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_267, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_267);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_268, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_268);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_269, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_269);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_270, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_270);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_271, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_271);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_272, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_272);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_273, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_273);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_274, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_274);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_275, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_275);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_276, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_276);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_277, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_277);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_278, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_278);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_279, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_279);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_280, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_280);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_281, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_281);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_282, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_282);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_283, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_283);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_284, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_284);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_285, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_285);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_286, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_286);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_287, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_287);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_288, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_288);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_289, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_289);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_290, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_290);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_291, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_291);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_292, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_292);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_293, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_293);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_294, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_294);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_295, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_295);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_296, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_296);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_297, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_297);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_298, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_298);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_299, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_299);
+
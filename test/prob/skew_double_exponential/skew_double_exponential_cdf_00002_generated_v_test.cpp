@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/skew_double_exponential/skew_double_exponential_cdf_test.hpp>
+
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_200;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_201;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_202;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_203;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_204;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_205;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_206;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_207;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_208;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_209;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_210;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_211;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_212;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_213;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_214;
+typedef std::tuple<double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_215;
+typedef std::tuple<std::vector<double>, double, double, double, empty, empty> type_v_216;
+typedef std::tuple<std::vector<double>, double, double, std::vector<double>, empty, empty> type_v_217;
+typedef std::tuple<std::vector<double>, double, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_218;
+typedef std::tuple<std::vector<double>, double, double, var, empty, empty> type_v_219;
+typedef std::tuple<std::vector<double>, double, double, std::vector<var>, empty, empty> type_v_220;
+typedef std::tuple<std::vector<double>, double, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_221;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, double, empty, empty> type_v_222;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, std::vector<double>, empty, empty> type_v_223;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_224;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, var, empty, empty> type_v_225;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, std::vector<var>, empty, empty> type_v_226;
+typedef std::tuple<std::vector<double>, double, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_227;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_228;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_229;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_230;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_231;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_232;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_233;
+typedef std::tuple<std::vector<double>, double, var, double, empty, empty> type_v_234;
+typedef std::tuple<std::vector<double>, double, var, std::vector<double>, empty, empty> type_v_235;
+typedef std::tuple<std::vector<double>, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_236;
+typedef std::tuple<std::vector<double>, double, var, var, empty, empty> type_v_237;
+typedef std::tuple<std::vector<double>, double, var, std::vector<var>, empty, empty> type_v_238;
+typedef std::tuple<std::vector<double>, double, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_239;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, double, empty, empty> type_v_240;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, std::vector<double>, empty, empty> type_v_241;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_242;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, var, empty, empty> type_v_243;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, std::vector<var>, empty, empty> type_v_244;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_245;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_246;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_247;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_248;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_249;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_250;
+typedef std::tuple<std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_251;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, double, empty, empty> type_v_252;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, std::vector<double>, empty, empty> type_v_253;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_254;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, var, empty, empty> type_v_255;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, std::vector<var>, empty, empty> type_v_256;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_257;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, double, empty, empty> type_v_258;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, std::vector<double>, empty, empty> type_v_259;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_260;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, var, empty, empty> type_v_261;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_v_262;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_263;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_264;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_265;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_266;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_267;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_268;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_269;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, double, empty, empty> type_v_270;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, std::vector<double>, empty, empty> type_v_271;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_272;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, var, empty, empty> type_v_273;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, std::vector<var>, empty, empty> type_v_274;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_275;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, double, empty, empty> type_v_276;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_v_277;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_278;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, var, empty, empty> type_v_279;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_v_280;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_281;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_282;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_283;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_284;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_285;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_286;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_287;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_288;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_289;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_290;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_291;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_v_292;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_293;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_v_294;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_v_295;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_296;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_v_297;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_v_298;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_299;
+
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_200> AgradCdfSkewDoubleExponential_v_200;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_201> AgradCdfSkewDoubleExponential_v_201;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_202> AgradCdfSkewDoubleExponential_v_202;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_203> AgradCdfSkewDoubleExponential_v_203;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_204> AgradCdfSkewDoubleExponential_v_204;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_205> AgradCdfSkewDoubleExponential_v_205;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_206> AgradCdfSkewDoubleExponential_v_206;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_207> AgradCdfSkewDoubleExponential_v_207;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_208> AgradCdfSkewDoubleExponential_v_208;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_209> AgradCdfSkewDoubleExponential_v_209;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_210> AgradCdfSkewDoubleExponential_v_210;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_211> AgradCdfSkewDoubleExponential_v_211;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_212> AgradCdfSkewDoubleExponential_v_212;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_213> AgradCdfSkewDoubleExponential_v_213;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_214> AgradCdfSkewDoubleExponential_v_214;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_215> AgradCdfSkewDoubleExponential_v_215;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_216> AgradCdfSkewDoubleExponential_v_216;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_217> AgradCdfSkewDoubleExponential_v_217;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_218> AgradCdfSkewDoubleExponential_v_218;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_219> AgradCdfSkewDoubleExponential_v_219;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_220> AgradCdfSkewDoubleExponential_v_220;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_221> AgradCdfSkewDoubleExponential_v_221;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_222> AgradCdfSkewDoubleExponential_v_222;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_223> AgradCdfSkewDoubleExponential_v_223;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_224> AgradCdfSkewDoubleExponential_v_224;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_225> AgradCdfSkewDoubleExponential_v_225;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_226> AgradCdfSkewDoubleExponential_v_226;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_227> AgradCdfSkewDoubleExponential_v_227;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_228> AgradCdfSkewDoubleExponential_v_228;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_229> AgradCdfSkewDoubleExponential_v_229;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_230> AgradCdfSkewDoubleExponential_v_230;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_231> AgradCdfSkewDoubleExponential_v_231;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_232> AgradCdfSkewDoubleExponential_v_232;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_233> AgradCdfSkewDoubleExponential_v_233;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_234> AgradCdfSkewDoubleExponential_v_234;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_235> AgradCdfSkewDoubleExponential_v_235;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_236> AgradCdfSkewDoubleExponential_v_236;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_237> AgradCdfSkewDoubleExponential_v_237;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_238> AgradCdfSkewDoubleExponential_v_238;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_239> AgradCdfSkewDoubleExponential_v_239;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_240> AgradCdfSkewDoubleExponential_v_240;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_241> AgradCdfSkewDoubleExponential_v_241;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_242> AgradCdfSkewDoubleExponential_v_242;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_243> AgradCdfSkewDoubleExponential_v_243;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_244> AgradCdfSkewDoubleExponential_v_244;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_245> AgradCdfSkewDoubleExponential_v_245;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_246> AgradCdfSkewDoubleExponential_v_246;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_247> AgradCdfSkewDoubleExponential_v_247;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_248> AgradCdfSkewDoubleExponential_v_248;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_249> AgradCdfSkewDoubleExponential_v_249;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_250> AgradCdfSkewDoubleExponential_v_250;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_251> AgradCdfSkewDoubleExponential_v_251;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_252> AgradCdfSkewDoubleExponential_v_252;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_253> AgradCdfSkewDoubleExponential_v_253;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_254> AgradCdfSkewDoubleExponential_v_254;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_255> AgradCdfSkewDoubleExponential_v_255;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_256> AgradCdfSkewDoubleExponential_v_256;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_257> AgradCdfSkewDoubleExponential_v_257;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_258> AgradCdfSkewDoubleExponential_v_258;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_259> AgradCdfSkewDoubleExponential_v_259;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_260> AgradCdfSkewDoubleExponential_v_260;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_261> AgradCdfSkewDoubleExponential_v_261;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_262> AgradCdfSkewDoubleExponential_v_262;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_263> AgradCdfSkewDoubleExponential_v_263;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_264> AgradCdfSkewDoubleExponential_v_264;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_265> AgradCdfSkewDoubleExponential_v_265;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_266> AgradCdfSkewDoubleExponential_v_266;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_267> AgradCdfSkewDoubleExponential_v_267;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_268> AgradCdfSkewDoubleExponential_v_268;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_269> AgradCdfSkewDoubleExponential_v_269;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_270> AgradCdfSkewDoubleExponential_v_270;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_271> AgradCdfSkewDoubleExponential_v_271;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_272> AgradCdfSkewDoubleExponential_v_272;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_273> AgradCdfSkewDoubleExponential_v_273;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_274> AgradCdfSkewDoubleExponential_v_274;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_275> AgradCdfSkewDoubleExponential_v_275;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_276> AgradCdfSkewDoubleExponential_v_276;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_277> AgradCdfSkewDoubleExponential_v_277;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_278> AgradCdfSkewDoubleExponential_v_278;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_279> AgradCdfSkewDoubleExponential_v_279;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_280> AgradCdfSkewDoubleExponential_v_280;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_281> AgradCdfSkewDoubleExponential_v_281;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_282> AgradCdfSkewDoubleExponential_v_282;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_283> AgradCdfSkewDoubleExponential_v_283;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_284> AgradCdfSkewDoubleExponential_v_284;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_285> AgradCdfSkewDoubleExponential_v_285;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_286> AgradCdfSkewDoubleExponential_v_286;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_287> AgradCdfSkewDoubleExponential_v_287;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_288> AgradCdfSkewDoubleExponential_v_288;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_289> AgradCdfSkewDoubleExponential_v_289;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_290> AgradCdfSkewDoubleExponential_v_290;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_291> AgradCdfSkewDoubleExponential_v_291;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_292> AgradCdfSkewDoubleExponential_v_292;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_293> AgradCdfSkewDoubleExponential_v_293;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_294> AgradCdfSkewDoubleExponential_v_294;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_295> AgradCdfSkewDoubleExponential_v_295;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_296> AgradCdfSkewDoubleExponential_v_296;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_297> AgradCdfSkewDoubleExponential_v_297;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_298> AgradCdfSkewDoubleExponential_v_298;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_299> AgradCdfSkewDoubleExponential_v_299;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_200, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_200);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_201, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_201);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_202, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_202);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_203, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_203);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_204, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_204);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_205, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_205);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_206, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_206);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_207, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_207);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_208, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_208);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_209, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_209);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_210, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_210);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_211, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_211);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_212, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_212);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_213, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_213);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_214, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_214);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_215, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_215);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_216, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_216);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_217, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_217);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_218, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_218);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_219, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_219);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_220, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_220);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_221, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_221);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_222, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_222);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_223, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_223);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_224, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_224);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_225, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_225);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_226, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_226);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_227, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_227);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_228, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_228);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_229, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_229);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_230, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_230);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_231, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_231);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_232, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_232);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_233, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_233);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_234, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_234);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_235, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_235);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_236, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_236);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_237, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_237);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_238, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_238);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_239, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_239);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_240, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_240);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_241, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_241);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_242, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_242);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_243, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_243);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_244, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_244);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_245, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_245);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_246, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_246);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_247, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_247);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_248, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_248);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_249, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_249);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_250, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_250);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_251, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_251);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_252, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_252);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_253, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_253);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_254, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_254);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_255, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_255);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_256, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_256);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_257, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_257);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_258, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_258);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_259, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_259);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_260, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_260);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_261, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_261);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_262, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_262);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_263, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_263);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_264, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_264);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_265, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_265);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_266, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_266);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_267, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_267);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_268, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_268);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_269, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_269);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_270, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_270);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_271, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_271);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_272, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_272);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_273, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_273);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_274, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_274);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_275, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_275);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_276, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_276);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_277, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_277);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_278, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_278);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_279, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_279);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_280, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_280);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_281, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_281);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_282, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_282);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_283, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_283);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_284, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_284);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_285, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_285);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_286, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_286);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_287, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_287);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_288, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_288);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_289, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_289);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_290, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_290);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_291, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_291);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_292, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_292);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_293, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_293);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_294, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_294);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_295, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_295);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_296, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_296);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_297, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_297);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_298, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_298);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_299, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_299);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/skew_double_exponential/skew_double_exponential_cdf_test.hpp>
+
+typedef std::tuple<std::vector<double>, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_200;
+typedef std::tuple<std::vector<double>, double, var, var, empty, empty> type_vv_201;
+typedef std::tuple<std::vector<double>, double, var, std::vector<var>, empty, empty> type_vv_202;
+typedef std::tuple<std::vector<double>, double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_203;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, double, empty, empty> type_vv_204;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, std::vector<double>, empty, empty> type_vv_205;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_206;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, var, empty, empty> type_vv_207;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, std::vector<var>, empty, empty> type_vv_208;
+typedef std::tuple<std::vector<double>, double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_209;
+typedef std::tuple<std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_210;
+typedef std::tuple<std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_211;
+typedef std::tuple<std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_212;
+typedef std::tuple<std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_213;
+typedef std::tuple<std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_214;
+typedef std::tuple<std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_215;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, var, empty, empty> type_vv_216;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, std::vector<var>, empty, empty> type_vv_217;
+typedef std::tuple<std::vector<double>, std::vector<double>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_218;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, var, empty, empty> type_vv_219;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, std::vector<var>, empty, empty> type_vv_220;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_221;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_222;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_223;
+typedef std::tuple<std::vector<double>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_224;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, double, empty, empty> type_vv_225;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, std::vector<double>, empty, empty> type_vv_226;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_227;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, var, empty, empty> type_vv_228;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, std::vector<var>, empty, empty> type_vv_229;
+typedef std::tuple<std::vector<double>, std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_230;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, double, empty, empty> type_vv_231;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, std::vector<double>, empty, empty> type_vv_232;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_233;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, var, empty, empty> type_vv_234;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, std::vector<var>, empty, empty> type_vv_235;
+typedef std::tuple<std::vector<double>, std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_236;
+typedef std::tuple<std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_237;
+typedef std::tuple<std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_238;
+typedef std::tuple<std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_239;
+typedef std::tuple<std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_240;
+typedef std::tuple<std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_241;
+typedef std::tuple<std::vector<double>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_242;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, empty, empty> type_vv_243;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, empty, empty> type_vv_244;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_245;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, var, empty, empty> type_vv_246;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, std::vector<var>, empty, empty> type_vv_247;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_248;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_249;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_250;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_251;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_vv_252;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_vv_253;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_254;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_vv_255;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_vv_256;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_257;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_vv_258;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_vv_259;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_260;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_vv_261;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_vv_262;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_263;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_264;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_265;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_266;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_267;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_268;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_269;
+typedef std::tuple<std::vector<double>, var, double, double, empty, empty> type_vv_270;
+typedef std::tuple<std::vector<double>, var, double, std::vector<double>, empty, empty> type_vv_271;
+typedef std::tuple<std::vector<double>, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_272;
+typedef std::tuple<std::vector<double>, var, double, var, empty, empty> type_vv_273;
+typedef std::tuple<std::vector<double>, var, double, std::vector<var>, empty, empty> type_vv_274;
+typedef std::tuple<std::vector<double>, var, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_275;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, double, empty, empty> type_vv_276;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, std::vector<double>, empty, empty> type_vv_277;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_278;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, var, empty, empty> type_vv_279;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, std::vector<var>, empty, empty> type_vv_280;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_281;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_282;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_283;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_284;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_285;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_286;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_287;
+typedef std::tuple<std::vector<double>, var, var, double, empty, empty> type_vv_288;
+typedef std::tuple<std::vector<double>, var, var, std::vector<double>, empty, empty> type_vv_289;
+typedef std::tuple<std::vector<double>, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_290;
+typedef std::tuple<std::vector<double>, var, var, var, empty, empty> type_vv_291;
+typedef std::tuple<std::vector<double>, var, var, std::vector<var>, empty, empty> type_vv_292;
+typedef std::tuple<std::vector<double>, var, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_293;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, double, empty, empty> type_vv_294;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, std::vector<double>, empty, empty> type_vv_295;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_296;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, var, empty, empty> type_vv_297;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, std::vector<var>, empty, empty> type_vv_298;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_299;
+
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_200> AgradCdfSkewDoubleExponential_vv_200;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_201> AgradCdfSkewDoubleExponential_vv_201;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_202> AgradCdfSkewDoubleExponential_vv_202;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_203> AgradCdfSkewDoubleExponential_vv_203;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_204> AgradCdfSkewDoubleExponential_vv_204;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_205> AgradCdfSkewDoubleExponential_vv_205;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_206> AgradCdfSkewDoubleExponential_vv_206;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_207> AgradCdfSkewDoubleExponential_vv_207;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_208> AgradCdfSkewDoubleExponential_vv_208;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_209> AgradCdfSkewDoubleExponential_vv_209;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_210> AgradCdfSkewDoubleExponential_vv_210;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_211> AgradCdfSkewDoubleExponential_vv_211;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_212> AgradCdfSkewDoubleExponential_vv_212;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_213> AgradCdfSkewDoubleExponential_vv_213;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_214> AgradCdfSkewDoubleExponential_vv_214;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_215> AgradCdfSkewDoubleExponential_vv_215;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_216> AgradCdfSkewDoubleExponential_vv_216;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_217> AgradCdfSkewDoubleExponential_vv_217;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_218> AgradCdfSkewDoubleExponential_vv_218;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_219> AgradCdfSkewDoubleExponential_vv_219;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_220> AgradCdfSkewDoubleExponential_vv_220;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_221> AgradCdfSkewDoubleExponential_vv_221;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_222> AgradCdfSkewDoubleExponential_vv_222;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_223> AgradCdfSkewDoubleExponential_vv_223;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_224> AgradCdfSkewDoubleExponential_vv_224;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_225> AgradCdfSkewDoubleExponential_vv_225;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_226> AgradCdfSkewDoubleExponential_vv_226;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_227> AgradCdfSkewDoubleExponential_vv_227;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_228> AgradCdfSkewDoubleExponential_vv_228;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_229> AgradCdfSkewDoubleExponential_vv_229;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_230> AgradCdfSkewDoubleExponential_vv_230;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_231> AgradCdfSkewDoubleExponential_vv_231;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_232> AgradCdfSkewDoubleExponential_vv_232;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_233> AgradCdfSkewDoubleExponential_vv_233;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_234> AgradCdfSkewDoubleExponential_vv_234;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_235> AgradCdfSkewDoubleExponential_vv_235;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_236> AgradCdfSkewDoubleExponential_vv_236;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_237> AgradCdfSkewDoubleExponential_vv_237;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_238> AgradCdfSkewDoubleExponential_vv_238;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_239> AgradCdfSkewDoubleExponential_vv_239;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_240> AgradCdfSkewDoubleExponential_vv_240;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_241> AgradCdfSkewDoubleExponential_vv_241;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_242> AgradCdfSkewDoubleExponential_vv_242;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_243> AgradCdfSkewDoubleExponential_vv_243;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_244> AgradCdfSkewDoubleExponential_vv_244;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_245> AgradCdfSkewDoubleExponential_vv_245;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_246> AgradCdfSkewDoubleExponential_vv_246;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_247> AgradCdfSkewDoubleExponential_vv_247;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_248> AgradCdfSkewDoubleExponential_vv_248;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_249> AgradCdfSkewDoubleExponential_vv_249;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_250> AgradCdfSkewDoubleExponential_vv_250;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_251> AgradCdfSkewDoubleExponential_vv_251;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_252> AgradCdfSkewDoubleExponential_vv_252;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_253> AgradCdfSkewDoubleExponential_vv_253;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_254> AgradCdfSkewDoubleExponential_vv_254;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_255> AgradCdfSkewDoubleExponential_vv_255;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_256> AgradCdfSkewDoubleExponential_vv_256;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_257> AgradCdfSkewDoubleExponential_vv_257;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_258> AgradCdfSkewDoubleExponential_vv_258;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_259> AgradCdfSkewDoubleExponential_vv_259;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_260> AgradCdfSkewDoubleExponential_vv_260;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_261> AgradCdfSkewDoubleExponential_vv_261;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_262> AgradCdfSkewDoubleExponential_vv_262;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_263> AgradCdfSkewDoubleExponential_vv_263;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_264> AgradCdfSkewDoubleExponential_vv_264;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_265> AgradCdfSkewDoubleExponential_vv_265;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_266> AgradCdfSkewDoubleExponential_vv_266;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_267> AgradCdfSkewDoubleExponential_vv_267;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_268> AgradCdfSkewDoubleExponential_vv_268;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_269> AgradCdfSkewDoubleExponential_vv_269;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_270> AgradCdfSkewDoubleExponential_vv_270;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_271> AgradCdfSkewDoubleExponential_vv_271;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_272> AgradCdfSkewDoubleExponential_vv_272;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_273> AgradCdfSkewDoubleExponential_vv_273;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_274> AgradCdfSkewDoubleExponential_vv_274;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_275> AgradCdfSkewDoubleExponential_vv_275;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_276> AgradCdfSkewDoubleExponential_vv_276;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_277> AgradCdfSkewDoubleExponential_vv_277;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_278> AgradCdfSkewDoubleExponential_vv_278;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_279> AgradCdfSkewDoubleExponential_vv_279;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_280> AgradCdfSkewDoubleExponential_vv_280;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_281> AgradCdfSkewDoubleExponential_vv_281;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_282> AgradCdfSkewDoubleExponential_vv_282;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_283> AgradCdfSkewDoubleExponential_vv_283;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_284> AgradCdfSkewDoubleExponential_vv_284;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_285> AgradCdfSkewDoubleExponential_vv_285;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_286> AgradCdfSkewDoubleExponential_vv_286;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_287> AgradCdfSkewDoubleExponential_vv_287;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_288> AgradCdfSkewDoubleExponential_vv_288;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_289> AgradCdfSkewDoubleExponential_vv_289;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_290> AgradCdfSkewDoubleExponential_vv_290;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_291> AgradCdfSkewDoubleExponential_vv_291;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_292> AgradCdfSkewDoubleExponential_vv_292;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_293> AgradCdfSkewDoubleExponential_vv_293;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_294> AgradCdfSkewDoubleExponential_vv_294;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_295> AgradCdfSkewDoubleExponential_vv_295;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_296> AgradCdfSkewDoubleExponential_vv_296;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_297> AgradCdfSkewDoubleExponential_vv_297;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_298> AgradCdfSkewDoubleExponential_vv_298;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_299> AgradCdfSkewDoubleExponential_vv_299;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_200, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_200);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_201, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_201);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_202, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_202);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_203, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_203);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_204, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_204);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_205, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_205);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_206, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_206);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_207, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_207);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_208, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_208);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_209, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_209);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_210, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_210);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_211, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_211);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_212, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_212);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_213, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_213);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_214, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_214);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_215, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_215);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_216, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_216);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_217, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_217);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_218, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_218);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_219, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_219);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_220, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_220);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_221, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_221);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_222, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_222);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_223, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_223);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_224, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_224);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_225, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_225);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_226, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_226);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_227, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_227);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_228, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_228);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_229, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_229);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_230, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_230);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_231, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_231);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_232, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_232);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_233, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_233);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_234, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_234);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_235, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_235);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_236, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_236);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_237, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_237);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_238, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_238);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_239, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_239);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_240, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_240);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_241, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_241);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_242, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_242);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_243, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_243);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_244, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_244);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_245, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_245);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_246, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_246);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_247, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_247);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_248, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_248);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_249, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_249);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_250, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_250);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_251, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_251);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_252, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_252);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_253, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_253);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_254, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_254);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_255, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_255);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_256, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_256);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_257, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_257);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_258, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_258);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_259, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_259);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_260, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_260);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_261, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_261);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_262, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_262);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_263, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_263);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_264, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_264);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_265, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_265);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_266, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_266);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_267, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_267);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_268, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_268);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_269, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_269);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_270, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_270);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_271, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_271);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_272, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_272);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_273, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_273);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_274, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_274);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_275, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_275);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_276, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_276);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_277, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_277);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_278, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_278);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_279, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_279);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_280, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_280);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_281, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_281);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_282, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_282);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_283, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_283);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_284, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_284);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_285, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_285);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_286, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_286);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_287, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_287);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_288, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_288);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_289, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_289);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_290, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_290);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_291, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_291);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_292, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_292);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_293, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_293);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_294, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_294);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_295, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_295);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_296, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_296);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_297, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_297);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_298, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_298);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_299, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_299);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/skew_double_exponential/skew_double_exponential_cdf_test.hpp>
+
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_300;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_301;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_302;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_303;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_304;
+typedef std::tuple<std::vector<double>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_305;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, double, double, empty, empty> type_ffv_306;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, double, std::vector<double>, empty, empty> type_ffv_307;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_308;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, double, fvar<fvar<var> >, empty, empty> type_ffv_309;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_310;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_311;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, double, empty, empty> type_ffv_312;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_313;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_314;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_315;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_316;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_317;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_318;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_319;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_320;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_321;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_322;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_323;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, double, empty, empty> type_ffv_324;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_325;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_326;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_327;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_328;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_329;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_330;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_331;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_332;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_333;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_334;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_335;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_336;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_337;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_338;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_339;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_340;
+typedef std::tuple<std::vector<double>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_341;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, double, empty, empty> type_ffv_342;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_ffv_343;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_344;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, empty, empty> type_ffv_345;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_346;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_347;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, double, empty, empty> type_ffv_348;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<double>, empty, empty> type_ffv_349;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_350;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_351;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_352;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_353;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_354;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_355;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_356;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_357;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_358;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_359;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, double, empty, empty> type_ffv_360;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_361;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_362;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_363;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_364;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_365;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_366;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_367;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_368;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_369;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_370;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_371;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_372;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_ffv_373;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_374;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_375;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_376;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_377;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, fvar<fvar<var> >, empty, empty> type_ffv_378;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_379;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_380;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, fvar<fvar<var> >, empty, empty> type_ffv_381;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_382;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_383;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, fvar<fvar<var> >, empty, empty> type_ffv_384;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_385;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_386;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, double, empty, empty> type_ffv_387;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, std::vector<double>, empty, empty> type_ffv_388;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_389;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, fvar<fvar<var> >, empty, empty> type_ffv_390;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_391;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, fvar<fvar<var> >, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_392;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, double, empty, empty> type_ffv_393;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, std::vector<double>, empty, empty> type_ffv_394;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_ffv_395;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, fvar<fvar<var> >, empty, empty> type_ffv_396;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, std::vector<fvar<fvar<var> >>, empty, empty> type_ffv_397;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<fvar<fvar<var> >>, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, empty, empty> type_ffv_398;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<fvar<fvar<var> >, Eigen::Dynamic, 1>, double, empty, empty> type_ffv_399;
+
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_300> AgradCdfSkewDoubleExponential_ffv_300;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_301> AgradCdfSkewDoubleExponential_ffv_301;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_302> AgradCdfSkewDoubleExponential_ffv_302;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_303> AgradCdfSkewDoubleExponential_ffv_303;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_304> AgradCdfSkewDoubleExponential_ffv_304;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_305> AgradCdfSkewDoubleExponential_ffv_305;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_306> AgradCdfSkewDoubleExponential_ffv_306;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_307> AgradCdfSkewDoubleExponential_ffv_307;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_308> AgradCdfSkewDoubleExponential_ffv_308;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_309> AgradCdfSkewDoubleExponential_ffv_309;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_310> AgradCdfSkewDoubleExponential_ffv_310;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_311> AgradCdfSkewDoubleExponential_ffv_311;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_312> AgradCdfSkewDoubleExponential_ffv_312;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_313> AgradCdfSkewDoubleExponential_ffv_313;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_314> AgradCdfSkewDoubleExponential_ffv_314;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_315> AgradCdfSkewDoubleExponential_ffv_315;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_316> AgradCdfSkewDoubleExponential_ffv_316;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_317> AgradCdfSkewDoubleExponential_ffv_317;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_318> AgradCdfSkewDoubleExponential_ffv_318;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_319> AgradCdfSkewDoubleExponential_ffv_319;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_320> AgradCdfSkewDoubleExponential_ffv_320;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_321> AgradCdfSkewDoubleExponential_ffv_321;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_322> AgradCdfSkewDoubleExponential_ffv_322;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_323> AgradCdfSkewDoubleExponential_ffv_323;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_324> AgradCdfSkewDoubleExponential_ffv_324;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_325> AgradCdfSkewDoubleExponential_ffv_325;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_326> AgradCdfSkewDoubleExponential_ffv_326;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_327> AgradCdfSkewDoubleExponential_ffv_327;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_328> AgradCdfSkewDoubleExponential_ffv_328;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_329> AgradCdfSkewDoubleExponential_ffv_329;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_330> AgradCdfSkewDoubleExponential_ffv_330;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_331> AgradCdfSkewDoubleExponential_ffv_331;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_332> AgradCdfSkewDoubleExponential_ffv_332;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_333> AgradCdfSkewDoubleExponential_ffv_333;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_334> AgradCdfSkewDoubleExponential_ffv_334;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_335> AgradCdfSkewDoubleExponential_ffv_335;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_336> AgradCdfSkewDoubleExponential_ffv_336;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_337> AgradCdfSkewDoubleExponential_ffv_337;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_338> AgradCdfSkewDoubleExponential_ffv_338;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_339> AgradCdfSkewDoubleExponential_ffv_339;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_340> AgradCdfSkewDoubleExponential_ffv_340;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_341> AgradCdfSkewDoubleExponential_ffv_341;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_342> AgradCdfSkewDoubleExponential_ffv_342;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_343> AgradCdfSkewDoubleExponential_ffv_343;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_344> AgradCdfSkewDoubleExponential_ffv_344;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_345> AgradCdfSkewDoubleExponential_ffv_345;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_346> AgradCdfSkewDoubleExponential_ffv_346;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_347> AgradCdfSkewDoubleExponential_ffv_347;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_348> AgradCdfSkewDoubleExponential_ffv_348;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_349> AgradCdfSkewDoubleExponential_ffv_349;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_350> AgradCdfSkewDoubleExponential_ffv_350;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_351> AgradCdfSkewDoubleExponential_ffv_351;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_352> AgradCdfSkewDoubleExponential_ffv_352;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_353> AgradCdfSkewDoubleExponential_ffv_353;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_354> AgradCdfSkewDoubleExponential_ffv_354;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_355> AgradCdfSkewDoubleExponential_ffv_355;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_356> AgradCdfSkewDoubleExponential_ffv_356;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_357> AgradCdfSkewDoubleExponential_ffv_357;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_358> AgradCdfSkewDoubleExponential_ffv_358;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_359> AgradCdfSkewDoubleExponential_ffv_359;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_360> AgradCdfSkewDoubleExponential_ffv_360;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_361> AgradCdfSkewDoubleExponential_ffv_361;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_362> AgradCdfSkewDoubleExponential_ffv_362;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_363> AgradCdfSkewDoubleExponential_ffv_363;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_364> AgradCdfSkewDoubleExponential_ffv_364;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_365> AgradCdfSkewDoubleExponential_ffv_365;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_366> AgradCdfSkewDoubleExponential_ffv_366;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_367> AgradCdfSkewDoubleExponential_ffv_367;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_368> AgradCdfSkewDoubleExponential_ffv_368;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_369> AgradCdfSkewDoubleExponential_ffv_369;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_370> AgradCdfSkewDoubleExponential_ffv_370;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_371> AgradCdfSkewDoubleExponential_ffv_371;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_372> AgradCdfSkewDoubleExponential_ffv_372;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_373> AgradCdfSkewDoubleExponential_ffv_373;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_374> AgradCdfSkewDoubleExponential_ffv_374;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_375> AgradCdfSkewDoubleExponential_ffv_375;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_376> AgradCdfSkewDoubleExponential_ffv_376;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_377> AgradCdfSkewDoubleExponential_ffv_377;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_378> AgradCdfSkewDoubleExponential_ffv_378;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_379> AgradCdfSkewDoubleExponential_ffv_379;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_380> AgradCdfSkewDoubleExponential_ffv_380;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_381> AgradCdfSkewDoubleExponential_ffv_381;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_382> AgradCdfSkewDoubleExponential_ffv_382;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_383> AgradCdfSkewDoubleExponential_ffv_383;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_384> AgradCdfSkewDoubleExponential_ffv_384;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_385> AgradCdfSkewDoubleExponential_ffv_385;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_386> AgradCdfSkewDoubleExponential_ffv_386;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_387> AgradCdfSkewDoubleExponential_ffv_387;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_388> AgradCdfSkewDoubleExponential_ffv_388;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_389> AgradCdfSkewDoubleExponential_ffv_389;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_390> AgradCdfSkewDoubleExponential_ffv_390;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_391> AgradCdfSkewDoubleExponential_ffv_391;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_392> AgradCdfSkewDoubleExponential_ffv_392;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_393> AgradCdfSkewDoubleExponential_ffv_393;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_394> AgradCdfSkewDoubleExponential_ffv_394;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_395> AgradCdfSkewDoubleExponential_ffv_395;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_396> AgradCdfSkewDoubleExponential_ffv_396;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_397> AgradCdfSkewDoubleExponential_ffv_397;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_398> AgradCdfSkewDoubleExponential_ffv_398;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_ffv_399> AgradCdfSkewDoubleExponential_ffv_399;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_300, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_300);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_301, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_301);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_302, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_302);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_303, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_303);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_304, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_304);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_305, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_305);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_306, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_306);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_307, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_307);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_308, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_308);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_309, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_309);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_310, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_310);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_311, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_311);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_312, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_312);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_313, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_313);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_314, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_314);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_315, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_315);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_316, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_316);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_317, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_317);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_318, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_318);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_319, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_319);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_320, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_320);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_321, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_321);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_322, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_322);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_323, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_323);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_324, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_324);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_325, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_325);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_326, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_326);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_327, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_327);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_328, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_328);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_329, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_329);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_330, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_330);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_331, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_331);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_332, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_332);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_333, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_333);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_334, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_334);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_335, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_335);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_336, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_336);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_337, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_337);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_338, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_338);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_339, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_339);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_340, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_340);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_341, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_341);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_342, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_342);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_343, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_343);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_344, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_344);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_345, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_345);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_346, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_346);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_347, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_347);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_348, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_348);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_349, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_349);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_350, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_350);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_351, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_351);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_352, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_352);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_353, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_353);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_354, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_354);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_355, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_355);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_356, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_356);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_357, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_357);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_358, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_358);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_359, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_359);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_360, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_360);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_361, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_361);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_362, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_362);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_363, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_363);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_364, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_364);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_365, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_365);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_366, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_366);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_367, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_367);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_368, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_368);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_369, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_369);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_370, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_370);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_371, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_371);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_372, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_372);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_373, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_373);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_374, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_374);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_375, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_375);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_376, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_376);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_377, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_377);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_378, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_378);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_379, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_379);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_380, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_380);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_381, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_381);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_382, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_382);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_383, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_383);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_384, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_384);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_385, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_385);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_386, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_386);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_387, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_387);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_388, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_388);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_389, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_389);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_390, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_390);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_391, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_391);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_392, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_392);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_393, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_393);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_394, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_394);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_395, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_395);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_396, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_396);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_397, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_397);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_398, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_398);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_ffv_399, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_ffv_399);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/skew_double_exponential/skew_double_exponential_cdf_test.hpp>
+
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_300;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_301;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_302;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_303;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_304;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_305;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, double, empty, empty> type_v_306;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<double>, empty, empty> type_v_307;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_308;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, var, empty, empty> type_v_309;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, std::vector<var>, empty, empty> type_v_310;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_311;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, double, empty, empty> type_v_312;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<double>, empty, empty> type_v_313;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_314;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, var, empty, empty> type_v_315;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, std::vector<var>, empty, empty> type_v_316;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_317;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_318;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_319;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_320;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_321;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_322;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_323;
+typedef std::tuple<std::vector<double>, var, double, double, empty, empty> type_v_324;
+typedef std::tuple<std::vector<double>, var, double, std::vector<double>, empty, empty> type_v_325;
+typedef std::tuple<std::vector<double>, var, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_326;
+typedef std::tuple<std::vector<double>, var, double, var, empty, empty> type_v_327;
+typedef std::tuple<std::vector<double>, var, double, std::vector<var>, empty, empty> type_v_328;
+typedef std::tuple<std::vector<double>, var, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_329;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, double, empty, empty> type_v_330;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, std::vector<double>, empty, empty> type_v_331;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_332;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, var, empty, empty> type_v_333;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, std::vector<var>, empty, empty> type_v_334;
+typedef std::tuple<std::vector<double>, var, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_335;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_336;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_337;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_338;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_339;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_340;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_341;
+typedef std::tuple<std::vector<double>, var, var, double, empty, empty> type_v_342;
+typedef std::tuple<std::vector<double>, var, var, std::vector<double>, empty, empty> type_v_343;
+typedef std::tuple<std::vector<double>, var, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_344;
+typedef std::tuple<std::vector<double>, var, var, var, empty, empty> type_v_345;
+typedef std::tuple<std::vector<double>, var, var, std::vector<var>, empty, empty> type_v_346;
+typedef std::tuple<std::vector<double>, var, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_347;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, double, empty, empty> type_v_348;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, std::vector<double>, empty, empty> type_v_349;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_350;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, var, empty, empty> type_v_351;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, std::vector<var>, empty, empty> type_v_352;
+typedef std::tuple<std::vector<double>, var, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_353;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_354;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_355;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_356;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_357;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_358;
+typedef std::tuple<std::vector<double>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_359;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, double, empty, empty> type_v_360;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, std::vector<double>, empty, empty> type_v_361;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_362;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, var, empty, empty> type_v_363;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, std::vector<var>, empty, empty> type_v_364;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_365;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, double, empty, empty> type_v_366;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_v_367;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_368;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, var, empty, empty> type_v_369;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_v_370;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_371;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_v_372;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_373;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_374;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_v_375;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_376;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_377;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, double, empty, empty> type_v_378;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, std::vector<double>, empty, empty> type_v_379;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_380;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, var, empty, empty> type_v_381;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, std::vector<var>, empty, empty> type_v_382;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_383;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, double, empty, empty> type_v_384;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_v_385;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_386;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, var, empty, empty> type_v_387;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_v_388;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_389;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, empty, empty> type_v_390;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_v_391;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_392;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, var, empty, empty> type_v_393;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_v_394;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<var, Eigen::Dynamic, 1>, Eigen::Matrix<var, Eigen::Dynamic, 1>, empty, empty> type_v_395;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, double, empty, empty> type_v_396;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, std::vector<double>, empty, empty> type_v_397;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_v_398;
+typedef std::tuple<std::vector<double>, Eigen::Matrix<var, Eigen::Dynamic, 1>, double, var, empty, empty> type_v_399;
+
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_300> AgradCdfSkewDoubleExponential_v_300;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_301> AgradCdfSkewDoubleExponential_v_301;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_302> AgradCdfSkewDoubleExponential_v_302;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_303> AgradCdfSkewDoubleExponential_v_303;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_304> AgradCdfSkewDoubleExponential_v_304;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_305> AgradCdfSkewDoubleExponential_v_305;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_306> AgradCdfSkewDoubleExponential_v_306;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_307> AgradCdfSkewDoubleExponential_v_307;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_308> AgradCdfSkewDoubleExponential_v_308;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_309> AgradCdfSkewDoubleExponential_v_309;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_310> AgradCdfSkewDoubleExponential_v_310;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_311> AgradCdfSkewDoubleExponential_v_311;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_312> AgradCdfSkewDoubleExponential_v_312;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_313> AgradCdfSkewDoubleExponential_v_313;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_314> AgradCdfSkewDoubleExponential_v_314;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_315> AgradCdfSkewDoubleExponential_v_315;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_316> AgradCdfSkewDoubleExponential_v_316;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_317> AgradCdfSkewDoubleExponential_v_317;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_318> AgradCdfSkewDoubleExponential_v_318;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_319> AgradCdfSkewDoubleExponential_v_319;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_320> AgradCdfSkewDoubleExponential_v_320;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_321> AgradCdfSkewDoubleExponential_v_321;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_322> AgradCdfSkewDoubleExponential_v_322;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_323> AgradCdfSkewDoubleExponential_v_323;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_324> AgradCdfSkewDoubleExponential_v_324;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_325> AgradCdfSkewDoubleExponential_v_325;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_326> AgradCdfSkewDoubleExponential_v_326;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_327> AgradCdfSkewDoubleExponential_v_327;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_328> AgradCdfSkewDoubleExponential_v_328;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_329> AgradCdfSkewDoubleExponential_v_329;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_330> AgradCdfSkewDoubleExponential_v_330;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_331> AgradCdfSkewDoubleExponential_v_331;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_332> AgradCdfSkewDoubleExponential_v_332;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_333> AgradCdfSkewDoubleExponential_v_333;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_334> AgradCdfSkewDoubleExponential_v_334;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_335> AgradCdfSkewDoubleExponential_v_335;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_336> AgradCdfSkewDoubleExponential_v_336;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_337> AgradCdfSkewDoubleExponential_v_337;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_338> AgradCdfSkewDoubleExponential_v_338;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_339> AgradCdfSkewDoubleExponential_v_339;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_340> AgradCdfSkewDoubleExponential_v_340;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_341> AgradCdfSkewDoubleExponential_v_341;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_342> AgradCdfSkewDoubleExponential_v_342;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_343> AgradCdfSkewDoubleExponential_v_343;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_344> AgradCdfSkewDoubleExponential_v_344;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_345> AgradCdfSkewDoubleExponential_v_345;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_346> AgradCdfSkewDoubleExponential_v_346;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_347> AgradCdfSkewDoubleExponential_v_347;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_348> AgradCdfSkewDoubleExponential_v_348;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_349> AgradCdfSkewDoubleExponential_v_349;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_350> AgradCdfSkewDoubleExponential_v_350;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_351> AgradCdfSkewDoubleExponential_v_351;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_352> AgradCdfSkewDoubleExponential_v_352;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_353> AgradCdfSkewDoubleExponential_v_353;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_354> AgradCdfSkewDoubleExponential_v_354;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_355> AgradCdfSkewDoubleExponential_v_355;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_356> AgradCdfSkewDoubleExponential_v_356;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_357> AgradCdfSkewDoubleExponential_v_357;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_358> AgradCdfSkewDoubleExponential_v_358;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_359> AgradCdfSkewDoubleExponential_v_359;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_360> AgradCdfSkewDoubleExponential_v_360;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_361> AgradCdfSkewDoubleExponential_v_361;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_362> AgradCdfSkewDoubleExponential_v_362;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_363> AgradCdfSkewDoubleExponential_v_363;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_364> AgradCdfSkewDoubleExponential_v_364;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_365> AgradCdfSkewDoubleExponential_v_365;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_366> AgradCdfSkewDoubleExponential_v_366;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_367> AgradCdfSkewDoubleExponential_v_367;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_368> AgradCdfSkewDoubleExponential_v_368;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_369> AgradCdfSkewDoubleExponential_v_369;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_370> AgradCdfSkewDoubleExponential_v_370;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_371> AgradCdfSkewDoubleExponential_v_371;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_372> AgradCdfSkewDoubleExponential_v_372;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_373> AgradCdfSkewDoubleExponential_v_373;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_374> AgradCdfSkewDoubleExponential_v_374;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_375> AgradCdfSkewDoubleExponential_v_375;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_376> AgradCdfSkewDoubleExponential_v_376;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_377> AgradCdfSkewDoubleExponential_v_377;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_378> AgradCdfSkewDoubleExponential_v_378;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_379> AgradCdfSkewDoubleExponential_v_379;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_380> AgradCdfSkewDoubleExponential_v_380;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_381> AgradCdfSkewDoubleExponential_v_381;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_382> AgradCdfSkewDoubleExponential_v_382;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_383> AgradCdfSkewDoubleExponential_v_383;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_384> AgradCdfSkewDoubleExponential_v_384;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_385> AgradCdfSkewDoubleExponential_v_385;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_386> AgradCdfSkewDoubleExponential_v_386;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_387> AgradCdfSkewDoubleExponential_v_387;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_388> AgradCdfSkewDoubleExponential_v_388;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_389> AgradCdfSkewDoubleExponential_v_389;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_390> AgradCdfSkewDoubleExponential_v_390;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_391> AgradCdfSkewDoubleExponential_v_391;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_392> AgradCdfSkewDoubleExponential_v_392;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_393> AgradCdfSkewDoubleExponential_v_393;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_394> AgradCdfSkewDoubleExponential_v_394;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_395> AgradCdfSkewDoubleExponential_v_395;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_396> AgradCdfSkewDoubleExponential_v_396;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_397> AgradCdfSkewDoubleExponential_v_397;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_398> AgradCdfSkewDoubleExponential_v_398;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_v_399> AgradCdfSkewDoubleExponential_v_399;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_300, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_300);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_301, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_301);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_302, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_302);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_303, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_303);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_304, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_304);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_305, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_305);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_306, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_306);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_307, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_307);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_308, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_308);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_309, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_309);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_310, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_310);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_311, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_311);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_312, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_312);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_313, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_313);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_314, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_314);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_315, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_315);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_316, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_316);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_317, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_317);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_318, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_318);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_319, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_319);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_320, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_320);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_321, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_321);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_322, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_322);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_323, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_323);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_324, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_324);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_325, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_325);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_326, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_326);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_327, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_327);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_328, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_328);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_329, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_329);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_330, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_330);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_331, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_331);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_332, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_332);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_333, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_333);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_334, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_334);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_335, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_335);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_336, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_336);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_337, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_337);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_338, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_338);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_339, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_339);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_340, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_340);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_341, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_341);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_342, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_342);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_343, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_343);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_344, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_344);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_345, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_345);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_346, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_346);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_347, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_347);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_348, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_348);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_349, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_349);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_350, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_350);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_351, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_351);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_352, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_352);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_353, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_353);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_354, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_354);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_355, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_355);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_356, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_356);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_357, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_357);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_358, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_358);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_359, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_359);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_360, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_360);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_361, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_361);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_362, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_362);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_363, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_363);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_364, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_364);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_365, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_365);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_366, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_366);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_367, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_367);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_368, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_368);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_369, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_369);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_370, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_370);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_371, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_371);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_372, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_372);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_373, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_373);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_374, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_374);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_375, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_375);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_376, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_376);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_377, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_377);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_378, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_378);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_379, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_379);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_380, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_380);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_381, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_381);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_382, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_382);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_383, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_383);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_384, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_384);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_385, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_385);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_386, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_386);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_387, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_387);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_388, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_388);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_389, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_389);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_390, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_390);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_391, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_391);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_392, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_392);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_393, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_393);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_394, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_394);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_395, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_395);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_396, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_396);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_397, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_397);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_398, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_398);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_v_399, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_v_399);
+
@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include <tuple>
+#include <test/prob/test_fixture_distr.hpp>
+#include <test/prob/test_fixture_cdf.hpp>
+#include <test/prob/test_fixture_cdf_log.hpp>
+#include <test/prob/test_fixture_ccdf_log.hpp>
+#include <test/prob/skew_double_exponential/skew_double_exponential_cdf_test.hpp>
+
+typedef std::tuple<std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_300;
+typedef std::tuple<std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_301;
+typedef std::tuple<std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_302;
+typedef std::tuple<std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_303;
+typedef std::tuple<std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_304;
+typedef std::tuple<std::vector<double>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_305;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, double, empty, empty> type_vv_306;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, std::vector<double>, empty, empty> type_vv_307;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_308;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, var, empty, empty> type_vv_309;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, std::vector<var>, empty, empty> type_vv_310;
+typedef std::tuple<std::vector<double>, std::vector<var>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_311;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, double, empty, empty> type_vv_312;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, std::vector<double>, empty, empty> type_vv_313;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_314;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, var, empty, empty> type_vv_315;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, std::vector<var>, empty, empty> type_vv_316;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_317;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_318;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_319;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_320;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_321;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_322;
+typedef std::tuple<std::vector<double>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_323;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, double, empty, empty> type_vv_324;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, std::vector<double>, empty, empty> type_vv_325;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_326;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, var, empty, empty> type_vv_327;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, std::vector<var>, empty, empty> type_vv_328;
+typedef std::tuple<std::vector<double>, std::vector<var>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_329;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, double, empty, empty> type_vv_330;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, std::vector<double>, empty, empty> type_vv_331;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_332;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, var, empty, empty> type_vv_333;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, std::vector<var>, empty, empty> type_vv_334;
+typedef std::tuple<std::vector<double>, std::vector<var>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_335;
+typedef std::tuple<std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_336;
+typedef std::tuple<std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_337;
+typedef std::tuple<std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_338;
+typedef std::tuple<std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_339;
+typedef std::tuple<std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_340;
+typedef std::tuple<std::vector<double>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_341;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, double, empty, empty> type_vv_342;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<double>, empty, empty> type_vv_343;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_344;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, var, empty, empty> type_vv_345;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, std::vector<var>, empty, empty> type_vv_346;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_347;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, double, empty, empty> type_vv_348;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<double>, empty, empty> type_vv_349;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_350;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, var, empty, empty> type_vv_351;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, std::vector<var>, empty, empty> type_vv_352;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_353;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, double, empty, empty> type_vv_354;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<double>, empty, empty> type_vv_355;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_356;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_357;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_358;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_359;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, double, empty, empty> type_vv_360;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<double>, empty, empty> type_vv_361;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_362;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, var, empty, empty> type_vv_363;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, std::vector<var>, empty, empty> type_vv_364;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_365;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, double, empty, empty> type_vv_366;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<double>, empty, empty> type_vv_367;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_368;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, var, empty, empty> type_vv_369;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, std::vector<var>, empty, empty> type_vv_370;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_371;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_372;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<double>, empty, empty> type_vv_373;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_374;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, var, empty, empty> type_vv_375;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, std::vector<var>, empty, empty> type_vv_376;
+typedef std::tuple<std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_377;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, var, empty, empty> type_vv_378;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, std::vector<var>, empty, empty> type_vv_379;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_380;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, var, empty, empty> type_vv_381;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, std::vector<var>, empty, empty> type_vv_382;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<double>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_383;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, var, empty, empty> type_vv_384;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, std::vector<var>, empty, empty> type_vv_385;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, Eigen::Matrix<double, Eigen::Dynamic, 1>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_386;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, double, empty, empty> type_vv_387;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, std::vector<double>, empty, empty> type_vv_388;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_389;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, var, empty, empty> type_vv_390;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, std::vector<var>, empty, empty> type_vv_391;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, var, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_392;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, double, empty, empty> type_vv_393;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, std::vector<double>, empty, empty> type_vv_394;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, Eigen::Matrix<double, Eigen::Dynamic, 1>, empty, empty> type_vv_395;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, var, empty, empty> type_vv_396;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, std::vector<var>, empty, empty> type_vv_397;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, std::vector<var>, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, empty, empty> type_vv_398;
+typedef std::tuple<Eigen::Matrix<double, Eigen::Dynamic, 1>, double, stan::math::var_value<Eigen::Matrix<double, Eigen::Dynamic, 1>>, double, empty, empty> type_vv_399;
+
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_300> AgradCdfSkewDoubleExponential_vv_300;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_301> AgradCdfSkewDoubleExponential_vv_301;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_302> AgradCdfSkewDoubleExponential_vv_302;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_303> AgradCdfSkewDoubleExponential_vv_303;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_304> AgradCdfSkewDoubleExponential_vv_304;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_305> AgradCdfSkewDoubleExponential_vv_305;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_306> AgradCdfSkewDoubleExponential_vv_306;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_307> AgradCdfSkewDoubleExponential_vv_307;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_308> AgradCdfSkewDoubleExponential_vv_308;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_309> AgradCdfSkewDoubleExponential_vv_309;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_310> AgradCdfSkewDoubleExponential_vv_310;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_311> AgradCdfSkewDoubleExponential_vv_311;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_312> AgradCdfSkewDoubleExponential_vv_312;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_313> AgradCdfSkewDoubleExponential_vv_313;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_314> AgradCdfSkewDoubleExponential_vv_314;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_315> AgradCdfSkewDoubleExponential_vv_315;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_316> AgradCdfSkewDoubleExponential_vv_316;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_317> AgradCdfSkewDoubleExponential_vv_317;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_318> AgradCdfSkewDoubleExponential_vv_318;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_319> AgradCdfSkewDoubleExponential_vv_319;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_320> AgradCdfSkewDoubleExponential_vv_320;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_321> AgradCdfSkewDoubleExponential_vv_321;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_322> AgradCdfSkewDoubleExponential_vv_322;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_323> AgradCdfSkewDoubleExponential_vv_323;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_324> AgradCdfSkewDoubleExponential_vv_324;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_325> AgradCdfSkewDoubleExponential_vv_325;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_326> AgradCdfSkewDoubleExponential_vv_326;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_327> AgradCdfSkewDoubleExponential_vv_327;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_328> AgradCdfSkewDoubleExponential_vv_328;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_329> AgradCdfSkewDoubleExponential_vv_329;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_330> AgradCdfSkewDoubleExponential_vv_330;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_331> AgradCdfSkewDoubleExponential_vv_331;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_332> AgradCdfSkewDoubleExponential_vv_332;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_333> AgradCdfSkewDoubleExponential_vv_333;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_334> AgradCdfSkewDoubleExponential_vv_334;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_335> AgradCdfSkewDoubleExponential_vv_335;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_336> AgradCdfSkewDoubleExponential_vv_336;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_337> AgradCdfSkewDoubleExponential_vv_337;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_338> AgradCdfSkewDoubleExponential_vv_338;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_339> AgradCdfSkewDoubleExponential_vv_339;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_340> AgradCdfSkewDoubleExponential_vv_340;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_341> AgradCdfSkewDoubleExponential_vv_341;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_342> AgradCdfSkewDoubleExponential_vv_342;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_343> AgradCdfSkewDoubleExponential_vv_343;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_344> AgradCdfSkewDoubleExponential_vv_344;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_345> AgradCdfSkewDoubleExponential_vv_345;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_346> AgradCdfSkewDoubleExponential_vv_346;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_347> AgradCdfSkewDoubleExponential_vv_347;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_348> AgradCdfSkewDoubleExponential_vv_348;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_349> AgradCdfSkewDoubleExponential_vv_349;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_350> AgradCdfSkewDoubleExponential_vv_350;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_351> AgradCdfSkewDoubleExponential_vv_351;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_352> AgradCdfSkewDoubleExponential_vv_352;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_353> AgradCdfSkewDoubleExponential_vv_353;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_354> AgradCdfSkewDoubleExponential_vv_354;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_355> AgradCdfSkewDoubleExponential_vv_355;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_356> AgradCdfSkewDoubleExponential_vv_356;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_357> AgradCdfSkewDoubleExponential_vv_357;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_358> AgradCdfSkewDoubleExponential_vv_358;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_359> AgradCdfSkewDoubleExponential_vv_359;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_360> AgradCdfSkewDoubleExponential_vv_360;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_361> AgradCdfSkewDoubleExponential_vv_361;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_362> AgradCdfSkewDoubleExponential_vv_362;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_363> AgradCdfSkewDoubleExponential_vv_363;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_364> AgradCdfSkewDoubleExponential_vv_364;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_365> AgradCdfSkewDoubleExponential_vv_365;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_366> AgradCdfSkewDoubleExponential_vv_366;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_367> AgradCdfSkewDoubleExponential_vv_367;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_368> AgradCdfSkewDoubleExponential_vv_368;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_369> AgradCdfSkewDoubleExponential_vv_369;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_370> AgradCdfSkewDoubleExponential_vv_370;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_371> AgradCdfSkewDoubleExponential_vv_371;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_372> AgradCdfSkewDoubleExponential_vv_372;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_373> AgradCdfSkewDoubleExponential_vv_373;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_374> AgradCdfSkewDoubleExponential_vv_374;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_375> AgradCdfSkewDoubleExponential_vv_375;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_376> AgradCdfSkewDoubleExponential_vv_376;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_377> AgradCdfSkewDoubleExponential_vv_377;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_378> AgradCdfSkewDoubleExponential_vv_378;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_379> AgradCdfSkewDoubleExponential_vv_379;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_380> AgradCdfSkewDoubleExponential_vv_380;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_381> AgradCdfSkewDoubleExponential_vv_381;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_382> AgradCdfSkewDoubleExponential_vv_382;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_383> AgradCdfSkewDoubleExponential_vv_383;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_384> AgradCdfSkewDoubleExponential_vv_384;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_385> AgradCdfSkewDoubleExponential_vv_385;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_386> AgradCdfSkewDoubleExponential_vv_386;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_387> AgradCdfSkewDoubleExponential_vv_387;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_388> AgradCdfSkewDoubleExponential_vv_388;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_389> AgradCdfSkewDoubleExponential_vv_389;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_390> AgradCdfSkewDoubleExponential_vv_390;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_391> AgradCdfSkewDoubleExponential_vv_391;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_392> AgradCdfSkewDoubleExponential_vv_392;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_393> AgradCdfSkewDoubleExponential_vv_393;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_394> AgradCdfSkewDoubleExponential_vv_394;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_395> AgradCdfSkewDoubleExponential_vv_395;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_396> AgradCdfSkewDoubleExponential_vv_396;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_397> AgradCdfSkewDoubleExponential_vv_397;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_398> AgradCdfSkewDoubleExponential_vv_398;
+typedef std::tuple<AgradCdfSkewDoubleExponential, type_vv_399> AgradCdfSkewDoubleExponential_vv_399;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_300, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_300);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_301, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_301);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_302, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_302);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_303, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_303);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_304, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_304);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_305, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_305);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_306, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_306);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_307, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_307);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_308, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_308);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_309, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_309);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_310, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_310);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_311, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_311);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_312, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_312);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_313, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_313);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_314, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_314);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_315, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_315);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_316, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_316);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_317, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_317);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_318, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_318);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_319, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_319);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_320, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_320);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_321, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_321);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_322, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_322);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_323, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_323);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_324, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_324);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_325, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_325);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_326, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_326);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_327, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_327);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_328, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_328);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_329, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_329);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_330, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_330);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_331, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_331);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_332, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_332);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_333, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_333);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_334, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_334);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_335, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_335);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_336, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_336);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_337, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_337);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_338, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_338);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_339, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_339);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_340, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_340);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_341, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_341);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_342, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_342);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_343, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_343);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_344, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_344);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_345, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_345);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_346, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_346);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_347, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_347);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_348, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_348);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_349, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_349);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_350, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_350);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_351, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_351);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_352, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_352);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_353, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_353);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_354, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_354);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_355, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_355);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_356, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_356);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_357, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_357);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_358, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_358);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_359, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_359);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_360, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_360);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_361, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_361);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_362, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_362);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_363, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_363);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_364, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_364);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_365, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_365);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_366, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_366);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_367, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_367);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_368, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_368);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_369, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_369);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_370, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_370);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_371, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_371);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_372, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_372);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_373, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_373);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_374, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_374);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_375, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_375);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_376, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_376);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_377, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_377);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_378, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_378);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_379, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_379);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_380, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_380);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_381, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_381);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_382, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_382);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_383, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_383);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_384, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_384);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_385, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_385);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_386, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_386);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_387, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_387);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_388, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_388);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_389, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_389);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_390, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_390);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_391, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_391);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_392, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_392);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_393, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_393);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_394, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_394);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_395, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_395);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_396, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_396);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_397, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_397);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_398, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_398);
+INSTANTIATE_TYPED_TEST_SUITE_P(AgradCdfSkewDoubleExponential_vv_399, AgradCdfTestFixture, AgradCdfSkewDoubleExponential_vv_399);
+